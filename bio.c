@@ -106,6 +106,18 @@ bread(uint dev, uint blockno)
   return b;
 }
 
+// Return a locked buf for the indicated block without reading
+// it, for a caller that will overwrite all of it and bwrite().
+struct buf*
+bgetw(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  b = bget(dev, blockno);
+  b->flags |= B_VALID;
+  return b;
+}
+
 // Write b's contents to disk.  Must be locked.
 void
 bwrite(struct buf *b)
@@ -0,0 +1,399 @@
+
+bootblock.o:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00007c00 <start>:
+# inb是x86汇编语言中的一个输入指令，用于从指定的I/O端口读取一个字节
+
+.code16                       # Assemble for 16-bit mode
+.globl start
+start:
+  cli                         # BIOS enabled interrupts; disable
+    7c00:	fa                   	cli
+
+  # Zero data segment registers DS, ES, and SS.
+  xorw    %ax,%ax             # Set %ax to zero
+    7c01:	31 c0                	xor    %eax,%eax
+  movw    %ax,%ds             # -> Data Segment
+    7c03:	8e d8                	mov    %eax,%ds
+  movw    %ax,%es             # -> Extra Segment
+    7c05:	8e c0                	mov    %eax,%es
+  movw    %ax,%ss             # -> Stack Segment
+    7c07:	8e d0                	mov    %eax,%ss
+
+  # Ask the BIOS for the physical memory map (INT 0x15, %eax=0xE820).
+  # The 20-byte entries go from E820MAP+4 on; E820MAP gets the
+  # address just past the last one.
+  movw    $start, %sp
+    7c09:	bc 00 7c 66 31       	mov    $0x31667c00,%esp
+  xorl    %ebx, %ebx              # Continuation value: 0 for the first
+    7c0e:	db                   	.byte 0xdb
+  movw    $(E820MAP+4), %di
+    7c0f:	bf                   	.byte 0xbf
+    7c10:	04 05                	add    $0x5,%al
+
+00007c12 <e820>:
+e820:
+  movl    $0xe820, %eax
+    7c12:	66 b8 20 e8          	mov    $0xe820,%ax
+    7c16:	00 00                	add    %al,(%eax)
+  movl    $20, %ecx               # Entry size
+    7c18:	66 b9 14 00          	mov    $0x14,%cx
+    7c1c:	00 00                	add    %al,(%eax)
+  movl    $0x534d4150, %edx       # "SMAP"
+    7c1e:	66 ba 50 41          	mov    $0x4150,%dx
+    7c22:	4d                   	dec    %ebp
+    7c23:	53                   	push   %ebx
+  int     $0x15
+    7c24:	cd 15                	int    $0x15
+  jc      e820done
+    7c26:	72 08                	jb     7c30 <e820done>
+  addw    $20, %di
+    7c28:	83 c7 14             	add    $0x14,%edi
+  testl   %ebx, %ebx              # 0 after the last entry
+    7c2b:	66 85 db             	test   %bx,%bx
+  jnz     e820
+    7c2e:	75 e2                	jne    7c12 <e820>
+
+00007c30 <e820done>:
+e820done:
+  movw    %di, E820MAP
+    7c30:	89 3e                	mov    %edi,(%esi)
+    7c32:	00                   	.byte 0x0
+    7c33:	05                   	.byte 0x5
+
+00007c34 <seta20.1>:
+
+  # Physical address line A20 is tied to zero so that the first PCs
+  # with 2 MB would run software that assumed 1 MB.  Undo that.
+seta20.1:
+  inb     $0x64,%al               # Wait for not busy
+    7c34:	e4 64                	in     $0x64,%al
+  testb   $0x2,%al
+    7c36:	a8 02                	test   $0x2,%al
+  jnz     seta20.1
+    7c38:	75 fa                	jne    7c34 <seta20.1>
+
+  movb    $0xd1,%al               # 0xd1 -> port 0x64
+    7c3a:	b0 d1                	mov    $0xd1,%al
+  outb    %al,$0x64
+    7c3c:	e6 64                	out    %al,$0x64
+
+00007c3e <seta20.2>:
+
+seta20.2:
+  inb     $0x64,%al               # Wait for not busy
+    7c3e:	e4 64                	in     $0x64,%al
+  testb   $0x2,%al
+    7c40:	a8 02                	test   $0x2,%al
+  jnz     seta20.2
+    7c42:	75 fa                	jne    7c3e <seta20.2>
+
+  movb    $0xdf,%al               # 0xdf -> port 0x60
+    7c44:	b0 df                	mov    $0xdf,%al
+  outb    %al,$0x60
+    7c46:	e6 60                	out    %al,$0x60
+
+  # Switch from real to protected mode.  Use a bootstrap GDT that makes
+  # virtual addresses map directly to physical addresses so that the
+  # effective memory map doesn't change during the transition.
+  lgdt    gdtdesc
+    7c48:	0f 01 16             	lgdtl  (%esi)
+    7c4b:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+    7c4c:	7c 0f                	jl     7c5d <start32+0x1>
+  movl    %cr0, %eax
+    7c4e:	20 c0                	and    %al,%al
+  orl     $CR0_PE, %eax
+    7c50:	66 83 c8 01          	or     $0x1,%ax
+  movl    %eax, %cr0
+    7c54:	0f 22 c0             	mov    %eax,%cr0
+
+//PAGEBREAK!
+  # Complete the transition to 32-bit protected mode by using a long jmp
+  # to reload %cs and %eip.  The segment descriptors are set up with no
+  # translation, so that the mapping is still the identity mapping.
+  ljmp    $(SEG_KCODE<<3), $start32
+    7c57:	ea                   	.byte 0xea
+    7c58:	5c                   	pop    %esp
+    7c59:	7c 08                	jl     7c63 <start32+0x7>
+	...
+
+00007c5c <start32>:
+
+.code32  # Tell assembler to generate 32-bit code now.
+start32:
+  # Set up the protected-mode data segment registers
+  movw    $(SEG_KDATA<<3), %ax    # Our data segment selector
+    7c5c:	66 b8 10 00          	mov    $0x10,%ax
+  movw    %ax, %ds                # -> DS: Data Segment
+    7c60:	8e d8                	mov    %eax,%ds
+  movw    %ax, %es                # -> ES: Extra Segment
+    7c62:	8e c0                	mov    %eax,%es
+  movw    %ax, %ss                # -> SS: Stack Segment
+    7c64:	8e d0                	mov    %eax,%ss
+  movw    $0, %ax                 # Zero segments not ready for use
+    7c66:	66 b8 00 00          	mov    $0x0,%ax
+  movw    %ax, %fs                # -> FS
+    7c6a:	8e e0                	mov    %eax,%fs
+  movw    %ax, %gs                # -> GS
+    7c6c:	8e e8                	mov    %eax,%gs
+
+  # Set up the stack pointer and call into C.
+  movl    $start, %esp
+    7c6e:	bc 00 7c 00 00       	mov    $0x7c00,%esp
+  call    bootmain
+    7c73:	e8 f1 00 00 00       	call   7d69 <bootmain>
+
+  # If bootmain returns (it shouldn't), trigger a Bochs
+  # breakpoint if running under Bochs, then loop.
+  movw    $0x8a00, %ax            # 0x8a00 -> port 0x8a00
+    7c78:	66 b8 00 8a          	mov    $0x8a00,%ax
+  movw    %ax, %dx
+    7c7c:	66 89 c2             	mov    %ax,%dx
+  outw    %ax, %dx
+    7c7f:	66 ef                	out    %ax,(%dx)
+  movw    $0x8ae0, %ax            # 0x8ae0 -> port 0x8a00
+    7c81:	66 b8 e0 8a          	mov    $0x8ae0,%ax
+  outw    %ax, %dx
+    7c85:	66 ef                	out    %ax,(%dx)
+
+00007c87 <spin>:
+spin:
+  jmp     spin
+    7c87:	eb fe                	jmp    7c87 <spin>
+    7c89:	8d 76 00             	lea    0x0(%esi),%esi
+
+00007c8c <gdt>:
+	...
+    7c94:	ff                   	(bad)
+    7c95:	ff 00                	incl   (%eax)
+    7c97:	00 00                	add    %al,(%eax)
+    7c99:	9a cf 00 ff ff 00 00 	lcall  $0x0,$0xffff00cf
+    7ca0:	00                   	.byte 0x0
+    7ca1:	92                   	xchg   %eax,%edx
+    7ca2:	cf                   	iret
+	...
+
+00007ca4 <gdtdesc>:
+    7ca4:	17                   	pop    %ss
+    7ca5:	00                   	.byte 0x0
+    7ca6:	8c 7c 00 00          	mov    %?,0x0(%eax,%eax,1)
+
+00007caa <waitdisk>:
+// 并将结果存储在寄存器eax中。最后，该代码将eax中的值传递给变量data。
+static inline uchar
+inb(ushort port) {
+    uchar data;
+
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+    7caa:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    7caf:	ec                   	in     (%dx),%al
+
+void
+waitdisk(void)
+{
+  // Wait for disk ready.
+  while((inb(0x1F7) & 0xC0) != 0x40)
+    7cb0:	83 e0 c0             	and    $0xffffffc0,%eax
+    7cb3:	3c 40                	cmp    $0x40,%al
+    7cb5:	75 f8                	jne    7caf <waitdisk+0x5>
+    ;
+}
+    7cb7:	c3                   	ret
+
+00007cb8 <readsect>:
+
+// Read a single sector at offset into dst.
+void
+readsect(void *dst, uint offset)
+{
+    7cb8:	55                   	push   %ebp
+    7cb9:	89 e5                	mov    %esp,%ebp
+    7cbb:	57                   	push   %edi
+    7cbc:	53                   	push   %ebx
+    7cbd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  // Issue command.
+  waitdisk();
+    7cc0:	e8 e5 ff ff ff       	call   7caa <waitdisk>
+            "memory", "cc");
+}
+
+static inline void
+outb(ushort port, uchar data) {
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+    7cc5:	b8 01 00 00 00       	mov    $0x1,%eax
+    7cca:	ba f2 01 00 00       	mov    $0x1f2,%edx
+    7ccf:	ee                   	out    %al,(%dx)
+    7cd0:	ba f3 01 00 00       	mov    $0x1f3,%edx
+    7cd5:	89 d8                	mov    %ebx,%eax
+    7cd7:	ee                   	out    %al,(%dx)
+  outb(0x1F2, 1);   // count = 1
+  outb(0x1F3, offset);
+  outb(0x1F4, offset >> 8);
+    7cd8:	89 d8                	mov    %ebx,%eax
+    7cda:	c1 e8 08             	shr    $0x8,%eax
+    7cdd:	ba f4 01 00 00       	mov    $0x1f4,%edx
+    7ce2:	ee                   	out    %al,(%dx)
+  outb(0x1F5, offset >> 16);
+    7ce3:	89 d8                	mov    %ebx,%eax
+    7ce5:	c1 e8 10             	shr    $0x10,%eax
+    7ce8:	ba f5 01 00 00       	mov    $0x1f5,%edx
+    7ced:	ee                   	out    %al,(%dx)
+  outb(0x1F6, (offset >> 24) | 0xE0);
+    7cee:	89 d8                	mov    %ebx,%eax
+    7cf0:	c1 e8 18             	shr    $0x18,%eax
+    7cf3:	83 c8 e0             	or     $0xffffffe0,%eax
+    7cf6:	ba f6 01 00 00       	mov    $0x1f6,%edx
+    7cfb:	ee                   	out    %al,(%dx)
+    7cfc:	b8 20 00 00 00       	mov    $0x20,%eax
+    7d01:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    7d06:	ee                   	out    %al,(%dx)
+  outb(0x1F7, 0x20);  // cmd 0x20 - read sectors
+
+  // Read data.
+  waitdisk();
+    7d07:	e8 9e ff ff ff       	call   7caa <waitdisk>
+    asm volatile("cld; rep insl" :
+    7d0c:	8b 7d 08             	mov    0x8(%ebp),%edi
+    7d0f:	b9 80 00 00 00       	mov    $0x80,%ecx
+    7d14:	ba f0 01 00 00       	mov    $0x1f0,%edx
+    7d19:	fc                   	cld
+    7d1a:	f3 6d                	rep insl (%dx),%es:(%edi)
+  insl(0x1F0, dst, SECTSIZE/4);
+}
+    7d1c:	5b                   	pop    %ebx
+    7d1d:	5f                   	pop    %edi
+    7d1e:	5d                   	pop    %ebp
+    7d1f:	c3                   	ret
+
+00007d20 <readseg>:
+
+// Read 'count' bytes at 'offset' from kernel into physical address 'pa'.
+// Might copy more than asked.
+void
+readseg(uchar* pa, uint count, uint offset)
+{
+    7d20:	55                   	push   %ebp
+    7d21:	89 e5                	mov    %esp,%ebp
+    7d23:	57                   	push   %edi
+    7d24:	56                   	push   %esi
+    7d25:	53                   	push   %ebx
+    7d26:	83 ec 0c             	sub    $0xc,%esp
+    7d29:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    7d2c:	8b 75 10             	mov    0x10(%ebp),%esi
+  uchar* epa;
+
+  epa = pa + count;
+    7d2f:	89 df                	mov    %ebx,%edi
+    7d31:	03 7d 0c             	add    0xc(%ebp),%edi
+
+  // Round down to sector boundary.
+  pa -= offset % SECTSIZE;
+    7d34:	89 f0                	mov    %esi,%eax
+    7d36:	25 ff 01 00 00       	and    $0x1ff,%eax
+    7d3b:	29 c3                	sub    %eax,%ebx
+
+  // Translate from bytes to sectors; kernel starts at sector 1.
+  offset = (offset / SECTSIZE) + 1;
+    7d3d:	c1 ee 09             	shr    $0x9,%esi
+    7d40:	83 c6 01             	add    $0x1,%esi
+
+  // If this is too slow, we could read lots of sectors at a time.
+  // We'd write more to memory than asked, but it doesn't matter --
+  // we load in increasing order.
+  for(; pa < epa; pa += SECTSIZE, offset++)
+    7d43:	39 fb                	cmp    %edi,%ebx
+    7d45:	73 1a                	jae    7d61 <readseg+0x41>
+    readsect(pa, offset);
+    7d47:	83 ec 08             	sub    $0x8,%esp
+    7d4a:	56                   	push   %esi
+    7d4b:	53                   	push   %ebx
+    7d4c:	e8 67 ff ff ff       	call   7cb8 <readsect>
+  for(; pa < epa; pa += SECTSIZE, offset++)
+    7d51:	81 c3 00 02 00 00    	add    $0x200,%ebx
+    7d57:	83 c6 01             	add    $0x1,%esi
+    7d5a:	83 c4 10             	add    $0x10,%esp
+    7d5d:	39 fb                	cmp    %edi,%ebx
+    7d5f:	72 e6                	jb     7d47 <readseg+0x27>
+}
+    7d61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    7d64:	5b                   	pop    %ebx
+    7d65:	5e                   	pop    %esi
+    7d66:	5f                   	pop    %edi
+    7d67:	5d                   	pop    %ebp
+    7d68:	c3                   	ret
+
+00007d69 <bootmain>:
+{
+    7d69:	55                   	push   %ebp
+    7d6a:	89 e5                	mov    %esp,%ebp
+    7d6c:	57                   	push   %edi
+    7d6d:	56                   	push   %esi
+    7d6e:	53                   	push   %ebx
+    7d6f:	83 ec 10             	sub    $0x10,%esp
+  readseg((uchar*)elf, 4096, 0);
+    7d72:	6a 00                	push   $0x0
+    7d74:	68 00 10 00 00       	push   $0x1000
+    7d79:	68 00 00 01 00       	push   $0x10000
+    7d7e:	e8 9d ff ff ff       	call   7d20 <readseg>
+  if(elf->magic != ELF_MAGIC)
+    7d83:	83 c4 10             	add    $0x10,%esp
+    7d86:	81 3d 00 00 01 00 7f 	cmpl   $0x464c457f,0x10000
+    7d8d:	45 4c 46 
+    7d90:	75 21                	jne    7db3 <bootmain+0x4a>
+  ph = (struct proghdr*)((uchar*)elf + elf->phoff);
+    7d92:	a1 1c 00 01 00       	mov    0x1001c,%eax
+    7d97:	8d 98 00 00 01 00    	lea    0x10000(%eax),%ebx
+  eph = ph + elf->phnum;
+    7d9d:	0f b7 35 2c 00 01 00 	movzwl 0x1002c,%esi
+    7da4:	c1 e6 05             	shl    $0x5,%esi
+    7da7:	01 de                	add    %ebx,%esi
+  for(; ph < eph; ph++){
+    7da9:	39 f3                	cmp    %esi,%ebx
+    7dab:	72 15                	jb     7dc2 <bootmain+0x59>
+  entry();
+    7dad:	ff 15 18 00 01 00    	call   *0x10018
+}
+    7db3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    7db6:	5b                   	pop    %ebx
+    7db7:	5e                   	pop    %esi
+    7db8:	5f                   	pop    %edi
+    7db9:	5d                   	pop    %ebp
+    7dba:	c3                   	ret
+  for(; ph < eph; ph++){
+    7dbb:	83 c3 20             	add    $0x20,%ebx
+    7dbe:	39 f3                	cmp    %esi,%ebx
+    7dc0:	73 eb                	jae    7dad <bootmain+0x44>
+    pa = (uchar*)ph->paddr;
+    7dc2:	8b 7b 0c             	mov    0xc(%ebx),%edi
+    readseg(pa, ph->filesz, ph->off);
+    7dc5:	83 ec 04             	sub    $0x4,%esp
+    7dc8:	ff 73 04             	push   0x4(%ebx)
+    7dcb:	ff 73 10             	push   0x10(%ebx)
+    7dce:	57                   	push   %edi
+    7dcf:	e8 4c ff ff ff       	call   7d20 <readseg>
+    if(ph->memsz > ph->filesz)
+    7dd4:	8b 4b 14             	mov    0x14(%ebx),%ecx
+    7dd7:	8b 43 10             	mov    0x10(%ebx),%eax
+    7dda:	83 c4 10             	add    $0x10,%esp
+    7ddd:	39 c8                	cmp    %ecx,%eax
+    7ddf:	73 da                	jae    7dbb <bootmain+0x52>
+      stosb(pa + ph->filesz, 0, ph->memsz - ph->filesz);
+    7de1:	01 c7                	add    %eax,%edi
+    7de3:	29 c1                	sub    %eax,%ecx
+            "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt) {
+    asm volatile("cld; rep stosb" :
+    7de5:	b8 00 00 00 00       	mov    $0x0,%eax
+    7dea:	fc                   	cld
+    7deb:	f3 aa                	rep stos %al,%es:(%edi)
+            "=D" (addr), "=c" (cnt) :
+            "0" (addr), "1" (cnt), "a" (data) :
+            "memory", "cc");
+}
+    7ded:	eb cc                	jmp    7dbb <bootmain+0x52>
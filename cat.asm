@@ -0,0 +1,4062 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	be 01 00 00 00       	mov    $0x1,%esi
+      14:	53                   	push   %ebx
+      15:	51                   	push   %ecx
+      16:	83 ec 18             	sub    $0x18,%esp
+      19:	8b 01                	mov    (%ecx),%eax
+      1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+      1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+      24:	83 f8 01             	cmp    $0x1,%eax
+      27:	7f 26                	jg     4f <main+0x4f>
+      29:	eb 52                	jmp    7d <main+0x7d>
+      2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+      30:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 1; i < argc; i++){
+      33:	83 c6 01             	add    $0x1,%esi
+      36:	83 c3 04             	add    $0x4,%ebx
+    cat(fd);
+      39:	50                   	push   %eax
+      3a:	e8 51 00 00 00       	call   90 <cat>
+    close(fd);
+      3f:	89 3c 24             	mov    %edi,(%esp)
+      42:	e8 b9 04 00 00       	call   500 <close>
+  for(i = 1; i < argc; i++){
+      47:	83 c4 10             	add    $0x10,%esp
+      4a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+      4d:	74 29                	je     78 <main+0x78>
+    if((fd = open(argv[i], 0)) < 0){
+      4f:	83 ec 08             	sub    $0x8,%esp
+      52:	6a 00                	push   $0x0
+      54:	ff 33                	push   (%ebx)
+      56:	e8 d2 04 00 00       	call   52d <open>
+      5b:	83 c4 10             	add    $0x10,%esp
+      5e:	89 c7                	mov    %eax,%edi
+      60:	85 c0                	test   %eax,%eax
+      62:	79 cc                	jns    30 <main+0x30>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      64:	50                   	push   %eax
+      65:	ff 33                	push   (%ebx)
+      67:	68 db 1d 00 00       	push   $0x1ddb
+      6c:	6a 01                	push   $0x1
+      6e:	e8 bd 08 00 00       	call   930 <printf>
+      exit();
+      73:	e8 f8 00 00 00       	call   170 <exit>
+  }
+  exit();
+      78:	e8 f3 00 00 00       	call   170 <exit>
+    cat(0);
+      7d:	83 ec 0c             	sub    $0xc,%esp
+      80:	6a 00                	push   $0x0
+      82:	e8 09 00 00 00       	call   90 <cat>
+    exit();
+      87:	e8 e4 00 00 00       	call   170 <exit>
+      8c:	66 90                	xchg   %ax,%ax
+      8e:	66 90                	xchg   %ax,%ax
+
+00000090 <cat>:
+{
+      90:	55                   	push   %ebp
+      91:	89 e5                	mov    %esp,%ebp
+      93:	56                   	push   %esi
+      94:	53                   	push   %ebx
+      95:	8b 75 08             	mov    0x8(%ebp),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+      98:	eb 1d                	jmp    b7 <cat+0x27>
+      9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if (write(1, buf, n) != n) {
+      a0:	83 ec 04             	sub    $0x4,%esp
+      a3:	53                   	push   %ebx
+      a4:	68 e0 28 00 00       	push   $0x28e0
+      a9:	6a 01                	push   $0x1
+      ab:	e8 41 04 00 00       	call   4f1 <write>
+      b0:	83 c4 10             	add    $0x10,%esp
+      b3:	39 d8                	cmp    %ebx,%eax
+      b5:	75 25                	jne    dc <cat+0x4c>
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+      b7:	83 ec 04             	sub    $0x4,%esp
+      ba:	68 00 02 00 00       	push   $0x200
+      bf:	68 e0 28 00 00       	push   $0x28e0
+      c4:	56                   	push   %esi
+      c5:	e8 18 04 00 00       	call   4e2 <read>
+      ca:	83 c4 10             	add    $0x10,%esp
+      cd:	89 c3                	mov    %eax,%ebx
+      cf:	85 c0                	test   %eax,%eax
+      d1:	7f cd                	jg     a0 <cat+0x10>
+  if(n < 0){
+      d3:	75 1b                	jne    f0 <cat+0x60>
+}
+      d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      d8:	5b                   	pop    %ebx
+      d9:	5e                   	pop    %esi
+      da:	5d                   	pop    %ebp
+      db:	c3                   	ret
+      printf(1, "cat: write error\n");
+      dc:	83 ec 08             	sub    $0x8,%esp
+      df:	68 b8 1d 00 00       	push   $0x1db8
+      e4:	6a 01                	push   $0x1
+      e6:	e8 45 08 00 00       	call   930 <printf>
+      exit();
+      eb:	e8 80 00 00 00       	call   170 <exit>
+    printf(1, "cat: read error\n");
+      f0:	50                   	push   %eax
+      f1:	50                   	push   %eax
+      f2:	68 ca 1d 00 00       	push   $0x1dca
+      f7:	6a 01                	push   $0x1
+      f9:	e8 32 08 00 00       	call   930 <printf>
+    exit();
+      fe:	e8 6d 00 00 00       	call   170 <exit>
+     103:	66 90                	xchg   %ax,%ax
+     105:	66 90                	xchg   %ax,%ax
+     107:	66 90                	xchg   %ax,%ax
+     109:	66 90                	xchg   %ax,%ax
+     10b:	66 90                	xchg   %ax,%ax
+     10d:	66 90                	xchg   %ax,%ax
+     10f:	90                   	nop
+
+00000110 <fork>:
+int sysexit(void) __attribute__((noreturn));
+
+int
+fork(void)
+{
+  if(flushhook)
+     110:	a1 e0 2a 00 00       	mov    0x2ae0,%eax
+     115:	85 c0                	test   %eax,%eax
+     117:	74 17                	je     130 <fork+0x20>
+{
+     119:	55                   	push   %ebp
+     11a:	89 e5                	mov    %esp,%ebp
+     11c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     11f:	ff d0                	call   *%eax
+  return sysfork();
+}
+     121:	c9                   	leave
+  return sysfork();
+     122:	e9 7f 03 00 00       	jmp    4a6 <sysfork>
+     127:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     12e:	66 90                	xchg   %ax,%ax
+     130:	e9 71 03 00 00       	jmp    4a6 <sysfork>
+     135:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     13c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+     140:	55                   	push   %ebp
+  if(flushhook)
+     141:	a1 e0 2a 00 00       	mov    0x2ae0,%eax
+{
+     146:	89 e5                	mov    %esp,%ebp
+     148:	56                   	push   %esi
+     149:	53                   	push   %ebx
+     14a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     14d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     150:	85 c0                	test   %eax,%eax
+     152:	74 02                	je     156 <exec+0x16>
+    flushhook();
+     154:	ff d0                	call   *%eax
+  return sysexec(path, argv);
+     156:	89 75 0c             	mov    %esi,0xc(%ebp)
+     159:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     15c:	5b                   	pop    %ebx
+     15d:	5e                   	pop    %esi
+     15e:	5d                   	pop    %ebp
+  return sysexec(path, argv);
+     15f:	e9 ba 03 00 00       	jmp    51e <sysexec>
+     164:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     16b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     16f:	90                   	nop
+
+00000170 <exit>:
+
+int
+exit(void)
+{
+     170:	55                   	push   %ebp
+     171:	89 e5                	mov    %esp,%ebp
+     173:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     176:	a1 e0 2a 00 00       	mov    0x2ae0,%eax
+     17b:	85 c0                	test   %eax,%eax
+     17d:	74 02                	je     181 <exit+0x11>
+    flushhook();
+     17f:	ff d0                	call   *%eax
+  sysexit();
+     181:	e8 2f 03 00 00       	call   4b5 <sysexit>
+     186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     18d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000190 <strcpy>:
+}
+
+char*
+strcpy(char *s, const char *t)
+{
+     190:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     191:	31 c0                	xor    %eax,%eax
+{
+     193:	89 e5                	mov    %esp,%ebp
+     195:	53                   	push   %ebx
+     196:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     199:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     19c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     1a0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     1a4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     1a7:	83 c0 01             	add    $0x1,%eax
+     1aa:	84 d2                	test   %dl,%dl
+     1ac:	75 f2                	jne    1a0 <strcpy+0x10>
+    ;
+  return os;
+}
+     1ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1b1:	89 c8                	mov    %ecx,%eax
+     1b3:	c9                   	leave
+     1b4:	c3                   	ret
+     1b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001c0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     1c0:	55                   	push   %ebp
+     1c1:	89 e5                	mov    %esp,%ebp
+     1c3:	53                   	push   %ebx
+     1c4:	8b 55 08             	mov    0x8(%ebp),%edx
+     1c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     1ca:	0f b6 02             	movzbl (%edx),%eax
+     1cd:	84 c0                	test   %al,%al
+     1cf:	75 17                	jne    1e8 <strcmp+0x28>
+     1d1:	eb 3a                	jmp    20d <strcmp+0x4d>
+     1d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1d7:	90                   	nop
+     1d8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     1dc:	83 c2 01             	add    $0x1,%edx
+     1df:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     1e2:	84 c0                	test   %al,%al
+     1e4:	74 1a                	je     200 <strcmp+0x40>
+    p++, q++;
+     1e6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     1e8:	0f b6 19             	movzbl (%ecx),%ebx
+     1eb:	38 c3                	cmp    %al,%bl
+     1ed:	74 e9                	je     1d8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     1ef:	29 d8                	sub    %ebx,%eax
+}
+     1f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1f4:	c9                   	leave
+     1f5:	c3                   	ret
+     1f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1fd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     200:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     204:	31 c0                	xor    %eax,%eax
+     206:	29 d8                	sub    %ebx,%eax
+}
+     208:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     20b:	c9                   	leave
+     20c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     20d:	0f b6 19             	movzbl (%ecx),%ebx
+     210:	31 c0                	xor    %eax,%eax
+     212:	eb db                	jmp    1ef <strcmp+0x2f>
+     214:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     21b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     21f:	90                   	nop
+
+00000220 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     220:	55                   	push   %ebp
+     221:	89 e5                	mov    %esp,%ebp
+     223:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     226:	80 3a 00             	cmpb   $0x0,(%edx)
+     229:	74 15                	je     240 <strlen+0x20>
+     22b:	31 c0                	xor    %eax,%eax
+     22d:	8d 76 00             	lea    0x0(%esi),%esi
+     230:	83 c0 01             	add    $0x1,%eax
+     233:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     237:	89 c1                	mov    %eax,%ecx
+     239:	75 f5                	jne    230 <strlen+0x10>
+    ;
+  return n;
+}
+     23b:	89 c8                	mov    %ecx,%eax
+     23d:	5d                   	pop    %ebp
+     23e:	c3                   	ret
+     23f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     240:	31 c9                	xor    %ecx,%ecx
+}
+     242:	5d                   	pop    %ebp
+     243:	89 c8                	mov    %ecx,%eax
+     245:	c3                   	ret
+     246:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     24d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000250 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     250:	55                   	push   %ebp
+     251:	89 e5                	mov    %esp,%ebp
+     253:	57                   	push   %edi
+     254:	8b 55 08             	mov    0x8(%ebp),%edx
+            "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt) {
+    asm volatile("cld; rep stosb" :
+     257:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     25a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     25d:	89 d7                	mov    %edx,%edi
+     25f:	fc                   	cld
+     260:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     262:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     265:	89 d0                	mov    %edx,%eax
+     267:	c9                   	leave
+     268:	c3                   	ret
+     269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000270 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     270:	55                   	push   %ebp
+     271:	89 e5                	mov    %esp,%ebp
+     273:	8b 45 08             	mov    0x8(%ebp),%eax
+     276:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     27a:	0f b6 10             	movzbl (%eax),%edx
+     27d:	84 d2                	test   %dl,%dl
+     27f:	75 12                	jne    293 <strchr+0x23>
+     281:	eb 1d                	jmp    2a0 <strchr+0x30>
+     283:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     287:	90                   	nop
+     288:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     28c:	83 c0 01             	add    $0x1,%eax
+     28f:	84 d2                	test   %dl,%dl
+     291:	74 0d                	je     2a0 <strchr+0x30>
+    if(*s == c)
+     293:	38 d1                	cmp    %dl,%cl
+     295:	75 f1                	jne    288 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     297:	5d                   	pop    %ebp
+     298:	c3                   	ret
+     299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     2a0:	31 c0                	xor    %eax,%eax
+}
+     2a2:	5d                   	pop    %ebp
+     2a3:	c3                   	ret
+     2a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2af:	90                   	nop
+
+000002b0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     2b0:	55                   	push   %ebp
+     2b1:	89 e5                	mov    %esp,%ebp
+     2b3:	56                   	push   %esi
+     2b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     2b5:	83 ec 08             	sub    $0x8,%esp
+     2b8:	6a 00                	push   $0x0
+     2ba:	ff 75 08             	push   0x8(%ebp)
+     2bd:	e8 6b 02 00 00       	call   52d <open>
+  if(fd < 0)
+     2c2:	83 c4 10             	add    $0x10,%esp
+     2c5:	85 c0                	test   %eax,%eax
+     2c7:	78 27                	js     2f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     2c9:	83 ec 08             	sub    $0x8,%esp
+     2cc:	ff 75 0c             	push   0xc(%ebp)
+     2cf:	89 c3                	mov    %eax,%ebx
+     2d1:	50                   	push   %eax
+     2d2:	e8 83 02 00 00       	call   55a <fstat>
+  close(fd);
+     2d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     2da:	89 c6                	mov    %eax,%esi
+  close(fd);
+     2dc:	e8 1f 02 00 00       	call   500 <close>
+  return r;
+     2e1:	83 c4 10             	add    $0x10,%esp
+}
+     2e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     2e7:	89 f0                	mov    %esi,%eax
+     2e9:	5b                   	pop    %ebx
+     2ea:	5e                   	pop    %esi
+     2eb:	5d                   	pop    %ebp
+     2ec:	c3                   	ret
+     2ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     2f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     2f5:	eb ed                	jmp    2e4 <stat+0x34>
+     2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2fe:	66 90                	xchg   %ax,%ax
+
+00000300 <atoi>:
+
+int
+atoi(const char *s)
+{
+     300:	55                   	push   %ebp
+     301:	89 e5                	mov    %esp,%ebp
+     303:	53                   	push   %ebx
+     304:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     307:	0f be 02             	movsbl (%edx),%eax
+     30a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     30d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     310:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     315:	77 1e                	ja     335 <atoi+0x35>
+     317:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     31e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     320:	83 c2 01             	add    $0x1,%edx
+     323:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     326:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     32a:	0f be 02             	movsbl (%edx),%eax
+     32d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     330:	80 fb 09             	cmp    $0x9,%bl
+     333:	76 eb                	jbe    320 <atoi+0x20>
+  return n;
+}
+     335:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     338:	89 c8                	mov    %ecx,%eax
+     33a:	c9                   	leave
+     33b:	c3                   	ret
+     33c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000340 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     340:	55                   	push   %ebp
+     341:	89 e5                	mov    %esp,%ebp
+     343:	57                   	push   %edi
+     344:	56                   	push   %esi
+     345:	8b 45 10             	mov    0x10(%ebp),%eax
+     348:	8b 55 08             	mov    0x8(%ebp),%edx
+     34b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     34e:	85 c0                	test   %eax,%eax
+     350:	7e 13                	jle    365 <memmove+0x25>
+     352:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     354:	89 d7                	mov    %edx,%edi
+     356:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     35d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     360:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     361:	39 f8                	cmp    %edi,%eax
+     363:	75 fb                	jne    360 <memmove+0x20>
+  return vdst;
+}
+     365:	5e                   	pop    %esi
+     366:	89 d0                	mov    %edx,%eax
+     368:	5f                   	pop    %edi
+     369:	5d                   	pop    %ebp
+     36a:	c3                   	ret
+     36b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     36f:	90                   	nop
+
+00000370 <mutex_init>:
+
+// Futex-based mutex (Drepper, "Futexes Are Tricky", mutex 2).
+// The uncontended paths never enter the kernel.
+void
+mutex_init(struct mutex *m)
+{
+     370:	55                   	push   %ebp
+     371:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+     373:	8b 45 08             	mov    0x8(%ebp),%eax
+     376:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     37c:	5d                   	pop    %ebp
+     37d:	c3                   	ret
+     37e:	66 90                	xchg   %ax,%ax
+
+00000380 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     380:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     381:	31 c0                	xor    %eax,%eax
+     383:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+     388:	89 e5                	mov    %esp,%ebp
+     38a:	56                   	push   %esi
+     38b:	53                   	push   %ebx
+     38c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     38f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     393:	85 c0                	test   %eax,%eax
+     395:	74 32                	je     3c9 <mutex_lock+0x49>
+    return;
+  if(c != 2)
+     397:	83 f8 02             	cmp    $0x2,%eax
+     39a:	74 0c                	je     3a8 <mutex_lock+0x28>
+static inline uint
+xchg(volatile uint *addr, uint newval) {
+    uint result;
+
+    // The + in "+m" denotes a read-modify-write operand.
+    asm volatile("lock; xchgl %0, %1" :
+     39c:	b8 02 00 00 00       	mov    $0x2,%eax
+     3a1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+     3a4:	85 c0                	test   %eax,%eax
+     3a6:	74 21                	je     3c9 <mutex_lock+0x49>
+     3a8:	be 02 00 00 00       	mov    $0x2,%esi
+     3ad:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAIT, 2);
+     3b0:	83 ec 04             	sub    $0x4,%esp
+     3b3:	6a 02                	push   $0x2
+     3b5:	6a 00                	push   $0x0
+     3b7:	53                   	push   %ebx
+     3b8:	e8 33 02 00 00       	call   5f0 <futex>
+     3bd:	89 f0                	mov    %esi,%eax
+     3bf:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     3c2:	83 c4 10             	add    $0x10,%esp
+     3c5:	85 c0                	test   %eax,%eax
+     3c7:	75 e7                	jne    3b0 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+     3c9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     3cc:	5b                   	pop    %ebx
+     3cd:	5e                   	pop    %esi
+     3ce:	5d                   	pop    %ebp
+     3cf:	c3                   	ret
+
+000003d0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     3d0:	55                   	push   %ebp
+     3d1:	89 e5                	mov    %esp,%ebp
+     3d3:	83 ec 08             	sub    $0x8,%esp
+     3d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     3d9:	f0 83 28 01          	lock subl $0x1,(%eax)
+     3dd:	75 09                	jne    3e8 <mutex_unlock+0x18>
+    m->val = 0;
+    futex(&m->val, FUTEX_WAKE, 1);
+  }
+}
+     3df:	c9                   	leave
+     3e0:	c3                   	ret
+     3e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     3e8:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     3eb:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex(&m->val, FUTEX_WAKE, 1);
+     3f1:	6a 01                	push   $0x1
+     3f3:	6a 01                	push   $0x1
+     3f5:	50                   	push   %eax
+     3f6:	e8 f5 01 00 00       	call   5f0 <futex>
+     3fb:	83 c4 10             	add    $0x10,%esp
+}
+     3fe:	c9                   	leave
+     3ff:	c3                   	ret
+
+00000400 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     400:	55                   	push   %ebp
+     401:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     403:	8b 45 08             	mov    0x8(%ebp),%eax
+     406:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     40c:	5d                   	pop    %ebp
+     40d:	c3                   	ret
+     40e:	66 90                	xchg   %ax,%ax
+
+00000410 <cond_wait>:
+
+// Release m and wait for a signal, then reacquire m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     410:	55                   	push   %ebp
+     411:	89 e5                	mov    %esp,%ebp
+     413:	57                   	push   %edi
+     414:	56                   	push   %esi
+     415:	53                   	push   %ebx
+     416:	83 ec 0c             	sub    $0xc,%esp
+     419:	8b 75 08             	mov    0x8(%ebp),%esi
+     41c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     41f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     421:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+     425:	75 21                	jne    448 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     427:	83 ec 04             	sub    $0x4,%esp
+     42a:	57                   	push   %edi
+     42b:	6a 00                	push   $0x0
+     42d:	56                   	push   %esi
+     42e:	e8 bd 01 00 00       	call   5f0 <futex>
+  mutex_lock(m);
+     433:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     436:	83 c4 10             	add    $0x10,%esp
+}
+     439:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     43c:	5b                   	pop    %ebx
+     43d:	5e                   	pop    %esi
+     43e:	5f                   	pop    %edi
+     43f:	5d                   	pop    %ebp
+  mutex_lock(m);
+     440:	e9 3b ff ff ff       	jmp    380 <mutex_lock>
+     445:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     448:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     44b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex(&m->val, FUTEX_WAKE, 1);
+     451:	6a 01                	push   $0x1
+     453:	6a 01                	push   $0x1
+     455:	53                   	push   %ebx
+     456:	e8 95 01 00 00       	call   5f0 <futex>
+     45b:	83 c4 10             	add    $0x10,%esp
+     45e:	eb c7                	jmp    427 <cond_wait+0x17>
+
+00000460 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+     460:	55                   	push   %ebp
+     461:	89 e5                	mov    %esp,%ebp
+     463:	83 ec 0c             	sub    $0xc,%esp
+     466:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     469:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+     46d:	6a 01                	push   $0x1
+     46f:	6a 01                	push   $0x1
+     471:	50                   	push   %eax
+     472:	e8 79 01 00 00       	call   5f0 <futex>
+}
+     477:	83 c4 10             	add    $0x10,%esp
+     47a:	c9                   	leave
+     47b:	c3                   	ret
+     47c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     480:	55                   	push   %ebp
+     481:	89 e5                	mov    %esp,%ebp
+     483:	83 ec 0c             	sub    $0xc,%esp
+     486:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     489:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+     48d:	6a 40                	push   $0x40
+     48f:	6a 01                	push   $0x1
+     491:	50                   	push   %eax
+     492:	e8 59 01 00 00       	call   5f0 <futex>
+}
+     497:	83 c4 10             	add    $0x10,%esp
+     49a:	c9                   	leave
+     49b:	c3                   	ret
+     49c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004a0 <uptime>:
+// Clock ticks since boot, read from the kernel's vdso page
+// without a system call.
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     4a0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+     4a5:	c3                   	ret
+
+000004a6 <sysfork>:
+  1: ret
+
+#define SYSCALL(name) SYSCALLAS(name, name)
+
+// ulib.c wraps these.
+SYSCALLAS(sysfork, fork)
+     4a6:	b8 01 00 00 00       	mov    $0x1,%eax
+     4ab:	89 e1                	mov    %esp,%ecx
+     4ad:	ba b4 04 00 00       	mov    $0x4b4,%edx
+     4b2:	0f 34                	sysenter
+     4b4:	c3                   	ret
+
+000004b5 <sysexit>:
+SYSCALLAS(sysexit, exit)
+     4b5:	b8 02 00 00 00       	mov    $0x2,%eax
+     4ba:	89 e1                	mov    %esp,%ecx
+     4bc:	ba c3 04 00 00       	mov    $0x4c3,%edx
+     4c1:	0f 34                	sysenter
+     4c3:	c3                   	ret
+
+000004c4 <wait>:
+SYSCALL(wait)
+     4c4:	b8 03 00 00 00       	mov    $0x3,%eax
+     4c9:	89 e1                	mov    %esp,%ecx
+     4cb:	ba d2 04 00 00       	mov    $0x4d2,%edx
+     4d0:	0f 34                	sysenter
+     4d2:	c3                   	ret
+
+000004d3 <pipe>:
+SYSCALL(pipe)
+     4d3:	b8 04 00 00 00       	mov    $0x4,%eax
+     4d8:	89 e1                	mov    %esp,%ecx
+     4da:	ba e1 04 00 00       	mov    $0x4e1,%edx
+     4df:	0f 34                	sysenter
+     4e1:	c3                   	ret
+
+000004e2 <read>:
+SYSCALL(read)
+     4e2:	b8 05 00 00 00       	mov    $0x5,%eax
+     4e7:	89 e1                	mov    %esp,%ecx
+     4e9:	ba f0 04 00 00       	mov    $0x4f0,%edx
+     4ee:	0f 34                	sysenter
+     4f0:	c3                   	ret
+
+000004f1 <write>:
+SYSCALL(write)
+     4f1:	b8 10 00 00 00       	mov    $0x10,%eax
+     4f6:	89 e1                	mov    %esp,%ecx
+     4f8:	ba ff 04 00 00       	mov    $0x4ff,%edx
+     4fd:	0f 34                	sysenter
+     4ff:	c3                   	ret
+
+00000500 <close>:
+SYSCALL(close)
+     500:	b8 15 00 00 00       	mov    $0x15,%eax
+     505:	89 e1                	mov    %esp,%ecx
+     507:	ba 0e 05 00 00       	mov    $0x50e,%edx
+     50c:	0f 34                	sysenter
+     50e:	c3                   	ret
+
+0000050f <kill>:
+SYSCALL(kill)
+     50f:	b8 06 00 00 00       	mov    $0x6,%eax
+     514:	89 e1                	mov    %esp,%ecx
+     516:	ba 1d 05 00 00       	mov    $0x51d,%edx
+     51b:	0f 34                	sysenter
+     51d:	c3                   	ret
+
+0000051e <sysexec>:
+SYSCALLAS(sysexec, exec)
+     51e:	b8 07 00 00 00       	mov    $0x7,%eax
+     523:	89 e1                	mov    %esp,%ecx
+     525:	ba 2c 05 00 00       	mov    $0x52c,%edx
+     52a:	0f 34                	sysenter
+     52c:	c3                   	ret
+
+0000052d <open>:
+SYSCALL(open)
+     52d:	b8 0f 00 00 00       	mov    $0xf,%eax
+     532:	89 e1                	mov    %esp,%ecx
+     534:	ba 3b 05 00 00       	mov    $0x53b,%edx
+     539:	0f 34                	sysenter
+     53b:	c3                   	ret
+
+0000053c <mknod>:
+SYSCALL(mknod)
+     53c:	b8 11 00 00 00       	mov    $0x11,%eax
+     541:	89 e1                	mov    %esp,%ecx
+     543:	ba 4a 05 00 00       	mov    $0x54a,%edx
+     548:	0f 34                	sysenter
+     54a:	c3                   	ret
+
+0000054b <unlink>:
+SYSCALL(unlink)
+     54b:	b8 12 00 00 00       	mov    $0x12,%eax
+     550:	89 e1                	mov    %esp,%ecx
+     552:	ba 59 05 00 00       	mov    $0x559,%edx
+     557:	0f 34                	sysenter
+     559:	c3                   	ret
+
+0000055a <fstat>:
+SYSCALL(fstat)
+     55a:	b8 08 00 00 00       	mov    $0x8,%eax
+     55f:	89 e1                	mov    %esp,%ecx
+     561:	ba 68 05 00 00       	mov    $0x568,%edx
+     566:	0f 34                	sysenter
+     568:	c3                   	ret
+
+00000569 <link>:
+SYSCALL(link)
+     569:	b8 13 00 00 00       	mov    $0x13,%eax
+     56e:	89 e1                	mov    %esp,%ecx
+     570:	ba 77 05 00 00       	mov    $0x577,%edx
+     575:	0f 34                	sysenter
+     577:	c3                   	ret
+
+00000578 <mkdir>:
+SYSCALL(mkdir)
+     578:	b8 14 00 00 00       	mov    $0x14,%eax
+     57d:	89 e1                	mov    %esp,%ecx
+     57f:	ba 86 05 00 00       	mov    $0x586,%edx
+     584:	0f 34                	sysenter
+     586:	c3                   	ret
+
+00000587 <chdir>:
+SYSCALL(chdir)
+     587:	b8 09 00 00 00       	mov    $0x9,%eax
+     58c:	89 e1                	mov    %esp,%ecx
+     58e:	ba 95 05 00 00       	mov    $0x595,%edx
+     593:	0f 34                	sysenter
+     595:	c3                   	ret
+
+00000596 <dup>:
+SYSCALL(dup)
+     596:	b8 0a 00 00 00       	mov    $0xa,%eax
+     59b:	89 e1                	mov    %esp,%ecx
+     59d:	ba a4 05 00 00       	mov    $0x5a4,%edx
+     5a2:	0f 34                	sysenter
+     5a4:	c3                   	ret
+
+000005a5 <getpid>:
+SYSCALL(getpid)
+     5a5:	b8 0b 00 00 00       	mov    $0xb,%eax
+     5aa:	89 e1                	mov    %esp,%ecx
+     5ac:	ba b3 05 00 00       	mov    $0x5b3,%edx
+     5b1:	0f 34                	sysenter
+     5b3:	c3                   	ret
+
+000005b4 <sbrk>:
+SYSCALL(sbrk)
+     5b4:	b8 0c 00 00 00       	mov    $0xc,%eax
+     5b9:	89 e1                	mov    %esp,%ecx
+     5bb:	ba c2 05 00 00       	mov    $0x5c2,%edx
+     5c0:	0f 34                	sysenter
+     5c2:	c3                   	ret
+
+000005c3 <sleep>:
+SYSCALL(sleep)
+     5c3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     5c8:	89 e1                	mov    %esp,%ecx
+     5ca:	ba d1 05 00 00       	mov    $0x5d1,%edx
+     5cf:	0f 34                	sysenter
+     5d1:	c3                   	ret
+
+000005d2 <clone>:
+SYSCALL(clone)
+     5d2:	b8 16 00 00 00       	mov    $0x16,%eax
+     5d7:	89 e1                	mov    %esp,%ecx
+     5d9:	ba e0 05 00 00       	mov    $0x5e0,%edx
+     5de:	0f 34                	sysenter
+     5e0:	c3                   	ret
+
+000005e1 <join>:
+SYSCALL(join)
+     5e1:	b8 17 00 00 00       	mov    $0x17,%eax
+     5e6:	89 e1                	mov    %esp,%ecx
+     5e8:	ba ef 05 00 00       	mov    $0x5ef,%edx
+     5ed:	0f 34                	sysenter
+     5ef:	c3                   	ret
+
+000005f0 <futex>:
+SYSCALL(futex)
+     5f0:	b8 18 00 00 00       	mov    $0x18,%eax
+     5f5:	89 e1                	mov    %esp,%ecx
+     5f7:	ba fe 05 00 00       	mov    $0x5fe,%edx
+     5fc:	0f 34                	sysenter
+     5fe:	c3                   	ret
+
+000005ff <yield>:
+SYSCALL(yield)
+     5ff:	b8 19 00 00 00       	mov    $0x19,%eax
+     604:	89 e1                	mov    %esp,%ecx
+     606:	ba 0d 06 00 00       	mov    $0x60d,%edx
+     60b:	0f 34                	sysenter
+     60d:	c3                   	ret
+
+0000060e <lockstat>:
+SYSCALL(lockstat)
+     60e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     613:	89 e1                	mov    %esp,%ecx
+     615:	ba 1c 06 00 00       	mov    $0x61c,%edx
+     61a:	0f 34                	sysenter
+     61c:	c3                   	ret
+
+0000061d <lockhammer>:
+SYSCALL(lockhammer)
+     61d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     622:	89 e1                	mov    %esp,%ecx
+     624:	ba 2b 06 00 00       	mov    $0x62b,%edx
+     629:	0f 34                	sysenter
+     62b:	c3                   	ret
+
+0000062c <vmsplice>:
+SYSCALL(vmsplice)
+     62c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     631:	89 e1                	mov    %esp,%ecx
+     633:	ba 3a 06 00 00       	mov    $0x63a,%edx
+     638:	0f 34                	sysenter
+     63a:	c3                   	ret
+
+0000063b <hsbrk>:
+SYSCALL(hsbrk)
+     63b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     640:	89 e1                	mov    %esp,%ecx
+     642:	ba 49 06 00 00       	mov    $0x649,%edx
+     647:	0f 34                	sysenter
+     649:	c3                   	ret
+
+0000064a <mmap>:
+SYSCALL(mmap)
+     64a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     64f:	89 e1                	mov    %esp,%ecx
+     651:	ba 58 06 00 00       	mov    $0x658,%edx
+     656:	0f 34                	sysenter
+     658:	c3                   	ret
+
+00000659 <munmap>:
+SYSCALL(munmap)
+     659:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     65e:	89 e1                	mov    %esp,%ecx
+     660:	ba 67 06 00 00       	mov    $0x667,%edx
+     665:	0f 34                	sysenter
+     667:	c3                   	ret
+
+00000668 <ringenter>:
+SYSCALL(ringenter)
+     668:	b8 20 00 00 00       	mov    $0x20,%eax
+     66d:	89 e1                	mov    %esp,%ecx
+     66f:	ba 76 06 00 00       	mov    $0x676,%edx
+     674:	0f 34                	sysenter
+     676:	c3                   	ret
+
+00000677 <readv>:
+SYSCALL(readv)
+     677:	b8 21 00 00 00       	mov    $0x21,%eax
+     67c:	89 e1                	mov    %esp,%ecx
+     67e:	ba 85 06 00 00       	mov    $0x685,%edx
+     683:	0f 34                	sysenter
+     685:	c3                   	ret
+
+00000686 <writev>:
+SYSCALL(writev)
+     686:	b8 22 00 00 00       	mov    $0x22,%eax
+     68b:	89 e1                	mov    %esp,%ecx
+     68d:	ba 94 06 00 00       	mov    $0x694,%edx
+     692:	0f 34                	sysenter
+     694:	c3                   	ret
+
+00000695 <pread>:
+SYSCALL(pread)
+     695:	b8 23 00 00 00       	mov    $0x23,%eax
+     69a:	89 e1                	mov    %esp,%ecx
+     69c:	ba a3 06 00 00       	mov    $0x6a3,%edx
+     6a1:	0f 34                	sysenter
+     6a3:	c3                   	ret
+
+000006a4 <pwrite>:
+SYSCALL(pwrite)
+     6a4:	b8 24 00 00 00       	mov    $0x24,%eax
+     6a9:	89 e1                	mov    %esp,%ecx
+     6ab:	ba b2 06 00 00       	mov    $0x6b2,%edx
+     6b0:	0f 34                	sysenter
+     6b2:	c3                   	ret
+
+000006b3 <prof>:
+SYSCALL(prof)
+     6b3:	b8 25 00 00 00       	mov    $0x25,%eax
+     6b8:	89 e1                	mov    %esp,%ecx
+     6ba:	ba c1 06 00 00       	mov    $0x6c1,%edx
+     6bf:	0f 34                	sysenter
+     6c1:	c3                   	ret
+
+000006c2 <scstat>:
+SYSCALL(scstat)
+     6c2:	b8 26 00 00 00       	mov    $0x26,%eax
+     6c7:	89 e1                	mov    %esp,%ecx
+     6c9:	ba d0 06 00 00       	mov    $0x6d0,%edx
+     6ce:	0f 34                	sysenter
+     6d0:	c3                   	ret
+     6d1:	66 90                	xchg   %ax,%ax
+     6d3:	66 90                	xchg   %ax,%ax
+     6d5:	66 90                	xchg   %ax,%ax
+     6d7:	66 90                	xchg   %ax,%ax
+     6d9:	66 90                	xchg   %ax,%ax
+     6db:	66 90                	xchg   %ax,%ax
+     6dd:	66 90                	xchg   %ax,%ax
+     6df:	90                   	nop
+
+000006e0 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+     6e0:	55                   	push   %ebp
+     6e1:	89 e5                	mov    %esp,%ebp
+     6e3:	57                   	push   %edi
+     6e4:	56                   	push   %esi
+     6e5:	53                   	push   %ebx
+     6e6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     6e8:	89 d1                	mov    %edx,%ecx
+{
+     6ea:	83 ec 2c             	sub    $0x2c,%esp
+     6ed:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+     6f0:	85 d2                	test   %edx,%edx
+     6f2:	79 7c                	jns    770 <printint+0x90>
+     6f4:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     6f8:	74 76                	je     770 <printint+0x90>
+    x = -xx;
+     6fa:	f7 d9                	neg    %ecx
+    neg = 1;
+     6fc:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     701:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     704:	31 f6                	xor    %esi,%esi
+     706:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     70d:	8d 76 00             	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     710:	89 c8                	mov    %ecx,%eax
+     712:	31 d2                	xor    %edx,%edx
+     714:	89 f7                	mov    %esi,%edi
+     716:	f7 f3                	div    %ebx
+     718:	8d 76 01             	lea    0x1(%esi),%esi
+     71b:	0f b6 92 50 1e 00 00 	movzbl 0x1e50(%edx),%edx
+     722:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     726:	89 ca                	mov    %ecx,%edx
+     728:	89 c1                	mov    %eax,%ecx
+     72a:	39 da                	cmp    %ebx,%edx
+     72c:	73 e2                	jae    710 <printint+0x30>
+  if(neg)
+     72e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     731:	85 c0                	test   %eax,%eax
+     733:	74 07                	je     73c <printint+0x5c>
+    buf[i++] = '-';
+     735:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     73a:	89 f7                	mov    %esi,%edi
+     73c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     73f:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     742:	01 df                	add    %ebx,%edi
+     744:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc_unlocked(buf[i], f);
+     748:	83 ec 08             	sub    $0x8,%esp
+     74b:	56                   	push   %esi
+     74c:	0f be 07             	movsbl (%edi),%eax
+     74f:	50                   	push   %eax
+     750:	e8 cb 07 00 00       	call   f20 <putc_unlocked>
+  while(--i >= 0)
+     755:	89 f8                	mov    %edi,%eax
+     757:	83 c4 10             	add    $0x10,%esp
+     75a:	83 ef 01             	sub    $0x1,%edi
+     75d:	39 d8                	cmp    %ebx,%eax
+     75f:	75 e7                	jne    748 <printint+0x68>
+}
+     761:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     764:	5b                   	pop    %ebx
+     765:	5e                   	pop    %esi
+     766:	5f                   	pop    %edi
+     767:	5d                   	pop    %ebp
+     768:	c3                   	ret
+     769:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     770:	31 c0                	xor    %eax,%eax
+     772:	eb 8d                	jmp    701 <printint+0x21>
+     774:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     77b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     77f:	90                   	nop
+
+00000780 <vfprintf>:
+
+// Print to the given stream, which the caller has locked.
+// Only understands %d, %x, %p, %s.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+     780:	55                   	push   %ebp
+     781:	89 e5                	mov    %esp,%ebp
+     783:	57                   	push   %edi
+     784:	56                   	push   %esi
+     785:	53                   	push   %ebx
+     786:	83 ec 1c             	sub    $0x1c,%esp
+     789:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     78c:	0f b6 0a             	movzbl (%edx),%ecx
+     78f:	84 c9                	test   %cl,%cl
+     791:	74 5c                	je     7ef <vfprintf+0x6f>
+     793:	89 c6                	mov    %eax,%esi
+     795:	8d 5a 01             	lea    0x1(%edx),%ebx
+     798:	31 ff                	xor    %edi,%edi
+     79a:	eb 20                	jmp    7bc <vfprintf+0x3c>
+     79c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     7a0:	83 f9 25             	cmp    $0x25,%ecx
+     7a3:	74 3b                	je     7e0 <vfprintf+0x60>
+        state = '%';
+      } else {
+        putc_unlocked(c, f);
+     7a5:	83 ec 08             	sub    $0x8,%esp
+     7a8:	56                   	push   %esi
+     7a9:	51                   	push   %ecx
+     7aa:	e8 71 07 00 00       	call   f20 <putc_unlocked>
+     7af:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     7b2:	0f b6 0b             	movzbl (%ebx),%ecx
+     7b5:	83 c3 01             	add    $0x1,%ebx
+     7b8:	84 c9                	test   %cl,%cl
+     7ba:	74 33                	je     7ef <vfprintf+0x6f>
+    if(state == 0){
+     7bc:	85 ff                	test   %edi,%edi
+     7be:	74 e0                	je     7a0 <vfprintf+0x20>
+      }
+    } else if(state == '%'){
+     7c0:	83 ff 25             	cmp    $0x25,%edi
+     7c3:	75 ed                	jne    7b2 <vfprintf+0x32>
+      if(c == 'd'){
+     7c5:	83 f9 25             	cmp    $0x25,%ecx
+     7c8:	0f 84 02 01 00 00    	je     8d0 <vfprintf+0x150>
+     7ce:	8d 41 9d             	lea    -0x63(%ecx),%eax
+     7d1:	83 f8 15             	cmp    $0x15,%eax
+     7d4:	77 2a                	ja     800 <vfprintf+0x80>
+     7d6:	ff 24 85 f8 1d 00 00 	jmp    *0x1df8(,%eax,4)
+     7dd:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     7e0:	0f b6 0b             	movzbl (%ebx),%ecx
+     7e3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     7e6:	bf 25 00 00 00       	mov    $0x25,%edi
+  for(i = 0; fmt[i]; i++){
+     7eb:	84 c9                	test   %cl,%cl
+     7ed:	75 cd                	jne    7bc <vfprintf+0x3c>
+        putc_unlocked(c, f);
+      }
+      state = 0;
+    }
+  }
+}
+     7ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     7f2:	5b                   	pop    %ebx
+     7f3:	5e                   	pop    %esi
+     7f4:	5f                   	pop    %edi
+     7f5:	5d                   	pop    %ebp
+     7f6:	c3                   	ret
+     7f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7fe:	66 90                	xchg   %ax,%ax
+        putc_unlocked('%', f);
+     800:	83 ec 08             	sub    $0x8,%esp
+     803:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     806:	56                   	push   %esi
+     807:	6a 25                	push   $0x25
+     809:	e8 12 07 00 00       	call   f20 <putc_unlocked>
+        putc_unlocked(c, f);
+     80e:	58                   	pop    %eax
+     80f:	5a                   	pop    %edx
+     810:	56                   	push   %esi
+     811:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     814:	51                   	push   %ecx
+     815:	e8 06 07 00 00       	call   f20 <putc_unlocked>
+     81a:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     81d:	31 ff                	xor    %edi,%edi
+     81f:	eb 91                	jmp    7b2 <vfprintf+0x32>
+     821:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+     828:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     82b:	83 ec 0c             	sub    $0xc,%esp
+     82e:	b9 10 00 00 00       	mov    $0x10,%ecx
+     833:	8b 17                	mov    (%edi),%edx
+     835:	6a 00                	push   $0x0
+        ap++;
+     837:	83 c7 04             	add    $0x4,%edi
+        printint(f, *ap, 16, 0);
+     83a:	89 f0                	mov    %esi,%eax
+     83c:	e8 9f fe ff ff       	call   6e0 <printint>
+        ap++;
+     841:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     844:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     847:	31 ff                	xor    %edi,%edi
+     849:	e9 64 ff ff ff       	jmp    7b2 <vfprintf+0x32>
+     84e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     850:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     853:	8b 10                	mov    (%eax),%edx
+        ap++;
+     855:	83 c0 04             	add    $0x4,%eax
+     858:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     85b:	85 d2                	test   %edx,%edx
+     85d:	0f 84 85 00 00 00    	je     8e8 <vfprintf+0x168>
+        while(*s != 0){
+     863:	0f be 02             	movsbl (%edx),%eax
+        s = (char*)*ap;
+     866:	89 d7                	mov    %edx,%edi
+        while(*s != 0){
+     868:	84 c0                	test   %al,%al
+     86a:	74 b1                	je     81d <vfprintf+0x9d>
+     86c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+          putc_unlocked(*s, f);
+     870:	83 ec 08             	sub    $0x8,%esp
+          s++;
+     873:	83 c7 01             	add    $0x1,%edi
+          putc_unlocked(*s, f);
+     876:	56                   	push   %esi
+     877:	50                   	push   %eax
+     878:	e8 a3 06 00 00       	call   f20 <putc_unlocked>
+        while(*s != 0){
+     87d:	0f be 07             	movsbl (%edi),%eax
+     880:	83 c4 10             	add    $0x10,%esp
+     883:	84 c0                	test   %al,%al
+     885:	75 e9                	jne    870 <vfprintf+0xf0>
+      state = 0;
+     887:	31 ff                	xor    %edi,%edi
+     889:	e9 24 ff ff ff       	jmp    7b2 <vfprintf+0x32>
+     88e:	66 90                	xchg   %ax,%ax
+        printint(f, *ap, 10, 1);
+     890:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     893:	83 ec 0c             	sub    $0xc,%esp
+     896:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     89b:	8b 17                	mov    (%edi),%edx
+     89d:	6a 01                	push   $0x1
+     89f:	eb 96                	jmp    837 <vfprintf+0xb7>
+     8a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc_unlocked(*ap, f);
+     8a8:	83 ec 08             	sub    $0x8,%esp
+     8ab:	56                   	push   %esi
+     8ac:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     8af:	ff 37                	push   (%edi)
+     8b1:	e8 6a 06 00 00       	call   f20 <putc_unlocked>
+        ap++;
+     8b6:	89 f8                	mov    %edi,%eax
+     8b8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     8bb:	31 ff                	xor    %edi,%edi
+        ap++;
+     8bd:	83 c0 04             	add    $0x4,%eax
+     8c0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     8c3:	e9 ea fe ff ff       	jmp    7b2 <vfprintf+0x32>
+     8c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8cf:	90                   	nop
+        putc_unlocked(c, f);
+     8d0:	83 ec 08             	sub    $0x8,%esp
+      state = 0;
+     8d3:	31 ff                	xor    %edi,%edi
+        putc_unlocked(c, f);
+     8d5:	56                   	push   %esi
+     8d6:	6a 25                	push   $0x25
+     8d8:	e8 43 06 00 00       	call   f20 <putc_unlocked>
+     8dd:	83 c4 10             	add    $0x10,%esp
+     8e0:	e9 cd fe ff ff       	jmp    7b2 <vfprintf+0x32>
+     8e5:	8d 76 00             	lea    0x0(%esi),%esi
+     8e8:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     8ed:	bf f0 1d 00 00       	mov    $0x1df0,%edi
+     8f2:	e9 79 ff ff ff       	jmp    870 <vfprintf+0xf0>
+     8f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8fe:	66 90                	xchg   %ax,%ax
+
+00000900 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+     900:	55                   	push   %ebp
+     901:	89 e5                	mov    %esp,%ebp
+     903:	53                   	push   %ebx
+     904:	83 ec 10             	sub    $0x10,%esp
+     907:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  flockfile(f);
+     90a:	53                   	push   %ebx
+     90b:	e8 d0 02 00 00       	call   be0 <flockfile>
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     910:	8b 55 0c             	mov    0xc(%ebp),%edx
+     913:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     916:	89 d8                	mov    %ebx,%eax
+     918:	e8 63 fe ff ff       	call   780 <vfprintf>
+  funlockfile(f);
+     91d:	89 1c 24             	mov    %ebx,(%esp)
+     920:	e8 eb 02 00 00       	call   c10 <funlockfile>
+}
+     925:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     928:	83 c4 10             	add    $0x10,%esp
+     92b:	c9                   	leave
+     92c:	c3                   	ret
+     92d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000930 <printf>:
+
+// Print to the given fd: through stdout or stderr for 1 and 2,
+// otherwise with one write() per call.
+void
+printf(int fd, const char *fmt, ...)
+{
+     930:	55                   	push   %ebp
+     931:	89 e5                	mov    %esp,%ebp
+     933:	56                   	push   %esi
+     934:	53                   	push   %ebx
+     935:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+     93b:	8b 45 08             	mov    0x8(%ebp),%eax
+  char buf[128];
+  struct iobuf f;
+
+  if(fd == 1 || fd == 2){
+    flockfile(&_iob[fd]);
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     93e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(fd == 1 || fd == 2){
+     941:	8d 50 ff             	lea    -0x1(%eax),%edx
+     944:	83 fa 01             	cmp    $0x1,%edx
+     947:	76 77                	jbe    9c0 <printf+0x90>
+    funlockfile(&_iob[fd]);
+    return;
+  }
+  f.fd = fd;
+     949:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  f.flags = IO_WRITE|IO_SETUP;
+  f.buf = buf;
+     94f:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  f.size = sizeof(buf);
+  f.r = f.n = 0;
+  mutex_init(&f.lock);
+     955:	83 ec 0c             	sub    $0xc,%esp
+     958:	8d 9d 5c ff ff ff    	lea    -0xa4(%ebp),%ebx
+  f.buf = buf;
+     95e:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+  mutex_init(&f.lock);
+     964:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  f.flags = IO_WRITE|IO_SETUP;
+     96a:	c7 85 60 ff ff ff 42 	movl   $0x42,-0xa0(%ebp)
+     971:	00 00 00 
+  f.size = sizeof(buf);
+     974:	c7 85 68 ff ff ff 80 	movl   $0x80,-0x98(%ebp)
+     97b:	00 00 00 
+  f.r = f.n = 0;
+     97e:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+     985:	00 00 00 
+     988:	c7 85 6c ff ff ff 00 	movl   $0x0,-0x94(%ebp)
+     98f:	00 00 00 
+  mutex_init(&f.lock);
+     992:	50                   	push   %eax
+     993:	e8 d8 f9 ff ff       	call   370 <mutex_init>
+  vfprintf(&f, fmt, (uint*)(void*)&fmt + 1);
+     998:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     99b:	89 f2                	mov    %esi,%edx
+     99d:	89 d8                	mov    %ebx,%eax
+     99f:	e8 dc fd ff ff       	call   780 <vfprintf>
+  fflush(&f);
+     9a4:	89 1c 24             	mov    %ebx,(%esp)
+     9a7:	e8 f4 04 00 00       	call   ea0 <fflush>
+     9ac:	83 c4 10             	add    $0x10,%esp
+}
+     9af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     9b2:	5b                   	pop    %ebx
+     9b3:	5e                   	pop    %esi
+     9b4:	5d                   	pop    %ebp
+     9b5:	c3                   	ret
+     9b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9bd:	8d 76 00             	lea    0x0(%esi),%esi
+    flockfile(&_iob[fd]);
+     9c0:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     9c3:	83 ec 0c             	sub    $0xc,%esp
+     9c6:	8d 98 00 28 00 00    	lea    0x2800(%eax),%ebx
+     9cc:	53                   	push   %ebx
+     9cd:	e8 0e 02 00 00       	call   be0 <flockfile>
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     9d2:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     9d5:	89 f2                	mov    %esi,%edx
+     9d7:	89 d8                	mov    %ebx,%eax
+     9d9:	e8 a2 fd ff ff       	call   780 <vfprintf>
+    funlockfile(&_iob[fd]);
+     9de:	89 1c 24             	mov    %ebx,(%esp)
+     9e1:	e8 2a 02 00 00       	call   c10 <funlockfile>
+     9e6:	83 c4 10             	add    $0x10,%esp
+}
+     9e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     9ec:	5b                   	pop    %ebx
+     9ed:	5e                   	pop    %esi
+     9ee:	5d                   	pop    %ebp
+     9ef:	c3                   	ret
+
+000009f0 <setup>:
+}
+
+// Choose how to buffer f on first use: by lines on a device.
+static void
+setup(FILE *f)
+{
+     9f0:	55                   	push   %ebp
+     9f1:	89 e5                	mov    %esp,%ebp
+     9f3:	53                   	push   %ebx
+     9f4:	89 c3                	mov    %eax,%ebx
+     9f6:	83 ec 2c             	sub    $0x2c,%esp
+  struct stat st;
+
+  f->flags |= IO_SETUP;
+     9f9:	83 48 04 40          	orl    $0x40,0x4(%eax)
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     9fd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     a00:	50                   	push   %eax
+     a01:	ff 33                	push   (%ebx)
+     a03:	e8 52 fb ff ff       	call   55a <fstat>
+     a08:	83 c4 10             	add    $0x10,%esp
+     a0b:	85 c0                	test   %eax,%eax
+    f->flags |= IO_DEV|IO_LINE;
+     a0d:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     a10:	75 07                	jne    a19 <setup+0x29>
+     a12:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+     a17:	74 17                	je     a30 <setup+0x40>
+  if(f->flags & IO_WRITE)
+     a19:	a8 02                	test   $0x2,%al
+     a1b:	74 0a                	je     a27 <setup+0x37>
+    flushhook = flushall;
+     a1d:	c7 05 e0 2a 00 00 50 	movl   $0xb50,0x2ae0
+     a24:	0b 00 00 
+}
+     a27:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a2a:	c9                   	leave
+     a2b:	c3                   	ret
+     a2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    f->flags |= IO_DEV|IO_LINE;
+     a30:	83 c8 30             	or     $0x30,%eax
+     a33:	89 43 04             	mov    %eax,0x4(%ebx)
+     a36:	eb e1                	jmp    a19 <setup+0x29>
+     a38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a3f:	90                   	nop
+
+00000a40 <flush>:
+static int
+flush(FILE *f)
+{
+  int i, n;
+
+  if(!(f->flags & IO_WRITE))
+     a40:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+     a44:	74 6a                	je     ab0 <flush+0x70>
+{
+     a46:	55                   	push   %ebp
+     a47:	89 e5                	mov    %esp,%ebp
+     a49:	56                   	push   %esi
+     a4a:	89 c6                	mov    %eax,%esi
+     a4c:	53                   	push   %ebx
+    return 0;
+  for(i = 0; i < f->n; i += n){
+     a4d:	8b 40 14             	mov    0x14(%eax),%eax
+     a50:	85 c0                	test   %eax,%eax
+     a52:	7e 4c                	jle    aa0 <flush+0x60>
+     a54:	31 db                	xor    %ebx,%ebx
+     a56:	eb 11                	jmp    a69 <flush+0x29>
+     a58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a5f:	90                   	nop
+     a60:	01 c3                	add    %eax,%ebx
+     a62:	8b 46 14             	mov    0x14(%esi),%eax
+     a65:	39 d8                	cmp    %ebx,%eax
+     a67:	7e 37                	jle    aa0 <flush+0x60>
+    if((n = write(f->fd, f->buf + i, f->n - i)) <= 0){
+     a69:	83 ec 04             	sub    $0x4,%esp
+     a6c:	29 d8                	sub    %ebx,%eax
+     a6e:	50                   	push   %eax
+     a6f:	8b 46 08             	mov    0x8(%esi),%eax
+     a72:	01 d8                	add    %ebx,%eax
+     a74:	50                   	push   %eax
+     a75:	ff 36                	push   (%esi)
+     a77:	e8 75 fa ff ff       	call   4f1 <write>
+     a7c:	83 c4 10             	add    $0x10,%esp
+     a7f:	85 c0                	test   %eax,%eax
+     a81:	7f dd                	jg     a60 <flush+0x20>
+      f->flags |= IO_ERR;
+     a83:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+      f->n = 0;
+     a87:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     a8c:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+      return EOF;
+    }
+  }
+  f->n = 0;
+  return 0;
+}
+     a93:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     a96:	5b                   	pop    %ebx
+     a97:	5e                   	pop    %esi
+     a98:	5d                   	pop    %ebp
+     a99:	c3                   	ret
+     a9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->n = 0;
+     aa0:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+}
+     aa7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+     aaa:	31 c0                	xor    %eax,%eax
+}
+     aac:	5b                   	pop    %ebx
+     aad:	5e                   	pop    %esi
+     aae:	5d                   	pop    %ebp
+     aaf:	c3                   	ret
+    return 0;
+     ab0:	31 c0                	xor    %eax,%eax
+}
+     ab2:	c3                   	ret
+     ab3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ac0 <fflush.part.0>:
+fflush(FILE *f)
+     ac0:	55                   	push   %ebp
+     ac1:	89 e5                	mov    %esp,%ebp
+     ac3:	57                   	push   %edi
+     ac4:	bf f8 28 00 00       	mov    $0x28f8,%edi
+     ac9:	56                   	push   %esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     aca:	31 f6                	xor    %esi,%esi
+fflush(FILE *f)
+     acc:	53                   	push   %ebx
+     acd:	bb 18 28 00 00       	mov    $0x2818,%ebx
+     ad2:	83 ec 1c             	sub    $0x1c,%esp
+     ad5:	eb 10                	jmp    ae7 <fflush.part.0+0x27>
+     ad7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ade:	66 90                	xchg   %ax,%ax
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     ae0:	83 c3 1c             	add    $0x1c,%ebx
+     ae3:	39 df                	cmp    %ebx,%edi
+     ae5:	74 33                	je     b1a <fflush.part.0+0x5a>
+      if((f->flags & IO_WRITE) && fflush(f) < 0)
+     ae7:	f6 43 ec 02          	testb  $0x2,-0x14(%ebx)
+     aeb:	74 f3                	je     ae0 <fflush.part.0+0x20>
+  if(threaded)
+     aed:	8b 0d 00 2b 00 00    	mov    0x2b00,%ecx
+     af3:	85 c9                	test   %ecx,%ecx
+     af5:	75 49                	jne    b40 <fflush.part.0+0x80>
+  r = flush(f);
+     af7:	8d 43 e8             	lea    -0x18(%ebx),%eax
+     afa:	e8 41 ff ff ff       	call   a40 <flush>
+  if(threaded)
+     aff:	8b 15 00 2b 00 00    	mov    0x2b00,%edx
+     b05:	85 d2                	test   %edx,%edx
+     b07:	75 1f                	jne    b28 <fflush.part.0+0x68>
+        r = EOF;
+     b09:	85 c0                	test   %eax,%eax
+     b0b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     b10:	0f 48 f0             	cmovs  %eax,%esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     b13:	83 c3 1c             	add    $0x1c,%ebx
+     b16:	39 df                	cmp    %ebx,%edi
+     b18:	75 cd                	jne    ae7 <fflush.part.0+0x27>
+}
+     b1a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b1d:	89 f0                	mov    %esi,%eax
+     b1f:	5b                   	pop    %ebx
+     b20:	5e                   	pop    %esi
+     b21:	5f                   	pop    %edi
+     b22:	5d                   	pop    %ebp
+     b23:	c3                   	ret
+     b24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     b28:	83 ec 0c             	sub    $0xc,%esp
+     b2b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     b2e:	53                   	push   %ebx
+     b2f:	e8 9c f8 ff ff       	call   3d0 <mutex_unlock>
+     b34:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     b37:	83 c4 10             	add    $0x10,%esp
+     b3a:	eb cd                	jmp    b09 <fflush.part.0+0x49>
+     b3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     b40:	83 ec 0c             	sub    $0xc,%esp
+     b43:	53                   	push   %ebx
+     b44:	e8 37 f8 ff ff       	call   380 <mutex_lock>
+     b49:	83 c4 10             	add    $0x10,%esp
+     b4c:	eb a9                	jmp    af7 <fflush.part.0+0x37>
+     b4e:	66 90                	xchg   %ax,%ax
+
+00000b50 <flushall>:
+  if(f == 0){
+     b50:	e9 6b ff ff ff       	jmp    ac0 <fflush.part.0>
+     b55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b60 <fill>:
+
+// Refill f's buffer. Returns the number of bytes read.
+// Caller holds f's lock.
+static int
+fill(FILE *f)
+{
+     b60:	55                   	push   %ebp
+     b61:	89 e5                	mov    %esp,%ebp
+     b63:	53                   	push   %ebx
+     b64:	89 c3                	mov    %eax,%ebx
+     b66:	83 ec 04             	sub    $0x4,%esp
+  int n;
+
+  if(!(f->flags & IO_SETUP))
+     b69:	8b 40 04             	mov    0x4(%eax),%eax
+     b6c:	a8 40                	test   $0x40,%al
+     b6e:	74 50                	je     bc0 <fill+0x60>
+    setup(f);
+  if(f->flags & IO_DEV)
+     b70:	a8 20                	test   $0x20,%al
+     b72:	75 3c                	jne    bb0 <fill+0x50>
+    fflush(0);
+  f->r = 0;
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     b74:	83 ec 04             	sub    $0x4,%esp
+  f->r = 0;
+     b77:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     b7e:	ff 73 0c             	push   0xc(%ebx)
+     b81:	ff 73 08             	push   0x8(%ebx)
+     b84:	ff 33                	push   (%ebx)
+     b86:	e8 57 f9 ff ff       	call   4e2 <read>
+     b8b:	83 c4 10             	add    $0x10,%esp
+     b8e:	85 c0                	test   %eax,%eax
+     b90:	7f 10                	jg     ba2 <fill+0x42>
+    f->flags |= n < 0 ? IO_ERR : IO_EOF;
+     b92:	83 f8 01             	cmp    $0x1,%eax
+     b95:	19 c0                	sbb    %eax,%eax
+     b97:	83 e0 fc             	and    $0xfffffffc,%eax
+     b9a:	83 c0 08             	add    $0x8,%eax
+     b9d:	09 43 04             	or     %eax,0x4(%ebx)
+    n = 0;
+     ba0:	31 c0                	xor    %eax,%eax
+  }
+  f->n = n;
+     ba2:	89 43 14             	mov    %eax,0x14(%ebx)
+  return n;
+}
+     ba5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ba8:	c9                   	leave
+     ba9:	c3                   	ret
+     baa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == 0){
+     bb0:	e8 0b ff ff ff       	call   ac0 <fflush.part.0>
+     bb5:	eb bd                	jmp    b74 <fill+0x14>
+     bb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bbe:	66 90                	xchg   %ax,%ax
+    setup(f);
+     bc0:	89 d8                	mov    %ebx,%eax
+     bc2:	e8 29 fe ff ff       	call   9f0 <setup>
+  if(f->flags & IO_DEV)
+     bc7:	8b 43 04             	mov    0x4(%ebx),%eax
+     bca:	eb a4                	jmp    b70 <fill+0x10>
+     bcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000bd0 <stdio_threaded>:
+  threaded = 1;
+     bd0:	c7 05 00 2b 00 00 01 	movl   $0x1,0x2b00
+     bd7:	00 00 00 
+}
+     bda:	c3                   	ret
+     bdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bdf:	90                   	nop
+
+00000be0 <flockfile>:
+{
+     be0:	55                   	push   %ebp
+  if(threaded)
+     be1:	8b 15 00 2b 00 00    	mov    0x2b00,%edx
+{
+     be7:	89 e5                	mov    %esp,%ebp
+     be9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     bec:	85 d2                	test   %edx,%edx
+     bee:	75 08                	jne    bf8 <flockfile+0x18>
+}
+     bf0:	5d                   	pop    %ebp
+     bf1:	c3                   	ret
+     bf2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_lock(&f->lock);
+     bf8:	83 c0 18             	add    $0x18,%eax
+     bfb:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     bfe:	5d                   	pop    %ebp
+    mutex_lock(&f->lock);
+     bff:	e9 7c f7 ff ff       	jmp    380 <mutex_lock>
+     c04:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c0f:	90                   	nop
+
+00000c10 <funlockfile>:
+{
+     c10:	55                   	push   %ebp
+  if(threaded)
+     c11:	8b 15 00 2b 00 00    	mov    0x2b00,%edx
+{
+     c17:	89 e5                	mov    %esp,%ebp
+     c19:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     c1c:	85 d2                	test   %edx,%edx
+     c1e:	75 08                	jne    c28 <funlockfile+0x18>
+}
+     c20:	5d                   	pop    %ebp
+     c21:	c3                   	ret
+     c22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&f->lock);
+     c28:	83 c0 18             	add    $0x18,%eax
+     c2b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     c2e:	5d                   	pop    %ebp
+    mutex_unlock(&f->lock);
+     c2f:	e9 9c f7 ff ff       	jmp    3d0 <mutex_unlock>
+     c34:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c3f:	90                   	nop
+
+00000c40 <fopen>:
+{
+     c40:	55                   	push   %ebp
+     c41:	89 e5                	mov    %esp,%ebp
+     c43:	57                   	push   %edi
+     c44:	56                   	push   %esi
+     c45:	53                   	push   %ebx
+     c46:	83 ec 34             	sub    $0x34,%esp
+     c49:	8b 75 0c             	mov    0xc(%ebp),%esi
+     c4c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(strcmp(mode, "r") != 0 && strcmp(mode, "w") != 0)
+     c4f:	68 61 1e 00 00       	push   $0x1e61
+     c54:	56                   	push   %esi
+     c55:	e8 66 f5 ff ff       	call   1c0 <strcmp>
+     c5a:	83 c4 10             	add    $0x10,%esp
+     c5d:	85 c0                	test   %eax,%eax
+     c5f:	74 15                	je     c76 <fopen+0x36>
+     c61:	83 ec 08             	sub    $0x8,%esp
+     c64:	68 63 1e 00 00       	push   $0x1e63
+     c69:	56                   	push   %esi
+     c6a:	e8 51 f5 ff ff       	call   1c0 <strcmp>
+     c6f:	83 c4 10             	add    $0x10,%esp
+     c72:	85 c0                	test   %eax,%eax
+     c74:	75 2c                	jne    ca2 <fopen+0x62>
+  if(threaded)
+     c76:	a1 00 2b 00 00       	mov    0x2b00,%eax
+     c7b:	85 c0                	test   %eax,%eax
+     c7d:	0f 85 ed 00 00 00    	jne    d70 <fopen+0x130>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     c83:	bb 54 28 00 00       	mov    $0x2854,%ebx
+    if(f->flags == 0)
+     c88:	8b 53 04             	mov    0x4(%ebx),%edx
+     c8b:	85 d2                	test   %edx,%edx
+     c8d:	74 21                	je     cb0 <fopen+0x70>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     c8f:	83 c3 1c             	add    $0x1c,%ebx
+     c92:	81 fb e0 28 00 00    	cmp    $0x28e0,%ebx
+     c98:	75 ee                	jne    c88 <fopen+0x48>
+  if(threaded)
+     c9a:	85 c0                	test   %eax,%eax
+     c9c:	0f 85 36 01 00 00    	jne    dd8 <fopen+0x198>
+    return 0;
+     ca2:	31 db                	xor    %ebx,%ebx
+     ca4:	e9 96 00 00 00       	jmp    d3f <fopen+0xff>
+     ca9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f == &_iob[NSTREAM])
+     cb0:	81 fb e0 28 00 00    	cmp    $0x28e0,%ebx
+     cb6:	74 e2                	je     c9a <fopen+0x5a>
+    f->flags = IO_MALLOC;
+     cb8:	c7 43 04 80 00 00 00 	movl   $0x80,0x4(%ebx)
+  if(threaded)
+     cbf:	85 c0                	test   %eax,%eax
+     cc1:	0f 85 f9 00 00 00    	jne    dc0 <fopen+0x180>
+  if(mode[0] == 'r'){
+     cc7:	80 3e 72             	cmpb   $0x72,(%esi)
+     cca:	0f 84 c0 00 00 00    	je     d90 <fopen+0x150>
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     cd0:	83 ec 08             	sub    $0x8,%esp
+     cd3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     cd6:	50                   	push   %eax
+     cd7:	57                   	push   %edi
+     cd8:	e8 d3 f5 ff ff       	call   2b0 <stat>
+     cdd:	83 c4 10             	add    $0x10,%esp
+     ce0:	85 c0                	test   %eax,%eax
+     ce2:	74 6c                	je     d50 <fopen+0x110>
+    fd = open(path, O_CREATE|O_WRONLY);
+     ce4:	83 ec 08             	sub    $0x8,%esp
+     ce7:	68 01 02 00 00       	push   $0x201
+     cec:	57                   	push   %edi
+    flags = IO_WRITE;
+     ced:	bf 02 00 00 00       	mov    $0x2,%edi
+    fd = open(path, O_CREATE|O_WRONLY);
+     cf2:	e8 36 f8 ff ff       	call   52d <open>
+     cf7:	83 c4 10             	add    $0x10,%esp
+     cfa:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     cfc:	85 f6                	test   %esi,%esi
+     cfe:	0f 88 a9 00 00 00    	js     dad <fopen+0x16d>
+     d04:	83 ec 0c             	sub    $0xc,%esp
+     d07:	68 00 02 00 00       	push   $0x200
+     d0c:	e8 af 0c 00 00       	call   19c0 <malloc>
+     d11:	83 c4 10             	add    $0x10,%esp
+     d14:	89 43 08             	mov    %eax,0x8(%ebx)
+     d17:	85 c0                	test   %eax,%eax
+     d19:	0f 84 d0 00 00 00    	je     def <fopen+0x1af>
+  f->flags = flags|IO_MALLOC;
+     d1f:	81 cf 80 00 00 00    	or     $0x80,%edi
+  f->fd = fd;
+     d25:	89 33                	mov    %esi,(%ebx)
+  f->size = BUFSIZ;
+     d27:	c7 43 0c 00 02 00 00 	movl   $0x200,0xc(%ebx)
+  f->r = f->n = 0;
+     d2e:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+     d35:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  f->flags = flags|IO_MALLOC;
+     d3c:	89 7b 04             	mov    %edi,0x4(%ebx)
+}
+     d3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d42:	89 d8                	mov    %ebx,%eax
+     d44:	5b                   	pop    %ebx
+     d45:	5e                   	pop    %esi
+     d46:	5f                   	pop    %edi
+     d47:	5d                   	pop    %ebp
+     d48:	c3                   	ret
+     d49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     d50:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+     d55:	75 8d                	jne    ce4 <fopen+0xa4>
+      unlink(path);
+     d57:	83 ec 0c             	sub    $0xc,%esp
+     d5a:	57                   	push   %edi
+     d5b:	e8 eb f7 ff ff       	call   54b <unlink>
+     d60:	83 c4 10             	add    $0x10,%esp
+     d63:	e9 7c ff ff ff       	jmp    ce4 <fopen+0xa4>
+     d68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d6f:	90                   	nop
+    mutex_lock(&iolock);
+     d70:	83 ec 0c             	sub    $0xc,%esp
+     d73:	68 04 2b 00 00       	push   $0x2b04
+     d78:	e8 03 f6 ff ff       	call   380 <mutex_lock>
+  if(threaded)
+     d7d:	a1 00 2b 00 00       	mov    0x2b00,%eax
+     d82:	83 c4 10             	add    $0x10,%esp
+     d85:	e9 f9 fe ff ff       	jmp    c83 <fopen+0x43>
+     d8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    fd = open(path, O_RDONLY);
+     d90:	83 ec 08             	sub    $0x8,%esp
+     d93:	6a 00                	push   $0x0
+     d95:	57                   	push   %edi
+    flags = IO_READ;
+     d96:	bf 01 00 00 00       	mov    $0x1,%edi
+    fd = open(path, O_RDONLY);
+     d9b:	e8 8d f7 ff ff       	call   52d <open>
+     da0:	83 c4 10             	add    $0x10,%esp
+     da3:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     da5:	85 f6                	test   %esi,%esi
+     da7:	0f 89 57 ff ff ff    	jns    d04 <fopen+0xc4>
+    f->flags = 0;
+     dad:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    return 0;
+     db4:	31 db                	xor    %ebx,%ebx
+     db6:	eb 87                	jmp    d3f <fopen+0xff>
+     db8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dbf:	90                   	nop
+    mutex_unlock(&iolock);
+     dc0:	83 ec 0c             	sub    $0xc,%esp
+     dc3:	68 04 2b 00 00       	push   $0x2b04
+     dc8:	e8 03 f6 ff ff       	call   3d0 <mutex_unlock>
+     dcd:	83 c4 10             	add    $0x10,%esp
+     dd0:	e9 f2 fe ff ff       	jmp    cc7 <fopen+0x87>
+     dd5:	8d 76 00             	lea    0x0(%esi),%esi
+     dd8:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+     ddb:	31 db                	xor    %ebx,%ebx
+    mutex_unlock(&iolock);
+     ddd:	68 04 2b 00 00       	push   $0x2b04
+     de2:	e8 e9 f5 ff ff       	call   3d0 <mutex_unlock>
+     de7:	83 c4 10             	add    $0x10,%esp
+     dea:	e9 50 ff ff ff       	jmp    d3f <fopen+0xff>
+      close(fd);
+     def:	83 ec 0c             	sub    $0xc,%esp
+     df2:	56                   	push   %esi
+     df3:	e8 08 f7 ff ff       	call   500 <close>
+     df8:	83 c4 10             	add    $0x10,%esp
+     dfb:	eb b0                	jmp    dad <fopen+0x16d>
+     dfd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e00 <fclose>:
+{
+     e00:	55                   	push   %ebp
+     e01:	89 e5                	mov    %esp,%ebp
+     e03:	56                   	push   %esi
+     e04:	53                   	push   %ebx
+  if(threaded)
+     e05:	8b 15 00 2b 00 00    	mov    0x2b00,%edx
+{
+     e0b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+     e0e:	85 d2                	test   %edx,%edx
+     e10:	75 46                	jne    e58 <fclose+0x58>
+  r = flush(f);
+     e12:	89 d8                	mov    %ebx,%eax
+     e14:	e8 27 fc ff ff       	call   a40 <flush>
+  if(close(f->fd) < 0)
+     e19:	83 ec 0c             	sub    $0xc,%esp
+     e1c:	ff 33                	push   (%ebx)
+  r = flush(f);
+     e1e:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+     e20:	e8 db f6 ff ff       	call   500 <close>
+     e25:	83 c4 10             	add    $0x10,%esp
+    r = EOF;
+     e28:	85 c0                	test   %eax,%eax
+     e2a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     e2f:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->flags & IO_MALLOC)
+     e32:	f6 43 04 80          	testb  $0x80,0x4(%ebx)
+     e36:	75 58                	jne    e90 <fclose+0x90>
+  if(threaded)
+     e38:	a1 00 2b 00 00       	mov    0x2b00,%eax
+  f->flags = 0;
+     e3d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  if(threaded)
+     e44:	85 c0                	test   %eax,%eax
+     e46:	75 28                	jne    e70 <fclose+0x70>
+}
+     e48:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e4b:	89 f0                	mov    %esi,%eax
+     e4d:	5b                   	pop    %ebx
+     e4e:	5e                   	pop    %esi
+     e4f:	5d                   	pop    %ebp
+     e50:	c3                   	ret
+     e51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     e58:	83 ec 0c             	sub    $0xc,%esp
+     e5b:	8d 43 18             	lea    0x18(%ebx),%eax
+     e5e:	50                   	push   %eax
+     e5f:	e8 1c f5 ff ff       	call   380 <mutex_lock>
+     e64:	83 c4 10             	add    $0x10,%esp
+     e67:	eb a9                	jmp    e12 <fclose+0x12>
+     e69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     e70:	83 ec 0c             	sub    $0xc,%esp
+     e73:	83 c3 18             	add    $0x18,%ebx
+     e76:	53                   	push   %ebx
+     e77:	e8 54 f5 ff ff       	call   3d0 <mutex_unlock>
+     e7c:	83 c4 10             	add    $0x10,%esp
+}
+     e7f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e82:	89 f0                	mov    %esi,%eax
+     e84:	5b                   	pop    %ebx
+     e85:	5e                   	pop    %esi
+     e86:	5d                   	pop    %ebp
+     e87:	c3                   	ret
+     e88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e8f:	90                   	nop
+    free(f->buf);
+     e90:	83 ec 0c             	sub    $0xc,%esp
+     e93:	ff 73 08             	push   0x8(%ebx)
+     e96:	e8 f5 09 00 00       	call   1890 <free>
+     e9b:	83 c4 10             	add    $0x10,%esp
+     e9e:	eb 98                	jmp    e38 <fclose+0x38>
+
+00000ea0 <fflush>:
+{
+     ea0:	55                   	push   %ebp
+     ea1:	89 e5                	mov    %esp,%ebp
+     ea3:	53                   	push   %ebx
+     ea4:	83 ec 14             	sub    $0x14,%esp
+     ea7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f == 0){
+     eaa:	85 db                	test   %ebx,%ebx
+     eac:	74 5a                	je     f08 <fflush+0x68>
+  if(threaded)
+     eae:	8b 0d 00 2b 00 00    	mov    0x2b00,%ecx
+     eb4:	85 c9                	test   %ecx,%ecx
+     eb6:	75 18                	jne    ed0 <fflush+0x30>
+  r = flush(f);
+     eb8:	89 d8                	mov    %ebx,%eax
+     eba:	e8 81 fb ff ff       	call   a40 <flush>
+  if(threaded)
+     ebf:	8b 15 00 2b 00 00    	mov    0x2b00,%edx
+     ec5:	85 d2                	test   %edx,%edx
+     ec7:	75 1f                	jne    ee8 <fflush+0x48>
+}
+     ec9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ecc:	c9                   	leave
+     ecd:	c3                   	ret
+     ece:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+     ed0:	83 ec 0c             	sub    $0xc,%esp
+     ed3:	8d 43 18             	lea    0x18(%ebx),%eax
+     ed6:	50                   	push   %eax
+     ed7:	e8 a4 f4 ff ff       	call   380 <mutex_lock>
+     edc:	83 c4 10             	add    $0x10,%esp
+     edf:	eb d7                	jmp    eb8 <fflush+0x18>
+     ee1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     ee8:	83 ec 0c             	sub    $0xc,%esp
+     eeb:	83 c3 18             	add    $0x18,%ebx
+     eee:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     ef1:	53                   	push   %ebx
+     ef2:	e8 d9 f4 ff ff       	call   3d0 <mutex_unlock>
+     ef7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     efa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    mutex_unlock(&f->lock);
+     efd:	83 c4 10             	add    $0x10,%esp
+}
+     f00:	c9                   	leave
+     f01:	c3                   	ret
+     f02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     f08:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f0b:	c9                   	leave
+     f0c:	e9 af fb ff ff       	jmp    ac0 <fflush.part.0>
+     f11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f1f:	90                   	nop
+
+00000f20 <putc_unlocked>:
+{
+     f20:	55                   	push   %ebp
+     f21:	89 e5                	mov    %esp,%ebp
+     f23:	56                   	push   %esi
+     f24:	53                   	push   %ebx
+     f25:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     f28:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(!(f->flags & IO_WRITE))
+     f2b:	8b 43 04             	mov    0x4(%ebx),%eax
+     f2e:	a8 02                	test   $0x2,%al
+     f30:	74 46                	je     f78 <putc_unlocked+0x58>
+  if(!(f->flags & IO_SETUP))
+     f32:	a8 40                	test   $0x40,%al
+     f34:	74 4a                	je     f80 <putc_unlocked+0x60>
+  if(f->n == f->size && flush(f) < 0)
+     f36:	8b 43 14             	mov    0x14(%ebx),%eax
+     f39:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     f3c:	74 51                	je     f8f <putc_unlocked+0x6f>
+  f->buf[f->n++] = c;
+     f3e:	8d 48 01             	lea    0x1(%eax),%ecx
+     f41:	8b 53 08             	mov    0x8(%ebx),%edx
+     f44:	89 4b 14             	mov    %ecx,0x14(%ebx)
+     f47:	89 f1                	mov    %esi,%ecx
+     f49:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     f4c:	83 fe 0a             	cmp    $0xa,%esi
+     f4f:	74 0f                	je     f60 <putc_unlocked+0x40>
+  return c & 0xff;
+     f51:	89 f0                	mov    %esi,%eax
+     f53:	0f b6 c0             	movzbl %al,%eax
+}
+     f56:	5b                   	pop    %ebx
+     f57:	5e                   	pop    %esi
+     f58:	5d                   	pop    %ebp
+     f59:	c3                   	ret
+     f5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     f60:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+     f64:	74 eb                	je     f51 <putc_unlocked+0x31>
+     f66:	89 d8                	mov    %ebx,%eax
+     f68:	e8 d3 fa ff ff       	call   a40 <flush>
+     f6d:	85 c0                	test   %eax,%eax
+     f6f:	79 e0                	jns    f51 <putc_unlocked+0x31>
+     f71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return EOF;
+     f78:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     f7d:	eb d7                	jmp    f56 <putc_unlocked+0x36>
+     f7f:	90                   	nop
+    setup(f);
+     f80:	89 d8                	mov    %ebx,%eax
+     f82:	e8 69 fa ff ff       	call   9f0 <setup>
+  if(f->n == f->size && flush(f) < 0)
+     f87:	8b 43 14             	mov    0x14(%ebx),%eax
+     f8a:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     f8d:	75 af                	jne    f3e <putc_unlocked+0x1e>
+     f8f:	89 d8                	mov    %ebx,%eax
+     f91:	e8 aa fa ff ff       	call   a40 <flush>
+     f96:	85 c0                	test   %eax,%eax
+     f98:	78 de                	js     f78 <putc_unlocked+0x58>
+  f->buf[f->n++] = c;
+     f9a:	8b 43 14             	mov    0x14(%ebx),%eax
+     f9d:	eb 9f                	jmp    f3e <putc_unlocked+0x1e>
+     f9f:	90                   	nop
+
+00000fa0 <fputc>:
+{
+     fa0:	55                   	push   %ebp
+     fa1:	89 e5                	mov    %esp,%ebp
+     fa3:	56                   	push   %esi
+     fa4:	53                   	push   %ebx
+  if(threaded)
+     fa5:	8b 15 00 2b 00 00    	mov    0x2b00,%edx
+{
+     fab:	8b 75 08             	mov    0x8(%ebp),%esi
+     fae:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(threaded)
+     fb1:	85 d2                	test   %edx,%edx
+     fb3:	75 6b                	jne    1020 <fputc+0x80>
+  if(!(f->flags & IO_WRITE))
+     fb5:	8b 43 04             	mov    0x4(%ebx),%eax
+     fb8:	a8 02                	test   $0x2,%al
+     fba:	0f 84 b8 00 00 00    	je     1078 <fputc+0xd8>
+  if(!(f->flags & IO_SETUP))
+     fc0:	a8 40                	test   $0x40,%al
+     fc2:	74 76                	je     103a <fputc+0x9a>
+  if(f->n == f->size && flush(f) < 0)
+     fc4:	8b 43 14             	mov    0x14(%ebx),%eax
+     fc7:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     fca:	74 7d                	je     1049 <fputc+0xa9>
+  f->buf[f->n++] = c;
+     fcc:	8d 48 01             	lea    0x1(%eax),%ecx
+     fcf:	8b 53 08             	mov    0x8(%ebx),%edx
+     fd2:	89 4b 14             	mov    %ecx,0x14(%ebx)
+     fd5:	89 f1                	mov    %esi,%ecx
+     fd7:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     fda:	83 fe 0a             	cmp    $0xa,%esi
+     fdd:	74 21                	je     1000 <fputc+0x60>
+  return c & 0xff;
+     fdf:	89 f0                	mov    %esi,%eax
+     fe1:	0f b6 f0             	movzbl %al,%esi
+  if(threaded)
+     fe4:	a1 00 2b 00 00       	mov    0x2b00,%eax
+     fe9:	85 c0                	test   %eax,%eax
+     feb:	75 73                	jne    1060 <fputc+0xc0>
+}
+     fed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ff0:	89 f0                	mov    %esi,%eax
+     ff2:	5b                   	pop    %ebx
+     ff3:	5e                   	pop    %esi
+     ff4:	5d                   	pop    %ebp
+     ff5:	c3                   	ret
+     ff6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ffd:	8d 76 00             	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    1000:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1004:	74 d9                	je     fdf <fputc+0x3f>
+    1006:	89 d8                	mov    %ebx,%eax
+    1008:	e8 33 fa ff ff       	call   a40 <flush>
+    100d:	85 c0                	test   %eax,%eax
+    100f:	79 ce                	jns    fdf <fputc+0x3f>
+    return EOF;
+    1011:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1016:	eb cc                	jmp    fe4 <fputc+0x44>
+    1018:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    101f:	90                   	nop
+    mutex_lock(&f->lock);
+    1020:	83 ec 0c             	sub    $0xc,%esp
+    1023:	8d 43 18             	lea    0x18(%ebx),%eax
+    1026:	50                   	push   %eax
+    1027:	e8 54 f3 ff ff       	call   380 <mutex_lock>
+  if(!(f->flags & IO_WRITE))
+    102c:	8b 43 04             	mov    0x4(%ebx),%eax
+    102f:	83 c4 10             	add    $0x10,%esp
+    1032:	a8 02                	test   $0x2,%al
+    1034:	74 db                	je     1011 <fputc+0x71>
+  if(!(f->flags & IO_SETUP))
+    1036:	a8 40                	test   $0x40,%al
+    1038:	75 8a                	jne    fc4 <fputc+0x24>
+    setup(f);
+    103a:	89 d8                	mov    %ebx,%eax
+    103c:	e8 af f9 ff ff       	call   9f0 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    1041:	8b 43 14             	mov    0x14(%ebx),%eax
+    1044:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    1047:	75 83                	jne    fcc <fputc+0x2c>
+    1049:	89 d8                	mov    %ebx,%eax
+    104b:	e8 f0 f9 ff ff       	call   a40 <flush>
+    1050:	85 c0                	test   %eax,%eax
+    1052:	78 bd                	js     1011 <fputc+0x71>
+  f->buf[f->n++] = c;
+    1054:	8b 43 14             	mov    0x14(%ebx),%eax
+    1057:	e9 70 ff ff ff       	jmp    fcc <fputc+0x2c>
+    105c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1060:	83 ec 0c             	sub    $0xc,%esp
+    1063:	83 c3 18             	add    $0x18,%ebx
+    1066:	53                   	push   %ebx
+    1067:	e8 64 f3 ff ff       	call   3d0 <mutex_unlock>
+    106c:	83 c4 10             	add    $0x10,%esp
+}
+    106f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1072:	89 f0                	mov    %esi,%eax
+    1074:	5b                   	pop    %ebx
+    1075:	5e                   	pop    %esi
+    1076:	5d                   	pop    %ebp
+    1077:	c3                   	ret
+    return EOF;
+    1078:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    107d:	e9 6b ff ff ff       	jmp    fed <fputc+0x4d>
+    1082:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1089:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001090 <fwrite>:
+{
+    1090:	55                   	push   %ebp
+    1091:	89 e5                	mov    %esp,%ebp
+    1093:	57                   	push   %edi
+    1094:	56                   	push   %esi
+    1095:	53                   	push   %ebx
+    1096:	83 ec 1c             	sub    $0x1c,%esp
+    1099:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  if(!(f->flags & IO_WRITE) || size <= 0)
+    109c:	8b 43 04             	mov    0x4(%ebx),%eax
+    109f:	a8 02                	test   $0x2,%al
+    10a1:	0f 84 ec 00 00 00    	je     1193 <fwrite+0x103>
+    10a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    10aa:	85 c9                	test   %ecx,%ecx
+    10ac:	0f 8e e1 00 00 00    	jle    1193 <fwrite+0x103>
+  if(threaded)
+    10b2:	8b 15 00 2b 00 00    	mov    0x2b00,%edx
+    10b8:	85 d2                	test   %edx,%edx
+    10ba:	0f 85 1c 01 00 00    	jne    11dc <fwrite+0x14c>
+  if(!(f->flags & IO_SETUP))
+    10c0:	a8 40                	test   $0x40,%al
+    10c2:	0f 84 08 01 00 00    	je     11d0 <fwrite+0x140>
+  for(len = size*nmemb; len > 0; len -= n){
+    10c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+    10cb:	0f af 45 10          	imul   0x10(%ebp),%eax
+    10cf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    10d2:	85 c0                	test   %eax,%eax
+    10d4:	0f 8e 2a 01 00 00    	jle    1204 <fwrite+0x174>
+  s = p;
+    10da:	8b 45 08             	mov    0x8(%ebp),%eax
+  nl = 0;
+    10dd:	31 ff                	xor    %edi,%edi
+    10df:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+        nl = 1;
+    10e2:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  s = p;
+    10e5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    10e8:	8b 43 14             	mov    0x14(%ebx),%eax
+        nl = 1;
+    10eb:	89 ce                	mov    %ecx,%esi
+    if(f->n == f->size && flush(f) < 0)
+    10ed:	89 c2                	mov    %eax,%edx
+    10ef:	39 f0                	cmp    %esi,%eax
+    10f1:	74 6e                	je     1161 <fwrite+0xd1>
+    10f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10f7:	90                   	nop
+    if(n > len)
+    10f8:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    n = f->size - f->n;
+    10fb:	89 f1                	mov    %esi,%ecx
+    10fd:	29 c1                	sub    %eax,%ecx
+    10ff:	39 f9                	cmp    %edi,%ecx
+    1101:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1104:	85 c9                	test   %ecx,%ecx
+    1106:	0f 8e 7c 00 00 00    	jle    1188 <fwrite+0xf8>
+    110c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    110f:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1112:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    1115:	8d 34 08             	lea    (%eax,%ecx,1),%esi
+    1118:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    111b:	eb 06                	jmp    1123 <fwrite+0x93>
+    111d:	8d 76 00             	lea    0x0(%esi),%esi
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1120:	8b 53 14             	mov    0x14(%ebx),%edx
+    1123:	8d 4a 01             	lea    0x1(%edx),%ecx
+    1126:	8b 73 08             	mov    0x8(%ebx),%esi
+    1129:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    112c:	0f b6 08             	movzbl (%eax),%ecx
+        nl = 1;
+    112f:	80 f9 0a             	cmp    $0xa,%cl
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1132:	88 0c 16             	mov    %cl,(%esi,%edx,1)
+        nl = 1;
+    1135:	be 01 00 00 00       	mov    $0x1,%esi
+    113a:	0f 44 fe             	cmove  %esi,%edi
+    for(i = 0; i < n; i++)
+    113d:	83 c0 01             	add    $0x1,%eax
+    1140:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    1143:	75 db                	jne    1120 <fwrite+0x90>
+    s += n;
+    1145:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1148:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    114b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    s += n;
+    114e:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    1151:	85 c0                	test   %eax,%eax
+    1153:	7e 48                	jle    119d <fwrite+0x10d>
+    1155:	8b 43 14             	mov    0x14(%ebx),%eax
+    1158:	8b 73 0c             	mov    0xc(%ebx),%esi
+    if(f->n == f->size && flush(f) < 0)
+    115b:	89 c2                	mov    %eax,%edx
+    115d:	39 f0                	cmp    %esi,%eax
+    115f:	75 97                	jne    10f8 <fwrite+0x68>
+    1161:	89 d8                	mov    %ebx,%eax
+    1163:	e8 d8 f8 ff ff       	call   a40 <flush>
+    1168:	85 c0                	test   %eax,%eax
+    116a:	78 31                	js     119d <fwrite+0x10d>
+    n = f->size - f->n;
+    116c:	8b 73 0c             	mov    0xc(%ebx),%esi
+    116f:	8b 43 14             	mov    0x14(%ebx),%eax
+    1172:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    1175:	89 f1                	mov    %esi,%ecx
+    1177:	89 c2                	mov    %eax,%edx
+    1179:	29 c1                	sub    %eax,%ecx
+    117b:	39 f9                	cmp    %edi,%ecx
+    117d:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1180:	85 c9                	test   %ecx,%ecx
+    1182:	7f 88                	jg     110c <fwrite+0x7c>
+    1184:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    s += n;
+    1188:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    118b:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    118e:	e9 5a ff ff ff       	jmp    10ed <fwrite+0x5d>
+}
+    1193:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    1196:	31 c0                	xor    %eax,%eax
+}
+    1198:	5b                   	pop    %ebx
+    1199:	5e                   	pop    %esi
+    119a:	5f                   	pop    %edi
+    119b:	5d                   	pop    %ebp
+    119c:	c3                   	ret
+  if(nl && (f->flags & IO_LINE))
+    119d:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    11a0:	85 ff                	test   %edi,%edi
+    11a2:	74 06                	je     11aa <fwrite+0x11a>
+    11a4:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    11a8:	75 1d                	jne    11c7 <fwrite+0x137>
+  return (s - (const char*)p) / size;
+    11aa:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    11ad:	2b 75 08             	sub    0x8(%ebp),%esi
+  if(threaded)
+    11b0:	a1 00 2b 00 00       	mov    0x2b00,%eax
+    11b5:	85 c0                	test   %eax,%eax
+    11b7:	75 3a                	jne    11f3 <fwrite+0x163>
+  return (s - (const char*)p) / size;
+    11b9:	89 f0                	mov    %esi,%eax
+    11bb:	99                   	cltd
+    11bc:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    11bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11c2:	5b                   	pop    %ebx
+    11c3:	5e                   	pop    %esi
+    11c4:	5f                   	pop    %edi
+    11c5:	5d                   	pop    %ebp
+    11c6:	c3                   	ret
+    flush(f);
+    11c7:	89 d8                	mov    %ebx,%eax
+    11c9:	e8 72 f8 ff ff       	call   a40 <flush>
+    11ce:	eb da                	jmp    11aa <fwrite+0x11a>
+    setup(f);
+    11d0:	89 d8                	mov    %ebx,%eax
+    11d2:	e8 19 f8 ff ff       	call   9f0 <setup>
+    11d7:	e9 ec fe ff ff       	jmp    10c8 <fwrite+0x38>
+    mutex_lock(&f->lock);
+    11dc:	83 ec 0c             	sub    $0xc,%esp
+    11df:	8d 43 18             	lea    0x18(%ebx),%eax
+    11e2:	50                   	push   %eax
+    11e3:	e8 98 f1 ff ff       	call   380 <mutex_lock>
+  if(!(f->flags & IO_SETUP))
+    11e8:	8b 43 04             	mov    0x4(%ebx),%eax
+    11eb:	83 c4 10             	add    $0x10,%esp
+    11ee:	e9 cd fe ff ff       	jmp    10c0 <fwrite+0x30>
+    mutex_unlock(&f->lock);
+    11f3:	83 ec 0c             	sub    $0xc,%esp
+    11f6:	83 c3 18             	add    $0x18,%ebx
+    11f9:	53                   	push   %ebx
+    11fa:	e8 d1 f1 ff ff       	call   3d0 <mutex_unlock>
+    11ff:	83 c4 10             	add    $0x10,%esp
+    1202:	eb b5                	jmp    11b9 <fwrite+0x129>
+  for(len = size*nmemb; len > 0; len -= n){
+    1204:	31 f6                	xor    %esi,%esi
+    1206:	eb a8                	jmp    11b0 <fwrite+0x120>
+    1208:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    120f:	90                   	nop
+
+00001210 <fgetc>:
+  return f->buf[f->r++] & 0xff;
+}
+
+int
+fgetc(FILE *f)
+{
+    1210:	55                   	push   %ebp
+    1211:	89 e5                	mov    %esp,%ebp
+    1213:	56                   	push   %esi
+    1214:	53                   	push   %ebx
+  if(threaded)
+    1215:	8b 15 00 2b 00 00    	mov    0x2b00,%edx
+{
+    121b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    121e:	85 d2                	test   %edx,%edx
+    1220:	75 2e                	jne    1250 <fgetc+0x40>
+  if(!(f->flags & IO_READ))
+    1222:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1226:	74 78                	je     12a0 <fgetc+0x90>
+  if(f->r == f->n && fill(f) == 0)
+    1228:	8b 43 10             	mov    0x10(%ebx),%eax
+    122b:	3b 43 14             	cmp    0x14(%ebx),%eax
+    122e:	74 60                	je     1290 <fgetc+0x80>
+  return f->buf[f->r++] & 0xff;
+    1230:	8b 53 08             	mov    0x8(%ebx),%edx
+    1233:	8d 48 01             	lea    0x1(%eax),%ecx
+    1236:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1239:	0f b6 34 02          	movzbl (%edx,%eax,1),%esi
+  if(threaded)
+    123d:	a1 00 2b 00 00       	mov    0x2b00,%eax
+    1242:	85 c0                	test   %eax,%eax
+    1244:	75 2a                	jne    1270 <fgetc+0x60>
+
+  flockfile(f);
+  c = getc_unlocked(f);
+  funlockfile(f);
+  return c;
+}
+    1246:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1249:	89 f0                	mov    %esi,%eax
+    124b:	5b                   	pop    %ebx
+    124c:	5e                   	pop    %esi
+    124d:	5d                   	pop    %ebp
+    124e:	c3                   	ret
+    124f:	90                   	nop
+    mutex_lock(&f->lock);
+    1250:	83 ec 0c             	sub    $0xc,%esp
+    1253:	8d 43 18             	lea    0x18(%ebx),%eax
+    1256:	50                   	push   %eax
+    1257:	e8 24 f1 ff ff       	call   380 <mutex_lock>
+  if(!(f->flags & IO_READ))
+    125c:	83 c4 10             	add    $0x10,%esp
+    125f:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1263:	75 c3                	jne    1228 <fgetc+0x18>
+    return EOF;
+    1265:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    126a:	eb d1                	jmp    123d <fgetc+0x2d>
+    126c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1270:	83 ec 0c             	sub    $0xc,%esp
+    1273:	83 c3 18             	add    $0x18,%ebx
+    1276:	53                   	push   %ebx
+    1277:	e8 54 f1 ff ff       	call   3d0 <mutex_unlock>
+    127c:	83 c4 10             	add    $0x10,%esp
+}
+    127f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1282:	89 f0                	mov    %esi,%eax
+    1284:	5b                   	pop    %ebx
+    1285:	5e                   	pop    %esi
+    1286:	5d                   	pop    %ebp
+    1287:	c3                   	ret
+    1288:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    128f:	90                   	nop
+  if(f->r == f->n && fill(f) == 0)
+    1290:	89 d8                	mov    %ebx,%eax
+    1292:	e8 c9 f8 ff ff       	call   b60 <fill>
+    1297:	85 c0                	test   %eax,%eax
+    1299:	74 ca                	je     1265 <fgetc+0x55>
+  return f->buf[f->r++] & 0xff;
+    129b:	8b 43 10             	mov    0x10(%ebx),%eax
+    129e:	eb 90                	jmp    1230 <fgetc+0x20>
+    return EOF;
+    12a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    12a5:	eb 9f                	jmp    1246 <fgetc+0x36>
+    12a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ae:	66 90                	xchg   %ax,%ax
+
+000012b0 <fread>:
+
+int
+fread(void *p, int size, int nmemb, FILE *f)
+{
+    12b0:	55                   	push   %ebp
+    12b1:	89 e5                	mov    %esp,%ebp
+    12b3:	57                   	push   %edi
+    12b4:	56                   	push   %esi
+    12b5:	53                   	push   %ebx
+    12b6:	83 ec 1c             	sub    $0x1c,%esp
+    12b9:	8b 75 14             	mov    0x14(%ebp),%esi
+  char *d;
+  int n, len;
+
+  if(!(f->flags & IO_READ) || size <= 0)
+    12bc:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+    12c0:	74 7e                	je     1340 <fread+0x90>
+    12c2:	8b 55 0c             	mov    0xc(%ebp),%edx
+    12c5:	85 d2                	test   %edx,%edx
+    12c7:	7e 77                	jle    1340 <fread+0x90>
+  if(threaded)
+    12c9:	a1 00 2b 00 00       	mov    0x2b00,%eax
+    return 0;
+  flockfile(f);
+  d = p;
+  for(len = size*nmemb; len > 0; len -= n){
+    12ce:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    12d1:	0f af 7d 10          	imul   0x10(%ebp),%edi
+  if(threaded)
+    12d5:	85 c0                	test   %eax,%eax
+    12d7:	0f 85 93 00 00 00    	jne    1370 <fread+0xc0>
+  for(len = size*nmemb; len > 0; len -= n){
+    12dd:	85 ff                	test   %edi,%edi
+    12df:	7e 61                	jle    1342 <fread+0x92>
+    if(f->r == f->n && fill(f) == 0)
+    12e1:	8b 46 10             	mov    0x10(%esi),%eax
+  d = p;
+    12e4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    12e7:	eb 35                	jmp    131e <fread+0x6e>
+    12e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      break;
+    n = f->n - f->r;
+    12f0:	29 c3                	sub    %eax,%ebx
+    12f2:	39 fb                	cmp    %edi,%ebx
+    12f4:	0f 4f df             	cmovg  %edi,%ebx
+    if(n > len)
+      n = len;
+    memmove(d, f->buf + f->r, n);
+    12f7:	83 ec 04             	sub    $0x4,%esp
+    12fa:	53                   	push   %ebx
+    12fb:	03 46 08             	add    0x8(%esi),%eax
+  for(len = size*nmemb; len > 0; len -= n){
+    12fe:	29 df                	sub    %ebx,%edi
+    memmove(d, f->buf + f->r, n);
+    1300:	50                   	push   %eax
+    1301:	51                   	push   %ecx
+    1302:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1305:	e8 36 f0 ff ff       	call   340 <memmove>
+    f->r += n;
+    130a:	8b 46 10             	mov    0x10(%esi),%eax
+    d += n;
+    130d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1310:	83 c4 10             	add    $0x10,%esp
+    f->r += n;
+    1313:	01 d8                	add    %ebx,%eax
+    d += n;
+    1315:	01 d9                	add    %ebx,%ecx
+    f->r += n;
+    1317:	89 46 10             	mov    %eax,0x10(%esi)
+  for(len = size*nmemb; len > 0; len -= n){
+    131a:	85 ff                	test   %edi,%edi
+    131c:	7e 32                	jle    1350 <fread+0xa0>
+    if(f->r == f->n && fill(f) == 0)
+    131e:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1321:	39 c3                	cmp    %eax,%ebx
+    1323:	75 cb                	jne    12f0 <fread+0x40>
+    1325:	89 f0                	mov    %esi,%eax
+    1327:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    132a:	e8 31 f8 ff ff       	call   b60 <fill>
+    132f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1332:	85 c0                	test   %eax,%eax
+    1334:	74 1a                	je     1350 <fread+0xa0>
+    n = f->n - f->r;
+    1336:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1339:	8b 46 10             	mov    0x10(%esi),%eax
+    133c:	eb b2                	jmp    12f0 <fread+0x40>
+    133e:	66 90                	xchg   %ax,%ax
+    return 0;
+    1340:	31 c0                	xor    %eax,%eax
+  }
+  funlockfile(f);
+  return (d - (char*)p) / size;
+}
+    1342:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1345:	5b                   	pop    %ebx
+    1346:	5e                   	pop    %esi
+    1347:	5f                   	pop    %edi
+    1348:	5d                   	pop    %ebp
+    1349:	c3                   	ret
+    134a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (d - (char*)p) / size;
+    1350:	2b 4d 08             	sub    0x8(%ebp),%ecx
+    1353:	89 cb                	mov    %ecx,%ebx
+  if(threaded)
+    1355:	a1 00 2b 00 00       	mov    0x2b00,%eax
+    135a:	85 c0                	test   %eax,%eax
+    135c:	75 32                	jne    1390 <fread+0xe0>
+  return (d - (char*)p) / size;
+    135e:	89 d8                	mov    %ebx,%eax
+    1360:	99                   	cltd
+    1361:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1364:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1367:	5b                   	pop    %ebx
+    1368:	5e                   	pop    %esi
+    1369:	5f                   	pop    %edi
+    136a:	5d                   	pop    %ebp
+    136b:	c3                   	ret
+    136c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    1370:	83 ec 0c             	sub    $0xc,%esp
+    1373:	8d 46 18             	lea    0x18(%esi),%eax
+    1376:	50                   	push   %eax
+    1377:	e8 04 f0 ff ff       	call   380 <mutex_lock>
+  for(len = size*nmemb; len > 0; len -= n){
+    137c:	83 c4 10             	add    $0x10,%esp
+    137f:	85 ff                	test   %edi,%edi
+    1381:	0f 8f 5a ff ff ff    	jg     12e1 <fread+0x31>
+    1387:	31 db                	xor    %ebx,%ebx
+    1389:	eb ca                	jmp    1355 <fread+0xa5>
+    138b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    138f:	90                   	nop
+    mutex_unlock(&f->lock);
+    1390:	83 ec 0c             	sub    $0xc,%esp
+    1393:	83 c6 18             	add    $0x18,%esi
+    1396:	56                   	push   %esi
+    1397:	e8 34 f0 ff ff       	call   3d0 <mutex_unlock>
+  return (d - (char*)p) / size;
+    139c:	89 d8                	mov    %ebx,%eax
+    139e:	83 c4 10             	add    $0x10,%esp
+    13a1:	99                   	cltd
+    13a2:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    13a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13a8:	5b                   	pop    %ebx
+    13a9:	5e                   	pop    %esi
+    13aa:	5f                   	pop    %edi
+    13ab:	5d                   	pop    %ebp
+    13ac:	c3                   	ret
+    13ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000013b0 <fgets>:
+
+// Read a line of at most max-1 bytes, keeping the newline.
+// Returns 0 if there was nothing left to read.
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    13b0:	55                   	push   %ebp
+    13b1:	89 e5                	mov    %esp,%ebp
+    13b3:	57                   	push   %edi
+    13b4:	56                   	push   %esi
+    13b5:	53                   	push   %ebx
+    13b6:	83 ec 1c             	sub    $0x1c,%esp
+  if(threaded)
+    13b9:	8b 35 00 2b 00 00    	mov    0x2b00,%esi
+{
+    13bf:	8b 7d 08             	mov    0x8(%ebp),%edi
+    13c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if(threaded)
+    13c5:	85 f6                	test   %esi,%esi
+    13c7:	0f 85 83 00 00 00    	jne    1450 <fgets+0xa0>
+{
+    13cd:	31 f6                	xor    %esi,%esi
+    13cf:	eb 2a                	jmp    13fb <fgets+0x4b>
+    13d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return f->buf[f->r++] & 0xff;
+    13d8:	8b 53 08             	mov    0x8(%ebx),%edx
+    13db:	8d 48 01             	lea    0x1(%eax),%ecx
+    13de:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    13e1:	0f b6 14 02          	movzbl (%edx,%eax,1),%edx
+
+  flockfile(f);
+  for(i = 0; i+1 < max; ){
+    if((c = getc_unlocked(f)) == EOF)
+      break;
+    buf[i++] = c;
+    13e5:	88 54 37 ff          	mov    %dl,-0x1(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    13e9:	80 fa 0a             	cmp    $0xa,%dl
+    13ec:	0f 84 96 00 00 00    	je     1488 <fgets+0xd8>
+    13f2:	83 fa 0d             	cmp    $0xd,%edx
+    13f5:	0f 84 8d 00 00 00    	je     1488 <fgets+0xd8>
+  for(i = 0; i+1 < max; ){
+    13fb:	89 f2                	mov    %esi,%edx
+    13fd:	83 c6 01             	add    $0x1,%esi
+    1400:	3b 75 0c             	cmp    0xc(%ebp),%esi
+    1403:	7d 2b                	jge    1430 <fgets+0x80>
+  if(!(f->flags & IO_READ))
+    1405:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1409:	74 25                	je     1430 <fgets+0x80>
+  if(f->r == f->n && fill(f) == 0)
+    140b:	8b 43 10             	mov    0x10(%ebx),%eax
+    140e:	3b 43 14             	cmp    0x14(%ebx),%eax
+    1411:	75 c5                	jne    13d8 <fgets+0x28>
+    1413:	89 d8                	mov    %ebx,%eax
+    1415:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1418:	e8 43 f7 ff ff       	call   b60 <fill>
+    141d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1420:	85 c0                	test   %eax,%eax
+    1422:	74 0c                	je     1430 <fgets+0x80>
+  return f->buf[f->r++] & 0xff;
+    1424:	8b 43 10             	mov    0x10(%ebx),%eax
+    1427:	eb af                	jmp    13d8 <fgets+0x28>
+    1429:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1430:	8b 0d 00 2b 00 00    	mov    0x2b00,%ecx
+      break;
+  }
+  buf[i] = '\0';
+    1436:	c6 04 17 00          	movb   $0x0,(%edi,%edx,1)
+  if(threaded)
+    143a:	85 c9                	test   %ecx,%ecx
+    143c:	75 2a                	jne    1468 <fgets+0xb8>
+  funlockfile(f);
+  return i > 0 ? buf : 0;
+    143e:	31 c0                	xor    %eax,%eax
+    1440:	85 d2                	test   %edx,%edx
+    1442:	74 02                	je     1446 <fgets+0x96>
+    1444:	89 f8                	mov    %edi,%eax
+}
+    1446:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1449:	5b                   	pop    %ebx
+    144a:	5e                   	pop    %esi
+    144b:	5f                   	pop    %edi
+    144c:	5d                   	pop    %ebp
+    144d:	c3                   	ret
+    144e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    1450:	83 ec 0c             	sub    $0xc,%esp
+    1453:	8d 43 18             	lea    0x18(%ebx),%eax
+    1456:	50                   	push   %eax
+    1457:	e8 24 ef ff ff       	call   380 <mutex_lock>
+    145c:	83 c4 10             	add    $0x10,%esp
+    145f:	e9 69 ff ff ff       	jmp    13cd <fgets+0x1d>
+    1464:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1468:	83 ec 0c             	sub    $0xc,%esp
+    146b:	83 c3 18             	add    $0x18,%ebx
+    146e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1471:	53                   	push   %ebx
+    1472:	e8 59 ef ff ff       	call   3d0 <mutex_unlock>
+    1477:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    147a:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    147d:	31 c0                	xor    %eax,%eax
+    147f:	85 d2                	test   %edx,%edx
+    1481:	75 c1                	jne    1444 <fgets+0x94>
+    1483:	eb c1                	jmp    1446 <fgets+0x96>
+    1485:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1488:	a1 00 2b 00 00       	mov    0x2b00,%eax
+  buf[i] = '\0';
+    148d:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  if(threaded)
+    1491:	85 c0                	test   %eax,%eax
+    1493:	74 af                	je     1444 <fgets+0x94>
+    mutex_unlock(&f->lock);
+    1495:	83 ec 0c             	sub    $0xc,%esp
+    1498:	83 c3 18             	add    $0x18,%ebx
+    149b:	53                   	push   %ebx
+    149c:	e8 2f ef ff ff       	call   3d0 <mutex_unlock>
+    14a1:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    14a4:	89 f8                	mov    %edi,%eax
+    14a6:	eb 9e                	jmp    1446 <fgets+0x96>
+    14a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14af:	90                   	nop
+
+000014b0 <gets>:
+// at most a line per read(), goes through stdin's buffer: from a
+// file or pipe, a buffered read could take input meant for a child
+// process, so read a byte at a time.
+char*
+gets(char *buf, int max)
+{
+    14b0:	55                   	push   %ebp
+    14b1:	89 e5                	mov    %esp,%ebp
+    14b3:	57                   	push   %edi
+    14b4:	56                   	push   %esi
+    14b5:	53                   	push   %ebx
+    14b6:	83 ec 2c             	sub    $0x2c,%esp
+  int i, cc;
+  char c;
+
+  if(!(stdin->flags & IO_SETUP))
+    14b9:	8b 15 04 28 00 00    	mov    0x2804,%edx
+{
+    14bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!(stdin->flags & IO_SETUP))
+    14c2:	f6 c2 40             	test   $0x40,%dl
+    14c5:	74 79                	je     1540 <gets+0x90>
+    setup(stdin);
+  if(stdin->flags & IO_DEV){
+    14c7:	83 e2 20             	and    $0x20,%edx
+    14ca:	89 d7                	mov    %edx,%edi
+    14cc:	75 52                	jne    1520 <gets+0x70>
+  if(f == 0){
+    14ce:	e8 ed f5 ff ff       	call   ac0 <fflush.part.0>
+    fgets(buf, max, stdin);
+    return buf;
+  }
+  fflush(0);
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    14d3:	8d 75 e7             	lea    -0x19(%ebp),%esi
+  for(i=0; i+1 < max; ){
+    14d6:	eb 2c                	jmp    1504 <gets+0x54>
+    14d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14df:	90                   	nop
+    cc = read(0, &c, 1);
+    14e0:	83 ec 04             	sub    $0x4,%esp
+    14e3:	6a 01                	push   $0x1
+    14e5:	56                   	push   %esi
+    14e6:	6a 00                	push   $0x0
+    14e8:	e8 f5 ef ff ff       	call   4e2 <read>
+    if(cc < 1)
+    14ed:	83 c4 10             	add    $0x10,%esp
+    14f0:	85 c0                	test   %eax,%eax
+    14f2:	7e 1b                	jle    150f <gets+0x5f>
+      break;
+    buf[i++] = c;
+    14f4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    14f8:	88 44 3b ff          	mov    %al,-0x1(%ebx,%edi,1)
+    if(c == '\n' || c == '\r')
+    14fc:	3c 0a                	cmp    $0xa,%al
+    14fe:	74 12                	je     1512 <gets+0x62>
+    1500:	3c 0d                	cmp    $0xd,%al
+    1502:	74 0e                	je     1512 <gets+0x62>
+  for(i=0; i+1 < max; ){
+    1504:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    1507:	83 c7 01             	add    $0x1,%edi
+    150a:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+    150d:	7c d1                	jl     14e0 <gets+0x30>
+{
+    150f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      break;
+  }
+  buf[i] = '\0';
+    1512:	c6 04 3b 00          	movb   $0x0,(%ebx,%edi,1)
+  return buf;
+}
+    1516:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1519:	89 d8                	mov    %ebx,%eax
+    151b:	5b                   	pop    %ebx
+    151c:	5e                   	pop    %esi
+    151d:	5f                   	pop    %edi
+    151e:	5d                   	pop    %ebp
+    151f:	c3                   	ret
+    fgets(buf, max, stdin);
+    1520:	83 ec 04             	sub    $0x4,%esp
+    1523:	68 00 28 00 00       	push   $0x2800
+    1528:	ff 75 0c             	push   0xc(%ebp)
+    152b:	53                   	push   %ebx
+    152c:	e8 7f fe ff ff       	call   13b0 <fgets>
+    return buf;
+    1531:	83 c4 10             	add    $0x10,%esp
+}
+    1534:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1537:	89 d8                	mov    %ebx,%eax
+    1539:	5b                   	pop    %ebx
+    153a:	5e                   	pop    %esi
+    153b:	5f                   	pop    %edi
+    153c:	5d                   	pop    %ebp
+    153d:	c3                   	ret
+    153e:	66 90                	xchg   %ax,%ax
+    setup(stdin);
+    1540:	b8 00 28 00 00       	mov    $0x2800,%eax
+    1545:	e8 a6 f4 ff ff       	call   9f0 <setup>
+  if(stdin->flags & IO_DEV){
+    154a:	8b 15 04 28 00 00    	mov    0x2804,%edx
+    1550:	e9 72 ff ff ff       	jmp    14c7 <gets+0x17>
+    1555:	66 90                	xchg   %ax,%ax
+    1557:	66 90                	xchg   %ax,%ax
+    1559:	66 90                	xchg   %ax,%ax
+    155b:	66 90                	xchg   %ax,%ax
+    155d:	66 90                	xchg   %ax,%ax
+    155f:	90                   	nop
+
+00001560 <bigfree>:
+
+// Give a big block back to the first-fit list, and return the
+// free block that now holds it. Caller holds lock.
+static Header*
+bigfree(Header *bp)
+{
+    1560:	55                   	push   %ebp
+    1561:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1563:	a1 a4 31 00 00       	mov    0x31a4,%eax
+{
+    1568:	89 e5                	mov    %esp,%ebp
+    156a:	56                   	push   %esi
+    156b:	53                   	push   %ebx
+    156c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1570:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1572:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1574:	39 ca                	cmp    %ecx,%edx
+    1576:	73 38                	jae    15b0 <bigfree+0x50>
+    1578:	39 c1                	cmp    %eax,%ecx
+    157a:	72 04                	jb     1580 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    157c:	39 c2                	cmp    %eax,%edx
+    157e:	72 f0                	jb     1570 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1580:	8b 59 04             	mov    0x4(%ecx),%ebx
+    1583:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    1586:	39 f0                	cmp    %esi,%eax
+    1588:	74 36                	je     15c0 <bigfree+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    158a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  freep = p;
+  if(p + p->s.size == bp){
+    158c:	8b 42 04             	mov    0x4(%edx),%eax
+    158f:	89 cb                	mov    %ecx,%ebx
+  freep = p;
+    1591:	89 15 a4 31 00 00    	mov    %edx,0x31a4
+  if(p + p->s.size == bp){
+    1597:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    159a:	39 f1                	cmp    %esi,%ecx
+    159c:	74 2e                	je     15cc <bigfree+0x6c>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    159e:	89 1a                	mov    %ebx,(%edx)
+    return p;
+  }
+  p->s.ptr = bp;
+  return bp;
+}
+    15a0:	89 c8                	mov    %ecx,%eax
+    15a2:	5b                   	pop    %ebx
+    15a3:	5e                   	pop    %esi
+    15a4:	5d                   	pop    %ebp
+    15a5:	c3                   	ret
+    15a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15ad:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    15b0:	39 c1                	cmp    %eax,%ecx
+    15b2:	72 c8                	jb     157c <bigfree+0x1c>
+    15b4:	eb ba                	jmp    1570 <bigfree+0x10>
+    15b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15bd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    15c0:	03 58 04             	add    0x4(%eax),%ebx
+    15c3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    15c6:	8b 02                	mov    (%edx),%eax
+    15c8:	8b 00                	mov    (%eax),%eax
+    15ca:	eb be                	jmp    158a <bigfree+0x2a>
+    p->s.size += bp->s.size;
+    15cc:	03 41 04             	add    0x4(%ecx),%eax
+    15cf:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    15d2:	8b 19                	mov    (%ecx),%ebx
+    return p;
+    15d4:	89 d1                	mov    %edx,%ecx
+}
+    15d6:	89 c8                	mov    %ecx,%eax
+    p->s.ptr = bp->s.ptr;
+    15d8:	89 1a                	mov    %ebx,(%edx)
+}
+    15da:	5b                   	pop    %ebx
+    15db:	5e                   	pop    %esi
+    15dc:	5d                   	pop    %ebp
+    15dd:	c3                   	ret
+    15de:	66 90                	xchg   %ax,%ax
+
+000015e0 <trim>:
+// If free block bp ends the heap, return its whole pages to the
+// kernel, unless something else has moved the break since.
+// Caller holds lock.
+static void
+trim(Header *bp)
+{
+    15e0:	55                   	push   %ebp
+    15e1:	89 e5                	mov    %esp,%ebp
+    15e3:	57                   	push   %edi
+    15e4:	56                   	push   %esi
+    15e5:	53                   	push   %ebx
+    15e6:	89 c3                	mov    %eax,%ebx
+    15e8:	83 ec 0c             	sub    $0xc,%esp
+  char *end;
+  uint n;
+
+  if((char*)(bp + bp->s.size) != heapend)
+    15eb:	8b 53 04             	mov    0x4(%ebx),%edx
+    15ee:	a1 a0 31 00 00       	mov    0x31a0,%eax
+    15f3:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+    15f6:	39 d0                	cmp    %edx,%eax
+    15f8:	74 0e                	je     1608 <trim+0x28>
+  n = heapend - end;
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    bp->s.size -= n / sizeof(Header);
+    heapend = end;
+  }
+}
+    15fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15fd:	5b                   	pop    %ebx
+    15fe:	5e                   	pop    %esi
+    15ff:	5f                   	pop    %edi
+    1600:	5d                   	pop    %ebp
+    1601:	c3                   	ret
+    1602:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  end = (char*)PGROUNDUP((uint)(bp + 2));
+    1608:	8d bb 0f 10 00 00    	lea    0x100f(%ebx),%edi
+    160e:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  n = heapend - end;
+    1614:	29 f8                	sub    %edi,%eax
+    1616:	89 c6                	mov    %eax,%esi
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    1618:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    161d:	76 db                	jbe    15fa <trim+0x1a>
+    161f:	83 ec 0c             	sub    $0xc,%esp
+    1622:	6a 00                	push   $0x0
+    1624:	e8 8b ef ff ff       	call   5b4 <sbrk>
+    1629:	83 c4 10             	add    $0x10,%esp
+    162c:	39 05 a0 31 00 00    	cmp    %eax,0x31a0
+    1632:	75 c6                	jne    15fa <trim+0x1a>
+    1634:	89 f0                	mov    %esi,%eax
+    1636:	83 ec 0c             	sub    $0xc,%esp
+    1639:	f7 d8                	neg    %eax
+    163b:	50                   	push   %eax
+    163c:	e8 73 ef ff ff       	call   5b4 <sbrk>
+    1641:	83 c4 10             	add    $0x10,%esp
+    1644:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1647:	74 b1                	je     15fa <trim+0x1a>
+    bp->s.size -= n / sizeof(Header);
+    1649:	89 f0                	mov    %esi,%eax
+    heapend = end;
+    164b:	89 3d a0 31 00 00    	mov    %edi,0x31a0
+    bp->s.size -= n / sizeof(Header);
+    1651:	c1 e8 03             	shr    $0x3,%eax
+    1654:	29 43 04             	sub    %eax,0x4(%ebx)
+    heapend = end;
+    1657:	eb a1                	jmp    15fa <trim+0x1a>
+    1659:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001660 <bigalloc>:
+}
+
+// Allocate a big block of nunits units. Caller holds lock.
+static Header*
+bigalloc(uint nunits)
+{
+    1660:	55                   	push   %ebp
+    1661:	89 e5                	mov    %esp,%ebp
+    1663:	57                   	push   %edi
+    1664:	89 c7                	mov    %eax,%edi
+    1666:	56                   	push   %esi
+    1667:	53                   	push   %ebx
+    1668:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    166b:	a1 a4 31 00 00       	mov    0x31a4,%eax
+    1670:	85 c0                	test   %eax,%eax
+    1672:	0f 84 98 00 00 00    	je     1710 <bigalloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1678:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    167a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    167d:	39 f9                	cmp    %edi,%ecx
+    167f:	73 67                	jae    16e8 <bigalloc+0x88>
+  if(nu < 4096)
+    1681:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1686:	39 df                	cmp    %ebx,%edi
+    1688:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    168b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    1692:	eb 0d                	jmp    16a1 <bigalloc+0x41>
+    1694:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1698:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    169a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    169d:	39 f9                	cmp    %edi,%ecx
+    169f:	73 47                	jae    16e8 <bigalloc+0x88>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    16a1:	89 d0                	mov    %edx,%eax
+    16a3:	39 15 a4 31 00 00    	cmp    %edx,0x31a4
+    16a9:	75 ed                	jne    1698 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    16ab:	83 ec 0c             	sub    $0xc,%esp
+    16ae:	56                   	push   %esi
+    16af:	e8 00 ef ff ff       	call   5b4 <sbrk>
+  if(p == (char*)-1)
+    16b4:	83 c4 10             	add    $0x10,%esp
+    16b7:	83 f8 ff             	cmp    $0xffffffff,%eax
+    16ba:	74 1a                	je     16d6 <bigalloc+0x76>
+  hp->s.size = nu;
+    16bc:	89 58 04             	mov    %ebx,0x4(%eax)
+  heapend = p + nu * sizeof(Header);
+    16bf:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    16c2:	89 15 a0 31 00 00    	mov    %edx,0x31a0
+  bigfree(hp);
+    16c8:	e8 93 fe ff ff       	call   1560 <bigfree>
+  return freep;
+    16cd:	a1 a4 31 00 00       	mov    0x31a4,%eax
+      if((p = morecore(nunits)) == 0)
+    16d2:	85 c0                	test   %eax,%eax
+    16d4:	75 c2                	jne    1698 <bigalloc+0x38>
+        return 0;
+  }
+}
+    16d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    16d9:	31 d2                	xor    %edx,%edx
+}
+    16db:	5b                   	pop    %ebx
+    16dc:	89 d0                	mov    %edx,%eax
+    16de:	5e                   	pop    %esi
+    16df:	5f                   	pop    %edi
+    16e0:	5d                   	pop    %ebp
+    16e1:	c3                   	ret
+    16e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    16e8:	39 cf                	cmp    %ecx,%edi
+    16ea:	74 54                	je     1740 <bigalloc+0xe0>
+        p->s.size -= nunits;
+    16ec:	29 f9                	sub    %edi,%ecx
+    16ee:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    16f1:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    16f4:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    16f7:	a3 a4 31 00 00       	mov    %eax,0x31a4
+}
+    16fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    16ff:	89 d0                	mov    %edx,%eax
+    1701:	5b                   	pop    %ebx
+    1702:	5e                   	pop    %esi
+    1703:	5f                   	pop    %edi
+    1704:	5d                   	pop    %ebp
+    1705:	c3                   	ret
+    1706:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    170d:	8d 76 00             	lea    0x0(%esi),%esi
+    base.s.ptr = freep = prevp = &base;
+    1710:	c7 05 a4 31 00 00 a8 	movl   $0x31a8,0x31a4
+    1717:	31 00 00 
+    base.s.size = 0;
+    171a:	ba a8 31 00 00       	mov    $0x31a8,%edx
+    base.s.ptr = freep = prevp = &base;
+    171f:	c7 05 a8 31 00 00 a8 	movl   $0x31a8,0x31a8
+    1726:	31 00 00 
+    base.s.size = 0;
+    1729:	c7 05 ac 31 00 00 00 	movl   $0x0,0x31ac
+    1730:	00 00 00 
+    if(p->s.size >= nunits){
+    1733:	e9 49 ff ff ff       	jmp    1681 <bigalloc+0x21>
+    1738:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    173f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1740:	8b 0a                	mov    (%edx),%ecx
+    1742:	89 08                	mov    %ecx,(%eax)
+    1744:	eb b1                	jmp    16f7 <bigalloc+0x97>
+    1746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    174d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001750 <drain>:
+}
+
+// Move n blocks of class c from cache tc to the shared list.
+static void
+drain(struct tcache *tc, int c, int n)
+{
+    1750:	55                   	push   %ebp
+    1751:	89 e5                	mov    %esp,%ebp
+    1753:	57                   	push   %edi
+    1754:	89 c7                	mov    %eax,%edi
+    1756:	56                   	push   %esi
+    1757:	89 d6                	mov    %edx,%esi
+    1759:	53                   	push   %ebx
+    175a:	89 cb                	mov    %ecx,%ebx
+    175c:	83 ec 0c             	sub    $0xc,%esp
+  if(threaded)
+    175f:	8b 15 24 31 00 00    	mov    0x3124,%edx
+    1765:	85 d2                	test   %edx,%edx
+    1767:	75 57                	jne    17c0 <drain+0x70>
+  Header *p;
+
+  acquire();
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1769:	85 c9                	test   %ecx,%ecx
+    176b:	7e 49                	jle    17b6 <drain+0x66>
+    176d:	89 d9                	mov    %ebx,%ecx
+    176f:	8d 14 b7             	lea    (%edi,%esi,4),%edx
+    1772:	eb 23                	jmp    1797 <drain+0x47>
+    1774:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    tc->list[c] = p->s.ptr;
+    1778:	8b 18                	mov    (%eax),%ebx
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    177a:	83 e9 01             	sub    $0x1,%ecx
+    tc->n[c]--;
+    177d:	83 6a 20 01          	subl   $0x1,0x20(%edx)
+    tc->list[c] = p->s.ptr;
+    1781:	89 1a                	mov    %ebx,(%edx)
+    p->s.ptr = small[c];
+    1783:	8b 1c b5 80 31 00 00 	mov    0x3180(,%esi,4),%ebx
+    178a:	89 18                	mov    %ebx,(%eax)
+    small[c] = p;
+    178c:	89 04 b5 80 31 00 00 	mov    %eax,0x3180(,%esi,4)
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1793:	85 c9                	test   %ecx,%ecx
+    1795:	7e 06                	jle    179d <drain+0x4d>
+    1797:	8b 02                	mov    (%edx),%eax
+    1799:	85 c0                	test   %eax,%eax
+    179b:	75 db                	jne    1778 <drain+0x28>
+  if(threaded)
+    179d:	a1 24 31 00 00       	mov    0x3124,%eax
+    17a2:	85 c0                	test   %eax,%eax
+    17a4:	74 10                	je     17b6 <drain+0x66>
+    mutex_unlock(&lock);
+    17a6:	83 ec 0c             	sub    $0xc,%esp
+    17a9:	68 28 31 00 00       	push   $0x3128
+    17ae:	e8 1d ec ff ff       	call   3d0 <mutex_unlock>
+}
+    17b3:	83 c4 10             	add    $0x10,%esp
+  }
+  release();
+}
+    17b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    17b9:	5b                   	pop    %ebx
+    17ba:	5e                   	pop    %esi
+    17bb:	5f                   	pop    %edi
+    17bc:	5d                   	pop    %ebp
+    17bd:	c3                   	ret
+    17be:	66 90                	xchg   %ax,%ax
+    mutex_lock(&lock);
+    17c0:	83 ec 0c             	sub    $0xc,%esp
+    17c3:	68 28 31 00 00       	push   $0x3128
+    17c8:	e8 b3 eb ff ff       	call   380 <mutex_lock>
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    17cd:	83 c4 10             	add    $0x10,%esp
+    17d0:	85 db                	test   %ebx,%ebx
+    17d2:	7f 99                	jg     176d <drain+0x1d>
+    17d4:	eb c7                	jmp    179d <drain+0x4d>
+    17d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000017e0 <mycache>:
+{
+    17e0:	55                   	push   %ebp
+    return &maincache;
+    17e1:	b8 40 31 00 00       	mov    $0x3140,%eax
+{
+    17e6:	89 e5                	mov    %esp,%ebp
+    17e8:	53                   	push   %ebx
+  sp = PGROUNDDOWN((uint)&sp);
+    17e9:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+    17ec:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+    17f2:	83 ec 14             	sub    $0x14,%esp
+  if(!threaded || sp == mainstack)
+    17f5:	8b 0d 24 31 00 00    	mov    0x3124,%ecx
+  sp = PGROUNDDOWN((uint)&sp);
+    17fb:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  if(!threaded || sp == mainstack)
+    17fe:	85 c9                	test   %ecx,%ecx
+    1800:	74 0f                	je     1811 <mycache+0x31>
+    1802:	3b 1d 20 31 00 00    	cmp    0x3120,%ebx
+    1808:	74 07                	je     1811 <mycache+0x31>
+  if(*cp == 0){
+    180a:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    180d:	85 c0                	test   %eax,%eax
+    180f:	74 0f                	je     1820 <mycache+0x40>
+}
+    1811:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1814:	c9                   	leave
+    1815:	c3                   	ret
+    1816:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    181d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1820:	83 ec 0c             	sub    $0xc,%esp
+    1823:	68 28 31 00 00       	push   $0x3128
+    1828:	e8 53 eb ff ff       	call   380 <mutex_lock>
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    182d:	b8 09 00 00 00       	mov    $0x9,%eax
+    1832:	e8 29 fe ff ff       	call   1660 <bigalloc>
+  if(threaded)
+    1837:	8b 15 24 31 00 00    	mov    0x3124,%edx
+    183d:	83 c4 10             	add    $0x10,%esp
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    1840:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(threaded)
+    1843:	85 d2                	test   %edx,%edx
+    1845:	75 29                	jne    1870 <mycache+0x90>
+    if(*cp == 0)
+    1847:	85 c0                	test   %eax,%eax
+    1849:	74 c6                	je     1811 <mycache+0x31>
+    memset(*cp, 0, sizeof(**cp));
+    184b:	83 ec 04             	sub    $0x4,%esp
+    *cp = (struct tcache*)((Header*)*cp + 1);
+    184e:	83 c0 08             	add    $0x8,%eax
+    1851:	89 43 f8             	mov    %eax,-0x8(%ebx)
+    memset(*cp, 0, sizeof(**cp));
+    1854:	6a 40                	push   $0x40
+    1856:	6a 00                	push   $0x0
+    1858:	50                   	push   %eax
+    1859:	e8 f2 e9 ff ff       	call   250 <memset>
+  return *cp;
+    185e:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    1861:	83 c4 10             	add    $0x10,%esp
+    1864:	eb ab                	jmp    1811 <mycache+0x31>
+    1866:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    186d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1870:	83 ec 0c             	sub    $0xc,%esp
+    1873:	68 28 31 00 00       	push   $0x3128
+    1878:	e8 53 eb ff ff       	call   3d0 <mutex_unlock>
+    if(*cp == 0)
+    187d:	8b 43 f8             	mov    -0x8(%ebx),%eax
+}
+    1880:	83 c4 10             	add    $0x10,%esp
+    1883:	eb c2                	jmp    1847 <mycache+0x67>
+    1885:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    188c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001890 <free>:
+
+void
+free(void *ap)
+{
+    1890:	55                   	push   %ebp
+    1891:	89 e5                	mov    %esp,%ebp
+    1893:	57                   	push   %edi
+    1894:	56                   	push   %esi
+    1895:	53                   	push   %ebx
+    1896:	83 ec 1c             	sub    $0x1c,%esp
+    1899:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  struct tcache *tc;
+  int c;
+
+  if(ap == 0)
+    189c:	85 f6                	test   %esi,%esi
+    189e:	74 51                	je     18f1 <free+0x61>
+    return;
+  bp = (Header*)ap - 1;
+    18a0:	8d 46 f8             	lea    -0x8(%esi),%eax
+    18a3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(bp->s.size > SMALLMAX / sizeof(Header)){
+    18a6:	8b 46 fc             	mov    -0x4(%esi),%eax
+    18a9:	3d 00 01 00 00       	cmp    $0x100,%eax
+    18ae:	77 50                	ja     1900 <free+0x70>
+    acquire();
+    trim(bigfree(bp));
+    release();
+    return;
+  }
+  for(c = 0; (2 << c) < bp->s.size; c++)
+    18b0:	31 db                	xor    %ebx,%ebx
+    18b2:	ba 02 00 00 00       	mov    $0x2,%edx
+    18b7:	83 f8 02             	cmp    $0x2,%eax
+    18ba:	76 11                	jbe    18cd <free+0x3d>
+    18bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    18c0:	83 c3 01             	add    $0x1,%ebx
+    18c3:	89 d7                	mov    %edx,%edi
+    18c5:	89 d9                	mov    %ebx,%ecx
+    18c7:	d3 e7                	shl    %cl,%edi
+    18c9:	39 c7                	cmp    %eax,%edi
+    18cb:	72 f3                	jb     18c0 <free+0x30>
+    ;
+  if((tc = mycache()) == 0){
+    18cd:	e8 0e ff ff ff       	call   17e0 <mycache>
+    18d2:	85 c0                	test   %eax,%eax
+    18d4:	74 7a                	je     1950 <free+0xc0>
+    bp->s.ptr = small[c];
+    small[c] = bp;
+    release();
+    return;
+  }
+  bp->s.ptr = tc->list[c];
+    18d6:	8d 0c 98             	lea    (%eax,%ebx,4),%ecx
+    18d9:	8b 11                	mov    (%ecx),%edx
+    18db:	89 56 f8             	mov    %edx,-0x8(%esi)
+  tc->list[c] = bp;
+    18de:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    18e1:	89 31                	mov    %esi,(%ecx)
+  if(++tc->n[c] > TCACHEMAX)
+    18e3:	8b 71 20             	mov    0x20(%ecx),%esi
+    18e6:	8d 56 01             	lea    0x1(%esi),%edx
+    18e9:	89 51 20             	mov    %edx,0x20(%ecx)
+    18ec:	83 fa 20             	cmp    $0x20,%edx
+    18ef:	7f 47                	jg     1938 <free+0xa8>
+    drain(tc, c, BATCH);
+}
+    18f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    18f4:	5b                   	pop    %ebx
+    18f5:	5e                   	pop    %esi
+    18f6:	5f                   	pop    %edi
+    18f7:	5d                   	pop    %ebp
+    18f8:	c3                   	ret
+    18f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1900:	8b 1d 24 31 00 00    	mov    0x3124,%ebx
+    1906:	85 db                	test   %ebx,%ebx
+    1908:	75 66                	jne    1970 <free+0xe0>
+    trim(bigfree(bp));
+    190a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    190d:	e8 4e fc ff ff       	call   1560 <bigfree>
+    1912:	e8 c9 fc ff ff       	call   15e0 <trim>
+  if(threaded)
+    1917:	8b 0d 24 31 00 00    	mov    0x3124,%ecx
+    191d:	85 c9                	test   %ecx,%ecx
+    191f:	74 d0                	je     18f1 <free+0x61>
+    mutex_unlock(&lock);
+    1921:	c7 45 08 28 31 00 00 	movl   $0x3128,0x8(%ebp)
+}
+    1928:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    192b:	5b                   	pop    %ebx
+    192c:	5e                   	pop    %esi
+    192d:	5f                   	pop    %edi
+    192e:	5d                   	pop    %ebp
+    mutex_unlock(&lock);
+    192f:	e9 9c ea ff ff       	jmp    3d0 <mutex_unlock>
+    1934:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    1938:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    drain(tc, c, BATCH);
+    193b:	89 da                	mov    %ebx,%edx
+    193d:	b9 10 00 00 00       	mov    $0x10,%ecx
+}
+    1942:	5b                   	pop    %ebx
+    1943:	5e                   	pop    %esi
+    1944:	5f                   	pop    %edi
+    1945:	5d                   	pop    %ebp
+    drain(tc, c, BATCH);
+    1946:	e9 05 fe ff ff       	jmp    1750 <drain>
+    194b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    194f:	90                   	nop
+  if(threaded)
+    1950:	8b 15 24 31 00 00    	mov    0x3124,%edx
+    1956:	85 d2                	test   %edx,%edx
+    1958:	75 28                	jne    1982 <free+0xf2>
+    bp->s.ptr = small[c];
+    195a:	8b 04 9d 80 31 00 00 	mov    0x3180(,%ebx,4),%eax
+    1961:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1964:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1967:	89 04 9d 80 31 00 00 	mov    %eax,0x3180(,%ebx,4)
+  if(threaded)
+    196e:	eb 81                	jmp    18f1 <free+0x61>
+    mutex_lock(&lock);
+    1970:	83 ec 0c             	sub    $0xc,%esp
+    1973:	68 28 31 00 00       	push   $0x3128
+    1978:	e8 03 ea ff ff       	call   380 <mutex_lock>
+}
+    197d:	83 c4 10             	add    $0x10,%esp
+    1980:	eb 88                	jmp    190a <free+0x7a>
+    mutex_lock(&lock);
+    1982:	83 ec 0c             	sub    $0xc,%esp
+    1985:	68 28 31 00 00       	push   $0x3128
+    198a:	e8 f1 e9 ff ff       	call   380 <mutex_lock>
+    bp->s.ptr = small[c];
+    198f:	8b 04 9d 80 31 00 00 	mov    0x3180(,%ebx,4),%eax
+  if(threaded)
+    1996:	83 c4 10             	add    $0x10,%esp
+    bp->s.ptr = small[c];
+    1999:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    199c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    199f:	89 04 9d 80 31 00 00 	mov    %eax,0x3180(,%ebx,4)
+  if(threaded)
+    19a6:	a1 24 31 00 00       	mov    0x3124,%eax
+    19ab:	85 c0                	test   %eax,%eax
+    19ad:	0f 85 6e ff ff ff    	jne    1921 <free+0x91>
+    19b3:	e9 39 ff ff ff       	jmp    18f1 <free+0x61>
+    19b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19bf:	90                   	nop
+
+000019c0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    19c0:	55                   	push   %ebp
+    19c1:	89 e5                	mov    %esp,%ebp
+    19c3:	57                   	push   %edi
+    19c4:	56                   	push   %esi
+    19c5:	53                   	push   %ebx
+    19c6:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  struct tcache *tc;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    19c9:	8b 45 08             	mov    0x8(%ebp),%eax
+    19cc:	8d 78 07             	lea    0x7(%eax),%edi
+    19cf:	c1 ef 03             	shr    $0x3,%edi
+    19d2:	83 c7 01             	add    $0x1,%edi
+  if(nunits > SMALLMAX / sizeof(Header)){
+    19d5:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+    19db:	77 5b                	ja     1a38 <malloc+0x78>
+    acquire();
+    p = bigalloc(nunits);
+    release();
+    return p ? (void*)(p + 1) : 0;
+  }
+  for(c = 0; (2 << c) < nunits; c++)
+    19dd:	31 c9                	xor    %ecx,%ecx
+    19df:	b8 02 00 00 00       	mov    $0x2,%eax
+    19e4:	be 02 00 00 00       	mov    $0x2,%esi
+    19e9:	bb 02 00 00 00       	mov    $0x2,%ebx
+    19ee:	83 ff 02             	cmp    $0x2,%edi
+    19f1:	76 12                	jbe    1a05 <malloc+0x45>
+    19f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    19f7:	90                   	nop
+    19f8:	83 c1 01             	add    $0x1,%ecx
+    19fb:	89 c3                	mov    %eax,%ebx
+    19fd:	d3 e3                	shl    %cl,%ebx
+    19ff:	89 de                	mov    %ebx,%esi
+    1a01:	39 fb                	cmp    %edi,%ebx
+    1a03:	72 f3                	jb     19f8 <malloc+0x38>
+    1a05:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    ;
+  if((tc = mycache()) == 0)
+    1a08:	e8 d3 fd ff ff       	call   17e0 <mycache>
+    1a0d:	85 c0                	test   %eax,%eax
+    1a0f:	74 51                	je     1a62 <malloc+0xa2>
+    return 0;
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1a11:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1a14:	8d 3c 88             	lea    (%eax,%ecx,4),%edi
+    1a17:	8b 07                	mov    (%edi),%eax
+    1a19:	85 c0                	test   %eax,%eax
+    1a1b:	74 53                	je     1a70 <malloc+0xb0>
+    return 0;
+  p = tc->list[c];
+  tc->list[c] = p->s.ptr;
+  tc->n[c]--;
+    1a1d:	8b 57 20             	mov    0x20(%edi),%edx
+  tc->list[c] = p->s.ptr;
+    1a20:	8b 08                	mov    (%eax),%ecx
+  tc->n[c]--;
+    1a22:	83 ea 01             	sub    $0x1,%edx
+  return (void*)(p + 1);
+    1a25:	83 c0 08             	add    $0x8,%eax
+  tc->n[c]--;
+    1a28:	89 57 20             	mov    %edx,0x20(%edi)
+  tc->list[c] = p->s.ptr;
+    1a2b:	89 0f                	mov    %ecx,(%edi)
+}
+    1a2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a30:	5b                   	pop    %ebx
+    1a31:	5e                   	pop    %esi
+    1a32:	5f                   	pop    %edi
+    1a33:	5d                   	pop    %ebp
+    1a34:	c3                   	ret
+    1a35:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1a38:	a1 24 31 00 00       	mov    0x3124,%eax
+    1a3d:	85 c0                	test   %eax,%eax
+    1a3f:	0f 85 b3 00 00 00    	jne    1af8 <malloc+0x138>
+    p = bigalloc(nunits);
+    1a45:	89 f8                	mov    %edi,%eax
+    1a47:	e8 14 fc ff ff       	call   1660 <bigalloc>
+    1a4c:	89 c3                	mov    %eax,%ebx
+  if(threaded)
+    1a4e:	a1 24 31 00 00       	mov    0x3124,%eax
+    1a53:	85 c0                	test   %eax,%eax
+    1a55:	0f 85 85 00 00 00    	jne    1ae0 <malloc+0x120>
+    return p ? (void*)(p + 1) : 0;
+    1a5b:	8d 43 08             	lea    0x8(%ebx),%eax
+    1a5e:	85 db                	test   %ebx,%ebx
+    1a60:	75 cb                	jne    1a2d <malloc+0x6d>
+    1a62:	31 c0                	xor    %eax,%eax
+}
+    1a64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a67:	5b                   	pop    %ebx
+    1a68:	5e                   	pop    %esi
+    1a69:	5f                   	pop    %edi
+    1a6a:	5d                   	pop    %ebp
+    1a6b:	c3                   	ret
+    1a6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1a70:	a1 24 31 00 00       	mov    0x3124,%eax
+    1a75:	85 c0                	test   %eax,%eax
+    1a77:	0f 85 29 01 00 00    	jne    1ba6 <malloc+0x1e6>
+  if(small[c] == 0){
+    1a7d:	8b 04 8d 80 31 00 00 	mov    0x3180(,%ecx,4),%eax
+    1a84:	85 c0                	test   %eax,%eax
+    1a86:	0f 84 81 00 00 00    	je     1b0d <malloc+0x14d>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1a8c:	31 db                	xor    %ebx,%ebx
+    1a8e:	eb 22                	jmp    1ab2 <malloc+0xf2>
+    small[c] = p->s.ptr;
+    1a90:	8b 10                	mov    (%eax),%edx
+  for(moved = 0; moved < n && small[c]; moved++){
+    1a92:	83 c3 01             	add    $0x1,%ebx
+    small[c] = p->s.ptr;
+    1a95:	89 14 8d 80 31 00 00 	mov    %edx,0x3180(,%ecx,4)
+    p->s.ptr = tc->list[c];
+    1a9c:	8b 17                	mov    (%edi),%edx
+    1a9e:	89 10                	mov    %edx,(%eax)
+    tc->list[c] = p;
+    1aa0:	89 07                	mov    %eax,(%edi)
+  for(moved = 0; moved < n && small[c]; moved++){
+    1aa2:	83 fb 10             	cmp    $0x10,%ebx
+    1aa5:	0f 84 e2 00 00 00    	je     1b8d <malloc+0x1cd>
+    1aab:	8b 04 8d 80 31 00 00 	mov    0x3180(,%ecx,4),%eax
+    1ab2:	85 c0                	test   %eax,%eax
+    1ab4:	75 da                	jne    1a90 <malloc+0xd0>
+  if(threaded)
+    1ab6:	8b 15 24 31 00 00    	mov    0x3124,%edx
+    1abc:	85 d2                	test   %edx,%edx
+    1abe:	0f 85 b4 00 00 00    	jne    1b78 <malloc+0x1b8>
+  tc->n[c] += moved;
+    1ac4:	8b 57 20             	mov    0x20(%edi),%edx
+    1ac7:	01 da                	add    %ebx,%edx
+    1ac9:	89 57 20             	mov    %edx,0x20(%edi)
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1acc:	85 db                	test   %ebx,%ebx
+    1ace:	74 92                	je     1a62 <malloc+0xa2>
+  p = tc->list[c];
+    1ad0:	8b 07                	mov    (%edi),%eax
+    1ad2:	e9 49 ff ff ff       	jmp    1a20 <malloc+0x60>
+    1ad7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ade:	66 90                	xchg   %ax,%ax
+    mutex_unlock(&lock);
+    1ae0:	83 ec 0c             	sub    $0xc,%esp
+    1ae3:	68 28 31 00 00       	push   $0x3128
+    1ae8:	e8 e3 e8 ff ff       	call   3d0 <mutex_unlock>
+}
+    1aed:	83 c4 10             	add    $0x10,%esp
+    1af0:	e9 66 ff ff ff       	jmp    1a5b <malloc+0x9b>
+    1af5:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1af8:	83 ec 0c             	sub    $0xc,%esp
+    1afb:	68 28 31 00 00       	push   $0x3128
+    1b00:	e8 7b e8 ff ff       	call   380 <mutex_lock>
+}
+    1b05:	83 c4 10             	add    $0x10,%esp
+    1b08:	e9 38 ff ff ff       	jmp    1a45 <malloc+0x85>
+    if((chunk = bigalloc(CHUNK / sizeof(Header) + 1)) == 0){
+    1b0d:	b8 01 02 00 00       	mov    $0x201,%eax
+    1b12:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1b15:	e8 46 fb ff ff       	call   1660 <bigalloc>
+    1b1a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1b1d:	85 c0                	test   %eax,%eax
+    1b1f:	89 c2                	mov    %eax,%edx
+    1b21:	0f 84 ba 00 00 00    	je     1be1 <malloc+0x221>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1b27:	83 c2 08             	add    $0x8,%edx
+    1b2a:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+    1b30:	0f 87 d0 00 00 00    	ja     1c06 <malloc+0x246>
+    1b36:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+    1b3d:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    1b40:	89 df                	mov    %ebx,%edi
+    1b42:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1b45:	8d 76 00             	lea    0x0(%esi),%esi
+      p->s.size = units;
+    1b48:	89 72 04             	mov    %esi,0x4(%edx)
+      p->s.ptr = small[c];
+    1b4b:	8b 04 8d 80 31 00 00 	mov    0x3180(,%ecx,4),%eax
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1b52:	01 df                	add    %ebx,%edi
+    1b54:	89 55 e0             	mov    %edx,-0x20(%ebp)
+      p->s.ptr = small[c];
+    1b57:	89 02                	mov    %eax,(%edx)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1b59:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      small[c] = p;
+    1b5c:	89 14 8d 80 31 00 00 	mov    %edx,0x3180(,%ecx,4)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1b63:	01 c2                	add    %eax,%edx
+    1b65:	81 ff 00 02 00 00    	cmp    $0x200,%edi
+    1b6b:	76 db                	jbe    1b48 <malloc+0x188>
+    1b6d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1b70:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1b73:	e9 14 ff ff ff       	jmp    1a8c <malloc+0xcc>
+    mutex_unlock(&lock);
+    1b78:	83 ec 0c             	sub    $0xc,%esp
+    1b7b:	68 28 31 00 00       	push   $0x3128
+    1b80:	e8 4b e8 ff ff       	call   3d0 <mutex_unlock>
+}
+    1b85:	83 c4 10             	add    $0x10,%esp
+    1b88:	e9 37 ff ff ff       	jmp    1ac4 <malloc+0x104>
+  if(threaded)
+    1b8d:	a1 24 31 00 00       	mov    0x3124,%eax
+    1b92:	85 c0                	test   %eax,%eax
+    1b94:	75 2b                	jne    1bc1 <malloc+0x201>
+  tc->n[c] += moved;
+    1b96:	8b 47 20             	mov    0x20(%edi),%eax
+    1b99:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1b9c:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1b9e:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1ba1:	e9 7a fe ff ff       	jmp    1a20 <malloc+0x60>
+    mutex_lock(&lock);
+    1ba6:	83 ec 0c             	sub    $0xc,%esp
+    1ba9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1bac:	68 28 31 00 00       	push   $0x3128
+    1bb1:	e8 ca e7 ff ff       	call   380 <mutex_lock>
+}
+    1bb6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1bb9:	83 c4 10             	add    $0x10,%esp
+    1bbc:	e9 bc fe ff ff       	jmp    1a7d <malloc+0xbd>
+    mutex_unlock(&lock);
+    1bc1:	83 ec 0c             	sub    $0xc,%esp
+    1bc4:	68 28 31 00 00       	push   $0x3128
+    1bc9:	e8 02 e8 ff ff       	call   3d0 <mutex_unlock>
+  tc->n[c] += moved;
+    1bce:	8b 47 20             	mov    0x20(%edi),%eax
+    1bd1:	83 c4 10             	add    $0x10,%esp
+    1bd4:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1bd7:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1bd9:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1bdc:	e9 3f fe ff ff       	jmp    1a20 <malloc+0x60>
+  if(threaded)
+    1be1:	8b 0d 24 31 00 00    	mov    0x3124,%ecx
+    1be7:	85 c9                	test   %ecx,%ecx
+    1be9:	0f 84 73 fe ff ff    	je     1a62 <malloc+0xa2>
+    mutex_unlock(&lock);
+    1bef:	83 ec 0c             	sub    $0xc,%esp
+    1bf2:	68 28 31 00 00       	push   $0x3128
+    1bf7:	e8 d4 e7 ff ff       	call   3d0 <mutex_unlock>
+    1bfc:	83 c4 10             	add    $0x10,%esp
+    return p ? (void*)(p + 1) : 0;
+    1bff:	31 c0                	xor    %eax,%eax
+    1c01:	e9 5e fe ff ff       	jmp    1a64 <malloc+0xa4>
+  for(moved = 0; moved < n && small[c]; moved++){
+    1c06:	8b 04 8d 80 31 00 00 	mov    0x3180(,%ecx,4),%eax
+    1c0d:	e9 7a fe ff ff       	jmp    1a8c <malloc+0xcc>
+    1c12:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001c20 <malloc_threaded>:
+void
+malloc_threaded(void)
+{
+  uint sp;
+
+  if(threaded)
+    1c20:	a1 24 31 00 00       	mov    0x3124,%eax
+    1c25:	85 c0                	test   %eax,%eax
+    1c27:	74 07                	je     1c30 <malloc_threaded+0x10>
+    1c29:	c3                   	ret
+    1c2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+{
+    1c30:	55                   	push   %ebp
+    1c31:	89 e5                	mov    %esp,%ebp
+    1c33:	83 ec 24             	sub    $0x24,%esp
+    return;
+  mutex_init(&lock);
+    1c36:	68 28 31 00 00       	push   $0x3128
+    1c3b:	e8 30 e7 ff ff       	call   370 <mutex_init>
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1c40:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1c43:	83 c4 10             	add    $0x10,%esp
+  threaded = 1;
+    1c46:	c7 05 24 31 00 00 01 	movl   $0x1,0x3124
+    1c4d:	00 00 00 
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1c50:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    1c55:	a3 20 31 00 00       	mov    %eax,0x3120
+}
+    1c5a:	c9                   	leave
+    1c5b:	c3                   	ret
+    1c5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001c60 <malloc_thread_exit>:
+
+// Called by thread_join() with the cache slot of a finished
+// thread: give its blocks, and the cache itself, back.
+void
+malloc_thread_exit(void **cachep)
+{
+    1c60:	55                   	push   %ebp
+    1c61:	89 e5                	mov    %esp,%ebp
+    1c63:	57                   	push   %edi
+    1c64:	56                   	push   %esi
+    1c65:	53                   	push   %ebx
+    1c66:	83 ec 0c             	sub    $0xc,%esp
+    1c69:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct tcache *tc;
+  int c;
+
+  if((tc = *cachep) == 0)
+    1c6c:	8b 37                	mov    (%edi),%esi
+    1c6e:	85 f6                	test   %esi,%esi
+    1c70:	74 41                	je     1cb3 <malloc_thread_exit+0x53>
+    return;
+  for(c = 0; c < NCLASS; c++)
+    1c72:	31 db                	xor    %ebx,%ebx
+    1c74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    drain(tc, c, tc->n[c]);
+    1c78:	8b 4c 9e 20          	mov    0x20(%esi,%ebx,4),%ecx
+    1c7c:	89 da                	mov    %ebx,%edx
+    1c7e:	89 f0                	mov    %esi,%eax
+  for(c = 0; c < NCLASS; c++)
+    1c80:	83 c3 01             	add    $0x1,%ebx
+    drain(tc, c, tc->n[c]);
+    1c83:	e8 c8 fa ff ff       	call   1750 <drain>
+  for(c = 0; c < NCLASS; c++)
+    1c88:	83 fb 08             	cmp    $0x8,%ebx
+    1c8b:	75 eb                	jne    1c78 <malloc_thread_exit+0x18>
+  if(threaded)
+    1c8d:	8b 15 24 31 00 00    	mov    0x3124,%edx
+    1c93:	85 d2                	test   %edx,%edx
+    1c95:	75 29                	jne    1cc0 <malloc_thread_exit+0x60>
+  acquire();
+  trim(bigfree((Header*)tc - 1));
+    1c97:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1c9a:	e8 c1 f8 ff ff       	call   1560 <bigfree>
+    1c9f:	e8 3c f9 ff ff       	call   15e0 <trim>
+  if(threaded)
+    1ca4:	a1 24 31 00 00       	mov    0x3124,%eax
+    1ca9:	85 c0                	test   %eax,%eax
+    1cab:	75 2b                	jne    1cd8 <malloc_thread_exit+0x78>
+  release();
+  *cachep = 0;
+    1cad:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+}
+    1cb3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1cb6:	5b                   	pop    %ebx
+    1cb7:	5e                   	pop    %esi
+    1cb8:	5f                   	pop    %edi
+    1cb9:	5d                   	pop    %ebp
+    1cba:	c3                   	ret
+    1cbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1cbf:	90                   	nop
+    mutex_lock(&lock);
+    1cc0:	83 ec 0c             	sub    $0xc,%esp
+    1cc3:	68 28 31 00 00       	push   $0x3128
+    1cc8:	e8 b3 e6 ff ff       	call   380 <mutex_lock>
+}
+    1ccd:	83 c4 10             	add    $0x10,%esp
+    1cd0:	eb c5                	jmp    1c97 <malloc_thread_exit+0x37>
+    1cd2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1cd8:	83 ec 0c             	sub    $0xc,%esp
+    1cdb:	68 28 31 00 00       	push   $0x3128
+    1ce0:	e8 eb e6 ff ff       	call   3d0 <mutex_unlock>
+}
+    1ce5:	83 c4 10             	add    $0x10,%esp
+    1ce8:	eb c3                	jmp    1cad <malloc_thread_exit+0x4d>
+    1cea:	66 90                	xchg   %ax,%ax
+    1cec:	66 90                	xchg   %ax,%ax
+    1cee:	66 90                	xchg   %ax,%ax
+
+00001cf0 <thread_create>:
+
+// Start fn(arg) in a new thread on a freshly allocated
+// page-aligned stack.  Returns the thread's pid.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1cf0:	55                   	push   %ebp
+    1cf1:	89 e5                	mov    %esp,%ebp
+    1cf3:	53                   	push   %ebx
+    1cf4:	83 ec 14             	sub    $0x14,%esp
+  char *mem, *stack;
+  int pid;
+
+  malloc_threaded();
+    1cf7:	e8 24 ff ff ff       	call   1c20 <malloc_threaded>
+  stdio_threaded();
+    1cfc:	e8 cf ee ff ff       	call   bd0 <stdio_threaded>
+  if((mem = malloc(2*PGSIZE)) == 0)
+    1d01:	83 ec 0c             	sub    $0xc,%esp
+    1d04:	68 00 20 00 00       	push   $0x2000
+    1d09:	e8 b2 fc ff ff       	call   19c0 <malloc>
+    1d0e:	83 c4 10             	add    $0x10,%esp
+    1d11:	85 c0                	test   %eax,%eax
+    1d13:	74 52                	je     1d67 <thread_create+0x77>
+    1d15:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1d17:	8d 80 07 10 00 00    	lea    0x1007(%eax),%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+  ((char**)stack)[-2] = 0;
+  if((pid = clone(fn, arg, stack)) < 0)
+    1d1d:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1d20:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+    1d25:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  ((char**)stack)[-2] = 0;
+    1d28:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+  if((pid = clone(fn, arg, stack)) < 0)
+    1d2f:	50                   	push   %eax
+    1d30:	ff 75 0c             	push   0xc(%ebp)
+    1d33:	ff 75 08             	push   0x8(%ebp)
+    1d36:	e8 97 e8 ff ff       	call   5d2 <clone>
+    1d3b:	83 c4 10             	add    $0x10,%esp
+    1d3e:	85 c0                	test   %eax,%eax
+    1d40:	78 0e                	js     1d50 <thread_create+0x60>
+    free(mem);
+  return pid;
+}
+    1d42:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1d45:	c9                   	leave
+    1d46:	c3                   	ret
+    1d47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d4e:	66 90                	xchg   %ax,%ax
+    free(mem);
+    1d50:	83 ec 0c             	sub    $0xc,%esp
+    1d53:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1d56:	53                   	push   %ebx
+    1d57:	e8 34 fb ff ff       	call   1890 <free>
+    1d5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1d5f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    1d62:	83 c4 10             	add    $0x10,%esp
+}
+    1d65:	c9                   	leave
+    1d66:	c3                   	ret
+    return -1;
+    1d67:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1d6c:	eb d4                	jmp    1d42 <thread_create+0x52>
+    1d6e:	66 90                	xchg   %ax,%ax
+
+00001d70 <thread_join>:
+
+// Wait for a thread to finish and free its stack.
+int
+thread_join(void)
+{
+    1d70:	55                   	push   %ebp
+    1d71:	89 e5                	mov    %esp,%ebp
+    1d73:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    1d74:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    1d77:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    1d7a:	50                   	push   %eax
+    1d7b:	e8 61 e8 ff ff       	call   5e1 <join>
+    1d80:	83 c4 10             	add    $0x10,%esp
+    1d83:	85 c0                	test   %eax,%eax
+    1d85:	78 29                	js     1db0 <thread_join+0x40>
+    1d87:	89 c3                	mov    %eax,%ebx
+    return -1;
+  malloc_thread_exit(&((void**)stack)[-2]);
+    1d89:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1d8c:	83 ec 0c             	sub    $0xc,%esp
+    1d8f:	83 e8 08             	sub    $0x8,%eax
+    1d92:	50                   	push   %eax
+    1d93:	e8 c8 fe ff ff       	call   1c60 <malloc_thread_exit>
+  free(((char**)stack)[-1]);
+    1d98:	58                   	pop    %eax
+    1d99:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1d9c:	ff 70 fc             	push   -0x4(%eax)
+    1d9f:	e8 ec fa ff ff       	call   1890 <free>
+  return pid;
+    1da4:	83 c4 10             	add    $0x10,%esp
+}
+    1da7:	89 d8                	mov    %ebx,%eax
+    1da9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1dac:	c9                   	leave
+    1dad:	c3                   	ret
+    1dae:	66 90                	xchg   %ax,%ax
+    return -1;
+    1db0:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    1db5:	eb f0                	jmp    1da7 <thread_join+0x37>
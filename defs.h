@@ -2,19 +2,27 @@ struct buf;
 struct context;
 struct file;
 struct inode;
+struct iovec;
+struct kmem_cache;
+struct lockstat;
 struct pipe;
 struct proc;
 struct rtcdate;
+struct sample;
+struct scstat;
 struct spinlock;
 struct sleeplock;
 struct stat;
 struct superblock;
+struct trapframe;
 
 // bio.c
 void binit(void);
 
 struct buf *bread(uint, uint);
 
+struct buf *bgetw(uint, uint);
+
 void brelse(struct buf *);
 
 void bwrite(struct buf *);
@@ -42,10 +50,29 @@ void fileinit(void);
 
 int fileread(struct file *, char *, int n);
 
+int filereadv(struct file *, struct iovec *, int, int);
+
 int filestat(struct file *, struct stat *);
 
 int filewrite(struct file *, char *, int n);
 
+int filewritev(struct file *, struct iovec *, int, int);
+
+// fpu.c
+void fpuinit(void);
+
+void fpuenable(void);
+
+void fpufault(void);
+
+void fpusave(struct proc *);
+
+int fpufork(struct proc *);
+
+void fpuexec(void);
+
+void fpufree(struct proc *);
+
 // fs.c
 void readsb(int dev, struct superblock *sb);
 
@@ -61,6 +88,8 @@ void iinit(int dev);
 
 void ilock(struct inode *);
 
+void ilockshared(struct inode *);
+
 void iput(struct inode *);
 
 void iunlock(struct inode *);
@@ -104,6 +133,16 @@ void kinit1(void *, void *);
 
 void kinit2(void *, void *);
 
+char *kzalloc(void);
+
+char *khugealloc(void);
+
+void khugefree(char *);
+
+int kzeroidle(void);
+
+int kfreecount(void);
+
 // kbd.c
 void kbdintr(void);
 
@@ -120,6 +159,12 @@ void lapicinit(void);
 
 void lapicstartap(uchar, uint);
 
+void lapicipi(int, int);
+
+void lapiconeshot(int);
+
+void lapicperiodic(void);
+
 void microdelay(int);
 
 // log.c
@@ -131,6 +176,23 @@ void begin_op();
 
 void end_op();
 
+// mmap.c
+void mmapinit(void);
+
+int mmap(uint, int, int, struct file *, uint);
+
+int munmap(uint, uint);
+
+void munmapall(void);
+
+int mmapfork(struct proc *);
+
+int mmapclone(struct proc *);
+
+int mmapfault(uint, uint);
+
+int mmapprefault(uint, uint, int);
+
 // mp.c
 extern int ismp;
 
@@ -142,6 +204,8 @@ void picenable(int);
 void picinit(void);
 
 // pipe.c
+void pipeinit(void);
+
 int pipealloc(struct file **, struct file **);
 
 void pipeclose(struct pipe *, int);
@@ -150,32 +214,65 @@ int piperead(struct pipe *, char *, int);
 
 int pipewrite(struct pipe *, char *, int);
 
+int pipesplice(struct pipe *, char *, int);
+
+// prof.c
+void profinit(void);
+
+void proftick(struct trapframe *);
+
+void profstart(void);
+
+int profstop(void);
+
+int profread(struct sample *, int);
+
 //PAGEBREAK: 16
 // proc.c
+int clone(void (*)(void *), void *, char *);
+
 int cpuid(void);
 
 void exit(void);
 
 int fork(void);
 
-int growproc(int);
+int futexwait(int *, int);
+
+int futexwake(int *, int);
+
+int growproc(int, int);
+
+int join(char **);
 
 int kill(int);
 
 struct cpu *mycpu(void);
 
+int pgdirshared(struct proc *);
+
+void tlbshootdown(pde_t *);
+
+void kthread(void (*)(void), char *);
+
+int swapscan(char **, uint *, int);
+
 struct proc *myproc();
 
 void pinit(void);
 
 void procdump(void);
 
+int procscstat(int, struct scstat *, int);
+
 void scheduler(void) __attribute__((noreturn));
 
 void sched(void);
 
 void setproc(struct proc *);
 
+pde_t *setpgdir(struct proc *, pde_t *);
+
 void sleep(void *, struct spinlock *);
 
 void userinit(void);
@@ -193,12 +290,22 @@ void swtch(struct context **, struct context *);
 // spinlock.c
 void acquire(struct spinlock *);
 
+void freelock(struct spinlock *);
+
 void getcallerpcs(void *, uint *);
 
+int getlockstats(struct lockstat *, int);
+
 int holding(struct spinlock *);
 
 void initlock(struct spinlock *, char *);
 
+void initlockstat(struct spinlock *, char *, struct lockstat **);
+
+void initticketlock(struct spinlock *, char *);
+
+int lockhammer(int, int);
+
 void release(struct spinlock *);
 
 void pushcli(void);
@@ -210,10 +317,23 @@ void acquiresleep(struct sleeplock *);
 
 void releasesleep(struct sleeplock *);
 
+void acquiresleepshared(struct sleeplock *);
+
+void releasesleepshared(struct sleeplock *);
+
 int holdingsleep(struct sleeplock *);
 
 void initsleeplock(struct sleeplock *, char *);
 
+void freesleeplock(struct sleeplock *);
+
+// slab.c
+void *kmem_cache_alloc(struct kmem_cache *);
+
+struct kmem_cache *kmem_cache_create(char *, uint, void (*)(void *), void (*)(void *));
+
+void kmem_cache_free(struct kmem_cache *, void *);
+
 // string.c
 int memcmp(const void *, const void *, uint);
 
@@ -229,25 +349,58 @@ int strncmp(const char *, const char *, uint);
 
 char *strncpy(char *, const char *, int);
 
+void stringtest(void);
+
 // syscall.c
 int argint(int, int *);
 
 int argptr(int, char **, int);
 
+int argptrw(int, char **, int);
+
 int argstr(int, char **);
 
+int fetchbuf(uint, int, int);
+
 int fetchint(uint, int *);
 
 int fetchstr(uint, char **);
 
+int getscstats(int, struct scstat *, int);
+
 void syscall(void);
 
+// swap.c
+void swapinit(int);
+
+int swapalloc(void);
+
+void swapfree(uint);
+
+void swapread(uint, char *);
+
+int swapwait(int);
+
+int swapin(pde_t *, uint);
+
+int swapfault(uint);
+
+int swapinrange(pde_t *, uint, uint);
+
 // timer.c
+void timerexpire(void);
+
+void timeridle(void);
+
 void timerinit(void);
 
+int timersleep(int);
+
 // trap.c
 void idtinit(void);
 
+void sysenterinit(void);
+
 extern uint ticks;
 
 void tvinit(void);
@@ -261,6 +414,13 @@ void uartintr(void);
 
 void uartputc(int);
 
+// vdso.c
+void vdsoinit(void);
+
+int vdsomap(pde_t *);
+
+void vdsotick(uint);
+
 // vm.c
 void seginit(void);
 
@@ -272,8 +432,12 @@ char *uva2ka(pde_t *, char *);
 
 int allocuvm(pde_t *, uint, uint);
 
+int allocuvmhuge(pde_t *, uint, uint);
+
 int deallocuvm(pde_t *, uint, uint);
 
+void revokeuvm(pde_t *, uint, uint);
+
 void freevm(pde_t *);
 
 void inituvm(pde_t *, char *, uint);
@@ -286,9 +450,17 @@ void switchuvm(struct proc *);
 
 void switchkvm(void);
 
+void pgeinit(void);
+
 int copyout(pde_t *, uint, void *, uint);
 
 void clearpteu(pde_t *pgdir, char *uva);
 
+char *remapupage(pde_t *, char *, char *);
+
+pte_t *walkpgdir(pde_t *, const void *, int);
+
+int mappages(pde_t *, void *, uint, uint, int);
+
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))//用于计算数组的元素个数。
@@ -0,0 +1,3976 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 08             	sub    $0x8,%esp
+      14:	8b 31                	mov    (%ecx),%esi
+      16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  for(i = 1; i < argc; i++)
+      19:	83 fe 01             	cmp    $0x1,%esi
+      1c:	7e 47                	jle    65 <main+0x65>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+      1e:	8b 47 04             	mov    0x4(%edi),%eax
+      21:	83 fe 02             	cmp    $0x2,%esi
+      24:	74 2a                	je     50 <main+0x50>
+      26:	bb 02 00 00 00       	mov    $0x2,%ebx
+      2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      2f:	90                   	nop
+      30:	68 18 1d 00 00       	push   $0x1d18
+      35:	83 c3 01             	add    $0x1,%ebx
+      38:	50                   	push   %eax
+      39:	68 1a 1d 00 00       	push   $0x1d1a
+      3e:	6a 01                	push   $0x1
+      40:	e8 4b 08 00 00       	call   890 <printf>
+      45:	8b 44 9f fc          	mov    -0x4(%edi,%ebx,4),%eax
+      49:	83 c4 10             	add    $0x10,%esp
+      4c:	39 f3                	cmp    %esi,%ebx
+      4e:	75 e0                	jne    30 <main+0x30>
+      50:	68 1f 1d 00 00       	push   $0x1d1f
+      55:	50                   	push   %eax
+      56:	68 1a 1d 00 00       	push   $0x1d1a
+      5b:	6a 01                	push   $0x1
+      5d:	e8 2e 08 00 00       	call   890 <printf>
+      62:	83 c4 10             	add    $0x10,%esp
+  exit();
+      65:	e8 66 00 00 00       	call   d0 <exit>
+      6a:	66 90                	xchg   %ax,%ax
+      6c:	66 90                	xchg   %ax,%ax
+      6e:	66 90                	xchg   %ax,%ax
+
+00000070 <fork>:
+int sysexit(void) __attribute__((noreturn));
+
+int
+fork(void)
+{
+  if(flushhook)
+      70:	a1 e0 27 00 00       	mov    0x27e0,%eax
+      75:	85 c0                	test   %eax,%eax
+      77:	74 17                	je     90 <fork+0x20>
+{
+      79:	55                   	push   %ebp
+      7a:	89 e5                	mov    %esp,%ebp
+      7c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+      7f:	ff d0                	call   *%eax
+  return sysfork();
+}
+      81:	c9                   	leave
+  return sysfork();
+      82:	e9 7f 03 00 00       	jmp    406 <sysfork>
+      87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      8e:	66 90                	xchg   %ax,%ax
+      90:	e9 71 03 00 00       	jmp    406 <sysfork>
+      95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000a0 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+      a0:	55                   	push   %ebp
+  if(flushhook)
+      a1:	a1 e0 27 00 00       	mov    0x27e0,%eax
+{
+      a6:	89 e5                	mov    %esp,%ebp
+      a8:	56                   	push   %esi
+      a9:	53                   	push   %ebx
+      aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+      ad:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+      b0:	85 c0                	test   %eax,%eax
+      b2:	74 02                	je     b6 <exec+0x16>
+    flushhook();
+      b4:	ff d0                	call   *%eax
+  return sysexec(path, argv);
+      b6:	89 75 0c             	mov    %esi,0xc(%ebp)
+      b9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+      bc:	5b                   	pop    %ebx
+      bd:	5e                   	pop    %esi
+      be:	5d                   	pop    %ebp
+  return sysexec(path, argv);
+      bf:	e9 ba 03 00 00       	jmp    47e <sysexec>
+      c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      cf:	90                   	nop
+
+000000d0 <exit>:
+
+int
+exit(void)
+{
+      d0:	55                   	push   %ebp
+      d1:	89 e5                	mov    %esp,%ebp
+      d3:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+      d6:	a1 e0 27 00 00       	mov    0x27e0,%eax
+      db:	85 c0                	test   %eax,%eax
+      dd:	74 02                	je     e1 <exit+0x11>
+    flushhook();
+      df:	ff d0                	call   *%eax
+  sysexit();
+      e1:	e8 2f 03 00 00       	call   415 <sysexit>
+      e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000f0 <strcpy>:
+}
+
+char*
+strcpy(char *s, const char *t)
+{
+      f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+      f1:	31 c0                	xor    %eax,%eax
+{
+      f3:	89 e5                	mov    %esp,%ebp
+      f5:	53                   	push   %ebx
+      f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+      fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     100:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     104:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     107:	83 c0 01             	add    $0x1,%eax
+     10a:	84 d2                	test   %dl,%dl
+     10c:	75 f2                	jne    100 <strcpy+0x10>
+    ;
+  return os;
+}
+     10e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     111:	89 c8                	mov    %ecx,%eax
+     113:	c9                   	leave
+     114:	c3                   	ret
+     115:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     11c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000120 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     120:	55                   	push   %ebp
+     121:	89 e5                	mov    %esp,%ebp
+     123:	53                   	push   %ebx
+     124:	8b 55 08             	mov    0x8(%ebp),%edx
+     127:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     12a:	0f b6 02             	movzbl (%edx),%eax
+     12d:	84 c0                	test   %al,%al
+     12f:	75 17                	jne    148 <strcmp+0x28>
+     131:	eb 3a                	jmp    16d <strcmp+0x4d>
+     133:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     137:	90                   	nop
+     138:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     13c:	83 c2 01             	add    $0x1,%edx
+     13f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     142:	84 c0                	test   %al,%al
+     144:	74 1a                	je     160 <strcmp+0x40>
+    p++, q++;
+     146:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     148:	0f b6 19             	movzbl (%ecx),%ebx
+     14b:	38 c3                	cmp    %al,%bl
+     14d:	74 e9                	je     138 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     14f:	29 d8                	sub    %ebx,%eax
+}
+     151:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     154:	c9                   	leave
+     155:	c3                   	ret
+     156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     15d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     160:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     164:	31 c0                	xor    %eax,%eax
+     166:	29 d8                	sub    %ebx,%eax
+}
+     168:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     16b:	c9                   	leave
+     16c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     16d:	0f b6 19             	movzbl (%ecx),%ebx
+     170:	31 c0                	xor    %eax,%eax
+     172:	eb db                	jmp    14f <strcmp+0x2f>
+     174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     17b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     17f:	90                   	nop
+
+00000180 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     180:	55                   	push   %ebp
+     181:	89 e5                	mov    %esp,%ebp
+     183:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     186:	80 3a 00             	cmpb   $0x0,(%edx)
+     189:	74 15                	je     1a0 <strlen+0x20>
+     18b:	31 c0                	xor    %eax,%eax
+     18d:	8d 76 00             	lea    0x0(%esi),%esi
+     190:	83 c0 01             	add    $0x1,%eax
+     193:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     197:	89 c1                	mov    %eax,%ecx
+     199:	75 f5                	jne    190 <strlen+0x10>
+    ;
+  return n;
+}
+     19b:	89 c8                	mov    %ecx,%eax
+     19d:	5d                   	pop    %ebp
+     19e:	c3                   	ret
+     19f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     1a0:	31 c9                	xor    %ecx,%ecx
+}
+     1a2:	5d                   	pop    %ebp
+     1a3:	89 c8                	mov    %ecx,%eax
+     1a5:	c3                   	ret
+     1a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     1b0:	55                   	push   %ebp
+     1b1:	89 e5                	mov    %esp,%ebp
+     1b3:	57                   	push   %edi
+     1b4:	8b 55 08             	mov    0x8(%ebp),%edx
+            "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt) {
+    asm volatile("cld; rep stosb" :
+     1b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     1ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+     1bd:	89 d7                	mov    %edx,%edi
+     1bf:	fc                   	cld
+     1c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     1c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     1c5:	89 d0                	mov    %edx,%eax
+     1c7:	c9                   	leave
+     1c8:	c3                   	ret
+     1c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     1d0:	55                   	push   %ebp
+     1d1:	89 e5                	mov    %esp,%ebp
+     1d3:	8b 45 08             	mov    0x8(%ebp),%eax
+     1d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     1da:	0f b6 10             	movzbl (%eax),%edx
+     1dd:	84 d2                	test   %dl,%dl
+     1df:	75 12                	jne    1f3 <strchr+0x23>
+     1e1:	eb 1d                	jmp    200 <strchr+0x30>
+     1e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1e7:	90                   	nop
+     1e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     1ec:	83 c0 01             	add    $0x1,%eax
+     1ef:	84 d2                	test   %dl,%dl
+     1f1:	74 0d                	je     200 <strchr+0x30>
+    if(*s == c)
+     1f3:	38 d1                	cmp    %dl,%cl
+     1f5:	75 f1                	jne    1e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     1f7:	5d                   	pop    %ebp
+     1f8:	c3                   	ret
+     1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     200:	31 c0                	xor    %eax,%eax
+}
+     202:	5d                   	pop    %ebp
+     203:	c3                   	ret
+     204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     20b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     20f:	90                   	nop
+
+00000210 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     210:	55                   	push   %ebp
+     211:	89 e5                	mov    %esp,%ebp
+     213:	56                   	push   %esi
+     214:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     215:	83 ec 08             	sub    $0x8,%esp
+     218:	6a 00                	push   $0x0
+     21a:	ff 75 08             	push   0x8(%ebp)
+     21d:	e8 6b 02 00 00       	call   48d <open>
+  if(fd < 0)
+     222:	83 c4 10             	add    $0x10,%esp
+     225:	85 c0                	test   %eax,%eax
+     227:	78 27                	js     250 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     229:	83 ec 08             	sub    $0x8,%esp
+     22c:	ff 75 0c             	push   0xc(%ebp)
+     22f:	89 c3                	mov    %eax,%ebx
+     231:	50                   	push   %eax
+     232:	e8 83 02 00 00       	call   4ba <fstat>
+  close(fd);
+     237:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     23a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     23c:	e8 1f 02 00 00       	call   460 <close>
+  return r;
+     241:	83 c4 10             	add    $0x10,%esp
+}
+     244:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     247:	89 f0                	mov    %esi,%eax
+     249:	5b                   	pop    %ebx
+     24a:	5e                   	pop    %esi
+     24b:	5d                   	pop    %ebp
+     24c:	c3                   	ret
+     24d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     250:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     255:	eb ed                	jmp    244 <stat+0x34>
+     257:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     25e:	66 90                	xchg   %ax,%ax
+
+00000260 <atoi>:
+
+int
+atoi(const char *s)
+{
+     260:	55                   	push   %ebp
+     261:	89 e5                	mov    %esp,%ebp
+     263:	53                   	push   %ebx
+     264:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     267:	0f be 02             	movsbl (%edx),%eax
+     26a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     26d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     270:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     275:	77 1e                	ja     295 <atoi+0x35>
+     277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     27e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     280:	83 c2 01             	add    $0x1,%edx
+     283:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     286:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     28a:	0f be 02             	movsbl (%edx),%eax
+     28d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     290:	80 fb 09             	cmp    $0x9,%bl
+     293:	76 eb                	jbe    280 <atoi+0x20>
+  return n;
+}
+     295:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     298:	89 c8                	mov    %ecx,%eax
+     29a:	c9                   	leave
+     29b:	c3                   	ret
+     29c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     2a0:	55                   	push   %ebp
+     2a1:	89 e5                	mov    %esp,%ebp
+     2a3:	57                   	push   %edi
+     2a4:	56                   	push   %esi
+     2a5:	8b 45 10             	mov    0x10(%ebp),%eax
+     2a8:	8b 55 08             	mov    0x8(%ebp),%edx
+     2ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     2ae:	85 c0                	test   %eax,%eax
+     2b0:	7e 13                	jle    2c5 <memmove+0x25>
+     2b2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     2b4:	89 d7                	mov    %edx,%edi
+     2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2bd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     2c0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     2c1:	39 f8                	cmp    %edi,%eax
+     2c3:	75 fb                	jne    2c0 <memmove+0x20>
+  return vdst;
+}
+     2c5:	5e                   	pop    %esi
+     2c6:	89 d0                	mov    %edx,%eax
+     2c8:	5f                   	pop    %edi
+     2c9:	5d                   	pop    %ebp
+     2ca:	c3                   	ret
+     2cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2cf:	90                   	nop
+
+000002d0 <mutex_init>:
+
+// Futex-based mutex (Drepper, "Futexes Are Tricky", mutex 2).
+// The uncontended paths never enter the kernel.
+void
+mutex_init(struct mutex *m)
+{
+     2d0:	55                   	push   %ebp
+     2d1:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+     2d3:	8b 45 08             	mov    0x8(%ebp),%eax
+     2d6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     2dc:	5d                   	pop    %ebp
+     2dd:	c3                   	ret
+     2de:	66 90                	xchg   %ax,%ax
+
+000002e0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     2e0:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     2e1:	31 c0                	xor    %eax,%eax
+     2e3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+     2e8:	89 e5                	mov    %esp,%ebp
+     2ea:	56                   	push   %esi
+     2eb:	53                   	push   %ebx
+     2ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     2ef:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     2f3:	85 c0                	test   %eax,%eax
+     2f5:	74 32                	je     329 <mutex_lock+0x49>
+    return;
+  if(c != 2)
+     2f7:	83 f8 02             	cmp    $0x2,%eax
+     2fa:	74 0c                	je     308 <mutex_lock+0x28>
+static inline uint
+xchg(volatile uint *addr, uint newval) {
+    uint result;
+
+    // The + in "+m" denotes a read-modify-write operand.
+    asm volatile("lock; xchgl %0, %1" :
+     2fc:	b8 02 00 00 00       	mov    $0x2,%eax
+     301:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+     304:	85 c0                	test   %eax,%eax
+     306:	74 21                	je     329 <mutex_lock+0x49>
+     308:	be 02 00 00 00       	mov    $0x2,%esi
+     30d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAIT, 2);
+     310:	83 ec 04             	sub    $0x4,%esp
+     313:	6a 02                	push   $0x2
+     315:	6a 00                	push   $0x0
+     317:	53                   	push   %ebx
+     318:	e8 33 02 00 00       	call   550 <futex>
+     31d:	89 f0                	mov    %esi,%eax
+     31f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     322:	83 c4 10             	add    $0x10,%esp
+     325:	85 c0                	test   %eax,%eax
+     327:	75 e7                	jne    310 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+     329:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     32c:	5b                   	pop    %ebx
+     32d:	5e                   	pop    %esi
+     32e:	5d                   	pop    %ebp
+     32f:	c3                   	ret
+
+00000330 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     330:	55                   	push   %ebp
+     331:	89 e5                	mov    %esp,%ebp
+     333:	83 ec 08             	sub    $0x8,%esp
+     336:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     339:	f0 83 28 01          	lock subl $0x1,(%eax)
+     33d:	75 09                	jne    348 <mutex_unlock+0x18>
+    m->val = 0;
+    futex(&m->val, FUTEX_WAKE, 1);
+  }
+}
+     33f:	c9                   	leave
+     340:	c3                   	ret
+     341:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     348:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     34b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex(&m->val, FUTEX_WAKE, 1);
+     351:	6a 01                	push   $0x1
+     353:	6a 01                	push   $0x1
+     355:	50                   	push   %eax
+     356:	e8 f5 01 00 00       	call   550 <futex>
+     35b:	83 c4 10             	add    $0x10,%esp
+}
+     35e:	c9                   	leave
+     35f:	c3                   	ret
+
+00000360 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     360:	55                   	push   %ebp
+     361:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     363:	8b 45 08             	mov    0x8(%ebp),%eax
+     366:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     36c:	5d                   	pop    %ebp
+     36d:	c3                   	ret
+     36e:	66 90                	xchg   %ax,%ax
+
+00000370 <cond_wait>:
+
+// Release m and wait for a signal, then reacquire m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     370:	55                   	push   %ebp
+     371:	89 e5                	mov    %esp,%ebp
+     373:	57                   	push   %edi
+     374:	56                   	push   %esi
+     375:	53                   	push   %ebx
+     376:	83 ec 0c             	sub    $0xc,%esp
+     379:	8b 75 08             	mov    0x8(%ebp),%esi
+     37c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     37f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     381:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+     385:	75 21                	jne    3a8 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     387:	83 ec 04             	sub    $0x4,%esp
+     38a:	57                   	push   %edi
+     38b:	6a 00                	push   $0x0
+     38d:	56                   	push   %esi
+     38e:	e8 bd 01 00 00       	call   550 <futex>
+  mutex_lock(m);
+     393:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     396:	83 c4 10             	add    $0x10,%esp
+}
+     399:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     39c:	5b                   	pop    %ebx
+     39d:	5e                   	pop    %esi
+     39e:	5f                   	pop    %edi
+     39f:	5d                   	pop    %ebp
+  mutex_lock(m);
+     3a0:	e9 3b ff ff ff       	jmp    2e0 <mutex_lock>
+     3a5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     3a8:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     3ab:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex(&m->val, FUTEX_WAKE, 1);
+     3b1:	6a 01                	push   $0x1
+     3b3:	6a 01                	push   $0x1
+     3b5:	53                   	push   %ebx
+     3b6:	e8 95 01 00 00       	call   550 <futex>
+     3bb:	83 c4 10             	add    $0x10,%esp
+     3be:	eb c7                	jmp    387 <cond_wait+0x17>
+
+000003c0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+     3c0:	55                   	push   %ebp
+     3c1:	89 e5                	mov    %esp,%ebp
+     3c3:	83 ec 0c             	sub    $0xc,%esp
+     3c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     3c9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+     3cd:	6a 01                	push   $0x1
+     3cf:	6a 01                	push   $0x1
+     3d1:	50                   	push   %eax
+     3d2:	e8 79 01 00 00       	call   550 <futex>
+}
+     3d7:	83 c4 10             	add    $0x10,%esp
+     3da:	c9                   	leave
+     3db:	c3                   	ret
+     3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     3e0:	55                   	push   %ebp
+     3e1:	89 e5                	mov    %esp,%ebp
+     3e3:	83 ec 0c             	sub    $0xc,%esp
+     3e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     3e9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+     3ed:	6a 40                	push   $0x40
+     3ef:	6a 01                	push   $0x1
+     3f1:	50                   	push   %eax
+     3f2:	e8 59 01 00 00       	call   550 <futex>
+}
+     3f7:	83 c4 10             	add    $0x10,%esp
+     3fa:	c9                   	leave
+     3fb:	c3                   	ret
+     3fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000400 <uptime>:
+// Clock ticks since boot, read from the kernel's vdso page
+// without a system call.
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     400:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+     405:	c3                   	ret
+
+00000406 <sysfork>:
+  1: ret
+
+#define SYSCALL(name) SYSCALLAS(name, name)
+
+// ulib.c wraps these.
+SYSCALLAS(sysfork, fork)
+     406:	b8 01 00 00 00       	mov    $0x1,%eax
+     40b:	89 e1                	mov    %esp,%ecx
+     40d:	ba 14 04 00 00       	mov    $0x414,%edx
+     412:	0f 34                	sysenter
+     414:	c3                   	ret
+
+00000415 <sysexit>:
+SYSCALLAS(sysexit, exit)
+     415:	b8 02 00 00 00       	mov    $0x2,%eax
+     41a:	89 e1                	mov    %esp,%ecx
+     41c:	ba 23 04 00 00       	mov    $0x423,%edx
+     421:	0f 34                	sysenter
+     423:	c3                   	ret
+
+00000424 <wait>:
+SYSCALL(wait)
+     424:	b8 03 00 00 00       	mov    $0x3,%eax
+     429:	89 e1                	mov    %esp,%ecx
+     42b:	ba 32 04 00 00       	mov    $0x432,%edx
+     430:	0f 34                	sysenter
+     432:	c3                   	ret
+
+00000433 <pipe>:
+SYSCALL(pipe)
+     433:	b8 04 00 00 00       	mov    $0x4,%eax
+     438:	89 e1                	mov    %esp,%ecx
+     43a:	ba 41 04 00 00       	mov    $0x441,%edx
+     43f:	0f 34                	sysenter
+     441:	c3                   	ret
+
+00000442 <read>:
+SYSCALL(read)
+     442:	b8 05 00 00 00       	mov    $0x5,%eax
+     447:	89 e1                	mov    %esp,%ecx
+     449:	ba 50 04 00 00       	mov    $0x450,%edx
+     44e:	0f 34                	sysenter
+     450:	c3                   	ret
+
+00000451 <write>:
+SYSCALL(write)
+     451:	b8 10 00 00 00       	mov    $0x10,%eax
+     456:	89 e1                	mov    %esp,%ecx
+     458:	ba 5f 04 00 00       	mov    $0x45f,%edx
+     45d:	0f 34                	sysenter
+     45f:	c3                   	ret
+
+00000460 <close>:
+SYSCALL(close)
+     460:	b8 15 00 00 00       	mov    $0x15,%eax
+     465:	89 e1                	mov    %esp,%ecx
+     467:	ba 6e 04 00 00       	mov    $0x46e,%edx
+     46c:	0f 34                	sysenter
+     46e:	c3                   	ret
+
+0000046f <kill>:
+SYSCALL(kill)
+     46f:	b8 06 00 00 00       	mov    $0x6,%eax
+     474:	89 e1                	mov    %esp,%ecx
+     476:	ba 7d 04 00 00       	mov    $0x47d,%edx
+     47b:	0f 34                	sysenter
+     47d:	c3                   	ret
+
+0000047e <sysexec>:
+SYSCALLAS(sysexec, exec)
+     47e:	b8 07 00 00 00       	mov    $0x7,%eax
+     483:	89 e1                	mov    %esp,%ecx
+     485:	ba 8c 04 00 00       	mov    $0x48c,%edx
+     48a:	0f 34                	sysenter
+     48c:	c3                   	ret
+
+0000048d <open>:
+SYSCALL(open)
+     48d:	b8 0f 00 00 00       	mov    $0xf,%eax
+     492:	89 e1                	mov    %esp,%ecx
+     494:	ba 9b 04 00 00       	mov    $0x49b,%edx
+     499:	0f 34                	sysenter
+     49b:	c3                   	ret
+
+0000049c <mknod>:
+SYSCALL(mknod)
+     49c:	b8 11 00 00 00       	mov    $0x11,%eax
+     4a1:	89 e1                	mov    %esp,%ecx
+     4a3:	ba aa 04 00 00       	mov    $0x4aa,%edx
+     4a8:	0f 34                	sysenter
+     4aa:	c3                   	ret
+
+000004ab <unlink>:
+SYSCALL(unlink)
+     4ab:	b8 12 00 00 00       	mov    $0x12,%eax
+     4b0:	89 e1                	mov    %esp,%ecx
+     4b2:	ba b9 04 00 00       	mov    $0x4b9,%edx
+     4b7:	0f 34                	sysenter
+     4b9:	c3                   	ret
+
+000004ba <fstat>:
+SYSCALL(fstat)
+     4ba:	b8 08 00 00 00       	mov    $0x8,%eax
+     4bf:	89 e1                	mov    %esp,%ecx
+     4c1:	ba c8 04 00 00       	mov    $0x4c8,%edx
+     4c6:	0f 34                	sysenter
+     4c8:	c3                   	ret
+
+000004c9 <link>:
+SYSCALL(link)
+     4c9:	b8 13 00 00 00       	mov    $0x13,%eax
+     4ce:	89 e1                	mov    %esp,%ecx
+     4d0:	ba d7 04 00 00       	mov    $0x4d7,%edx
+     4d5:	0f 34                	sysenter
+     4d7:	c3                   	ret
+
+000004d8 <mkdir>:
+SYSCALL(mkdir)
+     4d8:	b8 14 00 00 00       	mov    $0x14,%eax
+     4dd:	89 e1                	mov    %esp,%ecx
+     4df:	ba e6 04 00 00       	mov    $0x4e6,%edx
+     4e4:	0f 34                	sysenter
+     4e6:	c3                   	ret
+
+000004e7 <chdir>:
+SYSCALL(chdir)
+     4e7:	b8 09 00 00 00       	mov    $0x9,%eax
+     4ec:	89 e1                	mov    %esp,%ecx
+     4ee:	ba f5 04 00 00       	mov    $0x4f5,%edx
+     4f3:	0f 34                	sysenter
+     4f5:	c3                   	ret
+
+000004f6 <dup>:
+SYSCALL(dup)
+     4f6:	b8 0a 00 00 00       	mov    $0xa,%eax
+     4fb:	89 e1                	mov    %esp,%ecx
+     4fd:	ba 04 05 00 00       	mov    $0x504,%edx
+     502:	0f 34                	sysenter
+     504:	c3                   	ret
+
+00000505 <getpid>:
+SYSCALL(getpid)
+     505:	b8 0b 00 00 00       	mov    $0xb,%eax
+     50a:	89 e1                	mov    %esp,%ecx
+     50c:	ba 13 05 00 00       	mov    $0x513,%edx
+     511:	0f 34                	sysenter
+     513:	c3                   	ret
+
+00000514 <sbrk>:
+SYSCALL(sbrk)
+     514:	b8 0c 00 00 00       	mov    $0xc,%eax
+     519:	89 e1                	mov    %esp,%ecx
+     51b:	ba 22 05 00 00       	mov    $0x522,%edx
+     520:	0f 34                	sysenter
+     522:	c3                   	ret
+
+00000523 <sleep>:
+SYSCALL(sleep)
+     523:	b8 0d 00 00 00       	mov    $0xd,%eax
+     528:	89 e1                	mov    %esp,%ecx
+     52a:	ba 31 05 00 00       	mov    $0x531,%edx
+     52f:	0f 34                	sysenter
+     531:	c3                   	ret
+
+00000532 <clone>:
+SYSCALL(clone)
+     532:	b8 16 00 00 00       	mov    $0x16,%eax
+     537:	89 e1                	mov    %esp,%ecx
+     539:	ba 40 05 00 00       	mov    $0x540,%edx
+     53e:	0f 34                	sysenter
+     540:	c3                   	ret
+
+00000541 <join>:
+SYSCALL(join)
+     541:	b8 17 00 00 00       	mov    $0x17,%eax
+     546:	89 e1                	mov    %esp,%ecx
+     548:	ba 4f 05 00 00       	mov    $0x54f,%edx
+     54d:	0f 34                	sysenter
+     54f:	c3                   	ret
+
+00000550 <futex>:
+SYSCALL(futex)
+     550:	b8 18 00 00 00       	mov    $0x18,%eax
+     555:	89 e1                	mov    %esp,%ecx
+     557:	ba 5e 05 00 00       	mov    $0x55e,%edx
+     55c:	0f 34                	sysenter
+     55e:	c3                   	ret
+
+0000055f <yield>:
+SYSCALL(yield)
+     55f:	b8 19 00 00 00       	mov    $0x19,%eax
+     564:	89 e1                	mov    %esp,%ecx
+     566:	ba 6d 05 00 00       	mov    $0x56d,%edx
+     56b:	0f 34                	sysenter
+     56d:	c3                   	ret
+
+0000056e <lockstat>:
+SYSCALL(lockstat)
+     56e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     573:	89 e1                	mov    %esp,%ecx
+     575:	ba 7c 05 00 00       	mov    $0x57c,%edx
+     57a:	0f 34                	sysenter
+     57c:	c3                   	ret
+
+0000057d <lockhammer>:
+SYSCALL(lockhammer)
+     57d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     582:	89 e1                	mov    %esp,%ecx
+     584:	ba 8b 05 00 00       	mov    $0x58b,%edx
+     589:	0f 34                	sysenter
+     58b:	c3                   	ret
+
+0000058c <vmsplice>:
+SYSCALL(vmsplice)
+     58c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     591:	89 e1                	mov    %esp,%ecx
+     593:	ba 9a 05 00 00       	mov    $0x59a,%edx
+     598:	0f 34                	sysenter
+     59a:	c3                   	ret
+
+0000059b <hsbrk>:
+SYSCALL(hsbrk)
+     59b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     5a0:	89 e1                	mov    %esp,%ecx
+     5a2:	ba a9 05 00 00       	mov    $0x5a9,%edx
+     5a7:	0f 34                	sysenter
+     5a9:	c3                   	ret
+
+000005aa <mmap>:
+SYSCALL(mmap)
+     5aa:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     5af:	89 e1                	mov    %esp,%ecx
+     5b1:	ba b8 05 00 00       	mov    $0x5b8,%edx
+     5b6:	0f 34                	sysenter
+     5b8:	c3                   	ret
+
+000005b9 <munmap>:
+SYSCALL(munmap)
+     5b9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     5be:	89 e1                	mov    %esp,%ecx
+     5c0:	ba c7 05 00 00       	mov    $0x5c7,%edx
+     5c5:	0f 34                	sysenter
+     5c7:	c3                   	ret
+
+000005c8 <ringenter>:
+SYSCALL(ringenter)
+     5c8:	b8 20 00 00 00       	mov    $0x20,%eax
+     5cd:	89 e1                	mov    %esp,%ecx
+     5cf:	ba d6 05 00 00       	mov    $0x5d6,%edx
+     5d4:	0f 34                	sysenter
+     5d6:	c3                   	ret
+
+000005d7 <readv>:
+SYSCALL(readv)
+     5d7:	b8 21 00 00 00       	mov    $0x21,%eax
+     5dc:	89 e1                	mov    %esp,%ecx
+     5de:	ba e5 05 00 00       	mov    $0x5e5,%edx
+     5e3:	0f 34                	sysenter
+     5e5:	c3                   	ret
+
+000005e6 <writev>:
+SYSCALL(writev)
+     5e6:	b8 22 00 00 00       	mov    $0x22,%eax
+     5eb:	89 e1                	mov    %esp,%ecx
+     5ed:	ba f4 05 00 00       	mov    $0x5f4,%edx
+     5f2:	0f 34                	sysenter
+     5f4:	c3                   	ret
+
+000005f5 <pread>:
+SYSCALL(pread)
+     5f5:	b8 23 00 00 00       	mov    $0x23,%eax
+     5fa:	89 e1                	mov    %esp,%ecx
+     5fc:	ba 03 06 00 00       	mov    $0x603,%edx
+     601:	0f 34                	sysenter
+     603:	c3                   	ret
+
+00000604 <pwrite>:
+SYSCALL(pwrite)
+     604:	b8 24 00 00 00       	mov    $0x24,%eax
+     609:	89 e1                	mov    %esp,%ecx
+     60b:	ba 12 06 00 00       	mov    $0x612,%edx
+     610:	0f 34                	sysenter
+     612:	c3                   	ret
+
+00000613 <prof>:
+SYSCALL(prof)
+     613:	b8 25 00 00 00       	mov    $0x25,%eax
+     618:	89 e1                	mov    %esp,%ecx
+     61a:	ba 21 06 00 00       	mov    $0x621,%edx
+     61f:	0f 34                	sysenter
+     621:	c3                   	ret
+
+00000622 <scstat>:
+SYSCALL(scstat)
+     622:	b8 26 00 00 00       	mov    $0x26,%eax
+     627:	89 e1                	mov    %esp,%ecx
+     629:	ba 30 06 00 00       	mov    $0x630,%edx
+     62e:	0f 34                	sysenter
+     630:	c3                   	ret
+     631:	66 90                	xchg   %ax,%ax
+     633:	66 90                	xchg   %ax,%ax
+     635:	66 90                	xchg   %ax,%ax
+     637:	66 90                	xchg   %ax,%ax
+     639:	66 90                	xchg   %ax,%ax
+     63b:	66 90                	xchg   %ax,%ax
+     63d:	66 90                	xchg   %ax,%ax
+     63f:	90                   	nop
+
+00000640 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+     640:	55                   	push   %ebp
+     641:	89 e5                	mov    %esp,%ebp
+     643:	57                   	push   %edi
+     644:	56                   	push   %esi
+     645:	53                   	push   %ebx
+     646:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     648:	89 d1                	mov    %edx,%ecx
+{
+     64a:	83 ec 2c             	sub    $0x2c,%esp
+     64d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+     650:	85 d2                	test   %edx,%edx
+     652:	79 7c                	jns    6d0 <printint+0x90>
+     654:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     658:	74 76                	je     6d0 <printint+0x90>
+    x = -xx;
+     65a:	f7 d9                	neg    %ecx
+    neg = 1;
+     65c:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     661:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     664:	31 f6                	xor    %esi,%esi
+     666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     66d:	8d 76 00             	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     670:	89 c8                	mov    %ecx,%eax
+     672:	31 d2                	xor    %edx,%edx
+     674:	89 f7                	mov    %esi,%edi
+     676:	f7 f3                	div    %ebx
+     678:	8d 76 01             	lea    0x1(%esi),%esi
+     67b:	0f b6 92 80 1d 00 00 	movzbl 0x1d80(%edx),%edx
+     682:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     686:	89 ca                	mov    %ecx,%edx
+     688:	89 c1                	mov    %eax,%ecx
+     68a:	39 da                	cmp    %ebx,%edx
+     68c:	73 e2                	jae    670 <printint+0x30>
+  if(neg)
+     68e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     691:	85 c0                	test   %eax,%eax
+     693:	74 07                	je     69c <printint+0x5c>
+    buf[i++] = '-';
+     695:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     69a:	89 f7                	mov    %esi,%edi
+     69c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     69f:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     6a2:	01 df                	add    %ebx,%edi
+     6a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc_unlocked(buf[i], f);
+     6a8:	83 ec 08             	sub    $0x8,%esp
+     6ab:	56                   	push   %esi
+     6ac:	0f be 07             	movsbl (%edi),%eax
+     6af:	50                   	push   %eax
+     6b0:	e8 cb 07 00 00       	call   e80 <putc_unlocked>
+  while(--i >= 0)
+     6b5:	89 f8                	mov    %edi,%eax
+     6b7:	83 c4 10             	add    $0x10,%esp
+     6ba:	83 ef 01             	sub    $0x1,%edi
+     6bd:	39 d8                	cmp    %ebx,%eax
+     6bf:	75 e7                	jne    6a8 <printint+0x68>
+}
+     6c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6c4:	5b                   	pop    %ebx
+     6c5:	5e                   	pop    %esi
+     6c6:	5f                   	pop    %edi
+     6c7:	5d                   	pop    %ebp
+     6c8:	c3                   	ret
+     6c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     6d0:	31 c0                	xor    %eax,%eax
+     6d2:	eb 8d                	jmp    661 <printint+0x21>
+     6d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6df:	90                   	nop
+
+000006e0 <vfprintf>:
+
+// Print to the given stream, which the caller has locked.
+// Only understands %d, %x, %p, %s.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+     6e0:	55                   	push   %ebp
+     6e1:	89 e5                	mov    %esp,%ebp
+     6e3:	57                   	push   %edi
+     6e4:	56                   	push   %esi
+     6e5:	53                   	push   %ebx
+     6e6:	83 ec 1c             	sub    $0x1c,%esp
+     6e9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     6ec:	0f b6 0a             	movzbl (%edx),%ecx
+     6ef:	84 c9                	test   %cl,%cl
+     6f1:	74 5c                	je     74f <vfprintf+0x6f>
+     6f3:	89 c6                	mov    %eax,%esi
+     6f5:	8d 5a 01             	lea    0x1(%edx),%ebx
+     6f8:	31 ff                	xor    %edi,%edi
+     6fa:	eb 20                	jmp    71c <vfprintf+0x3c>
+     6fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     700:	83 f9 25             	cmp    $0x25,%ecx
+     703:	74 3b                	je     740 <vfprintf+0x60>
+        state = '%';
+      } else {
+        putc_unlocked(c, f);
+     705:	83 ec 08             	sub    $0x8,%esp
+     708:	56                   	push   %esi
+     709:	51                   	push   %ecx
+     70a:	e8 71 07 00 00       	call   e80 <putc_unlocked>
+     70f:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     712:	0f b6 0b             	movzbl (%ebx),%ecx
+     715:	83 c3 01             	add    $0x1,%ebx
+     718:	84 c9                	test   %cl,%cl
+     71a:	74 33                	je     74f <vfprintf+0x6f>
+    if(state == 0){
+     71c:	85 ff                	test   %edi,%edi
+     71e:	74 e0                	je     700 <vfprintf+0x20>
+      }
+    } else if(state == '%'){
+     720:	83 ff 25             	cmp    $0x25,%edi
+     723:	75 ed                	jne    712 <vfprintf+0x32>
+      if(c == 'd'){
+     725:	83 f9 25             	cmp    $0x25,%ecx
+     728:	0f 84 02 01 00 00    	je     830 <vfprintf+0x150>
+     72e:	8d 41 9d             	lea    -0x63(%ecx),%eax
+     731:	83 f8 15             	cmp    $0x15,%eax
+     734:	77 2a                	ja     760 <vfprintf+0x80>
+     736:	ff 24 85 28 1d 00 00 	jmp    *0x1d28(,%eax,4)
+     73d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     740:	0f b6 0b             	movzbl (%ebx),%ecx
+     743:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     746:	bf 25 00 00 00       	mov    $0x25,%edi
+  for(i = 0; fmt[i]; i++){
+     74b:	84 c9                	test   %cl,%cl
+     74d:	75 cd                	jne    71c <vfprintf+0x3c>
+        putc_unlocked(c, f);
+      }
+      state = 0;
+    }
+  }
+}
+     74f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     752:	5b                   	pop    %ebx
+     753:	5e                   	pop    %esi
+     754:	5f                   	pop    %edi
+     755:	5d                   	pop    %ebp
+     756:	c3                   	ret
+     757:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     75e:	66 90                	xchg   %ax,%ax
+        putc_unlocked('%', f);
+     760:	83 ec 08             	sub    $0x8,%esp
+     763:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     766:	56                   	push   %esi
+     767:	6a 25                	push   $0x25
+     769:	e8 12 07 00 00       	call   e80 <putc_unlocked>
+        putc_unlocked(c, f);
+     76e:	58                   	pop    %eax
+     76f:	5a                   	pop    %edx
+     770:	56                   	push   %esi
+     771:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     774:	51                   	push   %ecx
+     775:	e8 06 07 00 00       	call   e80 <putc_unlocked>
+     77a:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     77d:	31 ff                	xor    %edi,%edi
+     77f:	eb 91                	jmp    712 <vfprintf+0x32>
+     781:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+     788:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     78b:	83 ec 0c             	sub    $0xc,%esp
+     78e:	b9 10 00 00 00       	mov    $0x10,%ecx
+     793:	8b 17                	mov    (%edi),%edx
+     795:	6a 00                	push   $0x0
+        ap++;
+     797:	83 c7 04             	add    $0x4,%edi
+        printint(f, *ap, 16, 0);
+     79a:	89 f0                	mov    %esi,%eax
+     79c:	e8 9f fe ff ff       	call   640 <printint>
+        ap++;
+     7a1:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     7a4:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     7a7:	31 ff                	xor    %edi,%edi
+     7a9:	e9 64 ff ff ff       	jmp    712 <vfprintf+0x32>
+     7ae:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     7b0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     7b3:	8b 10                	mov    (%eax),%edx
+        ap++;
+     7b5:	83 c0 04             	add    $0x4,%eax
+     7b8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     7bb:	85 d2                	test   %edx,%edx
+     7bd:	0f 84 85 00 00 00    	je     848 <vfprintf+0x168>
+        while(*s != 0){
+     7c3:	0f be 02             	movsbl (%edx),%eax
+        s = (char*)*ap;
+     7c6:	89 d7                	mov    %edx,%edi
+        while(*s != 0){
+     7c8:	84 c0                	test   %al,%al
+     7ca:	74 b1                	je     77d <vfprintf+0x9d>
+     7cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+          putc_unlocked(*s, f);
+     7d0:	83 ec 08             	sub    $0x8,%esp
+          s++;
+     7d3:	83 c7 01             	add    $0x1,%edi
+          putc_unlocked(*s, f);
+     7d6:	56                   	push   %esi
+     7d7:	50                   	push   %eax
+     7d8:	e8 a3 06 00 00       	call   e80 <putc_unlocked>
+        while(*s != 0){
+     7dd:	0f be 07             	movsbl (%edi),%eax
+     7e0:	83 c4 10             	add    $0x10,%esp
+     7e3:	84 c0                	test   %al,%al
+     7e5:	75 e9                	jne    7d0 <vfprintf+0xf0>
+      state = 0;
+     7e7:	31 ff                	xor    %edi,%edi
+     7e9:	e9 24 ff ff ff       	jmp    712 <vfprintf+0x32>
+     7ee:	66 90                	xchg   %ax,%ax
+        printint(f, *ap, 10, 1);
+     7f0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     7f3:	83 ec 0c             	sub    $0xc,%esp
+     7f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     7fb:	8b 17                	mov    (%edi),%edx
+     7fd:	6a 01                	push   $0x1
+     7ff:	eb 96                	jmp    797 <vfprintf+0xb7>
+     801:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc_unlocked(*ap, f);
+     808:	83 ec 08             	sub    $0x8,%esp
+     80b:	56                   	push   %esi
+     80c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     80f:	ff 37                	push   (%edi)
+     811:	e8 6a 06 00 00       	call   e80 <putc_unlocked>
+        ap++;
+     816:	89 f8                	mov    %edi,%eax
+     818:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     81b:	31 ff                	xor    %edi,%edi
+        ap++;
+     81d:	83 c0 04             	add    $0x4,%eax
+     820:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     823:	e9 ea fe ff ff       	jmp    712 <vfprintf+0x32>
+     828:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     82f:	90                   	nop
+        putc_unlocked(c, f);
+     830:	83 ec 08             	sub    $0x8,%esp
+      state = 0;
+     833:	31 ff                	xor    %edi,%edi
+        putc_unlocked(c, f);
+     835:	56                   	push   %esi
+     836:	6a 25                	push   $0x25
+     838:	e8 43 06 00 00       	call   e80 <putc_unlocked>
+     83d:	83 c4 10             	add    $0x10,%esp
+     840:	e9 cd fe ff ff       	jmp    712 <vfprintf+0x32>
+     845:	8d 76 00             	lea    0x0(%esi),%esi
+     848:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     84d:	bf 21 1d 00 00       	mov    $0x1d21,%edi
+     852:	e9 79 ff ff ff       	jmp    7d0 <vfprintf+0xf0>
+     857:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     85e:	66 90                	xchg   %ax,%ax
+
+00000860 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+     860:	55                   	push   %ebp
+     861:	89 e5                	mov    %esp,%ebp
+     863:	53                   	push   %ebx
+     864:	83 ec 10             	sub    $0x10,%esp
+     867:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  flockfile(f);
+     86a:	53                   	push   %ebx
+     86b:	e8 d0 02 00 00       	call   b40 <flockfile>
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     870:	8b 55 0c             	mov    0xc(%ebp),%edx
+     873:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     876:	89 d8                	mov    %ebx,%eax
+     878:	e8 63 fe ff ff       	call   6e0 <vfprintf>
+  funlockfile(f);
+     87d:	89 1c 24             	mov    %ebx,(%esp)
+     880:	e8 eb 02 00 00       	call   b70 <funlockfile>
+}
+     885:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     888:	83 c4 10             	add    $0x10,%esp
+     88b:	c9                   	leave
+     88c:	c3                   	ret
+     88d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000890 <printf>:
+
+// Print to the given fd: through stdout or stderr for 1 and 2,
+// otherwise with one write() per call.
+void
+printf(int fd, const char *fmt, ...)
+{
+     890:	55                   	push   %ebp
+     891:	89 e5                	mov    %esp,%ebp
+     893:	56                   	push   %esi
+     894:	53                   	push   %ebx
+     895:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+     89b:	8b 45 08             	mov    0x8(%ebp),%eax
+  char buf[128];
+  struct iobuf f;
+
+  if(fd == 1 || fd == 2){
+    flockfile(&_iob[fd]);
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     89e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(fd == 1 || fd == 2){
+     8a1:	8d 50 ff             	lea    -0x1(%eax),%edx
+     8a4:	83 fa 01             	cmp    $0x1,%edx
+     8a7:	76 77                	jbe    920 <printf+0x90>
+    funlockfile(&_iob[fd]);
+    return;
+  }
+  f.fd = fd;
+     8a9:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  f.flags = IO_WRITE|IO_SETUP;
+  f.buf = buf;
+     8af:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  f.size = sizeof(buf);
+  f.r = f.n = 0;
+  mutex_init(&f.lock);
+     8b5:	83 ec 0c             	sub    $0xc,%esp
+     8b8:	8d 9d 5c ff ff ff    	lea    -0xa4(%ebp),%ebx
+  f.buf = buf;
+     8be:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+  mutex_init(&f.lock);
+     8c4:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  f.flags = IO_WRITE|IO_SETUP;
+     8ca:	c7 85 60 ff ff ff 42 	movl   $0x42,-0xa0(%ebp)
+     8d1:	00 00 00 
+  f.size = sizeof(buf);
+     8d4:	c7 85 68 ff ff ff 80 	movl   $0x80,-0x98(%ebp)
+     8db:	00 00 00 
+  f.r = f.n = 0;
+     8de:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+     8e5:	00 00 00 
+     8e8:	c7 85 6c ff ff ff 00 	movl   $0x0,-0x94(%ebp)
+     8ef:	00 00 00 
+  mutex_init(&f.lock);
+     8f2:	50                   	push   %eax
+     8f3:	e8 d8 f9 ff ff       	call   2d0 <mutex_init>
+  vfprintf(&f, fmt, (uint*)(void*)&fmt + 1);
+     8f8:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     8fb:	89 f2                	mov    %esi,%edx
+     8fd:	89 d8                	mov    %ebx,%eax
+     8ff:	e8 dc fd ff ff       	call   6e0 <vfprintf>
+  fflush(&f);
+     904:	89 1c 24             	mov    %ebx,(%esp)
+     907:	e8 f4 04 00 00       	call   e00 <fflush>
+     90c:	83 c4 10             	add    $0x10,%esp
+}
+     90f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     912:	5b                   	pop    %ebx
+     913:	5e                   	pop    %esi
+     914:	5d                   	pop    %ebp
+     915:	c3                   	ret
+     916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     91d:	8d 76 00             	lea    0x0(%esi),%esi
+    flockfile(&_iob[fd]);
+     920:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     923:	83 ec 0c             	sub    $0xc,%esp
+     926:	8d 98 00 27 00 00    	lea    0x2700(%eax),%ebx
+     92c:	53                   	push   %ebx
+     92d:	e8 0e 02 00 00       	call   b40 <flockfile>
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     932:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     935:	89 f2                	mov    %esi,%edx
+     937:	89 d8                	mov    %ebx,%eax
+     939:	e8 a2 fd ff ff       	call   6e0 <vfprintf>
+    funlockfile(&_iob[fd]);
+     93e:	89 1c 24             	mov    %ebx,(%esp)
+     941:	e8 2a 02 00 00       	call   b70 <funlockfile>
+     946:	83 c4 10             	add    $0x10,%esp
+}
+     949:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     94c:	5b                   	pop    %ebx
+     94d:	5e                   	pop    %esi
+     94e:	5d                   	pop    %ebp
+     94f:	c3                   	ret
+
+00000950 <setup>:
+}
+
+// Choose how to buffer f on first use: by lines on a device.
+static void
+setup(FILE *f)
+{
+     950:	55                   	push   %ebp
+     951:	89 e5                	mov    %esp,%ebp
+     953:	53                   	push   %ebx
+     954:	89 c3                	mov    %eax,%ebx
+     956:	83 ec 2c             	sub    $0x2c,%esp
+  struct stat st;
+
+  f->flags |= IO_SETUP;
+     959:	83 48 04 40          	orl    $0x40,0x4(%eax)
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     95d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     960:	50                   	push   %eax
+     961:	ff 33                	push   (%ebx)
+     963:	e8 52 fb ff ff       	call   4ba <fstat>
+     968:	83 c4 10             	add    $0x10,%esp
+     96b:	85 c0                	test   %eax,%eax
+    f->flags |= IO_DEV|IO_LINE;
+     96d:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     970:	75 07                	jne    979 <setup+0x29>
+     972:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+     977:	74 17                	je     990 <setup+0x40>
+  if(f->flags & IO_WRITE)
+     979:	a8 02                	test   $0x2,%al
+     97b:	74 0a                	je     987 <setup+0x37>
+    flushhook = flushall;
+     97d:	c7 05 e0 27 00 00 b0 	movl   $0xab0,0x27e0
+     984:	0a 00 00 
+}
+     987:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     98a:	c9                   	leave
+     98b:	c3                   	ret
+     98c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    f->flags |= IO_DEV|IO_LINE;
+     990:	83 c8 30             	or     $0x30,%eax
+     993:	89 43 04             	mov    %eax,0x4(%ebx)
+     996:	eb e1                	jmp    979 <setup+0x29>
+     998:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     99f:	90                   	nop
+
+000009a0 <flush>:
+static int
+flush(FILE *f)
+{
+  int i, n;
+
+  if(!(f->flags & IO_WRITE))
+     9a0:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+     9a4:	74 6a                	je     a10 <flush+0x70>
+{
+     9a6:	55                   	push   %ebp
+     9a7:	89 e5                	mov    %esp,%ebp
+     9a9:	56                   	push   %esi
+     9aa:	89 c6                	mov    %eax,%esi
+     9ac:	53                   	push   %ebx
+    return 0;
+  for(i = 0; i < f->n; i += n){
+     9ad:	8b 40 14             	mov    0x14(%eax),%eax
+     9b0:	85 c0                	test   %eax,%eax
+     9b2:	7e 4c                	jle    a00 <flush+0x60>
+     9b4:	31 db                	xor    %ebx,%ebx
+     9b6:	eb 11                	jmp    9c9 <flush+0x29>
+     9b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9bf:	90                   	nop
+     9c0:	01 c3                	add    %eax,%ebx
+     9c2:	8b 46 14             	mov    0x14(%esi),%eax
+     9c5:	39 d8                	cmp    %ebx,%eax
+     9c7:	7e 37                	jle    a00 <flush+0x60>
+    if((n = write(f->fd, f->buf + i, f->n - i)) <= 0){
+     9c9:	83 ec 04             	sub    $0x4,%esp
+     9cc:	29 d8                	sub    %ebx,%eax
+     9ce:	50                   	push   %eax
+     9cf:	8b 46 08             	mov    0x8(%esi),%eax
+     9d2:	01 d8                	add    %ebx,%eax
+     9d4:	50                   	push   %eax
+     9d5:	ff 36                	push   (%esi)
+     9d7:	e8 75 fa ff ff       	call   451 <write>
+     9dc:	83 c4 10             	add    $0x10,%esp
+     9df:	85 c0                	test   %eax,%eax
+     9e1:	7f dd                	jg     9c0 <flush+0x20>
+      f->flags |= IO_ERR;
+     9e3:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+      f->n = 0;
+     9e7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     9ec:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+      return EOF;
+    }
+  }
+  f->n = 0;
+  return 0;
+}
+     9f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     9f6:	5b                   	pop    %ebx
+     9f7:	5e                   	pop    %esi
+     9f8:	5d                   	pop    %ebp
+     9f9:	c3                   	ret
+     9fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->n = 0;
+     a00:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+}
+     a07:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+     a0a:	31 c0                	xor    %eax,%eax
+}
+     a0c:	5b                   	pop    %ebx
+     a0d:	5e                   	pop    %esi
+     a0e:	5d                   	pop    %ebp
+     a0f:	c3                   	ret
+    return 0;
+     a10:	31 c0                	xor    %eax,%eax
+}
+     a12:	c3                   	ret
+     a13:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a20 <fflush.part.0>:
+fflush(FILE *f)
+     a20:	55                   	push   %ebp
+     a21:	89 e5                	mov    %esp,%ebp
+     a23:	57                   	push   %edi
+     a24:	bf f8 27 00 00       	mov    $0x27f8,%edi
+     a29:	56                   	push   %esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     a2a:	31 f6                	xor    %esi,%esi
+fflush(FILE *f)
+     a2c:	53                   	push   %ebx
+     a2d:	bb 18 27 00 00       	mov    $0x2718,%ebx
+     a32:	83 ec 1c             	sub    $0x1c,%esp
+     a35:	eb 10                	jmp    a47 <fflush.part.0+0x27>
+     a37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a3e:	66 90                	xchg   %ax,%ax
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     a40:	83 c3 1c             	add    $0x1c,%ebx
+     a43:	39 df                	cmp    %ebx,%edi
+     a45:	74 33                	je     a7a <fflush.part.0+0x5a>
+      if((f->flags & IO_WRITE) && fflush(f) < 0)
+     a47:	f6 43 ec 02          	testb  $0x2,-0x14(%ebx)
+     a4b:	74 f3                	je     a40 <fflush.part.0+0x20>
+  if(threaded)
+     a4d:	8b 0d 00 28 00 00    	mov    0x2800,%ecx
+     a53:	85 c9                	test   %ecx,%ecx
+     a55:	75 49                	jne    aa0 <fflush.part.0+0x80>
+  r = flush(f);
+     a57:	8d 43 e8             	lea    -0x18(%ebx),%eax
+     a5a:	e8 41 ff ff ff       	call   9a0 <flush>
+  if(threaded)
+     a5f:	8b 15 00 28 00 00    	mov    0x2800,%edx
+     a65:	85 d2                	test   %edx,%edx
+     a67:	75 1f                	jne    a88 <fflush.part.0+0x68>
+        r = EOF;
+     a69:	85 c0                	test   %eax,%eax
+     a6b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     a70:	0f 48 f0             	cmovs  %eax,%esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     a73:	83 c3 1c             	add    $0x1c,%ebx
+     a76:	39 df                	cmp    %ebx,%edi
+     a78:	75 cd                	jne    a47 <fflush.part.0+0x27>
+}
+     a7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a7d:	89 f0                	mov    %esi,%eax
+     a7f:	5b                   	pop    %ebx
+     a80:	5e                   	pop    %esi
+     a81:	5f                   	pop    %edi
+     a82:	5d                   	pop    %ebp
+     a83:	c3                   	ret
+     a84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     a88:	83 ec 0c             	sub    $0xc,%esp
+     a8b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     a8e:	53                   	push   %ebx
+     a8f:	e8 9c f8 ff ff       	call   330 <mutex_unlock>
+     a94:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     a97:	83 c4 10             	add    $0x10,%esp
+     a9a:	eb cd                	jmp    a69 <fflush.part.0+0x49>
+     a9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     aa0:	83 ec 0c             	sub    $0xc,%esp
+     aa3:	53                   	push   %ebx
+     aa4:	e8 37 f8 ff ff       	call   2e0 <mutex_lock>
+     aa9:	83 c4 10             	add    $0x10,%esp
+     aac:	eb a9                	jmp    a57 <fflush.part.0+0x37>
+     aae:	66 90                	xchg   %ax,%ax
+
+00000ab0 <flushall>:
+  if(f == 0){
+     ab0:	e9 6b ff ff ff       	jmp    a20 <fflush.part.0>
+     ab5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     abc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ac0 <fill>:
+
+// Refill f's buffer. Returns the number of bytes read.
+// Caller holds f's lock.
+static int
+fill(FILE *f)
+{
+     ac0:	55                   	push   %ebp
+     ac1:	89 e5                	mov    %esp,%ebp
+     ac3:	53                   	push   %ebx
+     ac4:	89 c3                	mov    %eax,%ebx
+     ac6:	83 ec 04             	sub    $0x4,%esp
+  int n;
+
+  if(!(f->flags & IO_SETUP))
+     ac9:	8b 40 04             	mov    0x4(%eax),%eax
+     acc:	a8 40                	test   $0x40,%al
+     ace:	74 50                	je     b20 <fill+0x60>
+    setup(f);
+  if(f->flags & IO_DEV)
+     ad0:	a8 20                	test   $0x20,%al
+     ad2:	75 3c                	jne    b10 <fill+0x50>
+    fflush(0);
+  f->r = 0;
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     ad4:	83 ec 04             	sub    $0x4,%esp
+  f->r = 0;
+     ad7:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     ade:	ff 73 0c             	push   0xc(%ebx)
+     ae1:	ff 73 08             	push   0x8(%ebx)
+     ae4:	ff 33                	push   (%ebx)
+     ae6:	e8 57 f9 ff ff       	call   442 <read>
+     aeb:	83 c4 10             	add    $0x10,%esp
+     aee:	85 c0                	test   %eax,%eax
+     af0:	7f 10                	jg     b02 <fill+0x42>
+    f->flags |= n < 0 ? IO_ERR : IO_EOF;
+     af2:	83 f8 01             	cmp    $0x1,%eax
+     af5:	19 c0                	sbb    %eax,%eax
+     af7:	83 e0 fc             	and    $0xfffffffc,%eax
+     afa:	83 c0 08             	add    $0x8,%eax
+     afd:	09 43 04             	or     %eax,0x4(%ebx)
+    n = 0;
+     b00:	31 c0                	xor    %eax,%eax
+  }
+  f->n = n;
+     b02:	89 43 14             	mov    %eax,0x14(%ebx)
+  return n;
+}
+     b05:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b08:	c9                   	leave
+     b09:	c3                   	ret
+     b0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == 0){
+     b10:	e8 0b ff ff ff       	call   a20 <fflush.part.0>
+     b15:	eb bd                	jmp    ad4 <fill+0x14>
+     b17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b1e:	66 90                	xchg   %ax,%ax
+    setup(f);
+     b20:	89 d8                	mov    %ebx,%eax
+     b22:	e8 29 fe ff ff       	call   950 <setup>
+  if(f->flags & IO_DEV)
+     b27:	8b 43 04             	mov    0x4(%ebx),%eax
+     b2a:	eb a4                	jmp    ad0 <fill+0x10>
+     b2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b30 <stdio_threaded>:
+  threaded = 1;
+     b30:	c7 05 00 28 00 00 01 	movl   $0x1,0x2800
+     b37:	00 00 00 
+}
+     b3a:	c3                   	ret
+     b3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b3f:	90                   	nop
+
+00000b40 <flockfile>:
+{
+     b40:	55                   	push   %ebp
+  if(threaded)
+     b41:	8b 15 00 28 00 00    	mov    0x2800,%edx
+{
+     b47:	89 e5                	mov    %esp,%ebp
+     b49:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     b4c:	85 d2                	test   %edx,%edx
+     b4e:	75 08                	jne    b58 <flockfile+0x18>
+}
+     b50:	5d                   	pop    %ebp
+     b51:	c3                   	ret
+     b52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_lock(&f->lock);
+     b58:	83 c0 18             	add    $0x18,%eax
+     b5b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     b5e:	5d                   	pop    %ebp
+    mutex_lock(&f->lock);
+     b5f:	e9 7c f7 ff ff       	jmp    2e0 <mutex_lock>
+     b64:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b6f:	90                   	nop
+
+00000b70 <funlockfile>:
+{
+     b70:	55                   	push   %ebp
+  if(threaded)
+     b71:	8b 15 00 28 00 00    	mov    0x2800,%edx
+{
+     b77:	89 e5                	mov    %esp,%ebp
+     b79:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     b7c:	85 d2                	test   %edx,%edx
+     b7e:	75 08                	jne    b88 <funlockfile+0x18>
+}
+     b80:	5d                   	pop    %ebp
+     b81:	c3                   	ret
+     b82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&f->lock);
+     b88:	83 c0 18             	add    $0x18,%eax
+     b8b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     b8e:	5d                   	pop    %ebp
+    mutex_unlock(&f->lock);
+     b8f:	e9 9c f7 ff ff       	jmp    330 <mutex_unlock>
+     b94:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b9f:	90                   	nop
+
+00000ba0 <fopen>:
+{
+     ba0:	55                   	push   %ebp
+     ba1:	89 e5                	mov    %esp,%ebp
+     ba3:	57                   	push   %edi
+     ba4:	56                   	push   %esi
+     ba5:	53                   	push   %ebx
+     ba6:	83 ec 34             	sub    $0x34,%esp
+     ba9:	8b 75 0c             	mov    0xc(%ebp),%esi
+     bac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(strcmp(mode, "r") != 0 && strcmp(mode, "w") != 0)
+     baf:	68 91 1d 00 00       	push   $0x1d91
+     bb4:	56                   	push   %esi
+     bb5:	e8 66 f5 ff ff       	call   120 <strcmp>
+     bba:	83 c4 10             	add    $0x10,%esp
+     bbd:	85 c0                	test   %eax,%eax
+     bbf:	74 15                	je     bd6 <fopen+0x36>
+     bc1:	83 ec 08             	sub    $0x8,%esp
+     bc4:	68 93 1d 00 00       	push   $0x1d93
+     bc9:	56                   	push   %esi
+     bca:	e8 51 f5 ff ff       	call   120 <strcmp>
+     bcf:	83 c4 10             	add    $0x10,%esp
+     bd2:	85 c0                	test   %eax,%eax
+     bd4:	75 2c                	jne    c02 <fopen+0x62>
+  if(threaded)
+     bd6:	a1 00 28 00 00       	mov    0x2800,%eax
+     bdb:	85 c0                	test   %eax,%eax
+     bdd:	0f 85 ed 00 00 00    	jne    cd0 <fopen+0x130>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     be3:	bb 54 27 00 00       	mov    $0x2754,%ebx
+    if(f->flags == 0)
+     be8:	8b 53 04             	mov    0x4(%ebx),%edx
+     beb:	85 d2                	test   %edx,%edx
+     bed:	74 21                	je     c10 <fopen+0x70>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     bef:	83 c3 1c             	add    $0x1c,%ebx
+     bf2:	81 fb e0 27 00 00    	cmp    $0x27e0,%ebx
+     bf8:	75 ee                	jne    be8 <fopen+0x48>
+  if(threaded)
+     bfa:	85 c0                	test   %eax,%eax
+     bfc:	0f 85 36 01 00 00    	jne    d38 <fopen+0x198>
+    return 0;
+     c02:	31 db                	xor    %ebx,%ebx
+     c04:	e9 96 00 00 00       	jmp    c9f <fopen+0xff>
+     c09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f == &_iob[NSTREAM])
+     c10:	81 fb e0 27 00 00    	cmp    $0x27e0,%ebx
+     c16:	74 e2                	je     bfa <fopen+0x5a>
+    f->flags = IO_MALLOC;
+     c18:	c7 43 04 80 00 00 00 	movl   $0x80,0x4(%ebx)
+  if(threaded)
+     c1f:	85 c0                	test   %eax,%eax
+     c21:	0f 85 f9 00 00 00    	jne    d20 <fopen+0x180>
+  if(mode[0] == 'r'){
+     c27:	80 3e 72             	cmpb   $0x72,(%esi)
+     c2a:	0f 84 c0 00 00 00    	je     cf0 <fopen+0x150>
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     c30:	83 ec 08             	sub    $0x8,%esp
+     c33:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     c36:	50                   	push   %eax
+     c37:	57                   	push   %edi
+     c38:	e8 d3 f5 ff ff       	call   210 <stat>
+     c3d:	83 c4 10             	add    $0x10,%esp
+     c40:	85 c0                	test   %eax,%eax
+     c42:	74 6c                	je     cb0 <fopen+0x110>
+    fd = open(path, O_CREATE|O_WRONLY);
+     c44:	83 ec 08             	sub    $0x8,%esp
+     c47:	68 01 02 00 00       	push   $0x201
+     c4c:	57                   	push   %edi
+    flags = IO_WRITE;
+     c4d:	bf 02 00 00 00       	mov    $0x2,%edi
+    fd = open(path, O_CREATE|O_WRONLY);
+     c52:	e8 36 f8 ff ff       	call   48d <open>
+     c57:	83 c4 10             	add    $0x10,%esp
+     c5a:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     c5c:	85 f6                	test   %esi,%esi
+     c5e:	0f 88 a9 00 00 00    	js     d0d <fopen+0x16d>
+     c64:	83 ec 0c             	sub    $0xc,%esp
+     c67:	68 00 02 00 00       	push   $0x200
+     c6c:	e8 af 0c 00 00       	call   1920 <malloc>
+     c71:	83 c4 10             	add    $0x10,%esp
+     c74:	89 43 08             	mov    %eax,0x8(%ebx)
+     c77:	85 c0                	test   %eax,%eax
+     c79:	0f 84 d0 00 00 00    	je     d4f <fopen+0x1af>
+  f->flags = flags|IO_MALLOC;
+     c7f:	81 cf 80 00 00 00    	or     $0x80,%edi
+  f->fd = fd;
+     c85:	89 33                	mov    %esi,(%ebx)
+  f->size = BUFSIZ;
+     c87:	c7 43 0c 00 02 00 00 	movl   $0x200,0xc(%ebx)
+  f->r = f->n = 0;
+     c8e:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+     c95:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  f->flags = flags|IO_MALLOC;
+     c9c:	89 7b 04             	mov    %edi,0x4(%ebx)
+}
+     c9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ca2:	89 d8                	mov    %ebx,%eax
+     ca4:	5b                   	pop    %ebx
+     ca5:	5e                   	pop    %esi
+     ca6:	5f                   	pop    %edi
+     ca7:	5d                   	pop    %ebp
+     ca8:	c3                   	ret
+     ca9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     cb0:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+     cb5:	75 8d                	jne    c44 <fopen+0xa4>
+      unlink(path);
+     cb7:	83 ec 0c             	sub    $0xc,%esp
+     cba:	57                   	push   %edi
+     cbb:	e8 eb f7 ff ff       	call   4ab <unlink>
+     cc0:	83 c4 10             	add    $0x10,%esp
+     cc3:	e9 7c ff ff ff       	jmp    c44 <fopen+0xa4>
+     cc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ccf:	90                   	nop
+    mutex_lock(&iolock);
+     cd0:	83 ec 0c             	sub    $0xc,%esp
+     cd3:	68 04 28 00 00       	push   $0x2804
+     cd8:	e8 03 f6 ff ff       	call   2e0 <mutex_lock>
+  if(threaded)
+     cdd:	a1 00 28 00 00       	mov    0x2800,%eax
+     ce2:	83 c4 10             	add    $0x10,%esp
+     ce5:	e9 f9 fe ff ff       	jmp    be3 <fopen+0x43>
+     cea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    fd = open(path, O_RDONLY);
+     cf0:	83 ec 08             	sub    $0x8,%esp
+     cf3:	6a 00                	push   $0x0
+     cf5:	57                   	push   %edi
+    flags = IO_READ;
+     cf6:	bf 01 00 00 00       	mov    $0x1,%edi
+    fd = open(path, O_RDONLY);
+     cfb:	e8 8d f7 ff ff       	call   48d <open>
+     d00:	83 c4 10             	add    $0x10,%esp
+     d03:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     d05:	85 f6                	test   %esi,%esi
+     d07:	0f 89 57 ff ff ff    	jns    c64 <fopen+0xc4>
+    f->flags = 0;
+     d0d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    return 0;
+     d14:	31 db                	xor    %ebx,%ebx
+     d16:	eb 87                	jmp    c9f <fopen+0xff>
+     d18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d1f:	90                   	nop
+    mutex_unlock(&iolock);
+     d20:	83 ec 0c             	sub    $0xc,%esp
+     d23:	68 04 28 00 00       	push   $0x2804
+     d28:	e8 03 f6 ff ff       	call   330 <mutex_unlock>
+     d2d:	83 c4 10             	add    $0x10,%esp
+     d30:	e9 f2 fe ff ff       	jmp    c27 <fopen+0x87>
+     d35:	8d 76 00             	lea    0x0(%esi),%esi
+     d38:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+     d3b:	31 db                	xor    %ebx,%ebx
+    mutex_unlock(&iolock);
+     d3d:	68 04 28 00 00       	push   $0x2804
+     d42:	e8 e9 f5 ff ff       	call   330 <mutex_unlock>
+     d47:	83 c4 10             	add    $0x10,%esp
+     d4a:	e9 50 ff ff ff       	jmp    c9f <fopen+0xff>
+      close(fd);
+     d4f:	83 ec 0c             	sub    $0xc,%esp
+     d52:	56                   	push   %esi
+     d53:	e8 08 f7 ff ff       	call   460 <close>
+     d58:	83 c4 10             	add    $0x10,%esp
+     d5b:	eb b0                	jmp    d0d <fopen+0x16d>
+     d5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d60 <fclose>:
+{
+     d60:	55                   	push   %ebp
+     d61:	89 e5                	mov    %esp,%ebp
+     d63:	56                   	push   %esi
+     d64:	53                   	push   %ebx
+  if(threaded)
+     d65:	8b 15 00 28 00 00    	mov    0x2800,%edx
+{
+     d6b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+     d6e:	85 d2                	test   %edx,%edx
+     d70:	75 46                	jne    db8 <fclose+0x58>
+  r = flush(f);
+     d72:	89 d8                	mov    %ebx,%eax
+     d74:	e8 27 fc ff ff       	call   9a0 <flush>
+  if(close(f->fd) < 0)
+     d79:	83 ec 0c             	sub    $0xc,%esp
+     d7c:	ff 33                	push   (%ebx)
+  r = flush(f);
+     d7e:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+     d80:	e8 db f6 ff ff       	call   460 <close>
+     d85:	83 c4 10             	add    $0x10,%esp
+    r = EOF;
+     d88:	85 c0                	test   %eax,%eax
+     d8a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     d8f:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->flags & IO_MALLOC)
+     d92:	f6 43 04 80          	testb  $0x80,0x4(%ebx)
+     d96:	75 58                	jne    df0 <fclose+0x90>
+  if(threaded)
+     d98:	a1 00 28 00 00       	mov    0x2800,%eax
+  f->flags = 0;
+     d9d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  if(threaded)
+     da4:	85 c0                	test   %eax,%eax
+     da6:	75 28                	jne    dd0 <fclose+0x70>
+}
+     da8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     dab:	89 f0                	mov    %esi,%eax
+     dad:	5b                   	pop    %ebx
+     dae:	5e                   	pop    %esi
+     daf:	5d                   	pop    %ebp
+     db0:	c3                   	ret
+     db1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     db8:	83 ec 0c             	sub    $0xc,%esp
+     dbb:	8d 43 18             	lea    0x18(%ebx),%eax
+     dbe:	50                   	push   %eax
+     dbf:	e8 1c f5 ff ff       	call   2e0 <mutex_lock>
+     dc4:	83 c4 10             	add    $0x10,%esp
+     dc7:	eb a9                	jmp    d72 <fclose+0x12>
+     dc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     dd0:	83 ec 0c             	sub    $0xc,%esp
+     dd3:	83 c3 18             	add    $0x18,%ebx
+     dd6:	53                   	push   %ebx
+     dd7:	e8 54 f5 ff ff       	call   330 <mutex_unlock>
+     ddc:	83 c4 10             	add    $0x10,%esp
+}
+     ddf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     de2:	89 f0                	mov    %esi,%eax
+     de4:	5b                   	pop    %ebx
+     de5:	5e                   	pop    %esi
+     de6:	5d                   	pop    %ebp
+     de7:	c3                   	ret
+     de8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     def:	90                   	nop
+    free(f->buf);
+     df0:	83 ec 0c             	sub    $0xc,%esp
+     df3:	ff 73 08             	push   0x8(%ebx)
+     df6:	e8 f5 09 00 00       	call   17f0 <free>
+     dfb:	83 c4 10             	add    $0x10,%esp
+     dfe:	eb 98                	jmp    d98 <fclose+0x38>
+
+00000e00 <fflush>:
+{
+     e00:	55                   	push   %ebp
+     e01:	89 e5                	mov    %esp,%ebp
+     e03:	53                   	push   %ebx
+     e04:	83 ec 14             	sub    $0x14,%esp
+     e07:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f == 0){
+     e0a:	85 db                	test   %ebx,%ebx
+     e0c:	74 5a                	je     e68 <fflush+0x68>
+  if(threaded)
+     e0e:	8b 0d 00 28 00 00    	mov    0x2800,%ecx
+     e14:	85 c9                	test   %ecx,%ecx
+     e16:	75 18                	jne    e30 <fflush+0x30>
+  r = flush(f);
+     e18:	89 d8                	mov    %ebx,%eax
+     e1a:	e8 81 fb ff ff       	call   9a0 <flush>
+  if(threaded)
+     e1f:	8b 15 00 28 00 00    	mov    0x2800,%edx
+     e25:	85 d2                	test   %edx,%edx
+     e27:	75 1f                	jne    e48 <fflush+0x48>
+}
+     e29:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e2c:	c9                   	leave
+     e2d:	c3                   	ret
+     e2e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+     e30:	83 ec 0c             	sub    $0xc,%esp
+     e33:	8d 43 18             	lea    0x18(%ebx),%eax
+     e36:	50                   	push   %eax
+     e37:	e8 a4 f4 ff ff       	call   2e0 <mutex_lock>
+     e3c:	83 c4 10             	add    $0x10,%esp
+     e3f:	eb d7                	jmp    e18 <fflush+0x18>
+     e41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     e48:	83 ec 0c             	sub    $0xc,%esp
+     e4b:	83 c3 18             	add    $0x18,%ebx
+     e4e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     e51:	53                   	push   %ebx
+     e52:	e8 d9 f4 ff ff       	call   330 <mutex_unlock>
+     e57:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     e5a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    mutex_unlock(&f->lock);
+     e5d:	83 c4 10             	add    $0x10,%esp
+}
+     e60:	c9                   	leave
+     e61:	c3                   	ret
+     e62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     e68:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e6b:	c9                   	leave
+     e6c:	e9 af fb ff ff       	jmp    a20 <fflush.part.0>
+     e71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e7f:	90                   	nop
+
+00000e80 <putc_unlocked>:
+{
+     e80:	55                   	push   %ebp
+     e81:	89 e5                	mov    %esp,%ebp
+     e83:	56                   	push   %esi
+     e84:	53                   	push   %ebx
+     e85:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     e88:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(!(f->flags & IO_WRITE))
+     e8b:	8b 43 04             	mov    0x4(%ebx),%eax
+     e8e:	a8 02                	test   $0x2,%al
+     e90:	74 46                	je     ed8 <putc_unlocked+0x58>
+  if(!(f->flags & IO_SETUP))
+     e92:	a8 40                	test   $0x40,%al
+     e94:	74 4a                	je     ee0 <putc_unlocked+0x60>
+  if(f->n == f->size && flush(f) < 0)
+     e96:	8b 43 14             	mov    0x14(%ebx),%eax
+     e99:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     e9c:	74 51                	je     eef <putc_unlocked+0x6f>
+  f->buf[f->n++] = c;
+     e9e:	8d 48 01             	lea    0x1(%eax),%ecx
+     ea1:	8b 53 08             	mov    0x8(%ebx),%edx
+     ea4:	89 4b 14             	mov    %ecx,0x14(%ebx)
+     ea7:	89 f1                	mov    %esi,%ecx
+     ea9:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     eac:	83 fe 0a             	cmp    $0xa,%esi
+     eaf:	74 0f                	je     ec0 <putc_unlocked+0x40>
+  return c & 0xff;
+     eb1:	89 f0                	mov    %esi,%eax
+     eb3:	0f b6 c0             	movzbl %al,%eax
+}
+     eb6:	5b                   	pop    %ebx
+     eb7:	5e                   	pop    %esi
+     eb8:	5d                   	pop    %ebp
+     eb9:	c3                   	ret
+     eba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     ec0:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+     ec4:	74 eb                	je     eb1 <putc_unlocked+0x31>
+     ec6:	89 d8                	mov    %ebx,%eax
+     ec8:	e8 d3 fa ff ff       	call   9a0 <flush>
+     ecd:	85 c0                	test   %eax,%eax
+     ecf:	79 e0                	jns    eb1 <putc_unlocked+0x31>
+     ed1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return EOF;
+     ed8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     edd:	eb d7                	jmp    eb6 <putc_unlocked+0x36>
+     edf:	90                   	nop
+    setup(f);
+     ee0:	89 d8                	mov    %ebx,%eax
+     ee2:	e8 69 fa ff ff       	call   950 <setup>
+  if(f->n == f->size && flush(f) < 0)
+     ee7:	8b 43 14             	mov    0x14(%ebx),%eax
+     eea:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     eed:	75 af                	jne    e9e <putc_unlocked+0x1e>
+     eef:	89 d8                	mov    %ebx,%eax
+     ef1:	e8 aa fa ff ff       	call   9a0 <flush>
+     ef6:	85 c0                	test   %eax,%eax
+     ef8:	78 de                	js     ed8 <putc_unlocked+0x58>
+  f->buf[f->n++] = c;
+     efa:	8b 43 14             	mov    0x14(%ebx),%eax
+     efd:	eb 9f                	jmp    e9e <putc_unlocked+0x1e>
+     eff:	90                   	nop
+
+00000f00 <fputc>:
+{
+     f00:	55                   	push   %ebp
+     f01:	89 e5                	mov    %esp,%ebp
+     f03:	56                   	push   %esi
+     f04:	53                   	push   %ebx
+  if(threaded)
+     f05:	8b 15 00 28 00 00    	mov    0x2800,%edx
+{
+     f0b:	8b 75 08             	mov    0x8(%ebp),%esi
+     f0e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(threaded)
+     f11:	85 d2                	test   %edx,%edx
+     f13:	75 6b                	jne    f80 <fputc+0x80>
+  if(!(f->flags & IO_WRITE))
+     f15:	8b 43 04             	mov    0x4(%ebx),%eax
+     f18:	a8 02                	test   $0x2,%al
+     f1a:	0f 84 b8 00 00 00    	je     fd8 <fputc+0xd8>
+  if(!(f->flags & IO_SETUP))
+     f20:	a8 40                	test   $0x40,%al
+     f22:	74 76                	je     f9a <fputc+0x9a>
+  if(f->n == f->size && flush(f) < 0)
+     f24:	8b 43 14             	mov    0x14(%ebx),%eax
+     f27:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     f2a:	74 7d                	je     fa9 <fputc+0xa9>
+  f->buf[f->n++] = c;
+     f2c:	8d 48 01             	lea    0x1(%eax),%ecx
+     f2f:	8b 53 08             	mov    0x8(%ebx),%edx
+     f32:	89 4b 14             	mov    %ecx,0x14(%ebx)
+     f35:	89 f1                	mov    %esi,%ecx
+     f37:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     f3a:	83 fe 0a             	cmp    $0xa,%esi
+     f3d:	74 21                	je     f60 <fputc+0x60>
+  return c & 0xff;
+     f3f:	89 f0                	mov    %esi,%eax
+     f41:	0f b6 f0             	movzbl %al,%esi
+  if(threaded)
+     f44:	a1 00 28 00 00       	mov    0x2800,%eax
+     f49:	85 c0                	test   %eax,%eax
+     f4b:	75 73                	jne    fc0 <fputc+0xc0>
+}
+     f4d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f50:	89 f0                	mov    %esi,%eax
+     f52:	5b                   	pop    %ebx
+     f53:	5e                   	pop    %esi
+     f54:	5d                   	pop    %ebp
+     f55:	c3                   	ret
+     f56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f5d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     f60:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+     f64:	74 d9                	je     f3f <fputc+0x3f>
+     f66:	89 d8                	mov    %ebx,%eax
+     f68:	e8 33 fa ff ff       	call   9a0 <flush>
+     f6d:	85 c0                	test   %eax,%eax
+     f6f:	79 ce                	jns    f3f <fputc+0x3f>
+    return EOF;
+     f71:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     f76:	eb cc                	jmp    f44 <fputc+0x44>
+     f78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f7f:	90                   	nop
+    mutex_lock(&f->lock);
+     f80:	83 ec 0c             	sub    $0xc,%esp
+     f83:	8d 43 18             	lea    0x18(%ebx),%eax
+     f86:	50                   	push   %eax
+     f87:	e8 54 f3 ff ff       	call   2e0 <mutex_lock>
+  if(!(f->flags & IO_WRITE))
+     f8c:	8b 43 04             	mov    0x4(%ebx),%eax
+     f8f:	83 c4 10             	add    $0x10,%esp
+     f92:	a8 02                	test   $0x2,%al
+     f94:	74 db                	je     f71 <fputc+0x71>
+  if(!(f->flags & IO_SETUP))
+     f96:	a8 40                	test   $0x40,%al
+     f98:	75 8a                	jne    f24 <fputc+0x24>
+    setup(f);
+     f9a:	89 d8                	mov    %ebx,%eax
+     f9c:	e8 af f9 ff ff       	call   950 <setup>
+  if(f->n == f->size && flush(f) < 0)
+     fa1:	8b 43 14             	mov    0x14(%ebx),%eax
+     fa4:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     fa7:	75 83                	jne    f2c <fputc+0x2c>
+     fa9:	89 d8                	mov    %ebx,%eax
+     fab:	e8 f0 f9 ff ff       	call   9a0 <flush>
+     fb0:	85 c0                	test   %eax,%eax
+     fb2:	78 bd                	js     f71 <fputc+0x71>
+  f->buf[f->n++] = c;
+     fb4:	8b 43 14             	mov    0x14(%ebx),%eax
+     fb7:	e9 70 ff ff ff       	jmp    f2c <fputc+0x2c>
+     fbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     fc0:	83 ec 0c             	sub    $0xc,%esp
+     fc3:	83 c3 18             	add    $0x18,%ebx
+     fc6:	53                   	push   %ebx
+     fc7:	e8 64 f3 ff ff       	call   330 <mutex_unlock>
+     fcc:	83 c4 10             	add    $0x10,%esp
+}
+     fcf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     fd2:	89 f0                	mov    %esi,%eax
+     fd4:	5b                   	pop    %ebx
+     fd5:	5e                   	pop    %esi
+     fd6:	5d                   	pop    %ebp
+     fd7:	c3                   	ret
+    return EOF;
+     fd8:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+     fdd:	e9 6b ff ff ff       	jmp    f4d <fputc+0x4d>
+     fe2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fe9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000ff0 <fwrite>:
+{
+     ff0:	55                   	push   %ebp
+     ff1:	89 e5                	mov    %esp,%ebp
+     ff3:	57                   	push   %edi
+     ff4:	56                   	push   %esi
+     ff5:	53                   	push   %ebx
+     ff6:	83 ec 1c             	sub    $0x1c,%esp
+     ff9:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  if(!(f->flags & IO_WRITE) || size <= 0)
+     ffc:	8b 43 04             	mov    0x4(%ebx),%eax
+     fff:	a8 02                	test   $0x2,%al
+    1001:	0f 84 ec 00 00 00    	je     10f3 <fwrite+0x103>
+    1007:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    100a:	85 c9                	test   %ecx,%ecx
+    100c:	0f 8e e1 00 00 00    	jle    10f3 <fwrite+0x103>
+  if(threaded)
+    1012:	8b 15 00 28 00 00    	mov    0x2800,%edx
+    1018:	85 d2                	test   %edx,%edx
+    101a:	0f 85 1c 01 00 00    	jne    113c <fwrite+0x14c>
+  if(!(f->flags & IO_SETUP))
+    1020:	a8 40                	test   $0x40,%al
+    1022:	0f 84 08 01 00 00    	je     1130 <fwrite+0x140>
+  for(len = size*nmemb; len > 0; len -= n){
+    1028:	8b 45 0c             	mov    0xc(%ebp),%eax
+    102b:	0f af 45 10          	imul   0x10(%ebp),%eax
+    102f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    1032:	85 c0                	test   %eax,%eax
+    1034:	0f 8e 2a 01 00 00    	jle    1164 <fwrite+0x174>
+  s = p;
+    103a:	8b 45 08             	mov    0x8(%ebp),%eax
+  nl = 0;
+    103d:	31 ff                	xor    %edi,%edi
+    103f:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+        nl = 1;
+    1042:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  s = p;
+    1045:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1048:	8b 43 14             	mov    0x14(%ebx),%eax
+        nl = 1;
+    104b:	89 ce                	mov    %ecx,%esi
+    if(f->n == f->size && flush(f) < 0)
+    104d:	89 c2                	mov    %eax,%edx
+    104f:	39 f0                	cmp    %esi,%eax
+    1051:	74 6e                	je     10c1 <fwrite+0xd1>
+    1053:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1057:	90                   	nop
+    if(n > len)
+    1058:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    n = f->size - f->n;
+    105b:	89 f1                	mov    %esi,%ecx
+    105d:	29 c1                	sub    %eax,%ecx
+    105f:	39 f9                	cmp    %edi,%ecx
+    1061:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1064:	85 c9                	test   %ecx,%ecx
+    1066:	0f 8e 7c 00 00 00    	jle    10e8 <fwrite+0xf8>
+    106c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    106f:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1072:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    1075:	8d 34 08             	lea    (%eax,%ecx,1),%esi
+    1078:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    107b:	eb 06                	jmp    1083 <fwrite+0x93>
+    107d:	8d 76 00             	lea    0x0(%esi),%esi
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1080:	8b 53 14             	mov    0x14(%ebx),%edx
+    1083:	8d 4a 01             	lea    0x1(%edx),%ecx
+    1086:	8b 73 08             	mov    0x8(%ebx),%esi
+    1089:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    108c:	0f b6 08             	movzbl (%eax),%ecx
+        nl = 1;
+    108f:	80 f9 0a             	cmp    $0xa,%cl
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1092:	88 0c 16             	mov    %cl,(%esi,%edx,1)
+        nl = 1;
+    1095:	be 01 00 00 00       	mov    $0x1,%esi
+    109a:	0f 44 fe             	cmove  %esi,%edi
+    for(i = 0; i < n; i++)
+    109d:	83 c0 01             	add    $0x1,%eax
+    10a0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    10a3:	75 db                	jne    1080 <fwrite+0x90>
+    s += n;
+    10a5:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    10a8:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    10ab:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    s += n;
+    10ae:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    10b1:	85 c0                	test   %eax,%eax
+    10b3:	7e 48                	jle    10fd <fwrite+0x10d>
+    10b5:	8b 43 14             	mov    0x14(%ebx),%eax
+    10b8:	8b 73 0c             	mov    0xc(%ebx),%esi
+    if(f->n == f->size && flush(f) < 0)
+    10bb:	89 c2                	mov    %eax,%edx
+    10bd:	39 f0                	cmp    %esi,%eax
+    10bf:	75 97                	jne    1058 <fwrite+0x68>
+    10c1:	89 d8                	mov    %ebx,%eax
+    10c3:	e8 d8 f8 ff ff       	call   9a0 <flush>
+    10c8:	85 c0                	test   %eax,%eax
+    10ca:	78 31                	js     10fd <fwrite+0x10d>
+    n = f->size - f->n;
+    10cc:	8b 73 0c             	mov    0xc(%ebx),%esi
+    10cf:	8b 43 14             	mov    0x14(%ebx),%eax
+    10d2:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    10d5:	89 f1                	mov    %esi,%ecx
+    10d7:	89 c2                	mov    %eax,%edx
+    10d9:	29 c1                	sub    %eax,%ecx
+    10db:	39 f9                	cmp    %edi,%ecx
+    10dd:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    10e0:	85 c9                	test   %ecx,%ecx
+    10e2:	7f 88                	jg     106c <fwrite+0x7c>
+    10e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    s += n;
+    10e8:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    10eb:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    10ee:	e9 5a ff ff ff       	jmp    104d <fwrite+0x5d>
+}
+    10f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    10f6:	31 c0                	xor    %eax,%eax
+}
+    10f8:	5b                   	pop    %ebx
+    10f9:	5e                   	pop    %esi
+    10fa:	5f                   	pop    %edi
+    10fb:	5d                   	pop    %ebp
+    10fc:	c3                   	ret
+  if(nl && (f->flags & IO_LINE))
+    10fd:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1100:	85 ff                	test   %edi,%edi
+    1102:	74 06                	je     110a <fwrite+0x11a>
+    1104:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1108:	75 1d                	jne    1127 <fwrite+0x137>
+  return (s - (const char*)p) / size;
+    110a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    110d:	2b 75 08             	sub    0x8(%ebp),%esi
+  if(threaded)
+    1110:	a1 00 28 00 00       	mov    0x2800,%eax
+    1115:	85 c0                	test   %eax,%eax
+    1117:	75 3a                	jne    1153 <fwrite+0x163>
+  return (s - (const char*)p) / size;
+    1119:	89 f0                	mov    %esi,%eax
+    111b:	99                   	cltd
+    111c:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    111f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1122:	5b                   	pop    %ebx
+    1123:	5e                   	pop    %esi
+    1124:	5f                   	pop    %edi
+    1125:	5d                   	pop    %ebp
+    1126:	c3                   	ret
+    flush(f);
+    1127:	89 d8                	mov    %ebx,%eax
+    1129:	e8 72 f8 ff ff       	call   9a0 <flush>
+    112e:	eb da                	jmp    110a <fwrite+0x11a>
+    setup(f);
+    1130:	89 d8                	mov    %ebx,%eax
+    1132:	e8 19 f8 ff ff       	call   950 <setup>
+    1137:	e9 ec fe ff ff       	jmp    1028 <fwrite+0x38>
+    mutex_lock(&f->lock);
+    113c:	83 ec 0c             	sub    $0xc,%esp
+    113f:	8d 43 18             	lea    0x18(%ebx),%eax
+    1142:	50                   	push   %eax
+    1143:	e8 98 f1 ff ff       	call   2e0 <mutex_lock>
+  if(!(f->flags & IO_SETUP))
+    1148:	8b 43 04             	mov    0x4(%ebx),%eax
+    114b:	83 c4 10             	add    $0x10,%esp
+    114e:	e9 cd fe ff ff       	jmp    1020 <fwrite+0x30>
+    mutex_unlock(&f->lock);
+    1153:	83 ec 0c             	sub    $0xc,%esp
+    1156:	83 c3 18             	add    $0x18,%ebx
+    1159:	53                   	push   %ebx
+    115a:	e8 d1 f1 ff ff       	call   330 <mutex_unlock>
+    115f:	83 c4 10             	add    $0x10,%esp
+    1162:	eb b5                	jmp    1119 <fwrite+0x129>
+  for(len = size*nmemb; len > 0; len -= n){
+    1164:	31 f6                	xor    %esi,%esi
+    1166:	eb a8                	jmp    1110 <fwrite+0x120>
+    1168:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    116f:	90                   	nop
+
+00001170 <fgetc>:
+  return f->buf[f->r++] & 0xff;
+}
+
+int
+fgetc(FILE *f)
+{
+    1170:	55                   	push   %ebp
+    1171:	89 e5                	mov    %esp,%ebp
+    1173:	56                   	push   %esi
+    1174:	53                   	push   %ebx
+  if(threaded)
+    1175:	8b 15 00 28 00 00    	mov    0x2800,%edx
+{
+    117b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    117e:	85 d2                	test   %edx,%edx
+    1180:	75 2e                	jne    11b0 <fgetc+0x40>
+  if(!(f->flags & IO_READ))
+    1182:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1186:	74 78                	je     1200 <fgetc+0x90>
+  if(f->r == f->n && fill(f) == 0)
+    1188:	8b 43 10             	mov    0x10(%ebx),%eax
+    118b:	3b 43 14             	cmp    0x14(%ebx),%eax
+    118e:	74 60                	je     11f0 <fgetc+0x80>
+  return f->buf[f->r++] & 0xff;
+    1190:	8b 53 08             	mov    0x8(%ebx),%edx
+    1193:	8d 48 01             	lea    0x1(%eax),%ecx
+    1196:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1199:	0f b6 34 02          	movzbl (%edx,%eax,1),%esi
+  if(threaded)
+    119d:	a1 00 28 00 00       	mov    0x2800,%eax
+    11a2:	85 c0                	test   %eax,%eax
+    11a4:	75 2a                	jne    11d0 <fgetc+0x60>
+
+  flockfile(f);
+  c = getc_unlocked(f);
+  funlockfile(f);
+  return c;
+}
+    11a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    11a9:	89 f0                	mov    %esi,%eax
+    11ab:	5b                   	pop    %ebx
+    11ac:	5e                   	pop    %esi
+    11ad:	5d                   	pop    %ebp
+    11ae:	c3                   	ret
+    11af:	90                   	nop
+    mutex_lock(&f->lock);
+    11b0:	83 ec 0c             	sub    $0xc,%esp
+    11b3:	8d 43 18             	lea    0x18(%ebx),%eax
+    11b6:	50                   	push   %eax
+    11b7:	e8 24 f1 ff ff       	call   2e0 <mutex_lock>
+  if(!(f->flags & IO_READ))
+    11bc:	83 c4 10             	add    $0x10,%esp
+    11bf:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    11c3:	75 c3                	jne    1188 <fgetc+0x18>
+    return EOF;
+    11c5:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    11ca:	eb d1                	jmp    119d <fgetc+0x2d>
+    11cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    11d0:	83 ec 0c             	sub    $0xc,%esp
+    11d3:	83 c3 18             	add    $0x18,%ebx
+    11d6:	53                   	push   %ebx
+    11d7:	e8 54 f1 ff ff       	call   330 <mutex_unlock>
+    11dc:	83 c4 10             	add    $0x10,%esp
+}
+    11df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    11e2:	89 f0                	mov    %esi,%eax
+    11e4:	5b                   	pop    %ebx
+    11e5:	5e                   	pop    %esi
+    11e6:	5d                   	pop    %ebp
+    11e7:	c3                   	ret
+    11e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11ef:	90                   	nop
+  if(f->r == f->n && fill(f) == 0)
+    11f0:	89 d8                	mov    %ebx,%eax
+    11f2:	e8 c9 f8 ff ff       	call   ac0 <fill>
+    11f7:	85 c0                	test   %eax,%eax
+    11f9:	74 ca                	je     11c5 <fgetc+0x55>
+  return f->buf[f->r++] & 0xff;
+    11fb:	8b 43 10             	mov    0x10(%ebx),%eax
+    11fe:	eb 90                	jmp    1190 <fgetc+0x20>
+    return EOF;
+    1200:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    1205:	eb 9f                	jmp    11a6 <fgetc+0x36>
+    1207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    120e:	66 90                	xchg   %ax,%ax
+
+00001210 <fread>:
+
+int
+fread(void *p, int size, int nmemb, FILE *f)
+{
+    1210:	55                   	push   %ebp
+    1211:	89 e5                	mov    %esp,%ebp
+    1213:	57                   	push   %edi
+    1214:	56                   	push   %esi
+    1215:	53                   	push   %ebx
+    1216:	83 ec 1c             	sub    $0x1c,%esp
+    1219:	8b 75 14             	mov    0x14(%ebp),%esi
+  char *d;
+  int n, len;
+
+  if(!(f->flags & IO_READ) || size <= 0)
+    121c:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+    1220:	74 7e                	je     12a0 <fread+0x90>
+    1222:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1225:	85 d2                	test   %edx,%edx
+    1227:	7e 77                	jle    12a0 <fread+0x90>
+  if(threaded)
+    1229:	a1 00 28 00 00       	mov    0x2800,%eax
+    return 0;
+  flockfile(f);
+  d = p;
+  for(len = size*nmemb; len > 0; len -= n){
+    122e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1231:	0f af 7d 10          	imul   0x10(%ebp),%edi
+  if(threaded)
+    1235:	85 c0                	test   %eax,%eax
+    1237:	0f 85 93 00 00 00    	jne    12d0 <fread+0xc0>
+  for(len = size*nmemb; len > 0; len -= n){
+    123d:	85 ff                	test   %edi,%edi
+    123f:	7e 61                	jle    12a2 <fread+0x92>
+    if(f->r == f->n && fill(f) == 0)
+    1241:	8b 46 10             	mov    0x10(%esi),%eax
+  d = p;
+    1244:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1247:	eb 35                	jmp    127e <fread+0x6e>
+    1249:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      break;
+    n = f->n - f->r;
+    1250:	29 c3                	sub    %eax,%ebx
+    1252:	39 fb                	cmp    %edi,%ebx
+    1254:	0f 4f df             	cmovg  %edi,%ebx
+    if(n > len)
+      n = len;
+    memmove(d, f->buf + f->r, n);
+    1257:	83 ec 04             	sub    $0x4,%esp
+    125a:	53                   	push   %ebx
+    125b:	03 46 08             	add    0x8(%esi),%eax
+  for(len = size*nmemb; len > 0; len -= n){
+    125e:	29 df                	sub    %ebx,%edi
+    memmove(d, f->buf + f->r, n);
+    1260:	50                   	push   %eax
+    1261:	51                   	push   %ecx
+    1262:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1265:	e8 36 f0 ff ff       	call   2a0 <memmove>
+    f->r += n;
+    126a:	8b 46 10             	mov    0x10(%esi),%eax
+    d += n;
+    126d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1270:	83 c4 10             	add    $0x10,%esp
+    f->r += n;
+    1273:	01 d8                	add    %ebx,%eax
+    d += n;
+    1275:	01 d9                	add    %ebx,%ecx
+    f->r += n;
+    1277:	89 46 10             	mov    %eax,0x10(%esi)
+  for(len = size*nmemb; len > 0; len -= n){
+    127a:	85 ff                	test   %edi,%edi
+    127c:	7e 32                	jle    12b0 <fread+0xa0>
+    if(f->r == f->n && fill(f) == 0)
+    127e:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1281:	39 c3                	cmp    %eax,%ebx
+    1283:	75 cb                	jne    1250 <fread+0x40>
+    1285:	89 f0                	mov    %esi,%eax
+    1287:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    128a:	e8 31 f8 ff ff       	call   ac0 <fill>
+    128f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1292:	85 c0                	test   %eax,%eax
+    1294:	74 1a                	je     12b0 <fread+0xa0>
+    n = f->n - f->r;
+    1296:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1299:	8b 46 10             	mov    0x10(%esi),%eax
+    129c:	eb b2                	jmp    1250 <fread+0x40>
+    129e:	66 90                	xchg   %ax,%ax
+    return 0;
+    12a0:	31 c0                	xor    %eax,%eax
+  }
+  funlockfile(f);
+  return (d - (char*)p) / size;
+}
+    12a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12a5:	5b                   	pop    %ebx
+    12a6:	5e                   	pop    %esi
+    12a7:	5f                   	pop    %edi
+    12a8:	5d                   	pop    %ebp
+    12a9:	c3                   	ret
+    12aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (d - (char*)p) / size;
+    12b0:	2b 4d 08             	sub    0x8(%ebp),%ecx
+    12b3:	89 cb                	mov    %ecx,%ebx
+  if(threaded)
+    12b5:	a1 00 28 00 00       	mov    0x2800,%eax
+    12ba:	85 c0                	test   %eax,%eax
+    12bc:	75 32                	jne    12f0 <fread+0xe0>
+  return (d - (char*)p) / size;
+    12be:	89 d8                	mov    %ebx,%eax
+    12c0:	99                   	cltd
+    12c1:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    12c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12c7:	5b                   	pop    %ebx
+    12c8:	5e                   	pop    %esi
+    12c9:	5f                   	pop    %edi
+    12ca:	5d                   	pop    %ebp
+    12cb:	c3                   	ret
+    12cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    12d0:	83 ec 0c             	sub    $0xc,%esp
+    12d3:	8d 46 18             	lea    0x18(%esi),%eax
+    12d6:	50                   	push   %eax
+    12d7:	e8 04 f0 ff ff       	call   2e0 <mutex_lock>
+  for(len = size*nmemb; len > 0; len -= n){
+    12dc:	83 c4 10             	add    $0x10,%esp
+    12df:	85 ff                	test   %edi,%edi
+    12e1:	0f 8f 5a ff ff ff    	jg     1241 <fread+0x31>
+    12e7:	31 db                	xor    %ebx,%ebx
+    12e9:	eb ca                	jmp    12b5 <fread+0xa5>
+    12eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12ef:	90                   	nop
+    mutex_unlock(&f->lock);
+    12f0:	83 ec 0c             	sub    $0xc,%esp
+    12f3:	83 c6 18             	add    $0x18,%esi
+    12f6:	56                   	push   %esi
+    12f7:	e8 34 f0 ff ff       	call   330 <mutex_unlock>
+  return (d - (char*)p) / size;
+    12fc:	89 d8                	mov    %ebx,%eax
+    12fe:	83 c4 10             	add    $0x10,%esp
+    1301:	99                   	cltd
+    1302:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1305:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1308:	5b                   	pop    %ebx
+    1309:	5e                   	pop    %esi
+    130a:	5f                   	pop    %edi
+    130b:	5d                   	pop    %ebp
+    130c:	c3                   	ret
+    130d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001310 <fgets>:
+
+// Read a line of at most max-1 bytes, keeping the newline.
+// Returns 0 if there was nothing left to read.
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    1310:	55                   	push   %ebp
+    1311:	89 e5                	mov    %esp,%ebp
+    1313:	57                   	push   %edi
+    1314:	56                   	push   %esi
+    1315:	53                   	push   %ebx
+    1316:	83 ec 1c             	sub    $0x1c,%esp
+  if(threaded)
+    1319:	8b 35 00 28 00 00    	mov    0x2800,%esi
+{
+    131f:	8b 7d 08             	mov    0x8(%ebp),%edi
+    1322:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if(threaded)
+    1325:	85 f6                	test   %esi,%esi
+    1327:	0f 85 83 00 00 00    	jne    13b0 <fgets+0xa0>
+{
+    132d:	31 f6                	xor    %esi,%esi
+    132f:	eb 2a                	jmp    135b <fgets+0x4b>
+    1331:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return f->buf[f->r++] & 0xff;
+    1338:	8b 53 08             	mov    0x8(%ebx),%edx
+    133b:	8d 48 01             	lea    0x1(%eax),%ecx
+    133e:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1341:	0f b6 14 02          	movzbl (%edx,%eax,1),%edx
+
+  flockfile(f);
+  for(i = 0; i+1 < max; ){
+    if((c = getc_unlocked(f)) == EOF)
+      break;
+    buf[i++] = c;
+    1345:	88 54 37 ff          	mov    %dl,-0x1(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    1349:	80 fa 0a             	cmp    $0xa,%dl
+    134c:	0f 84 96 00 00 00    	je     13e8 <fgets+0xd8>
+    1352:	83 fa 0d             	cmp    $0xd,%edx
+    1355:	0f 84 8d 00 00 00    	je     13e8 <fgets+0xd8>
+  for(i = 0; i+1 < max; ){
+    135b:	89 f2                	mov    %esi,%edx
+    135d:	83 c6 01             	add    $0x1,%esi
+    1360:	3b 75 0c             	cmp    0xc(%ebp),%esi
+    1363:	7d 2b                	jge    1390 <fgets+0x80>
+  if(!(f->flags & IO_READ))
+    1365:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1369:	74 25                	je     1390 <fgets+0x80>
+  if(f->r == f->n && fill(f) == 0)
+    136b:	8b 43 10             	mov    0x10(%ebx),%eax
+    136e:	3b 43 14             	cmp    0x14(%ebx),%eax
+    1371:	75 c5                	jne    1338 <fgets+0x28>
+    1373:	89 d8                	mov    %ebx,%eax
+    1375:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1378:	e8 43 f7 ff ff       	call   ac0 <fill>
+    137d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1380:	85 c0                	test   %eax,%eax
+    1382:	74 0c                	je     1390 <fgets+0x80>
+  return f->buf[f->r++] & 0xff;
+    1384:	8b 43 10             	mov    0x10(%ebx),%eax
+    1387:	eb af                	jmp    1338 <fgets+0x28>
+    1389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1390:	8b 0d 00 28 00 00    	mov    0x2800,%ecx
+      break;
+  }
+  buf[i] = '\0';
+    1396:	c6 04 17 00          	movb   $0x0,(%edi,%edx,1)
+  if(threaded)
+    139a:	85 c9                	test   %ecx,%ecx
+    139c:	75 2a                	jne    13c8 <fgets+0xb8>
+  funlockfile(f);
+  return i > 0 ? buf : 0;
+    139e:	31 c0                	xor    %eax,%eax
+    13a0:	85 d2                	test   %edx,%edx
+    13a2:	74 02                	je     13a6 <fgets+0x96>
+    13a4:	89 f8                	mov    %edi,%eax
+}
+    13a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13a9:	5b                   	pop    %ebx
+    13aa:	5e                   	pop    %esi
+    13ab:	5f                   	pop    %edi
+    13ac:	5d                   	pop    %ebp
+    13ad:	c3                   	ret
+    13ae:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    13b0:	83 ec 0c             	sub    $0xc,%esp
+    13b3:	8d 43 18             	lea    0x18(%ebx),%eax
+    13b6:	50                   	push   %eax
+    13b7:	e8 24 ef ff ff       	call   2e0 <mutex_lock>
+    13bc:	83 c4 10             	add    $0x10,%esp
+    13bf:	e9 69 ff ff ff       	jmp    132d <fgets+0x1d>
+    13c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    13c8:	83 ec 0c             	sub    $0xc,%esp
+    13cb:	83 c3 18             	add    $0x18,%ebx
+    13ce:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    13d1:	53                   	push   %ebx
+    13d2:	e8 59 ef ff ff       	call   330 <mutex_unlock>
+    13d7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    13da:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    13dd:	31 c0                	xor    %eax,%eax
+    13df:	85 d2                	test   %edx,%edx
+    13e1:	75 c1                	jne    13a4 <fgets+0x94>
+    13e3:	eb c1                	jmp    13a6 <fgets+0x96>
+    13e5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    13e8:	a1 00 28 00 00       	mov    0x2800,%eax
+  buf[i] = '\0';
+    13ed:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  if(threaded)
+    13f1:	85 c0                	test   %eax,%eax
+    13f3:	74 af                	je     13a4 <fgets+0x94>
+    mutex_unlock(&f->lock);
+    13f5:	83 ec 0c             	sub    $0xc,%esp
+    13f8:	83 c3 18             	add    $0x18,%ebx
+    13fb:	53                   	push   %ebx
+    13fc:	e8 2f ef ff ff       	call   330 <mutex_unlock>
+    1401:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    1404:	89 f8                	mov    %edi,%eax
+    1406:	eb 9e                	jmp    13a6 <fgets+0x96>
+    1408:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    140f:	90                   	nop
+
+00001410 <gets>:
+// at most a line per read(), goes through stdin's buffer: from a
+// file or pipe, a buffered read could take input meant for a child
+// process, so read a byte at a time.
+char*
+gets(char *buf, int max)
+{
+    1410:	55                   	push   %ebp
+    1411:	89 e5                	mov    %esp,%ebp
+    1413:	57                   	push   %edi
+    1414:	56                   	push   %esi
+    1415:	53                   	push   %ebx
+    1416:	83 ec 2c             	sub    $0x2c,%esp
+  int i, cc;
+  char c;
+
+  if(!(stdin->flags & IO_SETUP))
+    1419:	8b 15 04 27 00 00    	mov    0x2704,%edx
+{
+    141f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!(stdin->flags & IO_SETUP))
+    1422:	f6 c2 40             	test   $0x40,%dl
+    1425:	74 79                	je     14a0 <gets+0x90>
+    setup(stdin);
+  if(stdin->flags & IO_DEV){
+    1427:	83 e2 20             	and    $0x20,%edx
+    142a:	89 d7                	mov    %edx,%edi
+    142c:	75 52                	jne    1480 <gets+0x70>
+  if(f == 0){
+    142e:	e8 ed f5 ff ff       	call   a20 <fflush.part.0>
+    fgets(buf, max, stdin);
+    return buf;
+  }
+  fflush(0);
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1433:	8d 75 e7             	lea    -0x19(%ebp),%esi
+  for(i=0; i+1 < max; ){
+    1436:	eb 2c                	jmp    1464 <gets+0x54>
+    1438:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    143f:	90                   	nop
+    cc = read(0, &c, 1);
+    1440:	83 ec 04             	sub    $0x4,%esp
+    1443:	6a 01                	push   $0x1
+    1445:	56                   	push   %esi
+    1446:	6a 00                	push   $0x0
+    1448:	e8 f5 ef ff ff       	call   442 <read>
+    if(cc < 1)
+    144d:	83 c4 10             	add    $0x10,%esp
+    1450:	85 c0                	test   %eax,%eax
+    1452:	7e 1b                	jle    146f <gets+0x5f>
+      break;
+    buf[i++] = c;
+    1454:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1458:	88 44 3b ff          	mov    %al,-0x1(%ebx,%edi,1)
+    if(c == '\n' || c == '\r')
+    145c:	3c 0a                	cmp    $0xa,%al
+    145e:	74 12                	je     1472 <gets+0x62>
+    1460:	3c 0d                	cmp    $0xd,%al
+    1462:	74 0e                	je     1472 <gets+0x62>
+  for(i=0; i+1 < max; ){
+    1464:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    1467:	83 c7 01             	add    $0x1,%edi
+    146a:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+    146d:	7c d1                	jl     1440 <gets+0x30>
+{
+    146f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      break;
+  }
+  buf[i] = '\0';
+    1472:	c6 04 3b 00          	movb   $0x0,(%ebx,%edi,1)
+  return buf;
+}
+    1476:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1479:	89 d8                	mov    %ebx,%eax
+    147b:	5b                   	pop    %ebx
+    147c:	5e                   	pop    %esi
+    147d:	5f                   	pop    %edi
+    147e:	5d                   	pop    %ebp
+    147f:	c3                   	ret
+    fgets(buf, max, stdin);
+    1480:	83 ec 04             	sub    $0x4,%esp
+    1483:	68 00 27 00 00       	push   $0x2700
+    1488:	ff 75 0c             	push   0xc(%ebp)
+    148b:	53                   	push   %ebx
+    148c:	e8 7f fe ff ff       	call   1310 <fgets>
+    return buf;
+    1491:	83 c4 10             	add    $0x10,%esp
+}
+    1494:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1497:	89 d8                	mov    %ebx,%eax
+    1499:	5b                   	pop    %ebx
+    149a:	5e                   	pop    %esi
+    149b:	5f                   	pop    %edi
+    149c:	5d                   	pop    %ebp
+    149d:	c3                   	ret
+    149e:	66 90                	xchg   %ax,%ax
+    setup(stdin);
+    14a0:	b8 00 27 00 00       	mov    $0x2700,%eax
+    14a5:	e8 a6 f4 ff ff       	call   950 <setup>
+  if(stdin->flags & IO_DEV){
+    14aa:	8b 15 04 27 00 00    	mov    0x2704,%edx
+    14b0:	e9 72 ff ff ff       	jmp    1427 <gets+0x17>
+    14b5:	66 90                	xchg   %ax,%ax
+    14b7:	66 90                	xchg   %ax,%ax
+    14b9:	66 90                	xchg   %ax,%ax
+    14bb:	66 90                	xchg   %ax,%ax
+    14bd:	66 90                	xchg   %ax,%ax
+    14bf:	90                   	nop
+
+000014c0 <bigfree>:
+
+// Give a big block back to the first-fit list, and return the
+// free block that now holds it. Caller holds lock.
+static Header*
+bigfree(Header *bp)
+{
+    14c0:	55                   	push   %ebp
+    14c1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    14c3:	a1 a4 2e 00 00       	mov    0x2ea4,%eax
+{
+    14c8:	89 e5                	mov    %esp,%ebp
+    14ca:	56                   	push   %esi
+    14cb:	53                   	push   %ebx
+    14cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    14d0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    14d2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    14d4:	39 ca                	cmp    %ecx,%edx
+    14d6:	73 38                	jae    1510 <bigfree+0x50>
+    14d8:	39 c1                	cmp    %eax,%ecx
+    14da:	72 04                	jb     14e0 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    14dc:	39 c2                	cmp    %eax,%edx
+    14de:	72 f0                	jb     14d0 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    14e0:	8b 59 04             	mov    0x4(%ecx),%ebx
+    14e3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    14e6:	39 f0                	cmp    %esi,%eax
+    14e8:	74 36                	je     1520 <bigfree+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    14ea:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  freep = p;
+  if(p + p->s.size == bp){
+    14ec:	8b 42 04             	mov    0x4(%edx),%eax
+    14ef:	89 cb                	mov    %ecx,%ebx
+  freep = p;
+    14f1:	89 15 a4 2e 00 00    	mov    %edx,0x2ea4
+  if(p + p->s.size == bp){
+    14f7:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    14fa:	39 f1                	cmp    %esi,%ecx
+    14fc:	74 2e                	je     152c <bigfree+0x6c>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    14fe:	89 1a                	mov    %ebx,(%edx)
+    return p;
+  }
+  p->s.ptr = bp;
+  return bp;
+}
+    1500:	89 c8                	mov    %ecx,%eax
+    1502:	5b                   	pop    %ebx
+    1503:	5e                   	pop    %esi
+    1504:	5d                   	pop    %ebp
+    1505:	c3                   	ret
+    1506:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    150d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1510:	39 c1                	cmp    %eax,%ecx
+    1512:	72 c8                	jb     14dc <bigfree+0x1c>
+    1514:	eb ba                	jmp    14d0 <bigfree+0x10>
+    1516:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    151d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1520:	03 58 04             	add    0x4(%eax),%ebx
+    1523:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1526:	8b 02                	mov    (%edx),%eax
+    1528:	8b 00                	mov    (%eax),%eax
+    152a:	eb be                	jmp    14ea <bigfree+0x2a>
+    p->s.size += bp->s.size;
+    152c:	03 41 04             	add    0x4(%ecx),%eax
+    152f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1532:	8b 19                	mov    (%ecx),%ebx
+    return p;
+    1534:	89 d1                	mov    %edx,%ecx
+}
+    1536:	89 c8                	mov    %ecx,%eax
+    p->s.ptr = bp->s.ptr;
+    1538:	89 1a                	mov    %ebx,(%edx)
+}
+    153a:	5b                   	pop    %ebx
+    153b:	5e                   	pop    %esi
+    153c:	5d                   	pop    %ebp
+    153d:	c3                   	ret
+    153e:	66 90                	xchg   %ax,%ax
+
+00001540 <trim>:
+// If free block bp ends the heap, return its whole pages to the
+// kernel, unless something else has moved the break since.
+// Caller holds lock.
+static void
+trim(Header *bp)
+{
+    1540:	55                   	push   %ebp
+    1541:	89 e5                	mov    %esp,%ebp
+    1543:	57                   	push   %edi
+    1544:	56                   	push   %esi
+    1545:	53                   	push   %ebx
+    1546:	89 c3                	mov    %eax,%ebx
+    1548:	83 ec 0c             	sub    $0xc,%esp
+  char *end;
+  uint n;
+
+  if((char*)(bp + bp->s.size) != heapend)
+    154b:	8b 53 04             	mov    0x4(%ebx),%edx
+    154e:	a1 a0 2e 00 00       	mov    0x2ea0,%eax
+    1553:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+    1556:	39 d0                	cmp    %edx,%eax
+    1558:	74 0e                	je     1568 <trim+0x28>
+  n = heapend - end;
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    bp->s.size -= n / sizeof(Header);
+    heapend = end;
+  }
+}
+    155a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    155d:	5b                   	pop    %ebx
+    155e:	5e                   	pop    %esi
+    155f:	5f                   	pop    %edi
+    1560:	5d                   	pop    %ebp
+    1561:	c3                   	ret
+    1562:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  end = (char*)PGROUNDUP((uint)(bp + 2));
+    1568:	8d bb 0f 10 00 00    	lea    0x100f(%ebx),%edi
+    156e:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  n = heapend - end;
+    1574:	29 f8                	sub    %edi,%eax
+    1576:	89 c6                	mov    %eax,%esi
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    1578:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    157d:	76 db                	jbe    155a <trim+0x1a>
+    157f:	83 ec 0c             	sub    $0xc,%esp
+    1582:	6a 00                	push   $0x0
+    1584:	e8 8b ef ff ff       	call   514 <sbrk>
+    1589:	83 c4 10             	add    $0x10,%esp
+    158c:	39 05 a0 2e 00 00    	cmp    %eax,0x2ea0
+    1592:	75 c6                	jne    155a <trim+0x1a>
+    1594:	89 f0                	mov    %esi,%eax
+    1596:	83 ec 0c             	sub    $0xc,%esp
+    1599:	f7 d8                	neg    %eax
+    159b:	50                   	push   %eax
+    159c:	e8 73 ef ff ff       	call   514 <sbrk>
+    15a1:	83 c4 10             	add    $0x10,%esp
+    15a4:	83 f8 ff             	cmp    $0xffffffff,%eax
+    15a7:	74 b1                	je     155a <trim+0x1a>
+    bp->s.size -= n / sizeof(Header);
+    15a9:	89 f0                	mov    %esi,%eax
+    heapend = end;
+    15ab:	89 3d a0 2e 00 00    	mov    %edi,0x2ea0
+    bp->s.size -= n / sizeof(Header);
+    15b1:	c1 e8 03             	shr    $0x3,%eax
+    15b4:	29 43 04             	sub    %eax,0x4(%ebx)
+    heapend = end;
+    15b7:	eb a1                	jmp    155a <trim+0x1a>
+    15b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000015c0 <bigalloc>:
+}
+
+// Allocate a big block of nunits units. Caller holds lock.
+static Header*
+bigalloc(uint nunits)
+{
+    15c0:	55                   	push   %ebp
+    15c1:	89 e5                	mov    %esp,%ebp
+    15c3:	57                   	push   %edi
+    15c4:	89 c7                	mov    %eax,%edi
+    15c6:	56                   	push   %esi
+    15c7:	53                   	push   %ebx
+    15c8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    15cb:	a1 a4 2e 00 00       	mov    0x2ea4,%eax
+    15d0:	85 c0                	test   %eax,%eax
+    15d2:	0f 84 98 00 00 00    	je     1670 <bigalloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    15d8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    15da:	8b 4a 04             	mov    0x4(%edx),%ecx
+    15dd:	39 f9                	cmp    %edi,%ecx
+    15df:	73 67                	jae    1648 <bigalloc+0x88>
+  if(nu < 4096)
+    15e1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    15e6:	39 df                	cmp    %ebx,%edi
+    15e8:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    15eb:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    15f2:	eb 0d                	jmp    1601 <bigalloc+0x41>
+    15f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    15f8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    15fa:	8b 4a 04             	mov    0x4(%edx),%ecx
+    15fd:	39 f9                	cmp    %edi,%ecx
+    15ff:	73 47                	jae    1648 <bigalloc+0x88>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    1601:	89 d0                	mov    %edx,%eax
+    1603:	39 15 a4 2e 00 00    	cmp    %edx,0x2ea4
+    1609:	75 ed                	jne    15f8 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    160b:	83 ec 0c             	sub    $0xc,%esp
+    160e:	56                   	push   %esi
+    160f:	e8 00 ef ff ff       	call   514 <sbrk>
+  if(p == (char*)-1)
+    1614:	83 c4 10             	add    $0x10,%esp
+    1617:	83 f8 ff             	cmp    $0xffffffff,%eax
+    161a:	74 1a                	je     1636 <bigalloc+0x76>
+  hp->s.size = nu;
+    161c:	89 58 04             	mov    %ebx,0x4(%eax)
+  heapend = p + nu * sizeof(Header);
+    161f:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    1622:	89 15 a0 2e 00 00    	mov    %edx,0x2ea0
+  bigfree(hp);
+    1628:	e8 93 fe ff ff       	call   14c0 <bigfree>
+  return freep;
+    162d:	a1 a4 2e 00 00       	mov    0x2ea4,%eax
+      if((p = morecore(nunits)) == 0)
+    1632:	85 c0                	test   %eax,%eax
+    1634:	75 c2                	jne    15f8 <bigalloc+0x38>
+        return 0;
+  }
+}
+    1636:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1639:	31 d2                	xor    %edx,%edx
+}
+    163b:	5b                   	pop    %ebx
+    163c:	89 d0                	mov    %edx,%eax
+    163e:	5e                   	pop    %esi
+    163f:	5f                   	pop    %edi
+    1640:	5d                   	pop    %ebp
+    1641:	c3                   	ret
+    1642:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1648:	39 cf                	cmp    %ecx,%edi
+    164a:	74 54                	je     16a0 <bigalloc+0xe0>
+        p->s.size -= nunits;
+    164c:	29 f9                	sub    %edi,%ecx
+    164e:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    1651:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    1654:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    1657:	a3 a4 2e 00 00       	mov    %eax,0x2ea4
+}
+    165c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    165f:	89 d0                	mov    %edx,%eax
+    1661:	5b                   	pop    %ebx
+    1662:	5e                   	pop    %esi
+    1663:	5f                   	pop    %edi
+    1664:	5d                   	pop    %ebp
+    1665:	c3                   	ret
+    1666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    166d:	8d 76 00             	lea    0x0(%esi),%esi
+    base.s.ptr = freep = prevp = &base;
+    1670:	c7 05 a4 2e 00 00 a8 	movl   $0x2ea8,0x2ea4
+    1677:	2e 00 00 
+    base.s.size = 0;
+    167a:	ba a8 2e 00 00       	mov    $0x2ea8,%edx
+    base.s.ptr = freep = prevp = &base;
+    167f:	c7 05 a8 2e 00 00 a8 	movl   $0x2ea8,0x2ea8
+    1686:	2e 00 00 
+    base.s.size = 0;
+    1689:	c7 05 ac 2e 00 00 00 	movl   $0x0,0x2eac
+    1690:	00 00 00 
+    if(p->s.size >= nunits){
+    1693:	e9 49 ff ff ff       	jmp    15e1 <bigalloc+0x21>
+    1698:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    169f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    16a0:	8b 0a                	mov    (%edx),%ecx
+    16a2:	89 08                	mov    %ecx,(%eax)
+    16a4:	eb b1                	jmp    1657 <bigalloc+0x97>
+    16a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000016b0 <drain>:
+}
+
+// Move n blocks of class c from cache tc to the shared list.
+static void
+drain(struct tcache *tc, int c, int n)
+{
+    16b0:	55                   	push   %ebp
+    16b1:	89 e5                	mov    %esp,%ebp
+    16b3:	57                   	push   %edi
+    16b4:	89 c7                	mov    %eax,%edi
+    16b6:	56                   	push   %esi
+    16b7:	89 d6                	mov    %edx,%esi
+    16b9:	53                   	push   %ebx
+    16ba:	89 cb                	mov    %ecx,%ebx
+    16bc:	83 ec 0c             	sub    $0xc,%esp
+  if(threaded)
+    16bf:	8b 15 24 2e 00 00    	mov    0x2e24,%edx
+    16c5:	85 d2                	test   %edx,%edx
+    16c7:	75 57                	jne    1720 <drain+0x70>
+  Header *p;
+
+  acquire();
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    16c9:	85 c9                	test   %ecx,%ecx
+    16cb:	7e 49                	jle    1716 <drain+0x66>
+    16cd:	89 d9                	mov    %ebx,%ecx
+    16cf:	8d 14 b7             	lea    (%edi,%esi,4),%edx
+    16d2:	eb 23                	jmp    16f7 <drain+0x47>
+    16d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    tc->list[c] = p->s.ptr;
+    16d8:	8b 18                	mov    (%eax),%ebx
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    16da:	83 e9 01             	sub    $0x1,%ecx
+    tc->n[c]--;
+    16dd:	83 6a 20 01          	subl   $0x1,0x20(%edx)
+    tc->list[c] = p->s.ptr;
+    16e1:	89 1a                	mov    %ebx,(%edx)
+    p->s.ptr = small[c];
+    16e3:	8b 1c b5 80 2e 00 00 	mov    0x2e80(,%esi,4),%ebx
+    16ea:	89 18                	mov    %ebx,(%eax)
+    small[c] = p;
+    16ec:	89 04 b5 80 2e 00 00 	mov    %eax,0x2e80(,%esi,4)
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    16f3:	85 c9                	test   %ecx,%ecx
+    16f5:	7e 06                	jle    16fd <drain+0x4d>
+    16f7:	8b 02                	mov    (%edx),%eax
+    16f9:	85 c0                	test   %eax,%eax
+    16fb:	75 db                	jne    16d8 <drain+0x28>
+  if(threaded)
+    16fd:	a1 24 2e 00 00       	mov    0x2e24,%eax
+    1702:	85 c0                	test   %eax,%eax
+    1704:	74 10                	je     1716 <drain+0x66>
+    mutex_unlock(&lock);
+    1706:	83 ec 0c             	sub    $0xc,%esp
+    1709:	68 28 2e 00 00       	push   $0x2e28
+    170e:	e8 1d ec ff ff       	call   330 <mutex_unlock>
+}
+    1713:	83 c4 10             	add    $0x10,%esp
+  }
+  release();
+}
+    1716:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1719:	5b                   	pop    %ebx
+    171a:	5e                   	pop    %esi
+    171b:	5f                   	pop    %edi
+    171c:	5d                   	pop    %ebp
+    171d:	c3                   	ret
+    171e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&lock);
+    1720:	83 ec 0c             	sub    $0xc,%esp
+    1723:	68 28 2e 00 00       	push   $0x2e28
+    1728:	e8 b3 eb ff ff       	call   2e0 <mutex_lock>
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    172d:	83 c4 10             	add    $0x10,%esp
+    1730:	85 db                	test   %ebx,%ebx
+    1732:	7f 99                	jg     16cd <drain+0x1d>
+    1734:	eb c7                	jmp    16fd <drain+0x4d>
+    1736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    173d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001740 <mycache>:
+{
+    1740:	55                   	push   %ebp
+    return &maincache;
+    1741:	b8 40 2e 00 00       	mov    $0x2e40,%eax
+{
+    1746:	89 e5                	mov    %esp,%ebp
+    1748:	53                   	push   %ebx
+  sp = PGROUNDDOWN((uint)&sp);
+    1749:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+    174c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+    1752:	83 ec 14             	sub    $0x14,%esp
+  if(!threaded || sp == mainstack)
+    1755:	8b 0d 24 2e 00 00    	mov    0x2e24,%ecx
+  sp = PGROUNDDOWN((uint)&sp);
+    175b:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  if(!threaded || sp == mainstack)
+    175e:	85 c9                	test   %ecx,%ecx
+    1760:	74 0f                	je     1771 <mycache+0x31>
+    1762:	3b 1d 20 2e 00 00    	cmp    0x2e20,%ebx
+    1768:	74 07                	je     1771 <mycache+0x31>
+  if(*cp == 0){
+    176a:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    176d:	85 c0                	test   %eax,%eax
+    176f:	74 0f                	je     1780 <mycache+0x40>
+}
+    1771:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1774:	c9                   	leave
+    1775:	c3                   	ret
+    1776:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    177d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1780:	83 ec 0c             	sub    $0xc,%esp
+    1783:	68 28 2e 00 00       	push   $0x2e28
+    1788:	e8 53 eb ff ff       	call   2e0 <mutex_lock>
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    178d:	b8 09 00 00 00       	mov    $0x9,%eax
+    1792:	e8 29 fe ff ff       	call   15c0 <bigalloc>
+  if(threaded)
+    1797:	8b 15 24 2e 00 00    	mov    0x2e24,%edx
+    179d:	83 c4 10             	add    $0x10,%esp
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    17a0:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(threaded)
+    17a3:	85 d2                	test   %edx,%edx
+    17a5:	75 29                	jne    17d0 <mycache+0x90>
+    if(*cp == 0)
+    17a7:	85 c0                	test   %eax,%eax
+    17a9:	74 c6                	je     1771 <mycache+0x31>
+    memset(*cp, 0, sizeof(**cp));
+    17ab:	83 ec 04             	sub    $0x4,%esp
+    *cp = (struct tcache*)((Header*)*cp + 1);
+    17ae:	83 c0 08             	add    $0x8,%eax
+    17b1:	89 43 f8             	mov    %eax,-0x8(%ebx)
+    memset(*cp, 0, sizeof(**cp));
+    17b4:	6a 40                	push   $0x40
+    17b6:	6a 00                	push   $0x0
+    17b8:	50                   	push   %eax
+    17b9:	e8 f2 e9 ff ff       	call   1b0 <memset>
+  return *cp;
+    17be:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    17c1:	83 c4 10             	add    $0x10,%esp
+    17c4:	eb ab                	jmp    1771 <mycache+0x31>
+    17c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17cd:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    17d0:	83 ec 0c             	sub    $0xc,%esp
+    17d3:	68 28 2e 00 00       	push   $0x2e28
+    17d8:	e8 53 eb ff ff       	call   330 <mutex_unlock>
+    if(*cp == 0)
+    17dd:	8b 43 f8             	mov    -0x8(%ebx),%eax
+}
+    17e0:	83 c4 10             	add    $0x10,%esp
+    17e3:	eb c2                	jmp    17a7 <mycache+0x67>
+    17e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000017f0 <free>:
+
+void
+free(void *ap)
+{
+    17f0:	55                   	push   %ebp
+    17f1:	89 e5                	mov    %esp,%ebp
+    17f3:	57                   	push   %edi
+    17f4:	56                   	push   %esi
+    17f5:	53                   	push   %ebx
+    17f6:	83 ec 1c             	sub    $0x1c,%esp
+    17f9:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  struct tcache *tc;
+  int c;
+
+  if(ap == 0)
+    17fc:	85 f6                	test   %esi,%esi
+    17fe:	74 51                	je     1851 <free+0x61>
+    return;
+  bp = (Header*)ap - 1;
+    1800:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1803:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(bp->s.size > SMALLMAX / sizeof(Header)){
+    1806:	8b 46 fc             	mov    -0x4(%esi),%eax
+    1809:	3d 00 01 00 00       	cmp    $0x100,%eax
+    180e:	77 50                	ja     1860 <free+0x70>
+    acquire();
+    trim(bigfree(bp));
+    release();
+    return;
+  }
+  for(c = 0; (2 << c) < bp->s.size; c++)
+    1810:	31 db                	xor    %ebx,%ebx
+    1812:	ba 02 00 00 00       	mov    $0x2,%edx
+    1817:	83 f8 02             	cmp    $0x2,%eax
+    181a:	76 11                	jbe    182d <free+0x3d>
+    181c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1820:	83 c3 01             	add    $0x1,%ebx
+    1823:	89 d7                	mov    %edx,%edi
+    1825:	89 d9                	mov    %ebx,%ecx
+    1827:	d3 e7                	shl    %cl,%edi
+    1829:	39 c7                	cmp    %eax,%edi
+    182b:	72 f3                	jb     1820 <free+0x30>
+    ;
+  if((tc = mycache()) == 0){
+    182d:	e8 0e ff ff ff       	call   1740 <mycache>
+    1832:	85 c0                	test   %eax,%eax
+    1834:	74 7a                	je     18b0 <free+0xc0>
+    bp->s.ptr = small[c];
+    small[c] = bp;
+    release();
+    return;
+  }
+  bp->s.ptr = tc->list[c];
+    1836:	8d 0c 98             	lea    (%eax,%ebx,4),%ecx
+    1839:	8b 11                	mov    (%ecx),%edx
+    183b:	89 56 f8             	mov    %edx,-0x8(%esi)
+  tc->list[c] = bp;
+    183e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1841:	89 31                	mov    %esi,(%ecx)
+  if(++tc->n[c] > TCACHEMAX)
+    1843:	8b 71 20             	mov    0x20(%ecx),%esi
+    1846:	8d 56 01             	lea    0x1(%esi),%edx
+    1849:	89 51 20             	mov    %edx,0x20(%ecx)
+    184c:	83 fa 20             	cmp    $0x20,%edx
+    184f:	7f 47                	jg     1898 <free+0xa8>
+    drain(tc, c, BATCH);
+}
+    1851:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1854:	5b                   	pop    %ebx
+    1855:	5e                   	pop    %esi
+    1856:	5f                   	pop    %edi
+    1857:	5d                   	pop    %ebp
+    1858:	c3                   	ret
+    1859:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1860:	8b 1d 24 2e 00 00    	mov    0x2e24,%ebx
+    1866:	85 db                	test   %ebx,%ebx
+    1868:	75 66                	jne    18d0 <free+0xe0>
+    trim(bigfree(bp));
+    186a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    186d:	e8 4e fc ff ff       	call   14c0 <bigfree>
+    1872:	e8 c9 fc ff ff       	call   1540 <trim>
+  if(threaded)
+    1877:	8b 0d 24 2e 00 00    	mov    0x2e24,%ecx
+    187d:	85 c9                	test   %ecx,%ecx
+    187f:	74 d0                	je     1851 <free+0x61>
+    mutex_unlock(&lock);
+    1881:	c7 45 08 28 2e 00 00 	movl   $0x2e28,0x8(%ebp)
+}
+    1888:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    188b:	5b                   	pop    %ebx
+    188c:	5e                   	pop    %esi
+    188d:	5f                   	pop    %edi
+    188e:	5d                   	pop    %ebp
+    mutex_unlock(&lock);
+    188f:	e9 9c ea ff ff       	jmp    330 <mutex_unlock>
+    1894:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    1898:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    drain(tc, c, BATCH);
+    189b:	89 da                	mov    %ebx,%edx
+    189d:	b9 10 00 00 00       	mov    $0x10,%ecx
+}
+    18a2:	5b                   	pop    %ebx
+    18a3:	5e                   	pop    %esi
+    18a4:	5f                   	pop    %edi
+    18a5:	5d                   	pop    %ebp
+    drain(tc, c, BATCH);
+    18a6:	e9 05 fe ff ff       	jmp    16b0 <drain>
+    18ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    18af:	90                   	nop
+  if(threaded)
+    18b0:	8b 15 24 2e 00 00    	mov    0x2e24,%edx
+    18b6:	85 d2                	test   %edx,%edx
+    18b8:	75 28                	jne    18e2 <free+0xf2>
+    bp->s.ptr = small[c];
+    18ba:	8b 04 9d 80 2e 00 00 	mov    0x2e80(,%ebx,4),%eax
+    18c1:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    18c4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    18c7:	89 04 9d 80 2e 00 00 	mov    %eax,0x2e80(,%ebx,4)
+  if(threaded)
+    18ce:	eb 81                	jmp    1851 <free+0x61>
+    mutex_lock(&lock);
+    18d0:	83 ec 0c             	sub    $0xc,%esp
+    18d3:	68 28 2e 00 00       	push   $0x2e28
+    18d8:	e8 03 ea ff ff       	call   2e0 <mutex_lock>
+}
+    18dd:	83 c4 10             	add    $0x10,%esp
+    18e0:	eb 88                	jmp    186a <free+0x7a>
+    mutex_lock(&lock);
+    18e2:	83 ec 0c             	sub    $0xc,%esp
+    18e5:	68 28 2e 00 00       	push   $0x2e28
+    18ea:	e8 f1 e9 ff ff       	call   2e0 <mutex_lock>
+    bp->s.ptr = small[c];
+    18ef:	8b 04 9d 80 2e 00 00 	mov    0x2e80(,%ebx,4),%eax
+  if(threaded)
+    18f6:	83 c4 10             	add    $0x10,%esp
+    bp->s.ptr = small[c];
+    18f9:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    18fc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    18ff:	89 04 9d 80 2e 00 00 	mov    %eax,0x2e80(,%ebx,4)
+  if(threaded)
+    1906:	a1 24 2e 00 00       	mov    0x2e24,%eax
+    190b:	85 c0                	test   %eax,%eax
+    190d:	0f 85 6e ff ff ff    	jne    1881 <free+0x91>
+    1913:	e9 39 ff ff ff       	jmp    1851 <free+0x61>
+    1918:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    191f:	90                   	nop
+
+00001920 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1920:	55                   	push   %ebp
+    1921:	89 e5                	mov    %esp,%ebp
+    1923:	57                   	push   %edi
+    1924:	56                   	push   %esi
+    1925:	53                   	push   %ebx
+    1926:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  struct tcache *tc;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1929:	8b 45 08             	mov    0x8(%ebp),%eax
+    192c:	8d 78 07             	lea    0x7(%eax),%edi
+    192f:	c1 ef 03             	shr    $0x3,%edi
+    1932:	83 c7 01             	add    $0x1,%edi
+  if(nunits > SMALLMAX / sizeof(Header)){
+    1935:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+    193b:	77 5b                	ja     1998 <malloc+0x78>
+    acquire();
+    p = bigalloc(nunits);
+    release();
+    return p ? (void*)(p + 1) : 0;
+  }
+  for(c = 0; (2 << c) < nunits; c++)
+    193d:	31 c9                	xor    %ecx,%ecx
+    193f:	b8 02 00 00 00       	mov    $0x2,%eax
+    1944:	be 02 00 00 00       	mov    $0x2,%esi
+    1949:	bb 02 00 00 00       	mov    $0x2,%ebx
+    194e:	83 ff 02             	cmp    $0x2,%edi
+    1951:	76 12                	jbe    1965 <malloc+0x45>
+    1953:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1957:	90                   	nop
+    1958:	83 c1 01             	add    $0x1,%ecx
+    195b:	89 c3                	mov    %eax,%ebx
+    195d:	d3 e3                	shl    %cl,%ebx
+    195f:	89 de                	mov    %ebx,%esi
+    1961:	39 fb                	cmp    %edi,%ebx
+    1963:	72 f3                	jb     1958 <malloc+0x38>
+    1965:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    ;
+  if((tc = mycache()) == 0)
+    1968:	e8 d3 fd ff ff       	call   1740 <mycache>
+    196d:	85 c0                	test   %eax,%eax
+    196f:	74 51                	je     19c2 <malloc+0xa2>
+    return 0;
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1971:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1974:	8d 3c 88             	lea    (%eax,%ecx,4),%edi
+    1977:	8b 07                	mov    (%edi),%eax
+    1979:	85 c0                	test   %eax,%eax
+    197b:	74 53                	je     19d0 <malloc+0xb0>
+    return 0;
+  p = tc->list[c];
+  tc->list[c] = p->s.ptr;
+  tc->n[c]--;
+    197d:	8b 57 20             	mov    0x20(%edi),%edx
+  tc->list[c] = p->s.ptr;
+    1980:	8b 08                	mov    (%eax),%ecx
+  tc->n[c]--;
+    1982:	83 ea 01             	sub    $0x1,%edx
+  return (void*)(p + 1);
+    1985:	83 c0 08             	add    $0x8,%eax
+  tc->n[c]--;
+    1988:	89 57 20             	mov    %edx,0x20(%edi)
+  tc->list[c] = p->s.ptr;
+    198b:	89 0f                	mov    %ecx,(%edi)
+}
+    198d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1990:	5b                   	pop    %ebx
+    1991:	5e                   	pop    %esi
+    1992:	5f                   	pop    %edi
+    1993:	5d                   	pop    %ebp
+    1994:	c3                   	ret
+    1995:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1998:	a1 24 2e 00 00       	mov    0x2e24,%eax
+    199d:	85 c0                	test   %eax,%eax
+    199f:	0f 85 b3 00 00 00    	jne    1a58 <malloc+0x138>
+    p = bigalloc(nunits);
+    19a5:	89 f8                	mov    %edi,%eax
+    19a7:	e8 14 fc ff ff       	call   15c0 <bigalloc>
+    19ac:	89 c3                	mov    %eax,%ebx
+  if(threaded)
+    19ae:	a1 24 2e 00 00       	mov    0x2e24,%eax
+    19b3:	85 c0                	test   %eax,%eax
+    19b5:	0f 85 85 00 00 00    	jne    1a40 <malloc+0x120>
+    return p ? (void*)(p + 1) : 0;
+    19bb:	8d 43 08             	lea    0x8(%ebx),%eax
+    19be:	85 db                	test   %ebx,%ebx
+    19c0:	75 cb                	jne    198d <malloc+0x6d>
+    19c2:	31 c0                	xor    %eax,%eax
+}
+    19c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19c7:	5b                   	pop    %ebx
+    19c8:	5e                   	pop    %esi
+    19c9:	5f                   	pop    %edi
+    19ca:	5d                   	pop    %ebp
+    19cb:	c3                   	ret
+    19cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    19d0:	a1 24 2e 00 00       	mov    0x2e24,%eax
+    19d5:	85 c0                	test   %eax,%eax
+    19d7:	0f 85 29 01 00 00    	jne    1b06 <malloc+0x1e6>
+  if(small[c] == 0){
+    19dd:	8b 04 8d 80 2e 00 00 	mov    0x2e80(,%ecx,4),%eax
+    19e4:	85 c0                	test   %eax,%eax
+    19e6:	0f 84 81 00 00 00    	je     1a6d <malloc+0x14d>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    19ec:	31 db                	xor    %ebx,%ebx
+    19ee:	eb 22                	jmp    1a12 <malloc+0xf2>
+    small[c] = p->s.ptr;
+    19f0:	8b 10                	mov    (%eax),%edx
+  for(moved = 0; moved < n && small[c]; moved++){
+    19f2:	83 c3 01             	add    $0x1,%ebx
+    small[c] = p->s.ptr;
+    19f5:	89 14 8d 80 2e 00 00 	mov    %edx,0x2e80(,%ecx,4)
+    p->s.ptr = tc->list[c];
+    19fc:	8b 17                	mov    (%edi),%edx
+    19fe:	89 10                	mov    %edx,(%eax)
+    tc->list[c] = p;
+    1a00:	89 07                	mov    %eax,(%edi)
+  for(moved = 0; moved < n && small[c]; moved++){
+    1a02:	83 fb 10             	cmp    $0x10,%ebx
+    1a05:	0f 84 e2 00 00 00    	je     1aed <malloc+0x1cd>
+    1a0b:	8b 04 8d 80 2e 00 00 	mov    0x2e80(,%ecx,4),%eax
+    1a12:	85 c0                	test   %eax,%eax
+    1a14:	75 da                	jne    19f0 <malloc+0xd0>
+  if(threaded)
+    1a16:	8b 15 24 2e 00 00    	mov    0x2e24,%edx
+    1a1c:	85 d2                	test   %edx,%edx
+    1a1e:	0f 85 b4 00 00 00    	jne    1ad8 <malloc+0x1b8>
+  tc->n[c] += moved;
+    1a24:	8b 57 20             	mov    0x20(%edi),%edx
+    1a27:	01 da                	add    %ebx,%edx
+    1a29:	89 57 20             	mov    %edx,0x20(%edi)
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1a2c:	85 db                	test   %ebx,%ebx
+    1a2e:	74 92                	je     19c2 <malloc+0xa2>
+  p = tc->list[c];
+    1a30:	8b 07                	mov    (%edi),%eax
+    1a32:	e9 49 ff ff ff       	jmp    1980 <malloc+0x60>
+    1a37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a3e:	66 90                	xchg   %ax,%ax
+    mutex_unlock(&lock);
+    1a40:	83 ec 0c             	sub    $0xc,%esp
+    1a43:	68 28 2e 00 00       	push   $0x2e28
+    1a48:	e8 e3 e8 ff ff       	call   330 <mutex_unlock>
+}
+    1a4d:	83 c4 10             	add    $0x10,%esp
+    1a50:	e9 66 ff ff ff       	jmp    19bb <malloc+0x9b>
+    1a55:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1a58:	83 ec 0c             	sub    $0xc,%esp
+    1a5b:	68 28 2e 00 00       	push   $0x2e28
+    1a60:	e8 7b e8 ff ff       	call   2e0 <mutex_lock>
+}
+    1a65:	83 c4 10             	add    $0x10,%esp
+    1a68:	e9 38 ff ff ff       	jmp    19a5 <malloc+0x85>
+    if((chunk = bigalloc(CHUNK / sizeof(Header) + 1)) == 0){
+    1a6d:	b8 01 02 00 00       	mov    $0x201,%eax
+    1a72:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1a75:	e8 46 fb ff ff       	call   15c0 <bigalloc>
+    1a7a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1a7d:	85 c0                	test   %eax,%eax
+    1a7f:	89 c2                	mov    %eax,%edx
+    1a81:	0f 84 ba 00 00 00    	je     1b41 <malloc+0x221>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1a87:	83 c2 08             	add    $0x8,%edx
+    1a8a:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+    1a90:	0f 87 d0 00 00 00    	ja     1b66 <malloc+0x246>
+    1a96:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+    1a9d:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    1aa0:	89 df                	mov    %ebx,%edi
+    1aa2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1aa5:	8d 76 00             	lea    0x0(%esi),%esi
+      p->s.size = units;
+    1aa8:	89 72 04             	mov    %esi,0x4(%edx)
+      p->s.ptr = small[c];
+    1aab:	8b 04 8d 80 2e 00 00 	mov    0x2e80(,%ecx,4),%eax
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1ab2:	01 df                	add    %ebx,%edi
+    1ab4:	89 55 e0             	mov    %edx,-0x20(%ebp)
+      p->s.ptr = small[c];
+    1ab7:	89 02                	mov    %eax,(%edx)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1ab9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      small[c] = p;
+    1abc:	89 14 8d 80 2e 00 00 	mov    %edx,0x2e80(,%ecx,4)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1ac3:	01 c2                	add    %eax,%edx
+    1ac5:	81 ff 00 02 00 00    	cmp    $0x200,%edi
+    1acb:	76 db                	jbe    1aa8 <malloc+0x188>
+    1acd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1ad0:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1ad3:	e9 14 ff ff ff       	jmp    19ec <malloc+0xcc>
+    mutex_unlock(&lock);
+    1ad8:	83 ec 0c             	sub    $0xc,%esp
+    1adb:	68 28 2e 00 00       	push   $0x2e28
+    1ae0:	e8 4b e8 ff ff       	call   330 <mutex_unlock>
+}
+    1ae5:	83 c4 10             	add    $0x10,%esp
+    1ae8:	e9 37 ff ff ff       	jmp    1a24 <malloc+0x104>
+  if(threaded)
+    1aed:	a1 24 2e 00 00       	mov    0x2e24,%eax
+    1af2:	85 c0                	test   %eax,%eax
+    1af4:	75 2b                	jne    1b21 <malloc+0x201>
+  tc->n[c] += moved;
+    1af6:	8b 47 20             	mov    0x20(%edi),%eax
+    1af9:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1afc:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1afe:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1b01:	e9 7a fe ff ff       	jmp    1980 <malloc+0x60>
+    mutex_lock(&lock);
+    1b06:	83 ec 0c             	sub    $0xc,%esp
+    1b09:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1b0c:	68 28 2e 00 00       	push   $0x2e28
+    1b11:	e8 ca e7 ff ff       	call   2e0 <mutex_lock>
+}
+    1b16:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1b19:	83 c4 10             	add    $0x10,%esp
+    1b1c:	e9 bc fe ff ff       	jmp    19dd <malloc+0xbd>
+    mutex_unlock(&lock);
+    1b21:	83 ec 0c             	sub    $0xc,%esp
+    1b24:	68 28 2e 00 00       	push   $0x2e28
+    1b29:	e8 02 e8 ff ff       	call   330 <mutex_unlock>
+  tc->n[c] += moved;
+    1b2e:	8b 47 20             	mov    0x20(%edi),%eax
+    1b31:	83 c4 10             	add    $0x10,%esp
+    1b34:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1b37:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1b39:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1b3c:	e9 3f fe ff ff       	jmp    1980 <malloc+0x60>
+  if(threaded)
+    1b41:	8b 0d 24 2e 00 00    	mov    0x2e24,%ecx
+    1b47:	85 c9                	test   %ecx,%ecx
+    1b49:	0f 84 73 fe ff ff    	je     19c2 <malloc+0xa2>
+    mutex_unlock(&lock);
+    1b4f:	83 ec 0c             	sub    $0xc,%esp
+    1b52:	68 28 2e 00 00       	push   $0x2e28
+    1b57:	e8 d4 e7 ff ff       	call   330 <mutex_unlock>
+    1b5c:	83 c4 10             	add    $0x10,%esp
+    return p ? (void*)(p + 1) : 0;
+    1b5f:	31 c0                	xor    %eax,%eax
+    1b61:	e9 5e fe ff ff       	jmp    19c4 <malloc+0xa4>
+  for(moved = 0; moved < n && small[c]; moved++){
+    1b66:	8b 04 8d 80 2e 00 00 	mov    0x2e80(,%ecx,4),%eax
+    1b6d:	e9 7a fe ff ff       	jmp    19ec <malloc+0xcc>
+    1b72:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001b80 <malloc_threaded>:
+void
+malloc_threaded(void)
+{
+  uint sp;
+
+  if(threaded)
+    1b80:	a1 24 2e 00 00       	mov    0x2e24,%eax
+    1b85:	85 c0                	test   %eax,%eax
+    1b87:	74 07                	je     1b90 <malloc_threaded+0x10>
+    1b89:	c3                   	ret
+    1b8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+{
+    1b90:	55                   	push   %ebp
+    1b91:	89 e5                	mov    %esp,%ebp
+    1b93:	83 ec 24             	sub    $0x24,%esp
+    return;
+  mutex_init(&lock);
+    1b96:	68 28 2e 00 00       	push   $0x2e28
+    1b9b:	e8 30 e7 ff ff       	call   2d0 <mutex_init>
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1ba0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1ba3:	83 c4 10             	add    $0x10,%esp
+  threaded = 1;
+    1ba6:	c7 05 24 2e 00 00 01 	movl   $0x1,0x2e24
+    1bad:	00 00 00 
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1bb0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    1bb5:	a3 20 2e 00 00       	mov    %eax,0x2e20
+}
+    1bba:	c9                   	leave
+    1bbb:	c3                   	ret
+    1bbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001bc0 <malloc_thread_exit>:
+
+// Called by thread_join() with the cache slot of a finished
+// thread: give its blocks, and the cache itself, back.
+void
+malloc_thread_exit(void **cachep)
+{
+    1bc0:	55                   	push   %ebp
+    1bc1:	89 e5                	mov    %esp,%ebp
+    1bc3:	57                   	push   %edi
+    1bc4:	56                   	push   %esi
+    1bc5:	53                   	push   %ebx
+    1bc6:	83 ec 0c             	sub    $0xc,%esp
+    1bc9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct tcache *tc;
+  int c;
+
+  if((tc = *cachep) == 0)
+    1bcc:	8b 37                	mov    (%edi),%esi
+    1bce:	85 f6                	test   %esi,%esi
+    1bd0:	74 41                	je     1c13 <malloc_thread_exit+0x53>
+    return;
+  for(c = 0; c < NCLASS; c++)
+    1bd2:	31 db                	xor    %ebx,%ebx
+    1bd4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    drain(tc, c, tc->n[c]);
+    1bd8:	8b 4c 9e 20          	mov    0x20(%esi,%ebx,4),%ecx
+    1bdc:	89 da                	mov    %ebx,%edx
+    1bde:	89 f0                	mov    %esi,%eax
+  for(c = 0; c < NCLASS; c++)
+    1be0:	83 c3 01             	add    $0x1,%ebx
+    drain(tc, c, tc->n[c]);
+    1be3:	e8 c8 fa ff ff       	call   16b0 <drain>
+  for(c = 0; c < NCLASS; c++)
+    1be8:	83 fb 08             	cmp    $0x8,%ebx
+    1beb:	75 eb                	jne    1bd8 <malloc_thread_exit+0x18>
+  if(threaded)
+    1bed:	8b 15 24 2e 00 00    	mov    0x2e24,%edx
+    1bf3:	85 d2                	test   %edx,%edx
+    1bf5:	75 29                	jne    1c20 <malloc_thread_exit+0x60>
+  acquire();
+  trim(bigfree((Header*)tc - 1));
+    1bf7:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1bfa:	e8 c1 f8 ff ff       	call   14c0 <bigfree>
+    1bff:	e8 3c f9 ff ff       	call   1540 <trim>
+  if(threaded)
+    1c04:	a1 24 2e 00 00       	mov    0x2e24,%eax
+    1c09:	85 c0                	test   %eax,%eax
+    1c0b:	75 2b                	jne    1c38 <malloc_thread_exit+0x78>
+  release();
+  *cachep = 0;
+    1c0d:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+}
+    1c13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c16:	5b                   	pop    %ebx
+    1c17:	5e                   	pop    %esi
+    1c18:	5f                   	pop    %edi
+    1c19:	5d                   	pop    %ebp
+    1c1a:	c3                   	ret
+    1c1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1c1f:	90                   	nop
+    mutex_lock(&lock);
+    1c20:	83 ec 0c             	sub    $0xc,%esp
+    1c23:	68 28 2e 00 00       	push   $0x2e28
+    1c28:	e8 b3 e6 ff ff       	call   2e0 <mutex_lock>
+}
+    1c2d:	83 c4 10             	add    $0x10,%esp
+    1c30:	eb c5                	jmp    1bf7 <malloc_thread_exit+0x37>
+    1c32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1c38:	83 ec 0c             	sub    $0xc,%esp
+    1c3b:	68 28 2e 00 00       	push   $0x2e28
+    1c40:	e8 eb e6 ff ff       	call   330 <mutex_unlock>
+}
+    1c45:	83 c4 10             	add    $0x10,%esp
+    1c48:	eb c3                	jmp    1c0d <malloc_thread_exit+0x4d>
+    1c4a:	66 90                	xchg   %ax,%ax
+    1c4c:	66 90                	xchg   %ax,%ax
+    1c4e:	66 90                	xchg   %ax,%ax
+
+00001c50 <thread_create>:
+
+// Start fn(arg) in a new thread on a freshly allocated
+// page-aligned stack.  Returns the thread's pid.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1c50:	55                   	push   %ebp
+    1c51:	89 e5                	mov    %esp,%ebp
+    1c53:	53                   	push   %ebx
+    1c54:	83 ec 14             	sub    $0x14,%esp
+  char *mem, *stack;
+  int pid;
+
+  malloc_threaded();
+    1c57:	e8 24 ff ff ff       	call   1b80 <malloc_threaded>
+  stdio_threaded();
+    1c5c:	e8 cf ee ff ff       	call   b30 <stdio_threaded>
+  if((mem = malloc(2*PGSIZE)) == 0)
+    1c61:	83 ec 0c             	sub    $0xc,%esp
+    1c64:	68 00 20 00 00       	push   $0x2000
+    1c69:	e8 b2 fc ff ff       	call   1920 <malloc>
+    1c6e:	83 c4 10             	add    $0x10,%esp
+    1c71:	85 c0                	test   %eax,%eax
+    1c73:	74 52                	je     1cc7 <thread_create+0x77>
+    1c75:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1c77:	8d 80 07 10 00 00    	lea    0x1007(%eax),%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+  ((char**)stack)[-2] = 0;
+  if((pid = clone(fn, arg, stack)) < 0)
+    1c7d:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1c80:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+    1c85:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  ((char**)stack)[-2] = 0;
+    1c88:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+  if((pid = clone(fn, arg, stack)) < 0)
+    1c8f:	50                   	push   %eax
+    1c90:	ff 75 0c             	push   0xc(%ebp)
+    1c93:	ff 75 08             	push   0x8(%ebp)
+    1c96:	e8 97 e8 ff ff       	call   532 <clone>
+    1c9b:	83 c4 10             	add    $0x10,%esp
+    1c9e:	85 c0                	test   %eax,%eax
+    1ca0:	78 0e                	js     1cb0 <thread_create+0x60>
+    free(mem);
+  return pid;
+}
+    1ca2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1ca5:	c9                   	leave
+    1ca6:	c3                   	ret
+    1ca7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1cae:	66 90                	xchg   %ax,%ax
+    free(mem);
+    1cb0:	83 ec 0c             	sub    $0xc,%esp
+    1cb3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1cb6:	53                   	push   %ebx
+    1cb7:	e8 34 fb ff ff       	call   17f0 <free>
+    1cbc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1cbf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    1cc2:	83 c4 10             	add    $0x10,%esp
+}
+    1cc5:	c9                   	leave
+    1cc6:	c3                   	ret
+    return -1;
+    1cc7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1ccc:	eb d4                	jmp    1ca2 <thread_create+0x52>
+    1cce:	66 90                	xchg   %ax,%ax
+
+00001cd0 <thread_join>:
+
+// Wait for a thread to finish and free its stack.
+int
+thread_join(void)
+{
+    1cd0:	55                   	push   %ebp
+    1cd1:	89 e5                	mov    %esp,%ebp
+    1cd3:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    1cd4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    1cd7:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    1cda:	50                   	push   %eax
+    1cdb:	e8 61 e8 ff ff       	call   541 <join>
+    1ce0:	83 c4 10             	add    $0x10,%esp
+    1ce3:	85 c0                	test   %eax,%eax
+    1ce5:	78 29                	js     1d10 <thread_join+0x40>
+    1ce7:	89 c3                	mov    %eax,%ebx
+    return -1;
+  malloc_thread_exit(&((void**)stack)[-2]);
+    1ce9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1cec:	83 ec 0c             	sub    $0xc,%esp
+    1cef:	83 e8 08             	sub    $0x8,%eax
+    1cf2:	50                   	push   %eax
+    1cf3:	e8 c8 fe ff ff       	call   1bc0 <malloc_thread_exit>
+  free(((char**)stack)[-1]);
+    1cf8:	58                   	pop    %eax
+    1cf9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1cfc:	ff 70 fc             	push   -0x4(%eax)
+    1cff:	e8 ec fa ff ff       	call   17f0 <free>
+  return pid;
+    1d04:	83 c4 10             	add    $0x10,%esp
+}
+    1d07:	89 d8                	mov    %ebx,%eax
+    1d09:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1d0c:	c9                   	leave
+    1d0d:	c3                   	ret
+    1d0e:	66 90                	xchg   %ax,%ax
+    return -1;
+    1d10:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    1d15:	eb f0                	jmp    1d07 <thread_join+0x37>
@@ -26,7 +26,7 @@ exec(char *path, char **argv)
     cprintf("exec: fail\n");
     return -1;
   }
-  ilock(ip);
+  ilockshared(ip);
   pgdir = 0;
 
   // Check ELF header
@@ -37,6 +37,8 @@ exec(char *path, char **argv)
 
   if((pgdir = setupkvm()) == 0)
     goto bad;
+  if(vdsomap(pgdir) < 0)
+    goto bad;
 
   // Load program into memory.
   sz = 0;
@@ -93,14 +95,20 @@ exec(char *path, char **argv)
       last = s+1;
   safestrcpy(curproc->name, last, sizeof(curproc->name));
 
+  // Drop the old image's mmap() regions, which stay with any
+  // other threads that share them.
+  munmapall();
+  fpuexec();
+
   // Commit to the user image.
-  oldpgdir = curproc->pgdir;
-  curproc->pgdir = pgdir;
+  oldpgdir = setpgdir(curproc, pgdir);
   curproc->sz = sz;
+  curproc->ustack = 0;
   curproc->tf->eip = elf.entry;  // main
   curproc->tf->esp = sp;
   switchuvm(curproc);
-  freevm(oldpgdir);
+  if(oldpgdir)
+    freevm(oldpgdir);
   return 0;
 
  bad:
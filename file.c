@@ -9,17 +9,19 @@
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
+#include "uio.h"
 
 struct devsw devsw[NDEV];
 struct {
-  struct spinlock lock;
-  struct file file[NFILE];
+  struct spinlock lock;  // protects ref of every file
+  struct kmem_cache *cache;
 } ftable;
 
 void
 fileinit(void)
 {
   initlock(&ftable.lock, "ftable");
+  ftable.cache = kmem_cache_create("file cache", sizeof(struct file), 0, 0);
 }
 
 // Allocate a file structure.
@@ -28,16 +30,10 @@ filealloc(void)
 {
   struct file *f;
 
-  acquire(&ftable.lock);
-  for(f = ftable.file; f < ftable.file + NFILE; f++){
-    if(f->ref == 0){
-      f->ref = 1;
-      release(&ftable.lock);
-      return f;
-    }
-  }
-  release(&ftable.lock);
-  return 0;
+  if((f = kmem_cache_alloc(ftable.cache)) == 0)
+    return 0;
+  f->ref = 1;
+  return f;
 }
 
 // Increment ref count for file f.
@@ -66,9 +62,8 @@ fileclose(struct file *f)
     return;
   }
   ff = *f;
-  f->ref = 0;
-  f->type = FD_NONE;
   release(&ftable.lock);
+  kmem_cache_free(ftable.cache, f);
 
   if(ff.type == FD_PIPE)
     pipeclose(ff.pipe, ff.writable);
@@ -84,7 +79,7 @@ int
 filestat(struct file *f, struct stat *st)
 {
   if(f->type == FD_INODE){
-    ilock(f->ip);
+    ilockshared(f->ip);
     stati(f->ip, st);
     iunlock(f->ip);
     return 0;
@@ -96,18 +91,61 @@ filestat(struct file *f, struct stat *st)
 int
 fileread(struct file *f, char *addr, int n)
 {
-  int r;
+  struct iovec iov;
+
+  iov.base = addr;
+  iov.len = n;
+  return filereadv(f, &iov, 1, -1);
+}
+
+// Read from file f into the cnt buffers of iov in turn, at offset
+// off, or at f->off if off is -1, stopping at the first short read.
+// The inode is locked once for the whole call.
+int
+filereadv(struct file *f, struct iovec *iov, int cnt, int off)
+{
+  int i, r, tot;
+  uint pos;
 
   if(f->readable == 0)
     return -1;
-  if(f->type == FD_PIPE)
-    return piperead(f->pipe, addr, n);
+  if(f->type == FD_PIPE){
+    if(off != -1)
+      return -1;
+    for(i = tot = 0; i < cnt; i++){
+      if((r = piperead(f->pipe, iov[i].base, iov[i].len)) < 0)
+        return tot > 0 ? tot : -1;
+      tot += r;
+      if(r < iov[i].len)
+        break;
+    }
+    return tot;
+  }
   if(f->type == FD_INODE){
-    ilock(f->ip);
-    if((r = readi(f->ip, addr, f->off, n)) > 0)
-      f->off += r;
+    // Readers may share the inode, but then nothing serializes
+    // updates to f->off, so a file shared via dup() or fork()
+    // takes the lock exclusively. A positional read leaves
+    // f->off alone.
+    if(off != -1 || f->ref == 1)
+      ilockshared(f->ip);
+    else
+      ilock(f->ip);
+    pos = off != -1 ? off : f->off;
+    for(i = tot = 0; i < cnt; i++){
+      if((r = readi(f->ip, iov[i].base, pos, iov[i].len)) < 0){
+        if(tot == 0)
+          tot = -1;
+        break;
+      }
+      pos += r;
+      tot += r;
+      if(r < iov[i].len)
+        break;
+    }
+    if(off == -1 && tot > 0)
+      f->off = pos;
     iunlock(f->ip);
-    return r;
+    return tot;
   }
   panic("fileread");
 }
@@ -117,12 +155,35 @@ fileread(struct file *f, char *addr, int n)
 int
 filewrite(struct file *f, char *addr, int n)
 {
-  int r;
+  struct iovec iov;
+
+  iov.base = addr;
+  iov.len = n;
+  return filewritev(f, &iov, 1, -1);
+}
+
+// Write the cnt buffers of iov to file f in turn, at offset off,
+// or at f->off if off is -1.
+int
+filewritev(struct file *f, struct iovec *iov, int cnt, int off)
+{
+  int i, r, m, n, n1, tot, done;
+  uint pos;
 
   if(f->writable == 0)
     return -1;
-  if(f->type == FD_PIPE)
-    return pipewrite(f->pipe, addr, n);
+  for(i = n = 0; i < cnt; i++)
+    n += iov[i].len;
+  if(f->type == FD_PIPE){
+    if(off != -1)
+      return -1;
+    for(i = tot = 0; i < cnt; i++){
+      if((r = pipewrite(f->pipe, iov[i].base, iov[i].len)) < 0)
+        return -1;
+      tot += r;
+    }
+    return tot;
+  }
   if(f->type == FD_INODE){
     // write a few blocks at a time to avoid exceeding
     // the maximum log transaction size, including
@@ -130,27 +191,44 @@ filewrite(struct file *f, char *addr, int n)
     // and 2 blocks of slop for non-aligned writes.
     // this really belongs lower down, since writei()
     // might be writing a device like the console.
+    // The blocks of one transaction are contiguous in the
+    // file, so it may gather them from several buffers.
     int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
-    int i = 0;
-    while(i < n){
-      int n1 = n - i;
-      if(n1 > max)
-        n1 = max;
-
+    tot = 0;
+    i = 0;
+    done = 0;  // bytes of iov[i] written
+    r = 0;
+    while(tot < n){
       begin_op();
       ilock(f->ip);
-      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
-        f->off += r;
+      pos = off != -1 ? off + tot : f->off;
+      for(n1 = 0; n1 < max && tot < n; ){
+        if(done == iov[i].len){
+          i++;
+          done = 0;
+          continue;
+        }
+        m = iov[i].len - done;
+        if(m > max - n1)
+          m = max - n1;
+        if((r = writei(f->ip, (char*)iov[i].base + done, pos, m)) < 0)
+          break;
+        if(r != m)
+          panic("short filewrite");
+        pos += r;
+        done += r;
+        n1 += r;
+        tot += r;
+      }
+      if(off == -1)
+        f->off = pos;
       iunlock(f->ip);
       end_op();
 
       if(r < 0)
         break;
-      if(r != n1)
-        panic("short filewrite");
-      i += r;
     }
-    return i == n ? n : -1;
+    return tot == n ? n : -1;
   }
   panic("filewrite");
 }
@@ -16,6 +16,7 @@ struct inode {
     uint dev;           // Device number 设备号，指向存储该inode的设备。
     uint inum;          // Inode number 该inode在设备上的唯一标识符。
     int ref;            // Reference count node被打开的次数（即有多少个进程正在使用它）。
+    struct inode *next; // next in icache list
     struct sleeplock lock; // protects everything below here
     int valid;          // inode has been read from disk? 是否有效，当inode从磁盘加载到内存时设置为1。
 
@@ -0,0 +1,1065 @@
+
+_forktest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "fork test OK\n");
+}
+
+int
+main(void)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 e4 f0             	and    $0xfffffff0,%esp
+  forktest();
+   6:	e8 35 00 00 00       	call   40 <forktest>
+  exit();
+   b:	e8 70 01 00 00       	call   180 <exit>
+
+00000010 <printf>:
+{
+  10:	55                   	push   %ebp
+  11:	89 e5                	mov    %esp,%ebp
+  13:	53                   	push   %ebx
+  14:	83 ec 10             	sub    $0x10,%esp
+  17:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  write(fd, s, strlen(s));
+  1a:	53                   	push   %ebx
+  1b:	e8 10 02 00 00       	call   230 <strlen>
+  20:	83 c4 0c             	add    $0xc,%esp
+  23:	50                   	push   %eax
+  24:	53                   	push   %ebx
+  25:	ff 75 08             	push   0x8(%ebp)
+  28:	e8 d4 04 00 00       	call   501 <write>
+}
+  2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  30:	83 c4 10             	add    $0x10,%esp
+  33:	c9                   	leave
+  34:	c3                   	ret
+  35:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000040 <forktest>:
+{
+  40:	55                   	push   %ebp
+  41:	89 e5                	mov    %esp,%ebp
+  43:	53                   	push   %ebx
+  for(n=0; n<N; n++){
+  44:	31 db                	xor    %ebx,%ebx
+{
+  46:	83 ec 10             	sub    $0x10,%esp
+  write(fd, s, strlen(s));
+  49:	68 e4 06 00 00       	push   $0x6e4
+  4e:	e8 dd 01 00 00       	call   230 <strlen>
+  53:	83 c4 0c             	add    $0xc,%esp
+  56:	50                   	push   %eax
+  57:	68 e4 06 00 00       	push   $0x6e4
+  5c:	6a 01                	push   $0x1
+  5e:	e8 9e 04 00 00       	call   501 <write>
+  63:	83 c4 10             	add    $0x10,%esp
+  66:	eb 19                	jmp    81 <forktest+0x41>
+  68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6f:	90                   	nop
+    if(pid == 0)
+  70:	74 5b                	je     cd <forktest+0x8d>
+  for(n=0; n<N; n++){
+  72:	83 c3 01             	add    $0x1,%ebx
+  75:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+  7b:	0f 84 86 00 00 00    	je     107 <forktest+0xc7>
+    pid = fork();
+  81:	e8 9a 00 00 00       	call   120 <fork>
+    if(pid < 0)
+  86:	85 c0                	test   %eax,%eax
+  88:	79 e6                	jns    70 <forktest+0x30>
+  for(; n > 0; n--){
+  8a:	85 db                	test   %ebx,%ebx
+  8c:	74 10                	je     9e <forktest+0x5e>
+  8e:	66 90                	xchg   %ax,%ax
+    if(wait() < 0){
+  90:	e8 3f 04 00 00       	call   4d4 <wait>
+  95:	85 c0                	test   %eax,%eax
+  97:	78 39                	js     d2 <forktest+0x92>
+  for(; n > 0; n--){
+  99:	83 eb 01             	sub    $0x1,%ebx
+  9c:	75 f2                	jne    90 <forktest+0x50>
+  if(wait() != -1){
+  9e:	e8 31 04 00 00       	call   4d4 <wait>
+  a3:	83 f8 ff             	cmp    $0xffffffff,%eax
+  a6:	75 4c                	jne    f4 <forktest+0xb4>
+  write(fd, s, strlen(s));
+  a8:	83 ec 0c             	sub    $0xc,%esp
+  ab:	68 16 07 00 00       	push   $0x716
+  b0:	e8 7b 01 00 00       	call   230 <strlen>
+  b5:	83 c4 0c             	add    $0xc,%esp
+  b8:	50                   	push   %eax
+  b9:	68 16 07 00 00       	push   $0x716
+  be:	6a 01                	push   $0x1
+  c0:	e8 3c 04 00 00       	call   501 <write>
+}
+  c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  c8:	83 c4 10             	add    $0x10,%esp
+  cb:	c9                   	leave
+  cc:	c3                   	ret
+      exit();
+  cd:	e8 ae 00 00 00       	call   180 <exit>
+  write(fd, s, strlen(s));
+  d2:	83 ec 0c             	sub    $0xc,%esp
+  d5:	68 ef 06 00 00       	push   $0x6ef
+  da:	e8 51 01 00 00       	call   230 <strlen>
+  df:	83 c4 0c             	add    $0xc,%esp
+  e2:	50                   	push   %eax
+  e3:	68 ef 06 00 00       	push   $0x6ef
+  e8:	6a 01                	push   $0x1
+  ea:	e8 12 04 00 00       	call   501 <write>
+      exit();
+  ef:	e8 8c 00 00 00       	call   180 <exit>
+    printf(1, "wait got too many\n");
+  f4:	50                   	push   %eax
+  f5:	50                   	push   %eax
+  f6:	68 03 07 00 00       	push   $0x703
+  fb:	6a 01                	push   $0x1
+  fd:	e8 0e ff ff ff       	call   10 <printf>
+    exit();
+ 102:	e8 79 00 00 00       	call   180 <exit>
+    printf(1, "fork claimed to work N times!\n", N);
+ 107:	52                   	push   %edx
+ 108:	68 e8 03 00 00       	push   $0x3e8
+ 10d:	68 24 07 00 00       	push   $0x724
+ 112:	6a 01                	push   $0x1
+ 114:	e8 f7 fe ff ff       	call   10 <printf>
+    exit();
+ 119:	e8 62 00 00 00       	call   180 <exit>
+ 11e:	66 90                	xchg   %ax,%ax
+
+00000120 <fork>:
+int sysexit(void) __attribute__((noreturn));
+
+int
+fork(void)
+{
+  if(flushhook)
+ 120:	a1 7c 0a 00 00       	mov    0xa7c,%eax
+ 125:	85 c0                	test   %eax,%eax
+ 127:	74 17                	je     140 <fork+0x20>
+{
+ 129:	55                   	push   %ebp
+ 12a:	89 e5                	mov    %esp,%ebp
+ 12c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+ 12f:	ff d0                	call   *%eax
+  return sysfork();
+}
+ 131:	c9                   	leave
+  return sysfork();
+ 132:	e9 7f 03 00 00       	jmp    4b6 <sysfork>
+ 137:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13e:	66 90                	xchg   %ax,%ax
+ 140:	e9 71 03 00 00       	jmp    4b6 <sysfork>
+ 145:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+ 150:	55                   	push   %ebp
+  if(flushhook)
+ 151:	a1 7c 0a 00 00       	mov    0xa7c,%eax
+{
+ 156:	89 e5                	mov    %esp,%ebp
+ 158:	56                   	push   %esi
+ 159:	53                   	push   %ebx
+ 15a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 15d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+ 160:	85 c0                	test   %eax,%eax
+ 162:	74 02                	je     166 <exec+0x16>
+    flushhook();
+ 164:	ff d0                	call   *%eax
+  return sysexec(path, argv);
+ 166:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 169:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 16c:	5b                   	pop    %ebx
+ 16d:	5e                   	pop    %esi
+ 16e:	5d                   	pop    %ebp
+  return sysexec(path, argv);
+ 16f:	e9 ba 03 00 00       	jmp    52e <sysexec>
+ 174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 17f:	90                   	nop
+
+00000180 <exit>:
+
+int
+exit(void)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+ 186:	a1 7c 0a 00 00       	mov    0xa7c,%eax
+ 18b:	85 c0                	test   %eax,%eax
+ 18d:	74 02                	je     191 <exit+0x11>
+    flushhook();
+ 18f:	ff d0                	call   *%eax
+  sysexit();
+ 191:	e8 2f 03 00 00       	call   4c5 <sysexit>
+ 196:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001a0 <strcpy>:
+}
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1a1:	31 c0                	xor    %eax,%eax
+{
+ 1a3:	89 e5                	mov    %esp,%ebp
+ 1a5:	53                   	push   %ebx
+ 1a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1b7:	83 c0 01             	add    $0x1,%eax
+ 1ba:	84 d2                	test   %dl,%dl
+ 1bc:	75 f2                	jne    1b0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1c1:	89 c8                	mov    %ecx,%eax
+ 1c3:	c9                   	leave
+ 1c4:	c3                   	ret
+ 1c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	53                   	push   %ebx
+ 1d4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1da:	0f b6 02             	movzbl (%edx),%eax
+ 1dd:	84 c0                	test   %al,%al
+ 1df:	75 17                	jne    1f8 <strcmp+0x28>
+ 1e1:	eb 3a                	jmp    21d <strcmp+0x4d>
+ 1e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1e7:	90                   	nop
+ 1e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1ec:	83 c2 01             	add    $0x1,%edx
+ 1ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1f2:	84 c0                	test   %al,%al
+ 1f4:	74 1a                	je     210 <strcmp+0x40>
+    p++, q++;
+ 1f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1f8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1fb:	38 c3                	cmp    %al,%bl
+ 1fd:	74 e9                	je     1e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1ff:	29 d8                	sub    %ebx,%eax
+}
+ 201:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 204:	c9                   	leave
+ 205:	c3                   	ret
+ 206:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 210:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 214:	31 c0                	xor    %eax,%eax
+ 216:	29 d8                	sub    %ebx,%eax
+}
+ 218:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 21b:	c9                   	leave
+ 21c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 21d:	0f b6 19             	movzbl (%ecx),%ebx
+ 220:	31 c0                	xor    %eax,%eax
+ 222:	eb db                	jmp    1ff <strcmp+0x2f>
+ 224:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 22f:	90                   	nop
+
+00000230 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 236:	80 3a 00             	cmpb   $0x0,(%edx)
+ 239:	74 15                	je     250 <strlen+0x20>
+ 23b:	31 c0                	xor    %eax,%eax
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+ 240:	83 c0 01             	add    $0x1,%eax
+ 243:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 247:	89 c1                	mov    %eax,%ecx
+ 249:	75 f5                	jne    240 <strlen+0x10>
+    ;
+  return n;
+}
+ 24b:	89 c8                	mov    %ecx,%eax
+ 24d:	5d                   	pop    %ebp
+ 24e:	c3                   	ret
+ 24f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 250:	31 c9                	xor    %ecx,%ecx
+}
+ 252:	5d                   	pop    %ebp
+ 253:	89 c8                	mov    %ecx,%eax
+ 255:	c3                   	ret
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000260 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	57                   	push   %edi
+ 264:	8b 55 08             	mov    0x8(%ebp),%edx
+            "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt) {
+    asm volatile("cld; rep stosb" :
+ 267:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 26a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 26d:	89 d7                	mov    %edx,%edi
+ 26f:	fc                   	cld
+ 270:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 272:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 275:	89 d0                	mov    %edx,%eax
+ 277:	c9                   	leave
+ 278:	c3                   	ret
+ 279:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	8b 45 08             	mov    0x8(%ebp),%eax
+ 286:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 28a:	0f b6 10             	movzbl (%eax),%edx
+ 28d:	84 d2                	test   %dl,%dl
+ 28f:	75 12                	jne    2a3 <strchr+0x23>
+ 291:	eb 1d                	jmp    2b0 <strchr+0x30>
+ 293:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 297:	90                   	nop
+ 298:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 29c:	83 c0 01             	add    $0x1,%eax
+ 29f:	84 d2                	test   %dl,%dl
+ 2a1:	74 0d                	je     2b0 <strchr+0x30>
+    if(*s == c)
+ 2a3:	38 d1                	cmp    %dl,%cl
+ 2a5:	75 f1                	jne    298 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2a7:	5d                   	pop    %ebp
+ 2a8:	c3                   	ret
+ 2a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2b0:	31 c0                	xor    %eax,%eax
+}
+ 2b2:	5d                   	pop    %ebp
+ 2b3:	c3                   	ret
+ 2b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2bf:	90                   	nop
+
+000002c0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	56                   	push   %esi
+ 2c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2c5:	83 ec 08             	sub    $0x8,%esp
+ 2c8:	6a 00                	push   $0x0
+ 2ca:	ff 75 08             	push   0x8(%ebp)
+ 2cd:	e8 6b 02 00 00       	call   53d <open>
+  if(fd < 0)
+ 2d2:	83 c4 10             	add    $0x10,%esp
+ 2d5:	85 c0                	test   %eax,%eax
+ 2d7:	78 27                	js     300 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2d9:	83 ec 08             	sub    $0x8,%esp
+ 2dc:	ff 75 0c             	push   0xc(%ebp)
+ 2df:	89 c3                	mov    %eax,%ebx
+ 2e1:	50                   	push   %eax
+ 2e2:	e8 83 02 00 00       	call   56a <fstat>
+  close(fd);
+ 2e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2ec:	e8 1f 02 00 00       	call   510 <close>
+  return r;
+ 2f1:	83 c4 10             	add    $0x10,%esp
+}
+ 2f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2f7:	89 f0                	mov    %esi,%eax
+ 2f9:	5b                   	pop    %ebx
+ 2fa:	5e                   	pop    %esi
+ 2fb:	5d                   	pop    %ebp
+ 2fc:	c3                   	ret
+ 2fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 300:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 305:	eb ed                	jmp    2f4 <stat+0x34>
+ 307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30e:	66 90                	xchg   %ax,%ax
+
+00000310 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	53                   	push   %ebx
+ 314:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 317:	0f be 02             	movsbl (%edx),%eax
+ 31a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 31d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 320:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 325:	77 1e                	ja     345 <atoi+0x35>
+ 327:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 330:	83 c2 01             	add    $0x1,%edx
+ 333:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 336:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 33a:	0f be 02             	movsbl (%edx),%eax
+ 33d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 340:	80 fb 09             	cmp    $0x9,%bl
+ 343:	76 eb                	jbe    330 <atoi+0x20>
+  return n;
+}
+ 345:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 348:	89 c8                	mov    %ecx,%eax
+ 34a:	c9                   	leave
+ 34b:	c3                   	ret
+ 34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000350 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	57                   	push   %edi
+ 354:	56                   	push   %esi
+ 355:	8b 45 10             	mov    0x10(%ebp),%eax
+ 358:	8b 55 08             	mov    0x8(%ebp),%edx
+ 35b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 35e:	85 c0                	test   %eax,%eax
+ 360:	7e 13                	jle    375 <memmove+0x25>
+ 362:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 364:	89 d7                	mov    %edx,%edi
+ 366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 370:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 371:	39 f8                	cmp    %edi,%eax
+ 373:	75 fb                	jne    370 <memmove+0x20>
+  return vdst;
+}
+ 375:	5e                   	pop    %esi
+ 376:	89 d0                	mov    %edx,%eax
+ 378:	5f                   	pop    %edi
+ 379:	5d                   	pop    %ebp
+ 37a:	c3                   	ret
+ 37b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 37f:	90                   	nop
+
+00000380 <mutex_init>:
+
+// Futex-based mutex (Drepper, "Futexes Are Tricky", mutex 2).
+// The uncontended paths never enter the kernel.
+void
+mutex_init(struct mutex *m)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+ 383:	8b 45 08             	mov    0x8(%ebp),%eax
+ 386:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 38c:	5d                   	pop    %ebp
+ 38d:	c3                   	ret
+ 38e:	66 90                	xchg   %ax,%ax
+
+00000390 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 390:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+ 391:	31 c0                	xor    %eax,%eax
+ 393:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 398:	89 e5                	mov    %esp,%ebp
+ 39a:	56                   	push   %esi
+ 39b:	53                   	push   %ebx
+ 39c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+ 39f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 3a3:	85 c0                	test   %eax,%eax
+ 3a5:	74 32                	je     3d9 <mutex_lock+0x49>
+    return;
+  if(c != 2)
+ 3a7:	83 f8 02             	cmp    $0x2,%eax
+ 3aa:	74 0c                	je     3b8 <mutex_lock+0x28>
+static inline uint
+xchg(volatile uint *addr, uint newval) {
+    uint result;
+
+    // The + in "+m" denotes a read-modify-write operand.
+    asm volatile("lock; xchgl %0, %1" :
+ 3ac:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3b1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+ 3b4:	85 c0                	test   %eax,%eax
+ 3b6:	74 21                	je     3d9 <mutex_lock+0x49>
+ 3b8:	be 02 00 00 00       	mov    $0x2,%esi
+ 3bd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAIT, 2);
+ 3c0:	83 ec 04             	sub    $0x4,%esp
+ 3c3:	6a 02                	push   $0x2
+ 3c5:	6a 00                	push   $0x0
+ 3c7:	53                   	push   %ebx
+ 3c8:	e8 33 02 00 00       	call   600 <futex>
+ 3cd:	89 f0                	mov    %esi,%eax
+ 3cf:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 3d2:	83 c4 10             	add    $0x10,%esp
+ 3d5:	85 c0                	test   %eax,%eax
+ 3d7:	75 e7                	jne    3c0 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+ 3d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3dc:	5b                   	pop    %ebx
+ 3dd:	5e                   	pop    %esi
+ 3de:	5d                   	pop    %ebp
+ 3df:	c3                   	ret
+
+000003e0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	83 ec 08             	sub    $0x8,%esp
+ 3e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+ 3e9:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 3ed:	75 09                	jne    3f8 <mutex_unlock+0x18>
+    m->val = 0;
+    futex(&m->val, FUTEX_WAKE, 1);
+  }
+}
+ 3ef:	c9                   	leave
+ 3f0:	c3                   	ret
+ 3f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+ 3f8:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+ 3fb:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex(&m->val, FUTEX_WAKE, 1);
+ 401:	6a 01                	push   $0x1
+ 403:	6a 01                	push   $0x1
+ 405:	50                   	push   %eax
+ 406:	e8 f5 01 00 00       	call   600 <futex>
+ 40b:	83 c4 10             	add    $0x10,%esp
+}
+ 40e:	c9                   	leave
+ 40f:	c3                   	ret
+
+00000410 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 413:	8b 45 08             	mov    0x8(%ebp),%eax
+ 416:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 41c:	5d                   	pop    %ebp
+ 41d:	c3                   	ret
+ 41e:	66 90                	xchg   %ax,%ax
+
+00000420 <cond_wait>:
+
+// Release m and wait for a signal, then reacquire m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	57                   	push   %edi
+ 424:	56                   	push   %esi
+ 425:	53                   	push   %ebx
+ 426:	83 ec 0c             	sub    $0xc,%esp
+ 429:	8b 75 08             	mov    0x8(%ebp),%esi
+ 42c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 42f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+ 431:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 435:	75 21                	jne    458 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 437:	83 ec 04             	sub    $0x4,%esp
+ 43a:	57                   	push   %edi
+ 43b:	6a 00                	push   $0x0
+ 43d:	56                   	push   %esi
+ 43e:	e8 bd 01 00 00       	call   600 <futex>
+  mutex_lock(m);
+ 443:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 446:	83 c4 10             	add    $0x10,%esp
+}
+ 449:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 44c:	5b                   	pop    %ebx
+ 44d:	5e                   	pop    %esi
+ 44e:	5f                   	pop    %edi
+ 44f:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 450:	e9 3b ff ff ff       	jmp    390 <mutex_lock>
+ 455:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+ 458:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+ 45b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex(&m->val, FUTEX_WAKE, 1);
+ 461:	6a 01                	push   $0x1
+ 463:	6a 01                	push   $0x1
+ 465:	53                   	push   %ebx
+ 466:	e8 95 01 00 00       	call   600 <futex>
+ 46b:	83 c4 10             	add    $0x10,%esp
+ 46e:	eb c7                	jmp    437 <cond_wait+0x17>
+
+00000470 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	83 ec 0c             	sub    $0xc,%esp
+ 476:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 479:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 47d:	6a 01                	push   $0x1
+ 47f:	6a 01                	push   $0x1
+ 481:	50                   	push   %eax
+ 482:	e8 79 01 00 00       	call   600 <futex>
+}
+ 487:	83 c4 10             	add    $0x10,%esp
+ 48a:	c9                   	leave
+ 48b:	c3                   	ret
+ 48c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	83 ec 0c             	sub    $0xc,%esp
+ 496:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 499:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+ 49d:	6a 40                	push   $0x40
+ 49f:	6a 01                	push   $0x1
+ 4a1:	50                   	push   %eax
+ 4a2:	e8 59 01 00 00       	call   600 <futex>
+}
+ 4a7:	83 c4 10             	add    $0x10,%esp
+ 4aa:	c9                   	leave
+ 4ab:	c3                   	ret
+ 4ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004b0 <uptime>:
+// Clock ticks since boot, read from the kernel's vdso page
+// without a system call.
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 4b0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+ 4b5:	c3                   	ret
+
+000004b6 <sysfork>:
+  1: ret
+
+#define SYSCALL(name) SYSCALLAS(name, name)
+
+// ulib.c wraps these.
+SYSCALLAS(sysfork, fork)
+ 4b6:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4bb:	89 e1                	mov    %esp,%ecx
+ 4bd:	ba c4 04 00 00       	mov    $0x4c4,%edx
+ 4c2:	0f 34                	sysenter
+ 4c4:	c3                   	ret
+
+000004c5 <sysexit>:
+SYSCALLAS(sysexit, exit)
+ 4c5:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4ca:	89 e1                	mov    %esp,%ecx
+ 4cc:	ba d3 04 00 00       	mov    $0x4d3,%edx
+ 4d1:	0f 34                	sysenter
+ 4d3:	c3                   	ret
+
+000004d4 <wait>:
+SYSCALL(wait)
+ 4d4:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4d9:	89 e1                	mov    %esp,%ecx
+ 4db:	ba e2 04 00 00       	mov    $0x4e2,%edx
+ 4e0:	0f 34                	sysenter
+ 4e2:	c3                   	ret
+
+000004e3 <pipe>:
+SYSCALL(pipe)
+ 4e3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4e8:	89 e1                	mov    %esp,%ecx
+ 4ea:	ba f1 04 00 00       	mov    $0x4f1,%edx
+ 4ef:	0f 34                	sysenter
+ 4f1:	c3                   	ret
+
+000004f2 <read>:
+SYSCALL(read)
+ 4f2:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4f7:	89 e1                	mov    %esp,%ecx
+ 4f9:	ba 00 05 00 00       	mov    $0x500,%edx
+ 4fe:	0f 34                	sysenter
+ 500:	c3                   	ret
+
+00000501 <write>:
+SYSCALL(write)
+ 501:	b8 10 00 00 00       	mov    $0x10,%eax
+ 506:	89 e1                	mov    %esp,%ecx
+ 508:	ba 0f 05 00 00       	mov    $0x50f,%edx
+ 50d:	0f 34                	sysenter
+ 50f:	c3                   	ret
+
+00000510 <close>:
+SYSCALL(close)
+ 510:	b8 15 00 00 00       	mov    $0x15,%eax
+ 515:	89 e1                	mov    %esp,%ecx
+ 517:	ba 1e 05 00 00       	mov    $0x51e,%edx
+ 51c:	0f 34                	sysenter
+ 51e:	c3                   	ret
+
+0000051f <kill>:
+SYSCALL(kill)
+ 51f:	b8 06 00 00 00       	mov    $0x6,%eax
+ 524:	89 e1                	mov    %esp,%ecx
+ 526:	ba 2d 05 00 00       	mov    $0x52d,%edx
+ 52b:	0f 34                	sysenter
+ 52d:	c3                   	ret
+
+0000052e <sysexec>:
+SYSCALLAS(sysexec, exec)
+ 52e:	b8 07 00 00 00       	mov    $0x7,%eax
+ 533:	89 e1                	mov    %esp,%ecx
+ 535:	ba 3c 05 00 00       	mov    $0x53c,%edx
+ 53a:	0f 34                	sysenter
+ 53c:	c3                   	ret
+
+0000053d <open>:
+SYSCALL(open)
+ 53d:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 542:	89 e1                	mov    %esp,%ecx
+ 544:	ba 4b 05 00 00       	mov    $0x54b,%edx
+ 549:	0f 34                	sysenter
+ 54b:	c3                   	ret
+
+0000054c <mknod>:
+SYSCALL(mknod)
+ 54c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 551:	89 e1                	mov    %esp,%ecx
+ 553:	ba 5a 05 00 00       	mov    $0x55a,%edx
+ 558:	0f 34                	sysenter
+ 55a:	c3                   	ret
+
+0000055b <unlink>:
+SYSCALL(unlink)
+ 55b:	b8 12 00 00 00       	mov    $0x12,%eax
+ 560:	89 e1                	mov    %esp,%ecx
+ 562:	ba 69 05 00 00       	mov    $0x569,%edx
+ 567:	0f 34                	sysenter
+ 569:	c3                   	ret
+
+0000056a <fstat>:
+SYSCALL(fstat)
+ 56a:	b8 08 00 00 00       	mov    $0x8,%eax
+ 56f:	89 e1                	mov    %esp,%ecx
+ 571:	ba 78 05 00 00       	mov    $0x578,%edx
+ 576:	0f 34                	sysenter
+ 578:	c3                   	ret
+
+00000579 <link>:
+SYSCALL(link)
+ 579:	b8 13 00 00 00       	mov    $0x13,%eax
+ 57e:	89 e1                	mov    %esp,%ecx
+ 580:	ba 87 05 00 00       	mov    $0x587,%edx
+ 585:	0f 34                	sysenter
+ 587:	c3                   	ret
+
+00000588 <mkdir>:
+SYSCALL(mkdir)
+ 588:	b8 14 00 00 00       	mov    $0x14,%eax
+ 58d:	89 e1                	mov    %esp,%ecx
+ 58f:	ba 96 05 00 00       	mov    $0x596,%edx
+ 594:	0f 34                	sysenter
+ 596:	c3                   	ret
+
+00000597 <chdir>:
+SYSCALL(chdir)
+ 597:	b8 09 00 00 00       	mov    $0x9,%eax
+ 59c:	89 e1                	mov    %esp,%ecx
+ 59e:	ba a5 05 00 00       	mov    $0x5a5,%edx
+ 5a3:	0f 34                	sysenter
+ 5a5:	c3                   	ret
+
+000005a6 <dup>:
+SYSCALL(dup)
+ 5a6:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5ab:	89 e1                	mov    %esp,%ecx
+ 5ad:	ba b4 05 00 00       	mov    $0x5b4,%edx
+ 5b2:	0f 34                	sysenter
+ 5b4:	c3                   	ret
+
+000005b5 <getpid>:
+SYSCALL(getpid)
+ 5b5:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5ba:	89 e1                	mov    %esp,%ecx
+ 5bc:	ba c3 05 00 00       	mov    $0x5c3,%edx
+ 5c1:	0f 34                	sysenter
+ 5c3:	c3                   	ret
+
+000005c4 <sbrk>:
+SYSCALL(sbrk)
+ 5c4:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5c9:	89 e1                	mov    %esp,%ecx
+ 5cb:	ba d2 05 00 00       	mov    $0x5d2,%edx
+ 5d0:	0f 34                	sysenter
+ 5d2:	c3                   	ret
+
+000005d3 <sleep>:
+SYSCALL(sleep)
+ 5d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5d8:	89 e1                	mov    %esp,%ecx
+ 5da:	ba e1 05 00 00       	mov    $0x5e1,%edx
+ 5df:	0f 34                	sysenter
+ 5e1:	c3                   	ret
+
+000005e2 <clone>:
+SYSCALL(clone)
+ 5e2:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5e7:	89 e1                	mov    %esp,%ecx
+ 5e9:	ba f0 05 00 00       	mov    $0x5f0,%edx
+ 5ee:	0f 34                	sysenter
+ 5f0:	c3                   	ret
+
+000005f1 <join>:
+SYSCALL(join)
+ 5f1:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5f6:	89 e1                	mov    %esp,%ecx
+ 5f8:	ba ff 05 00 00       	mov    $0x5ff,%edx
+ 5fd:	0f 34                	sysenter
+ 5ff:	c3                   	ret
+
+00000600 <futex>:
+SYSCALL(futex)
+ 600:	b8 18 00 00 00       	mov    $0x18,%eax
+ 605:	89 e1                	mov    %esp,%ecx
+ 607:	ba 0e 06 00 00       	mov    $0x60e,%edx
+ 60c:	0f 34                	sysenter
+ 60e:	c3                   	ret
+
+0000060f <yield>:
+SYSCALL(yield)
+ 60f:	b8 19 00 00 00       	mov    $0x19,%eax
+ 614:	89 e1                	mov    %esp,%ecx
+ 616:	ba 1d 06 00 00       	mov    $0x61d,%edx
+ 61b:	0f 34                	sysenter
+ 61d:	c3                   	ret
+
+0000061e <lockstat>:
+SYSCALL(lockstat)
+ 61e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 623:	89 e1                	mov    %esp,%ecx
+ 625:	ba 2c 06 00 00       	mov    $0x62c,%edx
+ 62a:	0f 34                	sysenter
+ 62c:	c3                   	ret
+
+0000062d <lockhammer>:
+SYSCALL(lockhammer)
+ 62d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 632:	89 e1                	mov    %esp,%ecx
+ 634:	ba 3b 06 00 00       	mov    $0x63b,%edx
+ 639:	0f 34                	sysenter
+ 63b:	c3                   	ret
+
+0000063c <vmsplice>:
+SYSCALL(vmsplice)
+ 63c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 641:	89 e1                	mov    %esp,%ecx
+ 643:	ba 4a 06 00 00       	mov    $0x64a,%edx
+ 648:	0f 34                	sysenter
+ 64a:	c3                   	ret
+
+0000064b <hsbrk>:
+SYSCALL(hsbrk)
+ 64b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 650:	89 e1                	mov    %esp,%ecx
+ 652:	ba 59 06 00 00       	mov    $0x659,%edx
+ 657:	0f 34                	sysenter
+ 659:	c3                   	ret
+
+0000065a <mmap>:
+SYSCALL(mmap)
+ 65a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 65f:	89 e1                	mov    %esp,%ecx
+ 661:	ba 68 06 00 00       	mov    $0x668,%edx
+ 666:	0f 34                	sysenter
+ 668:	c3                   	ret
+
+00000669 <munmap>:
+SYSCALL(munmap)
+ 669:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 66e:	89 e1                	mov    %esp,%ecx
+ 670:	ba 77 06 00 00       	mov    $0x677,%edx
+ 675:	0f 34                	sysenter
+ 677:	c3                   	ret
+
+00000678 <ringenter>:
+SYSCALL(ringenter)
+ 678:	b8 20 00 00 00       	mov    $0x20,%eax
+ 67d:	89 e1                	mov    %esp,%ecx
+ 67f:	ba 86 06 00 00       	mov    $0x686,%edx
+ 684:	0f 34                	sysenter
+ 686:	c3                   	ret
+
+00000687 <readv>:
+SYSCALL(readv)
+ 687:	b8 21 00 00 00       	mov    $0x21,%eax
+ 68c:	89 e1                	mov    %esp,%ecx
+ 68e:	ba 95 06 00 00       	mov    $0x695,%edx
+ 693:	0f 34                	sysenter
+ 695:	c3                   	ret
+
+00000696 <writev>:
+SYSCALL(writev)
+ 696:	b8 22 00 00 00       	mov    $0x22,%eax
+ 69b:	89 e1                	mov    %esp,%ecx
+ 69d:	ba a4 06 00 00       	mov    $0x6a4,%edx
+ 6a2:	0f 34                	sysenter
+ 6a4:	c3                   	ret
+
+000006a5 <pread>:
+SYSCALL(pread)
+ 6a5:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6aa:	89 e1                	mov    %esp,%ecx
+ 6ac:	ba b3 06 00 00       	mov    $0x6b3,%edx
+ 6b1:	0f 34                	sysenter
+ 6b3:	c3                   	ret
+
+000006b4 <pwrite>:
+SYSCALL(pwrite)
+ 6b4:	b8 24 00 00 00       	mov    $0x24,%eax
+ 6b9:	89 e1                	mov    %esp,%ecx
+ 6bb:	ba c2 06 00 00       	mov    $0x6c2,%edx
+ 6c0:	0f 34                	sysenter
+ 6c2:	c3                   	ret
+
+000006c3 <prof>:
+SYSCALL(prof)
+ 6c3:	b8 25 00 00 00       	mov    $0x25,%eax
+ 6c8:	89 e1                	mov    %esp,%ecx
+ 6ca:	ba d1 06 00 00       	mov    $0x6d1,%edx
+ 6cf:	0f 34                	sysenter
+ 6d1:	c3                   	ret
+
+000006d2 <scstat>:
+SYSCALL(scstat)
+ 6d2:	b8 26 00 00 00       	mov    $0x26,%eax
+ 6d7:	89 e1                	mov    %esp,%ecx
+ 6d9:	ba e0 06 00 00       	mov    $0x6e0,%edx
+ 6de:	0f 34                	sysenter
+ 6e0:	c3                   	ret
@@ -0,0 +1,133 @@
+// Lazy FPU and SSE state switching.
+//
+// A process that has never executed an FPU or SSE instruction has no
+// saved state and costs nothing. The scheduler runs every process
+// with CR0_TS set, so its first such instruction traps with
+// T_DEVICE; fpufault() then clears CR0_TS and loads the process's
+// state, or a fresh one. When the process is switched out, fpusave()
+// saves the registers only if it has cleared CR0_TS since it was
+// switched in.
+//
+// The registers still hold a process's state after fpusave(). If it
+// next uses the FPU on the same CPU, and no other process has used
+// it there in the meantime, fpufault() need only clear CR0_TS.
+// The kernel itself never uses the FPU.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "proc.h"
+
+#define FXSIZE    512              // FXSAVE area
+#define MXCSRINIT 0x1F80           // MXCSR at reset: all exceptions masked
+#define CPUID_FXSR 0x01000000      // CPUID 1 %edx: FXSAVE/FXRSTOR supported
+#define CPUID_SSE  0x02000000      // CPUID 1 %edx: SSE supported
+
+static struct kmem_cache *fpucache;
+static int fpuok;                  // CPUs have FXSAVE; switching is on
+
+void
+fpuinit(void) {
+    if ((fpucache = kmem_cache_create("fpu", FXSIZE, 0, 0)) == 0)
+        panic("fpuinit");
+    fpuok = (cpuidedx(1) & CPUID_FXSR) != 0;
+    if (!fpuok)
+        cprintf("fpuinit: no FXSAVE, FPU state is not switched\n");
+}
+
+// Set up this CPU's FPU. Called on each CPU.
+void
+fpuenable(void) {
+    uint edx;
+
+    if (!fpuok)
+        return;
+    edx = cpuidedx(1);
+    lcr4(rcr4() | CR4_OSFXSR | ((edx & CPUID_SSE) ? CR4_OSXMMEXCPT : 0));
+    lcr0((rcr0() & ~CR0_EM) | CR0_MP | CR0_NE);
+    fninit();
+    mycpu()->fpu = 0;
+    lcr0(rcr0() | CR0_TS);
+}
+
+// Handle T_DEVICE from the current process, with interrupts off.
+void
+fpufault(void) {
+    struct proc *p = myproc();
+    struct cpu *c = mycpu();
+
+    if (!fpuok) {
+        p->killed = 1;
+        return;
+    }
+    clts();
+    if (c->fpu == p && p->fpucpu == cpuid())
+        return;
+    if (p->fpu == 0) {
+        if ((p->fpu = kmem_cache_alloc(fpucache)) == 0) {
+            lcr0(rcr0() | CR0_TS);
+            p->killed = 1;
+            return;
+        }
+        if ((uint) p->fpu % 16 != 0)
+            panic("fpufault: alignment");
+        fninit();
+        ldmxcsr(MXCSRINIT);
+    } else
+        fxrstor(p->fpu);
+    c->fpu = p;
+    p->fpucpu = cpuid();
+}
+
+// Save p's FPU state if it has used the FPU since it was switched
+// in, and set CR0_TS for the next process. Called by the scheduler.
+void
+fpusave(struct proc *p) {
+    if (rcr0() & CR0_TS)
+        return;
+    if (p->fpu)
+        fxsave(p->fpu);
+    lcr0(rcr0() | CR0_TS);
+}
+
+// Give child np a copy of the current process's FPU state.
+// Returns 0 on success, -1 if out of memory.
+int
+fpufork(struct proc *np) {
+    struct proc *p = myproc();
+
+    np->fpu = 0;
+    np->fpucpu = -1;
+    if (p->fpu == 0)
+        return 0;
+    if ((np->fpu = kmem_cache_alloc(fpucache)) == 0)
+        return -1;
+    pushcli();
+    if (!(rcr0() & CR0_TS))
+        fxsave(p->fpu);
+    popcli();
+    memmove(np->fpu, p->fpu, FXSIZE);
+    return 0;
+}
+
+// Discard the current process's FPU state, for exec().
+void
+fpuexec(void) {
+    struct proc *p = myproc();
+
+    pushcli();
+    lcr0(rcr0() | CR0_TS);
+    fpufree(p);
+    popcli();
+}
+
+void
+fpufree(struct proc *p) {
+    if (p->fpu)
+        kmem_cache_free(fpucache, p->fpu);
+    p->fpu = 0;
+    p->fpucpu = -1;
+}
@@ -121,7 +121,7 @@ bfree(int dev, uint b)
 //   the reference and link counts have fallen to zero.
 //
 // * Referencing in cache: an entry in the inode cache
-//   is free if ip->ref is zero. Otherwise ip->ref tracks
+//   may be reclaimed if ip->ref is zero. Otherwise ip->ref tracks
 //   the number of in-memory pointers to the entry (open
 //   files and current directories). iget() finds or
 //   creates a cache entry and increments its ref; iput()
@@ -131,7 +131,7 @@ bfree(int dev, uint b)
 //   cache entry is only correct when ip->valid is 1.
 //   ilock() reads the inode from
 //   the disk and sets ip->valid, while iput() clears
-//   ip->valid if ip->ref has fallen to zero.
+//   ip->valid if it frees the inode on disk.
 //
 // * Locked: file system code may only examine and modify
 //   the information in an inode and its content if it
@@ -155,10 +155,13 @@ bfree(int dev, uint b)
 // have locked the inodes involved; this lets callers create
 // multi-step atomic operations.
 //
-// The icache.lock spin-lock protects the allocation of icache
-// entries. Since ip->ref indicates whether an entry is free,
-// and ip->dev and ip->inum indicate which i-node an entry
-// holds, one must hold icache.lock while using any of those fields.
+// The icache.lock spin-lock protects the list of in-memory inodes.
+// Inodes come from a kmem cache. When ip->ref drops to zero a valid
+// inode stays on the list, at its head, so that the next iget() of
+// it need not read the disk; once more than NINODE are unreferenced,
+// the one unreferenced longest is freed. ip->dev and ip->inum
+// indicate which i-node an entry holds, and one must hold
+// icache.lock while using ref, dev, inum or next.
 //
 // An ip->lock sleep-lock protects all ip-> fields other than ref,
 // dev, and inum.  One must hold ip->lock in order to
@@ -166,18 +169,30 @@ bfree(int dev, uint b)
 
 struct {
   struct spinlock lock;
-  struct inode inode[NINODE];
+  struct kmem_cache *cache;
+  struct inode *list;  // cached inodes
+  int nidle;           // of which with ref == 0
 } icache;
 
+// Slab constructor: set up an inode's lock once, not on every iget().
+static void
+inodector(void *v)
+{
+  initsleeplock(&((struct inode*)v)->lock, "inode");
+}
+
+static void
+inodedtor(void *v)
+{
+  freesleeplock(&((struct inode*)v)->lock);
+}
+
 void
 iinit(int dev)
 {
-  int i = 0;
-  
   initlock(&icache.lock, "icache");
-  for(i = 0; i < NINODE; i++) {
-    initsleeplock(&icache.inode[i].lock, "inode");
-  }
+  icache.cache = kmem_cache_create("inode cache", sizeof(struct inode),
+                                   inodector, inodedtor);
 
   readsb(dev, &sb);
   cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
@@ -236,37 +251,59 @@ iupdate(struct inode *ip)
   brelse(bp);
 }
 
+// Free the cached inode that has been unreferenced longest.
+// Returns 0 if every cached inode is in use.
+// Caller holds icache.lock.
+static int
+ievict(void)
+{
+  struct inode **pp, **last, *ip;
+
+  last = 0;
+  for(pp = &icache.list; *pp; pp = &(*pp)->next)
+    if((*pp)->ref == 0)
+      last = pp;
+  if(last == 0)
+    return 0;
+  ip = *last;
+  *last = ip->next;
+  kmem_cache_free(icache.cache, ip);
+  icache.nidle--;
+  return 1;
+}
+
 // Find the inode with number inum on device dev
 // and return the in-memory copy. Does not lock
 // the inode and does not read it from disk.
 static struct inode*
 iget(uint dev, uint inum)
 {
-  struct inode *ip, *empty;
+  struct inode *ip;
 
   acquire(&icache.lock);
 
   // Is the inode already cached?
-  empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
-      ip->ref++;
+  for(ip = icache.list; ip; ip = ip->next){
+    if(ip->dev == dev && ip->inum == inum){
+      if(ip->ref++ == 0)
+        icache.nidle--;
       release(&icache.lock);
       return ip;
     }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
-      empty = ip;
   }
 
-  // Recycle an inode cache entry.
-  if(empty == 0)
-    panic("iget: no inodes");
+  // Allocate a new inode cache entry, if need be
+  // making room by evicting an unreferenced one.
+  while((ip = kmem_cache_alloc(icache.cache)) == 0)
+    if(!ievict())
+      panic("iget: no inodes");
 
-  ip = empty;
   ip->dev = dev;
   ip->inum = inum;
   ip->ref = 1;
   ip->valid = 0;
+  ip->next = icache.list;
+  icache.list = ip;
   release(&icache.lock);
 
   return ip;
@@ -283,32 +320,58 @@ idup(struct inode *ip)
   return ip;
 }
 
+// Copy the on-disk inode into ip.
+// Caller must hold ip->lock exclusively.
+static void
+iload(struct inode *ip)
+{
+  struct buf *bp;
+  struct dinode *dip;
+
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+  dip = (struct dinode*)bp->data + ip->inum%IPB;
+  ip->type = dip->type;
+  ip->major = dip->major;
+  ip->minor = dip->minor;
+  ip->nlink = dip->nlink;
+  ip->size = dip->size;
+  memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+  brelse(bp);
+  ip->valid = 1;
+  if(ip->type == 0)
+    panic("ilock: no type");
+}
+
 // Lock the given inode.
 // Reads the inode from disk if necessary.
 void
 ilock(struct inode *ip)
 {
-  struct buf *bp;
-  struct dinode *dip;
-
   if(ip == 0 || ip->ref < 1)
     panic("ilock");
 
   acquiresleep(&ip->lock);
 
+  if(ip->valid == 0)
+    iload(ip);
+}
+
+// Lock the given inode for reading only, sharing it with other
+// readers. The holder may use readi(), stati() and dirlookup()
+// but must not modify the inode. If the inode must first be read
+// from disk, the lock is taken exclusively instead; iunlock()
+// releases either kind.
+void
+ilockshared(struct inode *ip)
+{
+  if(ip == 0 || ip->ref < 1)
+    panic("ilockshared");
+
+  acquiresleepshared(&ip->lock);
+
   if(ip->valid == 0){
-    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
-    dip = (struct dinode*)bp->data + ip->inum%IPB;
-    ip->type = dip->type;
-    ip->major = dip->major;
-    ip->minor = dip->minor;
-    ip->nlink = dip->nlink;
-    ip->size = dip->size;
-    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
-    brelse(bp);
-    ip->valid = 1;
-    if(ip->type == 0)
-      panic("ilock: no type");
+    releasesleepshared(&ip->lock);
+    ilock(ip);
   }
 }
 
@@ -316,15 +379,21 @@ ilock(struct inode *ip)
 void
 iunlock(struct inode *ip)
 {
-  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+  if(ip == 0 || ip->ref < 1)
     panic("iunlock");
 
-  releasesleep(&ip->lock);
+  // A shared holder's own hold keeps readers above 0.
+  if(holdingsleep(&ip->lock))
+    releasesleep(&ip->lock);
+  else if(ip->lock.readers > 0)
+    releasesleepshared(&ip->lock);
+  else
+    panic("iunlock");
 }
 
 // Drop a reference to an in-memory inode.
 // If that was the last reference, the inode cache entry can
-// be recycled.
+// be recycled, though it stays cached for a while if valid.
 // If that was the last reference and the inode has no links
 // to it, free the inode (and its content) on disk.
 // All calls to iput() must be inside a transaction in
@@ -332,6 +401,8 @@ iunlock(struct inode *ip)
 void
 iput(struct inode *ip)
 {
+  struct inode **pp;
+
   acquiresleep(&ip->lock);
   if(ip->valid && ip->nlink == 0){
     acquire(&icache.lock);
@@ -347,8 +418,21 @@ iput(struct inode *ip)
   }
   releasesleep(&ip->lock);
 
+  // With no references left, no one holds ip->lock, so valid
+  // may be read under icache.lock alone.
   acquire(&icache.lock);
-  ip->ref--;
+  if(--ip->ref == 0){
+    for(pp = &icache.list; *pp != ip; pp = &(*pp)->next)
+      ;
+    *pp = ip->next;
+    if(ip->valid){
+      ip->next = icache.list;
+      icache.list = ip;
+      if(++icache.nidle > NINODE)
+        ievict();
+    } else
+      kmem_cache_free(icache.cache, ip);
+  }
   release(&icache.lock);
 }
 
@@ -633,7 +717,7 @@ namex(char *path, int nameiparent, char *name)
     ip = idup(myproc()->cwd);
 
   while((path = skipelem(path, name)) != 0){
-    ilock(ip);
+    ilockshared(ip);
     if(ip->type != T_DIR){
       iunlockput(ip);
       return 0;
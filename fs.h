@@ -7,7 +7,7 @@
 
 // Disk layout:
 // [ boot block | super block | log | inode blocks |
-//                                          free bit map | data blocks]
+//                                  free bit map | data blocks | swap]
 //
 // mkfs computes the super block and builds an initial file system. The
 // super block describes the disk layout:
@@ -19,6 +19,8 @@ struct superblock {
     uint logstart;     // Block number of first log block
     uint inodestart;   // Block number of first inode block
     uint bmapstart;    // Block number of first free map block
+    uint swapstart;    // Block number of first swap block
+    uint nswap;        // Number of swap slots (one page each)
 };
 
 #define NDIRECT 12
@@ -0,0 +1,4 @@
+// futex() operations.
+// Both the kernel and user programs use this header file.
+#define FUTEX_WAIT  0   // sleep if *addr == val
+#define FUTEX_WAKE  1   // wake at most val sleepers on addr
@@ -0,0 +1,4191 @@
+
+_futexbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+         t1 - t0, counter == nthread*ITERS*WORK ? "ok" : "WRONG");
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 04             	sub    $0x4,%esp
+  if(argc > 1)
+      11:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+      14:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc > 1)
+      17:	7e 13                	jle    2c <main+0x2c>
+    nthread = atoi(argv[1]);
+      19:	83 ec 0c             	sub    $0xc,%esp
+      1c:	ff 70 04             	push   0x4(%eax)
+      1f:	e8 4c 04 00 00       	call   470 <atoi>
+      24:	83 c4 10             	add    $0x10,%esp
+      27:	a3 00 2a 00 00       	mov    %eax,0x2a00
+  if(nthread < 1 || nthread > 16)
+      2c:	a1 00 2a 00 00       	mov    0x2a00,%eax
+      31:	83 e8 01             	sub    $0x1,%eax
+      34:	83 f8 0f             	cmp    $0xf,%eax
+      37:	76 0a                	jbe    43 <main+0x43>
+    nthread = 4;
+      39:	c7 05 00 2a 00 00 04 	movl   $0x4,0x2a00
+      40:	00 00 00 
+
+  mutex_init(&mu);
+      43:	83 ec 0c             	sub    $0xc,%esp
+      46:	68 08 2b 00 00       	push   $0x2b08
+      4b:	e8 90 04 00 00       	call   4e0 <mutex_init>
+  usefutex = 0;
+  run("spin-yield");
+      50:	c7 04 24 31 1f 00 00 	movl   $0x1f31,(%esp)
+  usefutex = 0;
+      57:	c7 05 0c 2b 00 00 00 	movl   $0x0,0x2b0c
+      5e:	00 00 00 
+  run("spin-yield");
+      61:	e8 5a 01 00 00       	call   1c0 <run>
+  usefutex = 1;
+  run("futex");
+      66:	c7 04 24 3c 1f 00 00 	movl   $0x1f3c,(%esp)
+  usefutex = 1;
+      6d:	c7 05 0c 2b 00 00 01 	movl   $0x1,0x2b0c
+      74:	00 00 00 
+  run("futex");
+      77:	e8 44 01 00 00       	call   1c0 <run>
+  exit();
+      7c:	e8 5f 02 00 00       	call   2e0 <exit>
+      81:	66 90                	xchg   %ax,%ax
+      83:	66 90                	xchg   %ax,%ax
+      85:	66 90                	xchg   %ax,%ax
+      87:	66 90                	xchg   %ax,%ax
+      89:	66 90                	xchg   %ax,%ax
+      8b:	66 90                	xchg   %ax,%ax
+      8d:	66 90                	xchg   %ax,%ax
+      8f:	90                   	nop
+
+00000090 <worker>:
+{
+      90:	55                   	push   %ebp
+      91:	89 e5                	mov    %esp,%ebp
+      93:	56                   	push   %esi
+      94:	be 88 13 00 00       	mov    $0x1388,%esi
+      99:	53                   	push   %ebx
+static inline uint
+xchg(volatile uint *addr, uint newval) {
+    uint result;
+
+    // The + in "+m" denotes a read-modify-write operand.
+    asm volatile("lock; xchgl %0, %1" :
+      9a:	bb 01 00 00 00       	mov    $0x1,%ebx
+      9f:	90                   	nop
+  if(usefutex)
+      a0:	8b 0d 0c 2b 00 00    	mov    0x2b0c,%ecx
+      a6:	85 c9                	test   %ecx,%ecx
+      a8:	74 0b                	je     b5 <worker+0x25>
+      aa:	eb 65                	jmp    111 <worker+0x81>
+      ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      yield();
+      b0:	e8 ba 06 00 00       	call   76f <yield>
+      b5:	89 d8                	mov    %ebx,%eax
+      b7:	f0 87 05 04 2b 00 00 	lock xchg %eax,0x2b04
+    while(xchg(&spin, 1) != 0)
+      be:	85 c0                	test   %eax,%eax
+      c0:	75 ee                	jne    b0 <worker+0x20>
+{
+      c2:	b8 64 00 00 00       	mov    $0x64,%eax
+      c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      ce:	66 90                	xchg   %ax,%ax
+      counter++;
+      d0:	8b 15 00 2b 00 00    	mov    0x2b00,%edx
+      d6:	83 c2 01             	add    $0x1,%edx
+      d9:	89 15 00 2b 00 00    	mov    %edx,0x2b00
+    for(j = 0; j < WORK; j++)
+      df:	83 e8 01             	sub    $0x1,%eax
+      e2:	75 ec                	jne    d0 <worker+0x40>
+  if(usefutex)
+      e4:	8b 15 0c 2b 00 00    	mov    0x2b0c,%edx
+      ea:	85 d2                	test   %edx,%edx
+      ec:	75 11                	jne    ff <worker+0x6f>
+      ee:	f0 87 05 04 2b 00 00 	lock xchg %eax,0x2b04
+  for(i = 0; i < ITERS; i++){
+      f5:	83 ee 01             	sub    $0x1,%esi
+      f8:	75 a6                	jne    a0 <worker+0x10>
+  exit();
+      fa:	e8 e1 01 00 00       	call   2e0 <exit>
+    mutex_unlock(&mu);
+      ff:	83 ec 0c             	sub    $0xc,%esp
+     102:	68 08 2b 00 00       	push   $0x2b08
+     107:	e8 34 04 00 00       	call   540 <mutex_unlock>
+}
+     10c:	83 c4 10             	add    $0x10,%esp
+     10f:	eb e4                	jmp    f5 <worker+0x65>
+    mutex_lock(&mu);
+     111:	83 ec 0c             	sub    $0xc,%esp
+     114:	68 08 2b 00 00       	push   $0x2b08
+     119:	e8 d2 03 00 00       	call   4f0 <mutex_lock>
+     11e:	83 c4 10             	add    $0x10,%esp
+     121:	eb 9f                	jmp    c2 <worker+0x32>
+     123:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     12a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000130 <lock>:
+{
+     130:	55                   	push   %ebp
+     131:	89 e5                	mov    %esp,%ebp
+     133:	53                   	push   %ebx
+     134:	83 ec 04             	sub    $0x4,%esp
+  if(usefutex)
+     137:	a1 0c 2b 00 00       	mov    0x2b0c,%eax
+     13c:	85 c0                	test   %eax,%eax
+     13e:	75 30                	jne    170 <lock+0x40>
+     140:	b8 01 00 00 00       	mov    $0x1,%eax
+     145:	f0 87 05 04 2b 00 00 	lock xchg %eax,0x2b04
+     14c:	bb 01 00 00 00       	mov    $0x1,%ebx
+    while(xchg(&spin, 1) != 0)
+     151:	85 c0                	test   %eax,%eax
+     153:	74 15                	je     16a <lock+0x3a>
+     155:	8d 76 00             	lea    0x0(%esi),%esi
+      yield();
+     158:	e8 12 06 00 00       	call   76f <yield>
+     15d:	89 d8                	mov    %ebx,%eax
+     15f:	f0 87 05 04 2b 00 00 	lock xchg %eax,0x2b04
+    while(xchg(&spin, 1) != 0)
+     166:	85 c0                	test   %eax,%eax
+     168:	75 ee                	jne    158 <lock+0x28>
+}
+     16a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     16d:	c9                   	leave
+     16e:	c3                   	ret
+     16f:	90                   	nop
+    mutex_lock(&mu);
+     170:	83 ec 0c             	sub    $0xc,%esp
+     173:	68 08 2b 00 00       	push   $0x2b08
+     178:	e8 73 03 00 00       	call   4f0 <mutex_lock>
+}
+     17d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     180:	83 c4 10             	add    $0x10,%esp
+     183:	c9                   	leave
+     184:	c3                   	ret
+     185:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     18c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000190 <unlock>:
+  if(usefutex)
+     190:	a1 0c 2b 00 00       	mov    0x2b0c,%eax
+     195:	85 c0                	test   %eax,%eax
+     197:	75 0f                	jne    1a8 <unlock+0x18>
+     199:	31 c0                	xor    %eax,%eax
+     19b:	f0 87 05 04 2b 00 00 	lock xchg %eax,0x2b04
+            "+m" (*addr), "=a" (result) :
+            "1" (newval) :
+            "cc");
+    return result;
+     1a2:	c3                   	ret
+     1a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1a7:	90                   	nop
+{
+     1a8:	55                   	push   %ebp
+     1a9:	89 e5                	mov    %esp,%ebp
+     1ab:	83 ec 14             	sub    $0x14,%esp
+    mutex_unlock(&mu);
+     1ae:	68 08 2b 00 00       	push   $0x2b08
+     1b3:	e8 88 03 00 00       	call   540 <mutex_unlock>
+}
+     1b8:	83 c4 10             	add    $0x10,%esp
+     1bb:	c9                   	leave
+     1bc:	c3                   	ret
+     1bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001c0 <run>:
+{
+     1c0:	55                   	push   %ebp
+     1c1:	89 e5                	mov    %esp,%ebp
+     1c3:	56                   	push   %esi
+     1c4:	53                   	push   %ebx
+  counter = 0;
+     1c5:	c7 05 00 2b 00 00 00 	movl   $0x0,0x2b00
+     1cc:	00 00 00 
+  t0 = uptime();
+     1cf:	e8 3c 04 00 00       	call   610 <uptime>
+     1d4:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < nthread; i++){
+     1d6:	a1 00 2a 00 00       	mov    0x2a00,%eax
+     1db:	85 c0                	test   %eax,%eax
+     1dd:	7e 41                	jle    220 <run+0x60>
+     1df:	31 db                	xor    %ebx,%ebx
+     1e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(thread_create(worker, 0) < 0){
+     1e8:	83 ec 08             	sub    $0x8,%esp
+     1eb:	6a 00                	push   $0x0
+     1ed:	68 90 00 00 00       	push   $0x90
+     1f2:	e8 69 1c 00 00       	call   1e60 <thread_create>
+     1f7:	83 c4 10             	add    $0x10,%esp
+     1fa:	85 c0                	test   %eax,%eax
+     1fc:	78 69                	js     267 <run+0xa7>
+  for(i = 0; i < nthread; i++){
+     1fe:	a1 00 2a 00 00       	mov    0x2a00,%eax
+     203:	83 c3 01             	add    $0x1,%ebx
+     206:	39 d8                	cmp    %ebx,%eax
+     208:	7f de                	jg     1e8 <run+0x28>
+  for(i = 0; i < nthread; i++)
+     20a:	85 c0                	test   %eax,%eax
+     20c:	7e 12                	jle    220 <run+0x60>
+     20e:	31 db                	xor    %ebx,%ebx
+    thread_join();
+     210:	e8 cb 1c 00 00       	call   1ee0 <thread_join>
+  for(i = 0; i < nthread; i++)
+     215:	83 c3 01             	add    $0x1,%ebx
+     218:	39 1d 00 2a 00 00    	cmp    %ebx,0x2a00
+     21e:	7f f0                	jg     210 <run+0x50>
+  t1 = uptime();
+     220:	e8 eb 03 00 00       	call   610 <uptime>
+         t1 - t0, counter == nthread*ITERS*WORK ? "ok" : "WRONG");
+     225:	8b 0d 00 2a 00 00    	mov    0x2a00,%ecx
+     22b:	8b 15 00 2b 00 00    	mov    0x2b00,%edx
+     231:	69 d9 20 a1 07 00    	imul   $0x7a120,%ecx,%ebx
+  printf(1, "%s: %d threads, %d ticks, counter %s\n", name, nthread,
+     237:	39 d3                	cmp    %edx,%ebx
+     239:	bb 28 1f 00 00       	mov    $0x1f28,%ebx
+     23e:	ba 2b 1f 00 00       	mov    $0x1f2b,%edx
+     243:	0f 44 d3             	cmove  %ebx,%edx
+     246:	83 ec 08             	sub    $0x8,%esp
+     249:	29 f0                	sub    %esi,%eax
+     24b:	52                   	push   %edx
+     24c:	50                   	push   %eax
+     24d:	51                   	push   %ecx
+     24e:	ff 75 08             	push   0x8(%ebp)
+     251:	68 68 1f 00 00       	push   $0x1f68
+     256:	6a 01                	push   $0x1
+     258:	e8 43 08 00 00       	call   aa0 <printf>
+}
+     25d:	83 c4 20             	add    $0x20,%esp
+     260:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     263:	5b                   	pop    %ebx
+     264:	5e                   	pop    %esi
+     265:	5d                   	pop    %ebp
+     266:	c3                   	ret
+      printf(1, "futexbench: thread_create failed\n");
+     267:	83 ec 08             	sub    $0x8,%esp
+     26a:	68 44 1f 00 00       	push   $0x1f44
+     26f:	6a 01                	push   $0x1
+     271:	e8 2a 08 00 00       	call   aa0 <printf>
+      exit();
+     276:	e8 65 00 00 00       	call   2e0 <exit>
+     27b:	66 90                	xchg   %ax,%ax
+     27d:	66 90                	xchg   %ax,%ax
+     27f:	90                   	nop
+
+00000280 <fork>:
+int sysexit(void) __attribute__((noreturn));
+
+int
+fork(void)
+{
+  if(flushhook)
+     280:	a1 10 2b 00 00       	mov    0x2b10,%eax
+     285:	85 c0                	test   %eax,%eax
+     287:	74 17                	je     2a0 <fork+0x20>
+{
+     289:	55                   	push   %ebp
+     28a:	89 e5                	mov    %esp,%ebp
+     28c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     28f:	ff d0                	call   *%eax
+  return sysfork();
+}
+     291:	c9                   	leave
+  return sysfork();
+     292:	e9 7f 03 00 00       	jmp    616 <sysfork>
+     297:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     29e:	66 90                	xchg   %ax,%ax
+     2a0:	e9 71 03 00 00       	jmp    616 <sysfork>
+     2a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002b0 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+     2b0:	55                   	push   %ebp
+  if(flushhook)
+     2b1:	a1 10 2b 00 00       	mov    0x2b10,%eax
+{
+     2b6:	89 e5                	mov    %esp,%ebp
+     2b8:	56                   	push   %esi
+     2b9:	53                   	push   %ebx
+     2ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     2bd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     2c0:	85 c0                	test   %eax,%eax
+     2c2:	74 02                	je     2c6 <exec+0x16>
+    flushhook();
+     2c4:	ff d0                	call   *%eax
+  return sysexec(path, argv);
+     2c6:	89 75 0c             	mov    %esi,0xc(%ebp)
+     2c9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     2cc:	5b                   	pop    %ebx
+     2cd:	5e                   	pop    %esi
+     2ce:	5d                   	pop    %ebp
+  return sysexec(path, argv);
+     2cf:	e9 ba 03 00 00       	jmp    68e <sysexec>
+     2d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2df:	90                   	nop
+
+000002e0 <exit>:
+
+int
+exit(void)
+{
+     2e0:	55                   	push   %ebp
+     2e1:	89 e5                	mov    %esp,%ebp
+     2e3:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     2e6:	a1 10 2b 00 00       	mov    0x2b10,%eax
+     2eb:	85 c0                	test   %eax,%eax
+     2ed:	74 02                	je     2f1 <exit+0x11>
+    flushhook();
+     2ef:	ff d0                	call   *%eax
+  sysexit();
+     2f1:	e8 2f 03 00 00       	call   625 <sysexit>
+     2f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000300 <strcpy>:
+}
+
+char*
+strcpy(char *s, const char *t)
+{
+     300:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     301:	31 c0                	xor    %eax,%eax
+{
+     303:	89 e5                	mov    %esp,%ebp
+     305:	53                   	push   %ebx
+     306:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     309:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     310:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     314:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     317:	83 c0 01             	add    $0x1,%eax
+     31a:	84 d2                	test   %dl,%dl
+     31c:	75 f2                	jne    310 <strcpy+0x10>
+    ;
+  return os;
+}
+     31e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     321:	89 c8                	mov    %ecx,%eax
+     323:	c9                   	leave
+     324:	c3                   	ret
+     325:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     330:	55                   	push   %ebp
+     331:	89 e5                	mov    %esp,%ebp
+     333:	53                   	push   %ebx
+     334:	8b 55 08             	mov    0x8(%ebp),%edx
+     337:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     33a:	0f b6 02             	movzbl (%edx),%eax
+     33d:	84 c0                	test   %al,%al
+     33f:	75 17                	jne    358 <strcmp+0x28>
+     341:	eb 3a                	jmp    37d <strcmp+0x4d>
+     343:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     347:	90                   	nop
+     348:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     34c:	83 c2 01             	add    $0x1,%edx
+     34f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     352:	84 c0                	test   %al,%al
+     354:	74 1a                	je     370 <strcmp+0x40>
+    p++, q++;
+     356:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     358:	0f b6 19             	movzbl (%ecx),%ebx
+     35b:	38 c3                	cmp    %al,%bl
+     35d:	74 e9                	je     348 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     35f:	29 d8                	sub    %ebx,%eax
+}
+     361:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     364:	c9                   	leave
+     365:	c3                   	ret
+     366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     36d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     370:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     374:	31 c0                	xor    %eax,%eax
+     376:	29 d8                	sub    %ebx,%eax
+}
+     378:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     37b:	c9                   	leave
+     37c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     37d:	0f b6 19             	movzbl (%ecx),%ebx
+     380:	31 c0                	xor    %eax,%eax
+     382:	eb db                	jmp    35f <strcmp+0x2f>
+     384:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     38b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     38f:	90                   	nop
+
+00000390 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     390:	55                   	push   %ebp
+     391:	89 e5                	mov    %esp,%ebp
+     393:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     396:	80 3a 00             	cmpb   $0x0,(%edx)
+     399:	74 15                	je     3b0 <strlen+0x20>
+     39b:	31 c0                	xor    %eax,%eax
+     39d:	8d 76 00             	lea    0x0(%esi),%esi
+     3a0:	83 c0 01             	add    $0x1,%eax
+     3a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     3a7:	89 c1                	mov    %eax,%ecx
+     3a9:	75 f5                	jne    3a0 <strlen+0x10>
+    ;
+  return n;
+}
+     3ab:	89 c8                	mov    %ecx,%eax
+     3ad:	5d                   	pop    %ebp
+     3ae:	c3                   	ret
+     3af:	90                   	nop
+  for(n = 0; s[n]; n++)
+     3b0:	31 c9                	xor    %ecx,%ecx
+}
+     3b2:	5d                   	pop    %ebp
+     3b3:	89 c8                	mov    %ecx,%eax
+     3b5:	c3                   	ret
+     3b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     3c0:	55                   	push   %ebp
+     3c1:	89 e5                	mov    %esp,%ebp
+     3c3:	57                   	push   %edi
+     3c4:	8b 55 08             	mov    0x8(%ebp),%edx
+    asm volatile("cld; rep stosb" :
+     3c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     3ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+     3cd:	89 d7                	mov    %edx,%edi
+     3cf:	fc                   	cld
+     3d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     3d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     3d5:	89 d0                	mov    %edx,%eax
+     3d7:	c9                   	leave
+     3d8:	c3                   	ret
+     3d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     3e0:	55                   	push   %ebp
+     3e1:	89 e5                	mov    %esp,%ebp
+     3e3:	8b 45 08             	mov    0x8(%ebp),%eax
+     3e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     3ea:	0f b6 10             	movzbl (%eax),%edx
+     3ed:	84 d2                	test   %dl,%dl
+     3ef:	75 12                	jne    403 <strchr+0x23>
+     3f1:	eb 1d                	jmp    410 <strchr+0x30>
+     3f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3f7:	90                   	nop
+     3f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     3fc:	83 c0 01             	add    $0x1,%eax
+     3ff:	84 d2                	test   %dl,%dl
+     401:	74 0d                	je     410 <strchr+0x30>
+    if(*s == c)
+     403:	38 d1                	cmp    %dl,%cl
+     405:	75 f1                	jne    3f8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     407:	5d                   	pop    %ebp
+     408:	c3                   	ret
+     409:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     410:	31 c0                	xor    %eax,%eax
+}
+     412:	5d                   	pop    %ebp
+     413:	c3                   	ret
+     414:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     41b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     41f:	90                   	nop
+
+00000420 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     420:	55                   	push   %ebp
+     421:	89 e5                	mov    %esp,%ebp
+     423:	56                   	push   %esi
+     424:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     425:	83 ec 08             	sub    $0x8,%esp
+     428:	6a 00                	push   $0x0
+     42a:	ff 75 08             	push   0x8(%ebp)
+     42d:	e8 6b 02 00 00       	call   69d <open>
+  if(fd < 0)
+     432:	83 c4 10             	add    $0x10,%esp
+     435:	85 c0                	test   %eax,%eax
+     437:	78 27                	js     460 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     439:	83 ec 08             	sub    $0x8,%esp
+     43c:	ff 75 0c             	push   0xc(%ebp)
+     43f:	89 c3                	mov    %eax,%ebx
+     441:	50                   	push   %eax
+     442:	e8 83 02 00 00       	call   6ca <fstat>
+  close(fd);
+     447:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     44a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     44c:	e8 1f 02 00 00       	call   670 <close>
+  return r;
+     451:	83 c4 10             	add    $0x10,%esp
+}
+     454:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     457:	89 f0                	mov    %esi,%eax
+     459:	5b                   	pop    %ebx
+     45a:	5e                   	pop    %esi
+     45b:	5d                   	pop    %ebp
+     45c:	c3                   	ret
+     45d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     460:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     465:	eb ed                	jmp    454 <stat+0x34>
+     467:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     46e:	66 90                	xchg   %ax,%ax
+
+00000470 <atoi>:
+
+int
+atoi(const char *s)
+{
+     470:	55                   	push   %ebp
+     471:	89 e5                	mov    %esp,%ebp
+     473:	53                   	push   %ebx
+     474:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     477:	0f be 02             	movsbl (%edx),%eax
+     47a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     47d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     480:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     485:	77 1e                	ja     4a5 <atoi+0x35>
+     487:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     48e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     490:	83 c2 01             	add    $0x1,%edx
+     493:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     496:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     49a:	0f be 02             	movsbl (%edx),%eax
+     49d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     4a0:	80 fb 09             	cmp    $0x9,%bl
+     4a3:	76 eb                	jbe    490 <atoi+0x20>
+  return n;
+}
+     4a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4a8:	89 c8                	mov    %ecx,%eax
+     4aa:	c9                   	leave
+     4ab:	c3                   	ret
+     4ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     4b0:	55                   	push   %ebp
+     4b1:	89 e5                	mov    %esp,%ebp
+     4b3:	57                   	push   %edi
+     4b4:	56                   	push   %esi
+     4b5:	8b 45 10             	mov    0x10(%ebp),%eax
+     4b8:	8b 55 08             	mov    0x8(%ebp),%edx
+     4bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     4be:	85 c0                	test   %eax,%eax
+     4c0:	7e 13                	jle    4d5 <memmove+0x25>
+     4c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     4c4:	89 d7                	mov    %edx,%edi
+     4c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     4d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     4d1:	39 f8                	cmp    %edi,%eax
+     4d3:	75 fb                	jne    4d0 <memmove+0x20>
+  return vdst;
+}
+     4d5:	5e                   	pop    %esi
+     4d6:	89 d0                	mov    %edx,%eax
+     4d8:	5f                   	pop    %edi
+     4d9:	5d                   	pop    %ebp
+     4da:	c3                   	ret
+     4db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4df:	90                   	nop
+
+000004e0 <mutex_init>:
+
+// Futex-based mutex (Drepper, "Futexes Are Tricky", mutex 2).
+// The uncontended paths never enter the kernel.
+void
+mutex_init(struct mutex *m)
+{
+     4e0:	55                   	push   %ebp
+     4e1:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+     4e3:	8b 45 08             	mov    0x8(%ebp),%eax
+     4e6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     4ec:	5d                   	pop    %ebp
+     4ed:	c3                   	ret
+     4ee:	66 90                	xchg   %ax,%ax
+
+000004f0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     4f0:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     4f1:	31 c0                	xor    %eax,%eax
+     4f3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+     4f8:	89 e5                	mov    %esp,%ebp
+     4fa:	56                   	push   %esi
+     4fb:	53                   	push   %ebx
+     4fc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     4ff:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     503:	85 c0                	test   %eax,%eax
+     505:	74 32                	je     539 <mutex_lock+0x49>
+    return;
+  if(c != 2)
+     507:	83 f8 02             	cmp    $0x2,%eax
+     50a:	74 0c                	je     518 <mutex_lock+0x28>
+    asm volatile("lock; xchgl %0, %1" :
+     50c:	b8 02 00 00 00       	mov    $0x2,%eax
+     511:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+     514:	85 c0                	test   %eax,%eax
+     516:	74 21                	je     539 <mutex_lock+0x49>
+     518:	be 02 00 00 00       	mov    $0x2,%esi
+     51d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAIT, 2);
+     520:	83 ec 04             	sub    $0x4,%esp
+     523:	6a 02                	push   $0x2
+     525:	6a 00                	push   $0x0
+     527:	53                   	push   %ebx
+     528:	e8 33 02 00 00       	call   760 <futex>
+     52d:	89 f0                	mov    %esi,%eax
+     52f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     532:	83 c4 10             	add    $0x10,%esp
+     535:	85 c0                	test   %eax,%eax
+     537:	75 e7                	jne    520 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+     539:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     53c:	5b                   	pop    %ebx
+     53d:	5e                   	pop    %esi
+     53e:	5d                   	pop    %ebp
+     53f:	c3                   	ret
+
+00000540 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     540:	55                   	push   %ebp
+     541:	89 e5                	mov    %esp,%ebp
+     543:	83 ec 08             	sub    $0x8,%esp
+     546:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     549:	f0 83 28 01          	lock subl $0x1,(%eax)
+     54d:	75 09                	jne    558 <mutex_unlock+0x18>
+    m->val = 0;
+    futex(&m->val, FUTEX_WAKE, 1);
+  }
+}
+     54f:	c9                   	leave
+     550:	c3                   	ret
+     551:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     558:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     55b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex(&m->val, FUTEX_WAKE, 1);
+     561:	6a 01                	push   $0x1
+     563:	6a 01                	push   $0x1
+     565:	50                   	push   %eax
+     566:	e8 f5 01 00 00       	call   760 <futex>
+     56b:	83 c4 10             	add    $0x10,%esp
+}
+     56e:	c9                   	leave
+     56f:	c3                   	ret
+
+00000570 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     570:	55                   	push   %ebp
+     571:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     573:	8b 45 08             	mov    0x8(%ebp),%eax
+     576:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     57c:	5d                   	pop    %ebp
+     57d:	c3                   	ret
+     57e:	66 90                	xchg   %ax,%ax
+
+00000580 <cond_wait>:
+
+// Release m and wait for a signal, then reacquire m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     580:	55                   	push   %ebp
+     581:	89 e5                	mov    %esp,%ebp
+     583:	57                   	push   %edi
+     584:	56                   	push   %esi
+     585:	53                   	push   %ebx
+     586:	83 ec 0c             	sub    $0xc,%esp
+     589:	8b 75 08             	mov    0x8(%ebp),%esi
+     58c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     58f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     591:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+     595:	75 21                	jne    5b8 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     597:	83 ec 04             	sub    $0x4,%esp
+     59a:	57                   	push   %edi
+     59b:	6a 00                	push   $0x0
+     59d:	56                   	push   %esi
+     59e:	e8 bd 01 00 00       	call   760 <futex>
+  mutex_lock(m);
+     5a3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     5a6:	83 c4 10             	add    $0x10,%esp
+}
+     5a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     5ac:	5b                   	pop    %ebx
+     5ad:	5e                   	pop    %esi
+     5ae:	5f                   	pop    %edi
+     5af:	5d                   	pop    %ebp
+  mutex_lock(m);
+     5b0:	e9 3b ff ff ff       	jmp    4f0 <mutex_lock>
+     5b5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     5b8:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     5bb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex(&m->val, FUTEX_WAKE, 1);
+     5c1:	6a 01                	push   $0x1
+     5c3:	6a 01                	push   $0x1
+     5c5:	53                   	push   %ebx
+     5c6:	e8 95 01 00 00       	call   760 <futex>
+     5cb:	83 c4 10             	add    $0x10,%esp
+     5ce:	eb c7                	jmp    597 <cond_wait+0x17>
+
+000005d0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+     5d0:	55                   	push   %ebp
+     5d1:	89 e5                	mov    %esp,%ebp
+     5d3:	83 ec 0c             	sub    $0xc,%esp
+     5d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     5d9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+     5dd:	6a 01                	push   $0x1
+     5df:	6a 01                	push   $0x1
+     5e1:	50                   	push   %eax
+     5e2:	e8 79 01 00 00       	call   760 <futex>
+}
+     5e7:	83 c4 10             	add    $0x10,%esp
+     5ea:	c9                   	leave
+     5eb:	c3                   	ret
+     5ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005f0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     5f0:	55                   	push   %ebp
+     5f1:	89 e5                	mov    %esp,%ebp
+     5f3:	83 ec 0c             	sub    $0xc,%esp
+     5f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     5f9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+     5fd:	6a 40                	push   $0x40
+     5ff:	6a 01                	push   $0x1
+     601:	50                   	push   %eax
+     602:	e8 59 01 00 00       	call   760 <futex>
+}
+     607:	83 c4 10             	add    $0x10,%esp
+     60a:	c9                   	leave
+     60b:	c3                   	ret
+     60c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000610 <uptime>:
+// Clock ticks since boot, read from the kernel's vdso page
+// without a system call.
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     610:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+     615:	c3                   	ret
+
+00000616 <sysfork>:
+  1: ret
+
+#define SYSCALL(name) SYSCALLAS(name, name)
+
+// ulib.c wraps these.
+SYSCALLAS(sysfork, fork)
+     616:	b8 01 00 00 00       	mov    $0x1,%eax
+     61b:	89 e1                	mov    %esp,%ecx
+     61d:	ba 24 06 00 00       	mov    $0x624,%edx
+     622:	0f 34                	sysenter
+     624:	c3                   	ret
+
+00000625 <sysexit>:
+SYSCALLAS(sysexit, exit)
+     625:	b8 02 00 00 00       	mov    $0x2,%eax
+     62a:	89 e1                	mov    %esp,%ecx
+     62c:	ba 33 06 00 00       	mov    $0x633,%edx
+     631:	0f 34                	sysenter
+     633:	c3                   	ret
+
+00000634 <wait>:
+SYSCALL(wait)
+     634:	b8 03 00 00 00       	mov    $0x3,%eax
+     639:	89 e1                	mov    %esp,%ecx
+     63b:	ba 42 06 00 00       	mov    $0x642,%edx
+     640:	0f 34                	sysenter
+     642:	c3                   	ret
+
+00000643 <pipe>:
+SYSCALL(pipe)
+     643:	b8 04 00 00 00       	mov    $0x4,%eax
+     648:	89 e1                	mov    %esp,%ecx
+     64a:	ba 51 06 00 00       	mov    $0x651,%edx
+     64f:	0f 34                	sysenter
+     651:	c3                   	ret
+
+00000652 <read>:
+SYSCALL(read)
+     652:	b8 05 00 00 00       	mov    $0x5,%eax
+     657:	89 e1                	mov    %esp,%ecx
+     659:	ba 60 06 00 00       	mov    $0x660,%edx
+     65e:	0f 34                	sysenter
+     660:	c3                   	ret
+
+00000661 <write>:
+SYSCALL(write)
+     661:	b8 10 00 00 00       	mov    $0x10,%eax
+     666:	89 e1                	mov    %esp,%ecx
+     668:	ba 6f 06 00 00       	mov    $0x66f,%edx
+     66d:	0f 34                	sysenter
+     66f:	c3                   	ret
+
+00000670 <close>:
+SYSCALL(close)
+     670:	b8 15 00 00 00       	mov    $0x15,%eax
+     675:	89 e1                	mov    %esp,%ecx
+     677:	ba 7e 06 00 00       	mov    $0x67e,%edx
+     67c:	0f 34                	sysenter
+     67e:	c3                   	ret
+
+0000067f <kill>:
+SYSCALL(kill)
+     67f:	b8 06 00 00 00       	mov    $0x6,%eax
+     684:	89 e1                	mov    %esp,%ecx
+     686:	ba 8d 06 00 00       	mov    $0x68d,%edx
+     68b:	0f 34                	sysenter
+     68d:	c3                   	ret
+
+0000068e <sysexec>:
+SYSCALLAS(sysexec, exec)
+     68e:	b8 07 00 00 00       	mov    $0x7,%eax
+     693:	89 e1                	mov    %esp,%ecx
+     695:	ba 9c 06 00 00       	mov    $0x69c,%edx
+     69a:	0f 34                	sysenter
+     69c:	c3                   	ret
+
+0000069d <open>:
+SYSCALL(open)
+     69d:	b8 0f 00 00 00       	mov    $0xf,%eax
+     6a2:	89 e1                	mov    %esp,%ecx
+     6a4:	ba ab 06 00 00       	mov    $0x6ab,%edx
+     6a9:	0f 34                	sysenter
+     6ab:	c3                   	ret
+
+000006ac <mknod>:
+SYSCALL(mknod)
+     6ac:	b8 11 00 00 00       	mov    $0x11,%eax
+     6b1:	89 e1                	mov    %esp,%ecx
+     6b3:	ba ba 06 00 00       	mov    $0x6ba,%edx
+     6b8:	0f 34                	sysenter
+     6ba:	c3                   	ret
+
+000006bb <unlink>:
+SYSCALL(unlink)
+     6bb:	b8 12 00 00 00       	mov    $0x12,%eax
+     6c0:	89 e1                	mov    %esp,%ecx
+     6c2:	ba c9 06 00 00       	mov    $0x6c9,%edx
+     6c7:	0f 34                	sysenter
+     6c9:	c3                   	ret
+
+000006ca <fstat>:
+SYSCALL(fstat)
+     6ca:	b8 08 00 00 00       	mov    $0x8,%eax
+     6cf:	89 e1                	mov    %esp,%ecx
+     6d1:	ba d8 06 00 00       	mov    $0x6d8,%edx
+     6d6:	0f 34                	sysenter
+     6d8:	c3                   	ret
+
+000006d9 <link>:
+SYSCALL(link)
+     6d9:	b8 13 00 00 00       	mov    $0x13,%eax
+     6de:	89 e1                	mov    %esp,%ecx
+     6e0:	ba e7 06 00 00       	mov    $0x6e7,%edx
+     6e5:	0f 34                	sysenter
+     6e7:	c3                   	ret
+
+000006e8 <mkdir>:
+SYSCALL(mkdir)
+     6e8:	b8 14 00 00 00       	mov    $0x14,%eax
+     6ed:	89 e1                	mov    %esp,%ecx
+     6ef:	ba f6 06 00 00       	mov    $0x6f6,%edx
+     6f4:	0f 34                	sysenter
+     6f6:	c3                   	ret
+
+000006f7 <chdir>:
+SYSCALL(chdir)
+     6f7:	b8 09 00 00 00       	mov    $0x9,%eax
+     6fc:	89 e1                	mov    %esp,%ecx
+     6fe:	ba 05 07 00 00       	mov    $0x705,%edx
+     703:	0f 34                	sysenter
+     705:	c3                   	ret
+
+00000706 <dup>:
+SYSCALL(dup)
+     706:	b8 0a 00 00 00       	mov    $0xa,%eax
+     70b:	89 e1                	mov    %esp,%ecx
+     70d:	ba 14 07 00 00       	mov    $0x714,%edx
+     712:	0f 34                	sysenter
+     714:	c3                   	ret
+
+00000715 <getpid>:
+SYSCALL(getpid)
+     715:	b8 0b 00 00 00       	mov    $0xb,%eax
+     71a:	89 e1                	mov    %esp,%ecx
+     71c:	ba 23 07 00 00       	mov    $0x723,%edx
+     721:	0f 34                	sysenter
+     723:	c3                   	ret
+
+00000724 <sbrk>:
+SYSCALL(sbrk)
+     724:	b8 0c 00 00 00       	mov    $0xc,%eax
+     729:	89 e1                	mov    %esp,%ecx
+     72b:	ba 32 07 00 00       	mov    $0x732,%edx
+     730:	0f 34                	sysenter
+     732:	c3                   	ret
+
+00000733 <sleep>:
+SYSCALL(sleep)
+     733:	b8 0d 00 00 00       	mov    $0xd,%eax
+     738:	89 e1                	mov    %esp,%ecx
+     73a:	ba 41 07 00 00       	mov    $0x741,%edx
+     73f:	0f 34                	sysenter
+     741:	c3                   	ret
+
+00000742 <clone>:
+SYSCALL(clone)
+     742:	b8 16 00 00 00       	mov    $0x16,%eax
+     747:	89 e1                	mov    %esp,%ecx
+     749:	ba 50 07 00 00       	mov    $0x750,%edx
+     74e:	0f 34                	sysenter
+     750:	c3                   	ret
+
+00000751 <join>:
+SYSCALL(join)
+     751:	b8 17 00 00 00       	mov    $0x17,%eax
+     756:	89 e1                	mov    %esp,%ecx
+     758:	ba 5f 07 00 00       	mov    $0x75f,%edx
+     75d:	0f 34                	sysenter
+     75f:	c3                   	ret
+
+00000760 <futex>:
+SYSCALL(futex)
+     760:	b8 18 00 00 00       	mov    $0x18,%eax
+     765:	89 e1                	mov    %esp,%ecx
+     767:	ba 6e 07 00 00       	mov    $0x76e,%edx
+     76c:	0f 34                	sysenter
+     76e:	c3                   	ret
+
+0000076f <yield>:
+SYSCALL(yield)
+     76f:	b8 19 00 00 00       	mov    $0x19,%eax
+     774:	89 e1                	mov    %esp,%ecx
+     776:	ba 7d 07 00 00       	mov    $0x77d,%edx
+     77b:	0f 34                	sysenter
+     77d:	c3                   	ret
+
+0000077e <lockstat>:
+SYSCALL(lockstat)
+     77e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     783:	89 e1                	mov    %esp,%ecx
+     785:	ba 8c 07 00 00       	mov    $0x78c,%edx
+     78a:	0f 34                	sysenter
+     78c:	c3                   	ret
+
+0000078d <lockhammer>:
+SYSCALL(lockhammer)
+     78d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     792:	89 e1                	mov    %esp,%ecx
+     794:	ba 9b 07 00 00       	mov    $0x79b,%edx
+     799:	0f 34                	sysenter
+     79b:	c3                   	ret
+
+0000079c <vmsplice>:
+SYSCALL(vmsplice)
+     79c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     7a1:	89 e1                	mov    %esp,%ecx
+     7a3:	ba aa 07 00 00       	mov    $0x7aa,%edx
+     7a8:	0f 34                	sysenter
+     7aa:	c3                   	ret
+
+000007ab <hsbrk>:
+SYSCALL(hsbrk)
+     7ab:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     7b0:	89 e1                	mov    %esp,%ecx
+     7b2:	ba b9 07 00 00       	mov    $0x7b9,%edx
+     7b7:	0f 34                	sysenter
+     7b9:	c3                   	ret
+
+000007ba <mmap>:
+SYSCALL(mmap)
+     7ba:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     7bf:	89 e1                	mov    %esp,%ecx
+     7c1:	ba c8 07 00 00       	mov    $0x7c8,%edx
+     7c6:	0f 34                	sysenter
+     7c8:	c3                   	ret
+
+000007c9 <munmap>:
+SYSCALL(munmap)
+     7c9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     7ce:	89 e1                	mov    %esp,%ecx
+     7d0:	ba d7 07 00 00       	mov    $0x7d7,%edx
+     7d5:	0f 34                	sysenter
+     7d7:	c3                   	ret
+
+000007d8 <ringenter>:
+SYSCALL(ringenter)
+     7d8:	b8 20 00 00 00       	mov    $0x20,%eax
+     7dd:	89 e1                	mov    %esp,%ecx
+     7df:	ba e6 07 00 00       	mov    $0x7e6,%edx
+     7e4:	0f 34                	sysenter
+     7e6:	c3                   	ret
+
+000007e7 <readv>:
+SYSCALL(readv)
+     7e7:	b8 21 00 00 00       	mov    $0x21,%eax
+     7ec:	89 e1                	mov    %esp,%ecx
+     7ee:	ba f5 07 00 00       	mov    $0x7f5,%edx
+     7f3:	0f 34                	sysenter
+     7f5:	c3                   	ret
+
+000007f6 <writev>:
+SYSCALL(writev)
+     7f6:	b8 22 00 00 00       	mov    $0x22,%eax
+     7fb:	89 e1                	mov    %esp,%ecx
+     7fd:	ba 04 08 00 00       	mov    $0x804,%edx
+     802:	0f 34                	sysenter
+     804:	c3                   	ret
+
+00000805 <pread>:
+SYSCALL(pread)
+     805:	b8 23 00 00 00       	mov    $0x23,%eax
+     80a:	89 e1                	mov    %esp,%ecx
+     80c:	ba 13 08 00 00       	mov    $0x813,%edx
+     811:	0f 34                	sysenter
+     813:	c3                   	ret
+
+00000814 <pwrite>:
+SYSCALL(pwrite)
+     814:	b8 24 00 00 00       	mov    $0x24,%eax
+     819:	89 e1                	mov    %esp,%ecx
+     81b:	ba 22 08 00 00       	mov    $0x822,%edx
+     820:	0f 34                	sysenter
+     822:	c3                   	ret
+
+00000823 <prof>:
+SYSCALL(prof)
+     823:	b8 25 00 00 00       	mov    $0x25,%eax
+     828:	89 e1                	mov    %esp,%ecx
+     82a:	ba 31 08 00 00       	mov    $0x831,%edx
+     82f:	0f 34                	sysenter
+     831:	c3                   	ret
+
+00000832 <scstat>:
+SYSCALL(scstat)
+     832:	b8 26 00 00 00       	mov    $0x26,%eax
+     837:	89 e1                	mov    %esp,%ecx
+     839:	ba 40 08 00 00       	mov    $0x840,%edx
+     83e:	0f 34                	sysenter
+     840:	c3                   	ret
+     841:	66 90                	xchg   %ax,%ax
+     843:	66 90                	xchg   %ax,%ax
+     845:	66 90                	xchg   %ax,%ax
+     847:	66 90                	xchg   %ax,%ax
+     849:	66 90                	xchg   %ax,%ax
+     84b:	66 90                	xchg   %ax,%ax
+     84d:	66 90                	xchg   %ax,%ax
+     84f:	90                   	nop
+
+00000850 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+     850:	55                   	push   %ebp
+     851:	89 e5                	mov    %esp,%ebp
+     853:	57                   	push   %edi
+     854:	56                   	push   %esi
+     855:	53                   	push   %ebx
+     856:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     858:	89 d1                	mov    %edx,%ecx
+{
+     85a:	83 ec 2c             	sub    $0x2c,%esp
+     85d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+     860:	85 d2                	test   %edx,%edx
+     862:	79 7c                	jns    8e0 <printint+0x90>
+     864:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     868:	74 76                	je     8e0 <printint+0x90>
+    x = -xx;
+     86a:	f7 d9                	neg    %ecx
+    neg = 1;
+     86c:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     871:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     874:	31 f6                	xor    %esi,%esi
+     876:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     87d:	8d 76 00             	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     880:	89 c8                	mov    %ecx,%eax
+     882:	31 d2                	xor    %edx,%edx
+     884:	89 f7                	mov    %esi,%edi
+     886:	f7 f3                	div    %ebx
+     888:	8d 76 01             	lea    0x1(%esi),%esi
+     88b:	0f b6 92 f0 1f 00 00 	movzbl 0x1ff0(%edx),%edx
+     892:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     896:	89 ca                	mov    %ecx,%edx
+     898:	89 c1                	mov    %eax,%ecx
+     89a:	39 da                	cmp    %ebx,%edx
+     89c:	73 e2                	jae    880 <printint+0x30>
+  if(neg)
+     89e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     8a1:	85 c0                	test   %eax,%eax
+     8a3:	74 07                	je     8ac <printint+0x5c>
+    buf[i++] = '-';
+     8a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     8aa:	89 f7                	mov    %esi,%edi
+     8ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     8af:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     8b2:	01 df                	add    %ebx,%edi
+     8b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc_unlocked(buf[i], f);
+     8b8:	83 ec 08             	sub    $0x8,%esp
+     8bb:	56                   	push   %esi
+     8bc:	0f be 07             	movsbl (%edi),%eax
+     8bf:	50                   	push   %eax
+     8c0:	e8 cb 07 00 00       	call   1090 <putc_unlocked>
+  while(--i >= 0)
+     8c5:	89 f8                	mov    %edi,%eax
+     8c7:	83 c4 10             	add    $0x10,%esp
+     8ca:	83 ef 01             	sub    $0x1,%edi
+     8cd:	39 d8                	cmp    %ebx,%eax
+     8cf:	75 e7                	jne    8b8 <printint+0x68>
+}
+     8d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8d4:	5b                   	pop    %ebx
+     8d5:	5e                   	pop    %esi
+     8d6:	5f                   	pop    %edi
+     8d7:	5d                   	pop    %ebp
+     8d8:	c3                   	ret
+     8d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     8e0:	31 c0                	xor    %eax,%eax
+     8e2:	eb 8d                	jmp    871 <printint+0x21>
+     8e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     8ef:	90                   	nop
+
+000008f0 <vfprintf>:
+
+// Print to the given stream, which the caller has locked.
+// Only understands %d, %x, %p, %s.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+     8f0:	55                   	push   %ebp
+     8f1:	89 e5                	mov    %esp,%ebp
+     8f3:	57                   	push   %edi
+     8f4:	56                   	push   %esi
+     8f5:	53                   	push   %ebx
+     8f6:	83 ec 1c             	sub    $0x1c,%esp
+     8f9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     8fc:	0f b6 0a             	movzbl (%edx),%ecx
+     8ff:	84 c9                	test   %cl,%cl
+     901:	74 5c                	je     95f <vfprintf+0x6f>
+     903:	89 c6                	mov    %eax,%esi
+     905:	8d 5a 01             	lea    0x1(%edx),%ebx
+     908:	31 ff                	xor    %edi,%edi
+     90a:	eb 20                	jmp    92c <vfprintf+0x3c>
+     90c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     910:	83 f9 25             	cmp    $0x25,%ecx
+     913:	74 3b                	je     950 <vfprintf+0x60>
+        state = '%';
+      } else {
+        putc_unlocked(c, f);
+     915:	83 ec 08             	sub    $0x8,%esp
+     918:	56                   	push   %esi
+     919:	51                   	push   %ecx
+     91a:	e8 71 07 00 00       	call   1090 <putc_unlocked>
+     91f:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     922:	0f b6 0b             	movzbl (%ebx),%ecx
+     925:	83 c3 01             	add    $0x1,%ebx
+     928:	84 c9                	test   %cl,%cl
+     92a:	74 33                	je     95f <vfprintf+0x6f>
+    if(state == 0){
+     92c:	85 ff                	test   %edi,%edi
+     92e:	74 e0                	je     910 <vfprintf+0x20>
+      }
+    } else if(state == '%'){
+     930:	83 ff 25             	cmp    $0x25,%edi
+     933:	75 ed                	jne    922 <vfprintf+0x32>
+      if(c == 'd'){
+     935:	83 f9 25             	cmp    $0x25,%ecx
+     938:	0f 84 02 01 00 00    	je     a40 <vfprintf+0x150>
+     93e:	8d 41 9d             	lea    -0x63(%ecx),%eax
+     941:	83 f8 15             	cmp    $0x15,%eax
+     944:	77 2a                	ja     970 <vfprintf+0x80>
+     946:	ff 24 85 98 1f 00 00 	jmp    *0x1f98(,%eax,4)
+     94d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     950:	0f b6 0b             	movzbl (%ebx),%ecx
+     953:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     956:	bf 25 00 00 00       	mov    $0x25,%edi
+  for(i = 0; fmt[i]; i++){
+     95b:	84 c9                	test   %cl,%cl
+     95d:	75 cd                	jne    92c <vfprintf+0x3c>
+        putc_unlocked(c, f);
+      }
+      state = 0;
+    }
+  }
+}
+     95f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     962:	5b                   	pop    %ebx
+     963:	5e                   	pop    %esi
+     964:	5f                   	pop    %edi
+     965:	5d                   	pop    %ebp
+     966:	c3                   	ret
+     967:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     96e:	66 90                	xchg   %ax,%ax
+        putc_unlocked('%', f);
+     970:	83 ec 08             	sub    $0x8,%esp
+     973:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     976:	56                   	push   %esi
+     977:	6a 25                	push   $0x25
+     979:	e8 12 07 00 00       	call   1090 <putc_unlocked>
+        putc_unlocked(c, f);
+     97e:	58                   	pop    %eax
+     97f:	5a                   	pop    %edx
+     980:	56                   	push   %esi
+     981:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     984:	51                   	push   %ecx
+     985:	e8 06 07 00 00       	call   1090 <putc_unlocked>
+     98a:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     98d:	31 ff                	xor    %edi,%edi
+     98f:	eb 91                	jmp    922 <vfprintf+0x32>
+     991:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+     998:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     99b:	83 ec 0c             	sub    $0xc,%esp
+     99e:	b9 10 00 00 00       	mov    $0x10,%ecx
+     9a3:	8b 17                	mov    (%edi),%edx
+     9a5:	6a 00                	push   $0x0
+        ap++;
+     9a7:	83 c7 04             	add    $0x4,%edi
+        printint(f, *ap, 16, 0);
+     9aa:	89 f0                	mov    %esi,%eax
+     9ac:	e8 9f fe ff ff       	call   850 <printint>
+        ap++;
+     9b1:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     9b4:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     9b7:	31 ff                	xor    %edi,%edi
+     9b9:	e9 64 ff ff ff       	jmp    922 <vfprintf+0x32>
+     9be:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     9c0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     9c3:	8b 10                	mov    (%eax),%edx
+        ap++;
+     9c5:	83 c0 04             	add    $0x4,%eax
+     9c8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     9cb:	85 d2                	test   %edx,%edx
+     9cd:	0f 84 85 00 00 00    	je     a58 <vfprintf+0x168>
+        while(*s != 0){
+     9d3:	0f be 02             	movsbl (%edx),%eax
+        s = (char*)*ap;
+     9d6:	89 d7                	mov    %edx,%edi
+        while(*s != 0){
+     9d8:	84 c0                	test   %al,%al
+     9da:	74 b1                	je     98d <vfprintf+0x9d>
+     9dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+          putc_unlocked(*s, f);
+     9e0:	83 ec 08             	sub    $0x8,%esp
+          s++;
+     9e3:	83 c7 01             	add    $0x1,%edi
+          putc_unlocked(*s, f);
+     9e6:	56                   	push   %esi
+     9e7:	50                   	push   %eax
+     9e8:	e8 a3 06 00 00       	call   1090 <putc_unlocked>
+        while(*s != 0){
+     9ed:	0f be 07             	movsbl (%edi),%eax
+     9f0:	83 c4 10             	add    $0x10,%esp
+     9f3:	84 c0                	test   %al,%al
+     9f5:	75 e9                	jne    9e0 <vfprintf+0xf0>
+      state = 0;
+     9f7:	31 ff                	xor    %edi,%edi
+     9f9:	e9 24 ff ff ff       	jmp    922 <vfprintf+0x32>
+     9fe:	66 90                	xchg   %ax,%ax
+        printint(f, *ap, 10, 1);
+     a00:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     a03:	83 ec 0c             	sub    $0xc,%esp
+     a06:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     a0b:	8b 17                	mov    (%edi),%edx
+     a0d:	6a 01                	push   $0x1
+     a0f:	eb 96                	jmp    9a7 <vfprintf+0xb7>
+     a11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc_unlocked(*ap, f);
+     a18:	83 ec 08             	sub    $0x8,%esp
+     a1b:	56                   	push   %esi
+     a1c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     a1f:	ff 37                	push   (%edi)
+     a21:	e8 6a 06 00 00       	call   1090 <putc_unlocked>
+        ap++;
+     a26:	89 f8                	mov    %edi,%eax
+     a28:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     a2b:	31 ff                	xor    %edi,%edi
+        ap++;
+     a2d:	83 c0 04             	add    $0x4,%eax
+     a30:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     a33:	e9 ea fe ff ff       	jmp    922 <vfprintf+0x32>
+     a38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a3f:	90                   	nop
+        putc_unlocked(c, f);
+     a40:	83 ec 08             	sub    $0x8,%esp
+      state = 0;
+     a43:	31 ff                	xor    %edi,%edi
+        putc_unlocked(c, f);
+     a45:	56                   	push   %esi
+     a46:	6a 25                	push   $0x25
+     a48:	e8 43 06 00 00       	call   1090 <putc_unlocked>
+     a4d:	83 c4 10             	add    $0x10,%esp
+     a50:	e9 cd fe ff ff       	jmp    922 <vfprintf+0x32>
+     a55:	8d 76 00             	lea    0x0(%esi),%esi
+     a58:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     a5d:	bf 8e 1f 00 00       	mov    $0x1f8e,%edi
+     a62:	e9 79 ff ff ff       	jmp    9e0 <vfprintf+0xf0>
+     a67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a6e:	66 90                	xchg   %ax,%ax
+
+00000a70 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+     a70:	55                   	push   %ebp
+     a71:	89 e5                	mov    %esp,%ebp
+     a73:	53                   	push   %ebx
+     a74:	83 ec 10             	sub    $0x10,%esp
+     a77:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  flockfile(f);
+     a7a:	53                   	push   %ebx
+     a7b:	e8 d0 02 00 00       	call   d50 <flockfile>
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     a80:	8b 55 0c             	mov    0xc(%ebp),%edx
+     a83:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     a86:	89 d8                	mov    %ebx,%eax
+     a88:	e8 63 fe ff ff       	call   8f0 <vfprintf>
+  funlockfile(f);
+     a8d:	89 1c 24             	mov    %ebx,(%esp)
+     a90:	e8 eb 02 00 00       	call   d80 <funlockfile>
+}
+     a95:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a98:	83 c4 10             	add    $0x10,%esp
+     a9b:	c9                   	leave
+     a9c:	c3                   	ret
+     a9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000aa0 <printf>:
+
+// Print to the given fd: through stdout or stderr for 1 and 2,
+// otherwise with one write() per call.
+void
+printf(int fd, const char *fmt, ...)
+{
+     aa0:	55                   	push   %ebp
+     aa1:	89 e5                	mov    %esp,%ebp
+     aa3:	56                   	push   %esi
+     aa4:	53                   	push   %ebx
+     aa5:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+     aab:	8b 45 08             	mov    0x8(%ebp),%eax
+  char buf[128];
+  struct iobuf f;
+
+  if(fd == 1 || fd == 2){
+    flockfile(&_iob[fd]);
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     aae:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(fd == 1 || fd == 2){
+     ab1:	8d 50 ff             	lea    -0x1(%eax),%edx
+     ab4:	83 fa 01             	cmp    $0x1,%edx
+     ab7:	76 77                	jbe    b30 <printf+0x90>
+    funlockfile(&_iob[fd]);
+    return;
+  }
+  f.fd = fd;
+     ab9:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  f.flags = IO_WRITE|IO_SETUP;
+  f.buf = buf;
+     abf:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  f.size = sizeof(buf);
+  f.r = f.n = 0;
+  mutex_init(&f.lock);
+     ac5:	83 ec 0c             	sub    $0xc,%esp
+     ac8:	8d 9d 5c ff ff ff    	lea    -0xa4(%ebp),%ebx
+  f.buf = buf;
+     ace:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+  mutex_init(&f.lock);
+     ad4:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  f.flags = IO_WRITE|IO_SETUP;
+     ada:	c7 85 60 ff ff ff 42 	movl   $0x42,-0xa0(%ebp)
+     ae1:	00 00 00 
+  f.size = sizeof(buf);
+     ae4:	c7 85 68 ff ff ff 80 	movl   $0x80,-0x98(%ebp)
+     aeb:	00 00 00 
+  f.r = f.n = 0;
+     aee:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+     af5:	00 00 00 
+     af8:	c7 85 6c ff ff ff 00 	movl   $0x0,-0x94(%ebp)
+     aff:	00 00 00 
+  mutex_init(&f.lock);
+     b02:	50                   	push   %eax
+     b03:	e8 d8 f9 ff ff       	call   4e0 <mutex_init>
+  vfprintf(&f, fmt, (uint*)(void*)&fmt + 1);
+     b08:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     b0b:	89 f2                	mov    %esi,%edx
+     b0d:	89 d8                	mov    %ebx,%eax
+     b0f:	e8 dc fd ff ff       	call   8f0 <vfprintf>
+  fflush(&f);
+     b14:	89 1c 24             	mov    %ebx,(%esp)
+     b17:	e8 f4 04 00 00       	call   1010 <fflush>
+     b1c:	83 c4 10             	add    $0x10,%esp
+}
+     b1f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b22:	5b                   	pop    %ebx
+     b23:	5e                   	pop    %esi
+     b24:	5d                   	pop    %ebp
+     b25:	c3                   	ret
+     b26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b2d:	8d 76 00             	lea    0x0(%esi),%esi
+    flockfile(&_iob[fd]);
+     b30:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     b33:	83 ec 0c             	sub    $0xc,%esp
+     b36:	8d 98 20 2a 00 00    	lea    0x2a20(%eax),%ebx
+     b3c:	53                   	push   %ebx
+     b3d:	e8 0e 02 00 00       	call   d50 <flockfile>
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     b42:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     b45:	89 f2                	mov    %esi,%edx
+     b47:	89 d8                	mov    %ebx,%eax
+     b49:	e8 a2 fd ff ff       	call   8f0 <vfprintf>
+    funlockfile(&_iob[fd]);
+     b4e:	89 1c 24             	mov    %ebx,(%esp)
+     b51:	e8 2a 02 00 00       	call   d80 <funlockfile>
+     b56:	83 c4 10             	add    $0x10,%esp
+}
+     b59:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b5c:	5b                   	pop    %ebx
+     b5d:	5e                   	pop    %esi
+     b5e:	5d                   	pop    %ebp
+     b5f:	c3                   	ret
+
+00000b60 <setup>:
+}
+
+// Choose how to buffer f on first use: by lines on a device.
+static void
+setup(FILE *f)
+{
+     b60:	55                   	push   %ebp
+     b61:	89 e5                	mov    %esp,%ebp
+     b63:	53                   	push   %ebx
+     b64:	89 c3                	mov    %eax,%ebx
+     b66:	83 ec 2c             	sub    $0x2c,%esp
+  struct stat st;
+
+  f->flags |= IO_SETUP;
+     b69:	83 48 04 40          	orl    $0x40,0x4(%eax)
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     b6d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     b70:	50                   	push   %eax
+     b71:	ff 33                	push   (%ebx)
+     b73:	e8 52 fb ff ff       	call   6ca <fstat>
+     b78:	83 c4 10             	add    $0x10,%esp
+     b7b:	85 c0                	test   %eax,%eax
+    f->flags |= IO_DEV|IO_LINE;
+     b7d:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     b80:	75 07                	jne    b89 <setup+0x29>
+     b82:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+     b87:	74 17                	je     ba0 <setup+0x40>
+  if(f->flags & IO_WRITE)
+     b89:	a8 02                	test   $0x2,%al
+     b8b:	74 0a                	je     b97 <setup+0x37>
+    flushhook = flushall;
+     b8d:	c7 05 10 2b 00 00 c0 	movl   $0xcc0,0x2b10
+     b94:	0c 00 00 
+}
+     b97:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b9a:	c9                   	leave
+     b9b:	c3                   	ret
+     b9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    f->flags |= IO_DEV|IO_LINE;
+     ba0:	83 c8 30             	or     $0x30,%eax
+     ba3:	89 43 04             	mov    %eax,0x4(%ebx)
+     ba6:	eb e1                	jmp    b89 <setup+0x29>
+     ba8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     baf:	90                   	nop
+
+00000bb0 <flush>:
+static int
+flush(FILE *f)
+{
+  int i, n;
+
+  if(!(f->flags & IO_WRITE))
+     bb0:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+     bb4:	74 6a                	je     c20 <flush+0x70>
+{
+     bb6:	55                   	push   %ebp
+     bb7:	89 e5                	mov    %esp,%ebp
+     bb9:	56                   	push   %esi
+     bba:	89 c6                	mov    %eax,%esi
+     bbc:	53                   	push   %ebx
+    return 0;
+  for(i = 0; i < f->n; i += n){
+     bbd:	8b 40 14             	mov    0x14(%eax),%eax
+     bc0:	85 c0                	test   %eax,%eax
+     bc2:	7e 4c                	jle    c10 <flush+0x60>
+     bc4:	31 db                	xor    %ebx,%ebx
+     bc6:	eb 11                	jmp    bd9 <flush+0x29>
+     bc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bcf:	90                   	nop
+     bd0:	01 c3                	add    %eax,%ebx
+     bd2:	8b 46 14             	mov    0x14(%esi),%eax
+     bd5:	39 d8                	cmp    %ebx,%eax
+     bd7:	7e 37                	jle    c10 <flush+0x60>
+    if((n = write(f->fd, f->buf + i, f->n - i)) <= 0){
+     bd9:	83 ec 04             	sub    $0x4,%esp
+     bdc:	29 d8                	sub    %ebx,%eax
+     bde:	50                   	push   %eax
+     bdf:	8b 46 08             	mov    0x8(%esi),%eax
+     be2:	01 d8                	add    %ebx,%eax
+     be4:	50                   	push   %eax
+     be5:	ff 36                	push   (%esi)
+     be7:	e8 75 fa ff ff       	call   661 <write>
+     bec:	83 c4 10             	add    $0x10,%esp
+     bef:	85 c0                	test   %eax,%eax
+     bf1:	7f dd                	jg     bd0 <flush+0x20>
+      f->flags |= IO_ERR;
+     bf3:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+      f->n = 0;
+     bf7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     bfc:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+      return EOF;
+    }
+  }
+  f->n = 0;
+  return 0;
+}
+     c03:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     c06:	5b                   	pop    %ebx
+     c07:	5e                   	pop    %esi
+     c08:	5d                   	pop    %ebp
+     c09:	c3                   	ret
+     c0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->n = 0;
+     c10:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+}
+     c17:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+     c1a:	31 c0                	xor    %eax,%eax
+}
+     c1c:	5b                   	pop    %ebx
+     c1d:	5e                   	pop    %esi
+     c1e:	5d                   	pop    %ebp
+     c1f:	c3                   	ret
+    return 0;
+     c20:	31 c0                	xor    %eax,%eax
+}
+     c22:	c3                   	ret
+     c23:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000c30 <fflush.part.0>:
+fflush(FILE *f)
+     c30:	55                   	push   %ebp
+     c31:	89 e5                	mov    %esp,%ebp
+     c33:	57                   	push   %edi
+     c34:	bf 18 2b 00 00       	mov    $0x2b18,%edi
+     c39:	56                   	push   %esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     c3a:	31 f6                	xor    %esi,%esi
+fflush(FILE *f)
+     c3c:	53                   	push   %ebx
+     c3d:	bb 38 2a 00 00       	mov    $0x2a38,%ebx
+     c42:	83 ec 1c             	sub    $0x1c,%esp
+     c45:	eb 10                	jmp    c57 <fflush.part.0+0x27>
+     c47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c4e:	66 90                	xchg   %ax,%ax
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     c50:	83 c3 1c             	add    $0x1c,%ebx
+     c53:	39 df                	cmp    %ebx,%edi
+     c55:	74 33                	je     c8a <fflush.part.0+0x5a>
+      if((f->flags & IO_WRITE) && fflush(f) < 0)
+     c57:	f6 43 ec 02          	testb  $0x2,-0x14(%ebx)
+     c5b:	74 f3                	je     c50 <fflush.part.0+0x20>
+  if(threaded)
+     c5d:	8b 0d 20 2b 00 00    	mov    0x2b20,%ecx
+     c63:	85 c9                	test   %ecx,%ecx
+     c65:	75 49                	jne    cb0 <fflush.part.0+0x80>
+  r = flush(f);
+     c67:	8d 43 e8             	lea    -0x18(%ebx),%eax
+     c6a:	e8 41 ff ff ff       	call   bb0 <flush>
+  if(threaded)
+     c6f:	8b 15 20 2b 00 00    	mov    0x2b20,%edx
+     c75:	85 d2                	test   %edx,%edx
+     c77:	75 1f                	jne    c98 <fflush.part.0+0x68>
+        r = EOF;
+     c79:	85 c0                	test   %eax,%eax
+     c7b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     c80:	0f 48 f0             	cmovs  %eax,%esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     c83:	83 c3 1c             	add    $0x1c,%ebx
+     c86:	39 df                	cmp    %ebx,%edi
+     c88:	75 cd                	jne    c57 <fflush.part.0+0x27>
+}
+     c8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c8d:	89 f0                	mov    %esi,%eax
+     c8f:	5b                   	pop    %ebx
+     c90:	5e                   	pop    %esi
+     c91:	5f                   	pop    %edi
+     c92:	5d                   	pop    %ebp
+     c93:	c3                   	ret
+     c94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     c98:	83 ec 0c             	sub    $0xc,%esp
+     c9b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     c9e:	53                   	push   %ebx
+     c9f:	e8 9c f8 ff ff       	call   540 <mutex_unlock>
+     ca4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     ca7:	83 c4 10             	add    $0x10,%esp
+     caa:	eb cd                	jmp    c79 <fflush.part.0+0x49>
+     cac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     cb0:	83 ec 0c             	sub    $0xc,%esp
+     cb3:	53                   	push   %ebx
+     cb4:	e8 37 f8 ff ff       	call   4f0 <mutex_lock>
+     cb9:	83 c4 10             	add    $0x10,%esp
+     cbc:	eb a9                	jmp    c67 <fflush.part.0+0x37>
+     cbe:	66 90                	xchg   %ax,%ax
+
+00000cc0 <flushall>:
+  if(f == 0){
+     cc0:	e9 6b ff ff ff       	jmp    c30 <fflush.part.0>
+     cc5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ccc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000cd0 <fill>:
+
+// Refill f's buffer. Returns the number of bytes read.
+// Caller holds f's lock.
+static int
+fill(FILE *f)
+{
+     cd0:	55                   	push   %ebp
+     cd1:	89 e5                	mov    %esp,%ebp
+     cd3:	53                   	push   %ebx
+     cd4:	89 c3                	mov    %eax,%ebx
+     cd6:	83 ec 04             	sub    $0x4,%esp
+  int n;
+
+  if(!(f->flags & IO_SETUP))
+     cd9:	8b 40 04             	mov    0x4(%eax),%eax
+     cdc:	a8 40                	test   $0x40,%al
+     cde:	74 50                	je     d30 <fill+0x60>
+    setup(f);
+  if(f->flags & IO_DEV)
+     ce0:	a8 20                	test   $0x20,%al
+     ce2:	75 3c                	jne    d20 <fill+0x50>
+    fflush(0);
+  f->r = 0;
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     ce4:	83 ec 04             	sub    $0x4,%esp
+  f->r = 0;
+     ce7:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     cee:	ff 73 0c             	push   0xc(%ebx)
+     cf1:	ff 73 08             	push   0x8(%ebx)
+     cf4:	ff 33                	push   (%ebx)
+     cf6:	e8 57 f9 ff ff       	call   652 <read>
+     cfb:	83 c4 10             	add    $0x10,%esp
+     cfe:	85 c0                	test   %eax,%eax
+     d00:	7f 10                	jg     d12 <fill+0x42>
+    f->flags |= n < 0 ? IO_ERR : IO_EOF;
+     d02:	83 f8 01             	cmp    $0x1,%eax
+     d05:	19 c0                	sbb    %eax,%eax
+     d07:	83 e0 fc             	and    $0xfffffffc,%eax
+     d0a:	83 c0 08             	add    $0x8,%eax
+     d0d:	09 43 04             	or     %eax,0x4(%ebx)
+    n = 0;
+     d10:	31 c0                	xor    %eax,%eax
+  }
+  f->n = n;
+     d12:	89 43 14             	mov    %eax,0x14(%ebx)
+  return n;
+}
+     d15:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d18:	c9                   	leave
+     d19:	c3                   	ret
+     d1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == 0){
+     d20:	e8 0b ff ff ff       	call   c30 <fflush.part.0>
+     d25:	eb bd                	jmp    ce4 <fill+0x14>
+     d27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d2e:	66 90                	xchg   %ax,%ax
+    setup(f);
+     d30:	89 d8                	mov    %ebx,%eax
+     d32:	e8 29 fe ff ff       	call   b60 <setup>
+  if(f->flags & IO_DEV)
+     d37:	8b 43 04             	mov    0x4(%ebx),%eax
+     d3a:	eb a4                	jmp    ce0 <fill+0x10>
+     d3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000d40 <stdio_threaded>:
+  threaded = 1;
+     d40:	c7 05 20 2b 00 00 01 	movl   $0x1,0x2b20
+     d47:	00 00 00 
+}
+     d4a:	c3                   	ret
+     d4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d4f:	90                   	nop
+
+00000d50 <flockfile>:
+{
+     d50:	55                   	push   %ebp
+  if(threaded)
+     d51:	8b 15 20 2b 00 00    	mov    0x2b20,%edx
+{
+     d57:	89 e5                	mov    %esp,%ebp
+     d59:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     d5c:	85 d2                	test   %edx,%edx
+     d5e:	75 08                	jne    d68 <flockfile+0x18>
+}
+     d60:	5d                   	pop    %ebp
+     d61:	c3                   	ret
+     d62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_lock(&f->lock);
+     d68:	83 c0 18             	add    $0x18,%eax
+     d6b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     d6e:	5d                   	pop    %ebp
+    mutex_lock(&f->lock);
+     d6f:	e9 7c f7 ff ff       	jmp    4f0 <mutex_lock>
+     d74:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d7f:	90                   	nop
+
+00000d80 <funlockfile>:
+{
+     d80:	55                   	push   %ebp
+  if(threaded)
+     d81:	8b 15 20 2b 00 00    	mov    0x2b20,%edx
+{
+     d87:	89 e5                	mov    %esp,%ebp
+     d89:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     d8c:	85 d2                	test   %edx,%edx
+     d8e:	75 08                	jne    d98 <funlockfile+0x18>
+}
+     d90:	5d                   	pop    %ebp
+     d91:	c3                   	ret
+     d92:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&f->lock);
+     d98:	83 c0 18             	add    $0x18,%eax
+     d9b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     d9e:	5d                   	pop    %ebp
+    mutex_unlock(&f->lock);
+     d9f:	e9 9c f7 ff ff       	jmp    540 <mutex_unlock>
+     da4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     daf:	90                   	nop
+
+00000db0 <fopen>:
+{
+     db0:	55                   	push   %ebp
+     db1:	89 e5                	mov    %esp,%ebp
+     db3:	57                   	push   %edi
+     db4:	56                   	push   %esi
+     db5:	53                   	push   %ebx
+     db6:	83 ec 34             	sub    $0x34,%esp
+     db9:	8b 75 0c             	mov    0xc(%ebp),%esi
+     dbc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(strcmp(mode, "r") != 0 && strcmp(mode, "w") != 0)
+     dbf:	68 01 20 00 00       	push   $0x2001
+     dc4:	56                   	push   %esi
+     dc5:	e8 66 f5 ff ff       	call   330 <strcmp>
+     dca:	83 c4 10             	add    $0x10,%esp
+     dcd:	85 c0                	test   %eax,%eax
+     dcf:	74 15                	je     de6 <fopen+0x36>
+     dd1:	83 ec 08             	sub    $0x8,%esp
+     dd4:	68 03 20 00 00       	push   $0x2003
+     dd9:	56                   	push   %esi
+     dda:	e8 51 f5 ff ff       	call   330 <strcmp>
+     ddf:	83 c4 10             	add    $0x10,%esp
+     de2:	85 c0                	test   %eax,%eax
+     de4:	75 2c                	jne    e12 <fopen+0x62>
+  if(threaded)
+     de6:	a1 20 2b 00 00       	mov    0x2b20,%eax
+     deb:	85 c0                	test   %eax,%eax
+     ded:	0f 85 ed 00 00 00    	jne    ee0 <fopen+0x130>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     df3:	bb 74 2a 00 00       	mov    $0x2a74,%ebx
+    if(f->flags == 0)
+     df8:	8b 53 04             	mov    0x4(%ebx),%edx
+     dfb:	85 d2                	test   %edx,%edx
+     dfd:	74 21                	je     e20 <fopen+0x70>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     dff:	83 c3 1c             	add    $0x1c,%ebx
+     e02:	81 fb 00 2b 00 00    	cmp    $0x2b00,%ebx
+     e08:	75 ee                	jne    df8 <fopen+0x48>
+  if(threaded)
+     e0a:	85 c0                	test   %eax,%eax
+     e0c:	0f 85 36 01 00 00    	jne    f48 <fopen+0x198>
+    return 0;
+     e12:	31 db                	xor    %ebx,%ebx
+     e14:	e9 96 00 00 00       	jmp    eaf <fopen+0xff>
+     e19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f == &_iob[NSTREAM])
+     e20:	81 fb 00 2b 00 00    	cmp    $0x2b00,%ebx
+     e26:	74 e2                	je     e0a <fopen+0x5a>
+    f->flags = IO_MALLOC;
+     e28:	c7 43 04 80 00 00 00 	movl   $0x80,0x4(%ebx)
+  if(threaded)
+     e2f:	85 c0                	test   %eax,%eax
+     e31:	0f 85 f9 00 00 00    	jne    f30 <fopen+0x180>
+  if(mode[0] == 'r'){
+     e37:	80 3e 72             	cmpb   $0x72,(%esi)
+     e3a:	0f 84 c0 00 00 00    	je     f00 <fopen+0x150>
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     e40:	83 ec 08             	sub    $0x8,%esp
+     e43:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     e46:	50                   	push   %eax
+     e47:	57                   	push   %edi
+     e48:	e8 d3 f5 ff ff       	call   420 <stat>
+     e4d:	83 c4 10             	add    $0x10,%esp
+     e50:	85 c0                	test   %eax,%eax
+     e52:	74 6c                	je     ec0 <fopen+0x110>
+    fd = open(path, O_CREATE|O_WRONLY);
+     e54:	83 ec 08             	sub    $0x8,%esp
+     e57:	68 01 02 00 00       	push   $0x201
+     e5c:	57                   	push   %edi
+    flags = IO_WRITE;
+     e5d:	bf 02 00 00 00       	mov    $0x2,%edi
+    fd = open(path, O_CREATE|O_WRONLY);
+     e62:	e8 36 f8 ff ff       	call   69d <open>
+     e67:	83 c4 10             	add    $0x10,%esp
+     e6a:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     e6c:	85 f6                	test   %esi,%esi
+     e6e:	0f 88 a9 00 00 00    	js     f1d <fopen+0x16d>
+     e74:	83 ec 0c             	sub    $0xc,%esp
+     e77:	68 00 02 00 00       	push   $0x200
+     e7c:	e8 af 0c 00 00       	call   1b30 <malloc>
+     e81:	83 c4 10             	add    $0x10,%esp
+     e84:	89 43 08             	mov    %eax,0x8(%ebx)
+     e87:	85 c0                	test   %eax,%eax
+     e89:	0f 84 d0 00 00 00    	je     f5f <fopen+0x1af>
+  f->flags = flags|IO_MALLOC;
+     e8f:	81 cf 80 00 00 00    	or     $0x80,%edi
+  f->fd = fd;
+     e95:	89 33                	mov    %esi,(%ebx)
+  f->size = BUFSIZ;
+     e97:	c7 43 0c 00 02 00 00 	movl   $0x200,0xc(%ebx)
+  f->r = f->n = 0;
+     e9e:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+     ea5:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  f->flags = flags|IO_MALLOC;
+     eac:	89 7b 04             	mov    %edi,0x4(%ebx)
+}
+     eaf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     eb2:	89 d8                	mov    %ebx,%eax
+     eb4:	5b                   	pop    %ebx
+     eb5:	5e                   	pop    %esi
+     eb6:	5f                   	pop    %edi
+     eb7:	5d                   	pop    %ebp
+     eb8:	c3                   	ret
+     eb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     ec0:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+     ec5:	75 8d                	jne    e54 <fopen+0xa4>
+      unlink(path);
+     ec7:	83 ec 0c             	sub    $0xc,%esp
+     eca:	57                   	push   %edi
+     ecb:	e8 eb f7 ff ff       	call   6bb <unlink>
+     ed0:	83 c4 10             	add    $0x10,%esp
+     ed3:	e9 7c ff ff ff       	jmp    e54 <fopen+0xa4>
+     ed8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     edf:	90                   	nop
+    mutex_lock(&iolock);
+     ee0:	83 ec 0c             	sub    $0xc,%esp
+     ee3:	68 24 2b 00 00       	push   $0x2b24
+     ee8:	e8 03 f6 ff ff       	call   4f0 <mutex_lock>
+  if(threaded)
+     eed:	a1 20 2b 00 00       	mov    0x2b20,%eax
+     ef2:	83 c4 10             	add    $0x10,%esp
+     ef5:	e9 f9 fe ff ff       	jmp    df3 <fopen+0x43>
+     efa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    fd = open(path, O_RDONLY);
+     f00:	83 ec 08             	sub    $0x8,%esp
+     f03:	6a 00                	push   $0x0
+     f05:	57                   	push   %edi
+    flags = IO_READ;
+     f06:	bf 01 00 00 00       	mov    $0x1,%edi
+    fd = open(path, O_RDONLY);
+     f0b:	e8 8d f7 ff ff       	call   69d <open>
+     f10:	83 c4 10             	add    $0x10,%esp
+     f13:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     f15:	85 f6                	test   %esi,%esi
+     f17:	0f 89 57 ff ff ff    	jns    e74 <fopen+0xc4>
+    f->flags = 0;
+     f1d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    return 0;
+     f24:	31 db                	xor    %ebx,%ebx
+     f26:	eb 87                	jmp    eaf <fopen+0xff>
+     f28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f2f:	90                   	nop
+    mutex_unlock(&iolock);
+     f30:	83 ec 0c             	sub    $0xc,%esp
+     f33:	68 24 2b 00 00       	push   $0x2b24
+     f38:	e8 03 f6 ff ff       	call   540 <mutex_unlock>
+     f3d:	83 c4 10             	add    $0x10,%esp
+     f40:	e9 f2 fe ff ff       	jmp    e37 <fopen+0x87>
+     f45:	8d 76 00             	lea    0x0(%esi),%esi
+     f48:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+     f4b:	31 db                	xor    %ebx,%ebx
+    mutex_unlock(&iolock);
+     f4d:	68 24 2b 00 00       	push   $0x2b24
+     f52:	e8 e9 f5 ff ff       	call   540 <mutex_unlock>
+     f57:	83 c4 10             	add    $0x10,%esp
+     f5a:	e9 50 ff ff ff       	jmp    eaf <fopen+0xff>
+      close(fd);
+     f5f:	83 ec 0c             	sub    $0xc,%esp
+     f62:	56                   	push   %esi
+     f63:	e8 08 f7 ff ff       	call   670 <close>
+     f68:	83 c4 10             	add    $0x10,%esp
+     f6b:	eb b0                	jmp    f1d <fopen+0x16d>
+     f6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f70 <fclose>:
+{
+     f70:	55                   	push   %ebp
+     f71:	89 e5                	mov    %esp,%ebp
+     f73:	56                   	push   %esi
+     f74:	53                   	push   %ebx
+  if(threaded)
+     f75:	8b 15 20 2b 00 00    	mov    0x2b20,%edx
+{
+     f7b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+     f7e:	85 d2                	test   %edx,%edx
+     f80:	75 46                	jne    fc8 <fclose+0x58>
+  r = flush(f);
+     f82:	89 d8                	mov    %ebx,%eax
+     f84:	e8 27 fc ff ff       	call   bb0 <flush>
+  if(close(f->fd) < 0)
+     f89:	83 ec 0c             	sub    $0xc,%esp
+     f8c:	ff 33                	push   (%ebx)
+  r = flush(f);
+     f8e:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+     f90:	e8 db f6 ff ff       	call   670 <close>
+     f95:	83 c4 10             	add    $0x10,%esp
+    r = EOF;
+     f98:	85 c0                	test   %eax,%eax
+     f9a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     f9f:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->flags & IO_MALLOC)
+     fa2:	f6 43 04 80          	testb  $0x80,0x4(%ebx)
+     fa6:	75 58                	jne    1000 <fclose+0x90>
+  if(threaded)
+     fa8:	a1 20 2b 00 00       	mov    0x2b20,%eax
+  f->flags = 0;
+     fad:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  if(threaded)
+     fb4:	85 c0                	test   %eax,%eax
+     fb6:	75 28                	jne    fe0 <fclose+0x70>
+}
+     fb8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     fbb:	89 f0                	mov    %esi,%eax
+     fbd:	5b                   	pop    %ebx
+     fbe:	5e                   	pop    %esi
+     fbf:	5d                   	pop    %ebp
+     fc0:	c3                   	ret
+     fc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     fc8:	83 ec 0c             	sub    $0xc,%esp
+     fcb:	8d 43 18             	lea    0x18(%ebx),%eax
+     fce:	50                   	push   %eax
+     fcf:	e8 1c f5 ff ff       	call   4f0 <mutex_lock>
+     fd4:	83 c4 10             	add    $0x10,%esp
+     fd7:	eb a9                	jmp    f82 <fclose+0x12>
+     fd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     fe0:	83 ec 0c             	sub    $0xc,%esp
+     fe3:	83 c3 18             	add    $0x18,%ebx
+     fe6:	53                   	push   %ebx
+     fe7:	e8 54 f5 ff ff       	call   540 <mutex_unlock>
+     fec:	83 c4 10             	add    $0x10,%esp
+}
+     fef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ff2:	89 f0                	mov    %esi,%eax
+     ff4:	5b                   	pop    %ebx
+     ff5:	5e                   	pop    %esi
+     ff6:	5d                   	pop    %ebp
+     ff7:	c3                   	ret
+     ff8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fff:	90                   	nop
+    free(f->buf);
+    1000:	83 ec 0c             	sub    $0xc,%esp
+    1003:	ff 73 08             	push   0x8(%ebx)
+    1006:	e8 f5 09 00 00       	call   1a00 <free>
+    100b:	83 c4 10             	add    $0x10,%esp
+    100e:	eb 98                	jmp    fa8 <fclose+0x38>
+
+00001010 <fflush>:
+{
+    1010:	55                   	push   %ebp
+    1011:	89 e5                	mov    %esp,%ebp
+    1013:	53                   	push   %ebx
+    1014:	83 ec 14             	sub    $0x14,%esp
+    1017:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f == 0){
+    101a:	85 db                	test   %ebx,%ebx
+    101c:	74 5a                	je     1078 <fflush+0x68>
+  if(threaded)
+    101e:	8b 0d 20 2b 00 00    	mov    0x2b20,%ecx
+    1024:	85 c9                	test   %ecx,%ecx
+    1026:	75 18                	jne    1040 <fflush+0x30>
+  r = flush(f);
+    1028:	89 d8                	mov    %ebx,%eax
+    102a:	e8 81 fb ff ff       	call   bb0 <flush>
+  if(threaded)
+    102f:	8b 15 20 2b 00 00    	mov    0x2b20,%edx
+    1035:	85 d2                	test   %edx,%edx
+    1037:	75 1f                	jne    1058 <fflush+0x48>
+}
+    1039:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    103c:	c9                   	leave
+    103d:	c3                   	ret
+    103e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    1040:	83 ec 0c             	sub    $0xc,%esp
+    1043:	8d 43 18             	lea    0x18(%ebx),%eax
+    1046:	50                   	push   %eax
+    1047:	e8 a4 f4 ff ff       	call   4f0 <mutex_lock>
+    104c:	83 c4 10             	add    $0x10,%esp
+    104f:	eb d7                	jmp    1028 <fflush+0x18>
+    1051:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1058:	83 ec 0c             	sub    $0xc,%esp
+    105b:	83 c3 18             	add    $0x18,%ebx
+    105e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1061:	53                   	push   %ebx
+    1062:	e8 d9 f4 ff ff       	call   540 <mutex_unlock>
+    1067:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    106a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    mutex_unlock(&f->lock);
+    106d:	83 c4 10             	add    $0x10,%esp
+}
+    1070:	c9                   	leave
+    1071:	c3                   	ret
+    1072:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1078:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    107b:	c9                   	leave
+    107c:	e9 af fb ff ff       	jmp    c30 <fflush.part.0>
+    1081:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1088:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    108f:	90                   	nop
+
+00001090 <putc_unlocked>:
+{
+    1090:	55                   	push   %ebp
+    1091:	89 e5                	mov    %esp,%ebp
+    1093:	56                   	push   %esi
+    1094:	53                   	push   %ebx
+    1095:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    1098:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(!(f->flags & IO_WRITE))
+    109b:	8b 43 04             	mov    0x4(%ebx),%eax
+    109e:	a8 02                	test   $0x2,%al
+    10a0:	74 46                	je     10e8 <putc_unlocked+0x58>
+  if(!(f->flags & IO_SETUP))
+    10a2:	a8 40                	test   $0x40,%al
+    10a4:	74 4a                	je     10f0 <putc_unlocked+0x60>
+  if(f->n == f->size && flush(f) < 0)
+    10a6:	8b 43 14             	mov    0x14(%ebx),%eax
+    10a9:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    10ac:	74 51                	je     10ff <putc_unlocked+0x6f>
+  f->buf[f->n++] = c;
+    10ae:	8d 48 01             	lea    0x1(%eax),%ecx
+    10b1:	8b 53 08             	mov    0x8(%ebx),%edx
+    10b4:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    10b7:	89 f1                	mov    %esi,%ecx
+    10b9:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    10bc:	83 fe 0a             	cmp    $0xa,%esi
+    10bf:	74 0f                	je     10d0 <putc_unlocked+0x40>
+  return c & 0xff;
+    10c1:	89 f0                	mov    %esi,%eax
+    10c3:	0f b6 c0             	movzbl %al,%eax
+}
+    10c6:	5b                   	pop    %ebx
+    10c7:	5e                   	pop    %esi
+    10c8:	5d                   	pop    %ebp
+    10c9:	c3                   	ret
+    10ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    10d0:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    10d4:	74 eb                	je     10c1 <putc_unlocked+0x31>
+    10d6:	89 d8                	mov    %ebx,%eax
+    10d8:	e8 d3 fa ff ff       	call   bb0 <flush>
+    10dd:	85 c0                	test   %eax,%eax
+    10df:	79 e0                	jns    10c1 <putc_unlocked+0x31>
+    10e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return EOF;
+    10e8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    10ed:	eb d7                	jmp    10c6 <putc_unlocked+0x36>
+    10ef:	90                   	nop
+    setup(f);
+    10f0:	89 d8                	mov    %ebx,%eax
+    10f2:	e8 69 fa ff ff       	call   b60 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    10f7:	8b 43 14             	mov    0x14(%ebx),%eax
+    10fa:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    10fd:	75 af                	jne    10ae <putc_unlocked+0x1e>
+    10ff:	89 d8                	mov    %ebx,%eax
+    1101:	e8 aa fa ff ff       	call   bb0 <flush>
+    1106:	85 c0                	test   %eax,%eax
+    1108:	78 de                	js     10e8 <putc_unlocked+0x58>
+  f->buf[f->n++] = c;
+    110a:	8b 43 14             	mov    0x14(%ebx),%eax
+    110d:	eb 9f                	jmp    10ae <putc_unlocked+0x1e>
+    110f:	90                   	nop
+
+00001110 <fputc>:
+{
+    1110:	55                   	push   %ebp
+    1111:	89 e5                	mov    %esp,%ebp
+    1113:	56                   	push   %esi
+    1114:	53                   	push   %ebx
+  if(threaded)
+    1115:	8b 15 20 2b 00 00    	mov    0x2b20,%edx
+{
+    111b:	8b 75 08             	mov    0x8(%ebp),%esi
+    111e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(threaded)
+    1121:	85 d2                	test   %edx,%edx
+    1123:	75 6b                	jne    1190 <fputc+0x80>
+  if(!(f->flags & IO_WRITE))
+    1125:	8b 43 04             	mov    0x4(%ebx),%eax
+    1128:	a8 02                	test   $0x2,%al
+    112a:	0f 84 b8 00 00 00    	je     11e8 <fputc+0xd8>
+  if(!(f->flags & IO_SETUP))
+    1130:	a8 40                	test   $0x40,%al
+    1132:	74 76                	je     11aa <fputc+0x9a>
+  if(f->n == f->size && flush(f) < 0)
+    1134:	8b 43 14             	mov    0x14(%ebx),%eax
+    1137:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    113a:	74 7d                	je     11b9 <fputc+0xa9>
+  f->buf[f->n++] = c;
+    113c:	8d 48 01             	lea    0x1(%eax),%ecx
+    113f:	8b 53 08             	mov    0x8(%ebx),%edx
+    1142:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    1145:	89 f1                	mov    %esi,%ecx
+    1147:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    114a:	83 fe 0a             	cmp    $0xa,%esi
+    114d:	74 21                	je     1170 <fputc+0x60>
+  return c & 0xff;
+    114f:	89 f0                	mov    %esi,%eax
+    1151:	0f b6 f0             	movzbl %al,%esi
+  if(threaded)
+    1154:	a1 20 2b 00 00       	mov    0x2b20,%eax
+    1159:	85 c0                	test   %eax,%eax
+    115b:	75 73                	jne    11d0 <fputc+0xc0>
+}
+    115d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1160:	89 f0                	mov    %esi,%eax
+    1162:	5b                   	pop    %ebx
+    1163:	5e                   	pop    %esi
+    1164:	5d                   	pop    %ebp
+    1165:	c3                   	ret
+    1166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    116d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    1170:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1174:	74 d9                	je     114f <fputc+0x3f>
+    1176:	89 d8                	mov    %ebx,%eax
+    1178:	e8 33 fa ff ff       	call   bb0 <flush>
+    117d:	85 c0                	test   %eax,%eax
+    117f:	79 ce                	jns    114f <fputc+0x3f>
+    return EOF;
+    1181:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1186:	eb cc                	jmp    1154 <fputc+0x44>
+    1188:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    118f:	90                   	nop
+    mutex_lock(&f->lock);
+    1190:	83 ec 0c             	sub    $0xc,%esp
+    1193:	8d 43 18             	lea    0x18(%ebx),%eax
+    1196:	50                   	push   %eax
+    1197:	e8 54 f3 ff ff       	call   4f0 <mutex_lock>
+  if(!(f->flags & IO_WRITE))
+    119c:	8b 43 04             	mov    0x4(%ebx),%eax
+    119f:	83 c4 10             	add    $0x10,%esp
+    11a2:	a8 02                	test   $0x2,%al
+    11a4:	74 db                	je     1181 <fputc+0x71>
+  if(!(f->flags & IO_SETUP))
+    11a6:	a8 40                	test   $0x40,%al
+    11a8:	75 8a                	jne    1134 <fputc+0x24>
+    setup(f);
+    11aa:	89 d8                	mov    %ebx,%eax
+    11ac:	e8 af f9 ff ff       	call   b60 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    11b1:	8b 43 14             	mov    0x14(%ebx),%eax
+    11b4:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    11b7:	75 83                	jne    113c <fputc+0x2c>
+    11b9:	89 d8                	mov    %ebx,%eax
+    11bb:	e8 f0 f9 ff ff       	call   bb0 <flush>
+    11c0:	85 c0                	test   %eax,%eax
+    11c2:	78 bd                	js     1181 <fputc+0x71>
+  f->buf[f->n++] = c;
+    11c4:	8b 43 14             	mov    0x14(%ebx),%eax
+    11c7:	e9 70 ff ff ff       	jmp    113c <fputc+0x2c>
+    11cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    11d0:	83 ec 0c             	sub    $0xc,%esp
+    11d3:	83 c3 18             	add    $0x18,%ebx
+    11d6:	53                   	push   %ebx
+    11d7:	e8 64 f3 ff ff       	call   540 <mutex_unlock>
+    11dc:	83 c4 10             	add    $0x10,%esp
+}
+    11df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    11e2:	89 f0                	mov    %esi,%eax
+    11e4:	5b                   	pop    %ebx
+    11e5:	5e                   	pop    %esi
+    11e6:	5d                   	pop    %ebp
+    11e7:	c3                   	ret
+    return EOF;
+    11e8:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    11ed:	e9 6b ff ff ff       	jmp    115d <fputc+0x4d>
+    11f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001200 <fwrite>:
+{
+    1200:	55                   	push   %ebp
+    1201:	89 e5                	mov    %esp,%ebp
+    1203:	57                   	push   %edi
+    1204:	56                   	push   %esi
+    1205:	53                   	push   %ebx
+    1206:	83 ec 1c             	sub    $0x1c,%esp
+    1209:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  if(!(f->flags & IO_WRITE) || size <= 0)
+    120c:	8b 43 04             	mov    0x4(%ebx),%eax
+    120f:	a8 02                	test   $0x2,%al
+    1211:	0f 84 ec 00 00 00    	je     1303 <fwrite+0x103>
+    1217:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    121a:	85 c9                	test   %ecx,%ecx
+    121c:	0f 8e e1 00 00 00    	jle    1303 <fwrite+0x103>
+  if(threaded)
+    1222:	8b 15 20 2b 00 00    	mov    0x2b20,%edx
+    1228:	85 d2                	test   %edx,%edx
+    122a:	0f 85 1c 01 00 00    	jne    134c <fwrite+0x14c>
+  if(!(f->flags & IO_SETUP))
+    1230:	a8 40                	test   $0x40,%al
+    1232:	0f 84 08 01 00 00    	je     1340 <fwrite+0x140>
+  for(len = size*nmemb; len > 0; len -= n){
+    1238:	8b 45 0c             	mov    0xc(%ebp),%eax
+    123b:	0f af 45 10          	imul   0x10(%ebp),%eax
+    123f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    1242:	85 c0                	test   %eax,%eax
+    1244:	0f 8e 2a 01 00 00    	jle    1374 <fwrite+0x174>
+  s = p;
+    124a:	8b 45 08             	mov    0x8(%ebp),%eax
+  nl = 0;
+    124d:	31 ff                	xor    %edi,%edi
+    124f:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+        nl = 1;
+    1252:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  s = p;
+    1255:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1258:	8b 43 14             	mov    0x14(%ebx),%eax
+        nl = 1;
+    125b:	89 ce                	mov    %ecx,%esi
+    if(f->n == f->size && flush(f) < 0)
+    125d:	89 c2                	mov    %eax,%edx
+    125f:	39 f0                	cmp    %esi,%eax
+    1261:	74 6e                	je     12d1 <fwrite+0xd1>
+    1263:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1267:	90                   	nop
+    if(n > len)
+    1268:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    n = f->size - f->n;
+    126b:	89 f1                	mov    %esi,%ecx
+    126d:	29 c1                	sub    %eax,%ecx
+    126f:	39 f9                	cmp    %edi,%ecx
+    1271:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1274:	85 c9                	test   %ecx,%ecx
+    1276:	0f 8e 7c 00 00 00    	jle    12f8 <fwrite+0xf8>
+    127c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    127f:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1282:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    1285:	8d 34 08             	lea    (%eax,%ecx,1),%esi
+    1288:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    128b:	eb 06                	jmp    1293 <fwrite+0x93>
+    128d:	8d 76 00             	lea    0x0(%esi),%esi
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1290:	8b 53 14             	mov    0x14(%ebx),%edx
+    1293:	8d 4a 01             	lea    0x1(%edx),%ecx
+    1296:	8b 73 08             	mov    0x8(%ebx),%esi
+    1299:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    129c:	0f b6 08             	movzbl (%eax),%ecx
+        nl = 1;
+    129f:	80 f9 0a             	cmp    $0xa,%cl
+      if((f->buf[f->n++] = s[i]) == '\n')
+    12a2:	88 0c 16             	mov    %cl,(%esi,%edx,1)
+        nl = 1;
+    12a5:	be 01 00 00 00       	mov    $0x1,%esi
+    12aa:	0f 44 fe             	cmove  %esi,%edi
+    for(i = 0; i < n; i++)
+    12ad:	83 c0 01             	add    $0x1,%eax
+    12b0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    12b3:	75 db                	jne    1290 <fwrite+0x90>
+    s += n;
+    12b5:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    12b8:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    12bb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    s += n;
+    12be:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    12c1:	85 c0                	test   %eax,%eax
+    12c3:	7e 48                	jle    130d <fwrite+0x10d>
+    12c5:	8b 43 14             	mov    0x14(%ebx),%eax
+    12c8:	8b 73 0c             	mov    0xc(%ebx),%esi
+    if(f->n == f->size && flush(f) < 0)
+    12cb:	89 c2                	mov    %eax,%edx
+    12cd:	39 f0                	cmp    %esi,%eax
+    12cf:	75 97                	jne    1268 <fwrite+0x68>
+    12d1:	89 d8                	mov    %ebx,%eax
+    12d3:	e8 d8 f8 ff ff       	call   bb0 <flush>
+    12d8:	85 c0                	test   %eax,%eax
+    12da:	78 31                	js     130d <fwrite+0x10d>
+    n = f->size - f->n;
+    12dc:	8b 73 0c             	mov    0xc(%ebx),%esi
+    12df:	8b 43 14             	mov    0x14(%ebx),%eax
+    12e2:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    12e5:	89 f1                	mov    %esi,%ecx
+    12e7:	89 c2                	mov    %eax,%edx
+    12e9:	29 c1                	sub    %eax,%ecx
+    12eb:	39 f9                	cmp    %edi,%ecx
+    12ed:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    12f0:	85 c9                	test   %ecx,%ecx
+    12f2:	7f 88                	jg     127c <fwrite+0x7c>
+    12f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    s += n;
+    12f8:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    12fb:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    12fe:	e9 5a ff ff ff       	jmp    125d <fwrite+0x5d>
+}
+    1303:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    1306:	31 c0                	xor    %eax,%eax
+}
+    1308:	5b                   	pop    %ebx
+    1309:	5e                   	pop    %esi
+    130a:	5f                   	pop    %edi
+    130b:	5d                   	pop    %ebp
+    130c:	c3                   	ret
+  if(nl && (f->flags & IO_LINE))
+    130d:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1310:	85 ff                	test   %edi,%edi
+    1312:	74 06                	je     131a <fwrite+0x11a>
+    1314:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1318:	75 1d                	jne    1337 <fwrite+0x137>
+  return (s - (const char*)p) / size;
+    131a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    131d:	2b 75 08             	sub    0x8(%ebp),%esi
+  if(threaded)
+    1320:	a1 20 2b 00 00       	mov    0x2b20,%eax
+    1325:	85 c0                	test   %eax,%eax
+    1327:	75 3a                	jne    1363 <fwrite+0x163>
+  return (s - (const char*)p) / size;
+    1329:	89 f0                	mov    %esi,%eax
+    132b:	99                   	cltd
+    132c:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    132f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1332:	5b                   	pop    %ebx
+    1333:	5e                   	pop    %esi
+    1334:	5f                   	pop    %edi
+    1335:	5d                   	pop    %ebp
+    1336:	c3                   	ret
+    flush(f);
+    1337:	89 d8                	mov    %ebx,%eax
+    1339:	e8 72 f8 ff ff       	call   bb0 <flush>
+    133e:	eb da                	jmp    131a <fwrite+0x11a>
+    setup(f);
+    1340:	89 d8                	mov    %ebx,%eax
+    1342:	e8 19 f8 ff ff       	call   b60 <setup>
+    1347:	e9 ec fe ff ff       	jmp    1238 <fwrite+0x38>
+    mutex_lock(&f->lock);
+    134c:	83 ec 0c             	sub    $0xc,%esp
+    134f:	8d 43 18             	lea    0x18(%ebx),%eax
+    1352:	50                   	push   %eax
+    1353:	e8 98 f1 ff ff       	call   4f0 <mutex_lock>
+  if(!(f->flags & IO_SETUP))
+    1358:	8b 43 04             	mov    0x4(%ebx),%eax
+    135b:	83 c4 10             	add    $0x10,%esp
+    135e:	e9 cd fe ff ff       	jmp    1230 <fwrite+0x30>
+    mutex_unlock(&f->lock);
+    1363:	83 ec 0c             	sub    $0xc,%esp
+    1366:	83 c3 18             	add    $0x18,%ebx
+    1369:	53                   	push   %ebx
+    136a:	e8 d1 f1 ff ff       	call   540 <mutex_unlock>
+    136f:	83 c4 10             	add    $0x10,%esp
+    1372:	eb b5                	jmp    1329 <fwrite+0x129>
+  for(len = size*nmemb; len > 0; len -= n){
+    1374:	31 f6                	xor    %esi,%esi
+    1376:	eb a8                	jmp    1320 <fwrite+0x120>
+    1378:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    137f:	90                   	nop
+
+00001380 <fgetc>:
+  return f->buf[f->r++] & 0xff;
+}
+
+int
+fgetc(FILE *f)
+{
+    1380:	55                   	push   %ebp
+    1381:	89 e5                	mov    %esp,%ebp
+    1383:	56                   	push   %esi
+    1384:	53                   	push   %ebx
+  if(threaded)
+    1385:	8b 15 20 2b 00 00    	mov    0x2b20,%edx
+{
+    138b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    138e:	85 d2                	test   %edx,%edx
+    1390:	75 2e                	jne    13c0 <fgetc+0x40>
+  if(!(f->flags & IO_READ))
+    1392:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1396:	74 78                	je     1410 <fgetc+0x90>
+  if(f->r == f->n && fill(f) == 0)
+    1398:	8b 43 10             	mov    0x10(%ebx),%eax
+    139b:	3b 43 14             	cmp    0x14(%ebx),%eax
+    139e:	74 60                	je     1400 <fgetc+0x80>
+  return f->buf[f->r++] & 0xff;
+    13a0:	8b 53 08             	mov    0x8(%ebx),%edx
+    13a3:	8d 48 01             	lea    0x1(%eax),%ecx
+    13a6:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    13a9:	0f b6 34 02          	movzbl (%edx,%eax,1),%esi
+  if(threaded)
+    13ad:	a1 20 2b 00 00       	mov    0x2b20,%eax
+    13b2:	85 c0                	test   %eax,%eax
+    13b4:	75 2a                	jne    13e0 <fgetc+0x60>
+
+  flockfile(f);
+  c = getc_unlocked(f);
+  funlockfile(f);
+  return c;
+}
+    13b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    13b9:	89 f0                	mov    %esi,%eax
+    13bb:	5b                   	pop    %ebx
+    13bc:	5e                   	pop    %esi
+    13bd:	5d                   	pop    %ebp
+    13be:	c3                   	ret
+    13bf:	90                   	nop
+    mutex_lock(&f->lock);
+    13c0:	83 ec 0c             	sub    $0xc,%esp
+    13c3:	8d 43 18             	lea    0x18(%ebx),%eax
+    13c6:	50                   	push   %eax
+    13c7:	e8 24 f1 ff ff       	call   4f0 <mutex_lock>
+  if(!(f->flags & IO_READ))
+    13cc:	83 c4 10             	add    $0x10,%esp
+    13cf:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    13d3:	75 c3                	jne    1398 <fgetc+0x18>
+    return EOF;
+    13d5:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    13da:	eb d1                	jmp    13ad <fgetc+0x2d>
+    13dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    13e0:	83 ec 0c             	sub    $0xc,%esp
+    13e3:	83 c3 18             	add    $0x18,%ebx
+    13e6:	53                   	push   %ebx
+    13e7:	e8 54 f1 ff ff       	call   540 <mutex_unlock>
+    13ec:	83 c4 10             	add    $0x10,%esp
+}
+    13ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    13f2:	89 f0                	mov    %esi,%eax
+    13f4:	5b                   	pop    %ebx
+    13f5:	5e                   	pop    %esi
+    13f6:	5d                   	pop    %ebp
+    13f7:	c3                   	ret
+    13f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13ff:	90                   	nop
+  if(f->r == f->n && fill(f) == 0)
+    1400:	89 d8                	mov    %ebx,%eax
+    1402:	e8 c9 f8 ff ff       	call   cd0 <fill>
+    1407:	85 c0                	test   %eax,%eax
+    1409:	74 ca                	je     13d5 <fgetc+0x55>
+  return f->buf[f->r++] & 0xff;
+    140b:	8b 43 10             	mov    0x10(%ebx),%eax
+    140e:	eb 90                	jmp    13a0 <fgetc+0x20>
+    return EOF;
+    1410:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    1415:	eb 9f                	jmp    13b6 <fgetc+0x36>
+    1417:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    141e:	66 90                	xchg   %ax,%ax
+
+00001420 <fread>:
+
+int
+fread(void *p, int size, int nmemb, FILE *f)
+{
+    1420:	55                   	push   %ebp
+    1421:	89 e5                	mov    %esp,%ebp
+    1423:	57                   	push   %edi
+    1424:	56                   	push   %esi
+    1425:	53                   	push   %ebx
+    1426:	83 ec 1c             	sub    $0x1c,%esp
+    1429:	8b 75 14             	mov    0x14(%ebp),%esi
+  char *d;
+  int n, len;
+
+  if(!(f->flags & IO_READ) || size <= 0)
+    142c:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+    1430:	74 7e                	je     14b0 <fread+0x90>
+    1432:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1435:	85 d2                	test   %edx,%edx
+    1437:	7e 77                	jle    14b0 <fread+0x90>
+  if(threaded)
+    1439:	a1 20 2b 00 00       	mov    0x2b20,%eax
+    return 0;
+  flockfile(f);
+  d = p;
+  for(len = size*nmemb; len > 0; len -= n){
+    143e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1441:	0f af 7d 10          	imul   0x10(%ebp),%edi
+  if(threaded)
+    1445:	85 c0                	test   %eax,%eax
+    1447:	0f 85 93 00 00 00    	jne    14e0 <fread+0xc0>
+  for(len = size*nmemb; len > 0; len -= n){
+    144d:	85 ff                	test   %edi,%edi
+    144f:	7e 61                	jle    14b2 <fread+0x92>
+    if(f->r == f->n && fill(f) == 0)
+    1451:	8b 46 10             	mov    0x10(%esi),%eax
+  d = p;
+    1454:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1457:	eb 35                	jmp    148e <fread+0x6e>
+    1459:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      break;
+    n = f->n - f->r;
+    1460:	29 c3                	sub    %eax,%ebx
+    1462:	39 fb                	cmp    %edi,%ebx
+    1464:	0f 4f df             	cmovg  %edi,%ebx
+    if(n > len)
+      n = len;
+    memmove(d, f->buf + f->r, n);
+    1467:	83 ec 04             	sub    $0x4,%esp
+    146a:	53                   	push   %ebx
+    146b:	03 46 08             	add    0x8(%esi),%eax
+  for(len = size*nmemb; len > 0; len -= n){
+    146e:	29 df                	sub    %ebx,%edi
+    memmove(d, f->buf + f->r, n);
+    1470:	50                   	push   %eax
+    1471:	51                   	push   %ecx
+    1472:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1475:	e8 36 f0 ff ff       	call   4b0 <memmove>
+    f->r += n;
+    147a:	8b 46 10             	mov    0x10(%esi),%eax
+    d += n;
+    147d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1480:	83 c4 10             	add    $0x10,%esp
+    f->r += n;
+    1483:	01 d8                	add    %ebx,%eax
+    d += n;
+    1485:	01 d9                	add    %ebx,%ecx
+    f->r += n;
+    1487:	89 46 10             	mov    %eax,0x10(%esi)
+  for(len = size*nmemb; len > 0; len -= n){
+    148a:	85 ff                	test   %edi,%edi
+    148c:	7e 32                	jle    14c0 <fread+0xa0>
+    if(f->r == f->n && fill(f) == 0)
+    148e:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1491:	39 c3                	cmp    %eax,%ebx
+    1493:	75 cb                	jne    1460 <fread+0x40>
+    1495:	89 f0                	mov    %esi,%eax
+    1497:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    149a:	e8 31 f8 ff ff       	call   cd0 <fill>
+    149f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    14a2:	85 c0                	test   %eax,%eax
+    14a4:	74 1a                	je     14c0 <fread+0xa0>
+    n = f->n - f->r;
+    14a6:	8b 5e 14             	mov    0x14(%esi),%ebx
+    14a9:	8b 46 10             	mov    0x10(%esi),%eax
+    14ac:	eb b2                	jmp    1460 <fread+0x40>
+    14ae:	66 90                	xchg   %ax,%ax
+    return 0;
+    14b0:	31 c0                	xor    %eax,%eax
+  }
+  funlockfile(f);
+  return (d - (char*)p) / size;
+}
+    14b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    14b5:	5b                   	pop    %ebx
+    14b6:	5e                   	pop    %esi
+    14b7:	5f                   	pop    %edi
+    14b8:	5d                   	pop    %ebp
+    14b9:	c3                   	ret
+    14ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (d - (char*)p) / size;
+    14c0:	2b 4d 08             	sub    0x8(%ebp),%ecx
+    14c3:	89 cb                	mov    %ecx,%ebx
+  if(threaded)
+    14c5:	a1 20 2b 00 00       	mov    0x2b20,%eax
+    14ca:	85 c0                	test   %eax,%eax
+    14cc:	75 32                	jne    1500 <fread+0xe0>
+  return (d - (char*)p) / size;
+    14ce:	89 d8                	mov    %ebx,%eax
+    14d0:	99                   	cltd
+    14d1:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    14d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    14d7:	5b                   	pop    %ebx
+    14d8:	5e                   	pop    %esi
+    14d9:	5f                   	pop    %edi
+    14da:	5d                   	pop    %ebp
+    14db:	c3                   	ret
+    14dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    14e0:	83 ec 0c             	sub    $0xc,%esp
+    14e3:	8d 46 18             	lea    0x18(%esi),%eax
+    14e6:	50                   	push   %eax
+    14e7:	e8 04 f0 ff ff       	call   4f0 <mutex_lock>
+  for(len = size*nmemb; len > 0; len -= n){
+    14ec:	83 c4 10             	add    $0x10,%esp
+    14ef:	85 ff                	test   %edi,%edi
+    14f1:	0f 8f 5a ff ff ff    	jg     1451 <fread+0x31>
+    14f7:	31 db                	xor    %ebx,%ebx
+    14f9:	eb ca                	jmp    14c5 <fread+0xa5>
+    14fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    14ff:	90                   	nop
+    mutex_unlock(&f->lock);
+    1500:	83 ec 0c             	sub    $0xc,%esp
+    1503:	83 c6 18             	add    $0x18,%esi
+    1506:	56                   	push   %esi
+    1507:	e8 34 f0 ff ff       	call   540 <mutex_unlock>
+  return (d - (char*)p) / size;
+    150c:	89 d8                	mov    %ebx,%eax
+    150e:	83 c4 10             	add    $0x10,%esp
+    1511:	99                   	cltd
+    1512:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1515:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1518:	5b                   	pop    %ebx
+    1519:	5e                   	pop    %esi
+    151a:	5f                   	pop    %edi
+    151b:	5d                   	pop    %ebp
+    151c:	c3                   	ret
+    151d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001520 <fgets>:
+
+// Read a line of at most max-1 bytes, keeping the newline.
+// Returns 0 if there was nothing left to read.
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    1520:	55                   	push   %ebp
+    1521:	89 e5                	mov    %esp,%ebp
+    1523:	57                   	push   %edi
+    1524:	56                   	push   %esi
+    1525:	53                   	push   %ebx
+    1526:	83 ec 1c             	sub    $0x1c,%esp
+  if(threaded)
+    1529:	8b 35 20 2b 00 00    	mov    0x2b20,%esi
+{
+    152f:	8b 7d 08             	mov    0x8(%ebp),%edi
+    1532:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if(threaded)
+    1535:	85 f6                	test   %esi,%esi
+    1537:	0f 85 83 00 00 00    	jne    15c0 <fgets+0xa0>
+{
+    153d:	31 f6                	xor    %esi,%esi
+    153f:	eb 2a                	jmp    156b <fgets+0x4b>
+    1541:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return f->buf[f->r++] & 0xff;
+    1548:	8b 53 08             	mov    0x8(%ebx),%edx
+    154b:	8d 48 01             	lea    0x1(%eax),%ecx
+    154e:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1551:	0f b6 14 02          	movzbl (%edx,%eax,1),%edx
+
+  flockfile(f);
+  for(i = 0; i+1 < max; ){
+    if((c = getc_unlocked(f)) == EOF)
+      break;
+    buf[i++] = c;
+    1555:	88 54 37 ff          	mov    %dl,-0x1(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    1559:	80 fa 0a             	cmp    $0xa,%dl
+    155c:	0f 84 96 00 00 00    	je     15f8 <fgets+0xd8>
+    1562:	83 fa 0d             	cmp    $0xd,%edx
+    1565:	0f 84 8d 00 00 00    	je     15f8 <fgets+0xd8>
+  for(i = 0; i+1 < max; ){
+    156b:	89 f2                	mov    %esi,%edx
+    156d:	83 c6 01             	add    $0x1,%esi
+    1570:	3b 75 0c             	cmp    0xc(%ebp),%esi
+    1573:	7d 2b                	jge    15a0 <fgets+0x80>
+  if(!(f->flags & IO_READ))
+    1575:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1579:	74 25                	je     15a0 <fgets+0x80>
+  if(f->r == f->n && fill(f) == 0)
+    157b:	8b 43 10             	mov    0x10(%ebx),%eax
+    157e:	3b 43 14             	cmp    0x14(%ebx),%eax
+    1581:	75 c5                	jne    1548 <fgets+0x28>
+    1583:	89 d8                	mov    %ebx,%eax
+    1585:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1588:	e8 43 f7 ff ff       	call   cd0 <fill>
+    158d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1590:	85 c0                	test   %eax,%eax
+    1592:	74 0c                	je     15a0 <fgets+0x80>
+  return f->buf[f->r++] & 0xff;
+    1594:	8b 43 10             	mov    0x10(%ebx),%eax
+    1597:	eb af                	jmp    1548 <fgets+0x28>
+    1599:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    15a0:	8b 0d 20 2b 00 00    	mov    0x2b20,%ecx
+      break;
+  }
+  buf[i] = '\0';
+    15a6:	c6 04 17 00          	movb   $0x0,(%edi,%edx,1)
+  if(threaded)
+    15aa:	85 c9                	test   %ecx,%ecx
+    15ac:	75 2a                	jne    15d8 <fgets+0xb8>
+  funlockfile(f);
+  return i > 0 ? buf : 0;
+    15ae:	31 c0                	xor    %eax,%eax
+    15b0:	85 d2                	test   %edx,%edx
+    15b2:	74 02                	je     15b6 <fgets+0x96>
+    15b4:	89 f8                	mov    %edi,%eax
+}
+    15b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15b9:	5b                   	pop    %ebx
+    15ba:	5e                   	pop    %esi
+    15bb:	5f                   	pop    %edi
+    15bc:	5d                   	pop    %ebp
+    15bd:	c3                   	ret
+    15be:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    15c0:	83 ec 0c             	sub    $0xc,%esp
+    15c3:	8d 43 18             	lea    0x18(%ebx),%eax
+    15c6:	50                   	push   %eax
+    15c7:	e8 24 ef ff ff       	call   4f0 <mutex_lock>
+    15cc:	83 c4 10             	add    $0x10,%esp
+    15cf:	e9 69 ff ff ff       	jmp    153d <fgets+0x1d>
+    15d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    15d8:	83 ec 0c             	sub    $0xc,%esp
+    15db:	83 c3 18             	add    $0x18,%ebx
+    15de:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    15e1:	53                   	push   %ebx
+    15e2:	e8 59 ef ff ff       	call   540 <mutex_unlock>
+    15e7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    15ea:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    15ed:	31 c0                	xor    %eax,%eax
+    15ef:	85 d2                	test   %edx,%edx
+    15f1:	75 c1                	jne    15b4 <fgets+0x94>
+    15f3:	eb c1                	jmp    15b6 <fgets+0x96>
+    15f5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    15f8:	a1 20 2b 00 00       	mov    0x2b20,%eax
+  buf[i] = '\0';
+    15fd:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  if(threaded)
+    1601:	85 c0                	test   %eax,%eax
+    1603:	74 af                	je     15b4 <fgets+0x94>
+    mutex_unlock(&f->lock);
+    1605:	83 ec 0c             	sub    $0xc,%esp
+    1608:	83 c3 18             	add    $0x18,%ebx
+    160b:	53                   	push   %ebx
+    160c:	e8 2f ef ff ff       	call   540 <mutex_unlock>
+    1611:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    1614:	89 f8                	mov    %edi,%eax
+    1616:	eb 9e                	jmp    15b6 <fgets+0x96>
+    1618:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    161f:	90                   	nop
+
+00001620 <gets>:
+// at most a line per read(), goes through stdin's buffer: from a
+// file or pipe, a buffered read could take input meant for a child
+// process, so read a byte at a time.
+char*
+gets(char *buf, int max)
+{
+    1620:	55                   	push   %ebp
+    1621:	89 e5                	mov    %esp,%ebp
+    1623:	57                   	push   %edi
+    1624:	56                   	push   %esi
+    1625:	53                   	push   %ebx
+    1626:	83 ec 2c             	sub    $0x2c,%esp
+  int i, cc;
+  char c;
+
+  if(!(stdin->flags & IO_SETUP))
+    1629:	8b 15 24 2a 00 00    	mov    0x2a24,%edx
+{
+    162f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!(stdin->flags & IO_SETUP))
+    1632:	f6 c2 40             	test   $0x40,%dl
+    1635:	74 79                	je     16b0 <gets+0x90>
+    setup(stdin);
+  if(stdin->flags & IO_DEV){
+    1637:	83 e2 20             	and    $0x20,%edx
+    163a:	89 d7                	mov    %edx,%edi
+    163c:	75 52                	jne    1690 <gets+0x70>
+  if(f == 0){
+    163e:	e8 ed f5 ff ff       	call   c30 <fflush.part.0>
+    fgets(buf, max, stdin);
+    return buf;
+  }
+  fflush(0);
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1643:	8d 75 e7             	lea    -0x19(%ebp),%esi
+  for(i=0; i+1 < max; ){
+    1646:	eb 2c                	jmp    1674 <gets+0x54>
+    1648:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    164f:	90                   	nop
+    cc = read(0, &c, 1);
+    1650:	83 ec 04             	sub    $0x4,%esp
+    1653:	6a 01                	push   $0x1
+    1655:	56                   	push   %esi
+    1656:	6a 00                	push   $0x0
+    1658:	e8 f5 ef ff ff       	call   652 <read>
+    if(cc < 1)
+    165d:	83 c4 10             	add    $0x10,%esp
+    1660:	85 c0                	test   %eax,%eax
+    1662:	7e 1b                	jle    167f <gets+0x5f>
+      break;
+    buf[i++] = c;
+    1664:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1668:	88 44 3b ff          	mov    %al,-0x1(%ebx,%edi,1)
+    if(c == '\n' || c == '\r')
+    166c:	3c 0a                	cmp    $0xa,%al
+    166e:	74 12                	je     1682 <gets+0x62>
+    1670:	3c 0d                	cmp    $0xd,%al
+    1672:	74 0e                	je     1682 <gets+0x62>
+  for(i=0; i+1 < max; ){
+    1674:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    1677:	83 c7 01             	add    $0x1,%edi
+    167a:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+    167d:	7c d1                	jl     1650 <gets+0x30>
+{
+    167f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      break;
+  }
+  buf[i] = '\0';
+    1682:	c6 04 3b 00          	movb   $0x0,(%ebx,%edi,1)
+  return buf;
+}
+    1686:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1689:	89 d8                	mov    %ebx,%eax
+    168b:	5b                   	pop    %ebx
+    168c:	5e                   	pop    %esi
+    168d:	5f                   	pop    %edi
+    168e:	5d                   	pop    %ebp
+    168f:	c3                   	ret
+    fgets(buf, max, stdin);
+    1690:	83 ec 04             	sub    $0x4,%esp
+    1693:	68 20 2a 00 00       	push   $0x2a20
+    1698:	ff 75 0c             	push   0xc(%ebp)
+    169b:	53                   	push   %ebx
+    169c:	e8 7f fe ff ff       	call   1520 <fgets>
+    return buf;
+    16a1:	83 c4 10             	add    $0x10,%esp
+}
+    16a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    16a7:	89 d8                	mov    %ebx,%eax
+    16a9:	5b                   	pop    %ebx
+    16aa:	5e                   	pop    %esi
+    16ab:	5f                   	pop    %edi
+    16ac:	5d                   	pop    %ebp
+    16ad:	c3                   	ret
+    16ae:	66 90                	xchg   %ax,%ax
+    setup(stdin);
+    16b0:	b8 20 2a 00 00       	mov    $0x2a20,%eax
+    16b5:	e8 a6 f4 ff ff       	call   b60 <setup>
+  if(stdin->flags & IO_DEV){
+    16ba:	8b 15 24 2a 00 00    	mov    0x2a24,%edx
+    16c0:	e9 72 ff ff ff       	jmp    1637 <gets+0x17>
+    16c5:	66 90                	xchg   %ax,%ax
+    16c7:	66 90                	xchg   %ax,%ax
+    16c9:	66 90                	xchg   %ax,%ax
+    16cb:	66 90                	xchg   %ax,%ax
+    16cd:	66 90                	xchg   %ax,%ax
+    16cf:	90                   	nop
+
+000016d0 <bigfree>:
+
+// Give a big block back to the first-fit list, and return the
+// free block that now holds it. Caller holds lock.
+static Header*
+bigfree(Header *bp)
+{
+    16d0:	55                   	push   %ebp
+    16d1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    16d3:	a1 c4 31 00 00       	mov    0x31c4,%eax
+{
+    16d8:	89 e5                	mov    %esp,%ebp
+    16da:	56                   	push   %esi
+    16db:	53                   	push   %ebx
+    16dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    16e0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    16e2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    16e4:	39 ca                	cmp    %ecx,%edx
+    16e6:	73 38                	jae    1720 <bigfree+0x50>
+    16e8:	39 c1                	cmp    %eax,%ecx
+    16ea:	72 04                	jb     16f0 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    16ec:	39 c2                	cmp    %eax,%edx
+    16ee:	72 f0                	jb     16e0 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    16f0:	8b 59 04             	mov    0x4(%ecx),%ebx
+    16f3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    16f6:	39 f0                	cmp    %esi,%eax
+    16f8:	74 36                	je     1730 <bigfree+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    16fa:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  freep = p;
+  if(p + p->s.size == bp){
+    16fc:	8b 42 04             	mov    0x4(%edx),%eax
+    16ff:	89 cb                	mov    %ecx,%ebx
+  freep = p;
+    1701:	89 15 c4 31 00 00    	mov    %edx,0x31c4
+  if(p + p->s.size == bp){
+    1707:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    170a:	39 f1                	cmp    %esi,%ecx
+    170c:	74 2e                	je     173c <bigfree+0x6c>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    170e:	89 1a                	mov    %ebx,(%edx)
+    return p;
+  }
+  p->s.ptr = bp;
+  return bp;
+}
+    1710:	89 c8                	mov    %ecx,%eax
+    1712:	5b                   	pop    %ebx
+    1713:	5e                   	pop    %esi
+    1714:	5d                   	pop    %ebp
+    1715:	c3                   	ret
+    1716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    171d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1720:	39 c1                	cmp    %eax,%ecx
+    1722:	72 c8                	jb     16ec <bigfree+0x1c>
+    1724:	eb ba                	jmp    16e0 <bigfree+0x10>
+    1726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    172d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1730:	03 58 04             	add    0x4(%eax),%ebx
+    1733:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1736:	8b 02                	mov    (%edx),%eax
+    1738:	8b 00                	mov    (%eax),%eax
+    173a:	eb be                	jmp    16fa <bigfree+0x2a>
+    p->s.size += bp->s.size;
+    173c:	03 41 04             	add    0x4(%ecx),%eax
+    173f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1742:	8b 19                	mov    (%ecx),%ebx
+    return p;
+    1744:	89 d1                	mov    %edx,%ecx
+}
+    1746:	89 c8                	mov    %ecx,%eax
+    p->s.ptr = bp->s.ptr;
+    1748:	89 1a                	mov    %ebx,(%edx)
+}
+    174a:	5b                   	pop    %ebx
+    174b:	5e                   	pop    %esi
+    174c:	5d                   	pop    %ebp
+    174d:	c3                   	ret
+    174e:	66 90                	xchg   %ax,%ax
+
+00001750 <trim>:
+// If free block bp ends the heap, return its whole pages to the
+// kernel, unless something else has moved the break since.
+// Caller holds lock.
+static void
+trim(Header *bp)
+{
+    1750:	55                   	push   %ebp
+    1751:	89 e5                	mov    %esp,%ebp
+    1753:	57                   	push   %edi
+    1754:	56                   	push   %esi
+    1755:	53                   	push   %ebx
+    1756:	89 c3                	mov    %eax,%ebx
+    1758:	83 ec 0c             	sub    $0xc,%esp
+  char *end;
+  uint n;
+
+  if((char*)(bp + bp->s.size) != heapend)
+    175b:	8b 53 04             	mov    0x4(%ebx),%edx
+    175e:	a1 c0 31 00 00       	mov    0x31c0,%eax
+    1763:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+    1766:	39 d0                	cmp    %edx,%eax
+    1768:	74 0e                	je     1778 <trim+0x28>
+  n = heapend - end;
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    bp->s.size -= n / sizeof(Header);
+    heapend = end;
+  }
+}
+    176a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    176d:	5b                   	pop    %ebx
+    176e:	5e                   	pop    %esi
+    176f:	5f                   	pop    %edi
+    1770:	5d                   	pop    %ebp
+    1771:	c3                   	ret
+    1772:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  end = (char*)PGROUNDUP((uint)(bp + 2));
+    1778:	8d bb 0f 10 00 00    	lea    0x100f(%ebx),%edi
+    177e:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  n = heapend - end;
+    1784:	29 f8                	sub    %edi,%eax
+    1786:	89 c6                	mov    %eax,%esi
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    1788:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    178d:	76 db                	jbe    176a <trim+0x1a>
+    178f:	83 ec 0c             	sub    $0xc,%esp
+    1792:	6a 00                	push   $0x0
+    1794:	e8 8b ef ff ff       	call   724 <sbrk>
+    1799:	83 c4 10             	add    $0x10,%esp
+    179c:	39 05 c0 31 00 00    	cmp    %eax,0x31c0
+    17a2:	75 c6                	jne    176a <trim+0x1a>
+    17a4:	89 f0                	mov    %esi,%eax
+    17a6:	83 ec 0c             	sub    $0xc,%esp
+    17a9:	f7 d8                	neg    %eax
+    17ab:	50                   	push   %eax
+    17ac:	e8 73 ef ff ff       	call   724 <sbrk>
+    17b1:	83 c4 10             	add    $0x10,%esp
+    17b4:	83 f8 ff             	cmp    $0xffffffff,%eax
+    17b7:	74 b1                	je     176a <trim+0x1a>
+    bp->s.size -= n / sizeof(Header);
+    17b9:	89 f0                	mov    %esi,%eax
+    heapend = end;
+    17bb:	89 3d c0 31 00 00    	mov    %edi,0x31c0
+    bp->s.size -= n / sizeof(Header);
+    17c1:	c1 e8 03             	shr    $0x3,%eax
+    17c4:	29 43 04             	sub    %eax,0x4(%ebx)
+    heapend = end;
+    17c7:	eb a1                	jmp    176a <trim+0x1a>
+    17c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000017d0 <bigalloc>:
+}
+
+// Allocate a big block of nunits units. Caller holds lock.
+static Header*
+bigalloc(uint nunits)
+{
+    17d0:	55                   	push   %ebp
+    17d1:	89 e5                	mov    %esp,%ebp
+    17d3:	57                   	push   %edi
+    17d4:	89 c7                	mov    %eax,%edi
+    17d6:	56                   	push   %esi
+    17d7:	53                   	push   %ebx
+    17d8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    17db:	a1 c4 31 00 00       	mov    0x31c4,%eax
+    17e0:	85 c0                	test   %eax,%eax
+    17e2:	0f 84 98 00 00 00    	je     1880 <bigalloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    17e8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    17ea:	8b 4a 04             	mov    0x4(%edx),%ecx
+    17ed:	39 f9                	cmp    %edi,%ecx
+    17ef:	73 67                	jae    1858 <bigalloc+0x88>
+  if(nu < 4096)
+    17f1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    17f6:	39 df                	cmp    %ebx,%edi
+    17f8:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    17fb:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    1802:	eb 0d                	jmp    1811 <bigalloc+0x41>
+    1804:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1808:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    180a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    180d:	39 f9                	cmp    %edi,%ecx
+    180f:	73 47                	jae    1858 <bigalloc+0x88>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    1811:	89 d0                	mov    %edx,%eax
+    1813:	39 15 c4 31 00 00    	cmp    %edx,0x31c4
+    1819:	75 ed                	jne    1808 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    181b:	83 ec 0c             	sub    $0xc,%esp
+    181e:	56                   	push   %esi
+    181f:	e8 00 ef ff ff       	call   724 <sbrk>
+  if(p == (char*)-1)
+    1824:	83 c4 10             	add    $0x10,%esp
+    1827:	83 f8 ff             	cmp    $0xffffffff,%eax
+    182a:	74 1a                	je     1846 <bigalloc+0x76>
+  hp->s.size = nu;
+    182c:	89 58 04             	mov    %ebx,0x4(%eax)
+  heapend = p + nu * sizeof(Header);
+    182f:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    1832:	89 15 c0 31 00 00    	mov    %edx,0x31c0
+  bigfree(hp);
+    1838:	e8 93 fe ff ff       	call   16d0 <bigfree>
+  return freep;
+    183d:	a1 c4 31 00 00       	mov    0x31c4,%eax
+      if((p = morecore(nunits)) == 0)
+    1842:	85 c0                	test   %eax,%eax
+    1844:	75 c2                	jne    1808 <bigalloc+0x38>
+        return 0;
+  }
+}
+    1846:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1849:	31 d2                	xor    %edx,%edx
+}
+    184b:	5b                   	pop    %ebx
+    184c:	89 d0                	mov    %edx,%eax
+    184e:	5e                   	pop    %esi
+    184f:	5f                   	pop    %edi
+    1850:	5d                   	pop    %ebp
+    1851:	c3                   	ret
+    1852:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1858:	39 cf                	cmp    %ecx,%edi
+    185a:	74 54                	je     18b0 <bigalloc+0xe0>
+        p->s.size -= nunits;
+    185c:	29 f9                	sub    %edi,%ecx
+    185e:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    1861:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    1864:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    1867:	a3 c4 31 00 00       	mov    %eax,0x31c4
+}
+    186c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    186f:	89 d0                	mov    %edx,%eax
+    1871:	5b                   	pop    %ebx
+    1872:	5e                   	pop    %esi
+    1873:	5f                   	pop    %edi
+    1874:	5d                   	pop    %ebp
+    1875:	c3                   	ret
+    1876:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    187d:	8d 76 00             	lea    0x0(%esi),%esi
+    base.s.ptr = freep = prevp = &base;
+    1880:	c7 05 c4 31 00 00 c8 	movl   $0x31c8,0x31c4
+    1887:	31 00 00 
+    base.s.size = 0;
+    188a:	ba c8 31 00 00       	mov    $0x31c8,%edx
+    base.s.ptr = freep = prevp = &base;
+    188f:	c7 05 c8 31 00 00 c8 	movl   $0x31c8,0x31c8
+    1896:	31 00 00 
+    base.s.size = 0;
+    1899:	c7 05 cc 31 00 00 00 	movl   $0x0,0x31cc
+    18a0:	00 00 00 
+    if(p->s.size >= nunits){
+    18a3:	e9 49 ff ff ff       	jmp    17f1 <bigalloc+0x21>
+    18a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18af:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    18b0:	8b 0a                	mov    (%edx),%ecx
+    18b2:	89 08                	mov    %ecx,(%eax)
+    18b4:	eb b1                	jmp    1867 <bigalloc+0x97>
+    18b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000018c0 <drain>:
+}
+
+// Move n blocks of class c from cache tc to the shared list.
+static void
+drain(struct tcache *tc, int c, int n)
+{
+    18c0:	55                   	push   %ebp
+    18c1:	89 e5                	mov    %esp,%ebp
+    18c3:	57                   	push   %edi
+    18c4:	89 c7                	mov    %eax,%edi
+    18c6:	56                   	push   %esi
+    18c7:	89 d6                	mov    %edx,%esi
+    18c9:	53                   	push   %ebx
+    18ca:	89 cb                	mov    %ecx,%ebx
+    18cc:	83 ec 0c             	sub    $0xc,%esp
+  if(threaded)
+    18cf:	8b 15 44 31 00 00    	mov    0x3144,%edx
+    18d5:	85 d2                	test   %edx,%edx
+    18d7:	75 57                	jne    1930 <drain+0x70>
+  Header *p;
+
+  acquire();
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    18d9:	85 c9                	test   %ecx,%ecx
+    18db:	7e 49                	jle    1926 <drain+0x66>
+    18dd:	89 d9                	mov    %ebx,%ecx
+    18df:	8d 14 b7             	lea    (%edi,%esi,4),%edx
+    18e2:	eb 23                	jmp    1907 <drain+0x47>
+    18e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    tc->list[c] = p->s.ptr;
+    18e8:	8b 18                	mov    (%eax),%ebx
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    18ea:	83 e9 01             	sub    $0x1,%ecx
+    tc->n[c]--;
+    18ed:	83 6a 20 01          	subl   $0x1,0x20(%edx)
+    tc->list[c] = p->s.ptr;
+    18f1:	89 1a                	mov    %ebx,(%edx)
+    p->s.ptr = small[c];
+    18f3:	8b 1c b5 a0 31 00 00 	mov    0x31a0(,%esi,4),%ebx
+    18fa:	89 18                	mov    %ebx,(%eax)
+    small[c] = p;
+    18fc:	89 04 b5 a0 31 00 00 	mov    %eax,0x31a0(,%esi,4)
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1903:	85 c9                	test   %ecx,%ecx
+    1905:	7e 06                	jle    190d <drain+0x4d>
+    1907:	8b 02                	mov    (%edx),%eax
+    1909:	85 c0                	test   %eax,%eax
+    190b:	75 db                	jne    18e8 <drain+0x28>
+  if(threaded)
+    190d:	a1 44 31 00 00       	mov    0x3144,%eax
+    1912:	85 c0                	test   %eax,%eax
+    1914:	74 10                	je     1926 <drain+0x66>
+    mutex_unlock(&lock);
+    1916:	83 ec 0c             	sub    $0xc,%esp
+    1919:	68 48 31 00 00       	push   $0x3148
+    191e:	e8 1d ec ff ff       	call   540 <mutex_unlock>
+}
+    1923:	83 c4 10             	add    $0x10,%esp
+  }
+  release();
+}
+    1926:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1929:	5b                   	pop    %ebx
+    192a:	5e                   	pop    %esi
+    192b:	5f                   	pop    %edi
+    192c:	5d                   	pop    %ebp
+    192d:	c3                   	ret
+    192e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&lock);
+    1930:	83 ec 0c             	sub    $0xc,%esp
+    1933:	68 48 31 00 00       	push   $0x3148
+    1938:	e8 b3 eb ff ff       	call   4f0 <mutex_lock>
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    193d:	83 c4 10             	add    $0x10,%esp
+    1940:	85 db                	test   %ebx,%ebx
+    1942:	7f 99                	jg     18dd <drain+0x1d>
+    1944:	eb c7                	jmp    190d <drain+0x4d>
+    1946:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    194d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001950 <mycache>:
+{
+    1950:	55                   	push   %ebp
+    return &maincache;
+    1951:	b8 60 31 00 00       	mov    $0x3160,%eax
+{
+    1956:	89 e5                	mov    %esp,%ebp
+    1958:	53                   	push   %ebx
+  sp = PGROUNDDOWN((uint)&sp);
+    1959:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+    195c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+    1962:	83 ec 14             	sub    $0x14,%esp
+  if(!threaded || sp == mainstack)
+    1965:	8b 0d 44 31 00 00    	mov    0x3144,%ecx
+  sp = PGROUNDDOWN((uint)&sp);
+    196b:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  if(!threaded || sp == mainstack)
+    196e:	85 c9                	test   %ecx,%ecx
+    1970:	74 0f                	je     1981 <mycache+0x31>
+    1972:	3b 1d 40 31 00 00    	cmp    0x3140,%ebx
+    1978:	74 07                	je     1981 <mycache+0x31>
+  if(*cp == 0){
+    197a:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    197d:	85 c0                	test   %eax,%eax
+    197f:	74 0f                	je     1990 <mycache+0x40>
+}
+    1981:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1984:	c9                   	leave
+    1985:	c3                   	ret
+    1986:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    198d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1990:	83 ec 0c             	sub    $0xc,%esp
+    1993:	68 48 31 00 00       	push   $0x3148
+    1998:	e8 53 eb ff ff       	call   4f0 <mutex_lock>
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    199d:	b8 09 00 00 00       	mov    $0x9,%eax
+    19a2:	e8 29 fe ff ff       	call   17d0 <bigalloc>
+  if(threaded)
+    19a7:	8b 15 44 31 00 00    	mov    0x3144,%edx
+    19ad:	83 c4 10             	add    $0x10,%esp
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    19b0:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(threaded)
+    19b3:	85 d2                	test   %edx,%edx
+    19b5:	75 29                	jne    19e0 <mycache+0x90>
+    if(*cp == 0)
+    19b7:	85 c0                	test   %eax,%eax
+    19b9:	74 c6                	je     1981 <mycache+0x31>
+    memset(*cp, 0, sizeof(**cp));
+    19bb:	83 ec 04             	sub    $0x4,%esp
+    *cp = (struct tcache*)((Header*)*cp + 1);
+    19be:	83 c0 08             	add    $0x8,%eax
+    19c1:	89 43 f8             	mov    %eax,-0x8(%ebx)
+    memset(*cp, 0, sizeof(**cp));
+    19c4:	6a 40                	push   $0x40
+    19c6:	6a 00                	push   $0x0
+    19c8:	50                   	push   %eax
+    19c9:	e8 f2 e9 ff ff       	call   3c0 <memset>
+  return *cp;
+    19ce:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    19d1:	83 c4 10             	add    $0x10,%esp
+    19d4:	eb ab                	jmp    1981 <mycache+0x31>
+    19d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19dd:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    19e0:	83 ec 0c             	sub    $0xc,%esp
+    19e3:	68 48 31 00 00       	push   $0x3148
+    19e8:	e8 53 eb ff ff       	call   540 <mutex_unlock>
+    if(*cp == 0)
+    19ed:	8b 43 f8             	mov    -0x8(%ebx),%eax
+}
+    19f0:	83 c4 10             	add    $0x10,%esp
+    19f3:	eb c2                	jmp    19b7 <mycache+0x67>
+    19f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001a00 <free>:
+
+void
+free(void *ap)
+{
+    1a00:	55                   	push   %ebp
+    1a01:	89 e5                	mov    %esp,%ebp
+    1a03:	57                   	push   %edi
+    1a04:	56                   	push   %esi
+    1a05:	53                   	push   %ebx
+    1a06:	83 ec 1c             	sub    $0x1c,%esp
+    1a09:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  struct tcache *tc;
+  int c;
+
+  if(ap == 0)
+    1a0c:	85 f6                	test   %esi,%esi
+    1a0e:	74 51                	je     1a61 <free+0x61>
+    return;
+  bp = (Header*)ap - 1;
+    1a10:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1a13:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(bp->s.size > SMALLMAX / sizeof(Header)){
+    1a16:	8b 46 fc             	mov    -0x4(%esi),%eax
+    1a19:	3d 00 01 00 00       	cmp    $0x100,%eax
+    1a1e:	77 50                	ja     1a70 <free+0x70>
+    acquire();
+    trim(bigfree(bp));
+    release();
+    return;
+  }
+  for(c = 0; (2 << c) < bp->s.size; c++)
+    1a20:	31 db                	xor    %ebx,%ebx
+    1a22:	ba 02 00 00 00       	mov    $0x2,%edx
+    1a27:	83 f8 02             	cmp    $0x2,%eax
+    1a2a:	76 11                	jbe    1a3d <free+0x3d>
+    1a2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1a30:	83 c3 01             	add    $0x1,%ebx
+    1a33:	89 d7                	mov    %edx,%edi
+    1a35:	89 d9                	mov    %ebx,%ecx
+    1a37:	d3 e7                	shl    %cl,%edi
+    1a39:	39 c7                	cmp    %eax,%edi
+    1a3b:	72 f3                	jb     1a30 <free+0x30>
+    ;
+  if((tc = mycache()) == 0){
+    1a3d:	e8 0e ff ff ff       	call   1950 <mycache>
+    1a42:	85 c0                	test   %eax,%eax
+    1a44:	74 7a                	je     1ac0 <free+0xc0>
+    bp->s.ptr = small[c];
+    small[c] = bp;
+    release();
+    return;
+  }
+  bp->s.ptr = tc->list[c];
+    1a46:	8d 0c 98             	lea    (%eax,%ebx,4),%ecx
+    1a49:	8b 11                	mov    (%ecx),%edx
+    1a4b:	89 56 f8             	mov    %edx,-0x8(%esi)
+  tc->list[c] = bp;
+    1a4e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1a51:	89 31                	mov    %esi,(%ecx)
+  if(++tc->n[c] > TCACHEMAX)
+    1a53:	8b 71 20             	mov    0x20(%ecx),%esi
+    1a56:	8d 56 01             	lea    0x1(%esi),%edx
+    1a59:	89 51 20             	mov    %edx,0x20(%ecx)
+    1a5c:	83 fa 20             	cmp    $0x20,%edx
+    1a5f:	7f 47                	jg     1aa8 <free+0xa8>
+    drain(tc, c, BATCH);
+}
+    1a61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a64:	5b                   	pop    %ebx
+    1a65:	5e                   	pop    %esi
+    1a66:	5f                   	pop    %edi
+    1a67:	5d                   	pop    %ebp
+    1a68:	c3                   	ret
+    1a69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1a70:	8b 1d 44 31 00 00    	mov    0x3144,%ebx
+    1a76:	85 db                	test   %ebx,%ebx
+    1a78:	75 66                	jne    1ae0 <free+0xe0>
+    trim(bigfree(bp));
+    1a7a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1a7d:	e8 4e fc ff ff       	call   16d0 <bigfree>
+    1a82:	e8 c9 fc ff ff       	call   1750 <trim>
+  if(threaded)
+    1a87:	8b 0d 44 31 00 00    	mov    0x3144,%ecx
+    1a8d:	85 c9                	test   %ecx,%ecx
+    1a8f:	74 d0                	je     1a61 <free+0x61>
+    mutex_unlock(&lock);
+    1a91:	c7 45 08 48 31 00 00 	movl   $0x3148,0x8(%ebp)
+}
+    1a98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a9b:	5b                   	pop    %ebx
+    1a9c:	5e                   	pop    %esi
+    1a9d:	5f                   	pop    %edi
+    1a9e:	5d                   	pop    %ebp
+    mutex_unlock(&lock);
+    1a9f:	e9 9c ea ff ff       	jmp    540 <mutex_unlock>
+    1aa4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    1aa8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    drain(tc, c, BATCH);
+    1aab:	89 da                	mov    %ebx,%edx
+    1aad:	b9 10 00 00 00       	mov    $0x10,%ecx
+}
+    1ab2:	5b                   	pop    %ebx
+    1ab3:	5e                   	pop    %esi
+    1ab4:	5f                   	pop    %edi
+    1ab5:	5d                   	pop    %ebp
+    drain(tc, c, BATCH);
+    1ab6:	e9 05 fe ff ff       	jmp    18c0 <drain>
+    1abb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1abf:	90                   	nop
+  if(threaded)
+    1ac0:	8b 15 44 31 00 00    	mov    0x3144,%edx
+    1ac6:	85 d2                	test   %edx,%edx
+    1ac8:	75 28                	jne    1af2 <free+0xf2>
+    bp->s.ptr = small[c];
+    1aca:	8b 04 9d a0 31 00 00 	mov    0x31a0(,%ebx,4),%eax
+    1ad1:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1ad4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1ad7:	89 04 9d a0 31 00 00 	mov    %eax,0x31a0(,%ebx,4)
+  if(threaded)
+    1ade:	eb 81                	jmp    1a61 <free+0x61>
+    mutex_lock(&lock);
+    1ae0:	83 ec 0c             	sub    $0xc,%esp
+    1ae3:	68 48 31 00 00       	push   $0x3148
+    1ae8:	e8 03 ea ff ff       	call   4f0 <mutex_lock>
+}
+    1aed:	83 c4 10             	add    $0x10,%esp
+    1af0:	eb 88                	jmp    1a7a <free+0x7a>
+    mutex_lock(&lock);
+    1af2:	83 ec 0c             	sub    $0xc,%esp
+    1af5:	68 48 31 00 00       	push   $0x3148
+    1afa:	e8 f1 e9 ff ff       	call   4f0 <mutex_lock>
+    bp->s.ptr = small[c];
+    1aff:	8b 04 9d a0 31 00 00 	mov    0x31a0(,%ebx,4),%eax
+  if(threaded)
+    1b06:	83 c4 10             	add    $0x10,%esp
+    bp->s.ptr = small[c];
+    1b09:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1b0c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1b0f:	89 04 9d a0 31 00 00 	mov    %eax,0x31a0(,%ebx,4)
+  if(threaded)
+    1b16:	a1 44 31 00 00       	mov    0x3144,%eax
+    1b1b:	85 c0                	test   %eax,%eax
+    1b1d:	0f 85 6e ff ff ff    	jne    1a91 <free+0x91>
+    1b23:	e9 39 ff ff ff       	jmp    1a61 <free+0x61>
+    1b28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b2f:	90                   	nop
+
+00001b30 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1b30:	55                   	push   %ebp
+    1b31:	89 e5                	mov    %esp,%ebp
+    1b33:	57                   	push   %edi
+    1b34:	56                   	push   %esi
+    1b35:	53                   	push   %ebx
+    1b36:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  struct tcache *tc;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1b39:	8b 45 08             	mov    0x8(%ebp),%eax
+    1b3c:	8d 78 07             	lea    0x7(%eax),%edi
+    1b3f:	c1 ef 03             	shr    $0x3,%edi
+    1b42:	83 c7 01             	add    $0x1,%edi
+  if(nunits > SMALLMAX / sizeof(Header)){
+    1b45:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+    1b4b:	77 5b                	ja     1ba8 <malloc+0x78>
+    acquire();
+    p = bigalloc(nunits);
+    release();
+    return p ? (void*)(p + 1) : 0;
+  }
+  for(c = 0; (2 << c) < nunits; c++)
+    1b4d:	31 c9                	xor    %ecx,%ecx
+    1b4f:	b8 02 00 00 00       	mov    $0x2,%eax
+    1b54:	be 02 00 00 00       	mov    $0x2,%esi
+    1b59:	bb 02 00 00 00       	mov    $0x2,%ebx
+    1b5e:	83 ff 02             	cmp    $0x2,%edi
+    1b61:	76 12                	jbe    1b75 <malloc+0x45>
+    1b63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1b67:	90                   	nop
+    1b68:	83 c1 01             	add    $0x1,%ecx
+    1b6b:	89 c3                	mov    %eax,%ebx
+    1b6d:	d3 e3                	shl    %cl,%ebx
+    1b6f:	89 de                	mov    %ebx,%esi
+    1b71:	39 fb                	cmp    %edi,%ebx
+    1b73:	72 f3                	jb     1b68 <malloc+0x38>
+    1b75:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    ;
+  if((tc = mycache()) == 0)
+    1b78:	e8 d3 fd ff ff       	call   1950 <mycache>
+    1b7d:	85 c0                	test   %eax,%eax
+    1b7f:	74 51                	je     1bd2 <malloc+0xa2>
+    return 0;
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1b81:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1b84:	8d 3c 88             	lea    (%eax,%ecx,4),%edi
+    1b87:	8b 07                	mov    (%edi),%eax
+    1b89:	85 c0                	test   %eax,%eax
+    1b8b:	74 53                	je     1be0 <malloc+0xb0>
+    return 0;
+  p = tc->list[c];
+  tc->list[c] = p->s.ptr;
+  tc->n[c]--;
+    1b8d:	8b 57 20             	mov    0x20(%edi),%edx
+  tc->list[c] = p->s.ptr;
+    1b90:	8b 08                	mov    (%eax),%ecx
+  tc->n[c]--;
+    1b92:	83 ea 01             	sub    $0x1,%edx
+  return (void*)(p + 1);
+    1b95:	83 c0 08             	add    $0x8,%eax
+  tc->n[c]--;
+    1b98:	89 57 20             	mov    %edx,0x20(%edi)
+  tc->list[c] = p->s.ptr;
+    1b9b:	89 0f                	mov    %ecx,(%edi)
+}
+    1b9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ba0:	5b                   	pop    %ebx
+    1ba1:	5e                   	pop    %esi
+    1ba2:	5f                   	pop    %edi
+    1ba3:	5d                   	pop    %ebp
+    1ba4:	c3                   	ret
+    1ba5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1ba8:	a1 44 31 00 00       	mov    0x3144,%eax
+    1bad:	85 c0                	test   %eax,%eax
+    1baf:	0f 85 b3 00 00 00    	jne    1c68 <malloc+0x138>
+    p = bigalloc(nunits);
+    1bb5:	89 f8                	mov    %edi,%eax
+    1bb7:	e8 14 fc ff ff       	call   17d0 <bigalloc>
+    1bbc:	89 c3                	mov    %eax,%ebx
+  if(threaded)
+    1bbe:	a1 44 31 00 00       	mov    0x3144,%eax
+    1bc3:	85 c0                	test   %eax,%eax
+    1bc5:	0f 85 85 00 00 00    	jne    1c50 <malloc+0x120>
+    return p ? (void*)(p + 1) : 0;
+    1bcb:	8d 43 08             	lea    0x8(%ebx),%eax
+    1bce:	85 db                	test   %ebx,%ebx
+    1bd0:	75 cb                	jne    1b9d <malloc+0x6d>
+    1bd2:	31 c0                	xor    %eax,%eax
+}
+    1bd4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1bd7:	5b                   	pop    %ebx
+    1bd8:	5e                   	pop    %esi
+    1bd9:	5f                   	pop    %edi
+    1bda:	5d                   	pop    %ebp
+    1bdb:	c3                   	ret
+    1bdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1be0:	a1 44 31 00 00       	mov    0x3144,%eax
+    1be5:	85 c0                	test   %eax,%eax
+    1be7:	0f 85 29 01 00 00    	jne    1d16 <malloc+0x1e6>
+  if(small[c] == 0){
+    1bed:	8b 04 8d a0 31 00 00 	mov    0x31a0(,%ecx,4),%eax
+    1bf4:	85 c0                	test   %eax,%eax
+    1bf6:	0f 84 81 00 00 00    	je     1c7d <malloc+0x14d>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1bfc:	31 db                	xor    %ebx,%ebx
+    1bfe:	eb 22                	jmp    1c22 <malloc+0xf2>
+    small[c] = p->s.ptr;
+    1c00:	8b 10                	mov    (%eax),%edx
+  for(moved = 0; moved < n && small[c]; moved++){
+    1c02:	83 c3 01             	add    $0x1,%ebx
+    small[c] = p->s.ptr;
+    1c05:	89 14 8d a0 31 00 00 	mov    %edx,0x31a0(,%ecx,4)
+    p->s.ptr = tc->list[c];
+    1c0c:	8b 17                	mov    (%edi),%edx
+    1c0e:	89 10                	mov    %edx,(%eax)
+    tc->list[c] = p;
+    1c10:	89 07                	mov    %eax,(%edi)
+  for(moved = 0; moved < n && small[c]; moved++){
+    1c12:	83 fb 10             	cmp    $0x10,%ebx
+    1c15:	0f 84 e2 00 00 00    	je     1cfd <malloc+0x1cd>
+    1c1b:	8b 04 8d a0 31 00 00 	mov    0x31a0(,%ecx,4),%eax
+    1c22:	85 c0                	test   %eax,%eax
+    1c24:	75 da                	jne    1c00 <malloc+0xd0>
+  if(threaded)
+    1c26:	8b 15 44 31 00 00    	mov    0x3144,%edx
+    1c2c:	85 d2                	test   %edx,%edx
+    1c2e:	0f 85 b4 00 00 00    	jne    1ce8 <malloc+0x1b8>
+  tc->n[c] += moved;
+    1c34:	8b 57 20             	mov    0x20(%edi),%edx
+    1c37:	01 da                	add    %ebx,%edx
+    1c39:	89 57 20             	mov    %edx,0x20(%edi)
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1c3c:	85 db                	test   %ebx,%ebx
+    1c3e:	74 92                	je     1bd2 <malloc+0xa2>
+  p = tc->list[c];
+    1c40:	8b 07                	mov    (%edi),%eax
+    1c42:	e9 49 ff ff ff       	jmp    1b90 <malloc+0x60>
+    1c47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c4e:	66 90                	xchg   %ax,%ax
+    mutex_unlock(&lock);
+    1c50:	83 ec 0c             	sub    $0xc,%esp
+    1c53:	68 48 31 00 00       	push   $0x3148
+    1c58:	e8 e3 e8 ff ff       	call   540 <mutex_unlock>
+}
+    1c5d:	83 c4 10             	add    $0x10,%esp
+    1c60:	e9 66 ff ff ff       	jmp    1bcb <malloc+0x9b>
+    1c65:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1c68:	83 ec 0c             	sub    $0xc,%esp
+    1c6b:	68 48 31 00 00       	push   $0x3148
+    1c70:	e8 7b e8 ff ff       	call   4f0 <mutex_lock>
+}
+    1c75:	83 c4 10             	add    $0x10,%esp
+    1c78:	e9 38 ff ff ff       	jmp    1bb5 <malloc+0x85>
+    if((chunk = bigalloc(CHUNK / sizeof(Header) + 1)) == 0){
+    1c7d:	b8 01 02 00 00       	mov    $0x201,%eax
+    1c82:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1c85:	e8 46 fb ff ff       	call   17d0 <bigalloc>
+    1c8a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1c8d:	85 c0                	test   %eax,%eax
+    1c8f:	89 c2                	mov    %eax,%edx
+    1c91:	0f 84 ba 00 00 00    	je     1d51 <malloc+0x221>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1c97:	83 c2 08             	add    $0x8,%edx
+    1c9a:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+    1ca0:	0f 87 d0 00 00 00    	ja     1d76 <malloc+0x246>
+    1ca6:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+    1cad:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    1cb0:	89 df                	mov    %ebx,%edi
+    1cb2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1cb5:	8d 76 00             	lea    0x0(%esi),%esi
+      p->s.size = units;
+    1cb8:	89 72 04             	mov    %esi,0x4(%edx)
+      p->s.ptr = small[c];
+    1cbb:	8b 04 8d a0 31 00 00 	mov    0x31a0(,%ecx,4),%eax
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1cc2:	01 df                	add    %ebx,%edi
+    1cc4:	89 55 e0             	mov    %edx,-0x20(%ebp)
+      p->s.ptr = small[c];
+    1cc7:	89 02                	mov    %eax,(%edx)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1cc9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      small[c] = p;
+    1ccc:	89 14 8d a0 31 00 00 	mov    %edx,0x31a0(,%ecx,4)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1cd3:	01 c2                	add    %eax,%edx
+    1cd5:	81 ff 00 02 00 00    	cmp    $0x200,%edi
+    1cdb:	76 db                	jbe    1cb8 <malloc+0x188>
+    1cdd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1ce0:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1ce3:	e9 14 ff ff ff       	jmp    1bfc <malloc+0xcc>
+    mutex_unlock(&lock);
+    1ce8:	83 ec 0c             	sub    $0xc,%esp
+    1ceb:	68 48 31 00 00       	push   $0x3148
+    1cf0:	e8 4b e8 ff ff       	call   540 <mutex_unlock>
+}
+    1cf5:	83 c4 10             	add    $0x10,%esp
+    1cf8:	e9 37 ff ff ff       	jmp    1c34 <malloc+0x104>
+  if(threaded)
+    1cfd:	a1 44 31 00 00       	mov    0x3144,%eax
+    1d02:	85 c0                	test   %eax,%eax
+    1d04:	75 2b                	jne    1d31 <malloc+0x201>
+  tc->n[c] += moved;
+    1d06:	8b 47 20             	mov    0x20(%edi),%eax
+    1d09:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1d0c:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1d0e:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1d11:	e9 7a fe ff ff       	jmp    1b90 <malloc+0x60>
+    mutex_lock(&lock);
+    1d16:	83 ec 0c             	sub    $0xc,%esp
+    1d19:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1d1c:	68 48 31 00 00       	push   $0x3148
+    1d21:	e8 ca e7 ff ff       	call   4f0 <mutex_lock>
+}
+    1d26:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1d29:	83 c4 10             	add    $0x10,%esp
+    1d2c:	e9 bc fe ff ff       	jmp    1bed <malloc+0xbd>
+    mutex_unlock(&lock);
+    1d31:	83 ec 0c             	sub    $0xc,%esp
+    1d34:	68 48 31 00 00       	push   $0x3148
+    1d39:	e8 02 e8 ff ff       	call   540 <mutex_unlock>
+  tc->n[c] += moved;
+    1d3e:	8b 47 20             	mov    0x20(%edi),%eax
+    1d41:	83 c4 10             	add    $0x10,%esp
+    1d44:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1d47:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1d49:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1d4c:	e9 3f fe ff ff       	jmp    1b90 <malloc+0x60>
+  if(threaded)
+    1d51:	8b 0d 44 31 00 00    	mov    0x3144,%ecx
+    1d57:	85 c9                	test   %ecx,%ecx
+    1d59:	0f 84 73 fe ff ff    	je     1bd2 <malloc+0xa2>
+    mutex_unlock(&lock);
+    1d5f:	83 ec 0c             	sub    $0xc,%esp
+    1d62:	68 48 31 00 00       	push   $0x3148
+    1d67:	e8 d4 e7 ff ff       	call   540 <mutex_unlock>
+    1d6c:	83 c4 10             	add    $0x10,%esp
+    return p ? (void*)(p + 1) : 0;
+    1d6f:	31 c0                	xor    %eax,%eax
+    1d71:	e9 5e fe ff ff       	jmp    1bd4 <malloc+0xa4>
+  for(moved = 0; moved < n && small[c]; moved++){
+    1d76:	8b 04 8d a0 31 00 00 	mov    0x31a0(,%ecx,4),%eax
+    1d7d:	e9 7a fe ff ff       	jmp    1bfc <malloc+0xcc>
+    1d82:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001d90 <malloc_threaded>:
+void
+malloc_threaded(void)
+{
+  uint sp;
+
+  if(threaded)
+    1d90:	a1 44 31 00 00       	mov    0x3144,%eax
+    1d95:	85 c0                	test   %eax,%eax
+    1d97:	74 07                	je     1da0 <malloc_threaded+0x10>
+    1d99:	c3                   	ret
+    1d9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+{
+    1da0:	55                   	push   %ebp
+    1da1:	89 e5                	mov    %esp,%ebp
+    1da3:	83 ec 24             	sub    $0x24,%esp
+    return;
+  mutex_init(&lock);
+    1da6:	68 48 31 00 00       	push   $0x3148
+    1dab:	e8 30 e7 ff ff       	call   4e0 <mutex_init>
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1db0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1db3:	83 c4 10             	add    $0x10,%esp
+  threaded = 1;
+    1db6:	c7 05 44 31 00 00 01 	movl   $0x1,0x3144
+    1dbd:	00 00 00 
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1dc0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    1dc5:	a3 40 31 00 00       	mov    %eax,0x3140
+}
+    1dca:	c9                   	leave
+    1dcb:	c3                   	ret
+    1dcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001dd0 <malloc_thread_exit>:
+
+// Called by thread_join() with the cache slot of a finished
+// thread: give its blocks, and the cache itself, back.
+void
+malloc_thread_exit(void **cachep)
+{
+    1dd0:	55                   	push   %ebp
+    1dd1:	89 e5                	mov    %esp,%ebp
+    1dd3:	57                   	push   %edi
+    1dd4:	56                   	push   %esi
+    1dd5:	53                   	push   %ebx
+    1dd6:	83 ec 0c             	sub    $0xc,%esp
+    1dd9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct tcache *tc;
+  int c;
+
+  if((tc = *cachep) == 0)
+    1ddc:	8b 37                	mov    (%edi),%esi
+    1dde:	85 f6                	test   %esi,%esi
+    1de0:	74 41                	je     1e23 <malloc_thread_exit+0x53>
+    return;
+  for(c = 0; c < NCLASS; c++)
+    1de2:	31 db                	xor    %ebx,%ebx
+    1de4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    drain(tc, c, tc->n[c]);
+    1de8:	8b 4c 9e 20          	mov    0x20(%esi,%ebx,4),%ecx
+    1dec:	89 da                	mov    %ebx,%edx
+    1dee:	89 f0                	mov    %esi,%eax
+  for(c = 0; c < NCLASS; c++)
+    1df0:	83 c3 01             	add    $0x1,%ebx
+    drain(tc, c, tc->n[c]);
+    1df3:	e8 c8 fa ff ff       	call   18c0 <drain>
+  for(c = 0; c < NCLASS; c++)
+    1df8:	83 fb 08             	cmp    $0x8,%ebx
+    1dfb:	75 eb                	jne    1de8 <malloc_thread_exit+0x18>
+  if(threaded)
+    1dfd:	8b 15 44 31 00 00    	mov    0x3144,%edx
+    1e03:	85 d2                	test   %edx,%edx
+    1e05:	75 29                	jne    1e30 <malloc_thread_exit+0x60>
+  acquire();
+  trim(bigfree((Header*)tc - 1));
+    1e07:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1e0a:	e8 c1 f8 ff ff       	call   16d0 <bigfree>
+    1e0f:	e8 3c f9 ff ff       	call   1750 <trim>
+  if(threaded)
+    1e14:	a1 44 31 00 00       	mov    0x3144,%eax
+    1e19:	85 c0                	test   %eax,%eax
+    1e1b:	75 2b                	jne    1e48 <malloc_thread_exit+0x78>
+  release();
+  *cachep = 0;
+    1e1d:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+}
+    1e23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1e26:	5b                   	pop    %ebx
+    1e27:	5e                   	pop    %esi
+    1e28:	5f                   	pop    %edi
+    1e29:	5d                   	pop    %ebp
+    1e2a:	c3                   	ret
+    1e2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1e2f:	90                   	nop
+    mutex_lock(&lock);
+    1e30:	83 ec 0c             	sub    $0xc,%esp
+    1e33:	68 48 31 00 00       	push   $0x3148
+    1e38:	e8 b3 e6 ff ff       	call   4f0 <mutex_lock>
+}
+    1e3d:	83 c4 10             	add    $0x10,%esp
+    1e40:	eb c5                	jmp    1e07 <malloc_thread_exit+0x37>
+    1e42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1e48:	83 ec 0c             	sub    $0xc,%esp
+    1e4b:	68 48 31 00 00       	push   $0x3148
+    1e50:	e8 eb e6 ff ff       	call   540 <mutex_unlock>
+}
+    1e55:	83 c4 10             	add    $0x10,%esp
+    1e58:	eb c3                	jmp    1e1d <malloc_thread_exit+0x4d>
+    1e5a:	66 90                	xchg   %ax,%ax
+    1e5c:	66 90                	xchg   %ax,%ax
+    1e5e:	66 90                	xchg   %ax,%ax
+
+00001e60 <thread_create>:
+
+// Start fn(arg) in a new thread on a freshly allocated
+// page-aligned stack.  Returns the thread's pid.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1e60:	55                   	push   %ebp
+    1e61:	89 e5                	mov    %esp,%ebp
+    1e63:	53                   	push   %ebx
+    1e64:	83 ec 14             	sub    $0x14,%esp
+  char *mem, *stack;
+  int pid;
+
+  malloc_threaded();
+    1e67:	e8 24 ff ff ff       	call   1d90 <malloc_threaded>
+  stdio_threaded();
+    1e6c:	e8 cf ee ff ff       	call   d40 <stdio_threaded>
+  if((mem = malloc(2*PGSIZE)) == 0)
+    1e71:	83 ec 0c             	sub    $0xc,%esp
+    1e74:	68 00 20 00 00       	push   $0x2000
+    1e79:	e8 b2 fc ff ff       	call   1b30 <malloc>
+    1e7e:	83 c4 10             	add    $0x10,%esp
+    1e81:	85 c0                	test   %eax,%eax
+    1e83:	74 52                	je     1ed7 <thread_create+0x77>
+    1e85:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1e87:	8d 80 07 10 00 00    	lea    0x1007(%eax),%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+  ((char**)stack)[-2] = 0;
+  if((pid = clone(fn, arg, stack)) < 0)
+    1e8d:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1e90:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+    1e95:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  ((char**)stack)[-2] = 0;
+    1e98:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+  if((pid = clone(fn, arg, stack)) < 0)
+    1e9f:	50                   	push   %eax
+    1ea0:	ff 75 0c             	push   0xc(%ebp)
+    1ea3:	ff 75 08             	push   0x8(%ebp)
+    1ea6:	e8 97 e8 ff ff       	call   742 <clone>
+    1eab:	83 c4 10             	add    $0x10,%esp
+    1eae:	85 c0                	test   %eax,%eax
+    1eb0:	78 0e                	js     1ec0 <thread_create+0x60>
+    free(mem);
+  return pid;
+}
+    1eb2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1eb5:	c9                   	leave
+    1eb6:	c3                   	ret
+    1eb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ebe:	66 90                	xchg   %ax,%ax
+    free(mem);
+    1ec0:	83 ec 0c             	sub    $0xc,%esp
+    1ec3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1ec6:	53                   	push   %ebx
+    1ec7:	e8 34 fb ff ff       	call   1a00 <free>
+    1ecc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1ecf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    1ed2:	83 c4 10             	add    $0x10,%esp
+}
+    1ed5:	c9                   	leave
+    1ed6:	c3                   	ret
+    return -1;
+    1ed7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1edc:	eb d4                	jmp    1eb2 <thread_create+0x52>
+    1ede:	66 90                	xchg   %ax,%ax
+
+00001ee0 <thread_join>:
+
+// Wait for a thread to finish and free its stack.
+int
+thread_join(void)
+{
+    1ee0:	55                   	push   %ebp
+    1ee1:	89 e5                	mov    %esp,%ebp
+    1ee3:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    1ee4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    1ee7:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    1eea:	50                   	push   %eax
+    1eeb:	e8 61 e8 ff ff       	call   751 <join>
+    1ef0:	83 c4 10             	add    $0x10,%esp
+    1ef3:	85 c0                	test   %eax,%eax
+    1ef5:	78 29                	js     1f20 <thread_join+0x40>
+    1ef7:	89 c3                	mov    %eax,%ebx
+    return -1;
+  malloc_thread_exit(&((void**)stack)[-2]);
+    1ef9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1efc:	83 ec 0c             	sub    $0xc,%esp
+    1eff:	83 e8 08             	sub    $0x8,%eax
+    1f02:	50                   	push   %eax
+    1f03:	e8 c8 fe ff ff       	call   1dd0 <malloc_thread_exit>
+  free(((char**)stack)[-1]);
+    1f08:	58                   	pop    %eax
+    1f09:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1f0c:	ff 70 fc             	push   -0x4(%eax)
+    1f0f:	e8 ec fa ff ff       	call   1a00 <free>
+  return pid;
+    1f14:	83 c4 10             	add    $0x10,%esp
+}
+    1f17:	89 d8                	mov    %ebx,%eax
+    1f19:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1f1c:	c9                   	leave
+    1f1d:	c3                   	ret
+    1f1e:	66 90                	xchg   %ax,%ax
+    return -1;
+    1f20:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    1f25:	eb f0                	jmp    1f17 <thread_join+0x37>
@@ -0,0 +1,87 @@
+// Lock contention microbenchmark.
+// Several threads share a counter and take a lock around every
+// update, first with a test-and-set lock that yields the CPU
+// while spinning and then with the futex-based mutex from ulib.c.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "x86.h"
+
+#define ITERS  5000
+#define WORK   100     // counter updates per critical section
+
+int nthread = 4;
+int usefutex;
+struct mutex mu;
+volatile uint spin;
+volatile int counter;
+
+void
+lock(void)
+{
+  if(usefutex)
+    mutex_lock(&mu);
+  else
+    while(xchg(&spin, 1) != 0)
+      yield();
+}
+
+void
+unlock(void)
+{
+  if(usefutex)
+    mutex_unlock(&mu);
+  else
+    xchg(&spin, 0);
+}
+
+void
+worker(void *arg)
+{
+  int i, j;
+
+  for(i = 0; i < ITERS; i++){
+    lock();
+    for(j = 0; j < WORK; j++)
+      counter++;
+    unlock();
+  }
+  exit();
+}
+
+void
+run(char *name)
+{
+  int i, t0, t1;
+
+  counter = 0;
+  t0 = uptime();
+  for(i = 0; i < nthread; i++){
+    if(thread_create(worker, 0) < 0){
+      printf(1, "futexbench: thread_create failed\n");
+      exit();
+    }
+  }
+  for(i = 0; i < nthread; i++)
+    thread_join();
+  t1 = uptime();
+  printf(1, "%s: %d threads, %d ticks, counter %s\n", name, nthread,
+         t1 - t0, counter == nthread*ITERS*WORK ? "ok" : "WRONG");
+}
+
+int
+main(int argc, char *argv[])
+{
+  if(argc > 1)
+    nthread = atoi(argv[1]);
+  if(nthread < 1 || nthread > 16)
+    nthread = 4;
+
+  mutex_init(&mu);
+  usefutex = 0;
+  run("spin-yield");
+  usefutex = 1;
+  run("futex");
+  exit();
+}
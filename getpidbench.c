@@ -0,0 +1,43 @@
+// System call entry benchmark.
+// Times N getpid() calls through the usys.S stub, which uses
+// SYSENTER, and through int $T_SYSCALL, the old gate path.
+// Calls per second assume the default 100 ticks per second.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "syscall.h"
+#include "traps.h"
+
+#define N 1000000
+
+int
+getpidint(void)
+{
+  int r;
+
+  asm volatile("int %1" : "=a" (r) : "i" (T_SYSCALL), "a" (SYS_getpid) : "memory");
+  return r;
+}
+
+void
+run(char *name, int (*fn)(void))
+{
+  int i, t;
+
+  t = uptime();
+  for(i = 0; i < N; i++)
+    fn();
+  t = uptime() - t;
+  if(t == 0)
+    t = 1;
+  printf(1, "%s: %d calls in %d ticks, %d calls/s\n", name, N, t, N / t * 100);
+}
+
+int
+main(void)
+{
+  run("sysenter", getpid);
+  run("int $64", getpidint);
+  exit();
+}
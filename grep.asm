@@ -0,0 +1,4410 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 18             	sub    $0x18,%esp
+      14:	8b 01                	mov    (%ecx),%eax
+      16:	8b 59 04             	mov    0x4(%ecx),%ebx
+      19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int fd, i;
+  char *pattern;
+
+  if(argc <= 1){
+      1c:	83 f8 01             	cmp    $0x1,%eax
+      1f:	7e 6f                	jle    90 <main+0x90>
+    printf(2, "usage: grep pattern [file ...]\n");
+    exit();
+  }
+  pattern = argv[1];
+      21:	8b 43 04             	mov    0x4(%ebx),%eax
+      24:	83 c3 08             	add    $0x8,%ebx
+
+  if(argc <= 2){
+      27:	83 7d e4 02          	cmpl   $0x2,-0x1c(%ebp)
+    grep(pattern, 0);
+    exit();
+  }
+
+  for(i = 2; i < argc; i++){
+      2b:	be 02 00 00 00       	mov    $0x2,%esi
+  pattern = argv[1];
+      30:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(argc <= 2){
+      33:	75 2d                	jne    62 <main+0x62>
+      35:	eb 6c                	jmp    a3 <main+0xa3>
+      37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      3e:	66 90                	xchg   %ax,%ax
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      exit();
+    }
+    grep(pattern, fd);
+      40:	83 ec 08             	sub    $0x8,%esp
+  for(i = 2; i < argc; i++){
+      43:	83 c6 01             	add    $0x1,%esi
+      46:	83 c3 04             	add    $0x4,%ebx
+    grep(pattern, fd);
+      49:	50                   	push   %eax
+      4a:	ff 75 e0             	push   -0x20(%ebp)
+      4d:	e8 9e 01 00 00       	call   1f0 <grep>
+    close(fd);
+      52:	89 3c 24             	mov    %edi,(%esp)
+      55:	e8 36 07 00 00       	call   790 <close>
+  for(i = 2; i < argc; i++){
+      5a:	83 c4 10             	add    $0x10,%esp
+      5d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+      60:	7e 29                	jle    8b <main+0x8b>
+    if((fd = open(argv[i], 0)) < 0){
+      62:	83 ec 08             	sub    $0x8,%esp
+      65:	6a 00                	push   $0x0
+      67:	ff 33                	push   (%ebx)
+      69:	e8 4f 07 00 00       	call   7bd <open>
+      6e:	83 c4 10             	add    $0x10,%esp
+      71:	89 c7                	mov    %eax,%edi
+      73:	85 c0                	test   %eax,%eax
+      75:	79 c9                	jns    40 <main+0x40>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      77:	50                   	push   %eax
+      78:	ff 33                	push   (%ebx)
+      7a:	68 68 20 00 00       	push   $0x2068
+      7f:	6a 01                	push   $0x1
+      81:	e8 3a 0b 00 00       	call   bc0 <printf>
+      exit();
+      86:	e8 75 03 00 00       	call   400 <exit>
+  }
+  exit();
+      8b:	e8 70 03 00 00       	call   400 <exit>
+    printf(2, "usage: grep pattern [file ...]\n");
+      90:	51                   	push   %ecx
+      91:	51                   	push   %ecx
+      92:	68 48 20 00 00       	push   $0x2048
+      97:	6a 02                	push   $0x2
+      99:	e8 22 0b 00 00       	call   bc0 <printf>
+    exit();
+      9e:	e8 5d 03 00 00       	call   400 <exit>
+    grep(pattern, 0);
+      a3:	52                   	push   %edx
+      a4:	52                   	push   %edx
+      a5:	6a 00                	push   $0x0
+      a7:	50                   	push   %eax
+      a8:	e8 43 01 00 00       	call   1f0 <grep>
+    exit();
+      ad:	e8 4e 03 00 00       	call   400 <exit>
+      b2:	66 90                	xchg   %ax,%ax
+      b4:	66 90                	xchg   %ax,%ax
+      b6:	66 90                	xchg   %ax,%ax
+      b8:	66 90                	xchg   %ax,%ax
+      ba:	66 90                	xchg   %ax,%ax
+      bc:	66 90                	xchg   %ax,%ax
+      be:	66 90                	xchg   %ax,%ax
+
+000000c0 <matchhere>:
+  return 0;
+}
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+      c0:	55                   	push   %ebp
+      c1:	89 e5                	mov    %esp,%ebp
+      c3:	57                   	push   %edi
+      c4:	56                   	push   %esi
+      c5:	53                   	push   %ebx
+      c6:	83 ec 0c             	sub    $0xc,%esp
+      c9:	8b 7d 08             	mov    0x8(%ebp),%edi
+      cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(re[0] == '\0')
+      cf:	0f b6 0f             	movzbl (%edi),%ecx
+      d2:	84 c9                	test   %cl,%cl
+      d4:	0f 84 96 00 00 00    	je     170 <matchhere+0xb0>
+    return 1;
+  if(re[1] == '*')
+      da:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+      de:	3c 2a                	cmp    $0x2a,%al
+      e0:	74 2d                	je     10f <matchhere+0x4f>
+      e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return matchstar(re[0], re+2, text);
+  if(re[0] == '$' && re[1] == '\0')
+    return *text == '\0';
+      e8:	0f b6 33             	movzbl (%ebx),%esi
+  if(re[0] == '$' && re[1] == '\0')
+      eb:	80 f9 24             	cmp    $0x24,%cl
+      ee:	74 50                	je     140 <matchhere+0x80>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+      f0:	89 f2                	mov    %esi,%edx
+      f2:	84 d2                	test   %dl,%dl
+      f4:	74 6e                	je     164 <matchhere+0xa4>
+      f6:	80 f9 2e             	cmp    $0x2e,%cl
+      f9:	75 65                	jne    160 <matchhere+0xa0>
+    return matchhere(re+1, text+1);
+      fb:	83 c3 01             	add    $0x1,%ebx
+      fe:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+     101:	84 c0                	test   %al,%al
+     103:	74 6b                	je     170 <matchhere+0xb0>
+     105:	89 c1                	mov    %eax,%ecx
+  if(re[1] == '*')
+     107:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+     10b:	3c 2a                	cmp    $0x2a,%al
+     10d:	75 d9                	jne    e8 <matchhere+0x28>
+    return matchstar(re[0], re+2, text);
+     10f:	8d 77 02             	lea    0x2(%edi),%esi
+     112:	0f be f9             	movsbl %cl,%edi
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+     115:	8d 76 00             	lea    0x0(%esi),%esi
+{
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+     118:	83 ec 08             	sub    $0x8,%esp
+     11b:	53                   	push   %ebx
+     11c:	56                   	push   %esi
+     11d:	e8 9e ff ff ff       	call   c0 <matchhere>
+     122:	83 c4 10             	add    $0x10,%esp
+     125:	85 c0                	test   %eax,%eax
+     127:	75 47                	jne    170 <matchhere+0xb0>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+     129:	0f be 13             	movsbl (%ebx),%edx
+     12c:	84 d2                	test   %dl,%dl
+     12e:	74 45                	je     175 <matchhere+0xb5>
+     130:	83 c3 01             	add    $0x1,%ebx
+     133:	39 fa                	cmp    %edi,%edx
+     135:	74 e1                	je     118 <matchhere+0x58>
+     137:	83 ff 2e             	cmp    $0x2e,%edi
+     13a:	74 dc                	je     118 <matchhere+0x58>
+     13c:	eb 37                	jmp    175 <matchhere+0xb5>
+     13e:	66 90                	xchg   %ax,%ax
+  if(re[0] == '$' && re[1] == '\0')
+     140:	84 c0                	test   %al,%al
+     142:	74 39                	je     17d <matchhere+0xbd>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+     144:	89 f2                	mov    %esi,%edx
+     146:	84 d2                	test   %dl,%dl
+     148:	74 1a                	je     164 <matchhere+0xa4>
+     14a:	80 fa 24             	cmp    $0x24,%dl
+     14d:	75 15                	jne    164 <matchhere+0xa4>
+    return matchhere(re+1, text+1);
+     14f:	83 c3 01             	add    $0x1,%ebx
+     152:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+     155:	89 c1                	mov    %eax,%ecx
+     157:	eb ae                	jmp    107 <matchhere+0x47>
+     159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+     160:	38 ca                	cmp    %cl,%dl
+     162:	74 97                	je     fb <matchhere+0x3b>
+}
+     164:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+     167:	31 c0                	xor    %eax,%eax
+}
+     169:	5b                   	pop    %ebx
+     16a:	5e                   	pop    %esi
+     16b:	5f                   	pop    %edi
+     16c:	5d                   	pop    %ebp
+     16d:	c3                   	ret
+     16e:	66 90                	xchg   %ax,%ax
+    return 1;
+     170:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+     175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     178:	5b                   	pop    %ebx
+     179:	5e                   	pop    %esi
+     17a:	5f                   	pop    %edi
+     17b:	5d                   	pop    %ebp
+     17c:	c3                   	ret
+    return *text == '\0';
+     17d:	89 f0                	mov    %esi,%eax
+     17f:	84 c0                	test   %al,%al
+     181:	0f 94 c0             	sete   %al
+     184:	0f b6 c0             	movzbl %al,%eax
+     187:	eb ec                	jmp    175 <matchhere+0xb5>
+     189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000190 <match>:
+{
+     190:	55                   	push   %ebp
+     191:	89 e5                	mov    %esp,%ebp
+     193:	56                   	push   %esi
+     194:	53                   	push   %ebx
+     195:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     198:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(re[0] == '^')
+     19b:	80 3b 5e             	cmpb   $0x5e,(%ebx)
+     19e:	75 11                	jne    1b1 <match+0x21>
+     1a0:	eb 2e                	jmp    1d0 <match+0x40>
+     1a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  }while(*text++ != '\0');
+     1a8:	83 c6 01             	add    $0x1,%esi
+     1ab:	80 7e ff 00          	cmpb   $0x0,-0x1(%esi)
+     1af:	74 16                	je     1c7 <match+0x37>
+    if(matchhere(re, text))
+     1b1:	83 ec 08             	sub    $0x8,%esp
+     1b4:	56                   	push   %esi
+     1b5:	53                   	push   %ebx
+     1b6:	e8 05 ff ff ff       	call   c0 <matchhere>
+     1bb:	83 c4 10             	add    $0x10,%esp
+     1be:	85 c0                	test   %eax,%eax
+     1c0:	74 e6                	je     1a8 <match+0x18>
+      return 1;
+     1c2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+     1c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     1ca:	5b                   	pop    %ebx
+     1cb:	5e                   	pop    %esi
+     1cc:	5d                   	pop    %ebp
+     1cd:	c3                   	ret
+     1ce:	66 90                	xchg   %ax,%ax
+    return matchhere(re+1, text);
+     1d0:	83 c3 01             	add    $0x1,%ebx
+     1d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     1d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     1d9:	5b                   	pop    %ebx
+     1da:	5e                   	pop    %esi
+     1db:	5d                   	pop    %ebp
+    return matchhere(re+1, text);
+     1dc:	e9 df fe ff ff       	jmp    c0 <matchhere>
+     1e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ef:	90                   	nop
+
+000001f0 <grep>:
+{
+     1f0:	55                   	push   %ebp
+     1f1:	89 e5                	mov    %esp,%ebp
+     1f3:	57                   	push   %edi
+  m = 0;
+     1f4:	31 ff                	xor    %edi,%edi
+{
+     1f6:	56                   	push   %esi
+     1f7:	53                   	push   %ebx
+     1f8:	83 ec 1c             	sub    $0x1c,%esp
+     1fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     1fe:	89 7d e0             	mov    %edi,-0x20(%ebp)
+    return matchhere(re+1, text);
+     201:	8d 43 01             	lea    0x1(%ebx),%eax
+     204:	89 45 dc             	mov    %eax,-0x24(%ebp)
+     207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     20e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+     210:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     213:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+     218:	83 ec 04             	sub    $0x4,%esp
+     21b:	29 c8                	sub    %ecx,%eax
+     21d:	50                   	push   %eax
+     21e:	8d 81 20 2c 00 00    	lea    0x2c20(%ecx),%eax
+     224:	50                   	push   %eax
+     225:	ff 75 0c             	push   0xc(%ebp)
+     228:	e8 45 05 00 00       	call   772 <read>
+     22d:	83 c4 10             	add    $0x10,%esp
+     230:	85 c0                	test   %eax,%eax
+     232:	0f 8e fd 00 00 00    	jle    335 <grep+0x145>
+    m += n;
+     238:	01 45 e0             	add    %eax,-0x20(%ebp)
+     23b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    buf[m] = '\0';
+     23e:	bf 20 2c 00 00       	mov    $0x2c20,%edi
+     243:	89 de                	mov    %ebx,%esi
+     245:	c6 81 20 2c 00 00 00 	movb   $0x0,0x2c20(%ecx)
+    while((q = strchr(p, '\n')) != 0){
+     24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     250:	83 ec 08             	sub    $0x8,%esp
+     253:	6a 0a                	push   $0xa
+     255:	57                   	push   %edi
+     256:	e8 a5 02 00 00       	call   500 <strchr>
+     25b:	83 c4 10             	add    $0x10,%esp
+     25e:	89 c2                	mov    %eax,%edx
+     260:	85 c0                	test   %eax,%eax
+     262:	0f 84 88 00 00 00    	je     2f0 <grep+0x100>
+      *q = 0;
+     268:	c6 02 00             	movb   $0x0,(%edx)
+  if(re[0] == '^')
+     26b:	80 3e 5e             	cmpb   $0x5e,(%esi)
+     26e:	74 58                	je     2c8 <grep+0xd8>
+     270:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     273:	89 d3                	mov    %edx,%ebx
+     275:	eb 12                	jmp    289 <grep+0x99>
+     277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     27e:	66 90                	xchg   %ax,%ax
+  }while(*text++ != '\0');
+     280:	83 c7 01             	add    $0x1,%edi
+     283:	80 7f ff 00          	cmpb   $0x0,-0x1(%edi)
+     287:	74 37                	je     2c0 <grep+0xd0>
+    if(matchhere(re, text))
+     289:	83 ec 08             	sub    $0x8,%esp
+     28c:	57                   	push   %edi
+     28d:	56                   	push   %esi
+     28e:	e8 2d fe ff ff       	call   c0 <matchhere>
+     293:	83 c4 10             	add    $0x10,%esp
+     296:	85 c0                	test   %eax,%eax
+     298:	74 e6                	je     280 <grep+0x90>
+        fwrite(p, 1, q+1 - p, stdout);
+     29a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     29d:	89 da                	mov    %ebx,%edx
+     29f:	8d 5b 01             	lea    0x1(%ebx),%ebx
+     2a2:	89 d8                	mov    %ebx,%eax
+        *q = '\n';
+     2a4:	c6 02 0a             	movb   $0xa,(%edx)
+        fwrite(p, 1, q+1 - p, stdout);
+     2a7:	29 f8                	sub    %edi,%eax
+     2a9:	68 5c 2b 00 00       	push   $0x2b5c
+     2ae:	50                   	push   %eax
+     2af:	6a 01                	push   $0x1
+     2b1:	57                   	push   %edi
+     2b2:	89 df                	mov    %ebx,%edi
+     2b4:	e8 67 10 00 00       	call   1320 <fwrite>
+     2b9:	83 c4 10             	add    $0x10,%esp
+     2bc:	eb 92                	jmp    250 <grep+0x60>
+     2be:	66 90                	xchg   %ax,%ax
+     2c0:	8d 7b 01             	lea    0x1(%ebx),%edi
+      p = q+1;
+     2c3:	eb 8b                	jmp    250 <grep+0x60>
+     2c5:	8d 76 00             	lea    0x0(%esi),%esi
+    return matchhere(re+1, text);
+     2c8:	83 ec 08             	sub    $0x8,%esp
+     2cb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     2ce:	57                   	push   %edi
+     2cf:	ff 75 dc             	push   -0x24(%ebp)
+     2d2:	e8 e9 fd ff ff       	call   c0 <matchhere>
+        fwrite(p, 1, q+1 - p, stdout);
+     2d7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    return matchhere(re+1, text);
+     2da:	83 c4 10             	add    $0x10,%esp
+        fwrite(p, 1, q+1 - p, stdout);
+     2dd:	8d 5a 01             	lea    0x1(%edx),%ebx
+      if(match(pattern, p)){
+     2e0:	85 c0                	test   %eax,%eax
+     2e2:	75 be                	jne    2a2 <grep+0xb2>
+        fwrite(p, 1, q+1 - p, stdout);
+     2e4:	89 df                	mov    %ebx,%edi
+     2e6:	e9 65 ff ff ff       	jmp    250 <grep+0x60>
+     2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2ef:	90                   	nop
+    if(p == buf)
+     2f0:	89 f3                	mov    %esi,%ebx
+     2f2:	81 ff 20 2c 00 00    	cmp    $0x2c20,%edi
+     2f8:	74 2f                	je     329 <grep+0x139>
+    if(m > 0){
+     2fa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     2fd:	85 c0                	test   %eax,%eax
+     2ff:	0f 8e 0b ff ff ff    	jle    210 <grep+0x20>
+      m -= p - buf;
+     305:	89 f8                	mov    %edi,%eax
+      memmove(buf, p, m);
+     307:	83 ec 04             	sub    $0x4,%esp
+      m -= p - buf;
+     30a:	2d 20 2c 00 00       	sub    $0x2c20,%eax
+     30f:	29 45 e0             	sub    %eax,-0x20(%ebp)
+     312:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      memmove(buf, p, m);
+     315:	51                   	push   %ecx
+     316:	57                   	push   %edi
+     317:	68 20 2c 00 00       	push   $0x2c20
+     31c:	e8 af 02 00 00       	call   5d0 <memmove>
+     321:	83 c4 10             	add    $0x10,%esp
+     324:	e9 e7 fe ff ff       	jmp    210 <grep+0x20>
+      m = 0;
+     329:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+     330:	e9 db fe ff ff       	jmp    210 <grep+0x20>
+}
+     335:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     338:	5b                   	pop    %ebx
+     339:	5e                   	pop    %esi
+     33a:	5f                   	pop    %edi
+     33b:	5d                   	pop    %ebp
+     33c:	c3                   	ret
+     33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <matchstar>:
+{
+     340:	55                   	push   %ebp
+     341:	89 e5                	mov    %esp,%ebp
+     343:	57                   	push   %edi
+     344:	56                   	push   %esi
+     345:	53                   	push   %ebx
+     346:	83 ec 0c             	sub    $0xc,%esp
+     349:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     34c:	8b 75 0c             	mov    0xc(%ebp),%esi
+     34f:	8b 7d 10             	mov    0x10(%ebp),%edi
+     352:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(matchhere(re, text))
+     358:	83 ec 08             	sub    $0x8,%esp
+     35b:	57                   	push   %edi
+     35c:	56                   	push   %esi
+     35d:	e8 5e fd ff ff       	call   c0 <matchhere>
+     362:	83 c4 10             	add    $0x10,%esp
+     365:	85 c0                	test   %eax,%eax
+     367:	75 1f                	jne    388 <matchstar+0x48>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+     369:	0f be 17             	movsbl (%edi),%edx
+     36c:	84 d2                	test   %dl,%dl
+     36e:	74 0c                	je     37c <matchstar+0x3c>
+     370:	83 c7 01             	add    $0x1,%edi
+     373:	39 da                	cmp    %ebx,%edx
+     375:	74 e1                	je     358 <matchstar+0x18>
+     377:	83 fb 2e             	cmp    $0x2e,%ebx
+     37a:	74 dc                	je     358 <matchstar+0x18>
+}
+     37c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     37f:	5b                   	pop    %ebx
+     380:	5e                   	pop    %esi
+     381:	5f                   	pop    %edi
+     382:	5d                   	pop    %ebp
+     383:	c3                   	ret
+     384:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     388:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 1;
+     38b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+     390:	5b                   	pop    %ebx
+     391:	5e                   	pop    %esi
+     392:	5f                   	pop    %edi
+     393:	5d                   	pop    %ebp
+     394:	c3                   	ret
+     395:	66 90                	xchg   %ax,%ax
+     397:	66 90                	xchg   %ax,%ax
+     399:	66 90                	xchg   %ax,%ax
+     39b:	66 90                	xchg   %ax,%ax
+     39d:	66 90                	xchg   %ax,%ax
+     39f:	90                   	nop
+
+000003a0 <fork>:
+int sysexit(void) __attribute__((noreturn));
+
+int
+fork(void)
+{
+  if(flushhook)
+     3a0:	a1 20 30 00 00       	mov    0x3020,%eax
+     3a5:	85 c0                	test   %eax,%eax
+     3a7:	74 17                	je     3c0 <fork+0x20>
+{
+     3a9:	55                   	push   %ebp
+     3aa:	89 e5                	mov    %esp,%ebp
+     3ac:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     3af:	ff d0                	call   *%eax
+  return sysfork();
+}
+     3b1:	c9                   	leave
+  return sysfork();
+     3b2:	e9 7f 03 00 00       	jmp    736 <sysfork>
+     3b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3be:	66 90                	xchg   %ax,%ax
+     3c0:	e9 71 03 00 00       	jmp    736 <sysfork>
+     3c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+     3d0:	55                   	push   %ebp
+  if(flushhook)
+     3d1:	a1 20 30 00 00       	mov    0x3020,%eax
+{
+     3d6:	89 e5                	mov    %esp,%ebp
+     3d8:	56                   	push   %esi
+     3d9:	53                   	push   %ebx
+     3da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     3dd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     3e0:	85 c0                	test   %eax,%eax
+     3e2:	74 02                	je     3e6 <exec+0x16>
+    flushhook();
+     3e4:	ff d0                	call   *%eax
+  return sysexec(path, argv);
+     3e6:	89 75 0c             	mov    %esi,0xc(%ebp)
+     3e9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     3ec:	5b                   	pop    %ebx
+     3ed:	5e                   	pop    %esi
+     3ee:	5d                   	pop    %ebp
+  return sysexec(path, argv);
+     3ef:	e9 ba 03 00 00       	jmp    7ae <sysexec>
+     3f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3ff:	90                   	nop
+
+00000400 <exit>:
+
+int
+exit(void)
+{
+     400:	55                   	push   %ebp
+     401:	89 e5                	mov    %esp,%ebp
+     403:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     406:	a1 20 30 00 00       	mov    0x3020,%eax
+     40b:	85 c0                	test   %eax,%eax
+     40d:	74 02                	je     411 <exit+0x11>
+    flushhook();
+     40f:	ff d0                	call   *%eax
+  sysexit();
+     411:	e8 2f 03 00 00       	call   745 <sysexit>
+     416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     41d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000420 <strcpy>:
+}
+
+char*
+strcpy(char *s, const char *t)
+{
+     420:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     421:	31 c0                	xor    %eax,%eax
+{
+     423:	89 e5                	mov    %esp,%ebp
+     425:	53                   	push   %ebx
+     426:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     429:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     42c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     430:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     434:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     437:	83 c0 01             	add    $0x1,%eax
+     43a:	84 d2                	test   %dl,%dl
+     43c:	75 f2                	jne    430 <strcpy+0x10>
+    ;
+  return os;
+}
+     43e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     441:	89 c8                	mov    %ecx,%eax
+     443:	c9                   	leave
+     444:	c3                   	ret
+     445:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     44c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000450 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     450:	55                   	push   %ebp
+     451:	89 e5                	mov    %esp,%ebp
+     453:	53                   	push   %ebx
+     454:	8b 55 08             	mov    0x8(%ebp),%edx
+     457:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     45a:	0f b6 02             	movzbl (%edx),%eax
+     45d:	84 c0                	test   %al,%al
+     45f:	75 17                	jne    478 <strcmp+0x28>
+     461:	eb 3a                	jmp    49d <strcmp+0x4d>
+     463:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     467:	90                   	nop
+     468:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     46c:	83 c2 01             	add    $0x1,%edx
+     46f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     472:	84 c0                	test   %al,%al
+     474:	74 1a                	je     490 <strcmp+0x40>
+    p++, q++;
+     476:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     478:	0f b6 19             	movzbl (%ecx),%ebx
+     47b:	38 c3                	cmp    %al,%bl
+     47d:	74 e9                	je     468 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     47f:	29 d8                	sub    %ebx,%eax
+}
+     481:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     484:	c9                   	leave
+     485:	c3                   	ret
+     486:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     48d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     490:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     494:	31 c0                	xor    %eax,%eax
+     496:	29 d8                	sub    %ebx,%eax
+}
+     498:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     49b:	c9                   	leave
+     49c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     49d:	0f b6 19             	movzbl (%ecx),%ebx
+     4a0:	31 c0                	xor    %eax,%eax
+     4a2:	eb db                	jmp    47f <strcmp+0x2f>
+     4a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4af:	90                   	nop
+
+000004b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     4b0:	55                   	push   %ebp
+     4b1:	89 e5                	mov    %esp,%ebp
+     4b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     4b6:	80 3a 00             	cmpb   $0x0,(%edx)
+     4b9:	74 15                	je     4d0 <strlen+0x20>
+     4bb:	31 c0                	xor    %eax,%eax
+     4bd:	8d 76 00             	lea    0x0(%esi),%esi
+     4c0:	83 c0 01             	add    $0x1,%eax
+     4c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     4c7:	89 c1                	mov    %eax,%ecx
+     4c9:	75 f5                	jne    4c0 <strlen+0x10>
+    ;
+  return n;
+}
+     4cb:	89 c8                	mov    %ecx,%eax
+     4cd:	5d                   	pop    %ebp
+     4ce:	c3                   	ret
+     4cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+     4d0:	31 c9                	xor    %ecx,%ecx
+}
+     4d2:	5d                   	pop    %ebp
+     4d3:	89 c8                	mov    %ecx,%eax
+     4d5:	c3                   	ret
+     4d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     4e0:	55                   	push   %ebp
+     4e1:	89 e5                	mov    %esp,%ebp
+     4e3:	57                   	push   %edi
+     4e4:	8b 55 08             	mov    0x8(%ebp),%edx
+            "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt) {
+    asm volatile("cld; rep stosb" :
+     4e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     4ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4ed:	89 d7                	mov    %edx,%edi
+     4ef:	fc                   	cld
+     4f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     4f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     4f5:	89 d0                	mov    %edx,%eax
+     4f7:	c9                   	leave
+     4f8:	c3                   	ret
+     4f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000500 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     500:	55                   	push   %ebp
+     501:	89 e5                	mov    %esp,%ebp
+     503:	8b 45 08             	mov    0x8(%ebp),%eax
+     506:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     50a:	0f b6 10             	movzbl (%eax),%edx
+     50d:	84 d2                	test   %dl,%dl
+     50f:	75 12                	jne    523 <strchr+0x23>
+     511:	eb 1d                	jmp    530 <strchr+0x30>
+     513:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     517:	90                   	nop
+     518:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     51c:	83 c0 01             	add    $0x1,%eax
+     51f:	84 d2                	test   %dl,%dl
+     521:	74 0d                	je     530 <strchr+0x30>
+    if(*s == c)
+     523:	38 d1                	cmp    %dl,%cl
+     525:	75 f1                	jne    518 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     527:	5d                   	pop    %ebp
+     528:	c3                   	ret
+     529:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     530:	31 c0                	xor    %eax,%eax
+}
+     532:	5d                   	pop    %ebp
+     533:	c3                   	ret
+     534:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     53b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     53f:	90                   	nop
+
+00000540 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     540:	55                   	push   %ebp
+     541:	89 e5                	mov    %esp,%ebp
+     543:	56                   	push   %esi
+     544:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     545:	83 ec 08             	sub    $0x8,%esp
+     548:	6a 00                	push   $0x0
+     54a:	ff 75 08             	push   0x8(%ebp)
+     54d:	e8 6b 02 00 00       	call   7bd <open>
+  if(fd < 0)
+     552:	83 c4 10             	add    $0x10,%esp
+     555:	85 c0                	test   %eax,%eax
+     557:	78 27                	js     580 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     559:	83 ec 08             	sub    $0x8,%esp
+     55c:	ff 75 0c             	push   0xc(%ebp)
+     55f:	89 c3                	mov    %eax,%ebx
+     561:	50                   	push   %eax
+     562:	e8 83 02 00 00       	call   7ea <fstat>
+  close(fd);
+     567:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     56a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     56c:	e8 1f 02 00 00       	call   790 <close>
+  return r;
+     571:	83 c4 10             	add    $0x10,%esp
+}
+     574:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     577:	89 f0                	mov    %esi,%eax
+     579:	5b                   	pop    %ebx
+     57a:	5e                   	pop    %esi
+     57b:	5d                   	pop    %ebp
+     57c:	c3                   	ret
+     57d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     580:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     585:	eb ed                	jmp    574 <stat+0x34>
+     587:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     58e:	66 90                	xchg   %ax,%ax
+
+00000590 <atoi>:
+
+int
+atoi(const char *s)
+{
+     590:	55                   	push   %ebp
+     591:	89 e5                	mov    %esp,%ebp
+     593:	53                   	push   %ebx
+     594:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     597:	0f be 02             	movsbl (%edx),%eax
+     59a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     59d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     5a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     5a5:	77 1e                	ja     5c5 <atoi+0x35>
+     5a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     5b0:	83 c2 01             	add    $0x1,%edx
+     5b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     5b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     5ba:	0f be 02             	movsbl (%edx),%eax
+     5bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     5c0:	80 fb 09             	cmp    $0x9,%bl
+     5c3:	76 eb                	jbe    5b0 <atoi+0x20>
+  return n;
+}
+     5c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5c8:	89 c8                	mov    %ecx,%eax
+     5ca:	c9                   	leave
+     5cb:	c3                   	ret
+     5cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005d0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     5d0:	55                   	push   %ebp
+     5d1:	89 e5                	mov    %esp,%ebp
+     5d3:	57                   	push   %edi
+     5d4:	56                   	push   %esi
+     5d5:	8b 45 10             	mov    0x10(%ebp),%eax
+     5d8:	8b 55 08             	mov    0x8(%ebp),%edx
+     5db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     5de:	85 c0                	test   %eax,%eax
+     5e0:	7e 13                	jle    5f5 <memmove+0x25>
+     5e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     5e4:	89 d7                	mov    %edx,%edi
+     5e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     5f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     5f1:	39 f8                	cmp    %edi,%eax
+     5f3:	75 fb                	jne    5f0 <memmove+0x20>
+  return vdst;
+}
+     5f5:	5e                   	pop    %esi
+     5f6:	89 d0                	mov    %edx,%eax
+     5f8:	5f                   	pop    %edi
+     5f9:	5d                   	pop    %ebp
+     5fa:	c3                   	ret
+     5fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5ff:	90                   	nop
+
+00000600 <mutex_init>:
+
+// Futex-based mutex (Drepper, "Futexes Are Tricky", mutex 2).
+// The uncontended paths never enter the kernel.
+void
+mutex_init(struct mutex *m)
+{
+     600:	55                   	push   %ebp
+     601:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+     603:	8b 45 08             	mov    0x8(%ebp),%eax
+     606:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     60c:	5d                   	pop    %ebp
+     60d:	c3                   	ret
+     60e:	66 90                	xchg   %ax,%ax
+
+00000610 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     610:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     611:	31 c0                	xor    %eax,%eax
+     613:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+     618:	89 e5                	mov    %esp,%ebp
+     61a:	56                   	push   %esi
+     61b:	53                   	push   %ebx
+     61c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     61f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     623:	85 c0                	test   %eax,%eax
+     625:	74 32                	je     659 <mutex_lock+0x49>
+    return;
+  if(c != 2)
+     627:	83 f8 02             	cmp    $0x2,%eax
+     62a:	74 0c                	je     638 <mutex_lock+0x28>
+static inline uint
+xchg(volatile uint *addr, uint newval) {
+    uint result;
+
+    // The + in "+m" denotes a read-modify-write operand.
+    asm volatile("lock; xchgl %0, %1" :
+     62c:	b8 02 00 00 00       	mov    $0x2,%eax
+     631:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+     634:	85 c0                	test   %eax,%eax
+     636:	74 21                	je     659 <mutex_lock+0x49>
+     638:	be 02 00 00 00       	mov    $0x2,%esi
+     63d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAIT, 2);
+     640:	83 ec 04             	sub    $0x4,%esp
+     643:	6a 02                	push   $0x2
+     645:	6a 00                	push   $0x0
+     647:	53                   	push   %ebx
+     648:	e8 33 02 00 00       	call   880 <futex>
+     64d:	89 f0                	mov    %esi,%eax
+     64f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     652:	83 c4 10             	add    $0x10,%esp
+     655:	85 c0                	test   %eax,%eax
+     657:	75 e7                	jne    640 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+     659:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     65c:	5b                   	pop    %ebx
+     65d:	5e                   	pop    %esi
+     65e:	5d                   	pop    %ebp
+     65f:	c3                   	ret
+
+00000660 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     660:	55                   	push   %ebp
+     661:	89 e5                	mov    %esp,%ebp
+     663:	83 ec 08             	sub    $0x8,%esp
+     666:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     669:	f0 83 28 01          	lock subl $0x1,(%eax)
+     66d:	75 09                	jne    678 <mutex_unlock+0x18>
+    m->val = 0;
+    futex(&m->val, FUTEX_WAKE, 1);
+  }
+}
+     66f:	c9                   	leave
+     670:	c3                   	ret
+     671:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     678:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     67b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex(&m->val, FUTEX_WAKE, 1);
+     681:	6a 01                	push   $0x1
+     683:	6a 01                	push   $0x1
+     685:	50                   	push   %eax
+     686:	e8 f5 01 00 00       	call   880 <futex>
+     68b:	83 c4 10             	add    $0x10,%esp
+}
+     68e:	c9                   	leave
+     68f:	c3                   	ret
+
+00000690 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     690:	55                   	push   %ebp
+     691:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     693:	8b 45 08             	mov    0x8(%ebp),%eax
+     696:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     69c:	5d                   	pop    %ebp
+     69d:	c3                   	ret
+     69e:	66 90                	xchg   %ax,%ax
+
+000006a0 <cond_wait>:
+
+// Release m and wait for a signal, then reacquire m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     6a0:	55                   	push   %ebp
+     6a1:	89 e5                	mov    %esp,%ebp
+     6a3:	57                   	push   %edi
+     6a4:	56                   	push   %esi
+     6a5:	53                   	push   %ebx
+     6a6:	83 ec 0c             	sub    $0xc,%esp
+     6a9:	8b 75 08             	mov    0x8(%ebp),%esi
+     6ac:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     6af:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     6b1:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+     6b5:	75 21                	jne    6d8 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     6b7:	83 ec 04             	sub    $0x4,%esp
+     6ba:	57                   	push   %edi
+     6bb:	6a 00                	push   $0x0
+     6bd:	56                   	push   %esi
+     6be:	e8 bd 01 00 00       	call   880 <futex>
+  mutex_lock(m);
+     6c3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     6c6:	83 c4 10             	add    $0x10,%esp
+}
+     6c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6cc:	5b                   	pop    %ebx
+     6cd:	5e                   	pop    %esi
+     6ce:	5f                   	pop    %edi
+     6cf:	5d                   	pop    %ebp
+  mutex_lock(m);
+     6d0:	e9 3b ff ff ff       	jmp    610 <mutex_lock>
+     6d5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     6d8:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     6db:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex(&m->val, FUTEX_WAKE, 1);
+     6e1:	6a 01                	push   $0x1
+     6e3:	6a 01                	push   $0x1
+     6e5:	53                   	push   %ebx
+     6e6:	e8 95 01 00 00       	call   880 <futex>
+     6eb:	83 c4 10             	add    $0x10,%esp
+     6ee:	eb c7                	jmp    6b7 <cond_wait+0x17>
+
+000006f0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+     6f0:	55                   	push   %ebp
+     6f1:	89 e5                	mov    %esp,%ebp
+     6f3:	83 ec 0c             	sub    $0xc,%esp
+     6f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     6f9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+     6fd:	6a 01                	push   $0x1
+     6ff:	6a 01                	push   $0x1
+     701:	50                   	push   %eax
+     702:	e8 79 01 00 00       	call   880 <futex>
+}
+     707:	83 c4 10             	add    $0x10,%esp
+     70a:	c9                   	leave
+     70b:	c3                   	ret
+     70c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000710 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     710:	55                   	push   %ebp
+     711:	89 e5                	mov    %esp,%ebp
+     713:	83 ec 0c             	sub    $0xc,%esp
+     716:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     719:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+     71d:	6a 40                	push   $0x40
+     71f:	6a 01                	push   $0x1
+     721:	50                   	push   %eax
+     722:	e8 59 01 00 00       	call   880 <futex>
+}
+     727:	83 c4 10             	add    $0x10,%esp
+     72a:	c9                   	leave
+     72b:	c3                   	ret
+     72c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000730 <uptime>:
+// Clock ticks since boot, read from the kernel's vdso page
+// without a system call.
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     730:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+     735:	c3                   	ret
+
+00000736 <sysfork>:
+  1: ret
+
+#define SYSCALL(name) SYSCALLAS(name, name)
+
+// ulib.c wraps these.
+SYSCALLAS(sysfork, fork)
+     736:	b8 01 00 00 00       	mov    $0x1,%eax
+     73b:	89 e1                	mov    %esp,%ecx
+     73d:	ba 44 07 00 00       	mov    $0x744,%edx
+     742:	0f 34                	sysenter
+     744:	c3                   	ret
+
+00000745 <sysexit>:
+SYSCALLAS(sysexit, exit)
+     745:	b8 02 00 00 00       	mov    $0x2,%eax
+     74a:	89 e1                	mov    %esp,%ecx
+     74c:	ba 53 07 00 00       	mov    $0x753,%edx
+     751:	0f 34                	sysenter
+     753:	c3                   	ret
+
+00000754 <wait>:
+SYSCALL(wait)
+     754:	b8 03 00 00 00       	mov    $0x3,%eax
+     759:	89 e1                	mov    %esp,%ecx
+     75b:	ba 62 07 00 00       	mov    $0x762,%edx
+     760:	0f 34                	sysenter
+     762:	c3                   	ret
+
+00000763 <pipe>:
+SYSCALL(pipe)
+     763:	b8 04 00 00 00       	mov    $0x4,%eax
+     768:	89 e1                	mov    %esp,%ecx
+     76a:	ba 71 07 00 00       	mov    $0x771,%edx
+     76f:	0f 34                	sysenter
+     771:	c3                   	ret
+
+00000772 <read>:
+SYSCALL(read)
+     772:	b8 05 00 00 00       	mov    $0x5,%eax
+     777:	89 e1                	mov    %esp,%ecx
+     779:	ba 80 07 00 00       	mov    $0x780,%edx
+     77e:	0f 34                	sysenter
+     780:	c3                   	ret
+
+00000781 <write>:
+SYSCALL(write)
+     781:	b8 10 00 00 00       	mov    $0x10,%eax
+     786:	89 e1                	mov    %esp,%ecx
+     788:	ba 8f 07 00 00       	mov    $0x78f,%edx
+     78d:	0f 34                	sysenter
+     78f:	c3                   	ret
+
+00000790 <close>:
+SYSCALL(close)
+     790:	b8 15 00 00 00       	mov    $0x15,%eax
+     795:	89 e1                	mov    %esp,%ecx
+     797:	ba 9e 07 00 00       	mov    $0x79e,%edx
+     79c:	0f 34                	sysenter
+     79e:	c3                   	ret
+
+0000079f <kill>:
+SYSCALL(kill)
+     79f:	b8 06 00 00 00       	mov    $0x6,%eax
+     7a4:	89 e1                	mov    %esp,%ecx
+     7a6:	ba ad 07 00 00       	mov    $0x7ad,%edx
+     7ab:	0f 34                	sysenter
+     7ad:	c3                   	ret
+
+000007ae <sysexec>:
+SYSCALLAS(sysexec, exec)
+     7ae:	b8 07 00 00 00       	mov    $0x7,%eax
+     7b3:	89 e1                	mov    %esp,%ecx
+     7b5:	ba bc 07 00 00       	mov    $0x7bc,%edx
+     7ba:	0f 34                	sysenter
+     7bc:	c3                   	ret
+
+000007bd <open>:
+SYSCALL(open)
+     7bd:	b8 0f 00 00 00       	mov    $0xf,%eax
+     7c2:	89 e1                	mov    %esp,%ecx
+     7c4:	ba cb 07 00 00       	mov    $0x7cb,%edx
+     7c9:	0f 34                	sysenter
+     7cb:	c3                   	ret
+
+000007cc <mknod>:
+SYSCALL(mknod)
+     7cc:	b8 11 00 00 00       	mov    $0x11,%eax
+     7d1:	89 e1                	mov    %esp,%ecx
+     7d3:	ba da 07 00 00       	mov    $0x7da,%edx
+     7d8:	0f 34                	sysenter
+     7da:	c3                   	ret
+
+000007db <unlink>:
+SYSCALL(unlink)
+     7db:	b8 12 00 00 00       	mov    $0x12,%eax
+     7e0:	89 e1                	mov    %esp,%ecx
+     7e2:	ba e9 07 00 00       	mov    $0x7e9,%edx
+     7e7:	0f 34                	sysenter
+     7e9:	c3                   	ret
+
+000007ea <fstat>:
+SYSCALL(fstat)
+     7ea:	b8 08 00 00 00       	mov    $0x8,%eax
+     7ef:	89 e1                	mov    %esp,%ecx
+     7f1:	ba f8 07 00 00       	mov    $0x7f8,%edx
+     7f6:	0f 34                	sysenter
+     7f8:	c3                   	ret
+
+000007f9 <link>:
+SYSCALL(link)
+     7f9:	b8 13 00 00 00       	mov    $0x13,%eax
+     7fe:	89 e1                	mov    %esp,%ecx
+     800:	ba 07 08 00 00       	mov    $0x807,%edx
+     805:	0f 34                	sysenter
+     807:	c3                   	ret
+
+00000808 <mkdir>:
+SYSCALL(mkdir)
+     808:	b8 14 00 00 00       	mov    $0x14,%eax
+     80d:	89 e1                	mov    %esp,%ecx
+     80f:	ba 16 08 00 00       	mov    $0x816,%edx
+     814:	0f 34                	sysenter
+     816:	c3                   	ret
+
+00000817 <chdir>:
+SYSCALL(chdir)
+     817:	b8 09 00 00 00       	mov    $0x9,%eax
+     81c:	89 e1                	mov    %esp,%ecx
+     81e:	ba 25 08 00 00       	mov    $0x825,%edx
+     823:	0f 34                	sysenter
+     825:	c3                   	ret
+
+00000826 <dup>:
+SYSCALL(dup)
+     826:	b8 0a 00 00 00       	mov    $0xa,%eax
+     82b:	89 e1                	mov    %esp,%ecx
+     82d:	ba 34 08 00 00       	mov    $0x834,%edx
+     832:	0f 34                	sysenter
+     834:	c3                   	ret
+
+00000835 <getpid>:
+SYSCALL(getpid)
+     835:	b8 0b 00 00 00       	mov    $0xb,%eax
+     83a:	89 e1                	mov    %esp,%ecx
+     83c:	ba 43 08 00 00       	mov    $0x843,%edx
+     841:	0f 34                	sysenter
+     843:	c3                   	ret
+
+00000844 <sbrk>:
+SYSCALL(sbrk)
+     844:	b8 0c 00 00 00       	mov    $0xc,%eax
+     849:	89 e1                	mov    %esp,%ecx
+     84b:	ba 52 08 00 00       	mov    $0x852,%edx
+     850:	0f 34                	sysenter
+     852:	c3                   	ret
+
+00000853 <sleep>:
+SYSCALL(sleep)
+     853:	b8 0d 00 00 00       	mov    $0xd,%eax
+     858:	89 e1                	mov    %esp,%ecx
+     85a:	ba 61 08 00 00       	mov    $0x861,%edx
+     85f:	0f 34                	sysenter
+     861:	c3                   	ret
+
+00000862 <clone>:
+SYSCALL(clone)
+     862:	b8 16 00 00 00       	mov    $0x16,%eax
+     867:	89 e1                	mov    %esp,%ecx
+     869:	ba 70 08 00 00       	mov    $0x870,%edx
+     86e:	0f 34                	sysenter
+     870:	c3                   	ret
+
+00000871 <join>:
+SYSCALL(join)
+     871:	b8 17 00 00 00       	mov    $0x17,%eax
+     876:	89 e1                	mov    %esp,%ecx
+     878:	ba 7f 08 00 00       	mov    $0x87f,%edx
+     87d:	0f 34                	sysenter
+     87f:	c3                   	ret
+
+00000880 <futex>:
+SYSCALL(futex)
+     880:	b8 18 00 00 00       	mov    $0x18,%eax
+     885:	89 e1                	mov    %esp,%ecx
+     887:	ba 8e 08 00 00       	mov    $0x88e,%edx
+     88c:	0f 34                	sysenter
+     88e:	c3                   	ret
+
+0000088f <yield>:
+SYSCALL(yield)
+     88f:	b8 19 00 00 00       	mov    $0x19,%eax
+     894:	89 e1                	mov    %esp,%ecx
+     896:	ba 9d 08 00 00       	mov    $0x89d,%edx
+     89b:	0f 34                	sysenter
+     89d:	c3                   	ret
+
+0000089e <lockstat>:
+SYSCALL(lockstat)
+     89e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     8a3:	89 e1                	mov    %esp,%ecx
+     8a5:	ba ac 08 00 00       	mov    $0x8ac,%edx
+     8aa:	0f 34                	sysenter
+     8ac:	c3                   	ret
+
+000008ad <lockhammer>:
+SYSCALL(lockhammer)
+     8ad:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     8b2:	89 e1                	mov    %esp,%ecx
+     8b4:	ba bb 08 00 00       	mov    $0x8bb,%edx
+     8b9:	0f 34                	sysenter
+     8bb:	c3                   	ret
+
+000008bc <vmsplice>:
+SYSCALL(vmsplice)
+     8bc:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     8c1:	89 e1                	mov    %esp,%ecx
+     8c3:	ba ca 08 00 00       	mov    $0x8ca,%edx
+     8c8:	0f 34                	sysenter
+     8ca:	c3                   	ret
+
+000008cb <hsbrk>:
+SYSCALL(hsbrk)
+     8cb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     8d0:	89 e1                	mov    %esp,%ecx
+     8d2:	ba d9 08 00 00       	mov    $0x8d9,%edx
+     8d7:	0f 34                	sysenter
+     8d9:	c3                   	ret
+
+000008da <mmap>:
+SYSCALL(mmap)
+     8da:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     8df:	89 e1                	mov    %esp,%ecx
+     8e1:	ba e8 08 00 00       	mov    $0x8e8,%edx
+     8e6:	0f 34                	sysenter
+     8e8:	c3                   	ret
+
+000008e9 <munmap>:
+SYSCALL(munmap)
+     8e9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     8ee:	89 e1                	mov    %esp,%ecx
+     8f0:	ba f7 08 00 00       	mov    $0x8f7,%edx
+     8f5:	0f 34                	sysenter
+     8f7:	c3                   	ret
+
+000008f8 <ringenter>:
+SYSCALL(ringenter)
+     8f8:	b8 20 00 00 00       	mov    $0x20,%eax
+     8fd:	89 e1                	mov    %esp,%ecx
+     8ff:	ba 06 09 00 00       	mov    $0x906,%edx
+     904:	0f 34                	sysenter
+     906:	c3                   	ret
+
+00000907 <readv>:
+SYSCALL(readv)
+     907:	b8 21 00 00 00       	mov    $0x21,%eax
+     90c:	89 e1                	mov    %esp,%ecx
+     90e:	ba 15 09 00 00       	mov    $0x915,%edx
+     913:	0f 34                	sysenter
+     915:	c3                   	ret
+
+00000916 <writev>:
+SYSCALL(writev)
+     916:	b8 22 00 00 00       	mov    $0x22,%eax
+     91b:	89 e1                	mov    %esp,%ecx
+     91d:	ba 24 09 00 00       	mov    $0x924,%edx
+     922:	0f 34                	sysenter
+     924:	c3                   	ret
+
+00000925 <pread>:
+SYSCALL(pread)
+     925:	b8 23 00 00 00       	mov    $0x23,%eax
+     92a:	89 e1                	mov    %esp,%ecx
+     92c:	ba 33 09 00 00       	mov    $0x933,%edx
+     931:	0f 34                	sysenter
+     933:	c3                   	ret
+
+00000934 <pwrite>:
+SYSCALL(pwrite)
+     934:	b8 24 00 00 00       	mov    $0x24,%eax
+     939:	89 e1                	mov    %esp,%ecx
+     93b:	ba 42 09 00 00       	mov    $0x942,%edx
+     940:	0f 34                	sysenter
+     942:	c3                   	ret
+
+00000943 <prof>:
+SYSCALL(prof)
+     943:	b8 25 00 00 00       	mov    $0x25,%eax
+     948:	89 e1                	mov    %esp,%ecx
+     94a:	ba 51 09 00 00       	mov    $0x951,%edx
+     94f:	0f 34                	sysenter
+     951:	c3                   	ret
+
+00000952 <scstat>:
+SYSCALL(scstat)
+     952:	b8 26 00 00 00       	mov    $0x26,%eax
+     957:	89 e1                	mov    %esp,%ecx
+     959:	ba 60 09 00 00       	mov    $0x960,%edx
+     95e:	0f 34                	sysenter
+     960:	c3                   	ret
+     961:	66 90                	xchg   %ax,%ax
+     963:	66 90                	xchg   %ax,%ax
+     965:	66 90                	xchg   %ax,%ax
+     967:	66 90                	xchg   %ax,%ax
+     969:	66 90                	xchg   %ax,%ax
+     96b:	66 90                	xchg   %ax,%ax
+     96d:	66 90                	xchg   %ax,%ax
+     96f:	90                   	nop
+
+00000970 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+     970:	55                   	push   %ebp
+     971:	89 e5                	mov    %esp,%ebp
+     973:	57                   	push   %edi
+     974:	56                   	push   %esi
+     975:	53                   	push   %ebx
+     976:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     978:	89 d1                	mov    %edx,%ecx
+{
+     97a:	83 ec 2c             	sub    $0x2c,%esp
+     97d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+     980:	85 d2                	test   %edx,%edx
+     982:	79 7c                	jns    a00 <printint+0x90>
+     984:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     988:	74 76                	je     a00 <printint+0x90>
+    x = -xx;
+     98a:	f7 d9                	neg    %ecx
+    neg = 1;
+     98c:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     991:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     994:	31 f6                	xor    %esi,%esi
+     996:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     99d:	8d 76 00             	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     9a0:	89 c8                	mov    %ecx,%eax
+     9a2:	31 d2                	xor    %edx,%edx
+     9a4:	89 f7                	mov    %esi,%edi
+     9a6:	f7 f3                	div    %ebx
+     9a8:	8d 76 01             	lea    0x1(%esi),%esi
+     9ab:	0f b6 92 e0 20 00 00 	movzbl 0x20e0(%edx),%edx
+     9b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     9b6:	89 ca                	mov    %ecx,%edx
+     9b8:	89 c1                	mov    %eax,%ecx
+     9ba:	39 da                	cmp    %ebx,%edx
+     9bc:	73 e2                	jae    9a0 <printint+0x30>
+  if(neg)
+     9be:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     9c1:	85 c0                	test   %eax,%eax
+     9c3:	74 07                	je     9cc <printint+0x5c>
+    buf[i++] = '-';
+     9c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     9ca:	89 f7                	mov    %esi,%edi
+     9cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     9cf:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     9d2:	01 df                	add    %ebx,%edi
+     9d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc_unlocked(buf[i], f);
+     9d8:	83 ec 08             	sub    $0x8,%esp
+     9db:	56                   	push   %esi
+     9dc:	0f be 07             	movsbl (%edi),%eax
+     9df:	50                   	push   %eax
+     9e0:	e8 cb 07 00 00       	call   11b0 <putc_unlocked>
+  while(--i >= 0)
+     9e5:	89 f8                	mov    %edi,%eax
+     9e7:	83 c4 10             	add    $0x10,%esp
+     9ea:	83 ef 01             	sub    $0x1,%edi
+     9ed:	39 d8                	cmp    %ebx,%eax
+     9ef:	75 e7                	jne    9d8 <printint+0x68>
+}
+     9f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9f4:	5b                   	pop    %ebx
+     9f5:	5e                   	pop    %esi
+     9f6:	5f                   	pop    %edi
+     9f7:	5d                   	pop    %ebp
+     9f8:	c3                   	ret
+     9f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     a00:	31 c0                	xor    %eax,%eax
+     a02:	eb 8d                	jmp    991 <printint+0x21>
+     a04:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a0f:	90                   	nop
+
+00000a10 <vfprintf>:
+
+// Print to the given stream, which the caller has locked.
+// Only understands %d, %x, %p, %s.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+     a10:	55                   	push   %ebp
+     a11:	89 e5                	mov    %esp,%ebp
+     a13:	57                   	push   %edi
+     a14:	56                   	push   %esi
+     a15:	53                   	push   %ebx
+     a16:	83 ec 1c             	sub    $0x1c,%esp
+     a19:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     a1c:	0f b6 0a             	movzbl (%edx),%ecx
+     a1f:	84 c9                	test   %cl,%cl
+     a21:	74 5c                	je     a7f <vfprintf+0x6f>
+     a23:	89 c6                	mov    %eax,%esi
+     a25:	8d 5a 01             	lea    0x1(%edx),%ebx
+     a28:	31 ff                	xor    %edi,%edi
+     a2a:	eb 20                	jmp    a4c <vfprintf+0x3c>
+     a2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     a30:	83 f9 25             	cmp    $0x25,%ecx
+     a33:	74 3b                	je     a70 <vfprintf+0x60>
+        state = '%';
+      } else {
+        putc_unlocked(c, f);
+     a35:	83 ec 08             	sub    $0x8,%esp
+     a38:	56                   	push   %esi
+     a39:	51                   	push   %ecx
+     a3a:	e8 71 07 00 00       	call   11b0 <putc_unlocked>
+     a3f:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     a42:	0f b6 0b             	movzbl (%ebx),%ecx
+     a45:	83 c3 01             	add    $0x1,%ebx
+     a48:	84 c9                	test   %cl,%cl
+     a4a:	74 33                	je     a7f <vfprintf+0x6f>
+    if(state == 0){
+     a4c:	85 ff                	test   %edi,%edi
+     a4e:	74 e0                	je     a30 <vfprintf+0x20>
+      }
+    } else if(state == '%'){
+     a50:	83 ff 25             	cmp    $0x25,%edi
+     a53:	75 ed                	jne    a42 <vfprintf+0x32>
+      if(c == 'd'){
+     a55:	83 f9 25             	cmp    $0x25,%ecx
+     a58:	0f 84 02 01 00 00    	je     b60 <vfprintf+0x150>
+     a5e:	8d 41 9d             	lea    -0x63(%ecx),%eax
+     a61:	83 f8 15             	cmp    $0x15,%eax
+     a64:	77 2a                	ja     a90 <vfprintf+0x80>
+     a66:	ff 24 85 88 20 00 00 	jmp    *0x2088(,%eax,4)
+     a6d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     a70:	0f b6 0b             	movzbl (%ebx),%ecx
+     a73:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     a76:	bf 25 00 00 00       	mov    $0x25,%edi
+  for(i = 0; fmt[i]; i++){
+     a7b:	84 c9                	test   %cl,%cl
+     a7d:	75 cd                	jne    a4c <vfprintf+0x3c>
+        putc_unlocked(c, f);
+      }
+      state = 0;
+    }
+  }
+}
+     a7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a82:	5b                   	pop    %ebx
+     a83:	5e                   	pop    %esi
+     a84:	5f                   	pop    %edi
+     a85:	5d                   	pop    %ebp
+     a86:	c3                   	ret
+     a87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a8e:	66 90                	xchg   %ax,%ax
+        putc_unlocked('%', f);
+     a90:	83 ec 08             	sub    $0x8,%esp
+     a93:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     a96:	56                   	push   %esi
+     a97:	6a 25                	push   $0x25
+     a99:	e8 12 07 00 00       	call   11b0 <putc_unlocked>
+        putc_unlocked(c, f);
+     a9e:	58                   	pop    %eax
+     a9f:	5a                   	pop    %edx
+     aa0:	56                   	push   %esi
+     aa1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     aa4:	51                   	push   %ecx
+     aa5:	e8 06 07 00 00       	call   11b0 <putc_unlocked>
+     aaa:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     aad:	31 ff                	xor    %edi,%edi
+     aaf:	eb 91                	jmp    a42 <vfprintf+0x32>
+     ab1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+     ab8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     abb:	83 ec 0c             	sub    $0xc,%esp
+     abe:	b9 10 00 00 00       	mov    $0x10,%ecx
+     ac3:	8b 17                	mov    (%edi),%edx
+     ac5:	6a 00                	push   $0x0
+        ap++;
+     ac7:	83 c7 04             	add    $0x4,%edi
+        printint(f, *ap, 16, 0);
+     aca:	89 f0                	mov    %esi,%eax
+     acc:	e8 9f fe ff ff       	call   970 <printint>
+        ap++;
+     ad1:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     ad4:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     ad7:	31 ff                	xor    %edi,%edi
+     ad9:	e9 64 ff ff ff       	jmp    a42 <vfprintf+0x32>
+     ade:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     ae0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     ae3:	8b 10                	mov    (%eax),%edx
+        ap++;
+     ae5:	83 c0 04             	add    $0x4,%eax
+     ae8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     aeb:	85 d2                	test   %edx,%edx
+     aed:	0f 84 85 00 00 00    	je     b78 <vfprintf+0x168>
+        while(*s != 0){
+     af3:	0f be 02             	movsbl (%edx),%eax
+        s = (char*)*ap;
+     af6:	89 d7                	mov    %edx,%edi
+        while(*s != 0){
+     af8:	84 c0                	test   %al,%al
+     afa:	74 b1                	je     aad <vfprintf+0x9d>
+     afc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+          putc_unlocked(*s, f);
+     b00:	83 ec 08             	sub    $0x8,%esp
+          s++;
+     b03:	83 c7 01             	add    $0x1,%edi
+          putc_unlocked(*s, f);
+     b06:	56                   	push   %esi
+     b07:	50                   	push   %eax
+     b08:	e8 a3 06 00 00       	call   11b0 <putc_unlocked>
+        while(*s != 0){
+     b0d:	0f be 07             	movsbl (%edi),%eax
+     b10:	83 c4 10             	add    $0x10,%esp
+     b13:	84 c0                	test   %al,%al
+     b15:	75 e9                	jne    b00 <vfprintf+0xf0>
+      state = 0;
+     b17:	31 ff                	xor    %edi,%edi
+     b19:	e9 24 ff ff ff       	jmp    a42 <vfprintf+0x32>
+     b1e:	66 90                	xchg   %ax,%ax
+        printint(f, *ap, 10, 1);
+     b20:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     b23:	83 ec 0c             	sub    $0xc,%esp
+     b26:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     b2b:	8b 17                	mov    (%edi),%edx
+     b2d:	6a 01                	push   $0x1
+     b2f:	eb 96                	jmp    ac7 <vfprintf+0xb7>
+     b31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc_unlocked(*ap, f);
+     b38:	83 ec 08             	sub    $0x8,%esp
+     b3b:	56                   	push   %esi
+     b3c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     b3f:	ff 37                	push   (%edi)
+     b41:	e8 6a 06 00 00       	call   11b0 <putc_unlocked>
+        ap++;
+     b46:	89 f8                	mov    %edi,%eax
+     b48:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     b4b:	31 ff                	xor    %edi,%edi
+        ap++;
+     b4d:	83 c0 04             	add    $0x4,%eax
+     b50:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     b53:	e9 ea fe ff ff       	jmp    a42 <vfprintf+0x32>
+     b58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b5f:	90                   	nop
+        putc_unlocked(c, f);
+     b60:	83 ec 08             	sub    $0x8,%esp
+      state = 0;
+     b63:	31 ff                	xor    %edi,%edi
+        putc_unlocked(c, f);
+     b65:	56                   	push   %esi
+     b66:	6a 25                	push   $0x25
+     b68:	e8 43 06 00 00       	call   11b0 <putc_unlocked>
+     b6d:	83 c4 10             	add    $0x10,%esp
+     b70:	e9 cd fe ff ff       	jmp    a42 <vfprintf+0x32>
+     b75:	8d 76 00             	lea    0x0(%esi),%esi
+     b78:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     b7d:	bf 7e 20 00 00       	mov    $0x207e,%edi
+     b82:	e9 79 ff ff ff       	jmp    b00 <vfprintf+0xf0>
+     b87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b8e:	66 90                	xchg   %ax,%ax
+
+00000b90 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+     b90:	55                   	push   %ebp
+     b91:	89 e5                	mov    %esp,%ebp
+     b93:	53                   	push   %ebx
+     b94:	83 ec 10             	sub    $0x10,%esp
+     b97:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  flockfile(f);
+     b9a:	53                   	push   %ebx
+     b9b:	e8 d0 02 00 00       	call   e70 <flockfile>
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     ba0:	8b 55 0c             	mov    0xc(%ebp),%edx
+     ba3:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     ba6:	89 d8                	mov    %ebx,%eax
+     ba8:	e8 63 fe ff ff       	call   a10 <vfprintf>
+  funlockfile(f);
+     bad:	89 1c 24             	mov    %ebx,(%esp)
+     bb0:	e8 eb 02 00 00       	call   ea0 <funlockfile>
+}
+     bb5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     bb8:	83 c4 10             	add    $0x10,%esp
+     bbb:	c9                   	leave
+     bbc:	c3                   	ret
+     bbd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000bc0 <printf>:
+
+// Print to the given fd: through stdout or stderr for 1 and 2,
+// otherwise with one write() per call.
+void
+printf(int fd, const char *fmt, ...)
+{
+     bc0:	55                   	push   %ebp
+     bc1:	89 e5                	mov    %esp,%ebp
+     bc3:	56                   	push   %esi
+     bc4:	53                   	push   %ebx
+     bc5:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+     bcb:	8b 45 08             	mov    0x8(%ebp),%eax
+  char buf[128];
+  struct iobuf f;
+
+  if(fd == 1 || fd == 2){
+    flockfile(&_iob[fd]);
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     bce:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(fd == 1 || fd == 2){
+     bd1:	8d 50 ff             	lea    -0x1(%eax),%edx
+     bd4:	83 fa 01             	cmp    $0x1,%edx
+     bd7:	76 77                	jbe    c50 <printf+0x90>
+    funlockfile(&_iob[fd]);
+    return;
+  }
+  f.fd = fd;
+     bd9:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  f.flags = IO_WRITE|IO_SETUP;
+  f.buf = buf;
+     bdf:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  f.size = sizeof(buf);
+  f.r = f.n = 0;
+  mutex_init(&f.lock);
+     be5:	83 ec 0c             	sub    $0xc,%esp
+     be8:	8d 9d 5c ff ff ff    	lea    -0xa4(%ebp),%ebx
+  f.buf = buf;
+     bee:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+  mutex_init(&f.lock);
+     bf4:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  f.flags = IO_WRITE|IO_SETUP;
+     bfa:	c7 85 60 ff ff ff 42 	movl   $0x42,-0xa0(%ebp)
+     c01:	00 00 00 
+  f.size = sizeof(buf);
+     c04:	c7 85 68 ff ff ff 80 	movl   $0x80,-0x98(%ebp)
+     c0b:	00 00 00 
+  f.r = f.n = 0;
+     c0e:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+     c15:	00 00 00 
+     c18:	c7 85 6c ff ff ff 00 	movl   $0x0,-0x94(%ebp)
+     c1f:	00 00 00 
+  mutex_init(&f.lock);
+     c22:	50                   	push   %eax
+     c23:	e8 d8 f9 ff ff       	call   600 <mutex_init>
+  vfprintf(&f, fmt, (uint*)(void*)&fmt + 1);
+     c28:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     c2b:	89 f2                	mov    %esi,%edx
+     c2d:	89 d8                	mov    %ebx,%eax
+     c2f:	e8 dc fd ff ff       	call   a10 <vfprintf>
+  fflush(&f);
+     c34:	89 1c 24             	mov    %ebx,(%esp)
+     c37:	e8 f4 04 00 00       	call   1130 <fflush>
+     c3c:	83 c4 10             	add    $0x10,%esp
+}
+     c3f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     c42:	5b                   	pop    %ebx
+     c43:	5e                   	pop    %esi
+     c44:	5d                   	pop    %ebp
+     c45:	c3                   	ret
+     c46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c4d:	8d 76 00             	lea    0x0(%esi),%esi
+    flockfile(&_iob[fd]);
+     c50:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     c53:	83 ec 0c             	sub    $0xc,%esp
+     c56:	8d 98 40 2b 00 00    	lea    0x2b40(%eax),%ebx
+     c5c:	53                   	push   %ebx
+     c5d:	e8 0e 02 00 00       	call   e70 <flockfile>
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     c62:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     c65:	89 f2                	mov    %esi,%edx
+     c67:	89 d8                	mov    %ebx,%eax
+     c69:	e8 a2 fd ff ff       	call   a10 <vfprintf>
+    funlockfile(&_iob[fd]);
+     c6e:	89 1c 24             	mov    %ebx,(%esp)
+     c71:	e8 2a 02 00 00       	call   ea0 <funlockfile>
+     c76:	83 c4 10             	add    $0x10,%esp
+}
+     c79:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     c7c:	5b                   	pop    %ebx
+     c7d:	5e                   	pop    %esi
+     c7e:	5d                   	pop    %ebp
+     c7f:	c3                   	ret
+
+00000c80 <setup>:
+}
+
+// Choose how to buffer f on first use: by lines on a device.
+static void
+setup(FILE *f)
+{
+     c80:	55                   	push   %ebp
+     c81:	89 e5                	mov    %esp,%ebp
+     c83:	53                   	push   %ebx
+     c84:	89 c3                	mov    %eax,%ebx
+     c86:	83 ec 2c             	sub    $0x2c,%esp
+  struct stat st;
+
+  f->flags |= IO_SETUP;
+     c89:	83 48 04 40          	orl    $0x40,0x4(%eax)
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     c8d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     c90:	50                   	push   %eax
+     c91:	ff 33                	push   (%ebx)
+     c93:	e8 52 fb ff ff       	call   7ea <fstat>
+     c98:	83 c4 10             	add    $0x10,%esp
+     c9b:	85 c0                	test   %eax,%eax
+    f->flags |= IO_DEV|IO_LINE;
+     c9d:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     ca0:	75 07                	jne    ca9 <setup+0x29>
+     ca2:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+     ca7:	74 17                	je     cc0 <setup+0x40>
+  if(f->flags & IO_WRITE)
+     ca9:	a8 02                	test   $0x2,%al
+     cab:	74 0a                	je     cb7 <setup+0x37>
+    flushhook = flushall;
+     cad:	c7 05 20 30 00 00 e0 	movl   $0xde0,0x3020
+     cb4:	0d 00 00 
+}
+     cb7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     cba:	c9                   	leave
+     cbb:	c3                   	ret
+     cbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    f->flags |= IO_DEV|IO_LINE;
+     cc0:	83 c8 30             	or     $0x30,%eax
+     cc3:	89 43 04             	mov    %eax,0x4(%ebx)
+     cc6:	eb e1                	jmp    ca9 <setup+0x29>
+     cc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ccf:	90                   	nop
+
+00000cd0 <flush>:
+static int
+flush(FILE *f)
+{
+  int i, n;
+
+  if(!(f->flags & IO_WRITE))
+     cd0:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+     cd4:	74 6a                	je     d40 <flush+0x70>
+{
+     cd6:	55                   	push   %ebp
+     cd7:	89 e5                	mov    %esp,%ebp
+     cd9:	56                   	push   %esi
+     cda:	89 c6                	mov    %eax,%esi
+     cdc:	53                   	push   %ebx
+    return 0;
+  for(i = 0; i < f->n; i += n){
+     cdd:	8b 40 14             	mov    0x14(%eax),%eax
+     ce0:	85 c0                	test   %eax,%eax
+     ce2:	7e 4c                	jle    d30 <flush+0x60>
+     ce4:	31 db                	xor    %ebx,%ebx
+     ce6:	eb 11                	jmp    cf9 <flush+0x29>
+     ce8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cef:	90                   	nop
+     cf0:	01 c3                	add    %eax,%ebx
+     cf2:	8b 46 14             	mov    0x14(%esi),%eax
+     cf5:	39 d8                	cmp    %ebx,%eax
+     cf7:	7e 37                	jle    d30 <flush+0x60>
+    if((n = write(f->fd, f->buf + i, f->n - i)) <= 0){
+     cf9:	83 ec 04             	sub    $0x4,%esp
+     cfc:	29 d8                	sub    %ebx,%eax
+     cfe:	50                   	push   %eax
+     cff:	8b 46 08             	mov    0x8(%esi),%eax
+     d02:	01 d8                	add    %ebx,%eax
+     d04:	50                   	push   %eax
+     d05:	ff 36                	push   (%esi)
+     d07:	e8 75 fa ff ff       	call   781 <write>
+     d0c:	83 c4 10             	add    $0x10,%esp
+     d0f:	85 c0                	test   %eax,%eax
+     d11:	7f dd                	jg     cf0 <flush+0x20>
+      f->flags |= IO_ERR;
+     d13:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+      f->n = 0;
+     d17:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     d1c:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+      return EOF;
+    }
+  }
+  f->n = 0;
+  return 0;
+}
+     d23:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d26:	5b                   	pop    %ebx
+     d27:	5e                   	pop    %esi
+     d28:	5d                   	pop    %ebp
+     d29:	c3                   	ret
+     d2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->n = 0;
+     d30:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+}
+     d37:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+     d3a:	31 c0                	xor    %eax,%eax
+}
+     d3c:	5b                   	pop    %ebx
+     d3d:	5e                   	pop    %esi
+     d3e:	5d                   	pop    %ebp
+     d3f:	c3                   	ret
+    return 0;
+     d40:	31 c0                	xor    %eax,%eax
+}
+     d42:	c3                   	ret
+     d43:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000d50 <fflush.part.0>:
+fflush(FILE *f)
+     d50:	55                   	push   %ebp
+     d51:	89 e5                	mov    %esp,%ebp
+     d53:	57                   	push   %edi
+     d54:	bf 38 2c 00 00       	mov    $0x2c38,%edi
+     d59:	56                   	push   %esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     d5a:	31 f6                	xor    %esi,%esi
+fflush(FILE *f)
+     d5c:	53                   	push   %ebx
+     d5d:	bb 58 2b 00 00       	mov    $0x2b58,%ebx
+     d62:	83 ec 1c             	sub    $0x1c,%esp
+     d65:	eb 10                	jmp    d77 <fflush.part.0+0x27>
+     d67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d6e:	66 90                	xchg   %ax,%ax
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     d70:	83 c3 1c             	add    $0x1c,%ebx
+     d73:	39 df                	cmp    %ebx,%edi
+     d75:	74 33                	je     daa <fflush.part.0+0x5a>
+      if((f->flags & IO_WRITE) && fflush(f) < 0)
+     d77:	f6 43 ec 02          	testb  $0x2,-0x14(%ebx)
+     d7b:	74 f3                	je     d70 <fflush.part.0+0x20>
+  if(threaded)
+     d7d:	8b 0d 40 30 00 00    	mov    0x3040,%ecx
+     d83:	85 c9                	test   %ecx,%ecx
+     d85:	75 49                	jne    dd0 <fflush.part.0+0x80>
+  r = flush(f);
+     d87:	8d 43 e8             	lea    -0x18(%ebx),%eax
+     d8a:	e8 41 ff ff ff       	call   cd0 <flush>
+  if(threaded)
+     d8f:	8b 15 40 30 00 00    	mov    0x3040,%edx
+     d95:	85 d2                	test   %edx,%edx
+     d97:	75 1f                	jne    db8 <fflush.part.0+0x68>
+        r = EOF;
+     d99:	85 c0                	test   %eax,%eax
+     d9b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     da0:	0f 48 f0             	cmovs  %eax,%esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     da3:	83 c3 1c             	add    $0x1c,%ebx
+     da6:	39 df                	cmp    %ebx,%edi
+     da8:	75 cd                	jne    d77 <fflush.part.0+0x27>
+}
+     daa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     dad:	89 f0                	mov    %esi,%eax
+     daf:	5b                   	pop    %ebx
+     db0:	5e                   	pop    %esi
+     db1:	5f                   	pop    %edi
+     db2:	5d                   	pop    %ebp
+     db3:	c3                   	ret
+     db4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     db8:	83 ec 0c             	sub    $0xc,%esp
+     dbb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     dbe:	53                   	push   %ebx
+     dbf:	e8 9c f8 ff ff       	call   660 <mutex_unlock>
+     dc4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     dc7:	83 c4 10             	add    $0x10,%esp
+     dca:	eb cd                	jmp    d99 <fflush.part.0+0x49>
+     dcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     dd0:	83 ec 0c             	sub    $0xc,%esp
+     dd3:	53                   	push   %ebx
+     dd4:	e8 37 f8 ff ff       	call   610 <mutex_lock>
+     dd9:	83 c4 10             	add    $0x10,%esp
+     ddc:	eb a9                	jmp    d87 <fflush.part.0+0x37>
+     dde:	66 90                	xchg   %ax,%ax
+
+00000de0 <flushall>:
+  if(f == 0){
+     de0:	e9 6b ff ff ff       	jmp    d50 <fflush.part.0>
+     de5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000df0 <fill>:
+
+// Refill f's buffer. Returns the number of bytes read.
+// Caller holds f's lock.
+static int
+fill(FILE *f)
+{
+     df0:	55                   	push   %ebp
+     df1:	89 e5                	mov    %esp,%ebp
+     df3:	53                   	push   %ebx
+     df4:	89 c3                	mov    %eax,%ebx
+     df6:	83 ec 04             	sub    $0x4,%esp
+  int n;
+
+  if(!(f->flags & IO_SETUP))
+     df9:	8b 40 04             	mov    0x4(%eax),%eax
+     dfc:	a8 40                	test   $0x40,%al
+     dfe:	74 50                	je     e50 <fill+0x60>
+    setup(f);
+  if(f->flags & IO_DEV)
+     e00:	a8 20                	test   $0x20,%al
+     e02:	75 3c                	jne    e40 <fill+0x50>
+    fflush(0);
+  f->r = 0;
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     e04:	83 ec 04             	sub    $0x4,%esp
+  f->r = 0;
+     e07:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     e0e:	ff 73 0c             	push   0xc(%ebx)
+     e11:	ff 73 08             	push   0x8(%ebx)
+     e14:	ff 33                	push   (%ebx)
+     e16:	e8 57 f9 ff ff       	call   772 <read>
+     e1b:	83 c4 10             	add    $0x10,%esp
+     e1e:	85 c0                	test   %eax,%eax
+     e20:	7f 10                	jg     e32 <fill+0x42>
+    f->flags |= n < 0 ? IO_ERR : IO_EOF;
+     e22:	83 f8 01             	cmp    $0x1,%eax
+     e25:	19 c0                	sbb    %eax,%eax
+     e27:	83 e0 fc             	and    $0xfffffffc,%eax
+     e2a:	83 c0 08             	add    $0x8,%eax
+     e2d:	09 43 04             	or     %eax,0x4(%ebx)
+    n = 0;
+     e30:	31 c0                	xor    %eax,%eax
+  }
+  f->n = n;
+     e32:	89 43 14             	mov    %eax,0x14(%ebx)
+  return n;
+}
+     e35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e38:	c9                   	leave
+     e39:	c3                   	ret
+     e3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == 0){
+     e40:	e8 0b ff ff ff       	call   d50 <fflush.part.0>
+     e45:	eb bd                	jmp    e04 <fill+0x14>
+     e47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e4e:	66 90                	xchg   %ax,%ax
+    setup(f);
+     e50:	89 d8                	mov    %ebx,%eax
+     e52:	e8 29 fe ff ff       	call   c80 <setup>
+  if(f->flags & IO_DEV)
+     e57:	8b 43 04             	mov    0x4(%ebx),%eax
+     e5a:	eb a4                	jmp    e00 <fill+0x10>
+     e5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000e60 <stdio_threaded>:
+  threaded = 1;
+     e60:	c7 05 40 30 00 00 01 	movl   $0x1,0x3040
+     e67:	00 00 00 
+}
+     e6a:	c3                   	ret
+     e6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e6f:	90                   	nop
+
+00000e70 <flockfile>:
+{
+     e70:	55                   	push   %ebp
+  if(threaded)
+     e71:	8b 15 40 30 00 00    	mov    0x3040,%edx
+{
+     e77:	89 e5                	mov    %esp,%ebp
+     e79:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     e7c:	85 d2                	test   %edx,%edx
+     e7e:	75 08                	jne    e88 <flockfile+0x18>
+}
+     e80:	5d                   	pop    %ebp
+     e81:	c3                   	ret
+     e82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_lock(&f->lock);
+     e88:	83 c0 18             	add    $0x18,%eax
+     e8b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     e8e:	5d                   	pop    %ebp
+    mutex_lock(&f->lock);
+     e8f:	e9 7c f7 ff ff       	jmp    610 <mutex_lock>
+     e94:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e9f:	90                   	nop
+
+00000ea0 <funlockfile>:
+{
+     ea0:	55                   	push   %ebp
+  if(threaded)
+     ea1:	8b 15 40 30 00 00    	mov    0x3040,%edx
+{
+     ea7:	89 e5                	mov    %esp,%ebp
+     ea9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     eac:	85 d2                	test   %edx,%edx
+     eae:	75 08                	jne    eb8 <funlockfile+0x18>
+}
+     eb0:	5d                   	pop    %ebp
+     eb1:	c3                   	ret
+     eb2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&f->lock);
+     eb8:	83 c0 18             	add    $0x18,%eax
+     ebb:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     ebe:	5d                   	pop    %ebp
+    mutex_unlock(&f->lock);
+     ebf:	e9 9c f7 ff ff       	jmp    660 <mutex_unlock>
+     ec4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ecb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ecf:	90                   	nop
+
+00000ed0 <fopen>:
+{
+     ed0:	55                   	push   %ebp
+     ed1:	89 e5                	mov    %esp,%ebp
+     ed3:	57                   	push   %edi
+     ed4:	56                   	push   %esi
+     ed5:	53                   	push   %ebx
+     ed6:	83 ec 34             	sub    $0x34,%esp
+     ed9:	8b 75 0c             	mov    0xc(%ebp),%esi
+     edc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(strcmp(mode, "r") != 0 && strcmp(mode, "w") != 0)
+     edf:	68 f1 20 00 00       	push   $0x20f1
+     ee4:	56                   	push   %esi
+     ee5:	e8 66 f5 ff ff       	call   450 <strcmp>
+     eea:	83 c4 10             	add    $0x10,%esp
+     eed:	85 c0                	test   %eax,%eax
+     eef:	74 15                	je     f06 <fopen+0x36>
+     ef1:	83 ec 08             	sub    $0x8,%esp
+     ef4:	68 f3 20 00 00       	push   $0x20f3
+     ef9:	56                   	push   %esi
+     efa:	e8 51 f5 ff ff       	call   450 <strcmp>
+     eff:	83 c4 10             	add    $0x10,%esp
+     f02:	85 c0                	test   %eax,%eax
+     f04:	75 2c                	jne    f32 <fopen+0x62>
+  if(threaded)
+     f06:	a1 40 30 00 00       	mov    0x3040,%eax
+     f0b:	85 c0                	test   %eax,%eax
+     f0d:	0f 85 ed 00 00 00    	jne    1000 <fopen+0x130>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     f13:	bb 94 2b 00 00       	mov    $0x2b94,%ebx
+    if(f->flags == 0)
+     f18:	8b 53 04             	mov    0x4(%ebx),%edx
+     f1b:	85 d2                	test   %edx,%edx
+     f1d:	74 21                	je     f40 <fopen+0x70>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     f1f:	83 c3 1c             	add    $0x1c,%ebx
+     f22:	81 fb 20 2c 00 00    	cmp    $0x2c20,%ebx
+     f28:	75 ee                	jne    f18 <fopen+0x48>
+  if(threaded)
+     f2a:	85 c0                	test   %eax,%eax
+     f2c:	0f 85 36 01 00 00    	jne    1068 <fopen+0x198>
+    return 0;
+     f32:	31 db                	xor    %ebx,%ebx
+     f34:	e9 96 00 00 00       	jmp    fcf <fopen+0xff>
+     f39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f == &_iob[NSTREAM])
+     f40:	81 fb 20 2c 00 00    	cmp    $0x2c20,%ebx
+     f46:	74 e2                	je     f2a <fopen+0x5a>
+    f->flags = IO_MALLOC;
+     f48:	c7 43 04 80 00 00 00 	movl   $0x80,0x4(%ebx)
+  if(threaded)
+     f4f:	85 c0                	test   %eax,%eax
+     f51:	0f 85 f9 00 00 00    	jne    1050 <fopen+0x180>
+  if(mode[0] == 'r'){
+     f57:	80 3e 72             	cmpb   $0x72,(%esi)
+     f5a:	0f 84 c0 00 00 00    	je     1020 <fopen+0x150>
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     f60:	83 ec 08             	sub    $0x8,%esp
+     f63:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     f66:	50                   	push   %eax
+     f67:	57                   	push   %edi
+     f68:	e8 d3 f5 ff ff       	call   540 <stat>
+     f6d:	83 c4 10             	add    $0x10,%esp
+     f70:	85 c0                	test   %eax,%eax
+     f72:	74 6c                	je     fe0 <fopen+0x110>
+    fd = open(path, O_CREATE|O_WRONLY);
+     f74:	83 ec 08             	sub    $0x8,%esp
+     f77:	68 01 02 00 00       	push   $0x201
+     f7c:	57                   	push   %edi
+    flags = IO_WRITE;
+     f7d:	bf 02 00 00 00       	mov    $0x2,%edi
+    fd = open(path, O_CREATE|O_WRONLY);
+     f82:	e8 36 f8 ff ff       	call   7bd <open>
+     f87:	83 c4 10             	add    $0x10,%esp
+     f8a:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     f8c:	85 f6                	test   %esi,%esi
+     f8e:	0f 88 a9 00 00 00    	js     103d <fopen+0x16d>
+     f94:	83 ec 0c             	sub    $0xc,%esp
+     f97:	68 00 02 00 00       	push   $0x200
+     f9c:	e8 af 0c 00 00       	call   1c50 <malloc>
+     fa1:	83 c4 10             	add    $0x10,%esp
+     fa4:	89 43 08             	mov    %eax,0x8(%ebx)
+     fa7:	85 c0                	test   %eax,%eax
+     fa9:	0f 84 d0 00 00 00    	je     107f <fopen+0x1af>
+  f->flags = flags|IO_MALLOC;
+     faf:	81 cf 80 00 00 00    	or     $0x80,%edi
+  f->fd = fd;
+     fb5:	89 33                	mov    %esi,(%ebx)
+  f->size = BUFSIZ;
+     fb7:	c7 43 0c 00 02 00 00 	movl   $0x200,0xc(%ebx)
+  f->r = f->n = 0;
+     fbe:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+     fc5:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  f->flags = flags|IO_MALLOC;
+     fcc:	89 7b 04             	mov    %edi,0x4(%ebx)
+}
+     fcf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     fd2:	89 d8                	mov    %ebx,%eax
+     fd4:	5b                   	pop    %ebx
+     fd5:	5e                   	pop    %esi
+     fd6:	5f                   	pop    %edi
+     fd7:	5d                   	pop    %ebp
+     fd8:	c3                   	ret
+     fd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     fe0:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+     fe5:	75 8d                	jne    f74 <fopen+0xa4>
+      unlink(path);
+     fe7:	83 ec 0c             	sub    $0xc,%esp
+     fea:	57                   	push   %edi
+     feb:	e8 eb f7 ff ff       	call   7db <unlink>
+     ff0:	83 c4 10             	add    $0x10,%esp
+     ff3:	e9 7c ff ff ff       	jmp    f74 <fopen+0xa4>
+     ff8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fff:	90                   	nop
+    mutex_lock(&iolock);
+    1000:	83 ec 0c             	sub    $0xc,%esp
+    1003:	68 44 30 00 00       	push   $0x3044
+    1008:	e8 03 f6 ff ff       	call   610 <mutex_lock>
+  if(threaded)
+    100d:	a1 40 30 00 00       	mov    0x3040,%eax
+    1012:	83 c4 10             	add    $0x10,%esp
+    1015:	e9 f9 fe ff ff       	jmp    f13 <fopen+0x43>
+    101a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    fd = open(path, O_RDONLY);
+    1020:	83 ec 08             	sub    $0x8,%esp
+    1023:	6a 00                	push   $0x0
+    1025:	57                   	push   %edi
+    flags = IO_READ;
+    1026:	bf 01 00 00 00       	mov    $0x1,%edi
+    fd = open(path, O_RDONLY);
+    102b:	e8 8d f7 ff ff       	call   7bd <open>
+    1030:	83 c4 10             	add    $0x10,%esp
+    1033:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+    1035:	85 f6                	test   %esi,%esi
+    1037:	0f 89 57 ff ff ff    	jns    f94 <fopen+0xc4>
+    f->flags = 0;
+    103d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    return 0;
+    1044:	31 db                	xor    %ebx,%ebx
+    1046:	eb 87                	jmp    fcf <fopen+0xff>
+    1048:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    104f:	90                   	nop
+    mutex_unlock(&iolock);
+    1050:	83 ec 0c             	sub    $0xc,%esp
+    1053:	68 44 30 00 00       	push   $0x3044
+    1058:	e8 03 f6 ff ff       	call   660 <mutex_unlock>
+    105d:	83 c4 10             	add    $0x10,%esp
+    1060:	e9 f2 fe ff ff       	jmp    f57 <fopen+0x87>
+    1065:	8d 76 00             	lea    0x0(%esi),%esi
+    1068:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+    106b:	31 db                	xor    %ebx,%ebx
+    mutex_unlock(&iolock);
+    106d:	68 44 30 00 00       	push   $0x3044
+    1072:	e8 e9 f5 ff ff       	call   660 <mutex_unlock>
+    1077:	83 c4 10             	add    $0x10,%esp
+    107a:	e9 50 ff ff ff       	jmp    fcf <fopen+0xff>
+      close(fd);
+    107f:	83 ec 0c             	sub    $0xc,%esp
+    1082:	56                   	push   %esi
+    1083:	e8 08 f7 ff ff       	call   790 <close>
+    1088:	83 c4 10             	add    $0x10,%esp
+    108b:	eb b0                	jmp    103d <fopen+0x16d>
+    108d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001090 <fclose>:
+{
+    1090:	55                   	push   %ebp
+    1091:	89 e5                	mov    %esp,%ebp
+    1093:	56                   	push   %esi
+    1094:	53                   	push   %ebx
+  if(threaded)
+    1095:	8b 15 40 30 00 00    	mov    0x3040,%edx
+{
+    109b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    109e:	85 d2                	test   %edx,%edx
+    10a0:	75 46                	jne    10e8 <fclose+0x58>
+  r = flush(f);
+    10a2:	89 d8                	mov    %ebx,%eax
+    10a4:	e8 27 fc ff ff       	call   cd0 <flush>
+  if(close(f->fd) < 0)
+    10a9:	83 ec 0c             	sub    $0xc,%esp
+    10ac:	ff 33                	push   (%ebx)
+  r = flush(f);
+    10ae:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    10b0:	e8 db f6 ff ff       	call   790 <close>
+    10b5:	83 c4 10             	add    $0x10,%esp
+    r = EOF;
+    10b8:	85 c0                	test   %eax,%eax
+    10ba:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    10bf:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->flags & IO_MALLOC)
+    10c2:	f6 43 04 80          	testb  $0x80,0x4(%ebx)
+    10c6:	75 58                	jne    1120 <fclose+0x90>
+  if(threaded)
+    10c8:	a1 40 30 00 00       	mov    0x3040,%eax
+  f->flags = 0;
+    10cd:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  if(threaded)
+    10d4:	85 c0                	test   %eax,%eax
+    10d6:	75 28                	jne    1100 <fclose+0x70>
+}
+    10d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    10db:	89 f0                	mov    %esi,%eax
+    10dd:	5b                   	pop    %ebx
+    10de:	5e                   	pop    %esi
+    10df:	5d                   	pop    %ebp
+    10e0:	c3                   	ret
+    10e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    10e8:	83 ec 0c             	sub    $0xc,%esp
+    10eb:	8d 43 18             	lea    0x18(%ebx),%eax
+    10ee:	50                   	push   %eax
+    10ef:	e8 1c f5 ff ff       	call   610 <mutex_lock>
+    10f4:	83 c4 10             	add    $0x10,%esp
+    10f7:	eb a9                	jmp    10a2 <fclose+0x12>
+    10f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1100:	83 ec 0c             	sub    $0xc,%esp
+    1103:	83 c3 18             	add    $0x18,%ebx
+    1106:	53                   	push   %ebx
+    1107:	e8 54 f5 ff ff       	call   660 <mutex_unlock>
+    110c:	83 c4 10             	add    $0x10,%esp
+}
+    110f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1112:	89 f0                	mov    %esi,%eax
+    1114:	5b                   	pop    %ebx
+    1115:	5e                   	pop    %esi
+    1116:	5d                   	pop    %ebp
+    1117:	c3                   	ret
+    1118:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    111f:	90                   	nop
+    free(f->buf);
+    1120:	83 ec 0c             	sub    $0xc,%esp
+    1123:	ff 73 08             	push   0x8(%ebx)
+    1126:	e8 f5 09 00 00       	call   1b20 <free>
+    112b:	83 c4 10             	add    $0x10,%esp
+    112e:	eb 98                	jmp    10c8 <fclose+0x38>
+
+00001130 <fflush>:
+{
+    1130:	55                   	push   %ebp
+    1131:	89 e5                	mov    %esp,%ebp
+    1133:	53                   	push   %ebx
+    1134:	83 ec 14             	sub    $0x14,%esp
+    1137:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f == 0){
+    113a:	85 db                	test   %ebx,%ebx
+    113c:	74 5a                	je     1198 <fflush+0x68>
+  if(threaded)
+    113e:	8b 0d 40 30 00 00    	mov    0x3040,%ecx
+    1144:	85 c9                	test   %ecx,%ecx
+    1146:	75 18                	jne    1160 <fflush+0x30>
+  r = flush(f);
+    1148:	89 d8                	mov    %ebx,%eax
+    114a:	e8 81 fb ff ff       	call   cd0 <flush>
+  if(threaded)
+    114f:	8b 15 40 30 00 00    	mov    0x3040,%edx
+    1155:	85 d2                	test   %edx,%edx
+    1157:	75 1f                	jne    1178 <fflush+0x48>
+}
+    1159:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    115c:	c9                   	leave
+    115d:	c3                   	ret
+    115e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    1160:	83 ec 0c             	sub    $0xc,%esp
+    1163:	8d 43 18             	lea    0x18(%ebx),%eax
+    1166:	50                   	push   %eax
+    1167:	e8 a4 f4 ff ff       	call   610 <mutex_lock>
+    116c:	83 c4 10             	add    $0x10,%esp
+    116f:	eb d7                	jmp    1148 <fflush+0x18>
+    1171:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1178:	83 ec 0c             	sub    $0xc,%esp
+    117b:	83 c3 18             	add    $0x18,%ebx
+    117e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1181:	53                   	push   %ebx
+    1182:	e8 d9 f4 ff ff       	call   660 <mutex_unlock>
+    1187:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    118a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    mutex_unlock(&f->lock);
+    118d:	83 c4 10             	add    $0x10,%esp
+}
+    1190:	c9                   	leave
+    1191:	c3                   	ret
+    1192:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1198:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    119b:	c9                   	leave
+    119c:	e9 af fb ff ff       	jmp    d50 <fflush.part.0>
+    11a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11af:	90                   	nop
+
+000011b0 <putc_unlocked>:
+{
+    11b0:	55                   	push   %ebp
+    11b1:	89 e5                	mov    %esp,%ebp
+    11b3:	56                   	push   %esi
+    11b4:	53                   	push   %ebx
+    11b5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    11b8:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(!(f->flags & IO_WRITE))
+    11bb:	8b 43 04             	mov    0x4(%ebx),%eax
+    11be:	a8 02                	test   $0x2,%al
+    11c0:	74 46                	je     1208 <putc_unlocked+0x58>
+  if(!(f->flags & IO_SETUP))
+    11c2:	a8 40                	test   $0x40,%al
+    11c4:	74 4a                	je     1210 <putc_unlocked+0x60>
+  if(f->n == f->size && flush(f) < 0)
+    11c6:	8b 43 14             	mov    0x14(%ebx),%eax
+    11c9:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    11cc:	74 51                	je     121f <putc_unlocked+0x6f>
+  f->buf[f->n++] = c;
+    11ce:	8d 48 01             	lea    0x1(%eax),%ecx
+    11d1:	8b 53 08             	mov    0x8(%ebx),%edx
+    11d4:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    11d7:	89 f1                	mov    %esi,%ecx
+    11d9:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    11dc:	83 fe 0a             	cmp    $0xa,%esi
+    11df:	74 0f                	je     11f0 <putc_unlocked+0x40>
+  return c & 0xff;
+    11e1:	89 f0                	mov    %esi,%eax
+    11e3:	0f b6 c0             	movzbl %al,%eax
+}
+    11e6:	5b                   	pop    %ebx
+    11e7:	5e                   	pop    %esi
+    11e8:	5d                   	pop    %ebp
+    11e9:	c3                   	ret
+    11ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    11f0:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    11f4:	74 eb                	je     11e1 <putc_unlocked+0x31>
+    11f6:	89 d8                	mov    %ebx,%eax
+    11f8:	e8 d3 fa ff ff       	call   cd0 <flush>
+    11fd:	85 c0                	test   %eax,%eax
+    11ff:	79 e0                	jns    11e1 <putc_unlocked+0x31>
+    1201:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return EOF;
+    1208:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    120d:	eb d7                	jmp    11e6 <putc_unlocked+0x36>
+    120f:	90                   	nop
+    setup(f);
+    1210:	89 d8                	mov    %ebx,%eax
+    1212:	e8 69 fa ff ff       	call   c80 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    1217:	8b 43 14             	mov    0x14(%ebx),%eax
+    121a:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    121d:	75 af                	jne    11ce <putc_unlocked+0x1e>
+    121f:	89 d8                	mov    %ebx,%eax
+    1221:	e8 aa fa ff ff       	call   cd0 <flush>
+    1226:	85 c0                	test   %eax,%eax
+    1228:	78 de                	js     1208 <putc_unlocked+0x58>
+  f->buf[f->n++] = c;
+    122a:	8b 43 14             	mov    0x14(%ebx),%eax
+    122d:	eb 9f                	jmp    11ce <putc_unlocked+0x1e>
+    122f:	90                   	nop
+
+00001230 <fputc>:
+{
+    1230:	55                   	push   %ebp
+    1231:	89 e5                	mov    %esp,%ebp
+    1233:	56                   	push   %esi
+    1234:	53                   	push   %ebx
+  if(threaded)
+    1235:	8b 15 40 30 00 00    	mov    0x3040,%edx
+{
+    123b:	8b 75 08             	mov    0x8(%ebp),%esi
+    123e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(threaded)
+    1241:	85 d2                	test   %edx,%edx
+    1243:	75 6b                	jne    12b0 <fputc+0x80>
+  if(!(f->flags & IO_WRITE))
+    1245:	8b 43 04             	mov    0x4(%ebx),%eax
+    1248:	a8 02                	test   $0x2,%al
+    124a:	0f 84 b8 00 00 00    	je     1308 <fputc+0xd8>
+  if(!(f->flags & IO_SETUP))
+    1250:	a8 40                	test   $0x40,%al
+    1252:	74 76                	je     12ca <fputc+0x9a>
+  if(f->n == f->size && flush(f) < 0)
+    1254:	8b 43 14             	mov    0x14(%ebx),%eax
+    1257:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    125a:	74 7d                	je     12d9 <fputc+0xa9>
+  f->buf[f->n++] = c;
+    125c:	8d 48 01             	lea    0x1(%eax),%ecx
+    125f:	8b 53 08             	mov    0x8(%ebx),%edx
+    1262:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    1265:	89 f1                	mov    %esi,%ecx
+    1267:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    126a:	83 fe 0a             	cmp    $0xa,%esi
+    126d:	74 21                	je     1290 <fputc+0x60>
+  return c & 0xff;
+    126f:	89 f0                	mov    %esi,%eax
+    1271:	0f b6 f0             	movzbl %al,%esi
+  if(threaded)
+    1274:	a1 40 30 00 00       	mov    0x3040,%eax
+    1279:	85 c0                	test   %eax,%eax
+    127b:	75 73                	jne    12f0 <fputc+0xc0>
+}
+    127d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1280:	89 f0                	mov    %esi,%eax
+    1282:	5b                   	pop    %ebx
+    1283:	5e                   	pop    %esi
+    1284:	5d                   	pop    %ebp
+    1285:	c3                   	ret
+    1286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    128d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    1290:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1294:	74 d9                	je     126f <fputc+0x3f>
+    1296:	89 d8                	mov    %ebx,%eax
+    1298:	e8 33 fa ff ff       	call   cd0 <flush>
+    129d:	85 c0                	test   %eax,%eax
+    129f:	79 ce                	jns    126f <fputc+0x3f>
+    return EOF;
+    12a1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    12a6:	eb cc                	jmp    1274 <fputc+0x44>
+    12a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12af:	90                   	nop
+    mutex_lock(&f->lock);
+    12b0:	83 ec 0c             	sub    $0xc,%esp
+    12b3:	8d 43 18             	lea    0x18(%ebx),%eax
+    12b6:	50                   	push   %eax
+    12b7:	e8 54 f3 ff ff       	call   610 <mutex_lock>
+  if(!(f->flags & IO_WRITE))
+    12bc:	8b 43 04             	mov    0x4(%ebx),%eax
+    12bf:	83 c4 10             	add    $0x10,%esp
+    12c2:	a8 02                	test   $0x2,%al
+    12c4:	74 db                	je     12a1 <fputc+0x71>
+  if(!(f->flags & IO_SETUP))
+    12c6:	a8 40                	test   $0x40,%al
+    12c8:	75 8a                	jne    1254 <fputc+0x24>
+    setup(f);
+    12ca:	89 d8                	mov    %ebx,%eax
+    12cc:	e8 af f9 ff ff       	call   c80 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    12d1:	8b 43 14             	mov    0x14(%ebx),%eax
+    12d4:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    12d7:	75 83                	jne    125c <fputc+0x2c>
+    12d9:	89 d8                	mov    %ebx,%eax
+    12db:	e8 f0 f9 ff ff       	call   cd0 <flush>
+    12e0:	85 c0                	test   %eax,%eax
+    12e2:	78 bd                	js     12a1 <fputc+0x71>
+  f->buf[f->n++] = c;
+    12e4:	8b 43 14             	mov    0x14(%ebx),%eax
+    12e7:	e9 70 ff ff ff       	jmp    125c <fputc+0x2c>
+    12ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    12f0:	83 ec 0c             	sub    $0xc,%esp
+    12f3:	83 c3 18             	add    $0x18,%ebx
+    12f6:	53                   	push   %ebx
+    12f7:	e8 64 f3 ff ff       	call   660 <mutex_unlock>
+    12fc:	83 c4 10             	add    $0x10,%esp
+}
+    12ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1302:	89 f0                	mov    %esi,%eax
+    1304:	5b                   	pop    %ebx
+    1305:	5e                   	pop    %esi
+    1306:	5d                   	pop    %ebp
+    1307:	c3                   	ret
+    return EOF;
+    1308:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    130d:	e9 6b ff ff ff       	jmp    127d <fputc+0x4d>
+    1312:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001320 <fwrite>:
+{
+    1320:	55                   	push   %ebp
+    1321:	89 e5                	mov    %esp,%ebp
+    1323:	57                   	push   %edi
+    1324:	56                   	push   %esi
+    1325:	53                   	push   %ebx
+    1326:	83 ec 1c             	sub    $0x1c,%esp
+    1329:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  if(!(f->flags & IO_WRITE) || size <= 0)
+    132c:	8b 43 04             	mov    0x4(%ebx),%eax
+    132f:	a8 02                	test   $0x2,%al
+    1331:	0f 84 ec 00 00 00    	je     1423 <fwrite+0x103>
+    1337:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    133a:	85 c9                	test   %ecx,%ecx
+    133c:	0f 8e e1 00 00 00    	jle    1423 <fwrite+0x103>
+  if(threaded)
+    1342:	8b 15 40 30 00 00    	mov    0x3040,%edx
+    1348:	85 d2                	test   %edx,%edx
+    134a:	0f 85 1c 01 00 00    	jne    146c <fwrite+0x14c>
+  if(!(f->flags & IO_SETUP))
+    1350:	a8 40                	test   $0x40,%al
+    1352:	0f 84 08 01 00 00    	je     1460 <fwrite+0x140>
+  for(len = size*nmemb; len > 0; len -= n){
+    1358:	8b 45 0c             	mov    0xc(%ebp),%eax
+    135b:	0f af 45 10          	imul   0x10(%ebp),%eax
+    135f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    1362:	85 c0                	test   %eax,%eax
+    1364:	0f 8e 2a 01 00 00    	jle    1494 <fwrite+0x174>
+  s = p;
+    136a:	8b 45 08             	mov    0x8(%ebp),%eax
+  nl = 0;
+    136d:	31 ff                	xor    %edi,%edi
+    136f:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+        nl = 1;
+    1372:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  s = p;
+    1375:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1378:	8b 43 14             	mov    0x14(%ebx),%eax
+        nl = 1;
+    137b:	89 ce                	mov    %ecx,%esi
+    if(f->n == f->size && flush(f) < 0)
+    137d:	89 c2                	mov    %eax,%edx
+    137f:	39 f0                	cmp    %esi,%eax
+    1381:	74 6e                	je     13f1 <fwrite+0xd1>
+    1383:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1387:	90                   	nop
+    if(n > len)
+    1388:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    n = f->size - f->n;
+    138b:	89 f1                	mov    %esi,%ecx
+    138d:	29 c1                	sub    %eax,%ecx
+    138f:	39 f9                	cmp    %edi,%ecx
+    1391:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1394:	85 c9                	test   %ecx,%ecx
+    1396:	0f 8e 7c 00 00 00    	jle    1418 <fwrite+0xf8>
+    139c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    139f:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    13a2:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    13a5:	8d 34 08             	lea    (%eax,%ecx,1),%esi
+    13a8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    13ab:	eb 06                	jmp    13b3 <fwrite+0x93>
+    13ad:	8d 76 00             	lea    0x0(%esi),%esi
+      if((f->buf[f->n++] = s[i]) == '\n')
+    13b0:	8b 53 14             	mov    0x14(%ebx),%edx
+    13b3:	8d 4a 01             	lea    0x1(%edx),%ecx
+    13b6:	8b 73 08             	mov    0x8(%ebx),%esi
+    13b9:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    13bc:	0f b6 08             	movzbl (%eax),%ecx
+        nl = 1;
+    13bf:	80 f9 0a             	cmp    $0xa,%cl
+      if((f->buf[f->n++] = s[i]) == '\n')
+    13c2:	88 0c 16             	mov    %cl,(%esi,%edx,1)
+        nl = 1;
+    13c5:	be 01 00 00 00       	mov    $0x1,%esi
+    13ca:	0f 44 fe             	cmove  %esi,%edi
+    for(i = 0; i < n; i++)
+    13cd:	83 c0 01             	add    $0x1,%eax
+    13d0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    13d3:	75 db                	jne    13b0 <fwrite+0x90>
+    s += n;
+    13d5:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    13d8:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    13db:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    s += n;
+    13de:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    13e1:	85 c0                	test   %eax,%eax
+    13e3:	7e 48                	jle    142d <fwrite+0x10d>
+    13e5:	8b 43 14             	mov    0x14(%ebx),%eax
+    13e8:	8b 73 0c             	mov    0xc(%ebx),%esi
+    if(f->n == f->size && flush(f) < 0)
+    13eb:	89 c2                	mov    %eax,%edx
+    13ed:	39 f0                	cmp    %esi,%eax
+    13ef:	75 97                	jne    1388 <fwrite+0x68>
+    13f1:	89 d8                	mov    %ebx,%eax
+    13f3:	e8 d8 f8 ff ff       	call   cd0 <flush>
+    13f8:	85 c0                	test   %eax,%eax
+    13fa:	78 31                	js     142d <fwrite+0x10d>
+    n = f->size - f->n;
+    13fc:	8b 73 0c             	mov    0xc(%ebx),%esi
+    13ff:	8b 43 14             	mov    0x14(%ebx),%eax
+    1402:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    1405:	89 f1                	mov    %esi,%ecx
+    1407:	89 c2                	mov    %eax,%edx
+    1409:	29 c1                	sub    %eax,%ecx
+    140b:	39 f9                	cmp    %edi,%ecx
+    140d:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1410:	85 c9                	test   %ecx,%ecx
+    1412:	7f 88                	jg     139c <fwrite+0x7c>
+    1414:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    s += n;
+    1418:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    141b:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    141e:	e9 5a ff ff ff       	jmp    137d <fwrite+0x5d>
+}
+    1423:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    1426:	31 c0                	xor    %eax,%eax
+}
+    1428:	5b                   	pop    %ebx
+    1429:	5e                   	pop    %esi
+    142a:	5f                   	pop    %edi
+    142b:	5d                   	pop    %ebp
+    142c:	c3                   	ret
+  if(nl && (f->flags & IO_LINE))
+    142d:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1430:	85 ff                	test   %edi,%edi
+    1432:	74 06                	je     143a <fwrite+0x11a>
+    1434:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1438:	75 1d                	jne    1457 <fwrite+0x137>
+  return (s - (const char*)p) / size;
+    143a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    143d:	2b 75 08             	sub    0x8(%ebp),%esi
+  if(threaded)
+    1440:	a1 40 30 00 00       	mov    0x3040,%eax
+    1445:	85 c0                	test   %eax,%eax
+    1447:	75 3a                	jne    1483 <fwrite+0x163>
+  return (s - (const char*)p) / size;
+    1449:	89 f0                	mov    %esi,%eax
+    144b:	99                   	cltd
+    144c:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    144f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1452:	5b                   	pop    %ebx
+    1453:	5e                   	pop    %esi
+    1454:	5f                   	pop    %edi
+    1455:	5d                   	pop    %ebp
+    1456:	c3                   	ret
+    flush(f);
+    1457:	89 d8                	mov    %ebx,%eax
+    1459:	e8 72 f8 ff ff       	call   cd0 <flush>
+    145e:	eb da                	jmp    143a <fwrite+0x11a>
+    setup(f);
+    1460:	89 d8                	mov    %ebx,%eax
+    1462:	e8 19 f8 ff ff       	call   c80 <setup>
+    1467:	e9 ec fe ff ff       	jmp    1358 <fwrite+0x38>
+    mutex_lock(&f->lock);
+    146c:	83 ec 0c             	sub    $0xc,%esp
+    146f:	8d 43 18             	lea    0x18(%ebx),%eax
+    1472:	50                   	push   %eax
+    1473:	e8 98 f1 ff ff       	call   610 <mutex_lock>
+  if(!(f->flags & IO_SETUP))
+    1478:	8b 43 04             	mov    0x4(%ebx),%eax
+    147b:	83 c4 10             	add    $0x10,%esp
+    147e:	e9 cd fe ff ff       	jmp    1350 <fwrite+0x30>
+    mutex_unlock(&f->lock);
+    1483:	83 ec 0c             	sub    $0xc,%esp
+    1486:	83 c3 18             	add    $0x18,%ebx
+    1489:	53                   	push   %ebx
+    148a:	e8 d1 f1 ff ff       	call   660 <mutex_unlock>
+    148f:	83 c4 10             	add    $0x10,%esp
+    1492:	eb b5                	jmp    1449 <fwrite+0x129>
+  for(len = size*nmemb; len > 0; len -= n){
+    1494:	31 f6                	xor    %esi,%esi
+    1496:	eb a8                	jmp    1440 <fwrite+0x120>
+    1498:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    149f:	90                   	nop
+
+000014a0 <fgetc>:
+  return f->buf[f->r++] & 0xff;
+}
+
+int
+fgetc(FILE *f)
+{
+    14a0:	55                   	push   %ebp
+    14a1:	89 e5                	mov    %esp,%ebp
+    14a3:	56                   	push   %esi
+    14a4:	53                   	push   %ebx
+  if(threaded)
+    14a5:	8b 15 40 30 00 00    	mov    0x3040,%edx
+{
+    14ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    14ae:	85 d2                	test   %edx,%edx
+    14b0:	75 2e                	jne    14e0 <fgetc+0x40>
+  if(!(f->flags & IO_READ))
+    14b2:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    14b6:	74 78                	je     1530 <fgetc+0x90>
+  if(f->r == f->n && fill(f) == 0)
+    14b8:	8b 43 10             	mov    0x10(%ebx),%eax
+    14bb:	3b 43 14             	cmp    0x14(%ebx),%eax
+    14be:	74 60                	je     1520 <fgetc+0x80>
+  return f->buf[f->r++] & 0xff;
+    14c0:	8b 53 08             	mov    0x8(%ebx),%edx
+    14c3:	8d 48 01             	lea    0x1(%eax),%ecx
+    14c6:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    14c9:	0f b6 34 02          	movzbl (%edx,%eax,1),%esi
+  if(threaded)
+    14cd:	a1 40 30 00 00       	mov    0x3040,%eax
+    14d2:	85 c0                	test   %eax,%eax
+    14d4:	75 2a                	jne    1500 <fgetc+0x60>
+
+  flockfile(f);
+  c = getc_unlocked(f);
+  funlockfile(f);
+  return c;
+}
+    14d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    14d9:	89 f0                	mov    %esi,%eax
+    14db:	5b                   	pop    %ebx
+    14dc:	5e                   	pop    %esi
+    14dd:	5d                   	pop    %ebp
+    14de:	c3                   	ret
+    14df:	90                   	nop
+    mutex_lock(&f->lock);
+    14e0:	83 ec 0c             	sub    $0xc,%esp
+    14e3:	8d 43 18             	lea    0x18(%ebx),%eax
+    14e6:	50                   	push   %eax
+    14e7:	e8 24 f1 ff ff       	call   610 <mutex_lock>
+  if(!(f->flags & IO_READ))
+    14ec:	83 c4 10             	add    $0x10,%esp
+    14ef:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    14f3:	75 c3                	jne    14b8 <fgetc+0x18>
+    return EOF;
+    14f5:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    14fa:	eb d1                	jmp    14cd <fgetc+0x2d>
+    14fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1500:	83 ec 0c             	sub    $0xc,%esp
+    1503:	83 c3 18             	add    $0x18,%ebx
+    1506:	53                   	push   %ebx
+    1507:	e8 54 f1 ff ff       	call   660 <mutex_unlock>
+    150c:	83 c4 10             	add    $0x10,%esp
+}
+    150f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1512:	89 f0                	mov    %esi,%eax
+    1514:	5b                   	pop    %ebx
+    1515:	5e                   	pop    %esi
+    1516:	5d                   	pop    %ebp
+    1517:	c3                   	ret
+    1518:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    151f:	90                   	nop
+  if(f->r == f->n && fill(f) == 0)
+    1520:	89 d8                	mov    %ebx,%eax
+    1522:	e8 c9 f8 ff ff       	call   df0 <fill>
+    1527:	85 c0                	test   %eax,%eax
+    1529:	74 ca                	je     14f5 <fgetc+0x55>
+  return f->buf[f->r++] & 0xff;
+    152b:	8b 43 10             	mov    0x10(%ebx),%eax
+    152e:	eb 90                	jmp    14c0 <fgetc+0x20>
+    return EOF;
+    1530:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    1535:	eb 9f                	jmp    14d6 <fgetc+0x36>
+    1537:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    153e:	66 90                	xchg   %ax,%ax
+
+00001540 <fread>:
+
+int
+fread(void *p, int size, int nmemb, FILE *f)
+{
+    1540:	55                   	push   %ebp
+    1541:	89 e5                	mov    %esp,%ebp
+    1543:	57                   	push   %edi
+    1544:	56                   	push   %esi
+    1545:	53                   	push   %ebx
+    1546:	83 ec 1c             	sub    $0x1c,%esp
+    1549:	8b 75 14             	mov    0x14(%ebp),%esi
+  char *d;
+  int n, len;
+
+  if(!(f->flags & IO_READ) || size <= 0)
+    154c:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+    1550:	74 7e                	je     15d0 <fread+0x90>
+    1552:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1555:	85 d2                	test   %edx,%edx
+    1557:	7e 77                	jle    15d0 <fread+0x90>
+  if(threaded)
+    1559:	a1 40 30 00 00       	mov    0x3040,%eax
+    return 0;
+  flockfile(f);
+  d = p;
+  for(len = size*nmemb; len > 0; len -= n){
+    155e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1561:	0f af 7d 10          	imul   0x10(%ebp),%edi
+  if(threaded)
+    1565:	85 c0                	test   %eax,%eax
+    1567:	0f 85 93 00 00 00    	jne    1600 <fread+0xc0>
+  for(len = size*nmemb; len > 0; len -= n){
+    156d:	85 ff                	test   %edi,%edi
+    156f:	7e 61                	jle    15d2 <fread+0x92>
+    if(f->r == f->n && fill(f) == 0)
+    1571:	8b 46 10             	mov    0x10(%esi),%eax
+  d = p;
+    1574:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1577:	eb 35                	jmp    15ae <fread+0x6e>
+    1579:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      break;
+    n = f->n - f->r;
+    1580:	29 c3                	sub    %eax,%ebx
+    1582:	39 fb                	cmp    %edi,%ebx
+    1584:	0f 4f df             	cmovg  %edi,%ebx
+    if(n > len)
+      n = len;
+    memmove(d, f->buf + f->r, n);
+    1587:	83 ec 04             	sub    $0x4,%esp
+    158a:	53                   	push   %ebx
+    158b:	03 46 08             	add    0x8(%esi),%eax
+  for(len = size*nmemb; len > 0; len -= n){
+    158e:	29 df                	sub    %ebx,%edi
+    memmove(d, f->buf + f->r, n);
+    1590:	50                   	push   %eax
+    1591:	51                   	push   %ecx
+    1592:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1595:	e8 36 f0 ff ff       	call   5d0 <memmove>
+    f->r += n;
+    159a:	8b 46 10             	mov    0x10(%esi),%eax
+    d += n;
+    159d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    15a0:	83 c4 10             	add    $0x10,%esp
+    f->r += n;
+    15a3:	01 d8                	add    %ebx,%eax
+    d += n;
+    15a5:	01 d9                	add    %ebx,%ecx
+    f->r += n;
+    15a7:	89 46 10             	mov    %eax,0x10(%esi)
+  for(len = size*nmemb; len > 0; len -= n){
+    15aa:	85 ff                	test   %edi,%edi
+    15ac:	7e 32                	jle    15e0 <fread+0xa0>
+    if(f->r == f->n && fill(f) == 0)
+    15ae:	8b 5e 14             	mov    0x14(%esi),%ebx
+    15b1:	39 c3                	cmp    %eax,%ebx
+    15b3:	75 cb                	jne    1580 <fread+0x40>
+    15b5:	89 f0                	mov    %esi,%eax
+    15b7:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    15ba:	e8 31 f8 ff ff       	call   df0 <fill>
+    15bf:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    15c2:	85 c0                	test   %eax,%eax
+    15c4:	74 1a                	je     15e0 <fread+0xa0>
+    n = f->n - f->r;
+    15c6:	8b 5e 14             	mov    0x14(%esi),%ebx
+    15c9:	8b 46 10             	mov    0x10(%esi),%eax
+    15cc:	eb b2                	jmp    1580 <fread+0x40>
+    15ce:	66 90                	xchg   %ax,%ax
+    return 0;
+    15d0:	31 c0                	xor    %eax,%eax
+  }
+  funlockfile(f);
+  return (d - (char*)p) / size;
+}
+    15d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15d5:	5b                   	pop    %ebx
+    15d6:	5e                   	pop    %esi
+    15d7:	5f                   	pop    %edi
+    15d8:	5d                   	pop    %ebp
+    15d9:	c3                   	ret
+    15da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (d - (char*)p) / size;
+    15e0:	2b 4d 08             	sub    0x8(%ebp),%ecx
+    15e3:	89 cb                	mov    %ecx,%ebx
+  if(threaded)
+    15e5:	a1 40 30 00 00       	mov    0x3040,%eax
+    15ea:	85 c0                	test   %eax,%eax
+    15ec:	75 32                	jne    1620 <fread+0xe0>
+  return (d - (char*)p) / size;
+    15ee:	89 d8                	mov    %ebx,%eax
+    15f0:	99                   	cltd
+    15f1:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    15f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15f7:	5b                   	pop    %ebx
+    15f8:	5e                   	pop    %esi
+    15f9:	5f                   	pop    %edi
+    15fa:	5d                   	pop    %ebp
+    15fb:	c3                   	ret
+    15fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    1600:	83 ec 0c             	sub    $0xc,%esp
+    1603:	8d 46 18             	lea    0x18(%esi),%eax
+    1606:	50                   	push   %eax
+    1607:	e8 04 f0 ff ff       	call   610 <mutex_lock>
+  for(len = size*nmemb; len > 0; len -= n){
+    160c:	83 c4 10             	add    $0x10,%esp
+    160f:	85 ff                	test   %edi,%edi
+    1611:	0f 8f 5a ff ff ff    	jg     1571 <fread+0x31>
+    1617:	31 db                	xor    %ebx,%ebx
+    1619:	eb ca                	jmp    15e5 <fread+0xa5>
+    161b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    161f:	90                   	nop
+    mutex_unlock(&f->lock);
+    1620:	83 ec 0c             	sub    $0xc,%esp
+    1623:	83 c6 18             	add    $0x18,%esi
+    1626:	56                   	push   %esi
+    1627:	e8 34 f0 ff ff       	call   660 <mutex_unlock>
+  return (d - (char*)p) / size;
+    162c:	89 d8                	mov    %ebx,%eax
+    162e:	83 c4 10             	add    $0x10,%esp
+    1631:	99                   	cltd
+    1632:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1635:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1638:	5b                   	pop    %ebx
+    1639:	5e                   	pop    %esi
+    163a:	5f                   	pop    %edi
+    163b:	5d                   	pop    %ebp
+    163c:	c3                   	ret
+    163d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001640 <fgets>:
+
+// Read a line of at most max-1 bytes, keeping the newline.
+// Returns 0 if there was nothing left to read.
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    1640:	55                   	push   %ebp
+    1641:	89 e5                	mov    %esp,%ebp
+    1643:	57                   	push   %edi
+    1644:	56                   	push   %esi
+    1645:	53                   	push   %ebx
+    1646:	83 ec 1c             	sub    $0x1c,%esp
+  if(threaded)
+    1649:	8b 35 40 30 00 00    	mov    0x3040,%esi
+{
+    164f:	8b 7d 08             	mov    0x8(%ebp),%edi
+    1652:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if(threaded)
+    1655:	85 f6                	test   %esi,%esi
+    1657:	0f 85 83 00 00 00    	jne    16e0 <fgets+0xa0>
+{
+    165d:	31 f6                	xor    %esi,%esi
+    165f:	eb 2a                	jmp    168b <fgets+0x4b>
+    1661:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return f->buf[f->r++] & 0xff;
+    1668:	8b 53 08             	mov    0x8(%ebx),%edx
+    166b:	8d 48 01             	lea    0x1(%eax),%ecx
+    166e:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1671:	0f b6 14 02          	movzbl (%edx,%eax,1),%edx
+
+  flockfile(f);
+  for(i = 0; i+1 < max; ){
+    if((c = getc_unlocked(f)) == EOF)
+      break;
+    buf[i++] = c;
+    1675:	88 54 37 ff          	mov    %dl,-0x1(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    1679:	80 fa 0a             	cmp    $0xa,%dl
+    167c:	0f 84 96 00 00 00    	je     1718 <fgets+0xd8>
+    1682:	83 fa 0d             	cmp    $0xd,%edx
+    1685:	0f 84 8d 00 00 00    	je     1718 <fgets+0xd8>
+  for(i = 0; i+1 < max; ){
+    168b:	89 f2                	mov    %esi,%edx
+    168d:	83 c6 01             	add    $0x1,%esi
+    1690:	3b 75 0c             	cmp    0xc(%ebp),%esi
+    1693:	7d 2b                	jge    16c0 <fgets+0x80>
+  if(!(f->flags & IO_READ))
+    1695:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1699:	74 25                	je     16c0 <fgets+0x80>
+  if(f->r == f->n && fill(f) == 0)
+    169b:	8b 43 10             	mov    0x10(%ebx),%eax
+    169e:	3b 43 14             	cmp    0x14(%ebx),%eax
+    16a1:	75 c5                	jne    1668 <fgets+0x28>
+    16a3:	89 d8                	mov    %ebx,%eax
+    16a5:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    16a8:	e8 43 f7 ff ff       	call   df0 <fill>
+    16ad:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    16b0:	85 c0                	test   %eax,%eax
+    16b2:	74 0c                	je     16c0 <fgets+0x80>
+  return f->buf[f->r++] & 0xff;
+    16b4:	8b 43 10             	mov    0x10(%ebx),%eax
+    16b7:	eb af                	jmp    1668 <fgets+0x28>
+    16b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    16c0:	8b 0d 40 30 00 00    	mov    0x3040,%ecx
+      break;
+  }
+  buf[i] = '\0';
+    16c6:	c6 04 17 00          	movb   $0x0,(%edi,%edx,1)
+  if(threaded)
+    16ca:	85 c9                	test   %ecx,%ecx
+    16cc:	75 2a                	jne    16f8 <fgets+0xb8>
+  funlockfile(f);
+  return i > 0 ? buf : 0;
+    16ce:	31 c0                	xor    %eax,%eax
+    16d0:	85 d2                	test   %edx,%edx
+    16d2:	74 02                	je     16d6 <fgets+0x96>
+    16d4:	89 f8                	mov    %edi,%eax
+}
+    16d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    16d9:	5b                   	pop    %ebx
+    16da:	5e                   	pop    %esi
+    16db:	5f                   	pop    %edi
+    16dc:	5d                   	pop    %ebp
+    16dd:	c3                   	ret
+    16de:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    16e0:	83 ec 0c             	sub    $0xc,%esp
+    16e3:	8d 43 18             	lea    0x18(%ebx),%eax
+    16e6:	50                   	push   %eax
+    16e7:	e8 24 ef ff ff       	call   610 <mutex_lock>
+    16ec:	83 c4 10             	add    $0x10,%esp
+    16ef:	e9 69 ff ff ff       	jmp    165d <fgets+0x1d>
+    16f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    16f8:	83 ec 0c             	sub    $0xc,%esp
+    16fb:	83 c3 18             	add    $0x18,%ebx
+    16fe:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1701:	53                   	push   %ebx
+    1702:	e8 59 ef ff ff       	call   660 <mutex_unlock>
+    1707:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    170a:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    170d:	31 c0                	xor    %eax,%eax
+    170f:	85 d2                	test   %edx,%edx
+    1711:	75 c1                	jne    16d4 <fgets+0x94>
+    1713:	eb c1                	jmp    16d6 <fgets+0x96>
+    1715:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1718:	a1 40 30 00 00       	mov    0x3040,%eax
+  buf[i] = '\0';
+    171d:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  if(threaded)
+    1721:	85 c0                	test   %eax,%eax
+    1723:	74 af                	je     16d4 <fgets+0x94>
+    mutex_unlock(&f->lock);
+    1725:	83 ec 0c             	sub    $0xc,%esp
+    1728:	83 c3 18             	add    $0x18,%ebx
+    172b:	53                   	push   %ebx
+    172c:	e8 2f ef ff ff       	call   660 <mutex_unlock>
+    1731:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    1734:	89 f8                	mov    %edi,%eax
+    1736:	eb 9e                	jmp    16d6 <fgets+0x96>
+    1738:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    173f:	90                   	nop
+
+00001740 <gets>:
+// at most a line per read(), goes through stdin's buffer: from a
+// file or pipe, a buffered read could take input meant for a child
+// process, so read a byte at a time.
+char*
+gets(char *buf, int max)
+{
+    1740:	55                   	push   %ebp
+    1741:	89 e5                	mov    %esp,%ebp
+    1743:	57                   	push   %edi
+    1744:	56                   	push   %esi
+    1745:	53                   	push   %ebx
+    1746:	83 ec 2c             	sub    $0x2c,%esp
+  int i, cc;
+  char c;
+
+  if(!(stdin->flags & IO_SETUP))
+    1749:	8b 15 44 2b 00 00    	mov    0x2b44,%edx
+{
+    174f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!(stdin->flags & IO_SETUP))
+    1752:	f6 c2 40             	test   $0x40,%dl
+    1755:	74 79                	je     17d0 <gets+0x90>
+    setup(stdin);
+  if(stdin->flags & IO_DEV){
+    1757:	83 e2 20             	and    $0x20,%edx
+    175a:	89 d7                	mov    %edx,%edi
+    175c:	75 52                	jne    17b0 <gets+0x70>
+  if(f == 0){
+    175e:	e8 ed f5 ff ff       	call   d50 <fflush.part.0>
+    fgets(buf, max, stdin);
+    return buf;
+  }
+  fflush(0);
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1763:	8d 75 e7             	lea    -0x19(%ebp),%esi
+  for(i=0; i+1 < max; ){
+    1766:	eb 2c                	jmp    1794 <gets+0x54>
+    1768:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    176f:	90                   	nop
+    cc = read(0, &c, 1);
+    1770:	83 ec 04             	sub    $0x4,%esp
+    1773:	6a 01                	push   $0x1
+    1775:	56                   	push   %esi
+    1776:	6a 00                	push   $0x0
+    1778:	e8 f5 ef ff ff       	call   772 <read>
+    if(cc < 1)
+    177d:	83 c4 10             	add    $0x10,%esp
+    1780:	85 c0                	test   %eax,%eax
+    1782:	7e 1b                	jle    179f <gets+0x5f>
+      break;
+    buf[i++] = c;
+    1784:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1788:	88 44 3b ff          	mov    %al,-0x1(%ebx,%edi,1)
+    if(c == '\n' || c == '\r')
+    178c:	3c 0a                	cmp    $0xa,%al
+    178e:	74 12                	je     17a2 <gets+0x62>
+    1790:	3c 0d                	cmp    $0xd,%al
+    1792:	74 0e                	je     17a2 <gets+0x62>
+  for(i=0; i+1 < max; ){
+    1794:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    1797:	83 c7 01             	add    $0x1,%edi
+    179a:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+    179d:	7c d1                	jl     1770 <gets+0x30>
+{
+    179f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      break;
+  }
+  buf[i] = '\0';
+    17a2:	c6 04 3b 00          	movb   $0x0,(%ebx,%edi,1)
+  return buf;
+}
+    17a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    17a9:	89 d8                	mov    %ebx,%eax
+    17ab:	5b                   	pop    %ebx
+    17ac:	5e                   	pop    %esi
+    17ad:	5f                   	pop    %edi
+    17ae:	5d                   	pop    %ebp
+    17af:	c3                   	ret
+    fgets(buf, max, stdin);
+    17b0:	83 ec 04             	sub    $0x4,%esp
+    17b3:	68 40 2b 00 00       	push   $0x2b40
+    17b8:	ff 75 0c             	push   0xc(%ebp)
+    17bb:	53                   	push   %ebx
+    17bc:	e8 7f fe ff ff       	call   1640 <fgets>
+    return buf;
+    17c1:	83 c4 10             	add    $0x10,%esp
+}
+    17c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    17c7:	89 d8                	mov    %ebx,%eax
+    17c9:	5b                   	pop    %ebx
+    17ca:	5e                   	pop    %esi
+    17cb:	5f                   	pop    %edi
+    17cc:	5d                   	pop    %ebp
+    17cd:	c3                   	ret
+    17ce:	66 90                	xchg   %ax,%ax
+    setup(stdin);
+    17d0:	b8 40 2b 00 00       	mov    $0x2b40,%eax
+    17d5:	e8 a6 f4 ff ff       	call   c80 <setup>
+  if(stdin->flags & IO_DEV){
+    17da:	8b 15 44 2b 00 00    	mov    0x2b44,%edx
+    17e0:	e9 72 ff ff ff       	jmp    1757 <gets+0x17>
+    17e5:	66 90                	xchg   %ax,%ax
+    17e7:	66 90                	xchg   %ax,%ax
+    17e9:	66 90                	xchg   %ax,%ax
+    17eb:	66 90                	xchg   %ax,%ax
+    17ed:	66 90                	xchg   %ax,%ax
+    17ef:	90                   	nop
+
+000017f0 <bigfree>:
+
+// Give a big block back to the first-fit list, and return the
+// free block that now holds it. Caller holds lock.
+static Header*
+bigfree(Header *bp)
+{
+    17f0:	55                   	push   %ebp
+    17f1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    17f3:	a1 e4 36 00 00       	mov    0x36e4,%eax
+{
+    17f8:	89 e5                	mov    %esp,%ebp
+    17fa:	56                   	push   %esi
+    17fb:	53                   	push   %ebx
+    17fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1800:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1802:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1804:	39 ca                	cmp    %ecx,%edx
+    1806:	73 38                	jae    1840 <bigfree+0x50>
+    1808:	39 c1                	cmp    %eax,%ecx
+    180a:	72 04                	jb     1810 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    180c:	39 c2                	cmp    %eax,%edx
+    180e:	72 f0                	jb     1800 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1810:	8b 59 04             	mov    0x4(%ecx),%ebx
+    1813:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    1816:	39 f0                	cmp    %esi,%eax
+    1818:	74 36                	je     1850 <bigfree+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    181a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  freep = p;
+  if(p + p->s.size == bp){
+    181c:	8b 42 04             	mov    0x4(%edx),%eax
+    181f:	89 cb                	mov    %ecx,%ebx
+  freep = p;
+    1821:	89 15 e4 36 00 00    	mov    %edx,0x36e4
+  if(p + p->s.size == bp){
+    1827:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    182a:	39 f1                	cmp    %esi,%ecx
+    182c:	74 2e                	je     185c <bigfree+0x6c>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    182e:	89 1a                	mov    %ebx,(%edx)
+    return p;
+  }
+  p->s.ptr = bp;
+  return bp;
+}
+    1830:	89 c8                	mov    %ecx,%eax
+    1832:	5b                   	pop    %ebx
+    1833:	5e                   	pop    %esi
+    1834:	5d                   	pop    %ebp
+    1835:	c3                   	ret
+    1836:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    183d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1840:	39 c1                	cmp    %eax,%ecx
+    1842:	72 c8                	jb     180c <bigfree+0x1c>
+    1844:	eb ba                	jmp    1800 <bigfree+0x10>
+    1846:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    184d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1850:	03 58 04             	add    0x4(%eax),%ebx
+    1853:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1856:	8b 02                	mov    (%edx),%eax
+    1858:	8b 00                	mov    (%eax),%eax
+    185a:	eb be                	jmp    181a <bigfree+0x2a>
+    p->s.size += bp->s.size;
+    185c:	03 41 04             	add    0x4(%ecx),%eax
+    185f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1862:	8b 19                	mov    (%ecx),%ebx
+    return p;
+    1864:	89 d1                	mov    %edx,%ecx
+}
+    1866:	89 c8                	mov    %ecx,%eax
+    p->s.ptr = bp->s.ptr;
+    1868:	89 1a                	mov    %ebx,(%edx)
+}
+    186a:	5b                   	pop    %ebx
+    186b:	5e                   	pop    %esi
+    186c:	5d                   	pop    %ebp
+    186d:	c3                   	ret
+    186e:	66 90                	xchg   %ax,%ax
+
+00001870 <trim>:
+// If free block bp ends the heap, return its whole pages to the
+// kernel, unless something else has moved the break since.
+// Caller holds lock.
+static void
+trim(Header *bp)
+{
+    1870:	55                   	push   %ebp
+    1871:	89 e5                	mov    %esp,%ebp
+    1873:	57                   	push   %edi
+    1874:	56                   	push   %esi
+    1875:	53                   	push   %ebx
+    1876:	89 c3                	mov    %eax,%ebx
+    1878:	83 ec 0c             	sub    $0xc,%esp
+  char *end;
+  uint n;
+
+  if((char*)(bp + bp->s.size) != heapend)
+    187b:	8b 53 04             	mov    0x4(%ebx),%edx
+    187e:	a1 e0 36 00 00       	mov    0x36e0,%eax
+    1883:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+    1886:	39 d0                	cmp    %edx,%eax
+    1888:	74 0e                	je     1898 <trim+0x28>
+  n = heapend - end;
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    bp->s.size -= n / sizeof(Header);
+    heapend = end;
+  }
+}
+    188a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    188d:	5b                   	pop    %ebx
+    188e:	5e                   	pop    %esi
+    188f:	5f                   	pop    %edi
+    1890:	5d                   	pop    %ebp
+    1891:	c3                   	ret
+    1892:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  end = (char*)PGROUNDUP((uint)(bp + 2));
+    1898:	8d bb 0f 10 00 00    	lea    0x100f(%ebx),%edi
+    189e:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  n = heapend - end;
+    18a4:	29 f8                	sub    %edi,%eax
+    18a6:	89 c6                	mov    %eax,%esi
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    18a8:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    18ad:	76 db                	jbe    188a <trim+0x1a>
+    18af:	83 ec 0c             	sub    $0xc,%esp
+    18b2:	6a 00                	push   $0x0
+    18b4:	e8 8b ef ff ff       	call   844 <sbrk>
+    18b9:	83 c4 10             	add    $0x10,%esp
+    18bc:	39 05 e0 36 00 00    	cmp    %eax,0x36e0
+    18c2:	75 c6                	jne    188a <trim+0x1a>
+    18c4:	89 f0                	mov    %esi,%eax
+    18c6:	83 ec 0c             	sub    $0xc,%esp
+    18c9:	f7 d8                	neg    %eax
+    18cb:	50                   	push   %eax
+    18cc:	e8 73 ef ff ff       	call   844 <sbrk>
+    18d1:	83 c4 10             	add    $0x10,%esp
+    18d4:	83 f8 ff             	cmp    $0xffffffff,%eax
+    18d7:	74 b1                	je     188a <trim+0x1a>
+    bp->s.size -= n / sizeof(Header);
+    18d9:	89 f0                	mov    %esi,%eax
+    heapend = end;
+    18db:	89 3d e0 36 00 00    	mov    %edi,0x36e0
+    bp->s.size -= n / sizeof(Header);
+    18e1:	c1 e8 03             	shr    $0x3,%eax
+    18e4:	29 43 04             	sub    %eax,0x4(%ebx)
+    heapend = end;
+    18e7:	eb a1                	jmp    188a <trim+0x1a>
+    18e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000018f0 <bigalloc>:
+}
+
+// Allocate a big block of nunits units. Caller holds lock.
+static Header*
+bigalloc(uint nunits)
+{
+    18f0:	55                   	push   %ebp
+    18f1:	89 e5                	mov    %esp,%ebp
+    18f3:	57                   	push   %edi
+    18f4:	89 c7                	mov    %eax,%edi
+    18f6:	56                   	push   %esi
+    18f7:	53                   	push   %ebx
+    18f8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    18fb:	a1 e4 36 00 00       	mov    0x36e4,%eax
+    1900:	85 c0                	test   %eax,%eax
+    1902:	0f 84 98 00 00 00    	je     19a0 <bigalloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1908:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    190a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    190d:	39 f9                	cmp    %edi,%ecx
+    190f:	73 67                	jae    1978 <bigalloc+0x88>
+  if(nu < 4096)
+    1911:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1916:	39 df                	cmp    %ebx,%edi
+    1918:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    191b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    1922:	eb 0d                	jmp    1931 <bigalloc+0x41>
+    1924:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1928:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    192a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    192d:	39 f9                	cmp    %edi,%ecx
+    192f:	73 47                	jae    1978 <bigalloc+0x88>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    1931:	89 d0                	mov    %edx,%eax
+    1933:	39 15 e4 36 00 00    	cmp    %edx,0x36e4
+    1939:	75 ed                	jne    1928 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    193b:	83 ec 0c             	sub    $0xc,%esp
+    193e:	56                   	push   %esi
+    193f:	e8 00 ef ff ff       	call   844 <sbrk>
+  if(p == (char*)-1)
+    1944:	83 c4 10             	add    $0x10,%esp
+    1947:	83 f8 ff             	cmp    $0xffffffff,%eax
+    194a:	74 1a                	je     1966 <bigalloc+0x76>
+  hp->s.size = nu;
+    194c:	89 58 04             	mov    %ebx,0x4(%eax)
+  heapend = p + nu * sizeof(Header);
+    194f:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    1952:	89 15 e0 36 00 00    	mov    %edx,0x36e0
+  bigfree(hp);
+    1958:	e8 93 fe ff ff       	call   17f0 <bigfree>
+  return freep;
+    195d:	a1 e4 36 00 00       	mov    0x36e4,%eax
+      if((p = morecore(nunits)) == 0)
+    1962:	85 c0                	test   %eax,%eax
+    1964:	75 c2                	jne    1928 <bigalloc+0x38>
+        return 0;
+  }
+}
+    1966:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1969:	31 d2                	xor    %edx,%edx
+}
+    196b:	5b                   	pop    %ebx
+    196c:	89 d0                	mov    %edx,%eax
+    196e:	5e                   	pop    %esi
+    196f:	5f                   	pop    %edi
+    1970:	5d                   	pop    %ebp
+    1971:	c3                   	ret
+    1972:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1978:	39 cf                	cmp    %ecx,%edi
+    197a:	74 54                	je     19d0 <bigalloc+0xe0>
+        p->s.size -= nunits;
+    197c:	29 f9                	sub    %edi,%ecx
+    197e:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    1981:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    1984:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    1987:	a3 e4 36 00 00       	mov    %eax,0x36e4
+}
+    198c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    198f:	89 d0                	mov    %edx,%eax
+    1991:	5b                   	pop    %ebx
+    1992:	5e                   	pop    %esi
+    1993:	5f                   	pop    %edi
+    1994:	5d                   	pop    %ebp
+    1995:	c3                   	ret
+    1996:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    199d:	8d 76 00             	lea    0x0(%esi),%esi
+    base.s.ptr = freep = prevp = &base;
+    19a0:	c7 05 e4 36 00 00 e8 	movl   $0x36e8,0x36e4
+    19a7:	36 00 00 
+    base.s.size = 0;
+    19aa:	ba e8 36 00 00       	mov    $0x36e8,%edx
+    base.s.ptr = freep = prevp = &base;
+    19af:	c7 05 e8 36 00 00 e8 	movl   $0x36e8,0x36e8
+    19b6:	36 00 00 
+    base.s.size = 0;
+    19b9:	c7 05 ec 36 00 00 00 	movl   $0x0,0x36ec
+    19c0:	00 00 00 
+    if(p->s.size >= nunits){
+    19c3:	e9 49 ff ff ff       	jmp    1911 <bigalloc+0x21>
+    19c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19cf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    19d0:	8b 0a                	mov    (%edx),%ecx
+    19d2:	89 08                	mov    %ecx,(%eax)
+    19d4:	eb b1                	jmp    1987 <bigalloc+0x97>
+    19d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000019e0 <drain>:
+}
+
+// Move n blocks of class c from cache tc to the shared list.
+static void
+drain(struct tcache *tc, int c, int n)
+{
+    19e0:	55                   	push   %ebp
+    19e1:	89 e5                	mov    %esp,%ebp
+    19e3:	57                   	push   %edi
+    19e4:	89 c7                	mov    %eax,%edi
+    19e6:	56                   	push   %esi
+    19e7:	89 d6                	mov    %edx,%esi
+    19e9:	53                   	push   %ebx
+    19ea:	89 cb                	mov    %ecx,%ebx
+    19ec:	83 ec 0c             	sub    $0xc,%esp
+  if(threaded)
+    19ef:	8b 15 64 36 00 00    	mov    0x3664,%edx
+    19f5:	85 d2                	test   %edx,%edx
+    19f7:	75 57                	jne    1a50 <drain+0x70>
+  Header *p;
+
+  acquire();
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    19f9:	85 c9                	test   %ecx,%ecx
+    19fb:	7e 49                	jle    1a46 <drain+0x66>
+    19fd:	89 d9                	mov    %ebx,%ecx
+    19ff:	8d 14 b7             	lea    (%edi,%esi,4),%edx
+    1a02:	eb 23                	jmp    1a27 <drain+0x47>
+    1a04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    tc->list[c] = p->s.ptr;
+    1a08:	8b 18                	mov    (%eax),%ebx
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1a0a:	83 e9 01             	sub    $0x1,%ecx
+    tc->n[c]--;
+    1a0d:	83 6a 20 01          	subl   $0x1,0x20(%edx)
+    tc->list[c] = p->s.ptr;
+    1a11:	89 1a                	mov    %ebx,(%edx)
+    p->s.ptr = small[c];
+    1a13:	8b 1c b5 c0 36 00 00 	mov    0x36c0(,%esi,4),%ebx
+    1a1a:	89 18                	mov    %ebx,(%eax)
+    small[c] = p;
+    1a1c:	89 04 b5 c0 36 00 00 	mov    %eax,0x36c0(,%esi,4)
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1a23:	85 c9                	test   %ecx,%ecx
+    1a25:	7e 06                	jle    1a2d <drain+0x4d>
+    1a27:	8b 02                	mov    (%edx),%eax
+    1a29:	85 c0                	test   %eax,%eax
+    1a2b:	75 db                	jne    1a08 <drain+0x28>
+  if(threaded)
+    1a2d:	a1 64 36 00 00       	mov    0x3664,%eax
+    1a32:	85 c0                	test   %eax,%eax
+    1a34:	74 10                	je     1a46 <drain+0x66>
+    mutex_unlock(&lock);
+    1a36:	83 ec 0c             	sub    $0xc,%esp
+    1a39:	68 68 36 00 00       	push   $0x3668
+    1a3e:	e8 1d ec ff ff       	call   660 <mutex_unlock>
+}
+    1a43:	83 c4 10             	add    $0x10,%esp
+  }
+  release();
+}
+    1a46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a49:	5b                   	pop    %ebx
+    1a4a:	5e                   	pop    %esi
+    1a4b:	5f                   	pop    %edi
+    1a4c:	5d                   	pop    %ebp
+    1a4d:	c3                   	ret
+    1a4e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&lock);
+    1a50:	83 ec 0c             	sub    $0xc,%esp
+    1a53:	68 68 36 00 00       	push   $0x3668
+    1a58:	e8 b3 eb ff ff       	call   610 <mutex_lock>
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1a5d:	83 c4 10             	add    $0x10,%esp
+    1a60:	85 db                	test   %ebx,%ebx
+    1a62:	7f 99                	jg     19fd <drain+0x1d>
+    1a64:	eb c7                	jmp    1a2d <drain+0x4d>
+    1a66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001a70 <mycache>:
+{
+    1a70:	55                   	push   %ebp
+    return &maincache;
+    1a71:	b8 80 36 00 00       	mov    $0x3680,%eax
+{
+    1a76:	89 e5                	mov    %esp,%ebp
+    1a78:	53                   	push   %ebx
+  sp = PGROUNDDOWN((uint)&sp);
+    1a79:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+    1a7c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+    1a82:	83 ec 14             	sub    $0x14,%esp
+  if(!threaded || sp == mainstack)
+    1a85:	8b 0d 64 36 00 00    	mov    0x3664,%ecx
+  sp = PGROUNDDOWN((uint)&sp);
+    1a8b:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  if(!threaded || sp == mainstack)
+    1a8e:	85 c9                	test   %ecx,%ecx
+    1a90:	74 0f                	je     1aa1 <mycache+0x31>
+    1a92:	3b 1d 60 36 00 00    	cmp    0x3660,%ebx
+    1a98:	74 07                	je     1aa1 <mycache+0x31>
+  if(*cp == 0){
+    1a9a:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    1a9d:	85 c0                	test   %eax,%eax
+    1a9f:	74 0f                	je     1ab0 <mycache+0x40>
+}
+    1aa1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1aa4:	c9                   	leave
+    1aa5:	c3                   	ret
+    1aa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1aad:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1ab0:	83 ec 0c             	sub    $0xc,%esp
+    1ab3:	68 68 36 00 00       	push   $0x3668
+    1ab8:	e8 53 eb ff ff       	call   610 <mutex_lock>
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    1abd:	b8 09 00 00 00       	mov    $0x9,%eax
+    1ac2:	e8 29 fe ff ff       	call   18f0 <bigalloc>
+  if(threaded)
+    1ac7:	8b 15 64 36 00 00    	mov    0x3664,%edx
+    1acd:	83 c4 10             	add    $0x10,%esp
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    1ad0:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(threaded)
+    1ad3:	85 d2                	test   %edx,%edx
+    1ad5:	75 29                	jne    1b00 <mycache+0x90>
+    if(*cp == 0)
+    1ad7:	85 c0                	test   %eax,%eax
+    1ad9:	74 c6                	je     1aa1 <mycache+0x31>
+    memset(*cp, 0, sizeof(**cp));
+    1adb:	83 ec 04             	sub    $0x4,%esp
+    *cp = (struct tcache*)((Header*)*cp + 1);
+    1ade:	83 c0 08             	add    $0x8,%eax
+    1ae1:	89 43 f8             	mov    %eax,-0x8(%ebx)
+    memset(*cp, 0, sizeof(**cp));
+    1ae4:	6a 40                	push   $0x40
+    1ae6:	6a 00                	push   $0x0
+    1ae8:	50                   	push   %eax
+    1ae9:	e8 f2 e9 ff ff       	call   4e0 <memset>
+  return *cp;
+    1aee:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    1af1:	83 c4 10             	add    $0x10,%esp
+    1af4:	eb ab                	jmp    1aa1 <mycache+0x31>
+    1af6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1afd:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1b00:	83 ec 0c             	sub    $0xc,%esp
+    1b03:	68 68 36 00 00       	push   $0x3668
+    1b08:	e8 53 eb ff ff       	call   660 <mutex_unlock>
+    if(*cp == 0)
+    1b0d:	8b 43 f8             	mov    -0x8(%ebx),%eax
+}
+    1b10:	83 c4 10             	add    $0x10,%esp
+    1b13:	eb c2                	jmp    1ad7 <mycache+0x67>
+    1b15:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001b20 <free>:
+
+void
+free(void *ap)
+{
+    1b20:	55                   	push   %ebp
+    1b21:	89 e5                	mov    %esp,%ebp
+    1b23:	57                   	push   %edi
+    1b24:	56                   	push   %esi
+    1b25:	53                   	push   %ebx
+    1b26:	83 ec 1c             	sub    $0x1c,%esp
+    1b29:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  struct tcache *tc;
+  int c;
+
+  if(ap == 0)
+    1b2c:	85 f6                	test   %esi,%esi
+    1b2e:	74 51                	je     1b81 <free+0x61>
+    return;
+  bp = (Header*)ap - 1;
+    1b30:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1b33:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(bp->s.size > SMALLMAX / sizeof(Header)){
+    1b36:	8b 46 fc             	mov    -0x4(%esi),%eax
+    1b39:	3d 00 01 00 00       	cmp    $0x100,%eax
+    1b3e:	77 50                	ja     1b90 <free+0x70>
+    acquire();
+    trim(bigfree(bp));
+    release();
+    return;
+  }
+  for(c = 0; (2 << c) < bp->s.size; c++)
+    1b40:	31 db                	xor    %ebx,%ebx
+    1b42:	ba 02 00 00 00       	mov    $0x2,%edx
+    1b47:	83 f8 02             	cmp    $0x2,%eax
+    1b4a:	76 11                	jbe    1b5d <free+0x3d>
+    1b4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1b50:	83 c3 01             	add    $0x1,%ebx
+    1b53:	89 d7                	mov    %edx,%edi
+    1b55:	89 d9                	mov    %ebx,%ecx
+    1b57:	d3 e7                	shl    %cl,%edi
+    1b59:	39 c7                	cmp    %eax,%edi
+    1b5b:	72 f3                	jb     1b50 <free+0x30>
+    ;
+  if((tc = mycache()) == 0){
+    1b5d:	e8 0e ff ff ff       	call   1a70 <mycache>
+    1b62:	85 c0                	test   %eax,%eax
+    1b64:	74 7a                	je     1be0 <free+0xc0>
+    bp->s.ptr = small[c];
+    small[c] = bp;
+    release();
+    return;
+  }
+  bp->s.ptr = tc->list[c];
+    1b66:	8d 0c 98             	lea    (%eax,%ebx,4),%ecx
+    1b69:	8b 11                	mov    (%ecx),%edx
+    1b6b:	89 56 f8             	mov    %edx,-0x8(%esi)
+  tc->list[c] = bp;
+    1b6e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1b71:	89 31                	mov    %esi,(%ecx)
+  if(++tc->n[c] > TCACHEMAX)
+    1b73:	8b 71 20             	mov    0x20(%ecx),%esi
+    1b76:	8d 56 01             	lea    0x1(%esi),%edx
+    1b79:	89 51 20             	mov    %edx,0x20(%ecx)
+    1b7c:	83 fa 20             	cmp    $0x20,%edx
+    1b7f:	7f 47                	jg     1bc8 <free+0xa8>
+    drain(tc, c, BATCH);
+}
+    1b81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b84:	5b                   	pop    %ebx
+    1b85:	5e                   	pop    %esi
+    1b86:	5f                   	pop    %edi
+    1b87:	5d                   	pop    %ebp
+    1b88:	c3                   	ret
+    1b89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1b90:	8b 1d 64 36 00 00    	mov    0x3664,%ebx
+    1b96:	85 db                	test   %ebx,%ebx
+    1b98:	75 66                	jne    1c00 <free+0xe0>
+    trim(bigfree(bp));
+    1b9a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1b9d:	e8 4e fc ff ff       	call   17f0 <bigfree>
+    1ba2:	e8 c9 fc ff ff       	call   1870 <trim>
+  if(threaded)
+    1ba7:	8b 0d 64 36 00 00    	mov    0x3664,%ecx
+    1bad:	85 c9                	test   %ecx,%ecx
+    1baf:	74 d0                	je     1b81 <free+0x61>
+    mutex_unlock(&lock);
+    1bb1:	c7 45 08 68 36 00 00 	movl   $0x3668,0x8(%ebp)
+}
+    1bb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1bbb:	5b                   	pop    %ebx
+    1bbc:	5e                   	pop    %esi
+    1bbd:	5f                   	pop    %edi
+    1bbe:	5d                   	pop    %ebp
+    mutex_unlock(&lock);
+    1bbf:	e9 9c ea ff ff       	jmp    660 <mutex_unlock>
+    1bc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    1bc8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    drain(tc, c, BATCH);
+    1bcb:	89 da                	mov    %ebx,%edx
+    1bcd:	b9 10 00 00 00       	mov    $0x10,%ecx
+}
+    1bd2:	5b                   	pop    %ebx
+    1bd3:	5e                   	pop    %esi
+    1bd4:	5f                   	pop    %edi
+    1bd5:	5d                   	pop    %ebp
+    drain(tc, c, BATCH);
+    1bd6:	e9 05 fe ff ff       	jmp    19e0 <drain>
+    1bdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1bdf:	90                   	nop
+  if(threaded)
+    1be0:	8b 15 64 36 00 00    	mov    0x3664,%edx
+    1be6:	85 d2                	test   %edx,%edx
+    1be8:	75 28                	jne    1c12 <free+0xf2>
+    bp->s.ptr = small[c];
+    1bea:	8b 04 9d c0 36 00 00 	mov    0x36c0(,%ebx,4),%eax
+    1bf1:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1bf4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1bf7:	89 04 9d c0 36 00 00 	mov    %eax,0x36c0(,%ebx,4)
+  if(threaded)
+    1bfe:	eb 81                	jmp    1b81 <free+0x61>
+    mutex_lock(&lock);
+    1c00:	83 ec 0c             	sub    $0xc,%esp
+    1c03:	68 68 36 00 00       	push   $0x3668
+    1c08:	e8 03 ea ff ff       	call   610 <mutex_lock>
+}
+    1c0d:	83 c4 10             	add    $0x10,%esp
+    1c10:	eb 88                	jmp    1b9a <free+0x7a>
+    mutex_lock(&lock);
+    1c12:	83 ec 0c             	sub    $0xc,%esp
+    1c15:	68 68 36 00 00       	push   $0x3668
+    1c1a:	e8 f1 e9 ff ff       	call   610 <mutex_lock>
+    bp->s.ptr = small[c];
+    1c1f:	8b 04 9d c0 36 00 00 	mov    0x36c0(,%ebx,4),%eax
+  if(threaded)
+    1c26:	83 c4 10             	add    $0x10,%esp
+    bp->s.ptr = small[c];
+    1c29:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1c2c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1c2f:	89 04 9d c0 36 00 00 	mov    %eax,0x36c0(,%ebx,4)
+  if(threaded)
+    1c36:	a1 64 36 00 00       	mov    0x3664,%eax
+    1c3b:	85 c0                	test   %eax,%eax
+    1c3d:	0f 85 6e ff ff ff    	jne    1bb1 <free+0x91>
+    1c43:	e9 39 ff ff ff       	jmp    1b81 <free+0x61>
+    1c48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c4f:	90                   	nop
+
+00001c50 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1c50:	55                   	push   %ebp
+    1c51:	89 e5                	mov    %esp,%ebp
+    1c53:	57                   	push   %edi
+    1c54:	56                   	push   %esi
+    1c55:	53                   	push   %ebx
+    1c56:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  struct tcache *tc;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1c59:	8b 45 08             	mov    0x8(%ebp),%eax
+    1c5c:	8d 78 07             	lea    0x7(%eax),%edi
+    1c5f:	c1 ef 03             	shr    $0x3,%edi
+    1c62:	83 c7 01             	add    $0x1,%edi
+  if(nunits > SMALLMAX / sizeof(Header)){
+    1c65:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+    1c6b:	77 5b                	ja     1cc8 <malloc+0x78>
+    acquire();
+    p = bigalloc(nunits);
+    release();
+    return p ? (void*)(p + 1) : 0;
+  }
+  for(c = 0; (2 << c) < nunits; c++)
+    1c6d:	31 c9                	xor    %ecx,%ecx
+    1c6f:	b8 02 00 00 00       	mov    $0x2,%eax
+    1c74:	be 02 00 00 00       	mov    $0x2,%esi
+    1c79:	bb 02 00 00 00       	mov    $0x2,%ebx
+    1c7e:	83 ff 02             	cmp    $0x2,%edi
+    1c81:	76 12                	jbe    1c95 <malloc+0x45>
+    1c83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1c87:	90                   	nop
+    1c88:	83 c1 01             	add    $0x1,%ecx
+    1c8b:	89 c3                	mov    %eax,%ebx
+    1c8d:	d3 e3                	shl    %cl,%ebx
+    1c8f:	89 de                	mov    %ebx,%esi
+    1c91:	39 fb                	cmp    %edi,%ebx
+    1c93:	72 f3                	jb     1c88 <malloc+0x38>
+    1c95:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    ;
+  if((tc = mycache()) == 0)
+    1c98:	e8 d3 fd ff ff       	call   1a70 <mycache>
+    1c9d:	85 c0                	test   %eax,%eax
+    1c9f:	74 51                	je     1cf2 <malloc+0xa2>
+    return 0;
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1ca1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1ca4:	8d 3c 88             	lea    (%eax,%ecx,4),%edi
+    1ca7:	8b 07                	mov    (%edi),%eax
+    1ca9:	85 c0                	test   %eax,%eax
+    1cab:	74 53                	je     1d00 <malloc+0xb0>
+    return 0;
+  p = tc->list[c];
+  tc->list[c] = p->s.ptr;
+  tc->n[c]--;
+    1cad:	8b 57 20             	mov    0x20(%edi),%edx
+  tc->list[c] = p->s.ptr;
+    1cb0:	8b 08                	mov    (%eax),%ecx
+  tc->n[c]--;
+    1cb2:	83 ea 01             	sub    $0x1,%edx
+  return (void*)(p + 1);
+    1cb5:	83 c0 08             	add    $0x8,%eax
+  tc->n[c]--;
+    1cb8:	89 57 20             	mov    %edx,0x20(%edi)
+  tc->list[c] = p->s.ptr;
+    1cbb:	89 0f                	mov    %ecx,(%edi)
+}
+    1cbd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1cc0:	5b                   	pop    %ebx
+    1cc1:	5e                   	pop    %esi
+    1cc2:	5f                   	pop    %edi
+    1cc3:	5d                   	pop    %ebp
+    1cc4:	c3                   	ret
+    1cc5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1cc8:	a1 64 36 00 00       	mov    0x3664,%eax
+    1ccd:	85 c0                	test   %eax,%eax
+    1ccf:	0f 85 b3 00 00 00    	jne    1d88 <malloc+0x138>
+    p = bigalloc(nunits);
+    1cd5:	89 f8                	mov    %edi,%eax
+    1cd7:	e8 14 fc ff ff       	call   18f0 <bigalloc>
+    1cdc:	89 c3                	mov    %eax,%ebx
+  if(threaded)
+    1cde:	a1 64 36 00 00       	mov    0x3664,%eax
+    1ce3:	85 c0                	test   %eax,%eax
+    1ce5:	0f 85 85 00 00 00    	jne    1d70 <malloc+0x120>
+    return p ? (void*)(p + 1) : 0;
+    1ceb:	8d 43 08             	lea    0x8(%ebx),%eax
+    1cee:	85 db                	test   %ebx,%ebx
+    1cf0:	75 cb                	jne    1cbd <malloc+0x6d>
+    1cf2:	31 c0                	xor    %eax,%eax
+}
+    1cf4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1cf7:	5b                   	pop    %ebx
+    1cf8:	5e                   	pop    %esi
+    1cf9:	5f                   	pop    %edi
+    1cfa:	5d                   	pop    %ebp
+    1cfb:	c3                   	ret
+    1cfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1d00:	a1 64 36 00 00       	mov    0x3664,%eax
+    1d05:	85 c0                	test   %eax,%eax
+    1d07:	0f 85 29 01 00 00    	jne    1e36 <malloc+0x1e6>
+  if(small[c] == 0){
+    1d0d:	8b 04 8d c0 36 00 00 	mov    0x36c0(,%ecx,4),%eax
+    1d14:	85 c0                	test   %eax,%eax
+    1d16:	0f 84 81 00 00 00    	je     1d9d <malloc+0x14d>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1d1c:	31 db                	xor    %ebx,%ebx
+    1d1e:	eb 22                	jmp    1d42 <malloc+0xf2>
+    small[c] = p->s.ptr;
+    1d20:	8b 10                	mov    (%eax),%edx
+  for(moved = 0; moved < n && small[c]; moved++){
+    1d22:	83 c3 01             	add    $0x1,%ebx
+    small[c] = p->s.ptr;
+    1d25:	89 14 8d c0 36 00 00 	mov    %edx,0x36c0(,%ecx,4)
+    p->s.ptr = tc->list[c];
+    1d2c:	8b 17                	mov    (%edi),%edx
+    1d2e:	89 10                	mov    %edx,(%eax)
+    tc->list[c] = p;
+    1d30:	89 07                	mov    %eax,(%edi)
+  for(moved = 0; moved < n && small[c]; moved++){
+    1d32:	83 fb 10             	cmp    $0x10,%ebx
+    1d35:	0f 84 e2 00 00 00    	je     1e1d <malloc+0x1cd>
+    1d3b:	8b 04 8d c0 36 00 00 	mov    0x36c0(,%ecx,4),%eax
+    1d42:	85 c0                	test   %eax,%eax
+    1d44:	75 da                	jne    1d20 <malloc+0xd0>
+  if(threaded)
+    1d46:	8b 15 64 36 00 00    	mov    0x3664,%edx
+    1d4c:	85 d2                	test   %edx,%edx
+    1d4e:	0f 85 b4 00 00 00    	jne    1e08 <malloc+0x1b8>
+  tc->n[c] += moved;
+    1d54:	8b 57 20             	mov    0x20(%edi),%edx
+    1d57:	01 da                	add    %ebx,%edx
+    1d59:	89 57 20             	mov    %edx,0x20(%edi)
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1d5c:	85 db                	test   %ebx,%ebx
+    1d5e:	74 92                	je     1cf2 <malloc+0xa2>
+  p = tc->list[c];
+    1d60:	8b 07                	mov    (%edi),%eax
+    1d62:	e9 49 ff ff ff       	jmp    1cb0 <malloc+0x60>
+    1d67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d6e:	66 90                	xchg   %ax,%ax
+    mutex_unlock(&lock);
+    1d70:	83 ec 0c             	sub    $0xc,%esp
+    1d73:	68 68 36 00 00       	push   $0x3668
+    1d78:	e8 e3 e8 ff ff       	call   660 <mutex_unlock>
+}
+    1d7d:	83 c4 10             	add    $0x10,%esp
+    1d80:	e9 66 ff ff ff       	jmp    1ceb <malloc+0x9b>
+    1d85:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1d88:	83 ec 0c             	sub    $0xc,%esp
+    1d8b:	68 68 36 00 00       	push   $0x3668
+    1d90:	e8 7b e8 ff ff       	call   610 <mutex_lock>
+}
+    1d95:	83 c4 10             	add    $0x10,%esp
+    1d98:	e9 38 ff ff ff       	jmp    1cd5 <malloc+0x85>
+    if((chunk = bigalloc(CHUNK / sizeof(Header) + 1)) == 0){
+    1d9d:	b8 01 02 00 00       	mov    $0x201,%eax
+    1da2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1da5:	e8 46 fb ff ff       	call   18f0 <bigalloc>
+    1daa:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1dad:	85 c0                	test   %eax,%eax
+    1daf:	89 c2                	mov    %eax,%edx
+    1db1:	0f 84 ba 00 00 00    	je     1e71 <malloc+0x221>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1db7:	83 c2 08             	add    $0x8,%edx
+    1dba:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+    1dc0:	0f 87 d0 00 00 00    	ja     1e96 <malloc+0x246>
+    1dc6:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+    1dcd:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    1dd0:	89 df                	mov    %ebx,%edi
+    1dd2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1dd5:	8d 76 00             	lea    0x0(%esi),%esi
+      p->s.size = units;
+    1dd8:	89 72 04             	mov    %esi,0x4(%edx)
+      p->s.ptr = small[c];
+    1ddb:	8b 04 8d c0 36 00 00 	mov    0x36c0(,%ecx,4),%eax
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1de2:	01 df                	add    %ebx,%edi
+    1de4:	89 55 e0             	mov    %edx,-0x20(%ebp)
+      p->s.ptr = small[c];
+    1de7:	89 02                	mov    %eax,(%edx)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1de9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      small[c] = p;
+    1dec:	89 14 8d c0 36 00 00 	mov    %edx,0x36c0(,%ecx,4)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1df3:	01 c2                	add    %eax,%edx
+    1df5:	81 ff 00 02 00 00    	cmp    $0x200,%edi
+    1dfb:	76 db                	jbe    1dd8 <malloc+0x188>
+    1dfd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1e00:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1e03:	e9 14 ff ff ff       	jmp    1d1c <malloc+0xcc>
+    mutex_unlock(&lock);
+    1e08:	83 ec 0c             	sub    $0xc,%esp
+    1e0b:	68 68 36 00 00       	push   $0x3668
+    1e10:	e8 4b e8 ff ff       	call   660 <mutex_unlock>
+}
+    1e15:	83 c4 10             	add    $0x10,%esp
+    1e18:	e9 37 ff ff ff       	jmp    1d54 <malloc+0x104>
+  if(threaded)
+    1e1d:	a1 64 36 00 00       	mov    0x3664,%eax
+    1e22:	85 c0                	test   %eax,%eax
+    1e24:	75 2b                	jne    1e51 <malloc+0x201>
+  tc->n[c] += moved;
+    1e26:	8b 47 20             	mov    0x20(%edi),%eax
+    1e29:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1e2c:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1e2e:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1e31:	e9 7a fe ff ff       	jmp    1cb0 <malloc+0x60>
+    mutex_lock(&lock);
+    1e36:	83 ec 0c             	sub    $0xc,%esp
+    1e39:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1e3c:	68 68 36 00 00       	push   $0x3668
+    1e41:	e8 ca e7 ff ff       	call   610 <mutex_lock>
+}
+    1e46:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1e49:	83 c4 10             	add    $0x10,%esp
+    1e4c:	e9 bc fe ff ff       	jmp    1d0d <malloc+0xbd>
+    mutex_unlock(&lock);
+    1e51:	83 ec 0c             	sub    $0xc,%esp
+    1e54:	68 68 36 00 00       	push   $0x3668
+    1e59:	e8 02 e8 ff ff       	call   660 <mutex_unlock>
+  tc->n[c] += moved;
+    1e5e:	8b 47 20             	mov    0x20(%edi),%eax
+    1e61:	83 c4 10             	add    $0x10,%esp
+    1e64:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1e67:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1e69:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1e6c:	e9 3f fe ff ff       	jmp    1cb0 <malloc+0x60>
+  if(threaded)
+    1e71:	8b 0d 64 36 00 00    	mov    0x3664,%ecx
+    1e77:	85 c9                	test   %ecx,%ecx
+    1e79:	0f 84 73 fe ff ff    	je     1cf2 <malloc+0xa2>
+    mutex_unlock(&lock);
+    1e7f:	83 ec 0c             	sub    $0xc,%esp
+    1e82:	68 68 36 00 00       	push   $0x3668
+    1e87:	e8 d4 e7 ff ff       	call   660 <mutex_unlock>
+    1e8c:	83 c4 10             	add    $0x10,%esp
+    return p ? (void*)(p + 1) : 0;
+    1e8f:	31 c0                	xor    %eax,%eax
+    1e91:	e9 5e fe ff ff       	jmp    1cf4 <malloc+0xa4>
+  for(moved = 0; moved < n && small[c]; moved++){
+    1e96:	8b 04 8d c0 36 00 00 	mov    0x36c0(,%ecx,4),%eax
+    1e9d:	e9 7a fe ff ff       	jmp    1d1c <malloc+0xcc>
+    1ea2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ea9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001eb0 <malloc_threaded>:
+void
+malloc_threaded(void)
+{
+  uint sp;
+
+  if(threaded)
+    1eb0:	a1 64 36 00 00       	mov    0x3664,%eax
+    1eb5:	85 c0                	test   %eax,%eax
+    1eb7:	74 07                	je     1ec0 <malloc_threaded+0x10>
+    1eb9:	c3                   	ret
+    1eba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+{
+    1ec0:	55                   	push   %ebp
+    1ec1:	89 e5                	mov    %esp,%ebp
+    1ec3:	83 ec 24             	sub    $0x24,%esp
+    return;
+  mutex_init(&lock);
+    1ec6:	68 68 36 00 00       	push   $0x3668
+    1ecb:	e8 30 e7 ff ff       	call   600 <mutex_init>
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1ed0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1ed3:	83 c4 10             	add    $0x10,%esp
+  threaded = 1;
+    1ed6:	c7 05 64 36 00 00 01 	movl   $0x1,0x3664
+    1edd:	00 00 00 
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1ee0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    1ee5:	a3 60 36 00 00       	mov    %eax,0x3660
+}
+    1eea:	c9                   	leave
+    1eeb:	c3                   	ret
+    1eec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001ef0 <malloc_thread_exit>:
+
+// Called by thread_join() with the cache slot of a finished
+// thread: give its blocks, and the cache itself, back.
+void
+malloc_thread_exit(void **cachep)
+{
+    1ef0:	55                   	push   %ebp
+    1ef1:	89 e5                	mov    %esp,%ebp
+    1ef3:	57                   	push   %edi
+    1ef4:	56                   	push   %esi
+    1ef5:	53                   	push   %ebx
+    1ef6:	83 ec 0c             	sub    $0xc,%esp
+    1ef9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct tcache *tc;
+  int c;
+
+  if((tc = *cachep) == 0)
+    1efc:	8b 37                	mov    (%edi),%esi
+    1efe:	85 f6                	test   %esi,%esi
+    1f00:	74 41                	je     1f43 <malloc_thread_exit+0x53>
+    return;
+  for(c = 0; c < NCLASS; c++)
+    1f02:	31 db                	xor    %ebx,%ebx
+    1f04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    drain(tc, c, tc->n[c]);
+    1f08:	8b 4c 9e 20          	mov    0x20(%esi,%ebx,4),%ecx
+    1f0c:	89 da                	mov    %ebx,%edx
+    1f0e:	89 f0                	mov    %esi,%eax
+  for(c = 0; c < NCLASS; c++)
+    1f10:	83 c3 01             	add    $0x1,%ebx
+    drain(tc, c, tc->n[c]);
+    1f13:	e8 c8 fa ff ff       	call   19e0 <drain>
+  for(c = 0; c < NCLASS; c++)
+    1f18:	83 fb 08             	cmp    $0x8,%ebx
+    1f1b:	75 eb                	jne    1f08 <malloc_thread_exit+0x18>
+  if(threaded)
+    1f1d:	8b 15 64 36 00 00    	mov    0x3664,%edx
+    1f23:	85 d2                	test   %edx,%edx
+    1f25:	75 29                	jne    1f50 <malloc_thread_exit+0x60>
+  acquire();
+  trim(bigfree((Header*)tc - 1));
+    1f27:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1f2a:	e8 c1 f8 ff ff       	call   17f0 <bigfree>
+    1f2f:	e8 3c f9 ff ff       	call   1870 <trim>
+  if(threaded)
+    1f34:	a1 64 36 00 00       	mov    0x3664,%eax
+    1f39:	85 c0                	test   %eax,%eax
+    1f3b:	75 2b                	jne    1f68 <malloc_thread_exit+0x78>
+  release();
+  *cachep = 0;
+    1f3d:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+}
+    1f43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1f46:	5b                   	pop    %ebx
+    1f47:	5e                   	pop    %esi
+    1f48:	5f                   	pop    %edi
+    1f49:	5d                   	pop    %ebp
+    1f4a:	c3                   	ret
+    1f4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1f4f:	90                   	nop
+    mutex_lock(&lock);
+    1f50:	83 ec 0c             	sub    $0xc,%esp
+    1f53:	68 68 36 00 00       	push   $0x3668
+    1f58:	e8 b3 e6 ff ff       	call   610 <mutex_lock>
+}
+    1f5d:	83 c4 10             	add    $0x10,%esp
+    1f60:	eb c5                	jmp    1f27 <malloc_thread_exit+0x37>
+    1f62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1f68:	83 ec 0c             	sub    $0xc,%esp
+    1f6b:	68 68 36 00 00       	push   $0x3668
+    1f70:	e8 eb e6 ff ff       	call   660 <mutex_unlock>
+}
+    1f75:	83 c4 10             	add    $0x10,%esp
+    1f78:	eb c3                	jmp    1f3d <malloc_thread_exit+0x4d>
+    1f7a:	66 90                	xchg   %ax,%ax
+    1f7c:	66 90                	xchg   %ax,%ax
+    1f7e:	66 90                	xchg   %ax,%ax
+
+00001f80 <thread_create>:
+
+// Start fn(arg) in a new thread on a freshly allocated
+// page-aligned stack.  Returns the thread's pid.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1f80:	55                   	push   %ebp
+    1f81:	89 e5                	mov    %esp,%ebp
+    1f83:	53                   	push   %ebx
+    1f84:	83 ec 14             	sub    $0x14,%esp
+  char *mem, *stack;
+  int pid;
+
+  malloc_threaded();
+    1f87:	e8 24 ff ff ff       	call   1eb0 <malloc_threaded>
+  stdio_threaded();
+    1f8c:	e8 cf ee ff ff       	call   e60 <stdio_threaded>
+  if((mem = malloc(2*PGSIZE)) == 0)
+    1f91:	83 ec 0c             	sub    $0xc,%esp
+    1f94:	68 00 20 00 00       	push   $0x2000
+    1f99:	e8 b2 fc ff ff       	call   1c50 <malloc>
+    1f9e:	83 c4 10             	add    $0x10,%esp
+    1fa1:	85 c0                	test   %eax,%eax
+    1fa3:	74 52                	je     1ff7 <thread_create+0x77>
+    1fa5:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1fa7:	8d 80 07 10 00 00    	lea    0x1007(%eax),%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+  ((char**)stack)[-2] = 0;
+  if((pid = clone(fn, arg, stack)) < 0)
+    1fad:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1fb0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+    1fb5:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  ((char**)stack)[-2] = 0;
+    1fb8:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+  if((pid = clone(fn, arg, stack)) < 0)
+    1fbf:	50                   	push   %eax
+    1fc0:	ff 75 0c             	push   0xc(%ebp)
+    1fc3:	ff 75 08             	push   0x8(%ebp)
+    1fc6:	e8 97 e8 ff ff       	call   862 <clone>
+    1fcb:	83 c4 10             	add    $0x10,%esp
+    1fce:	85 c0                	test   %eax,%eax
+    1fd0:	78 0e                	js     1fe0 <thread_create+0x60>
+    free(mem);
+  return pid;
+}
+    1fd2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1fd5:	c9                   	leave
+    1fd6:	c3                   	ret
+    1fd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1fde:	66 90                	xchg   %ax,%ax
+    free(mem);
+    1fe0:	83 ec 0c             	sub    $0xc,%esp
+    1fe3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1fe6:	53                   	push   %ebx
+    1fe7:	e8 34 fb ff ff       	call   1b20 <free>
+    1fec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1fef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    1ff2:	83 c4 10             	add    $0x10,%esp
+}
+    1ff5:	c9                   	leave
+    1ff6:	c3                   	ret
+    return -1;
+    1ff7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1ffc:	eb d4                	jmp    1fd2 <thread_create+0x52>
+    1ffe:	66 90                	xchg   %ax,%ax
+
+00002000 <thread_join>:
+
+// Wait for a thread to finish and free its stack.
+int
+thread_join(void)
+{
+    2000:	55                   	push   %ebp
+    2001:	89 e5                	mov    %esp,%ebp
+    2003:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    2004:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    2007:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    200a:	50                   	push   %eax
+    200b:	e8 61 e8 ff ff       	call   871 <join>
+    2010:	83 c4 10             	add    $0x10,%esp
+    2013:	85 c0                	test   %eax,%eax
+    2015:	78 29                	js     2040 <thread_join+0x40>
+    2017:	89 c3                	mov    %eax,%ebx
+    return -1;
+  malloc_thread_exit(&((void**)stack)[-2]);
+    2019:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    201c:	83 ec 0c             	sub    $0xc,%esp
+    201f:	83 e8 08             	sub    $0x8,%eax
+    2022:	50                   	push   %eax
+    2023:	e8 c8 fe ff ff       	call   1ef0 <malloc_thread_exit>
+  free(((char**)stack)[-1]);
+    2028:	58                   	pop    %eax
+    2029:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    202c:	ff 70 fc             	push   -0x4(%eax)
+    202f:	e8 ec fa ff ff       	call   1b20 <free>
+  return pid;
+    2034:	83 c4 10             	add    $0x10,%esp
+}
+    2037:	89 d8                	mov    %ebx,%eax
+    2039:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    203c:	c9                   	leave
+    203d:	c3                   	ret
+    203e:	66 90                	xchg   %ax,%ax
+    return -1;
+    2040:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    2045:	eb f0                	jmp    2037 <thread_join+0x37>
@@ -0,0 +1,4038 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	53                   	push   %ebx
+       e:	51                   	push   %ecx
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+       f:	83 ec 08             	sub    $0x8,%esp
+      12:	6a 02                	push   $0x2
+      14:	68 98 1d 00 00       	push   $0x1d98
+      19:	e8 ef 04 00 00       	call   50d <open>
+      1e:	83 c4 10             	add    $0x10,%esp
+      21:	85 c0                	test   %eax,%eax
+      23:	0f 88 9f 00 00 00    	js     c8 <main+0xc8>
+    mknod("console", 1, 1);
+    open("console", O_RDWR);
+  }
+  dup(0);  // stdout
+      29:	83 ec 0c             	sub    $0xc,%esp
+      2c:	6a 00                	push   $0x0
+      2e:	e8 43 05 00 00       	call   576 <dup>
+  dup(0);  // stderr
+      33:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+      3a:	e8 37 05 00 00       	call   576 <dup>
+      3f:	83 c4 10             	add    $0x10,%esp
+      42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+      48:	83 ec 08             	sub    $0x8,%esp
+      4b:	68 a0 1d 00 00       	push   $0x1da0
+      50:	6a 01                	push   $0x1
+      52:	e8 b9 08 00 00       	call   910 <printf>
+    pid = fork();
+      57:	e8 94 00 00 00       	call   f0 <fork>
+    if(pid < 0){
+      5c:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+      5f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+      61:	85 c0                	test   %eax,%eax
+      63:	78 2c                	js     91 <main+0x91>
+      printf(1, "init: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      65:	74 3d                	je     a4 <main+0xa4>
+      67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      6e:	66 90                	xchg   %ax,%ax
+      exec("sh", argv);
+      printf(1, "init: exec sh failed\n");
+      exit();
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+      70:	e8 2f 04 00 00       	call   4a4 <wait>
+      75:	85 c0                	test   %eax,%eax
+      77:	78 cf                	js     48 <main+0x48>
+      79:	39 c3                	cmp    %eax,%ebx
+      7b:	74 cb                	je     48 <main+0x48>
+      printf(1, "zombie!\n");
+      7d:	83 ec 08             	sub    $0x8,%esp
+      80:	68 df 1d 00 00       	push   $0x1ddf
+      85:	6a 01                	push   $0x1
+      87:	e8 84 08 00 00       	call   910 <printf>
+      8c:	83 c4 10             	add    $0x10,%esp
+      8f:	eb df                	jmp    70 <main+0x70>
+      printf(1, "init: fork failed\n");
+      91:	53                   	push   %ebx
+      92:	53                   	push   %ebx
+      93:	68 b3 1d 00 00       	push   $0x1db3
+      98:	6a 01                	push   $0x1
+      9a:	e8 71 08 00 00       	call   910 <printf>
+      exit();
+      9f:	e8 ac 00 00 00       	call   150 <exit>
+      exec("sh", argv);
+      a4:	50                   	push   %eax
+      a5:	50                   	push   %eax
+      a6:	68 c0 27 00 00       	push   $0x27c0
+      ab:	68 c6 1d 00 00       	push   $0x1dc6
+      b0:	e8 6b 00 00 00       	call   120 <exec>
+      printf(1, "init: exec sh failed\n");
+      b5:	5a                   	pop    %edx
+      b6:	59                   	pop    %ecx
+      b7:	68 c9 1d 00 00       	push   $0x1dc9
+      bc:	6a 01                	push   $0x1
+      be:	e8 4d 08 00 00       	call   910 <printf>
+      exit();
+      c3:	e8 88 00 00 00       	call   150 <exit>
+    mknod("console", 1, 1);
+      c8:	50                   	push   %eax
+      c9:	6a 01                	push   $0x1
+      cb:	6a 01                	push   $0x1
+      cd:	68 98 1d 00 00       	push   $0x1d98
+      d2:	e8 45 04 00 00       	call   51c <mknod>
+    open("console", O_RDWR);
+      d7:	58                   	pop    %eax
+      d8:	5a                   	pop    %edx
+      d9:	6a 02                	push   $0x2
+      db:	68 98 1d 00 00       	push   $0x1d98
+      e0:	e8 28 04 00 00       	call   50d <open>
+      e5:	83 c4 10             	add    $0x10,%esp
+      e8:	e9 3c ff ff ff       	jmp    29 <main+0x29>
+      ed:	66 90                	xchg   %ax,%ax
+      ef:	90                   	nop
+
+000000f0 <fork>:
+int sysexit(void) __attribute__((noreturn));
+
+int
+fork(void)
+{
+  if(flushhook)
+      f0:	a1 c0 28 00 00       	mov    0x28c0,%eax
+      f5:	85 c0                	test   %eax,%eax
+      f7:	74 17                	je     110 <fork+0x20>
+{
+      f9:	55                   	push   %ebp
+      fa:	89 e5                	mov    %esp,%ebp
+      fc:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+      ff:	ff d0                	call   *%eax
+  return sysfork();
+}
+     101:	c9                   	leave
+  return sysfork();
+     102:	e9 7f 03 00 00       	jmp    486 <sysfork>
+     107:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     10e:	66 90                	xchg   %ax,%ax
+     110:	e9 71 03 00 00       	jmp    486 <sysfork>
+     115:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     11c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000120 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+     120:	55                   	push   %ebp
+  if(flushhook)
+     121:	a1 c0 28 00 00       	mov    0x28c0,%eax
+{
+     126:	89 e5                	mov    %esp,%ebp
+     128:	56                   	push   %esi
+     129:	53                   	push   %ebx
+     12a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     12d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     130:	85 c0                	test   %eax,%eax
+     132:	74 02                	je     136 <exec+0x16>
+    flushhook();
+     134:	ff d0                	call   *%eax
+  return sysexec(path, argv);
+     136:	89 75 0c             	mov    %esi,0xc(%ebp)
+     139:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     13c:	5b                   	pop    %ebx
+     13d:	5e                   	pop    %esi
+     13e:	5d                   	pop    %ebp
+  return sysexec(path, argv);
+     13f:	e9 ba 03 00 00       	jmp    4fe <sysexec>
+     144:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     14b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     14f:	90                   	nop
+
+00000150 <exit>:
+
+int
+exit(void)
+{
+     150:	55                   	push   %ebp
+     151:	89 e5                	mov    %esp,%ebp
+     153:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     156:	a1 c0 28 00 00       	mov    0x28c0,%eax
+     15b:	85 c0                	test   %eax,%eax
+     15d:	74 02                	je     161 <exit+0x11>
+    flushhook();
+     15f:	ff d0                	call   *%eax
+  sysexit();
+     161:	e8 2f 03 00 00       	call   495 <sysexit>
+     166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     16d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000170 <strcpy>:
+}
+
+char*
+strcpy(char *s, const char *t)
+{
+     170:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     171:	31 c0                	xor    %eax,%eax
+{
+     173:	89 e5                	mov    %esp,%ebp
+     175:	53                   	push   %ebx
+     176:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     179:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     17c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     180:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     184:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     187:	83 c0 01             	add    $0x1,%eax
+     18a:	84 d2                	test   %dl,%dl
+     18c:	75 f2                	jne    180 <strcpy+0x10>
+    ;
+  return os;
+}
+     18e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     191:	89 c8                	mov    %ecx,%eax
+     193:	c9                   	leave
+     194:	c3                   	ret
+     195:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     19c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     1a0:	55                   	push   %ebp
+     1a1:	89 e5                	mov    %esp,%ebp
+     1a3:	53                   	push   %ebx
+     1a4:	8b 55 08             	mov    0x8(%ebp),%edx
+     1a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     1aa:	0f b6 02             	movzbl (%edx),%eax
+     1ad:	84 c0                	test   %al,%al
+     1af:	75 17                	jne    1c8 <strcmp+0x28>
+     1b1:	eb 3a                	jmp    1ed <strcmp+0x4d>
+     1b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1b7:	90                   	nop
+     1b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     1bc:	83 c2 01             	add    $0x1,%edx
+     1bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     1c2:	84 c0                	test   %al,%al
+     1c4:	74 1a                	je     1e0 <strcmp+0x40>
+    p++, q++;
+     1c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     1c8:	0f b6 19             	movzbl (%ecx),%ebx
+     1cb:	38 c3                	cmp    %al,%bl
+     1cd:	74 e9                	je     1b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     1cf:	29 d8                	sub    %ebx,%eax
+}
+     1d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1d4:	c9                   	leave
+     1d5:	c3                   	ret
+     1d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     1e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     1e4:	31 c0                	xor    %eax,%eax
+     1e6:	29 d8                	sub    %ebx,%eax
+}
+     1e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1eb:	c9                   	leave
+     1ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     1ed:	0f b6 19             	movzbl (%ecx),%ebx
+     1f0:	31 c0                	xor    %eax,%eax
+     1f2:	eb db                	jmp    1cf <strcmp+0x2f>
+     1f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1ff:	90                   	nop
+
+00000200 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     200:	55                   	push   %ebp
+     201:	89 e5                	mov    %esp,%ebp
+     203:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     206:	80 3a 00             	cmpb   $0x0,(%edx)
+     209:	74 15                	je     220 <strlen+0x20>
+     20b:	31 c0                	xor    %eax,%eax
+     20d:	8d 76 00             	lea    0x0(%esi),%esi
+     210:	83 c0 01             	add    $0x1,%eax
+     213:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     217:	89 c1                	mov    %eax,%ecx
+     219:	75 f5                	jne    210 <strlen+0x10>
+    ;
+  return n;
+}
+     21b:	89 c8                	mov    %ecx,%eax
+     21d:	5d                   	pop    %ebp
+     21e:	c3                   	ret
+     21f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     220:	31 c9                	xor    %ecx,%ecx
+}
+     222:	5d                   	pop    %ebp
+     223:	89 c8                	mov    %ecx,%eax
+     225:	c3                   	ret
+     226:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     22d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000230 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     230:	55                   	push   %ebp
+     231:	89 e5                	mov    %esp,%ebp
+     233:	57                   	push   %edi
+     234:	8b 55 08             	mov    0x8(%ebp),%edx
+            "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt) {
+    asm volatile("cld; rep stosb" :
+     237:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     23a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     23d:	89 d7                	mov    %edx,%edi
+     23f:	fc                   	cld
+     240:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     242:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     245:	89 d0                	mov    %edx,%eax
+     247:	c9                   	leave
+     248:	c3                   	ret
+     249:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000250 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     250:	55                   	push   %ebp
+     251:	89 e5                	mov    %esp,%ebp
+     253:	8b 45 08             	mov    0x8(%ebp),%eax
+     256:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     25a:	0f b6 10             	movzbl (%eax),%edx
+     25d:	84 d2                	test   %dl,%dl
+     25f:	75 12                	jne    273 <strchr+0x23>
+     261:	eb 1d                	jmp    280 <strchr+0x30>
+     263:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     267:	90                   	nop
+     268:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     26c:	83 c0 01             	add    $0x1,%eax
+     26f:	84 d2                	test   %dl,%dl
+     271:	74 0d                	je     280 <strchr+0x30>
+    if(*s == c)
+     273:	38 d1                	cmp    %dl,%cl
+     275:	75 f1                	jne    268 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     277:	5d                   	pop    %ebp
+     278:	c3                   	ret
+     279:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     280:	31 c0                	xor    %eax,%eax
+}
+     282:	5d                   	pop    %ebp
+     283:	c3                   	ret
+     284:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     28b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     28f:	90                   	nop
+
+00000290 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     290:	55                   	push   %ebp
+     291:	89 e5                	mov    %esp,%ebp
+     293:	56                   	push   %esi
+     294:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     295:	83 ec 08             	sub    $0x8,%esp
+     298:	6a 00                	push   $0x0
+     29a:	ff 75 08             	push   0x8(%ebp)
+     29d:	e8 6b 02 00 00       	call   50d <open>
+  if(fd < 0)
+     2a2:	83 c4 10             	add    $0x10,%esp
+     2a5:	85 c0                	test   %eax,%eax
+     2a7:	78 27                	js     2d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     2a9:	83 ec 08             	sub    $0x8,%esp
+     2ac:	ff 75 0c             	push   0xc(%ebp)
+     2af:	89 c3                	mov    %eax,%ebx
+     2b1:	50                   	push   %eax
+     2b2:	e8 83 02 00 00       	call   53a <fstat>
+  close(fd);
+     2b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     2ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+     2bc:	e8 1f 02 00 00       	call   4e0 <close>
+  return r;
+     2c1:	83 c4 10             	add    $0x10,%esp
+}
+     2c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     2c7:	89 f0                	mov    %esi,%eax
+     2c9:	5b                   	pop    %ebx
+     2ca:	5e                   	pop    %esi
+     2cb:	5d                   	pop    %ebp
+     2cc:	c3                   	ret
+     2cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     2d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     2d5:	eb ed                	jmp    2c4 <stat+0x34>
+     2d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2de:	66 90                	xchg   %ax,%ax
+
+000002e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     2e0:	55                   	push   %ebp
+     2e1:	89 e5                	mov    %esp,%ebp
+     2e3:	53                   	push   %ebx
+     2e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     2e7:	0f be 02             	movsbl (%edx),%eax
+     2ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     2ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     2f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     2f5:	77 1e                	ja     315 <atoi+0x35>
+     2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     300:	83 c2 01             	add    $0x1,%edx
+     303:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     306:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     30a:	0f be 02             	movsbl (%edx),%eax
+     30d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     310:	80 fb 09             	cmp    $0x9,%bl
+     313:	76 eb                	jbe    300 <atoi+0x20>
+  return n;
+}
+     315:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     318:	89 c8                	mov    %ecx,%eax
+     31a:	c9                   	leave
+     31b:	c3                   	ret
+     31c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     320:	55                   	push   %ebp
+     321:	89 e5                	mov    %esp,%ebp
+     323:	57                   	push   %edi
+     324:	56                   	push   %esi
+     325:	8b 45 10             	mov    0x10(%ebp),%eax
+     328:	8b 55 08             	mov    0x8(%ebp),%edx
+     32b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     32e:	85 c0                	test   %eax,%eax
+     330:	7e 13                	jle    345 <memmove+0x25>
+     332:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     334:	89 d7                	mov    %edx,%edi
+     336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     33d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     340:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     341:	39 f8                	cmp    %edi,%eax
+     343:	75 fb                	jne    340 <memmove+0x20>
+  return vdst;
+}
+     345:	5e                   	pop    %esi
+     346:	89 d0                	mov    %edx,%eax
+     348:	5f                   	pop    %edi
+     349:	5d                   	pop    %ebp
+     34a:	c3                   	ret
+     34b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     34f:	90                   	nop
+
+00000350 <mutex_init>:
+
+// Futex-based mutex (Drepper, "Futexes Are Tricky", mutex 2).
+// The uncontended paths never enter the kernel.
+void
+mutex_init(struct mutex *m)
+{
+     350:	55                   	push   %ebp
+     351:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+     353:	8b 45 08             	mov    0x8(%ebp),%eax
+     356:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     35c:	5d                   	pop    %ebp
+     35d:	c3                   	ret
+     35e:	66 90                	xchg   %ax,%ax
+
+00000360 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     360:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     361:	31 c0                	xor    %eax,%eax
+     363:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+     368:	89 e5                	mov    %esp,%ebp
+     36a:	56                   	push   %esi
+     36b:	53                   	push   %ebx
+     36c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     36f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     373:	85 c0                	test   %eax,%eax
+     375:	74 32                	je     3a9 <mutex_lock+0x49>
+    return;
+  if(c != 2)
+     377:	83 f8 02             	cmp    $0x2,%eax
+     37a:	74 0c                	je     388 <mutex_lock+0x28>
+static inline uint
+xchg(volatile uint *addr, uint newval) {
+    uint result;
+
+    // The + in "+m" denotes a read-modify-write operand.
+    asm volatile("lock; xchgl %0, %1" :
+     37c:	b8 02 00 00 00       	mov    $0x2,%eax
+     381:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+     384:	85 c0                	test   %eax,%eax
+     386:	74 21                	je     3a9 <mutex_lock+0x49>
+     388:	be 02 00 00 00       	mov    $0x2,%esi
+     38d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAIT, 2);
+     390:	83 ec 04             	sub    $0x4,%esp
+     393:	6a 02                	push   $0x2
+     395:	6a 00                	push   $0x0
+     397:	53                   	push   %ebx
+     398:	e8 33 02 00 00       	call   5d0 <futex>
+     39d:	89 f0                	mov    %esi,%eax
+     39f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     3a2:	83 c4 10             	add    $0x10,%esp
+     3a5:	85 c0                	test   %eax,%eax
+     3a7:	75 e7                	jne    390 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+     3a9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     3ac:	5b                   	pop    %ebx
+     3ad:	5e                   	pop    %esi
+     3ae:	5d                   	pop    %ebp
+     3af:	c3                   	ret
+
+000003b0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     3b0:	55                   	push   %ebp
+     3b1:	89 e5                	mov    %esp,%ebp
+     3b3:	83 ec 08             	sub    $0x8,%esp
+     3b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     3b9:	f0 83 28 01          	lock subl $0x1,(%eax)
+     3bd:	75 09                	jne    3c8 <mutex_unlock+0x18>
+    m->val = 0;
+    futex(&m->val, FUTEX_WAKE, 1);
+  }
+}
+     3bf:	c9                   	leave
+     3c0:	c3                   	ret
+     3c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     3c8:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     3cb:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex(&m->val, FUTEX_WAKE, 1);
+     3d1:	6a 01                	push   $0x1
+     3d3:	6a 01                	push   $0x1
+     3d5:	50                   	push   %eax
+     3d6:	e8 f5 01 00 00       	call   5d0 <futex>
+     3db:	83 c4 10             	add    $0x10,%esp
+}
+     3de:	c9                   	leave
+     3df:	c3                   	ret
+
+000003e0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     3e0:	55                   	push   %ebp
+     3e1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     3e3:	8b 45 08             	mov    0x8(%ebp),%eax
+     3e6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     3ec:	5d                   	pop    %ebp
+     3ed:	c3                   	ret
+     3ee:	66 90                	xchg   %ax,%ax
+
+000003f0 <cond_wait>:
+
+// Release m and wait for a signal, then reacquire m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     3f0:	55                   	push   %ebp
+     3f1:	89 e5                	mov    %esp,%ebp
+     3f3:	57                   	push   %edi
+     3f4:	56                   	push   %esi
+     3f5:	53                   	push   %ebx
+     3f6:	83 ec 0c             	sub    $0xc,%esp
+     3f9:	8b 75 08             	mov    0x8(%ebp),%esi
+     3fc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     3ff:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     401:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+     405:	75 21                	jne    428 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     407:	83 ec 04             	sub    $0x4,%esp
+     40a:	57                   	push   %edi
+     40b:	6a 00                	push   $0x0
+     40d:	56                   	push   %esi
+     40e:	e8 bd 01 00 00       	call   5d0 <futex>
+  mutex_lock(m);
+     413:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     416:	83 c4 10             	add    $0x10,%esp
+}
+     419:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     41c:	5b                   	pop    %ebx
+     41d:	5e                   	pop    %esi
+     41e:	5f                   	pop    %edi
+     41f:	5d                   	pop    %ebp
+  mutex_lock(m);
+     420:	e9 3b ff ff ff       	jmp    360 <mutex_lock>
+     425:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     428:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     42b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex(&m->val, FUTEX_WAKE, 1);
+     431:	6a 01                	push   $0x1
+     433:	6a 01                	push   $0x1
+     435:	53                   	push   %ebx
+     436:	e8 95 01 00 00       	call   5d0 <futex>
+     43b:	83 c4 10             	add    $0x10,%esp
+     43e:	eb c7                	jmp    407 <cond_wait+0x17>
+
+00000440 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+     440:	55                   	push   %ebp
+     441:	89 e5                	mov    %esp,%ebp
+     443:	83 ec 0c             	sub    $0xc,%esp
+     446:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     449:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+     44d:	6a 01                	push   $0x1
+     44f:	6a 01                	push   $0x1
+     451:	50                   	push   %eax
+     452:	e8 79 01 00 00       	call   5d0 <futex>
+}
+     457:	83 c4 10             	add    $0x10,%esp
+     45a:	c9                   	leave
+     45b:	c3                   	ret
+     45c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000460 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     460:	55                   	push   %ebp
+     461:	89 e5                	mov    %esp,%ebp
+     463:	83 ec 0c             	sub    $0xc,%esp
+     466:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     469:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+     46d:	6a 40                	push   $0x40
+     46f:	6a 01                	push   $0x1
+     471:	50                   	push   %eax
+     472:	e8 59 01 00 00       	call   5d0 <futex>
+}
+     477:	83 c4 10             	add    $0x10,%esp
+     47a:	c9                   	leave
+     47b:	c3                   	ret
+     47c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <uptime>:
+// Clock ticks since boot, read from the kernel's vdso page
+// without a system call.
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     480:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+     485:	c3                   	ret
+
+00000486 <sysfork>:
+  1: ret
+
+#define SYSCALL(name) SYSCALLAS(name, name)
+
+// ulib.c wraps these.
+SYSCALLAS(sysfork, fork)
+     486:	b8 01 00 00 00       	mov    $0x1,%eax
+     48b:	89 e1                	mov    %esp,%ecx
+     48d:	ba 94 04 00 00       	mov    $0x494,%edx
+     492:	0f 34                	sysenter
+     494:	c3                   	ret
+
+00000495 <sysexit>:
+SYSCALLAS(sysexit, exit)
+     495:	b8 02 00 00 00       	mov    $0x2,%eax
+     49a:	89 e1                	mov    %esp,%ecx
+     49c:	ba a3 04 00 00       	mov    $0x4a3,%edx
+     4a1:	0f 34                	sysenter
+     4a3:	c3                   	ret
+
+000004a4 <wait>:
+SYSCALL(wait)
+     4a4:	b8 03 00 00 00       	mov    $0x3,%eax
+     4a9:	89 e1                	mov    %esp,%ecx
+     4ab:	ba b2 04 00 00       	mov    $0x4b2,%edx
+     4b0:	0f 34                	sysenter
+     4b2:	c3                   	ret
+
+000004b3 <pipe>:
+SYSCALL(pipe)
+     4b3:	b8 04 00 00 00       	mov    $0x4,%eax
+     4b8:	89 e1                	mov    %esp,%ecx
+     4ba:	ba c1 04 00 00       	mov    $0x4c1,%edx
+     4bf:	0f 34                	sysenter
+     4c1:	c3                   	ret
+
+000004c2 <read>:
+SYSCALL(read)
+     4c2:	b8 05 00 00 00       	mov    $0x5,%eax
+     4c7:	89 e1                	mov    %esp,%ecx
+     4c9:	ba d0 04 00 00       	mov    $0x4d0,%edx
+     4ce:	0f 34                	sysenter
+     4d0:	c3                   	ret
+
+000004d1 <write>:
+SYSCALL(write)
+     4d1:	b8 10 00 00 00       	mov    $0x10,%eax
+     4d6:	89 e1                	mov    %esp,%ecx
+     4d8:	ba df 04 00 00       	mov    $0x4df,%edx
+     4dd:	0f 34                	sysenter
+     4df:	c3                   	ret
+
+000004e0 <close>:
+SYSCALL(close)
+     4e0:	b8 15 00 00 00       	mov    $0x15,%eax
+     4e5:	89 e1                	mov    %esp,%ecx
+     4e7:	ba ee 04 00 00       	mov    $0x4ee,%edx
+     4ec:	0f 34                	sysenter
+     4ee:	c3                   	ret
+
+000004ef <kill>:
+SYSCALL(kill)
+     4ef:	b8 06 00 00 00       	mov    $0x6,%eax
+     4f4:	89 e1                	mov    %esp,%ecx
+     4f6:	ba fd 04 00 00       	mov    $0x4fd,%edx
+     4fb:	0f 34                	sysenter
+     4fd:	c3                   	ret
+
+000004fe <sysexec>:
+SYSCALLAS(sysexec, exec)
+     4fe:	b8 07 00 00 00       	mov    $0x7,%eax
+     503:	89 e1                	mov    %esp,%ecx
+     505:	ba 0c 05 00 00       	mov    $0x50c,%edx
+     50a:	0f 34                	sysenter
+     50c:	c3                   	ret
+
+0000050d <open>:
+SYSCALL(open)
+     50d:	b8 0f 00 00 00       	mov    $0xf,%eax
+     512:	89 e1                	mov    %esp,%ecx
+     514:	ba 1b 05 00 00       	mov    $0x51b,%edx
+     519:	0f 34                	sysenter
+     51b:	c3                   	ret
+
+0000051c <mknod>:
+SYSCALL(mknod)
+     51c:	b8 11 00 00 00       	mov    $0x11,%eax
+     521:	89 e1                	mov    %esp,%ecx
+     523:	ba 2a 05 00 00       	mov    $0x52a,%edx
+     528:	0f 34                	sysenter
+     52a:	c3                   	ret
+
+0000052b <unlink>:
+SYSCALL(unlink)
+     52b:	b8 12 00 00 00       	mov    $0x12,%eax
+     530:	89 e1                	mov    %esp,%ecx
+     532:	ba 39 05 00 00       	mov    $0x539,%edx
+     537:	0f 34                	sysenter
+     539:	c3                   	ret
+
+0000053a <fstat>:
+SYSCALL(fstat)
+     53a:	b8 08 00 00 00       	mov    $0x8,%eax
+     53f:	89 e1                	mov    %esp,%ecx
+     541:	ba 48 05 00 00       	mov    $0x548,%edx
+     546:	0f 34                	sysenter
+     548:	c3                   	ret
+
+00000549 <link>:
+SYSCALL(link)
+     549:	b8 13 00 00 00       	mov    $0x13,%eax
+     54e:	89 e1                	mov    %esp,%ecx
+     550:	ba 57 05 00 00       	mov    $0x557,%edx
+     555:	0f 34                	sysenter
+     557:	c3                   	ret
+
+00000558 <mkdir>:
+SYSCALL(mkdir)
+     558:	b8 14 00 00 00       	mov    $0x14,%eax
+     55d:	89 e1                	mov    %esp,%ecx
+     55f:	ba 66 05 00 00       	mov    $0x566,%edx
+     564:	0f 34                	sysenter
+     566:	c3                   	ret
+
+00000567 <chdir>:
+SYSCALL(chdir)
+     567:	b8 09 00 00 00       	mov    $0x9,%eax
+     56c:	89 e1                	mov    %esp,%ecx
+     56e:	ba 75 05 00 00       	mov    $0x575,%edx
+     573:	0f 34                	sysenter
+     575:	c3                   	ret
+
+00000576 <dup>:
+SYSCALL(dup)
+     576:	b8 0a 00 00 00       	mov    $0xa,%eax
+     57b:	89 e1                	mov    %esp,%ecx
+     57d:	ba 84 05 00 00       	mov    $0x584,%edx
+     582:	0f 34                	sysenter
+     584:	c3                   	ret
+
+00000585 <getpid>:
+SYSCALL(getpid)
+     585:	b8 0b 00 00 00       	mov    $0xb,%eax
+     58a:	89 e1                	mov    %esp,%ecx
+     58c:	ba 93 05 00 00       	mov    $0x593,%edx
+     591:	0f 34                	sysenter
+     593:	c3                   	ret
+
+00000594 <sbrk>:
+SYSCALL(sbrk)
+     594:	b8 0c 00 00 00       	mov    $0xc,%eax
+     599:	89 e1                	mov    %esp,%ecx
+     59b:	ba a2 05 00 00       	mov    $0x5a2,%edx
+     5a0:	0f 34                	sysenter
+     5a2:	c3                   	ret
+
+000005a3 <sleep>:
+SYSCALL(sleep)
+     5a3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     5a8:	89 e1                	mov    %esp,%ecx
+     5aa:	ba b1 05 00 00       	mov    $0x5b1,%edx
+     5af:	0f 34                	sysenter
+     5b1:	c3                   	ret
+
+000005b2 <clone>:
+SYSCALL(clone)
+     5b2:	b8 16 00 00 00       	mov    $0x16,%eax
+     5b7:	89 e1                	mov    %esp,%ecx
+     5b9:	ba c0 05 00 00       	mov    $0x5c0,%edx
+     5be:	0f 34                	sysenter
+     5c0:	c3                   	ret
+
+000005c1 <join>:
+SYSCALL(join)
+     5c1:	b8 17 00 00 00       	mov    $0x17,%eax
+     5c6:	89 e1                	mov    %esp,%ecx
+     5c8:	ba cf 05 00 00       	mov    $0x5cf,%edx
+     5cd:	0f 34                	sysenter
+     5cf:	c3                   	ret
+
+000005d0 <futex>:
+SYSCALL(futex)
+     5d0:	b8 18 00 00 00       	mov    $0x18,%eax
+     5d5:	89 e1                	mov    %esp,%ecx
+     5d7:	ba de 05 00 00       	mov    $0x5de,%edx
+     5dc:	0f 34                	sysenter
+     5de:	c3                   	ret
+
+000005df <yield>:
+SYSCALL(yield)
+     5df:	b8 19 00 00 00       	mov    $0x19,%eax
+     5e4:	89 e1                	mov    %esp,%ecx
+     5e6:	ba ed 05 00 00       	mov    $0x5ed,%edx
+     5eb:	0f 34                	sysenter
+     5ed:	c3                   	ret
+
+000005ee <lockstat>:
+SYSCALL(lockstat)
+     5ee:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     5f3:	89 e1                	mov    %esp,%ecx
+     5f5:	ba fc 05 00 00       	mov    $0x5fc,%edx
+     5fa:	0f 34                	sysenter
+     5fc:	c3                   	ret
+
+000005fd <lockhammer>:
+SYSCALL(lockhammer)
+     5fd:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     602:	89 e1                	mov    %esp,%ecx
+     604:	ba 0b 06 00 00       	mov    $0x60b,%edx
+     609:	0f 34                	sysenter
+     60b:	c3                   	ret
+
+0000060c <vmsplice>:
+SYSCALL(vmsplice)
+     60c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     611:	89 e1                	mov    %esp,%ecx
+     613:	ba 1a 06 00 00       	mov    $0x61a,%edx
+     618:	0f 34                	sysenter
+     61a:	c3                   	ret
+
+0000061b <hsbrk>:
+SYSCALL(hsbrk)
+     61b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     620:	89 e1                	mov    %esp,%ecx
+     622:	ba 29 06 00 00       	mov    $0x629,%edx
+     627:	0f 34                	sysenter
+     629:	c3                   	ret
+
+0000062a <mmap>:
+SYSCALL(mmap)
+     62a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     62f:	89 e1                	mov    %esp,%ecx
+     631:	ba 38 06 00 00       	mov    $0x638,%edx
+     636:	0f 34                	sysenter
+     638:	c3                   	ret
+
+00000639 <munmap>:
+SYSCALL(munmap)
+     639:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     63e:	89 e1                	mov    %esp,%ecx
+     640:	ba 47 06 00 00       	mov    $0x647,%edx
+     645:	0f 34                	sysenter
+     647:	c3                   	ret
+
+00000648 <ringenter>:
+SYSCALL(ringenter)
+     648:	b8 20 00 00 00       	mov    $0x20,%eax
+     64d:	89 e1                	mov    %esp,%ecx
+     64f:	ba 56 06 00 00       	mov    $0x656,%edx
+     654:	0f 34                	sysenter
+     656:	c3                   	ret
+
+00000657 <readv>:
+SYSCALL(readv)
+     657:	b8 21 00 00 00       	mov    $0x21,%eax
+     65c:	89 e1                	mov    %esp,%ecx
+     65e:	ba 65 06 00 00       	mov    $0x665,%edx
+     663:	0f 34                	sysenter
+     665:	c3                   	ret
+
+00000666 <writev>:
+SYSCALL(writev)
+     666:	b8 22 00 00 00       	mov    $0x22,%eax
+     66b:	89 e1                	mov    %esp,%ecx
+     66d:	ba 74 06 00 00       	mov    $0x674,%edx
+     672:	0f 34                	sysenter
+     674:	c3                   	ret
+
+00000675 <pread>:
+SYSCALL(pread)
+     675:	b8 23 00 00 00       	mov    $0x23,%eax
+     67a:	89 e1                	mov    %esp,%ecx
+     67c:	ba 83 06 00 00       	mov    $0x683,%edx
+     681:	0f 34                	sysenter
+     683:	c3                   	ret
+
+00000684 <pwrite>:
+SYSCALL(pwrite)
+     684:	b8 24 00 00 00       	mov    $0x24,%eax
+     689:	89 e1                	mov    %esp,%ecx
+     68b:	ba 92 06 00 00       	mov    $0x692,%edx
+     690:	0f 34                	sysenter
+     692:	c3                   	ret
+
+00000693 <prof>:
+SYSCALL(prof)
+     693:	b8 25 00 00 00       	mov    $0x25,%eax
+     698:	89 e1                	mov    %esp,%ecx
+     69a:	ba a1 06 00 00       	mov    $0x6a1,%edx
+     69f:	0f 34                	sysenter
+     6a1:	c3                   	ret
+
+000006a2 <scstat>:
+SYSCALL(scstat)
+     6a2:	b8 26 00 00 00       	mov    $0x26,%eax
+     6a7:	89 e1                	mov    %esp,%ecx
+     6a9:	ba b0 06 00 00       	mov    $0x6b0,%edx
+     6ae:	0f 34                	sysenter
+     6b0:	c3                   	ret
+     6b1:	66 90                	xchg   %ax,%ax
+     6b3:	66 90                	xchg   %ax,%ax
+     6b5:	66 90                	xchg   %ax,%ax
+     6b7:	66 90                	xchg   %ax,%ax
+     6b9:	66 90                	xchg   %ax,%ax
+     6bb:	66 90                	xchg   %ax,%ax
+     6bd:	66 90                	xchg   %ax,%ax
+     6bf:	90                   	nop
+
+000006c0 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+     6c0:	55                   	push   %ebp
+     6c1:	89 e5                	mov    %esp,%ebp
+     6c3:	57                   	push   %edi
+     6c4:	56                   	push   %esi
+     6c5:	53                   	push   %ebx
+     6c6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     6c8:	89 d1                	mov    %edx,%ecx
+{
+     6ca:	83 ec 2c             	sub    $0x2c,%esp
+     6cd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+     6d0:	85 d2                	test   %edx,%edx
+     6d2:	79 7c                	jns    750 <printint+0x90>
+     6d4:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     6d8:	74 76                	je     750 <printint+0x90>
+    x = -xx;
+     6da:	f7 d9                	neg    %ecx
+    neg = 1;
+     6dc:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     6e1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     6e4:	31 f6                	xor    %esi,%esi
+     6e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ed:	8d 76 00             	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     6f0:	89 c8                	mov    %ecx,%eax
+     6f2:	31 d2                	xor    %edx,%edx
+     6f4:	89 f7                	mov    %esi,%edi
+     6f6:	f7 f3                	div    %ebx
+     6f8:	8d 76 01             	lea    0x1(%esi),%esi
+     6fb:	0f b6 92 48 1e 00 00 	movzbl 0x1e48(%edx),%edx
+     702:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     706:	89 ca                	mov    %ecx,%edx
+     708:	89 c1                	mov    %eax,%ecx
+     70a:	39 da                	cmp    %ebx,%edx
+     70c:	73 e2                	jae    6f0 <printint+0x30>
+  if(neg)
+     70e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     711:	85 c0                	test   %eax,%eax
+     713:	74 07                	je     71c <printint+0x5c>
+    buf[i++] = '-';
+     715:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     71a:	89 f7                	mov    %esi,%edi
+     71c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     71f:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     722:	01 df                	add    %ebx,%edi
+     724:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc_unlocked(buf[i], f);
+     728:	83 ec 08             	sub    $0x8,%esp
+     72b:	56                   	push   %esi
+     72c:	0f be 07             	movsbl (%edi),%eax
+     72f:	50                   	push   %eax
+     730:	e8 cb 07 00 00       	call   f00 <putc_unlocked>
+  while(--i >= 0)
+     735:	89 f8                	mov    %edi,%eax
+     737:	83 c4 10             	add    $0x10,%esp
+     73a:	83 ef 01             	sub    $0x1,%edi
+     73d:	39 d8                	cmp    %ebx,%eax
+     73f:	75 e7                	jne    728 <printint+0x68>
+}
+     741:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     744:	5b                   	pop    %ebx
+     745:	5e                   	pop    %esi
+     746:	5f                   	pop    %edi
+     747:	5d                   	pop    %ebp
+     748:	c3                   	ret
+     749:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     750:	31 c0                	xor    %eax,%eax
+     752:	eb 8d                	jmp    6e1 <printint+0x21>
+     754:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     75b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     75f:	90                   	nop
+
+00000760 <vfprintf>:
+
+// Print to the given stream, which the caller has locked.
+// Only understands %d, %x, %p, %s.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+     760:	55                   	push   %ebp
+     761:	89 e5                	mov    %esp,%ebp
+     763:	57                   	push   %edi
+     764:	56                   	push   %esi
+     765:	53                   	push   %ebx
+     766:	83 ec 1c             	sub    $0x1c,%esp
+     769:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     76c:	0f b6 0a             	movzbl (%edx),%ecx
+     76f:	84 c9                	test   %cl,%cl
+     771:	74 5c                	je     7cf <vfprintf+0x6f>
+     773:	89 c6                	mov    %eax,%esi
+     775:	8d 5a 01             	lea    0x1(%edx),%ebx
+     778:	31 ff                	xor    %edi,%edi
+     77a:	eb 20                	jmp    79c <vfprintf+0x3c>
+     77c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     780:	83 f9 25             	cmp    $0x25,%ecx
+     783:	74 3b                	je     7c0 <vfprintf+0x60>
+        state = '%';
+      } else {
+        putc_unlocked(c, f);
+     785:	83 ec 08             	sub    $0x8,%esp
+     788:	56                   	push   %esi
+     789:	51                   	push   %ecx
+     78a:	e8 71 07 00 00       	call   f00 <putc_unlocked>
+     78f:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     792:	0f b6 0b             	movzbl (%ebx),%ecx
+     795:	83 c3 01             	add    $0x1,%ebx
+     798:	84 c9                	test   %cl,%cl
+     79a:	74 33                	je     7cf <vfprintf+0x6f>
+    if(state == 0){
+     79c:	85 ff                	test   %edi,%edi
+     79e:	74 e0                	je     780 <vfprintf+0x20>
+      }
+    } else if(state == '%'){
+     7a0:	83 ff 25             	cmp    $0x25,%edi
+     7a3:	75 ed                	jne    792 <vfprintf+0x32>
+      if(c == 'd'){
+     7a5:	83 f9 25             	cmp    $0x25,%ecx
+     7a8:	0f 84 02 01 00 00    	je     8b0 <vfprintf+0x150>
+     7ae:	8d 41 9d             	lea    -0x63(%ecx),%eax
+     7b1:	83 f8 15             	cmp    $0x15,%eax
+     7b4:	77 2a                	ja     7e0 <vfprintf+0x80>
+     7b6:	ff 24 85 f0 1d 00 00 	jmp    *0x1df0(,%eax,4)
+     7bd:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     7c0:	0f b6 0b             	movzbl (%ebx),%ecx
+     7c3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     7c6:	bf 25 00 00 00       	mov    $0x25,%edi
+  for(i = 0; fmt[i]; i++){
+     7cb:	84 c9                	test   %cl,%cl
+     7cd:	75 cd                	jne    79c <vfprintf+0x3c>
+        putc_unlocked(c, f);
+      }
+      state = 0;
+    }
+  }
+}
+     7cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     7d2:	5b                   	pop    %ebx
+     7d3:	5e                   	pop    %esi
+     7d4:	5f                   	pop    %edi
+     7d5:	5d                   	pop    %ebp
+     7d6:	c3                   	ret
+     7d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7de:	66 90                	xchg   %ax,%ax
+        putc_unlocked('%', f);
+     7e0:	83 ec 08             	sub    $0x8,%esp
+     7e3:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     7e6:	56                   	push   %esi
+     7e7:	6a 25                	push   $0x25
+     7e9:	e8 12 07 00 00       	call   f00 <putc_unlocked>
+        putc_unlocked(c, f);
+     7ee:	58                   	pop    %eax
+     7ef:	5a                   	pop    %edx
+     7f0:	56                   	push   %esi
+     7f1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     7f4:	51                   	push   %ecx
+     7f5:	e8 06 07 00 00       	call   f00 <putc_unlocked>
+     7fa:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     7fd:	31 ff                	xor    %edi,%edi
+     7ff:	eb 91                	jmp    792 <vfprintf+0x32>
+     801:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+     808:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     80b:	83 ec 0c             	sub    $0xc,%esp
+     80e:	b9 10 00 00 00       	mov    $0x10,%ecx
+     813:	8b 17                	mov    (%edi),%edx
+     815:	6a 00                	push   $0x0
+        ap++;
+     817:	83 c7 04             	add    $0x4,%edi
+        printint(f, *ap, 16, 0);
+     81a:	89 f0                	mov    %esi,%eax
+     81c:	e8 9f fe ff ff       	call   6c0 <printint>
+        ap++;
+     821:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     824:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     827:	31 ff                	xor    %edi,%edi
+     829:	e9 64 ff ff ff       	jmp    792 <vfprintf+0x32>
+     82e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     830:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     833:	8b 10                	mov    (%eax),%edx
+        ap++;
+     835:	83 c0 04             	add    $0x4,%eax
+     838:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     83b:	85 d2                	test   %edx,%edx
+     83d:	0f 84 85 00 00 00    	je     8c8 <vfprintf+0x168>
+        while(*s != 0){
+     843:	0f be 02             	movsbl (%edx),%eax
+        s = (char*)*ap;
+     846:	89 d7                	mov    %edx,%edi
+        while(*s != 0){
+     848:	84 c0                	test   %al,%al
+     84a:	74 b1                	je     7fd <vfprintf+0x9d>
+     84c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+          putc_unlocked(*s, f);
+     850:	83 ec 08             	sub    $0x8,%esp
+          s++;
+     853:	83 c7 01             	add    $0x1,%edi
+          putc_unlocked(*s, f);
+     856:	56                   	push   %esi
+     857:	50                   	push   %eax
+     858:	e8 a3 06 00 00       	call   f00 <putc_unlocked>
+        while(*s != 0){
+     85d:	0f be 07             	movsbl (%edi),%eax
+     860:	83 c4 10             	add    $0x10,%esp
+     863:	84 c0                	test   %al,%al
+     865:	75 e9                	jne    850 <vfprintf+0xf0>
+      state = 0;
+     867:	31 ff                	xor    %edi,%edi
+     869:	e9 24 ff ff ff       	jmp    792 <vfprintf+0x32>
+     86e:	66 90                	xchg   %ax,%ax
+        printint(f, *ap, 10, 1);
+     870:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     873:	83 ec 0c             	sub    $0xc,%esp
+     876:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     87b:	8b 17                	mov    (%edi),%edx
+     87d:	6a 01                	push   $0x1
+     87f:	eb 96                	jmp    817 <vfprintf+0xb7>
+     881:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc_unlocked(*ap, f);
+     888:	83 ec 08             	sub    $0x8,%esp
+     88b:	56                   	push   %esi
+     88c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     88f:	ff 37                	push   (%edi)
+     891:	e8 6a 06 00 00       	call   f00 <putc_unlocked>
+        ap++;
+     896:	89 f8                	mov    %edi,%eax
+     898:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     89b:	31 ff                	xor    %edi,%edi
+        ap++;
+     89d:	83 c0 04             	add    $0x4,%eax
+     8a0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     8a3:	e9 ea fe ff ff       	jmp    792 <vfprintf+0x32>
+     8a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8af:	90                   	nop
+        putc_unlocked(c, f);
+     8b0:	83 ec 08             	sub    $0x8,%esp
+      state = 0;
+     8b3:	31 ff                	xor    %edi,%edi
+        putc_unlocked(c, f);
+     8b5:	56                   	push   %esi
+     8b6:	6a 25                	push   $0x25
+     8b8:	e8 43 06 00 00       	call   f00 <putc_unlocked>
+     8bd:	83 c4 10             	add    $0x10,%esp
+     8c0:	e9 cd fe ff ff       	jmp    792 <vfprintf+0x32>
+     8c5:	8d 76 00             	lea    0x0(%esi),%esi
+     8c8:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     8cd:	bf e8 1d 00 00       	mov    $0x1de8,%edi
+     8d2:	e9 79 ff ff ff       	jmp    850 <vfprintf+0xf0>
+     8d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8de:	66 90                	xchg   %ax,%ax
+
+000008e0 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+     8e0:	55                   	push   %ebp
+     8e1:	89 e5                	mov    %esp,%ebp
+     8e3:	53                   	push   %ebx
+     8e4:	83 ec 10             	sub    $0x10,%esp
+     8e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  flockfile(f);
+     8ea:	53                   	push   %ebx
+     8eb:	e8 d0 02 00 00       	call   bc0 <flockfile>
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     8f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+     8f3:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     8f6:	89 d8                	mov    %ebx,%eax
+     8f8:	e8 63 fe ff ff       	call   760 <vfprintf>
+  funlockfile(f);
+     8fd:	89 1c 24             	mov    %ebx,(%esp)
+     900:	e8 eb 02 00 00       	call   bf0 <funlockfile>
+}
+     905:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     908:	83 c4 10             	add    $0x10,%esp
+     90b:	c9                   	leave
+     90c:	c3                   	ret
+     90d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000910 <printf>:
+
+// Print to the given fd: through stdout or stderr for 1 and 2,
+// otherwise with one write() per call.
+void
+printf(int fd, const char *fmt, ...)
+{
+     910:	55                   	push   %ebp
+     911:	89 e5                	mov    %esp,%ebp
+     913:	56                   	push   %esi
+     914:	53                   	push   %ebx
+     915:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+     91b:	8b 45 08             	mov    0x8(%ebp),%eax
+  char buf[128];
+  struct iobuf f;
+
+  if(fd == 1 || fd == 2){
+    flockfile(&_iob[fd]);
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     91e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(fd == 1 || fd == 2){
+     921:	8d 50 ff             	lea    -0x1(%eax),%edx
+     924:	83 fa 01             	cmp    $0x1,%edx
+     927:	76 77                	jbe    9a0 <printf+0x90>
+    funlockfile(&_iob[fd]);
+    return;
+  }
+  f.fd = fd;
+     929:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  f.flags = IO_WRITE|IO_SETUP;
+  f.buf = buf;
+     92f:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  f.size = sizeof(buf);
+  f.r = f.n = 0;
+  mutex_init(&f.lock);
+     935:	83 ec 0c             	sub    $0xc,%esp
+     938:	8d 9d 5c ff ff ff    	lea    -0xa4(%ebp),%ebx
+  f.buf = buf;
+     93e:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+  mutex_init(&f.lock);
+     944:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  f.flags = IO_WRITE|IO_SETUP;
+     94a:	c7 85 60 ff ff ff 42 	movl   $0x42,-0xa0(%ebp)
+     951:	00 00 00 
+  f.size = sizeof(buf);
+     954:	c7 85 68 ff ff ff 80 	movl   $0x80,-0x98(%ebp)
+     95b:	00 00 00 
+  f.r = f.n = 0;
+     95e:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+     965:	00 00 00 
+     968:	c7 85 6c ff ff ff 00 	movl   $0x0,-0x94(%ebp)
+     96f:	00 00 00 
+  mutex_init(&f.lock);
+     972:	50                   	push   %eax
+     973:	e8 d8 f9 ff ff       	call   350 <mutex_init>
+  vfprintf(&f, fmt, (uint*)(void*)&fmt + 1);
+     978:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     97b:	89 f2                	mov    %esi,%edx
+     97d:	89 d8                	mov    %ebx,%eax
+     97f:	e8 dc fd ff ff       	call   760 <vfprintf>
+  fflush(&f);
+     984:	89 1c 24             	mov    %ebx,(%esp)
+     987:	e8 f4 04 00 00       	call   e80 <fflush>
+     98c:	83 c4 10             	add    $0x10,%esp
+}
+     98f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     992:	5b                   	pop    %ebx
+     993:	5e                   	pop    %esi
+     994:	5d                   	pop    %ebp
+     995:	c3                   	ret
+     996:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     99d:	8d 76 00             	lea    0x0(%esi),%esi
+    flockfile(&_iob[fd]);
+     9a0:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     9a3:	83 ec 0c             	sub    $0xc,%esp
+     9a6:	8d 98 e0 27 00 00    	lea    0x27e0(%eax),%ebx
+     9ac:	53                   	push   %ebx
+     9ad:	e8 0e 02 00 00       	call   bc0 <flockfile>
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     9b2:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     9b5:	89 f2                	mov    %esi,%edx
+     9b7:	89 d8                	mov    %ebx,%eax
+     9b9:	e8 a2 fd ff ff       	call   760 <vfprintf>
+    funlockfile(&_iob[fd]);
+     9be:	89 1c 24             	mov    %ebx,(%esp)
+     9c1:	e8 2a 02 00 00       	call   bf0 <funlockfile>
+     9c6:	83 c4 10             	add    $0x10,%esp
+}
+     9c9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     9cc:	5b                   	pop    %ebx
+     9cd:	5e                   	pop    %esi
+     9ce:	5d                   	pop    %ebp
+     9cf:	c3                   	ret
+
+000009d0 <setup>:
+}
+
+// Choose how to buffer f on first use: by lines on a device.
+static void
+setup(FILE *f)
+{
+     9d0:	55                   	push   %ebp
+     9d1:	89 e5                	mov    %esp,%ebp
+     9d3:	53                   	push   %ebx
+     9d4:	89 c3                	mov    %eax,%ebx
+     9d6:	83 ec 2c             	sub    $0x2c,%esp
+  struct stat st;
+
+  f->flags |= IO_SETUP;
+     9d9:	83 48 04 40          	orl    $0x40,0x4(%eax)
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     9dd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     9e0:	50                   	push   %eax
+     9e1:	ff 33                	push   (%ebx)
+     9e3:	e8 52 fb ff ff       	call   53a <fstat>
+     9e8:	83 c4 10             	add    $0x10,%esp
+     9eb:	85 c0                	test   %eax,%eax
+    f->flags |= IO_DEV|IO_LINE;
+     9ed:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     9f0:	75 07                	jne    9f9 <setup+0x29>
+     9f2:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+     9f7:	74 17                	je     a10 <setup+0x40>
+  if(f->flags & IO_WRITE)
+     9f9:	a8 02                	test   $0x2,%al
+     9fb:	74 0a                	je     a07 <setup+0x37>
+    flushhook = flushall;
+     9fd:	c7 05 c0 28 00 00 30 	movl   $0xb30,0x28c0
+     a04:	0b 00 00 
+}
+     a07:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a0a:	c9                   	leave
+     a0b:	c3                   	ret
+     a0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    f->flags |= IO_DEV|IO_LINE;
+     a10:	83 c8 30             	or     $0x30,%eax
+     a13:	89 43 04             	mov    %eax,0x4(%ebx)
+     a16:	eb e1                	jmp    9f9 <setup+0x29>
+     a18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a1f:	90                   	nop
+
+00000a20 <flush>:
+static int
+flush(FILE *f)
+{
+  int i, n;
+
+  if(!(f->flags & IO_WRITE))
+     a20:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+     a24:	74 6a                	je     a90 <flush+0x70>
+{
+     a26:	55                   	push   %ebp
+     a27:	89 e5                	mov    %esp,%ebp
+     a29:	56                   	push   %esi
+     a2a:	89 c6                	mov    %eax,%esi
+     a2c:	53                   	push   %ebx
+    return 0;
+  for(i = 0; i < f->n; i += n){
+     a2d:	8b 40 14             	mov    0x14(%eax),%eax
+     a30:	85 c0                	test   %eax,%eax
+     a32:	7e 4c                	jle    a80 <flush+0x60>
+     a34:	31 db                	xor    %ebx,%ebx
+     a36:	eb 11                	jmp    a49 <flush+0x29>
+     a38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a3f:	90                   	nop
+     a40:	01 c3                	add    %eax,%ebx
+     a42:	8b 46 14             	mov    0x14(%esi),%eax
+     a45:	39 d8                	cmp    %ebx,%eax
+     a47:	7e 37                	jle    a80 <flush+0x60>
+    if((n = write(f->fd, f->buf + i, f->n - i)) <= 0){
+     a49:	83 ec 04             	sub    $0x4,%esp
+     a4c:	29 d8                	sub    %ebx,%eax
+     a4e:	50                   	push   %eax
+     a4f:	8b 46 08             	mov    0x8(%esi),%eax
+     a52:	01 d8                	add    %ebx,%eax
+     a54:	50                   	push   %eax
+     a55:	ff 36                	push   (%esi)
+     a57:	e8 75 fa ff ff       	call   4d1 <write>
+     a5c:	83 c4 10             	add    $0x10,%esp
+     a5f:	85 c0                	test   %eax,%eax
+     a61:	7f dd                	jg     a40 <flush+0x20>
+      f->flags |= IO_ERR;
+     a63:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+      f->n = 0;
+     a67:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     a6c:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+      return EOF;
+    }
+  }
+  f->n = 0;
+  return 0;
+}
+     a73:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     a76:	5b                   	pop    %ebx
+     a77:	5e                   	pop    %esi
+     a78:	5d                   	pop    %ebp
+     a79:	c3                   	ret
+     a7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->n = 0;
+     a80:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+}
+     a87:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+     a8a:	31 c0                	xor    %eax,%eax
+}
+     a8c:	5b                   	pop    %ebx
+     a8d:	5e                   	pop    %esi
+     a8e:	5d                   	pop    %ebp
+     a8f:	c3                   	ret
+    return 0;
+     a90:	31 c0                	xor    %eax,%eax
+}
+     a92:	c3                   	ret
+     a93:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000aa0 <fflush.part.0>:
+fflush(FILE *f)
+     aa0:	55                   	push   %ebp
+     aa1:	89 e5                	mov    %esp,%ebp
+     aa3:	57                   	push   %edi
+     aa4:	bf d8 28 00 00       	mov    $0x28d8,%edi
+     aa9:	56                   	push   %esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     aaa:	31 f6                	xor    %esi,%esi
+fflush(FILE *f)
+     aac:	53                   	push   %ebx
+     aad:	bb f8 27 00 00       	mov    $0x27f8,%ebx
+     ab2:	83 ec 1c             	sub    $0x1c,%esp
+     ab5:	eb 10                	jmp    ac7 <fflush.part.0+0x27>
+     ab7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     abe:	66 90                	xchg   %ax,%ax
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     ac0:	83 c3 1c             	add    $0x1c,%ebx
+     ac3:	39 df                	cmp    %ebx,%edi
+     ac5:	74 33                	je     afa <fflush.part.0+0x5a>
+      if((f->flags & IO_WRITE) && fflush(f) < 0)
+     ac7:	f6 43 ec 02          	testb  $0x2,-0x14(%ebx)
+     acb:	74 f3                	je     ac0 <fflush.part.0+0x20>
+  if(threaded)
+     acd:	8b 0d e0 28 00 00    	mov    0x28e0,%ecx
+     ad3:	85 c9                	test   %ecx,%ecx
+     ad5:	75 49                	jne    b20 <fflush.part.0+0x80>
+  r = flush(f);
+     ad7:	8d 43 e8             	lea    -0x18(%ebx),%eax
+     ada:	e8 41 ff ff ff       	call   a20 <flush>
+  if(threaded)
+     adf:	8b 15 e0 28 00 00    	mov    0x28e0,%edx
+     ae5:	85 d2                	test   %edx,%edx
+     ae7:	75 1f                	jne    b08 <fflush.part.0+0x68>
+        r = EOF;
+     ae9:	85 c0                	test   %eax,%eax
+     aeb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     af0:	0f 48 f0             	cmovs  %eax,%esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     af3:	83 c3 1c             	add    $0x1c,%ebx
+     af6:	39 df                	cmp    %ebx,%edi
+     af8:	75 cd                	jne    ac7 <fflush.part.0+0x27>
+}
+     afa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     afd:	89 f0                	mov    %esi,%eax
+     aff:	5b                   	pop    %ebx
+     b00:	5e                   	pop    %esi
+     b01:	5f                   	pop    %edi
+     b02:	5d                   	pop    %ebp
+     b03:	c3                   	ret
+     b04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     b08:	83 ec 0c             	sub    $0xc,%esp
+     b0b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     b0e:	53                   	push   %ebx
+     b0f:	e8 9c f8 ff ff       	call   3b0 <mutex_unlock>
+     b14:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     b17:	83 c4 10             	add    $0x10,%esp
+     b1a:	eb cd                	jmp    ae9 <fflush.part.0+0x49>
+     b1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     b20:	83 ec 0c             	sub    $0xc,%esp
+     b23:	53                   	push   %ebx
+     b24:	e8 37 f8 ff ff       	call   360 <mutex_lock>
+     b29:	83 c4 10             	add    $0x10,%esp
+     b2c:	eb a9                	jmp    ad7 <fflush.part.0+0x37>
+     b2e:	66 90                	xchg   %ax,%ax
+
+00000b30 <flushall>:
+  if(f == 0){
+     b30:	e9 6b ff ff ff       	jmp    aa0 <fflush.part.0>
+     b35:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b40 <fill>:
+
+// Refill f's buffer. Returns the number of bytes read.
+// Caller holds f's lock.
+static int
+fill(FILE *f)
+{
+     b40:	55                   	push   %ebp
+     b41:	89 e5                	mov    %esp,%ebp
+     b43:	53                   	push   %ebx
+     b44:	89 c3                	mov    %eax,%ebx
+     b46:	83 ec 04             	sub    $0x4,%esp
+  int n;
+
+  if(!(f->flags & IO_SETUP))
+     b49:	8b 40 04             	mov    0x4(%eax),%eax
+     b4c:	a8 40                	test   $0x40,%al
+     b4e:	74 50                	je     ba0 <fill+0x60>
+    setup(f);
+  if(f->flags & IO_DEV)
+     b50:	a8 20                	test   $0x20,%al
+     b52:	75 3c                	jne    b90 <fill+0x50>
+    fflush(0);
+  f->r = 0;
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     b54:	83 ec 04             	sub    $0x4,%esp
+  f->r = 0;
+     b57:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     b5e:	ff 73 0c             	push   0xc(%ebx)
+     b61:	ff 73 08             	push   0x8(%ebx)
+     b64:	ff 33                	push   (%ebx)
+     b66:	e8 57 f9 ff ff       	call   4c2 <read>
+     b6b:	83 c4 10             	add    $0x10,%esp
+     b6e:	85 c0                	test   %eax,%eax
+     b70:	7f 10                	jg     b82 <fill+0x42>
+    f->flags |= n < 0 ? IO_ERR : IO_EOF;
+     b72:	83 f8 01             	cmp    $0x1,%eax
+     b75:	19 c0                	sbb    %eax,%eax
+     b77:	83 e0 fc             	and    $0xfffffffc,%eax
+     b7a:	83 c0 08             	add    $0x8,%eax
+     b7d:	09 43 04             	or     %eax,0x4(%ebx)
+    n = 0;
+     b80:	31 c0                	xor    %eax,%eax
+  }
+  f->n = n;
+     b82:	89 43 14             	mov    %eax,0x14(%ebx)
+  return n;
+}
+     b85:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b88:	c9                   	leave
+     b89:	c3                   	ret
+     b8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == 0){
+     b90:	e8 0b ff ff ff       	call   aa0 <fflush.part.0>
+     b95:	eb bd                	jmp    b54 <fill+0x14>
+     b97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b9e:	66 90                	xchg   %ax,%ax
+    setup(f);
+     ba0:	89 d8                	mov    %ebx,%eax
+     ba2:	e8 29 fe ff ff       	call   9d0 <setup>
+  if(f->flags & IO_DEV)
+     ba7:	8b 43 04             	mov    0x4(%ebx),%eax
+     baa:	eb a4                	jmp    b50 <fill+0x10>
+     bac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000bb0 <stdio_threaded>:
+  threaded = 1;
+     bb0:	c7 05 e0 28 00 00 01 	movl   $0x1,0x28e0
+     bb7:	00 00 00 
+}
+     bba:	c3                   	ret
+     bbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bbf:	90                   	nop
+
+00000bc0 <flockfile>:
+{
+     bc0:	55                   	push   %ebp
+  if(threaded)
+     bc1:	8b 15 e0 28 00 00    	mov    0x28e0,%edx
+{
+     bc7:	89 e5                	mov    %esp,%ebp
+     bc9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     bcc:	85 d2                	test   %edx,%edx
+     bce:	75 08                	jne    bd8 <flockfile+0x18>
+}
+     bd0:	5d                   	pop    %ebp
+     bd1:	c3                   	ret
+     bd2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_lock(&f->lock);
+     bd8:	83 c0 18             	add    $0x18,%eax
+     bdb:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     bde:	5d                   	pop    %ebp
+    mutex_lock(&f->lock);
+     bdf:	e9 7c f7 ff ff       	jmp    360 <mutex_lock>
+     be4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     beb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bef:	90                   	nop
+
+00000bf0 <funlockfile>:
+{
+     bf0:	55                   	push   %ebp
+  if(threaded)
+     bf1:	8b 15 e0 28 00 00    	mov    0x28e0,%edx
+{
+     bf7:	89 e5                	mov    %esp,%ebp
+     bf9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     bfc:	85 d2                	test   %edx,%edx
+     bfe:	75 08                	jne    c08 <funlockfile+0x18>
+}
+     c00:	5d                   	pop    %ebp
+     c01:	c3                   	ret
+     c02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&f->lock);
+     c08:	83 c0 18             	add    $0x18,%eax
+     c0b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     c0e:	5d                   	pop    %ebp
+    mutex_unlock(&f->lock);
+     c0f:	e9 9c f7 ff ff       	jmp    3b0 <mutex_unlock>
+     c14:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c1f:	90                   	nop
+
+00000c20 <fopen>:
+{
+     c20:	55                   	push   %ebp
+     c21:	89 e5                	mov    %esp,%ebp
+     c23:	57                   	push   %edi
+     c24:	56                   	push   %esi
+     c25:	53                   	push   %ebx
+     c26:	83 ec 34             	sub    $0x34,%esp
+     c29:	8b 75 0c             	mov    0xc(%ebp),%esi
+     c2c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(strcmp(mode, "r") != 0 && strcmp(mode, "w") != 0)
+     c2f:	68 59 1e 00 00       	push   $0x1e59
+     c34:	56                   	push   %esi
+     c35:	e8 66 f5 ff ff       	call   1a0 <strcmp>
+     c3a:	83 c4 10             	add    $0x10,%esp
+     c3d:	85 c0                	test   %eax,%eax
+     c3f:	74 15                	je     c56 <fopen+0x36>
+     c41:	83 ec 08             	sub    $0x8,%esp
+     c44:	68 5b 1e 00 00       	push   $0x1e5b
+     c49:	56                   	push   %esi
+     c4a:	e8 51 f5 ff ff       	call   1a0 <strcmp>
+     c4f:	83 c4 10             	add    $0x10,%esp
+     c52:	85 c0                	test   %eax,%eax
+     c54:	75 2c                	jne    c82 <fopen+0x62>
+  if(threaded)
+     c56:	a1 e0 28 00 00       	mov    0x28e0,%eax
+     c5b:	85 c0                	test   %eax,%eax
+     c5d:	0f 85 ed 00 00 00    	jne    d50 <fopen+0x130>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     c63:	bb 34 28 00 00       	mov    $0x2834,%ebx
+    if(f->flags == 0)
+     c68:	8b 53 04             	mov    0x4(%ebx),%edx
+     c6b:	85 d2                	test   %edx,%edx
+     c6d:	74 21                	je     c90 <fopen+0x70>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     c6f:	83 c3 1c             	add    $0x1c,%ebx
+     c72:	81 fb c0 28 00 00    	cmp    $0x28c0,%ebx
+     c78:	75 ee                	jne    c68 <fopen+0x48>
+  if(threaded)
+     c7a:	85 c0                	test   %eax,%eax
+     c7c:	0f 85 36 01 00 00    	jne    db8 <fopen+0x198>
+    return 0;
+     c82:	31 db                	xor    %ebx,%ebx
+     c84:	e9 96 00 00 00       	jmp    d1f <fopen+0xff>
+     c89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f == &_iob[NSTREAM])
+     c90:	81 fb c0 28 00 00    	cmp    $0x28c0,%ebx
+     c96:	74 e2                	je     c7a <fopen+0x5a>
+    f->flags = IO_MALLOC;
+     c98:	c7 43 04 80 00 00 00 	movl   $0x80,0x4(%ebx)
+  if(threaded)
+     c9f:	85 c0                	test   %eax,%eax
+     ca1:	0f 85 f9 00 00 00    	jne    da0 <fopen+0x180>
+  if(mode[0] == 'r'){
+     ca7:	80 3e 72             	cmpb   $0x72,(%esi)
+     caa:	0f 84 c0 00 00 00    	je     d70 <fopen+0x150>
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     cb0:	83 ec 08             	sub    $0x8,%esp
+     cb3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     cb6:	50                   	push   %eax
+     cb7:	57                   	push   %edi
+     cb8:	e8 d3 f5 ff ff       	call   290 <stat>
+     cbd:	83 c4 10             	add    $0x10,%esp
+     cc0:	85 c0                	test   %eax,%eax
+     cc2:	74 6c                	je     d30 <fopen+0x110>
+    fd = open(path, O_CREATE|O_WRONLY);
+     cc4:	83 ec 08             	sub    $0x8,%esp
+     cc7:	68 01 02 00 00       	push   $0x201
+     ccc:	57                   	push   %edi
+    flags = IO_WRITE;
+     ccd:	bf 02 00 00 00       	mov    $0x2,%edi
+    fd = open(path, O_CREATE|O_WRONLY);
+     cd2:	e8 36 f8 ff ff       	call   50d <open>
+     cd7:	83 c4 10             	add    $0x10,%esp
+     cda:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     cdc:	85 f6                	test   %esi,%esi
+     cde:	0f 88 a9 00 00 00    	js     d8d <fopen+0x16d>
+     ce4:	83 ec 0c             	sub    $0xc,%esp
+     ce7:	68 00 02 00 00       	push   $0x200
+     cec:	e8 af 0c 00 00       	call   19a0 <malloc>
+     cf1:	83 c4 10             	add    $0x10,%esp
+     cf4:	89 43 08             	mov    %eax,0x8(%ebx)
+     cf7:	85 c0                	test   %eax,%eax
+     cf9:	0f 84 d0 00 00 00    	je     dcf <fopen+0x1af>
+  f->flags = flags|IO_MALLOC;
+     cff:	81 cf 80 00 00 00    	or     $0x80,%edi
+  f->fd = fd;
+     d05:	89 33                	mov    %esi,(%ebx)
+  f->size = BUFSIZ;
+     d07:	c7 43 0c 00 02 00 00 	movl   $0x200,0xc(%ebx)
+  f->r = f->n = 0;
+     d0e:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+     d15:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  f->flags = flags|IO_MALLOC;
+     d1c:	89 7b 04             	mov    %edi,0x4(%ebx)
+}
+     d1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d22:	89 d8                	mov    %ebx,%eax
+     d24:	5b                   	pop    %ebx
+     d25:	5e                   	pop    %esi
+     d26:	5f                   	pop    %edi
+     d27:	5d                   	pop    %ebp
+     d28:	c3                   	ret
+     d29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     d30:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+     d35:	75 8d                	jne    cc4 <fopen+0xa4>
+      unlink(path);
+     d37:	83 ec 0c             	sub    $0xc,%esp
+     d3a:	57                   	push   %edi
+     d3b:	e8 eb f7 ff ff       	call   52b <unlink>
+     d40:	83 c4 10             	add    $0x10,%esp
+     d43:	e9 7c ff ff ff       	jmp    cc4 <fopen+0xa4>
+     d48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d4f:	90                   	nop
+    mutex_lock(&iolock);
+     d50:	83 ec 0c             	sub    $0xc,%esp
+     d53:	68 e4 28 00 00       	push   $0x28e4
+     d58:	e8 03 f6 ff ff       	call   360 <mutex_lock>
+  if(threaded)
+     d5d:	a1 e0 28 00 00       	mov    0x28e0,%eax
+     d62:	83 c4 10             	add    $0x10,%esp
+     d65:	e9 f9 fe ff ff       	jmp    c63 <fopen+0x43>
+     d6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    fd = open(path, O_RDONLY);
+     d70:	83 ec 08             	sub    $0x8,%esp
+     d73:	6a 00                	push   $0x0
+     d75:	57                   	push   %edi
+    flags = IO_READ;
+     d76:	bf 01 00 00 00       	mov    $0x1,%edi
+    fd = open(path, O_RDONLY);
+     d7b:	e8 8d f7 ff ff       	call   50d <open>
+     d80:	83 c4 10             	add    $0x10,%esp
+     d83:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     d85:	85 f6                	test   %esi,%esi
+     d87:	0f 89 57 ff ff ff    	jns    ce4 <fopen+0xc4>
+    f->flags = 0;
+     d8d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    return 0;
+     d94:	31 db                	xor    %ebx,%ebx
+     d96:	eb 87                	jmp    d1f <fopen+0xff>
+     d98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d9f:	90                   	nop
+    mutex_unlock(&iolock);
+     da0:	83 ec 0c             	sub    $0xc,%esp
+     da3:	68 e4 28 00 00       	push   $0x28e4
+     da8:	e8 03 f6 ff ff       	call   3b0 <mutex_unlock>
+     dad:	83 c4 10             	add    $0x10,%esp
+     db0:	e9 f2 fe ff ff       	jmp    ca7 <fopen+0x87>
+     db5:	8d 76 00             	lea    0x0(%esi),%esi
+     db8:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+     dbb:	31 db                	xor    %ebx,%ebx
+    mutex_unlock(&iolock);
+     dbd:	68 e4 28 00 00       	push   $0x28e4
+     dc2:	e8 e9 f5 ff ff       	call   3b0 <mutex_unlock>
+     dc7:	83 c4 10             	add    $0x10,%esp
+     dca:	e9 50 ff ff ff       	jmp    d1f <fopen+0xff>
+      close(fd);
+     dcf:	83 ec 0c             	sub    $0xc,%esp
+     dd2:	56                   	push   %esi
+     dd3:	e8 08 f7 ff ff       	call   4e0 <close>
+     dd8:	83 c4 10             	add    $0x10,%esp
+     ddb:	eb b0                	jmp    d8d <fopen+0x16d>
+     ddd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000de0 <fclose>:
+{
+     de0:	55                   	push   %ebp
+     de1:	89 e5                	mov    %esp,%ebp
+     de3:	56                   	push   %esi
+     de4:	53                   	push   %ebx
+  if(threaded)
+     de5:	8b 15 e0 28 00 00    	mov    0x28e0,%edx
+{
+     deb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+     dee:	85 d2                	test   %edx,%edx
+     df0:	75 46                	jne    e38 <fclose+0x58>
+  r = flush(f);
+     df2:	89 d8                	mov    %ebx,%eax
+     df4:	e8 27 fc ff ff       	call   a20 <flush>
+  if(close(f->fd) < 0)
+     df9:	83 ec 0c             	sub    $0xc,%esp
+     dfc:	ff 33                	push   (%ebx)
+  r = flush(f);
+     dfe:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+     e00:	e8 db f6 ff ff       	call   4e0 <close>
+     e05:	83 c4 10             	add    $0x10,%esp
+    r = EOF;
+     e08:	85 c0                	test   %eax,%eax
+     e0a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     e0f:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->flags & IO_MALLOC)
+     e12:	f6 43 04 80          	testb  $0x80,0x4(%ebx)
+     e16:	75 58                	jne    e70 <fclose+0x90>
+  if(threaded)
+     e18:	a1 e0 28 00 00       	mov    0x28e0,%eax
+  f->flags = 0;
+     e1d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  if(threaded)
+     e24:	85 c0                	test   %eax,%eax
+     e26:	75 28                	jne    e50 <fclose+0x70>
+}
+     e28:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e2b:	89 f0                	mov    %esi,%eax
+     e2d:	5b                   	pop    %ebx
+     e2e:	5e                   	pop    %esi
+     e2f:	5d                   	pop    %ebp
+     e30:	c3                   	ret
+     e31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     e38:	83 ec 0c             	sub    $0xc,%esp
+     e3b:	8d 43 18             	lea    0x18(%ebx),%eax
+     e3e:	50                   	push   %eax
+     e3f:	e8 1c f5 ff ff       	call   360 <mutex_lock>
+     e44:	83 c4 10             	add    $0x10,%esp
+     e47:	eb a9                	jmp    df2 <fclose+0x12>
+     e49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     e50:	83 ec 0c             	sub    $0xc,%esp
+     e53:	83 c3 18             	add    $0x18,%ebx
+     e56:	53                   	push   %ebx
+     e57:	e8 54 f5 ff ff       	call   3b0 <mutex_unlock>
+     e5c:	83 c4 10             	add    $0x10,%esp
+}
+     e5f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e62:	89 f0                	mov    %esi,%eax
+     e64:	5b                   	pop    %ebx
+     e65:	5e                   	pop    %esi
+     e66:	5d                   	pop    %ebp
+     e67:	c3                   	ret
+     e68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e6f:	90                   	nop
+    free(f->buf);
+     e70:	83 ec 0c             	sub    $0xc,%esp
+     e73:	ff 73 08             	push   0x8(%ebx)
+     e76:	e8 f5 09 00 00       	call   1870 <free>
+     e7b:	83 c4 10             	add    $0x10,%esp
+     e7e:	eb 98                	jmp    e18 <fclose+0x38>
+
+00000e80 <fflush>:
+{
+     e80:	55                   	push   %ebp
+     e81:	89 e5                	mov    %esp,%ebp
+     e83:	53                   	push   %ebx
+     e84:	83 ec 14             	sub    $0x14,%esp
+     e87:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f == 0){
+     e8a:	85 db                	test   %ebx,%ebx
+     e8c:	74 5a                	je     ee8 <fflush+0x68>
+  if(threaded)
+     e8e:	8b 0d e0 28 00 00    	mov    0x28e0,%ecx
+     e94:	85 c9                	test   %ecx,%ecx
+     e96:	75 18                	jne    eb0 <fflush+0x30>
+  r = flush(f);
+     e98:	89 d8                	mov    %ebx,%eax
+     e9a:	e8 81 fb ff ff       	call   a20 <flush>
+  if(threaded)
+     e9f:	8b 15 e0 28 00 00    	mov    0x28e0,%edx
+     ea5:	85 d2                	test   %edx,%edx
+     ea7:	75 1f                	jne    ec8 <fflush+0x48>
+}
+     ea9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     eac:	c9                   	leave
+     ead:	c3                   	ret
+     eae:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+     eb0:	83 ec 0c             	sub    $0xc,%esp
+     eb3:	8d 43 18             	lea    0x18(%ebx),%eax
+     eb6:	50                   	push   %eax
+     eb7:	e8 a4 f4 ff ff       	call   360 <mutex_lock>
+     ebc:	83 c4 10             	add    $0x10,%esp
+     ebf:	eb d7                	jmp    e98 <fflush+0x18>
+     ec1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     ec8:	83 ec 0c             	sub    $0xc,%esp
+     ecb:	83 c3 18             	add    $0x18,%ebx
+     ece:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     ed1:	53                   	push   %ebx
+     ed2:	e8 d9 f4 ff ff       	call   3b0 <mutex_unlock>
+     ed7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     eda:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    mutex_unlock(&f->lock);
+     edd:	83 c4 10             	add    $0x10,%esp
+}
+     ee0:	c9                   	leave
+     ee1:	c3                   	ret
+     ee2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     ee8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     eeb:	c9                   	leave
+     eec:	e9 af fb ff ff       	jmp    aa0 <fflush.part.0>
+     ef1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ef8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     eff:	90                   	nop
+
+00000f00 <putc_unlocked>:
+{
+     f00:	55                   	push   %ebp
+     f01:	89 e5                	mov    %esp,%ebp
+     f03:	56                   	push   %esi
+     f04:	53                   	push   %ebx
+     f05:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     f08:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(!(f->flags & IO_WRITE))
+     f0b:	8b 43 04             	mov    0x4(%ebx),%eax
+     f0e:	a8 02                	test   $0x2,%al
+     f10:	74 46                	je     f58 <putc_unlocked+0x58>
+  if(!(f->flags & IO_SETUP))
+     f12:	a8 40                	test   $0x40,%al
+     f14:	74 4a                	je     f60 <putc_unlocked+0x60>
+  if(f->n == f->size && flush(f) < 0)
+     f16:	8b 43 14             	mov    0x14(%ebx),%eax
+     f19:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     f1c:	74 51                	je     f6f <putc_unlocked+0x6f>
+  f->buf[f->n++] = c;
+     f1e:	8d 48 01             	lea    0x1(%eax),%ecx
+     f21:	8b 53 08             	mov    0x8(%ebx),%edx
+     f24:	89 4b 14             	mov    %ecx,0x14(%ebx)
+     f27:	89 f1                	mov    %esi,%ecx
+     f29:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     f2c:	83 fe 0a             	cmp    $0xa,%esi
+     f2f:	74 0f                	je     f40 <putc_unlocked+0x40>
+  return c & 0xff;
+     f31:	89 f0                	mov    %esi,%eax
+     f33:	0f b6 c0             	movzbl %al,%eax
+}
+     f36:	5b                   	pop    %ebx
+     f37:	5e                   	pop    %esi
+     f38:	5d                   	pop    %ebp
+     f39:	c3                   	ret
+     f3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     f40:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+     f44:	74 eb                	je     f31 <putc_unlocked+0x31>
+     f46:	89 d8                	mov    %ebx,%eax
+     f48:	e8 d3 fa ff ff       	call   a20 <flush>
+     f4d:	85 c0                	test   %eax,%eax
+     f4f:	79 e0                	jns    f31 <putc_unlocked+0x31>
+     f51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return EOF;
+     f58:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     f5d:	eb d7                	jmp    f36 <putc_unlocked+0x36>
+     f5f:	90                   	nop
+    setup(f);
+     f60:	89 d8                	mov    %ebx,%eax
+     f62:	e8 69 fa ff ff       	call   9d0 <setup>
+  if(f->n == f->size && flush(f) < 0)
+     f67:	8b 43 14             	mov    0x14(%ebx),%eax
+     f6a:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     f6d:	75 af                	jne    f1e <putc_unlocked+0x1e>
+     f6f:	89 d8                	mov    %ebx,%eax
+     f71:	e8 aa fa ff ff       	call   a20 <flush>
+     f76:	85 c0                	test   %eax,%eax
+     f78:	78 de                	js     f58 <putc_unlocked+0x58>
+  f->buf[f->n++] = c;
+     f7a:	8b 43 14             	mov    0x14(%ebx),%eax
+     f7d:	eb 9f                	jmp    f1e <putc_unlocked+0x1e>
+     f7f:	90                   	nop
+
+00000f80 <fputc>:
+{
+     f80:	55                   	push   %ebp
+     f81:	89 e5                	mov    %esp,%ebp
+     f83:	56                   	push   %esi
+     f84:	53                   	push   %ebx
+  if(threaded)
+     f85:	8b 15 e0 28 00 00    	mov    0x28e0,%edx
+{
+     f8b:	8b 75 08             	mov    0x8(%ebp),%esi
+     f8e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(threaded)
+     f91:	85 d2                	test   %edx,%edx
+     f93:	75 6b                	jne    1000 <fputc+0x80>
+  if(!(f->flags & IO_WRITE))
+     f95:	8b 43 04             	mov    0x4(%ebx),%eax
+     f98:	a8 02                	test   $0x2,%al
+     f9a:	0f 84 b8 00 00 00    	je     1058 <fputc+0xd8>
+  if(!(f->flags & IO_SETUP))
+     fa0:	a8 40                	test   $0x40,%al
+     fa2:	74 76                	je     101a <fputc+0x9a>
+  if(f->n == f->size && flush(f) < 0)
+     fa4:	8b 43 14             	mov    0x14(%ebx),%eax
+     fa7:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     faa:	74 7d                	je     1029 <fputc+0xa9>
+  f->buf[f->n++] = c;
+     fac:	8d 48 01             	lea    0x1(%eax),%ecx
+     faf:	8b 53 08             	mov    0x8(%ebx),%edx
+     fb2:	89 4b 14             	mov    %ecx,0x14(%ebx)
+     fb5:	89 f1                	mov    %esi,%ecx
+     fb7:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     fba:	83 fe 0a             	cmp    $0xa,%esi
+     fbd:	74 21                	je     fe0 <fputc+0x60>
+  return c & 0xff;
+     fbf:	89 f0                	mov    %esi,%eax
+     fc1:	0f b6 f0             	movzbl %al,%esi
+  if(threaded)
+     fc4:	a1 e0 28 00 00       	mov    0x28e0,%eax
+     fc9:	85 c0                	test   %eax,%eax
+     fcb:	75 73                	jne    1040 <fputc+0xc0>
+}
+     fcd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     fd0:	89 f0                	mov    %esi,%eax
+     fd2:	5b                   	pop    %ebx
+     fd3:	5e                   	pop    %esi
+     fd4:	5d                   	pop    %ebp
+     fd5:	c3                   	ret
+     fd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fdd:	8d 76 00             	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     fe0:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+     fe4:	74 d9                	je     fbf <fputc+0x3f>
+     fe6:	89 d8                	mov    %ebx,%eax
+     fe8:	e8 33 fa ff ff       	call   a20 <flush>
+     fed:	85 c0                	test   %eax,%eax
+     fef:	79 ce                	jns    fbf <fputc+0x3f>
+    return EOF;
+     ff1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     ff6:	eb cc                	jmp    fc4 <fputc+0x44>
+     ff8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fff:	90                   	nop
+    mutex_lock(&f->lock);
+    1000:	83 ec 0c             	sub    $0xc,%esp
+    1003:	8d 43 18             	lea    0x18(%ebx),%eax
+    1006:	50                   	push   %eax
+    1007:	e8 54 f3 ff ff       	call   360 <mutex_lock>
+  if(!(f->flags & IO_WRITE))
+    100c:	8b 43 04             	mov    0x4(%ebx),%eax
+    100f:	83 c4 10             	add    $0x10,%esp
+    1012:	a8 02                	test   $0x2,%al
+    1014:	74 db                	je     ff1 <fputc+0x71>
+  if(!(f->flags & IO_SETUP))
+    1016:	a8 40                	test   $0x40,%al
+    1018:	75 8a                	jne    fa4 <fputc+0x24>
+    setup(f);
+    101a:	89 d8                	mov    %ebx,%eax
+    101c:	e8 af f9 ff ff       	call   9d0 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    1021:	8b 43 14             	mov    0x14(%ebx),%eax
+    1024:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    1027:	75 83                	jne    fac <fputc+0x2c>
+    1029:	89 d8                	mov    %ebx,%eax
+    102b:	e8 f0 f9 ff ff       	call   a20 <flush>
+    1030:	85 c0                	test   %eax,%eax
+    1032:	78 bd                	js     ff1 <fputc+0x71>
+  f->buf[f->n++] = c;
+    1034:	8b 43 14             	mov    0x14(%ebx),%eax
+    1037:	e9 70 ff ff ff       	jmp    fac <fputc+0x2c>
+    103c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1040:	83 ec 0c             	sub    $0xc,%esp
+    1043:	83 c3 18             	add    $0x18,%ebx
+    1046:	53                   	push   %ebx
+    1047:	e8 64 f3 ff ff       	call   3b0 <mutex_unlock>
+    104c:	83 c4 10             	add    $0x10,%esp
+}
+    104f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1052:	89 f0                	mov    %esi,%eax
+    1054:	5b                   	pop    %ebx
+    1055:	5e                   	pop    %esi
+    1056:	5d                   	pop    %ebp
+    1057:	c3                   	ret
+    return EOF;
+    1058:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    105d:	e9 6b ff ff ff       	jmp    fcd <fputc+0x4d>
+    1062:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1069:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001070 <fwrite>:
+{
+    1070:	55                   	push   %ebp
+    1071:	89 e5                	mov    %esp,%ebp
+    1073:	57                   	push   %edi
+    1074:	56                   	push   %esi
+    1075:	53                   	push   %ebx
+    1076:	83 ec 1c             	sub    $0x1c,%esp
+    1079:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  if(!(f->flags & IO_WRITE) || size <= 0)
+    107c:	8b 43 04             	mov    0x4(%ebx),%eax
+    107f:	a8 02                	test   $0x2,%al
+    1081:	0f 84 ec 00 00 00    	je     1173 <fwrite+0x103>
+    1087:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    108a:	85 c9                	test   %ecx,%ecx
+    108c:	0f 8e e1 00 00 00    	jle    1173 <fwrite+0x103>
+  if(threaded)
+    1092:	8b 15 e0 28 00 00    	mov    0x28e0,%edx
+    1098:	85 d2                	test   %edx,%edx
+    109a:	0f 85 1c 01 00 00    	jne    11bc <fwrite+0x14c>
+  if(!(f->flags & IO_SETUP))
+    10a0:	a8 40                	test   $0x40,%al
+    10a2:	0f 84 08 01 00 00    	je     11b0 <fwrite+0x140>
+  for(len = size*nmemb; len > 0; len -= n){
+    10a8:	8b 45 0c             	mov    0xc(%ebp),%eax
+    10ab:	0f af 45 10          	imul   0x10(%ebp),%eax
+    10af:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    10b2:	85 c0                	test   %eax,%eax
+    10b4:	0f 8e 2a 01 00 00    	jle    11e4 <fwrite+0x174>
+  s = p;
+    10ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  nl = 0;
+    10bd:	31 ff                	xor    %edi,%edi
+    10bf:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+        nl = 1;
+    10c2:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  s = p;
+    10c5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    10c8:	8b 43 14             	mov    0x14(%ebx),%eax
+        nl = 1;
+    10cb:	89 ce                	mov    %ecx,%esi
+    if(f->n == f->size && flush(f) < 0)
+    10cd:	89 c2                	mov    %eax,%edx
+    10cf:	39 f0                	cmp    %esi,%eax
+    10d1:	74 6e                	je     1141 <fwrite+0xd1>
+    10d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10d7:	90                   	nop
+    if(n > len)
+    10d8:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    n = f->size - f->n;
+    10db:	89 f1                	mov    %esi,%ecx
+    10dd:	29 c1                	sub    %eax,%ecx
+    10df:	39 f9                	cmp    %edi,%ecx
+    10e1:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    10e4:	85 c9                	test   %ecx,%ecx
+    10e6:	0f 8e 7c 00 00 00    	jle    1168 <fwrite+0xf8>
+    10ec:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    10ef:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    10f2:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    10f5:	8d 34 08             	lea    (%eax,%ecx,1),%esi
+    10f8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    10fb:	eb 06                	jmp    1103 <fwrite+0x93>
+    10fd:	8d 76 00             	lea    0x0(%esi),%esi
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1100:	8b 53 14             	mov    0x14(%ebx),%edx
+    1103:	8d 4a 01             	lea    0x1(%edx),%ecx
+    1106:	8b 73 08             	mov    0x8(%ebx),%esi
+    1109:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    110c:	0f b6 08             	movzbl (%eax),%ecx
+        nl = 1;
+    110f:	80 f9 0a             	cmp    $0xa,%cl
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1112:	88 0c 16             	mov    %cl,(%esi,%edx,1)
+        nl = 1;
+    1115:	be 01 00 00 00       	mov    $0x1,%esi
+    111a:	0f 44 fe             	cmove  %esi,%edi
+    for(i = 0; i < n; i++)
+    111d:	83 c0 01             	add    $0x1,%eax
+    1120:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    1123:	75 db                	jne    1100 <fwrite+0x90>
+    s += n;
+    1125:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1128:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    112b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    s += n;
+    112e:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    1131:	85 c0                	test   %eax,%eax
+    1133:	7e 48                	jle    117d <fwrite+0x10d>
+    1135:	8b 43 14             	mov    0x14(%ebx),%eax
+    1138:	8b 73 0c             	mov    0xc(%ebx),%esi
+    if(f->n == f->size && flush(f) < 0)
+    113b:	89 c2                	mov    %eax,%edx
+    113d:	39 f0                	cmp    %esi,%eax
+    113f:	75 97                	jne    10d8 <fwrite+0x68>
+    1141:	89 d8                	mov    %ebx,%eax
+    1143:	e8 d8 f8 ff ff       	call   a20 <flush>
+    1148:	85 c0                	test   %eax,%eax
+    114a:	78 31                	js     117d <fwrite+0x10d>
+    n = f->size - f->n;
+    114c:	8b 73 0c             	mov    0xc(%ebx),%esi
+    114f:	8b 43 14             	mov    0x14(%ebx),%eax
+    1152:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    1155:	89 f1                	mov    %esi,%ecx
+    1157:	89 c2                	mov    %eax,%edx
+    1159:	29 c1                	sub    %eax,%ecx
+    115b:	39 f9                	cmp    %edi,%ecx
+    115d:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1160:	85 c9                	test   %ecx,%ecx
+    1162:	7f 88                	jg     10ec <fwrite+0x7c>
+    1164:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    s += n;
+    1168:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    116b:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    116e:	e9 5a ff ff ff       	jmp    10cd <fwrite+0x5d>
+}
+    1173:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    1176:	31 c0                	xor    %eax,%eax
+}
+    1178:	5b                   	pop    %ebx
+    1179:	5e                   	pop    %esi
+    117a:	5f                   	pop    %edi
+    117b:	5d                   	pop    %ebp
+    117c:	c3                   	ret
+  if(nl && (f->flags & IO_LINE))
+    117d:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1180:	85 ff                	test   %edi,%edi
+    1182:	74 06                	je     118a <fwrite+0x11a>
+    1184:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1188:	75 1d                	jne    11a7 <fwrite+0x137>
+  return (s - (const char*)p) / size;
+    118a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    118d:	2b 75 08             	sub    0x8(%ebp),%esi
+  if(threaded)
+    1190:	a1 e0 28 00 00       	mov    0x28e0,%eax
+    1195:	85 c0                	test   %eax,%eax
+    1197:	75 3a                	jne    11d3 <fwrite+0x163>
+  return (s - (const char*)p) / size;
+    1199:	89 f0                	mov    %esi,%eax
+    119b:	99                   	cltd
+    119c:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    119f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11a2:	5b                   	pop    %ebx
+    11a3:	5e                   	pop    %esi
+    11a4:	5f                   	pop    %edi
+    11a5:	5d                   	pop    %ebp
+    11a6:	c3                   	ret
+    flush(f);
+    11a7:	89 d8                	mov    %ebx,%eax
+    11a9:	e8 72 f8 ff ff       	call   a20 <flush>
+    11ae:	eb da                	jmp    118a <fwrite+0x11a>
+    setup(f);
+    11b0:	89 d8                	mov    %ebx,%eax
+    11b2:	e8 19 f8 ff ff       	call   9d0 <setup>
+    11b7:	e9 ec fe ff ff       	jmp    10a8 <fwrite+0x38>
+    mutex_lock(&f->lock);
+    11bc:	83 ec 0c             	sub    $0xc,%esp
+    11bf:	8d 43 18             	lea    0x18(%ebx),%eax
+    11c2:	50                   	push   %eax
+    11c3:	e8 98 f1 ff ff       	call   360 <mutex_lock>
+  if(!(f->flags & IO_SETUP))
+    11c8:	8b 43 04             	mov    0x4(%ebx),%eax
+    11cb:	83 c4 10             	add    $0x10,%esp
+    11ce:	e9 cd fe ff ff       	jmp    10a0 <fwrite+0x30>
+    mutex_unlock(&f->lock);
+    11d3:	83 ec 0c             	sub    $0xc,%esp
+    11d6:	83 c3 18             	add    $0x18,%ebx
+    11d9:	53                   	push   %ebx
+    11da:	e8 d1 f1 ff ff       	call   3b0 <mutex_unlock>
+    11df:	83 c4 10             	add    $0x10,%esp
+    11e2:	eb b5                	jmp    1199 <fwrite+0x129>
+  for(len = size*nmemb; len > 0; len -= n){
+    11e4:	31 f6                	xor    %esi,%esi
+    11e6:	eb a8                	jmp    1190 <fwrite+0x120>
+    11e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11ef:	90                   	nop
+
+000011f0 <fgetc>:
+  return f->buf[f->r++] & 0xff;
+}
+
+int
+fgetc(FILE *f)
+{
+    11f0:	55                   	push   %ebp
+    11f1:	89 e5                	mov    %esp,%ebp
+    11f3:	56                   	push   %esi
+    11f4:	53                   	push   %ebx
+  if(threaded)
+    11f5:	8b 15 e0 28 00 00    	mov    0x28e0,%edx
+{
+    11fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    11fe:	85 d2                	test   %edx,%edx
+    1200:	75 2e                	jne    1230 <fgetc+0x40>
+  if(!(f->flags & IO_READ))
+    1202:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1206:	74 78                	je     1280 <fgetc+0x90>
+  if(f->r == f->n && fill(f) == 0)
+    1208:	8b 43 10             	mov    0x10(%ebx),%eax
+    120b:	3b 43 14             	cmp    0x14(%ebx),%eax
+    120e:	74 60                	je     1270 <fgetc+0x80>
+  return f->buf[f->r++] & 0xff;
+    1210:	8b 53 08             	mov    0x8(%ebx),%edx
+    1213:	8d 48 01             	lea    0x1(%eax),%ecx
+    1216:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1219:	0f b6 34 02          	movzbl (%edx,%eax,1),%esi
+  if(threaded)
+    121d:	a1 e0 28 00 00       	mov    0x28e0,%eax
+    1222:	85 c0                	test   %eax,%eax
+    1224:	75 2a                	jne    1250 <fgetc+0x60>
+
+  flockfile(f);
+  c = getc_unlocked(f);
+  funlockfile(f);
+  return c;
+}
+    1226:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1229:	89 f0                	mov    %esi,%eax
+    122b:	5b                   	pop    %ebx
+    122c:	5e                   	pop    %esi
+    122d:	5d                   	pop    %ebp
+    122e:	c3                   	ret
+    122f:	90                   	nop
+    mutex_lock(&f->lock);
+    1230:	83 ec 0c             	sub    $0xc,%esp
+    1233:	8d 43 18             	lea    0x18(%ebx),%eax
+    1236:	50                   	push   %eax
+    1237:	e8 24 f1 ff ff       	call   360 <mutex_lock>
+  if(!(f->flags & IO_READ))
+    123c:	83 c4 10             	add    $0x10,%esp
+    123f:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1243:	75 c3                	jne    1208 <fgetc+0x18>
+    return EOF;
+    1245:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    124a:	eb d1                	jmp    121d <fgetc+0x2d>
+    124c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1250:	83 ec 0c             	sub    $0xc,%esp
+    1253:	83 c3 18             	add    $0x18,%ebx
+    1256:	53                   	push   %ebx
+    1257:	e8 54 f1 ff ff       	call   3b0 <mutex_unlock>
+    125c:	83 c4 10             	add    $0x10,%esp
+}
+    125f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1262:	89 f0                	mov    %esi,%eax
+    1264:	5b                   	pop    %ebx
+    1265:	5e                   	pop    %esi
+    1266:	5d                   	pop    %ebp
+    1267:	c3                   	ret
+    1268:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    126f:	90                   	nop
+  if(f->r == f->n && fill(f) == 0)
+    1270:	89 d8                	mov    %ebx,%eax
+    1272:	e8 c9 f8 ff ff       	call   b40 <fill>
+    1277:	85 c0                	test   %eax,%eax
+    1279:	74 ca                	je     1245 <fgetc+0x55>
+  return f->buf[f->r++] & 0xff;
+    127b:	8b 43 10             	mov    0x10(%ebx),%eax
+    127e:	eb 90                	jmp    1210 <fgetc+0x20>
+    return EOF;
+    1280:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    1285:	eb 9f                	jmp    1226 <fgetc+0x36>
+    1287:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    128e:	66 90                	xchg   %ax,%ax
+
+00001290 <fread>:
+
+int
+fread(void *p, int size, int nmemb, FILE *f)
+{
+    1290:	55                   	push   %ebp
+    1291:	89 e5                	mov    %esp,%ebp
+    1293:	57                   	push   %edi
+    1294:	56                   	push   %esi
+    1295:	53                   	push   %ebx
+    1296:	83 ec 1c             	sub    $0x1c,%esp
+    1299:	8b 75 14             	mov    0x14(%ebp),%esi
+  char *d;
+  int n, len;
+
+  if(!(f->flags & IO_READ) || size <= 0)
+    129c:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+    12a0:	74 7e                	je     1320 <fread+0x90>
+    12a2:	8b 55 0c             	mov    0xc(%ebp),%edx
+    12a5:	85 d2                	test   %edx,%edx
+    12a7:	7e 77                	jle    1320 <fread+0x90>
+  if(threaded)
+    12a9:	a1 e0 28 00 00       	mov    0x28e0,%eax
+    return 0;
+  flockfile(f);
+  d = p;
+  for(len = size*nmemb; len > 0; len -= n){
+    12ae:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    12b1:	0f af 7d 10          	imul   0x10(%ebp),%edi
+  if(threaded)
+    12b5:	85 c0                	test   %eax,%eax
+    12b7:	0f 85 93 00 00 00    	jne    1350 <fread+0xc0>
+  for(len = size*nmemb; len > 0; len -= n){
+    12bd:	85 ff                	test   %edi,%edi
+    12bf:	7e 61                	jle    1322 <fread+0x92>
+    if(f->r == f->n && fill(f) == 0)
+    12c1:	8b 46 10             	mov    0x10(%esi),%eax
+  d = p;
+    12c4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    12c7:	eb 35                	jmp    12fe <fread+0x6e>
+    12c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      break;
+    n = f->n - f->r;
+    12d0:	29 c3                	sub    %eax,%ebx
+    12d2:	39 fb                	cmp    %edi,%ebx
+    12d4:	0f 4f df             	cmovg  %edi,%ebx
+    if(n > len)
+      n = len;
+    memmove(d, f->buf + f->r, n);
+    12d7:	83 ec 04             	sub    $0x4,%esp
+    12da:	53                   	push   %ebx
+    12db:	03 46 08             	add    0x8(%esi),%eax
+  for(len = size*nmemb; len > 0; len -= n){
+    12de:	29 df                	sub    %ebx,%edi
+    memmove(d, f->buf + f->r, n);
+    12e0:	50                   	push   %eax
+    12e1:	51                   	push   %ecx
+    12e2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    12e5:	e8 36 f0 ff ff       	call   320 <memmove>
+    f->r += n;
+    12ea:	8b 46 10             	mov    0x10(%esi),%eax
+    d += n;
+    12ed:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    12f0:	83 c4 10             	add    $0x10,%esp
+    f->r += n;
+    12f3:	01 d8                	add    %ebx,%eax
+    d += n;
+    12f5:	01 d9                	add    %ebx,%ecx
+    f->r += n;
+    12f7:	89 46 10             	mov    %eax,0x10(%esi)
+  for(len = size*nmemb; len > 0; len -= n){
+    12fa:	85 ff                	test   %edi,%edi
+    12fc:	7e 32                	jle    1330 <fread+0xa0>
+    if(f->r == f->n && fill(f) == 0)
+    12fe:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1301:	39 c3                	cmp    %eax,%ebx
+    1303:	75 cb                	jne    12d0 <fread+0x40>
+    1305:	89 f0                	mov    %esi,%eax
+    1307:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    130a:	e8 31 f8 ff ff       	call   b40 <fill>
+    130f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1312:	85 c0                	test   %eax,%eax
+    1314:	74 1a                	je     1330 <fread+0xa0>
+    n = f->n - f->r;
+    1316:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1319:	8b 46 10             	mov    0x10(%esi),%eax
+    131c:	eb b2                	jmp    12d0 <fread+0x40>
+    131e:	66 90                	xchg   %ax,%ax
+    return 0;
+    1320:	31 c0                	xor    %eax,%eax
+  }
+  funlockfile(f);
+  return (d - (char*)p) / size;
+}
+    1322:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1325:	5b                   	pop    %ebx
+    1326:	5e                   	pop    %esi
+    1327:	5f                   	pop    %edi
+    1328:	5d                   	pop    %ebp
+    1329:	c3                   	ret
+    132a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (d - (char*)p) / size;
+    1330:	2b 4d 08             	sub    0x8(%ebp),%ecx
+    1333:	89 cb                	mov    %ecx,%ebx
+  if(threaded)
+    1335:	a1 e0 28 00 00       	mov    0x28e0,%eax
+    133a:	85 c0                	test   %eax,%eax
+    133c:	75 32                	jne    1370 <fread+0xe0>
+  return (d - (char*)p) / size;
+    133e:	89 d8                	mov    %ebx,%eax
+    1340:	99                   	cltd
+    1341:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1344:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1347:	5b                   	pop    %ebx
+    1348:	5e                   	pop    %esi
+    1349:	5f                   	pop    %edi
+    134a:	5d                   	pop    %ebp
+    134b:	c3                   	ret
+    134c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    1350:	83 ec 0c             	sub    $0xc,%esp
+    1353:	8d 46 18             	lea    0x18(%esi),%eax
+    1356:	50                   	push   %eax
+    1357:	e8 04 f0 ff ff       	call   360 <mutex_lock>
+  for(len = size*nmemb; len > 0; len -= n){
+    135c:	83 c4 10             	add    $0x10,%esp
+    135f:	85 ff                	test   %edi,%edi
+    1361:	0f 8f 5a ff ff ff    	jg     12c1 <fread+0x31>
+    1367:	31 db                	xor    %ebx,%ebx
+    1369:	eb ca                	jmp    1335 <fread+0xa5>
+    136b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    136f:	90                   	nop
+    mutex_unlock(&f->lock);
+    1370:	83 ec 0c             	sub    $0xc,%esp
+    1373:	83 c6 18             	add    $0x18,%esi
+    1376:	56                   	push   %esi
+    1377:	e8 34 f0 ff ff       	call   3b0 <mutex_unlock>
+  return (d - (char*)p) / size;
+    137c:	89 d8                	mov    %ebx,%eax
+    137e:	83 c4 10             	add    $0x10,%esp
+    1381:	99                   	cltd
+    1382:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1385:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1388:	5b                   	pop    %ebx
+    1389:	5e                   	pop    %esi
+    138a:	5f                   	pop    %edi
+    138b:	5d                   	pop    %ebp
+    138c:	c3                   	ret
+    138d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001390 <fgets>:
+
+// Read a line of at most max-1 bytes, keeping the newline.
+// Returns 0 if there was nothing left to read.
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    1390:	55                   	push   %ebp
+    1391:	89 e5                	mov    %esp,%ebp
+    1393:	57                   	push   %edi
+    1394:	56                   	push   %esi
+    1395:	53                   	push   %ebx
+    1396:	83 ec 1c             	sub    $0x1c,%esp
+  if(threaded)
+    1399:	8b 35 e0 28 00 00    	mov    0x28e0,%esi
+{
+    139f:	8b 7d 08             	mov    0x8(%ebp),%edi
+    13a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if(threaded)
+    13a5:	85 f6                	test   %esi,%esi
+    13a7:	0f 85 83 00 00 00    	jne    1430 <fgets+0xa0>
+{
+    13ad:	31 f6                	xor    %esi,%esi
+    13af:	eb 2a                	jmp    13db <fgets+0x4b>
+    13b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return f->buf[f->r++] & 0xff;
+    13b8:	8b 53 08             	mov    0x8(%ebx),%edx
+    13bb:	8d 48 01             	lea    0x1(%eax),%ecx
+    13be:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    13c1:	0f b6 14 02          	movzbl (%edx,%eax,1),%edx
+
+  flockfile(f);
+  for(i = 0; i+1 < max; ){
+    if((c = getc_unlocked(f)) == EOF)
+      break;
+    buf[i++] = c;
+    13c5:	88 54 37 ff          	mov    %dl,-0x1(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    13c9:	80 fa 0a             	cmp    $0xa,%dl
+    13cc:	0f 84 96 00 00 00    	je     1468 <fgets+0xd8>
+    13d2:	83 fa 0d             	cmp    $0xd,%edx
+    13d5:	0f 84 8d 00 00 00    	je     1468 <fgets+0xd8>
+  for(i = 0; i+1 < max; ){
+    13db:	89 f2                	mov    %esi,%edx
+    13dd:	83 c6 01             	add    $0x1,%esi
+    13e0:	3b 75 0c             	cmp    0xc(%ebp),%esi
+    13e3:	7d 2b                	jge    1410 <fgets+0x80>
+  if(!(f->flags & IO_READ))
+    13e5:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    13e9:	74 25                	je     1410 <fgets+0x80>
+  if(f->r == f->n && fill(f) == 0)
+    13eb:	8b 43 10             	mov    0x10(%ebx),%eax
+    13ee:	3b 43 14             	cmp    0x14(%ebx),%eax
+    13f1:	75 c5                	jne    13b8 <fgets+0x28>
+    13f3:	89 d8                	mov    %ebx,%eax
+    13f5:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    13f8:	e8 43 f7 ff ff       	call   b40 <fill>
+    13fd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1400:	85 c0                	test   %eax,%eax
+    1402:	74 0c                	je     1410 <fgets+0x80>
+  return f->buf[f->r++] & 0xff;
+    1404:	8b 43 10             	mov    0x10(%ebx),%eax
+    1407:	eb af                	jmp    13b8 <fgets+0x28>
+    1409:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1410:	8b 0d e0 28 00 00    	mov    0x28e0,%ecx
+      break;
+  }
+  buf[i] = '\0';
+    1416:	c6 04 17 00          	movb   $0x0,(%edi,%edx,1)
+  if(threaded)
+    141a:	85 c9                	test   %ecx,%ecx
+    141c:	75 2a                	jne    1448 <fgets+0xb8>
+  funlockfile(f);
+  return i > 0 ? buf : 0;
+    141e:	31 c0                	xor    %eax,%eax
+    1420:	85 d2                	test   %edx,%edx
+    1422:	74 02                	je     1426 <fgets+0x96>
+    1424:	89 f8                	mov    %edi,%eax
+}
+    1426:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1429:	5b                   	pop    %ebx
+    142a:	5e                   	pop    %esi
+    142b:	5f                   	pop    %edi
+    142c:	5d                   	pop    %ebp
+    142d:	c3                   	ret
+    142e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    1430:	83 ec 0c             	sub    $0xc,%esp
+    1433:	8d 43 18             	lea    0x18(%ebx),%eax
+    1436:	50                   	push   %eax
+    1437:	e8 24 ef ff ff       	call   360 <mutex_lock>
+    143c:	83 c4 10             	add    $0x10,%esp
+    143f:	e9 69 ff ff ff       	jmp    13ad <fgets+0x1d>
+    1444:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1448:	83 ec 0c             	sub    $0xc,%esp
+    144b:	83 c3 18             	add    $0x18,%ebx
+    144e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1451:	53                   	push   %ebx
+    1452:	e8 59 ef ff ff       	call   3b0 <mutex_unlock>
+    1457:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    145a:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    145d:	31 c0                	xor    %eax,%eax
+    145f:	85 d2                	test   %edx,%edx
+    1461:	75 c1                	jne    1424 <fgets+0x94>
+    1463:	eb c1                	jmp    1426 <fgets+0x96>
+    1465:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1468:	a1 e0 28 00 00       	mov    0x28e0,%eax
+  buf[i] = '\0';
+    146d:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  if(threaded)
+    1471:	85 c0                	test   %eax,%eax
+    1473:	74 af                	je     1424 <fgets+0x94>
+    mutex_unlock(&f->lock);
+    1475:	83 ec 0c             	sub    $0xc,%esp
+    1478:	83 c3 18             	add    $0x18,%ebx
+    147b:	53                   	push   %ebx
+    147c:	e8 2f ef ff ff       	call   3b0 <mutex_unlock>
+    1481:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    1484:	89 f8                	mov    %edi,%eax
+    1486:	eb 9e                	jmp    1426 <fgets+0x96>
+    1488:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    148f:	90                   	nop
+
+00001490 <gets>:
+// at most a line per read(), goes through stdin's buffer: from a
+// file or pipe, a buffered read could take input meant for a child
+// process, so read a byte at a time.
+char*
+gets(char *buf, int max)
+{
+    1490:	55                   	push   %ebp
+    1491:	89 e5                	mov    %esp,%ebp
+    1493:	57                   	push   %edi
+    1494:	56                   	push   %esi
+    1495:	53                   	push   %ebx
+    1496:	83 ec 2c             	sub    $0x2c,%esp
+  int i, cc;
+  char c;
+
+  if(!(stdin->flags & IO_SETUP))
+    1499:	8b 15 e4 27 00 00    	mov    0x27e4,%edx
+{
+    149f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!(stdin->flags & IO_SETUP))
+    14a2:	f6 c2 40             	test   $0x40,%dl
+    14a5:	74 79                	je     1520 <gets+0x90>
+    setup(stdin);
+  if(stdin->flags & IO_DEV){
+    14a7:	83 e2 20             	and    $0x20,%edx
+    14aa:	89 d7                	mov    %edx,%edi
+    14ac:	75 52                	jne    1500 <gets+0x70>
+  if(f == 0){
+    14ae:	e8 ed f5 ff ff       	call   aa0 <fflush.part.0>
+    fgets(buf, max, stdin);
+    return buf;
+  }
+  fflush(0);
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    14b3:	8d 75 e7             	lea    -0x19(%ebp),%esi
+  for(i=0; i+1 < max; ){
+    14b6:	eb 2c                	jmp    14e4 <gets+0x54>
+    14b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14bf:	90                   	nop
+    cc = read(0, &c, 1);
+    14c0:	83 ec 04             	sub    $0x4,%esp
+    14c3:	6a 01                	push   $0x1
+    14c5:	56                   	push   %esi
+    14c6:	6a 00                	push   $0x0
+    14c8:	e8 f5 ef ff ff       	call   4c2 <read>
+    if(cc < 1)
+    14cd:	83 c4 10             	add    $0x10,%esp
+    14d0:	85 c0                	test   %eax,%eax
+    14d2:	7e 1b                	jle    14ef <gets+0x5f>
+      break;
+    buf[i++] = c;
+    14d4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    14d8:	88 44 3b ff          	mov    %al,-0x1(%ebx,%edi,1)
+    if(c == '\n' || c == '\r')
+    14dc:	3c 0a                	cmp    $0xa,%al
+    14de:	74 12                	je     14f2 <gets+0x62>
+    14e0:	3c 0d                	cmp    $0xd,%al
+    14e2:	74 0e                	je     14f2 <gets+0x62>
+  for(i=0; i+1 < max; ){
+    14e4:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    14e7:	83 c7 01             	add    $0x1,%edi
+    14ea:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+    14ed:	7c d1                	jl     14c0 <gets+0x30>
+{
+    14ef:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      break;
+  }
+  buf[i] = '\0';
+    14f2:	c6 04 3b 00          	movb   $0x0,(%ebx,%edi,1)
+  return buf;
+}
+    14f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    14f9:	89 d8                	mov    %ebx,%eax
+    14fb:	5b                   	pop    %ebx
+    14fc:	5e                   	pop    %esi
+    14fd:	5f                   	pop    %edi
+    14fe:	5d                   	pop    %ebp
+    14ff:	c3                   	ret
+    fgets(buf, max, stdin);
+    1500:	83 ec 04             	sub    $0x4,%esp
+    1503:	68 e0 27 00 00       	push   $0x27e0
+    1508:	ff 75 0c             	push   0xc(%ebp)
+    150b:	53                   	push   %ebx
+    150c:	e8 7f fe ff ff       	call   1390 <fgets>
+    return buf;
+    1511:	83 c4 10             	add    $0x10,%esp
+}
+    1514:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1517:	89 d8                	mov    %ebx,%eax
+    1519:	5b                   	pop    %ebx
+    151a:	5e                   	pop    %esi
+    151b:	5f                   	pop    %edi
+    151c:	5d                   	pop    %ebp
+    151d:	c3                   	ret
+    151e:	66 90                	xchg   %ax,%ax
+    setup(stdin);
+    1520:	b8 e0 27 00 00       	mov    $0x27e0,%eax
+    1525:	e8 a6 f4 ff ff       	call   9d0 <setup>
+  if(stdin->flags & IO_DEV){
+    152a:	8b 15 e4 27 00 00    	mov    0x27e4,%edx
+    1530:	e9 72 ff ff ff       	jmp    14a7 <gets+0x17>
+    1535:	66 90                	xchg   %ax,%ax
+    1537:	66 90                	xchg   %ax,%ax
+    1539:	66 90                	xchg   %ax,%ax
+    153b:	66 90                	xchg   %ax,%ax
+    153d:	66 90                	xchg   %ax,%ax
+    153f:	90                   	nop
+
+00001540 <bigfree>:
+
+// Give a big block back to the first-fit list, and return the
+// free block that now holds it. Caller holds lock.
+static Header*
+bigfree(Header *bp)
+{
+    1540:	55                   	push   %ebp
+    1541:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1543:	a1 84 2f 00 00       	mov    0x2f84,%eax
+{
+    1548:	89 e5                	mov    %esp,%ebp
+    154a:	56                   	push   %esi
+    154b:	53                   	push   %ebx
+    154c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1550:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1552:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1554:	39 ca                	cmp    %ecx,%edx
+    1556:	73 38                	jae    1590 <bigfree+0x50>
+    1558:	39 c1                	cmp    %eax,%ecx
+    155a:	72 04                	jb     1560 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    155c:	39 c2                	cmp    %eax,%edx
+    155e:	72 f0                	jb     1550 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1560:	8b 59 04             	mov    0x4(%ecx),%ebx
+    1563:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    1566:	39 f0                	cmp    %esi,%eax
+    1568:	74 36                	je     15a0 <bigfree+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    156a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  freep = p;
+  if(p + p->s.size == bp){
+    156c:	8b 42 04             	mov    0x4(%edx),%eax
+    156f:	89 cb                	mov    %ecx,%ebx
+  freep = p;
+    1571:	89 15 84 2f 00 00    	mov    %edx,0x2f84
+  if(p + p->s.size == bp){
+    1577:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    157a:	39 f1                	cmp    %esi,%ecx
+    157c:	74 2e                	je     15ac <bigfree+0x6c>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    157e:	89 1a                	mov    %ebx,(%edx)
+    return p;
+  }
+  p->s.ptr = bp;
+  return bp;
+}
+    1580:	89 c8                	mov    %ecx,%eax
+    1582:	5b                   	pop    %ebx
+    1583:	5e                   	pop    %esi
+    1584:	5d                   	pop    %ebp
+    1585:	c3                   	ret
+    1586:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    158d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1590:	39 c1                	cmp    %eax,%ecx
+    1592:	72 c8                	jb     155c <bigfree+0x1c>
+    1594:	eb ba                	jmp    1550 <bigfree+0x10>
+    1596:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    159d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    15a0:	03 58 04             	add    0x4(%eax),%ebx
+    15a3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    15a6:	8b 02                	mov    (%edx),%eax
+    15a8:	8b 00                	mov    (%eax),%eax
+    15aa:	eb be                	jmp    156a <bigfree+0x2a>
+    p->s.size += bp->s.size;
+    15ac:	03 41 04             	add    0x4(%ecx),%eax
+    15af:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    15b2:	8b 19                	mov    (%ecx),%ebx
+    return p;
+    15b4:	89 d1                	mov    %edx,%ecx
+}
+    15b6:	89 c8                	mov    %ecx,%eax
+    p->s.ptr = bp->s.ptr;
+    15b8:	89 1a                	mov    %ebx,(%edx)
+}
+    15ba:	5b                   	pop    %ebx
+    15bb:	5e                   	pop    %esi
+    15bc:	5d                   	pop    %ebp
+    15bd:	c3                   	ret
+    15be:	66 90                	xchg   %ax,%ax
+
+000015c0 <trim>:
+// If free block bp ends the heap, return its whole pages to the
+// kernel, unless something else has moved the break since.
+// Caller holds lock.
+static void
+trim(Header *bp)
+{
+    15c0:	55                   	push   %ebp
+    15c1:	89 e5                	mov    %esp,%ebp
+    15c3:	57                   	push   %edi
+    15c4:	56                   	push   %esi
+    15c5:	53                   	push   %ebx
+    15c6:	89 c3                	mov    %eax,%ebx
+    15c8:	83 ec 0c             	sub    $0xc,%esp
+  char *end;
+  uint n;
+
+  if((char*)(bp + bp->s.size) != heapend)
+    15cb:	8b 53 04             	mov    0x4(%ebx),%edx
+    15ce:	a1 80 2f 00 00       	mov    0x2f80,%eax
+    15d3:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+    15d6:	39 d0                	cmp    %edx,%eax
+    15d8:	74 0e                	je     15e8 <trim+0x28>
+  n = heapend - end;
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    bp->s.size -= n / sizeof(Header);
+    heapend = end;
+  }
+}
+    15da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15dd:	5b                   	pop    %ebx
+    15de:	5e                   	pop    %esi
+    15df:	5f                   	pop    %edi
+    15e0:	5d                   	pop    %ebp
+    15e1:	c3                   	ret
+    15e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  end = (char*)PGROUNDUP((uint)(bp + 2));
+    15e8:	8d bb 0f 10 00 00    	lea    0x100f(%ebx),%edi
+    15ee:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  n = heapend - end;
+    15f4:	29 f8                	sub    %edi,%eax
+    15f6:	89 c6                	mov    %eax,%esi
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    15f8:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    15fd:	76 db                	jbe    15da <trim+0x1a>
+    15ff:	83 ec 0c             	sub    $0xc,%esp
+    1602:	6a 00                	push   $0x0
+    1604:	e8 8b ef ff ff       	call   594 <sbrk>
+    1609:	83 c4 10             	add    $0x10,%esp
+    160c:	39 05 80 2f 00 00    	cmp    %eax,0x2f80
+    1612:	75 c6                	jne    15da <trim+0x1a>
+    1614:	89 f0                	mov    %esi,%eax
+    1616:	83 ec 0c             	sub    $0xc,%esp
+    1619:	f7 d8                	neg    %eax
+    161b:	50                   	push   %eax
+    161c:	e8 73 ef ff ff       	call   594 <sbrk>
+    1621:	83 c4 10             	add    $0x10,%esp
+    1624:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1627:	74 b1                	je     15da <trim+0x1a>
+    bp->s.size -= n / sizeof(Header);
+    1629:	89 f0                	mov    %esi,%eax
+    heapend = end;
+    162b:	89 3d 80 2f 00 00    	mov    %edi,0x2f80
+    bp->s.size -= n / sizeof(Header);
+    1631:	c1 e8 03             	shr    $0x3,%eax
+    1634:	29 43 04             	sub    %eax,0x4(%ebx)
+    heapend = end;
+    1637:	eb a1                	jmp    15da <trim+0x1a>
+    1639:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001640 <bigalloc>:
+}
+
+// Allocate a big block of nunits units. Caller holds lock.
+static Header*
+bigalloc(uint nunits)
+{
+    1640:	55                   	push   %ebp
+    1641:	89 e5                	mov    %esp,%ebp
+    1643:	57                   	push   %edi
+    1644:	89 c7                	mov    %eax,%edi
+    1646:	56                   	push   %esi
+    1647:	53                   	push   %ebx
+    1648:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    164b:	a1 84 2f 00 00       	mov    0x2f84,%eax
+    1650:	85 c0                	test   %eax,%eax
+    1652:	0f 84 98 00 00 00    	je     16f0 <bigalloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1658:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    165a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    165d:	39 f9                	cmp    %edi,%ecx
+    165f:	73 67                	jae    16c8 <bigalloc+0x88>
+  if(nu < 4096)
+    1661:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1666:	39 df                	cmp    %ebx,%edi
+    1668:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    166b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    1672:	eb 0d                	jmp    1681 <bigalloc+0x41>
+    1674:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1678:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    167a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    167d:	39 f9                	cmp    %edi,%ecx
+    167f:	73 47                	jae    16c8 <bigalloc+0x88>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    1681:	89 d0                	mov    %edx,%eax
+    1683:	39 15 84 2f 00 00    	cmp    %edx,0x2f84
+    1689:	75 ed                	jne    1678 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    168b:	83 ec 0c             	sub    $0xc,%esp
+    168e:	56                   	push   %esi
+    168f:	e8 00 ef ff ff       	call   594 <sbrk>
+  if(p == (char*)-1)
+    1694:	83 c4 10             	add    $0x10,%esp
+    1697:	83 f8 ff             	cmp    $0xffffffff,%eax
+    169a:	74 1a                	je     16b6 <bigalloc+0x76>
+  hp->s.size = nu;
+    169c:	89 58 04             	mov    %ebx,0x4(%eax)
+  heapend = p + nu * sizeof(Header);
+    169f:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    16a2:	89 15 80 2f 00 00    	mov    %edx,0x2f80
+  bigfree(hp);
+    16a8:	e8 93 fe ff ff       	call   1540 <bigfree>
+  return freep;
+    16ad:	a1 84 2f 00 00       	mov    0x2f84,%eax
+      if((p = morecore(nunits)) == 0)
+    16b2:	85 c0                	test   %eax,%eax
+    16b4:	75 c2                	jne    1678 <bigalloc+0x38>
+        return 0;
+  }
+}
+    16b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    16b9:	31 d2                	xor    %edx,%edx
+}
+    16bb:	5b                   	pop    %ebx
+    16bc:	89 d0                	mov    %edx,%eax
+    16be:	5e                   	pop    %esi
+    16bf:	5f                   	pop    %edi
+    16c0:	5d                   	pop    %ebp
+    16c1:	c3                   	ret
+    16c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    16c8:	39 cf                	cmp    %ecx,%edi
+    16ca:	74 54                	je     1720 <bigalloc+0xe0>
+        p->s.size -= nunits;
+    16cc:	29 f9                	sub    %edi,%ecx
+    16ce:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    16d1:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    16d4:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    16d7:	a3 84 2f 00 00       	mov    %eax,0x2f84
+}
+    16dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    16df:	89 d0                	mov    %edx,%eax
+    16e1:	5b                   	pop    %ebx
+    16e2:	5e                   	pop    %esi
+    16e3:	5f                   	pop    %edi
+    16e4:	5d                   	pop    %ebp
+    16e5:	c3                   	ret
+    16e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16ed:	8d 76 00             	lea    0x0(%esi),%esi
+    base.s.ptr = freep = prevp = &base;
+    16f0:	c7 05 84 2f 00 00 88 	movl   $0x2f88,0x2f84
+    16f7:	2f 00 00 
+    base.s.size = 0;
+    16fa:	ba 88 2f 00 00       	mov    $0x2f88,%edx
+    base.s.ptr = freep = prevp = &base;
+    16ff:	c7 05 88 2f 00 00 88 	movl   $0x2f88,0x2f88
+    1706:	2f 00 00 
+    base.s.size = 0;
+    1709:	c7 05 8c 2f 00 00 00 	movl   $0x0,0x2f8c
+    1710:	00 00 00 
+    if(p->s.size >= nunits){
+    1713:	e9 49 ff ff ff       	jmp    1661 <bigalloc+0x21>
+    1718:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    171f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1720:	8b 0a                	mov    (%edx),%ecx
+    1722:	89 08                	mov    %ecx,(%eax)
+    1724:	eb b1                	jmp    16d7 <bigalloc+0x97>
+    1726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    172d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001730 <drain>:
+}
+
+// Move n blocks of class c from cache tc to the shared list.
+static void
+drain(struct tcache *tc, int c, int n)
+{
+    1730:	55                   	push   %ebp
+    1731:	89 e5                	mov    %esp,%ebp
+    1733:	57                   	push   %edi
+    1734:	89 c7                	mov    %eax,%edi
+    1736:	56                   	push   %esi
+    1737:	89 d6                	mov    %edx,%esi
+    1739:	53                   	push   %ebx
+    173a:	89 cb                	mov    %ecx,%ebx
+    173c:	83 ec 0c             	sub    $0xc,%esp
+  if(threaded)
+    173f:	8b 15 04 2f 00 00    	mov    0x2f04,%edx
+    1745:	85 d2                	test   %edx,%edx
+    1747:	75 57                	jne    17a0 <drain+0x70>
+  Header *p;
+
+  acquire();
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1749:	85 c9                	test   %ecx,%ecx
+    174b:	7e 49                	jle    1796 <drain+0x66>
+    174d:	89 d9                	mov    %ebx,%ecx
+    174f:	8d 14 b7             	lea    (%edi,%esi,4),%edx
+    1752:	eb 23                	jmp    1777 <drain+0x47>
+    1754:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    tc->list[c] = p->s.ptr;
+    1758:	8b 18                	mov    (%eax),%ebx
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    175a:	83 e9 01             	sub    $0x1,%ecx
+    tc->n[c]--;
+    175d:	83 6a 20 01          	subl   $0x1,0x20(%edx)
+    tc->list[c] = p->s.ptr;
+    1761:	89 1a                	mov    %ebx,(%edx)
+    p->s.ptr = small[c];
+    1763:	8b 1c b5 60 2f 00 00 	mov    0x2f60(,%esi,4),%ebx
+    176a:	89 18                	mov    %ebx,(%eax)
+    small[c] = p;
+    176c:	89 04 b5 60 2f 00 00 	mov    %eax,0x2f60(,%esi,4)
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1773:	85 c9                	test   %ecx,%ecx
+    1775:	7e 06                	jle    177d <drain+0x4d>
+    1777:	8b 02                	mov    (%edx),%eax
+    1779:	85 c0                	test   %eax,%eax
+    177b:	75 db                	jne    1758 <drain+0x28>
+  if(threaded)
+    177d:	a1 04 2f 00 00       	mov    0x2f04,%eax
+    1782:	85 c0                	test   %eax,%eax
+    1784:	74 10                	je     1796 <drain+0x66>
+    mutex_unlock(&lock);
+    1786:	83 ec 0c             	sub    $0xc,%esp
+    1789:	68 08 2f 00 00       	push   $0x2f08
+    178e:	e8 1d ec ff ff       	call   3b0 <mutex_unlock>
+}
+    1793:	83 c4 10             	add    $0x10,%esp
+  }
+  release();
+}
+    1796:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1799:	5b                   	pop    %ebx
+    179a:	5e                   	pop    %esi
+    179b:	5f                   	pop    %edi
+    179c:	5d                   	pop    %ebp
+    179d:	c3                   	ret
+    179e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&lock);
+    17a0:	83 ec 0c             	sub    $0xc,%esp
+    17a3:	68 08 2f 00 00       	push   $0x2f08
+    17a8:	e8 b3 eb ff ff       	call   360 <mutex_lock>
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    17ad:	83 c4 10             	add    $0x10,%esp
+    17b0:	85 db                	test   %ebx,%ebx
+    17b2:	7f 99                	jg     174d <drain+0x1d>
+    17b4:	eb c7                	jmp    177d <drain+0x4d>
+    17b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000017c0 <mycache>:
+{
+    17c0:	55                   	push   %ebp
+    return &maincache;
+    17c1:	b8 20 2f 00 00       	mov    $0x2f20,%eax
+{
+    17c6:	89 e5                	mov    %esp,%ebp
+    17c8:	53                   	push   %ebx
+  sp = PGROUNDDOWN((uint)&sp);
+    17c9:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+    17cc:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+    17d2:	83 ec 14             	sub    $0x14,%esp
+  if(!threaded || sp == mainstack)
+    17d5:	8b 0d 04 2f 00 00    	mov    0x2f04,%ecx
+  sp = PGROUNDDOWN((uint)&sp);
+    17db:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  if(!threaded || sp == mainstack)
+    17de:	85 c9                	test   %ecx,%ecx
+    17e0:	74 0f                	je     17f1 <mycache+0x31>
+    17e2:	3b 1d 00 2f 00 00    	cmp    0x2f00,%ebx
+    17e8:	74 07                	je     17f1 <mycache+0x31>
+  if(*cp == 0){
+    17ea:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    17ed:	85 c0                	test   %eax,%eax
+    17ef:	74 0f                	je     1800 <mycache+0x40>
+}
+    17f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    17f4:	c9                   	leave
+    17f5:	c3                   	ret
+    17f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17fd:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1800:	83 ec 0c             	sub    $0xc,%esp
+    1803:	68 08 2f 00 00       	push   $0x2f08
+    1808:	e8 53 eb ff ff       	call   360 <mutex_lock>
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    180d:	b8 09 00 00 00       	mov    $0x9,%eax
+    1812:	e8 29 fe ff ff       	call   1640 <bigalloc>
+  if(threaded)
+    1817:	8b 15 04 2f 00 00    	mov    0x2f04,%edx
+    181d:	83 c4 10             	add    $0x10,%esp
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    1820:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(threaded)
+    1823:	85 d2                	test   %edx,%edx
+    1825:	75 29                	jne    1850 <mycache+0x90>
+    if(*cp == 0)
+    1827:	85 c0                	test   %eax,%eax
+    1829:	74 c6                	je     17f1 <mycache+0x31>
+    memset(*cp, 0, sizeof(**cp));
+    182b:	83 ec 04             	sub    $0x4,%esp
+    *cp = (struct tcache*)((Header*)*cp + 1);
+    182e:	83 c0 08             	add    $0x8,%eax
+    1831:	89 43 f8             	mov    %eax,-0x8(%ebx)
+    memset(*cp, 0, sizeof(**cp));
+    1834:	6a 40                	push   $0x40
+    1836:	6a 00                	push   $0x0
+    1838:	50                   	push   %eax
+    1839:	e8 f2 e9 ff ff       	call   230 <memset>
+  return *cp;
+    183e:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    1841:	83 c4 10             	add    $0x10,%esp
+    1844:	eb ab                	jmp    17f1 <mycache+0x31>
+    1846:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    184d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1850:	83 ec 0c             	sub    $0xc,%esp
+    1853:	68 08 2f 00 00       	push   $0x2f08
+    1858:	e8 53 eb ff ff       	call   3b0 <mutex_unlock>
+    if(*cp == 0)
+    185d:	8b 43 f8             	mov    -0x8(%ebx),%eax
+}
+    1860:	83 c4 10             	add    $0x10,%esp
+    1863:	eb c2                	jmp    1827 <mycache+0x67>
+    1865:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    186c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001870 <free>:
+
+void
+free(void *ap)
+{
+    1870:	55                   	push   %ebp
+    1871:	89 e5                	mov    %esp,%ebp
+    1873:	57                   	push   %edi
+    1874:	56                   	push   %esi
+    1875:	53                   	push   %ebx
+    1876:	83 ec 1c             	sub    $0x1c,%esp
+    1879:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  struct tcache *tc;
+  int c;
+
+  if(ap == 0)
+    187c:	85 f6                	test   %esi,%esi
+    187e:	74 51                	je     18d1 <free+0x61>
+    return;
+  bp = (Header*)ap - 1;
+    1880:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1883:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(bp->s.size > SMALLMAX / sizeof(Header)){
+    1886:	8b 46 fc             	mov    -0x4(%esi),%eax
+    1889:	3d 00 01 00 00       	cmp    $0x100,%eax
+    188e:	77 50                	ja     18e0 <free+0x70>
+    acquire();
+    trim(bigfree(bp));
+    release();
+    return;
+  }
+  for(c = 0; (2 << c) < bp->s.size; c++)
+    1890:	31 db                	xor    %ebx,%ebx
+    1892:	ba 02 00 00 00       	mov    $0x2,%edx
+    1897:	83 f8 02             	cmp    $0x2,%eax
+    189a:	76 11                	jbe    18ad <free+0x3d>
+    189c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    18a0:	83 c3 01             	add    $0x1,%ebx
+    18a3:	89 d7                	mov    %edx,%edi
+    18a5:	89 d9                	mov    %ebx,%ecx
+    18a7:	d3 e7                	shl    %cl,%edi
+    18a9:	39 c7                	cmp    %eax,%edi
+    18ab:	72 f3                	jb     18a0 <free+0x30>
+    ;
+  if((tc = mycache()) == 0){
+    18ad:	e8 0e ff ff ff       	call   17c0 <mycache>
+    18b2:	85 c0                	test   %eax,%eax
+    18b4:	74 7a                	je     1930 <free+0xc0>
+    bp->s.ptr = small[c];
+    small[c] = bp;
+    release();
+    return;
+  }
+  bp->s.ptr = tc->list[c];
+    18b6:	8d 0c 98             	lea    (%eax,%ebx,4),%ecx
+    18b9:	8b 11                	mov    (%ecx),%edx
+    18bb:	89 56 f8             	mov    %edx,-0x8(%esi)
+  tc->list[c] = bp;
+    18be:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    18c1:	89 31                	mov    %esi,(%ecx)
+  if(++tc->n[c] > TCACHEMAX)
+    18c3:	8b 71 20             	mov    0x20(%ecx),%esi
+    18c6:	8d 56 01             	lea    0x1(%esi),%edx
+    18c9:	89 51 20             	mov    %edx,0x20(%ecx)
+    18cc:	83 fa 20             	cmp    $0x20,%edx
+    18cf:	7f 47                	jg     1918 <free+0xa8>
+    drain(tc, c, BATCH);
+}
+    18d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    18d4:	5b                   	pop    %ebx
+    18d5:	5e                   	pop    %esi
+    18d6:	5f                   	pop    %edi
+    18d7:	5d                   	pop    %ebp
+    18d8:	c3                   	ret
+    18d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    18e0:	8b 1d 04 2f 00 00    	mov    0x2f04,%ebx
+    18e6:	85 db                	test   %ebx,%ebx
+    18e8:	75 66                	jne    1950 <free+0xe0>
+    trim(bigfree(bp));
+    18ea:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    18ed:	e8 4e fc ff ff       	call   1540 <bigfree>
+    18f2:	e8 c9 fc ff ff       	call   15c0 <trim>
+  if(threaded)
+    18f7:	8b 0d 04 2f 00 00    	mov    0x2f04,%ecx
+    18fd:	85 c9                	test   %ecx,%ecx
+    18ff:	74 d0                	je     18d1 <free+0x61>
+    mutex_unlock(&lock);
+    1901:	c7 45 08 08 2f 00 00 	movl   $0x2f08,0x8(%ebp)
+}
+    1908:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    190b:	5b                   	pop    %ebx
+    190c:	5e                   	pop    %esi
+    190d:	5f                   	pop    %edi
+    190e:	5d                   	pop    %ebp
+    mutex_unlock(&lock);
+    190f:	e9 9c ea ff ff       	jmp    3b0 <mutex_unlock>
+    1914:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    1918:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    drain(tc, c, BATCH);
+    191b:	89 da                	mov    %ebx,%edx
+    191d:	b9 10 00 00 00       	mov    $0x10,%ecx
+}
+    1922:	5b                   	pop    %ebx
+    1923:	5e                   	pop    %esi
+    1924:	5f                   	pop    %edi
+    1925:	5d                   	pop    %ebp
+    drain(tc, c, BATCH);
+    1926:	e9 05 fe ff ff       	jmp    1730 <drain>
+    192b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    192f:	90                   	nop
+  if(threaded)
+    1930:	8b 15 04 2f 00 00    	mov    0x2f04,%edx
+    1936:	85 d2                	test   %edx,%edx
+    1938:	75 28                	jne    1962 <free+0xf2>
+    bp->s.ptr = small[c];
+    193a:	8b 04 9d 60 2f 00 00 	mov    0x2f60(,%ebx,4),%eax
+    1941:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1944:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1947:	89 04 9d 60 2f 00 00 	mov    %eax,0x2f60(,%ebx,4)
+  if(threaded)
+    194e:	eb 81                	jmp    18d1 <free+0x61>
+    mutex_lock(&lock);
+    1950:	83 ec 0c             	sub    $0xc,%esp
+    1953:	68 08 2f 00 00       	push   $0x2f08
+    1958:	e8 03 ea ff ff       	call   360 <mutex_lock>
+}
+    195d:	83 c4 10             	add    $0x10,%esp
+    1960:	eb 88                	jmp    18ea <free+0x7a>
+    mutex_lock(&lock);
+    1962:	83 ec 0c             	sub    $0xc,%esp
+    1965:	68 08 2f 00 00       	push   $0x2f08
+    196a:	e8 f1 e9 ff ff       	call   360 <mutex_lock>
+    bp->s.ptr = small[c];
+    196f:	8b 04 9d 60 2f 00 00 	mov    0x2f60(,%ebx,4),%eax
+  if(threaded)
+    1976:	83 c4 10             	add    $0x10,%esp
+    bp->s.ptr = small[c];
+    1979:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    197c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    197f:	89 04 9d 60 2f 00 00 	mov    %eax,0x2f60(,%ebx,4)
+  if(threaded)
+    1986:	a1 04 2f 00 00       	mov    0x2f04,%eax
+    198b:	85 c0                	test   %eax,%eax
+    198d:	0f 85 6e ff ff ff    	jne    1901 <free+0x91>
+    1993:	e9 39 ff ff ff       	jmp    18d1 <free+0x61>
+    1998:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    199f:	90                   	nop
+
+000019a0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    19a0:	55                   	push   %ebp
+    19a1:	89 e5                	mov    %esp,%ebp
+    19a3:	57                   	push   %edi
+    19a4:	56                   	push   %esi
+    19a5:	53                   	push   %ebx
+    19a6:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  struct tcache *tc;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    19a9:	8b 45 08             	mov    0x8(%ebp),%eax
+    19ac:	8d 78 07             	lea    0x7(%eax),%edi
+    19af:	c1 ef 03             	shr    $0x3,%edi
+    19b2:	83 c7 01             	add    $0x1,%edi
+  if(nunits > SMALLMAX / sizeof(Header)){
+    19b5:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+    19bb:	77 5b                	ja     1a18 <malloc+0x78>
+    acquire();
+    p = bigalloc(nunits);
+    release();
+    return p ? (void*)(p + 1) : 0;
+  }
+  for(c = 0; (2 << c) < nunits; c++)
+    19bd:	31 c9                	xor    %ecx,%ecx
+    19bf:	b8 02 00 00 00       	mov    $0x2,%eax
+    19c4:	be 02 00 00 00       	mov    $0x2,%esi
+    19c9:	bb 02 00 00 00       	mov    $0x2,%ebx
+    19ce:	83 ff 02             	cmp    $0x2,%edi
+    19d1:	76 12                	jbe    19e5 <malloc+0x45>
+    19d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    19d7:	90                   	nop
+    19d8:	83 c1 01             	add    $0x1,%ecx
+    19db:	89 c3                	mov    %eax,%ebx
+    19dd:	d3 e3                	shl    %cl,%ebx
+    19df:	89 de                	mov    %ebx,%esi
+    19e1:	39 fb                	cmp    %edi,%ebx
+    19e3:	72 f3                	jb     19d8 <malloc+0x38>
+    19e5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    ;
+  if((tc = mycache()) == 0)
+    19e8:	e8 d3 fd ff ff       	call   17c0 <mycache>
+    19ed:	85 c0                	test   %eax,%eax
+    19ef:	74 51                	je     1a42 <malloc+0xa2>
+    return 0;
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    19f1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    19f4:	8d 3c 88             	lea    (%eax,%ecx,4),%edi
+    19f7:	8b 07                	mov    (%edi),%eax
+    19f9:	85 c0                	test   %eax,%eax
+    19fb:	74 53                	je     1a50 <malloc+0xb0>
+    return 0;
+  p = tc->list[c];
+  tc->list[c] = p->s.ptr;
+  tc->n[c]--;
+    19fd:	8b 57 20             	mov    0x20(%edi),%edx
+  tc->list[c] = p->s.ptr;
+    1a00:	8b 08                	mov    (%eax),%ecx
+  tc->n[c]--;
+    1a02:	83 ea 01             	sub    $0x1,%edx
+  return (void*)(p + 1);
+    1a05:	83 c0 08             	add    $0x8,%eax
+  tc->n[c]--;
+    1a08:	89 57 20             	mov    %edx,0x20(%edi)
+  tc->list[c] = p->s.ptr;
+    1a0b:	89 0f                	mov    %ecx,(%edi)
+}
+    1a0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a10:	5b                   	pop    %ebx
+    1a11:	5e                   	pop    %esi
+    1a12:	5f                   	pop    %edi
+    1a13:	5d                   	pop    %ebp
+    1a14:	c3                   	ret
+    1a15:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1a18:	a1 04 2f 00 00       	mov    0x2f04,%eax
+    1a1d:	85 c0                	test   %eax,%eax
+    1a1f:	0f 85 b3 00 00 00    	jne    1ad8 <malloc+0x138>
+    p = bigalloc(nunits);
+    1a25:	89 f8                	mov    %edi,%eax
+    1a27:	e8 14 fc ff ff       	call   1640 <bigalloc>
+    1a2c:	89 c3                	mov    %eax,%ebx
+  if(threaded)
+    1a2e:	a1 04 2f 00 00       	mov    0x2f04,%eax
+    1a33:	85 c0                	test   %eax,%eax
+    1a35:	0f 85 85 00 00 00    	jne    1ac0 <malloc+0x120>
+    return p ? (void*)(p + 1) : 0;
+    1a3b:	8d 43 08             	lea    0x8(%ebx),%eax
+    1a3e:	85 db                	test   %ebx,%ebx
+    1a40:	75 cb                	jne    1a0d <malloc+0x6d>
+    1a42:	31 c0                	xor    %eax,%eax
+}
+    1a44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a47:	5b                   	pop    %ebx
+    1a48:	5e                   	pop    %esi
+    1a49:	5f                   	pop    %edi
+    1a4a:	5d                   	pop    %ebp
+    1a4b:	c3                   	ret
+    1a4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1a50:	a1 04 2f 00 00       	mov    0x2f04,%eax
+    1a55:	85 c0                	test   %eax,%eax
+    1a57:	0f 85 29 01 00 00    	jne    1b86 <malloc+0x1e6>
+  if(small[c] == 0){
+    1a5d:	8b 04 8d 60 2f 00 00 	mov    0x2f60(,%ecx,4),%eax
+    1a64:	85 c0                	test   %eax,%eax
+    1a66:	0f 84 81 00 00 00    	je     1aed <malloc+0x14d>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1a6c:	31 db                	xor    %ebx,%ebx
+    1a6e:	eb 22                	jmp    1a92 <malloc+0xf2>
+    small[c] = p->s.ptr;
+    1a70:	8b 10                	mov    (%eax),%edx
+  for(moved = 0; moved < n && small[c]; moved++){
+    1a72:	83 c3 01             	add    $0x1,%ebx
+    small[c] = p->s.ptr;
+    1a75:	89 14 8d 60 2f 00 00 	mov    %edx,0x2f60(,%ecx,4)
+    p->s.ptr = tc->list[c];
+    1a7c:	8b 17                	mov    (%edi),%edx
+    1a7e:	89 10                	mov    %edx,(%eax)
+    tc->list[c] = p;
+    1a80:	89 07                	mov    %eax,(%edi)
+  for(moved = 0; moved < n && small[c]; moved++){
+    1a82:	83 fb 10             	cmp    $0x10,%ebx
+    1a85:	0f 84 e2 00 00 00    	je     1b6d <malloc+0x1cd>
+    1a8b:	8b 04 8d 60 2f 00 00 	mov    0x2f60(,%ecx,4),%eax
+    1a92:	85 c0                	test   %eax,%eax
+    1a94:	75 da                	jne    1a70 <malloc+0xd0>
+  if(threaded)
+    1a96:	8b 15 04 2f 00 00    	mov    0x2f04,%edx
+    1a9c:	85 d2                	test   %edx,%edx
+    1a9e:	0f 85 b4 00 00 00    	jne    1b58 <malloc+0x1b8>
+  tc->n[c] += moved;
+    1aa4:	8b 57 20             	mov    0x20(%edi),%edx
+    1aa7:	01 da                	add    %ebx,%edx
+    1aa9:	89 57 20             	mov    %edx,0x20(%edi)
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1aac:	85 db                	test   %ebx,%ebx
+    1aae:	74 92                	je     1a42 <malloc+0xa2>
+  p = tc->list[c];
+    1ab0:	8b 07                	mov    (%edi),%eax
+    1ab2:	e9 49 ff ff ff       	jmp    1a00 <malloc+0x60>
+    1ab7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1abe:	66 90                	xchg   %ax,%ax
+    mutex_unlock(&lock);
+    1ac0:	83 ec 0c             	sub    $0xc,%esp
+    1ac3:	68 08 2f 00 00       	push   $0x2f08
+    1ac8:	e8 e3 e8 ff ff       	call   3b0 <mutex_unlock>
+}
+    1acd:	83 c4 10             	add    $0x10,%esp
+    1ad0:	e9 66 ff ff ff       	jmp    1a3b <malloc+0x9b>
+    1ad5:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1ad8:	83 ec 0c             	sub    $0xc,%esp
+    1adb:	68 08 2f 00 00       	push   $0x2f08
+    1ae0:	e8 7b e8 ff ff       	call   360 <mutex_lock>
+}
+    1ae5:	83 c4 10             	add    $0x10,%esp
+    1ae8:	e9 38 ff ff ff       	jmp    1a25 <malloc+0x85>
+    if((chunk = bigalloc(CHUNK / sizeof(Header) + 1)) == 0){
+    1aed:	b8 01 02 00 00       	mov    $0x201,%eax
+    1af2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1af5:	e8 46 fb ff ff       	call   1640 <bigalloc>
+    1afa:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1afd:	85 c0                	test   %eax,%eax
+    1aff:	89 c2                	mov    %eax,%edx
+    1b01:	0f 84 ba 00 00 00    	je     1bc1 <malloc+0x221>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1b07:	83 c2 08             	add    $0x8,%edx
+    1b0a:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+    1b10:	0f 87 d0 00 00 00    	ja     1be6 <malloc+0x246>
+    1b16:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+    1b1d:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    1b20:	89 df                	mov    %ebx,%edi
+    1b22:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1b25:	8d 76 00             	lea    0x0(%esi),%esi
+      p->s.size = units;
+    1b28:	89 72 04             	mov    %esi,0x4(%edx)
+      p->s.ptr = small[c];
+    1b2b:	8b 04 8d 60 2f 00 00 	mov    0x2f60(,%ecx,4),%eax
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1b32:	01 df                	add    %ebx,%edi
+    1b34:	89 55 e0             	mov    %edx,-0x20(%ebp)
+      p->s.ptr = small[c];
+    1b37:	89 02                	mov    %eax,(%edx)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1b39:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      small[c] = p;
+    1b3c:	89 14 8d 60 2f 00 00 	mov    %edx,0x2f60(,%ecx,4)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1b43:	01 c2                	add    %eax,%edx
+    1b45:	81 ff 00 02 00 00    	cmp    $0x200,%edi
+    1b4b:	76 db                	jbe    1b28 <malloc+0x188>
+    1b4d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1b50:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1b53:	e9 14 ff ff ff       	jmp    1a6c <malloc+0xcc>
+    mutex_unlock(&lock);
+    1b58:	83 ec 0c             	sub    $0xc,%esp
+    1b5b:	68 08 2f 00 00       	push   $0x2f08
+    1b60:	e8 4b e8 ff ff       	call   3b0 <mutex_unlock>
+}
+    1b65:	83 c4 10             	add    $0x10,%esp
+    1b68:	e9 37 ff ff ff       	jmp    1aa4 <malloc+0x104>
+  if(threaded)
+    1b6d:	a1 04 2f 00 00       	mov    0x2f04,%eax
+    1b72:	85 c0                	test   %eax,%eax
+    1b74:	75 2b                	jne    1ba1 <malloc+0x201>
+  tc->n[c] += moved;
+    1b76:	8b 47 20             	mov    0x20(%edi),%eax
+    1b79:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1b7c:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1b7e:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1b81:	e9 7a fe ff ff       	jmp    1a00 <malloc+0x60>
+    mutex_lock(&lock);
+    1b86:	83 ec 0c             	sub    $0xc,%esp
+    1b89:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1b8c:	68 08 2f 00 00       	push   $0x2f08
+    1b91:	e8 ca e7 ff ff       	call   360 <mutex_lock>
+}
+    1b96:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1b99:	83 c4 10             	add    $0x10,%esp
+    1b9c:	e9 bc fe ff ff       	jmp    1a5d <malloc+0xbd>
+    mutex_unlock(&lock);
+    1ba1:	83 ec 0c             	sub    $0xc,%esp
+    1ba4:	68 08 2f 00 00       	push   $0x2f08
+    1ba9:	e8 02 e8 ff ff       	call   3b0 <mutex_unlock>
+  tc->n[c] += moved;
+    1bae:	8b 47 20             	mov    0x20(%edi),%eax
+    1bb1:	83 c4 10             	add    $0x10,%esp
+    1bb4:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1bb7:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1bb9:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1bbc:	e9 3f fe ff ff       	jmp    1a00 <malloc+0x60>
+  if(threaded)
+    1bc1:	8b 0d 04 2f 00 00    	mov    0x2f04,%ecx
+    1bc7:	85 c9                	test   %ecx,%ecx
+    1bc9:	0f 84 73 fe ff ff    	je     1a42 <malloc+0xa2>
+    mutex_unlock(&lock);
+    1bcf:	83 ec 0c             	sub    $0xc,%esp
+    1bd2:	68 08 2f 00 00       	push   $0x2f08
+    1bd7:	e8 d4 e7 ff ff       	call   3b0 <mutex_unlock>
+    1bdc:	83 c4 10             	add    $0x10,%esp
+    return p ? (void*)(p + 1) : 0;
+    1bdf:	31 c0                	xor    %eax,%eax
+    1be1:	e9 5e fe ff ff       	jmp    1a44 <malloc+0xa4>
+  for(moved = 0; moved < n && small[c]; moved++){
+    1be6:	8b 04 8d 60 2f 00 00 	mov    0x2f60(,%ecx,4),%eax
+    1bed:	e9 7a fe ff ff       	jmp    1a6c <malloc+0xcc>
+    1bf2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bf9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001c00 <malloc_threaded>:
+void
+malloc_threaded(void)
+{
+  uint sp;
+
+  if(threaded)
+    1c00:	a1 04 2f 00 00       	mov    0x2f04,%eax
+    1c05:	85 c0                	test   %eax,%eax
+    1c07:	74 07                	je     1c10 <malloc_threaded+0x10>
+    1c09:	c3                   	ret
+    1c0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+{
+    1c10:	55                   	push   %ebp
+    1c11:	89 e5                	mov    %esp,%ebp
+    1c13:	83 ec 24             	sub    $0x24,%esp
+    return;
+  mutex_init(&lock);
+    1c16:	68 08 2f 00 00       	push   $0x2f08
+    1c1b:	e8 30 e7 ff ff       	call   350 <mutex_init>
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1c20:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1c23:	83 c4 10             	add    $0x10,%esp
+  threaded = 1;
+    1c26:	c7 05 04 2f 00 00 01 	movl   $0x1,0x2f04
+    1c2d:	00 00 00 
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1c30:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    1c35:	a3 00 2f 00 00       	mov    %eax,0x2f00
+}
+    1c3a:	c9                   	leave
+    1c3b:	c3                   	ret
+    1c3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001c40 <malloc_thread_exit>:
+
+// Called by thread_join() with the cache slot of a finished
+// thread: give its blocks, and the cache itself, back.
+void
+malloc_thread_exit(void **cachep)
+{
+    1c40:	55                   	push   %ebp
+    1c41:	89 e5                	mov    %esp,%ebp
+    1c43:	57                   	push   %edi
+    1c44:	56                   	push   %esi
+    1c45:	53                   	push   %ebx
+    1c46:	83 ec 0c             	sub    $0xc,%esp
+    1c49:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct tcache *tc;
+  int c;
+
+  if((tc = *cachep) == 0)
+    1c4c:	8b 37                	mov    (%edi),%esi
+    1c4e:	85 f6                	test   %esi,%esi
+    1c50:	74 41                	je     1c93 <malloc_thread_exit+0x53>
+    return;
+  for(c = 0; c < NCLASS; c++)
+    1c52:	31 db                	xor    %ebx,%ebx
+    1c54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    drain(tc, c, tc->n[c]);
+    1c58:	8b 4c 9e 20          	mov    0x20(%esi,%ebx,4),%ecx
+    1c5c:	89 da                	mov    %ebx,%edx
+    1c5e:	89 f0                	mov    %esi,%eax
+  for(c = 0; c < NCLASS; c++)
+    1c60:	83 c3 01             	add    $0x1,%ebx
+    drain(tc, c, tc->n[c]);
+    1c63:	e8 c8 fa ff ff       	call   1730 <drain>
+  for(c = 0; c < NCLASS; c++)
+    1c68:	83 fb 08             	cmp    $0x8,%ebx
+    1c6b:	75 eb                	jne    1c58 <malloc_thread_exit+0x18>
+  if(threaded)
+    1c6d:	8b 15 04 2f 00 00    	mov    0x2f04,%edx
+    1c73:	85 d2                	test   %edx,%edx
+    1c75:	75 29                	jne    1ca0 <malloc_thread_exit+0x60>
+  acquire();
+  trim(bigfree((Header*)tc - 1));
+    1c77:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1c7a:	e8 c1 f8 ff ff       	call   1540 <bigfree>
+    1c7f:	e8 3c f9 ff ff       	call   15c0 <trim>
+  if(threaded)
+    1c84:	a1 04 2f 00 00       	mov    0x2f04,%eax
+    1c89:	85 c0                	test   %eax,%eax
+    1c8b:	75 2b                	jne    1cb8 <malloc_thread_exit+0x78>
+  release();
+  *cachep = 0;
+    1c8d:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+}
+    1c93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c96:	5b                   	pop    %ebx
+    1c97:	5e                   	pop    %esi
+    1c98:	5f                   	pop    %edi
+    1c99:	5d                   	pop    %ebp
+    1c9a:	c3                   	ret
+    1c9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1c9f:	90                   	nop
+    mutex_lock(&lock);
+    1ca0:	83 ec 0c             	sub    $0xc,%esp
+    1ca3:	68 08 2f 00 00       	push   $0x2f08
+    1ca8:	e8 b3 e6 ff ff       	call   360 <mutex_lock>
+}
+    1cad:	83 c4 10             	add    $0x10,%esp
+    1cb0:	eb c5                	jmp    1c77 <malloc_thread_exit+0x37>
+    1cb2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1cb8:	83 ec 0c             	sub    $0xc,%esp
+    1cbb:	68 08 2f 00 00       	push   $0x2f08
+    1cc0:	e8 eb e6 ff ff       	call   3b0 <mutex_unlock>
+}
+    1cc5:	83 c4 10             	add    $0x10,%esp
+    1cc8:	eb c3                	jmp    1c8d <malloc_thread_exit+0x4d>
+    1cca:	66 90                	xchg   %ax,%ax
+    1ccc:	66 90                	xchg   %ax,%ax
+    1cce:	66 90                	xchg   %ax,%ax
+
+00001cd0 <thread_create>:
+
+// Start fn(arg) in a new thread on a freshly allocated
+// page-aligned stack.  Returns the thread's pid.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1cd0:	55                   	push   %ebp
+    1cd1:	89 e5                	mov    %esp,%ebp
+    1cd3:	53                   	push   %ebx
+    1cd4:	83 ec 14             	sub    $0x14,%esp
+  char *mem, *stack;
+  int pid;
+
+  malloc_threaded();
+    1cd7:	e8 24 ff ff ff       	call   1c00 <malloc_threaded>
+  stdio_threaded();
+    1cdc:	e8 cf ee ff ff       	call   bb0 <stdio_threaded>
+  if((mem = malloc(2*PGSIZE)) == 0)
+    1ce1:	83 ec 0c             	sub    $0xc,%esp
+    1ce4:	68 00 20 00 00       	push   $0x2000
+    1ce9:	e8 b2 fc ff ff       	call   19a0 <malloc>
+    1cee:	83 c4 10             	add    $0x10,%esp
+    1cf1:	85 c0                	test   %eax,%eax
+    1cf3:	74 52                	je     1d47 <thread_create+0x77>
+    1cf5:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1cf7:	8d 80 07 10 00 00    	lea    0x1007(%eax),%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+  ((char**)stack)[-2] = 0;
+  if((pid = clone(fn, arg, stack)) < 0)
+    1cfd:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1d00:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+    1d05:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  ((char**)stack)[-2] = 0;
+    1d08:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+  if((pid = clone(fn, arg, stack)) < 0)
+    1d0f:	50                   	push   %eax
+    1d10:	ff 75 0c             	push   0xc(%ebp)
+    1d13:	ff 75 08             	push   0x8(%ebp)
+    1d16:	e8 97 e8 ff ff       	call   5b2 <clone>
+    1d1b:	83 c4 10             	add    $0x10,%esp
+    1d1e:	85 c0                	test   %eax,%eax
+    1d20:	78 0e                	js     1d30 <thread_create+0x60>
+    free(mem);
+  return pid;
+}
+    1d22:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1d25:	c9                   	leave
+    1d26:	c3                   	ret
+    1d27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d2e:	66 90                	xchg   %ax,%ax
+    free(mem);
+    1d30:	83 ec 0c             	sub    $0xc,%esp
+    1d33:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1d36:	53                   	push   %ebx
+    1d37:	e8 34 fb ff ff       	call   1870 <free>
+    1d3c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1d3f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    1d42:	83 c4 10             	add    $0x10,%esp
+}
+    1d45:	c9                   	leave
+    1d46:	c3                   	ret
+    return -1;
+    1d47:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1d4c:	eb d4                	jmp    1d22 <thread_create+0x52>
+    1d4e:	66 90                	xchg   %ax,%ax
+
+00001d50 <thread_join>:
+
+// Wait for a thread to finish and free its stack.
+int
+thread_join(void)
+{
+    1d50:	55                   	push   %ebp
+    1d51:	89 e5                	mov    %esp,%ebp
+    1d53:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    1d54:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    1d57:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    1d5a:	50                   	push   %eax
+    1d5b:	e8 61 e8 ff ff       	call   5c1 <join>
+    1d60:	83 c4 10             	add    $0x10,%esp
+    1d63:	85 c0                	test   %eax,%eax
+    1d65:	78 29                	js     1d90 <thread_join+0x40>
+    1d67:	89 c3                	mov    %eax,%ebx
+    return -1;
+  malloc_thread_exit(&((void**)stack)[-2]);
+    1d69:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1d6c:	83 ec 0c             	sub    $0xc,%esp
+    1d6f:	83 e8 08             	sub    $0x8,%eax
+    1d72:	50                   	push   %eax
+    1d73:	e8 c8 fe ff ff       	call   1c40 <malloc_thread_exit>
+  free(((char**)stack)[-1]);
+    1d78:	58                   	pop    %eax
+    1d79:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1d7c:	ff 70 fc             	push   -0x4(%eax)
+    1d7f:	e8 ec fa ff ff       	call   1870 <free>
+  return pid;
+    1d84:	83 c4 10             	add    $0x10,%esp
+}
+    1d87:	89 d8                	mov    %ebx,%eax
+    1d89:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1d8c:	c9                   	leave
+    1d8d:	c3                   	ret
+    1d8e:	66 90                	xchg   %ax,%ax
+    return -1;
+    1d90:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    1d95:	eb f0                	jmp    1d87 <thread_join+0x37>
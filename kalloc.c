@@ -1,6 +1,11 @@
 // Physical memory allocator, intended to allocate
 // memory for user processes, kernel stacks, page table pages,
 // and pipe buffers. Allocates 4096-byte pages.
+//
+// Freed pages go on freelist. While a CPU has nothing to run,
+// scheduler() calls kzeroidle() to zero them and move them to
+// zerolist, from which kzalloc() hands out pages that need no
+// clearing.
 
 #include "types.h"
 #include "defs.h"
@@ -9,8 +14,12 @@
 #include "mmu.h"
 #include "spinlock.h"
 
+#ifndef KFREEJUNK
+#define KFREEJUNK 1      // fill freed pages with junk
+#endif
 
 void freerange(void *vstart, void *vend);
+static int khugesplit(void);
 
 extern char end[]; // first address after kernel loaded from ELF file
 // defined by the kernel linker script in kernel.ld
@@ -23,8 +32,32 @@ struct {
     struct spinlock lock;
     int use_lock;
     struct run *freelist;
+    struct run *zerolist;    // zeroed pages, apart from the run link
+    int nfree;               // pages on freelist and zerolist
 } kmem;
 
+// 4MB pages for huge user mappings, carved from the top of
+// memory at boot since the free list cannot supply contiguous,
+// aligned 4MB regions. The pool is not a fixed reservation: when
+// kalloc() runs out, it breaks an idle 4MB page up into free 4KB
+// pages (see khugesplit), and deallocuvm() does the same for one
+// a process shrinks into.
+struct {
+    struct spinlock lock;
+    int n;
+    char *free[NHUGEPG];
+} hugepool;
+
+// An entry of the BIOS memory map saved by bootasm.S.
+struct e820 {
+    uint addr, addrhi;
+    uint len, lenhi;
+    uint type;
+};
+
+#define E820_RAM   1              // usable memory
+#define MEMDEFAULT 0xE000000      // top of memory if the BIOS gave no map
+
 // Initialization happens in two phases.
 // 1. main() calls kinit1() while still using entrypgdir to place just
 // the pages mapped by entrypgdir on free list.
@@ -37,9 +70,49 @@ kinit1(void *vstart, void *vend) {
     freerange(vstart, vend);
 }
 
+// Free the pages of [vstart, vend) in the RAM ranges of the BIOS
+// memory map. Memory beyond PHYSTOP (and any above 4GB) is left
+// alone: the kernel can only use what it maps at KERNBASE.
 void
 kinit2(void *vstart, void *vend) {
-    freerange(vstart, vend);
+    struct e820 *map, *e;
+    struct e820 dflt;
+    uint lo, hi;
+    char *p;
+
+    initlock(&hugepool.lock, "hugepool");
+    map = (struct e820 *) P2V(E820MAP + 4);
+    e = (struct e820 *) P2V((uint) *(ushort *) P2V(E820MAP));
+    if (e <= map) {
+        dflt.addr = 0;
+        dflt.len = MEMDEFAULT;
+        dflt.addrhi = dflt.lenhi = 0;
+        dflt.type = E820_RAM;
+        map = &dflt;
+        e = map + 1;
+    }
+    // Walk the map from the top, so that the huge page pool
+    // comes from the highest memory.
+    while (--e >= map) {
+        if (e->type != E820_RAM || e->addrhi != 0)
+            continue;
+        lo = e->addr;
+        hi = (e->lenhi != 0 || lo + e->len < lo) ? 0xFFFFFFFF : lo + e->len;
+        if (lo < V2P(vstart))
+            lo = V2P(vstart);
+        if (hi > V2P(vend))
+            hi = V2P(vend);
+        if (lo >= hi)
+            continue;
+        p = (char *) P2V(hi);
+        while (hugepool.n < NHUGEPG &&
+               (char *) HPGROUNDDOWN((uint) p) - HPGSIZE >= (char *) P2V(lo)) {
+            freerange((char *) HPGROUNDDOWN((uint) p), p);
+            p = (char *) HPGROUNDDOWN((uint) p) - HPGSIZE;
+            hugepool.free[hugepool.n++] = p;
+        }
+        freerange(P2V(lo), p);
+    }
     kmem.use_lock = 1;
 }
 
@@ -65,13 +138,15 @@ kfree(char *v) {
         panic("kfree");
 
     // Fill with junk to catch dangling refs.
-    memset(v, 1, PGSIZE);
+    if (KFREEJUNK)
+        memset(v, 1, PGSIZE);
 
     if (kmem.use_lock)
         acquire(&kmem.lock);
     r = (struct run *) v;
     r->next = kmem.freelist;
     kmem.freelist = r;
+    kmem.nfree++;
     if (kmem.use_lock)
         release(&kmem.lock);
 }
@@ -84,15 +159,114 @@ char *
 kalloc(void) {
     struct run *r;
 
+    again:
     if (kmem.use_lock)
         acquire(&kmem.lock);
     r = kmem.freelist;
     if (r)
         kmem.freelist = r->next;
+    else if ((r = kmem.zerolist) != 0)
+        kmem.zerolist = r->next;
+    if (r)
+        kmem.nfree--;
     if (kmem.use_lock)
         release(&kmem.lock);
+    if (r == 0 && kmem.use_lock && khugesplit())
+        goto again;
     //由于内存中的所有数据都可以看作是一系列字节(byte)，而char类型刚好占用一个字节的空间，因此将其地址转换为char类型的指针可以方便地对内存进行读写操作。
     //C语言中，char类型的指针可以被用来访问内存中的任何数据。
     return (char *) r;
 }
 
+// Allocate one zeroed page, preferring one cleared ahead of
+// time by kzeroidle().
+char *
+kzalloc(void) {
+    struct run *r;
+
+    if (kmem.use_lock)
+        acquire(&kmem.lock);
+    r = kmem.zerolist;
+    if (r) {
+        kmem.zerolist = r->next;
+        kmem.nfree--;
+    }
+    if (kmem.use_lock)
+        release(&kmem.lock);
+    if (r) {
+        r->next = 0;
+        return (char *) r;
+    }
+    if ((r = (struct run *) kalloc()) != 0)
+        memset(r, 0, PGSIZE);
+    return (char *) r;
+}
+
+// Zero one page from freelist and move it to zerolist.
+// Called by scheduler() when it has nothing to run.
+// Returns 0 if there was no page to zero.
+int
+kzeroidle(void) {
+    struct run *r;
+
+    acquire(&kmem.lock);
+    r = kmem.freelist;
+    if (r)
+        kmem.freelist = r->next;
+    release(&kmem.lock);
+    if (r == 0)
+        return 0;
+
+    memset(r, 0, PGSIZE);
+
+    acquire(&kmem.lock);
+    r->next = kmem.zerolist;
+    kmem.zerolist = r;
+    release(&kmem.lock);
+    return 1;
+}
+
+// Return the number of free pages, counting those of idle 4MB
+// pages that kalloc() can break up. The swap daemon uses it to
+// decide when to page out.
+int
+kfreecount(void) {
+    return kmem.nfree + hugepool.n * NPTENTRIES;
+}
+
+// Allocate one 4MB, 4MB-aligned page from the huge page pool.
+// Returns 0 if the pool is empty. The page is not zeroed.
+char *
+khugealloc(void) {
+    char *v;
+
+    v = 0;
+    acquire(&hugepool.lock);
+    if (hugepool.n > 0)
+        v = hugepool.free[--hugepool.n];
+    release(&hugepool.lock);
+    return v;
+}
+
+void
+khugefree(char *v) {
+    if ((uint) v % HPGSIZE)
+        panic("khugefree");
+    acquire(&hugepool.lock);
+    if (hugepool.n == NHUGEPG)
+        panic("khugefree: pool full");
+    hugepool.free[hugepool.n++] = v;
+    release(&hugepool.lock);
+}
+
+// Move an idle 4MB page from the pool to the free list as 4KB
+// pages. Returns 0 if the pool is empty.
+static int
+khugesplit(void) {
+    char *v;
+
+    if ((v = khugealloc()) == 0)
+        return 0;
+    freerange(v, v + HPGSIZE);
+    return 1;
+}
@@ -32,6 +32,7 @@
 #define TIMER   (0x0320/4)   // Local Vector Table 0 (TIMER)
   #define X1         0x0000000B   // divide counts by 1
   #define PERIODIC   0x00020000   // Periodic
+  #define TICKCOUNT  10000000     // Timer counts per tick
 #define PCINT   (0x0340/4)   // Performance Counter LVT
 #define LINT0   (0x0350/4)   // Local Vector Table 1 (LINT0)
 #define LINT1   (0x0360/4)   // Local Vector Table 2 (LINT1)
@@ -66,7 +67,7 @@ lapicinit(void)
   // TICR would be calibrated using an external time source.
   lapicw(TDCR, X1);
   lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
-  lapicw(TICR, 10000000);
+  lapicw(TICR, TICKCOUNT);
 
   // Disable logical interrupt lines.
   lapicw(LINT0, MASKED);
@@ -113,6 +114,47 @@ lapiceoi(void)
     lapicw(EOI, 0);
 }
 
+// Put the timer back into periodic mode, one interrupt per tick.
+void
+lapicperiodic(void)
+{
+  if(!lapic)
+    return;
+  lapicw(TDCR, X1);
+  lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
+  lapicw(TICR, TICKCOUNT);
+}
+
+// Interrupt once, n ticks from now, and then stop.
+// n <= 0 stops the timer altogether.
+void
+lapiconeshot(int n)
+{
+  if(!lapic)
+    return;
+  if(n <= 0){
+    lapicw(TIMER, MASKED | (T_IRQ0 + IRQ_TIMER));
+    return;
+  }
+  if(n > 0xFFFFFFFF / TICKCOUNT)
+    n = 0xFFFFFFFF / TICKCOUNT;
+  lapicw(TDCR, X1);
+  lapicw(TIMER, T_IRQ0 + IRQ_TIMER);
+  lapicw(TICR, (uint)n * TICKCOUNT);
+}
+
+// Send interrupt vector to the CPU with the given APIC ID.
+void
+lapicipi(int apicid, int vector)
+{
+  if(!lapic)
+    return;
+  lapicw(ICRHI, apicid<<24);
+  lapicw(ICRLO, FIXED | ASSERT | vector);
+  while(lapic[ICRLO] & DELIVS)
+    ;
+}
+
 // Spin for a given number of microseconds.
 // On real hardware would want to tune this dynamically.
 void
@@ -0,0 +1,3976 @@
+
+_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	53                   	push   %ebx
+       e:	51                   	push   %ecx
+  if(argc != 3){
+       f:	83 39 03             	cmpl   $0x3,(%ecx)
+{
+      12:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc != 3){
+      15:	74 13                	je     2a <main+0x2a>
+    printf(2, "Usage: ln old new\n");
+      17:	52                   	push   %edx
+      18:	52                   	push   %edx
+      19:	68 08 1d 00 00       	push   $0x1d08
+      1e:	6a 02                	push   $0x2
+      20:	e8 5b 08 00 00       	call   880 <printf>
+    exit();
+      25:	e8 96 00 00 00       	call   c0 <exit>
+  }
+  if(link(argv[1], argv[2]) < 0)
+      2a:	50                   	push   %eax
+      2b:	50                   	push   %eax
+      2c:	ff 73 08             	push   0x8(%ebx)
+      2f:	ff 73 04             	push   0x4(%ebx)
+      32:	e8 82 04 00 00       	call   4b9 <link>
+      37:	83 c4 10             	add    $0x10,%esp
+      3a:	85 c0                	test   %eax,%eax
+      3c:	78 05                	js     43 <main+0x43>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  exit();
+      3e:	e8 7d 00 00 00       	call   c0 <exit>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+      43:	ff 73 08             	push   0x8(%ebx)
+      46:	ff 73 04             	push   0x4(%ebx)
+      49:	68 1b 1d 00 00       	push   $0x1d1b
+      4e:	6a 02                	push   $0x2
+      50:	e8 2b 08 00 00       	call   880 <printf>
+      55:	83 c4 10             	add    $0x10,%esp
+      58:	eb e4                	jmp    3e <main+0x3e>
+      5a:	66 90                	xchg   %ax,%ax
+      5c:	66 90                	xchg   %ax,%ax
+      5e:	66 90                	xchg   %ax,%ax
+
+00000060 <fork>:
+int sysexit(void) __attribute__((noreturn));
+
+int
+fork(void)
+{
+  if(flushhook)
+      60:	a1 e0 27 00 00       	mov    0x27e0,%eax
+      65:	85 c0                	test   %eax,%eax
+      67:	74 17                	je     80 <fork+0x20>
+{
+      69:	55                   	push   %ebp
+      6a:	89 e5                	mov    %esp,%ebp
+      6c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+      6f:	ff d0                	call   *%eax
+  return sysfork();
+}
+      71:	c9                   	leave
+  return sysfork();
+      72:	e9 7f 03 00 00       	jmp    3f6 <sysfork>
+      77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      7e:	66 90                	xchg   %ax,%ax
+      80:	e9 71 03 00 00       	jmp    3f6 <sysfork>
+      85:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000090 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+      90:	55                   	push   %ebp
+  if(flushhook)
+      91:	a1 e0 27 00 00       	mov    0x27e0,%eax
+{
+      96:	89 e5                	mov    %esp,%ebp
+      98:	56                   	push   %esi
+      99:	53                   	push   %ebx
+      9a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+      9d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+      a0:	85 c0                	test   %eax,%eax
+      a2:	74 02                	je     a6 <exec+0x16>
+    flushhook();
+      a4:	ff d0                	call   *%eax
+  return sysexec(path, argv);
+      a6:	89 75 0c             	mov    %esi,0xc(%ebp)
+      a9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+      ac:	5b                   	pop    %ebx
+      ad:	5e                   	pop    %esi
+      ae:	5d                   	pop    %ebp
+  return sysexec(path, argv);
+      af:	e9 ba 03 00 00       	jmp    46e <sysexec>
+      b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      bf:	90                   	nop
+
+000000c0 <exit>:
+
+int
+exit(void)
+{
+      c0:	55                   	push   %ebp
+      c1:	89 e5                	mov    %esp,%ebp
+      c3:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+      c6:	a1 e0 27 00 00       	mov    0x27e0,%eax
+      cb:	85 c0                	test   %eax,%eax
+      cd:	74 02                	je     d1 <exit+0x11>
+    flushhook();
+      cf:	ff d0                	call   *%eax
+  sysexit();
+      d1:	e8 2f 03 00 00       	call   405 <sysexit>
+      d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000e0 <strcpy>:
+}
+
+char*
+strcpy(char *s, const char *t)
+{
+      e0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+      e1:	31 c0                	xor    %eax,%eax
+{
+      e3:	89 e5                	mov    %esp,%ebp
+      e5:	53                   	push   %ebx
+      e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+      ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+      f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+      f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+      f7:	83 c0 01             	add    $0x1,%eax
+      fa:	84 d2                	test   %dl,%dl
+      fc:	75 f2                	jne    f0 <strcpy+0x10>
+    ;
+  return os;
+}
+      fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     101:	89 c8                	mov    %ecx,%eax
+     103:	c9                   	leave
+     104:	c3                   	ret
+     105:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     10c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000110 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     110:	55                   	push   %ebp
+     111:	89 e5                	mov    %esp,%ebp
+     113:	53                   	push   %ebx
+     114:	8b 55 08             	mov    0x8(%ebp),%edx
+     117:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     11a:	0f b6 02             	movzbl (%edx),%eax
+     11d:	84 c0                	test   %al,%al
+     11f:	75 17                	jne    138 <strcmp+0x28>
+     121:	eb 3a                	jmp    15d <strcmp+0x4d>
+     123:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     127:	90                   	nop
+     128:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     12c:	83 c2 01             	add    $0x1,%edx
+     12f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     132:	84 c0                	test   %al,%al
+     134:	74 1a                	je     150 <strcmp+0x40>
+    p++, q++;
+     136:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     138:	0f b6 19             	movzbl (%ecx),%ebx
+     13b:	38 c3                	cmp    %al,%bl
+     13d:	74 e9                	je     128 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     13f:	29 d8                	sub    %ebx,%eax
+}
+     141:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     144:	c9                   	leave
+     145:	c3                   	ret
+     146:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     14d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     150:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     154:	31 c0                	xor    %eax,%eax
+     156:	29 d8                	sub    %ebx,%eax
+}
+     158:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     15b:	c9                   	leave
+     15c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     15d:	0f b6 19             	movzbl (%ecx),%ebx
+     160:	31 c0                	xor    %eax,%eax
+     162:	eb db                	jmp    13f <strcmp+0x2f>
+     164:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     16b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     16f:	90                   	nop
+
+00000170 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     170:	55                   	push   %ebp
+     171:	89 e5                	mov    %esp,%ebp
+     173:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     176:	80 3a 00             	cmpb   $0x0,(%edx)
+     179:	74 15                	je     190 <strlen+0x20>
+     17b:	31 c0                	xor    %eax,%eax
+     17d:	8d 76 00             	lea    0x0(%esi),%esi
+     180:	83 c0 01             	add    $0x1,%eax
+     183:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     187:	89 c1                	mov    %eax,%ecx
+     189:	75 f5                	jne    180 <strlen+0x10>
+    ;
+  return n;
+}
+     18b:	89 c8                	mov    %ecx,%eax
+     18d:	5d                   	pop    %ebp
+     18e:	c3                   	ret
+     18f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     190:	31 c9                	xor    %ecx,%ecx
+}
+     192:	5d                   	pop    %ebp
+     193:	89 c8                	mov    %ecx,%eax
+     195:	c3                   	ret
+     196:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     19d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001a0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     1a0:	55                   	push   %ebp
+     1a1:	89 e5                	mov    %esp,%ebp
+     1a3:	57                   	push   %edi
+     1a4:	8b 55 08             	mov    0x8(%ebp),%edx
+            "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt) {
+    asm volatile("cld; rep stosb" :
+     1a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     1aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+     1ad:	89 d7                	mov    %edx,%edi
+     1af:	fc                   	cld
+     1b0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     1b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     1b5:	89 d0                	mov    %edx,%eax
+     1b7:	c9                   	leave
+     1b8:	c3                   	ret
+     1b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001c0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     1c0:	55                   	push   %ebp
+     1c1:	89 e5                	mov    %esp,%ebp
+     1c3:	8b 45 08             	mov    0x8(%ebp),%eax
+     1c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     1ca:	0f b6 10             	movzbl (%eax),%edx
+     1cd:	84 d2                	test   %dl,%dl
+     1cf:	75 12                	jne    1e3 <strchr+0x23>
+     1d1:	eb 1d                	jmp    1f0 <strchr+0x30>
+     1d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1d7:	90                   	nop
+     1d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     1dc:	83 c0 01             	add    $0x1,%eax
+     1df:	84 d2                	test   %dl,%dl
+     1e1:	74 0d                	je     1f0 <strchr+0x30>
+    if(*s == c)
+     1e3:	38 d1                	cmp    %dl,%cl
+     1e5:	75 f1                	jne    1d8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     1e7:	5d                   	pop    %ebp
+     1e8:	c3                   	ret
+     1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     1f0:	31 c0                	xor    %eax,%eax
+}
+     1f2:	5d                   	pop    %ebp
+     1f3:	c3                   	ret
+     1f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1ff:	90                   	nop
+
+00000200 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     200:	55                   	push   %ebp
+     201:	89 e5                	mov    %esp,%ebp
+     203:	56                   	push   %esi
+     204:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     205:	83 ec 08             	sub    $0x8,%esp
+     208:	6a 00                	push   $0x0
+     20a:	ff 75 08             	push   0x8(%ebp)
+     20d:	e8 6b 02 00 00       	call   47d <open>
+  if(fd < 0)
+     212:	83 c4 10             	add    $0x10,%esp
+     215:	85 c0                	test   %eax,%eax
+     217:	78 27                	js     240 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     219:	83 ec 08             	sub    $0x8,%esp
+     21c:	ff 75 0c             	push   0xc(%ebp)
+     21f:	89 c3                	mov    %eax,%ebx
+     221:	50                   	push   %eax
+     222:	e8 83 02 00 00       	call   4aa <fstat>
+  close(fd);
+     227:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     22a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     22c:	e8 1f 02 00 00       	call   450 <close>
+  return r;
+     231:	83 c4 10             	add    $0x10,%esp
+}
+     234:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     237:	89 f0                	mov    %esi,%eax
+     239:	5b                   	pop    %ebx
+     23a:	5e                   	pop    %esi
+     23b:	5d                   	pop    %ebp
+     23c:	c3                   	ret
+     23d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     240:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     245:	eb ed                	jmp    234 <stat+0x34>
+     247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     24e:	66 90                	xchg   %ax,%ax
+
+00000250 <atoi>:
+
+int
+atoi(const char *s)
+{
+     250:	55                   	push   %ebp
+     251:	89 e5                	mov    %esp,%ebp
+     253:	53                   	push   %ebx
+     254:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     257:	0f be 02             	movsbl (%edx),%eax
+     25a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     25d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     260:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     265:	77 1e                	ja     285 <atoi+0x35>
+     267:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     26e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     270:	83 c2 01             	add    $0x1,%edx
+     273:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     276:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     27a:	0f be 02             	movsbl (%edx),%eax
+     27d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     280:	80 fb 09             	cmp    $0x9,%bl
+     283:	76 eb                	jbe    270 <atoi+0x20>
+  return n;
+}
+     285:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     288:	89 c8                	mov    %ecx,%eax
+     28a:	c9                   	leave
+     28b:	c3                   	ret
+     28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     290:	55                   	push   %ebp
+     291:	89 e5                	mov    %esp,%ebp
+     293:	57                   	push   %edi
+     294:	56                   	push   %esi
+     295:	8b 45 10             	mov    0x10(%ebp),%eax
+     298:	8b 55 08             	mov    0x8(%ebp),%edx
+     29b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     29e:	85 c0                	test   %eax,%eax
+     2a0:	7e 13                	jle    2b5 <memmove+0x25>
+     2a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     2a4:	89 d7                	mov    %edx,%edi
+     2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     2b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     2b1:	39 f8                	cmp    %edi,%eax
+     2b3:	75 fb                	jne    2b0 <memmove+0x20>
+  return vdst;
+}
+     2b5:	5e                   	pop    %esi
+     2b6:	89 d0                	mov    %edx,%eax
+     2b8:	5f                   	pop    %edi
+     2b9:	5d                   	pop    %ebp
+     2ba:	c3                   	ret
+     2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2bf:	90                   	nop
+
+000002c0 <mutex_init>:
+
+// Futex-based mutex (Drepper, "Futexes Are Tricky", mutex 2).
+// The uncontended paths never enter the kernel.
+void
+mutex_init(struct mutex *m)
+{
+     2c0:	55                   	push   %ebp
+     2c1:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+     2c3:	8b 45 08             	mov    0x8(%ebp),%eax
+     2c6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     2cc:	5d                   	pop    %ebp
+     2cd:	c3                   	ret
+     2ce:	66 90                	xchg   %ax,%ax
+
+000002d0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     2d0:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     2d1:	31 c0                	xor    %eax,%eax
+     2d3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+     2d8:	89 e5                	mov    %esp,%ebp
+     2da:	56                   	push   %esi
+     2db:	53                   	push   %ebx
+     2dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     2df:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     2e3:	85 c0                	test   %eax,%eax
+     2e5:	74 32                	je     319 <mutex_lock+0x49>
+    return;
+  if(c != 2)
+     2e7:	83 f8 02             	cmp    $0x2,%eax
+     2ea:	74 0c                	je     2f8 <mutex_lock+0x28>
+static inline uint
+xchg(volatile uint *addr, uint newval) {
+    uint result;
+
+    // The + in "+m" denotes a read-modify-write operand.
+    asm volatile("lock; xchgl %0, %1" :
+     2ec:	b8 02 00 00 00       	mov    $0x2,%eax
+     2f1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+     2f4:	85 c0                	test   %eax,%eax
+     2f6:	74 21                	je     319 <mutex_lock+0x49>
+     2f8:	be 02 00 00 00       	mov    $0x2,%esi
+     2fd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAIT, 2);
+     300:	83 ec 04             	sub    $0x4,%esp
+     303:	6a 02                	push   $0x2
+     305:	6a 00                	push   $0x0
+     307:	53                   	push   %ebx
+     308:	e8 33 02 00 00       	call   540 <futex>
+     30d:	89 f0                	mov    %esi,%eax
+     30f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     312:	83 c4 10             	add    $0x10,%esp
+     315:	85 c0                	test   %eax,%eax
+     317:	75 e7                	jne    300 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+     319:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     31c:	5b                   	pop    %ebx
+     31d:	5e                   	pop    %esi
+     31e:	5d                   	pop    %ebp
+     31f:	c3                   	ret
+
+00000320 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     320:	55                   	push   %ebp
+     321:	89 e5                	mov    %esp,%ebp
+     323:	83 ec 08             	sub    $0x8,%esp
+     326:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     329:	f0 83 28 01          	lock subl $0x1,(%eax)
+     32d:	75 09                	jne    338 <mutex_unlock+0x18>
+    m->val = 0;
+    futex(&m->val, FUTEX_WAKE, 1);
+  }
+}
+     32f:	c9                   	leave
+     330:	c3                   	ret
+     331:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     338:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     33b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex(&m->val, FUTEX_WAKE, 1);
+     341:	6a 01                	push   $0x1
+     343:	6a 01                	push   $0x1
+     345:	50                   	push   %eax
+     346:	e8 f5 01 00 00       	call   540 <futex>
+     34b:	83 c4 10             	add    $0x10,%esp
+}
+     34e:	c9                   	leave
+     34f:	c3                   	ret
+
+00000350 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     350:	55                   	push   %ebp
+     351:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     353:	8b 45 08             	mov    0x8(%ebp),%eax
+     356:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     35c:	5d                   	pop    %ebp
+     35d:	c3                   	ret
+     35e:	66 90                	xchg   %ax,%ax
+
+00000360 <cond_wait>:
+
+// Release m and wait for a signal, then reacquire m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     360:	55                   	push   %ebp
+     361:	89 e5                	mov    %esp,%ebp
+     363:	57                   	push   %edi
+     364:	56                   	push   %esi
+     365:	53                   	push   %ebx
+     366:	83 ec 0c             	sub    $0xc,%esp
+     369:	8b 75 08             	mov    0x8(%ebp),%esi
+     36c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     36f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     371:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+     375:	75 21                	jne    398 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     377:	83 ec 04             	sub    $0x4,%esp
+     37a:	57                   	push   %edi
+     37b:	6a 00                	push   $0x0
+     37d:	56                   	push   %esi
+     37e:	e8 bd 01 00 00       	call   540 <futex>
+  mutex_lock(m);
+     383:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     386:	83 c4 10             	add    $0x10,%esp
+}
+     389:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     38c:	5b                   	pop    %ebx
+     38d:	5e                   	pop    %esi
+     38e:	5f                   	pop    %edi
+     38f:	5d                   	pop    %ebp
+  mutex_lock(m);
+     390:	e9 3b ff ff ff       	jmp    2d0 <mutex_lock>
+     395:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     398:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     39b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex(&m->val, FUTEX_WAKE, 1);
+     3a1:	6a 01                	push   $0x1
+     3a3:	6a 01                	push   $0x1
+     3a5:	53                   	push   %ebx
+     3a6:	e8 95 01 00 00       	call   540 <futex>
+     3ab:	83 c4 10             	add    $0x10,%esp
+     3ae:	eb c7                	jmp    377 <cond_wait+0x17>
+
+000003b0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+     3b0:	55                   	push   %ebp
+     3b1:	89 e5                	mov    %esp,%ebp
+     3b3:	83 ec 0c             	sub    $0xc,%esp
+     3b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     3b9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+     3bd:	6a 01                	push   $0x1
+     3bf:	6a 01                	push   $0x1
+     3c1:	50                   	push   %eax
+     3c2:	e8 79 01 00 00       	call   540 <futex>
+}
+     3c7:	83 c4 10             	add    $0x10,%esp
+     3ca:	c9                   	leave
+     3cb:	c3                   	ret
+     3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     3d0:	55                   	push   %ebp
+     3d1:	89 e5                	mov    %esp,%ebp
+     3d3:	83 ec 0c             	sub    $0xc,%esp
+     3d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     3d9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+     3dd:	6a 40                	push   $0x40
+     3df:	6a 01                	push   $0x1
+     3e1:	50                   	push   %eax
+     3e2:	e8 59 01 00 00       	call   540 <futex>
+}
+     3e7:	83 c4 10             	add    $0x10,%esp
+     3ea:	c9                   	leave
+     3eb:	c3                   	ret
+     3ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003f0 <uptime>:
+// Clock ticks since boot, read from the kernel's vdso page
+// without a system call.
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     3f0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+     3f5:	c3                   	ret
+
+000003f6 <sysfork>:
+  1: ret
+
+#define SYSCALL(name) SYSCALLAS(name, name)
+
+// ulib.c wraps these.
+SYSCALLAS(sysfork, fork)
+     3f6:	b8 01 00 00 00       	mov    $0x1,%eax
+     3fb:	89 e1                	mov    %esp,%ecx
+     3fd:	ba 04 04 00 00       	mov    $0x404,%edx
+     402:	0f 34                	sysenter
+     404:	c3                   	ret
+
+00000405 <sysexit>:
+SYSCALLAS(sysexit, exit)
+     405:	b8 02 00 00 00       	mov    $0x2,%eax
+     40a:	89 e1                	mov    %esp,%ecx
+     40c:	ba 13 04 00 00       	mov    $0x413,%edx
+     411:	0f 34                	sysenter
+     413:	c3                   	ret
+
+00000414 <wait>:
+SYSCALL(wait)
+     414:	b8 03 00 00 00       	mov    $0x3,%eax
+     419:	89 e1                	mov    %esp,%ecx
+     41b:	ba 22 04 00 00       	mov    $0x422,%edx
+     420:	0f 34                	sysenter
+     422:	c3                   	ret
+
+00000423 <pipe>:
+SYSCALL(pipe)
+     423:	b8 04 00 00 00       	mov    $0x4,%eax
+     428:	89 e1                	mov    %esp,%ecx
+     42a:	ba 31 04 00 00       	mov    $0x431,%edx
+     42f:	0f 34                	sysenter
+     431:	c3                   	ret
+
+00000432 <read>:
+SYSCALL(read)
+     432:	b8 05 00 00 00       	mov    $0x5,%eax
+     437:	89 e1                	mov    %esp,%ecx
+     439:	ba 40 04 00 00       	mov    $0x440,%edx
+     43e:	0f 34                	sysenter
+     440:	c3                   	ret
+
+00000441 <write>:
+SYSCALL(write)
+     441:	b8 10 00 00 00       	mov    $0x10,%eax
+     446:	89 e1                	mov    %esp,%ecx
+     448:	ba 4f 04 00 00       	mov    $0x44f,%edx
+     44d:	0f 34                	sysenter
+     44f:	c3                   	ret
+
+00000450 <close>:
+SYSCALL(close)
+     450:	b8 15 00 00 00       	mov    $0x15,%eax
+     455:	89 e1                	mov    %esp,%ecx
+     457:	ba 5e 04 00 00       	mov    $0x45e,%edx
+     45c:	0f 34                	sysenter
+     45e:	c3                   	ret
+
+0000045f <kill>:
+SYSCALL(kill)
+     45f:	b8 06 00 00 00       	mov    $0x6,%eax
+     464:	89 e1                	mov    %esp,%ecx
+     466:	ba 6d 04 00 00       	mov    $0x46d,%edx
+     46b:	0f 34                	sysenter
+     46d:	c3                   	ret
+
+0000046e <sysexec>:
+SYSCALLAS(sysexec, exec)
+     46e:	b8 07 00 00 00       	mov    $0x7,%eax
+     473:	89 e1                	mov    %esp,%ecx
+     475:	ba 7c 04 00 00       	mov    $0x47c,%edx
+     47a:	0f 34                	sysenter
+     47c:	c3                   	ret
+
+0000047d <open>:
+SYSCALL(open)
+     47d:	b8 0f 00 00 00       	mov    $0xf,%eax
+     482:	89 e1                	mov    %esp,%ecx
+     484:	ba 8b 04 00 00       	mov    $0x48b,%edx
+     489:	0f 34                	sysenter
+     48b:	c3                   	ret
+
+0000048c <mknod>:
+SYSCALL(mknod)
+     48c:	b8 11 00 00 00       	mov    $0x11,%eax
+     491:	89 e1                	mov    %esp,%ecx
+     493:	ba 9a 04 00 00       	mov    $0x49a,%edx
+     498:	0f 34                	sysenter
+     49a:	c3                   	ret
+
+0000049b <unlink>:
+SYSCALL(unlink)
+     49b:	b8 12 00 00 00       	mov    $0x12,%eax
+     4a0:	89 e1                	mov    %esp,%ecx
+     4a2:	ba a9 04 00 00       	mov    $0x4a9,%edx
+     4a7:	0f 34                	sysenter
+     4a9:	c3                   	ret
+
+000004aa <fstat>:
+SYSCALL(fstat)
+     4aa:	b8 08 00 00 00       	mov    $0x8,%eax
+     4af:	89 e1                	mov    %esp,%ecx
+     4b1:	ba b8 04 00 00       	mov    $0x4b8,%edx
+     4b6:	0f 34                	sysenter
+     4b8:	c3                   	ret
+
+000004b9 <link>:
+SYSCALL(link)
+     4b9:	b8 13 00 00 00       	mov    $0x13,%eax
+     4be:	89 e1                	mov    %esp,%ecx
+     4c0:	ba c7 04 00 00       	mov    $0x4c7,%edx
+     4c5:	0f 34                	sysenter
+     4c7:	c3                   	ret
+
+000004c8 <mkdir>:
+SYSCALL(mkdir)
+     4c8:	b8 14 00 00 00       	mov    $0x14,%eax
+     4cd:	89 e1                	mov    %esp,%ecx
+     4cf:	ba d6 04 00 00       	mov    $0x4d6,%edx
+     4d4:	0f 34                	sysenter
+     4d6:	c3                   	ret
+
+000004d7 <chdir>:
+SYSCALL(chdir)
+     4d7:	b8 09 00 00 00       	mov    $0x9,%eax
+     4dc:	89 e1                	mov    %esp,%ecx
+     4de:	ba e5 04 00 00       	mov    $0x4e5,%edx
+     4e3:	0f 34                	sysenter
+     4e5:	c3                   	ret
+
+000004e6 <dup>:
+SYSCALL(dup)
+     4e6:	b8 0a 00 00 00       	mov    $0xa,%eax
+     4eb:	89 e1                	mov    %esp,%ecx
+     4ed:	ba f4 04 00 00       	mov    $0x4f4,%edx
+     4f2:	0f 34                	sysenter
+     4f4:	c3                   	ret
+
+000004f5 <getpid>:
+SYSCALL(getpid)
+     4f5:	b8 0b 00 00 00       	mov    $0xb,%eax
+     4fa:	89 e1                	mov    %esp,%ecx
+     4fc:	ba 03 05 00 00       	mov    $0x503,%edx
+     501:	0f 34                	sysenter
+     503:	c3                   	ret
+
+00000504 <sbrk>:
+SYSCALL(sbrk)
+     504:	b8 0c 00 00 00       	mov    $0xc,%eax
+     509:	89 e1                	mov    %esp,%ecx
+     50b:	ba 12 05 00 00       	mov    $0x512,%edx
+     510:	0f 34                	sysenter
+     512:	c3                   	ret
+
+00000513 <sleep>:
+SYSCALL(sleep)
+     513:	b8 0d 00 00 00       	mov    $0xd,%eax
+     518:	89 e1                	mov    %esp,%ecx
+     51a:	ba 21 05 00 00       	mov    $0x521,%edx
+     51f:	0f 34                	sysenter
+     521:	c3                   	ret
+
+00000522 <clone>:
+SYSCALL(clone)
+     522:	b8 16 00 00 00       	mov    $0x16,%eax
+     527:	89 e1                	mov    %esp,%ecx
+     529:	ba 30 05 00 00       	mov    $0x530,%edx
+     52e:	0f 34                	sysenter
+     530:	c3                   	ret
+
+00000531 <join>:
+SYSCALL(join)
+     531:	b8 17 00 00 00       	mov    $0x17,%eax
+     536:	89 e1                	mov    %esp,%ecx
+     538:	ba 3f 05 00 00       	mov    $0x53f,%edx
+     53d:	0f 34                	sysenter
+     53f:	c3                   	ret
+
+00000540 <futex>:
+SYSCALL(futex)
+     540:	b8 18 00 00 00       	mov    $0x18,%eax
+     545:	89 e1                	mov    %esp,%ecx
+     547:	ba 4e 05 00 00       	mov    $0x54e,%edx
+     54c:	0f 34                	sysenter
+     54e:	c3                   	ret
+
+0000054f <yield>:
+SYSCALL(yield)
+     54f:	b8 19 00 00 00       	mov    $0x19,%eax
+     554:	89 e1                	mov    %esp,%ecx
+     556:	ba 5d 05 00 00       	mov    $0x55d,%edx
+     55b:	0f 34                	sysenter
+     55d:	c3                   	ret
+
+0000055e <lockstat>:
+SYSCALL(lockstat)
+     55e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     563:	89 e1                	mov    %esp,%ecx
+     565:	ba 6c 05 00 00       	mov    $0x56c,%edx
+     56a:	0f 34                	sysenter
+     56c:	c3                   	ret
+
+0000056d <lockhammer>:
+SYSCALL(lockhammer)
+     56d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     572:	89 e1                	mov    %esp,%ecx
+     574:	ba 7b 05 00 00       	mov    $0x57b,%edx
+     579:	0f 34                	sysenter
+     57b:	c3                   	ret
+
+0000057c <vmsplice>:
+SYSCALL(vmsplice)
+     57c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     581:	89 e1                	mov    %esp,%ecx
+     583:	ba 8a 05 00 00       	mov    $0x58a,%edx
+     588:	0f 34                	sysenter
+     58a:	c3                   	ret
+
+0000058b <hsbrk>:
+SYSCALL(hsbrk)
+     58b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     590:	89 e1                	mov    %esp,%ecx
+     592:	ba 99 05 00 00       	mov    $0x599,%edx
+     597:	0f 34                	sysenter
+     599:	c3                   	ret
+
+0000059a <mmap>:
+SYSCALL(mmap)
+     59a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     59f:	89 e1                	mov    %esp,%ecx
+     5a1:	ba a8 05 00 00       	mov    $0x5a8,%edx
+     5a6:	0f 34                	sysenter
+     5a8:	c3                   	ret
+
+000005a9 <munmap>:
+SYSCALL(munmap)
+     5a9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     5ae:	89 e1                	mov    %esp,%ecx
+     5b0:	ba b7 05 00 00       	mov    $0x5b7,%edx
+     5b5:	0f 34                	sysenter
+     5b7:	c3                   	ret
+
+000005b8 <ringenter>:
+SYSCALL(ringenter)
+     5b8:	b8 20 00 00 00       	mov    $0x20,%eax
+     5bd:	89 e1                	mov    %esp,%ecx
+     5bf:	ba c6 05 00 00       	mov    $0x5c6,%edx
+     5c4:	0f 34                	sysenter
+     5c6:	c3                   	ret
+
+000005c7 <readv>:
+SYSCALL(readv)
+     5c7:	b8 21 00 00 00       	mov    $0x21,%eax
+     5cc:	89 e1                	mov    %esp,%ecx
+     5ce:	ba d5 05 00 00       	mov    $0x5d5,%edx
+     5d3:	0f 34                	sysenter
+     5d5:	c3                   	ret
+
+000005d6 <writev>:
+SYSCALL(writev)
+     5d6:	b8 22 00 00 00       	mov    $0x22,%eax
+     5db:	89 e1                	mov    %esp,%ecx
+     5dd:	ba e4 05 00 00       	mov    $0x5e4,%edx
+     5e2:	0f 34                	sysenter
+     5e4:	c3                   	ret
+
+000005e5 <pread>:
+SYSCALL(pread)
+     5e5:	b8 23 00 00 00       	mov    $0x23,%eax
+     5ea:	89 e1                	mov    %esp,%ecx
+     5ec:	ba f3 05 00 00       	mov    $0x5f3,%edx
+     5f1:	0f 34                	sysenter
+     5f3:	c3                   	ret
+
+000005f4 <pwrite>:
+SYSCALL(pwrite)
+     5f4:	b8 24 00 00 00       	mov    $0x24,%eax
+     5f9:	89 e1                	mov    %esp,%ecx
+     5fb:	ba 02 06 00 00       	mov    $0x602,%edx
+     600:	0f 34                	sysenter
+     602:	c3                   	ret
+
+00000603 <prof>:
+SYSCALL(prof)
+     603:	b8 25 00 00 00       	mov    $0x25,%eax
+     608:	89 e1                	mov    %esp,%ecx
+     60a:	ba 11 06 00 00       	mov    $0x611,%edx
+     60f:	0f 34                	sysenter
+     611:	c3                   	ret
+
+00000612 <scstat>:
+SYSCALL(scstat)
+     612:	b8 26 00 00 00       	mov    $0x26,%eax
+     617:	89 e1                	mov    %esp,%ecx
+     619:	ba 20 06 00 00       	mov    $0x620,%edx
+     61e:	0f 34                	sysenter
+     620:	c3                   	ret
+     621:	66 90                	xchg   %ax,%ax
+     623:	66 90                	xchg   %ax,%ax
+     625:	66 90                	xchg   %ax,%ax
+     627:	66 90                	xchg   %ax,%ax
+     629:	66 90                	xchg   %ax,%ax
+     62b:	66 90                	xchg   %ax,%ax
+     62d:	66 90                	xchg   %ax,%ax
+     62f:	90                   	nop
+
+00000630 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+     630:	55                   	push   %ebp
+     631:	89 e5                	mov    %esp,%ebp
+     633:	57                   	push   %edi
+     634:	56                   	push   %esi
+     635:	53                   	push   %ebx
+     636:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     638:	89 d1                	mov    %edx,%ecx
+{
+     63a:	83 ec 2c             	sub    $0x2c,%esp
+     63d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+     640:	85 d2                	test   %edx,%edx
+     642:	79 7c                	jns    6c0 <printint+0x90>
+     644:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     648:	74 76                	je     6c0 <printint+0x90>
+    x = -xx;
+     64a:	f7 d9                	neg    %ecx
+    neg = 1;
+     64c:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     651:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     654:	31 f6                	xor    %esi,%esi
+     656:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     65d:	8d 76 00             	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     660:	89 c8                	mov    %ecx,%eax
+     662:	31 d2                	xor    %edx,%edx
+     664:	89 f7                	mov    %esi,%edi
+     666:	f7 f3                	div    %ebx
+     668:	8d 76 01             	lea    0x1(%esi),%esi
+     66b:	0f b6 92 90 1d 00 00 	movzbl 0x1d90(%edx),%edx
+     672:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     676:	89 ca                	mov    %ecx,%edx
+     678:	89 c1                	mov    %eax,%ecx
+     67a:	39 da                	cmp    %ebx,%edx
+     67c:	73 e2                	jae    660 <printint+0x30>
+  if(neg)
+     67e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     681:	85 c0                	test   %eax,%eax
+     683:	74 07                	je     68c <printint+0x5c>
+    buf[i++] = '-';
+     685:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     68a:	89 f7                	mov    %esi,%edi
+     68c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     68f:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     692:	01 df                	add    %ebx,%edi
+     694:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc_unlocked(buf[i], f);
+     698:	83 ec 08             	sub    $0x8,%esp
+     69b:	56                   	push   %esi
+     69c:	0f be 07             	movsbl (%edi),%eax
+     69f:	50                   	push   %eax
+     6a0:	e8 cb 07 00 00       	call   e70 <putc_unlocked>
+  while(--i >= 0)
+     6a5:	89 f8                	mov    %edi,%eax
+     6a7:	83 c4 10             	add    $0x10,%esp
+     6aa:	83 ef 01             	sub    $0x1,%edi
+     6ad:	39 d8                	cmp    %ebx,%eax
+     6af:	75 e7                	jne    698 <printint+0x68>
+}
+     6b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6b4:	5b                   	pop    %ebx
+     6b5:	5e                   	pop    %esi
+     6b6:	5f                   	pop    %edi
+     6b7:	5d                   	pop    %ebp
+     6b8:	c3                   	ret
+     6b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     6c0:	31 c0                	xor    %eax,%eax
+     6c2:	eb 8d                	jmp    651 <printint+0x21>
+     6c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6cf:	90                   	nop
+
+000006d0 <vfprintf>:
+
+// Print to the given stream, which the caller has locked.
+// Only understands %d, %x, %p, %s.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+     6d0:	55                   	push   %ebp
+     6d1:	89 e5                	mov    %esp,%ebp
+     6d3:	57                   	push   %edi
+     6d4:	56                   	push   %esi
+     6d5:	53                   	push   %ebx
+     6d6:	83 ec 1c             	sub    $0x1c,%esp
+     6d9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     6dc:	0f b6 0a             	movzbl (%edx),%ecx
+     6df:	84 c9                	test   %cl,%cl
+     6e1:	74 5c                	je     73f <vfprintf+0x6f>
+     6e3:	89 c6                	mov    %eax,%esi
+     6e5:	8d 5a 01             	lea    0x1(%edx),%ebx
+     6e8:	31 ff                	xor    %edi,%edi
+     6ea:	eb 20                	jmp    70c <vfprintf+0x3c>
+     6ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     6f0:	83 f9 25             	cmp    $0x25,%ecx
+     6f3:	74 3b                	je     730 <vfprintf+0x60>
+        state = '%';
+      } else {
+        putc_unlocked(c, f);
+     6f5:	83 ec 08             	sub    $0x8,%esp
+     6f8:	56                   	push   %esi
+     6f9:	51                   	push   %ecx
+     6fa:	e8 71 07 00 00       	call   e70 <putc_unlocked>
+     6ff:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     702:	0f b6 0b             	movzbl (%ebx),%ecx
+     705:	83 c3 01             	add    $0x1,%ebx
+     708:	84 c9                	test   %cl,%cl
+     70a:	74 33                	je     73f <vfprintf+0x6f>
+    if(state == 0){
+     70c:	85 ff                	test   %edi,%edi
+     70e:	74 e0                	je     6f0 <vfprintf+0x20>
+      }
+    } else if(state == '%'){
+     710:	83 ff 25             	cmp    $0x25,%edi
+     713:	75 ed                	jne    702 <vfprintf+0x32>
+      if(c == 'd'){
+     715:	83 f9 25             	cmp    $0x25,%ecx
+     718:	0f 84 02 01 00 00    	je     820 <vfprintf+0x150>
+     71e:	8d 41 9d             	lea    -0x63(%ecx),%eax
+     721:	83 f8 15             	cmp    $0x15,%eax
+     724:	77 2a                	ja     750 <vfprintf+0x80>
+     726:	ff 24 85 38 1d 00 00 	jmp    *0x1d38(,%eax,4)
+     72d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     730:	0f b6 0b             	movzbl (%ebx),%ecx
+     733:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     736:	bf 25 00 00 00       	mov    $0x25,%edi
+  for(i = 0; fmt[i]; i++){
+     73b:	84 c9                	test   %cl,%cl
+     73d:	75 cd                	jne    70c <vfprintf+0x3c>
+        putc_unlocked(c, f);
+      }
+      state = 0;
+    }
+  }
+}
+     73f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     742:	5b                   	pop    %ebx
+     743:	5e                   	pop    %esi
+     744:	5f                   	pop    %edi
+     745:	5d                   	pop    %ebp
+     746:	c3                   	ret
+     747:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     74e:	66 90                	xchg   %ax,%ax
+        putc_unlocked('%', f);
+     750:	83 ec 08             	sub    $0x8,%esp
+     753:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     756:	56                   	push   %esi
+     757:	6a 25                	push   $0x25
+     759:	e8 12 07 00 00       	call   e70 <putc_unlocked>
+        putc_unlocked(c, f);
+     75e:	58                   	pop    %eax
+     75f:	5a                   	pop    %edx
+     760:	56                   	push   %esi
+     761:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     764:	51                   	push   %ecx
+     765:	e8 06 07 00 00       	call   e70 <putc_unlocked>
+     76a:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     76d:	31 ff                	xor    %edi,%edi
+     76f:	eb 91                	jmp    702 <vfprintf+0x32>
+     771:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+     778:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     77b:	83 ec 0c             	sub    $0xc,%esp
+     77e:	b9 10 00 00 00       	mov    $0x10,%ecx
+     783:	8b 17                	mov    (%edi),%edx
+     785:	6a 00                	push   $0x0
+        ap++;
+     787:	83 c7 04             	add    $0x4,%edi
+        printint(f, *ap, 16, 0);
+     78a:	89 f0                	mov    %esi,%eax
+     78c:	e8 9f fe ff ff       	call   630 <printint>
+        ap++;
+     791:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     794:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     797:	31 ff                	xor    %edi,%edi
+     799:	e9 64 ff ff ff       	jmp    702 <vfprintf+0x32>
+     79e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     7a0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     7a3:	8b 10                	mov    (%eax),%edx
+        ap++;
+     7a5:	83 c0 04             	add    $0x4,%eax
+     7a8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     7ab:	85 d2                	test   %edx,%edx
+     7ad:	0f 84 85 00 00 00    	je     838 <vfprintf+0x168>
+        while(*s != 0){
+     7b3:	0f be 02             	movsbl (%edx),%eax
+        s = (char*)*ap;
+     7b6:	89 d7                	mov    %edx,%edi
+        while(*s != 0){
+     7b8:	84 c0                	test   %al,%al
+     7ba:	74 b1                	je     76d <vfprintf+0x9d>
+     7bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+          putc_unlocked(*s, f);
+     7c0:	83 ec 08             	sub    $0x8,%esp
+          s++;
+     7c3:	83 c7 01             	add    $0x1,%edi
+          putc_unlocked(*s, f);
+     7c6:	56                   	push   %esi
+     7c7:	50                   	push   %eax
+     7c8:	e8 a3 06 00 00       	call   e70 <putc_unlocked>
+        while(*s != 0){
+     7cd:	0f be 07             	movsbl (%edi),%eax
+     7d0:	83 c4 10             	add    $0x10,%esp
+     7d3:	84 c0                	test   %al,%al
+     7d5:	75 e9                	jne    7c0 <vfprintf+0xf0>
+      state = 0;
+     7d7:	31 ff                	xor    %edi,%edi
+     7d9:	e9 24 ff ff ff       	jmp    702 <vfprintf+0x32>
+     7de:	66 90                	xchg   %ax,%ax
+        printint(f, *ap, 10, 1);
+     7e0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     7e3:	83 ec 0c             	sub    $0xc,%esp
+     7e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     7eb:	8b 17                	mov    (%edi),%edx
+     7ed:	6a 01                	push   $0x1
+     7ef:	eb 96                	jmp    787 <vfprintf+0xb7>
+     7f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc_unlocked(*ap, f);
+     7f8:	83 ec 08             	sub    $0x8,%esp
+     7fb:	56                   	push   %esi
+     7fc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     7ff:	ff 37                	push   (%edi)
+     801:	e8 6a 06 00 00       	call   e70 <putc_unlocked>
+        ap++;
+     806:	89 f8                	mov    %edi,%eax
+     808:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     80b:	31 ff                	xor    %edi,%edi
+        ap++;
+     80d:	83 c0 04             	add    $0x4,%eax
+     810:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     813:	e9 ea fe ff ff       	jmp    702 <vfprintf+0x32>
+     818:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     81f:	90                   	nop
+        putc_unlocked(c, f);
+     820:	83 ec 08             	sub    $0x8,%esp
+      state = 0;
+     823:	31 ff                	xor    %edi,%edi
+        putc_unlocked(c, f);
+     825:	56                   	push   %esi
+     826:	6a 25                	push   $0x25
+     828:	e8 43 06 00 00       	call   e70 <putc_unlocked>
+     82d:	83 c4 10             	add    $0x10,%esp
+     830:	e9 cd fe ff ff       	jmp    702 <vfprintf+0x32>
+     835:	8d 76 00             	lea    0x0(%esi),%esi
+     838:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     83d:	bf 2f 1d 00 00       	mov    $0x1d2f,%edi
+     842:	e9 79 ff ff ff       	jmp    7c0 <vfprintf+0xf0>
+     847:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     84e:	66 90                	xchg   %ax,%ax
+
+00000850 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+     850:	55                   	push   %ebp
+     851:	89 e5                	mov    %esp,%ebp
+     853:	53                   	push   %ebx
+     854:	83 ec 10             	sub    $0x10,%esp
+     857:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  flockfile(f);
+     85a:	53                   	push   %ebx
+     85b:	e8 d0 02 00 00       	call   b30 <flockfile>
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     860:	8b 55 0c             	mov    0xc(%ebp),%edx
+     863:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     866:	89 d8                	mov    %ebx,%eax
+     868:	e8 63 fe ff ff       	call   6d0 <vfprintf>
+  funlockfile(f);
+     86d:	89 1c 24             	mov    %ebx,(%esp)
+     870:	e8 eb 02 00 00       	call   b60 <funlockfile>
+}
+     875:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     878:	83 c4 10             	add    $0x10,%esp
+     87b:	c9                   	leave
+     87c:	c3                   	ret
+     87d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000880 <printf>:
+
+// Print to the given fd: through stdout or stderr for 1 and 2,
+// otherwise with one write() per call.
+void
+printf(int fd, const char *fmt, ...)
+{
+     880:	55                   	push   %ebp
+     881:	89 e5                	mov    %esp,%ebp
+     883:	56                   	push   %esi
+     884:	53                   	push   %ebx
+     885:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+     88b:	8b 45 08             	mov    0x8(%ebp),%eax
+  char buf[128];
+  struct iobuf f;
+
+  if(fd == 1 || fd == 2){
+    flockfile(&_iob[fd]);
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     88e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(fd == 1 || fd == 2){
+     891:	8d 50 ff             	lea    -0x1(%eax),%edx
+     894:	83 fa 01             	cmp    $0x1,%edx
+     897:	76 77                	jbe    910 <printf+0x90>
+    funlockfile(&_iob[fd]);
+    return;
+  }
+  f.fd = fd;
+     899:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  f.flags = IO_WRITE|IO_SETUP;
+  f.buf = buf;
+     89f:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  f.size = sizeof(buf);
+  f.r = f.n = 0;
+  mutex_init(&f.lock);
+     8a5:	83 ec 0c             	sub    $0xc,%esp
+     8a8:	8d 9d 5c ff ff ff    	lea    -0xa4(%ebp),%ebx
+  f.buf = buf;
+     8ae:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+  mutex_init(&f.lock);
+     8b4:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  f.flags = IO_WRITE|IO_SETUP;
+     8ba:	c7 85 60 ff ff ff 42 	movl   $0x42,-0xa0(%ebp)
+     8c1:	00 00 00 
+  f.size = sizeof(buf);
+     8c4:	c7 85 68 ff ff ff 80 	movl   $0x80,-0x98(%ebp)
+     8cb:	00 00 00 
+  f.r = f.n = 0;
+     8ce:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+     8d5:	00 00 00 
+     8d8:	c7 85 6c ff ff ff 00 	movl   $0x0,-0x94(%ebp)
+     8df:	00 00 00 
+  mutex_init(&f.lock);
+     8e2:	50                   	push   %eax
+     8e3:	e8 d8 f9 ff ff       	call   2c0 <mutex_init>
+  vfprintf(&f, fmt, (uint*)(void*)&fmt + 1);
+     8e8:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     8eb:	89 f2                	mov    %esi,%edx
+     8ed:	89 d8                	mov    %ebx,%eax
+     8ef:	e8 dc fd ff ff       	call   6d0 <vfprintf>
+  fflush(&f);
+     8f4:	89 1c 24             	mov    %ebx,(%esp)
+     8f7:	e8 f4 04 00 00       	call   df0 <fflush>
+     8fc:	83 c4 10             	add    $0x10,%esp
+}
+     8ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     902:	5b                   	pop    %ebx
+     903:	5e                   	pop    %esi
+     904:	5d                   	pop    %ebp
+     905:	c3                   	ret
+     906:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     90d:	8d 76 00             	lea    0x0(%esi),%esi
+    flockfile(&_iob[fd]);
+     910:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     913:	83 ec 0c             	sub    $0xc,%esp
+     916:	8d 98 00 27 00 00    	lea    0x2700(%eax),%ebx
+     91c:	53                   	push   %ebx
+     91d:	e8 0e 02 00 00       	call   b30 <flockfile>
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     922:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     925:	89 f2                	mov    %esi,%edx
+     927:	89 d8                	mov    %ebx,%eax
+     929:	e8 a2 fd ff ff       	call   6d0 <vfprintf>
+    funlockfile(&_iob[fd]);
+     92e:	89 1c 24             	mov    %ebx,(%esp)
+     931:	e8 2a 02 00 00       	call   b60 <funlockfile>
+     936:	83 c4 10             	add    $0x10,%esp
+}
+     939:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     93c:	5b                   	pop    %ebx
+     93d:	5e                   	pop    %esi
+     93e:	5d                   	pop    %ebp
+     93f:	c3                   	ret
+
+00000940 <setup>:
+}
+
+// Choose how to buffer f on first use: by lines on a device.
+static void
+setup(FILE *f)
+{
+     940:	55                   	push   %ebp
+     941:	89 e5                	mov    %esp,%ebp
+     943:	53                   	push   %ebx
+     944:	89 c3                	mov    %eax,%ebx
+     946:	83 ec 2c             	sub    $0x2c,%esp
+  struct stat st;
+
+  f->flags |= IO_SETUP;
+     949:	83 48 04 40          	orl    $0x40,0x4(%eax)
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     94d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     950:	50                   	push   %eax
+     951:	ff 33                	push   (%ebx)
+     953:	e8 52 fb ff ff       	call   4aa <fstat>
+     958:	83 c4 10             	add    $0x10,%esp
+     95b:	85 c0                	test   %eax,%eax
+    f->flags |= IO_DEV|IO_LINE;
+     95d:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     960:	75 07                	jne    969 <setup+0x29>
+     962:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+     967:	74 17                	je     980 <setup+0x40>
+  if(f->flags & IO_WRITE)
+     969:	a8 02                	test   $0x2,%al
+     96b:	74 0a                	je     977 <setup+0x37>
+    flushhook = flushall;
+     96d:	c7 05 e0 27 00 00 a0 	movl   $0xaa0,0x27e0
+     974:	0a 00 00 
+}
+     977:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     97a:	c9                   	leave
+     97b:	c3                   	ret
+     97c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    f->flags |= IO_DEV|IO_LINE;
+     980:	83 c8 30             	or     $0x30,%eax
+     983:	89 43 04             	mov    %eax,0x4(%ebx)
+     986:	eb e1                	jmp    969 <setup+0x29>
+     988:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     98f:	90                   	nop
+
+00000990 <flush>:
+static int
+flush(FILE *f)
+{
+  int i, n;
+
+  if(!(f->flags & IO_WRITE))
+     990:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+     994:	74 6a                	je     a00 <flush+0x70>
+{
+     996:	55                   	push   %ebp
+     997:	89 e5                	mov    %esp,%ebp
+     999:	56                   	push   %esi
+     99a:	89 c6                	mov    %eax,%esi
+     99c:	53                   	push   %ebx
+    return 0;
+  for(i = 0; i < f->n; i += n){
+     99d:	8b 40 14             	mov    0x14(%eax),%eax
+     9a0:	85 c0                	test   %eax,%eax
+     9a2:	7e 4c                	jle    9f0 <flush+0x60>
+     9a4:	31 db                	xor    %ebx,%ebx
+     9a6:	eb 11                	jmp    9b9 <flush+0x29>
+     9a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9af:	90                   	nop
+     9b0:	01 c3                	add    %eax,%ebx
+     9b2:	8b 46 14             	mov    0x14(%esi),%eax
+     9b5:	39 d8                	cmp    %ebx,%eax
+     9b7:	7e 37                	jle    9f0 <flush+0x60>
+    if((n = write(f->fd, f->buf + i, f->n - i)) <= 0){
+     9b9:	83 ec 04             	sub    $0x4,%esp
+     9bc:	29 d8                	sub    %ebx,%eax
+     9be:	50                   	push   %eax
+     9bf:	8b 46 08             	mov    0x8(%esi),%eax
+     9c2:	01 d8                	add    %ebx,%eax
+     9c4:	50                   	push   %eax
+     9c5:	ff 36                	push   (%esi)
+     9c7:	e8 75 fa ff ff       	call   441 <write>
+     9cc:	83 c4 10             	add    $0x10,%esp
+     9cf:	85 c0                	test   %eax,%eax
+     9d1:	7f dd                	jg     9b0 <flush+0x20>
+      f->flags |= IO_ERR;
+     9d3:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+      f->n = 0;
+     9d7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     9dc:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+      return EOF;
+    }
+  }
+  f->n = 0;
+  return 0;
+}
+     9e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     9e6:	5b                   	pop    %ebx
+     9e7:	5e                   	pop    %esi
+     9e8:	5d                   	pop    %ebp
+     9e9:	c3                   	ret
+     9ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->n = 0;
+     9f0:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+}
+     9f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+     9fa:	31 c0                	xor    %eax,%eax
+}
+     9fc:	5b                   	pop    %ebx
+     9fd:	5e                   	pop    %esi
+     9fe:	5d                   	pop    %ebp
+     9ff:	c3                   	ret
+    return 0;
+     a00:	31 c0                	xor    %eax,%eax
+}
+     a02:	c3                   	ret
+     a03:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a10 <fflush.part.0>:
+fflush(FILE *f)
+     a10:	55                   	push   %ebp
+     a11:	89 e5                	mov    %esp,%ebp
+     a13:	57                   	push   %edi
+     a14:	bf f8 27 00 00       	mov    $0x27f8,%edi
+     a19:	56                   	push   %esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     a1a:	31 f6                	xor    %esi,%esi
+fflush(FILE *f)
+     a1c:	53                   	push   %ebx
+     a1d:	bb 18 27 00 00       	mov    $0x2718,%ebx
+     a22:	83 ec 1c             	sub    $0x1c,%esp
+     a25:	eb 10                	jmp    a37 <fflush.part.0+0x27>
+     a27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a2e:	66 90                	xchg   %ax,%ax
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     a30:	83 c3 1c             	add    $0x1c,%ebx
+     a33:	39 df                	cmp    %ebx,%edi
+     a35:	74 33                	je     a6a <fflush.part.0+0x5a>
+      if((f->flags & IO_WRITE) && fflush(f) < 0)
+     a37:	f6 43 ec 02          	testb  $0x2,-0x14(%ebx)
+     a3b:	74 f3                	je     a30 <fflush.part.0+0x20>
+  if(threaded)
+     a3d:	8b 0d 00 28 00 00    	mov    0x2800,%ecx
+     a43:	85 c9                	test   %ecx,%ecx
+     a45:	75 49                	jne    a90 <fflush.part.0+0x80>
+  r = flush(f);
+     a47:	8d 43 e8             	lea    -0x18(%ebx),%eax
+     a4a:	e8 41 ff ff ff       	call   990 <flush>
+  if(threaded)
+     a4f:	8b 15 00 28 00 00    	mov    0x2800,%edx
+     a55:	85 d2                	test   %edx,%edx
+     a57:	75 1f                	jne    a78 <fflush.part.0+0x68>
+        r = EOF;
+     a59:	85 c0                	test   %eax,%eax
+     a5b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     a60:	0f 48 f0             	cmovs  %eax,%esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     a63:	83 c3 1c             	add    $0x1c,%ebx
+     a66:	39 df                	cmp    %ebx,%edi
+     a68:	75 cd                	jne    a37 <fflush.part.0+0x27>
+}
+     a6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a6d:	89 f0                	mov    %esi,%eax
+     a6f:	5b                   	pop    %ebx
+     a70:	5e                   	pop    %esi
+     a71:	5f                   	pop    %edi
+     a72:	5d                   	pop    %ebp
+     a73:	c3                   	ret
+     a74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     a78:	83 ec 0c             	sub    $0xc,%esp
+     a7b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     a7e:	53                   	push   %ebx
+     a7f:	e8 9c f8 ff ff       	call   320 <mutex_unlock>
+     a84:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     a87:	83 c4 10             	add    $0x10,%esp
+     a8a:	eb cd                	jmp    a59 <fflush.part.0+0x49>
+     a8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     a90:	83 ec 0c             	sub    $0xc,%esp
+     a93:	53                   	push   %ebx
+     a94:	e8 37 f8 ff ff       	call   2d0 <mutex_lock>
+     a99:	83 c4 10             	add    $0x10,%esp
+     a9c:	eb a9                	jmp    a47 <fflush.part.0+0x37>
+     a9e:	66 90                	xchg   %ax,%ax
+
+00000aa0 <flushall>:
+  if(f == 0){
+     aa0:	e9 6b ff ff ff       	jmp    a10 <fflush.part.0>
+     aa5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ab0 <fill>:
+
+// Refill f's buffer. Returns the number of bytes read.
+// Caller holds f's lock.
+static int
+fill(FILE *f)
+{
+     ab0:	55                   	push   %ebp
+     ab1:	89 e5                	mov    %esp,%ebp
+     ab3:	53                   	push   %ebx
+     ab4:	89 c3                	mov    %eax,%ebx
+     ab6:	83 ec 04             	sub    $0x4,%esp
+  int n;
+
+  if(!(f->flags & IO_SETUP))
+     ab9:	8b 40 04             	mov    0x4(%eax),%eax
+     abc:	a8 40                	test   $0x40,%al
+     abe:	74 50                	je     b10 <fill+0x60>
+    setup(f);
+  if(f->flags & IO_DEV)
+     ac0:	a8 20                	test   $0x20,%al
+     ac2:	75 3c                	jne    b00 <fill+0x50>
+    fflush(0);
+  f->r = 0;
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     ac4:	83 ec 04             	sub    $0x4,%esp
+  f->r = 0;
+     ac7:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     ace:	ff 73 0c             	push   0xc(%ebx)
+     ad1:	ff 73 08             	push   0x8(%ebx)
+     ad4:	ff 33                	push   (%ebx)
+     ad6:	e8 57 f9 ff ff       	call   432 <read>
+     adb:	83 c4 10             	add    $0x10,%esp
+     ade:	85 c0                	test   %eax,%eax
+     ae0:	7f 10                	jg     af2 <fill+0x42>
+    f->flags |= n < 0 ? IO_ERR : IO_EOF;
+     ae2:	83 f8 01             	cmp    $0x1,%eax
+     ae5:	19 c0                	sbb    %eax,%eax
+     ae7:	83 e0 fc             	and    $0xfffffffc,%eax
+     aea:	83 c0 08             	add    $0x8,%eax
+     aed:	09 43 04             	or     %eax,0x4(%ebx)
+    n = 0;
+     af0:	31 c0                	xor    %eax,%eax
+  }
+  f->n = n;
+     af2:	89 43 14             	mov    %eax,0x14(%ebx)
+  return n;
+}
+     af5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     af8:	c9                   	leave
+     af9:	c3                   	ret
+     afa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == 0){
+     b00:	e8 0b ff ff ff       	call   a10 <fflush.part.0>
+     b05:	eb bd                	jmp    ac4 <fill+0x14>
+     b07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b0e:	66 90                	xchg   %ax,%ax
+    setup(f);
+     b10:	89 d8                	mov    %ebx,%eax
+     b12:	e8 29 fe ff ff       	call   940 <setup>
+  if(f->flags & IO_DEV)
+     b17:	8b 43 04             	mov    0x4(%ebx),%eax
+     b1a:	eb a4                	jmp    ac0 <fill+0x10>
+     b1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b20 <stdio_threaded>:
+  threaded = 1;
+     b20:	c7 05 00 28 00 00 01 	movl   $0x1,0x2800
+     b27:	00 00 00 
+}
+     b2a:	c3                   	ret
+     b2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b2f:	90                   	nop
+
+00000b30 <flockfile>:
+{
+     b30:	55                   	push   %ebp
+  if(threaded)
+     b31:	8b 15 00 28 00 00    	mov    0x2800,%edx
+{
+     b37:	89 e5                	mov    %esp,%ebp
+     b39:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     b3c:	85 d2                	test   %edx,%edx
+     b3e:	75 08                	jne    b48 <flockfile+0x18>
+}
+     b40:	5d                   	pop    %ebp
+     b41:	c3                   	ret
+     b42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_lock(&f->lock);
+     b48:	83 c0 18             	add    $0x18,%eax
+     b4b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     b4e:	5d                   	pop    %ebp
+    mutex_lock(&f->lock);
+     b4f:	e9 7c f7 ff ff       	jmp    2d0 <mutex_lock>
+     b54:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b5f:	90                   	nop
+
+00000b60 <funlockfile>:
+{
+     b60:	55                   	push   %ebp
+  if(threaded)
+     b61:	8b 15 00 28 00 00    	mov    0x2800,%edx
+{
+     b67:	89 e5                	mov    %esp,%ebp
+     b69:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     b6c:	85 d2                	test   %edx,%edx
+     b6e:	75 08                	jne    b78 <funlockfile+0x18>
+}
+     b70:	5d                   	pop    %ebp
+     b71:	c3                   	ret
+     b72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&f->lock);
+     b78:	83 c0 18             	add    $0x18,%eax
+     b7b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     b7e:	5d                   	pop    %ebp
+    mutex_unlock(&f->lock);
+     b7f:	e9 9c f7 ff ff       	jmp    320 <mutex_unlock>
+     b84:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b8f:	90                   	nop
+
+00000b90 <fopen>:
+{
+     b90:	55                   	push   %ebp
+     b91:	89 e5                	mov    %esp,%ebp
+     b93:	57                   	push   %edi
+     b94:	56                   	push   %esi
+     b95:	53                   	push   %ebx
+     b96:	83 ec 34             	sub    $0x34,%esp
+     b99:	8b 75 0c             	mov    0xc(%ebp),%esi
+     b9c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(strcmp(mode, "r") != 0 && strcmp(mode, "w") != 0)
+     b9f:	68 a1 1d 00 00       	push   $0x1da1
+     ba4:	56                   	push   %esi
+     ba5:	e8 66 f5 ff ff       	call   110 <strcmp>
+     baa:	83 c4 10             	add    $0x10,%esp
+     bad:	85 c0                	test   %eax,%eax
+     baf:	74 15                	je     bc6 <fopen+0x36>
+     bb1:	83 ec 08             	sub    $0x8,%esp
+     bb4:	68 a3 1d 00 00       	push   $0x1da3
+     bb9:	56                   	push   %esi
+     bba:	e8 51 f5 ff ff       	call   110 <strcmp>
+     bbf:	83 c4 10             	add    $0x10,%esp
+     bc2:	85 c0                	test   %eax,%eax
+     bc4:	75 2c                	jne    bf2 <fopen+0x62>
+  if(threaded)
+     bc6:	a1 00 28 00 00       	mov    0x2800,%eax
+     bcb:	85 c0                	test   %eax,%eax
+     bcd:	0f 85 ed 00 00 00    	jne    cc0 <fopen+0x130>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     bd3:	bb 54 27 00 00       	mov    $0x2754,%ebx
+    if(f->flags == 0)
+     bd8:	8b 53 04             	mov    0x4(%ebx),%edx
+     bdb:	85 d2                	test   %edx,%edx
+     bdd:	74 21                	je     c00 <fopen+0x70>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     bdf:	83 c3 1c             	add    $0x1c,%ebx
+     be2:	81 fb e0 27 00 00    	cmp    $0x27e0,%ebx
+     be8:	75 ee                	jne    bd8 <fopen+0x48>
+  if(threaded)
+     bea:	85 c0                	test   %eax,%eax
+     bec:	0f 85 36 01 00 00    	jne    d28 <fopen+0x198>
+    return 0;
+     bf2:	31 db                	xor    %ebx,%ebx
+     bf4:	e9 96 00 00 00       	jmp    c8f <fopen+0xff>
+     bf9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f == &_iob[NSTREAM])
+     c00:	81 fb e0 27 00 00    	cmp    $0x27e0,%ebx
+     c06:	74 e2                	je     bea <fopen+0x5a>
+    f->flags = IO_MALLOC;
+     c08:	c7 43 04 80 00 00 00 	movl   $0x80,0x4(%ebx)
+  if(threaded)
+     c0f:	85 c0                	test   %eax,%eax
+     c11:	0f 85 f9 00 00 00    	jne    d10 <fopen+0x180>
+  if(mode[0] == 'r'){
+     c17:	80 3e 72             	cmpb   $0x72,(%esi)
+     c1a:	0f 84 c0 00 00 00    	je     ce0 <fopen+0x150>
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     c20:	83 ec 08             	sub    $0x8,%esp
+     c23:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     c26:	50                   	push   %eax
+     c27:	57                   	push   %edi
+     c28:	e8 d3 f5 ff ff       	call   200 <stat>
+     c2d:	83 c4 10             	add    $0x10,%esp
+     c30:	85 c0                	test   %eax,%eax
+     c32:	74 6c                	je     ca0 <fopen+0x110>
+    fd = open(path, O_CREATE|O_WRONLY);
+     c34:	83 ec 08             	sub    $0x8,%esp
+     c37:	68 01 02 00 00       	push   $0x201
+     c3c:	57                   	push   %edi
+    flags = IO_WRITE;
+     c3d:	bf 02 00 00 00       	mov    $0x2,%edi
+    fd = open(path, O_CREATE|O_WRONLY);
+     c42:	e8 36 f8 ff ff       	call   47d <open>
+     c47:	83 c4 10             	add    $0x10,%esp
+     c4a:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     c4c:	85 f6                	test   %esi,%esi
+     c4e:	0f 88 a9 00 00 00    	js     cfd <fopen+0x16d>
+     c54:	83 ec 0c             	sub    $0xc,%esp
+     c57:	68 00 02 00 00       	push   $0x200
+     c5c:	e8 af 0c 00 00       	call   1910 <malloc>
+     c61:	83 c4 10             	add    $0x10,%esp
+     c64:	89 43 08             	mov    %eax,0x8(%ebx)
+     c67:	85 c0                	test   %eax,%eax
+     c69:	0f 84 d0 00 00 00    	je     d3f <fopen+0x1af>
+  f->flags = flags|IO_MALLOC;
+     c6f:	81 cf 80 00 00 00    	or     $0x80,%edi
+  f->fd = fd;
+     c75:	89 33                	mov    %esi,(%ebx)
+  f->size = BUFSIZ;
+     c77:	c7 43 0c 00 02 00 00 	movl   $0x200,0xc(%ebx)
+  f->r = f->n = 0;
+     c7e:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+     c85:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  f->flags = flags|IO_MALLOC;
+     c8c:	89 7b 04             	mov    %edi,0x4(%ebx)
+}
+     c8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c92:	89 d8                	mov    %ebx,%eax
+     c94:	5b                   	pop    %ebx
+     c95:	5e                   	pop    %esi
+     c96:	5f                   	pop    %edi
+     c97:	5d                   	pop    %ebp
+     c98:	c3                   	ret
+     c99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     ca0:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+     ca5:	75 8d                	jne    c34 <fopen+0xa4>
+      unlink(path);
+     ca7:	83 ec 0c             	sub    $0xc,%esp
+     caa:	57                   	push   %edi
+     cab:	e8 eb f7 ff ff       	call   49b <unlink>
+     cb0:	83 c4 10             	add    $0x10,%esp
+     cb3:	e9 7c ff ff ff       	jmp    c34 <fopen+0xa4>
+     cb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cbf:	90                   	nop
+    mutex_lock(&iolock);
+     cc0:	83 ec 0c             	sub    $0xc,%esp
+     cc3:	68 04 28 00 00       	push   $0x2804
+     cc8:	e8 03 f6 ff ff       	call   2d0 <mutex_lock>
+  if(threaded)
+     ccd:	a1 00 28 00 00       	mov    0x2800,%eax
+     cd2:	83 c4 10             	add    $0x10,%esp
+     cd5:	e9 f9 fe ff ff       	jmp    bd3 <fopen+0x43>
+     cda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    fd = open(path, O_RDONLY);
+     ce0:	83 ec 08             	sub    $0x8,%esp
+     ce3:	6a 00                	push   $0x0
+     ce5:	57                   	push   %edi
+    flags = IO_READ;
+     ce6:	bf 01 00 00 00       	mov    $0x1,%edi
+    fd = open(path, O_RDONLY);
+     ceb:	e8 8d f7 ff ff       	call   47d <open>
+     cf0:	83 c4 10             	add    $0x10,%esp
+     cf3:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     cf5:	85 f6                	test   %esi,%esi
+     cf7:	0f 89 57 ff ff ff    	jns    c54 <fopen+0xc4>
+    f->flags = 0;
+     cfd:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    return 0;
+     d04:	31 db                	xor    %ebx,%ebx
+     d06:	eb 87                	jmp    c8f <fopen+0xff>
+     d08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d0f:	90                   	nop
+    mutex_unlock(&iolock);
+     d10:	83 ec 0c             	sub    $0xc,%esp
+     d13:	68 04 28 00 00       	push   $0x2804
+     d18:	e8 03 f6 ff ff       	call   320 <mutex_unlock>
+     d1d:	83 c4 10             	add    $0x10,%esp
+     d20:	e9 f2 fe ff ff       	jmp    c17 <fopen+0x87>
+     d25:	8d 76 00             	lea    0x0(%esi),%esi
+     d28:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+     d2b:	31 db                	xor    %ebx,%ebx
+    mutex_unlock(&iolock);
+     d2d:	68 04 28 00 00       	push   $0x2804
+     d32:	e8 e9 f5 ff ff       	call   320 <mutex_unlock>
+     d37:	83 c4 10             	add    $0x10,%esp
+     d3a:	e9 50 ff ff ff       	jmp    c8f <fopen+0xff>
+      close(fd);
+     d3f:	83 ec 0c             	sub    $0xc,%esp
+     d42:	56                   	push   %esi
+     d43:	e8 08 f7 ff ff       	call   450 <close>
+     d48:	83 c4 10             	add    $0x10,%esp
+     d4b:	eb b0                	jmp    cfd <fopen+0x16d>
+     d4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d50 <fclose>:
+{
+     d50:	55                   	push   %ebp
+     d51:	89 e5                	mov    %esp,%ebp
+     d53:	56                   	push   %esi
+     d54:	53                   	push   %ebx
+  if(threaded)
+     d55:	8b 15 00 28 00 00    	mov    0x2800,%edx
+{
+     d5b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+     d5e:	85 d2                	test   %edx,%edx
+     d60:	75 46                	jne    da8 <fclose+0x58>
+  r = flush(f);
+     d62:	89 d8                	mov    %ebx,%eax
+     d64:	e8 27 fc ff ff       	call   990 <flush>
+  if(close(f->fd) < 0)
+     d69:	83 ec 0c             	sub    $0xc,%esp
+     d6c:	ff 33                	push   (%ebx)
+  r = flush(f);
+     d6e:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+     d70:	e8 db f6 ff ff       	call   450 <close>
+     d75:	83 c4 10             	add    $0x10,%esp
+    r = EOF;
+     d78:	85 c0                	test   %eax,%eax
+     d7a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     d7f:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->flags & IO_MALLOC)
+     d82:	f6 43 04 80          	testb  $0x80,0x4(%ebx)
+     d86:	75 58                	jne    de0 <fclose+0x90>
+  if(threaded)
+     d88:	a1 00 28 00 00       	mov    0x2800,%eax
+  f->flags = 0;
+     d8d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  if(threaded)
+     d94:	85 c0                	test   %eax,%eax
+     d96:	75 28                	jne    dc0 <fclose+0x70>
+}
+     d98:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d9b:	89 f0                	mov    %esi,%eax
+     d9d:	5b                   	pop    %ebx
+     d9e:	5e                   	pop    %esi
+     d9f:	5d                   	pop    %ebp
+     da0:	c3                   	ret
+     da1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     da8:	83 ec 0c             	sub    $0xc,%esp
+     dab:	8d 43 18             	lea    0x18(%ebx),%eax
+     dae:	50                   	push   %eax
+     daf:	e8 1c f5 ff ff       	call   2d0 <mutex_lock>
+     db4:	83 c4 10             	add    $0x10,%esp
+     db7:	eb a9                	jmp    d62 <fclose+0x12>
+     db9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     dc0:	83 ec 0c             	sub    $0xc,%esp
+     dc3:	83 c3 18             	add    $0x18,%ebx
+     dc6:	53                   	push   %ebx
+     dc7:	e8 54 f5 ff ff       	call   320 <mutex_unlock>
+     dcc:	83 c4 10             	add    $0x10,%esp
+}
+     dcf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     dd2:	89 f0                	mov    %esi,%eax
+     dd4:	5b                   	pop    %ebx
+     dd5:	5e                   	pop    %esi
+     dd6:	5d                   	pop    %ebp
+     dd7:	c3                   	ret
+     dd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ddf:	90                   	nop
+    free(f->buf);
+     de0:	83 ec 0c             	sub    $0xc,%esp
+     de3:	ff 73 08             	push   0x8(%ebx)
+     de6:	e8 f5 09 00 00       	call   17e0 <free>
+     deb:	83 c4 10             	add    $0x10,%esp
+     dee:	eb 98                	jmp    d88 <fclose+0x38>
+
+00000df0 <fflush>:
+{
+     df0:	55                   	push   %ebp
+     df1:	89 e5                	mov    %esp,%ebp
+     df3:	53                   	push   %ebx
+     df4:	83 ec 14             	sub    $0x14,%esp
+     df7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f == 0){
+     dfa:	85 db                	test   %ebx,%ebx
+     dfc:	74 5a                	je     e58 <fflush+0x68>
+  if(threaded)
+     dfe:	8b 0d 00 28 00 00    	mov    0x2800,%ecx
+     e04:	85 c9                	test   %ecx,%ecx
+     e06:	75 18                	jne    e20 <fflush+0x30>
+  r = flush(f);
+     e08:	89 d8                	mov    %ebx,%eax
+     e0a:	e8 81 fb ff ff       	call   990 <flush>
+  if(threaded)
+     e0f:	8b 15 00 28 00 00    	mov    0x2800,%edx
+     e15:	85 d2                	test   %edx,%edx
+     e17:	75 1f                	jne    e38 <fflush+0x48>
+}
+     e19:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e1c:	c9                   	leave
+     e1d:	c3                   	ret
+     e1e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+     e20:	83 ec 0c             	sub    $0xc,%esp
+     e23:	8d 43 18             	lea    0x18(%ebx),%eax
+     e26:	50                   	push   %eax
+     e27:	e8 a4 f4 ff ff       	call   2d0 <mutex_lock>
+     e2c:	83 c4 10             	add    $0x10,%esp
+     e2f:	eb d7                	jmp    e08 <fflush+0x18>
+     e31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     e38:	83 ec 0c             	sub    $0xc,%esp
+     e3b:	83 c3 18             	add    $0x18,%ebx
+     e3e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     e41:	53                   	push   %ebx
+     e42:	e8 d9 f4 ff ff       	call   320 <mutex_unlock>
+     e47:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     e4a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    mutex_unlock(&f->lock);
+     e4d:	83 c4 10             	add    $0x10,%esp
+}
+     e50:	c9                   	leave
+     e51:	c3                   	ret
+     e52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     e58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e5b:	c9                   	leave
+     e5c:	e9 af fb ff ff       	jmp    a10 <fflush.part.0>
+     e61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e6f:	90                   	nop
+
+00000e70 <putc_unlocked>:
+{
+     e70:	55                   	push   %ebp
+     e71:	89 e5                	mov    %esp,%ebp
+     e73:	56                   	push   %esi
+     e74:	53                   	push   %ebx
+     e75:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     e78:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(!(f->flags & IO_WRITE))
+     e7b:	8b 43 04             	mov    0x4(%ebx),%eax
+     e7e:	a8 02                	test   $0x2,%al
+     e80:	74 46                	je     ec8 <putc_unlocked+0x58>
+  if(!(f->flags & IO_SETUP))
+     e82:	a8 40                	test   $0x40,%al
+     e84:	74 4a                	je     ed0 <putc_unlocked+0x60>
+  if(f->n == f->size && flush(f) < 0)
+     e86:	8b 43 14             	mov    0x14(%ebx),%eax
+     e89:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     e8c:	74 51                	je     edf <putc_unlocked+0x6f>
+  f->buf[f->n++] = c;
+     e8e:	8d 48 01             	lea    0x1(%eax),%ecx
+     e91:	8b 53 08             	mov    0x8(%ebx),%edx
+     e94:	89 4b 14             	mov    %ecx,0x14(%ebx)
+     e97:	89 f1                	mov    %esi,%ecx
+     e99:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     e9c:	83 fe 0a             	cmp    $0xa,%esi
+     e9f:	74 0f                	je     eb0 <putc_unlocked+0x40>
+  return c & 0xff;
+     ea1:	89 f0                	mov    %esi,%eax
+     ea3:	0f b6 c0             	movzbl %al,%eax
+}
+     ea6:	5b                   	pop    %ebx
+     ea7:	5e                   	pop    %esi
+     ea8:	5d                   	pop    %ebp
+     ea9:	c3                   	ret
+     eaa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     eb0:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+     eb4:	74 eb                	je     ea1 <putc_unlocked+0x31>
+     eb6:	89 d8                	mov    %ebx,%eax
+     eb8:	e8 d3 fa ff ff       	call   990 <flush>
+     ebd:	85 c0                	test   %eax,%eax
+     ebf:	79 e0                	jns    ea1 <putc_unlocked+0x31>
+     ec1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return EOF;
+     ec8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     ecd:	eb d7                	jmp    ea6 <putc_unlocked+0x36>
+     ecf:	90                   	nop
+    setup(f);
+     ed0:	89 d8                	mov    %ebx,%eax
+     ed2:	e8 69 fa ff ff       	call   940 <setup>
+  if(f->n == f->size && flush(f) < 0)
+     ed7:	8b 43 14             	mov    0x14(%ebx),%eax
+     eda:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     edd:	75 af                	jne    e8e <putc_unlocked+0x1e>
+     edf:	89 d8                	mov    %ebx,%eax
+     ee1:	e8 aa fa ff ff       	call   990 <flush>
+     ee6:	85 c0                	test   %eax,%eax
+     ee8:	78 de                	js     ec8 <putc_unlocked+0x58>
+  f->buf[f->n++] = c;
+     eea:	8b 43 14             	mov    0x14(%ebx),%eax
+     eed:	eb 9f                	jmp    e8e <putc_unlocked+0x1e>
+     eef:	90                   	nop
+
+00000ef0 <fputc>:
+{
+     ef0:	55                   	push   %ebp
+     ef1:	89 e5                	mov    %esp,%ebp
+     ef3:	56                   	push   %esi
+     ef4:	53                   	push   %ebx
+  if(threaded)
+     ef5:	8b 15 00 28 00 00    	mov    0x2800,%edx
+{
+     efb:	8b 75 08             	mov    0x8(%ebp),%esi
+     efe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(threaded)
+     f01:	85 d2                	test   %edx,%edx
+     f03:	75 6b                	jne    f70 <fputc+0x80>
+  if(!(f->flags & IO_WRITE))
+     f05:	8b 43 04             	mov    0x4(%ebx),%eax
+     f08:	a8 02                	test   $0x2,%al
+     f0a:	0f 84 b8 00 00 00    	je     fc8 <fputc+0xd8>
+  if(!(f->flags & IO_SETUP))
+     f10:	a8 40                	test   $0x40,%al
+     f12:	74 76                	je     f8a <fputc+0x9a>
+  if(f->n == f->size && flush(f) < 0)
+     f14:	8b 43 14             	mov    0x14(%ebx),%eax
+     f17:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     f1a:	74 7d                	je     f99 <fputc+0xa9>
+  f->buf[f->n++] = c;
+     f1c:	8d 48 01             	lea    0x1(%eax),%ecx
+     f1f:	8b 53 08             	mov    0x8(%ebx),%edx
+     f22:	89 4b 14             	mov    %ecx,0x14(%ebx)
+     f25:	89 f1                	mov    %esi,%ecx
+     f27:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     f2a:	83 fe 0a             	cmp    $0xa,%esi
+     f2d:	74 21                	je     f50 <fputc+0x60>
+  return c & 0xff;
+     f2f:	89 f0                	mov    %esi,%eax
+     f31:	0f b6 f0             	movzbl %al,%esi
+  if(threaded)
+     f34:	a1 00 28 00 00       	mov    0x2800,%eax
+     f39:	85 c0                	test   %eax,%eax
+     f3b:	75 73                	jne    fb0 <fputc+0xc0>
+}
+     f3d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f40:	89 f0                	mov    %esi,%eax
+     f42:	5b                   	pop    %ebx
+     f43:	5e                   	pop    %esi
+     f44:	5d                   	pop    %ebp
+     f45:	c3                   	ret
+     f46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f4d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     f50:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+     f54:	74 d9                	je     f2f <fputc+0x3f>
+     f56:	89 d8                	mov    %ebx,%eax
+     f58:	e8 33 fa ff ff       	call   990 <flush>
+     f5d:	85 c0                	test   %eax,%eax
+     f5f:	79 ce                	jns    f2f <fputc+0x3f>
+    return EOF;
+     f61:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     f66:	eb cc                	jmp    f34 <fputc+0x44>
+     f68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f6f:	90                   	nop
+    mutex_lock(&f->lock);
+     f70:	83 ec 0c             	sub    $0xc,%esp
+     f73:	8d 43 18             	lea    0x18(%ebx),%eax
+     f76:	50                   	push   %eax
+     f77:	e8 54 f3 ff ff       	call   2d0 <mutex_lock>
+  if(!(f->flags & IO_WRITE))
+     f7c:	8b 43 04             	mov    0x4(%ebx),%eax
+     f7f:	83 c4 10             	add    $0x10,%esp
+     f82:	a8 02                	test   $0x2,%al
+     f84:	74 db                	je     f61 <fputc+0x71>
+  if(!(f->flags & IO_SETUP))
+     f86:	a8 40                	test   $0x40,%al
+     f88:	75 8a                	jne    f14 <fputc+0x24>
+    setup(f);
+     f8a:	89 d8                	mov    %ebx,%eax
+     f8c:	e8 af f9 ff ff       	call   940 <setup>
+  if(f->n == f->size && flush(f) < 0)
+     f91:	8b 43 14             	mov    0x14(%ebx),%eax
+     f94:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     f97:	75 83                	jne    f1c <fputc+0x2c>
+     f99:	89 d8                	mov    %ebx,%eax
+     f9b:	e8 f0 f9 ff ff       	call   990 <flush>
+     fa0:	85 c0                	test   %eax,%eax
+     fa2:	78 bd                	js     f61 <fputc+0x71>
+  f->buf[f->n++] = c;
+     fa4:	8b 43 14             	mov    0x14(%ebx),%eax
+     fa7:	e9 70 ff ff ff       	jmp    f1c <fputc+0x2c>
+     fac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     fb0:	83 ec 0c             	sub    $0xc,%esp
+     fb3:	83 c3 18             	add    $0x18,%ebx
+     fb6:	53                   	push   %ebx
+     fb7:	e8 64 f3 ff ff       	call   320 <mutex_unlock>
+     fbc:	83 c4 10             	add    $0x10,%esp
+}
+     fbf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     fc2:	89 f0                	mov    %esi,%eax
+     fc4:	5b                   	pop    %ebx
+     fc5:	5e                   	pop    %esi
+     fc6:	5d                   	pop    %ebp
+     fc7:	c3                   	ret
+    return EOF;
+     fc8:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+     fcd:	e9 6b ff ff ff       	jmp    f3d <fputc+0x4d>
+     fd2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000fe0 <fwrite>:
+{
+     fe0:	55                   	push   %ebp
+     fe1:	89 e5                	mov    %esp,%ebp
+     fe3:	57                   	push   %edi
+     fe4:	56                   	push   %esi
+     fe5:	53                   	push   %ebx
+     fe6:	83 ec 1c             	sub    $0x1c,%esp
+     fe9:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  if(!(f->flags & IO_WRITE) || size <= 0)
+     fec:	8b 43 04             	mov    0x4(%ebx),%eax
+     fef:	a8 02                	test   $0x2,%al
+     ff1:	0f 84 ec 00 00 00    	je     10e3 <fwrite+0x103>
+     ff7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     ffa:	85 c9                	test   %ecx,%ecx
+     ffc:	0f 8e e1 00 00 00    	jle    10e3 <fwrite+0x103>
+  if(threaded)
+    1002:	8b 15 00 28 00 00    	mov    0x2800,%edx
+    1008:	85 d2                	test   %edx,%edx
+    100a:	0f 85 1c 01 00 00    	jne    112c <fwrite+0x14c>
+  if(!(f->flags & IO_SETUP))
+    1010:	a8 40                	test   $0x40,%al
+    1012:	0f 84 08 01 00 00    	je     1120 <fwrite+0x140>
+  for(len = size*nmemb; len > 0; len -= n){
+    1018:	8b 45 0c             	mov    0xc(%ebp),%eax
+    101b:	0f af 45 10          	imul   0x10(%ebp),%eax
+    101f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    1022:	85 c0                	test   %eax,%eax
+    1024:	0f 8e 2a 01 00 00    	jle    1154 <fwrite+0x174>
+  s = p;
+    102a:	8b 45 08             	mov    0x8(%ebp),%eax
+  nl = 0;
+    102d:	31 ff                	xor    %edi,%edi
+    102f:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+        nl = 1;
+    1032:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  s = p;
+    1035:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1038:	8b 43 14             	mov    0x14(%ebx),%eax
+        nl = 1;
+    103b:	89 ce                	mov    %ecx,%esi
+    if(f->n == f->size && flush(f) < 0)
+    103d:	89 c2                	mov    %eax,%edx
+    103f:	39 f0                	cmp    %esi,%eax
+    1041:	74 6e                	je     10b1 <fwrite+0xd1>
+    1043:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1047:	90                   	nop
+    if(n > len)
+    1048:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    n = f->size - f->n;
+    104b:	89 f1                	mov    %esi,%ecx
+    104d:	29 c1                	sub    %eax,%ecx
+    104f:	39 f9                	cmp    %edi,%ecx
+    1051:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1054:	85 c9                	test   %ecx,%ecx
+    1056:	0f 8e 7c 00 00 00    	jle    10d8 <fwrite+0xf8>
+    105c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    105f:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1062:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    1065:	8d 34 08             	lea    (%eax,%ecx,1),%esi
+    1068:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    106b:	eb 06                	jmp    1073 <fwrite+0x93>
+    106d:	8d 76 00             	lea    0x0(%esi),%esi
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1070:	8b 53 14             	mov    0x14(%ebx),%edx
+    1073:	8d 4a 01             	lea    0x1(%edx),%ecx
+    1076:	8b 73 08             	mov    0x8(%ebx),%esi
+    1079:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    107c:	0f b6 08             	movzbl (%eax),%ecx
+        nl = 1;
+    107f:	80 f9 0a             	cmp    $0xa,%cl
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1082:	88 0c 16             	mov    %cl,(%esi,%edx,1)
+        nl = 1;
+    1085:	be 01 00 00 00       	mov    $0x1,%esi
+    108a:	0f 44 fe             	cmove  %esi,%edi
+    for(i = 0; i < n; i++)
+    108d:	83 c0 01             	add    $0x1,%eax
+    1090:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    1093:	75 db                	jne    1070 <fwrite+0x90>
+    s += n;
+    1095:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1098:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    109b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    s += n;
+    109e:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    10a1:	85 c0                	test   %eax,%eax
+    10a3:	7e 48                	jle    10ed <fwrite+0x10d>
+    10a5:	8b 43 14             	mov    0x14(%ebx),%eax
+    10a8:	8b 73 0c             	mov    0xc(%ebx),%esi
+    if(f->n == f->size && flush(f) < 0)
+    10ab:	89 c2                	mov    %eax,%edx
+    10ad:	39 f0                	cmp    %esi,%eax
+    10af:	75 97                	jne    1048 <fwrite+0x68>
+    10b1:	89 d8                	mov    %ebx,%eax
+    10b3:	e8 d8 f8 ff ff       	call   990 <flush>
+    10b8:	85 c0                	test   %eax,%eax
+    10ba:	78 31                	js     10ed <fwrite+0x10d>
+    n = f->size - f->n;
+    10bc:	8b 73 0c             	mov    0xc(%ebx),%esi
+    10bf:	8b 43 14             	mov    0x14(%ebx),%eax
+    10c2:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    10c5:	89 f1                	mov    %esi,%ecx
+    10c7:	89 c2                	mov    %eax,%edx
+    10c9:	29 c1                	sub    %eax,%ecx
+    10cb:	39 f9                	cmp    %edi,%ecx
+    10cd:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    10d0:	85 c9                	test   %ecx,%ecx
+    10d2:	7f 88                	jg     105c <fwrite+0x7c>
+    10d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    s += n;
+    10d8:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    10db:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    10de:	e9 5a ff ff ff       	jmp    103d <fwrite+0x5d>
+}
+    10e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    10e6:	31 c0                	xor    %eax,%eax
+}
+    10e8:	5b                   	pop    %ebx
+    10e9:	5e                   	pop    %esi
+    10ea:	5f                   	pop    %edi
+    10eb:	5d                   	pop    %ebp
+    10ec:	c3                   	ret
+  if(nl && (f->flags & IO_LINE))
+    10ed:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    10f0:	85 ff                	test   %edi,%edi
+    10f2:	74 06                	je     10fa <fwrite+0x11a>
+    10f4:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    10f8:	75 1d                	jne    1117 <fwrite+0x137>
+  return (s - (const char*)p) / size;
+    10fa:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    10fd:	2b 75 08             	sub    0x8(%ebp),%esi
+  if(threaded)
+    1100:	a1 00 28 00 00       	mov    0x2800,%eax
+    1105:	85 c0                	test   %eax,%eax
+    1107:	75 3a                	jne    1143 <fwrite+0x163>
+  return (s - (const char*)p) / size;
+    1109:	89 f0                	mov    %esi,%eax
+    110b:	99                   	cltd
+    110c:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    110f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1112:	5b                   	pop    %ebx
+    1113:	5e                   	pop    %esi
+    1114:	5f                   	pop    %edi
+    1115:	5d                   	pop    %ebp
+    1116:	c3                   	ret
+    flush(f);
+    1117:	89 d8                	mov    %ebx,%eax
+    1119:	e8 72 f8 ff ff       	call   990 <flush>
+    111e:	eb da                	jmp    10fa <fwrite+0x11a>
+    setup(f);
+    1120:	89 d8                	mov    %ebx,%eax
+    1122:	e8 19 f8 ff ff       	call   940 <setup>
+    1127:	e9 ec fe ff ff       	jmp    1018 <fwrite+0x38>
+    mutex_lock(&f->lock);
+    112c:	83 ec 0c             	sub    $0xc,%esp
+    112f:	8d 43 18             	lea    0x18(%ebx),%eax
+    1132:	50                   	push   %eax
+    1133:	e8 98 f1 ff ff       	call   2d0 <mutex_lock>
+  if(!(f->flags & IO_SETUP))
+    1138:	8b 43 04             	mov    0x4(%ebx),%eax
+    113b:	83 c4 10             	add    $0x10,%esp
+    113e:	e9 cd fe ff ff       	jmp    1010 <fwrite+0x30>
+    mutex_unlock(&f->lock);
+    1143:	83 ec 0c             	sub    $0xc,%esp
+    1146:	83 c3 18             	add    $0x18,%ebx
+    1149:	53                   	push   %ebx
+    114a:	e8 d1 f1 ff ff       	call   320 <mutex_unlock>
+    114f:	83 c4 10             	add    $0x10,%esp
+    1152:	eb b5                	jmp    1109 <fwrite+0x129>
+  for(len = size*nmemb; len > 0; len -= n){
+    1154:	31 f6                	xor    %esi,%esi
+    1156:	eb a8                	jmp    1100 <fwrite+0x120>
+    1158:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    115f:	90                   	nop
+
+00001160 <fgetc>:
+  return f->buf[f->r++] & 0xff;
+}
+
+int
+fgetc(FILE *f)
+{
+    1160:	55                   	push   %ebp
+    1161:	89 e5                	mov    %esp,%ebp
+    1163:	56                   	push   %esi
+    1164:	53                   	push   %ebx
+  if(threaded)
+    1165:	8b 15 00 28 00 00    	mov    0x2800,%edx
+{
+    116b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    116e:	85 d2                	test   %edx,%edx
+    1170:	75 2e                	jne    11a0 <fgetc+0x40>
+  if(!(f->flags & IO_READ))
+    1172:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1176:	74 78                	je     11f0 <fgetc+0x90>
+  if(f->r == f->n && fill(f) == 0)
+    1178:	8b 43 10             	mov    0x10(%ebx),%eax
+    117b:	3b 43 14             	cmp    0x14(%ebx),%eax
+    117e:	74 60                	je     11e0 <fgetc+0x80>
+  return f->buf[f->r++] & 0xff;
+    1180:	8b 53 08             	mov    0x8(%ebx),%edx
+    1183:	8d 48 01             	lea    0x1(%eax),%ecx
+    1186:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1189:	0f b6 34 02          	movzbl (%edx,%eax,1),%esi
+  if(threaded)
+    118d:	a1 00 28 00 00       	mov    0x2800,%eax
+    1192:	85 c0                	test   %eax,%eax
+    1194:	75 2a                	jne    11c0 <fgetc+0x60>
+
+  flockfile(f);
+  c = getc_unlocked(f);
+  funlockfile(f);
+  return c;
+}
+    1196:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1199:	89 f0                	mov    %esi,%eax
+    119b:	5b                   	pop    %ebx
+    119c:	5e                   	pop    %esi
+    119d:	5d                   	pop    %ebp
+    119e:	c3                   	ret
+    119f:	90                   	nop
+    mutex_lock(&f->lock);
+    11a0:	83 ec 0c             	sub    $0xc,%esp
+    11a3:	8d 43 18             	lea    0x18(%ebx),%eax
+    11a6:	50                   	push   %eax
+    11a7:	e8 24 f1 ff ff       	call   2d0 <mutex_lock>
+  if(!(f->flags & IO_READ))
+    11ac:	83 c4 10             	add    $0x10,%esp
+    11af:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    11b3:	75 c3                	jne    1178 <fgetc+0x18>
+    return EOF;
+    11b5:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    11ba:	eb d1                	jmp    118d <fgetc+0x2d>
+    11bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    11c0:	83 ec 0c             	sub    $0xc,%esp
+    11c3:	83 c3 18             	add    $0x18,%ebx
+    11c6:	53                   	push   %ebx
+    11c7:	e8 54 f1 ff ff       	call   320 <mutex_unlock>
+    11cc:	83 c4 10             	add    $0x10,%esp
+}
+    11cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    11d2:	89 f0                	mov    %esi,%eax
+    11d4:	5b                   	pop    %ebx
+    11d5:	5e                   	pop    %esi
+    11d6:	5d                   	pop    %ebp
+    11d7:	c3                   	ret
+    11d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11df:	90                   	nop
+  if(f->r == f->n && fill(f) == 0)
+    11e0:	89 d8                	mov    %ebx,%eax
+    11e2:	e8 c9 f8 ff ff       	call   ab0 <fill>
+    11e7:	85 c0                	test   %eax,%eax
+    11e9:	74 ca                	je     11b5 <fgetc+0x55>
+  return f->buf[f->r++] & 0xff;
+    11eb:	8b 43 10             	mov    0x10(%ebx),%eax
+    11ee:	eb 90                	jmp    1180 <fgetc+0x20>
+    return EOF;
+    11f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    11f5:	eb 9f                	jmp    1196 <fgetc+0x36>
+    11f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11fe:	66 90                	xchg   %ax,%ax
+
+00001200 <fread>:
+
+int
+fread(void *p, int size, int nmemb, FILE *f)
+{
+    1200:	55                   	push   %ebp
+    1201:	89 e5                	mov    %esp,%ebp
+    1203:	57                   	push   %edi
+    1204:	56                   	push   %esi
+    1205:	53                   	push   %ebx
+    1206:	83 ec 1c             	sub    $0x1c,%esp
+    1209:	8b 75 14             	mov    0x14(%ebp),%esi
+  char *d;
+  int n, len;
+
+  if(!(f->flags & IO_READ) || size <= 0)
+    120c:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+    1210:	74 7e                	je     1290 <fread+0x90>
+    1212:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1215:	85 d2                	test   %edx,%edx
+    1217:	7e 77                	jle    1290 <fread+0x90>
+  if(threaded)
+    1219:	a1 00 28 00 00       	mov    0x2800,%eax
+    return 0;
+  flockfile(f);
+  d = p;
+  for(len = size*nmemb; len > 0; len -= n){
+    121e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1221:	0f af 7d 10          	imul   0x10(%ebp),%edi
+  if(threaded)
+    1225:	85 c0                	test   %eax,%eax
+    1227:	0f 85 93 00 00 00    	jne    12c0 <fread+0xc0>
+  for(len = size*nmemb; len > 0; len -= n){
+    122d:	85 ff                	test   %edi,%edi
+    122f:	7e 61                	jle    1292 <fread+0x92>
+    if(f->r == f->n && fill(f) == 0)
+    1231:	8b 46 10             	mov    0x10(%esi),%eax
+  d = p;
+    1234:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1237:	eb 35                	jmp    126e <fread+0x6e>
+    1239:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      break;
+    n = f->n - f->r;
+    1240:	29 c3                	sub    %eax,%ebx
+    1242:	39 fb                	cmp    %edi,%ebx
+    1244:	0f 4f df             	cmovg  %edi,%ebx
+    if(n > len)
+      n = len;
+    memmove(d, f->buf + f->r, n);
+    1247:	83 ec 04             	sub    $0x4,%esp
+    124a:	53                   	push   %ebx
+    124b:	03 46 08             	add    0x8(%esi),%eax
+  for(len = size*nmemb; len > 0; len -= n){
+    124e:	29 df                	sub    %ebx,%edi
+    memmove(d, f->buf + f->r, n);
+    1250:	50                   	push   %eax
+    1251:	51                   	push   %ecx
+    1252:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1255:	e8 36 f0 ff ff       	call   290 <memmove>
+    f->r += n;
+    125a:	8b 46 10             	mov    0x10(%esi),%eax
+    d += n;
+    125d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1260:	83 c4 10             	add    $0x10,%esp
+    f->r += n;
+    1263:	01 d8                	add    %ebx,%eax
+    d += n;
+    1265:	01 d9                	add    %ebx,%ecx
+    f->r += n;
+    1267:	89 46 10             	mov    %eax,0x10(%esi)
+  for(len = size*nmemb; len > 0; len -= n){
+    126a:	85 ff                	test   %edi,%edi
+    126c:	7e 32                	jle    12a0 <fread+0xa0>
+    if(f->r == f->n && fill(f) == 0)
+    126e:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1271:	39 c3                	cmp    %eax,%ebx
+    1273:	75 cb                	jne    1240 <fread+0x40>
+    1275:	89 f0                	mov    %esi,%eax
+    1277:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    127a:	e8 31 f8 ff ff       	call   ab0 <fill>
+    127f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1282:	85 c0                	test   %eax,%eax
+    1284:	74 1a                	je     12a0 <fread+0xa0>
+    n = f->n - f->r;
+    1286:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1289:	8b 46 10             	mov    0x10(%esi),%eax
+    128c:	eb b2                	jmp    1240 <fread+0x40>
+    128e:	66 90                	xchg   %ax,%ax
+    return 0;
+    1290:	31 c0                	xor    %eax,%eax
+  }
+  funlockfile(f);
+  return (d - (char*)p) / size;
+}
+    1292:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1295:	5b                   	pop    %ebx
+    1296:	5e                   	pop    %esi
+    1297:	5f                   	pop    %edi
+    1298:	5d                   	pop    %ebp
+    1299:	c3                   	ret
+    129a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (d - (char*)p) / size;
+    12a0:	2b 4d 08             	sub    0x8(%ebp),%ecx
+    12a3:	89 cb                	mov    %ecx,%ebx
+  if(threaded)
+    12a5:	a1 00 28 00 00       	mov    0x2800,%eax
+    12aa:	85 c0                	test   %eax,%eax
+    12ac:	75 32                	jne    12e0 <fread+0xe0>
+  return (d - (char*)p) / size;
+    12ae:	89 d8                	mov    %ebx,%eax
+    12b0:	99                   	cltd
+    12b1:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    12b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12b7:	5b                   	pop    %ebx
+    12b8:	5e                   	pop    %esi
+    12b9:	5f                   	pop    %edi
+    12ba:	5d                   	pop    %ebp
+    12bb:	c3                   	ret
+    12bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    12c0:	83 ec 0c             	sub    $0xc,%esp
+    12c3:	8d 46 18             	lea    0x18(%esi),%eax
+    12c6:	50                   	push   %eax
+    12c7:	e8 04 f0 ff ff       	call   2d0 <mutex_lock>
+  for(len = size*nmemb; len > 0; len -= n){
+    12cc:	83 c4 10             	add    $0x10,%esp
+    12cf:	85 ff                	test   %edi,%edi
+    12d1:	0f 8f 5a ff ff ff    	jg     1231 <fread+0x31>
+    12d7:	31 db                	xor    %ebx,%ebx
+    12d9:	eb ca                	jmp    12a5 <fread+0xa5>
+    12db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12df:	90                   	nop
+    mutex_unlock(&f->lock);
+    12e0:	83 ec 0c             	sub    $0xc,%esp
+    12e3:	83 c6 18             	add    $0x18,%esi
+    12e6:	56                   	push   %esi
+    12e7:	e8 34 f0 ff ff       	call   320 <mutex_unlock>
+  return (d - (char*)p) / size;
+    12ec:	89 d8                	mov    %ebx,%eax
+    12ee:	83 c4 10             	add    $0x10,%esp
+    12f1:	99                   	cltd
+    12f2:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    12f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12f8:	5b                   	pop    %ebx
+    12f9:	5e                   	pop    %esi
+    12fa:	5f                   	pop    %edi
+    12fb:	5d                   	pop    %ebp
+    12fc:	c3                   	ret
+    12fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001300 <fgets>:
+
+// Read a line of at most max-1 bytes, keeping the newline.
+// Returns 0 if there was nothing left to read.
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    1300:	55                   	push   %ebp
+    1301:	89 e5                	mov    %esp,%ebp
+    1303:	57                   	push   %edi
+    1304:	56                   	push   %esi
+    1305:	53                   	push   %ebx
+    1306:	83 ec 1c             	sub    $0x1c,%esp
+  if(threaded)
+    1309:	8b 35 00 28 00 00    	mov    0x2800,%esi
+{
+    130f:	8b 7d 08             	mov    0x8(%ebp),%edi
+    1312:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if(threaded)
+    1315:	85 f6                	test   %esi,%esi
+    1317:	0f 85 83 00 00 00    	jne    13a0 <fgets+0xa0>
+{
+    131d:	31 f6                	xor    %esi,%esi
+    131f:	eb 2a                	jmp    134b <fgets+0x4b>
+    1321:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return f->buf[f->r++] & 0xff;
+    1328:	8b 53 08             	mov    0x8(%ebx),%edx
+    132b:	8d 48 01             	lea    0x1(%eax),%ecx
+    132e:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1331:	0f b6 14 02          	movzbl (%edx,%eax,1),%edx
+
+  flockfile(f);
+  for(i = 0; i+1 < max; ){
+    if((c = getc_unlocked(f)) == EOF)
+      break;
+    buf[i++] = c;
+    1335:	88 54 37 ff          	mov    %dl,-0x1(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    1339:	80 fa 0a             	cmp    $0xa,%dl
+    133c:	0f 84 96 00 00 00    	je     13d8 <fgets+0xd8>
+    1342:	83 fa 0d             	cmp    $0xd,%edx
+    1345:	0f 84 8d 00 00 00    	je     13d8 <fgets+0xd8>
+  for(i = 0; i+1 < max; ){
+    134b:	89 f2                	mov    %esi,%edx
+    134d:	83 c6 01             	add    $0x1,%esi
+    1350:	3b 75 0c             	cmp    0xc(%ebp),%esi
+    1353:	7d 2b                	jge    1380 <fgets+0x80>
+  if(!(f->flags & IO_READ))
+    1355:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1359:	74 25                	je     1380 <fgets+0x80>
+  if(f->r == f->n && fill(f) == 0)
+    135b:	8b 43 10             	mov    0x10(%ebx),%eax
+    135e:	3b 43 14             	cmp    0x14(%ebx),%eax
+    1361:	75 c5                	jne    1328 <fgets+0x28>
+    1363:	89 d8                	mov    %ebx,%eax
+    1365:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1368:	e8 43 f7 ff ff       	call   ab0 <fill>
+    136d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1370:	85 c0                	test   %eax,%eax
+    1372:	74 0c                	je     1380 <fgets+0x80>
+  return f->buf[f->r++] & 0xff;
+    1374:	8b 43 10             	mov    0x10(%ebx),%eax
+    1377:	eb af                	jmp    1328 <fgets+0x28>
+    1379:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1380:	8b 0d 00 28 00 00    	mov    0x2800,%ecx
+      break;
+  }
+  buf[i] = '\0';
+    1386:	c6 04 17 00          	movb   $0x0,(%edi,%edx,1)
+  if(threaded)
+    138a:	85 c9                	test   %ecx,%ecx
+    138c:	75 2a                	jne    13b8 <fgets+0xb8>
+  funlockfile(f);
+  return i > 0 ? buf : 0;
+    138e:	31 c0                	xor    %eax,%eax
+    1390:	85 d2                	test   %edx,%edx
+    1392:	74 02                	je     1396 <fgets+0x96>
+    1394:	89 f8                	mov    %edi,%eax
+}
+    1396:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1399:	5b                   	pop    %ebx
+    139a:	5e                   	pop    %esi
+    139b:	5f                   	pop    %edi
+    139c:	5d                   	pop    %ebp
+    139d:	c3                   	ret
+    139e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    13a0:	83 ec 0c             	sub    $0xc,%esp
+    13a3:	8d 43 18             	lea    0x18(%ebx),%eax
+    13a6:	50                   	push   %eax
+    13a7:	e8 24 ef ff ff       	call   2d0 <mutex_lock>
+    13ac:	83 c4 10             	add    $0x10,%esp
+    13af:	e9 69 ff ff ff       	jmp    131d <fgets+0x1d>
+    13b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    13b8:	83 ec 0c             	sub    $0xc,%esp
+    13bb:	83 c3 18             	add    $0x18,%ebx
+    13be:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    13c1:	53                   	push   %ebx
+    13c2:	e8 59 ef ff ff       	call   320 <mutex_unlock>
+    13c7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    13ca:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    13cd:	31 c0                	xor    %eax,%eax
+    13cf:	85 d2                	test   %edx,%edx
+    13d1:	75 c1                	jne    1394 <fgets+0x94>
+    13d3:	eb c1                	jmp    1396 <fgets+0x96>
+    13d5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    13d8:	a1 00 28 00 00       	mov    0x2800,%eax
+  buf[i] = '\0';
+    13dd:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  if(threaded)
+    13e1:	85 c0                	test   %eax,%eax
+    13e3:	74 af                	je     1394 <fgets+0x94>
+    mutex_unlock(&f->lock);
+    13e5:	83 ec 0c             	sub    $0xc,%esp
+    13e8:	83 c3 18             	add    $0x18,%ebx
+    13eb:	53                   	push   %ebx
+    13ec:	e8 2f ef ff ff       	call   320 <mutex_unlock>
+    13f1:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    13f4:	89 f8                	mov    %edi,%eax
+    13f6:	eb 9e                	jmp    1396 <fgets+0x96>
+    13f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13ff:	90                   	nop
+
+00001400 <gets>:
+// at most a line per read(), goes through stdin's buffer: from a
+// file or pipe, a buffered read could take input meant for a child
+// process, so read a byte at a time.
+char*
+gets(char *buf, int max)
+{
+    1400:	55                   	push   %ebp
+    1401:	89 e5                	mov    %esp,%ebp
+    1403:	57                   	push   %edi
+    1404:	56                   	push   %esi
+    1405:	53                   	push   %ebx
+    1406:	83 ec 2c             	sub    $0x2c,%esp
+  int i, cc;
+  char c;
+
+  if(!(stdin->flags & IO_SETUP))
+    1409:	8b 15 04 27 00 00    	mov    0x2704,%edx
+{
+    140f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!(stdin->flags & IO_SETUP))
+    1412:	f6 c2 40             	test   $0x40,%dl
+    1415:	74 79                	je     1490 <gets+0x90>
+    setup(stdin);
+  if(stdin->flags & IO_DEV){
+    1417:	83 e2 20             	and    $0x20,%edx
+    141a:	89 d7                	mov    %edx,%edi
+    141c:	75 52                	jne    1470 <gets+0x70>
+  if(f == 0){
+    141e:	e8 ed f5 ff ff       	call   a10 <fflush.part.0>
+    fgets(buf, max, stdin);
+    return buf;
+  }
+  fflush(0);
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1423:	8d 75 e7             	lea    -0x19(%ebp),%esi
+  for(i=0; i+1 < max; ){
+    1426:	eb 2c                	jmp    1454 <gets+0x54>
+    1428:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    142f:	90                   	nop
+    cc = read(0, &c, 1);
+    1430:	83 ec 04             	sub    $0x4,%esp
+    1433:	6a 01                	push   $0x1
+    1435:	56                   	push   %esi
+    1436:	6a 00                	push   $0x0
+    1438:	e8 f5 ef ff ff       	call   432 <read>
+    if(cc < 1)
+    143d:	83 c4 10             	add    $0x10,%esp
+    1440:	85 c0                	test   %eax,%eax
+    1442:	7e 1b                	jle    145f <gets+0x5f>
+      break;
+    buf[i++] = c;
+    1444:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1448:	88 44 3b ff          	mov    %al,-0x1(%ebx,%edi,1)
+    if(c == '\n' || c == '\r')
+    144c:	3c 0a                	cmp    $0xa,%al
+    144e:	74 12                	je     1462 <gets+0x62>
+    1450:	3c 0d                	cmp    $0xd,%al
+    1452:	74 0e                	je     1462 <gets+0x62>
+  for(i=0; i+1 < max; ){
+    1454:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    1457:	83 c7 01             	add    $0x1,%edi
+    145a:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+    145d:	7c d1                	jl     1430 <gets+0x30>
+{
+    145f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      break;
+  }
+  buf[i] = '\0';
+    1462:	c6 04 3b 00          	movb   $0x0,(%ebx,%edi,1)
+  return buf;
+}
+    1466:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1469:	89 d8                	mov    %ebx,%eax
+    146b:	5b                   	pop    %ebx
+    146c:	5e                   	pop    %esi
+    146d:	5f                   	pop    %edi
+    146e:	5d                   	pop    %ebp
+    146f:	c3                   	ret
+    fgets(buf, max, stdin);
+    1470:	83 ec 04             	sub    $0x4,%esp
+    1473:	68 00 27 00 00       	push   $0x2700
+    1478:	ff 75 0c             	push   0xc(%ebp)
+    147b:	53                   	push   %ebx
+    147c:	e8 7f fe ff ff       	call   1300 <fgets>
+    return buf;
+    1481:	83 c4 10             	add    $0x10,%esp
+}
+    1484:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1487:	89 d8                	mov    %ebx,%eax
+    1489:	5b                   	pop    %ebx
+    148a:	5e                   	pop    %esi
+    148b:	5f                   	pop    %edi
+    148c:	5d                   	pop    %ebp
+    148d:	c3                   	ret
+    148e:	66 90                	xchg   %ax,%ax
+    setup(stdin);
+    1490:	b8 00 27 00 00       	mov    $0x2700,%eax
+    1495:	e8 a6 f4 ff ff       	call   940 <setup>
+  if(stdin->flags & IO_DEV){
+    149a:	8b 15 04 27 00 00    	mov    0x2704,%edx
+    14a0:	e9 72 ff ff ff       	jmp    1417 <gets+0x17>
+    14a5:	66 90                	xchg   %ax,%ax
+    14a7:	66 90                	xchg   %ax,%ax
+    14a9:	66 90                	xchg   %ax,%ax
+    14ab:	66 90                	xchg   %ax,%ax
+    14ad:	66 90                	xchg   %ax,%ax
+    14af:	90                   	nop
+
+000014b0 <bigfree>:
+
+// Give a big block back to the first-fit list, and return the
+// free block that now holds it. Caller holds lock.
+static Header*
+bigfree(Header *bp)
+{
+    14b0:	55                   	push   %ebp
+    14b1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    14b3:	a1 a4 2e 00 00       	mov    0x2ea4,%eax
+{
+    14b8:	89 e5                	mov    %esp,%ebp
+    14ba:	56                   	push   %esi
+    14bb:	53                   	push   %ebx
+    14bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    14c0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    14c2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    14c4:	39 ca                	cmp    %ecx,%edx
+    14c6:	73 38                	jae    1500 <bigfree+0x50>
+    14c8:	39 c1                	cmp    %eax,%ecx
+    14ca:	72 04                	jb     14d0 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    14cc:	39 c2                	cmp    %eax,%edx
+    14ce:	72 f0                	jb     14c0 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    14d0:	8b 59 04             	mov    0x4(%ecx),%ebx
+    14d3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    14d6:	39 f0                	cmp    %esi,%eax
+    14d8:	74 36                	je     1510 <bigfree+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    14da:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  freep = p;
+  if(p + p->s.size == bp){
+    14dc:	8b 42 04             	mov    0x4(%edx),%eax
+    14df:	89 cb                	mov    %ecx,%ebx
+  freep = p;
+    14e1:	89 15 a4 2e 00 00    	mov    %edx,0x2ea4
+  if(p + p->s.size == bp){
+    14e7:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    14ea:	39 f1                	cmp    %esi,%ecx
+    14ec:	74 2e                	je     151c <bigfree+0x6c>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    14ee:	89 1a                	mov    %ebx,(%edx)
+    return p;
+  }
+  p->s.ptr = bp;
+  return bp;
+}
+    14f0:	89 c8                	mov    %ecx,%eax
+    14f2:	5b                   	pop    %ebx
+    14f3:	5e                   	pop    %esi
+    14f4:	5d                   	pop    %ebp
+    14f5:	c3                   	ret
+    14f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14fd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1500:	39 c1                	cmp    %eax,%ecx
+    1502:	72 c8                	jb     14cc <bigfree+0x1c>
+    1504:	eb ba                	jmp    14c0 <bigfree+0x10>
+    1506:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    150d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1510:	03 58 04             	add    0x4(%eax),%ebx
+    1513:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1516:	8b 02                	mov    (%edx),%eax
+    1518:	8b 00                	mov    (%eax),%eax
+    151a:	eb be                	jmp    14da <bigfree+0x2a>
+    p->s.size += bp->s.size;
+    151c:	03 41 04             	add    0x4(%ecx),%eax
+    151f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1522:	8b 19                	mov    (%ecx),%ebx
+    return p;
+    1524:	89 d1                	mov    %edx,%ecx
+}
+    1526:	89 c8                	mov    %ecx,%eax
+    p->s.ptr = bp->s.ptr;
+    1528:	89 1a                	mov    %ebx,(%edx)
+}
+    152a:	5b                   	pop    %ebx
+    152b:	5e                   	pop    %esi
+    152c:	5d                   	pop    %ebp
+    152d:	c3                   	ret
+    152e:	66 90                	xchg   %ax,%ax
+
+00001530 <trim>:
+// If free block bp ends the heap, return its whole pages to the
+// kernel, unless something else has moved the break since.
+// Caller holds lock.
+static void
+trim(Header *bp)
+{
+    1530:	55                   	push   %ebp
+    1531:	89 e5                	mov    %esp,%ebp
+    1533:	57                   	push   %edi
+    1534:	56                   	push   %esi
+    1535:	53                   	push   %ebx
+    1536:	89 c3                	mov    %eax,%ebx
+    1538:	83 ec 0c             	sub    $0xc,%esp
+  char *end;
+  uint n;
+
+  if((char*)(bp + bp->s.size) != heapend)
+    153b:	8b 53 04             	mov    0x4(%ebx),%edx
+    153e:	a1 a0 2e 00 00       	mov    0x2ea0,%eax
+    1543:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+    1546:	39 d0                	cmp    %edx,%eax
+    1548:	74 0e                	je     1558 <trim+0x28>
+  n = heapend - end;
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    bp->s.size -= n / sizeof(Header);
+    heapend = end;
+  }
+}
+    154a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    154d:	5b                   	pop    %ebx
+    154e:	5e                   	pop    %esi
+    154f:	5f                   	pop    %edi
+    1550:	5d                   	pop    %ebp
+    1551:	c3                   	ret
+    1552:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  end = (char*)PGROUNDUP((uint)(bp + 2));
+    1558:	8d bb 0f 10 00 00    	lea    0x100f(%ebx),%edi
+    155e:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  n = heapend - end;
+    1564:	29 f8                	sub    %edi,%eax
+    1566:	89 c6                	mov    %eax,%esi
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    1568:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    156d:	76 db                	jbe    154a <trim+0x1a>
+    156f:	83 ec 0c             	sub    $0xc,%esp
+    1572:	6a 00                	push   $0x0
+    1574:	e8 8b ef ff ff       	call   504 <sbrk>
+    1579:	83 c4 10             	add    $0x10,%esp
+    157c:	39 05 a0 2e 00 00    	cmp    %eax,0x2ea0
+    1582:	75 c6                	jne    154a <trim+0x1a>
+    1584:	89 f0                	mov    %esi,%eax
+    1586:	83 ec 0c             	sub    $0xc,%esp
+    1589:	f7 d8                	neg    %eax
+    158b:	50                   	push   %eax
+    158c:	e8 73 ef ff ff       	call   504 <sbrk>
+    1591:	83 c4 10             	add    $0x10,%esp
+    1594:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1597:	74 b1                	je     154a <trim+0x1a>
+    bp->s.size -= n / sizeof(Header);
+    1599:	89 f0                	mov    %esi,%eax
+    heapend = end;
+    159b:	89 3d a0 2e 00 00    	mov    %edi,0x2ea0
+    bp->s.size -= n / sizeof(Header);
+    15a1:	c1 e8 03             	shr    $0x3,%eax
+    15a4:	29 43 04             	sub    %eax,0x4(%ebx)
+    heapend = end;
+    15a7:	eb a1                	jmp    154a <trim+0x1a>
+    15a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000015b0 <bigalloc>:
+}
+
+// Allocate a big block of nunits units. Caller holds lock.
+static Header*
+bigalloc(uint nunits)
+{
+    15b0:	55                   	push   %ebp
+    15b1:	89 e5                	mov    %esp,%ebp
+    15b3:	57                   	push   %edi
+    15b4:	89 c7                	mov    %eax,%edi
+    15b6:	56                   	push   %esi
+    15b7:	53                   	push   %ebx
+    15b8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    15bb:	a1 a4 2e 00 00       	mov    0x2ea4,%eax
+    15c0:	85 c0                	test   %eax,%eax
+    15c2:	0f 84 98 00 00 00    	je     1660 <bigalloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    15c8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    15ca:	8b 4a 04             	mov    0x4(%edx),%ecx
+    15cd:	39 f9                	cmp    %edi,%ecx
+    15cf:	73 67                	jae    1638 <bigalloc+0x88>
+  if(nu < 4096)
+    15d1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    15d6:	39 df                	cmp    %ebx,%edi
+    15d8:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    15db:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    15e2:	eb 0d                	jmp    15f1 <bigalloc+0x41>
+    15e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    15e8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    15ea:	8b 4a 04             	mov    0x4(%edx),%ecx
+    15ed:	39 f9                	cmp    %edi,%ecx
+    15ef:	73 47                	jae    1638 <bigalloc+0x88>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    15f1:	89 d0                	mov    %edx,%eax
+    15f3:	39 15 a4 2e 00 00    	cmp    %edx,0x2ea4
+    15f9:	75 ed                	jne    15e8 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    15fb:	83 ec 0c             	sub    $0xc,%esp
+    15fe:	56                   	push   %esi
+    15ff:	e8 00 ef ff ff       	call   504 <sbrk>
+  if(p == (char*)-1)
+    1604:	83 c4 10             	add    $0x10,%esp
+    1607:	83 f8 ff             	cmp    $0xffffffff,%eax
+    160a:	74 1a                	je     1626 <bigalloc+0x76>
+  hp->s.size = nu;
+    160c:	89 58 04             	mov    %ebx,0x4(%eax)
+  heapend = p + nu * sizeof(Header);
+    160f:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    1612:	89 15 a0 2e 00 00    	mov    %edx,0x2ea0
+  bigfree(hp);
+    1618:	e8 93 fe ff ff       	call   14b0 <bigfree>
+  return freep;
+    161d:	a1 a4 2e 00 00       	mov    0x2ea4,%eax
+      if((p = morecore(nunits)) == 0)
+    1622:	85 c0                	test   %eax,%eax
+    1624:	75 c2                	jne    15e8 <bigalloc+0x38>
+        return 0;
+  }
+}
+    1626:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1629:	31 d2                	xor    %edx,%edx
+}
+    162b:	5b                   	pop    %ebx
+    162c:	89 d0                	mov    %edx,%eax
+    162e:	5e                   	pop    %esi
+    162f:	5f                   	pop    %edi
+    1630:	5d                   	pop    %ebp
+    1631:	c3                   	ret
+    1632:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1638:	39 cf                	cmp    %ecx,%edi
+    163a:	74 54                	je     1690 <bigalloc+0xe0>
+        p->s.size -= nunits;
+    163c:	29 f9                	sub    %edi,%ecx
+    163e:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    1641:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    1644:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    1647:	a3 a4 2e 00 00       	mov    %eax,0x2ea4
+}
+    164c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    164f:	89 d0                	mov    %edx,%eax
+    1651:	5b                   	pop    %ebx
+    1652:	5e                   	pop    %esi
+    1653:	5f                   	pop    %edi
+    1654:	5d                   	pop    %ebp
+    1655:	c3                   	ret
+    1656:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    165d:	8d 76 00             	lea    0x0(%esi),%esi
+    base.s.ptr = freep = prevp = &base;
+    1660:	c7 05 a4 2e 00 00 a8 	movl   $0x2ea8,0x2ea4
+    1667:	2e 00 00 
+    base.s.size = 0;
+    166a:	ba a8 2e 00 00       	mov    $0x2ea8,%edx
+    base.s.ptr = freep = prevp = &base;
+    166f:	c7 05 a8 2e 00 00 a8 	movl   $0x2ea8,0x2ea8
+    1676:	2e 00 00 
+    base.s.size = 0;
+    1679:	c7 05 ac 2e 00 00 00 	movl   $0x0,0x2eac
+    1680:	00 00 00 
+    if(p->s.size >= nunits){
+    1683:	e9 49 ff ff ff       	jmp    15d1 <bigalloc+0x21>
+    1688:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    168f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1690:	8b 0a                	mov    (%edx),%ecx
+    1692:	89 08                	mov    %ecx,(%eax)
+    1694:	eb b1                	jmp    1647 <bigalloc+0x97>
+    1696:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    169d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000016a0 <drain>:
+}
+
+// Move n blocks of class c from cache tc to the shared list.
+static void
+drain(struct tcache *tc, int c, int n)
+{
+    16a0:	55                   	push   %ebp
+    16a1:	89 e5                	mov    %esp,%ebp
+    16a3:	57                   	push   %edi
+    16a4:	89 c7                	mov    %eax,%edi
+    16a6:	56                   	push   %esi
+    16a7:	89 d6                	mov    %edx,%esi
+    16a9:	53                   	push   %ebx
+    16aa:	89 cb                	mov    %ecx,%ebx
+    16ac:	83 ec 0c             	sub    $0xc,%esp
+  if(threaded)
+    16af:	8b 15 24 2e 00 00    	mov    0x2e24,%edx
+    16b5:	85 d2                	test   %edx,%edx
+    16b7:	75 57                	jne    1710 <drain+0x70>
+  Header *p;
+
+  acquire();
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    16b9:	85 c9                	test   %ecx,%ecx
+    16bb:	7e 49                	jle    1706 <drain+0x66>
+    16bd:	89 d9                	mov    %ebx,%ecx
+    16bf:	8d 14 b7             	lea    (%edi,%esi,4),%edx
+    16c2:	eb 23                	jmp    16e7 <drain+0x47>
+    16c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    tc->list[c] = p->s.ptr;
+    16c8:	8b 18                	mov    (%eax),%ebx
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    16ca:	83 e9 01             	sub    $0x1,%ecx
+    tc->n[c]--;
+    16cd:	83 6a 20 01          	subl   $0x1,0x20(%edx)
+    tc->list[c] = p->s.ptr;
+    16d1:	89 1a                	mov    %ebx,(%edx)
+    p->s.ptr = small[c];
+    16d3:	8b 1c b5 80 2e 00 00 	mov    0x2e80(,%esi,4),%ebx
+    16da:	89 18                	mov    %ebx,(%eax)
+    small[c] = p;
+    16dc:	89 04 b5 80 2e 00 00 	mov    %eax,0x2e80(,%esi,4)
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    16e3:	85 c9                	test   %ecx,%ecx
+    16e5:	7e 06                	jle    16ed <drain+0x4d>
+    16e7:	8b 02                	mov    (%edx),%eax
+    16e9:	85 c0                	test   %eax,%eax
+    16eb:	75 db                	jne    16c8 <drain+0x28>
+  if(threaded)
+    16ed:	a1 24 2e 00 00       	mov    0x2e24,%eax
+    16f2:	85 c0                	test   %eax,%eax
+    16f4:	74 10                	je     1706 <drain+0x66>
+    mutex_unlock(&lock);
+    16f6:	83 ec 0c             	sub    $0xc,%esp
+    16f9:	68 28 2e 00 00       	push   $0x2e28
+    16fe:	e8 1d ec ff ff       	call   320 <mutex_unlock>
+}
+    1703:	83 c4 10             	add    $0x10,%esp
+  }
+  release();
+}
+    1706:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1709:	5b                   	pop    %ebx
+    170a:	5e                   	pop    %esi
+    170b:	5f                   	pop    %edi
+    170c:	5d                   	pop    %ebp
+    170d:	c3                   	ret
+    170e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&lock);
+    1710:	83 ec 0c             	sub    $0xc,%esp
+    1713:	68 28 2e 00 00       	push   $0x2e28
+    1718:	e8 b3 eb ff ff       	call   2d0 <mutex_lock>
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    171d:	83 c4 10             	add    $0x10,%esp
+    1720:	85 db                	test   %ebx,%ebx
+    1722:	7f 99                	jg     16bd <drain+0x1d>
+    1724:	eb c7                	jmp    16ed <drain+0x4d>
+    1726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    172d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001730 <mycache>:
+{
+    1730:	55                   	push   %ebp
+    return &maincache;
+    1731:	b8 40 2e 00 00       	mov    $0x2e40,%eax
+{
+    1736:	89 e5                	mov    %esp,%ebp
+    1738:	53                   	push   %ebx
+  sp = PGROUNDDOWN((uint)&sp);
+    1739:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+    173c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+    1742:	83 ec 14             	sub    $0x14,%esp
+  if(!threaded || sp == mainstack)
+    1745:	8b 0d 24 2e 00 00    	mov    0x2e24,%ecx
+  sp = PGROUNDDOWN((uint)&sp);
+    174b:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  if(!threaded || sp == mainstack)
+    174e:	85 c9                	test   %ecx,%ecx
+    1750:	74 0f                	je     1761 <mycache+0x31>
+    1752:	3b 1d 20 2e 00 00    	cmp    0x2e20,%ebx
+    1758:	74 07                	je     1761 <mycache+0x31>
+  if(*cp == 0){
+    175a:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    175d:	85 c0                	test   %eax,%eax
+    175f:	74 0f                	je     1770 <mycache+0x40>
+}
+    1761:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1764:	c9                   	leave
+    1765:	c3                   	ret
+    1766:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    176d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1770:	83 ec 0c             	sub    $0xc,%esp
+    1773:	68 28 2e 00 00       	push   $0x2e28
+    1778:	e8 53 eb ff ff       	call   2d0 <mutex_lock>
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    177d:	b8 09 00 00 00       	mov    $0x9,%eax
+    1782:	e8 29 fe ff ff       	call   15b0 <bigalloc>
+  if(threaded)
+    1787:	8b 15 24 2e 00 00    	mov    0x2e24,%edx
+    178d:	83 c4 10             	add    $0x10,%esp
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    1790:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(threaded)
+    1793:	85 d2                	test   %edx,%edx
+    1795:	75 29                	jne    17c0 <mycache+0x90>
+    if(*cp == 0)
+    1797:	85 c0                	test   %eax,%eax
+    1799:	74 c6                	je     1761 <mycache+0x31>
+    memset(*cp, 0, sizeof(**cp));
+    179b:	83 ec 04             	sub    $0x4,%esp
+    *cp = (struct tcache*)((Header*)*cp + 1);
+    179e:	83 c0 08             	add    $0x8,%eax
+    17a1:	89 43 f8             	mov    %eax,-0x8(%ebx)
+    memset(*cp, 0, sizeof(**cp));
+    17a4:	6a 40                	push   $0x40
+    17a6:	6a 00                	push   $0x0
+    17a8:	50                   	push   %eax
+    17a9:	e8 f2 e9 ff ff       	call   1a0 <memset>
+  return *cp;
+    17ae:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    17b1:	83 c4 10             	add    $0x10,%esp
+    17b4:	eb ab                	jmp    1761 <mycache+0x31>
+    17b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17bd:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    17c0:	83 ec 0c             	sub    $0xc,%esp
+    17c3:	68 28 2e 00 00       	push   $0x2e28
+    17c8:	e8 53 eb ff ff       	call   320 <mutex_unlock>
+    if(*cp == 0)
+    17cd:	8b 43 f8             	mov    -0x8(%ebx),%eax
+}
+    17d0:	83 c4 10             	add    $0x10,%esp
+    17d3:	eb c2                	jmp    1797 <mycache+0x67>
+    17d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000017e0 <free>:
+
+void
+free(void *ap)
+{
+    17e0:	55                   	push   %ebp
+    17e1:	89 e5                	mov    %esp,%ebp
+    17e3:	57                   	push   %edi
+    17e4:	56                   	push   %esi
+    17e5:	53                   	push   %ebx
+    17e6:	83 ec 1c             	sub    $0x1c,%esp
+    17e9:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  struct tcache *tc;
+  int c;
+
+  if(ap == 0)
+    17ec:	85 f6                	test   %esi,%esi
+    17ee:	74 51                	je     1841 <free+0x61>
+    return;
+  bp = (Header*)ap - 1;
+    17f0:	8d 46 f8             	lea    -0x8(%esi),%eax
+    17f3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(bp->s.size > SMALLMAX / sizeof(Header)){
+    17f6:	8b 46 fc             	mov    -0x4(%esi),%eax
+    17f9:	3d 00 01 00 00       	cmp    $0x100,%eax
+    17fe:	77 50                	ja     1850 <free+0x70>
+    acquire();
+    trim(bigfree(bp));
+    release();
+    return;
+  }
+  for(c = 0; (2 << c) < bp->s.size; c++)
+    1800:	31 db                	xor    %ebx,%ebx
+    1802:	ba 02 00 00 00       	mov    $0x2,%edx
+    1807:	83 f8 02             	cmp    $0x2,%eax
+    180a:	76 11                	jbe    181d <free+0x3d>
+    180c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1810:	83 c3 01             	add    $0x1,%ebx
+    1813:	89 d7                	mov    %edx,%edi
+    1815:	89 d9                	mov    %ebx,%ecx
+    1817:	d3 e7                	shl    %cl,%edi
+    1819:	39 c7                	cmp    %eax,%edi
+    181b:	72 f3                	jb     1810 <free+0x30>
+    ;
+  if((tc = mycache()) == 0){
+    181d:	e8 0e ff ff ff       	call   1730 <mycache>
+    1822:	85 c0                	test   %eax,%eax
+    1824:	74 7a                	je     18a0 <free+0xc0>
+    bp->s.ptr = small[c];
+    small[c] = bp;
+    release();
+    return;
+  }
+  bp->s.ptr = tc->list[c];
+    1826:	8d 0c 98             	lea    (%eax,%ebx,4),%ecx
+    1829:	8b 11                	mov    (%ecx),%edx
+    182b:	89 56 f8             	mov    %edx,-0x8(%esi)
+  tc->list[c] = bp;
+    182e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1831:	89 31                	mov    %esi,(%ecx)
+  if(++tc->n[c] > TCACHEMAX)
+    1833:	8b 71 20             	mov    0x20(%ecx),%esi
+    1836:	8d 56 01             	lea    0x1(%esi),%edx
+    1839:	89 51 20             	mov    %edx,0x20(%ecx)
+    183c:	83 fa 20             	cmp    $0x20,%edx
+    183f:	7f 47                	jg     1888 <free+0xa8>
+    drain(tc, c, BATCH);
+}
+    1841:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1844:	5b                   	pop    %ebx
+    1845:	5e                   	pop    %esi
+    1846:	5f                   	pop    %edi
+    1847:	5d                   	pop    %ebp
+    1848:	c3                   	ret
+    1849:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1850:	8b 1d 24 2e 00 00    	mov    0x2e24,%ebx
+    1856:	85 db                	test   %ebx,%ebx
+    1858:	75 66                	jne    18c0 <free+0xe0>
+    trim(bigfree(bp));
+    185a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    185d:	e8 4e fc ff ff       	call   14b0 <bigfree>
+    1862:	e8 c9 fc ff ff       	call   1530 <trim>
+  if(threaded)
+    1867:	8b 0d 24 2e 00 00    	mov    0x2e24,%ecx
+    186d:	85 c9                	test   %ecx,%ecx
+    186f:	74 d0                	je     1841 <free+0x61>
+    mutex_unlock(&lock);
+    1871:	c7 45 08 28 2e 00 00 	movl   $0x2e28,0x8(%ebp)
+}
+    1878:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    187b:	5b                   	pop    %ebx
+    187c:	5e                   	pop    %esi
+    187d:	5f                   	pop    %edi
+    187e:	5d                   	pop    %ebp
+    mutex_unlock(&lock);
+    187f:	e9 9c ea ff ff       	jmp    320 <mutex_unlock>
+    1884:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    1888:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    drain(tc, c, BATCH);
+    188b:	89 da                	mov    %ebx,%edx
+    188d:	b9 10 00 00 00       	mov    $0x10,%ecx
+}
+    1892:	5b                   	pop    %ebx
+    1893:	5e                   	pop    %esi
+    1894:	5f                   	pop    %edi
+    1895:	5d                   	pop    %ebp
+    drain(tc, c, BATCH);
+    1896:	e9 05 fe ff ff       	jmp    16a0 <drain>
+    189b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    189f:	90                   	nop
+  if(threaded)
+    18a0:	8b 15 24 2e 00 00    	mov    0x2e24,%edx
+    18a6:	85 d2                	test   %edx,%edx
+    18a8:	75 28                	jne    18d2 <free+0xf2>
+    bp->s.ptr = small[c];
+    18aa:	8b 04 9d 80 2e 00 00 	mov    0x2e80(,%ebx,4),%eax
+    18b1:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    18b4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    18b7:	89 04 9d 80 2e 00 00 	mov    %eax,0x2e80(,%ebx,4)
+  if(threaded)
+    18be:	eb 81                	jmp    1841 <free+0x61>
+    mutex_lock(&lock);
+    18c0:	83 ec 0c             	sub    $0xc,%esp
+    18c3:	68 28 2e 00 00       	push   $0x2e28
+    18c8:	e8 03 ea ff ff       	call   2d0 <mutex_lock>
+}
+    18cd:	83 c4 10             	add    $0x10,%esp
+    18d0:	eb 88                	jmp    185a <free+0x7a>
+    mutex_lock(&lock);
+    18d2:	83 ec 0c             	sub    $0xc,%esp
+    18d5:	68 28 2e 00 00       	push   $0x2e28
+    18da:	e8 f1 e9 ff ff       	call   2d0 <mutex_lock>
+    bp->s.ptr = small[c];
+    18df:	8b 04 9d 80 2e 00 00 	mov    0x2e80(,%ebx,4),%eax
+  if(threaded)
+    18e6:	83 c4 10             	add    $0x10,%esp
+    bp->s.ptr = small[c];
+    18e9:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    18ec:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    18ef:	89 04 9d 80 2e 00 00 	mov    %eax,0x2e80(,%ebx,4)
+  if(threaded)
+    18f6:	a1 24 2e 00 00       	mov    0x2e24,%eax
+    18fb:	85 c0                	test   %eax,%eax
+    18fd:	0f 85 6e ff ff ff    	jne    1871 <free+0x91>
+    1903:	e9 39 ff ff ff       	jmp    1841 <free+0x61>
+    1908:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    190f:	90                   	nop
+
+00001910 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1910:	55                   	push   %ebp
+    1911:	89 e5                	mov    %esp,%ebp
+    1913:	57                   	push   %edi
+    1914:	56                   	push   %esi
+    1915:	53                   	push   %ebx
+    1916:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  struct tcache *tc;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1919:	8b 45 08             	mov    0x8(%ebp),%eax
+    191c:	8d 78 07             	lea    0x7(%eax),%edi
+    191f:	c1 ef 03             	shr    $0x3,%edi
+    1922:	83 c7 01             	add    $0x1,%edi
+  if(nunits > SMALLMAX / sizeof(Header)){
+    1925:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+    192b:	77 5b                	ja     1988 <malloc+0x78>
+    acquire();
+    p = bigalloc(nunits);
+    release();
+    return p ? (void*)(p + 1) : 0;
+  }
+  for(c = 0; (2 << c) < nunits; c++)
+    192d:	31 c9                	xor    %ecx,%ecx
+    192f:	b8 02 00 00 00       	mov    $0x2,%eax
+    1934:	be 02 00 00 00       	mov    $0x2,%esi
+    1939:	bb 02 00 00 00       	mov    $0x2,%ebx
+    193e:	83 ff 02             	cmp    $0x2,%edi
+    1941:	76 12                	jbe    1955 <malloc+0x45>
+    1943:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1947:	90                   	nop
+    1948:	83 c1 01             	add    $0x1,%ecx
+    194b:	89 c3                	mov    %eax,%ebx
+    194d:	d3 e3                	shl    %cl,%ebx
+    194f:	89 de                	mov    %ebx,%esi
+    1951:	39 fb                	cmp    %edi,%ebx
+    1953:	72 f3                	jb     1948 <malloc+0x38>
+    1955:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    ;
+  if((tc = mycache()) == 0)
+    1958:	e8 d3 fd ff ff       	call   1730 <mycache>
+    195d:	85 c0                	test   %eax,%eax
+    195f:	74 51                	je     19b2 <malloc+0xa2>
+    return 0;
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1961:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1964:	8d 3c 88             	lea    (%eax,%ecx,4),%edi
+    1967:	8b 07                	mov    (%edi),%eax
+    1969:	85 c0                	test   %eax,%eax
+    196b:	74 53                	je     19c0 <malloc+0xb0>
+    return 0;
+  p = tc->list[c];
+  tc->list[c] = p->s.ptr;
+  tc->n[c]--;
+    196d:	8b 57 20             	mov    0x20(%edi),%edx
+  tc->list[c] = p->s.ptr;
+    1970:	8b 08                	mov    (%eax),%ecx
+  tc->n[c]--;
+    1972:	83 ea 01             	sub    $0x1,%edx
+  return (void*)(p + 1);
+    1975:	83 c0 08             	add    $0x8,%eax
+  tc->n[c]--;
+    1978:	89 57 20             	mov    %edx,0x20(%edi)
+  tc->list[c] = p->s.ptr;
+    197b:	89 0f                	mov    %ecx,(%edi)
+}
+    197d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1980:	5b                   	pop    %ebx
+    1981:	5e                   	pop    %esi
+    1982:	5f                   	pop    %edi
+    1983:	5d                   	pop    %ebp
+    1984:	c3                   	ret
+    1985:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1988:	a1 24 2e 00 00       	mov    0x2e24,%eax
+    198d:	85 c0                	test   %eax,%eax
+    198f:	0f 85 b3 00 00 00    	jne    1a48 <malloc+0x138>
+    p = bigalloc(nunits);
+    1995:	89 f8                	mov    %edi,%eax
+    1997:	e8 14 fc ff ff       	call   15b0 <bigalloc>
+    199c:	89 c3                	mov    %eax,%ebx
+  if(threaded)
+    199e:	a1 24 2e 00 00       	mov    0x2e24,%eax
+    19a3:	85 c0                	test   %eax,%eax
+    19a5:	0f 85 85 00 00 00    	jne    1a30 <malloc+0x120>
+    return p ? (void*)(p + 1) : 0;
+    19ab:	8d 43 08             	lea    0x8(%ebx),%eax
+    19ae:	85 db                	test   %ebx,%ebx
+    19b0:	75 cb                	jne    197d <malloc+0x6d>
+    19b2:	31 c0                	xor    %eax,%eax
+}
+    19b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19b7:	5b                   	pop    %ebx
+    19b8:	5e                   	pop    %esi
+    19b9:	5f                   	pop    %edi
+    19ba:	5d                   	pop    %ebp
+    19bb:	c3                   	ret
+    19bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    19c0:	a1 24 2e 00 00       	mov    0x2e24,%eax
+    19c5:	85 c0                	test   %eax,%eax
+    19c7:	0f 85 29 01 00 00    	jne    1af6 <malloc+0x1e6>
+  if(small[c] == 0){
+    19cd:	8b 04 8d 80 2e 00 00 	mov    0x2e80(,%ecx,4),%eax
+    19d4:	85 c0                	test   %eax,%eax
+    19d6:	0f 84 81 00 00 00    	je     1a5d <malloc+0x14d>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    19dc:	31 db                	xor    %ebx,%ebx
+    19de:	eb 22                	jmp    1a02 <malloc+0xf2>
+    small[c] = p->s.ptr;
+    19e0:	8b 10                	mov    (%eax),%edx
+  for(moved = 0; moved < n && small[c]; moved++){
+    19e2:	83 c3 01             	add    $0x1,%ebx
+    small[c] = p->s.ptr;
+    19e5:	89 14 8d 80 2e 00 00 	mov    %edx,0x2e80(,%ecx,4)
+    p->s.ptr = tc->list[c];
+    19ec:	8b 17                	mov    (%edi),%edx
+    19ee:	89 10                	mov    %edx,(%eax)
+    tc->list[c] = p;
+    19f0:	89 07                	mov    %eax,(%edi)
+  for(moved = 0; moved < n && small[c]; moved++){
+    19f2:	83 fb 10             	cmp    $0x10,%ebx
+    19f5:	0f 84 e2 00 00 00    	je     1add <malloc+0x1cd>
+    19fb:	8b 04 8d 80 2e 00 00 	mov    0x2e80(,%ecx,4),%eax
+    1a02:	85 c0                	test   %eax,%eax
+    1a04:	75 da                	jne    19e0 <malloc+0xd0>
+  if(threaded)
+    1a06:	8b 15 24 2e 00 00    	mov    0x2e24,%edx
+    1a0c:	85 d2                	test   %edx,%edx
+    1a0e:	0f 85 b4 00 00 00    	jne    1ac8 <malloc+0x1b8>
+  tc->n[c] += moved;
+    1a14:	8b 57 20             	mov    0x20(%edi),%edx
+    1a17:	01 da                	add    %ebx,%edx
+    1a19:	89 57 20             	mov    %edx,0x20(%edi)
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1a1c:	85 db                	test   %ebx,%ebx
+    1a1e:	74 92                	je     19b2 <malloc+0xa2>
+  p = tc->list[c];
+    1a20:	8b 07                	mov    (%edi),%eax
+    1a22:	e9 49 ff ff ff       	jmp    1970 <malloc+0x60>
+    1a27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a2e:	66 90                	xchg   %ax,%ax
+    mutex_unlock(&lock);
+    1a30:	83 ec 0c             	sub    $0xc,%esp
+    1a33:	68 28 2e 00 00       	push   $0x2e28
+    1a38:	e8 e3 e8 ff ff       	call   320 <mutex_unlock>
+}
+    1a3d:	83 c4 10             	add    $0x10,%esp
+    1a40:	e9 66 ff ff ff       	jmp    19ab <malloc+0x9b>
+    1a45:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1a48:	83 ec 0c             	sub    $0xc,%esp
+    1a4b:	68 28 2e 00 00       	push   $0x2e28
+    1a50:	e8 7b e8 ff ff       	call   2d0 <mutex_lock>
+}
+    1a55:	83 c4 10             	add    $0x10,%esp
+    1a58:	e9 38 ff ff ff       	jmp    1995 <malloc+0x85>
+    if((chunk = bigalloc(CHUNK / sizeof(Header) + 1)) == 0){
+    1a5d:	b8 01 02 00 00       	mov    $0x201,%eax
+    1a62:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1a65:	e8 46 fb ff ff       	call   15b0 <bigalloc>
+    1a6a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1a6d:	85 c0                	test   %eax,%eax
+    1a6f:	89 c2                	mov    %eax,%edx
+    1a71:	0f 84 ba 00 00 00    	je     1b31 <malloc+0x221>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1a77:	83 c2 08             	add    $0x8,%edx
+    1a7a:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+    1a80:	0f 87 d0 00 00 00    	ja     1b56 <malloc+0x246>
+    1a86:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+    1a8d:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    1a90:	89 df                	mov    %ebx,%edi
+    1a92:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1a95:	8d 76 00             	lea    0x0(%esi),%esi
+      p->s.size = units;
+    1a98:	89 72 04             	mov    %esi,0x4(%edx)
+      p->s.ptr = small[c];
+    1a9b:	8b 04 8d 80 2e 00 00 	mov    0x2e80(,%ecx,4),%eax
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1aa2:	01 df                	add    %ebx,%edi
+    1aa4:	89 55 e0             	mov    %edx,-0x20(%ebp)
+      p->s.ptr = small[c];
+    1aa7:	89 02                	mov    %eax,(%edx)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1aa9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      small[c] = p;
+    1aac:	89 14 8d 80 2e 00 00 	mov    %edx,0x2e80(,%ecx,4)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1ab3:	01 c2                	add    %eax,%edx
+    1ab5:	81 ff 00 02 00 00    	cmp    $0x200,%edi
+    1abb:	76 db                	jbe    1a98 <malloc+0x188>
+    1abd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1ac0:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1ac3:	e9 14 ff ff ff       	jmp    19dc <malloc+0xcc>
+    mutex_unlock(&lock);
+    1ac8:	83 ec 0c             	sub    $0xc,%esp
+    1acb:	68 28 2e 00 00       	push   $0x2e28
+    1ad0:	e8 4b e8 ff ff       	call   320 <mutex_unlock>
+}
+    1ad5:	83 c4 10             	add    $0x10,%esp
+    1ad8:	e9 37 ff ff ff       	jmp    1a14 <malloc+0x104>
+  if(threaded)
+    1add:	a1 24 2e 00 00       	mov    0x2e24,%eax
+    1ae2:	85 c0                	test   %eax,%eax
+    1ae4:	75 2b                	jne    1b11 <malloc+0x201>
+  tc->n[c] += moved;
+    1ae6:	8b 47 20             	mov    0x20(%edi),%eax
+    1ae9:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1aec:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1aee:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1af1:	e9 7a fe ff ff       	jmp    1970 <malloc+0x60>
+    mutex_lock(&lock);
+    1af6:	83 ec 0c             	sub    $0xc,%esp
+    1af9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1afc:	68 28 2e 00 00       	push   $0x2e28
+    1b01:	e8 ca e7 ff ff       	call   2d0 <mutex_lock>
+}
+    1b06:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1b09:	83 c4 10             	add    $0x10,%esp
+    1b0c:	e9 bc fe ff ff       	jmp    19cd <malloc+0xbd>
+    mutex_unlock(&lock);
+    1b11:	83 ec 0c             	sub    $0xc,%esp
+    1b14:	68 28 2e 00 00       	push   $0x2e28
+    1b19:	e8 02 e8 ff ff       	call   320 <mutex_unlock>
+  tc->n[c] += moved;
+    1b1e:	8b 47 20             	mov    0x20(%edi),%eax
+    1b21:	83 c4 10             	add    $0x10,%esp
+    1b24:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1b27:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1b29:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1b2c:	e9 3f fe ff ff       	jmp    1970 <malloc+0x60>
+  if(threaded)
+    1b31:	8b 0d 24 2e 00 00    	mov    0x2e24,%ecx
+    1b37:	85 c9                	test   %ecx,%ecx
+    1b39:	0f 84 73 fe ff ff    	je     19b2 <malloc+0xa2>
+    mutex_unlock(&lock);
+    1b3f:	83 ec 0c             	sub    $0xc,%esp
+    1b42:	68 28 2e 00 00       	push   $0x2e28
+    1b47:	e8 d4 e7 ff ff       	call   320 <mutex_unlock>
+    1b4c:	83 c4 10             	add    $0x10,%esp
+    return p ? (void*)(p + 1) : 0;
+    1b4f:	31 c0                	xor    %eax,%eax
+    1b51:	e9 5e fe ff ff       	jmp    19b4 <malloc+0xa4>
+  for(moved = 0; moved < n && small[c]; moved++){
+    1b56:	8b 04 8d 80 2e 00 00 	mov    0x2e80(,%ecx,4),%eax
+    1b5d:	e9 7a fe ff ff       	jmp    19dc <malloc+0xcc>
+    1b62:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001b70 <malloc_threaded>:
+void
+malloc_threaded(void)
+{
+  uint sp;
+
+  if(threaded)
+    1b70:	a1 24 2e 00 00       	mov    0x2e24,%eax
+    1b75:	85 c0                	test   %eax,%eax
+    1b77:	74 07                	je     1b80 <malloc_threaded+0x10>
+    1b79:	c3                   	ret
+    1b7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+{
+    1b80:	55                   	push   %ebp
+    1b81:	89 e5                	mov    %esp,%ebp
+    1b83:	83 ec 24             	sub    $0x24,%esp
+    return;
+  mutex_init(&lock);
+    1b86:	68 28 2e 00 00       	push   $0x2e28
+    1b8b:	e8 30 e7 ff ff       	call   2c0 <mutex_init>
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1b90:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1b93:	83 c4 10             	add    $0x10,%esp
+  threaded = 1;
+    1b96:	c7 05 24 2e 00 00 01 	movl   $0x1,0x2e24
+    1b9d:	00 00 00 
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1ba0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    1ba5:	a3 20 2e 00 00       	mov    %eax,0x2e20
+}
+    1baa:	c9                   	leave
+    1bab:	c3                   	ret
+    1bac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001bb0 <malloc_thread_exit>:
+
+// Called by thread_join() with the cache slot of a finished
+// thread: give its blocks, and the cache itself, back.
+void
+malloc_thread_exit(void **cachep)
+{
+    1bb0:	55                   	push   %ebp
+    1bb1:	89 e5                	mov    %esp,%ebp
+    1bb3:	57                   	push   %edi
+    1bb4:	56                   	push   %esi
+    1bb5:	53                   	push   %ebx
+    1bb6:	83 ec 0c             	sub    $0xc,%esp
+    1bb9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct tcache *tc;
+  int c;
+
+  if((tc = *cachep) == 0)
+    1bbc:	8b 37                	mov    (%edi),%esi
+    1bbe:	85 f6                	test   %esi,%esi
+    1bc0:	74 41                	je     1c03 <malloc_thread_exit+0x53>
+    return;
+  for(c = 0; c < NCLASS; c++)
+    1bc2:	31 db                	xor    %ebx,%ebx
+    1bc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    drain(tc, c, tc->n[c]);
+    1bc8:	8b 4c 9e 20          	mov    0x20(%esi,%ebx,4),%ecx
+    1bcc:	89 da                	mov    %ebx,%edx
+    1bce:	89 f0                	mov    %esi,%eax
+  for(c = 0; c < NCLASS; c++)
+    1bd0:	83 c3 01             	add    $0x1,%ebx
+    drain(tc, c, tc->n[c]);
+    1bd3:	e8 c8 fa ff ff       	call   16a0 <drain>
+  for(c = 0; c < NCLASS; c++)
+    1bd8:	83 fb 08             	cmp    $0x8,%ebx
+    1bdb:	75 eb                	jne    1bc8 <malloc_thread_exit+0x18>
+  if(threaded)
+    1bdd:	8b 15 24 2e 00 00    	mov    0x2e24,%edx
+    1be3:	85 d2                	test   %edx,%edx
+    1be5:	75 29                	jne    1c10 <malloc_thread_exit+0x60>
+  acquire();
+  trim(bigfree((Header*)tc - 1));
+    1be7:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1bea:	e8 c1 f8 ff ff       	call   14b0 <bigfree>
+    1bef:	e8 3c f9 ff ff       	call   1530 <trim>
+  if(threaded)
+    1bf4:	a1 24 2e 00 00       	mov    0x2e24,%eax
+    1bf9:	85 c0                	test   %eax,%eax
+    1bfb:	75 2b                	jne    1c28 <malloc_thread_exit+0x78>
+  release();
+  *cachep = 0;
+    1bfd:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+}
+    1c03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c06:	5b                   	pop    %ebx
+    1c07:	5e                   	pop    %esi
+    1c08:	5f                   	pop    %edi
+    1c09:	5d                   	pop    %ebp
+    1c0a:	c3                   	ret
+    1c0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1c0f:	90                   	nop
+    mutex_lock(&lock);
+    1c10:	83 ec 0c             	sub    $0xc,%esp
+    1c13:	68 28 2e 00 00       	push   $0x2e28
+    1c18:	e8 b3 e6 ff ff       	call   2d0 <mutex_lock>
+}
+    1c1d:	83 c4 10             	add    $0x10,%esp
+    1c20:	eb c5                	jmp    1be7 <malloc_thread_exit+0x37>
+    1c22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1c28:	83 ec 0c             	sub    $0xc,%esp
+    1c2b:	68 28 2e 00 00       	push   $0x2e28
+    1c30:	e8 eb e6 ff ff       	call   320 <mutex_unlock>
+}
+    1c35:	83 c4 10             	add    $0x10,%esp
+    1c38:	eb c3                	jmp    1bfd <malloc_thread_exit+0x4d>
+    1c3a:	66 90                	xchg   %ax,%ax
+    1c3c:	66 90                	xchg   %ax,%ax
+    1c3e:	66 90                	xchg   %ax,%ax
+
+00001c40 <thread_create>:
+
+// Start fn(arg) in a new thread on a freshly allocated
+// page-aligned stack.  Returns the thread's pid.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1c40:	55                   	push   %ebp
+    1c41:	89 e5                	mov    %esp,%ebp
+    1c43:	53                   	push   %ebx
+    1c44:	83 ec 14             	sub    $0x14,%esp
+  char *mem, *stack;
+  int pid;
+
+  malloc_threaded();
+    1c47:	e8 24 ff ff ff       	call   1b70 <malloc_threaded>
+  stdio_threaded();
+    1c4c:	e8 cf ee ff ff       	call   b20 <stdio_threaded>
+  if((mem = malloc(2*PGSIZE)) == 0)
+    1c51:	83 ec 0c             	sub    $0xc,%esp
+    1c54:	68 00 20 00 00       	push   $0x2000
+    1c59:	e8 b2 fc ff ff       	call   1910 <malloc>
+    1c5e:	83 c4 10             	add    $0x10,%esp
+    1c61:	85 c0                	test   %eax,%eax
+    1c63:	74 52                	je     1cb7 <thread_create+0x77>
+    1c65:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1c67:	8d 80 07 10 00 00    	lea    0x1007(%eax),%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+  ((char**)stack)[-2] = 0;
+  if((pid = clone(fn, arg, stack)) < 0)
+    1c6d:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1c70:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+    1c75:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  ((char**)stack)[-2] = 0;
+    1c78:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+  if((pid = clone(fn, arg, stack)) < 0)
+    1c7f:	50                   	push   %eax
+    1c80:	ff 75 0c             	push   0xc(%ebp)
+    1c83:	ff 75 08             	push   0x8(%ebp)
+    1c86:	e8 97 e8 ff ff       	call   522 <clone>
+    1c8b:	83 c4 10             	add    $0x10,%esp
+    1c8e:	85 c0                	test   %eax,%eax
+    1c90:	78 0e                	js     1ca0 <thread_create+0x60>
+    free(mem);
+  return pid;
+}
+    1c92:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1c95:	c9                   	leave
+    1c96:	c3                   	ret
+    1c97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c9e:	66 90                	xchg   %ax,%ax
+    free(mem);
+    1ca0:	83 ec 0c             	sub    $0xc,%esp
+    1ca3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1ca6:	53                   	push   %ebx
+    1ca7:	e8 34 fb ff ff       	call   17e0 <free>
+    1cac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1caf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    1cb2:	83 c4 10             	add    $0x10,%esp
+}
+    1cb5:	c9                   	leave
+    1cb6:	c3                   	ret
+    return -1;
+    1cb7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1cbc:	eb d4                	jmp    1c92 <thread_create+0x52>
+    1cbe:	66 90                	xchg   %ax,%ax
+
+00001cc0 <thread_join>:
+
+// Wait for a thread to finish and free its stack.
+int
+thread_join(void)
+{
+    1cc0:	55                   	push   %ebp
+    1cc1:	89 e5                	mov    %esp,%ebp
+    1cc3:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    1cc4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    1cc7:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    1cca:	50                   	push   %eax
+    1ccb:	e8 61 e8 ff ff       	call   531 <join>
+    1cd0:	83 c4 10             	add    $0x10,%esp
+    1cd3:	85 c0                	test   %eax,%eax
+    1cd5:	78 29                	js     1d00 <thread_join+0x40>
+    1cd7:	89 c3                	mov    %eax,%ebx
+    return -1;
+  malloc_thread_exit(&((void**)stack)[-2]);
+    1cd9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1cdc:	83 ec 0c             	sub    $0xc,%esp
+    1cdf:	83 e8 08             	sub    $0x8,%eax
+    1ce2:	50                   	push   %eax
+    1ce3:	e8 c8 fe ff ff       	call   1bb0 <malloc_thread_exit>
+  free(((char**)stack)[-1]);
+    1ce8:	58                   	pop    %eax
+    1ce9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1cec:	ff 70 fc             	push   -0x4(%eax)
+    1cef:	e8 ec fa ff ff       	call   17e0 <free>
+  return pid;
+    1cf4:	83 c4 10             	add    $0x10,%esp
+}
+    1cf7:	89 d8                	mov    %ebx,%eax
+    1cf9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1cfc:	c9                   	leave
+    1cfd:	c3                   	ret
+    1cfe:	66 90                	xchg   %ax,%ax
+    return -1;
+    1d00:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    1d05:	eb f0                	jmp    1cf7 <thread_join+0x37>
@@ -0,0 +1,61 @@
+// Spin-lock benchmark: several processes, one per CPU, hammer
+// a kernel lock, first a test-and-set lock and then a ticket
+// lock. Run with CPUS=8 to see cache-line bouncing and how
+// evenly the lock is shared (max/min per-process time).
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define ITERS 200000
+
+void
+run(char *name, int ticket, int nproc)
+{
+  int i, t0, t1, kc, min, max, sum, fds[2];
+
+  if(pipe(fds) < 0){
+    printf(1, "lockhammer: pipe failed\n");
+    exit();
+  }
+  t0 = uptime();
+  for(i = 0; i < nproc; i++){
+    if(fork() == 0){
+      kc = lockhammer(ticket, ITERS);
+      write(fds[1], &kc, sizeof(kc));
+      exit();
+    }
+  }
+  min = max = sum = 0;
+  for(i = 0; i < nproc; i++){
+    if(read(fds[0], &kc, sizeof(kc)) != sizeof(kc))
+      break;
+    if(i == 0 || kc < min)
+      min = kc;
+    if(kc > max)
+      max = kc;
+    sum += kc;
+  }
+  for(i = 0; i < nproc; i++)
+    wait();
+  t1 = uptime();
+  close(fds[0]);
+  close(fds[1]);
+  printf(1, "%s: %d procs x %d, %d ticks, kcycles/proc min %d avg %d max %d\n",
+         name, nproc, ITERS, t1 - t0, min, sum / nproc, max);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int nproc;
+
+  nproc = 8;
+  if(argc > 1)
+    nproc = atoi(argv[1]);
+  if(nproc < 1)
+    nproc = 1;
+  run("test-and-set", 0, nproc);
+  run("ticket", 1, nproc);
+  exit();
+}
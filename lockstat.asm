@@ -0,0 +1,4275 @@
+
+_lockstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    printf(1, " ");
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 48             	sub    $0x48,%esp
+  int i, j, n, nbefore, pid;
+  struct lockstat t;
+
+  nbefore = 0;
+  if(argc > 1){
+      14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+      17:	8b 71 04             	mov    0x4(%ecx),%esi
+  if(argc > 1){
+      1a:	7e 4b                	jle    67 <main+0x67>
+    nbefore = lockstat(before, NLOCKSTAT);
+      1c:	50                   	push   %eax
+      1d:	50                   	push   %eax
+      1e:	6a 20                	push   $0x20
+      20:	68 a0 2f 00 00       	push   $0x2fa0
+      25:	e8 04 08 00 00       	call   82e <lockstat>
+      2a:	89 c3                	mov    %eax,%ebx
+    pid = fork();
+      2c:	e8 ff 02 00 00       	call   330 <fork>
+    if(pid < 0){
+      31:	83 c4 10             	add    $0x10,%esp
+      34:	85 c0                	test   %eax,%eax
+      36:	0f 88 56 02 00 00    	js     292 <main+0x292>
+      printf(2, "lockstat: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      3c:	0f 85 e5 01 00 00    	jne    227 <main+0x227>
+      exec(argv[1], argv+1);
+      42:	50                   	push   %eax
+      43:	50                   	push   %eax
+      44:	8d 46 04             	lea    0x4(%esi),%eax
+      47:	50                   	push   %eax
+      48:	ff 76 04             	push   0x4(%esi)
+      4b:	e8 10 03 00 00       	call   360 <exec>
+      printf(2, "lockstat: exec %s failed\n", argv[1]);
+      50:	83 c4 0c             	add    $0xc,%esp
+      53:	ff 76 04             	push   0x4(%esi)
+      56:	68 f4 1f 00 00       	push   $0x1ff4
+      5b:	6a 02                	push   $0x2
+      5d:	e8 ee 0a 00 00       	call   b50 <printf>
+      exit();
+      62:	e8 29 03 00 00       	call   390 <exit>
+    }
+    wait();
+  }
+  n = lockstat(after, NLOCKSTAT);
+      67:	52                   	push   %edx
+      68:	52                   	push   %edx
+      69:	6a 20                	push   $0x20
+      6b:	68 20 2b 00 00       	push   $0x2b20
+      70:	e8 b9 07 00 00       	call   82e <lockstat>
+      75:	83 c4 10             	add    $0x10,%esp
+      78:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+    after[i].nacquire -= before[i].nacquire;
+    after[i].ncontend -= before[i].ncontend;
+    after[i].nspin -= before[i].nspin;
+  }
+
+  for(i = 1; i < n; i++){
+      7b:	83 7d b4 01          	cmpl   $0x1,-0x4c(%ebp)
+      7f:	0f 8e 20 02 00 00    	jle    2a5 <main+0x2a5>
+      85:	bb 44 2b 00 00       	mov    $0x2b44,%ebx
+      8a:	bf 01 00 00 00       	mov    $0x1,%edi
+      8f:	90                   	nop
+    t = after[i];
+      90:	8b 03                	mov    (%ebx),%eax
+      92:	8b 73 1c             	mov    0x1c(%ebx),%esi
+      95:	89 fa                	mov    %edi,%edx
+      97:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+      9a:	8b 43 04             	mov    0x4(%ebx),%eax
+      9d:	89 75 e0             	mov    %esi,-0x20(%ebp)
+      a0:	89 45 c8             	mov    %eax,-0x38(%ebp)
+      a3:	8b 43 08             	mov    0x8(%ebx),%eax
+      a6:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      a9:	8b 43 0c             	mov    0xc(%ebx),%eax
+      ac:	89 45 d0             	mov    %eax,-0x30(%ebp)
+      af:	8b 43 10             	mov    0x10(%ebx),%eax
+      b2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+      b5:	8b 43 14             	mov    0x14(%ebx),%eax
+      b8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+      bb:	8b 43 18             	mov    0x18(%ebx),%eax
+      be:	89 45 dc             	mov    %eax,-0x24(%ebp)
+      c1:	8b 43 20             	mov    0x20(%ebx),%eax
+      c4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      c7:	89 d8                	mov    %ebx,%eax
+      c9:	eb 46                	jmp    111 <main+0x111>
+      cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      cf:	90                   	nop
+    for(j = i; j > 0 && after[j-1].nspin < t.nspin; j--)
+      after[j] = after[j-1];
+      d0:	8b 48 dc             	mov    -0x24(%eax),%ecx
+    for(j = i; j > 0 && after[j-1].nspin < t.nspin; j--)
+      d3:	83 e8 24             	sub    $0x24,%eax
+      after[j] = after[j-1];
+      d6:	89 48 24             	mov    %ecx,0x24(%eax)
+      d9:	8b 48 04             	mov    0x4(%eax),%ecx
+      dc:	89 48 28             	mov    %ecx,0x28(%eax)
+      df:	8b 48 08             	mov    0x8(%eax),%ecx
+      e2:	89 48 2c             	mov    %ecx,0x2c(%eax)
+      e5:	8b 48 0c             	mov    0xc(%eax),%ecx
+      e8:	89 48 30             	mov    %ecx,0x30(%eax)
+      eb:	8b 48 10             	mov    0x10(%eax),%ecx
+      ee:	89 48 34             	mov    %ecx,0x34(%eax)
+      f1:	8b 48 14             	mov    0x14(%eax),%ecx
+      f4:	89 48 38             	mov    %ecx,0x38(%eax)
+      f7:	8b 48 18             	mov    0x18(%eax),%ecx
+      fa:	89 48 3c             	mov    %ecx,0x3c(%eax)
+      fd:	8b 48 1c             	mov    0x1c(%eax),%ecx
+     100:	89 48 40             	mov    %ecx,0x40(%eax)
+     103:	8b 48 20             	mov    0x20(%eax),%ecx
+     106:	89 48 44             	mov    %ecx,0x44(%eax)
+    for(j = i; j > 0 && after[j-1].nspin < t.nspin; j--)
+     109:	85 d2                	test   %edx,%edx
+     10b:	0f 84 0f 01 00 00    	je     220 <main+0x220>
+     111:	89 d1                	mov    %edx,%ecx
+     113:	8d 52 ff             	lea    -0x1(%edx),%edx
+     116:	39 70 f8             	cmp    %esi,-0x8(%eax)
+     119:	72 b5                	jb     d0 <main+0xd0>
+    after[j] = t;
+     11b:	8d 14 c9             	lea    (%ecx,%ecx,8),%edx
+     11e:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+  for(i = 1; i < n; i++){
+     121:	83 c7 01             	add    $0x1,%edi
+     124:	83 c3 24             	add    $0x24,%ebx
+    after[j] = t;
+     127:	8d 04 95 20 2b 00 00 	lea    0x2b20(,%edx,4),%eax
+     12e:	89 0c 95 20 2b 00 00 	mov    %ecx,0x2b20(,%edx,4)
+     135:	8b 55 c8             	mov    -0x38(%ebp),%edx
+     138:	89 50 04             	mov    %edx,0x4(%eax)
+     13b:	8b 55 cc             	mov    -0x34(%ebp),%edx
+     13e:	89 50 08             	mov    %edx,0x8(%eax)
+     141:	8b 55 d0             	mov    -0x30(%ebp),%edx
+     144:	89 50 0c             	mov    %edx,0xc(%eax)
+     147:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     14a:	89 50 10             	mov    %edx,0x10(%eax)
+     14d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+     150:	89 50 14             	mov    %edx,0x14(%eax)
+     153:	8b 55 dc             	mov    -0x24(%ebp),%edx
+     156:	89 50 18             	mov    %edx,0x18(%eax)
+     159:	8b 55 e0             	mov    -0x20(%ebp),%edx
+     15c:	89 50 1c             	mov    %edx,0x1c(%eax)
+     15f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     162:	89 50 20             	mov    %edx,0x20(%eax)
+  for(i = 1; i < n; i++){
+     165:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+     168:	39 c7                	cmp    %eax,%edi
+     16a:	0f 85 20 ff ff ff    	jne    90 <main+0x90>
+  }
+
+  pad("name", 16);
+     170:	56                   	push   %esi
+     171:	56                   	push   %esi
+     172:	6a 10                	push   $0x10
+     174:	68 0e 20 00 00       	push   $0x200e
+     179:	e8 62 01 00 00       	call   2e0 <pad>
+  printf(1, " locks acquires contended spins maxhold\n");
+     17e:	5f                   	pop    %edi
+     17f:	58                   	pop    %eax
+     180:	68 24 20 00 00       	push   $0x2024
+     185:	6a 01                	push   $0x1
+     187:	e8 c4 09 00 00       	call   b50 <printf>
+     18c:	83 c4 10             	add    $0x10,%esp
+     18f:	bb 20 2b 00 00       	mov    $0x2b20,%ebx
+  for(i = 0; i < n; i++){
+     194:	31 f6                	xor    %esi,%esi
+     196:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     19d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(after[i].nacquire == 0)
+     1a0:	8b 43 14             	mov    0x14(%ebx),%eax
+     1a3:	85 c0                	test   %eax,%eax
+     1a5:	74 64                	je     20b <main+0x20b>
+  printf(1, "%s", s);
+     1a7:	83 ec 04             	sub    $0x4,%esp
+     1aa:	53                   	push   %ebx
+     1ab:	68 d8 1f 00 00       	push   $0x1fd8
+     1b0:	6a 01                	push   $0x1
+     1b2:	e8 99 09 00 00       	call   b50 <printf>
+  for(n = strlen(s); n < w; n++)
+     1b7:	89 1c 24             	mov    %ebx,(%esp)
+     1ba:	e8 81 02 00 00       	call   440 <strlen>
+     1bf:	83 c4 10             	add    $0x10,%esp
+     1c2:	89 c7                	mov    %eax,%edi
+     1c4:	83 f8 0f             	cmp    $0xf,%eax
+     1c7:	7f 21                	jg     1ea <main+0x1ea>
+     1c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, " ");
+     1d0:	83 ec 08             	sub    $0x8,%esp
+  for(n = strlen(s); n < w; n++)
+     1d3:	83 c7 01             	add    $0x1,%edi
+    printf(1, " ");
+     1d6:	68 db 1f 00 00       	push   $0x1fdb
+     1db:	6a 01                	push   $0x1
+     1dd:	e8 6e 09 00 00       	call   b50 <printf>
+  for(n = strlen(s); n < w; n++)
+     1e2:	83 c4 10             	add    $0x10,%esp
+     1e5:	83 ff 10             	cmp    $0x10,%edi
+     1e8:	75 e6                	jne    1d0 <main+0x1d0>
+      continue;
+    pad(after[i].name, 16);
+    printf(1, " %d %d %d %d %d\n", after[i].nlock, after[i].nacquire,
+     1ea:	83 ec 04             	sub    $0x4,%esp
+     1ed:	ff 73 20             	push   0x20(%ebx)
+     1f0:	ff 73 1c             	push   0x1c(%ebx)
+     1f3:	ff 73 18             	push   0x18(%ebx)
+     1f6:	ff 73 14             	push   0x14(%ebx)
+     1f9:	ff 73 10             	push   0x10(%ebx)
+     1fc:	68 13 20 00 00       	push   $0x2013
+     201:	6a 01                	push   $0x1
+     203:	e8 48 09 00 00       	call   b50 <printf>
+     208:	83 c4 20             	add    $0x20,%esp
+  for(i = 0; i < n; i++){
+     20b:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+     20e:	83 c6 01             	add    $0x1,%esi
+     211:	83 c3 24             	add    $0x24,%ebx
+     214:	39 c6                	cmp    %eax,%esi
+     216:	75 88                	jne    1a0 <main+0x1a0>
+           after[i].ncontend, after[i].nspin, after[i].maxhold);
+  }
+  exit();
+     218:	e8 73 01 00 00       	call   390 <exit>
+     21d:	8d 76 00             	lea    0x0(%esi),%esi
+     220:	31 c9                	xor    %ecx,%ecx
+     222:	e9 f4 fe ff ff       	jmp    11b <main+0x11b>
+    wait();
+     227:	e8 b8 04 00 00       	call   6e4 <wait>
+  n = lockstat(after, NLOCKSTAT);
+     22c:	50                   	push   %eax
+     22d:	50                   	push   %eax
+     22e:	6a 20                	push   $0x20
+     230:	68 20 2b 00 00       	push   $0x2b20
+     235:	e8 f4 05 00 00       	call   82e <lockstat>
+  for(i = 0; i < nbefore; i++){
+     23a:	83 c4 10             	add    $0x10,%esp
+  n = lockstat(after, NLOCKSTAT);
+     23d:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  for(i = 0; i < nbefore; i++){
+     240:	85 db                	test   %ebx,%ebx
+     242:	0f 8e 33 fe ff ff    	jle    7b <main+0x7b>
+     248:	6b cb 24             	imul   $0x24,%ebx,%ecx
+     24b:	31 c0                	xor    %eax,%eax
+     24d:	8d 76 00             	lea    0x0(%esi),%esi
+    after[i].nacquire -= before[i].nacquire;
+     250:	8b 90 34 2b 00 00    	mov    0x2b34(%eax),%edx
+     256:	2b 90 b4 2f 00 00    	sub    0x2fb4(%eax),%edx
+  for(i = 0; i < nbefore; i++){
+     25c:	83 c0 24             	add    $0x24,%eax
+    after[i].nacquire -= before[i].nacquire;
+     25f:	89 90 10 2b 00 00    	mov    %edx,0x2b10(%eax)
+    after[i].ncontend -= before[i].ncontend;
+     265:	8b 90 14 2b 00 00    	mov    0x2b14(%eax),%edx
+     26b:	2b 90 94 2f 00 00    	sub    0x2f94(%eax),%edx
+     271:	89 90 14 2b 00 00    	mov    %edx,0x2b14(%eax)
+    after[i].nspin -= before[i].nspin;
+     277:	8b 90 18 2b 00 00    	mov    0x2b18(%eax),%edx
+     27d:	2b 90 98 2f 00 00    	sub    0x2f98(%eax),%edx
+     283:	89 90 18 2b 00 00    	mov    %edx,0x2b18(%eax)
+  for(i = 0; i < nbefore; i++){
+     289:	39 c8                	cmp    %ecx,%eax
+     28b:	75 c3                	jne    250 <main+0x250>
+     28d:	e9 e9 fd ff ff       	jmp    7b <main+0x7b>
+      printf(2, "lockstat: fork failed\n");
+     292:	50                   	push   %eax
+     293:	50                   	push   %eax
+     294:	68 dd 1f 00 00       	push   $0x1fdd
+     299:	6a 02                	push   $0x2
+     29b:	e8 b0 08 00 00       	call   b50 <printf>
+      exit();
+     2a0:	e8 eb 00 00 00       	call   390 <exit>
+  pad("name", 16);
+     2a5:	52                   	push   %edx
+     2a6:	52                   	push   %edx
+     2a7:	6a 10                	push   $0x10
+     2a9:	68 0e 20 00 00       	push   $0x200e
+     2ae:	e8 2d 00 00 00       	call   2e0 <pad>
+  printf(1, " locks acquires contended spins maxhold\n");
+     2b3:	59                   	pop    %ecx
+     2b4:	5b                   	pop    %ebx
+     2b5:	68 24 20 00 00       	push   $0x2024
+     2ba:	6a 01                	push   $0x1
+     2bc:	e8 8f 08 00 00       	call   b50 <printf>
+  for(i = 0; i < n; i++){
+     2c1:	83 c4 10             	add    $0x10,%esp
+     2c4:	83 7d b4 01          	cmpl   $0x1,-0x4c(%ebp)
+     2c8:	0f 84 c1 fe ff ff    	je     18f <main+0x18f>
+     2ce:	e9 45 ff ff ff       	jmp    218 <main+0x218>
+     2d3:	66 90                	xchg   %ax,%ax
+     2d5:	66 90                	xchg   %ax,%ax
+     2d7:	66 90                	xchg   %ax,%ax
+     2d9:	66 90                	xchg   %ax,%ax
+     2db:	66 90                	xchg   %ax,%ax
+     2dd:	66 90                	xchg   %ax,%ax
+     2df:	90                   	nop
+
+000002e0 <pad>:
+{
+     2e0:	55                   	push   %ebp
+     2e1:	89 e5                	mov    %esp,%ebp
+     2e3:	56                   	push   %esi
+     2e4:	53                   	push   %ebx
+     2e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     2e8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(1, "%s", s);
+     2eb:	83 ec 04             	sub    $0x4,%esp
+     2ee:	53                   	push   %ebx
+     2ef:	68 d8 1f 00 00       	push   $0x1fd8
+     2f4:	6a 01                	push   $0x1
+     2f6:	e8 55 08 00 00       	call   b50 <printf>
+  for(n = strlen(s); n < w; n++)
+     2fb:	89 1c 24             	mov    %ebx,(%esp)
+     2fe:	e8 3d 01 00 00       	call   440 <strlen>
+     303:	83 c4 10             	add    $0x10,%esp
+     306:	39 f0                	cmp    %esi,%eax
+     308:	7d 1f                	jge    329 <pad+0x49>
+     30a:	89 c3                	mov    %eax,%ebx
+     30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, " ");
+     310:	83 ec 08             	sub    $0x8,%esp
+  for(n = strlen(s); n < w; n++)
+     313:	83 c3 01             	add    $0x1,%ebx
+    printf(1, " ");
+     316:	68 db 1f 00 00       	push   $0x1fdb
+     31b:	6a 01                	push   $0x1
+     31d:	e8 2e 08 00 00       	call   b50 <printf>
+  for(n = strlen(s); n < w; n++)
+     322:	83 c4 10             	add    $0x10,%esp
+     325:	39 de                	cmp    %ebx,%esi
+     327:	75 e7                	jne    310 <pad+0x30>
+}
+     329:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     32c:	5b                   	pop    %ebx
+     32d:	5e                   	pop    %esi
+     32e:	5d                   	pop    %ebp
+     32f:	c3                   	ret
+
+00000330 <fork>:
+int sysexit(void) __attribute__((noreturn));
+
+int
+fork(void)
+{
+  if(flushhook)
+     330:	a1 20 34 00 00       	mov    0x3420,%eax
+     335:	85 c0                	test   %eax,%eax
+     337:	74 17                	je     350 <fork+0x20>
+{
+     339:	55                   	push   %ebp
+     33a:	89 e5                	mov    %esp,%ebp
+     33c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     33f:	ff d0                	call   *%eax
+  return sysfork();
+}
+     341:	c9                   	leave
+  return sysfork();
+     342:	e9 7f 03 00 00       	jmp    6c6 <sysfork>
+     347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     34e:	66 90                	xchg   %ax,%ax
+     350:	e9 71 03 00 00       	jmp    6c6 <sysfork>
+     355:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     35c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000360 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+     360:	55                   	push   %ebp
+  if(flushhook)
+     361:	a1 20 34 00 00       	mov    0x3420,%eax
+{
+     366:	89 e5                	mov    %esp,%ebp
+     368:	56                   	push   %esi
+     369:	53                   	push   %ebx
+     36a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     36d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     370:	85 c0                	test   %eax,%eax
+     372:	74 02                	je     376 <exec+0x16>
+    flushhook();
+     374:	ff d0                	call   *%eax
+  return sysexec(path, argv);
+     376:	89 75 0c             	mov    %esi,0xc(%ebp)
+     379:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     37c:	5b                   	pop    %ebx
+     37d:	5e                   	pop    %esi
+     37e:	5d                   	pop    %ebp
+  return sysexec(path, argv);
+     37f:	e9 ba 03 00 00       	jmp    73e <sysexec>
+     384:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     38b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     38f:	90                   	nop
+
+00000390 <exit>:
+
+int
+exit(void)
+{
+     390:	55                   	push   %ebp
+     391:	89 e5                	mov    %esp,%ebp
+     393:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     396:	a1 20 34 00 00       	mov    0x3420,%eax
+     39b:	85 c0                	test   %eax,%eax
+     39d:	74 02                	je     3a1 <exit+0x11>
+    flushhook();
+     39f:	ff d0                	call   *%eax
+  sysexit();
+     3a1:	e8 2f 03 00 00       	call   6d5 <sysexit>
+     3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003b0 <strcpy>:
+}
+
+char*
+strcpy(char *s, const char *t)
+{
+     3b0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     3b1:	31 c0                	xor    %eax,%eax
+{
+     3b3:	89 e5                	mov    %esp,%ebp
+     3b5:	53                   	push   %ebx
+     3b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     3b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     3bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     3c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     3c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     3c7:	83 c0 01             	add    $0x1,%eax
+     3ca:	84 d2                	test   %dl,%dl
+     3cc:	75 f2                	jne    3c0 <strcpy+0x10>
+    ;
+  return os;
+}
+     3ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3d1:	89 c8                	mov    %ecx,%eax
+     3d3:	c9                   	leave
+     3d4:	c3                   	ret
+     3d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     3e0:	55                   	push   %ebp
+     3e1:	89 e5                	mov    %esp,%ebp
+     3e3:	53                   	push   %ebx
+     3e4:	8b 55 08             	mov    0x8(%ebp),%edx
+     3e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     3ea:	0f b6 02             	movzbl (%edx),%eax
+     3ed:	84 c0                	test   %al,%al
+     3ef:	75 17                	jne    408 <strcmp+0x28>
+     3f1:	eb 3a                	jmp    42d <strcmp+0x4d>
+     3f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3f7:	90                   	nop
+     3f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     3fc:	83 c2 01             	add    $0x1,%edx
+     3ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     402:	84 c0                	test   %al,%al
+     404:	74 1a                	je     420 <strcmp+0x40>
+    p++, q++;
+     406:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     408:	0f b6 19             	movzbl (%ecx),%ebx
+     40b:	38 c3                	cmp    %al,%bl
+     40d:	74 e9                	je     3f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     40f:	29 d8                	sub    %ebx,%eax
+}
+     411:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     414:	c9                   	leave
+     415:	c3                   	ret
+     416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     41d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     420:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     424:	31 c0                	xor    %eax,%eax
+     426:	29 d8                	sub    %ebx,%eax
+}
+     428:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     42b:	c9                   	leave
+     42c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     42d:	0f b6 19             	movzbl (%ecx),%ebx
+     430:	31 c0                	xor    %eax,%eax
+     432:	eb db                	jmp    40f <strcmp+0x2f>
+     434:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     43b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     43f:	90                   	nop
+
+00000440 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     440:	55                   	push   %ebp
+     441:	89 e5                	mov    %esp,%ebp
+     443:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     446:	80 3a 00             	cmpb   $0x0,(%edx)
+     449:	74 15                	je     460 <strlen+0x20>
+     44b:	31 c0                	xor    %eax,%eax
+     44d:	8d 76 00             	lea    0x0(%esi),%esi
+     450:	83 c0 01             	add    $0x1,%eax
+     453:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     457:	89 c1                	mov    %eax,%ecx
+     459:	75 f5                	jne    450 <strlen+0x10>
+    ;
+  return n;
+}
+     45b:	89 c8                	mov    %ecx,%eax
+     45d:	5d                   	pop    %ebp
+     45e:	c3                   	ret
+     45f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     460:	31 c9                	xor    %ecx,%ecx
+}
+     462:	5d                   	pop    %ebp
+     463:	89 c8                	mov    %ecx,%eax
+     465:	c3                   	ret
+     466:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     46d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000470 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     470:	55                   	push   %ebp
+     471:	89 e5                	mov    %esp,%ebp
+     473:	57                   	push   %edi
+     474:	8b 55 08             	mov    0x8(%ebp),%edx
+            "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt) {
+    asm volatile("cld; rep stosb" :
+     477:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     47a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     47d:	89 d7                	mov    %edx,%edi
+     47f:	fc                   	cld
+     480:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     482:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     485:	89 d0                	mov    %edx,%eax
+     487:	c9                   	leave
+     488:	c3                   	ret
+     489:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     490:	55                   	push   %ebp
+     491:	89 e5                	mov    %esp,%ebp
+     493:	8b 45 08             	mov    0x8(%ebp),%eax
+     496:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     49a:	0f b6 10             	movzbl (%eax),%edx
+     49d:	84 d2                	test   %dl,%dl
+     49f:	75 12                	jne    4b3 <strchr+0x23>
+     4a1:	eb 1d                	jmp    4c0 <strchr+0x30>
+     4a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4a7:	90                   	nop
+     4a8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     4ac:	83 c0 01             	add    $0x1,%eax
+     4af:	84 d2                	test   %dl,%dl
+     4b1:	74 0d                	je     4c0 <strchr+0x30>
+    if(*s == c)
+     4b3:	38 d1                	cmp    %dl,%cl
+     4b5:	75 f1                	jne    4a8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     4b7:	5d                   	pop    %ebp
+     4b8:	c3                   	ret
+     4b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     4c0:	31 c0                	xor    %eax,%eax
+}
+     4c2:	5d                   	pop    %ebp
+     4c3:	c3                   	ret
+     4c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4cf:	90                   	nop
+
+000004d0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     4d0:	55                   	push   %ebp
+     4d1:	89 e5                	mov    %esp,%ebp
+     4d3:	56                   	push   %esi
+     4d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     4d5:	83 ec 08             	sub    $0x8,%esp
+     4d8:	6a 00                	push   $0x0
+     4da:	ff 75 08             	push   0x8(%ebp)
+     4dd:	e8 6b 02 00 00       	call   74d <open>
+  if(fd < 0)
+     4e2:	83 c4 10             	add    $0x10,%esp
+     4e5:	85 c0                	test   %eax,%eax
+     4e7:	78 27                	js     510 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     4e9:	83 ec 08             	sub    $0x8,%esp
+     4ec:	ff 75 0c             	push   0xc(%ebp)
+     4ef:	89 c3                	mov    %eax,%ebx
+     4f1:	50                   	push   %eax
+     4f2:	e8 83 02 00 00       	call   77a <fstat>
+  close(fd);
+     4f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     4fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+     4fc:	e8 1f 02 00 00       	call   720 <close>
+  return r;
+     501:	83 c4 10             	add    $0x10,%esp
+}
+     504:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     507:	89 f0                	mov    %esi,%eax
+     509:	5b                   	pop    %ebx
+     50a:	5e                   	pop    %esi
+     50b:	5d                   	pop    %ebp
+     50c:	c3                   	ret
+     50d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     510:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     515:	eb ed                	jmp    504 <stat+0x34>
+     517:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     51e:	66 90                	xchg   %ax,%ax
+
+00000520 <atoi>:
+
+int
+atoi(const char *s)
+{
+     520:	55                   	push   %ebp
+     521:	89 e5                	mov    %esp,%ebp
+     523:	53                   	push   %ebx
+     524:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     527:	0f be 02             	movsbl (%edx),%eax
+     52a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     52d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     530:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     535:	77 1e                	ja     555 <atoi+0x35>
+     537:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     53e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     540:	83 c2 01             	add    $0x1,%edx
+     543:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     546:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     54a:	0f be 02             	movsbl (%edx),%eax
+     54d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     550:	80 fb 09             	cmp    $0x9,%bl
+     553:	76 eb                	jbe    540 <atoi+0x20>
+  return n;
+}
+     555:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     558:	89 c8                	mov    %ecx,%eax
+     55a:	c9                   	leave
+     55b:	c3                   	ret
+     55c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000560 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     560:	55                   	push   %ebp
+     561:	89 e5                	mov    %esp,%ebp
+     563:	57                   	push   %edi
+     564:	56                   	push   %esi
+     565:	8b 45 10             	mov    0x10(%ebp),%eax
+     568:	8b 55 08             	mov    0x8(%ebp),%edx
+     56b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     56e:	85 c0                	test   %eax,%eax
+     570:	7e 13                	jle    585 <memmove+0x25>
+     572:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     574:	89 d7                	mov    %edx,%edi
+     576:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     57d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     580:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     581:	39 f8                	cmp    %edi,%eax
+     583:	75 fb                	jne    580 <memmove+0x20>
+  return vdst;
+}
+     585:	5e                   	pop    %esi
+     586:	89 d0                	mov    %edx,%eax
+     588:	5f                   	pop    %edi
+     589:	5d                   	pop    %ebp
+     58a:	c3                   	ret
+     58b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     58f:	90                   	nop
+
+00000590 <mutex_init>:
+
+// Futex-based mutex (Drepper, "Futexes Are Tricky", mutex 2).
+// The uncontended paths never enter the kernel.
+void
+mutex_init(struct mutex *m)
+{
+     590:	55                   	push   %ebp
+     591:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+     593:	8b 45 08             	mov    0x8(%ebp),%eax
+     596:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     59c:	5d                   	pop    %ebp
+     59d:	c3                   	ret
+     59e:	66 90                	xchg   %ax,%ax
+
+000005a0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     5a0:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     5a1:	31 c0                	xor    %eax,%eax
+     5a3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+     5a8:	89 e5                	mov    %esp,%ebp
+     5aa:	56                   	push   %esi
+     5ab:	53                   	push   %ebx
+     5ac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     5af:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     5b3:	85 c0                	test   %eax,%eax
+     5b5:	74 32                	je     5e9 <mutex_lock+0x49>
+    return;
+  if(c != 2)
+     5b7:	83 f8 02             	cmp    $0x2,%eax
+     5ba:	74 0c                	je     5c8 <mutex_lock+0x28>
+static inline uint
+xchg(volatile uint *addr, uint newval) {
+    uint result;
+
+    // The + in "+m" denotes a read-modify-write operand.
+    asm volatile("lock; xchgl %0, %1" :
+     5bc:	b8 02 00 00 00       	mov    $0x2,%eax
+     5c1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+     5c4:	85 c0                	test   %eax,%eax
+     5c6:	74 21                	je     5e9 <mutex_lock+0x49>
+     5c8:	be 02 00 00 00       	mov    $0x2,%esi
+     5cd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAIT, 2);
+     5d0:	83 ec 04             	sub    $0x4,%esp
+     5d3:	6a 02                	push   $0x2
+     5d5:	6a 00                	push   $0x0
+     5d7:	53                   	push   %ebx
+     5d8:	e8 33 02 00 00       	call   810 <futex>
+     5dd:	89 f0                	mov    %esi,%eax
+     5df:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     5e2:	83 c4 10             	add    $0x10,%esp
+     5e5:	85 c0                	test   %eax,%eax
+     5e7:	75 e7                	jne    5d0 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+     5e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5ec:	5b                   	pop    %ebx
+     5ed:	5e                   	pop    %esi
+     5ee:	5d                   	pop    %ebp
+     5ef:	c3                   	ret
+
+000005f0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     5f0:	55                   	push   %ebp
+     5f1:	89 e5                	mov    %esp,%ebp
+     5f3:	83 ec 08             	sub    $0x8,%esp
+     5f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     5f9:	f0 83 28 01          	lock subl $0x1,(%eax)
+     5fd:	75 09                	jne    608 <mutex_unlock+0x18>
+    m->val = 0;
+    futex(&m->val, FUTEX_WAKE, 1);
+  }
+}
+     5ff:	c9                   	leave
+     600:	c3                   	ret
+     601:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     608:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     60b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex(&m->val, FUTEX_WAKE, 1);
+     611:	6a 01                	push   $0x1
+     613:	6a 01                	push   $0x1
+     615:	50                   	push   %eax
+     616:	e8 f5 01 00 00       	call   810 <futex>
+     61b:	83 c4 10             	add    $0x10,%esp
+}
+     61e:	c9                   	leave
+     61f:	c3                   	ret
+
+00000620 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     620:	55                   	push   %ebp
+     621:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     623:	8b 45 08             	mov    0x8(%ebp),%eax
+     626:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     62c:	5d                   	pop    %ebp
+     62d:	c3                   	ret
+     62e:	66 90                	xchg   %ax,%ax
+
+00000630 <cond_wait>:
+
+// Release m and wait for a signal, then reacquire m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     630:	55                   	push   %ebp
+     631:	89 e5                	mov    %esp,%ebp
+     633:	57                   	push   %edi
+     634:	56                   	push   %esi
+     635:	53                   	push   %ebx
+     636:	83 ec 0c             	sub    $0xc,%esp
+     639:	8b 75 08             	mov    0x8(%ebp),%esi
+     63c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     63f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     641:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+     645:	75 21                	jne    668 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     647:	83 ec 04             	sub    $0x4,%esp
+     64a:	57                   	push   %edi
+     64b:	6a 00                	push   $0x0
+     64d:	56                   	push   %esi
+     64e:	e8 bd 01 00 00       	call   810 <futex>
+  mutex_lock(m);
+     653:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     656:	83 c4 10             	add    $0x10,%esp
+}
+     659:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     65c:	5b                   	pop    %ebx
+     65d:	5e                   	pop    %esi
+     65e:	5f                   	pop    %edi
+     65f:	5d                   	pop    %ebp
+  mutex_lock(m);
+     660:	e9 3b ff ff ff       	jmp    5a0 <mutex_lock>
+     665:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     668:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     66b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex(&m->val, FUTEX_WAKE, 1);
+     671:	6a 01                	push   $0x1
+     673:	6a 01                	push   $0x1
+     675:	53                   	push   %ebx
+     676:	e8 95 01 00 00       	call   810 <futex>
+     67b:	83 c4 10             	add    $0x10,%esp
+     67e:	eb c7                	jmp    647 <cond_wait+0x17>
+
+00000680 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+     680:	55                   	push   %ebp
+     681:	89 e5                	mov    %esp,%ebp
+     683:	83 ec 0c             	sub    $0xc,%esp
+     686:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     689:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+     68d:	6a 01                	push   $0x1
+     68f:	6a 01                	push   $0x1
+     691:	50                   	push   %eax
+     692:	e8 79 01 00 00       	call   810 <futex>
+}
+     697:	83 c4 10             	add    $0x10,%esp
+     69a:	c9                   	leave
+     69b:	c3                   	ret
+     69c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006a0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     6a0:	55                   	push   %ebp
+     6a1:	89 e5                	mov    %esp,%ebp
+     6a3:	83 ec 0c             	sub    $0xc,%esp
+     6a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     6a9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+     6ad:	6a 40                	push   $0x40
+     6af:	6a 01                	push   $0x1
+     6b1:	50                   	push   %eax
+     6b2:	e8 59 01 00 00       	call   810 <futex>
+}
+     6b7:	83 c4 10             	add    $0x10,%esp
+     6ba:	c9                   	leave
+     6bb:	c3                   	ret
+     6bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006c0 <uptime>:
+// Clock ticks since boot, read from the kernel's vdso page
+// without a system call.
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     6c0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+     6c5:	c3                   	ret
+
+000006c6 <sysfork>:
+  1: ret
+
+#define SYSCALL(name) SYSCALLAS(name, name)
+
+// ulib.c wraps these.
+SYSCALLAS(sysfork, fork)
+     6c6:	b8 01 00 00 00       	mov    $0x1,%eax
+     6cb:	89 e1                	mov    %esp,%ecx
+     6cd:	ba d4 06 00 00       	mov    $0x6d4,%edx
+     6d2:	0f 34                	sysenter
+     6d4:	c3                   	ret
+
+000006d5 <sysexit>:
+SYSCALLAS(sysexit, exit)
+     6d5:	b8 02 00 00 00       	mov    $0x2,%eax
+     6da:	89 e1                	mov    %esp,%ecx
+     6dc:	ba e3 06 00 00       	mov    $0x6e3,%edx
+     6e1:	0f 34                	sysenter
+     6e3:	c3                   	ret
+
+000006e4 <wait>:
+SYSCALL(wait)
+     6e4:	b8 03 00 00 00       	mov    $0x3,%eax
+     6e9:	89 e1                	mov    %esp,%ecx
+     6eb:	ba f2 06 00 00       	mov    $0x6f2,%edx
+     6f0:	0f 34                	sysenter
+     6f2:	c3                   	ret
+
+000006f3 <pipe>:
+SYSCALL(pipe)
+     6f3:	b8 04 00 00 00       	mov    $0x4,%eax
+     6f8:	89 e1                	mov    %esp,%ecx
+     6fa:	ba 01 07 00 00       	mov    $0x701,%edx
+     6ff:	0f 34                	sysenter
+     701:	c3                   	ret
+
+00000702 <read>:
+SYSCALL(read)
+     702:	b8 05 00 00 00       	mov    $0x5,%eax
+     707:	89 e1                	mov    %esp,%ecx
+     709:	ba 10 07 00 00       	mov    $0x710,%edx
+     70e:	0f 34                	sysenter
+     710:	c3                   	ret
+
+00000711 <write>:
+SYSCALL(write)
+     711:	b8 10 00 00 00       	mov    $0x10,%eax
+     716:	89 e1                	mov    %esp,%ecx
+     718:	ba 1f 07 00 00       	mov    $0x71f,%edx
+     71d:	0f 34                	sysenter
+     71f:	c3                   	ret
+
+00000720 <close>:
+SYSCALL(close)
+     720:	b8 15 00 00 00       	mov    $0x15,%eax
+     725:	89 e1                	mov    %esp,%ecx
+     727:	ba 2e 07 00 00       	mov    $0x72e,%edx
+     72c:	0f 34                	sysenter
+     72e:	c3                   	ret
+
+0000072f <kill>:
+SYSCALL(kill)
+     72f:	b8 06 00 00 00       	mov    $0x6,%eax
+     734:	89 e1                	mov    %esp,%ecx
+     736:	ba 3d 07 00 00       	mov    $0x73d,%edx
+     73b:	0f 34                	sysenter
+     73d:	c3                   	ret
+
+0000073e <sysexec>:
+SYSCALLAS(sysexec, exec)
+     73e:	b8 07 00 00 00       	mov    $0x7,%eax
+     743:	89 e1                	mov    %esp,%ecx
+     745:	ba 4c 07 00 00       	mov    $0x74c,%edx
+     74a:	0f 34                	sysenter
+     74c:	c3                   	ret
+
+0000074d <open>:
+SYSCALL(open)
+     74d:	b8 0f 00 00 00       	mov    $0xf,%eax
+     752:	89 e1                	mov    %esp,%ecx
+     754:	ba 5b 07 00 00       	mov    $0x75b,%edx
+     759:	0f 34                	sysenter
+     75b:	c3                   	ret
+
+0000075c <mknod>:
+SYSCALL(mknod)
+     75c:	b8 11 00 00 00       	mov    $0x11,%eax
+     761:	89 e1                	mov    %esp,%ecx
+     763:	ba 6a 07 00 00       	mov    $0x76a,%edx
+     768:	0f 34                	sysenter
+     76a:	c3                   	ret
+
+0000076b <unlink>:
+SYSCALL(unlink)
+     76b:	b8 12 00 00 00       	mov    $0x12,%eax
+     770:	89 e1                	mov    %esp,%ecx
+     772:	ba 79 07 00 00       	mov    $0x779,%edx
+     777:	0f 34                	sysenter
+     779:	c3                   	ret
+
+0000077a <fstat>:
+SYSCALL(fstat)
+     77a:	b8 08 00 00 00       	mov    $0x8,%eax
+     77f:	89 e1                	mov    %esp,%ecx
+     781:	ba 88 07 00 00       	mov    $0x788,%edx
+     786:	0f 34                	sysenter
+     788:	c3                   	ret
+
+00000789 <link>:
+SYSCALL(link)
+     789:	b8 13 00 00 00       	mov    $0x13,%eax
+     78e:	89 e1                	mov    %esp,%ecx
+     790:	ba 97 07 00 00       	mov    $0x797,%edx
+     795:	0f 34                	sysenter
+     797:	c3                   	ret
+
+00000798 <mkdir>:
+SYSCALL(mkdir)
+     798:	b8 14 00 00 00       	mov    $0x14,%eax
+     79d:	89 e1                	mov    %esp,%ecx
+     79f:	ba a6 07 00 00       	mov    $0x7a6,%edx
+     7a4:	0f 34                	sysenter
+     7a6:	c3                   	ret
+
+000007a7 <chdir>:
+SYSCALL(chdir)
+     7a7:	b8 09 00 00 00       	mov    $0x9,%eax
+     7ac:	89 e1                	mov    %esp,%ecx
+     7ae:	ba b5 07 00 00       	mov    $0x7b5,%edx
+     7b3:	0f 34                	sysenter
+     7b5:	c3                   	ret
+
+000007b6 <dup>:
+SYSCALL(dup)
+     7b6:	b8 0a 00 00 00       	mov    $0xa,%eax
+     7bb:	89 e1                	mov    %esp,%ecx
+     7bd:	ba c4 07 00 00       	mov    $0x7c4,%edx
+     7c2:	0f 34                	sysenter
+     7c4:	c3                   	ret
+
+000007c5 <getpid>:
+SYSCALL(getpid)
+     7c5:	b8 0b 00 00 00       	mov    $0xb,%eax
+     7ca:	89 e1                	mov    %esp,%ecx
+     7cc:	ba d3 07 00 00       	mov    $0x7d3,%edx
+     7d1:	0f 34                	sysenter
+     7d3:	c3                   	ret
+
+000007d4 <sbrk>:
+SYSCALL(sbrk)
+     7d4:	b8 0c 00 00 00       	mov    $0xc,%eax
+     7d9:	89 e1                	mov    %esp,%ecx
+     7db:	ba e2 07 00 00       	mov    $0x7e2,%edx
+     7e0:	0f 34                	sysenter
+     7e2:	c3                   	ret
+
+000007e3 <sleep>:
+SYSCALL(sleep)
+     7e3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     7e8:	89 e1                	mov    %esp,%ecx
+     7ea:	ba f1 07 00 00       	mov    $0x7f1,%edx
+     7ef:	0f 34                	sysenter
+     7f1:	c3                   	ret
+
+000007f2 <clone>:
+SYSCALL(clone)
+     7f2:	b8 16 00 00 00       	mov    $0x16,%eax
+     7f7:	89 e1                	mov    %esp,%ecx
+     7f9:	ba 00 08 00 00       	mov    $0x800,%edx
+     7fe:	0f 34                	sysenter
+     800:	c3                   	ret
+
+00000801 <join>:
+SYSCALL(join)
+     801:	b8 17 00 00 00       	mov    $0x17,%eax
+     806:	89 e1                	mov    %esp,%ecx
+     808:	ba 0f 08 00 00       	mov    $0x80f,%edx
+     80d:	0f 34                	sysenter
+     80f:	c3                   	ret
+
+00000810 <futex>:
+SYSCALL(futex)
+     810:	b8 18 00 00 00       	mov    $0x18,%eax
+     815:	89 e1                	mov    %esp,%ecx
+     817:	ba 1e 08 00 00       	mov    $0x81e,%edx
+     81c:	0f 34                	sysenter
+     81e:	c3                   	ret
+
+0000081f <yield>:
+SYSCALL(yield)
+     81f:	b8 19 00 00 00       	mov    $0x19,%eax
+     824:	89 e1                	mov    %esp,%ecx
+     826:	ba 2d 08 00 00       	mov    $0x82d,%edx
+     82b:	0f 34                	sysenter
+     82d:	c3                   	ret
+
+0000082e <lockstat>:
+SYSCALL(lockstat)
+     82e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     833:	89 e1                	mov    %esp,%ecx
+     835:	ba 3c 08 00 00       	mov    $0x83c,%edx
+     83a:	0f 34                	sysenter
+     83c:	c3                   	ret
+
+0000083d <lockhammer>:
+SYSCALL(lockhammer)
+     83d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     842:	89 e1                	mov    %esp,%ecx
+     844:	ba 4b 08 00 00       	mov    $0x84b,%edx
+     849:	0f 34                	sysenter
+     84b:	c3                   	ret
+
+0000084c <vmsplice>:
+SYSCALL(vmsplice)
+     84c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     851:	89 e1                	mov    %esp,%ecx
+     853:	ba 5a 08 00 00       	mov    $0x85a,%edx
+     858:	0f 34                	sysenter
+     85a:	c3                   	ret
+
+0000085b <hsbrk>:
+SYSCALL(hsbrk)
+     85b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     860:	89 e1                	mov    %esp,%ecx
+     862:	ba 69 08 00 00       	mov    $0x869,%edx
+     867:	0f 34                	sysenter
+     869:	c3                   	ret
+
+0000086a <mmap>:
+SYSCALL(mmap)
+     86a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     86f:	89 e1                	mov    %esp,%ecx
+     871:	ba 78 08 00 00       	mov    $0x878,%edx
+     876:	0f 34                	sysenter
+     878:	c3                   	ret
+
+00000879 <munmap>:
+SYSCALL(munmap)
+     879:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     87e:	89 e1                	mov    %esp,%ecx
+     880:	ba 87 08 00 00       	mov    $0x887,%edx
+     885:	0f 34                	sysenter
+     887:	c3                   	ret
+
+00000888 <ringenter>:
+SYSCALL(ringenter)
+     888:	b8 20 00 00 00       	mov    $0x20,%eax
+     88d:	89 e1                	mov    %esp,%ecx
+     88f:	ba 96 08 00 00       	mov    $0x896,%edx
+     894:	0f 34                	sysenter
+     896:	c3                   	ret
+
+00000897 <readv>:
+SYSCALL(readv)
+     897:	b8 21 00 00 00       	mov    $0x21,%eax
+     89c:	89 e1                	mov    %esp,%ecx
+     89e:	ba a5 08 00 00       	mov    $0x8a5,%edx
+     8a3:	0f 34                	sysenter
+     8a5:	c3                   	ret
+
+000008a6 <writev>:
+SYSCALL(writev)
+     8a6:	b8 22 00 00 00       	mov    $0x22,%eax
+     8ab:	89 e1                	mov    %esp,%ecx
+     8ad:	ba b4 08 00 00       	mov    $0x8b4,%edx
+     8b2:	0f 34                	sysenter
+     8b4:	c3                   	ret
+
+000008b5 <pread>:
+SYSCALL(pread)
+     8b5:	b8 23 00 00 00       	mov    $0x23,%eax
+     8ba:	89 e1                	mov    %esp,%ecx
+     8bc:	ba c3 08 00 00       	mov    $0x8c3,%edx
+     8c1:	0f 34                	sysenter
+     8c3:	c3                   	ret
+
+000008c4 <pwrite>:
+SYSCALL(pwrite)
+     8c4:	b8 24 00 00 00       	mov    $0x24,%eax
+     8c9:	89 e1                	mov    %esp,%ecx
+     8cb:	ba d2 08 00 00       	mov    $0x8d2,%edx
+     8d0:	0f 34                	sysenter
+     8d2:	c3                   	ret
+
+000008d3 <prof>:
+SYSCALL(prof)
+     8d3:	b8 25 00 00 00       	mov    $0x25,%eax
+     8d8:	89 e1                	mov    %esp,%ecx
+     8da:	ba e1 08 00 00       	mov    $0x8e1,%edx
+     8df:	0f 34                	sysenter
+     8e1:	c3                   	ret
+
+000008e2 <scstat>:
+SYSCALL(scstat)
+     8e2:	b8 26 00 00 00       	mov    $0x26,%eax
+     8e7:	89 e1                	mov    %esp,%ecx
+     8e9:	ba f0 08 00 00       	mov    $0x8f0,%edx
+     8ee:	0f 34                	sysenter
+     8f0:	c3                   	ret
+     8f1:	66 90                	xchg   %ax,%ax
+     8f3:	66 90                	xchg   %ax,%ax
+     8f5:	66 90                	xchg   %ax,%ax
+     8f7:	66 90                	xchg   %ax,%ax
+     8f9:	66 90                	xchg   %ax,%ax
+     8fb:	66 90                	xchg   %ax,%ax
+     8fd:	66 90                	xchg   %ax,%ax
+     8ff:	90                   	nop
+
+00000900 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+     900:	55                   	push   %ebp
+     901:	89 e5                	mov    %esp,%ebp
+     903:	57                   	push   %edi
+     904:	56                   	push   %esi
+     905:	53                   	push   %ebx
+     906:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     908:	89 d1                	mov    %edx,%ecx
+{
+     90a:	83 ec 2c             	sub    $0x2c,%esp
+     90d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+     910:	85 d2                	test   %edx,%edx
+     912:	79 7c                	jns    990 <printint+0x90>
+     914:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     918:	74 76                	je     990 <printint+0x90>
+    x = -xx;
+     91a:	f7 d9                	neg    %ecx
+    neg = 1;
+     91c:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     921:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     924:	31 f6                	xor    %esi,%esi
+     926:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     92d:	8d 76 00             	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     930:	89 c8                	mov    %ecx,%eax
+     932:	31 d2                	xor    %edx,%edx
+     934:	89 f7                	mov    %esi,%edi
+     936:	f7 f3                	div    %ebx
+     938:	8d 76 01             	lea    0x1(%esi),%esi
+     93b:	0f b6 92 ac 20 00 00 	movzbl 0x20ac(%edx),%edx
+     942:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     946:	89 ca                	mov    %ecx,%edx
+     948:	89 c1                	mov    %eax,%ecx
+     94a:	39 da                	cmp    %ebx,%edx
+     94c:	73 e2                	jae    930 <printint+0x30>
+  if(neg)
+     94e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     951:	85 c0                	test   %eax,%eax
+     953:	74 07                	je     95c <printint+0x5c>
+    buf[i++] = '-';
+     955:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     95a:	89 f7                	mov    %esi,%edi
+     95c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     95f:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     962:	01 df                	add    %ebx,%edi
+     964:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc_unlocked(buf[i], f);
+     968:	83 ec 08             	sub    $0x8,%esp
+     96b:	56                   	push   %esi
+     96c:	0f be 07             	movsbl (%edi),%eax
+     96f:	50                   	push   %eax
+     970:	e8 cb 07 00 00       	call   1140 <putc_unlocked>
+  while(--i >= 0)
+     975:	89 f8                	mov    %edi,%eax
+     977:	83 c4 10             	add    $0x10,%esp
+     97a:	83 ef 01             	sub    $0x1,%edi
+     97d:	39 d8                	cmp    %ebx,%eax
+     97f:	75 e7                	jne    968 <printint+0x68>
+}
+     981:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     984:	5b                   	pop    %ebx
+     985:	5e                   	pop    %esi
+     986:	5f                   	pop    %edi
+     987:	5d                   	pop    %ebp
+     988:	c3                   	ret
+     989:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     990:	31 c0                	xor    %eax,%eax
+     992:	eb 8d                	jmp    921 <printint+0x21>
+     994:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     99b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     99f:	90                   	nop
+
+000009a0 <vfprintf>:
+
+// Print to the given stream, which the caller has locked.
+// Only understands %d, %x, %p, %s.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+     9a0:	55                   	push   %ebp
+     9a1:	89 e5                	mov    %esp,%ebp
+     9a3:	57                   	push   %edi
+     9a4:	56                   	push   %esi
+     9a5:	53                   	push   %ebx
+     9a6:	83 ec 1c             	sub    $0x1c,%esp
+     9a9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     9ac:	0f b6 0a             	movzbl (%edx),%ecx
+     9af:	84 c9                	test   %cl,%cl
+     9b1:	74 5c                	je     a0f <vfprintf+0x6f>
+     9b3:	89 c6                	mov    %eax,%esi
+     9b5:	8d 5a 01             	lea    0x1(%edx),%ebx
+     9b8:	31 ff                	xor    %edi,%edi
+     9ba:	eb 20                	jmp    9dc <vfprintf+0x3c>
+     9bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     9c0:	83 f9 25             	cmp    $0x25,%ecx
+     9c3:	74 3b                	je     a00 <vfprintf+0x60>
+        state = '%';
+      } else {
+        putc_unlocked(c, f);
+     9c5:	83 ec 08             	sub    $0x8,%esp
+     9c8:	56                   	push   %esi
+     9c9:	51                   	push   %ecx
+     9ca:	e8 71 07 00 00       	call   1140 <putc_unlocked>
+     9cf:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     9d2:	0f b6 0b             	movzbl (%ebx),%ecx
+     9d5:	83 c3 01             	add    $0x1,%ebx
+     9d8:	84 c9                	test   %cl,%cl
+     9da:	74 33                	je     a0f <vfprintf+0x6f>
+    if(state == 0){
+     9dc:	85 ff                	test   %edi,%edi
+     9de:	74 e0                	je     9c0 <vfprintf+0x20>
+      }
+    } else if(state == '%'){
+     9e0:	83 ff 25             	cmp    $0x25,%edi
+     9e3:	75 ed                	jne    9d2 <vfprintf+0x32>
+      if(c == 'd'){
+     9e5:	83 f9 25             	cmp    $0x25,%ecx
+     9e8:	0f 84 02 01 00 00    	je     af0 <vfprintf+0x150>
+     9ee:	8d 41 9d             	lea    -0x63(%ecx),%eax
+     9f1:	83 f8 15             	cmp    $0x15,%eax
+     9f4:	77 2a                	ja     a20 <vfprintf+0x80>
+     9f6:	ff 24 85 54 20 00 00 	jmp    *0x2054(,%eax,4)
+     9fd:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     a00:	0f b6 0b             	movzbl (%ebx),%ecx
+     a03:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     a06:	bf 25 00 00 00       	mov    $0x25,%edi
+  for(i = 0; fmt[i]; i++){
+     a0b:	84 c9                	test   %cl,%cl
+     a0d:	75 cd                	jne    9dc <vfprintf+0x3c>
+        putc_unlocked(c, f);
+      }
+      state = 0;
+    }
+  }
+}
+     a0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a12:	5b                   	pop    %ebx
+     a13:	5e                   	pop    %esi
+     a14:	5f                   	pop    %edi
+     a15:	5d                   	pop    %ebp
+     a16:	c3                   	ret
+     a17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a1e:	66 90                	xchg   %ax,%ax
+        putc_unlocked('%', f);
+     a20:	83 ec 08             	sub    $0x8,%esp
+     a23:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     a26:	56                   	push   %esi
+     a27:	6a 25                	push   $0x25
+     a29:	e8 12 07 00 00       	call   1140 <putc_unlocked>
+        putc_unlocked(c, f);
+     a2e:	58                   	pop    %eax
+     a2f:	5a                   	pop    %edx
+     a30:	56                   	push   %esi
+     a31:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     a34:	51                   	push   %ecx
+     a35:	e8 06 07 00 00       	call   1140 <putc_unlocked>
+     a3a:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     a3d:	31 ff                	xor    %edi,%edi
+     a3f:	eb 91                	jmp    9d2 <vfprintf+0x32>
+     a41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+     a48:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     a4b:	83 ec 0c             	sub    $0xc,%esp
+     a4e:	b9 10 00 00 00       	mov    $0x10,%ecx
+     a53:	8b 17                	mov    (%edi),%edx
+     a55:	6a 00                	push   $0x0
+        ap++;
+     a57:	83 c7 04             	add    $0x4,%edi
+        printint(f, *ap, 16, 0);
+     a5a:	89 f0                	mov    %esi,%eax
+     a5c:	e8 9f fe ff ff       	call   900 <printint>
+        ap++;
+     a61:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     a64:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     a67:	31 ff                	xor    %edi,%edi
+     a69:	e9 64 ff ff ff       	jmp    9d2 <vfprintf+0x32>
+     a6e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     a70:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     a73:	8b 10                	mov    (%eax),%edx
+        ap++;
+     a75:	83 c0 04             	add    $0x4,%eax
+     a78:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     a7b:	85 d2                	test   %edx,%edx
+     a7d:	0f 84 85 00 00 00    	je     b08 <vfprintf+0x168>
+        while(*s != 0){
+     a83:	0f be 02             	movsbl (%edx),%eax
+        s = (char*)*ap;
+     a86:	89 d7                	mov    %edx,%edi
+        while(*s != 0){
+     a88:	84 c0                	test   %al,%al
+     a8a:	74 b1                	je     a3d <vfprintf+0x9d>
+     a8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+          putc_unlocked(*s, f);
+     a90:	83 ec 08             	sub    $0x8,%esp
+          s++;
+     a93:	83 c7 01             	add    $0x1,%edi
+          putc_unlocked(*s, f);
+     a96:	56                   	push   %esi
+     a97:	50                   	push   %eax
+     a98:	e8 a3 06 00 00       	call   1140 <putc_unlocked>
+        while(*s != 0){
+     a9d:	0f be 07             	movsbl (%edi),%eax
+     aa0:	83 c4 10             	add    $0x10,%esp
+     aa3:	84 c0                	test   %al,%al
+     aa5:	75 e9                	jne    a90 <vfprintf+0xf0>
+      state = 0;
+     aa7:	31 ff                	xor    %edi,%edi
+     aa9:	e9 24 ff ff ff       	jmp    9d2 <vfprintf+0x32>
+     aae:	66 90                	xchg   %ax,%ax
+        printint(f, *ap, 10, 1);
+     ab0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     ab3:	83 ec 0c             	sub    $0xc,%esp
+     ab6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     abb:	8b 17                	mov    (%edi),%edx
+     abd:	6a 01                	push   $0x1
+     abf:	eb 96                	jmp    a57 <vfprintf+0xb7>
+     ac1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc_unlocked(*ap, f);
+     ac8:	83 ec 08             	sub    $0x8,%esp
+     acb:	56                   	push   %esi
+     acc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     acf:	ff 37                	push   (%edi)
+     ad1:	e8 6a 06 00 00       	call   1140 <putc_unlocked>
+        ap++;
+     ad6:	89 f8                	mov    %edi,%eax
+     ad8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     adb:	31 ff                	xor    %edi,%edi
+        ap++;
+     add:	83 c0 04             	add    $0x4,%eax
+     ae0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     ae3:	e9 ea fe ff ff       	jmp    9d2 <vfprintf+0x32>
+     ae8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aef:	90                   	nop
+        putc_unlocked(c, f);
+     af0:	83 ec 08             	sub    $0x8,%esp
+      state = 0;
+     af3:	31 ff                	xor    %edi,%edi
+        putc_unlocked(c, f);
+     af5:	56                   	push   %esi
+     af6:	6a 25                	push   $0x25
+     af8:	e8 43 06 00 00       	call   1140 <putc_unlocked>
+     afd:	83 c4 10             	add    $0x10,%esp
+     b00:	e9 cd fe ff ff       	jmp    9d2 <vfprintf+0x32>
+     b05:	8d 76 00             	lea    0x0(%esi),%esi
+     b08:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     b0d:	bf 4d 20 00 00       	mov    $0x204d,%edi
+     b12:	e9 79 ff ff ff       	jmp    a90 <vfprintf+0xf0>
+     b17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b1e:	66 90                	xchg   %ax,%ax
+
+00000b20 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+     b20:	55                   	push   %ebp
+     b21:	89 e5                	mov    %esp,%ebp
+     b23:	53                   	push   %ebx
+     b24:	83 ec 10             	sub    $0x10,%esp
+     b27:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  flockfile(f);
+     b2a:	53                   	push   %ebx
+     b2b:	e8 d0 02 00 00       	call   e00 <flockfile>
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     b30:	8b 55 0c             	mov    0xc(%ebp),%edx
+     b33:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     b36:	89 d8                	mov    %ebx,%eax
+     b38:	e8 63 fe ff ff       	call   9a0 <vfprintf>
+  funlockfile(f);
+     b3d:	89 1c 24             	mov    %ebx,(%esp)
+     b40:	e8 eb 02 00 00       	call   e30 <funlockfile>
+}
+     b45:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b48:	83 c4 10             	add    $0x10,%esp
+     b4b:	c9                   	leave
+     b4c:	c3                   	ret
+     b4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b50 <printf>:
+
+// Print to the given fd: through stdout or stderr for 1 and 2,
+// otherwise with one write() per call.
+void
+printf(int fd, const char *fmt, ...)
+{
+     b50:	55                   	push   %ebp
+     b51:	89 e5                	mov    %esp,%ebp
+     b53:	56                   	push   %esi
+     b54:	53                   	push   %ebx
+     b55:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+     b5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  char buf[128];
+  struct iobuf f;
+
+  if(fd == 1 || fd == 2){
+    flockfile(&_iob[fd]);
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     b5e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(fd == 1 || fd == 2){
+     b61:	8d 50 ff             	lea    -0x1(%eax),%edx
+     b64:	83 fa 01             	cmp    $0x1,%edx
+     b67:	76 77                	jbe    be0 <printf+0x90>
+    funlockfile(&_iob[fd]);
+    return;
+  }
+  f.fd = fd;
+     b69:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  f.flags = IO_WRITE|IO_SETUP;
+  f.buf = buf;
+     b6f:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  f.size = sizeof(buf);
+  f.r = f.n = 0;
+  mutex_init(&f.lock);
+     b75:	83 ec 0c             	sub    $0xc,%esp
+     b78:	8d 9d 5c ff ff ff    	lea    -0xa4(%ebp),%ebx
+  f.buf = buf;
+     b7e:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+  mutex_init(&f.lock);
+     b84:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  f.flags = IO_WRITE|IO_SETUP;
+     b8a:	c7 85 60 ff ff ff 42 	movl   $0x42,-0xa0(%ebp)
+     b91:	00 00 00 
+  f.size = sizeof(buf);
+     b94:	c7 85 68 ff ff ff 80 	movl   $0x80,-0x98(%ebp)
+     b9b:	00 00 00 
+  f.r = f.n = 0;
+     b9e:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+     ba5:	00 00 00 
+     ba8:	c7 85 6c ff ff ff 00 	movl   $0x0,-0x94(%ebp)
+     baf:	00 00 00 
+  mutex_init(&f.lock);
+     bb2:	50                   	push   %eax
+     bb3:	e8 d8 f9 ff ff       	call   590 <mutex_init>
+  vfprintf(&f, fmt, (uint*)(void*)&fmt + 1);
+     bb8:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     bbb:	89 f2                	mov    %esi,%edx
+     bbd:	89 d8                	mov    %ebx,%eax
+     bbf:	e8 dc fd ff ff       	call   9a0 <vfprintf>
+  fflush(&f);
+     bc4:	89 1c 24             	mov    %ebx,(%esp)
+     bc7:	e8 f4 04 00 00       	call   10c0 <fflush>
+     bcc:	83 c4 10             	add    $0x10,%esp
+}
+     bcf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     bd2:	5b                   	pop    %ebx
+     bd3:	5e                   	pop    %esi
+     bd4:	5d                   	pop    %ebp
+     bd5:	c3                   	ret
+     bd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bdd:	8d 76 00             	lea    0x0(%esi),%esi
+    flockfile(&_iob[fd]);
+     be0:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     be3:	83 ec 0c             	sub    $0xc,%esp
+     be6:	8d 98 40 2a 00 00    	lea    0x2a40(%eax),%ebx
+     bec:	53                   	push   %ebx
+     bed:	e8 0e 02 00 00       	call   e00 <flockfile>
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     bf2:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     bf5:	89 f2                	mov    %esi,%edx
+     bf7:	89 d8                	mov    %ebx,%eax
+     bf9:	e8 a2 fd ff ff       	call   9a0 <vfprintf>
+    funlockfile(&_iob[fd]);
+     bfe:	89 1c 24             	mov    %ebx,(%esp)
+     c01:	e8 2a 02 00 00       	call   e30 <funlockfile>
+     c06:	83 c4 10             	add    $0x10,%esp
+}
+     c09:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     c0c:	5b                   	pop    %ebx
+     c0d:	5e                   	pop    %esi
+     c0e:	5d                   	pop    %ebp
+     c0f:	c3                   	ret
+
+00000c10 <setup>:
+}
+
+// Choose how to buffer f on first use: by lines on a device.
+static void
+setup(FILE *f)
+{
+     c10:	55                   	push   %ebp
+     c11:	89 e5                	mov    %esp,%ebp
+     c13:	53                   	push   %ebx
+     c14:	89 c3                	mov    %eax,%ebx
+     c16:	83 ec 2c             	sub    $0x2c,%esp
+  struct stat st;
+
+  f->flags |= IO_SETUP;
+     c19:	83 48 04 40          	orl    $0x40,0x4(%eax)
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     c1d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     c20:	50                   	push   %eax
+     c21:	ff 33                	push   (%ebx)
+     c23:	e8 52 fb ff ff       	call   77a <fstat>
+     c28:	83 c4 10             	add    $0x10,%esp
+     c2b:	85 c0                	test   %eax,%eax
+    f->flags |= IO_DEV|IO_LINE;
+     c2d:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     c30:	75 07                	jne    c39 <setup+0x29>
+     c32:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+     c37:	74 17                	je     c50 <setup+0x40>
+  if(f->flags & IO_WRITE)
+     c39:	a8 02                	test   $0x2,%al
+     c3b:	74 0a                	je     c47 <setup+0x37>
+    flushhook = flushall;
+     c3d:	c7 05 20 34 00 00 70 	movl   $0xd70,0x3420
+     c44:	0d 00 00 
+}
+     c47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c4a:	c9                   	leave
+     c4b:	c3                   	ret
+     c4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    f->flags |= IO_DEV|IO_LINE;
+     c50:	83 c8 30             	or     $0x30,%eax
+     c53:	89 43 04             	mov    %eax,0x4(%ebx)
+     c56:	eb e1                	jmp    c39 <setup+0x29>
+     c58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c5f:	90                   	nop
+
+00000c60 <flush>:
+static int
+flush(FILE *f)
+{
+  int i, n;
+
+  if(!(f->flags & IO_WRITE))
+     c60:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+     c64:	74 6a                	je     cd0 <flush+0x70>
+{
+     c66:	55                   	push   %ebp
+     c67:	89 e5                	mov    %esp,%ebp
+     c69:	56                   	push   %esi
+     c6a:	89 c6                	mov    %eax,%esi
+     c6c:	53                   	push   %ebx
+    return 0;
+  for(i = 0; i < f->n; i += n){
+     c6d:	8b 40 14             	mov    0x14(%eax),%eax
+     c70:	85 c0                	test   %eax,%eax
+     c72:	7e 4c                	jle    cc0 <flush+0x60>
+     c74:	31 db                	xor    %ebx,%ebx
+     c76:	eb 11                	jmp    c89 <flush+0x29>
+     c78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c7f:	90                   	nop
+     c80:	01 c3                	add    %eax,%ebx
+     c82:	8b 46 14             	mov    0x14(%esi),%eax
+     c85:	39 d8                	cmp    %ebx,%eax
+     c87:	7e 37                	jle    cc0 <flush+0x60>
+    if((n = write(f->fd, f->buf + i, f->n - i)) <= 0){
+     c89:	83 ec 04             	sub    $0x4,%esp
+     c8c:	29 d8                	sub    %ebx,%eax
+     c8e:	50                   	push   %eax
+     c8f:	8b 46 08             	mov    0x8(%esi),%eax
+     c92:	01 d8                	add    %ebx,%eax
+     c94:	50                   	push   %eax
+     c95:	ff 36                	push   (%esi)
+     c97:	e8 75 fa ff ff       	call   711 <write>
+     c9c:	83 c4 10             	add    $0x10,%esp
+     c9f:	85 c0                	test   %eax,%eax
+     ca1:	7f dd                	jg     c80 <flush+0x20>
+      f->flags |= IO_ERR;
+     ca3:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+      f->n = 0;
+     ca7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     cac:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+      return EOF;
+    }
+  }
+  f->n = 0;
+  return 0;
+}
+     cb3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     cb6:	5b                   	pop    %ebx
+     cb7:	5e                   	pop    %esi
+     cb8:	5d                   	pop    %ebp
+     cb9:	c3                   	ret
+     cba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->n = 0;
+     cc0:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+}
+     cc7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+     cca:	31 c0                	xor    %eax,%eax
+}
+     ccc:	5b                   	pop    %ebx
+     ccd:	5e                   	pop    %esi
+     cce:	5d                   	pop    %ebp
+     ccf:	c3                   	ret
+    return 0;
+     cd0:	31 c0                	xor    %eax,%eax
+}
+     cd2:	c3                   	ret
+     cd3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ce0 <fflush.part.0>:
+fflush(FILE *f)
+     ce0:	55                   	push   %ebp
+     ce1:	89 e5                	mov    %esp,%ebp
+     ce3:	57                   	push   %edi
+     ce4:	bf 38 2b 00 00       	mov    $0x2b38,%edi
+     ce9:	56                   	push   %esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     cea:	31 f6                	xor    %esi,%esi
+fflush(FILE *f)
+     cec:	53                   	push   %ebx
+     ced:	bb 58 2a 00 00       	mov    $0x2a58,%ebx
+     cf2:	83 ec 1c             	sub    $0x1c,%esp
+     cf5:	eb 10                	jmp    d07 <fflush.part.0+0x27>
+     cf7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cfe:	66 90                	xchg   %ax,%ax
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     d00:	83 c3 1c             	add    $0x1c,%ebx
+     d03:	39 df                	cmp    %ebx,%edi
+     d05:	74 33                	je     d3a <fflush.part.0+0x5a>
+      if((f->flags & IO_WRITE) && fflush(f) < 0)
+     d07:	f6 43 ec 02          	testb  $0x2,-0x14(%ebx)
+     d0b:	74 f3                	je     d00 <fflush.part.0+0x20>
+  if(threaded)
+     d0d:	8b 0d 40 34 00 00    	mov    0x3440,%ecx
+     d13:	85 c9                	test   %ecx,%ecx
+     d15:	75 49                	jne    d60 <fflush.part.0+0x80>
+  r = flush(f);
+     d17:	8d 43 e8             	lea    -0x18(%ebx),%eax
+     d1a:	e8 41 ff ff ff       	call   c60 <flush>
+  if(threaded)
+     d1f:	8b 15 40 34 00 00    	mov    0x3440,%edx
+     d25:	85 d2                	test   %edx,%edx
+     d27:	75 1f                	jne    d48 <fflush.part.0+0x68>
+        r = EOF;
+     d29:	85 c0                	test   %eax,%eax
+     d2b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     d30:	0f 48 f0             	cmovs  %eax,%esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     d33:	83 c3 1c             	add    $0x1c,%ebx
+     d36:	39 df                	cmp    %ebx,%edi
+     d38:	75 cd                	jne    d07 <fflush.part.0+0x27>
+}
+     d3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d3d:	89 f0                	mov    %esi,%eax
+     d3f:	5b                   	pop    %ebx
+     d40:	5e                   	pop    %esi
+     d41:	5f                   	pop    %edi
+     d42:	5d                   	pop    %ebp
+     d43:	c3                   	ret
+     d44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     d48:	83 ec 0c             	sub    $0xc,%esp
+     d4b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     d4e:	53                   	push   %ebx
+     d4f:	e8 9c f8 ff ff       	call   5f0 <mutex_unlock>
+     d54:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     d57:	83 c4 10             	add    $0x10,%esp
+     d5a:	eb cd                	jmp    d29 <fflush.part.0+0x49>
+     d5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     d60:	83 ec 0c             	sub    $0xc,%esp
+     d63:	53                   	push   %ebx
+     d64:	e8 37 f8 ff ff       	call   5a0 <mutex_lock>
+     d69:	83 c4 10             	add    $0x10,%esp
+     d6c:	eb a9                	jmp    d17 <fflush.part.0+0x37>
+     d6e:	66 90                	xchg   %ax,%ax
+
+00000d70 <flushall>:
+  if(f == 0){
+     d70:	e9 6b ff ff ff       	jmp    ce0 <fflush.part.0>
+     d75:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000d80 <fill>:
+
+// Refill f's buffer. Returns the number of bytes read.
+// Caller holds f's lock.
+static int
+fill(FILE *f)
+{
+     d80:	55                   	push   %ebp
+     d81:	89 e5                	mov    %esp,%ebp
+     d83:	53                   	push   %ebx
+     d84:	89 c3                	mov    %eax,%ebx
+     d86:	83 ec 04             	sub    $0x4,%esp
+  int n;
+
+  if(!(f->flags & IO_SETUP))
+     d89:	8b 40 04             	mov    0x4(%eax),%eax
+     d8c:	a8 40                	test   $0x40,%al
+     d8e:	74 50                	je     de0 <fill+0x60>
+    setup(f);
+  if(f->flags & IO_DEV)
+     d90:	a8 20                	test   $0x20,%al
+     d92:	75 3c                	jne    dd0 <fill+0x50>
+    fflush(0);
+  f->r = 0;
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     d94:	83 ec 04             	sub    $0x4,%esp
+  f->r = 0;
+     d97:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     d9e:	ff 73 0c             	push   0xc(%ebx)
+     da1:	ff 73 08             	push   0x8(%ebx)
+     da4:	ff 33                	push   (%ebx)
+     da6:	e8 57 f9 ff ff       	call   702 <read>
+     dab:	83 c4 10             	add    $0x10,%esp
+     dae:	85 c0                	test   %eax,%eax
+     db0:	7f 10                	jg     dc2 <fill+0x42>
+    f->flags |= n < 0 ? IO_ERR : IO_EOF;
+     db2:	83 f8 01             	cmp    $0x1,%eax
+     db5:	19 c0                	sbb    %eax,%eax
+     db7:	83 e0 fc             	and    $0xfffffffc,%eax
+     dba:	83 c0 08             	add    $0x8,%eax
+     dbd:	09 43 04             	or     %eax,0x4(%ebx)
+    n = 0;
+     dc0:	31 c0                	xor    %eax,%eax
+  }
+  f->n = n;
+     dc2:	89 43 14             	mov    %eax,0x14(%ebx)
+  return n;
+}
+     dc5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     dc8:	c9                   	leave
+     dc9:	c3                   	ret
+     dca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == 0){
+     dd0:	e8 0b ff ff ff       	call   ce0 <fflush.part.0>
+     dd5:	eb bd                	jmp    d94 <fill+0x14>
+     dd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dde:	66 90                	xchg   %ax,%ax
+    setup(f);
+     de0:	89 d8                	mov    %ebx,%eax
+     de2:	e8 29 fe ff ff       	call   c10 <setup>
+  if(f->flags & IO_DEV)
+     de7:	8b 43 04             	mov    0x4(%ebx),%eax
+     dea:	eb a4                	jmp    d90 <fill+0x10>
+     dec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000df0 <stdio_threaded>:
+  threaded = 1;
+     df0:	c7 05 40 34 00 00 01 	movl   $0x1,0x3440
+     df7:	00 00 00 
+}
+     dfa:	c3                   	ret
+     dfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     dff:	90                   	nop
+
+00000e00 <flockfile>:
+{
+     e00:	55                   	push   %ebp
+  if(threaded)
+     e01:	8b 15 40 34 00 00    	mov    0x3440,%edx
+{
+     e07:	89 e5                	mov    %esp,%ebp
+     e09:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     e0c:	85 d2                	test   %edx,%edx
+     e0e:	75 08                	jne    e18 <flockfile+0x18>
+}
+     e10:	5d                   	pop    %ebp
+     e11:	c3                   	ret
+     e12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_lock(&f->lock);
+     e18:	83 c0 18             	add    $0x18,%eax
+     e1b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     e1e:	5d                   	pop    %ebp
+    mutex_lock(&f->lock);
+     e1f:	e9 7c f7 ff ff       	jmp    5a0 <mutex_lock>
+     e24:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e2f:	90                   	nop
+
+00000e30 <funlockfile>:
+{
+     e30:	55                   	push   %ebp
+  if(threaded)
+     e31:	8b 15 40 34 00 00    	mov    0x3440,%edx
+{
+     e37:	89 e5                	mov    %esp,%ebp
+     e39:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     e3c:	85 d2                	test   %edx,%edx
+     e3e:	75 08                	jne    e48 <funlockfile+0x18>
+}
+     e40:	5d                   	pop    %ebp
+     e41:	c3                   	ret
+     e42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&f->lock);
+     e48:	83 c0 18             	add    $0x18,%eax
+     e4b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     e4e:	5d                   	pop    %ebp
+    mutex_unlock(&f->lock);
+     e4f:	e9 9c f7 ff ff       	jmp    5f0 <mutex_unlock>
+     e54:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e5f:	90                   	nop
+
+00000e60 <fopen>:
+{
+     e60:	55                   	push   %ebp
+     e61:	89 e5                	mov    %esp,%ebp
+     e63:	57                   	push   %edi
+     e64:	56                   	push   %esi
+     e65:	53                   	push   %ebx
+     e66:	83 ec 34             	sub    $0x34,%esp
+     e69:	8b 75 0c             	mov    0xc(%ebp),%esi
+     e6c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(strcmp(mode, "r") != 0 && strcmp(mode, "w") != 0)
+     e6f:	68 bd 20 00 00       	push   $0x20bd
+     e74:	56                   	push   %esi
+     e75:	e8 66 f5 ff ff       	call   3e0 <strcmp>
+     e7a:	83 c4 10             	add    $0x10,%esp
+     e7d:	85 c0                	test   %eax,%eax
+     e7f:	74 15                	je     e96 <fopen+0x36>
+     e81:	83 ec 08             	sub    $0x8,%esp
+     e84:	68 bf 20 00 00       	push   $0x20bf
+     e89:	56                   	push   %esi
+     e8a:	e8 51 f5 ff ff       	call   3e0 <strcmp>
+     e8f:	83 c4 10             	add    $0x10,%esp
+     e92:	85 c0                	test   %eax,%eax
+     e94:	75 2c                	jne    ec2 <fopen+0x62>
+  if(threaded)
+     e96:	a1 40 34 00 00       	mov    0x3440,%eax
+     e9b:	85 c0                	test   %eax,%eax
+     e9d:	0f 85 ed 00 00 00    	jne    f90 <fopen+0x130>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     ea3:	bb 94 2a 00 00       	mov    $0x2a94,%ebx
+    if(f->flags == 0)
+     ea8:	8b 53 04             	mov    0x4(%ebx),%edx
+     eab:	85 d2                	test   %edx,%edx
+     ead:	74 21                	je     ed0 <fopen+0x70>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     eaf:	83 c3 1c             	add    $0x1c,%ebx
+     eb2:	81 fb 20 2b 00 00    	cmp    $0x2b20,%ebx
+     eb8:	75 ee                	jne    ea8 <fopen+0x48>
+  if(threaded)
+     eba:	85 c0                	test   %eax,%eax
+     ebc:	0f 85 36 01 00 00    	jne    ff8 <fopen+0x198>
+    return 0;
+     ec2:	31 db                	xor    %ebx,%ebx
+     ec4:	e9 96 00 00 00       	jmp    f5f <fopen+0xff>
+     ec9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f == &_iob[NSTREAM])
+     ed0:	81 fb 20 2b 00 00    	cmp    $0x2b20,%ebx
+     ed6:	74 e2                	je     eba <fopen+0x5a>
+    f->flags = IO_MALLOC;
+     ed8:	c7 43 04 80 00 00 00 	movl   $0x80,0x4(%ebx)
+  if(threaded)
+     edf:	85 c0                	test   %eax,%eax
+     ee1:	0f 85 f9 00 00 00    	jne    fe0 <fopen+0x180>
+  if(mode[0] == 'r'){
+     ee7:	80 3e 72             	cmpb   $0x72,(%esi)
+     eea:	0f 84 c0 00 00 00    	je     fb0 <fopen+0x150>
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     ef0:	83 ec 08             	sub    $0x8,%esp
+     ef3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     ef6:	50                   	push   %eax
+     ef7:	57                   	push   %edi
+     ef8:	e8 d3 f5 ff ff       	call   4d0 <stat>
+     efd:	83 c4 10             	add    $0x10,%esp
+     f00:	85 c0                	test   %eax,%eax
+     f02:	74 6c                	je     f70 <fopen+0x110>
+    fd = open(path, O_CREATE|O_WRONLY);
+     f04:	83 ec 08             	sub    $0x8,%esp
+     f07:	68 01 02 00 00       	push   $0x201
+     f0c:	57                   	push   %edi
+    flags = IO_WRITE;
+     f0d:	bf 02 00 00 00       	mov    $0x2,%edi
+    fd = open(path, O_CREATE|O_WRONLY);
+     f12:	e8 36 f8 ff ff       	call   74d <open>
+     f17:	83 c4 10             	add    $0x10,%esp
+     f1a:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     f1c:	85 f6                	test   %esi,%esi
+     f1e:	0f 88 a9 00 00 00    	js     fcd <fopen+0x16d>
+     f24:	83 ec 0c             	sub    $0xc,%esp
+     f27:	68 00 02 00 00       	push   $0x200
+     f2c:	e8 af 0c 00 00       	call   1be0 <malloc>
+     f31:	83 c4 10             	add    $0x10,%esp
+     f34:	89 43 08             	mov    %eax,0x8(%ebx)
+     f37:	85 c0                	test   %eax,%eax
+     f39:	0f 84 d0 00 00 00    	je     100f <fopen+0x1af>
+  f->flags = flags|IO_MALLOC;
+     f3f:	81 cf 80 00 00 00    	or     $0x80,%edi
+  f->fd = fd;
+     f45:	89 33                	mov    %esi,(%ebx)
+  f->size = BUFSIZ;
+     f47:	c7 43 0c 00 02 00 00 	movl   $0x200,0xc(%ebx)
+  f->r = f->n = 0;
+     f4e:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+     f55:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  f->flags = flags|IO_MALLOC;
+     f5c:	89 7b 04             	mov    %edi,0x4(%ebx)
+}
+     f5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f62:	89 d8                	mov    %ebx,%eax
+     f64:	5b                   	pop    %ebx
+     f65:	5e                   	pop    %esi
+     f66:	5f                   	pop    %edi
+     f67:	5d                   	pop    %ebp
+     f68:	c3                   	ret
+     f69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     f70:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+     f75:	75 8d                	jne    f04 <fopen+0xa4>
+      unlink(path);
+     f77:	83 ec 0c             	sub    $0xc,%esp
+     f7a:	57                   	push   %edi
+     f7b:	e8 eb f7 ff ff       	call   76b <unlink>
+     f80:	83 c4 10             	add    $0x10,%esp
+     f83:	e9 7c ff ff ff       	jmp    f04 <fopen+0xa4>
+     f88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f8f:	90                   	nop
+    mutex_lock(&iolock);
+     f90:	83 ec 0c             	sub    $0xc,%esp
+     f93:	68 44 34 00 00       	push   $0x3444
+     f98:	e8 03 f6 ff ff       	call   5a0 <mutex_lock>
+  if(threaded)
+     f9d:	a1 40 34 00 00       	mov    0x3440,%eax
+     fa2:	83 c4 10             	add    $0x10,%esp
+     fa5:	e9 f9 fe ff ff       	jmp    ea3 <fopen+0x43>
+     faa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    fd = open(path, O_RDONLY);
+     fb0:	83 ec 08             	sub    $0x8,%esp
+     fb3:	6a 00                	push   $0x0
+     fb5:	57                   	push   %edi
+    flags = IO_READ;
+     fb6:	bf 01 00 00 00       	mov    $0x1,%edi
+    fd = open(path, O_RDONLY);
+     fbb:	e8 8d f7 ff ff       	call   74d <open>
+     fc0:	83 c4 10             	add    $0x10,%esp
+     fc3:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     fc5:	85 f6                	test   %esi,%esi
+     fc7:	0f 89 57 ff ff ff    	jns    f24 <fopen+0xc4>
+    f->flags = 0;
+     fcd:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    return 0;
+     fd4:	31 db                	xor    %ebx,%ebx
+     fd6:	eb 87                	jmp    f5f <fopen+0xff>
+     fd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fdf:	90                   	nop
+    mutex_unlock(&iolock);
+     fe0:	83 ec 0c             	sub    $0xc,%esp
+     fe3:	68 44 34 00 00       	push   $0x3444
+     fe8:	e8 03 f6 ff ff       	call   5f0 <mutex_unlock>
+     fed:	83 c4 10             	add    $0x10,%esp
+     ff0:	e9 f2 fe ff ff       	jmp    ee7 <fopen+0x87>
+     ff5:	8d 76 00             	lea    0x0(%esi),%esi
+     ff8:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+     ffb:	31 db                	xor    %ebx,%ebx
+    mutex_unlock(&iolock);
+     ffd:	68 44 34 00 00       	push   $0x3444
+    1002:	e8 e9 f5 ff ff       	call   5f0 <mutex_unlock>
+    1007:	83 c4 10             	add    $0x10,%esp
+    100a:	e9 50 ff ff ff       	jmp    f5f <fopen+0xff>
+      close(fd);
+    100f:	83 ec 0c             	sub    $0xc,%esp
+    1012:	56                   	push   %esi
+    1013:	e8 08 f7 ff ff       	call   720 <close>
+    1018:	83 c4 10             	add    $0x10,%esp
+    101b:	eb b0                	jmp    fcd <fopen+0x16d>
+    101d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001020 <fclose>:
+{
+    1020:	55                   	push   %ebp
+    1021:	89 e5                	mov    %esp,%ebp
+    1023:	56                   	push   %esi
+    1024:	53                   	push   %ebx
+  if(threaded)
+    1025:	8b 15 40 34 00 00    	mov    0x3440,%edx
+{
+    102b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    102e:	85 d2                	test   %edx,%edx
+    1030:	75 46                	jne    1078 <fclose+0x58>
+  r = flush(f);
+    1032:	89 d8                	mov    %ebx,%eax
+    1034:	e8 27 fc ff ff       	call   c60 <flush>
+  if(close(f->fd) < 0)
+    1039:	83 ec 0c             	sub    $0xc,%esp
+    103c:	ff 33                	push   (%ebx)
+  r = flush(f);
+    103e:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    1040:	e8 db f6 ff ff       	call   720 <close>
+    1045:	83 c4 10             	add    $0x10,%esp
+    r = EOF;
+    1048:	85 c0                	test   %eax,%eax
+    104a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    104f:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->flags & IO_MALLOC)
+    1052:	f6 43 04 80          	testb  $0x80,0x4(%ebx)
+    1056:	75 58                	jne    10b0 <fclose+0x90>
+  if(threaded)
+    1058:	a1 40 34 00 00       	mov    0x3440,%eax
+  f->flags = 0;
+    105d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  if(threaded)
+    1064:	85 c0                	test   %eax,%eax
+    1066:	75 28                	jne    1090 <fclose+0x70>
+}
+    1068:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    106b:	89 f0                	mov    %esi,%eax
+    106d:	5b                   	pop    %ebx
+    106e:	5e                   	pop    %esi
+    106f:	5d                   	pop    %ebp
+    1070:	c3                   	ret
+    1071:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    1078:	83 ec 0c             	sub    $0xc,%esp
+    107b:	8d 43 18             	lea    0x18(%ebx),%eax
+    107e:	50                   	push   %eax
+    107f:	e8 1c f5 ff ff       	call   5a0 <mutex_lock>
+    1084:	83 c4 10             	add    $0x10,%esp
+    1087:	eb a9                	jmp    1032 <fclose+0x12>
+    1089:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1090:	83 ec 0c             	sub    $0xc,%esp
+    1093:	83 c3 18             	add    $0x18,%ebx
+    1096:	53                   	push   %ebx
+    1097:	e8 54 f5 ff ff       	call   5f0 <mutex_unlock>
+    109c:	83 c4 10             	add    $0x10,%esp
+}
+    109f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    10a2:	89 f0                	mov    %esi,%eax
+    10a4:	5b                   	pop    %ebx
+    10a5:	5e                   	pop    %esi
+    10a6:	5d                   	pop    %ebp
+    10a7:	c3                   	ret
+    10a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10af:	90                   	nop
+    free(f->buf);
+    10b0:	83 ec 0c             	sub    $0xc,%esp
+    10b3:	ff 73 08             	push   0x8(%ebx)
+    10b6:	e8 f5 09 00 00       	call   1ab0 <free>
+    10bb:	83 c4 10             	add    $0x10,%esp
+    10be:	eb 98                	jmp    1058 <fclose+0x38>
+
+000010c0 <fflush>:
+{
+    10c0:	55                   	push   %ebp
+    10c1:	89 e5                	mov    %esp,%ebp
+    10c3:	53                   	push   %ebx
+    10c4:	83 ec 14             	sub    $0x14,%esp
+    10c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f == 0){
+    10ca:	85 db                	test   %ebx,%ebx
+    10cc:	74 5a                	je     1128 <fflush+0x68>
+  if(threaded)
+    10ce:	8b 0d 40 34 00 00    	mov    0x3440,%ecx
+    10d4:	85 c9                	test   %ecx,%ecx
+    10d6:	75 18                	jne    10f0 <fflush+0x30>
+  r = flush(f);
+    10d8:	89 d8                	mov    %ebx,%eax
+    10da:	e8 81 fb ff ff       	call   c60 <flush>
+  if(threaded)
+    10df:	8b 15 40 34 00 00    	mov    0x3440,%edx
+    10e5:	85 d2                	test   %edx,%edx
+    10e7:	75 1f                	jne    1108 <fflush+0x48>
+}
+    10e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10ec:	c9                   	leave
+    10ed:	c3                   	ret
+    10ee:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    10f0:	83 ec 0c             	sub    $0xc,%esp
+    10f3:	8d 43 18             	lea    0x18(%ebx),%eax
+    10f6:	50                   	push   %eax
+    10f7:	e8 a4 f4 ff ff       	call   5a0 <mutex_lock>
+    10fc:	83 c4 10             	add    $0x10,%esp
+    10ff:	eb d7                	jmp    10d8 <fflush+0x18>
+    1101:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1108:	83 ec 0c             	sub    $0xc,%esp
+    110b:	83 c3 18             	add    $0x18,%ebx
+    110e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1111:	53                   	push   %ebx
+    1112:	e8 d9 f4 ff ff       	call   5f0 <mutex_unlock>
+    1117:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    111a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    mutex_unlock(&f->lock);
+    111d:	83 c4 10             	add    $0x10,%esp
+}
+    1120:	c9                   	leave
+    1121:	c3                   	ret
+    1122:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1128:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    112b:	c9                   	leave
+    112c:	e9 af fb ff ff       	jmp    ce0 <fflush.part.0>
+    1131:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1138:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    113f:	90                   	nop
+
+00001140 <putc_unlocked>:
+{
+    1140:	55                   	push   %ebp
+    1141:	89 e5                	mov    %esp,%ebp
+    1143:	56                   	push   %esi
+    1144:	53                   	push   %ebx
+    1145:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    1148:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(!(f->flags & IO_WRITE))
+    114b:	8b 43 04             	mov    0x4(%ebx),%eax
+    114e:	a8 02                	test   $0x2,%al
+    1150:	74 46                	je     1198 <putc_unlocked+0x58>
+  if(!(f->flags & IO_SETUP))
+    1152:	a8 40                	test   $0x40,%al
+    1154:	74 4a                	je     11a0 <putc_unlocked+0x60>
+  if(f->n == f->size && flush(f) < 0)
+    1156:	8b 43 14             	mov    0x14(%ebx),%eax
+    1159:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    115c:	74 51                	je     11af <putc_unlocked+0x6f>
+  f->buf[f->n++] = c;
+    115e:	8d 48 01             	lea    0x1(%eax),%ecx
+    1161:	8b 53 08             	mov    0x8(%ebx),%edx
+    1164:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    1167:	89 f1                	mov    %esi,%ecx
+    1169:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    116c:	83 fe 0a             	cmp    $0xa,%esi
+    116f:	74 0f                	je     1180 <putc_unlocked+0x40>
+  return c & 0xff;
+    1171:	89 f0                	mov    %esi,%eax
+    1173:	0f b6 c0             	movzbl %al,%eax
+}
+    1176:	5b                   	pop    %ebx
+    1177:	5e                   	pop    %esi
+    1178:	5d                   	pop    %ebp
+    1179:	c3                   	ret
+    117a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    1180:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1184:	74 eb                	je     1171 <putc_unlocked+0x31>
+    1186:	89 d8                	mov    %ebx,%eax
+    1188:	e8 d3 fa ff ff       	call   c60 <flush>
+    118d:	85 c0                	test   %eax,%eax
+    118f:	79 e0                	jns    1171 <putc_unlocked+0x31>
+    1191:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return EOF;
+    1198:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    119d:	eb d7                	jmp    1176 <putc_unlocked+0x36>
+    119f:	90                   	nop
+    setup(f);
+    11a0:	89 d8                	mov    %ebx,%eax
+    11a2:	e8 69 fa ff ff       	call   c10 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    11a7:	8b 43 14             	mov    0x14(%ebx),%eax
+    11aa:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    11ad:	75 af                	jne    115e <putc_unlocked+0x1e>
+    11af:	89 d8                	mov    %ebx,%eax
+    11b1:	e8 aa fa ff ff       	call   c60 <flush>
+    11b6:	85 c0                	test   %eax,%eax
+    11b8:	78 de                	js     1198 <putc_unlocked+0x58>
+  f->buf[f->n++] = c;
+    11ba:	8b 43 14             	mov    0x14(%ebx),%eax
+    11bd:	eb 9f                	jmp    115e <putc_unlocked+0x1e>
+    11bf:	90                   	nop
+
+000011c0 <fputc>:
+{
+    11c0:	55                   	push   %ebp
+    11c1:	89 e5                	mov    %esp,%ebp
+    11c3:	56                   	push   %esi
+    11c4:	53                   	push   %ebx
+  if(threaded)
+    11c5:	8b 15 40 34 00 00    	mov    0x3440,%edx
+{
+    11cb:	8b 75 08             	mov    0x8(%ebp),%esi
+    11ce:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(threaded)
+    11d1:	85 d2                	test   %edx,%edx
+    11d3:	75 6b                	jne    1240 <fputc+0x80>
+  if(!(f->flags & IO_WRITE))
+    11d5:	8b 43 04             	mov    0x4(%ebx),%eax
+    11d8:	a8 02                	test   $0x2,%al
+    11da:	0f 84 b8 00 00 00    	je     1298 <fputc+0xd8>
+  if(!(f->flags & IO_SETUP))
+    11e0:	a8 40                	test   $0x40,%al
+    11e2:	74 76                	je     125a <fputc+0x9a>
+  if(f->n == f->size && flush(f) < 0)
+    11e4:	8b 43 14             	mov    0x14(%ebx),%eax
+    11e7:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    11ea:	74 7d                	je     1269 <fputc+0xa9>
+  f->buf[f->n++] = c;
+    11ec:	8d 48 01             	lea    0x1(%eax),%ecx
+    11ef:	8b 53 08             	mov    0x8(%ebx),%edx
+    11f2:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    11f5:	89 f1                	mov    %esi,%ecx
+    11f7:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    11fa:	83 fe 0a             	cmp    $0xa,%esi
+    11fd:	74 21                	je     1220 <fputc+0x60>
+  return c & 0xff;
+    11ff:	89 f0                	mov    %esi,%eax
+    1201:	0f b6 f0             	movzbl %al,%esi
+  if(threaded)
+    1204:	a1 40 34 00 00       	mov    0x3440,%eax
+    1209:	85 c0                	test   %eax,%eax
+    120b:	75 73                	jne    1280 <fputc+0xc0>
+}
+    120d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1210:	89 f0                	mov    %esi,%eax
+    1212:	5b                   	pop    %ebx
+    1213:	5e                   	pop    %esi
+    1214:	5d                   	pop    %ebp
+    1215:	c3                   	ret
+    1216:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    121d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    1220:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1224:	74 d9                	je     11ff <fputc+0x3f>
+    1226:	89 d8                	mov    %ebx,%eax
+    1228:	e8 33 fa ff ff       	call   c60 <flush>
+    122d:	85 c0                	test   %eax,%eax
+    122f:	79 ce                	jns    11ff <fputc+0x3f>
+    return EOF;
+    1231:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1236:	eb cc                	jmp    1204 <fputc+0x44>
+    1238:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    123f:	90                   	nop
+    mutex_lock(&f->lock);
+    1240:	83 ec 0c             	sub    $0xc,%esp
+    1243:	8d 43 18             	lea    0x18(%ebx),%eax
+    1246:	50                   	push   %eax
+    1247:	e8 54 f3 ff ff       	call   5a0 <mutex_lock>
+  if(!(f->flags & IO_WRITE))
+    124c:	8b 43 04             	mov    0x4(%ebx),%eax
+    124f:	83 c4 10             	add    $0x10,%esp
+    1252:	a8 02                	test   $0x2,%al
+    1254:	74 db                	je     1231 <fputc+0x71>
+  if(!(f->flags & IO_SETUP))
+    1256:	a8 40                	test   $0x40,%al
+    1258:	75 8a                	jne    11e4 <fputc+0x24>
+    setup(f);
+    125a:	89 d8                	mov    %ebx,%eax
+    125c:	e8 af f9 ff ff       	call   c10 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    1261:	8b 43 14             	mov    0x14(%ebx),%eax
+    1264:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    1267:	75 83                	jne    11ec <fputc+0x2c>
+    1269:	89 d8                	mov    %ebx,%eax
+    126b:	e8 f0 f9 ff ff       	call   c60 <flush>
+    1270:	85 c0                	test   %eax,%eax
+    1272:	78 bd                	js     1231 <fputc+0x71>
+  f->buf[f->n++] = c;
+    1274:	8b 43 14             	mov    0x14(%ebx),%eax
+    1277:	e9 70 ff ff ff       	jmp    11ec <fputc+0x2c>
+    127c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1280:	83 ec 0c             	sub    $0xc,%esp
+    1283:	83 c3 18             	add    $0x18,%ebx
+    1286:	53                   	push   %ebx
+    1287:	e8 64 f3 ff ff       	call   5f0 <mutex_unlock>
+    128c:	83 c4 10             	add    $0x10,%esp
+}
+    128f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1292:	89 f0                	mov    %esi,%eax
+    1294:	5b                   	pop    %ebx
+    1295:	5e                   	pop    %esi
+    1296:	5d                   	pop    %ebp
+    1297:	c3                   	ret
+    return EOF;
+    1298:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    129d:	e9 6b ff ff ff       	jmp    120d <fputc+0x4d>
+    12a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000012b0 <fwrite>:
+{
+    12b0:	55                   	push   %ebp
+    12b1:	89 e5                	mov    %esp,%ebp
+    12b3:	57                   	push   %edi
+    12b4:	56                   	push   %esi
+    12b5:	53                   	push   %ebx
+    12b6:	83 ec 1c             	sub    $0x1c,%esp
+    12b9:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  if(!(f->flags & IO_WRITE) || size <= 0)
+    12bc:	8b 43 04             	mov    0x4(%ebx),%eax
+    12bf:	a8 02                	test   $0x2,%al
+    12c1:	0f 84 ec 00 00 00    	je     13b3 <fwrite+0x103>
+    12c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    12ca:	85 c9                	test   %ecx,%ecx
+    12cc:	0f 8e e1 00 00 00    	jle    13b3 <fwrite+0x103>
+  if(threaded)
+    12d2:	8b 15 40 34 00 00    	mov    0x3440,%edx
+    12d8:	85 d2                	test   %edx,%edx
+    12da:	0f 85 1c 01 00 00    	jne    13fc <fwrite+0x14c>
+  if(!(f->flags & IO_SETUP))
+    12e0:	a8 40                	test   $0x40,%al
+    12e2:	0f 84 08 01 00 00    	je     13f0 <fwrite+0x140>
+  for(len = size*nmemb; len > 0; len -= n){
+    12e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+    12eb:	0f af 45 10          	imul   0x10(%ebp),%eax
+    12ef:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    12f2:	85 c0                	test   %eax,%eax
+    12f4:	0f 8e 2a 01 00 00    	jle    1424 <fwrite+0x174>
+  s = p;
+    12fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  nl = 0;
+    12fd:	31 ff                	xor    %edi,%edi
+    12ff:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+        nl = 1;
+    1302:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  s = p;
+    1305:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1308:	8b 43 14             	mov    0x14(%ebx),%eax
+        nl = 1;
+    130b:	89 ce                	mov    %ecx,%esi
+    if(f->n == f->size && flush(f) < 0)
+    130d:	89 c2                	mov    %eax,%edx
+    130f:	39 f0                	cmp    %esi,%eax
+    1311:	74 6e                	je     1381 <fwrite+0xd1>
+    1313:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1317:	90                   	nop
+    if(n > len)
+    1318:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    n = f->size - f->n;
+    131b:	89 f1                	mov    %esi,%ecx
+    131d:	29 c1                	sub    %eax,%ecx
+    131f:	39 f9                	cmp    %edi,%ecx
+    1321:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1324:	85 c9                	test   %ecx,%ecx
+    1326:	0f 8e 7c 00 00 00    	jle    13a8 <fwrite+0xf8>
+    132c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    132f:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1332:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    1335:	8d 34 08             	lea    (%eax,%ecx,1),%esi
+    1338:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    133b:	eb 06                	jmp    1343 <fwrite+0x93>
+    133d:	8d 76 00             	lea    0x0(%esi),%esi
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1340:	8b 53 14             	mov    0x14(%ebx),%edx
+    1343:	8d 4a 01             	lea    0x1(%edx),%ecx
+    1346:	8b 73 08             	mov    0x8(%ebx),%esi
+    1349:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    134c:	0f b6 08             	movzbl (%eax),%ecx
+        nl = 1;
+    134f:	80 f9 0a             	cmp    $0xa,%cl
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1352:	88 0c 16             	mov    %cl,(%esi,%edx,1)
+        nl = 1;
+    1355:	be 01 00 00 00       	mov    $0x1,%esi
+    135a:	0f 44 fe             	cmove  %esi,%edi
+    for(i = 0; i < n; i++)
+    135d:	83 c0 01             	add    $0x1,%eax
+    1360:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    1363:	75 db                	jne    1340 <fwrite+0x90>
+    s += n;
+    1365:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1368:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    136b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    s += n;
+    136e:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    1371:	85 c0                	test   %eax,%eax
+    1373:	7e 48                	jle    13bd <fwrite+0x10d>
+    1375:	8b 43 14             	mov    0x14(%ebx),%eax
+    1378:	8b 73 0c             	mov    0xc(%ebx),%esi
+    if(f->n == f->size && flush(f) < 0)
+    137b:	89 c2                	mov    %eax,%edx
+    137d:	39 f0                	cmp    %esi,%eax
+    137f:	75 97                	jne    1318 <fwrite+0x68>
+    1381:	89 d8                	mov    %ebx,%eax
+    1383:	e8 d8 f8 ff ff       	call   c60 <flush>
+    1388:	85 c0                	test   %eax,%eax
+    138a:	78 31                	js     13bd <fwrite+0x10d>
+    n = f->size - f->n;
+    138c:	8b 73 0c             	mov    0xc(%ebx),%esi
+    138f:	8b 43 14             	mov    0x14(%ebx),%eax
+    1392:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    1395:	89 f1                	mov    %esi,%ecx
+    1397:	89 c2                	mov    %eax,%edx
+    1399:	29 c1                	sub    %eax,%ecx
+    139b:	39 f9                	cmp    %edi,%ecx
+    139d:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    13a0:	85 c9                	test   %ecx,%ecx
+    13a2:	7f 88                	jg     132c <fwrite+0x7c>
+    13a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    s += n;
+    13a8:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    13ab:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    13ae:	e9 5a ff ff ff       	jmp    130d <fwrite+0x5d>
+}
+    13b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    13b6:	31 c0                	xor    %eax,%eax
+}
+    13b8:	5b                   	pop    %ebx
+    13b9:	5e                   	pop    %esi
+    13ba:	5f                   	pop    %edi
+    13bb:	5d                   	pop    %ebp
+    13bc:	c3                   	ret
+  if(nl && (f->flags & IO_LINE))
+    13bd:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    13c0:	85 ff                	test   %edi,%edi
+    13c2:	74 06                	je     13ca <fwrite+0x11a>
+    13c4:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    13c8:	75 1d                	jne    13e7 <fwrite+0x137>
+  return (s - (const char*)p) / size;
+    13ca:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    13cd:	2b 75 08             	sub    0x8(%ebp),%esi
+  if(threaded)
+    13d0:	a1 40 34 00 00       	mov    0x3440,%eax
+    13d5:	85 c0                	test   %eax,%eax
+    13d7:	75 3a                	jne    1413 <fwrite+0x163>
+  return (s - (const char*)p) / size;
+    13d9:	89 f0                	mov    %esi,%eax
+    13db:	99                   	cltd
+    13dc:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    13df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13e2:	5b                   	pop    %ebx
+    13e3:	5e                   	pop    %esi
+    13e4:	5f                   	pop    %edi
+    13e5:	5d                   	pop    %ebp
+    13e6:	c3                   	ret
+    flush(f);
+    13e7:	89 d8                	mov    %ebx,%eax
+    13e9:	e8 72 f8 ff ff       	call   c60 <flush>
+    13ee:	eb da                	jmp    13ca <fwrite+0x11a>
+    setup(f);
+    13f0:	89 d8                	mov    %ebx,%eax
+    13f2:	e8 19 f8 ff ff       	call   c10 <setup>
+    13f7:	e9 ec fe ff ff       	jmp    12e8 <fwrite+0x38>
+    mutex_lock(&f->lock);
+    13fc:	83 ec 0c             	sub    $0xc,%esp
+    13ff:	8d 43 18             	lea    0x18(%ebx),%eax
+    1402:	50                   	push   %eax
+    1403:	e8 98 f1 ff ff       	call   5a0 <mutex_lock>
+  if(!(f->flags & IO_SETUP))
+    1408:	8b 43 04             	mov    0x4(%ebx),%eax
+    140b:	83 c4 10             	add    $0x10,%esp
+    140e:	e9 cd fe ff ff       	jmp    12e0 <fwrite+0x30>
+    mutex_unlock(&f->lock);
+    1413:	83 ec 0c             	sub    $0xc,%esp
+    1416:	83 c3 18             	add    $0x18,%ebx
+    1419:	53                   	push   %ebx
+    141a:	e8 d1 f1 ff ff       	call   5f0 <mutex_unlock>
+    141f:	83 c4 10             	add    $0x10,%esp
+    1422:	eb b5                	jmp    13d9 <fwrite+0x129>
+  for(len = size*nmemb; len > 0; len -= n){
+    1424:	31 f6                	xor    %esi,%esi
+    1426:	eb a8                	jmp    13d0 <fwrite+0x120>
+    1428:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    142f:	90                   	nop
+
+00001430 <fgetc>:
+  return f->buf[f->r++] & 0xff;
+}
+
+int
+fgetc(FILE *f)
+{
+    1430:	55                   	push   %ebp
+    1431:	89 e5                	mov    %esp,%ebp
+    1433:	56                   	push   %esi
+    1434:	53                   	push   %ebx
+  if(threaded)
+    1435:	8b 15 40 34 00 00    	mov    0x3440,%edx
+{
+    143b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    143e:	85 d2                	test   %edx,%edx
+    1440:	75 2e                	jne    1470 <fgetc+0x40>
+  if(!(f->flags & IO_READ))
+    1442:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1446:	74 78                	je     14c0 <fgetc+0x90>
+  if(f->r == f->n && fill(f) == 0)
+    1448:	8b 43 10             	mov    0x10(%ebx),%eax
+    144b:	3b 43 14             	cmp    0x14(%ebx),%eax
+    144e:	74 60                	je     14b0 <fgetc+0x80>
+  return f->buf[f->r++] & 0xff;
+    1450:	8b 53 08             	mov    0x8(%ebx),%edx
+    1453:	8d 48 01             	lea    0x1(%eax),%ecx
+    1456:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1459:	0f b6 34 02          	movzbl (%edx,%eax,1),%esi
+  if(threaded)
+    145d:	a1 40 34 00 00       	mov    0x3440,%eax
+    1462:	85 c0                	test   %eax,%eax
+    1464:	75 2a                	jne    1490 <fgetc+0x60>
+
+  flockfile(f);
+  c = getc_unlocked(f);
+  funlockfile(f);
+  return c;
+}
+    1466:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1469:	89 f0                	mov    %esi,%eax
+    146b:	5b                   	pop    %ebx
+    146c:	5e                   	pop    %esi
+    146d:	5d                   	pop    %ebp
+    146e:	c3                   	ret
+    146f:	90                   	nop
+    mutex_lock(&f->lock);
+    1470:	83 ec 0c             	sub    $0xc,%esp
+    1473:	8d 43 18             	lea    0x18(%ebx),%eax
+    1476:	50                   	push   %eax
+    1477:	e8 24 f1 ff ff       	call   5a0 <mutex_lock>
+  if(!(f->flags & IO_READ))
+    147c:	83 c4 10             	add    $0x10,%esp
+    147f:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1483:	75 c3                	jne    1448 <fgetc+0x18>
+    return EOF;
+    1485:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    148a:	eb d1                	jmp    145d <fgetc+0x2d>
+    148c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1490:	83 ec 0c             	sub    $0xc,%esp
+    1493:	83 c3 18             	add    $0x18,%ebx
+    1496:	53                   	push   %ebx
+    1497:	e8 54 f1 ff ff       	call   5f0 <mutex_unlock>
+    149c:	83 c4 10             	add    $0x10,%esp
+}
+    149f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    14a2:	89 f0                	mov    %esi,%eax
+    14a4:	5b                   	pop    %ebx
+    14a5:	5e                   	pop    %esi
+    14a6:	5d                   	pop    %ebp
+    14a7:	c3                   	ret
+    14a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14af:	90                   	nop
+  if(f->r == f->n && fill(f) == 0)
+    14b0:	89 d8                	mov    %ebx,%eax
+    14b2:	e8 c9 f8 ff ff       	call   d80 <fill>
+    14b7:	85 c0                	test   %eax,%eax
+    14b9:	74 ca                	je     1485 <fgetc+0x55>
+  return f->buf[f->r++] & 0xff;
+    14bb:	8b 43 10             	mov    0x10(%ebx),%eax
+    14be:	eb 90                	jmp    1450 <fgetc+0x20>
+    return EOF;
+    14c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    14c5:	eb 9f                	jmp    1466 <fgetc+0x36>
+    14c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14ce:	66 90                	xchg   %ax,%ax
+
+000014d0 <fread>:
+
+int
+fread(void *p, int size, int nmemb, FILE *f)
+{
+    14d0:	55                   	push   %ebp
+    14d1:	89 e5                	mov    %esp,%ebp
+    14d3:	57                   	push   %edi
+    14d4:	56                   	push   %esi
+    14d5:	53                   	push   %ebx
+    14d6:	83 ec 1c             	sub    $0x1c,%esp
+    14d9:	8b 75 14             	mov    0x14(%ebp),%esi
+  char *d;
+  int n, len;
+
+  if(!(f->flags & IO_READ) || size <= 0)
+    14dc:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+    14e0:	74 7e                	je     1560 <fread+0x90>
+    14e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+    14e5:	85 d2                	test   %edx,%edx
+    14e7:	7e 77                	jle    1560 <fread+0x90>
+  if(threaded)
+    14e9:	a1 40 34 00 00       	mov    0x3440,%eax
+    return 0;
+  flockfile(f);
+  d = p;
+  for(len = size*nmemb; len > 0; len -= n){
+    14ee:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    14f1:	0f af 7d 10          	imul   0x10(%ebp),%edi
+  if(threaded)
+    14f5:	85 c0                	test   %eax,%eax
+    14f7:	0f 85 93 00 00 00    	jne    1590 <fread+0xc0>
+  for(len = size*nmemb; len > 0; len -= n){
+    14fd:	85 ff                	test   %edi,%edi
+    14ff:	7e 61                	jle    1562 <fread+0x92>
+    if(f->r == f->n && fill(f) == 0)
+    1501:	8b 46 10             	mov    0x10(%esi),%eax
+  d = p;
+    1504:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1507:	eb 35                	jmp    153e <fread+0x6e>
+    1509:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      break;
+    n = f->n - f->r;
+    1510:	29 c3                	sub    %eax,%ebx
+    1512:	39 fb                	cmp    %edi,%ebx
+    1514:	0f 4f df             	cmovg  %edi,%ebx
+    if(n > len)
+      n = len;
+    memmove(d, f->buf + f->r, n);
+    1517:	83 ec 04             	sub    $0x4,%esp
+    151a:	53                   	push   %ebx
+    151b:	03 46 08             	add    0x8(%esi),%eax
+  for(len = size*nmemb; len > 0; len -= n){
+    151e:	29 df                	sub    %ebx,%edi
+    memmove(d, f->buf + f->r, n);
+    1520:	50                   	push   %eax
+    1521:	51                   	push   %ecx
+    1522:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1525:	e8 36 f0 ff ff       	call   560 <memmove>
+    f->r += n;
+    152a:	8b 46 10             	mov    0x10(%esi),%eax
+    d += n;
+    152d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1530:	83 c4 10             	add    $0x10,%esp
+    f->r += n;
+    1533:	01 d8                	add    %ebx,%eax
+    d += n;
+    1535:	01 d9                	add    %ebx,%ecx
+    f->r += n;
+    1537:	89 46 10             	mov    %eax,0x10(%esi)
+  for(len = size*nmemb; len > 0; len -= n){
+    153a:	85 ff                	test   %edi,%edi
+    153c:	7e 32                	jle    1570 <fread+0xa0>
+    if(f->r == f->n && fill(f) == 0)
+    153e:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1541:	39 c3                	cmp    %eax,%ebx
+    1543:	75 cb                	jne    1510 <fread+0x40>
+    1545:	89 f0                	mov    %esi,%eax
+    1547:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    154a:	e8 31 f8 ff ff       	call   d80 <fill>
+    154f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1552:	85 c0                	test   %eax,%eax
+    1554:	74 1a                	je     1570 <fread+0xa0>
+    n = f->n - f->r;
+    1556:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1559:	8b 46 10             	mov    0x10(%esi),%eax
+    155c:	eb b2                	jmp    1510 <fread+0x40>
+    155e:	66 90                	xchg   %ax,%ax
+    return 0;
+    1560:	31 c0                	xor    %eax,%eax
+  }
+  funlockfile(f);
+  return (d - (char*)p) / size;
+}
+    1562:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1565:	5b                   	pop    %ebx
+    1566:	5e                   	pop    %esi
+    1567:	5f                   	pop    %edi
+    1568:	5d                   	pop    %ebp
+    1569:	c3                   	ret
+    156a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (d - (char*)p) / size;
+    1570:	2b 4d 08             	sub    0x8(%ebp),%ecx
+    1573:	89 cb                	mov    %ecx,%ebx
+  if(threaded)
+    1575:	a1 40 34 00 00       	mov    0x3440,%eax
+    157a:	85 c0                	test   %eax,%eax
+    157c:	75 32                	jne    15b0 <fread+0xe0>
+  return (d - (char*)p) / size;
+    157e:	89 d8                	mov    %ebx,%eax
+    1580:	99                   	cltd
+    1581:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1584:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1587:	5b                   	pop    %ebx
+    1588:	5e                   	pop    %esi
+    1589:	5f                   	pop    %edi
+    158a:	5d                   	pop    %ebp
+    158b:	c3                   	ret
+    158c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    1590:	83 ec 0c             	sub    $0xc,%esp
+    1593:	8d 46 18             	lea    0x18(%esi),%eax
+    1596:	50                   	push   %eax
+    1597:	e8 04 f0 ff ff       	call   5a0 <mutex_lock>
+  for(len = size*nmemb; len > 0; len -= n){
+    159c:	83 c4 10             	add    $0x10,%esp
+    159f:	85 ff                	test   %edi,%edi
+    15a1:	0f 8f 5a ff ff ff    	jg     1501 <fread+0x31>
+    15a7:	31 db                	xor    %ebx,%ebx
+    15a9:	eb ca                	jmp    1575 <fread+0xa5>
+    15ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    15af:	90                   	nop
+    mutex_unlock(&f->lock);
+    15b0:	83 ec 0c             	sub    $0xc,%esp
+    15b3:	83 c6 18             	add    $0x18,%esi
+    15b6:	56                   	push   %esi
+    15b7:	e8 34 f0 ff ff       	call   5f0 <mutex_unlock>
+  return (d - (char*)p) / size;
+    15bc:	89 d8                	mov    %ebx,%eax
+    15be:	83 c4 10             	add    $0x10,%esp
+    15c1:	99                   	cltd
+    15c2:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    15c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15c8:	5b                   	pop    %ebx
+    15c9:	5e                   	pop    %esi
+    15ca:	5f                   	pop    %edi
+    15cb:	5d                   	pop    %ebp
+    15cc:	c3                   	ret
+    15cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000015d0 <fgets>:
+
+// Read a line of at most max-1 bytes, keeping the newline.
+// Returns 0 if there was nothing left to read.
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    15d0:	55                   	push   %ebp
+    15d1:	89 e5                	mov    %esp,%ebp
+    15d3:	57                   	push   %edi
+    15d4:	56                   	push   %esi
+    15d5:	53                   	push   %ebx
+    15d6:	83 ec 1c             	sub    $0x1c,%esp
+  if(threaded)
+    15d9:	8b 35 40 34 00 00    	mov    0x3440,%esi
+{
+    15df:	8b 7d 08             	mov    0x8(%ebp),%edi
+    15e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if(threaded)
+    15e5:	85 f6                	test   %esi,%esi
+    15e7:	0f 85 83 00 00 00    	jne    1670 <fgets+0xa0>
+{
+    15ed:	31 f6                	xor    %esi,%esi
+    15ef:	eb 2a                	jmp    161b <fgets+0x4b>
+    15f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return f->buf[f->r++] & 0xff;
+    15f8:	8b 53 08             	mov    0x8(%ebx),%edx
+    15fb:	8d 48 01             	lea    0x1(%eax),%ecx
+    15fe:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1601:	0f b6 14 02          	movzbl (%edx,%eax,1),%edx
+
+  flockfile(f);
+  for(i = 0; i+1 < max; ){
+    if((c = getc_unlocked(f)) == EOF)
+      break;
+    buf[i++] = c;
+    1605:	88 54 37 ff          	mov    %dl,-0x1(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    1609:	80 fa 0a             	cmp    $0xa,%dl
+    160c:	0f 84 96 00 00 00    	je     16a8 <fgets+0xd8>
+    1612:	83 fa 0d             	cmp    $0xd,%edx
+    1615:	0f 84 8d 00 00 00    	je     16a8 <fgets+0xd8>
+  for(i = 0; i+1 < max; ){
+    161b:	89 f2                	mov    %esi,%edx
+    161d:	83 c6 01             	add    $0x1,%esi
+    1620:	3b 75 0c             	cmp    0xc(%ebp),%esi
+    1623:	7d 2b                	jge    1650 <fgets+0x80>
+  if(!(f->flags & IO_READ))
+    1625:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1629:	74 25                	je     1650 <fgets+0x80>
+  if(f->r == f->n && fill(f) == 0)
+    162b:	8b 43 10             	mov    0x10(%ebx),%eax
+    162e:	3b 43 14             	cmp    0x14(%ebx),%eax
+    1631:	75 c5                	jne    15f8 <fgets+0x28>
+    1633:	89 d8                	mov    %ebx,%eax
+    1635:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1638:	e8 43 f7 ff ff       	call   d80 <fill>
+    163d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1640:	85 c0                	test   %eax,%eax
+    1642:	74 0c                	je     1650 <fgets+0x80>
+  return f->buf[f->r++] & 0xff;
+    1644:	8b 43 10             	mov    0x10(%ebx),%eax
+    1647:	eb af                	jmp    15f8 <fgets+0x28>
+    1649:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1650:	8b 0d 40 34 00 00    	mov    0x3440,%ecx
+      break;
+  }
+  buf[i] = '\0';
+    1656:	c6 04 17 00          	movb   $0x0,(%edi,%edx,1)
+  if(threaded)
+    165a:	85 c9                	test   %ecx,%ecx
+    165c:	75 2a                	jne    1688 <fgets+0xb8>
+  funlockfile(f);
+  return i > 0 ? buf : 0;
+    165e:	31 c0                	xor    %eax,%eax
+    1660:	85 d2                	test   %edx,%edx
+    1662:	74 02                	je     1666 <fgets+0x96>
+    1664:	89 f8                	mov    %edi,%eax
+}
+    1666:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1669:	5b                   	pop    %ebx
+    166a:	5e                   	pop    %esi
+    166b:	5f                   	pop    %edi
+    166c:	5d                   	pop    %ebp
+    166d:	c3                   	ret
+    166e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    1670:	83 ec 0c             	sub    $0xc,%esp
+    1673:	8d 43 18             	lea    0x18(%ebx),%eax
+    1676:	50                   	push   %eax
+    1677:	e8 24 ef ff ff       	call   5a0 <mutex_lock>
+    167c:	83 c4 10             	add    $0x10,%esp
+    167f:	e9 69 ff ff ff       	jmp    15ed <fgets+0x1d>
+    1684:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1688:	83 ec 0c             	sub    $0xc,%esp
+    168b:	83 c3 18             	add    $0x18,%ebx
+    168e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1691:	53                   	push   %ebx
+    1692:	e8 59 ef ff ff       	call   5f0 <mutex_unlock>
+    1697:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    169a:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    169d:	31 c0                	xor    %eax,%eax
+    169f:	85 d2                	test   %edx,%edx
+    16a1:	75 c1                	jne    1664 <fgets+0x94>
+    16a3:	eb c1                	jmp    1666 <fgets+0x96>
+    16a5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    16a8:	a1 40 34 00 00       	mov    0x3440,%eax
+  buf[i] = '\0';
+    16ad:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  if(threaded)
+    16b1:	85 c0                	test   %eax,%eax
+    16b3:	74 af                	je     1664 <fgets+0x94>
+    mutex_unlock(&f->lock);
+    16b5:	83 ec 0c             	sub    $0xc,%esp
+    16b8:	83 c3 18             	add    $0x18,%ebx
+    16bb:	53                   	push   %ebx
+    16bc:	e8 2f ef ff ff       	call   5f0 <mutex_unlock>
+    16c1:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    16c4:	89 f8                	mov    %edi,%eax
+    16c6:	eb 9e                	jmp    1666 <fgets+0x96>
+    16c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16cf:	90                   	nop
+
+000016d0 <gets>:
+// at most a line per read(), goes through stdin's buffer: from a
+// file or pipe, a buffered read could take input meant for a child
+// process, so read a byte at a time.
+char*
+gets(char *buf, int max)
+{
+    16d0:	55                   	push   %ebp
+    16d1:	89 e5                	mov    %esp,%ebp
+    16d3:	57                   	push   %edi
+    16d4:	56                   	push   %esi
+    16d5:	53                   	push   %ebx
+    16d6:	83 ec 2c             	sub    $0x2c,%esp
+  int i, cc;
+  char c;
+
+  if(!(stdin->flags & IO_SETUP))
+    16d9:	8b 15 44 2a 00 00    	mov    0x2a44,%edx
+{
+    16df:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!(stdin->flags & IO_SETUP))
+    16e2:	f6 c2 40             	test   $0x40,%dl
+    16e5:	74 79                	je     1760 <gets+0x90>
+    setup(stdin);
+  if(stdin->flags & IO_DEV){
+    16e7:	83 e2 20             	and    $0x20,%edx
+    16ea:	89 d7                	mov    %edx,%edi
+    16ec:	75 52                	jne    1740 <gets+0x70>
+  if(f == 0){
+    16ee:	e8 ed f5 ff ff       	call   ce0 <fflush.part.0>
+    fgets(buf, max, stdin);
+    return buf;
+  }
+  fflush(0);
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    16f3:	8d 75 e7             	lea    -0x19(%ebp),%esi
+  for(i=0; i+1 < max; ){
+    16f6:	eb 2c                	jmp    1724 <gets+0x54>
+    16f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16ff:	90                   	nop
+    cc = read(0, &c, 1);
+    1700:	83 ec 04             	sub    $0x4,%esp
+    1703:	6a 01                	push   $0x1
+    1705:	56                   	push   %esi
+    1706:	6a 00                	push   $0x0
+    1708:	e8 f5 ef ff ff       	call   702 <read>
+    if(cc < 1)
+    170d:	83 c4 10             	add    $0x10,%esp
+    1710:	85 c0                	test   %eax,%eax
+    1712:	7e 1b                	jle    172f <gets+0x5f>
+      break;
+    buf[i++] = c;
+    1714:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1718:	88 44 3b ff          	mov    %al,-0x1(%ebx,%edi,1)
+    if(c == '\n' || c == '\r')
+    171c:	3c 0a                	cmp    $0xa,%al
+    171e:	74 12                	je     1732 <gets+0x62>
+    1720:	3c 0d                	cmp    $0xd,%al
+    1722:	74 0e                	je     1732 <gets+0x62>
+  for(i=0; i+1 < max; ){
+    1724:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    1727:	83 c7 01             	add    $0x1,%edi
+    172a:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+    172d:	7c d1                	jl     1700 <gets+0x30>
+{
+    172f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      break;
+  }
+  buf[i] = '\0';
+    1732:	c6 04 3b 00          	movb   $0x0,(%ebx,%edi,1)
+  return buf;
+}
+    1736:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1739:	89 d8                	mov    %ebx,%eax
+    173b:	5b                   	pop    %ebx
+    173c:	5e                   	pop    %esi
+    173d:	5f                   	pop    %edi
+    173e:	5d                   	pop    %ebp
+    173f:	c3                   	ret
+    fgets(buf, max, stdin);
+    1740:	83 ec 04             	sub    $0x4,%esp
+    1743:	68 40 2a 00 00       	push   $0x2a40
+    1748:	ff 75 0c             	push   0xc(%ebp)
+    174b:	53                   	push   %ebx
+    174c:	e8 7f fe ff ff       	call   15d0 <fgets>
+    return buf;
+    1751:	83 c4 10             	add    $0x10,%esp
+}
+    1754:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1757:	89 d8                	mov    %ebx,%eax
+    1759:	5b                   	pop    %ebx
+    175a:	5e                   	pop    %esi
+    175b:	5f                   	pop    %edi
+    175c:	5d                   	pop    %ebp
+    175d:	c3                   	ret
+    175e:	66 90                	xchg   %ax,%ax
+    setup(stdin);
+    1760:	b8 40 2a 00 00       	mov    $0x2a40,%eax
+    1765:	e8 a6 f4 ff ff       	call   c10 <setup>
+  if(stdin->flags & IO_DEV){
+    176a:	8b 15 44 2a 00 00    	mov    0x2a44,%edx
+    1770:	e9 72 ff ff ff       	jmp    16e7 <gets+0x17>
+    1775:	66 90                	xchg   %ax,%ax
+    1777:	66 90                	xchg   %ax,%ax
+    1779:	66 90                	xchg   %ax,%ax
+    177b:	66 90                	xchg   %ax,%ax
+    177d:	66 90                	xchg   %ax,%ax
+    177f:	90                   	nop
+
+00001780 <bigfree>:
+
+// Give a big block back to the first-fit list, and return the
+// free block that now holds it. Caller holds lock.
+static Header*
+bigfree(Header *bp)
+{
+    1780:	55                   	push   %ebp
+    1781:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1783:	a1 e4 3a 00 00       	mov    0x3ae4,%eax
+{
+    1788:	89 e5                	mov    %esp,%ebp
+    178a:	56                   	push   %esi
+    178b:	53                   	push   %ebx
+    178c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1790:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1792:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1794:	39 ca                	cmp    %ecx,%edx
+    1796:	73 38                	jae    17d0 <bigfree+0x50>
+    1798:	39 c1                	cmp    %eax,%ecx
+    179a:	72 04                	jb     17a0 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    179c:	39 c2                	cmp    %eax,%edx
+    179e:	72 f0                	jb     1790 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    17a0:	8b 59 04             	mov    0x4(%ecx),%ebx
+    17a3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    17a6:	39 f0                	cmp    %esi,%eax
+    17a8:	74 36                	je     17e0 <bigfree+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    17aa:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  freep = p;
+  if(p + p->s.size == bp){
+    17ac:	8b 42 04             	mov    0x4(%edx),%eax
+    17af:	89 cb                	mov    %ecx,%ebx
+  freep = p;
+    17b1:	89 15 e4 3a 00 00    	mov    %edx,0x3ae4
+  if(p + p->s.size == bp){
+    17b7:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    17ba:	39 f1                	cmp    %esi,%ecx
+    17bc:	74 2e                	je     17ec <bigfree+0x6c>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    17be:	89 1a                	mov    %ebx,(%edx)
+    return p;
+  }
+  p->s.ptr = bp;
+  return bp;
+}
+    17c0:	89 c8                	mov    %ecx,%eax
+    17c2:	5b                   	pop    %ebx
+    17c3:	5e                   	pop    %esi
+    17c4:	5d                   	pop    %ebp
+    17c5:	c3                   	ret
+    17c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17cd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    17d0:	39 c1                	cmp    %eax,%ecx
+    17d2:	72 c8                	jb     179c <bigfree+0x1c>
+    17d4:	eb ba                	jmp    1790 <bigfree+0x10>
+    17d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    17e0:	03 58 04             	add    0x4(%eax),%ebx
+    17e3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    17e6:	8b 02                	mov    (%edx),%eax
+    17e8:	8b 00                	mov    (%eax),%eax
+    17ea:	eb be                	jmp    17aa <bigfree+0x2a>
+    p->s.size += bp->s.size;
+    17ec:	03 41 04             	add    0x4(%ecx),%eax
+    17ef:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    17f2:	8b 19                	mov    (%ecx),%ebx
+    return p;
+    17f4:	89 d1                	mov    %edx,%ecx
+}
+    17f6:	89 c8                	mov    %ecx,%eax
+    p->s.ptr = bp->s.ptr;
+    17f8:	89 1a                	mov    %ebx,(%edx)
+}
+    17fa:	5b                   	pop    %ebx
+    17fb:	5e                   	pop    %esi
+    17fc:	5d                   	pop    %ebp
+    17fd:	c3                   	ret
+    17fe:	66 90                	xchg   %ax,%ax
+
+00001800 <trim>:
+// If free block bp ends the heap, return its whole pages to the
+// kernel, unless something else has moved the break since.
+// Caller holds lock.
+static void
+trim(Header *bp)
+{
+    1800:	55                   	push   %ebp
+    1801:	89 e5                	mov    %esp,%ebp
+    1803:	57                   	push   %edi
+    1804:	56                   	push   %esi
+    1805:	53                   	push   %ebx
+    1806:	89 c3                	mov    %eax,%ebx
+    1808:	83 ec 0c             	sub    $0xc,%esp
+  char *end;
+  uint n;
+
+  if((char*)(bp + bp->s.size) != heapend)
+    180b:	8b 53 04             	mov    0x4(%ebx),%edx
+    180e:	a1 e0 3a 00 00       	mov    0x3ae0,%eax
+    1813:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+    1816:	39 d0                	cmp    %edx,%eax
+    1818:	74 0e                	je     1828 <trim+0x28>
+  n = heapend - end;
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    bp->s.size -= n / sizeof(Header);
+    heapend = end;
+  }
+}
+    181a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    181d:	5b                   	pop    %ebx
+    181e:	5e                   	pop    %esi
+    181f:	5f                   	pop    %edi
+    1820:	5d                   	pop    %ebp
+    1821:	c3                   	ret
+    1822:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  end = (char*)PGROUNDUP((uint)(bp + 2));
+    1828:	8d bb 0f 10 00 00    	lea    0x100f(%ebx),%edi
+    182e:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  n = heapend - end;
+    1834:	29 f8                	sub    %edi,%eax
+    1836:	89 c6                	mov    %eax,%esi
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    1838:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    183d:	76 db                	jbe    181a <trim+0x1a>
+    183f:	83 ec 0c             	sub    $0xc,%esp
+    1842:	6a 00                	push   $0x0
+    1844:	e8 8b ef ff ff       	call   7d4 <sbrk>
+    1849:	83 c4 10             	add    $0x10,%esp
+    184c:	39 05 e0 3a 00 00    	cmp    %eax,0x3ae0
+    1852:	75 c6                	jne    181a <trim+0x1a>
+    1854:	89 f0                	mov    %esi,%eax
+    1856:	83 ec 0c             	sub    $0xc,%esp
+    1859:	f7 d8                	neg    %eax
+    185b:	50                   	push   %eax
+    185c:	e8 73 ef ff ff       	call   7d4 <sbrk>
+    1861:	83 c4 10             	add    $0x10,%esp
+    1864:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1867:	74 b1                	je     181a <trim+0x1a>
+    bp->s.size -= n / sizeof(Header);
+    1869:	89 f0                	mov    %esi,%eax
+    heapend = end;
+    186b:	89 3d e0 3a 00 00    	mov    %edi,0x3ae0
+    bp->s.size -= n / sizeof(Header);
+    1871:	c1 e8 03             	shr    $0x3,%eax
+    1874:	29 43 04             	sub    %eax,0x4(%ebx)
+    heapend = end;
+    1877:	eb a1                	jmp    181a <trim+0x1a>
+    1879:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001880 <bigalloc>:
+}
+
+// Allocate a big block of nunits units. Caller holds lock.
+static Header*
+bigalloc(uint nunits)
+{
+    1880:	55                   	push   %ebp
+    1881:	89 e5                	mov    %esp,%ebp
+    1883:	57                   	push   %edi
+    1884:	89 c7                	mov    %eax,%edi
+    1886:	56                   	push   %esi
+    1887:	53                   	push   %ebx
+    1888:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    188b:	a1 e4 3a 00 00       	mov    0x3ae4,%eax
+    1890:	85 c0                	test   %eax,%eax
+    1892:	0f 84 98 00 00 00    	je     1930 <bigalloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1898:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    189a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    189d:	39 f9                	cmp    %edi,%ecx
+    189f:	73 67                	jae    1908 <bigalloc+0x88>
+  if(nu < 4096)
+    18a1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    18a6:	39 df                	cmp    %ebx,%edi
+    18a8:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    18ab:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    18b2:	eb 0d                	jmp    18c1 <bigalloc+0x41>
+    18b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    18b8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    18ba:	8b 4a 04             	mov    0x4(%edx),%ecx
+    18bd:	39 f9                	cmp    %edi,%ecx
+    18bf:	73 47                	jae    1908 <bigalloc+0x88>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    18c1:	89 d0                	mov    %edx,%eax
+    18c3:	39 15 e4 3a 00 00    	cmp    %edx,0x3ae4
+    18c9:	75 ed                	jne    18b8 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    18cb:	83 ec 0c             	sub    $0xc,%esp
+    18ce:	56                   	push   %esi
+    18cf:	e8 00 ef ff ff       	call   7d4 <sbrk>
+  if(p == (char*)-1)
+    18d4:	83 c4 10             	add    $0x10,%esp
+    18d7:	83 f8 ff             	cmp    $0xffffffff,%eax
+    18da:	74 1a                	je     18f6 <bigalloc+0x76>
+  hp->s.size = nu;
+    18dc:	89 58 04             	mov    %ebx,0x4(%eax)
+  heapend = p + nu * sizeof(Header);
+    18df:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    18e2:	89 15 e0 3a 00 00    	mov    %edx,0x3ae0
+  bigfree(hp);
+    18e8:	e8 93 fe ff ff       	call   1780 <bigfree>
+  return freep;
+    18ed:	a1 e4 3a 00 00       	mov    0x3ae4,%eax
+      if((p = morecore(nunits)) == 0)
+    18f2:	85 c0                	test   %eax,%eax
+    18f4:	75 c2                	jne    18b8 <bigalloc+0x38>
+        return 0;
+  }
+}
+    18f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    18f9:	31 d2                	xor    %edx,%edx
+}
+    18fb:	5b                   	pop    %ebx
+    18fc:	89 d0                	mov    %edx,%eax
+    18fe:	5e                   	pop    %esi
+    18ff:	5f                   	pop    %edi
+    1900:	5d                   	pop    %ebp
+    1901:	c3                   	ret
+    1902:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1908:	39 cf                	cmp    %ecx,%edi
+    190a:	74 54                	je     1960 <bigalloc+0xe0>
+        p->s.size -= nunits;
+    190c:	29 f9                	sub    %edi,%ecx
+    190e:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    1911:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    1914:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    1917:	a3 e4 3a 00 00       	mov    %eax,0x3ae4
+}
+    191c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    191f:	89 d0                	mov    %edx,%eax
+    1921:	5b                   	pop    %ebx
+    1922:	5e                   	pop    %esi
+    1923:	5f                   	pop    %edi
+    1924:	5d                   	pop    %ebp
+    1925:	c3                   	ret
+    1926:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    192d:	8d 76 00             	lea    0x0(%esi),%esi
+    base.s.ptr = freep = prevp = &base;
+    1930:	c7 05 e4 3a 00 00 e8 	movl   $0x3ae8,0x3ae4
+    1937:	3a 00 00 
+    base.s.size = 0;
+    193a:	ba e8 3a 00 00       	mov    $0x3ae8,%edx
+    base.s.ptr = freep = prevp = &base;
+    193f:	c7 05 e8 3a 00 00 e8 	movl   $0x3ae8,0x3ae8
+    1946:	3a 00 00 
+    base.s.size = 0;
+    1949:	c7 05 ec 3a 00 00 00 	movl   $0x0,0x3aec
+    1950:	00 00 00 
+    if(p->s.size >= nunits){
+    1953:	e9 49 ff ff ff       	jmp    18a1 <bigalloc+0x21>
+    1958:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    195f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1960:	8b 0a                	mov    (%edx),%ecx
+    1962:	89 08                	mov    %ecx,(%eax)
+    1964:	eb b1                	jmp    1917 <bigalloc+0x97>
+    1966:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    196d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001970 <drain>:
+}
+
+// Move n blocks of class c from cache tc to the shared list.
+static void
+drain(struct tcache *tc, int c, int n)
+{
+    1970:	55                   	push   %ebp
+    1971:	89 e5                	mov    %esp,%ebp
+    1973:	57                   	push   %edi
+    1974:	89 c7                	mov    %eax,%edi
+    1976:	56                   	push   %esi
+    1977:	89 d6                	mov    %edx,%esi
+    1979:	53                   	push   %ebx
+    197a:	89 cb                	mov    %ecx,%ebx
+    197c:	83 ec 0c             	sub    $0xc,%esp
+  if(threaded)
+    197f:	8b 15 64 3a 00 00    	mov    0x3a64,%edx
+    1985:	85 d2                	test   %edx,%edx
+    1987:	75 57                	jne    19e0 <drain+0x70>
+  Header *p;
+
+  acquire();
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1989:	85 c9                	test   %ecx,%ecx
+    198b:	7e 49                	jle    19d6 <drain+0x66>
+    198d:	89 d9                	mov    %ebx,%ecx
+    198f:	8d 14 b7             	lea    (%edi,%esi,4),%edx
+    1992:	eb 23                	jmp    19b7 <drain+0x47>
+    1994:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    tc->list[c] = p->s.ptr;
+    1998:	8b 18                	mov    (%eax),%ebx
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    199a:	83 e9 01             	sub    $0x1,%ecx
+    tc->n[c]--;
+    199d:	83 6a 20 01          	subl   $0x1,0x20(%edx)
+    tc->list[c] = p->s.ptr;
+    19a1:	89 1a                	mov    %ebx,(%edx)
+    p->s.ptr = small[c];
+    19a3:	8b 1c b5 c0 3a 00 00 	mov    0x3ac0(,%esi,4),%ebx
+    19aa:	89 18                	mov    %ebx,(%eax)
+    small[c] = p;
+    19ac:	89 04 b5 c0 3a 00 00 	mov    %eax,0x3ac0(,%esi,4)
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    19b3:	85 c9                	test   %ecx,%ecx
+    19b5:	7e 06                	jle    19bd <drain+0x4d>
+    19b7:	8b 02                	mov    (%edx),%eax
+    19b9:	85 c0                	test   %eax,%eax
+    19bb:	75 db                	jne    1998 <drain+0x28>
+  if(threaded)
+    19bd:	a1 64 3a 00 00       	mov    0x3a64,%eax
+    19c2:	85 c0                	test   %eax,%eax
+    19c4:	74 10                	je     19d6 <drain+0x66>
+    mutex_unlock(&lock);
+    19c6:	83 ec 0c             	sub    $0xc,%esp
+    19c9:	68 68 3a 00 00       	push   $0x3a68
+    19ce:	e8 1d ec ff ff       	call   5f0 <mutex_unlock>
+}
+    19d3:	83 c4 10             	add    $0x10,%esp
+  }
+  release();
+}
+    19d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19d9:	5b                   	pop    %ebx
+    19da:	5e                   	pop    %esi
+    19db:	5f                   	pop    %edi
+    19dc:	5d                   	pop    %ebp
+    19dd:	c3                   	ret
+    19de:	66 90                	xchg   %ax,%ax
+    mutex_lock(&lock);
+    19e0:	83 ec 0c             	sub    $0xc,%esp
+    19e3:	68 68 3a 00 00       	push   $0x3a68
+    19e8:	e8 b3 eb ff ff       	call   5a0 <mutex_lock>
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    19ed:	83 c4 10             	add    $0x10,%esp
+    19f0:	85 db                	test   %ebx,%ebx
+    19f2:	7f 99                	jg     198d <drain+0x1d>
+    19f4:	eb c7                	jmp    19bd <drain+0x4d>
+    19f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001a00 <mycache>:
+{
+    1a00:	55                   	push   %ebp
+    return &maincache;
+    1a01:	b8 80 3a 00 00       	mov    $0x3a80,%eax
+{
+    1a06:	89 e5                	mov    %esp,%ebp
+    1a08:	53                   	push   %ebx
+  sp = PGROUNDDOWN((uint)&sp);
+    1a09:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+    1a0c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+    1a12:	83 ec 14             	sub    $0x14,%esp
+  if(!threaded || sp == mainstack)
+    1a15:	8b 0d 64 3a 00 00    	mov    0x3a64,%ecx
+  sp = PGROUNDDOWN((uint)&sp);
+    1a1b:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  if(!threaded || sp == mainstack)
+    1a1e:	85 c9                	test   %ecx,%ecx
+    1a20:	74 0f                	je     1a31 <mycache+0x31>
+    1a22:	3b 1d 60 3a 00 00    	cmp    0x3a60,%ebx
+    1a28:	74 07                	je     1a31 <mycache+0x31>
+  if(*cp == 0){
+    1a2a:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    1a2d:	85 c0                	test   %eax,%eax
+    1a2f:	74 0f                	je     1a40 <mycache+0x40>
+}
+    1a31:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1a34:	c9                   	leave
+    1a35:	c3                   	ret
+    1a36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a3d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1a40:	83 ec 0c             	sub    $0xc,%esp
+    1a43:	68 68 3a 00 00       	push   $0x3a68
+    1a48:	e8 53 eb ff ff       	call   5a0 <mutex_lock>
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    1a4d:	b8 09 00 00 00       	mov    $0x9,%eax
+    1a52:	e8 29 fe ff ff       	call   1880 <bigalloc>
+  if(threaded)
+    1a57:	8b 15 64 3a 00 00    	mov    0x3a64,%edx
+    1a5d:	83 c4 10             	add    $0x10,%esp
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    1a60:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(threaded)
+    1a63:	85 d2                	test   %edx,%edx
+    1a65:	75 29                	jne    1a90 <mycache+0x90>
+    if(*cp == 0)
+    1a67:	85 c0                	test   %eax,%eax
+    1a69:	74 c6                	je     1a31 <mycache+0x31>
+    memset(*cp, 0, sizeof(**cp));
+    1a6b:	83 ec 04             	sub    $0x4,%esp
+    *cp = (struct tcache*)((Header*)*cp + 1);
+    1a6e:	83 c0 08             	add    $0x8,%eax
+    1a71:	89 43 f8             	mov    %eax,-0x8(%ebx)
+    memset(*cp, 0, sizeof(**cp));
+    1a74:	6a 40                	push   $0x40
+    1a76:	6a 00                	push   $0x0
+    1a78:	50                   	push   %eax
+    1a79:	e8 f2 e9 ff ff       	call   470 <memset>
+  return *cp;
+    1a7e:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    1a81:	83 c4 10             	add    $0x10,%esp
+    1a84:	eb ab                	jmp    1a31 <mycache+0x31>
+    1a86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a8d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1a90:	83 ec 0c             	sub    $0xc,%esp
+    1a93:	68 68 3a 00 00       	push   $0x3a68
+    1a98:	e8 53 eb ff ff       	call   5f0 <mutex_unlock>
+    if(*cp == 0)
+    1a9d:	8b 43 f8             	mov    -0x8(%ebx),%eax
+}
+    1aa0:	83 c4 10             	add    $0x10,%esp
+    1aa3:	eb c2                	jmp    1a67 <mycache+0x67>
+    1aa5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1aac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001ab0 <free>:
+
+void
+free(void *ap)
+{
+    1ab0:	55                   	push   %ebp
+    1ab1:	89 e5                	mov    %esp,%ebp
+    1ab3:	57                   	push   %edi
+    1ab4:	56                   	push   %esi
+    1ab5:	53                   	push   %ebx
+    1ab6:	83 ec 1c             	sub    $0x1c,%esp
+    1ab9:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  struct tcache *tc;
+  int c;
+
+  if(ap == 0)
+    1abc:	85 f6                	test   %esi,%esi
+    1abe:	74 51                	je     1b11 <free+0x61>
+    return;
+  bp = (Header*)ap - 1;
+    1ac0:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1ac3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(bp->s.size > SMALLMAX / sizeof(Header)){
+    1ac6:	8b 46 fc             	mov    -0x4(%esi),%eax
+    1ac9:	3d 00 01 00 00       	cmp    $0x100,%eax
+    1ace:	77 50                	ja     1b20 <free+0x70>
+    acquire();
+    trim(bigfree(bp));
+    release();
+    return;
+  }
+  for(c = 0; (2 << c) < bp->s.size; c++)
+    1ad0:	31 db                	xor    %ebx,%ebx
+    1ad2:	ba 02 00 00 00       	mov    $0x2,%edx
+    1ad7:	83 f8 02             	cmp    $0x2,%eax
+    1ada:	76 11                	jbe    1aed <free+0x3d>
+    1adc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1ae0:	83 c3 01             	add    $0x1,%ebx
+    1ae3:	89 d7                	mov    %edx,%edi
+    1ae5:	89 d9                	mov    %ebx,%ecx
+    1ae7:	d3 e7                	shl    %cl,%edi
+    1ae9:	39 c7                	cmp    %eax,%edi
+    1aeb:	72 f3                	jb     1ae0 <free+0x30>
+    ;
+  if((tc = mycache()) == 0){
+    1aed:	e8 0e ff ff ff       	call   1a00 <mycache>
+    1af2:	85 c0                	test   %eax,%eax
+    1af4:	74 7a                	je     1b70 <free+0xc0>
+    bp->s.ptr = small[c];
+    small[c] = bp;
+    release();
+    return;
+  }
+  bp->s.ptr = tc->list[c];
+    1af6:	8d 0c 98             	lea    (%eax,%ebx,4),%ecx
+    1af9:	8b 11                	mov    (%ecx),%edx
+    1afb:	89 56 f8             	mov    %edx,-0x8(%esi)
+  tc->list[c] = bp;
+    1afe:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1b01:	89 31                	mov    %esi,(%ecx)
+  if(++tc->n[c] > TCACHEMAX)
+    1b03:	8b 71 20             	mov    0x20(%ecx),%esi
+    1b06:	8d 56 01             	lea    0x1(%esi),%edx
+    1b09:	89 51 20             	mov    %edx,0x20(%ecx)
+    1b0c:	83 fa 20             	cmp    $0x20,%edx
+    1b0f:	7f 47                	jg     1b58 <free+0xa8>
+    drain(tc, c, BATCH);
+}
+    1b11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b14:	5b                   	pop    %ebx
+    1b15:	5e                   	pop    %esi
+    1b16:	5f                   	pop    %edi
+    1b17:	5d                   	pop    %ebp
+    1b18:	c3                   	ret
+    1b19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1b20:	8b 1d 64 3a 00 00    	mov    0x3a64,%ebx
+    1b26:	85 db                	test   %ebx,%ebx
+    1b28:	75 66                	jne    1b90 <free+0xe0>
+    trim(bigfree(bp));
+    1b2a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1b2d:	e8 4e fc ff ff       	call   1780 <bigfree>
+    1b32:	e8 c9 fc ff ff       	call   1800 <trim>
+  if(threaded)
+    1b37:	8b 0d 64 3a 00 00    	mov    0x3a64,%ecx
+    1b3d:	85 c9                	test   %ecx,%ecx
+    1b3f:	74 d0                	je     1b11 <free+0x61>
+    mutex_unlock(&lock);
+    1b41:	c7 45 08 68 3a 00 00 	movl   $0x3a68,0x8(%ebp)
+}
+    1b48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b4b:	5b                   	pop    %ebx
+    1b4c:	5e                   	pop    %esi
+    1b4d:	5f                   	pop    %edi
+    1b4e:	5d                   	pop    %ebp
+    mutex_unlock(&lock);
+    1b4f:	e9 9c ea ff ff       	jmp    5f0 <mutex_unlock>
+    1b54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    1b58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    drain(tc, c, BATCH);
+    1b5b:	89 da                	mov    %ebx,%edx
+    1b5d:	b9 10 00 00 00       	mov    $0x10,%ecx
+}
+    1b62:	5b                   	pop    %ebx
+    1b63:	5e                   	pop    %esi
+    1b64:	5f                   	pop    %edi
+    1b65:	5d                   	pop    %ebp
+    drain(tc, c, BATCH);
+    1b66:	e9 05 fe ff ff       	jmp    1970 <drain>
+    1b6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1b6f:	90                   	nop
+  if(threaded)
+    1b70:	8b 15 64 3a 00 00    	mov    0x3a64,%edx
+    1b76:	85 d2                	test   %edx,%edx
+    1b78:	75 28                	jne    1ba2 <free+0xf2>
+    bp->s.ptr = small[c];
+    1b7a:	8b 04 9d c0 3a 00 00 	mov    0x3ac0(,%ebx,4),%eax
+    1b81:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1b84:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1b87:	89 04 9d c0 3a 00 00 	mov    %eax,0x3ac0(,%ebx,4)
+  if(threaded)
+    1b8e:	eb 81                	jmp    1b11 <free+0x61>
+    mutex_lock(&lock);
+    1b90:	83 ec 0c             	sub    $0xc,%esp
+    1b93:	68 68 3a 00 00       	push   $0x3a68
+    1b98:	e8 03 ea ff ff       	call   5a0 <mutex_lock>
+}
+    1b9d:	83 c4 10             	add    $0x10,%esp
+    1ba0:	eb 88                	jmp    1b2a <free+0x7a>
+    mutex_lock(&lock);
+    1ba2:	83 ec 0c             	sub    $0xc,%esp
+    1ba5:	68 68 3a 00 00       	push   $0x3a68
+    1baa:	e8 f1 e9 ff ff       	call   5a0 <mutex_lock>
+    bp->s.ptr = small[c];
+    1baf:	8b 04 9d c0 3a 00 00 	mov    0x3ac0(,%ebx,4),%eax
+  if(threaded)
+    1bb6:	83 c4 10             	add    $0x10,%esp
+    bp->s.ptr = small[c];
+    1bb9:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1bbc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1bbf:	89 04 9d c0 3a 00 00 	mov    %eax,0x3ac0(,%ebx,4)
+  if(threaded)
+    1bc6:	a1 64 3a 00 00       	mov    0x3a64,%eax
+    1bcb:	85 c0                	test   %eax,%eax
+    1bcd:	0f 85 6e ff ff ff    	jne    1b41 <free+0x91>
+    1bd3:	e9 39 ff ff ff       	jmp    1b11 <free+0x61>
+    1bd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bdf:	90                   	nop
+
+00001be0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1be0:	55                   	push   %ebp
+    1be1:	89 e5                	mov    %esp,%ebp
+    1be3:	57                   	push   %edi
+    1be4:	56                   	push   %esi
+    1be5:	53                   	push   %ebx
+    1be6:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  struct tcache *tc;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1be9:	8b 45 08             	mov    0x8(%ebp),%eax
+    1bec:	8d 78 07             	lea    0x7(%eax),%edi
+    1bef:	c1 ef 03             	shr    $0x3,%edi
+    1bf2:	83 c7 01             	add    $0x1,%edi
+  if(nunits > SMALLMAX / sizeof(Header)){
+    1bf5:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+    1bfb:	77 5b                	ja     1c58 <malloc+0x78>
+    acquire();
+    p = bigalloc(nunits);
+    release();
+    return p ? (void*)(p + 1) : 0;
+  }
+  for(c = 0; (2 << c) < nunits; c++)
+    1bfd:	31 c9                	xor    %ecx,%ecx
+    1bff:	b8 02 00 00 00       	mov    $0x2,%eax
+    1c04:	be 02 00 00 00       	mov    $0x2,%esi
+    1c09:	bb 02 00 00 00       	mov    $0x2,%ebx
+    1c0e:	83 ff 02             	cmp    $0x2,%edi
+    1c11:	76 12                	jbe    1c25 <malloc+0x45>
+    1c13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1c17:	90                   	nop
+    1c18:	83 c1 01             	add    $0x1,%ecx
+    1c1b:	89 c3                	mov    %eax,%ebx
+    1c1d:	d3 e3                	shl    %cl,%ebx
+    1c1f:	89 de                	mov    %ebx,%esi
+    1c21:	39 fb                	cmp    %edi,%ebx
+    1c23:	72 f3                	jb     1c18 <malloc+0x38>
+    1c25:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    ;
+  if((tc = mycache()) == 0)
+    1c28:	e8 d3 fd ff ff       	call   1a00 <mycache>
+    1c2d:	85 c0                	test   %eax,%eax
+    1c2f:	74 51                	je     1c82 <malloc+0xa2>
+    return 0;
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1c31:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1c34:	8d 3c 88             	lea    (%eax,%ecx,4),%edi
+    1c37:	8b 07                	mov    (%edi),%eax
+    1c39:	85 c0                	test   %eax,%eax
+    1c3b:	74 53                	je     1c90 <malloc+0xb0>
+    return 0;
+  p = tc->list[c];
+  tc->list[c] = p->s.ptr;
+  tc->n[c]--;
+    1c3d:	8b 57 20             	mov    0x20(%edi),%edx
+  tc->list[c] = p->s.ptr;
+    1c40:	8b 08                	mov    (%eax),%ecx
+  tc->n[c]--;
+    1c42:	83 ea 01             	sub    $0x1,%edx
+  return (void*)(p + 1);
+    1c45:	83 c0 08             	add    $0x8,%eax
+  tc->n[c]--;
+    1c48:	89 57 20             	mov    %edx,0x20(%edi)
+  tc->list[c] = p->s.ptr;
+    1c4b:	89 0f                	mov    %ecx,(%edi)
+}
+    1c4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c50:	5b                   	pop    %ebx
+    1c51:	5e                   	pop    %esi
+    1c52:	5f                   	pop    %edi
+    1c53:	5d                   	pop    %ebp
+    1c54:	c3                   	ret
+    1c55:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1c58:	a1 64 3a 00 00       	mov    0x3a64,%eax
+    1c5d:	85 c0                	test   %eax,%eax
+    1c5f:	0f 85 b3 00 00 00    	jne    1d18 <malloc+0x138>
+    p = bigalloc(nunits);
+    1c65:	89 f8                	mov    %edi,%eax
+    1c67:	e8 14 fc ff ff       	call   1880 <bigalloc>
+    1c6c:	89 c3                	mov    %eax,%ebx
+  if(threaded)
+    1c6e:	a1 64 3a 00 00       	mov    0x3a64,%eax
+    1c73:	85 c0                	test   %eax,%eax
+    1c75:	0f 85 85 00 00 00    	jne    1d00 <malloc+0x120>
+    return p ? (void*)(p + 1) : 0;
+    1c7b:	8d 43 08             	lea    0x8(%ebx),%eax
+    1c7e:	85 db                	test   %ebx,%ebx
+    1c80:	75 cb                	jne    1c4d <malloc+0x6d>
+    1c82:	31 c0                	xor    %eax,%eax
+}
+    1c84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c87:	5b                   	pop    %ebx
+    1c88:	5e                   	pop    %esi
+    1c89:	5f                   	pop    %edi
+    1c8a:	5d                   	pop    %ebp
+    1c8b:	c3                   	ret
+    1c8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1c90:	a1 64 3a 00 00       	mov    0x3a64,%eax
+    1c95:	85 c0                	test   %eax,%eax
+    1c97:	0f 85 29 01 00 00    	jne    1dc6 <malloc+0x1e6>
+  if(small[c] == 0){
+    1c9d:	8b 04 8d c0 3a 00 00 	mov    0x3ac0(,%ecx,4),%eax
+    1ca4:	85 c0                	test   %eax,%eax
+    1ca6:	0f 84 81 00 00 00    	je     1d2d <malloc+0x14d>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1cac:	31 db                	xor    %ebx,%ebx
+    1cae:	eb 22                	jmp    1cd2 <malloc+0xf2>
+    small[c] = p->s.ptr;
+    1cb0:	8b 10                	mov    (%eax),%edx
+  for(moved = 0; moved < n && small[c]; moved++){
+    1cb2:	83 c3 01             	add    $0x1,%ebx
+    small[c] = p->s.ptr;
+    1cb5:	89 14 8d c0 3a 00 00 	mov    %edx,0x3ac0(,%ecx,4)
+    p->s.ptr = tc->list[c];
+    1cbc:	8b 17                	mov    (%edi),%edx
+    1cbe:	89 10                	mov    %edx,(%eax)
+    tc->list[c] = p;
+    1cc0:	89 07                	mov    %eax,(%edi)
+  for(moved = 0; moved < n && small[c]; moved++){
+    1cc2:	83 fb 10             	cmp    $0x10,%ebx
+    1cc5:	0f 84 e2 00 00 00    	je     1dad <malloc+0x1cd>
+    1ccb:	8b 04 8d c0 3a 00 00 	mov    0x3ac0(,%ecx,4),%eax
+    1cd2:	85 c0                	test   %eax,%eax
+    1cd4:	75 da                	jne    1cb0 <malloc+0xd0>
+  if(threaded)
+    1cd6:	8b 15 64 3a 00 00    	mov    0x3a64,%edx
+    1cdc:	85 d2                	test   %edx,%edx
+    1cde:	0f 85 b4 00 00 00    	jne    1d98 <malloc+0x1b8>
+  tc->n[c] += moved;
+    1ce4:	8b 57 20             	mov    0x20(%edi),%edx
+    1ce7:	01 da                	add    %ebx,%edx
+    1ce9:	89 57 20             	mov    %edx,0x20(%edi)
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1cec:	85 db                	test   %ebx,%ebx
+    1cee:	74 92                	je     1c82 <malloc+0xa2>
+  p = tc->list[c];
+    1cf0:	8b 07                	mov    (%edi),%eax
+    1cf2:	e9 49 ff ff ff       	jmp    1c40 <malloc+0x60>
+    1cf7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1cfe:	66 90                	xchg   %ax,%ax
+    mutex_unlock(&lock);
+    1d00:	83 ec 0c             	sub    $0xc,%esp
+    1d03:	68 68 3a 00 00       	push   $0x3a68
+    1d08:	e8 e3 e8 ff ff       	call   5f0 <mutex_unlock>
+}
+    1d0d:	83 c4 10             	add    $0x10,%esp
+    1d10:	e9 66 ff ff ff       	jmp    1c7b <malloc+0x9b>
+    1d15:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1d18:	83 ec 0c             	sub    $0xc,%esp
+    1d1b:	68 68 3a 00 00       	push   $0x3a68
+    1d20:	e8 7b e8 ff ff       	call   5a0 <mutex_lock>
+}
+    1d25:	83 c4 10             	add    $0x10,%esp
+    1d28:	e9 38 ff ff ff       	jmp    1c65 <malloc+0x85>
+    if((chunk = bigalloc(CHUNK / sizeof(Header) + 1)) == 0){
+    1d2d:	b8 01 02 00 00       	mov    $0x201,%eax
+    1d32:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1d35:	e8 46 fb ff ff       	call   1880 <bigalloc>
+    1d3a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1d3d:	85 c0                	test   %eax,%eax
+    1d3f:	89 c2                	mov    %eax,%edx
+    1d41:	0f 84 ba 00 00 00    	je     1e01 <malloc+0x221>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1d47:	83 c2 08             	add    $0x8,%edx
+    1d4a:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+    1d50:	0f 87 d0 00 00 00    	ja     1e26 <malloc+0x246>
+    1d56:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+    1d5d:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    1d60:	89 df                	mov    %ebx,%edi
+    1d62:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1d65:	8d 76 00             	lea    0x0(%esi),%esi
+      p->s.size = units;
+    1d68:	89 72 04             	mov    %esi,0x4(%edx)
+      p->s.ptr = small[c];
+    1d6b:	8b 04 8d c0 3a 00 00 	mov    0x3ac0(,%ecx,4),%eax
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1d72:	01 df                	add    %ebx,%edi
+    1d74:	89 55 e0             	mov    %edx,-0x20(%ebp)
+      p->s.ptr = small[c];
+    1d77:	89 02                	mov    %eax,(%edx)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1d79:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      small[c] = p;
+    1d7c:	89 14 8d c0 3a 00 00 	mov    %edx,0x3ac0(,%ecx,4)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1d83:	01 c2                	add    %eax,%edx
+    1d85:	81 ff 00 02 00 00    	cmp    $0x200,%edi
+    1d8b:	76 db                	jbe    1d68 <malloc+0x188>
+    1d8d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1d90:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1d93:	e9 14 ff ff ff       	jmp    1cac <malloc+0xcc>
+    mutex_unlock(&lock);
+    1d98:	83 ec 0c             	sub    $0xc,%esp
+    1d9b:	68 68 3a 00 00       	push   $0x3a68
+    1da0:	e8 4b e8 ff ff       	call   5f0 <mutex_unlock>
+}
+    1da5:	83 c4 10             	add    $0x10,%esp
+    1da8:	e9 37 ff ff ff       	jmp    1ce4 <malloc+0x104>
+  if(threaded)
+    1dad:	a1 64 3a 00 00       	mov    0x3a64,%eax
+    1db2:	85 c0                	test   %eax,%eax
+    1db4:	75 2b                	jne    1de1 <malloc+0x201>
+  tc->n[c] += moved;
+    1db6:	8b 47 20             	mov    0x20(%edi),%eax
+    1db9:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1dbc:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1dbe:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1dc1:	e9 7a fe ff ff       	jmp    1c40 <malloc+0x60>
+    mutex_lock(&lock);
+    1dc6:	83 ec 0c             	sub    $0xc,%esp
+    1dc9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1dcc:	68 68 3a 00 00       	push   $0x3a68
+    1dd1:	e8 ca e7 ff ff       	call   5a0 <mutex_lock>
+}
+    1dd6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1dd9:	83 c4 10             	add    $0x10,%esp
+    1ddc:	e9 bc fe ff ff       	jmp    1c9d <malloc+0xbd>
+    mutex_unlock(&lock);
+    1de1:	83 ec 0c             	sub    $0xc,%esp
+    1de4:	68 68 3a 00 00       	push   $0x3a68
+    1de9:	e8 02 e8 ff ff       	call   5f0 <mutex_unlock>
+  tc->n[c] += moved;
+    1dee:	8b 47 20             	mov    0x20(%edi),%eax
+    1df1:	83 c4 10             	add    $0x10,%esp
+    1df4:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1df7:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1df9:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1dfc:	e9 3f fe ff ff       	jmp    1c40 <malloc+0x60>
+  if(threaded)
+    1e01:	8b 0d 64 3a 00 00    	mov    0x3a64,%ecx
+    1e07:	85 c9                	test   %ecx,%ecx
+    1e09:	0f 84 73 fe ff ff    	je     1c82 <malloc+0xa2>
+    mutex_unlock(&lock);
+    1e0f:	83 ec 0c             	sub    $0xc,%esp
+    1e12:	68 68 3a 00 00       	push   $0x3a68
+    1e17:	e8 d4 e7 ff ff       	call   5f0 <mutex_unlock>
+    1e1c:	83 c4 10             	add    $0x10,%esp
+    return p ? (void*)(p + 1) : 0;
+    1e1f:	31 c0                	xor    %eax,%eax
+    1e21:	e9 5e fe ff ff       	jmp    1c84 <malloc+0xa4>
+  for(moved = 0; moved < n && small[c]; moved++){
+    1e26:	8b 04 8d c0 3a 00 00 	mov    0x3ac0(,%ecx,4),%eax
+    1e2d:	e9 7a fe ff ff       	jmp    1cac <malloc+0xcc>
+    1e32:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001e40 <malloc_threaded>:
+void
+malloc_threaded(void)
+{
+  uint sp;
+
+  if(threaded)
+    1e40:	a1 64 3a 00 00       	mov    0x3a64,%eax
+    1e45:	85 c0                	test   %eax,%eax
+    1e47:	74 07                	je     1e50 <malloc_threaded+0x10>
+    1e49:	c3                   	ret
+    1e4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+{
+    1e50:	55                   	push   %ebp
+    1e51:	89 e5                	mov    %esp,%ebp
+    1e53:	83 ec 24             	sub    $0x24,%esp
+    return;
+  mutex_init(&lock);
+    1e56:	68 68 3a 00 00       	push   $0x3a68
+    1e5b:	e8 30 e7 ff ff       	call   590 <mutex_init>
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1e60:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1e63:	83 c4 10             	add    $0x10,%esp
+  threaded = 1;
+    1e66:	c7 05 64 3a 00 00 01 	movl   $0x1,0x3a64
+    1e6d:	00 00 00 
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1e70:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    1e75:	a3 60 3a 00 00       	mov    %eax,0x3a60
+}
+    1e7a:	c9                   	leave
+    1e7b:	c3                   	ret
+    1e7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001e80 <malloc_thread_exit>:
+
+// Called by thread_join() with the cache slot of a finished
+// thread: give its blocks, and the cache itself, back.
+void
+malloc_thread_exit(void **cachep)
+{
+    1e80:	55                   	push   %ebp
+    1e81:	89 e5                	mov    %esp,%ebp
+    1e83:	57                   	push   %edi
+    1e84:	56                   	push   %esi
+    1e85:	53                   	push   %ebx
+    1e86:	83 ec 0c             	sub    $0xc,%esp
+    1e89:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct tcache *tc;
+  int c;
+
+  if((tc = *cachep) == 0)
+    1e8c:	8b 37                	mov    (%edi),%esi
+    1e8e:	85 f6                	test   %esi,%esi
+    1e90:	74 41                	je     1ed3 <malloc_thread_exit+0x53>
+    return;
+  for(c = 0; c < NCLASS; c++)
+    1e92:	31 db                	xor    %ebx,%ebx
+    1e94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    drain(tc, c, tc->n[c]);
+    1e98:	8b 4c 9e 20          	mov    0x20(%esi,%ebx,4),%ecx
+    1e9c:	89 da                	mov    %ebx,%edx
+    1e9e:	89 f0                	mov    %esi,%eax
+  for(c = 0; c < NCLASS; c++)
+    1ea0:	83 c3 01             	add    $0x1,%ebx
+    drain(tc, c, tc->n[c]);
+    1ea3:	e8 c8 fa ff ff       	call   1970 <drain>
+  for(c = 0; c < NCLASS; c++)
+    1ea8:	83 fb 08             	cmp    $0x8,%ebx
+    1eab:	75 eb                	jne    1e98 <malloc_thread_exit+0x18>
+  if(threaded)
+    1ead:	8b 15 64 3a 00 00    	mov    0x3a64,%edx
+    1eb3:	85 d2                	test   %edx,%edx
+    1eb5:	75 29                	jne    1ee0 <malloc_thread_exit+0x60>
+  acquire();
+  trim(bigfree((Header*)tc - 1));
+    1eb7:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1eba:	e8 c1 f8 ff ff       	call   1780 <bigfree>
+    1ebf:	e8 3c f9 ff ff       	call   1800 <trim>
+  if(threaded)
+    1ec4:	a1 64 3a 00 00       	mov    0x3a64,%eax
+    1ec9:	85 c0                	test   %eax,%eax
+    1ecb:	75 2b                	jne    1ef8 <malloc_thread_exit+0x78>
+  release();
+  *cachep = 0;
+    1ecd:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+}
+    1ed3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ed6:	5b                   	pop    %ebx
+    1ed7:	5e                   	pop    %esi
+    1ed8:	5f                   	pop    %edi
+    1ed9:	5d                   	pop    %ebp
+    1eda:	c3                   	ret
+    1edb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1edf:	90                   	nop
+    mutex_lock(&lock);
+    1ee0:	83 ec 0c             	sub    $0xc,%esp
+    1ee3:	68 68 3a 00 00       	push   $0x3a68
+    1ee8:	e8 b3 e6 ff ff       	call   5a0 <mutex_lock>
+}
+    1eed:	83 c4 10             	add    $0x10,%esp
+    1ef0:	eb c5                	jmp    1eb7 <malloc_thread_exit+0x37>
+    1ef2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1ef8:	83 ec 0c             	sub    $0xc,%esp
+    1efb:	68 68 3a 00 00       	push   $0x3a68
+    1f00:	e8 eb e6 ff ff       	call   5f0 <mutex_unlock>
+}
+    1f05:	83 c4 10             	add    $0x10,%esp
+    1f08:	eb c3                	jmp    1ecd <malloc_thread_exit+0x4d>
+    1f0a:	66 90                	xchg   %ax,%ax
+    1f0c:	66 90                	xchg   %ax,%ax
+    1f0e:	66 90                	xchg   %ax,%ax
+
+00001f10 <thread_create>:
+
+// Start fn(arg) in a new thread on a freshly allocated
+// page-aligned stack.  Returns the thread's pid.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1f10:	55                   	push   %ebp
+    1f11:	89 e5                	mov    %esp,%ebp
+    1f13:	53                   	push   %ebx
+    1f14:	83 ec 14             	sub    $0x14,%esp
+  char *mem, *stack;
+  int pid;
+
+  malloc_threaded();
+    1f17:	e8 24 ff ff ff       	call   1e40 <malloc_threaded>
+  stdio_threaded();
+    1f1c:	e8 cf ee ff ff       	call   df0 <stdio_threaded>
+  if((mem = malloc(2*PGSIZE)) == 0)
+    1f21:	83 ec 0c             	sub    $0xc,%esp
+    1f24:	68 00 20 00 00       	push   $0x2000
+    1f29:	e8 b2 fc ff ff       	call   1be0 <malloc>
+    1f2e:	83 c4 10             	add    $0x10,%esp
+    1f31:	85 c0                	test   %eax,%eax
+    1f33:	74 52                	je     1f87 <thread_create+0x77>
+    1f35:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1f37:	8d 80 07 10 00 00    	lea    0x1007(%eax),%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+  ((char**)stack)[-2] = 0;
+  if((pid = clone(fn, arg, stack)) < 0)
+    1f3d:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1f40:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+    1f45:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  ((char**)stack)[-2] = 0;
+    1f48:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+  if((pid = clone(fn, arg, stack)) < 0)
+    1f4f:	50                   	push   %eax
+    1f50:	ff 75 0c             	push   0xc(%ebp)
+    1f53:	ff 75 08             	push   0x8(%ebp)
+    1f56:	e8 97 e8 ff ff       	call   7f2 <clone>
+    1f5b:	83 c4 10             	add    $0x10,%esp
+    1f5e:	85 c0                	test   %eax,%eax
+    1f60:	78 0e                	js     1f70 <thread_create+0x60>
+    free(mem);
+  return pid;
+}
+    1f62:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1f65:	c9                   	leave
+    1f66:	c3                   	ret
+    1f67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f6e:	66 90                	xchg   %ax,%ax
+    free(mem);
+    1f70:	83 ec 0c             	sub    $0xc,%esp
+    1f73:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1f76:	53                   	push   %ebx
+    1f77:	e8 34 fb ff ff       	call   1ab0 <free>
+    1f7c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1f7f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    1f82:	83 c4 10             	add    $0x10,%esp
+}
+    1f85:	c9                   	leave
+    1f86:	c3                   	ret
+    return -1;
+    1f87:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1f8c:	eb d4                	jmp    1f62 <thread_create+0x52>
+    1f8e:	66 90                	xchg   %ax,%ax
+
+00001f90 <thread_join>:
+
+// Wait for a thread to finish and free its stack.
+int
+thread_join(void)
+{
+    1f90:	55                   	push   %ebp
+    1f91:	89 e5                	mov    %esp,%ebp
+    1f93:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    1f94:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    1f97:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    1f9a:	50                   	push   %eax
+    1f9b:	e8 61 e8 ff ff       	call   801 <join>
+    1fa0:	83 c4 10             	add    $0x10,%esp
+    1fa3:	85 c0                	test   %eax,%eax
+    1fa5:	78 29                	js     1fd0 <thread_join+0x40>
+    1fa7:	89 c3                	mov    %eax,%ebx
+    return -1;
+  malloc_thread_exit(&((void**)stack)[-2]);
+    1fa9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1fac:	83 ec 0c             	sub    $0xc,%esp
+    1faf:	83 e8 08             	sub    $0x8,%eax
+    1fb2:	50                   	push   %eax
+    1fb3:	e8 c8 fe ff ff       	call   1e80 <malloc_thread_exit>
+  free(((char**)stack)[-1]);
+    1fb8:	58                   	pop    %eax
+    1fb9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1fbc:	ff 70 fc             	push   -0x4(%eax)
+    1fbf:	e8 ec fa ff ff       	call   1ab0 <free>
+  return pid;
+    1fc4:	83 c4 10             	add    $0x10,%esp
+}
+    1fc7:	89 d8                	mov    %ebx,%eax
+    1fc9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1fcc:	c9                   	leave
+    1fcd:	c3                   	ret
+    1fce:	66 90                	xchg   %ax,%ax
+    return -1;
+    1fd0:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    1fd5:	eb f0                	jmp    1fc7 <thread_join+0x37>
@@ -0,0 +1,70 @@
+// Report spin-lock contention, most contended first.
+//   lockstat              counters since boot
+//   lockstat cmd args...  counters accumulated while cmd runs
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "lockstat.h"
+
+struct lockstat before[NLOCKSTAT], after[NLOCKSTAT];
+
+void
+pad(char *s, int w)
+{
+  int n;
+
+  printf(1, "%s", s);
+  for(n = strlen(s); n < w; n++)
+    printf(1, " ");
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, j, n, nbefore, pid;
+  struct lockstat t;
+
+  nbefore = 0;
+  if(argc > 1){
+    nbefore = lockstat(before, NLOCKSTAT);
+    pid = fork();
+    if(pid < 0){
+      printf(2, "lockstat: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      exec(argv[1], argv+1);
+      printf(2, "lockstat: exec %s failed\n", argv[1]);
+      exit();
+    }
+    wait();
+  }
+  n = lockstat(after, NLOCKSTAT);
+
+  // Entries keep their slots, so subtract the earlier snapshot.
+  // Max hold time cannot be differenced; it stays since boot.
+  for(i = 0; i < nbefore; i++){
+    after[i].nacquire -= before[i].nacquire;
+    after[i].ncontend -= before[i].ncontend;
+    after[i].nspin -= before[i].nspin;
+  }
+
+  for(i = 1; i < n; i++){
+    t = after[i];
+    for(j = i; j > 0 && after[j-1].nspin < t.nspin; j--)
+      after[j] = after[j-1];
+    after[j] = t;
+  }
+
+  pad("name", 16);
+  printf(1, " locks acquires contended spins maxhold\n");
+  for(i = 0; i < n; i++){
+    if(after[i].nacquire == 0)
+      continue;
+    pad(after[i].name, 16);
+    printf(1, " %d %d %d %d %d\n", after[i].nlock, after[i].nacquire,
+           after[i].ncontend, after[i].nspin, after[i].maxhold);
+  }
+  exit();
+}
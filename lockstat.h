@@ -0,0 +1,13 @@
+// Spin-lock contention statistics, one entry per lock name.
+// Both the kernel and user programs use this header file.
+
+#define NLOCKSTAT 32  // maximum number of distinct lock names
+
+struct lockstat {
+  char name[16];  // Lock name given to initlock()
+  uint nlock;     // Number of locks with this name in use
+  uint nacquire;  // Successful acquire() calls
+  uint ncontend;  // acquire() calls that found the lock held
+  uint nspin;     // Total xchg retries while spinning
+  uint maxhold;   // Longest hold, in TSC cycles
+};
@@ -0,0 +1,4261 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	bb 01 00 00 00       	mov    $0x1,%ebx
+      15:	51                   	push   %ecx
+      16:	83 ec 08             	sub    $0x8,%esp
+      19:	8b 31                	mov    (%ecx),%esi
+      1b:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+      1e:	83 fe 01             	cmp    $0x1,%esi
+      21:	7e 1f                	jle    42 <main+0x42>
+      23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      27:	90                   	nop
+    ls(".");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+    ls(argv[i]);
+      28:	83 ec 0c             	sub    $0xc,%esp
+      2b:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(i=1; i<argc; i++)
+      2e:	83 c3 01             	add    $0x1,%ebx
+    ls(argv[i]);
+      31:	e8 ca 00 00 00       	call   100 <ls>
+  for(i=1; i<argc; i++)
+      36:	83 c4 10             	add    $0x10,%esp
+      39:	39 de                	cmp    %ebx,%esi
+      3b:	75 eb                	jne    28 <main+0x28>
+  exit();
+      3d:	e8 5e 03 00 00       	call   3a0 <exit>
+    ls(".");
+      42:	83 ec 0c             	sub    $0xc,%esp
+      45:	68 30 20 00 00       	push   $0x2030
+      4a:	e8 b1 00 00 00       	call   100 <ls>
+    exit();
+      4f:	e8 4c 03 00 00       	call   3a0 <exit>
+      54:	66 90                	xchg   %ax,%ax
+      56:	66 90                	xchg   %ax,%ax
+      58:	66 90                	xchg   %ax,%ax
+      5a:	66 90                	xchg   %ax,%ax
+      5c:	66 90                	xchg   %ax,%ax
+      5e:	66 90                	xchg   %ax,%ax
+
+00000060 <fmtname>:
+{
+      60:	55                   	push   %ebp
+      61:	89 e5                	mov    %esp,%ebp
+      63:	56                   	push   %esi
+      64:	53                   	push   %ebx
+      65:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+      68:	83 ec 0c             	sub    $0xc,%esp
+      6b:	56                   	push   %esi
+      6c:	e8 df 03 00 00       	call   450 <strlen>
+      71:	83 c4 10             	add    $0x10,%esp
+      74:	01 f0                	add    %esi,%eax
+      76:	89 c3                	mov    %eax,%ebx
+      78:	73 0f                	jae    89 <fmtname+0x29>
+      7a:	eb 12                	jmp    8e <fmtname+0x2e>
+      7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      80:	8d 43 ff             	lea    -0x1(%ebx),%eax
+      83:	39 f0                	cmp    %esi,%eax
+      85:	72 0a                	jb     91 <fmtname+0x31>
+      87:	89 c3                	mov    %eax,%ebx
+      89:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+      8c:	75 f2                	jne    80 <fmtname+0x20>
+  p++;
+      8e:	83 c3 01             	add    $0x1,%ebx
+  if(strlen(p) >= DIRSIZ)
+      91:	83 ec 0c             	sub    $0xc,%esp
+      94:	53                   	push   %ebx
+      95:	e8 b6 03 00 00       	call   450 <strlen>
+      9a:	83 c4 10             	add    $0x10,%esp
+      9d:	83 f8 0d             	cmp    $0xd,%eax
+      a0:	77 4a                	ja     ec <fmtname+0x8c>
+  memmove(buf, p, strlen(p));
+      a2:	83 ec 0c             	sub    $0xc,%esp
+      a5:	53                   	push   %ebx
+      a6:	e8 a5 03 00 00       	call   450 <strlen>
+      ab:	83 c4 0c             	add    $0xc,%esp
+      ae:	50                   	push   %eax
+      af:	53                   	push   %ebx
+      b0:	68 60 2b 00 00       	push   $0x2b60
+      b5:	e8 b6 04 00 00       	call   570 <memmove>
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+      ba:	89 1c 24             	mov    %ebx,(%esp)
+      bd:	e8 8e 03 00 00       	call   450 <strlen>
+      c2:	89 1c 24             	mov    %ebx,(%esp)
+  return buf;
+      c5:	bb 60 2b 00 00       	mov    $0x2b60,%ebx
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+      ca:	89 c6                	mov    %eax,%esi
+      cc:	e8 7f 03 00 00       	call   450 <strlen>
+      d1:	ba 0e 00 00 00       	mov    $0xe,%edx
+      d6:	83 c4 0c             	add    $0xc,%esp
+      d9:	29 f2                	sub    %esi,%edx
+      db:	05 60 2b 00 00       	add    $0x2b60,%eax
+      e0:	52                   	push   %edx
+      e1:	6a 20                	push   $0x20
+      e3:	50                   	push   %eax
+      e4:	e8 97 03 00 00       	call   480 <memset>
+  return buf;
+      e9:	83 c4 10             	add    $0x10,%esp
+}
+      ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      ef:	89 d8                	mov    %ebx,%eax
+      f1:	5b                   	pop    %ebx
+      f2:	5e                   	pop    %esi
+      f3:	5d                   	pop    %ebp
+      f4:	c3                   	ret
+      f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000100 <ls>:
+{
+     100:	55                   	push   %ebp
+     101:	89 e5                	mov    %esp,%ebp
+     103:	57                   	push   %edi
+     104:	56                   	push   %esi
+     105:	53                   	push   %ebx
+     106:	81 ec 64 02 00 00    	sub    $0x264,%esp
+     10c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if((fd = open(path, 0)) < 0){
+     10f:	6a 00                	push   $0x0
+     111:	57                   	push   %edi
+     112:	e8 46 06 00 00       	call   75d <open>
+     117:	83 c4 10             	add    $0x10,%esp
+     11a:	85 c0                	test   %eax,%eax
+     11c:	0f 88 9e 01 00 00    	js     2c0 <ls+0x1c0>
+  if(fstat(fd, &st) < 0){
+     122:	83 ec 08             	sub    $0x8,%esp
+     125:	8d b5 d4 fd ff ff    	lea    -0x22c(%ebp),%esi
+     12b:	89 c3                	mov    %eax,%ebx
+     12d:	56                   	push   %esi
+     12e:	50                   	push   %eax
+     12f:	e8 56 06 00 00       	call   78a <fstat>
+     134:	83 c4 10             	add    $0x10,%esp
+     137:	85 c0                	test   %eax,%eax
+     139:	0f 88 c1 01 00 00    	js     300 <ls+0x200>
+  switch(st.type){
+     13f:	0f b7 85 d4 fd ff ff 	movzwl -0x22c(%ebp),%eax
+     146:	66 83 f8 01          	cmp    $0x1,%ax
+     14a:	74 64                	je     1b0 <ls+0xb0>
+     14c:	66 83 f8 02          	cmp    $0x2,%ax
+     150:	74 1e                	je     170 <ls+0x70>
+  close(fd);
+     152:	83 ec 0c             	sub    $0xc,%esp
+     155:	53                   	push   %ebx
+     156:	e8 d5 05 00 00       	call   730 <close>
+     15b:	83 c4 10             	add    $0x10,%esp
+}
+     15e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     161:	5b                   	pop    %ebx
+     162:	5e                   	pop    %esi
+     163:	5f                   	pop    %edi
+     164:	5d                   	pop    %ebp
+     165:	c3                   	ret
+     166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     16d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+     170:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+     176:	83 ec 0c             	sub    $0xc,%esp
+     179:	8b b5 dc fd ff ff    	mov    -0x224(%ebp),%esi
+     17f:	89 95 b4 fd ff ff    	mov    %edx,-0x24c(%ebp)
+     185:	57                   	push   %edi
+     186:	e8 d5 fe ff ff       	call   60 <fmtname>
+     18b:	8b 95 b4 fd ff ff    	mov    -0x24c(%ebp),%edx
+     191:	59                   	pop    %ecx
+     192:	5f                   	pop    %edi
+     193:	52                   	push   %edx
+     194:	56                   	push   %esi
+     195:	6a 02                	push   $0x2
+     197:	50                   	push   %eax
+     198:	68 10 20 00 00       	push   $0x2010
+     19d:	6a 01                	push   $0x1
+     19f:	e8 bc 09 00 00       	call   b60 <printf>
+    break;
+     1a4:	83 c4 20             	add    $0x20,%esp
+     1a7:	eb a9                	jmp    152 <ls+0x52>
+     1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+     1b0:	83 ec 0c             	sub    $0xc,%esp
+     1b3:	57                   	push   %edi
+     1b4:	e8 97 02 00 00       	call   450 <strlen>
+     1b9:	83 c4 10             	add    $0x10,%esp
+     1bc:	83 c0 10             	add    $0x10,%eax
+     1bf:	3d 00 02 00 00       	cmp    $0x200,%eax
+     1c4:	0f 87 16 01 00 00    	ja     2e0 <ls+0x1e0>
+    strcpy(buf, path);
+     1ca:	83 ec 08             	sub    $0x8,%esp
+     1cd:	57                   	push   %edi
+     1ce:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+     1d4:	57                   	push   %edi
+     1d5:	e8 e6 01 00 00       	call   3c0 <strcpy>
+    p = buf+strlen(buf);
+     1da:	89 3c 24             	mov    %edi,(%esp)
+     1dd:	e8 6e 02 00 00       	call   450 <strlen>
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+     1e2:	83 c4 10             	add    $0x10,%esp
+    p = buf+strlen(buf);
+     1e5:	01 f8                	add    %edi,%eax
+    *p++ = '/';
+     1e7:	8d 48 01             	lea    0x1(%eax),%ecx
+    p = buf+strlen(buf);
+     1ea:	89 85 a8 fd ff ff    	mov    %eax,-0x258(%ebp)
+    *p++ = '/';
+     1f0:	89 8d a4 fd ff ff    	mov    %ecx,-0x25c(%ebp)
+     1f6:	c6 00 2f             	movb   $0x2f,(%eax)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+     1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     200:	83 ec 04             	sub    $0x4,%esp
+     203:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+     209:	6a 10                	push   $0x10
+     20b:	50                   	push   %eax
+     20c:	53                   	push   %ebx
+     20d:	e8 00 05 00 00       	call   712 <read>
+     212:	83 c4 10             	add    $0x10,%esp
+     215:	83 f8 10             	cmp    $0x10,%eax
+     218:	0f 85 34 ff ff ff    	jne    152 <ls+0x52>
+      if(de.inum == 0)
+     21e:	66 83 bd c4 fd ff ff 	cmpw   $0x0,-0x23c(%ebp)
+     225:	00 
+     226:	74 d8                	je     200 <ls+0x100>
+      memmove(p, de.name, DIRSIZ);
+     228:	83 ec 04             	sub    $0x4,%esp
+     22b:	8d 85 c6 fd ff ff    	lea    -0x23a(%ebp),%eax
+     231:	6a 0e                	push   $0xe
+     233:	50                   	push   %eax
+     234:	ff b5 a4 fd ff ff    	push   -0x25c(%ebp)
+     23a:	e8 31 03 00 00       	call   570 <memmove>
+      p[DIRSIZ] = 0;
+     23f:	8b 85 a8 fd ff ff    	mov    -0x258(%ebp),%eax
+     245:	c6 40 0f 00          	movb   $0x0,0xf(%eax)
+      if(stat(buf, &st) < 0){
+     249:	58                   	pop    %eax
+     24a:	5a                   	pop    %edx
+     24b:	56                   	push   %esi
+     24c:	57                   	push   %edi
+     24d:	e8 8e 02 00 00       	call   4e0 <stat>
+     252:	83 c4 10             	add    $0x10,%esp
+     255:	85 c0                	test   %eax,%eax
+     257:	0f 88 cb 00 00 00    	js     328 <ls+0x228>
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+     25d:	8b 8d e4 fd ff ff    	mov    -0x21c(%ebp),%ecx
+     263:	8b 95 dc fd ff ff    	mov    -0x224(%ebp),%edx
+     269:	83 ec 0c             	sub    $0xc,%esp
+     26c:	0f bf 85 d4 fd ff ff 	movswl -0x22c(%ebp),%eax
+     273:	89 8d ac fd ff ff    	mov    %ecx,-0x254(%ebp)
+     279:	89 95 b0 fd ff ff    	mov    %edx,-0x250(%ebp)
+     27f:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+     285:	57                   	push   %edi
+     286:	e8 d5 fd ff ff       	call   60 <fmtname>
+     28b:	5a                   	pop    %edx
+     28c:	59                   	pop    %ecx
+     28d:	8b 8d ac fd ff ff    	mov    -0x254(%ebp),%ecx
+     293:	51                   	push   %ecx
+     294:	8b 95 b0 fd ff ff    	mov    -0x250(%ebp),%edx
+     29a:	52                   	push   %edx
+     29b:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+     2a1:	50                   	push   %eax
+     2a2:	68 10 20 00 00       	push   $0x2010
+     2a7:	6a 01                	push   $0x1
+     2a9:	e8 b2 08 00 00       	call   b60 <printf>
+     2ae:	83 c4 20             	add    $0x20,%esp
+     2b1:	e9 4a ff ff ff       	jmp    200 <ls+0x100>
+     2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2bd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(2, "ls: cannot open %s\n", path);
+     2c0:	83 ec 04             	sub    $0x4,%esp
+     2c3:	57                   	push   %edi
+     2c4:	68 e8 1f 00 00       	push   $0x1fe8
+     2c9:	6a 02                	push   $0x2
+     2cb:	e8 90 08 00 00       	call   b60 <printf>
+    return;
+     2d0:	83 c4 10             	add    $0x10,%esp
+}
+     2d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     2d6:	5b                   	pop    %ebx
+     2d7:	5e                   	pop    %esi
+     2d8:	5f                   	pop    %edi
+     2d9:	5d                   	pop    %ebp
+     2da:	c3                   	ret
+     2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2df:	90                   	nop
+      printf(1, "ls: path too long\n");
+     2e0:	83 ec 08             	sub    $0x8,%esp
+     2e3:	68 1d 20 00 00       	push   $0x201d
+     2e8:	6a 01                	push   $0x1
+     2ea:	e8 71 08 00 00       	call   b60 <printf>
+      break;
+     2ef:	83 c4 10             	add    $0x10,%esp
+     2f2:	e9 5b fe ff ff       	jmp    152 <ls+0x52>
+     2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2fe:	66 90                	xchg   %ax,%ax
+    printf(2, "ls: cannot stat %s\n", path);
+     300:	83 ec 04             	sub    $0x4,%esp
+     303:	57                   	push   %edi
+     304:	68 fc 1f 00 00       	push   $0x1ffc
+     309:	6a 02                	push   $0x2
+     30b:	e8 50 08 00 00       	call   b60 <printf>
+    close(fd);
+     310:	89 1c 24             	mov    %ebx,(%esp)
+     313:	e8 18 04 00 00       	call   730 <close>
+    return;
+     318:	83 c4 10             	add    $0x10,%esp
+}
+     31b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     31e:	5b                   	pop    %ebx
+     31f:	5e                   	pop    %esi
+     320:	5f                   	pop    %edi
+     321:	5d                   	pop    %ebp
+     322:	c3                   	ret
+     323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     327:	90                   	nop
+        printf(1, "ls: cannot stat %s\n", buf);
+     328:	83 ec 04             	sub    $0x4,%esp
+     32b:	57                   	push   %edi
+     32c:	68 fc 1f 00 00       	push   $0x1ffc
+     331:	6a 01                	push   $0x1
+     333:	e8 28 08 00 00       	call   b60 <printf>
+        continue;
+     338:	83 c4 10             	add    $0x10,%esp
+     33b:	e9 c0 fe ff ff       	jmp    200 <ls+0x100>
+
+00000340 <fork>:
+int sysexit(void) __attribute__((noreturn));
+
+int
+fork(void)
+{
+  if(flushhook)
+     340:	a1 70 2b 00 00       	mov    0x2b70,%eax
+     345:	85 c0                	test   %eax,%eax
+     347:	74 17                	je     360 <fork+0x20>
+{
+     349:	55                   	push   %ebp
+     34a:	89 e5                	mov    %esp,%ebp
+     34c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     34f:	ff d0                	call   *%eax
+  return sysfork();
+}
+     351:	c9                   	leave
+  return sysfork();
+     352:	e9 7f 03 00 00       	jmp    6d6 <sysfork>
+     357:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     35e:	66 90                	xchg   %ax,%ax
+     360:	e9 71 03 00 00       	jmp    6d6 <sysfork>
+     365:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+     370:	55                   	push   %ebp
+  if(flushhook)
+     371:	a1 70 2b 00 00       	mov    0x2b70,%eax
+{
+     376:	89 e5                	mov    %esp,%ebp
+     378:	56                   	push   %esi
+     379:	53                   	push   %ebx
+     37a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     37d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     380:	85 c0                	test   %eax,%eax
+     382:	74 02                	je     386 <exec+0x16>
+    flushhook();
+     384:	ff d0                	call   *%eax
+  return sysexec(path, argv);
+     386:	89 75 0c             	mov    %esi,0xc(%ebp)
+     389:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     38c:	5b                   	pop    %ebx
+     38d:	5e                   	pop    %esi
+     38e:	5d                   	pop    %ebp
+  return sysexec(path, argv);
+     38f:	e9 ba 03 00 00       	jmp    74e <sysexec>
+     394:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     39b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     39f:	90                   	nop
+
+000003a0 <exit>:
+
+int
+exit(void)
+{
+     3a0:	55                   	push   %ebp
+     3a1:	89 e5                	mov    %esp,%ebp
+     3a3:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     3a6:	a1 70 2b 00 00       	mov    0x2b70,%eax
+     3ab:	85 c0                	test   %eax,%eax
+     3ad:	74 02                	je     3b1 <exit+0x11>
+    flushhook();
+     3af:	ff d0                	call   *%eax
+  sysexit();
+     3b1:	e8 2f 03 00 00       	call   6e5 <sysexit>
+     3b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003c0 <strcpy>:
+}
+
+char*
+strcpy(char *s, const char *t)
+{
+     3c0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     3c1:	31 c0                	xor    %eax,%eax
+{
+     3c3:	89 e5                	mov    %esp,%ebp
+     3c5:	53                   	push   %ebx
+     3c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     3c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     3d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     3d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     3d7:	83 c0 01             	add    $0x1,%eax
+     3da:	84 d2                	test   %dl,%dl
+     3dc:	75 f2                	jne    3d0 <strcpy+0x10>
+    ;
+  return os;
+}
+     3de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3e1:	89 c8                	mov    %ecx,%eax
+     3e3:	c9                   	leave
+     3e4:	c3                   	ret
+     3e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     3f0:	55                   	push   %ebp
+     3f1:	89 e5                	mov    %esp,%ebp
+     3f3:	53                   	push   %ebx
+     3f4:	8b 55 08             	mov    0x8(%ebp),%edx
+     3f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     3fa:	0f b6 02             	movzbl (%edx),%eax
+     3fd:	84 c0                	test   %al,%al
+     3ff:	75 17                	jne    418 <strcmp+0x28>
+     401:	eb 3a                	jmp    43d <strcmp+0x4d>
+     403:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     407:	90                   	nop
+     408:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     40c:	83 c2 01             	add    $0x1,%edx
+     40f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     412:	84 c0                	test   %al,%al
+     414:	74 1a                	je     430 <strcmp+0x40>
+    p++, q++;
+     416:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     418:	0f b6 19             	movzbl (%ecx),%ebx
+     41b:	38 c3                	cmp    %al,%bl
+     41d:	74 e9                	je     408 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     41f:	29 d8                	sub    %ebx,%eax
+}
+     421:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     424:	c9                   	leave
+     425:	c3                   	ret
+     426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     42d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     430:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     434:	31 c0                	xor    %eax,%eax
+     436:	29 d8                	sub    %ebx,%eax
+}
+     438:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     43b:	c9                   	leave
+     43c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     43d:	0f b6 19             	movzbl (%ecx),%ebx
+     440:	31 c0                	xor    %eax,%eax
+     442:	eb db                	jmp    41f <strcmp+0x2f>
+     444:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     44b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     44f:	90                   	nop
+
+00000450 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     450:	55                   	push   %ebp
+     451:	89 e5                	mov    %esp,%ebp
+     453:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     456:	80 3a 00             	cmpb   $0x0,(%edx)
+     459:	74 15                	je     470 <strlen+0x20>
+     45b:	31 c0                	xor    %eax,%eax
+     45d:	8d 76 00             	lea    0x0(%esi),%esi
+     460:	83 c0 01             	add    $0x1,%eax
+     463:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     467:	89 c1                	mov    %eax,%ecx
+     469:	75 f5                	jne    460 <strlen+0x10>
+    ;
+  return n;
+}
+     46b:	89 c8                	mov    %ecx,%eax
+     46d:	5d                   	pop    %ebp
+     46e:	c3                   	ret
+     46f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     470:	31 c9                	xor    %ecx,%ecx
+}
+     472:	5d                   	pop    %ebp
+     473:	89 c8                	mov    %ecx,%eax
+     475:	c3                   	ret
+     476:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     47d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000480 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     480:	55                   	push   %ebp
+     481:	89 e5                	mov    %esp,%ebp
+     483:	57                   	push   %edi
+     484:	8b 55 08             	mov    0x8(%ebp),%edx
+            "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt) {
+    asm volatile("cld; rep stosb" :
+     487:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     48a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     48d:	89 d7                	mov    %edx,%edi
+     48f:	fc                   	cld
+     490:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     492:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     495:	89 d0                	mov    %edx,%eax
+     497:	c9                   	leave
+     498:	c3                   	ret
+     499:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     4a0:	55                   	push   %ebp
+     4a1:	89 e5                	mov    %esp,%ebp
+     4a3:	8b 45 08             	mov    0x8(%ebp),%eax
+     4a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     4aa:	0f b6 10             	movzbl (%eax),%edx
+     4ad:	84 d2                	test   %dl,%dl
+     4af:	75 12                	jne    4c3 <strchr+0x23>
+     4b1:	eb 1d                	jmp    4d0 <strchr+0x30>
+     4b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4b7:	90                   	nop
+     4b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     4bc:	83 c0 01             	add    $0x1,%eax
+     4bf:	84 d2                	test   %dl,%dl
+     4c1:	74 0d                	je     4d0 <strchr+0x30>
+    if(*s == c)
+     4c3:	38 d1                	cmp    %dl,%cl
+     4c5:	75 f1                	jne    4b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     4c7:	5d                   	pop    %ebp
+     4c8:	c3                   	ret
+     4c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     4d0:	31 c0                	xor    %eax,%eax
+}
+     4d2:	5d                   	pop    %ebp
+     4d3:	c3                   	ret
+     4d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4df:	90                   	nop
+
+000004e0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     4e0:	55                   	push   %ebp
+     4e1:	89 e5                	mov    %esp,%ebp
+     4e3:	56                   	push   %esi
+     4e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     4e5:	83 ec 08             	sub    $0x8,%esp
+     4e8:	6a 00                	push   $0x0
+     4ea:	ff 75 08             	push   0x8(%ebp)
+     4ed:	e8 6b 02 00 00       	call   75d <open>
+  if(fd < 0)
+     4f2:	83 c4 10             	add    $0x10,%esp
+     4f5:	85 c0                	test   %eax,%eax
+     4f7:	78 27                	js     520 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     4f9:	83 ec 08             	sub    $0x8,%esp
+     4fc:	ff 75 0c             	push   0xc(%ebp)
+     4ff:	89 c3                	mov    %eax,%ebx
+     501:	50                   	push   %eax
+     502:	e8 83 02 00 00       	call   78a <fstat>
+  close(fd);
+     507:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     50a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     50c:	e8 1f 02 00 00       	call   730 <close>
+  return r;
+     511:	83 c4 10             	add    $0x10,%esp
+}
+     514:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     517:	89 f0                	mov    %esi,%eax
+     519:	5b                   	pop    %ebx
+     51a:	5e                   	pop    %esi
+     51b:	5d                   	pop    %ebp
+     51c:	c3                   	ret
+     51d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     520:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     525:	eb ed                	jmp    514 <stat+0x34>
+     527:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     52e:	66 90                	xchg   %ax,%ax
+
+00000530 <atoi>:
+
+int
+atoi(const char *s)
+{
+     530:	55                   	push   %ebp
+     531:	89 e5                	mov    %esp,%ebp
+     533:	53                   	push   %ebx
+     534:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     537:	0f be 02             	movsbl (%edx),%eax
+     53a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     53d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     540:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     545:	77 1e                	ja     565 <atoi+0x35>
+     547:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     54e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     550:	83 c2 01             	add    $0x1,%edx
+     553:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     556:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     55a:	0f be 02             	movsbl (%edx),%eax
+     55d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     560:	80 fb 09             	cmp    $0x9,%bl
+     563:	76 eb                	jbe    550 <atoi+0x20>
+  return n;
+}
+     565:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     568:	89 c8                	mov    %ecx,%eax
+     56a:	c9                   	leave
+     56b:	c3                   	ret
+     56c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000570 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     570:	55                   	push   %ebp
+     571:	89 e5                	mov    %esp,%ebp
+     573:	57                   	push   %edi
+     574:	56                   	push   %esi
+     575:	8b 45 10             	mov    0x10(%ebp),%eax
+     578:	8b 55 08             	mov    0x8(%ebp),%edx
+     57b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     57e:	85 c0                	test   %eax,%eax
+     580:	7e 13                	jle    595 <memmove+0x25>
+     582:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     584:	89 d7                	mov    %edx,%edi
+     586:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     58d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     590:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     591:	39 f8                	cmp    %edi,%eax
+     593:	75 fb                	jne    590 <memmove+0x20>
+  return vdst;
+}
+     595:	5e                   	pop    %esi
+     596:	89 d0                	mov    %edx,%eax
+     598:	5f                   	pop    %edi
+     599:	5d                   	pop    %ebp
+     59a:	c3                   	ret
+     59b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     59f:	90                   	nop
+
+000005a0 <mutex_init>:
+
+// Futex-based mutex (Drepper, "Futexes Are Tricky", mutex 2).
+// The uncontended paths never enter the kernel.
+void
+mutex_init(struct mutex *m)
+{
+     5a0:	55                   	push   %ebp
+     5a1:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+     5a3:	8b 45 08             	mov    0x8(%ebp),%eax
+     5a6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     5ac:	5d                   	pop    %ebp
+     5ad:	c3                   	ret
+     5ae:	66 90                	xchg   %ax,%ax
+
+000005b0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     5b0:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     5b1:	31 c0                	xor    %eax,%eax
+     5b3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+     5b8:	89 e5                	mov    %esp,%ebp
+     5ba:	56                   	push   %esi
+     5bb:	53                   	push   %ebx
+     5bc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     5bf:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     5c3:	85 c0                	test   %eax,%eax
+     5c5:	74 32                	je     5f9 <mutex_lock+0x49>
+    return;
+  if(c != 2)
+     5c7:	83 f8 02             	cmp    $0x2,%eax
+     5ca:	74 0c                	je     5d8 <mutex_lock+0x28>
+static inline uint
+xchg(volatile uint *addr, uint newval) {
+    uint result;
+
+    // The + in "+m" denotes a read-modify-write operand.
+    asm volatile("lock; xchgl %0, %1" :
+     5cc:	b8 02 00 00 00       	mov    $0x2,%eax
+     5d1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+     5d4:	85 c0                	test   %eax,%eax
+     5d6:	74 21                	je     5f9 <mutex_lock+0x49>
+     5d8:	be 02 00 00 00       	mov    $0x2,%esi
+     5dd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAIT, 2);
+     5e0:	83 ec 04             	sub    $0x4,%esp
+     5e3:	6a 02                	push   $0x2
+     5e5:	6a 00                	push   $0x0
+     5e7:	53                   	push   %ebx
+     5e8:	e8 33 02 00 00       	call   820 <futex>
+     5ed:	89 f0                	mov    %esi,%eax
+     5ef:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     5f2:	83 c4 10             	add    $0x10,%esp
+     5f5:	85 c0                	test   %eax,%eax
+     5f7:	75 e7                	jne    5e0 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+     5f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5fc:	5b                   	pop    %ebx
+     5fd:	5e                   	pop    %esi
+     5fe:	5d                   	pop    %ebp
+     5ff:	c3                   	ret
+
+00000600 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     600:	55                   	push   %ebp
+     601:	89 e5                	mov    %esp,%ebp
+     603:	83 ec 08             	sub    $0x8,%esp
+     606:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     609:	f0 83 28 01          	lock subl $0x1,(%eax)
+     60d:	75 09                	jne    618 <mutex_unlock+0x18>
+    m->val = 0;
+    futex(&m->val, FUTEX_WAKE, 1);
+  }
+}
+     60f:	c9                   	leave
+     610:	c3                   	ret
+     611:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     618:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     61b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex(&m->val, FUTEX_WAKE, 1);
+     621:	6a 01                	push   $0x1
+     623:	6a 01                	push   $0x1
+     625:	50                   	push   %eax
+     626:	e8 f5 01 00 00       	call   820 <futex>
+     62b:	83 c4 10             	add    $0x10,%esp
+}
+     62e:	c9                   	leave
+     62f:	c3                   	ret
+
+00000630 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     630:	55                   	push   %ebp
+     631:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     633:	8b 45 08             	mov    0x8(%ebp),%eax
+     636:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     63c:	5d                   	pop    %ebp
+     63d:	c3                   	ret
+     63e:	66 90                	xchg   %ax,%ax
+
+00000640 <cond_wait>:
+
+// Release m and wait for a signal, then reacquire m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     640:	55                   	push   %ebp
+     641:	89 e5                	mov    %esp,%ebp
+     643:	57                   	push   %edi
+     644:	56                   	push   %esi
+     645:	53                   	push   %ebx
+     646:	83 ec 0c             	sub    $0xc,%esp
+     649:	8b 75 08             	mov    0x8(%ebp),%esi
+     64c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     64f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     651:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+     655:	75 21                	jne    678 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     657:	83 ec 04             	sub    $0x4,%esp
+     65a:	57                   	push   %edi
+     65b:	6a 00                	push   $0x0
+     65d:	56                   	push   %esi
+     65e:	e8 bd 01 00 00       	call   820 <futex>
+  mutex_lock(m);
+     663:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     666:	83 c4 10             	add    $0x10,%esp
+}
+     669:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     66c:	5b                   	pop    %ebx
+     66d:	5e                   	pop    %esi
+     66e:	5f                   	pop    %edi
+     66f:	5d                   	pop    %ebp
+  mutex_lock(m);
+     670:	e9 3b ff ff ff       	jmp    5b0 <mutex_lock>
+     675:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     678:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     67b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex(&m->val, FUTEX_WAKE, 1);
+     681:	6a 01                	push   $0x1
+     683:	6a 01                	push   $0x1
+     685:	53                   	push   %ebx
+     686:	e8 95 01 00 00       	call   820 <futex>
+     68b:	83 c4 10             	add    $0x10,%esp
+     68e:	eb c7                	jmp    657 <cond_wait+0x17>
+
+00000690 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+     690:	55                   	push   %ebp
+     691:	89 e5                	mov    %esp,%ebp
+     693:	83 ec 0c             	sub    $0xc,%esp
+     696:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     699:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+     69d:	6a 01                	push   $0x1
+     69f:	6a 01                	push   $0x1
+     6a1:	50                   	push   %eax
+     6a2:	e8 79 01 00 00       	call   820 <futex>
+}
+     6a7:	83 c4 10             	add    $0x10,%esp
+     6aa:	c9                   	leave
+     6ab:	c3                   	ret
+     6ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006b0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     6b0:	55                   	push   %ebp
+     6b1:	89 e5                	mov    %esp,%ebp
+     6b3:	83 ec 0c             	sub    $0xc,%esp
+     6b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     6b9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+     6bd:	6a 40                	push   $0x40
+     6bf:	6a 01                	push   $0x1
+     6c1:	50                   	push   %eax
+     6c2:	e8 59 01 00 00       	call   820 <futex>
+}
+     6c7:	83 c4 10             	add    $0x10,%esp
+     6ca:	c9                   	leave
+     6cb:	c3                   	ret
+     6cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006d0 <uptime>:
+// Clock ticks since boot, read from the kernel's vdso page
+// without a system call.
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     6d0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+     6d5:	c3                   	ret
+
+000006d6 <sysfork>:
+  1: ret
+
+#define SYSCALL(name) SYSCALLAS(name, name)
+
+// ulib.c wraps these.
+SYSCALLAS(sysfork, fork)
+     6d6:	b8 01 00 00 00       	mov    $0x1,%eax
+     6db:	89 e1                	mov    %esp,%ecx
+     6dd:	ba e4 06 00 00       	mov    $0x6e4,%edx
+     6e2:	0f 34                	sysenter
+     6e4:	c3                   	ret
+
+000006e5 <sysexit>:
+SYSCALLAS(sysexit, exit)
+     6e5:	b8 02 00 00 00       	mov    $0x2,%eax
+     6ea:	89 e1                	mov    %esp,%ecx
+     6ec:	ba f3 06 00 00       	mov    $0x6f3,%edx
+     6f1:	0f 34                	sysenter
+     6f3:	c3                   	ret
+
+000006f4 <wait>:
+SYSCALL(wait)
+     6f4:	b8 03 00 00 00       	mov    $0x3,%eax
+     6f9:	89 e1                	mov    %esp,%ecx
+     6fb:	ba 02 07 00 00       	mov    $0x702,%edx
+     700:	0f 34                	sysenter
+     702:	c3                   	ret
+
+00000703 <pipe>:
+SYSCALL(pipe)
+     703:	b8 04 00 00 00       	mov    $0x4,%eax
+     708:	89 e1                	mov    %esp,%ecx
+     70a:	ba 11 07 00 00       	mov    $0x711,%edx
+     70f:	0f 34                	sysenter
+     711:	c3                   	ret
+
+00000712 <read>:
+SYSCALL(read)
+     712:	b8 05 00 00 00       	mov    $0x5,%eax
+     717:	89 e1                	mov    %esp,%ecx
+     719:	ba 20 07 00 00       	mov    $0x720,%edx
+     71e:	0f 34                	sysenter
+     720:	c3                   	ret
+
+00000721 <write>:
+SYSCALL(write)
+     721:	b8 10 00 00 00       	mov    $0x10,%eax
+     726:	89 e1                	mov    %esp,%ecx
+     728:	ba 2f 07 00 00       	mov    $0x72f,%edx
+     72d:	0f 34                	sysenter
+     72f:	c3                   	ret
+
+00000730 <close>:
+SYSCALL(close)
+     730:	b8 15 00 00 00       	mov    $0x15,%eax
+     735:	89 e1                	mov    %esp,%ecx
+     737:	ba 3e 07 00 00       	mov    $0x73e,%edx
+     73c:	0f 34                	sysenter
+     73e:	c3                   	ret
+
+0000073f <kill>:
+SYSCALL(kill)
+     73f:	b8 06 00 00 00       	mov    $0x6,%eax
+     744:	89 e1                	mov    %esp,%ecx
+     746:	ba 4d 07 00 00       	mov    $0x74d,%edx
+     74b:	0f 34                	sysenter
+     74d:	c3                   	ret
+
+0000074e <sysexec>:
+SYSCALLAS(sysexec, exec)
+     74e:	b8 07 00 00 00       	mov    $0x7,%eax
+     753:	89 e1                	mov    %esp,%ecx
+     755:	ba 5c 07 00 00       	mov    $0x75c,%edx
+     75a:	0f 34                	sysenter
+     75c:	c3                   	ret
+
+0000075d <open>:
+SYSCALL(open)
+     75d:	b8 0f 00 00 00       	mov    $0xf,%eax
+     762:	89 e1                	mov    %esp,%ecx
+     764:	ba 6b 07 00 00       	mov    $0x76b,%edx
+     769:	0f 34                	sysenter
+     76b:	c3                   	ret
+
+0000076c <mknod>:
+SYSCALL(mknod)
+     76c:	b8 11 00 00 00       	mov    $0x11,%eax
+     771:	89 e1                	mov    %esp,%ecx
+     773:	ba 7a 07 00 00       	mov    $0x77a,%edx
+     778:	0f 34                	sysenter
+     77a:	c3                   	ret
+
+0000077b <unlink>:
+SYSCALL(unlink)
+     77b:	b8 12 00 00 00       	mov    $0x12,%eax
+     780:	89 e1                	mov    %esp,%ecx
+     782:	ba 89 07 00 00       	mov    $0x789,%edx
+     787:	0f 34                	sysenter
+     789:	c3                   	ret
+
+0000078a <fstat>:
+SYSCALL(fstat)
+     78a:	b8 08 00 00 00       	mov    $0x8,%eax
+     78f:	89 e1                	mov    %esp,%ecx
+     791:	ba 98 07 00 00       	mov    $0x798,%edx
+     796:	0f 34                	sysenter
+     798:	c3                   	ret
+
+00000799 <link>:
+SYSCALL(link)
+     799:	b8 13 00 00 00       	mov    $0x13,%eax
+     79e:	89 e1                	mov    %esp,%ecx
+     7a0:	ba a7 07 00 00       	mov    $0x7a7,%edx
+     7a5:	0f 34                	sysenter
+     7a7:	c3                   	ret
+
+000007a8 <mkdir>:
+SYSCALL(mkdir)
+     7a8:	b8 14 00 00 00       	mov    $0x14,%eax
+     7ad:	89 e1                	mov    %esp,%ecx
+     7af:	ba b6 07 00 00       	mov    $0x7b6,%edx
+     7b4:	0f 34                	sysenter
+     7b6:	c3                   	ret
+
+000007b7 <chdir>:
+SYSCALL(chdir)
+     7b7:	b8 09 00 00 00       	mov    $0x9,%eax
+     7bc:	89 e1                	mov    %esp,%ecx
+     7be:	ba c5 07 00 00       	mov    $0x7c5,%edx
+     7c3:	0f 34                	sysenter
+     7c5:	c3                   	ret
+
+000007c6 <dup>:
+SYSCALL(dup)
+     7c6:	b8 0a 00 00 00       	mov    $0xa,%eax
+     7cb:	89 e1                	mov    %esp,%ecx
+     7cd:	ba d4 07 00 00       	mov    $0x7d4,%edx
+     7d2:	0f 34                	sysenter
+     7d4:	c3                   	ret
+
+000007d5 <getpid>:
+SYSCALL(getpid)
+     7d5:	b8 0b 00 00 00       	mov    $0xb,%eax
+     7da:	89 e1                	mov    %esp,%ecx
+     7dc:	ba e3 07 00 00       	mov    $0x7e3,%edx
+     7e1:	0f 34                	sysenter
+     7e3:	c3                   	ret
+
+000007e4 <sbrk>:
+SYSCALL(sbrk)
+     7e4:	b8 0c 00 00 00       	mov    $0xc,%eax
+     7e9:	89 e1                	mov    %esp,%ecx
+     7eb:	ba f2 07 00 00       	mov    $0x7f2,%edx
+     7f0:	0f 34                	sysenter
+     7f2:	c3                   	ret
+
+000007f3 <sleep>:
+SYSCALL(sleep)
+     7f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     7f8:	89 e1                	mov    %esp,%ecx
+     7fa:	ba 01 08 00 00       	mov    $0x801,%edx
+     7ff:	0f 34                	sysenter
+     801:	c3                   	ret
+
+00000802 <clone>:
+SYSCALL(clone)
+     802:	b8 16 00 00 00       	mov    $0x16,%eax
+     807:	89 e1                	mov    %esp,%ecx
+     809:	ba 10 08 00 00       	mov    $0x810,%edx
+     80e:	0f 34                	sysenter
+     810:	c3                   	ret
+
+00000811 <join>:
+SYSCALL(join)
+     811:	b8 17 00 00 00       	mov    $0x17,%eax
+     816:	89 e1                	mov    %esp,%ecx
+     818:	ba 1f 08 00 00       	mov    $0x81f,%edx
+     81d:	0f 34                	sysenter
+     81f:	c3                   	ret
+
+00000820 <futex>:
+SYSCALL(futex)
+     820:	b8 18 00 00 00       	mov    $0x18,%eax
+     825:	89 e1                	mov    %esp,%ecx
+     827:	ba 2e 08 00 00       	mov    $0x82e,%edx
+     82c:	0f 34                	sysenter
+     82e:	c3                   	ret
+
+0000082f <yield>:
+SYSCALL(yield)
+     82f:	b8 19 00 00 00       	mov    $0x19,%eax
+     834:	89 e1                	mov    %esp,%ecx
+     836:	ba 3d 08 00 00       	mov    $0x83d,%edx
+     83b:	0f 34                	sysenter
+     83d:	c3                   	ret
+
+0000083e <lockstat>:
+SYSCALL(lockstat)
+     83e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     843:	89 e1                	mov    %esp,%ecx
+     845:	ba 4c 08 00 00       	mov    $0x84c,%edx
+     84a:	0f 34                	sysenter
+     84c:	c3                   	ret
+
+0000084d <lockhammer>:
+SYSCALL(lockhammer)
+     84d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     852:	89 e1                	mov    %esp,%ecx
+     854:	ba 5b 08 00 00       	mov    $0x85b,%edx
+     859:	0f 34                	sysenter
+     85b:	c3                   	ret
+
+0000085c <vmsplice>:
+SYSCALL(vmsplice)
+     85c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     861:	89 e1                	mov    %esp,%ecx
+     863:	ba 6a 08 00 00       	mov    $0x86a,%edx
+     868:	0f 34                	sysenter
+     86a:	c3                   	ret
+
+0000086b <hsbrk>:
+SYSCALL(hsbrk)
+     86b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     870:	89 e1                	mov    %esp,%ecx
+     872:	ba 79 08 00 00       	mov    $0x879,%edx
+     877:	0f 34                	sysenter
+     879:	c3                   	ret
+
+0000087a <mmap>:
+SYSCALL(mmap)
+     87a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     87f:	89 e1                	mov    %esp,%ecx
+     881:	ba 88 08 00 00       	mov    $0x888,%edx
+     886:	0f 34                	sysenter
+     888:	c3                   	ret
+
+00000889 <munmap>:
+SYSCALL(munmap)
+     889:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     88e:	89 e1                	mov    %esp,%ecx
+     890:	ba 97 08 00 00       	mov    $0x897,%edx
+     895:	0f 34                	sysenter
+     897:	c3                   	ret
+
+00000898 <ringenter>:
+SYSCALL(ringenter)
+     898:	b8 20 00 00 00       	mov    $0x20,%eax
+     89d:	89 e1                	mov    %esp,%ecx
+     89f:	ba a6 08 00 00       	mov    $0x8a6,%edx
+     8a4:	0f 34                	sysenter
+     8a6:	c3                   	ret
+
+000008a7 <readv>:
+SYSCALL(readv)
+     8a7:	b8 21 00 00 00       	mov    $0x21,%eax
+     8ac:	89 e1                	mov    %esp,%ecx
+     8ae:	ba b5 08 00 00       	mov    $0x8b5,%edx
+     8b3:	0f 34                	sysenter
+     8b5:	c3                   	ret
+
+000008b6 <writev>:
+SYSCALL(writev)
+     8b6:	b8 22 00 00 00       	mov    $0x22,%eax
+     8bb:	89 e1                	mov    %esp,%ecx
+     8bd:	ba c4 08 00 00       	mov    $0x8c4,%edx
+     8c2:	0f 34                	sysenter
+     8c4:	c3                   	ret
+
+000008c5 <pread>:
+SYSCALL(pread)
+     8c5:	b8 23 00 00 00       	mov    $0x23,%eax
+     8ca:	89 e1                	mov    %esp,%ecx
+     8cc:	ba d3 08 00 00       	mov    $0x8d3,%edx
+     8d1:	0f 34                	sysenter
+     8d3:	c3                   	ret
+
+000008d4 <pwrite>:
+SYSCALL(pwrite)
+     8d4:	b8 24 00 00 00       	mov    $0x24,%eax
+     8d9:	89 e1                	mov    %esp,%ecx
+     8db:	ba e2 08 00 00       	mov    $0x8e2,%edx
+     8e0:	0f 34                	sysenter
+     8e2:	c3                   	ret
+
+000008e3 <prof>:
+SYSCALL(prof)
+     8e3:	b8 25 00 00 00       	mov    $0x25,%eax
+     8e8:	89 e1                	mov    %esp,%ecx
+     8ea:	ba f1 08 00 00       	mov    $0x8f1,%edx
+     8ef:	0f 34                	sysenter
+     8f1:	c3                   	ret
+
+000008f2 <scstat>:
+SYSCALL(scstat)
+     8f2:	b8 26 00 00 00       	mov    $0x26,%eax
+     8f7:	89 e1                	mov    %esp,%ecx
+     8f9:	ba 00 09 00 00       	mov    $0x900,%edx
+     8fe:	0f 34                	sysenter
+     900:	c3                   	ret
+     901:	66 90                	xchg   %ax,%ax
+     903:	66 90                	xchg   %ax,%ax
+     905:	66 90                	xchg   %ax,%ax
+     907:	66 90                	xchg   %ax,%ax
+     909:	66 90                	xchg   %ax,%ax
+     90b:	66 90                	xchg   %ax,%ax
+     90d:	66 90                	xchg   %ax,%ax
+     90f:	90                   	nop
+
+00000910 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+     910:	55                   	push   %ebp
+     911:	89 e5                	mov    %esp,%ebp
+     913:	57                   	push   %edi
+     914:	56                   	push   %esi
+     915:	53                   	push   %ebx
+     916:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     918:	89 d1                	mov    %edx,%ecx
+{
+     91a:	83 ec 2c             	sub    $0x2c,%esp
+     91d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+     920:	85 d2                	test   %edx,%edx
+     922:	79 7c                	jns    9a0 <printint+0x90>
+     924:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     928:	74 76                	je     9a0 <printint+0x90>
+    x = -xx;
+     92a:	f7 d9                	neg    %ecx
+    neg = 1;
+     92c:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     931:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     934:	31 f6                	xor    %esi,%esi
+     936:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     93d:	8d 76 00             	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     940:	89 c8                	mov    %ecx,%eax
+     942:	31 d2                	xor    %edx,%edx
+     944:	89 f7                	mov    %esi,%edi
+     946:	f7 f3                	div    %ebx
+     948:	8d 76 01             	lea    0x1(%esi),%esi
+     94b:	0f b6 92 94 20 00 00 	movzbl 0x2094(%edx),%edx
+     952:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     956:	89 ca                	mov    %ecx,%edx
+     958:	89 c1                	mov    %eax,%ecx
+     95a:	39 da                	cmp    %ebx,%edx
+     95c:	73 e2                	jae    940 <printint+0x30>
+  if(neg)
+     95e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     961:	85 c0                	test   %eax,%eax
+     963:	74 07                	je     96c <printint+0x5c>
+    buf[i++] = '-';
+     965:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     96a:	89 f7                	mov    %esi,%edi
+     96c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     96f:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     972:	01 df                	add    %ebx,%edi
+     974:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc_unlocked(buf[i], f);
+     978:	83 ec 08             	sub    $0x8,%esp
+     97b:	56                   	push   %esi
+     97c:	0f be 07             	movsbl (%edi),%eax
+     97f:	50                   	push   %eax
+     980:	e8 cb 07 00 00       	call   1150 <putc_unlocked>
+  while(--i >= 0)
+     985:	89 f8                	mov    %edi,%eax
+     987:	83 c4 10             	add    $0x10,%esp
+     98a:	83 ef 01             	sub    $0x1,%edi
+     98d:	39 d8                	cmp    %ebx,%eax
+     98f:	75 e7                	jne    978 <printint+0x68>
+}
+     991:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     994:	5b                   	pop    %ebx
+     995:	5e                   	pop    %esi
+     996:	5f                   	pop    %edi
+     997:	5d                   	pop    %ebp
+     998:	c3                   	ret
+     999:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     9a0:	31 c0                	xor    %eax,%eax
+     9a2:	eb 8d                	jmp    931 <printint+0x21>
+     9a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     9af:	90                   	nop
+
+000009b0 <vfprintf>:
+
+// Print to the given stream, which the caller has locked.
+// Only understands %d, %x, %p, %s.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+     9b0:	55                   	push   %ebp
+     9b1:	89 e5                	mov    %esp,%ebp
+     9b3:	57                   	push   %edi
+     9b4:	56                   	push   %esi
+     9b5:	53                   	push   %ebx
+     9b6:	83 ec 1c             	sub    $0x1c,%esp
+     9b9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     9bc:	0f b6 0a             	movzbl (%edx),%ecx
+     9bf:	84 c9                	test   %cl,%cl
+     9c1:	74 5c                	je     a1f <vfprintf+0x6f>
+     9c3:	89 c6                	mov    %eax,%esi
+     9c5:	8d 5a 01             	lea    0x1(%edx),%ebx
+     9c8:	31 ff                	xor    %edi,%edi
+     9ca:	eb 20                	jmp    9ec <vfprintf+0x3c>
+     9cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     9d0:	83 f9 25             	cmp    $0x25,%ecx
+     9d3:	74 3b                	je     a10 <vfprintf+0x60>
+        state = '%';
+      } else {
+        putc_unlocked(c, f);
+     9d5:	83 ec 08             	sub    $0x8,%esp
+     9d8:	56                   	push   %esi
+     9d9:	51                   	push   %ecx
+     9da:	e8 71 07 00 00       	call   1150 <putc_unlocked>
+     9df:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     9e2:	0f b6 0b             	movzbl (%ebx),%ecx
+     9e5:	83 c3 01             	add    $0x1,%ebx
+     9e8:	84 c9                	test   %cl,%cl
+     9ea:	74 33                	je     a1f <vfprintf+0x6f>
+    if(state == 0){
+     9ec:	85 ff                	test   %edi,%edi
+     9ee:	74 e0                	je     9d0 <vfprintf+0x20>
+      }
+    } else if(state == '%'){
+     9f0:	83 ff 25             	cmp    $0x25,%edi
+     9f3:	75 ed                	jne    9e2 <vfprintf+0x32>
+      if(c == 'd'){
+     9f5:	83 f9 25             	cmp    $0x25,%ecx
+     9f8:	0f 84 02 01 00 00    	je     b00 <vfprintf+0x150>
+     9fe:	8d 41 9d             	lea    -0x63(%ecx),%eax
+     a01:	83 f8 15             	cmp    $0x15,%eax
+     a04:	77 2a                	ja     a30 <vfprintf+0x80>
+     a06:	ff 24 85 3c 20 00 00 	jmp    *0x203c(,%eax,4)
+     a0d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     a10:	0f b6 0b             	movzbl (%ebx),%ecx
+     a13:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     a16:	bf 25 00 00 00       	mov    $0x25,%edi
+  for(i = 0; fmt[i]; i++){
+     a1b:	84 c9                	test   %cl,%cl
+     a1d:	75 cd                	jne    9ec <vfprintf+0x3c>
+        putc_unlocked(c, f);
+      }
+      state = 0;
+    }
+  }
+}
+     a1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a22:	5b                   	pop    %ebx
+     a23:	5e                   	pop    %esi
+     a24:	5f                   	pop    %edi
+     a25:	5d                   	pop    %ebp
+     a26:	c3                   	ret
+     a27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a2e:	66 90                	xchg   %ax,%ax
+        putc_unlocked('%', f);
+     a30:	83 ec 08             	sub    $0x8,%esp
+     a33:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     a36:	56                   	push   %esi
+     a37:	6a 25                	push   $0x25
+     a39:	e8 12 07 00 00       	call   1150 <putc_unlocked>
+        putc_unlocked(c, f);
+     a3e:	58                   	pop    %eax
+     a3f:	5a                   	pop    %edx
+     a40:	56                   	push   %esi
+     a41:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     a44:	51                   	push   %ecx
+     a45:	e8 06 07 00 00       	call   1150 <putc_unlocked>
+     a4a:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     a4d:	31 ff                	xor    %edi,%edi
+     a4f:	eb 91                	jmp    9e2 <vfprintf+0x32>
+     a51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+     a58:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     a5b:	83 ec 0c             	sub    $0xc,%esp
+     a5e:	b9 10 00 00 00       	mov    $0x10,%ecx
+     a63:	8b 17                	mov    (%edi),%edx
+     a65:	6a 00                	push   $0x0
+        ap++;
+     a67:	83 c7 04             	add    $0x4,%edi
+        printint(f, *ap, 16, 0);
+     a6a:	89 f0                	mov    %esi,%eax
+     a6c:	e8 9f fe ff ff       	call   910 <printint>
+        ap++;
+     a71:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     a74:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     a77:	31 ff                	xor    %edi,%edi
+     a79:	e9 64 ff ff ff       	jmp    9e2 <vfprintf+0x32>
+     a7e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     a80:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     a83:	8b 10                	mov    (%eax),%edx
+        ap++;
+     a85:	83 c0 04             	add    $0x4,%eax
+     a88:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     a8b:	85 d2                	test   %edx,%edx
+     a8d:	0f 84 85 00 00 00    	je     b18 <vfprintf+0x168>
+        while(*s != 0){
+     a93:	0f be 02             	movsbl (%edx),%eax
+        s = (char*)*ap;
+     a96:	89 d7                	mov    %edx,%edi
+        while(*s != 0){
+     a98:	84 c0                	test   %al,%al
+     a9a:	74 b1                	je     a4d <vfprintf+0x9d>
+     a9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+          putc_unlocked(*s, f);
+     aa0:	83 ec 08             	sub    $0x8,%esp
+          s++;
+     aa3:	83 c7 01             	add    $0x1,%edi
+          putc_unlocked(*s, f);
+     aa6:	56                   	push   %esi
+     aa7:	50                   	push   %eax
+     aa8:	e8 a3 06 00 00       	call   1150 <putc_unlocked>
+        while(*s != 0){
+     aad:	0f be 07             	movsbl (%edi),%eax
+     ab0:	83 c4 10             	add    $0x10,%esp
+     ab3:	84 c0                	test   %al,%al
+     ab5:	75 e9                	jne    aa0 <vfprintf+0xf0>
+      state = 0;
+     ab7:	31 ff                	xor    %edi,%edi
+     ab9:	e9 24 ff ff ff       	jmp    9e2 <vfprintf+0x32>
+     abe:	66 90                	xchg   %ax,%ax
+        printint(f, *ap, 10, 1);
+     ac0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     ac3:	83 ec 0c             	sub    $0xc,%esp
+     ac6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     acb:	8b 17                	mov    (%edi),%edx
+     acd:	6a 01                	push   $0x1
+     acf:	eb 96                	jmp    a67 <vfprintf+0xb7>
+     ad1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc_unlocked(*ap, f);
+     ad8:	83 ec 08             	sub    $0x8,%esp
+     adb:	56                   	push   %esi
+     adc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     adf:	ff 37                	push   (%edi)
+     ae1:	e8 6a 06 00 00       	call   1150 <putc_unlocked>
+        ap++;
+     ae6:	89 f8                	mov    %edi,%eax
+     ae8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     aeb:	31 ff                	xor    %edi,%edi
+        ap++;
+     aed:	83 c0 04             	add    $0x4,%eax
+     af0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     af3:	e9 ea fe ff ff       	jmp    9e2 <vfprintf+0x32>
+     af8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aff:	90                   	nop
+        putc_unlocked(c, f);
+     b00:	83 ec 08             	sub    $0x8,%esp
+      state = 0;
+     b03:	31 ff                	xor    %edi,%edi
+        putc_unlocked(c, f);
+     b05:	56                   	push   %esi
+     b06:	6a 25                	push   $0x25
+     b08:	e8 43 06 00 00       	call   1150 <putc_unlocked>
+     b0d:	83 c4 10             	add    $0x10,%esp
+     b10:	e9 cd fe ff ff       	jmp    9e2 <vfprintf+0x32>
+     b15:	8d 76 00             	lea    0x0(%esi),%esi
+     b18:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     b1d:	bf 32 20 00 00       	mov    $0x2032,%edi
+     b22:	e9 79 ff ff ff       	jmp    aa0 <vfprintf+0xf0>
+     b27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b2e:	66 90                	xchg   %ax,%ax
+
+00000b30 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+     b30:	55                   	push   %ebp
+     b31:	89 e5                	mov    %esp,%ebp
+     b33:	53                   	push   %ebx
+     b34:	83 ec 10             	sub    $0x10,%esp
+     b37:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  flockfile(f);
+     b3a:	53                   	push   %ebx
+     b3b:	e8 d0 02 00 00       	call   e10 <flockfile>
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     b40:	8b 55 0c             	mov    0xc(%ebp),%edx
+     b43:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     b46:	89 d8                	mov    %ebx,%eax
+     b48:	e8 63 fe ff ff       	call   9b0 <vfprintf>
+  funlockfile(f);
+     b4d:	89 1c 24             	mov    %ebx,(%esp)
+     b50:	e8 eb 02 00 00       	call   e40 <funlockfile>
+}
+     b55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b58:	83 c4 10             	add    $0x10,%esp
+     b5b:	c9                   	leave
+     b5c:	c3                   	ret
+     b5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b60 <printf>:
+
+// Print to the given fd: through stdout or stderr for 1 and 2,
+// otherwise with one write() per call.
+void
+printf(int fd, const char *fmt, ...)
+{
+     b60:	55                   	push   %ebp
+     b61:	89 e5                	mov    %esp,%ebp
+     b63:	56                   	push   %esi
+     b64:	53                   	push   %ebx
+     b65:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+     b6b:	8b 45 08             	mov    0x8(%ebp),%eax
+  char buf[128];
+  struct iobuf f;
+
+  if(fd == 1 || fd == 2){
+    flockfile(&_iob[fd]);
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     b6e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(fd == 1 || fd == 2){
+     b71:	8d 50 ff             	lea    -0x1(%eax),%edx
+     b74:	83 fa 01             	cmp    $0x1,%edx
+     b77:	76 77                	jbe    bf0 <printf+0x90>
+    funlockfile(&_iob[fd]);
+    return;
+  }
+  f.fd = fd;
+     b79:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  f.flags = IO_WRITE|IO_SETUP;
+  f.buf = buf;
+     b7f:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  f.size = sizeof(buf);
+  f.r = f.n = 0;
+  mutex_init(&f.lock);
+     b85:	83 ec 0c             	sub    $0xc,%esp
+     b88:	8d 9d 5c ff ff ff    	lea    -0xa4(%ebp),%ebx
+  f.buf = buf;
+     b8e:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+  mutex_init(&f.lock);
+     b94:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  f.flags = IO_WRITE|IO_SETUP;
+     b9a:	c7 85 60 ff ff ff 42 	movl   $0x42,-0xa0(%ebp)
+     ba1:	00 00 00 
+  f.size = sizeof(buf);
+     ba4:	c7 85 68 ff ff ff 80 	movl   $0x80,-0x98(%ebp)
+     bab:	00 00 00 
+  f.r = f.n = 0;
+     bae:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+     bb5:	00 00 00 
+     bb8:	c7 85 6c ff ff ff 00 	movl   $0x0,-0x94(%ebp)
+     bbf:	00 00 00 
+  mutex_init(&f.lock);
+     bc2:	50                   	push   %eax
+     bc3:	e8 d8 f9 ff ff       	call   5a0 <mutex_init>
+  vfprintf(&f, fmt, (uint*)(void*)&fmt + 1);
+     bc8:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     bcb:	89 f2                	mov    %esi,%edx
+     bcd:	89 d8                	mov    %ebx,%eax
+     bcf:	e8 dc fd ff ff       	call   9b0 <vfprintf>
+  fflush(&f);
+     bd4:	89 1c 24             	mov    %ebx,(%esp)
+     bd7:	e8 f4 04 00 00       	call   10d0 <fflush>
+     bdc:	83 c4 10             	add    $0x10,%esp
+}
+     bdf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     be2:	5b                   	pop    %ebx
+     be3:	5e                   	pop    %esi
+     be4:	5d                   	pop    %ebp
+     be5:	c3                   	ret
+     be6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bed:	8d 76 00             	lea    0x0(%esi),%esi
+    flockfile(&_iob[fd]);
+     bf0:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     bf3:	83 ec 0c             	sub    $0xc,%esp
+     bf6:	8d 98 80 2a 00 00    	lea    0x2a80(%eax),%ebx
+     bfc:	53                   	push   %ebx
+     bfd:	e8 0e 02 00 00       	call   e10 <flockfile>
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     c02:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     c05:	89 f2                	mov    %esi,%edx
+     c07:	89 d8                	mov    %ebx,%eax
+     c09:	e8 a2 fd ff ff       	call   9b0 <vfprintf>
+    funlockfile(&_iob[fd]);
+     c0e:	89 1c 24             	mov    %ebx,(%esp)
+     c11:	e8 2a 02 00 00       	call   e40 <funlockfile>
+     c16:	83 c4 10             	add    $0x10,%esp
+}
+     c19:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     c1c:	5b                   	pop    %ebx
+     c1d:	5e                   	pop    %esi
+     c1e:	5d                   	pop    %ebp
+     c1f:	c3                   	ret
+
+00000c20 <setup>:
+}
+
+// Choose how to buffer f on first use: by lines on a device.
+static void
+setup(FILE *f)
+{
+     c20:	55                   	push   %ebp
+     c21:	89 e5                	mov    %esp,%ebp
+     c23:	53                   	push   %ebx
+     c24:	89 c3                	mov    %eax,%ebx
+     c26:	83 ec 2c             	sub    $0x2c,%esp
+  struct stat st;
+
+  f->flags |= IO_SETUP;
+     c29:	83 48 04 40          	orl    $0x40,0x4(%eax)
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     c2d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     c30:	50                   	push   %eax
+     c31:	ff 33                	push   (%ebx)
+     c33:	e8 52 fb ff ff       	call   78a <fstat>
+     c38:	83 c4 10             	add    $0x10,%esp
+     c3b:	85 c0                	test   %eax,%eax
+    f->flags |= IO_DEV|IO_LINE;
+     c3d:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     c40:	75 07                	jne    c49 <setup+0x29>
+     c42:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+     c47:	74 17                	je     c60 <setup+0x40>
+  if(f->flags & IO_WRITE)
+     c49:	a8 02                	test   $0x2,%al
+     c4b:	74 0a                	je     c57 <setup+0x37>
+    flushhook = flushall;
+     c4d:	c7 05 70 2b 00 00 80 	movl   $0xd80,0x2b70
+     c54:	0d 00 00 
+}
+     c57:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c5a:	c9                   	leave
+     c5b:	c3                   	ret
+     c5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    f->flags |= IO_DEV|IO_LINE;
+     c60:	83 c8 30             	or     $0x30,%eax
+     c63:	89 43 04             	mov    %eax,0x4(%ebx)
+     c66:	eb e1                	jmp    c49 <setup+0x29>
+     c68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c6f:	90                   	nop
+
+00000c70 <flush>:
+static int
+flush(FILE *f)
+{
+  int i, n;
+
+  if(!(f->flags & IO_WRITE))
+     c70:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+     c74:	74 6a                	je     ce0 <flush+0x70>
+{
+     c76:	55                   	push   %ebp
+     c77:	89 e5                	mov    %esp,%ebp
+     c79:	56                   	push   %esi
+     c7a:	89 c6                	mov    %eax,%esi
+     c7c:	53                   	push   %ebx
+    return 0;
+  for(i = 0; i < f->n; i += n){
+     c7d:	8b 40 14             	mov    0x14(%eax),%eax
+     c80:	85 c0                	test   %eax,%eax
+     c82:	7e 4c                	jle    cd0 <flush+0x60>
+     c84:	31 db                	xor    %ebx,%ebx
+     c86:	eb 11                	jmp    c99 <flush+0x29>
+     c88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c8f:	90                   	nop
+     c90:	01 c3                	add    %eax,%ebx
+     c92:	8b 46 14             	mov    0x14(%esi),%eax
+     c95:	39 d8                	cmp    %ebx,%eax
+     c97:	7e 37                	jle    cd0 <flush+0x60>
+    if((n = write(f->fd, f->buf + i, f->n - i)) <= 0){
+     c99:	83 ec 04             	sub    $0x4,%esp
+     c9c:	29 d8                	sub    %ebx,%eax
+     c9e:	50                   	push   %eax
+     c9f:	8b 46 08             	mov    0x8(%esi),%eax
+     ca2:	01 d8                	add    %ebx,%eax
+     ca4:	50                   	push   %eax
+     ca5:	ff 36                	push   (%esi)
+     ca7:	e8 75 fa ff ff       	call   721 <write>
+     cac:	83 c4 10             	add    $0x10,%esp
+     caf:	85 c0                	test   %eax,%eax
+     cb1:	7f dd                	jg     c90 <flush+0x20>
+      f->flags |= IO_ERR;
+     cb3:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+      f->n = 0;
+     cb7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     cbc:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+      return EOF;
+    }
+  }
+  f->n = 0;
+  return 0;
+}
+     cc3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     cc6:	5b                   	pop    %ebx
+     cc7:	5e                   	pop    %esi
+     cc8:	5d                   	pop    %ebp
+     cc9:	c3                   	ret
+     cca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->n = 0;
+     cd0:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+}
+     cd7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+     cda:	31 c0                	xor    %eax,%eax
+}
+     cdc:	5b                   	pop    %ebx
+     cdd:	5e                   	pop    %esi
+     cde:	5d                   	pop    %ebp
+     cdf:	c3                   	ret
+    return 0;
+     ce0:	31 c0                	xor    %eax,%eax
+}
+     ce2:	c3                   	ret
+     ce3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000cf0 <fflush.part.0>:
+fflush(FILE *f)
+     cf0:	55                   	push   %ebp
+     cf1:	89 e5                	mov    %esp,%ebp
+     cf3:	57                   	push   %edi
+     cf4:	bf 78 2b 00 00       	mov    $0x2b78,%edi
+     cf9:	56                   	push   %esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     cfa:	31 f6                	xor    %esi,%esi
+fflush(FILE *f)
+     cfc:	53                   	push   %ebx
+     cfd:	bb 98 2a 00 00       	mov    $0x2a98,%ebx
+     d02:	83 ec 1c             	sub    $0x1c,%esp
+     d05:	eb 10                	jmp    d17 <fflush.part.0+0x27>
+     d07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d0e:	66 90                	xchg   %ax,%ax
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     d10:	83 c3 1c             	add    $0x1c,%ebx
+     d13:	39 df                	cmp    %ebx,%edi
+     d15:	74 33                	je     d4a <fflush.part.0+0x5a>
+      if((f->flags & IO_WRITE) && fflush(f) < 0)
+     d17:	f6 43 ec 02          	testb  $0x2,-0x14(%ebx)
+     d1b:	74 f3                	je     d10 <fflush.part.0+0x20>
+  if(threaded)
+     d1d:	8b 0d 80 2b 00 00    	mov    0x2b80,%ecx
+     d23:	85 c9                	test   %ecx,%ecx
+     d25:	75 49                	jne    d70 <fflush.part.0+0x80>
+  r = flush(f);
+     d27:	8d 43 e8             	lea    -0x18(%ebx),%eax
+     d2a:	e8 41 ff ff ff       	call   c70 <flush>
+  if(threaded)
+     d2f:	8b 15 80 2b 00 00    	mov    0x2b80,%edx
+     d35:	85 d2                	test   %edx,%edx
+     d37:	75 1f                	jne    d58 <fflush.part.0+0x68>
+        r = EOF;
+     d39:	85 c0                	test   %eax,%eax
+     d3b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     d40:	0f 48 f0             	cmovs  %eax,%esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     d43:	83 c3 1c             	add    $0x1c,%ebx
+     d46:	39 df                	cmp    %ebx,%edi
+     d48:	75 cd                	jne    d17 <fflush.part.0+0x27>
+}
+     d4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d4d:	89 f0                	mov    %esi,%eax
+     d4f:	5b                   	pop    %ebx
+     d50:	5e                   	pop    %esi
+     d51:	5f                   	pop    %edi
+     d52:	5d                   	pop    %ebp
+     d53:	c3                   	ret
+     d54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     d58:	83 ec 0c             	sub    $0xc,%esp
+     d5b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     d5e:	53                   	push   %ebx
+     d5f:	e8 9c f8 ff ff       	call   600 <mutex_unlock>
+     d64:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     d67:	83 c4 10             	add    $0x10,%esp
+     d6a:	eb cd                	jmp    d39 <fflush.part.0+0x49>
+     d6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     d70:	83 ec 0c             	sub    $0xc,%esp
+     d73:	53                   	push   %ebx
+     d74:	e8 37 f8 ff ff       	call   5b0 <mutex_lock>
+     d79:	83 c4 10             	add    $0x10,%esp
+     d7c:	eb a9                	jmp    d27 <fflush.part.0+0x37>
+     d7e:	66 90                	xchg   %ax,%ax
+
+00000d80 <flushall>:
+  if(f == 0){
+     d80:	e9 6b ff ff ff       	jmp    cf0 <fflush.part.0>
+     d85:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000d90 <fill>:
+
+// Refill f's buffer. Returns the number of bytes read.
+// Caller holds f's lock.
+static int
+fill(FILE *f)
+{
+     d90:	55                   	push   %ebp
+     d91:	89 e5                	mov    %esp,%ebp
+     d93:	53                   	push   %ebx
+     d94:	89 c3                	mov    %eax,%ebx
+     d96:	83 ec 04             	sub    $0x4,%esp
+  int n;
+
+  if(!(f->flags & IO_SETUP))
+     d99:	8b 40 04             	mov    0x4(%eax),%eax
+     d9c:	a8 40                	test   $0x40,%al
+     d9e:	74 50                	je     df0 <fill+0x60>
+    setup(f);
+  if(f->flags & IO_DEV)
+     da0:	a8 20                	test   $0x20,%al
+     da2:	75 3c                	jne    de0 <fill+0x50>
+    fflush(0);
+  f->r = 0;
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     da4:	83 ec 04             	sub    $0x4,%esp
+  f->r = 0;
+     da7:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     dae:	ff 73 0c             	push   0xc(%ebx)
+     db1:	ff 73 08             	push   0x8(%ebx)
+     db4:	ff 33                	push   (%ebx)
+     db6:	e8 57 f9 ff ff       	call   712 <read>
+     dbb:	83 c4 10             	add    $0x10,%esp
+     dbe:	85 c0                	test   %eax,%eax
+     dc0:	7f 10                	jg     dd2 <fill+0x42>
+    f->flags |= n < 0 ? IO_ERR : IO_EOF;
+     dc2:	83 f8 01             	cmp    $0x1,%eax
+     dc5:	19 c0                	sbb    %eax,%eax
+     dc7:	83 e0 fc             	and    $0xfffffffc,%eax
+     dca:	83 c0 08             	add    $0x8,%eax
+     dcd:	09 43 04             	or     %eax,0x4(%ebx)
+    n = 0;
+     dd0:	31 c0                	xor    %eax,%eax
+  }
+  f->n = n;
+     dd2:	89 43 14             	mov    %eax,0x14(%ebx)
+  return n;
+}
+     dd5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     dd8:	c9                   	leave
+     dd9:	c3                   	ret
+     dda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == 0){
+     de0:	e8 0b ff ff ff       	call   cf0 <fflush.part.0>
+     de5:	eb bd                	jmp    da4 <fill+0x14>
+     de7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dee:	66 90                	xchg   %ax,%ax
+    setup(f);
+     df0:	89 d8                	mov    %ebx,%eax
+     df2:	e8 29 fe ff ff       	call   c20 <setup>
+  if(f->flags & IO_DEV)
+     df7:	8b 43 04             	mov    0x4(%ebx),%eax
+     dfa:	eb a4                	jmp    da0 <fill+0x10>
+     dfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000e00 <stdio_threaded>:
+  threaded = 1;
+     e00:	c7 05 80 2b 00 00 01 	movl   $0x1,0x2b80
+     e07:	00 00 00 
+}
+     e0a:	c3                   	ret
+     e0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e0f:	90                   	nop
+
+00000e10 <flockfile>:
+{
+     e10:	55                   	push   %ebp
+  if(threaded)
+     e11:	8b 15 80 2b 00 00    	mov    0x2b80,%edx
+{
+     e17:	89 e5                	mov    %esp,%ebp
+     e19:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     e1c:	85 d2                	test   %edx,%edx
+     e1e:	75 08                	jne    e28 <flockfile+0x18>
+}
+     e20:	5d                   	pop    %ebp
+     e21:	c3                   	ret
+     e22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_lock(&f->lock);
+     e28:	83 c0 18             	add    $0x18,%eax
+     e2b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     e2e:	5d                   	pop    %ebp
+    mutex_lock(&f->lock);
+     e2f:	e9 7c f7 ff ff       	jmp    5b0 <mutex_lock>
+     e34:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e3f:	90                   	nop
+
+00000e40 <funlockfile>:
+{
+     e40:	55                   	push   %ebp
+  if(threaded)
+     e41:	8b 15 80 2b 00 00    	mov    0x2b80,%edx
+{
+     e47:	89 e5                	mov    %esp,%ebp
+     e49:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     e4c:	85 d2                	test   %edx,%edx
+     e4e:	75 08                	jne    e58 <funlockfile+0x18>
+}
+     e50:	5d                   	pop    %ebp
+     e51:	c3                   	ret
+     e52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&f->lock);
+     e58:	83 c0 18             	add    $0x18,%eax
+     e5b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     e5e:	5d                   	pop    %ebp
+    mutex_unlock(&f->lock);
+     e5f:	e9 9c f7 ff ff       	jmp    600 <mutex_unlock>
+     e64:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e6f:	90                   	nop
+
+00000e70 <fopen>:
+{
+     e70:	55                   	push   %ebp
+     e71:	89 e5                	mov    %esp,%ebp
+     e73:	57                   	push   %edi
+     e74:	56                   	push   %esi
+     e75:	53                   	push   %ebx
+     e76:	83 ec 34             	sub    $0x34,%esp
+     e79:	8b 75 0c             	mov    0xc(%ebp),%esi
+     e7c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(strcmp(mode, "r") != 0 && strcmp(mode, "w") != 0)
+     e7f:	68 a5 20 00 00       	push   $0x20a5
+     e84:	56                   	push   %esi
+     e85:	e8 66 f5 ff ff       	call   3f0 <strcmp>
+     e8a:	83 c4 10             	add    $0x10,%esp
+     e8d:	85 c0                	test   %eax,%eax
+     e8f:	74 15                	je     ea6 <fopen+0x36>
+     e91:	83 ec 08             	sub    $0x8,%esp
+     e94:	68 a7 20 00 00       	push   $0x20a7
+     e99:	56                   	push   %esi
+     e9a:	e8 51 f5 ff ff       	call   3f0 <strcmp>
+     e9f:	83 c4 10             	add    $0x10,%esp
+     ea2:	85 c0                	test   %eax,%eax
+     ea4:	75 2c                	jne    ed2 <fopen+0x62>
+  if(threaded)
+     ea6:	a1 80 2b 00 00       	mov    0x2b80,%eax
+     eab:	85 c0                	test   %eax,%eax
+     ead:	0f 85 ed 00 00 00    	jne    fa0 <fopen+0x130>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     eb3:	bb d4 2a 00 00       	mov    $0x2ad4,%ebx
+    if(f->flags == 0)
+     eb8:	8b 53 04             	mov    0x4(%ebx),%edx
+     ebb:	85 d2                	test   %edx,%edx
+     ebd:	74 21                	je     ee0 <fopen+0x70>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     ebf:	83 c3 1c             	add    $0x1c,%ebx
+     ec2:	81 fb 60 2b 00 00    	cmp    $0x2b60,%ebx
+     ec8:	75 ee                	jne    eb8 <fopen+0x48>
+  if(threaded)
+     eca:	85 c0                	test   %eax,%eax
+     ecc:	0f 85 36 01 00 00    	jne    1008 <fopen+0x198>
+    return 0;
+     ed2:	31 db                	xor    %ebx,%ebx
+     ed4:	e9 96 00 00 00       	jmp    f6f <fopen+0xff>
+     ed9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f == &_iob[NSTREAM])
+     ee0:	81 fb 60 2b 00 00    	cmp    $0x2b60,%ebx
+     ee6:	74 e2                	je     eca <fopen+0x5a>
+    f->flags = IO_MALLOC;
+     ee8:	c7 43 04 80 00 00 00 	movl   $0x80,0x4(%ebx)
+  if(threaded)
+     eef:	85 c0                	test   %eax,%eax
+     ef1:	0f 85 f9 00 00 00    	jne    ff0 <fopen+0x180>
+  if(mode[0] == 'r'){
+     ef7:	80 3e 72             	cmpb   $0x72,(%esi)
+     efa:	0f 84 c0 00 00 00    	je     fc0 <fopen+0x150>
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     f00:	83 ec 08             	sub    $0x8,%esp
+     f03:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     f06:	50                   	push   %eax
+     f07:	57                   	push   %edi
+     f08:	e8 d3 f5 ff ff       	call   4e0 <stat>
+     f0d:	83 c4 10             	add    $0x10,%esp
+     f10:	85 c0                	test   %eax,%eax
+     f12:	74 6c                	je     f80 <fopen+0x110>
+    fd = open(path, O_CREATE|O_WRONLY);
+     f14:	83 ec 08             	sub    $0x8,%esp
+     f17:	68 01 02 00 00       	push   $0x201
+     f1c:	57                   	push   %edi
+    flags = IO_WRITE;
+     f1d:	bf 02 00 00 00       	mov    $0x2,%edi
+    fd = open(path, O_CREATE|O_WRONLY);
+     f22:	e8 36 f8 ff ff       	call   75d <open>
+     f27:	83 c4 10             	add    $0x10,%esp
+     f2a:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     f2c:	85 f6                	test   %esi,%esi
+     f2e:	0f 88 a9 00 00 00    	js     fdd <fopen+0x16d>
+     f34:	83 ec 0c             	sub    $0xc,%esp
+     f37:	68 00 02 00 00       	push   $0x200
+     f3c:	e8 af 0c 00 00       	call   1bf0 <malloc>
+     f41:	83 c4 10             	add    $0x10,%esp
+     f44:	89 43 08             	mov    %eax,0x8(%ebx)
+     f47:	85 c0                	test   %eax,%eax
+     f49:	0f 84 d0 00 00 00    	je     101f <fopen+0x1af>
+  f->flags = flags|IO_MALLOC;
+     f4f:	81 cf 80 00 00 00    	or     $0x80,%edi
+  f->fd = fd;
+     f55:	89 33                	mov    %esi,(%ebx)
+  f->size = BUFSIZ;
+     f57:	c7 43 0c 00 02 00 00 	movl   $0x200,0xc(%ebx)
+  f->r = f->n = 0;
+     f5e:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+     f65:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  f->flags = flags|IO_MALLOC;
+     f6c:	89 7b 04             	mov    %edi,0x4(%ebx)
+}
+     f6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f72:	89 d8                	mov    %ebx,%eax
+     f74:	5b                   	pop    %ebx
+     f75:	5e                   	pop    %esi
+     f76:	5f                   	pop    %edi
+     f77:	5d                   	pop    %ebp
+     f78:	c3                   	ret
+     f79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     f80:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+     f85:	75 8d                	jne    f14 <fopen+0xa4>
+      unlink(path);
+     f87:	83 ec 0c             	sub    $0xc,%esp
+     f8a:	57                   	push   %edi
+     f8b:	e8 eb f7 ff ff       	call   77b <unlink>
+     f90:	83 c4 10             	add    $0x10,%esp
+     f93:	e9 7c ff ff ff       	jmp    f14 <fopen+0xa4>
+     f98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f9f:	90                   	nop
+    mutex_lock(&iolock);
+     fa0:	83 ec 0c             	sub    $0xc,%esp
+     fa3:	68 84 2b 00 00       	push   $0x2b84
+     fa8:	e8 03 f6 ff ff       	call   5b0 <mutex_lock>
+  if(threaded)
+     fad:	a1 80 2b 00 00       	mov    0x2b80,%eax
+     fb2:	83 c4 10             	add    $0x10,%esp
+     fb5:	e9 f9 fe ff ff       	jmp    eb3 <fopen+0x43>
+     fba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    fd = open(path, O_RDONLY);
+     fc0:	83 ec 08             	sub    $0x8,%esp
+     fc3:	6a 00                	push   $0x0
+     fc5:	57                   	push   %edi
+    flags = IO_READ;
+     fc6:	bf 01 00 00 00       	mov    $0x1,%edi
+    fd = open(path, O_RDONLY);
+     fcb:	e8 8d f7 ff ff       	call   75d <open>
+     fd0:	83 c4 10             	add    $0x10,%esp
+     fd3:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     fd5:	85 f6                	test   %esi,%esi
+     fd7:	0f 89 57 ff ff ff    	jns    f34 <fopen+0xc4>
+    f->flags = 0;
+     fdd:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    return 0;
+     fe4:	31 db                	xor    %ebx,%ebx
+     fe6:	eb 87                	jmp    f6f <fopen+0xff>
+     fe8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fef:	90                   	nop
+    mutex_unlock(&iolock);
+     ff0:	83 ec 0c             	sub    $0xc,%esp
+     ff3:	68 84 2b 00 00       	push   $0x2b84
+     ff8:	e8 03 f6 ff ff       	call   600 <mutex_unlock>
+     ffd:	83 c4 10             	add    $0x10,%esp
+    1000:	e9 f2 fe ff ff       	jmp    ef7 <fopen+0x87>
+    1005:	8d 76 00             	lea    0x0(%esi),%esi
+    1008:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+    100b:	31 db                	xor    %ebx,%ebx
+    mutex_unlock(&iolock);
+    100d:	68 84 2b 00 00       	push   $0x2b84
+    1012:	e8 e9 f5 ff ff       	call   600 <mutex_unlock>
+    1017:	83 c4 10             	add    $0x10,%esp
+    101a:	e9 50 ff ff ff       	jmp    f6f <fopen+0xff>
+      close(fd);
+    101f:	83 ec 0c             	sub    $0xc,%esp
+    1022:	56                   	push   %esi
+    1023:	e8 08 f7 ff ff       	call   730 <close>
+    1028:	83 c4 10             	add    $0x10,%esp
+    102b:	eb b0                	jmp    fdd <fopen+0x16d>
+    102d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001030 <fclose>:
+{
+    1030:	55                   	push   %ebp
+    1031:	89 e5                	mov    %esp,%ebp
+    1033:	56                   	push   %esi
+    1034:	53                   	push   %ebx
+  if(threaded)
+    1035:	8b 15 80 2b 00 00    	mov    0x2b80,%edx
+{
+    103b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    103e:	85 d2                	test   %edx,%edx
+    1040:	75 46                	jne    1088 <fclose+0x58>
+  r = flush(f);
+    1042:	89 d8                	mov    %ebx,%eax
+    1044:	e8 27 fc ff ff       	call   c70 <flush>
+  if(close(f->fd) < 0)
+    1049:	83 ec 0c             	sub    $0xc,%esp
+    104c:	ff 33                	push   (%ebx)
+  r = flush(f);
+    104e:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    1050:	e8 db f6 ff ff       	call   730 <close>
+    1055:	83 c4 10             	add    $0x10,%esp
+    r = EOF;
+    1058:	85 c0                	test   %eax,%eax
+    105a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    105f:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->flags & IO_MALLOC)
+    1062:	f6 43 04 80          	testb  $0x80,0x4(%ebx)
+    1066:	75 58                	jne    10c0 <fclose+0x90>
+  if(threaded)
+    1068:	a1 80 2b 00 00       	mov    0x2b80,%eax
+  f->flags = 0;
+    106d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  if(threaded)
+    1074:	85 c0                	test   %eax,%eax
+    1076:	75 28                	jne    10a0 <fclose+0x70>
+}
+    1078:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    107b:	89 f0                	mov    %esi,%eax
+    107d:	5b                   	pop    %ebx
+    107e:	5e                   	pop    %esi
+    107f:	5d                   	pop    %ebp
+    1080:	c3                   	ret
+    1081:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    1088:	83 ec 0c             	sub    $0xc,%esp
+    108b:	8d 43 18             	lea    0x18(%ebx),%eax
+    108e:	50                   	push   %eax
+    108f:	e8 1c f5 ff ff       	call   5b0 <mutex_lock>
+    1094:	83 c4 10             	add    $0x10,%esp
+    1097:	eb a9                	jmp    1042 <fclose+0x12>
+    1099:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    10a0:	83 ec 0c             	sub    $0xc,%esp
+    10a3:	83 c3 18             	add    $0x18,%ebx
+    10a6:	53                   	push   %ebx
+    10a7:	e8 54 f5 ff ff       	call   600 <mutex_unlock>
+    10ac:	83 c4 10             	add    $0x10,%esp
+}
+    10af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    10b2:	89 f0                	mov    %esi,%eax
+    10b4:	5b                   	pop    %ebx
+    10b5:	5e                   	pop    %esi
+    10b6:	5d                   	pop    %ebp
+    10b7:	c3                   	ret
+    10b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10bf:	90                   	nop
+    free(f->buf);
+    10c0:	83 ec 0c             	sub    $0xc,%esp
+    10c3:	ff 73 08             	push   0x8(%ebx)
+    10c6:	e8 f5 09 00 00       	call   1ac0 <free>
+    10cb:	83 c4 10             	add    $0x10,%esp
+    10ce:	eb 98                	jmp    1068 <fclose+0x38>
+
+000010d0 <fflush>:
+{
+    10d0:	55                   	push   %ebp
+    10d1:	89 e5                	mov    %esp,%ebp
+    10d3:	53                   	push   %ebx
+    10d4:	83 ec 14             	sub    $0x14,%esp
+    10d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f == 0){
+    10da:	85 db                	test   %ebx,%ebx
+    10dc:	74 5a                	je     1138 <fflush+0x68>
+  if(threaded)
+    10de:	8b 0d 80 2b 00 00    	mov    0x2b80,%ecx
+    10e4:	85 c9                	test   %ecx,%ecx
+    10e6:	75 18                	jne    1100 <fflush+0x30>
+  r = flush(f);
+    10e8:	89 d8                	mov    %ebx,%eax
+    10ea:	e8 81 fb ff ff       	call   c70 <flush>
+  if(threaded)
+    10ef:	8b 15 80 2b 00 00    	mov    0x2b80,%edx
+    10f5:	85 d2                	test   %edx,%edx
+    10f7:	75 1f                	jne    1118 <fflush+0x48>
+}
+    10f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10fc:	c9                   	leave
+    10fd:	c3                   	ret
+    10fe:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    1100:	83 ec 0c             	sub    $0xc,%esp
+    1103:	8d 43 18             	lea    0x18(%ebx),%eax
+    1106:	50                   	push   %eax
+    1107:	e8 a4 f4 ff ff       	call   5b0 <mutex_lock>
+    110c:	83 c4 10             	add    $0x10,%esp
+    110f:	eb d7                	jmp    10e8 <fflush+0x18>
+    1111:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1118:	83 ec 0c             	sub    $0xc,%esp
+    111b:	83 c3 18             	add    $0x18,%ebx
+    111e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1121:	53                   	push   %ebx
+    1122:	e8 d9 f4 ff ff       	call   600 <mutex_unlock>
+    1127:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    112a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    mutex_unlock(&f->lock);
+    112d:	83 c4 10             	add    $0x10,%esp
+}
+    1130:	c9                   	leave
+    1131:	c3                   	ret
+    1132:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1138:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    113b:	c9                   	leave
+    113c:	e9 af fb ff ff       	jmp    cf0 <fflush.part.0>
+    1141:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1148:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    114f:	90                   	nop
+
+00001150 <putc_unlocked>:
+{
+    1150:	55                   	push   %ebp
+    1151:	89 e5                	mov    %esp,%ebp
+    1153:	56                   	push   %esi
+    1154:	53                   	push   %ebx
+    1155:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    1158:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(!(f->flags & IO_WRITE))
+    115b:	8b 43 04             	mov    0x4(%ebx),%eax
+    115e:	a8 02                	test   $0x2,%al
+    1160:	74 46                	je     11a8 <putc_unlocked+0x58>
+  if(!(f->flags & IO_SETUP))
+    1162:	a8 40                	test   $0x40,%al
+    1164:	74 4a                	je     11b0 <putc_unlocked+0x60>
+  if(f->n == f->size && flush(f) < 0)
+    1166:	8b 43 14             	mov    0x14(%ebx),%eax
+    1169:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    116c:	74 51                	je     11bf <putc_unlocked+0x6f>
+  f->buf[f->n++] = c;
+    116e:	8d 48 01             	lea    0x1(%eax),%ecx
+    1171:	8b 53 08             	mov    0x8(%ebx),%edx
+    1174:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    1177:	89 f1                	mov    %esi,%ecx
+    1179:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    117c:	83 fe 0a             	cmp    $0xa,%esi
+    117f:	74 0f                	je     1190 <putc_unlocked+0x40>
+  return c & 0xff;
+    1181:	89 f0                	mov    %esi,%eax
+    1183:	0f b6 c0             	movzbl %al,%eax
+}
+    1186:	5b                   	pop    %ebx
+    1187:	5e                   	pop    %esi
+    1188:	5d                   	pop    %ebp
+    1189:	c3                   	ret
+    118a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    1190:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1194:	74 eb                	je     1181 <putc_unlocked+0x31>
+    1196:	89 d8                	mov    %ebx,%eax
+    1198:	e8 d3 fa ff ff       	call   c70 <flush>
+    119d:	85 c0                	test   %eax,%eax
+    119f:	79 e0                	jns    1181 <putc_unlocked+0x31>
+    11a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return EOF;
+    11a8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    11ad:	eb d7                	jmp    1186 <putc_unlocked+0x36>
+    11af:	90                   	nop
+    setup(f);
+    11b0:	89 d8                	mov    %ebx,%eax
+    11b2:	e8 69 fa ff ff       	call   c20 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    11b7:	8b 43 14             	mov    0x14(%ebx),%eax
+    11ba:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    11bd:	75 af                	jne    116e <putc_unlocked+0x1e>
+    11bf:	89 d8                	mov    %ebx,%eax
+    11c1:	e8 aa fa ff ff       	call   c70 <flush>
+    11c6:	85 c0                	test   %eax,%eax
+    11c8:	78 de                	js     11a8 <putc_unlocked+0x58>
+  f->buf[f->n++] = c;
+    11ca:	8b 43 14             	mov    0x14(%ebx),%eax
+    11cd:	eb 9f                	jmp    116e <putc_unlocked+0x1e>
+    11cf:	90                   	nop
+
+000011d0 <fputc>:
+{
+    11d0:	55                   	push   %ebp
+    11d1:	89 e5                	mov    %esp,%ebp
+    11d3:	56                   	push   %esi
+    11d4:	53                   	push   %ebx
+  if(threaded)
+    11d5:	8b 15 80 2b 00 00    	mov    0x2b80,%edx
+{
+    11db:	8b 75 08             	mov    0x8(%ebp),%esi
+    11de:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(threaded)
+    11e1:	85 d2                	test   %edx,%edx
+    11e3:	75 6b                	jne    1250 <fputc+0x80>
+  if(!(f->flags & IO_WRITE))
+    11e5:	8b 43 04             	mov    0x4(%ebx),%eax
+    11e8:	a8 02                	test   $0x2,%al
+    11ea:	0f 84 b8 00 00 00    	je     12a8 <fputc+0xd8>
+  if(!(f->flags & IO_SETUP))
+    11f0:	a8 40                	test   $0x40,%al
+    11f2:	74 76                	je     126a <fputc+0x9a>
+  if(f->n == f->size && flush(f) < 0)
+    11f4:	8b 43 14             	mov    0x14(%ebx),%eax
+    11f7:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    11fa:	74 7d                	je     1279 <fputc+0xa9>
+  f->buf[f->n++] = c;
+    11fc:	8d 48 01             	lea    0x1(%eax),%ecx
+    11ff:	8b 53 08             	mov    0x8(%ebx),%edx
+    1202:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    1205:	89 f1                	mov    %esi,%ecx
+    1207:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    120a:	83 fe 0a             	cmp    $0xa,%esi
+    120d:	74 21                	je     1230 <fputc+0x60>
+  return c & 0xff;
+    120f:	89 f0                	mov    %esi,%eax
+    1211:	0f b6 f0             	movzbl %al,%esi
+  if(threaded)
+    1214:	a1 80 2b 00 00       	mov    0x2b80,%eax
+    1219:	85 c0                	test   %eax,%eax
+    121b:	75 73                	jne    1290 <fputc+0xc0>
+}
+    121d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1220:	89 f0                	mov    %esi,%eax
+    1222:	5b                   	pop    %ebx
+    1223:	5e                   	pop    %esi
+    1224:	5d                   	pop    %ebp
+    1225:	c3                   	ret
+    1226:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    122d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    1230:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1234:	74 d9                	je     120f <fputc+0x3f>
+    1236:	89 d8                	mov    %ebx,%eax
+    1238:	e8 33 fa ff ff       	call   c70 <flush>
+    123d:	85 c0                	test   %eax,%eax
+    123f:	79 ce                	jns    120f <fputc+0x3f>
+    return EOF;
+    1241:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1246:	eb cc                	jmp    1214 <fputc+0x44>
+    1248:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    124f:	90                   	nop
+    mutex_lock(&f->lock);
+    1250:	83 ec 0c             	sub    $0xc,%esp
+    1253:	8d 43 18             	lea    0x18(%ebx),%eax
+    1256:	50                   	push   %eax
+    1257:	e8 54 f3 ff ff       	call   5b0 <mutex_lock>
+  if(!(f->flags & IO_WRITE))
+    125c:	8b 43 04             	mov    0x4(%ebx),%eax
+    125f:	83 c4 10             	add    $0x10,%esp
+    1262:	a8 02                	test   $0x2,%al
+    1264:	74 db                	je     1241 <fputc+0x71>
+  if(!(f->flags & IO_SETUP))
+    1266:	a8 40                	test   $0x40,%al
+    1268:	75 8a                	jne    11f4 <fputc+0x24>
+    setup(f);
+    126a:	89 d8                	mov    %ebx,%eax
+    126c:	e8 af f9 ff ff       	call   c20 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    1271:	8b 43 14             	mov    0x14(%ebx),%eax
+    1274:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    1277:	75 83                	jne    11fc <fputc+0x2c>
+    1279:	89 d8                	mov    %ebx,%eax
+    127b:	e8 f0 f9 ff ff       	call   c70 <flush>
+    1280:	85 c0                	test   %eax,%eax
+    1282:	78 bd                	js     1241 <fputc+0x71>
+  f->buf[f->n++] = c;
+    1284:	8b 43 14             	mov    0x14(%ebx),%eax
+    1287:	e9 70 ff ff ff       	jmp    11fc <fputc+0x2c>
+    128c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1290:	83 ec 0c             	sub    $0xc,%esp
+    1293:	83 c3 18             	add    $0x18,%ebx
+    1296:	53                   	push   %ebx
+    1297:	e8 64 f3 ff ff       	call   600 <mutex_unlock>
+    129c:	83 c4 10             	add    $0x10,%esp
+}
+    129f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12a2:	89 f0                	mov    %esi,%eax
+    12a4:	5b                   	pop    %ebx
+    12a5:	5e                   	pop    %esi
+    12a6:	5d                   	pop    %ebp
+    12a7:	c3                   	ret
+    return EOF;
+    12a8:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    12ad:	e9 6b ff ff ff       	jmp    121d <fputc+0x4d>
+    12b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000012c0 <fwrite>:
+{
+    12c0:	55                   	push   %ebp
+    12c1:	89 e5                	mov    %esp,%ebp
+    12c3:	57                   	push   %edi
+    12c4:	56                   	push   %esi
+    12c5:	53                   	push   %ebx
+    12c6:	83 ec 1c             	sub    $0x1c,%esp
+    12c9:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  if(!(f->flags & IO_WRITE) || size <= 0)
+    12cc:	8b 43 04             	mov    0x4(%ebx),%eax
+    12cf:	a8 02                	test   $0x2,%al
+    12d1:	0f 84 ec 00 00 00    	je     13c3 <fwrite+0x103>
+    12d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    12da:	85 c9                	test   %ecx,%ecx
+    12dc:	0f 8e e1 00 00 00    	jle    13c3 <fwrite+0x103>
+  if(threaded)
+    12e2:	8b 15 80 2b 00 00    	mov    0x2b80,%edx
+    12e8:	85 d2                	test   %edx,%edx
+    12ea:	0f 85 1c 01 00 00    	jne    140c <fwrite+0x14c>
+  if(!(f->flags & IO_SETUP))
+    12f0:	a8 40                	test   $0x40,%al
+    12f2:	0f 84 08 01 00 00    	je     1400 <fwrite+0x140>
+  for(len = size*nmemb; len > 0; len -= n){
+    12f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+    12fb:	0f af 45 10          	imul   0x10(%ebp),%eax
+    12ff:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    1302:	85 c0                	test   %eax,%eax
+    1304:	0f 8e 2a 01 00 00    	jle    1434 <fwrite+0x174>
+  s = p;
+    130a:	8b 45 08             	mov    0x8(%ebp),%eax
+  nl = 0;
+    130d:	31 ff                	xor    %edi,%edi
+    130f:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+        nl = 1;
+    1312:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  s = p;
+    1315:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1318:	8b 43 14             	mov    0x14(%ebx),%eax
+        nl = 1;
+    131b:	89 ce                	mov    %ecx,%esi
+    if(f->n == f->size && flush(f) < 0)
+    131d:	89 c2                	mov    %eax,%edx
+    131f:	39 f0                	cmp    %esi,%eax
+    1321:	74 6e                	je     1391 <fwrite+0xd1>
+    1323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1327:	90                   	nop
+    if(n > len)
+    1328:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    n = f->size - f->n;
+    132b:	89 f1                	mov    %esi,%ecx
+    132d:	29 c1                	sub    %eax,%ecx
+    132f:	39 f9                	cmp    %edi,%ecx
+    1331:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1334:	85 c9                	test   %ecx,%ecx
+    1336:	0f 8e 7c 00 00 00    	jle    13b8 <fwrite+0xf8>
+    133c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    133f:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1342:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    1345:	8d 34 08             	lea    (%eax,%ecx,1),%esi
+    1348:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    134b:	eb 06                	jmp    1353 <fwrite+0x93>
+    134d:	8d 76 00             	lea    0x0(%esi),%esi
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1350:	8b 53 14             	mov    0x14(%ebx),%edx
+    1353:	8d 4a 01             	lea    0x1(%edx),%ecx
+    1356:	8b 73 08             	mov    0x8(%ebx),%esi
+    1359:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    135c:	0f b6 08             	movzbl (%eax),%ecx
+        nl = 1;
+    135f:	80 f9 0a             	cmp    $0xa,%cl
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1362:	88 0c 16             	mov    %cl,(%esi,%edx,1)
+        nl = 1;
+    1365:	be 01 00 00 00       	mov    $0x1,%esi
+    136a:	0f 44 fe             	cmove  %esi,%edi
+    for(i = 0; i < n; i++)
+    136d:	83 c0 01             	add    $0x1,%eax
+    1370:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    1373:	75 db                	jne    1350 <fwrite+0x90>
+    s += n;
+    1375:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1378:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    137b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    s += n;
+    137e:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    1381:	85 c0                	test   %eax,%eax
+    1383:	7e 48                	jle    13cd <fwrite+0x10d>
+    1385:	8b 43 14             	mov    0x14(%ebx),%eax
+    1388:	8b 73 0c             	mov    0xc(%ebx),%esi
+    if(f->n == f->size && flush(f) < 0)
+    138b:	89 c2                	mov    %eax,%edx
+    138d:	39 f0                	cmp    %esi,%eax
+    138f:	75 97                	jne    1328 <fwrite+0x68>
+    1391:	89 d8                	mov    %ebx,%eax
+    1393:	e8 d8 f8 ff ff       	call   c70 <flush>
+    1398:	85 c0                	test   %eax,%eax
+    139a:	78 31                	js     13cd <fwrite+0x10d>
+    n = f->size - f->n;
+    139c:	8b 73 0c             	mov    0xc(%ebx),%esi
+    139f:	8b 43 14             	mov    0x14(%ebx),%eax
+    13a2:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    13a5:	89 f1                	mov    %esi,%ecx
+    13a7:	89 c2                	mov    %eax,%edx
+    13a9:	29 c1                	sub    %eax,%ecx
+    13ab:	39 f9                	cmp    %edi,%ecx
+    13ad:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    13b0:	85 c9                	test   %ecx,%ecx
+    13b2:	7f 88                	jg     133c <fwrite+0x7c>
+    13b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    s += n;
+    13b8:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    13bb:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    13be:	e9 5a ff ff ff       	jmp    131d <fwrite+0x5d>
+}
+    13c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    13c6:	31 c0                	xor    %eax,%eax
+}
+    13c8:	5b                   	pop    %ebx
+    13c9:	5e                   	pop    %esi
+    13ca:	5f                   	pop    %edi
+    13cb:	5d                   	pop    %ebp
+    13cc:	c3                   	ret
+  if(nl && (f->flags & IO_LINE))
+    13cd:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    13d0:	85 ff                	test   %edi,%edi
+    13d2:	74 06                	je     13da <fwrite+0x11a>
+    13d4:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    13d8:	75 1d                	jne    13f7 <fwrite+0x137>
+  return (s - (const char*)p) / size;
+    13da:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    13dd:	2b 75 08             	sub    0x8(%ebp),%esi
+  if(threaded)
+    13e0:	a1 80 2b 00 00       	mov    0x2b80,%eax
+    13e5:	85 c0                	test   %eax,%eax
+    13e7:	75 3a                	jne    1423 <fwrite+0x163>
+  return (s - (const char*)p) / size;
+    13e9:	89 f0                	mov    %esi,%eax
+    13eb:	99                   	cltd
+    13ec:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    13ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13f2:	5b                   	pop    %ebx
+    13f3:	5e                   	pop    %esi
+    13f4:	5f                   	pop    %edi
+    13f5:	5d                   	pop    %ebp
+    13f6:	c3                   	ret
+    flush(f);
+    13f7:	89 d8                	mov    %ebx,%eax
+    13f9:	e8 72 f8 ff ff       	call   c70 <flush>
+    13fe:	eb da                	jmp    13da <fwrite+0x11a>
+    setup(f);
+    1400:	89 d8                	mov    %ebx,%eax
+    1402:	e8 19 f8 ff ff       	call   c20 <setup>
+    1407:	e9 ec fe ff ff       	jmp    12f8 <fwrite+0x38>
+    mutex_lock(&f->lock);
+    140c:	83 ec 0c             	sub    $0xc,%esp
+    140f:	8d 43 18             	lea    0x18(%ebx),%eax
+    1412:	50                   	push   %eax
+    1413:	e8 98 f1 ff ff       	call   5b0 <mutex_lock>
+  if(!(f->flags & IO_SETUP))
+    1418:	8b 43 04             	mov    0x4(%ebx),%eax
+    141b:	83 c4 10             	add    $0x10,%esp
+    141e:	e9 cd fe ff ff       	jmp    12f0 <fwrite+0x30>
+    mutex_unlock(&f->lock);
+    1423:	83 ec 0c             	sub    $0xc,%esp
+    1426:	83 c3 18             	add    $0x18,%ebx
+    1429:	53                   	push   %ebx
+    142a:	e8 d1 f1 ff ff       	call   600 <mutex_unlock>
+    142f:	83 c4 10             	add    $0x10,%esp
+    1432:	eb b5                	jmp    13e9 <fwrite+0x129>
+  for(len = size*nmemb; len > 0; len -= n){
+    1434:	31 f6                	xor    %esi,%esi
+    1436:	eb a8                	jmp    13e0 <fwrite+0x120>
+    1438:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    143f:	90                   	nop
+
+00001440 <fgetc>:
+  return f->buf[f->r++] & 0xff;
+}
+
+int
+fgetc(FILE *f)
+{
+    1440:	55                   	push   %ebp
+    1441:	89 e5                	mov    %esp,%ebp
+    1443:	56                   	push   %esi
+    1444:	53                   	push   %ebx
+  if(threaded)
+    1445:	8b 15 80 2b 00 00    	mov    0x2b80,%edx
+{
+    144b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    144e:	85 d2                	test   %edx,%edx
+    1450:	75 2e                	jne    1480 <fgetc+0x40>
+  if(!(f->flags & IO_READ))
+    1452:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1456:	74 78                	je     14d0 <fgetc+0x90>
+  if(f->r == f->n && fill(f) == 0)
+    1458:	8b 43 10             	mov    0x10(%ebx),%eax
+    145b:	3b 43 14             	cmp    0x14(%ebx),%eax
+    145e:	74 60                	je     14c0 <fgetc+0x80>
+  return f->buf[f->r++] & 0xff;
+    1460:	8b 53 08             	mov    0x8(%ebx),%edx
+    1463:	8d 48 01             	lea    0x1(%eax),%ecx
+    1466:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1469:	0f b6 34 02          	movzbl (%edx,%eax,1),%esi
+  if(threaded)
+    146d:	a1 80 2b 00 00       	mov    0x2b80,%eax
+    1472:	85 c0                	test   %eax,%eax
+    1474:	75 2a                	jne    14a0 <fgetc+0x60>
+
+  flockfile(f);
+  c = getc_unlocked(f);
+  funlockfile(f);
+  return c;
+}
+    1476:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1479:	89 f0                	mov    %esi,%eax
+    147b:	5b                   	pop    %ebx
+    147c:	5e                   	pop    %esi
+    147d:	5d                   	pop    %ebp
+    147e:	c3                   	ret
+    147f:	90                   	nop
+    mutex_lock(&f->lock);
+    1480:	83 ec 0c             	sub    $0xc,%esp
+    1483:	8d 43 18             	lea    0x18(%ebx),%eax
+    1486:	50                   	push   %eax
+    1487:	e8 24 f1 ff ff       	call   5b0 <mutex_lock>
+  if(!(f->flags & IO_READ))
+    148c:	83 c4 10             	add    $0x10,%esp
+    148f:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1493:	75 c3                	jne    1458 <fgetc+0x18>
+    return EOF;
+    1495:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    149a:	eb d1                	jmp    146d <fgetc+0x2d>
+    149c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    14a0:	83 ec 0c             	sub    $0xc,%esp
+    14a3:	83 c3 18             	add    $0x18,%ebx
+    14a6:	53                   	push   %ebx
+    14a7:	e8 54 f1 ff ff       	call   600 <mutex_unlock>
+    14ac:	83 c4 10             	add    $0x10,%esp
+}
+    14af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    14b2:	89 f0                	mov    %esi,%eax
+    14b4:	5b                   	pop    %ebx
+    14b5:	5e                   	pop    %esi
+    14b6:	5d                   	pop    %ebp
+    14b7:	c3                   	ret
+    14b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14bf:	90                   	nop
+  if(f->r == f->n && fill(f) == 0)
+    14c0:	89 d8                	mov    %ebx,%eax
+    14c2:	e8 c9 f8 ff ff       	call   d90 <fill>
+    14c7:	85 c0                	test   %eax,%eax
+    14c9:	74 ca                	je     1495 <fgetc+0x55>
+  return f->buf[f->r++] & 0xff;
+    14cb:	8b 43 10             	mov    0x10(%ebx),%eax
+    14ce:	eb 90                	jmp    1460 <fgetc+0x20>
+    return EOF;
+    14d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    14d5:	eb 9f                	jmp    1476 <fgetc+0x36>
+    14d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14de:	66 90                	xchg   %ax,%ax
+
+000014e0 <fread>:
+
+int
+fread(void *p, int size, int nmemb, FILE *f)
+{
+    14e0:	55                   	push   %ebp
+    14e1:	89 e5                	mov    %esp,%ebp
+    14e3:	57                   	push   %edi
+    14e4:	56                   	push   %esi
+    14e5:	53                   	push   %ebx
+    14e6:	83 ec 1c             	sub    $0x1c,%esp
+    14e9:	8b 75 14             	mov    0x14(%ebp),%esi
+  char *d;
+  int n, len;
+
+  if(!(f->flags & IO_READ) || size <= 0)
+    14ec:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+    14f0:	74 7e                	je     1570 <fread+0x90>
+    14f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+    14f5:	85 d2                	test   %edx,%edx
+    14f7:	7e 77                	jle    1570 <fread+0x90>
+  if(threaded)
+    14f9:	a1 80 2b 00 00       	mov    0x2b80,%eax
+    return 0;
+  flockfile(f);
+  d = p;
+  for(len = size*nmemb; len > 0; len -= n){
+    14fe:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1501:	0f af 7d 10          	imul   0x10(%ebp),%edi
+  if(threaded)
+    1505:	85 c0                	test   %eax,%eax
+    1507:	0f 85 93 00 00 00    	jne    15a0 <fread+0xc0>
+  for(len = size*nmemb; len > 0; len -= n){
+    150d:	85 ff                	test   %edi,%edi
+    150f:	7e 61                	jle    1572 <fread+0x92>
+    if(f->r == f->n && fill(f) == 0)
+    1511:	8b 46 10             	mov    0x10(%esi),%eax
+  d = p;
+    1514:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1517:	eb 35                	jmp    154e <fread+0x6e>
+    1519:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      break;
+    n = f->n - f->r;
+    1520:	29 c3                	sub    %eax,%ebx
+    1522:	39 fb                	cmp    %edi,%ebx
+    1524:	0f 4f df             	cmovg  %edi,%ebx
+    if(n > len)
+      n = len;
+    memmove(d, f->buf + f->r, n);
+    1527:	83 ec 04             	sub    $0x4,%esp
+    152a:	53                   	push   %ebx
+    152b:	03 46 08             	add    0x8(%esi),%eax
+  for(len = size*nmemb; len > 0; len -= n){
+    152e:	29 df                	sub    %ebx,%edi
+    memmove(d, f->buf + f->r, n);
+    1530:	50                   	push   %eax
+    1531:	51                   	push   %ecx
+    1532:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1535:	e8 36 f0 ff ff       	call   570 <memmove>
+    f->r += n;
+    153a:	8b 46 10             	mov    0x10(%esi),%eax
+    d += n;
+    153d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1540:	83 c4 10             	add    $0x10,%esp
+    f->r += n;
+    1543:	01 d8                	add    %ebx,%eax
+    d += n;
+    1545:	01 d9                	add    %ebx,%ecx
+    f->r += n;
+    1547:	89 46 10             	mov    %eax,0x10(%esi)
+  for(len = size*nmemb; len > 0; len -= n){
+    154a:	85 ff                	test   %edi,%edi
+    154c:	7e 32                	jle    1580 <fread+0xa0>
+    if(f->r == f->n && fill(f) == 0)
+    154e:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1551:	39 c3                	cmp    %eax,%ebx
+    1553:	75 cb                	jne    1520 <fread+0x40>
+    1555:	89 f0                	mov    %esi,%eax
+    1557:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    155a:	e8 31 f8 ff ff       	call   d90 <fill>
+    155f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1562:	85 c0                	test   %eax,%eax
+    1564:	74 1a                	je     1580 <fread+0xa0>
+    n = f->n - f->r;
+    1566:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1569:	8b 46 10             	mov    0x10(%esi),%eax
+    156c:	eb b2                	jmp    1520 <fread+0x40>
+    156e:	66 90                	xchg   %ax,%ax
+    return 0;
+    1570:	31 c0                	xor    %eax,%eax
+  }
+  funlockfile(f);
+  return (d - (char*)p) / size;
+}
+    1572:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1575:	5b                   	pop    %ebx
+    1576:	5e                   	pop    %esi
+    1577:	5f                   	pop    %edi
+    1578:	5d                   	pop    %ebp
+    1579:	c3                   	ret
+    157a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (d - (char*)p) / size;
+    1580:	2b 4d 08             	sub    0x8(%ebp),%ecx
+    1583:	89 cb                	mov    %ecx,%ebx
+  if(threaded)
+    1585:	a1 80 2b 00 00       	mov    0x2b80,%eax
+    158a:	85 c0                	test   %eax,%eax
+    158c:	75 32                	jne    15c0 <fread+0xe0>
+  return (d - (char*)p) / size;
+    158e:	89 d8                	mov    %ebx,%eax
+    1590:	99                   	cltd
+    1591:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1594:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1597:	5b                   	pop    %ebx
+    1598:	5e                   	pop    %esi
+    1599:	5f                   	pop    %edi
+    159a:	5d                   	pop    %ebp
+    159b:	c3                   	ret
+    159c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    15a0:	83 ec 0c             	sub    $0xc,%esp
+    15a3:	8d 46 18             	lea    0x18(%esi),%eax
+    15a6:	50                   	push   %eax
+    15a7:	e8 04 f0 ff ff       	call   5b0 <mutex_lock>
+  for(len = size*nmemb; len > 0; len -= n){
+    15ac:	83 c4 10             	add    $0x10,%esp
+    15af:	85 ff                	test   %edi,%edi
+    15b1:	0f 8f 5a ff ff ff    	jg     1511 <fread+0x31>
+    15b7:	31 db                	xor    %ebx,%ebx
+    15b9:	eb ca                	jmp    1585 <fread+0xa5>
+    15bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    15bf:	90                   	nop
+    mutex_unlock(&f->lock);
+    15c0:	83 ec 0c             	sub    $0xc,%esp
+    15c3:	83 c6 18             	add    $0x18,%esi
+    15c6:	56                   	push   %esi
+    15c7:	e8 34 f0 ff ff       	call   600 <mutex_unlock>
+  return (d - (char*)p) / size;
+    15cc:	89 d8                	mov    %ebx,%eax
+    15ce:	83 c4 10             	add    $0x10,%esp
+    15d1:	99                   	cltd
+    15d2:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    15d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15d8:	5b                   	pop    %ebx
+    15d9:	5e                   	pop    %esi
+    15da:	5f                   	pop    %edi
+    15db:	5d                   	pop    %ebp
+    15dc:	c3                   	ret
+    15dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000015e0 <fgets>:
+
+// Read a line of at most max-1 bytes, keeping the newline.
+// Returns 0 if there was nothing left to read.
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    15e0:	55                   	push   %ebp
+    15e1:	89 e5                	mov    %esp,%ebp
+    15e3:	57                   	push   %edi
+    15e4:	56                   	push   %esi
+    15e5:	53                   	push   %ebx
+    15e6:	83 ec 1c             	sub    $0x1c,%esp
+  if(threaded)
+    15e9:	8b 35 80 2b 00 00    	mov    0x2b80,%esi
+{
+    15ef:	8b 7d 08             	mov    0x8(%ebp),%edi
+    15f2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if(threaded)
+    15f5:	85 f6                	test   %esi,%esi
+    15f7:	0f 85 83 00 00 00    	jne    1680 <fgets+0xa0>
+{
+    15fd:	31 f6                	xor    %esi,%esi
+    15ff:	eb 2a                	jmp    162b <fgets+0x4b>
+    1601:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return f->buf[f->r++] & 0xff;
+    1608:	8b 53 08             	mov    0x8(%ebx),%edx
+    160b:	8d 48 01             	lea    0x1(%eax),%ecx
+    160e:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1611:	0f b6 14 02          	movzbl (%edx,%eax,1),%edx
+
+  flockfile(f);
+  for(i = 0; i+1 < max; ){
+    if((c = getc_unlocked(f)) == EOF)
+      break;
+    buf[i++] = c;
+    1615:	88 54 37 ff          	mov    %dl,-0x1(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    1619:	80 fa 0a             	cmp    $0xa,%dl
+    161c:	0f 84 96 00 00 00    	je     16b8 <fgets+0xd8>
+    1622:	83 fa 0d             	cmp    $0xd,%edx
+    1625:	0f 84 8d 00 00 00    	je     16b8 <fgets+0xd8>
+  for(i = 0; i+1 < max; ){
+    162b:	89 f2                	mov    %esi,%edx
+    162d:	83 c6 01             	add    $0x1,%esi
+    1630:	3b 75 0c             	cmp    0xc(%ebp),%esi
+    1633:	7d 2b                	jge    1660 <fgets+0x80>
+  if(!(f->flags & IO_READ))
+    1635:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1639:	74 25                	je     1660 <fgets+0x80>
+  if(f->r == f->n && fill(f) == 0)
+    163b:	8b 43 10             	mov    0x10(%ebx),%eax
+    163e:	3b 43 14             	cmp    0x14(%ebx),%eax
+    1641:	75 c5                	jne    1608 <fgets+0x28>
+    1643:	89 d8                	mov    %ebx,%eax
+    1645:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1648:	e8 43 f7 ff ff       	call   d90 <fill>
+    164d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1650:	85 c0                	test   %eax,%eax
+    1652:	74 0c                	je     1660 <fgets+0x80>
+  return f->buf[f->r++] & 0xff;
+    1654:	8b 43 10             	mov    0x10(%ebx),%eax
+    1657:	eb af                	jmp    1608 <fgets+0x28>
+    1659:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1660:	8b 0d 80 2b 00 00    	mov    0x2b80,%ecx
+      break;
+  }
+  buf[i] = '\0';
+    1666:	c6 04 17 00          	movb   $0x0,(%edi,%edx,1)
+  if(threaded)
+    166a:	85 c9                	test   %ecx,%ecx
+    166c:	75 2a                	jne    1698 <fgets+0xb8>
+  funlockfile(f);
+  return i > 0 ? buf : 0;
+    166e:	31 c0                	xor    %eax,%eax
+    1670:	85 d2                	test   %edx,%edx
+    1672:	74 02                	je     1676 <fgets+0x96>
+    1674:	89 f8                	mov    %edi,%eax
+}
+    1676:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1679:	5b                   	pop    %ebx
+    167a:	5e                   	pop    %esi
+    167b:	5f                   	pop    %edi
+    167c:	5d                   	pop    %ebp
+    167d:	c3                   	ret
+    167e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    1680:	83 ec 0c             	sub    $0xc,%esp
+    1683:	8d 43 18             	lea    0x18(%ebx),%eax
+    1686:	50                   	push   %eax
+    1687:	e8 24 ef ff ff       	call   5b0 <mutex_lock>
+    168c:	83 c4 10             	add    $0x10,%esp
+    168f:	e9 69 ff ff ff       	jmp    15fd <fgets+0x1d>
+    1694:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1698:	83 ec 0c             	sub    $0xc,%esp
+    169b:	83 c3 18             	add    $0x18,%ebx
+    169e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    16a1:	53                   	push   %ebx
+    16a2:	e8 59 ef ff ff       	call   600 <mutex_unlock>
+    16a7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    16aa:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    16ad:	31 c0                	xor    %eax,%eax
+    16af:	85 d2                	test   %edx,%edx
+    16b1:	75 c1                	jne    1674 <fgets+0x94>
+    16b3:	eb c1                	jmp    1676 <fgets+0x96>
+    16b5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    16b8:	a1 80 2b 00 00       	mov    0x2b80,%eax
+  buf[i] = '\0';
+    16bd:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  if(threaded)
+    16c1:	85 c0                	test   %eax,%eax
+    16c3:	74 af                	je     1674 <fgets+0x94>
+    mutex_unlock(&f->lock);
+    16c5:	83 ec 0c             	sub    $0xc,%esp
+    16c8:	83 c3 18             	add    $0x18,%ebx
+    16cb:	53                   	push   %ebx
+    16cc:	e8 2f ef ff ff       	call   600 <mutex_unlock>
+    16d1:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    16d4:	89 f8                	mov    %edi,%eax
+    16d6:	eb 9e                	jmp    1676 <fgets+0x96>
+    16d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16df:	90                   	nop
+
+000016e0 <gets>:
+// at most a line per read(), goes through stdin's buffer: from a
+// file or pipe, a buffered read could take input meant for a child
+// process, so read a byte at a time.
+char*
+gets(char *buf, int max)
+{
+    16e0:	55                   	push   %ebp
+    16e1:	89 e5                	mov    %esp,%ebp
+    16e3:	57                   	push   %edi
+    16e4:	56                   	push   %esi
+    16e5:	53                   	push   %ebx
+    16e6:	83 ec 2c             	sub    $0x2c,%esp
+  int i, cc;
+  char c;
+
+  if(!(stdin->flags & IO_SETUP))
+    16e9:	8b 15 84 2a 00 00    	mov    0x2a84,%edx
+{
+    16ef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!(stdin->flags & IO_SETUP))
+    16f2:	f6 c2 40             	test   $0x40,%dl
+    16f5:	74 79                	je     1770 <gets+0x90>
+    setup(stdin);
+  if(stdin->flags & IO_DEV){
+    16f7:	83 e2 20             	and    $0x20,%edx
+    16fa:	89 d7                	mov    %edx,%edi
+    16fc:	75 52                	jne    1750 <gets+0x70>
+  if(f == 0){
+    16fe:	e8 ed f5 ff ff       	call   cf0 <fflush.part.0>
+    fgets(buf, max, stdin);
+    return buf;
+  }
+  fflush(0);
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1703:	8d 75 e7             	lea    -0x19(%ebp),%esi
+  for(i=0; i+1 < max; ){
+    1706:	eb 2c                	jmp    1734 <gets+0x54>
+    1708:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    170f:	90                   	nop
+    cc = read(0, &c, 1);
+    1710:	83 ec 04             	sub    $0x4,%esp
+    1713:	6a 01                	push   $0x1
+    1715:	56                   	push   %esi
+    1716:	6a 00                	push   $0x0
+    1718:	e8 f5 ef ff ff       	call   712 <read>
+    if(cc < 1)
+    171d:	83 c4 10             	add    $0x10,%esp
+    1720:	85 c0                	test   %eax,%eax
+    1722:	7e 1b                	jle    173f <gets+0x5f>
+      break;
+    buf[i++] = c;
+    1724:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1728:	88 44 3b ff          	mov    %al,-0x1(%ebx,%edi,1)
+    if(c == '\n' || c == '\r')
+    172c:	3c 0a                	cmp    $0xa,%al
+    172e:	74 12                	je     1742 <gets+0x62>
+    1730:	3c 0d                	cmp    $0xd,%al
+    1732:	74 0e                	je     1742 <gets+0x62>
+  for(i=0; i+1 < max; ){
+    1734:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    1737:	83 c7 01             	add    $0x1,%edi
+    173a:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+    173d:	7c d1                	jl     1710 <gets+0x30>
+{
+    173f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      break;
+  }
+  buf[i] = '\0';
+    1742:	c6 04 3b 00          	movb   $0x0,(%ebx,%edi,1)
+  return buf;
+}
+    1746:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1749:	89 d8                	mov    %ebx,%eax
+    174b:	5b                   	pop    %ebx
+    174c:	5e                   	pop    %esi
+    174d:	5f                   	pop    %edi
+    174e:	5d                   	pop    %ebp
+    174f:	c3                   	ret
+    fgets(buf, max, stdin);
+    1750:	83 ec 04             	sub    $0x4,%esp
+    1753:	68 80 2a 00 00       	push   $0x2a80
+    1758:	ff 75 0c             	push   0xc(%ebp)
+    175b:	53                   	push   %ebx
+    175c:	e8 7f fe ff ff       	call   15e0 <fgets>
+    return buf;
+    1761:	83 c4 10             	add    $0x10,%esp
+}
+    1764:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1767:	89 d8                	mov    %ebx,%eax
+    1769:	5b                   	pop    %ebx
+    176a:	5e                   	pop    %esi
+    176b:	5f                   	pop    %edi
+    176c:	5d                   	pop    %ebp
+    176d:	c3                   	ret
+    176e:	66 90                	xchg   %ax,%ax
+    setup(stdin);
+    1770:	b8 80 2a 00 00       	mov    $0x2a80,%eax
+    1775:	e8 a6 f4 ff ff       	call   c20 <setup>
+  if(stdin->flags & IO_DEV){
+    177a:	8b 15 84 2a 00 00    	mov    0x2a84,%edx
+    1780:	e9 72 ff ff ff       	jmp    16f7 <gets+0x17>
+    1785:	66 90                	xchg   %ax,%ax
+    1787:	66 90                	xchg   %ax,%ax
+    1789:	66 90                	xchg   %ax,%ax
+    178b:	66 90                	xchg   %ax,%ax
+    178d:	66 90                	xchg   %ax,%ax
+    178f:	90                   	nop
+
+00001790 <bigfree>:
+
+// Give a big block back to the first-fit list, and return the
+// free block that now holds it. Caller holds lock.
+static Header*
+bigfree(Header *bp)
+{
+    1790:	55                   	push   %ebp
+    1791:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1793:	a1 24 32 00 00       	mov    0x3224,%eax
+{
+    1798:	89 e5                	mov    %esp,%ebp
+    179a:	56                   	push   %esi
+    179b:	53                   	push   %ebx
+    179c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    17a0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    17a2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    17a4:	39 ca                	cmp    %ecx,%edx
+    17a6:	73 38                	jae    17e0 <bigfree+0x50>
+    17a8:	39 c1                	cmp    %eax,%ecx
+    17aa:	72 04                	jb     17b0 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    17ac:	39 c2                	cmp    %eax,%edx
+    17ae:	72 f0                	jb     17a0 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    17b0:	8b 59 04             	mov    0x4(%ecx),%ebx
+    17b3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    17b6:	39 f0                	cmp    %esi,%eax
+    17b8:	74 36                	je     17f0 <bigfree+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    17ba:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  freep = p;
+  if(p + p->s.size == bp){
+    17bc:	8b 42 04             	mov    0x4(%edx),%eax
+    17bf:	89 cb                	mov    %ecx,%ebx
+  freep = p;
+    17c1:	89 15 24 32 00 00    	mov    %edx,0x3224
+  if(p + p->s.size == bp){
+    17c7:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    17ca:	39 f1                	cmp    %esi,%ecx
+    17cc:	74 2e                	je     17fc <bigfree+0x6c>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    17ce:	89 1a                	mov    %ebx,(%edx)
+    return p;
+  }
+  p->s.ptr = bp;
+  return bp;
+}
+    17d0:	89 c8                	mov    %ecx,%eax
+    17d2:	5b                   	pop    %ebx
+    17d3:	5e                   	pop    %esi
+    17d4:	5d                   	pop    %ebp
+    17d5:	c3                   	ret
+    17d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17dd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    17e0:	39 c1                	cmp    %eax,%ecx
+    17e2:	72 c8                	jb     17ac <bigfree+0x1c>
+    17e4:	eb ba                	jmp    17a0 <bigfree+0x10>
+    17e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17ed:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    17f0:	03 58 04             	add    0x4(%eax),%ebx
+    17f3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    17f6:	8b 02                	mov    (%edx),%eax
+    17f8:	8b 00                	mov    (%eax),%eax
+    17fa:	eb be                	jmp    17ba <bigfree+0x2a>
+    p->s.size += bp->s.size;
+    17fc:	03 41 04             	add    0x4(%ecx),%eax
+    17ff:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1802:	8b 19                	mov    (%ecx),%ebx
+    return p;
+    1804:	89 d1                	mov    %edx,%ecx
+}
+    1806:	89 c8                	mov    %ecx,%eax
+    p->s.ptr = bp->s.ptr;
+    1808:	89 1a                	mov    %ebx,(%edx)
+}
+    180a:	5b                   	pop    %ebx
+    180b:	5e                   	pop    %esi
+    180c:	5d                   	pop    %ebp
+    180d:	c3                   	ret
+    180e:	66 90                	xchg   %ax,%ax
+
+00001810 <trim>:
+// If free block bp ends the heap, return its whole pages to the
+// kernel, unless something else has moved the break since.
+// Caller holds lock.
+static void
+trim(Header *bp)
+{
+    1810:	55                   	push   %ebp
+    1811:	89 e5                	mov    %esp,%ebp
+    1813:	57                   	push   %edi
+    1814:	56                   	push   %esi
+    1815:	53                   	push   %ebx
+    1816:	89 c3                	mov    %eax,%ebx
+    1818:	83 ec 0c             	sub    $0xc,%esp
+  char *end;
+  uint n;
+
+  if((char*)(bp + bp->s.size) != heapend)
+    181b:	8b 53 04             	mov    0x4(%ebx),%edx
+    181e:	a1 20 32 00 00       	mov    0x3220,%eax
+    1823:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+    1826:	39 d0                	cmp    %edx,%eax
+    1828:	74 0e                	je     1838 <trim+0x28>
+  n = heapend - end;
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    bp->s.size -= n / sizeof(Header);
+    heapend = end;
+  }
+}
+    182a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    182d:	5b                   	pop    %ebx
+    182e:	5e                   	pop    %esi
+    182f:	5f                   	pop    %edi
+    1830:	5d                   	pop    %ebp
+    1831:	c3                   	ret
+    1832:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  end = (char*)PGROUNDUP((uint)(bp + 2));
+    1838:	8d bb 0f 10 00 00    	lea    0x100f(%ebx),%edi
+    183e:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  n = heapend - end;
+    1844:	29 f8                	sub    %edi,%eax
+    1846:	89 c6                	mov    %eax,%esi
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    1848:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    184d:	76 db                	jbe    182a <trim+0x1a>
+    184f:	83 ec 0c             	sub    $0xc,%esp
+    1852:	6a 00                	push   $0x0
+    1854:	e8 8b ef ff ff       	call   7e4 <sbrk>
+    1859:	83 c4 10             	add    $0x10,%esp
+    185c:	39 05 20 32 00 00    	cmp    %eax,0x3220
+    1862:	75 c6                	jne    182a <trim+0x1a>
+    1864:	89 f0                	mov    %esi,%eax
+    1866:	83 ec 0c             	sub    $0xc,%esp
+    1869:	f7 d8                	neg    %eax
+    186b:	50                   	push   %eax
+    186c:	e8 73 ef ff ff       	call   7e4 <sbrk>
+    1871:	83 c4 10             	add    $0x10,%esp
+    1874:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1877:	74 b1                	je     182a <trim+0x1a>
+    bp->s.size -= n / sizeof(Header);
+    1879:	89 f0                	mov    %esi,%eax
+    heapend = end;
+    187b:	89 3d 20 32 00 00    	mov    %edi,0x3220
+    bp->s.size -= n / sizeof(Header);
+    1881:	c1 e8 03             	shr    $0x3,%eax
+    1884:	29 43 04             	sub    %eax,0x4(%ebx)
+    heapend = end;
+    1887:	eb a1                	jmp    182a <trim+0x1a>
+    1889:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001890 <bigalloc>:
+}
+
+// Allocate a big block of nunits units. Caller holds lock.
+static Header*
+bigalloc(uint nunits)
+{
+    1890:	55                   	push   %ebp
+    1891:	89 e5                	mov    %esp,%ebp
+    1893:	57                   	push   %edi
+    1894:	89 c7                	mov    %eax,%edi
+    1896:	56                   	push   %esi
+    1897:	53                   	push   %ebx
+    1898:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    189b:	a1 24 32 00 00       	mov    0x3224,%eax
+    18a0:	85 c0                	test   %eax,%eax
+    18a2:	0f 84 98 00 00 00    	je     1940 <bigalloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    18a8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    18aa:	8b 4a 04             	mov    0x4(%edx),%ecx
+    18ad:	39 f9                	cmp    %edi,%ecx
+    18af:	73 67                	jae    1918 <bigalloc+0x88>
+  if(nu < 4096)
+    18b1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    18b6:	39 df                	cmp    %ebx,%edi
+    18b8:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    18bb:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    18c2:	eb 0d                	jmp    18d1 <bigalloc+0x41>
+    18c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    18c8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    18ca:	8b 4a 04             	mov    0x4(%edx),%ecx
+    18cd:	39 f9                	cmp    %edi,%ecx
+    18cf:	73 47                	jae    1918 <bigalloc+0x88>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    18d1:	89 d0                	mov    %edx,%eax
+    18d3:	39 15 24 32 00 00    	cmp    %edx,0x3224
+    18d9:	75 ed                	jne    18c8 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    18db:	83 ec 0c             	sub    $0xc,%esp
+    18de:	56                   	push   %esi
+    18df:	e8 00 ef ff ff       	call   7e4 <sbrk>
+  if(p == (char*)-1)
+    18e4:	83 c4 10             	add    $0x10,%esp
+    18e7:	83 f8 ff             	cmp    $0xffffffff,%eax
+    18ea:	74 1a                	je     1906 <bigalloc+0x76>
+  hp->s.size = nu;
+    18ec:	89 58 04             	mov    %ebx,0x4(%eax)
+  heapend = p + nu * sizeof(Header);
+    18ef:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    18f2:	89 15 20 32 00 00    	mov    %edx,0x3220
+  bigfree(hp);
+    18f8:	e8 93 fe ff ff       	call   1790 <bigfree>
+  return freep;
+    18fd:	a1 24 32 00 00       	mov    0x3224,%eax
+      if((p = morecore(nunits)) == 0)
+    1902:	85 c0                	test   %eax,%eax
+    1904:	75 c2                	jne    18c8 <bigalloc+0x38>
+        return 0;
+  }
+}
+    1906:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1909:	31 d2                	xor    %edx,%edx
+}
+    190b:	5b                   	pop    %ebx
+    190c:	89 d0                	mov    %edx,%eax
+    190e:	5e                   	pop    %esi
+    190f:	5f                   	pop    %edi
+    1910:	5d                   	pop    %ebp
+    1911:	c3                   	ret
+    1912:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1918:	39 cf                	cmp    %ecx,%edi
+    191a:	74 54                	je     1970 <bigalloc+0xe0>
+        p->s.size -= nunits;
+    191c:	29 f9                	sub    %edi,%ecx
+    191e:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    1921:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    1924:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    1927:	a3 24 32 00 00       	mov    %eax,0x3224
+}
+    192c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    192f:	89 d0                	mov    %edx,%eax
+    1931:	5b                   	pop    %ebx
+    1932:	5e                   	pop    %esi
+    1933:	5f                   	pop    %edi
+    1934:	5d                   	pop    %ebp
+    1935:	c3                   	ret
+    1936:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    193d:	8d 76 00             	lea    0x0(%esi),%esi
+    base.s.ptr = freep = prevp = &base;
+    1940:	c7 05 24 32 00 00 28 	movl   $0x3228,0x3224
+    1947:	32 00 00 
+    base.s.size = 0;
+    194a:	ba 28 32 00 00       	mov    $0x3228,%edx
+    base.s.ptr = freep = prevp = &base;
+    194f:	c7 05 28 32 00 00 28 	movl   $0x3228,0x3228
+    1956:	32 00 00 
+    base.s.size = 0;
+    1959:	c7 05 2c 32 00 00 00 	movl   $0x0,0x322c
+    1960:	00 00 00 
+    if(p->s.size >= nunits){
+    1963:	e9 49 ff ff ff       	jmp    18b1 <bigalloc+0x21>
+    1968:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    196f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1970:	8b 0a                	mov    (%edx),%ecx
+    1972:	89 08                	mov    %ecx,(%eax)
+    1974:	eb b1                	jmp    1927 <bigalloc+0x97>
+    1976:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    197d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001980 <drain>:
+}
+
+// Move n blocks of class c from cache tc to the shared list.
+static void
+drain(struct tcache *tc, int c, int n)
+{
+    1980:	55                   	push   %ebp
+    1981:	89 e5                	mov    %esp,%ebp
+    1983:	57                   	push   %edi
+    1984:	89 c7                	mov    %eax,%edi
+    1986:	56                   	push   %esi
+    1987:	89 d6                	mov    %edx,%esi
+    1989:	53                   	push   %ebx
+    198a:	89 cb                	mov    %ecx,%ebx
+    198c:	83 ec 0c             	sub    $0xc,%esp
+  if(threaded)
+    198f:	8b 15 a4 31 00 00    	mov    0x31a4,%edx
+    1995:	85 d2                	test   %edx,%edx
+    1997:	75 57                	jne    19f0 <drain+0x70>
+  Header *p;
+
+  acquire();
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1999:	85 c9                	test   %ecx,%ecx
+    199b:	7e 49                	jle    19e6 <drain+0x66>
+    199d:	89 d9                	mov    %ebx,%ecx
+    199f:	8d 14 b7             	lea    (%edi,%esi,4),%edx
+    19a2:	eb 23                	jmp    19c7 <drain+0x47>
+    19a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    tc->list[c] = p->s.ptr;
+    19a8:	8b 18                	mov    (%eax),%ebx
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    19aa:	83 e9 01             	sub    $0x1,%ecx
+    tc->n[c]--;
+    19ad:	83 6a 20 01          	subl   $0x1,0x20(%edx)
+    tc->list[c] = p->s.ptr;
+    19b1:	89 1a                	mov    %ebx,(%edx)
+    p->s.ptr = small[c];
+    19b3:	8b 1c b5 00 32 00 00 	mov    0x3200(,%esi,4),%ebx
+    19ba:	89 18                	mov    %ebx,(%eax)
+    small[c] = p;
+    19bc:	89 04 b5 00 32 00 00 	mov    %eax,0x3200(,%esi,4)
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    19c3:	85 c9                	test   %ecx,%ecx
+    19c5:	7e 06                	jle    19cd <drain+0x4d>
+    19c7:	8b 02                	mov    (%edx),%eax
+    19c9:	85 c0                	test   %eax,%eax
+    19cb:	75 db                	jne    19a8 <drain+0x28>
+  if(threaded)
+    19cd:	a1 a4 31 00 00       	mov    0x31a4,%eax
+    19d2:	85 c0                	test   %eax,%eax
+    19d4:	74 10                	je     19e6 <drain+0x66>
+    mutex_unlock(&lock);
+    19d6:	83 ec 0c             	sub    $0xc,%esp
+    19d9:	68 a8 31 00 00       	push   $0x31a8
+    19de:	e8 1d ec ff ff       	call   600 <mutex_unlock>
+}
+    19e3:	83 c4 10             	add    $0x10,%esp
+  }
+  release();
+}
+    19e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19e9:	5b                   	pop    %ebx
+    19ea:	5e                   	pop    %esi
+    19eb:	5f                   	pop    %edi
+    19ec:	5d                   	pop    %ebp
+    19ed:	c3                   	ret
+    19ee:	66 90                	xchg   %ax,%ax
+    mutex_lock(&lock);
+    19f0:	83 ec 0c             	sub    $0xc,%esp
+    19f3:	68 a8 31 00 00       	push   $0x31a8
+    19f8:	e8 b3 eb ff ff       	call   5b0 <mutex_lock>
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    19fd:	83 c4 10             	add    $0x10,%esp
+    1a00:	85 db                	test   %ebx,%ebx
+    1a02:	7f 99                	jg     199d <drain+0x1d>
+    1a04:	eb c7                	jmp    19cd <drain+0x4d>
+    1a06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001a10 <mycache>:
+{
+    1a10:	55                   	push   %ebp
+    return &maincache;
+    1a11:	b8 c0 31 00 00       	mov    $0x31c0,%eax
+{
+    1a16:	89 e5                	mov    %esp,%ebp
+    1a18:	53                   	push   %ebx
+  sp = PGROUNDDOWN((uint)&sp);
+    1a19:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+    1a1c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+    1a22:	83 ec 14             	sub    $0x14,%esp
+  if(!threaded || sp == mainstack)
+    1a25:	8b 0d a4 31 00 00    	mov    0x31a4,%ecx
+  sp = PGROUNDDOWN((uint)&sp);
+    1a2b:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  if(!threaded || sp == mainstack)
+    1a2e:	85 c9                	test   %ecx,%ecx
+    1a30:	74 0f                	je     1a41 <mycache+0x31>
+    1a32:	3b 1d a0 31 00 00    	cmp    0x31a0,%ebx
+    1a38:	74 07                	je     1a41 <mycache+0x31>
+  if(*cp == 0){
+    1a3a:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    1a3d:	85 c0                	test   %eax,%eax
+    1a3f:	74 0f                	je     1a50 <mycache+0x40>
+}
+    1a41:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1a44:	c9                   	leave
+    1a45:	c3                   	ret
+    1a46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a4d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1a50:	83 ec 0c             	sub    $0xc,%esp
+    1a53:	68 a8 31 00 00       	push   $0x31a8
+    1a58:	e8 53 eb ff ff       	call   5b0 <mutex_lock>
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    1a5d:	b8 09 00 00 00       	mov    $0x9,%eax
+    1a62:	e8 29 fe ff ff       	call   1890 <bigalloc>
+  if(threaded)
+    1a67:	8b 15 a4 31 00 00    	mov    0x31a4,%edx
+    1a6d:	83 c4 10             	add    $0x10,%esp
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    1a70:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(threaded)
+    1a73:	85 d2                	test   %edx,%edx
+    1a75:	75 29                	jne    1aa0 <mycache+0x90>
+    if(*cp == 0)
+    1a77:	85 c0                	test   %eax,%eax
+    1a79:	74 c6                	je     1a41 <mycache+0x31>
+    memset(*cp, 0, sizeof(**cp));
+    1a7b:	83 ec 04             	sub    $0x4,%esp
+    *cp = (struct tcache*)((Header*)*cp + 1);
+    1a7e:	83 c0 08             	add    $0x8,%eax
+    1a81:	89 43 f8             	mov    %eax,-0x8(%ebx)
+    memset(*cp, 0, sizeof(**cp));
+    1a84:	6a 40                	push   $0x40
+    1a86:	6a 00                	push   $0x0
+    1a88:	50                   	push   %eax
+    1a89:	e8 f2 e9 ff ff       	call   480 <memset>
+  return *cp;
+    1a8e:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    1a91:	83 c4 10             	add    $0x10,%esp
+    1a94:	eb ab                	jmp    1a41 <mycache+0x31>
+    1a96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a9d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1aa0:	83 ec 0c             	sub    $0xc,%esp
+    1aa3:	68 a8 31 00 00       	push   $0x31a8
+    1aa8:	e8 53 eb ff ff       	call   600 <mutex_unlock>
+    if(*cp == 0)
+    1aad:	8b 43 f8             	mov    -0x8(%ebx),%eax
+}
+    1ab0:	83 c4 10             	add    $0x10,%esp
+    1ab3:	eb c2                	jmp    1a77 <mycache+0x67>
+    1ab5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1abc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001ac0 <free>:
+
+void
+free(void *ap)
+{
+    1ac0:	55                   	push   %ebp
+    1ac1:	89 e5                	mov    %esp,%ebp
+    1ac3:	57                   	push   %edi
+    1ac4:	56                   	push   %esi
+    1ac5:	53                   	push   %ebx
+    1ac6:	83 ec 1c             	sub    $0x1c,%esp
+    1ac9:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  struct tcache *tc;
+  int c;
+
+  if(ap == 0)
+    1acc:	85 f6                	test   %esi,%esi
+    1ace:	74 51                	je     1b21 <free+0x61>
+    return;
+  bp = (Header*)ap - 1;
+    1ad0:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1ad3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(bp->s.size > SMALLMAX / sizeof(Header)){
+    1ad6:	8b 46 fc             	mov    -0x4(%esi),%eax
+    1ad9:	3d 00 01 00 00       	cmp    $0x100,%eax
+    1ade:	77 50                	ja     1b30 <free+0x70>
+    acquire();
+    trim(bigfree(bp));
+    release();
+    return;
+  }
+  for(c = 0; (2 << c) < bp->s.size; c++)
+    1ae0:	31 db                	xor    %ebx,%ebx
+    1ae2:	ba 02 00 00 00       	mov    $0x2,%edx
+    1ae7:	83 f8 02             	cmp    $0x2,%eax
+    1aea:	76 11                	jbe    1afd <free+0x3d>
+    1aec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1af0:	83 c3 01             	add    $0x1,%ebx
+    1af3:	89 d7                	mov    %edx,%edi
+    1af5:	89 d9                	mov    %ebx,%ecx
+    1af7:	d3 e7                	shl    %cl,%edi
+    1af9:	39 c7                	cmp    %eax,%edi
+    1afb:	72 f3                	jb     1af0 <free+0x30>
+    ;
+  if((tc = mycache()) == 0){
+    1afd:	e8 0e ff ff ff       	call   1a10 <mycache>
+    1b02:	85 c0                	test   %eax,%eax
+    1b04:	74 7a                	je     1b80 <free+0xc0>
+    bp->s.ptr = small[c];
+    small[c] = bp;
+    release();
+    return;
+  }
+  bp->s.ptr = tc->list[c];
+    1b06:	8d 0c 98             	lea    (%eax,%ebx,4),%ecx
+    1b09:	8b 11                	mov    (%ecx),%edx
+    1b0b:	89 56 f8             	mov    %edx,-0x8(%esi)
+  tc->list[c] = bp;
+    1b0e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1b11:	89 31                	mov    %esi,(%ecx)
+  if(++tc->n[c] > TCACHEMAX)
+    1b13:	8b 71 20             	mov    0x20(%ecx),%esi
+    1b16:	8d 56 01             	lea    0x1(%esi),%edx
+    1b19:	89 51 20             	mov    %edx,0x20(%ecx)
+    1b1c:	83 fa 20             	cmp    $0x20,%edx
+    1b1f:	7f 47                	jg     1b68 <free+0xa8>
+    drain(tc, c, BATCH);
+}
+    1b21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b24:	5b                   	pop    %ebx
+    1b25:	5e                   	pop    %esi
+    1b26:	5f                   	pop    %edi
+    1b27:	5d                   	pop    %ebp
+    1b28:	c3                   	ret
+    1b29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1b30:	8b 1d a4 31 00 00    	mov    0x31a4,%ebx
+    1b36:	85 db                	test   %ebx,%ebx
+    1b38:	75 66                	jne    1ba0 <free+0xe0>
+    trim(bigfree(bp));
+    1b3a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1b3d:	e8 4e fc ff ff       	call   1790 <bigfree>
+    1b42:	e8 c9 fc ff ff       	call   1810 <trim>
+  if(threaded)
+    1b47:	8b 0d a4 31 00 00    	mov    0x31a4,%ecx
+    1b4d:	85 c9                	test   %ecx,%ecx
+    1b4f:	74 d0                	je     1b21 <free+0x61>
+    mutex_unlock(&lock);
+    1b51:	c7 45 08 a8 31 00 00 	movl   $0x31a8,0x8(%ebp)
+}
+    1b58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b5b:	5b                   	pop    %ebx
+    1b5c:	5e                   	pop    %esi
+    1b5d:	5f                   	pop    %edi
+    1b5e:	5d                   	pop    %ebp
+    mutex_unlock(&lock);
+    1b5f:	e9 9c ea ff ff       	jmp    600 <mutex_unlock>
+    1b64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    1b68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    drain(tc, c, BATCH);
+    1b6b:	89 da                	mov    %ebx,%edx
+    1b6d:	b9 10 00 00 00       	mov    $0x10,%ecx
+}
+    1b72:	5b                   	pop    %ebx
+    1b73:	5e                   	pop    %esi
+    1b74:	5f                   	pop    %edi
+    1b75:	5d                   	pop    %ebp
+    drain(tc, c, BATCH);
+    1b76:	e9 05 fe ff ff       	jmp    1980 <drain>
+    1b7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1b7f:	90                   	nop
+  if(threaded)
+    1b80:	8b 15 a4 31 00 00    	mov    0x31a4,%edx
+    1b86:	85 d2                	test   %edx,%edx
+    1b88:	75 28                	jne    1bb2 <free+0xf2>
+    bp->s.ptr = small[c];
+    1b8a:	8b 04 9d 00 32 00 00 	mov    0x3200(,%ebx,4),%eax
+    1b91:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1b94:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1b97:	89 04 9d 00 32 00 00 	mov    %eax,0x3200(,%ebx,4)
+  if(threaded)
+    1b9e:	eb 81                	jmp    1b21 <free+0x61>
+    mutex_lock(&lock);
+    1ba0:	83 ec 0c             	sub    $0xc,%esp
+    1ba3:	68 a8 31 00 00       	push   $0x31a8
+    1ba8:	e8 03 ea ff ff       	call   5b0 <mutex_lock>
+}
+    1bad:	83 c4 10             	add    $0x10,%esp
+    1bb0:	eb 88                	jmp    1b3a <free+0x7a>
+    mutex_lock(&lock);
+    1bb2:	83 ec 0c             	sub    $0xc,%esp
+    1bb5:	68 a8 31 00 00       	push   $0x31a8
+    1bba:	e8 f1 e9 ff ff       	call   5b0 <mutex_lock>
+    bp->s.ptr = small[c];
+    1bbf:	8b 04 9d 00 32 00 00 	mov    0x3200(,%ebx,4),%eax
+  if(threaded)
+    1bc6:	83 c4 10             	add    $0x10,%esp
+    bp->s.ptr = small[c];
+    1bc9:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1bcc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1bcf:	89 04 9d 00 32 00 00 	mov    %eax,0x3200(,%ebx,4)
+  if(threaded)
+    1bd6:	a1 a4 31 00 00       	mov    0x31a4,%eax
+    1bdb:	85 c0                	test   %eax,%eax
+    1bdd:	0f 85 6e ff ff ff    	jne    1b51 <free+0x91>
+    1be3:	e9 39 ff ff ff       	jmp    1b21 <free+0x61>
+    1be8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bef:	90                   	nop
+
+00001bf0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1bf0:	55                   	push   %ebp
+    1bf1:	89 e5                	mov    %esp,%ebp
+    1bf3:	57                   	push   %edi
+    1bf4:	56                   	push   %esi
+    1bf5:	53                   	push   %ebx
+    1bf6:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  struct tcache *tc;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1bf9:	8b 45 08             	mov    0x8(%ebp),%eax
+    1bfc:	8d 78 07             	lea    0x7(%eax),%edi
+    1bff:	c1 ef 03             	shr    $0x3,%edi
+    1c02:	83 c7 01             	add    $0x1,%edi
+  if(nunits > SMALLMAX / sizeof(Header)){
+    1c05:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+    1c0b:	77 5b                	ja     1c68 <malloc+0x78>
+    acquire();
+    p = bigalloc(nunits);
+    release();
+    return p ? (void*)(p + 1) : 0;
+  }
+  for(c = 0; (2 << c) < nunits; c++)
+    1c0d:	31 c9                	xor    %ecx,%ecx
+    1c0f:	b8 02 00 00 00       	mov    $0x2,%eax
+    1c14:	be 02 00 00 00       	mov    $0x2,%esi
+    1c19:	bb 02 00 00 00       	mov    $0x2,%ebx
+    1c1e:	83 ff 02             	cmp    $0x2,%edi
+    1c21:	76 12                	jbe    1c35 <malloc+0x45>
+    1c23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1c27:	90                   	nop
+    1c28:	83 c1 01             	add    $0x1,%ecx
+    1c2b:	89 c3                	mov    %eax,%ebx
+    1c2d:	d3 e3                	shl    %cl,%ebx
+    1c2f:	89 de                	mov    %ebx,%esi
+    1c31:	39 fb                	cmp    %edi,%ebx
+    1c33:	72 f3                	jb     1c28 <malloc+0x38>
+    1c35:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    ;
+  if((tc = mycache()) == 0)
+    1c38:	e8 d3 fd ff ff       	call   1a10 <mycache>
+    1c3d:	85 c0                	test   %eax,%eax
+    1c3f:	74 51                	je     1c92 <malloc+0xa2>
+    return 0;
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1c41:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1c44:	8d 3c 88             	lea    (%eax,%ecx,4),%edi
+    1c47:	8b 07                	mov    (%edi),%eax
+    1c49:	85 c0                	test   %eax,%eax
+    1c4b:	74 53                	je     1ca0 <malloc+0xb0>
+    return 0;
+  p = tc->list[c];
+  tc->list[c] = p->s.ptr;
+  tc->n[c]--;
+    1c4d:	8b 57 20             	mov    0x20(%edi),%edx
+  tc->list[c] = p->s.ptr;
+    1c50:	8b 08                	mov    (%eax),%ecx
+  tc->n[c]--;
+    1c52:	83 ea 01             	sub    $0x1,%edx
+  return (void*)(p + 1);
+    1c55:	83 c0 08             	add    $0x8,%eax
+  tc->n[c]--;
+    1c58:	89 57 20             	mov    %edx,0x20(%edi)
+  tc->list[c] = p->s.ptr;
+    1c5b:	89 0f                	mov    %ecx,(%edi)
+}
+    1c5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c60:	5b                   	pop    %ebx
+    1c61:	5e                   	pop    %esi
+    1c62:	5f                   	pop    %edi
+    1c63:	5d                   	pop    %ebp
+    1c64:	c3                   	ret
+    1c65:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1c68:	a1 a4 31 00 00       	mov    0x31a4,%eax
+    1c6d:	85 c0                	test   %eax,%eax
+    1c6f:	0f 85 b3 00 00 00    	jne    1d28 <malloc+0x138>
+    p = bigalloc(nunits);
+    1c75:	89 f8                	mov    %edi,%eax
+    1c77:	e8 14 fc ff ff       	call   1890 <bigalloc>
+    1c7c:	89 c3                	mov    %eax,%ebx
+  if(threaded)
+    1c7e:	a1 a4 31 00 00       	mov    0x31a4,%eax
+    1c83:	85 c0                	test   %eax,%eax
+    1c85:	0f 85 85 00 00 00    	jne    1d10 <malloc+0x120>
+    return p ? (void*)(p + 1) : 0;
+    1c8b:	8d 43 08             	lea    0x8(%ebx),%eax
+    1c8e:	85 db                	test   %ebx,%ebx
+    1c90:	75 cb                	jne    1c5d <malloc+0x6d>
+    1c92:	31 c0                	xor    %eax,%eax
+}
+    1c94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c97:	5b                   	pop    %ebx
+    1c98:	5e                   	pop    %esi
+    1c99:	5f                   	pop    %edi
+    1c9a:	5d                   	pop    %ebp
+    1c9b:	c3                   	ret
+    1c9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1ca0:	a1 a4 31 00 00       	mov    0x31a4,%eax
+    1ca5:	85 c0                	test   %eax,%eax
+    1ca7:	0f 85 29 01 00 00    	jne    1dd6 <malloc+0x1e6>
+  if(small[c] == 0){
+    1cad:	8b 04 8d 00 32 00 00 	mov    0x3200(,%ecx,4),%eax
+    1cb4:	85 c0                	test   %eax,%eax
+    1cb6:	0f 84 81 00 00 00    	je     1d3d <malloc+0x14d>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1cbc:	31 db                	xor    %ebx,%ebx
+    1cbe:	eb 22                	jmp    1ce2 <malloc+0xf2>
+    small[c] = p->s.ptr;
+    1cc0:	8b 10                	mov    (%eax),%edx
+  for(moved = 0; moved < n && small[c]; moved++){
+    1cc2:	83 c3 01             	add    $0x1,%ebx
+    small[c] = p->s.ptr;
+    1cc5:	89 14 8d 00 32 00 00 	mov    %edx,0x3200(,%ecx,4)
+    p->s.ptr = tc->list[c];
+    1ccc:	8b 17                	mov    (%edi),%edx
+    1cce:	89 10                	mov    %edx,(%eax)
+    tc->list[c] = p;
+    1cd0:	89 07                	mov    %eax,(%edi)
+  for(moved = 0; moved < n && small[c]; moved++){
+    1cd2:	83 fb 10             	cmp    $0x10,%ebx
+    1cd5:	0f 84 e2 00 00 00    	je     1dbd <malloc+0x1cd>
+    1cdb:	8b 04 8d 00 32 00 00 	mov    0x3200(,%ecx,4),%eax
+    1ce2:	85 c0                	test   %eax,%eax
+    1ce4:	75 da                	jne    1cc0 <malloc+0xd0>
+  if(threaded)
+    1ce6:	8b 15 a4 31 00 00    	mov    0x31a4,%edx
+    1cec:	85 d2                	test   %edx,%edx
+    1cee:	0f 85 b4 00 00 00    	jne    1da8 <malloc+0x1b8>
+  tc->n[c] += moved;
+    1cf4:	8b 57 20             	mov    0x20(%edi),%edx
+    1cf7:	01 da                	add    %ebx,%edx
+    1cf9:	89 57 20             	mov    %edx,0x20(%edi)
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1cfc:	85 db                	test   %ebx,%ebx
+    1cfe:	74 92                	je     1c92 <malloc+0xa2>
+  p = tc->list[c];
+    1d00:	8b 07                	mov    (%edi),%eax
+    1d02:	e9 49 ff ff ff       	jmp    1c50 <malloc+0x60>
+    1d07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d0e:	66 90                	xchg   %ax,%ax
+    mutex_unlock(&lock);
+    1d10:	83 ec 0c             	sub    $0xc,%esp
+    1d13:	68 a8 31 00 00       	push   $0x31a8
+    1d18:	e8 e3 e8 ff ff       	call   600 <mutex_unlock>
+}
+    1d1d:	83 c4 10             	add    $0x10,%esp
+    1d20:	e9 66 ff ff ff       	jmp    1c8b <malloc+0x9b>
+    1d25:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1d28:	83 ec 0c             	sub    $0xc,%esp
+    1d2b:	68 a8 31 00 00       	push   $0x31a8
+    1d30:	e8 7b e8 ff ff       	call   5b0 <mutex_lock>
+}
+    1d35:	83 c4 10             	add    $0x10,%esp
+    1d38:	e9 38 ff ff ff       	jmp    1c75 <malloc+0x85>
+    if((chunk = bigalloc(CHUNK / sizeof(Header) + 1)) == 0){
+    1d3d:	b8 01 02 00 00       	mov    $0x201,%eax
+    1d42:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1d45:	e8 46 fb ff ff       	call   1890 <bigalloc>
+    1d4a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1d4d:	85 c0                	test   %eax,%eax
+    1d4f:	89 c2                	mov    %eax,%edx
+    1d51:	0f 84 ba 00 00 00    	je     1e11 <malloc+0x221>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1d57:	83 c2 08             	add    $0x8,%edx
+    1d5a:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+    1d60:	0f 87 d0 00 00 00    	ja     1e36 <malloc+0x246>
+    1d66:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+    1d6d:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    1d70:	89 df                	mov    %ebx,%edi
+    1d72:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1d75:	8d 76 00             	lea    0x0(%esi),%esi
+      p->s.size = units;
+    1d78:	89 72 04             	mov    %esi,0x4(%edx)
+      p->s.ptr = small[c];
+    1d7b:	8b 04 8d 00 32 00 00 	mov    0x3200(,%ecx,4),%eax
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1d82:	01 df                	add    %ebx,%edi
+    1d84:	89 55 e0             	mov    %edx,-0x20(%ebp)
+      p->s.ptr = small[c];
+    1d87:	89 02                	mov    %eax,(%edx)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1d89:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      small[c] = p;
+    1d8c:	89 14 8d 00 32 00 00 	mov    %edx,0x3200(,%ecx,4)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1d93:	01 c2                	add    %eax,%edx
+    1d95:	81 ff 00 02 00 00    	cmp    $0x200,%edi
+    1d9b:	76 db                	jbe    1d78 <malloc+0x188>
+    1d9d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1da0:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1da3:	e9 14 ff ff ff       	jmp    1cbc <malloc+0xcc>
+    mutex_unlock(&lock);
+    1da8:	83 ec 0c             	sub    $0xc,%esp
+    1dab:	68 a8 31 00 00       	push   $0x31a8
+    1db0:	e8 4b e8 ff ff       	call   600 <mutex_unlock>
+}
+    1db5:	83 c4 10             	add    $0x10,%esp
+    1db8:	e9 37 ff ff ff       	jmp    1cf4 <malloc+0x104>
+  if(threaded)
+    1dbd:	a1 a4 31 00 00       	mov    0x31a4,%eax
+    1dc2:	85 c0                	test   %eax,%eax
+    1dc4:	75 2b                	jne    1df1 <malloc+0x201>
+  tc->n[c] += moved;
+    1dc6:	8b 47 20             	mov    0x20(%edi),%eax
+    1dc9:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1dcc:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1dce:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1dd1:	e9 7a fe ff ff       	jmp    1c50 <malloc+0x60>
+    mutex_lock(&lock);
+    1dd6:	83 ec 0c             	sub    $0xc,%esp
+    1dd9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1ddc:	68 a8 31 00 00       	push   $0x31a8
+    1de1:	e8 ca e7 ff ff       	call   5b0 <mutex_lock>
+}
+    1de6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1de9:	83 c4 10             	add    $0x10,%esp
+    1dec:	e9 bc fe ff ff       	jmp    1cad <malloc+0xbd>
+    mutex_unlock(&lock);
+    1df1:	83 ec 0c             	sub    $0xc,%esp
+    1df4:	68 a8 31 00 00       	push   $0x31a8
+    1df9:	e8 02 e8 ff ff       	call   600 <mutex_unlock>
+  tc->n[c] += moved;
+    1dfe:	8b 47 20             	mov    0x20(%edi),%eax
+    1e01:	83 c4 10             	add    $0x10,%esp
+    1e04:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1e07:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1e09:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1e0c:	e9 3f fe ff ff       	jmp    1c50 <malloc+0x60>
+  if(threaded)
+    1e11:	8b 0d a4 31 00 00    	mov    0x31a4,%ecx
+    1e17:	85 c9                	test   %ecx,%ecx
+    1e19:	0f 84 73 fe ff ff    	je     1c92 <malloc+0xa2>
+    mutex_unlock(&lock);
+    1e1f:	83 ec 0c             	sub    $0xc,%esp
+    1e22:	68 a8 31 00 00       	push   $0x31a8
+    1e27:	e8 d4 e7 ff ff       	call   600 <mutex_unlock>
+    1e2c:	83 c4 10             	add    $0x10,%esp
+    return p ? (void*)(p + 1) : 0;
+    1e2f:	31 c0                	xor    %eax,%eax
+    1e31:	e9 5e fe ff ff       	jmp    1c94 <malloc+0xa4>
+  for(moved = 0; moved < n && small[c]; moved++){
+    1e36:	8b 04 8d 00 32 00 00 	mov    0x3200(,%ecx,4),%eax
+    1e3d:	e9 7a fe ff ff       	jmp    1cbc <malloc+0xcc>
+    1e42:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001e50 <malloc_threaded>:
+void
+malloc_threaded(void)
+{
+  uint sp;
+
+  if(threaded)
+    1e50:	a1 a4 31 00 00       	mov    0x31a4,%eax
+    1e55:	85 c0                	test   %eax,%eax
+    1e57:	74 07                	je     1e60 <malloc_threaded+0x10>
+    1e59:	c3                   	ret
+    1e5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+{
+    1e60:	55                   	push   %ebp
+    1e61:	89 e5                	mov    %esp,%ebp
+    1e63:	83 ec 24             	sub    $0x24,%esp
+    return;
+  mutex_init(&lock);
+    1e66:	68 a8 31 00 00       	push   $0x31a8
+    1e6b:	e8 30 e7 ff ff       	call   5a0 <mutex_init>
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1e70:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1e73:	83 c4 10             	add    $0x10,%esp
+  threaded = 1;
+    1e76:	c7 05 a4 31 00 00 01 	movl   $0x1,0x31a4
+    1e7d:	00 00 00 
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1e80:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    1e85:	a3 a0 31 00 00       	mov    %eax,0x31a0
+}
+    1e8a:	c9                   	leave
+    1e8b:	c3                   	ret
+    1e8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001e90 <malloc_thread_exit>:
+
+// Called by thread_join() with the cache slot of a finished
+// thread: give its blocks, and the cache itself, back.
+void
+malloc_thread_exit(void **cachep)
+{
+    1e90:	55                   	push   %ebp
+    1e91:	89 e5                	mov    %esp,%ebp
+    1e93:	57                   	push   %edi
+    1e94:	56                   	push   %esi
+    1e95:	53                   	push   %ebx
+    1e96:	83 ec 0c             	sub    $0xc,%esp
+    1e99:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct tcache *tc;
+  int c;
+
+  if((tc = *cachep) == 0)
+    1e9c:	8b 37                	mov    (%edi),%esi
+    1e9e:	85 f6                	test   %esi,%esi
+    1ea0:	74 41                	je     1ee3 <malloc_thread_exit+0x53>
+    return;
+  for(c = 0; c < NCLASS; c++)
+    1ea2:	31 db                	xor    %ebx,%ebx
+    1ea4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    drain(tc, c, tc->n[c]);
+    1ea8:	8b 4c 9e 20          	mov    0x20(%esi,%ebx,4),%ecx
+    1eac:	89 da                	mov    %ebx,%edx
+    1eae:	89 f0                	mov    %esi,%eax
+  for(c = 0; c < NCLASS; c++)
+    1eb0:	83 c3 01             	add    $0x1,%ebx
+    drain(tc, c, tc->n[c]);
+    1eb3:	e8 c8 fa ff ff       	call   1980 <drain>
+  for(c = 0; c < NCLASS; c++)
+    1eb8:	83 fb 08             	cmp    $0x8,%ebx
+    1ebb:	75 eb                	jne    1ea8 <malloc_thread_exit+0x18>
+  if(threaded)
+    1ebd:	8b 15 a4 31 00 00    	mov    0x31a4,%edx
+    1ec3:	85 d2                	test   %edx,%edx
+    1ec5:	75 29                	jne    1ef0 <malloc_thread_exit+0x60>
+  acquire();
+  trim(bigfree((Header*)tc - 1));
+    1ec7:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1eca:	e8 c1 f8 ff ff       	call   1790 <bigfree>
+    1ecf:	e8 3c f9 ff ff       	call   1810 <trim>
+  if(threaded)
+    1ed4:	a1 a4 31 00 00       	mov    0x31a4,%eax
+    1ed9:	85 c0                	test   %eax,%eax
+    1edb:	75 2b                	jne    1f08 <malloc_thread_exit+0x78>
+  release();
+  *cachep = 0;
+    1edd:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+}
+    1ee3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ee6:	5b                   	pop    %ebx
+    1ee7:	5e                   	pop    %esi
+    1ee8:	5f                   	pop    %edi
+    1ee9:	5d                   	pop    %ebp
+    1eea:	c3                   	ret
+    1eeb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1eef:	90                   	nop
+    mutex_lock(&lock);
+    1ef0:	83 ec 0c             	sub    $0xc,%esp
+    1ef3:	68 a8 31 00 00       	push   $0x31a8
+    1ef8:	e8 b3 e6 ff ff       	call   5b0 <mutex_lock>
+}
+    1efd:	83 c4 10             	add    $0x10,%esp
+    1f00:	eb c5                	jmp    1ec7 <malloc_thread_exit+0x37>
+    1f02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1f08:	83 ec 0c             	sub    $0xc,%esp
+    1f0b:	68 a8 31 00 00       	push   $0x31a8
+    1f10:	e8 eb e6 ff ff       	call   600 <mutex_unlock>
+}
+    1f15:	83 c4 10             	add    $0x10,%esp
+    1f18:	eb c3                	jmp    1edd <malloc_thread_exit+0x4d>
+    1f1a:	66 90                	xchg   %ax,%ax
+    1f1c:	66 90                	xchg   %ax,%ax
+    1f1e:	66 90                	xchg   %ax,%ax
+
+00001f20 <thread_create>:
+
+// Start fn(arg) in a new thread on a freshly allocated
+// page-aligned stack.  Returns the thread's pid.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1f20:	55                   	push   %ebp
+    1f21:	89 e5                	mov    %esp,%ebp
+    1f23:	53                   	push   %ebx
+    1f24:	83 ec 14             	sub    $0x14,%esp
+  char *mem, *stack;
+  int pid;
+
+  malloc_threaded();
+    1f27:	e8 24 ff ff ff       	call   1e50 <malloc_threaded>
+  stdio_threaded();
+    1f2c:	e8 cf ee ff ff       	call   e00 <stdio_threaded>
+  if((mem = malloc(2*PGSIZE)) == 0)
+    1f31:	83 ec 0c             	sub    $0xc,%esp
+    1f34:	68 00 20 00 00       	push   $0x2000
+    1f39:	e8 b2 fc ff ff       	call   1bf0 <malloc>
+    1f3e:	83 c4 10             	add    $0x10,%esp
+    1f41:	85 c0                	test   %eax,%eax
+    1f43:	74 52                	je     1f97 <thread_create+0x77>
+    1f45:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1f47:	8d 80 07 10 00 00    	lea    0x1007(%eax),%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+  ((char**)stack)[-2] = 0;
+  if((pid = clone(fn, arg, stack)) < 0)
+    1f4d:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1f50:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+    1f55:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  ((char**)stack)[-2] = 0;
+    1f58:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+  if((pid = clone(fn, arg, stack)) < 0)
+    1f5f:	50                   	push   %eax
+    1f60:	ff 75 0c             	push   0xc(%ebp)
+    1f63:	ff 75 08             	push   0x8(%ebp)
+    1f66:	e8 97 e8 ff ff       	call   802 <clone>
+    1f6b:	83 c4 10             	add    $0x10,%esp
+    1f6e:	85 c0                	test   %eax,%eax
+    1f70:	78 0e                	js     1f80 <thread_create+0x60>
+    free(mem);
+  return pid;
+}
+    1f72:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1f75:	c9                   	leave
+    1f76:	c3                   	ret
+    1f77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f7e:	66 90                	xchg   %ax,%ax
+    free(mem);
+    1f80:	83 ec 0c             	sub    $0xc,%esp
+    1f83:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1f86:	53                   	push   %ebx
+    1f87:	e8 34 fb ff ff       	call   1ac0 <free>
+    1f8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1f8f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    1f92:	83 c4 10             	add    $0x10,%esp
+}
+    1f95:	c9                   	leave
+    1f96:	c3                   	ret
+    return -1;
+    1f97:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1f9c:	eb d4                	jmp    1f72 <thread_create+0x52>
+    1f9e:	66 90                	xchg   %ax,%ax
+
+00001fa0 <thread_join>:
+
+// Wait for a thread to finish and free its stack.
+int
+thread_join(void)
+{
+    1fa0:	55                   	push   %ebp
+    1fa1:	89 e5                	mov    %esp,%ebp
+    1fa3:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    1fa4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    1fa7:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    1faa:	50                   	push   %eax
+    1fab:	e8 61 e8 ff ff       	call   811 <join>
+    1fb0:	83 c4 10             	add    $0x10,%esp
+    1fb3:	85 c0                	test   %eax,%eax
+    1fb5:	78 29                	js     1fe0 <thread_join+0x40>
+    1fb7:	89 c3                	mov    %eax,%ebx
+    return -1;
+  malloc_thread_exit(&((void**)stack)[-2]);
+    1fb9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1fbc:	83 ec 0c             	sub    $0xc,%esp
+    1fbf:	83 e8 08             	sub    $0x8,%eax
+    1fc2:	50                   	push   %eax
+    1fc3:	e8 c8 fe ff ff       	call   1e90 <malloc_thread_exit>
+  free(((char**)stack)[-1]);
+    1fc8:	58                   	pop    %eax
+    1fc9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1fcc:	ff 70 fc             	push   -0x4(%eax)
+    1fcf:	e8 ec fa ff ff       	call   1ac0 <free>
+  return pid;
+    1fd4:	83 c4 10             	add    $0x10,%esp
+}
+    1fd7:	89 d8                	mov    %ebx,%eax
+    1fd9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1fdc:	c9                   	leave
+    1fdd:	c3                   	ret
+    1fde:	66 90                	xchg   %ax,%ax
+    return -1;
+    1fe0:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    1fe5:	eb f0                	jmp    1fd7 <thread_join+0x37>
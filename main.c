@@ -20,6 +20,7 @@ int
 main(void) {
     kinit1(end, P2V(4 * 1024 * 1024)); // phys page allocator
     kvmalloc();      // kernel page table
+    pgeinit();       // keep kernel mappings in the TLB
     mpinit();        // detect other processors
     lapicinit();     // interrupt controller
     seginit();       // segment descriptors
@@ -29,13 +30,20 @@ main(void) {
     //控制台输出
     consoleinit();   // console hardware
     uartinit();      // serial port
+    stringtest();    // check memmove() and memcmp() if STRINGTEST
     pinit();         // process table
     //中断向量初始化
     tvinit();        // trap vectors
+    timerinit();     // sleep timer wheels
     //缓存块初始化
     binit();         // buffer cache
     //文件初始化
     fileinit();      // file table
+    pipeinit();      // pipe cache
+    mmapinit();      // mmap() regions
+    vdsoinit();      // pages shared with user programs
+    fpuinit();       // FPU state switching
+    profinit();      // sampling profiler
     //磁盘初始化
     ideinit();       // disk
     startothers();   // start other processors
@@ -48,6 +56,7 @@ main(void) {
 static void
 mpenter(void) {
     switchkvm();
+    pgeinit();
     seginit();
     lapicinit();
     mpmain();
@@ -59,6 +68,8 @@ mpmain(void) {
     cprintf("cpu%d: starting %d\n", cpuid(), cpuid());
     //中断和陷入相关的
     idtinit();       // load idt register
+    sysenterinit();  // fast system call entry
+    fpuenable();     // trap on first FPU use
     xchg(&(mycpu()->started), 1); // tell startothers() we're up
     scheduler();     // start running processes
 }
@@ -0,0 +1,116 @@
+// malloc() microbenchmarks.
+// Each test reports the ticks it took:
+//   pairs    malloc() and free() of one small block, repeatedly
+//   mixed    replace random blocks of NLIVE live ones of random size
+//   big      malloc() and free() of blocks of 8KB to 64KB
+//   threads  pairs in several threads at once
+// and finally how far the heap shrank once everything was freed.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define N      200000
+#define NLIVE  1000
+#define NBIG   2000
+
+int nthread = 4;
+char *live[NLIVE];
+uint seed = 1;
+
+uint
+rand(void)
+{
+  seed = seed * 1103515245 + 12345;
+  return seed >> 8;
+}
+
+void
+pairs(void *arg)
+{
+  int i;
+
+  for(i = 0; i < N; i++)
+    free(malloc(32));
+}
+
+void
+mixed(void)
+{
+  int i, k;
+
+  for(i = 0; i < N; i++){
+    k = rand() % NLIVE;
+    free(live[k]);
+    live[k] = malloc(8 + rand() % 512);
+  }
+  for(k = 0; k < NLIVE; k++){
+    free(live[k]);
+    live[k] = 0;
+  }
+}
+
+void
+big(void)
+{
+  int i;
+
+  for(i = 0; i < NBIG; i++)
+    free(malloc(8192 + rand() % (56*1024)));
+}
+
+void
+worker(void *arg)
+{
+  pairs(arg);
+  exit();
+}
+
+void
+threads(void)
+{
+  int i;
+
+  for(i = 0; i < nthread; i++)
+    if(thread_create(worker, 0) < 0){
+      printf(1, "mallocbench: thread_create failed\n");
+      exit();
+    }
+  for(i = 0; i < nthread; i++)
+    thread_join();
+}
+
+void
+run(char *name, void (*fn)(void))
+{
+  int t;
+
+  t = uptime();
+  fn();
+  printf(1, "%s: %d ticks\n", name, uptime() - t);
+}
+
+void
+dopairs(void)
+{
+  pairs(0);
+}
+
+int
+main(int argc, char *argv[])
+{
+  char *brk0, *p;
+
+  if(argc > 1)
+    nthread = atoi(argv[1]);
+  brk0 = sbrk(0);
+  run("pairs", dopairs);
+  run("mixed", mixed);
+  run("big", big);
+  run("threads", threads);
+  p = malloc(256*1024);
+  printf(1, "heap: %d bytes grown, ", sbrk(0) - brk0);
+  free(p);
+  printf(1, "%d after free\n", sbrk(0) - brk0);
+  exit();
+}
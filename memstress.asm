@@ -0,0 +1,4148 @@
+
+_memstress:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	be 20 00 00 00       	mov    $0x20,%esi
+      14:	53                   	push   %ebx
+  int mb, nproc, i, t0;
+
+  mb = argc > 1 ? atoi(argv[1]) : 32;
+  nproc = argc > 2 ? atoi(argv[2]) : 4;
+      15:	bb 04 00 00 00       	mov    $0x4,%ebx
+{
+      1a:	51                   	push   %ecx
+      1b:	83 ec 18             	sub    $0x18,%esp
+      1e:	8b 39                	mov    (%ecx),%edi
+      20:	8b 51 04             	mov    0x4(%ecx),%edx
+  mb = argc > 1 ? atoi(argv[1]) : 32;
+      23:	83 ff 01             	cmp    $0x1,%edi
+      26:	7f 41                	jg     69 <main+0x69>
+  if(mb < 1 || nproc < 1){
+    printf(2, "usage: memstress [MB [nproc]]\n");
+    exit();
+  }
+
+  printf(1, "memstress: %d MB in %d processes\n", mb, nproc);
+      28:	53                   	push   %ebx
+  t0 = uptime();
+  for(i = 0; i < nproc; i++){
+      29:	31 ff                	xor    %edi,%edi
+  printf(1, "memstress: %d MB in %d processes\n", mb, nproc);
+      2b:	56                   	push   %esi
+      2c:	68 e4 1e 00 00       	push   $0x1ee4
+      31:	6a 01                	push   $0x1
+      33:	e8 b8 09 00 00       	call   9f0 <printf>
+  t0 = uptime();
+      38:	e8 23 05 00 00       	call   560 <uptime>
+      3d:	83 c4 10             	add    $0x10,%esp
+      40:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < nproc; i++){
+      43:	eb 0a                	jmp    4f <main+0x4f>
+      45:	8d 76 00             	lea    0x0(%esi),%esi
+      48:	83 c7 01             	add    $0x1,%edi
+      4b:	39 df                	cmp    %ebx,%edi
+      4d:	74 60                	je     af <main+0xaf>
+    if(fork() == 0)
+      4f:	e8 7c 01 00 00       	call   1d0 <fork>
+      54:	85 c0                	test   %eax,%eax
+      56:	75 f0                	jne    48 <main+0x48>
+      child(i, mb * (1024*1024 / PGSIZE) / nproc);
+      58:	89 f0                	mov    %esi,%eax
+      5a:	51                   	push   %ecx
+      5b:	c1 e0 08             	shl    $0x8,%eax
+      5e:	51                   	push   %ecx
+      5f:	99                   	cltd
+      60:	f7 fb                	idiv   %ebx
+      62:	50                   	push   %eax
+      63:	57                   	push   %edi
+      64:	e8 87 00 00 00       	call   f0 <child>
+  mb = argc > 1 ? atoi(argv[1]) : 32;
+      69:	83 ec 0c             	sub    $0xc,%esp
+      6c:	ff 72 04             	push   0x4(%edx)
+      6f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+      72:	e8 49 03 00 00       	call   3c0 <atoi>
+  nproc = argc > 2 ? atoi(argv[2]) : 4;
+      77:	83 c4 10             	add    $0x10,%esp
+  mb = argc > 1 ? atoi(argv[1]) : 32;
+      7a:	89 c6                	mov    %eax,%esi
+  nproc = argc > 2 ? atoi(argv[2]) : 4;
+      7c:	83 ff 02             	cmp    $0x2,%edi
+      7f:	74 13                	je     94 <main+0x94>
+      81:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+      84:	83 ec 0c             	sub    $0xc,%esp
+      87:	ff 72 08             	push   0x8(%edx)
+      8a:	e8 31 03 00 00       	call   3c0 <atoi>
+      8f:	83 c4 10             	add    $0x10,%esp
+      92:	89 c3                	mov    %eax,%ebx
+  if(mb < 1 || nproc < 1){
+      94:	85 f6                	test   %esi,%esi
+      96:	7e 04                	jle    9c <main+0x9c>
+      98:	85 db                	test   %ebx,%ebx
+      9a:	7f 8c                	jg     28 <main+0x28>
+    printf(2, "usage: memstress [MB [nproc]]\n");
+      9c:	53                   	push   %ebx
+      9d:	53                   	push   %ebx
+      9e:	68 c4 1e 00 00       	push   $0x1ec4
+      a3:	6a 02                	push   $0x2
+      a5:	e8 46 09 00 00       	call   9f0 <printf>
+    exit();
+      aa:	e8 81 01 00 00       	call   230 <exit>
+  }
+  for(i = 0; i < nproc; i++)
+      af:	31 f6                	xor    %esi,%esi
+      b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    wait();
+      b8:	e8 c7 04 00 00       	call   584 <wait>
+  for(i = 0; i < nproc; i++)
+      bd:	83 c6 01             	add    $0x1,%esi
+      c0:	39 de                	cmp    %ebx,%esi
+      c2:	75 f4                	jne    b8 <main+0xb8>
+  printf(1, "memstress: done in %d ticks\n", uptime() - t0);
+      c4:	e8 97 04 00 00       	call   560 <uptime>
+      c9:	52                   	push   %edx
+      ca:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+      cd:	29 d0                	sub    %edx,%eax
+      cf:	50                   	push   %eax
+      d0:	68 1e 1f 00 00       	push   $0x1f1e
+      d5:	6a 01                	push   $0x1
+      d7:	e8 14 09 00 00       	call   9f0 <printf>
+  exit();
+      dc:	e8 4f 01 00 00       	call   230 <exit>
+      e1:	66 90                	xchg   %ax,%ax
+      e3:	66 90                	xchg   %ax,%ax
+      e5:	66 90                	xchg   %ax,%ax
+      e7:	66 90                	xchg   %ax,%ax
+      e9:	66 90                	xchg   %ax,%ax
+      eb:	66 90                	xchg   %ax,%ax
+      ed:	66 90                	xchg   %ax,%ax
+      ef:	90                   	nop
+
+000000f0 <child>:
+{
+      f0:	55                   	push   %ebp
+      f1:	89 e5                	mov    %esp,%ebp
+      f3:	57                   	push   %edi
+      f4:	56                   	push   %esi
+      f5:	53                   	push   %ebx
+      f6:	83 ec 28             	sub    $0x28,%esp
+      f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if((base = sbrk(npages * PGSIZE)) == (char*)-1){
+      fc:	89 d8                	mov    %ebx,%eax
+      fe:	c1 e0 0c             	shl    $0xc,%eax
+     101:	50                   	push   %eax
+     102:	e8 6d 05 00 00       	call   674 <sbrk>
+     107:	83 c4 10             	add    $0x10,%esp
+     10a:	83 f8 ff             	cmp    $0xffffffff,%eax
+     10d:	0f 84 8e 00 00 00    	je     1a1 <child+0xb1>
+     113:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < npages; i++)
+     115:	85 db                	test   %ebx,%ebx
+     117:	7e 1e                	jle    137 <child+0x47>
+    *(int*)(base + i*PGSIZE) = id * 1000003 + i;
+     119:	69 45 08 43 42 0f 00 	imul   $0xf4243,0x8(%ebp),%eax
+     120:	89 fa                	mov    %edi,%edx
+     122:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+     125:	8d 76 00             	lea    0x0(%esi),%esi
+     128:	89 02                	mov    %eax,(%edx)
+  for(i = 0; i < npages; i++)
+     12a:	83 c0 01             	add    $0x1,%eax
+     12d:	81 c2 00 10 00 00    	add    $0x1000,%edx
+     133:	39 c8                	cmp    %ecx,%eax
+     135:	75 f1                	jne    128 <child+0x38>
+      if(*(int*)(base + i*PGSIZE) != id * 1000003 + i){
+     137:	69 75 08 43 42 0f 00 	imul   $0xf4243,0x8(%ebp),%esi
+    for(i = 0; i < npages; i++){
+     13e:	85 db                	test   %ebx,%ebx
+     140:	7e 74                	jle    1b6 <child+0xc6>
+     142:	b9 04 00 00 00       	mov    $0x4,%ecx
+     147:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+     14a:	31 c0                	xor    %eax,%eax
+     14c:	eb 09                	jmp    157 <child+0x67>
+     14e:	66 90                	xchg   %ax,%ax
+     150:	83 c0 01             	add    $0x1,%eax
+     153:	39 c3                	cmp    %eax,%ebx
+     155:	74 22                	je     179 <child+0x89>
+      if(*(int*)(base + i*PGSIZE) != id * 1000003 + i){
+     157:	89 c1                	mov    %eax,%ecx
+     159:	8d 14 06             	lea    (%esi,%eax,1),%edx
+     15c:	c1 e1 0c             	shl    $0xc,%ecx
+     15f:	39 14 0f             	cmp    %edx,(%edi,%ecx,1)
+     162:	74 ec                	je     150 <child+0x60>
+        printf(1, "memstress: child %d: page %d corrupted\n", id, i);
+     164:	50                   	push   %eax
+     165:	ff 75 08             	push   0x8(%ebp)
+     168:	68 9c 1e 00 00       	push   $0x1e9c
+     16d:	6a 01                	push   $0x1
+     16f:	e8 7c 08 00 00       	call   9f0 <printf>
+        exit();
+     174:	e8 b7 00 00 00       	call   230 <exit>
+    sleep(1);
+     179:	83 ec 0c             	sub    $0xc,%esp
+     17c:	6a 01                	push   $0x1
+     17e:	e8 00 05 00 00       	call   683 <sleep>
+  for(r = 0; r < ROUNDS; r++){
+     183:	83 c4 10             	add    $0x10,%esp
+     186:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+     18a:	75 be                	jne    14a <child+0x5a>
+  printf(1, "memstress: child %d ok\n", id);
+     18c:	50                   	push   %eax
+     18d:	ff 75 08             	push   0x8(%ebp)
+     190:	68 06 1f 00 00       	push   $0x1f06
+     195:	6a 01                	push   $0x1
+     197:	e8 54 08 00 00       	call   9f0 <printf>
+  exit();
+     19c:	e8 8f 00 00 00       	call   230 <exit>
+    printf(1, "memstress: child %d: sbrk failed\n", id);
+     1a1:	52                   	push   %edx
+     1a2:	ff 75 08             	push   0x8(%ebp)
+     1a5:	68 78 1e 00 00       	push   $0x1e78
+     1aa:	6a 01                	push   $0x1
+     1ac:	e8 3f 08 00 00       	call   9f0 <printf>
+    exit();
+     1b1:	e8 7a 00 00 00       	call   230 <exit>
+    for(i = 0; i < npages; i++){
+     1b6:	bb 04 00 00 00       	mov    $0x4,%ebx
+    sleep(1);
+     1bb:	83 ec 0c             	sub    $0xc,%esp
+     1be:	6a 01                	push   $0x1
+     1c0:	e8 be 04 00 00       	call   683 <sleep>
+  for(r = 0; r < ROUNDS; r++){
+     1c5:	83 c4 10             	add    $0x10,%esp
+     1c8:	83 eb 01             	sub    $0x1,%ebx
+     1cb:	75 ee                	jne    1bb <child+0xcb>
+     1cd:	eb bd                	jmp    18c <child+0x9c>
+     1cf:	90                   	nop
+
+000001d0 <fork>:
+int sysexit(void) __attribute__((noreturn));
+
+int
+fork(void)
+{
+  if(flushhook)
+     1d0:	a1 20 2a 00 00       	mov    0x2a20,%eax
+     1d5:	85 c0                	test   %eax,%eax
+     1d7:	74 17                	je     1f0 <fork+0x20>
+{
+     1d9:	55                   	push   %ebp
+     1da:	89 e5                	mov    %esp,%ebp
+     1dc:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     1df:	ff d0                	call   *%eax
+  return sysfork();
+}
+     1e1:	c9                   	leave
+  return sysfork();
+     1e2:	e9 7f 03 00 00       	jmp    566 <sysfork>
+     1e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ee:	66 90                	xchg   %ax,%ax
+     1f0:	e9 71 03 00 00       	jmp    566 <sysfork>
+     1f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+     200:	55                   	push   %ebp
+  if(flushhook)
+     201:	a1 20 2a 00 00       	mov    0x2a20,%eax
+{
+     206:	89 e5                	mov    %esp,%ebp
+     208:	56                   	push   %esi
+     209:	53                   	push   %ebx
+     20a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     20d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     210:	85 c0                	test   %eax,%eax
+     212:	74 02                	je     216 <exec+0x16>
+    flushhook();
+     214:	ff d0                	call   *%eax
+  return sysexec(path, argv);
+     216:	89 75 0c             	mov    %esi,0xc(%ebp)
+     219:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     21c:	5b                   	pop    %ebx
+     21d:	5e                   	pop    %esi
+     21e:	5d                   	pop    %ebp
+  return sysexec(path, argv);
+     21f:	e9 ba 03 00 00       	jmp    5de <sysexec>
+     224:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     22b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     22f:	90                   	nop
+
+00000230 <exit>:
+
+int
+exit(void)
+{
+     230:	55                   	push   %ebp
+     231:	89 e5                	mov    %esp,%ebp
+     233:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     236:	a1 20 2a 00 00       	mov    0x2a20,%eax
+     23b:	85 c0                	test   %eax,%eax
+     23d:	74 02                	je     241 <exit+0x11>
+    flushhook();
+     23f:	ff d0                	call   *%eax
+  sysexit();
+     241:	e8 2f 03 00 00       	call   575 <sysexit>
+     246:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     24d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000250 <strcpy>:
+}
+
+char*
+strcpy(char *s, const char *t)
+{
+     250:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     251:	31 c0                	xor    %eax,%eax
+{
+     253:	89 e5                	mov    %esp,%ebp
+     255:	53                   	push   %ebx
+     256:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     259:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     25c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     260:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     264:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     267:	83 c0 01             	add    $0x1,%eax
+     26a:	84 d2                	test   %dl,%dl
+     26c:	75 f2                	jne    260 <strcpy+0x10>
+    ;
+  return os;
+}
+     26e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     271:	89 c8                	mov    %ecx,%eax
+     273:	c9                   	leave
+     274:	c3                   	ret
+     275:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     280:	55                   	push   %ebp
+     281:	89 e5                	mov    %esp,%ebp
+     283:	53                   	push   %ebx
+     284:	8b 55 08             	mov    0x8(%ebp),%edx
+     287:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     28a:	0f b6 02             	movzbl (%edx),%eax
+     28d:	84 c0                	test   %al,%al
+     28f:	75 17                	jne    2a8 <strcmp+0x28>
+     291:	eb 3a                	jmp    2cd <strcmp+0x4d>
+     293:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     297:	90                   	nop
+     298:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     29c:	83 c2 01             	add    $0x1,%edx
+     29f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     2a2:	84 c0                	test   %al,%al
+     2a4:	74 1a                	je     2c0 <strcmp+0x40>
+    p++, q++;
+     2a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     2a8:	0f b6 19             	movzbl (%ecx),%ebx
+     2ab:	38 c3                	cmp    %al,%bl
+     2ad:	74 e9                	je     298 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     2af:	29 d8                	sub    %ebx,%eax
+}
+     2b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2b4:	c9                   	leave
+     2b5:	c3                   	ret
+     2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     2c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     2c4:	31 c0                	xor    %eax,%eax
+     2c6:	29 d8                	sub    %ebx,%eax
+}
+     2c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2cb:	c9                   	leave
+     2cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     2cd:	0f b6 19             	movzbl (%ecx),%ebx
+     2d0:	31 c0                	xor    %eax,%eax
+     2d2:	eb db                	jmp    2af <strcmp+0x2f>
+     2d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2df:	90                   	nop
+
+000002e0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     2e0:	55                   	push   %ebp
+     2e1:	89 e5                	mov    %esp,%ebp
+     2e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     2e6:	80 3a 00             	cmpb   $0x0,(%edx)
+     2e9:	74 15                	je     300 <strlen+0x20>
+     2eb:	31 c0                	xor    %eax,%eax
+     2ed:	8d 76 00             	lea    0x0(%esi),%esi
+     2f0:	83 c0 01             	add    $0x1,%eax
+     2f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     2f7:	89 c1                	mov    %eax,%ecx
+     2f9:	75 f5                	jne    2f0 <strlen+0x10>
+    ;
+  return n;
+}
+     2fb:	89 c8                	mov    %ecx,%eax
+     2fd:	5d                   	pop    %ebp
+     2fe:	c3                   	ret
+     2ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+     300:	31 c9                	xor    %ecx,%ecx
+}
+     302:	5d                   	pop    %ebp
+     303:	89 c8                	mov    %ecx,%eax
+     305:	c3                   	ret
+     306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     30d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000310 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     310:	55                   	push   %ebp
+     311:	89 e5                	mov    %esp,%ebp
+     313:	57                   	push   %edi
+     314:	8b 55 08             	mov    0x8(%ebp),%edx
+            "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt) {
+    asm volatile("cld; rep stosb" :
+     317:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     31a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     31d:	89 d7                	mov    %edx,%edi
+     31f:	fc                   	cld
+     320:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     322:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     325:	89 d0                	mov    %edx,%eax
+     327:	c9                   	leave
+     328:	c3                   	ret
+     329:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     330:	55                   	push   %ebp
+     331:	89 e5                	mov    %esp,%ebp
+     333:	8b 45 08             	mov    0x8(%ebp),%eax
+     336:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     33a:	0f b6 10             	movzbl (%eax),%edx
+     33d:	84 d2                	test   %dl,%dl
+     33f:	75 12                	jne    353 <strchr+0x23>
+     341:	eb 1d                	jmp    360 <strchr+0x30>
+     343:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     347:	90                   	nop
+     348:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     34c:	83 c0 01             	add    $0x1,%eax
+     34f:	84 d2                	test   %dl,%dl
+     351:	74 0d                	je     360 <strchr+0x30>
+    if(*s == c)
+     353:	38 d1                	cmp    %dl,%cl
+     355:	75 f1                	jne    348 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     357:	5d                   	pop    %ebp
+     358:	c3                   	ret
+     359:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     360:	31 c0                	xor    %eax,%eax
+}
+     362:	5d                   	pop    %ebp
+     363:	c3                   	ret
+     364:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     36b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     36f:	90                   	nop
+
+00000370 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     370:	55                   	push   %ebp
+     371:	89 e5                	mov    %esp,%ebp
+     373:	56                   	push   %esi
+     374:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     375:	83 ec 08             	sub    $0x8,%esp
+     378:	6a 00                	push   $0x0
+     37a:	ff 75 08             	push   0x8(%ebp)
+     37d:	e8 6b 02 00 00       	call   5ed <open>
+  if(fd < 0)
+     382:	83 c4 10             	add    $0x10,%esp
+     385:	85 c0                	test   %eax,%eax
+     387:	78 27                	js     3b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     389:	83 ec 08             	sub    $0x8,%esp
+     38c:	ff 75 0c             	push   0xc(%ebp)
+     38f:	89 c3                	mov    %eax,%ebx
+     391:	50                   	push   %eax
+     392:	e8 83 02 00 00       	call   61a <fstat>
+  close(fd);
+     397:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     39a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     39c:	e8 1f 02 00 00       	call   5c0 <close>
+  return r;
+     3a1:	83 c4 10             	add    $0x10,%esp
+}
+     3a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     3a7:	89 f0                	mov    %esi,%eax
+     3a9:	5b                   	pop    %ebx
+     3aa:	5e                   	pop    %esi
+     3ab:	5d                   	pop    %ebp
+     3ac:	c3                   	ret
+     3ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     3b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     3b5:	eb ed                	jmp    3a4 <stat+0x34>
+     3b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3be:	66 90                	xchg   %ax,%ax
+
+000003c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     3c0:	55                   	push   %ebp
+     3c1:	89 e5                	mov    %esp,%ebp
+     3c3:	53                   	push   %ebx
+     3c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     3c7:	0f be 02             	movsbl (%edx),%eax
+     3ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     3cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     3d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     3d5:	77 1e                	ja     3f5 <atoi+0x35>
+     3d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     3e0:	83 c2 01             	add    $0x1,%edx
+     3e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     3e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     3ea:	0f be 02             	movsbl (%edx),%eax
+     3ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     3f0:	80 fb 09             	cmp    $0x9,%bl
+     3f3:	76 eb                	jbe    3e0 <atoi+0x20>
+  return n;
+}
+     3f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3f8:	89 c8                	mov    %ecx,%eax
+     3fa:	c9                   	leave
+     3fb:	c3                   	ret
+     3fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000400 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     400:	55                   	push   %ebp
+     401:	89 e5                	mov    %esp,%ebp
+     403:	57                   	push   %edi
+     404:	56                   	push   %esi
+     405:	8b 45 10             	mov    0x10(%ebp),%eax
+     408:	8b 55 08             	mov    0x8(%ebp),%edx
+     40b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     40e:	85 c0                	test   %eax,%eax
+     410:	7e 13                	jle    425 <memmove+0x25>
+     412:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     414:	89 d7                	mov    %edx,%edi
+     416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     41d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     420:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     421:	39 f8                	cmp    %edi,%eax
+     423:	75 fb                	jne    420 <memmove+0x20>
+  return vdst;
+}
+     425:	5e                   	pop    %esi
+     426:	89 d0                	mov    %edx,%eax
+     428:	5f                   	pop    %edi
+     429:	5d                   	pop    %ebp
+     42a:	c3                   	ret
+     42b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     42f:	90                   	nop
+
+00000430 <mutex_init>:
+
+// Futex-based mutex (Drepper, "Futexes Are Tricky", mutex 2).
+// The uncontended paths never enter the kernel.
+void
+mutex_init(struct mutex *m)
+{
+     430:	55                   	push   %ebp
+     431:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+     433:	8b 45 08             	mov    0x8(%ebp),%eax
+     436:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     43c:	5d                   	pop    %ebp
+     43d:	c3                   	ret
+     43e:	66 90                	xchg   %ax,%ax
+
+00000440 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     440:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     441:	31 c0                	xor    %eax,%eax
+     443:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+     448:	89 e5                	mov    %esp,%ebp
+     44a:	56                   	push   %esi
+     44b:	53                   	push   %ebx
+     44c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     44f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     453:	85 c0                	test   %eax,%eax
+     455:	74 32                	je     489 <mutex_lock+0x49>
+    return;
+  if(c != 2)
+     457:	83 f8 02             	cmp    $0x2,%eax
+     45a:	74 0c                	je     468 <mutex_lock+0x28>
+static inline uint
+xchg(volatile uint *addr, uint newval) {
+    uint result;
+
+    // The + in "+m" denotes a read-modify-write operand.
+    asm volatile("lock; xchgl %0, %1" :
+     45c:	b8 02 00 00 00       	mov    $0x2,%eax
+     461:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+     464:	85 c0                	test   %eax,%eax
+     466:	74 21                	je     489 <mutex_lock+0x49>
+     468:	be 02 00 00 00       	mov    $0x2,%esi
+     46d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAIT, 2);
+     470:	83 ec 04             	sub    $0x4,%esp
+     473:	6a 02                	push   $0x2
+     475:	6a 00                	push   $0x0
+     477:	53                   	push   %ebx
+     478:	e8 33 02 00 00       	call   6b0 <futex>
+     47d:	89 f0                	mov    %esi,%eax
+     47f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     482:	83 c4 10             	add    $0x10,%esp
+     485:	85 c0                	test   %eax,%eax
+     487:	75 e7                	jne    470 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+     489:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     48c:	5b                   	pop    %ebx
+     48d:	5e                   	pop    %esi
+     48e:	5d                   	pop    %ebp
+     48f:	c3                   	ret
+
+00000490 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     490:	55                   	push   %ebp
+     491:	89 e5                	mov    %esp,%ebp
+     493:	83 ec 08             	sub    $0x8,%esp
+     496:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     499:	f0 83 28 01          	lock subl $0x1,(%eax)
+     49d:	75 09                	jne    4a8 <mutex_unlock+0x18>
+    m->val = 0;
+    futex(&m->val, FUTEX_WAKE, 1);
+  }
+}
+     49f:	c9                   	leave
+     4a0:	c3                   	ret
+     4a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     4a8:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     4ab:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex(&m->val, FUTEX_WAKE, 1);
+     4b1:	6a 01                	push   $0x1
+     4b3:	6a 01                	push   $0x1
+     4b5:	50                   	push   %eax
+     4b6:	e8 f5 01 00 00       	call   6b0 <futex>
+     4bb:	83 c4 10             	add    $0x10,%esp
+}
+     4be:	c9                   	leave
+     4bf:	c3                   	ret
+
+000004c0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     4c0:	55                   	push   %ebp
+     4c1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     4c3:	8b 45 08             	mov    0x8(%ebp),%eax
+     4c6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     4cc:	5d                   	pop    %ebp
+     4cd:	c3                   	ret
+     4ce:	66 90                	xchg   %ax,%ax
+
+000004d0 <cond_wait>:
+
+// Release m and wait for a signal, then reacquire m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     4d0:	55                   	push   %ebp
+     4d1:	89 e5                	mov    %esp,%ebp
+     4d3:	57                   	push   %edi
+     4d4:	56                   	push   %esi
+     4d5:	53                   	push   %ebx
+     4d6:	83 ec 0c             	sub    $0xc,%esp
+     4d9:	8b 75 08             	mov    0x8(%ebp),%esi
+     4dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     4df:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     4e1:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+     4e5:	75 21                	jne    508 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     4e7:	83 ec 04             	sub    $0x4,%esp
+     4ea:	57                   	push   %edi
+     4eb:	6a 00                	push   $0x0
+     4ed:	56                   	push   %esi
+     4ee:	e8 bd 01 00 00       	call   6b0 <futex>
+  mutex_lock(m);
+     4f3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     4f6:	83 c4 10             	add    $0x10,%esp
+}
+     4f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4fc:	5b                   	pop    %ebx
+     4fd:	5e                   	pop    %esi
+     4fe:	5f                   	pop    %edi
+     4ff:	5d                   	pop    %ebp
+  mutex_lock(m);
+     500:	e9 3b ff ff ff       	jmp    440 <mutex_lock>
+     505:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     508:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     50b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex(&m->val, FUTEX_WAKE, 1);
+     511:	6a 01                	push   $0x1
+     513:	6a 01                	push   $0x1
+     515:	53                   	push   %ebx
+     516:	e8 95 01 00 00       	call   6b0 <futex>
+     51b:	83 c4 10             	add    $0x10,%esp
+     51e:	eb c7                	jmp    4e7 <cond_wait+0x17>
+
+00000520 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+     520:	55                   	push   %ebp
+     521:	89 e5                	mov    %esp,%ebp
+     523:	83 ec 0c             	sub    $0xc,%esp
+     526:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     529:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+     52d:	6a 01                	push   $0x1
+     52f:	6a 01                	push   $0x1
+     531:	50                   	push   %eax
+     532:	e8 79 01 00 00       	call   6b0 <futex>
+}
+     537:	83 c4 10             	add    $0x10,%esp
+     53a:	c9                   	leave
+     53b:	c3                   	ret
+     53c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000540 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     540:	55                   	push   %ebp
+     541:	89 e5                	mov    %esp,%ebp
+     543:	83 ec 0c             	sub    $0xc,%esp
+     546:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     549:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+     54d:	6a 40                	push   $0x40
+     54f:	6a 01                	push   $0x1
+     551:	50                   	push   %eax
+     552:	e8 59 01 00 00       	call   6b0 <futex>
+}
+     557:	83 c4 10             	add    $0x10,%esp
+     55a:	c9                   	leave
+     55b:	c3                   	ret
+     55c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000560 <uptime>:
+// Clock ticks since boot, read from the kernel's vdso page
+// without a system call.
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     560:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+     565:	c3                   	ret
+
+00000566 <sysfork>:
+  1: ret
+
+#define SYSCALL(name) SYSCALLAS(name, name)
+
+// ulib.c wraps these.
+SYSCALLAS(sysfork, fork)
+     566:	b8 01 00 00 00       	mov    $0x1,%eax
+     56b:	89 e1                	mov    %esp,%ecx
+     56d:	ba 74 05 00 00       	mov    $0x574,%edx
+     572:	0f 34                	sysenter
+     574:	c3                   	ret
+
+00000575 <sysexit>:
+SYSCALLAS(sysexit, exit)
+     575:	b8 02 00 00 00       	mov    $0x2,%eax
+     57a:	89 e1                	mov    %esp,%ecx
+     57c:	ba 83 05 00 00       	mov    $0x583,%edx
+     581:	0f 34                	sysenter
+     583:	c3                   	ret
+
+00000584 <wait>:
+SYSCALL(wait)
+     584:	b8 03 00 00 00       	mov    $0x3,%eax
+     589:	89 e1                	mov    %esp,%ecx
+     58b:	ba 92 05 00 00       	mov    $0x592,%edx
+     590:	0f 34                	sysenter
+     592:	c3                   	ret
+
+00000593 <pipe>:
+SYSCALL(pipe)
+     593:	b8 04 00 00 00       	mov    $0x4,%eax
+     598:	89 e1                	mov    %esp,%ecx
+     59a:	ba a1 05 00 00       	mov    $0x5a1,%edx
+     59f:	0f 34                	sysenter
+     5a1:	c3                   	ret
+
+000005a2 <read>:
+SYSCALL(read)
+     5a2:	b8 05 00 00 00       	mov    $0x5,%eax
+     5a7:	89 e1                	mov    %esp,%ecx
+     5a9:	ba b0 05 00 00       	mov    $0x5b0,%edx
+     5ae:	0f 34                	sysenter
+     5b0:	c3                   	ret
+
+000005b1 <write>:
+SYSCALL(write)
+     5b1:	b8 10 00 00 00       	mov    $0x10,%eax
+     5b6:	89 e1                	mov    %esp,%ecx
+     5b8:	ba bf 05 00 00       	mov    $0x5bf,%edx
+     5bd:	0f 34                	sysenter
+     5bf:	c3                   	ret
+
+000005c0 <close>:
+SYSCALL(close)
+     5c0:	b8 15 00 00 00       	mov    $0x15,%eax
+     5c5:	89 e1                	mov    %esp,%ecx
+     5c7:	ba ce 05 00 00       	mov    $0x5ce,%edx
+     5cc:	0f 34                	sysenter
+     5ce:	c3                   	ret
+
+000005cf <kill>:
+SYSCALL(kill)
+     5cf:	b8 06 00 00 00       	mov    $0x6,%eax
+     5d4:	89 e1                	mov    %esp,%ecx
+     5d6:	ba dd 05 00 00       	mov    $0x5dd,%edx
+     5db:	0f 34                	sysenter
+     5dd:	c3                   	ret
+
+000005de <sysexec>:
+SYSCALLAS(sysexec, exec)
+     5de:	b8 07 00 00 00       	mov    $0x7,%eax
+     5e3:	89 e1                	mov    %esp,%ecx
+     5e5:	ba ec 05 00 00       	mov    $0x5ec,%edx
+     5ea:	0f 34                	sysenter
+     5ec:	c3                   	ret
+
+000005ed <open>:
+SYSCALL(open)
+     5ed:	b8 0f 00 00 00       	mov    $0xf,%eax
+     5f2:	89 e1                	mov    %esp,%ecx
+     5f4:	ba fb 05 00 00       	mov    $0x5fb,%edx
+     5f9:	0f 34                	sysenter
+     5fb:	c3                   	ret
+
+000005fc <mknod>:
+SYSCALL(mknod)
+     5fc:	b8 11 00 00 00       	mov    $0x11,%eax
+     601:	89 e1                	mov    %esp,%ecx
+     603:	ba 0a 06 00 00       	mov    $0x60a,%edx
+     608:	0f 34                	sysenter
+     60a:	c3                   	ret
+
+0000060b <unlink>:
+SYSCALL(unlink)
+     60b:	b8 12 00 00 00       	mov    $0x12,%eax
+     610:	89 e1                	mov    %esp,%ecx
+     612:	ba 19 06 00 00       	mov    $0x619,%edx
+     617:	0f 34                	sysenter
+     619:	c3                   	ret
+
+0000061a <fstat>:
+SYSCALL(fstat)
+     61a:	b8 08 00 00 00       	mov    $0x8,%eax
+     61f:	89 e1                	mov    %esp,%ecx
+     621:	ba 28 06 00 00       	mov    $0x628,%edx
+     626:	0f 34                	sysenter
+     628:	c3                   	ret
+
+00000629 <link>:
+SYSCALL(link)
+     629:	b8 13 00 00 00       	mov    $0x13,%eax
+     62e:	89 e1                	mov    %esp,%ecx
+     630:	ba 37 06 00 00       	mov    $0x637,%edx
+     635:	0f 34                	sysenter
+     637:	c3                   	ret
+
+00000638 <mkdir>:
+SYSCALL(mkdir)
+     638:	b8 14 00 00 00       	mov    $0x14,%eax
+     63d:	89 e1                	mov    %esp,%ecx
+     63f:	ba 46 06 00 00       	mov    $0x646,%edx
+     644:	0f 34                	sysenter
+     646:	c3                   	ret
+
+00000647 <chdir>:
+SYSCALL(chdir)
+     647:	b8 09 00 00 00       	mov    $0x9,%eax
+     64c:	89 e1                	mov    %esp,%ecx
+     64e:	ba 55 06 00 00       	mov    $0x655,%edx
+     653:	0f 34                	sysenter
+     655:	c3                   	ret
+
+00000656 <dup>:
+SYSCALL(dup)
+     656:	b8 0a 00 00 00       	mov    $0xa,%eax
+     65b:	89 e1                	mov    %esp,%ecx
+     65d:	ba 64 06 00 00       	mov    $0x664,%edx
+     662:	0f 34                	sysenter
+     664:	c3                   	ret
+
+00000665 <getpid>:
+SYSCALL(getpid)
+     665:	b8 0b 00 00 00       	mov    $0xb,%eax
+     66a:	89 e1                	mov    %esp,%ecx
+     66c:	ba 73 06 00 00       	mov    $0x673,%edx
+     671:	0f 34                	sysenter
+     673:	c3                   	ret
+
+00000674 <sbrk>:
+SYSCALL(sbrk)
+     674:	b8 0c 00 00 00       	mov    $0xc,%eax
+     679:	89 e1                	mov    %esp,%ecx
+     67b:	ba 82 06 00 00       	mov    $0x682,%edx
+     680:	0f 34                	sysenter
+     682:	c3                   	ret
+
+00000683 <sleep>:
+SYSCALL(sleep)
+     683:	b8 0d 00 00 00       	mov    $0xd,%eax
+     688:	89 e1                	mov    %esp,%ecx
+     68a:	ba 91 06 00 00       	mov    $0x691,%edx
+     68f:	0f 34                	sysenter
+     691:	c3                   	ret
+
+00000692 <clone>:
+SYSCALL(clone)
+     692:	b8 16 00 00 00       	mov    $0x16,%eax
+     697:	89 e1                	mov    %esp,%ecx
+     699:	ba a0 06 00 00       	mov    $0x6a0,%edx
+     69e:	0f 34                	sysenter
+     6a0:	c3                   	ret
+
+000006a1 <join>:
+SYSCALL(join)
+     6a1:	b8 17 00 00 00       	mov    $0x17,%eax
+     6a6:	89 e1                	mov    %esp,%ecx
+     6a8:	ba af 06 00 00       	mov    $0x6af,%edx
+     6ad:	0f 34                	sysenter
+     6af:	c3                   	ret
+
+000006b0 <futex>:
+SYSCALL(futex)
+     6b0:	b8 18 00 00 00       	mov    $0x18,%eax
+     6b5:	89 e1                	mov    %esp,%ecx
+     6b7:	ba be 06 00 00       	mov    $0x6be,%edx
+     6bc:	0f 34                	sysenter
+     6be:	c3                   	ret
+
+000006bf <yield>:
+SYSCALL(yield)
+     6bf:	b8 19 00 00 00       	mov    $0x19,%eax
+     6c4:	89 e1                	mov    %esp,%ecx
+     6c6:	ba cd 06 00 00       	mov    $0x6cd,%edx
+     6cb:	0f 34                	sysenter
+     6cd:	c3                   	ret
+
+000006ce <lockstat>:
+SYSCALL(lockstat)
+     6ce:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     6d3:	89 e1                	mov    %esp,%ecx
+     6d5:	ba dc 06 00 00       	mov    $0x6dc,%edx
+     6da:	0f 34                	sysenter
+     6dc:	c3                   	ret
+
+000006dd <lockhammer>:
+SYSCALL(lockhammer)
+     6dd:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     6e2:	89 e1                	mov    %esp,%ecx
+     6e4:	ba eb 06 00 00       	mov    $0x6eb,%edx
+     6e9:	0f 34                	sysenter
+     6eb:	c3                   	ret
+
+000006ec <vmsplice>:
+SYSCALL(vmsplice)
+     6ec:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     6f1:	89 e1                	mov    %esp,%ecx
+     6f3:	ba fa 06 00 00       	mov    $0x6fa,%edx
+     6f8:	0f 34                	sysenter
+     6fa:	c3                   	ret
+
+000006fb <hsbrk>:
+SYSCALL(hsbrk)
+     6fb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     700:	89 e1                	mov    %esp,%ecx
+     702:	ba 09 07 00 00       	mov    $0x709,%edx
+     707:	0f 34                	sysenter
+     709:	c3                   	ret
+
+0000070a <mmap>:
+SYSCALL(mmap)
+     70a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     70f:	89 e1                	mov    %esp,%ecx
+     711:	ba 18 07 00 00       	mov    $0x718,%edx
+     716:	0f 34                	sysenter
+     718:	c3                   	ret
+
+00000719 <munmap>:
+SYSCALL(munmap)
+     719:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     71e:	89 e1                	mov    %esp,%ecx
+     720:	ba 27 07 00 00       	mov    $0x727,%edx
+     725:	0f 34                	sysenter
+     727:	c3                   	ret
+
+00000728 <ringenter>:
+SYSCALL(ringenter)
+     728:	b8 20 00 00 00       	mov    $0x20,%eax
+     72d:	89 e1                	mov    %esp,%ecx
+     72f:	ba 36 07 00 00       	mov    $0x736,%edx
+     734:	0f 34                	sysenter
+     736:	c3                   	ret
+
+00000737 <readv>:
+SYSCALL(readv)
+     737:	b8 21 00 00 00       	mov    $0x21,%eax
+     73c:	89 e1                	mov    %esp,%ecx
+     73e:	ba 45 07 00 00       	mov    $0x745,%edx
+     743:	0f 34                	sysenter
+     745:	c3                   	ret
+
+00000746 <writev>:
+SYSCALL(writev)
+     746:	b8 22 00 00 00       	mov    $0x22,%eax
+     74b:	89 e1                	mov    %esp,%ecx
+     74d:	ba 54 07 00 00       	mov    $0x754,%edx
+     752:	0f 34                	sysenter
+     754:	c3                   	ret
+
+00000755 <pread>:
+SYSCALL(pread)
+     755:	b8 23 00 00 00       	mov    $0x23,%eax
+     75a:	89 e1                	mov    %esp,%ecx
+     75c:	ba 63 07 00 00       	mov    $0x763,%edx
+     761:	0f 34                	sysenter
+     763:	c3                   	ret
+
+00000764 <pwrite>:
+SYSCALL(pwrite)
+     764:	b8 24 00 00 00       	mov    $0x24,%eax
+     769:	89 e1                	mov    %esp,%ecx
+     76b:	ba 72 07 00 00       	mov    $0x772,%edx
+     770:	0f 34                	sysenter
+     772:	c3                   	ret
+
+00000773 <prof>:
+SYSCALL(prof)
+     773:	b8 25 00 00 00       	mov    $0x25,%eax
+     778:	89 e1                	mov    %esp,%ecx
+     77a:	ba 81 07 00 00       	mov    $0x781,%edx
+     77f:	0f 34                	sysenter
+     781:	c3                   	ret
+
+00000782 <scstat>:
+SYSCALL(scstat)
+     782:	b8 26 00 00 00       	mov    $0x26,%eax
+     787:	89 e1                	mov    %esp,%ecx
+     789:	ba 90 07 00 00       	mov    $0x790,%edx
+     78e:	0f 34                	sysenter
+     790:	c3                   	ret
+     791:	66 90                	xchg   %ax,%ax
+     793:	66 90                	xchg   %ax,%ax
+     795:	66 90                	xchg   %ax,%ax
+     797:	66 90                	xchg   %ax,%ax
+     799:	66 90                	xchg   %ax,%ax
+     79b:	66 90                	xchg   %ax,%ax
+     79d:	66 90                	xchg   %ax,%ax
+     79f:	90                   	nop
+
+000007a0 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+     7a0:	55                   	push   %ebp
+     7a1:	89 e5                	mov    %esp,%ebp
+     7a3:	57                   	push   %edi
+     7a4:	56                   	push   %esi
+     7a5:	53                   	push   %ebx
+     7a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     7a8:	89 d1                	mov    %edx,%ecx
+{
+     7aa:	83 ec 2c             	sub    $0x2c,%esp
+     7ad:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+     7b0:	85 d2                	test   %edx,%edx
+     7b2:	79 7c                	jns    830 <printint+0x90>
+     7b4:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     7b8:	74 76                	je     830 <printint+0x90>
+    x = -xx;
+     7ba:	f7 d9                	neg    %ecx
+    neg = 1;
+     7bc:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     7c1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     7c4:	31 f6                	xor    %esi,%esi
+     7c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7cd:	8d 76 00             	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     7d0:	89 c8                	mov    %ecx,%eax
+     7d2:	31 d2                	xor    %edx,%edx
+     7d4:	89 f7                	mov    %esi,%edi
+     7d6:	f7 f3                	div    %ebx
+     7d8:	8d 76 01             	lea    0x1(%esi),%esi
+     7db:	0f b6 92 9c 1f 00 00 	movzbl 0x1f9c(%edx),%edx
+     7e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     7e6:	89 ca                	mov    %ecx,%edx
+     7e8:	89 c1                	mov    %eax,%ecx
+     7ea:	39 da                	cmp    %ebx,%edx
+     7ec:	73 e2                	jae    7d0 <printint+0x30>
+  if(neg)
+     7ee:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     7f1:	85 c0                	test   %eax,%eax
+     7f3:	74 07                	je     7fc <printint+0x5c>
+    buf[i++] = '-';
+     7f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     7fa:	89 f7                	mov    %esi,%edi
+     7fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     7ff:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     802:	01 df                	add    %ebx,%edi
+     804:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc_unlocked(buf[i], f);
+     808:	83 ec 08             	sub    $0x8,%esp
+     80b:	56                   	push   %esi
+     80c:	0f be 07             	movsbl (%edi),%eax
+     80f:	50                   	push   %eax
+     810:	e8 cb 07 00 00       	call   fe0 <putc_unlocked>
+  while(--i >= 0)
+     815:	89 f8                	mov    %edi,%eax
+     817:	83 c4 10             	add    $0x10,%esp
+     81a:	83 ef 01             	sub    $0x1,%edi
+     81d:	39 d8                	cmp    %ebx,%eax
+     81f:	75 e7                	jne    808 <printint+0x68>
+}
+     821:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     824:	5b                   	pop    %ebx
+     825:	5e                   	pop    %esi
+     826:	5f                   	pop    %edi
+     827:	5d                   	pop    %ebp
+     828:	c3                   	ret
+     829:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     830:	31 c0                	xor    %eax,%eax
+     832:	eb 8d                	jmp    7c1 <printint+0x21>
+     834:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     83b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     83f:	90                   	nop
+
+00000840 <vfprintf>:
+
+// Print to the given stream, which the caller has locked.
+// Only understands %d, %x, %p, %s.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+     840:	55                   	push   %ebp
+     841:	89 e5                	mov    %esp,%ebp
+     843:	57                   	push   %edi
+     844:	56                   	push   %esi
+     845:	53                   	push   %ebx
+     846:	83 ec 1c             	sub    $0x1c,%esp
+     849:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     84c:	0f b6 0a             	movzbl (%edx),%ecx
+     84f:	84 c9                	test   %cl,%cl
+     851:	74 5c                	je     8af <vfprintf+0x6f>
+     853:	89 c6                	mov    %eax,%esi
+     855:	8d 5a 01             	lea    0x1(%edx),%ebx
+     858:	31 ff                	xor    %edi,%edi
+     85a:	eb 20                	jmp    87c <vfprintf+0x3c>
+     85c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     860:	83 f9 25             	cmp    $0x25,%ecx
+     863:	74 3b                	je     8a0 <vfprintf+0x60>
+        state = '%';
+      } else {
+        putc_unlocked(c, f);
+     865:	83 ec 08             	sub    $0x8,%esp
+     868:	56                   	push   %esi
+     869:	51                   	push   %ecx
+     86a:	e8 71 07 00 00       	call   fe0 <putc_unlocked>
+     86f:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     872:	0f b6 0b             	movzbl (%ebx),%ecx
+     875:	83 c3 01             	add    $0x1,%ebx
+     878:	84 c9                	test   %cl,%cl
+     87a:	74 33                	je     8af <vfprintf+0x6f>
+    if(state == 0){
+     87c:	85 ff                	test   %edi,%edi
+     87e:	74 e0                	je     860 <vfprintf+0x20>
+      }
+    } else if(state == '%'){
+     880:	83 ff 25             	cmp    $0x25,%edi
+     883:	75 ed                	jne    872 <vfprintf+0x32>
+      if(c == 'd'){
+     885:	83 f9 25             	cmp    $0x25,%ecx
+     888:	0f 84 02 01 00 00    	je     990 <vfprintf+0x150>
+     88e:	8d 41 9d             	lea    -0x63(%ecx),%eax
+     891:	83 f8 15             	cmp    $0x15,%eax
+     894:	77 2a                	ja     8c0 <vfprintf+0x80>
+     896:	ff 24 85 44 1f 00 00 	jmp    *0x1f44(,%eax,4)
+     89d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     8a0:	0f b6 0b             	movzbl (%ebx),%ecx
+     8a3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     8a6:	bf 25 00 00 00       	mov    $0x25,%edi
+  for(i = 0; fmt[i]; i++){
+     8ab:	84 c9                	test   %cl,%cl
+     8ad:	75 cd                	jne    87c <vfprintf+0x3c>
+        putc_unlocked(c, f);
+      }
+      state = 0;
+    }
+  }
+}
+     8af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8b2:	5b                   	pop    %ebx
+     8b3:	5e                   	pop    %esi
+     8b4:	5f                   	pop    %edi
+     8b5:	5d                   	pop    %ebp
+     8b6:	c3                   	ret
+     8b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8be:	66 90                	xchg   %ax,%ax
+        putc_unlocked('%', f);
+     8c0:	83 ec 08             	sub    $0x8,%esp
+     8c3:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     8c6:	56                   	push   %esi
+     8c7:	6a 25                	push   $0x25
+     8c9:	e8 12 07 00 00       	call   fe0 <putc_unlocked>
+        putc_unlocked(c, f);
+     8ce:	58                   	pop    %eax
+     8cf:	5a                   	pop    %edx
+     8d0:	56                   	push   %esi
+     8d1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     8d4:	51                   	push   %ecx
+     8d5:	e8 06 07 00 00       	call   fe0 <putc_unlocked>
+     8da:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     8dd:	31 ff                	xor    %edi,%edi
+     8df:	eb 91                	jmp    872 <vfprintf+0x32>
+     8e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+     8e8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     8eb:	83 ec 0c             	sub    $0xc,%esp
+     8ee:	b9 10 00 00 00       	mov    $0x10,%ecx
+     8f3:	8b 17                	mov    (%edi),%edx
+     8f5:	6a 00                	push   $0x0
+        ap++;
+     8f7:	83 c7 04             	add    $0x4,%edi
+        printint(f, *ap, 16, 0);
+     8fa:	89 f0                	mov    %esi,%eax
+     8fc:	e8 9f fe ff ff       	call   7a0 <printint>
+        ap++;
+     901:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     904:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     907:	31 ff                	xor    %edi,%edi
+     909:	e9 64 ff ff ff       	jmp    872 <vfprintf+0x32>
+     90e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     910:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     913:	8b 10                	mov    (%eax),%edx
+        ap++;
+     915:	83 c0 04             	add    $0x4,%eax
+     918:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     91b:	85 d2                	test   %edx,%edx
+     91d:	0f 84 85 00 00 00    	je     9a8 <vfprintf+0x168>
+        while(*s != 0){
+     923:	0f be 02             	movsbl (%edx),%eax
+        s = (char*)*ap;
+     926:	89 d7                	mov    %edx,%edi
+        while(*s != 0){
+     928:	84 c0                	test   %al,%al
+     92a:	74 b1                	je     8dd <vfprintf+0x9d>
+     92c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+          putc_unlocked(*s, f);
+     930:	83 ec 08             	sub    $0x8,%esp
+          s++;
+     933:	83 c7 01             	add    $0x1,%edi
+          putc_unlocked(*s, f);
+     936:	56                   	push   %esi
+     937:	50                   	push   %eax
+     938:	e8 a3 06 00 00       	call   fe0 <putc_unlocked>
+        while(*s != 0){
+     93d:	0f be 07             	movsbl (%edi),%eax
+     940:	83 c4 10             	add    $0x10,%esp
+     943:	84 c0                	test   %al,%al
+     945:	75 e9                	jne    930 <vfprintf+0xf0>
+      state = 0;
+     947:	31 ff                	xor    %edi,%edi
+     949:	e9 24 ff ff ff       	jmp    872 <vfprintf+0x32>
+     94e:	66 90                	xchg   %ax,%ax
+        printint(f, *ap, 10, 1);
+     950:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     953:	83 ec 0c             	sub    $0xc,%esp
+     956:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     95b:	8b 17                	mov    (%edi),%edx
+     95d:	6a 01                	push   $0x1
+     95f:	eb 96                	jmp    8f7 <vfprintf+0xb7>
+     961:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc_unlocked(*ap, f);
+     968:	83 ec 08             	sub    $0x8,%esp
+     96b:	56                   	push   %esi
+     96c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     96f:	ff 37                	push   (%edi)
+     971:	e8 6a 06 00 00       	call   fe0 <putc_unlocked>
+        ap++;
+     976:	89 f8                	mov    %edi,%eax
+     978:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     97b:	31 ff                	xor    %edi,%edi
+        ap++;
+     97d:	83 c0 04             	add    $0x4,%eax
+     980:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     983:	e9 ea fe ff ff       	jmp    872 <vfprintf+0x32>
+     988:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     98f:	90                   	nop
+        putc_unlocked(c, f);
+     990:	83 ec 08             	sub    $0x8,%esp
+      state = 0;
+     993:	31 ff                	xor    %edi,%edi
+        putc_unlocked(c, f);
+     995:	56                   	push   %esi
+     996:	6a 25                	push   $0x25
+     998:	e8 43 06 00 00       	call   fe0 <putc_unlocked>
+     99d:	83 c4 10             	add    $0x10,%esp
+     9a0:	e9 cd fe ff ff       	jmp    872 <vfprintf+0x32>
+     9a5:	8d 76 00             	lea    0x0(%esi),%esi
+     9a8:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     9ad:	bf 3b 1f 00 00       	mov    $0x1f3b,%edi
+     9b2:	e9 79 ff ff ff       	jmp    930 <vfprintf+0xf0>
+     9b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9be:	66 90                	xchg   %ax,%ax
+
+000009c0 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+     9c0:	55                   	push   %ebp
+     9c1:	89 e5                	mov    %esp,%ebp
+     9c3:	53                   	push   %ebx
+     9c4:	83 ec 10             	sub    $0x10,%esp
+     9c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  flockfile(f);
+     9ca:	53                   	push   %ebx
+     9cb:	e8 d0 02 00 00       	call   ca0 <flockfile>
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     9d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+     9d3:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     9d6:	89 d8                	mov    %ebx,%eax
+     9d8:	e8 63 fe ff ff       	call   840 <vfprintf>
+  funlockfile(f);
+     9dd:	89 1c 24             	mov    %ebx,(%esp)
+     9e0:	e8 eb 02 00 00       	call   cd0 <funlockfile>
+}
+     9e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9e8:	83 c4 10             	add    $0x10,%esp
+     9eb:	c9                   	leave
+     9ec:	c3                   	ret
+     9ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009f0 <printf>:
+
+// Print to the given fd: through stdout or stderr for 1 and 2,
+// otherwise with one write() per call.
+void
+printf(int fd, const char *fmt, ...)
+{
+     9f0:	55                   	push   %ebp
+     9f1:	89 e5                	mov    %esp,%ebp
+     9f3:	56                   	push   %esi
+     9f4:	53                   	push   %ebx
+     9f5:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+     9fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  char buf[128];
+  struct iobuf f;
+
+  if(fd == 1 || fd == 2){
+    flockfile(&_iob[fd]);
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     9fe:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(fd == 1 || fd == 2){
+     a01:	8d 50 ff             	lea    -0x1(%eax),%edx
+     a04:	83 fa 01             	cmp    $0x1,%edx
+     a07:	76 77                	jbe    a80 <printf+0x90>
+    funlockfile(&_iob[fd]);
+    return;
+  }
+  f.fd = fd;
+     a09:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  f.flags = IO_WRITE|IO_SETUP;
+  f.buf = buf;
+     a0f:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  f.size = sizeof(buf);
+  f.r = f.n = 0;
+  mutex_init(&f.lock);
+     a15:	83 ec 0c             	sub    $0xc,%esp
+     a18:	8d 9d 5c ff ff ff    	lea    -0xa4(%ebp),%ebx
+  f.buf = buf;
+     a1e:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+  mutex_init(&f.lock);
+     a24:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  f.flags = IO_WRITE|IO_SETUP;
+     a2a:	c7 85 60 ff ff ff 42 	movl   $0x42,-0xa0(%ebp)
+     a31:	00 00 00 
+  f.size = sizeof(buf);
+     a34:	c7 85 68 ff ff ff 80 	movl   $0x80,-0x98(%ebp)
+     a3b:	00 00 00 
+  f.r = f.n = 0;
+     a3e:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+     a45:	00 00 00 
+     a48:	c7 85 6c ff ff ff 00 	movl   $0x0,-0x94(%ebp)
+     a4f:	00 00 00 
+  mutex_init(&f.lock);
+     a52:	50                   	push   %eax
+     a53:	e8 d8 f9 ff ff       	call   430 <mutex_init>
+  vfprintf(&f, fmt, (uint*)(void*)&fmt + 1);
+     a58:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     a5b:	89 f2                	mov    %esi,%edx
+     a5d:	89 d8                	mov    %ebx,%eax
+     a5f:	e8 dc fd ff ff       	call   840 <vfprintf>
+  fflush(&f);
+     a64:	89 1c 24             	mov    %ebx,(%esp)
+     a67:	e8 f4 04 00 00       	call   f60 <fflush>
+     a6c:	83 c4 10             	add    $0x10,%esp
+}
+     a6f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     a72:	5b                   	pop    %ebx
+     a73:	5e                   	pop    %esi
+     a74:	5d                   	pop    %ebp
+     a75:	c3                   	ret
+     a76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a7d:	8d 76 00             	lea    0x0(%esi),%esi
+    flockfile(&_iob[fd]);
+     a80:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     a83:	83 ec 0c             	sub    $0xc,%esp
+     a86:	8d 98 40 29 00 00    	lea    0x2940(%eax),%ebx
+     a8c:	53                   	push   %ebx
+     a8d:	e8 0e 02 00 00       	call   ca0 <flockfile>
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     a92:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     a95:	89 f2                	mov    %esi,%edx
+     a97:	89 d8                	mov    %ebx,%eax
+     a99:	e8 a2 fd ff ff       	call   840 <vfprintf>
+    funlockfile(&_iob[fd]);
+     a9e:	89 1c 24             	mov    %ebx,(%esp)
+     aa1:	e8 2a 02 00 00       	call   cd0 <funlockfile>
+     aa6:	83 c4 10             	add    $0x10,%esp
+}
+     aa9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     aac:	5b                   	pop    %ebx
+     aad:	5e                   	pop    %esi
+     aae:	5d                   	pop    %ebp
+     aaf:	c3                   	ret
+
+00000ab0 <setup>:
+}
+
+// Choose how to buffer f on first use: by lines on a device.
+static void
+setup(FILE *f)
+{
+     ab0:	55                   	push   %ebp
+     ab1:	89 e5                	mov    %esp,%ebp
+     ab3:	53                   	push   %ebx
+     ab4:	89 c3                	mov    %eax,%ebx
+     ab6:	83 ec 2c             	sub    $0x2c,%esp
+  struct stat st;
+
+  f->flags |= IO_SETUP;
+     ab9:	83 48 04 40          	orl    $0x40,0x4(%eax)
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     abd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     ac0:	50                   	push   %eax
+     ac1:	ff 33                	push   (%ebx)
+     ac3:	e8 52 fb ff ff       	call   61a <fstat>
+     ac8:	83 c4 10             	add    $0x10,%esp
+     acb:	85 c0                	test   %eax,%eax
+    f->flags |= IO_DEV|IO_LINE;
+     acd:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     ad0:	75 07                	jne    ad9 <setup+0x29>
+     ad2:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+     ad7:	74 17                	je     af0 <setup+0x40>
+  if(f->flags & IO_WRITE)
+     ad9:	a8 02                	test   $0x2,%al
+     adb:	74 0a                	je     ae7 <setup+0x37>
+    flushhook = flushall;
+     add:	c7 05 20 2a 00 00 10 	movl   $0xc10,0x2a20
+     ae4:	0c 00 00 
+}
+     ae7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     aea:	c9                   	leave
+     aeb:	c3                   	ret
+     aec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    f->flags |= IO_DEV|IO_LINE;
+     af0:	83 c8 30             	or     $0x30,%eax
+     af3:	89 43 04             	mov    %eax,0x4(%ebx)
+     af6:	eb e1                	jmp    ad9 <setup+0x29>
+     af8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aff:	90                   	nop
+
+00000b00 <flush>:
+static int
+flush(FILE *f)
+{
+  int i, n;
+
+  if(!(f->flags & IO_WRITE))
+     b00:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+     b04:	74 6a                	je     b70 <flush+0x70>
+{
+     b06:	55                   	push   %ebp
+     b07:	89 e5                	mov    %esp,%ebp
+     b09:	56                   	push   %esi
+     b0a:	89 c6                	mov    %eax,%esi
+     b0c:	53                   	push   %ebx
+    return 0;
+  for(i = 0; i < f->n; i += n){
+     b0d:	8b 40 14             	mov    0x14(%eax),%eax
+     b10:	85 c0                	test   %eax,%eax
+     b12:	7e 4c                	jle    b60 <flush+0x60>
+     b14:	31 db                	xor    %ebx,%ebx
+     b16:	eb 11                	jmp    b29 <flush+0x29>
+     b18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b1f:	90                   	nop
+     b20:	01 c3                	add    %eax,%ebx
+     b22:	8b 46 14             	mov    0x14(%esi),%eax
+     b25:	39 d8                	cmp    %ebx,%eax
+     b27:	7e 37                	jle    b60 <flush+0x60>
+    if((n = write(f->fd, f->buf + i, f->n - i)) <= 0){
+     b29:	83 ec 04             	sub    $0x4,%esp
+     b2c:	29 d8                	sub    %ebx,%eax
+     b2e:	50                   	push   %eax
+     b2f:	8b 46 08             	mov    0x8(%esi),%eax
+     b32:	01 d8                	add    %ebx,%eax
+     b34:	50                   	push   %eax
+     b35:	ff 36                	push   (%esi)
+     b37:	e8 75 fa ff ff       	call   5b1 <write>
+     b3c:	83 c4 10             	add    $0x10,%esp
+     b3f:	85 c0                	test   %eax,%eax
+     b41:	7f dd                	jg     b20 <flush+0x20>
+      f->flags |= IO_ERR;
+     b43:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+      f->n = 0;
+     b47:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     b4c:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+      return EOF;
+    }
+  }
+  f->n = 0;
+  return 0;
+}
+     b53:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b56:	5b                   	pop    %ebx
+     b57:	5e                   	pop    %esi
+     b58:	5d                   	pop    %ebp
+     b59:	c3                   	ret
+     b5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->n = 0;
+     b60:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+}
+     b67:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+     b6a:	31 c0                	xor    %eax,%eax
+}
+     b6c:	5b                   	pop    %ebx
+     b6d:	5e                   	pop    %esi
+     b6e:	5d                   	pop    %ebp
+     b6f:	c3                   	ret
+    return 0;
+     b70:	31 c0                	xor    %eax,%eax
+}
+     b72:	c3                   	ret
+     b73:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000b80 <fflush.part.0>:
+fflush(FILE *f)
+     b80:	55                   	push   %ebp
+     b81:	89 e5                	mov    %esp,%ebp
+     b83:	57                   	push   %edi
+     b84:	bf 38 2a 00 00       	mov    $0x2a38,%edi
+     b89:	56                   	push   %esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     b8a:	31 f6                	xor    %esi,%esi
+fflush(FILE *f)
+     b8c:	53                   	push   %ebx
+     b8d:	bb 58 29 00 00       	mov    $0x2958,%ebx
+     b92:	83 ec 1c             	sub    $0x1c,%esp
+     b95:	eb 10                	jmp    ba7 <fflush.part.0+0x27>
+     b97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b9e:	66 90                	xchg   %ax,%ax
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     ba0:	83 c3 1c             	add    $0x1c,%ebx
+     ba3:	39 df                	cmp    %ebx,%edi
+     ba5:	74 33                	je     bda <fflush.part.0+0x5a>
+      if((f->flags & IO_WRITE) && fflush(f) < 0)
+     ba7:	f6 43 ec 02          	testb  $0x2,-0x14(%ebx)
+     bab:	74 f3                	je     ba0 <fflush.part.0+0x20>
+  if(threaded)
+     bad:	8b 0d 40 2a 00 00    	mov    0x2a40,%ecx
+     bb3:	85 c9                	test   %ecx,%ecx
+     bb5:	75 49                	jne    c00 <fflush.part.0+0x80>
+  r = flush(f);
+     bb7:	8d 43 e8             	lea    -0x18(%ebx),%eax
+     bba:	e8 41 ff ff ff       	call   b00 <flush>
+  if(threaded)
+     bbf:	8b 15 40 2a 00 00    	mov    0x2a40,%edx
+     bc5:	85 d2                	test   %edx,%edx
+     bc7:	75 1f                	jne    be8 <fflush.part.0+0x68>
+        r = EOF;
+     bc9:	85 c0                	test   %eax,%eax
+     bcb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     bd0:	0f 48 f0             	cmovs  %eax,%esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     bd3:	83 c3 1c             	add    $0x1c,%ebx
+     bd6:	39 df                	cmp    %ebx,%edi
+     bd8:	75 cd                	jne    ba7 <fflush.part.0+0x27>
+}
+     bda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bdd:	89 f0                	mov    %esi,%eax
+     bdf:	5b                   	pop    %ebx
+     be0:	5e                   	pop    %esi
+     be1:	5f                   	pop    %edi
+     be2:	5d                   	pop    %ebp
+     be3:	c3                   	ret
+     be4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     be8:	83 ec 0c             	sub    $0xc,%esp
+     beb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     bee:	53                   	push   %ebx
+     bef:	e8 9c f8 ff ff       	call   490 <mutex_unlock>
+     bf4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     bf7:	83 c4 10             	add    $0x10,%esp
+     bfa:	eb cd                	jmp    bc9 <fflush.part.0+0x49>
+     bfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     c00:	83 ec 0c             	sub    $0xc,%esp
+     c03:	53                   	push   %ebx
+     c04:	e8 37 f8 ff ff       	call   440 <mutex_lock>
+     c09:	83 c4 10             	add    $0x10,%esp
+     c0c:	eb a9                	jmp    bb7 <fflush.part.0+0x37>
+     c0e:	66 90                	xchg   %ax,%ax
+
+00000c10 <flushall>:
+  if(f == 0){
+     c10:	e9 6b ff ff ff       	jmp    b80 <fflush.part.0>
+     c15:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c20 <fill>:
+
+// Refill f's buffer. Returns the number of bytes read.
+// Caller holds f's lock.
+static int
+fill(FILE *f)
+{
+     c20:	55                   	push   %ebp
+     c21:	89 e5                	mov    %esp,%ebp
+     c23:	53                   	push   %ebx
+     c24:	89 c3                	mov    %eax,%ebx
+     c26:	83 ec 04             	sub    $0x4,%esp
+  int n;
+
+  if(!(f->flags & IO_SETUP))
+     c29:	8b 40 04             	mov    0x4(%eax),%eax
+     c2c:	a8 40                	test   $0x40,%al
+     c2e:	74 50                	je     c80 <fill+0x60>
+    setup(f);
+  if(f->flags & IO_DEV)
+     c30:	a8 20                	test   $0x20,%al
+     c32:	75 3c                	jne    c70 <fill+0x50>
+    fflush(0);
+  f->r = 0;
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     c34:	83 ec 04             	sub    $0x4,%esp
+  f->r = 0;
+     c37:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     c3e:	ff 73 0c             	push   0xc(%ebx)
+     c41:	ff 73 08             	push   0x8(%ebx)
+     c44:	ff 33                	push   (%ebx)
+     c46:	e8 57 f9 ff ff       	call   5a2 <read>
+     c4b:	83 c4 10             	add    $0x10,%esp
+     c4e:	85 c0                	test   %eax,%eax
+     c50:	7f 10                	jg     c62 <fill+0x42>
+    f->flags |= n < 0 ? IO_ERR : IO_EOF;
+     c52:	83 f8 01             	cmp    $0x1,%eax
+     c55:	19 c0                	sbb    %eax,%eax
+     c57:	83 e0 fc             	and    $0xfffffffc,%eax
+     c5a:	83 c0 08             	add    $0x8,%eax
+     c5d:	09 43 04             	or     %eax,0x4(%ebx)
+    n = 0;
+     c60:	31 c0                	xor    %eax,%eax
+  }
+  f->n = n;
+     c62:	89 43 14             	mov    %eax,0x14(%ebx)
+  return n;
+}
+     c65:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c68:	c9                   	leave
+     c69:	c3                   	ret
+     c6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == 0){
+     c70:	e8 0b ff ff ff       	call   b80 <fflush.part.0>
+     c75:	eb bd                	jmp    c34 <fill+0x14>
+     c77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c7e:	66 90                	xchg   %ax,%ax
+    setup(f);
+     c80:	89 d8                	mov    %ebx,%eax
+     c82:	e8 29 fe ff ff       	call   ab0 <setup>
+  if(f->flags & IO_DEV)
+     c87:	8b 43 04             	mov    0x4(%ebx),%eax
+     c8a:	eb a4                	jmp    c30 <fill+0x10>
+     c8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c90 <stdio_threaded>:
+  threaded = 1;
+     c90:	c7 05 40 2a 00 00 01 	movl   $0x1,0x2a40
+     c97:	00 00 00 
+}
+     c9a:	c3                   	ret
+     c9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c9f:	90                   	nop
+
+00000ca0 <flockfile>:
+{
+     ca0:	55                   	push   %ebp
+  if(threaded)
+     ca1:	8b 15 40 2a 00 00    	mov    0x2a40,%edx
+{
+     ca7:	89 e5                	mov    %esp,%ebp
+     ca9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     cac:	85 d2                	test   %edx,%edx
+     cae:	75 08                	jne    cb8 <flockfile+0x18>
+}
+     cb0:	5d                   	pop    %ebp
+     cb1:	c3                   	ret
+     cb2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_lock(&f->lock);
+     cb8:	83 c0 18             	add    $0x18,%eax
+     cbb:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     cbe:	5d                   	pop    %ebp
+    mutex_lock(&f->lock);
+     cbf:	e9 7c f7 ff ff       	jmp    440 <mutex_lock>
+     cc4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ccb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ccf:	90                   	nop
+
+00000cd0 <funlockfile>:
+{
+     cd0:	55                   	push   %ebp
+  if(threaded)
+     cd1:	8b 15 40 2a 00 00    	mov    0x2a40,%edx
+{
+     cd7:	89 e5                	mov    %esp,%ebp
+     cd9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     cdc:	85 d2                	test   %edx,%edx
+     cde:	75 08                	jne    ce8 <funlockfile+0x18>
+}
+     ce0:	5d                   	pop    %ebp
+     ce1:	c3                   	ret
+     ce2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&f->lock);
+     ce8:	83 c0 18             	add    $0x18,%eax
+     ceb:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     cee:	5d                   	pop    %ebp
+    mutex_unlock(&f->lock);
+     cef:	e9 9c f7 ff ff       	jmp    490 <mutex_unlock>
+     cf4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cff:	90                   	nop
+
+00000d00 <fopen>:
+{
+     d00:	55                   	push   %ebp
+     d01:	89 e5                	mov    %esp,%ebp
+     d03:	57                   	push   %edi
+     d04:	56                   	push   %esi
+     d05:	53                   	push   %ebx
+     d06:	83 ec 34             	sub    $0x34,%esp
+     d09:	8b 75 0c             	mov    0xc(%ebp),%esi
+     d0c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(strcmp(mode, "r") != 0 && strcmp(mode, "w") != 0)
+     d0f:	68 ad 1f 00 00       	push   $0x1fad
+     d14:	56                   	push   %esi
+     d15:	e8 66 f5 ff ff       	call   280 <strcmp>
+     d1a:	83 c4 10             	add    $0x10,%esp
+     d1d:	85 c0                	test   %eax,%eax
+     d1f:	74 15                	je     d36 <fopen+0x36>
+     d21:	83 ec 08             	sub    $0x8,%esp
+     d24:	68 af 1f 00 00       	push   $0x1faf
+     d29:	56                   	push   %esi
+     d2a:	e8 51 f5 ff ff       	call   280 <strcmp>
+     d2f:	83 c4 10             	add    $0x10,%esp
+     d32:	85 c0                	test   %eax,%eax
+     d34:	75 2c                	jne    d62 <fopen+0x62>
+  if(threaded)
+     d36:	a1 40 2a 00 00       	mov    0x2a40,%eax
+     d3b:	85 c0                	test   %eax,%eax
+     d3d:	0f 85 ed 00 00 00    	jne    e30 <fopen+0x130>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     d43:	bb 94 29 00 00       	mov    $0x2994,%ebx
+    if(f->flags == 0)
+     d48:	8b 53 04             	mov    0x4(%ebx),%edx
+     d4b:	85 d2                	test   %edx,%edx
+     d4d:	74 21                	je     d70 <fopen+0x70>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     d4f:	83 c3 1c             	add    $0x1c,%ebx
+     d52:	81 fb 20 2a 00 00    	cmp    $0x2a20,%ebx
+     d58:	75 ee                	jne    d48 <fopen+0x48>
+  if(threaded)
+     d5a:	85 c0                	test   %eax,%eax
+     d5c:	0f 85 36 01 00 00    	jne    e98 <fopen+0x198>
+    return 0;
+     d62:	31 db                	xor    %ebx,%ebx
+     d64:	e9 96 00 00 00       	jmp    dff <fopen+0xff>
+     d69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f == &_iob[NSTREAM])
+     d70:	81 fb 20 2a 00 00    	cmp    $0x2a20,%ebx
+     d76:	74 e2                	je     d5a <fopen+0x5a>
+    f->flags = IO_MALLOC;
+     d78:	c7 43 04 80 00 00 00 	movl   $0x80,0x4(%ebx)
+  if(threaded)
+     d7f:	85 c0                	test   %eax,%eax
+     d81:	0f 85 f9 00 00 00    	jne    e80 <fopen+0x180>
+  if(mode[0] == 'r'){
+     d87:	80 3e 72             	cmpb   $0x72,(%esi)
+     d8a:	0f 84 c0 00 00 00    	je     e50 <fopen+0x150>
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     d90:	83 ec 08             	sub    $0x8,%esp
+     d93:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     d96:	50                   	push   %eax
+     d97:	57                   	push   %edi
+     d98:	e8 d3 f5 ff ff       	call   370 <stat>
+     d9d:	83 c4 10             	add    $0x10,%esp
+     da0:	85 c0                	test   %eax,%eax
+     da2:	74 6c                	je     e10 <fopen+0x110>
+    fd = open(path, O_CREATE|O_WRONLY);
+     da4:	83 ec 08             	sub    $0x8,%esp
+     da7:	68 01 02 00 00       	push   $0x201
+     dac:	57                   	push   %edi
+    flags = IO_WRITE;
+     dad:	bf 02 00 00 00       	mov    $0x2,%edi
+    fd = open(path, O_CREATE|O_WRONLY);
+     db2:	e8 36 f8 ff ff       	call   5ed <open>
+     db7:	83 c4 10             	add    $0x10,%esp
+     dba:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     dbc:	85 f6                	test   %esi,%esi
+     dbe:	0f 88 a9 00 00 00    	js     e6d <fopen+0x16d>
+     dc4:	83 ec 0c             	sub    $0xc,%esp
+     dc7:	68 00 02 00 00       	push   $0x200
+     dcc:	e8 af 0c 00 00       	call   1a80 <malloc>
+     dd1:	83 c4 10             	add    $0x10,%esp
+     dd4:	89 43 08             	mov    %eax,0x8(%ebx)
+     dd7:	85 c0                	test   %eax,%eax
+     dd9:	0f 84 d0 00 00 00    	je     eaf <fopen+0x1af>
+  f->flags = flags|IO_MALLOC;
+     ddf:	81 cf 80 00 00 00    	or     $0x80,%edi
+  f->fd = fd;
+     de5:	89 33                	mov    %esi,(%ebx)
+  f->size = BUFSIZ;
+     de7:	c7 43 0c 00 02 00 00 	movl   $0x200,0xc(%ebx)
+  f->r = f->n = 0;
+     dee:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+     df5:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  f->flags = flags|IO_MALLOC;
+     dfc:	89 7b 04             	mov    %edi,0x4(%ebx)
+}
+     dff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e02:	89 d8                	mov    %ebx,%eax
+     e04:	5b                   	pop    %ebx
+     e05:	5e                   	pop    %esi
+     e06:	5f                   	pop    %edi
+     e07:	5d                   	pop    %ebp
+     e08:	c3                   	ret
+     e09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     e10:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+     e15:	75 8d                	jne    da4 <fopen+0xa4>
+      unlink(path);
+     e17:	83 ec 0c             	sub    $0xc,%esp
+     e1a:	57                   	push   %edi
+     e1b:	e8 eb f7 ff ff       	call   60b <unlink>
+     e20:	83 c4 10             	add    $0x10,%esp
+     e23:	e9 7c ff ff ff       	jmp    da4 <fopen+0xa4>
+     e28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e2f:	90                   	nop
+    mutex_lock(&iolock);
+     e30:	83 ec 0c             	sub    $0xc,%esp
+     e33:	68 44 2a 00 00       	push   $0x2a44
+     e38:	e8 03 f6 ff ff       	call   440 <mutex_lock>
+  if(threaded)
+     e3d:	a1 40 2a 00 00       	mov    0x2a40,%eax
+     e42:	83 c4 10             	add    $0x10,%esp
+     e45:	e9 f9 fe ff ff       	jmp    d43 <fopen+0x43>
+     e4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    fd = open(path, O_RDONLY);
+     e50:	83 ec 08             	sub    $0x8,%esp
+     e53:	6a 00                	push   $0x0
+     e55:	57                   	push   %edi
+    flags = IO_READ;
+     e56:	bf 01 00 00 00       	mov    $0x1,%edi
+    fd = open(path, O_RDONLY);
+     e5b:	e8 8d f7 ff ff       	call   5ed <open>
+     e60:	83 c4 10             	add    $0x10,%esp
+     e63:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     e65:	85 f6                	test   %esi,%esi
+     e67:	0f 89 57 ff ff ff    	jns    dc4 <fopen+0xc4>
+    f->flags = 0;
+     e6d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    return 0;
+     e74:	31 db                	xor    %ebx,%ebx
+     e76:	eb 87                	jmp    dff <fopen+0xff>
+     e78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e7f:	90                   	nop
+    mutex_unlock(&iolock);
+     e80:	83 ec 0c             	sub    $0xc,%esp
+     e83:	68 44 2a 00 00       	push   $0x2a44
+     e88:	e8 03 f6 ff ff       	call   490 <mutex_unlock>
+     e8d:	83 c4 10             	add    $0x10,%esp
+     e90:	e9 f2 fe ff ff       	jmp    d87 <fopen+0x87>
+     e95:	8d 76 00             	lea    0x0(%esi),%esi
+     e98:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+     e9b:	31 db                	xor    %ebx,%ebx
+    mutex_unlock(&iolock);
+     e9d:	68 44 2a 00 00       	push   $0x2a44
+     ea2:	e8 e9 f5 ff ff       	call   490 <mutex_unlock>
+     ea7:	83 c4 10             	add    $0x10,%esp
+     eaa:	e9 50 ff ff ff       	jmp    dff <fopen+0xff>
+      close(fd);
+     eaf:	83 ec 0c             	sub    $0xc,%esp
+     eb2:	56                   	push   %esi
+     eb3:	e8 08 f7 ff ff       	call   5c0 <close>
+     eb8:	83 c4 10             	add    $0x10,%esp
+     ebb:	eb b0                	jmp    e6d <fopen+0x16d>
+     ebd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ec0 <fclose>:
+{
+     ec0:	55                   	push   %ebp
+     ec1:	89 e5                	mov    %esp,%ebp
+     ec3:	56                   	push   %esi
+     ec4:	53                   	push   %ebx
+  if(threaded)
+     ec5:	8b 15 40 2a 00 00    	mov    0x2a40,%edx
+{
+     ecb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+     ece:	85 d2                	test   %edx,%edx
+     ed0:	75 46                	jne    f18 <fclose+0x58>
+  r = flush(f);
+     ed2:	89 d8                	mov    %ebx,%eax
+     ed4:	e8 27 fc ff ff       	call   b00 <flush>
+  if(close(f->fd) < 0)
+     ed9:	83 ec 0c             	sub    $0xc,%esp
+     edc:	ff 33                	push   (%ebx)
+  r = flush(f);
+     ede:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+     ee0:	e8 db f6 ff ff       	call   5c0 <close>
+     ee5:	83 c4 10             	add    $0x10,%esp
+    r = EOF;
+     ee8:	85 c0                	test   %eax,%eax
+     eea:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     eef:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->flags & IO_MALLOC)
+     ef2:	f6 43 04 80          	testb  $0x80,0x4(%ebx)
+     ef6:	75 58                	jne    f50 <fclose+0x90>
+  if(threaded)
+     ef8:	a1 40 2a 00 00       	mov    0x2a40,%eax
+  f->flags = 0;
+     efd:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  if(threaded)
+     f04:	85 c0                	test   %eax,%eax
+     f06:	75 28                	jne    f30 <fclose+0x70>
+}
+     f08:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f0b:	89 f0                	mov    %esi,%eax
+     f0d:	5b                   	pop    %ebx
+     f0e:	5e                   	pop    %esi
+     f0f:	5d                   	pop    %ebp
+     f10:	c3                   	ret
+     f11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     f18:	83 ec 0c             	sub    $0xc,%esp
+     f1b:	8d 43 18             	lea    0x18(%ebx),%eax
+     f1e:	50                   	push   %eax
+     f1f:	e8 1c f5 ff ff       	call   440 <mutex_lock>
+     f24:	83 c4 10             	add    $0x10,%esp
+     f27:	eb a9                	jmp    ed2 <fclose+0x12>
+     f29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     f30:	83 ec 0c             	sub    $0xc,%esp
+     f33:	83 c3 18             	add    $0x18,%ebx
+     f36:	53                   	push   %ebx
+     f37:	e8 54 f5 ff ff       	call   490 <mutex_unlock>
+     f3c:	83 c4 10             	add    $0x10,%esp
+}
+     f3f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f42:	89 f0                	mov    %esi,%eax
+     f44:	5b                   	pop    %ebx
+     f45:	5e                   	pop    %esi
+     f46:	5d                   	pop    %ebp
+     f47:	c3                   	ret
+     f48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f4f:	90                   	nop
+    free(f->buf);
+     f50:	83 ec 0c             	sub    $0xc,%esp
+     f53:	ff 73 08             	push   0x8(%ebx)
+     f56:	e8 f5 09 00 00       	call   1950 <free>
+     f5b:	83 c4 10             	add    $0x10,%esp
+     f5e:	eb 98                	jmp    ef8 <fclose+0x38>
+
+00000f60 <fflush>:
+{
+     f60:	55                   	push   %ebp
+     f61:	89 e5                	mov    %esp,%ebp
+     f63:	53                   	push   %ebx
+     f64:	83 ec 14             	sub    $0x14,%esp
+     f67:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f == 0){
+     f6a:	85 db                	test   %ebx,%ebx
+     f6c:	74 5a                	je     fc8 <fflush+0x68>
+  if(threaded)
+     f6e:	8b 0d 40 2a 00 00    	mov    0x2a40,%ecx
+     f74:	85 c9                	test   %ecx,%ecx
+     f76:	75 18                	jne    f90 <fflush+0x30>
+  r = flush(f);
+     f78:	89 d8                	mov    %ebx,%eax
+     f7a:	e8 81 fb ff ff       	call   b00 <flush>
+  if(threaded)
+     f7f:	8b 15 40 2a 00 00    	mov    0x2a40,%edx
+     f85:	85 d2                	test   %edx,%edx
+     f87:	75 1f                	jne    fa8 <fflush+0x48>
+}
+     f89:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f8c:	c9                   	leave
+     f8d:	c3                   	ret
+     f8e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+     f90:	83 ec 0c             	sub    $0xc,%esp
+     f93:	8d 43 18             	lea    0x18(%ebx),%eax
+     f96:	50                   	push   %eax
+     f97:	e8 a4 f4 ff ff       	call   440 <mutex_lock>
+     f9c:	83 c4 10             	add    $0x10,%esp
+     f9f:	eb d7                	jmp    f78 <fflush+0x18>
+     fa1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     fa8:	83 ec 0c             	sub    $0xc,%esp
+     fab:	83 c3 18             	add    $0x18,%ebx
+     fae:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     fb1:	53                   	push   %ebx
+     fb2:	e8 d9 f4 ff ff       	call   490 <mutex_unlock>
+     fb7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     fba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    mutex_unlock(&f->lock);
+     fbd:	83 c4 10             	add    $0x10,%esp
+}
+     fc0:	c9                   	leave
+     fc1:	c3                   	ret
+     fc2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     fc8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     fcb:	c9                   	leave
+     fcc:	e9 af fb ff ff       	jmp    b80 <fflush.part.0>
+     fd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fdf:	90                   	nop
+
+00000fe0 <putc_unlocked>:
+{
+     fe0:	55                   	push   %ebp
+     fe1:	89 e5                	mov    %esp,%ebp
+     fe3:	56                   	push   %esi
+     fe4:	53                   	push   %ebx
+     fe5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     fe8:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(!(f->flags & IO_WRITE))
+     feb:	8b 43 04             	mov    0x4(%ebx),%eax
+     fee:	a8 02                	test   $0x2,%al
+     ff0:	74 46                	je     1038 <putc_unlocked+0x58>
+  if(!(f->flags & IO_SETUP))
+     ff2:	a8 40                	test   $0x40,%al
+     ff4:	74 4a                	je     1040 <putc_unlocked+0x60>
+  if(f->n == f->size && flush(f) < 0)
+     ff6:	8b 43 14             	mov    0x14(%ebx),%eax
+     ff9:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     ffc:	74 51                	je     104f <putc_unlocked+0x6f>
+  f->buf[f->n++] = c;
+     ffe:	8d 48 01             	lea    0x1(%eax),%ecx
+    1001:	8b 53 08             	mov    0x8(%ebx),%edx
+    1004:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    1007:	89 f1                	mov    %esi,%ecx
+    1009:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    100c:	83 fe 0a             	cmp    $0xa,%esi
+    100f:	74 0f                	je     1020 <putc_unlocked+0x40>
+  return c & 0xff;
+    1011:	89 f0                	mov    %esi,%eax
+    1013:	0f b6 c0             	movzbl %al,%eax
+}
+    1016:	5b                   	pop    %ebx
+    1017:	5e                   	pop    %esi
+    1018:	5d                   	pop    %ebp
+    1019:	c3                   	ret
+    101a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    1020:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1024:	74 eb                	je     1011 <putc_unlocked+0x31>
+    1026:	89 d8                	mov    %ebx,%eax
+    1028:	e8 d3 fa ff ff       	call   b00 <flush>
+    102d:	85 c0                	test   %eax,%eax
+    102f:	79 e0                	jns    1011 <putc_unlocked+0x31>
+    1031:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return EOF;
+    1038:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    103d:	eb d7                	jmp    1016 <putc_unlocked+0x36>
+    103f:	90                   	nop
+    setup(f);
+    1040:	89 d8                	mov    %ebx,%eax
+    1042:	e8 69 fa ff ff       	call   ab0 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    1047:	8b 43 14             	mov    0x14(%ebx),%eax
+    104a:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    104d:	75 af                	jne    ffe <putc_unlocked+0x1e>
+    104f:	89 d8                	mov    %ebx,%eax
+    1051:	e8 aa fa ff ff       	call   b00 <flush>
+    1056:	85 c0                	test   %eax,%eax
+    1058:	78 de                	js     1038 <putc_unlocked+0x58>
+  f->buf[f->n++] = c;
+    105a:	8b 43 14             	mov    0x14(%ebx),%eax
+    105d:	eb 9f                	jmp    ffe <putc_unlocked+0x1e>
+    105f:	90                   	nop
+
+00001060 <fputc>:
+{
+    1060:	55                   	push   %ebp
+    1061:	89 e5                	mov    %esp,%ebp
+    1063:	56                   	push   %esi
+    1064:	53                   	push   %ebx
+  if(threaded)
+    1065:	8b 15 40 2a 00 00    	mov    0x2a40,%edx
+{
+    106b:	8b 75 08             	mov    0x8(%ebp),%esi
+    106e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(threaded)
+    1071:	85 d2                	test   %edx,%edx
+    1073:	75 6b                	jne    10e0 <fputc+0x80>
+  if(!(f->flags & IO_WRITE))
+    1075:	8b 43 04             	mov    0x4(%ebx),%eax
+    1078:	a8 02                	test   $0x2,%al
+    107a:	0f 84 b8 00 00 00    	je     1138 <fputc+0xd8>
+  if(!(f->flags & IO_SETUP))
+    1080:	a8 40                	test   $0x40,%al
+    1082:	74 76                	je     10fa <fputc+0x9a>
+  if(f->n == f->size && flush(f) < 0)
+    1084:	8b 43 14             	mov    0x14(%ebx),%eax
+    1087:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    108a:	74 7d                	je     1109 <fputc+0xa9>
+  f->buf[f->n++] = c;
+    108c:	8d 48 01             	lea    0x1(%eax),%ecx
+    108f:	8b 53 08             	mov    0x8(%ebx),%edx
+    1092:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    1095:	89 f1                	mov    %esi,%ecx
+    1097:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    109a:	83 fe 0a             	cmp    $0xa,%esi
+    109d:	74 21                	je     10c0 <fputc+0x60>
+  return c & 0xff;
+    109f:	89 f0                	mov    %esi,%eax
+    10a1:	0f b6 f0             	movzbl %al,%esi
+  if(threaded)
+    10a4:	a1 40 2a 00 00       	mov    0x2a40,%eax
+    10a9:	85 c0                	test   %eax,%eax
+    10ab:	75 73                	jne    1120 <fputc+0xc0>
+}
+    10ad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    10b0:	89 f0                	mov    %esi,%eax
+    10b2:	5b                   	pop    %ebx
+    10b3:	5e                   	pop    %esi
+    10b4:	5d                   	pop    %ebp
+    10b5:	c3                   	ret
+    10b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10bd:	8d 76 00             	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    10c0:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    10c4:	74 d9                	je     109f <fputc+0x3f>
+    10c6:	89 d8                	mov    %ebx,%eax
+    10c8:	e8 33 fa ff ff       	call   b00 <flush>
+    10cd:	85 c0                	test   %eax,%eax
+    10cf:	79 ce                	jns    109f <fputc+0x3f>
+    return EOF;
+    10d1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    10d6:	eb cc                	jmp    10a4 <fputc+0x44>
+    10d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10df:	90                   	nop
+    mutex_lock(&f->lock);
+    10e0:	83 ec 0c             	sub    $0xc,%esp
+    10e3:	8d 43 18             	lea    0x18(%ebx),%eax
+    10e6:	50                   	push   %eax
+    10e7:	e8 54 f3 ff ff       	call   440 <mutex_lock>
+  if(!(f->flags & IO_WRITE))
+    10ec:	8b 43 04             	mov    0x4(%ebx),%eax
+    10ef:	83 c4 10             	add    $0x10,%esp
+    10f2:	a8 02                	test   $0x2,%al
+    10f4:	74 db                	je     10d1 <fputc+0x71>
+  if(!(f->flags & IO_SETUP))
+    10f6:	a8 40                	test   $0x40,%al
+    10f8:	75 8a                	jne    1084 <fputc+0x24>
+    setup(f);
+    10fa:	89 d8                	mov    %ebx,%eax
+    10fc:	e8 af f9 ff ff       	call   ab0 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    1101:	8b 43 14             	mov    0x14(%ebx),%eax
+    1104:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    1107:	75 83                	jne    108c <fputc+0x2c>
+    1109:	89 d8                	mov    %ebx,%eax
+    110b:	e8 f0 f9 ff ff       	call   b00 <flush>
+    1110:	85 c0                	test   %eax,%eax
+    1112:	78 bd                	js     10d1 <fputc+0x71>
+  f->buf[f->n++] = c;
+    1114:	8b 43 14             	mov    0x14(%ebx),%eax
+    1117:	e9 70 ff ff ff       	jmp    108c <fputc+0x2c>
+    111c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1120:	83 ec 0c             	sub    $0xc,%esp
+    1123:	83 c3 18             	add    $0x18,%ebx
+    1126:	53                   	push   %ebx
+    1127:	e8 64 f3 ff ff       	call   490 <mutex_unlock>
+    112c:	83 c4 10             	add    $0x10,%esp
+}
+    112f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1132:	89 f0                	mov    %esi,%eax
+    1134:	5b                   	pop    %ebx
+    1135:	5e                   	pop    %esi
+    1136:	5d                   	pop    %ebp
+    1137:	c3                   	ret
+    return EOF;
+    1138:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    113d:	e9 6b ff ff ff       	jmp    10ad <fputc+0x4d>
+    1142:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001150 <fwrite>:
+{
+    1150:	55                   	push   %ebp
+    1151:	89 e5                	mov    %esp,%ebp
+    1153:	57                   	push   %edi
+    1154:	56                   	push   %esi
+    1155:	53                   	push   %ebx
+    1156:	83 ec 1c             	sub    $0x1c,%esp
+    1159:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  if(!(f->flags & IO_WRITE) || size <= 0)
+    115c:	8b 43 04             	mov    0x4(%ebx),%eax
+    115f:	a8 02                	test   $0x2,%al
+    1161:	0f 84 ec 00 00 00    	je     1253 <fwrite+0x103>
+    1167:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    116a:	85 c9                	test   %ecx,%ecx
+    116c:	0f 8e e1 00 00 00    	jle    1253 <fwrite+0x103>
+  if(threaded)
+    1172:	8b 15 40 2a 00 00    	mov    0x2a40,%edx
+    1178:	85 d2                	test   %edx,%edx
+    117a:	0f 85 1c 01 00 00    	jne    129c <fwrite+0x14c>
+  if(!(f->flags & IO_SETUP))
+    1180:	a8 40                	test   $0x40,%al
+    1182:	0f 84 08 01 00 00    	je     1290 <fwrite+0x140>
+  for(len = size*nmemb; len > 0; len -= n){
+    1188:	8b 45 0c             	mov    0xc(%ebp),%eax
+    118b:	0f af 45 10          	imul   0x10(%ebp),%eax
+    118f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    1192:	85 c0                	test   %eax,%eax
+    1194:	0f 8e 2a 01 00 00    	jle    12c4 <fwrite+0x174>
+  s = p;
+    119a:	8b 45 08             	mov    0x8(%ebp),%eax
+  nl = 0;
+    119d:	31 ff                	xor    %edi,%edi
+    119f:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+        nl = 1;
+    11a2:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  s = p;
+    11a5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    11a8:	8b 43 14             	mov    0x14(%ebx),%eax
+        nl = 1;
+    11ab:	89 ce                	mov    %ecx,%esi
+    if(f->n == f->size && flush(f) < 0)
+    11ad:	89 c2                	mov    %eax,%edx
+    11af:	39 f0                	cmp    %esi,%eax
+    11b1:	74 6e                	je     1221 <fwrite+0xd1>
+    11b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11b7:	90                   	nop
+    if(n > len)
+    11b8:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    n = f->size - f->n;
+    11bb:	89 f1                	mov    %esi,%ecx
+    11bd:	29 c1                	sub    %eax,%ecx
+    11bf:	39 f9                	cmp    %edi,%ecx
+    11c1:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    11c4:	85 c9                	test   %ecx,%ecx
+    11c6:	0f 8e 7c 00 00 00    	jle    1248 <fwrite+0xf8>
+    11cc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    11cf:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    11d2:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    11d5:	8d 34 08             	lea    (%eax,%ecx,1),%esi
+    11d8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    11db:	eb 06                	jmp    11e3 <fwrite+0x93>
+    11dd:	8d 76 00             	lea    0x0(%esi),%esi
+      if((f->buf[f->n++] = s[i]) == '\n')
+    11e0:	8b 53 14             	mov    0x14(%ebx),%edx
+    11e3:	8d 4a 01             	lea    0x1(%edx),%ecx
+    11e6:	8b 73 08             	mov    0x8(%ebx),%esi
+    11e9:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    11ec:	0f b6 08             	movzbl (%eax),%ecx
+        nl = 1;
+    11ef:	80 f9 0a             	cmp    $0xa,%cl
+      if((f->buf[f->n++] = s[i]) == '\n')
+    11f2:	88 0c 16             	mov    %cl,(%esi,%edx,1)
+        nl = 1;
+    11f5:	be 01 00 00 00       	mov    $0x1,%esi
+    11fa:	0f 44 fe             	cmove  %esi,%edi
+    for(i = 0; i < n; i++)
+    11fd:	83 c0 01             	add    $0x1,%eax
+    1200:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    1203:	75 db                	jne    11e0 <fwrite+0x90>
+    s += n;
+    1205:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1208:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    120b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    s += n;
+    120e:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    1211:	85 c0                	test   %eax,%eax
+    1213:	7e 48                	jle    125d <fwrite+0x10d>
+    1215:	8b 43 14             	mov    0x14(%ebx),%eax
+    1218:	8b 73 0c             	mov    0xc(%ebx),%esi
+    if(f->n == f->size && flush(f) < 0)
+    121b:	89 c2                	mov    %eax,%edx
+    121d:	39 f0                	cmp    %esi,%eax
+    121f:	75 97                	jne    11b8 <fwrite+0x68>
+    1221:	89 d8                	mov    %ebx,%eax
+    1223:	e8 d8 f8 ff ff       	call   b00 <flush>
+    1228:	85 c0                	test   %eax,%eax
+    122a:	78 31                	js     125d <fwrite+0x10d>
+    n = f->size - f->n;
+    122c:	8b 73 0c             	mov    0xc(%ebx),%esi
+    122f:	8b 43 14             	mov    0x14(%ebx),%eax
+    1232:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    1235:	89 f1                	mov    %esi,%ecx
+    1237:	89 c2                	mov    %eax,%edx
+    1239:	29 c1                	sub    %eax,%ecx
+    123b:	39 f9                	cmp    %edi,%ecx
+    123d:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1240:	85 c9                	test   %ecx,%ecx
+    1242:	7f 88                	jg     11cc <fwrite+0x7c>
+    1244:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    s += n;
+    1248:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    124b:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    124e:	e9 5a ff ff ff       	jmp    11ad <fwrite+0x5d>
+}
+    1253:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    1256:	31 c0                	xor    %eax,%eax
+}
+    1258:	5b                   	pop    %ebx
+    1259:	5e                   	pop    %esi
+    125a:	5f                   	pop    %edi
+    125b:	5d                   	pop    %ebp
+    125c:	c3                   	ret
+  if(nl && (f->flags & IO_LINE))
+    125d:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1260:	85 ff                	test   %edi,%edi
+    1262:	74 06                	je     126a <fwrite+0x11a>
+    1264:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1268:	75 1d                	jne    1287 <fwrite+0x137>
+  return (s - (const char*)p) / size;
+    126a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    126d:	2b 75 08             	sub    0x8(%ebp),%esi
+  if(threaded)
+    1270:	a1 40 2a 00 00       	mov    0x2a40,%eax
+    1275:	85 c0                	test   %eax,%eax
+    1277:	75 3a                	jne    12b3 <fwrite+0x163>
+  return (s - (const char*)p) / size;
+    1279:	89 f0                	mov    %esi,%eax
+    127b:	99                   	cltd
+    127c:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    127f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1282:	5b                   	pop    %ebx
+    1283:	5e                   	pop    %esi
+    1284:	5f                   	pop    %edi
+    1285:	5d                   	pop    %ebp
+    1286:	c3                   	ret
+    flush(f);
+    1287:	89 d8                	mov    %ebx,%eax
+    1289:	e8 72 f8 ff ff       	call   b00 <flush>
+    128e:	eb da                	jmp    126a <fwrite+0x11a>
+    setup(f);
+    1290:	89 d8                	mov    %ebx,%eax
+    1292:	e8 19 f8 ff ff       	call   ab0 <setup>
+    1297:	e9 ec fe ff ff       	jmp    1188 <fwrite+0x38>
+    mutex_lock(&f->lock);
+    129c:	83 ec 0c             	sub    $0xc,%esp
+    129f:	8d 43 18             	lea    0x18(%ebx),%eax
+    12a2:	50                   	push   %eax
+    12a3:	e8 98 f1 ff ff       	call   440 <mutex_lock>
+  if(!(f->flags & IO_SETUP))
+    12a8:	8b 43 04             	mov    0x4(%ebx),%eax
+    12ab:	83 c4 10             	add    $0x10,%esp
+    12ae:	e9 cd fe ff ff       	jmp    1180 <fwrite+0x30>
+    mutex_unlock(&f->lock);
+    12b3:	83 ec 0c             	sub    $0xc,%esp
+    12b6:	83 c3 18             	add    $0x18,%ebx
+    12b9:	53                   	push   %ebx
+    12ba:	e8 d1 f1 ff ff       	call   490 <mutex_unlock>
+    12bf:	83 c4 10             	add    $0x10,%esp
+    12c2:	eb b5                	jmp    1279 <fwrite+0x129>
+  for(len = size*nmemb; len > 0; len -= n){
+    12c4:	31 f6                	xor    %esi,%esi
+    12c6:	eb a8                	jmp    1270 <fwrite+0x120>
+    12c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12cf:	90                   	nop
+
+000012d0 <fgetc>:
+  return f->buf[f->r++] & 0xff;
+}
+
+int
+fgetc(FILE *f)
+{
+    12d0:	55                   	push   %ebp
+    12d1:	89 e5                	mov    %esp,%ebp
+    12d3:	56                   	push   %esi
+    12d4:	53                   	push   %ebx
+  if(threaded)
+    12d5:	8b 15 40 2a 00 00    	mov    0x2a40,%edx
+{
+    12db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    12de:	85 d2                	test   %edx,%edx
+    12e0:	75 2e                	jne    1310 <fgetc+0x40>
+  if(!(f->flags & IO_READ))
+    12e2:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    12e6:	74 78                	je     1360 <fgetc+0x90>
+  if(f->r == f->n && fill(f) == 0)
+    12e8:	8b 43 10             	mov    0x10(%ebx),%eax
+    12eb:	3b 43 14             	cmp    0x14(%ebx),%eax
+    12ee:	74 60                	je     1350 <fgetc+0x80>
+  return f->buf[f->r++] & 0xff;
+    12f0:	8b 53 08             	mov    0x8(%ebx),%edx
+    12f3:	8d 48 01             	lea    0x1(%eax),%ecx
+    12f6:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    12f9:	0f b6 34 02          	movzbl (%edx,%eax,1),%esi
+  if(threaded)
+    12fd:	a1 40 2a 00 00       	mov    0x2a40,%eax
+    1302:	85 c0                	test   %eax,%eax
+    1304:	75 2a                	jne    1330 <fgetc+0x60>
+
+  flockfile(f);
+  c = getc_unlocked(f);
+  funlockfile(f);
+  return c;
+}
+    1306:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1309:	89 f0                	mov    %esi,%eax
+    130b:	5b                   	pop    %ebx
+    130c:	5e                   	pop    %esi
+    130d:	5d                   	pop    %ebp
+    130e:	c3                   	ret
+    130f:	90                   	nop
+    mutex_lock(&f->lock);
+    1310:	83 ec 0c             	sub    $0xc,%esp
+    1313:	8d 43 18             	lea    0x18(%ebx),%eax
+    1316:	50                   	push   %eax
+    1317:	e8 24 f1 ff ff       	call   440 <mutex_lock>
+  if(!(f->flags & IO_READ))
+    131c:	83 c4 10             	add    $0x10,%esp
+    131f:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1323:	75 c3                	jne    12e8 <fgetc+0x18>
+    return EOF;
+    1325:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    132a:	eb d1                	jmp    12fd <fgetc+0x2d>
+    132c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1330:	83 ec 0c             	sub    $0xc,%esp
+    1333:	83 c3 18             	add    $0x18,%ebx
+    1336:	53                   	push   %ebx
+    1337:	e8 54 f1 ff ff       	call   490 <mutex_unlock>
+    133c:	83 c4 10             	add    $0x10,%esp
+}
+    133f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1342:	89 f0                	mov    %esi,%eax
+    1344:	5b                   	pop    %ebx
+    1345:	5e                   	pop    %esi
+    1346:	5d                   	pop    %ebp
+    1347:	c3                   	ret
+    1348:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    134f:	90                   	nop
+  if(f->r == f->n && fill(f) == 0)
+    1350:	89 d8                	mov    %ebx,%eax
+    1352:	e8 c9 f8 ff ff       	call   c20 <fill>
+    1357:	85 c0                	test   %eax,%eax
+    1359:	74 ca                	je     1325 <fgetc+0x55>
+  return f->buf[f->r++] & 0xff;
+    135b:	8b 43 10             	mov    0x10(%ebx),%eax
+    135e:	eb 90                	jmp    12f0 <fgetc+0x20>
+    return EOF;
+    1360:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    1365:	eb 9f                	jmp    1306 <fgetc+0x36>
+    1367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    136e:	66 90                	xchg   %ax,%ax
+
+00001370 <fread>:
+
+int
+fread(void *p, int size, int nmemb, FILE *f)
+{
+    1370:	55                   	push   %ebp
+    1371:	89 e5                	mov    %esp,%ebp
+    1373:	57                   	push   %edi
+    1374:	56                   	push   %esi
+    1375:	53                   	push   %ebx
+    1376:	83 ec 1c             	sub    $0x1c,%esp
+    1379:	8b 75 14             	mov    0x14(%ebp),%esi
+  char *d;
+  int n, len;
+
+  if(!(f->flags & IO_READ) || size <= 0)
+    137c:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+    1380:	74 7e                	je     1400 <fread+0x90>
+    1382:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1385:	85 d2                	test   %edx,%edx
+    1387:	7e 77                	jle    1400 <fread+0x90>
+  if(threaded)
+    1389:	a1 40 2a 00 00       	mov    0x2a40,%eax
+    return 0;
+  flockfile(f);
+  d = p;
+  for(len = size*nmemb; len > 0; len -= n){
+    138e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1391:	0f af 7d 10          	imul   0x10(%ebp),%edi
+  if(threaded)
+    1395:	85 c0                	test   %eax,%eax
+    1397:	0f 85 93 00 00 00    	jne    1430 <fread+0xc0>
+  for(len = size*nmemb; len > 0; len -= n){
+    139d:	85 ff                	test   %edi,%edi
+    139f:	7e 61                	jle    1402 <fread+0x92>
+    if(f->r == f->n && fill(f) == 0)
+    13a1:	8b 46 10             	mov    0x10(%esi),%eax
+  d = p;
+    13a4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    13a7:	eb 35                	jmp    13de <fread+0x6e>
+    13a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      break;
+    n = f->n - f->r;
+    13b0:	29 c3                	sub    %eax,%ebx
+    13b2:	39 fb                	cmp    %edi,%ebx
+    13b4:	0f 4f df             	cmovg  %edi,%ebx
+    if(n > len)
+      n = len;
+    memmove(d, f->buf + f->r, n);
+    13b7:	83 ec 04             	sub    $0x4,%esp
+    13ba:	53                   	push   %ebx
+    13bb:	03 46 08             	add    0x8(%esi),%eax
+  for(len = size*nmemb; len > 0; len -= n){
+    13be:	29 df                	sub    %ebx,%edi
+    memmove(d, f->buf + f->r, n);
+    13c0:	50                   	push   %eax
+    13c1:	51                   	push   %ecx
+    13c2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    13c5:	e8 36 f0 ff ff       	call   400 <memmove>
+    f->r += n;
+    13ca:	8b 46 10             	mov    0x10(%esi),%eax
+    d += n;
+    13cd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    13d0:	83 c4 10             	add    $0x10,%esp
+    f->r += n;
+    13d3:	01 d8                	add    %ebx,%eax
+    d += n;
+    13d5:	01 d9                	add    %ebx,%ecx
+    f->r += n;
+    13d7:	89 46 10             	mov    %eax,0x10(%esi)
+  for(len = size*nmemb; len > 0; len -= n){
+    13da:	85 ff                	test   %edi,%edi
+    13dc:	7e 32                	jle    1410 <fread+0xa0>
+    if(f->r == f->n && fill(f) == 0)
+    13de:	8b 5e 14             	mov    0x14(%esi),%ebx
+    13e1:	39 c3                	cmp    %eax,%ebx
+    13e3:	75 cb                	jne    13b0 <fread+0x40>
+    13e5:	89 f0                	mov    %esi,%eax
+    13e7:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    13ea:	e8 31 f8 ff ff       	call   c20 <fill>
+    13ef:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    13f2:	85 c0                	test   %eax,%eax
+    13f4:	74 1a                	je     1410 <fread+0xa0>
+    n = f->n - f->r;
+    13f6:	8b 5e 14             	mov    0x14(%esi),%ebx
+    13f9:	8b 46 10             	mov    0x10(%esi),%eax
+    13fc:	eb b2                	jmp    13b0 <fread+0x40>
+    13fe:	66 90                	xchg   %ax,%ax
+    return 0;
+    1400:	31 c0                	xor    %eax,%eax
+  }
+  funlockfile(f);
+  return (d - (char*)p) / size;
+}
+    1402:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1405:	5b                   	pop    %ebx
+    1406:	5e                   	pop    %esi
+    1407:	5f                   	pop    %edi
+    1408:	5d                   	pop    %ebp
+    1409:	c3                   	ret
+    140a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (d - (char*)p) / size;
+    1410:	2b 4d 08             	sub    0x8(%ebp),%ecx
+    1413:	89 cb                	mov    %ecx,%ebx
+  if(threaded)
+    1415:	a1 40 2a 00 00       	mov    0x2a40,%eax
+    141a:	85 c0                	test   %eax,%eax
+    141c:	75 32                	jne    1450 <fread+0xe0>
+  return (d - (char*)p) / size;
+    141e:	89 d8                	mov    %ebx,%eax
+    1420:	99                   	cltd
+    1421:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1424:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1427:	5b                   	pop    %ebx
+    1428:	5e                   	pop    %esi
+    1429:	5f                   	pop    %edi
+    142a:	5d                   	pop    %ebp
+    142b:	c3                   	ret
+    142c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    1430:	83 ec 0c             	sub    $0xc,%esp
+    1433:	8d 46 18             	lea    0x18(%esi),%eax
+    1436:	50                   	push   %eax
+    1437:	e8 04 f0 ff ff       	call   440 <mutex_lock>
+  for(len = size*nmemb; len > 0; len -= n){
+    143c:	83 c4 10             	add    $0x10,%esp
+    143f:	85 ff                	test   %edi,%edi
+    1441:	0f 8f 5a ff ff ff    	jg     13a1 <fread+0x31>
+    1447:	31 db                	xor    %ebx,%ebx
+    1449:	eb ca                	jmp    1415 <fread+0xa5>
+    144b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    144f:	90                   	nop
+    mutex_unlock(&f->lock);
+    1450:	83 ec 0c             	sub    $0xc,%esp
+    1453:	83 c6 18             	add    $0x18,%esi
+    1456:	56                   	push   %esi
+    1457:	e8 34 f0 ff ff       	call   490 <mutex_unlock>
+  return (d - (char*)p) / size;
+    145c:	89 d8                	mov    %ebx,%eax
+    145e:	83 c4 10             	add    $0x10,%esp
+    1461:	99                   	cltd
+    1462:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1465:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1468:	5b                   	pop    %ebx
+    1469:	5e                   	pop    %esi
+    146a:	5f                   	pop    %edi
+    146b:	5d                   	pop    %ebp
+    146c:	c3                   	ret
+    146d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001470 <fgets>:
+
+// Read a line of at most max-1 bytes, keeping the newline.
+// Returns 0 if there was nothing left to read.
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    1470:	55                   	push   %ebp
+    1471:	89 e5                	mov    %esp,%ebp
+    1473:	57                   	push   %edi
+    1474:	56                   	push   %esi
+    1475:	53                   	push   %ebx
+    1476:	83 ec 1c             	sub    $0x1c,%esp
+  if(threaded)
+    1479:	8b 35 40 2a 00 00    	mov    0x2a40,%esi
+{
+    147f:	8b 7d 08             	mov    0x8(%ebp),%edi
+    1482:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if(threaded)
+    1485:	85 f6                	test   %esi,%esi
+    1487:	0f 85 83 00 00 00    	jne    1510 <fgets+0xa0>
+{
+    148d:	31 f6                	xor    %esi,%esi
+    148f:	eb 2a                	jmp    14bb <fgets+0x4b>
+    1491:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return f->buf[f->r++] & 0xff;
+    1498:	8b 53 08             	mov    0x8(%ebx),%edx
+    149b:	8d 48 01             	lea    0x1(%eax),%ecx
+    149e:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    14a1:	0f b6 14 02          	movzbl (%edx,%eax,1),%edx
+
+  flockfile(f);
+  for(i = 0; i+1 < max; ){
+    if((c = getc_unlocked(f)) == EOF)
+      break;
+    buf[i++] = c;
+    14a5:	88 54 37 ff          	mov    %dl,-0x1(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    14a9:	80 fa 0a             	cmp    $0xa,%dl
+    14ac:	0f 84 96 00 00 00    	je     1548 <fgets+0xd8>
+    14b2:	83 fa 0d             	cmp    $0xd,%edx
+    14b5:	0f 84 8d 00 00 00    	je     1548 <fgets+0xd8>
+  for(i = 0; i+1 < max; ){
+    14bb:	89 f2                	mov    %esi,%edx
+    14bd:	83 c6 01             	add    $0x1,%esi
+    14c0:	3b 75 0c             	cmp    0xc(%ebp),%esi
+    14c3:	7d 2b                	jge    14f0 <fgets+0x80>
+  if(!(f->flags & IO_READ))
+    14c5:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    14c9:	74 25                	je     14f0 <fgets+0x80>
+  if(f->r == f->n && fill(f) == 0)
+    14cb:	8b 43 10             	mov    0x10(%ebx),%eax
+    14ce:	3b 43 14             	cmp    0x14(%ebx),%eax
+    14d1:	75 c5                	jne    1498 <fgets+0x28>
+    14d3:	89 d8                	mov    %ebx,%eax
+    14d5:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    14d8:	e8 43 f7 ff ff       	call   c20 <fill>
+    14dd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    14e0:	85 c0                	test   %eax,%eax
+    14e2:	74 0c                	je     14f0 <fgets+0x80>
+  return f->buf[f->r++] & 0xff;
+    14e4:	8b 43 10             	mov    0x10(%ebx),%eax
+    14e7:	eb af                	jmp    1498 <fgets+0x28>
+    14e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    14f0:	8b 0d 40 2a 00 00    	mov    0x2a40,%ecx
+      break;
+  }
+  buf[i] = '\0';
+    14f6:	c6 04 17 00          	movb   $0x0,(%edi,%edx,1)
+  if(threaded)
+    14fa:	85 c9                	test   %ecx,%ecx
+    14fc:	75 2a                	jne    1528 <fgets+0xb8>
+  funlockfile(f);
+  return i > 0 ? buf : 0;
+    14fe:	31 c0                	xor    %eax,%eax
+    1500:	85 d2                	test   %edx,%edx
+    1502:	74 02                	je     1506 <fgets+0x96>
+    1504:	89 f8                	mov    %edi,%eax
+}
+    1506:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1509:	5b                   	pop    %ebx
+    150a:	5e                   	pop    %esi
+    150b:	5f                   	pop    %edi
+    150c:	5d                   	pop    %ebp
+    150d:	c3                   	ret
+    150e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    1510:	83 ec 0c             	sub    $0xc,%esp
+    1513:	8d 43 18             	lea    0x18(%ebx),%eax
+    1516:	50                   	push   %eax
+    1517:	e8 24 ef ff ff       	call   440 <mutex_lock>
+    151c:	83 c4 10             	add    $0x10,%esp
+    151f:	e9 69 ff ff ff       	jmp    148d <fgets+0x1d>
+    1524:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1528:	83 ec 0c             	sub    $0xc,%esp
+    152b:	83 c3 18             	add    $0x18,%ebx
+    152e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1531:	53                   	push   %ebx
+    1532:	e8 59 ef ff ff       	call   490 <mutex_unlock>
+    1537:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    153a:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    153d:	31 c0                	xor    %eax,%eax
+    153f:	85 d2                	test   %edx,%edx
+    1541:	75 c1                	jne    1504 <fgets+0x94>
+    1543:	eb c1                	jmp    1506 <fgets+0x96>
+    1545:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1548:	a1 40 2a 00 00       	mov    0x2a40,%eax
+  buf[i] = '\0';
+    154d:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  if(threaded)
+    1551:	85 c0                	test   %eax,%eax
+    1553:	74 af                	je     1504 <fgets+0x94>
+    mutex_unlock(&f->lock);
+    1555:	83 ec 0c             	sub    $0xc,%esp
+    1558:	83 c3 18             	add    $0x18,%ebx
+    155b:	53                   	push   %ebx
+    155c:	e8 2f ef ff ff       	call   490 <mutex_unlock>
+    1561:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    1564:	89 f8                	mov    %edi,%eax
+    1566:	eb 9e                	jmp    1506 <fgets+0x96>
+    1568:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    156f:	90                   	nop
+
+00001570 <gets>:
+// at most a line per read(), goes through stdin's buffer: from a
+// file or pipe, a buffered read could take input meant for a child
+// process, so read a byte at a time.
+char*
+gets(char *buf, int max)
+{
+    1570:	55                   	push   %ebp
+    1571:	89 e5                	mov    %esp,%ebp
+    1573:	57                   	push   %edi
+    1574:	56                   	push   %esi
+    1575:	53                   	push   %ebx
+    1576:	83 ec 2c             	sub    $0x2c,%esp
+  int i, cc;
+  char c;
+
+  if(!(stdin->flags & IO_SETUP))
+    1579:	8b 15 44 29 00 00    	mov    0x2944,%edx
+{
+    157f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!(stdin->flags & IO_SETUP))
+    1582:	f6 c2 40             	test   $0x40,%dl
+    1585:	74 79                	je     1600 <gets+0x90>
+    setup(stdin);
+  if(stdin->flags & IO_DEV){
+    1587:	83 e2 20             	and    $0x20,%edx
+    158a:	89 d7                	mov    %edx,%edi
+    158c:	75 52                	jne    15e0 <gets+0x70>
+  if(f == 0){
+    158e:	e8 ed f5 ff ff       	call   b80 <fflush.part.0>
+    fgets(buf, max, stdin);
+    return buf;
+  }
+  fflush(0);
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1593:	8d 75 e7             	lea    -0x19(%ebp),%esi
+  for(i=0; i+1 < max; ){
+    1596:	eb 2c                	jmp    15c4 <gets+0x54>
+    1598:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    159f:	90                   	nop
+    cc = read(0, &c, 1);
+    15a0:	83 ec 04             	sub    $0x4,%esp
+    15a3:	6a 01                	push   $0x1
+    15a5:	56                   	push   %esi
+    15a6:	6a 00                	push   $0x0
+    15a8:	e8 f5 ef ff ff       	call   5a2 <read>
+    if(cc < 1)
+    15ad:	83 c4 10             	add    $0x10,%esp
+    15b0:	85 c0                	test   %eax,%eax
+    15b2:	7e 1b                	jle    15cf <gets+0x5f>
+      break;
+    buf[i++] = c;
+    15b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    15b8:	88 44 3b ff          	mov    %al,-0x1(%ebx,%edi,1)
+    if(c == '\n' || c == '\r')
+    15bc:	3c 0a                	cmp    $0xa,%al
+    15be:	74 12                	je     15d2 <gets+0x62>
+    15c0:	3c 0d                	cmp    $0xd,%al
+    15c2:	74 0e                	je     15d2 <gets+0x62>
+  for(i=0; i+1 < max; ){
+    15c4:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    15c7:	83 c7 01             	add    $0x1,%edi
+    15ca:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+    15cd:	7c d1                	jl     15a0 <gets+0x30>
+{
+    15cf:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      break;
+  }
+  buf[i] = '\0';
+    15d2:	c6 04 3b 00          	movb   $0x0,(%ebx,%edi,1)
+  return buf;
+}
+    15d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15d9:	89 d8                	mov    %ebx,%eax
+    15db:	5b                   	pop    %ebx
+    15dc:	5e                   	pop    %esi
+    15dd:	5f                   	pop    %edi
+    15de:	5d                   	pop    %ebp
+    15df:	c3                   	ret
+    fgets(buf, max, stdin);
+    15e0:	83 ec 04             	sub    $0x4,%esp
+    15e3:	68 40 29 00 00       	push   $0x2940
+    15e8:	ff 75 0c             	push   0xc(%ebp)
+    15eb:	53                   	push   %ebx
+    15ec:	e8 7f fe ff ff       	call   1470 <fgets>
+    return buf;
+    15f1:	83 c4 10             	add    $0x10,%esp
+}
+    15f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15f7:	89 d8                	mov    %ebx,%eax
+    15f9:	5b                   	pop    %ebx
+    15fa:	5e                   	pop    %esi
+    15fb:	5f                   	pop    %edi
+    15fc:	5d                   	pop    %ebp
+    15fd:	c3                   	ret
+    15fe:	66 90                	xchg   %ax,%ax
+    setup(stdin);
+    1600:	b8 40 29 00 00       	mov    $0x2940,%eax
+    1605:	e8 a6 f4 ff ff       	call   ab0 <setup>
+  if(stdin->flags & IO_DEV){
+    160a:	8b 15 44 29 00 00    	mov    0x2944,%edx
+    1610:	e9 72 ff ff ff       	jmp    1587 <gets+0x17>
+    1615:	66 90                	xchg   %ax,%ax
+    1617:	66 90                	xchg   %ax,%ax
+    1619:	66 90                	xchg   %ax,%ax
+    161b:	66 90                	xchg   %ax,%ax
+    161d:	66 90                	xchg   %ax,%ax
+    161f:	90                   	nop
+
+00001620 <bigfree>:
+
+// Give a big block back to the first-fit list, and return the
+// free block that now holds it. Caller holds lock.
+static Header*
+bigfree(Header *bp)
+{
+    1620:	55                   	push   %ebp
+    1621:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1623:	a1 e4 30 00 00       	mov    0x30e4,%eax
+{
+    1628:	89 e5                	mov    %esp,%ebp
+    162a:	56                   	push   %esi
+    162b:	53                   	push   %ebx
+    162c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1630:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1632:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1634:	39 ca                	cmp    %ecx,%edx
+    1636:	73 38                	jae    1670 <bigfree+0x50>
+    1638:	39 c1                	cmp    %eax,%ecx
+    163a:	72 04                	jb     1640 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    163c:	39 c2                	cmp    %eax,%edx
+    163e:	72 f0                	jb     1630 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1640:	8b 59 04             	mov    0x4(%ecx),%ebx
+    1643:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    1646:	39 f0                	cmp    %esi,%eax
+    1648:	74 36                	je     1680 <bigfree+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    164a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  freep = p;
+  if(p + p->s.size == bp){
+    164c:	8b 42 04             	mov    0x4(%edx),%eax
+    164f:	89 cb                	mov    %ecx,%ebx
+  freep = p;
+    1651:	89 15 e4 30 00 00    	mov    %edx,0x30e4
+  if(p + p->s.size == bp){
+    1657:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    165a:	39 f1                	cmp    %esi,%ecx
+    165c:	74 2e                	je     168c <bigfree+0x6c>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    165e:	89 1a                	mov    %ebx,(%edx)
+    return p;
+  }
+  p->s.ptr = bp;
+  return bp;
+}
+    1660:	89 c8                	mov    %ecx,%eax
+    1662:	5b                   	pop    %ebx
+    1663:	5e                   	pop    %esi
+    1664:	5d                   	pop    %ebp
+    1665:	c3                   	ret
+    1666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    166d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1670:	39 c1                	cmp    %eax,%ecx
+    1672:	72 c8                	jb     163c <bigfree+0x1c>
+    1674:	eb ba                	jmp    1630 <bigfree+0x10>
+    1676:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    167d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1680:	03 58 04             	add    0x4(%eax),%ebx
+    1683:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1686:	8b 02                	mov    (%edx),%eax
+    1688:	8b 00                	mov    (%eax),%eax
+    168a:	eb be                	jmp    164a <bigfree+0x2a>
+    p->s.size += bp->s.size;
+    168c:	03 41 04             	add    0x4(%ecx),%eax
+    168f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1692:	8b 19                	mov    (%ecx),%ebx
+    return p;
+    1694:	89 d1                	mov    %edx,%ecx
+}
+    1696:	89 c8                	mov    %ecx,%eax
+    p->s.ptr = bp->s.ptr;
+    1698:	89 1a                	mov    %ebx,(%edx)
+}
+    169a:	5b                   	pop    %ebx
+    169b:	5e                   	pop    %esi
+    169c:	5d                   	pop    %ebp
+    169d:	c3                   	ret
+    169e:	66 90                	xchg   %ax,%ax
+
+000016a0 <trim>:
+// If free block bp ends the heap, return its whole pages to the
+// kernel, unless something else has moved the break since.
+// Caller holds lock.
+static void
+trim(Header *bp)
+{
+    16a0:	55                   	push   %ebp
+    16a1:	89 e5                	mov    %esp,%ebp
+    16a3:	57                   	push   %edi
+    16a4:	56                   	push   %esi
+    16a5:	53                   	push   %ebx
+    16a6:	89 c3                	mov    %eax,%ebx
+    16a8:	83 ec 0c             	sub    $0xc,%esp
+  char *end;
+  uint n;
+
+  if((char*)(bp + bp->s.size) != heapend)
+    16ab:	8b 53 04             	mov    0x4(%ebx),%edx
+    16ae:	a1 e0 30 00 00       	mov    0x30e0,%eax
+    16b3:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+    16b6:	39 d0                	cmp    %edx,%eax
+    16b8:	74 0e                	je     16c8 <trim+0x28>
+  n = heapend - end;
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    bp->s.size -= n / sizeof(Header);
+    heapend = end;
+  }
+}
+    16ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    16bd:	5b                   	pop    %ebx
+    16be:	5e                   	pop    %esi
+    16bf:	5f                   	pop    %edi
+    16c0:	5d                   	pop    %ebp
+    16c1:	c3                   	ret
+    16c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  end = (char*)PGROUNDUP((uint)(bp + 2));
+    16c8:	8d bb 0f 10 00 00    	lea    0x100f(%ebx),%edi
+    16ce:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  n = heapend - end;
+    16d4:	29 f8                	sub    %edi,%eax
+    16d6:	89 c6                	mov    %eax,%esi
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    16d8:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    16dd:	76 db                	jbe    16ba <trim+0x1a>
+    16df:	83 ec 0c             	sub    $0xc,%esp
+    16e2:	6a 00                	push   $0x0
+    16e4:	e8 8b ef ff ff       	call   674 <sbrk>
+    16e9:	83 c4 10             	add    $0x10,%esp
+    16ec:	39 05 e0 30 00 00    	cmp    %eax,0x30e0
+    16f2:	75 c6                	jne    16ba <trim+0x1a>
+    16f4:	89 f0                	mov    %esi,%eax
+    16f6:	83 ec 0c             	sub    $0xc,%esp
+    16f9:	f7 d8                	neg    %eax
+    16fb:	50                   	push   %eax
+    16fc:	e8 73 ef ff ff       	call   674 <sbrk>
+    1701:	83 c4 10             	add    $0x10,%esp
+    1704:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1707:	74 b1                	je     16ba <trim+0x1a>
+    bp->s.size -= n / sizeof(Header);
+    1709:	89 f0                	mov    %esi,%eax
+    heapend = end;
+    170b:	89 3d e0 30 00 00    	mov    %edi,0x30e0
+    bp->s.size -= n / sizeof(Header);
+    1711:	c1 e8 03             	shr    $0x3,%eax
+    1714:	29 43 04             	sub    %eax,0x4(%ebx)
+    heapend = end;
+    1717:	eb a1                	jmp    16ba <trim+0x1a>
+    1719:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001720 <bigalloc>:
+}
+
+// Allocate a big block of nunits units. Caller holds lock.
+static Header*
+bigalloc(uint nunits)
+{
+    1720:	55                   	push   %ebp
+    1721:	89 e5                	mov    %esp,%ebp
+    1723:	57                   	push   %edi
+    1724:	89 c7                	mov    %eax,%edi
+    1726:	56                   	push   %esi
+    1727:	53                   	push   %ebx
+    1728:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    172b:	a1 e4 30 00 00       	mov    0x30e4,%eax
+    1730:	85 c0                	test   %eax,%eax
+    1732:	0f 84 98 00 00 00    	je     17d0 <bigalloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1738:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    173a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    173d:	39 f9                	cmp    %edi,%ecx
+    173f:	73 67                	jae    17a8 <bigalloc+0x88>
+  if(nu < 4096)
+    1741:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1746:	39 df                	cmp    %ebx,%edi
+    1748:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    174b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    1752:	eb 0d                	jmp    1761 <bigalloc+0x41>
+    1754:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1758:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    175a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    175d:	39 f9                	cmp    %edi,%ecx
+    175f:	73 47                	jae    17a8 <bigalloc+0x88>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    1761:	89 d0                	mov    %edx,%eax
+    1763:	39 15 e4 30 00 00    	cmp    %edx,0x30e4
+    1769:	75 ed                	jne    1758 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    176b:	83 ec 0c             	sub    $0xc,%esp
+    176e:	56                   	push   %esi
+    176f:	e8 00 ef ff ff       	call   674 <sbrk>
+  if(p == (char*)-1)
+    1774:	83 c4 10             	add    $0x10,%esp
+    1777:	83 f8 ff             	cmp    $0xffffffff,%eax
+    177a:	74 1a                	je     1796 <bigalloc+0x76>
+  hp->s.size = nu;
+    177c:	89 58 04             	mov    %ebx,0x4(%eax)
+  heapend = p + nu * sizeof(Header);
+    177f:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    1782:	89 15 e0 30 00 00    	mov    %edx,0x30e0
+  bigfree(hp);
+    1788:	e8 93 fe ff ff       	call   1620 <bigfree>
+  return freep;
+    178d:	a1 e4 30 00 00       	mov    0x30e4,%eax
+      if((p = morecore(nunits)) == 0)
+    1792:	85 c0                	test   %eax,%eax
+    1794:	75 c2                	jne    1758 <bigalloc+0x38>
+        return 0;
+  }
+}
+    1796:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1799:	31 d2                	xor    %edx,%edx
+}
+    179b:	5b                   	pop    %ebx
+    179c:	89 d0                	mov    %edx,%eax
+    179e:	5e                   	pop    %esi
+    179f:	5f                   	pop    %edi
+    17a0:	5d                   	pop    %ebp
+    17a1:	c3                   	ret
+    17a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    17a8:	39 cf                	cmp    %ecx,%edi
+    17aa:	74 54                	je     1800 <bigalloc+0xe0>
+        p->s.size -= nunits;
+    17ac:	29 f9                	sub    %edi,%ecx
+    17ae:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    17b1:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    17b4:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    17b7:	a3 e4 30 00 00       	mov    %eax,0x30e4
+}
+    17bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    17bf:	89 d0                	mov    %edx,%eax
+    17c1:	5b                   	pop    %ebx
+    17c2:	5e                   	pop    %esi
+    17c3:	5f                   	pop    %edi
+    17c4:	5d                   	pop    %ebp
+    17c5:	c3                   	ret
+    17c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17cd:	8d 76 00             	lea    0x0(%esi),%esi
+    base.s.ptr = freep = prevp = &base;
+    17d0:	c7 05 e4 30 00 00 e8 	movl   $0x30e8,0x30e4
+    17d7:	30 00 00 
+    base.s.size = 0;
+    17da:	ba e8 30 00 00       	mov    $0x30e8,%edx
+    base.s.ptr = freep = prevp = &base;
+    17df:	c7 05 e8 30 00 00 e8 	movl   $0x30e8,0x30e8
+    17e6:	30 00 00 
+    base.s.size = 0;
+    17e9:	c7 05 ec 30 00 00 00 	movl   $0x0,0x30ec
+    17f0:	00 00 00 
+    if(p->s.size >= nunits){
+    17f3:	e9 49 ff ff ff       	jmp    1741 <bigalloc+0x21>
+    17f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17ff:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1800:	8b 0a                	mov    (%edx),%ecx
+    1802:	89 08                	mov    %ecx,(%eax)
+    1804:	eb b1                	jmp    17b7 <bigalloc+0x97>
+    1806:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    180d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001810 <drain>:
+}
+
+// Move n blocks of class c from cache tc to the shared list.
+static void
+drain(struct tcache *tc, int c, int n)
+{
+    1810:	55                   	push   %ebp
+    1811:	89 e5                	mov    %esp,%ebp
+    1813:	57                   	push   %edi
+    1814:	89 c7                	mov    %eax,%edi
+    1816:	56                   	push   %esi
+    1817:	89 d6                	mov    %edx,%esi
+    1819:	53                   	push   %ebx
+    181a:	89 cb                	mov    %ecx,%ebx
+    181c:	83 ec 0c             	sub    $0xc,%esp
+  if(threaded)
+    181f:	8b 15 64 30 00 00    	mov    0x3064,%edx
+    1825:	85 d2                	test   %edx,%edx
+    1827:	75 57                	jne    1880 <drain+0x70>
+  Header *p;
+
+  acquire();
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1829:	85 c9                	test   %ecx,%ecx
+    182b:	7e 49                	jle    1876 <drain+0x66>
+    182d:	89 d9                	mov    %ebx,%ecx
+    182f:	8d 14 b7             	lea    (%edi,%esi,4),%edx
+    1832:	eb 23                	jmp    1857 <drain+0x47>
+    1834:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    tc->list[c] = p->s.ptr;
+    1838:	8b 18                	mov    (%eax),%ebx
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    183a:	83 e9 01             	sub    $0x1,%ecx
+    tc->n[c]--;
+    183d:	83 6a 20 01          	subl   $0x1,0x20(%edx)
+    tc->list[c] = p->s.ptr;
+    1841:	89 1a                	mov    %ebx,(%edx)
+    p->s.ptr = small[c];
+    1843:	8b 1c b5 c0 30 00 00 	mov    0x30c0(,%esi,4),%ebx
+    184a:	89 18                	mov    %ebx,(%eax)
+    small[c] = p;
+    184c:	89 04 b5 c0 30 00 00 	mov    %eax,0x30c0(,%esi,4)
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1853:	85 c9                	test   %ecx,%ecx
+    1855:	7e 06                	jle    185d <drain+0x4d>
+    1857:	8b 02                	mov    (%edx),%eax
+    1859:	85 c0                	test   %eax,%eax
+    185b:	75 db                	jne    1838 <drain+0x28>
+  if(threaded)
+    185d:	a1 64 30 00 00       	mov    0x3064,%eax
+    1862:	85 c0                	test   %eax,%eax
+    1864:	74 10                	je     1876 <drain+0x66>
+    mutex_unlock(&lock);
+    1866:	83 ec 0c             	sub    $0xc,%esp
+    1869:	68 68 30 00 00       	push   $0x3068
+    186e:	e8 1d ec ff ff       	call   490 <mutex_unlock>
+}
+    1873:	83 c4 10             	add    $0x10,%esp
+  }
+  release();
+}
+    1876:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1879:	5b                   	pop    %ebx
+    187a:	5e                   	pop    %esi
+    187b:	5f                   	pop    %edi
+    187c:	5d                   	pop    %ebp
+    187d:	c3                   	ret
+    187e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&lock);
+    1880:	83 ec 0c             	sub    $0xc,%esp
+    1883:	68 68 30 00 00       	push   $0x3068
+    1888:	e8 b3 eb ff ff       	call   440 <mutex_lock>
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    188d:	83 c4 10             	add    $0x10,%esp
+    1890:	85 db                	test   %ebx,%ebx
+    1892:	7f 99                	jg     182d <drain+0x1d>
+    1894:	eb c7                	jmp    185d <drain+0x4d>
+    1896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    189d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000018a0 <mycache>:
+{
+    18a0:	55                   	push   %ebp
+    return &maincache;
+    18a1:	b8 80 30 00 00       	mov    $0x3080,%eax
+{
+    18a6:	89 e5                	mov    %esp,%ebp
+    18a8:	53                   	push   %ebx
+  sp = PGROUNDDOWN((uint)&sp);
+    18a9:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+    18ac:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+    18b2:	83 ec 14             	sub    $0x14,%esp
+  if(!threaded || sp == mainstack)
+    18b5:	8b 0d 64 30 00 00    	mov    0x3064,%ecx
+  sp = PGROUNDDOWN((uint)&sp);
+    18bb:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  if(!threaded || sp == mainstack)
+    18be:	85 c9                	test   %ecx,%ecx
+    18c0:	74 0f                	je     18d1 <mycache+0x31>
+    18c2:	3b 1d 60 30 00 00    	cmp    0x3060,%ebx
+    18c8:	74 07                	je     18d1 <mycache+0x31>
+  if(*cp == 0){
+    18ca:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    18cd:	85 c0                	test   %eax,%eax
+    18cf:	74 0f                	je     18e0 <mycache+0x40>
+}
+    18d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    18d4:	c9                   	leave
+    18d5:	c3                   	ret
+    18d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18dd:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    18e0:	83 ec 0c             	sub    $0xc,%esp
+    18e3:	68 68 30 00 00       	push   $0x3068
+    18e8:	e8 53 eb ff ff       	call   440 <mutex_lock>
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    18ed:	b8 09 00 00 00       	mov    $0x9,%eax
+    18f2:	e8 29 fe ff ff       	call   1720 <bigalloc>
+  if(threaded)
+    18f7:	8b 15 64 30 00 00    	mov    0x3064,%edx
+    18fd:	83 c4 10             	add    $0x10,%esp
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    1900:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(threaded)
+    1903:	85 d2                	test   %edx,%edx
+    1905:	75 29                	jne    1930 <mycache+0x90>
+    if(*cp == 0)
+    1907:	85 c0                	test   %eax,%eax
+    1909:	74 c6                	je     18d1 <mycache+0x31>
+    memset(*cp, 0, sizeof(**cp));
+    190b:	83 ec 04             	sub    $0x4,%esp
+    *cp = (struct tcache*)((Header*)*cp + 1);
+    190e:	83 c0 08             	add    $0x8,%eax
+    1911:	89 43 f8             	mov    %eax,-0x8(%ebx)
+    memset(*cp, 0, sizeof(**cp));
+    1914:	6a 40                	push   $0x40
+    1916:	6a 00                	push   $0x0
+    1918:	50                   	push   %eax
+    1919:	e8 f2 e9 ff ff       	call   310 <memset>
+  return *cp;
+    191e:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    1921:	83 c4 10             	add    $0x10,%esp
+    1924:	eb ab                	jmp    18d1 <mycache+0x31>
+    1926:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    192d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1930:	83 ec 0c             	sub    $0xc,%esp
+    1933:	68 68 30 00 00       	push   $0x3068
+    1938:	e8 53 eb ff ff       	call   490 <mutex_unlock>
+    if(*cp == 0)
+    193d:	8b 43 f8             	mov    -0x8(%ebx),%eax
+}
+    1940:	83 c4 10             	add    $0x10,%esp
+    1943:	eb c2                	jmp    1907 <mycache+0x67>
+    1945:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    194c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001950 <free>:
+
+void
+free(void *ap)
+{
+    1950:	55                   	push   %ebp
+    1951:	89 e5                	mov    %esp,%ebp
+    1953:	57                   	push   %edi
+    1954:	56                   	push   %esi
+    1955:	53                   	push   %ebx
+    1956:	83 ec 1c             	sub    $0x1c,%esp
+    1959:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  struct tcache *tc;
+  int c;
+
+  if(ap == 0)
+    195c:	85 f6                	test   %esi,%esi
+    195e:	74 51                	je     19b1 <free+0x61>
+    return;
+  bp = (Header*)ap - 1;
+    1960:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1963:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(bp->s.size > SMALLMAX / sizeof(Header)){
+    1966:	8b 46 fc             	mov    -0x4(%esi),%eax
+    1969:	3d 00 01 00 00       	cmp    $0x100,%eax
+    196e:	77 50                	ja     19c0 <free+0x70>
+    acquire();
+    trim(bigfree(bp));
+    release();
+    return;
+  }
+  for(c = 0; (2 << c) < bp->s.size; c++)
+    1970:	31 db                	xor    %ebx,%ebx
+    1972:	ba 02 00 00 00       	mov    $0x2,%edx
+    1977:	83 f8 02             	cmp    $0x2,%eax
+    197a:	76 11                	jbe    198d <free+0x3d>
+    197c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1980:	83 c3 01             	add    $0x1,%ebx
+    1983:	89 d7                	mov    %edx,%edi
+    1985:	89 d9                	mov    %ebx,%ecx
+    1987:	d3 e7                	shl    %cl,%edi
+    1989:	39 c7                	cmp    %eax,%edi
+    198b:	72 f3                	jb     1980 <free+0x30>
+    ;
+  if((tc = mycache()) == 0){
+    198d:	e8 0e ff ff ff       	call   18a0 <mycache>
+    1992:	85 c0                	test   %eax,%eax
+    1994:	74 7a                	je     1a10 <free+0xc0>
+    bp->s.ptr = small[c];
+    small[c] = bp;
+    release();
+    return;
+  }
+  bp->s.ptr = tc->list[c];
+    1996:	8d 0c 98             	lea    (%eax,%ebx,4),%ecx
+    1999:	8b 11                	mov    (%ecx),%edx
+    199b:	89 56 f8             	mov    %edx,-0x8(%esi)
+  tc->list[c] = bp;
+    199e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    19a1:	89 31                	mov    %esi,(%ecx)
+  if(++tc->n[c] > TCACHEMAX)
+    19a3:	8b 71 20             	mov    0x20(%ecx),%esi
+    19a6:	8d 56 01             	lea    0x1(%esi),%edx
+    19a9:	89 51 20             	mov    %edx,0x20(%ecx)
+    19ac:	83 fa 20             	cmp    $0x20,%edx
+    19af:	7f 47                	jg     19f8 <free+0xa8>
+    drain(tc, c, BATCH);
+}
+    19b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19b4:	5b                   	pop    %ebx
+    19b5:	5e                   	pop    %esi
+    19b6:	5f                   	pop    %edi
+    19b7:	5d                   	pop    %ebp
+    19b8:	c3                   	ret
+    19b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    19c0:	8b 1d 64 30 00 00    	mov    0x3064,%ebx
+    19c6:	85 db                	test   %ebx,%ebx
+    19c8:	75 66                	jne    1a30 <free+0xe0>
+    trim(bigfree(bp));
+    19ca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    19cd:	e8 4e fc ff ff       	call   1620 <bigfree>
+    19d2:	e8 c9 fc ff ff       	call   16a0 <trim>
+  if(threaded)
+    19d7:	8b 0d 64 30 00 00    	mov    0x3064,%ecx
+    19dd:	85 c9                	test   %ecx,%ecx
+    19df:	74 d0                	je     19b1 <free+0x61>
+    mutex_unlock(&lock);
+    19e1:	c7 45 08 68 30 00 00 	movl   $0x3068,0x8(%ebp)
+}
+    19e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19eb:	5b                   	pop    %ebx
+    19ec:	5e                   	pop    %esi
+    19ed:	5f                   	pop    %edi
+    19ee:	5d                   	pop    %ebp
+    mutex_unlock(&lock);
+    19ef:	e9 9c ea ff ff       	jmp    490 <mutex_unlock>
+    19f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    19f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    drain(tc, c, BATCH);
+    19fb:	89 da                	mov    %ebx,%edx
+    19fd:	b9 10 00 00 00       	mov    $0x10,%ecx
+}
+    1a02:	5b                   	pop    %ebx
+    1a03:	5e                   	pop    %esi
+    1a04:	5f                   	pop    %edi
+    1a05:	5d                   	pop    %ebp
+    drain(tc, c, BATCH);
+    1a06:	e9 05 fe ff ff       	jmp    1810 <drain>
+    1a0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1a0f:	90                   	nop
+  if(threaded)
+    1a10:	8b 15 64 30 00 00    	mov    0x3064,%edx
+    1a16:	85 d2                	test   %edx,%edx
+    1a18:	75 28                	jne    1a42 <free+0xf2>
+    bp->s.ptr = small[c];
+    1a1a:	8b 04 9d c0 30 00 00 	mov    0x30c0(,%ebx,4),%eax
+    1a21:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1a24:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1a27:	89 04 9d c0 30 00 00 	mov    %eax,0x30c0(,%ebx,4)
+  if(threaded)
+    1a2e:	eb 81                	jmp    19b1 <free+0x61>
+    mutex_lock(&lock);
+    1a30:	83 ec 0c             	sub    $0xc,%esp
+    1a33:	68 68 30 00 00       	push   $0x3068
+    1a38:	e8 03 ea ff ff       	call   440 <mutex_lock>
+}
+    1a3d:	83 c4 10             	add    $0x10,%esp
+    1a40:	eb 88                	jmp    19ca <free+0x7a>
+    mutex_lock(&lock);
+    1a42:	83 ec 0c             	sub    $0xc,%esp
+    1a45:	68 68 30 00 00       	push   $0x3068
+    1a4a:	e8 f1 e9 ff ff       	call   440 <mutex_lock>
+    bp->s.ptr = small[c];
+    1a4f:	8b 04 9d c0 30 00 00 	mov    0x30c0(,%ebx,4),%eax
+  if(threaded)
+    1a56:	83 c4 10             	add    $0x10,%esp
+    bp->s.ptr = small[c];
+    1a59:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1a5c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1a5f:	89 04 9d c0 30 00 00 	mov    %eax,0x30c0(,%ebx,4)
+  if(threaded)
+    1a66:	a1 64 30 00 00       	mov    0x3064,%eax
+    1a6b:	85 c0                	test   %eax,%eax
+    1a6d:	0f 85 6e ff ff ff    	jne    19e1 <free+0x91>
+    1a73:	e9 39 ff ff ff       	jmp    19b1 <free+0x61>
+    1a78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a7f:	90                   	nop
+
+00001a80 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1a80:	55                   	push   %ebp
+    1a81:	89 e5                	mov    %esp,%ebp
+    1a83:	57                   	push   %edi
+    1a84:	56                   	push   %esi
+    1a85:	53                   	push   %ebx
+    1a86:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  struct tcache *tc;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1a89:	8b 45 08             	mov    0x8(%ebp),%eax
+    1a8c:	8d 78 07             	lea    0x7(%eax),%edi
+    1a8f:	c1 ef 03             	shr    $0x3,%edi
+    1a92:	83 c7 01             	add    $0x1,%edi
+  if(nunits > SMALLMAX / sizeof(Header)){
+    1a95:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+    1a9b:	77 5b                	ja     1af8 <malloc+0x78>
+    acquire();
+    p = bigalloc(nunits);
+    release();
+    return p ? (void*)(p + 1) : 0;
+  }
+  for(c = 0; (2 << c) < nunits; c++)
+    1a9d:	31 c9                	xor    %ecx,%ecx
+    1a9f:	b8 02 00 00 00       	mov    $0x2,%eax
+    1aa4:	be 02 00 00 00       	mov    $0x2,%esi
+    1aa9:	bb 02 00 00 00       	mov    $0x2,%ebx
+    1aae:	83 ff 02             	cmp    $0x2,%edi
+    1ab1:	76 12                	jbe    1ac5 <malloc+0x45>
+    1ab3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1ab7:	90                   	nop
+    1ab8:	83 c1 01             	add    $0x1,%ecx
+    1abb:	89 c3                	mov    %eax,%ebx
+    1abd:	d3 e3                	shl    %cl,%ebx
+    1abf:	89 de                	mov    %ebx,%esi
+    1ac1:	39 fb                	cmp    %edi,%ebx
+    1ac3:	72 f3                	jb     1ab8 <malloc+0x38>
+    1ac5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    ;
+  if((tc = mycache()) == 0)
+    1ac8:	e8 d3 fd ff ff       	call   18a0 <mycache>
+    1acd:	85 c0                	test   %eax,%eax
+    1acf:	74 51                	je     1b22 <malloc+0xa2>
+    return 0;
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1ad1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1ad4:	8d 3c 88             	lea    (%eax,%ecx,4),%edi
+    1ad7:	8b 07                	mov    (%edi),%eax
+    1ad9:	85 c0                	test   %eax,%eax
+    1adb:	74 53                	je     1b30 <malloc+0xb0>
+    return 0;
+  p = tc->list[c];
+  tc->list[c] = p->s.ptr;
+  tc->n[c]--;
+    1add:	8b 57 20             	mov    0x20(%edi),%edx
+  tc->list[c] = p->s.ptr;
+    1ae0:	8b 08                	mov    (%eax),%ecx
+  tc->n[c]--;
+    1ae2:	83 ea 01             	sub    $0x1,%edx
+  return (void*)(p + 1);
+    1ae5:	83 c0 08             	add    $0x8,%eax
+  tc->n[c]--;
+    1ae8:	89 57 20             	mov    %edx,0x20(%edi)
+  tc->list[c] = p->s.ptr;
+    1aeb:	89 0f                	mov    %ecx,(%edi)
+}
+    1aed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1af0:	5b                   	pop    %ebx
+    1af1:	5e                   	pop    %esi
+    1af2:	5f                   	pop    %edi
+    1af3:	5d                   	pop    %ebp
+    1af4:	c3                   	ret
+    1af5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1af8:	a1 64 30 00 00       	mov    0x3064,%eax
+    1afd:	85 c0                	test   %eax,%eax
+    1aff:	0f 85 b3 00 00 00    	jne    1bb8 <malloc+0x138>
+    p = bigalloc(nunits);
+    1b05:	89 f8                	mov    %edi,%eax
+    1b07:	e8 14 fc ff ff       	call   1720 <bigalloc>
+    1b0c:	89 c3                	mov    %eax,%ebx
+  if(threaded)
+    1b0e:	a1 64 30 00 00       	mov    0x3064,%eax
+    1b13:	85 c0                	test   %eax,%eax
+    1b15:	0f 85 85 00 00 00    	jne    1ba0 <malloc+0x120>
+    return p ? (void*)(p + 1) : 0;
+    1b1b:	8d 43 08             	lea    0x8(%ebx),%eax
+    1b1e:	85 db                	test   %ebx,%ebx
+    1b20:	75 cb                	jne    1aed <malloc+0x6d>
+    1b22:	31 c0                	xor    %eax,%eax
+}
+    1b24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b27:	5b                   	pop    %ebx
+    1b28:	5e                   	pop    %esi
+    1b29:	5f                   	pop    %edi
+    1b2a:	5d                   	pop    %ebp
+    1b2b:	c3                   	ret
+    1b2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1b30:	a1 64 30 00 00       	mov    0x3064,%eax
+    1b35:	85 c0                	test   %eax,%eax
+    1b37:	0f 85 29 01 00 00    	jne    1c66 <malloc+0x1e6>
+  if(small[c] == 0){
+    1b3d:	8b 04 8d c0 30 00 00 	mov    0x30c0(,%ecx,4),%eax
+    1b44:	85 c0                	test   %eax,%eax
+    1b46:	0f 84 81 00 00 00    	je     1bcd <malloc+0x14d>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1b4c:	31 db                	xor    %ebx,%ebx
+    1b4e:	eb 22                	jmp    1b72 <malloc+0xf2>
+    small[c] = p->s.ptr;
+    1b50:	8b 10                	mov    (%eax),%edx
+  for(moved = 0; moved < n && small[c]; moved++){
+    1b52:	83 c3 01             	add    $0x1,%ebx
+    small[c] = p->s.ptr;
+    1b55:	89 14 8d c0 30 00 00 	mov    %edx,0x30c0(,%ecx,4)
+    p->s.ptr = tc->list[c];
+    1b5c:	8b 17                	mov    (%edi),%edx
+    1b5e:	89 10                	mov    %edx,(%eax)
+    tc->list[c] = p;
+    1b60:	89 07                	mov    %eax,(%edi)
+  for(moved = 0; moved < n && small[c]; moved++){
+    1b62:	83 fb 10             	cmp    $0x10,%ebx
+    1b65:	0f 84 e2 00 00 00    	je     1c4d <malloc+0x1cd>
+    1b6b:	8b 04 8d c0 30 00 00 	mov    0x30c0(,%ecx,4),%eax
+    1b72:	85 c0                	test   %eax,%eax
+    1b74:	75 da                	jne    1b50 <malloc+0xd0>
+  if(threaded)
+    1b76:	8b 15 64 30 00 00    	mov    0x3064,%edx
+    1b7c:	85 d2                	test   %edx,%edx
+    1b7e:	0f 85 b4 00 00 00    	jne    1c38 <malloc+0x1b8>
+  tc->n[c] += moved;
+    1b84:	8b 57 20             	mov    0x20(%edi),%edx
+    1b87:	01 da                	add    %ebx,%edx
+    1b89:	89 57 20             	mov    %edx,0x20(%edi)
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1b8c:	85 db                	test   %ebx,%ebx
+    1b8e:	74 92                	je     1b22 <malloc+0xa2>
+  p = tc->list[c];
+    1b90:	8b 07                	mov    (%edi),%eax
+    1b92:	e9 49 ff ff ff       	jmp    1ae0 <malloc+0x60>
+    1b97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b9e:	66 90                	xchg   %ax,%ax
+    mutex_unlock(&lock);
+    1ba0:	83 ec 0c             	sub    $0xc,%esp
+    1ba3:	68 68 30 00 00       	push   $0x3068
+    1ba8:	e8 e3 e8 ff ff       	call   490 <mutex_unlock>
+}
+    1bad:	83 c4 10             	add    $0x10,%esp
+    1bb0:	e9 66 ff ff ff       	jmp    1b1b <malloc+0x9b>
+    1bb5:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1bb8:	83 ec 0c             	sub    $0xc,%esp
+    1bbb:	68 68 30 00 00       	push   $0x3068
+    1bc0:	e8 7b e8 ff ff       	call   440 <mutex_lock>
+}
+    1bc5:	83 c4 10             	add    $0x10,%esp
+    1bc8:	e9 38 ff ff ff       	jmp    1b05 <malloc+0x85>
+    if((chunk = bigalloc(CHUNK / sizeof(Header) + 1)) == 0){
+    1bcd:	b8 01 02 00 00       	mov    $0x201,%eax
+    1bd2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1bd5:	e8 46 fb ff ff       	call   1720 <bigalloc>
+    1bda:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1bdd:	85 c0                	test   %eax,%eax
+    1bdf:	89 c2                	mov    %eax,%edx
+    1be1:	0f 84 ba 00 00 00    	je     1ca1 <malloc+0x221>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1be7:	83 c2 08             	add    $0x8,%edx
+    1bea:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+    1bf0:	0f 87 d0 00 00 00    	ja     1cc6 <malloc+0x246>
+    1bf6:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+    1bfd:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    1c00:	89 df                	mov    %ebx,%edi
+    1c02:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1c05:	8d 76 00             	lea    0x0(%esi),%esi
+      p->s.size = units;
+    1c08:	89 72 04             	mov    %esi,0x4(%edx)
+      p->s.ptr = small[c];
+    1c0b:	8b 04 8d c0 30 00 00 	mov    0x30c0(,%ecx,4),%eax
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1c12:	01 df                	add    %ebx,%edi
+    1c14:	89 55 e0             	mov    %edx,-0x20(%ebp)
+      p->s.ptr = small[c];
+    1c17:	89 02                	mov    %eax,(%edx)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1c19:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      small[c] = p;
+    1c1c:	89 14 8d c0 30 00 00 	mov    %edx,0x30c0(,%ecx,4)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1c23:	01 c2                	add    %eax,%edx
+    1c25:	81 ff 00 02 00 00    	cmp    $0x200,%edi
+    1c2b:	76 db                	jbe    1c08 <malloc+0x188>
+    1c2d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1c30:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1c33:	e9 14 ff ff ff       	jmp    1b4c <malloc+0xcc>
+    mutex_unlock(&lock);
+    1c38:	83 ec 0c             	sub    $0xc,%esp
+    1c3b:	68 68 30 00 00       	push   $0x3068
+    1c40:	e8 4b e8 ff ff       	call   490 <mutex_unlock>
+}
+    1c45:	83 c4 10             	add    $0x10,%esp
+    1c48:	e9 37 ff ff ff       	jmp    1b84 <malloc+0x104>
+  if(threaded)
+    1c4d:	a1 64 30 00 00       	mov    0x3064,%eax
+    1c52:	85 c0                	test   %eax,%eax
+    1c54:	75 2b                	jne    1c81 <malloc+0x201>
+  tc->n[c] += moved;
+    1c56:	8b 47 20             	mov    0x20(%edi),%eax
+    1c59:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1c5c:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1c5e:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1c61:	e9 7a fe ff ff       	jmp    1ae0 <malloc+0x60>
+    mutex_lock(&lock);
+    1c66:	83 ec 0c             	sub    $0xc,%esp
+    1c69:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1c6c:	68 68 30 00 00       	push   $0x3068
+    1c71:	e8 ca e7 ff ff       	call   440 <mutex_lock>
+}
+    1c76:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1c79:	83 c4 10             	add    $0x10,%esp
+    1c7c:	e9 bc fe ff ff       	jmp    1b3d <malloc+0xbd>
+    mutex_unlock(&lock);
+    1c81:	83 ec 0c             	sub    $0xc,%esp
+    1c84:	68 68 30 00 00       	push   $0x3068
+    1c89:	e8 02 e8 ff ff       	call   490 <mutex_unlock>
+  tc->n[c] += moved;
+    1c8e:	8b 47 20             	mov    0x20(%edi),%eax
+    1c91:	83 c4 10             	add    $0x10,%esp
+    1c94:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1c97:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1c99:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1c9c:	e9 3f fe ff ff       	jmp    1ae0 <malloc+0x60>
+  if(threaded)
+    1ca1:	8b 0d 64 30 00 00    	mov    0x3064,%ecx
+    1ca7:	85 c9                	test   %ecx,%ecx
+    1ca9:	0f 84 73 fe ff ff    	je     1b22 <malloc+0xa2>
+    mutex_unlock(&lock);
+    1caf:	83 ec 0c             	sub    $0xc,%esp
+    1cb2:	68 68 30 00 00       	push   $0x3068
+    1cb7:	e8 d4 e7 ff ff       	call   490 <mutex_unlock>
+    1cbc:	83 c4 10             	add    $0x10,%esp
+    return p ? (void*)(p + 1) : 0;
+    1cbf:	31 c0                	xor    %eax,%eax
+    1cc1:	e9 5e fe ff ff       	jmp    1b24 <malloc+0xa4>
+  for(moved = 0; moved < n && small[c]; moved++){
+    1cc6:	8b 04 8d c0 30 00 00 	mov    0x30c0(,%ecx,4),%eax
+    1ccd:	e9 7a fe ff ff       	jmp    1b4c <malloc+0xcc>
+    1cd2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1cd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001ce0 <malloc_threaded>:
+void
+malloc_threaded(void)
+{
+  uint sp;
+
+  if(threaded)
+    1ce0:	a1 64 30 00 00       	mov    0x3064,%eax
+    1ce5:	85 c0                	test   %eax,%eax
+    1ce7:	74 07                	je     1cf0 <malloc_threaded+0x10>
+    1ce9:	c3                   	ret
+    1cea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+{
+    1cf0:	55                   	push   %ebp
+    1cf1:	89 e5                	mov    %esp,%ebp
+    1cf3:	83 ec 24             	sub    $0x24,%esp
+    return;
+  mutex_init(&lock);
+    1cf6:	68 68 30 00 00       	push   $0x3068
+    1cfb:	e8 30 e7 ff ff       	call   430 <mutex_init>
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1d00:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1d03:	83 c4 10             	add    $0x10,%esp
+  threaded = 1;
+    1d06:	c7 05 64 30 00 00 01 	movl   $0x1,0x3064
+    1d0d:	00 00 00 
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1d10:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    1d15:	a3 60 30 00 00       	mov    %eax,0x3060
+}
+    1d1a:	c9                   	leave
+    1d1b:	c3                   	ret
+    1d1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001d20 <malloc_thread_exit>:
+
+// Called by thread_join() with the cache slot of a finished
+// thread: give its blocks, and the cache itself, back.
+void
+malloc_thread_exit(void **cachep)
+{
+    1d20:	55                   	push   %ebp
+    1d21:	89 e5                	mov    %esp,%ebp
+    1d23:	57                   	push   %edi
+    1d24:	56                   	push   %esi
+    1d25:	53                   	push   %ebx
+    1d26:	83 ec 0c             	sub    $0xc,%esp
+    1d29:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct tcache *tc;
+  int c;
+
+  if((tc = *cachep) == 0)
+    1d2c:	8b 37                	mov    (%edi),%esi
+    1d2e:	85 f6                	test   %esi,%esi
+    1d30:	74 41                	je     1d73 <malloc_thread_exit+0x53>
+    return;
+  for(c = 0; c < NCLASS; c++)
+    1d32:	31 db                	xor    %ebx,%ebx
+    1d34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    drain(tc, c, tc->n[c]);
+    1d38:	8b 4c 9e 20          	mov    0x20(%esi,%ebx,4),%ecx
+    1d3c:	89 da                	mov    %ebx,%edx
+    1d3e:	89 f0                	mov    %esi,%eax
+  for(c = 0; c < NCLASS; c++)
+    1d40:	83 c3 01             	add    $0x1,%ebx
+    drain(tc, c, tc->n[c]);
+    1d43:	e8 c8 fa ff ff       	call   1810 <drain>
+  for(c = 0; c < NCLASS; c++)
+    1d48:	83 fb 08             	cmp    $0x8,%ebx
+    1d4b:	75 eb                	jne    1d38 <malloc_thread_exit+0x18>
+  if(threaded)
+    1d4d:	8b 15 64 30 00 00    	mov    0x3064,%edx
+    1d53:	85 d2                	test   %edx,%edx
+    1d55:	75 29                	jne    1d80 <malloc_thread_exit+0x60>
+  acquire();
+  trim(bigfree((Header*)tc - 1));
+    1d57:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1d5a:	e8 c1 f8 ff ff       	call   1620 <bigfree>
+    1d5f:	e8 3c f9 ff ff       	call   16a0 <trim>
+  if(threaded)
+    1d64:	a1 64 30 00 00       	mov    0x3064,%eax
+    1d69:	85 c0                	test   %eax,%eax
+    1d6b:	75 2b                	jne    1d98 <malloc_thread_exit+0x78>
+  release();
+  *cachep = 0;
+    1d6d:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+}
+    1d73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d76:	5b                   	pop    %ebx
+    1d77:	5e                   	pop    %esi
+    1d78:	5f                   	pop    %edi
+    1d79:	5d                   	pop    %ebp
+    1d7a:	c3                   	ret
+    1d7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1d7f:	90                   	nop
+    mutex_lock(&lock);
+    1d80:	83 ec 0c             	sub    $0xc,%esp
+    1d83:	68 68 30 00 00       	push   $0x3068
+    1d88:	e8 b3 e6 ff ff       	call   440 <mutex_lock>
+}
+    1d8d:	83 c4 10             	add    $0x10,%esp
+    1d90:	eb c5                	jmp    1d57 <malloc_thread_exit+0x37>
+    1d92:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1d98:	83 ec 0c             	sub    $0xc,%esp
+    1d9b:	68 68 30 00 00       	push   $0x3068
+    1da0:	e8 eb e6 ff ff       	call   490 <mutex_unlock>
+}
+    1da5:	83 c4 10             	add    $0x10,%esp
+    1da8:	eb c3                	jmp    1d6d <malloc_thread_exit+0x4d>
+    1daa:	66 90                	xchg   %ax,%ax
+    1dac:	66 90                	xchg   %ax,%ax
+    1dae:	66 90                	xchg   %ax,%ax
+
+00001db0 <thread_create>:
+
+// Start fn(arg) in a new thread on a freshly allocated
+// page-aligned stack.  Returns the thread's pid.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1db0:	55                   	push   %ebp
+    1db1:	89 e5                	mov    %esp,%ebp
+    1db3:	53                   	push   %ebx
+    1db4:	83 ec 14             	sub    $0x14,%esp
+  char *mem, *stack;
+  int pid;
+
+  malloc_threaded();
+    1db7:	e8 24 ff ff ff       	call   1ce0 <malloc_threaded>
+  stdio_threaded();
+    1dbc:	e8 cf ee ff ff       	call   c90 <stdio_threaded>
+  if((mem = malloc(2*PGSIZE)) == 0)
+    1dc1:	83 ec 0c             	sub    $0xc,%esp
+    1dc4:	68 00 20 00 00       	push   $0x2000
+    1dc9:	e8 b2 fc ff ff       	call   1a80 <malloc>
+    1dce:	83 c4 10             	add    $0x10,%esp
+    1dd1:	85 c0                	test   %eax,%eax
+    1dd3:	74 52                	je     1e27 <thread_create+0x77>
+    1dd5:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1dd7:	8d 80 07 10 00 00    	lea    0x1007(%eax),%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+  ((char**)stack)[-2] = 0;
+  if((pid = clone(fn, arg, stack)) < 0)
+    1ddd:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1de0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+    1de5:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  ((char**)stack)[-2] = 0;
+    1de8:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+  if((pid = clone(fn, arg, stack)) < 0)
+    1def:	50                   	push   %eax
+    1df0:	ff 75 0c             	push   0xc(%ebp)
+    1df3:	ff 75 08             	push   0x8(%ebp)
+    1df6:	e8 97 e8 ff ff       	call   692 <clone>
+    1dfb:	83 c4 10             	add    $0x10,%esp
+    1dfe:	85 c0                	test   %eax,%eax
+    1e00:	78 0e                	js     1e10 <thread_create+0x60>
+    free(mem);
+  return pid;
+}
+    1e02:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1e05:	c9                   	leave
+    1e06:	c3                   	ret
+    1e07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e0e:	66 90                	xchg   %ax,%ax
+    free(mem);
+    1e10:	83 ec 0c             	sub    $0xc,%esp
+    1e13:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1e16:	53                   	push   %ebx
+    1e17:	e8 34 fb ff ff       	call   1950 <free>
+    1e1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1e1f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    1e22:	83 c4 10             	add    $0x10,%esp
+}
+    1e25:	c9                   	leave
+    1e26:	c3                   	ret
+    return -1;
+    1e27:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1e2c:	eb d4                	jmp    1e02 <thread_create+0x52>
+    1e2e:	66 90                	xchg   %ax,%ax
+
+00001e30 <thread_join>:
+
+// Wait for a thread to finish and free its stack.
+int
+thread_join(void)
+{
+    1e30:	55                   	push   %ebp
+    1e31:	89 e5                	mov    %esp,%ebp
+    1e33:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    1e34:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    1e37:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    1e3a:	50                   	push   %eax
+    1e3b:	e8 61 e8 ff ff       	call   6a1 <join>
+    1e40:	83 c4 10             	add    $0x10,%esp
+    1e43:	85 c0                	test   %eax,%eax
+    1e45:	78 29                	js     1e70 <thread_join+0x40>
+    1e47:	89 c3                	mov    %eax,%ebx
+    return -1;
+  malloc_thread_exit(&((void**)stack)[-2]);
+    1e49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1e4c:	83 ec 0c             	sub    $0xc,%esp
+    1e4f:	83 e8 08             	sub    $0x8,%eax
+    1e52:	50                   	push   %eax
+    1e53:	e8 c8 fe ff ff       	call   1d20 <malloc_thread_exit>
+  free(((char**)stack)[-1]);
+    1e58:	58                   	pop    %eax
+    1e59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1e5c:	ff 70 fc             	push   -0x4(%eax)
+    1e5f:	e8 ec fa ff ff       	call   1950 <free>
+  return pid;
+    1e64:	83 c4 10             	add    $0x10,%esp
+}
+    1e67:	89 d8                	mov    %ebx,%eax
+    1e69:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1e6c:	c9                   	leave
+    1e6d:	c3                   	ret
+    1e6e:	66 90                	xchg   %ax,%ax
+    return -1;
+    1e70:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    1e75:	eb f0                	jmp    1e67 <thread_join+0x37>
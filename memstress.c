@@ -0,0 +1,61 @@
+// Memory overcommit stress test.
+// Forks nproc children that together allocate and keep touching
+// more memory than the machine has, checking that each page keeps
+// its contents as pages go out to swap and come back. For example,
+// under "make qemu MEM=64", run "memstress 96".
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "mmu.h"
+
+#define ROUNDS 4
+
+void
+child(int id, int npages)
+{
+  char *base;
+  int i, r;
+
+  if((base = sbrk(npages * PGSIZE)) == (char*)-1){
+    printf(1, "memstress: child %d: sbrk failed\n", id);
+    exit();
+  }
+  for(i = 0; i < npages; i++)
+    *(int*)(base + i*PGSIZE) = id * 1000003 + i;
+  for(r = 0; r < ROUNDS; r++){
+    for(i = 0; i < npages; i++){
+      if(*(int*)(base + i*PGSIZE) != id * 1000003 + i){
+        printf(1, "memstress: child %d: page %d corrupted\n", id, i);
+        exit();
+      }
+    }
+    sleep(1);
+  }
+  printf(1, "memstress: child %d ok\n", id);
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  int mb, nproc, i, t0;
+
+  mb = argc > 1 ? atoi(argv[1]) : 32;
+  nproc = argc > 2 ? atoi(argv[2]) : 4;
+  if(mb < 1 || nproc < 1){
+    printf(2, "usage: memstress [MB [nproc]]\n");
+    exit();
+  }
+
+  printf(1, "memstress: %d MB in %d processes\n", mb, nproc);
+  t0 = uptime();
+  for(i = 0; i < nproc; i++){
+    if(fork() == 0)
+      child(i, mb * (1024*1024 / PGSIZE) / nproc);
+  }
+  for(i = 0; i < nproc; i++)
+    wait();
+  printf(1, "memstress: done in %d ticks\n", uptime() - t0);
+  exit();
+}
@@ -0,0 +1,3996 @@
+
+_mkdir:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	bf 01 00 00 00       	mov    $0x1,%edi
+      13:	56                   	push   %esi
+      14:	53                   	push   %ebx
+      15:	51                   	push   %ecx
+      16:	83 ec 08             	sub    $0x8,%esp
+      19:	8b 59 04             	mov    0x4(%ecx),%ebx
+      1c:	8b 31                	mov    (%ecx),%esi
+      1e:	83 c3 04             	add    $0x4,%ebx
+  int i;
+
+  if(argc < 2){
+      21:	83 fe 01             	cmp    $0x1,%esi
+      24:	7f 14                	jg     3a <main+0x3a>
+      26:	eb 3a                	jmp    62 <main+0x62>
+      28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      2f:	90                   	nop
+    printf(2, "Usage: mkdir files...\n");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+      30:	83 c7 01             	add    $0x1,%edi
+      33:	83 c3 04             	add    $0x4,%ebx
+      36:	39 fe                	cmp    %edi,%esi
+      38:	74 23                	je     5d <main+0x5d>
+    if(mkdir(argv[i]) < 0){
+      3a:	83 ec 0c             	sub    $0xc,%esp
+      3d:	ff 33                	push   (%ebx)
+      3f:	e8 a4 04 00 00       	call   4e8 <mkdir>
+      44:	83 c4 10             	add    $0x10,%esp
+      47:	85 c0                	test   %eax,%eax
+      49:	79 e5                	jns    30 <main+0x30>
+      printf(2, "mkdir: %s failed to create\n", argv[i]);
+      4b:	50                   	push   %eax
+      4c:	ff 33                	push   (%ebx)
+      4e:	68 3f 1d 00 00       	push   $0x1d3f
+      53:	6a 02                	push   $0x2
+      55:	e8 46 08 00 00       	call   8a0 <printf>
+      break;
+      5a:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+      5d:	e8 7e 00 00 00       	call   e0 <exit>
+    printf(2, "Usage: mkdir files...\n");
+      62:	52                   	push   %edx
+      63:	52                   	push   %edx
+      64:	68 28 1d 00 00       	push   $0x1d28
+      69:	6a 02                	push   $0x2
+      6b:	e8 30 08 00 00       	call   8a0 <printf>
+    exit();
+      70:	e8 6b 00 00 00       	call   e0 <exit>
+      75:	66 90                	xchg   %ax,%ax
+      77:	66 90                	xchg   %ax,%ax
+      79:	66 90                	xchg   %ax,%ax
+      7b:	66 90                	xchg   %ax,%ax
+      7d:	66 90                	xchg   %ax,%ax
+      7f:	90                   	nop
+
+00000080 <fork>:
+int sysexit(void) __attribute__((noreturn));
+
+int
+fork(void)
+{
+  if(flushhook)
+      80:	a1 20 28 00 00       	mov    0x2820,%eax
+      85:	85 c0                	test   %eax,%eax
+      87:	74 17                	je     a0 <fork+0x20>
+{
+      89:	55                   	push   %ebp
+      8a:	89 e5                	mov    %esp,%ebp
+      8c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+      8f:	ff d0                	call   *%eax
+  return sysfork();
+}
+      91:	c9                   	leave
+  return sysfork();
+      92:	e9 7f 03 00 00       	jmp    416 <sysfork>
+      97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      9e:	66 90                	xchg   %ax,%ax
+      a0:	e9 71 03 00 00       	jmp    416 <sysfork>
+      a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000b0 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+      b0:	55                   	push   %ebp
+  if(flushhook)
+      b1:	a1 20 28 00 00       	mov    0x2820,%eax
+{
+      b6:	89 e5                	mov    %esp,%ebp
+      b8:	56                   	push   %esi
+      b9:	53                   	push   %ebx
+      ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+      bd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+      c0:	85 c0                	test   %eax,%eax
+      c2:	74 02                	je     c6 <exec+0x16>
+    flushhook();
+      c4:	ff d0                	call   *%eax
+  return sysexec(path, argv);
+      c6:	89 75 0c             	mov    %esi,0xc(%ebp)
+      c9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+      cc:	5b                   	pop    %ebx
+      cd:	5e                   	pop    %esi
+      ce:	5d                   	pop    %ebp
+  return sysexec(path, argv);
+      cf:	e9 ba 03 00 00       	jmp    48e <sysexec>
+      d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      df:	90                   	nop
+
+000000e0 <exit>:
+
+int
+exit(void)
+{
+      e0:	55                   	push   %ebp
+      e1:	89 e5                	mov    %esp,%ebp
+      e3:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+      e6:	a1 20 28 00 00       	mov    0x2820,%eax
+      eb:	85 c0                	test   %eax,%eax
+      ed:	74 02                	je     f1 <exit+0x11>
+    flushhook();
+      ef:	ff d0                	call   *%eax
+  sysexit();
+      f1:	e8 2f 03 00 00       	call   425 <sysexit>
+      f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000100 <strcpy>:
+}
+
+char*
+strcpy(char *s, const char *t)
+{
+     100:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     101:	31 c0                	xor    %eax,%eax
+{
+     103:	89 e5                	mov    %esp,%ebp
+     105:	53                   	push   %ebx
+     106:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     109:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     10c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     110:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     114:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     117:	83 c0 01             	add    $0x1,%eax
+     11a:	84 d2                	test   %dl,%dl
+     11c:	75 f2                	jne    110 <strcpy+0x10>
+    ;
+  return os;
+}
+     11e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     121:	89 c8                	mov    %ecx,%eax
+     123:	c9                   	leave
+     124:	c3                   	ret
+     125:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000130 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     130:	55                   	push   %ebp
+     131:	89 e5                	mov    %esp,%ebp
+     133:	53                   	push   %ebx
+     134:	8b 55 08             	mov    0x8(%ebp),%edx
+     137:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     13a:	0f b6 02             	movzbl (%edx),%eax
+     13d:	84 c0                	test   %al,%al
+     13f:	75 17                	jne    158 <strcmp+0x28>
+     141:	eb 3a                	jmp    17d <strcmp+0x4d>
+     143:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     147:	90                   	nop
+     148:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     14c:	83 c2 01             	add    $0x1,%edx
+     14f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     152:	84 c0                	test   %al,%al
+     154:	74 1a                	je     170 <strcmp+0x40>
+    p++, q++;
+     156:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     158:	0f b6 19             	movzbl (%ecx),%ebx
+     15b:	38 c3                	cmp    %al,%bl
+     15d:	74 e9                	je     148 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     15f:	29 d8                	sub    %ebx,%eax
+}
+     161:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     164:	c9                   	leave
+     165:	c3                   	ret
+     166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     16d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     170:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     174:	31 c0                	xor    %eax,%eax
+     176:	29 d8                	sub    %ebx,%eax
+}
+     178:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     17b:	c9                   	leave
+     17c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     17d:	0f b6 19             	movzbl (%ecx),%ebx
+     180:	31 c0                	xor    %eax,%eax
+     182:	eb db                	jmp    15f <strcmp+0x2f>
+     184:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     18b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     18f:	90                   	nop
+
+00000190 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     190:	55                   	push   %ebp
+     191:	89 e5                	mov    %esp,%ebp
+     193:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     196:	80 3a 00             	cmpb   $0x0,(%edx)
+     199:	74 15                	je     1b0 <strlen+0x20>
+     19b:	31 c0                	xor    %eax,%eax
+     19d:	8d 76 00             	lea    0x0(%esi),%esi
+     1a0:	83 c0 01             	add    $0x1,%eax
+     1a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     1a7:	89 c1                	mov    %eax,%ecx
+     1a9:	75 f5                	jne    1a0 <strlen+0x10>
+    ;
+  return n;
+}
+     1ab:	89 c8                	mov    %ecx,%eax
+     1ad:	5d                   	pop    %ebp
+     1ae:	c3                   	ret
+     1af:	90                   	nop
+  for(n = 0; s[n]; n++)
+     1b0:	31 c9                	xor    %ecx,%ecx
+}
+     1b2:	5d                   	pop    %ebp
+     1b3:	89 c8                	mov    %ecx,%eax
+     1b5:	c3                   	ret
+     1b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     1c0:	55                   	push   %ebp
+     1c1:	89 e5                	mov    %esp,%ebp
+     1c3:	57                   	push   %edi
+     1c4:	8b 55 08             	mov    0x8(%ebp),%edx
+            "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt) {
+    asm volatile("cld; rep stosb" :
+     1c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     1ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+     1cd:	89 d7                	mov    %edx,%edi
+     1cf:	fc                   	cld
+     1d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     1d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     1d5:	89 d0                	mov    %edx,%eax
+     1d7:	c9                   	leave
+     1d8:	c3                   	ret
+     1d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     1e0:	55                   	push   %ebp
+     1e1:	89 e5                	mov    %esp,%ebp
+     1e3:	8b 45 08             	mov    0x8(%ebp),%eax
+     1e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     1ea:	0f b6 10             	movzbl (%eax),%edx
+     1ed:	84 d2                	test   %dl,%dl
+     1ef:	75 12                	jne    203 <strchr+0x23>
+     1f1:	eb 1d                	jmp    210 <strchr+0x30>
+     1f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1f7:	90                   	nop
+     1f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     1fc:	83 c0 01             	add    $0x1,%eax
+     1ff:	84 d2                	test   %dl,%dl
+     201:	74 0d                	je     210 <strchr+0x30>
+    if(*s == c)
+     203:	38 d1                	cmp    %dl,%cl
+     205:	75 f1                	jne    1f8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     207:	5d                   	pop    %ebp
+     208:	c3                   	ret
+     209:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     210:	31 c0                	xor    %eax,%eax
+}
+     212:	5d                   	pop    %ebp
+     213:	c3                   	ret
+     214:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     21b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     21f:	90                   	nop
+
+00000220 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     220:	55                   	push   %ebp
+     221:	89 e5                	mov    %esp,%ebp
+     223:	56                   	push   %esi
+     224:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     225:	83 ec 08             	sub    $0x8,%esp
+     228:	6a 00                	push   $0x0
+     22a:	ff 75 08             	push   0x8(%ebp)
+     22d:	e8 6b 02 00 00       	call   49d <open>
+  if(fd < 0)
+     232:	83 c4 10             	add    $0x10,%esp
+     235:	85 c0                	test   %eax,%eax
+     237:	78 27                	js     260 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     239:	83 ec 08             	sub    $0x8,%esp
+     23c:	ff 75 0c             	push   0xc(%ebp)
+     23f:	89 c3                	mov    %eax,%ebx
+     241:	50                   	push   %eax
+     242:	e8 83 02 00 00       	call   4ca <fstat>
+  close(fd);
+     247:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     24a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     24c:	e8 1f 02 00 00       	call   470 <close>
+  return r;
+     251:	83 c4 10             	add    $0x10,%esp
+}
+     254:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     257:	89 f0                	mov    %esi,%eax
+     259:	5b                   	pop    %ebx
+     25a:	5e                   	pop    %esi
+     25b:	5d                   	pop    %ebp
+     25c:	c3                   	ret
+     25d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     260:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     265:	eb ed                	jmp    254 <stat+0x34>
+     267:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     26e:	66 90                	xchg   %ax,%ax
+
+00000270 <atoi>:
+
+int
+atoi(const char *s)
+{
+     270:	55                   	push   %ebp
+     271:	89 e5                	mov    %esp,%ebp
+     273:	53                   	push   %ebx
+     274:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     277:	0f be 02             	movsbl (%edx),%eax
+     27a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     27d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     280:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     285:	77 1e                	ja     2a5 <atoi+0x35>
+     287:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     28e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     290:	83 c2 01             	add    $0x1,%edx
+     293:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     296:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     29a:	0f be 02             	movsbl (%edx),%eax
+     29d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     2a0:	80 fb 09             	cmp    $0x9,%bl
+     2a3:	76 eb                	jbe    290 <atoi+0x20>
+  return n;
+}
+     2a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2a8:	89 c8                	mov    %ecx,%eax
+     2aa:	c9                   	leave
+     2ab:	c3                   	ret
+     2ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     2b0:	55                   	push   %ebp
+     2b1:	89 e5                	mov    %esp,%ebp
+     2b3:	57                   	push   %edi
+     2b4:	56                   	push   %esi
+     2b5:	8b 45 10             	mov    0x10(%ebp),%eax
+     2b8:	8b 55 08             	mov    0x8(%ebp),%edx
+     2bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     2be:	85 c0                	test   %eax,%eax
+     2c0:	7e 13                	jle    2d5 <memmove+0x25>
+     2c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     2c4:	89 d7                	mov    %edx,%edi
+     2c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     2d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     2d1:	39 f8                	cmp    %edi,%eax
+     2d3:	75 fb                	jne    2d0 <memmove+0x20>
+  return vdst;
+}
+     2d5:	5e                   	pop    %esi
+     2d6:	89 d0                	mov    %edx,%eax
+     2d8:	5f                   	pop    %edi
+     2d9:	5d                   	pop    %ebp
+     2da:	c3                   	ret
+     2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2df:	90                   	nop
+
+000002e0 <mutex_init>:
+
+// Futex-based mutex (Drepper, "Futexes Are Tricky", mutex 2).
+// The uncontended paths never enter the kernel.
+void
+mutex_init(struct mutex *m)
+{
+     2e0:	55                   	push   %ebp
+     2e1:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+     2e3:	8b 45 08             	mov    0x8(%ebp),%eax
+     2e6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     2ec:	5d                   	pop    %ebp
+     2ed:	c3                   	ret
+     2ee:	66 90                	xchg   %ax,%ax
+
+000002f0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     2f0:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     2f1:	31 c0                	xor    %eax,%eax
+     2f3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+     2f8:	89 e5                	mov    %esp,%ebp
+     2fa:	56                   	push   %esi
+     2fb:	53                   	push   %ebx
+     2fc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     2ff:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     303:	85 c0                	test   %eax,%eax
+     305:	74 32                	je     339 <mutex_lock+0x49>
+    return;
+  if(c != 2)
+     307:	83 f8 02             	cmp    $0x2,%eax
+     30a:	74 0c                	je     318 <mutex_lock+0x28>
+static inline uint
+xchg(volatile uint *addr, uint newval) {
+    uint result;
+
+    // The + in "+m" denotes a read-modify-write operand.
+    asm volatile("lock; xchgl %0, %1" :
+     30c:	b8 02 00 00 00       	mov    $0x2,%eax
+     311:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+     314:	85 c0                	test   %eax,%eax
+     316:	74 21                	je     339 <mutex_lock+0x49>
+     318:	be 02 00 00 00       	mov    $0x2,%esi
+     31d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAIT, 2);
+     320:	83 ec 04             	sub    $0x4,%esp
+     323:	6a 02                	push   $0x2
+     325:	6a 00                	push   $0x0
+     327:	53                   	push   %ebx
+     328:	e8 33 02 00 00       	call   560 <futex>
+     32d:	89 f0                	mov    %esi,%eax
+     32f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     332:	83 c4 10             	add    $0x10,%esp
+     335:	85 c0                	test   %eax,%eax
+     337:	75 e7                	jne    320 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+     339:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     33c:	5b                   	pop    %ebx
+     33d:	5e                   	pop    %esi
+     33e:	5d                   	pop    %ebp
+     33f:	c3                   	ret
+
+00000340 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     340:	55                   	push   %ebp
+     341:	89 e5                	mov    %esp,%ebp
+     343:	83 ec 08             	sub    $0x8,%esp
+     346:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     349:	f0 83 28 01          	lock subl $0x1,(%eax)
+     34d:	75 09                	jne    358 <mutex_unlock+0x18>
+    m->val = 0;
+    futex(&m->val, FUTEX_WAKE, 1);
+  }
+}
+     34f:	c9                   	leave
+     350:	c3                   	ret
+     351:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     358:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     35b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex(&m->val, FUTEX_WAKE, 1);
+     361:	6a 01                	push   $0x1
+     363:	6a 01                	push   $0x1
+     365:	50                   	push   %eax
+     366:	e8 f5 01 00 00       	call   560 <futex>
+     36b:	83 c4 10             	add    $0x10,%esp
+}
+     36e:	c9                   	leave
+     36f:	c3                   	ret
+
+00000370 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     370:	55                   	push   %ebp
+     371:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     373:	8b 45 08             	mov    0x8(%ebp),%eax
+     376:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     37c:	5d                   	pop    %ebp
+     37d:	c3                   	ret
+     37e:	66 90                	xchg   %ax,%ax
+
+00000380 <cond_wait>:
+
+// Release m and wait for a signal, then reacquire m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     380:	55                   	push   %ebp
+     381:	89 e5                	mov    %esp,%ebp
+     383:	57                   	push   %edi
+     384:	56                   	push   %esi
+     385:	53                   	push   %ebx
+     386:	83 ec 0c             	sub    $0xc,%esp
+     389:	8b 75 08             	mov    0x8(%ebp),%esi
+     38c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     38f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     391:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+     395:	75 21                	jne    3b8 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     397:	83 ec 04             	sub    $0x4,%esp
+     39a:	57                   	push   %edi
+     39b:	6a 00                	push   $0x0
+     39d:	56                   	push   %esi
+     39e:	e8 bd 01 00 00       	call   560 <futex>
+  mutex_lock(m);
+     3a3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     3a6:	83 c4 10             	add    $0x10,%esp
+}
+     3a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     3ac:	5b                   	pop    %ebx
+     3ad:	5e                   	pop    %esi
+     3ae:	5f                   	pop    %edi
+     3af:	5d                   	pop    %ebp
+  mutex_lock(m);
+     3b0:	e9 3b ff ff ff       	jmp    2f0 <mutex_lock>
+     3b5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     3b8:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     3bb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex(&m->val, FUTEX_WAKE, 1);
+     3c1:	6a 01                	push   $0x1
+     3c3:	6a 01                	push   $0x1
+     3c5:	53                   	push   %ebx
+     3c6:	e8 95 01 00 00       	call   560 <futex>
+     3cb:	83 c4 10             	add    $0x10,%esp
+     3ce:	eb c7                	jmp    397 <cond_wait+0x17>
+
+000003d0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+     3d0:	55                   	push   %ebp
+     3d1:	89 e5                	mov    %esp,%ebp
+     3d3:	83 ec 0c             	sub    $0xc,%esp
+     3d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     3d9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+     3dd:	6a 01                	push   $0x1
+     3df:	6a 01                	push   $0x1
+     3e1:	50                   	push   %eax
+     3e2:	e8 79 01 00 00       	call   560 <futex>
+}
+     3e7:	83 c4 10             	add    $0x10,%esp
+     3ea:	c9                   	leave
+     3eb:	c3                   	ret
+     3ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003f0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     3f0:	55                   	push   %ebp
+     3f1:	89 e5                	mov    %esp,%ebp
+     3f3:	83 ec 0c             	sub    $0xc,%esp
+     3f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     3f9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+     3fd:	6a 40                	push   $0x40
+     3ff:	6a 01                	push   $0x1
+     401:	50                   	push   %eax
+     402:	e8 59 01 00 00       	call   560 <futex>
+}
+     407:	83 c4 10             	add    $0x10,%esp
+     40a:	c9                   	leave
+     40b:	c3                   	ret
+     40c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000410 <uptime>:
+// Clock ticks since boot, read from the kernel's vdso page
+// without a system call.
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     410:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+     415:	c3                   	ret
+
+00000416 <sysfork>:
+  1: ret
+
+#define SYSCALL(name) SYSCALLAS(name, name)
+
+// ulib.c wraps these.
+SYSCALLAS(sysfork, fork)
+     416:	b8 01 00 00 00       	mov    $0x1,%eax
+     41b:	89 e1                	mov    %esp,%ecx
+     41d:	ba 24 04 00 00       	mov    $0x424,%edx
+     422:	0f 34                	sysenter
+     424:	c3                   	ret
+
+00000425 <sysexit>:
+SYSCALLAS(sysexit, exit)
+     425:	b8 02 00 00 00       	mov    $0x2,%eax
+     42a:	89 e1                	mov    %esp,%ecx
+     42c:	ba 33 04 00 00       	mov    $0x433,%edx
+     431:	0f 34                	sysenter
+     433:	c3                   	ret
+
+00000434 <wait>:
+SYSCALL(wait)
+     434:	b8 03 00 00 00       	mov    $0x3,%eax
+     439:	89 e1                	mov    %esp,%ecx
+     43b:	ba 42 04 00 00       	mov    $0x442,%edx
+     440:	0f 34                	sysenter
+     442:	c3                   	ret
+
+00000443 <pipe>:
+SYSCALL(pipe)
+     443:	b8 04 00 00 00       	mov    $0x4,%eax
+     448:	89 e1                	mov    %esp,%ecx
+     44a:	ba 51 04 00 00       	mov    $0x451,%edx
+     44f:	0f 34                	sysenter
+     451:	c3                   	ret
+
+00000452 <read>:
+SYSCALL(read)
+     452:	b8 05 00 00 00       	mov    $0x5,%eax
+     457:	89 e1                	mov    %esp,%ecx
+     459:	ba 60 04 00 00       	mov    $0x460,%edx
+     45e:	0f 34                	sysenter
+     460:	c3                   	ret
+
+00000461 <write>:
+SYSCALL(write)
+     461:	b8 10 00 00 00       	mov    $0x10,%eax
+     466:	89 e1                	mov    %esp,%ecx
+     468:	ba 6f 04 00 00       	mov    $0x46f,%edx
+     46d:	0f 34                	sysenter
+     46f:	c3                   	ret
+
+00000470 <close>:
+SYSCALL(close)
+     470:	b8 15 00 00 00       	mov    $0x15,%eax
+     475:	89 e1                	mov    %esp,%ecx
+     477:	ba 7e 04 00 00       	mov    $0x47e,%edx
+     47c:	0f 34                	sysenter
+     47e:	c3                   	ret
+
+0000047f <kill>:
+SYSCALL(kill)
+     47f:	b8 06 00 00 00       	mov    $0x6,%eax
+     484:	89 e1                	mov    %esp,%ecx
+     486:	ba 8d 04 00 00       	mov    $0x48d,%edx
+     48b:	0f 34                	sysenter
+     48d:	c3                   	ret
+
+0000048e <sysexec>:
+SYSCALLAS(sysexec, exec)
+     48e:	b8 07 00 00 00       	mov    $0x7,%eax
+     493:	89 e1                	mov    %esp,%ecx
+     495:	ba 9c 04 00 00       	mov    $0x49c,%edx
+     49a:	0f 34                	sysenter
+     49c:	c3                   	ret
+
+0000049d <open>:
+SYSCALL(open)
+     49d:	b8 0f 00 00 00       	mov    $0xf,%eax
+     4a2:	89 e1                	mov    %esp,%ecx
+     4a4:	ba ab 04 00 00       	mov    $0x4ab,%edx
+     4a9:	0f 34                	sysenter
+     4ab:	c3                   	ret
+
+000004ac <mknod>:
+SYSCALL(mknod)
+     4ac:	b8 11 00 00 00       	mov    $0x11,%eax
+     4b1:	89 e1                	mov    %esp,%ecx
+     4b3:	ba ba 04 00 00       	mov    $0x4ba,%edx
+     4b8:	0f 34                	sysenter
+     4ba:	c3                   	ret
+
+000004bb <unlink>:
+SYSCALL(unlink)
+     4bb:	b8 12 00 00 00       	mov    $0x12,%eax
+     4c0:	89 e1                	mov    %esp,%ecx
+     4c2:	ba c9 04 00 00       	mov    $0x4c9,%edx
+     4c7:	0f 34                	sysenter
+     4c9:	c3                   	ret
+
+000004ca <fstat>:
+SYSCALL(fstat)
+     4ca:	b8 08 00 00 00       	mov    $0x8,%eax
+     4cf:	89 e1                	mov    %esp,%ecx
+     4d1:	ba d8 04 00 00       	mov    $0x4d8,%edx
+     4d6:	0f 34                	sysenter
+     4d8:	c3                   	ret
+
+000004d9 <link>:
+SYSCALL(link)
+     4d9:	b8 13 00 00 00       	mov    $0x13,%eax
+     4de:	89 e1                	mov    %esp,%ecx
+     4e0:	ba e7 04 00 00       	mov    $0x4e7,%edx
+     4e5:	0f 34                	sysenter
+     4e7:	c3                   	ret
+
+000004e8 <mkdir>:
+SYSCALL(mkdir)
+     4e8:	b8 14 00 00 00       	mov    $0x14,%eax
+     4ed:	89 e1                	mov    %esp,%ecx
+     4ef:	ba f6 04 00 00       	mov    $0x4f6,%edx
+     4f4:	0f 34                	sysenter
+     4f6:	c3                   	ret
+
+000004f7 <chdir>:
+SYSCALL(chdir)
+     4f7:	b8 09 00 00 00       	mov    $0x9,%eax
+     4fc:	89 e1                	mov    %esp,%ecx
+     4fe:	ba 05 05 00 00       	mov    $0x505,%edx
+     503:	0f 34                	sysenter
+     505:	c3                   	ret
+
+00000506 <dup>:
+SYSCALL(dup)
+     506:	b8 0a 00 00 00       	mov    $0xa,%eax
+     50b:	89 e1                	mov    %esp,%ecx
+     50d:	ba 14 05 00 00       	mov    $0x514,%edx
+     512:	0f 34                	sysenter
+     514:	c3                   	ret
+
+00000515 <getpid>:
+SYSCALL(getpid)
+     515:	b8 0b 00 00 00       	mov    $0xb,%eax
+     51a:	89 e1                	mov    %esp,%ecx
+     51c:	ba 23 05 00 00       	mov    $0x523,%edx
+     521:	0f 34                	sysenter
+     523:	c3                   	ret
+
+00000524 <sbrk>:
+SYSCALL(sbrk)
+     524:	b8 0c 00 00 00       	mov    $0xc,%eax
+     529:	89 e1                	mov    %esp,%ecx
+     52b:	ba 32 05 00 00       	mov    $0x532,%edx
+     530:	0f 34                	sysenter
+     532:	c3                   	ret
+
+00000533 <sleep>:
+SYSCALL(sleep)
+     533:	b8 0d 00 00 00       	mov    $0xd,%eax
+     538:	89 e1                	mov    %esp,%ecx
+     53a:	ba 41 05 00 00       	mov    $0x541,%edx
+     53f:	0f 34                	sysenter
+     541:	c3                   	ret
+
+00000542 <clone>:
+SYSCALL(clone)
+     542:	b8 16 00 00 00       	mov    $0x16,%eax
+     547:	89 e1                	mov    %esp,%ecx
+     549:	ba 50 05 00 00       	mov    $0x550,%edx
+     54e:	0f 34                	sysenter
+     550:	c3                   	ret
+
+00000551 <join>:
+SYSCALL(join)
+     551:	b8 17 00 00 00       	mov    $0x17,%eax
+     556:	89 e1                	mov    %esp,%ecx
+     558:	ba 5f 05 00 00       	mov    $0x55f,%edx
+     55d:	0f 34                	sysenter
+     55f:	c3                   	ret
+
+00000560 <futex>:
+SYSCALL(futex)
+     560:	b8 18 00 00 00       	mov    $0x18,%eax
+     565:	89 e1                	mov    %esp,%ecx
+     567:	ba 6e 05 00 00       	mov    $0x56e,%edx
+     56c:	0f 34                	sysenter
+     56e:	c3                   	ret
+
+0000056f <yield>:
+SYSCALL(yield)
+     56f:	b8 19 00 00 00       	mov    $0x19,%eax
+     574:	89 e1                	mov    %esp,%ecx
+     576:	ba 7d 05 00 00       	mov    $0x57d,%edx
+     57b:	0f 34                	sysenter
+     57d:	c3                   	ret
+
+0000057e <lockstat>:
+SYSCALL(lockstat)
+     57e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     583:	89 e1                	mov    %esp,%ecx
+     585:	ba 8c 05 00 00       	mov    $0x58c,%edx
+     58a:	0f 34                	sysenter
+     58c:	c3                   	ret
+
+0000058d <lockhammer>:
+SYSCALL(lockhammer)
+     58d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     592:	89 e1                	mov    %esp,%ecx
+     594:	ba 9b 05 00 00       	mov    $0x59b,%edx
+     599:	0f 34                	sysenter
+     59b:	c3                   	ret
+
+0000059c <vmsplice>:
+SYSCALL(vmsplice)
+     59c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     5a1:	89 e1                	mov    %esp,%ecx
+     5a3:	ba aa 05 00 00       	mov    $0x5aa,%edx
+     5a8:	0f 34                	sysenter
+     5aa:	c3                   	ret
+
+000005ab <hsbrk>:
+SYSCALL(hsbrk)
+     5ab:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     5b0:	89 e1                	mov    %esp,%ecx
+     5b2:	ba b9 05 00 00       	mov    $0x5b9,%edx
+     5b7:	0f 34                	sysenter
+     5b9:	c3                   	ret
+
+000005ba <mmap>:
+SYSCALL(mmap)
+     5ba:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     5bf:	89 e1                	mov    %esp,%ecx
+     5c1:	ba c8 05 00 00       	mov    $0x5c8,%edx
+     5c6:	0f 34                	sysenter
+     5c8:	c3                   	ret
+
+000005c9 <munmap>:
+SYSCALL(munmap)
+     5c9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     5ce:	89 e1                	mov    %esp,%ecx
+     5d0:	ba d7 05 00 00       	mov    $0x5d7,%edx
+     5d5:	0f 34                	sysenter
+     5d7:	c3                   	ret
+
+000005d8 <ringenter>:
+SYSCALL(ringenter)
+     5d8:	b8 20 00 00 00       	mov    $0x20,%eax
+     5dd:	89 e1                	mov    %esp,%ecx
+     5df:	ba e6 05 00 00       	mov    $0x5e6,%edx
+     5e4:	0f 34                	sysenter
+     5e6:	c3                   	ret
+
+000005e7 <readv>:
+SYSCALL(readv)
+     5e7:	b8 21 00 00 00       	mov    $0x21,%eax
+     5ec:	89 e1                	mov    %esp,%ecx
+     5ee:	ba f5 05 00 00       	mov    $0x5f5,%edx
+     5f3:	0f 34                	sysenter
+     5f5:	c3                   	ret
+
+000005f6 <writev>:
+SYSCALL(writev)
+     5f6:	b8 22 00 00 00       	mov    $0x22,%eax
+     5fb:	89 e1                	mov    %esp,%ecx
+     5fd:	ba 04 06 00 00       	mov    $0x604,%edx
+     602:	0f 34                	sysenter
+     604:	c3                   	ret
+
+00000605 <pread>:
+SYSCALL(pread)
+     605:	b8 23 00 00 00       	mov    $0x23,%eax
+     60a:	89 e1                	mov    %esp,%ecx
+     60c:	ba 13 06 00 00       	mov    $0x613,%edx
+     611:	0f 34                	sysenter
+     613:	c3                   	ret
+
+00000614 <pwrite>:
+SYSCALL(pwrite)
+     614:	b8 24 00 00 00       	mov    $0x24,%eax
+     619:	89 e1                	mov    %esp,%ecx
+     61b:	ba 22 06 00 00       	mov    $0x622,%edx
+     620:	0f 34                	sysenter
+     622:	c3                   	ret
+
+00000623 <prof>:
+SYSCALL(prof)
+     623:	b8 25 00 00 00       	mov    $0x25,%eax
+     628:	89 e1                	mov    %esp,%ecx
+     62a:	ba 31 06 00 00       	mov    $0x631,%edx
+     62f:	0f 34                	sysenter
+     631:	c3                   	ret
+
+00000632 <scstat>:
+SYSCALL(scstat)
+     632:	b8 26 00 00 00       	mov    $0x26,%eax
+     637:	89 e1                	mov    %esp,%ecx
+     639:	ba 40 06 00 00       	mov    $0x640,%edx
+     63e:	0f 34                	sysenter
+     640:	c3                   	ret
+     641:	66 90                	xchg   %ax,%ax
+     643:	66 90                	xchg   %ax,%ax
+     645:	66 90                	xchg   %ax,%ax
+     647:	66 90                	xchg   %ax,%ax
+     649:	66 90                	xchg   %ax,%ax
+     64b:	66 90                	xchg   %ax,%ax
+     64d:	66 90                	xchg   %ax,%ax
+     64f:	90                   	nop
+
+00000650 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+     650:	55                   	push   %ebp
+     651:	89 e5                	mov    %esp,%ebp
+     653:	57                   	push   %edi
+     654:	56                   	push   %esi
+     655:	53                   	push   %ebx
+     656:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     658:	89 d1                	mov    %edx,%ecx
+{
+     65a:	83 ec 2c             	sub    $0x2c,%esp
+     65d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+     660:	85 d2                	test   %edx,%edx
+     662:	79 7c                	jns    6e0 <printint+0x90>
+     664:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     668:	74 76                	je     6e0 <printint+0x90>
+    x = -xx;
+     66a:	f7 d9                	neg    %ecx
+    neg = 1;
+     66c:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     671:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     674:	31 f6                	xor    %esi,%esi
+     676:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     67d:	8d 76 00             	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     680:	89 c8                	mov    %ecx,%eax
+     682:	31 d2                	xor    %edx,%edx
+     684:	89 f7                	mov    %esi,%edi
+     686:	f7 f3                	div    %ebx
+     688:	8d 76 01             	lea    0x1(%esi),%esi
+     68b:	0f b6 92 bc 1d 00 00 	movzbl 0x1dbc(%edx),%edx
+     692:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     696:	89 ca                	mov    %ecx,%edx
+     698:	89 c1                	mov    %eax,%ecx
+     69a:	39 da                	cmp    %ebx,%edx
+     69c:	73 e2                	jae    680 <printint+0x30>
+  if(neg)
+     69e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     6a1:	85 c0                	test   %eax,%eax
+     6a3:	74 07                	je     6ac <printint+0x5c>
+    buf[i++] = '-';
+     6a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     6aa:	89 f7                	mov    %esi,%edi
+     6ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     6af:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     6b2:	01 df                	add    %ebx,%edi
+     6b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc_unlocked(buf[i], f);
+     6b8:	83 ec 08             	sub    $0x8,%esp
+     6bb:	56                   	push   %esi
+     6bc:	0f be 07             	movsbl (%edi),%eax
+     6bf:	50                   	push   %eax
+     6c0:	e8 cb 07 00 00       	call   e90 <putc_unlocked>
+  while(--i >= 0)
+     6c5:	89 f8                	mov    %edi,%eax
+     6c7:	83 c4 10             	add    $0x10,%esp
+     6ca:	83 ef 01             	sub    $0x1,%edi
+     6cd:	39 d8                	cmp    %ebx,%eax
+     6cf:	75 e7                	jne    6b8 <printint+0x68>
+}
+     6d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6d4:	5b                   	pop    %ebx
+     6d5:	5e                   	pop    %esi
+     6d6:	5f                   	pop    %edi
+     6d7:	5d                   	pop    %ebp
+     6d8:	c3                   	ret
+     6d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     6e0:	31 c0                	xor    %eax,%eax
+     6e2:	eb 8d                	jmp    671 <printint+0x21>
+     6e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6ef:	90                   	nop
+
+000006f0 <vfprintf>:
+
+// Print to the given stream, which the caller has locked.
+// Only understands %d, %x, %p, %s.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+     6f0:	55                   	push   %ebp
+     6f1:	89 e5                	mov    %esp,%ebp
+     6f3:	57                   	push   %edi
+     6f4:	56                   	push   %esi
+     6f5:	53                   	push   %ebx
+     6f6:	83 ec 1c             	sub    $0x1c,%esp
+     6f9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     6fc:	0f b6 0a             	movzbl (%edx),%ecx
+     6ff:	84 c9                	test   %cl,%cl
+     701:	74 5c                	je     75f <vfprintf+0x6f>
+     703:	89 c6                	mov    %eax,%esi
+     705:	8d 5a 01             	lea    0x1(%edx),%ebx
+     708:	31 ff                	xor    %edi,%edi
+     70a:	eb 20                	jmp    72c <vfprintf+0x3c>
+     70c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     710:	83 f9 25             	cmp    $0x25,%ecx
+     713:	74 3b                	je     750 <vfprintf+0x60>
+        state = '%';
+      } else {
+        putc_unlocked(c, f);
+     715:	83 ec 08             	sub    $0x8,%esp
+     718:	56                   	push   %esi
+     719:	51                   	push   %ecx
+     71a:	e8 71 07 00 00       	call   e90 <putc_unlocked>
+     71f:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     722:	0f b6 0b             	movzbl (%ebx),%ecx
+     725:	83 c3 01             	add    $0x1,%ebx
+     728:	84 c9                	test   %cl,%cl
+     72a:	74 33                	je     75f <vfprintf+0x6f>
+    if(state == 0){
+     72c:	85 ff                	test   %edi,%edi
+     72e:	74 e0                	je     710 <vfprintf+0x20>
+      }
+    } else if(state == '%'){
+     730:	83 ff 25             	cmp    $0x25,%edi
+     733:	75 ed                	jne    722 <vfprintf+0x32>
+      if(c == 'd'){
+     735:	83 f9 25             	cmp    $0x25,%ecx
+     738:	0f 84 02 01 00 00    	je     840 <vfprintf+0x150>
+     73e:	8d 41 9d             	lea    -0x63(%ecx),%eax
+     741:	83 f8 15             	cmp    $0x15,%eax
+     744:	77 2a                	ja     770 <vfprintf+0x80>
+     746:	ff 24 85 64 1d 00 00 	jmp    *0x1d64(,%eax,4)
+     74d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     750:	0f b6 0b             	movzbl (%ebx),%ecx
+     753:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     756:	bf 25 00 00 00       	mov    $0x25,%edi
+  for(i = 0; fmt[i]; i++){
+     75b:	84 c9                	test   %cl,%cl
+     75d:	75 cd                	jne    72c <vfprintf+0x3c>
+        putc_unlocked(c, f);
+      }
+      state = 0;
+    }
+  }
+}
+     75f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     762:	5b                   	pop    %ebx
+     763:	5e                   	pop    %esi
+     764:	5f                   	pop    %edi
+     765:	5d                   	pop    %ebp
+     766:	c3                   	ret
+     767:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     76e:	66 90                	xchg   %ax,%ax
+        putc_unlocked('%', f);
+     770:	83 ec 08             	sub    $0x8,%esp
+     773:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     776:	56                   	push   %esi
+     777:	6a 25                	push   $0x25
+     779:	e8 12 07 00 00       	call   e90 <putc_unlocked>
+        putc_unlocked(c, f);
+     77e:	58                   	pop    %eax
+     77f:	5a                   	pop    %edx
+     780:	56                   	push   %esi
+     781:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     784:	51                   	push   %ecx
+     785:	e8 06 07 00 00       	call   e90 <putc_unlocked>
+     78a:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     78d:	31 ff                	xor    %edi,%edi
+     78f:	eb 91                	jmp    722 <vfprintf+0x32>
+     791:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+     798:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     79b:	83 ec 0c             	sub    $0xc,%esp
+     79e:	b9 10 00 00 00       	mov    $0x10,%ecx
+     7a3:	8b 17                	mov    (%edi),%edx
+     7a5:	6a 00                	push   $0x0
+        ap++;
+     7a7:	83 c7 04             	add    $0x4,%edi
+        printint(f, *ap, 16, 0);
+     7aa:	89 f0                	mov    %esi,%eax
+     7ac:	e8 9f fe ff ff       	call   650 <printint>
+        ap++;
+     7b1:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     7b4:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     7b7:	31 ff                	xor    %edi,%edi
+     7b9:	e9 64 ff ff ff       	jmp    722 <vfprintf+0x32>
+     7be:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     7c0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     7c3:	8b 10                	mov    (%eax),%edx
+        ap++;
+     7c5:	83 c0 04             	add    $0x4,%eax
+     7c8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     7cb:	85 d2                	test   %edx,%edx
+     7cd:	0f 84 85 00 00 00    	je     858 <vfprintf+0x168>
+        while(*s != 0){
+     7d3:	0f be 02             	movsbl (%edx),%eax
+        s = (char*)*ap;
+     7d6:	89 d7                	mov    %edx,%edi
+        while(*s != 0){
+     7d8:	84 c0                	test   %al,%al
+     7da:	74 b1                	je     78d <vfprintf+0x9d>
+     7dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+          putc_unlocked(*s, f);
+     7e0:	83 ec 08             	sub    $0x8,%esp
+          s++;
+     7e3:	83 c7 01             	add    $0x1,%edi
+          putc_unlocked(*s, f);
+     7e6:	56                   	push   %esi
+     7e7:	50                   	push   %eax
+     7e8:	e8 a3 06 00 00       	call   e90 <putc_unlocked>
+        while(*s != 0){
+     7ed:	0f be 07             	movsbl (%edi),%eax
+     7f0:	83 c4 10             	add    $0x10,%esp
+     7f3:	84 c0                	test   %al,%al
+     7f5:	75 e9                	jne    7e0 <vfprintf+0xf0>
+      state = 0;
+     7f7:	31 ff                	xor    %edi,%edi
+     7f9:	e9 24 ff ff ff       	jmp    722 <vfprintf+0x32>
+     7fe:	66 90                	xchg   %ax,%ax
+        printint(f, *ap, 10, 1);
+     800:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     803:	83 ec 0c             	sub    $0xc,%esp
+     806:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     80b:	8b 17                	mov    (%edi),%edx
+     80d:	6a 01                	push   $0x1
+     80f:	eb 96                	jmp    7a7 <vfprintf+0xb7>
+     811:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc_unlocked(*ap, f);
+     818:	83 ec 08             	sub    $0x8,%esp
+     81b:	56                   	push   %esi
+     81c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     81f:	ff 37                	push   (%edi)
+     821:	e8 6a 06 00 00       	call   e90 <putc_unlocked>
+        ap++;
+     826:	89 f8                	mov    %edi,%eax
+     828:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     82b:	31 ff                	xor    %edi,%edi
+        ap++;
+     82d:	83 c0 04             	add    $0x4,%eax
+     830:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     833:	e9 ea fe ff ff       	jmp    722 <vfprintf+0x32>
+     838:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     83f:	90                   	nop
+        putc_unlocked(c, f);
+     840:	83 ec 08             	sub    $0x8,%esp
+      state = 0;
+     843:	31 ff                	xor    %edi,%edi
+        putc_unlocked(c, f);
+     845:	56                   	push   %esi
+     846:	6a 25                	push   $0x25
+     848:	e8 43 06 00 00       	call   e90 <putc_unlocked>
+     84d:	83 c4 10             	add    $0x10,%esp
+     850:	e9 cd fe ff ff       	jmp    722 <vfprintf+0x32>
+     855:	8d 76 00             	lea    0x0(%esi),%esi
+     858:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     85d:	bf 5b 1d 00 00       	mov    $0x1d5b,%edi
+     862:	e9 79 ff ff ff       	jmp    7e0 <vfprintf+0xf0>
+     867:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     86e:	66 90                	xchg   %ax,%ax
+
+00000870 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+     870:	55                   	push   %ebp
+     871:	89 e5                	mov    %esp,%ebp
+     873:	53                   	push   %ebx
+     874:	83 ec 10             	sub    $0x10,%esp
+     877:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  flockfile(f);
+     87a:	53                   	push   %ebx
+     87b:	e8 d0 02 00 00       	call   b50 <flockfile>
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     880:	8b 55 0c             	mov    0xc(%ebp),%edx
+     883:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     886:	89 d8                	mov    %ebx,%eax
+     888:	e8 63 fe ff ff       	call   6f0 <vfprintf>
+  funlockfile(f);
+     88d:	89 1c 24             	mov    %ebx,(%esp)
+     890:	e8 eb 02 00 00       	call   b80 <funlockfile>
+}
+     895:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     898:	83 c4 10             	add    $0x10,%esp
+     89b:	c9                   	leave
+     89c:	c3                   	ret
+     89d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008a0 <printf>:
+
+// Print to the given fd: through stdout or stderr for 1 and 2,
+// otherwise with one write() per call.
+void
+printf(int fd, const char *fmt, ...)
+{
+     8a0:	55                   	push   %ebp
+     8a1:	89 e5                	mov    %esp,%ebp
+     8a3:	56                   	push   %esi
+     8a4:	53                   	push   %ebx
+     8a5:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+     8ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  char buf[128];
+  struct iobuf f;
+
+  if(fd == 1 || fd == 2){
+    flockfile(&_iob[fd]);
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     8ae:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(fd == 1 || fd == 2){
+     8b1:	8d 50 ff             	lea    -0x1(%eax),%edx
+     8b4:	83 fa 01             	cmp    $0x1,%edx
+     8b7:	76 77                	jbe    930 <printf+0x90>
+    funlockfile(&_iob[fd]);
+    return;
+  }
+  f.fd = fd;
+     8b9:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  f.flags = IO_WRITE|IO_SETUP;
+  f.buf = buf;
+     8bf:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  f.size = sizeof(buf);
+  f.r = f.n = 0;
+  mutex_init(&f.lock);
+     8c5:	83 ec 0c             	sub    $0xc,%esp
+     8c8:	8d 9d 5c ff ff ff    	lea    -0xa4(%ebp),%ebx
+  f.buf = buf;
+     8ce:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+  mutex_init(&f.lock);
+     8d4:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  f.flags = IO_WRITE|IO_SETUP;
+     8da:	c7 85 60 ff ff ff 42 	movl   $0x42,-0xa0(%ebp)
+     8e1:	00 00 00 
+  f.size = sizeof(buf);
+     8e4:	c7 85 68 ff ff ff 80 	movl   $0x80,-0x98(%ebp)
+     8eb:	00 00 00 
+  f.r = f.n = 0;
+     8ee:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+     8f5:	00 00 00 
+     8f8:	c7 85 6c ff ff ff 00 	movl   $0x0,-0x94(%ebp)
+     8ff:	00 00 00 
+  mutex_init(&f.lock);
+     902:	50                   	push   %eax
+     903:	e8 d8 f9 ff ff       	call   2e0 <mutex_init>
+  vfprintf(&f, fmt, (uint*)(void*)&fmt + 1);
+     908:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     90b:	89 f2                	mov    %esi,%edx
+     90d:	89 d8                	mov    %ebx,%eax
+     90f:	e8 dc fd ff ff       	call   6f0 <vfprintf>
+  fflush(&f);
+     914:	89 1c 24             	mov    %ebx,(%esp)
+     917:	e8 f4 04 00 00       	call   e10 <fflush>
+     91c:	83 c4 10             	add    $0x10,%esp
+}
+     91f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     922:	5b                   	pop    %ebx
+     923:	5e                   	pop    %esi
+     924:	5d                   	pop    %ebp
+     925:	c3                   	ret
+     926:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     92d:	8d 76 00             	lea    0x0(%esi),%esi
+    flockfile(&_iob[fd]);
+     930:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     933:	83 ec 0c             	sub    $0xc,%esp
+     936:	8d 98 40 27 00 00    	lea    0x2740(%eax),%ebx
+     93c:	53                   	push   %ebx
+     93d:	e8 0e 02 00 00       	call   b50 <flockfile>
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     942:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     945:	89 f2                	mov    %esi,%edx
+     947:	89 d8                	mov    %ebx,%eax
+     949:	e8 a2 fd ff ff       	call   6f0 <vfprintf>
+    funlockfile(&_iob[fd]);
+     94e:	89 1c 24             	mov    %ebx,(%esp)
+     951:	e8 2a 02 00 00       	call   b80 <funlockfile>
+     956:	83 c4 10             	add    $0x10,%esp
+}
+     959:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     95c:	5b                   	pop    %ebx
+     95d:	5e                   	pop    %esi
+     95e:	5d                   	pop    %ebp
+     95f:	c3                   	ret
+
+00000960 <setup>:
+}
+
+// Choose how to buffer f on first use: by lines on a device.
+static void
+setup(FILE *f)
+{
+     960:	55                   	push   %ebp
+     961:	89 e5                	mov    %esp,%ebp
+     963:	53                   	push   %ebx
+     964:	89 c3                	mov    %eax,%ebx
+     966:	83 ec 2c             	sub    $0x2c,%esp
+  struct stat st;
+
+  f->flags |= IO_SETUP;
+     969:	83 48 04 40          	orl    $0x40,0x4(%eax)
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     96d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     970:	50                   	push   %eax
+     971:	ff 33                	push   (%ebx)
+     973:	e8 52 fb ff ff       	call   4ca <fstat>
+     978:	83 c4 10             	add    $0x10,%esp
+     97b:	85 c0                	test   %eax,%eax
+    f->flags |= IO_DEV|IO_LINE;
+     97d:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     980:	75 07                	jne    989 <setup+0x29>
+     982:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+     987:	74 17                	je     9a0 <setup+0x40>
+  if(f->flags & IO_WRITE)
+     989:	a8 02                	test   $0x2,%al
+     98b:	74 0a                	je     997 <setup+0x37>
+    flushhook = flushall;
+     98d:	c7 05 20 28 00 00 c0 	movl   $0xac0,0x2820
+     994:	0a 00 00 
+}
+     997:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     99a:	c9                   	leave
+     99b:	c3                   	ret
+     99c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    f->flags |= IO_DEV|IO_LINE;
+     9a0:	83 c8 30             	or     $0x30,%eax
+     9a3:	89 43 04             	mov    %eax,0x4(%ebx)
+     9a6:	eb e1                	jmp    989 <setup+0x29>
+     9a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9af:	90                   	nop
+
+000009b0 <flush>:
+static int
+flush(FILE *f)
+{
+  int i, n;
+
+  if(!(f->flags & IO_WRITE))
+     9b0:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+     9b4:	74 6a                	je     a20 <flush+0x70>
+{
+     9b6:	55                   	push   %ebp
+     9b7:	89 e5                	mov    %esp,%ebp
+     9b9:	56                   	push   %esi
+     9ba:	89 c6                	mov    %eax,%esi
+     9bc:	53                   	push   %ebx
+    return 0;
+  for(i = 0; i < f->n; i += n){
+     9bd:	8b 40 14             	mov    0x14(%eax),%eax
+     9c0:	85 c0                	test   %eax,%eax
+     9c2:	7e 4c                	jle    a10 <flush+0x60>
+     9c4:	31 db                	xor    %ebx,%ebx
+     9c6:	eb 11                	jmp    9d9 <flush+0x29>
+     9c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9cf:	90                   	nop
+     9d0:	01 c3                	add    %eax,%ebx
+     9d2:	8b 46 14             	mov    0x14(%esi),%eax
+     9d5:	39 d8                	cmp    %ebx,%eax
+     9d7:	7e 37                	jle    a10 <flush+0x60>
+    if((n = write(f->fd, f->buf + i, f->n - i)) <= 0){
+     9d9:	83 ec 04             	sub    $0x4,%esp
+     9dc:	29 d8                	sub    %ebx,%eax
+     9de:	50                   	push   %eax
+     9df:	8b 46 08             	mov    0x8(%esi),%eax
+     9e2:	01 d8                	add    %ebx,%eax
+     9e4:	50                   	push   %eax
+     9e5:	ff 36                	push   (%esi)
+     9e7:	e8 75 fa ff ff       	call   461 <write>
+     9ec:	83 c4 10             	add    $0x10,%esp
+     9ef:	85 c0                	test   %eax,%eax
+     9f1:	7f dd                	jg     9d0 <flush+0x20>
+      f->flags |= IO_ERR;
+     9f3:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+      f->n = 0;
+     9f7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     9fc:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+      return EOF;
+    }
+  }
+  f->n = 0;
+  return 0;
+}
+     a03:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     a06:	5b                   	pop    %ebx
+     a07:	5e                   	pop    %esi
+     a08:	5d                   	pop    %ebp
+     a09:	c3                   	ret
+     a0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->n = 0;
+     a10:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+}
+     a17:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+     a1a:	31 c0                	xor    %eax,%eax
+}
+     a1c:	5b                   	pop    %ebx
+     a1d:	5e                   	pop    %esi
+     a1e:	5d                   	pop    %ebp
+     a1f:	c3                   	ret
+    return 0;
+     a20:	31 c0                	xor    %eax,%eax
+}
+     a22:	c3                   	ret
+     a23:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a30 <fflush.part.0>:
+fflush(FILE *f)
+     a30:	55                   	push   %ebp
+     a31:	89 e5                	mov    %esp,%ebp
+     a33:	57                   	push   %edi
+     a34:	bf 38 28 00 00       	mov    $0x2838,%edi
+     a39:	56                   	push   %esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     a3a:	31 f6                	xor    %esi,%esi
+fflush(FILE *f)
+     a3c:	53                   	push   %ebx
+     a3d:	bb 58 27 00 00       	mov    $0x2758,%ebx
+     a42:	83 ec 1c             	sub    $0x1c,%esp
+     a45:	eb 10                	jmp    a57 <fflush.part.0+0x27>
+     a47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a4e:	66 90                	xchg   %ax,%ax
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     a50:	83 c3 1c             	add    $0x1c,%ebx
+     a53:	39 df                	cmp    %ebx,%edi
+     a55:	74 33                	je     a8a <fflush.part.0+0x5a>
+      if((f->flags & IO_WRITE) && fflush(f) < 0)
+     a57:	f6 43 ec 02          	testb  $0x2,-0x14(%ebx)
+     a5b:	74 f3                	je     a50 <fflush.part.0+0x20>
+  if(threaded)
+     a5d:	8b 0d 40 28 00 00    	mov    0x2840,%ecx
+     a63:	85 c9                	test   %ecx,%ecx
+     a65:	75 49                	jne    ab0 <fflush.part.0+0x80>
+  r = flush(f);
+     a67:	8d 43 e8             	lea    -0x18(%ebx),%eax
+     a6a:	e8 41 ff ff ff       	call   9b0 <flush>
+  if(threaded)
+     a6f:	8b 15 40 28 00 00    	mov    0x2840,%edx
+     a75:	85 d2                	test   %edx,%edx
+     a77:	75 1f                	jne    a98 <fflush.part.0+0x68>
+        r = EOF;
+     a79:	85 c0                	test   %eax,%eax
+     a7b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     a80:	0f 48 f0             	cmovs  %eax,%esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     a83:	83 c3 1c             	add    $0x1c,%ebx
+     a86:	39 df                	cmp    %ebx,%edi
+     a88:	75 cd                	jne    a57 <fflush.part.0+0x27>
+}
+     a8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a8d:	89 f0                	mov    %esi,%eax
+     a8f:	5b                   	pop    %ebx
+     a90:	5e                   	pop    %esi
+     a91:	5f                   	pop    %edi
+     a92:	5d                   	pop    %ebp
+     a93:	c3                   	ret
+     a94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     a98:	83 ec 0c             	sub    $0xc,%esp
+     a9b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     a9e:	53                   	push   %ebx
+     a9f:	e8 9c f8 ff ff       	call   340 <mutex_unlock>
+     aa4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     aa7:	83 c4 10             	add    $0x10,%esp
+     aaa:	eb cd                	jmp    a79 <fflush.part.0+0x49>
+     aac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     ab0:	83 ec 0c             	sub    $0xc,%esp
+     ab3:	53                   	push   %ebx
+     ab4:	e8 37 f8 ff ff       	call   2f0 <mutex_lock>
+     ab9:	83 c4 10             	add    $0x10,%esp
+     abc:	eb a9                	jmp    a67 <fflush.part.0+0x37>
+     abe:	66 90                	xchg   %ax,%ax
+
+00000ac0 <flushall>:
+  if(f == 0){
+     ac0:	e9 6b ff ff ff       	jmp    a30 <fflush.part.0>
+     ac5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     acc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ad0 <fill>:
+
+// Refill f's buffer. Returns the number of bytes read.
+// Caller holds f's lock.
+static int
+fill(FILE *f)
+{
+     ad0:	55                   	push   %ebp
+     ad1:	89 e5                	mov    %esp,%ebp
+     ad3:	53                   	push   %ebx
+     ad4:	89 c3                	mov    %eax,%ebx
+     ad6:	83 ec 04             	sub    $0x4,%esp
+  int n;
+
+  if(!(f->flags & IO_SETUP))
+     ad9:	8b 40 04             	mov    0x4(%eax),%eax
+     adc:	a8 40                	test   $0x40,%al
+     ade:	74 50                	je     b30 <fill+0x60>
+    setup(f);
+  if(f->flags & IO_DEV)
+     ae0:	a8 20                	test   $0x20,%al
+     ae2:	75 3c                	jne    b20 <fill+0x50>
+    fflush(0);
+  f->r = 0;
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     ae4:	83 ec 04             	sub    $0x4,%esp
+  f->r = 0;
+     ae7:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     aee:	ff 73 0c             	push   0xc(%ebx)
+     af1:	ff 73 08             	push   0x8(%ebx)
+     af4:	ff 33                	push   (%ebx)
+     af6:	e8 57 f9 ff ff       	call   452 <read>
+     afb:	83 c4 10             	add    $0x10,%esp
+     afe:	85 c0                	test   %eax,%eax
+     b00:	7f 10                	jg     b12 <fill+0x42>
+    f->flags |= n < 0 ? IO_ERR : IO_EOF;
+     b02:	83 f8 01             	cmp    $0x1,%eax
+     b05:	19 c0                	sbb    %eax,%eax
+     b07:	83 e0 fc             	and    $0xfffffffc,%eax
+     b0a:	83 c0 08             	add    $0x8,%eax
+     b0d:	09 43 04             	or     %eax,0x4(%ebx)
+    n = 0;
+     b10:	31 c0                	xor    %eax,%eax
+  }
+  f->n = n;
+     b12:	89 43 14             	mov    %eax,0x14(%ebx)
+  return n;
+}
+     b15:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b18:	c9                   	leave
+     b19:	c3                   	ret
+     b1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == 0){
+     b20:	e8 0b ff ff ff       	call   a30 <fflush.part.0>
+     b25:	eb bd                	jmp    ae4 <fill+0x14>
+     b27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b2e:	66 90                	xchg   %ax,%ax
+    setup(f);
+     b30:	89 d8                	mov    %ebx,%eax
+     b32:	e8 29 fe ff ff       	call   960 <setup>
+  if(f->flags & IO_DEV)
+     b37:	8b 43 04             	mov    0x4(%ebx),%eax
+     b3a:	eb a4                	jmp    ae0 <fill+0x10>
+     b3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b40 <stdio_threaded>:
+  threaded = 1;
+     b40:	c7 05 40 28 00 00 01 	movl   $0x1,0x2840
+     b47:	00 00 00 
+}
+     b4a:	c3                   	ret
+     b4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b4f:	90                   	nop
+
+00000b50 <flockfile>:
+{
+     b50:	55                   	push   %ebp
+  if(threaded)
+     b51:	8b 15 40 28 00 00    	mov    0x2840,%edx
+{
+     b57:	89 e5                	mov    %esp,%ebp
+     b59:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     b5c:	85 d2                	test   %edx,%edx
+     b5e:	75 08                	jne    b68 <flockfile+0x18>
+}
+     b60:	5d                   	pop    %ebp
+     b61:	c3                   	ret
+     b62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_lock(&f->lock);
+     b68:	83 c0 18             	add    $0x18,%eax
+     b6b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     b6e:	5d                   	pop    %ebp
+    mutex_lock(&f->lock);
+     b6f:	e9 7c f7 ff ff       	jmp    2f0 <mutex_lock>
+     b74:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b7f:	90                   	nop
+
+00000b80 <funlockfile>:
+{
+     b80:	55                   	push   %ebp
+  if(threaded)
+     b81:	8b 15 40 28 00 00    	mov    0x2840,%edx
+{
+     b87:	89 e5                	mov    %esp,%ebp
+     b89:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     b8c:	85 d2                	test   %edx,%edx
+     b8e:	75 08                	jne    b98 <funlockfile+0x18>
+}
+     b90:	5d                   	pop    %ebp
+     b91:	c3                   	ret
+     b92:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&f->lock);
+     b98:	83 c0 18             	add    $0x18,%eax
+     b9b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     b9e:	5d                   	pop    %ebp
+    mutex_unlock(&f->lock);
+     b9f:	e9 9c f7 ff ff       	jmp    340 <mutex_unlock>
+     ba4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     baf:	90                   	nop
+
+00000bb0 <fopen>:
+{
+     bb0:	55                   	push   %ebp
+     bb1:	89 e5                	mov    %esp,%ebp
+     bb3:	57                   	push   %edi
+     bb4:	56                   	push   %esi
+     bb5:	53                   	push   %ebx
+     bb6:	83 ec 34             	sub    $0x34,%esp
+     bb9:	8b 75 0c             	mov    0xc(%ebp),%esi
+     bbc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(strcmp(mode, "r") != 0 && strcmp(mode, "w") != 0)
+     bbf:	68 cd 1d 00 00       	push   $0x1dcd
+     bc4:	56                   	push   %esi
+     bc5:	e8 66 f5 ff ff       	call   130 <strcmp>
+     bca:	83 c4 10             	add    $0x10,%esp
+     bcd:	85 c0                	test   %eax,%eax
+     bcf:	74 15                	je     be6 <fopen+0x36>
+     bd1:	83 ec 08             	sub    $0x8,%esp
+     bd4:	68 cf 1d 00 00       	push   $0x1dcf
+     bd9:	56                   	push   %esi
+     bda:	e8 51 f5 ff ff       	call   130 <strcmp>
+     bdf:	83 c4 10             	add    $0x10,%esp
+     be2:	85 c0                	test   %eax,%eax
+     be4:	75 2c                	jne    c12 <fopen+0x62>
+  if(threaded)
+     be6:	a1 40 28 00 00       	mov    0x2840,%eax
+     beb:	85 c0                	test   %eax,%eax
+     bed:	0f 85 ed 00 00 00    	jne    ce0 <fopen+0x130>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     bf3:	bb 94 27 00 00       	mov    $0x2794,%ebx
+    if(f->flags == 0)
+     bf8:	8b 53 04             	mov    0x4(%ebx),%edx
+     bfb:	85 d2                	test   %edx,%edx
+     bfd:	74 21                	je     c20 <fopen+0x70>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     bff:	83 c3 1c             	add    $0x1c,%ebx
+     c02:	81 fb 20 28 00 00    	cmp    $0x2820,%ebx
+     c08:	75 ee                	jne    bf8 <fopen+0x48>
+  if(threaded)
+     c0a:	85 c0                	test   %eax,%eax
+     c0c:	0f 85 36 01 00 00    	jne    d48 <fopen+0x198>
+    return 0;
+     c12:	31 db                	xor    %ebx,%ebx
+     c14:	e9 96 00 00 00       	jmp    caf <fopen+0xff>
+     c19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f == &_iob[NSTREAM])
+     c20:	81 fb 20 28 00 00    	cmp    $0x2820,%ebx
+     c26:	74 e2                	je     c0a <fopen+0x5a>
+    f->flags = IO_MALLOC;
+     c28:	c7 43 04 80 00 00 00 	movl   $0x80,0x4(%ebx)
+  if(threaded)
+     c2f:	85 c0                	test   %eax,%eax
+     c31:	0f 85 f9 00 00 00    	jne    d30 <fopen+0x180>
+  if(mode[0] == 'r'){
+     c37:	80 3e 72             	cmpb   $0x72,(%esi)
+     c3a:	0f 84 c0 00 00 00    	je     d00 <fopen+0x150>
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     c40:	83 ec 08             	sub    $0x8,%esp
+     c43:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     c46:	50                   	push   %eax
+     c47:	57                   	push   %edi
+     c48:	e8 d3 f5 ff ff       	call   220 <stat>
+     c4d:	83 c4 10             	add    $0x10,%esp
+     c50:	85 c0                	test   %eax,%eax
+     c52:	74 6c                	je     cc0 <fopen+0x110>
+    fd = open(path, O_CREATE|O_WRONLY);
+     c54:	83 ec 08             	sub    $0x8,%esp
+     c57:	68 01 02 00 00       	push   $0x201
+     c5c:	57                   	push   %edi
+    flags = IO_WRITE;
+     c5d:	bf 02 00 00 00       	mov    $0x2,%edi
+    fd = open(path, O_CREATE|O_WRONLY);
+     c62:	e8 36 f8 ff ff       	call   49d <open>
+     c67:	83 c4 10             	add    $0x10,%esp
+     c6a:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     c6c:	85 f6                	test   %esi,%esi
+     c6e:	0f 88 a9 00 00 00    	js     d1d <fopen+0x16d>
+     c74:	83 ec 0c             	sub    $0xc,%esp
+     c77:	68 00 02 00 00       	push   $0x200
+     c7c:	e8 af 0c 00 00       	call   1930 <malloc>
+     c81:	83 c4 10             	add    $0x10,%esp
+     c84:	89 43 08             	mov    %eax,0x8(%ebx)
+     c87:	85 c0                	test   %eax,%eax
+     c89:	0f 84 d0 00 00 00    	je     d5f <fopen+0x1af>
+  f->flags = flags|IO_MALLOC;
+     c8f:	81 cf 80 00 00 00    	or     $0x80,%edi
+  f->fd = fd;
+     c95:	89 33                	mov    %esi,(%ebx)
+  f->size = BUFSIZ;
+     c97:	c7 43 0c 00 02 00 00 	movl   $0x200,0xc(%ebx)
+  f->r = f->n = 0;
+     c9e:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+     ca5:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  f->flags = flags|IO_MALLOC;
+     cac:	89 7b 04             	mov    %edi,0x4(%ebx)
+}
+     caf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cb2:	89 d8                	mov    %ebx,%eax
+     cb4:	5b                   	pop    %ebx
+     cb5:	5e                   	pop    %esi
+     cb6:	5f                   	pop    %edi
+     cb7:	5d                   	pop    %ebp
+     cb8:	c3                   	ret
+     cb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     cc0:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+     cc5:	75 8d                	jne    c54 <fopen+0xa4>
+      unlink(path);
+     cc7:	83 ec 0c             	sub    $0xc,%esp
+     cca:	57                   	push   %edi
+     ccb:	e8 eb f7 ff ff       	call   4bb <unlink>
+     cd0:	83 c4 10             	add    $0x10,%esp
+     cd3:	e9 7c ff ff ff       	jmp    c54 <fopen+0xa4>
+     cd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cdf:	90                   	nop
+    mutex_lock(&iolock);
+     ce0:	83 ec 0c             	sub    $0xc,%esp
+     ce3:	68 44 28 00 00       	push   $0x2844
+     ce8:	e8 03 f6 ff ff       	call   2f0 <mutex_lock>
+  if(threaded)
+     ced:	a1 40 28 00 00       	mov    0x2840,%eax
+     cf2:	83 c4 10             	add    $0x10,%esp
+     cf5:	e9 f9 fe ff ff       	jmp    bf3 <fopen+0x43>
+     cfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    fd = open(path, O_RDONLY);
+     d00:	83 ec 08             	sub    $0x8,%esp
+     d03:	6a 00                	push   $0x0
+     d05:	57                   	push   %edi
+    flags = IO_READ;
+     d06:	bf 01 00 00 00       	mov    $0x1,%edi
+    fd = open(path, O_RDONLY);
+     d0b:	e8 8d f7 ff ff       	call   49d <open>
+     d10:	83 c4 10             	add    $0x10,%esp
+     d13:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     d15:	85 f6                	test   %esi,%esi
+     d17:	0f 89 57 ff ff ff    	jns    c74 <fopen+0xc4>
+    f->flags = 0;
+     d1d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    return 0;
+     d24:	31 db                	xor    %ebx,%ebx
+     d26:	eb 87                	jmp    caf <fopen+0xff>
+     d28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d2f:	90                   	nop
+    mutex_unlock(&iolock);
+     d30:	83 ec 0c             	sub    $0xc,%esp
+     d33:	68 44 28 00 00       	push   $0x2844
+     d38:	e8 03 f6 ff ff       	call   340 <mutex_unlock>
+     d3d:	83 c4 10             	add    $0x10,%esp
+     d40:	e9 f2 fe ff ff       	jmp    c37 <fopen+0x87>
+     d45:	8d 76 00             	lea    0x0(%esi),%esi
+     d48:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+     d4b:	31 db                	xor    %ebx,%ebx
+    mutex_unlock(&iolock);
+     d4d:	68 44 28 00 00       	push   $0x2844
+     d52:	e8 e9 f5 ff ff       	call   340 <mutex_unlock>
+     d57:	83 c4 10             	add    $0x10,%esp
+     d5a:	e9 50 ff ff ff       	jmp    caf <fopen+0xff>
+      close(fd);
+     d5f:	83 ec 0c             	sub    $0xc,%esp
+     d62:	56                   	push   %esi
+     d63:	e8 08 f7 ff ff       	call   470 <close>
+     d68:	83 c4 10             	add    $0x10,%esp
+     d6b:	eb b0                	jmp    d1d <fopen+0x16d>
+     d6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d70 <fclose>:
+{
+     d70:	55                   	push   %ebp
+     d71:	89 e5                	mov    %esp,%ebp
+     d73:	56                   	push   %esi
+     d74:	53                   	push   %ebx
+  if(threaded)
+     d75:	8b 15 40 28 00 00    	mov    0x2840,%edx
+{
+     d7b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+     d7e:	85 d2                	test   %edx,%edx
+     d80:	75 46                	jne    dc8 <fclose+0x58>
+  r = flush(f);
+     d82:	89 d8                	mov    %ebx,%eax
+     d84:	e8 27 fc ff ff       	call   9b0 <flush>
+  if(close(f->fd) < 0)
+     d89:	83 ec 0c             	sub    $0xc,%esp
+     d8c:	ff 33                	push   (%ebx)
+  r = flush(f);
+     d8e:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+     d90:	e8 db f6 ff ff       	call   470 <close>
+     d95:	83 c4 10             	add    $0x10,%esp
+    r = EOF;
+     d98:	85 c0                	test   %eax,%eax
+     d9a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     d9f:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->flags & IO_MALLOC)
+     da2:	f6 43 04 80          	testb  $0x80,0x4(%ebx)
+     da6:	75 58                	jne    e00 <fclose+0x90>
+  if(threaded)
+     da8:	a1 40 28 00 00       	mov    0x2840,%eax
+  f->flags = 0;
+     dad:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  if(threaded)
+     db4:	85 c0                	test   %eax,%eax
+     db6:	75 28                	jne    de0 <fclose+0x70>
+}
+     db8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     dbb:	89 f0                	mov    %esi,%eax
+     dbd:	5b                   	pop    %ebx
+     dbe:	5e                   	pop    %esi
+     dbf:	5d                   	pop    %ebp
+     dc0:	c3                   	ret
+     dc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     dc8:	83 ec 0c             	sub    $0xc,%esp
+     dcb:	8d 43 18             	lea    0x18(%ebx),%eax
+     dce:	50                   	push   %eax
+     dcf:	e8 1c f5 ff ff       	call   2f0 <mutex_lock>
+     dd4:	83 c4 10             	add    $0x10,%esp
+     dd7:	eb a9                	jmp    d82 <fclose+0x12>
+     dd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     de0:	83 ec 0c             	sub    $0xc,%esp
+     de3:	83 c3 18             	add    $0x18,%ebx
+     de6:	53                   	push   %ebx
+     de7:	e8 54 f5 ff ff       	call   340 <mutex_unlock>
+     dec:	83 c4 10             	add    $0x10,%esp
+}
+     def:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     df2:	89 f0                	mov    %esi,%eax
+     df4:	5b                   	pop    %ebx
+     df5:	5e                   	pop    %esi
+     df6:	5d                   	pop    %ebp
+     df7:	c3                   	ret
+     df8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dff:	90                   	nop
+    free(f->buf);
+     e00:	83 ec 0c             	sub    $0xc,%esp
+     e03:	ff 73 08             	push   0x8(%ebx)
+     e06:	e8 f5 09 00 00       	call   1800 <free>
+     e0b:	83 c4 10             	add    $0x10,%esp
+     e0e:	eb 98                	jmp    da8 <fclose+0x38>
+
+00000e10 <fflush>:
+{
+     e10:	55                   	push   %ebp
+     e11:	89 e5                	mov    %esp,%ebp
+     e13:	53                   	push   %ebx
+     e14:	83 ec 14             	sub    $0x14,%esp
+     e17:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f == 0){
+     e1a:	85 db                	test   %ebx,%ebx
+     e1c:	74 5a                	je     e78 <fflush+0x68>
+  if(threaded)
+     e1e:	8b 0d 40 28 00 00    	mov    0x2840,%ecx
+     e24:	85 c9                	test   %ecx,%ecx
+     e26:	75 18                	jne    e40 <fflush+0x30>
+  r = flush(f);
+     e28:	89 d8                	mov    %ebx,%eax
+     e2a:	e8 81 fb ff ff       	call   9b0 <flush>
+  if(threaded)
+     e2f:	8b 15 40 28 00 00    	mov    0x2840,%edx
+     e35:	85 d2                	test   %edx,%edx
+     e37:	75 1f                	jne    e58 <fflush+0x48>
+}
+     e39:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e3c:	c9                   	leave
+     e3d:	c3                   	ret
+     e3e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+     e40:	83 ec 0c             	sub    $0xc,%esp
+     e43:	8d 43 18             	lea    0x18(%ebx),%eax
+     e46:	50                   	push   %eax
+     e47:	e8 a4 f4 ff ff       	call   2f0 <mutex_lock>
+     e4c:	83 c4 10             	add    $0x10,%esp
+     e4f:	eb d7                	jmp    e28 <fflush+0x18>
+     e51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     e58:	83 ec 0c             	sub    $0xc,%esp
+     e5b:	83 c3 18             	add    $0x18,%ebx
+     e5e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     e61:	53                   	push   %ebx
+     e62:	e8 d9 f4 ff ff       	call   340 <mutex_unlock>
+     e67:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     e6a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    mutex_unlock(&f->lock);
+     e6d:	83 c4 10             	add    $0x10,%esp
+}
+     e70:	c9                   	leave
+     e71:	c3                   	ret
+     e72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     e78:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e7b:	c9                   	leave
+     e7c:	e9 af fb ff ff       	jmp    a30 <fflush.part.0>
+     e81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e8f:	90                   	nop
+
+00000e90 <putc_unlocked>:
+{
+     e90:	55                   	push   %ebp
+     e91:	89 e5                	mov    %esp,%ebp
+     e93:	56                   	push   %esi
+     e94:	53                   	push   %ebx
+     e95:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     e98:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(!(f->flags & IO_WRITE))
+     e9b:	8b 43 04             	mov    0x4(%ebx),%eax
+     e9e:	a8 02                	test   $0x2,%al
+     ea0:	74 46                	je     ee8 <putc_unlocked+0x58>
+  if(!(f->flags & IO_SETUP))
+     ea2:	a8 40                	test   $0x40,%al
+     ea4:	74 4a                	je     ef0 <putc_unlocked+0x60>
+  if(f->n == f->size && flush(f) < 0)
+     ea6:	8b 43 14             	mov    0x14(%ebx),%eax
+     ea9:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     eac:	74 51                	je     eff <putc_unlocked+0x6f>
+  f->buf[f->n++] = c;
+     eae:	8d 48 01             	lea    0x1(%eax),%ecx
+     eb1:	8b 53 08             	mov    0x8(%ebx),%edx
+     eb4:	89 4b 14             	mov    %ecx,0x14(%ebx)
+     eb7:	89 f1                	mov    %esi,%ecx
+     eb9:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     ebc:	83 fe 0a             	cmp    $0xa,%esi
+     ebf:	74 0f                	je     ed0 <putc_unlocked+0x40>
+  return c & 0xff;
+     ec1:	89 f0                	mov    %esi,%eax
+     ec3:	0f b6 c0             	movzbl %al,%eax
+}
+     ec6:	5b                   	pop    %ebx
+     ec7:	5e                   	pop    %esi
+     ec8:	5d                   	pop    %ebp
+     ec9:	c3                   	ret
+     eca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     ed0:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+     ed4:	74 eb                	je     ec1 <putc_unlocked+0x31>
+     ed6:	89 d8                	mov    %ebx,%eax
+     ed8:	e8 d3 fa ff ff       	call   9b0 <flush>
+     edd:	85 c0                	test   %eax,%eax
+     edf:	79 e0                	jns    ec1 <putc_unlocked+0x31>
+     ee1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return EOF;
+     ee8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     eed:	eb d7                	jmp    ec6 <putc_unlocked+0x36>
+     eef:	90                   	nop
+    setup(f);
+     ef0:	89 d8                	mov    %ebx,%eax
+     ef2:	e8 69 fa ff ff       	call   960 <setup>
+  if(f->n == f->size && flush(f) < 0)
+     ef7:	8b 43 14             	mov    0x14(%ebx),%eax
+     efa:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     efd:	75 af                	jne    eae <putc_unlocked+0x1e>
+     eff:	89 d8                	mov    %ebx,%eax
+     f01:	e8 aa fa ff ff       	call   9b0 <flush>
+     f06:	85 c0                	test   %eax,%eax
+     f08:	78 de                	js     ee8 <putc_unlocked+0x58>
+  f->buf[f->n++] = c;
+     f0a:	8b 43 14             	mov    0x14(%ebx),%eax
+     f0d:	eb 9f                	jmp    eae <putc_unlocked+0x1e>
+     f0f:	90                   	nop
+
+00000f10 <fputc>:
+{
+     f10:	55                   	push   %ebp
+     f11:	89 e5                	mov    %esp,%ebp
+     f13:	56                   	push   %esi
+     f14:	53                   	push   %ebx
+  if(threaded)
+     f15:	8b 15 40 28 00 00    	mov    0x2840,%edx
+{
+     f1b:	8b 75 08             	mov    0x8(%ebp),%esi
+     f1e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(threaded)
+     f21:	85 d2                	test   %edx,%edx
+     f23:	75 6b                	jne    f90 <fputc+0x80>
+  if(!(f->flags & IO_WRITE))
+     f25:	8b 43 04             	mov    0x4(%ebx),%eax
+     f28:	a8 02                	test   $0x2,%al
+     f2a:	0f 84 b8 00 00 00    	je     fe8 <fputc+0xd8>
+  if(!(f->flags & IO_SETUP))
+     f30:	a8 40                	test   $0x40,%al
+     f32:	74 76                	je     faa <fputc+0x9a>
+  if(f->n == f->size && flush(f) < 0)
+     f34:	8b 43 14             	mov    0x14(%ebx),%eax
+     f37:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     f3a:	74 7d                	je     fb9 <fputc+0xa9>
+  f->buf[f->n++] = c;
+     f3c:	8d 48 01             	lea    0x1(%eax),%ecx
+     f3f:	8b 53 08             	mov    0x8(%ebx),%edx
+     f42:	89 4b 14             	mov    %ecx,0x14(%ebx)
+     f45:	89 f1                	mov    %esi,%ecx
+     f47:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     f4a:	83 fe 0a             	cmp    $0xa,%esi
+     f4d:	74 21                	je     f70 <fputc+0x60>
+  return c & 0xff;
+     f4f:	89 f0                	mov    %esi,%eax
+     f51:	0f b6 f0             	movzbl %al,%esi
+  if(threaded)
+     f54:	a1 40 28 00 00       	mov    0x2840,%eax
+     f59:	85 c0                	test   %eax,%eax
+     f5b:	75 73                	jne    fd0 <fputc+0xc0>
+}
+     f5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f60:	89 f0                	mov    %esi,%eax
+     f62:	5b                   	pop    %ebx
+     f63:	5e                   	pop    %esi
+     f64:	5d                   	pop    %ebp
+     f65:	c3                   	ret
+     f66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f6d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     f70:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+     f74:	74 d9                	je     f4f <fputc+0x3f>
+     f76:	89 d8                	mov    %ebx,%eax
+     f78:	e8 33 fa ff ff       	call   9b0 <flush>
+     f7d:	85 c0                	test   %eax,%eax
+     f7f:	79 ce                	jns    f4f <fputc+0x3f>
+    return EOF;
+     f81:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     f86:	eb cc                	jmp    f54 <fputc+0x44>
+     f88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f8f:	90                   	nop
+    mutex_lock(&f->lock);
+     f90:	83 ec 0c             	sub    $0xc,%esp
+     f93:	8d 43 18             	lea    0x18(%ebx),%eax
+     f96:	50                   	push   %eax
+     f97:	e8 54 f3 ff ff       	call   2f0 <mutex_lock>
+  if(!(f->flags & IO_WRITE))
+     f9c:	8b 43 04             	mov    0x4(%ebx),%eax
+     f9f:	83 c4 10             	add    $0x10,%esp
+     fa2:	a8 02                	test   $0x2,%al
+     fa4:	74 db                	je     f81 <fputc+0x71>
+  if(!(f->flags & IO_SETUP))
+     fa6:	a8 40                	test   $0x40,%al
+     fa8:	75 8a                	jne    f34 <fputc+0x24>
+    setup(f);
+     faa:	89 d8                	mov    %ebx,%eax
+     fac:	e8 af f9 ff ff       	call   960 <setup>
+  if(f->n == f->size && flush(f) < 0)
+     fb1:	8b 43 14             	mov    0x14(%ebx),%eax
+     fb4:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     fb7:	75 83                	jne    f3c <fputc+0x2c>
+     fb9:	89 d8                	mov    %ebx,%eax
+     fbb:	e8 f0 f9 ff ff       	call   9b0 <flush>
+     fc0:	85 c0                	test   %eax,%eax
+     fc2:	78 bd                	js     f81 <fputc+0x71>
+  f->buf[f->n++] = c;
+     fc4:	8b 43 14             	mov    0x14(%ebx),%eax
+     fc7:	e9 70 ff ff ff       	jmp    f3c <fputc+0x2c>
+     fcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     fd0:	83 ec 0c             	sub    $0xc,%esp
+     fd3:	83 c3 18             	add    $0x18,%ebx
+     fd6:	53                   	push   %ebx
+     fd7:	e8 64 f3 ff ff       	call   340 <mutex_unlock>
+     fdc:	83 c4 10             	add    $0x10,%esp
+}
+     fdf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     fe2:	89 f0                	mov    %esi,%eax
+     fe4:	5b                   	pop    %ebx
+     fe5:	5e                   	pop    %esi
+     fe6:	5d                   	pop    %ebp
+     fe7:	c3                   	ret
+    return EOF;
+     fe8:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+     fed:	e9 6b ff ff ff       	jmp    f5d <fputc+0x4d>
+     ff2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ff9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001000 <fwrite>:
+{
+    1000:	55                   	push   %ebp
+    1001:	89 e5                	mov    %esp,%ebp
+    1003:	57                   	push   %edi
+    1004:	56                   	push   %esi
+    1005:	53                   	push   %ebx
+    1006:	83 ec 1c             	sub    $0x1c,%esp
+    1009:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  if(!(f->flags & IO_WRITE) || size <= 0)
+    100c:	8b 43 04             	mov    0x4(%ebx),%eax
+    100f:	a8 02                	test   $0x2,%al
+    1011:	0f 84 ec 00 00 00    	je     1103 <fwrite+0x103>
+    1017:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    101a:	85 c9                	test   %ecx,%ecx
+    101c:	0f 8e e1 00 00 00    	jle    1103 <fwrite+0x103>
+  if(threaded)
+    1022:	8b 15 40 28 00 00    	mov    0x2840,%edx
+    1028:	85 d2                	test   %edx,%edx
+    102a:	0f 85 1c 01 00 00    	jne    114c <fwrite+0x14c>
+  if(!(f->flags & IO_SETUP))
+    1030:	a8 40                	test   $0x40,%al
+    1032:	0f 84 08 01 00 00    	je     1140 <fwrite+0x140>
+  for(len = size*nmemb; len > 0; len -= n){
+    1038:	8b 45 0c             	mov    0xc(%ebp),%eax
+    103b:	0f af 45 10          	imul   0x10(%ebp),%eax
+    103f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    1042:	85 c0                	test   %eax,%eax
+    1044:	0f 8e 2a 01 00 00    	jle    1174 <fwrite+0x174>
+  s = p;
+    104a:	8b 45 08             	mov    0x8(%ebp),%eax
+  nl = 0;
+    104d:	31 ff                	xor    %edi,%edi
+    104f:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+        nl = 1;
+    1052:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  s = p;
+    1055:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1058:	8b 43 14             	mov    0x14(%ebx),%eax
+        nl = 1;
+    105b:	89 ce                	mov    %ecx,%esi
+    if(f->n == f->size && flush(f) < 0)
+    105d:	89 c2                	mov    %eax,%edx
+    105f:	39 f0                	cmp    %esi,%eax
+    1061:	74 6e                	je     10d1 <fwrite+0xd1>
+    1063:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1067:	90                   	nop
+    if(n > len)
+    1068:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    n = f->size - f->n;
+    106b:	89 f1                	mov    %esi,%ecx
+    106d:	29 c1                	sub    %eax,%ecx
+    106f:	39 f9                	cmp    %edi,%ecx
+    1071:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1074:	85 c9                	test   %ecx,%ecx
+    1076:	0f 8e 7c 00 00 00    	jle    10f8 <fwrite+0xf8>
+    107c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    107f:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1082:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    1085:	8d 34 08             	lea    (%eax,%ecx,1),%esi
+    1088:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    108b:	eb 06                	jmp    1093 <fwrite+0x93>
+    108d:	8d 76 00             	lea    0x0(%esi),%esi
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1090:	8b 53 14             	mov    0x14(%ebx),%edx
+    1093:	8d 4a 01             	lea    0x1(%edx),%ecx
+    1096:	8b 73 08             	mov    0x8(%ebx),%esi
+    1099:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    109c:	0f b6 08             	movzbl (%eax),%ecx
+        nl = 1;
+    109f:	80 f9 0a             	cmp    $0xa,%cl
+      if((f->buf[f->n++] = s[i]) == '\n')
+    10a2:	88 0c 16             	mov    %cl,(%esi,%edx,1)
+        nl = 1;
+    10a5:	be 01 00 00 00       	mov    $0x1,%esi
+    10aa:	0f 44 fe             	cmove  %esi,%edi
+    for(i = 0; i < n; i++)
+    10ad:	83 c0 01             	add    $0x1,%eax
+    10b0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    10b3:	75 db                	jne    1090 <fwrite+0x90>
+    s += n;
+    10b5:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    10b8:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    10bb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    s += n;
+    10be:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    10c1:	85 c0                	test   %eax,%eax
+    10c3:	7e 48                	jle    110d <fwrite+0x10d>
+    10c5:	8b 43 14             	mov    0x14(%ebx),%eax
+    10c8:	8b 73 0c             	mov    0xc(%ebx),%esi
+    if(f->n == f->size && flush(f) < 0)
+    10cb:	89 c2                	mov    %eax,%edx
+    10cd:	39 f0                	cmp    %esi,%eax
+    10cf:	75 97                	jne    1068 <fwrite+0x68>
+    10d1:	89 d8                	mov    %ebx,%eax
+    10d3:	e8 d8 f8 ff ff       	call   9b0 <flush>
+    10d8:	85 c0                	test   %eax,%eax
+    10da:	78 31                	js     110d <fwrite+0x10d>
+    n = f->size - f->n;
+    10dc:	8b 73 0c             	mov    0xc(%ebx),%esi
+    10df:	8b 43 14             	mov    0x14(%ebx),%eax
+    10e2:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    10e5:	89 f1                	mov    %esi,%ecx
+    10e7:	89 c2                	mov    %eax,%edx
+    10e9:	29 c1                	sub    %eax,%ecx
+    10eb:	39 f9                	cmp    %edi,%ecx
+    10ed:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    10f0:	85 c9                	test   %ecx,%ecx
+    10f2:	7f 88                	jg     107c <fwrite+0x7c>
+    10f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    s += n;
+    10f8:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    10fb:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    10fe:	e9 5a ff ff ff       	jmp    105d <fwrite+0x5d>
+}
+    1103:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    1106:	31 c0                	xor    %eax,%eax
+}
+    1108:	5b                   	pop    %ebx
+    1109:	5e                   	pop    %esi
+    110a:	5f                   	pop    %edi
+    110b:	5d                   	pop    %ebp
+    110c:	c3                   	ret
+  if(nl && (f->flags & IO_LINE))
+    110d:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1110:	85 ff                	test   %edi,%edi
+    1112:	74 06                	je     111a <fwrite+0x11a>
+    1114:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1118:	75 1d                	jne    1137 <fwrite+0x137>
+  return (s - (const char*)p) / size;
+    111a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    111d:	2b 75 08             	sub    0x8(%ebp),%esi
+  if(threaded)
+    1120:	a1 40 28 00 00       	mov    0x2840,%eax
+    1125:	85 c0                	test   %eax,%eax
+    1127:	75 3a                	jne    1163 <fwrite+0x163>
+  return (s - (const char*)p) / size;
+    1129:	89 f0                	mov    %esi,%eax
+    112b:	99                   	cltd
+    112c:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    112f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1132:	5b                   	pop    %ebx
+    1133:	5e                   	pop    %esi
+    1134:	5f                   	pop    %edi
+    1135:	5d                   	pop    %ebp
+    1136:	c3                   	ret
+    flush(f);
+    1137:	89 d8                	mov    %ebx,%eax
+    1139:	e8 72 f8 ff ff       	call   9b0 <flush>
+    113e:	eb da                	jmp    111a <fwrite+0x11a>
+    setup(f);
+    1140:	89 d8                	mov    %ebx,%eax
+    1142:	e8 19 f8 ff ff       	call   960 <setup>
+    1147:	e9 ec fe ff ff       	jmp    1038 <fwrite+0x38>
+    mutex_lock(&f->lock);
+    114c:	83 ec 0c             	sub    $0xc,%esp
+    114f:	8d 43 18             	lea    0x18(%ebx),%eax
+    1152:	50                   	push   %eax
+    1153:	e8 98 f1 ff ff       	call   2f0 <mutex_lock>
+  if(!(f->flags & IO_SETUP))
+    1158:	8b 43 04             	mov    0x4(%ebx),%eax
+    115b:	83 c4 10             	add    $0x10,%esp
+    115e:	e9 cd fe ff ff       	jmp    1030 <fwrite+0x30>
+    mutex_unlock(&f->lock);
+    1163:	83 ec 0c             	sub    $0xc,%esp
+    1166:	83 c3 18             	add    $0x18,%ebx
+    1169:	53                   	push   %ebx
+    116a:	e8 d1 f1 ff ff       	call   340 <mutex_unlock>
+    116f:	83 c4 10             	add    $0x10,%esp
+    1172:	eb b5                	jmp    1129 <fwrite+0x129>
+  for(len = size*nmemb; len > 0; len -= n){
+    1174:	31 f6                	xor    %esi,%esi
+    1176:	eb a8                	jmp    1120 <fwrite+0x120>
+    1178:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    117f:	90                   	nop
+
+00001180 <fgetc>:
+  return f->buf[f->r++] & 0xff;
+}
+
+int
+fgetc(FILE *f)
+{
+    1180:	55                   	push   %ebp
+    1181:	89 e5                	mov    %esp,%ebp
+    1183:	56                   	push   %esi
+    1184:	53                   	push   %ebx
+  if(threaded)
+    1185:	8b 15 40 28 00 00    	mov    0x2840,%edx
+{
+    118b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    118e:	85 d2                	test   %edx,%edx
+    1190:	75 2e                	jne    11c0 <fgetc+0x40>
+  if(!(f->flags & IO_READ))
+    1192:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1196:	74 78                	je     1210 <fgetc+0x90>
+  if(f->r == f->n && fill(f) == 0)
+    1198:	8b 43 10             	mov    0x10(%ebx),%eax
+    119b:	3b 43 14             	cmp    0x14(%ebx),%eax
+    119e:	74 60                	je     1200 <fgetc+0x80>
+  return f->buf[f->r++] & 0xff;
+    11a0:	8b 53 08             	mov    0x8(%ebx),%edx
+    11a3:	8d 48 01             	lea    0x1(%eax),%ecx
+    11a6:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    11a9:	0f b6 34 02          	movzbl (%edx,%eax,1),%esi
+  if(threaded)
+    11ad:	a1 40 28 00 00       	mov    0x2840,%eax
+    11b2:	85 c0                	test   %eax,%eax
+    11b4:	75 2a                	jne    11e0 <fgetc+0x60>
+
+  flockfile(f);
+  c = getc_unlocked(f);
+  funlockfile(f);
+  return c;
+}
+    11b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    11b9:	89 f0                	mov    %esi,%eax
+    11bb:	5b                   	pop    %ebx
+    11bc:	5e                   	pop    %esi
+    11bd:	5d                   	pop    %ebp
+    11be:	c3                   	ret
+    11bf:	90                   	nop
+    mutex_lock(&f->lock);
+    11c0:	83 ec 0c             	sub    $0xc,%esp
+    11c3:	8d 43 18             	lea    0x18(%ebx),%eax
+    11c6:	50                   	push   %eax
+    11c7:	e8 24 f1 ff ff       	call   2f0 <mutex_lock>
+  if(!(f->flags & IO_READ))
+    11cc:	83 c4 10             	add    $0x10,%esp
+    11cf:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    11d3:	75 c3                	jne    1198 <fgetc+0x18>
+    return EOF;
+    11d5:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    11da:	eb d1                	jmp    11ad <fgetc+0x2d>
+    11dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    11e0:	83 ec 0c             	sub    $0xc,%esp
+    11e3:	83 c3 18             	add    $0x18,%ebx
+    11e6:	53                   	push   %ebx
+    11e7:	e8 54 f1 ff ff       	call   340 <mutex_unlock>
+    11ec:	83 c4 10             	add    $0x10,%esp
+}
+    11ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    11f2:	89 f0                	mov    %esi,%eax
+    11f4:	5b                   	pop    %ebx
+    11f5:	5e                   	pop    %esi
+    11f6:	5d                   	pop    %ebp
+    11f7:	c3                   	ret
+    11f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11ff:	90                   	nop
+  if(f->r == f->n && fill(f) == 0)
+    1200:	89 d8                	mov    %ebx,%eax
+    1202:	e8 c9 f8 ff ff       	call   ad0 <fill>
+    1207:	85 c0                	test   %eax,%eax
+    1209:	74 ca                	je     11d5 <fgetc+0x55>
+  return f->buf[f->r++] & 0xff;
+    120b:	8b 43 10             	mov    0x10(%ebx),%eax
+    120e:	eb 90                	jmp    11a0 <fgetc+0x20>
+    return EOF;
+    1210:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    1215:	eb 9f                	jmp    11b6 <fgetc+0x36>
+    1217:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    121e:	66 90                	xchg   %ax,%ax
+
+00001220 <fread>:
+
+int
+fread(void *p, int size, int nmemb, FILE *f)
+{
+    1220:	55                   	push   %ebp
+    1221:	89 e5                	mov    %esp,%ebp
+    1223:	57                   	push   %edi
+    1224:	56                   	push   %esi
+    1225:	53                   	push   %ebx
+    1226:	83 ec 1c             	sub    $0x1c,%esp
+    1229:	8b 75 14             	mov    0x14(%ebp),%esi
+  char *d;
+  int n, len;
+
+  if(!(f->flags & IO_READ) || size <= 0)
+    122c:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+    1230:	74 7e                	je     12b0 <fread+0x90>
+    1232:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1235:	85 d2                	test   %edx,%edx
+    1237:	7e 77                	jle    12b0 <fread+0x90>
+  if(threaded)
+    1239:	a1 40 28 00 00       	mov    0x2840,%eax
+    return 0;
+  flockfile(f);
+  d = p;
+  for(len = size*nmemb; len > 0; len -= n){
+    123e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1241:	0f af 7d 10          	imul   0x10(%ebp),%edi
+  if(threaded)
+    1245:	85 c0                	test   %eax,%eax
+    1247:	0f 85 93 00 00 00    	jne    12e0 <fread+0xc0>
+  for(len = size*nmemb; len > 0; len -= n){
+    124d:	85 ff                	test   %edi,%edi
+    124f:	7e 61                	jle    12b2 <fread+0x92>
+    if(f->r == f->n && fill(f) == 0)
+    1251:	8b 46 10             	mov    0x10(%esi),%eax
+  d = p;
+    1254:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1257:	eb 35                	jmp    128e <fread+0x6e>
+    1259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      break;
+    n = f->n - f->r;
+    1260:	29 c3                	sub    %eax,%ebx
+    1262:	39 fb                	cmp    %edi,%ebx
+    1264:	0f 4f df             	cmovg  %edi,%ebx
+    if(n > len)
+      n = len;
+    memmove(d, f->buf + f->r, n);
+    1267:	83 ec 04             	sub    $0x4,%esp
+    126a:	53                   	push   %ebx
+    126b:	03 46 08             	add    0x8(%esi),%eax
+  for(len = size*nmemb; len > 0; len -= n){
+    126e:	29 df                	sub    %ebx,%edi
+    memmove(d, f->buf + f->r, n);
+    1270:	50                   	push   %eax
+    1271:	51                   	push   %ecx
+    1272:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1275:	e8 36 f0 ff ff       	call   2b0 <memmove>
+    f->r += n;
+    127a:	8b 46 10             	mov    0x10(%esi),%eax
+    d += n;
+    127d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1280:	83 c4 10             	add    $0x10,%esp
+    f->r += n;
+    1283:	01 d8                	add    %ebx,%eax
+    d += n;
+    1285:	01 d9                	add    %ebx,%ecx
+    f->r += n;
+    1287:	89 46 10             	mov    %eax,0x10(%esi)
+  for(len = size*nmemb; len > 0; len -= n){
+    128a:	85 ff                	test   %edi,%edi
+    128c:	7e 32                	jle    12c0 <fread+0xa0>
+    if(f->r == f->n && fill(f) == 0)
+    128e:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1291:	39 c3                	cmp    %eax,%ebx
+    1293:	75 cb                	jne    1260 <fread+0x40>
+    1295:	89 f0                	mov    %esi,%eax
+    1297:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    129a:	e8 31 f8 ff ff       	call   ad0 <fill>
+    129f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    12a2:	85 c0                	test   %eax,%eax
+    12a4:	74 1a                	je     12c0 <fread+0xa0>
+    n = f->n - f->r;
+    12a6:	8b 5e 14             	mov    0x14(%esi),%ebx
+    12a9:	8b 46 10             	mov    0x10(%esi),%eax
+    12ac:	eb b2                	jmp    1260 <fread+0x40>
+    12ae:	66 90                	xchg   %ax,%ax
+    return 0;
+    12b0:	31 c0                	xor    %eax,%eax
+  }
+  funlockfile(f);
+  return (d - (char*)p) / size;
+}
+    12b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12b5:	5b                   	pop    %ebx
+    12b6:	5e                   	pop    %esi
+    12b7:	5f                   	pop    %edi
+    12b8:	5d                   	pop    %ebp
+    12b9:	c3                   	ret
+    12ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (d - (char*)p) / size;
+    12c0:	2b 4d 08             	sub    0x8(%ebp),%ecx
+    12c3:	89 cb                	mov    %ecx,%ebx
+  if(threaded)
+    12c5:	a1 40 28 00 00       	mov    0x2840,%eax
+    12ca:	85 c0                	test   %eax,%eax
+    12cc:	75 32                	jne    1300 <fread+0xe0>
+  return (d - (char*)p) / size;
+    12ce:	89 d8                	mov    %ebx,%eax
+    12d0:	99                   	cltd
+    12d1:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    12d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12d7:	5b                   	pop    %ebx
+    12d8:	5e                   	pop    %esi
+    12d9:	5f                   	pop    %edi
+    12da:	5d                   	pop    %ebp
+    12db:	c3                   	ret
+    12dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    12e0:	83 ec 0c             	sub    $0xc,%esp
+    12e3:	8d 46 18             	lea    0x18(%esi),%eax
+    12e6:	50                   	push   %eax
+    12e7:	e8 04 f0 ff ff       	call   2f0 <mutex_lock>
+  for(len = size*nmemb; len > 0; len -= n){
+    12ec:	83 c4 10             	add    $0x10,%esp
+    12ef:	85 ff                	test   %edi,%edi
+    12f1:	0f 8f 5a ff ff ff    	jg     1251 <fread+0x31>
+    12f7:	31 db                	xor    %ebx,%ebx
+    12f9:	eb ca                	jmp    12c5 <fread+0xa5>
+    12fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12ff:	90                   	nop
+    mutex_unlock(&f->lock);
+    1300:	83 ec 0c             	sub    $0xc,%esp
+    1303:	83 c6 18             	add    $0x18,%esi
+    1306:	56                   	push   %esi
+    1307:	e8 34 f0 ff ff       	call   340 <mutex_unlock>
+  return (d - (char*)p) / size;
+    130c:	89 d8                	mov    %ebx,%eax
+    130e:	83 c4 10             	add    $0x10,%esp
+    1311:	99                   	cltd
+    1312:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1315:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1318:	5b                   	pop    %ebx
+    1319:	5e                   	pop    %esi
+    131a:	5f                   	pop    %edi
+    131b:	5d                   	pop    %ebp
+    131c:	c3                   	ret
+    131d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001320 <fgets>:
+
+// Read a line of at most max-1 bytes, keeping the newline.
+// Returns 0 if there was nothing left to read.
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    1320:	55                   	push   %ebp
+    1321:	89 e5                	mov    %esp,%ebp
+    1323:	57                   	push   %edi
+    1324:	56                   	push   %esi
+    1325:	53                   	push   %ebx
+    1326:	83 ec 1c             	sub    $0x1c,%esp
+  if(threaded)
+    1329:	8b 35 40 28 00 00    	mov    0x2840,%esi
+{
+    132f:	8b 7d 08             	mov    0x8(%ebp),%edi
+    1332:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if(threaded)
+    1335:	85 f6                	test   %esi,%esi
+    1337:	0f 85 83 00 00 00    	jne    13c0 <fgets+0xa0>
+{
+    133d:	31 f6                	xor    %esi,%esi
+    133f:	eb 2a                	jmp    136b <fgets+0x4b>
+    1341:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return f->buf[f->r++] & 0xff;
+    1348:	8b 53 08             	mov    0x8(%ebx),%edx
+    134b:	8d 48 01             	lea    0x1(%eax),%ecx
+    134e:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1351:	0f b6 14 02          	movzbl (%edx,%eax,1),%edx
+
+  flockfile(f);
+  for(i = 0; i+1 < max; ){
+    if((c = getc_unlocked(f)) == EOF)
+      break;
+    buf[i++] = c;
+    1355:	88 54 37 ff          	mov    %dl,-0x1(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    1359:	80 fa 0a             	cmp    $0xa,%dl
+    135c:	0f 84 96 00 00 00    	je     13f8 <fgets+0xd8>
+    1362:	83 fa 0d             	cmp    $0xd,%edx
+    1365:	0f 84 8d 00 00 00    	je     13f8 <fgets+0xd8>
+  for(i = 0; i+1 < max; ){
+    136b:	89 f2                	mov    %esi,%edx
+    136d:	83 c6 01             	add    $0x1,%esi
+    1370:	3b 75 0c             	cmp    0xc(%ebp),%esi
+    1373:	7d 2b                	jge    13a0 <fgets+0x80>
+  if(!(f->flags & IO_READ))
+    1375:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1379:	74 25                	je     13a0 <fgets+0x80>
+  if(f->r == f->n && fill(f) == 0)
+    137b:	8b 43 10             	mov    0x10(%ebx),%eax
+    137e:	3b 43 14             	cmp    0x14(%ebx),%eax
+    1381:	75 c5                	jne    1348 <fgets+0x28>
+    1383:	89 d8                	mov    %ebx,%eax
+    1385:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1388:	e8 43 f7 ff ff       	call   ad0 <fill>
+    138d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1390:	85 c0                	test   %eax,%eax
+    1392:	74 0c                	je     13a0 <fgets+0x80>
+  return f->buf[f->r++] & 0xff;
+    1394:	8b 43 10             	mov    0x10(%ebx),%eax
+    1397:	eb af                	jmp    1348 <fgets+0x28>
+    1399:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    13a0:	8b 0d 40 28 00 00    	mov    0x2840,%ecx
+      break;
+  }
+  buf[i] = '\0';
+    13a6:	c6 04 17 00          	movb   $0x0,(%edi,%edx,1)
+  if(threaded)
+    13aa:	85 c9                	test   %ecx,%ecx
+    13ac:	75 2a                	jne    13d8 <fgets+0xb8>
+  funlockfile(f);
+  return i > 0 ? buf : 0;
+    13ae:	31 c0                	xor    %eax,%eax
+    13b0:	85 d2                	test   %edx,%edx
+    13b2:	74 02                	je     13b6 <fgets+0x96>
+    13b4:	89 f8                	mov    %edi,%eax
+}
+    13b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13b9:	5b                   	pop    %ebx
+    13ba:	5e                   	pop    %esi
+    13bb:	5f                   	pop    %edi
+    13bc:	5d                   	pop    %ebp
+    13bd:	c3                   	ret
+    13be:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    13c0:	83 ec 0c             	sub    $0xc,%esp
+    13c3:	8d 43 18             	lea    0x18(%ebx),%eax
+    13c6:	50                   	push   %eax
+    13c7:	e8 24 ef ff ff       	call   2f0 <mutex_lock>
+    13cc:	83 c4 10             	add    $0x10,%esp
+    13cf:	e9 69 ff ff ff       	jmp    133d <fgets+0x1d>
+    13d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    13d8:	83 ec 0c             	sub    $0xc,%esp
+    13db:	83 c3 18             	add    $0x18,%ebx
+    13de:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    13e1:	53                   	push   %ebx
+    13e2:	e8 59 ef ff ff       	call   340 <mutex_unlock>
+    13e7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    13ea:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    13ed:	31 c0                	xor    %eax,%eax
+    13ef:	85 d2                	test   %edx,%edx
+    13f1:	75 c1                	jne    13b4 <fgets+0x94>
+    13f3:	eb c1                	jmp    13b6 <fgets+0x96>
+    13f5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    13f8:	a1 40 28 00 00       	mov    0x2840,%eax
+  buf[i] = '\0';
+    13fd:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  if(threaded)
+    1401:	85 c0                	test   %eax,%eax
+    1403:	74 af                	je     13b4 <fgets+0x94>
+    mutex_unlock(&f->lock);
+    1405:	83 ec 0c             	sub    $0xc,%esp
+    1408:	83 c3 18             	add    $0x18,%ebx
+    140b:	53                   	push   %ebx
+    140c:	e8 2f ef ff ff       	call   340 <mutex_unlock>
+    1411:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    1414:	89 f8                	mov    %edi,%eax
+    1416:	eb 9e                	jmp    13b6 <fgets+0x96>
+    1418:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    141f:	90                   	nop
+
+00001420 <gets>:
+// at most a line per read(), goes through stdin's buffer: from a
+// file or pipe, a buffered read could take input meant for a child
+// process, so read a byte at a time.
+char*
+gets(char *buf, int max)
+{
+    1420:	55                   	push   %ebp
+    1421:	89 e5                	mov    %esp,%ebp
+    1423:	57                   	push   %edi
+    1424:	56                   	push   %esi
+    1425:	53                   	push   %ebx
+    1426:	83 ec 2c             	sub    $0x2c,%esp
+  int i, cc;
+  char c;
+
+  if(!(stdin->flags & IO_SETUP))
+    1429:	8b 15 44 27 00 00    	mov    0x2744,%edx
+{
+    142f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!(stdin->flags & IO_SETUP))
+    1432:	f6 c2 40             	test   $0x40,%dl
+    1435:	74 79                	je     14b0 <gets+0x90>
+    setup(stdin);
+  if(stdin->flags & IO_DEV){
+    1437:	83 e2 20             	and    $0x20,%edx
+    143a:	89 d7                	mov    %edx,%edi
+    143c:	75 52                	jne    1490 <gets+0x70>
+  if(f == 0){
+    143e:	e8 ed f5 ff ff       	call   a30 <fflush.part.0>
+    fgets(buf, max, stdin);
+    return buf;
+  }
+  fflush(0);
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1443:	8d 75 e7             	lea    -0x19(%ebp),%esi
+  for(i=0; i+1 < max; ){
+    1446:	eb 2c                	jmp    1474 <gets+0x54>
+    1448:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    144f:	90                   	nop
+    cc = read(0, &c, 1);
+    1450:	83 ec 04             	sub    $0x4,%esp
+    1453:	6a 01                	push   $0x1
+    1455:	56                   	push   %esi
+    1456:	6a 00                	push   $0x0
+    1458:	e8 f5 ef ff ff       	call   452 <read>
+    if(cc < 1)
+    145d:	83 c4 10             	add    $0x10,%esp
+    1460:	85 c0                	test   %eax,%eax
+    1462:	7e 1b                	jle    147f <gets+0x5f>
+      break;
+    buf[i++] = c;
+    1464:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1468:	88 44 3b ff          	mov    %al,-0x1(%ebx,%edi,1)
+    if(c == '\n' || c == '\r')
+    146c:	3c 0a                	cmp    $0xa,%al
+    146e:	74 12                	je     1482 <gets+0x62>
+    1470:	3c 0d                	cmp    $0xd,%al
+    1472:	74 0e                	je     1482 <gets+0x62>
+  for(i=0; i+1 < max; ){
+    1474:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    1477:	83 c7 01             	add    $0x1,%edi
+    147a:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+    147d:	7c d1                	jl     1450 <gets+0x30>
+{
+    147f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      break;
+  }
+  buf[i] = '\0';
+    1482:	c6 04 3b 00          	movb   $0x0,(%ebx,%edi,1)
+  return buf;
+}
+    1486:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1489:	89 d8                	mov    %ebx,%eax
+    148b:	5b                   	pop    %ebx
+    148c:	5e                   	pop    %esi
+    148d:	5f                   	pop    %edi
+    148e:	5d                   	pop    %ebp
+    148f:	c3                   	ret
+    fgets(buf, max, stdin);
+    1490:	83 ec 04             	sub    $0x4,%esp
+    1493:	68 40 27 00 00       	push   $0x2740
+    1498:	ff 75 0c             	push   0xc(%ebp)
+    149b:	53                   	push   %ebx
+    149c:	e8 7f fe ff ff       	call   1320 <fgets>
+    return buf;
+    14a1:	83 c4 10             	add    $0x10,%esp
+}
+    14a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    14a7:	89 d8                	mov    %ebx,%eax
+    14a9:	5b                   	pop    %ebx
+    14aa:	5e                   	pop    %esi
+    14ab:	5f                   	pop    %edi
+    14ac:	5d                   	pop    %ebp
+    14ad:	c3                   	ret
+    14ae:	66 90                	xchg   %ax,%ax
+    setup(stdin);
+    14b0:	b8 40 27 00 00       	mov    $0x2740,%eax
+    14b5:	e8 a6 f4 ff ff       	call   960 <setup>
+  if(stdin->flags & IO_DEV){
+    14ba:	8b 15 44 27 00 00    	mov    0x2744,%edx
+    14c0:	e9 72 ff ff ff       	jmp    1437 <gets+0x17>
+    14c5:	66 90                	xchg   %ax,%ax
+    14c7:	66 90                	xchg   %ax,%ax
+    14c9:	66 90                	xchg   %ax,%ax
+    14cb:	66 90                	xchg   %ax,%ax
+    14cd:	66 90                	xchg   %ax,%ax
+    14cf:	90                   	nop
+
+000014d0 <bigfree>:
+
+// Give a big block back to the first-fit list, and return the
+// free block that now holds it. Caller holds lock.
+static Header*
+bigfree(Header *bp)
+{
+    14d0:	55                   	push   %ebp
+    14d1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    14d3:	a1 e4 2e 00 00       	mov    0x2ee4,%eax
+{
+    14d8:	89 e5                	mov    %esp,%ebp
+    14da:	56                   	push   %esi
+    14db:	53                   	push   %ebx
+    14dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    14e0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    14e2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    14e4:	39 ca                	cmp    %ecx,%edx
+    14e6:	73 38                	jae    1520 <bigfree+0x50>
+    14e8:	39 c1                	cmp    %eax,%ecx
+    14ea:	72 04                	jb     14f0 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    14ec:	39 c2                	cmp    %eax,%edx
+    14ee:	72 f0                	jb     14e0 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    14f0:	8b 59 04             	mov    0x4(%ecx),%ebx
+    14f3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    14f6:	39 f0                	cmp    %esi,%eax
+    14f8:	74 36                	je     1530 <bigfree+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    14fa:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  freep = p;
+  if(p + p->s.size == bp){
+    14fc:	8b 42 04             	mov    0x4(%edx),%eax
+    14ff:	89 cb                	mov    %ecx,%ebx
+  freep = p;
+    1501:	89 15 e4 2e 00 00    	mov    %edx,0x2ee4
+  if(p + p->s.size == bp){
+    1507:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    150a:	39 f1                	cmp    %esi,%ecx
+    150c:	74 2e                	je     153c <bigfree+0x6c>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    150e:	89 1a                	mov    %ebx,(%edx)
+    return p;
+  }
+  p->s.ptr = bp;
+  return bp;
+}
+    1510:	89 c8                	mov    %ecx,%eax
+    1512:	5b                   	pop    %ebx
+    1513:	5e                   	pop    %esi
+    1514:	5d                   	pop    %ebp
+    1515:	c3                   	ret
+    1516:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    151d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1520:	39 c1                	cmp    %eax,%ecx
+    1522:	72 c8                	jb     14ec <bigfree+0x1c>
+    1524:	eb ba                	jmp    14e0 <bigfree+0x10>
+    1526:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    152d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1530:	03 58 04             	add    0x4(%eax),%ebx
+    1533:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1536:	8b 02                	mov    (%edx),%eax
+    1538:	8b 00                	mov    (%eax),%eax
+    153a:	eb be                	jmp    14fa <bigfree+0x2a>
+    p->s.size += bp->s.size;
+    153c:	03 41 04             	add    0x4(%ecx),%eax
+    153f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1542:	8b 19                	mov    (%ecx),%ebx
+    return p;
+    1544:	89 d1                	mov    %edx,%ecx
+}
+    1546:	89 c8                	mov    %ecx,%eax
+    p->s.ptr = bp->s.ptr;
+    1548:	89 1a                	mov    %ebx,(%edx)
+}
+    154a:	5b                   	pop    %ebx
+    154b:	5e                   	pop    %esi
+    154c:	5d                   	pop    %ebp
+    154d:	c3                   	ret
+    154e:	66 90                	xchg   %ax,%ax
+
+00001550 <trim>:
+// If free block bp ends the heap, return its whole pages to the
+// kernel, unless something else has moved the break since.
+// Caller holds lock.
+static void
+trim(Header *bp)
+{
+    1550:	55                   	push   %ebp
+    1551:	89 e5                	mov    %esp,%ebp
+    1553:	57                   	push   %edi
+    1554:	56                   	push   %esi
+    1555:	53                   	push   %ebx
+    1556:	89 c3                	mov    %eax,%ebx
+    1558:	83 ec 0c             	sub    $0xc,%esp
+  char *end;
+  uint n;
+
+  if((char*)(bp + bp->s.size) != heapend)
+    155b:	8b 53 04             	mov    0x4(%ebx),%edx
+    155e:	a1 e0 2e 00 00       	mov    0x2ee0,%eax
+    1563:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+    1566:	39 d0                	cmp    %edx,%eax
+    1568:	74 0e                	je     1578 <trim+0x28>
+  n = heapend - end;
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    bp->s.size -= n / sizeof(Header);
+    heapend = end;
+  }
+}
+    156a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    156d:	5b                   	pop    %ebx
+    156e:	5e                   	pop    %esi
+    156f:	5f                   	pop    %edi
+    1570:	5d                   	pop    %ebp
+    1571:	c3                   	ret
+    1572:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  end = (char*)PGROUNDUP((uint)(bp + 2));
+    1578:	8d bb 0f 10 00 00    	lea    0x100f(%ebx),%edi
+    157e:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  n = heapend - end;
+    1584:	29 f8                	sub    %edi,%eax
+    1586:	89 c6                	mov    %eax,%esi
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    1588:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    158d:	76 db                	jbe    156a <trim+0x1a>
+    158f:	83 ec 0c             	sub    $0xc,%esp
+    1592:	6a 00                	push   $0x0
+    1594:	e8 8b ef ff ff       	call   524 <sbrk>
+    1599:	83 c4 10             	add    $0x10,%esp
+    159c:	39 05 e0 2e 00 00    	cmp    %eax,0x2ee0
+    15a2:	75 c6                	jne    156a <trim+0x1a>
+    15a4:	89 f0                	mov    %esi,%eax
+    15a6:	83 ec 0c             	sub    $0xc,%esp
+    15a9:	f7 d8                	neg    %eax
+    15ab:	50                   	push   %eax
+    15ac:	e8 73 ef ff ff       	call   524 <sbrk>
+    15b1:	83 c4 10             	add    $0x10,%esp
+    15b4:	83 f8 ff             	cmp    $0xffffffff,%eax
+    15b7:	74 b1                	je     156a <trim+0x1a>
+    bp->s.size -= n / sizeof(Header);
+    15b9:	89 f0                	mov    %esi,%eax
+    heapend = end;
+    15bb:	89 3d e0 2e 00 00    	mov    %edi,0x2ee0
+    bp->s.size -= n / sizeof(Header);
+    15c1:	c1 e8 03             	shr    $0x3,%eax
+    15c4:	29 43 04             	sub    %eax,0x4(%ebx)
+    heapend = end;
+    15c7:	eb a1                	jmp    156a <trim+0x1a>
+    15c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000015d0 <bigalloc>:
+}
+
+// Allocate a big block of nunits units. Caller holds lock.
+static Header*
+bigalloc(uint nunits)
+{
+    15d0:	55                   	push   %ebp
+    15d1:	89 e5                	mov    %esp,%ebp
+    15d3:	57                   	push   %edi
+    15d4:	89 c7                	mov    %eax,%edi
+    15d6:	56                   	push   %esi
+    15d7:	53                   	push   %ebx
+    15d8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    15db:	a1 e4 2e 00 00       	mov    0x2ee4,%eax
+    15e0:	85 c0                	test   %eax,%eax
+    15e2:	0f 84 98 00 00 00    	je     1680 <bigalloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    15e8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    15ea:	8b 4a 04             	mov    0x4(%edx),%ecx
+    15ed:	39 f9                	cmp    %edi,%ecx
+    15ef:	73 67                	jae    1658 <bigalloc+0x88>
+  if(nu < 4096)
+    15f1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    15f6:	39 df                	cmp    %ebx,%edi
+    15f8:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    15fb:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    1602:	eb 0d                	jmp    1611 <bigalloc+0x41>
+    1604:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1608:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    160a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    160d:	39 f9                	cmp    %edi,%ecx
+    160f:	73 47                	jae    1658 <bigalloc+0x88>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    1611:	89 d0                	mov    %edx,%eax
+    1613:	39 15 e4 2e 00 00    	cmp    %edx,0x2ee4
+    1619:	75 ed                	jne    1608 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    161b:	83 ec 0c             	sub    $0xc,%esp
+    161e:	56                   	push   %esi
+    161f:	e8 00 ef ff ff       	call   524 <sbrk>
+  if(p == (char*)-1)
+    1624:	83 c4 10             	add    $0x10,%esp
+    1627:	83 f8 ff             	cmp    $0xffffffff,%eax
+    162a:	74 1a                	je     1646 <bigalloc+0x76>
+  hp->s.size = nu;
+    162c:	89 58 04             	mov    %ebx,0x4(%eax)
+  heapend = p + nu * sizeof(Header);
+    162f:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    1632:	89 15 e0 2e 00 00    	mov    %edx,0x2ee0
+  bigfree(hp);
+    1638:	e8 93 fe ff ff       	call   14d0 <bigfree>
+  return freep;
+    163d:	a1 e4 2e 00 00       	mov    0x2ee4,%eax
+      if((p = morecore(nunits)) == 0)
+    1642:	85 c0                	test   %eax,%eax
+    1644:	75 c2                	jne    1608 <bigalloc+0x38>
+        return 0;
+  }
+}
+    1646:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1649:	31 d2                	xor    %edx,%edx
+}
+    164b:	5b                   	pop    %ebx
+    164c:	89 d0                	mov    %edx,%eax
+    164e:	5e                   	pop    %esi
+    164f:	5f                   	pop    %edi
+    1650:	5d                   	pop    %ebp
+    1651:	c3                   	ret
+    1652:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1658:	39 cf                	cmp    %ecx,%edi
+    165a:	74 54                	je     16b0 <bigalloc+0xe0>
+        p->s.size -= nunits;
+    165c:	29 f9                	sub    %edi,%ecx
+    165e:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    1661:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    1664:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    1667:	a3 e4 2e 00 00       	mov    %eax,0x2ee4
+}
+    166c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    166f:	89 d0                	mov    %edx,%eax
+    1671:	5b                   	pop    %ebx
+    1672:	5e                   	pop    %esi
+    1673:	5f                   	pop    %edi
+    1674:	5d                   	pop    %ebp
+    1675:	c3                   	ret
+    1676:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    167d:	8d 76 00             	lea    0x0(%esi),%esi
+    base.s.ptr = freep = prevp = &base;
+    1680:	c7 05 e4 2e 00 00 e8 	movl   $0x2ee8,0x2ee4
+    1687:	2e 00 00 
+    base.s.size = 0;
+    168a:	ba e8 2e 00 00       	mov    $0x2ee8,%edx
+    base.s.ptr = freep = prevp = &base;
+    168f:	c7 05 e8 2e 00 00 e8 	movl   $0x2ee8,0x2ee8
+    1696:	2e 00 00 
+    base.s.size = 0;
+    1699:	c7 05 ec 2e 00 00 00 	movl   $0x0,0x2eec
+    16a0:	00 00 00 
+    if(p->s.size >= nunits){
+    16a3:	e9 49 ff ff ff       	jmp    15f1 <bigalloc+0x21>
+    16a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16af:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    16b0:	8b 0a                	mov    (%edx),%ecx
+    16b2:	89 08                	mov    %ecx,(%eax)
+    16b4:	eb b1                	jmp    1667 <bigalloc+0x97>
+    16b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000016c0 <drain>:
+}
+
+// Move n blocks of class c from cache tc to the shared list.
+static void
+drain(struct tcache *tc, int c, int n)
+{
+    16c0:	55                   	push   %ebp
+    16c1:	89 e5                	mov    %esp,%ebp
+    16c3:	57                   	push   %edi
+    16c4:	89 c7                	mov    %eax,%edi
+    16c6:	56                   	push   %esi
+    16c7:	89 d6                	mov    %edx,%esi
+    16c9:	53                   	push   %ebx
+    16ca:	89 cb                	mov    %ecx,%ebx
+    16cc:	83 ec 0c             	sub    $0xc,%esp
+  if(threaded)
+    16cf:	8b 15 64 2e 00 00    	mov    0x2e64,%edx
+    16d5:	85 d2                	test   %edx,%edx
+    16d7:	75 57                	jne    1730 <drain+0x70>
+  Header *p;
+
+  acquire();
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    16d9:	85 c9                	test   %ecx,%ecx
+    16db:	7e 49                	jle    1726 <drain+0x66>
+    16dd:	89 d9                	mov    %ebx,%ecx
+    16df:	8d 14 b7             	lea    (%edi,%esi,4),%edx
+    16e2:	eb 23                	jmp    1707 <drain+0x47>
+    16e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    tc->list[c] = p->s.ptr;
+    16e8:	8b 18                	mov    (%eax),%ebx
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    16ea:	83 e9 01             	sub    $0x1,%ecx
+    tc->n[c]--;
+    16ed:	83 6a 20 01          	subl   $0x1,0x20(%edx)
+    tc->list[c] = p->s.ptr;
+    16f1:	89 1a                	mov    %ebx,(%edx)
+    p->s.ptr = small[c];
+    16f3:	8b 1c b5 c0 2e 00 00 	mov    0x2ec0(,%esi,4),%ebx
+    16fa:	89 18                	mov    %ebx,(%eax)
+    small[c] = p;
+    16fc:	89 04 b5 c0 2e 00 00 	mov    %eax,0x2ec0(,%esi,4)
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1703:	85 c9                	test   %ecx,%ecx
+    1705:	7e 06                	jle    170d <drain+0x4d>
+    1707:	8b 02                	mov    (%edx),%eax
+    1709:	85 c0                	test   %eax,%eax
+    170b:	75 db                	jne    16e8 <drain+0x28>
+  if(threaded)
+    170d:	a1 64 2e 00 00       	mov    0x2e64,%eax
+    1712:	85 c0                	test   %eax,%eax
+    1714:	74 10                	je     1726 <drain+0x66>
+    mutex_unlock(&lock);
+    1716:	83 ec 0c             	sub    $0xc,%esp
+    1719:	68 68 2e 00 00       	push   $0x2e68
+    171e:	e8 1d ec ff ff       	call   340 <mutex_unlock>
+}
+    1723:	83 c4 10             	add    $0x10,%esp
+  }
+  release();
+}
+    1726:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1729:	5b                   	pop    %ebx
+    172a:	5e                   	pop    %esi
+    172b:	5f                   	pop    %edi
+    172c:	5d                   	pop    %ebp
+    172d:	c3                   	ret
+    172e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&lock);
+    1730:	83 ec 0c             	sub    $0xc,%esp
+    1733:	68 68 2e 00 00       	push   $0x2e68
+    1738:	e8 b3 eb ff ff       	call   2f0 <mutex_lock>
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    173d:	83 c4 10             	add    $0x10,%esp
+    1740:	85 db                	test   %ebx,%ebx
+    1742:	7f 99                	jg     16dd <drain+0x1d>
+    1744:	eb c7                	jmp    170d <drain+0x4d>
+    1746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    174d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001750 <mycache>:
+{
+    1750:	55                   	push   %ebp
+    return &maincache;
+    1751:	b8 80 2e 00 00       	mov    $0x2e80,%eax
+{
+    1756:	89 e5                	mov    %esp,%ebp
+    1758:	53                   	push   %ebx
+  sp = PGROUNDDOWN((uint)&sp);
+    1759:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+    175c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+    1762:	83 ec 14             	sub    $0x14,%esp
+  if(!threaded || sp == mainstack)
+    1765:	8b 0d 64 2e 00 00    	mov    0x2e64,%ecx
+  sp = PGROUNDDOWN((uint)&sp);
+    176b:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  if(!threaded || sp == mainstack)
+    176e:	85 c9                	test   %ecx,%ecx
+    1770:	74 0f                	je     1781 <mycache+0x31>
+    1772:	3b 1d 60 2e 00 00    	cmp    0x2e60,%ebx
+    1778:	74 07                	je     1781 <mycache+0x31>
+  if(*cp == 0){
+    177a:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    177d:	85 c0                	test   %eax,%eax
+    177f:	74 0f                	je     1790 <mycache+0x40>
+}
+    1781:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1784:	c9                   	leave
+    1785:	c3                   	ret
+    1786:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    178d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1790:	83 ec 0c             	sub    $0xc,%esp
+    1793:	68 68 2e 00 00       	push   $0x2e68
+    1798:	e8 53 eb ff ff       	call   2f0 <mutex_lock>
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    179d:	b8 09 00 00 00       	mov    $0x9,%eax
+    17a2:	e8 29 fe ff ff       	call   15d0 <bigalloc>
+  if(threaded)
+    17a7:	8b 15 64 2e 00 00    	mov    0x2e64,%edx
+    17ad:	83 c4 10             	add    $0x10,%esp
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    17b0:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(threaded)
+    17b3:	85 d2                	test   %edx,%edx
+    17b5:	75 29                	jne    17e0 <mycache+0x90>
+    if(*cp == 0)
+    17b7:	85 c0                	test   %eax,%eax
+    17b9:	74 c6                	je     1781 <mycache+0x31>
+    memset(*cp, 0, sizeof(**cp));
+    17bb:	83 ec 04             	sub    $0x4,%esp
+    *cp = (struct tcache*)((Header*)*cp + 1);
+    17be:	83 c0 08             	add    $0x8,%eax
+    17c1:	89 43 f8             	mov    %eax,-0x8(%ebx)
+    memset(*cp, 0, sizeof(**cp));
+    17c4:	6a 40                	push   $0x40
+    17c6:	6a 00                	push   $0x0
+    17c8:	50                   	push   %eax
+    17c9:	e8 f2 e9 ff ff       	call   1c0 <memset>
+  return *cp;
+    17ce:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    17d1:	83 c4 10             	add    $0x10,%esp
+    17d4:	eb ab                	jmp    1781 <mycache+0x31>
+    17d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17dd:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    17e0:	83 ec 0c             	sub    $0xc,%esp
+    17e3:	68 68 2e 00 00       	push   $0x2e68
+    17e8:	e8 53 eb ff ff       	call   340 <mutex_unlock>
+    if(*cp == 0)
+    17ed:	8b 43 f8             	mov    -0x8(%ebx),%eax
+}
+    17f0:	83 c4 10             	add    $0x10,%esp
+    17f3:	eb c2                	jmp    17b7 <mycache+0x67>
+    17f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001800 <free>:
+
+void
+free(void *ap)
+{
+    1800:	55                   	push   %ebp
+    1801:	89 e5                	mov    %esp,%ebp
+    1803:	57                   	push   %edi
+    1804:	56                   	push   %esi
+    1805:	53                   	push   %ebx
+    1806:	83 ec 1c             	sub    $0x1c,%esp
+    1809:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  struct tcache *tc;
+  int c;
+
+  if(ap == 0)
+    180c:	85 f6                	test   %esi,%esi
+    180e:	74 51                	je     1861 <free+0x61>
+    return;
+  bp = (Header*)ap - 1;
+    1810:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1813:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(bp->s.size > SMALLMAX / sizeof(Header)){
+    1816:	8b 46 fc             	mov    -0x4(%esi),%eax
+    1819:	3d 00 01 00 00       	cmp    $0x100,%eax
+    181e:	77 50                	ja     1870 <free+0x70>
+    acquire();
+    trim(bigfree(bp));
+    release();
+    return;
+  }
+  for(c = 0; (2 << c) < bp->s.size; c++)
+    1820:	31 db                	xor    %ebx,%ebx
+    1822:	ba 02 00 00 00       	mov    $0x2,%edx
+    1827:	83 f8 02             	cmp    $0x2,%eax
+    182a:	76 11                	jbe    183d <free+0x3d>
+    182c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1830:	83 c3 01             	add    $0x1,%ebx
+    1833:	89 d7                	mov    %edx,%edi
+    1835:	89 d9                	mov    %ebx,%ecx
+    1837:	d3 e7                	shl    %cl,%edi
+    1839:	39 c7                	cmp    %eax,%edi
+    183b:	72 f3                	jb     1830 <free+0x30>
+    ;
+  if((tc = mycache()) == 0){
+    183d:	e8 0e ff ff ff       	call   1750 <mycache>
+    1842:	85 c0                	test   %eax,%eax
+    1844:	74 7a                	je     18c0 <free+0xc0>
+    bp->s.ptr = small[c];
+    small[c] = bp;
+    release();
+    return;
+  }
+  bp->s.ptr = tc->list[c];
+    1846:	8d 0c 98             	lea    (%eax,%ebx,4),%ecx
+    1849:	8b 11                	mov    (%ecx),%edx
+    184b:	89 56 f8             	mov    %edx,-0x8(%esi)
+  tc->list[c] = bp;
+    184e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1851:	89 31                	mov    %esi,(%ecx)
+  if(++tc->n[c] > TCACHEMAX)
+    1853:	8b 71 20             	mov    0x20(%ecx),%esi
+    1856:	8d 56 01             	lea    0x1(%esi),%edx
+    1859:	89 51 20             	mov    %edx,0x20(%ecx)
+    185c:	83 fa 20             	cmp    $0x20,%edx
+    185f:	7f 47                	jg     18a8 <free+0xa8>
+    drain(tc, c, BATCH);
+}
+    1861:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1864:	5b                   	pop    %ebx
+    1865:	5e                   	pop    %esi
+    1866:	5f                   	pop    %edi
+    1867:	5d                   	pop    %ebp
+    1868:	c3                   	ret
+    1869:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1870:	8b 1d 64 2e 00 00    	mov    0x2e64,%ebx
+    1876:	85 db                	test   %ebx,%ebx
+    1878:	75 66                	jne    18e0 <free+0xe0>
+    trim(bigfree(bp));
+    187a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    187d:	e8 4e fc ff ff       	call   14d0 <bigfree>
+    1882:	e8 c9 fc ff ff       	call   1550 <trim>
+  if(threaded)
+    1887:	8b 0d 64 2e 00 00    	mov    0x2e64,%ecx
+    188d:	85 c9                	test   %ecx,%ecx
+    188f:	74 d0                	je     1861 <free+0x61>
+    mutex_unlock(&lock);
+    1891:	c7 45 08 68 2e 00 00 	movl   $0x2e68,0x8(%ebp)
+}
+    1898:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    189b:	5b                   	pop    %ebx
+    189c:	5e                   	pop    %esi
+    189d:	5f                   	pop    %edi
+    189e:	5d                   	pop    %ebp
+    mutex_unlock(&lock);
+    189f:	e9 9c ea ff ff       	jmp    340 <mutex_unlock>
+    18a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    18a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    drain(tc, c, BATCH);
+    18ab:	89 da                	mov    %ebx,%edx
+    18ad:	b9 10 00 00 00       	mov    $0x10,%ecx
+}
+    18b2:	5b                   	pop    %ebx
+    18b3:	5e                   	pop    %esi
+    18b4:	5f                   	pop    %edi
+    18b5:	5d                   	pop    %ebp
+    drain(tc, c, BATCH);
+    18b6:	e9 05 fe ff ff       	jmp    16c0 <drain>
+    18bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    18bf:	90                   	nop
+  if(threaded)
+    18c0:	8b 15 64 2e 00 00    	mov    0x2e64,%edx
+    18c6:	85 d2                	test   %edx,%edx
+    18c8:	75 28                	jne    18f2 <free+0xf2>
+    bp->s.ptr = small[c];
+    18ca:	8b 04 9d c0 2e 00 00 	mov    0x2ec0(,%ebx,4),%eax
+    18d1:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    18d4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    18d7:	89 04 9d c0 2e 00 00 	mov    %eax,0x2ec0(,%ebx,4)
+  if(threaded)
+    18de:	eb 81                	jmp    1861 <free+0x61>
+    mutex_lock(&lock);
+    18e0:	83 ec 0c             	sub    $0xc,%esp
+    18e3:	68 68 2e 00 00       	push   $0x2e68
+    18e8:	e8 03 ea ff ff       	call   2f0 <mutex_lock>
+}
+    18ed:	83 c4 10             	add    $0x10,%esp
+    18f0:	eb 88                	jmp    187a <free+0x7a>
+    mutex_lock(&lock);
+    18f2:	83 ec 0c             	sub    $0xc,%esp
+    18f5:	68 68 2e 00 00       	push   $0x2e68
+    18fa:	e8 f1 e9 ff ff       	call   2f0 <mutex_lock>
+    bp->s.ptr = small[c];
+    18ff:	8b 04 9d c0 2e 00 00 	mov    0x2ec0(,%ebx,4),%eax
+  if(threaded)
+    1906:	83 c4 10             	add    $0x10,%esp
+    bp->s.ptr = small[c];
+    1909:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    190c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    190f:	89 04 9d c0 2e 00 00 	mov    %eax,0x2ec0(,%ebx,4)
+  if(threaded)
+    1916:	a1 64 2e 00 00       	mov    0x2e64,%eax
+    191b:	85 c0                	test   %eax,%eax
+    191d:	0f 85 6e ff ff ff    	jne    1891 <free+0x91>
+    1923:	e9 39 ff ff ff       	jmp    1861 <free+0x61>
+    1928:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    192f:	90                   	nop
+
+00001930 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1930:	55                   	push   %ebp
+    1931:	89 e5                	mov    %esp,%ebp
+    1933:	57                   	push   %edi
+    1934:	56                   	push   %esi
+    1935:	53                   	push   %ebx
+    1936:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  struct tcache *tc;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1939:	8b 45 08             	mov    0x8(%ebp),%eax
+    193c:	8d 78 07             	lea    0x7(%eax),%edi
+    193f:	c1 ef 03             	shr    $0x3,%edi
+    1942:	83 c7 01             	add    $0x1,%edi
+  if(nunits > SMALLMAX / sizeof(Header)){
+    1945:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+    194b:	77 5b                	ja     19a8 <malloc+0x78>
+    acquire();
+    p = bigalloc(nunits);
+    release();
+    return p ? (void*)(p + 1) : 0;
+  }
+  for(c = 0; (2 << c) < nunits; c++)
+    194d:	31 c9                	xor    %ecx,%ecx
+    194f:	b8 02 00 00 00       	mov    $0x2,%eax
+    1954:	be 02 00 00 00       	mov    $0x2,%esi
+    1959:	bb 02 00 00 00       	mov    $0x2,%ebx
+    195e:	83 ff 02             	cmp    $0x2,%edi
+    1961:	76 12                	jbe    1975 <malloc+0x45>
+    1963:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1967:	90                   	nop
+    1968:	83 c1 01             	add    $0x1,%ecx
+    196b:	89 c3                	mov    %eax,%ebx
+    196d:	d3 e3                	shl    %cl,%ebx
+    196f:	89 de                	mov    %ebx,%esi
+    1971:	39 fb                	cmp    %edi,%ebx
+    1973:	72 f3                	jb     1968 <malloc+0x38>
+    1975:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    ;
+  if((tc = mycache()) == 0)
+    1978:	e8 d3 fd ff ff       	call   1750 <mycache>
+    197d:	85 c0                	test   %eax,%eax
+    197f:	74 51                	je     19d2 <malloc+0xa2>
+    return 0;
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1981:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1984:	8d 3c 88             	lea    (%eax,%ecx,4),%edi
+    1987:	8b 07                	mov    (%edi),%eax
+    1989:	85 c0                	test   %eax,%eax
+    198b:	74 53                	je     19e0 <malloc+0xb0>
+    return 0;
+  p = tc->list[c];
+  tc->list[c] = p->s.ptr;
+  tc->n[c]--;
+    198d:	8b 57 20             	mov    0x20(%edi),%edx
+  tc->list[c] = p->s.ptr;
+    1990:	8b 08                	mov    (%eax),%ecx
+  tc->n[c]--;
+    1992:	83 ea 01             	sub    $0x1,%edx
+  return (void*)(p + 1);
+    1995:	83 c0 08             	add    $0x8,%eax
+  tc->n[c]--;
+    1998:	89 57 20             	mov    %edx,0x20(%edi)
+  tc->list[c] = p->s.ptr;
+    199b:	89 0f                	mov    %ecx,(%edi)
+}
+    199d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19a0:	5b                   	pop    %ebx
+    19a1:	5e                   	pop    %esi
+    19a2:	5f                   	pop    %edi
+    19a3:	5d                   	pop    %ebp
+    19a4:	c3                   	ret
+    19a5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    19a8:	a1 64 2e 00 00       	mov    0x2e64,%eax
+    19ad:	85 c0                	test   %eax,%eax
+    19af:	0f 85 b3 00 00 00    	jne    1a68 <malloc+0x138>
+    p = bigalloc(nunits);
+    19b5:	89 f8                	mov    %edi,%eax
+    19b7:	e8 14 fc ff ff       	call   15d0 <bigalloc>
+    19bc:	89 c3                	mov    %eax,%ebx
+  if(threaded)
+    19be:	a1 64 2e 00 00       	mov    0x2e64,%eax
+    19c3:	85 c0                	test   %eax,%eax
+    19c5:	0f 85 85 00 00 00    	jne    1a50 <malloc+0x120>
+    return p ? (void*)(p + 1) : 0;
+    19cb:	8d 43 08             	lea    0x8(%ebx),%eax
+    19ce:	85 db                	test   %ebx,%ebx
+    19d0:	75 cb                	jne    199d <malloc+0x6d>
+    19d2:	31 c0                	xor    %eax,%eax
+}
+    19d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19d7:	5b                   	pop    %ebx
+    19d8:	5e                   	pop    %esi
+    19d9:	5f                   	pop    %edi
+    19da:	5d                   	pop    %ebp
+    19db:	c3                   	ret
+    19dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    19e0:	a1 64 2e 00 00       	mov    0x2e64,%eax
+    19e5:	85 c0                	test   %eax,%eax
+    19e7:	0f 85 29 01 00 00    	jne    1b16 <malloc+0x1e6>
+  if(small[c] == 0){
+    19ed:	8b 04 8d c0 2e 00 00 	mov    0x2ec0(,%ecx,4),%eax
+    19f4:	85 c0                	test   %eax,%eax
+    19f6:	0f 84 81 00 00 00    	je     1a7d <malloc+0x14d>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    19fc:	31 db                	xor    %ebx,%ebx
+    19fe:	eb 22                	jmp    1a22 <malloc+0xf2>
+    small[c] = p->s.ptr;
+    1a00:	8b 10                	mov    (%eax),%edx
+  for(moved = 0; moved < n && small[c]; moved++){
+    1a02:	83 c3 01             	add    $0x1,%ebx
+    small[c] = p->s.ptr;
+    1a05:	89 14 8d c0 2e 00 00 	mov    %edx,0x2ec0(,%ecx,4)
+    p->s.ptr = tc->list[c];
+    1a0c:	8b 17                	mov    (%edi),%edx
+    1a0e:	89 10                	mov    %edx,(%eax)
+    tc->list[c] = p;
+    1a10:	89 07                	mov    %eax,(%edi)
+  for(moved = 0; moved < n && small[c]; moved++){
+    1a12:	83 fb 10             	cmp    $0x10,%ebx
+    1a15:	0f 84 e2 00 00 00    	je     1afd <malloc+0x1cd>
+    1a1b:	8b 04 8d c0 2e 00 00 	mov    0x2ec0(,%ecx,4),%eax
+    1a22:	85 c0                	test   %eax,%eax
+    1a24:	75 da                	jne    1a00 <malloc+0xd0>
+  if(threaded)
+    1a26:	8b 15 64 2e 00 00    	mov    0x2e64,%edx
+    1a2c:	85 d2                	test   %edx,%edx
+    1a2e:	0f 85 b4 00 00 00    	jne    1ae8 <malloc+0x1b8>
+  tc->n[c] += moved;
+    1a34:	8b 57 20             	mov    0x20(%edi),%edx
+    1a37:	01 da                	add    %ebx,%edx
+    1a39:	89 57 20             	mov    %edx,0x20(%edi)
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1a3c:	85 db                	test   %ebx,%ebx
+    1a3e:	74 92                	je     19d2 <malloc+0xa2>
+  p = tc->list[c];
+    1a40:	8b 07                	mov    (%edi),%eax
+    1a42:	e9 49 ff ff ff       	jmp    1990 <malloc+0x60>
+    1a47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a4e:	66 90                	xchg   %ax,%ax
+    mutex_unlock(&lock);
+    1a50:	83 ec 0c             	sub    $0xc,%esp
+    1a53:	68 68 2e 00 00       	push   $0x2e68
+    1a58:	e8 e3 e8 ff ff       	call   340 <mutex_unlock>
+}
+    1a5d:	83 c4 10             	add    $0x10,%esp
+    1a60:	e9 66 ff ff ff       	jmp    19cb <malloc+0x9b>
+    1a65:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1a68:	83 ec 0c             	sub    $0xc,%esp
+    1a6b:	68 68 2e 00 00       	push   $0x2e68
+    1a70:	e8 7b e8 ff ff       	call   2f0 <mutex_lock>
+}
+    1a75:	83 c4 10             	add    $0x10,%esp
+    1a78:	e9 38 ff ff ff       	jmp    19b5 <malloc+0x85>
+    if((chunk = bigalloc(CHUNK / sizeof(Header) + 1)) == 0){
+    1a7d:	b8 01 02 00 00       	mov    $0x201,%eax
+    1a82:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1a85:	e8 46 fb ff ff       	call   15d0 <bigalloc>
+    1a8a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1a8d:	85 c0                	test   %eax,%eax
+    1a8f:	89 c2                	mov    %eax,%edx
+    1a91:	0f 84 ba 00 00 00    	je     1b51 <malloc+0x221>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1a97:	83 c2 08             	add    $0x8,%edx
+    1a9a:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+    1aa0:	0f 87 d0 00 00 00    	ja     1b76 <malloc+0x246>
+    1aa6:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+    1aad:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    1ab0:	89 df                	mov    %ebx,%edi
+    1ab2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1ab5:	8d 76 00             	lea    0x0(%esi),%esi
+      p->s.size = units;
+    1ab8:	89 72 04             	mov    %esi,0x4(%edx)
+      p->s.ptr = small[c];
+    1abb:	8b 04 8d c0 2e 00 00 	mov    0x2ec0(,%ecx,4),%eax
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1ac2:	01 df                	add    %ebx,%edi
+    1ac4:	89 55 e0             	mov    %edx,-0x20(%ebp)
+      p->s.ptr = small[c];
+    1ac7:	89 02                	mov    %eax,(%edx)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1ac9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      small[c] = p;
+    1acc:	89 14 8d c0 2e 00 00 	mov    %edx,0x2ec0(,%ecx,4)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1ad3:	01 c2                	add    %eax,%edx
+    1ad5:	81 ff 00 02 00 00    	cmp    $0x200,%edi
+    1adb:	76 db                	jbe    1ab8 <malloc+0x188>
+    1add:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1ae0:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1ae3:	e9 14 ff ff ff       	jmp    19fc <malloc+0xcc>
+    mutex_unlock(&lock);
+    1ae8:	83 ec 0c             	sub    $0xc,%esp
+    1aeb:	68 68 2e 00 00       	push   $0x2e68
+    1af0:	e8 4b e8 ff ff       	call   340 <mutex_unlock>
+}
+    1af5:	83 c4 10             	add    $0x10,%esp
+    1af8:	e9 37 ff ff ff       	jmp    1a34 <malloc+0x104>
+  if(threaded)
+    1afd:	a1 64 2e 00 00       	mov    0x2e64,%eax
+    1b02:	85 c0                	test   %eax,%eax
+    1b04:	75 2b                	jne    1b31 <malloc+0x201>
+  tc->n[c] += moved;
+    1b06:	8b 47 20             	mov    0x20(%edi),%eax
+    1b09:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1b0c:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1b0e:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1b11:	e9 7a fe ff ff       	jmp    1990 <malloc+0x60>
+    mutex_lock(&lock);
+    1b16:	83 ec 0c             	sub    $0xc,%esp
+    1b19:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1b1c:	68 68 2e 00 00       	push   $0x2e68
+    1b21:	e8 ca e7 ff ff       	call   2f0 <mutex_lock>
+}
+    1b26:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1b29:	83 c4 10             	add    $0x10,%esp
+    1b2c:	e9 bc fe ff ff       	jmp    19ed <malloc+0xbd>
+    mutex_unlock(&lock);
+    1b31:	83 ec 0c             	sub    $0xc,%esp
+    1b34:	68 68 2e 00 00       	push   $0x2e68
+    1b39:	e8 02 e8 ff ff       	call   340 <mutex_unlock>
+  tc->n[c] += moved;
+    1b3e:	8b 47 20             	mov    0x20(%edi),%eax
+    1b41:	83 c4 10             	add    $0x10,%esp
+    1b44:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1b47:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1b49:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1b4c:	e9 3f fe ff ff       	jmp    1990 <malloc+0x60>
+  if(threaded)
+    1b51:	8b 0d 64 2e 00 00    	mov    0x2e64,%ecx
+    1b57:	85 c9                	test   %ecx,%ecx
+    1b59:	0f 84 73 fe ff ff    	je     19d2 <malloc+0xa2>
+    mutex_unlock(&lock);
+    1b5f:	83 ec 0c             	sub    $0xc,%esp
+    1b62:	68 68 2e 00 00       	push   $0x2e68
+    1b67:	e8 d4 e7 ff ff       	call   340 <mutex_unlock>
+    1b6c:	83 c4 10             	add    $0x10,%esp
+    return p ? (void*)(p + 1) : 0;
+    1b6f:	31 c0                	xor    %eax,%eax
+    1b71:	e9 5e fe ff ff       	jmp    19d4 <malloc+0xa4>
+  for(moved = 0; moved < n && small[c]; moved++){
+    1b76:	8b 04 8d c0 2e 00 00 	mov    0x2ec0(,%ecx,4),%eax
+    1b7d:	e9 7a fe ff ff       	jmp    19fc <malloc+0xcc>
+    1b82:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001b90 <malloc_threaded>:
+void
+malloc_threaded(void)
+{
+  uint sp;
+
+  if(threaded)
+    1b90:	a1 64 2e 00 00       	mov    0x2e64,%eax
+    1b95:	85 c0                	test   %eax,%eax
+    1b97:	74 07                	je     1ba0 <malloc_threaded+0x10>
+    1b99:	c3                   	ret
+    1b9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+{
+    1ba0:	55                   	push   %ebp
+    1ba1:	89 e5                	mov    %esp,%ebp
+    1ba3:	83 ec 24             	sub    $0x24,%esp
+    return;
+  mutex_init(&lock);
+    1ba6:	68 68 2e 00 00       	push   $0x2e68
+    1bab:	e8 30 e7 ff ff       	call   2e0 <mutex_init>
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1bb0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1bb3:	83 c4 10             	add    $0x10,%esp
+  threaded = 1;
+    1bb6:	c7 05 64 2e 00 00 01 	movl   $0x1,0x2e64
+    1bbd:	00 00 00 
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1bc0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    1bc5:	a3 60 2e 00 00       	mov    %eax,0x2e60
+}
+    1bca:	c9                   	leave
+    1bcb:	c3                   	ret
+    1bcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001bd0 <malloc_thread_exit>:
+
+// Called by thread_join() with the cache slot of a finished
+// thread: give its blocks, and the cache itself, back.
+void
+malloc_thread_exit(void **cachep)
+{
+    1bd0:	55                   	push   %ebp
+    1bd1:	89 e5                	mov    %esp,%ebp
+    1bd3:	57                   	push   %edi
+    1bd4:	56                   	push   %esi
+    1bd5:	53                   	push   %ebx
+    1bd6:	83 ec 0c             	sub    $0xc,%esp
+    1bd9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct tcache *tc;
+  int c;
+
+  if((tc = *cachep) == 0)
+    1bdc:	8b 37                	mov    (%edi),%esi
+    1bde:	85 f6                	test   %esi,%esi
+    1be0:	74 41                	je     1c23 <malloc_thread_exit+0x53>
+    return;
+  for(c = 0; c < NCLASS; c++)
+    1be2:	31 db                	xor    %ebx,%ebx
+    1be4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    drain(tc, c, tc->n[c]);
+    1be8:	8b 4c 9e 20          	mov    0x20(%esi,%ebx,4),%ecx
+    1bec:	89 da                	mov    %ebx,%edx
+    1bee:	89 f0                	mov    %esi,%eax
+  for(c = 0; c < NCLASS; c++)
+    1bf0:	83 c3 01             	add    $0x1,%ebx
+    drain(tc, c, tc->n[c]);
+    1bf3:	e8 c8 fa ff ff       	call   16c0 <drain>
+  for(c = 0; c < NCLASS; c++)
+    1bf8:	83 fb 08             	cmp    $0x8,%ebx
+    1bfb:	75 eb                	jne    1be8 <malloc_thread_exit+0x18>
+  if(threaded)
+    1bfd:	8b 15 64 2e 00 00    	mov    0x2e64,%edx
+    1c03:	85 d2                	test   %edx,%edx
+    1c05:	75 29                	jne    1c30 <malloc_thread_exit+0x60>
+  acquire();
+  trim(bigfree((Header*)tc - 1));
+    1c07:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1c0a:	e8 c1 f8 ff ff       	call   14d0 <bigfree>
+    1c0f:	e8 3c f9 ff ff       	call   1550 <trim>
+  if(threaded)
+    1c14:	a1 64 2e 00 00       	mov    0x2e64,%eax
+    1c19:	85 c0                	test   %eax,%eax
+    1c1b:	75 2b                	jne    1c48 <malloc_thread_exit+0x78>
+  release();
+  *cachep = 0;
+    1c1d:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+}
+    1c23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c26:	5b                   	pop    %ebx
+    1c27:	5e                   	pop    %esi
+    1c28:	5f                   	pop    %edi
+    1c29:	5d                   	pop    %ebp
+    1c2a:	c3                   	ret
+    1c2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1c2f:	90                   	nop
+    mutex_lock(&lock);
+    1c30:	83 ec 0c             	sub    $0xc,%esp
+    1c33:	68 68 2e 00 00       	push   $0x2e68
+    1c38:	e8 b3 e6 ff ff       	call   2f0 <mutex_lock>
+}
+    1c3d:	83 c4 10             	add    $0x10,%esp
+    1c40:	eb c5                	jmp    1c07 <malloc_thread_exit+0x37>
+    1c42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1c48:	83 ec 0c             	sub    $0xc,%esp
+    1c4b:	68 68 2e 00 00       	push   $0x2e68
+    1c50:	e8 eb e6 ff ff       	call   340 <mutex_unlock>
+}
+    1c55:	83 c4 10             	add    $0x10,%esp
+    1c58:	eb c3                	jmp    1c1d <malloc_thread_exit+0x4d>
+    1c5a:	66 90                	xchg   %ax,%ax
+    1c5c:	66 90                	xchg   %ax,%ax
+    1c5e:	66 90                	xchg   %ax,%ax
+
+00001c60 <thread_create>:
+
+// Start fn(arg) in a new thread on a freshly allocated
+// page-aligned stack.  Returns the thread's pid.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1c60:	55                   	push   %ebp
+    1c61:	89 e5                	mov    %esp,%ebp
+    1c63:	53                   	push   %ebx
+    1c64:	83 ec 14             	sub    $0x14,%esp
+  char *mem, *stack;
+  int pid;
+
+  malloc_threaded();
+    1c67:	e8 24 ff ff ff       	call   1b90 <malloc_threaded>
+  stdio_threaded();
+    1c6c:	e8 cf ee ff ff       	call   b40 <stdio_threaded>
+  if((mem = malloc(2*PGSIZE)) == 0)
+    1c71:	83 ec 0c             	sub    $0xc,%esp
+    1c74:	68 00 20 00 00       	push   $0x2000
+    1c79:	e8 b2 fc ff ff       	call   1930 <malloc>
+    1c7e:	83 c4 10             	add    $0x10,%esp
+    1c81:	85 c0                	test   %eax,%eax
+    1c83:	74 52                	je     1cd7 <thread_create+0x77>
+    1c85:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1c87:	8d 80 07 10 00 00    	lea    0x1007(%eax),%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+  ((char**)stack)[-2] = 0;
+  if((pid = clone(fn, arg, stack)) < 0)
+    1c8d:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1c90:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+    1c95:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  ((char**)stack)[-2] = 0;
+    1c98:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+  if((pid = clone(fn, arg, stack)) < 0)
+    1c9f:	50                   	push   %eax
+    1ca0:	ff 75 0c             	push   0xc(%ebp)
+    1ca3:	ff 75 08             	push   0x8(%ebp)
+    1ca6:	e8 97 e8 ff ff       	call   542 <clone>
+    1cab:	83 c4 10             	add    $0x10,%esp
+    1cae:	85 c0                	test   %eax,%eax
+    1cb0:	78 0e                	js     1cc0 <thread_create+0x60>
+    free(mem);
+  return pid;
+}
+    1cb2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1cb5:	c9                   	leave
+    1cb6:	c3                   	ret
+    1cb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1cbe:	66 90                	xchg   %ax,%ax
+    free(mem);
+    1cc0:	83 ec 0c             	sub    $0xc,%esp
+    1cc3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1cc6:	53                   	push   %ebx
+    1cc7:	e8 34 fb ff ff       	call   1800 <free>
+    1ccc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1ccf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    1cd2:	83 c4 10             	add    $0x10,%esp
+}
+    1cd5:	c9                   	leave
+    1cd6:	c3                   	ret
+    return -1;
+    1cd7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1cdc:	eb d4                	jmp    1cb2 <thread_create+0x52>
+    1cde:	66 90                	xchg   %ax,%ax
+
+00001ce0 <thread_join>:
+
+// Wait for a thread to finish and free its stack.
+int
+thread_join(void)
+{
+    1ce0:	55                   	push   %ebp
+    1ce1:	89 e5                	mov    %esp,%ebp
+    1ce3:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    1ce4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    1ce7:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    1cea:	50                   	push   %eax
+    1ceb:	e8 61 e8 ff ff       	call   551 <join>
+    1cf0:	83 c4 10             	add    $0x10,%esp
+    1cf3:	85 c0                	test   %eax,%eax
+    1cf5:	78 29                	js     1d20 <thread_join+0x40>
+    1cf7:	89 c3                	mov    %eax,%ebx
+    return -1;
+  malloc_thread_exit(&((void**)stack)[-2]);
+    1cf9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1cfc:	83 ec 0c             	sub    $0xc,%esp
+    1cff:	83 e8 08             	sub    $0x8,%eax
+    1d02:	50                   	push   %eax
+    1d03:	e8 c8 fe ff ff       	call   1bd0 <malloc_thread_exit>
+  free(((char**)stack)[-1]);
+    1d08:	58                   	pop    %eax
+    1d09:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1d0c:	ff 70 fc             	push   -0x4(%eax)
+    1d0f:	e8 ec fa ff ff       	call   1800 <free>
+  return pid;
+    1d14:	83 c4 10             	add    $0x10,%esp
+}
+    1d17:	89 d8                	mov    %ebx,%eax
+    1d19:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1d1c:	c9                   	leave
+    1d1d:	c3                   	ret
+    1d1e:	66 90                	xchg   %ax,%ax
+    return -1;
+    1d20:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    1d25:	eb f0                	jmp    1d17 <thread_join+0x37>
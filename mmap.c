@@ -0,0 +1,641 @@
+// Memory-mapped files and anonymous memory.
+//
+// mmap() only records a region in the address space's vma table; pages are
+// filled in by mmapfault() the first time the process touches them,
+// from the file's blocks for a file mapping or zeroed for MAP_ANON.
+// A MAP_SHARED page the process has written (PTE_D set by the
+// hardware) is written back to the file through the log when it is
+// unmapped. Mappings live between MMAPBASE and VDSO, above
+// anything sbrk() hands out.
+//
+// MAP_SHARED pages come from a struct shobj: one per mapped file,
+// and one per MAP_ANON region, which fork() hands on to the child.
+// Every process mapping the same offset of it maps the same page.
+// A file's page is read when first touched and stays until the
+// last region of the file is unmapped, so write() to the file does
+// not reach pages already mapped.
+//
+// The regions of an address space live in a struct mm, which the
+// threads made by clone() share along with the page table; it goes
+// away when the last of them exits or execs. fork() gives the child
+// its own struct mm and private copies of the pages mapped so far.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "proc.h"
+#include "stat.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+#include "mmap.h"
+
+// A region of memory set up by mmap(). Pages are filled in on
+// first touch by mmapfault().
+struct vma {
+    uint addr;                   // Start, page-aligned
+    uint len;                    // Length in bytes, page-aligned; 0 if unused
+    int prot;                    // PROT_READ, PROT_WRITE
+    int flags;                   // MAP_SHARED, MAP_PRIVATE, MAP_ANON
+    struct file *f;              // Mapped file, or 0 for MAP_ANON
+    uint off;                    // File offset of addr
+    struct shobj *sh;            // Pages of a MAP_SHARED region, or 0
+};
+
+// The pages of MAP_SHARED regions of one file or anonymous region.
+struct shobj {
+    struct shobj *next;          // Next on shobjs, if of a file
+    struct inode *ip;            // The file, or 0 for MAP_ANON
+    int ref;                     // Regions using it
+    struct shpage *pages;
+};
+
+struct shpage {
+    struct shpage *next;
+    uint off;                    // Offset in the file or region
+    char *mem;
+};
+
+// The mmap() regions of one address space.
+struct mm {
+    struct sleeplock lock;       // Protects vma[] and the regions' PTEs
+    int ref;                     // Processes using it
+    struct vma vma[NVMA];
+};
+
+static struct kmem_cache *mmcache;
+static struct kmem_cache *shcache;
+static struct kmem_cache *shpagecache;
+
+// Protects shobjs and each shobj's ref and pages.
+static struct spinlock shlock;
+static struct shobj *shobjs;  // Those of files
+
+static void
+mmctor(void *v) {
+    initsleeplock(&((struct mm *) v)->lock, "mm");
+}
+
+static void
+mmdtor(void *v) {
+    freesleeplock(&((struct mm *) v)->lock);
+}
+
+void
+mmapinit(void) {
+    mmcache = kmem_cache_create("mm", sizeof(struct mm), mmctor, mmdtor);
+    shcache = kmem_cache_create("shobj", sizeof(struct shobj), 0, 0);
+    shpagecache = kmem_cache_create("shpage", sizeof(struct shpage), 0, 0);
+    initlock(&shlock, "shobj");
+}
+
+// Return a reference to the shobj of file ip, or a new one
+// for an anonymous region if ip is 0. Returns 0 if out of memory.
+static struct shobj *
+shget(struct inode *ip) {
+    struct shobj *sh;
+
+    acquire(&shlock);
+    for (sh = ip ? shobjs : 0; sh; sh = sh->next)
+        if (sh->ip == ip) {
+            sh->ref++;
+            release(&shlock);
+            return sh;
+        }
+    if ((sh = kmem_cache_alloc(shcache)) != 0) {
+        sh->ip = ip;
+        sh->ref = 1;
+        sh->pages = 0;
+        if (ip) {
+            sh->next = shobjs;
+            shobjs = sh;
+        }
+    }
+    release(&shlock);
+    return sh;
+}
+
+static void
+shdup(struct shobj *sh) {
+    acquire(&shlock);
+    sh->ref++;
+    release(&shlock);
+}
+
+// Drop a reference to sh, freeing it and its pages with the last.
+static void
+shput(struct shobj *sh) {
+    struct shobj **pp;
+    struct shpage *pg;
+
+    acquire(&shlock);
+    if (--sh->ref > 0) {
+        release(&shlock);
+        return;
+    }
+    if (sh->ip) {
+        for (pp = &shobjs; *pp != sh; pp = &(*pp)->next)
+            ;
+        *pp = sh->next;
+    }
+    release(&shlock);
+    while ((pg = sh->pages) != 0) {
+        sh->pages = pg->next;
+        kfree(pg->mem);
+        kmem_cache_free(shpagecache, pg);
+    }
+    kmem_cache_free(shcache, sh);
+}
+
+// Return sh's page at offset off, or 0.
+// Caller holds shlock.
+static char *
+shlookup(struct shobj *sh, uint off) {
+    struct shpage *pg;
+
+    for (pg = sh->pages; pg; pg = pg->next)
+        if (pg->off == off)
+            return pg->mem;
+    return 0;
+}
+
+// Return p's struct mm, giving p an empty one if it has none
+// yet. Returns 0 if out of memory.
+static struct mm *
+getmm(struct proc *p) {
+    struct mm *mm;
+
+    if (p->mm == 0) {
+        if ((mm = kmem_cache_alloc(mmcache)) == 0)
+            return 0;
+        mm->ref = 1;
+        memset(mm->vma, 0, sizeof(mm->vma));
+        p->mm = mm;
+    }
+    return p->mm;
+}
+
+// Return mm's region containing va, or 0.
+// Caller holds mm->lock.
+static struct vma *
+findvma(struct mm *mm, uint va) {
+    struct vma *v;
+
+    for (v = mm->vma; v < &mm->vma[NVMA]; v++)
+        if (v->len > 0 && va >= v->addr && va < v->addr + v->len)
+            return v;
+    return 0;
+}
+
+// Map len bytes of f starting at page-aligned offset off, or zeroed
+// memory if f is 0. Returns the address of the new region, or -1.
+int
+mmap(uint len, int prot, int flags, struct file *f, uint off) {
+    struct mm *mm;
+    struct vma *v, *free;
+    uint addr;
+    int i, type;
+
+    if (len == 0 || len > VDSO - MMAPBASE)
+        return -1;
+    if ((flags & (MAP_SHARED | MAP_PRIVATE)) == 0 ||
+        (flags & (MAP_SHARED | MAP_PRIVATE)) == (MAP_SHARED | MAP_PRIVATE))
+        return -1;
+    len = PGROUNDUP(len);
+
+    if (f) {
+        if (f->type != FD_INODE || !f->readable || off % PGSIZE != 0)
+            return -1;
+        if ((flags & MAP_SHARED) && (prot & PROT_WRITE) && !f->writable)
+            return -1;
+        ilockshared(f->ip);
+        type = f->ip->type;
+        iunlock(f->ip);
+        if (type != T_FILE)
+            return -1;
+    }
+
+    if (f == 0)
+        off = 0;
+    if ((mm = getmm(myproc())) == 0)
+        return -1;
+    acquiresleep(&mm->lock);
+    free = 0;
+    for (v = mm->vma; v < &mm->vma[NVMA]; v++)
+        if (v->len == 0) {
+            free = v;
+            break;
+        }
+
+    // First fit: slide past each region in the way and rescan.
+    addr = MMAPBASE;
+    for (i = 0; i < NVMA; i++) {
+        v = &mm->vma[i];
+        if (v->len > 0 && addr < v->addr + v->len && v->addr < addr + len) {
+            addr = v->addr + v->len;
+            i = -1;
+        }
+    }
+    if (free == 0 || addr + len > VDSO) {
+        releasesleep(&mm->lock);
+        return -1;
+    }
+    free->sh = 0;
+    if ((flags & MAP_SHARED) && (free->sh = shget(f ? f->ip : 0)) == 0) {
+        releasesleep(&mm->lock);
+        return -1;
+    }
+
+    free->addr = addr;
+    free->len = len;
+    free->prot = prot;
+    free->flags = flags;
+    free->f = f ? filedup(f) : 0;
+    free->off = off;
+    releasesleep(&mm->lock);
+    return addr;
+}
+
+// Return a new page holding the contents of region v at file
+// offset off, or 0 if out of memory.
+static char *
+readpage(struct vma *v, uint off) {
+    char *mem;
+
+    while ((mem = kzalloc()) == 0)
+        if (swapwait(1) < 0)
+            return 0;
+    if (v->f) {
+        // Past the end of the file, the page stays zero.
+        ilockshared(v->f->ip);
+        readi(v->f->ip, mem, off, PGSIZE);
+        iunlock(v->f->ip);
+    }
+    return mem;
+}
+
+// Return the page at offset off of MAP_SHARED region v, reading
+// it in if no process has yet. Returns 0 if out of memory.
+static char *
+sharedpage(struct vma *v, uint off) {
+    struct shpage *pg;
+    char *mem, *m;
+
+    acquire(&shlock);
+    mem = shlookup(v->sh, off);
+    release(&shlock);
+    if (mem)
+        return mem;
+    if ((mem = readpage(v, off)) == 0)
+        return 0;
+    if ((pg = kmem_cache_alloc(shpagecache)) == 0) {
+        kfree(mem);
+        return 0;
+    }
+    // Another process may have read the page meanwhile.
+    acquire(&shlock);
+    if ((m = shlookup(v->sh, off)) != 0) {
+        kmem_cache_free(shpagecache, pg);
+        kfree(mem);
+        mem = m;
+    } else {
+        pg->off = off;
+        pg->mem = mem;
+        pg->next = v->sh->pages;
+        v->sh->pages = pg;
+    }
+    release(&shlock);
+    return mem;
+}
+
+// Fill the page at page-aligned a in region v of p, unless
+// another thread sharing the page table got there first.
+// Caller holds p->mm->lock.
+static int
+fillpage(struct proc *p, struct vma *v, uint a) {
+    char *mem;
+    pte_t *pte;
+    int perm;
+    uint off;
+
+    pte = walkpgdir(p->pgdir, (char *) a, 0);
+    if (pte && (*pte & PTE_P))
+        return 0;
+    off = v->off + (a - v->addr);
+    if ((mem = v->sh ? sharedpage(v, off) : readpage(v, off)) == 0)
+        return -1;
+    perm = PTE_U;
+    if (v->prot & PROT_WRITE)
+        perm |= PTE_W;
+    if (mappages(p->pgdir, (char *) a, PGSIZE, V2P(mem), perm) < 0) {
+        // A shared page stays with its shobj.
+        if (v->sh == 0)
+            kfree(mem);
+        return -1;
+    }
+    return 0;
+}
+
+// Handle a user page fault at va with x86 error code err.
+// Returns 0 if the page is now mapped, -1 if the access is invalid.
+int
+mmapfault(uint va, uint err) {
+    struct proc *p = myproc();
+    struct vma *v;
+    int r;
+
+    if (p->mm == 0 || (err & FEC_PR))
+        return -1;
+    acquiresleep(&p->mm->lock);
+    r = -1;
+    if ((v = findvma(p->mm, va)) != 0 && (v->prot & (PROT_READ | PROT_WRITE)) &&
+        (!(err & FEC_WR) || (v->prot & PROT_WRITE)))
+        r = fillpage(p, v, PGROUNDDOWN(va));
+    releasesleep(&p->mm->lock);
+    return r;
+}
+
+// Make sure [va, va+len) lies in mmap() regions that allow the
+// access, and fault in its pages, so the kernel can use the range
+// as a system call buffer. Returns 0 on success, -1 on failure.
+int
+mmapprefault(uint va, uint len, int write) {
+    struct proc *p = myproc();
+    struct vma *v;
+    uint a, last;
+    int r;
+
+    if (va + len < va || p->mm == 0)
+        return -1;
+    last = len > 0 ? va + len - 1 : va;
+    acquiresleep(&p->mm->lock);
+    for (a = PGROUNDDOWN(va); ; a += PGSIZE) {
+        r = -1;
+        if ((v = findvma(p->mm, a < va ? va : a)) == 0)
+            break;
+        if ((v->prot & (PROT_READ | PROT_WRITE)) == 0 ||
+            (write && !(v->prot & PROT_WRITE)))
+            break;
+        if ((r = fillpage(p, v, a)) < 0 || a == PGROUNDDOWN(last))
+            break;
+    }
+    releasesleep(&p->mm->lock);
+    return r;
+}
+
+// Write the page of region v at user address a, whose kernel
+// address is mem, back to the file. The file never grows:
+// only the part of the page inside the file is written.
+static void
+writeback(struct vma *v, uint a, char *mem) {
+    struct inode *ip = v->f->ip;
+    uint off;
+    int i, n;
+
+    // Split the page into transactions the log can hold,
+    // as filewrite() does.
+    int max = ((MAXOPBLOCKS - 1 - 1 - 2) / 2) * BSIZE;
+
+    off = v->off + (a - v->addr);
+    for (i = 0; i < PGSIZE; i += n) {
+        n = PGSIZE - i;
+        if (n > max)
+            n = max;
+        begin_op();
+        ilock(ip);
+        if (off + i >= ip->size)
+            n = 0;
+        else if (off + i + n > ip->size)
+            n = ip->size - (off + i);
+        if (n > 0)
+            writei(ip, mem + i, off + i, n);
+        iunlock(ip);
+        end_op();
+        if (n == 0)
+            break;
+    }
+}
+
+// Unmap the pages of [start, end) in region v of p, writing back
+// dirty MAP_SHARED pages. Pages not shared are freed.
+static void
+unmaprange(struct proc *p, struct vma *v, uint start, uint end) {
+    pte_t *pte;
+    uint a;
+    char *mem;
+
+    // Other CPUs running threads of p may have the pages in their
+    // TLBs: take away user access and have them flush first.
+    for (a = start; a < end; a += PGSIZE) {
+        pte = walkpgdir(p->pgdir, (char *) a, 0);
+        if (pte == 0)
+            a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+        else
+            *pte &= ~PTE_U;
+    }
+    tlbshootdown(p->pgdir);
+
+    for (a = start; a < end; a += PGSIZE) {
+        pte = walkpgdir(p->pgdir, (char *) a, 0);
+        if (pte == 0) {
+            a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+            continue;
+        }
+        if (!(*pte & PTE_P))
+            continue;
+        mem = P2V(PTE_ADDR(*pte));
+        if (v->f && v->sh && (*pte & PTE_D))
+            writeback(v, a, mem);
+        *pte = 0;
+        if (v->sh == 0)
+            kfree(mem);
+    }
+    lcr3(V2P(p->pgdir));
+}
+
+// Remove the mappings in [addr, addr+len). A region only partly
+// inside the range is trimmed, or split in two if the range
+// punches a hole in it. Returns 0 on success, -1 on failure.
+int
+munmap(uint addr, uint len) {
+    struct proc *p = myproc();
+    struct mm *mm = p->mm;
+    struct vma *v, *nv;
+    uint end, vend;
+
+    if (addr % PGSIZE != 0 || len == 0)
+        return -1;
+    end = PGROUNDUP(addr + len);
+    if (end <= addr || addr < MMAPBASE || end > VDSO)
+        return -1;
+    if (mm == 0)
+        return 0;
+
+    acquiresleep(&mm->lock);
+    for (v = mm->vma; v < &mm->vma[NVMA]; v++) {
+        vend = v->addr + v->len;
+        if (v->len == 0 || end <= v->addr || addr >= vend)
+            continue;
+        if (addr > v->addr && end < vend) {
+            // Punch a hole: the tail becomes a new region.
+            for (nv = mm->vma; nv < &mm->vma[NVMA]; nv++)
+                if (nv->len == 0)
+                    break;
+            if (nv == &mm->vma[NVMA]) {
+                releasesleep(&mm->lock);
+                return -1;
+            }
+            unmaprange(p, v, addr, end);
+            *nv = *v;
+            nv->addr = end;
+            nv->len = vend - end;
+            nv->off = v->off + (end - v->addr);
+            if (nv->f)
+                filedup(nv->f);
+            if (nv->sh)
+                shdup(nv->sh);
+            v->len = addr - v->addr;
+        } else if (addr > v->addr) {
+            unmaprange(p, v, addr, vend);
+            v->len = addr - v->addr;
+        } else if (end < vend) {
+            unmaprange(p, v, v->addr, end);
+            v->off += end - v->addr;
+            v->len = vend - end;
+            v->addr = end;
+        } else {
+            unmaprange(p, v, v->addr, vend);
+            if (v->sh)
+                shput(v->sh);
+            if (v->f)
+                fileclose(v->f);
+            v->sh = 0;
+            v->f = 0;
+            v->len = 0;
+        }
+    }
+    releasesleep(&mm->lock);
+    return 0;
+}
+
+// Drop the current process's use of its mappings. Called by
+// exit() and exec(). The regions are removed only if no other
+// thread shares them.
+void
+munmapall(void) {
+    struct proc *p = myproc();
+    struct mm *mm = p->mm;
+    struct vma *v;
+
+    if (mm == 0)
+        return;
+    p->mm = 0;
+    acquiresleep(&mm->lock);
+    if (--mm->ref > 0) {
+        releasesleep(&mm->lock);
+        return;
+    }
+    for (v = mm->vma; v < &mm->vma[NVMA]; v++) {
+        if (v->len == 0)
+            continue;
+        unmaprange(p, v, v->addr, v->addr + v->len);
+        if (v->sh)
+            shput(v->sh);
+        if (v->f)
+            fileclose(v->f);
+        v->sh = 0;
+        v->f = 0;
+        v->len = 0;
+    }
+    releasesleep(&mm->lock);
+    kmem_cache_free(mmcache, mm);
+}
+
+// Let thread np, made by clone(), share the current process's
+// mappings. Returns 0 on success, -1 if out of memory.
+int
+mmapclone(struct proc *np) {
+    struct mm *mm;
+
+    if ((mm = getmm(myproc())) == 0)
+        return -1;
+    acquiresleep(&mm->lock);
+    mm->ref++;
+    releasesleep(&mm->lock);
+    np->mm = mm;
+    return 0;
+}
+
+// Give child np copies of the current process's mappings. The
+// child maps the same pages of MAP_SHARED regions as the parent
+// and private copies of the other pages mapped so far. np->pgdir
+// must already be set up; on failure the caller frees it, along
+// with any pages copied into it.
+int
+mmapfork(struct proc *np) {
+    struct mm *mm = myproc()->mm;
+    struct mm *nmm;
+    struct vma *v;
+    pte_t *pte;
+    uint a;
+    char *mem;
+    int perm;
+
+    np->mm = 0;
+    if (mm == 0)
+        return 0;
+    if ((nmm = kmem_cache_alloc(mmcache)) == 0)
+        return -1;
+    acquiresleep(&mm->lock);
+    for (v = mm->vma; v < &mm->vma[NVMA]; v++) {
+        if (v->len == 0)
+            continue;
+        for (a = v->addr; a < v->addr + v->len; a += PGSIZE) {
+            pte = walkpgdir(myproc()->pgdir, (char *) a, 0);
+            if (pte == 0 || !(*pte & PTE_P))
+                continue;
+            // The child has not written the page; the parent
+            // still owns any write-back.
+            perm = PTE_FLAGS(*pte) & ~(PTE_P | PTE_A | PTE_D);
+            if (v->sh)
+                mem = P2V(PTE_ADDR(*pte));
+            else if ((mem = kalloc()) == 0)
+                goto bad;
+            else
+                memmove(mem, P2V(PTE_ADDR(*pte)), PGSIZE);
+            if (mappages(np->pgdir, (char *) a, PGSIZE, V2P(mem), perm) < 0) {
+                if (v->sh == 0)
+                    kfree(mem);
+                goto bad;
+            }
+        }
+    }
+    nmm->ref = 1;
+    for (v = mm->vma; v < &mm->vma[NVMA]; v++) {
+        nmm->vma[v - mm->vma] = *v;
+        if (v->len > 0 && v->f)
+            filedup(v->f);
+        if (v->len > 0 && v->sh)
+            shdup(v->sh);
+    }
+    releasesleep(&mm->lock);
+    np->mm = nmm;
+    return 0;
+
+    bad:
+    // Shared pages must not be freed with np->pgdir.
+    for (v = mm->vma; v < &mm->vma[NVMA]; v++) {
+        if (v->len == 0 || v->sh == 0)
+            continue;
+        for (a = v->addr; a < v->addr + v->len; a += PGSIZE)
+            if ((pte = walkpgdir(np->pgdir, (char *) a, 0)) != 0)
+                *pte = 0;
+    }
+    releasesleep(&mm->lock);
+    kmem_cache_free(mmcache, nmm);
+    return -1;
+}
@@ -0,0 +1,8 @@
+// mmap() protections and flags.
+// Both the kernel and user programs use this header file.
+#define PROT_READ    0x1   // pages may be read
+#define PROT_WRITE   0x2   // pages may be written
+
+#define MAP_SHARED   0x1   // pages shared with other mappers; writes go back to the file
+#define MAP_PRIVATE  0x2   // writes stay in this process
+#define MAP_ANON     0x4   // no file; pages start zeroed
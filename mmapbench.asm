@@ -0,0 +1,4200 @@
+
+_mmapbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return uptime() - t0;
+}
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+  int fd, i;
+
+  for(i = 0; i < sizeof(buf); i++)
+       7:	31 c0                	xor    %eax,%eax
+{
+       9:	ff 71 fc             	push   -0x4(%ecx)
+       c:	55                   	push   %ebp
+       d:	89 e5                	mov    %esp,%ebp
+       f:	56                   	push   %esi
+      10:	53                   	push   %ebx
+      11:	51                   	push   %ecx
+      12:	83 ec 0c             	sub    $0xc,%esp
+      15:	8d 76 00             	lea    0x0(%esi),%esi
+    buf[i] = i;
+      18:	88 80 c0 2a 00 00    	mov    %al,0x2ac0(%eax)
+  for(i = 0; i < sizeof(buf); i++)
+      1e:	83 c0 01             	add    $0x1,%eax
+      21:	3d 00 10 00 00       	cmp    $0x1000,%eax
+      26:	75 f0                	jne    18 <main+0x18>
+  fd = open("mmapbench.tmp", O_CREATE|O_WRONLY);
+      28:	83 ec 08             	sub    $0x8,%esp
+      2b:	bb 40 00 00 00       	mov    $0x40,%ebx
+      30:	68 01 02 00 00       	push   $0x201
+      35:	68 08 1f 00 00       	push   $0x1f08
+      3a:	e8 3e 06 00 00       	call   67d <open>
+      3f:	83 c4 10             	add    $0x10,%esp
+      42:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < SIZE; i += sizeof(buf))
+      44:	eb 0f                	jmp    55 <main+0x55>
+      46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      4d:	8d 76 00             	lea    0x0(%esi),%esi
+      50:	83 eb 01             	sub    $0x1,%ebx
+      53:	74 31                	je     86 <main+0x86>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+      55:	83 ec 04             	sub    $0x4,%esp
+      58:	68 00 10 00 00       	push   $0x1000
+      5d:	68 c0 2a 00 00       	push   $0x2ac0
+      62:	56                   	push   %esi
+      63:	e8 d9 05 00 00       	call   641 <write>
+      68:	83 c4 10             	add    $0x10,%esp
+      6b:	3d 00 10 00 00       	cmp    $0x1000,%eax
+      70:	74 de                	je     50 <main+0x50>
+      printf(2, "mmapbench: write failed\n");
+      72:	83 ec 08             	sub    $0x8,%esp
+      75:	68 6a 1f 00 00       	push   $0x1f6a
+      7a:	6a 02                	push   $0x2
+      7c:	e8 ff 09 00 00       	call   a80 <printf>
+      exit();
+      81:	e8 3a 02 00 00       	call   2c0 <exit>
+    }
+  close(fd);
+      86:	83 ec 0c             	sub    $0xc,%esp
+      89:	56                   	push   %esi
+      8a:	e8 c1 05 00 00       	call   650 <close>
+
+  printf(1, "mmapbench: %d KB x %d\n", SIZE / 1024, ROUNDS);
+      8f:	6a 14                	push   $0x14
+      91:	68 00 01 00 00       	push   $0x100
+      96:	68 83 1f 00 00       	push   $0x1f83
+      9b:	6a 01                	push   $0x1
+      9d:	e8 de 09 00 00       	call   a80 <printf>
+  printf(1, "read: %d ticks\n", scanread());
+      a2:	83 c4 20             	add    $0x20,%esp
+      a5:	e8 36 00 00 00       	call   e0 <scanread>
+      aa:	52                   	push   %edx
+      ab:	50                   	push   %eax
+      ac:	68 9a 1f 00 00       	push   $0x1f9a
+      b1:	6a 01                	push   $0x1
+      b3:	e8 c8 09 00 00       	call   a80 <printf>
+  printf(1, "mmap: %d ticks\n", scanmmap());
+      b8:	e8 d3 00 00 00       	call   190 <scanmmap>
+      bd:	83 c4 0c             	add    $0xc,%esp
+      c0:	50                   	push   %eax
+      c1:	68 aa 1f 00 00       	push   $0x1faa
+      c6:	6a 01                	push   $0x1
+      c8:	e8 b3 09 00 00       	call   a80 <printf>
+  unlink("mmapbench.tmp");
+      cd:	c7 04 24 08 1f 00 00 	movl   $0x1f08,(%esp)
+      d4:	e8 c2 05 00 00       	call   69b <unlink>
+  exit();
+      d9:	e8 e2 01 00 00       	call   2c0 <exit>
+      de:	66 90                	xchg   %ax,%ax
+
+000000e0 <scanread>:
+{
+      e0:	55                   	push   %ebp
+      e1:	89 e5                	mov    %esp,%ebp
+      e3:	57                   	push   %edi
+      e4:	56                   	push   %esi
+  t0 = uptime();
+      e5:	be 14 00 00 00       	mov    $0x14,%esi
+{
+      ea:	53                   	push   %ebx
+  sum = 0;
+      eb:	31 db                	xor    %ebx,%ebx
+{
+      ed:	83 ec 1c             	sub    $0x1c,%esp
+  t0 = uptime();
+      f0:	e8 fb 04 00 00       	call   5f0 <uptime>
+      f5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(r = 0; r < ROUNDS; r++){
+      f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      ff:	90                   	nop
+    fd = open("mmapbench.tmp", O_RDONLY);
+     100:	83 ec 08             	sub    $0x8,%esp
+     103:	6a 00                	push   $0x0
+     105:	68 08 1f 00 00       	push   $0x1f08
+     10a:	e8 6e 05 00 00       	call   67d <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0)
+     10f:	83 c4 10             	add    $0x10,%esp
+    fd = open("mmapbench.tmp", O_RDONLY);
+     112:	89 c7                	mov    %eax,%edi
+    while((n = read(fd, buf, sizeof(buf))) > 0)
+     114:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     118:	83 ec 04             	sub    $0x4,%esp
+     11b:	68 00 10 00 00       	push   $0x1000
+     120:	68 c0 2a 00 00       	push   $0x2ac0
+     125:	57                   	push   %edi
+     126:	e8 07 05 00 00       	call   632 <read>
+     12b:	83 c4 10             	add    $0x10,%esp
+     12e:	85 c0                	test   %eax,%eax
+     130:	7e 1e                	jle    150 <scanread+0x70>
+      for(i = 0; i < n; i++)
+     132:	31 d2                	xor    %edx,%edx
+     134:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        sum += (uchar)buf[i];
+     138:	0f b6 8a c0 2a 00 00 	movzbl 0x2ac0(%edx),%ecx
+      for(i = 0; i < n; i++)
+     13f:	83 c2 01             	add    $0x1,%edx
+        sum += (uchar)buf[i];
+     142:	01 cb                	add    %ecx,%ebx
+      for(i = 0; i < n; i++)
+     144:	39 d0                	cmp    %edx,%eax
+     146:	75 f0                	jne    138 <scanread+0x58>
+     148:	eb ce                	jmp    118 <scanread+0x38>
+     14a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    close(fd);
+     150:	83 ec 0c             	sub    $0xc,%esp
+     153:	57                   	push   %edi
+     154:	e8 f7 04 00 00       	call   650 <close>
+  for(r = 0; r < ROUNDS; r++){
+     159:	83 c4 10             	add    $0x10,%esp
+     15c:	83 ee 01             	sub    $0x1,%esi
+     15f:	75 9f                	jne    100 <scanread+0x20>
+  if(sum != ROUNDS * (SIZE / 256) * (255*256/2))
+     161:	81 fb 00 00 d8 27    	cmp    $0x27d80000,%ebx
+     167:	74 13                	je     17c <scanread+0x9c>
+    printf(2, "mmapbench: read sum %d wrong\n", sum);
+     169:	83 ec 04             	sub    $0x4,%esp
+     16c:	53                   	push   %ebx
+     16d:	68 16 1f 00 00       	push   $0x1f16
+     172:	6a 02                	push   $0x2
+     174:	e8 07 09 00 00       	call   a80 <printf>
+     179:	83 c4 10             	add    $0x10,%esp
+  return uptime() - t0;
+     17c:	e8 6f 04 00 00       	call   5f0 <uptime>
+     181:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+}
+     184:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     187:	5b                   	pop    %ebx
+  return uptime() - t0;
+     188:	29 f0                	sub    %esi,%eax
+}
+     18a:	5e                   	pop    %esi
+     18b:	5f                   	pop    %edi
+     18c:	5d                   	pop    %ebp
+     18d:	c3                   	ret
+     18e:	66 90                	xchg   %ax,%ax
+
+00000190 <scanmmap>:
+{
+     190:	55                   	push   %ebp
+     191:	89 e5                	mov    %esp,%ebp
+     193:	57                   	push   %edi
+     194:	56                   	push   %esi
+     195:	53                   	push   %ebx
+  sum = 0;
+     196:	31 db                	xor    %ebx,%ebx
+{
+     198:	83 ec 1c             	sub    $0x1c,%esp
+  t0 = uptime();
+     19b:	e8 50 04 00 00       	call   5f0 <uptime>
+     1a0:	c7 45 e4 14 00 00 00 	movl   $0x14,-0x1c(%ebp)
+     1a7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for(r = 0; r < ROUNDS; r++){
+     1aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    fd = open("mmapbench.tmp", O_RDONLY);
+     1b0:	83 ec 08             	sub    $0x8,%esp
+     1b3:	6a 00                	push   $0x0
+     1b5:	68 08 1f 00 00       	push   $0x1f08
+     1ba:	e8 be 04 00 00       	call   67d <open>
+     1bf:	89 c6                	mov    %eax,%esi
+    p = mmap(0, SIZE, PROT_READ, MAP_PRIVATE, fd, 0);
+     1c1:	58                   	pop    %eax
+     1c2:	5a                   	pop    %edx
+     1c3:	6a 00                	push   $0x0
+     1c5:	56                   	push   %esi
+     1c6:	6a 02                	push   $0x2
+     1c8:	6a 01                	push   $0x1
+     1ca:	68 00 00 04 00       	push   $0x40000
+     1cf:	6a 00                	push   $0x0
+     1d1:	e8 c4 05 00 00       	call   79a <mmap>
+    close(fd);
+     1d6:	83 c4 14             	add    $0x14,%esp
+     1d9:	56                   	push   %esi
+    p = mmap(0, SIZE, PROT_READ, MAP_PRIVATE, fd, 0);
+     1da:	89 c7                	mov    %eax,%edi
+    close(fd);
+     1dc:	e8 6f 04 00 00       	call   650 <close>
+    if(p == (uchar*)-1){
+     1e1:	83 c4 10             	add    $0x10,%esp
+     1e4:	83 ff ff             	cmp    $0xffffffff,%edi
+     1e7:	74 5f                	je     248 <scanmmap+0xb8>
+    for(i = 0; i < SIZE; i++)
+     1e9:	89 f8                	mov    %edi,%eax
+     1eb:	8d 8f 00 00 04 00    	lea    0x40000(%edi),%ecx
+     1f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      sum += p[i];
+     1f8:	0f b6 10             	movzbl (%eax),%edx
+    for(i = 0; i < SIZE; i++)
+     1fb:	83 c0 01             	add    $0x1,%eax
+      sum += p[i];
+     1fe:	01 d3                	add    %edx,%ebx
+    for(i = 0; i < SIZE; i++)
+     200:	39 c8                	cmp    %ecx,%eax
+     202:	75 f4                	jne    1f8 <scanmmap+0x68>
+    munmap(p, SIZE);
+     204:	83 ec 08             	sub    $0x8,%esp
+     207:	68 00 00 04 00       	push   $0x40000
+     20c:	57                   	push   %edi
+     20d:	e8 97 05 00 00       	call   7a9 <munmap>
+  for(r = 0; r < ROUNDS; r++){
+     212:	83 c4 10             	add    $0x10,%esp
+     215:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+     219:	75 95                	jne    1b0 <scanmmap+0x20>
+  if(sum != ROUNDS * (SIZE / 256) * (255*256/2))
+     21b:	81 fb 00 00 d8 27    	cmp    $0x27d80000,%ebx
+     221:	74 13                	je     236 <scanmmap+0xa6>
+    printf(2, "mmapbench: mmap sum %d wrong\n", sum);
+     223:	83 ec 04             	sub    $0x4,%esp
+     226:	53                   	push   %ebx
+     227:	68 4c 1f 00 00       	push   $0x1f4c
+     22c:	6a 02                	push   $0x2
+     22e:	e8 4d 08 00 00       	call   a80 <printf>
+     233:	83 c4 10             	add    $0x10,%esp
+  return uptime() - t0;
+     236:	e8 b5 03 00 00       	call   5f0 <uptime>
+     23b:	8b 75 e0             	mov    -0x20(%ebp),%esi
+}
+     23e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     241:	5b                   	pop    %ebx
+  return uptime() - t0;
+     242:	29 f0                	sub    %esi,%eax
+}
+     244:	5e                   	pop    %esi
+     245:	5f                   	pop    %edi
+     246:	5d                   	pop    %ebp
+     247:	c3                   	ret
+      printf(2, "mmapbench: mmap failed\n");
+     248:	83 ec 08             	sub    $0x8,%esp
+     24b:	68 34 1f 00 00       	push   $0x1f34
+     250:	6a 02                	push   $0x2
+     252:	e8 29 08 00 00       	call   a80 <printf>
+      exit();
+     257:	e8 64 00 00 00       	call   2c0 <exit>
+     25c:	66 90                	xchg   %ax,%ax
+     25e:	66 90                	xchg   %ax,%ax
+
+00000260 <fork>:
+int sysexit(void) __attribute__((noreturn));
+
+int
+fork(void)
+{
+  if(flushhook)
+     260:	a1 c0 3a 00 00       	mov    0x3ac0,%eax
+     265:	85 c0                	test   %eax,%eax
+     267:	74 17                	je     280 <fork+0x20>
+{
+     269:	55                   	push   %ebp
+     26a:	89 e5                	mov    %esp,%ebp
+     26c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     26f:	ff d0                	call   *%eax
+  return sysfork();
+}
+     271:	c9                   	leave
+  return sysfork();
+     272:	e9 7f 03 00 00       	jmp    5f6 <sysfork>
+     277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     27e:	66 90                	xchg   %ax,%ax
+     280:	e9 71 03 00 00       	jmp    5f6 <sysfork>
+     285:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+     290:	55                   	push   %ebp
+  if(flushhook)
+     291:	a1 c0 3a 00 00       	mov    0x3ac0,%eax
+{
+     296:	89 e5                	mov    %esp,%ebp
+     298:	56                   	push   %esi
+     299:	53                   	push   %ebx
+     29a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     29d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     2a0:	85 c0                	test   %eax,%eax
+     2a2:	74 02                	je     2a6 <exec+0x16>
+    flushhook();
+     2a4:	ff d0                	call   *%eax
+  return sysexec(path, argv);
+     2a6:	89 75 0c             	mov    %esi,0xc(%ebp)
+     2a9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     2ac:	5b                   	pop    %ebx
+     2ad:	5e                   	pop    %esi
+     2ae:	5d                   	pop    %ebp
+  return sysexec(path, argv);
+     2af:	e9 ba 03 00 00       	jmp    66e <sysexec>
+     2b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2bf:	90                   	nop
+
+000002c0 <exit>:
+
+int
+exit(void)
+{
+     2c0:	55                   	push   %ebp
+     2c1:	89 e5                	mov    %esp,%ebp
+     2c3:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     2c6:	a1 c0 3a 00 00       	mov    0x3ac0,%eax
+     2cb:	85 c0                	test   %eax,%eax
+     2cd:	74 02                	je     2d1 <exit+0x11>
+    flushhook();
+     2cf:	ff d0                	call   *%eax
+  sysexit();
+     2d1:	e8 2f 03 00 00       	call   605 <sysexit>
+     2d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002e0 <strcpy>:
+}
+
+char*
+strcpy(char *s, const char *t)
+{
+     2e0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     2e1:	31 c0                	xor    %eax,%eax
+{
+     2e3:	89 e5                	mov    %esp,%ebp
+     2e5:	53                   	push   %ebx
+     2e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     2e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     2ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     2f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     2f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     2f7:	83 c0 01             	add    $0x1,%eax
+     2fa:	84 d2                	test   %dl,%dl
+     2fc:	75 f2                	jne    2f0 <strcpy+0x10>
+    ;
+  return os;
+}
+     2fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     301:	89 c8                	mov    %ecx,%eax
+     303:	c9                   	leave
+     304:	c3                   	ret
+     305:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     310:	55                   	push   %ebp
+     311:	89 e5                	mov    %esp,%ebp
+     313:	53                   	push   %ebx
+     314:	8b 55 08             	mov    0x8(%ebp),%edx
+     317:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     31a:	0f b6 02             	movzbl (%edx),%eax
+     31d:	84 c0                	test   %al,%al
+     31f:	75 17                	jne    338 <strcmp+0x28>
+     321:	eb 3a                	jmp    35d <strcmp+0x4d>
+     323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     327:	90                   	nop
+     328:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     32c:	83 c2 01             	add    $0x1,%edx
+     32f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     332:	84 c0                	test   %al,%al
+     334:	74 1a                	je     350 <strcmp+0x40>
+    p++, q++;
+     336:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     338:	0f b6 19             	movzbl (%ecx),%ebx
+     33b:	38 c3                	cmp    %al,%bl
+     33d:	74 e9                	je     328 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     33f:	29 d8                	sub    %ebx,%eax
+}
+     341:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     344:	c9                   	leave
+     345:	c3                   	ret
+     346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     34d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     350:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     354:	31 c0                	xor    %eax,%eax
+     356:	29 d8                	sub    %ebx,%eax
+}
+     358:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     35b:	c9                   	leave
+     35c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     35d:	0f b6 19             	movzbl (%ecx),%ebx
+     360:	31 c0                	xor    %eax,%eax
+     362:	eb db                	jmp    33f <strcmp+0x2f>
+     364:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     36b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     36f:	90                   	nop
+
+00000370 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     370:	55                   	push   %ebp
+     371:	89 e5                	mov    %esp,%ebp
+     373:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     376:	80 3a 00             	cmpb   $0x0,(%edx)
+     379:	74 15                	je     390 <strlen+0x20>
+     37b:	31 c0                	xor    %eax,%eax
+     37d:	8d 76 00             	lea    0x0(%esi),%esi
+     380:	83 c0 01             	add    $0x1,%eax
+     383:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     387:	89 c1                	mov    %eax,%ecx
+     389:	75 f5                	jne    380 <strlen+0x10>
+    ;
+  return n;
+}
+     38b:	89 c8                	mov    %ecx,%eax
+     38d:	5d                   	pop    %ebp
+     38e:	c3                   	ret
+     38f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     390:	31 c9                	xor    %ecx,%ecx
+}
+     392:	5d                   	pop    %ebp
+     393:	89 c8                	mov    %ecx,%eax
+     395:	c3                   	ret
+     396:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     39d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003a0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     3a0:	55                   	push   %ebp
+     3a1:	89 e5                	mov    %esp,%ebp
+     3a3:	57                   	push   %edi
+     3a4:	8b 55 08             	mov    0x8(%ebp),%edx
+            "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt) {
+    asm volatile("cld; rep stosb" :
+     3a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     3aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+     3ad:	89 d7                	mov    %edx,%edi
+     3af:	fc                   	cld
+     3b0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     3b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     3b5:	89 d0                	mov    %edx,%eax
+     3b7:	c9                   	leave
+     3b8:	c3                   	ret
+     3b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003c0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     3c0:	55                   	push   %ebp
+     3c1:	89 e5                	mov    %esp,%ebp
+     3c3:	8b 45 08             	mov    0x8(%ebp),%eax
+     3c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     3ca:	0f b6 10             	movzbl (%eax),%edx
+     3cd:	84 d2                	test   %dl,%dl
+     3cf:	75 12                	jne    3e3 <strchr+0x23>
+     3d1:	eb 1d                	jmp    3f0 <strchr+0x30>
+     3d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3d7:	90                   	nop
+     3d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     3dc:	83 c0 01             	add    $0x1,%eax
+     3df:	84 d2                	test   %dl,%dl
+     3e1:	74 0d                	je     3f0 <strchr+0x30>
+    if(*s == c)
+     3e3:	38 d1                	cmp    %dl,%cl
+     3e5:	75 f1                	jne    3d8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     3e7:	5d                   	pop    %ebp
+     3e8:	c3                   	ret
+     3e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     3f0:	31 c0                	xor    %eax,%eax
+}
+     3f2:	5d                   	pop    %ebp
+     3f3:	c3                   	ret
+     3f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3ff:	90                   	nop
+
+00000400 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     400:	55                   	push   %ebp
+     401:	89 e5                	mov    %esp,%ebp
+     403:	56                   	push   %esi
+     404:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     405:	83 ec 08             	sub    $0x8,%esp
+     408:	6a 00                	push   $0x0
+     40a:	ff 75 08             	push   0x8(%ebp)
+     40d:	e8 6b 02 00 00       	call   67d <open>
+  if(fd < 0)
+     412:	83 c4 10             	add    $0x10,%esp
+     415:	85 c0                	test   %eax,%eax
+     417:	78 27                	js     440 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     419:	83 ec 08             	sub    $0x8,%esp
+     41c:	ff 75 0c             	push   0xc(%ebp)
+     41f:	89 c3                	mov    %eax,%ebx
+     421:	50                   	push   %eax
+     422:	e8 83 02 00 00       	call   6aa <fstat>
+  close(fd);
+     427:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     42a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     42c:	e8 1f 02 00 00       	call   650 <close>
+  return r;
+     431:	83 c4 10             	add    $0x10,%esp
+}
+     434:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     437:	89 f0                	mov    %esi,%eax
+     439:	5b                   	pop    %ebx
+     43a:	5e                   	pop    %esi
+     43b:	5d                   	pop    %ebp
+     43c:	c3                   	ret
+     43d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     440:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     445:	eb ed                	jmp    434 <stat+0x34>
+     447:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     44e:	66 90                	xchg   %ax,%ax
+
+00000450 <atoi>:
+
+int
+atoi(const char *s)
+{
+     450:	55                   	push   %ebp
+     451:	89 e5                	mov    %esp,%ebp
+     453:	53                   	push   %ebx
+     454:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     457:	0f be 02             	movsbl (%edx),%eax
+     45a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     45d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     460:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     465:	77 1e                	ja     485 <atoi+0x35>
+     467:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     46e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     470:	83 c2 01             	add    $0x1,%edx
+     473:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     476:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     47a:	0f be 02             	movsbl (%edx),%eax
+     47d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     480:	80 fb 09             	cmp    $0x9,%bl
+     483:	76 eb                	jbe    470 <atoi+0x20>
+  return n;
+}
+     485:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     488:	89 c8                	mov    %ecx,%eax
+     48a:	c9                   	leave
+     48b:	c3                   	ret
+     48c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     490:	55                   	push   %ebp
+     491:	89 e5                	mov    %esp,%ebp
+     493:	57                   	push   %edi
+     494:	56                   	push   %esi
+     495:	8b 45 10             	mov    0x10(%ebp),%eax
+     498:	8b 55 08             	mov    0x8(%ebp),%edx
+     49b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     49e:	85 c0                	test   %eax,%eax
+     4a0:	7e 13                	jle    4b5 <memmove+0x25>
+     4a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     4a4:	89 d7                	mov    %edx,%edi
+     4a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     4b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     4b1:	39 f8                	cmp    %edi,%eax
+     4b3:	75 fb                	jne    4b0 <memmove+0x20>
+  return vdst;
+}
+     4b5:	5e                   	pop    %esi
+     4b6:	89 d0                	mov    %edx,%eax
+     4b8:	5f                   	pop    %edi
+     4b9:	5d                   	pop    %ebp
+     4ba:	c3                   	ret
+     4bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4bf:	90                   	nop
+
+000004c0 <mutex_init>:
+
+// Futex-based mutex (Drepper, "Futexes Are Tricky", mutex 2).
+// The uncontended paths never enter the kernel.
+void
+mutex_init(struct mutex *m)
+{
+     4c0:	55                   	push   %ebp
+     4c1:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+     4c3:	8b 45 08             	mov    0x8(%ebp),%eax
+     4c6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     4cc:	5d                   	pop    %ebp
+     4cd:	c3                   	ret
+     4ce:	66 90                	xchg   %ax,%ax
+
+000004d0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     4d0:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     4d1:	31 c0                	xor    %eax,%eax
+     4d3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+     4d8:	89 e5                	mov    %esp,%ebp
+     4da:	56                   	push   %esi
+     4db:	53                   	push   %ebx
+     4dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     4df:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     4e3:	85 c0                	test   %eax,%eax
+     4e5:	74 32                	je     519 <mutex_lock+0x49>
+    return;
+  if(c != 2)
+     4e7:	83 f8 02             	cmp    $0x2,%eax
+     4ea:	74 0c                	je     4f8 <mutex_lock+0x28>
+static inline uint
+xchg(volatile uint *addr, uint newval) {
+    uint result;
+
+    // The + in "+m" denotes a read-modify-write operand.
+    asm volatile("lock; xchgl %0, %1" :
+     4ec:	b8 02 00 00 00       	mov    $0x2,%eax
+     4f1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+     4f4:	85 c0                	test   %eax,%eax
+     4f6:	74 21                	je     519 <mutex_lock+0x49>
+     4f8:	be 02 00 00 00       	mov    $0x2,%esi
+     4fd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAIT, 2);
+     500:	83 ec 04             	sub    $0x4,%esp
+     503:	6a 02                	push   $0x2
+     505:	6a 00                	push   $0x0
+     507:	53                   	push   %ebx
+     508:	e8 33 02 00 00       	call   740 <futex>
+     50d:	89 f0                	mov    %esi,%eax
+     50f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     512:	83 c4 10             	add    $0x10,%esp
+     515:	85 c0                	test   %eax,%eax
+     517:	75 e7                	jne    500 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+     519:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     51c:	5b                   	pop    %ebx
+     51d:	5e                   	pop    %esi
+     51e:	5d                   	pop    %ebp
+     51f:	c3                   	ret
+
+00000520 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     520:	55                   	push   %ebp
+     521:	89 e5                	mov    %esp,%ebp
+     523:	83 ec 08             	sub    $0x8,%esp
+     526:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     529:	f0 83 28 01          	lock subl $0x1,(%eax)
+     52d:	75 09                	jne    538 <mutex_unlock+0x18>
+    m->val = 0;
+    futex(&m->val, FUTEX_WAKE, 1);
+  }
+}
+     52f:	c9                   	leave
+     530:	c3                   	ret
+     531:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     538:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     53b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex(&m->val, FUTEX_WAKE, 1);
+     541:	6a 01                	push   $0x1
+     543:	6a 01                	push   $0x1
+     545:	50                   	push   %eax
+     546:	e8 f5 01 00 00       	call   740 <futex>
+     54b:	83 c4 10             	add    $0x10,%esp
+}
+     54e:	c9                   	leave
+     54f:	c3                   	ret
+
+00000550 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     550:	55                   	push   %ebp
+     551:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     553:	8b 45 08             	mov    0x8(%ebp),%eax
+     556:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     55c:	5d                   	pop    %ebp
+     55d:	c3                   	ret
+     55e:	66 90                	xchg   %ax,%ax
+
+00000560 <cond_wait>:
+
+// Release m and wait for a signal, then reacquire m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     560:	55                   	push   %ebp
+     561:	89 e5                	mov    %esp,%ebp
+     563:	57                   	push   %edi
+     564:	56                   	push   %esi
+     565:	53                   	push   %ebx
+     566:	83 ec 0c             	sub    $0xc,%esp
+     569:	8b 75 08             	mov    0x8(%ebp),%esi
+     56c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     56f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     571:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+     575:	75 21                	jne    598 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     577:	83 ec 04             	sub    $0x4,%esp
+     57a:	57                   	push   %edi
+     57b:	6a 00                	push   $0x0
+     57d:	56                   	push   %esi
+     57e:	e8 bd 01 00 00       	call   740 <futex>
+  mutex_lock(m);
+     583:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     586:	83 c4 10             	add    $0x10,%esp
+}
+     589:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     58c:	5b                   	pop    %ebx
+     58d:	5e                   	pop    %esi
+     58e:	5f                   	pop    %edi
+     58f:	5d                   	pop    %ebp
+  mutex_lock(m);
+     590:	e9 3b ff ff ff       	jmp    4d0 <mutex_lock>
+     595:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     598:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     59b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex(&m->val, FUTEX_WAKE, 1);
+     5a1:	6a 01                	push   $0x1
+     5a3:	6a 01                	push   $0x1
+     5a5:	53                   	push   %ebx
+     5a6:	e8 95 01 00 00       	call   740 <futex>
+     5ab:	83 c4 10             	add    $0x10,%esp
+     5ae:	eb c7                	jmp    577 <cond_wait+0x17>
+
+000005b0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+     5b0:	55                   	push   %ebp
+     5b1:	89 e5                	mov    %esp,%ebp
+     5b3:	83 ec 0c             	sub    $0xc,%esp
+     5b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     5b9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+     5bd:	6a 01                	push   $0x1
+     5bf:	6a 01                	push   $0x1
+     5c1:	50                   	push   %eax
+     5c2:	e8 79 01 00 00       	call   740 <futex>
+}
+     5c7:	83 c4 10             	add    $0x10,%esp
+     5ca:	c9                   	leave
+     5cb:	c3                   	ret
+     5cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005d0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     5d0:	55                   	push   %ebp
+     5d1:	89 e5                	mov    %esp,%ebp
+     5d3:	83 ec 0c             	sub    $0xc,%esp
+     5d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     5d9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+     5dd:	6a 40                	push   $0x40
+     5df:	6a 01                	push   $0x1
+     5e1:	50                   	push   %eax
+     5e2:	e8 59 01 00 00       	call   740 <futex>
+}
+     5e7:	83 c4 10             	add    $0x10,%esp
+     5ea:	c9                   	leave
+     5eb:	c3                   	ret
+     5ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005f0 <uptime>:
+// Clock ticks since boot, read from the kernel's vdso page
+// without a system call.
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     5f0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+     5f5:	c3                   	ret
+
+000005f6 <sysfork>:
+  1: ret
+
+#define SYSCALL(name) SYSCALLAS(name, name)
+
+// ulib.c wraps these.
+SYSCALLAS(sysfork, fork)
+     5f6:	b8 01 00 00 00       	mov    $0x1,%eax
+     5fb:	89 e1                	mov    %esp,%ecx
+     5fd:	ba 04 06 00 00       	mov    $0x604,%edx
+     602:	0f 34                	sysenter
+     604:	c3                   	ret
+
+00000605 <sysexit>:
+SYSCALLAS(sysexit, exit)
+     605:	b8 02 00 00 00       	mov    $0x2,%eax
+     60a:	89 e1                	mov    %esp,%ecx
+     60c:	ba 13 06 00 00       	mov    $0x613,%edx
+     611:	0f 34                	sysenter
+     613:	c3                   	ret
+
+00000614 <wait>:
+SYSCALL(wait)
+     614:	b8 03 00 00 00       	mov    $0x3,%eax
+     619:	89 e1                	mov    %esp,%ecx
+     61b:	ba 22 06 00 00       	mov    $0x622,%edx
+     620:	0f 34                	sysenter
+     622:	c3                   	ret
+
+00000623 <pipe>:
+SYSCALL(pipe)
+     623:	b8 04 00 00 00       	mov    $0x4,%eax
+     628:	89 e1                	mov    %esp,%ecx
+     62a:	ba 31 06 00 00       	mov    $0x631,%edx
+     62f:	0f 34                	sysenter
+     631:	c3                   	ret
+
+00000632 <read>:
+SYSCALL(read)
+     632:	b8 05 00 00 00       	mov    $0x5,%eax
+     637:	89 e1                	mov    %esp,%ecx
+     639:	ba 40 06 00 00       	mov    $0x640,%edx
+     63e:	0f 34                	sysenter
+     640:	c3                   	ret
+
+00000641 <write>:
+SYSCALL(write)
+     641:	b8 10 00 00 00       	mov    $0x10,%eax
+     646:	89 e1                	mov    %esp,%ecx
+     648:	ba 4f 06 00 00       	mov    $0x64f,%edx
+     64d:	0f 34                	sysenter
+     64f:	c3                   	ret
+
+00000650 <close>:
+SYSCALL(close)
+     650:	b8 15 00 00 00       	mov    $0x15,%eax
+     655:	89 e1                	mov    %esp,%ecx
+     657:	ba 5e 06 00 00       	mov    $0x65e,%edx
+     65c:	0f 34                	sysenter
+     65e:	c3                   	ret
+
+0000065f <kill>:
+SYSCALL(kill)
+     65f:	b8 06 00 00 00       	mov    $0x6,%eax
+     664:	89 e1                	mov    %esp,%ecx
+     666:	ba 6d 06 00 00       	mov    $0x66d,%edx
+     66b:	0f 34                	sysenter
+     66d:	c3                   	ret
+
+0000066e <sysexec>:
+SYSCALLAS(sysexec, exec)
+     66e:	b8 07 00 00 00       	mov    $0x7,%eax
+     673:	89 e1                	mov    %esp,%ecx
+     675:	ba 7c 06 00 00       	mov    $0x67c,%edx
+     67a:	0f 34                	sysenter
+     67c:	c3                   	ret
+
+0000067d <open>:
+SYSCALL(open)
+     67d:	b8 0f 00 00 00       	mov    $0xf,%eax
+     682:	89 e1                	mov    %esp,%ecx
+     684:	ba 8b 06 00 00       	mov    $0x68b,%edx
+     689:	0f 34                	sysenter
+     68b:	c3                   	ret
+
+0000068c <mknod>:
+SYSCALL(mknod)
+     68c:	b8 11 00 00 00       	mov    $0x11,%eax
+     691:	89 e1                	mov    %esp,%ecx
+     693:	ba 9a 06 00 00       	mov    $0x69a,%edx
+     698:	0f 34                	sysenter
+     69a:	c3                   	ret
+
+0000069b <unlink>:
+SYSCALL(unlink)
+     69b:	b8 12 00 00 00       	mov    $0x12,%eax
+     6a0:	89 e1                	mov    %esp,%ecx
+     6a2:	ba a9 06 00 00       	mov    $0x6a9,%edx
+     6a7:	0f 34                	sysenter
+     6a9:	c3                   	ret
+
+000006aa <fstat>:
+SYSCALL(fstat)
+     6aa:	b8 08 00 00 00       	mov    $0x8,%eax
+     6af:	89 e1                	mov    %esp,%ecx
+     6b1:	ba b8 06 00 00       	mov    $0x6b8,%edx
+     6b6:	0f 34                	sysenter
+     6b8:	c3                   	ret
+
+000006b9 <link>:
+SYSCALL(link)
+     6b9:	b8 13 00 00 00       	mov    $0x13,%eax
+     6be:	89 e1                	mov    %esp,%ecx
+     6c0:	ba c7 06 00 00       	mov    $0x6c7,%edx
+     6c5:	0f 34                	sysenter
+     6c7:	c3                   	ret
+
+000006c8 <mkdir>:
+SYSCALL(mkdir)
+     6c8:	b8 14 00 00 00       	mov    $0x14,%eax
+     6cd:	89 e1                	mov    %esp,%ecx
+     6cf:	ba d6 06 00 00       	mov    $0x6d6,%edx
+     6d4:	0f 34                	sysenter
+     6d6:	c3                   	ret
+
+000006d7 <chdir>:
+SYSCALL(chdir)
+     6d7:	b8 09 00 00 00       	mov    $0x9,%eax
+     6dc:	89 e1                	mov    %esp,%ecx
+     6de:	ba e5 06 00 00       	mov    $0x6e5,%edx
+     6e3:	0f 34                	sysenter
+     6e5:	c3                   	ret
+
+000006e6 <dup>:
+SYSCALL(dup)
+     6e6:	b8 0a 00 00 00       	mov    $0xa,%eax
+     6eb:	89 e1                	mov    %esp,%ecx
+     6ed:	ba f4 06 00 00       	mov    $0x6f4,%edx
+     6f2:	0f 34                	sysenter
+     6f4:	c3                   	ret
+
+000006f5 <getpid>:
+SYSCALL(getpid)
+     6f5:	b8 0b 00 00 00       	mov    $0xb,%eax
+     6fa:	89 e1                	mov    %esp,%ecx
+     6fc:	ba 03 07 00 00       	mov    $0x703,%edx
+     701:	0f 34                	sysenter
+     703:	c3                   	ret
+
+00000704 <sbrk>:
+SYSCALL(sbrk)
+     704:	b8 0c 00 00 00       	mov    $0xc,%eax
+     709:	89 e1                	mov    %esp,%ecx
+     70b:	ba 12 07 00 00       	mov    $0x712,%edx
+     710:	0f 34                	sysenter
+     712:	c3                   	ret
+
+00000713 <sleep>:
+SYSCALL(sleep)
+     713:	b8 0d 00 00 00       	mov    $0xd,%eax
+     718:	89 e1                	mov    %esp,%ecx
+     71a:	ba 21 07 00 00       	mov    $0x721,%edx
+     71f:	0f 34                	sysenter
+     721:	c3                   	ret
+
+00000722 <clone>:
+SYSCALL(clone)
+     722:	b8 16 00 00 00       	mov    $0x16,%eax
+     727:	89 e1                	mov    %esp,%ecx
+     729:	ba 30 07 00 00       	mov    $0x730,%edx
+     72e:	0f 34                	sysenter
+     730:	c3                   	ret
+
+00000731 <join>:
+SYSCALL(join)
+     731:	b8 17 00 00 00       	mov    $0x17,%eax
+     736:	89 e1                	mov    %esp,%ecx
+     738:	ba 3f 07 00 00       	mov    $0x73f,%edx
+     73d:	0f 34                	sysenter
+     73f:	c3                   	ret
+
+00000740 <futex>:
+SYSCALL(futex)
+     740:	b8 18 00 00 00       	mov    $0x18,%eax
+     745:	89 e1                	mov    %esp,%ecx
+     747:	ba 4e 07 00 00       	mov    $0x74e,%edx
+     74c:	0f 34                	sysenter
+     74e:	c3                   	ret
+
+0000074f <yield>:
+SYSCALL(yield)
+     74f:	b8 19 00 00 00       	mov    $0x19,%eax
+     754:	89 e1                	mov    %esp,%ecx
+     756:	ba 5d 07 00 00       	mov    $0x75d,%edx
+     75b:	0f 34                	sysenter
+     75d:	c3                   	ret
+
+0000075e <lockstat>:
+SYSCALL(lockstat)
+     75e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     763:	89 e1                	mov    %esp,%ecx
+     765:	ba 6c 07 00 00       	mov    $0x76c,%edx
+     76a:	0f 34                	sysenter
+     76c:	c3                   	ret
+
+0000076d <lockhammer>:
+SYSCALL(lockhammer)
+     76d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     772:	89 e1                	mov    %esp,%ecx
+     774:	ba 7b 07 00 00       	mov    $0x77b,%edx
+     779:	0f 34                	sysenter
+     77b:	c3                   	ret
+
+0000077c <vmsplice>:
+SYSCALL(vmsplice)
+     77c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     781:	89 e1                	mov    %esp,%ecx
+     783:	ba 8a 07 00 00       	mov    $0x78a,%edx
+     788:	0f 34                	sysenter
+     78a:	c3                   	ret
+
+0000078b <hsbrk>:
+SYSCALL(hsbrk)
+     78b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     790:	89 e1                	mov    %esp,%ecx
+     792:	ba 99 07 00 00       	mov    $0x799,%edx
+     797:	0f 34                	sysenter
+     799:	c3                   	ret
+
+0000079a <mmap>:
+SYSCALL(mmap)
+     79a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     79f:	89 e1                	mov    %esp,%ecx
+     7a1:	ba a8 07 00 00       	mov    $0x7a8,%edx
+     7a6:	0f 34                	sysenter
+     7a8:	c3                   	ret
+
+000007a9 <munmap>:
+SYSCALL(munmap)
+     7a9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     7ae:	89 e1                	mov    %esp,%ecx
+     7b0:	ba b7 07 00 00       	mov    $0x7b7,%edx
+     7b5:	0f 34                	sysenter
+     7b7:	c3                   	ret
+
+000007b8 <ringenter>:
+SYSCALL(ringenter)
+     7b8:	b8 20 00 00 00       	mov    $0x20,%eax
+     7bd:	89 e1                	mov    %esp,%ecx
+     7bf:	ba c6 07 00 00       	mov    $0x7c6,%edx
+     7c4:	0f 34                	sysenter
+     7c6:	c3                   	ret
+
+000007c7 <readv>:
+SYSCALL(readv)
+     7c7:	b8 21 00 00 00       	mov    $0x21,%eax
+     7cc:	89 e1                	mov    %esp,%ecx
+     7ce:	ba d5 07 00 00       	mov    $0x7d5,%edx
+     7d3:	0f 34                	sysenter
+     7d5:	c3                   	ret
+
+000007d6 <writev>:
+SYSCALL(writev)
+     7d6:	b8 22 00 00 00       	mov    $0x22,%eax
+     7db:	89 e1                	mov    %esp,%ecx
+     7dd:	ba e4 07 00 00       	mov    $0x7e4,%edx
+     7e2:	0f 34                	sysenter
+     7e4:	c3                   	ret
+
+000007e5 <pread>:
+SYSCALL(pread)
+     7e5:	b8 23 00 00 00       	mov    $0x23,%eax
+     7ea:	89 e1                	mov    %esp,%ecx
+     7ec:	ba f3 07 00 00       	mov    $0x7f3,%edx
+     7f1:	0f 34                	sysenter
+     7f3:	c3                   	ret
+
+000007f4 <pwrite>:
+SYSCALL(pwrite)
+     7f4:	b8 24 00 00 00       	mov    $0x24,%eax
+     7f9:	89 e1                	mov    %esp,%ecx
+     7fb:	ba 02 08 00 00       	mov    $0x802,%edx
+     800:	0f 34                	sysenter
+     802:	c3                   	ret
+
+00000803 <prof>:
+SYSCALL(prof)
+     803:	b8 25 00 00 00       	mov    $0x25,%eax
+     808:	89 e1                	mov    %esp,%ecx
+     80a:	ba 11 08 00 00       	mov    $0x811,%edx
+     80f:	0f 34                	sysenter
+     811:	c3                   	ret
+
+00000812 <scstat>:
+SYSCALL(scstat)
+     812:	b8 26 00 00 00       	mov    $0x26,%eax
+     817:	89 e1                	mov    %esp,%ecx
+     819:	ba 20 08 00 00       	mov    $0x820,%edx
+     81e:	0f 34                	sysenter
+     820:	c3                   	ret
+     821:	66 90                	xchg   %ax,%ax
+     823:	66 90                	xchg   %ax,%ax
+     825:	66 90                	xchg   %ax,%ax
+     827:	66 90                	xchg   %ax,%ax
+     829:	66 90                	xchg   %ax,%ax
+     82b:	66 90                	xchg   %ax,%ax
+     82d:	66 90                	xchg   %ax,%ax
+     82f:	90                   	nop
+
+00000830 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+     830:	55                   	push   %ebp
+     831:	89 e5                	mov    %esp,%ebp
+     833:	57                   	push   %edi
+     834:	56                   	push   %esi
+     835:	53                   	push   %ebx
+     836:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     838:	89 d1                	mov    %edx,%ecx
+{
+     83a:	83 ec 2c             	sub    $0x2c,%esp
+     83d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+     840:	85 d2                	test   %edx,%edx
+     842:	79 7c                	jns    8c0 <printint+0x90>
+     844:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     848:	74 76                	je     8c0 <printint+0x90>
+    x = -xx;
+     84a:	f7 d9                	neg    %ecx
+    neg = 1;
+     84c:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     851:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     854:	31 f6                	xor    %esi,%esi
+     856:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     85d:	8d 76 00             	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     860:	89 c8                	mov    %ecx,%eax
+     862:	31 d2                	xor    %edx,%edx
+     864:	89 f7                	mov    %esi,%edi
+     866:	f7 f3                	div    %ebx
+     868:	8d 76 01             	lea    0x1(%esi),%esi
+     86b:	0f b6 92 1c 20 00 00 	movzbl 0x201c(%edx),%edx
+     872:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     876:	89 ca                	mov    %ecx,%edx
+     878:	89 c1                	mov    %eax,%ecx
+     87a:	39 da                	cmp    %ebx,%edx
+     87c:	73 e2                	jae    860 <printint+0x30>
+  if(neg)
+     87e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     881:	85 c0                	test   %eax,%eax
+     883:	74 07                	je     88c <printint+0x5c>
+    buf[i++] = '-';
+     885:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     88a:	89 f7                	mov    %esi,%edi
+     88c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     88f:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     892:	01 df                	add    %ebx,%edi
+     894:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc_unlocked(buf[i], f);
+     898:	83 ec 08             	sub    $0x8,%esp
+     89b:	56                   	push   %esi
+     89c:	0f be 07             	movsbl (%edi),%eax
+     89f:	50                   	push   %eax
+     8a0:	e8 cb 07 00 00       	call   1070 <putc_unlocked>
+  while(--i >= 0)
+     8a5:	89 f8                	mov    %edi,%eax
+     8a7:	83 c4 10             	add    $0x10,%esp
+     8aa:	83 ef 01             	sub    $0x1,%edi
+     8ad:	39 d8                	cmp    %ebx,%eax
+     8af:	75 e7                	jne    898 <printint+0x68>
+}
+     8b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8b4:	5b                   	pop    %ebx
+     8b5:	5e                   	pop    %esi
+     8b6:	5f                   	pop    %edi
+     8b7:	5d                   	pop    %ebp
+     8b8:	c3                   	ret
+     8b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     8c0:	31 c0                	xor    %eax,%eax
+     8c2:	eb 8d                	jmp    851 <printint+0x21>
+     8c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     8cf:	90                   	nop
+
+000008d0 <vfprintf>:
+
+// Print to the given stream, which the caller has locked.
+// Only understands %d, %x, %p, %s.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+     8d0:	55                   	push   %ebp
+     8d1:	89 e5                	mov    %esp,%ebp
+     8d3:	57                   	push   %edi
+     8d4:	56                   	push   %esi
+     8d5:	53                   	push   %ebx
+     8d6:	83 ec 1c             	sub    $0x1c,%esp
+     8d9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     8dc:	0f b6 0a             	movzbl (%edx),%ecx
+     8df:	84 c9                	test   %cl,%cl
+     8e1:	74 5c                	je     93f <vfprintf+0x6f>
+     8e3:	89 c6                	mov    %eax,%esi
+     8e5:	8d 5a 01             	lea    0x1(%edx),%ebx
+     8e8:	31 ff                	xor    %edi,%edi
+     8ea:	eb 20                	jmp    90c <vfprintf+0x3c>
+     8ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     8f0:	83 f9 25             	cmp    $0x25,%ecx
+     8f3:	74 3b                	je     930 <vfprintf+0x60>
+        state = '%';
+      } else {
+        putc_unlocked(c, f);
+     8f5:	83 ec 08             	sub    $0x8,%esp
+     8f8:	56                   	push   %esi
+     8f9:	51                   	push   %ecx
+     8fa:	e8 71 07 00 00       	call   1070 <putc_unlocked>
+     8ff:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     902:	0f b6 0b             	movzbl (%ebx),%ecx
+     905:	83 c3 01             	add    $0x1,%ebx
+     908:	84 c9                	test   %cl,%cl
+     90a:	74 33                	je     93f <vfprintf+0x6f>
+    if(state == 0){
+     90c:	85 ff                	test   %edi,%edi
+     90e:	74 e0                	je     8f0 <vfprintf+0x20>
+      }
+    } else if(state == '%'){
+     910:	83 ff 25             	cmp    $0x25,%edi
+     913:	75 ed                	jne    902 <vfprintf+0x32>
+      if(c == 'd'){
+     915:	83 f9 25             	cmp    $0x25,%ecx
+     918:	0f 84 02 01 00 00    	je     a20 <vfprintf+0x150>
+     91e:	8d 41 9d             	lea    -0x63(%ecx),%eax
+     921:	83 f8 15             	cmp    $0x15,%eax
+     924:	77 2a                	ja     950 <vfprintf+0x80>
+     926:	ff 24 85 c4 1f 00 00 	jmp    *0x1fc4(,%eax,4)
+     92d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     930:	0f b6 0b             	movzbl (%ebx),%ecx
+     933:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     936:	bf 25 00 00 00       	mov    $0x25,%edi
+  for(i = 0; fmt[i]; i++){
+     93b:	84 c9                	test   %cl,%cl
+     93d:	75 cd                	jne    90c <vfprintf+0x3c>
+        putc_unlocked(c, f);
+      }
+      state = 0;
+    }
+  }
+}
+     93f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     942:	5b                   	pop    %ebx
+     943:	5e                   	pop    %esi
+     944:	5f                   	pop    %edi
+     945:	5d                   	pop    %ebp
+     946:	c3                   	ret
+     947:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     94e:	66 90                	xchg   %ax,%ax
+        putc_unlocked('%', f);
+     950:	83 ec 08             	sub    $0x8,%esp
+     953:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     956:	56                   	push   %esi
+     957:	6a 25                	push   $0x25
+     959:	e8 12 07 00 00       	call   1070 <putc_unlocked>
+        putc_unlocked(c, f);
+     95e:	58                   	pop    %eax
+     95f:	5a                   	pop    %edx
+     960:	56                   	push   %esi
+     961:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     964:	51                   	push   %ecx
+     965:	e8 06 07 00 00       	call   1070 <putc_unlocked>
+     96a:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     96d:	31 ff                	xor    %edi,%edi
+     96f:	eb 91                	jmp    902 <vfprintf+0x32>
+     971:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+     978:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     97b:	83 ec 0c             	sub    $0xc,%esp
+     97e:	b9 10 00 00 00       	mov    $0x10,%ecx
+     983:	8b 17                	mov    (%edi),%edx
+     985:	6a 00                	push   $0x0
+        ap++;
+     987:	83 c7 04             	add    $0x4,%edi
+        printint(f, *ap, 16, 0);
+     98a:	89 f0                	mov    %esi,%eax
+     98c:	e8 9f fe ff ff       	call   830 <printint>
+        ap++;
+     991:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     994:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     997:	31 ff                	xor    %edi,%edi
+     999:	e9 64 ff ff ff       	jmp    902 <vfprintf+0x32>
+     99e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     9a0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     9a3:	8b 10                	mov    (%eax),%edx
+        ap++;
+     9a5:	83 c0 04             	add    $0x4,%eax
+     9a8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     9ab:	85 d2                	test   %edx,%edx
+     9ad:	0f 84 85 00 00 00    	je     a38 <vfprintf+0x168>
+        while(*s != 0){
+     9b3:	0f be 02             	movsbl (%edx),%eax
+        s = (char*)*ap;
+     9b6:	89 d7                	mov    %edx,%edi
+        while(*s != 0){
+     9b8:	84 c0                	test   %al,%al
+     9ba:	74 b1                	je     96d <vfprintf+0x9d>
+     9bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+          putc_unlocked(*s, f);
+     9c0:	83 ec 08             	sub    $0x8,%esp
+          s++;
+     9c3:	83 c7 01             	add    $0x1,%edi
+          putc_unlocked(*s, f);
+     9c6:	56                   	push   %esi
+     9c7:	50                   	push   %eax
+     9c8:	e8 a3 06 00 00       	call   1070 <putc_unlocked>
+        while(*s != 0){
+     9cd:	0f be 07             	movsbl (%edi),%eax
+     9d0:	83 c4 10             	add    $0x10,%esp
+     9d3:	84 c0                	test   %al,%al
+     9d5:	75 e9                	jne    9c0 <vfprintf+0xf0>
+      state = 0;
+     9d7:	31 ff                	xor    %edi,%edi
+     9d9:	e9 24 ff ff ff       	jmp    902 <vfprintf+0x32>
+     9de:	66 90                	xchg   %ax,%ax
+        printint(f, *ap, 10, 1);
+     9e0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     9e3:	83 ec 0c             	sub    $0xc,%esp
+     9e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     9eb:	8b 17                	mov    (%edi),%edx
+     9ed:	6a 01                	push   $0x1
+     9ef:	eb 96                	jmp    987 <vfprintf+0xb7>
+     9f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc_unlocked(*ap, f);
+     9f8:	83 ec 08             	sub    $0x8,%esp
+     9fb:	56                   	push   %esi
+     9fc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     9ff:	ff 37                	push   (%edi)
+     a01:	e8 6a 06 00 00       	call   1070 <putc_unlocked>
+        ap++;
+     a06:	89 f8                	mov    %edi,%eax
+     a08:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     a0b:	31 ff                	xor    %edi,%edi
+        ap++;
+     a0d:	83 c0 04             	add    $0x4,%eax
+     a10:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     a13:	e9 ea fe ff ff       	jmp    902 <vfprintf+0x32>
+     a18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a1f:	90                   	nop
+        putc_unlocked(c, f);
+     a20:	83 ec 08             	sub    $0x8,%esp
+      state = 0;
+     a23:	31 ff                	xor    %edi,%edi
+        putc_unlocked(c, f);
+     a25:	56                   	push   %esi
+     a26:	6a 25                	push   $0x25
+     a28:	e8 43 06 00 00       	call   1070 <putc_unlocked>
+     a2d:	83 c4 10             	add    $0x10,%esp
+     a30:	e9 cd fe ff ff       	jmp    902 <vfprintf+0x32>
+     a35:	8d 76 00             	lea    0x0(%esi),%esi
+     a38:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     a3d:	bf ba 1f 00 00       	mov    $0x1fba,%edi
+     a42:	e9 79 ff ff ff       	jmp    9c0 <vfprintf+0xf0>
+     a47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a4e:	66 90                	xchg   %ax,%ax
+
+00000a50 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+     a50:	55                   	push   %ebp
+     a51:	89 e5                	mov    %esp,%ebp
+     a53:	53                   	push   %ebx
+     a54:	83 ec 10             	sub    $0x10,%esp
+     a57:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  flockfile(f);
+     a5a:	53                   	push   %ebx
+     a5b:	e8 d0 02 00 00       	call   d30 <flockfile>
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     a60:	8b 55 0c             	mov    0xc(%ebp),%edx
+     a63:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     a66:	89 d8                	mov    %ebx,%eax
+     a68:	e8 63 fe ff ff       	call   8d0 <vfprintf>
+  funlockfile(f);
+     a6d:	89 1c 24             	mov    %ebx,(%esp)
+     a70:	e8 eb 02 00 00       	call   d60 <funlockfile>
+}
+     a75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a78:	83 c4 10             	add    $0x10,%esp
+     a7b:	c9                   	leave
+     a7c:	c3                   	ret
+     a7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a80 <printf>:
+
+// Print to the given fd: through stdout or stderr for 1 and 2,
+// otherwise with one write() per call.
+void
+printf(int fd, const char *fmt, ...)
+{
+     a80:	55                   	push   %ebp
+     a81:	89 e5                	mov    %esp,%ebp
+     a83:	56                   	push   %esi
+     a84:	53                   	push   %ebx
+     a85:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+     a8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  char buf[128];
+  struct iobuf f;
+
+  if(fd == 1 || fd == 2){
+    flockfile(&_iob[fd]);
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     a8e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(fd == 1 || fd == 2){
+     a91:	8d 50 ff             	lea    -0x1(%eax),%edx
+     a94:	83 fa 01             	cmp    $0x1,%edx
+     a97:	76 77                	jbe    b10 <printf+0x90>
+    funlockfile(&_iob[fd]);
+    return;
+  }
+  f.fd = fd;
+     a99:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  f.flags = IO_WRITE|IO_SETUP;
+  f.buf = buf;
+     a9f:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  f.size = sizeof(buf);
+  f.r = f.n = 0;
+  mutex_init(&f.lock);
+     aa5:	83 ec 0c             	sub    $0xc,%esp
+     aa8:	8d 9d 5c ff ff ff    	lea    -0xa4(%ebp),%ebx
+  f.buf = buf;
+     aae:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+  mutex_init(&f.lock);
+     ab4:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  f.flags = IO_WRITE|IO_SETUP;
+     aba:	c7 85 60 ff ff ff 42 	movl   $0x42,-0xa0(%ebp)
+     ac1:	00 00 00 
+  f.size = sizeof(buf);
+     ac4:	c7 85 68 ff ff ff 80 	movl   $0x80,-0x98(%ebp)
+     acb:	00 00 00 
+  f.r = f.n = 0;
+     ace:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+     ad5:	00 00 00 
+     ad8:	c7 85 6c ff ff ff 00 	movl   $0x0,-0x94(%ebp)
+     adf:	00 00 00 
+  mutex_init(&f.lock);
+     ae2:	50                   	push   %eax
+     ae3:	e8 d8 f9 ff ff       	call   4c0 <mutex_init>
+  vfprintf(&f, fmt, (uint*)(void*)&fmt + 1);
+     ae8:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     aeb:	89 f2                	mov    %esi,%edx
+     aed:	89 d8                	mov    %ebx,%eax
+     aef:	e8 dc fd ff ff       	call   8d0 <vfprintf>
+  fflush(&f);
+     af4:	89 1c 24             	mov    %ebx,(%esp)
+     af7:	e8 f4 04 00 00       	call   ff0 <fflush>
+     afc:	83 c4 10             	add    $0x10,%esp
+}
+     aff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b02:	5b                   	pop    %ebx
+     b03:	5e                   	pop    %esi
+     b04:	5d                   	pop    %ebp
+     b05:	c3                   	ret
+     b06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b0d:	8d 76 00             	lea    0x0(%esi),%esi
+    flockfile(&_iob[fd]);
+     b10:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     b13:	83 ec 0c             	sub    $0xc,%esp
+     b16:	8d 98 e0 29 00 00    	lea    0x29e0(%eax),%ebx
+     b1c:	53                   	push   %ebx
+     b1d:	e8 0e 02 00 00       	call   d30 <flockfile>
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     b22:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     b25:	89 f2                	mov    %esi,%edx
+     b27:	89 d8                	mov    %ebx,%eax
+     b29:	e8 a2 fd ff ff       	call   8d0 <vfprintf>
+    funlockfile(&_iob[fd]);
+     b2e:	89 1c 24             	mov    %ebx,(%esp)
+     b31:	e8 2a 02 00 00       	call   d60 <funlockfile>
+     b36:	83 c4 10             	add    $0x10,%esp
+}
+     b39:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b3c:	5b                   	pop    %ebx
+     b3d:	5e                   	pop    %esi
+     b3e:	5d                   	pop    %ebp
+     b3f:	c3                   	ret
+
+00000b40 <setup>:
+}
+
+// Choose how to buffer f on first use: by lines on a device.
+static void
+setup(FILE *f)
+{
+     b40:	55                   	push   %ebp
+     b41:	89 e5                	mov    %esp,%ebp
+     b43:	53                   	push   %ebx
+     b44:	89 c3                	mov    %eax,%ebx
+     b46:	83 ec 2c             	sub    $0x2c,%esp
+  struct stat st;
+
+  f->flags |= IO_SETUP;
+     b49:	83 48 04 40          	orl    $0x40,0x4(%eax)
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     b4d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     b50:	50                   	push   %eax
+     b51:	ff 33                	push   (%ebx)
+     b53:	e8 52 fb ff ff       	call   6aa <fstat>
+     b58:	83 c4 10             	add    $0x10,%esp
+     b5b:	85 c0                	test   %eax,%eax
+    f->flags |= IO_DEV|IO_LINE;
+     b5d:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     b60:	75 07                	jne    b69 <setup+0x29>
+     b62:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+     b67:	74 17                	je     b80 <setup+0x40>
+  if(f->flags & IO_WRITE)
+     b69:	a8 02                	test   $0x2,%al
+     b6b:	74 0a                	je     b77 <setup+0x37>
+    flushhook = flushall;
+     b6d:	c7 05 c0 3a 00 00 a0 	movl   $0xca0,0x3ac0
+     b74:	0c 00 00 
+}
+     b77:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b7a:	c9                   	leave
+     b7b:	c3                   	ret
+     b7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    f->flags |= IO_DEV|IO_LINE;
+     b80:	83 c8 30             	or     $0x30,%eax
+     b83:	89 43 04             	mov    %eax,0x4(%ebx)
+     b86:	eb e1                	jmp    b69 <setup+0x29>
+     b88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b8f:	90                   	nop
+
+00000b90 <flush>:
+static int
+flush(FILE *f)
+{
+  int i, n;
+
+  if(!(f->flags & IO_WRITE))
+     b90:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+     b94:	74 6a                	je     c00 <flush+0x70>
+{
+     b96:	55                   	push   %ebp
+     b97:	89 e5                	mov    %esp,%ebp
+     b99:	56                   	push   %esi
+     b9a:	89 c6                	mov    %eax,%esi
+     b9c:	53                   	push   %ebx
+    return 0;
+  for(i = 0; i < f->n; i += n){
+     b9d:	8b 40 14             	mov    0x14(%eax),%eax
+     ba0:	85 c0                	test   %eax,%eax
+     ba2:	7e 4c                	jle    bf0 <flush+0x60>
+     ba4:	31 db                	xor    %ebx,%ebx
+     ba6:	eb 11                	jmp    bb9 <flush+0x29>
+     ba8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     baf:	90                   	nop
+     bb0:	01 c3                	add    %eax,%ebx
+     bb2:	8b 46 14             	mov    0x14(%esi),%eax
+     bb5:	39 d8                	cmp    %ebx,%eax
+     bb7:	7e 37                	jle    bf0 <flush+0x60>
+    if((n = write(f->fd, f->buf + i, f->n - i)) <= 0){
+     bb9:	83 ec 04             	sub    $0x4,%esp
+     bbc:	29 d8                	sub    %ebx,%eax
+     bbe:	50                   	push   %eax
+     bbf:	8b 46 08             	mov    0x8(%esi),%eax
+     bc2:	01 d8                	add    %ebx,%eax
+     bc4:	50                   	push   %eax
+     bc5:	ff 36                	push   (%esi)
+     bc7:	e8 75 fa ff ff       	call   641 <write>
+     bcc:	83 c4 10             	add    $0x10,%esp
+     bcf:	85 c0                	test   %eax,%eax
+     bd1:	7f dd                	jg     bb0 <flush+0x20>
+      f->flags |= IO_ERR;
+     bd3:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+      f->n = 0;
+     bd7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     bdc:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+      return EOF;
+    }
+  }
+  f->n = 0;
+  return 0;
+}
+     be3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     be6:	5b                   	pop    %ebx
+     be7:	5e                   	pop    %esi
+     be8:	5d                   	pop    %ebp
+     be9:	c3                   	ret
+     bea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->n = 0;
+     bf0:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+}
+     bf7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+     bfa:	31 c0                	xor    %eax,%eax
+}
+     bfc:	5b                   	pop    %ebx
+     bfd:	5e                   	pop    %esi
+     bfe:	5d                   	pop    %ebp
+     bff:	c3                   	ret
+    return 0;
+     c00:	31 c0                	xor    %eax,%eax
+}
+     c02:	c3                   	ret
+     c03:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000c10 <fflush.part.0>:
+fflush(FILE *f)
+     c10:	55                   	push   %ebp
+     c11:	89 e5                	mov    %esp,%ebp
+     c13:	57                   	push   %edi
+     c14:	bf d8 2a 00 00       	mov    $0x2ad8,%edi
+     c19:	56                   	push   %esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     c1a:	31 f6                	xor    %esi,%esi
+fflush(FILE *f)
+     c1c:	53                   	push   %ebx
+     c1d:	bb f8 29 00 00       	mov    $0x29f8,%ebx
+     c22:	83 ec 1c             	sub    $0x1c,%esp
+     c25:	eb 10                	jmp    c37 <fflush.part.0+0x27>
+     c27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c2e:	66 90                	xchg   %ax,%ax
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     c30:	83 c3 1c             	add    $0x1c,%ebx
+     c33:	39 df                	cmp    %ebx,%edi
+     c35:	74 33                	je     c6a <fflush.part.0+0x5a>
+      if((f->flags & IO_WRITE) && fflush(f) < 0)
+     c37:	f6 43 ec 02          	testb  $0x2,-0x14(%ebx)
+     c3b:	74 f3                	je     c30 <fflush.part.0+0x20>
+  if(threaded)
+     c3d:	8b 0d e0 3a 00 00    	mov    0x3ae0,%ecx
+     c43:	85 c9                	test   %ecx,%ecx
+     c45:	75 49                	jne    c90 <fflush.part.0+0x80>
+  r = flush(f);
+     c47:	8d 43 e8             	lea    -0x18(%ebx),%eax
+     c4a:	e8 41 ff ff ff       	call   b90 <flush>
+  if(threaded)
+     c4f:	8b 15 e0 3a 00 00    	mov    0x3ae0,%edx
+     c55:	85 d2                	test   %edx,%edx
+     c57:	75 1f                	jne    c78 <fflush.part.0+0x68>
+        r = EOF;
+     c59:	85 c0                	test   %eax,%eax
+     c5b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     c60:	0f 48 f0             	cmovs  %eax,%esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     c63:	83 c3 1c             	add    $0x1c,%ebx
+     c66:	39 df                	cmp    %ebx,%edi
+     c68:	75 cd                	jne    c37 <fflush.part.0+0x27>
+}
+     c6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c6d:	89 f0                	mov    %esi,%eax
+     c6f:	5b                   	pop    %ebx
+     c70:	5e                   	pop    %esi
+     c71:	5f                   	pop    %edi
+     c72:	5d                   	pop    %ebp
+     c73:	c3                   	ret
+     c74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     c78:	83 ec 0c             	sub    $0xc,%esp
+     c7b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     c7e:	53                   	push   %ebx
+     c7f:	e8 9c f8 ff ff       	call   520 <mutex_unlock>
+     c84:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c87:	83 c4 10             	add    $0x10,%esp
+     c8a:	eb cd                	jmp    c59 <fflush.part.0+0x49>
+     c8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     c90:	83 ec 0c             	sub    $0xc,%esp
+     c93:	53                   	push   %ebx
+     c94:	e8 37 f8 ff ff       	call   4d0 <mutex_lock>
+     c99:	83 c4 10             	add    $0x10,%esp
+     c9c:	eb a9                	jmp    c47 <fflush.part.0+0x37>
+     c9e:	66 90                	xchg   %ax,%ax
+
+00000ca0 <flushall>:
+  if(f == 0){
+     ca0:	e9 6b ff ff ff       	jmp    c10 <fflush.part.0>
+     ca5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000cb0 <fill>:
+
+// Refill f's buffer. Returns the number of bytes read.
+// Caller holds f's lock.
+static int
+fill(FILE *f)
+{
+     cb0:	55                   	push   %ebp
+     cb1:	89 e5                	mov    %esp,%ebp
+     cb3:	53                   	push   %ebx
+     cb4:	89 c3                	mov    %eax,%ebx
+     cb6:	83 ec 04             	sub    $0x4,%esp
+  int n;
+
+  if(!(f->flags & IO_SETUP))
+     cb9:	8b 40 04             	mov    0x4(%eax),%eax
+     cbc:	a8 40                	test   $0x40,%al
+     cbe:	74 50                	je     d10 <fill+0x60>
+    setup(f);
+  if(f->flags & IO_DEV)
+     cc0:	a8 20                	test   $0x20,%al
+     cc2:	75 3c                	jne    d00 <fill+0x50>
+    fflush(0);
+  f->r = 0;
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     cc4:	83 ec 04             	sub    $0x4,%esp
+  f->r = 0;
+     cc7:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     cce:	ff 73 0c             	push   0xc(%ebx)
+     cd1:	ff 73 08             	push   0x8(%ebx)
+     cd4:	ff 33                	push   (%ebx)
+     cd6:	e8 57 f9 ff ff       	call   632 <read>
+     cdb:	83 c4 10             	add    $0x10,%esp
+     cde:	85 c0                	test   %eax,%eax
+     ce0:	7f 10                	jg     cf2 <fill+0x42>
+    f->flags |= n < 0 ? IO_ERR : IO_EOF;
+     ce2:	83 f8 01             	cmp    $0x1,%eax
+     ce5:	19 c0                	sbb    %eax,%eax
+     ce7:	83 e0 fc             	and    $0xfffffffc,%eax
+     cea:	83 c0 08             	add    $0x8,%eax
+     ced:	09 43 04             	or     %eax,0x4(%ebx)
+    n = 0;
+     cf0:	31 c0                	xor    %eax,%eax
+  }
+  f->n = n;
+     cf2:	89 43 14             	mov    %eax,0x14(%ebx)
+  return n;
+}
+     cf5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     cf8:	c9                   	leave
+     cf9:	c3                   	ret
+     cfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == 0){
+     d00:	e8 0b ff ff ff       	call   c10 <fflush.part.0>
+     d05:	eb bd                	jmp    cc4 <fill+0x14>
+     d07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d0e:	66 90                	xchg   %ax,%ax
+    setup(f);
+     d10:	89 d8                	mov    %ebx,%eax
+     d12:	e8 29 fe ff ff       	call   b40 <setup>
+  if(f->flags & IO_DEV)
+     d17:	8b 43 04             	mov    0x4(%ebx),%eax
+     d1a:	eb a4                	jmp    cc0 <fill+0x10>
+     d1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000d20 <stdio_threaded>:
+  threaded = 1;
+     d20:	c7 05 e0 3a 00 00 01 	movl   $0x1,0x3ae0
+     d27:	00 00 00 
+}
+     d2a:	c3                   	ret
+     d2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d2f:	90                   	nop
+
+00000d30 <flockfile>:
+{
+     d30:	55                   	push   %ebp
+  if(threaded)
+     d31:	8b 15 e0 3a 00 00    	mov    0x3ae0,%edx
+{
+     d37:	89 e5                	mov    %esp,%ebp
+     d39:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     d3c:	85 d2                	test   %edx,%edx
+     d3e:	75 08                	jne    d48 <flockfile+0x18>
+}
+     d40:	5d                   	pop    %ebp
+     d41:	c3                   	ret
+     d42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_lock(&f->lock);
+     d48:	83 c0 18             	add    $0x18,%eax
+     d4b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     d4e:	5d                   	pop    %ebp
+    mutex_lock(&f->lock);
+     d4f:	e9 7c f7 ff ff       	jmp    4d0 <mutex_lock>
+     d54:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d5f:	90                   	nop
+
+00000d60 <funlockfile>:
+{
+     d60:	55                   	push   %ebp
+  if(threaded)
+     d61:	8b 15 e0 3a 00 00    	mov    0x3ae0,%edx
+{
+     d67:	89 e5                	mov    %esp,%ebp
+     d69:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     d6c:	85 d2                	test   %edx,%edx
+     d6e:	75 08                	jne    d78 <funlockfile+0x18>
+}
+     d70:	5d                   	pop    %ebp
+     d71:	c3                   	ret
+     d72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&f->lock);
+     d78:	83 c0 18             	add    $0x18,%eax
+     d7b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     d7e:	5d                   	pop    %ebp
+    mutex_unlock(&f->lock);
+     d7f:	e9 9c f7 ff ff       	jmp    520 <mutex_unlock>
+     d84:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d8f:	90                   	nop
+
+00000d90 <fopen>:
+{
+     d90:	55                   	push   %ebp
+     d91:	89 e5                	mov    %esp,%ebp
+     d93:	57                   	push   %edi
+     d94:	56                   	push   %esi
+     d95:	53                   	push   %ebx
+     d96:	83 ec 34             	sub    $0x34,%esp
+     d99:	8b 75 0c             	mov    0xc(%ebp),%esi
+     d9c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(strcmp(mode, "r") != 0 && strcmp(mode, "w") != 0)
+     d9f:	68 2d 20 00 00       	push   $0x202d
+     da4:	56                   	push   %esi
+     da5:	e8 66 f5 ff ff       	call   310 <strcmp>
+     daa:	83 c4 10             	add    $0x10,%esp
+     dad:	85 c0                	test   %eax,%eax
+     daf:	74 15                	je     dc6 <fopen+0x36>
+     db1:	83 ec 08             	sub    $0x8,%esp
+     db4:	68 2f 20 00 00       	push   $0x202f
+     db9:	56                   	push   %esi
+     dba:	e8 51 f5 ff ff       	call   310 <strcmp>
+     dbf:	83 c4 10             	add    $0x10,%esp
+     dc2:	85 c0                	test   %eax,%eax
+     dc4:	75 2c                	jne    df2 <fopen+0x62>
+  if(threaded)
+     dc6:	a1 e0 3a 00 00       	mov    0x3ae0,%eax
+     dcb:	85 c0                	test   %eax,%eax
+     dcd:	0f 85 ed 00 00 00    	jne    ec0 <fopen+0x130>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     dd3:	bb 34 2a 00 00       	mov    $0x2a34,%ebx
+    if(f->flags == 0)
+     dd8:	8b 53 04             	mov    0x4(%ebx),%edx
+     ddb:	85 d2                	test   %edx,%edx
+     ddd:	74 21                	je     e00 <fopen+0x70>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     ddf:	83 c3 1c             	add    $0x1c,%ebx
+     de2:	81 fb c0 2a 00 00    	cmp    $0x2ac0,%ebx
+     de8:	75 ee                	jne    dd8 <fopen+0x48>
+  if(threaded)
+     dea:	85 c0                	test   %eax,%eax
+     dec:	0f 85 36 01 00 00    	jne    f28 <fopen+0x198>
+    return 0;
+     df2:	31 db                	xor    %ebx,%ebx
+     df4:	e9 96 00 00 00       	jmp    e8f <fopen+0xff>
+     df9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f == &_iob[NSTREAM])
+     e00:	81 fb c0 2a 00 00    	cmp    $0x2ac0,%ebx
+     e06:	74 e2                	je     dea <fopen+0x5a>
+    f->flags = IO_MALLOC;
+     e08:	c7 43 04 80 00 00 00 	movl   $0x80,0x4(%ebx)
+  if(threaded)
+     e0f:	85 c0                	test   %eax,%eax
+     e11:	0f 85 f9 00 00 00    	jne    f10 <fopen+0x180>
+  if(mode[0] == 'r'){
+     e17:	80 3e 72             	cmpb   $0x72,(%esi)
+     e1a:	0f 84 c0 00 00 00    	je     ee0 <fopen+0x150>
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     e20:	83 ec 08             	sub    $0x8,%esp
+     e23:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     e26:	50                   	push   %eax
+     e27:	57                   	push   %edi
+     e28:	e8 d3 f5 ff ff       	call   400 <stat>
+     e2d:	83 c4 10             	add    $0x10,%esp
+     e30:	85 c0                	test   %eax,%eax
+     e32:	74 6c                	je     ea0 <fopen+0x110>
+    fd = open(path, O_CREATE|O_WRONLY);
+     e34:	83 ec 08             	sub    $0x8,%esp
+     e37:	68 01 02 00 00       	push   $0x201
+     e3c:	57                   	push   %edi
+    flags = IO_WRITE;
+     e3d:	bf 02 00 00 00       	mov    $0x2,%edi
+    fd = open(path, O_CREATE|O_WRONLY);
+     e42:	e8 36 f8 ff ff       	call   67d <open>
+     e47:	83 c4 10             	add    $0x10,%esp
+     e4a:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     e4c:	85 f6                	test   %esi,%esi
+     e4e:	0f 88 a9 00 00 00    	js     efd <fopen+0x16d>
+     e54:	83 ec 0c             	sub    $0xc,%esp
+     e57:	68 00 02 00 00       	push   $0x200
+     e5c:	e8 af 0c 00 00       	call   1b10 <malloc>
+     e61:	83 c4 10             	add    $0x10,%esp
+     e64:	89 43 08             	mov    %eax,0x8(%ebx)
+     e67:	85 c0                	test   %eax,%eax
+     e69:	0f 84 d0 00 00 00    	je     f3f <fopen+0x1af>
+  f->flags = flags|IO_MALLOC;
+     e6f:	81 cf 80 00 00 00    	or     $0x80,%edi
+  f->fd = fd;
+     e75:	89 33                	mov    %esi,(%ebx)
+  f->size = BUFSIZ;
+     e77:	c7 43 0c 00 02 00 00 	movl   $0x200,0xc(%ebx)
+  f->r = f->n = 0;
+     e7e:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+     e85:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  f->flags = flags|IO_MALLOC;
+     e8c:	89 7b 04             	mov    %edi,0x4(%ebx)
+}
+     e8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e92:	89 d8                	mov    %ebx,%eax
+     e94:	5b                   	pop    %ebx
+     e95:	5e                   	pop    %esi
+     e96:	5f                   	pop    %edi
+     e97:	5d                   	pop    %ebp
+     e98:	c3                   	ret
+     e99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     ea0:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+     ea5:	75 8d                	jne    e34 <fopen+0xa4>
+      unlink(path);
+     ea7:	83 ec 0c             	sub    $0xc,%esp
+     eaa:	57                   	push   %edi
+     eab:	e8 eb f7 ff ff       	call   69b <unlink>
+     eb0:	83 c4 10             	add    $0x10,%esp
+     eb3:	e9 7c ff ff ff       	jmp    e34 <fopen+0xa4>
+     eb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ebf:	90                   	nop
+    mutex_lock(&iolock);
+     ec0:	83 ec 0c             	sub    $0xc,%esp
+     ec3:	68 e4 3a 00 00       	push   $0x3ae4
+     ec8:	e8 03 f6 ff ff       	call   4d0 <mutex_lock>
+  if(threaded)
+     ecd:	a1 e0 3a 00 00       	mov    0x3ae0,%eax
+     ed2:	83 c4 10             	add    $0x10,%esp
+     ed5:	e9 f9 fe ff ff       	jmp    dd3 <fopen+0x43>
+     eda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    fd = open(path, O_RDONLY);
+     ee0:	83 ec 08             	sub    $0x8,%esp
+     ee3:	6a 00                	push   $0x0
+     ee5:	57                   	push   %edi
+    flags = IO_READ;
+     ee6:	bf 01 00 00 00       	mov    $0x1,%edi
+    fd = open(path, O_RDONLY);
+     eeb:	e8 8d f7 ff ff       	call   67d <open>
+     ef0:	83 c4 10             	add    $0x10,%esp
+     ef3:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     ef5:	85 f6                	test   %esi,%esi
+     ef7:	0f 89 57 ff ff ff    	jns    e54 <fopen+0xc4>
+    f->flags = 0;
+     efd:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    return 0;
+     f04:	31 db                	xor    %ebx,%ebx
+     f06:	eb 87                	jmp    e8f <fopen+0xff>
+     f08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f0f:	90                   	nop
+    mutex_unlock(&iolock);
+     f10:	83 ec 0c             	sub    $0xc,%esp
+     f13:	68 e4 3a 00 00       	push   $0x3ae4
+     f18:	e8 03 f6 ff ff       	call   520 <mutex_unlock>
+     f1d:	83 c4 10             	add    $0x10,%esp
+     f20:	e9 f2 fe ff ff       	jmp    e17 <fopen+0x87>
+     f25:	8d 76 00             	lea    0x0(%esi),%esi
+     f28:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+     f2b:	31 db                	xor    %ebx,%ebx
+    mutex_unlock(&iolock);
+     f2d:	68 e4 3a 00 00       	push   $0x3ae4
+     f32:	e8 e9 f5 ff ff       	call   520 <mutex_unlock>
+     f37:	83 c4 10             	add    $0x10,%esp
+     f3a:	e9 50 ff ff ff       	jmp    e8f <fopen+0xff>
+      close(fd);
+     f3f:	83 ec 0c             	sub    $0xc,%esp
+     f42:	56                   	push   %esi
+     f43:	e8 08 f7 ff ff       	call   650 <close>
+     f48:	83 c4 10             	add    $0x10,%esp
+     f4b:	eb b0                	jmp    efd <fopen+0x16d>
+     f4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f50 <fclose>:
+{
+     f50:	55                   	push   %ebp
+     f51:	89 e5                	mov    %esp,%ebp
+     f53:	56                   	push   %esi
+     f54:	53                   	push   %ebx
+  if(threaded)
+     f55:	8b 15 e0 3a 00 00    	mov    0x3ae0,%edx
+{
+     f5b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+     f5e:	85 d2                	test   %edx,%edx
+     f60:	75 46                	jne    fa8 <fclose+0x58>
+  r = flush(f);
+     f62:	89 d8                	mov    %ebx,%eax
+     f64:	e8 27 fc ff ff       	call   b90 <flush>
+  if(close(f->fd) < 0)
+     f69:	83 ec 0c             	sub    $0xc,%esp
+     f6c:	ff 33                	push   (%ebx)
+  r = flush(f);
+     f6e:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+     f70:	e8 db f6 ff ff       	call   650 <close>
+     f75:	83 c4 10             	add    $0x10,%esp
+    r = EOF;
+     f78:	85 c0                	test   %eax,%eax
+     f7a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     f7f:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->flags & IO_MALLOC)
+     f82:	f6 43 04 80          	testb  $0x80,0x4(%ebx)
+     f86:	75 58                	jne    fe0 <fclose+0x90>
+  if(threaded)
+     f88:	a1 e0 3a 00 00       	mov    0x3ae0,%eax
+  f->flags = 0;
+     f8d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  if(threaded)
+     f94:	85 c0                	test   %eax,%eax
+     f96:	75 28                	jne    fc0 <fclose+0x70>
+}
+     f98:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f9b:	89 f0                	mov    %esi,%eax
+     f9d:	5b                   	pop    %ebx
+     f9e:	5e                   	pop    %esi
+     f9f:	5d                   	pop    %ebp
+     fa0:	c3                   	ret
+     fa1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     fa8:	83 ec 0c             	sub    $0xc,%esp
+     fab:	8d 43 18             	lea    0x18(%ebx),%eax
+     fae:	50                   	push   %eax
+     faf:	e8 1c f5 ff ff       	call   4d0 <mutex_lock>
+     fb4:	83 c4 10             	add    $0x10,%esp
+     fb7:	eb a9                	jmp    f62 <fclose+0x12>
+     fb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     fc0:	83 ec 0c             	sub    $0xc,%esp
+     fc3:	83 c3 18             	add    $0x18,%ebx
+     fc6:	53                   	push   %ebx
+     fc7:	e8 54 f5 ff ff       	call   520 <mutex_unlock>
+     fcc:	83 c4 10             	add    $0x10,%esp
+}
+     fcf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     fd2:	89 f0                	mov    %esi,%eax
+     fd4:	5b                   	pop    %ebx
+     fd5:	5e                   	pop    %esi
+     fd6:	5d                   	pop    %ebp
+     fd7:	c3                   	ret
+     fd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fdf:	90                   	nop
+    free(f->buf);
+     fe0:	83 ec 0c             	sub    $0xc,%esp
+     fe3:	ff 73 08             	push   0x8(%ebx)
+     fe6:	e8 f5 09 00 00       	call   19e0 <free>
+     feb:	83 c4 10             	add    $0x10,%esp
+     fee:	eb 98                	jmp    f88 <fclose+0x38>
+
+00000ff0 <fflush>:
+{
+     ff0:	55                   	push   %ebp
+     ff1:	89 e5                	mov    %esp,%ebp
+     ff3:	53                   	push   %ebx
+     ff4:	83 ec 14             	sub    $0x14,%esp
+     ff7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f == 0){
+     ffa:	85 db                	test   %ebx,%ebx
+     ffc:	74 5a                	je     1058 <fflush+0x68>
+  if(threaded)
+     ffe:	8b 0d e0 3a 00 00    	mov    0x3ae0,%ecx
+    1004:	85 c9                	test   %ecx,%ecx
+    1006:	75 18                	jne    1020 <fflush+0x30>
+  r = flush(f);
+    1008:	89 d8                	mov    %ebx,%eax
+    100a:	e8 81 fb ff ff       	call   b90 <flush>
+  if(threaded)
+    100f:	8b 15 e0 3a 00 00    	mov    0x3ae0,%edx
+    1015:	85 d2                	test   %edx,%edx
+    1017:	75 1f                	jne    1038 <fflush+0x48>
+}
+    1019:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    101c:	c9                   	leave
+    101d:	c3                   	ret
+    101e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    1020:	83 ec 0c             	sub    $0xc,%esp
+    1023:	8d 43 18             	lea    0x18(%ebx),%eax
+    1026:	50                   	push   %eax
+    1027:	e8 a4 f4 ff ff       	call   4d0 <mutex_lock>
+    102c:	83 c4 10             	add    $0x10,%esp
+    102f:	eb d7                	jmp    1008 <fflush+0x18>
+    1031:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1038:	83 ec 0c             	sub    $0xc,%esp
+    103b:	83 c3 18             	add    $0x18,%ebx
+    103e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1041:	53                   	push   %ebx
+    1042:	e8 d9 f4 ff ff       	call   520 <mutex_unlock>
+    1047:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    104a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    mutex_unlock(&f->lock);
+    104d:	83 c4 10             	add    $0x10,%esp
+}
+    1050:	c9                   	leave
+    1051:	c3                   	ret
+    1052:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1058:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    105b:	c9                   	leave
+    105c:	e9 af fb ff ff       	jmp    c10 <fflush.part.0>
+    1061:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1068:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    106f:	90                   	nop
+
+00001070 <putc_unlocked>:
+{
+    1070:	55                   	push   %ebp
+    1071:	89 e5                	mov    %esp,%ebp
+    1073:	56                   	push   %esi
+    1074:	53                   	push   %ebx
+    1075:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    1078:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(!(f->flags & IO_WRITE))
+    107b:	8b 43 04             	mov    0x4(%ebx),%eax
+    107e:	a8 02                	test   $0x2,%al
+    1080:	74 46                	je     10c8 <putc_unlocked+0x58>
+  if(!(f->flags & IO_SETUP))
+    1082:	a8 40                	test   $0x40,%al
+    1084:	74 4a                	je     10d0 <putc_unlocked+0x60>
+  if(f->n == f->size && flush(f) < 0)
+    1086:	8b 43 14             	mov    0x14(%ebx),%eax
+    1089:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    108c:	74 51                	je     10df <putc_unlocked+0x6f>
+  f->buf[f->n++] = c;
+    108e:	8d 48 01             	lea    0x1(%eax),%ecx
+    1091:	8b 53 08             	mov    0x8(%ebx),%edx
+    1094:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    1097:	89 f1                	mov    %esi,%ecx
+    1099:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    109c:	83 fe 0a             	cmp    $0xa,%esi
+    109f:	74 0f                	je     10b0 <putc_unlocked+0x40>
+  return c & 0xff;
+    10a1:	89 f0                	mov    %esi,%eax
+    10a3:	0f b6 c0             	movzbl %al,%eax
+}
+    10a6:	5b                   	pop    %ebx
+    10a7:	5e                   	pop    %esi
+    10a8:	5d                   	pop    %ebp
+    10a9:	c3                   	ret
+    10aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    10b0:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    10b4:	74 eb                	je     10a1 <putc_unlocked+0x31>
+    10b6:	89 d8                	mov    %ebx,%eax
+    10b8:	e8 d3 fa ff ff       	call   b90 <flush>
+    10bd:	85 c0                	test   %eax,%eax
+    10bf:	79 e0                	jns    10a1 <putc_unlocked+0x31>
+    10c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return EOF;
+    10c8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    10cd:	eb d7                	jmp    10a6 <putc_unlocked+0x36>
+    10cf:	90                   	nop
+    setup(f);
+    10d0:	89 d8                	mov    %ebx,%eax
+    10d2:	e8 69 fa ff ff       	call   b40 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    10d7:	8b 43 14             	mov    0x14(%ebx),%eax
+    10da:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    10dd:	75 af                	jne    108e <putc_unlocked+0x1e>
+    10df:	89 d8                	mov    %ebx,%eax
+    10e1:	e8 aa fa ff ff       	call   b90 <flush>
+    10e6:	85 c0                	test   %eax,%eax
+    10e8:	78 de                	js     10c8 <putc_unlocked+0x58>
+  f->buf[f->n++] = c;
+    10ea:	8b 43 14             	mov    0x14(%ebx),%eax
+    10ed:	eb 9f                	jmp    108e <putc_unlocked+0x1e>
+    10ef:	90                   	nop
+
+000010f0 <fputc>:
+{
+    10f0:	55                   	push   %ebp
+    10f1:	89 e5                	mov    %esp,%ebp
+    10f3:	56                   	push   %esi
+    10f4:	53                   	push   %ebx
+  if(threaded)
+    10f5:	8b 15 e0 3a 00 00    	mov    0x3ae0,%edx
+{
+    10fb:	8b 75 08             	mov    0x8(%ebp),%esi
+    10fe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(threaded)
+    1101:	85 d2                	test   %edx,%edx
+    1103:	75 6b                	jne    1170 <fputc+0x80>
+  if(!(f->flags & IO_WRITE))
+    1105:	8b 43 04             	mov    0x4(%ebx),%eax
+    1108:	a8 02                	test   $0x2,%al
+    110a:	0f 84 b8 00 00 00    	je     11c8 <fputc+0xd8>
+  if(!(f->flags & IO_SETUP))
+    1110:	a8 40                	test   $0x40,%al
+    1112:	74 76                	je     118a <fputc+0x9a>
+  if(f->n == f->size && flush(f) < 0)
+    1114:	8b 43 14             	mov    0x14(%ebx),%eax
+    1117:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    111a:	74 7d                	je     1199 <fputc+0xa9>
+  f->buf[f->n++] = c;
+    111c:	8d 48 01             	lea    0x1(%eax),%ecx
+    111f:	8b 53 08             	mov    0x8(%ebx),%edx
+    1122:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    1125:	89 f1                	mov    %esi,%ecx
+    1127:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    112a:	83 fe 0a             	cmp    $0xa,%esi
+    112d:	74 21                	je     1150 <fputc+0x60>
+  return c & 0xff;
+    112f:	89 f0                	mov    %esi,%eax
+    1131:	0f b6 f0             	movzbl %al,%esi
+  if(threaded)
+    1134:	a1 e0 3a 00 00       	mov    0x3ae0,%eax
+    1139:	85 c0                	test   %eax,%eax
+    113b:	75 73                	jne    11b0 <fputc+0xc0>
+}
+    113d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1140:	89 f0                	mov    %esi,%eax
+    1142:	5b                   	pop    %ebx
+    1143:	5e                   	pop    %esi
+    1144:	5d                   	pop    %ebp
+    1145:	c3                   	ret
+    1146:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    114d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    1150:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1154:	74 d9                	je     112f <fputc+0x3f>
+    1156:	89 d8                	mov    %ebx,%eax
+    1158:	e8 33 fa ff ff       	call   b90 <flush>
+    115d:	85 c0                	test   %eax,%eax
+    115f:	79 ce                	jns    112f <fputc+0x3f>
+    return EOF;
+    1161:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1166:	eb cc                	jmp    1134 <fputc+0x44>
+    1168:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    116f:	90                   	nop
+    mutex_lock(&f->lock);
+    1170:	83 ec 0c             	sub    $0xc,%esp
+    1173:	8d 43 18             	lea    0x18(%ebx),%eax
+    1176:	50                   	push   %eax
+    1177:	e8 54 f3 ff ff       	call   4d0 <mutex_lock>
+  if(!(f->flags & IO_WRITE))
+    117c:	8b 43 04             	mov    0x4(%ebx),%eax
+    117f:	83 c4 10             	add    $0x10,%esp
+    1182:	a8 02                	test   $0x2,%al
+    1184:	74 db                	je     1161 <fputc+0x71>
+  if(!(f->flags & IO_SETUP))
+    1186:	a8 40                	test   $0x40,%al
+    1188:	75 8a                	jne    1114 <fputc+0x24>
+    setup(f);
+    118a:	89 d8                	mov    %ebx,%eax
+    118c:	e8 af f9 ff ff       	call   b40 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    1191:	8b 43 14             	mov    0x14(%ebx),%eax
+    1194:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    1197:	75 83                	jne    111c <fputc+0x2c>
+    1199:	89 d8                	mov    %ebx,%eax
+    119b:	e8 f0 f9 ff ff       	call   b90 <flush>
+    11a0:	85 c0                	test   %eax,%eax
+    11a2:	78 bd                	js     1161 <fputc+0x71>
+  f->buf[f->n++] = c;
+    11a4:	8b 43 14             	mov    0x14(%ebx),%eax
+    11a7:	e9 70 ff ff ff       	jmp    111c <fputc+0x2c>
+    11ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    11b0:	83 ec 0c             	sub    $0xc,%esp
+    11b3:	83 c3 18             	add    $0x18,%ebx
+    11b6:	53                   	push   %ebx
+    11b7:	e8 64 f3 ff ff       	call   520 <mutex_unlock>
+    11bc:	83 c4 10             	add    $0x10,%esp
+}
+    11bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    11c2:	89 f0                	mov    %esi,%eax
+    11c4:	5b                   	pop    %ebx
+    11c5:	5e                   	pop    %esi
+    11c6:	5d                   	pop    %ebp
+    11c7:	c3                   	ret
+    return EOF;
+    11c8:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    11cd:	e9 6b ff ff ff       	jmp    113d <fputc+0x4d>
+    11d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000011e0 <fwrite>:
+{
+    11e0:	55                   	push   %ebp
+    11e1:	89 e5                	mov    %esp,%ebp
+    11e3:	57                   	push   %edi
+    11e4:	56                   	push   %esi
+    11e5:	53                   	push   %ebx
+    11e6:	83 ec 1c             	sub    $0x1c,%esp
+    11e9:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  if(!(f->flags & IO_WRITE) || size <= 0)
+    11ec:	8b 43 04             	mov    0x4(%ebx),%eax
+    11ef:	a8 02                	test   $0x2,%al
+    11f1:	0f 84 ec 00 00 00    	je     12e3 <fwrite+0x103>
+    11f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    11fa:	85 c9                	test   %ecx,%ecx
+    11fc:	0f 8e e1 00 00 00    	jle    12e3 <fwrite+0x103>
+  if(threaded)
+    1202:	8b 15 e0 3a 00 00    	mov    0x3ae0,%edx
+    1208:	85 d2                	test   %edx,%edx
+    120a:	0f 85 1c 01 00 00    	jne    132c <fwrite+0x14c>
+  if(!(f->flags & IO_SETUP))
+    1210:	a8 40                	test   $0x40,%al
+    1212:	0f 84 08 01 00 00    	je     1320 <fwrite+0x140>
+  for(len = size*nmemb; len > 0; len -= n){
+    1218:	8b 45 0c             	mov    0xc(%ebp),%eax
+    121b:	0f af 45 10          	imul   0x10(%ebp),%eax
+    121f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    1222:	85 c0                	test   %eax,%eax
+    1224:	0f 8e 2a 01 00 00    	jle    1354 <fwrite+0x174>
+  s = p;
+    122a:	8b 45 08             	mov    0x8(%ebp),%eax
+  nl = 0;
+    122d:	31 ff                	xor    %edi,%edi
+    122f:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+        nl = 1;
+    1232:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  s = p;
+    1235:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1238:	8b 43 14             	mov    0x14(%ebx),%eax
+        nl = 1;
+    123b:	89 ce                	mov    %ecx,%esi
+    if(f->n == f->size && flush(f) < 0)
+    123d:	89 c2                	mov    %eax,%edx
+    123f:	39 f0                	cmp    %esi,%eax
+    1241:	74 6e                	je     12b1 <fwrite+0xd1>
+    1243:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1247:	90                   	nop
+    if(n > len)
+    1248:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    n = f->size - f->n;
+    124b:	89 f1                	mov    %esi,%ecx
+    124d:	29 c1                	sub    %eax,%ecx
+    124f:	39 f9                	cmp    %edi,%ecx
+    1251:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1254:	85 c9                	test   %ecx,%ecx
+    1256:	0f 8e 7c 00 00 00    	jle    12d8 <fwrite+0xf8>
+    125c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    125f:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1262:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    1265:	8d 34 08             	lea    (%eax,%ecx,1),%esi
+    1268:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    126b:	eb 06                	jmp    1273 <fwrite+0x93>
+    126d:	8d 76 00             	lea    0x0(%esi),%esi
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1270:	8b 53 14             	mov    0x14(%ebx),%edx
+    1273:	8d 4a 01             	lea    0x1(%edx),%ecx
+    1276:	8b 73 08             	mov    0x8(%ebx),%esi
+    1279:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    127c:	0f b6 08             	movzbl (%eax),%ecx
+        nl = 1;
+    127f:	80 f9 0a             	cmp    $0xa,%cl
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1282:	88 0c 16             	mov    %cl,(%esi,%edx,1)
+        nl = 1;
+    1285:	be 01 00 00 00       	mov    $0x1,%esi
+    128a:	0f 44 fe             	cmove  %esi,%edi
+    for(i = 0; i < n; i++)
+    128d:	83 c0 01             	add    $0x1,%eax
+    1290:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    1293:	75 db                	jne    1270 <fwrite+0x90>
+    s += n;
+    1295:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1298:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    129b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    s += n;
+    129e:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    12a1:	85 c0                	test   %eax,%eax
+    12a3:	7e 48                	jle    12ed <fwrite+0x10d>
+    12a5:	8b 43 14             	mov    0x14(%ebx),%eax
+    12a8:	8b 73 0c             	mov    0xc(%ebx),%esi
+    if(f->n == f->size && flush(f) < 0)
+    12ab:	89 c2                	mov    %eax,%edx
+    12ad:	39 f0                	cmp    %esi,%eax
+    12af:	75 97                	jne    1248 <fwrite+0x68>
+    12b1:	89 d8                	mov    %ebx,%eax
+    12b3:	e8 d8 f8 ff ff       	call   b90 <flush>
+    12b8:	85 c0                	test   %eax,%eax
+    12ba:	78 31                	js     12ed <fwrite+0x10d>
+    n = f->size - f->n;
+    12bc:	8b 73 0c             	mov    0xc(%ebx),%esi
+    12bf:	8b 43 14             	mov    0x14(%ebx),%eax
+    12c2:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    12c5:	89 f1                	mov    %esi,%ecx
+    12c7:	89 c2                	mov    %eax,%edx
+    12c9:	29 c1                	sub    %eax,%ecx
+    12cb:	39 f9                	cmp    %edi,%ecx
+    12cd:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    12d0:	85 c9                	test   %ecx,%ecx
+    12d2:	7f 88                	jg     125c <fwrite+0x7c>
+    12d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    s += n;
+    12d8:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    12db:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    12de:	e9 5a ff ff ff       	jmp    123d <fwrite+0x5d>
+}
+    12e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    12e6:	31 c0                	xor    %eax,%eax
+}
+    12e8:	5b                   	pop    %ebx
+    12e9:	5e                   	pop    %esi
+    12ea:	5f                   	pop    %edi
+    12eb:	5d                   	pop    %ebp
+    12ec:	c3                   	ret
+  if(nl && (f->flags & IO_LINE))
+    12ed:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    12f0:	85 ff                	test   %edi,%edi
+    12f2:	74 06                	je     12fa <fwrite+0x11a>
+    12f4:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    12f8:	75 1d                	jne    1317 <fwrite+0x137>
+  return (s - (const char*)p) / size;
+    12fa:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    12fd:	2b 75 08             	sub    0x8(%ebp),%esi
+  if(threaded)
+    1300:	a1 e0 3a 00 00       	mov    0x3ae0,%eax
+    1305:	85 c0                	test   %eax,%eax
+    1307:	75 3a                	jne    1343 <fwrite+0x163>
+  return (s - (const char*)p) / size;
+    1309:	89 f0                	mov    %esi,%eax
+    130b:	99                   	cltd
+    130c:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    130f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1312:	5b                   	pop    %ebx
+    1313:	5e                   	pop    %esi
+    1314:	5f                   	pop    %edi
+    1315:	5d                   	pop    %ebp
+    1316:	c3                   	ret
+    flush(f);
+    1317:	89 d8                	mov    %ebx,%eax
+    1319:	e8 72 f8 ff ff       	call   b90 <flush>
+    131e:	eb da                	jmp    12fa <fwrite+0x11a>
+    setup(f);
+    1320:	89 d8                	mov    %ebx,%eax
+    1322:	e8 19 f8 ff ff       	call   b40 <setup>
+    1327:	e9 ec fe ff ff       	jmp    1218 <fwrite+0x38>
+    mutex_lock(&f->lock);
+    132c:	83 ec 0c             	sub    $0xc,%esp
+    132f:	8d 43 18             	lea    0x18(%ebx),%eax
+    1332:	50                   	push   %eax
+    1333:	e8 98 f1 ff ff       	call   4d0 <mutex_lock>
+  if(!(f->flags & IO_SETUP))
+    1338:	8b 43 04             	mov    0x4(%ebx),%eax
+    133b:	83 c4 10             	add    $0x10,%esp
+    133e:	e9 cd fe ff ff       	jmp    1210 <fwrite+0x30>
+    mutex_unlock(&f->lock);
+    1343:	83 ec 0c             	sub    $0xc,%esp
+    1346:	83 c3 18             	add    $0x18,%ebx
+    1349:	53                   	push   %ebx
+    134a:	e8 d1 f1 ff ff       	call   520 <mutex_unlock>
+    134f:	83 c4 10             	add    $0x10,%esp
+    1352:	eb b5                	jmp    1309 <fwrite+0x129>
+  for(len = size*nmemb; len > 0; len -= n){
+    1354:	31 f6                	xor    %esi,%esi
+    1356:	eb a8                	jmp    1300 <fwrite+0x120>
+    1358:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    135f:	90                   	nop
+
+00001360 <fgetc>:
+  return f->buf[f->r++] & 0xff;
+}
+
+int
+fgetc(FILE *f)
+{
+    1360:	55                   	push   %ebp
+    1361:	89 e5                	mov    %esp,%ebp
+    1363:	56                   	push   %esi
+    1364:	53                   	push   %ebx
+  if(threaded)
+    1365:	8b 15 e0 3a 00 00    	mov    0x3ae0,%edx
+{
+    136b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    136e:	85 d2                	test   %edx,%edx
+    1370:	75 2e                	jne    13a0 <fgetc+0x40>
+  if(!(f->flags & IO_READ))
+    1372:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1376:	74 78                	je     13f0 <fgetc+0x90>
+  if(f->r == f->n && fill(f) == 0)
+    1378:	8b 43 10             	mov    0x10(%ebx),%eax
+    137b:	3b 43 14             	cmp    0x14(%ebx),%eax
+    137e:	74 60                	je     13e0 <fgetc+0x80>
+  return f->buf[f->r++] & 0xff;
+    1380:	8b 53 08             	mov    0x8(%ebx),%edx
+    1383:	8d 48 01             	lea    0x1(%eax),%ecx
+    1386:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1389:	0f b6 34 02          	movzbl (%edx,%eax,1),%esi
+  if(threaded)
+    138d:	a1 e0 3a 00 00       	mov    0x3ae0,%eax
+    1392:	85 c0                	test   %eax,%eax
+    1394:	75 2a                	jne    13c0 <fgetc+0x60>
+
+  flockfile(f);
+  c = getc_unlocked(f);
+  funlockfile(f);
+  return c;
+}
+    1396:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1399:	89 f0                	mov    %esi,%eax
+    139b:	5b                   	pop    %ebx
+    139c:	5e                   	pop    %esi
+    139d:	5d                   	pop    %ebp
+    139e:	c3                   	ret
+    139f:	90                   	nop
+    mutex_lock(&f->lock);
+    13a0:	83 ec 0c             	sub    $0xc,%esp
+    13a3:	8d 43 18             	lea    0x18(%ebx),%eax
+    13a6:	50                   	push   %eax
+    13a7:	e8 24 f1 ff ff       	call   4d0 <mutex_lock>
+  if(!(f->flags & IO_READ))
+    13ac:	83 c4 10             	add    $0x10,%esp
+    13af:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    13b3:	75 c3                	jne    1378 <fgetc+0x18>
+    return EOF;
+    13b5:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    13ba:	eb d1                	jmp    138d <fgetc+0x2d>
+    13bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    13c0:	83 ec 0c             	sub    $0xc,%esp
+    13c3:	83 c3 18             	add    $0x18,%ebx
+    13c6:	53                   	push   %ebx
+    13c7:	e8 54 f1 ff ff       	call   520 <mutex_unlock>
+    13cc:	83 c4 10             	add    $0x10,%esp
+}
+    13cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    13d2:	89 f0                	mov    %esi,%eax
+    13d4:	5b                   	pop    %ebx
+    13d5:	5e                   	pop    %esi
+    13d6:	5d                   	pop    %ebp
+    13d7:	c3                   	ret
+    13d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13df:	90                   	nop
+  if(f->r == f->n && fill(f) == 0)
+    13e0:	89 d8                	mov    %ebx,%eax
+    13e2:	e8 c9 f8 ff ff       	call   cb0 <fill>
+    13e7:	85 c0                	test   %eax,%eax
+    13e9:	74 ca                	je     13b5 <fgetc+0x55>
+  return f->buf[f->r++] & 0xff;
+    13eb:	8b 43 10             	mov    0x10(%ebx),%eax
+    13ee:	eb 90                	jmp    1380 <fgetc+0x20>
+    return EOF;
+    13f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    13f5:	eb 9f                	jmp    1396 <fgetc+0x36>
+    13f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13fe:	66 90                	xchg   %ax,%ax
+
+00001400 <fread>:
+
+int
+fread(void *p, int size, int nmemb, FILE *f)
+{
+    1400:	55                   	push   %ebp
+    1401:	89 e5                	mov    %esp,%ebp
+    1403:	57                   	push   %edi
+    1404:	56                   	push   %esi
+    1405:	53                   	push   %ebx
+    1406:	83 ec 1c             	sub    $0x1c,%esp
+    1409:	8b 75 14             	mov    0x14(%ebp),%esi
+  char *d;
+  int n, len;
+
+  if(!(f->flags & IO_READ) || size <= 0)
+    140c:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+    1410:	74 7e                	je     1490 <fread+0x90>
+    1412:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1415:	85 d2                	test   %edx,%edx
+    1417:	7e 77                	jle    1490 <fread+0x90>
+  if(threaded)
+    1419:	a1 e0 3a 00 00       	mov    0x3ae0,%eax
+    return 0;
+  flockfile(f);
+  d = p;
+  for(len = size*nmemb; len > 0; len -= n){
+    141e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1421:	0f af 7d 10          	imul   0x10(%ebp),%edi
+  if(threaded)
+    1425:	85 c0                	test   %eax,%eax
+    1427:	0f 85 93 00 00 00    	jne    14c0 <fread+0xc0>
+  for(len = size*nmemb; len > 0; len -= n){
+    142d:	85 ff                	test   %edi,%edi
+    142f:	7e 61                	jle    1492 <fread+0x92>
+    if(f->r == f->n && fill(f) == 0)
+    1431:	8b 46 10             	mov    0x10(%esi),%eax
+  d = p;
+    1434:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1437:	eb 35                	jmp    146e <fread+0x6e>
+    1439:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      break;
+    n = f->n - f->r;
+    1440:	29 c3                	sub    %eax,%ebx
+    1442:	39 fb                	cmp    %edi,%ebx
+    1444:	0f 4f df             	cmovg  %edi,%ebx
+    if(n > len)
+      n = len;
+    memmove(d, f->buf + f->r, n);
+    1447:	83 ec 04             	sub    $0x4,%esp
+    144a:	53                   	push   %ebx
+    144b:	03 46 08             	add    0x8(%esi),%eax
+  for(len = size*nmemb; len > 0; len -= n){
+    144e:	29 df                	sub    %ebx,%edi
+    memmove(d, f->buf + f->r, n);
+    1450:	50                   	push   %eax
+    1451:	51                   	push   %ecx
+    1452:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1455:	e8 36 f0 ff ff       	call   490 <memmove>
+    f->r += n;
+    145a:	8b 46 10             	mov    0x10(%esi),%eax
+    d += n;
+    145d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1460:	83 c4 10             	add    $0x10,%esp
+    f->r += n;
+    1463:	01 d8                	add    %ebx,%eax
+    d += n;
+    1465:	01 d9                	add    %ebx,%ecx
+    f->r += n;
+    1467:	89 46 10             	mov    %eax,0x10(%esi)
+  for(len = size*nmemb; len > 0; len -= n){
+    146a:	85 ff                	test   %edi,%edi
+    146c:	7e 32                	jle    14a0 <fread+0xa0>
+    if(f->r == f->n && fill(f) == 0)
+    146e:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1471:	39 c3                	cmp    %eax,%ebx
+    1473:	75 cb                	jne    1440 <fread+0x40>
+    1475:	89 f0                	mov    %esi,%eax
+    1477:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    147a:	e8 31 f8 ff ff       	call   cb0 <fill>
+    147f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1482:	85 c0                	test   %eax,%eax
+    1484:	74 1a                	je     14a0 <fread+0xa0>
+    n = f->n - f->r;
+    1486:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1489:	8b 46 10             	mov    0x10(%esi),%eax
+    148c:	eb b2                	jmp    1440 <fread+0x40>
+    148e:	66 90                	xchg   %ax,%ax
+    return 0;
+    1490:	31 c0                	xor    %eax,%eax
+  }
+  funlockfile(f);
+  return (d - (char*)p) / size;
+}
+    1492:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1495:	5b                   	pop    %ebx
+    1496:	5e                   	pop    %esi
+    1497:	5f                   	pop    %edi
+    1498:	5d                   	pop    %ebp
+    1499:	c3                   	ret
+    149a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (d - (char*)p) / size;
+    14a0:	2b 4d 08             	sub    0x8(%ebp),%ecx
+    14a3:	89 cb                	mov    %ecx,%ebx
+  if(threaded)
+    14a5:	a1 e0 3a 00 00       	mov    0x3ae0,%eax
+    14aa:	85 c0                	test   %eax,%eax
+    14ac:	75 32                	jne    14e0 <fread+0xe0>
+  return (d - (char*)p) / size;
+    14ae:	89 d8                	mov    %ebx,%eax
+    14b0:	99                   	cltd
+    14b1:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    14b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    14b7:	5b                   	pop    %ebx
+    14b8:	5e                   	pop    %esi
+    14b9:	5f                   	pop    %edi
+    14ba:	5d                   	pop    %ebp
+    14bb:	c3                   	ret
+    14bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    14c0:	83 ec 0c             	sub    $0xc,%esp
+    14c3:	8d 46 18             	lea    0x18(%esi),%eax
+    14c6:	50                   	push   %eax
+    14c7:	e8 04 f0 ff ff       	call   4d0 <mutex_lock>
+  for(len = size*nmemb; len > 0; len -= n){
+    14cc:	83 c4 10             	add    $0x10,%esp
+    14cf:	85 ff                	test   %edi,%edi
+    14d1:	0f 8f 5a ff ff ff    	jg     1431 <fread+0x31>
+    14d7:	31 db                	xor    %ebx,%ebx
+    14d9:	eb ca                	jmp    14a5 <fread+0xa5>
+    14db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    14df:	90                   	nop
+    mutex_unlock(&f->lock);
+    14e0:	83 ec 0c             	sub    $0xc,%esp
+    14e3:	83 c6 18             	add    $0x18,%esi
+    14e6:	56                   	push   %esi
+    14e7:	e8 34 f0 ff ff       	call   520 <mutex_unlock>
+  return (d - (char*)p) / size;
+    14ec:	89 d8                	mov    %ebx,%eax
+    14ee:	83 c4 10             	add    $0x10,%esp
+    14f1:	99                   	cltd
+    14f2:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    14f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    14f8:	5b                   	pop    %ebx
+    14f9:	5e                   	pop    %esi
+    14fa:	5f                   	pop    %edi
+    14fb:	5d                   	pop    %ebp
+    14fc:	c3                   	ret
+    14fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001500 <fgets>:
+
+// Read a line of at most max-1 bytes, keeping the newline.
+// Returns 0 if there was nothing left to read.
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    1500:	55                   	push   %ebp
+    1501:	89 e5                	mov    %esp,%ebp
+    1503:	57                   	push   %edi
+    1504:	56                   	push   %esi
+    1505:	53                   	push   %ebx
+    1506:	83 ec 1c             	sub    $0x1c,%esp
+  if(threaded)
+    1509:	8b 35 e0 3a 00 00    	mov    0x3ae0,%esi
+{
+    150f:	8b 7d 08             	mov    0x8(%ebp),%edi
+    1512:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if(threaded)
+    1515:	85 f6                	test   %esi,%esi
+    1517:	0f 85 83 00 00 00    	jne    15a0 <fgets+0xa0>
+{
+    151d:	31 f6                	xor    %esi,%esi
+    151f:	eb 2a                	jmp    154b <fgets+0x4b>
+    1521:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return f->buf[f->r++] & 0xff;
+    1528:	8b 53 08             	mov    0x8(%ebx),%edx
+    152b:	8d 48 01             	lea    0x1(%eax),%ecx
+    152e:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1531:	0f b6 14 02          	movzbl (%edx,%eax,1),%edx
+
+  flockfile(f);
+  for(i = 0; i+1 < max; ){
+    if((c = getc_unlocked(f)) == EOF)
+      break;
+    buf[i++] = c;
+    1535:	88 54 37 ff          	mov    %dl,-0x1(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    1539:	80 fa 0a             	cmp    $0xa,%dl
+    153c:	0f 84 96 00 00 00    	je     15d8 <fgets+0xd8>
+    1542:	83 fa 0d             	cmp    $0xd,%edx
+    1545:	0f 84 8d 00 00 00    	je     15d8 <fgets+0xd8>
+  for(i = 0; i+1 < max; ){
+    154b:	89 f2                	mov    %esi,%edx
+    154d:	83 c6 01             	add    $0x1,%esi
+    1550:	3b 75 0c             	cmp    0xc(%ebp),%esi
+    1553:	7d 2b                	jge    1580 <fgets+0x80>
+  if(!(f->flags & IO_READ))
+    1555:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1559:	74 25                	je     1580 <fgets+0x80>
+  if(f->r == f->n && fill(f) == 0)
+    155b:	8b 43 10             	mov    0x10(%ebx),%eax
+    155e:	3b 43 14             	cmp    0x14(%ebx),%eax
+    1561:	75 c5                	jne    1528 <fgets+0x28>
+    1563:	89 d8                	mov    %ebx,%eax
+    1565:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1568:	e8 43 f7 ff ff       	call   cb0 <fill>
+    156d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1570:	85 c0                	test   %eax,%eax
+    1572:	74 0c                	je     1580 <fgets+0x80>
+  return f->buf[f->r++] & 0xff;
+    1574:	8b 43 10             	mov    0x10(%ebx),%eax
+    1577:	eb af                	jmp    1528 <fgets+0x28>
+    1579:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1580:	8b 0d e0 3a 00 00    	mov    0x3ae0,%ecx
+      break;
+  }
+  buf[i] = '\0';
+    1586:	c6 04 17 00          	movb   $0x0,(%edi,%edx,1)
+  if(threaded)
+    158a:	85 c9                	test   %ecx,%ecx
+    158c:	75 2a                	jne    15b8 <fgets+0xb8>
+  funlockfile(f);
+  return i > 0 ? buf : 0;
+    158e:	31 c0                	xor    %eax,%eax
+    1590:	85 d2                	test   %edx,%edx
+    1592:	74 02                	je     1596 <fgets+0x96>
+    1594:	89 f8                	mov    %edi,%eax
+}
+    1596:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1599:	5b                   	pop    %ebx
+    159a:	5e                   	pop    %esi
+    159b:	5f                   	pop    %edi
+    159c:	5d                   	pop    %ebp
+    159d:	c3                   	ret
+    159e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    15a0:	83 ec 0c             	sub    $0xc,%esp
+    15a3:	8d 43 18             	lea    0x18(%ebx),%eax
+    15a6:	50                   	push   %eax
+    15a7:	e8 24 ef ff ff       	call   4d0 <mutex_lock>
+    15ac:	83 c4 10             	add    $0x10,%esp
+    15af:	e9 69 ff ff ff       	jmp    151d <fgets+0x1d>
+    15b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    15b8:	83 ec 0c             	sub    $0xc,%esp
+    15bb:	83 c3 18             	add    $0x18,%ebx
+    15be:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    15c1:	53                   	push   %ebx
+    15c2:	e8 59 ef ff ff       	call   520 <mutex_unlock>
+    15c7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    15ca:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    15cd:	31 c0                	xor    %eax,%eax
+    15cf:	85 d2                	test   %edx,%edx
+    15d1:	75 c1                	jne    1594 <fgets+0x94>
+    15d3:	eb c1                	jmp    1596 <fgets+0x96>
+    15d5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    15d8:	a1 e0 3a 00 00       	mov    0x3ae0,%eax
+  buf[i] = '\0';
+    15dd:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  if(threaded)
+    15e1:	85 c0                	test   %eax,%eax
+    15e3:	74 af                	je     1594 <fgets+0x94>
+    mutex_unlock(&f->lock);
+    15e5:	83 ec 0c             	sub    $0xc,%esp
+    15e8:	83 c3 18             	add    $0x18,%ebx
+    15eb:	53                   	push   %ebx
+    15ec:	e8 2f ef ff ff       	call   520 <mutex_unlock>
+    15f1:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    15f4:	89 f8                	mov    %edi,%eax
+    15f6:	eb 9e                	jmp    1596 <fgets+0x96>
+    15f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15ff:	90                   	nop
+
+00001600 <gets>:
+// at most a line per read(), goes through stdin's buffer: from a
+// file or pipe, a buffered read could take input meant for a child
+// process, so read a byte at a time.
+char*
+gets(char *buf, int max)
+{
+    1600:	55                   	push   %ebp
+    1601:	89 e5                	mov    %esp,%ebp
+    1603:	57                   	push   %edi
+    1604:	56                   	push   %esi
+    1605:	53                   	push   %ebx
+    1606:	83 ec 2c             	sub    $0x2c,%esp
+  int i, cc;
+  char c;
+
+  if(!(stdin->flags & IO_SETUP))
+    1609:	8b 15 e4 29 00 00    	mov    0x29e4,%edx
+{
+    160f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!(stdin->flags & IO_SETUP))
+    1612:	f6 c2 40             	test   $0x40,%dl
+    1615:	74 79                	je     1690 <gets+0x90>
+    setup(stdin);
+  if(stdin->flags & IO_DEV){
+    1617:	83 e2 20             	and    $0x20,%edx
+    161a:	89 d7                	mov    %edx,%edi
+    161c:	75 52                	jne    1670 <gets+0x70>
+  if(f == 0){
+    161e:	e8 ed f5 ff ff       	call   c10 <fflush.part.0>
+    fgets(buf, max, stdin);
+    return buf;
+  }
+  fflush(0);
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1623:	8d 75 e7             	lea    -0x19(%ebp),%esi
+  for(i=0; i+1 < max; ){
+    1626:	eb 2c                	jmp    1654 <gets+0x54>
+    1628:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    162f:	90                   	nop
+    cc = read(0, &c, 1);
+    1630:	83 ec 04             	sub    $0x4,%esp
+    1633:	6a 01                	push   $0x1
+    1635:	56                   	push   %esi
+    1636:	6a 00                	push   $0x0
+    1638:	e8 f5 ef ff ff       	call   632 <read>
+    if(cc < 1)
+    163d:	83 c4 10             	add    $0x10,%esp
+    1640:	85 c0                	test   %eax,%eax
+    1642:	7e 1b                	jle    165f <gets+0x5f>
+      break;
+    buf[i++] = c;
+    1644:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1648:	88 44 3b ff          	mov    %al,-0x1(%ebx,%edi,1)
+    if(c == '\n' || c == '\r')
+    164c:	3c 0a                	cmp    $0xa,%al
+    164e:	74 12                	je     1662 <gets+0x62>
+    1650:	3c 0d                	cmp    $0xd,%al
+    1652:	74 0e                	je     1662 <gets+0x62>
+  for(i=0; i+1 < max; ){
+    1654:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    1657:	83 c7 01             	add    $0x1,%edi
+    165a:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+    165d:	7c d1                	jl     1630 <gets+0x30>
+{
+    165f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      break;
+  }
+  buf[i] = '\0';
+    1662:	c6 04 3b 00          	movb   $0x0,(%ebx,%edi,1)
+  return buf;
+}
+    1666:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1669:	89 d8                	mov    %ebx,%eax
+    166b:	5b                   	pop    %ebx
+    166c:	5e                   	pop    %esi
+    166d:	5f                   	pop    %edi
+    166e:	5d                   	pop    %ebp
+    166f:	c3                   	ret
+    fgets(buf, max, stdin);
+    1670:	83 ec 04             	sub    $0x4,%esp
+    1673:	68 e0 29 00 00       	push   $0x29e0
+    1678:	ff 75 0c             	push   0xc(%ebp)
+    167b:	53                   	push   %ebx
+    167c:	e8 7f fe ff ff       	call   1500 <fgets>
+    return buf;
+    1681:	83 c4 10             	add    $0x10,%esp
+}
+    1684:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1687:	89 d8                	mov    %ebx,%eax
+    1689:	5b                   	pop    %ebx
+    168a:	5e                   	pop    %esi
+    168b:	5f                   	pop    %edi
+    168c:	5d                   	pop    %ebp
+    168d:	c3                   	ret
+    168e:	66 90                	xchg   %ax,%ax
+    setup(stdin);
+    1690:	b8 e0 29 00 00       	mov    $0x29e0,%eax
+    1695:	e8 a6 f4 ff ff       	call   b40 <setup>
+  if(stdin->flags & IO_DEV){
+    169a:	8b 15 e4 29 00 00    	mov    0x29e4,%edx
+    16a0:	e9 72 ff ff ff       	jmp    1617 <gets+0x17>
+    16a5:	66 90                	xchg   %ax,%ax
+    16a7:	66 90                	xchg   %ax,%ax
+    16a9:	66 90                	xchg   %ax,%ax
+    16ab:	66 90                	xchg   %ax,%ax
+    16ad:	66 90                	xchg   %ax,%ax
+    16af:	90                   	nop
+
+000016b0 <bigfree>:
+
+// Give a big block back to the first-fit list, and return the
+// free block that now holds it. Caller holds lock.
+static Header*
+bigfree(Header *bp)
+{
+    16b0:	55                   	push   %ebp
+    16b1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    16b3:	a1 84 41 00 00       	mov    0x4184,%eax
+{
+    16b8:	89 e5                	mov    %esp,%ebp
+    16ba:	56                   	push   %esi
+    16bb:	53                   	push   %ebx
+    16bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    16c0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    16c2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    16c4:	39 ca                	cmp    %ecx,%edx
+    16c6:	73 38                	jae    1700 <bigfree+0x50>
+    16c8:	39 c1                	cmp    %eax,%ecx
+    16ca:	72 04                	jb     16d0 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    16cc:	39 c2                	cmp    %eax,%edx
+    16ce:	72 f0                	jb     16c0 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    16d0:	8b 59 04             	mov    0x4(%ecx),%ebx
+    16d3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    16d6:	39 f0                	cmp    %esi,%eax
+    16d8:	74 36                	je     1710 <bigfree+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    16da:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  freep = p;
+  if(p + p->s.size == bp){
+    16dc:	8b 42 04             	mov    0x4(%edx),%eax
+    16df:	89 cb                	mov    %ecx,%ebx
+  freep = p;
+    16e1:	89 15 84 41 00 00    	mov    %edx,0x4184
+  if(p + p->s.size == bp){
+    16e7:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    16ea:	39 f1                	cmp    %esi,%ecx
+    16ec:	74 2e                	je     171c <bigfree+0x6c>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    16ee:	89 1a                	mov    %ebx,(%edx)
+    return p;
+  }
+  p->s.ptr = bp;
+  return bp;
+}
+    16f0:	89 c8                	mov    %ecx,%eax
+    16f2:	5b                   	pop    %ebx
+    16f3:	5e                   	pop    %esi
+    16f4:	5d                   	pop    %ebp
+    16f5:	c3                   	ret
+    16f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16fd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1700:	39 c1                	cmp    %eax,%ecx
+    1702:	72 c8                	jb     16cc <bigfree+0x1c>
+    1704:	eb ba                	jmp    16c0 <bigfree+0x10>
+    1706:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    170d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1710:	03 58 04             	add    0x4(%eax),%ebx
+    1713:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1716:	8b 02                	mov    (%edx),%eax
+    1718:	8b 00                	mov    (%eax),%eax
+    171a:	eb be                	jmp    16da <bigfree+0x2a>
+    p->s.size += bp->s.size;
+    171c:	03 41 04             	add    0x4(%ecx),%eax
+    171f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1722:	8b 19                	mov    (%ecx),%ebx
+    return p;
+    1724:	89 d1                	mov    %edx,%ecx
+}
+    1726:	89 c8                	mov    %ecx,%eax
+    p->s.ptr = bp->s.ptr;
+    1728:	89 1a                	mov    %ebx,(%edx)
+}
+    172a:	5b                   	pop    %ebx
+    172b:	5e                   	pop    %esi
+    172c:	5d                   	pop    %ebp
+    172d:	c3                   	ret
+    172e:	66 90                	xchg   %ax,%ax
+
+00001730 <trim>:
+// If free block bp ends the heap, return its whole pages to the
+// kernel, unless something else has moved the break since.
+// Caller holds lock.
+static void
+trim(Header *bp)
+{
+    1730:	55                   	push   %ebp
+    1731:	89 e5                	mov    %esp,%ebp
+    1733:	57                   	push   %edi
+    1734:	56                   	push   %esi
+    1735:	53                   	push   %ebx
+    1736:	89 c3                	mov    %eax,%ebx
+    1738:	83 ec 0c             	sub    $0xc,%esp
+  char *end;
+  uint n;
+
+  if((char*)(bp + bp->s.size) != heapend)
+    173b:	8b 53 04             	mov    0x4(%ebx),%edx
+    173e:	a1 80 41 00 00       	mov    0x4180,%eax
+    1743:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+    1746:	39 d0                	cmp    %edx,%eax
+    1748:	74 0e                	je     1758 <trim+0x28>
+  n = heapend - end;
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    bp->s.size -= n / sizeof(Header);
+    heapend = end;
+  }
+}
+    174a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    174d:	5b                   	pop    %ebx
+    174e:	5e                   	pop    %esi
+    174f:	5f                   	pop    %edi
+    1750:	5d                   	pop    %ebp
+    1751:	c3                   	ret
+    1752:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  end = (char*)PGROUNDUP((uint)(bp + 2));
+    1758:	8d bb 0f 10 00 00    	lea    0x100f(%ebx),%edi
+    175e:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  n = heapend - end;
+    1764:	29 f8                	sub    %edi,%eax
+    1766:	89 c6                	mov    %eax,%esi
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    1768:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    176d:	76 db                	jbe    174a <trim+0x1a>
+    176f:	83 ec 0c             	sub    $0xc,%esp
+    1772:	6a 00                	push   $0x0
+    1774:	e8 8b ef ff ff       	call   704 <sbrk>
+    1779:	83 c4 10             	add    $0x10,%esp
+    177c:	39 05 80 41 00 00    	cmp    %eax,0x4180
+    1782:	75 c6                	jne    174a <trim+0x1a>
+    1784:	89 f0                	mov    %esi,%eax
+    1786:	83 ec 0c             	sub    $0xc,%esp
+    1789:	f7 d8                	neg    %eax
+    178b:	50                   	push   %eax
+    178c:	e8 73 ef ff ff       	call   704 <sbrk>
+    1791:	83 c4 10             	add    $0x10,%esp
+    1794:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1797:	74 b1                	je     174a <trim+0x1a>
+    bp->s.size -= n / sizeof(Header);
+    1799:	89 f0                	mov    %esi,%eax
+    heapend = end;
+    179b:	89 3d 80 41 00 00    	mov    %edi,0x4180
+    bp->s.size -= n / sizeof(Header);
+    17a1:	c1 e8 03             	shr    $0x3,%eax
+    17a4:	29 43 04             	sub    %eax,0x4(%ebx)
+    heapend = end;
+    17a7:	eb a1                	jmp    174a <trim+0x1a>
+    17a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000017b0 <bigalloc>:
+}
+
+// Allocate a big block of nunits units. Caller holds lock.
+static Header*
+bigalloc(uint nunits)
+{
+    17b0:	55                   	push   %ebp
+    17b1:	89 e5                	mov    %esp,%ebp
+    17b3:	57                   	push   %edi
+    17b4:	89 c7                	mov    %eax,%edi
+    17b6:	56                   	push   %esi
+    17b7:	53                   	push   %ebx
+    17b8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    17bb:	a1 84 41 00 00       	mov    0x4184,%eax
+    17c0:	85 c0                	test   %eax,%eax
+    17c2:	0f 84 98 00 00 00    	je     1860 <bigalloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    17c8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    17ca:	8b 4a 04             	mov    0x4(%edx),%ecx
+    17cd:	39 f9                	cmp    %edi,%ecx
+    17cf:	73 67                	jae    1838 <bigalloc+0x88>
+  if(nu < 4096)
+    17d1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    17d6:	39 df                	cmp    %ebx,%edi
+    17d8:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    17db:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    17e2:	eb 0d                	jmp    17f1 <bigalloc+0x41>
+    17e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    17e8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    17ea:	8b 4a 04             	mov    0x4(%edx),%ecx
+    17ed:	39 f9                	cmp    %edi,%ecx
+    17ef:	73 47                	jae    1838 <bigalloc+0x88>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    17f1:	89 d0                	mov    %edx,%eax
+    17f3:	39 15 84 41 00 00    	cmp    %edx,0x4184
+    17f9:	75 ed                	jne    17e8 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    17fb:	83 ec 0c             	sub    $0xc,%esp
+    17fe:	56                   	push   %esi
+    17ff:	e8 00 ef ff ff       	call   704 <sbrk>
+  if(p == (char*)-1)
+    1804:	83 c4 10             	add    $0x10,%esp
+    1807:	83 f8 ff             	cmp    $0xffffffff,%eax
+    180a:	74 1a                	je     1826 <bigalloc+0x76>
+  hp->s.size = nu;
+    180c:	89 58 04             	mov    %ebx,0x4(%eax)
+  heapend = p + nu * sizeof(Header);
+    180f:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    1812:	89 15 80 41 00 00    	mov    %edx,0x4180
+  bigfree(hp);
+    1818:	e8 93 fe ff ff       	call   16b0 <bigfree>
+  return freep;
+    181d:	a1 84 41 00 00       	mov    0x4184,%eax
+      if((p = morecore(nunits)) == 0)
+    1822:	85 c0                	test   %eax,%eax
+    1824:	75 c2                	jne    17e8 <bigalloc+0x38>
+        return 0;
+  }
+}
+    1826:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1829:	31 d2                	xor    %edx,%edx
+}
+    182b:	5b                   	pop    %ebx
+    182c:	89 d0                	mov    %edx,%eax
+    182e:	5e                   	pop    %esi
+    182f:	5f                   	pop    %edi
+    1830:	5d                   	pop    %ebp
+    1831:	c3                   	ret
+    1832:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1838:	39 cf                	cmp    %ecx,%edi
+    183a:	74 54                	je     1890 <bigalloc+0xe0>
+        p->s.size -= nunits;
+    183c:	29 f9                	sub    %edi,%ecx
+    183e:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    1841:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    1844:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    1847:	a3 84 41 00 00       	mov    %eax,0x4184
+}
+    184c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    184f:	89 d0                	mov    %edx,%eax
+    1851:	5b                   	pop    %ebx
+    1852:	5e                   	pop    %esi
+    1853:	5f                   	pop    %edi
+    1854:	5d                   	pop    %ebp
+    1855:	c3                   	ret
+    1856:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    185d:	8d 76 00             	lea    0x0(%esi),%esi
+    base.s.ptr = freep = prevp = &base;
+    1860:	c7 05 84 41 00 00 88 	movl   $0x4188,0x4184
+    1867:	41 00 00 
+    base.s.size = 0;
+    186a:	ba 88 41 00 00       	mov    $0x4188,%edx
+    base.s.ptr = freep = prevp = &base;
+    186f:	c7 05 88 41 00 00 88 	movl   $0x4188,0x4188
+    1876:	41 00 00 
+    base.s.size = 0;
+    1879:	c7 05 8c 41 00 00 00 	movl   $0x0,0x418c
+    1880:	00 00 00 
+    if(p->s.size >= nunits){
+    1883:	e9 49 ff ff ff       	jmp    17d1 <bigalloc+0x21>
+    1888:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    188f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1890:	8b 0a                	mov    (%edx),%ecx
+    1892:	89 08                	mov    %ecx,(%eax)
+    1894:	eb b1                	jmp    1847 <bigalloc+0x97>
+    1896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    189d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000018a0 <drain>:
+}
+
+// Move n blocks of class c from cache tc to the shared list.
+static void
+drain(struct tcache *tc, int c, int n)
+{
+    18a0:	55                   	push   %ebp
+    18a1:	89 e5                	mov    %esp,%ebp
+    18a3:	57                   	push   %edi
+    18a4:	89 c7                	mov    %eax,%edi
+    18a6:	56                   	push   %esi
+    18a7:	89 d6                	mov    %edx,%esi
+    18a9:	53                   	push   %ebx
+    18aa:	89 cb                	mov    %ecx,%ebx
+    18ac:	83 ec 0c             	sub    $0xc,%esp
+  if(threaded)
+    18af:	8b 15 04 41 00 00    	mov    0x4104,%edx
+    18b5:	85 d2                	test   %edx,%edx
+    18b7:	75 57                	jne    1910 <drain+0x70>
+  Header *p;
+
+  acquire();
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    18b9:	85 c9                	test   %ecx,%ecx
+    18bb:	7e 49                	jle    1906 <drain+0x66>
+    18bd:	89 d9                	mov    %ebx,%ecx
+    18bf:	8d 14 b7             	lea    (%edi,%esi,4),%edx
+    18c2:	eb 23                	jmp    18e7 <drain+0x47>
+    18c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    tc->list[c] = p->s.ptr;
+    18c8:	8b 18                	mov    (%eax),%ebx
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    18ca:	83 e9 01             	sub    $0x1,%ecx
+    tc->n[c]--;
+    18cd:	83 6a 20 01          	subl   $0x1,0x20(%edx)
+    tc->list[c] = p->s.ptr;
+    18d1:	89 1a                	mov    %ebx,(%edx)
+    p->s.ptr = small[c];
+    18d3:	8b 1c b5 60 41 00 00 	mov    0x4160(,%esi,4),%ebx
+    18da:	89 18                	mov    %ebx,(%eax)
+    small[c] = p;
+    18dc:	89 04 b5 60 41 00 00 	mov    %eax,0x4160(,%esi,4)
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    18e3:	85 c9                	test   %ecx,%ecx
+    18e5:	7e 06                	jle    18ed <drain+0x4d>
+    18e7:	8b 02                	mov    (%edx),%eax
+    18e9:	85 c0                	test   %eax,%eax
+    18eb:	75 db                	jne    18c8 <drain+0x28>
+  if(threaded)
+    18ed:	a1 04 41 00 00       	mov    0x4104,%eax
+    18f2:	85 c0                	test   %eax,%eax
+    18f4:	74 10                	je     1906 <drain+0x66>
+    mutex_unlock(&lock);
+    18f6:	83 ec 0c             	sub    $0xc,%esp
+    18f9:	68 08 41 00 00       	push   $0x4108
+    18fe:	e8 1d ec ff ff       	call   520 <mutex_unlock>
+}
+    1903:	83 c4 10             	add    $0x10,%esp
+  }
+  release();
+}
+    1906:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1909:	5b                   	pop    %ebx
+    190a:	5e                   	pop    %esi
+    190b:	5f                   	pop    %edi
+    190c:	5d                   	pop    %ebp
+    190d:	c3                   	ret
+    190e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&lock);
+    1910:	83 ec 0c             	sub    $0xc,%esp
+    1913:	68 08 41 00 00       	push   $0x4108
+    1918:	e8 b3 eb ff ff       	call   4d0 <mutex_lock>
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    191d:	83 c4 10             	add    $0x10,%esp
+    1920:	85 db                	test   %ebx,%ebx
+    1922:	7f 99                	jg     18bd <drain+0x1d>
+    1924:	eb c7                	jmp    18ed <drain+0x4d>
+    1926:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    192d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001930 <mycache>:
+{
+    1930:	55                   	push   %ebp
+    return &maincache;
+    1931:	b8 20 41 00 00       	mov    $0x4120,%eax
+{
+    1936:	89 e5                	mov    %esp,%ebp
+    1938:	53                   	push   %ebx
+  sp = PGROUNDDOWN((uint)&sp);
+    1939:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+    193c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+    1942:	83 ec 14             	sub    $0x14,%esp
+  if(!threaded || sp == mainstack)
+    1945:	8b 0d 04 41 00 00    	mov    0x4104,%ecx
+  sp = PGROUNDDOWN((uint)&sp);
+    194b:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  if(!threaded || sp == mainstack)
+    194e:	85 c9                	test   %ecx,%ecx
+    1950:	74 0f                	je     1961 <mycache+0x31>
+    1952:	3b 1d 00 41 00 00    	cmp    0x4100,%ebx
+    1958:	74 07                	je     1961 <mycache+0x31>
+  if(*cp == 0){
+    195a:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    195d:	85 c0                	test   %eax,%eax
+    195f:	74 0f                	je     1970 <mycache+0x40>
+}
+    1961:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1964:	c9                   	leave
+    1965:	c3                   	ret
+    1966:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    196d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1970:	83 ec 0c             	sub    $0xc,%esp
+    1973:	68 08 41 00 00       	push   $0x4108
+    1978:	e8 53 eb ff ff       	call   4d0 <mutex_lock>
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    197d:	b8 09 00 00 00       	mov    $0x9,%eax
+    1982:	e8 29 fe ff ff       	call   17b0 <bigalloc>
+  if(threaded)
+    1987:	8b 15 04 41 00 00    	mov    0x4104,%edx
+    198d:	83 c4 10             	add    $0x10,%esp
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    1990:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(threaded)
+    1993:	85 d2                	test   %edx,%edx
+    1995:	75 29                	jne    19c0 <mycache+0x90>
+    if(*cp == 0)
+    1997:	85 c0                	test   %eax,%eax
+    1999:	74 c6                	je     1961 <mycache+0x31>
+    memset(*cp, 0, sizeof(**cp));
+    199b:	83 ec 04             	sub    $0x4,%esp
+    *cp = (struct tcache*)((Header*)*cp + 1);
+    199e:	83 c0 08             	add    $0x8,%eax
+    19a1:	89 43 f8             	mov    %eax,-0x8(%ebx)
+    memset(*cp, 0, sizeof(**cp));
+    19a4:	6a 40                	push   $0x40
+    19a6:	6a 00                	push   $0x0
+    19a8:	50                   	push   %eax
+    19a9:	e8 f2 e9 ff ff       	call   3a0 <memset>
+  return *cp;
+    19ae:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    19b1:	83 c4 10             	add    $0x10,%esp
+    19b4:	eb ab                	jmp    1961 <mycache+0x31>
+    19b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19bd:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    19c0:	83 ec 0c             	sub    $0xc,%esp
+    19c3:	68 08 41 00 00       	push   $0x4108
+    19c8:	e8 53 eb ff ff       	call   520 <mutex_unlock>
+    if(*cp == 0)
+    19cd:	8b 43 f8             	mov    -0x8(%ebx),%eax
+}
+    19d0:	83 c4 10             	add    $0x10,%esp
+    19d3:	eb c2                	jmp    1997 <mycache+0x67>
+    19d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000019e0 <free>:
+
+void
+free(void *ap)
+{
+    19e0:	55                   	push   %ebp
+    19e1:	89 e5                	mov    %esp,%ebp
+    19e3:	57                   	push   %edi
+    19e4:	56                   	push   %esi
+    19e5:	53                   	push   %ebx
+    19e6:	83 ec 1c             	sub    $0x1c,%esp
+    19e9:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  struct tcache *tc;
+  int c;
+
+  if(ap == 0)
+    19ec:	85 f6                	test   %esi,%esi
+    19ee:	74 51                	je     1a41 <free+0x61>
+    return;
+  bp = (Header*)ap - 1;
+    19f0:	8d 46 f8             	lea    -0x8(%esi),%eax
+    19f3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(bp->s.size > SMALLMAX / sizeof(Header)){
+    19f6:	8b 46 fc             	mov    -0x4(%esi),%eax
+    19f9:	3d 00 01 00 00       	cmp    $0x100,%eax
+    19fe:	77 50                	ja     1a50 <free+0x70>
+    acquire();
+    trim(bigfree(bp));
+    release();
+    return;
+  }
+  for(c = 0; (2 << c) < bp->s.size; c++)
+    1a00:	31 db                	xor    %ebx,%ebx
+    1a02:	ba 02 00 00 00       	mov    $0x2,%edx
+    1a07:	83 f8 02             	cmp    $0x2,%eax
+    1a0a:	76 11                	jbe    1a1d <free+0x3d>
+    1a0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1a10:	83 c3 01             	add    $0x1,%ebx
+    1a13:	89 d7                	mov    %edx,%edi
+    1a15:	89 d9                	mov    %ebx,%ecx
+    1a17:	d3 e7                	shl    %cl,%edi
+    1a19:	39 c7                	cmp    %eax,%edi
+    1a1b:	72 f3                	jb     1a10 <free+0x30>
+    ;
+  if((tc = mycache()) == 0){
+    1a1d:	e8 0e ff ff ff       	call   1930 <mycache>
+    1a22:	85 c0                	test   %eax,%eax
+    1a24:	74 7a                	je     1aa0 <free+0xc0>
+    bp->s.ptr = small[c];
+    small[c] = bp;
+    release();
+    return;
+  }
+  bp->s.ptr = tc->list[c];
+    1a26:	8d 0c 98             	lea    (%eax,%ebx,4),%ecx
+    1a29:	8b 11                	mov    (%ecx),%edx
+    1a2b:	89 56 f8             	mov    %edx,-0x8(%esi)
+  tc->list[c] = bp;
+    1a2e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1a31:	89 31                	mov    %esi,(%ecx)
+  if(++tc->n[c] > TCACHEMAX)
+    1a33:	8b 71 20             	mov    0x20(%ecx),%esi
+    1a36:	8d 56 01             	lea    0x1(%esi),%edx
+    1a39:	89 51 20             	mov    %edx,0x20(%ecx)
+    1a3c:	83 fa 20             	cmp    $0x20,%edx
+    1a3f:	7f 47                	jg     1a88 <free+0xa8>
+    drain(tc, c, BATCH);
+}
+    1a41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a44:	5b                   	pop    %ebx
+    1a45:	5e                   	pop    %esi
+    1a46:	5f                   	pop    %edi
+    1a47:	5d                   	pop    %ebp
+    1a48:	c3                   	ret
+    1a49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1a50:	8b 1d 04 41 00 00    	mov    0x4104,%ebx
+    1a56:	85 db                	test   %ebx,%ebx
+    1a58:	75 66                	jne    1ac0 <free+0xe0>
+    trim(bigfree(bp));
+    1a5a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1a5d:	e8 4e fc ff ff       	call   16b0 <bigfree>
+    1a62:	e8 c9 fc ff ff       	call   1730 <trim>
+  if(threaded)
+    1a67:	8b 0d 04 41 00 00    	mov    0x4104,%ecx
+    1a6d:	85 c9                	test   %ecx,%ecx
+    1a6f:	74 d0                	je     1a41 <free+0x61>
+    mutex_unlock(&lock);
+    1a71:	c7 45 08 08 41 00 00 	movl   $0x4108,0x8(%ebp)
+}
+    1a78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a7b:	5b                   	pop    %ebx
+    1a7c:	5e                   	pop    %esi
+    1a7d:	5f                   	pop    %edi
+    1a7e:	5d                   	pop    %ebp
+    mutex_unlock(&lock);
+    1a7f:	e9 9c ea ff ff       	jmp    520 <mutex_unlock>
+    1a84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    1a88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    drain(tc, c, BATCH);
+    1a8b:	89 da                	mov    %ebx,%edx
+    1a8d:	b9 10 00 00 00       	mov    $0x10,%ecx
+}
+    1a92:	5b                   	pop    %ebx
+    1a93:	5e                   	pop    %esi
+    1a94:	5f                   	pop    %edi
+    1a95:	5d                   	pop    %ebp
+    drain(tc, c, BATCH);
+    1a96:	e9 05 fe ff ff       	jmp    18a0 <drain>
+    1a9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1a9f:	90                   	nop
+  if(threaded)
+    1aa0:	8b 15 04 41 00 00    	mov    0x4104,%edx
+    1aa6:	85 d2                	test   %edx,%edx
+    1aa8:	75 28                	jne    1ad2 <free+0xf2>
+    bp->s.ptr = small[c];
+    1aaa:	8b 04 9d 60 41 00 00 	mov    0x4160(,%ebx,4),%eax
+    1ab1:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1ab4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1ab7:	89 04 9d 60 41 00 00 	mov    %eax,0x4160(,%ebx,4)
+  if(threaded)
+    1abe:	eb 81                	jmp    1a41 <free+0x61>
+    mutex_lock(&lock);
+    1ac0:	83 ec 0c             	sub    $0xc,%esp
+    1ac3:	68 08 41 00 00       	push   $0x4108
+    1ac8:	e8 03 ea ff ff       	call   4d0 <mutex_lock>
+}
+    1acd:	83 c4 10             	add    $0x10,%esp
+    1ad0:	eb 88                	jmp    1a5a <free+0x7a>
+    mutex_lock(&lock);
+    1ad2:	83 ec 0c             	sub    $0xc,%esp
+    1ad5:	68 08 41 00 00       	push   $0x4108
+    1ada:	e8 f1 e9 ff ff       	call   4d0 <mutex_lock>
+    bp->s.ptr = small[c];
+    1adf:	8b 04 9d 60 41 00 00 	mov    0x4160(,%ebx,4),%eax
+  if(threaded)
+    1ae6:	83 c4 10             	add    $0x10,%esp
+    bp->s.ptr = small[c];
+    1ae9:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1aec:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1aef:	89 04 9d 60 41 00 00 	mov    %eax,0x4160(,%ebx,4)
+  if(threaded)
+    1af6:	a1 04 41 00 00       	mov    0x4104,%eax
+    1afb:	85 c0                	test   %eax,%eax
+    1afd:	0f 85 6e ff ff ff    	jne    1a71 <free+0x91>
+    1b03:	e9 39 ff ff ff       	jmp    1a41 <free+0x61>
+    1b08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b0f:	90                   	nop
+
+00001b10 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1b10:	55                   	push   %ebp
+    1b11:	89 e5                	mov    %esp,%ebp
+    1b13:	57                   	push   %edi
+    1b14:	56                   	push   %esi
+    1b15:	53                   	push   %ebx
+    1b16:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  struct tcache *tc;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1b19:	8b 45 08             	mov    0x8(%ebp),%eax
+    1b1c:	8d 78 07             	lea    0x7(%eax),%edi
+    1b1f:	c1 ef 03             	shr    $0x3,%edi
+    1b22:	83 c7 01             	add    $0x1,%edi
+  if(nunits > SMALLMAX / sizeof(Header)){
+    1b25:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+    1b2b:	77 5b                	ja     1b88 <malloc+0x78>
+    acquire();
+    p = bigalloc(nunits);
+    release();
+    return p ? (void*)(p + 1) : 0;
+  }
+  for(c = 0; (2 << c) < nunits; c++)
+    1b2d:	31 c9                	xor    %ecx,%ecx
+    1b2f:	b8 02 00 00 00       	mov    $0x2,%eax
+    1b34:	be 02 00 00 00       	mov    $0x2,%esi
+    1b39:	bb 02 00 00 00       	mov    $0x2,%ebx
+    1b3e:	83 ff 02             	cmp    $0x2,%edi
+    1b41:	76 12                	jbe    1b55 <malloc+0x45>
+    1b43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1b47:	90                   	nop
+    1b48:	83 c1 01             	add    $0x1,%ecx
+    1b4b:	89 c3                	mov    %eax,%ebx
+    1b4d:	d3 e3                	shl    %cl,%ebx
+    1b4f:	89 de                	mov    %ebx,%esi
+    1b51:	39 fb                	cmp    %edi,%ebx
+    1b53:	72 f3                	jb     1b48 <malloc+0x38>
+    1b55:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    ;
+  if((tc = mycache()) == 0)
+    1b58:	e8 d3 fd ff ff       	call   1930 <mycache>
+    1b5d:	85 c0                	test   %eax,%eax
+    1b5f:	74 51                	je     1bb2 <malloc+0xa2>
+    return 0;
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1b61:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1b64:	8d 3c 88             	lea    (%eax,%ecx,4),%edi
+    1b67:	8b 07                	mov    (%edi),%eax
+    1b69:	85 c0                	test   %eax,%eax
+    1b6b:	74 53                	je     1bc0 <malloc+0xb0>
+    return 0;
+  p = tc->list[c];
+  tc->list[c] = p->s.ptr;
+  tc->n[c]--;
+    1b6d:	8b 57 20             	mov    0x20(%edi),%edx
+  tc->list[c] = p->s.ptr;
+    1b70:	8b 08                	mov    (%eax),%ecx
+  tc->n[c]--;
+    1b72:	83 ea 01             	sub    $0x1,%edx
+  return (void*)(p + 1);
+    1b75:	83 c0 08             	add    $0x8,%eax
+  tc->n[c]--;
+    1b78:	89 57 20             	mov    %edx,0x20(%edi)
+  tc->list[c] = p->s.ptr;
+    1b7b:	89 0f                	mov    %ecx,(%edi)
+}
+    1b7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b80:	5b                   	pop    %ebx
+    1b81:	5e                   	pop    %esi
+    1b82:	5f                   	pop    %edi
+    1b83:	5d                   	pop    %ebp
+    1b84:	c3                   	ret
+    1b85:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1b88:	a1 04 41 00 00       	mov    0x4104,%eax
+    1b8d:	85 c0                	test   %eax,%eax
+    1b8f:	0f 85 b3 00 00 00    	jne    1c48 <malloc+0x138>
+    p = bigalloc(nunits);
+    1b95:	89 f8                	mov    %edi,%eax
+    1b97:	e8 14 fc ff ff       	call   17b0 <bigalloc>
+    1b9c:	89 c3                	mov    %eax,%ebx
+  if(threaded)
+    1b9e:	a1 04 41 00 00       	mov    0x4104,%eax
+    1ba3:	85 c0                	test   %eax,%eax
+    1ba5:	0f 85 85 00 00 00    	jne    1c30 <malloc+0x120>
+    return p ? (void*)(p + 1) : 0;
+    1bab:	8d 43 08             	lea    0x8(%ebx),%eax
+    1bae:	85 db                	test   %ebx,%ebx
+    1bb0:	75 cb                	jne    1b7d <malloc+0x6d>
+    1bb2:	31 c0                	xor    %eax,%eax
+}
+    1bb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1bb7:	5b                   	pop    %ebx
+    1bb8:	5e                   	pop    %esi
+    1bb9:	5f                   	pop    %edi
+    1bba:	5d                   	pop    %ebp
+    1bbb:	c3                   	ret
+    1bbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1bc0:	a1 04 41 00 00       	mov    0x4104,%eax
+    1bc5:	85 c0                	test   %eax,%eax
+    1bc7:	0f 85 29 01 00 00    	jne    1cf6 <malloc+0x1e6>
+  if(small[c] == 0){
+    1bcd:	8b 04 8d 60 41 00 00 	mov    0x4160(,%ecx,4),%eax
+    1bd4:	85 c0                	test   %eax,%eax
+    1bd6:	0f 84 81 00 00 00    	je     1c5d <malloc+0x14d>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1bdc:	31 db                	xor    %ebx,%ebx
+    1bde:	eb 22                	jmp    1c02 <malloc+0xf2>
+    small[c] = p->s.ptr;
+    1be0:	8b 10                	mov    (%eax),%edx
+  for(moved = 0; moved < n && small[c]; moved++){
+    1be2:	83 c3 01             	add    $0x1,%ebx
+    small[c] = p->s.ptr;
+    1be5:	89 14 8d 60 41 00 00 	mov    %edx,0x4160(,%ecx,4)
+    p->s.ptr = tc->list[c];
+    1bec:	8b 17                	mov    (%edi),%edx
+    1bee:	89 10                	mov    %edx,(%eax)
+    tc->list[c] = p;
+    1bf0:	89 07                	mov    %eax,(%edi)
+  for(moved = 0; moved < n && small[c]; moved++){
+    1bf2:	83 fb 10             	cmp    $0x10,%ebx
+    1bf5:	0f 84 e2 00 00 00    	je     1cdd <malloc+0x1cd>
+    1bfb:	8b 04 8d 60 41 00 00 	mov    0x4160(,%ecx,4),%eax
+    1c02:	85 c0                	test   %eax,%eax
+    1c04:	75 da                	jne    1be0 <malloc+0xd0>
+  if(threaded)
+    1c06:	8b 15 04 41 00 00    	mov    0x4104,%edx
+    1c0c:	85 d2                	test   %edx,%edx
+    1c0e:	0f 85 b4 00 00 00    	jne    1cc8 <malloc+0x1b8>
+  tc->n[c] += moved;
+    1c14:	8b 57 20             	mov    0x20(%edi),%edx
+    1c17:	01 da                	add    %ebx,%edx
+    1c19:	89 57 20             	mov    %edx,0x20(%edi)
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1c1c:	85 db                	test   %ebx,%ebx
+    1c1e:	74 92                	je     1bb2 <malloc+0xa2>
+  p = tc->list[c];
+    1c20:	8b 07                	mov    (%edi),%eax
+    1c22:	e9 49 ff ff ff       	jmp    1b70 <malloc+0x60>
+    1c27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c2e:	66 90                	xchg   %ax,%ax
+    mutex_unlock(&lock);
+    1c30:	83 ec 0c             	sub    $0xc,%esp
+    1c33:	68 08 41 00 00       	push   $0x4108
+    1c38:	e8 e3 e8 ff ff       	call   520 <mutex_unlock>
+}
+    1c3d:	83 c4 10             	add    $0x10,%esp
+    1c40:	e9 66 ff ff ff       	jmp    1bab <malloc+0x9b>
+    1c45:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1c48:	83 ec 0c             	sub    $0xc,%esp
+    1c4b:	68 08 41 00 00       	push   $0x4108
+    1c50:	e8 7b e8 ff ff       	call   4d0 <mutex_lock>
+}
+    1c55:	83 c4 10             	add    $0x10,%esp
+    1c58:	e9 38 ff ff ff       	jmp    1b95 <malloc+0x85>
+    if((chunk = bigalloc(CHUNK / sizeof(Header) + 1)) == 0){
+    1c5d:	b8 01 02 00 00       	mov    $0x201,%eax
+    1c62:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1c65:	e8 46 fb ff ff       	call   17b0 <bigalloc>
+    1c6a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1c6d:	85 c0                	test   %eax,%eax
+    1c6f:	89 c2                	mov    %eax,%edx
+    1c71:	0f 84 ba 00 00 00    	je     1d31 <malloc+0x221>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1c77:	83 c2 08             	add    $0x8,%edx
+    1c7a:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+    1c80:	0f 87 d0 00 00 00    	ja     1d56 <malloc+0x246>
+    1c86:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+    1c8d:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    1c90:	89 df                	mov    %ebx,%edi
+    1c92:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1c95:	8d 76 00             	lea    0x0(%esi),%esi
+      p->s.size = units;
+    1c98:	89 72 04             	mov    %esi,0x4(%edx)
+      p->s.ptr = small[c];
+    1c9b:	8b 04 8d 60 41 00 00 	mov    0x4160(,%ecx,4),%eax
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1ca2:	01 df                	add    %ebx,%edi
+    1ca4:	89 55 e0             	mov    %edx,-0x20(%ebp)
+      p->s.ptr = small[c];
+    1ca7:	89 02                	mov    %eax,(%edx)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1ca9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      small[c] = p;
+    1cac:	89 14 8d 60 41 00 00 	mov    %edx,0x4160(,%ecx,4)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1cb3:	01 c2                	add    %eax,%edx
+    1cb5:	81 ff 00 02 00 00    	cmp    $0x200,%edi
+    1cbb:	76 db                	jbe    1c98 <malloc+0x188>
+    1cbd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1cc0:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1cc3:	e9 14 ff ff ff       	jmp    1bdc <malloc+0xcc>
+    mutex_unlock(&lock);
+    1cc8:	83 ec 0c             	sub    $0xc,%esp
+    1ccb:	68 08 41 00 00       	push   $0x4108
+    1cd0:	e8 4b e8 ff ff       	call   520 <mutex_unlock>
+}
+    1cd5:	83 c4 10             	add    $0x10,%esp
+    1cd8:	e9 37 ff ff ff       	jmp    1c14 <malloc+0x104>
+  if(threaded)
+    1cdd:	a1 04 41 00 00       	mov    0x4104,%eax
+    1ce2:	85 c0                	test   %eax,%eax
+    1ce4:	75 2b                	jne    1d11 <malloc+0x201>
+  tc->n[c] += moved;
+    1ce6:	8b 47 20             	mov    0x20(%edi),%eax
+    1ce9:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1cec:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1cee:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1cf1:	e9 7a fe ff ff       	jmp    1b70 <malloc+0x60>
+    mutex_lock(&lock);
+    1cf6:	83 ec 0c             	sub    $0xc,%esp
+    1cf9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1cfc:	68 08 41 00 00       	push   $0x4108
+    1d01:	e8 ca e7 ff ff       	call   4d0 <mutex_lock>
+}
+    1d06:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1d09:	83 c4 10             	add    $0x10,%esp
+    1d0c:	e9 bc fe ff ff       	jmp    1bcd <malloc+0xbd>
+    mutex_unlock(&lock);
+    1d11:	83 ec 0c             	sub    $0xc,%esp
+    1d14:	68 08 41 00 00       	push   $0x4108
+    1d19:	e8 02 e8 ff ff       	call   520 <mutex_unlock>
+  tc->n[c] += moved;
+    1d1e:	8b 47 20             	mov    0x20(%edi),%eax
+    1d21:	83 c4 10             	add    $0x10,%esp
+    1d24:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1d27:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1d29:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1d2c:	e9 3f fe ff ff       	jmp    1b70 <malloc+0x60>
+  if(threaded)
+    1d31:	8b 0d 04 41 00 00    	mov    0x4104,%ecx
+    1d37:	85 c9                	test   %ecx,%ecx
+    1d39:	0f 84 73 fe ff ff    	je     1bb2 <malloc+0xa2>
+    mutex_unlock(&lock);
+    1d3f:	83 ec 0c             	sub    $0xc,%esp
+    1d42:	68 08 41 00 00       	push   $0x4108
+    1d47:	e8 d4 e7 ff ff       	call   520 <mutex_unlock>
+    1d4c:	83 c4 10             	add    $0x10,%esp
+    return p ? (void*)(p + 1) : 0;
+    1d4f:	31 c0                	xor    %eax,%eax
+    1d51:	e9 5e fe ff ff       	jmp    1bb4 <malloc+0xa4>
+  for(moved = 0; moved < n && small[c]; moved++){
+    1d56:	8b 04 8d 60 41 00 00 	mov    0x4160(,%ecx,4),%eax
+    1d5d:	e9 7a fe ff ff       	jmp    1bdc <malloc+0xcc>
+    1d62:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001d70 <malloc_threaded>:
+void
+malloc_threaded(void)
+{
+  uint sp;
+
+  if(threaded)
+    1d70:	a1 04 41 00 00       	mov    0x4104,%eax
+    1d75:	85 c0                	test   %eax,%eax
+    1d77:	74 07                	je     1d80 <malloc_threaded+0x10>
+    1d79:	c3                   	ret
+    1d7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+{
+    1d80:	55                   	push   %ebp
+    1d81:	89 e5                	mov    %esp,%ebp
+    1d83:	83 ec 24             	sub    $0x24,%esp
+    return;
+  mutex_init(&lock);
+    1d86:	68 08 41 00 00       	push   $0x4108
+    1d8b:	e8 30 e7 ff ff       	call   4c0 <mutex_init>
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1d90:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1d93:	83 c4 10             	add    $0x10,%esp
+  threaded = 1;
+    1d96:	c7 05 04 41 00 00 01 	movl   $0x1,0x4104
+    1d9d:	00 00 00 
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1da0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    1da5:	a3 00 41 00 00       	mov    %eax,0x4100
+}
+    1daa:	c9                   	leave
+    1dab:	c3                   	ret
+    1dac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001db0 <malloc_thread_exit>:
+
+// Called by thread_join() with the cache slot of a finished
+// thread: give its blocks, and the cache itself, back.
+void
+malloc_thread_exit(void **cachep)
+{
+    1db0:	55                   	push   %ebp
+    1db1:	89 e5                	mov    %esp,%ebp
+    1db3:	57                   	push   %edi
+    1db4:	56                   	push   %esi
+    1db5:	53                   	push   %ebx
+    1db6:	83 ec 0c             	sub    $0xc,%esp
+    1db9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct tcache *tc;
+  int c;
+
+  if((tc = *cachep) == 0)
+    1dbc:	8b 37                	mov    (%edi),%esi
+    1dbe:	85 f6                	test   %esi,%esi
+    1dc0:	74 41                	je     1e03 <malloc_thread_exit+0x53>
+    return;
+  for(c = 0; c < NCLASS; c++)
+    1dc2:	31 db                	xor    %ebx,%ebx
+    1dc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    drain(tc, c, tc->n[c]);
+    1dc8:	8b 4c 9e 20          	mov    0x20(%esi,%ebx,4),%ecx
+    1dcc:	89 da                	mov    %ebx,%edx
+    1dce:	89 f0                	mov    %esi,%eax
+  for(c = 0; c < NCLASS; c++)
+    1dd0:	83 c3 01             	add    $0x1,%ebx
+    drain(tc, c, tc->n[c]);
+    1dd3:	e8 c8 fa ff ff       	call   18a0 <drain>
+  for(c = 0; c < NCLASS; c++)
+    1dd8:	83 fb 08             	cmp    $0x8,%ebx
+    1ddb:	75 eb                	jne    1dc8 <malloc_thread_exit+0x18>
+  if(threaded)
+    1ddd:	8b 15 04 41 00 00    	mov    0x4104,%edx
+    1de3:	85 d2                	test   %edx,%edx
+    1de5:	75 29                	jne    1e10 <malloc_thread_exit+0x60>
+  acquire();
+  trim(bigfree((Header*)tc - 1));
+    1de7:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1dea:	e8 c1 f8 ff ff       	call   16b0 <bigfree>
+    1def:	e8 3c f9 ff ff       	call   1730 <trim>
+  if(threaded)
+    1df4:	a1 04 41 00 00       	mov    0x4104,%eax
+    1df9:	85 c0                	test   %eax,%eax
+    1dfb:	75 2b                	jne    1e28 <malloc_thread_exit+0x78>
+  release();
+  *cachep = 0;
+    1dfd:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+}
+    1e03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1e06:	5b                   	pop    %ebx
+    1e07:	5e                   	pop    %esi
+    1e08:	5f                   	pop    %edi
+    1e09:	5d                   	pop    %ebp
+    1e0a:	c3                   	ret
+    1e0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1e0f:	90                   	nop
+    mutex_lock(&lock);
+    1e10:	83 ec 0c             	sub    $0xc,%esp
+    1e13:	68 08 41 00 00       	push   $0x4108
+    1e18:	e8 b3 e6 ff ff       	call   4d0 <mutex_lock>
+}
+    1e1d:	83 c4 10             	add    $0x10,%esp
+    1e20:	eb c5                	jmp    1de7 <malloc_thread_exit+0x37>
+    1e22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1e28:	83 ec 0c             	sub    $0xc,%esp
+    1e2b:	68 08 41 00 00       	push   $0x4108
+    1e30:	e8 eb e6 ff ff       	call   520 <mutex_unlock>
+}
+    1e35:	83 c4 10             	add    $0x10,%esp
+    1e38:	eb c3                	jmp    1dfd <malloc_thread_exit+0x4d>
+    1e3a:	66 90                	xchg   %ax,%ax
+    1e3c:	66 90                	xchg   %ax,%ax
+    1e3e:	66 90                	xchg   %ax,%ax
+
+00001e40 <thread_create>:
+
+// Start fn(arg) in a new thread on a freshly allocated
+// page-aligned stack.  Returns the thread's pid.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1e40:	55                   	push   %ebp
+    1e41:	89 e5                	mov    %esp,%ebp
+    1e43:	53                   	push   %ebx
+    1e44:	83 ec 14             	sub    $0x14,%esp
+  char *mem, *stack;
+  int pid;
+
+  malloc_threaded();
+    1e47:	e8 24 ff ff ff       	call   1d70 <malloc_threaded>
+  stdio_threaded();
+    1e4c:	e8 cf ee ff ff       	call   d20 <stdio_threaded>
+  if((mem = malloc(2*PGSIZE)) == 0)
+    1e51:	83 ec 0c             	sub    $0xc,%esp
+    1e54:	68 00 20 00 00       	push   $0x2000
+    1e59:	e8 b2 fc ff ff       	call   1b10 <malloc>
+    1e5e:	83 c4 10             	add    $0x10,%esp
+    1e61:	85 c0                	test   %eax,%eax
+    1e63:	74 52                	je     1eb7 <thread_create+0x77>
+    1e65:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1e67:	8d 80 07 10 00 00    	lea    0x1007(%eax),%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+  ((char**)stack)[-2] = 0;
+  if((pid = clone(fn, arg, stack)) < 0)
+    1e6d:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1e70:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+    1e75:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  ((char**)stack)[-2] = 0;
+    1e78:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+  if((pid = clone(fn, arg, stack)) < 0)
+    1e7f:	50                   	push   %eax
+    1e80:	ff 75 0c             	push   0xc(%ebp)
+    1e83:	ff 75 08             	push   0x8(%ebp)
+    1e86:	e8 97 e8 ff ff       	call   722 <clone>
+    1e8b:	83 c4 10             	add    $0x10,%esp
+    1e8e:	85 c0                	test   %eax,%eax
+    1e90:	78 0e                	js     1ea0 <thread_create+0x60>
+    free(mem);
+  return pid;
+}
+    1e92:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1e95:	c9                   	leave
+    1e96:	c3                   	ret
+    1e97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e9e:	66 90                	xchg   %ax,%ax
+    free(mem);
+    1ea0:	83 ec 0c             	sub    $0xc,%esp
+    1ea3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1ea6:	53                   	push   %ebx
+    1ea7:	e8 34 fb ff ff       	call   19e0 <free>
+    1eac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1eaf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    1eb2:	83 c4 10             	add    $0x10,%esp
+}
+    1eb5:	c9                   	leave
+    1eb6:	c3                   	ret
+    return -1;
+    1eb7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1ebc:	eb d4                	jmp    1e92 <thread_create+0x52>
+    1ebe:	66 90                	xchg   %ax,%ax
+
+00001ec0 <thread_join>:
+
+// Wait for a thread to finish and free its stack.
+int
+thread_join(void)
+{
+    1ec0:	55                   	push   %ebp
+    1ec1:	89 e5                	mov    %esp,%ebp
+    1ec3:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    1ec4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    1ec7:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    1eca:	50                   	push   %eax
+    1ecb:	e8 61 e8 ff ff       	call   731 <join>
+    1ed0:	83 c4 10             	add    $0x10,%esp
+    1ed3:	85 c0                	test   %eax,%eax
+    1ed5:	78 29                	js     1f00 <thread_join+0x40>
+    1ed7:	89 c3                	mov    %eax,%ebx
+    return -1;
+  malloc_thread_exit(&((void**)stack)[-2]);
+    1ed9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1edc:	83 ec 0c             	sub    $0xc,%esp
+    1edf:	83 e8 08             	sub    $0x8,%eax
+    1ee2:	50                   	push   %eax
+    1ee3:	e8 c8 fe ff ff       	call   1db0 <malloc_thread_exit>
+  free(((char**)stack)[-1]);
+    1ee8:	58                   	pop    %eax
+    1ee9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1eec:	ff 70 fc             	push   -0x4(%eax)
+    1eef:	e8 ec fa ff ff       	call   19e0 <free>
+  return pid;
+    1ef4:	83 c4 10             	add    $0x10,%esp
+}
+    1ef7:	89 d8                	mov    %ebx,%eax
+    1ef9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1efc:	c9                   	leave
+    1efd:	c3                   	ret
+    1efe:	66 90                	xchg   %ax,%ax
+    return -1;
+    1f00:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    1f05:	eb f0                	jmp    1ef7 <thread_join+0x37>
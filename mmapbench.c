@@ -0,0 +1,83 @@
+// Scan a file with read() and with mmap().
+// Creates a file of SIZE bytes, then sums its bytes ROUNDS times,
+// once copying it through a buffer with read() and once touching
+// the pages of a MAP_PRIVATE mapping directly.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "mmap.h"
+
+#define SIZE   (256*1024)
+#define ROUNDS 20
+
+char buf[4096];
+
+int
+scanread(void)
+{
+  int fd, n, i, r, t0;
+  uint sum;
+
+  sum = 0;
+  t0 = uptime();
+  for(r = 0; r < ROUNDS; r++){
+    fd = open("mmapbench.tmp", O_RDONLY);
+    while((n = read(fd, buf, sizeof(buf))) > 0)
+      for(i = 0; i < n; i++)
+        sum += (uchar)buf[i];
+    close(fd);
+  }
+  if(sum != ROUNDS * (SIZE / 256) * (255*256/2))
+    printf(2, "mmapbench: read sum %d wrong\n", sum);
+  return uptime() - t0;
+}
+
+int
+scanmmap(void)
+{
+  int fd, i, r, t0;
+  uint sum;
+  uchar *p;
+
+  sum = 0;
+  t0 = uptime();
+  for(r = 0; r < ROUNDS; r++){
+    fd = open("mmapbench.tmp", O_RDONLY);
+    p = mmap(0, SIZE, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(p == (uchar*)-1){
+      printf(2, "mmapbench: mmap failed\n");
+      exit();
+    }
+    for(i = 0; i < SIZE; i++)
+      sum += p[i];
+    munmap(p, SIZE);
+  }
+  if(sum != ROUNDS * (SIZE / 256) * (255*256/2))
+    printf(2, "mmapbench: mmap sum %d wrong\n", sum);
+  return uptime() - t0;
+}
+
+int
+main(void)
+{
+  int fd, i;
+
+  for(i = 0; i < sizeof(buf); i++)
+    buf[i] = i;
+  fd = open("mmapbench.tmp", O_CREATE|O_WRONLY);
+  for(i = 0; i < SIZE; i += sizeof(buf))
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+      printf(2, "mmapbench: write failed\n");
+      exit();
+    }
+  close(fd);
+
+  printf(1, "mmapbench: %d KB x %d\n", SIZE / 1024, ROUNDS);
+  printf(1, "read: %d ticks\n", scanread());
+  printf(1, "mmap: %d ticks\n", scanmmap());
+  unlink("mmapbench.tmp");
+  exit();
+}
@@ -6,14 +6,22 @@
 // FL_IF代表着CPU的中断使能标志，
 // 如果这个标志被设置为1，则表示CPU允许中断事件发生；反之，如果被设置为0，则表示CPU禁止中断事件发生，不会响应任何中断请求。
 // 因此，在使用中断的系统中，程序需要根据具体情况来设置FL_IF标志，以便控制和管理中断的发生和响应。
+#define FL_TF           0x00000100      // Trap Flag
 #define FL_IF           0x00000200      // Interrupt Enable
 
 // Control Register flags
 #define CR0_PE          0x00000001      // Protection Enable
+#define CR0_MP          0x00000002      // Monitor coProcessor
+#define CR0_EM          0x00000004      // Emulation
+#define CR0_TS          0x00000008      // Task Switched
+#define CR0_NE          0x00000020      // Numeric Error
 #define CR0_WP          0x00010000      // Write Protect
 #define CR0_PG          0x80000000      // Paging
 
 #define CR4_PSE         0x00000010      // Page size extension
+#define CR4_PGE         0x00000080      // Page global enable
+#define CR4_OSFXSR      0x00000200      // OS supports FXSAVE/FXRSTOR
+#define CR4_OSXMMEXCPT  0x00000400      // OS handles SIMD exceptions
 
 // various segment selectors.
 #define SEG_KCODE 1  // kernel code
@@ -98,19 +106,31 @@ struct segdesc {
 #define PGROUNDUP(sz)  (((sz)+PGSIZE-1) & ~(PGSIZE-1))
 #define PGROUNDDOWN(a) (((a)) & ~(PGSIZE-1))//将参数a向下舍入到最接近的页面边界
 
+#define HPGSIZE         (PGSIZE*NPTENTRIES)  // bytes mapped by a PTE_PS page
+#define HPGROUNDUP(sz)  (((sz)+HPGSIZE-1) & ~(HPGSIZE-1))
+#define HPGROUNDDOWN(a) (((a)) & ~(HPGSIZE-1))
+
 // Page table/directory entry flags.
 #define PTE_P           0x001   // Present
 #define PTE_W           0x002   // Writeable
 #define PTE_U           0x004   // User
+#define PTE_A           0x020   // Accessed
+#define PTE_D           0x040   // Dirty
 #define PTE_PS          0x080   // Page Size
+#define PTE_G           0x100   // Global: kept in the TLB across CR3 loads
+#define PTE_SWAP        0x200   // Software: page swapped out to slot PTE_ADDR/PGSIZE
+#define PTE_SHARED      0x400   // Software: page not owned by this page table
 
 // Address in page table or page directory entry
 #define PTE_ADDR(pte)   ((uint)(pte) & ~0xFFF)//它的作用是从页表项中提取出物理页帧地址
 #define PTE_FLAGS(pte)  ((uint)(pte) &  0xFFF)
 
-#ifndef __ASSEMBLER__
-typedef uint pte_t;
+// Page fault error code bits
+#define FEC_PR          0x1     // Page-level protection violation
+#define FEC_WR          0x2     // Fault caused by a write
+#define FEC_U           0x4     // Fault occurred in user mode
 
+#ifndef __ASSEMBLER__
 // Task state segment format
 struct taskstate {
     uint link;         // Old ts selector
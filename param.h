@@ -2,13 +2,17 @@
 #define KSTACKSIZE 4096  // size of per-process kernel stack
 #define NCPU          8  // maximum number of CPUs
 #define NOFILE       16  // open files per process
-#define NFILE       100  // open files per system
-#define NINODE       50  // maximum number of active i-nodes
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
 #define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
 #define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
-#define FSSIZE       1000  // size of file system in blocks
+#define FSSIZE       2000  // size of file system in blocks
+#define NSWAP        4096  // swap slots (pages) after the file system
+#define SWAPBLOCKS   (NSWAP*8)  // size of swap area in blocks
+#define PIPEPAGES     1  // pages of buffer per pipe
+#define NHUGEPG       4  // idle 4MB pages kept for hsbrk()
+#define NVMA          8  // mmap() regions per process
+#define NINODE       50  // unreferenced inodes kept cached
 
@@ -0,0 +1,4078 @@
+
+_pingpong:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+#define ROUNDS 20000
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	be 20 4e 00 00       	mov    $0x4e20,%esi
+      14:	53                   	push   %ebx
+      15:	51                   	push   %ecx
+      16:	83 ec 38             	sub    $0x38,%esp
+  int ping[2], pong[2], i, rounds, t0, t1;
+  char c;
+
+  rounds = ROUNDS;
+  if(argc > 1)
+      19:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+      1c:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc > 1)
+      1f:	7e 10                	jle    31 <main+0x31>
+    rounds = atoi(argv[1]);
+      21:	83 ec 0c             	sub    $0xc,%esp
+      24:	ff 70 04             	push   0x4(%eax)
+      27:	e8 f4 02 00 00       	call   320 <atoi>
+      2c:	83 c4 10             	add    $0x10,%esp
+      2f:	89 c6                	mov    %eax,%esi
+
+  if(pipe(ping) < 0 || pipe(pong) < 0){
+      31:	83 ec 0c             	sub    $0xc,%esp
+      34:	8d 45 d8             	lea    -0x28(%ebp),%eax
+      37:	50                   	push   %eax
+      38:	e8 b6 04 00 00       	call   4f3 <pipe>
+      3d:	83 c4 10             	add    $0x10,%esp
+      40:	85 c0                	test   %eax,%eax
+      42:	78 13                	js     57 <main+0x57>
+      44:	83 ec 0c             	sub    $0xc,%esp
+      47:	8d 45 e0             	lea    -0x20(%ebp),%eax
+      4a:	50                   	push   %eax
+      4b:	e8 a3 04 00 00       	call   4f3 <pipe>
+      50:	83 c4 10             	add    $0x10,%esp
+      53:	85 c0                	test   %eax,%eax
+      55:	79 14                	jns    6b <main+0x6b>
+    printf(2, "pingpong: pipe failed\n");
+      57:	83 ec 08             	sub    $0x8,%esp
+      5a:	68 d8 1d 00 00       	push   $0x1dd8
+      5f:	6a 02                	push   $0x2
+      61:	e8 ea 08 00 00       	call   950 <printf>
+    exit();
+      66:	e8 25 01 00 00       	call   190 <exit>
+  }
+  if(fork() == 0){
+      6b:	e8 c0 00 00 00       	call   130 <fork>
+      70:	89 c3                	mov    %eax,%ebx
+      72:	85 c0                	test   %eax,%eax
+      74:	75 3d                	jne    b3 <main+0xb3>
+    for(i = 0; i < rounds; i++){
+      76:	85 f6                	test   %esi,%esi
+      78:	7e 34                	jle    ae <main+0xae>
+      7a:	8d 7d d7             	lea    -0x29(%ebp),%edi
+      7d:	eb 19                	jmp    98 <main+0x98>
+      7f:	90                   	nop
+      if(read(ping[0], &c, 1) != 1)
+        break;
+      write(pong[1], &c, 1);
+      80:	83 ec 04             	sub    $0x4,%esp
+    for(i = 0; i < rounds; i++){
+      83:	83 c3 01             	add    $0x1,%ebx
+      write(pong[1], &c, 1);
+      86:	6a 01                	push   $0x1
+      88:	57                   	push   %edi
+      89:	ff 75 e4             	push   -0x1c(%ebp)
+      8c:	e8 80 04 00 00       	call   511 <write>
+    for(i = 0; i < rounds; i++){
+      91:	83 c4 10             	add    $0x10,%esp
+      94:	39 de                	cmp    %ebx,%esi
+      96:	74 16                	je     ae <main+0xae>
+      if(read(ping[0], &c, 1) != 1)
+      98:	83 ec 04             	sub    $0x4,%esp
+      9b:	6a 01                	push   $0x1
+      9d:	57                   	push   %edi
+      9e:	ff 75 d8             	push   -0x28(%ebp)
+      a1:	e8 5c 04 00 00       	call   502 <read>
+      a6:	83 c4 10             	add    $0x10,%esp
+      a9:	83 f8 01             	cmp    $0x1,%eax
+      ac:	74 d2                	je     80 <main+0x80>
+    }
+    exit();
+      ae:	e8 dd 00 00 00       	call   190 <exit>
+  }
+
+  c = 'x';
+      b3:	c6 45 d7 78          	movb   $0x78,-0x29(%ebp)
+  t0 = uptime();
+      b7:	e8 04 04 00 00       	call   4c0 <uptime>
+      bc:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  for(i = 0; i < rounds; i++){
+      bf:	85 f6                	test   %esi,%esi
+      c1:	7e 49                	jle    10c <main+0x10c>
+      c3:	31 db                	xor    %ebx,%ebx
+      c5:	8d 7d d7             	lea    -0x29(%ebp),%edi
+      c8:	eb 0d                	jmp    d7 <main+0xd7>
+      ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      d0:	83 c3 01             	add    $0x1,%ebx
+      d3:	39 de                	cmp    %ebx,%esi
+      d5:	74 35                	je     10c <main+0x10c>
+    write(ping[1], &c, 1);
+      d7:	83 ec 04             	sub    $0x4,%esp
+      da:	6a 01                	push   $0x1
+      dc:	57                   	push   %edi
+      dd:	ff 75 dc             	push   -0x24(%ebp)
+      e0:	e8 2c 04 00 00       	call   511 <write>
+    if(read(pong[0], &c, 1) != 1){
+      e5:	83 c4 0c             	add    $0xc,%esp
+      e8:	6a 01                	push   $0x1
+      ea:	57                   	push   %edi
+      eb:	ff 75 e0             	push   -0x20(%ebp)
+      ee:	e8 0f 04 00 00       	call   502 <read>
+      f3:	83 c4 10             	add    $0x10,%esp
+      f6:	83 f8 01             	cmp    $0x1,%eax
+      f9:	74 d5                	je     d0 <main+0xd0>
+      printf(2, "pingpong: read failed\n");
+      fb:	50                   	push   %eax
+      fc:	50                   	push   %eax
+      fd:	68 ef 1d 00 00       	push   $0x1def
+     102:	6a 02                	push   $0x2
+     104:	e8 47 08 00 00       	call   950 <printf>
+      break;
+     109:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+  t1 = uptime();
+     10c:	e8 af 03 00 00       	call   4c0 <uptime>
+     111:	89 c7                	mov    %eax,%edi
+  wait();
+     113:	e8 cc 03 00 00       	call   4e4 <wait>
+
+  printf(1, "pingpong: %d round trips, %d ticks\n", rounds, t1 - t0);
+     118:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     11b:	29 c7                	sub    %eax,%edi
+     11d:	57                   	push   %edi
+     11e:	56                   	push   %esi
+     11f:	68 08 1e 00 00       	push   $0x1e08
+     124:	6a 01                	push   $0x1
+     126:	e8 25 08 00 00       	call   950 <printf>
+  exit();
+     12b:	e8 60 00 00 00       	call   190 <exit>
+
+00000130 <fork>:
+int sysexit(void) __attribute__((noreturn));
+
+int
+fork(void)
+{
+  if(flushhook)
+     130:	a1 e0 28 00 00       	mov    0x28e0,%eax
+     135:	85 c0                	test   %eax,%eax
+     137:	74 17                	je     150 <fork+0x20>
+{
+     139:	55                   	push   %ebp
+     13a:	89 e5                	mov    %esp,%ebp
+     13c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     13f:	ff d0                	call   *%eax
+  return sysfork();
+}
+     141:	c9                   	leave
+  return sysfork();
+     142:	e9 7f 03 00 00       	jmp    4c6 <sysfork>
+     147:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     14e:	66 90                	xchg   %ax,%ax
+     150:	e9 71 03 00 00       	jmp    4c6 <sysfork>
+     155:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     15c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000160 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+     160:	55                   	push   %ebp
+  if(flushhook)
+     161:	a1 e0 28 00 00       	mov    0x28e0,%eax
+{
+     166:	89 e5                	mov    %esp,%ebp
+     168:	56                   	push   %esi
+     169:	53                   	push   %ebx
+     16a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     16d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     170:	85 c0                	test   %eax,%eax
+     172:	74 02                	je     176 <exec+0x16>
+    flushhook();
+     174:	ff d0                	call   *%eax
+  return sysexec(path, argv);
+     176:	89 75 0c             	mov    %esi,0xc(%ebp)
+     179:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     17c:	5b                   	pop    %ebx
+     17d:	5e                   	pop    %esi
+     17e:	5d                   	pop    %ebp
+  return sysexec(path, argv);
+     17f:	e9 ba 03 00 00       	jmp    53e <sysexec>
+     184:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     18b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     18f:	90                   	nop
+
+00000190 <exit>:
+
+int
+exit(void)
+{
+     190:	55                   	push   %ebp
+     191:	89 e5                	mov    %esp,%ebp
+     193:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     196:	a1 e0 28 00 00       	mov    0x28e0,%eax
+     19b:	85 c0                	test   %eax,%eax
+     19d:	74 02                	je     1a1 <exit+0x11>
+    flushhook();
+     19f:	ff d0                	call   *%eax
+  sysexit();
+     1a1:	e8 2f 03 00 00       	call   4d5 <sysexit>
+     1a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001b0 <strcpy>:
+}
+
+char*
+strcpy(char *s, const char *t)
+{
+     1b0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     1b1:	31 c0                	xor    %eax,%eax
+{
+     1b3:	89 e5                	mov    %esp,%ebp
+     1b5:	53                   	push   %ebx
+     1b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     1b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     1bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     1c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     1c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     1c7:	83 c0 01             	add    $0x1,%eax
+     1ca:	84 d2                	test   %dl,%dl
+     1cc:	75 f2                	jne    1c0 <strcpy+0x10>
+    ;
+  return os;
+}
+     1ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1d1:	89 c8                	mov    %ecx,%eax
+     1d3:	c9                   	leave
+     1d4:	c3                   	ret
+     1d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     1e0:	55                   	push   %ebp
+     1e1:	89 e5                	mov    %esp,%ebp
+     1e3:	53                   	push   %ebx
+     1e4:	8b 55 08             	mov    0x8(%ebp),%edx
+     1e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     1ea:	0f b6 02             	movzbl (%edx),%eax
+     1ed:	84 c0                	test   %al,%al
+     1ef:	75 17                	jne    208 <strcmp+0x28>
+     1f1:	eb 3a                	jmp    22d <strcmp+0x4d>
+     1f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1f7:	90                   	nop
+     1f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     1fc:	83 c2 01             	add    $0x1,%edx
+     1ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     202:	84 c0                	test   %al,%al
+     204:	74 1a                	je     220 <strcmp+0x40>
+    p++, q++;
+     206:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     208:	0f b6 19             	movzbl (%ecx),%ebx
+     20b:	38 c3                	cmp    %al,%bl
+     20d:	74 e9                	je     1f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     20f:	29 d8                	sub    %ebx,%eax
+}
+     211:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     214:	c9                   	leave
+     215:	c3                   	ret
+     216:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     21d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     220:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     224:	31 c0                	xor    %eax,%eax
+     226:	29 d8                	sub    %ebx,%eax
+}
+     228:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     22b:	c9                   	leave
+     22c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     22d:	0f b6 19             	movzbl (%ecx),%ebx
+     230:	31 c0                	xor    %eax,%eax
+     232:	eb db                	jmp    20f <strcmp+0x2f>
+     234:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     23b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     23f:	90                   	nop
+
+00000240 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     240:	55                   	push   %ebp
+     241:	89 e5                	mov    %esp,%ebp
+     243:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     246:	80 3a 00             	cmpb   $0x0,(%edx)
+     249:	74 15                	je     260 <strlen+0x20>
+     24b:	31 c0                	xor    %eax,%eax
+     24d:	8d 76 00             	lea    0x0(%esi),%esi
+     250:	83 c0 01             	add    $0x1,%eax
+     253:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     257:	89 c1                	mov    %eax,%ecx
+     259:	75 f5                	jne    250 <strlen+0x10>
+    ;
+  return n;
+}
+     25b:	89 c8                	mov    %ecx,%eax
+     25d:	5d                   	pop    %ebp
+     25e:	c3                   	ret
+     25f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     260:	31 c9                	xor    %ecx,%ecx
+}
+     262:	5d                   	pop    %ebp
+     263:	89 c8                	mov    %ecx,%eax
+     265:	c3                   	ret
+     266:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     26d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000270 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     270:	55                   	push   %ebp
+     271:	89 e5                	mov    %esp,%ebp
+     273:	57                   	push   %edi
+     274:	8b 55 08             	mov    0x8(%ebp),%edx
+            "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt) {
+    asm volatile("cld; rep stosb" :
+     277:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     27a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     27d:	89 d7                	mov    %edx,%edi
+     27f:	fc                   	cld
+     280:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     282:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     285:	89 d0                	mov    %edx,%eax
+     287:	c9                   	leave
+     288:	c3                   	ret
+     289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     290:	55                   	push   %ebp
+     291:	89 e5                	mov    %esp,%ebp
+     293:	8b 45 08             	mov    0x8(%ebp),%eax
+     296:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     29a:	0f b6 10             	movzbl (%eax),%edx
+     29d:	84 d2                	test   %dl,%dl
+     29f:	75 12                	jne    2b3 <strchr+0x23>
+     2a1:	eb 1d                	jmp    2c0 <strchr+0x30>
+     2a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2a7:	90                   	nop
+     2a8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     2ac:	83 c0 01             	add    $0x1,%eax
+     2af:	84 d2                	test   %dl,%dl
+     2b1:	74 0d                	je     2c0 <strchr+0x30>
+    if(*s == c)
+     2b3:	38 d1                	cmp    %dl,%cl
+     2b5:	75 f1                	jne    2a8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     2b7:	5d                   	pop    %ebp
+     2b8:	c3                   	ret
+     2b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     2c0:	31 c0                	xor    %eax,%eax
+}
+     2c2:	5d                   	pop    %ebp
+     2c3:	c3                   	ret
+     2c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2cf:	90                   	nop
+
+000002d0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     2d0:	55                   	push   %ebp
+     2d1:	89 e5                	mov    %esp,%ebp
+     2d3:	56                   	push   %esi
+     2d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     2d5:	83 ec 08             	sub    $0x8,%esp
+     2d8:	6a 00                	push   $0x0
+     2da:	ff 75 08             	push   0x8(%ebp)
+     2dd:	e8 6b 02 00 00       	call   54d <open>
+  if(fd < 0)
+     2e2:	83 c4 10             	add    $0x10,%esp
+     2e5:	85 c0                	test   %eax,%eax
+     2e7:	78 27                	js     310 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     2e9:	83 ec 08             	sub    $0x8,%esp
+     2ec:	ff 75 0c             	push   0xc(%ebp)
+     2ef:	89 c3                	mov    %eax,%ebx
+     2f1:	50                   	push   %eax
+     2f2:	e8 83 02 00 00       	call   57a <fstat>
+  close(fd);
+     2f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     2fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+     2fc:	e8 1f 02 00 00       	call   520 <close>
+  return r;
+     301:	83 c4 10             	add    $0x10,%esp
+}
+     304:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     307:	89 f0                	mov    %esi,%eax
+     309:	5b                   	pop    %ebx
+     30a:	5e                   	pop    %esi
+     30b:	5d                   	pop    %ebp
+     30c:	c3                   	ret
+     30d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     310:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     315:	eb ed                	jmp    304 <stat+0x34>
+     317:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     31e:	66 90                	xchg   %ax,%ax
+
+00000320 <atoi>:
+
+int
+atoi(const char *s)
+{
+     320:	55                   	push   %ebp
+     321:	89 e5                	mov    %esp,%ebp
+     323:	53                   	push   %ebx
+     324:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     327:	0f be 02             	movsbl (%edx),%eax
+     32a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     32d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     330:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     335:	77 1e                	ja     355 <atoi+0x35>
+     337:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     33e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     340:	83 c2 01             	add    $0x1,%edx
+     343:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     346:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     34a:	0f be 02             	movsbl (%edx),%eax
+     34d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     350:	80 fb 09             	cmp    $0x9,%bl
+     353:	76 eb                	jbe    340 <atoi+0x20>
+  return n;
+}
+     355:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     358:	89 c8                	mov    %ecx,%eax
+     35a:	c9                   	leave
+     35b:	c3                   	ret
+     35c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000360 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     360:	55                   	push   %ebp
+     361:	89 e5                	mov    %esp,%ebp
+     363:	57                   	push   %edi
+     364:	56                   	push   %esi
+     365:	8b 45 10             	mov    0x10(%ebp),%eax
+     368:	8b 55 08             	mov    0x8(%ebp),%edx
+     36b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     36e:	85 c0                	test   %eax,%eax
+     370:	7e 13                	jle    385 <memmove+0x25>
+     372:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     374:	89 d7                	mov    %edx,%edi
+     376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     37d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     380:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     381:	39 f8                	cmp    %edi,%eax
+     383:	75 fb                	jne    380 <memmove+0x20>
+  return vdst;
+}
+     385:	5e                   	pop    %esi
+     386:	89 d0                	mov    %edx,%eax
+     388:	5f                   	pop    %edi
+     389:	5d                   	pop    %ebp
+     38a:	c3                   	ret
+     38b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     38f:	90                   	nop
+
+00000390 <mutex_init>:
+
+// Futex-based mutex (Drepper, "Futexes Are Tricky", mutex 2).
+// The uncontended paths never enter the kernel.
+void
+mutex_init(struct mutex *m)
+{
+     390:	55                   	push   %ebp
+     391:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+     393:	8b 45 08             	mov    0x8(%ebp),%eax
+     396:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     39c:	5d                   	pop    %ebp
+     39d:	c3                   	ret
+     39e:	66 90                	xchg   %ax,%ax
+
+000003a0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     3a0:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     3a1:	31 c0                	xor    %eax,%eax
+     3a3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+     3a8:	89 e5                	mov    %esp,%ebp
+     3aa:	56                   	push   %esi
+     3ab:	53                   	push   %ebx
+     3ac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     3af:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     3b3:	85 c0                	test   %eax,%eax
+     3b5:	74 32                	je     3e9 <mutex_lock+0x49>
+    return;
+  if(c != 2)
+     3b7:	83 f8 02             	cmp    $0x2,%eax
+     3ba:	74 0c                	je     3c8 <mutex_lock+0x28>
+static inline uint
+xchg(volatile uint *addr, uint newval) {
+    uint result;
+
+    // The + in "+m" denotes a read-modify-write operand.
+    asm volatile("lock; xchgl %0, %1" :
+     3bc:	b8 02 00 00 00       	mov    $0x2,%eax
+     3c1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+     3c4:	85 c0                	test   %eax,%eax
+     3c6:	74 21                	je     3e9 <mutex_lock+0x49>
+     3c8:	be 02 00 00 00       	mov    $0x2,%esi
+     3cd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAIT, 2);
+     3d0:	83 ec 04             	sub    $0x4,%esp
+     3d3:	6a 02                	push   $0x2
+     3d5:	6a 00                	push   $0x0
+     3d7:	53                   	push   %ebx
+     3d8:	e8 33 02 00 00       	call   610 <futex>
+     3dd:	89 f0                	mov    %esi,%eax
+     3df:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     3e2:	83 c4 10             	add    $0x10,%esp
+     3e5:	85 c0                	test   %eax,%eax
+     3e7:	75 e7                	jne    3d0 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+     3e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     3ec:	5b                   	pop    %ebx
+     3ed:	5e                   	pop    %esi
+     3ee:	5d                   	pop    %ebp
+     3ef:	c3                   	ret
+
+000003f0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     3f0:	55                   	push   %ebp
+     3f1:	89 e5                	mov    %esp,%ebp
+     3f3:	83 ec 08             	sub    $0x8,%esp
+     3f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     3f9:	f0 83 28 01          	lock subl $0x1,(%eax)
+     3fd:	75 09                	jne    408 <mutex_unlock+0x18>
+    m->val = 0;
+    futex(&m->val, FUTEX_WAKE, 1);
+  }
+}
+     3ff:	c9                   	leave
+     400:	c3                   	ret
+     401:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     408:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     40b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex(&m->val, FUTEX_WAKE, 1);
+     411:	6a 01                	push   $0x1
+     413:	6a 01                	push   $0x1
+     415:	50                   	push   %eax
+     416:	e8 f5 01 00 00       	call   610 <futex>
+     41b:	83 c4 10             	add    $0x10,%esp
+}
+     41e:	c9                   	leave
+     41f:	c3                   	ret
+
+00000420 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     420:	55                   	push   %ebp
+     421:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     423:	8b 45 08             	mov    0x8(%ebp),%eax
+     426:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     42c:	5d                   	pop    %ebp
+     42d:	c3                   	ret
+     42e:	66 90                	xchg   %ax,%ax
+
+00000430 <cond_wait>:
+
+// Release m and wait for a signal, then reacquire m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     430:	55                   	push   %ebp
+     431:	89 e5                	mov    %esp,%ebp
+     433:	57                   	push   %edi
+     434:	56                   	push   %esi
+     435:	53                   	push   %ebx
+     436:	83 ec 0c             	sub    $0xc,%esp
+     439:	8b 75 08             	mov    0x8(%ebp),%esi
+     43c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     43f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     441:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+     445:	75 21                	jne    468 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     447:	83 ec 04             	sub    $0x4,%esp
+     44a:	57                   	push   %edi
+     44b:	6a 00                	push   $0x0
+     44d:	56                   	push   %esi
+     44e:	e8 bd 01 00 00       	call   610 <futex>
+  mutex_lock(m);
+     453:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     456:	83 c4 10             	add    $0x10,%esp
+}
+     459:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     45c:	5b                   	pop    %ebx
+     45d:	5e                   	pop    %esi
+     45e:	5f                   	pop    %edi
+     45f:	5d                   	pop    %ebp
+  mutex_lock(m);
+     460:	e9 3b ff ff ff       	jmp    3a0 <mutex_lock>
+     465:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     468:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     46b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex(&m->val, FUTEX_WAKE, 1);
+     471:	6a 01                	push   $0x1
+     473:	6a 01                	push   $0x1
+     475:	53                   	push   %ebx
+     476:	e8 95 01 00 00       	call   610 <futex>
+     47b:	83 c4 10             	add    $0x10,%esp
+     47e:	eb c7                	jmp    447 <cond_wait+0x17>
+
+00000480 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+     480:	55                   	push   %ebp
+     481:	89 e5                	mov    %esp,%ebp
+     483:	83 ec 0c             	sub    $0xc,%esp
+     486:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     489:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+     48d:	6a 01                	push   $0x1
+     48f:	6a 01                	push   $0x1
+     491:	50                   	push   %eax
+     492:	e8 79 01 00 00       	call   610 <futex>
+}
+     497:	83 c4 10             	add    $0x10,%esp
+     49a:	c9                   	leave
+     49b:	c3                   	ret
+     49c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004a0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     4a0:	55                   	push   %ebp
+     4a1:	89 e5                	mov    %esp,%ebp
+     4a3:	83 ec 0c             	sub    $0xc,%esp
+     4a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     4a9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+     4ad:	6a 40                	push   $0x40
+     4af:	6a 01                	push   $0x1
+     4b1:	50                   	push   %eax
+     4b2:	e8 59 01 00 00       	call   610 <futex>
+}
+     4b7:	83 c4 10             	add    $0x10,%esp
+     4ba:	c9                   	leave
+     4bb:	c3                   	ret
+     4bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <uptime>:
+// Clock ticks since boot, read from the kernel's vdso page
+// without a system call.
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     4c0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+     4c5:	c3                   	ret
+
+000004c6 <sysfork>:
+  1: ret
+
+#define SYSCALL(name) SYSCALLAS(name, name)
+
+// ulib.c wraps these.
+SYSCALLAS(sysfork, fork)
+     4c6:	b8 01 00 00 00       	mov    $0x1,%eax
+     4cb:	89 e1                	mov    %esp,%ecx
+     4cd:	ba d4 04 00 00       	mov    $0x4d4,%edx
+     4d2:	0f 34                	sysenter
+     4d4:	c3                   	ret
+
+000004d5 <sysexit>:
+SYSCALLAS(sysexit, exit)
+     4d5:	b8 02 00 00 00       	mov    $0x2,%eax
+     4da:	89 e1                	mov    %esp,%ecx
+     4dc:	ba e3 04 00 00       	mov    $0x4e3,%edx
+     4e1:	0f 34                	sysenter
+     4e3:	c3                   	ret
+
+000004e4 <wait>:
+SYSCALL(wait)
+     4e4:	b8 03 00 00 00       	mov    $0x3,%eax
+     4e9:	89 e1                	mov    %esp,%ecx
+     4eb:	ba f2 04 00 00       	mov    $0x4f2,%edx
+     4f0:	0f 34                	sysenter
+     4f2:	c3                   	ret
+
+000004f3 <pipe>:
+SYSCALL(pipe)
+     4f3:	b8 04 00 00 00       	mov    $0x4,%eax
+     4f8:	89 e1                	mov    %esp,%ecx
+     4fa:	ba 01 05 00 00       	mov    $0x501,%edx
+     4ff:	0f 34                	sysenter
+     501:	c3                   	ret
+
+00000502 <read>:
+SYSCALL(read)
+     502:	b8 05 00 00 00       	mov    $0x5,%eax
+     507:	89 e1                	mov    %esp,%ecx
+     509:	ba 10 05 00 00       	mov    $0x510,%edx
+     50e:	0f 34                	sysenter
+     510:	c3                   	ret
+
+00000511 <write>:
+SYSCALL(write)
+     511:	b8 10 00 00 00       	mov    $0x10,%eax
+     516:	89 e1                	mov    %esp,%ecx
+     518:	ba 1f 05 00 00       	mov    $0x51f,%edx
+     51d:	0f 34                	sysenter
+     51f:	c3                   	ret
+
+00000520 <close>:
+SYSCALL(close)
+     520:	b8 15 00 00 00       	mov    $0x15,%eax
+     525:	89 e1                	mov    %esp,%ecx
+     527:	ba 2e 05 00 00       	mov    $0x52e,%edx
+     52c:	0f 34                	sysenter
+     52e:	c3                   	ret
+
+0000052f <kill>:
+SYSCALL(kill)
+     52f:	b8 06 00 00 00       	mov    $0x6,%eax
+     534:	89 e1                	mov    %esp,%ecx
+     536:	ba 3d 05 00 00       	mov    $0x53d,%edx
+     53b:	0f 34                	sysenter
+     53d:	c3                   	ret
+
+0000053e <sysexec>:
+SYSCALLAS(sysexec, exec)
+     53e:	b8 07 00 00 00       	mov    $0x7,%eax
+     543:	89 e1                	mov    %esp,%ecx
+     545:	ba 4c 05 00 00       	mov    $0x54c,%edx
+     54a:	0f 34                	sysenter
+     54c:	c3                   	ret
+
+0000054d <open>:
+SYSCALL(open)
+     54d:	b8 0f 00 00 00       	mov    $0xf,%eax
+     552:	89 e1                	mov    %esp,%ecx
+     554:	ba 5b 05 00 00       	mov    $0x55b,%edx
+     559:	0f 34                	sysenter
+     55b:	c3                   	ret
+
+0000055c <mknod>:
+SYSCALL(mknod)
+     55c:	b8 11 00 00 00       	mov    $0x11,%eax
+     561:	89 e1                	mov    %esp,%ecx
+     563:	ba 6a 05 00 00       	mov    $0x56a,%edx
+     568:	0f 34                	sysenter
+     56a:	c3                   	ret
+
+0000056b <unlink>:
+SYSCALL(unlink)
+     56b:	b8 12 00 00 00       	mov    $0x12,%eax
+     570:	89 e1                	mov    %esp,%ecx
+     572:	ba 79 05 00 00       	mov    $0x579,%edx
+     577:	0f 34                	sysenter
+     579:	c3                   	ret
+
+0000057a <fstat>:
+SYSCALL(fstat)
+     57a:	b8 08 00 00 00       	mov    $0x8,%eax
+     57f:	89 e1                	mov    %esp,%ecx
+     581:	ba 88 05 00 00       	mov    $0x588,%edx
+     586:	0f 34                	sysenter
+     588:	c3                   	ret
+
+00000589 <link>:
+SYSCALL(link)
+     589:	b8 13 00 00 00       	mov    $0x13,%eax
+     58e:	89 e1                	mov    %esp,%ecx
+     590:	ba 97 05 00 00       	mov    $0x597,%edx
+     595:	0f 34                	sysenter
+     597:	c3                   	ret
+
+00000598 <mkdir>:
+SYSCALL(mkdir)
+     598:	b8 14 00 00 00       	mov    $0x14,%eax
+     59d:	89 e1                	mov    %esp,%ecx
+     59f:	ba a6 05 00 00       	mov    $0x5a6,%edx
+     5a4:	0f 34                	sysenter
+     5a6:	c3                   	ret
+
+000005a7 <chdir>:
+SYSCALL(chdir)
+     5a7:	b8 09 00 00 00       	mov    $0x9,%eax
+     5ac:	89 e1                	mov    %esp,%ecx
+     5ae:	ba b5 05 00 00       	mov    $0x5b5,%edx
+     5b3:	0f 34                	sysenter
+     5b5:	c3                   	ret
+
+000005b6 <dup>:
+SYSCALL(dup)
+     5b6:	b8 0a 00 00 00       	mov    $0xa,%eax
+     5bb:	89 e1                	mov    %esp,%ecx
+     5bd:	ba c4 05 00 00       	mov    $0x5c4,%edx
+     5c2:	0f 34                	sysenter
+     5c4:	c3                   	ret
+
+000005c5 <getpid>:
+SYSCALL(getpid)
+     5c5:	b8 0b 00 00 00       	mov    $0xb,%eax
+     5ca:	89 e1                	mov    %esp,%ecx
+     5cc:	ba d3 05 00 00       	mov    $0x5d3,%edx
+     5d1:	0f 34                	sysenter
+     5d3:	c3                   	ret
+
+000005d4 <sbrk>:
+SYSCALL(sbrk)
+     5d4:	b8 0c 00 00 00       	mov    $0xc,%eax
+     5d9:	89 e1                	mov    %esp,%ecx
+     5db:	ba e2 05 00 00       	mov    $0x5e2,%edx
+     5e0:	0f 34                	sysenter
+     5e2:	c3                   	ret
+
+000005e3 <sleep>:
+SYSCALL(sleep)
+     5e3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     5e8:	89 e1                	mov    %esp,%ecx
+     5ea:	ba f1 05 00 00       	mov    $0x5f1,%edx
+     5ef:	0f 34                	sysenter
+     5f1:	c3                   	ret
+
+000005f2 <clone>:
+SYSCALL(clone)
+     5f2:	b8 16 00 00 00       	mov    $0x16,%eax
+     5f7:	89 e1                	mov    %esp,%ecx
+     5f9:	ba 00 06 00 00       	mov    $0x600,%edx
+     5fe:	0f 34                	sysenter
+     600:	c3                   	ret
+
+00000601 <join>:
+SYSCALL(join)
+     601:	b8 17 00 00 00       	mov    $0x17,%eax
+     606:	89 e1                	mov    %esp,%ecx
+     608:	ba 0f 06 00 00       	mov    $0x60f,%edx
+     60d:	0f 34                	sysenter
+     60f:	c3                   	ret
+
+00000610 <futex>:
+SYSCALL(futex)
+     610:	b8 18 00 00 00       	mov    $0x18,%eax
+     615:	89 e1                	mov    %esp,%ecx
+     617:	ba 1e 06 00 00       	mov    $0x61e,%edx
+     61c:	0f 34                	sysenter
+     61e:	c3                   	ret
+
+0000061f <yield>:
+SYSCALL(yield)
+     61f:	b8 19 00 00 00       	mov    $0x19,%eax
+     624:	89 e1                	mov    %esp,%ecx
+     626:	ba 2d 06 00 00       	mov    $0x62d,%edx
+     62b:	0f 34                	sysenter
+     62d:	c3                   	ret
+
+0000062e <lockstat>:
+SYSCALL(lockstat)
+     62e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     633:	89 e1                	mov    %esp,%ecx
+     635:	ba 3c 06 00 00       	mov    $0x63c,%edx
+     63a:	0f 34                	sysenter
+     63c:	c3                   	ret
+
+0000063d <lockhammer>:
+SYSCALL(lockhammer)
+     63d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     642:	89 e1                	mov    %esp,%ecx
+     644:	ba 4b 06 00 00       	mov    $0x64b,%edx
+     649:	0f 34                	sysenter
+     64b:	c3                   	ret
+
+0000064c <vmsplice>:
+SYSCALL(vmsplice)
+     64c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     651:	89 e1                	mov    %esp,%ecx
+     653:	ba 5a 06 00 00       	mov    $0x65a,%edx
+     658:	0f 34                	sysenter
+     65a:	c3                   	ret
+
+0000065b <hsbrk>:
+SYSCALL(hsbrk)
+     65b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     660:	89 e1                	mov    %esp,%ecx
+     662:	ba 69 06 00 00       	mov    $0x669,%edx
+     667:	0f 34                	sysenter
+     669:	c3                   	ret
+
+0000066a <mmap>:
+SYSCALL(mmap)
+     66a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     66f:	89 e1                	mov    %esp,%ecx
+     671:	ba 78 06 00 00       	mov    $0x678,%edx
+     676:	0f 34                	sysenter
+     678:	c3                   	ret
+
+00000679 <munmap>:
+SYSCALL(munmap)
+     679:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     67e:	89 e1                	mov    %esp,%ecx
+     680:	ba 87 06 00 00       	mov    $0x687,%edx
+     685:	0f 34                	sysenter
+     687:	c3                   	ret
+
+00000688 <ringenter>:
+SYSCALL(ringenter)
+     688:	b8 20 00 00 00       	mov    $0x20,%eax
+     68d:	89 e1                	mov    %esp,%ecx
+     68f:	ba 96 06 00 00       	mov    $0x696,%edx
+     694:	0f 34                	sysenter
+     696:	c3                   	ret
+
+00000697 <readv>:
+SYSCALL(readv)
+     697:	b8 21 00 00 00       	mov    $0x21,%eax
+     69c:	89 e1                	mov    %esp,%ecx
+     69e:	ba a5 06 00 00       	mov    $0x6a5,%edx
+     6a3:	0f 34                	sysenter
+     6a5:	c3                   	ret
+
+000006a6 <writev>:
+SYSCALL(writev)
+     6a6:	b8 22 00 00 00       	mov    $0x22,%eax
+     6ab:	89 e1                	mov    %esp,%ecx
+     6ad:	ba b4 06 00 00       	mov    $0x6b4,%edx
+     6b2:	0f 34                	sysenter
+     6b4:	c3                   	ret
+
+000006b5 <pread>:
+SYSCALL(pread)
+     6b5:	b8 23 00 00 00       	mov    $0x23,%eax
+     6ba:	89 e1                	mov    %esp,%ecx
+     6bc:	ba c3 06 00 00       	mov    $0x6c3,%edx
+     6c1:	0f 34                	sysenter
+     6c3:	c3                   	ret
+
+000006c4 <pwrite>:
+SYSCALL(pwrite)
+     6c4:	b8 24 00 00 00       	mov    $0x24,%eax
+     6c9:	89 e1                	mov    %esp,%ecx
+     6cb:	ba d2 06 00 00       	mov    $0x6d2,%edx
+     6d0:	0f 34                	sysenter
+     6d2:	c3                   	ret
+
+000006d3 <prof>:
+SYSCALL(prof)
+     6d3:	b8 25 00 00 00       	mov    $0x25,%eax
+     6d8:	89 e1                	mov    %esp,%ecx
+     6da:	ba e1 06 00 00       	mov    $0x6e1,%edx
+     6df:	0f 34                	sysenter
+     6e1:	c3                   	ret
+
+000006e2 <scstat>:
+SYSCALL(scstat)
+     6e2:	b8 26 00 00 00       	mov    $0x26,%eax
+     6e7:	89 e1                	mov    %esp,%ecx
+     6e9:	ba f0 06 00 00       	mov    $0x6f0,%edx
+     6ee:	0f 34                	sysenter
+     6f0:	c3                   	ret
+     6f1:	66 90                	xchg   %ax,%ax
+     6f3:	66 90                	xchg   %ax,%ax
+     6f5:	66 90                	xchg   %ax,%ax
+     6f7:	66 90                	xchg   %ax,%ax
+     6f9:	66 90                	xchg   %ax,%ax
+     6fb:	66 90                	xchg   %ax,%ax
+     6fd:	66 90                	xchg   %ax,%ax
+     6ff:	90                   	nop
+
+00000700 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+     700:	55                   	push   %ebp
+     701:	89 e5                	mov    %esp,%ebp
+     703:	57                   	push   %edi
+     704:	56                   	push   %esi
+     705:	53                   	push   %ebx
+     706:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     708:	89 d1                	mov    %edx,%ecx
+{
+     70a:	83 ec 2c             	sub    $0x2c,%esp
+     70d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+     710:	85 d2                	test   %edx,%edx
+     712:	79 7c                	jns    790 <printint+0x90>
+     714:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     718:	74 76                	je     790 <printint+0x90>
+    x = -xx;
+     71a:	f7 d9                	neg    %ecx
+    neg = 1;
+     71c:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     721:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     724:	31 f6                	xor    %esi,%esi
+     726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     72d:	8d 76 00             	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     730:	89 c8                	mov    %ecx,%eax
+     732:	31 d2                	xor    %edx,%edx
+     734:	89 f7                	mov    %esi,%edi
+     736:	f7 f3                	div    %ebx
+     738:	8d 76 01             	lea    0x1(%esi),%esi
+     73b:	0f b6 92 8c 1e 00 00 	movzbl 0x1e8c(%edx),%edx
+     742:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     746:	89 ca                	mov    %ecx,%edx
+     748:	89 c1                	mov    %eax,%ecx
+     74a:	39 da                	cmp    %ebx,%edx
+     74c:	73 e2                	jae    730 <printint+0x30>
+  if(neg)
+     74e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     751:	85 c0                	test   %eax,%eax
+     753:	74 07                	je     75c <printint+0x5c>
+    buf[i++] = '-';
+     755:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     75a:	89 f7                	mov    %esi,%edi
+     75c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     75f:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     762:	01 df                	add    %ebx,%edi
+     764:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc_unlocked(buf[i], f);
+     768:	83 ec 08             	sub    $0x8,%esp
+     76b:	56                   	push   %esi
+     76c:	0f be 07             	movsbl (%edi),%eax
+     76f:	50                   	push   %eax
+     770:	e8 cb 07 00 00       	call   f40 <putc_unlocked>
+  while(--i >= 0)
+     775:	89 f8                	mov    %edi,%eax
+     777:	83 c4 10             	add    $0x10,%esp
+     77a:	83 ef 01             	sub    $0x1,%edi
+     77d:	39 d8                	cmp    %ebx,%eax
+     77f:	75 e7                	jne    768 <printint+0x68>
+}
+     781:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     784:	5b                   	pop    %ebx
+     785:	5e                   	pop    %esi
+     786:	5f                   	pop    %edi
+     787:	5d                   	pop    %ebp
+     788:	c3                   	ret
+     789:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     790:	31 c0                	xor    %eax,%eax
+     792:	eb 8d                	jmp    721 <printint+0x21>
+     794:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     79b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     79f:	90                   	nop
+
+000007a0 <vfprintf>:
+
+// Print to the given stream, which the caller has locked.
+// Only understands %d, %x, %p, %s.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+     7a0:	55                   	push   %ebp
+     7a1:	89 e5                	mov    %esp,%ebp
+     7a3:	57                   	push   %edi
+     7a4:	56                   	push   %esi
+     7a5:	53                   	push   %ebx
+     7a6:	83 ec 1c             	sub    $0x1c,%esp
+     7a9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     7ac:	0f b6 0a             	movzbl (%edx),%ecx
+     7af:	84 c9                	test   %cl,%cl
+     7b1:	74 5c                	je     80f <vfprintf+0x6f>
+     7b3:	89 c6                	mov    %eax,%esi
+     7b5:	8d 5a 01             	lea    0x1(%edx),%ebx
+     7b8:	31 ff                	xor    %edi,%edi
+     7ba:	eb 20                	jmp    7dc <vfprintf+0x3c>
+     7bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     7c0:	83 f9 25             	cmp    $0x25,%ecx
+     7c3:	74 3b                	je     800 <vfprintf+0x60>
+        state = '%';
+      } else {
+        putc_unlocked(c, f);
+     7c5:	83 ec 08             	sub    $0x8,%esp
+     7c8:	56                   	push   %esi
+     7c9:	51                   	push   %ecx
+     7ca:	e8 71 07 00 00       	call   f40 <putc_unlocked>
+     7cf:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     7d2:	0f b6 0b             	movzbl (%ebx),%ecx
+     7d5:	83 c3 01             	add    $0x1,%ebx
+     7d8:	84 c9                	test   %cl,%cl
+     7da:	74 33                	je     80f <vfprintf+0x6f>
+    if(state == 0){
+     7dc:	85 ff                	test   %edi,%edi
+     7de:	74 e0                	je     7c0 <vfprintf+0x20>
+      }
+    } else if(state == '%'){
+     7e0:	83 ff 25             	cmp    $0x25,%edi
+     7e3:	75 ed                	jne    7d2 <vfprintf+0x32>
+      if(c == 'd'){
+     7e5:	83 f9 25             	cmp    $0x25,%ecx
+     7e8:	0f 84 02 01 00 00    	je     8f0 <vfprintf+0x150>
+     7ee:	8d 41 9d             	lea    -0x63(%ecx),%eax
+     7f1:	83 f8 15             	cmp    $0x15,%eax
+     7f4:	77 2a                	ja     820 <vfprintf+0x80>
+     7f6:	ff 24 85 34 1e 00 00 	jmp    *0x1e34(,%eax,4)
+     7fd:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     800:	0f b6 0b             	movzbl (%ebx),%ecx
+     803:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     806:	bf 25 00 00 00       	mov    $0x25,%edi
+  for(i = 0; fmt[i]; i++){
+     80b:	84 c9                	test   %cl,%cl
+     80d:	75 cd                	jne    7dc <vfprintf+0x3c>
+        putc_unlocked(c, f);
+      }
+      state = 0;
+    }
+  }
+}
+     80f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     812:	5b                   	pop    %ebx
+     813:	5e                   	pop    %esi
+     814:	5f                   	pop    %edi
+     815:	5d                   	pop    %ebp
+     816:	c3                   	ret
+     817:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     81e:	66 90                	xchg   %ax,%ax
+        putc_unlocked('%', f);
+     820:	83 ec 08             	sub    $0x8,%esp
+     823:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     826:	56                   	push   %esi
+     827:	6a 25                	push   $0x25
+     829:	e8 12 07 00 00       	call   f40 <putc_unlocked>
+        putc_unlocked(c, f);
+     82e:	58                   	pop    %eax
+     82f:	5a                   	pop    %edx
+     830:	56                   	push   %esi
+     831:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     834:	51                   	push   %ecx
+     835:	e8 06 07 00 00       	call   f40 <putc_unlocked>
+     83a:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     83d:	31 ff                	xor    %edi,%edi
+     83f:	eb 91                	jmp    7d2 <vfprintf+0x32>
+     841:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+     848:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     84b:	83 ec 0c             	sub    $0xc,%esp
+     84e:	b9 10 00 00 00       	mov    $0x10,%ecx
+     853:	8b 17                	mov    (%edi),%edx
+     855:	6a 00                	push   $0x0
+        ap++;
+     857:	83 c7 04             	add    $0x4,%edi
+        printint(f, *ap, 16, 0);
+     85a:	89 f0                	mov    %esi,%eax
+     85c:	e8 9f fe ff ff       	call   700 <printint>
+        ap++;
+     861:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     864:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     867:	31 ff                	xor    %edi,%edi
+     869:	e9 64 ff ff ff       	jmp    7d2 <vfprintf+0x32>
+     86e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     870:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     873:	8b 10                	mov    (%eax),%edx
+        ap++;
+     875:	83 c0 04             	add    $0x4,%eax
+     878:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     87b:	85 d2                	test   %edx,%edx
+     87d:	0f 84 85 00 00 00    	je     908 <vfprintf+0x168>
+        while(*s != 0){
+     883:	0f be 02             	movsbl (%edx),%eax
+        s = (char*)*ap;
+     886:	89 d7                	mov    %edx,%edi
+        while(*s != 0){
+     888:	84 c0                	test   %al,%al
+     88a:	74 b1                	je     83d <vfprintf+0x9d>
+     88c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+          putc_unlocked(*s, f);
+     890:	83 ec 08             	sub    $0x8,%esp
+          s++;
+     893:	83 c7 01             	add    $0x1,%edi
+          putc_unlocked(*s, f);
+     896:	56                   	push   %esi
+     897:	50                   	push   %eax
+     898:	e8 a3 06 00 00       	call   f40 <putc_unlocked>
+        while(*s != 0){
+     89d:	0f be 07             	movsbl (%edi),%eax
+     8a0:	83 c4 10             	add    $0x10,%esp
+     8a3:	84 c0                	test   %al,%al
+     8a5:	75 e9                	jne    890 <vfprintf+0xf0>
+      state = 0;
+     8a7:	31 ff                	xor    %edi,%edi
+     8a9:	e9 24 ff ff ff       	jmp    7d2 <vfprintf+0x32>
+     8ae:	66 90                	xchg   %ax,%ax
+        printint(f, *ap, 10, 1);
+     8b0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     8b3:	83 ec 0c             	sub    $0xc,%esp
+     8b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     8bb:	8b 17                	mov    (%edi),%edx
+     8bd:	6a 01                	push   $0x1
+     8bf:	eb 96                	jmp    857 <vfprintf+0xb7>
+     8c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc_unlocked(*ap, f);
+     8c8:	83 ec 08             	sub    $0x8,%esp
+     8cb:	56                   	push   %esi
+     8cc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     8cf:	ff 37                	push   (%edi)
+     8d1:	e8 6a 06 00 00       	call   f40 <putc_unlocked>
+        ap++;
+     8d6:	89 f8                	mov    %edi,%eax
+     8d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     8db:	31 ff                	xor    %edi,%edi
+        ap++;
+     8dd:	83 c0 04             	add    $0x4,%eax
+     8e0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     8e3:	e9 ea fe ff ff       	jmp    7d2 <vfprintf+0x32>
+     8e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ef:	90                   	nop
+        putc_unlocked(c, f);
+     8f0:	83 ec 08             	sub    $0x8,%esp
+      state = 0;
+     8f3:	31 ff                	xor    %edi,%edi
+        putc_unlocked(c, f);
+     8f5:	56                   	push   %esi
+     8f6:	6a 25                	push   $0x25
+     8f8:	e8 43 06 00 00       	call   f40 <putc_unlocked>
+     8fd:	83 c4 10             	add    $0x10,%esp
+     900:	e9 cd fe ff ff       	jmp    7d2 <vfprintf+0x32>
+     905:	8d 76 00             	lea    0x0(%esi),%esi
+     908:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     90d:	bf 2c 1e 00 00       	mov    $0x1e2c,%edi
+     912:	e9 79 ff ff ff       	jmp    890 <vfprintf+0xf0>
+     917:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     91e:	66 90                	xchg   %ax,%ax
+
+00000920 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+     920:	55                   	push   %ebp
+     921:	89 e5                	mov    %esp,%ebp
+     923:	53                   	push   %ebx
+     924:	83 ec 10             	sub    $0x10,%esp
+     927:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  flockfile(f);
+     92a:	53                   	push   %ebx
+     92b:	e8 d0 02 00 00       	call   c00 <flockfile>
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     930:	8b 55 0c             	mov    0xc(%ebp),%edx
+     933:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     936:	89 d8                	mov    %ebx,%eax
+     938:	e8 63 fe ff ff       	call   7a0 <vfprintf>
+  funlockfile(f);
+     93d:	89 1c 24             	mov    %ebx,(%esp)
+     940:	e8 eb 02 00 00       	call   c30 <funlockfile>
+}
+     945:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     948:	83 c4 10             	add    $0x10,%esp
+     94b:	c9                   	leave
+     94c:	c3                   	ret
+     94d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000950 <printf>:
+
+// Print to the given fd: through stdout or stderr for 1 and 2,
+// otherwise with one write() per call.
+void
+printf(int fd, const char *fmt, ...)
+{
+     950:	55                   	push   %ebp
+     951:	89 e5                	mov    %esp,%ebp
+     953:	56                   	push   %esi
+     954:	53                   	push   %ebx
+     955:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+     95b:	8b 45 08             	mov    0x8(%ebp),%eax
+  char buf[128];
+  struct iobuf f;
+
+  if(fd == 1 || fd == 2){
+    flockfile(&_iob[fd]);
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     95e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(fd == 1 || fd == 2){
+     961:	8d 50 ff             	lea    -0x1(%eax),%edx
+     964:	83 fa 01             	cmp    $0x1,%edx
+     967:	76 77                	jbe    9e0 <printf+0x90>
+    funlockfile(&_iob[fd]);
+    return;
+  }
+  f.fd = fd;
+     969:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  f.flags = IO_WRITE|IO_SETUP;
+  f.buf = buf;
+     96f:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  f.size = sizeof(buf);
+  f.r = f.n = 0;
+  mutex_init(&f.lock);
+     975:	83 ec 0c             	sub    $0xc,%esp
+     978:	8d 9d 5c ff ff ff    	lea    -0xa4(%ebp),%ebx
+  f.buf = buf;
+     97e:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+  mutex_init(&f.lock);
+     984:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  f.flags = IO_WRITE|IO_SETUP;
+     98a:	c7 85 60 ff ff ff 42 	movl   $0x42,-0xa0(%ebp)
+     991:	00 00 00 
+  f.size = sizeof(buf);
+     994:	c7 85 68 ff ff ff 80 	movl   $0x80,-0x98(%ebp)
+     99b:	00 00 00 
+  f.r = f.n = 0;
+     99e:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+     9a5:	00 00 00 
+     9a8:	c7 85 6c ff ff ff 00 	movl   $0x0,-0x94(%ebp)
+     9af:	00 00 00 
+  mutex_init(&f.lock);
+     9b2:	50                   	push   %eax
+     9b3:	e8 d8 f9 ff ff       	call   390 <mutex_init>
+  vfprintf(&f, fmt, (uint*)(void*)&fmt + 1);
+     9b8:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     9bb:	89 f2                	mov    %esi,%edx
+     9bd:	89 d8                	mov    %ebx,%eax
+     9bf:	e8 dc fd ff ff       	call   7a0 <vfprintf>
+  fflush(&f);
+     9c4:	89 1c 24             	mov    %ebx,(%esp)
+     9c7:	e8 f4 04 00 00       	call   ec0 <fflush>
+     9cc:	83 c4 10             	add    $0x10,%esp
+}
+     9cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     9d2:	5b                   	pop    %ebx
+     9d3:	5e                   	pop    %esi
+     9d4:	5d                   	pop    %ebp
+     9d5:	c3                   	ret
+     9d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9dd:	8d 76 00             	lea    0x0(%esi),%esi
+    flockfile(&_iob[fd]);
+     9e0:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     9e3:	83 ec 0c             	sub    $0xc,%esp
+     9e6:	8d 98 00 28 00 00    	lea    0x2800(%eax),%ebx
+     9ec:	53                   	push   %ebx
+     9ed:	e8 0e 02 00 00       	call   c00 <flockfile>
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     9f2:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     9f5:	89 f2                	mov    %esi,%edx
+     9f7:	89 d8                	mov    %ebx,%eax
+     9f9:	e8 a2 fd ff ff       	call   7a0 <vfprintf>
+    funlockfile(&_iob[fd]);
+     9fe:	89 1c 24             	mov    %ebx,(%esp)
+     a01:	e8 2a 02 00 00       	call   c30 <funlockfile>
+     a06:	83 c4 10             	add    $0x10,%esp
+}
+     a09:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     a0c:	5b                   	pop    %ebx
+     a0d:	5e                   	pop    %esi
+     a0e:	5d                   	pop    %ebp
+     a0f:	c3                   	ret
+
+00000a10 <setup>:
+}
+
+// Choose how to buffer f on first use: by lines on a device.
+static void
+setup(FILE *f)
+{
+     a10:	55                   	push   %ebp
+     a11:	89 e5                	mov    %esp,%ebp
+     a13:	53                   	push   %ebx
+     a14:	89 c3                	mov    %eax,%ebx
+     a16:	83 ec 2c             	sub    $0x2c,%esp
+  struct stat st;
+
+  f->flags |= IO_SETUP;
+     a19:	83 48 04 40          	orl    $0x40,0x4(%eax)
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     a1d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     a20:	50                   	push   %eax
+     a21:	ff 33                	push   (%ebx)
+     a23:	e8 52 fb ff ff       	call   57a <fstat>
+     a28:	83 c4 10             	add    $0x10,%esp
+     a2b:	85 c0                	test   %eax,%eax
+    f->flags |= IO_DEV|IO_LINE;
+     a2d:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     a30:	75 07                	jne    a39 <setup+0x29>
+     a32:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+     a37:	74 17                	je     a50 <setup+0x40>
+  if(f->flags & IO_WRITE)
+     a39:	a8 02                	test   $0x2,%al
+     a3b:	74 0a                	je     a47 <setup+0x37>
+    flushhook = flushall;
+     a3d:	c7 05 e0 28 00 00 70 	movl   $0xb70,0x28e0
+     a44:	0b 00 00 
+}
+     a47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a4a:	c9                   	leave
+     a4b:	c3                   	ret
+     a4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    f->flags |= IO_DEV|IO_LINE;
+     a50:	83 c8 30             	or     $0x30,%eax
+     a53:	89 43 04             	mov    %eax,0x4(%ebx)
+     a56:	eb e1                	jmp    a39 <setup+0x29>
+     a58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a5f:	90                   	nop
+
+00000a60 <flush>:
+static int
+flush(FILE *f)
+{
+  int i, n;
+
+  if(!(f->flags & IO_WRITE))
+     a60:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+     a64:	74 6a                	je     ad0 <flush+0x70>
+{
+     a66:	55                   	push   %ebp
+     a67:	89 e5                	mov    %esp,%ebp
+     a69:	56                   	push   %esi
+     a6a:	89 c6                	mov    %eax,%esi
+     a6c:	53                   	push   %ebx
+    return 0;
+  for(i = 0; i < f->n; i += n){
+     a6d:	8b 40 14             	mov    0x14(%eax),%eax
+     a70:	85 c0                	test   %eax,%eax
+     a72:	7e 4c                	jle    ac0 <flush+0x60>
+     a74:	31 db                	xor    %ebx,%ebx
+     a76:	eb 11                	jmp    a89 <flush+0x29>
+     a78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a7f:	90                   	nop
+     a80:	01 c3                	add    %eax,%ebx
+     a82:	8b 46 14             	mov    0x14(%esi),%eax
+     a85:	39 d8                	cmp    %ebx,%eax
+     a87:	7e 37                	jle    ac0 <flush+0x60>
+    if((n = write(f->fd, f->buf + i, f->n - i)) <= 0){
+     a89:	83 ec 04             	sub    $0x4,%esp
+     a8c:	29 d8                	sub    %ebx,%eax
+     a8e:	50                   	push   %eax
+     a8f:	8b 46 08             	mov    0x8(%esi),%eax
+     a92:	01 d8                	add    %ebx,%eax
+     a94:	50                   	push   %eax
+     a95:	ff 36                	push   (%esi)
+     a97:	e8 75 fa ff ff       	call   511 <write>
+     a9c:	83 c4 10             	add    $0x10,%esp
+     a9f:	85 c0                	test   %eax,%eax
+     aa1:	7f dd                	jg     a80 <flush+0x20>
+      f->flags |= IO_ERR;
+     aa3:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+      f->n = 0;
+     aa7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     aac:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+      return EOF;
+    }
+  }
+  f->n = 0;
+  return 0;
+}
+     ab3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ab6:	5b                   	pop    %ebx
+     ab7:	5e                   	pop    %esi
+     ab8:	5d                   	pop    %ebp
+     ab9:	c3                   	ret
+     aba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->n = 0;
+     ac0:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+}
+     ac7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+     aca:	31 c0                	xor    %eax,%eax
+}
+     acc:	5b                   	pop    %ebx
+     acd:	5e                   	pop    %esi
+     ace:	5d                   	pop    %ebp
+     acf:	c3                   	ret
+    return 0;
+     ad0:	31 c0                	xor    %eax,%eax
+}
+     ad2:	c3                   	ret
+     ad3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ada:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ae0 <fflush.part.0>:
+fflush(FILE *f)
+     ae0:	55                   	push   %ebp
+     ae1:	89 e5                	mov    %esp,%ebp
+     ae3:	57                   	push   %edi
+     ae4:	bf f8 28 00 00       	mov    $0x28f8,%edi
+     ae9:	56                   	push   %esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     aea:	31 f6                	xor    %esi,%esi
+fflush(FILE *f)
+     aec:	53                   	push   %ebx
+     aed:	bb 18 28 00 00       	mov    $0x2818,%ebx
+     af2:	83 ec 1c             	sub    $0x1c,%esp
+     af5:	eb 10                	jmp    b07 <fflush.part.0+0x27>
+     af7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     afe:	66 90                	xchg   %ax,%ax
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     b00:	83 c3 1c             	add    $0x1c,%ebx
+     b03:	39 df                	cmp    %ebx,%edi
+     b05:	74 33                	je     b3a <fflush.part.0+0x5a>
+      if((f->flags & IO_WRITE) && fflush(f) < 0)
+     b07:	f6 43 ec 02          	testb  $0x2,-0x14(%ebx)
+     b0b:	74 f3                	je     b00 <fflush.part.0+0x20>
+  if(threaded)
+     b0d:	8b 0d 00 29 00 00    	mov    0x2900,%ecx
+     b13:	85 c9                	test   %ecx,%ecx
+     b15:	75 49                	jne    b60 <fflush.part.0+0x80>
+  r = flush(f);
+     b17:	8d 43 e8             	lea    -0x18(%ebx),%eax
+     b1a:	e8 41 ff ff ff       	call   a60 <flush>
+  if(threaded)
+     b1f:	8b 15 00 29 00 00    	mov    0x2900,%edx
+     b25:	85 d2                	test   %edx,%edx
+     b27:	75 1f                	jne    b48 <fflush.part.0+0x68>
+        r = EOF;
+     b29:	85 c0                	test   %eax,%eax
+     b2b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     b30:	0f 48 f0             	cmovs  %eax,%esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     b33:	83 c3 1c             	add    $0x1c,%ebx
+     b36:	39 df                	cmp    %ebx,%edi
+     b38:	75 cd                	jne    b07 <fflush.part.0+0x27>
+}
+     b3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b3d:	89 f0                	mov    %esi,%eax
+     b3f:	5b                   	pop    %ebx
+     b40:	5e                   	pop    %esi
+     b41:	5f                   	pop    %edi
+     b42:	5d                   	pop    %ebp
+     b43:	c3                   	ret
+     b44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     b48:	83 ec 0c             	sub    $0xc,%esp
+     b4b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     b4e:	53                   	push   %ebx
+     b4f:	e8 9c f8 ff ff       	call   3f0 <mutex_unlock>
+     b54:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     b57:	83 c4 10             	add    $0x10,%esp
+     b5a:	eb cd                	jmp    b29 <fflush.part.0+0x49>
+     b5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     b60:	83 ec 0c             	sub    $0xc,%esp
+     b63:	53                   	push   %ebx
+     b64:	e8 37 f8 ff ff       	call   3a0 <mutex_lock>
+     b69:	83 c4 10             	add    $0x10,%esp
+     b6c:	eb a9                	jmp    b17 <fflush.part.0+0x37>
+     b6e:	66 90                	xchg   %ax,%ax
+
+00000b70 <flushall>:
+  if(f == 0){
+     b70:	e9 6b ff ff ff       	jmp    ae0 <fflush.part.0>
+     b75:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b80 <fill>:
+
+// Refill f's buffer. Returns the number of bytes read.
+// Caller holds f's lock.
+static int
+fill(FILE *f)
+{
+     b80:	55                   	push   %ebp
+     b81:	89 e5                	mov    %esp,%ebp
+     b83:	53                   	push   %ebx
+     b84:	89 c3                	mov    %eax,%ebx
+     b86:	83 ec 04             	sub    $0x4,%esp
+  int n;
+
+  if(!(f->flags & IO_SETUP))
+     b89:	8b 40 04             	mov    0x4(%eax),%eax
+     b8c:	a8 40                	test   $0x40,%al
+     b8e:	74 50                	je     be0 <fill+0x60>
+    setup(f);
+  if(f->flags & IO_DEV)
+     b90:	a8 20                	test   $0x20,%al
+     b92:	75 3c                	jne    bd0 <fill+0x50>
+    fflush(0);
+  f->r = 0;
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     b94:	83 ec 04             	sub    $0x4,%esp
+  f->r = 0;
+     b97:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     b9e:	ff 73 0c             	push   0xc(%ebx)
+     ba1:	ff 73 08             	push   0x8(%ebx)
+     ba4:	ff 33                	push   (%ebx)
+     ba6:	e8 57 f9 ff ff       	call   502 <read>
+     bab:	83 c4 10             	add    $0x10,%esp
+     bae:	85 c0                	test   %eax,%eax
+     bb0:	7f 10                	jg     bc2 <fill+0x42>
+    f->flags |= n < 0 ? IO_ERR : IO_EOF;
+     bb2:	83 f8 01             	cmp    $0x1,%eax
+     bb5:	19 c0                	sbb    %eax,%eax
+     bb7:	83 e0 fc             	and    $0xfffffffc,%eax
+     bba:	83 c0 08             	add    $0x8,%eax
+     bbd:	09 43 04             	or     %eax,0x4(%ebx)
+    n = 0;
+     bc0:	31 c0                	xor    %eax,%eax
+  }
+  f->n = n;
+     bc2:	89 43 14             	mov    %eax,0x14(%ebx)
+  return n;
+}
+     bc5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     bc8:	c9                   	leave
+     bc9:	c3                   	ret
+     bca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == 0){
+     bd0:	e8 0b ff ff ff       	call   ae0 <fflush.part.0>
+     bd5:	eb bd                	jmp    b94 <fill+0x14>
+     bd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bde:	66 90                	xchg   %ax,%ax
+    setup(f);
+     be0:	89 d8                	mov    %ebx,%eax
+     be2:	e8 29 fe ff ff       	call   a10 <setup>
+  if(f->flags & IO_DEV)
+     be7:	8b 43 04             	mov    0x4(%ebx),%eax
+     bea:	eb a4                	jmp    b90 <fill+0x10>
+     bec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000bf0 <stdio_threaded>:
+  threaded = 1;
+     bf0:	c7 05 00 29 00 00 01 	movl   $0x1,0x2900
+     bf7:	00 00 00 
+}
+     bfa:	c3                   	ret
+     bfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bff:	90                   	nop
+
+00000c00 <flockfile>:
+{
+     c00:	55                   	push   %ebp
+  if(threaded)
+     c01:	8b 15 00 29 00 00    	mov    0x2900,%edx
+{
+     c07:	89 e5                	mov    %esp,%ebp
+     c09:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     c0c:	85 d2                	test   %edx,%edx
+     c0e:	75 08                	jne    c18 <flockfile+0x18>
+}
+     c10:	5d                   	pop    %ebp
+     c11:	c3                   	ret
+     c12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_lock(&f->lock);
+     c18:	83 c0 18             	add    $0x18,%eax
+     c1b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     c1e:	5d                   	pop    %ebp
+    mutex_lock(&f->lock);
+     c1f:	e9 7c f7 ff ff       	jmp    3a0 <mutex_lock>
+     c24:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c2f:	90                   	nop
+
+00000c30 <funlockfile>:
+{
+     c30:	55                   	push   %ebp
+  if(threaded)
+     c31:	8b 15 00 29 00 00    	mov    0x2900,%edx
+{
+     c37:	89 e5                	mov    %esp,%ebp
+     c39:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     c3c:	85 d2                	test   %edx,%edx
+     c3e:	75 08                	jne    c48 <funlockfile+0x18>
+}
+     c40:	5d                   	pop    %ebp
+     c41:	c3                   	ret
+     c42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&f->lock);
+     c48:	83 c0 18             	add    $0x18,%eax
+     c4b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     c4e:	5d                   	pop    %ebp
+    mutex_unlock(&f->lock);
+     c4f:	e9 9c f7 ff ff       	jmp    3f0 <mutex_unlock>
+     c54:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c5f:	90                   	nop
+
+00000c60 <fopen>:
+{
+     c60:	55                   	push   %ebp
+     c61:	89 e5                	mov    %esp,%ebp
+     c63:	57                   	push   %edi
+     c64:	56                   	push   %esi
+     c65:	53                   	push   %ebx
+     c66:	83 ec 34             	sub    $0x34,%esp
+     c69:	8b 75 0c             	mov    0xc(%ebp),%esi
+     c6c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(strcmp(mode, "r") != 0 && strcmp(mode, "w") != 0)
+     c6f:	68 9d 1e 00 00       	push   $0x1e9d
+     c74:	56                   	push   %esi
+     c75:	e8 66 f5 ff ff       	call   1e0 <strcmp>
+     c7a:	83 c4 10             	add    $0x10,%esp
+     c7d:	85 c0                	test   %eax,%eax
+     c7f:	74 15                	je     c96 <fopen+0x36>
+     c81:	83 ec 08             	sub    $0x8,%esp
+     c84:	68 9f 1e 00 00       	push   $0x1e9f
+     c89:	56                   	push   %esi
+     c8a:	e8 51 f5 ff ff       	call   1e0 <strcmp>
+     c8f:	83 c4 10             	add    $0x10,%esp
+     c92:	85 c0                	test   %eax,%eax
+     c94:	75 2c                	jne    cc2 <fopen+0x62>
+  if(threaded)
+     c96:	a1 00 29 00 00       	mov    0x2900,%eax
+     c9b:	85 c0                	test   %eax,%eax
+     c9d:	0f 85 ed 00 00 00    	jne    d90 <fopen+0x130>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     ca3:	bb 54 28 00 00       	mov    $0x2854,%ebx
+    if(f->flags == 0)
+     ca8:	8b 53 04             	mov    0x4(%ebx),%edx
+     cab:	85 d2                	test   %edx,%edx
+     cad:	74 21                	je     cd0 <fopen+0x70>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     caf:	83 c3 1c             	add    $0x1c,%ebx
+     cb2:	81 fb e0 28 00 00    	cmp    $0x28e0,%ebx
+     cb8:	75 ee                	jne    ca8 <fopen+0x48>
+  if(threaded)
+     cba:	85 c0                	test   %eax,%eax
+     cbc:	0f 85 36 01 00 00    	jne    df8 <fopen+0x198>
+    return 0;
+     cc2:	31 db                	xor    %ebx,%ebx
+     cc4:	e9 96 00 00 00       	jmp    d5f <fopen+0xff>
+     cc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f == &_iob[NSTREAM])
+     cd0:	81 fb e0 28 00 00    	cmp    $0x28e0,%ebx
+     cd6:	74 e2                	je     cba <fopen+0x5a>
+    f->flags = IO_MALLOC;
+     cd8:	c7 43 04 80 00 00 00 	movl   $0x80,0x4(%ebx)
+  if(threaded)
+     cdf:	85 c0                	test   %eax,%eax
+     ce1:	0f 85 f9 00 00 00    	jne    de0 <fopen+0x180>
+  if(mode[0] == 'r'){
+     ce7:	80 3e 72             	cmpb   $0x72,(%esi)
+     cea:	0f 84 c0 00 00 00    	je     db0 <fopen+0x150>
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     cf0:	83 ec 08             	sub    $0x8,%esp
+     cf3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     cf6:	50                   	push   %eax
+     cf7:	57                   	push   %edi
+     cf8:	e8 d3 f5 ff ff       	call   2d0 <stat>
+     cfd:	83 c4 10             	add    $0x10,%esp
+     d00:	85 c0                	test   %eax,%eax
+     d02:	74 6c                	je     d70 <fopen+0x110>
+    fd = open(path, O_CREATE|O_WRONLY);
+     d04:	83 ec 08             	sub    $0x8,%esp
+     d07:	68 01 02 00 00       	push   $0x201
+     d0c:	57                   	push   %edi
+    flags = IO_WRITE;
+     d0d:	bf 02 00 00 00       	mov    $0x2,%edi
+    fd = open(path, O_CREATE|O_WRONLY);
+     d12:	e8 36 f8 ff ff       	call   54d <open>
+     d17:	83 c4 10             	add    $0x10,%esp
+     d1a:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     d1c:	85 f6                	test   %esi,%esi
+     d1e:	0f 88 a9 00 00 00    	js     dcd <fopen+0x16d>
+     d24:	83 ec 0c             	sub    $0xc,%esp
+     d27:	68 00 02 00 00       	push   $0x200
+     d2c:	e8 af 0c 00 00       	call   19e0 <malloc>
+     d31:	83 c4 10             	add    $0x10,%esp
+     d34:	89 43 08             	mov    %eax,0x8(%ebx)
+     d37:	85 c0                	test   %eax,%eax
+     d39:	0f 84 d0 00 00 00    	je     e0f <fopen+0x1af>
+  f->flags = flags|IO_MALLOC;
+     d3f:	81 cf 80 00 00 00    	or     $0x80,%edi
+  f->fd = fd;
+     d45:	89 33                	mov    %esi,(%ebx)
+  f->size = BUFSIZ;
+     d47:	c7 43 0c 00 02 00 00 	movl   $0x200,0xc(%ebx)
+  f->r = f->n = 0;
+     d4e:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+     d55:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  f->flags = flags|IO_MALLOC;
+     d5c:	89 7b 04             	mov    %edi,0x4(%ebx)
+}
+     d5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d62:	89 d8                	mov    %ebx,%eax
+     d64:	5b                   	pop    %ebx
+     d65:	5e                   	pop    %esi
+     d66:	5f                   	pop    %edi
+     d67:	5d                   	pop    %ebp
+     d68:	c3                   	ret
+     d69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     d70:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+     d75:	75 8d                	jne    d04 <fopen+0xa4>
+      unlink(path);
+     d77:	83 ec 0c             	sub    $0xc,%esp
+     d7a:	57                   	push   %edi
+     d7b:	e8 eb f7 ff ff       	call   56b <unlink>
+     d80:	83 c4 10             	add    $0x10,%esp
+     d83:	e9 7c ff ff ff       	jmp    d04 <fopen+0xa4>
+     d88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d8f:	90                   	nop
+    mutex_lock(&iolock);
+     d90:	83 ec 0c             	sub    $0xc,%esp
+     d93:	68 04 29 00 00       	push   $0x2904
+     d98:	e8 03 f6 ff ff       	call   3a0 <mutex_lock>
+  if(threaded)
+     d9d:	a1 00 29 00 00       	mov    0x2900,%eax
+     da2:	83 c4 10             	add    $0x10,%esp
+     da5:	e9 f9 fe ff ff       	jmp    ca3 <fopen+0x43>
+     daa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    fd = open(path, O_RDONLY);
+     db0:	83 ec 08             	sub    $0x8,%esp
+     db3:	6a 00                	push   $0x0
+     db5:	57                   	push   %edi
+    flags = IO_READ;
+     db6:	bf 01 00 00 00       	mov    $0x1,%edi
+    fd = open(path, O_RDONLY);
+     dbb:	e8 8d f7 ff ff       	call   54d <open>
+     dc0:	83 c4 10             	add    $0x10,%esp
+     dc3:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     dc5:	85 f6                	test   %esi,%esi
+     dc7:	0f 89 57 ff ff ff    	jns    d24 <fopen+0xc4>
+    f->flags = 0;
+     dcd:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    return 0;
+     dd4:	31 db                	xor    %ebx,%ebx
+     dd6:	eb 87                	jmp    d5f <fopen+0xff>
+     dd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ddf:	90                   	nop
+    mutex_unlock(&iolock);
+     de0:	83 ec 0c             	sub    $0xc,%esp
+     de3:	68 04 29 00 00       	push   $0x2904
+     de8:	e8 03 f6 ff ff       	call   3f0 <mutex_unlock>
+     ded:	83 c4 10             	add    $0x10,%esp
+     df0:	e9 f2 fe ff ff       	jmp    ce7 <fopen+0x87>
+     df5:	8d 76 00             	lea    0x0(%esi),%esi
+     df8:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+     dfb:	31 db                	xor    %ebx,%ebx
+    mutex_unlock(&iolock);
+     dfd:	68 04 29 00 00       	push   $0x2904
+     e02:	e8 e9 f5 ff ff       	call   3f0 <mutex_unlock>
+     e07:	83 c4 10             	add    $0x10,%esp
+     e0a:	e9 50 ff ff ff       	jmp    d5f <fopen+0xff>
+      close(fd);
+     e0f:	83 ec 0c             	sub    $0xc,%esp
+     e12:	56                   	push   %esi
+     e13:	e8 08 f7 ff ff       	call   520 <close>
+     e18:	83 c4 10             	add    $0x10,%esp
+     e1b:	eb b0                	jmp    dcd <fopen+0x16d>
+     e1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e20 <fclose>:
+{
+     e20:	55                   	push   %ebp
+     e21:	89 e5                	mov    %esp,%ebp
+     e23:	56                   	push   %esi
+     e24:	53                   	push   %ebx
+  if(threaded)
+     e25:	8b 15 00 29 00 00    	mov    0x2900,%edx
+{
+     e2b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+     e2e:	85 d2                	test   %edx,%edx
+     e30:	75 46                	jne    e78 <fclose+0x58>
+  r = flush(f);
+     e32:	89 d8                	mov    %ebx,%eax
+     e34:	e8 27 fc ff ff       	call   a60 <flush>
+  if(close(f->fd) < 0)
+     e39:	83 ec 0c             	sub    $0xc,%esp
+     e3c:	ff 33                	push   (%ebx)
+  r = flush(f);
+     e3e:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+     e40:	e8 db f6 ff ff       	call   520 <close>
+     e45:	83 c4 10             	add    $0x10,%esp
+    r = EOF;
+     e48:	85 c0                	test   %eax,%eax
+     e4a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     e4f:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->flags & IO_MALLOC)
+     e52:	f6 43 04 80          	testb  $0x80,0x4(%ebx)
+     e56:	75 58                	jne    eb0 <fclose+0x90>
+  if(threaded)
+     e58:	a1 00 29 00 00       	mov    0x2900,%eax
+  f->flags = 0;
+     e5d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  if(threaded)
+     e64:	85 c0                	test   %eax,%eax
+     e66:	75 28                	jne    e90 <fclose+0x70>
+}
+     e68:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e6b:	89 f0                	mov    %esi,%eax
+     e6d:	5b                   	pop    %ebx
+     e6e:	5e                   	pop    %esi
+     e6f:	5d                   	pop    %ebp
+     e70:	c3                   	ret
+     e71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     e78:	83 ec 0c             	sub    $0xc,%esp
+     e7b:	8d 43 18             	lea    0x18(%ebx),%eax
+     e7e:	50                   	push   %eax
+     e7f:	e8 1c f5 ff ff       	call   3a0 <mutex_lock>
+     e84:	83 c4 10             	add    $0x10,%esp
+     e87:	eb a9                	jmp    e32 <fclose+0x12>
+     e89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     e90:	83 ec 0c             	sub    $0xc,%esp
+     e93:	83 c3 18             	add    $0x18,%ebx
+     e96:	53                   	push   %ebx
+     e97:	e8 54 f5 ff ff       	call   3f0 <mutex_unlock>
+     e9c:	83 c4 10             	add    $0x10,%esp
+}
+     e9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ea2:	89 f0                	mov    %esi,%eax
+     ea4:	5b                   	pop    %ebx
+     ea5:	5e                   	pop    %esi
+     ea6:	5d                   	pop    %ebp
+     ea7:	c3                   	ret
+     ea8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     eaf:	90                   	nop
+    free(f->buf);
+     eb0:	83 ec 0c             	sub    $0xc,%esp
+     eb3:	ff 73 08             	push   0x8(%ebx)
+     eb6:	e8 f5 09 00 00       	call   18b0 <free>
+     ebb:	83 c4 10             	add    $0x10,%esp
+     ebe:	eb 98                	jmp    e58 <fclose+0x38>
+
+00000ec0 <fflush>:
+{
+     ec0:	55                   	push   %ebp
+     ec1:	89 e5                	mov    %esp,%ebp
+     ec3:	53                   	push   %ebx
+     ec4:	83 ec 14             	sub    $0x14,%esp
+     ec7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f == 0){
+     eca:	85 db                	test   %ebx,%ebx
+     ecc:	74 5a                	je     f28 <fflush+0x68>
+  if(threaded)
+     ece:	8b 0d 00 29 00 00    	mov    0x2900,%ecx
+     ed4:	85 c9                	test   %ecx,%ecx
+     ed6:	75 18                	jne    ef0 <fflush+0x30>
+  r = flush(f);
+     ed8:	89 d8                	mov    %ebx,%eax
+     eda:	e8 81 fb ff ff       	call   a60 <flush>
+  if(threaded)
+     edf:	8b 15 00 29 00 00    	mov    0x2900,%edx
+     ee5:	85 d2                	test   %edx,%edx
+     ee7:	75 1f                	jne    f08 <fflush+0x48>
+}
+     ee9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     eec:	c9                   	leave
+     eed:	c3                   	ret
+     eee:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+     ef0:	83 ec 0c             	sub    $0xc,%esp
+     ef3:	8d 43 18             	lea    0x18(%ebx),%eax
+     ef6:	50                   	push   %eax
+     ef7:	e8 a4 f4 ff ff       	call   3a0 <mutex_lock>
+     efc:	83 c4 10             	add    $0x10,%esp
+     eff:	eb d7                	jmp    ed8 <fflush+0x18>
+     f01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     f08:	83 ec 0c             	sub    $0xc,%esp
+     f0b:	83 c3 18             	add    $0x18,%ebx
+     f0e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     f11:	53                   	push   %ebx
+     f12:	e8 d9 f4 ff ff       	call   3f0 <mutex_unlock>
+     f17:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     f1a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    mutex_unlock(&f->lock);
+     f1d:	83 c4 10             	add    $0x10,%esp
+}
+     f20:	c9                   	leave
+     f21:	c3                   	ret
+     f22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     f28:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f2b:	c9                   	leave
+     f2c:	e9 af fb ff ff       	jmp    ae0 <fflush.part.0>
+     f31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f3f:	90                   	nop
+
+00000f40 <putc_unlocked>:
+{
+     f40:	55                   	push   %ebp
+     f41:	89 e5                	mov    %esp,%ebp
+     f43:	56                   	push   %esi
+     f44:	53                   	push   %ebx
+     f45:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     f48:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(!(f->flags & IO_WRITE))
+     f4b:	8b 43 04             	mov    0x4(%ebx),%eax
+     f4e:	a8 02                	test   $0x2,%al
+     f50:	74 46                	je     f98 <putc_unlocked+0x58>
+  if(!(f->flags & IO_SETUP))
+     f52:	a8 40                	test   $0x40,%al
+     f54:	74 4a                	je     fa0 <putc_unlocked+0x60>
+  if(f->n == f->size && flush(f) < 0)
+     f56:	8b 43 14             	mov    0x14(%ebx),%eax
+     f59:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     f5c:	74 51                	je     faf <putc_unlocked+0x6f>
+  f->buf[f->n++] = c;
+     f5e:	8d 48 01             	lea    0x1(%eax),%ecx
+     f61:	8b 53 08             	mov    0x8(%ebx),%edx
+     f64:	89 4b 14             	mov    %ecx,0x14(%ebx)
+     f67:	89 f1                	mov    %esi,%ecx
+     f69:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     f6c:	83 fe 0a             	cmp    $0xa,%esi
+     f6f:	74 0f                	je     f80 <putc_unlocked+0x40>
+  return c & 0xff;
+     f71:	89 f0                	mov    %esi,%eax
+     f73:	0f b6 c0             	movzbl %al,%eax
+}
+     f76:	5b                   	pop    %ebx
+     f77:	5e                   	pop    %esi
+     f78:	5d                   	pop    %ebp
+     f79:	c3                   	ret
+     f7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     f80:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+     f84:	74 eb                	je     f71 <putc_unlocked+0x31>
+     f86:	89 d8                	mov    %ebx,%eax
+     f88:	e8 d3 fa ff ff       	call   a60 <flush>
+     f8d:	85 c0                	test   %eax,%eax
+     f8f:	79 e0                	jns    f71 <putc_unlocked+0x31>
+     f91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return EOF;
+     f98:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     f9d:	eb d7                	jmp    f76 <putc_unlocked+0x36>
+     f9f:	90                   	nop
+    setup(f);
+     fa0:	89 d8                	mov    %ebx,%eax
+     fa2:	e8 69 fa ff ff       	call   a10 <setup>
+  if(f->n == f->size && flush(f) < 0)
+     fa7:	8b 43 14             	mov    0x14(%ebx),%eax
+     faa:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     fad:	75 af                	jne    f5e <putc_unlocked+0x1e>
+     faf:	89 d8                	mov    %ebx,%eax
+     fb1:	e8 aa fa ff ff       	call   a60 <flush>
+     fb6:	85 c0                	test   %eax,%eax
+     fb8:	78 de                	js     f98 <putc_unlocked+0x58>
+  f->buf[f->n++] = c;
+     fba:	8b 43 14             	mov    0x14(%ebx),%eax
+     fbd:	eb 9f                	jmp    f5e <putc_unlocked+0x1e>
+     fbf:	90                   	nop
+
+00000fc0 <fputc>:
+{
+     fc0:	55                   	push   %ebp
+     fc1:	89 e5                	mov    %esp,%ebp
+     fc3:	56                   	push   %esi
+     fc4:	53                   	push   %ebx
+  if(threaded)
+     fc5:	8b 15 00 29 00 00    	mov    0x2900,%edx
+{
+     fcb:	8b 75 08             	mov    0x8(%ebp),%esi
+     fce:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(threaded)
+     fd1:	85 d2                	test   %edx,%edx
+     fd3:	75 6b                	jne    1040 <fputc+0x80>
+  if(!(f->flags & IO_WRITE))
+     fd5:	8b 43 04             	mov    0x4(%ebx),%eax
+     fd8:	a8 02                	test   $0x2,%al
+     fda:	0f 84 b8 00 00 00    	je     1098 <fputc+0xd8>
+  if(!(f->flags & IO_SETUP))
+     fe0:	a8 40                	test   $0x40,%al
+     fe2:	74 76                	je     105a <fputc+0x9a>
+  if(f->n == f->size && flush(f) < 0)
+     fe4:	8b 43 14             	mov    0x14(%ebx),%eax
+     fe7:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     fea:	74 7d                	je     1069 <fputc+0xa9>
+  f->buf[f->n++] = c;
+     fec:	8d 48 01             	lea    0x1(%eax),%ecx
+     fef:	8b 53 08             	mov    0x8(%ebx),%edx
+     ff2:	89 4b 14             	mov    %ecx,0x14(%ebx)
+     ff5:	89 f1                	mov    %esi,%ecx
+     ff7:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     ffa:	83 fe 0a             	cmp    $0xa,%esi
+     ffd:	74 21                	je     1020 <fputc+0x60>
+  return c & 0xff;
+     fff:	89 f0                	mov    %esi,%eax
+    1001:	0f b6 f0             	movzbl %al,%esi
+  if(threaded)
+    1004:	a1 00 29 00 00       	mov    0x2900,%eax
+    1009:	85 c0                	test   %eax,%eax
+    100b:	75 73                	jne    1080 <fputc+0xc0>
+}
+    100d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1010:	89 f0                	mov    %esi,%eax
+    1012:	5b                   	pop    %ebx
+    1013:	5e                   	pop    %esi
+    1014:	5d                   	pop    %ebp
+    1015:	c3                   	ret
+    1016:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    101d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    1020:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1024:	74 d9                	je     fff <fputc+0x3f>
+    1026:	89 d8                	mov    %ebx,%eax
+    1028:	e8 33 fa ff ff       	call   a60 <flush>
+    102d:	85 c0                	test   %eax,%eax
+    102f:	79 ce                	jns    fff <fputc+0x3f>
+    return EOF;
+    1031:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1036:	eb cc                	jmp    1004 <fputc+0x44>
+    1038:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    103f:	90                   	nop
+    mutex_lock(&f->lock);
+    1040:	83 ec 0c             	sub    $0xc,%esp
+    1043:	8d 43 18             	lea    0x18(%ebx),%eax
+    1046:	50                   	push   %eax
+    1047:	e8 54 f3 ff ff       	call   3a0 <mutex_lock>
+  if(!(f->flags & IO_WRITE))
+    104c:	8b 43 04             	mov    0x4(%ebx),%eax
+    104f:	83 c4 10             	add    $0x10,%esp
+    1052:	a8 02                	test   $0x2,%al
+    1054:	74 db                	je     1031 <fputc+0x71>
+  if(!(f->flags & IO_SETUP))
+    1056:	a8 40                	test   $0x40,%al
+    1058:	75 8a                	jne    fe4 <fputc+0x24>
+    setup(f);
+    105a:	89 d8                	mov    %ebx,%eax
+    105c:	e8 af f9 ff ff       	call   a10 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    1061:	8b 43 14             	mov    0x14(%ebx),%eax
+    1064:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    1067:	75 83                	jne    fec <fputc+0x2c>
+    1069:	89 d8                	mov    %ebx,%eax
+    106b:	e8 f0 f9 ff ff       	call   a60 <flush>
+    1070:	85 c0                	test   %eax,%eax
+    1072:	78 bd                	js     1031 <fputc+0x71>
+  f->buf[f->n++] = c;
+    1074:	8b 43 14             	mov    0x14(%ebx),%eax
+    1077:	e9 70 ff ff ff       	jmp    fec <fputc+0x2c>
+    107c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1080:	83 ec 0c             	sub    $0xc,%esp
+    1083:	83 c3 18             	add    $0x18,%ebx
+    1086:	53                   	push   %ebx
+    1087:	e8 64 f3 ff ff       	call   3f0 <mutex_unlock>
+    108c:	83 c4 10             	add    $0x10,%esp
+}
+    108f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1092:	89 f0                	mov    %esi,%eax
+    1094:	5b                   	pop    %ebx
+    1095:	5e                   	pop    %esi
+    1096:	5d                   	pop    %ebp
+    1097:	c3                   	ret
+    return EOF;
+    1098:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    109d:	e9 6b ff ff ff       	jmp    100d <fputc+0x4d>
+    10a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000010b0 <fwrite>:
+{
+    10b0:	55                   	push   %ebp
+    10b1:	89 e5                	mov    %esp,%ebp
+    10b3:	57                   	push   %edi
+    10b4:	56                   	push   %esi
+    10b5:	53                   	push   %ebx
+    10b6:	83 ec 1c             	sub    $0x1c,%esp
+    10b9:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  if(!(f->flags & IO_WRITE) || size <= 0)
+    10bc:	8b 43 04             	mov    0x4(%ebx),%eax
+    10bf:	a8 02                	test   $0x2,%al
+    10c1:	0f 84 ec 00 00 00    	je     11b3 <fwrite+0x103>
+    10c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    10ca:	85 c9                	test   %ecx,%ecx
+    10cc:	0f 8e e1 00 00 00    	jle    11b3 <fwrite+0x103>
+  if(threaded)
+    10d2:	8b 15 00 29 00 00    	mov    0x2900,%edx
+    10d8:	85 d2                	test   %edx,%edx
+    10da:	0f 85 1c 01 00 00    	jne    11fc <fwrite+0x14c>
+  if(!(f->flags & IO_SETUP))
+    10e0:	a8 40                	test   $0x40,%al
+    10e2:	0f 84 08 01 00 00    	je     11f0 <fwrite+0x140>
+  for(len = size*nmemb; len > 0; len -= n){
+    10e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+    10eb:	0f af 45 10          	imul   0x10(%ebp),%eax
+    10ef:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    10f2:	85 c0                	test   %eax,%eax
+    10f4:	0f 8e 2a 01 00 00    	jle    1224 <fwrite+0x174>
+  s = p;
+    10fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  nl = 0;
+    10fd:	31 ff                	xor    %edi,%edi
+    10ff:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+        nl = 1;
+    1102:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  s = p;
+    1105:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1108:	8b 43 14             	mov    0x14(%ebx),%eax
+        nl = 1;
+    110b:	89 ce                	mov    %ecx,%esi
+    if(f->n == f->size && flush(f) < 0)
+    110d:	89 c2                	mov    %eax,%edx
+    110f:	39 f0                	cmp    %esi,%eax
+    1111:	74 6e                	je     1181 <fwrite+0xd1>
+    1113:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1117:	90                   	nop
+    if(n > len)
+    1118:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    n = f->size - f->n;
+    111b:	89 f1                	mov    %esi,%ecx
+    111d:	29 c1                	sub    %eax,%ecx
+    111f:	39 f9                	cmp    %edi,%ecx
+    1121:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1124:	85 c9                	test   %ecx,%ecx
+    1126:	0f 8e 7c 00 00 00    	jle    11a8 <fwrite+0xf8>
+    112c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    112f:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1132:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    1135:	8d 34 08             	lea    (%eax,%ecx,1),%esi
+    1138:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    113b:	eb 06                	jmp    1143 <fwrite+0x93>
+    113d:	8d 76 00             	lea    0x0(%esi),%esi
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1140:	8b 53 14             	mov    0x14(%ebx),%edx
+    1143:	8d 4a 01             	lea    0x1(%edx),%ecx
+    1146:	8b 73 08             	mov    0x8(%ebx),%esi
+    1149:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    114c:	0f b6 08             	movzbl (%eax),%ecx
+        nl = 1;
+    114f:	80 f9 0a             	cmp    $0xa,%cl
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1152:	88 0c 16             	mov    %cl,(%esi,%edx,1)
+        nl = 1;
+    1155:	be 01 00 00 00       	mov    $0x1,%esi
+    115a:	0f 44 fe             	cmove  %esi,%edi
+    for(i = 0; i < n; i++)
+    115d:	83 c0 01             	add    $0x1,%eax
+    1160:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    1163:	75 db                	jne    1140 <fwrite+0x90>
+    s += n;
+    1165:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1168:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    116b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    s += n;
+    116e:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    1171:	85 c0                	test   %eax,%eax
+    1173:	7e 48                	jle    11bd <fwrite+0x10d>
+    1175:	8b 43 14             	mov    0x14(%ebx),%eax
+    1178:	8b 73 0c             	mov    0xc(%ebx),%esi
+    if(f->n == f->size && flush(f) < 0)
+    117b:	89 c2                	mov    %eax,%edx
+    117d:	39 f0                	cmp    %esi,%eax
+    117f:	75 97                	jne    1118 <fwrite+0x68>
+    1181:	89 d8                	mov    %ebx,%eax
+    1183:	e8 d8 f8 ff ff       	call   a60 <flush>
+    1188:	85 c0                	test   %eax,%eax
+    118a:	78 31                	js     11bd <fwrite+0x10d>
+    n = f->size - f->n;
+    118c:	8b 73 0c             	mov    0xc(%ebx),%esi
+    118f:	8b 43 14             	mov    0x14(%ebx),%eax
+    1192:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    1195:	89 f1                	mov    %esi,%ecx
+    1197:	89 c2                	mov    %eax,%edx
+    1199:	29 c1                	sub    %eax,%ecx
+    119b:	39 f9                	cmp    %edi,%ecx
+    119d:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    11a0:	85 c9                	test   %ecx,%ecx
+    11a2:	7f 88                	jg     112c <fwrite+0x7c>
+    11a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    s += n;
+    11a8:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    11ab:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    11ae:	e9 5a ff ff ff       	jmp    110d <fwrite+0x5d>
+}
+    11b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    11b6:	31 c0                	xor    %eax,%eax
+}
+    11b8:	5b                   	pop    %ebx
+    11b9:	5e                   	pop    %esi
+    11ba:	5f                   	pop    %edi
+    11bb:	5d                   	pop    %ebp
+    11bc:	c3                   	ret
+  if(nl && (f->flags & IO_LINE))
+    11bd:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    11c0:	85 ff                	test   %edi,%edi
+    11c2:	74 06                	je     11ca <fwrite+0x11a>
+    11c4:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    11c8:	75 1d                	jne    11e7 <fwrite+0x137>
+  return (s - (const char*)p) / size;
+    11ca:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    11cd:	2b 75 08             	sub    0x8(%ebp),%esi
+  if(threaded)
+    11d0:	a1 00 29 00 00       	mov    0x2900,%eax
+    11d5:	85 c0                	test   %eax,%eax
+    11d7:	75 3a                	jne    1213 <fwrite+0x163>
+  return (s - (const char*)p) / size;
+    11d9:	89 f0                	mov    %esi,%eax
+    11db:	99                   	cltd
+    11dc:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    11df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11e2:	5b                   	pop    %ebx
+    11e3:	5e                   	pop    %esi
+    11e4:	5f                   	pop    %edi
+    11e5:	5d                   	pop    %ebp
+    11e6:	c3                   	ret
+    flush(f);
+    11e7:	89 d8                	mov    %ebx,%eax
+    11e9:	e8 72 f8 ff ff       	call   a60 <flush>
+    11ee:	eb da                	jmp    11ca <fwrite+0x11a>
+    setup(f);
+    11f0:	89 d8                	mov    %ebx,%eax
+    11f2:	e8 19 f8 ff ff       	call   a10 <setup>
+    11f7:	e9 ec fe ff ff       	jmp    10e8 <fwrite+0x38>
+    mutex_lock(&f->lock);
+    11fc:	83 ec 0c             	sub    $0xc,%esp
+    11ff:	8d 43 18             	lea    0x18(%ebx),%eax
+    1202:	50                   	push   %eax
+    1203:	e8 98 f1 ff ff       	call   3a0 <mutex_lock>
+  if(!(f->flags & IO_SETUP))
+    1208:	8b 43 04             	mov    0x4(%ebx),%eax
+    120b:	83 c4 10             	add    $0x10,%esp
+    120e:	e9 cd fe ff ff       	jmp    10e0 <fwrite+0x30>
+    mutex_unlock(&f->lock);
+    1213:	83 ec 0c             	sub    $0xc,%esp
+    1216:	83 c3 18             	add    $0x18,%ebx
+    1219:	53                   	push   %ebx
+    121a:	e8 d1 f1 ff ff       	call   3f0 <mutex_unlock>
+    121f:	83 c4 10             	add    $0x10,%esp
+    1222:	eb b5                	jmp    11d9 <fwrite+0x129>
+  for(len = size*nmemb; len > 0; len -= n){
+    1224:	31 f6                	xor    %esi,%esi
+    1226:	eb a8                	jmp    11d0 <fwrite+0x120>
+    1228:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    122f:	90                   	nop
+
+00001230 <fgetc>:
+  return f->buf[f->r++] & 0xff;
+}
+
+int
+fgetc(FILE *f)
+{
+    1230:	55                   	push   %ebp
+    1231:	89 e5                	mov    %esp,%ebp
+    1233:	56                   	push   %esi
+    1234:	53                   	push   %ebx
+  if(threaded)
+    1235:	8b 15 00 29 00 00    	mov    0x2900,%edx
+{
+    123b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    123e:	85 d2                	test   %edx,%edx
+    1240:	75 2e                	jne    1270 <fgetc+0x40>
+  if(!(f->flags & IO_READ))
+    1242:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1246:	74 78                	je     12c0 <fgetc+0x90>
+  if(f->r == f->n && fill(f) == 0)
+    1248:	8b 43 10             	mov    0x10(%ebx),%eax
+    124b:	3b 43 14             	cmp    0x14(%ebx),%eax
+    124e:	74 60                	je     12b0 <fgetc+0x80>
+  return f->buf[f->r++] & 0xff;
+    1250:	8b 53 08             	mov    0x8(%ebx),%edx
+    1253:	8d 48 01             	lea    0x1(%eax),%ecx
+    1256:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1259:	0f b6 34 02          	movzbl (%edx,%eax,1),%esi
+  if(threaded)
+    125d:	a1 00 29 00 00       	mov    0x2900,%eax
+    1262:	85 c0                	test   %eax,%eax
+    1264:	75 2a                	jne    1290 <fgetc+0x60>
+
+  flockfile(f);
+  c = getc_unlocked(f);
+  funlockfile(f);
+  return c;
+}
+    1266:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1269:	89 f0                	mov    %esi,%eax
+    126b:	5b                   	pop    %ebx
+    126c:	5e                   	pop    %esi
+    126d:	5d                   	pop    %ebp
+    126e:	c3                   	ret
+    126f:	90                   	nop
+    mutex_lock(&f->lock);
+    1270:	83 ec 0c             	sub    $0xc,%esp
+    1273:	8d 43 18             	lea    0x18(%ebx),%eax
+    1276:	50                   	push   %eax
+    1277:	e8 24 f1 ff ff       	call   3a0 <mutex_lock>
+  if(!(f->flags & IO_READ))
+    127c:	83 c4 10             	add    $0x10,%esp
+    127f:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1283:	75 c3                	jne    1248 <fgetc+0x18>
+    return EOF;
+    1285:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    128a:	eb d1                	jmp    125d <fgetc+0x2d>
+    128c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1290:	83 ec 0c             	sub    $0xc,%esp
+    1293:	83 c3 18             	add    $0x18,%ebx
+    1296:	53                   	push   %ebx
+    1297:	e8 54 f1 ff ff       	call   3f0 <mutex_unlock>
+    129c:	83 c4 10             	add    $0x10,%esp
+}
+    129f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12a2:	89 f0                	mov    %esi,%eax
+    12a4:	5b                   	pop    %ebx
+    12a5:	5e                   	pop    %esi
+    12a6:	5d                   	pop    %ebp
+    12a7:	c3                   	ret
+    12a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12af:	90                   	nop
+  if(f->r == f->n && fill(f) == 0)
+    12b0:	89 d8                	mov    %ebx,%eax
+    12b2:	e8 c9 f8 ff ff       	call   b80 <fill>
+    12b7:	85 c0                	test   %eax,%eax
+    12b9:	74 ca                	je     1285 <fgetc+0x55>
+  return f->buf[f->r++] & 0xff;
+    12bb:	8b 43 10             	mov    0x10(%ebx),%eax
+    12be:	eb 90                	jmp    1250 <fgetc+0x20>
+    return EOF;
+    12c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    12c5:	eb 9f                	jmp    1266 <fgetc+0x36>
+    12c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ce:	66 90                	xchg   %ax,%ax
+
+000012d0 <fread>:
+
+int
+fread(void *p, int size, int nmemb, FILE *f)
+{
+    12d0:	55                   	push   %ebp
+    12d1:	89 e5                	mov    %esp,%ebp
+    12d3:	57                   	push   %edi
+    12d4:	56                   	push   %esi
+    12d5:	53                   	push   %ebx
+    12d6:	83 ec 1c             	sub    $0x1c,%esp
+    12d9:	8b 75 14             	mov    0x14(%ebp),%esi
+  char *d;
+  int n, len;
+
+  if(!(f->flags & IO_READ) || size <= 0)
+    12dc:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+    12e0:	74 7e                	je     1360 <fread+0x90>
+    12e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+    12e5:	85 d2                	test   %edx,%edx
+    12e7:	7e 77                	jle    1360 <fread+0x90>
+  if(threaded)
+    12e9:	a1 00 29 00 00       	mov    0x2900,%eax
+    return 0;
+  flockfile(f);
+  d = p;
+  for(len = size*nmemb; len > 0; len -= n){
+    12ee:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    12f1:	0f af 7d 10          	imul   0x10(%ebp),%edi
+  if(threaded)
+    12f5:	85 c0                	test   %eax,%eax
+    12f7:	0f 85 93 00 00 00    	jne    1390 <fread+0xc0>
+  for(len = size*nmemb; len > 0; len -= n){
+    12fd:	85 ff                	test   %edi,%edi
+    12ff:	7e 61                	jle    1362 <fread+0x92>
+    if(f->r == f->n && fill(f) == 0)
+    1301:	8b 46 10             	mov    0x10(%esi),%eax
+  d = p;
+    1304:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1307:	eb 35                	jmp    133e <fread+0x6e>
+    1309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      break;
+    n = f->n - f->r;
+    1310:	29 c3                	sub    %eax,%ebx
+    1312:	39 fb                	cmp    %edi,%ebx
+    1314:	0f 4f df             	cmovg  %edi,%ebx
+    if(n > len)
+      n = len;
+    memmove(d, f->buf + f->r, n);
+    1317:	83 ec 04             	sub    $0x4,%esp
+    131a:	53                   	push   %ebx
+    131b:	03 46 08             	add    0x8(%esi),%eax
+  for(len = size*nmemb; len > 0; len -= n){
+    131e:	29 df                	sub    %ebx,%edi
+    memmove(d, f->buf + f->r, n);
+    1320:	50                   	push   %eax
+    1321:	51                   	push   %ecx
+    1322:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1325:	e8 36 f0 ff ff       	call   360 <memmove>
+    f->r += n;
+    132a:	8b 46 10             	mov    0x10(%esi),%eax
+    d += n;
+    132d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1330:	83 c4 10             	add    $0x10,%esp
+    f->r += n;
+    1333:	01 d8                	add    %ebx,%eax
+    d += n;
+    1335:	01 d9                	add    %ebx,%ecx
+    f->r += n;
+    1337:	89 46 10             	mov    %eax,0x10(%esi)
+  for(len = size*nmemb; len > 0; len -= n){
+    133a:	85 ff                	test   %edi,%edi
+    133c:	7e 32                	jle    1370 <fread+0xa0>
+    if(f->r == f->n && fill(f) == 0)
+    133e:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1341:	39 c3                	cmp    %eax,%ebx
+    1343:	75 cb                	jne    1310 <fread+0x40>
+    1345:	89 f0                	mov    %esi,%eax
+    1347:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    134a:	e8 31 f8 ff ff       	call   b80 <fill>
+    134f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1352:	85 c0                	test   %eax,%eax
+    1354:	74 1a                	je     1370 <fread+0xa0>
+    n = f->n - f->r;
+    1356:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1359:	8b 46 10             	mov    0x10(%esi),%eax
+    135c:	eb b2                	jmp    1310 <fread+0x40>
+    135e:	66 90                	xchg   %ax,%ax
+    return 0;
+    1360:	31 c0                	xor    %eax,%eax
+  }
+  funlockfile(f);
+  return (d - (char*)p) / size;
+}
+    1362:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1365:	5b                   	pop    %ebx
+    1366:	5e                   	pop    %esi
+    1367:	5f                   	pop    %edi
+    1368:	5d                   	pop    %ebp
+    1369:	c3                   	ret
+    136a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (d - (char*)p) / size;
+    1370:	2b 4d 08             	sub    0x8(%ebp),%ecx
+    1373:	89 cb                	mov    %ecx,%ebx
+  if(threaded)
+    1375:	a1 00 29 00 00       	mov    0x2900,%eax
+    137a:	85 c0                	test   %eax,%eax
+    137c:	75 32                	jne    13b0 <fread+0xe0>
+  return (d - (char*)p) / size;
+    137e:	89 d8                	mov    %ebx,%eax
+    1380:	99                   	cltd
+    1381:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1384:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1387:	5b                   	pop    %ebx
+    1388:	5e                   	pop    %esi
+    1389:	5f                   	pop    %edi
+    138a:	5d                   	pop    %ebp
+    138b:	c3                   	ret
+    138c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    1390:	83 ec 0c             	sub    $0xc,%esp
+    1393:	8d 46 18             	lea    0x18(%esi),%eax
+    1396:	50                   	push   %eax
+    1397:	e8 04 f0 ff ff       	call   3a0 <mutex_lock>
+  for(len = size*nmemb; len > 0; len -= n){
+    139c:	83 c4 10             	add    $0x10,%esp
+    139f:	85 ff                	test   %edi,%edi
+    13a1:	0f 8f 5a ff ff ff    	jg     1301 <fread+0x31>
+    13a7:	31 db                	xor    %ebx,%ebx
+    13a9:	eb ca                	jmp    1375 <fread+0xa5>
+    13ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    13af:	90                   	nop
+    mutex_unlock(&f->lock);
+    13b0:	83 ec 0c             	sub    $0xc,%esp
+    13b3:	83 c6 18             	add    $0x18,%esi
+    13b6:	56                   	push   %esi
+    13b7:	e8 34 f0 ff ff       	call   3f0 <mutex_unlock>
+  return (d - (char*)p) / size;
+    13bc:	89 d8                	mov    %ebx,%eax
+    13be:	83 c4 10             	add    $0x10,%esp
+    13c1:	99                   	cltd
+    13c2:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    13c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13c8:	5b                   	pop    %ebx
+    13c9:	5e                   	pop    %esi
+    13ca:	5f                   	pop    %edi
+    13cb:	5d                   	pop    %ebp
+    13cc:	c3                   	ret
+    13cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000013d0 <fgets>:
+
+// Read a line of at most max-1 bytes, keeping the newline.
+// Returns 0 if there was nothing left to read.
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    13d0:	55                   	push   %ebp
+    13d1:	89 e5                	mov    %esp,%ebp
+    13d3:	57                   	push   %edi
+    13d4:	56                   	push   %esi
+    13d5:	53                   	push   %ebx
+    13d6:	83 ec 1c             	sub    $0x1c,%esp
+  if(threaded)
+    13d9:	8b 35 00 29 00 00    	mov    0x2900,%esi
+{
+    13df:	8b 7d 08             	mov    0x8(%ebp),%edi
+    13e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if(threaded)
+    13e5:	85 f6                	test   %esi,%esi
+    13e7:	0f 85 83 00 00 00    	jne    1470 <fgets+0xa0>
+{
+    13ed:	31 f6                	xor    %esi,%esi
+    13ef:	eb 2a                	jmp    141b <fgets+0x4b>
+    13f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return f->buf[f->r++] & 0xff;
+    13f8:	8b 53 08             	mov    0x8(%ebx),%edx
+    13fb:	8d 48 01             	lea    0x1(%eax),%ecx
+    13fe:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1401:	0f b6 14 02          	movzbl (%edx,%eax,1),%edx
+
+  flockfile(f);
+  for(i = 0; i+1 < max; ){
+    if((c = getc_unlocked(f)) == EOF)
+      break;
+    buf[i++] = c;
+    1405:	88 54 37 ff          	mov    %dl,-0x1(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    1409:	80 fa 0a             	cmp    $0xa,%dl
+    140c:	0f 84 96 00 00 00    	je     14a8 <fgets+0xd8>
+    1412:	83 fa 0d             	cmp    $0xd,%edx
+    1415:	0f 84 8d 00 00 00    	je     14a8 <fgets+0xd8>
+  for(i = 0; i+1 < max; ){
+    141b:	89 f2                	mov    %esi,%edx
+    141d:	83 c6 01             	add    $0x1,%esi
+    1420:	3b 75 0c             	cmp    0xc(%ebp),%esi
+    1423:	7d 2b                	jge    1450 <fgets+0x80>
+  if(!(f->flags & IO_READ))
+    1425:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1429:	74 25                	je     1450 <fgets+0x80>
+  if(f->r == f->n && fill(f) == 0)
+    142b:	8b 43 10             	mov    0x10(%ebx),%eax
+    142e:	3b 43 14             	cmp    0x14(%ebx),%eax
+    1431:	75 c5                	jne    13f8 <fgets+0x28>
+    1433:	89 d8                	mov    %ebx,%eax
+    1435:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1438:	e8 43 f7 ff ff       	call   b80 <fill>
+    143d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1440:	85 c0                	test   %eax,%eax
+    1442:	74 0c                	je     1450 <fgets+0x80>
+  return f->buf[f->r++] & 0xff;
+    1444:	8b 43 10             	mov    0x10(%ebx),%eax
+    1447:	eb af                	jmp    13f8 <fgets+0x28>
+    1449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1450:	8b 0d 00 29 00 00    	mov    0x2900,%ecx
+      break;
+  }
+  buf[i] = '\0';
+    1456:	c6 04 17 00          	movb   $0x0,(%edi,%edx,1)
+  if(threaded)
+    145a:	85 c9                	test   %ecx,%ecx
+    145c:	75 2a                	jne    1488 <fgets+0xb8>
+  funlockfile(f);
+  return i > 0 ? buf : 0;
+    145e:	31 c0                	xor    %eax,%eax
+    1460:	85 d2                	test   %edx,%edx
+    1462:	74 02                	je     1466 <fgets+0x96>
+    1464:	89 f8                	mov    %edi,%eax
+}
+    1466:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1469:	5b                   	pop    %ebx
+    146a:	5e                   	pop    %esi
+    146b:	5f                   	pop    %edi
+    146c:	5d                   	pop    %ebp
+    146d:	c3                   	ret
+    146e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    1470:	83 ec 0c             	sub    $0xc,%esp
+    1473:	8d 43 18             	lea    0x18(%ebx),%eax
+    1476:	50                   	push   %eax
+    1477:	e8 24 ef ff ff       	call   3a0 <mutex_lock>
+    147c:	83 c4 10             	add    $0x10,%esp
+    147f:	e9 69 ff ff ff       	jmp    13ed <fgets+0x1d>
+    1484:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1488:	83 ec 0c             	sub    $0xc,%esp
+    148b:	83 c3 18             	add    $0x18,%ebx
+    148e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1491:	53                   	push   %ebx
+    1492:	e8 59 ef ff ff       	call   3f0 <mutex_unlock>
+    1497:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    149a:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    149d:	31 c0                	xor    %eax,%eax
+    149f:	85 d2                	test   %edx,%edx
+    14a1:	75 c1                	jne    1464 <fgets+0x94>
+    14a3:	eb c1                	jmp    1466 <fgets+0x96>
+    14a5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    14a8:	a1 00 29 00 00       	mov    0x2900,%eax
+  buf[i] = '\0';
+    14ad:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  if(threaded)
+    14b1:	85 c0                	test   %eax,%eax
+    14b3:	74 af                	je     1464 <fgets+0x94>
+    mutex_unlock(&f->lock);
+    14b5:	83 ec 0c             	sub    $0xc,%esp
+    14b8:	83 c3 18             	add    $0x18,%ebx
+    14bb:	53                   	push   %ebx
+    14bc:	e8 2f ef ff ff       	call   3f0 <mutex_unlock>
+    14c1:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    14c4:	89 f8                	mov    %edi,%eax
+    14c6:	eb 9e                	jmp    1466 <fgets+0x96>
+    14c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14cf:	90                   	nop
+
+000014d0 <gets>:
+// at most a line per read(), goes through stdin's buffer: from a
+// file or pipe, a buffered read could take input meant for a child
+// process, so read a byte at a time.
+char*
+gets(char *buf, int max)
+{
+    14d0:	55                   	push   %ebp
+    14d1:	89 e5                	mov    %esp,%ebp
+    14d3:	57                   	push   %edi
+    14d4:	56                   	push   %esi
+    14d5:	53                   	push   %ebx
+    14d6:	83 ec 2c             	sub    $0x2c,%esp
+  int i, cc;
+  char c;
+
+  if(!(stdin->flags & IO_SETUP))
+    14d9:	8b 15 04 28 00 00    	mov    0x2804,%edx
+{
+    14df:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!(stdin->flags & IO_SETUP))
+    14e2:	f6 c2 40             	test   $0x40,%dl
+    14e5:	74 79                	je     1560 <gets+0x90>
+    setup(stdin);
+  if(stdin->flags & IO_DEV){
+    14e7:	83 e2 20             	and    $0x20,%edx
+    14ea:	89 d7                	mov    %edx,%edi
+    14ec:	75 52                	jne    1540 <gets+0x70>
+  if(f == 0){
+    14ee:	e8 ed f5 ff ff       	call   ae0 <fflush.part.0>
+    fgets(buf, max, stdin);
+    return buf;
+  }
+  fflush(0);
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    14f3:	8d 75 e7             	lea    -0x19(%ebp),%esi
+  for(i=0; i+1 < max; ){
+    14f6:	eb 2c                	jmp    1524 <gets+0x54>
+    14f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14ff:	90                   	nop
+    cc = read(0, &c, 1);
+    1500:	83 ec 04             	sub    $0x4,%esp
+    1503:	6a 01                	push   $0x1
+    1505:	56                   	push   %esi
+    1506:	6a 00                	push   $0x0
+    1508:	e8 f5 ef ff ff       	call   502 <read>
+    if(cc < 1)
+    150d:	83 c4 10             	add    $0x10,%esp
+    1510:	85 c0                	test   %eax,%eax
+    1512:	7e 1b                	jle    152f <gets+0x5f>
+      break;
+    buf[i++] = c;
+    1514:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1518:	88 44 3b ff          	mov    %al,-0x1(%ebx,%edi,1)
+    if(c == '\n' || c == '\r')
+    151c:	3c 0a                	cmp    $0xa,%al
+    151e:	74 12                	je     1532 <gets+0x62>
+    1520:	3c 0d                	cmp    $0xd,%al
+    1522:	74 0e                	je     1532 <gets+0x62>
+  for(i=0; i+1 < max; ){
+    1524:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    1527:	83 c7 01             	add    $0x1,%edi
+    152a:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+    152d:	7c d1                	jl     1500 <gets+0x30>
+{
+    152f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      break;
+  }
+  buf[i] = '\0';
+    1532:	c6 04 3b 00          	movb   $0x0,(%ebx,%edi,1)
+  return buf;
+}
+    1536:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1539:	89 d8                	mov    %ebx,%eax
+    153b:	5b                   	pop    %ebx
+    153c:	5e                   	pop    %esi
+    153d:	5f                   	pop    %edi
+    153e:	5d                   	pop    %ebp
+    153f:	c3                   	ret
+    fgets(buf, max, stdin);
+    1540:	83 ec 04             	sub    $0x4,%esp
+    1543:	68 00 28 00 00       	push   $0x2800
+    1548:	ff 75 0c             	push   0xc(%ebp)
+    154b:	53                   	push   %ebx
+    154c:	e8 7f fe ff ff       	call   13d0 <fgets>
+    return buf;
+    1551:	83 c4 10             	add    $0x10,%esp
+}
+    1554:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1557:	89 d8                	mov    %ebx,%eax
+    1559:	5b                   	pop    %ebx
+    155a:	5e                   	pop    %esi
+    155b:	5f                   	pop    %edi
+    155c:	5d                   	pop    %ebp
+    155d:	c3                   	ret
+    155e:	66 90                	xchg   %ax,%ax
+    setup(stdin);
+    1560:	b8 00 28 00 00       	mov    $0x2800,%eax
+    1565:	e8 a6 f4 ff ff       	call   a10 <setup>
+  if(stdin->flags & IO_DEV){
+    156a:	8b 15 04 28 00 00    	mov    0x2804,%edx
+    1570:	e9 72 ff ff ff       	jmp    14e7 <gets+0x17>
+    1575:	66 90                	xchg   %ax,%ax
+    1577:	66 90                	xchg   %ax,%ax
+    1579:	66 90                	xchg   %ax,%ax
+    157b:	66 90                	xchg   %ax,%ax
+    157d:	66 90                	xchg   %ax,%ax
+    157f:	90                   	nop
+
+00001580 <bigfree>:
+
+// Give a big block back to the first-fit list, and return the
+// free block that now holds it. Caller holds lock.
+static Header*
+bigfree(Header *bp)
+{
+    1580:	55                   	push   %ebp
+    1581:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1583:	a1 a4 2f 00 00       	mov    0x2fa4,%eax
+{
+    1588:	89 e5                	mov    %esp,%ebp
+    158a:	56                   	push   %esi
+    158b:	53                   	push   %ebx
+    158c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1590:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1592:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1594:	39 ca                	cmp    %ecx,%edx
+    1596:	73 38                	jae    15d0 <bigfree+0x50>
+    1598:	39 c1                	cmp    %eax,%ecx
+    159a:	72 04                	jb     15a0 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    159c:	39 c2                	cmp    %eax,%edx
+    159e:	72 f0                	jb     1590 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    15a0:	8b 59 04             	mov    0x4(%ecx),%ebx
+    15a3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    15a6:	39 f0                	cmp    %esi,%eax
+    15a8:	74 36                	je     15e0 <bigfree+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    15aa:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  freep = p;
+  if(p + p->s.size == bp){
+    15ac:	8b 42 04             	mov    0x4(%edx),%eax
+    15af:	89 cb                	mov    %ecx,%ebx
+  freep = p;
+    15b1:	89 15 a4 2f 00 00    	mov    %edx,0x2fa4
+  if(p + p->s.size == bp){
+    15b7:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    15ba:	39 f1                	cmp    %esi,%ecx
+    15bc:	74 2e                	je     15ec <bigfree+0x6c>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    15be:	89 1a                	mov    %ebx,(%edx)
+    return p;
+  }
+  p->s.ptr = bp;
+  return bp;
+}
+    15c0:	89 c8                	mov    %ecx,%eax
+    15c2:	5b                   	pop    %ebx
+    15c3:	5e                   	pop    %esi
+    15c4:	5d                   	pop    %ebp
+    15c5:	c3                   	ret
+    15c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15cd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    15d0:	39 c1                	cmp    %eax,%ecx
+    15d2:	72 c8                	jb     159c <bigfree+0x1c>
+    15d4:	eb ba                	jmp    1590 <bigfree+0x10>
+    15d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    15e0:	03 58 04             	add    0x4(%eax),%ebx
+    15e3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    15e6:	8b 02                	mov    (%edx),%eax
+    15e8:	8b 00                	mov    (%eax),%eax
+    15ea:	eb be                	jmp    15aa <bigfree+0x2a>
+    p->s.size += bp->s.size;
+    15ec:	03 41 04             	add    0x4(%ecx),%eax
+    15ef:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    15f2:	8b 19                	mov    (%ecx),%ebx
+    return p;
+    15f4:	89 d1                	mov    %edx,%ecx
+}
+    15f6:	89 c8                	mov    %ecx,%eax
+    p->s.ptr = bp->s.ptr;
+    15f8:	89 1a                	mov    %ebx,(%edx)
+}
+    15fa:	5b                   	pop    %ebx
+    15fb:	5e                   	pop    %esi
+    15fc:	5d                   	pop    %ebp
+    15fd:	c3                   	ret
+    15fe:	66 90                	xchg   %ax,%ax
+
+00001600 <trim>:
+// If free block bp ends the heap, return its whole pages to the
+// kernel, unless something else has moved the break since.
+// Caller holds lock.
+static void
+trim(Header *bp)
+{
+    1600:	55                   	push   %ebp
+    1601:	89 e5                	mov    %esp,%ebp
+    1603:	57                   	push   %edi
+    1604:	56                   	push   %esi
+    1605:	53                   	push   %ebx
+    1606:	89 c3                	mov    %eax,%ebx
+    1608:	83 ec 0c             	sub    $0xc,%esp
+  char *end;
+  uint n;
+
+  if((char*)(bp + bp->s.size) != heapend)
+    160b:	8b 53 04             	mov    0x4(%ebx),%edx
+    160e:	a1 a0 2f 00 00       	mov    0x2fa0,%eax
+    1613:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+    1616:	39 d0                	cmp    %edx,%eax
+    1618:	74 0e                	je     1628 <trim+0x28>
+  n = heapend - end;
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    bp->s.size -= n / sizeof(Header);
+    heapend = end;
+  }
+}
+    161a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    161d:	5b                   	pop    %ebx
+    161e:	5e                   	pop    %esi
+    161f:	5f                   	pop    %edi
+    1620:	5d                   	pop    %ebp
+    1621:	c3                   	ret
+    1622:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  end = (char*)PGROUNDUP((uint)(bp + 2));
+    1628:	8d bb 0f 10 00 00    	lea    0x100f(%ebx),%edi
+    162e:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  n = heapend - end;
+    1634:	29 f8                	sub    %edi,%eax
+    1636:	89 c6                	mov    %eax,%esi
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    1638:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    163d:	76 db                	jbe    161a <trim+0x1a>
+    163f:	83 ec 0c             	sub    $0xc,%esp
+    1642:	6a 00                	push   $0x0
+    1644:	e8 8b ef ff ff       	call   5d4 <sbrk>
+    1649:	83 c4 10             	add    $0x10,%esp
+    164c:	39 05 a0 2f 00 00    	cmp    %eax,0x2fa0
+    1652:	75 c6                	jne    161a <trim+0x1a>
+    1654:	89 f0                	mov    %esi,%eax
+    1656:	83 ec 0c             	sub    $0xc,%esp
+    1659:	f7 d8                	neg    %eax
+    165b:	50                   	push   %eax
+    165c:	e8 73 ef ff ff       	call   5d4 <sbrk>
+    1661:	83 c4 10             	add    $0x10,%esp
+    1664:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1667:	74 b1                	je     161a <trim+0x1a>
+    bp->s.size -= n / sizeof(Header);
+    1669:	89 f0                	mov    %esi,%eax
+    heapend = end;
+    166b:	89 3d a0 2f 00 00    	mov    %edi,0x2fa0
+    bp->s.size -= n / sizeof(Header);
+    1671:	c1 e8 03             	shr    $0x3,%eax
+    1674:	29 43 04             	sub    %eax,0x4(%ebx)
+    heapend = end;
+    1677:	eb a1                	jmp    161a <trim+0x1a>
+    1679:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001680 <bigalloc>:
+}
+
+// Allocate a big block of nunits units. Caller holds lock.
+static Header*
+bigalloc(uint nunits)
+{
+    1680:	55                   	push   %ebp
+    1681:	89 e5                	mov    %esp,%ebp
+    1683:	57                   	push   %edi
+    1684:	89 c7                	mov    %eax,%edi
+    1686:	56                   	push   %esi
+    1687:	53                   	push   %ebx
+    1688:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    168b:	a1 a4 2f 00 00       	mov    0x2fa4,%eax
+    1690:	85 c0                	test   %eax,%eax
+    1692:	0f 84 98 00 00 00    	je     1730 <bigalloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1698:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    169a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    169d:	39 f9                	cmp    %edi,%ecx
+    169f:	73 67                	jae    1708 <bigalloc+0x88>
+  if(nu < 4096)
+    16a1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    16a6:	39 df                	cmp    %ebx,%edi
+    16a8:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    16ab:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    16b2:	eb 0d                	jmp    16c1 <bigalloc+0x41>
+    16b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    16b8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    16ba:	8b 4a 04             	mov    0x4(%edx),%ecx
+    16bd:	39 f9                	cmp    %edi,%ecx
+    16bf:	73 47                	jae    1708 <bigalloc+0x88>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    16c1:	89 d0                	mov    %edx,%eax
+    16c3:	39 15 a4 2f 00 00    	cmp    %edx,0x2fa4
+    16c9:	75 ed                	jne    16b8 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    16cb:	83 ec 0c             	sub    $0xc,%esp
+    16ce:	56                   	push   %esi
+    16cf:	e8 00 ef ff ff       	call   5d4 <sbrk>
+  if(p == (char*)-1)
+    16d4:	83 c4 10             	add    $0x10,%esp
+    16d7:	83 f8 ff             	cmp    $0xffffffff,%eax
+    16da:	74 1a                	je     16f6 <bigalloc+0x76>
+  hp->s.size = nu;
+    16dc:	89 58 04             	mov    %ebx,0x4(%eax)
+  heapend = p + nu * sizeof(Header);
+    16df:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    16e2:	89 15 a0 2f 00 00    	mov    %edx,0x2fa0
+  bigfree(hp);
+    16e8:	e8 93 fe ff ff       	call   1580 <bigfree>
+  return freep;
+    16ed:	a1 a4 2f 00 00       	mov    0x2fa4,%eax
+      if((p = morecore(nunits)) == 0)
+    16f2:	85 c0                	test   %eax,%eax
+    16f4:	75 c2                	jne    16b8 <bigalloc+0x38>
+        return 0;
+  }
+}
+    16f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    16f9:	31 d2                	xor    %edx,%edx
+}
+    16fb:	5b                   	pop    %ebx
+    16fc:	89 d0                	mov    %edx,%eax
+    16fe:	5e                   	pop    %esi
+    16ff:	5f                   	pop    %edi
+    1700:	5d                   	pop    %ebp
+    1701:	c3                   	ret
+    1702:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1708:	39 cf                	cmp    %ecx,%edi
+    170a:	74 54                	je     1760 <bigalloc+0xe0>
+        p->s.size -= nunits;
+    170c:	29 f9                	sub    %edi,%ecx
+    170e:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    1711:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    1714:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    1717:	a3 a4 2f 00 00       	mov    %eax,0x2fa4
+}
+    171c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    171f:	89 d0                	mov    %edx,%eax
+    1721:	5b                   	pop    %ebx
+    1722:	5e                   	pop    %esi
+    1723:	5f                   	pop    %edi
+    1724:	5d                   	pop    %ebp
+    1725:	c3                   	ret
+    1726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    172d:	8d 76 00             	lea    0x0(%esi),%esi
+    base.s.ptr = freep = prevp = &base;
+    1730:	c7 05 a4 2f 00 00 a8 	movl   $0x2fa8,0x2fa4
+    1737:	2f 00 00 
+    base.s.size = 0;
+    173a:	ba a8 2f 00 00       	mov    $0x2fa8,%edx
+    base.s.ptr = freep = prevp = &base;
+    173f:	c7 05 a8 2f 00 00 a8 	movl   $0x2fa8,0x2fa8
+    1746:	2f 00 00 
+    base.s.size = 0;
+    1749:	c7 05 ac 2f 00 00 00 	movl   $0x0,0x2fac
+    1750:	00 00 00 
+    if(p->s.size >= nunits){
+    1753:	e9 49 ff ff ff       	jmp    16a1 <bigalloc+0x21>
+    1758:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    175f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1760:	8b 0a                	mov    (%edx),%ecx
+    1762:	89 08                	mov    %ecx,(%eax)
+    1764:	eb b1                	jmp    1717 <bigalloc+0x97>
+    1766:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    176d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001770 <drain>:
+}
+
+// Move n blocks of class c from cache tc to the shared list.
+static void
+drain(struct tcache *tc, int c, int n)
+{
+    1770:	55                   	push   %ebp
+    1771:	89 e5                	mov    %esp,%ebp
+    1773:	57                   	push   %edi
+    1774:	89 c7                	mov    %eax,%edi
+    1776:	56                   	push   %esi
+    1777:	89 d6                	mov    %edx,%esi
+    1779:	53                   	push   %ebx
+    177a:	89 cb                	mov    %ecx,%ebx
+    177c:	83 ec 0c             	sub    $0xc,%esp
+  if(threaded)
+    177f:	8b 15 24 2f 00 00    	mov    0x2f24,%edx
+    1785:	85 d2                	test   %edx,%edx
+    1787:	75 57                	jne    17e0 <drain+0x70>
+  Header *p;
+
+  acquire();
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1789:	85 c9                	test   %ecx,%ecx
+    178b:	7e 49                	jle    17d6 <drain+0x66>
+    178d:	89 d9                	mov    %ebx,%ecx
+    178f:	8d 14 b7             	lea    (%edi,%esi,4),%edx
+    1792:	eb 23                	jmp    17b7 <drain+0x47>
+    1794:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    tc->list[c] = p->s.ptr;
+    1798:	8b 18                	mov    (%eax),%ebx
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    179a:	83 e9 01             	sub    $0x1,%ecx
+    tc->n[c]--;
+    179d:	83 6a 20 01          	subl   $0x1,0x20(%edx)
+    tc->list[c] = p->s.ptr;
+    17a1:	89 1a                	mov    %ebx,(%edx)
+    p->s.ptr = small[c];
+    17a3:	8b 1c b5 80 2f 00 00 	mov    0x2f80(,%esi,4),%ebx
+    17aa:	89 18                	mov    %ebx,(%eax)
+    small[c] = p;
+    17ac:	89 04 b5 80 2f 00 00 	mov    %eax,0x2f80(,%esi,4)
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    17b3:	85 c9                	test   %ecx,%ecx
+    17b5:	7e 06                	jle    17bd <drain+0x4d>
+    17b7:	8b 02                	mov    (%edx),%eax
+    17b9:	85 c0                	test   %eax,%eax
+    17bb:	75 db                	jne    1798 <drain+0x28>
+  if(threaded)
+    17bd:	a1 24 2f 00 00       	mov    0x2f24,%eax
+    17c2:	85 c0                	test   %eax,%eax
+    17c4:	74 10                	je     17d6 <drain+0x66>
+    mutex_unlock(&lock);
+    17c6:	83 ec 0c             	sub    $0xc,%esp
+    17c9:	68 28 2f 00 00       	push   $0x2f28
+    17ce:	e8 1d ec ff ff       	call   3f0 <mutex_unlock>
+}
+    17d3:	83 c4 10             	add    $0x10,%esp
+  }
+  release();
+}
+    17d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    17d9:	5b                   	pop    %ebx
+    17da:	5e                   	pop    %esi
+    17db:	5f                   	pop    %edi
+    17dc:	5d                   	pop    %ebp
+    17dd:	c3                   	ret
+    17de:	66 90                	xchg   %ax,%ax
+    mutex_lock(&lock);
+    17e0:	83 ec 0c             	sub    $0xc,%esp
+    17e3:	68 28 2f 00 00       	push   $0x2f28
+    17e8:	e8 b3 eb ff ff       	call   3a0 <mutex_lock>
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    17ed:	83 c4 10             	add    $0x10,%esp
+    17f0:	85 db                	test   %ebx,%ebx
+    17f2:	7f 99                	jg     178d <drain+0x1d>
+    17f4:	eb c7                	jmp    17bd <drain+0x4d>
+    17f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001800 <mycache>:
+{
+    1800:	55                   	push   %ebp
+    return &maincache;
+    1801:	b8 40 2f 00 00       	mov    $0x2f40,%eax
+{
+    1806:	89 e5                	mov    %esp,%ebp
+    1808:	53                   	push   %ebx
+  sp = PGROUNDDOWN((uint)&sp);
+    1809:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+    180c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+    1812:	83 ec 14             	sub    $0x14,%esp
+  if(!threaded || sp == mainstack)
+    1815:	8b 0d 24 2f 00 00    	mov    0x2f24,%ecx
+  sp = PGROUNDDOWN((uint)&sp);
+    181b:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  if(!threaded || sp == mainstack)
+    181e:	85 c9                	test   %ecx,%ecx
+    1820:	74 0f                	je     1831 <mycache+0x31>
+    1822:	3b 1d 20 2f 00 00    	cmp    0x2f20,%ebx
+    1828:	74 07                	je     1831 <mycache+0x31>
+  if(*cp == 0){
+    182a:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    182d:	85 c0                	test   %eax,%eax
+    182f:	74 0f                	je     1840 <mycache+0x40>
+}
+    1831:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1834:	c9                   	leave
+    1835:	c3                   	ret
+    1836:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    183d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1840:	83 ec 0c             	sub    $0xc,%esp
+    1843:	68 28 2f 00 00       	push   $0x2f28
+    1848:	e8 53 eb ff ff       	call   3a0 <mutex_lock>
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    184d:	b8 09 00 00 00       	mov    $0x9,%eax
+    1852:	e8 29 fe ff ff       	call   1680 <bigalloc>
+  if(threaded)
+    1857:	8b 15 24 2f 00 00    	mov    0x2f24,%edx
+    185d:	83 c4 10             	add    $0x10,%esp
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    1860:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(threaded)
+    1863:	85 d2                	test   %edx,%edx
+    1865:	75 29                	jne    1890 <mycache+0x90>
+    if(*cp == 0)
+    1867:	85 c0                	test   %eax,%eax
+    1869:	74 c6                	je     1831 <mycache+0x31>
+    memset(*cp, 0, sizeof(**cp));
+    186b:	83 ec 04             	sub    $0x4,%esp
+    *cp = (struct tcache*)((Header*)*cp + 1);
+    186e:	83 c0 08             	add    $0x8,%eax
+    1871:	89 43 f8             	mov    %eax,-0x8(%ebx)
+    memset(*cp, 0, sizeof(**cp));
+    1874:	6a 40                	push   $0x40
+    1876:	6a 00                	push   $0x0
+    1878:	50                   	push   %eax
+    1879:	e8 f2 e9 ff ff       	call   270 <memset>
+  return *cp;
+    187e:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    1881:	83 c4 10             	add    $0x10,%esp
+    1884:	eb ab                	jmp    1831 <mycache+0x31>
+    1886:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    188d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1890:	83 ec 0c             	sub    $0xc,%esp
+    1893:	68 28 2f 00 00       	push   $0x2f28
+    1898:	e8 53 eb ff ff       	call   3f0 <mutex_unlock>
+    if(*cp == 0)
+    189d:	8b 43 f8             	mov    -0x8(%ebx),%eax
+}
+    18a0:	83 c4 10             	add    $0x10,%esp
+    18a3:	eb c2                	jmp    1867 <mycache+0x67>
+    18a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000018b0 <free>:
+
+void
+free(void *ap)
+{
+    18b0:	55                   	push   %ebp
+    18b1:	89 e5                	mov    %esp,%ebp
+    18b3:	57                   	push   %edi
+    18b4:	56                   	push   %esi
+    18b5:	53                   	push   %ebx
+    18b6:	83 ec 1c             	sub    $0x1c,%esp
+    18b9:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  struct tcache *tc;
+  int c;
+
+  if(ap == 0)
+    18bc:	85 f6                	test   %esi,%esi
+    18be:	74 51                	je     1911 <free+0x61>
+    return;
+  bp = (Header*)ap - 1;
+    18c0:	8d 46 f8             	lea    -0x8(%esi),%eax
+    18c3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(bp->s.size > SMALLMAX / sizeof(Header)){
+    18c6:	8b 46 fc             	mov    -0x4(%esi),%eax
+    18c9:	3d 00 01 00 00       	cmp    $0x100,%eax
+    18ce:	77 50                	ja     1920 <free+0x70>
+    acquire();
+    trim(bigfree(bp));
+    release();
+    return;
+  }
+  for(c = 0; (2 << c) < bp->s.size; c++)
+    18d0:	31 db                	xor    %ebx,%ebx
+    18d2:	ba 02 00 00 00       	mov    $0x2,%edx
+    18d7:	83 f8 02             	cmp    $0x2,%eax
+    18da:	76 11                	jbe    18ed <free+0x3d>
+    18dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    18e0:	83 c3 01             	add    $0x1,%ebx
+    18e3:	89 d7                	mov    %edx,%edi
+    18e5:	89 d9                	mov    %ebx,%ecx
+    18e7:	d3 e7                	shl    %cl,%edi
+    18e9:	39 c7                	cmp    %eax,%edi
+    18eb:	72 f3                	jb     18e0 <free+0x30>
+    ;
+  if((tc = mycache()) == 0){
+    18ed:	e8 0e ff ff ff       	call   1800 <mycache>
+    18f2:	85 c0                	test   %eax,%eax
+    18f4:	74 7a                	je     1970 <free+0xc0>
+    bp->s.ptr = small[c];
+    small[c] = bp;
+    release();
+    return;
+  }
+  bp->s.ptr = tc->list[c];
+    18f6:	8d 0c 98             	lea    (%eax,%ebx,4),%ecx
+    18f9:	8b 11                	mov    (%ecx),%edx
+    18fb:	89 56 f8             	mov    %edx,-0x8(%esi)
+  tc->list[c] = bp;
+    18fe:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1901:	89 31                	mov    %esi,(%ecx)
+  if(++tc->n[c] > TCACHEMAX)
+    1903:	8b 71 20             	mov    0x20(%ecx),%esi
+    1906:	8d 56 01             	lea    0x1(%esi),%edx
+    1909:	89 51 20             	mov    %edx,0x20(%ecx)
+    190c:	83 fa 20             	cmp    $0x20,%edx
+    190f:	7f 47                	jg     1958 <free+0xa8>
+    drain(tc, c, BATCH);
+}
+    1911:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1914:	5b                   	pop    %ebx
+    1915:	5e                   	pop    %esi
+    1916:	5f                   	pop    %edi
+    1917:	5d                   	pop    %ebp
+    1918:	c3                   	ret
+    1919:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1920:	8b 1d 24 2f 00 00    	mov    0x2f24,%ebx
+    1926:	85 db                	test   %ebx,%ebx
+    1928:	75 66                	jne    1990 <free+0xe0>
+    trim(bigfree(bp));
+    192a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    192d:	e8 4e fc ff ff       	call   1580 <bigfree>
+    1932:	e8 c9 fc ff ff       	call   1600 <trim>
+  if(threaded)
+    1937:	8b 0d 24 2f 00 00    	mov    0x2f24,%ecx
+    193d:	85 c9                	test   %ecx,%ecx
+    193f:	74 d0                	je     1911 <free+0x61>
+    mutex_unlock(&lock);
+    1941:	c7 45 08 28 2f 00 00 	movl   $0x2f28,0x8(%ebp)
+}
+    1948:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    194b:	5b                   	pop    %ebx
+    194c:	5e                   	pop    %esi
+    194d:	5f                   	pop    %edi
+    194e:	5d                   	pop    %ebp
+    mutex_unlock(&lock);
+    194f:	e9 9c ea ff ff       	jmp    3f0 <mutex_unlock>
+    1954:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    1958:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    drain(tc, c, BATCH);
+    195b:	89 da                	mov    %ebx,%edx
+    195d:	b9 10 00 00 00       	mov    $0x10,%ecx
+}
+    1962:	5b                   	pop    %ebx
+    1963:	5e                   	pop    %esi
+    1964:	5f                   	pop    %edi
+    1965:	5d                   	pop    %ebp
+    drain(tc, c, BATCH);
+    1966:	e9 05 fe ff ff       	jmp    1770 <drain>
+    196b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    196f:	90                   	nop
+  if(threaded)
+    1970:	8b 15 24 2f 00 00    	mov    0x2f24,%edx
+    1976:	85 d2                	test   %edx,%edx
+    1978:	75 28                	jne    19a2 <free+0xf2>
+    bp->s.ptr = small[c];
+    197a:	8b 04 9d 80 2f 00 00 	mov    0x2f80(,%ebx,4),%eax
+    1981:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1984:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1987:	89 04 9d 80 2f 00 00 	mov    %eax,0x2f80(,%ebx,4)
+  if(threaded)
+    198e:	eb 81                	jmp    1911 <free+0x61>
+    mutex_lock(&lock);
+    1990:	83 ec 0c             	sub    $0xc,%esp
+    1993:	68 28 2f 00 00       	push   $0x2f28
+    1998:	e8 03 ea ff ff       	call   3a0 <mutex_lock>
+}
+    199d:	83 c4 10             	add    $0x10,%esp
+    19a0:	eb 88                	jmp    192a <free+0x7a>
+    mutex_lock(&lock);
+    19a2:	83 ec 0c             	sub    $0xc,%esp
+    19a5:	68 28 2f 00 00       	push   $0x2f28
+    19aa:	e8 f1 e9 ff ff       	call   3a0 <mutex_lock>
+    bp->s.ptr = small[c];
+    19af:	8b 04 9d 80 2f 00 00 	mov    0x2f80(,%ebx,4),%eax
+  if(threaded)
+    19b6:	83 c4 10             	add    $0x10,%esp
+    bp->s.ptr = small[c];
+    19b9:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    19bc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    19bf:	89 04 9d 80 2f 00 00 	mov    %eax,0x2f80(,%ebx,4)
+  if(threaded)
+    19c6:	a1 24 2f 00 00       	mov    0x2f24,%eax
+    19cb:	85 c0                	test   %eax,%eax
+    19cd:	0f 85 6e ff ff ff    	jne    1941 <free+0x91>
+    19d3:	e9 39 ff ff ff       	jmp    1911 <free+0x61>
+    19d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19df:	90                   	nop
+
+000019e0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    19e0:	55                   	push   %ebp
+    19e1:	89 e5                	mov    %esp,%ebp
+    19e3:	57                   	push   %edi
+    19e4:	56                   	push   %esi
+    19e5:	53                   	push   %ebx
+    19e6:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  struct tcache *tc;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    19e9:	8b 45 08             	mov    0x8(%ebp),%eax
+    19ec:	8d 78 07             	lea    0x7(%eax),%edi
+    19ef:	c1 ef 03             	shr    $0x3,%edi
+    19f2:	83 c7 01             	add    $0x1,%edi
+  if(nunits > SMALLMAX / sizeof(Header)){
+    19f5:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+    19fb:	77 5b                	ja     1a58 <malloc+0x78>
+    acquire();
+    p = bigalloc(nunits);
+    release();
+    return p ? (void*)(p + 1) : 0;
+  }
+  for(c = 0; (2 << c) < nunits; c++)
+    19fd:	31 c9                	xor    %ecx,%ecx
+    19ff:	b8 02 00 00 00       	mov    $0x2,%eax
+    1a04:	be 02 00 00 00       	mov    $0x2,%esi
+    1a09:	bb 02 00 00 00       	mov    $0x2,%ebx
+    1a0e:	83 ff 02             	cmp    $0x2,%edi
+    1a11:	76 12                	jbe    1a25 <malloc+0x45>
+    1a13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1a17:	90                   	nop
+    1a18:	83 c1 01             	add    $0x1,%ecx
+    1a1b:	89 c3                	mov    %eax,%ebx
+    1a1d:	d3 e3                	shl    %cl,%ebx
+    1a1f:	89 de                	mov    %ebx,%esi
+    1a21:	39 fb                	cmp    %edi,%ebx
+    1a23:	72 f3                	jb     1a18 <malloc+0x38>
+    1a25:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    ;
+  if((tc = mycache()) == 0)
+    1a28:	e8 d3 fd ff ff       	call   1800 <mycache>
+    1a2d:	85 c0                	test   %eax,%eax
+    1a2f:	74 51                	je     1a82 <malloc+0xa2>
+    return 0;
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1a31:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1a34:	8d 3c 88             	lea    (%eax,%ecx,4),%edi
+    1a37:	8b 07                	mov    (%edi),%eax
+    1a39:	85 c0                	test   %eax,%eax
+    1a3b:	74 53                	je     1a90 <malloc+0xb0>
+    return 0;
+  p = tc->list[c];
+  tc->list[c] = p->s.ptr;
+  tc->n[c]--;
+    1a3d:	8b 57 20             	mov    0x20(%edi),%edx
+  tc->list[c] = p->s.ptr;
+    1a40:	8b 08                	mov    (%eax),%ecx
+  tc->n[c]--;
+    1a42:	83 ea 01             	sub    $0x1,%edx
+  return (void*)(p + 1);
+    1a45:	83 c0 08             	add    $0x8,%eax
+  tc->n[c]--;
+    1a48:	89 57 20             	mov    %edx,0x20(%edi)
+  tc->list[c] = p->s.ptr;
+    1a4b:	89 0f                	mov    %ecx,(%edi)
+}
+    1a4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a50:	5b                   	pop    %ebx
+    1a51:	5e                   	pop    %esi
+    1a52:	5f                   	pop    %edi
+    1a53:	5d                   	pop    %ebp
+    1a54:	c3                   	ret
+    1a55:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1a58:	a1 24 2f 00 00       	mov    0x2f24,%eax
+    1a5d:	85 c0                	test   %eax,%eax
+    1a5f:	0f 85 b3 00 00 00    	jne    1b18 <malloc+0x138>
+    p = bigalloc(nunits);
+    1a65:	89 f8                	mov    %edi,%eax
+    1a67:	e8 14 fc ff ff       	call   1680 <bigalloc>
+    1a6c:	89 c3                	mov    %eax,%ebx
+  if(threaded)
+    1a6e:	a1 24 2f 00 00       	mov    0x2f24,%eax
+    1a73:	85 c0                	test   %eax,%eax
+    1a75:	0f 85 85 00 00 00    	jne    1b00 <malloc+0x120>
+    return p ? (void*)(p + 1) : 0;
+    1a7b:	8d 43 08             	lea    0x8(%ebx),%eax
+    1a7e:	85 db                	test   %ebx,%ebx
+    1a80:	75 cb                	jne    1a4d <malloc+0x6d>
+    1a82:	31 c0                	xor    %eax,%eax
+}
+    1a84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a87:	5b                   	pop    %ebx
+    1a88:	5e                   	pop    %esi
+    1a89:	5f                   	pop    %edi
+    1a8a:	5d                   	pop    %ebp
+    1a8b:	c3                   	ret
+    1a8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1a90:	a1 24 2f 00 00       	mov    0x2f24,%eax
+    1a95:	85 c0                	test   %eax,%eax
+    1a97:	0f 85 29 01 00 00    	jne    1bc6 <malloc+0x1e6>
+  if(small[c] == 0){
+    1a9d:	8b 04 8d 80 2f 00 00 	mov    0x2f80(,%ecx,4),%eax
+    1aa4:	85 c0                	test   %eax,%eax
+    1aa6:	0f 84 81 00 00 00    	je     1b2d <malloc+0x14d>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1aac:	31 db                	xor    %ebx,%ebx
+    1aae:	eb 22                	jmp    1ad2 <malloc+0xf2>
+    small[c] = p->s.ptr;
+    1ab0:	8b 10                	mov    (%eax),%edx
+  for(moved = 0; moved < n && small[c]; moved++){
+    1ab2:	83 c3 01             	add    $0x1,%ebx
+    small[c] = p->s.ptr;
+    1ab5:	89 14 8d 80 2f 00 00 	mov    %edx,0x2f80(,%ecx,4)
+    p->s.ptr = tc->list[c];
+    1abc:	8b 17                	mov    (%edi),%edx
+    1abe:	89 10                	mov    %edx,(%eax)
+    tc->list[c] = p;
+    1ac0:	89 07                	mov    %eax,(%edi)
+  for(moved = 0; moved < n && small[c]; moved++){
+    1ac2:	83 fb 10             	cmp    $0x10,%ebx
+    1ac5:	0f 84 e2 00 00 00    	je     1bad <malloc+0x1cd>
+    1acb:	8b 04 8d 80 2f 00 00 	mov    0x2f80(,%ecx,4),%eax
+    1ad2:	85 c0                	test   %eax,%eax
+    1ad4:	75 da                	jne    1ab0 <malloc+0xd0>
+  if(threaded)
+    1ad6:	8b 15 24 2f 00 00    	mov    0x2f24,%edx
+    1adc:	85 d2                	test   %edx,%edx
+    1ade:	0f 85 b4 00 00 00    	jne    1b98 <malloc+0x1b8>
+  tc->n[c] += moved;
+    1ae4:	8b 57 20             	mov    0x20(%edi),%edx
+    1ae7:	01 da                	add    %ebx,%edx
+    1ae9:	89 57 20             	mov    %edx,0x20(%edi)
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1aec:	85 db                	test   %ebx,%ebx
+    1aee:	74 92                	je     1a82 <malloc+0xa2>
+  p = tc->list[c];
+    1af0:	8b 07                	mov    (%edi),%eax
+    1af2:	e9 49 ff ff ff       	jmp    1a40 <malloc+0x60>
+    1af7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1afe:	66 90                	xchg   %ax,%ax
+    mutex_unlock(&lock);
+    1b00:	83 ec 0c             	sub    $0xc,%esp
+    1b03:	68 28 2f 00 00       	push   $0x2f28
+    1b08:	e8 e3 e8 ff ff       	call   3f0 <mutex_unlock>
+}
+    1b0d:	83 c4 10             	add    $0x10,%esp
+    1b10:	e9 66 ff ff ff       	jmp    1a7b <malloc+0x9b>
+    1b15:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1b18:	83 ec 0c             	sub    $0xc,%esp
+    1b1b:	68 28 2f 00 00       	push   $0x2f28
+    1b20:	e8 7b e8 ff ff       	call   3a0 <mutex_lock>
+}
+    1b25:	83 c4 10             	add    $0x10,%esp
+    1b28:	e9 38 ff ff ff       	jmp    1a65 <malloc+0x85>
+    if((chunk = bigalloc(CHUNK / sizeof(Header) + 1)) == 0){
+    1b2d:	b8 01 02 00 00       	mov    $0x201,%eax
+    1b32:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1b35:	e8 46 fb ff ff       	call   1680 <bigalloc>
+    1b3a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1b3d:	85 c0                	test   %eax,%eax
+    1b3f:	89 c2                	mov    %eax,%edx
+    1b41:	0f 84 ba 00 00 00    	je     1c01 <malloc+0x221>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1b47:	83 c2 08             	add    $0x8,%edx
+    1b4a:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+    1b50:	0f 87 d0 00 00 00    	ja     1c26 <malloc+0x246>
+    1b56:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+    1b5d:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    1b60:	89 df                	mov    %ebx,%edi
+    1b62:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1b65:	8d 76 00             	lea    0x0(%esi),%esi
+      p->s.size = units;
+    1b68:	89 72 04             	mov    %esi,0x4(%edx)
+      p->s.ptr = small[c];
+    1b6b:	8b 04 8d 80 2f 00 00 	mov    0x2f80(,%ecx,4),%eax
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1b72:	01 df                	add    %ebx,%edi
+    1b74:	89 55 e0             	mov    %edx,-0x20(%ebp)
+      p->s.ptr = small[c];
+    1b77:	89 02                	mov    %eax,(%edx)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1b79:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      small[c] = p;
+    1b7c:	89 14 8d 80 2f 00 00 	mov    %edx,0x2f80(,%ecx,4)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1b83:	01 c2                	add    %eax,%edx
+    1b85:	81 ff 00 02 00 00    	cmp    $0x200,%edi
+    1b8b:	76 db                	jbe    1b68 <malloc+0x188>
+    1b8d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1b90:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1b93:	e9 14 ff ff ff       	jmp    1aac <malloc+0xcc>
+    mutex_unlock(&lock);
+    1b98:	83 ec 0c             	sub    $0xc,%esp
+    1b9b:	68 28 2f 00 00       	push   $0x2f28
+    1ba0:	e8 4b e8 ff ff       	call   3f0 <mutex_unlock>
+}
+    1ba5:	83 c4 10             	add    $0x10,%esp
+    1ba8:	e9 37 ff ff ff       	jmp    1ae4 <malloc+0x104>
+  if(threaded)
+    1bad:	a1 24 2f 00 00       	mov    0x2f24,%eax
+    1bb2:	85 c0                	test   %eax,%eax
+    1bb4:	75 2b                	jne    1be1 <malloc+0x201>
+  tc->n[c] += moved;
+    1bb6:	8b 47 20             	mov    0x20(%edi),%eax
+    1bb9:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1bbc:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1bbe:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1bc1:	e9 7a fe ff ff       	jmp    1a40 <malloc+0x60>
+    mutex_lock(&lock);
+    1bc6:	83 ec 0c             	sub    $0xc,%esp
+    1bc9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1bcc:	68 28 2f 00 00       	push   $0x2f28
+    1bd1:	e8 ca e7 ff ff       	call   3a0 <mutex_lock>
+}
+    1bd6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1bd9:	83 c4 10             	add    $0x10,%esp
+    1bdc:	e9 bc fe ff ff       	jmp    1a9d <malloc+0xbd>
+    mutex_unlock(&lock);
+    1be1:	83 ec 0c             	sub    $0xc,%esp
+    1be4:	68 28 2f 00 00       	push   $0x2f28
+    1be9:	e8 02 e8 ff ff       	call   3f0 <mutex_unlock>
+  tc->n[c] += moved;
+    1bee:	8b 47 20             	mov    0x20(%edi),%eax
+    1bf1:	83 c4 10             	add    $0x10,%esp
+    1bf4:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1bf7:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1bf9:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1bfc:	e9 3f fe ff ff       	jmp    1a40 <malloc+0x60>
+  if(threaded)
+    1c01:	8b 0d 24 2f 00 00    	mov    0x2f24,%ecx
+    1c07:	85 c9                	test   %ecx,%ecx
+    1c09:	0f 84 73 fe ff ff    	je     1a82 <malloc+0xa2>
+    mutex_unlock(&lock);
+    1c0f:	83 ec 0c             	sub    $0xc,%esp
+    1c12:	68 28 2f 00 00       	push   $0x2f28
+    1c17:	e8 d4 e7 ff ff       	call   3f0 <mutex_unlock>
+    1c1c:	83 c4 10             	add    $0x10,%esp
+    return p ? (void*)(p + 1) : 0;
+    1c1f:	31 c0                	xor    %eax,%eax
+    1c21:	e9 5e fe ff ff       	jmp    1a84 <malloc+0xa4>
+  for(moved = 0; moved < n && small[c]; moved++){
+    1c26:	8b 04 8d 80 2f 00 00 	mov    0x2f80(,%ecx,4),%eax
+    1c2d:	e9 7a fe ff ff       	jmp    1aac <malloc+0xcc>
+    1c32:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001c40 <malloc_threaded>:
+void
+malloc_threaded(void)
+{
+  uint sp;
+
+  if(threaded)
+    1c40:	a1 24 2f 00 00       	mov    0x2f24,%eax
+    1c45:	85 c0                	test   %eax,%eax
+    1c47:	74 07                	je     1c50 <malloc_threaded+0x10>
+    1c49:	c3                   	ret
+    1c4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+{
+    1c50:	55                   	push   %ebp
+    1c51:	89 e5                	mov    %esp,%ebp
+    1c53:	83 ec 24             	sub    $0x24,%esp
+    return;
+  mutex_init(&lock);
+    1c56:	68 28 2f 00 00       	push   $0x2f28
+    1c5b:	e8 30 e7 ff ff       	call   390 <mutex_init>
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1c60:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1c63:	83 c4 10             	add    $0x10,%esp
+  threaded = 1;
+    1c66:	c7 05 24 2f 00 00 01 	movl   $0x1,0x2f24
+    1c6d:	00 00 00 
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1c70:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    1c75:	a3 20 2f 00 00       	mov    %eax,0x2f20
+}
+    1c7a:	c9                   	leave
+    1c7b:	c3                   	ret
+    1c7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001c80 <malloc_thread_exit>:
+
+// Called by thread_join() with the cache slot of a finished
+// thread: give its blocks, and the cache itself, back.
+void
+malloc_thread_exit(void **cachep)
+{
+    1c80:	55                   	push   %ebp
+    1c81:	89 e5                	mov    %esp,%ebp
+    1c83:	57                   	push   %edi
+    1c84:	56                   	push   %esi
+    1c85:	53                   	push   %ebx
+    1c86:	83 ec 0c             	sub    $0xc,%esp
+    1c89:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct tcache *tc;
+  int c;
+
+  if((tc = *cachep) == 0)
+    1c8c:	8b 37                	mov    (%edi),%esi
+    1c8e:	85 f6                	test   %esi,%esi
+    1c90:	74 41                	je     1cd3 <malloc_thread_exit+0x53>
+    return;
+  for(c = 0; c < NCLASS; c++)
+    1c92:	31 db                	xor    %ebx,%ebx
+    1c94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    drain(tc, c, tc->n[c]);
+    1c98:	8b 4c 9e 20          	mov    0x20(%esi,%ebx,4),%ecx
+    1c9c:	89 da                	mov    %ebx,%edx
+    1c9e:	89 f0                	mov    %esi,%eax
+  for(c = 0; c < NCLASS; c++)
+    1ca0:	83 c3 01             	add    $0x1,%ebx
+    drain(tc, c, tc->n[c]);
+    1ca3:	e8 c8 fa ff ff       	call   1770 <drain>
+  for(c = 0; c < NCLASS; c++)
+    1ca8:	83 fb 08             	cmp    $0x8,%ebx
+    1cab:	75 eb                	jne    1c98 <malloc_thread_exit+0x18>
+  if(threaded)
+    1cad:	8b 15 24 2f 00 00    	mov    0x2f24,%edx
+    1cb3:	85 d2                	test   %edx,%edx
+    1cb5:	75 29                	jne    1ce0 <malloc_thread_exit+0x60>
+  acquire();
+  trim(bigfree((Header*)tc - 1));
+    1cb7:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1cba:	e8 c1 f8 ff ff       	call   1580 <bigfree>
+    1cbf:	e8 3c f9 ff ff       	call   1600 <trim>
+  if(threaded)
+    1cc4:	a1 24 2f 00 00       	mov    0x2f24,%eax
+    1cc9:	85 c0                	test   %eax,%eax
+    1ccb:	75 2b                	jne    1cf8 <malloc_thread_exit+0x78>
+  release();
+  *cachep = 0;
+    1ccd:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+}
+    1cd3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1cd6:	5b                   	pop    %ebx
+    1cd7:	5e                   	pop    %esi
+    1cd8:	5f                   	pop    %edi
+    1cd9:	5d                   	pop    %ebp
+    1cda:	c3                   	ret
+    1cdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1cdf:	90                   	nop
+    mutex_lock(&lock);
+    1ce0:	83 ec 0c             	sub    $0xc,%esp
+    1ce3:	68 28 2f 00 00       	push   $0x2f28
+    1ce8:	e8 b3 e6 ff ff       	call   3a0 <mutex_lock>
+}
+    1ced:	83 c4 10             	add    $0x10,%esp
+    1cf0:	eb c5                	jmp    1cb7 <malloc_thread_exit+0x37>
+    1cf2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1cf8:	83 ec 0c             	sub    $0xc,%esp
+    1cfb:	68 28 2f 00 00       	push   $0x2f28
+    1d00:	e8 eb e6 ff ff       	call   3f0 <mutex_unlock>
+}
+    1d05:	83 c4 10             	add    $0x10,%esp
+    1d08:	eb c3                	jmp    1ccd <malloc_thread_exit+0x4d>
+    1d0a:	66 90                	xchg   %ax,%ax
+    1d0c:	66 90                	xchg   %ax,%ax
+    1d0e:	66 90                	xchg   %ax,%ax
+
+00001d10 <thread_create>:
+
+// Start fn(arg) in a new thread on a freshly allocated
+// page-aligned stack.  Returns the thread's pid.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1d10:	55                   	push   %ebp
+    1d11:	89 e5                	mov    %esp,%ebp
+    1d13:	53                   	push   %ebx
+    1d14:	83 ec 14             	sub    $0x14,%esp
+  char *mem, *stack;
+  int pid;
+
+  malloc_threaded();
+    1d17:	e8 24 ff ff ff       	call   1c40 <malloc_threaded>
+  stdio_threaded();
+    1d1c:	e8 cf ee ff ff       	call   bf0 <stdio_threaded>
+  if((mem = malloc(2*PGSIZE)) == 0)
+    1d21:	83 ec 0c             	sub    $0xc,%esp
+    1d24:	68 00 20 00 00       	push   $0x2000
+    1d29:	e8 b2 fc ff ff       	call   19e0 <malloc>
+    1d2e:	83 c4 10             	add    $0x10,%esp
+    1d31:	85 c0                	test   %eax,%eax
+    1d33:	74 52                	je     1d87 <thread_create+0x77>
+    1d35:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1d37:	8d 80 07 10 00 00    	lea    0x1007(%eax),%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+  ((char**)stack)[-2] = 0;
+  if((pid = clone(fn, arg, stack)) < 0)
+    1d3d:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1d40:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+    1d45:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  ((char**)stack)[-2] = 0;
+    1d48:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+  if((pid = clone(fn, arg, stack)) < 0)
+    1d4f:	50                   	push   %eax
+    1d50:	ff 75 0c             	push   0xc(%ebp)
+    1d53:	ff 75 08             	push   0x8(%ebp)
+    1d56:	e8 97 e8 ff ff       	call   5f2 <clone>
+    1d5b:	83 c4 10             	add    $0x10,%esp
+    1d5e:	85 c0                	test   %eax,%eax
+    1d60:	78 0e                	js     1d70 <thread_create+0x60>
+    free(mem);
+  return pid;
+}
+    1d62:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1d65:	c9                   	leave
+    1d66:	c3                   	ret
+    1d67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d6e:	66 90                	xchg   %ax,%ax
+    free(mem);
+    1d70:	83 ec 0c             	sub    $0xc,%esp
+    1d73:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1d76:	53                   	push   %ebx
+    1d77:	e8 34 fb ff ff       	call   18b0 <free>
+    1d7c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1d7f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    1d82:	83 c4 10             	add    $0x10,%esp
+}
+    1d85:	c9                   	leave
+    1d86:	c3                   	ret
+    return -1;
+    1d87:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1d8c:	eb d4                	jmp    1d62 <thread_create+0x52>
+    1d8e:	66 90                	xchg   %ax,%ax
+
+00001d90 <thread_join>:
+
+// Wait for a thread to finish and free its stack.
+int
+thread_join(void)
+{
+    1d90:	55                   	push   %ebp
+    1d91:	89 e5                	mov    %esp,%ebp
+    1d93:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    1d94:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    1d97:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    1d9a:	50                   	push   %eax
+    1d9b:	e8 61 e8 ff ff       	call   601 <join>
+    1da0:	83 c4 10             	add    $0x10,%esp
+    1da3:	85 c0                	test   %eax,%eax
+    1da5:	78 29                	js     1dd0 <thread_join+0x40>
+    1da7:	89 c3                	mov    %eax,%ebx
+    return -1;
+  malloc_thread_exit(&((void**)stack)[-2]);
+    1da9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1dac:	83 ec 0c             	sub    $0xc,%esp
+    1daf:	83 e8 08             	sub    $0x8,%eax
+    1db2:	50                   	push   %eax
+    1db3:	e8 c8 fe ff ff       	call   1c80 <malloc_thread_exit>
+  free(((char**)stack)[-1]);
+    1db8:	58                   	pop    %eax
+    1db9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1dbc:	ff 70 fc             	push   -0x4(%eax)
+    1dbf:	e8 ec fa ff ff       	call   18b0 <free>
+  return pid;
+    1dc4:	83 c4 10             	add    $0x10,%esp
+}
+    1dc7:	89 d8                	mov    %ebx,%eax
+    1dc9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1dcc:	c9                   	leave
+    1dcd:	c3                   	ret
+    1dce:	66 90                	xchg   %ax,%ax
+    return -1;
+    1dd0:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    1dd5:	eb f0                	jmp    1dc7 <thread_join+0x37>
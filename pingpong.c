@@ -0,0 +1,49 @@
+// Context switch benchmark.
+// Two processes bounce a byte back and forth over a pair of
+// pipes, so every round trip costs two sleeps, two wakeups and
+// two switches between address spaces.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define ROUNDS 20000
+
+int
+main(int argc, char *argv[])
+{
+  int ping[2], pong[2], i, rounds, t0, t1;
+  char c;
+
+  rounds = ROUNDS;
+  if(argc > 1)
+    rounds = atoi(argv[1]);
+
+  if(pipe(ping) < 0 || pipe(pong) < 0){
+    printf(2, "pingpong: pipe failed\n");
+    exit();
+  }
+  if(fork() == 0){
+    for(i = 0; i < rounds; i++){
+      if(read(ping[0], &c, 1) != 1)
+        break;
+      write(pong[1], &c, 1);
+    }
+    exit();
+  }
+
+  c = 'x';
+  t0 = uptime();
+  for(i = 0; i < rounds; i++){
+    write(ping[1], &c, 1);
+    if(read(pong[0], &c, 1) != 1){
+      printf(2, "pingpong: read failed\n");
+      break;
+    }
+  }
+  t1 = uptime();
+  wait();
+
+  printf(1, "pingpong: %d round trips, %d ticks\n", rounds, t1 - t0);
+  exit();
+}
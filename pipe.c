@@ -8,34 +8,69 @@
 #include "sleeplock.h"
 #include "file.h"
 
-#define PIPESIZE 512
+#define PIPESIZE (PIPEPAGES*PGSIZE)
+#define PIPEWAKE (PGSIZE/4)  // wake the other side once this much is ready
+#define NGIFT 16             // pages queued by pipesplice()
 
 struct pipe {
   struct spinlock lock;
-  char data[PIPESIZE];//用于存储管道中的数据
+  char *data[PIPEPAGES];//用于存储管道中的数据
   uint nread;     // number of bytes read 已经读取
   uint nwrite;    // number of bytes written 已经写入到管道的字节数
   //两个整数类型的成员变量，用于标志读端和写端是否处于打开状态。如果相应的端口已经关闭，则该值为0；否则，它的值为非零。
   int readopen;   // read fd is still open
   int writeopen;  // write fd is still open
+  // Whole pages handed over by pipesplice(). The ring and the gift
+  // queue are never both non-empty, which keeps the bytes in order.
+  char *gift[NGIFT];
+  uint giftr;     // number of gift pages read
+  uint giftw;     // number of gift pages written
+  uint giftoff;   // bytes of gift[giftr] already read
 };
 
+static struct kmem_cache *pipecache;
+static struct lockstat *pipestat;  // see initlockstat()
+
+void
+pipeinit(void)
+{
+  pipecache = kmem_cache_create("pipe cache", sizeof(struct pipe), 0, 0);
+}
+
+static void
+pipefree(struct pipe *p)
+{
+  int i;
+
+  for(i = 0; i < PIPEPAGES; i++)
+    if(p->data[i])
+      kfree(p->data[i]);
+  for(; p->giftr != p->giftw; p->giftr++)
+    kfree(p->gift[p->giftr % NGIFT]);
+  freelock(&p->lock);
+  kmem_cache_free(pipecache, p);
+}
+
 int
 pipealloc(struct file **f0, struct file **f1)
 {
   struct pipe *p;
+  int i;
 
   p = 0;
   *f0 = *f1 = 0;
   if((*f0 = filealloc()) == 0 || (*f1 = filealloc()) == 0)
     goto bad;
-  if((p = (struct pipe*)kalloc()) == 0)
+  if((p = kmem_cache_alloc(pipecache)) == 0)
     goto bad;
+  for(i = 0; i < PIPEPAGES; i++)
+    if((p->data[i] = kalloc()) == 0)
+      goto bad;
   p->readopen = 1;
   p->writeopen = 1;
   p->nwrite = 0;
   p->nread = 0;
-  initlock(&p->lock, "pipe");
+  initlockstat(&p->lock, "pipe", &pipestat);
   (*f0)->type = FD_PIPE;
   (*f0)->readable = 1;
   (*f0)->writable = 0;
@@ -49,7 +84,7 @@ pipealloc(struct file **f0, struct file **f1)
 //PAGEBREAK: 20
  bad:
   if(p)
-    kfree((char*)p);
+    pipefree(p);
   if(*f0)
     fileclose(*f0);
   if(*f1)
@@ -70,20 +105,32 @@ pipeclose(struct pipe *p, int writable)
   }
   if(p->readopen == 0 && p->writeopen == 0){
     release(&p->lock);
-    kfree((char*)p);
+    pipefree(p);
   } else
     release(&p->lock);
 }
 
+// Number of bytes that can be copied at ring offset off without
+// going past max bytes or the end of the page holding off.
+static int
+chunk(uint off, int max)
+{
+  int m;
+
+  m = PGSIZE - off % PGSIZE;
+  return m < max ? m : max;
+}
+
 //PAGEBREAK: 40
 int
 pipewrite(struct pipe *p, char *addr, int n)
 {
-  int i;
+  int i, m;
+  uint off;
 
   acquire(&p->lock);
-  for(i = 0; i < n; i++){
-    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+  for(i = 0; i < n; i += m){
+    while(p->nwrite == p->nread + PIPESIZE || p->giftr != p->giftw){  //DOC: pipewrite-full
       if(p->readopen == 0 || myproc()->killed){
         release(&p->lock);
         return -1;
@@ -91,32 +138,126 @@ pipewrite(struct pipe *p, char *addr, int n)
       wakeup(&p->nread);
       sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
     }
-    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+    off = p->nwrite % PIPESIZE;
+    m = chunk(off, n - i);
+    if(m > p->nread + PIPESIZE - p->nwrite)
+      m = p->nread + PIPESIZE - p->nwrite;
+    memmove(p->data[off / PGSIZE] + off % PGSIZE, addr + i, m);
+    p->nwrite += m;
+    // Let a reader start on a large write before it is complete.
+    if(p->nwrite - p->nread >= PIPEWAKE)
+      wakeup(&p->nread);
   }
   wakeup(&p->nread);  //DOC: pipewrite-wakeup1
   release(&p->lock);
   return n;
 }
 
+// Read up to n bytes of gift pages into user memory at addr.
+// A whole page landing on a page boundary is mapped in place of
+// the reader's page instead of being copied, unless the page table
+// is shared with other threads whose TLBs would go stale.
+// Caller holds p->lock.
+static int
+readgifts(struct pipe *p, char *addr, int n, int shared)
+{
+  int i, m;
+  char *g, *old;
+
+  for(i = 0; i < n && p->giftr != p->giftw; i += m){
+    g = p->gift[p->giftr % NGIFT];
+    m = PGSIZE - p->giftoff;
+    if(m > n - i)
+      m = n - i;
+    // Pages of mmap() regions, above sz, are always copied into.
+    if(!shared && p->giftoff == 0 && m == PGSIZE && (uint)(addr + i) % PGSIZE == 0 &&
+       (uint)(addr + i) + PGSIZE <= myproc()->sz &&
+       (old = remapupage(myproc()->pgdir, addr + i, g)) != 0){
+      g = old;
+    } else
+      memmove(addr + i, g + p->giftoff, m);
+    p->giftoff += m;
+    if(p->giftoff == PGSIZE){
+      kfree(g);
+      p->giftr++;
+      p->giftoff = 0;
+    }
+  }
+  return i;
+}
+
 int
 piperead(struct pipe *p, char *addr, int n)
 {
-  int i;
+  int i, m, shared;
+  uint off;
 
+  shared = pgdirshared(myproc());
   acquire(&p->lock);
-  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+  while(p->nread == p->nwrite && p->giftr == p->giftw && p->writeopen){  //DOC: pipe-empty
     if(myproc()->killed){
       release(&p->lock);
       return -1;
     }
     sleep(&p->nread, &p->lock); //DOC: piperead-sleep
   }
-  for(i = 0; i < n; i++){  //DOC: piperead-copy
-    if(p->nread == p->nwrite)
-      break;
-    addr[i] = p->data[p->nread++ % PIPESIZE];
+  if(p->giftr != p->giftw){
+    i = readgifts(p, addr, n, shared);
+    wakeup(&p->nwrite);
+    release(&p->lock);
+    return i;
+  }
+  for(i = 0; i < n && p->nread != p->nwrite; i += m){  //DOC: piperead-copy
+    off = p->nread % PIPESIZE;
+    m = chunk(off, n - i);
+    if(m > p->nwrite - p->nread)
+      m = p->nwrite - p->nread;
+    memmove(addr + i, p->data[off / PGSIZE] + off % PGSIZE, m);
+    p->nread += m;
   }
   wakeup(&p->nwrite);  //DOC: piperead-wakeup
   release(&p->lock);
   return i;
 }
+
+// Move n bytes at user address addr into the pipe without copying:
+// each page is queued on the pipe as is and replaced in the caller's
+// address space by a fresh zeroed page, so the caller gives up the
+// old contents. addr and n must be page-aligned and below the
+// process size; otherwise, or if the page table is shared with
+// other threads, the data is copied as by pipewrite(). Returns the number of bytes moved or -1.
+int
+pipesplice(struct pipe *p, char *addr, int n)
+{
+  int i;
+  char *mem, *old;
+
+  if((uint)addr % PGSIZE != 0 || n % PGSIZE != 0 ||
+     (uint)addr + n > myproc()->sz || pgdirshared(myproc()))
+    return pipewrite(p, addr, n);
+
+  for(i = 0; i < n; i += PGSIZE){
+    if((mem = kalloc()) == 0)
+      break;
+    memset(mem, 0, PGSIZE);
+    acquire(&p->lock);
+    while(p->nread != p->nwrite || p->giftw == p->giftr + NGIFT){
+      if(p->readopen == 0 || myproc()->killed){
+        release(&p->lock);
+        kfree(mem);
+        return -1;
+      }
+      wakeup(&p->nread);
+      sleep(&p->nwrite, &p->lock);
+    }
+    if((old = remapupage(myproc()->pgdir, addr + i, mem)) == 0){
+      release(&p->lock);
+      kfree(mem);
+      break;
+    }
+    p->gift[p->giftw++ % NGIFT] = old;
+    wakeup(&p->nread);
+    release(&p->lock);
+  }
+  return i > 0 ? i : -1;
+}
@@ -0,0 +1,4124 @@
+
+_pipebench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char buf[8192];
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	bb 00 10 00 00       	mov    $0x1000,%ebx
+      15:	51                   	push   %ecx
+      16:	83 ec 28             	sub    $0x28,%esp
+  int fds[2], n, chunk, total, t0, t1, kb;
+
+  chunk = 4096;
+  if(argc > 1)
+      19:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+      1c:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc > 1)
+      1f:	0f 8f 8a 00 00 00    	jg     af <main+0xaf>
+  if(chunk < 1 || chunk > sizeof(buf)){
+    printf(2, "usage: pipebench [chunk <= %d]\n", sizeof(buf));
+    exit();
+  }
+
+  if(pipe(fds) < 0){
+      25:	83 ec 0c             	sub    $0xc,%esp
+      28:	8d 45 e0             	lea    -0x20(%ebp),%eax
+      2b:	50                   	push   %eax
+      2c:	e8 32 05 00 00       	call   563 <pipe>
+      31:	83 c4 10             	add    $0x10,%esp
+      34:	85 c0                	test   %eax,%eax
+      36:	78 64                	js     9c <main+0x9c>
+    printf(2, "pipebench: pipe failed\n");
+    exit();
+  }
+  t0 = uptime();
+      38:	e8 f3 04 00 00       	call   530 <uptime>
+      3d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  if(fork() == 0){
+      40:	e8 5b 01 00 00       	call   1a0 <fork>
+      45:	89 c6                	mov    %eax,%esi
+      47:	85 c0                	test   %eax,%eax
+      49:	0f 85 95 00 00 00    	jne    e4 <main+0xe4>
+    close(fds[1]);
+      4f:	83 ec 0c             	sub    $0xc,%esp
+      52:	ff 75 e4             	push   -0x1c(%ebp)
+      55:	e8 36 05 00 00       	call   590 <close>
+    total = 0;
+    while((n = read(fds[0], buf, chunk)) > 0)
+      5a:	83 c4 10             	add    $0x10,%esp
+      5d:	eb 03                	jmp    62 <main+0x62>
+      5f:	90                   	nop
+      total += n;
+      60:	01 c6                	add    %eax,%esi
+    while((n = read(fds[0], buf, chunk)) > 0)
+      62:	83 ec 04             	sub    $0x4,%esp
+      65:	53                   	push   %ebx
+      66:	68 a0 29 00 00       	push   $0x29a0
+      6b:	ff 75 e0             	push   -0x20(%ebp)
+      6e:	e8 ff 04 00 00       	call   572 <read>
+      73:	83 c4 10             	add    $0x10,%esp
+      76:	85 c0                	test   %eax,%eax
+      78:	7f e6                	jg     60 <main+0x60>
+    if(total != TOTAL)
+      7a:	81 fe 00 00 80 00    	cmp    $0x800000,%esi
+      80:	74 15                	je     97 <main+0x97>
+      printf(2, "pipebench: read %d bytes, want %d\n", total, TOTAL);
+      82:	68 00 00 80 00       	push   $0x800000
+      87:	56                   	push   %esi
+      88:	68 68 1e 00 00       	push   $0x1e68
+      8d:	6a 02                	push   $0x2
+      8f:	e8 2c 09 00 00       	call   9c0 <printf>
+      94:	83 c4 10             	add    $0x10,%esp
+  if(t1 == t0)
+    t1 = t0 + 1;
+  kb = TOTAL / 1024;
+  printf(1, "pipebench: %d KB in %d-byte chunks, %d ticks, %d KB/s\n",
+         kb, chunk, t1 - t0, kb * 100 / (t1 - t0));
+  exit();
+      97:	e8 64 01 00 00       	call   200 <exit>
+    printf(2, "pipebench: pipe failed\n");
+      9c:	51                   	push   %ecx
+      9d:	51                   	push   %ecx
+      9e:	68 c3 1e 00 00       	push   $0x1ec3
+      a3:	6a 02                	push   $0x2
+      a5:	e8 16 09 00 00       	call   9c0 <printf>
+    exit();
+      aa:	e8 51 01 00 00       	call   200 <exit>
+    chunk = atoi(argv[1]);
+      af:	83 ec 0c             	sub    $0xc,%esp
+      b2:	ff 70 04             	push   0x4(%eax)
+      b5:	e8 d6 02 00 00       	call   390 <atoi>
+  if(chunk < 1 || chunk > sizeof(buf)){
+      ba:	83 c4 10             	add    $0x10,%esp
+    chunk = atoi(argv[1]);
+      bd:	89 c3                	mov    %eax,%ebx
+  if(chunk < 1 || chunk > sizeof(buf)){
+      bf:	8d 40 ff             	lea    -0x1(%eax),%eax
+      c2:	3d ff 1f 00 00       	cmp    $0x1fff,%eax
+      c7:	0f 86 58 ff ff ff    	jbe    25 <main+0x25>
+    printf(2, "usage: pipebench [chunk <= %d]\n", sizeof(buf));
+      cd:	53                   	push   %ebx
+      ce:	68 00 20 00 00       	push   $0x2000
+      d3:	68 48 1e 00 00       	push   $0x1e48
+      d8:	6a 02                	push   $0x2
+      da:	e8 e1 08 00 00       	call   9c0 <printf>
+    exit();
+      df:	e8 1c 01 00 00       	call   200 <exit>
+  close(fds[0]);
+      e4:	83 ec 0c             	sub    $0xc,%esp
+      e7:	ff 75 e0             	push   -0x20(%ebp)
+  for(total = 0; total < TOTAL; total += n){
+      ea:	31 ff                	xor    %edi,%edi
+  close(fds[0]);
+      ec:	e8 9f 04 00 00       	call   590 <close>
+      f1:	83 c4 10             	add    $0x10,%esp
+      f4:	eb 14                	jmp    10a <main+0x10a>
+      f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      fd:	8d 76 00             	lea    0x0(%esi),%esi
+  for(total = 0; total < TOTAL; total += n){
+     100:	01 c7                	add    %eax,%edi
+     102:	81 ff ff ff 7f 00    	cmp    $0x7fffff,%edi
+     108:	7f 37                	jg     141 <main+0x141>
+    n = TOTAL - total < chunk ? TOTAL - total : chunk;
+     10a:	ba 00 00 80 00       	mov    $0x800000,%edx
+     10f:	29 fa                	sub    %edi,%edx
+     111:	39 da                	cmp    %ebx,%edx
+     113:	89 d6                	mov    %edx,%esi
+     115:	0f 4f f3             	cmovg  %ebx,%esi
+    if(write(fds[1], buf, n) != n){
+     118:	83 ec 04             	sub    $0x4,%esp
+     11b:	56                   	push   %esi
+     11c:	68 a0 29 00 00       	push   $0x29a0
+     121:	ff 75 e4             	push   -0x1c(%ebp)
+     124:	e8 58 04 00 00       	call   581 <write>
+     129:	83 c4 10             	add    $0x10,%esp
+     12c:	39 f0                	cmp    %esi,%eax
+     12e:	74 d0                	je     100 <main+0x100>
+      printf(2, "pipebench: write failed\n");
+     130:	52                   	push   %edx
+     131:	52                   	push   %edx
+     132:	68 db 1e 00 00       	push   $0x1edb
+     137:	6a 02                	push   $0x2
+     139:	e8 82 08 00 00       	call   9c0 <printf>
+      break;
+     13e:	83 c4 10             	add    $0x10,%esp
+  close(fds[1]);
+     141:	83 ec 0c             	sub    $0xc,%esp
+     144:	ff 75 e4             	push   -0x1c(%ebp)
+     147:	e8 44 04 00 00       	call   590 <close>
+  wait();
+     14c:	e8 03 04 00 00       	call   554 <wait>
+  t1 = uptime();
+     151:	e8 da 03 00 00       	call   530 <uptime>
+  if(t1 == t0)
+     156:	83 c4 10             	add    $0x10,%esp
+  t1 = uptime();
+     159:	89 c1                	mov    %eax,%ecx
+  if(t1 == t0)
+     15b:	39 45 d4             	cmp    %eax,-0x2c(%ebp)
+     15e:	75 06                	jne    166 <main+0x166>
+    t1 = t0 + 1;
+     160:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     163:	8d 48 01             	lea    0x1(%eax),%ecx
+         kb, chunk, t1 - t0, kb * 100 / (t1 - t0));
+     166:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  printf(1, "pipebench: %d KB in %d-byte chunks, %d ticks, %d KB/s\n",
+     169:	31 d2                	xor    %edx,%edx
+         kb, chunk, t1 - t0, kb * 100 / (t1 - t0));
+     16b:	29 c1                	sub    %eax,%ecx
+  printf(1, "pipebench: %d KB in %d-byte chunks, %d ticks, %d KB/s\n",
+     16d:	50                   	push   %eax
+     16e:	50                   	push   %eax
+     16f:	b8 00 80 0c 00       	mov    $0xc8000,%eax
+     174:	f7 f9                	idiv   %ecx
+     176:	50                   	push   %eax
+     177:	51                   	push   %ecx
+     178:	53                   	push   %ebx
+     179:	68 00 20 00 00       	push   $0x2000
+     17e:	68 8c 1e 00 00       	push   $0x1e8c
+     183:	6a 01                	push   $0x1
+     185:	e8 36 08 00 00       	call   9c0 <printf>
+  exit();
+     18a:	83 c4 20             	add    $0x20,%esp
+     18d:	e9 05 ff ff ff       	jmp    97 <main+0x97>
+     192:	66 90                	xchg   %ax,%ax
+     194:	66 90                	xchg   %ax,%ax
+     196:	66 90                	xchg   %ax,%ax
+     198:	66 90                	xchg   %ax,%ax
+     19a:	66 90                	xchg   %ax,%ax
+     19c:	66 90                	xchg   %ax,%ax
+     19e:	66 90                	xchg   %ax,%ax
+
+000001a0 <fork>:
+int sysexit(void) __attribute__((noreturn));
+
+int
+fork(void)
+{
+  if(flushhook)
+     1a0:	a1 a0 49 00 00       	mov    0x49a0,%eax
+     1a5:	85 c0                	test   %eax,%eax
+     1a7:	74 17                	je     1c0 <fork+0x20>
+{
+     1a9:	55                   	push   %ebp
+     1aa:	89 e5                	mov    %esp,%ebp
+     1ac:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     1af:	ff d0                	call   *%eax
+  return sysfork();
+}
+     1b1:	c9                   	leave
+  return sysfork();
+     1b2:	e9 7f 03 00 00       	jmp    536 <sysfork>
+     1b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1be:	66 90                	xchg   %ax,%ax
+     1c0:	e9 71 03 00 00       	jmp    536 <sysfork>
+     1c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001d0 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+     1d0:	55                   	push   %ebp
+  if(flushhook)
+     1d1:	a1 a0 49 00 00       	mov    0x49a0,%eax
+{
+     1d6:	89 e5                	mov    %esp,%ebp
+     1d8:	56                   	push   %esi
+     1d9:	53                   	push   %ebx
+     1da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     1dd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     1e0:	85 c0                	test   %eax,%eax
+     1e2:	74 02                	je     1e6 <exec+0x16>
+    flushhook();
+     1e4:	ff d0                	call   *%eax
+  return sysexec(path, argv);
+     1e6:	89 75 0c             	mov    %esi,0xc(%ebp)
+     1e9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     1ec:	5b                   	pop    %ebx
+     1ed:	5e                   	pop    %esi
+     1ee:	5d                   	pop    %ebp
+  return sysexec(path, argv);
+     1ef:	e9 ba 03 00 00       	jmp    5ae <sysexec>
+     1f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1ff:	90                   	nop
+
+00000200 <exit>:
+
+int
+exit(void)
+{
+     200:	55                   	push   %ebp
+     201:	89 e5                	mov    %esp,%ebp
+     203:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     206:	a1 a0 49 00 00       	mov    0x49a0,%eax
+     20b:	85 c0                	test   %eax,%eax
+     20d:	74 02                	je     211 <exit+0x11>
+    flushhook();
+     20f:	ff d0                	call   *%eax
+  sysexit();
+     211:	e8 2f 03 00 00       	call   545 <sysexit>
+     216:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     21d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000220 <strcpy>:
+}
+
+char*
+strcpy(char *s, const char *t)
+{
+     220:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     221:	31 c0                	xor    %eax,%eax
+{
+     223:	89 e5                	mov    %esp,%ebp
+     225:	53                   	push   %ebx
+     226:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     229:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     22c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     230:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     234:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     237:	83 c0 01             	add    $0x1,%eax
+     23a:	84 d2                	test   %dl,%dl
+     23c:	75 f2                	jne    230 <strcpy+0x10>
+    ;
+  return os;
+}
+     23e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     241:	89 c8                	mov    %ecx,%eax
+     243:	c9                   	leave
+     244:	c3                   	ret
+     245:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000250 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     250:	55                   	push   %ebp
+     251:	89 e5                	mov    %esp,%ebp
+     253:	53                   	push   %ebx
+     254:	8b 55 08             	mov    0x8(%ebp),%edx
+     257:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     25a:	0f b6 02             	movzbl (%edx),%eax
+     25d:	84 c0                	test   %al,%al
+     25f:	75 17                	jne    278 <strcmp+0x28>
+     261:	eb 3a                	jmp    29d <strcmp+0x4d>
+     263:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     267:	90                   	nop
+     268:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     26c:	83 c2 01             	add    $0x1,%edx
+     26f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     272:	84 c0                	test   %al,%al
+     274:	74 1a                	je     290 <strcmp+0x40>
+    p++, q++;
+     276:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     278:	0f b6 19             	movzbl (%ecx),%ebx
+     27b:	38 c3                	cmp    %al,%bl
+     27d:	74 e9                	je     268 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     27f:	29 d8                	sub    %ebx,%eax
+}
+     281:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     284:	c9                   	leave
+     285:	c3                   	ret
+     286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     28d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     290:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     294:	31 c0                	xor    %eax,%eax
+     296:	29 d8                	sub    %ebx,%eax
+}
+     298:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     29b:	c9                   	leave
+     29c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     29d:	0f b6 19             	movzbl (%ecx),%ebx
+     2a0:	31 c0                	xor    %eax,%eax
+     2a2:	eb db                	jmp    27f <strcmp+0x2f>
+     2a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2af:	90                   	nop
+
+000002b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     2b0:	55                   	push   %ebp
+     2b1:	89 e5                	mov    %esp,%ebp
+     2b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     2b6:	80 3a 00             	cmpb   $0x0,(%edx)
+     2b9:	74 15                	je     2d0 <strlen+0x20>
+     2bb:	31 c0                	xor    %eax,%eax
+     2bd:	8d 76 00             	lea    0x0(%esi),%esi
+     2c0:	83 c0 01             	add    $0x1,%eax
+     2c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     2c7:	89 c1                	mov    %eax,%ecx
+     2c9:	75 f5                	jne    2c0 <strlen+0x10>
+    ;
+  return n;
+}
+     2cb:	89 c8                	mov    %ecx,%eax
+     2cd:	5d                   	pop    %ebp
+     2ce:	c3                   	ret
+     2cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+     2d0:	31 c9                	xor    %ecx,%ecx
+}
+     2d2:	5d                   	pop    %ebp
+     2d3:	89 c8                	mov    %ecx,%eax
+     2d5:	c3                   	ret
+     2d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     2e0:	55                   	push   %ebp
+     2e1:	89 e5                	mov    %esp,%ebp
+     2e3:	57                   	push   %edi
+     2e4:	8b 55 08             	mov    0x8(%ebp),%edx
+            "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt) {
+    asm volatile("cld; rep stosb" :
+     2e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     2ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2ed:	89 d7                	mov    %edx,%edi
+     2ef:	fc                   	cld
+     2f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     2f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     2f5:	89 d0                	mov    %edx,%eax
+     2f7:	c9                   	leave
+     2f8:	c3                   	ret
+     2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     300:	55                   	push   %ebp
+     301:	89 e5                	mov    %esp,%ebp
+     303:	8b 45 08             	mov    0x8(%ebp),%eax
+     306:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     30a:	0f b6 10             	movzbl (%eax),%edx
+     30d:	84 d2                	test   %dl,%dl
+     30f:	75 12                	jne    323 <strchr+0x23>
+     311:	eb 1d                	jmp    330 <strchr+0x30>
+     313:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     317:	90                   	nop
+     318:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     31c:	83 c0 01             	add    $0x1,%eax
+     31f:	84 d2                	test   %dl,%dl
+     321:	74 0d                	je     330 <strchr+0x30>
+    if(*s == c)
+     323:	38 d1                	cmp    %dl,%cl
+     325:	75 f1                	jne    318 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     327:	5d                   	pop    %ebp
+     328:	c3                   	ret
+     329:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     330:	31 c0                	xor    %eax,%eax
+}
+     332:	5d                   	pop    %ebp
+     333:	c3                   	ret
+     334:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     33b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     33f:	90                   	nop
+
+00000340 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     340:	55                   	push   %ebp
+     341:	89 e5                	mov    %esp,%ebp
+     343:	56                   	push   %esi
+     344:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     345:	83 ec 08             	sub    $0x8,%esp
+     348:	6a 00                	push   $0x0
+     34a:	ff 75 08             	push   0x8(%ebp)
+     34d:	e8 6b 02 00 00       	call   5bd <open>
+  if(fd < 0)
+     352:	83 c4 10             	add    $0x10,%esp
+     355:	85 c0                	test   %eax,%eax
+     357:	78 27                	js     380 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     359:	83 ec 08             	sub    $0x8,%esp
+     35c:	ff 75 0c             	push   0xc(%ebp)
+     35f:	89 c3                	mov    %eax,%ebx
+     361:	50                   	push   %eax
+     362:	e8 83 02 00 00       	call   5ea <fstat>
+  close(fd);
+     367:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     36a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     36c:	e8 1f 02 00 00       	call   590 <close>
+  return r;
+     371:	83 c4 10             	add    $0x10,%esp
+}
+     374:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     377:	89 f0                	mov    %esi,%eax
+     379:	5b                   	pop    %ebx
+     37a:	5e                   	pop    %esi
+     37b:	5d                   	pop    %ebp
+     37c:	c3                   	ret
+     37d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     380:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     385:	eb ed                	jmp    374 <stat+0x34>
+     387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     38e:	66 90                	xchg   %ax,%ax
+
+00000390 <atoi>:
+
+int
+atoi(const char *s)
+{
+     390:	55                   	push   %ebp
+     391:	89 e5                	mov    %esp,%ebp
+     393:	53                   	push   %ebx
+     394:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     397:	0f be 02             	movsbl (%edx),%eax
+     39a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     39d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     3a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     3a5:	77 1e                	ja     3c5 <atoi+0x35>
+     3a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     3b0:	83 c2 01             	add    $0x1,%edx
+     3b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     3b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     3ba:	0f be 02             	movsbl (%edx),%eax
+     3bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     3c0:	80 fb 09             	cmp    $0x9,%bl
+     3c3:	76 eb                	jbe    3b0 <atoi+0x20>
+  return n;
+}
+     3c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3c8:	89 c8                	mov    %ecx,%eax
+     3ca:	c9                   	leave
+     3cb:	c3                   	ret
+     3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     3d0:	55                   	push   %ebp
+     3d1:	89 e5                	mov    %esp,%ebp
+     3d3:	57                   	push   %edi
+     3d4:	56                   	push   %esi
+     3d5:	8b 45 10             	mov    0x10(%ebp),%eax
+     3d8:	8b 55 08             	mov    0x8(%ebp),%edx
+     3db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     3de:	85 c0                	test   %eax,%eax
+     3e0:	7e 13                	jle    3f5 <memmove+0x25>
+     3e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     3e4:	89 d7                	mov    %edx,%edi
+     3e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     3f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     3f1:	39 f8                	cmp    %edi,%eax
+     3f3:	75 fb                	jne    3f0 <memmove+0x20>
+  return vdst;
+}
+     3f5:	5e                   	pop    %esi
+     3f6:	89 d0                	mov    %edx,%eax
+     3f8:	5f                   	pop    %edi
+     3f9:	5d                   	pop    %ebp
+     3fa:	c3                   	ret
+     3fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3ff:	90                   	nop
+
+00000400 <mutex_init>:
+
+// Futex-based mutex (Drepper, "Futexes Are Tricky", mutex 2).
+// The uncontended paths never enter the kernel.
+void
+mutex_init(struct mutex *m)
+{
+     400:	55                   	push   %ebp
+     401:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+     403:	8b 45 08             	mov    0x8(%ebp),%eax
+     406:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     40c:	5d                   	pop    %ebp
+     40d:	c3                   	ret
+     40e:	66 90                	xchg   %ax,%ax
+
+00000410 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     410:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     411:	31 c0                	xor    %eax,%eax
+     413:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+     418:	89 e5                	mov    %esp,%ebp
+     41a:	56                   	push   %esi
+     41b:	53                   	push   %ebx
+     41c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     41f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     423:	85 c0                	test   %eax,%eax
+     425:	74 32                	je     459 <mutex_lock+0x49>
+    return;
+  if(c != 2)
+     427:	83 f8 02             	cmp    $0x2,%eax
+     42a:	74 0c                	je     438 <mutex_lock+0x28>
+static inline uint
+xchg(volatile uint *addr, uint newval) {
+    uint result;
+
+    // The + in "+m" denotes a read-modify-write operand.
+    asm volatile("lock; xchgl %0, %1" :
+     42c:	b8 02 00 00 00       	mov    $0x2,%eax
+     431:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+     434:	85 c0                	test   %eax,%eax
+     436:	74 21                	je     459 <mutex_lock+0x49>
+     438:	be 02 00 00 00       	mov    $0x2,%esi
+     43d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAIT, 2);
+     440:	83 ec 04             	sub    $0x4,%esp
+     443:	6a 02                	push   $0x2
+     445:	6a 00                	push   $0x0
+     447:	53                   	push   %ebx
+     448:	e8 33 02 00 00       	call   680 <futex>
+     44d:	89 f0                	mov    %esi,%eax
+     44f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     452:	83 c4 10             	add    $0x10,%esp
+     455:	85 c0                	test   %eax,%eax
+     457:	75 e7                	jne    440 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+     459:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     45c:	5b                   	pop    %ebx
+     45d:	5e                   	pop    %esi
+     45e:	5d                   	pop    %ebp
+     45f:	c3                   	ret
+
+00000460 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     460:	55                   	push   %ebp
+     461:	89 e5                	mov    %esp,%ebp
+     463:	83 ec 08             	sub    $0x8,%esp
+     466:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     469:	f0 83 28 01          	lock subl $0x1,(%eax)
+     46d:	75 09                	jne    478 <mutex_unlock+0x18>
+    m->val = 0;
+    futex(&m->val, FUTEX_WAKE, 1);
+  }
+}
+     46f:	c9                   	leave
+     470:	c3                   	ret
+     471:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     478:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     47b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex(&m->val, FUTEX_WAKE, 1);
+     481:	6a 01                	push   $0x1
+     483:	6a 01                	push   $0x1
+     485:	50                   	push   %eax
+     486:	e8 f5 01 00 00       	call   680 <futex>
+     48b:	83 c4 10             	add    $0x10,%esp
+}
+     48e:	c9                   	leave
+     48f:	c3                   	ret
+
+00000490 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     490:	55                   	push   %ebp
+     491:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     493:	8b 45 08             	mov    0x8(%ebp),%eax
+     496:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     49c:	5d                   	pop    %ebp
+     49d:	c3                   	ret
+     49e:	66 90                	xchg   %ax,%ax
+
+000004a0 <cond_wait>:
+
+// Release m and wait for a signal, then reacquire m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     4a0:	55                   	push   %ebp
+     4a1:	89 e5                	mov    %esp,%ebp
+     4a3:	57                   	push   %edi
+     4a4:	56                   	push   %esi
+     4a5:	53                   	push   %ebx
+     4a6:	83 ec 0c             	sub    $0xc,%esp
+     4a9:	8b 75 08             	mov    0x8(%ebp),%esi
+     4ac:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     4af:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     4b1:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+     4b5:	75 21                	jne    4d8 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     4b7:	83 ec 04             	sub    $0x4,%esp
+     4ba:	57                   	push   %edi
+     4bb:	6a 00                	push   $0x0
+     4bd:	56                   	push   %esi
+     4be:	e8 bd 01 00 00       	call   680 <futex>
+  mutex_lock(m);
+     4c3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     4c6:	83 c4 10             	add    $0x10,%esp
+}
+     4c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4cc:	5b                   	pop    %ebx
+     4cd:	5e                   	pop    %esi
+     4ce:	5f                   	pop    %edi
+     4cf:	5d                   	pop    %ebp
+  mutex_lock(m);
+     4d0:	e9 3b ff ff ff       	jmp    410 <mutex_lock>
+     4d5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     4d8:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     4db:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex(&m->val, FUTEX_WAKE, 1);
+     4e1:	6a 01                	push   $0x1
+     4e3:	6a 01                	push   $0x1
+     4e5:	53                   	push   %ebx
+     4e6:	e8 95 01 00 00       	call   680 <futex>
+     4eb:	83 c4 10             	add    $0x10,%esp
+     4ee:	eb c7                	jmp    4b7 <cond_wait+0x17>
+
+000004f0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+     4f0:	55                   	push   %ebp
+     4f1:	89 e5                	mov    %esp,%ebp
+     4f3:	83 ec 0c             	sub    $0xc,%esp
+     4f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     4f9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+     4fd:	6a 01                	push   $0x1
+     4ff:	6a 01                	push   $0x1
+     501:	50                   	push   %eax
+     502:	e8 79 01 00 00       	call   680 <futex>
+}
+     507:	83 c4 10             	add    $0x10,%esp
+     50a:	c9                   	leave
+     50b:	c3                   	ret
+     50c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000510 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     510:	55                   	push   %ebp
+     511:	89 e5                	mov    %esp,%ebp
+     513:	83 ec 0c             	sub    $0xc,%esp
+     516:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     519:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+     51d:	6a 40                	push   $0x40
+     51f:	6a 01                	push   $0x1
+     521:	50                   	push   %eax
+     522:	e8 59 01 00 00       	call   680 <futex>
+}
+     527:	83 c4 10             	add    $0x10,%esp
+     52a:	c9                   	leave
+     52b:	c3                   	ret
+     52c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000530 <uptime>:
+// Clock ticks since boot, read from the kernel's vdso page
+// without a system call.
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     530:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+     535:	c3                   	ret
+
+00000536 <sysfork>:
+  1: ret
+
+#define SYSCALL(name) SYSCALLAS(name, name)
+
+// ulib.c wraps these.
+SYSCALLAS(sysfork, fork)
+     536:	b8 01 00 00 00       	mov    $0x1,%eax
+     53b:	89 e1                	mov    %esp,%ecx
+     53d:	ba 44 05 00 00       	mov    $0x544,%edx
+     542:	0f 34                	sysenter
+     544:	c3                   	ret
+
+00000545 <sysexit>:
+SYSCALLAS(sysexit, exit)
+     545:	b8 02 00 00 00       	mov    $0x2,%eax
+     54a:	89 e1                	mov    %esp,%ecx
+     54c:	ba 53 05 00 00       	mov    $0x553,%edx
+     551:	0f 34                	sysenter
+     553:	c3                   	ret
+
+00000554 <wait>:
+SYSCALL(wait)
+     554:	b8 03 00 00 00       	mov    $0x3,%eax
+     559:	89 e1                	mov    %esp,%ecx
+     55b:	ba 62 05 00 00       	mov    $0x562,%edx
+     560:	0f 34                	sysenter
+     562:	c3                   	ret
+
+00000563 <pipe>:
+SYSCALL(pipe)
+     563:	b8 04 00 00 00       	mov    $0x4,%eax
+     568:	89 e1                	mov    %esp,%ecx
+     56a:	ba 71 05 00 00       	mov    $0x571,%edx
+     56f:	0f 34                	sysenter
+     571:	c3                   	ret
+
+00000572 <read>:
+SYSCALL(read)
+     572:	b8 05 00 00 00       	mov    $0x5,%eax
+     577:	89 e1                	mov    %esp,%ecx
+     579:	ba 80 05 00 00       	mov    $0x580,%edx
+     57e:	0f 34                	sysenter
+     580:	c3                   	ret
+
+00000581 <write>:
+SYSCALL(write)
+     581:	b8 10 00 00 00       	mov    $0x10,%eax
+     586:	89 e1                	mov    %esp,%ecx
+     588:	ba 8f 05 00 00       	mov    $0x58f,%edx
+     58d:	0f 34                	sysenter
+     58f:	c3                   	ret
+
+00000590 <close>:
+SYSCALL(close)
+     590:	b8 15 00 00 00       	mov    $0x15,%eax
+     595:	89 e1                	mov    %esp,%ecx
+     597:	ba 9e 05 00 00       	mov    $0x59e,%edx
+     59c:	0f 34                	sysenter
+     59e:	c3                   	ret
+
+0000059f <kill>:
+SYSCALL(kill)
+     59f:	b8 06 00 00 00       	mov    $0x6,%eax
+     5a4:	89 e1                	mov    %esp,%ecx
+     5a6:	ba ad 05 00 00       	mov    $0x5ad,%edx
+     5ab:	0f 34                	sysenter
+     5ad:	c3                   	ret
+
+000005ae <sysexec>:
+SYSCALLAS(sysexec, exec)
+     5ae:	b8 07 00 00 00       	mov    $0x7,%eax
+     5b3:	89 e1                	mov    %esp,%ecx
+     5b5:	ba bc 05 00 00       	mov    $0x5bc,%edx
+     5ba:	0f 34                	sysenter
+     5bc:	c3                   	ret
+
+000005bd <open>:
+SYSCALL(open)
+     5bd:	b8 0f 00 00 00       	mov    $0xf,%eax
+     5c2:	89 e1                	mov    %esp,%ecx
+     5c4:	ba cb 05 00 00       	mov    $0x5cb,%edx
+     5c9:	0f 34                	sysenter
+     5cb:	c3                   	ret
+
+000005cc <mknod>:
+SYSCALL(mknod)
+     5cc:	b8 11 00 00 00       	mov    $0x11,%eax
+     5d1:	89 e1                	mov    %esp,%ecx
+     5d3:	ba da 05 00 00       	mov    $0x5da,%edx
+     5d8:	0f 34                	sysenter
+     5da:	c3                   	ret
+
+000005db <unlink>:
+SYSCALL(unlink)
+     5db:	b8 12 00 00 00       	mov    $0x12,%eax
+     5e0:	89 e1                	mov    %esp,%ecx
+     5e2:	ba e9 05 00 00       	mov    $0x5e9,%edx
+     5e7:	0f 34                	sysenter
+     5e9:	c3                   	ret
+
+000005ea <fstat>:
+SYSCALL(fstat)
+     5ea:	b8 08 00 00 00       	mov    $0x8,%eax
+     5ef:	89 e1                	mov    %esp,%ecx
+     5f1:	ba f8 05 00 00       	mov    $0x5f8,%edx
+     5f6:	0f 34                	sysenter
+     5f8:	c3                   	ret
+
+000005f9 <link>:
+SYSCALL(link)
+     5f9:	b8 13 00 00 00       	mov    $0x13,%eax
+     5fe:	89 e1                	mov    %esp,%ecx
+     600:	ba 07 06 00 00       	mov    $0x607,%edx
+     605:	0f 34                	sysenter
+     607:	c3                   	ret
+
+00000608 <mkdir>:
+SYSCALL(mkdir)
+     608:	b8 14 00 00 00       	mov    $0x14,%eax
+     60d:	89 e1                	mov    %esp,%ecx
+     60f:	ba 16 06 00 00       	mov    $0x616,%edx
+     614:	0f 34                	sysenter
+     616:	c3                   	ret
+
+00000617 <chdir>:
+SYSCALL(chdir)
+     617:	b8 09 00 00 00       	mov    $0x9,%eax
+     61c:	89 e1                	mov    %esp,%ecx
+     61e:	ba 25 06 00 00       	mov    $0x625,%edx
+     623:	0f 34                	sysenter
+     625:	c3                   	ret
+
+00000626 <dup>:
+SYSCALL(dup)
+     626:	b8 0a 00 00 00       	mov    $0xa,%eax
+     62b:	89 e1                	mov    %esp,%ecx
+     62d:	ba 34 06 00 00       	mov    $0x634,%edx
+     632:	0f 34                	sysenter
+     634:	c3                   	ret
+
+00000635 <getpid>:
+SYSCALL(getpid)
+     635:	b8 0b 00 00 00       	mov    $0xb,%eax
+     63a:	89 e1                	mov    %esp,%ecx
+     63c:	ba 43 06 00 00       	mov    $0x643,%edx
+     641:	0f 34                	sysenter
+     643:	c3                   	ret
+
+00000644 <sbrk>:
+SYSCALL(sbrk)
+     644:	b8 0c 00 00 00       	mov    $0xc,%eax
+     649:	89 e1                	mov    %esp,%ecx
+     64b:	ba 52 06 00 00       	mov    $0x652,%edx
+     650:	0f 34                	sysenter
+     652:	c3                   	ret
+
+00000653 <sleep>:
+SYSCALL(sleep)
+     653:	b8 0d 00 00 00       	mov    $0xd,%eax
+     658:	89 e1                	mov    %esp,%ecx
+     65a:	ba 61 06 00 00       	mov    $0x661,%edx
+     65f:	0f 34                	sysenter
+     661:	c3                   	ret
+
+00000662 <clone>:
+SYSCALL(clone)
+     662:	b8 16 00 00 00       	mov    $0x16,%eax
+     667:	89 e1                	mov    %esp,%ecx
+     669:	ba 70 06 00 00       	mov    $0x670,%edx
+     66e:	0f 34                	sysenter
+     670:	c3                   	ret
+
+00000671 <join>:
+SYSCALL(join)
+     671:	b8 17 00 00 00       	mov    $0x17,%eax
+     676:	89 e1                	mov    %esp,%ecx
+     678:	ba 7f 06 00 00       	mov    $0x67f,%edx
+     67d:	0f 34                	sysenter
+     67f:	c3                   	ret
+
+00000680 <futex>:
+SYSCALL(futex)
+     680:	b8 18 00 00 00       	mov    $0x18,%eax
+     685:	89 e1                	mov    %esp,%ecx
+     687:	ba 8e 06 00 00       	mov    $0x68e,%edx
+     68c:	0f 34                	sysenter
+     68e:	c3                   	ret
+
+0000068f <yield>:
+SYSCALL(yield)
+     68f:	b8 19 00 00 00       	mov    $0x19,%eax
+     694:	89 e1                	mov    %esp,%ecx
+     696:	ba 9d 06 00 00       	mov    $0x69d,%edx
+     69b:	0f 34                	sysenter
+     69d:	c3                   	ret
+
+0000069e <lockstat>:
+SYSCALL(lockstat)
+     69e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     6a3:	89 e1                	mov    %esp,%ecx
+     6a5:	ba ac 06 00 00       	mov    $0x6ac,%edx
+     6aa:	0f 34                	sysenter
+     6ac:	c3                   	ret
+
+000006ad <lockhammer>:
+SYSCALL(lockhammer)
+     6ad:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     6b2:	89 e1                	mov    %esp,%ecx
+     6b4:	ba bb 06 00 00       	mov    $0x6bb,%edx
+     6b9:	0f 34                	sysenter
+     6bb:	c3                   	ret
+
+000006bc <vmsplice>:
+SYSCALL(vmsplice)
+     6bc:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     6c1:	89 e1                	mov    %esp,%ecx
+     6c3:	ba ca 06 00 00       	mov    $0x6ca,%edx
+     6c8:	0f 34                	sysenter
+     6ca:	c3                   	ret
+
+000006cb <hsbrk>:
+SYSCALL(hsbrk)
+     6cb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     6d0:	89 e1                	mov    %esp,%ecx
+     6d2:	ba d9 06 00 00       	mov    $0x6d9,%edx
+     6d7:	0f 34                	sysenter
+     6d9:	c3                   	ret
+
+000006da <mmap>:
+SYSCALL(mmap)
+     6da:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     6df:	89 e1                	mov    %esp,%ecx
+     6e1:	ba e8 06 00 00       	mov    $0x6e8,%edx
+     6e6:	0f 34                	sysenter
+     6e8:	c3                   	ret
+
+000006e9 <munmap>:
+SYSCALL(munmap)
+     6e9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     6ee:	89 e1                	mov    %esp,%ecx
+     6f0:	ba f7 06 00 00       	mov    $0x6f7,%edx
+     6f5:	0f 34                	sysenter
+     6f7:	c3                   	ret
+
+000006f8 <ringenter>:
+SYSCALL(ringenter)
+     6f8:	b8 20 00 00 00       	mov    $0x20,%eax
+     6fd:	89 e1                	mov    %esp,%ecx
+     6ff:	ba 06 07 00 00       	mov    $0x706,%edx
+     704:	0f 34                	sysenter
+     706:	c3                   	ret
+
+00000707 <readv>:
+SYSCALL(readv)
+     707:	b8 21 00 00 00       	mov    $0x21,%eax
+     70c:	89 e1                	mov    %esp,%ecx
+     70e:	ba 15 07 00 00       	mov    $0x715,%edx
+     713:	0f 34                	sysenter
+     715:	c3                   	ret
+
+00000716 <writev>:
+SYSCALL(writev)
+     716:	b8 22 00 00 00       	mov    $0x22,%eax
+     71b:	89 e1                	mov    %esp,%ecx
+     71d:	ba 24 07 00 00       	mov    $0x724,%edx
+     722:	0f 34                	sysenter
+     724:	c3                   	ret
+
+00000725 <pread>:
+SYSCALL(pread)
+     725:	b8 23 00 00 00       	mov    $0x23,%eax
+     72a:	89 e1                	mov    %esp,%ecx
+     72c:	ba 33 07 00 00       	mov    $0x733,%edx
+     731:	0f 34                	sysenter
+     733:	c3                   	ret
+
+00000734 <pwrite>:
+SYSCALL(pwrite)
+     734:	b8 24 00 00 00       	mov    $0x24,%eax
+     739:	89 e1                	mov    %esp,%ecx
+     73b:	ba 42 07 00 00       	mov    $0x742,%edx
+     740:	0f 34                	sysenter
+     742:	c3                   	ret
+
+00000743 <prof>:
+SYSCALL(prof)
+     743:	b8 25 00 00 00       	mov    $0x25,%eax
+     748:	89 e1                	mov    %esp,%ecx
+     74a:	ba 51 07 00 00       	mov    $0x751,%edx
+     74f:	0f 34                	sysenter
+     751:	c3                   	ret
+
+00000752 <scstat>:
+SYSCALL(scstat)
+     752:	b8 26 00 00 00       	mov    $0x26,%eax
+     757:	89 e1                	mov    %esp,%ecx
+     759:	ba 60 07 00 00       	mov    $0x760,%edx
+     75e:	0f 34                	sysenter
+     760:	c3                   	ret
+     761:	66 90                	xchg   %ax,%ax
+     763:	66 90                	xchg   %ax,%ax
+     765:	66 90                	xchg   %ax,%ax
+     767:	66 90                	xchg   %ax,%ax
+     769:	66 90                	xchg   %ax,%ax
+     76b:	66 90                	xchg   %ax,%ax
+     76d:	66 90                	xchg   %ax,%ax
+     76f:	90                   	nop
+
+00000770 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+     770:	55                   	push   %ebp
+     771:	89 e5                	mov    %esp,%ebp
+     773:	57                   	push   %edi
+     774:	56                   	push   %esi
+     775:	53                   	push   %ebx
+     776:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     778:	89 d1                	mov    %edx,%ecx
+{
+     77a:	83 ec 2c             	sub    $0x2c,%esp
+     77d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+     780:	85 d2                	test   %edx,%edx
+     782:	79 7c                	jns    800 <printint+0x90>
+     784:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     788:	74 76                	je     800 <printint+0x90>
+    x = -xx;
+     78a:	f7 d9                	neg    %ecx
+    neg = 1;
+     78c:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     791:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     794:	31 f6                	xor    %esi,%esi
+     796:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     79d:	8d 76 00             	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     7a0:	89 c8                	mov    %ecx,%eax
+     7a2:	31 d2                	xor    %edx,%edx
+     7a4:	89 f7                	mov    %esi,%edi
+     7a6:	f7 f3                	div    %ebx
+     7a8:	8d 76 01             	lea    0x1(%esi),%esi
+     7ab:	0f b6 92 54 1f 00 00 	movzbl 0x1f54(%edx),%edx
+     7b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     7b6:	89 ca                	mov    %ecx,%edx
+     7b8:	89 c1                	mov    %eax,%ecx
+     7ba:	39 da                	cmp    %ebx,%edx
+     7bc:	73 e2                	jae    7a0 <printint+0x30>
+  if(neg)
+     7be:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     7c1:	85 c0                	test   %eax,%eax
+     7c3:	74 07                	je     7cc <printint+0x5c>
+    buf[i++] = '-';
+     7c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     7ca:	89 f7                	mov    %esi,%edi
+     7cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     7cf:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     7d2:	01 df                	add    %ebx,%edi
+     7d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc_unlocked(buf[i], f);
+     7d8:	83 ec 08             	sub    $0x8,%esp
+     7db:	56                   	push   %esi
+     7dc:	0f be 07             	movsbl (%edi),%eax
+     7df:	50                   	push   %eax
+     7e0:	e8 cb 07 00 00       	call   fb0 <putc_unlocked>
+  while(--i >= 0)
+     7e5:	89 f8                	mov    %edi,%eax
+     7e7:	83 c4 10             	add    $0x10,%esp
+     7ea:	83 ef 01             	sub    $0x1,%edi
+     7ed:	39 d8                	cmp    %ebx,%eax
+     7ef:	75 e7                	jne    7d8 <printint+0x68>
+}
+     7f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     7f4:	5b                   	pop    %ebx
+     7f5:	5e                   	pop    %esi
+     7f6:	5f                   	pop    %edi
+     7f7:	5d                   	pop    %ebp
+     7f8:	c3                   	ret
+     7f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     800:	31 c0                	xor    %eax,%eax
+     802:	eb 8d                	jmp    791 <printint+0x21>
+     804:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     80b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     80f:	90                   	nop
+
+00000810 <vfprintf>:
+
+// Print to the given stream, which the caller has locked.
+// Only understands %d, %x, %p, %s.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+     810:	55                   	push   %ebp
+     811:	89 e5                	mov    %esp,%ebp
+     813:	57                   	push   %edi
+     814:	56                   	push   %esi
+     815:	53                   	push   %ebx
+     816:	83 ec 1c             	sub    $0x1c,%esp
+     819:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     81c:	0f b6 0a             	movzbl (%edx),%ecx
+     81f:	84 c9                	test   %cl,%cl
+     821:	74 5c                	je     87f <vfprintf+0x6f>
+     823:	89 c6                	mov    %eax,%esi
+     825:	8d 5a 01             	lea    0x1(%edx),%ebx
+     828:	31 ff                	xor    %edi,%edi
+     82a:	eb 20                	jmp    84c <vfprintf+0x3c>
+     82c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     830:	83 f9 25             	cmp    $0x25,%ecx
+     833:	74 3b                	je     870 <vfprintf+0x60>
+        state = '%';
+      } else {
+        putc_unlocked(c, f);
+     835:	83 ec 08             	sub    $0x8,%esp
+     838:	56                   	push   %esi
+     839:	51                   	push   %ecx
+     83a:	e8 71 07 00 00       	call   fb0 <putc_unlocked>
+     83f:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     842:	0f b6 0b             	movzbl (%ebx),%ecx
+     845:	83 c3 01             	add    $0x1,%ebx
+     848:	84 c9                	test   %cl,%cl
+     84a:	74 33                	je     87f <vfprintf+0x6f>
+    if(state == 0){
+     84c:	85 ff                	test   %edi,%edi
+     84e:	74 e0                	je     830 <vfprintf+0x20>
+      }
+    } else if(state == '%'){
+     850:	83 ff 25             	cmp    $0x25,%edi
+     853:	75 ed                	jne    842 <vfprintf+0x32>
+      if(c == 'd'){
+     855:	83 f9 25             	cmp    $0x25,%ecx
+     858:	0f 84 02 01 00 00    	je     960 <vfprintf+0x150>
+     85e:	8d 41 9d             	lea    -0x63(%ecx),%eax
+     861:	83 f8 15             	cmp    $0x15,%eax
+     864:	77 2a                	ja     890 <vfprintf+0x80>
+     866:	ff 24 85 fc 1e 00 00 	jmp    *0x1efc(,%eax,4)
+     86d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     870:	0f b6 0b             	movzbl (%ebx),%ecx
+     873:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     876:	bf 25 00 00 00       	mov    $0x25,%edi
+  for(i = 0; fmt[i]; i++){
+     87b:	84 c9                	test   %cl,%cl
+     87d:	75 cd                	jne    84c <vfprintf+0x3c>
+        putc_unlocked(c, f);
+      }
+      state = 0;
+    }
+  }
+}
+     87f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     882:	5b                   	pop    %ebx
+     883:	5e                   	pop    %esi
+     884:	5f                   	pop    %edi
+     885:	5d                   	pop    %ebp
+     886:	c3                   	ret
+     887:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     88e:	66 90                	xchg   %ax,%ax
+        putc_unlocked('%', f);
+     890:	83 ec 08             	sub    $0x8,%esp
+     893:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     896:	56                   	push   %esi
+     897:	6a 25                	push   $0x25
+     899:	e8 12 07 00 00       	call   fb0 <putc_unlocked>
+        putc_unlocked(c, f);
+     89e:	58                   	pop    %eax
+     89f:	5a                   	pop    %edx
+     8a0:	56                   	push   %esi
+     8a1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     8a4:	51                   	push   %ecx
+     8a5:	e8 06 07 00 00       	call   fb0 <putc_unlocked>
+     8aa:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     8ad:	31 ff                	xor    %edi,%edi
+     8af:	eb 91                	jmp    842 <vfprintf+0x32>
+     8b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+     8b8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     8bb:	83 ec 0c             	sub    $0xc,%esp
+     8be:	b9 10 00 00 00       	mov    $0x10,%ecx
+     8c3:	8b 17                	mov    (%edi),%edx
+     8c5:	6a 00                	push   $0x0
+        ap++;
+     8c7:	83 c7 04             	add    $0x4,%edi
+        printint(f, *ap, 16, 0);
+     8ca:	89 f0                	mov    %esi,%eax
+     8cc:	e8 9f fe ff ff       	call   770 <printint>
+        ap++;
+     8d1:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     8d4:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     8d7:	31 ff                	xor    %edi,%edi
+     8d9:	e9 64 ff ff ff       	jmp    842 <vfprintf+0x32>
+     8de:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     8e0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     8e3:	8b 10                	mov    (%eax),%edx
+        ap++;
+     8e5:	83 c0 04             	add    $0x4,%eax
+     8e8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     8eb:	85 d2                	test   %edx,%edx
+     8ed:	0f 84 85 00 00 00    	je     978 <vfprintf+0x168>
+        while(*s != 0){
+     8f3:	0f be 02             	movsbl (%edx),%eax
+        s = (char*)*ap;
+     8f6:	89 d7                	mov    %edx,%edi
+        while(*s != 0){
+     8f8:	84 c0                	test   %al,%al
+     8fa:	74 b1                	je     8ad <vfprintf+0x9d>
+     8fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+          putc_unlocked(*s, f);
+     900:	83 ec 08             	sub    $0x8,%esp
+          s++;
+     903:	83 c7 01             	add    $0x1,%edi
+          putc_unlocked(*s, f);
+     906:	56                   	push   %esi
+     907:	50                   	push   %eax
+     908:	e8 a3 06 00 00       	call   fb0 <putc_unlocked>
+        while(*s != 0){
+     90d:	0f be 07             	movsbl (%edi),%eax
+     910:	83 c4 10             	add    $0x10,%esp
+     913:	84 c0                	test   %al,%al
+     915:	75 e9                	jne    900 <vfprintf+0xf0>
+      state = 0;
+     917:	31 ff                	xor    %edi,%edi
+     919:	e9 24 ff ff ff       	jmp    842 <vfprintf+0x32>
+     91e:	66 90                	xchg   %ax,%ax
+        printint(f, *ap, 10, 1);
+     920:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     923:	83 ec 0c             	sub    $0xc,%esp
+     926:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     92b:	8b 17                	mov    (%edi),%edx
+     92d:	6a 01                	push   $0x1
+     92f:	eb 96                	jmp    8c7 <vfprintf+0xb7>
+     931:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc_unlocked(*ap, f);
+     938:	83 ec 08             	sub    $0x8,%esp
+     93b:	56                   	push   %esi
+     93c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     93f:	ff 37                	push   (%edi)
+     941:	e8 6a 06 00 00       	call   fb0 <putc_unlocked>
+        ap++;
+     946:	89 f8                	mov    %edi,%eax
+     948:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     94b:	31 ff                	xor    %edi,%edi
+        ap++;
+     94d:	83 c0 04             	add    $0x4,%eax
+     950:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     953:	e9 ea fe ff ff       	jmp    842 <vfprintf+0x32>
+     958:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     95f:	90                   	nop
+        putc_unlocked(c, f);
+     960:	83 ec 08             	sub    $0x8,%esp
+      state = 0;
+     963:	31 ff                	xor    %edi,%edi
+        putc_unlocked(c, f);
+     965:	56                   	push   %esi
+     966:	6a 25                	push   $0x25
+     968:	e8 43 06 00 00       	call   fb0 <putc_unlocked>
+     96d:	83 c4 10             	add    $0x10,%esp
+     970:	e9 cd fe ff ff       	jmp    842 <vfprintf+0x32>
+     975:	8d 76 00             	lea    0x0(%esi),%esi
+     978:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     97d:	bf f4 1e 00 00       	mov    $0x1ef4,%edi
+     982:	e9 79 ff ff ff       	jmp    900 <vfprintf+0xf0>
+     987:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     98e:	66 90                	xchg   %ax,%ax
+
+00000990 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+     990:	55                   	push   %ebp
+     991:	89 e5                	mov    %esp,%ebp
+     993:	53                   	push   %ebx
+     994:	83 ec 10             	sub    $0x10,%esp
+     997:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  flockfile(f);
+     99a:	53                   	push   %ebx
+     99b:	e8 d0 02 00 00       	call   c70 <flockfile>
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     9a0:	8b 55 0c             	mov    0xc(%ebp),%edx
+     9a3:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     9a6:	89 d8                	mov    %ebx,%eax
+     9a8:	e8 63 fe ff ff       	call   810 <vfprintf>
+  funlockfile(f);
+     9ad:	89 1c 24             	mov    %ebx,(%esp)
+     9b0:	e8 eb 02 00 00       	call   ca0 <funlockfile>
+}
+     9b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9b8:	83 c4 10             	add    $0x10,%esp
+     9bb:	c9                   	leave
+     9bc:	c3                   	ret
+     9bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009c0 <printf>:
+
+// Print to the given fd: through stdout or stderr for 1 and 2,
+// otherwise with one write() per call.
+void
+printf(int fd, const char *fmt, ...)
+{
+     9c0:	55                   	push   %ebp
+     9c1:	89 e5                	mov    %esp,%ebp
+     9c3:	56                   	push   %esi
+     9c4:	53                   	push   %ebx
+     9c5:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+     9cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  char buf[128];
+  struct iobuf f;
+
+  if(fd == 1 || fd == 2){
+    flockfile(&_iob[fd]);
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     9ce:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(fd == 1 || fd == 2){
+     9d1:	8d 50 ff             	lea    -0x1(%eax),%edx
+     9d4:	83 fa 01             	cmp    $0x1,%edx
+     9d7:	76 77                	jbe    a50 <printf+0x90>
+    funlockfile(&_iob[fd]);
+    return;
+  }
+  f.fd = fd;
+     9d9:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  f.flags = IO_WRITE|IO_SETUP;
+  f.buf = buf;
+     9df:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  f.size = sizeof(buf);
+  f.r = f.n = 0;
+  mutex_init(&f.lock);
+     9e5:	83 ec 0c             	sub    $0xc,%esp
+     9e8:	8d 9d 5c ff ff ff    	lea    -0xa4(%ebp),%ebx
+  f.buf = buf;
+     9ee:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+  mutex_init(&f.lock);
+     9f4:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  f.flags = IO_WRITE|IO_SETUP;
+     9fa:	c7 85 60 ff ff ff 42 	movl   $0x42,-0xa0(%ebp)
+     a01:	00 00 00 
+  f.size = sizeof(buf);
+     a04:	c7 85 68 ff ff ff 80 	movl   $0x80,-0x98(%ebp)
+     a0b:	00 00 00 
+  f.r = f.n = 0;
+     a0e:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+     a15:	00 00 00 
+     a18:	c7 85 6c ff ff ff 00 	movl   $0x0,-0x94(%ebp)
+     a1f:	00 00 00 
+  mutex_init(&f.lock);
+     a22:	50                   	push   %eax
+     a23:	e8 d8 f9 ff ff       	call   400 <mutex_init>
+  vfprintf(&f, fmt, (uint*)(void*)&fmt + 1);
+     a28:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     a2b:	89 f2                	mov    %esi,%edx
+     a2d:	89 d8                	mov    %ebx,%eax
+     a2f:	e8 dc fd ff ff       	call   810 <vfprintf>
+  fflush(&f);
+     a34:	89 1c 24             	mov    %ebx,(%esp)
+     a37:	e8 f4 04 00 00       	call   f30 <fflush>
+     a3c:	83 c4 10             	add    $0x10,%esp
+}
+     a3f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     a42:	5b                   	pop    %ebx
+     a43:	5e                   	pop    %esi
+     a44:	5d                   	pop    %ebp
+     a45:	c3                   	ret
+     a46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a4d:	8d 76 00             	lea    0x0(%esi),%esi
+    flockfile(&_iob[fd]);
+     a50:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     a53:	83 ec 0c             	sub    $0xc,%esp
+     a56:	8d 98 c0 28 00 00    	lea    0x28c0(%eax),%ebx
+     a5c:	53                   	push   %ebx
+     a5d:	e8 0e 02 00 00       	call   c70 <flockfile>
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     a62:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     a65:	89 f2                	mov    %esi,%edx
+     a67:	89 d8                	mov    %ebx,%eax
+     a69:	e8 a2 fd ff ff       	call   810 <vfprintf>
+    funlockfile(&_iob[fd]);
+     a6e:	89 1c 24             	mov    %ebx,(%esp)
+     a71:	e8 2a 02 00 00       	call   ca0 <funlockfile>
+     a76:	83 c4 10             	add    $0x10,%esp
+}
+     a79:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     a7c:	5b                   	pop    %ebx
+     a7d:	5e                   	pop    %esi
+     a7e:	5d                   	pop    %ebp
+     a7f:	c3                   	ret
+
+00000a80 <setup>:
+}
+
+// Choose how to buffer f on first use: by lines on a device.
+static void
+setup(FILE *f)
+{
+     a80:	55                   	push   %ebp
+     a81:	89 e5                	mov    %esp,%ebp
+     a83:	53                   	push   %ebx
+     a84:	89 c3                	mov    %eax,%ebx
+     a86:	83 ec 2c             	sub    $0x2c,%esp
+  struct stat st;
+
+  f->flags |= IO_SETUP;
+     a89:	83 48 04 40          	orl    $0x40,0x4(%eax)
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     a8d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     a90:	50                   	push   %eax
+     a91:	ff 33                	push   (%ebx)
+     a93:	e8 52 fb ff ff       	call   5ea <fstat>
+     a98:	83 c4 10             	add    $0x10,%esp
+     a9b:	85 c0                	test   %eax,%eax
+    f->flags |= IO_DEV|IO_LINE;
+     a9d:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     aa0:	75 07                	jne    aa9 <setup+0x29>
+     aa2:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+     aa7:	74 17                	je     ac0 <setup+0x40>
+  if(f->flags & IO_WRITE)
+     aa9:	a8 02                	test   $0x2,%al
+     aab:	74 0a                	je     ab7 <setup+0x37>
+    flushhook = flushall;
+     aad:	c7 05 a0 49 00 00 e0 	movl   $0xbe0,0x49a0
+     ab4:	0b 00 00 
+}
+     ab7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     aba:	c9                   	leave
+     abb:	c3                   	ret
+     abc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    f->flags |= IO_DEV|IO_LINE;
+     ac0:	83 c8 30             	or     $0x30,%eax
+     ac3:	89 43 04             	mov    %eax,0x4(%ebx)
+     ac6:	eb e1                	jmp    aa9 <setup+0x29>
+     ac8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     acf:	90                   	nop
+
+00000ad0 <flush>:
+static int
+flush(FILE *f)
+{
+  int i, n;
+
+  if(!(f->flags & IO_WRITE))
+     ad0:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+     ad4:	74 6a                	je     b40 <flush+0x70>
+{
+     ad6:	55                   	push   %ebp
+     ad7:	89 e5                	mov    %esp,%ebp
+     ad9:	56                   	push   %esi
+     ada:	89 c6                	mov    %eax,%esi
+     adc:	53                   	push   %ebx
+    return 0;
+  for(i = 0; i < f->n; i += n){
+     add:	8b 40 14             	mov    0x14(%eax),%eax
+     ae0:	85 c0                	test   %eax,%eax
+     ae2:	7e 4c                	jle    b30 <flush+0x60>
+     ae4:	31 db                	xor    %ebx,%ebx
+     ae6:	eb 11                	jmp    af9 <flush+0x29>
+     ae8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aef:	90                   	nop
+     af0:	01 c3                	add    %eax,%ebx
+     af2:	8b 46 14             	mov    0x14(%esi),%eax
+     af5:	39 d8                	cmp    %ebx,%eax
+     af7:	7e 37                	jle    b30 <flush+0x60>
+    if((n = write(f->fd, f->buf + i, f->n - i)) <= 0){
+     af9:	83 ec 04             	sub    $0x4,%esp
+     afc:	29 d8                	sub    %ebx,%eax
+     afe:	50                   	push   %eax
+     aff:	8b 46 08             	mov    0x8(%esi),%eax
+     b02:	01 d8                	add    %ebx,%eax
+     b04:	50                   	push   %eax
+     b05:	ff 36                	push   (%esi)
+     b07:	e8 75 fa ff ff       	call   581 <write>
+     b0c:	83 c4 10             	add    $0x10,%esp
+     b0f:	85 c0                	test   %eax,%eax
+     b11:	7f dd                	jg     af0 <flush+0x20>
+      f->flags |= IO_ERR;
+     b13:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+      f->n = 0;
+     b17:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     b1c:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+      return EOF;
+    }
+  }
+  f->n = 0;
+  return 0;
+}
+     b23:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b26:	5b                   	pop    %ebx
+     b27:	5e                   	pop    %esi
+     b28:	5d                   	pop    %ebp
+     b29:	c3                   	ret
+     b2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->n = 0;
+     b30:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+}
+     b37:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+     b3a:	31 c0                	xor    %eax,%eax
+}
+     b3c:	5b                   	pop    %ebx
+     b3d:	5e                   	pop    %esi
+     b3e:	5d                   	pop    %ebp
+     b3f:	c3                   	ret
+    return 0;
+     b40:	31 c0                	xor    %eax,%eax
+}
+     b42:	c3                   	ret
+     b43:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000b50 <fflush.part.0>:
+fflush(FILE *f)
+     b50:	55                   	push   %ebp
+     b51:	89 e5                	mov    %esp,%ebp
+     b53:	57                   	push   %edi
+     b54:	bf b8 29 00 00       	mov    $0x29b8,%edi
+     b59:	56                   	push   %esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     b5a:	31 f6                	xor    %esi,%esi
+fflush(FILE *f)
+     b5c:	53                   	push   %ebx
+     b5d:	bb d8 28 00 00       	mov    $0x28d8,%ebx
+     b62:	83 ec 1c             	sub    $0x1c,%esp
+     b65:	eb 10                	jmp    b77 <fflush.part.0+0x27>
+     b67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b6e:	66 90                	xchg   %ax,%ax
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     b70:	83 c3 1c             	add    $0x1c,%ebx
+     b73:	39 df                	cmp    %ebx,%edi
+     b75:	74 33                	je     baa <fflush.part.0+0x5a>
+      if((f->flags & IO_WRITE) && fflush(f) < 0)
+     b77:	f6 43 ec 02          	testb  $0x2,-0x14(%ebx)
+     b7b:	74 f3                	je     b70 <fflush.part.0+0x20>
+  if(threaded)
+     b7d:	8b 0d c0 49 00 00    	mov    0x49c0,%ecx
+     b83:	85 c9                	test   %ecx,%ecx
+     b85:	75 49                	jne    bd0 <fflush.part.0+0x80>
+  r = flush(f);
+     b87:	8d 43 e8             	lea    -0x18(%ebx),%eax
+     b8a:	e8 41 ff ff ff       	call   ad0 <flush>
+  if(threaded)
+     b8f:	8b 15 c0 49 00 00    	mov    0x49c0,%edx
+     b95:	85 d2                	test   %edx,%edx
+     b97:	75 1f                	jne    bb8 <fflush.part.0+0x68>
+        r = EOF;
+     b99:	85 c0                	test   %eax,%eax
+     b9b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     ba0:	0f 48 f0             	cmovs  %eax,%esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     ba3:	83 c3 1c             	add    $0x1c,%ebx
+     ba6:	39 df                	cmp    %ebx,%edi
+     ba8:	75 cd                	jne    b77 <fflush.part.0+0x27>
+}
+     baa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bad:	89 f0                	mov    %esi,%eax
+     baf:	5b                   	pop    %ebx
+     bb0:	5e                   	pop    %esi
+     bb1:	5f                   	pop    %edi
+     bb2:	5d                   	pop    %ebp
+     bb3:	c3                   	ret
+     bb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     bb8:	83 ec 0c             	sub    $0xc,%esp
+     bbb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     bbe:	53                   	push   %ebx
+     bbf:	e8 9c f8 ff ff       	call   460 <mutex_unlock>
+     bc4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     bc7:	83 c4 10             	add    $0x10,%esp
+     bca:	eb cd                	jmp    b99 <fflush.part.0+0x49>
+     bcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     bd0:	83 ec 0c             	sub    $0xc,%esp
+     bd3:	53                   	push   %ebx
+     bd4:	e8 37 f8 ff ff       	call   410 <mutex_lock>
+     bd9:	83 c4 10             	add    $0x10,%esp
+     bdc:	eb a9                	jmp    b87 <fflush.part.0+0x37>
+     bde:	66 90                	xchg   %ax,%ax
+
+00000be0 <flushall>:
+  if(f == 0){
+     be0:	e9 6b ff ff ff       	jmp    b50 <fflush.part.0>
+     be5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000bf0 <fill>:
+
+// Refill f's buffer. Returns the number of bytes read.
+// Caller holds f's lock.
+static int
+fill(FILE *f)
+{
+     bf0:	55                   	push   %ebp
+     bf1:	89 e5                	mov    %esp,%ebp
+     bf3:	53                   	push   %ebx
+     bf4:	89 c3                	mov    %eax,%ebx
+     bf6:	83 ec 04             	sub    $0x4,%esp
+  int n;
+
+  if(!(f->flags & IO_SETUP))
+     bf9:	8b 40 04             	mov    0x4(%eax),%eax
+     bfc:	a8 40                	test   $0x40,%al
+     bfe:	74 50                	je     c50 <fill+0x60>
+    setup(f);
+  if(f->flags & IO_DEV)
+     c00:	a8 20                	test   $0x20,%al
+     c02:	75 3c                	jne    c40 <fill+0x50>
+    fflush(0);
+  f->r = 0;
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     c04:	83 ec 04             	sub    $0x4,%esp
+  f->r = 0;
+     c07:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     c0e:	ff 73 0c             	push   0xc(%ebx)
+     c11:	ff 73 08             	push   0x8(%ebx)
+     c14:	ff 33                	push   (%ebx)
+     c16:	e8 57 f9 ff ff       	call   572 <read>
+     c1b:	83 c4 10             	add    $0x10,%esp
+     c1e:	85 c0                	test   %eax,%eax
+     c20:	7f 10                	jg     c32 <fill+0x42>
+    f->flags |= n < 0 ? IO_ERR : IO_EOF;
+     c22:	83 f8 01             	cmp    $0x1,%eax
+     c25:	19 c0                	sbb    %eax,%eax
+     c27:	83 e0 fc             	and    $0xfffffffc,%eax
+     c2a:	83 c0 08             	add    $0x8,%eax
+     c2d:	09 43 04             	or     %eax,0x4(%ebx)
+    n = 0;
+     c30:	31 c0                	xor    %eax,%eax
+  }
+  f->n = n;
+     c32:	89 43 14             	mov    %eax,0x14(%ebx)
+  return n;
+}
+     c35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c38:	c9                   	leave
+     c39:	c3                   	ret
+     c3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == 0){
+     c40:	e8 0b ff ff ff       	call   b50 <fflush.part.0>
+     c45:	eb bd                	jmp    c04 <fill+0x14>
+     c47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c4e:	66 90                	xchg   %ax,%ax
+    setup(f);
+     c50:	89 d8                	mov    %ebx,%eax
+     c52:	e8 29 fe ff ff       	call   a80 <setup>
+  if(f->flags & IO_DEV)
+     c57:	8b 43 04             	mov    0x4(%ebx),%eax
+     c5a:	eb a4                	jmp    c00 <fill+0x10>
+     c5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c60 <stdio_threaded>:
+  threaded = 1;
+     c60:	c7 05 c0 49 00 00 01 	movl   $0x1,0x49c0
+     c67:	00 00 00 
+}
+     c6a:	c3                   	ret
+     c6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c6f:	90                   	nop
+
+00000c70 <flockfile>:
+{
+     c70:	55                   	push   %ebp
+  if(threaded)
+     c71:	8b 15 c0 49 00 00    	mov    0x49c0,%edx
+{
+     c77:	89 e5                	mov    %esp,%ebp
+     c79:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     c7c:	85 d2                	test   %edx,%edx
+     c7e:	75 08                	jne    c88 <flockfile+0x18>
+}
+     c80:	5d                   	pop    %ebp
+     c81:	c3                   	ret
+     c82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_lock(&f->lock);
+     c88:	83 c0 18             	add    $0x18,%eax
+     c8b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     c8e:	5d                   	pop    %ebp
+    mutex_lock(&f->lock);
+     c8f:	e9 7c f7 ff ff       	jmp    410 <mutex_lock>
+     c94:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c9f:	90                   	nop
+
+00000ca0 <funlockfile>:
+{
+     ca0:	55                   	push   %ebp
+  if(threaded)
+     ca1:	8b 15 c0 49 00 00    	mov    0x49c0,%edx
+{
+     ca7:	89 e5                	mov    %esp,%ebp
+     ca9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     cac:	85 d2                	test   %edx,%edx
+     cae:	75 08                	jne    cb8 <funlockfile+0x18>
+}
+     cb0:	5d                   	pop    %ebp
+     cb1:	c3                   	ret
+     cb2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&f->lock);
+     cb8:	83 c0 18             	add    $0x18,%eax
+     cbb:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     cbe:	5d                   	pop    %ebp
+    mutex_unlock(&f->lock);
+     cbf:	e9 9c f7 ff ff       	jmp    460 <mutex_unlock>
+     cc4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ccb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ccf:	90                   	nop
+
+00000cd0 <fopen>:
+{
+     cd0:	55                   	push   %ebp
+     cd1:	89 e5                	mov    %esp,%ebp
+     cd3:	57                   	push   %edi
+     cd4:	56                   	push   %esi
+     cd5:	53                   	push   %ebx
+     cd6:	83 ec 34             	sub    $0x34,%esp
+     cd9:	8b 75 0c             	mov    0xc(%ebp),%esi
+     cdc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(strcmp(mode, "r") != 0 && strcmp(mode, "w") != 0)
+     cdf:	68 65 1f 00 00       	push   $0x1f65
+     ce4:	56                   	push   %esi
+     ce5:	e8 66 f5 ff ff       	call   250 <strcmp>
+     cea:	83 c4 10             	add    $0x10,%esp
+     ced:	85 c0                	test   %eax,%eax
+     cef:	74 15                	je     d06 <fopen+0x36>
+     cf1:	83 ec 08             	sub    $0x8,%esp
+     cf4:	68 67 1f 00 00       	push   $0x1f67
+     cf9:	56                   	push   %esi
+     cfa:	e8 51 f5 ff ff       	call   250 <strcmp>
+     cff:	83 c4 10             	add    $0x10,%esp
+     d02:	85 c0                	test   %eax,%eax
+     d04:	75 2c                	jne    d32 <fopen+0x62>
+  if(threaded)
+     d06:	a1 c0 49 00 00       	mov    0x49c0,%eax
+     d0b:	85 c0                	test   %eax,%eax
+     d0d:	0f 85 ed 00 00 00    	jne    e00 <fopen+0x130>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     d13:	bb 14 29 00 00       	mov    $0x2914,%ebx
+    if(f->flags == 0)
+     d18:	8b 53 04             	mov    0x4(%ebx),%edx
+     d1b:	85 d2                	test   %edx,%edx
+     d1d:	74 21                	je     d40 <fopen+0x70>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     d1f:	83 c3 1c             	add    $0x1c,%ebx
+     d22:	81 fb a0 29 00 00    	cmp    $0x29a0,%ebx
+     d28:	75 ee                	jne    d18 <fopen+0x48>
+  if(threaded)
+     d2a:	85 c0                	test   %eax,%eax
+     d2c:	0f 85 36 01 00 00    	jne    e68 <fopen+0x198>
+    return 0;
+     d32:	31 db                	xor    %ebx,%ebx
+     d34:	e9 96 00 00 00       	jmp    dcf <fopen+0xff>
+     d39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f == &_iob[NSTREAM])
+     d40:	81 fb a0 29 00 00    	cmp    $0x29a0,%ebx
+     d46:	74 e2                	je     d2a <fopen+0x5a>
+    f->flags = IO_MALLOC;
+     d48:	c7 43 04 80 00 00 00 	movl   $0x80,0x4(%ebx)
+  if(threaded)
+     d4f:	85 c0                	test   %eax,%eax
+     d51:	0f 85 f9 00 00 00    	jne    e50 <fopen+0x180>
+  if(mode[0] == 'r'){
+     d57:	80 3e 72             	cmpb   $0x72,(%esi)
+     d5a:	0f 84 c0 00 00 00    	je     e20 <fopen+0x150>
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     d60:	83 ec 08             	sub    $0x8,%esp
+     d63:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     d66:	50                   	push   %eax
+     d67:	57                   	push   %edi
+     d68:	e8 d3 f5 ff ff       	call   340 <stat>
+     d6d:	83 c4 10             	add    $0x10,%esp
+     d70:	85 c0                	test   %eax,%eax
+     d72:	74 6c                	je     de0 <fopen+0x110>
+    fd = open(path, O_CREATE|O_WRONLY);
+     d74:	83 ec 08             	sub    $0x8,%esp
+     d77:	68 01 02 00 00       	push   $0x201
+     d7c:	57                   	push   %edi
+    flags = IO_WRITE;
+     d7d:	bf 02 00 00 00       	mov    $0x2,%edi
+    fd = open(path, O_CREATE|O_WRONLY);
+     d82:	e8 36 f8 ff ff       	call   5bd <open>
+     d87:	83 c4 10             	add    $0x10,%esp
+     d8a:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     d8c:	85 f6                	test   %esi,%esi
+     d8e:	0f 88 a9 00 00 00    	js     e3d <fopen+0x16d>
+     d94:	83 ec 0c             	sub    $0xc,%esp
+     d97:	68 00 02 00 00       	push   $0x200
+     d9c:	e8 af 0c 00 00       	call   1a50 <malloc>
+     da1:	83 c4 10             	add    $0x10,%esp
+     da4:	89 43 08             	mov    %eax,0x8(%ebx)
+     da7:	85 c0                	test   %eax,%eax
+     da9:	0f 84 d0 00 00 00    	je     e7f <fopen+0x1af>
+  f->flags = flags|IO_MALLOC;
+     daf:	81 cf 80 00 00 00    	or     $0x80,%edi
+  f->fd = fd;
+     db5:	89 33                	mov    %esi,(%ebx)
+  f->size = BUFSIZ;
+     db7:	c7 43 0c 00 02 00 00 	movl   $0x200,0xc(%ebx)
+  f->r = f->n = 0;
+     dbe:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+     dc5:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  f->flags = flags|IO_MALLOC;
+     dcc:	89 7b 04             	mov    %edi,0x4(%ebx)
+}
+     dcf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     dd2:	89 d8                	mov    %ebx,%eax
+     dd4:	5b                   	pop    %ebx
+     dd5:	5e                   	pop    %esi
+     dd6:	5f                   	pop    %edi
+     dd7:	5d                   	pop    %ebp
+     dd8:	c3                   	ret
+     dd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     de0:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+     de5:	75 8d                	jne    d74 <fopen+0xa4>
+      unlink(path);
+     de7:	83 ec 0c             	sub    $0xc,%esp
+     dea:	57                   	push   %edi
+     deb:	e8 eb f7 ff ff       	call   5db <unlink>
+     df0:	83 c4 10             	add    $0x10,%esp
+     df3:	e9 7c ff ff ff       	jmp    d74 <fopen+0xa4>
+     df8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dff:	90                   	nop
+    mutex_lock(&iolock);
+     e00:	83 ec 0c             	sub    $0xc,%esp
+     e03:	68 c4 49 00 00       	push   $0x49c4
+     e08:	e8 03 f6 ff ff       	call   410 <mutex_lock>
+  if(threaded)
+     e0d:	a1 c0 49 00 00       	mov    0x49c0,%eax
+     e12:	83 c4 10             	add    $0x10,%esp
+     e15:	e9 f9 fe ff ff       	jmp    d13 <fopen+0x43>
+     e1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    fd = open(path, O_RDONLY);
+     e20:	83 ec 08             	sub    $0x8,%esp
+     e23:	6a 00                	push   $0x0
+     e25:	57                   	push   %edi
+    flags = IO_READ;
+     e26:	bf 01 00 00 00       	mov    $0x1,%edi
+    fd = open(path, O_RDONLY);
+     e2b:	e8 8d f7 ff ff       	call   5bd <open>
+     e30:	83 c4 10             	add    $0x10,%esp
+     e33:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     e35:	85 f6                	test   %esi,%esi
+     e37:	0f 89 57 ff ff ff    	jns    d94 <fopen+0xc4>
+    f->flags = 0;
+     e3d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    return 0;
+     e44:	31 db                	xor    %ebx,%ebx
+     e46:	eb 87                	jmp    dcf <fopen+0xff>
+     e48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e4f:	90                   	nop
+    mutex_unlock(&iolock);
+     e50:	83 ec 0c             	sub    $0xc,%esp
+     e53:	68 c4 49 00 00       	push   $0x49c4
+     e58:	e8 03 f6 ff ff       	call   460 <mutex_unlock>
+     e5d:	83 c4 10             	add    $0x10,%esp
+     e60:	e9 f2 fe ff ff       	jmp    d57 <fopen+0x87>
+     e65:	8d 76 00             	lea    0x0(%esi),%esi
+     e68:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+     e6b:	31 db                	xor    %ebx,%ebx
+    mutex_unlock(&iolock);
+     e6d:	68 c4 49 00 00       	push   $0x49c4
+     e72:	e8 e9 f5 ff ff       	call   460 <mutex_unlock>
+     e77:	83 c4 10             	add    $0x10,%esp
+     e7a:	e9 50 ff ff ff       	jmp    dcf <fopen+0xff>
+      close(fd);
+     e7f:	83 ec 0c             	sub    $0xc,%esp
+     e82:	56                   	push   %esi
+     e83:	e8 08 f7 ff ff       	call   590 <close>
+     e88:	83 c4 10             	add    $0x10,%esp
+     e8b:	eb b0                	jmp    e3d <fopen+0x16d>
+     e8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e90 <fclose>:
+{
+     e90:	55                   	push   %ebp
+     e91:	89 e5                	mov    %esp,%ebp
+     e93:	56                   	push   %esi
+     e94:	53                   	push   %ebx
+  if(threaded)
+     e95:	8b 15 c0 49 00 00    	mov    0x49c0,%edx
+{
+     e9b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+     e9e:	85 d2                	test   %edx,%edx
+     ea0:	75 46                	jne    ee8 <fclose+0x58>
+  r = flush(f);
+     ea2:	89 d8                	mov    %ebx,%eax
+     ea4:	e8 27 fc ff ff       	call   ad0 <flush>
+  if(close(f->fd) < 0)
+     ea9:	83 ec 0c             	sub    $0xc,%esp
+     eac:	ff 33                	push   (%ebx)
+  r = flush(f);
+     eae:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+     eb0:	e8 db f6 ff ff       	call   590 <close>
+     eb5:	83 c4 10             	add    $0x10,%esp
+    r = EOF;
+     eb8:	85 c0                	test   %eax,%eax
+     eba:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     ebf:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->flags & IO_MALLOC)
+     ec2:	f6 43 04 80          	testb  $0x80,0x4(%ebx)
+     ec6:	75 58                	jne    f20 <fclose+0x90>
+  if(threaded)
+     ec8:	a1 c0 49 00 00       	mov    0x49c0,%eax
+  f->flags = 0;
+     ecd:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  if(threaded)
+     ed4:	85 c0                	test   %eax,%eax
+     ed6:	75 28                	jne    f00 <fclose+0x70>
+}
+     ed8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     edb:	89 f0                	mov    %esi,%eax
+     edd:	5b                   	pop    %ebx
+     ede:	5e                   	pop    %esi
+     edf:	5d                   	pop    %ebp
+     ee0:	c3                   	ret
+     ee1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     ee8:	83 ec 0c             	sub    $0xc,%esp
+     eeb:	8d 43 18             	lea    0x18(%ebx),%eax
+     eee:	50                   	push   %eax
+     eef:	e8 1c f5 ff ff       	call   410 <mutex_lock>
+     ef4:	83 c4 10             	add    $0x10,%esp
+     ef7:	eb a9                	jmp    ea2 <fclose+0x12>
+     ef9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     f00:	83 ec 0c             	sub    $0xc,%esp
+     f03:	83 c3 18             	add    $0x18,%ebx
+     f06:	53                   	push   %ebx
+     f07:	e8 54 f5 ff ff       	call   460 <mutex_unlock>
+     f0c:	83 c4 10             	add    $0x10,%esp
+}
+     f0f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f12:	89 f0                	mov    %esi,%eax
+     f14:	5b                   	pop    %ebx
+     f15:	5e                   	pop    %esi
+     f16:	5d                   	pop    %ebp
+     f17:	c3                   	ret
+     f18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f1f:	90                   	nop
+    free(f->buf);
+     f20:	83 ec 0c             	sub    $0xc,%esp
+     f23:	ff 73 08             	push   0x8(%ebx)
+     f26:	e8 f5 09 00 00       	call   1920 <free>
+     f2b:	83 c4 10             	add    $0x10,%esp
+     f2e:	eb 98                	jmp    ec8 <fclose+0x38>
+
+00000f30 <fflush>:
+{
+     f30:	55                   	push   %ebp
+     f31:	89 e5                	mov    %esp,%ebp
+     f33:	53                   	push   %ebx
+     f34:	83 ec 14             	sub    $0x14,%esp
+     f37:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f == 0){
+     f3a:	85 db                	test   %ebx,%ebx
+     f3c:	74 5a                	je     f98 <fflush+0x68>
+  if(threaded)
+     f3e:	8b 0d c0 49 00 00    	mov    0x49c0,%ecx
+     f44:	85 c9                	test   %ecx,%ecx
+     f46:	75 18                	jne    f60 <fflush+0x30>
+  r = flush(f);
+     f48:	89 d8                	mov    %ebx,%eax
+     f4a:	e8 81 fb ff ff       	call   ad0 <flush>
+  if(threaded)
+     f4f:	8b 15 c0 49 00 00    	mov    0x49c0,%edx
+     f55:	85 d2                	test   %edx,%edx
+     f57:	75 1f                	jne    f78 <fflush+0x48>
+}
+     f59:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f5c:	c9                   	leave
+     f5d:	c3                   	ret
+     f5e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+     f60:	83 ec 0c             	sub    $0xc,%esp
+     f63:	8d 43 18             	lea    0x18(%ebx),%eax
+     f66:	50                   	push   %eax
+     f67:	e8 a4 f4 ff ff       	call   410 <mutex_lock>
+     f6c:	83 c4 10             	add    $0x10,%esp
+     f6f:	eb d7                	jmp    f48 <fflush+0x18>
+     f71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     f78:	83 ec 0c             	sub    $0xc,%esp
+     f7b:	83 c3 18             	add    $0x18,%ebx
+     f7e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     f81:	53                   	push   %ebx
+     f82:	e8 d9 f4 ff ff       	call   460 <mutex_unlock>
+     f87:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     f8a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    mutex_unlock(&f->lock);
+     f8d:	83 c4 10             	add    $0x10,%esp
+}
+     f90:	c9                   	leave
+     f91:	c3                   	ret
+     f92:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     f98:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f9b:	c9                   	leave
+     f9c:	e9 af fb ff ff       	jmp    b50 <fflush.part.0>
+     fa1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fa8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     faf:	90                   	nop
+
+00000fb0 <putc_unlocked>:
+{
+     fb0:	55                   	push   %ebp
+     fb1:	89 e5                	mov    %esp,%ebp
+     fb3:	56                   	push   %esi
+     fb4:	53                   	push   %ebx
+     fb5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     fb8:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(!(f->flags & IO_WRITE))
+     fbb:	8b 43 04             	mov    0x4(%ebx),%eax
+     fbe:	a8 02                	test   $0x2,%al
+     fc0:	74 46                	je     1008 <putc_unlocked+0x58>
+  if(!(f->flags & IO_SETUP))
+     fc2:	a8 40                	test   $0x40,%al
+     fc4:	74 4a                	je     1010 <putc_unlocked+0x60>
+  if(f->n == f->size && flush(f) < 0)
+     fc6:	8b 43 14             	mov    0x14(%ebx),%eax
+     fc9:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     fcc:	74 51                	je     101f <putc_unlocked+0x6f>
+  f->buf[f->n++] = c;
+     fce:	8d 48 01             	lea    0x1(%eax),%ecx
+     fd1:	8b 53 08             	mov    0x8(%ebx),%edx
+     fd4:	89 4b 14             	mov    %ecx,0x14(%ebx)
+     fd7:	89 f1                	mov    %esi,%ecx
+     fd9:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     fdc:	83 fe 0a             	cmp    $0xa,%esi
+     fdf:	74 0f                	je     ff0 <putc_unlocked+0x40>
+  return c & 0xff;
+     fe1:	89 f0                	mov    %esi,%eax
+     fe3:	0f b6 c0             	movzbl %al,%eax
+}
+     fe6:	5b                   	pop    %ebx
+     fe7:	5e                   	pop    %esi
+     fe8:	5d                   	pop    %ebp
+     fe9:	c3                   	ret
+     fea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     ff0:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+     ff4:	74 eb                	je     fe1 <putc_unlocked+0x31>
+     ff6:	89 d8                	mov    %ebx,%eax
+     ff8:	e8 d3 fa ff ff       	call   ad0 <flush>
+     ffd:	85 c0                	test   %eax,%eax
+     fff:	79 e0                	jns    fe1 <putc_unlocked+0x31>
+    1001:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return EOF;
+    1008:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    100d:	eb d7                	jmp    fe6 <putc_unlocked+0x36>
+    100f:	90                   	nop
+    setup(f);
+    1010:	89 d8                	mov    %ebx,%eax
+    1012:	e8 69 fa ff ff       	call   a80 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    1017:	8b 43 14             	mov    0x14(%ebx),%eax
+    101a:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    101d:	75 af                	jne    fce <putc_unlocked+0x1e>
+    101f:	89 d8                	mov    %ebx,%eax
+    1021:	e8 aa fa ff ff       	call   ad0 <flush>
+    1026:	85 c0                	test   %eax,%eax
+    1028:	78 de                	js     1008 <putc_unlocked+0x58>
+  f->buf[f->n++] = c;
+    102a:	8b 43 14             	mov    0x14(%ebx),%eax
+    102d:	eb 9f                	jmp    fce <putc_unlocked+0x1e>
+    102f:	90                   	nop
+
+00001030 <fputc>:
+{
+    1030:	55                   	push   %ebp
+    1031:	89 e5                	mov    %esp,%ebp
+    1033:	56                   	push   %esi
+    1034:	53                   	push   %ebx
+  if(threaded)
+    1035:	8b 15 c0 49 00 00    	mov    0x49c0,%edx
+{
+    103b:	8b 75 08             	mov    0x8(%ebp),%esi
+    103e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(threaded)
+    1041:	85 d2                	test   %edx,%edx
+    1043:	75 6b                	jne    10b0 <fputc+0x80>
+  if(!(f->flags & IO_WRITE))
+    1045:	8b 43 04             	mov    0x4(%ebx),%eax
+    1048:	a8 02                	test   $0x2,%al
+    104a:	0f 84 b8 00 00 00    	je     1108 <fputc+0xd8>
+  if(!(f->flags & IO_SETUP))
+    1050:	a8 40                	test   $0x40,%al
+    1052:	74 76                	je     10ca <fputc+0x9a>
+  if(f->n == f->size && flush(f) < 0)
+    1054:	8b 43 14             	mov    0x14(%ebx),%eax
+    1057:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    105a:	74 7d                	je     10d9 <fputc+0xa9>
+  f->buf[f->n++] = c;
+    105c:	8d 48 01             	lea    0x1(%eax),%ecx
+    105f:	8b 53 08             	mov    0x8(%ebx),%edx
+    1062:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    1065:	89 f1                	mov    %esi,%ecx
+    1067:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    106a:	83 fe 0a             	cmp    $0xa,%esi
+    106d:	74 21                	je     1090 <fputc+0x60>
+  return c & 0xff;
+    106f:	89 f0                	mov    %esi,%eax
+    1071:	0f b6 f0             	movzbl %al,%esi
+  if(threaded)
+    1074:	a1 c0 49 00 00       	mov    0x49c0,%eax
+    1079:	85 c0                	test   %eax,%eax
+    107b:	75 73                	jne    10f0 <fputc+0xc0>
+}
+    107d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1080:	89 f0                	mov    %esi,%eax
+    1082:	5b                   	pop    %ebx
+    1083:	5e                   	pop    %esi
+    1084:	5d                   	pop    %ebp
+    1085:	c3                   	ret
+    1086:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    108d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    1090:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1094:	74 d9                	je     106f <fputc+0x3f>
+    1096:	89 d8                	mov    %ebx,%eax
+    1098:	e8 33 fa ff ff       	call   ad0 <flush>
+    109d:	85 c0                	test   %eax,%eax
+    109f:	79 ce                	jns    106f <fputc+0x3f>
+    return EOF;
+    10a1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    10a6:	eb cc                	jmp    1074 <fputc+0x44>
+    10a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10af:	90                   	nop
+    mutex_lock(&f->lock);
+    10b0:	83 ec 0c             	sub    $0xc,%esp
+    10b3:	8d 43 18             	lea    0x18(%ebx),%eax
+    10b6:	50                   	push   %eax
+    10b7:	e8 54 f3 ff ff       	call   410 <mutex_lock>
+  if(!(f->flags & IO_WRITE))
+    10bc:	8b 43 04             	mov    0x4(%ebx),%eax
+    10bf:	83 c4 10             	add    $0x10,%esp
+    10c2:	a8 02                	test   $0x2,%al
+    10c4:	74 db                	je     10a1 <fputc+0x71>
+  if(!(f->flags & IO_SETUP))
+    10c6:	a8 40                	test   $0x40,%al
+    10c8:	75 8a                	jne    1054 <fputc+0x24>
+    setup(f);
+    10ca:	89 d8                	mov    %ebx,%eax
+    10cc:	e8 af f9 ff ff       	call   a80 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    10d1:	8b 43 14             	mov    0x14(%ebx),%eax
+    10d4:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    10d7:	75 83                	jne    105c <fputc+0x2c>
+    10d9:	89 d8                	mov    %ebx,%eax
+    10db:	e8 f0 f9 ff ff       	call   ad0 <flush>
+    10e0:	85 c0                	test   %eax,%eax
+    10e2:	78 bd                	js     10a1 <fputc+0x71>
+  f->buf[f->n++] = c;
+    10e4:	8b 43 14             	mov    0x14(%ebx),%eax
+    10e7:	e9 70 ff ff ff       	jmp    105c <fputc+0x2c>
+    10ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    10f0:	83 ec 0c             	sub    $0xc,%esp
+    10f3:	83 c3 18             	add    $0x18,%ebx
+    10f6:	53                   	push   %ebx
+    10f7:	e8 64 f3 ff ff       	call   460 <mutex_unlock>
+    10fc:	83 c4 10             	add    $0x10,%esp
+}
+    10ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1102:	89 f0                	mov    %esi,%eax
+    1104:	5b                   	pop    %ebx
+    1105:	5e                   	pop    %esi
+    1106:	5d                   	pop    %ebp
+    1107:	c3                   	ret
+    return EOF;
+    1108:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    110d:	e9 6b ff ff ff       	jmp    107d <fputc+0x4d>
+    1112:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1119:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001120 <fwrite>:
+{
+    1120:	55                   	push   %ebp
+    1121:	89 e5                	mov    %esp,%ebp
+    1123:	57                   	push   %edi
+    1124:	56                   	push   %esi
+    1125:	53                   	push   %ebx
+    1126:	83 ec 1c             	sub    $0x1c,%esp
+    1129:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  if(!(f->flags & IO_WRITE) || size <= 0)
+    112c:	8b 43 04             	mov    0x4(%ebx),%eax
+    112f:	a8 02                	test   $0x2,%al
+    1131:	0f 84 ec 00 00 00    	je     1223 <fwrite+0x103>
+    1137:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    113a:	85 c9                	test   %ecx,%ecx
+    113c:	0f 8e e1 00 00 00    	jle    1223 <fwrite+0x103>
+  if(threaded)
+    1142:	8b 15 c0 49 00 00    	mov    0x49c0,%edx
+    1148:	85 d2                	test   %edx,%edx
+    114a:	0f 85 1c 01 00 00    	jne    126c <fwrite+0x14c>
+  if(!(f->flags & IO_SETUP))
+    1150:	a8 40                	test   $0x40,%al
+    1152:	0f 84 08 01 00 00    	je     1260 <fwrite+0x140>
+  for(len = size*nmemb; len > 0; len -= n){
+    1158:	8b 45 0c             	mov    0xc(%ebp),%eax
+    115b:	0f af 45 10          	imul   0x10(%ebp),%eax
+    115f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    1162:	85 c0                	test   %eax,%eax
+    1164:	0f 8e 2a 01 00 00    	jle    1294 <fwrite+0x174>
+  s = p;
+    116a:	8b 45 08             	mov    0x8(%ebp),%eax
+  nl = 0;
+    116d:	31 ff                	xor    %edi,%edi
+    116f:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+        nl = 1;
+    1172:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  s = p;
+    1175:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1178:	8b 43 14             	mov    0x14(%ebx),%eax
+        nl = 1;
+    117b:	89 ce                	mov    %ecx,%esi
+    if(f->n == f->size && flush(f) < 0)
+    117d:	89 c2                	mov    %eax,%edx
+    117f:	39 f0                	cmp    %esi,%eax
+    1181:	74 6e                	je     11f1 <fwrite+0xd1>
+    1183:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1187:	90                   	nop
+    if(n > len)
+    1188:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    n = f->size - f->n;
+    118b:	89 f1                	mov    %esi,%ecx
+    118d:	29 c1                	sub    %eax,%ecx
+    118f:	39 f9                	cmp    %edi,%ecx
+    1191:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1194:	85 c9                	test   %ecx,%ecx
+    1196:	0f 8e 7c 00 00 00    	jle    1218 <fwrite+0xf8>
+    119c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    119f:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    11a2:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    11a5:	8d 34 08             	lea    (%eax,%ecx,1),%esi
+    11a8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    11ab:	eb 06                	jmp    11b3 <fwrite+0x93>
+    11ad:	8d 76 00             	lea    0x0(%esi),%esi
+      if((f->buf[f->n++] = s[i]) == '\n')
+    11b0:	8b 53 14             	mov    0x14(%ebx),%edx
+    11b3:	8d 4a 01             	lea    0x1(%edx),%ecx
+    11b6:	8b 73 08             	mov    0x8(%ebx),%esi
+    11b9:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    11bc:	0f b6 08             	movzbl (%eax),%ecx
+        nl = 1;
+    11bf:	80 f9 0a             	cmp    $0xa,%cl
+      if((f->buf[f->n++] = s[i]) == '\n')
+    11c2:	88 0c 16             	mov    %cl,(%esi,%edx,1)
+        nl = 1;
+    11c5:	be 01 00 00 00       	mov    $0x1,%esi
+    11ca:	0f 44 fe             	cmove  %esi,%edi
+    for(i = 0; i < n; i++)
+    11cd:	83 c0 01             	add    $0x1,%eax
+    11d0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    11d3:	75 db                	jne    11b0 <fwrite+0x90>
+    s += n;
+    11d5:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    11d8:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    11db:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    s += n;
+    11de:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    11e1:	85 c0                	test   %eax,%eax
+    11e3:	7e 48                	jle    122d <fwrite+0x10d>
+    11e5:	8b 43 14             	mov    0x14(%ebx),%eax
+    11e8:	8b 73 0c             	mov    0xc(%ebx),%esi
+    if(f->n == f->size && flush(f) < 0)
+    11eb:	89 c2                	mov    %eax,%edx
+    11ed:	39 f0                	cmp    %esi,%eax
+    11ef:	75 97                	jne    1188 <fwrite+0x68>
+    11f1:	89 d8                	mov    %ebx,%eax
+    11f3:	e8 d8 f8 ff ff       	call   ad0 <flush>
+    11f8:	85 c0                	test   %eax,%eax
+    11fa:	78 31                	js     122d <fwrite+0x10d>
+    n = f->size - f->n;
+    11fc:	8b 73 0c             	mov    0xc(%ebx),%esi
+    11ff:	8b 43 14             	mov    0x14(%ebx),%eax
+    1202:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    1205:	89 f1                	mov    %esi,%ecx
+    1207:	89 c2                	mov    %eax,%edx
+    1209:	29 c1                	sub    %eax,%ecx
+    120b:	39 f9                	cmp    %edi,%ecx
+    120d:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1210:	85 c9                	test   %ecx,%ecx
+    1212:	7f 88                	jg     119c <fwrite+0x7c>
+    1214:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    s += n;
+    1218:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    121b:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    121e:	e9 5a ff ff ff       	jmp    117d <fwrite+0x5d>
+}
+    1223:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    1226:	31 c0                	xor    %eax,%eax
+}
+    1228:	5b                   	pop    %ebx
+    1229:	5e                   	pop    %esi
+    122a:	5f                   	pop    %edi
+    122b:	5d                   	pop    %ebp
+    122c:	c3                   	ret
+  if(nl && (f->flags & IO_LINE))
+    122d:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1230:	85 ff                	test   %edi,%edi
+    1232:	74 06                	je     123a <fwrite+0x11a>
+    1234:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1238:	75 1d                	jne    1257 <fwrite+0x137>
+  return (s - (const char*)p) / size;
+    123a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    123d:	2b 75 08             	sub    0x8(%ebp),%esi
+  if(threaded)
+    1240:	a1 c0 49 00 00       	mov    0x49c0,%eax
+    1245:	85 c0                	test   %eax,%eax
+    1247:	75 3a                	jne    1283 <fwrite+0x163>
+  return (s - (const char*)p) / size;
+    1249:	89 f0                	mov    %esi,%eax
+    124b:	99                   	cltd
+    124c:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    124f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1252:	5b                   	pop    %ebx
+    1253:	5e                   	pop    %esi
+    1254:	5f                   	pop    %edi
+    1255:	5d                   	pop    %ebp
+    1256:	c3                   	ret
+    flush(f);
+    1257:	89 d8                	mov    %ebx,%eax
+    1259:	e8 72 f8 ff ff       	call   ad0 <flush>
+    125e:	eb da                	jmp    123a <fwrite+0x11a>
+    setup(f);
+    1260:	89 d8                	mov    %ebx,%eax
+    1262:	e8 19 f8 ff ff       	call   a80 <setup>
+    1267:	e9 ec fe ff ff       	jmp    1158 <fwrite+0x38>
+    mutex_lock(&f->lock);
+    126c:	83 ec 0c             	sub    $0xc,%esp
+    126f:	8d 43 18             	lea    0x18(%ebx),%eax
+    1272:	50                   	push   %eax
+    1273:	e8 98 f1 ff ff       	call   410 <mutex_lock>
+  if(!(f->flags & IO_SETUP))
+    1278:	8b 43 04             	mov    0x4(%ebx),%eax
+    127b:	83 c4 10             	add    $0x10,%esp
+    127e:	e9 cd fe ff ff       	jmp    1150 <fwrite+0x30>
+    mutex_unlock(&f->lock);
+    1283:	83 ec 0c             	sub    $0xc,%esp
+    1286:	83 c3 18             	add    $0x18,%ebx
+    1289:	53                   	push   %ebx
+    128a:	e8 d1 f1 ff ff       	call   460 <mutex_unlock>
+    128f:	83 c4 10             	add    $0x10,%esp
+    1292:	eb b5                	jmp    1249 <fwrite+0x129>
+  for(len = size*nmemb; len > 0; len -= n){
+    1294:	31 f6                	xor    %esi,%esi
+    1296:	eb a8                	jmp    1240 <fwrite+0x120>
+    1298:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    129f:	90                   	nop
+
+000012a0 <fgetc>:
+  return f->buf[f->r++] & 0xff;
+}
+
+int
+fgetc(FILE *f)
+{
+    12a0:	55                   	push   %ebp
+    12a1:	89 e5                	mov    %esp,%ebp
+    12a3:	56                   	push   %esi
+    12a4:	53                   	push   %ebx
+  if(threaded)
+    12a5:	8b 15 c0 49 00 00    	mov    0x49c0,%edx
+{
+    12ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    12ae:	85 d2                	test   %edx,%edx
+    12b0:	75 2e                	jne    12e0 <fgetc+0x40>
+  if(!(f->flags & IO_READ))
+    12b2:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    12b6:	74 78                	je     1330 <fgetc+0x90>
+  if(f->r == f->n && fill(f) == 0)
+    12b8:	8b 43 10             	mov    0x10(%ebx),%eax
+    12bb:	3b 43 14             	cmp    0x14(%ebx),%eax
+    12be:	74 60                	je     1320 <fgetc+0x80>
+  return f->buf[f->r++] & 0xff;
+    12c0:	8b 53 08             	mov    0x8(%ebx),%edx
+    12c3:	8d 48 01             	lea    0x1(%eax),%ecx
+    12c6:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    12c9:	0f b6 34 02          	movzbl (%edx,%eax,1),%esi
+  if(threaded)
+    12cd:	a1 c0 49 00 00       	mov    0x49c0,%eax
+    12d2:	85 c0                	test   %eax,%eax
+    12d4:	75 2a                	jne    1300 <fgetc+0x60>
+
+  flockfile(f);
+  c = getc_unlocked(f);
+  funlockfile(f);
+  return c;
+}
+    12d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12d9:	89 f0                	mov    %esi,%eax
+    12db:	5b                   	pop    %ebx
+    12dc:	5e                   	pop    %esi
+    12dd:	5d                   	pop    %ebp
+    12de:	c3                   	ret
+    12df:	90                   	nop
+    mutex_lock(&f->lock);
+    12e0:	83 ec 0c             	sub    $0xc,%esp
+    12e3:	8d 43 18             	lea    0x18(%ebx),%eax
+    12e6:	50                   	push   %eax
+    12e7:	e8 24 f1 ff ff       	call   410 <mutex_lock>
+  if(!(f->flags & IO_READ))
+    12ec:	83 c4 10             	add    $0x10,%esp
+    12ef:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    12f3:	75 c3                	jne    12b8 <fgetc+0x18>
+    return EOF;
+    12f5:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    12fa:	eb d1                	jmp    12cd <fgetc+0x2d>
+    12fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1300:	83 ec 0c             	sub    $0xc,%esp
+    1303:	83 c3 18             	add    $0x18,%ebx
+    1306:	53                   	push   %ebx
+    1307:	e8 54 f1 ff ff       	call   460 <mutex_unlock>
+    130c:	83 c4 10             	add    $0x10,%esp
+}
+    130f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1312:	89 f0                	mov    %esi,%eax
+    1314:	5b                   	pop    %ebx
+    1315:	5e                   	pop    %esi
+    1316:	5d                   	pop    %ebp
+    1317:	c3                   	ret
+    1318:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    131f:	90                   	nop
+  if(f->r == f->n && fill(f) == 0)
+    1320:	89 d8                	mov    %ebx,%eax
+    1322:	e8 c9 f8 ff ff       	call   bf0 <fill>
+    1327:	85 c0                	test   %eax,%eax
+    1329:	74 ca                	je     12f5 <fgetc+0x55>
+  return f->buf[f->r++] & 0xff;
+    132b:	8b 43 10             	mov    0x10(%ebx),%eax
+    132e:	eb 90                	jmp    12c0 <fgetc+0x20>
+    return EOF;
+    1330:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    1335:	eb 9f                	jmp    12d6 <fgetc+0x36>
+    1337:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    133e:	66 90                	xchg   %ax,%ax
+
+00001340 <fread>:
+
+int
+fread(void *p, int size, int nmemb, FILE *f)
+{
+    1340:	55                   	push   %ebp
+    1341:	89 e5                	mov    %esp,%ebp
+    1343:	57                   	push   %edi
+    1344:	56                   	push   %esi
+    1345:	53                   	push   %ebx
+    1346:	83 ec 1c             	sub    $0x1c,%esp
+    1349:	8b 75 14             	mov    0x14(%ebp),%esi
+  char *d;
+  int n, len;
+
+  if(!(f->flags & IO_READ) || size <= 0)
+    134c:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+    1350:	74 7e                	je     13d0 <fread+0x90>
+    1352:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1355:	85 d2                	test   %edx,%edx
+    1357:	7e 77                	jle    13d0 <fread+0x90>
+  if(threaded)
+    1359:	a1 c0 49 00 00       	mov    0x49c0,%eax
+    return 0;
+  flockfile(f);
+  d = p;
+  for(len = size*nmemb; len > 0; len -= n){
+    135e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1361:	0f af 7d 10          	imul   0x10(%ebp),%edi
+  if(threaded)
+    1365:	85 c0                	test   %eax,%eax
+    1367:	0f 85 93 00 00 00    	jne    1400 <fread+0xc0>
+  for(len = size*nmemb; len > 0; len -= n){
+    136d:	85 ff                	test   %edi,%edi
+    136f:	7e 61                	jle    13d2 <fread+0x92>
+    if(f->r == f->n && fill(f) == 0)
+    1371:	8b 46 10             	mov    0x10(%esi),%eax
+  d = p;
+    1374:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1377:	eb 35                	jmp    13ae <fread+0x6e>
+    1379:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      break;
+    n = f->n - f->r;
+    1380:	29 c3                	sub    %eax,%ebx
+    1382:	39 fb                	cmp    %edi,%ebx
+    1384:	0f 4f df             	cmovg  %edi,%ebx
+    if(n > len)
+      n = len;
+    memmove(d, f->buf + f->r, n);
+    1387:	83 ec 04             	sub    $0x4,%esp
+    138a:	53                   	push   %ebx
+    138b:	03 46 08             	add    0x8(%esi),%eax
+  for(len = size*nmemb; len > 0; len -= n){
+    138e:	29 df                	sub    %ebx,%edi
+    memmove(d, f->buf + f->r, n);
+    1390:	50                   	push   %eax
+    1391:	51                   	push   %ecx
+    1392:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1395:	e8 36 f0 ff ff       	call   3d0 <memmove>
+    f->r += n;
+    139a:	8b 46 10             	mov    0x10(%esi),%eax
+    d += n;
+    139d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    13a0:	83 c4 10             	add    $0x10,%esp
+    f->r += n;
+    13a3:	01 d8                	add    %ebx,%eax
+    d += n;
+    13a5:	01 d9                	add    %ebx,%ecx
+    f->r += n;
+    13a7:	89 46 10             	mov    %eax,0x10(%esi)
+  for(len = size*nmemb; len > 0; len -= n){
+    13aa:	85 ff                	test   %edi,%edi
+    13ac:	7e 32                	jle    13e0 <fread+0xa0>
+    if(f->r == f->n && fill(f) == 0)
+    13ae:	8b 5e 14             	mov    0x14(%esi),%ebx
+    13b1:	39 c3                	cmp    %eax,%ebx
+    13b3:	75 cb                	jne    1380 <fread+0x40>
+    13b5:	89 f0                	mov    %esi,%eax
+    13b7:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    13ba:	e8 31 f8 ff ff       	call   bf0 <fill>
+    13bf:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    13c2:	85 c0                	test   %eax,%eax
+    13c4:	74 1a                	je     13e0 <fread+0xa0>
+    n = f->n - f->r;
+    13c6:	8b 5e 14             	mov    0x14(%esi),%ebx
+    13c9:	8b 46 10             	mov    0x10(%esi),%eax
+    13cc:	eb b2                	jmp    1380 <fread+0x40>
+    13ce:	66 90                	xchg   %ax,%ax
+    return 0;
+    13d0:	31 c0                	xor    %eax,%eax
+  }
+  funlockfile(f);
+  return (d - (char*)p) / size;
+}
+    13d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13d5:	5b                   	pop    %ebx
+    13d6:	5e                   	pop    %esi
+    13d7:	5f                   	pop    %edi
+    13d8:	5d                   	pop    %ebp
+    13d9:	c3                   	ret
+    13da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (d - (char*)p) / size;
+    13e0:	2b 4d 08             	sub    0x8(%ebp),%ecx
+    13e3:	89 cb                	mov    %ecx,%ebx
+  if(threaded)
+    13e5:	a1 c0 49 00 00       	mov    0x49c0,%eax
+    13ea:	85 c0                	test   %eax,%eax
+    13ec:	75 32                	jne    1420 <fread+0xe0>
+  return (d - (char*)p) / size;
+    13ee:	89 d8                	mov    %ebx,%eax
+    13f0:	99                   	cltd
+    13f1:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    13f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13f7:	5b                   	pop    %ebx
+    13f8:	5e                   	pop    %esi
+    13f9:	5f                   	pop    %edi
+    13fa:	5d                   	pop    %ebp
+    13fb:	c3                   	ret
+    13fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    1400:	83 ec 0c             	sub    $0xc,%esp
+    1403:	8d 46 18             	lea    0x18(%esi),%eax
+    1406:	50                   	push   %eax
+    1407:	e8 04 f0 ff ff       	call   410 <mutex_lock>
+  for(len = size*nmemb; len > 0; len -= n){
+    140c:	83 c4 10             	add    $0x10,%esp
+    140f:	85 ff                	test   %edi,%edi
+    1411:	0f 8f 5a ff ff ff    	jg     1371 <fread+0x31>
+    1417:	31 db                	xor    %ebx,%ebx
+    1419:	eb ca                	jmp    13e5 <fread+0xa5>
+    141b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    141f:	90                   	nop
+    mutex_unlock(&f->lock);
+    1420:	83 ec 0c             	sub    $0xc,%esp
+    1423:	83 c6 18             	add    $0x18,%esi
+    1426:	56                   	push   %esi
+    1427:	e8 34 f0 ff ff       	call   460 <mutex_unlock>
+  return (d - (char*)p) / size;
+    142c:	89 d8                	mov    %ebx,%eax
+    142e:	83 c4 10             	add    $0x10,%esp
+    1431:	99                   	cltd
+    1432:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1435:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1438:	5b                   	pop    %ebx
+    1439:	5e                   	pop    %esi
+    143a:	5f                   	pop    %edi
+    143b:	5d                   	pop    %ebp
+    143c:	c3                   	ret
+    143d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001440 <fgets>:
+
+// Read a line of at most max-1 bytes, keeping the newline.
+// Returns 0 if there was nothing left to read.
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    1440:	55                   	push   %ebp
+    1441:	89 e5                	mov    %esp,%ebp
+    1443:	57                   	push   %edi
+    1444:	56                   	push   %esi
+    1445:	53                   	push   %ebx
+    1446:	83 ec 1c             	sub    $0x1c,%esp
+  if(threaded)
+    1449:	8b 35 c0 49 00 00    	mov    0x49c0,%esi
+{
+    144f:	8b 7d 08             	mov    0x8(%ebp),%edi
+    1452:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if(threaded)
+    1455:	85 f6                	test   %esi,%esi
+    1457:	0f 85 83 00 00 00    	jne    14e0 <fgets+0xa0>
+{
+    145d:	31 f6                	xor    %esi,%esi
+    145f:	eb 2a                	jmp    148b <fgets+0x4b>
+    1461:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return f->buf[f->r++] & 0xff;
+    1468:	8b 53 08             	mov    0x8(%ebx),%edx
+    146b:	8d 48 01             	lea    0x1(%eax),%ecx
+    146e:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1471:	0f b6 14 02          	movzbl (%edx,%eax,1),%edx
+
+  flockfile(f);
+  for(i = 0; i+1 < max; ){
+    if((c = getc_unlocked(f)) == EOF)
+      break;
+    buf[i++] = c;
+    1475:	88 54 37 ff          	mov    %dl,-0x1(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    1479:	80 fa 0a             	cmp    $0xa,%dl
+    147c:	0f 84 96 00 00 00    	je     1518 <fgets+0xd8>
+    1482:	83 fa 0d             	cmp    $0xd,%edx
+    1485:	0f 84 8d 00 00 00    	je     1518 <fgets+0xd8>
+  for(i = 0; i+1 < max; ){
+    148b:	89 f2                	mov    %esi,%edx
+    148d:	83 c6 01             	add    $0x1,%esi
+    1490:	3b 75 0c             	cmp    0xc(%ebp),%esi
+    1493:	7d 2b                	jge    14c0 <fgets+0x80>
+  if(!(f->flags & IO_READ))
+    1495:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1499:	74 25                	je     14c0 <fgets+0x80>
+  if(f->r == f->n && fill(f) == 0)
+    149b:	8b 43 10             	mov    0x10(%ebx),%eax
+    149e:	3b 43 14             	cmp    0x14(%ebx),%eax
+    14a1:	75 c5                	jne    1468 <fgets+0x28>
+    14a3:	89 d8                	mov    %ebx,%eax
+    14a5:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    14a8:	e8 43 f7 ff ff       	call   bf0 <fill>
+    14ad:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    14b0:	85 c0                	test   %eax,%eax
+    14b2:	74 0c                	je     14c0 <fgets+0x80>
+  return f->buf[f->r++] & 0xff;
+    14b4:	8b 43 10             	mov    0x10(%ebx),%eax
+    14b7:	eb af                	jmp    1468 <fgets+0x28>
+    14b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    14c0:	8b 0d c0 49 00 00    	mov    0x49c0,%ecx
+      break;
+  }
+  buf[i] = '\0';
+    14c6:	c6 04 17 00          	movb   $0x0,(%edi,%edx,1)
+  if(threaded)
+    14ca:	85 c9                	test   %ecx,%ecx
+    14cc:	75 2a                	jne    14f8 <fgets+0xb8>
+  funlockfile(f);
+  return i > 0 ? buf : 0;
+    14ce:	31 c0                	xor    %eax,%eax
+    14d0:	85 d2                	test   %edx,%edx
+    14d2:	74 02                	je     14d6 <fgets+0x96>
+    14d4:	89 f8                	mov    %edi,%eax
+}
+    14d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    14d9:	5b                   	pop    %ebx
+    14da:	5e                   	pop    %esi
+    14db:	5f                   	pop    %edi
+    14dc:	5d                   	pop    %ebp
+    14dd:	c3                   	ret
+    14de:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    14e0:	83 ec 0c             	sub    $0xc,%esp
+    14e3:	8d 43 18             	lea    0x18(%ebx),%eax
+    14e6:	50                   	push   %eax
+    14e7:	e8 24 ef ff ff       	call   410 <mutex_lock>
+    14ec:	83 c4 10             	add    $0x10,%esp
+    14ef:	e9 69 ff ff ff       	jmp    145d <fgets+0x1d>
+    14f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    14f8:	83 ec 0c             	sub    $0xc,%esp
+    14fb:	83 c3 18             	add    $0x18,%ebx
+    14fe:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1501:	53                   	push   %ebx
+    1502:	e8 59 ef ff ff       	call   460 <mutex_unlock>
+    1507:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    150a:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    150d:	31 c0                	xor    %eax,%eax
+    150f:	85 d2                	test   %edx,%edx
+    1511:	75 c1                	jne    14d4 <fgets+0x94>
+    1513:	eb c1                	jmp    14d6 <fgets+0x96>
+    1515:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1518:	a1 c0 49 00 00       	mov    0x49c0,%eax
+  buf[i] = '\0';
+    151d:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  if(threaded)
+    1521:	85 c0                	test   %eax,%eax
+    1523:	74 af                	je     14d4 <fgets+0x94>
+    mutex_unlock(&f->lock);
+    1525:	83 ec 0c             	sub    $0xc,%esp
+    1528:	83 c3 18             	add    $0x18,%ebx
+    152b:	53                   	push   %ebx
+    152c:	e8 2f ef ff ff       	call   460 <mutex_unlock>
+    1531:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    1534:	89 f8                	mov    %edi,%eax
+    1536:	eb 9e                	jmp    14d6 <fgets+0x96>
+    1538:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    153f:	90                   	nop
+
+00001540 <gets>:
+// at most a line per read(), goes through stdin's buffer: from a
+// file or pipe, a buffered read could take input meant for a child
+// process, so read a byte at a time.
+char*
+gets(char *buf, int max)
+{
+    1540:	55                   	push   %ebp
+    1541:	89 e5                	mov    %esp,%ebp
+    1543:	57                   	push   %edi
+    1544:	56                   	push   %esi
+    1545:	53                   	push   %ebx
+    1546:	83 ec 2c             	sub    $0x2c,%esp
+  int i, cc;
+  char c;
+
+  if(!(stdin->flags & IO_SETUP))
+    1549:	8b 15 c4 28 00 00    	mov    0x28c4,%edx
+{
+    154f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!(stdin->flags & IO_SETUP))
+    1552:	f6 c2 40             	test   $0x40,%dl
+    1555:	74 79                	je     15d0 <gets+0x90>
+    setup(stdin);
+  if(stdin->flags & IO_DEV){
+    1557:	83 e2 20             	and    $0x20,%edx
+    155a:	89 d7                	mov    %edx,%edi
+    155c:	75 52                	jne    15b0 <gets+0x70>
+  if(f == 0){
+    155e:	e8 ed f5 ff ff       	call   b50 <fflush.part.0>
+    fgets(buf, max, stdin);
+    return buf;
+  }
+  fflush(0);
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1563:	8d 75 e7             	lea    -0x19(%ebp),%esi
+  for(i=0; i+1 < max; ){
+    1566:	eb 2c                	jmp    1594 <gets+0x54>
+    1568:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    156f:	90                   	nop
+    cc = read(0, &c, 1);
+    1570:	83 ec 04             	sub    $0x4,%esp
+    1573:	6a 01                	push   $0x1
+    1575:	56                   	push   %esi
+    1576:	6a 00                	push   $0x0
+    1578:	e8 f5 ef ff ff       	call   572 <read>
+    if(cc < 1)
+    157d:	83 c4 10             	add    $0x10,%esp
+    1580:	85 c0                	test   %eax,%eax
+    1582:	7e 1b                	jle    159f <gets+0x5f>
+      break;
+    buf[i++] = c;
+    1584:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1588:	88 44 3b ff          	mov    %al,-0x1(%ebx,%edi,1)
+    if(c == '\n' || c == '\r')
+    158c:	3c 0a                	cmp    $0xa,%al
+    158e:	74 12                	je     15a2 <gets+0x62>
+    1590:	3c 0d                	cmp    $0xd,%al
+    1592:	74 0e                	je     15a2 <gets+0x62>
+  for(i=0; i+1 < max; ){
+    1594:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    1597:	83 c7 01             	add    $0x1,%edi
+    159a:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+    159d:	7c d1                	jl     1570 <gets+0x30>
+{
+    159f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      break;
+  }
+  buf[i] = '\0';
+    15a2:	c6 04 3b 00          	movb   $0x0,(%ebx,%edi,1)
+  return buf;
+}
+    15a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15a9:	89 d8                	mov    %ebx,%eax
+    15ab:	5b                   	pop    %ebx
+    15ac:	5e                   	pop    %esi
+    15ad:	5f                   	pop    %edi
+    15ae:	5d                   	pop    %ebp
+    15af:	c3                   	ret
+    fgets(buf, max, stdin);
+    15b0:	83 ec 04             	sub    $0x4,%esp
+    15b3:	68 c0 28 00 00       	push   $0x28c0
+    15b8:	ff 75 0c             	push   0xc(%ebp)
+    15bb:	53                   	push   %ebx
+    15bc:	e8 7f fe ff ff       	call   1440 <fgets>
+    return buf;
+    15c1:	83 c4 10             	add    $0x10,%esp
+}
+    15c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15c7:	89 d8                	mov    %ebx,%eax
+    15c9:	5b                   	pop    %ebx
+    15ca:	5e                   	pop    %esi
+    15cb:	5f                   	pop    %edi
+    15cc:	5d                   	pop    %ebp
+    15cd:	c3                   	ret
+    15ce:	66 90                	xchg   %ax,%ax
+    setup(stdin);
+    15d0:	b8 c0 28 00 00       	mov    $0x28c0,%eax
+    15d5:	e8 a6 f4 ff ff       	call   a80 <setup>
+  if(stdin->flags & IO_DEV){
+    15da:	8b 15 c4 28 00 00    	mov    0x28c4,%edx
+    15e0:	e9 72 ff ff ff       	jmp    1557 <gets+0x17>
+    15e5:	66 90                	xchg   %ax,%ax
+    15e7:	66 90                	xchg   %ax,%ax
+    15e9:	66 90                	xchg   %ax,%ax
+    15eb:	66 90                	xchg   %ax,%ax
+    15ed:	66 90                	xchg   %ax,%ax
+    15ef:	90                   	nop
+
+000015f0 <bigfree>:
+
+// Give a big block back to the first-fit list, and return the
+// free block that now holds it. Caller holds lock.
+static Header*
+bigfree(Header *bp)
+{
+    15f0:	55                   	push   %ebp
+    15f1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    15f3:	a1 64 50 00 00       	mov    0x5064,%eax
+{
+    15f8:	89 e5                	mov    %esp,%ebp
+    15fa:	56                   	push   %esi
+    15fb:	53                   	push   %ebx
+    15fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1600:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1602:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1604:	39 ca                	cmp    %ecx,%edx
+    1606:	73 38                	jae    1640 <bigfree+0x50>
+    1608:	39 c1                	cmp    %eax,%ecx
+    160a:	72 04                	jb     1610 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    160c:	39 c2                	cmp    %eax,%edx
+    160e:	72 f0                	jb     1600 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1610:	8b 59 04             	mov    0x4(%ecx),%ebx
+    1613:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    1616:	39 f0                	cmp    %esi,%eax
+    1618:	74 36                	je     1650 <bigfree+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    161a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  freep = p;
+  if(p + p->s.size == bp){
+    161c:	8b 42 04             	mov    0x4(%edx),%eax
+    161f:	89 cb                	mov    %ecx,%ebx
+  freep = p;
+    1621:	89 15 64 50 00 00    	mov    %edx,0x5064
+  if(p + p->s.size == bp){
+    1627:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    162a:	39 f1                	cmp    %esi,%ecx
+    162c:	74 2e                	je     165c <bigfree+0x6c>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    162e:	89 1a                	mov    %ebx,(%edx)
+    return p;
+  }
+  p->s.ptr = bp;
+  return bp;
+}
+    1630:	89 c8                	mov    %ecx,%eax
+    1632:	5b                   	pop    %ebx
+    1633:	5e                   	pop    %esi
+    1634:	5d                   	pop    %ebp
+    1635:	c3                   	ret
+    1636:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    163d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1640:	39 c1                	cmp    %eax,%ecx
+    1642:	72 c8                	jb     160c <bigfree+0x1c>
+    1644:	eb ba                	jmp    1600 <bigfree+0x10>
+    1646:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    164d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1650:	03 58 04             	add    0x4(%eax),%ebx
+    1653:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1656:	8b 02                	mov    (%edx),%eax
+    1658:	8b 00                	mov    (%eax),%eax
+    165a:	eb be                	jmp    161a <bigfree+0x2a>
+    p->s.size += bp->s.size;
+    165c:	03 41 04             	add    0x4(%ecx),%eax
+    165f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1662:	8b 19                	mov    (%ecx),%ebx
+    return p;
+    1664:	89 d1                	mov    %edx,%ecx
+}
+    1666:	89 c8                	mov    %ecx,%eax
+    p->s.ptr = bp->s.ptr;
+    1668:	89 1a                	mov    %ebx,(%edx)
+}
+    166a:	5b                   	pop    %ebx
+    166b:	5e                   	pop    %esi
+    166c:	5d                   	pop    %ebp
+    166d:	c3                   	ret
+    166e:	66 90                	xchg   %ax,%ax
+
+00001670 <trim>:
+// If free block bp ends the heap, return its whole pages to the
+// kernel, unless something else has moved the break since.
+// Caller holds lock.
+static void
+trim(Header *bp)
+{
+    1670:	55                   	push   %ebp
+    1671:	89 e5                	mov    %esp,%ebp
+    1673:	57                   	push   %edi
+    1674:	56                   	push   %esi
+    1675:	53                   	push   %ebx
+    1676:	89 c3                	mov    %eax,%ebx
+    1678:	83 ec 0c             	sub    $0xc,%esp
+  char *end;
+  uint n;
+
+  if((char*)(bp + bp->s.size) != heapend)
+    167b:	8b 53 04             	mov    0x4(%ebx),%edx
+    167e:	a1 60 50 00 00       	mov    0x5060,%eax
+    1683:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+    1686:	39 d0                	cmp    %edx,%eax
+    1688:	74 0e                	je     1698 <trim+0x28>
+  n = heapend - end;
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    bp->s.size -= n / sizeof(Header);
+    heapend = end;
+  }
+}
+    168a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    168d:	5b                   	pop    %ebx
+    168e:	5e                   	pop    %esi
+    168f:	5f                   	pop    %edi
+    1690:	5d                   	pop    %ebp
+    1691:	c3                   	ret
+    1692:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  end = (char*)PGROUNDUP((uint)(bp + 2));
+    1698:	8d bb 0f 10 00 00    	lea    0x100f(%ebx),%edi
+    169e:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  n = heapend - end;
+    16a4:	29 f8                	sub    %edi,%eax
+    16a6:	89 c6                	mov    %eax,%esi
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    16a8:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    16ad:	76 db                	jbe    168a <trim+0x1a>
+    16af:	83 ec 0c             	sub    $0xc,%esp
+    16b2:	6a 00                	push   $0x0
+    16b4:	e8 8b ef ff ff       	call   644 <sbrk>
+    16b9:	83 c4 10             	add    $0x10,%esp
+    16bc:	39 05 60 50 00 00    	cmp    %eax,0x5060
+    16c2:	75 c6                	jne    168a <trim+0x1a>
+    16c4:	89 f0                	mov    %esi,%eax
+    16c6:	83 ec 0c             	sub    $0xc,%esp
+    16c9:	f7 d8                	neg    %eax
+    16cb:	50                   	push   %eax
+    16cc:	e8 73 ef ff ff       	call   644 <sbrk>
+    16d1:	83 c4 10             	add    $0x10,%esp
+    16d4:	83 f8 ff             	cmp    $0xffffffff,%eax
+    16d7:	74 b1                	je     168a <trim+0x1a>
+    bp->s.size -= n / sizeof(Header);
+    16d9:	89 f0                	mov    %esi,%eax
+    heapend = end;
+    16db:	89 3d 60 50 00 00    	mov    %edi,0x5060
+    bp->s.size -= n / sizeof(Header);
+    16e1:	c1 e8 03             	shr    $0x3,%eax
+    16e4:	29 43 04             	sub    %eax,0x4(%ebx)
+    heapend = end;
+    16e7:	eb a1                	jmp    168a <trim+0x1a>
+    16e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000016f0 <bigalloc>:
+}
+
+// Allocate a big block of nunits units. Caller holds lock.
+static Header*
+bigalloc(uint nunits)
+{
+    16f0:	55                   	push   %ebp
+    16f1:	89 e5                	mov    %esp,%ebp
+    16f3:	57                   	push   %edi
+    16f4:	89 c7                	mov    %eax,%edi
+    16f6:	56                   	push   %esi
+    16f7:	53                   	push   %ebx
+    16f8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    16fb:	a1 64 50 00 00       	mov    0x5064,%eax
+    1700:	85 c0                	test   %eax,%eax
+    1702:	0f 84 98 00 00 00    	je     17a0 <bigalloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1708:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    170a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    170d:	39 f9                	cmp    %edi,%ecx
+    170f:	73 67                	jae    1778 <bigalloc+0x88>
+  if(nu < 4096)
+    1711:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1716:	39 df                	cmp    %ebx,%edi
+    1718:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    171b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    1722:	eb 0d                	jmp    1731 <bigalloc+0x41>
+    1724:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1728:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    172a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    172d:	39 f9                	cmp    %edi,%ecx
+    172f:	73 47                	jae    1778 <bigalloc+0x88>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    1731:	89 d0                	mov    %edx,%eax
+    1733:	39 15 64 50 00 00    	cmp    %edx,0x5064
+    1739:	75 ed                	jne    1728 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    173b:	83 ec 0c             	sub    $0xc,%esp
+    173e:	56                   	push   %esi
+    173f:	e8 00 ef ff ff       	call   644 <sbrk>
+  if(p == (char*)-1)
+    1744:	83 c4 10             	add    $0x10,%esp
+    1747:	83 f8 ff             	cmp    $0xffffffff,%eax
+    174a:	74 1a                	je     1766 <bigalloc+0x76>
+  hp->s.size = nu;
+    174c:	89 58 04             	mov    %ebx,0x4(%eax)
+  heapend = p + nu * sizeof(Header);
+    174f:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    1752:	89 15 60 50 00 00    	mov    %edx,0x5060
+  bigfree(hp);
+    1758:	e8 93 fe ff ff       	call   15f0 <bigfree>
+  return freep;
+    175d:	a1 64 50 00 00       	mov    0x5064,%eax
+      if((p = morecore(nunits)) == 0)
+    1762:	85 c0                	test   %eax,%eax
+    1764:	75 c2                	jne    1728 <bigalloc+0x38>
+        return 0;
+  }
+}
+    1766:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1769:	31 d2                	xor    %edx,%edx
+}
+    176b:	5b                   	pop    %ebx
+    176c:	89 d0                	mov    %edx,%eax
+    176e:	5e                   	pop    %esi
+    176f:	5f                   	pop    %edi
+    1770:	5d                   	pop    %ebp
+    1771:	c3                   	ret
+    1772:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1778:	39 cf                	cmp    %ecx,%edi
+    177a:	74 54                	je     17d0 <bigalloc+0xe0>
+        p->s.size -= nunits;
+    177c:	29 f9                	sub    %edi,%ecx
+    177e:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    1781:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    1784:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    1787:	a3 64 50 00 00       	mov    %eax,0x5064
+}
+    178c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    178f:	89 d0                	mov    %edx,%eax
+    1791:	5b                   	pop    %ebx
+    1792:	5e                   	pop    %esi
+    1793:	5f                   	pop    %edi
+    1794:	5d                   	pop    %ebp
+    1795:	c3                   	ret
+    1796:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    179d:	8d 76 00             	lea    0x0(%esi),%esi
+    base.s.ptr = freep = prevp = &base;
+    17a0:	c7 05 64 50 00 00 68 	movl   $0x5068,0x5064
+    17a7:	50 00 00 
+    base.s.size = 0;
+    17aa:	ba 68 50 00 00       	mov    $0x5068,%edx
+    base.s.ptr = freep = prevp = &base;
+    17af:	c7 05 68 50 00 00 68 	movl   $0x5068,0x5068
+    17b6:	50 00 00 
+    base.s.size = 0;
+    17b9:	c7 05 6c 50 00 00 00 	movl   $0x0,0x506c
+    17c0:	00 00 00 
+    if(p->s.size >= nunits){
+    17c3:	e9 49 ff ff ff       	jmp    1711 <bigalloc+0x21>
+    17c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17cf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    17d0:	8b 0a                	mov    (%edx),%ecx
+    17d2:	89 08                	mov    %ecx,(%eax)
+    17d4:	eb b1                	jmp    1787 <bigalloc+0x97>
+    17d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000017e0 <drain>:
+}
+
+// Move n blocks of class c from cache tc to the shared list.
+static void
+drain(struct tcache *tc, int c, int n)
+{
+    17e0:	55                   	push   %ebp
+    17e1:	89 e5                	mov    %esp,%ebp
+    17e3:	57                   	push   %edi
+    17e4:	89 c7                	mov    %eax,%edi
+    17e6:	56                   	push   %esi
+    17e7:	89 d6                	mov    %edx,%esi
+    17e9:	53                   	push   %ebx
+    17ea:	89 cb                	mov    %ecx,%ebx
+    17ec:	83 ec 0c             	sub    $0xc,%esp
+  if(threaded)
+    17ef:	8b 15 e4 4f 00 00    	mov    0x4fe4,%edx
+    17f5:	85 d2                	test   %edx,%edx
+    17f7:	75 57                	jne    1850 <drain+0x70>
+  Header *p;
+
+  acquire();
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    17f9:	85 c9                	test   %ecx,%ecx
+    17fb:	7e 49                	jle    1846 <drain+0x66>
+    17fd:	89 d9                	mov    %ebx,%ecx
+    17ff:	8d 14 b7             	lea    (%edi,%esi,4),%edx
+    1802:	eb 23                	jmp    1827 <drain+0x47>
+    1804:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    tc->list[c] = p->s.ptr;
+    1808:	8b 18                	mov    (%eax),%ebx
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    180a:	83 e9 01             	sub    $0x1,%ecx
+    tc->n[c]--;
+    180d:	83 6a 20 01          	subl   $0x1,0x20(%edx)
+    tc->list[c] = p->s.ptr;
+    1811:	89 1a                	mov    %ebx,(%edx)
+    p->s.ptr = small[c];
+    1813:	8b 1c b5 40 50 00 00 	mov    0x5040(,%esi,4),%ebx
+    181a:	89 18                	mov    %ebx,(%eax)
+    small[c] = p;
+    181c:	89 04 b5 40 50 00 00 	mov    %eax,0x5040(,%esi,4)
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1823:	85 c9                	test   %ecx,%ecx
+    1825:	7e 06                	jle    182d <drain+0x4d>
+    1827:	8b 02                	mov    (%edx),%eax
+    1829:	85 c0                	test   %eax,%eax
+    182b:	75 db                	jne    1808 <drain+0x28>
+  if(threaded)
+    182d:	a1 e4 4f 00 00       	mov    0x4fe4,%eax
+    1832:	85 c0                	test   %eax,%eax
+    1834:	74 10                	je     1846 <drain+0x66>
+    mutex_unlock(&lock);
+    1836:	83 ec 0c             	sub    $0xc,%esp
+    1839:	68 e8 4f 00 00       	push   $0x4fe8
+    183e:	e8 1d ec ff ff       	call   460 <mutex_unlock>
+}
+    1843:	83 c4 10             	add    $0x10,%esp
+  }
+  release();
+}
+    1846:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1849:	5b                   	pop    %ebx
+    184a:	5e                   	pop    %esi
+    184b:	5f                   	pop    %edi
+    184c:	5d                   	pop    %ebp
+    184d:	c3                   	ret
+    184e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&lock);
+    1850:	83 ec 0c             	sub    $0xc,%esp
+    1853:	68 e8 4f 00 00       	push   $0x4fe8
+    1858:	e8 b3 eb ff ff       	call   410 <mutex_lock>
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    185d:	83 c4 10             	add    $0x10,%esp
+    1860:	85 db                	test   %ebx,%ebx
+    1862:	7f 99                	jg     17fd <drain+0x1d>
+    1864:	eb c7                	jmp    182d <drain+0x4d>
+    1866:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    186d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001870 <mycache>:
+{
+    1870:	55                   	push   %ebp
+    return &maincache;
+    1871:	b8 00 50 00 00       	mov    $0x5000,%eax
+{
+    1876:	89 e5                	mov    %esp,%ebp
+    1878:	53                   	push   %ebx
+  sp = PGROUNDDOWN((uint)&sp);
+    1879:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+    187c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+    1882:	83 ec 14             	sub    $0x14,%esp
+  if(!threaded || sp == mainstack)
+    1885:	8b 0d e4 4f 00 00    	mov    0x4fe4,%ecx
+  sp = PGROUNDDOWN((uint)&sp);
+    188b:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  if(!threaded || sp == mainstack)
+    188e:	85 c9                	test   %ecx,%ecx
+    1890:	74 0f                	je     18a1 <mycache+0x31>
+    1892:	3b 1d e0 4f 00 00    	cmp    0x4fe0,%ebx
+    1898:	74 07                	je     18a1 <mycache+0x31>
+  if(*cp == 0){
+    189a:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    189d:	85 c0                	test   %eax,%eax
+    189f:	74 0f                	je     18b0 <mycache+0x40>
+}
+    18a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    18a4:	c9                   	leave
+    18a5:	c3                   	ret
+    18a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18ad:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    18b0:	83 ec 0c             	sub    $0xc,%esp
+    18b3:	68 e8 4f 00 00       	push   $0x4fe8
+    18b8:	e8 53 eb ff ff       	call   410 <mutex_lock>
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    18bd:	b8 09 00 00 00       	mov    $0x9,%eax
+    18c2:	e8 29 fe ff ff       	call   16f0 <bigalloc>
+  if(threaded)
+    18c7:	8b 15 e4 4f 00 00    	mov    0x4fe4,%edx
+    18cd:	83 c4 10             	add    $0x10,%esp
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    18d0:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(threaded)
+    18d3:	85 d2                	test   %edx,%edx
+    18d5:	75 29                	jne    1900 <mycache+0x90>
+    if(*cp == 0)
+    18d7:	85 c0                	test   %eax,%eax
+    18d9:	74 c6                	je     18a1 <mycache+0x31>
+    memset(*cp, 0, sizeof(**cp));
+    18db:	83 ec 04             	sub    $0x4,%esp
+    *cp = (struct tcache*)((Header*)*cp + 1);
+    18de:	83 c0 08             	add    $0x8,%eax
+    18e1:	89 43 f8             	mov    %eax,-0x8(%ebx)
+    memset(*cp, 0, sizeof(**cp));
+    18e4:	6a 40                	push   $0x40
+    18e6:	6a 00                	push   $0x0
+    18e8:	50                   	push   %eax
+    18e9:	e8 f2 e9 ff ff       	call   2e0 <memset>
+  return *cp;
+    18ee:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    18f1:	83 c4 10             	add    $0x10,%esp
+    18f4:	eb ab                	jmp    18a1 <mycache+0x31>
+    18f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18fd:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1900:	83 ec 0c             	sub    $0xc,%esp
+    1903:	68 e8 4f 00 00       	push   $0x4fe8
+    1908:	e8 53 eb ff ff       	call   460 <mutex_unlock>
+    if(*cp == 0)
+    190d:	8b 43 f8             	mov    -0x8(%ebx),%eax
+}
+    1910:	83 c4 10             	add    $0x10,%esp
+    1913:	eb c2                	jmp    18d7 <mycache+0x67>
+    1915:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    191c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001920 <free>:
+
+void
+free(void *ap)
+{
+    1920:	55                   	push   %ebp
+    1921:	89 e5                	mov    %esp,%ebp
+    1923:	57                   	push   %edi
+    1924:	56                   	push   %esi
+    1925:	53                   	push   %ebx
+    1926:	83 ec 1c             	sub    $0x1c,%esp
+    1929:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  struct tcache *tc;
+  int c;
+
+  if(ap == 0)
+    192c:	85 f6                	test   %esi,%esi
+    192e:	74 51                	je     1981 <free+0x61>
+    return;
+  bp = (Header*)ap - 1;
+    1930:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1933:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(bp->s.size > SMALLMAX / sizeof(Header)){
+    1936:	8b 46 fc             	mov    -0x4(%esi),%eax
+    1939:	3d 00 01 00 00       	cmp    $0x100,%eax
+    193e:	77 50                	ja     1990 <free+0x70>
+    acquire();
+    trim(bigfree(bp));
+    release();
+    return;
+  }
+  for(c = 0; (2 << c) < bp->s.size; c++)
+    1940:	31 db                	xor    %ebx,%ebx
+    1942:	ba 02 00 00 00       	mov    $0x2,%edx
+    1947:	83 f8 02             	cmp    $0x2,%eax
+    194a:	76 11                	jbe    195d <free+0x3d>
+    194c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1950:	83 c3 01             	add    $0x1,%ebx
+    1953:	89 d7                	mov    %edx,%edi
+    1955:	89 d9                	mov    %ebx,%ecx
+    1957:	d3 e7                	shl    %cl,%edi
+    1959:	39 c7                	cmp    %eax,%edi
+    195b:	72 f3                	jb     1950 <free+0x30>
+    ;
+  if((tc = mycache()) == 0){
+    195d:	e8 0e ff ff ff       	call   1870 <mycache>
+    1962:	85 c0                	test   %eax,%eax
+    1964:	74 7a                	je     19e0 <free+0xc0>
+    bp->s.ptr = small[c];
+    small[c] = bp;
+    release();
+    return;
+  }
+  bp->s.ptr = tc->list[c];
+    1966:	8d 0c 98             	lea    (%eax,%ebx,4),%ecx
+    1969:	8b 11                	mov    (%ecx),%edx
+    196b:	89 56 f8             	mov    %edx,-0x8(%esi)
+  tc->list[c] = bp;
+    196e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1971:	89 31                	mov    %esi,(%ecx)
+  if(++tc->n[c] > TCACHEMAX)
+    1973:	8b 71 20             	mov    0x20(%ecx),%esi
+    1976:	8d 56 01             	lea    0x1(%esi),%edx
+    1979:	89 51 20             	mov    %edx,0x20(%ecx)
+    197c:	83 fa 20             	cmp    $0x20,%edx
+    197f:	7f 47                	jg     19c8 <free+0xa8>
+    drain(tc, c, BATCH);
+}
+    1981:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1984:	5b                   	pop    %ebx
+    1985:	5e                   	pop    %esi
+    1986:	5f                   	pop    %edi
+    1987:	5d                   	pop    %ebp
+    1988:	c3                   	ret
+    1989:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1990:	8b 1d e4 4f 00 00    	mov    0x4fe4,%ebx
+    1996:	85 db                	test   %ebx,%ebx
+    1998:	75 66                	jne    1a00 <free+0xe0>
+    trim(bigfree(bp));
+    199a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    199d:	e8 4e fc ff ff       	call   15f0 <bigfree>
+    19a2:	e8 c9 fc ff ff       	call   1670 <trim>
+  if(threaded)
+    19a7:	8b 0d e4 4f 00 00    	mov    0x4fe4,%ecx
+    19ad:	85 c9                	test   %ecx,%ecx
+    19af:	74 d0                	je     1981 <free+0x61>
+    mutex_unlock(&lock);
+    19b1:	c7 45 08 e8 4f 00 00 	movl   $0x4fe8,0x8(%ebp)
+}
+    19b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19bb:	5b                   	pop    %ebx
+    19bc:	5e                   	pop    %esi
+    19bd:	5f                   	pop    %edi
+    19be:	5d                   	pop    %ebp
+    mutex_unlock(&lock);
+    19bf:	e9 9c ea ff ff       	jmp    460 <mutex_unlock>
+    19c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    19c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    drain(tc, c, BATCH);
+    19cb:	89 da                	mov    %ebx,%edx
+    19cd:	b9 10 00 00 00       	mov    $0x10,%ecx
+}
+    19d2:	5b                   	pop    %ebx
+    19d3:	5e                   	pop    %esi
+    19d4:	5f                   	pop    %edi
+    19d5:	5d                   	pop    %ebp
+    drain(tc, c, BATCH);
+    19d6:	e9 05 fe ff ff       	jmp    17e0 <drain>
+    19db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    19df:	90                   	nop
+  if(threaded)
+    19e0:	8b 15 e4 4f 00 00    	mov    0x4fe4,%edx
+    19e6:	85 d2                	test   %edx,%edx
+    19e8:	75 28                	jne    1a12 <free+0xf2>
+    bp->s.ptr = small[c];
+    19ea:	8b 04 9d 40 50 00 00 	mov    0x5040(,%ebx,4),%eax
+    19f1:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    19f4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    19f7:	89 04 9d 40 50 00 00 	mov    %eax,0x5040(,%ebx,4)
+  if(threaded)
+    19fe:	eb 81                	jmp    1981 <free+0x61>
+    mutex_lock(&lock);
+    1a00:	83 ec 0c             	sub    $0xc,%esp
+    1a03:	68 e8 4f 00 00       	push   $0x4fe8
+    1a08:	e8 03 ea ff ff       	call   410 <mutex_lock>
+}
+    1a0d:	83 c4 10             	add    $0x10,%esp
+    1a10:	eb 88                	jmp    199a <free+0x7a>
+    mutex_lock(&lock);
+    1a12:	83 ec 0c             	sub    $0xc,%esp
+    1a15:	68 e8 4f 00 00       	push   $0x4fe8
+    1a1a:	e8 f1 e9 ff ff       	call   410 <mutex_lock>
+    bp->s.ptr = small[c];
+    1a1f:	8b 04 9d 40 50 00 00 	mov    0x5040(,%ebx,4),%eax
+  if(threaded)
+    1a26:	83 c4 10             	add    $0x10,%esp
+    bp->s.ptr = small[c];
+    1a29:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1a2c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1a2f:	89 04 9d 40 50 00 00 	mov    %eax,0x5040(,%ebx,4)
+  if(threaded)
+    1a36:	a1 e4 4f 00 00       	mov    0x4fe4,%eax
+    1a3b:	85 c0                	test   %eax,%eax
+    1a3d:	0f 85 6e ff ff ff    	jne    19b1 <free+0x91>
+    1a43:	e9 39 ff ff ff       	jmp    1981 <free+0x61>
+    1a48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a4f:	90                   	nop
+
+00001a50 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1a50:	55                   	push   %ebp
+    1a51:	89 e5                	mov    %esp,%ebp
+    1a53:	57                   	push   %edi
+    1a54:	56                   	push   %esi
+    1a55:	53                   	push   %ebx
+    1a56:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  struct tcache *tc;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1a59:	8b 45 08             	mov    0x8(%ebp),%eax
+    1a5c:	8d 78 07             	lea    0x7(%eax),%edi
+    1a5f:	c1 ef 03             	shr    $0x3,%edi
+    1a62:	83 c7 01             	add    $0x1,%edi
+  if(nunits > SMALLMAX / sizeof(Header)){
+    1a65:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+    1a6b:	77 5b                	ja     1ac8 <malloc+0x78>
+    acquire();
+    p = bigalloc(nunits);
+    release();
+    return p ? (void*)(p + 1) : 0;
+  }
+  for(c = 0; (2 << c) < nunits; c++)
+    1a6d:	31 c9                	xor    %ecx,%ecx
+    1a6f:	b8 02 00 00 00       	mov    $0x2,%eax
+    1a74:	be 02 00 00 00       	mov    $0x2,%esi
+    1a79:	bb 02 00 00 00       	mov    $0x2,%ebx
+    1a7e:	83 ff 02             	cmp    $0x2,%edi
+    1a81:	76 12                	jbe    1a95 <malloc+0x45>
+    1a83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1a87:	90                   	nop
+    1a88:	83 c1 01             	add    $0x1,%ecx
+    1a8b:	89 c3                	mov    %eax,%ebx
+    1a8d:	d3 e3                	shl    %cl,%ebx
+    1a8f:	89 de                	mov    %ebx,%esi
+    1a91:	39 fb                	cmp    %edi,%ebx
+    1a93:	72 f3                	jb     1a88 <malloc+0x38>
+    1a95:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    ;
+  if((tc = mycache()) == 0)
+    1a98:	e8 d3 fd ff ff       	call   1870 <mycache>
+    1a9d:	85 c0                	test   %eax,%eax
+    1a9f:	74 51                	je     1af2 <malloc+0xa2>
+    return 0;
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1aa1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1aa4:	8d 3c 88             	lea    (%eax,%ecx,4),%edi
+    1aa7:	8b 07                	mov    (%edi),%eax
+    1aa9:	85 c0                	test   %eax,%eax
+    1aab:	74 53                	je     1b00 <malloc+0xb0>
+    return 0;
+  p = tc->list[c];
+  tc->list[c] = p->s.ptr;
+  tc->n[c]--;
+    1aad:	8b 57 20             	mov    0x20(%edi),%edx
+  tc->list[c] = p->s.ptr;
+    1ab0:	8b 08                	mov    (%eax),%ecx
+  tc->n[c]--;
+    1ab2:	83 ea 01             	sub    $0x1,%edx
+  return (void*)(p + 1);
+    1ab5:	83 c0 08             	add    $0x8,%eax
+  tc->n[c]--;
+    1ab8:	89 57 20             	mov    %edx,0x20(%edi)
+  tc->list[c] = p->s.ptr;
+    1abb:	89 0f                	mov    %ecx,(%edi)
+}
+    1abd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ac0:	5b                   	pop    %ebx
+    1ac1:	5e                   	pop    %esi
+    1ac2:	5f                   	pop    %edi
+    1ac3:	5d                   	pop    %ebp
+    1ac4:	c3                   	ret
+    1ac5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1ac8:	a1 e4 4f 00 00       	mov    0x4fe4,%eax
+    1acd:	85 c0                	test   %eax,%eax
+    1acf:	0f 85 b3 00 00 00    	jne    1b88 <malloc+0x138>
+    p = bigalloc(nunits);
+    1ad5:	89 f8                	mov    %edi,%eax
+    1ad7:	e8 14 fc ff ff       	call   16f0 <bigalloc>
+    1adc:	89 c3                	mov    %eax,%ebx
+  if(threaded)
+    1ade:	a1 e4 4f 00 00       	mov    0x4fe4,%eax
+    1ae3:	85 c0                	test   %eax,%eax
+    1ae5:	0f 85 85 00 00 00    	jne    1b70 <malloc+0x120>
+    return p ? (void*)(p + 1) : 0;
+    1aeb:	8d 43 08             	lea    0x8(%ebx),%eax
+    1aee:	85 db                	test   %ebx,%ebx
+    1af0:	75 cb                	jne    1abd <malloc+0x6d>
+    1af2:	31 c0                	xor    %eax,%eax
+}
+    1af4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1af7:	5b                   	pop    %ebx
+    1af8:	5e                   	pop    %esi
+    1af9:	5f                   	pop    %edi
+    1afa:	5d                   	pop    %ebp
+    1afb:	c3                   	ret
+    1afc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1b00:	a1 e4 4f 00 00       	mov    0x4fe4,%eax
+    1b05:	85 c0                	test   %eax,%eax
+    1b07:	0f 85 29 01 00 00    	jne    1c36 <malloc+0x1e6>
+  if(small[c] == 0){
+    1b0d:	8b 04 8d 40 50 00 00 	mov    0x5040(,%ecx,4),%eax
+    1b14:	85 c0                	test   %eax,%eax
+    1b16:	0f 84 81 00 00 00    	je     1b9d <malloc+0x14d>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1b1c:	31 db                	xor    %ebx,%ebx
+    1b1e:	eb 22                	jmp    1b42 <malloc+0xf2>
+    small[c] = p->s.ptr;
+    1b20:	8b 10                	mov    (%eax),%edx
+  for(moved = 0; moved < n && small[c]; moved++){
+    1b22:	83 c3 01             	add    $0x1,%ebx
+    small[c] = p->s.ptr;
+    1b25:	89 14 8d 40 50 00 00 	mov    %edx,0x5040(,%ecx,4)
+    p->s.ptr = tc->list[c];
+    1b2c:	8b 17                	mov    (%edi),%edx
+    1b2e:	89 10                	mov    %edx,(%eax)
+    tc->list[c] = p;
+    1b30:	89 07                	mov    %eax,(%edi)
+  for(moved = 0; moved < n && small[c]; moved++){
+    1b32:	83 fb 10             	cmp    $0x10,%ebx
+    1b35:	0f 84 e2 00 00 00    	je     1c1d <malloc+0x1cd>
+    1b3b:	8b 04 8d 40 50 00 00 	mov    0x5040(,%ecx,4),%eax
+    1b42:	85 c0                	test   %eax,%eax
+    1b44:	75 da                	jne    1b20 <malloc+0xd0>
+  if(threaded)
+    1b46:	8b 15 e4 4f 00 00    	mov    0x4fe4,%edx
+    1b4c:	85 d2                	test   %edx,%edx
+    1b4e:	0f 85 b4 00 00 00    	jne    1c08 <malloc+0x1b8>
+  tc->n[c] += moved;
+    1b54:	8b 57 20             	mov    0x20(%edi),%edx
+    1b57:	01 da                	add    %ebx,%edx
+    1b59:	89 57 20             	mov    %edx,0x20(%edi)
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1b5c:	85 db                	test   %ebx,%ebx
+    1b5e:	74 92                	je     1af2 <malloc+0xa2>
+  p = tc->list[c];
+    1b60:	8b 07                	mov    (%edi),%eax
+    1b62:	e9 49 ff ff ff       	jmp    1ab0 <malloc+0x60>
+    1b67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b6e:	66 90                	xchg   %ax,%ax
+    mutex_unlock(&lock);
+    1b70:	83 ec 0c             	sub    $0xc,%esp
+    1b73:	68 e8 4f 00 00       	push   $0x4fe8
+    1b78:	e8 e3 e8 ff ff       	call   460 <mutex_unlock>
+}
+    1b7d:	83 c4 10             	add    $0x10,%esp
+    1b80:	e9 66 ff ff ff       	jmp    1aeb <malloc+0x9b>
+    1b85:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1b88:	83 ec 0c             	sub    $0xc,%esp
+    1b8b:	68 e8 4f 00 00       	push   $0x4fe8
+    1b90:	e8 7b e8 ff ff       	call   410 <mutex_lock>
+}
+    1b95:	83 c4 10             	add    $0x10,%esp
+    1b98:	e9 38 ff ff ff       	jmp    1ad5 <malloc+0x85>
+    if((chunk = bigalloc(CHUNK / sizeof(Header) + 1)) == 0){
+    1b9d:	b8 01 02 00 00       	mov    $0x201,%eax
+    1ba2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1ba5:	e8 46 fb ff ff       	call   16f0 <bigalloc>
+    1baa:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1bad:	85 c0                	test   %eax,%eax
+    1baf:	89 c2                	mov    %eax,%edx
+    1bb1:	0f 84 ba 00 00 00    	je     1c71 <malloc+0x221>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1bb7:	83 c2 08             	add    $0x8,%edx
+    1bba:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+    1bc0:	0f 87 d0 00 00 00    	ja     1c96 <malloc+0x246>
+    1bc6:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+    1bcd:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    1bd0:	89 df                	mov    %ebx,%edi
+    1bd2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1bd5:	8d 76 00             	lea    0x0(%esi),%esi
+      p->s.size = units;
+    1bd8:	89 72 04             	mov    %esi,0x4(%edx)
+      p->s.ptr = small[c];
+    1bdb:	8b 04 8d 40 50 00 00 	mov    0x5040(,%ecx,4),%eax
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1be2:	01 df                	add    %ebx,%edi
+    1be4:	89 55 e0             	mov    %edx,-0x20(%ebp)
+      p->s.ptr = small[c];
+    1be7:	89 02                	mov    %eax,(%edx)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1be9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      small[c] = p;
+    1bec:	89 14 8d 40 50 00 00 	mov    %edx,0x5040(,%ecx,4)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1bf3:	01 c2                	add    %eax,%edx
+    1bf5:	81 ff 00 02 00 00    	cmp    $0x200,%edi
+    1bfb:	76 db                	jbe    1bd8 <malloc+0x188>
+    1bfd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1c00:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1c03:	e9 14 ff ff ff       	jmp    1b1c <malloc+0xcc>
+    mutex_unlock(&lock);
+    1c08:	83 ec 0c             	sub    $0xc,%esp
+    1c0b:	68 e8 4f 00 00       	push   $0x4fe8
+    1c10:	e8 4b e8 ff ff       	call   460 <mutex_unlock>
+}
+    1c15:	83 c4 10             	add    $0x10,%esp
+    1c18:	e9 37 ff ff ff       	jmp    1b54 <malloc+0x104>
+  if(threaded)
+    1c1d:	a1 e4 4f 00 00       	mov    0x4fe4,%eax
+    1c22:	85 c0                	test   %eax,%eax
+    1c24:	75 2b                	jne    1c51 <malloc+0x201>
+  tc->n[c] += moved;
+    1c26:	8b 47 20             	mov    0x20(%edi),%eax
+    1c29:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1c2c:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1c2e:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1c31:	e9 7a fe ff ff       	jmp    1ab0 <malloc+0x60>
+    mutex_lock(&lock);
+    1c36:	83 ec 0c             	sub    $0xc,%esp
+    1c39:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1c3c:	68 e8 4f 00 00       	push   $0x4fe8
+    1c41:	e8 ca e7 ff ff       	call   410 <mutex_lock>
+}
+    1c46:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1c49:	83 c4 10             	add    $0x10,%esp
+    1c4c:	e9 bc fe ff ff       	jmp    1b0d <malloc+0xbd>
+    mutex_unlock(&lock);
+    1c51:	83 ec 0c             	sub    $0xc,%esp
+    1c54:	68 e8 4f 00 00       	push   $0x4fe8
+    1c59:	e8 02 e8 ff ff       	call   460 <mutex_unlock>
+  tc->n[c] += moved;
+    1c5e:	8b 47 20             	mov    0x20(%edi),%eax
+    1c61:	83 c4 10             	add    $0x10,%esp
+    1c64:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1c67:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1c69:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1c6c:	e9 3f fe ff ff       	jmp    1ab0 <malloc+0x60>
+  if(threaded)
+    1c71:	8b 0d e4 4f 00 00    	mov    0x4fe4,%ecx
+    1c77:	85 c9                	test   %ecx,%ecx
+    1c79:	0f 84 73 fe ff ff    	je     1af2 <malloc+0xa2>
+    mutex_unlock(&lock);
+    1c7f:	83 ec 0c             	sub    $0xc,%esp
+    1c82:	68 e8 4f 00 00       	push   $0x4fe8
+    1c87:	e8 d4 e7 ff ff       	call   460 <mutex_unlock>
+    1c8c:	83 c4 10             	add    $0x10,%esp
+    return p ? (void*)(p + 1) : 0;
+    1c8f:	31 c0                	xor    %eax,%eax
+    1c91:	e9 5e fe ff ff       	jmp    1af4 <malloc+0xa4>
+  for(moved = 0; moved < n && small[c]; moved++){
+    1c96:	8b 04 8d 40 50 00 00 	mov    0x5040(,%ecx,4),%eax
+    1c9d:	e9 7a fe ff ff       	jmp    1b1c <malloc+0xcc>
+    1ca2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ca9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001cb0 <malloc_threaded>:
+void
+malloc_threaded(void)
+{
+  uint sp;
+
+  if(threaded)
+    1cb0:	a1 e4 4f 00 00       	mov    0x4fe4,%eax
+    1cb5:	85 c0                	test   %eax,%eax
+    1cb7:	74 07                	je     1cc0 <malloc_threaded+0x10>
+    1cb9:	c3                   	ret
+    1cba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+{
+    1cc0:	55                   	push   %ebp
+    1cc1:	89 e5                	mov    %esp,%ebp
+    1cc3:	83 ec 24             	sub    $0x24,%esp
+    return;
+  mutex_init(&lock);
+    1cc6:	68 e8 4f 00 00       	push   $0x4fe8
+    1ccb:	e8 30 e7 ff ff       	call   400 <mutex_init>
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1cd0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1cd3:	83 c4 10             	add    $0x10,%esp
+  threaded = 1;
+    1cd6:	c7 05 e4 4f 00 00 01 	movl   $0x1,0x4fe4
+    1cdd:	00 00 00 
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1ce0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    1ce5:	a3 e0 4f 00 00       	mov    %eax,0x4fe0
+}
+    1cea:	c9                   	leave
+    1ceb:	c3                   	ret
+    1cec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001cf0 <malloc_thread_exit>:
+
+// Called by thread_join() with the cache slot of a finished
+// thread: give its blocks, and the cache itself, back.
+void
+malloc_thread_exit(void **cachep)
+{
+    1cf0:	55                   	push   %ebp
+    1cf1:	89 e5                	mov    %esp,%ebp
+    1cf3:	57                   	push   %edi
+    1cf4:	56                   	push   %esi
+    1cf5:	53                   	push   %ebx
+    1cf6:	83 ec 0c             	sub    $0xc,%esp
+    1cf9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct tcache *tc;
+  int c;
+
+  if((tc = *cachep) == 0)
+    1cfc:	8b 37                	mov    (%edi),%esi
+    1cfe:	85 f6                	test   %esi,%esi
+    1d00:	74 41                	je     1d43 <malloc_thread_exit+0x53>
+    return;
+  for(c = 0; c < NCLASS; c++)
+    1d02:	31 db                	xor    %ebx,%ebx
+    1d04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    drain(tc, c, tc->n[c]);
+    1d08:	8b 4c 9e 20          	mov    0x20(%esi,%ebx,4),%ecx
+    1d0c:	89 da                	mov    %ebx,%edx
+    1d0e:	89 f0                	mov    %esi,%eax
+  for(c = 0; c < NCLASS; c++)
+    1d10:	83 c3 01             	add    $0x1,%ebx
+    drain(tc, c, tc->n[c]);
+    1d13:	e8 c8 fa ff ff       	call   17e0 <drain>
+  for(c = 0; c < NCLASS; c++)
+    1d18:	83 fb 08             	cmp    $0x8,%ebx
+    1d1b:	75 eb                	jne    1d08 <malloc_thread_exit+0x18>
+  if(threaded)
+    1d1d:	8b 15 e4 4f 00 00    	mov    0x4fe4,%edx
+    1d23:	85 d2                	test   %edx,%edx
+    1d25:	75 29                	jne    1d50 <malloc_thread_exit+0x60>
+  acquire();
+  trim(bigfree((Header*)tc - 1));
+    1d27:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1d2a:	e8 c1 f8 ff ff       	call   15f0 <bigfree>
+    1d2f:	e8 3c f9 ff ff       	call   1670 <trim>
+  if(threaded)
+    1d34:	a1 e4 4f 00 00       	mov    0x4fe4,%eax
+    1d39:	85 c0                	test   %eax,%eax
+    1d3b:	75 2b                	jne    1d68 <malloc_thread_exit+0x78>
+  release();
+  *cachep = 0;
+    1d3d:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+}
+    1d43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d46:	5b                   	pop    %ebx
+    1d47:	5e                   	pop    %esi
+    1d48:	5f                   	pop    %edi
+    1d49:	5d                   	pop    %ebp
+    1d4a:	c3                   	ret
+    1d4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1d4f:	90                   	nop
+    mutex_lock(&lock);
+    1d50:	83 ec 0c             	sub    $0xc,%esp
+    1d53:	68 e8 4f 00 00       	push   $0x4fe8
+    1d58:	e8 b3 e6 ff ff       	call   410 <mutex_lock>
+}
+    1d5d:	83 c4 10             	add    $0x10,%esp
+    1d60:	eb c5                	jmp    1d27 <malloc_thread_exit+0x37>
+    1d62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1d68:	83 ec 0c             	sub    $0xc,%esp
+    1d6b:	68 e8 4f 00 00       	push   $0x4fe8
+    1d70:	e8 eb e6 ff ff       	call   460 <mutex_unlock>
+}
+    1d75:	83 c4 10             	add    $0x10,%esp
+    1d78:	eb c3                	jmp    1d3d <malloc_thread_exit+0x4d>
+    1d7a:	66 90                	xchg   %ax,%ax
+    1d7c:	66 90                	xchg   %ax,%ax
+    1d7e:	66 90                	xchg   %ax,%ax
+
+00001d80 <thread_create>:
+
+// Start fn(arg) in a new thread on a freshly allocated
+// page-aligned stack.  Returns the thread's pid.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1d80:	55                   	push   %ebp
+    1d81:	89 e5                	mov    %esp,%ebp
+    1d83:	53                   	push   %ebx
+    1d84:	83 ec 14             	sub    $0x14,%esp
+  char *mem, *stack;
+  int pid;
+
+  malloc_threaded();
+    1d87:	e8 24 ff ff ff       	call   1cb0 <malloc_threaded>
+  stdio_threaded();
+    1d8c:	e8 cf ee ff ff       	call   c60 <stdio_threaded>
+  if((mem = malloc(2*PGSIZE)) == 0)
+    1d91:	83 ec 0c             	sub    $0xc,%esp
+    1d94:	68 00 20 00 00       	push   $0x2000
+    1d99:	e8 b2 fc ff ff       	call   1a50 <malloc>
+    1d9e:	83 c4 10             	add    $0x10,%esp
+    1da1:	85 c0                	test   %eax,%eax
+    1da3:	74 52                	je     1df7 <thread_create+0x77>
+    1da5:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1da7:	8d 80 07 10 00 00    	lea    0x1007(%eax),%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+  ((char**)stack)[-2] = 0;
+  if((pid = clone(fn, arg, stack)) < 0)
+    1dad:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1db0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+    1db5:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  ((char**)stack)[-2] = 0;
+    1db8:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+  if((pid = clone(fn, arg, stack)) < 0)
+    1dbf:	50                   	push   %eax
+    1dc0:	ff 75 0c             	push   0xc(%ebp)
+    1dc3:	ff 75 08             	push   0x8(%ebp)
+    1dc6:	e8 97 e8 ff ff       	call   662 <clone>
+    1dcb:	83 c4 10             	add    $0x10,%esp
+    1dce:	85 c0                	test   %eax,%eax
+    1dd0:	78 0e                	js     1de0 <thread_create+0x60>
+    free(mem);
+  return pid;
+}
+    1dd2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1dd5:	c9                   	leave
+    1dd6:	c3                   	ret
+    1dd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1dde:	66 90                	xchg   %ax,%ax
+    free(mem);
+    1de0:	83 ec 0c             	sub    $0xc,%esp
+    1de3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1de6:	53                   	push   %ebx
+    1de7:	e8 34 fb ff ff       	call   1920 <free>
+    1dec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1def:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    1df2:	83 c4 10             	add    $0x10,%esp
+}
+    1df5:	c9                   	leave
+    1df6:	c3                   	ret
+    return -1;
+    1df7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1dfc:	eb d4                	jmp    1dd2 <thread_create+0x52>
+    1dfe:	66 90                	xchg   %ax,%ax
+
+00001e00 <thread_join>:
+
+// Wait for a thread to finish and free its stack.
+int
+thread_join(void)
+{
+    1e00:	55                   	push   %ebp
+    1e01:	89 e5                	mov    %esp,%ebp
+    1e03:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    1e04:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    1e07:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    1e0a:	50                   	push   %eax
+    1e0b:	e8 61 e8 ff ff       	call   671 <join>
+    1e10:	83 c4 10             	add    $0x10,%esp
+    1e13:	85 c0                	test   %eax,%eax
+    1e15:	78 29                	js     1e40 <thread_join+0x40>
+    1e17:	89 c3                	mov    %eax,%ebx
+    return -1;
+  malloc_thread_exit(&((void**)stack)[-2]);
+    1e19:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1e1c:	83 ec 0c             	sub    $0xc,%esp
+    1e1f:	83 e8 08             	sub    $0x8,%eax
+    1e22:	50                   	push   %eax
+    1e23:	e8 c8 fe ff ff       	call   1cf0 <malloc_thread_exit>
+  free(((char**)stack)[-1]);
+    1e28:	58                   	pop    %eax
+    1e29:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1e2c:	ff 70 fc             	push   -0x4(%eax)
+    1e2f:	e8 ec fa ff ff       	call   1920 <free>
+  return pid;
+    1e34:	83 c4 10             	add    $0x10,%esp
+}
+    1e37:	89 d8                	mov    %ebx,%eax
+    1e39:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1e3c:	c9                   	leave
+    1e3d:	c3                   	ret
+    1e3e:	66 90                	xchg   %ax,%ax
+    return -1;
+    1e40:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    1e45:	eb f0                	jmp    1e37 <thread_join+0x37>
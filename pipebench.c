@@ -0,0 +1,60 @@
+// Pipe throughput benchmark.
+// A parent writes TOTAL bytes into a pipe in chunks of the given
+// size while a child reads them out; with two or more CPUs the
+// two normally run in parallel on different CPUs.
+// Throughput assumes the default 100 ticks per second.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define TOTAL (8*1024*1024)
+
+char buf[8192];
+
+int
+main(int argc, char *argv[])
+{
+  int fds[2], n, chunk, total, t0, t1, kb;
+
+  chunk = 4096;
+  if(argc > 1)
+    chunk = atoi(argv[1]);
+  if(chunk < 1 || chunk > sizeof(buf)){
+    printf(2, "usage: pipebench [chunk <= %d]\n", sizeof(buf));
+    exit();
+  }
+
+  if(pipe(fds) < 0){
+    printf(2, "pipebench: pipe failed\n");
+    exit();
+  }
+  t0 = uptime();
+  if(fork() == 0){
+    close(fds[1]);
+    total = 0;
+    while((n = read(fds[0], buf, chunk)) > 0)
+      total += n;
+    if(total != TOTAL)
+      printf(2, "pipebench: read %d bytes, want %d\n", total, TOTAL);
+    exit();
+  }
+  close(fds[0]);
+  for(total = 0; total < TOTAL; total += n){
+    n = TOTAL - total < chunk ? TOTAL - total : chunk;
+    if(write(fds[1], buf, n) != n){
+      printf(2, "pipebench: write failed\n");
+      break;
+    }
+  }
+  close(fds[1]);
+  wait();
+  t1 = uptime();
+
+  if(t1 == t0)
+    t1 = t0 + 1;
+  kb = TOTAL / 1024;
+  printf(1, "pipebench: %d KB in %d-byte chunks, %d ticks, %d KB/s\n",
+         kb, chunk, t1 - t0, kb * 100 / (t1 - t0));
+  exit();
+}
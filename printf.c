@@ -3,13 +3,7 @@
 #include "user.h"
 
 static void
-putc(int fd, char c)
-{
-  write(fd, &c, 1);
-}
-
-static void
-printint(int fd, int xx, int base, int sgn)
+printint(FILE *f, int xx, int base, int sgn)
 {
   static char digits[] = "0123456789ABCDEF";
   char buf[16];
@@ -32,33 +26,32 @@ printint(int fd, int xx, int base, int sgn)
     buf[i++] = '-';
 
   while(--i >= 0)
-    putc(fd, buf[i]);
+    putc_unlocked(buf[i], f);
 }
 
-// Print to the given fd. Only understands %d, %x, %p, %s.
-void
-printf(int fd, const char *fmt, ...)
+// Print to the given stream, which the caller has locked.
+// Only understands %d, %x, %p, %s.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
 {
   char *s;
   int c, i, state;
-  uint *ap;
 
   state = 0;
-  ap = (uint*)(void*)&fmt + 1;
   for(i = 0; fmt[i]; i++){
     c = fmt[i] & 0xff;
     if(state == 0){
       if(c == '%'){
         state = '%';
       } else {
-        putc(fd, c);
+        putc_unlocked(c, f);
       }
     } else if(state == '%'){
       if(c == 'd'){
-        printint(fd, *ap, 10, 1);
+        printint(f, *ap, 10, 1);
         ap++;
       } else if(c == 'x' || c == 'p'){
-        printint(fd, *ap, 16, 0);
+        printint(f, *ap, 16, 0);
         ap++;
       } else if(c == 's'){
         s = (char*)*ap;
@@ -66,20 +59,52 @@ printf(int fd, const char *fmt, ...)
         if(s == 0)
           s = "(null)";
         while(*s != 0){
-          putc(fd, *s);
+          putc_unlocked(*s, f);
           s++;
         }
       } else if(c == 'c'){
-        putc(fd, *ap);
+        putc_unlocked(*ap, f);
         ap++;
       } else if(c == '%'){
-        putc(fd, c);
+        putc_unlocked(c, f);
       } else {
         // Unknown % sequence.  Print it to draw attention.
-        putc(fd, '%');
-        putc(fd, c);
+        putc_unlocked('%', f);
+        putc_unlocked(c, f);
       }
       state = 0;
     }
   }
 }
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+  flockfile(f);
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+  funlockfile(f);
+}
+
+// Print to the given fd: through stdout or stderr for 1 and 2,
+// otherwise with one write() per call.
+void
+printf(int fd, const char *fmt, ...)
+{
+  char buf[128];
+  struct iobuf f;
+
+  if(fd == 1 || fd == 2){
+    flockfile(&_iob[fd]);
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+    funlockfile(&_iob[fd]);
+    return;
+  }
+  f.fd = fd;
+  f.flags = IO_WRITE|IO_SETUP;
+  f.buf = buf;
+  f.size = sizeof(buf);
+  f.r = f.n = 0;
+  mutex_init(&f.lock);
+  vfprintf(&f, fmt, (uint*)(void*)&fmt + 1);
+  fflush(&f);
+}
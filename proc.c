@@ -4,27 +4,47 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "x86.h"
+#include "traps.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "sleeplock.h"
+#include "scstat.h"
 
+// Procs come from a kmem cache; a slot of ptable.proc is 0
+// while no process uses it.
 struct {
     struct spinlock lock;
-    struct proc proc[NPROC];
+    struct proc *proc[NPROC];
 } ptable;
 
+static struct kmem_cache *proccache;
+
+// Serializes growproc(), since threads made by clone()
+// grow the page table they share.
+static struct sleeplock growlock;
+
 static struct proc *initproc;
 
+// Each ptable slot's system call counters, cleared by allocproc().
+static struct scstat procstats[NPROC][NSCSTAT];
+
 int nextpid = 1;
 
 extern void forkret(void);
 
 extern void trapret(void);
 
+static void kickidle(void);
+
+static void unallocproc(struct proc *);
+
 static void wakeup1(void *chan);
 
 void
 pinit(void) {
-    initlock(&ptable.lock, "ptable");
+    initticketlock(&ptable.lock, "ptable");
+    initsleeplock(&growlock, "growproc");
+    proccache = kmem_cache_create("proc", sizeof(struct proc), 0, 0);
 }
 
 // Must be called with interrupts disabled
@@ -70,7 +90,7 @@ myproc(void) {
 }
 
 //PAGEBREAK: 32
-// Look in the process table for an UNUSED proc.
+// Allocate a proc and find it a free slot in the process table.
 // If found, change state to EMBRYO and initialize
 // state required to run in the kernel.
 // Otherwise, return 0.
@@ -78,27 +98,38 @@ static struct proc *
 allocproc(void) {
     struct proc *p;
     char *sp;
+    int i;
 
+    if ((p = kmem_cache_alloc(proccache)) == 0)
+        return 0;
     acquire(&ptable.lock);
 
-    for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-        if (p->state == UNUSED)
+    for (i = 0; i < NPROC; i++)
+        if (ptable.proc[i] == 0)
             goto found;
 
     release(&ptable.lock);
+    kmem_cache_free(proccache, p);
     //一些语言中，它们有可能被混淆。例如，在C语言中，空指针常常用NULL宏来表示，而该宏的值实际上就是零。
     // 因此，在某些情况下，程序员需要谨慎地区分它们，以避免错误的结果。
     return 0;
 
     found:
+    ptable.proc[i] = p;
+    p->scstat = procstats[i];
     p->state = EMBRYO;
     p->pid = nextpid++;
+    p->ustack = 0;
+    p->mm = 0;
+    p->fpu = 0;
+    p->fpucpu = -1;
+    memset(p->scstat, 0, NSCSTAT * sizeof(struct scstat));
 
     release(&ptable.lock);
 
     // Allocate kernel stack.
     if ((p->kstack = kalloc()) == 0) {
-        p->state = UNUSED;
+        unallocproc(p);
         return 0;
     }
     sp = p->kstack + KSTACKSIZE;//sp 用于存储当前堆栈的顶部地址
@@ -131,6 +162,26 @@ allocproc(void) {
 }
 
 
+// Take p out of the process table and free it.
+// Caller must hold ptable.lock.
+static void
+procfree(struct proc *p) {
+    int i;
+
+    for (i = 0; i < NPROC; i++)
+        if (ptable.proc[i] == p)
+            ptable.proc[i] = 0;
+    kmem_cache_free(proccache, p);
+}
+
+// Give back a proc from allocproc() that never ran.
+static void
+unallocproc(struct proc *p) {
+    acquire(&ptable.lock);
+    procfree(p);
+    release(&ptable.lock);
+}
+
 //PAGEBREAK: 32
 // Set up first user process.
 void
@@ -142,7 +193,7 @@ userinit(void) {
     p = allocproc();
 
     initproc = p;
-    if ((p->pgdir = setupkvm()) == 0)
+    if ((p->pgdir = setupkvm()) == 0 || vdsomap(p->pgdir) < 0)
         panic("userinit: out of memory?");
     //调用名为"inituvm"的函数，将二进制代码加载到页表中。
     // 在这个过程中，会分配物理内存页面、建立虚拟地址与物理地址之间的映射关系，并设置访问权限等信息。
@@ -174,23 +225,55 @@ userinit(void) {
 }
 
 
-// Grow current process's memory by n bytes.
+// Grow current process's memory by n bytes, with 4MB pages
+// where possible if huge is set.
 // Return 0 on success, -1 on failure.
 int
-growproc(int n) {
+growproc(int n, int huge) {
     uint sz;
     struct proc *curproc = myproc();
+    struct proc *p;
+    int i;
 
+    acquiresleep(&growlock);
     sz = curproc->sz;
     if (n > 0) {
-        if ((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+        if (sz + n > MMAPBASE || sz + n < sz) {
+            releasesleep(&growlock);
             return -1;
+        }
+        // Out of memory: wait for kswapd to page some out, and retry.
+        do {
+            if (huge)
+                sz = allocuvmhuge(curproc->pgdir, curproc->sz, curproc->sz + n);
+            else
+                sz = allocuvm(curproc->pgdir, curproc->sz, curproc->sz + n);
+        } while (sz == 0 && swapwait(PGROUNDUP(n) / PGSIZE) == 0);
+        if (sz == 0) {
+            releasesleep(&growlock);
+            return -1;
+        }
     } else if (n < 0) {
-        if ((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
+        // Threads sharing the page table may be running on other
+        // CPUs with the pages in their TLBs: take away user access
+        // and have those CPUs flush before anything is freed.
+        revokeuvm(curproc->pgdir, sz, sz + n);
+        tlbshootdown(curproc->pgdir);
+        if ((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0) {
+            releasesleep(&growlock);
             return -1;
+        }
     }
-    curproc->sz = sz;
-    switchuvm(curproc);
+    // Threads sharing the page table must see the new size too.
+    acquire(&ptable.lock);
+    for (i = 0; i < NPROC; i++)
+        if ((p = ptable.proc[i]) != 0 && p->pgdir == curproc->pgdir)
+            p->sz = sz;
+    release(&ptable.lock);
+    releasesleep(&growlock);
+    // Drop TLB entries for any pages freed above; switchuvm()
+    // skips the %cr3 load for the page table already in use.
+    lcr3(V2P(curproc->pgdir));
     return 0;
 }
 
@@ -208,11 +291,21 @@ fork(void) {
         return -1;
     }
 
-    // Copy process state from proc.
-    if ((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0) {
+    // Copy process state from proc, waiting for kswapd to free
+    // memory if need be.
+    while ((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0 &&
+           swapwait(curproc->sz / PGSIZE) == 0)
+        ;
+    if (np->pgdir == 0) {
         kfree(np->kstack);
-        np->kstack = 0;
-        np->state = UNUSED;
+        unallocproc(np);
+        return -1;
+    }
+    if (vdsomap(np->pgdir) < 0 || fpufork(np) < 0 || mmapfork(np) < 0) {
+        fpufree(np);
+        freevm(np->pgdir);
+        kfree(np->kstack);
+        unallocproc(np);
         return -1;
     }
     np->sz = curproc->sz;
@@ -234,6 +327,66 @@ fork(void) {
     acquire(&ptable.lock);
 
     np->state = RUNNABLE;
+    kickidle();
+
+    release(&ptable.lock);
+
+    return pid;
+}
+
+// Create a new thread running fn(arg) on the user stack page at
+// stack, sharing the address space of the current process.
+// The caller reclaims the thread with join().
+int
+clone(void (*fn)(void *), void *arg, char *stack) {
+    int i, pid;
+    uint sp, ustack[2];
+    struct proc *np;
+    struct proc *curproc = myproc();
+
+    // join() tells threads by their non-zero stack.
+    if (stack == 0 || (uint) stack % PGSIZE != 0 || (uint) stack + PGSIZE < (uint) stack ||
+        (uint) stack + PGSIZE > curproc->sz)
+        return -1;
+
+    // Allocate process.
+    if ((np = allocproc()) == 0) {
+        return -1;
+    }
+
+    // Share the address space; start at fn with arg on the new stack,
+    // as if called from a function returning to a fake PC.
+    np->pgdir = curproc->pgdir;
+    np->sz = curproc->sz;
+    np->parent = curproc;
+    np->ustack = stack;
+    *np->tf = *curproc->tf;
+
+    ustack[0] = 0xffffffff;  // fake return PC
+    ustack[1] = (uint) arg;
+    sp = (uint) stack + PGSIZE - sizeof(ustack);
+    if (swapinrange(np->pgdir, sp, sizeof(ustack)) < 0 ||
+        copyout(np->pgdir, sp, ustack, sizeof(ustack)) < 0 || mmapclone(np) < 0) {
+        kfree(np->kstack);
+        unallocproc(np);
+        return -1;
+    }
+    np->tf->eip = (uint) fn;
+    np->tf->esp = sp;
+
+    for (i = 0; i < NOFILE; i++)
+        if (curproc->ofile[i])
+            np->ofile[i] = filedup(curproc->ofile[i]);
+    np->cwd = idup(curproc->cwd);
+
+    safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+
+    pid = np->pid;
+
+    acquire(&ptable.lock);
+
+    np->state = RUNNABLE;
+    kickidle();
 
     release(&ptable.lock);
 
@@ -247,11 +400,14 @@ void
 exit(void) {
     struct proc *curproc = myproc();
     struct proc *p;
-    int fd;
+    int fd, i;
 
     if (curproc == initproc)
         panic("init exiting");
 
+    // Write back and drop mmap() regions while the files are open.
+    munmapall();
+
     // Close all open files.
     for (fd = 0; fd < NOFILE; fd++) {
         if (curproc->ofile[fd]) {
@@ -271,8 +427,8 @@ exit(void) {
     wakeup1(curproc->parent);
 
     // Pass abandoned children to init.
-    for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
-        if (p->parent == curproc) {
+    for (i = 0; i < NPROC; i++) {
+        if ((p = ptable.proc[i]) != 0 && p->parent == curproc) {
             p->parent = initproc;
             if (p->state == ZOMBIE)
                 wakeup1(initproc);
@@ -285,33 +441,44 @@ exit(void) {
     panic("zombie exit");
 }
 
+// Free the resources of a ZOMBIE child. The page table is
+// freed only once no other thread still shares it.
+// Caller must hold ptable.lock.
+static void
+freeproc(struct proc *p) {
+    struct proc *q;
+    int i;
+
+    kfree(p->kstack);
+    fpufree(p);
+    for (i = 0; i < NPROC; i++)
+        if ((q = ptable.proc[i]) != 0 && q != p && q->pgdir == p->pgdir)
+            break;
+    if (i == NPROC)
+        freevm(p->pgdir);
+    procfree(p);
+}
+
 // Wait for a child process to exit and return its pid.
 // Return -1 if this process has no children.
 int
 wait(void) {
     struct proc *p;
-    int havekids, pid;
+    int havekids, pid, i;
     struct proc *curproc = myproc();
 
     acquire(&ptable.lock);
     for (;;) {
         // Scan through table looking for exited children.
         havekids = 0;
-        for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
-            if (p->parent != curproc)
+        for (i = 0; i < NPROC; i++) {
+            if ((p = ptable.proc[i]) == 0 || p->parent != curproc)
                 continue;
             havekids = 1;
             if (p->state == ZOMBIE) {
                 // Found one.
                 pid = p->pid;
-                kfree(p->kstack);
-                p->kstack = 0;
-                freevm(p->pgdir);
-                p->pid = 0;
-                p->parent = 0;
-                p->name[0] = 0;
-                p->killed = 0;
-                p->state = UNUSED;
+                freeproc(p);
                 release(&ptable.lock);
                 return pid;
             }
@@ -328,6 +495,170 @@ wait(void) {
     }
 }
 
+// Wait for a thread made by clone() to exit and return its pid,
+// setting *stack to the user stack it was given.
+// Return -1 if this process has no threads.
+int
+join(char **stack) {
+    struct proc *p;
+    int havekids, pid, i;
+    struct proc *curproc = myproc();
+
+    acquire(&ptable.lock);
+    for (;;) {
+        havekids = 0;
+        for (i = 0; i < NPROC; i++) {
+            if ((p = ptable.proc[i]) == 0 || p->parent != curproc || p->ustack == 0)
+                continue;
+            havekids = 1;
+            if (p->state == ZOMBIE) {
+                pid = p->pid;
+                *stack = p->ustack;
+                freeproc(p);
+                release(&ptable.lock);
+                return pid;
+            }
+        }
+
+        if (!havekids || curproc->killed) {
+            release(&ptable.lock);
+            return -1;
+        }
+
+        sleep(curproc, &ptable.lock);
+    }
+}
+
+// Install pgdir as p's page table. Returns the old page table
+// for the caller to free, or 0 if other threads still use it.
+pde_t *
+setpgdir(struct proc *p, pde_t *pgdir) {
+    pde_t *old;
+    struct proc *q;
+    int i;
+
+    acquire(&ptable.lock);
+    old = p->pgdir;
+    p->pgdir = pgdir;
+    for (i = 0; i < NPROC; i++)
+        if ((q = ptable.proc[i]) != 0 && q->pgdir == old)
+            old = 0;
+    release(&ptable.lock);
+    return old;
+}
+
+// Start a kernel thread running fn, which must not return.
+// It has no user memory: its page table maps just the kernel.
+void
+kthread(void (*fn)(void), char *name) {
+    struct proc *p;
+
+    if ((p = allocproc()) == 0 || (p->pgdir = setupkvm()) == 0)
+        panic("kthread");
+    // forkret() returns to fn instead of trapret (see allocproc).
+    *(uint *) ((char *) p->context + sizeof(*p->context)) = (uint) fn;
+    safestrcpy(p->name, name, sizeof(p->name));
+
+    acquire(&ptable.lock);
+    p->state = RUNNABLE;
+    kickidle();
+    release(&ptable.lock);
+}
+
+// Choose up to n cold user pages to swap out, and point their PTEs
+// at swap slots from swapalloc(). A page whose PTE_A bit is set
+// gets the bit cleared and a second chance. Pages come only from
+// processes preempted in user mode that do not share their page
+// table: no CPU has that page table loaded, so the PTEs can change
+// without a TLB flush. Fills mem[] with the pages' kernel addresses
+// and slot[] with their slots, for the caller to write out and free,
+// and returns the count. The caller holds the swap I/O lock, which
+// keeps swapin() from reading the slots until they are written.
+int
+swapscan(char **mem, uint *slot, int n) {
+    static int hand;   // first process to look at
+    struct proc *p, *q;
+    pte_t *pte;
+    uint va;
+    int i, j, k, pass, s;
+
+    i = k = 0;
+    acquire(&ptable.lock);
+    for (pass = 0; pass < 2 && k < n; pass++) {
+        for (i = 0; i < NPROC && k < n; i++) {
+            p = ptable.proc[(hand + i) % NPROC];
+            if (p == 0 || p->state != RUNNABLE || !p->swappable)
+                continue;
+            for (j = 0; j < NPROC; j++)
+                if ((q = ptable.proc[j]) != 0 && q != p && q->pgdir == p->pgdir)
+                    break;
+            if (j < NPROC)
+                continue;
+            for (va = 0; va < p->sz && k < n; va += PGSIZE) {
+                if ((p->pgdir[PDX(va)] & (PTE_P | PTE_PS)) != PTE_P) {
+                    va = PGADDR(PDX(va) + 1, 0, 0) - PGSIZE;
+                    continue;
+                }
+                pte = walkpgdir(p->pgdir, (char *) va, 0);
+                if ((*pte & (PTE_P | PTE_U)) != (PTE_P | PTE_U))
+                    continue;
+                if (*pte & PTE_A) {
+                    *pte &= ~PTE_A;
+                    continue;
+                }
+                if ((s = swapalloc()) < 0)
+                    goto out;
+                mem[k] = P2V(PTE_ADDR(*pte));
+                slot[k++] = s;
+                *pte = (s << PTXSHIFT) | (PTE_FLAGS(*pte) & ~PTE_P) | PTE_SWAP;
+            }
+        }
+    }
+    out:
+    hand = (hand + i) % NPROC;
+    release(&ptable.lock);
+    return k;
+}
+
+// Return 1 if another live thread shares p's page table.
+int
+pgdirshared(struct proc *p) {
+    struct proc *q;
+    int i, shared;
+
+    shared = 0;
+    acquire(&ptable.lock);
+    for (i = 0; i < NPROC; i++)
+        if ((q = ptable.proc[i]) != 0 && q != p && q->state != ZOMBIE &&
+            q->pgdir == p->pgdir)
+            shared = 1;
+    release(&ptable.lock);
+    return shared;
+}
+
+// Make every other CPU with pgdir loaded flush its TLB,
+// and wait until each has, so that pages just unmapped from pgdir
+// may be freed; flush this CPU's TLB too. The caller must hold no
+// spinlock, since a CPU spinning for it could not take the interrupt.
+void
+tlbshootdown(pde_t *pgdir) {
+    struct cpu *c;
+
+    acquire(&ptable.lock);
+    for (c = cpus; c < cpus + ncpu; c++) {
+        // scheduler() may keep pgdir loaded with no process running.
+        if (c != mycpu() && c->pgdir == pgdir) {
+            c->tlbflush = 1;
+            lapicipi(c->apicid, T_IRQ0 + IRQ_TLB);
+        }
+    }
+    release(&ptable.lock);
+    for (c = cpus; c < cpus + ncpu; c++)
+        while (c->tlbflush)
+            ;
+    lcr3(V2P(pgdir));
+}
+
 //PAGEBREAK: 42
 // Per-CPU process scheduler.
 // Each CPU calls scheduler() after setting itself up.
@@ -340,7 +671,9 @@ void
 scheduler(void) {
     struct proc *p;
     struct cpu *c = mycpu();
+    int i, ran, zero;
     c->proc = 0;
+    zero = 1;
 
     for (;;) {
         // Enable interrupts on this processor.
@@ -348,9 +681,11 @@ scheduler(void) {
 
         // Loop over process table looking for process to run.
         acquire(&ptable.lock);
-        for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
-            if (p->state != RUNNABLE)
+        ran = 0;
+        for (i = 0; i < NPROC; i++) {
+            if ((p = ptable.proc[i]) == 0 || p->state != RUNNABLE)
                 continue;
+            ran = 1;
 
             // Switch to chosen process.  It is the process's job
             // to release ptable.lock and then reacquire it
@@ -360,13 +695,45 @@ scheduler(void) {
             p->state = RUNNING;
 
             swtch(&(c->scheduler), p->context);
-            switchkvm();
+            fpusave(p);
 
             // Process is done running for now.
             // It should have changed its p->state before coming back.
             c->proc = 0;
         }
+
+        // Keep p's page table loaded over the scan above, so that
+        // running it or a thread sharing it again needs no %cr3
+        // load, but not once ptable.lock no longer stops wait()
+        // from freeing it.
+        switchkvm();
+        c->pgdir = 0;
+
+        if (!ran && zero) {
+            // Nothing to run: zero a free page, if there is one,
+            // and look again. The CPU is not idle meanwhile, so
+            // kickidle() does not pick it.
+            release(&ptable.lock);
+            zero = kzeroidle();
+            continue;
+        }
+        if (!ran) {
+            // Nothing to run and no page to zero: halt until
+            // kickidle() or the next sleep deadline. Marking the
+            // CPU idle under ptable.lock means a process made
+            // RUNNABLE after the scan above always sends the IPI;
+            // interrupts stay off until hlt.
+            c->idle = 1;
+            pushcli();
+            release(&ptable.lock);
+            timeridle();
+            c->idle = 0;
+            popcli();
+            zero = 1;
+            continue;
+        }
         release(&ptable.lock);
+        zero = 1;
 
     }
 }
@@ -425,6 +792,7 @@ forkret(void) {
         first = 0;
         iinit(ROOTDEV);
         initlog(ROOTDEV);
+        swapinit(ROOTDEV);
     }
 
     // Return to "caller", actually trapret (see allocproc).
@@ -468,16 +836,35 @@ sleep(void *chan, struct spinlock *lk) {
     }
 }
 
+// A process just became RUNNABLE: interrupt one CPU halted in
+// scheduler(), if any, so that it runs it without waiting for a
+// timer interrupt. The ptable lock must be held.
+static void
+kickidle(void) {
+    struct cpu *c;
+
+    for (c = cpus; c < cpus + ncpu; c++) {
+        if (c->idle && c != mycpu()) {
+            c->idle = 0;
+            lapicipi(c->apicid, T_IRQ0 + IRQ_WAKEUP);
+            return;
+        }
+    }
+}
+
 //PAGEBREAK!
 // Wake up all processes sleeping on chan.
 // The ptable lock must be held.
 static void
 wakeup1(void *chan) {
     struct proc *p;
+    int i;
 
-    for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-        if (p->state == SLEEPING && p->chan == chan)
+    for (i = 0; i < NPROC; i++)
+        if ((p = ptable.proc[i]) != 0 && p->state == SLEEPING && p->chan == chan) {
             p->state = RUNNABLE;
+            kickidle();
+        }
 }
 
 // Wake up all processes sleeping on chan.
@@ -488,20 +875,78 @@ wakeup(void *chan) {
     release(&ptable.lock);
 }
 
+// Futexes sleep on the kernel address of the user word, which
+// names its physical location: threads of a process, or processes
+// mapping the same page, all agree on it.
+static void *
+futexchan(int *uaddr) {
+    char *ka;
+
+    ka = uva2ka(myproc()->pgdir, (char *) PGROUNDDOWN((uint) uaddr));
+    if (ka == 0)
+        return 0;
+    return ka + (uint) uaddr % PGSIZE;
+}
+
+// Sleep until woken by futexwake() if *uaddr still holds val.
+// Returns -1 at once if it does not. uaddr must be a validated
+// user address. ptable.lock orders the check against wakers.
+int
+futexwait(int *uaddr, int val) {
+    void *chan;
+
+    if ((chan = futexchan(uaddr)) == 0)
+        return -1;
+    acquire(&ptable.lock);
+    if (*uaddr != val || myproc()->killed) {
+        release(&ptable.lock);
+        return -1;
+    }
+    sleep(chan, &ptable.lock);
+    release(&ptable.lock);
+    return 0;
+}
+
+// Wake at most n processes sleeping in futexwait() on uaddr.
+// Returns the number woken.
+int
+futexwake(int *uaddr, int n) {
+    struct proc *p;
+    void *chan;
+    int i, woken;
+
+    if ((chan = futexchan(uaddr)) == 0)
+        return -1;
+    woken = 0;
+    acquire(&ptable.lock);
+    for (i = 0; i < NPROC && woken < n; i++) {
+        if ((p = ptable.proc[i]) != 0 && p->state == SLEEPING && p->chan == chan) {
+            p->state = RUNNABLE;
+            kickidle();
+            woken++;
+        }
+    }
+    release(&ptable.lock);
+    return woken;
+}
+
 // Kill the process with the given pid.
 // Process won't exit until it returns
 // to user space (see trap in trap.c).
 int
 kill(int pid) {
     struct proc *p;
+    int i;
 
     acquire(&ptable.lock);
-    for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
-        if (p->pid == pid) {
+    for (i = 0; i < NPROC; i++) {
+        if ((p = ptable.proc[i]) != 0 && p->pid == pid) {
             p->killed = 1;
             // Wake process from sleep if necessary.
-            if (p->state == SLEEPING)
+            if (p->state == SLEEPING) {
                 p->state = RUNNABLE;
+                kickidle();
+            }
             release(&ptable.lock);
             return 0;
         }
@@ -524,13 +969,13 @@ procdump(void) {
             [RUNNING]   "run   ",
             [ZOMBIE]    "zombie"
     };
-    int i;
+    int i, j;
     struct proc *p;
     char *state;
     uint pc[10];
 
-    for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
-        if (p->state == UNUSED)
+    for (j = 0; j < NPROC; j++) {
+        if ((p = ptable.proc[j]) == 0)
             continue;
         if (p->state >= 0 && p->state < NELEM(states) && states[p->state])
             state = states[p->state];
@@ -545,3 +990,23 @@ procdump(void) {
         cprintf("\n");
     }
 }
+
+// Copy the first n system call counters of the process
+// with the given pid to st. Returns n, or -1 if there is
+// no such process.
+int
+procscstat(int pid, struct scstat *st, int n) {
+    struct proc *p;
+    int i;
+
+    acquire(&ptable.lock);
+    for (i = 0; i < NPROC; i++) {
+        if ((p = ptable.proc[i]) != 0 && p->pid == pid) {
+            memmove(st, p->scstat, n * sizeof(*st));
+            release(&ptable.lock);
+            return n;
+        }
+    }
+    release(&ptable.lock);
+    return -1;
+}
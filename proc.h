@@ -4,6 +4,7 @@ struct cpu {
     uchar apicid;                // Local APIC ID
     struct context *scheduler;   // swtch() here to enter scheduler
     //被x86架构用来找到中断堆栈（stack）
+    uint dbstack[128];           // Stack for a debug trap at sysenter; see trap()
     struct taskstate ts;         // Used by x86 to find stack for interrupt
     //包含NSEGS个元素的segdesc结构体数组，用于描述全局描述符表（GDT
     struct segdesc gdt[NSEGS];   // x86 global descriptor table
@@ -15,6 +16,10 @@ struct cpu {
     int intena;                  // Were interrupts enabled before pushcli?
     //表正在运行于此CPU上的进程或空指针
     struct proc *proc;           // The process running on this cpu or null
+    volatile int idle;           // Halted in scheduler(), waiting for work
+    volatile int tlbflush;       // Asked by tlbshootdown() to flush its TLB
+    pde_t *pgdir;                // User page table in %cr3, or 0
+    struct proc *fpu;            // Process whose FPU state was last loaded here
 };
 
 extern struct cpu cpus[NCPU];
@@ -99,6 +104,15 @@ struct proc {
     //指向当前目录（current working directory）的指针
     struct inode *cwd;           // Current directory
     char name[16];               // Process name (debugging)
+    char *ustack;                // User stack of a clone()d thread, else 0
+    uint deadline;               // Tick at which sleep() wakes up
+    struct wheel *wheel;         // Timer wheel holding this proc, or 0
+    struct proc *tnext;          // Next proc in the same wheel slot
+    struct mm *mm;               // mmap() regions, or 0; see mmap.c
+    int swappable;               // Preempted in user mode; see swap.c
+    char *fpu;                   // Saved FPU state, or 0 if unused; see fpu.c
+    int fpucpu;                  // CPU last holding it in registers, or -1
+    struct scstat *scstat;       // Per-system-call counters; see syscall.c
 };
 
 // Process memory is laid out contiguously, low addresses first:
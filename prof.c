@@ -0,0 +1,109 @@
+// Sampling profiler.
+//
+// proftick() runs on each CPU's timer interrupt and appends a sample
+// to that CPU's ring, so CPUs never contend with each other for one.
+// A sample that finds its ring full is counted as lost, and the
+// reader sees the count when it stops profiling. Host-side,
+// profsym.pl turns the printed samples into a per-function profile
+// using kernel.sym and the programs' .sym files.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "prof.h"
+
+struct {
+    struct spinlock lock;
+    struct sample buf[NSAMPLE];
+    uint r;                        // next to read
+    uint w;                        // next to write
+    uint lost;
+} profbuf[NCPU];
+
+static volatile int profon;
+
+void
+profinit(void) {
+    int i;
+
+    for (i = 0; i < NCPU; i++)
+        initlock(&profbuf[i].lock, "prof");
+}
+
+// Record where this CPU was interrupted. Called with interrupts off.
+void
+proftick(struct trapframe *tf) {
+    struct proc *p;
+    struct sample *s;
+    int id;
+
+    if (!profon)
+        return;
+    id = cpuid();
+    acquire(&profbuf[id].lock);
+    if (profbuf[id].w - profbuf[id].r == NSAMPLE) {
+        profbuf[id].lost++;
+    } else {
+        s = &profbuf[id].buf[profbuf[id].w++ % NSAMPLE];
+        p = myproc();
+        s->eip = tf->eip;
+        s->pid = p ? p->pid : 0;
+        s->cpu = id;
+        s->user = (tf->cs & 3) == DPL_USER;
+        safestrcpy(s->name, p ? p->name : "", sizeof(s->name));
+    }
+    release(&profbuf[id].lock);
+}
+
+void
+profstart(void) {
+    int i;
+
+    for (i = 0; i < ncpu; i++) {
+        acquire(&profbuf[i].lock);
+        profbuf[i].r = profbuf[i].w = 0;
+        profbuf[i].lost = 0;
+        release(&profbuf[i].lock);
+    }
+    profon = 1;
+}
+
+// Stop sampling and return the number of samples lost.
+int
+profstop(void) {
+    int i, lost;
+
+    profon = 0;
+    lost = 0;
+    for (i = 0; i < ncpu; i++) {
+        acquire(&profbuf[i].lock);
+        lost += profbuf[i].lost;
+        release(&profbuf[i].lock);
+    }
+    return lost;
+}
+
+// Move up to n samples to dst, which fetchbuf() has checked.
+// Returns the number moved, or -1 if profiling is off and
+// no samples are left.
+int
+profread(struct sample *dst, int n) {
+    int i, on, got;
+
+    on = profon;
+    got = 0;
+    for (i = 0; i < ncpu && got < n; i++) {
+        acquire(&profbuf[i].lock);
+        while (got < n && profbuf[i].r != profbuf[i].w)
+            dst[got++] = profbuf[i].buf[profbuf[i].r++ % NSAMPLE];
+        release(&profbuf[i].lock);
+    }
+    if (got == 0 && !on)
+        return -1;
+    return got;
+}
@@ -0,0 +1,19 @@
+// Sampling profiler interface for prof().
+// Both the kernel and user programs use this header file.
+//
+// While profiling is on, every timer interrupt on every CPU records
+// where that CPU was: the interrupted %eip and the process running.
+
+#define PROF_START  1   // discard old samples and start sampling
+#define PROF_STOP   2   // stop; returns the number of samples lost
+#define PROF_READ   3   // take up to n samples; -1 once stopped and empty
+
+#define NSAMPLE  1024   // samples per CPU ring
+
+struct sample {
+  uint eip;
+  int pid;              // 0 if the CPU was in the scheduler
+  ushort cpu;
+  ushort user;          // eip is a user address
+  char name[16];        // process name, as in struct proc
+};
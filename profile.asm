@@ -0,0 +1,4128 @@
+
+_profile:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	56                   	push   %esi
+       e:	53                   	push   %ebx
+       f:	51                   	push   %ecx
+      10:	83 ec 0c             	sub    $0xc,%esp
+  int pid, reader, lost, w;
+
+  if(argc < 2){
+      13:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+      16:	8b 71 04             	mov    0x4(%ecx),%esi
+  if(argc < 2){
+      19:	0f 8e a0 00 00 00    	jle    bf <main+0xbf>
+    fprintf(stderr, "usage: profile command [arg ...]\n");
+    exit();
+  }
+  prof(PROF_START, 0, 0);
+      1f:	50                   	push   %eax
+      20:	6a 00                	push   $0x0
+      22:	6a 00                	push   $0x0
+      24:	6a 01                	push   $0x1
+      26:	e8 38 07 00 00       	call   763 <prof>
+  if((pid = fork()) == 0){
+      2b:	e8 90 01 00 00       	call   1c0 <fork>
+      30:	83 c4 10             	add    $0x10,%esp
+      33:	89 c3                	mov    %eax,%ebx
+      35:	85 c0                	test   %eax,%eax
+      37:	75 28                	jne    61 <main+0x61>
+    exec(argv[1], argv+1);
+      39:	8d 46 04             	lea    0x4(%esi),%eax
+      3c:	53                   	push   %ebx
+      3d:	53                   	push   %ebx
+      3e:	50                   	push   %eax
+      3f:	ff 76 04             	push   0x4(%esi)
+      42:	e8 a9 01 00 00       	call   1f0 <exec>
+    fprintf(stderr, "profile: exec %s failed\n", argv[1]);
+      47:	83 c4 0c             	add    $0xc,%esp
+      4a:	ff 76 04             	push   0x4(%esi)
+      4d:	68 83 1e 00 00       	push   $0x1e83
+      52:	68 18 29 00 00       	push   $0x2918
+      57:	e8 54 09 00 00       	call   9b0 <fprintf>
+    exit();
+      5c:	e8 bf 01 00 00       	call   220 <exit>
+  }
+  if((reader = fork()) == 0){
+      61:	e8 5a 01 00 00       	call   1c0 <fork>
+      66:	85 c0                	test   %eax,%eax
+      68:	74 6b                	je     d5 <main+0xd5>
+    dump();
+    exit();
+  }
+  if(pid < 0 || reader < 0)
+      6a:	09 d8                	or     %ebx,%eax
+      6c:	78 71                	js     df <main+0xdf>
+    fprintf(stderr, "profile: fork failed\n");
+  while(pid > 0 && (w = wait()) >= 0 && w != pid)
+      6e:	85 db                	test   %ebx,%ebx
+      70:	7f 0a                	jg     7c <main+0x7c>
+      72:	eb 11                	jmp    85 <main+0x85>
+      74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      78:	39 c3                	cmp    %eax,%ebx
+      7a:	74 09                	je     85 <main+0x85>
+      7c:	e8 f3 04 00 00       	call   574 <wait>
+      81:	85 c0                	test   %eax,%eax
+      83:	79 f3                	jns    78 <main+0x78>
+    ;
+  lost = prof(PROF_STOP, 0, 0);
+      85:	52                   	push   %edx
+      86:	6a 00                	push   $0x0
+      88:	6a 00                	push   $0x0
+      8a:	6a 02                	push   $0x2
+      8c:	e8 d2 06 00 00       	call   763 <prof>
+  while(wait() >= 0)
+      91:	83 c4 10             	add    $0x10,%esp
+  lost = prof(PROF_STOP, 0, 0);
+      94:	89 c3                	mov    %eax,%ebx
+  while(wait() >= 0)
+      96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      9d:	8d 76 00             	lea    0x0(%esi),%esi
+      a0:	e8 cf 04 00 00       	call   574 <wait>
+      a5:	85 c0                	test   %eax,%eax
+      a7:	79 f7                	jns    a0 <main+0xa0>
+    ;
+  fprintf(stderr, "profile: %d samples lost\n", lost);
+      a9:	50                   	push   %eax
+      aa:	53                   	push   %ebx
+      ab:	68 b2 1e 00 00       	push   $0x1eb2
+      b0:	68 18 29 00 00       	push   $0x2918
+      b5:	e8 f6 08 00 00       	call   9b0 <fprintf>
+  exit();
+      ba:	e8 61 01 00 00       	call   220 <exit>
+    fprintf(stderr, "usage: profile command [arg ...]\n");
+      bf:	50                   	push   %eax
+      c0:	50                   	push   %eax
+      c1:	68 cc 1e 00 00       	push   $0x1ecc
+      c6:	68 18 29 00 00       	push   $0x2918
+      cb:	e8 e0 08 00 00       	call   9b0 <fprintf>
+    exit();
+      d0:	e8 4b 01 00 00       	call   220 <exit>
+    dump();
+      d5:	e8 26 00 00 00       	call   100 <dump>
+    exit();
+      da:	e8 41 01 00 00       	call   220 <exit>
+    fprintf(stderr, "profile: fork failed\n");
+      df:	51                   	push   %ecx
+      e0:	51                   	push   %ecx
+      e1:	68 9c 1e 00 00       	push   $0x1e9c
+      e6:	68 18 29 00 00       	push   $0x2918
+      eb:	e8 c0 08 00 00       	call   9b0 <fprintf>
+      f0:	83 c4 10             	add    $0x10,%esp
+      f3:	e9 76 ff ff ff       	jmp    6e <main+0x6e>
+      f8:	66 90                	xchg   %ax,%ax
+      fa:	66 90                	xchg   %ax,%ax
+      fc:	66 90                	xchg   %ax,%ax
+      fe:	66 90                	xchg   %ax,%ax
+
+00000100 <dump>:
+{
+     100:	55                   	push   %ebp
+     101:	89 e5                	mov    %esp,%ebp
+     103:	57                   	push   %edi
+     104:	56                   	push   %esi
+     105:	53                   	push   %ebx
+     106:	83 ec 0c             	sub    $0xc,%esp
+  while((n = prof(PROF_READ, s, NREAD)) >= 0){
+     109:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     110:	83 ec 04             	sub    $0x4,%esp
+     113:	6a 40                	push   $0x40
+     115:	68 c0 29 00 00       	push   $0x29c0
+     11a:	6a 03                	push   $0x3
+     11c:	e8 42 06 00 00       	call   763 <prof>
+     121:	83 c4 10             	add    $0x10,%esp
+     124:	89 c7                	mov    %eax,%edi
+     126:	85 c0                	test   %eax,%eax
+     128:	0f 88 83 00 00 00    	js     1b1 <dump+0xb1>
+    for(i = 0; i < n; i++)
+     12e:	74 60                	je     190 <dump+0x90>
+     130:	bb cc 29 00 00       	mov    $0x29cc,%ebx
+     135:	31 f6                	xor    %esi,%esi
+     137:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     13e:	66 90                	xchg   %ax,%ax
+      fprintf(stdout, "prof %d %d %s %s %x\n", s[i].cpu, s[i].pid,
+     140:	66 83 7b fe 00       	cmpw   $0x0,-0x2(%ebx)
+     145:	b8 6a 1e 00 00       	mov    $0x1e6a,%eax
+     14a:	ba 68 1e 00 00       	mov    $0x1e68,%edx
+     14f:	0f 44 d0             	cmove  %eax,%edx
+     152:	80 3b 00             	cmpb   $0x0,(%ebx)
+     155:	b8 6c 1e 00 00       	mov    $0x1e6c,%eax
+     15a:	0f 45 c3             	cmovne %ebx,%eax
+     15d:	83 ec 04             	sub    $0x4,%esp
+     160:	ff 73 f4             	push   -0xc(%ebx)
+    for(i = 0; i < n; i++)
+     163:	83 c6 01             	add    $0x1,%esi
+      fprintf(stdout, "prof %d %d %s %s %x\n", s[i].cpu, s[i].pid,
+     166:	52                   	push   %edx
+    for(i = 0; i < n; i++)
+     167:	83 c3 1c             	add    $0x1c,%ebx
+      fprintf(stdout, "prof %d %d %s %s %x\n", s[i].cpu, s[i].pid,
+     16a:	50                   	push   %eax
+     16b:	ff 73 dc             	push   -0x24(%ebx)
+     16e:	0f b7 43 e0          	movzwl -0x20(%ebx),%eax
+     172:	50                   	push   %eax
+     173:	68 6e 1e 00 00       	push   $0x1e6e
+     178:	68 fc 28 00 00       	push   $0x28fc
+     17d:	e8 2e 08 00 00       	call   9b0 <fprintf>
+    for(i = 0; i < n; i++)
+     182:	83 c4 20             	add    $0x20,%esp
+     185:	39 f7                	cmp    %esi,%edi
+     187:	75 b7                	jne    140 <dump+0x40>
+    if(n < NREAD){
+     189:	83 ff 40             	cmp    $0x40,%edi
+     18c:	74 82                	je     110 <dump+0x10>
+     18e:	66 90                	xchg   %ax,%ax
+      fflush(stdout);
+     190:	83 ec 0c             	sub    $0xc,%esp
+     193:	68 fc 28 00 00       	push   $0x28fc
+     198:	e8 b3 0d 00 00       	call   f50 <fflush>
+      sleep(1);
+     19d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     1a4:	e8 ca 04 00 00       	call   673 <sleep>
+     1a9:	83 c4 10             	add    $0x10,%esp
+     1ac:	e9 5f ff ff ff       	jmp    110 <dump+0x10>
+}
+     1b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     1b4:	5b                   	pop    %ebx
+     1b5:	5e                   	pop    %esi
+     1b6:	5f                   	pop    %edi
+     1b7:	5d                   	pop    %ebp
+     1b8:	c3                   	ret
+     1b9:	66 90                	xchg   %ax,%ax
+     1bb:	66 90                	xchg   %ax,%ax
+     1bd:	66 90                	xchg   %ax,%ax
+     1bf:	90                   	nop
+
+000001c0 <fork>:
+int sysexit(void) __attribute__((noreturn));
+
+int
+fork(void)
+{
+  if(flushhook)
+     1c0:	a1 c0 30 00 00       	mov    0x30c0,%eax
+     1c5:	85 c0                	test   %eax,%eax
+     1c7:	74 17                	je     1e0 <fork+0x20>
+{
+     1c9:	55                   	push   %ebp
+     1ca:	89 e5                	mov    %esp,%ebp
+     1cc:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     1cf:	ff d0                	call   *%eax
+  return sysfork();
+}
+     1d1:	c9                   	leave
+  return sysfork();
+     1d2:	e9 7f 03 00 00       	jmp    556 <sysfork>
+     1d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1de:	66 90                	xchg   %ax,%ax
+     1e0:	e9 71 03 00 00       	jmp    556 <sysfork>
+     1e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+     1f0:	55                   	push   %ebp
+  if(flushhook)
+     1f1:	a1 c0 30 00 00       	mov    0x30c0,%eax
+{
+     1f6:	89 e5                	mov    %esp,%ebp
+     1f8:	56                   	push   %esi
+     1f9:	53                   	push   %ebx
+     1fa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     1fd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     200:	85 c0                	test   %eax,%eax
+     202:	74 02                	je     206 <exec+0x16>
+    flushhook();
+     204:	ff d0                	call   *%eax
+  return sysexec(path, argv);
+     206:	89 75 0c             	mov    %esi,0xc(%ebp)
+     209:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     20c:	5b                   	pop    %ebx
+     20d:	5e                   	pop    %esi
+     20e:	5d                   	pop    %ebp
+  return sysexec(path, argv);
+     20f:	e9 ba 03 00 00       	jmp    5ce <sysexec>
+     214:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     21b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     21f:	90                   	nop
+
+00000220 <exit>:
+
+int
+exit(void)
+{
+     220:	55                   	push   %ebp
+     221:	89 e5                	mov    %esp,%ebp
+     223:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     226:	a1 c0 30 00 00       	mov    0x30c0,%eax
+     22b:	85 c0                	test   %eax,%eax
+     22d:	74 02                	je     231 <exit+0x11>
+    flushhook();
+     22f:	ff d0                	call   *%eax
+  sysexit();
+     231:	e8 2f 03 00 00       	call   565 <sysexit>
+     236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     23d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000240 <strcpy>:
+}
+
+char*
+strcpy(char *s, const char *t)
+{
+     240:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     241:	31 c0                	xor    %eax,%eax
+{
+     243:	89 e5                	mov    %esp,%ebp
+     245:	53                   	push   %ebx
+     246:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     249:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     250:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     254:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     257:	83 c0 01             	add    $0x1,%eax
+     25a:	84 d2                	test   %dl,%dl
+     25c:	75 f2                	jne    250 <strcpy+0x10>
+    ;
+  return os;
+}
+     25e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     261:	89 c8                	mov    %ecx,%eax
+     263:	c9                   	leave
+     264:	c3                   	ret
+     265:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     26c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000270 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     270:	55                   	push   %ebp
+     271:	89 e5                	mov    %esp,%ebp
+     273:	53                   	push   %ebx
+     274:	8b 55 08             	mov    0x8(%ebp),%edx
+     277:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     27a:	0f b6 02             	movzbl (%edx),%eax
+     27d:	84 c0                	test   %al,%al
+     27f:	75 17                	jne    298 <strcmp+0x28>
+     281:	eb 3a                	jmp    2bd <strcmp+0x4d>
+     283:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     287:	90                   	nop
+     288:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     28c:	83 c2 01             	add    $0x1,%edx
+     28f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     292:	84 c0                	test   %al,%al
+     294:	74 1a                	je     2b0 <strcmp+0x40>
+    p++, q++;
+     296:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     298:	0f b6 19             	movzbl (%ecx),%ebx
+     29b:	38 c3                	cmp    %al,%bl
+     29d:	74 e9                	je     288 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     29f:	29 d8                	sub    %ebx,%eax
+}
+     2a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2a4:	c9                   	leave
+     2a5:	c3                   	ret
+     2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     2b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     2b4:	31 c0                	xor    %eax,%eax
+     2b6:	29 d8                	sub    %ebx,%eax
+}
+     2b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2bb:	c9                   	leave
+     2bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     2bd:	0f b6 19             	movzbl (%ecx),%ebx
+     2c0:	31 c0                	xor    %eax,%eax
+     2c2:	eb db                	jmp    29f <strcmp+0x2f>
+     2c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2cf:	90                   	nop
+
+000002d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     2d0:	55                   	push   %ebp
+     2d1:	89 e5                	mov    %esp,%ebp
+     2d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     2d6:	80 3a 00             	cmpb   $0x0,(%edx)
+     2d9:	74 15                	je     2f0 <strlen+0x20>
+     2db:	31 c0                	xor    %eax,%eax
+     2dd:	8d 76 00             	lea    0x0(%esi),%esi
+     2e0:	83 c0 01             	add    $0x1,%eax
+     2e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     2e7:	89 c1                	mov    %eax,%ecx
+     2e9:	75 f5                	jne    2e0 <strlen+0x10>
+    ;
+  return n;
+}
+     2eb:	89 c8                	mov    %ecx,%eax
+     2ed:	5d                   	pop    %ebp
+     2ee:	c3                   	ret
+     2ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+     2f0:	31 c9                	xor    %ecx,%ecx
+}
+     2f2:	5d                   	pop    %ebp
+     2f3:	89 c8                	mov    %ecx,%eax
+     2f5:	c3                   	ret
+     2f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000300 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     300:	55                   	push   %ebp
+     301:	89 e5                	mov    %esp,%ebp
+     303:	57                   	push   %edi
+     304:	8b 55 08             	mov    0x8(%ebp),%edx
+            "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt) {
+    asm volatile("cld; rep stosb" :
+     307:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     30a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     30d:	89 d7                	mov    %edx,%edi
+     30f:	fc                   	cld
+     310:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     312:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     315:	89 d0                	mov    %edx,%eax
+     317:	c9                   	leave
+     318:	c3                   	ret
+     319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     320:	55                   	push   %ebp
+     321:	89 e5                	mov    %esp,%ebp
+     323:	8b 45 08             	mov    0x8(%ebp),%eax
+     326:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     32a:	0f b6 10             	movzbl (%eax),%edx
+     32d:	84 d2                	test   %dl,%dl
+     32f:	75 12                	jne    343 <strchr+0x23>
+     331:	eb 1d                	jmp    350 <strchr+0x30>
+     333:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     337:	90                   	nop
+     338:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     33c:	83 c0 01             	add    $0x1,%eax
+     33f:	84 d2                	test   %dl,%dl
+     341:	74 0d                	je     350 <strchr+0x30>
+    if(*s == c)
+     343:	38 d1                	cmp    %dl,%cl
+     345:	75 f1                	jne    338 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     347:	5d                   	pop    %ebp
+     348:	c3                   	ret
+     349:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     350:	31 c0                	xor    %eax,%eax
+}
+     352:	5d                   	pop    %ebp
+     353:	c3                   	ret
+     354:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     35b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     35f:	90                   	nop
+
+00000360 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     360:	55                   	push   %ebp
+     361:	89 e5                	mov    %esp,%ebp
+     363:	56                   	push   %esi
+     364:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     365:	83 ec 08             	sub    $0x8,%esp
+     368:	6a 00                	push   $0x0
+     36a:	ff 75 08             	push   0x8(%ebp)
+     36d:	e8 6b 02 00 00       	call   5dd <open>
+  if(fd < 0)
+     372:	83 c4 10             	add    $0x10,%esp
+     375:	85 c0                	test   %eax,%eax
+     377:	78 27                	js     3a0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     379:	83 ec 08             	sub    $0x8,%esp
+     37c:	ff 75 0c             	push   0xc(%ebp)
+     37f:	89 c3                	mov    %eax,%ebx
+     381:	50                   	push   %eax
+     382:	e8 83 02 00 00       	call   60a <fstat>
+  close(fd);
+     387:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     38a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     38c:	e8 1f 02 00 00       	call   5b0 <close>
+  return r;
+     391:	83 c4 10             	add    $0x10,%esp
+}
+     394:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     397:	89 f0                	mov    %esi,%eax
+     399:	5b                   	pop    %ebx
+     39a:	5e                   	pop    %esi
+     39b:	5d                   	pop    %ebp
+     39c:	c3                   	ret
+     39d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     3a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     3a5:	eb ed                	jmp    394 <stat+0x34>
+     3a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ae:	66 90                	xchg   %ax,%ax
+
+000003b0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     3b0:	55                   	push   %ebp
+     3b1:	89 e5                	mov    %esp,%ebp
+     3b3:	53                   	push   %ebx
+     3b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     3b7:	0f be 02             	movsbl (%edx),%eax
+     3ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     3bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     3c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     3c5:	77 1e                	ja     3e5 <atoi+0x35>
+     3c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     3d0:	83 c2 01             	add    $0x1,%edx
+     3d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     3d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     3da:	0f be 02             	movsbl (%edx),%eax
+     3dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     3e0:	80 fb 09             	cmp    $0x9,%bl
+     3e3:	76 eb                	jbe    3d0 <atoi+0x20>
+  return n;
+}
+     3e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3e8:	89 c8                	mov    %ecx,%eax
+     3ea:	c9                   	leave
+     3eb:	c3                   	ret
+     3ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003f0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     3f0:	55                   	push   %ebp
+     3f1:	89 e5                	mov    %esp,%ebp
+     3f3:	57                   	push   %edi
+     3f4:	56                   	push   %esi
+     3f5:	8b 45 10             	mov    0x10(%ebp),%eax
+     3f8:	8b 55 08             	mov    0x8(%ebp),%edx
+     3fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     3fe:	85 c0                	test   %eax,%eax
+     400:	7e 13                	jle    415 <memmove+0x25>
+     402:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     404:	89 d7                	mov    %edx,%edi
+     406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     40d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     410:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     411:	39 f8                	cmp    %edi,%eax
+     413:	75 fb                	jne    410 <memmove+0x20>
+  return vdst;
+}
+     415:	5e                   	pop    %esi
+     416:	89 d0                	mov    %edx,%eax
+     418:	5f                   	pop    %edi
+     419:	5d                   	pop    %ebp
+     41a:	c3                   	ret
+     41b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     41f:	90                   	nop
+
+00000420 <mutex_init>:
+
+// Futex-based mutex (Drepper, "Futexes Are Tricky", mutex 2).
+// The uncontended paths never enter the kernel.
+void
+mutex_init(struct mutex *m)
+{
+     420:	55                   	push   %ebp
+     421:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+     423:	8b 45 08             	mov    0x8(%ebp),%eax
+     426:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     42c:	5d                   	pop    %ebp
+     42d:	c3                   	ret
+     42e:	66 90                	xchg   %ax,%ax
+
+00000430 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     430:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     431:	31 c0                	xor    %eax,%eax
+     433:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+     438:	89 e5                	mov    %esp,%ebp
+     43a:	56                   	push   %esi
+     43b:	53                   	push   %ebx
+     43c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     43f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     443:	85 c0                	test   %eax,%eax
+     445:	74 32                	je     479 <mutex_lock+0x49>
+    return;
+  if(c != 2)
+     447:	83 f8 02             	cmp    $0x2,%eax
+     44a:	74 0c                	je     458 <mutex_lock+0x28>
+static inline uint
+xchg(volatile uint *addr, uint newval) {
+    uint result;
+
+    // The + in "+m" denotes a read-modify-write operand.
+    asm volatile("lock; xchgl %0, %1" :
+     44c:	b8 02 00 00 00       	mov    $0x2,%eax
+     451:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+     454:	85 c0                	test   %eax,%eax
+     456:	74 21                	je     479 <mutex_lock+0x49>
+     458:	be 02 00 00 00       	mov    $0x2,%esi
+     45d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAIT, 2);
+     460:	83 ec 04             	sub    $0x4,%esp
+     463:	6a 02                	push   $0x2
+     465:	6a 00                	push   $0x0
+     467:	53                   	push   %ebx
+     468:	e8 33 02 00 00       	call   6a0 <futex>
+     46d:	89 f0                	mov    %esi,%eax
+     46f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     472:	83 c4 10             	add    $0x10,%esp
+     475:	85 c0                	test   %eax,%eax
+     477:	75 e7                	jne    460 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+     479:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     47c:	5b                   	pop    %ebx
+     47d:	5e                   	pop    %esi
+     47e:	5d                   	pop    %ebp
+     47f:	c3                   	ret
+
+00000480 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     480:	55                   	push   %ebp
+     481:	89 e5                	mov    %esp,%ebp
+     483:	83 ec 08             	sub    $0x8,%esp
+     486:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     489:	f0 83 28 01          	lock subl $0x1,(%eax)
+     48d:	75 09                	jne    498 <mutex_unlock+0x18>
+    m->val = 0;
+    futex(&m->val, FUTEX_WAKE, 1);
+  }
+}
+     48f:	c9                   	leave
+     490:	c3                   	ret
+     491:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     498:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     49b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex(&m->val, FUTEX_WAKE, 1);
+     4a1:	6a 01                	push   $0x1
+     4a3:	6a 01                	push   $0x1
+     4a5:	50                   	push   %eax
+     4a6:	e8 f5 01 00 00       	call   6a0 <futex>
+     4ab:	83 c4 10             	add    $0x10,%esp
+}
+     4ae:	c9                   	leave
+     4af:	c3                   	ret
+
+000004b0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     4b0:	55                   	push   %ebp
+     4b1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     4b3:	8b 45 08             	mov    0x8(%ebp),%eax
+     4b6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     4bc:	5d                   	pop    %ebp
+     4bd:	c3                   	ret
+     4be:	66 90                	xchg   %ax,%ax
+
+000004c0 <cond_wait>:
+
+// Release m and wait for a signal, then reacquire m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     4c0:	55                   	push   %ebp
+     4c1:	89 e5                	mov    %esp,%ebp
+     4c3:	57                   	push   %edi
+     4c4:	56                   	push   %esi
+     4c5:	53                   	push   %ebx
+     4c6:	83 ec 0c             	sub    $0xc,%esp
+     4c9:	8b 75 08             	mov    0x8(%ebp),%esi
+     4cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     4cf:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     4d1:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+     4d5:	75 21                	jne    4f8 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     4d7:	83 ec 04             	sub    $0x4,%esp
+     4da:	57                   	push   %edi
+     4db:	6a 00                	push   $0x0
+     4dd:	56                   	push   %esi
+     4de:	e8 bd 01 00 00       	call   6a0 <futex>
+  mutex_lock(m);
+     4e3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     4e6:	83 c4 10             	add    $0x10,%esp
+}
+     4e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4ec:	5b                   	pop    %ebx
+     4ed:	5e                   	pop    %esi
+     4ee:	5f                   	pop    %edi
+     4ef:	5d                   	pop    %ebp
+  mutex_lock(m);
+     4f0:	e9 3b ff ff ff       	jmp    430 <mutex_lock>
+     4f5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     4f8:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     4fb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex(&m->val, FUTEX_WAKE, 1);
+     501:	6a 01                	push   $0x1
+     503:	6a 01                	push   $0x1
+     505:	53                   	push   %ebx
+     506:	e8 95 01 00 00       	call   6a0 <futex>
+     50b:	83 c4 10             	add    $0x10,%esp
+     50e:	eb c7                	jmp    4d7 <cond_wait+0x17>
+
+00000510 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+     510:	55                   	push   %ebp
+     511:	89 e5                	mov    %esp,%ebp
+     513:	83 ec 0c             	sub    $0xc,%esp
+     516:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     519:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+     51d:	6a 01                	push   $0x1
+     51f:	6a 01                	push   $0x1
+     521:	50                   	push   %eax
+     522:	e8 79 01 00 00       	call   6a0 <futex>
+}
+     527:	83 c4 10             	add    $0x10,%esp
+     52a:	c9                   	leave
+     52b:	c3                   	ret
+     52c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000530 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     530:	55                   	push   %ebp
+     531:	89 e5                	mov    %esp,%ebp
+     533:	83 ec 0c             	sub    $0xc,%esp
+     536:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     539:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+     53d:	6a 40                	push   $0x40
+     53f:	6a 01                	push   $0x1
+     541:	50                   	push   %eax
+     542:	e8 59 01 00 00       	call   6a0 <futex>
+}
+     547:	83 c4 10             	add    $0x10,%esp
+     54a:	c9                   	leave
+     54b:	c3                   	ret
+     54c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <uptime>:
+// Clock ticks since boot, read from the kernel's vdso page
+// without a system call.
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     550:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+     555:	c3                   	ret
+
+00000556 <sysfork>:
+  1: ret
+
+#define SYSCALL(name) SYSCALLAS(name, name)
+
+// ulib.c wraps these.
+SYSCALLAS(sysfork, fork)
+     556:	b8 01 00 00 00       	mov    $0x1,%eax
+     55b:	89 e1                	mov    %esp,%ecx
+     55d:	ba 64 05 00 00       	mov    $0x564,%edx
+     562:	0f 34                	sysenter
+     564:	c3                   	ret
+
+00000565 <sysexit>:
+SYSCALLAS(sysexit, exit)
+     565:	b8 02 00 00 00       	mov    $0x2,%eax
+     56a:	89 e1                	mov    %esp,%ecx
+     56c:	ba 73 05 00 00       	mov    $0x573,%edx
+     571:	0f 34                	sysenter
+     573:	c3                   	ret
+
+00000574 <wait>:
+SYSCALL(wait)
+     574:	b8 03 00 00 00       	mov    $0x3,%eax
+     579:	89 e1                	mov    %esp,%ecx
+     57b:	ba 82 05 00 00       	mov    $0x582,%edx
+     580:	0f 34                	sysenter
+     582:	c3                   	ret
+
+00000583 <pipe>:
+SYSCALL(pipe)
+     583:	b8 04 00 00 00       	mov    $0x4,%eax
+     588:	89 e1                	mov    %esp,%ecx
+     58a:	ba 91 05 00 00       	mov    $0x591,%edx
+     58f:	0f 34                	sysenter
+     591:	c3                   	ret
+
+00000592 <read>:
+SYSCALL(read)
+     592:	b8 05 00 00 00       	mov    $0x5,%eax
+     597:	89 e1                	mov    %esp,%ecx
+     599:	ba a0 05 00 00       	mov    $0x5a0,%edx
+     59e:	0f 34                	sysenter
+     5a0:	c3                   	ret
+
+000005a1 <write>:
+SYSCALL(write)
+     5a1:	b8 10 00 00 00       	mov    $0x10,%eax
+     5a6:	89 e1                	mov    %esp,%ecx
+     5a8:	ba af 05 00 00       	mov    $0x5af,%edx
+     5ad:	0f 34                	sysenter
+     5af:	c3                   	ret
+
+000005b0 <close>:
+SYSCALL(close)
+     5b0:	b8 15 00 00 00       	mov    $0x15,%eax
+     5b5:	89 e1                	mov    %esp,%ecx
+     5b7:	ba be 05 00 00       	mov    $0x5be,%edx
+     5bc:	0f 34                	sysenter
+     5be:	c3                   	ret
+
+000005bf <kill>:
+SYSCALL(kill)
+     5bf:	b8 06 00 00 00       	mov    $0x6,%eax
+     5c4:	89 e1                	mov    %esp,%ecx
+     5c6:	ba cd 05 00 00       	mov    $0x5cd,%edx
+     5cb:	0f 34                	sysenter
+     5cd:	c3                   	ret
+
+000005ce <sysexec>:
+SYSCALLAS(sysexec, exec)
+     5ce:	b8 07 00 00 00       	mov    $0x7,%eax
+     5d3:	89 e1                	mov    %esp,%ecx
+     5d5:	ba dc 05 00 00       	mov    $0x5dc,%edx
+     5da:	0f 34                	sysenter
+     5dc:	c3                   	ret
+
+000005dd <open>:
+SYSCALL(open)
+     5dd:	b8 0f 00 00 00       	mov    $0xf,%eax
+     5e2:	89 e1                	mov    %esp,%ecx
+     5e4:	ba eb 05 00 00       	mov    $0x5eb,%edx
+     5e9:	0f 34                	sysenter
+     5eb:	c3                   	ret
+
+000005ec <mknod>:
+SYSCALL(mknod)
+     5ec:	b8 11 00 00 00       	mov    $0x11,%eax
+     5f1:	89 e1                	mov    %esp,%ecx
+     5f3:	ba fa 05 00 00       	mov    $0x5fa,%edx
+     5f8:	0f 34                	sysenter
+     5fa:	c3                   	ret
+
+000005fb <unlink>:
+SYSCALL(unlink)
+     5fb:	b8 12 00 00 00       	mov    $0x12,%eax
+     600:	89 e1                	mov    %esp,%ecx
+     602:	ba 09 06 00 00       	mov    $0x609,%edx
+     607:	0f 34                	sysenter
+     609:	c3                   	ret
+
+0000060a <fstat>:
+SYSCALL(fstat)
+     60a:	b8 08 00 00 00       	mov    $0x8,%eax
+     60f:	89 e1                	mov    %esp,%ecx
+     611:	ba 18 06 00 00       	mov    $0x618,%edx
+     616:	0f 34                	sysenter
+     618:	c3                   	ret
+
+00000619 <link>:
+SYSCALL(link)
+     619:	b8 13 00 00 00       	mov    $0x13,%eax
+     61e:	89 e1                	mov    %esp,%ecx
+     620:	ba 27 06 00 00       	mov    $0x627,%edx
+     625:	0f 34                	sysenter
+     627:	c3                   	ret
+
+00000628 <mkdir>:
+SYSCALL(mkdir)
+     628:	b8 14 00 00 00       	mov    $0x14,%eax
+     62d:	89 e1                	mov    %esp,%ecx
+     62f:	ba 36 06 00 00       	mov    $0x636,%edx
+     634:	0f 34                	sysenter
+     636:	c3                   	ret
+
+00000637 <chdir>:
+SYSCALL(chdir)
+     637:	b8 09 00 00 00       	mov    $0x9,%eax
+     63c:	89 e1                	mov    %esp,%ecx
+     63e:	ba 45 06 00 00       	mov    $0x645,%edx
+     643:	0f 34                	sysenter
+     645:	c3                   	ret
+
+00000646 <dup>:
+SYSCALL(dup)
+     646:	b8 0a 00 00 00       	mov    $0xa,%eax
+     64b:	89 e1                	mov    %esp,%ecx
+     64d:	ba 54 06 00 00       	mov    $0x654,%edx
+     652:	0f 34                	sysenter
+     654:	c3                   	ret
+
+00000655 <getpid>:
+SYSCALL(getpid)
+     655:	b8 0b 00 00 00       	mov    $0xb,%eax
+     65a:	89 e1                	mov    %esp,%ecx
+     65c:	ba 63 06 00 00       	mov    $0x663,%edx
+     661:	0f 34                	sysenter
+     663:	c3                   	ret
+
+00000664 <sbrk>:
+SYSCALL(sbrk)
+     664:	b8 0c 00 00 00       	mov    $0xc,%eax
+     669:	89 e1                	mov    %esp,%ecx
+     66b:	ba 72 06 00 00       	mov    $0x672,%edx
+     670:	0f 34                	sysenter
+     672:	c3                   	ret
+
+00000673 <sleep>:
+SYSCALL(sleep)
+     673:	b8 0d 00 00 00       	mov    $0xd,%eax
+     678:	89 e1                	mov    %esp,%ecx
+     67a:	ba 81 06 00 00       	mov    $0x681,%edx
+     67f:	0f 34                	sysenter
+     681:	c3                   	ret
+
+00000682 <clone>:
+SYSCALL(clone)
+     682:	b8 16 00 00 00       	mov    $0x16,%eax
+     687:	89 e1                	mov    %esp,%ecx
+     689:	ba 90 06 00 00       	mov    $0x690,%edx
+     68e:	0f 34                	sysenter
+     690:	c3                   	ret
+
+00000691 <join>:
+SYSCALL(join)
+     691:	b8 17 00 00 00       	mov    $0x17,%eax
+     696:	89 e1                	mov    %esp,%ecx
+     698:	ba 9f 06 00 00       	mov    $0x69f,%edx
+     69d:	0f 34                	sysenter
+     69f:	c3                   	ret
+
+000006a0 <futex>:
+SYSCALL(futex)
+     6a0:	b8 18 00 00 00       	mov    $0x18,%eax
+     6a5:	89 e1                	mov    %esp,%ecx
+     6a7:	ba ae 06 00 00       	mov    $0x6ae,%edx
+     6ac:	0f 34                	sysenter
+     6ae:	c3                   	ret
+
+000006af <yield>:
+SYSCALL(yield)
+     6af:	b8 19 00 00 00       	mov    $0x19,%eax
+     6b4:	89 e1                	mov    %esp,%ecx
+     6b6:	ba bd 06 00 00       	mov    $0x6bd,%edx
+     6bb:	0f 34                	sysenter
+     6bd:	c3                   	ret
+
+000006be <lockstat>:
+SYSCALL(lockstat)
+     6be:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     6c3:	89 e1                	mov    %esp,%ecx
+     6c5:	ba cc 06 00 00       	mov    $0x6cc,%edx
+     6ca:	0f 34                	sysenter
+     6cc:	c3                   	ret
+
+000006cd <lockhammer>:
+SYSCALL(lockhammer)
+     6cd:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     6d2:	89 e1                	mov    %esp,%ecx
+     6d4:	ba db 06 00 00       	mov    $0x6db,%edx
+     6d9:	0f 34                	sysenter
+     6db:	c3                   	ret
+
+000006dc <vmsplice>:
+SYSCALL(vmsplice)
+     6dc:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     6e1:	89 e1                	mov    %esp,%ecx
+     6e3:	ba ea 06 00 00       	mov    $0x6ea,%edx
+     6e8:	0f 34                	sysenter
+     6ea:	c3                   	ret
+
+000006eb <hsbrk>:
+SYSCALL(hsbrk)
+     6eb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     6f0:	89 e1                	mov    %esp,%ecx
+     6f2:	ba f9 06 00 00       	mov    $0x6f9,%edx
+     6f7:	0f 34                	sysenter
+     6f9:	c3                   	ret
+
+000006fa <mmap>:
+SYSCALL(mmap)
+     6fa:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     6ff:	89 e1                	mov    %esp,%ecx
+     701:	ba 08 07 00 00       	mov    $0x708,%edx
+     706:	0f 34                	sysenter
+     708:	c3                   	ret
+
+00000709 <munmap>:
+SYSCALL(munmap)
+     709:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     70e:	89 e1                	mov    %esp,%ecx
+     710:	ba 17 07 00 00       	mov    $0x717,%edx
+     715:	0f 34                	sysenter
+     717:	c3                   	ret
+
+00000718 <ringenter>:
+SYSCALL(ringenter)
+     718:	b8 20 00 00 00       	mov    $0x20,%eax
+     71d:	89 e1                	mov    %esp,%ecx
+     71f:	ba 26 07 00 00       	mov    $0x726,%edx
+     724:	0f 34                	sysenter
+     726:	c3                   	ret
+
+00000727 <readv>:
+SYSCALL(readv)
+     727:	b8 21 00 00 00       	mov    $0x21,%eax
+     72c:	89 e1                	mov    %esp,%ecx
+     72e:	ba 35 07 00 00       	mov    $0x735,%edx
+     733:	0f 34                	sysenter
+     735:	c3                   	ret
+
+00000736 <writev>:
+SYSCALL(writev)
+     736:	b8 22 00 00 00       	mov    $0x22,%eax
+     73b:	89 e1                	mov    %esp,%ecx
+     73d:	ba 44 07 00 00       	mov    $0x744,%edx
+     742:	0f 34                	sysenter
+     744:	c3                   	ret
+
+00000745 <pread>:
+SYSCALL(pread)
+     745:	b8 23 00 00 00       	mov    $0x23,%eax
+     74a:	89 e1                	mov    %esp,%ecx
+     74c:	ba 53 07 00 00       	mov    $0x753,%edx
+     751:	0f 34                	sysenter
+     753:	c3                   	ret
+
+00000754 <pwrite>:
+SYSCALL(pwrite)
+     754:	b8 24 00 00 00       	mov    $0x24,%eax
+     759:	89 e1                	mov    %esp,%ecx
+     75b:	ba 62 07 00 00       	mov    $0x762,%edx
+     760:	0f 34                	sysenter
+     762:	c3                   	ret
+
+00000763 <prof>:
+SYSCALL(prof)
+     763:	b8 25 00 00 00       	mov    $0x25,%eax
+     768:	89 e1                	mov    %esp,%ecx
+     76a:	ba 71 07 00 00       	mov    $0x771,%edx
+     76f:	0f 34                	sysenter
+     771:	c3                   	ret
+
+00000772 <scstat>:
+SYSCALL(scstat)
+     772:	b8 26 00 00 00       	mov    $0x26,%eax
+     777:	89 e1                	mov    %esp,%ecx
+     779:	ba 80 07 00 00       	mov    $0x780,%edx
+     77e:	0f 34                	sysenter
+     780:	c3                   	ret
+     781:	66 90                	xchg   %ax,%ax
+     783:	66 90                	xchg   %ax,%ax
+     785:	66 90                	xchg   %ax,%ax
+     787:	66 90                	xchg   %ax,%ax
+     789:	66 90                	xchg   %ax,%ax
+     78b:	66 90                	xchg   %ax,%ax
+     78d:	66 90                	xchg   %ax,%ax
+     78f:	90                   	nop
+
+00000790 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+     790:	55                   	push   %ebp
+     791:	89 e5                	mov    %esp,%ebp
+     793:	57                   	push   %edi
+     794:	56                   	push   %esi
+     795:	53                   	push   %ebx
+     796:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     798:	89 d1                	mov    %edx,%ecx
+{
+     79a:	83 ec 2c             	sub    $0x2c,%esp
+     79d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+     7a0:	85 d2                	test   %edx,%edx
+     7a2:	79 7c                	jns    820 <printint+0x90>
+     7a4:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     7a8:	74 76                	je     820 <printint+0x90>
+    x = -xx;
+     7aa:	f7 d9                	neg    %ecx
+    neg = 1;
+     7ac:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     7b1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     7b4:	31 f6                	xor    %esi,%esi
+     7b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7bd:	8d 76 00             	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     7c0:	89 c8                	mov    %ecx,%eax
+     7c2:	31 d2                	xor    %edx,%edx
+     7c4:	89 f7                	mov    %esi,%edi
+     7c6:	f7 f3                	div    %ebx
+     7c8:	8d 76 01             	lea    0x1(%esi),%esi
+     7cb:	0f b6 92 50 1f 00 00 	movzbl 0x1f50(%edx),%edx
+     7d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     7d6:	89 ca                	mov    %ecx,%edx
+     7d8:	89 c1                	mov    %eax,%ecx
+     7da:	39 da                	cmp    %ebx,%edx
+     7dc:	73 e2                	jae    7c0 <printint+0x30>
+  if(neg)
+     7de:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     7e1:	85 c0                	test   %eax,%eax
+     7e3:	74 07                	je     7ec <printint+0x5c>
+    buf[i++] = '-';
+     7e5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     7ea:	89 f7                	mov    %esi,%edi
+     7ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     7ef:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     7f2:	01 df                	add    %ebx,%edi
+     7f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc_unlocked(buf[i], f);
+     7f8:	83 ec 08             	sub    $0x8,%esp
+     7fb:	56                   	push   %esi
+     7fc:	0f be 07             	movsbl (%edi),%eax
+     7ff:	50                   	push   %eax
+     800:	e8 cb 07 00 00       	call   fd0 <putc_unlocked>
+  while(--i >= 0)
+     805:	89 f8                	mov    %edi,%eax
+     807:	83 c4 10             	add    $0x10,%esp
+     80a:	83 ef 01             	sub    $0x1,%edi
+     80d:	39 d8                	cmp    %ebx,%eax
+     80f:	75 e7                	jne    7f8 <printint+0x68>
+}
+     811:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     814:	5b                   	pop    %ebx
+     815:	5e                   	pop    %esi
+     816:	5f                   	pop    %edi
+     817:	5d                   	pop    %ebp
+     818:	c3                   	ret
+     819:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     820:	31 c0                	xor    %eax,%eax
+     822:	eb 8d                	jmp    7b1 <printint+0x21>
+     824:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     82b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     82f:	90                   	nop
+
+00000830 <vfprintf>:
+
+// Print to the given stream, which the caller has locked.
+// Only understands %d, %x, %p, %s.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+     830:	55                   	push   %ebp
+     831:	89 e5                	mov    %esp,%ebp
+     833:	57                   	push   %edi
+     834:	56                   	push   %esi
+     835:	53                   	push   %ebx
+     836:	83 ec 1c             	sub    $0x1c,%esp
+     839:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     83c:	0f b6 0a             	movzbl (%edx),%ecx
+     83f:	84 c9                	test   %cl,%cl
+     841:	74 5c                	je     89f <vfprintf+0x6f>
+     843:	89 c6                	mov    %eax,%esi
+     845:	8d 5a 01             	lea    0x1(%edx),%ebx
+     848:	31 ff                	xor    %edi,%edi
+     84a:	eb 20                	jmp    86c <vfprintf+0x3c>
+     84c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     850:	83 f9 25             	cmp    $0x25,%ecx
+     853:	74 3b                	je     890 <vfprintf+0x60>
+        state = '%';
+      } else {
+        putc_unlocked(c, f);
+     855:	83 ec 08             	sub    $0x8,%esp
+     858:	56                   	push   %esi
+     859:	51                   	push   %ecx
+     85a:	e8 71 07 00 00       	call   fd0 <putc_unlocked>
+     85f:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     862:	0f b6 0b             	movzbl (%ebx),%ecx
+     865:	83 c3 01             	add    $0x1,%ebx
+     868:	84 c9                	test   %cl,%cl
+     86a:	74 33                	je     89f <vfprintf+0x6f>
+    if(state == 0){
+     86c:	85 ff                	test   %edi,%edi
+     86e:	74 e0                	je     850 <vfprintf+0x20>
+      }
+    } else if(state == '%'){
+     870:	83 ff 25             	cmp    $0x25,%edi
+     873:	75 ed                	jne    862 <vfprintf+0x32>
+      if(c == 'd'){
+     875:	83 f9 25             	cmp    $0x25,%ecx
+     878:	0f 84 02 01 00 00    	je     980 <vfprintf+0x150>
+     87e:	8d 41 9d             	lea    -0x63(%ecx),%eax
+     881:	83 f8 15             	cmp    $0x15,%eax
+     884:	77 2a                	ja     8b0 <vfprintf+0x80>
+     886:	ff 24 85 f8 1e 00 00 	jmp    *0x1ef8(,%eax,4)
+     88d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     890:	0f b6 0b             	movzbl (%ebx),%ecx
+     893:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     896:	bf 25 00 00 00       	mov    $0x25,%edi
+  for(i = 0; fmt[i]; i++){
+     89b:	84 c9                	test   %cl,%cl
+     89d:	75 cd                	jne    86c <vfprintf+0x3c>
+        putc_unlocked(c, f);
+      }
+      state = 0;
+    }
+  }
+}
+     89f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8a2:	5b                   	pop    %ebx
+     8a3:	5e                   	pop    %esi
+     8a4:	5f                   	pop    %edi
+     8a5:	5d                   	pop    %ebp
+     8a6:	c3                   	ret
+     8a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ae:	66 90                	xchg   %ax,%ax
+        putc_unlocked('%', f);
+     8b0:	83 ec 08             	sub    $0x8,%esp
+     8b3:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     8b6:	56                   	push   %esi
+     8b7:	6a 25                	push   $0x25
+     8b9:	e8 12 07 00 00       	call   fd0 <putc_unlocked>
+        putc_unlocked(c, f);
+     8be:	58                   	pop    %eax
+     8bf:	5a                   	pop    %edx
+     8c0:	56                   	push   %esi
+     8c1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     8c4:	51                   	push   %ecx
+     8c5:	e8 06 07 00 00       	call   fd0 <putc_unlocked>
+     8ca:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     8cd:	31 ff                	xor    %edi,%edi
+     8cf:	eb 91                	jmp    862 <vfprintf+0x32>
+     8d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+     8d8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     8db:	83 ec 0c             	sub    $0xc,%esp
+     8de:	b9 10 00 00 00       	mov    $0x10,%ecx
+     8e3:	8b 17                	mov    (%edi),%edx
+     8e5:	6a 00                	push   $0x0
+        ap++;
+     8e7:	83 c7 04             	add    $0x4,%edi
+        printint(f, *ap, 16, 0);
+     8ea:	89 f0                	mov    %esi,%eax
+     8ec:	e8 9f fe ff ff       	call   790 <printint>
+        ap++;
+     8f1:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     8f4:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     8f7:	31 ff                	xor    %edi,%edi
+     8f9:	e9 64 ff ff ff       	jmp    862 <vfprintf+0x32>
+     8fe:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     900:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     903:	8b 10                	mov    (%eax),%edx
+        ap++;
+     905:	83 c0 04             	add    $0x4,%eax
+     908:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     90b:	85 d2                	test   %edx,%edx
+     90d:	0f 84 85 00 00 00    	je     998 <vfprintf+0x168>
+        while(*s != 0){
+     913:	0f be 02             	movsbl (%edx),%eax
+        s = (char*)*ap;
+     916:	89 d7                	mov    %edx,%edi
+        while(*s != 0){
+     918:	84 c0                	test   %al,%al
+     91a:	74 b1                	je     8cd <vfprintf+0x9d>
+     91c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+          putc_unlocked(*s, f);
+     920:	83 ec 08             	sub    $0x8,%esp
+          s++;
+     923:	83 c7 01             	add    $0x1,%edi
+          putc_unlocked(*s, f);
+     926:	56                   	push   %esi
+     927:	50                   	push   %eax
+     928:	e8 a3 06 00 00       	call   fd0 <putc_unlocked>
+        while(*s != 0){
+     92d:	0f be 07             	movsbl (%edi),%eax
+     930:	83 c4 10             	add    $0x10,%esp
+     933:	84 c0                	test   %al,%al
+     935:	75 e9                	jne    920 <vfprintf+0xf0>
+      state = 0;
+     937:	31 ff                	xor    %edi,%edi
+     939:	e9 24 ff ff ff       	jmp    862 <vfprintf+0x32>
+     93e:	66 90                	xchg   %ax,%ax
+        printint(f, *ap, 10, 1);
+     940:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     943:	83 ec 0c             	sub    $0xc,%esp
+     946:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     94b:	8b 17                	mov    (%edi),%edx
+     94d:	6a 01                	push   $0x1
+     94f:	eb 96                	jmp    8e7 <vfprintf+0xb7>
+     951:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc_unlocked(*ap, f);
+     958:	83 ec 08             	sub    $0x8,%esp
+     95b:	56                   	push   %esi
+     95c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     95f:	ff 37                	push   (%edi)
+     961:	e8 6a 06 00 00       	call   fd0 <putc_unlocked>
+        ap++;
+     966:	89 f8                	mov    %edi,%eax
+     968:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     96b:	31 ff                	xor    %edi,%edi
+        ap++;
+     96d:	83 c0 04             	add    $0x4,%eax
+     970:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     973:	e9 ea fe ff ff       	jmp    862 <vfprintf+0x32>
+     978:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     97f:	90                   	nop
+        putc_unlocked(c, f);
+     980:	83 ec 08             	sub    $0x8,%esp
+      state = 0;
+     983:	31 ff                	xor    %edi,%edi
+        putc_unlocked(c, f);
+     985:	56                   	push   %esi
+     986:	6a 25                	push   $0x25
+     988:	e8 43 06 00 00       	call   fd0 <putc_unlocked>
+     98d:	83 c4 10             	add    $0x10,%esp
+     990:	e9 cd fe ff ff       	jmp    862 <vfprintf+0x32>
+     995:	8d 76 00             	lea    0x0(%esi),%esi
+     998:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     99d:	bf ee 1e 00 00       	mov    $0x1eee,%edi
+     9a2:	e9 79 ff ff ff       	jmp    920 <vfprintf+0xf0>
+     9a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9ae:	66 90                	xchg   %ax,%ax
+
+000009b0 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+     9b0:	55                   	push   %ebp
+     9b1:	89 e5                	mov    %esp,%ebp
+     9b3:	53                   	push   %ebx
+     9b4:	83 ec 10             	sub    $0x10,%esp
+     9b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  flockfile(f);
+     9ba:	53                   	push   %ebx
+     9bb:	e8 d0 02 00 00       	call   c90 <flockfile>
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     9c0:	8b 55 0c             	mov    0xc(%ebp),%edx
+     9c3:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     9c6:	89 d8                	mov    %ebx,%eax
+     9c8:	e8 63 fe ff ff       	call   830 <vfprintf>
+  funlockfile(f);
+     9cd:	89 1c 24             	mov    %ebx,(%esp)
+     9d0:	e8 eb 02 00 00       	call   cc0 <funlockfile>
+}
+     9d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9d8:	83 c4 10             	add    $0x10,%esp
+     9db:	c9                   	leave
+     9dc:	c3                   	ret
+     9dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009e0 <printf>:
+
+// Print to the given fd: through stdout or stderr for 1 and 2,
+// otherwise with one write() per call.
+void
+printf(int fd, const char *fmt, ...)
+{
+     9e0:	55                   	push   %ebp
+     9e1:	89 e5                	mov    %esp,%ebp
+     9e3:	56                   	push   %esi
+     9e4:	53                   	push   %ebx
+     9e5:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+     9eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  char buf[128];
+  struct iobuf f;
+
+  if(fd == 1 || fd == 2){
+    flockfile(&_iob[fd]);
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     9ee:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(fd == 1 || fd == 2){
+     9f1:	8d 50 ff             	lea    -0x1(%eax),%edx
+     9f4:	83 fa 01             	cmp    $0x1,%edx
+     9f7:	76 77                	jbe    a70 <printf+0x90>
+    funlockfile(&_iob[fd]);
+    return;
+  }
+  f.fd = fd;
+     9f9:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  f.flags = IO_WRITE|IO_SETUP;
+  f.buf = buf;
+     9ff:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  f.size = sizeof(buf);
+  f.r = f.n = 0;
+  mutex_init(&f.lock);
+     a05:	83 ec 0c             	sub    $0xc,%esp
+     a08:	8d 9d 5c ff ff ff    	lea    -0xa4(%ebp),%ebx
+  f.buf = buf;
+     a0e:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+  mutex_init(&f.lock);
+     a14:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  f.flags = IO_WRITE|IO_SETUP;
+     a1a:	c7 85 60 ff ff ff 42 	movl   $0x42,-0xa0(%ebp)
+     a21:	00 00 00 
+  f.size = sizeof(buf);
+     a24:	c7 85 68 ff ff ff 80 	movl   $0x80,-0x98(%ebp)
+     a2b:	00 00 00 
+  f.r = f.n = 0;
+     a2e:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+     a35:	00 00 00 
+     a38:	c7 85 6c ff ff ff 00 	movl   $0x0,-0x94(%ebp)
+     a3f:	00 00 00 
+  mutex_init(&f.lock);
+     a42:	50                   	push   %eax
+     a43:	e8 d8 f9 ff ff       	call   420 <mutex_init>
+  vfprintf(&f, fmt, (uint*)(void*)&fmt + 1);
+     a48:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     a4b:	89 f2                	mov    %esi,%edx
+     a4d:	89 d8                	mov    %ebx,%eax
+     a4f:	e8 dc fd ff ff       	call   830 <vfprintf>
+  fflush(&f);
+     a54:	89 1c 24             	mov    %ebx,(%esp)
+     a57:	e8 f4 04 00 00       	call   f50 <fflush>
+     a5c:	83 c4 10             	add    $0x10,%esp
+}
+     a5f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     a62:	5b                   	pop    %ebx
+     a63:	5e                   	pop    %esi
+     a64:	5d                   	pop    %ebp
+     a65:	c3                   	ret
+     a66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a6d:	8d 76 00             	lea    0x0(%esi),%esi
+    flockfile(&_iob[fd]);
+     a70:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     a73:	83 ec 0c             	sub    $0xc,%esp
+     a76:	8d 98 e0 28 00 00    	lea    0x28e0(%eax),%ebx
+     a7c:	53                   	push   %ebx
+     a7d:	e8 0e 02 00 00       	call   c90 <flockfile>
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     a82:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     a85:	89 f2                	mov    %esi,%edx
+     a87:	89 d8                	mov    %ebx,%eax
+     a89:	e8 a2 fd ff ff       	call   830 <vfprintf>
+    funlockfile(&_iob[fd]);
+     a8e:	89 1c 24             	mov    %ebx,(%esp)
+     a91:	e8 2a 02 00 00       	call   cc0 <funlockfile>
+     a96:	83 c4 10             	add    $0x10,%esp
+}
+     a99:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     a9c:	5b                   	pop    %ebx
+     a9d:	5e                   	pop    %esi
+     a9e:	5d                   	pop    %ebp
+     a9f:	c3                   	ret
+
+00000aa0 <setup>:
+}
+
+// Choose how to buffer f on first use: by lines on a device.
+static void
+setup(FILE *f)
+{
+     aa0:	55                   	push   %ebp
+     aa1:	89 e5                	mov    %esp,%ebp
+     aa3:	53                   	push   %ebx
+     aa4:	89 c3                	mov    %eax,%ebx
+     aa6:	83 ec 2c             	sub    $0x2c,%esp
+  struct stat st;
+
+  f->flags |= IO_SETUP;
+     aa9:	83 48 04 40          	orl    $0x40,0x4(%eax)
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     aad:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     ab0:	50                   	push   %eax
+     ab1:	ff 33                	push   (%ebx)
+     ab3:	e8 52 fb ff ff       	call   60a <fstat>
+     ab8:	83 c4 10             	add    $0x10,%esp
+     abb:	85 c0                	test   %eax,%eax
+    f->flags |= IO_DEV|IO_LINE;
+     abd:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     ac0:	75 07                	jne    ac9 <setup+0x29>
+     ac2:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+     ac7:	74 17                	je     ae0 <setup+0x40>
+  if(f->flags & IO_WRITE)
+     ac9:	a8 02                	test   $0x2,%al
+     acb:	74 0a                	je     ad7 <setup+0x37>
+    flushhook = flushall;
+     acd:	c7 05 c0 30 00 00 00 	movl   $0xc00,0x30c0
+     ad4:	0c 00 00 
+}
+     ad7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ada:	c9                   	leave
+     adb:	c3                   	ret
+     adc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    f->flags |= IO_DEV|IO_LINE;
+     ae0:	83 c8 30             	or     $0x30,%eax
+     ae3:	89 43 04             	mov    %eax,0x4(%ebx)
+     ae6:	eb e1                	jmp    ac9 <setup+0x29>
+     ae8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aef:	90                   	nop
+
+00000af0 <flush>:
+static int
+flush(FILE *f)
+{
+  int i, n;
+
+  if(!(f->flags & IO_WRITE))
+     af0:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+     af4:	74 6a                	je     b60 <flush+0x70>
+{
+     af6:	55                   	push   %ebp
+     af7:	89 e5                	mov    %esp,%ebp
+     af9:	56                   	push   %esi
+     afa:	89 c6                	mov    %eax,%esi
+     afc:	53                   	push   %ebx
+    return 0;
+  for(i = 0; i < f->n; i += n){
+     afd:	8b 40 14             	mov    0x14(%eax),%eax
+     b00:	85 c0                	test   %eax,%eax
+     b02:	7e 4c                	jle    b50 <flush+0x60>
+     b04:	31 db                	xor    %ebx,%ebx
+     b06:	eb 11                	jmp    b19 <flush+0x29>
+     b08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b0f:	90                   	nop
+     b10:	01 c3                	add    %eax,%ebx
+     b12:	8b 46 14             	mov    0x14(%esi),%eax
+     b15:	39 d8                	cmp    %ebx,%eax
+     b17:	7e 37                	jle    b50 <flush+0x60>
+    if((n = write(f->fd, f->buf + i, f->n - i)) <= 0){
+     b19:	83 ec 04             	sub    $0x4,%esp
+     b1c:	29 d8                	sub    %ebx,%eax
+     b1e:	50                   	push   %eax
+     b1f:	8b 46 08             	mov    0x8(%esi),%eax
+     b22:	01 d8                	add    %ebx,%eax
+     b24:	50                   	push   %eax
+     b25:	ff 36                	push   (%esi)
+     b27:	e8 75 fa ff ff       	call   5a1 <write>
+     b2c:	83 c4 10             	add    $0x10,%esp
+     b2f:	85 c0                	test   %eax,%eax
+     b31:	7f dd                	jg     b10 <flush+0x20>
+      f->flags |= IO_ERR;
+     b33:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+      f->n = 0;
+     b37:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     b3c:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+      return EOF;
+    }
+  }
+  f->n = 0;
+  return 0;
+}
+     b43:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b46:	5b                   	pop    %ebx
+     b47:	5e                   	pop    %esi
+     b48:	5d                   	pop    %ebp
+     b49:	c3                   	ret
+     b4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->n = 0;
+     b50:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+}
+     b57:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+     b5a:	31 c0                	xor    %eax,%eax
+}
+     b5c:	5b                   	pop    %ebx
+     b5d:	5e                   	pop    %esi
+     b5e:	5d                   	pop    %ebp
+     b5f:	c3                   	ret
+    return 0;
+     b60:	31 c0                	xor    %eax,%eax
+}
+     b62:	c3                   	ret
+     b63:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000b70 <fflush.part.0>:
+fflush(FILE *f)
+     b70:	55                   	push   %ebp
+     b71:	89 e5                	mov    %esp,%ebp
+     b73:	57                   	push   %edi
+     b74:	bf d8 29 00 00       	mov    $0x29d8,%edi
+     b79:	56                   	push   %esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     b7a:	31 f6                	xor    %esi,%esi
+fflush(FILE *f)
+     b7c:	53                   	push   %ebx
+     b7d:	bb f8 28 00 00       	mov    $0x28f8,%ebx
+     b82:	83 ec 1c             	sub    $0x1c,%esp
+     b85:	eb 10                	jmp    b97 <fflush.part.0+0x27>
+     b87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b8e:	66 90                	xchg   %ax,%ax
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     b90:	83 c3 1c             	add    $0x1c,%ebx
+     b93:	39 df                	cmp    %ebx,%edi
+     b95:	74 33                	je     bca <fflush.part.0+0x5a>
+      if((f->flags & IO_WRITE) && fflush(f) < 0)
+     b97:	f6 43 ec 02          	testb  $0x2,-0x14(%ebx)
+     b9b:	74 f3                	je     b90 <fflush.part.0+0x20>
+  if(threaded)
+     b9d:	8b 0d e0 30 00 00    	mov    0x30e0,%ecx
+     ba3:	85 c9                	test   %ecx,%ecx
+     ba5:	75 49                	jne    bf0 <fflush.part.0+0x80>
+  r = flush(f);
+     ba7:	8d 43 e8             	lea    -0x18(%ebx),%eax
+     baa:	e8 41 ff ff ff       	call   af0 <flush>
+  if(threaded)
+     baf:	8b 15 e0 30 00 00    	mov    0x30e0,%edx
+     bb5:	85 d2                	test   %edx,%edx
+     bb7:	75 1f                	jne    bd8 <fflush.part.0+0x68>
+        r = EOF;
+     bb9:	85 c0                	test   %eax,%eax
+     bbb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     bc0:	0f 48 f0             	cmovs  %eax,%esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     bc3:	83 c3 1c             	add    $0x1c,%ebx
+     bc6:	39 df                	cmp    %ebx,%edi
+     bc8:	75 cd                	jne    b97 <fflush.part.0+0x27>
+}
+     bca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bcd:	89 f0                	mov    %esi,%eax
+     bcf:	5b                   	pop    %ebx
+     bd0:	5e                   	pop    %esi
+     bd1:	5f                   	pop    %edi
+     bd2:	5d                   	pop    %ebp
+     bd3:	c3                   	ret
+     bd4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     bd8:	83 ec 0c             	sub    $0xc,%esp
+     bdb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     bde:	53                   	push   %ebx
+     bdf:	e8 9c f8 ff ff       	call   480 <mutex_unlock>
+     be4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     be7:	83 c4 10             	add    $0x10,%esp
+     bea:	eb cd                	jmp    bb9 <fflush.part.0+0x49>
+     bec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     bf0:	83 ec 0c             	sub    $0xc,%esp
+     bf3:	53                   	push   %ebx
+     bf4:	e8 37 f8 ff ff       	call   430 <mutex_lock>
+     bf9:	83 c4 10             	add    $0x10,%esp
+     bfc:	eb a9                	jmp    ba7 <fflush.part.0+0x37>
+     bfe:	66 90                	xchg   %ax,%ax
+
+00000c00 <flushall>:
+  if(f == 0){
+     c00:	e9 6b ff ff ff       	jmp    b70 <fflush.part.0>
+     c05:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c10 <fill>:
+
+// Refill f's buffer. Returns the number of bytes read.
+// Caller holds f's lock.
+static int
+fill(FILE *f)
+{
+     c10:	55                   	push   %ebp
+     c11:	89 e5                	mov    %esp,%ebp
+     c13:	53                   	push   %ebx
+     c14:	89 c3                	mov    %eax,%ebx
+     c16:	83 ec 04             	sub    $0x4,%esp
+  int n;
+
+  if(!(f->flags & IO_SETUP))
+     c19:	8b 40 04             	mov    0x4(%eax),%eax
+     c1c:	a8 40                	test   $0x40,%al
+     c1e:	74 50                	je     c70 <fill+0x60>
+    setup(f);
+  if(f->flags & IO_DEV)
+     c20:	a8 20                	test   $0x20,%al
+     c22:	75 3c                	jne    c60 <fill+0x50>
+    fflush(0);
+  f->r = 0;
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     c24:	83 ec 04             	sub    $0x4,%esp
+  f->r = 0;
+     c27:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     c2e:	ff 73 0c             	push   0xc(%ebx)
+     c31:	ff 73 08             	push   0x8(%ebx)
+     c34:	ff 33                	push   (%ebx)
+     c36:	e8 57 f9 ff ff       	call   592 <read>
+     c3b:	83 c4 10             	add    $0x10,%esp
+     c3e:	85 c0                	test   %eax,%eax
+     c40:	7f 10                	jg     c52 <fill+0x42>
+    f->flags |= n < 0 ? IO_ERR : IO_EOF;
+     c42:	83 f8 01             	cmp    $0x1,%eax
+     c45:	19 c0                	sbb    %eax,%eax
+     c47:	83 e0 fc             	and    $0xfffffffc,%eax
+     c4a:	83 c0 08             	add    $0x8,%eax
+     c4d:	09 43 04             	or     %eax,0x4(%ebx)
+    n = 0;
+     c50:	31 c0                	xor    %eax,%eax
+  }
+  f->n = n;
+     c52:	89 43 14             	mov    %eax,0x14(%ebx)
+  return n;
+}
+     c55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c58:	c9                   	leave
+     c59:	c3                   	ret
+     c5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == 0){
+     c60:	e8 0b ff ff ff       	call   b70 <fflush.part.0>
+     c65:	eb bd                	jmp    c24 <fill+0x14>
+     c67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c6e:	66 90                	xchg   %ax,%ax
+    setup(f);
+     c70:	89 d8                	mov    %ebx,%eax
+     c72:	e8 29 fe ff ff       	call   aa0 <setup>
+  if(f->flags & IO_DEV)
+     c77:	8b 43 04             	mov    0x4(%ebx),%eax
+     c7a:	eb a4                	jmp    c20 <fill+0x10>
+     c7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c80 <stdio_threaded>:
+  threaded = 1;
+     c80:	c7 05 e0 30 00 00 01 	movl   $0x1,0x30e0
+     c87:	00 00 00 
+}
+     c8a:	c3                   	ret
+     c8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c8f:	90                   	nop
+
+00000c90 <flockfile>:
+{
+     c90:	55                   	push   %ebp
+  if(threaded)
+     c91:	8b 15 e0 30 00 00    	mov    0x30e0,%edx
+{
+     c97:	89 e5                	mov    %esp,%ebp
+     c99:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     c9c:	85 d2                	test   %edx,%edx
+     c9e:	75 08                	jne    ca8 <flockfile+0x18>
+}
+     ca0:	5d                   	pop    %ebp
+     ca1:	c3                   	ret
+     ca2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_lock(&f->lock);
+     ca8:	83 c0 18             	add    $0x18,%eax
+     cab:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     cae:	5d                   	pop    %ebp
+    mutex_lock(&f->lock);
+     caf:	e9 7c f7 ff ff       	jmp    430 <mutex_lock>
+     cb4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cbf:	90                   	nop
+
+00000cc0 <funlockfile>:
+{
+     cc0:	55                   	push   %ebp
+  if(threaded)
+     cc1:	8b 15 e0 30 00 00    	mov    0x30e0,%edx
+{
+     cc7:	89 e5                	mov    %esp,%ebp
+     cc9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     ccc:	85 d2                	test   %edx,%edx
+     cce:	75 08                	jne    cd8 <funlockfile+0x18>
+}
+     cd0:	5d                   	pop    %ebp
+     cd1:	c3                   	ret
+     cd2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&f->lock);
+     cd8:	83 c0 18             	add    $0x18,%eax
+     cdb:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     cde:	5d                   	pop    %ebp
+    mutex_unlock(&f->lock);
+     cdf:	e9 9c f7 ff ff       	jmp    480 <mutex_unlock>
+     ce4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ceb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cef:	90                   	nop
+
+00000cf0 <fopen>:
+{
+     cf0:	55                   	push   %ebp
+     cf1:	89 e5                	mov    %esp,%ebp
+     cf3:	57                   	push   %edi
+     cf4:	56                   	push   %esi
+     cf5:	53                   	push   %ebx
+     cf6:	83 ec 34             	sub    $0x34,%esp
+     cf9:	8b 75 0c             	mov    0xc(%ebp),%esi
+     cfc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(strcmp(mode, "r") != 0 && strcmp(mode, "w") != 0)
+     cff:	68 61 1f 00 00       	push   $0x1f61
+     d04:	56                   	push   %esi
+     d05:	e8 66 f5 ff ff       	call   270 <strcmp>
+     d0a:	83 c4 10             	add    $0x10,%esp
+     d0d:	85 c0                	test   %eax,%eax
+     d0f:	74 15                	je     d26 <fopen+0x36>
+     d11:	83 ec 08             	sub    $0x8,%esp
+     d14:	68 63 1f 00 00       	push   $0x1f63
+     d19:	56                   	push   %esi
+     d1a:	e8 51 f5 ff ff       	call   270 <strcmp>
+     d1f:	83 c4 10             	add    $0x10,%esp
+     d22:	85 c0                	test   %eax,%eax
+     d24:	75 2c                	jne    d52 <fopen+0x62>
+  if(threaded)
+     d26:	a1 e0 30 00 00       	mov    0x30e0,%eax
+     d2b:	85 c0                	test   %eax,%eax
+     d2d:	0f 85 ed 00 00 00    	jne    e20 <fopen+0x130>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     d33:	bb 34 29 00 00       	mov    $0x2934,%ebx
+    if(f->flags == 0)
+     d38:	8b 53 04             	mov    0x4(%ebx),%edx
+     d3b:	85 d2                	test   %edx,%edx
+     d3d:	74 21                	je     d60 <fopen+0x70>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     d3f:	83 c3 1c             	add    $0x1c,%ebx
+     d42:	81 fb c0 29 00 00    	cmp    $0x29c0,%ebx
+     d48:	75 ee                	jne    d38 <fopen+0x48>
+  if(threaded)
+     d4a:	85 c0                	test   %eax,%eax
+     d4c:	0f 85 36 01 00 00    	jne    e88 <fopen+0x198>
+    return 0;
+     d52:	31 db                	xor    %ebx,%ebx
+     d54:	e9 96 00 00 00       	jmp    def <fopen+0xff>
+     d59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f == &_iob[NSTREAM])
+     d60:	81 fb c0 29 00 00    	cmp    $0x29c0,%ebx
+     d66:	74 e2                	je     d4a <fopen+0x5a>
+    f->flags = IO_MALLOC;
+     d68:	c7 43 04 80 00 00 00 	movl   $0x80,0x4(%ebx)
+  if(threaded)
+     d6f:	85 c0                	test   %eax,%eax
+     d71:	0f 85 f9 00 00 00    	jne    e70 <fopen+0x180>
+  if(mode[0] == 'r'){
+     d77:	80 3e 72             	cmpb   $0x72,(%esi)
+     d7a:	0f 84 c0 00 00 00    	je     e40 <fopen+0x150>
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     d80:	83 ec 08             	sub    $0x8,%esp
+     d83:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     d86:	50                   	push   %eax
+     d87:	57                   	push   %edi
+     d88:	e8 d3 f5 ff ff       	call   360 <stat>
+     d8d:	83 c4 10             	add    $0x10,%esp
+     d90:	85 c0                	test   %eax,%eax
+     d92:	74 6c                	je     e00 <fopen+0x110>
+    fd = open(path, O_CREATE|O_WRONLY);
+     d94:	83 ec 08             	sub    $0x8,%esp
+     d97:	68 01 02 00 00       	push   $0x201
+     d9c:	57                   	push   %edi
+    flags = IO_WRITE;
+     d9d:	bf 02 00 00 00       	mov    $0x2,%edi
+    fd = open(path, O_CREATE|O_WRONLY);
+     da2:	e8 36 f8 ff ff       	call   5dd <open>
+     da7:	83 c4 10             	add    $0x10,%esp
+     daa:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     dac:	85 f6                	test   %esi,%esi
+     dae:	0f 88 a9 00 00 00    	js     e5d <fopen+0x16d>
+     db4:	83 ec 0c             	sub    $0xc,%esp
+     db7:	68 00 02 00 00       	push   $0x200
+     dbc:	e8 af 0c 00 00       	call   1a70 <malloc>
+     dc1:	83 c4 10             	add    $0x10,%esp
+     dc4:	89 43 08             	mov    %eax,0x8(%ebx)
+     dc7:	85 c0                	test   %eax,%eax
+     dc9:	0f 84 d0 00 00 00    	je     e9f <fopen+0x1af>
+  f->flags = flags|IO_MALLOC;
+     dcf:	81 cf 80 00 00 00    	or     $0x80,%edi
+  f->fd = fd;
+     dd5:	89 33                	mov    %esi,(%ebx)
+  f->size = BUFSIZ;
+     dd7:	c7 43 0c 00 02 00 00 	movl   $0x200,0xc(%ebx)
+  f->r = f->n = 0;
+     dde:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+     de5:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  f->flags = flags|IO_MALLOC;
+     dec:	89 7b 04             	mov    %edi,0x4(%ebx)
+}
+     def:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     df2:	89 d8                	mov    %ebx,%eax
+     df4:	5b                   	pop    %ebx
+     df5:	5e                   	pop    %esi
+     df6:	5f                   	pop    %edi
+     df7:	5d                   	pop    %ebp
+     df8:	c3                   	ret
+     df9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     e00:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+     e05:	75 8d                	jne    d94 <fopen+0xa4>
+      unlink(path);
+     e07:	83 ec 0c             	sub    $0xc,%esp
+     e0a:	57                   	push   %edi
+     e0b:	e8 eb f7 ff ff       	call   5fb <unlink>
+     e10:	83 c4 10             	add    $0x10,%esp
+     e13:	e9 7c ff ff ff       	jmp    d94 <fopen+0xa4>
+     e18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e1f:	90                   	nop
+    mutex_lock(&iolock);
+     e20:	83 ec 0c             	sub    $0xc,%esp
+     e23:	68 e4 30 00 00       	push   $0x30e4
+     e28:	e8 03 f6 ff ff       	call   430 <mutex_lock>
+  if(threaded)
+     e2d:	a1 e0 30 00 00       	mov    0x30e0,%eax
+     e32:	83 c4 10             	add    $0x10,%esp
+     e35:	e9 f9 fe ff ff       	jmp    d33 <fopen+0x43>
+     e3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    fd = open(path, O_RDONLY);
+     e40:	83 ec 08             	sub    $0x8,%esp
+     e43:	6a 00                	push   $0x0
+     e45:	57                   	push   %edi
+    flags = IO_READ;
+     e46:	bf 01 00 00 00       	mov    $0x1,%edi
+    fd = open(path, O_RDONLY);
+     e4b:	e8 8d f7 ff ff       	call   5dd <open>
+     e50:	83 c4 10             	add    $0x10,%esp
+     e53:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     e55:	85 f6                	test   %esi,%esi
+     e57:	0f 89 57 ff ff ff    	jns    db4 <fopen+0xc4>
+    f->flags = 0;
+     e5d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    return 0;
+     e64:	31 db                	xor    %ebx,%ebx
+     e66:	eb 87                	jmp    def <fopen+0xff>
+     e68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e6f:	90                   	nop
+    mutex_unlock(&iolock);
+     e70:	83 ec 0c             	sub    $0xc,%esp
+     e73:	68 e4 30 00 00       	push   $0x30e4
+     e78:	e8 03 f6 ff ff       	call   480 <mutex_unlock>
+     e7d:	83 c4 10             	add    $0x10,%esp
+     e80:	e9 f2 fe ff ff       	jmp    d77 <fopen+0x87>
+     e85:	8d 76 00             	lea    0x0(%esi),%esi
+     e88:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+     e8b:	31 db                	xor    %ebx,%ebx
+    mutex_unlock(&iolock);
+     e8d:	68 e4 30 00 00       	push   $0x30e4
+     e92:	e8 e9 f5 ff ff       	call   480 <mutex_unlock>
+     e97:	83 c4 10             	add    $0x10,%esp
+     e9a:	e9 50 ff ff ff       	jmp    def <fopen+0xff>
+      close(fd);
+     e9f:	83 ec 0c             	sub    $0xc,%esp
+     ea2:	56                   	push   %esi
+     ea3:	e8 08 f7 ff ff       	call   5b0 <close>
+     ea8:	83 c4 10             	add    $0x10,%esp
+     eab:	eb b0                	jmp    e5d <fopen+0x16d>
+     ead:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000eb0 <fclose>:
+{
+     eb0:	55                   	push   %ebp
+     eb1:	89 e5                	mov    %esp,%ebp
+     eb3:	56                   	push   %esi
+     eb4:	53                   	push   %ebx
+  if(threaded)
+     eb5:	8b 15 e0 30 00 00    	mov    0x30e0,%edx
+{
+     ebb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+     ebe:	85 d2                	test   %edx,%edx
+     ec0:	75 46                	jne    f08 <fclose+0x58>
+  r = flush(f);
+     ec2:	89 d8                	mov    %ebx,%eax
+     ec4:	e8 27 fc ff ff       	call   af0 <flush>
+  if(close(f->fd) < 0)
+     ec9:	83 ec 0c             	sub    $0xc,%esp
+     ecc:	ff 33                	push   (%ebx)
+  r = flush(f);
+     ece:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+     ed0:	e8 db f6 ff ff       	call   5b0 <close>
+     ed5:	83 c4 10             	add    $0x10,%esp
+    r = EOF;
+     ed8:	85 c0                	test   %eax,%eax
+     eda:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     edf:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->flags & IO_MALLOC)
+     ee2:	f6 43 04 80          	testb  $0x80,0x4(%ebx)
+     ee6:	75 58                	jne    f40 <fclose+0x90>
+  if(threaded)
+     ee8:	a1 e0 30 00 00       	mov    0x30e0,%eax
+  f->flags = 0;
+     eed:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  if(threaded)
+     ef4:	85 c0                	test   %eax,%eax
+     ef6:	75 28                	jne    f20 <fclose+0x70>
+}
+     ef8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     efb:	89 f0                	mov    %esi,%eax
+     efd:	5b                   	pop    %ebx
+     efe:	5e                   	pop    %esi
+     eff:	5d                   	pop    %ebp
+     f00:	c3                   	ret
+     f01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     f08:	83 ec 0c             	sub    $0xc,%esp
+     f0b:	8d 43 18             	lea    0x18(%ebx),%eax
+     f0e:	50                   	push   %eax
+     f0f:	e8 1c f5 ff ff       	call   430 <mutex_lock>
+     f14:	83 c4 10             	add    $0x10,%esp
+     f17:	eb a9                	jmp    ec2 <fclose+0x12>
+     f19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     f20:	83 ec 0c             	sub    $0xc,%esp
+     f23:	83 c3 18             	add    $0x18,%ebx
+     f26:	53                   	push   %ebx
+     f27:	e8 54 f5 ff ff       	call   480 <mutex_unlock>
+     f2c:	83 c4 10             	add    $0x10,%esp
+}
+     f2f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f32:	89 f0                	mov    %esi,%eax
+     f34:	5b                   	pop    %ebx
+     f35:	5e                   	pop    %esi
+     f36:	5d                   	pop    %ebp
+     f37:	c3                   	ret
+     f38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f3f:	90                   	nop
+    free(f->buf);
+     f40:	83 ec 0c             	sub    $0xc,%esp
+     f43:	ff 73 08             	push   0x8(%ebx)
+     f46:	e8 f5 09 00 00       	call   1940 <free>
+     f4b:	83 c4 10             	add    $0x10,%esp
+     f4e:	eb 98                	jmp    ee8 <fclose+0x38>
+
+00000f50 <fflush>:
+{
+     f50:	55                   	push   %ebp
+     f51:	89 e5                	mov    %esp,%ebp
+     f53:	53                   	push   %ebx
+     f54:	83 ec 14             	sub    $0x14,%esp
+     f57:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f == 0){
+     f5a:	85 db                	test   %ebx,%ebx
+     f5c:	74 5a                	je     fb8 <fflush+0x68>
+  if(threaded)
+     f5e:	8b 0d e0 30 00 00    	mov    0x30e0,%ecx
+     f64:	85 c9                	test   %ecx,%ecx
+     f66:	75 18                	jne    f80 <fflush+0x30>
+  r = flush(f);
+     f68:	89 d8                	mov    %ebx,%eax
+     f6a:	e8 81 fb ff ff       	call   af0 <flush>
+  if(threaded)
+     f6f:	8b 15 e0 30 00 00    	mov    0x30e0,%edx
+     f75:	85 d2                	test   %edx,%edx
+     f77:	75 1f                	jne    f98 <fflush+0x48>
+}
+     f79:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f7c:	c9                   	leave
+     f7d:	c3                   	ret
+     f7e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+     f80:	83 ec 0c             	sub    $0xc,%esp
+     f83:	8d 43 18             	lea    0x18(%ebx),%eax
+     f86:	50                   	push   %eax
+     f87:	e8 a4 f4 ff ff       	call   430 <mutex_lock>
+     f8c:	83 c4 10             	add    $0x10,%esp
+     f8f:	eb d7                	jmp    f68 <fflush+0x18>
+     f91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     f98:	83 ec 0c             	sub    $0xc,%esp
+     f9b:	83 c3 18             	add    $0x18,%ebx
+     f9e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     fa1:	53                   	push   %ebx
+     fa2:	e8 d9 f4 ff ff       	call   480 <mutex_unlock>
+     fa7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     faa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    mutex_unlock(&f->lock);
+     fad:	83 c4 10             	add    $0x10,%esp
+}
+     fb0:	c9                   	leave
+     fb1:	c3                   	ret
+     fb2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     fb8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     fbb:	c9                   	leave
+     fbc:	e9 af fb ff ff       	jmp    b70 <fflush.part.0>
+     fc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fcf:	90                   	nop
+
+00000fd0 <putc_unlocked>:
+{
+     fd0:	55                   	push   %ebp
+     fd1:	89 e5                	mov    %esp,%ebp
+     fd3:	56                   	push   %esi
+     fd4:	53                   	push   %ebx
+     fd5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     fd8:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(!(f->flags & IO_WRITE))
+     fdb:	8b 43 04             	mov    0x4(%ebx),%eax
+     fde:	a8 02                	test   $0x2,%al
+     fe0:	74 46                	je     1028 <putc_unlocked+0x58>
+  if(!(f->flags & IO_SETUP))
+     fe2:	a8 40                	test   $0x40,%al
+     fe4:	74 4a                	je     1030 <putc_unlocked+0x60>
+  if(f->n == f->size && flush(f) < 0)
+     fe6:	8b 43 14             	mov    0x14(%ebx),%eax
+     fe9:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     fec:	74 51                	je     103f <putc_unlocked+0x6f>
+  f->buf[f->n++] = c;
+     fee:	8d 48 01             	lea    0x1(%eax),%ecx
+     ff1:	8b 53 08             	mov    0x8(%ebx),%edx
+     ff4:	89 4b 14             	mov    %ecx,0x14(%ebx)
+     ff7:	89 f1                	mov    %esi,%ecx
+     ff9:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     ffc:	83 fe 0a             	cmp    $0xa,%esi
+     fff:	74 0f                	je     1010 <putc_unlocked+0x40>
+  return c & 0xff;
+    1001:	89 f0                	mov    %esi,%eax
+    1003:	0f b6 c0             	movzbl %al,%eax
+}
+    1006:	5b                   	pop    %ebx
+    1007:	5e                   	pop    %esi
+    1008:	5d                   	pop    %ebp
+    1009:	c3                   	ret
+    100a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    1010:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1014:	74 eb                	je     1001 <putc_unlocked+0x31>
+    1016:	89 d8                	mov    %ebx,%eax
+    1018:	e8 d3 fa ff ff       	call   af0 <flush>
+    101d:	85 c0                	test   %eax,%eax
+    101f:	79 e0                	jns    1001 <putc_unlocked+0x31>
+    1021:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return EOF;
+    1028:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    102d:	eb d7                	jmp    1006 <putc_unlocked+0x36>
+    102f:	90                   	nop
+    setup(f);
+    1030:	89 d8                	mov    %ebx,%eax
+    1032:	e8 69 fa ff ff       	call   aa0 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    1037:	8b 43 14             	mov    0x14(%ebx),%eax
+    103a:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    103d:	75 af                	jne    fee <putc_unlocked+0x1e>
+    103f:	89 d8                	mov    %ebx,%eax
+    1041:	e8 aa fa ff ff       	call   af0 <flush>
+    1046:	85 c0                	test   %eax,%eax
+    1048:	78 de                	js     1028 <putc_unlocked+0x58>
+  f->buf[f->n++] = c;
+    104a:	8b 43 14             	mov    0x14(%ebx),%eax
+    104d:	eb 9f                	jmp    fee <putc_unlocked+0x1e>
+    104f:	90                   	nop
+
+00001050 <fputc>:
+{
+    1050:	55                   	push   %ebp
+    1051:	89 e5                	mov    %esp,%ebp
+    1053:	56                   	push   %esi
+    1054:	53                   	push   %ebx
+  if(threaded)
+    1055:	8b 15 e0 30 00 00    	mov    0x30e0,%edx
+{
+    105b:	8b 75 08             	mov    0x8(%ebp),%esi
+    105e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(threaded)
+    1061:	85 d2                	test   %edx,%edx
+    1063:	75 6b                	jne    10d0 <fputc+0x80>
+  if(!(f->flags & IO_WRITE))
+    1065:	8b 43 04             	mov    0x4(%ebx),%eax
+    1068:	a8 02                	test   $0x2,%al
+    106a:	0f 84 b8 00 00 00    	je     1128 <fputc+0xd8>
+  if(!(f->flags & IO_SETUP))
+    1070:	a8 40                	test   $0x40,%al
+    1072:	74 76                	je     10ea <fputc+0x9a>
+  if(f->n == f->size && flush(f) < 0)
+    1074:	8b 43 14             	mov    0x14(%ebx),%eax
+    1077:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    107a:	74 7d                	je     10f9 <fputc+0xa9>
+  f->buf[f->n++] = c;
+    107c:	8d 48 01             	lea    0x1(%eax),%ecx
+    107f:	8b 53 08             	mov    0x8(%ebx),%edx
+    1082:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    1085:	89 f1                	mov    %esi,%ecx
+    1087:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    108a:	83 fe 0a             	cmp    $0xa,%esi
+    108d:	74 21                	je     10b0 <fputc+0x60>
+  return c & 0xff;
+    108f:	89 f0                	mov    %esi,%eax
+    1091:	0f b6 f0             	movzbl %al,%esi
+  if(threaded)
+    1094:	a1 e0 30 00 00       	mov    0x30e0,%eax
+    1099:	85 c0                	test   %eax,%eax
+    109b:	75 73                	jne    1110 <fputc+0xc0>
+}
+    109d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    10a0:	89 f0                	mov    %esi,%eax
+    10a2:	5b                   	pop    %ebx
+    10a3:	5e                   	pop    %esi
+    10a4:	5d                   	pop    %ebp
+    10a5:	c3                   	ret
+    10a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ad:	8d 76 00             	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    10b0:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    10b4:	74 d9                	je     108f <fputc+0x3f>
+    10b6:	89 d8                	mov    %ebx,%eax
+    10b8:	e8 33 fa ff ff       	call   af0 <flush>
+    10bd:	85 c0                	test   %eax,%eax
+    10bf:	79 ce                	jns    108f <fputc+0x3f>
+    return EOF;
+    10c1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    10c6:	eb cc                	jmp    1094 <fputc+0x44>
+    10c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10cf:	90                   	nop
+    mutex_lock(&f->lock);
+    10d0:	83 ec 0c             	sub    $0xc,%esp
+    10d3:	8d 43 18             	lea    0x18(%ebx),%eax
+    10d6:	50                   	push   %eax
+    10d7:	e8 54 f3 ff ff       	call   430 <mutex_lock>
+  if(!(f->flags & IO_WRITE))
+    10dc:	8b 43 04             	mov    0x4(%ebx),%eax
+    10df:	83 c4 10             	add    $0x10,%esp
+    10e2:	a8 02                	test   $0x2,%al
+    10e4:	74 db                	je     10c1 <fputc+0x71>
+  if(!(f->flags & IO_SETUP))
+    10e6:	a8 40                	test   $0x40,%al
+    10e8:	75 8a                	jne    1074 <fputc+0x24>
+    setup(f);
+    10ea:	89 d8                	mov    %ebx,%eax
+    10ec:	e8 af f9 ff ff       	call   aa0 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    10f1:	8b 43 14             	mov    0x14(%ebx),%eax
+    10f4:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    10f7:	75 83                	jne    107c <fputc+0x2c>
+    10f9:	89 d8                	mov    %ebx,%eax
+    10fb:	e8 f0 f9 ff ff       	call   af0 <flush>
+    1100:	85 c0                	test   %eax,%eax
+    1102:	78 bd                	js     10c1 <fputc+0x71>
+  f->buf[f->n++] = c;
+    1104:	8b 43 14             	mov    0x14(%ebx),%eax
+    1107:	e9 70 ff ff ff       	jmp    107c <fputc+0x2c>
+    110c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1110:	83 ec 0c             	sub    $0xc,%esp
+    1113:	83 c3 18             	add    $0x18,%ebx
+    1116:	53                   	push   %ebx
+    1117:	e8 64 f3 ff ff       	call   480 <mutex_unlock>
+    111c:	83 c4 10             	add    $0x10,%esp
+}
+    111f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1122:	89 f0                	mov    %esi,%eax
+    1124:	5b                   	pop    %ebx
+    1125:	5e                   	pop    %esi
+    1126:	5d                   	pop    %ebp
+    1127:	c3                   	ret
+    return EOF;
+    1128:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    112d:	e9 6b ff ff ff       	jmp    109d <fputc+0x4d>
+    1132:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001140 <fwrite>:
+{
+    1140:	55                   	push   %ebp
+    1141:	89 e5                	mov    %esp,%ebp
+    1143:	57                   	push   %edi
+    1144:	56                   	push   %esi
+    1145:	53                   	push   %ebx
+    1146:	83 ec 1c             	sub    $0x1c,%esp
+    1149:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  if(!(f->flags & IO_WRITE) || size <= 0)
+    114c:	8b 43 04             	mov    0x4(%ebx),%eax
+    114f:	a8 02                	test   $0x2,%al
+    1151:	0f 84 ec 00 00 00    	je     1243 <fwrite+0x103>
+    1157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    115a:	85 c9                	test   %ecx,%ecx
+    115c:	0f 8e e1 00 00 00    	jle    1243 <fwrite+0x103>
+  if(threaded)
+    1162:	8b 15 e0 30 00 00    	mov    0x30e0,%edx
+    1168:	85 d2                	test   %edx,%edx
+    116a:	0f 85 1c 01 00 00    	jne    128c <fwrite+0x14c>
+  if(!(f->flags & IO_SETUP))
+    1170:	a8 40                	test   $0x40,%al
+    1172:	0f 84 08 01 00 00    	je     1280 <fwrite+0x140>
+  for(len = size*nmemb; len > 0; len -= n){
+    1178:	8b 45 0c             	mov    0xc(%ebp),%eax
+    117b:	0f af 45 10          	imul   0x10(%ebp),%eax
+    117f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    1182:	85 c0                	test   %eax,%eax
+    1184:	0f 8e 2a 01 00 00    	jle    12b4 <fwrite+0x174>
+  s = p;
+    118a:	8b 45 08             	mov    0x8(%ebp),%eax
+  nl = 0;
+    118d:	31 ff                	xor    %edi,%edi
+    118f:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+        nl = 1;
+    1192:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  s = p;
+    1195:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1198:	8b 43 14             	mov    0x14(%ebx),%eax
+        nl = 1;
+    119b:	89 ce                	mov    %ecx,%esi
+    if(f->n == f->size && flush(f) < 0)
+    119d:	89 c2                	mov    %eax,%edx
+    119f:	39 f0                	cmp    %esi,%eax
+    11a1:	74 6e                	je     1211 <fwrite+0xd1>
+    11a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11a7:	90                   	nop
+    if(n > len)
+    11a8:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    n = f->size - f->n;
+    11ab:	89 f1                	mov    %esi,%ecx
+    11ad:	29 c1                	sub    %eax,%ecx
+    11af:	39 f9                	cmp    %edi,%ecx
+    11b1:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    11b4:	85 c9                	test   %ecx,%ecx
+    11b6:	0f 8e 7c 00 00 00    	jle    1238 <fwrite+0xf8>
+    11bc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    11bf:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    11c2:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    11c5:	8d 34 08             	lea    (%eax,%ecx,1),%esi
+    11c8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    11cb:	eb 06                	jmp    11d3 <fwrite+0x93>
+    11cd:	8d 76 00             	lea    0x0(%esi),%esi
+      if((f->buf[f->n++] = s[i]) == '\n')
+    11d0:	8b 53 14             	mov    0x14(%ebx),%edx
+    11d3:	8d 4a 01             	lea    0x1(%edx),%ecx
+    11d6:	8b 73 08             	mov    0x8(%ebx),%esi
+    11d9:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    11dc:	0f b6 08             	movzbl (%eax),%ecx
+        nl = 1;
+    11df:	80 f9 0a             	cmp    $0xa,%cl
+      if((f->buf[f->n++] = s[i]) == '\n')
+    11e2:	88 0c 16             	mov    %cl,(%esi,%edx,1)
+        nl = 1;
+    11e5:	be 01 00 00 00       	mov    $0x1,%esi
+    11ea:	0f 44 fe             	cmove  %esi,%edi
+    for(i = 0; i < n; i++)
+    11ed:	83 c0 01             	add    $0x1,%eax
+    11f0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    11f3:	75 db                	jne    11d0 <fwrite+0x90>
+    s += n;
+    11f5:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    11f8:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    11fb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    s += n;
+    11fe:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    1201:	85 c0                	test   %eax,%eax
+    1203:	7e 48                	jle    124d <fwrite+0x10d>
+    1205:	8b 43 14             	mov    0x14(%ebx),%eax
+    1208:	8b 73 0c             	mov    0xc(%ebx),%esi
+    if(f->n == f->size && flush(f) < 0)
+    120b:	89 c2                	mov    %eax,%edx
+    120d:	39 f0                	cmp    %esi,%eax
+    120f:	75 97                	jne    11a8 <fwrite+0x68>
+    1211:	89 d8                	mov    %ebx,%eax
+    1213:	e8 d8 f8 ff ff       	call   af0 <flush>
+    1218:	85 c0                	test   %eax,%eax
+    121a:	78 31                	js     124d <fwrite+0x10d>
+    n = f->size - f->n;
+    121c:	8b 73 0c             	mov    0xc(%ebx),%esi
+    121f:	8b 43 14             	mov    0x14(%ebx),%eax
+    1222:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    1225:	89 f1                	mov    %esi,%ecx
+    1227:	89 c2                	mov    %eax,%edx
+    1229:	29 c1                	sub    %eax,%ecx
+    122b:	39 f9                	cmp    %edi,%ecx
+    122d:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1230:	85 c9                	test   %ecx,%ecx
+    1232:	7f 88                	jg     11bc <fwrite+0x7c>
+    1234:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    s += n;
+    1238:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    123b:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    123e:	e9 5a ff ff ff       	jmp    119d <fwrite+0x5d>
+}
+    1243:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    1246:	31 c0                	xor    %eax,%eax
+}
+    1248:	5b                   	pop    %ebx
+    1249:	5e                   	pop    %esi
+    124a:	5f                   	pop    %edi
+    124b:	5d                   	pop    %ebp
+    124c:	c3                   	ret
+  if(nl && (f->flags & IO_LINE))
+    124d:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1250:	85 ff                	test   %edi,%edi
+    1252:	74 06                	je     125a <fwrite+0x11a>
+    1254:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1258:	75 1d                	jne    1277 <fwrite+0x137>
+  return (s - (const char*)p) / size;
+    125a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    125d:	2b 75 08             	sub    0x8(%ebp),%esi
+  if(threaded)
+    1260:	a1 e0 30 00 00       	mov    0x30e0,%eax
+    1265:	85 c0                	test   %eax,%eax
+    1267:	75 3a                	jne    12a3 <fwrite+0x163>
+  return (s - (const char*)p) / size;
+    1269:	89 f0                	mov    %esi,%eax
+    126b:	99                   	cltd
+    126c:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    126f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1272:	5b                   	pop    %ebx
+    1273:	5e                   	pop    %esi
+    1274:	5f                   	pop    %edi
+    1275:	5d                   	pop    %ebp
+    1276:	c3                   	ret
+    flush(f);
+    1277:	89 d8                	mov    %ebx,%eax
+    1279:	e8 72 f8 ff ff       	call   af0 <flush>
+    127e:	eb da                	jmp    125a <fwrite+0x11a>
+    setup(f);
+    1280:	89 d8                	mov    %ebx,%eax
+    1282:	e8 19 f8 ff ff       	call   aa0 <setup>
+    1287:	e9 ec fe ff ff       	jmp    1178 <fwrite+0x38>
+    mutex_lock(&f->lock);
+    128c:	83 ec 0c             	sub    $0xc,%esp
+    128f:	8d 43 18             	lea    0x18(%ebx),%eax
+    1292:	50                   	push   %eax
+    1293:	e8 98 f1 ff ff       	call   430 <mutex_lock>
+  if(!(f->flags & IO_SETUP))
+    1298:	8b 43 04             	mov    0x4(%ebx),%eax
+    129b:	83 c4 10             	add    $0x10,%esp
+    129e:	e9 cd fe ff ff       	jmp    1170 <fwrite+0x30>
+    mutex_unlock(&f->lock);
+    12a3:	83 ec 0c             	sub    $0xc,%esp
+    12a6:	83 c3 18             	add    $0x18,%ebx
+    12a9:	53                   	push   %ebx
+    12aa:	e8 d1 f1 ff ff       	call   480 <mutex_unlock>
+    12af:	83 c4 10             	add    $0x10,%esp
+    12b2:	eb b5                	jmp    1269 <fwrite+0x129>
+  for(len = size*nmemb; len > 0; len -= n){
+    12b4:	31 f6                	xor    %esi,%esi
+    12b6:	eb a8                	jmp    1260 <fwrite+0x120>
+    12b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12bf:	90                   	nop
+
+000012c0 <fgetc>:
+  return f->buf[f->r++] & 0xff;
+}
+
+int
+fgetc(FILE *f)
+{
+    12c0:	55                   	push   %ebp
+    12c1:	89 e5                	mov    %esp,%ebp
+    12c3:	56                   	push   %esi
+    12c4:	53                   	push   %ebx
+  if(threaded)
+    12c5:	8b 15 e0 30 00 00    	mov    0x30e0,%edx
+{
+    12cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    12ce:	85 d2                	test   %edx,%edx
+    12d0:	75 2e                	jne    1300 <fgetc+0x40>
+  if(!(f->flags & IO_READ))
+    12d2:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    12d6:	74 78                	je     1350 <fgetc+0x90>
+  if(f->r == f->n && fill(f) == 0)
+    12d8:	8b 43 10             	mov    0x10(%ebx),%eax
+    12db:	3b 43 14             	cmp    0x14(%ebx),%eax
+    12de:	74 60                	je     1340 <fgetc+0x80>
+  return f->buf[f->r++] & 0xff;
+    12e0:	8b 53 08             	mov    0x8(%ebx),%edx
+    12e3:	8d 48 01             	lea    0x1(%eax),%ecx
+    12e6:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    12e9:	0f b6 34 02          	movzbl (%edx,%eax,1),%esi
+  if(threaded)
+    12ed:	a1 e0 30 00 00       	mov    0x30e0,%eax
+    12f2:	85 c0                	test   %eax,%eax
+    12f4:	75 2a                	jne    1320 <fgetc+0x60>
+
+  flockfile(f);
+  c = getc_unlocked(f);
+  funlockfile(f);
+  return c;
+}
+    12f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12f9:	89 f0                	mov    %esi,%eax
+    12fb:	5b                   	pop    %ebx
+    12fc:	5e                   	pop    %esi
+    12fd:	5d                   	pop    %ebp
+    12fe:	c3                   	ret
+    12ff:	90                   	nop
+    mutex_lock(&f->lock);
+    1300:	83 ec 0c             	sub    $0xc,%esp
+    1303:	8d 43 18             	lea    0x18(%ebx),%eax
+    1306:	50                   	push   %eax
+    1307:	e8 24 f1 ff ff       	call   430 <mutex_lock>
+  if(!(f->flags & IO_READ))
+    130c:	83 c4 10             	add    $0x10,%esp
+    130f:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1313:	75 c3                	jne    12d8 <fgetc+0x18>
+    return EOF;
+    1315:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    131a:	eb d1                	jmp    12ed <fgetc+0x2d>
+    131c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1320:	83 ec 0c             	sub    $0xc,%esp
+    1323:	83 c3 18             	add    $0x18,%ebx
+    1326:	53                   	push   %ebx
+    1327:	e8 54 f1 ff ff       	call   480 <mutex_unlock>
+    132c:	83 c4 10             	add    $0x10,%esp
+}
+    132f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1332:	89 f0                	mov    %esi,%eax
+    1334:	5b                   	pop    %ebx
+    1335:	5e                   	pop    %esi
+    1336:	5d                   	pop    %ebp
+    1337:	c3                   	ret
+    1338:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    133f:	90                   	nop
+  if(f->r == f->n && fill(f) == 0)
+    1340:	89 d8                	mov    %ebx,%eax
+    1342:	e8 c9 f8 ff ff       	call   c10 <fill>
+    1347:	85 c0                	test   %eax,%eax
+    1349:	74 ca                	je     1315 <fgetc+0x55>
+  return f->buf[f->r++] & 0xff;
+    134b:	8b 43 10             	mov    0x10(%ebx),%eax
+    134e:	eb 90                	jmp    12e0 <fgetc+0x20>
+    return EOF;
+    1350:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    1355:	eb 9f                	jmp    12f6 <fgetc+0x36>
+    1357:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    135e:	66 90                	xchg   %ax,%ax
+
+00001360 <fread>:
+
+int
+fread(void *p, int size, int nmemb, FILE *f)
+{
+    1360:	55                   	push   %ebp
+    1361:	89 e5                	mov    %esp,%ebp
+    1363:	57                   	push   %edi
+    1364:	56                   	push   %esi
+    1365:	53                   	push   %ebx
+    1366:	83 ec 1c             	sub    $0x1c,%esp
+    1369:	8b 75 14             	mov    0x14(%ebp),%esi
+  char *d;
+  int n, len;
+
+  if(!(f->flags & IO_READ) || size <= 0)
+    136c:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+    1370:	74 7e                	je     13f0 <fread+0x90>
+    1372:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1375:	85 d2                	test   %edx,%edx
+    1377:	7e 77                	jle    13f0 <fread+0x90>
+  if(threaded)
+    1379:	a1 e0 30 00 00       	mov    0x30e0,%eax
+    return 0;
+  flockfile(f);
+  d = p;
+  for(len = size*nmemb; len > 0; len -= n){
+    137e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1381:	0f af 7d 10          	imul   0x10(%ebp),%edi
+  if(threaded)
+    1385:	85 c0                	test   %eax,%eax
+    1387:	0f 85 93 00 00 00    	jne    1420 <fread+0xc0>
+  for(len = size*nmemb; len > 0; len -= n){
+    138d:	85 ff                	test   %edi,%edi
+    138f:	7e 61                	jle    13f2 <fread+0x92>
+    if(f->r == f->n && fill(f) == 0)
+    1391:	8b 46 10             	mov    0x10(%esi),%eax
+  d = p;
+    1394:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1397:	eb 35                	jmp    13ce <fread+0x6e>
+    1399:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      break;
+    n = f->n - f->r;
+    13a0:	29 c3                	sub    %eax,%ebx
+    13a2:	39 fb                	cmp    %edi,%ebx
+    13a4:	0f 4f df             	cmovg  %edi,%ebx
+    if(n > len)
+      n = len;
+    memmove(d, f->buf + f->r, n);
+    13a7:	83 ec 04             	sub    $0x4,%esp
+    13aa:	53                   	push   %ebx
+    13ab:	03 46 08             	add    0x8(%esi),%eax
+  for(len = size*nmemb; len > 0; len -= n){
+    13ae:	29 df                	sub    %ebx,%edi
+    memmove(d, f->buf + f->r, n);
+    13b0:	50                   	push   %eax
+    13b1:	51                   	push   %ecx
+    13b2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    13b5:	e8 36 f0 ff ff       	call   3f0 <memmove>
+    f->r += n;
+    13ba:	8b 46 10             	mov    0x10(%esi),%eax
+    d += n;
+    13bd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    13c0:	83 c4 10             	add    $0x10,%esp
+    f->r += n;
+    13c3:	01 d8                	add    %ebx,%eax
+    d += n;
+    13c5:	01 d9                	add    %ebx,%ecx
+    f->r += n;
+    13c7:	89 46 10             	mov    %eax,0x10(%esi)
+  for(len = size*nmemb; len > 0; len -= n){
+    13ca:	85 ff                	test   %edi,%edi
+    13cc:	7e 32                	jle    1400 <fread+0xa0>
+    if(f->r == f->n && fill(f) == 0)
+    13ce:	8b 5e 14             	mov    0x14(%esi),%ebx
+    13d1:	39 c3                	cmp    %eax,%ebx
+    13d3:	75 cb                	jne    13a0 <fread+0x40>
+    13d5:	89 f0                	mov    %esi,%eax
+    13d7:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    13da:	e8 31 f8 ff ff       	call   c10 <fill>
+    13df:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    13e2:	85 c0                	test   %eax,%eax
+    13e4:	74 1a                	je     1400 <fread+0xa0>
+    n = f->n - f->r;
+    13e6:	8b 5e 14             	mov    0x14(%esi),%ebx
+    13e9:	8b 46 10             	mov    0x10(%esi),%eax
+    13ec:	eb b2                	jmp    13a0 <fread+0x40>
+    13ee:	66 90                	xchg   %ax,%ax
+    return 0;
+    13f0:	31 c0                	xor    %eax,%eax
+  }
+  funlockfile(f);
+  return (d - (char*)p) / size;
+}
+    13f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13f5:	5b                   	pop    %ebx
+    13f6:	5e                   	pop    %esi
+    13f7:	5f                   	pop    %edi
+    13f8:	5d                   	pop    %ebp
+    13f9:	c3                   	ret
+    13fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (d - (char*)p) / size;
+    1400:	2b 4d 08             	sub    0x8(%ebp),%ecx
+    1403:	89 cb                	mov    %ecx,%ebx
+  if(threaded)
+    1405:	a1 e0 30 00 00       	mov    0x30e0,%eax
+    140a:	85 c0                	test   %eax,%eax
+    140c:	75 32                	jne    1440 <fread+0xe0>
+  return (d - (char*)p) / size;
+    140e:	89 d8                	mov    %ebx,%eax
+    1410:	99                   	cltd
+    1411:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1414:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1417:	5b                   	pop    %ebx
+    1418:	5e                   	pop    %esi
+    1419:	5f                   	pop    %edi
+    141a:	5d                   	pop    %ebp
+    141b:	c3                   	ret
+    141c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    1420:	83 ec 0c             	sub    $0xc,%esp
+    1423:	8d 46 18             	lea    0x18(%esi),%eax
+    1426:	50                   	push   %eax
+    1427:	e8 04 f0 ff ff       	call   430 <mutex_lock>
+  for(len = size*nmemb; len > 0; len -= n){
+    142c:	83 c4 10             	add    $0x10,%esp
+    142f:	85 ff                	test   %edi,%edi
+    1431:	0f 8f 5a ff ff ff    	jg     1391 <fread+0x31>
+    1437:	31 db                	xor    %ebx,%ebx
+    1439:	eb ca                	jmp    1405 <fread+0xa5>
+    143b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    143f:	90                   	nop
+    mutex_unlock(&f->lock);
+    1440:	83 ec 0c             	sub    $0xc,%esp
+    1443:	83 c6 18             	add    $0x18,%esi
+    1446:	56                   	push   %esi
+    1447:	e8 34 f0 ff ff       	call   480 <mutex_unlock>
+  return (d - (char*)p) / size;
+    144c:	89 d8                	mov    %ebx,%eax
+    144e:	83 c4 10             	add    $0x10,%esp
+    1451:	99                   	cltd
+    1452:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1455:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1458:	5b                   	pop    %ebx
+    1459:	5e                   	pop    %esi
+    145a:	5f                   	pop    %edi
+    145b:	5d                   	pop    %ebp
+    145c:	c3                   	ret
+    145d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001460 <fgets>:
+
+// Read a line of at most max-1 bytes, keeping the newline.
+// Returns 0 if there was nothing left to read.
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    1460:	55                   	push   %ebp
+    1461:	89 e5                	mov    %esp,%ebp
+    1463:	57                   	push   %edi
+    1464:	56                   	push   %esi
+    1465:	53                   	push   %ebx
+    1466:	83 ec 1c             	sub    $0x1c,%esp
+  if(threaded)
+    1469:	8b 35 e0 30 00 00    	mov    0x30e0,%esi
+{
+    146f:	8b 7d 08             	mov    0x8(%ebp),%edi
+    1472:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if(threaded)
+    1475:	85 f6                	test   %esi,%esi
+    1477:	0f 85 83 00 00 00    	jne    1500 <fgets+0xa0>
+{
+    147d:	31 f6                	xor    %esi,%esi
+    147f:	eb 2a                	jmp    14ab <fgets+0x4b>
+    1481:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return f->buf[f->r++] & 0xff;
+    1488:	8b 53 08             	mov    0x8(%ebx),%edx
+    148b:	8d 48 01             	lea    0x1(%eax),%ecx
+    148e:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1491:	0f b6 14 02          	movzbl (%edx,%eax,1),%edx
+
+  flockfile(f);
+  for(i = 0; i+1 < max; ){
+    if((c = getc_unlocked(f)) == EOF)
+      break;
+    buf[i++] = c;
+    1495:	88 54 37 ff          	mov    %dl,-0x1(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    1499:	80 fa 0a             	cmp    $0xa,%dl
+    149c:	0f 84 96 00 00 00    	je     1538 <fgets+0xd8>
+    14a2:	83 fa 0d             	cmp    $0xd,%edx
+    14a5:	0f 84 8d 00 00 00    	je     1538 <fgets+0xd8>
+  for(i = 0; i+1 < max; ){
+    14ab:	89 f2                	mov    %esi,%edx
+    14ad:	83 c6 01             	add    $0x1,%esi
+    14b0:	3b 75 0c             	cmp    0xc(%ebp),%esi
+    14b3:	7d 2b                	jge    14e0 <fgets+0x80>
+  if(!(f->flags & IO_READ))
+    14b5:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    14b9:	74 25                	je     14e0 <fgets+0x80>
+  if(f->r == f->n && fill(f) == 0)
+    14bb:	8b 43 10             	mov    0x10(%ebx),%eax
+    14be:	3b 43 14             	cmp    0x14(%ebx),%eax
+    14c1:	75 c5                	jne    1488 <fgets+0x28>
+    14c3:	89 d8                	mov    %ebx,%eax
+    14c5:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    14c8:	e8 43 f7 ff ff       	call   c10 <fill>
+    14cd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    14d0:	85 c0                	test   %eax,%eax
+    14d2:	74 0c                	je     14e0 <fgets+0x80>
+  return f->buf[f->r++] & 0xff;
+    14d4:	8b 43 10             	mov    0x10(%ebx),%eax
+    14d7:	eb af                	jmp    1488 <fgets+0x28>
+    14d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    14e0:	8b 0d e0 30 00 00    	mov    0x30e0,%ecx
+      break;
+  }
+  buf[i] = '\0';
+    14e6:	c6 04 17 00          	movb   $0x0,(%edi,%edx,1)
+  if(threaded)
+    14ea:	85 c9                	test   %ecx,%ecx
+    14ec:	75 2a                	jne    1518 <fgets+0xb8>
+  funlockfile(f);
+  return i > 0 ? buf : 0;
+    14ee:	31 c0                	xor    %eax,%eax
+    14f0:	85 d2                	test   %edx,%edx
+    14f2:	74 02                	je     14f6 <fgets+0x96>
+    14f4:	89 f8                	mov    %edi,%eax
+}
+    14f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    14f9:	5b                   	pop    %ebx
+    14fa:	5e                   	pop    %esi
+    14fb:	5f                   	pop    %edi
+    14fc:	5d                   	pop    %ebp
+    14fd:	c3                   	ret
+    14fe:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    1500:	83 ec 0c             	sub    $0xc,%esp
+    1503:	8d 43 18             	lea    0x18(%ebx),%eax
+    1506:	50                   	push   %eax
+    1507:	e8 24 ef ff ff       	call   430 <mutex_lock>
+    150c:	83 c4 10             	add    $0x10,%esp
+    150f:	e9 69 ff ff ff       	jmp    147d <fgets+0x1d>
+    1514:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1518:	83 ec 0c             	sub    $0xc,%esp
+    151b:	83 c3 18             	add    $0x18,%ebx
+    151e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1521:	53                   	push   %ebx
+    1522:	e8 59 ef ff ff       	call   480 <mutex_unlock>
+    1527:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    152a:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    152d:	31 c0                	xor    %eax,%eax
+    152f:	85 d2                	test   %edx,%edx
+    1531:	75 c1                	jne    14f4 <fgets+0x94>
+    1533:	eb c1                	jmp    14f6 <fgets+0x96>
+    1535:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1538:	a1 e0 30 00 00       	mov    0x30e0,%eax
+  buf[i] = '\0';
+    153d:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  if(threaded)
+    1541:	85 c0                	test   %eax,%eax
+    1543:	74 af                	je     14f4 <fgets+0x94>
+    mutex_unlock(&f->lock);
+    1545:	83 ec 0c             	sub    $0xc,%esp
+    1548:	83 c3 18             	add    $0x18,%ebx
+    154b:	53                   	push   %ebx
+    154c:	e8 2f ef ff ff       	call   480 <mutex_unlock>
+    1551:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    1554:	89 f8                	mov    %edi,%eax
+    1556:	eb 9e                	jmp    14f6 <fgets+0x96>
+    1558:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    155f:	90                   	nop
+
+00001560 <gets>:
+// at most a line per read(), goes through stdin's buffer: from a
+// file or pipe, a buffered read could take input meant for a child
+// process, so read a byte at a time.
+char*
+gets(char *buf, int max)
+{
+    1560:	55                   	push   %ebp
+    1561:	89 e5                	mov    %esp,%ebp
+    1563:	57                   	push   %edi
+    1564:	56                   	push   %esi
+    1565:	53                   	push   %ebx
+    1566:	83 ec 2c             	sub    $0x2c,%esp
+  int i, cc;
+  char c;
+
+  if(!(stdin->flags & IO_SETUP))
+    1569:	8b 15 e4 28 00 00    	mov    0x28e4,%edx
+{
+    156f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!(stdin->flags & IO_SETUP))
+    1572:	f6 c2 40             	test   $0x40,%dl
+    1575:	74 79                	je     15f0 <gets+0x90>
+    setup(stdin);
+  if(stdin->flags & IO_DEV){
+    1577:	83 e2 20             	and    $0x20,%edx
+    157a:	89 d7                	mov    %edx,%edi
+    157c:	75 52                	jne    15d0 <gets+0x70>
+  if(f == 0){
+    157e:	e8 ed f5 ff ff       	call   b70 <fflush.part.0>
+    fgets(buf, max, stdin);
+    return buf;
+  }
+  fflush(0);
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1583:	8d 75 e7             	lea    -0x19(%ebp),%esi
+  for(i=0; i+1 < max; ){
+    1586:	eb 2c                	jmp    15b4 <gets+0x54>
+    1588:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    158f:	90                   	nop
+    cc = read(0, &c, 1);
+    1590:	83 ec 04             	sub    $0x4,%esp
+    1593:	6a 01                	push   $0x1
+    1595:	56                   	push   %esi
+    1596:	6a 00                	push   $0x0
+    1598:	e8 f5 ef ff ff       	call   592 <read>
+    if(cc < 1)
+    159d:	83 c4 10             	add    $0x10,%esp
+    15a0:	85 c0                	test   %eax,%eax
+    15a2:	7e 1b                	jle    15bf <gets+0x5f>
+      break;
+    buf[i++] = c;
+    15a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    15a8:	88 44 3b ff          	mov    %al,-0x1(%ebx,%edi,1)
+    if(c == '\n' || c == '\r')
+    15ac:	3c 0a                	cmp    $0xa,%al
+    15ae:	74 12                	je     15c2 <gets+0x62>
+    15b0:	3c 0d                	cmp    $0xd,%al
+    15b2:	74 0e                	je     15c2 <gets+0x62>
+  for(i=0; i+1 < max; ){
+    15b4:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    15b7:	83 c7 01             	add    $0x1,%edi
+    15ba:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+    15bd:	7c d1                	jl     1590 <gets+0x30>
+{
+    15bf:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      break;
+  }
+  buf[i] = '\0';
+    15c2:	c6 04 3b 00          	movb   $0x0,(%ebx,%edi,1)
+  return buf;
+}
+    15c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15c9:	89 d8                	mov    %ebx,%eax
+    15cb:	5b                   	pop    %ebx
+    15cc:	5e                   	pop    %esi
+    15cd:	5f                   	pop    %edi
+    15ce:	5d                   	pop    %ebp
+    15cf:	c3                   	ret
+    fgets(buf, max, stdin);
+    15d0:	83 ec 04             	sub    $0x4,%esp
+    15d3:	68 e0 28 00 00       	push   $0x28e0
+    15d8:	ff 75 0c             	push   0xc(%ebp)
+    15db:	53                   	push   %ebx
+    15dc:	e8 7f fe ff ff       	call   1460 <fgets>
+    return buf;
+    15e1:	83 c4 10             	add    $0x10,%esp
+}
+    15e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15e7:	89 d8                	mov    %ebx,%eax
+    15e9:	5b                   	pop    %ebx
+    15ea:	5e                   	pop    %esi
+    15eb:	5f                   	pop    %edi
+    15ec:	5d                   	pop    %ebp
+    15ed:	c3                   	ret
+    15ee:	66 90                	xchg   %ax,%ax
+    setup(stdin);
+    15f0:	b8 e0 28 00 00       	mov    $0x28e0,%eax
+    15f5:	e8 a6 f4 ff ff       	call   aa0 <setup>
+  if(stdin->flags & IO_DEV){
+    15fa:	8b 15 e4 28 00 00    	mov    0x28e4,%edx
+    1600:	e9 72 ff ff ff       	jmp    1577 <gets+0x17>
+    1605:	66 90                	xchg   %ax,%ax
+    1607:	66 90                	xchg   %ax,%ax
+    1609:	66 90                	xchg   %ax,%ax
+    160b:	66 90                	xchg   %ax,%ax
+    160d:	66 90                	xchg   %ax,%ax
+    160f:	90                   	nop
+
+00001610 <bigfree>:
+
+// Give a big block back to the first-fit list, and return the
+// free block that now holds it. Caller holds lock.
+static Header*
+bigfree(Header *bp)
+{
+    1610:	55                   	push   %ebp
+    1611:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1613:	a1 84 37 00 00       	mov    0x3784,%eax
+{
+    1618:	89 e5                	mov    %esp,%ebp
+    161a:	56                   	push   %esi
+    161b:	53                   	push   %ebx
+    161c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1620:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1622:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1624:	39 ca                	cmp    %ecx,%edx
+    1626:	73 38                	jae    1660 <bigfree+0x50>
+    1628:	39 c1                	cmp    %eax,%ecx
+    162a:	72 04                	jb     1630 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    162c:	39 c2                	cmp    %eax,%edx
+    162e:	72 f0                	jb     1620 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1630:	8b 59 04             	mov    0x4(%ecx),%ebx
+    1633:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    1636:	39 f0                	cmp    %esi,%eax
+    1638:	74 36                	je     1670 <bigfree+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    163a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  freep = p;
+  if(p + p->s.size == bp){
+    163c:	8b 42 04             	mov    0x4(%edx),%eax
+    163f:	89 cb                	mov    %ecx,%ebx
+  freep = p;
+    1641:	89 15 84 37 00 00    	mov    %edx,0x3784
+  if(p + p->s.size == bp){
+    1647:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    164a:	39 f1                	cmp    %esi,%ecx
+    164c:	74 2e                	je     167c <bigfree+0x6c>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    164e:	89 1a                	mov    %ebx,(%edx)
+    return p;
+  }
+  p->s.ptr = bp;
+  return bp;
+}
+    1650:	89 c8                	mov    %ecx,%eax
+    1652:	5b                   	pop    %ebx
+    1653:	5e                   	pop    %esi
+    1654:	5d                   	pop    %ebp
+    1655:	c3                   	ret
+    1656:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    165d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1660:	39 c1                	cmp    %eax,%ecx
+    1662:	72 c8                	jb     162c <bigfree+0x1c>
+    1664:	eb ba                	jmp    1620 <bigfree+0x10>
+    1666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    166d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1670:	03 58 04             	add    0x4(%eax),%ebx
+    1673:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1676:	8b 02                	mov    (%edx),%eax
+    1678:	8b 00                	mov    (%eax),%eax
+    167a:	eb be                	jmp    163a <bigfree+0x2a>
+    p->s.size += bp->s.size;
+    167c:	03 41 04             	add    0x4(%ecx),%eax
+    167f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1682:	8b 19                	mov    (%ecx),%ebx
+    return p;
+    1684:	89 d1                	mov    %edx,%ecx
+}
+    1686:	89 c8                	mov    %ecx,%eax
+    p->s.ptr = bp->s.ptr;
+    1688:	89 1a                	mov    %ebx,(%edx)
+}
+    168a:	5b                   	pop    %ebx
+    168b:	5e                   	pop    %esi
+    168c:	5d                   	pop    %ebp
+    168d:	c3                   	ret
+    168e:	66 90                	xchg   %ax,%ax
+
+00001690 <trim>:
+// If free block bp ends the heap, return its whole pages to the
+// kernel, unless something else has moved the break since.
+// Caller holds lock.
+static void
+trim(Header *bp)
+{
+    1690:	55                   	push   %ebp
+    1691:	89 e5                	mov    %esp,%ebp
+    1693:	57                   	push   %edi
+    1694:	56                   	push   %esi
+    1695:	53                   	push   %ebx
+    1696:	89 c3                	mov    %eax,%ebx
+    1698:	83 ec 0c             	sub    $0xc,%esp
+  char *end;
+  uint n;
+
+  if((char*)(bp + bp->s.size) != heapend)
+    169b:	8b 53 04             	mov    0x4(%ebx),%edx
+    169e:	a1 80 37 00 00       	mov    0x3780,%eax
+    16a3:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+    16a6:	39 d0                	cmp    %edx,%eax
+    16a8:	74 0e                	je     16b8 <trim+0x28>
+  n = heapend - end;
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    bp->s.size -= n / sizeof(Header);
+    heapend = end;
+  }
+}
+    16aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    16ad:	5b                   	pop    %ebx
+    16ae:	5e                   	pop    %esi
+    16af:	5f                   	pop    %edi
+    16b0:	5d                   	pop    %ebp
+    16b1:	c3                   	ret
+    16b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  end = (char*)PGROUNDUP((uint)(bp + 2));
+    16b8:	8d bb 0f 10 00 00    	lea    0x100f(%ebx),%edi
+    16be:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  n = heapend - end;
+    16c4:	29 f8                	sub    %edi,%eax
+    16c6:	89 c6                	mov    %eax,%esi
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    16c8:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    16cd:	76 db                	jbe    16aa <trim+0x1a>
+    16cf:	83 ec 0c             	sub    $0xc,%esp
+    16d2:	6a 00                	push   $0x0
+    16d4:	e8 8b ef ff ff       	call   664 <sbrk>
+    16d9:	83 c4 10             	add    $0x10,%esp
+    16dc:	39 05 80 37 00 00    	cmp    %eax,0x3780
+    16e2:	75 c6                	jne    16aa <trim+0x1a>
+    16e4:	89 f0                	mov    %esi,%eax
+    16e6:	83 ec 0c             	sub    $0xc,%esp
+    16e9:	f7 d8                	neg    %eax
+    16eb:	50                   	push   %eax
+    16ec:	e8 73 ef ff ff       	call   664 <sbrk>
+    16f1:	83 c4 10             	add    $0x10,%esp
+    16f4:	83 f8 ff             	cmp    $0xffffffff,%eax
+    16f7:	74 b1                	je     16aa <trim+0x1a>
+    bp->s.size -= n / sizeof(Header);
+    16f9:	89 f0                	mov    %esi,%eax
+    heapend = end;
+    16fb:	89 3d 80 37 00 00    	mov    %edi,0x3780
+    bp->s.size -= n / sizeof(Header);
+    1701:	c1 e8 03             	shr    $0x3,%eax
+    1704:	29 43 04             	sub    %eax,0x4(%ebx)
+    heapend = end;
+    1707:	eb a1                	jmp    16aa <trim+0x1a>
+    1709:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001710 <bigalloc>:
+}
+
+// Allocate a big block of nunits units. Caller holds lock.
+static Header*
+bigalloc(uint nunits)
+{
+    1710:	55                   	push   %ebp
+    1711:	89 e5                	mov    %esp,%ebp
+    1713:	57                   	push   %edi
+    1714:	89 c7                	mov    %eax,%edi
+    1716:	56                   	push   %esi
+    1717:	53                   	push   %ebx
+    1718:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    171b:	a1 84 37 00 00       	mov    0x3784,%eax
+    1720:	85 c0                	test   %eax,%eax
+    1722:	0f 84 98 00 00 00    	je     17c0 <bigalloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1728:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    172a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    172d:	39 f9                	cmp    %edi,%ecx
+    172f:	73 67                	jae    1798 <bigalloc+0x88>
+  if(nu < 4096)
+    1731:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1736:	39 df                	cmp    %ebx,%edi
+    1738:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    173b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    1742:	eb 0d                	jmp    1751 <bigalloc+0x41>
+    1744:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1748:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    174a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    174d:	39 f9                	cmp    %edi,%ecx
+    174f:	73 47                	jae    1798 <bigalloc+0x88>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    1751:	89 d0                	mov    %edx,%eax
+    1753:	39 15 84 37 00 00    	cmp    %edx,0x3784
+    1759:	75 ed                	jne    1748 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    175b:	83 ec 0c             	sub    $0xc,%esp
+    175e:	56                   	push   %esi
+    175f:	e8 00 ef ff ff       	call   664 <sbrk>
+  if(p == (char*)-1)
+    1764:	83 c4 10             	add    $0x10,%esp
+    1767:	83 f8 ff             	cmp    $0xffffffff,%eax
+    176a:	74 1a                	je     1786 <bigalloc+0x76>
+  hp->s.size = nu;
+    176c:	89 58 04             	mov    %ebx,0x4(%eax)
+  heapend = p + nu * sizeof(Header);
+    176f:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    1772:	89 15 80 37 00 00    	mov    %edx,0x3780
+  bigfree(hp);
+    1778:	e8 93 fe ff ff       	call   1610 <bigfree>
+  return freep;
+    177d:	a1 84 37 00 00       	mov    0x3784,%eax
+      if((p = morecore(nunits)) == 0)
+    1782:	85 c0                	test   %eax,%eax
+    1784:	75 c2                	jne    1748 <bigalloc+0x38>
+        return 0;
+  }
+}
+    1786:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1789:	31 d2                	xor    %edx,%edx
+}
+    178b:	5b                   	pop    %ebx
+    178c:	89 d0                	mov    %edx,%eax
+    178e:	5e                   	pop    %esi
+    178f:	5f                   	pop    %edi
+    1790:	5d                   	pop    %ebp
+    1791:	c3                   	ret
+    1792:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1798:	39 cf                	cmp    %ecx,%edi
+    179a:	74 54                	je     17f0 <bigalloc+0xe0>
+        p->s.size -= nunits;
+    179c:	29 f9                	sub    %edi,%ecx
+    179e:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    17a1:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    17a4:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    17a7:	a3 84 37 00 00       	mov    %eax,0x3784
+}
+    17ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    17af:	89 d0                	mov    %edx,%eax
+    17b1:	5b                   	pop    %ebx
+    17b2:	5e                   	pop    %esi
+    17b3:	5f                   	pop    %edi
+    17b4:	5d                   	pop    %ebp
+    17b5:	c3                   	ret
+    17b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17bd:	8d 76 00             	lea    0x0(%esi),%esi
+    base.s.ptr = freep = prevp = &base;
+    17c0:	c7 05 84 37 00 00 88 	movl   $0x3788,0x3784
+    17c7:	37 00 00 
+    base.s.size = 0;
+    17ca:	ba 88 37 00 00       	mov    $0x3788,%edx
+    base.s.ptr = freep = prevp = &base;
+    17cf:	c7 05 88 37 00 00 88 	movl   $0x3788,0x3788
+    17d6:	37 00 00 
+    base.s.size = 0;
+    17d9:	c7 05 8c 37 00 00 00 	movl   $0x0,0x378c
+    17e0:	00 00 00 
+    if(p->s.size >= nunits){
+    17e3:	e9 49 ff ff ff       	jmp    1731 <bigalloc+0x21>
+    17e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17ef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    17f0:	8b 0a                	mov    (%edx),%ecx
+    17f2:	89 08                	mov    %ecx,(%eax)
+    17f4:	eb b1                	jmp    17a7 <bigalloc+0x97>
+    17f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001800 <drain>:
+}
+
+// Move n blocks of class c from cache tc to the shared list.
+static void
+drain(struct tcache *tc, int c, int n)
+{
+    1800:	55                   	push   %ebp
+    1801:	89 e5                	mov    %esp,%ebp
+    1803:	57                   	push   %edi
+    1804:	89 c7                	mov    %eax,%edi
+    1806:	56                   	push   %esi
+    1807:	89 d6                	mov    %edx,%esi
+    1809:	53                   	push   %ebx
+    180a:	89 cb                	mov    %ecx,%ebx
+    180c:	83 ec 0c             	sub    $0xc,%esp
+  if(threaded)
+    180f:	8b 15 04 37 00 00    	mov    0x3704,%edx
+    1815:	85 d2                	test   %edx,%edx
+    1817:	75 57                	jne    1870 <drain+0x70>
+  Header *p;
+
+  acquire();
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1819:	85 c9                	test   %ecx,%ecx
+    181b:	7e 49                	jle    1866 <drain+0x66>
+    181d:	89 d9                	mov    %ebx,%ecx
+    181f:	8d 14 b7             	lea    (%edi,%esi,4),%edx
+    1822:	eb 23                	jmp    1847 <drain+0x47>
+    1824:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    tc->list[c] = p->s.ptr;
+    1828:	8b 18                	mov    (%eax),%ebx
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    182a:	83 e9 01             	sub    $0x1,%ecx
+    tc->n[c]--;
+    182d:	83 6a 20 01          	subl   $0x1,0x20(%edx)
+    tc->list[c] = p->s.ptr;
+    1831:	89 1a                	mov    %ebx,(%edx)
+    p->s.ptr = small[c];
+    1833:	8b 1c b5 60 37 00 00 	mov    0x3760(,%esi,4),%ebx
+    183a:	89 18                	mov    %ebx,(%eax)
+    small[c] = p;
+    183c:	89 04 b5 60 37 00 00 	mov    %eax,0x3760(,%esi,4)
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1843:	85 c9                	test   %ecx,%ecx
+    1845:	7e 06                	jle    184d <drain+0x4d>
+    1847:	8b 02                	mov    (%edx),%eax
+    1849:	85 c0                	test   %eax,%eax
+    184b:	75 db                	jne    1828 <drain+0x28>
+  if(threaded)
+    184d:	a1 04 37 00 00       	mov    0x3704,%eax
+    1852:	85 c0                	test   %eax,%eax
+    1854:	74 10                	je     1866 <drain+0x66>
+    mutex_unlock(&lock);
+    1856:	83 ec 0c             	sub    $0xc,%esp
+    1859:	68 08 37 00 00       	push   $0x3708
+    185e:	e8 1d ec ff ff       	call   480 <mutex_unlock>
+}
+    1863:	83 c4 10             	add    $0x10,%esp
+  }
+  release();
+}
+    1866:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1869:	5b                   	pop    %ebx
+    186a:	5e                   	pop    %esi
+    186b:	5f                   	pop    %edi
+    186c:	5d                   	pop    %ebp
+    186d:	c3                   	ret
+    186e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&lock);
+    1870:	83 ec 0c             	sub    $0xc,%esp
+    1873:	68 08 37 00 00       	push   $0x3708
+    1878:	e8 b3 eb ff ff       	call   430 <mutex_lock>
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    187d:	83 c4 10             	add    $0x10,%esp
+    1880:	85 db                	test   %ebx,%ebx
+    1882:	7f 99                	jg     181d <drain+0x1d>
+    1884:	eb c7                	jmp    184d <drain+0x4d>
+    1886:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    188d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001890 <mycache>:
+{
+    1890:	55                   	push   %ebp
+    return &maincache;
+    1891:	b8 20 37 00 00       	mov    $0x3720,%eax
+{
+    1896:	89 e5                	mov    %esp,%ebp
+    1898:	53                   	push   %ebx
+  sp = PGROUNDDOWN((uint)&sp);
+    1899:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+    189c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+    18a2:	83 ec 14             	sub    $0x14,%esp
+  if(!threaded || sp == mainstack)
+    18a5:	8b 0d 04 37 00 00    	mov    0x3704,%ecx
+  sp = PGROUNDDOWN((uint)&sp);
+    18ab:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  if(!threaded || sp == mainstack)
+    18ae:	85 c9                	test   %ecx,%ecx
+    18b0:	74 0f                	je     18c1 <mycache+0x31>
+    18b2:	3b 1d 00 37 00 00    	cmp    0x3700,%ebx
+    18b8:	74 07                	je     18c1 <mycache+0x31>
+  if(*cp == 0){
+    18ba:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    18bd:	85 c0                	test   %eax,%eax
+    18bf:	74 0f                	je     18d0 <mycache+0x40>
+}
+    18c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    18c4:	c9                   	leave
+    18c5:	c3                   	ret
+    18c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18cd:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    18d0:	83 ec 0c             	sub    $0xc,%esp
+    18d3:	68 08 37 00 00       	push   $0x3708
+    18d8:	e8 53 eb ff ff       	call   430 <mutex_lock>
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    18dd:	b8 09 00 00 00       	mov    $0x9,%eax
+    18e2:	e8 29 fe ff ff       	call   1710 <bigalloc>
+  if(threaded)
+    18e7:	8b 15 04 37 00 00    	mov    0x3704,%edx
+    18ed:	83 c4 10             	add    $0x10,%esp
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    18f0:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(threaded)
+    18f3:	85 d2                	test   %edx,%edx
+    18f5:	75 29                	jne    1920 <mycache+0x90>
+    if(*cp == 0)
+    18f7:	85 c0                	test   %eax,%eax
+    18f9:	74 c6                	je     18c1 <mycache+0x31>
+    memset(*cp, 0, sizeof(**cp));
+    18fb:	83 ec 04             	sub    $0x4,%esp
+    *cp = (struct tcache*)((Header*)*cp + 1);
+    18fe:	83 c0 08             	add    $0x8,%eax
+    1901:	89 43 f8             	mov    %eax,-0x8(%ebx)
+    memset(*cp, 0, sizeof(**cp));
+    1904:	6a 40                	push   $0x40
+    1906:	6a 00                	push   $0x0
+    1908:	50                   	push   %eax
+    1909:	e8 f2 e9 ff ff       	call   300 <memset>
+  return *cp;
+    190e:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    1911:	83 c4 10             	add    $0x10,%esp
+    1914:	eb ab                	jmp    18c1 <mycache+0x31>
+    1916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    191d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1920:	83 ec 0c             	sub    $0xc,%esp
+    1923:	68 08 37 00 00       	push   $0x3708
+    1928:	e8 53 eb ff ff       	call   480 <mutex_unlock>
+    if(*cp == 0)
+    192d:	8b 43 f8             	mov    -0x8(%ebx),%eax
+}
+    1930:	83 c4 10             	add    $0x10,%esp
+    1933:	eb c2                	jmp    18f7 <mycache+0x67>
+    1935:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    193c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001940 <free>:
+
+void
+free(void *ap)
+{
+    1940:	55                   	push   %ebp
+    1941:	89 e5                	mov    %esp,%ebp
+    1943:	57                   	push   %edi
+    1944:	56                   	push   %esi
+    1945:	53                   	push   %ebx
+    1946:	83 ec 1c             	sub    $0x1c,%esp
+    1949:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  struct tcache *tc;
+  int c;
+
+  if(ap == 0)
+    194c:	85 f6                	test   %esi,%esi
+    194e:	74 51                	je     19a1 <free+0x61>
+    return;
+  bp = (Header*)ap - 1;
+    1950:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1953:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(bp->s.size > SMALLMAX / sizeof(Header)){
+    1956:	8b 46 fc             	mov    -0x4(%esi),%eax
+    1959:	3d 00 01 00 00       	cmp    $0x100,%eax
+    195e:	77 50                	ja     19b0 <free+0x70>
+    acquire();
+    trim(bigfree(bp));
+    release();
+    return;
+  }
+  for(c = 0; (2 << c) < bp->s.size; c++)
+    1960:	31 db                	xor    %ebx,%ebx
+    1962:	ba 02 00 00 00       	mov    $0x2,%edx
+    1967:	83 f8 02             	cmp    $0x2,%eax
+    196a:	76 11                	jbe    197d <free+0x3d>
+    196c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1970:	83 c3 01             	add    $0x1,%ebx
+    1973:	89 d7                	mov    %edx,%edi
+    1975:	89 d9                	mov    %ebx,%ecx
+    1977:	d3 e7                	shl    %cl,%edi
+    1979:	39 c7                	cmp    %eax,%edi
+    197b:	72 f3                	jb     1970 <free+0x30>
+    ;
+  if((tc = mycache()) == 0){
+    197d:	e8 0e ff ff ff       	call   1890 <mycache>
+    1982:	85 c0                	test   %eax,%eax
+    1984:	74 7a                	je     1a00 <free+0xc0>
+    bp->s.ptr = small[c];
+    small[c] = bp;
+    release();
+    return;
+  }
+  bp->s.ptr = tc->list[c];
+    1986:	8d 0c 98             	lea    (%eax,%ebx,4),%ecx
+    1989:	8b 11                	mov    (%ecx),%edx
+    198b:	89 56 f8             	mov    %edx,-0x8(%esi)
+  tc->list[c] = bp;
+    198e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1991:	89 31                	mov    %esi,(%ecx)
+  if(++tc->n[c] > TCACHEMAX)
+    1993:	8b 71 20             	mov    0x20(%ecx),%esi
+    1996:	8d 56 01             	lea    0x1(%esi),%edx
+    1999:	89 51 20             	mov    %edx,0x20(%ecx)
+    199c:	83 fa 20             	cmp    $0x20,%edx
+    199f:	7f 47                	jg     19e8 <free+0xa8>
+    drain(tc, c, BATCH);
+}
+    19a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19a4:	5b                   	pop    %ebx
+    19a5:	5e                   	pop    %esi
+    19a6:	5f                   	pop    %edi
+    19a7:	5d                   	pop    %ebp
+    19a8:	c3                   	ret
+    19a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    19b0:	8b 1d 04 37 00 00    	mov    0x3704,%ebx
+    19b6:	85 db                	test   %ebx,%ebx
+    19b8:	75 66                	jne    1a20 <free+0xe0>
+    trim(bigfree(bp));
+    19ba:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    19bd:	e8 4e fc ff ff       	call   1610 <bigfree>
+    19c2:	e8 c9 fc ff ff       	call   1690 <trim>
+  if(threaded)
+    19c7:	8b 0d 04 37 00 00    	mov    0x3704,%ecx
+    19cd:	85 c9                	test   %ecx,%ecx
+    19cf:	74 d0                	je     19a1 <free+0x61>
+    mutex_unlock(&lock);
+    19d1:	c7 45 08 08 37 00 00 	movl   $0x3708,0x8(%ebp)
+}
+    19d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19db:	5b                   	pop    %ebx
+    19dc:	5e                   	pop    %esi
+    19dd:	5f                   	pop    %edi
+    19de:	5d                   	pop    %ebp
+    mutex_unlock(&lock);
+    19df:	e9 9c ea ff ff       	jmp    480 <mutex_unlock>
+    19e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    19e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    drain(tc, c, BATCH);
+    19eb:	89 da                	mov    %ebx,%edx
+    19ed:	b9 10 00 00 00       	mov    $0x10,%ecx
+}
+    19f2:	5b                   	pop    %ebx
+    19f3:	5e                   	pop    %esi
+    19f4:	5f                   	pop    %edi
+    19f5:	5d                   	pop    %ebp
+    drain(tc, c, BATCH);
+    19f6:	e9 05 fe ff ff       	jmp    1800 <drain>
+    19fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    19ff:	90                   	nop
+  if(threaded)
+    1a00:	8b 15 04 37 00 00    	mov    0x3704,%edx
+    1a06:	85 d2                	test   %edx,%edx
+    1a08:	75 28                	jne    1a32 <free+0xf2>
+    bp->s.ptr = small[c];
+    1a0a:	8b 04 9d 60 37 00 00 	mov    0x3760(,%ebx,4),%eax
+    1a11:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1a14:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1a17:	89 04 9d 60 37 00 00 	mov    %eax,0x3760(,%ebx,4)
+  if(threaded)
+    1a1e:	eb 81                	jmp    19a1 <free+0x61>
+    mutex_lock(&lock);
+    1a20:	83 ec 0c             	sub    $0xc,%esp
+    1a23:	68 08 37 00 00       	push   $0x3708
+    1a28:	e8 03 ea ff ff       	call   430 <mutex_lock>
+}
+    1a2d:	83 c4 10             	add    $0x10,%esp
+    1a30:	eb 88                	jmp    19ba <free+0x7a>
+    mutex_lock(&lock);
+    1a32:	83 ec 0c             	sub    $0xc,%esp
+    1a35:	68 08 37 00 00       	push   $0x3708
+    1a3a:	e8 f1 e9 ff ff       	call   430 <mutex_lock>
+    bp->s.ptr = small[c];
+    1a3f:	8b 04 9d 60 37 00 00 	mov    0x3760(,%ebx,4),%eax
+  if(threaded)
+    1a46:	83 c4 10             	add    $0x10,%esp
+    bp->s.ptr = small[c];
+    1a49:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1a4c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1a4f:	89 04 9d 60 37 00 00 	mov    %eax,0x3760(,%ebx,4)
+  if(threaded)
+    1a56:	a1 04 37 00 00       	mov    0x3704,%eax
+    1a5b:	85 c0                	test   %eax,%eax
+    1a5d:	0f 85 6e ff ff ff    	jne    19d1 <free+0x91>
+    1a63:	e9 39 ff ff ff       	jmp    19a1 <free+0x61>
+    1a68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a6f:	90                   	nop
+
+00001a70 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1a70:	55                   	push   %ebp
+    1a71:	89 e5                	mov    %esp,%ebp
+    1a73:	57                   	push   %edi
+    1a74:	56                   	push   %esi
+    1a75:	53                   	push   %ebx
+    1a76:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  struct tcache *tc;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1a79:	8b 45 08             	mov    0x8(%ebp),%eax
+    1a7c:	8d 78 07             	lea    0x7(%eax),%edi
+    1a7f:	c1 ef 03             	shr    $0x3,%edi
+    1a82:	83 c7 01             	add    $0x1,%edi
+  if(nunits > SMALLMAX / sizeof(Header)){
+    1a85:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+    1a8b:	77 5b                	ja     1ae8 <malloc+0x78>
+    acquire();
+    p = bigalloc(nunits);
+    release();
+    return p ? (void*)(p + 1) : 0;
+  }
+  for(c = 0; (2 << c) < nunits; c++)
+    1a8d:	31 c9                	xor    %ecx,%ecx
+    1a8f:	b8 02 00 00 00       	mov    $0x2,%eax
+    1a94:	be 02 00 00 00       	mov    $0x2,%esi
+    1a99:	bb 02 00 00 00       	mov    $0x2,%ebx
+    1a9e:	83 ff 02             	cmp    $0x2,%edi
+    1aa1:	76 12                	jbe    1ab5 <malloc+0x45>
+    1aa3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1aa7:	90                   	nop
+    1aa8:	83 c1 01             	add    $0x1,%ecx
+    1aab:	89 c3                	mov    %eax,%ebx
+    1aad:	d3 e3                	shl    %cl,%ebx
+    1aaf:	89 de                	mov    %ebx,%esi
+    1ab1:	39 fb                	cmp    %edi,%ebx
+    1ab3:	72 f3                	jb     1aa8 <malloc+0x38>
+    1ab5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    ;
+  if((tc = mycache()) == 0)
+    1ab8:	e8 d3 fd ff ff       	call   1890 <mycache>
+    1abd:	85 c0                	test   %eax,%eax
+    1abf:	74 51                	je     1b12 <malloc+0xa2>
+    return 0;
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1ac1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1ac4:	8d 3c 88             	lea    (%eax,%ecx,4),%edi
+    1ac7:	8b 07                	mov    (%edi),%eax
+    1ac9:	85 c0                	test   %eax,%eax
+    1acb:	74 53                	je     1b20 <malloc+0xb0>
+    return 0;
+  p = tc->list[c];
+  tc->list[c] = p->s.ptr;
+  tc->n[c]--;
+    1acd:	8b 57 20             	mov    0x20(%edi),%edx
+  tc->list[c] = p->s.ptr;
+    1ad0:	8b 08                	mov    (%eax),%ecx
+  tc->n[c]--;
+    1ad2:	83 ea 01             	sub    $0x1,%edx
+  return (void*)(p + 1);
+    1ad5:	83 c0 08             	add    $0x8,%eax
+  tc->n[c]--;
+    1ad8:	89 57 20             	mov    %edx,0x20(%edi)
+  tc->list[c] = p->s.ptr;
+    1adb:	89 0f                	mov    %ecx,(%edi)
+}
+    1add:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ae0:	5b                   	pop    %ebx
+    1ae1:	5e                   	pop    %esi
+    1ae2:	5f                   	pop    %edi
+    1ae3:	5d                   	pop    %ebp
+    1ae4:	c3                   	ret
+    1ae5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1ae8:	a1 04 37 00 00       	mov    0x3704,%eax
+    1aed:	85 c0                	test   %eax,%eax
+    1aef:	0f 85 b3 00 00 00    	jne    1ba8 <malloc+0x138>
+    p = bigalloc(nunits);
+    1af5:	89 f8                	mov    %edi,%eax
+    1af7:	e8 14 fc ff ff       	call   1710 <bigalloc>
+    1afc:	89 c3                	mov    %eax,%ebx
+  if(threaded)
+    1afe:	a1 04 37 00 00       	mov    0x3704,%eax
+    1b03:	85 c0                	test   %eax,%eax
+    1b05:	0f 85 85 00 00 00    	jne    1b90 <malloc+0x120>
+    return p ? (void*)(p + 1) : 0;
+    1b0b:	8d 43 08             	lea    0x8(%ebx),%eax
+    1b0e:	85 db                	test   %ebx,%ebx
+    1b10:	75 cb                	jne    1add <malloc+0x6d>
+    1b12:	31 c0                	xor    %eax,%eax
+}
+    1b14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b17:	5b                   	pop    %ebx
+    1b18:	5e                   	pop    %esi
+    1b19:	5f                   	pop    %edi
+    1b1a:	5d                   	pop    %ebp
+    1b1b:	c3                   	ret
+    1b1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1b20:	a1 04 37 00 00       	mov    0x3704,%eax
+    1b25:	85 c0                	test   %eax,%eax
+    1b27:	0f 85 29 01 00 00    	jne    1c56 <malloc+0x1e6>
+  if(small[c] == 0){
+    1b2d:	8b 04 8d 60 37 00 00 	mov    0x3760(,%ecx,4),%eax
+    1b34:	85 c0                	test   %eax,%eax
+    1b36:	0f 84 81 00 00 00    	je     1bbd <malloc+0x14d>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1b3c:	31 db                	xor    %ebx,%ebx
+    1b3e:	eb 22                	jmp    1b62 <malloc+0xf2>
+    small[c] = p->s.ptr;
+    1b40:	8b 10                	mov    (%eax),%edx
+  for(moved = 0; moved < n && small[c]; moved++){
+    1b42:	83 c3 01             	add    $0x1,%ebx
+    small[c] = p->s.ptr;
+    1b45:	89 14 8d 60 37 00 00 	mov    %edx,0x3760(,%ecx,4)
+    p->s.ptr = tc->list[c];
+    1b4c:	8b 17                	mov    (%edi),%edx
+    1b4e:	89 10                	mov    %edx,(%eax)
+    tc->list[c] = p;
+    1b50:	89 07                	mov    %eax,(%edi)
+  for(moved = 0; moved < n && small[c]; moved++){
+    1b52:	83 fb 10             	cmp    $0x10,%ebx
+    1b55:	0f 84 e2 00 00 00    	je     1c3d <malloc+0x1cd>
+    1b5b:	8b 04 8d 60 37 00 00 	mov    0x3760(,%ecx,4),%eax
+    1b62:	85 c0                	test   %eax,%eax
+    1b64:	75 da                	jne    1b40 <malloc+0xd0>
+  if(threaded)
+    1b66:	8b 15 04 37 00 00    	mov    0x3704,%edx
+    1b6c:	85 d2                	test   %edx,%edx
+    1b6e:	0f 85 b4 00 00 00    	jne    1c28 <malloc+0x1b8>
+  tc->n[c] += moved;
+    1b74:	8b 57 20             	mov    0x20(%edi),%edx
+    1b77:	01 da                	add    %ebx,%edx
+    1b79:	89 57 20             	mov    %edx,0x20(%edi)
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1b7c:	85 db                	test   %ebx,%ebx
+    1b7e:	74 92                	je     1b12 <malloc+0xa2>
+  p = tc->list[c];
+    1b80:	8b 07                	mov    (%edi),%eax
+    1b82:	e9 49 ff ff ff       	jmp    1ad0 <malloc+0x60>
+    1b87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b8e:	66 90                	xchg   %ax,%ax
+    mutex_unlock(&lock);
+    1b90:	83 ec 0c             	sub    $0xc,%esp
+    1b93:	68 08 37 00 00       	push   $0x3708
+    1b98:	e8 e3 e8 ff ff       	call   480 <mutex_unlock>
+}
+    1b9d:	83 c4 10             	add    $0x10,%esp
+    1ba0:	e9 66 ff ff ff       	jmp    1b0b <malloc+0x9b>
+    1ba5:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1ba8:	83 ec 0c             	sub    $0xc,%esp
+    1bab:	68 08 37 00 00       	push   $0x3708
+    1bb0:	e8 7b e8 ff ff       	call   430 <mutex_lock>
+}
+    1bb5:	83 c4 10             	add    $0x10,%esp
+    1bb8:	e9 38 ff ff ff       	jmp    1af5 <malloc+0x85>
+    if((chunk = bigalloc(CHUNK / sizeof(Header) + 1)) == 0){
+    1bbd:	b8 01 02 00 00       	mov    $0x201,%eax
+    1bc2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1bc5:	e8 46 fb ff ff       	call   1710 <bigalloc>
+    1bca:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1bcd:	85 c0                	test   %eax,%eax
+    1bcf:	89 c2                	mov    %eax,%edx
+    1bd1:	0f 84 ba 00 00 00    	je     1c91 <malloc+0x221>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1bd7:	83 c2 08             	add    $0x8,%edx
+    1bda:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+    1be0:	0f 87 d0 00 00 00    	ja     1cb6 <malloc+0x246>
+    1be6:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+    1bed:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    1bf0:	89 df                	mov    %ebx,%edi
+    1bf2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1bf5:	8d 76 00             	lea    0x0(%esi),%esi
+      p->s.size = units;
+    1bf8:	89 72 04             	mov    %esi,0x4(%edx)
+      p->s.ptr = small[c];
+    1bfb:	8b 04 8d 60 37 00 00 	mov    0x3760(,%ecx,4),%eax
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1c02:	01 df                	add    %ebx,%edi
+    1c04:	89 55 e0             	mov    %edx,-0x20(%ebp)
+      p->s.ptr = small[c];
+    1c07:	89 02                	mov    %eax,(%edx)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1c09:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      small[c] = p;
+    1c0c:	89 14 8d 60 37 00 00 	mov    %edx,0x3760(,%ecx,4)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1c13:	01 c2                	add    %eax,%edx
+    1c15:	81 ff 00 02 00 00    	cmp    $0x200,%edi
+    1c1b:	76 db                	jbe    1bf8 <malloc+0x188>
+    1c1d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1c20:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1c23:	e9 14 ff ff ff       	jmp    1b3c <malloc+0xcc>
+    mutex_unlock(&lock);
+    1c28:	83 ec 0c             	sub    $0xc,%esp
+    1c2b:	68 08 37 00 00       	push   $0x3708
+    1c30:	e8 4b e8 ff ff       	call   480 <mutex_unlock>
+}
+    1c35:	83 c4 10             	add    $0x10,%esp
+    1c38:	e9 37 ff ff ff       	jmp    1b74 <malloc+0x104>
+  if(threaded)
+    1c3d:	a1 04 37 00 00       	mov    0x3704,%eax
+    1c42:	85 c0                	test   %eax,%eax
+    1c44:	75 2b                	jne    1c71 <malloc+0x201>
+  tc->n[c] += moved;
+    1c46:	8b 47 20             	mov    0x20(%edi),%eax
+    1c49:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1c4c:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1c4e:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1c51:	e9 7a fe ff ff       	jmp    1ad0 <malloc+0x60>
+    mutex_lock(&lock);
+    1c56:	83 ec 0c             	sub    $0xc,%esp
+    1c59:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1c5c:	68 08 37 00 00       	push   $0x3708
+    1c61:	e8 ca e7 ff ff       	call   430 <mutex_lock>
+}
+    1c66:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1c69:	83 c4 10             	add    $0x10,%esp
+    1c6c:	e9 bc fe ff ff       	jmp    1b2d <malloc+0xbd>
+    mutex_unlock(&lock);
+    1c71:	83 ec 0c             	sub    $0xc,%esp
+    1c74:	68 08 37 00 00       	push   $0x3708
+    1c79:	e8 02 e8 ff ff       	call   480 <mutex_unlock>
+  tc->n[c] += moved;
+    1c7e:	8b 47 20             	mov    0x20(%edi),%eax
+    1c81:	83 c4 10             	add    $0x10,%esp
+    1c84:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1c87:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1c89:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1c8c:	e9 3f fe ff ff       	jmp    1ad0 <malloc+0x60>
+  if(threaded)
+    1c91:	8b 0d 04 37 00 00    	mov    0x3704,%ecx
+    1c97:	85 c9                	test   %ecx,%ecx
+    1c99:	0f 84 73 fe ff ff    	je     1b12 <malloc+0xa2>
+    mutex_unlock(&lock);
+    1c9f:	83 ec 0c             	sub    $0xc,%esp
+    1ca2:	68 08 37 00 00       	push   $0x3708
+    1ca7:	e8 d4 e7 ff ff       	call   480 <mutex_unlock>
+    1cac:	83 c4 10             	add    $0x10,%esp
+    return p ? (void*)(p + 1) : 0;
+    1caf:	31 c0                	xor    %eax,%eax
+    1cb1:	e9 5e fe ff ff       	jmp    1b14 <malloc+0xa4>
+  for(moved = 0; moved < n && small[c]; moved++){
+    1cb6:	8b 04 8d 60 37 00 00 	mov    0x3760(,%ecx,4),%eax
+    1cbd:	e9 7a fe ff ff       	jmp    1b3c <malloc+0xcc>
+    1cc2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1cc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001cd0 <malloc_threaded>:
+void
+malloc_threaded(void)
+{
+  uint sp;
+
+  if(threaded)
+    1cd0:	a1 04 37 00 00       	mov    0x3704,%eax
+    1cd5:	85 c0                	test   %eax,%eax
+    1cd7:	74 07                	je     1ce0 <malloc_threaded+0x10>
+    1cd9:	c3                   	ret
+    1cda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+{
+    1ce0:	55                   	push   %ebp
+    1ce1:	89 e5                	mov    %esp,%ebp
+    1ce3:	83 ec 24             	sub    $0x24,%esp
+    return;
+  mutex_init(&lock);
+    1ce6:	68 08 37 00 00       	push   $0x3708
+    1ceb:	e8 30 e7 ff ff       	call   420 <mutex_init>
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1cf0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1cf3:	83 c4 10             	add    $0x10,%esp
+  threaded = 1;
+    1cf6:	c7 05 04 37 00 00 01 	movl   $0x1,0x3704
+    1cfd:	00 00 00 
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1d00:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    1d05:	a3 00 37 00 00       	mov    %eax,0x3700
+}
+    1d0a:	c9                   	leave
+    1d0b:	c3                   	ret
+    1d0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001d10 <malloc_thread_exit>:
+
+// Called by thread_join() with the cache slot of a finished
+// thread: give its blocks, and the cache itself, back.
+void
+malloc_thread_exit(void **cachep)
+{
+    1d10:	55                   	push   %ebp
+    1d11:	89 e5                	mov    %esp,%ebp
+    1d13:	57                   	push   %edi
+    1d14:	56                   	push   %esi
+    1d15:	53                   	push   %ebx
+    1d16:	83 ec 0c             	sub    $0xc,%esp
+    1d19:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct tcache *tc;
+  int c;
+
+  if((tc = *cachep) == 0)
+    1d1c:	8b 37                	mov    (%edi),%esi
+    1d1e:	85 f6                	test   %esi,%esi
+    1d20:	74 41                	je     1d63 <malloc_thread_exit+0x53>
+    return;
+  for(c = 0; c < NCLASS; c++)
+    1d22:	31 db                	xor    %ebx,%ebx
+    1d24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    drain(tc, c, tc->n[c]);
+    1d28:	8b 4c 9e 20          	mov    0x20(%esi,%ebx,4),%ecx
+    1d2c:	89 da                	mov    %ebx,%edx
+    1d2e:	89 f0                	mov    %esi,%eax
+  for(c = 0; c < NCLASS; c++)
+    1d30:	83 c3 01             	add    $0x1,%ebx
+    drain(tc, c, tc->n[c]);
+    1d33:	e8 c8 fa ff ff       	call   1800 <drain>
+  for(c = 0; c < NCLASS; c++)
+    1d38:	83 fb 08             	cmp    $0x8,%ebx
+    1d3b:	75 eb                	jne    1d28 <malloc_thread_exit+0x18>
+  if(threaded)
+    1d3d:	8b 15 04 37 00 00    	mov    0x3704,%edx
+    1d43:	85 d2                	test   %edx,%edx
+    1d45:	75 29                	jne    1d70 <malloc_thread_exit+0x60>
+  acquire();
+  trim(bigfree((Header*)tc - 1));
+    1d47:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1d4a:	e8 c1 f8 ff ff       	call   1610 <bigfree>
+    1d4f:	e8 3c f9 ff ff       	call   1690 <trim>
+  if(threaded)
+    1d54:	a1 04 37 00 00       	mov    0x3704,%eax
+    1d59:	85 c0                	test   %eax,%eax
+    1d5b:	75 2b                	jne    1d88 <malloc_thread_exit+0x78>
+  release();
+  *cachep = 0;
+    1d5d:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+}
+    1d63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d66:	5b                   	pop    %ebx
+    1d67:	5e                   	pop    %esi
+    1d68:	5f                   	pop    %edi
+    1d69:	5d                   	pop    %ebp
+    1d6a:	c3                   	ret
+    1d6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1d6f:	90                   	nop
+    mutex_lock(&lock);
+    1d70:	83 ec 0c             	sub    $0xc,%esp
+    1d73:	68 08 37 00 00       	push   $0x3708
+    1d78:	e8 b3 e6 ff ff       	call   430 <mutex_lock>
+}
+    1d7d:	83 c4 10             	add    $0x10,%esp
+    1d80:	eb c5                	jmp    1d47 <malloc_thread_exit+0x37>
+    1d82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1d88:	83 ec 0c             	sub    $0xc,%esp
+    1d8b:	68 08 37 00 00       	push   $0x3708
+    1d90:	e8 eb e6 ff ff       	call   480 <mutex_unlock>
+}
+    1d95:	83 c4 10             	add    $0x10,%esp
+    1d98:	eb c3                	jmp    1d5d <malloc_thread_exit+0x4d>
+    1d9a:	66 90                	xchg   %ax,%ax
+    1d9c:	66 90                	xchg   %ax,%ax
+    1d9e:	66 90                	xchg   %ax,%ax
+
+00001da0 <thread_create>:
+
+// Start fn(arg) in a new thread on a freshly allocated
+// page-aligned stack.  Returns the thread's pid.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1da0:	55                   	push   %ebp
+    1da1:	89 e5                	mov    %esp,%ebp
+    1da3:	53                   	push   %ebx
+    1da4:	83 ec 14             	sub    $0x14,%esp
+  char *mem, *stack;
+  int pid;
+
+  malloc_threaded();
+    1da7:	e8 24 ff ff ff       	call   1cd0 <malloc_threaded>
+  stdio_threaded();
+    1dac:	e8 cf ee ff ff       	call   c80 <stdio_threaded>
+  if((mem = malloc(2*PGSIZE)) == 0)
+    1db1:	83 ec 0c             	sub    $0xc,%esp
+    1db4:	68 00 20 00 00       	push   $0x2000
+    1db9:	e8 b2 fc ff ff       	call   1a70 <malloc>
+    1dbe:	83 c4 10             	add    $0x10,%esp
+    1dc1:	85 c0                	test   %eax,%eax
+    1dc3:	74 52                	je     1e17 <thread_create+0x77>
+    1dc5:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1dc7:	8d 80 07 10 00 00    	lea    0x1007(%eax),%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+  ((char**)stack)[-2] = 0;
+  if((pid = clone(fn, arg, stack)) < 0)
+    1dcd:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1dd0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+    1dd5:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  ((char**)stack)[-2] = 0;
+    1dd8:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+  if((pid = clone(fn, arg, stack)) < 0)
+    1ddf:	50                   	push   %eax
+    1de0:	ff 75 0c             	push   0xc(%ebp)
+    1de3:	ff 75 08             	push   0x8(%ebp)
+    1de6:	e8 97 e8 ff ff       	call   682 <clone>
+    1deb:	83 c4 10             	add    $0x10,%esp
+    1dee:	85 c0                	test   %eax,%eax
+    1df0:	78 0e                	js     1e00 <thread_create+0x60>
+    free(mem);
+  return pid;
+}
+    1df2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1df5:	c9                   	leave
+    1df6:	c3                   	ret
+    1df7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1dfe:	66 90                	xchg   %ax,%ax
+    free(mem);
+    1e00:	83 ec 0c             	sub    $0xc,%esp
+    1e03:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1e06:	53                   	push   %ebx
+    1e07:	e8 34 fb ff ff       	call   1940 <free>
+    1e0c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1e0f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    1e12:	83 c4 10             	add    $0x10,%esp
+}
+    1e15:	c9                   	leave
+    1e16:	c3                   	ret
+    return -1;
+    1e17:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1e1c:	eb d4                	jmp    1df2 <thread_create+0x52>
+    1e1e:	66 90                	xchg   %ax,%ax
+
+00001e20 <thread_join>:
+
+// Wait for a thread to finish and free its stack.
+int
+thread_join(void)
+{
+    1e20:	55                   	push   %ebp
+    1e21:	89 e5                	mov    %esp,%ebp
+    1e23:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    1e24:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    1e27:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    1e2a:	50                   	push   %eax
+    1e2b:	e8 61 e8 ff ff       	call   691 <join>
+    1e30:	83 c4 10             	add    $0x10,%esp
+    1e33:	85 c0                	test   %eax,%eax
+    1e35:	78 29                	js     1e60 <thread_join+0x40>
+    1e37:	89 c3                	mov    %eax,%ebx
+    return -1;
+  malloc_thread_exit(&((void**)stack)[-2]);
+    1e39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1e3c:	83 ec 0c             	sub    $0xc,%esp
+    1e3f:	83 e8 08             	sub    $0x8,%eax
+    1e42:	50                   	push   %eax
+    1e43:	e8 c8 fe ff ff       	call   1d10 <malloc_thread_exit>
+  free(((char**)stack)[-1]);
+    1e48:	58                   	pop    %eax
+    1e49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1e4c:	ff 70 fc             	push   -0x4(%eax)
+    1e4f:	e8 ec fa ff ff       	call   1940 <free>
+  return pid;
+    1e54:	83 c4 10             	add    $0x10,%esp
+}
+    1e57:	89 d8                	mov    %ebx,%eax
+    1e59:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1e5c:	c9                   	leave
+    1e5d:	c3                   	ret
+    1e5e:	66 90                	xchg   %ax,%ax
+    return -1;
+    1e60:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    1e65:	eb f0                	jmp    1e57 <thread_join+0x37>
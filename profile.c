@@ -0,0 +1,60 @@
+// Run a command under the sampling profiler, printing a line
+//   prof cpu pid name k|u eip
+// for every timer tick on every CPU until the command exits.
+// Run profsym.pl on the console output to see where the time went.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "prof.h"
+
+#define NREAD 64
+
+struct sample s[NREAD];
+
+// Print samples until profiling stops.
+void
+dump(void)
+{
+  int i, n;
+
+  while((n = prof(PROF_READ, s, NREAD)) >= 0){
+    for(i = 0; i < n; i++)
+      fprintf(stdout, "prof %d %d %s %s %x\n", s[i].cpu, s[i].pid,
+              s[i].name[0] ? s[i].name : "-", s[i].user ? "u" : "k", s[i].eip);
+    if(n < NREAD){
+      fflush(stdout);
+      sleep(1);
+    }
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  int pid, reader, lost, w;
+
+  if(argc < 2){
+    fprintf(stderr, "usage: profile command [arg ...]\n");
+    exit();
+  }
+  prof(PROF_START, 0, 0);
+  if((pid = fork()) == 0){
+    exec(argv[1], argv+1);
+    fprintf(stderr, "profile: exec %s failed\n", argv[1]);
+    exit();
+  }
+  if((reader = fork()) == 0){
+    dump();
+    exit();
+  }
+  if(pid < 0 || reader < 0)
+    fprintf(stderr, "profile: fork failed\n");
+  while(pid > 0 && (w = wait()) >= 0 && w != pid)
+    ;
+  lost = prof(PROF_STOP, 0, 0);
+  while(wait() >= 0)
+    ;
+  fprintf(stderr, "profile: %d samples lost\n", lost);
+  exit();
+}
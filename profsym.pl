@@ -0,0 +1,67 @@
+#!/usr/bin/perl -w
+
+# Summarize the output of the profile program by function.
+# Reads a console log on standard input or from the named files,
+# looks up kernel addresses in kernel.sym and a user program's
+# addresses in its own .sym file, and prints the functions that
+# took samples, most first.
+#
+#   ./profsym.pl console.log
+
+use strict;
+
+my %syms;       # .sym file => sorted [address, name] pairs
+
+sub loadsyms {
+  my ($file) = @_;
+  my @s;
+
+  return $syms{$file} if exists $syms{$file};
+  if(open(SYM, $file)){
+    while(<SYM>){
+      # Skip file and section names.
+      next unless /^([0-9a-f]+) (\S+)$/;
+      next if $2 =~ /\.[cSo]$/ || $2 =~ /^\./;
+      push @s, [hex($1), $2];
+    }
+    close(SYM);
+  }
+  @s = sort { $a->[0] <=> $b->[0] } @s;
+  return $syms{$file} = \@s;
+}
+
+# Name the function containing addr, by binary search.
+sub lookup {
+  my ($s, $addr) = @_;
+  my ($lo, $hi) = (0, scalar(@$s));
+
+  while($lo < $hi){
+    my $mid = int(($lo + $hi) / 2);
+    if($s->[$mid][0] <= $addr){
+      $lo = $mid + 1;
+    } else {
+      $hi = $mid;
+    }
+  }
+  return $lo > 0 ? $s->[$lo-1][1] : sprintf("0x%x", $addr);
+}
+
+my (%count, $total);
+
+while(<>){
+  next unless /^prof (\d+) (\d+) (\S+) ([ku]) ([0-9a-fA-F]+)$/;
+  my ($name, $user, $addr) = ($3, $4 eq "u", hex($5));
+  my $where;
+  if($user){
+    $where = "$name:" . lookup(loadsyms("$name.sym"), $addr);
+  } else {
+    $where = "kernel:" . lookup(loadsyms("kernel.sym"), $addr);
+  }
+  $count{$where}++;
+  $total++;
+}
+
+die "no samples\n" unless $total;
+foreach my $where (sort { $count{$b} <=> $count{$a} || $a cmp $b } keys %count){
+  printf("%7d %5.1f%% %s\n", $count{$where}, 100 * $count{$where} / $total, $where);
+}
@@ -0,0 +1,33 @@
+// System call submission ring for ringenter().
+// Both the kernel and user programs use this header file.
+//
+// The program queues requests at sq[sqtail % RINGSIZE] and advances
+// sqtail; ringenter() runs them in order, advancing sqhead, and posts
+// each result at cq[cqtail % RINGSIZE]. The program consumes results
+// by advancing cqhead. The indices only ever increase.
+
+#define RINGSIZE 16     // entries in each queue
+
+// A request: system call number op, from the SYS_ constants, and
+// its arguments, laid out as on the user stack for the system call.
+// arg[] has room for the most arguments of any call ringenter()
+// allows, pread() and pwrite()'s four.
+struct sqe {
+  int op;
+  int arg[4];
+  uint data;            // copied to the result
+};
+
+struct cqe {
+  int res;              // what the system call returned
+  uint data;
+};
+
+struct ring {
+  uint sqhead;          // written by the kernel
+  uint sqtail;          // written by the program
+  uint cqhead;          // written by the program
+  uint cqtail;          // written by the kernel
+  struct sqe sq[RINGSIZE];
+  struct cqe cq[RINGSIZE];
+};
@@ -0,0 +1,90 @@
+// Submission ring benchmark.
+// Reads a file NREAD times in 512-byte blocks, first with one
+// read() per block, then with ringenter() running RINGSIZE reads
+// per system call.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "syscall.h"
+#include "ring.h"
+
+#define NREAD  200
+
+struct ring r;
+char buf[RINGSIZE][512];
+
+int
+readplain(int fd)
+{
+  int n, tot;
+
+  tot = 0;
+  while((n = read(fd, buf[0], sizeof(buf[0]))) > 0)
+    tot += n;
+  return tot;
+}
+
+int
+readring(int fd)
+{
+  struct sqe *e;
+  struct cqe *c;
+  int i, tot, eof;
+
+  tot = 0;
+  for(eof = 0; !eof; ){
+    for(i = 0; i < RINGSIZE; i++){
+      e = &r.sq[r.sqtail % RINGSIZE];
+      e->op = SYS_read;
+      e->arg[0] = fd;
+      e->arg[1] = (int)buf[i];
+      e->arg[2] = sizeof(buf[i]);
+      e->data = i;
+      r.sqtail++;
+    }
+    if(ringenter(&r, RINGSIZE) != RINGSIZE){
+      printf(1, "ringbench: ringenter failed\n");
+      exit();
+    }
+    for(; r.cqhead != r.cqtail; r.cqhead++){
+      c = &r.cq[r.cqhead % RINGSIZE];
+      if(c->res <= 0)
+        eof = 1;
+      else
+        tot += c->res;
+    }
+  }
+  return tot;
+}
+
+void
+run(char *name, char *path, int (*fn)(int))
+{
+  int i, fd, t, tot;
+
+  tot = 0;
+  t = uptime();
+  for(i = 0; i < NREAD; i++){
+    if((fd = open(path, O_RDONLY)) < 0){
+      printf(1, "ringbench: cannot open %s\n", path);
+      exit();
+    }
+    tot += fn(fd);
+    close(fd);
+  }
+  t = uptime() - t;
+  printf(1, "%s: %d bytes in %d ticks\n", name, tot, t);
+}
+
+int
+main(int argc, char *argv[])
+{
+  char *path;
+
+  path = argc > 1 ? argv[1] : "README";
+  run("read", path, readplain);
+  run("ringenter", path, readring);
+  exit();
+}
@@ -0,0 +1,4342 @@
+
+_ringcat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	be 01 00 00 00       	mov    $0x1,%esi
+      14:	53                   	push   %ebx
+      15:	51                   	push   %ecx
+      16:	83 ec 18             	sub    $0x18,%esp
+      19:	8b 01                	mov    (%ecx),%eax
+      1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+      1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+      24:	83 f8 01             	cmp    $0x1,%eax
+      27:	7f 26                	jg     4f <main+0x4f>
+      29:	eb 52                	jmp    7d <main+0x7d>
+      2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+      30:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 1; i < argc; i++){
+      33:	83 c6 01             	add    $0x1,%esi
+      36:	83 c3 04             	add    $0x4,%ebx
+    cat(fd);
+      39:	50                   	push   %eax
+      3a:	e8 f1 00 00 00       	call   130 <cat>
+    close(fd);
+      3f:	89 3c 24             	mov    %edi,(%esp)
+      42:	e8 69 07 00 00       	call   7b0 <close>
+  for(i = 1; i < argc; i++){
+      47:	83 c4 10             	add    $0x10,%esp
+      4a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+      4d:	74 29                	je     78 <main+0x78>
+    if((fd = open(argv[i], 0)) < 0){
+      4f:	83 ec 08             	sub    $0x8,%esp
+      52:	6a 00                	push   $0x0
+      54:	ff 33                	push   (%ebx)
+      56:	e8 82 07 00 00       	call   7dd <open>
+      5b:	83 c4 10             	add    $0x10,%esp
+      5e:	89 c7                	mov    %eax,%edi
+      60:	85 c0                	test   %eax,%eax
+      62:	79 cc                	jns    30 <main+0x30>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      64:	50                   	push   %eax
+      65:	ff 33                	push   (%ebx)
+      67:	68 a6 20 00 00       	push   $0x20a6
+      6c:	6a 01                	push   $0x1
+      6e:	e8 6d 0b 00 00       	call   be0 <printf>
+      exit();
+      73:	e8 a8 03 00 00       	call   420 <exit>
+  }
+  exit();
+      78:	e8 a3 03 00 00       	call   420 <exit>
+    cat(0);
+      7d:	83 ec 0c             	sub    $0xc,%esp
+      80:	6a 00                	push   $0x0
+      82:	e8 a9 00 00 00       	call   130 <cat>
+    exit();
+      87:	e8 94 03 00 00       	call   420 <exit>
+      8c:	66 90                	xchg   %ax,%ax
+      8e:	66 90                	xchg   %ax,%ax
+
+00000090 <queue>:
+{
+      90:	55                   	push   %ebp
+      91:	89 e5                	mov    %esp,%ebp
+      93:	53                   	push   %ebx
+  e = &r.sq[r.sqtail % RINGSIZE];
+      94:	8b 15 44 4c 00 00    	mov    0x4c44,%edx
+  e->op = op;
+      9a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  e = &r.sq[r.sqtail % RINGSIZE];
+      9d:	89 d1                	mov    %edx,%ecx
+  r.sqtail++;
+      9f:	83 c2 01             	add    $0x1,%edx
+  e = &r.sq[r.sqtail % RINGSIZE];
+      a2:	83 e1 0f             	and    $0xf,%ecx
+  r.sqtail++;
+      a5:	89 15 44 4c 00 00    	mov    %edx,0x4c44
+  e->op = op;
+      ab:	8d 04 49             	lea    (%ecx,%ecx,2),%eax
+  e->arg[2] = a2;
+      ae:	8d 4c 49 03          	lea    0x3(%ecx,%ecx,2),%ecx
+  e->op = op;
+      b2:	8d 04 c5 40 4c 00 00 	lea    0x4c40(,%eax,8),%eax
+      b9:	89 58 10             	mov    %ebx,0x10(%eax)
+  e->arg[0] = a0;
+      bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  e->arg[3] = 0;
+      bf:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+  e->arg[0] = a0;
+      c6:	89 58 14             	mov    %ebx,0x14(%eax)
+  e->arg[1] = a1;
+      c9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+      cc:	89 58 18             	mov    %ebx,0x18(%eax)
+  e->arg[2] = a2;
+      cf:	8b 5d 14             	mov    0x14(%ebp),%ebx
+      d2:	89 1c cd 44 4c 00 00 	mov    %ebx,0x4c44(,%ecx,8)
+  e->data = data;
+      d9:	8b 4d 18             	mov    0x18(%ebp),%ecx
+      dc:	89 48 24             	mov    %ecx,0x24(%eax)
+}
+      df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      e2:	c9                   	leave
+      e3:	c3                   	ret
+      e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      ef:	90                   	nop
+
+000000f0 <submit>:
+{
+      f0:	55                   	push   %ebp
+      f1:	89 e5                	mov    %esp,%ebp
+      f3:	53                   	push   %ebx
+      f4:	83 ec 0c             	sub    $0xc,%esp
+  n = r.sqtail - r.sqhead;
+      f7:	8b 1d 44 4c 00 00    	mov    0x4c44,%ebx
+      fd:	2b 1d 40 4c 00 00    	sub    0x4c40,%ebx
+  if(ringenter(&r, n) != n){
+     103:	53                   	push   %ebx
+     104:	68 40 4c 00 00       	push   $0x4c40
+     109:	e8 0a 08 00 00       	call   918 <ringenter>
+     10e:	83 c4 10             	add    $0x10,%esp
+     111:	39 d8                	cmp    %ebx,%eax
+     113:	75 05                	jne    11a <submit+0x2a>
+}
+     115:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     118:	c9                   	leave
+     119:	c3                   	ret
+    printf(1, "ringcat: ringenter failed\n");
+     11a:	50                   	push   %eax
+     11b:	50                   	push   %eax
+     11c:	68 68 20 00 00       	push   $0x2068
+     121:	6a 01                	push   $0x1
+     123:	e8 b8 0a 00 00       	call   be0 <printf>
+    exit();
+     128:	e8 f3 02 00 00       	call   420 <exit>
+     12d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000130 <cat>:
+{
+     130:	55                   	push   %ebp
+     131:	89 e5                	mov    %esp,%ebp
+     133:	57                   	push   %edi
+  nbuf = 1;
+     134:	bf 01 00 00 00       	mov    $0x1,%edi
+{
+     139:	56                   	push   %esi
+  if(fstat(fd, &st) == 0 && st.type == T_FILE)
+     13a:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+{
+     13d:	53                   	push   %ebx
+     13e:	83 ec 54             	sub    $0x54,%esp
+  if(fstat(fd, &st) == 0 && st.type == T_FILE)
+     141:	50                   	push   %eax
+     142:	ff 75 08             	push   0x8(%ebp)
+     145:	e8 c0 06 00 00       	call   80a <fstat>
+  nbuf = 1;
+     14a:	89 7d b8             	mov    %edi,-0x48(%ebp)
+  if(fstat(fd, &st) == 0 && st.type == T_FILE)
+     14d:	83 c4 10             	add    $0x10,%esp
+     150:	85 c0                	test   %eax,%eax
+     152:	75 14                	jne    168 <cat+0x38>
+    nbuf = RINGSIZE;
+     154:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+     159:	b8 10 00 00 00       	mov    $0x10,%eax
+     15e:	0f 45 c7             	cmovne %edi,%eax
+     161:	89 45 b8             	mov    %eax,-0x48(%ebp)
+  for(eof = 0; !eof; ){
+     164:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    for(i = 0; i < nbuf; i++)
+     168:	8b 35 44 4c 00 00    	mov    0x4c44,%esi
+     16e:	8b 7d 08             	mov    0x8(%ebp),%edi
+     171:	31 d2                	xor    %edx,%edx
+     173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     177:	90                   	nop
+  e = &r.sq[r.sqtail % RINGSIZE];
+     178:	8d 04 16             	lea    (%esi,%edx,1),%eax
+      queue(SYS_read, fd, (int)buf[i], sizeof(buf[i]), i);
+     17b:	89 d3                	mov    %edx,%ebx
+  e = &r.sq[r.sqtail % RINGSIZE];
+     17d:	83 e0 0f             	and    $0xf,%eax
+      queue(SYS_read, fd, (int)buf[i], sizeof(buf[i]), i);
+     180:	c1 e3 09             	shl    $0x9,%ebx
+  e->op = op;
+     183:	8d 0c 40             	lea    (%eax,%eax,2),%ecx
+      queue(SYS_read, fd, (int)buf[i], sizeof(buf[i]), i);
+     186:	81 c3 40 2c 00 00    	add    $0x2c40,%ebx
+  e->arg[2] = a2;
+     18c:	8d 44 40 03          	lea    0x3(%eax,%eax,2),%eax
+  e->op = op;
+     190:	8d 0c cd 40 4c 00 00 	lea    0x4c40(,%ecx,8),%ecx
+  e->arg[2] = a2;
+     197:	c7 04 c5 44 4c 00 00 	movl   $0x200,0x4c44(,%eax,8)
+     19e:	00 02 00 00 
+  e->data = data;
+     1a2:	89 51 24             	mov    %edx,0x24(%ecx)
+    for(i = 0; i < nbuf; i++)
+     1a5:	83 c2 01             	add    $0x1,%edx
+  e->op = op;
+     1a8:	c7 41 10 05 00 00 00 	movl   $0x5,0x10(%ecx)
+  e->arg[0] = a0;
+     1af:	89 79 14             	mov    %edi,0x14(%ecx)
+      queue(SYS_read, fd, (int)buf[i], sizeof(buf[i]), i);
+     1b2:	89 59 18             	mov    %ebx,0x18(%ecx)
+  e->arg[3] = 0;
+     1b5:	c7 41 20 00 00 00 00 	movl   $0x0,0x20(%ecx)
+    for(i = 0; i < nbuf; i++)
+     1bc:	39 55 b8             	cmp    %edx,-0x48(%ebp)
+     1bf:	75 b7                	jne    178 <cat+0x48>
+  r.sqtail++;
+     1c1:	8b 45 b8             	mov    -0x48(%ebp),%eax
+  if(ringenter(&r, n) != n){
+     1c4:	83 ec 08             	sub    $0x8,%esp
+  r.sqtail++;
+     1c7:	01 c6                	add    %eax,%esi
+     1c9:	89 35 44 4c 00 00    	mov    %esi,0x4c44
+  n = r.sqtail - r.sqhead;
+     1cf:	2b 35 40 4c 00 00    	sub    0x4c40,%esi
+  if(ringenter(&r, n) != n){
+     1d5:	56                   	push   %esi
+     1d6:	68 40 4c 00 00       	push   $0x4c40
+     1db:	e8 38 07 00 00       	call   918 <ringenter>
+     1e0:	83 c4 10             	add    $0x10,%esp
+     1e3:	39 c6                	cmp    %eax,%esi
+     1e5:	0f 85 bd 01 00 00    	jne    3a8 <cat+0x278>
+    for(; r.cqhead != r.cqtail; r.cqhead++){
+     1eb:	8b 0d 4c 4c 00 00    	mov    0x4c4c,%ecx
+     1f1:	31 ff                	xor    %edi,%edi
+     1f3:	31 f6                	xor    %esi,%esi
+     1f5:	31 db                	xor    %ebx,%ebx
+     1f7:	8b 15 44 4c 00 00    	mov    0x4c44,%edx
+     1fd:	a1 48 4c 00 00       	mov    0x4c48,%eax
+     202:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+     205:	89 55 bc             	mov    %edx,-0x44(%ebp)
+     208:	39 c8                	cmp    %ecx,%eax
+     20a:	0f 84 c6 00 00 00    	je     2d6 <cat+0x1a6>
+     210:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+     213:	eb 77                	jmp    28c <cat+0x15c>
+     215:	8d 76 00             	lea    0x0(%esi),%esi
+      if(eof)
+     218:	85 db                	test   %ebx,%ebx
+     21a:	0f 85 89 00 00 00    	jne    2a9 <cat+0x179>
+  e = &r.sq[r.sqtail % RINGSIZE];
+     220:	8b 5d bc             	mov    -0x44(%ebp),%ebx
+      len[c->data] = c->res;
+     223:	8b 34 d5 44 4c 00 00 	mov    0x4c44(,%edx,8),%esi
+    for(; r.cqhead != r.cqtail; r.cqhead++){
+     22a:	83 c0 01             	add    $0x1,%eax
+  r.sqtail++;
+     22d:	83 45 bc 01          	addl   $0x1,-0x44(%ebp)
+  e = &r.sq[r.sqtail % RINGSIZE];
+     231:	83 e3 0f             	and    $0xf,%ebx
+      queue(SYS_write, 1, (int)buf[c->data], c->res, c->data);
+     234:	89 f7                	mov    %esi,%edi
+      len[c->data] = c->res;
+     236:	89 0c b5 00 2c 00 00 	mov    %ecx,0x2c00(,%esi,4)
+  e->op = op;
+     23d:	8d 14 5b             	lea    (%ebx,%ebx,2),%edx
+  e->arg[2] = a2;
+     240:	8d 5c 5b 03          	lea    0x3(%ebx,%ebx,2),%ebx
+      queue(SYS_write, 1, (int)buf[c->data], c->res, c->data);
+     244:	c1 e7 09             	shl    $0x9,%edi
+  e->arg[2] = a2;
+     247:	89 0c dd 44 4c 00 00 	mov    %ecx,0x4c44(,%ebx,8)
+    for(; r.cqhead != r.cqtail; r.cqhead++){
+     24e:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+      queue(SYS_write, 1, (int)buf[c->data], c->res, c->data);
+     251:	81 c7 40 2c 00 00    	add    $0x2c40,%edi
+}
+     257:	31 db                	xor    %ebx,%ebx
+  e->op = op;
+     259:	8d 14 d5 40 4c 00 00 	lea    0x4c40(,%edx,8),%edx
+      queue(SYS_write, 1, (int)buf[c->data], c->res, c->data);
+     260:	89 7a 18             	mov    %edi,0x18(%edx)
+}
+     263:	bf 01 00 00 00       	mov    $0x1,%edi
+  e->data = data;
+     268:	89 72 24             	mov    %esi,0x24(%edx)
+     26b:	be 01 00 00 00       	mov    $0x1,%esi
+  e->op = op;
+     270:	c7 42 10 10 00 00 00 	movl   $0x10,0x10(%edx)
+  e->arg[0] = a0;
+     277:	c7 42 14 01 00 00 00 	movl   $0x1,0x14(%edx)
+  e->arg[3] = 0;
+     27e:	c7 42 20 00 00 00 00 	movl   $0x0,0x20(%edx)
+    for(; r.cqhead != r.cqtail; r.cqhead++){
+     285:	39 c8                	cmp    %ecx,%eax
+     287:	74 34                	je     2bd <cat+0x18d>
+     289:	89 45 c0             	mov    %eax,-0x40(%ebp)
+      c = &r.cq[r.cqhead % RINGSIZE];
+     28c:	89 c2                	mov    %eax,%edx
+     28e:	83 e2 0f             	and    $0xf,%edx
+      if(c->res < 0){
+     291:	83 c2 32             	add    $0x32,%edx
+     294:	8b 0c d5 40 4c 00 00 	mov    0x4c40(,%edx,8),%ecx
+     29b:	85 c9                	test   %ecx,%ecx
+     29d:	0f 88 b5 00 00 00    	js     358 <cat+0x228>
+      if(eof)
+     2a3:	0f 85 6f ff ff ff    	jne    218 <cat+0xe8>
+    for(; r.cqhead != r.cqtail; r.cqhead++){
+     2a9:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+     2ac:	83 c0 01             	add    $0x1,%eax
+     2af:	bb 01 00 00 00       	mov    $0x1,%ebx
+     2b4:	be 01 00 00 00       	mov    $0x1,%esi
+     2b9:	39 c8                	cmp    %ecx,%eax
+     2bb:	75 cc                	jne    289 <cat+0x159>
+     2bd:	89 f9                	mov    %edi,%ecx
+     2bf:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     2c2:	84 c9                	test   %cl,%cl
+     2c4:	74 0b                	je     2d1 <cat+0x1a1>
+     2c6:	8b 7d bc             	mov    -0x44(%ebp),%edi
+     2c9:	89 3d 44 4c 00 00    	mov    %edi,0x4c44
+     2cf:	89 fa                	mov    %edi,%edx
+     2d1:	a3 48 4c 00 00       	mov    %eax,0x4c48
+  if(ringenter(&r, n) != n){
+     2d6:	83 ec 08             	sub    $0x8,%esp
+  n = r.sqtail - r.sqhead;
+     2d9:	89 d6                	mov    %edx,%esi
+     2db:	2b 35 40 4c 00 00    	sub    0x4c40,%esi
+  if(ringenter(&r, n) != n){
+     2e1:	56                   	push   %esi
+     2e2:	68 40 4c 00 00       	push   $0x4c40
+     2e7:	e8 2c 06 00 00       	call   918 <ringenter>
+     2ec:	83 c4 10             	add    $0x10,%esp
+     2ef:	39 c6                	cmp    %eax,%esi
+     2f1:	0f 85 b1 00 00 00    	jne    3a8 <cat+0x278>
+    for(; r.cqhead != r.cqtail; r.cqhead++){
+     2f7:	a1 48 4c 00 00       	mov    0x4c48,%eax
+     2fc:	8b 35 4c 4c 00 00    	mov    0x4c4c,%esi
+     302:	39 c6                	cmp    %eax,%esi
+     304:	74 42                	je     348 <cat+0x218>
+     306:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+     309:	31 ff                	xor    %edi,%edi
+     30b:	8b 5d b0             	mov    -0x50(%ebp),%ebx
+     30e:	eb 02                	jmp    312 <cat+0x1e2>
+     310:	89 c3                	mov    %eax,%ebx
+      c = &r.cq[r.cqhead % RINGSIZE];
+     312:	89 c2                	mov    %eax,%edx
+     314:	83 e2 0f             	and    $0xf,%edx
+      if(c->res != len[c->data]){
+     317:	83 c2 32             	add    $0x32,%edx
+     31a:	8b 0c d5 44 4c 00 00 	mov    0x4c44(,%edx,8),%ecx
+     321:	8b 0c 8d 00 2c 00 00 	mov    0x2c00(,%ecx,4),%ecx
+     328:	39 0c d5 40 4c 00 00 	cmp    %ecx,0x4c40(,%edx,8)
+     32f:	75 57                	jne    388 <cat+0x258>
+    for(; r.cqhead != r.cqtail; r.cqhead++){
+     331:	83 c0 01             	add    $0x1,%eax
+     334:	bf 01 00 00 00       	mov    $0x1,%edi
+     339:	39 f0                	cmp    %esi,%eax
+     33b:	75 d3                	jne    310 <cat+0x1e0>
+     33d:	a3 48 4c 00 00       	mov    %eax,0x4c48
+     342:	89 5d b0             	mov    %ebx,-0x50(%ebp)
+     345:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+  for(eof = 0; !eof; ){
+     348:	85 db                	test   %ebx,%ebx
+     34a:	0f 84 18 fe ff ff    	je     168 <cat+0x38>
+}
+     350:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     353:	5b                   	pop    %ebx
+     354:	5e                   	pop    %esi
+     355:	5f                   	pop    %edi
+     356:	5d                   	pop    %ebp
+     357:	c3                   	ret
+     358:	89 f8                	mov    %edi,%eax
+     35a:	84 c0                	test   %al,%al
+     35c:	74 08                	je     366 <cat+0x236>
+     35e:	8b 45 bc             	mov    -0x44(%ebp),%eax
+     361:	a3 44 4c 00 00       	mov    %eax,0x4c44
+     366:	89 f0                	mov    %esi,%eax
+     368:	84 c0                	test   %al,%al
+     36a:	74 08                	je     374 <cat+0x244>
+     36c:	8b 45 c0             	mov    -0x40(%ebp),%eax
+     36f:	a3 48 4c 00 00       	mov    %eax,0x4c48
+        printf(1, "cat: read error\n");
+     374:	83 ec 08             	sub    $0x8,%esp
+     377:	68 83 20 00 00       	push   $0x2083
+     37c:	6a 01                	push   $0x1
+     37e:	e8 5d 08 00 00       	call   be0 <printf>
+        exit();
+     383:	e8 98 00 00 00       	call   420 <exit>
+     388:	89 f8                	mov    %edi,%eax
+     38a:	84 c0                	test   %al,%al
+     38c:	74 06                	je     394 <cat+0x264>
+     38e:	89 1d 48 4c 00 00    	mov    %ebx,0x4c48
+        printf(1, "cat: write error\n");
+     394:	83 ec 08             	sub    $0x8,%esp
+     397:	68 94 20 00 00       	push   $0x2094
+     39c:	6a 01                	push   $0x1
+     39e:	e8 3d 08 00 00       	call   be0 <printf>
+        exit();
+     3a3:	e8 78 00 00 00       	call   420 <exit>
+    printf(1, "ringcat: ringenter failed\n");
+     3a8:	83 ec 08             	sub    $0x8,%esp
+     3ab:	68 68 20 00 00       	push   $0x2068
+     3b0:	6a 01                	push   $0x1
+     3b2:	e8 29 08 00 00       	call   be0 <printf>
+    exit();
+     3b7:	e8 64 00 00 00       	call   420 <exit>
+     3bc:	66 90                	xchg   %ax,%ax
+     3be:	66 90                	xchg   %ax,%ax
+
+000003c0 <fork>:
+int sysexit(void) __attribute__((noreturn));
+
+int
+fork(void)
+{
+  if(flushhook)
+     3c0:	a1 50 4e 00 00       	mov    0x4e50,%eax
+     3c5:	85 c0                	test   %eax,%eax
+     3c7:	74 17                	je     3e0 <fork+0x20>
+{
+     3c9:	55                   	push   %ebp
+     3ca:	89 e5                	mov    %esp,%ebp
+     3cc:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     3cf:	ff d0                	call   *%eax
+  return sysfork();
+}
+     3d1:	c9                   	leave
+  return sysfork();
+     3d2:	e9 7f 03 00 00       	jmp    756 <sysfork>
+     3d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3de:	66 90                	xchg   %ax,%ax
+     3e0:	e9 71 03 00 00       	jmp    756 <sysfork>
+     3e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003f0 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+     3f0:	55                   	push   %ebp
+  if(flushhook)
+     3f1:	a1 50 4e 00 00       	mov    0x4e50,%eax
+{
+     3f6:	89 e5                	mov    %esp,%ebp
+     3f8:	56                   	push   %esi
+     3f9:	53                   	push   %ebx
+     3fa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     3fd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     400:	85 c0                	test   %eax,%eax
+     402:	74 02                	je     406 <exec+0x16>
+    flushhook();
+     404:	ff d0                	call   *%eax
+  return sysexec(path, argv);
+     406:	89 75 0c             	mov    %esi,0xc(%ebp)
+     409:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     40c:	5b                   	pop    %ebx
+     40d:	5e                   	pop    %esi
+     40e:	5d                   	pop    %ebp
+  return sysexec(path, argv);
+     40f:	e9 ba 03 00 00       	jmp    7ce <sysexec>
+     414:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     41b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     41f:	90                   	nop
+
+00000420 <exit>:
+
+int
+exit(void)
+{
+     420:	55                   	push   %ebp
+     421:	89 e5                	mov    %esp,%ebp
+     423:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     426:	a1 50 4e 00 00       	mov    0x4e50,%eax
+     42b:	85 c0                	test   %eax,%eax
+     42d:	74 02                	je     431 <exit+0x11>
+    flushhook();
+     42f:	ff d0                	call   *%eax
+  sysexit();
+     431:	e8 2f 03 00 00       	call   765 <sysexit>
+     436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     43d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000440 <strcpy>:
+}
+
+char*
+strcpy(char *s, const char *t)
+{
+     440:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     441:	31 c0                	xor    %eax,%eax
+{
+     443:	89 e5                	mov    %esp,%ebp
+     445:	53                   	push   %ebx
+     446:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     449:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     44c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     450:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     454:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     457:	83 c0 01             	add    $0x1,%eax
+     45a:	84 d2                	test   %dl,%dl
+     45c:	75 f2                	jne    450 <strcpy+0x10>
+    ;
+  return os;
+}
+     45e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     461:	89 c8                	mov    %ecx,%eax
+     463:	c9                   	leave
+     464:	c3                   	ret
+     465:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     46c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000470 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     470:	55                   	push   %ebp
+     471:	89 e5                	mov    %esp,%ebp
+     473:	53                   	push   %ebx
+     474:	8b 55 08             	mov    0x8(%ebp),%edx
+     477:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     47a:	0f b6 02             	movzbl (%edx),%eax
+     47d:	84 c0                	test   %al,%al
+     47f:	75 17                	jne    498 <strcmp+0x28>
+     481:	eb 3a                	jmp    4bd <strcmp+0x4d>
+     483:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     487:	90                   	nop
+     488:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     48c:	83 c2 01             	add    $0x1,%edx
+     48f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     492:	84 c0                	test   %al,%al
+     494:	74 1a                	je     4b0 <strcmp+0x40>
+    p++, q++;
+     496:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     498:	0f b6 19             	movzbl (%ecx),%ebx
+     49b:	38 c3                	cmp    %al,%bl
+     49d:	74 e9                	je     488 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     49f:	29 d8                	sub    %ebx,%eax
+}
+     4a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4a4:	c9                   	leave
+     4a5:	c3                   	ret
+     4a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     4b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     4b4:	31 c0                	xor    %eax,%eax
+     4b6:	29 d8                	sub    %ebx,%eax
+}
+     4b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4bb:	c9                   	leave
+     4bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     4bd:	0f b6 19             	movzbl (%ecx),%ebx
+     4c0:	31 c0                	xor    %eax,%eax
+     4c2:	eb db                	jmp    49f <strcmp+0x2f>
+     4c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4cf:	90                   	nop
+
+000004d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     4d0:	55                   	push   %ebp
+     4d1:	89 e5                	mov    %esp,%ebp
+     4d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     4d6:	80 3a 00             	cmpb   $0x0,(%edx)
+     4d9:	74 15                	je     4f0 <strlen+0x20>
+     4db:	31 c0                	xor    %eax,%eax
+     4dd:	8d 76 00             	lea    0x0(%esi),%esi
+     4e0:	83 c0 01             	add    $0x1,%eax
+     4e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     4e7:	89 c1                	mov    %eax,%ecx
+     4e9:	75 f5                	jne    4e0 <strlen+0x10>
+    ;
+  return n;
+}
+     4eb:	89 c8                	mov    %ecx,%eax
+     4ed:	5d                   	pop    %ebp
+     4ee:	c3                   	ret
+     4ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+     4f0:	31 c9                	xor    %ecx,%ecx
+}
+     4f2:	5d                   	pop    %ebp
+     4f3:	89 c8                	mov    %ecx,%eax
+     4f5:	c3                   	ret
+     4f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000500 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     500:	55                   	push   %ebp
+     501:	89 e5                	mov    %esp,%ebp
+     503:	57                   	push   %edi
+     504:	8b 55 08             	mov    0x8(%ebp),%edx
+            "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt) {
+    asm volatile("cld; rep stosb" :
+     507:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     50a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     50d:	89 d7                	mov    %edx,%edi
+     50f:	fc                   	cld
+     510:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     512:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     515:	89 d0                	mov    %edx,%eax
+     517:	c9                   	leave
+     518:	c3                   	ret
+     519:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     520:	55                   	push   %ebp
+     521:	89 e5                	mov    %esp,%ebp
+     523:	8b 45 08             	mov    0x8(%ebp),%eax
+     526:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     52a:	0f b6 10             	movzbl (%eax),%edx
+     52d:	84 d2                	test   %dl,%dl
+     52f:	75 12                	jne    543 <strchr+0x23>
+     531:	eb 1d                	jmp    550 <strchr+0x30>
+     533:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     537:	90                   	nop
+     538:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     53c:	83 c0 01             	add    $0x1,%eax
+     53f:	84 d2                	test   %dl,%dl
+     541:	74 0d                	je     550 <strchr+0x30>
+    if(*s == c)
+     543:	38 d1                	cmp    %dl,%cl
+     545:	75 f1                	jne    538 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     547:	5d                   	pop    %ebp
+     548:	c3                   	ret
+     549:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     550:	31 c0                	xor    %eax,%eax
+}
+     552:	5d                   	pop    %ebp
+     553:	c3                   	ret
+     554:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     55b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     55f:	90                   	nop
+
+00000560 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     560:	55                   	push   %ebp
+     561:	89 e5                	mov    %esp,%ebp
+     563:	56                   	push   %esi
+     564:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     565:	83 ec 08             	sub    $0x8,%esp
+     568:	6a 00                	push   $0x0
+     56a:	ff 75 08             	push   0x8(%ebp)
+     56d:	e8 6b 02 00 00       	call   7dd <open>
+  if(fd < 0)
+     572:	83 c4 10             	add    $0x10,%esp
+     575:	85 c0                	test   %eax,%eax
+     577:	78 27                	js     5a0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     579:	83 ec 08             	sub    $0x8,%esp
+     57c:	ff 75 0c             	push   0xc(%ebp)
+     57f:	89 c3                	mov    %eax,%ebx
+     581:	50                   	push   %eax
+     582:	e8 83 02 00 00       	call   80a <fstat>
+  close(fd);
+     587:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     58a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     58c:	e8 1f 02 00 00       	call   7b0 <close>
+  return r;
+     591:	83 c4 10             	add    $0x10,%esp
+}
+     594:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     597:	89 f0                	mov    %esi,%eax
+     599:	5b                   	pop    %ebx
+     59a:	5e                   	pop    %esi
+     59b:	5d                   	pop    %ebp
+     59c:	c3                   	ret
+     59d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     5a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     5a5:	eb ed                	jmp    594 <stat+0x34>
+     5a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5ae:	66 90                	xchg   %ax,%ax
+
+000005b0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     5b0:	55                   	push   %ebp
+     5b1:	89 e5                	mov    %esp,%ebp
+     5b3:	53                   	push   %ebx
+     5b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     5b7:	0f be 02             	movsbl (%edx),%eax
+     5ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     5bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     5c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     5c5:	77 1e                	ja     5e5 <atoi+0x35>
+     5c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     5d0:	83 c2 01             	add    $0x1,%edx
+     5d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     5d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     5da:	0f be 02             	movsbl (%edx),%eax
+     5dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     5e0:	80 fb 09             	cmp    $0x9,%bl
+     5e3:	76 eb                	jbe    5d0 <atoi+0x20>
+  return n;
+}
+     5e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5e8:	89 c8                	mov    %ecx,%eax
+     5ea:	c9                   	leave
+     5eb:	c3                   	ret
+     5ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005f0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     5f0:	55                   	push   %ebp
+     5f1:	89 e5                	mov    %esp,%ebp
+     5f3:	57                   	push   %edi
+     5f4:	56                   	push   %esi
+     5f5:	8b 45 10             	mov    0x10(%ebp),%eax
+     5f8:	8b 55 08             	mov    0x8(%ebp),%edx
+     5fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     5fe:	85 c0                	test   %eax,%eax
+     600:	7e 13                	jle    615 <memmove+0x25>
+     602:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     604:	89 d7                	mov    %edx,%edi
+     606:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     60d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     610:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     611:	39 f8                	cmp    %edi,%eax
+     613:	75 fb                	jne    610 <memmove+0x20>
+  return vdst;
+}
+     615:	5e                   	pop    %esi
+     616:	89 d0                	mov    %edx,%eax
+     618:	5f                   	pop    %edi
+     619:	5d                   	pop    %ebp
+     61a:	c3                   	ret
+     61b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     61f:	90                   	nop
+
+00000620 <mutex_init>:
+
+// Futex-based mutex (Drepper, "Futexes Are Tricky", mutex 2).
+// The uncontended paths never enter the kernel.
+void
+mutex_init(struct mutex *m)
+{
+     620:	55                   	push   %ebp
+     621:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+     623:	8b 45 08             	mov    0x8(%ebp),%eax
+     626:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     62c:	5d                   	pop    %ebp
+     62d:	c3                   	ret
+     62e:	66 90                	xchg   %ax,%ax
+
+00000630 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     630:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     631:	31 c0                	xor    %eax,%eax
+     633:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+     638:	89 e5                	mov    %esp,%ebp
+     63a:	56                   	push   %esi
+     63b:	53                   	push   %ebx
+     63c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     63f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     643:	85 c0                	test   %eax,%eax
+     645:	74 32                	je     679 <mutex_lock+0x49>
+    return;
+  if(c != 2)
+     647:	83 f8 02             	cmp    $0x2,%eax
+     64a:	74 0c                	je     658 <mutex_lock+0x28>
+static inline uint
+xchg(volatile uint *addr, uint newval) {
+    uint result;
+
+    // The + in "+m" denotes a read-modify-write operand.
+    asm volatile("lock; xchgl %0, %1" :
+     64c:	b8 02 00 00 00       	mov    $0x2,%eax
+     651:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+     654:	85 c0                	test   %eax,%eax
+     656:	74 21                	je     679 <mutex_lock+0x49>
+     658:	be 02 00 00 00       	mov    $0x2,%esi
+     65d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAIT, 2);
+     660:	83 ec 04             	sub    $0x4,%esp
+     663:	6a 02                	push   $0x2
+     665:	6a 00                	push   $0x0
+     667:	53                   	push   %ebx
+     668:	e8 33 02 00 00       	call   8a0 <futex>
+     66d:	89 f0                	mov    %esi,%eax
+     66f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     672:	83 c4 10             	add    $0x10,%esp
+     675:	85 c0                	test   %eax,%eax
+     677:	75 e7                	jne    660 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+     679:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     67c:	5b                   	pop    %ebx
+     67d:	5e                   	pop    %esi
+     67e:	5d                   	pop    %ebp
+     67f:	c3                   	ret
+
+00000680 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     680:	55                   	push   %ebp
+     681:	89 e5                	mov    %esp,%ebp
+     683:	83 ec 08             	sub    $0x8,%esp
+     686:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     689:	f0 83 28 01          	lock subl $0x1,(%eax)
+     68d:	75 09                	jne    698 <mutex_unlock+0x18>
+    m->val = 0;
+    futex(&m->val, FUTEX_WAKE, 1);
+  }
+}
+     68f:	c9                   	leave
+     690:	c3                   	ret
+     691:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     698:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     69b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex(&m->val, FUTEX_WAKE, 1);
+     6a1:	6a 01                	push   $0x1
+     6a3:	6a 01                	push   $0x1
+     6a5:	50                   	push   %eax
+     6a6:	e8 f5 01 00 00       	call   8a0 <futex>
+     6ab:	83 c4 10             	add    $0x10,%esp
+}
+     6ae:	c9                   	leave
+     6af:	c3                   	ret
+
+000006b0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     6b0:	55                   	push   %ebp
+     6b1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     6b3:	8b 45 08             	mov    0x8(%ebp),%eax
+     6b6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     6bc:	5d                   	pop    %ebp
+     6bd:	c3                   	ret
+     6be:	66 90                	xchg   %ax,%ax
+
+000006c0 <cond_wait>:
+
+// Release m and wait for a signal, then reacquire m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     6c0:	55                   	push   %ebp
+     6c1:	89 e5                	mov    %esp,%ebp
+     6c3:	57                   	push   %edi
+     6c4:	56                   	push   %esi
+     6c5:	53                   	push   %ebx
+     6c6:	83 ec 0c             	sub    $0xc,%esp
+     6c9:	8b 75 08             	mov    0x8(%ebp),%esi
+     6cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     6cf:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     6d1:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+     6d5:	75 21                	jne    6f8 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     6d7:	83 ec 04             	sub    $0x4,%esp
+     6da:	57                   	push   %edi
+     6db:	6a 00                	push   $0x0
+     6dd:	56                   	push   %esi
+     6de:	e8 bd 01 00 00       	call   8a0 <futex>
+  mutex_lock(m);
+     6e3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     6e6:	83 c4 10             	add    $0x10,%esp
+}
+     6e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6ec:	5b                   	pop    %ebx
+     6ed:	5e                   	pop    %esi
+     6ee:	5f                   	pop    %edi
+     6ef:	5d                   	pop    %ebp
+  mutex_lock(m);
+     6f0:	e9 3b ff ff ff       	jmp    630 <mutex_lock>
+     6f5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     6f8:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     6fb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex(&m->val, FUTEX_WAKE, 1);
+     701:	6a 01                	push   $0x1
+     703:	6a 01                	push   $0x1
+     705:	53                   	push   %ebx
+     706:	e8 95 01 00 00       	call   8a0 <futex>
+     70b:	83 c4 10             	add    $0x10,%esp
+     70e:	eb c7                	jmp    6d7 <cond_wait+0x17>
+
+00000710 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+     710:	55                   	push   %ebp
+     711:	89 e5                	mov    %esp,%ebp
+     713:	83 ec 0c             	sub    $0xc,%esp
+     716:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     719:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+     71d:	6a 01                	push   $0x1
+     71f:	6a 01                	push   $0x1
+     721:	50                   	push   %eax
+     722:	e8 79 01 00 00       	call   8a0 <futex>
+}
+     727:	83 c4 10             	add    $0x10,%esp
+     72a:	c9                   	leave
+     72b:	c3                   	ret
+     72c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000730 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     730:	55                   	push   %ebp
+     731:	89 e5                	mov    %esp,%ebp
+     733:	83 ec 0c             	sub    $0xc,%esp
+     736:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     739:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+     73d:	6a 40                	push   $0x40
+     73f:	6a 01                	push   $0x1
+     741:	50                   	push   %eax
+     742:	e8 59 01 00 00       	call   8a0 <futex>
+}
+     747:	83 c4 10             	add    $0x10,%esp
+     74a:	c9                   	leave
+     74b:	c3                   	ret
+     74c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000750 <uptime>:
+// Clock ticks since boot, read from the kernel's vdso page
+// without a system call.
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     750:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+     755:	c3                   	ret
+
+00000756 <sysfork>:
+  1: ret
+
+#define SYSCALL(name) SYSCALLAS(name, name)
+
+// ulib.c wraps these.
+SYSCALLAS(sysfork, fork)
+     756:	b8 01 00 00 00       	mov    $0x1,%eax
+     75b:	89 e1                	mov    %esp,%ecx
+     75d:	ba 64 07 00 00       	mov    $0x764,%edx
+     762:	0f 34                	sysenter
+     764:	c3                   	ret
+
+00000765 <sysexit>:
+SYSCALLAS(sysexit, exit)
+     765:	b8 02 00 00 00       	mov    $0x2,%eax
+     76a:	89 e1                	mov    %esp,%ecx
+     76c:	ba 73 07 00 00       	mov    $0x773,%edx
+     771:	0f 34                	sysenter
+     773:	c3                   	ret
+
+00000774 <wait>:
+SYSCALL(wait)
+     774:	b8 03 00 00 00       	mov    $0x3,%eax
+     779:	89 e1                	mov    %esp,%ecx
+     77b:	ba 82 07 00 00       	mov    $0x782,%edx
+     780:	0f 34                	sysenter
+     782:	c3                   	ret
+
+00000783 <pipe>:
+SYSCALL(pipe)
+     783:	b8 04 00 00 00       	mov    $0x4,%eax
+     788:	89 e1                	mov    %esp,%ecx
+     78a:	ba 91 07 00 00       	mov    $0x791,%edx
+     78f:	0f 34                	sysenter
+     791:	c3                   	ret
+
+00000792 <read>:
+SYSCALL(read)
+     792:	b8 05 00 00 00       	mov    $0x5,%eax
+     797:	89 e1                	mov    %esp,%ecx
+     799:	ba a0 07 00 00       	mov    $0x7a0,%edx
+     79e:	0f 34                	sysenter
+     7a0:	c3                   	ret
+
+000007a1 <write>:
+SYSCALL(write)
+     7a1:	b8 10 00 00 00       	mov    $0x10,%eax
+     7a6:	89 e1                	mov    %esp,%ecx
+     7a8:	ba af 07 00 00       	mov    $0x7af,%edx
+     7ad:	0f 34                	sysenter
+     7af:	c3                   	ret
+
+000007b0 <close>:
+SYSCALL(close)
+     7b0:	b8 15 00 00 00       	mov    $0x15,%eax
+     7b5:	89 e1                	mov    %esp,%ecx
+     7b7:	ba be 07 00 00       	mov    $0x7be,%edx
+     7bc:	0f 34                	sysenter
+     7be:	c3                   	ret
+
+000007bf <kill>:
+SYSCALL(kill)
+     7bf:	b8 06 00 00 00       	mov    $0x6,%eax
+     7c4:	89 e1                	mov    %esp,%ecx
+     7c6:	ba cd 07 00 00       	mov    $0x7cd,%edx
+     7cb:	0f 34                	sysenter
+     7cd:	c3                   	ret
+
+000007ce <sysexec>:
+SYSCALLAS(sysexec, exec)
+     7ce:	b8 07 00 00 00       	mov    $0x7,%eax
+     7d3:	89 e1                	mov    %esp,%ecx
+     7d5:	ba dc 07 00 00       	mov    $0x7dc,%edx
+     7da:	0f 34                	sysenter
+     7dc:	c3                   	ret
+
+000007dd <open>:
+SYSCALL(open)
+     7dd:	b8 0f 00 00 00       	mov    $0xf,%eax
+     7e2:	89 e1                	mov    %esp,%ecx
+     7e4:	ba eb 07 00 00       	mov    $0x7eb,%edx
+     7e9:	0f 34                	sysenter
+     7eb:	c3                   	ret
+
+000007ec <mknod>:
+SYSCALL(mknod)
+     7ec:	b8 11 00 00 00       	mov    $0x11,%eax
+     7f1:	89 e1                	mov    %esp,%ecx
+     7f3:	ba fa 07 00 00       	mov    $0x7fa,%edx
+     7f8:	0f 34                	sysenter
+     7fa:	c3                   	ret
+
+000007fb <unlink>:
+SYSCALL(unlink)
+     7fb:	b8 12 00 00 00       	mov    $0x12,%eax
+     800:	89 e1                	mov    %esp,%ecx
+     802:	ba 09 08 00 00       	mov    $0x809,%edx
+     807:	0f 34                	sysenter
+     809:	c3                   	ret
+
+0000080a <fstat>:
+SYSCALL(fstat)
+     80a:	b8 08 00 00 00       	mov    $0x8,%eax
+     80f:	89 e1                	mov    %esp,%ecx
+     811:	ba 18 08 00 00       	mov    $0x818,%edx
+     816:	0f 34                	sysenter
+     818:	c3                   	ret
+
+00000819 <link>:
+SYSCALL(link)
+     819:	b8 13 00 00 00       	mov    $0x13,%eax
+     81e:	89 e1                	mov    %esp,%ecx
+     820:	ba 27 08 00 00       	mov    $0x827,%edx
+     825:	0f 34                	sysenter
+     827:	c3                   	ret
+
+00000828 <mkdir>:
+SYSCALL(mkdir)
+     828:	b8 14 00 00 00       	mov    $0x14,%eax
+     82d:	89 e1                	mov    %esp,%ecx
+     82f:	ba 36 08 00 00       	mov    $0x836,%edx
+     834:	0f 34                	sysenter
+     836:	c3                   	ret
+
+00000837 <chdir>:
+SYSCALL(chdir)
+     837:	b8 09 00 00 00       	mov    $0x9,%eax
+     83c:	89 e1                	mov    %esp,%ecx
+     83e:	ba 45 08 00 00       	mov    $0x845,%edx
+     843:	0f 34                	sysenter
+     845:	c3                   	ret
+
+00000846 <dup>:
+SYSCALL(dup)
+     846:	b8 0a 00 00 00       	mov    $0xa,%eax
+     84b:	89 e1                	mov    %esp,%ecx
+     84d:	ba 54 08 00 00       	mov    $0x854,%edx
+     852:	0f 34                	sysenter
+     854:	c3                   	ret
+
+00000855 <getpid>:
+SYSCALL(getpid)
+     855:	b8 0b 00 00 00       	mov    $0xb,%eax
+     85a:	89 e1                	mov    %esp,%ecx
+     85c:	ba 63 08 00 00       	mov    $0x863,%edx
+     861:	0f 34                	sysenter
+     863:	c3                   	ret
+
+00000864 <sbrk>:
+SYSCALL(sbrk)
+     864:	b8 0c 00 00 00       	mov    $0xc,%eax
+     869:	89 e1                	mov    %esp,%ecx
+     86b:	ba 72 08 00 00       	mov    $0x872,%edx
+     870:	0f 34                	sysenter
+     872:	c3                   	ret
+
+00000873 <sleep>:
+SYSCALL(sleep)
+     873:	b8 0d 00 00 00       	mov    $0xd,%eax
+     878:	89 e1                	mov    %esp,%ecx
+     87a:	ba 81 08 00 00       	mov    $0x881,%edx
+     87f:	0f 34                	sysenter
+     881:	c3                   	ret
+
+00000882 <clone>:
+SYSCALL(clone)
+     882:	b8 16 00 00 00       	mov    $0x16,%eax
+     887:	89 e1                	mov    %esp,%ecx
+     889:	ba 90 08 00 00       	mov    $0x890,%edx
+     88e:	0f 34                	sysenter
+     890:	c3                   	ret
+
+00000891 <join>:
+SYSCALL(join)
+     891:	b8 17 00 00 00       	mov    $0x17,%eax
+     896:	89 e1                	mov    %esp,%ecx
+     898:	ba 9f 08 00 00       	mov    $0x89f,%edx
+     89d:	0f 34                	sysenter
+     89f:	c3                   	ret
+
+000008a0 <futex>:
+SYSCALL(futex)
+     8a0:	b8 18 00 00 00       	mov    $0x18,%eax
+     8a5:	89 e1                	mov    %esp,%ecx
+     8a7:	ba ae 08 00 00       	mov    $0x8ae,%edx
+     8ac:	0f 34                	sysenter
+     8ae:	c3                   	ret
+
+000008af <yield>:
+SYSCALL(yield)
+     8af:	b8 19 00 00 00       	mov    $0x19,%eax
+     8b4:	89 e1                	mov    %esp,%ecx
+     8b6:	ba bd 08 00 00       	mov    $0x8bd,%edx
+     8bb:	0f 34                	sysenter
+     8bd:	c3                   	ret
+
+000008be <lockstat>:
+SYSCALL(lockstat)
+     8be:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     8c3:	89 e1                	mov    %esp,%ecx
+     8c5:	ba cc 08 00 00       	mov    $0x8cc,%edx
+     8ca:	0f 34                	sysenter
+     8cc:	c3                   	ret
+
+000008cd <lockhammer>:
+SYSCALL(lockhammer)
+     8cd:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     8d2:	89 e1                	mov    %esp,%ecx
+     8d4:	ba db 08 00 00       	mov    $0x8db,%edx
+     8d9:	0f 34                	sysenter
+     8db:	c3                   	ret
+
+000008dc <vmsplice>:
+SYSCALL(vmsplice)
+     8dc:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     8e1:	89 e1                	mov    %esp,%ecx
+     8e3:	ba ea 08 00 00       	mov    $0x8ea,%edx
+     8e8:	0f 34                	sysenter
+     8ea:	c3                   	ret
+
+000008eb <hsbrk>:
+SYSCALL(hsbrk)
+     8eb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     8f0:	89 e1                	mov    %esp,%ecx
+     8f2:	ba f9 08 00 00       	mov    $0x8f9,%edx
+     8f7:	0f 34                	sysenter
+     8f9:	c3                   	ret
+
+000008fa <mmap>:
+SYSCALL(mmap)
+     8fa:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     8ff:	89 e1                	mov    %esp,%ecx
+     901:	ba 08 09 00 00       	mov    $0x908,%edx
+     906:	0f 34                	sysenter
+     908:	c3                   	ret
+
+00000909 <munmap>:
+SYSCALL(munmap)
+     909:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     90e:	89 e1                	mov    %esp,%ecx
+     910:	ba 17 09 00 00       	mov    $0x917,%edx
+     915:	0f 34                	sysenter
+     917:	c3                   	ret
+
+00000918 <ringenter>:
+SYSCALL(ringenter)
+     918:	b8 20 00 00 00       	mov    $0x20,%eax
+     91d:	89 e1                	mov    %esp,%ecx
+     91f:	ba 26 09 00 00       	mov    $0x926,%edx
+     924:	0f 34                	sysenter
+     926:	c3                   	ret
+
+00000927 <readv>:
+SYSCALL(readv)
+     927:	b8 21 00 00 00       	mov    $0x21,%eax
+     92c:	89 e1                	mov    %esp,%ecx
+     92e:	ba 35 09 00 00       	mov    $0x935,%edx
+     933:	0f 34                	sysenter
+     935:	c3                   	ret
+
+00000936 <writev>:
+SYSCALL(writev)
+     936:	b8 22 00 00 00       	mov    $0x22,%eax
+     93b:	89 e1                	mov    %esp,%ecx
+     93d:	ba 44 09 00 00       	mov    $0x944,%edx
+     942:	0f 34                	sysenter
+     944:	c3                   	ret
+
+00000945 <pread>:
+SYSCALL(pread)
+     945:	b8 23 00 00 00       	mov    $0x23,%eax
+     94a:	89 e1                	mov    %esp,%ecx
+     94c:	ba 53 09 00 00       	mov    $0x953,%edx
+     951:	0f 34                	sysenter
+     953:	c3                   	ret
+
+00000954 <pwrite>:
+SYSCALL(pwrite)
+     954:	b8 24 00 00 00       	mov    $0x24,%eax
+     959:	89 e1                	mov    %esp,%ecx
+     95b:	ba 62 09 00 00       	mov    $0x962,%edx
+     960:	0f 34                	sysenter
+     962:	c3                   	ret
+
+00000963 <prof>:
+SYSCALL(prof)
+     963:	b8 25 00 00 00       	mov    $0x25,%eax
+     968:	89 e1                	mov    %esp,%ecx
+     96a:	ba 71 09 00 00       	mov    $0x971,%edx
+     96f:	0f 34                	sysenter
+     971:	c3                   	ret
+
+00000972 <scstat>:
+SYSCALL(scstat)
+     972:	b8 26 00 00 00       	mov    $0x26,%eax
+     977:	89 e1                	mov    %esp,%ecx
+     979:	ba 80 09 00 00       	mov    $0x980,%edx
+     97e:	0f 34                	sysenter
+     980:	c3                   	ret
+     981:	66 90                	xchg   %ax,%ax
+     983:	66 90                	xchg   %ax,%ax
+     985:	66 90                	xchg   %ax,%ax
+     987:	66 90                	xchg   %ax,%ax
+     989:	66 90                	xchg   %ax,%ax
+     98b:	66 90                	xchg   %ax,%ax
+     98d:	66 90                	xchg   %ax,%ax
+     98f:	90                   	nop
+
+00000990 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+     990:	55                   	push   %ebp
+     991:	89 e5                	mov    %esp,%ebp
+     993:	57                   	push   %edi
+     994:	56                   	push   %esi
+     995:	53                   	push   %ebx
+     996:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     998:	89 d1                	mov    %edx,%ecx
+{
+     99a:	83 ec 2c             	sub    $0x2c,%esp
+     99d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+     9a0:	85 d2                	test   %edx,%edx
+     9a2:	79 7c                	jns    a20 <printint+0x90>
+     9a4:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     9a8:	74 76                	je     a20 <printint+0x90>
+    x = -xx;
+     9aa:	f7 d9                	neg    %ecx
+    neg = 1;
+     9ac:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     9b1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     9b4:	31 f6                	xor    %esi,%esi
+     9b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9bd:	8d 76 00             	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     9c0:	89 c8                	mov    %ecx,%eax
+     9c2:	31 d2                	xor    %edx,%edx
+     9c4:	89 f7                	mov    %esi,%edi
+     9c6:	f7 f3                	div    %ebx
+     9c8:	8d 76 01             	lea    0x1(%esi),%esi
+     9cb:	0f b6 92 1c 21 00 00 	movzbl 0x211c(%edx),%edx
+     9d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     9d6:	89 ca                	mov    %ecx,%edx
+     9d8:	89 c1                	mov    %eax,%ecx
+     9da:	39 da                	cmp    %ebx,%edx
+     9dc:	73 e2                	jae    9c0 <printint+0x30>
+  if(neg)
+     9de:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     9e1:	85 c0                	test   %eax,%eax
+     9e3:	74 07                	je     9ec <printint+0x5c>
+    buf[i++] = '-';
+     9e5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     9ea:	89 f7                	mov    %esi,%edi
+     9ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     9ef:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     9f2:	01 df                	add    %ebx,%edi
+     9f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc_unlocked(buf[i], f);
+     9f8:	83 ec 08             	sub    $0x8,%esp
+     9fb:	56                   	push   %esi
+     9fc:	0f be 07             	movsbl (%edi),%eax
+     9ff:	50                   	push   %eax
+     a00:	e8 cb 07 00 00       	call   11d0 <putc_unlocked>
+  while(--i >= 0)
+     a05:	89 f8                	mov    %edi,%eax
+     a07:	83 c4 10             	add    $0x10,%esp
+     a0a:	83 ef 01             	sub    $0x1,%edi
+     a0d:	39 d8                	cmp    %ebx,%eax
+     a0f:	75 e7                	jne    9f8 <printint+0x68>
+}
+     a11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a14:	5b                   	pop    %ebx
+     a15:	5e                   	pop    %esi
+     a16:	5f                   	pop    %edi
+     a17:	5d                   	pop    %ebp
+     a18:	c3                   	ret
+     a19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     a20:	31 c0                	xor    %eax,%eax
+     a22:	eb 8d                	jmp    9b1 <printint+0x21>
+     a24:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a2f:	90                   	nop
+
+00000a30 <vfprintf>:
+
+// Print to the given stream, which the caller has locked.
+// Only understands %d, %x, %p, %s.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+     a30:	55                   	push   %ebp
+     a31:	89 e5                	mov    %esp,%ebp
+     a33:	57                   	push   %edi
+     a34:	56                   	push   %esi
+     a35:	53                   	push   %ebx
+     a36:	83 ec 1c             	sub    $0x1c,%esp
+     a39:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     a3c:	0f b6 0a             	movzbl (%edx),%ecx
+     a3f:	84 c9                	test   %cl,%cl
+     a41:	74 5c                	je     a9f <vfprintf+0x6f>
+     a43:	89 c6                	mov    %eax,%esi
+     a45:	8d 5a 01             	lea    0x1(%edx),%ebx
+     a48:	31 ff                	xor    %edi,%edi
+     a4a:	eb 20                	jmp    a6c <vfprintf+0x3c>
+     a4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     a50:	83 f9 25             	cmp    $0x25,%ecx
+     a53:	74 3b                	je     a90 <vfprintf+0x60>
+        state = '%';
+      } else {
+        putc_unlocked(c, f);
+     a55:	83 ec 08             	sub    $0x8,%esp
+     a58:	56                   	push   %esi
+     a59:	51                   	push   %ecx
+     a5a:	e8 71 07 00 00       	call   11d0 <putc_unlocked>
+     a5f:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     a62:	0f b6 0b             	movzbl (%ebx),%ecx
+     a65:	83 c3 01             	add    $0x1,%ebx
+     a68:	84 c9                	test   %cl,%cl
+     a6a:	74 33                	je     a9f <vfprintf+0x6f>
+    if(state == 0){
+     a6c:	85 ff                	test   %edi,%edi
+     a6e:	74 e0                	je     a50 <vfprintf+0x20>
+      }
+    } else if(state == '%'){
+     a70:	83 ff 25             	cmp    $0x25,%edi
+     a73:	75 ed                	jne    a62 <vfprintf+0x32>
+      if(c == 'd'){
+     a75:	83 f9 25             	cmp    $0x25,%ecx
+     a78:	0f 84 02 01 00 00    	je     b80 <vfprintf+0x150>
+     a7e:	8d 41 9d             	lea    -0x63(%ecx),%eax
+     a81:	83 f8 15             	cmp    $0x15,%eax
+     a84:	77 2a                	ja     ab0 <vfprintf+0x80>
+     a86:	ff 24 85 c4 20 00 00 	jmp    *0x20c4(,%eax,4)
+     a8d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     a90:	0f b6 0b             	movzbl (%ebx),%ecx
+     a93:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     a96:	bf 25 00 00 00       	mov    $0x25,%edi
+  for(i = 0; fmt[i]; i++){
+     a9b:	84 c9                	test   %cl,%cl
+     a9d:	75 cd                	jne    a6c <vfprintf+0x3c>
+        putc_unlocked(c, f);
+      }
+      state = 0;
+    }
+  }
+}
+     a9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     aa2:	5b                   	pop    %ebx
+     aa3:	5e                   	pop    %esi
+     aa4:	5f                   	pop    %edi
+     aa5:	5d                   	pop    %ebp
+     aa6:	c3                   	ret
+     aa7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aae:	66 90                	xchg   %ax,%ax
+        putc_unlocked('%', f);
+     ab0:	83 ec 08             	sub    $0x8,%esp
+     ab3:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     ab6:	56                   	push   %esi
+     ab7:	6a 25                	push   $0x25
+     ab9:	e8 12 07 00 00       	call   11d0 <putc_unlocked>
+        putc_unlocked(c, f);
+     abe:	58                   	pop    %eax
+     abf:	5a                   	pop    %edx
+     ac0:	56                   	push   %esi
+     ac1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     ac4:	51                   	push   %ecx
+     ac5:	e8 06 07 00 00       	call   11d0 <putc_unlocked>
+     aca:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     acd:	31 ff                	xor    %edi,%edi
+     acf:	eb 91                	jmp    a62 <vfprintf+0x32>
+     ad1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+     ad8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     adb:	83 ec 0c             	sub    $0xc,%esp
+     ade:	b9 10 00 00 00       	mov    $0x10,%ecx
+     ae3:	8b 17                	mov    (%edi),%edx
+     ae5:	6a 00                	push   $0x0
+        ap++;
+     ae7:	83 c7 04             	add    $0x4,%edi
+        printint(f, *ap, 16, 0);
+     aea:	89 f0                	mov    %esi,%eax
+     aec:	e8 9f fe ff ff       	call   990 <printint>
+        ap++;
+     af1:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     af4:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     af7:	31 ff                	xor    %edi,%edi
+     af9:	e9 64 ff ff ff       	jmp    a62 <vfprintf+0x32>
+     afe:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     b00:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     b03:	8b 10                	mov    (%eax),%edx
+        ap++;
+     b05:	83 c0 04             	add    $0x4,%eax
+     b08:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     b0b:	85 d2                	test   %edx,%edx
+     b0d:	0f 84 85 00 00 00    	je     b98 <vfprintf+0x168>
+        while(*s != 0){
+     b13:	0f be 02             	movsbl (%edx),%eax
+        s = (char*)*ap;
+     b16:	89 d7                	mov    %edx,%edi
+        while(*s != 0){
+     b18:	84 c0                	test   %al,%al
+     b1a:	74 b1                	je     acd <vfprintf+0x9d>
+     b1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+          putc_unlocked(*s, f);
+     b20:	83 ec 08             	sub    $0x8,%esp
+          s++;
+     b23:	83 c7 01             	add    $0x1,%edi
+          putc_unlocked(*s, f);
+     b26:	56                   	push   %esi
+     b27:	50                   	push   %eax
+     b28:	e8 a3 06 00 00       	call   11d0 <putc_unlocked>
+        while(*s != 0){
+     b2d:	0f be 07             	movsbl (%edi),%eax
+     b30:	83 c4 10             	add    $0x10,%esp
+     b33:	84 c0                	test   %al,%al
+     b35:	75 e9                	jne    b20 <vfprintf+0xf0>
+      state = 0;
+     b37:	31 ff                	xor    %edi,%edi
+     b39:	e9 24 ff ff ff       	jmp    a62 <vfprintf+0x32>
+     b3e:	66 90                	xchg   %ax,%ax
+        printint(f, *ap, 10, 1);
+     b40:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     b43:	83 ec 0c             	sub    $0xc,%esp
+     b46:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     b4b:	8b 17                	mov    (%edi),%edx
+     b4d:	6a 01                	push   $0x1
+     b4f:	eb 96                	jmp    ae7 <vfprintf+0xb7>
+     b51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc_unlocked(*ap, f);
+     b58:	83 ec 08             	sub    $0x8,%esp
+     b5b:	56                   	push   %esi
+     b5c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     b5f:	ff 37                	push   (%edi)
+     b61:	e8 6a 06 00 00       	call   11d0 <putc_unlocked>
+        ap++;
+     b66:	89 f8                	mov    %edi,%eax
+     b68:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     b6b:	31 ff                	xor    %edi,%edi
+        ap++;
+     b6d:	83 c0 04             	add    $0x4,%eax
+     b70:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     b73:	e9 ea fe ff ff       	jmp    a62 <vfprintf+0x32>
+     b78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b7f:	90                   	nop
+        putc_unlocked(c, f);
+     b80:	83 ec 08             	sub    $0x8,%esp
+      state = 0;
+     b83:	31 ff                	xor    %edi,%edi
+        putc_unlocked(c, f);
+     b85:	56                   	push   %esi
+     b86:	6a 25                	push   $0x25
+     b88:	e8 43 06 00 00       	call   11d0 <putc_unlocked>
+     b8d:	83 c4 10             	add    $0x10,%esp
+     b90:	e9 cd fe ff ff       	jmp    a62 <vfprintf+0x32>
+     b95:	8d 76 00             	lea    0x0(%esi),%esi
+     b98:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     b9d:	bf bb 20 00 00       	mov    $0x20bb,%edi
+     ba2:	e9 79 ff ff ff       	jmp    b20 <vfprintf+0xf0>
+     ba7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bae:	66 90                	xchg   %ax,%ax
+
+00000bb0 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+     bb0:	55                   	push   %ebp
+     bb1:	89 e5                	mov    %esp,%ebp
+     bb3:	53                   	push   %ebx
+     bb4:	83 ec 10             	sub    $0x10,%esp
+     bb7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  flockfile(f);
+     bba:	53                   	push   %ebx
+     bbb:	e8 d0 02 00 00       	call   e90 <flockfile>
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     bc0:	8b 55 0c             	mov    0xc(%ebp),%edx
+     bc3:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     bc6:	89 d8                	mov    %ebx,%eax
+     bc8:	e8 63 fe ff ff       	call   a30 <vfprintf>
+  funlockfile(f);
+     bcd:	89 1c 24             	mov    %ebx,(%esp)
+     bd0:	e8 eb 02 00 00       	call   ec0 <funlockfile>
+}
+     bd5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     bd8:	83 c4 10             	add    $0x10,%esp
+     bdb:	c9                   	leave
+     bdc:	c3                   	ret
+     bdd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000be0 <printf>:
+
+// Print to the given fd: through stdout or stderr for 1 and 2,
+// otherwise with one write() per call.
+void
+printf(int fd, const char *fmt, ...)
+{
+     be0:	55                   	push   %ebp
+     be1:	89 e5                	mov    %esp,%ebp
+     be3:	56                   	push   %esi
+     be4:	53                   	push   %ebx
+     be5:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+     beb:	8b 45 08             	mov    0x8(%ebp),%eax
+  char buf[128];
+  struct iobuf f;
+
+  if(fd == 1 || fd == 2){
+    flockfile(&_iob[fd]);
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     bee:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(fd == 1 || fd == 2){
+     bf1:	8d 50 ff             	lea    -0x1(%eax),%edx
+     bf4:	83 fa 01             	cmp    $0x1,%edx
+     bf7:	76 77                	jbe    c70 <printf+0x90>
+    funlockfile(&_iob[fd]);
+    return;
+  }
+  f.fd = fd;
+     bf9:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  f.flags = IO_WRITE|IO_SETUP;
+  f.buf = buf;
+     bff:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  f.size = sizeof(buf);
+  f.r = f.n = 0;
+  mutex_init(&f.lock);
+     c05:	83 ec 0c             	sub    $0xc,%esp
+     c08:	8d 9d 5c ff ff ff    	lea    -0xa4(%ebp),%ebx
+  f.buf = buf;
+     c0e:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+  mutex_init(&f.lock);
+     c14:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  f.flags = IO_WRITE|IO_SETUP;
+     c1a:	c7 85 60 ff ff ff 42 	movl   $0x42,-0xa0(%ebp)
+     c21:	00 00 00 
+  f.size = sizeof(buf);
+     c24:	c7 85 68 ff ff ff 80 	movl   $0x80,-0x98(%ebp)
+     c2b:	00 00 00 
+  f.r = f.n = 0;
+     c2e:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+     c35:	00 00 00 
+     c38:	c7 85 6c ff ff ff 00 	movl   $0x0,-0x94(%ebp)
+     c3f:	00 00 00 
+  mutex_init(&f.lock);
+     c42:	50                   	push   %eax
+     c43:	e8 d8 f9 ff ff       	call   620 <mutex_init>
+  vfprintf(&f, fmt, (uint*)(void*)&fmt + 1);
+     c48:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     c4b:	89 f2                	mov    %esi,%edx
+     c4d:	89 d8                	mov    %ebx,%eax
+     c4f:	e8 dc fd ff ff       	call   a30 <vfprintf>
+  fflush(&f);
+     c54:	89 1c 24             	mov    %ebx,(%esp)
+     c57:	e8 f4 04 00 00       	call   1150 <fflush>
+     c5c:	83 c4 10             	add    $0x10,%esp
+}
+     c5f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     c62:	5b                   	pop    %ebx
+     c63:	5e                   	pop    %esi
+     c64:	5d                   	pop    %ebp
+     c65:	c3                   	ret
+     c66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c6d:	8d 76 00             	lea    0x0(%esi),%esi
+    flockfile(&_iob[fd]);
+     c70:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     c73:	83 ec 0c             	sub    $0xc,%esp
+     c76:	8d 98 20 2b 00 00    	lea    0x2b20(%eax),%ebx
+     c7c:	53                   	push   %ebx
+     c7d:	e8 0e 02 00 00       	call   e90 <flockfile>
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     c82:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     c85:	89 f2                	mov    %esi,%edx
+     c87:	89 d8                	mov    %ebx,%eax
+     c89:	e8 a2 fd ff ff       	call   a30 <vfprintf>
+    funlockfile(&_iob[fd]);
+     c8e:	89 1c 24             	mov    %ebx,(%esp)
+     c91:	e8 2a 02 00 00       	call   ec0 <funlockfile>
+     c96:	83 c4 10             	add    $0x10,%esp
+}
+     c99:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     c9c:	5b                   	pop    %ebx
+     c9d:	5e                   	pop    %esi
+     c9e:	5d                   	pop    %ebp
+     c9f:	c3                   	ret
+
+00000ca0 <setup>:
+}
+
+// Choose how to buffer f on first use: by lines on a device.
+static void
+setup(FILE *f)
+{
+     ca0:	55                   	push   %ebp
+     ca1:	89 e5                	mov    %esp,%ebp
+     ca3:	53                   	push   %ebx
+     ca4:	89 c3                	mov    %eax,%ebx
+     ca6:	83 ec 2c             	sub    $0x2c,%esp
+  struct stat st;
+
+  f->flags |= IO_SETUP;
+     ca9:	83 48 04 40          	orl    $0x40,0x4(%eax)
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     cad:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     cb0:	50                   	push   %eax
+     cb1:	ff 33                	push   (%ebx)
+     cb3:	e8 52 fb ff ff       	call   80a <fstat>
+     cb8:	83 c4 10             	add    $0x10,%esp
+     cbb:	85 c0                	test   %eax,%eax
+    f->flags |= IO_DEV|IO_LINE;
+     cbd:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     cc0:	75 07                	jne    cc9 <setup+0x29>
+     cc2:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+     cc7:	74 17                	je     ce0 <setup+0x40>
+  if(f->flags & IO_WRITE)
+     cc9:	a8 02                	test   $0x2,%al
+     ccb:	74 0a                	je     cd7 <setup+0x37>
+    flushhook = flushall;
+     ccd:	c7 05 50 4e 00 00 00 	movl   $0xe00,0x4e50
+     cd4:	0e 00 00 
+}
+     cd7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     cda:	c9                   	leave
+     cdb:	c3                   	ret
+     cdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    f->flags |= IO_DEV|IO_LINE;
+     ce0:	83 c8 30             	or     $0x30,%eax
+     ce3:	89 43 04             	mov    %eax,0x4(%ebx)
+     ce6:	eb e1                	jmp    cc9 <setup+0x29>
+     ce8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cef:	90                   	nop
+
+00000cf0 <flush>:
+static int
+flush(FILE *f)
+{
+  int i, n;
+
+  if(!(f->flags & IO_WRITE))
+     cf0:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+     cf4:	74 6a                	je     d60 <flush+0x70>
+{
+     cf6:	55                   	push   %ebp
+     cf7:	89 e5                	mov    %esp,%ebp
+     cf9:	56                   	push   %esi
+     cfa:	89 c6                	mov    %eax,%esi
+     cfc:	53                   	push   %ebx
+    return 0;
+  for(i = 0; i < f->n; i += n){
+     cfd:	8b 40 14             	mov    0x14(%eax),%eax
+     d00:	85 c0                	test   %eax,%eax
+     d02:	7e 4c                	jle    d50 <flush+0x60>
+     d04:	31 db                	xor    %ebx,%ebx
+     d06:	eb 11                	jmp    d19 <flush+0x29>
+     d08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d0f:	90                   	nop
+     d10:	01 c3                	add    %eax,%ebx
+     d12:	8b 46 14             	mov    0x14(%esi),%eax
+     d15:	39 d8                	cmp    %ebx,%eax
+     d17:	7e 37                	jle    d50 <flush+0x60>
+    if((n = write(f->fd, f->buf + i, f->n - i)) <= 0){
+     d19:	83 ec 04             	sub    $0x4,%esp
+     d1c:	29 d8                	sub    %ebx,%eax
+     d1e:	50                   	push   %eax
+     d1f:	8b 46 08             	mov    0x8(%esi),%eax
+     d22:	01 d8                	add    %ebx,%eax
+     d24:	50                   	push   %eax
+     d25:	ff 36                	push   (%esi)
+     d27:	e8 75 fa ff ff       	call   7a1 <write>
+     d2c:	83 c4 10             	add    $0x10,%esp
+     d2f:	85 c0                	test   %eax,%eax
+     d31:	7f dd                	jg     d10 <flush+0x20>
+      f->flags |= IO_ERR;
+     d33:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+      f->n = 0;
+     d37:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     d3c:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+      return EOF;
+    }
+  }
+  f->n = 0;
+  return 0;
+}
+     d43:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d46:	5b                   	pop    %ebx
+     d47:	5e                   	pop    %esi
+     d48:	5d                   	pop    %ebp
+     d49:	c3                   	ret
+     d4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->n = 0;
+     d50:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+}
+     d57:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+     d5a:	31 c0                	xor    %eax,%eax
+}
+     d5c:	5b                   	pop    %ebx
+     d5d:	5e                   	pop    %esi
+     d5e:	5d                   	pop    %ebp
+     d5f:	c3                   	ret
+    return 0;
+     d60:	31 c0                	xor    %eax,%eax
+}
+     d62:	c3                   	ret
+     d63:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000d70 <fflush.part.0>:
+fflush(FILE *f)
+     d70:	55                   	push   %ebp
+     d71:	89 e5                	mov    %esp,%ebp
+     d73:	57                   	push   %edi
+     d74:	bf 18 2c 00 00       	mov    $0x2c18,%edi
+     d79:	56                   	push   %esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     d7a:	31 f6                	xor    %esi,%esi
+fflush(FILE *f)
+     d7c:	53                   	push   %ebx
+     d7d:	bb 38 2b 00 00       	mov    $0x2b38,%ebx
+     d82:	83 ec 1c             	sub    $0x1c,%esp
+     d85:	eb 10                	jmp    d97 <fflush.part.0+0x27>
+     d87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d8e:	66 90                	xchg   %ax,%ax
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     d90:	83 c3 1c             	add    $0x1c,%ebx
+     d93:	39 df                	cmp    %ebx,%edi
+     d95:	74 33                	je     dca <fflush.part.0+0x5a>
+      if((f->flags & IO_WRITE) && fflush(f) < 0)
+     d97:	f6 43 ec 02          	testb  $0x2,-0x14(%ebx)
+     d9b:	74 f3                	je     d90 <fflush.part.0+0x20>
+  if(threaded)
+     d9d:	8b 0d 60 4e 00 00    	mov    0x4e60,%ecx
+     da3:	85 c9                	test   %ecx,%ecx
+     da5:	75 49                	jne    df0 <fflush.part.0+0x80>
+  r = flush(f);
+     da7:	8d 43 e8             	lea    -0x18(%ebx),%eax
+     daa:	e8 41 ff ff ff       	call   cf0 <flush>
+  if(threaded)
+     daf:	8b 15 60 4e 00 00    	mov    0x4e60,%edx
+     db5:	85 d2                	test   %edx,%edx
+     db7:	75 1f                	jne    dd8 <fflush.part.0+0x68>
+        r = EOF;
+     db9:	85 c0                	test   %eax,%eax
+     dbb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     dc0:	0f 48 f0             	cmovs  %eax,%esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     dc3:	83 c3 1c             	add    $0x1c,%ebx
+     dc6:	39 df                	cmp    %ebx,%edi
+     dc8:	75 cd                	jne    d97 <fflush.part.0+0x27>
+}
+     dca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     dcd:	89 f0                	mov    %esi,%eax
+     dcf:	5b                   	pop    %ebx
+     dd0:	5e                   	pop    %esi
+     dd1:	5f                   	pop    %edi
+     dd2:	5d                   	pop    %ebp
+     dd3:	c3                   	ret
+     dd4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     dd8:	83 ec 0c             	sub    $0xc,%esp
+     ddb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     dde:	53                   	push   %ebx
+     ddf:	e8 9c f8 ff ff       	call   680 <mutex_unlock>
+     de4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     de7:	83 c4 10             	add    $0x10,%esp
+     dea:	eb cd                	jmp    db9 <fflush.part.0+0x49>
+     dec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     df0:	83 ec 0c             	sub    $0xc,%esp
+     df3:	53                   	push   %ebx
+     df4:	e8 37 f8 ff ff       	call   630 <mutex_lock>
+     df9:	83 c4 10             	add    $0x10,%esp
+     dfc:	eb a9                	jmp    da7 <fflush.part.0+0x37>
+     dfe:	66 90                	xchg   %ax,%ax
+
+00000e00 <flushall>:
+  if(f == 0){
+     e00:	e9 6b ff ff ff       	jmp    d70 <fflush.part.0>
+     e05:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000e10 <fill>:
+
+// Refill f's buffer. Returns the number of bytes read.
+// Caller holds f's lock.
+static int
+fill(FILE *f)
+{
+     e10:	55                   	push   %ebp
+     e11:	89 e5                	mov    %esp,%ebp
+     e13:	53                   	push   %ebx
+     e14:	89 c3                	mov    %eax,%ebx
+     e16:	83 ec 04             	sub    $0x4,%esp
+  int n;
+
+  if(!(f->flags & IO_SETUP))
+     e19:	8b 40 04             	mov    0x4(%eax),%eax
+     e1c:	a8 40                	test   $0x40,%al
+     e1e:	74 50                	je     e70 <fill+0x60>
+    setup(f);
+  if(f->flags & IO_DEV)
+     e20:	a8 20                	test   $0x20,%al
+     e22:	75 3c                	jne    e60 <fill+0x50>
+    fflush(0);
+  f->r = 0;
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     e24:	83 ec 04             	sub    $0x4,%esp
+  f->r = 0;
+     e27:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     e2e:	ff 73 0c             	push   0xc(%ebx)
+     e31:	ff 73 08             	push   0x8(%ebx)
+     e34:	ff 33                	push   (%ebx)
+     e36:	e8 57 f9 ff ff       	call   792 <read>
+     e3b:	83 c4 10             	add    $0x10,%esp
+     e3e:	85 c0                	test   %eax,%eax
+     e40:	7f 10                	jg     e52 <fill+0x42>
+    f->flags |= n < 0 ? IO_ERR : IO_EOF;
+     e42:	83 f8 01             	cmp    $0x1,%eax
+     e45:	19 c0                	sbb    %eax,%eax
+     e47:	83 e0 fc             	and    $0xfffffffc,%eax
+     e4a:	83 c0 08             	add    $0x8,%eax
+     e4d:	09 43 04             	or     %eax,0x4(%ebx)
+    n = 0;
+     e50:	31 c0                	xor    %eax,%eax
+  }
+  f->n = n;
+     e52:	89 43 14             	mov    %eax,0x14(%ebx)
+  return n;
+}
+     e55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e58:	c9                   	leave
+     e59:	c3                   	ret
+     e5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == 0){
+     e60:	e8 0b ff ff ff       	call   d70 <fflush.part.0>
+     e65:	eb bd                	jmp    e24 <fill+0x14>
+     e67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e6e:	66 90                	xchg   %ax,%ax
+    setup(f);
+     e70:	89 d8                	mov    %ebx,%eax
+     e72:	e8 29 fe ff ff       	call   ca0 <setup>
+  if(f->flags & IO_DEV)
+     e77:	8b 43 04             	mov    0x4(%ebx),%eax
+     e7a:	eb a4                	jmp    e20 <fill+0x10>
+     e7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000e80 <stdio_threaded>:
+  threaded = 1;
+     e80:	c7 05 60 4e 00 00 01 	movl   $0x1,0x4e60
+     e87:	00 00 00 
+}
+     e8a:	c3                   	ret
+     e8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e8f:	90                   	nop
+
+00000e90 <flockfile>:
+{
+     e90:	55                   	push   %ebp
+  if(threaded)
+     e91:	8b 15 60 4e 00 00    	mov    0x4e60,%edx
+{
+     e97:	89 e5                	mov    %esp,%ebp
+     e99:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     e9c:	85 d2                	test   %edx,%edx
+     e9e:	75 08                	jne    ea8 <flockfile+0x18>
+}
+     ea0:	5d                   	pop    %ebp
+     ea1:	c3                   	ret
+     ea2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_lock(&f->lock);
+     ea8:	83 c0 18             	add    $0x18,%eax
+     eab:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     eae:	5d                   	pop    %ebp
+    mutex_lock(&f->lock);
+     eaf:	e9 7c f7 ff ff       	jmp    630 <mutex_lock>
+     eb4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ebb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ebf:	90                   	nop
+
+00000ec0 <funlockfile>:
+{
+     ec0:	55                   	push   %ebp
+  if(threaded)
+     ec1:	8b 15 60 4e 00 00    	mov    0x4e60,%edx
+{
+     ec7:	89 e5                	mov    %esp,%ebp
+     ec9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     ecc:	85 d2                	test   %edx,%edx
+     ece:	75 08                	jne    ed8 <funlockfile+0x18>
+}
+     ed0:	5d                   	pop    %ebp
+     ed1:	c3                   	ret
+     ed2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&f->lock);
+     ed8:	83 c0 18             	add    $0x18,%eax
+     edb:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     ede:	5d                   	pop    %ebp
+    mutex_unlock(&f->lock);
+     edf:	e9 9c f7 ff ff       	jmp    680 <mutex_unlock>
+     ee4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     eeb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     eef:	90                   	nop
+
+00000ef0 <fopen>:
+{
+     ef0:	55                   	push   %ebp
+     ef1:	89 e5                	mov    %esp,%ebp
+     ef3:	57                   	push   %edi
+     ef4:	56                   	push   %esi
+     ef5:	53                   	push   %ebx
+     ef6:	83 ec 34             	sub    $0x34,%esp
+     ef9:	8b 75 0c             	mov    0xc(%ebp),%esi
+     efc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(strcmp(mode, "r") != 0 && strcmp(mode, "w") != 0)
+     eff:	68 2d 21 00 00       	push   $0x212d
+     f04:	56                   	push   %esi
+     f05:	e8 66 f5 ff ff       	call   470 <strcmp>
+     f0a:	83 c4 10             	add    $0x10,%esp
+     f0d:	85 c0                	test   %eax,%eax
+     f0f:	74 15                	je     f26 <fopen+0x36>
+     f11:	83 ec 08             	sub    $0x8,%esp
+     f14:	68 2f 21 00 00       	push   $0x212f
+     f19:	56                   	push   %esi
+     f1a:	e8 51 f5 ff ff       	call   470 <strcmp>
+     f1f:	83 c4 10             	add    $0x10,%esp
+     f22:	85 c0                	test   %eax,%eax
+     f24:	75 2c                	jne    f52 <fopen+0x62>
+  if(threaded)
+     f26:	a1 60 4e 00 00       	mov    0x4e60,%eax
+     f2b:	85 c0                	test   %eax,%eax
+     f2d:	0f 85 ed 00 00 00    	jne    1020 <fopen+0x130>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     f33:	bb 74 2b 00 00       	mov    $0x2b74,%ebx
+    if(f->flags == 0)
+     f38:	8b 53 04             	mov    0x4(%ebx),%edx
+     f3b:	85 d2                	test   %edx,%edx
+     f3d:	74 21                	je     f60 <fopen+0x70>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     f3f:	83 c3 1c             	add    $0x1c,%ebx
+     f42:	81 fb 00 2c 00 00    	cmp    $0x2c00,%ebx
+     f48:	75 ee                	jne    f38 <fopen+0x48>
+  if(threaded)
+     f4a:	85 c0                	test   %eax,%eax
+     f4c:	0f 85 36 01 00 00    	jne    1088 <fopen+0x198>
+    return 0;
+     f52:	31 db                	xor    %ebx,%ebx
+     f54:	e9 96 00 00 00       	jmp    fef <fopen+0xff>
+     f59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f == &_iob[NSTREAM])
+     f60:	81 fb 00 2c 00 00    	cmp    $0x2c00,%ebx
+     f66:	74 e2                	je     f4a <fopen+0x5a>
+    f->flags = IO_MALLOC;
+     f68:	c7 43 04 80 00 00 00 	movl   $0x80,0x4(%ebx)
+  if(threaded)
+     f6f:	85 c0                	test   %eax,%eax
+     f71:	0f 85 f9 00 00 00    	jne    1070 <fopen+0x180>
+  if(mode[0] == 'r'){
+     f77:	80 3e 72             	cmpb   $0x72,(%esi)
+     f7a:	0f 84 c0 00 00 00    	je     1040 <fopen+0x150>
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     f80:	83 ec 08             	sub    $0x8,%esp
+     f83:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     f86:	50                   	push   %eax
+     f87:	57                   	push   %edi
+     f88:	e8 d3 f5 ff ff       	call   560 <stat>
+     f8d:	83 c4 10             	add    $0x10,%esp
+     f90:	85 c0                	test   %eax,%eax
+     f92:	74 6c                	je     1000 <fopen+0x110>
+    fd = open(path, O_CREATE|O_WRONLY);
+     f94:	83 ec 08             	sub    $0x8,%esp
+     f97:	68 01 02 00 00       	push   $0x201
+     f9c:	57                   	push   %edi
+    flags = IO_WRITE;
+     f9d:	bf 02 00 00 00       	mov    $0x2,%edi
+    fd = open(path, O_CREATE|O_WRONLY);
+     fa2:	e8 36 f8 ff ff       	call   7dd <open>
+     fa7:	83 c4 10             	add    $0x10,%esp
+     faa:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     fac:	85 f6                	test   %esi,%esi
+     fae:	0f 88 a9 00 00 00    	js     105d <fopen+0x16d>
+     fb4:	83 ec 0c             	sub    $0xc,%esp
+     fb7:	68 00 02 00 00       	push   $0x200
+     fbc:	e8 af 0c 00 00       	call   1c70 <malloc>
+     fc1:	83 c4 10             	add    $0x10,%esp
+     fc4:	89 43 08             	mov    %eax,0x8(%ebx)
+     fc7:	85 c0                	test   %eax,%eax
+     fc9:	0f 84 d0 00 00 00    	je     109f <fopen+0x1af>
+  f->flags = flags|IO_MALLOC;
+     fcf:	81 cf 80 00 00 00    	or     $0x80,%edi
+  f->fd = fd;
+     fd5:	89 33                	mov    %esi,(%ebx)
+  f->size = BUFSIZ;
+     fd7:	c7 43 0c 00 02 00 00 	movl   $0x200,0xc(%ebx)
+  f->r = f->n = 0;
+     fde:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+     fe5:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  f->flags = flags|IO_MALLOC;
+     fec:	89 7b 04             	mov    %edi,0x4(%ebx)
+}
+     fef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ff2:	89 d8                	mov    %ebx,%eax
+     ff4:	5b                   	pop    %ebx
+     ff5:	5e                   	pop    %esi
+     ff6:	5f                   	pop    %edi
+     ff7:	5d                   	pop    %ebp
+     ff8:	c3                   	ret
+     ff9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+    1000:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+    1005:	75 8d                	jne    f94 <fopen+0xa4>
+      unlink(path);
+    1007:	83 ec 0c             	sub    $0xc,%esp
+    100a:	57                   	push   %edi
+    100b:	e8 eb f7 ff ff       	call   7fb <unlink>
+    1010:	83 c4 10             	add    $0x10,%esp
+    1013:	e9 7c ff ff ff       	jmp    f94 <fopen+0xa4>
+    1018:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    101f:	90                   	nop
+    mutex_lock(&iolock);
+    1020:	83 ec 0c             	sub    $0xc,%esp
+    1023:	68 64 4e 00 00       	push   $0x4e64
+    1028:	e8 03 f6 ff ff       	call   630 <mutex_lock>
+  if(threaded)
+    102d:	a1 60 4e 00 00       	mov    0x4e60,%eax
+    1032:	83 c4 10             	add    $0x10,%esp
+    1035:	e9 f9 fe ff ff       	jmp    f33 <fopen+0x43>
+    103a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    fd = open(path, O_RDONLY);
+    1040:	83 ec 08             	sub    $0x8,%esp
+    1043:	6a 00                	push   $0x0
+    1045:	57                   	push   %edi
+    flags = IO_READ;
+    1046:	bf 01 00 00 00       	mov    $0x1,%edi
+    fd = open(path, O_RDONLY);
+    104b:	e8 8d f7 ff ff       	call   7dd <open>
+    1050:	83 c4 10             	add    $0x10,%esp
+    1053:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+    1055:	85 f6                	test   %esi,%esi
+    1057:	0f 89 57 ff ff ff    	jns    fb4 <fopen+0xc4>
+    f->flags = 0;
+    105d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    return 0;
+    1064:	31 db                	xor    %ebx,%ebx
+    1066:	eb 87                	jmp    fef <fopen+0xff>
+    1068:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    106f:	90                   	nop
+    mutex_unlock(&iolock);
+    1070:	83 ec 0c             	sub    $0xc,%esp
+    1073:	68 64 4e 00 00       	push   $0x4e64
+    1078:	e8 03 f6 ff ff       	call   680 <mutex_unlock>
+    107d:	83 c4 10             	add    $0x10,%esp
+    1080:	e9 f2 fe ff ff       	jmp    f77 <fopen+0x87>
+    1085:	8d 76 00             	lea    0x0(%esi),%esi
+    1088:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+    108b:	31 db                	xor    %ebx,%ebx
+    mutex_unlock(&iolock);
+    108d:	68 64 4e 00 00       	push   $0x4e64
+    1092:	e8 e9 f5 ff ff       	call   680 <mutex_unlock>
+    1097:	83 c4 10             	add    $0x10,%esp
+    109a:	e9 50 ff ff ff       	jmp    fef <fopen+0xff>
+      close(fd);
+    109f:	83 ec 0c             	sub    $0xc,%esp
+    10a2:	56                   	push   %esi
+    10a3:	e8 08 f7 ff ff       	call   7b0 <close>
+    10a8:	83 c4 10             	add    $0x10,%esp
+    10ab:	eb b0                	jmp    105d <fopen+0x16d>
+    10ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000010b0 <fclose>:
+{
+    10b0:	55                   	push   %ebp
+    10b1:	89 e5                	mov    %esp,%ebp
+    10b3:	56                   	push   %esi
+    10b4:	53                   	push   %ebx
+  if(threaded)
+    10b5:	8b 15 60 4e 00 00    	mov    0x4e60,%edx
+{
+    10bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    10be:	85 d2                	test   %edx,%edx
+    10c0:	75 46                	jne    1108 <fclose+0x58>
+  r = flush(f);
+    10c2:	89 d8                	mov    %ebx,%eax
+    10c4:	e8 27 fc ff ff       	call   cf0 <flush>
+  if(close(f->fd) < 0)
+    10c9:	83 ec 0c             	sub    $0xc,%esp
+    10cc:	ff 33                	push   (%ebx)
+  r = flush(f);
+    10ce:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    10d0:	e8 db f6 ff ff       	call   7b0 <close>
+    10d5:	83 c4 10             	add    $0x10,%esp
+    r = EOF;
+    10d8:	85 c0                	test   %eax,%eax
+    10da:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    10df:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->flags & IO_MALLOC)
+    10e2:	f6 43 04 80          	testb  $0x80,0x4(%ebx)
+    10e6:	75 58                	jne    1140 <fclose+0x90>
+  if(threaded)
+    10e8:	a1 60 4e 00 00       	mov    0x4e60,%eax
+  f->flags = 0;
+    10ed:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  if(threaded)
+    10f4:	85 c0                	test   %eax,%eax
+    10f6:	75 28                	jne    1120 <fclose+0x70>
+}
+    10f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    10fb:	89 f0                	mov    %esi,%eax
+    10fd:	5b                   	pop    %ebx
+    10fe:	5e                   	pop    %esi
+    10ff:	5d                   	pop    %ebp
+    1100:	c3                   	ret
+    1101:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    1108:	83 ec 0c             	sub    $0xc,%esp
+    110b:	8d 43 18             	lea    0x18(%ebx),%eax
+    110e:	50                   	push   %eax
+    110f:	e8 1c f5 ff ff       	call   630 <mutex_lock>
+    1114:	83 c4 10             	add    $0x10,%esp
+    1117:	eb a9                	jmp    10c2 <fclose+0x12>
+    1119:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1120:	83 ec 0c             	sub    $0xc,%esp
+    1123:	83 c3 18             	add    $0x18,%ebx
+    1126:	53                   	push   %ebx
+    1127:	e8 54 f5 ff ff       	call   680 <mutex_unlock>
+    112c:	83 c4 10             	add    $0x10,%esp
+}
+    112f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1132:	89 f0                	mov    %esi,%eax
+    1134:	5b                   	pop    %ebx
+    1135:	5e                   	pop    %esi
+    1136:	5d                   	pop    %ebp
+    1137:	c3                   	ret
+    1138:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    113f:	90                   	nop
+    free(f->buf);
+    1140:	83 ec 0c             	sub    $0xc,%esp
+    1143:	ff 73 08             	push   0x8(%ebx)
+    1146:	e8 f5 09 00 00       	call   1b40 <free>
+    114b:	83 c4 10             	add    $0x10,%esp
+    114e:	eb 98                	jmp    10e8 <fclose+0x38>
+
+00001150 <fflush>:
+{
+    1150:	55                   	push   %ebp
+    1151:	89 e5                	mov    %esp,%ebp
+    1153:	53                   	push   %ebx
+    1154:	83 ec 14             	sub    $0x14,%esp
+    1157:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f == 0){
+    115a:	85 db                	test   %ebx,%ebx
+    115c:	74 5a                	je     11b8 <fflush+0x68>
+  if(threaded)
+    115e:	8b 0d 60 4e 00 00    	mov    0x4e60,%ecx
+    1164:	85 c9                	test   %ecx,%ecx
+    1166:	75 18                	jne    1180 <fflush+0x30>
+  r = flush(f);
+    1168:	89 d8                	mov    %ebx,%eax
+    116a:	e8 81 fb ff ff       	call   cf0 <flush>
+  if(threaded)
+    116f:	8b 15 60 4e 00 00    	mov    0x4e60,%edx
+    1175:	85 d2                	test   %edx,%edx
+    1177:	75 1f                	jne    1198 <fflush+0x48>
+}
+    1179:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    117c:	c9                   	leave
+    117d:	c3                   	ret
+    117e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    1180:	83 ec 0c             	sub    $0xc,%esp
+    1183:	8d 43 18             	lea    0x18(%ebx),%eax
+    1186:	50                   	push   %eax
+    1187:	e8 a4 f4 ff ff       	call   630 <mutex_lock>
+    118c:	83 c4 10             	add    $0x10,%esp
+    118f:	eb d7                	jmp    1168 <fflush+0x18>
+    1191:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1198:	83 ec 0c             	sub    $0xc,%esp
+    119b:	83 c3 18             	add    $0x18,%ebx
+    119e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    11a1:	53                   	push   %ebx
+    11a2:	e8 d9 f4 ff ff       	call   680 <mutex_unlock>
+    11a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    11aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    mutex_unlock(&f->lock);
+    11ad:	83 c4 10             	add    $0x10,%esp
+}
+    11b0:	c9                   	leave
+    11b1:	c3                   	ret
+    11b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    11b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    11bb:	c9                   	leave
+    11bc:	e9 af fb ff ff       	jmp    d70 <fflush.part.0>
+    11c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11cf:	90                   	nop
+
+000011d0 <putc_unlocked>:
+{
+    11d0:	55                   	push   %ebp
+    11d1:	89 e5                	mov    %esp,%ebp
+    11d3:	56                   	push   %esi
+    11d4:	53                   	push   %ebx
+    11d5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    11d8:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(!(f->flags & IO_WRITE))
+    11db:	8b 43 04             	mov    0x4(%ebx),%eax
+    11de:	a8 02                	test   $0x2,%al
+    11e0:	74 46                	je     1228 <putc_unlocked+0x58>
+  if(!(f->flags & IO_SETUP))
+    11e2:	a8 40                	test   $0x40,%al
+    11e4:	74 4a                	je     1230 <putc_unlocked+0x60>
+  if(f->n == f->size && flush(f) < 0)
+    11e6:	8b 43 14             	mov    0x14(%ebx),%eax
+    11e9:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    11ec:	74 51                	je     123f <putc_unlocked+0x6f>
+  f->buf[f->n++] = c;
+    11ee:	8d 48 01             	lea    0x1(%eax),%ecx
+    11f1:	8b 53 08             	mov    0x8(%ebx),%edx
+    11f4:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    11f7:	89 f1                	mov    %esi,%ecx
+    11f9:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    11fc:	83 fe 0a             	cmp    $0xa,%esi
+    11ff:	74 0f                	je     1210 <putc_unlocked+0x40>
+  return c & 0xff;
+    1201:	89 f0                	mov    %esi,%eax
+    1203:	0f b6 c0             	movzbl %al,%eax
+}
+    1206:	5b                   	pop    %ebx
+    1207:	5e                   	pop    %esi
+    1208:	5d                   	pop    %ebp
+    1209:	c3                   	ret
+    120a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    1210:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1214:	74 eb                	je     1201 <putc_unlocked+0x31>
+    1216:	89 d8                	mov    %ebx,%eax
+    1218:	e8 d3 fa ff ff       	call   cf0 <flush>
+    121d:	85 c0                	test   %eax,%eax
+    121f:	79 e0                	jns    1201 <putc_unlocked+0x31>
+    1221:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return EOF;
+    1228:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    122d:	eb d7                	jmp    1206 <putc_unlocked+0x36>
+    122f:	90                   	nop
+    setup(f);
+    1230:	89 d8                	mov    %ebx,%eax
+    1232:	e8 69 fa ff ff       	call   ca0 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    1237:	8b 43 14             	mov    0x14(%ebx),%eax
+    123a:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    123d:	75 af                	jne    11ee <putc_unlocked+0x1e>
+    123f:	89 d8                	mov    %ebx,%eax
+    1241:	e8 aa fa ff ff       	call   cf0 <flush>
+    1246:	85 c0                	test   %eax,%eax
+    1248:	78 de                	js     1228 <putc_unlocked+0x58>
+  f->buf[f->n++] = c;
+    124a:	8b 43 14             	mov    0x14(%ebx),%eax
+    124d:	eb 9f                	jmp    11ee <putc_unlocked+0x1e>
+    124f:	90                   	nop
+
+00001250 <fputc>:
+{
+    1250:	55                   	push   %ebp
+    1251:	89 e5                	mov    %esp,%ebp
+    1253:	56                   	push   %esi
+    1254:	53                   	push   %ebx
+  if(threaded)
+    1255:	8b 15 60 4e 00 00    	mov    0x4e60,%edx
+{
+    125b:	8b 75 08             	mov    0x8(%ebp),%esi
+    125e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(threaded)
+    1261:	85 d2                	test   %edx,%edx
+    1263:	75 6b                	jne    12d0 <fputc+0x80>
+  if(!(f->flags & IO_WRITE))
+    1265:	8b 43 04             	mov    0x4(%ebx),%eax
+    1268:	a8 02                	test   $0x2,%al
+    126a:	0f 84 b8 00 00 00    	je     1328 <fputc+0xd8>
+  if(!(f->flags & IO_SETUP))
+    1270:	a8 40                	test   $0x40,%al
+    1272:	74 76                	je     12ea <fputc+0x9a>
+  if(f->n == f->size && flush(f) < 0)
+    1274:	8b 43 14             	mov    0x14(%ebx),%eax
+    1277:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    127a:	74 7d                	je     12f9 <fputc+0xa9>
+  f->buf[f->n++] = c;
+    127c:	8d 48 01             	lea    0x1(%eax),%ecx
+    127f:	8b 53 08             	mov    0x8(%ebx),%edx
+    1282:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    1285:	89 f1                	mov    %esi,%ecx
+    1287:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    128a:	83 fe 0a             	cmp    $0xa,%esi
+    128d:	74 21                	je     12b0 <fputc+0x60>
+  return c & 0xff;
+    128f:	89 f0                	mov    %esi,%eax
+    1291:	0f b6 f0             	movzbl %al,%esi
+  if(threaded)
+    1294:	a1 60 4e 00 00       	mov    0x4e60,%eax
+    1299:	85 c0                	test   %eax,%eax
+    129b:	75 73                	jne    1310 <fputc+0xc0>
+}
+    129d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12a0:	89 f0                	mov    %esi,%eax
+    12a2:	5b                   	pop    %ebx
+    12a3:	5e                   	pop    %esi
+    12a4:	5d                   	pop    %ebp
+    12a5:	c3                   	ret
+    12a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ad:	8d 76 00             	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    12b0:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    12b4:	74 d9                	je     128f <fputc+0x3f>
+    12b6:	89 d8                	mov    %ebx,%eax
+    12b8:	e8 33 fa ff ff       	call   cf0 <flush>
+    12bd:	85 c0                	test   %eax,%eax
+    12bf:	79 ce                	jns    128f <fputc+0x3f>
+    return EOF;
+    12c1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    12c6:	eb cc                	jmp    1294 <fputc+0x44>
+    12c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12cf:	90                   	nop
+    mutex_lock(&f->lock);
+    12d0:	83 ec 0c             	sub    $0xc,%esp
+    12d3:	8d 43 18             	lea    0x18(%ebx),%eax
+    12d6:	50                   	push   %eax
+    12d7:	e8 54 f3 ff ff       	call   630 <mutex_lock>
+  if(!(f->flags & IO_WRITE))
+    12dc:	8b 43 04             	mov    0x4(%ebx),%eax
+    12df:	83 c4 10             	add    $0x10,%esp
+    12e2:	a8 02                	test   $0x2,%al
+    12e4:	74 db                	je     12c1 <fputc+0x71>
+  if(!(f->flags & IO_SETUP))
+    12e6:	a8 40                	test   $0x40,%al
+    12e8:	75 8a                	jne    1274 <fputc+0x24>
+    setup(f);
+    12ea:	89 d8                	mov    %ebx,%eax
+    12ec:	e8 af f9 ff ff       	call   ca0 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    12f1:	8b 43 14             	mov    0x14(%ebx),%eax
+    12f4:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    12f7:	75 83                	jne    127c <fputc+0x2c>
+    12f9:	89 d8                	mov    %ebx,%eax
+    12fb:	e8 f0 f9 ff ff       	call   cf0 <flush>
+    1300:	85 c0                	test   %eax,%eax
+    1302:	78 bd                	js     12c1 <fputc+0x71>
+  f->buf[f->n++] = c;
+    1304:	8b 43 14             	mov    0x14(%ebx),%eax
+    1307:	e9 70 ff ff ff       	jmp    127c <fputc+0x2c>
+    130c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1310:	83 ec 0c             	sub    $0xc,%esp
+    1313:	83 c3 18             	add    $0x18,%ebx
+    1316:	53                   	push   %ebx
+    1317:	e8 64 f3 ff ff       	call   680 <mutex_unlock>
+    131c:	83 c4 10             	add    $0x10,%esp
+}
+    131f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1322:	89 f0                	mov    %esi,%eax
+    1324:	5b                   	pop    %ebx
+    1325:	5e                   	pop    %esi
+    1326:	5d                   	pop    %ebp
+    1327:	c3                   	ret
+    return EOF;
+    1328:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    132d:	e9 6b ff ff ff       	jmp    129d <fputc+0x4d>
+    1332:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001340 <fwrite>:
+{
+    1340:	55                   	push   %ebp
+    1341:	89 e5                	mov    %esp,%ebp
+    1343:	57                   	push   %edi
+    1344:	56                   	push   %esi
+    1345:	53                   	push   %ebx
+    1346:	83 ec 1c             	sub    $0x1c,%esp
+    1349:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  if(!(f->flags & IO_WRITE) || size <= 0)
+    134c:	8b 43 04             	mov    0x4(%ebx),%eax
+    134f:	a8 02                	test   $0x2,%al
+    1351:	0f 84 ec 00 00 00    	je     1443 <fwrite+0x103>
+    1357:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    135a:	85 c9                	test   %ecx,%ecx
+    135c:	0f 8e e1 00 00 00    	jle    1443 <fwrite+0x103>
+  if(threaded)
+    1362:	8b 15 60 4e 00 00    	mov    0x4e60,%edx
+    1368:	85 d2                	test   %edx,%edx
+    136a:	0f 85 1c 01 00 00    	jne    148c <fwrite+0x14c>
+  if(!(f->flags & IO_SETUP))
+    1370:	a8 40                	test   $0x40,%al
+    1372:	0f 84 08 01 00 00    	je     1480 <fwrite+0x140>
+  for(len = size*nmemb; len > 0; len -= n){
+    1378:	8b 45 0c             	mov    0xc(%ebp),%eax
+    137b:	0f af 45 10          	imul   0x10(%ebp),%eax
+    137f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    1382:	85 c0                	test   %eax,%eax
+    1384:	0f 8e 2a 01 00 00    	jle    14b4 <fwrite+0x174>
+  s = p;
+    138a:	8b 45 08             	mov    0x8(%ebp),%eax
+  nl = 0;
+    138d:	31 ff                	xor    %edi,%edi
+    138f:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+        nl = 1;
+    1392:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  s = p;
+    1395:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1398:	8b 43 14             	mov    0x14(%ebx),%eax
+        nl = 1;
+    139b:	89 ce                	mov    %ecx,%esi
+    if(f->n == f->size && flush(f) < 0)
+    139d:	89 c2                	mov    %eax,%edx
+    139f:	39 f0                	cmp    %esi,%eax
+    13a1:	74 6e                	je     1411 <fwrite+0xd1>
+    13a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    13a7:	90                   	nop
+    if(n > len)
+    13a8:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    n = f->size - f->n;
+    13ab:	89 f1                	mov    %esi,%ecx
+    13ad:	29 c1                	sub    %eax,%ecx
+    13af:	39 f9                	cmp    %edi,%ecx
+    13b1:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    13b4:	85 c9                	test   %ecx,%ecx
+    13b6:	0f 8e 7c 00 00 00    	jle    1438 <fwrite+0xf8>
+    13bc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    13bf:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    13c2:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    13c5:	8d 34 08             	lea    (%eax,%ecx,1),%esi
+    13c8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    13cb:	eb 06                	jmp    13d3 <fwrite+0x93>
+    13cd:	8d 76 00             	lea    0x0(%esi),%esi
+      if((f->buf[f->n++] = s[i]) == '\n')
+    13d0:	8b 53 14             	mov    0x14(%ebx),%edx
+    13d3:	8d 4a 01             	lea    0x1(%edx),%ecx
+    13d6:	8b 73 08             	mov    0x8(%ebx),%esi
+    13d9:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    13dc:	0f b6 08             	movzbl (%eax),%ecx
+        nl = 1;
+    13df:	80 f9 0a             	cmp    $0xa,%cl
+      if((f->buf[f->n++] = s[i]) == '\n')
+    13e2:	88 0c 16             	mov    %cl,(%esi,%edx,1)
+        nl = 1;
+    13e5:	be 01 00 00 00       	mov    $0x1,%esi
+    13ea:	0f 44 fe             	cmove  %esi,%edi
+    for(i = 0; i < n; i++)
+    13ed:	83 c0 01             	add    $0x1,%eax
+    13f0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    13f3:	75 db                	jne    13d0 <fwrite+0x90>
+    s += n;
+    13f5:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    13f8:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    13fb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    s += n;
+    13fe:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    1401:	85 c0                	test   %eax,%eax
+    1403:	7e 48                	jle    144d <fwrite+0x10d>
+    1405:	8b 43 14             	mov    0x14(%ebx),%eax
+    1408:	8b 73 0c             	mov    0xc(%ebx),%esi
+    if(f->n == f->size && flush(f) < 0)
+    140b:	89 c2                	mov    %eax,%edx
+    140d:	39 f0                	cmp    %esi,%eax
+    140f:	75 97                	jne    13a8 <fwrite+0x68>
+    1411:	89 d8                	mov    %ebx,%eax
+    1413:	e8 d8 f8 ff ff       	call   cf0 <flush>
+    1418:	85 c0                	test   %eax,%eax
+    141a:	78 31                	js     144d <fwrite+0x10d>
+    n = f->size - f->n;
+    141c:	8b 73 0c             	mov    0xc(%ebx),%esi
+    141f:	8b 43 14             	mov    0x14(%ebx),%eax
+    1422:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    1425:	89 f1                	mov    %esi,%ecx
+    1427:	89 c2                	mov    %eax,%edx
+    1429:	29 c1                	sub    %eax,%ecx
+    142b:	39 f9                	cmp    %edi,%ecx
+    142d:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1430:	85 c9                	test   %ecx,%ecx
+    1432:	7f 88                	jg     13bc <fwrite+0x7c>
+    1434:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    s += n;
+    1438:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    143b:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    143e:	e9 5a ff ff ff       	jmp    139d <fwrite+0x5d>
+}
+    1443:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    1446:	31 c0                	xor    %eax,%eax
+}
+    1448:	5b                   	pop    %ebx
+    1449:	5e                   	pop    %esi
+    144a:	5f                   	pop    %edi
+    144b:	5d                   	pop    %ebp
+    144c:	c3                   	ret
+  if(nl && (f->flags & IO_LINE))
+    144d:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1450:	85 ff                	test   %edi,%edi
+    1452:	74 06                	je     145a <fwrite+0x11a>
+    1454:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1458:	75 1d                	jne    1477 <fwrite+0x137>
+  return (s - (const char*)p) / size;
+    145a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    145d:	2b 75 08             	sub    0x8(%ebp),%esi
+  if(threaded)
+    1460:	a1 60 4e 00 00       	mov    0x4e60,%eax
+    1465:	85 c0                	test   %eax,%eax
+    1467:	75 3a                	jne    14a3 <fwrite+0x163>
+  return (s - (const char*)p) / size;
+    1469:	89 f0                	mov    %esi,%eax
+    146b:	99                   	cltd
+    146c:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    146f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1472:	5b                   	pop    %ebx
+    1473:	5e                   	pop    %esi
+    1474:	5f                   	pop    %edi
+    1475:	5d                   	pop    %ebp
+    1476:	c3                   	ret
+    flush(f);
+    1477:	89 d8                	mov    %ebx,%eax
+    1479:	e8 72 f8 ff ff       	call   cf0 <flush>
+    147e:	eb da                	jmp    145a <fwrite+0x11a>
+    setup(f);
+    1480:	89 d8                	mov    %ebx,%eax
+    1482:	e8 19 f8 ff ff       	call   ca0 <setup>
+    1487:	e9 ec fe ff ff       	jmp    1378 <fwrite+0x38>
+    mutex_lock(&f->lock);
+    148c:	83 ec 0c             	sub    $0xc,%esp
+    148f:	8d 43 18             	lea    0x18(%ebx),%eax
+    1492:	50                   	push   %eax
+    1493:	e8 98 f1 ff ff       	call   630 <mutex_lock>
+  if(!(f->flags & IO_SETUP))
+    1498:	8b 43 04             	mov    0x4(%ebx),%eax
+    149b:	83 c4 10             	add    $0x10,%esp
+    149e:	e9 cd fe ff ff       	jmp    1370 <fwrite+0x30>
+    mutex_unlock(&f->lock);
+    14a3:	83 ec 0c             	sub    $0xc,%esp
+    14a6:	83 c3 18             	add    $0x18,%ebx
+    14a9:	53                   	push   %ebx
+    14aa:	e8 d1 f1 ff ff       	call   680 <mutex_unlock>
+    14af:	83 c4 10             	add    $0x10,%esp
+    14b2:	eb b5                	jmp    1469 <fwrite+0x129>
+  for(len = size*nmemb; len > 0; len -= n){
+    14b4:	31 f6                	xor    %esi,%esi
+    14b6:	eb a8                	jmp    1460 <fwrite+0x120>
+    14b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14bf:	90                   	nop
+
+000014c0 <fgetc>:
+  return f->buf[f->r++] & 0xff;
+}
+
+int
+fgetc(FILE *f)
+{
+    14c0:	55                   	push   %ebp
+    14c1:	89 e5                	mov    %esp,%ebp
+    14c3:	56                   	push   %esi
+    14c4:	53                   	push   %ebx
+  if(threaded)
+    14c5:	8b 15 60 4e 00 00    	mov    0x4e60,%edx
+{
+    14cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    14ce:	85 d2                	test   %edx,%edx
+    14d0:	75 2e                	jne    1500 <fgetc+0x40>
+  if(!(f->flags & IO_READ))
+    14d2:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    14d6:	74 78                	je     1550 <fgetc+0x90>
+  if(f->r == f->n && fill(f) == 0)
+    14d8:	8b 43 10             	mov    0x10(%ebx),%eax
+    14db:	3b 43 14             	cmp    0x14(%ebx),%eax
+    14de:	74 60                	je     1540 <fgetc+0x80>
+  return f->buf[f->r++] & 0xff;
+    14e0:	8b 53 08             	mov    0x8(%ebx),%edx
+    14e3:	8d 48 01             	lea    0x1(%eax),%ecx
+    14e6:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    14e9:	0f b6 34 02          	movzbl (%edx,%eax,1),%esi
+  if(threaded)
+    14ed:	a1 60 4e 00 00       	mov    0x4e60,%eax
+    14f2:	85 c0                	test   %eax,%eax
+    14f4:	75 2a                	jne    1520 <fgetc+0x60>
+
+  flockfile(f);
+  c = getc_unlocked(f);
+  funlockfile(f);
+  return c;
+}
+    14f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    14f9:	89 f0                	mov    %esi,%eax
+    14fb:	5b                   	pop    %ebx
+    14fc:	5e                   	pop    %esi
+    14fd:	5d                   	pop    %ebp
+    14fe:	c3                   	ret
+    14ff:	90                   	nop
+    mutex_lock(&f->lock);
+    1500:	83 ec 0c             	sub    $0xc,%esp
+    1503:	8d 43 18             	lea    0x18(%ebx),%eax
+    1506:	50                   	push   %eax
+    1507:	e8 24 f1 ff ff       	call   630 <mutex_lock>
+  if(!(f->flags & IO_READ))
+    150c:	83 c4 10             	add    $0x10,%esp
+    150f:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1513:	75 c3                	jne    14d8 <fgetc+0x18>
+    return EOF;
+    1515:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    151a:	eb d1                	jmp    14ed <fgetc+0x2d>
+    151c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1520:	83 ec 0c             	sub    $0xc,%esp
+    1523:	83 c3 18             	add    $0x18,%ebx
+    1526:	53                   	push   %ebx
+    1527:	e8 54 f1 ff ff       	call   680 <mutex_unlock>
+    152c:	83 c4 10             	add    $0x10,%esp
+}
+    152f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1532:	89 f0                	mov    %esi,%eax
+    1534:	5b                   	pop    %ebx
+    1535:	5e                   	pop    %esi
+    1536:	5d                   	pop    %ebp
+    1537:	c3                   	ret
+    1538:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    153f:	90                   	nop
+  if(f->r == f->n && fill(f) == 0)
+    1540:	89 d8                	mov    %ebx,%eax
+    1542:	e8 c9 f8 ff ff       	call   e10 <fill>
+    1547:	85 c0                	test   %eax,%eax
+    1549:	74 ca                	je     1515 <fgetc+0x55>
+  return f->buf[f->r++] & 0xff;
+    154b:	8b 43 10             	mov    0x10(%ebx),%eax
+    154e:	eb 90                	jmp    14e0 <fgetc+0x20>
+    return EOF;
+    1550:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    1555:	eb 9f                	jmp    14f6 <fgetc+0x36>
+    1557:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    155e:	66 90                	xchg   %ax,%ax
+
+00001560 <fread>:
+
+int
+fread(void *p, int size, int nmemb, FILE *f)
+{
+    1560:	55                   	push   %ebp
+    1561:	89 e5                	mov    %esp,%ebp
+    1563:	57                   	push   %edi
+    1564:	56                   	push   %esi
+    1565:	53                   	push   %ebx
+    1566:	83 ec 1c             	sub    $0x1c,%esp
+    1569:	8b 75 14             	mov    0x14(%ebp),%esi
+  char *d;
+  int n, len;
+
+  if(!(f->flags & IO_READ) || size <= 0)
+    156c:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+    1570:	74 7e                	je     15f0 <fread+0x90>
+    1572:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1575:	85 d2                	test   %edx,%edx
+    1577:	7e 77                	jle    15f0 <fread+0x90>
+  if(threaded)
+    1579:	a1 60 4e 00 00       	mov    0x4e60,%eax
+    return 0;
+  flockfile(f);
+  d = p;
+  for(len = size*nmemb; len > 0; len -= n){
+    157e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1581:	0f af 7d 10          	imul   0x10(%ebp),%edi
+  if(threaded)
+    1585:	85 c0                	test   %eax,%eax
+    1587:	0f 85 93 00 00 00    	jne    1620 <fread+0xc0>
+  for(len = size*nmemb; len > 0; len -= n){
+    158d:	85 ff                	test   %edi,%edi
+    158f:	7e 61                	jle    15f2 <fread+0x92>
+    if(f->r == f->n && fill(f) == 0)
+    1591:	8b 46 10             	mov    0x10(%esi),%eax
+  d = p;
+    1594:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1597:	eb 35                	jmp    15ce <fread+0x6e>
+    1599:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      break;
+    n = f->n - f->r;
+    15a0:	29 c3                	sub    %eax,%ebx
+    15a2:	39 fb                	cmp    %edi,%ebx
+    15a4:	0f 4f df             	cmovg  %edi,%ebx
+    if(n > len)
+      n = len;
+    memmove(d, f->buf + f->r, n);
+    15a7:	83 ec 04             	sub    $0x4,%esp
+    15aa:	53                   	push   %ebx
+    15ab:	03 46 08             	add    0x8(%esi),%eax
+  for(len = size*nmemb; len > 0; len -= n){
+    15ae:	29 df                	sub    %ebx,%edi
+    memmove(d, f->buf + f->r, n);
+    15b0:	50                   	push   %eax
+    15b1:	51                   	push   %ecx
+    15b2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    15b5:	e8 36 f0 ff ff       	call   5f0 <memmove>
+    f->r += n;
+    15ba:	8b 46 10             	mov    0x10(%esi),%eax
+    d += n;
+    15bd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    15c0:	83 c4 10             	add    $0x10,%esp
+    f->r += n;
+    15c3:	01 d8                	add    %ebx,%eax
+    d += n;
+    15c5:	01 d9                	add    %ebx,%ecx
+    f->r += n;
+    15c7:	89 46 10             	mov    %eax,0x10(%esi)
+  for(len = size*nmemb; len > 0; len -= n){
+    15ca:	85 ff                	test   %edi,%edi
+    15cc:	7e 32                	jle    1600 <fread+0xa0>
+    if(f->r == f->n && fill(f) == 0)
+    15ce:	8b 5e 14             	mov    0x14(%esi),%ebx
+    15d1:	39 c3                	cmp    %eax,%ebx
+    15d3:	75 cb                	jne    15a0 <fread+0x40>
+    15d5:	89 f0                	mov    %esi,%eax
+    15d7:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    15da:	e8 31 f8 ff ff       	call   e10 <fill>
+    15df:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    15e2:	85 c0                	test   %eax,%eax
+    15e4:	74 1a                	je     1600 <fread+0xa0>
+    n = f->n - f->r;
+    15e6:	8b 5e 14             	mov    0x14(%esi),%ebx
+    15e9:	8b 46 10             	mov    0x10(%esi),%eax
+    15ec:	eb b2                	jmp    15a0 <fread+0x40>
+    15ee:	66 90                	xchg   %ax,%ax
+    return 0;
+    15f0:	31 c0                	xor    %eax,%eax
+  }
+  funlockfile(f);
+  return (d - (char*)p) / size;
+}
+    15f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15f5:	5b                   	pop    %ebx
+    15f6:	5e                   	pop    %esi
+    15f7:	5f                   	pop    %edi
+    15f8:	5d                   	pop    %ebp
+    15f9:	c3                   	ret
+    15fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (d - (char*)p) / size;
+    1600:	2b 4d 08             	sub    0x8(%ebp),%ecx
+    1603:	89 cb                	mov    %ecx,%ebx
+  if(threaded)
+    1605:	a1 60 4e 00 00       	mov    0x4e60,%eax
+    160a:	85 c0                	test   %eax,%eax
+    160c:	75 32                	jne    1640 <fread+0xe0>
+  return (d - (char*)p) / size;
+    160e:	89 d8                	mov    %ebx,%eax
+    1610:	99                   	cltd
+    1611:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1614:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1617:	5b                   	pop    %ebx
+    1618:	5e                   	pop    %esi
+    1619:	5f                   	pop    %edi
+    161a:	5d                   	pop    %ebp
+    161b:	c3                   	ret
+    161c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    1620:	83 ec 0c             	sub    $0xc,%esp
+    1623:	8d 46 18             	lea    0x18(%esi),%eax
+    1626:	50                   	push   %eax
+    1627:	e8 04 f0 ff ff       	call   630 <mutex_lock>
+  for(len = size*nmemb; len > 0; len -= n){
+    162c:	83 c4 10             	add    $0x10,%esp
+    162f:	85 ff                	test   %edi,%edi
+    1631:	0f 8f 5a ff ff ff    	jg     1591 <fread+0x31>
+    1637:	31 db                	xor    %ebx,%ebx
+    1639:	eb ca                	jmp    1605 <fread+0xa5>
+    163b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    163f:	90                   	nop
+    mutex_unlock(&f->lock);
+    1640:	83 ec 0c             	sub    $0xc,%esp
+    1643:	83 c6 18             	add    $0x18,%esi
+    1646:	56                   	push   %esi
+    1647:	e8 34 f0 ff ff       	call   680 <mutex_unlock>
+  return (d - (char*)p) / size;
+    164c:	89 d8                	mov    %ebx,%eax
+    164e:	83 c4 10             	add    $0x10,%esp
+    1651:	99                   	cltd
+    1652:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1655:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1658:	5b                   	pop    %ebx
+    1659:	5e                   	pop    %esi
+    165a:	5f                   	pop    %edi
+    165b:	5d                   	pop    %ebp
+    165c:	c3                   	ret
+    165d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001660 <fgets>:
+
+// Read a line of at most max-1 bytes, keeping the newline.
+// Returns 0 if there was nothing left to read.
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    1660:	55                   	push   %ebp
+    1661:	89 e5                	mov    %esp,%ebp
+    1663:	57                   	push   %edi
+    1664:	56                   	push   %esi
+    1665:	53                   	push   %ebx
+    1666:	83 ec 1c             	sub    $0x1c,%esp
+  if(threaded)
+    1669:	8b 35 60 4e 00 00    	mov    0x4e60,%esi
+{
+    166f:	8b 7d 08             	mov    0x8(%ebp),%edi
+    1672:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if(threaded)
+    1675:	85 f6                	test   %esi,%esi
+    1677:	0f 85 83 00 00 00    	jne    1700 <fgets+0xa0>
+{
+    167d:	31 f6                	xor    %esi,%esi
+    167f:	eb 2a                	jmp    16ab <fgets+0x4b>
+    1681:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return f->buf[f->r++] & 0xff;
+    1688:	8b 53 08             	mov    0x8(%ebx),%edx
+    168b:	8d 48 01             	lea    0x1(%eax),%ecx
+    168e:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1691:	0f b6 14 02          	movzbl (%edx,%eax,1),%edx
+
+  flockfile(f);
+  for(i = 0; i+1 < max; ){
+    if((c = getc_unlocked(f)) == EOF)
+      break;
+    buf[i++] = c;
+    1695:	88 54 37 ff          	mov    %dl,-0x1(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    1699:	80 fa 0a             	cmp    $0xa,%dl
+    169c:	0f 84 96 00 00 00    	je     1738 <fgets+0xd8>
+    16a2:	83 fa 0d             	cmp    $0xd,%edx
+    16a5:	0f 84 8d 00 00 00    	je     1738 <fgets+0xd8>
+  for(i = 0; i+1 < max; ){
+    16ab:	89 f2                	mov    %esi,%edx
+    16ad:	83 c6 01             	add    $0x1,%esi
+    16b0:	3b 75 0c             	cmp    0xc(%ebp),%esi
+    16b3:	7d 2b                	jge    16e0 <fgets+0x80>
+  if(!(f->flags & IO_READ))
+    16b5:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    16b9:	74 25                	je     16e0 <fgets+0x80>
+  if(f->r == f->n && fill(f) == 0)
+    16bb:	8b 43 10             	mov    0x10(%ebx),%eax
+    16be:	3b 43 14             	cmp    0x14(%ebx),%eax
+    16c1:	75 c5                	jne    1688 <fgets+0x28>
+    16c3:	89 d8                	mov    %ebx,%eax
+    16c5:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    16c8:	e8 43 f7 ff ff       	call   e10 <fill>
+    16cd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    16d0:	85 c0                	test   %eax,%eax
+    16d2:	74 0c                	je     16e0 <fgets+0x80>
+  return f->buf[f->r++] & 0xff;
+    16d4:	8b 43 10             	mov    0x10(%ebx),%eax
+    16d7:	eb af                	jmp    1688 <fgets+0x28>
+    16d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    16e0:	8b 0d 60 4e 00 00    	mov    0x4e60,%ecx
+      break;
+  }
+  buf[i] = '\0';
+    16e6:	c6 04 17 00          	movb   $0x0,(%edi,%edx,1)
+  if(threaded)
+    16ea:	85 c9                	test   %ecx,%ecx
+    16ec:	75 2a                	jne    1718 <fgets+0xb8>
+  funlockfile(f);
+  return i > 0 ? buf : 0;
+    16ee:	31 c0                	xor    %eax,%eax
+    16f0:	85 d2                	test   %edx,%edx
+    16f2:	74 02                	je     16f6 <fgets+0x96>
+    16f4:	89 f8                	mov    %edi,%eax
+}
+    16f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    16f9:	5b                   	pop    %ebx
+    16fa:	5e                   	pop    %esi
+    16fb:	5f                   	pop    %edi
+    16fc:	5d                   	pop    %ebp
+    16fd:	c3                   	ret
+    16fe:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    1700:	83 ec 0c             	sub    $0xc,%esp
+    1703:	8d 43 18             	lea    0x18(%ebx),%eax
+    1706:	50                   	push   %eax
+    1707:	e8 24 ef ff ff       	call   630 <mutex_lock>
+    170c:	83 c4 10             	add    $0x10,%esp
+    170f:	e9 69 ff ff ff       	jmp    167d <fgets+0x1d>
+    1714:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1718:	83 ec 0c             	sub    $0xc,%esp
+    171b:	83 c3 18             	add    $0x18,%ebx
+    171e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1721:	53                   	push   %ebx
+    1722:	e8 59 ef ff ff       	call   680 <mutex_unlock>
+    1727:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    172a:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    172d:	31 c0                	xor    %eax,%eax
+    172f:	85 d2                	test   %edx,%edx
+    1731:	75 c1                	jne    16f4 <fgets+0x94>
+    1733:	eb c1                	jmp    16f6 <fgets+0x96>
+    1735:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1738:	a1 60 4e 00 00       	mov    0x4e60,%eax
+  buf[i] = '\0';
+    173d:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  if(threaded)
+    1741:	85 c0                	test   %eax,%eax
+    1743:	74 af                	je     16f4 <fgets+0x94>
+    mutex_unlock(&f->lock);
+    1745:	83 ec 0c             	sub    $0xc,%esp
+    1748:	83 c3 18             	add    $0x18,%ebx
+    174b:	53                   	push   %ebx
+    174c:	e8 2f ef ff ff       	call   680 <mutex_unlock>
+    1751:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    1754:	89 f8                	mov    %edi,%eax
+    1756:	eb 9e                	jmp    16f6 <fgets+0x96>
+    1758:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    175f:	90                   	nop
+
+00001760 <gets>:
+// at most a line per read(), goes through stdin's buffer: from a
+// file or pipe, a buffered read could take input meant for a child
+// process, so read a byte at a time.
+char*
+gets(char *buf, int max)
+{
+    1760:	55                   	push   %ebp
+    1761:	89 e5                	mov    %esp,%ebp
+    1763:	57                   	push   %edi
+    1764:	56                   	push   %esi
+    1765:	53                   	push   %ebx
+    1766:	83 ec 2c             	sub    $0x2c,%esp
+  int i, cc;
+  char c;
+
+  if(!(stdin->flags & IO_SETUP))
+    1769:	8b 15 24 2b 00 00    	mov    0x2b24,%edx
+{
+    176f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!(stdin->flags & IO_SETUP))
+    1772:	f6 c2 40             	test   $0x40,%dl
+    1775:	74 79                	je     17f0 <gets+0x90>
+    setup(stdin);
+  if(stdin->flags & IO_DEV){
+    1777:	83 e2 20             	and    $0x20,%edx
+    177a:	89 d7                	mov    %edx,%edi
+    177c:	75 52                	jne    17d0 <gets+0x70>
+  if(f == 0){
+    177e:	e8 ed f5 ff ff       	call   d70 <fflush.part.0>
+    fgets(buf, max, stdin);
+    return buf;
+  }
+  fflush(0);
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1783:	8d 75 e7             	lea    -0x19(%ebp),%esi
+  for(i=0; i+1 < max; ){
+    1786:	eb 2c                	jmp    17b4 <gets+0x54>
+    1788:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    178f:	90                   	nop
+    cc = read(0, &c, 1);
+    1790:	83 ec 04             	sub    $0x4,%esp
+    1793:	6a 01                	push   $0x1
+    1795:	56                   	push   %esi
+    1796:	6a 00                	push   $0x0
+    1798:	e8 f5 ef ff ff       	call   792 <read>
+    if(cc < 1)
+    179d:	83 c4 10             	add    $0x10,%esp
+    17a0:	85 c0                	test   %eax,%eax
+    17a2:	7e 1b                	jle    17bf <gets+0x5f>
+      break;
+    buf[i++] = c;
+    17a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    17a8:	88 44 3b ff          	mov    %al,-0x1(%ebx,%edi,1)
+    if(c == '\n' || c == '\r')
+    17ac:	3c 0a                	cmp    $0xa,%al
+    17ae:	74 12                	je     17c2 <gets+0x62>
+    17b0:	3c 0d                	cmp    $0xd,%al
+    17b2:	74 0e                	je     17c2 <gets+0x62>
+  for(i=0; i+1 < max; ){
+    17b4:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    17b7:	83 c7 01             	add    $0x1,%edi
+    17ba:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+    17bd:	7c d1                	jl     1790 <gets+0x30>
+{
+    17bf:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      break;
+  }
+  buf[i] = '\0';
+    17c2:	c6 04 3b 00          	movb   $0x0,(%ebx,%edi,1)
+  return buf;
+}
+    17c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    17c9:	89 d8                	mov    %ebx,%eax
+    17cb:	5b                   	pop    %ebx
+    17cc:	5e                   	pop    %esi
+    17cd:	5f                   	pop    %edi
+    17ce:	5d                   	pop    %ebp
+    17cf:	c3                   	ret
+    fgets(buf, max, stdin);
+    17d0:	83 ec 04             	sub    $0x4,%esp
+    17d3:	68 20 2b 00 00       	push   $0x2b20
+    17d8:	ff 75 0c             	push   0xc(%ebp)
+    17db:	53                   	push   %ebx
+    17dc:	e8 7f fe ff ff       	call   1660 <fgets>
+    return buf;
+    17e1:	83 c4 10             	add    $0x10,%esp
+}
+    17e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    17e7:	89 d8                	mov    %ebx,%eax
+    17e9:	5b                   	pop    %ebx
+    17ea:	5e                   	pop    %esi
+    17eb:	5f                   	pop    %edi
+    17ec:	5d                   	pop    %ebp
+    17ed:	c3                   	ret
+    17ee:	66 90                	xchg   %ax,%ax
+    setup(stdin);
+    17f0:	b8 20 2b 00 00       	mov    $0x2b20,%eax
+    17f5:	e8 a6 f4 ff ff       	call   ca0 <setup>
+  if(stdin->flags & IO_DEV){
+    17fa:	8b 15 24 2b 00 00    	mov    0x2b24,%edx
+    1800:	e9 72 ff ff ff       	jmp    1777 <gets+0x17>
+    1805:	66 90                	xchg   %ax,%ax
+    1807:	66 90                	xchg   %ax,%ax
+    1809:	66 90                	xchg   %ax,%ax
+    180b:	66 90                	xchg   %ax,%ax
+    180d:	66 90                	xchg   %ax,%ax
+    180f:	90                   	nop
+
+00001810 <bigfree>:
+
+// Give a big block back to the first-fit list, and return the
+// free block that now holds it. Caller holds lock.
+static Header*
+bigfree(Header *bp)
+{
+    1810:	55                   	push   %ebp
+    1811:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1813:	a1 04 55 00 00       	mov    0x5504,%eax
+{
+    1818:	89 e5                	mov    %esp,%ebp
+    181a:	56                   	push   %esi
+    181b:	53                   	push   %ebx
+    181c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1820:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1822:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1824:	39 ca                	cmp    %ecx,%edx
+    1826:	73 38                	jae    1860 <bigfree+0x50>
+    1828:	39 c1                	cmp    %eax,%ecx
+    182a:	72 04                	jb     1830 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    182c:	39 c2                	cmp    %eax,%edx
+    182e:	72 f0                	jb     1820 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1830:	8b 59 04             	mov    0x4(%ecx),%ebx
+    1833:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    1836:	39 f0                	cmp    %esi,%eax
+    1838:	74 36                	je     1870 <bigfree+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    183a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  freep = p;
+  if(p + p->s.size == bp){
+    183c:	8b 42 04             	mov    0x4(%edx),%eax
+    183f:	89 cb                	mov    %ecx,%ebx
+  freep = p;
+    1841:	89 15 04 55 00 00    	mov    %edx,0x5504
+  if(p + p->s.size == bp){
+    1847:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    184a:	39 f1                	cmp    %esi,%ecx
+    184c:	74 2e                	je     187c <bigfree+0x6c>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    184e:	89 1a                	mov    %ebx,(%edx)
+    return p;
+  }
+  p->s.ptr = bp;
+  return bp;
+}
+    1850:	89 c8                	mov    %ecx,%eax
+    1852:	5b                   	pop    %ebx
+    1853:	5e                   	pop    %esi
+    1854:	5d                   	pop    %ebp
+    1855:	c3                   	ret
+    1856:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    185d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1860:	39 c1                	cmp    %eax,%ecx
+    1862:	72 c8                	jb     182c <bigfree+0x1c>
+    1864:	eb ba                	jmp    1820 <bigfree+0x10>
+    1866:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    186d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1870:	03 58 04             	add    0x4(%eax),%ebx
+    1873:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1876:	8b 02                	mov    (%edx),%eax
+    1878:	8b 00                	mov    (%eax),%eax
+    187a:	eb be                	jmp    183a <bigfree+0x2a>
+    p->s.size += bp->s.size;
+    187c:	03 41 04             	add    0x4(%ecx),%eax
+    187f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1882:	8b 19                	mov    (%ecx),%ebx
+    return p;
+    1884:	89 d1                	mov    %edx,%ecx
+}
+    1886:	89 c8                	mov    %ecx,%eax
+    p->s.ptr = bp->s.ptr;
+    1888:	89 1a                	mov    %ebx,(%edx)
+}
+    188a:	5b                   	pop    %ebx
+    188b:	5e                   	pop    %esi
+    188c:	5d                   	pop    %ebp
+    188d:	c3                   	ret
+    188e:	66 90                	xchg   %ax,%ax
+
+00001890 <trim>:
+// If free block bp ends the heap, return its whole pages to the
+// kernel, unless something else has moved the break since.
+// Caller holds lock.
+static void
+trim(Header *bp)
+{
+    1890:	55                   	push   %ebp
+    1891:	89 e5                	mov    %esp,%ebp
+    1893:	57                   	push   %edi
+    1894:	56                   	push   %esi
+    1895:	53                   	push   %ebx
+    1896:	89 c3                	mov    %eax,%ebx
+    1898:	83 ec 0c             	sub    $0xc,%esp
+  char *end;
+  uint n;
+
+  if((char*)(bp + bp->s.size) != heapend)
+    189b:	8b 53 04             	mov    0x4(%ebx),%edx
+    189e:	a1 00 55 00 00       	mov    0x5500,%eax
+    18a3:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+    18a6:	39 d0                	cmp    %edx,%eax
+    18a8:	74 0e                	je     18b8 <trim+0x28>
+  n = heapend - end;
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    bp->s.size -= n / sizeof(Header);
+    heapend = end;
+  }
+}
+    18aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    18ad:	5b                   	pop    %ebx
+    18ae:	5e                   	pop    %esi
+    18af:	5f                   	pop    %edi
+    18b0:	5d                   	pop    %ebp
+    18b1:	c3                   	ret
+    18b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  end = (char*)PGROUNDUP((uint)(bp + 2));
+    18b8:	8d bb 0f 10 00 00    	lea    0x100f(%ebx),%edi
+    18be:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  n = heapend - end;
+    18c4:	29 f8                	sub    %edi,%eax
+    18c6:	89 c6                	mov    %eax,%esi
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    18c8:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    18cd:	76 db                	jbe    18aa <trim+0x1a>
+    18cf:	83 ec 0c             	sub    $0xc,%esp
+    18d2:	6a 00                	push   $0x0
+    18d4:	e8 8b ef ff ff       	call   864 <sbrk>
+    18d9:	83 c4 10             	add    $0x10,%esp
+    18dc:	39 05 00 55 00 00    	cmp    %eax,0x5500
+    18e2:	75 c6                	jne    18aa <trim+0x1a>
+    18e4:	89 f0                	mov    %esi,%eax
+    18e6:	83 ec 0c             	sub    $0xc,%esp
+    18e9:	f7 d8                	neg    %eax
+    18eb:	50                   	push   %eax
+    18ec:	e8 73 ef ff ff       	call   864 <sbrk>
+    18f1:	83 c4 10             	add    $0x10,%esp
+    18f4:	83 f8 ff             	cmp    $0xffffffff,%eax
+    18f7:	74 b1                	je     18aa <trim+0x1a>
+    bp->s.size -= n / sizeof(Header);
+    18f9:	89 f0                	mov    %esi,%eax
+    heapend = end;
+    18fb:	89 3d 00 55 00 00    	mov    %edi,0x5500
+    bp->s.size -= n / sizeof(Header);
+    1901:	c1 e8 03             	shr    $0x3,%eax
+    1904:	29 43 04             	sub    %eax,0x4(%ebx)
+    heapend = end;
+    1907:	eb a1                	jmp    18aa <trim+0x1a>
+    1909:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001910 <bigalloc>:
+}
+
+// Allocate a big block of nunits units. Caller holds lock.
+static Header*
+bigalloc(uint nunits)
+{
+    1910:	55                   	push   %ebp
+    1911:	89 e5                	mov    %esp,%ebp
+    1913:	57                   	push   %edi
+    1914:	89 c7                	mov    %eax,%edi
+    1916:	56                   	push   %esi
+    1917:	53                   	push   %ebx
+    1918:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    191b:	a1 04 55 00 00       	mov    0x5504,%eax
+    1920:	85 c0                	test   %eax,%eax
+    1922:	0f 84 98 00 00 00    	je     19c0 <bigalloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1928:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    192a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    192d:	39 f9                	cmp    %edi,%ecx
+    192f:	73 67                	jae    1998 <bigalloc+0x88>
+  if(nu < 4096)
+    1931:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1936:	39 df                	cmp    %ebx,%edi
+    1938:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    193b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    1942:	eb 0d                	jmp    1951 <bigalloc+0x41>
+    1944:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1948:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    194a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    194d:	39 f9                	cmp    %edi,%ecx
+    194f:	73 47                	jae    1998 <bigalloc+0x88>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    1951:	89 d0                	mov    %edx,%eax
+    1953:	39 15 04 55 00 00    	cmp    %edx,0x5504
+    1959:	75 ed                	jne    1948 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    195b:	83 ec 0c             	sub    $0xc,%esp
+    195e:	56                   	push   %esi
+    195f:	e8 00 ef ff ff       	call   864 <sbrk>
+  if(p == (char*)-1)
+    1964:	83 c4 10             	add    $0x10,%esp
+    1967:	83 f8 ff             	cmp    $0xffffffff,%eax
+    196a:	74 1a                	je     1986 <bigalloc+0x76>
+  hp->s.size = nu;
+    196c:	89 58 04             	mov    %ebx,0x4(%eax)
+  heapend = p + nu * sizeof(Header);
+    196f:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    1972:	89 15 00 55 00 00    	mov    %edx,0x5500
+  bigfree(hp);
+    1978:	e8 93 fe ff ff       	call   1810 <bigfree>
+  return freep;
+    197d:	a1 04 55 00 00       	mov    0x5504,%eax
+      if((p = morecore(nunits)) == 0)
+    1982:	85 c0                	test   %eax,%eax
+    1984:	75 c2                	jne    1948 <bigalloc+0x38>
+        return 0;
+  }
+}
+    1986:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1989:	31 d2                	xor    %edx,%edx
+}
+    198b:	5b                   	pop    %ebx
+    198c:	89 d0                	mov    %edx,%eax
+    198e:	5e                   	pop    %esi
+    198f:	5f                   	pop    %edi
+    1990:	5d                   	pop    %ebp
+    1991:	c3                   	ret
+    1992:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1998:	39 cf                	cmp    %ecx,%edi
+    199a:	74 54                	je     19f0 <bigalloc+0xe0>
+        p->s.size -= nunits;
+    199c:	29 f9                	sub    %edi,%ecx
+    199e:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    19a1:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    19a4:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    19a7:	a3 04 55 00 00       	mov    %eax,0x5504
+}
+    19ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19af:	89 d0                	mov    %edx,%eax
+    19b1:	5b                   	pop    %ebx
+    19b2:	5e                   	pop    %esi
+    19b3:	5f                   	pop    %edi
+    19b4:	5d                   	pop    %ebp
+    19b5:	c3                   	ret
+    19b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19bd:	8d 76 00             	lea    0x0(%esi),%esi
+    base.s.ptr = freep = prevp = &base;
+    19c0:	c7 05 04 55 00 00 08 	movl   $0x5508,0x5504
+    19c7:	55 00 00 
+    base.s.size = 0;
+    19ca:	ba 08 55 00 00       	mov    $0x5508,%edx
+    base.s.ptr = freep = prevp = &base;
+    19cf:	c7 05 08 55 00 00 08 	movl   $0x5508,0x5508
+    19d6:	55 00 00 
+    base.s.size = 0;
+    19d9:	c7 05 0c 55 00 00 00 	movl   $0x0,0x550c
+    19e0:	00 00 00 
+    if(p->s.size >= nunits){
+    19e3:	e9 49 ff ff ff       	jmp    1931 <bigalloc+0x21>
+    19e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19ef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    19f0:	8b 0a                	mov    (%edx),%ecx
+    19f2:	89 08                	mov    %ecx,(%eax)
+    19f4:	eb b1                	jmp    19a7 <bigalloc+0x97>
+    19f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001a00 <drain>:
+}
+
+// Move n blocks of class c from cache tc to the shared list.
+static void
+drain(struct tcache *tc, int c, int n)
+{
+    1a00:	55                   	push   %ebp
+    1a01:	89 e5                	mov    %esp,%ebp
+    1a03:	57                   	push   %edi
+    1a04:	89 c7                	mov    %eax,%edi
+    1a06:	56                   	push   %esi
+    1a07:	89 d6                	mov    %edx,%esi
+    1a09:	53                   	push   %ebx
+    1a0a:	89 cb                	mov    %ecx,%ebx
+    1a0c:	83 ec 0c             	sub    $0xc,%esp
+  if(threaded)
+    1a0f:	8b 15 84 54 00 00    	mov    0x5484,%edx
+    1a15:	85 d2                	test   %edx,%edx
+    1a17:	75 57                	jne    1a70 <drain+0x70>
+  Header *p;
+
+  acquire();
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1a19:	85 c9                	test   %ecx,%ecx
+    1a1b:	7e 49                	jle    1a66 <drain+0x66>
+    1a1d:	89 d9                	mov    %ebx,%ecx
+    1a1f:	8d 14 b7             	lea    (%edi,%esi,4),%edx
+    1a22:	eb 23                	jmp    1a47 <drain+0x47>
+    1a24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    tc->list[c] = p->s.ptr;
+    1a28:	8b 18                	mov    (%eax),%ebx
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1a2a:	83 e9 01             	sub    $0x1,%ecx
+    tc->n[c]--;
+    1a2d:	83 6a 20 01          	subl   $0x1,0x20(%edx)
+    tc->list[c] = p->s.ptr;
+    1a31:	89 1a                	mov    %ebx,(%edx)
+    p->s.ptr = small[c];
+    1a33:	8b 1c b5 e0 54 00 00 	mov    0x54e0(,%esi,4),%ebx
+    1a3a:	89 18                	mov    %ebx,(%eax)
+    small[c] = p;
+    1a3c:	89 04 b5 e0 54 00 00 	mov    %eax,0x54e0(,%esi,4)
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1a43:	85 c9                	test   %ecx,%ecx
+    1a45:	7e 06                	jle    1a4d <drain+0x4d>
+    1a47:	8b 02                	mov    (%edx),%eax
+    1a49:	85 c0                	test   %eax,%eax
+    1a4b:	75 db                	jne    1a28 <drain+0x28>
+  if(threaded)
+    1a4d:	a1 84 54 00 00       	mov    0x5484,%eax
+    1a52:	85 c0                	test   %eax,%eax
+    1a54:	74 10                	je     1a66 <drain+0x66>
+    mutex_unlock(&lock);
+    1a56:	83 ec 0c             	sub    $0xc,%esp
+    1a59:	68 88 54 00 00       	push   $0x5488
+    1a5e:	e8 1d ec ff ff       	call   680 <mutex_unlock>
+}
+    1a63:	83 c4 10             	add    $0x10,%esp
+  }
+  release();
+}
+    1a66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a69:	5b                   	pop    %ebx
+    1a6a:	5e                   	pop    %esi
+    1a6b:	5f                   	pop    %edi
+    1a6c:	5d                   	pop    %ebp
+    1a6d:	c3                   	ret
+    1a6e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&lock);
+    1a70:	83 ec 0c             	sub    $0xc,%esp
+    1a73:	68 88 54 00 00       	push   $0x5488
+    1a78:	e8 b3 eb ff ff       	call   630 <mutex_lock>
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1a7d:	83 c4 10             	add    $0x10,%esp
+    1a80:	85 db                	test   %ebx,%ebx
+    1a82:	7f 99                	jg     1a1d <drain+0x1d>
+    1a84:	eb c7                	jmp    1a4d <drain+0x4d>
+    1a86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001a90 <mycache>:
+{
+    1a90:	55                   	push   %ebp
+    return &maincache;
+    1a91:	b8 a0 54 00 00       	mov    $0x54a0,%eax
+{
+    1a96:	89 e5                	mov    %esp,%ebp
+    1a98:	53                   	push   %ebx
+  sp = PGROUNDDOWN((uint)&sp);
+    1a99:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+    1a9c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+    1aa2:	83 ec 14             	sub    $0x14,%esp
+  if(!threaded || sp == mainstack)
+    1aa5:	8b 0d 84 54 00 00    	mov    0x5484,%ecx
+  sp = PGROUNDDOWN((uint)&sp);
+    1aab:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  if(!threaded || sp == mainstack)
+    1aae:	85 c9                	test   %ecx,%ecx
+    1ab0:	74 0f                	je     1ac1 <mycache+0x31>
+    1ab2:	3b 1d 80 54 00 00    	cmp    0x5480,%ebx
+    1ab8:	74 07                	je     1ac1 <mycache+0x31>
+  if(*cp == 0){
+    1aba:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    1abd:	85 c0                	test   %eax,%eax
+    1abf:	74 0f                	je     1ad0 <mycache+0x40>
+}
+    1ac1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1ac4:	c9                   	leave
+    1ac5:	c3                   	ret
+    1ac6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1acd:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1ad0:	83 ec 0c             	sub    $0xc,%esp
+    1ad3:	68 88 54 00 00       	push   $0x5488
+    1ad8:	e8 53 eb ff ff       	call   630 <mutex_lock>
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    1add:	b8 09 00 00 00       	mov    $0x9,%eax
+    1ae2:	e8 29 fe ff ff       	call   1910 <bigalloc>
+  if(threaded)
+    1ae7:	8b 15 84 54 00 00    	mov    0x5484,%edx
+    1aed:	83 c4 10             	add    $0x10,%esp
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    1af0:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(threaded)
+    1af3:	85 d2                	test   %edx,%edx
+    1af5:	75 29                	jne    1b20 <mycache+0x90>
+    if(*cp == 0)
+    1af7:	85 c0                	test   %eax,%eax
+    1af9:	74 c6                	je     1ac1 <mycache+0x31>
+    memset(*cp, 0, sizeof(**cp));
+    1afb:	83 ec 04             	sub    $0x4,%esp
+    *cp = (struct tcache*)((Header*)*cp + 1);
+    1afe:	83 c0 08             	add    $0x8,%eax
+    1b01:	89 43 f8             	mov    %eax,-0x8(%ebx)
+    memset(*cp, 0, sizeof(**cp));
+    1b04:	6a 40                	push   $0x40
+    1b06:	6a 00                	push   $0x0
+    1b08:	50                   	push   %eax
+    1b09:	e8 f2 e9 ff ff       	call   500 <memset>
+  return *cp;
+    1b0e:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    1b11:	83 c4 10             	add    $0x10,%esp
+    1b14:	eb ab                	jmp    1ac1 <mycache+0x31>
+    1b16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b1d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1b20:	83 ec 0c             	sub    $0xc,%esp
+    1b23:	68 88 54 00 00       	push   $0x5488
+    1b28:	e8 53 eb ff ff       	call   680 <mutex_unlock>
+    if(*cp == 0)
+    1b2d:	8b 43 f8             	mov    -0x8(%ebx),%eax
+}
+    1b30:	83 c4 10             	add    $0x10,%esp
+    1b33:	eb c2                	jmp    1af7 <mycache+0x67>
+    1b35:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001b40 <free>:
+
+void
+free(void *ap)
+{
+    1b40:	55                   	push   %ebp
+    1b41:	89 e5                	mov    %esp,%ebp
+    1b43:	57                   	push   %edi
+    1b44:	56                   	push   %esi
+    1b45:	53                   	push   %ebx
+    1b46:	83 ec 1c             	sub    $0x1c,%esp
+    1b49:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  struct tcache *tc;
+  int c;
+
+  if(ap == 0)
+    1b4c:	85 f6                	test   %esi,%esi
+    1b4e:	74 51                	je     1ba1 <free+0x61>
+    return;
+  bp = (Header*)ap - 1;
+    1b50:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1b53:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(bp->s.size > SMALLMAX / sizeof(Header)){
+    1b56:	8b 46 fc             	mov    -0x4(%esi),%eax
+    1b59:	3d 00 01 00 00       	cmp    $0x100,%eax
+    1b5e:	77 50                	ja     1bb0 <free+0x70>
+    acquire();
+    trim(bigfree(bp));
+    release();
+    return;
+  }
+  for(c = 0; (2 << c) < bp->s.size; c++)
+    1b60:	31 db                	xor    %ebx,%ebx
+    1b62:	ba 02 00 00 00       	mov    $0x2,%edx
+    1b67:	83 f8 02             	cmp    $0x2,%eax
+    1b6a:	76 11                	jbe    1b7d <free+0x3d>
+    1b6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1b70:	83 c3 01             	add    $0x1,%ebx
+    1b73:	89 d7                	mov    %edx,%edi
+    1b75:	89 d9                	mov    %ebx,%ecx
+    1b77:	d3 e7                	shl    %cl,%edi
+    1b79:	39 c7                	cmp    %eax,%edi
+    1b7b:	72 f3                	jb     1b70 <free+0x30>
+    ;
+  if((tc = mycache()) == 0){
+    1b7d:	e8 0e ff ff ff       	call   1a90 <mycache>
+    1b82:	85 c0                	test   %eax,%eax
+    1b84:	74 7a                	je     1c00 <free+0xc0>
+    bp->s.ptr = small[c];
+    small[c] = bp;
+    release();
+    return;
+  }
+  bp->s.ptr = tc->list[c];
+    1b86:	8d 0c 98             	lea    (%eax,%ebx,4),%ecx
+    1b89:	8b 11                	mov    (%ecx),%edx
+    1b8b:	89 56 f8             	mov    %edx,-0x8(%esi)
+  tc->list[c] = bp;
+    1b8e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1b91:	89 31                	mov    %esi,(%ecx)
+  if(++tc->n[c] > TCACHEMAX)
+    1b93:	8b 71 20             	mov    0x20(%ecx),%esi
+    1b96:	8d 56 01             	lea    0x1(%esi),%edx
+    1b99:	89 51 20             	mov    %edx,0x20(%ecx)
+    1b9c:	83 fa 20             	cmp    $0x20,%edx
+    1b9f:	7f 47                	jg     1be8 <free+0xa8>
+    drain(tc, c, BATCH);
+}
+    1ba1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ba4:	5b                   	pop    %ebx
+    1ba5:	5e                   	pop    %esi
+    1ba6:	5f                   	pop    %edi
+    1ba7:	5d                   	pop    %ebp
+    1ba8:	c3                   	ret
+    1ba9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1bb0:	8b 1d 84 54 00 00    	mov    0x5484,%ebx
+    1bb6:	85 db                	test   %ebx,%ebx
+    1bb8:	75 66                	jne    1c20 <free+0xe0>
+    trim(bigfree(bp));
+    1bba:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1bbd:	e8 4e fc ff ff       	call   1810 <bigfree>
+    1bc2:	e8 c9 fc ff ff       	call   1890 <trim>
+  if(threaded)
+    1bc7:	8b 0d 84 54 00 00    	mov    0x5484,%ecx
+    1bcd:	85 c9                	test   %ecx,%ecx
+    1bcf:	74 d0                	je     1ba1 <free+0x61>
+    mutex_unlock(&lock);
+    1bd1:	c7 45 08 88 54 00 00 	movl   $0x5488,0x8(%ebp)
+}
+    1bd8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1bdb:	5b                   	pop    %ebx
+    1bdc:	5e                   	pop    %esi
+    1bdd:	5f                   	pop    %edi
+    1bde:	5d                   	pop    %ebp
+    mutex_unlock(&lock);
+    1bdf:	e9 9c ea ff ff       	jmp    680 <mutex_unlock>
+    1be4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    1be8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    drain(tc, c, BATCH);
+    1beb:	89 da                	mov    %ebx,%edx
+    1bed:	b9 10 00 00 00       	mov    $0x10,%ecx
+}
+    1bf2:	5b                   	pop    %ebx
+    1bf3:	5e                   	pop    %esi
+    1bf4:	5f                   	pop    %edi
+    1bf5:	5d                   	pop    %ebp
+    drain(tc, c, BATCH);
+    1bf6:	e9 05 fe ff ff       	jmp    1a00 <drain>
+    1bfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1bff:	90                   	nop
+  if(threaded)
+    1c00:	8b 15 84 54 00 00    	mov    0x5484,%edx
+    1c06:	85 d2                	test   %edx,%edx
+    1c08:	75 28                	jne    1c32 <free+0xf2>
+    bp->s.ptr = small[c];
+    1c0a:	8b 04 9d e0 54 00 00 	mov    0x54e0(,%ebx,4),%eax
+    1c11:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1c14:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1c17:	89 04 9d e0 54 00 00 	mov    %eax,0x54e0(,%ebx,4)
+  if(threaded)
+    1c1e:	eb 81                	jmp    1ba1 <free+0x61>
+    mutex_lock(&lock);
+    1c20:	83 ec 0c             	sub    $0xc,%esp
+    1c23:	68 88 54 00 00       	push   $0x5488
+    1c28:	e8 03 ea ff ff       	call   630 <mutex_lock>
+}
+    1c2d:	83 c4 10             	add    $0x10,%esp
+    1c30:	eb 88                	jmp    1bba <free+0x7a>
+    mutex_lock(&lock);
+    1c32:	83 ec 0c             	sub    $0xc,%esp
+    1c35:	68 88 54 00 00       	push   $0x5488
+    1c3a:	e8 f1 e9 ff ff       	call   630 <mutex_lock>
+    bp->s.ptr = small[c];
+    1c3f:	8b 04 9d e0 54 00 00 	mov    0x54e0(,%ebx,4),%eax
+  if(threaded)
+    1c46:	83 c4 10             	add    $0x10,%esp
+    bp->s.ptr = small[c];
+    1c49:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1c4c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1c4f:	89 04 9d e0 54 00 00 	mov    %eax,0x54e0(,%ebx,4)
+  if(threaded)
+    1c56:	a1 84 54 00 00       	mov    0x5484,%eax
+    1c5b:	85 c0                	test   %eax,%eax
+    1c5d:	0f 85 6e ff ff ff    	jne    1bd1 <free+0x91>
+    1c63:	e9 39 ff ff ff       	jmp    1ba1 <free+0x61>
+    1c68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c6f:	90                   	nop
+
+00001c70 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1c70:	55                   	push   %ebp
+    1c71:	89 e5                	mov    %esp,%ebp
+    1c73:	57                   	push   %edi
+    1c74:	56                   	push   %esi
+    1c75:	53                   	push   %ebx
+    1c76:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  struct tcache *tc;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1c79:	8b 45 08             	mov    0x8(%ebp),%eax
+    1c7c:	8d 78 07             	lea    0x7(%eax),%edi
+    1c7f:	c1 ef 03             	shr    $0x3,%edi
+    1c82:	83 c7 01             	add    $0x1,%edi
+  if(nunits > SMALLMAX / sizeof(Header)){
+    1c85:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+    1c8b:	77 5b                	ja     1ce8 <malloc+0x78>
+    acquire();
+    p = bigalloc(nunits);
+    release();
+    return p ? (void*)(p + 1) : 0;
+  }
+  for(c = 0; (2 << c) < nunits; c++)
+    1c8d:	31 c9                	xor    %ecx,%ecx
+    1c8f:	b8 02 00 00 00       	mov    $0x2,%eax
+    1c94:	be 02 00 00 00       	mov    $0x2,%esi
+    1c99:	bb 02 00 00 00       	mov    $0x2,%ebx
+    1c9e:	83 ff 02             	cmp    $0x2,%edi
+    1ca1:	76 12                	jbe    1cb5 <malloc+0x45>
+    1ca3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1ca7:	90                   	nop
+    1ca8:	83 c1 01             	add    $0x1,%ecx
+    1cab:	89 c3                	mov    %eax,%ebx
+    1cad:	d3 e3                	shl    %cl,%ebx
+    1caf:	89 de                	mov    %ebx,%esi
+    1cb1:	39 fb                	cmp    %edi,%ebx
+    1cb3:	72 f3                	jb     1ca8 <malloc+0x38>
+    1cb5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    ;
+  if((tc = mycache()) == 0)
+    1cb8:	e8 d3 fd ff ff       	call   1a90 <mycache>
+    1cbd:	85 c0                	test   %eax,%eax
+    1cbf:	74 51                	je     1d12 <malloc+0xa2>
+    return 0;
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1cc1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1cc4:	8d 3c 88             	lea    (%eax,%ecx,4),%edi
+    1cc7:	8b 07                	mov    (%edi),%eax
+    1cc9:	85 c0                	test   %eax,%eax
+    1ccb:	74 53                	je     1d20 <malloc+0xb0>
+    return 0;
+  p = tc->list[c];
+  tc->list[c] = p->s.ptr;
+  tc->n[c]--;
+    1ccd:	8b 57 20             	mov    0x20(%edi),%edx
+  tc->list[c] = p->s.ptr;
+    1cd0:	8b 08                	mov    (%eax),%ecx
+  tc->n[c]--;
+    1cd2:	83 ea 01             	sub    $0x1,%edx
+  return (void*)(p + 1);
+    1cd5:	83 c0 08             	add    $0x8,%eax
+  tc->n[c]--;
+    1cd8:	89 57 20             	mov    %edx,0x20(%edi)
+  tc->list[c] = p->s.ptr;
+    1cdb:	89 0f                	mov    %ecx,(%edi)
+}
+    1cdd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ce0:	5b                   	pop    %ebx
+    1ce1:	5e                   	pop    %esi
+    1ce2:	5f                   	pop    %edi
+    1ce3:	5d                   	pop    %ebp
+    1ce4:	c3                   	ret
+    1ce5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1ce8:	a1 84 54 00 00       	mov    0x5484,%eax
+    1ced:	85 c0                	test   %eax,%eax
+    1cef:	0f 85 b3 00 00 00    	jne    1da8 <malloc+0x138>
+    p = bigalloc(nunits);
+    1cf5:	89 f8                	mov    %edi,%eax
+    1cf7:	e8 14 fc ff ff       	call   1910 <bigalloc>
+    1cfc:	89 c3                	mov    %eax,%ebx
+  if(threaded)
+    1cfe:	a1 84 54 00 00       	mov    0x5484,%eax
+    1d03:	85 c0                	test   %eax,%eax
+    1d05:	0f 85 85 00 00 00    	jne    1d90 <malloc+0x120>
+    return p ? (void*)(p + 1) : 0;
+    1d0b:	8d 43 08             	lea    0x8(%ebx),%eax
+    1d0e:	85 db                	test   %ebx,%ebx
+    1d10:	75 cb                	jne    1cdd <malloc+0x6d>
+    1d12:	31 c0                	xor    %eax,%eax
+}
+    1d14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d17:	5b                   	pop    %ebx
+    1d18:	5e                   	pop    %esi
+    1d19:	5f                   	pop    %edi
+    1d1a:	5d                   	pop    %ebp
+    1d1b:	c3                   	ret
+    1d1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1d20:	a1 84 54 00 00       	mov    0x5484,%eax
+    1d25:	85 c0                	test   %eax,%eax
+    1d27:	0f 85 29 01 00 00    	jne    1e56 <malloc+0x1e6>
+  if(small[c] == 0){
+    1d2d:	8b 04 8d e0 54 00 00 	mov    0x54e0(,%ecx,4),%eax
+    1d34:	85 c0                	test   %eax,%eax
+    1d36:	0f 84 81 00 00 00    	je     1dbd <malloc+0x14d>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1d3c:	31 db                	xor    %ebx,%ebx
+    1d3e:	eb 22                	jmp    1d62 <malloc+0xf2>
+    small[c] = p->s.ptr;
+    1d40:	8b 10                	mov    (%eax),%edx
+  for(moved = 0; moved < n && small[c]; moved++){
+    1d42:	83 c3 01             	add    $0x1,%ebx
+    small[c] = p->s.ptr;
+    1d45:	89 14 8d e0 54 00 00 	mov    %edx,0x54e0(,%ecx,4)
+    p->s.ptr = tc->list[c];
+    1d4c:	8b 17                	mov    (%edi),%edx
+    1d4e:	89 10                	mov    %edx,(%eax)
+    tc->list[c] = p;
+    1d50:	89 07                	mov    %eax,(%edi)
+  for(moved = 0; moved < n && small[c]; moved++){
+    1d52:	83 fb 10             	cmp    $0x10,%ebx
+    1d55:	0f 84 e2 00 00 00    	je     1e3d <malloc+0x1cd>
+    1d5b:	8b 04 8d e0 54 00 00 	mov    0x54e0(,%ecx,4),%eax
+    1d62:	85 c0                	test   %eax,%eax
+    1d64:	75 da                	jne    1d40 <malloc+0xd0>
+  if(threaded)
+    1d66:	8b 15 84 54 00 00    	mov    0x5484,%edx
+    1d6c:	85 d2                	test   %edx,%edx
+    1d6e:	0f 85 b4 00 00 00    	jne    1e28 <malloc+0x1b8>
+  tc->n[c] += moved;
+    1d74:	8b 57 20             	mov    0x20(%edi),%edx
+    1d77:	01 da                	add    %ebx,%edx
+    1d79:	89 57 20             	mov    %edx,0x20(%edi)
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1d7c:	85 db                	test   %ebx,%ebx
+    1d7e:	74 92                	je     1d12 <malloc+0xa2>
+  p = tc->list[c];
+    1d80:	8b 07                	mov    (%edi),%eax
+    1d82:	e9 49 ff ff ff       	jmp    1cd0 <malloc+0x60>
+    1d87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d8e:	66 90                	xchg   %ax,%ax
+    mutex_unlock(&lock);
+    1d90:	83 ec 0c             	sub    $0xc,%esp
+    1d93:	68 88 54 00 00       	push   $0x5488
+    1d98:	e8 e3 e8 ff ff       	call   680 <mutex_unlock>
+}
+    1d9d:	83 c4 10             	add    $0x10,%esp
+    1da0:	e9 66 ff ff ff       	jmp    1d0b <malloc+0x9b>
+    1da5:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1da8:	83 ec 0c             	sub    $0xc,%esp
+    1dab:	68 88 54 00 00       	push   $0x5488
+    1db0:	e8 7b e8 ff ff       	call   630 <mutex_lock>
+}
+    1db5:	83 c4 10             	add    $0x10,%esp
+    1db8:	e9 38 ff ff ff       	jmp    1cf5 <malloc+0x85>
+    if((chunk = bigalloc(CHUNK / sizeof(Header) + 1)) == 0){
+    1dbd:	b8 01 02 00 00       	mov    $0x201,%eax
+    1dc2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1dc5:	e8 46 fb ff ff       	call   1910 <bigalloc>
+    1dca:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1dcd:	85 c0                	test   %eax,%eax
+    1dcf:	89 c2                	mov    %eax,%edx
+    1dd1:	0f 84 ba 00 00 00    	je     1e91 <malloc+0x221>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1dd7:	83 c2 08             	add    $0x8,%edx
+    1dda:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+    1de0:	0f 87 d0 00 00 00    	ja     1eb6 <malloc+0x246>
+    1de6:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+    1ded:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    1df0:	89 df                	mov    %ebx,%edi
+    1df2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1df5:	8d 76 00             	lea    0x0(%esi),%esi
+      p->s.size = units;
+    1df8:	89 72 04             	mov    %esi,0x4(%edx)
+      p->s.ptr = small[c];
+    1dfb:	8b 04 8d e0 54 00 00 	mov    0x54e0(,%ecx,4),%eax
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1e02:	01 df                	add    %ebx,%edi
+    1e04:	89 55 e0             	mov    %edx,-0x20(%ebp)
+      p->s.ptr = small[c];
+    1e07:	89 02                	mov    %eax,(%edx)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1e09:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      small[c] = p;
+    1e0c:	89 14 8d e0 54 00 00 	mov    %edx,0x54e0(,%ecx,4)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1e13:	01 c2                	add    %eax,%edx
+    1e15:	81 ff 00 02 00 00    	cmp    $0x200,%edi
+    1e1b:	76 db                	jbe    1df8 <malloc+0x188>
+    1e1d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1e20:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1e23:	e9 14 ff ff ff       	jmp    1d3c <malloc+0xcc>
+    mutex_unlock(&lock);
+    1e28:	83 ec 0c             	sub    $0xc,%esp
+    1e2b:	68 88 54 00 00       	push   $0x5488
+    1e30:	e8 4b e8 ff ff       	call   680 <mutex_unlock>
+}
+    1e35:	83 c4 10             	add    $0x10,%esp
+    1e38:	e9 37 ff ff ff       	jmp    1d74 <malloc+0x104>
+  if(threaded)
+    1e3d:	a1 84 54 00 00       	mov    0x5484,%eax
+    1e42:	85 c0                	test   %eax,%eax
+    1e44:	75 2b                	jne    1e71 <malloc+0x201>
+  tc->n[c] += moved;
+    1e46:	8b 47 20             	mov    0x20(%edi),%eax
+    1e49:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1e4c:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1e4e:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1e51:	e9 7a fe ff ff       	jmp    1cd0 <malloc+0x60>
+    mutex_lock(&lock);
+    1e56:	83 ec 0c             	sub    $0xc,%esp
+    1e59:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1e5c:	68 88 54 00 00       	push   $0x5488
+    1e61:	e8 ca e7 ff ff       	call   630 <mutex_lock>
+}
+    1e66:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1e69:	83 c4 10             	add    $0x10,%esp
+    1e6c:	e9 bc fe ff ff       	jmp    1d2d <malloc+0xbd>
+    mutex_unlock(&lock);
+    1e71:	83 ec 0c             	sub    $0xc,%esp
+    1e74:	68 88 54 00 00       	push   $0x5488
+    1e79:	e8 02 e8 ff ff       	call   680 <mutex_unlock>
+  tc->n[c] += moved;
+    1e7e:	8b 47 20             	mov    0x20(%edi),%eax
+    1e81:	83 c4 10             	add    $0x10,%esp
+    1e84:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1e87:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1e89:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1e8c:	e9 3f fe ff ff       	jmp    1cd0 <malloc+0x60>
+  if(threaded)
+    1e91:	8b 0d 84 54 00 00    	mov    0x5484,%ecx
+    1e97:	85 c9                	test   %ecx,%ecx
+    1e99:	0f 84 73 fe ff ff    	je     1d12 <malloc+0xa2>
+    mutex_unlock(&lock);
+    1e9f:	83 ec 0c             	sub    $0xc,%esp
+    1ea2:	68 88 54 00 00       	push   $0x5488
+    1ea7:	e8 d4 e7 ff ff       	call   680 <mutex_unlock>
+    1eac:	83 c4 10             	add    $0x10,%esp
+    return p ? (void*)(p + 1) : 0;
+    1eaf:	31 c0                	xor    %eax,%eax
+    1eb1:	e9 5e fe ff ff       	jmp    1d14 <malloc+0xa4>
+  for(moved = 0; moved < n && small[c]; moved++){
+    1eb6:	8b 04 8d e0 54 00 00 	mov    0x54e0(,%ecx,4),%eax
+    1ebd:	e9 7a fe ff ff       	jmp    1d3c <malloc+0xcc>
+    1ec2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ec9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001ed0 <malloc_threaded>:
+void
+malloc_threaded(void)
+{
+  uint sp;
+
+  if(threaded)
+    1ed0:	a1 84 54 00 00       	mov    0x5484,%eax
+    1ed5:	85 c0                	test   %eax,%eax
+    1ed7:	74 07                	je     1ee0 <malloc_threaded+0x10>
+    1ed9:	c3                   	ret
+    1eda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+{
+    1ee0:	55                   	push   %ebp
+    1ee1:	89 e5                	mov    %esp,%ebp
+    1ee3:	83 ec 24             	sub    $0x24,%esp
+    return;
+  mutex_init(&lock);
+    1ee6:	68 88 54 00 00       	push   $0x5488
+    1eeb:	e8 30 e7 ff ff       	call   620 <mutex_init>
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1ef0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1ef3:	83 c4 10             	add    $0x10,%esp
+  threaded = 1;
+    1ef6:	c7 05 84 54 00 00 01 	movl   $0x1,0x5484
+    1efd:	00 00 00 
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1f00:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    1f05:	a3 80 54 00 00       	mov    %eax,0x5480
+}
+    1f0a:	c9                   	leave
+    1f0b:	c3                   	ret
+    1f0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001f10 <malloc_thread_exit>:
+
+// Called by thread_join() with the cache slot of a finished
+// thread: give its blocks, and the cache itself, back.
+void
+malloc_thread_exit(void **cachep)
+{
+    1f10:	55                   	push   %ebp
+    1f11:	89 e5                	mov    %esp,%ebp
+    1f13:	57                   	push   %edi
+    1f14:	56                   	push   %esi
+    1f15:	53                   	push   %ebx
+    1f16:	83 ec 0c             	sub    $0xc,%esp
+    1f19:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct tcache *tc;
+  int c;
+
+  if((tc = *cachep) == 0)
+    1f1c:	8b 37                	mov    (%edi),%esi
+    1f1e:	85 f6                	test   %esi,%esi
+    1f20:	74 41                	je     1f63 <malloc_thread_exit+0x53>
+    return;
+  for(c = 0; c < NCLASS; c++)
+    1f22:	31 db                	xor    %ebx,%ebx
+    1f24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    drain(tc, c, tc->n[c]);
+    1f28:	8b 4c 9e 20          	mov    0x20(%esi,%ebx,4),%ecx
+    1f2c:	89 da                	mov    %ebx,%edx
+    1f2e:	89 f0                	mov    %esi,%eax
+  for(c = 0; c < NCLASS; c++)
+    1f30:	83 c3 01             	add    $0x1,%ebx
+    drain(tc, c, tc->n[c]);
+    1f33:	e8 c8 fa ff ff       	call   1a00 <drain>
+  for(c = 0; c < NCLASS; c++)
+    1f38:	83 fb 08             	cmp    $0x8,%ebx
+    1f3b:	75 eb                	jne    1f28 <malloc_thread_exit+0x18>
+  if(threaded)
+    1f3d:	8b 15 84 54 00 00    	mov    0x5484,%edx
+    1f43:	85 d2                	test   %edx,%edx
+    1f45:	75 29                	jne    1f70 <malloc_thread_exit+0x60>
+  acquire();
+  trim(bigfree((Header*)tc - 1));
+    1f47:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1f4a:	e8 c1 f8 ff ff       	call   1810 <bigfree>
+    1f4f:	e8 3c f9 ff ff       	call   1890 <trim>
+  if(threaded)
+    1f54:	a1 84 54 00 00       	mov    0x5484,%eax
+    1f59:	85 c0                	test   %eax,%eax
+    1f5b:	75 2b                	jne    1f88 <malloc_thread_exit+0x78>
+  release();
+  *cachep = 0;
+    1f5d:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+}
+    1f63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1f66:	5b                   	pop    %ebx
+    1f67:	5e                   	pop    %esi
+    1f68:	5f                   	pop    %edi
+    1f69:	5d                   	pop    %ebp
+    1f6a:	c3                   	ret
+    1f6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1f6f:	90                   	nop
+    mutex_lock(&lock);
+    1f70:	83 ec 0c             	sub    $0xc,%esp
+    1f73:	68 88 54 00 00       	push   $0x5488
+    1f78:	e8 b3 e6 ff ff       	call   630 <mutex_lock>
+}
+    1f7d:	83 c4 10             	add    $0x10,%esp
+    1f80:	eb c5                	jmp    1f47 <malloc_thread_exit+0x37>
+    1f82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1f88:	83 ec 0c             	sub    $0xc,%esp
+    1f8b:	68 88 54 00 00       	push   $0x5488
+    1f90:	e8 eb e6 ff ff       	call   680 <mutex_unlock>
+}
+    1f95:	83 c4 10             	add    $0x10,%esp
+    1f98:	eb c3                	jmp    1f5d <malloc_thread_exit+0x4d>
+    1f9a:	66 90                	xchg   %ax,%ax
+    1f9c:	66 90                	xchg   %ax,%ax
+    1f9e:	66 90                	xchg   %ax,%ax
+
+00001fa0 <thread_create>:
+
+// Start fn(arg) in a new thread on a freshly allocated
+// page-aligned stack.  Returns the thread's pid.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1fa0:	55                   	push   %ebp
+    1fa1:	89 e5                	mov    %esp,%ebp
+    1fa3:	53                   	push   %ebx
+    1fa4:	83 ec 14             	sub    $0x14,%esp
+  char *mem, *stack;
+  int pid;
+
+  malloc_threaded();
+    1fa7:	e8 24 ff ff ff       	call   1ed0 <malloc_threaded>
+  stdio_threaded();
+    1fac:	e8 cf ee ff ff       	call   e80 <stdio_threaded>
+  if((mem = malloc(2*PGSIZE)) == 0)
+    1fb1:	83 ec 0c             	sub    $0xc,%esp
+    1fb4:	68 00 20 00 00       	push   $0x2000
+    1fb9:	e8 b2 fc ff ff       	call   1c70 <malloc>
+    1fbe:	83 c4 10             	add    $0x10,%esp
+    1fc1:	85 c0                	test   %eax,%eax
+    1fc3:	74 52                	je     2017 <thread_create+0x77>
+    1fc5:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1fc7:	8d 80 07 10 00 00    	lea    0x1007(%eax),%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+  ((char**)stack)[-2] = 0;
+  if((pid = clone(fn, arg, stack)) < 0)
+    1fcd:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1fd0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+    1fd5:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  ((char**)stack)[-2] = 0;
+    1fd8:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+  if((pid = clone(fn, arg, stack)) < 0)
+    1fdf:	50                   	push   %eax
+    1fe0:	ff 75 0c             	push   0xc(%ebp)
+    1fe3:	ff 75 08             	push   0x8(%ebp)
+    1fe6:	e8 97 e8 ff ff       	call   882 <clone>
+    1feb:	83 c4 10             	add    $0x10,%esp
+    1fee:	85 c0                	test   %eax,%eax
+    1ff0:	78 0e                	js     2000 <thread_create+0x60>
+    free(mem);
+  return pid;
+}
+    1ff2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1ff5:	c9                   	leave
+    1ff6:	c3                   	ret
+    1ff7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ffe:	66 90                	xchg   %ax,%ax
+    free(mem);
+    2000:	83 ec 0c             	sub    $0xc,%esp
+    2003:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    2006:	53                   	push   %ebx
+    2007:	e8 34 fb ff ff       	call   1b40 <free>
+    200c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    200f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    2012:	83 c4 10             	add    $0x10,%esp
+}
+    2015:	c9                   	leave
+    2016:	c3                   	ret
+    return -1;
+    2017:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    201c:	eb d4                	jmp    1ff2 <thread_create+0x52>
+    201e:	66 90                	xchg   %ax,%ax
+
+00002020 <thread_join>:
+
+// Wait for a thread to finish and free its stack.
+int
+thread_join(void)
+{
+    2020:	55                   	push   %ebp
+    2021:	89 e5                	mov    %esp,%ebp
+    2023:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    2024:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    2027:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    202a:	50                   	push   %eax
+    202b:	e8 61 e8 ff ff       	call   891 <join>
+    2030:	83 c4 10             	add    $0x10,%esp
+    2033:	85 c0                	test   %eax,%eax
+    2035:	78 29                	js     2060 <thread_join+0x40>
+    2037:	89 c3                	mov    %eax,%ebx
+    return -1;
+  malloc_thread_exit(&((void**)stack)[-2]);
+    2039:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    203c:	83 ec 0c             	sub    $0xc,%esp
+    203f:	83 e8 08             	sub    $0x8,%eax
+    2042:	50                   	push   %eax
+    2043:	e8 c8 fe ff ff       	call   1f10 <malloc_thread_exit>
+  free(((char**)stack)[-1]);
+    2048:	58                   	pop    %eax
+    2049:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    204c:	ff 70 fc             	push   -0x4(%eax)
+    204f:	e8 ec fa ff ff       	call   1b40 <free>
+  return pid;
+    2054:	83 c4 10             	add    $0x10,%esp
+}
+    2057:	89 d8                	mov    %ebx,%eax
+    2059:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    205c:	c9                   	leave
+    205d:	c3                   	ret
+    205e:	66 90                	xchg   %ax,%ax
+    return -1;
+    2060:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    2065:	eb f0                	jmp    2057 <thread_join+0x37>
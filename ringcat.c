@@ -0,0 +1,104 @@
+// cat, batching its reads and writes through ringenter():
+// one system call reads up to RINGSIZE blocks, and another
+// writes them out.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "syscall.h"
+#include "ring.h"
+
+struct ring r;
+char buf[RINGSIZE][512];
+int len[RINGSIZE];
+
+void
+queue(int op, int a0, int a1, int a2, uint data)
+{
+  struct sqe *e;
+
+  e = &r.sq[r.sqtail % RINGSIZE];
+  e->op = op;
+  e->arg[0] = a0;
+  e->arg[1] = a1;
+  e->arg[2] = a2;
+  e->arg[3] = 0;
+  e->data = data;
+  r.sqtail++;
+}
+
+// Run all queued requests.
+void
+submit(void)
+{
+  int n;
+
+  n = r.sqtail - r.sqhead;
+  if(ringenter(&r, n) != n){
+    printf(1, "ringcat: ringenter failed\n");
+    exit();
+  }
+}
+
+void
+cat(int fd)
+{
+  struct stat st;
+  struct cqe *c;
+  int i, nbuf, eof;
+
+  // Batch reads only from files: a read from the console
+  // waits for a whole line.
+  nbuf = 1;
+  if(fstat(fd, &st) == 0 && st.type == T_FILE)
+    nbuf = RINGSIZE;
+
+  for(eof = 0; !eof; ){
+    for(i = 0; i < nbuf; i++)
+      queue(SYS_read, fd, (int)buf[i], sizeof(buf[i]), i);
+    submit();
+    // Requests run in order, so the blocks complete in order.
+    for(; r.cqhead != r.cqtail; r.cqhead++){
+      c = &r.cq[r.cqhead % RINGSIZE];
+      if(c->res < 0){
+        printf(1, "cat: read error\n");
+        exit();
+      }
+      if(c->res == 0)
+        eof = 1;
+      if(eof)
+        continue;
+      len[c->data] = c->res;
+      queue(SYS_write, 1, (int)buf[c->data], c->res, c->data);
+    }
+    submit();
+    for(; r.cqhead != r.cqtail; r.cqhead++){
+      c = &r.cq[r.cqhead % RINGSIZE];
+      if(c->res != len[c->data]){
+        printf(1, "cat: write error\n");
+        exit();
+      }
+    }
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  int fd, i;
+
+  if(argc <= 1){
+    cat(0);
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+    close(fd);
+  }
+  exit();
+}
@@ -0,0 +1,4180 @@
+
+_rwbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "%s: %d procs, %d ticks\n", name, nproc, t1 - t0);
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	53                   	push   %ebx
+       e:	51                   	push   %ecx
+  if(argc > 1 && strcmp(argv[1], "-x") == 0)
+       f:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+      12:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc > 1 && strcmp(argv[1], "-x") == 0)
+      15:	7f 3b                	jg     52 <main+0x52>
+    exit();
+  if(argc > 1)
+    nproc = atoi(argv[1]);
+  if(nproc < 1)
+      17:	8b 0d a0 29 00 00    	mov    0x29a0,%ecx
+      1d:	85 c9                	test   %ecx,%ecx
+      1f:	7e 25                	jle    46 <main+0x46>
+    nproc = 1;
+
+  run("exec", 0);
+      21:	83 ec 08             	sub    $0x8,%esp
+      24:	6a 00                	push   $0x0
+      26:	68 40 1f 00 00       	push   $0x1f40
+      2b:	e8 60 01 00 00       	call   190 <run>
+  run("read", "usertests");
+      30:	58                   	pop    %eax
+      31:	5a                   	pop    %edx
+      32:	68 45 1f 00 00       	push   $0x1f45
+      37:	68 4f 1f 00 00       	push   $0x1f4f
+      3c:	e8 4f 01 00 00       	call   190 <run>
+  exit();
+      41:	e8 4a 02 00 00       	call   290 <exit>
+    nproc = 1;
+      46:	c7 05 a0 29 00 00 01 	movl   $0x1,0x29a0
+      4d:	00 00 00 
+      50:	eb cf                	jmp    21 <main+0x21>
+  if(argc > 1 && strcmp(argv[1], "-x") == 0)
+      52:	50                   	push   %eax
+      53:	50                   	push   %eax
+      54:	68 e0 1e 00 00       	push   $0x1ee0
+      59:	ff 73 04             	push   0x4(%ebx)
+      5c:	e8 7f 02 00 00       	call   2e0 <strcmp>
+      61:	83 c4 10             	add    $0x10,%esp
+      64:	85 c0                	test   %eax,%eax
+      66:	75 05                	jne    6d <main+0x6d>
+    exit();
+      68:	e8 23 02 00 00       	call   290 <exit>
+    nproc = atoi(argv[1]);
+      6d:	83 ec 0c             	sub    $0xc,%esp
+      70:	ff 73 04             	push   0x4(%ebx)
+      73:	e8 a8 03 00 00       	call   420 <atoi>
+      78:	83 c4 10             	add    $0x10,%esp
+      7b:	a3 a0 29 00 00       	mov    %eax,0x29a0
+      80:	eb 95                	jmp    17 <main+0x17>
+      82:	66 90                	xchg   %ax,%ax
+      84:	66 90                	xchg   %ax,%ax
+      86:	66 90                	xchg   %ax,%ax
+      88:	66 90                	xchg   %ax,%ax
+      8a:	66 90                	xchg   %ax,%ax
+      8c:	66 90                	xchg   %ax,%ax
+      8e:	66 90                	xchg   %ax,%ax
+
+00000090 <doexec>:
+{
+      90:	55                   	push   %ebp
+      91:	89 e5                	mov    %esp,%ebp
+      93:	53                   	push   %ebx
+  char *argv[] = { "rwbench", "-x", 0 };
+      94:	bb 32 00 00 00       	mov    $0x32,%ebx
+{
+      99:	83 ec 14             	sub    $0x14,%esp
+  char *argv[] = { "rwbench", "-x", 0 };
+      9c:	c7 45 ec d8 1e 00 00 	movl   $0x1ed8,-0x14(%ebp)
+      a3:	c7 45 f0 e0 1e 00 00 	movl   $0x1ee0,-0x10(%ebp)
+      aa:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  for(i = 0; i < NEXEC; i++){
+      b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    pid = fork();
+      b8:	e8 73 01 00 00       	call   230 <fork>
+    if(pid < 0){
+      bd:	85 c0                	test   %eax,%eax
+      bf:	78 11                	js     d2 <doexec+0x42>
+    if(pid == 0){
+      c1:	74 23                	je     e6 <doexec+0x56>
+    wait();
+      c3:	e8 1c 05 00 00       	call   5e4 <wait>
+  for(i = 0; i < NEXEC; i++){
+      c8:	83 eb 01             	sub    $0x1,%ebx
+      cb:	75 eb                	jne    b8 <doexec+0x28>
+}
+      cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      d0:	c9                   	leave
+      d1:	c3                   	ret
+      printf(1, "rwbench: fork failed\n");
+      d2:	83 ec 08             	sub    $0x8,%esp
+      d5:	68 e3 1e 00 00       	push   $0x1ee3
+      da:	6a 01                	push   $0x1
+      dc:	e8 6f 09 00 00       	call   a50 <printf>
+      exit();
+      e1:	e8 aa 01 00 00       	call   290 <exit>
+      exec("rwbench", argv);
+      e6:	83 ec 08             	sub    $0x8,%esp
+      e9:	8d 45 ec             	lea    -0x14(%ebp),%eax
+      ec:	50                   	push   %eax
+      ed:	68 d8 1e 00 00       	push   $0x1ed8
+      f2:	e8 69 01 00 00       	call   260 <exec>
+      printf(1, "rwbench: exec failed\n");
+      f7:	58                   	pop    %eax
+      f8:	5a                   	pop    %edx
+      f9:	68 f9 1e 00 00       	push   $0x1ef9
+      fe:	6a 01                	push   $0x1
+     100:	e8 4b 09 00 00       	call   a50 <printf>
+      exit();
+     105:	e8 86 01 00 00       	call   290 <exit>
+     10a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000110 <doread>:
+{
+     110:	55                   	push   %ebp
+     111:	89 e5                	mov    %esp,%ebp
+     113:	57                   	push   %edi
+     114:	56                   	push   %esi
+     115:	be 14 00 00 00       	mov    $0x14,%esi
+     11a:	53                   	push   %ebx
+     11b:	83 ec 0c             	sub    $0xc,%esp
+     11e:	8b 7d 08             	mov    0x8(%ebp),%edi
+     121:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if((fd = open(path, O_RDONLY)) < 0){
+     128:	83 ec 08             	sub    $0x8,%esp
+     12b:	6a 00                	push   $0x0
+     12d:	57                   	push   %edi
+     12e:	e8 1a 05 00 00       	call   64d <open>
+     133:	83 c4 10             	add    $0x10,%esp
+     136:	89 c3                	mov    %eax,%ebx
+     138:	85 c0                	test   %eax,%eax
+     13a:	78 37                	js     173 <doread+0x63>
+     13c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    while(read(fd, buf, sizeof(buf)) > 0)
+     140:	83 ec 04             	sub    $0x4,%esp
+     143:	68 00 02 00 00       	push   $0x200
+     148:	68 a0 2a 00 00       	push   $0x2aa0
+     14d:	53                   	push   %ebx
+     14e:	e8 af 04 00 00       	call   602 <read>
+     153:	83 c4 10             	add    $0x10,%esp
+     156:	85 c0                	test   %eax,%eax
+     158:	7f e6                	jg     140 <doread+0x30>
+    close(fd);
+     15a:	83 ec 0c             	sub    $0xc,%esp
+     15d:	53                   	push   %ebx
+     15e:	e8 bd 04 00 00       	call   620 <close>
+  for(i = 0; i < NREAD; i++){
+     163:	83 c4 10             	add    $0x10,%esp
+     166:	83 ee 01             	sub    $0x1,%esi
+     169:	75 bd                	jne    128 <doread+0x18>
+}
+     16b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     16e:	5b                   	pop    %ebx
+     16f:	5e                   	pop    %esi
+     170:	5f                   	pop    %edi
+     171:	5d                   	pop    %ebp
+     172:	c3                   	ret
+      printf(1, "rwbench: cannot open %s\n", path);
+     173:	83 ec 04             	sub    $0x4,%esp
+     176:	57                   	push   %edi
+     177:	68 0f 1f 00 00       	push   $0x1f0f
+     17c:	6a 01                	push   $0x1
+     17e:	e8 cd 08 00 00       	call   a50 <printf>
+      exit();
+     183:	e8 08 01 00 00       	call   290 <exit>
+     188:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     18f:	90                   	nop
+
+00000190 <run>:
+{
+     190:	55                   	push   %ebp
+     191:	89 e5                	mov    %esp,%ebp
+     193:	56                   	push   %esi
+     194:	53                   	push   %ebx
+     195:	31 db                	xor    %ebx,%ebx
+  t0 = uptime();
+     197:	e8 24 04 00 00       	call   5c0 <uptime>
+  for(i = 0; i < nproc; i++){
+     19c:	8b 15 a0 29 00 00    	mov    0x29a0,%edx
+  t0 = uptime();
+     1a2:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < nproc; i++){
+     1a4:	85 d2                	test   %edx,%edx
+     1a6:	7e 38                	jle    1e0 <run+0x50>
+     1a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1af:	90                   	nop
+    if(fork() == 0){
+     1b0:	e8 7b 00 00 00       	call   230 <fork>
+     1b5:	85 c0                	test   %eax,%eax
+     1b7:	74 4e                	je     207 <run+0x77>
+  for(i = 0; i < nproc; i++){
+     1b9:	a1 a0 29 00 00       	mov    0x29a0,%eax
+     1be:	83 c3 01             	add    $0x1,%ebx
+     1c1:	39 d8                	cmp    %ebx,%eax
+     1c3:	7f eb                	jg     1b0 <run+0x20>
+  for(i = 0; i < nproc; i++)
+     1c5:	85 c0                	test   %eax,%eax
+     1c7:	7e 17                	jle    1e0 <run+0x50>
+     1c9:	31 db                	xor    %ebx,%ebx
+     1cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1cf:	90                   	nop
+    wait();
+     1d0:	e8 0f 04 00 00       	call   5e4 <wait>
+  for(i = 0; i < nproc; i++)
+     1d5:	83 c3 01             	add    $0x1,%ebx
+     1d8:	39 1d a0 29 00 00    	cmp    %ebx,0x29a0
+     1de:	7f f0                	jg     1d0 <run+0x40>
+  t1 = uptime();
+     1e0:	e8 db 03 00 00       	call   5c0 <uptime>
+  printf(1, "%s: %d procs, %d ticks\n", name, nproc, t1 - t0);
+     1e5:	83 ec 0c             	sub    $0xc,%esp
+     1e8:	29 f0                	sub    %esi,%eax
+     1ea:	50                   	push   %eax
+     1eb:	ff 35 a0 29 00 00    	push   0x29a0
+     1f1:	ff 75 08             	push   0x8(%ebp)
+     1f4:	68 28 1f 00 00       	push   $0x1f28
+     1f9:	6a 01                	push   $0x1
+     1fb:	e8 50 08 00 00       	call   a50 <printf>
+}
+     200:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     203:	5b                   	pop    %ebx
+     204:	5e                   	pop    %esi
+     205:	5d                   	pop    %ebp
+     206:	c3                   	ret
+      if(path)
+     207:	8b 45 0c             	mov    0xc(%ebp),%eax
+     20a:	85 c0                	test   %eax,%eax
+     20c:	74 13                	je     221 <run+0x91>
+        doread(path);
+     20e:	83 ec 0c             	sub    $0xc,%esp
+     211:	ff 75 0c             	push   0xc(%ebp)
+     214:	e8 f7 fe ff ff       	call   110 <doread>
+     219:	83 c4 10             	add    $0x10,%esp
+      exit();
+     21c:	e8 6f 00 00 00       	call   290 <exit>
+        doexec();
+     221:	e8 6a fe ff ff       	call   90 <doexec>
+     226:	eb f4                	jmp    21c <run+0x8c>
+     228:	66 90                	xchg   %ax,%ax
+     22a:	66 90                	xchg   %ax,%ax
+     22c:	66 90                	xchg   %ax,%ax
+     22e:	66 90                	xchg   %ax,%ax
+
+00000230 <fork>:
+int sysexit(void) __attribute__((noreturn));
+
+int
+fork(void)
+{
+  if(flushhook)
+     230:	a1 a0 2c 00 00       	mov    0x2ca0,%eax
+     235:	85 c0                	test   %eax,%eax
+     237:	74 17                	je     250 <fork+0x20>
+{
+     239:	55                   	push   %ebp
+     23a:	89 e5                	mov    %esp,%ebp
+     23c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     23f:	ff d0                	call   *%eax
+  return sysfork();
+}
+     241:	c9                   	leave
+  return sysfork();
+     242:	e9 7f 03 00 00       	jmp    5c6 <sysfork>
+     247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     24e:	66 90                	xchg   %ax,%ax
+     250:	e9 71 03 00 00       	jmp    5c6 <sysfork>
+     255:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     25c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+     260:	55                   	push   %ebp
+  if(flushhook)
+     261:	a1 a0 2c 00 00       	mov    0x2ca0,%eax
+{
+     266:	89 e5                	mov    %esp,%ebp
+     268:	56                   	push   %esi
+     269:	53                   	push   %ebx
+     26a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     26d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     270:	85 c0                	test   %eax,%eax
+     272:	74 02                	je     276 <exec+0x16>
+    flushhook();
+     274:	ff d0                	call   *%eax
+  return sysexec(path, argv);
+     276:	89 75 0c             	mov    %esi,0xc(%ebp)
+     279:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     27c:	5b                   	pop    %ebx
+     27d:	5e                   	pop    %esi
+     27e:	5d                   	pop    %ebp
+  return sysexec(path, argv);
+     27f:	e9 ba 03 00 00       	jmp    63e <sysexec>
+     284:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     28b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     28f:	90                   	nop
+
+00000290 <exit>:
+
+int
+exit(void)
+{
+     290:	55                   	push   %ebp
+     291:	89 e5                	mov    %esp,%ebp
+     293:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     296:	a1 a0 2c 00 00       	mov    0x2ca0,%eax
+     29b:	85 c0                	test   %eax,%eax
+     29d:	74 02                	je     2a1 <exit+0x11>
+    flushhook();
+     29f:	ff d0                	call   *%eax
+  sysexit();
+     2a1:	e8 2f 03 00 00       	call   5d5 <sysexit>
+     2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002b0 <strcpy>:
+}
+
+char*
+strcpy(char *s, const char *t)
+{
+     2b0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     2b1:	31 c0                	xor    %eax,%eax
+{
+     2b3:	89 e5                	mov    %esp,%ebp
+     2b5:	53                   	push   %ebx
+     2b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     2b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     2c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     2c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     2c7:	83 c0 01             	add    $0x1,%eax
+     2ca:	84 d2                	test   %dl,%dl
+     2cc:	75 f2                	jne    2c0 <strcpy+0x10>
+    ;
+  return os;
+}
+     2ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2d1:	89 c8                	mov    %ecx,%eax
+     2d3:	c9                   	leave
+     2d4:	c3                   	ret
+     2d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     2e0:	55                   	push   %ebp
+     2e1:	89 e5                	mov    %esp,%ebp
+     2e3:	53                   	push   %ebx
+     2e4:	8b 55 08             	mov    0x8(%ebp),%edx
+     2e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     2ea:	0f b6 02             	movzbl (%edx),%eax
+     2ed:	84 c0                	test   %al,%al
+     2ef:	75 17                	jne    308 <strcmp+0x28>
+     2f1:	eb 3a                	jmp    32d <strcmp+0x4d>
+     2f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2f7:	90                   	nop
+     2f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     2fc:	83 c2 01             	add    $0x1,%edx
+     2ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     302:	84 c0                	test   %al,%al
+     304:	74 1a                	je     320 <strcmp+0x40>
+    p++, q++;
+     306:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     308:	0f b6 19             	movzbl (%ecx),%ebx
+     30b:	38 c3                	cmp    %al,%bl
+     30d:	74 e9                	je     2f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     30f:	29 d8                	sub    %ebx,%eax
+}
+     311:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     314:	c9                   	leave
+     315:	c3                   	ret
+     316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     31d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     320:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     324:	31 c0                	xor    %eax,%eax
+     326:	29 d8                	sub    %ebx,%eax
+}
+     328:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     32b:	c9                   	leave
+     32c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     32d:	0f b6 19             	movzbl (%ecx),%ebx
+     330:	31 c0                	xor    %eax,%eax
+     332:	eb db                	jmp    30f <strcmp+0x2f>
+     334:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     33b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     33f:	90                   	nop
+
+00000340 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     340:	55                   	push   %ebp
+     341:	89 e5                	mov    %esp,%ebp
+     343:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     346:	80 3a 00             	cmpb   $0x0,(%edx)
+     349:	74 15                	je     360 <strlen+0x20>
+     34b:	31 c0                	xor    %eax,%eax
+     34d:	8d 76 00             	lea    0x0(%esi),%esi
+     350:	83 c0 01             	add    $0x1,%eax
+     353:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     357:	89 c1                	mov    %eax,%ecx
+     359:	75 f5                	jne    350 <strlen+0x10>
+    ;
+  return n;
+}
+     35b:	89 c8                	mov    %ecx,%eax
+     35d:	5d                   	pop    %ebp
+     35e:	c3                   	ret
+     35f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     360:	31 c9                	xor    %ecx,%ecx
+}
+     362:	5d                   	pop    %ebp
+     363:	89 c8                	mov    %ecx,%eax
+     365:	c3                   	ret
+     366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     36d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000370 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     370:	55                   	push   %ebp
+     371:	89 e5                	mov    %esp,%ebp
+     373:	57                   	push   %edi
+     374:	8b 55 08             	mov    0x8(%ebp),%edx
+            "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt) {
+    asm volatile("cld; rep stosb" :
+     377:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     37a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     37d:	89 d7                	mov    %edx,%edi
+     37f:	fc                   	cld
+     380:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     382:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     385:	89 d0                	mov    %edx,%eax
+     387:	c9                   	leave
+     388:	c3                   	ret
+     389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     390:	55                   	push   %ebp
+     391:	89 e5                	mov    %esp,%ebp
+     393:	8b 45 08             	mov    0x8(%ebp),%eax
+     396:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     39a:	0f b6 10             	movzbl (%eax),%edx
+     39d:	84 d2                	test   %dl,%dl
+     39f:	75 12                	jne    3b3 <strchr+0x23>
+     3a1:	eb 1d                	jmp    3c0 <strchr+0x30>
+     3a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3a7:	90                   	nop
+     3a8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     3ac:	83 c0 01             	add    $0x1,%eax
+     3af:	84 d2                	test   %dl,%dl
+     3b1:	74 0d                	je     3c0 <strchr+0x30>
+    if(*s == c)
+     3b3:	38 d1                	cmp    %dl,%cl
+     3b5:	75 f1                	jne    3a8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     3b7:	5d                   	pop    %ebp
+     3b8:	c3                   	ret
+     3b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     3c0:	31 c0                	xor    %eax,%eax
+}
+     3c2:	5d                   	pop    %ebp
+     3c3:	c3                   	ret
+     3c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3cf:	90                   	nop
+
+000003d0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     3d0:	55                   	push   %ebp
+     3d1:	89 e5                	mov    %esp,%ebp
+     3d3:	56                   	push   %esi
+     3d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     3d5:	83 ec 08             	sub    $0x8,%esp
+     3d8:	6a 00                	push   $0x0
+     3da:	ff 75 08             	push   0x8(%ebp)
+     3dd:	e8 6b 02 00 00       	call   64d <open>
+  if(fd < 0)
+     3e2:	83 c4 10             	add    $0x10,%esp
+     3e5:	85 c0                	test   %eax,%eax
+     3e7:	78 27                	js     410 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     3e9:	83 ec 08             	sub    $0x8,%esp
+     3ec:	ff 75 0c             	push   0xc(%ebp)
+     3ef:	89 c3                	mov    %eax,%ebx
+     3f1:	50                   	push   %eax
+     3f2:	e8 83 02 00 00       	call   67a <fstat>
+  close(fd);
+     3f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     3fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+     3fc:	e8 1f 02 00 00       	call   620 <close>
+  return r;
+     401:	83 c4 10             	add    $0x10,%esp
+}
+     404:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     407:	89 f0                	mov    %esi,%eax
+     409:	5b                   	pop    %ebx
+     40a:	5e                   	pop    %esi
+     40b:	5d                   	pop    %ebp
+     40c:	c3                   	ret
+     40d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     410:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     415:	eb ed                	jmp    404 <stat+0x34>
+     417:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     41e:	66 90                	xchg   %ax,%ax
+
+00000420 <atoi>:
+
+int
+atoi(const char *s)
+{
+     420:	55                   	push   %ebp
+     421:	89 e5                	mov    %esp,%ebp
+     423:	53                   	push   %ebx
+     424:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     427:	0f be 02             	movsbl (%edx),%eax
+     42a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     42d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     430:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     435:	77 1e                	ja     455 <atoi+0x35>
+     437:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     43e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     440:	83 c2 01             	add    $0x1,%edx
+     443:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     446:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     44a:	0f be 02             	movsbl (%edx),%eax
+     44d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     450:	80 fb 09             	cmp    $0x9,%bl
+     453:	76 eb                	jbe    440 <atoi+0x20>
+  return n;
+}
+     455:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     458:	89 c8                	mov    %ecx,%eax
+     45a:	c9                   	leave
+     45b:	c3                   	ret
+     45c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000460 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     460:	55                   	push   %ebp
+     461:	89 e5                	mov    %esp,%ebp
+     463:	57                   	push   %edi
+     464:	56                   	push   %esi
+     465:	8b 45 10             	mov    0x10(%ebp),%eax
+     468:	8b 55 08             	mov    0x8(%ebp),%edx
+     46b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     46e:	85 c0                	test   %eax,%eax
+     470:	7e 13                	jle    485 <memmove+0x25>
+     472:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     474:	89 d7                	mov    %edx,%edi
+     476:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     47d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     480:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     481:	39 f8                	cmp    %edi,%eax
+     483:	75 fb                	jne    480 <memmove+0x20>
+  return vdst;
+}
+     485:	5e                   	pop    %esi
+     486:	89 d0                	mov    %edx,%eax
+     488:	5f                   	pop    %edi
+     489:	5d                   	pop    %ebp
+     48a:	c3                   	ret
+     48b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     48f:	90                   	nop
+
+00000490 <mutex_init>:
+
+// Futex-based mutex (Drepper, "Futexes Are Tricky", mutex 2).
+// The uncontended paths never enter the kernel.
+void
+mutex_init(struct mutex *m)
+{
+     490:	55                   	push   %ebp
+     491:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+     493:	8b 45 08             	mov    0x8(%ebp),%eax
+     496:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     49c:	5d                   	pop    %ebp
+     49d:	c3                   	ret
+     49e:	66 90                	xchg   %ax,%ax
+
+000004a0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     4a0:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     4a1:	31 c0                	xor    %eax,%eax
+     4a3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+     4a8:	89 e5                	mov    %esp,%ebp
+     4aa:	56                   	push   %esi
+     4ab:	53                   	push   %ebx
+     4ac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     4af:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     4b3:	85 c0                	test   %eax,%eax
+     4b5:	74 32                	je     4e9 <mutex_lock+0x49>
+    return;
+  if(c != 2)
+     4b7:	83 f8 02             	cmp    $0x2,%eax
+     4ba:	74 0c                	je     4c8 <mutex_lock+0x28>
+static inline uint
+xchg(volatile uint *addr, uint newval) {
+    uint result;
+
+    // The + in "+m" denotes a read-modify-write operand.
+    asm volatile("lock; xchgl %0, %1" :
+     4bc:	b8 02 00 00 00       	mov    $0x2,%eax
+     4c1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+     4c4:	85 c0                	test   %eax,%eax
+     4c6:	74 21                	je     4e9 <mutex_lock+0x49>
+     4c8:	be 02 00 00 00       	mov    $0x2,%esi
+     4cd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAIT, 2);
+     4d0:	83 ec 04             	sub    $0x4,%esp
+     4d3:	6a 02                	push   $0x2
+     4d5:	6a 00                	push   $0x0
+     4d7:	53                   	push   %ebx
+     4d8:	e8 33 02 00 00       	call   710 <futex>
+     4dd:	89 f0                	mov    %esi,%eax
+     4df:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     4e2:	83 c4 10             	add    $0x10,%esp
+     4e5:	85 c0                	test   %eax,%eax
+     4e7:	75 e7                	jne    4d0 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+     4e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4ec:	5b                   	pop    %ebx
+     4ed:	5e                   	pop    %esi
+     4ee:	5d                   	pop    %ebp
+     4ef:	c3                   	ret
+
+000004f0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     4f0:	55                   	push   %ebp
+     4f1:	89 e5                	mov    %esp,%ebp
+     4f3:	83 ec 08             	sub    $0x8,%esp
+     4f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     4f9:	f0 83 28 01          	lock subl $0x1,(%eax)
+     4fd:	75 09                	jne    508 <mutex_unlock+0x18>
+    m->val = 0;
+    futex(&m->val, FUTEX_WAKE, 1);
+  }
+}
+     4ff:	c9                   	leave
+     500:	c3                   	ret
+     501:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     508:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     50b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex(&m->val, FUTEX_WAKE, 1);
+     511:	6a 01                	push   $0x1
+     513:	6a 01                	push   $0x1
+     515:	50                   	push   %eax
+     516:	e8 f5 01 00 00       	call   710 <futex>
+     51b:	83 c4 10             	add    $0x10,%esp
+}
+     51e:	c9                   	leave
+     51f:	c3                   	ret
+
+00000520 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     520:	55                   	push   %ebp
+     521:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     523:	8b 45 08             	mov    0x8(%ebp),%eax
+     526:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     52c:	5d                   	pop    %ebp
+     52d:	c3                   	ret
+     52e:	66 90                	xchg   %ax,%ax
+
+00000530 <cond_wait>:
+
+// Release m and wait for a signal, then reacquire m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     530:	55                   	push   %ebp
+     531:	89 e5                	mov    %esp,%ebp
+     533:	57                   	push   %edi
+     534:	56                   	push   %esi
+     535:	53                   	push   %ebx
+     536:	83 ec 0c             	sub    $0xc,%esp
+     539:	8b 75 08             	mov    0x8(%ebp),%esi
+     53c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     53f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     541:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+     545:	75 21                	jne    568 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     547:	83 ec 04             	sub    $0x4,%esp
+     54a:	57                   	push   %edi
+     54b:	6a 00                	push   $0x0
+     54d:	56                   	push   %esi
+     54e:	e8 bd 01 00 00       	call   710 <futex>
+  mutex_lock(m);
+     553:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     556:	83 c4 10             	add    $0x10,%esp
+}
+     559:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     55c:	5b                   	pop    %ebx
+     55d:	5e                   	pop    %esi
+     55e:	5f                   	pop    %edi
+     55f:	5d                   	pop    %ebp
+  mutex_lock(m);
+     560:	e9 3b ff ff ff       	jmp    4a0 <mutex_lock>
+     565:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     568:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     56b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex(&m->val, FUTEX_WAKE, 1);
+     571:	6a 01                	push   $0x1
+     573:	6a 01                	push   $0x1
+     575:	53                   	push   %ebx
+     576:	e8 95 01 00 00       	call   710 <futex>
+     57b:	83 c4 10             	add    $0x10,%esp
+     57e:	eb c7                	jmp    547 <cond_wait+0x17>
+
+00000580 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+     580:	55                   	push   %ebp
+     581:	89 e5                	mov    %esp,%ebp
+     583:	83 ec 0c             	sub    $0xc,%esp
+     586:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     589:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+     58d:	6a 01                	push   $0x1
+     58f:	6a 01                	push   $0x1
+     591:	50                   	push   %eax
+     592:	e8 79 01 00 00       	call   710 <futex>
+}
+     597:	83 c4 10             	add    $0x10,%esp
+     59a:	c9                   	leave
+     59b:	c3                   	ret
+     59c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005a0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     5a0:	55                   	push   %ebp
+     5a1:	89 e5                	mov    %esp,%ebp
+     5a3:	83 ec 0c             	sub    $0xc,%esp
+     5a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     5a9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+     5ad:	6a 40                	push   $0x40
+     5af:	6a 01                	push   $0x1
+     5b1:	50                   	push   %eax
+     5b2:	e8 59 01 00 00       	call   710 <futex>
+}
+     5b7:	83 c4 10             	add    $0x10,%esp
+     5ba:	c9                   	leave
+     5bb:	c3                   	ret
+     5bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005c0 <uptime>:
+// Clock ticks since boot, read from the kernel's vdso page
+// without a system call.
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     5c0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+     5c5:	c3                   	ret
+
+000005c6 <sysfork>:
+  1: ret
+
+#define SYSCALL(name) SYSCALLAS(name, name)
+
+// ulib.c wraps these.
+SYSCALLAS(sysfork, fork)
+     5c6:	b8 01 00 00 00       	mov    $0x1,%eax
+     5cb:	89 e1                	mov    %esp,%ecx
+     5cd:	ba d4 05 00 00       	mov    $0x5d4,%edx
+     5d2:	0f 34                	sysenter
+     5d4:	c3                   	ret
+
+000005d5 <sysexit>:
+SYSCALLAS(sysexit, exit)
+     5d5:	b8 02 00 00 00       	mov    $0x2,%eax
+     5da:	89 e1                	mov    %esp,%ecx
+     5dc:	ba e3 05 00 00       	mov    $0x5e3,%edx
+     5e1:	0f 34                	sysenter
+     5e3:	c3                   	ret
+
+000005e4 <wait>:
+SYSCALL(wait)
+     5e4:	b8 03 00 00 00       	mov    $0x3,%eax
+     5e9:	89 e1                	mov    %esp,%ecx
+     5eb:	ba f2 05 00 00       	mov    $0x5f2,%edx
+     5f0:	0f 34                	sysenter
+     5f2:	c3                   	ret
+
+000005f3 <pipe>:
+SYSCALL(pipe)
+     5f3:	b8 04 00 00 00       	mov    $0x4,%eax
+     5f8:	89 e1                	mov    %esp,%ecx
+     5fa:	ba 01 06 00 00       	mov    $0x601,%edx
+     5ff:	0f 34                	sysenter
+     601:	c3                   	ret
+
+00000602 <read>:
+SYSCALL(read)
+     602:	b8 05 00 00 00       	mov    $0x5,%eax
+     607:	89 e1                	mov    %esp,%ecx
+     609:	ba 10 06 00 00       	mov    $0x610,%edx
+     60e:	0f 34                	sysenter
+     610:	c3                   	ret
+
+00000611 <write>:
+SYSCALL(write)
+     611:	b8 10 00 00 00       	mov    $0x10,%eax
+     616:	89 e1                	mov    %esp,%ecx
+     618:	ba 1f 06 00 00       	mov    $0x61f,%edx
+     61d:	0f 34                	sysenter
+     61f:	c3                   	ret
+
+00000620 <close>:
+SYSCALL(close)
+     620:	b8 15 00 00 00       	mov    $0x15,%eax
+     625:	89 e1                	mov    %esp,%ecx
+     627:	ba 2e 06 00 00       	mov    $0x62e,%edx
+     62c:	0f 34                	sysenter
+     62e:	c3                   	ret
+
+0000062f <kill>:
+SYSCALL(kill)
+     62f:	b8 06 00 00 00       	mov    $0x6,%eax
+     634:	89 e1                	mov    %esp,%ecx
+     636:	ba 3d 06 00 00       	mov    $0x63d,%edx
+     63b:	0f 34                	sysenter
+     63d:	c3                   	ret
+
+0000063e <sysexec>:
+SYSCALLAS(sysexec, exec)
+     63e:	b8 07 00 00 00       	mov    $0x7,%eax
+     643:	89 e1                	mov    %esp,%ecx
+     645:	ba 4c 06 00 00       	mov    $0x64c,%edx
+     64a:	0f 34                	sysenter
+     64c:	c3                   	ret
+
+0000064d <open>:
+SYSCALL(open)
+     64d:	b8 0f 00 00 00       	mov    $0xf,%eax
+     652:	89 e1                	mov    %esp,%ecx
+     654:	ba 5b 06 00 00       	mov    $0x65b,%edx
+     659:	0f 34                	sysenter
+     65b:	c3                   	ret
+
+0000065c <mknod>:
+SYSCALL(mknod)
+     65c:	b8 11 00 00 00       	mov    $0x11,%eax
+     661:	89 e1                	mov    %esp,%ecx
+     663:	ba 6a 06 00 00       	mov    $0x66a,%edx
+     668:	0f 34                	sysenter
+     66a:	c3                   	ret
+
+0000066b <unlink>:
+SYSCALL(unlink)
+     66b:	b8 12 00 00 00       	mov    $0x12,%eax
+     670:	89 e1                	mov    %esp,%ecx
+     672:	ba 79 06 00 00       	mov    $0x679,%edx
+     677:	0f 34                	sysenter
+     679:	c3                   	ret
+
+0000067a <fstat>:
+SYSCALL(fstat)
+     67a:	b8 08 00 00 00       	mov    $0x8,%eax
+     67f:	89 e1                	mov    %esp,%ecx
+     681:	ba 88 06 00 00       	mov    $0x688,%edx
+     686:	0f 34                	sysenter
+     688:	c3                   	ret
+
+00000689 <link>:
+SYSCALL(link)
+     689:	b8 13 00 00 00       	mov    $0x13,%eax
+     68e:	89 e1                	mov    %esp,%ecx
+     690:	ba 97 06 00 00       	mov    $0x697,%edx
+     695:	0f 34                	sysenter
+     697:	c3                   	ret
+
+00000698 <mkdir>:
+SYSCALL(mkdir)
+     698:	b8 14 00 00 00       	mov    $0x14,%eax
+     69d:	89 e1                	mov    %esp,%ecx
+     69f:	ba a6 06 00 00       	mov    $0x6a6,%edx
+     6a4:	0f 34                	sysenter
+     6a6:	c3                   	ret
+
+000006a7 <chdir>:
+SYSCALL(chdir)
+     6a7:	b8 09 00 00 00       	mov    $0x9,%eax
+     6ac:	89 e1                	mov    %esp,%ecx
+     6ae:	ba b5 06 00 00       	mov    $0x6b5,%edx
+     6b3:	0f 34                	sysenter
+     6b5:	c3                   	ret
+
+000006b6 <dup>:
+SYSCALL(dup)
+     6b6:	b8 0a 00 00 00       	mov    $0xa,%eax
+     6bb:	89 e1                	mov    %esp,%ecx
+     6bd:	ba c4 06 00 00       	mov    $0x6c4,%edx
+     6c2:	0f 34                	sysenter
+     6c4:	c3                   	ret
+
+000006c5 <getpid>:
+SYSCALL(getpid)
+     6c5:	b8 0b 00 00 00       	mov    $0xb,%eax
+     6ca:	89 e1                	mov    %esp,%ecx
+     6cc:	ba d3 06 00 00       	mov    $0x6d3,%edx
+     6d1:	0f 34                	sysenter
+     6d3:	c3                   	ret
+
+000006d4 <sbrk>:
+SYSCALL(sbrk)
+     6d4:	b8 0c 00 00 00       	mov    $0xc,%eax
+     6d9:	89 e1                	mov    %esp,%ecx
+     6db:	ba e2 06 00 00       	mov    $0x6e2,%edx
+     6e0:	0f 34                	sysenter
+     6e2:	c3                   	ret
+
+000006e3 <sleep>:
+SYSCALL(sleep)
+     6e3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     6e8:	89 e1                	mov    %esp,%ecx
+     6ea:	ba f1 06 00 00       	mov    $0x6f1,%edx
+     6ef:	0f 34                	sysenter
+     6f1:	c3                   	ret
+
+000006f2 <clone>:
+SYSCALL(clone)
+     6f2:	b8 16 00 00 00       	mov    $0x16,%eax
+     6f7:	89 e1                	mov    %esp,%ecx
+     6f9:	ba 00 07 00 00       	mov    $0x700,%edx
+     6fe:	0f 34                	sysenter
+     700:	c3                   	ret
+
+00000701 <join>:
+SYSCALL(join)
+     701:	b8 17 00 00 00       	mov    $0x17,%eax
+     706:	89 e1                	mov    %esp,%ecx
+     708:	ba 0f 07 00 00       	mov    $0x70f,%edx
+     70d:	0f 34                	sysenter
+     70f:	c3                   	ret
+
+00000710 <futex>:
+SYSCALL(futex)
+     710:	b8 18 00 00 00       	mov    $0x18,%eax
+     715:	89 e1                	mov    %esp,%ecx
+     717:	ba 1e 07 00 00       	mov    $0x71e,%edx
+     71c:	0f 34                	sysenter
+     71e:	c3                   	ret
+
+0000071f <yield>:
+SYSCALL(yield)
+     71f:	b8 19 00 00 00       	mov    $0x19,%eax
+     724:	89 e1                	mov    %esp,%ecx
+     726:	ba 2d 07 00 00       	mov    $0x72d,%edx
+     72b:	0f 34                	sysenter
+     72d:	c3                   	ret
+
+0000072e <lockstat>:
+SYSCALL(lockstat)
+     72e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     733:	89 e1                	mov    %esp,%ecx
+     735:	ba 3c 07 00 00       	mov    $0x73c,%edx
+     73a:	0f 34                	sysenter
+     73c:	c3                   	ret
+
+0000073d <lockhammer>:
+SYSCALL(lockhammer)
+     73d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     742:	89 e1                	mov    %esp,%ecx
+     744:	ba 4b 07 00 00       	mov    $0x74b,%edx
+     749:	0f 34                	sysenter
+     74b:	c3                   	ret
+
+0000074c <vmsplice>:
+SYSCALL(vmsplice)
+     74c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     751:	89 e1                	mov    %esp,%ecx
+     753:	ba 5a 07 00 00       	mov    $0x75a,%edx
+     758:	0f 34                	sysenter
+     75a:	c3                   	ret
+
+0000075b <hsbrk>:
+SYSCALL(hsbrk)
+     75b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     760:	89 e1                	mov    %esp,%ecx
+     762:	ba 69 07 00 00       	mov    $0x769,%edx
+     767:	0f 34                	sysenter
+     769:	c3                   	ret
+
+0000076a <mmap>:
+SYSCALL(mmap)
+     76a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     76f:	89 e1                	mov    %esp,%ecx
+     771:	ba 78 07 00 00       	mov    $0x778,%edx
+     776:	0f 34                	sysenter
+     778:	c3                   	ret
+
+00000779 <munmap>:
+SYSCALL(munmap)
+     779:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     77e:	89 e1                	mov    %esp,%ecx
+     780:	ba 87 07 00 00       	mov    $0x787,%edx
+     785:	0f 34                	sysenter
+     787:	c3                   	ret
+
+00000788 <ringenter>:
+SYSCALL(ringenter)
+     788:	b8 20 00 00 00       	mov    $0x20,%eax
+     78d:	89 e1                	mov    %esp,%ecx
+     78f:	ba 96 07 00 00       	mov    $0x796,%edx
+     794:	0f 34                	sysenter
+     796:	c3                   	ret
+
+00000797 <readv>:
+SYSCALL(readv)
+     797:	b8 21 00 00 00       	mov    $0x21,%eax
+     79c:	89 e1                	mov    %esp,%ecx
+     79e:	ba a5 07 00 00       	mov    $0x7a5,%edx
+     7a3:	0f 34                	sysenter
+     7a5:	c3                   	ret
+
+000007a6 <writev>:
+SYSCALL(writev)
+     7a6:	b8 22 00 00 00       	mov    $0x22,%eax
+     7ab:	89 e1                	mov    %esp,%ecx
+     7ad:	ba b4 07 00 00       	mov    $0x7b4,%edx
+     7b2:	0f 34                	sysenter
+     7b4:	c3                   	ret
+
+000007b5 <pread>:
+SYSCALL(pread)
+     7b5:	b8 23 00 00 00       	mov    $0x23,%eax
+     7ba:	89 e1                	mov    %esp,%ecx
+     7bc:	ba c3 07 00 00       	mov    $0x7c3,%edx
+     7c1:	0f 34                	sysenter
+     7c3:	c3                   	ret
+
+000007c4 <pwrite>:
+SYSCALL(pwrite)
+     7c4:	b8 24 00 00 00       	mov    $0x24,%eax
+     7c9:	89 e1                	mov    %esp,%ecx
+     7cb:	ba d2 07 00 00       	mov    $0x7d2,%edx
+     7d0:	0f 34                	sysenter
+     7d2:	c3                   	ret
+
+000007d3 <prof>:
+SYSCALL(prof)
+     7d3:	b8 25 00 00 00       	mov    $0x25,%eax
+     7d8:	89 e1                	mov    %esp,%ecx
+     7da:	ba e1 07 00 00       	mov    $0x7e1,%edx
+     7df:	0f 34                	sysenter
+     7e1:	c3                   	ret
+
+000007e2 <scstat>:
+SYSCALL(scstat)
+     7e2:	b8 26 00 00 00       	mov    $0x26,%eax
+     7e7:	89 e1                	mov    %esp,%ecx
+     7e9:	ba f0 07 00 00       	mov    $0x7f0,%edx
+     7ee:	0f 34                	sysenter
+     7f0:	c3                   	ret
+     7f1:	66 90                	xchg   %ax,%ax
+     7f3:	66 90                	xchg   %ax,%ax
+     7f5:	66 90                	xchg   %ax,%ax
+     7f7:	66 90                	xchg   %ax,%ax
+     7f9:	66 90                	xchg   %ax,%ax
+     7fb:	66 90                	xchg   %ax,%ax
+     7fd:	66 90                	xchg   %ax,%ax
+     7ff:	90                   	nop
+
+00000800 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+     800:	55                   	push   %ebp
+     801:	89 e5                	mov    %esp,%ebp
+     803:	57                   	push   %edi
+     804:	56                   	push   %esi
+     805:	53                   	push   %ebx
+     806:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     808:	89 d1                	mov    %edx,%ecx
+{
+     80a:	83 ec 2c             	sub    $0x2c,%esp
+     80d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+     810:	85 d2                	test   %edx,%edx
+     812:	79 7c                	jns    890 <printint+0x90>
+     814:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     818:	74 76                	je     890 <printint+0x90>
+    x = -xx;
+     81a:	f7 d9                	neg    %ecx
+    neg = 1;
+     81c:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     821:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     824:	31 f6                	xor    %esi,%esi
+     826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     82d:	8d 76 00             	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     830:	89 c8                	mov    %ecx,%eax
+     832:	31 d2                	xor    %edx,%edx
+     834:	89 f7                	mov    %esi,%edi
+     836:	f7 f3                	div    %ebx
+     838:	8d 76 01             	lea    0x1(%esi),%esi
+     83b:	0f b6 92 b4 1f 00 00 	movzbl 0x1fb4(%edx),%edx
+     842:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     846:	89 ca                	mov    %ecx,%edx
+     848:	89 c1                	mov    %eax,%ecx
+     84a:	39 da                	cmp    %ebx,%edx
+     84c:	73 e2                	jae    830 <printint+0x30>
+  if(neg)
+     84e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     851:	85 c0                	test   %eax,%eax
+     853:	74 07                	je     85c <printint+0x5c>
+    buf[i++] = '-';
+     855:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     85a:	89 f7                	mov    %esi,%edi
+     85c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     85f:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     862:	01 df                	add    %ebx,%edi
+     864:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc_unlocked(buf[i], f);
+     868:	83 ec 08             	sub    $0x8,%esp
+     86b:	56                   	push   %esi
+     86c:	0f be 07             	movsbl (%edi),%eax
+     86f:	50                   	push   %eax
+     870:	e8 cb 07 00 00       	call   1040 <putc_unlocked>
+  while(--i >= 0)
+     875:	89 f8                	mov    %edi,%eax
+     877:	83 c4 10             	add    $0x10,%esp
+     87a:	83 ef 01             	sub    $0x1,%edi
+     87d:	39 d8                	cmp    %ebx,%eax
+     87f:	75 e7                	jne    868 <printint+0x68>
+}
+     881:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     884:	5b                   	pop    %ebx
+     885:	5e                   	pop    %esi
+     886:	5f                   	pop    %edi
+     887:	5d                   	pop    %ebp
+     888:	c3                   	ret
+     889:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     890:	31 c0                	xor    %eax,%eax
+     892:	eb 8d                	jmp    821 <printint+0x21>
+     894:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     89b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     89f:	90                   	nop
+
+000008a0 <vfprintf>:
+
+// Print to the given stream, which the caller has locked.
+// Only understands %d, %x, %p, %s.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+     8a0:	55                   	push   %ebp
+     8a1:	89 e5                	mov    %esp,%ebp
+     8a3:	57                   	push   %edi
+     8a4:	56                   	push   %esi
+     8a5:	53                   	push   %ebx
+     8a6:	83 ec 1c             	sub    $0x1c,%esp
+     8a9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     8ac:	0f b6 0a             	movzbl (%edx),%ecx
+     8af:	84 c9                	test   %cl,%cl
+     8b1:	74 5c                	je     90f <vfprintf+0x6f>
+     8b3:	89 c6                	mov    %eax,%esi
+     8b5:	8d 5a 01             	lea    0x1(%edx),%ebx
+     8b8:	31 ff                	xor    %edi,%edi
+     8ba:	eb 20                	jmp    8dc <vfprintf+0x3c>
+     8bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     8c0:	83 f9 25             	cmp    $0x25,%ecx
+     8c3:	74 3b                	je     900 <vfprintf+0x60>
+        state = '%';
+      } else {
+        putc_unlocked(c, f);
+     8c5:	83 ec 08             	sub    $0x8,%esp
+     8c8:	56                   	push   %esi
+     8c9:	51                   	push   %ecx
+     8ca:	e8 71 07 00 00       	call   1040 <putc_unlocked>
+     8cf:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     8d2:	0f b6 0b             	movzbl (%ebx),%ecx
+     8d5:	83 c3 01             	add    $0x1,%ebx
+     8d8:	84 c9                	test   %cl,%cl
+     8da:	74 33                	je     90f <vfprintf+0x6f>
+    if(state == 0){
+     8dc:	85 ff                	test   %edi,%edi
+     8de:	74 e0                	je     8c0 <vfprintf+0x20>
+      }
+    } else if(state == '%'){
+     8e0:	83 ff 25             	cmp    $0x25,%edi
+     8e3:	75 ed                	jne    8d2 <vfprintf+0x32>
+      if(c == 'd'){
+     8e5:	83 f9 25             	cmp    $0x25,%ecx
+     8e8:	0f 84 02 01 00 00    	je     9f0 <vfprintf+0x150>
+     8ee:	8d 41 9d             	lea    -0x63(%ecx),%eax
+     8f1:	83 f8 15             	cmp    $0x15,%eax
+     8f4:	77 2a                	ja     920 <vfprintf+0x80>
+     8f6:	ff 24 85 5c 1f 00 00 	jmp    *0x1f5c(,%eax,4)
+     8fd:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     900:	0f b6 0b             	movzbl (%ebx),%ecx
+     903:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     906:	bf 25 00 00 00       	mov    $0x25,%edi
+  for(i = 0; fmt[i]; i++){
+     90b:	84 c9                	test   %cl,%cl
+     90d:	75 cd                	jne    8dc <vfprintf+0x3c>
+        putc_unlocked(c, f);
+      }
+      state = 0;
+    }
+  }
+}
+     90f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     912:	5b                   	pop    %ebx
+     913:	5e                   	pop    %esi
+     914:	5f                   	pop    %edi
+     915:	5d                   	pop    %ebp
+     916:	c3                   	ret
+     917:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     91e:	66 90                	xchg   %ax,%ax
+        putc_unlocked('%', f);
+     920:	83 ec 08             	sub    $0x8,%esp
+     923:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     926:	56                   	push   %esi
+     927:	6a 25                	push   $0x25
+     929:	e8 12 07 00 00       	call   1040 <putc_unlocked>
+        putc_unlocked(c, f);
+     92e:	58                   	pop    %eax
+     92f:	5a                   	pop    %edx
+     930:	56                   	push   %esi
+     931:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     934:	51                   	push   %ecx
+     935:	e8 06 07 00 00       	call   1040 <putc_unlocked>
+     93a:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     93d:	31 ff                	xor    %edi,%edi
+     93f:	eb 91                	jmp    8d2 <vfprintf+0x32>
+     941:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+     948:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     94b:	83 ec 0c             	sub    $0xc,%esp
+     94e:	b9 10 00 00 00       	mov    $0x10,%ecx
+     953:	8b 17                	mov    (%edi),%edx
+     955:	6a 00                	push   $0x0
+        ap++;
+     957:	83 c7 04             	add    $0x4,%edi
+        printint(f, *ap, 16, 0);
+     95a:	89 f0                	mov    %esi,%eax
+     95c:	e8 9f fe ff ff       	call   800 <printint>
+        ap++;
+     961:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     964:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     967:	31 ff                	xor    %edi,%edi
+     969:	e9 64 ff ff ff       	jmp    8d2 <vfprintf+0x32>
+     96e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     970:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     973:	8b 10                	mov    (%eax),%edx
+        ap++;
+     975:	83 c0 04             	add    $0x4,%eax
+     978:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     97b:	85 d2                	test   %edx,%edx
+     97d:	0f 84 85 00 00 00    	je     a08 <vfprintf+0x168>
+        while(*s != 0){
+     983:	0f be 02             	movsbl (%edx),%eax
+        s = (char*)*ap;
+     986:	89 d7                	mov    %edx,%edi
+        while(*s != 0){
+     988:	84 c0                	test   %al,%al
+     98a:	74 b1                	je     93d <vfprintf+0x9d>
+     98c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+          putc_unlocked(*s, f);
+     990:	83 ec 08             	sub    $0x8,%esp
+          s++;
+     993:	83 c7 01             	add    $0x1,%edi
+          putc_unlocked(*s, f);
+     996:	56                   	push   %esi
+     997:	50                   	push   %eax
+     998:	e8 a3 06 00 00       	call   1040 <putc_unlocked>
+        while(*s != 0){
+     99d:	0f be 07             	movsbl (%edi),%eax
+     9a0:	83 c4 10             	add    $0x10,%esp
+     9a3:	84 c0                	test   %al,%al
+     9a5:	75 e9                	jne    990 <vfprintf+0xf0>
+      state = 0;
+     9a7:	31 ff                	xor    %edi,%edi
+     9a9:	e9 24 ff ff ff       	jmp    8d2 <vfprintf+0x32>
+     9ae:	66 90                	xchg   %ax,%ax
+        printint(f, *ap, 10, 1);
+     9b0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     9b3:	83 ec 0c             	sub    $0xc,%esp
+     9b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     9bb:	8b 17                	mov    (%edi),%edx
+     9bd:	6a 01                	push   $0x1
+     9bf:	eb 96                	jmp    957 <vfprintf+0xb7>
+     9c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc_unlocked(*ap, f);
+     9c8:	83 ec 08             	sub    $0x8,%esp
+     9cb:	56                   	push   %esi
+     9cc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     9cf:	ff 37                	push   (%edi)
+     9d1:	e8 6a 06 00 00       	call   1040 <putc_unlocked>
+        ap++;
+     9d6:	89 f8                	mov    %edi,%eax
+     9d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     9db:	31 ff                	xor    %edi,%edi
+        ap++;
+     9dd:	83 c0 04             	add    $0x4,%eax
+     9e0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     9e3:	e9 ea fe ff ff       	jmp    8d2 <vfprintf+0x32>
+     9e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9ef:	90                   	nop
+        putc_unlocked(c, f);
+     9f0:	83 ec 08             	sub    $0x8,%esp
+      state = 0;
+     9f3:	31 ff                	xor    %edi,%edi
+        putc_unlocked(c, f);
+     9f5:	56                   	push   %esi
+     9f6:	6a 25                	push   $0x25
+     9f8:	e8 43 06 00 00       	call   1040 <putc_unlocked>
+     9fd:	83 c4 10             	add    $0x10,%esp
+     a00:	e9 cd fe ff ff       	jmp    8d2 <vfprintf+0x32>
+     a05:	8d 76 00             	lea    0x0(%esi),%esi
+     a08:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     a0d:	bf 54 1f 00 00       	mov    $0x1f54,%edi
+     a12:	e9 79 ff ff ff       	jmp    990 <vfprintf+0xf0>
+     a17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a1e:	66 90                	xchg   %ax,%ax
+
+00000a20 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+     a20:	55                   	push   %ebp
+     a21:	89 e5                	mov    %esp,%ebp
+     a23:	53                   	push   %ebx
+     a24:	83 ec 10             	sub    $0x10,%esp
+     a27:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  flockfile(f);
+     a2a:	53                   	push   %ebx
+     a2b:	e8 d0 02 00 00       	call   d00 <flockfile>
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     a30:	8b 55 0c             	mov    0xc(%ebp),%edx
+     a33:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     a36:	89 d8                	mov    %ebx,%eax
+     a38:	e8 63 fe ff ff       	call   8a0 <vfprintf>
+  funlockfile(f);
+     a3d:	89 1c 24             	mov    %ebx,(%esp)
+     a40:	e8 eb 02 00 00       	call   d30 <funlockfile>
+}
+     a45:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a48:	83 c4 10             	add    $0x10,%esp
+     a4b:	c9                   	leave
+     a4c:	c3                   	ret
+     a4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a50 <printf>:
+
+// Print to the given fd: through stdout or stderr for 1 and 2,
+// otherwise with one write() per call.
+void
+printf(int fd, const char *fmt, ...)
+{
+     a50:	55                   	push   %ebp
+     a51:	89 e5                	mov    %esp,%ebp
+     a53:	56                   	push   %esi
+     a54:	53                   	push   %ebx
+     a55:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+     a5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  char buf[128];
+  struct iobuf f;
+
+  if(fd == 1 || fd == 2){
+    flockfile(&_iob[fd]);
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     a5e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(fd == 1 || fd == 2){
+     a61:	8d 50 ff             	lea    -0x1(%eax),%edx
+     a64:	83 fa 01             	cmp    $0x1,%edx
+     a67:	76 77                	jbe    ae0 <printf+0x90>
+    funlockfile(&_iob[fd]);
+    return;
+  }
+  f.fd = fd;
+     a69:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  f.flags = IO_WRITE|IO_SETUP;
+  f.buf = buf;
+     a6f:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  f.size = sizeof(buf);
+  f.r = f.n = 0;
+  mutex_init(&f.lock);
+     a75:	83 ec 0c             	sub    $0xc,%esp
+     a78:	8d 9d 5c ff ff ff    	lea    -0xa4(%ebp),%ebx
+  f.buf = buf;
+     a7e:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+  mutex_init(&f.lock);
+     a84:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  f.flags = IO_WRITE|IO_SETUP;
+     a8a:	c7 85 60 ff ff ff 42 	movl   $0x42,-0xa0(%ebp)
+     a91:	00 00 00 
+  f.size = sizeof(buf);
+     a94:	c7 85 68 ff ff ff 80 	movl   $0x80,-0x98(%ebp)
+     a9b:	00 00 00 
+  f.r = f.n = 0;
+     a9e:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+     aa5:	00 00 00 
+     aa8:	c7 85 6c ff ff ff 00 	movl   $0x0,-0x94(%ebp)
+     aaf:	00 00 00 
+  mutex_init(&f.lock);
+     ab2:	50                   	push   %eax
+     ab3:	e8 d8 f9 ff ff       	call   490 <mutex_init>
+  vfprintf(&f, fmt, (uint*)(void*)&fmt + 1);
+     ab8:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     abb:	89 f2                	mov    %esi,%edx
+     abd:	89 d8                	mov    %ebx,%eax
+     abf:	e8 dc fd ff ff       	call   8a0 <vfprintf>
+  fflush(&f);
+     ac4:	89 1c 24             	mov    %ebx,(%esp)
+     ac7:	e8 f4 04 00 00       	call   fc0 <fflush>
+     acc:	83 c4 10             	add    $0x10,%esp
+}
+     acf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ad2:	5b                   	pop    %ebx
+     ad3:	5e                   	pop    %esi
+     ad4:	5d                   	pop    %ebp
+     ad5:	c3                   	ret
+     ad6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     add:	8d 76 00             	lea    0x0(%esi),%esi
+    flockfile(&_iob[fd]);
+     ae0:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     ae3:	83 ec 0c             	sub    $0xc,%esp
+     ae6:	8d 98 c0 29 00 00    	lea    0x29c0(%eax),%ebx
+     aec:	53                   	push   %ebx
+     aed:	e8 0e 02 00 00       	call   d00 <flockfile>
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     af2:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     af5:	89 f2                	mov    %esi,%edx
+     af7:	89 d8                	mov    %ebx,%eax
+     af9:	e8 a2 fd ff ff       	call   8a0 <vfprintf>
+    funlockfile(&_iob[fd]);
+     afe:	89 1c 24             	mov    %ebx,(%esp)
+     b01:	e8 2a 02 00 00       	call   d30 <funlockfile>
+     b06:	83 c4 10             	add    $0x10,%esp
+}
+     b09:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b0c:	5b                   	pop    %ebx
+     b0d:	5e                   	pop    %esi
+     b0e:	5d                   	pop    %ebp
+     b0f:	c3                   	ret
+
+00000b10 <setup>:
+}
+
+// Choose how to buffer f on first use: by lines on a device.
+static void
+setup(FILE *f)
+{
+     b10:	55                   	push   %ebp
+     b11:	89 e5                	mov    %esp,%ebp
+     b13:	53                   	push   %ebx
+     b14:	89 c3                	mov    %eax,%ebx
+     b16:	83 ec 2c             	sub    $0x2c,%esp
+  struct stat st;
+
+  f->flags |= IO_SETUP;
+     b19:	83 48 04 40          	orl    $0x40,0x4(%eax)
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     b1d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     b20:	50                   	push   %eax
+     b21:	ff 33                	push   (%ebx)
+     b23:	e8 52 fb ff ff       	call   67a <fstat>
+     b28:	83 c4 10             	add    $0x10,%esp
+     b2b:	85 c0                	test   %eax,%eax
+    f->flags |= IO_DEV|IO_LINE;
+     b2d:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     b30:	75 07                	jne    b39 <setup+0x29>
+     b32:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+     b37:	74 17                	je     b50 <setup+0x40>
+  if(f->flags & IO_WRITE)
+     b39:	a8 02                	test   $0x2,%al
+     b3b:	74 0a                	je     b47 <setup+0x37>
+    flushhook = flushall;
+     b3d:	c7 05 a0 2c 00 00 70 	movl   $0xc70,0x2ca0
+     b44:	0c 00 00 
+}
+     b47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b4a:	c9                   	leave
+     b4b:	c3                   	ret
+     b4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    f->flags |= IO_DEV|IO_LINE;
+     b50:	83 c8 30             	or     $0x30,%eax
+     b53:	89 43 04             	mov    %eax,0x4(%ebx)
+     b56:	eb e1                	jmp    b39 <setup+0x29>
+     b58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b5f:	90                   	nop
+
+00000b60 <flush>:
+static int
+flush(FILE *f)
+{
+  int i, n;
+
+  if(!(f->flags & IO_WRITE))
+     b60:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+     b64:	74 6a                	je     bd0 <flush+0x70>
+{
+     b66:	55                   	push   %ebp
+     b67:	89 e5                	mov    %esp,%ebp
+     b69:	56                   	push   %esi
+     b6a:	89 c6                	mov    %eax,%esi
+     b6c:	53                   	push   %ebx
+    return 0;
+  for(i = 0; i < f->n; i += n){
+     b6d:	8b 40 14             	mov    0x14(%eax),%eax
+     b70:	85 c0                	test   %eax,%eax
+     b72:	7e 4c                	jle    bc0 <flush+0x60>
+     b74:	31 db                	xor    %ebx,%ebx
+     b76:	eb 11                	jmp    b89 <flush+0x29>
+     b78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b7f:	90                   	nop
+     b80:	01 c3                	add    %eax,%ebx
+     b82:	8b 46 14             	mov    0x14(%esi),%eax
+     b85:	39 d8                	cmp    %ebx,%eax
+     b87:	7e 37                	jle    bc0 <flush+0x60>
+    if((n = write(f->fd, f->buf + i, f->n - i)) <= 0){
+     b89:	83 ec 04             	sub    $0x4,%esp
+     b8c:	29 d8                	sub    %ebx,%eax
+     b8e:	50                   	push   %eax
+     b8f:	8b 46 08             	mov    0x8(%esi),%eax
+     b92:	01 d8                	add    %ebx,%eax
+     b94:	50                   	push   %eax
+     b95:	ff 36                	push   (%esi)
+     b97:	e8 75 fa ff ff       	call   611 <write>
+     b9c:	83 c4 10             	add    $0x10,%esp
+     b9f:	85 c0                	test   %eax,%eax
+     ba1:	7f dd                	jg     b80 <flush+0x20>
+      f->flags |= IO_ERR;
+     ba3:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+      f->n = 0;
+     ba7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     bac:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+      return EOF;
+    }
+  }
+  f->n = 0;
+  return 0;
+}
+     bb3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     bb6:	5b                   	pop    %ebx
+     bb7:	5e                   	pop    %esi
+     bb8:	5d                   	pop    %ebp
+     bb9:	c3                   	ret
+     bba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->n = 0;
+     bc0:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+}
+     bc7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+     bca:	31 c0                	xor    %eax,%eax
+}
+     bcc:	5b                   	pop    %ebx
+     bcd:	5e                   	pop    %esi
+     bce:	5d                   	pop    %ebp
+     bcf:	c3                   	ret
+    return 0;
+     bd0:	31 c0                	xor    %eax,%eax
+}
+     bd2:	c3                   	ret
+     bd3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000be0 <fflush.part.0>:
+fflush(FILE *f)
+     be0:	55                   	push   %ebp
+     be1:	89 e5                	mov    %esp,%ebp
+     be3:	57                   	push   %edi
+     be4:	bf b8 2a 00 00       	mov    $0x2ab8,%edi
+     be9:	56                   	push   %esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     bea:	31 f6                	xor    %esi,%esi
+fflush(FILE *f)
+     bec:	53                   	push   %ebx
+     bed:	bb d8 29 00 00       	mov    $0x29d8,%ebx
+     bf2:	83 ec 1c             	sub    $0x1c,%esp
+     bf5:	eb 10                	jmp    c07 <fflush.part.0+0x27>
+     bf7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bfe:	66 90                	xchg   %ax,%ax
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     c00:	83 c3 1c             	add    $0x1c,%ebx
+     c03:	39 df                	cmp    %ebx,%edi
+     c05:	74 33                	je     c3a <fflush.part.0+0x5a>
+      if((f->flags & IO_WRITE) && fflush(f) < 0)
+     c07:	f6 43 ec 02          	testb  $0x2,-0x14(%ebx)
+     c0b:	74 f3                	je     c00 <fflush.part.0+0x20>
+  if(threaded)
+     c0d:	8b 0d c0 2c 00 00    	mov    0x2cc0,%ecx
+     c13:	85 c9                	test   %ecx,%ecx
+     c15:	75 49                	jne    c60 <fflush.part.0+0x80>
+  r = flush(f);
+     c17:	8d 43 e8             	lea    -0x18(%ebx),%eax
+     c1a:	e8 41 ff ff ff       	call   b60 <flush>
+  if(threaded)
+     c1f:	8b 15 c0 2c 00 00    	mov    0x2cc0,%edx
+     c25:	85 d2                	test   %edx,%edx
+     c27:	75 1f                	jne    c48 <fflush.part.0+0x68>
+        r = EOF;
+     c29:	85 c0                	test   %eax,%eax
+     c2b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     c30:	0f 48 f0             	cmovs  %eax,%esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     c33:	83 c3 1c             	add    $0x1c,%ebx
+     c36:	39 df                	cmp    %ebx,%edi
+     c38:	75 cd                	jne    c07 <fflush.part.0+0x27>
+}
+     c3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c3d:	89 f0                	mov    %esi,%eax
+     c3f:	5b                   	pop    %ebx
+     c40:	5e                   	pop    %esi
+     c41:	5f                   	pop    %edi
+     c42:	5d                   	pop    %ebp
+     c43:	c3                   	ret
+     c44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     c48:	83 ec 0c             	sub    $0xc,%esp
+     c4b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     c4e:	53                   	push   %ebx
+     c4f:	e8 9c f8 ff ff       	call   4f0 <mutex_unlock>
+     c54:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c57:	83 c4 10             	add    $0x10,%esp
+     c5a:	eb cd                	jmp    c29 <fflush.part.0+0x49>
+     c5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     c60:	83 ec 0c             	sub    $0xc,%esp
+     c63:	53                   	push   %ebx
+     c64:	e8 37 f8 ff ff       	call   4a0 <mutex_lock>
+     c69:	83 c4 10             	add    $0x10,%esp
+     c6c:	eb a9                	jmp    c17 <fflush.part.0+0x37>
+     c6e:	66 90                	xchg   %ax,%ax
+
+00000c70 <flushall>:
+  if(f == 0){
+     c70:	e9 6b ff ff ff       	jmp    be0 <fflush.part.0>
+     c75:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c80 <fill>:
+
+// Refill f's buffer. Returns the number of bytes read.
+// Caller holds f's lock.
+static int
+fill(FILE *f)
+{
+     c80:	55                   	push   %ebp
+     c81:	89 e5                	mov    %esp,%ebp
+     c83:	53                   	push   %ebx
+     c84:	89 c3                	mov    %eax,%ebx
+     c86:	83 ec 04             	sub    $0x4,%esp
+  int n;
+
+  if(!(f->flags & IO_SETUP))
+     c89:	8b 40 04             	mov    0x4(%eax),%eax
+     c8c:	a8 40                	test   $0x40,%al
+     c8e:	74 50                	je     ce0 <fill+0x60>
+    setup(f);
+  if(f->flags & IO_DEV)
+     c90:	a8 20                	test   $0x20,%al
+     c92:	75 3c                	jne    cd0 <fill+0x50>
+    fflush(0);
+  f->r = 0;
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     c94:	83 ec 04             	sub    $0x4,%esp
+  f->r = 0;
+     c97:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     c9e:	ff 73 0c             	push   0xc(%ebx)
+     ca1:	ff 73 08             	push   0x8(%ebx)
+     ca4:	ff 33                	push   (%ebx)
+     ca6:	e8 57 f9 ff ff       	call   602 <read>
+     cab:	83 c4 10             	add    $0x10,%esp
+     cae:	85 c0                	test   %eax,%eax
+     cb0:	7f 10                	jg     cc2 <fill+0x42>
+    f->flags |= n < 0 ? IO_ERR : IO_EOF;
+     cb2:	83 f8 01             	cmp    $0x1,%eax
+     cb5:	19 c0                	sbb    %eax,%eax
+     cb7:	83 e0 fc             	and    $0xfffffffc,%eax
+     cba:	83 c0 08             	add    $0x8,%eax
+     cbd:	09 43 04             	or     %eax,0x4(%ebx)
+    n = 0;
+     cc0:	31 c0                	xor    %eax,%eax
+  }
+  f->n = n;
+     cc2:	89 43 14             	mov    %eax,0x14(%ebx)
+  return n;
+}
+     cc5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     cc8:	c9                   	leave
+     cc9:	c3                   	ret
+     cca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == 0){
+     cd0:	e8 0b ff ff ff       	call   be0 <fflush.part.0>
+     cd5:	eb bd                	jmp    c94 <fill+0x14>
+     cd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cde:	66 90                	xchg   %ax,%ax
+    setup(f);
+     ce0:	89 d8                	mov    %ebx,%eax
+     ce2:	e8 29 fe ff ff       	call   b10 <setup>
+  if(f->flags & IO_DEV)
+     ce7:	8b 43 04             	mov    0x4(%ebx),%eax
+     cea:	eb a4                	jmp    c90 <fill+0x10>
+     cec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000cf0 <stdio_threaded>:
+  threaded = 1;
+     cf0:	c7 05 c0 2c 00 00 01 	movl   $0x1,0x2cc0
+     cf7:	00 00 00 
+}
+     cfa:	c3                   	ret
+     cfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cff:	90                   	nop
+
+00000d00 <flockfile>:
+{
+     d00:	55                   	push   %ebp
+  if(threaded)
+     d01:	8b 15 c0 2c 00 00    	mov    0x2cc0,%edx
+{
+     d07:	89 e5                	mov    %esp,%ebp
+     d09:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     d0c:	85 d2                	test   %edx,%edx
+     d0e:	75 08                	jne    d18 <flockfile+0x18>
+}
+     d10:	5d                   	pop    %ebp
+     d11:	c3                   	ret
+     d12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_lock(&f->lock);
+     d18:	83 c0 18             	add    $0x18,%eax
+     d1b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     d1e:	5d                   	pop    %ebp
+    mutex_lock(&f->lock);
+     d1f:	e9 7c f7 ff ff       	jmp    4a0 <mutex_lock>
+     d24:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d2f:	90                   	nop
+
+00000d30 <funlockfile>:
+{
+     d30:	55                   	push   %ebp
+  if(threaded)
+     d31:	8b 15 c0 2c 00 00    	mov    0x2cc0,%edx
+{
+     d37:	89 e5                	mov    %esp,%ebp
+     d39:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     d3c:	85 d2                	test   %edx,%edx
+     d3e:	75 08                	jne    d48 <funlockfile+0x18>
+}
+     d40:	5d                   	pop    %ebp
+     d41:	c3                   	ret
+     d42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&f->lock);
+     d48:	83 c0 18             	add    $0x18,%eax
+     d4b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     d4e:	5d                   	pop    %ebp
+    mutex_unlock(&f->lock);
+     d4f:	e9 9c f7 ff ff       	jmp    4f0 <mutex_unlock>
+     d54:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d5f:	90                   	nop
+
+00000d60 <fopen>:
+{
+     d60:	55                   	push   %ebp
+     d61:	89 e5                	mov    %esp,%ebp
+     d63:	57                   	push   %edi
+     d64:	56                   	push   %esi
+     d65:	53                   	push   %ebx
+     d66:	83 ec 34             	sub    $0x34,%esp
+     d69:	8b 75 0c             	mov    0xc(%ebp),%esi
+     d6c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(strcmp(mode, "r") != 0 && strcmp(mode, "w") != 0)
+     d6f:	68 c5 1f 00 00       	push   $0x1fc5
+     d74:	56                   	push   %esi
+     d75:	e8 66 f5 ff ff       	call   2e0 <strcmp>
+     d7a:	83 c4 10             	add    $0x10,%esp
+     d7d:	85 c0                	test   %eax,%eax
+     d7f:	74 15                	je     d96 <fopen+0x36>
+     d81:	83 ec 08             	sub    $0x8,%esp
+     d84:	68 c7 1f 00 00       	push   $0x1fc7
+     d89:	56                   	push   %esi
+     d8a:	e8 51 f5 ff ff       	call   2e0 <strcmp>
+     d8f:	83 c4 10             	add    $0x10,%esp
+     d92:	85 c0                	test   %eax,%eax
+     d94:	75 2c                	jne    dc2 <fopen+0x62>
+  if(threaded)
+     d96:	a1 c0 2c 00 00       	mov    0x2cc0,%eax
+     d9b:	85 c0                	test   %eax,%eax
+     d9d:	0f 85 ed 00 00 00    	jne    e90 <fopen+0x130>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     da3:	bb 14 2a 00 00       	mov    $0x2a14,%ebx
+    if(f->flags == 0)
+     da8:	8b 53 04             	mov    0x4(%ebx),%edx
+     dab:	85 d2                	test   %edx,%edx
+     dad:	74 21                	je     dd0 <fopen+0x70>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     daf:	83 c3 1c             	add    $0x1c,%ebx
+     db2:	81 fb a0 2a 00 00    	cmp    $0x2aa0,%ebx
+     db8:	75 ee                	jne    da8 <fopen+0x48>
+  if(threaded)
+     dba:	85 c0                	test   %eax,%eax
+     dbc:	0f 85 36 01 00 00    	jne    ef8 <fopen+0x198>
+    return 0;
+     dc2:	31 db                	xor    %ebx,%ebx
+     dc4:	e9 96 00 00 00       	jmp    e5f <fopen+0xff>
+     dc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f == &_iob[NSTREAM])
+     dd0:	81 fb a0 2a 00 00    	cmp    $0x2aa0,%ebx
+     dd6:	74 e2                	je     dba <fopen+0x5a>
+    f->flags = IO_MALLOC;
+     dd8:	c7 43 04 80 00 00 00 	movl   $0x80,0x4(%ebx)
+  if(threaded)
+     ddf:	85 c0                	test   %eax,%eax
+     de1:	0f 85 f9 00 00 00    	jne    ee0 <fopen+0x180>
+  if(mode[0] == 'r'){
+     de7:	80 3e 72             	cmpb   $0x72,(%esi)
+     dea:	0f 84 c0 00 00 00    	je     eb0 <fopen+0x150>
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     df0:	83 ec 08             	sub    $0x8,%esp
+     df3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     df6:	50                   	push   %eax
+     df7:	57                   	push   %edi
+     df8:	e8 d3 f5 ff ff       	call   3d0 <stat>
+     dfd:	83 c4 10             	add    $0x10,%esp
+     e00:	85 c0                	test   %eax,%eax
+     e02:	74 6c                	je     e70 <fopen+0x110>
+    fd = open(path, O_CREATE|O_WRONLY);
+     e04:	83 ec 08             	sub    $0x8,%esp
+     e07:	68 01 02 00 00       	push   $0x201
+     e0c:	57                   	push   %edi
+    flags = IO_WRITE;
+     e0d:	bf 02 00 00 00       	mov    $0x2,%edi
+    fd = open(path, O_CREATE|O_WRONLY);
+     e12:	e8 36 f8 ff ff       	call   64d <open>
+     e17:	83 c4 10             	add    $0x10,%esp
+     e1a:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     e1c:	85 f6                	test   %esi,%esi
+     e1e:	0f 88 a9 00 00 00    	js     ecd <fopen+0x16d>
+     e24:	83 ec 0c             	sub    $0xc,%esp
+     e27:	68 00 02 00 00       	push   $0x200
+     e2c:	e8 af 0c 00 00       	call   1ae0 <malloc>
+     e31:	83 c4 10             	add    $0x10,%esp
+     e34:	89 43 08             	mov    %eax,0x8(%ebx)
+     e37:	85 c0                	test   %eax,%eax
+     e39:	0f 84 d0 00 00 00    	je     f0f <fopen+0x1af>
+  f->flags = flags|IO_MALLOC;
+     e3f:	81 cf 80 00 00 00    	or     $0x80,%edi
+  f->fd = fd;
+     e45:	89 33                	mov    %esi,(%ebx)
+  f->size = BUFSIZ;
+     e47:	c7 43 0c 00 02 00 00 	movl   $0x200,0xc(%ebx)
+  f->r = f->n = 0;
+     e4e:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+     e55:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  f->flags = flags|IO_MALLOC;
+     e5c:	89 7b 04             	mov    %edi,0x4(%ebx)
+}
+     e5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e62:	89 d8                	mov    %ebx,%eax
+     e64:	5b                   	pop    %ebx
+     e65:	5e                   	pop    %esi
+     e66:	5f                   	pop    %edi
+     e67:	5d                   	pop    %ebp
+     e68:	c3                   	ret
+     e69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     e70:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+     e75:	75 8d                	jne    e04 <fopen+0xa4>
+      unlink(path);
+     e77:	83 ec 0c             	sub    $0xc,%esp
+     e7a:	57                   	push   %edi
+     e7b:	e8 eb f7 ff ff       	call   66b <unlink>
+     e80:	83 c4 10             	add    $0x10,%esp
+     e83:	e9 7c ff ff ff       	jmp    e04 <fopen+0xa4>
+     e88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e8f:	90                   	nop
+    mutex_lock(&iolock);
+     e90:	83 ec 0c             	sub    $0xc,%esp
+     e93:	68 c4 2c 00 00       	push   $0x2cc4
+     e98:	e8 03 f6 ff ff       	call   4a0 <mutex_lock>
+  if(threaded)
+     e9d:	a1 c0 2c 00 00       	mov    0x2cc0,%eax
+     ea2:	83 c4 10             	add    $0x10,%esp
+     ea5:	e9 f9 fe ff ff       	jmp    da3 <fopen+0x43>
+     eaa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    fd = open(path, O_RDONLY);
+     eb0:	83 ec 08             	sub    $0x8,%esp
+     eb3:	6a 00                	push   $0x0
+     eb5:	57                   	push   %edi
+    flags = IO_READ;
+     eb6:	bf 01 00 00 00       	mov    $0x1,%edi
+    fd = open(path, O_RDONLY);
+     ebb:	e8 8d f7 ff ff       	call   64d <open>
+     ec0:	83 c4 10             	add    $0x10,%esp
+     ec3:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     ec5:	85 f6                	test   %esi,%esi
+     ec7:	0f 89 57 ff ff ff    	jns    e24 <fopen+0xc4>
+    f->flags = 0;
+     ecd:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    return 0;
+     ed4:	31 db                	xor    %ebx,%ebx
+     ed6:	eb 87                	jmp    e5f <fopen+0xff>
+     ed8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     edf:	90                   	nop
+    mutex_unlock(&iolock);
+     ee0:	83 ec 0c             	sub    $0xc,%esp
+     ee3:	68 c4 2c 00 00       	push   $0x2cc4
+     ee8:	e8 03 f6 ff ff       	call   4f0 <mutex_unlock>
+     eed:	83 c4 10             	add    $0x10,%esp
+     ef0:	e9 f2 fe ff ff       	jmp    de7 <fopen+0x87>
+     ef5:	8d 76 00             	lea    0x0(%esi),%esi
+     ef8:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+     efb:	31 db                	xor    %ebx,%ebx
+    mutex_unlock(&iolock);
+     efd:	68 c4 2c 00 00       	push   $0x2cc4
+     f02:	e8 e9 f5 ff ff       	call   4f0 <mutex_unlock>
+     f07:	83 c4 10             	add    $0x10,%esp
+     f0a:	e9 50 ff ff ff       	jmp    e5f <fopen+0xff>
+      close(fd);
+     f0f:	83 ec 0c             	sub    $0xc,%esp
+     f12:	56                   	push   %esi
+     f13:	e8 08 f7 ff ff       	call   620 <close>
+     f18:	83 c4 10             	add    $0x10,%esp
+     f1b:	eb b0                	jmp    ecd <fopen+0x16d>
+     f1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f20 <fclose>:
+{
+     f20:	55                   	push   %ebp
+     f21:	89 e5                	mov    %esp,%ebp
+     f23:	56                   	push   %esi
+     f24:	53                   	push   %ebx
+  if(threaded)
+     f25:	8b 15 c0 2c 00 00    	mov    0x2cc0,%edx
+{
+     f2b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+     f2e:	85 d2                	test   %edx,%edx
+     f30:	75 46                	jne    f78 <fclose+0x58>
+  r = flush(f);
+     f32:	89 d8                	mov    %ebx,%eax
+     f34:	e8 27 fc ff ff       	call   b60 <flush>
+  if(close(f->fd) < 0)
+     f39:	83 ec 0c             	sub    $0xc,%esp
+     f3c:	ff 33                	push   (%ebx)
+  r = flush(f);
+     f3e:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+     f40:	e8 db f6 ff ff       	call   620 <close>
+     f45:	83 c4 10             	add    $0x10,%esp
+    r = EOF;
+     f48:	85 c0                	test   %eax,%eax
+     f4a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     f4f:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->flags & IO_MALLOC)
+     f52:	f6 43 04 80          	testb  $0x80,0x4(%ebx)
+     f56:	75 58                	jne    fb0 <fclose+0x90>
+  if(threaded)
+     f58:	a1 c0 2c 00 00       	mov    0x2cc0,%eax
+  f->flags = 0;
+     f5d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  if(threaded)
+     f64:	85 c0                	test   %eax,%eax
+     f66:	75 28                	jne    f90 <fclose+0x70>
+}
+     f68:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f6b:	89 f0                	mov    %esi,%eax
+     f6d:	5b                   	pop    %ebx
+     f6e:	5e                   	pop    %esi
+     f6f:	5d                   	pop    %ebp
+     f70:	c3                   	ret
+     f71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     f78:	83 ec 0c             	sub    $0xc,%esp
+     f7b:	8d 43 18             	lea    0x18(%ebx),%eax
+     f7e:	50                   	push   %eax
+     f7f:	e8 1c f5 ff ff       	call   4a0 <mutex_lock>
+     f84:	83 c4 10             	add    $0x10,%esp
+     f87:	eb a9                	jmp    f32 <fclose+0x12>
+     f89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     f90:	83 ec 0c             	sub    $0xc,%esp
+     f93:	83 c3 18             	add    $0x18,%ebx
+     f96:	53                   	push   %ebx
+     f97:	e8 54 f5 ff ff       	call   4f0 <mutex_unlock>
+     f9c:	83 c4 10             	add    $0x10,%esp
+}
+     f9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     fa2:	89 f0                	mov    %esi,%eax
+     fa4:	5b                   	pop    %ebx
+     fa5:	5e                   	pop    %esi
+     fa6:	5d                   	pop    %ebp
+     fa7:	c3                   	ret
+     fa8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     faf:	90                   	nop
+    free(f->buf);
+     fb0:	83 ec 0c             	sub    $0xc,%esp
+     fb3:	ff 73 08             	push   0x8(%ebx)
+     fb6:	e8 f5 09 00 00       	call   19b0 <free>
+     fbb:	83 c4 10             	add    $0x10,%esp
+     fbe:	eb 98                	jmp    f58 <fclose+0x38>
+
+00000fc0 <fflush>:
+{
+     fc0:	55                   	push   %ebp
+     fc1:	89 e5                	mov    %esp,%ebp
+     fc3:	53                   	push   %ebx
+     fc4:	83 ec 14             	sub    $0x14,%esp
+     fc7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f == 0){
+     fca:	85 db                	test   %ebx,%ebx
+     fcc:	74 5a                	je     1028 <fflush+0x68>
+  if(threaded)
+     fce:	8b 0d c0 2c 00 00    	mov    0x2cc0,%ecx
+     fd4:	85 c9                	test   %ecx,%ecx
+     fd6:	75 18                	jne    ff0 <fflush+0x30>
+  r = flush(f);
+     fd8:	89 d8                	mov    %ebx,%eax
+     fda:	e8 81 fb ff ff       	call   b60 <flush>
+  if(threaded)
+     fdf:	8b 15 c0 2c 00 00    	mov    0x2cc0,%edx
+     fe5:	85 d2                	test   %edx,%edx
+     fe7:	75 1f                	jne    1008 <fflush+0x48>
+}
+     fe9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     fec:	c9                   	leave
+     fed:	c3                   	ret
+     fee:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+     ff0:	83 ec 0c             	sub    $0xc,%esp
+     ff3:	8d 43 18             	lea    0x18(%ebx),%eax
+     ff6:	50                   	push   %eax
+     ff7:	e8 a4 f4 ff ff       	call   4a0 <mutex_lock>
+     ffc:	83 c4 10             	add    $0x10,%esp
+     fff:	eb d7                	jmp    fd8 <fflush+0x18>
+    1001:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1008:	83 ec 0c             	sub    $0xc,%esp
+    100b:	83 c3 18             	add    $0x18,%ebx
+    100e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1011:	53                   	push   %ebx
+    1012:	e8 d9 f4 ff ff       	call   4f0 <mutex_unlock>
+    1017:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    101a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    mutex_unlock(&f->lock);
+    101d:	83 c4 10             	add    $0x10,%esp
+}
+    1020:	c9                   	leave
+    1021:	c3                   	ret
+    1022:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1028:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    102b:	c9                   	leave
+    102c:	e9 af fb ff ff       	jmp    be0 <fflush.part.0>
+    1031:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1038:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    103f:	90                   	nop
+
+00001040 <putc_unlocked>:
+{
+    1040:	55                   	push   %ebp
+    1041:	89 e5                	mov    %esp,%ebp
+    1043:	56                   	push   %esi
+    1044:	53                   	push   %ebx
+    1045:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    1048:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(!(f->flags & IO_WRITE))
+    104b:	8b 43 04             	mov    0x4(%ebx),%eax
+    104e:	a8 02                	test   $0x2,%al
+    1050:	74 46                	je     1098 <putc_unlocked+0x58>
+  if(!(f->flags & IO_SETUP))
+    1052:	a8 40                	test   $0x40,%al
+    1054:	74 4a                	je     10a0 <putc_unlocked+0x60>
+  if(f->n == f->size && flush(f) < 0)
+    1056:	8b 43 14             	mov    0x14(%ebx),%eax
+    1059:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    105c:	74 51                	je     10af <putc_unlocked+0x6f>
+  f->buf[f->n++] = c;
+    105e:	8d 48 01             	lea    0x1(%eax),%ecx
+    1061:	8b 53 08             	mov    0x8(%ebx),%edx
+    1064:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    1067:	89 f1                	mov    %esi,%ecx
+    1069:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    106c:	83 fe 0a             	cmp    $0xa,%esi
+    106f:	74 0f                	je     1080 <putc_unlocked+0x40>
+  return c & 0xff;
+    1071:	89 f0                	mov    %esi,%eax
+    1073:	0f b6 c0             	movzbl %al,%eax
+}
+    1076:	5b                   	pop    %ebx
+    1077:	5e                   	pop    %esi
+    1078:	5d                   	pop    %ebp
+    1079:	c3                   	ret
+    107a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    1080:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1084:	74 eb                	je     1071 <putc_unlocked+0x31>
+    1086:	89 d8                	mov    %ebx,%eax
+    1088:	e8 d3 fa ff ff       	call   b60 <flush>
+    108d:	85 c0                	test   %eax,%eax
+    108f:	79 e0                	jns    1071 <putc_unlocked+0x31>
+    1091:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return EOF;
+    1098:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    109d:	eb d7                	jmp    1076 <putc_unlocked+0x36>
+    109f:	90                   	nop
+    setup(f);
+    10a0:	89 d8                	mov    %ebx,%eax
+    10a2:	e8 69 fa ff ff       	call   b10 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    10a7:	8b 43 14             	mov    0x14(%ebx),%eax
+    10aa:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    10ad:	75 af                	jne    105e <putc_unlocked+0x1e>
+    10af:	89 d8                	mov    %ebx,%eax
+    10b1:	e8 aa fa ff ff       	call   b60 <flush>
+    10b6:	85 c0                	test   %eax,%eax
+    10b8:	78 de                	js     1098 <putc_unlocked+0x58>
+  f->buf[f->n++] = c;
+    10ba:	8b 43 14             	mov    0x14(%ebx),%eax
+    10bd:	eb 9f                	jmp    105e <putc_unlocked+0x1e>
+    10bf:	90                   	nop
+
+000010c0 <fputc>:
+{
+    10c0:	55                   	push   %ebp
+    10c1:	89 e5                	mov    %esp,%ebp
+    10c3:	56                   	push   %esi
+    10c4:	53                   	push   %ebx
+  if(threaded)
+    10c5:	8b 15 c0 2c 00 00    	mov    0x2cc0,%edx
+{
+    10cb:	8b 75 08             	mov    0x8(%ebp),%esi
+    10ce:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(threaded)
+    10d1:	85 d2                	test   %edx,%edx
+    10d3:	75 6b                	jne    1140 <fputc+0x80>
+  if(!(f->flags & IO_WRITE))
+    10d5:	8b 43 04             	mov    0x4(%ebx),%eax
+    10d8:	a8 02                	test   $0x2,%al
+    10da:	0f 84 b8 00 00 00    	je     1198 <fputc+0xd8>
+  if(!(f->flags & IO_SETUP))
+    10e0:	a8 40                	test   $0x40,%al
+    10e2:	74 76                	je     115a <fputc+0x9a>
+  if(f->n == f->size && flush(f) < 0)
+    10e4:	8b 43 14             	mov    0x14(%ebx),%eax
+    10e7:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    10ea:	74 7d                	je     1169 <fputc+0xa9>
+  f->buf[f->n++] = c;
+    10ec:	8d 48 01             	lea    0x1(%eax),%ecx
+    10ef:	8b 53 08             	mov    0x8(%ebx),%edx
+    10f2:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    10f5:	89 f1                	mov    %esi,%ecx
+    10f7:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    10fa:	83 fe 0a             	cmp    $0xa,%esi
+    10fd:	74 21                	je     1120 <fputc+0x60>
+  return c & 0xff;
+    10ff:	89 f0                	mov    %esi,%eax
+    1101:	0f b6 f0             	movzbl %al,%esi
+  if(threaded)
+    1104:	a1 c0 2c 00 00       	mov    0x2cc0,%eax
+    1109:	85 c0                	test   %eax,%eax
+    110b:	75 73                	jne    1180 <fputc+0xc0>
+}
+    110d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1110:	89 f0                	mov    %esi,%eax
+    1112:	5b                   	pop    %ebx
+    1113:	5e                   	pop    %esi
+    1114:	5d                   	pop    %ebp
+    1115:	c3                   	ret
+    1116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    111d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    1120:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1124:	74 d9                	je     10ff <fputc+0x3f>
+    1126:	89 d8                	mov    %ebx,%eax
+    1128:	e8 33 fa ff ff       	call   b60 <flush>
+    112d:	85 c0                	test   %eax,%eax
+    112f:	79 ce                	jns    10ff <fputc+0x3f>
+    return EOF;
+    1131:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1136:	eb cc                	jmp    1104 <fputc+0x44>
+    1138:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    113f:	90                   	nop
+    mutex_lock(&f->lock);
+    1140:	83 ec 0c             	sub    $0xc,%esp
+    1143:	8d 43 18             	lea    0x18(%ebx),%eax
+    1146:	50                   	push   %eax
+    1147:	e8 54 f3 ff ff       	call   4a0 <mutex_lock>
+  if(!(f->flags & IO_WRITE))
+    114c:	8b 43 04             	mov    0x4(%ebx),%eax
+    114f:	83 c4 10             	add    $0x10,%esp
+    1152:	a8 02                	test   $0x2,%al
+    1154:	74 db                	je     1131 <fputc+0x71>
+  if(!(f->flags & IO_SETUP))
+    1156:	a8 40                	test   $0x40,%al
+    1158:	75 8a                	jne    10e4 <fputc+0x24>
+    setup(f);
+    115a:	89 d8                	mov    %ebx,%eax
+    115c:	e8 af f9 ff ff       	call   b10 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    1161:	8b 43 14             	mov    0x14(%ebx),%eax
+    1164:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    1167:	75 83                	jne    10ec <fputc+0x2c>
+    1169:	89 d8                	mov    %ebx,%eax
+    116b:	e8 f0 f9 ff ff       	call   b60 <flush>
+    1170:	85 c0                	test   %eax,%eax
+    1172:	78 bd                	js     1131 <fputc+0x71>
+  f->buf[f->n++] = c;
+    1174:	8b 43 14             	mov    0x14(%ebx),%eax
+    1177:	e9 70 ff ff ff       	jmp    10ec <fputc+0x2c>
+    117c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1180:	83 ec 0c             	sub    $0xc,%esp
+    1183:	83 c3 18             	add    $0x18,%ebx
+    1186:	53                   	push   %ebx
+    1187:	e8 64 f3 ff ff       	call   4f0 <mutex_unlock>
+    118c:	83 c4 10             	add    $0x10,%esp
+}
+    118f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1192:	89 f0                	mov    %esi,%eax
+    1194:	5b                   	pop    %ebx
+    1195:	5e                   	pop    %esi
+    1196:	5d                   	pop    %ebp
+    1197:	c3                   	ret
+    return EOF;
+    1198:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    119d:	e9 6b ff ff ff       	jmp    110d <fputc+0x4d>
+    11a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000011b0 <fwrite>:
+{
+    11b0:	55                   	push   %ebp
+    11b1:	89 e5                	mov    %esp,%ebp
+    11b3:	57                   	push   %edi
+    11b4:	56                   	push   %esi
+    11b5:	53                   	push   %ebx
+    11b6:	83 ec 1c             	sub    $0x1c,%esp
+    11b9:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  if(!(f->flags & IO_WRITE) || size <= 0)
+    11bc:	8b 43 04             	mov    0x4(%ebx),%eax
+    11bf:	a8 02                	test   $0x2,%al
+    11c1:	0f 84 ec 00 00 00    	je     12b3 <fwrite+0x103>
+    11c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    11ca:	85 c9                	test   %ecx,%ecx
+    11cc:	0f 8e e1 00 00 00    	jle    12b3 <fwrite+0x103>
+  if(threaded)
+    11d2:	8b 15 c0 2c 00 00    	mov    0x2cc0,%edx
+    11d8:	85 d2                	test   %edx,%edx
+    11da:	0f 85 1c 01 00 00    	jne    12fc <fwrite+0x14c>
+  if(!(f->flags & IO_SETUP))
+    11e0:	a8 40                	test   $0x40,%al
+    11e2:	0f 84 08 01 00 00    	je     12f0 <fwrite+0x140>
+  for(len = size*nmemb; len > 0; len -= n){
+    11e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11eb:	0f af 45 10          	imul   0x10(%ebp),%eax
+    11ef:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    11f2:	85 c0                	test   %eax,%eax
+    11f4:	0f 8e 2a 01 00 00    	jle    1324 <fwrite+0x174>
+  s = p;
+    11fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  nl = 0;
+    11fd:	31 ff                	xor    %edi,%edi
+    11ff:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+        nl = 1;
+    1202:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  s = p;
+    1205:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1208:	8b 43 14             	mov    0x14(%ebx),%eax
+        nl = 1;
+    120b:	89 ce                	mov    %ecx,%esi
+    if(f->n == f->size && flush(f) < 0)
+    120d:	89 c2                	mov    %eax,%edx
+    120f:	39 f0                	cmp    %esi,%eax
+    1211:	74 6e                	je     1281 <fwrite+0xd1>
+    1213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1217:	90                   	nop
+    if(n > len)
+    1218:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    n = f->size - f->n;
+    121b:	89 f1                	mov    %esi,%ecx
+    121d:	29 c1                	sub    %eax,%ecx
+    121f:	39 f9                	cmp    %edi,%ecx
+    1221:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1224:	85 c9                	test   %ecx,%ecx
+    1226:	0f 8e 7c 00 00 00    	jle    12a8 <fwrite+0xf8>
+    122c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    122f:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1232:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    1235:	8d 34 08             	lea    (%eax,%ecx,1),%esi
+    1238:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    123b:	eb 06                	jmp    1243 <fwrite+0x93>
+    123d:	8d 76 00             	lea    0x0(%esi),%esi
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1240:	8b 53 14             	mov    0x14(%ebx),%edx
+    1243:	8d 4a 01             	lea    0x1(%edx),%ecx
+    1246:	8b 73 08             	mov    0x8(%ebx),%esi
+    1249:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    124c:	0f b6 08             	movzbl (%eax),%ecx
+        nl = 1;
+    124f:	80 f9 0a             	cmp    $0xa,%cl
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1252:	88 0c 16             	mov    %cl,(%esi,%edx,1)
+        nl = 1;
+    1255:	be 01 00 00 00       	mov    $0x1,%esi
+    125a:	0f 44 fe             	cmove  %esi,%edi
+    for(i = 0; i < n; i++)
+    125d:	83 c0 01             	add    $0x1,%eax
+    1260:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    1263:	75 db                	jne    1240 <fwrite+0x90>
+    s += n;
+    1265:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1268:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    126b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    s += n;
+    126e:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    1271:	85 c0                	test   %eax,%eax
+    1273:	7e 48                	jle    12bd <fwrite+0x10d>
+    1275:	8b 43 14             	mov    0x14(%ebx),%eax
+    1278:	8b 73 0c             	mov    0xc(%ebx),%esi
+    if(f->n == f->size && flush(f) < 0)
+    127b:	89 c2                	mov    %eax,%edx
+    127d:	39 f0                	cmp    %esi,%eax
+    127f:	75 97                	jne    1218 <fwrite+0x68>
+    1281:	89 d8                	mov    %ebx,%eax
+    1283:	e8 d8 f8 ff ff       	call   b60 <flush>
+    1288:	85 c0                	test   %eax,%eax
+    128a:	78 31                	js     12bd <fwrite+0x10d>
+    n = f->size - f->n;
+    128c:	8b 73 0c             	mov    0xc(%ebx),%esi
+    128f:	8b 43 14             	mov    0x14(%ebx),%eax
+    1292:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    1295:	89 f1                	mov    %esi,%ecx
+    1297:	89 c2                	mov    %eax,%edx
+    1299:	29 c1                	sub    %eax,%ecx
+    129b:	39 f9                	cmp    %edi,%ecx
+    129d:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    12a0:	85 c9                	test   %ecx,%ecx
+    12a2:	7f 88                	jg     122c <fwrite+0x7c>
+    12a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    s += n;
+    12a8:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    12ab:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    12ae:	e9 5a ff ff ff       	jmp    120d <fwrite+0x5d>
+}
+    12b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    12b6:	31 c0                	xor    %eax,%eax
+}
+    12b8:	5b                   	pop    %ebx
+    12b9:	5e                   	pop    %esi
+    12ba:	5f                   	pop    %edi
+    12bb:	5d                   	pop    %ebp
+    12bc:	c3                   	ret
+  if(nl && (f->flags & IO_LINE))
+    12bd:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    12c0:	85 ff                	test   %edi,%edi
+    12c2:	74 06                	je     12ca <fwrite+0x11a>
+    12c4:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    12c8:	75 1d                	jne    12e7 <fwrite+0x137>
+  return (s - (const char*)p) / size;
+    12ca:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    12cd:	2b 75 08             	sub    0x8(%ebp),%esi
+  if(threaded)
+    12d0:	a1 c0 2c 00 00       	mov    0x2cc0,%eax
+    12d5:	85 c0                	test   %eax,%eax
+    12d7:	75 3a                	jne    1313 <fwrite+0x163>
+  return (s - (const char*)p) / size;
+    12d9:	89 f0                	mov    %esi,%eax
+    12db:	99                   	cltd
+    12dc:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    12df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12e2:	5b                   	pop    %ebx
+    12e3:	5e                   	pop    %esi
+    12e4:	5f                   	pop    %edi
+    12e5:	5d                   	pop    %ebp
+    12e6:	c3                   	ret
+    flush(f);
+    12e7:	89 d8                	mov    %ebx,%eax
+    12e9:	e8 72 f8 ff ff       	call   b60 <flush>
+    12ee:	eb da                	jmp    12ca <fwrite+0x11a>
+    setup(f);
+    12f0:	89 d8                	mov    %ebx,%eax
+    12f2:	e8 19 f8 ff ff       	call   b10 <setup>
+    12f7:	e9 ec fe ff ff       	jmp    11e8 <fwrite+0x38>
+    mutex_lock(&f->lock);
+    12fc:	83 ec 0c             	sub    $0xc,%esp
+    12ff:	8d 43 18             	lea    0x18(%ebx),%eax
+    1302:	50                   	push   %eax
+    1303:	e8 98 f1 ff ff       	call   4a0 <mutex_lock>
+  if(!(f->flags & IO_SETUP))
+    1308:	8b 43 04             	mov    0x4(%ebx),%eax
+    130b:	83 c4 10             	add    $0x10,%esp
+    130e:	e9 cd fe ff ff       	jmp    11e0 <fwrite+0x30>
+    mutex_unlock(&f->lock);
+    1313:	83 ec 0c             	sub    $0xc,%esp
+    1316:	83 c3 18             	add    $0x18,%ebx
+    1319:	53                   	push   %ebx
+    131a:	e8 d1 f1 ff ff       	call   4f0 <mutex_unlock>
+    131f:	83 c4 10             	add    $0x10,%esp
+    1322:	eb b5                	jmp    12d9 <fwrite+0x129>
+  for(len = size*nmemb; len > 0; len -= n){
+    1324:	31 f6                	xor    %esi,%esi
+    1326:	eb a8                	jmp    12d0 <fwrite+0x120>
+    1328:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    132f:	90                   	nop
+
+00001330 <fgetc>:
+  return f->buf[f->r++] & 0xff;
+}
+
+int
+fgetc(FILE *f)
+{
+    1330:	55                   	push   %ebp
+    1331:	89 e5                	mov    %esp,%ebp
+    1333:	56                   	push   %esi
+    1334:	53                   	push   %ebx
+  if(threaded)
+    1335:	8b 15 c0 2c 00 00    	mov    0x2cc0,%edx
+{
+    133b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    133e:	85 d2                	test   %edx,%edx
+    1340:	75 2e                	jne    1370 <fgetc+0x40>
+  if(!(f->flags & IO_READ))
+    1342:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1346:	74 78                	je     13c0 <fgetc+0x90>
+  if(f->r == f->n && fill(f) == 0)
+    1348:	8b 43 10             	mov    0x10(%ebx),%eax
+    134b:	3b 43 14             	cmp    0x14(%ebx),%eax
+    134e:	74 60                	je     13b0 <fgetc+0x80>
+  return f->buf[f->r++] & 0xff;
+    1350:	8b 53 08             	mov    0x8(%ebx),%edx
+    1353:	8d 48 01             	lea    0x1(%eax),%ecx
+    1356:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1359:	0f b6 34 02          	movzbl (%edx,%eax,1),%esi
+  if(threaded)
+    135d:	a1 c0 2c 00 00       	mov    0x2cc0,%eax
+    1362:	85 c0                	test   %eax,%eax
+    1364:	75 2a                	jne    1390 <fgetc+0x60>
+
+  flockfile(f);
+  c = getc_unlocked(f);
+  funlockfile(f);
+  return c;
+}
+    1366:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1369:	89 f0                	mov    %esi,%eax
+    136b:	5b                   	pop    %ebx
+    136c:	5e                   	pop    %esi
+    136d:	5d                   	pop    %ebp
+    136e:	c3                   	ret
+    136f:	90                   	nop
+    mutex_lock(&f->lock);
+    1370:	83 ec 0c             	sub    $0xc,%esp
+    1373:	8d 43 18             	lea    0x18(%ebx),%eax
+    1376:	50                   	push   %eax
+    1377:	e8 24 f1 ff ff       	call   4a0 <mutex_lock>
+  if(!(f->flags & IO_READ))
+    137c:	83 c4 10             	add    $0x10,%esp
+    137f:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1383:	75 c3                	jne    1348 <fgetc+0x18>
+    return EOF;
+    1385:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    138a:	eb d1                	jmp    135d <fgetc+0x2d>
+    138c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1390:	83 ec 0c             	sub    $0xc,%esp
+    1393:	83 c3 18             	add    $0x18,%ebx
+    1396:	53                   	push   %ebx
+    1397:	e8 54 f1 ff ff       	call   4f0 <mutex_unlock>
+    139c:	83 c4 10             	add    $0x10,%esp
+}
+    139f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    13a2:	89 f0                	mov    %esi,%eax
+    13a4:	5b                   	pop    %ebx
+    13a5:	5e                   	pop    %esi
+    13a6:	5d                   	pop    %ebp
+    13a7:	c3                   	ret
+    13a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13af:	90                   	nop
+  if(f->r == f->n && fill(f) == 0)
+    13b0:	89 d8                	mov    %ebx,%eax
+    13b2:	e8 c9 f8 ff ff       	call   c80 <fill>
+    13b7:	85 c0                	test   %eax,%eax
+    13b9:	74 ca                	je     1385 <fgetc+0x55>
+  return f->buf[f->r++] & 0xff;
+    13bb:	8b 43 10             	mov    0x10(%ebx),%eax
+    13be:	eb 90                	jmp    1350 <fgetc+0x20>
+    return EOF;
+    13c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    13c5:	eb 9f                	jmp    1366 <fgetc+0x36>
+    13c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13ce:	66 90                	xchg   %ax,%ax
+
+000013d0 <fread>:
+
+int
+fread(void *p, int size, int nmemb, FILE *f)
+{
+    13d0:	55                   	push   %ebp
+    13d1:	89 e5                	mov    %esp,%ebp
+    13d3:	57                   	push   %edi
+    13d4:	56                   	push   %esi
+    13d5:	53                   	push   %ebx
+    13d6:	83 ec 1c             	sub    $0x1c,%esp
+    13d9:	8b 75 14             	mov    0x14(%ebp),%esi
+  char *d;
+  int n, len;
+
+  if(!(f->flags & IO_READ) || size <= 0)
+    13dc:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+    13e0:	74 7e                	je     1460 <fread+0x90>
+    13e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+    13e5:	85 d2                	test   %edx,%edx
+    13e7:	7e 77                	jle    1460 <fread+0x90>
+  if(threaded)
+    13e9:	a1 c0 2c 00 00       	mov    0x2cc0,%eax
+    return 0;
+  flockfile(f);
+  d = p;
+  for(len = size*nmemb; len > 0; len -= n){
+    13ee:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    13f1:	0f af 7d 10          	imul   0x10(%ebp),%edi
+  if(threaded)
+    13f5:	85 c0                	test   %eax,%eax
+    13f7:	0f 85 93 00 00 00    	jne    1490 <fread+0xc0>
+  for(len = size*nmemb; len > 0; len -= n){
+    13fd:	85 ff                	test   %edi,%edi
+    13ff:	7e 61                	jle    1462 <fread+0x92>
+    if(f->r == f->n && fill(f) == 0)
+    1401:	8b 46 10             	mov    0x10(%esi),%eax
+  d = p;
+    1404:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1407:	eb 35                	jmp    143e <fread+0x6e>
+    1409:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      break;
+    n = f->n - f->r;
+    1410:	29 c3                	sub    %eax,%ebx
+    1412:	39 fb                	cmp    %edi,%ebx
+    1414:	0f 4f df             	cmovg  %edi,%ebx
+    if(n > len)
+      n = len;
+    memmove(d, f->buf + f->r, n);
+    1417:	83 ec 04             	sub    $0x4,%esp
+    141a:	53                   	push   %ebx
+    141b:	03 46 08             	add    0x8(%esi),%eax
+  for(len = size*nmemb; len > 0; len -= n){
+    141e:	29 df                	sub    %ebx,%edi
+    memmove(d, f->buf + f->r, n);
+    1420:	50                   	push   %eax
+    1421:	51                   	push   %ecx
+    1422:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1425:	e8 36 f0 ff ff       	call   460 <memmove>
+    f->r += n;
+    142a:	8b 46 10             	mov    0x10(%esi),%eax
+    d += n;
+    142d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1430:	83 c4 10             	add    $0x10,%esp
+    f->r += n;
+    1433:	01 d8                	add    %ebx,%eax
+    d += n;
+    1435:	01 d9                	add    %ebx,%ecx
+    f->r += n;
+    1437:	89 46 10             	mov    %eax,0x10(%esi)
+  for(len = size*nmemb; len > 0; len -= n){
+    143a:	85 ff                	test   %edi,%edi
+    143c:	7e 32                	jle    1470 <fread+0xa0>
+    if(f->r == f->n && fill(f) == 0)
+    143e:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1441:	39 c3                	cmp    %eax,%ebx
+    1443:	75 cb                	jne    1410 <fread+0x40>
+    1445:	89 f0                	mov    %esi,%eax
+    1447:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    144a:	e8 31 f8 ff ff       	call   c80 <fill>
+    144f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1452:	85 c0                	test   %eax,%eax
+    1454:	74 1a                	je     1470 <fread+0xa0>
+    n = f->n - f->r;
+    1456:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1459:	8b 46 10             	mov    0x10(%esi),%eax
+    145c:	eb b2                	jmp    1410 <fread+0x40>
+    145e:	66 90                	xchg   %ax,%ax
+    return 0;
+    1460:	31 c0                	xor    %eax,%eax
+  }
+  funlockfile(f);
+  return (d - (char*)p) / size;
+}
+    1462:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1465:	5b                   	pop    %ebx
+    1466:	5e                   	pop    %esi
+    1467:	5f                   	pop    %edi
+    1468:	5d                   	pop    %ebp
+    1469:	c3                   	ret
+    146a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (d - (char*)p) / size;
+    1470:	2b 4d 08             	sub    0x8(%ebp),%ecx
+    1473:	89 cb                	mov    %ecx,%ebx
+  if(threaded)
+    1475:	a1 c0 2c 00 00       	mov    0x2cc0,%eax
+    147a:	85 c0                	test   %eax,%eax
+    147c:	75 32                	jne    14b0 <fread+0xe0>
+  return (d - (char*)p) / size;
+    147e:	89 d8                	mov    %ebx,%eax
+    1480:	99                   	cltd
+    1481:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1484:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1487:	5b                   	pop    %ebx
+    1488:	5e                   	pop    %esi
+    1489:	5f                   	pop    %edi
+    148a:	5d                   	pop    %ebp
+    148b:	c3                   	ret
+    148c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    1490:	83 ec 0c             	sub    $0xc,%esp
+    1493:	8d 46 18             	lea    0x18(%esi),%eax
+    1496:	50                   	push   %eax
+    1497:	e8 04 f0 ff ff       	call   4a0 <mutex_lock>
+  for(len = size*nmemb; len > 0; len -= n){
+    149c:	83 c4 10             	add    $0x10,%esp
+    149f:	85 ff                	test   %edi,%edi
+    14a1:	0f 8f 5a ff ff ff    	jg     1401 <fread+0x31>
+    14a7:	31 db                	xor    %ebx,%ebx
+    14a9:	eb ca                	jmp    1475 <fread+0xa5>
+    14ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    14af:	90                   	nop
+    mutex_unlock(&f->lock);
+    14b0:	83 ec 0c             	sub    $0xc,%esp
+    14b3:	83 c6 18             	add    $0x18,%esi
+    14b6:	56                   	push   %esi
+    14b7:	e8 34 f0 ff ff       	call   4f0 <mutex_unlock>
+  return (d - (char*)p) / size;
+    14bc:	89 d8                	mov    %ebx,%eax
+    14be:	83 c4 10             	add    $0x10,%esp
+    14c1:	99                   	cltd
+    14c2:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    14c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    14c8:	5b                   	pop    %ebx
+    14c9:	5e                   	pop    %esi
+    14ca:	5f                   	pop    %edi
+    14cb:	5d                   	pop    %ebp
+    14cc:	c3                   	ret
+    14cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000014d0 <fgets>:
+
+// Read a line of at most max-1 bytes, keeping the newline.
+// Returns 0 if there was nothing left to read.
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    14d0:	55                   	push   %ebp
+    14d1:	89 e5                	mov    %esp,%ebp
+    14d3:	57                   	push   %edi
+    14d4:	56                   	push   %esi
+    14d5:	53                   	push   %ebx
+    14d6:	83 ec 1c             	sub    $0x1c,%esp
+  if(threaded)
+    14d9:	8b 35 c0 2c 00 00    	mov    0x2cc0,%esi
+{
+    14df:	8b 7d 08             	mov    0x8(%ebp),%edi
+    14e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if(threaded)
+    14e5:	85 f6                	test   %esi,%esi
+    14e7:	0f 85 83 00 00 00    	jne    1570 <fgets+0xa0>
+{
+    14ed:	31 f6                	xor    %esi,%esi
+    14ef:	eb 2a                	jmp    151b <fgets+0x4b>
+    14f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return f->buf[f->r++] & 0xff;
+    14f8:	8b 53 08             	mov    0x8(%ebx),%edx
+    14fb:	8d 48 01             	lea    0x1(%eax),%ecx
+    14fe:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1501:	0f b6 14 02          	movzbl (%edx,%eax,1),%edx
+
+  flockfile(f);
+  for(i = 0; i+1 < max; ){
+    if((c = getc_unlocked(f)) == EOF)
+      break;
+    buf[i++] = c;
+    1505:	88 54 37 ff          	mov    %dl,-0x1(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    1509:	80 fa 0a             	cmp    $0xa,%dl
+    150c:	0f 84 96 00 00 00    	je     15a8 <fgets+0xd8>
+    1512:	83 fa 0d             	cmp    $0xd,%edx
+    1515:	0f 84 8d 00 00 00    	je     15a8 <fgets+0xd8>
+  for(i = 0; i+1 < max; ){
+    151b:	89 f2                	mov    %esi,%edx
+    151d:	83 c6 01             	add    $0x1,%esi
+    1520:	3b 75 0c             	cmp    0xc(%ebp),%esi
+    1523:	7d 2b                	jge    1550 <fgets+0x80>
+  if(!(f->flags & IO_READ))
+    1525:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1529:	74 25                	je     1550 <fgets+0x80>
+  if(f->r == f->n && fill(f) == 0)
+    152b:	8b 43 10             	mov    0x10(%ebx),%eax
+    152e:	3b 43 14             	cmp    0x14(%ebx),%eax
+    1531:	75 c5                	jne    14f8 <fgets+0x28>
+    1533:	89 d8                	mov    %ebx,%eax
+    1535:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1538:	e8 43 f7 ff ff       	call   c80 <fill>
+    153d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1540:	85 c0                	test   %eax,%eax
+    1542:	74 0c                	je     1550 <fgets+0x80>
+  return f->buf[f->r++] & 0xff;
+    1544:	8b 43 10             	mov    0x10(%ebx),%eax
+    1547:	eb af                	jmp    14f8 <fgets+0x28>
+    1549:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1550:	8b 0d c0 2c 00 00    	mov    0x2cc0,%ecx
+      break;
+  }
+  buf[i] = '\0';
+    1556:	c6 04 17 00          	movb   $0x0,(%edi,%edx,1)
+  if(threaded)
+    155a:	85 c9                	test   %ecx,%ecx
+    155c:	75 2a                	jne    1588 <fgets+0xb8>
+  funlockfile(f);
+  return i > 0 ? buf : 0;
+    155e:	31 c0                	xor    %eax,%eax
+    1560:	85 d2                	test   %edx,%edx
+    1562:	74 02                	je     1566 <fgets+0x96>
+    1564:	89 f8                	mov    %edi,%eax
+}
+    1566:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1569:	5b                   	pop    %ebx
+    156a:	5e                   	pop    %esi
+    156b:	5f                   	pop    %edi
+    156c:	5d                   	pop    %ebp
+    156d:	c3                   	ret
+    156e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    1570:	83 ec 0c             	sub    $0xc,%esp
+    1573:	8d 43 18             	lea    0x18(%ebx),%eax
+    1576:	50                   	push   %eax
+    1577:	e8 24 ef ff ff       	call   4a0 <mutex_lock>
+    157c:	83 c4 10             	add    $0x10,%esp
+    157f:	e9 69 ff ff ff       	jmp    14ed <fgets+0x1d>
+    1584:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1588:	83 ec 0c             	sub    $0xc,%esp
+    158b:	83 c3 18             	add    $0x18,%ebx
+    158e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1591:	53                   	push   %ebx
+    1592:	e8 59 ef ff ff       	call   4f0 <mutex_unlock>
+    1597:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    159a:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    159d:	31 c0                	xor    %eax,%eax
+    159f:	85 d2                	test   %edx,%edx
+    15a1:	75 c1                	jne    1564 <fgets+0x94>
+    15a3:	eb c1                	jmp    1566 <fgets+0x96>
+    15a5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    15a8:	a1 c0 2c 00 00       	mov    0x2cc0,%eax
+  buf[i] = '\0';
+    15ad:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  if(threaded)
+    15b1:	85 c0                	test   %eax,%eax
+    15b3:	74 af                	je     1564 <fgets+0x94>
+    mutex_unlock(&f->lock);
+    15b5:	83 ec 0c             	sub    $0xc,%esp
+    15b8:	83 c3 18             	add    $0x18,%ebx
+    15bb:	53                   	push   %ebx
+    15bc:	e8 2f ef ff ff       	call   4f0 <mutex_unlock>
+    15c1:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    15c4:	89 f8                	mov    %edi,%eax
+    15c6:	eb 9e                	jmp    1566 <fgets+0x96>
+    15c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15cf:	90                   	nop
+
+000015d0 <gets>:
+// at most a line per read(), goes through stdin's buffer: from a
+// file or pipe, a buffered read could take input meant for a child
+// process, so read a byte at a time.
+char*
+gets(char *buf, int max)
+{
+    15d0:	55                   	push   %ebp
+    15d1:	89 e5                	mov    %esp,%ebp
+    15d3:	57                   	push   %edi
+    15d4:	56                   	push   %esi
+    15d5:	53                   	push   %ebx
+    15d6:	83 ec 2c             	sub    $0x2c,%esp
+  int i, cc;
+  char c;
+
+  if(!(stdin->flags & IO_SETUP))
+    15d9:	8b 15 c4 29 00 00    	mov    0x29c4,%edx
+{
+    15df:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!(stdin->flags & IO_SETUP))
+    15e2:	f6 c2 40             	test   $0x40,%dl
+    15e5:	74 79                	je     1660 <gets+0x90>
+    setup(stdin);
+  if(stdin->flags & IO_DEV){
+    15e7:	83 e2 20             	and    $0x20,%edx
+    15ea:	89 d7                	mov    %edx,%edi
+    15ec:	75 52                	jne    1640 <gets+0x70>
+  if(f == 0){
+    15ee:	e8 ed f5 ff ff       	call   be0 <fflush.part.0>
+    fgets(buf, max, stdin);
+    return buf;
+  }
+  fflush(0);
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    15f3:	8d 75 e7             	lea    -0x19(%ebp),%esi
+  for(i=0; i+1 < max; ){
+    15f6:	eb 2c                	jmp    1624 <gets+0x54>
+    15f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15ff:	90                   	nop
+    cc = read(0, &c, 1);
+    1600:	83 ec 04             	sub    $0x4,%esp
+    1603:	6a 01                	push   $0x1
+    1605:	56                   	push   %esi
+    1606:	6a 00                	push   $0x0
+    1608:	e8 f5 ef ff ff       	call   602 <read>
+    if(cc < 1)
+    160d:	83 c4 10             	add    $0x10,%esp
+    1610:	85 c0                	test   %eax,%eax
+    1612:	7e 1b                	jle    162f <gets+0x5f>
+      break;
+    buf[i++] = c;
+    1614:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1618:	88 44 3b ff          	mov    %al,-0x1(%ebx,%edi,1)
+    if(c == '\n' || c == '\r')
+    161c:	3c 0a                	cmp    $0xa,%al
+    161e:	74 12                	je     1632 <gets+0x62>
+    1620:	3c 0d                	cmp    $0xd,%al
+    1622:	74 0e                	je     1632 <gets+0x62>
+  for(i=0; i+1 < max; ){
+    1624:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    1627:	83 c7 01             	add    $0x1,%edi
+    162a:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+    162d:	7c d1                	jl     1600 <gets+0x30>
+{
+    162f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      break;
+  }
+  buf[i] = '\0';
+    1632:	c6 04 3b 00          	movb   $0x0,(%ebx,%edi,1)
+  return buf;
+}
+    1636:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1639:	89 d8                	mov    %ebx,%eax
+    163b:	5b                   	pop    %ebx
+    163c:	5e                   	pop    %esi
+    163d:	5f                   	pop    %edi
+    163e:	5d                   	pop    %ebp
+    163f:	c3                   	ret
+    fgets(buf, max, stdin);
+    1640:	83 ec 04             	sub    $0x4,%esp
+    1643:	68 c0 29 00 00       	push   $0x29c0
+    1648:	ff 75 0c             	push   0xc(%ebp)
+    164b:	53                   	push   %ebx
+    164c:	e8 7f fe ff ff       	call   14d0 <fgets>
+    return buf;
+    1651:	83 c4 10             	add    $0x10,%esp
+}
+    1654:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1657:	89 d8                	mov    %ebx,%eax
+    1659:	5b                   	pop    %ebx
+    165a:	5e                   	pop    %esi
+    165b:	5f                   	pop    %edi
+    165c:	5d                   	pop    %ebp
+    165d:	c3                   	ret
+    165e:	66 90                	xchg   %ax,%ax
+    setup(stdin);
+    1660:	b8 c0 29 00 00       	mov    $0x29c0,%eax
+    1665:	e8 a6 f4 ff ff       	call   b10 <setup>
+  if(stdin->flags & IO_DEV){
+    166a:	8b 15 c4 29 00 00    	mov    0x29c4,%edx
+    1670:	e9 72 ff ff ff       	jmp    15e7 <gets+0x17>
+    1675:	66 90                	xchg   %ax,%ax
+    1677:	66 90                	xchg   %ax,%ax
+    1679:	66 90                	xchg   %ax,%ax
+    167b:	66 90                	xchg   %ax,%ax
+    167d:	66 90                	xchg   %ax,%ax
+    167f:	90                   	nop
+
+00001680 <bigfree>:
+
+// Give a big block back to the first-fit list, and return the
+// free block that now holds it. Caller holds lock.
+static Header*
+bigfree(Header *bp)
+{
+    1680:	55                   	push   %ebp
+    1681:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1683:	a1 64 33 00 00       	mov    0x3364,%eax
+{
+    1688:	89 e5                	mov    %esp,%ebp
+    168a:	56                   	push   %esi
+    168b:	53                   	push   %ebx
+    168c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1690:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1692:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1694:	39 ca                	cmp    %ecx,%edx
+    1696:	73 38                	jae    16d0 <bigfree+0x50>
+    1698:	39 c1                	cmp    %eax,%ecx
+    169a:	72 04                	jb     16a0 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    169c:	39 c2                	cmp    %eax,%edx
+    169e:	72 f0                	jb     1690 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    16a0:	8b 59 04             	mov    0x4(%ecx),%ebx
+    16a3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    16a6:	39 f0                	cmp    %esi,%eax
+    16a8:	74 36                	je     16e0 <bigfree+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    16aa:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  freep = p;
+  if(p + p->s.size == bp){
+    16ac:	8b 42 04             	mov    0x4(%edx),%eax
+    16af:	89 cb                	mov    %ecx,%ebx
+  freep = p;
+    16b1:	89 15 64 33 00 00    	mov    %edx,0x3364
+  if(p + p->s.size == bp){
+    16b7:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    16ba:	39 f1                	cmp    %esi,%ecx
+    16bc:	74 2e                	je     16ec <bigfree+0x6c>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    16be:	89 1a                	mov    %ebx,(%edx)
+    return p;
+  }
+  p->s.ptr = bp;
+  return bp;
+}
+    16c0:	89 c8                	mov    %ecx,%eax
+    16c2:	5b                   	pop    %ebx
+    16c3:	5e                   	pop    %esi
+    16c4:	5d                   	pop    %ebp
+    16c5:	c3                   	ret
+    16c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16cd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    16d0:	39 c1                	cmp    %eax,%ecx
+    16d2:	72 c8                	jb     169c <bigfree+0x1c>
+    16d4:	eb ba                	jmp    1690 <bigfree+0x10>
+    16d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    16e0:	03 58 04             	add    0x4(%eax),%ebx
+    16e3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    16e6:	8b 02                	mov    (%edx),%eax
+    16e8:	8b 00                	mov    (%eax),%eax
+    16ea:	eb be                	jmp    16aa <bigfree+0x2a>
+    p->s.size += bp->s.size;
+    16ec:	03 41 04             	add    0x4(%ecx),%eax
+    16ef:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    16f2:	8b 19                	mov    (%ecx),%ebx
+    return p;
+    16f4:	89 d1                	mov    %edx,%ecx
+}
+    16f6:	89 c8                	mov    %ecx,%eax
+    p->s.ptr = bp->s.ptr;
+    16f8:	89 1a                	mov    %ebx,(%edx)
+}
+    16fa:	5b                   	pop    %ebx
+    16fb:	5e                   	pop    %esi
+    16fc:	5d                   	pop    %ebp
+    16fd:	c3                   	ret
+    16fe:	66 90                	xchg   %ax,%ax
+
+00001700 <trim>:
+// If free block bp ends the heap, return its whole pages to the
+// kernel, unless something else has moved the break since.
+// Caller holds lock.
+static void
+trim(Header *bp)
+{
+    1700:	55                   	push   %ebp
+    1701:	89 e5                	mov    %esp,%ebp
+    1703:	57                   	push   %edi
+    1704:	56                   	push   %esi
+    1705:	53                   	push   %ebx
+    1706:	89 c3                	mov    %eax,%ebx
+    1708:	83 ec 0c             	sub    $0xc,%esp
+  char *end;
+  uint n;
+
+  if((char*)(bp + bp->s.size) != heapend)
+    170b:	8b 53 04             	mov    0x4(%ebx),%edx
+    170e:	a1 60 33 00 00       	mov    0x3360,%eax
+    1713:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+    1716:	39 d0                	cmp    %edx,%eax
+    1718:	74 0e                	je     1728 <trim+0x28>
+  n = heapend - end;
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    bp->s.size -= n / sizeof(Header);
+    heapend = end;
+  }
+}
+    171a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    171d:	5b                   	pop    %ebx
+    171e:	5e                   	pop    %esi
+    171f:	5f                   	pop    %edi
+    1720:	5d                   	pop    %ebp
+    1721:	c3                   	ret
+    1722:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  end = (char*)PGROUNDUP((uint)(bp + 2));
+    1728:	8d bb 0f 10 00 00    	lea    0x100f(%ebx),%edi
+    172e:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  n = heapend - end;
+    1734:	29 f8                	sub    %edi,%eax
+    1736:	89 c6                	mov    %eax,%esi
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    1738:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    173d:	76 db                	jbe    171a <trim+0x1a>
+    173f:	83 ec 0c             	sub    $0xc,%esp
+    1742:	6a 00                	push   $0x0
+    1744:	e8 8b ef ff ff       	call   6d4 <sbrk>
+    1749:	83 c4 10             	add    $0x10,%esp
+    174c:	39 05 60 33 00 00    	cmp    %eax,0x3360
+    1752:	75 c6                	jne    171a <trim+0x1a>
+    1754:	89 f0                	mov    %esi,%eax
+    1756:	83 ec 0c             	sub    $0xc,%esp
+    1759:	f7 d8                	neg    %eax
+    175b:	50                   	push   %eax
+    175c:	e8 73 ef ff ff       	call   6d4 <sbrk>
+    1761:	83 c4 10             	add    $0x10,%esp
+    1764:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1767:	74 b1                	je     171a <trim+0x1a>
+    bp->s.size -= n / sizeof(Header);
+    1769:	89 f0                	mov    %esi,%eax
+    heapend = end;
+    176b:	89 3d 60 33 00 00    	mov    %edi,0x3360
+    bp->s.size -= n / sizeof(Header);
+    1771:	c1 e8 03             	shr    $0x3,%eax
+    1774:	29 43 04             	sub    %eax,0x4(%ebx)
+    heapend = end;
+    1777:	eb a1                	jmp    171a <trim+0x1a>
+    1779:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001780 <bigalloc>:
+}
+
+// Allocate a big block of nunits units. Caller holds lock.
+static Header*
+bigalloc(uint nunits)
+{
+    1780:	55                   	push   %ebp
+    1781:	89 e5                	mov    %esp,%ebp
+    1783:	57                   	push   %edi
+    1784:	89 c7                	mov    %eax,%edi
+    1786:	56                   	push   %esi
+    1787:	53                   	push   %ebx
+    1788:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    178b:	a1 64 33 00 00       	mov    0x3364,%eax
+    1790:	85 c0                	test   %eax,%eax
+    1792:	0f 84 98 00 00 00    	je     1830 <bigalloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1798:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    179a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    179d:	39 f9                	cmp    %edi,%ecx
+    179f:	73 67                	jae    1808 <bigalloc+0x88>
+  if(nu < 4096)
+    17a1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    17a6:	39 df                	cmp    %ebx,%edi
+    17a8:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    17ab:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    17b2:	eb 0d                	jmp    17c1 <bigalloc+0x41>
+    17b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    17b8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    17ba:	8b 4a 04             	mov    0x4(%edx),%ecx
+    17bd:	39 f9                	cmp    %edi,%ecx
+    17bf:	73 47                	jae    1808 <bigalloc+0x88>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    17c1:	89 d0                	mov    %edx,%eax
+    17c3:	39 15 64 33 00 00    	cmp    %edx,0x3364
+    17c9:	75 ed                	jne    17b8 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    17cb:	83 ec 0c             	sub    $0xc,%esp
+    17ce:	56                   	push   %esi
+    17cf:	e8 00 ef ff ff       	call   6d4 <sbrk>
+  if(p == (char*)-1)
+    17d4:	83 c4 10             	add    $0x10,%esp
+    17d7:	83 f8 ff             	cmp    $0xffffffff,%eax
+    17da:	74 1a                	je     17f6 <bigalloc+0x76>
+  hp->s.size = nu;
+    17dc:	89 58 04             	mov    %ebx,0x4(%eax)
+  heapend = p + nu * sizeof(Header);
+    17df:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    17e2:	89 15 60 33 00 00    	mov    %edx,0x3360
+  bigfree(hp);
+    17e8:	e8 93 fe ff ff       	call   1680 <bigfree>
+  return freep;
+    17ed:	a1 64 33 00 00       	mov    0x3364,%eax
+      if((p = morecore(nunits)) == 0)
+    17f2:	85 c0                	test   %eax,%eax
+    17f4:	75 c2                	jne    17b8 <bigalloc+0x38>
+        return 0;
+  }
+}
+    17f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    17f9:	31 d2                	xor    %edx,%edx
+}
+    17fb:	5b                   	pop    %ebx
+    17fc:	89 d0                	mov    %edx,%eax
+    17fe:	5e                   	pop    %esi
+    17ff:	5f                   	pop    %edi
+    1800:	5d                   	pop    %ebp
+    1801:	c3                   	ret
+    1802:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1808:	39 cf                	cmp    %ecx,%edi
+    180a:	74 54                	je     1860 <bigalloc+0xe0>
+        p->s.size -= nunits;
+    180c:	29 f9                	sub    %edi,%ecx
+    180e:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    1811:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    1814:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    1817:	a3 64 33 00 00       	mov    %eax,0x3364
+}
+    181c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    181f:	89 d0                	mov    %edx,%eax
+    1821:	5b                   	pop    %ebx
+    1822:	5e                   	pop    %esi
+    1823:	5f                   	pop    %edi
+    1824:	5d                   	pop    %ebp
+    1825:	c3                   	ret
+    1826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    182d:	8d 76 00             	lea    0x0(%esi),%esi
+    base.s.ptr = freep = prevp = &base;
+    1830:	c7 05 64 33 00 00 68 	movl   $0x3368,0x3364
+    1837:	33 00 00 
+    base.s.size = 0;
+    183a:	ba 68 33 00 00       	mov    $0x3368,%edx
+    base.s.ptr = freep = prevp = &base;
+    183f:	c7 05 68 33 00 00 68 	movl   $0x3368,0x3368
+    1846:	33 00 00 
+    base.s.size = 0;
+    1849:	c7 05 6c 33 00 00 00 	movl   $0x0,0x336c
+    1850:	00 00 00 
+    if(p->s.size >= nunits){
+    1853:	e9 49 ff ff ff       	jmp    17a1 <bigalloc+0x21>
+    1858:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    185f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1860:	8b 0a                	mov    (%edx),%ecx
+    1862:	89 08                	mov    %ecx,(%eax)
+    1864:	eb b1                	jmp    1817 <bigalloc+0x97>
+    1866:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    186d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001870 <drain>:
+}
+
+// Move n blocks of class c from cache tc to the shared list.
+static void
+drain(struct tcache *tc, int c, int n)
+{
+    1870:	55                   	push   %ebp
+    1871:	89 e5                	mov    %esp,%ebp
+    1873:	57                   	push   %edi
+    1874:	89 c7                	mov    %eax,%edi
+    1876:	56                   	push   %esi
+    1877:	89 d6                	mov    %edx,%esi
+    1879:	53                   	push   %ebx
+    187a:	89 cb                	mov    %ecx,%ebx
+    187c:	83 ec 0c             	sub    $0xc,%esp
+  if(threaded)
+    187f:	8b 15 e4 32 00 00    	mov    0x32e4,%edx
+    1885:	85 d2                	test   %edx,%edx
+    1887:	75 57                	jne    18e0 <drain+0x70>
+  Header *p;
+
+  acquire();
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1889:	85 c9                	test   %ecx,%ecx
+    188b:	7e 49                	jle    18d6 <drain+0x66>
+    188d:	89 d9                	mov    %ebx,%ecx
+    188f:	8d 14 b7             	lea    (%edi,%esi,4),%edx
+    1892:	eb 23                	jmp    18b7 <drain+0x47>
+    1894:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    tc->list[c] = p->s.ptr;
+    1898:	8b 18                	mov    (%eax),%ebx
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    189a:	83 e9 01             	sub    $0x1,%ecx
+    tc->n[c]--;
+    189d:	83 6a 20 01          	subl   $0x1,0x20(%edx)
+    tc->list[c] = p->s.ptr;
+    18a1:	89 1a                	mov    %ebx,(%edx)
+    p->s.ptr = small[c];
+    18a3:	8b 1c b5 40 33 00 00 	mov    0x3340(,%esi,4),%ebx
+    18aa:	89 18                	mov    %ebx,(%eax)
+    small[c] = p;
+    18ac:	89 04 b5 40 33 00 00 	mov    %eax,0x3340(,%esi,4)
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    18b3:	85 c9                	test   %ecx,%ecx
+    18b5:	7e 06                	jle    18bd <drain+0x4d>
+    18b7:	8b 02                	mov    (%edx),%eax
+    18b9:	85 c0                	test   %eax,%eax
+    18bb:	75 db                	jne    1898 <drain+0x28>
+  if(threaded)
+    18bd:	a1 e4 32 00 00       	mov    0x32e4,%eax
+    18c2:	85 c0                	test   %eax,%eax
+    18c4:	74 10                	je     18d6 <drain+0x66>
+    mutex_unlock(&lock);
+    18c6:	83 ec 0c             	sub    $0xc,%esp
+    18c9:	68 e8 32 00 00       	push   $0x32e8
+    18ce:	e8 1d ec ff ff       	call   4f0 <mutex_unlock>
+}
+    18d3:	83 c4 10             	add    $0x10,%esp
+  }
+  release();
+}
+    18d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    18d9:	5b                   	pop    %ebx
+    18da:	5e                   	pop    %esi
+    18db:	5f                   	pop    %edi
+    18dc:	5d                   	pop    %ebp
+    18dd:	c3                   	ret
+    18de:	66 90                	xchg   %ax,%ax
+    mutex_lock(&lock);
+    18e0:	83 ec 0c             	sub    $0xc,%esp
+    18e3:	68 e8 32 00 00       	push   $0x32e8
+    18e8:	e8 b3 eb ff ff       	call   4a0 <mutex_lock>
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    18ed:	83 c4 10             	add    $0x10,%esp
+    18f0:	85 db                	test   %ebx,%ebx
+    18f2:	7f 99                	jg     188d <drain+0x1d>
+    18f4:	eb c7                	jmp    18bd <drain+0x4d>
+    18f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001900 <mycache>:
+{
+    1900:	55                   	push   %ebp
+    return &maincache;
+    1901:	b8 00 33 00 00       	mov    $0x3300,%eax
+{
+    1906:	89 e5                	mov    %esp,%ebp
+    1908:	53                   	push   %ebx
+  sp = PGROUNDDOWN((uint)&sp);
+    1909:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+    190c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+    1912:	83 ec 14             	sub    $0x14,%esp
+  if(!threaded || sp == mainstack)
+    1915:	8b 0d e4 32 00 00    	mov    0x32e4,%ecx
+  sp = PGROUNDDOWN((uint)&sp);
+    191b:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  if(!threaded || sp == mainstack)
+    191e:	85 c9                	test   %ecx,%ecx
+    1920:	74 0f                	je     1931 <mycache+0x31>
+    1922:	3b 1d e0 32 00 00    	cmp    0x32e0,%ebx
+    1928:	74 07                	je     1931 <mycache+0x31>
+  if(*cp == 0){
+    192a:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    192d:	85 c0                	test   %eax,%eax
+    192f:	74 0f                	je     1940 <mycache+0x40>
+}
+    1931:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1934:	c9                   	leave
+    1935:	c3                   	ret
+    1936:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    193d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1940:	83 ec 0c             	sub    $0xc,%esp
+    1943:	68 e8 32 00 00       	push   $0x32e8
+    1948:	e8 53 eb ff ff       	call   4a0 <mutex_lock>
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    194d:	b8 09 00 00 00       	mov    $0x9,%eax
+    1952:	e8 29 fe ff ff       	call   1780 <bigalloc>
+  if(threaded)
+    1957:	8b 15 e4 32 00 00    	mov    0x32e4,%edx
+    195d:	83 c4 10             	add    $0x10,%esp
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    1960:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(threaded)
+    1963:	85 d2                	test   %edx,%edx
+    1965:	75 29                	jne    1990 <mycache+0x90>
+    if(*cp == 0)
+    1967:	85 c0                	test   %eax,%eax
+    1969:	74 c6                	je     1931 <mycache+0x31>
+    memset(*cp, 0, sizeof(**cp));
+    196b:	83 ec 04             	sub    $0x4,%esp
+    *cp = (struct tcache*)((Header*)*cp + 1);
+    196e:	83 c0 08             	add    $0x8,%eax
+    1971:	89 43 f8             	mov    %eax,-0x8(%ebx)
+    memset(*cp, 0, sizeof(**cp));
+    1974:	6a 40                	push   $0x40
+    1976:	6a 00                	push   $0x0
+    1978:	50                   	push   %eax
+    1979:	e8 f2 e9 ff ff       	call   370 <memset>
+  return *cp;
+    197e:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    1981:	83 c4 10             	add    $0x10,%esp
+    1984:	eb ab                	jmp    1931 <mycache+0x31>
+    1986:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    198d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1990:	83 ec 0c             	sub    $0xc,%esp
+    1993:	68 e8 32 00 00       	push   $0x32e8
+    1998:	e8 53 eb ff ff       	call   4f0 <mutex_unlock>
+    if(*cp == 0)
+    199d:	8b 43 f8             	mov    -0x8(%ebx),%eax
+}
+    19a0:	83 c4 10             	add    $0x10,%esp
+    19a3:	eb c2                	jmp    1967 <mycache+0x67>
+    19a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000019b0 <free>:
+
+void
+free(void *ap)
+{
+    19b0:	55                   	push   %ebp
+    19b1:	89 e5                	mov    %esp,%ebp
+    19b3:	57                   	push   %edi
+    19b4:	56                   	push   %esi
+    19b5:	53                   	push   %ebx
+    19b6:	83 ec 1c             	sub    $0x1c,%esp
+    19b9:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  struct tcache *tc;
+  int c;
+
+  if(ap == 0)
+    19bc:	85 f6                	test   %esi,%esi
+    19be:	74 51                	je     1a11 <free+0x61>
+    return;
+  bp = (Header*)ap - 1;
+    19c0:	8d 46 f8             	lea    -0x8(%esi),%eax
+    19c3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(bp->s.size > SMALLMAX / sizeof(Header)){
+    19c6:	8b 46 fc             	mov    -0x4(%esi),%eax
+    19c9:	3d 00 01 00 00       	cmp    $0x100,%eax
+    19ce:	77 50                	ja     1a20 <free+0x70>
+    acquire();
+    trim(bigfree(bp));
+    release();
+    return;
+  }
+  for(c = 0; (2 << c) < bp->s.size; c++)
+    19d0:	31 db                	xor    %ebx,%ebx
+    19d2:	ba 02 00 00 00       	mov    $0x2,%edx
+    19d7:	83 f8 02             	cmp    $0x2,%eax
+    19da:	76 11                	jbe    19ed <free+0x3d>
+    19dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    19e0:	83 c3 01             	add    $0x1,%ebx
+    19e3:	89 d7                	mov    %edx,%edi
+    19e5:	89 d9                	mov    %ebx,%ecx
+    19e7:	d3 e7                	shl    %cl,%edi
+    19e9:	39 c7                	cmp    %eax,%edi
+    19eb:	72 f3                	jb     19e0 <free+0x30>
+    ;
+  if((tc = mycache()) == 0){
+    19ed:	e8 0e ff ff ff       	call   1900 <mycache>
+    19f2:	85 c0                	test   %eax,%eax
+    19f4:	74 7a                	je     1a70 <free+0xc0>
+    bp->s.ptr = small[c];
+    small[c] = bp;
+    release();
+    return;
+  }
+  bp->s.ptr = tc->list[c];
+    19f6:	8d 0c 98             	lea    (%eax,%ebx,4),%ecx
+    19f9:	8b 11                	mov    (%ecx),%edx
+    19fb:	89 56 f8             	mov    %edx,-0x8(%esi)
+  tc->list[c] = bp;
+    19fe:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1a01:	89 31                	mov    %esi,(%ecx)
+  if(++tc->n[c] > TCACHEMAX)
+    1a03:	8b 71 20             	mov    0x20(%ecx),%esi
+    1a06:	8d 56 01             	lea    0x1(%esi),%edx
+    1a09:	89 51 20             	mov    %edx,0x20(%ecx)
+    1a0c:	83 fa 20             	cmp    $0x20,%edx
+    1a0f:	7f 47                	jg     1a58 <free+0xa8>
+    drain(tc, c, BATCH);
+}
+    1a11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a14:	5b                   	pop    %ebx
+    1a15:	5e                   	pop    %esi
+    1a16:	5f                   	pop    %edi
+    1a17:	5d                   	pop    %ebp
+    1a18:	c3                   	ret
+    1a19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1a20:	8b 1d e4 32 00 00    	mov    0x32e4,%ebx
+    1a26:	85 db                	test   %ebx,%ebx
+    1a28:	75 66                	jne    1a90 <free+0xe0>
+    trim(bigfree(bp));
+    1a2a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1a2d:	e8 4e fc ff ff       	call   1680 <bigfree>
+    1a32:	e8 c9 fc ff ff       	call   1700 <trim>
+  if(threaded)
+    1a37:	8b 0d e4 32 00 00    	mov    0x32e4,%ecx
+    1a3d:	85 c9                	test   %ecx,%ecx
+    1a3f:	74 d0                	je     1a11 <free+0x61>
+    mutex_unlock(&lock);
+    1a41:	c7 45 08 e8 32 00 00 	movl   $0x32e8,0x8(%ebp)
+}
+    1a48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a4b:	5b                   	pop    %ebx
+    1a4c:	5e                   	pop    %esi
+    1a4d:	5f                   	pop    %edi
+    1a4e:	5d                   	pop    %ebp
+    mutex_unlock(&lock);
+    1a4f:	e9 9c ea ff ff       	jmp    4f0 <mutex_unlock>
+    1a54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    1a58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    drain(tc, c, BATCH);
+    1a5b:	89 da                	mov    %ebx,%edx
+    1a5d:	b9 10 00 00 00       	mov    $0x10,%ecx
+}
+    1a62:	5b                   	pop    %ebx
+    1a63:	5e                   	pop    %esi
+    1a64:	5f                   	pop    %edi
+    1a65:	5d                   	pop    %ebp
+    drain(tc, c, BATCH);
+    1a66:	e9 05 fe ff ff       	jmp    1870 <drain>
+    1a6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1a6f:	90                   	nop
+  if(threaded)
+    1a70:	8b 15 e4 32 00 00    	mov    0x32e4,%edx
+    1a76:	85 d2                	test   %edx,%edx
+    1a78:	75 28                	jne    1aa2 <free+0xf2>
+    bp->s.ptr = small[c];
+    1a7a:	8b 04 9d 40 33 00 00 	mov    0x3340(,%ebx,4),%eax
+    1a81:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1a84:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1a87:	89 04 9d 40 33 00 00 	mov    %eax,0x3340(,%ebx,4)
+  if(threaded)
+    1a8e:	eb 81                	jmp    1a11 <free+0x61>
+    mutex_lock(&lock);
+    1a90:	83 ec 0c             	sub    $0xc,%esp
+    1a93:	68 e8 32 00 00       	push   $0x32e8
+    1a98:	e8 03 ea ff ff       	call   4a0 <mutex_lock>
+}
+    1a9d:	83 c4 10             	add    $0x10,%esp
+    1aa0:	eb 88                	jmp    1a2a <free+0x7a>
+    mutex_lock(&lock);
+    1aa2:	83 ec 0c             	sub    $0xc,%esp
+    1aa5:	68 e8 32 00 00       	push   $0x32e8
+    1aaa:	e8 f1 e9 ff ff       	call   4a0 <mutex_lock>
+    bp->s.ptr = small[c];
+    1aaf:	8b 04 9d 40 33 00 00 	mov    0x3340(,%ebx,4),%eax
+  if(threaded)
+    1ab6:	83 c4 10             	add    $0x10,%esp
+    bp->s.ptr = small[c];
+    1ab9:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1abc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1abf:	89 04 9d 40 33 00 00 	mov    %eax,0x3340(,%ebx,4)
+  if(threaded)
+    1ac6:	a1 e4 32 00 00       	mov    0x32e4,%eax
+    1acb:	85 c0                	test   %eax,%eax
+    1acd:	0f 85 6e ff ff ff    	jne    1a41 <free+0x91>
+    1ad3:	e9 39 ff ff ff       	jmp    1a11 <free+0x61>
+    1ad8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1adf:	90                   	nop
+
+00001ae0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1ae0:	55                   	push   %ebp
+    1ae1:	89 e5                	mov    %esp,%ebp
+    1ae3:	57                   	push   %edi
+    1ae4:	56                   	push   %esi
+    1ae5:	53                   	push   %ebx
+    1ae6:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  struct tcache *tc;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1ae9:	8b 45 08             	mov    0x8(%ebp),%eax
+    1aec:	8d 78 07             	lea    0x7(%eax),%edi
+    1aef:	c1 ef 03             	shr    $0x3,%edi
+    1af2:	83 c7 01             	add    $0x1,%edi
+  if(nunits > SMALLMAX / sizeof(Header)){
+    1af5:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+    1afb:	77 5b                	ja     1b58 <malloc+0x78>
+    acquire();
+    p = bigalloc(nunits);
+    release();
+    return p ? (void*)(p + 1) : 0;
+  }
+  for(c = 0; (2 << c) < nunits; c++)
+    1afd:	31 c9                	xor    %ecx,%ecx
+    1aff:	b8 02 00 00 00       	mov    $0x2,%eax
+    1b04:	be 02 00 00 00       	mov    $0x2,%esi
+    1b09:	bb 02 00 00 00       	mov    $0x2,%ebx
+    1b0e:	83 ff 02             	cmp    $0x2,%edi
+    1b11:	76 12                	jbe    1b25 <malloc+0x45>
+    1b13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1b17:	90                   	nop
+    1b18:	83 c1 01             	add    $0x1,%ecx
+    1b1b:	89 c3                	mov    %eax,%ebx
+    1b1d:	d3 e3                	shl    %cl,%ebx
+    1b1f:	89 de                	mov    %ebx,%esi
+    1b21:	39 fb                	cmp    %edi,%ebx
+    1b23:	72 f3                	jb     1b18 <malloc+0x38>
+    1b25:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    ;
+  if((tc = mycache()) == 0)
+    1b28:	e8 d3 fd ff ff       	call   1900 <mycache>
+    1b2d:	85 c0                	test   %eax,%eax
+    1b2f:	74 51                	je     1b82 <malloc+0xa2>
+    return 0;
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1b31:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1b34:	8d 3c 88             	lea    (%eax,%ecx,4),%edi
+    1b37:	8b 07                	mov    (%edi),%eax
+    1b39:	85 c0                	test   %eax,%eax
+    1b3b:	74 53                	je     1b90 <malloc+0xb0>
+    return 0;
+  p = tc->list[c];
+  tc->list[c] = p->s.ptr;
+  tc->n[c]--;
+    1b3d:	8b 57 20             	mov    0x20(%edi),%edx
+  tc->list[c] = p->s.ptr;
+    1b40:	8b 08                	mov    (%eax),%ecx
+  tc->n[c]--;
+    1b42:	83 ea 01             	sub    $0x1,%edx
+  return (void*)(p + 1);
+    1b45:	83 c0 08             	add    $0x8,%eax
+  tc->n[c]--;
+    1b48:	89 57 20             	mov    %edx,0x20(%edi)
+  tc->list[c] = p->s.ptr;
+    1b4b:	89 0f                	mov    %ecx,(%edi)
+}
+    1b4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b50:	5b                   	pop    %ebx
+    1b51:	5e                   	pop    %esi
+    1b52:	5f                   	pop    %edi
+    1b53:	5d                   	pop    %ebp
+    1b54:	c3                   	ret
+    1b55:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1b58:	a1 e4 32 00 00       	mov    0x32e4,%eax
+    1b5d:	85 c0                	test   %eax,%eax
+    1b5f:	0f 85 b3 00 00 00    	jne    1c18 <malloc+0x138>
+    p = bigalloc(nunits);
+    1b65:	89 f8                	mov    %edi,%eax
+    1b67:	e8 14 fc ff ff       	call   1780 <bigalloc>
+    1b6c:	89 c3                	mov    %eax,%ebx
+  if(threaded)
+    1b6e:	a1 e4 32 00 00       	mov    0x32e4,%eax
+    1b73:	85 c0                	test   %eax,%eax
+    1b75:	0f 85 85 00 00 00    	jne    1c00 <malloc+0x120>
+    return p ? (void*)(p + 1) : 0;
+    1b7b:	8d 43 08             	lea    0x8(%ebx),%eax
+    1b7e:	85 db                	test   %ebx,%ebx
+    1b80:	75 cb                	jne    1b4d <malloc+0x6d>
+    1b82:	31 c0                	xor    %eax,%eax
+}
+    1b84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b87:	5b                   	pop    %ebx
+    1b88:	5e                   	pop    %esi
+    1b89:	5f                   	pop    %edi
+    1b8a:	5d                   	pop    %ebp
+    1b8b:	c3                   	ret
+    1b8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1b90:	a1 e4 32 00 00       	mov    0x32e4,%eax
+    1b95:	85 c0                	test   %eax,%eax
+    1b97:	0f 85 29 01 00 00    	jne    1cc6 <malloc+0x1e6>
+  if(small[c] == 0){
+    1b9d:	8b 04 8d 40 33 00 00 	mov    0x3340(,%ecx,4),%eax
+    1ba4:	85 c0                	test   %eax,%eax
+    1ba6:	0f 84 81 00 00 00    	je     1c2d <malloc+0x14d>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1bac:	31 db                	xor    %ebx,%ebx
+    1bae:	eb 22                	jmp    1bd2 <malloc+0xf2>
+    small[c] = p->s.ptr;
+    1bb0:	8b 10                	mov    (%eax),%edx
+  for(moved = 0; moved < n && small[c]; moved++){
+    1bb2:	83 c3 01             	add    $0x1,%ebx
+    small[c] = p->s.ptr;
+    1bb5:	89 14 8d 40 33 00 00 	mov    %edx,0x3340(,%ecx,4)
+    p->s.ptr = tc->list[c];
+    1bbc:	8b 17                	mov    (%edi),%edx
+    1bbe:	89 10                	mov    %edx,(%eax)
+    tc->list[c] = p;
+    1bc0:	89 07                	mov    %eax,(%edi)
+  for(moved = 0; moved < n && small[c]; moved++){
+    1bc2:	83 fb 10             	cmp    $0x10,%ebx
+    1bc5:	0f 84 e2 00 00 00    	je     1cad <malloc+0x1cd>
+    1bcb:	8b 04 8d 40 33 00 00 	mov    0x3340(,%ecx,4),%eax
+    1bd2:	85 c0                	test   %eax,%eax
+    1bd4:	75 da                	jne    1bb0 <malloc+0xd0>
+  if(threaded)
+    1bd6:	8b 15 e4 32 00 00    	mov    0x32e4,%edx
+    1bdc:	85 d2                	test   %edx,%edx
+    1bde:	0f 85 b4 00 00 00    	jne    1c98 <malloc+0x1b8>
+  tc->n[c] += moved;
+    1be4:	8b 57 20             	mov    0x20(%edi),%edx
+    1be7:	01 da                	add    %ebx,%edx
+    1be9:	89 57 20             	mov    %edx,0x20(%edi)
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1bec:	85 db                	test   %ebx,%ebx
+    1bee:	74 92                	je     1b82 <malloc+0xa2>
+  p = tc->list[c];
+    1bf0:	8b 07                	mov    (%edi),%eax
+    1bf2:	e9 49 ff ff ff       	jmp    1b40 <malloc+0x60>
+    1bf7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bfe:	66 90                	xchg   %ax,%ax
+    mutex_unlock(&lock);
+    1c00:	83 ec 0c             	sub    $0xc,%esp
+    1c03:	68 e8 32 00 00       	push   $0x32e8
+    1c08:	e8 e3 e8 ff ff       	call   4f0 <mutex_unlock>
+}
+    1c0d:	83 c4 10             	add    $0x10,%esp
+    1c10:	e9 66 ff ff ff       	jmp    1b7b <malloc+0x9b>
+    1c15:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1c18:	83 ec 0c             	sub    $0xc,%esp
+    1c1b:	68 e8 32 00 00       	push   $0x32e8
+    1c20:	e8 7b e8 ff ff       	call   4a0 <mutex_lock>
+}
+    1c25:	83 c4 10             	add    $0x10,%esp
+    1c28:	e9 38 ff ff ff       	jmp    1b65 <malloc+0x85>
+    if((chunk = bigalloc(CHUNK / sizeof(Header) + 1)) == 0){
+    1c2d:	b8 01 02 00 00       	mov    $0x201,%eax
+    1c32:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1c35:	e8 46 fb ff ff       	call   1780 <bigalloc>
+    1c3a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1c3d:	85 c0                	test   %eax,%eax
+    1c3f:	89 c2                	mov    %eax,%edx
+    1c41:	0f 84 ba 00 00 00    	je     1d01 <malloc+0x221>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1c47:	83 c2 08             	add    $0x8,%edx
+    1c4a:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+    1c50:	0f 87 d0 00 00 00    	ja     1d26 <malloc+0x246>
+    1c56:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+    1c5d:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    1c60:	89 df                	mov    %ebx,%edi
+    1c62:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1c65:	8d 76 00             	lea    0x0(%esi),%esi
+      p->s.size = units;
+    1c68:	89 72 04             	mov    %esi,0x4(%edx)
+      p->s.ptr = small[c];
+    1c6b:	8b 04 8d 40 33 00 00 	mov    0x3340(,%ecx,4),%eax
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1c72:	01 df                	add    %ebx,%edi
+    1c74:	89 55 e0             	mov    %edx,-0x20(%ebp)
+      p->s.ptr = small[c];
+    1c77:	89 02                	mov    %eax,(%edx)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1c79:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      small[c] = p;
+    1c7c:	89 14 8d 40 33 00 00 	mov    %edx,0x3340(,%ecx,4)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1c83:	01 c2                	add    %eax,%edx
+    1c85:	81 ff 00 02 00 00    	cmp    $0x200,%edi
+    1c8b:	76 db                	jbe    1c68 <malloc+0x188>
+    1c8d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1c90:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1c93:	e9 14 ff ff ff       	jmp    1bac <malloc+0xcc>
+    mutex_unlock(&lock);
+    1c98:	83 ec 0c             	sub    $0xc,%esp
+    1c9b:	68 e8 32 00 00       	push   $0x32e8
+    1ca0:	e8 4b e8 ff ff       	call   4f0 <mutex_unlock>
+}
+    1ca5:	83 c4 10             	add    $0x10,%esp
+    1ca8:	e9 37 ff ff ff       	jmp    1be4 <malloc+0x104>
+  if(threaded)
+    1cad:	a1 e4 32 00 00       	mov    0x32e4,%eax
+    1cb2:	85 c0                	test   %eax,%eax
+    1cb4:	75 2b                	jne    1ce1 <malloc+0x201>
+  tc->n[c] += moved;
+    1cb6:	8b 47 20             	mov    0x20(%edi),%eax
+    1cb9:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1cbc:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1cbe:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1cc1:	e9 7a fe ff ff       	jmp    1b40 <malloc+0x60>
+    mutex_lock(&lock);
+    1cc6:	83 ec 0c             	sub    $0xc,%esp
+    1cc9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1ccc:	68 e8 32 00 00       	push   $0x32e8
+    1cd1:	e8 ca e7 ff ff       	call   4a0 <mutex_lock>
+}
+    1cd6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1cd9:	83 c4 10             	add    $0x10,%esp
+    1cdc:	e9 bc fe ff ff       	jmp    1b9d <malloc+0xbd>
+    mutex_unlock(&lock);
+    1ce1:	83 ec 0c             	sub    $0xc,%esp
+    1ce4:	68 e8 32 00 00       	push   $0x32e8
+    1ce9:	e8 02 e8 ff ff       	call   4f0 <mutex_unlock>
+  tc->n[c] += moved;
+    1cee:	8b 47 20             	mov    0x20(%edi),%eax
+    1cf1:	83 c4 10             	add    $0x10,%esp
+    1cf4:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1cf7:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1cf9:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1cfc:	e9 3f fe ff ff       	jmp    1b40 <malloc+0x60>
+  if(threaded)
+    1d01:	8b 0d e4 32 00 00    	mov    0x32e4,%ecx
+    1d07:	85 c9                	test   %ecx,%ecx
+    1d09:	0f 84 73 fe ff ff    	je     1b82 <malloc+0xa2>
+    mutex_unlock(&lock);
+    1d0f:	83 ec 0c             	sub    $0xc,%esp
+    1d12:	68 e8 32 00 00       	push   $0x32e8
+    1d17:	e8 d4 e7 ff ff       	call   4f0 <mutex_unlock>
+    1d1c:	83 c4 10             	add    $0x10,%esp
+    return p ? (void*)(p + 1) : 0;
+    1d1f:	31 c0                	xor    %eax,%eax
+    1d21:	e9 5e fe ff ff       	jmp    1b84 <malloc+0xa4>
+  for(moved = 0; moved < n && small[c]; moved++){
+    1d26:	8b 04 8d 40 33 00 00 	mov    0x3340(,%ecx,4),%eax
+    1d2d:	e9 7a fe ff ff       	jmp    1bac <malloc+0xcc>
+    1d32:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001d40 <malloc_threaded>:
+void
+malloc_threaded(void)
+{
+  uint sp;
+
+  if(threaded)
+    1d40:	a1 e4 32 00 00       	mov    0x32e4,%eax
+    1d45:	85 c0                	test   %eax,%eax
+    1d47:	74 07                	je     1d50 <malloc_threaded+0x10>
+    1d49:	c3                   	ret
+    1d4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+{
+    1d50:	55                   	push   %ebp
+    1d51:	89 e5                	mov    %esp,%ebp
+    1d53:	83 ec 24             	sub    $0x24,%esp
+    return;
+  mutex_init(&lock);
+    1d56:	68 e8 32 00 00       	push   $0x32e8
+    1d5b:	e8 30 e7 ff ff       	call   490 <mutex_init>
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1d60:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1d63:	83 c4 10             	add    $0x10,%esp
+  threaded = 1;
+    1d66:	c7 05 e4 32 00 00 01 	movl   $0x1,0x32e4
+    1d6d:	00 00 00 
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1d70:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    1d75:	a3 e0 32 00 00       	mov    %eax,0x32e0
+}
+    1d7a:	c9                   	leave
+    1d7b:	c3                   	ret
+    1d7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001d80 <malloc_thread_exit>:
+
+// Called by thread_join() with the cache slot of a finished
+// thread: give its blocks, and the cache itself, back.
+void
+malloc_thread_exit(void **cachep)
+{
+    1d80:	55                   	push   %ebp
+    1d81:	89 e5                	mov    %esp,%ebp
+    1d83:	57                   	push   %edi
+    1d84:	56                   	push   %esi
+    1d85:	53                   	push   %ebx
+    1d86:	83 ec 0c             	sub    $0xc,%esp
+    1d89:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct tcache *tc;
+  int c;
+
+  if((tc = *cachep) == 0)
+    1d8c:	8b 37                	mov    (%edi),%esi
+    1d8e:	85 f6                	test   %esi,%esi
+    1d90:	74 41                	je     1dd3 <malloc_thread_exit+0x53>
+    return;
+  for(c = 0; c < NCLASS; c++)
+    1d92:	31 db                	xor    %ebx,%ebx
+    1d94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    drain(tc, c, tc->n[c]);
+    1d98:	8b 4c 9e 20          	mov    0x20(%esi,%ebx,4),%ecx
+    1d9c:	89 da                	mov    %ebx,%edx
+    1d9e:	89 f0                	mov    %esi,%eax
+  for(c = 0; c < NCLASS; c++)
+    1da0:	83 c3 01             	add    $0x1,%ebx
+    drain(tc, c, tc->n[c]);
+    1da3:	e8 c8 fa ff ff       	call   1870 <drain>
+  for(c = 0; c < NCLASS; c++)
+    1da8:	83 fb 08             	cmp    $0x8,%ebx
+    1dab:	75 eb                	jne    1d98 <malloc_thread_exit+0x18>
+  if(threaded)
+    1dad:	8b 15 e4 32 00 00    	mov    0x32e4,%edx
+    1db3:	85 d2                	test   %edx,%edx
+    1db5:	75 29                	jne    1de0 <malloc_thread_exit+0x60>
+  acquire();
+  trim(bigfree((Header*)tc - 1));
+    1db7:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1dba:	e8 c1 f8 ff ff       	call   1680 <bigfree>
+    1dbf:	e8 3c f9 ff ff       	call   1700 <trim>
+  if(threaded)
+    1dc4:	a1 e4 32 00 00       	mov    0x32e4,%eax
+    1dc9:	85 c0                	test   %eax,%eax
+    1dcb:	75 2b                	jne    1df8 <malloc_thread_exit+0x78>
+  release();
+  *cachep = 0;
+    1dcd:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+}
+    1dd3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1dd6:	5b                   	pop    %ebx
+    1dd7:	5e                   	pop    %esi
+    1dd8:	5f                   	pop    %edi
+    1dd9:	5d                   	pop    %ebp
+    1dda:	c3                   	ret
+    1ddb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1ddf:	90                   	nop
+    mutex_lock(&lock);
+    1de0:	83 ec 0c             	sub    $0xc,%esp
+    1de3:	68 e8 32 00 00       	push   $0x32e8
+    1de8:	e8 b3 e6 ff ff       	call   4a0 <mutex_lock>
+}
+    1ded:	83 c4 10             	add    $0x10,%esp
+    1df0:	eb c5                	jmp    1db7 <malloc_thread_exit+0x37>
+    1df2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1df8:	83 ec 0c             	sub    $0xc,%esp
+    1dfb:	68 e8 32 00 00       	push   $0x32e8
+    1e00:	e8 eb e6 ff ff       	call   4f0 <mutex_unlock>
+}
+    1e05:	83 c4 10             	add    $0x10,%esp
+    1e08:	eb c3                	jmp    1dcd <malloc_thread_exit+0x4d>
+    1e0a:	66 90                	xchg   %ax,%ax
+    1e0c:	66 90                	xchg   %ax,%ax
+    1e0e:	66 90                	xchg   %ax,%ax
+
+00001e10 <thread_create>:
+
+// Start fn(arg) in a new thread on a freshly allocated
+// page-aligned stack.  Returns the thread's pid.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1e10:	55                   	push   %ebp
+    1e11:	89 e5                	mov    %esp,%ebp
+    1e13:	53                   	push   %ebx
+    1e14:	83 ec 14             	sub    $0x14,%esp
+  char *mem, *stack;
+  int pid;
+
+  malloc_threaded();
+    1e17:	e8 24 ff ff ff       	call   1d40 <malloc_threaded>
+  stdio_threaded();
+    1e1c:	e8 cf ee ff ff       	call   cf0 <stdio_threaded>
+  if((mem = malloc(2*PGSIZE)) == 0)
+    1e21:	83 ec 0c             	sub    $0xc,%esp
+    1e24:	68 00 20 00 00       	push   $0x2000
+    1e29:	e8 b2 fc ff ff       	call   1ae0 <malloc>
+    1e2e:	83 c4 10             	add    $0x10,%esp
+    1e31:	85 c0                	test   %eax,%eax
+    1e33:	74 52                	je     1e87 <thread_create+0x77>
+    1e35:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1e37:	8d 80 07 10 00 00    	lea    0x1007(%eax),%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+  ((char**)stack)[-2] = 0;
+  if((pid = clone(fn, arg, stack)) < 0)
+    1e3d:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1e40:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+    1e45:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  ((char**)stack)[-2] = 0;
+    1e48:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+  if((pid = clone(fn, arg, stack)) < 0)
+    1e4f:	50                   	push   %eax
+    1e50:	ff 75 0c             	push   0xc(%ebp)
+    1e53:	ff 75 08             	push   0x8(%ebp)
+    1e56:	e8 97 e8 ff ff       	call   6f2 <clone>
+    1e5b:	83 c4 10             	add    $0x10,%esp
+    1e5e:	85 c0                	test   %eax,%eax
+    1e60:	78 0e                	js     1e70 <thread_create+0x60>
+    free(mem);
+  return pid;
+}
+    1e62:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1e65:	c9                   	leave
+    1e66:	c3                   	ret
+    1e67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e6e:	66 90                	xchg   %ax,%ax
+    free(mem);
+    1e70:	83 ec 0c             	sub    $0xc,%esp
+    1e73:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1e76:	53                   	push   %ebx
+    1e77:	e8 34 fb ff ff       	call   19b0 <free>
+    1e7c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1e7f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    1e82:	83 c4 10             	add    $0x10,%esp
+}
+    1e85:	c9                   	leave
+    1e86:	c3                   	ret
+    return -1;
+    1e87:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1e8c:	eb d4                	jmp    1e62 <thread_create+0x52>
+    1e8e:	66 90                	xchg   %ax,%ax
+
+00001e90 <thread_join>:
+
+// Wait for a thread to finish and free its stack.
+int
+thread_join(void)
+{
+    1e90:	55                   	push   %ebp
+    1e91:	89 e5                	mov    %esp,%ebp
+    1e93:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    1e94:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    1e97:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    1e9a:	50                   	push   %eax
+    1e9b:	e8 61 e8 ff ff       	call   701 <join>
+    1ea0:	83 c4 10             	add    $0x10,%esp
+    1ea3:	85 c0                	test   %eax,%eax
+    1ea5:	78 29                	js     1ed0 <thread_join+0x40>
+    1ea7:	89 c3                	mov    %eax,%ebx
+    return -1;
+  malloc_thread_exit(&((void**)stack)[-2]);
+    1ea9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1eac:	83 ec 0c             	sub    $0xc,%esp
+    1eaf:	83 e8 08             	sub    $0x8,%eax
+    1eb2:	50                   	push   %eax
+    1eb3:	e8 c8 fe ff ff       	call   1d80 <malloc_thread_exit>
+  free(((char**)stack)[-1]);
+    1eb8:	58                   	pop    %eax
+    1eb9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1ebc:	ff 70 fc             	push   -0x4(%eax)
+    1ebf:	e8 ec fa ff ff       	call   19b0 <free>
+  return pid;
+    1ec4:	83 c4 10             	add    $0x10,%esp
+}
+    1ec7:	89 d8                	mov    %ebx,%eax
+    1ec9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1ecc:	c9                   	leave
+    1ecd:	c3                   	ret
+    1ece:	66 90                	xchg   %ax,%ax
+    return -1;
+    1ed0:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    1ed5:	eb f0                	jmp    1ec7 <thread_join+0x37>
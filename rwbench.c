@@ -0,0 +1,88 @@
+// Shared read-path benchmark.
+// Several processes at once repeatedly exec a small binary and
+// read a shared file, which all contend on the same inodes
+// (the root directory, the binary and the file itself).
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define NEXEC  50      // execs per process
+#define NREAD  20      // full reads of the file per process
+
+int nproc = 4;
+char buf[512];
+
+void
+doexec(void)
+{
+  char *argv[] = { "rwbench", "-x", 0 };
+  int i, pid;
+
+  for(i = 0; i < NEXEC; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(1, "rwbench: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      exec("rwbench", argv);
+      printf(1, "rwbench: exec failed\n");
+      exit();
+    }
+    wait();
+  }
+}
+
+void
+doread(char *path)
+{
+  int i, fd;
+
+  for(i = 0; i < NREAD; i++){
+    if((fd = open(path, O_RDONLY)) < 0){
+      printf(1, "rwbench: cannot open %s\n", path);
+      exit();
+    }
+    while(read(fd, buf, sizeof(buf)) > 0)
+      ;
+    close(fd);
+  }
+}
+
+void
+run(char *name, char *path)
+{
+  int i, t0, t1;
+
+  t0 = uptime();
+  for(i = 0; i < nproc; i++){
+    if(fork() == 0){
+      if(path)
+        doread(path);
+      else
+        doexec();
+      exit();
+    }
+  }
+  for(i = 0; i < nproc; i++)
+    wait();
+  t1 = uptime();
+  printf(1, "%s: %d procs, %d ticks\n", name, nproc, t1 - t0);
+}
+
+int
+main(int argc, char *argv[])
+{
+  if(argc > 1 && strcmp(argv[1], "-x") == 0)
+    exit();
+  if(argc > 1)
+    nproc = atoi(argv[1]);
+  if(nproc < 1)
+    nproc = 1;
+
+  run("exec", 0);
+  run("read", "usertests");
+  exit();
+}
@@ -0,0 +1,4517 @@
+
+_scstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return a->tothi > b->tothi || (a->tothi == b->tothi && a->totlo > b->totlo);
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 18             	sub    $0x18,%esp
+  int i, j, n, nbefore, pid, t;
+  struct scstat *s;
+  uint k;
+
+  nbefore = 0;
+  if(argc > 2 && strcmp(argv[1], "-p") == 0){
+      14:	83 39 02             	cmpl   $0x2,(%ecx)
+{
+      17:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc > 2 && strcmp(argv[1], "-p") == 0){
+      1a:	0f 8f 9d 00 00 00    	jg     bd <main+0xbd>
+    if((n = scstat(atoi(argv[2]), after, NSCSTAT)) < 0){
+      printf(2, "scstat: no process %s\n", argv[2]);
+      exit();
+    }
+  } else {
+    if(argc > 1){
+      20:	0f 84 b1 00 00 00    	je     d7 <main+0xd7>
+        printf(2, "scstat: exec %s failed\n", argv[1]);
+        exit();
+      }
+      wait();
+    }
+    n = scstat(0, after, NSCSTAT);
+      26:	50                   	push   %eax
+      27:	6a 30                	push   $0x30
+      29:	68 e0 2f 00 00       	push   $0x2fe0
+      2e:	6a 00                	push   $0x0
+      30:	e8 ad 0a 00 00       	call   ae2 <scstat>
+      35:	83 c4 10             	add    $0x10,%esp
+      38:	89 c2                	mov    %eax,%edx
+    after[i].count -= before[i].count;
+    after[i].tothi -= before[i].tothi + (after[i].totlo < before[i].totlo);
+    after[i].totlo -= before[i].totlo;
+  }
+
+  for(i = 0; i < n; i++){
+      3a:	85 d2                	test   %edx,%edx
+      3c:	0f 8e cd 02 00 00    	jle    30f <main+0x30f>
+      42:	c7 45 e4 e4 2f 00 00 	movl   $0x2fe4,-0x1c(%ebp)
+      49:	31 db                	xor    %ebx,%ebx
+      4b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+      4e:	31 c9                	xor    %ecx,%ecx
+      50:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+      53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      57:	90                   	nop
+    t = i;
+    for(j = i; j > 0 && more(&after[t], &after[order[j-1]]); j--)
+      order[j] = order[j-1];
+    order[j] = t;
+      58:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  for(i = 0; i < n; i++){
+      5b:	83 45 e4 10          	addl   $0x10,-0x1c(%ebp)
+      5f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    order[j] = t;
+      62:	89 1c 85 20 2f 00 00 	mov    %ebx,0x2f20(,%eax,4)
+  for(i = 0; i < n; i++){
+      69:	89 d8                	mov    %ebx,%eax
+      6b:	83 c3 01             	add    $0x1,%ebx
+      6e:	39 5d dc             	cmp    %ebx,-0x24(%ebp)
+      71:	0f 84 f7 00 00 00    	je     16e <main+0x16e>
+  return a->tothi > b->tothi || (a->tothi == b->tothi && a->totlo > b->totlo);
+      77:	8b 7f 04             	mov    0x4(%edi),%edi
+  for(i = 0; i < n; i++){
+      7a:	89 d8                	mov    %ebx,%eax
+      7c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    for(j = i; j > 0 && more(&after[t], &after[order[j-1]]); j--)
+      7f:	83 e8 01             	sub    $0x1,%eax
+      82:	8b 0c 85 20 2f 00 00 	mov    0x2f20(,%eax,4),%ecx
+  return a->tothi > b->tothi || (a->tothi == b->tothi && a->totlo > b->totlo);
+      89:	89 ca                	mov    %ecx,%edx
+      8b:	c1 e2 04             	shl    $0x4,%edx
+      8e:	8b b2 e8 2f 00 00    	mov    0x2fe8(%edx),%esi
+      94:	81 c2 e0 2f 00 00    	add    $0x2fe0,%edx
+      9a:	39 fe                	cmp    %edi,%esi
+      9c:	72 12                	jb     b0 <main+0xb0>
+      9e:	39 f7                	cmp    %esi,%edi
+      a0:	75 b6                	jne    58 <main+0x58>
+      a2:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+      a5:	8b 36                	mov    (%esi),%esi
+      a7:	39 72 04             	cmp    %esi,0x4(%edx)
+      aa:	73 ac                	jae    58 <main+0x58>
+      ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      order[j] = order[j-1];
+      b0:	89 0c 85 24 2f 00 00 	mov    %ecx,0x2f24(,%eax,4)
+    for(j = i; j > 0 && more(&after[t], &after[order[j-1]]); j--)
+      b7:	85 c0                	test   %eax,%eax
+      b9:	75 c1                	jne    7c <main+0x7c>
+      bb:	eb 91                	jmp    4e <main+0x4e>
+  if(argc > 2 && strcmp(argv[1], "-p") == 0){
+      bd:	50                   	push   %eax
+      be:	50                   	push   %eax
+      bf:	68 dd 21 00 00       	push   $0x21dd
+      c4:	ff 73 04             	push   0x4(%ebx)
+      c7:	e8 14 05 00 00       	call   5e0 <strcmp>
+      cc:	83 c4 10             	add    $0x10,%esp
+      cf:	85 c0                	test   %eax,%eax
+      d1:	0f 84 94 02 00 00    	je     36b <main+0x36b>
+      nbefore = scstat(0, before, NSCSTAT);
+      d7:	50                   	push   %eax
+      d8:	6a 30                	push   $0x30
+      da:	68 e0 32 00 00       	push   $0x32e0
+      df:	6a 00                	push   $0x0
+      e1:	e8 fc 09 00 00       	call   ae2 <scstat>
+      e6:	89 c6                	mov    %eax,%esi
+      pid = fork();
+      e8:	e8 43 04 00 00       	call   530 <fork>
+      if(pid < 0){
+      ed:	83 c4 10             	add    $0x10,%esp
+      f0:	85 c0                	test   %eax,%eax
+      f2:	0f 88 60 02 00 00    	js     358 <main+0x358>
+      if(pid == 0){
+      f8:	0f 84 35 02 00 00    	je     333 <main+0x333>
+      wait();
+      fe:	e8 e1 07 00 00       	call   8e4 <wait>
+    n = scstat(0, after, NSCSTAT);
+     103:	53                   	push   %ebx
+     104:	6a 30                	push   $0x30
+     106:	68 e0 2f 00 00       	push   $0x2fe0
+     10b:	6a 00                	push   $0x0
+     10d:	e8 d0 09 00 00       	call   ae2 <scstat>
+  for(i = 0; i < nbefore; i++){
+     112:	83 c4 10             	add    $0x10,%esp
+    n = scstat(0, after, NSCSTAT);
+     115:	89 c2                	mov    %eax,%edx
+  for(i = 0; i < nbefore; i++){
+     117:	85 f6                	test   %esi,%esi
+     119:	0f 8e 1b ff ff ff    	jle    3a <main+0x3a>
+     11f:	c1 e6 04             	shl    $0x4,%esi
+     122:	31 c0                	xor    %eax,%eax
+     124:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    after[i].count -= before[i].count;
+     128:	8b 88 e0 2f 00 00    	mov    0x2fe0(%eax),%ecx
+     12e:	2b 88 e0 32 00 00    	sub    0x32e0(%eax),%ecx
+    after[i].tothi -= before[i].tothi + (after[i].totlo < before[i].totlo);
+     134:	8b 98 e4 32 00 00    	mov    0x32e4(%eax),%ebx
+    after[i].count -= before[i].count;
+     13a:	89 88 e0 2f 00 00    	mov    %ecx,0x2fe0(%eax)
+    after[i].tothi -= before[i].tothi + (after[i].totlo < before[i].totlo);
+     140:	8b 88 e4 2f 00 00    	mov    0x2fe4(%eax),%ecx
+     146:	8b b8 e8 2f 00 00    	mov    0x2fe8(%eax),%edi
+     14c:	39 d9                	cmp    %ebx,%ecx
+     14e:	1b b8 e8 32 00 00    	sbb    0x32e8(%eax),%edi
+    after[i].totlo -= before[i].totlo;
+     154:	29 d9                	sub    %ebx,%ecx
+  for(i = 0; i < nbefore; i++){
+     156:	83 c0 10             	add    $0x10,%eax
+    after[i].tothi -= before[i].tothi + (after[i].totlo < before[i].totlo);
+     159:	89 b8 d8 2f 00 00    	mov    %edi,0x2fd8(%eax)
+    after[i].totlo -= before[i].totlo;
+     15f:	89 88 d4 2f 00 00    	mov    %ecx,0x2fd4(%eax)
+  for(i = 0; i < nbefore; i++){
+     165:	39 c6                	cmp    %eax,%esi
+     167:	75 bf                	jne    128 <main+0x128>
+     169:	e9 cc fe ff ff       	jmp    3a <main+0x3a>
+  }
+
+  pad("syscall", 12);
+     16e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     171:	53                   	push   %ebx
+     172:	53                   	push   %ebx
+     173:	6a 0c                	push   $0xc
+     175:	68 24 22 00 00       	push   $0x2224
+     17a:	e8 31 02 00 00       	call   3b0 <pad>
+  printf(1, "      calls      total        avg        max\n");
+     17f:	5e                   	pop    %esi
+     180:	5f                   	pop    %edi
+     181:	68 04 23 00 00       	push   $0x2304
+     186:	6a 01                	push   $0x1
+  for(i = 0; i < n; i++){
+     188:	31 ff                	xor    %edi,%edi
+  printf(1, "      calls      total        avg        max\n");
+     18a:	e8 c1 0b 00 00       	call   d50 <printf>
+     18f:	83 c4 10             	add    $0x10,%esp
+     192:	eb 5e                	jmp    1f2 <main+0x1f2>
+     194:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    cycles(0, s->count, 10);
+    printf(1, " ");
+    cycles(s->tothi, s->totlo, 10);
+    printf(1, " ");
+    if(s->tothi == 0)
+      cycles(0, s->totlo / s->count, 10);
+     198:	83 ec 04             	sub    $0x4,%esp
+     19b:	31 d2                	xor    %edx,%edx
+     19d:	6a 0a                	push   $0xa
+     19f:	8b 46 04             	mov    0x4(%esi),%eax
+     1a2:	f7 36                	divl   (%esi)
+     1a4:	50                   	push   %eax
+     1a5:	6a 00                	push   $0x0
+     1a7:	e8 54 02 00 00       	call   400 <cycles>
+     1ac:	83 c4 10             	add    $0x10,%esp
+    else {
+      k = (s->tothi << 22 | s->totlo >> 10) / s->count;
+      cycles(k >> 22, k << 10, 10);
+    }
+    printf(1, " ");
+     1af:	83 ec 08             	sub    $0x8,%esp
+    cycles(0, s->max, 10);
+     1b2:	c1 e3 04             	shl    $0x4,%ebx
+    printf(1, " ");
+     1b5:	68 db 21 00 00       	push   $0x21db
+     1ba:	6a 01                	push   $0x1
+     1bc:	e8 8f 0b 00 00       	call   d50 <printf>
+    cycles(0, s->max, 10);
+     1c1:	83 c4 0c             	add    $0xc,%esp
+     1c4:	6a 0a                	push   $0xa
+     1c6:	ff b3 ec 2f 00 00    	push   0x2fec(%ebx)
+     1cc:	6a 00                	push   $0x0
+     1ce:	e8 2d 02 00 00       	call   400 <cycles>
+    printf(1, "\n");
+     1d3:	58                   	pop    %eax
+     1d4:	5a                   	pop    %edx
+     1d5:	68 0a 22 00 00       	push   $0x220a
+     1da:	6a 01                	push   $0x1
+     1dc:	e8 6f 0b 00 00       	call   d50 <printf>
+     1e1:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++){
+     1e4:	8d 47 01             	lea    0x1(%edi),%eax
+     1e7:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+     1ea:	0f 84 3e 01 00 00    	je     32e <main+0x32e>
+     1f0:	89 c7                	mov    %eax,%edi
+    s = &after[order[i]];
+     1f2:	8b 1c bd 20 2f 00 00 	mov    0x2f20(,%edi,4),%ebx
+    if(s->count == 0)
+     1f9:	89 d8                	mov    %ebx,%eax
+     1fb:	c1 e0 04             	shl    $0x4,%eax
+     1fe:	8b 88 e0 2f 00 00    	mov    0x2fe0(%eax),%ecx
+     204:	85 c9                	test   %ecx,%ecx
+     206:	74 dc                	je     1e4 <main+0x1e4>
+    if(order[i] < sizeof(names)/sizeof(names[0]) && names[order[i]])
+     208:	83 fb 26             	cmp    $0x26,%ebx
+     20b:	0f 87 af 00 00 00    	ja     2c0 <main+0x2c0>
+     211:	8b 04 9d a0 2d 00 00 	mov    0x2da0(,%ebx,4),%eax
+     218:	85 c0                	test   %eax,%eax
+     21a:	0f 84 a0 00 00 00    	je     2c0 <main+0x2c0>
+      pad(names[order[i]], 12);
+     220:	83 ec 08             	sub    $0x8,%esp
+     223:	6a 0c                	push   $0xc
+     225:	50                   	push   %eax
+     226:	e8 85 01 00 00       	call   3b0 <pad>
+     22b:	83 c4 10             	add    $0x10,%esp
+    printf(1, " ");
+     22e:	83 ec 08             	sub    $0x8,%esp
+     231:	68 db 21 00 00       	push   $0x21db
+     236:	6a 01                	push   $0x1
+     238:	e8 13 0b 00 00       	call   d50 <printf>
+    cycles(0, s->count, 10);
+     23d:	89 d8                	mov    %ebx,%eax
+     23f:	83 c4 0c             	add    $0xc,%esp
+     242:	c1 e0 04             	shl    $0x4,%eax
+     245:	6a 0a                	push   $0xa
+     247:	ff b0 e0 2f 00 00    	push   0x2fe0(%eax)
+     24d:	8d b0 e0 2f 00 00    	lea    0x2fe0(%eax),%esi
+     253:	6a 00                	push   $0x0
+     255:	e8 a6 01 00 00       	call   400 <cycles>
+    printf(1, " ");
+     25a:	59                   	pop    %ecx
+     25b:	58                   	pop    %eax
+     25c:	68 db 21 00 00       	push   $0x21db
+     261:	6a 01                	push   $0x1
+     263:	e8 e8 0a 00 00       	call   d50 <printf>
+    cycles(s->tothi, s->totlo, 10);
+     268:	83 c4 0c             	add    $0xc,%esp
+     26b:	6a 0a                	push   $0xa
+     26d:	ff 76 04             	push   0x4(%esi)
+     270:	ff 76 08             	push   0x8(%esi)
+     273:	e8 88 01 00 00       	call   400 <cycles>
+    printf(1, " ");
+     278:	58                   	pop    %eax
+     279:	5a                   	pop    %edx
+     27a:	68 db 21 00 00       	push   $0x21db
+     27f:	6a 01                	push   $0x1
+     281:	e8 ca 0a 00 00       	call   d50 <printf>
+    if(s->tothi == 0)
+     286:	8b 4e 08             	mov    0x8(%esi),%ecx
+     289:	83 c4 10             	add    $0x10,%esp
+     28c:	85 c9                	test   %ecx,%ecx
+     28e:	0f 84 04 ff ff ff    	je     198 <main+0x198>
+      k = (s->tothi << 22 | s->totlo >> 10) / s->count;
+     294:	8b 46 04             	mov    0x4(%esi),%eax
+     297:	c1 e1 16             	shl    $0x16,%ecx
+     29a:	31 d2                	xor    %edx,%edx
+      cycles(k >> 22, k << 10, 10);
+     29c:	83 ec 04             	sub    $0x4,%esp
+      k = (s->tothi << 22 | s->totlo >> 10) / s->count;
+     29f:	c1 e8 0a             	shr    $0xa,%eax
+     2a2:	09 c8                	or     %ecx,%eax
+     2a4:	f7 36                	divl   (%esi)
+      cycles(k >> 22, k << 10, 10);
+     2a6:	6a 0a                	push   $0xa
+     2a8:	89 c2                	mov    %eax,%edx
+     2aa:	c1 e8 16             	shr    $0x16,%eax
+     2ad:	c1 e2 0a             	shl    $0xa,%edx
+     2b0:	52                   	push   %edx
+     2b1:	50                   	push   %eax
+     2b2:	e8 49 01 00 00       	call   400 <cycles>
+     2b7:	83 c4 10             	add    $0x10,%esp
+     2ba:	e9 f0 fe ff ff       	jmp    1af <main+0x1af>
+     2bf:	90                   	nop
+  printf(1, "%s", s);
+     2c0:	83 ec 04             	sub    $0x4,%esp
+     2c3:	68 2c 22 00 00       	push   $0x222c
+     2c8:	68 d8 21 00 00       	push   $0x21d8
+     2cd:	6a 01                	push   $0x1
+     2cf:	e8 7c 0a 00 00       	call   d50 <printf>
+  for(n = strlen(s); n < w; n++)
+     2d4:	c7 04 24 2c 22 00 00 	movl   $0x222c,(%esp)
+     2db:	e8 60 03 00 00       	call   640 <strlen>
+     2e0:	83 c4 10             	add    $0x10,%esp
+     2e3:	89 c6                	mov    %eax,%esi
+     2e5:	83 f8 0b             	cmp    $0xb,%eax
+     2e8:	0f 8f 40 ff ff ff    	jg     22e <main+0x22e>
+     2ee:	66 90                	xchg   %ax,%ax
+    printf(1, " ");
+     2f0:	83 ec 08             	sub    $0x8,%esp
+  for(n = strlen(s); n < w; n++)
+     2f3:	83 c6 01             	add    $0x1,%esi
+    printf(1, " ");
+     2f6:	68 db 21 00 00       	push   $0x21db
+     2fb:	6a 01                	push   $0x1
+     2fd:	e8 4e 0a 00 00       	call   d50 <printf>
+  for(n = strlen(s); n < w; n++)
+     302:	83 c4 10             	add    $0x10,%esp
+     305:	83 fe 0c             	cmp    $0xc,%esi
+     308:	75 e6                	jne    2f0 <main+0x2f0>
+     30a:	e9 1f ff ff ff       	jmp    22e <main+0x22e>
+  pad("syscall", 12);
+     30f:	50                   	push   %eax
+     310:	50                   	push   %eax
+     311:	6a 0c                	push   $0xc
+     313:	68 24 22 00 00       	push   $0x2224
+     318:	e8 93 00 00 00       	call   3b0 <pad>
+  printf(1, "      calls      total        avg        max\n");
+     31d:	58                   	pop    %eax
+     31e:	5a                   	pop    %edx
+     31f:	68 04 23 00 00       	push   $0x2304
+     324:	6a 01                	push   $0x1
+     326:	e8 25 0a 00 00       	call   d50 <printf>
+     32b:	83 c4 10             	add    $0x10,%esp
+  }
+  exit();
+     32e:	e8 5d 02 00 00       	call   590 <exit>
+        exec(argv[1], argv+1);
+     333:	8d 43 04             	lea    0x4(%ebx),%eax
+     336:	56                   	push   %esi
+     337:	56                   	push   %esi
+     338:	50                   	push   %eax
+     339:	ff 73 04             	push   0x4(%ebx)
+     33c:	e8 1f 02 00 00       	call   560 <exec>
+        printf(2, "scstat: exec %s failed\n", argv[1]);
+     341:	83 c4 0c             	add    $0xc,%esp
+     344:	ff 73 04             	push   0x4(%ebx)
+     347:	68 0c 22 00 00       	push   $0x220c
+     34c:	6a 02                	push   $0x2
+     34e:	e8 fd 09 00 00       	call   d50 <printf>
+        exit();
+     353:	e8 38 02 00 00       	call   590 <exit>
+        printf(2, "scstat: fork failed\n");
+     358:	57                   	push   %edi
+     359:	57                   	push   %edi
+     35a:	68 f7 21 00 00       	push   $0x21f7
+     35f:	6a 02                	push   $0x2
+     361:	e8 ea 09 00 00       	call   d50 <printf>
+        exit();
+     366:	e8 25 02 00 00       	call   590 <exit>
+    if((n = scstat(atoi(argv[2]), after, NSCSTAT)) < 0){
+     36b:	83 ec 0c             	sub    $0xc,%esp
+     36e:	ff 73 08             	push   0x8(%ebx)
+     371:	e8 aa 03 00 00       	call   720 <atoi>
+     376:	83 c4 0c             	add    $0xc,%esp
+     379:	6a 30                	push   $0x30
+     37b:	68 e0 2f 00 00       	push   $0x2fe0
+     380:	50                   	push   %eax
+     381:	e8 5c 07 00 00       	call   ae2 <scstat>
+     386:	83 c4 10             	add    $0x10,%esp
+     389:	89 c2                	mov    %eax,%edx
+     38b:	85 c0                	test   %eax,%eax
+     38d:	0f 89 a7 fc ff ff    	jns    3a <main+0x3a>
+      printf(2, "scstat: no process %s\n", argv[2]);
+     393:	50                   	push   %eax
+     394:	ff 73 08             	push   0x8(%ebx)
+     397:	68 e0 21 00 00       	push   $0x21e0
+     39c:	6a 02                	push   $0x2
+     39e:	e8 ad 09 00 00       	call   d50 <printf>
+      exit();
+     3a3:	e8 e8 01 00 00       	call   590 <exit>
+     3a8:	66 90                	xchg   %ax,%ax
+     3aa:	66 90                	xchg   %ax,%ax
+     3ac:	66 90                	xchg   %ax,%ax
+     3ae:	66 90                	xchg   %ax,%ax
+
+000003b0 <pad>:
+{
+     3b0:	55                   	push   %ebp
+     3b1:	89 e5                	mov    %esp,%ebp
+     3b3:	56                   	push   %esi
+     3b4:	53                   	push   %ebx
+     3b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     3b8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(1, "%s", s);
+     3bb:	83 ec 04             	sub    $0x4,%esp
+     3be:	53                   	push   %ebx
+     3bf:	68 d8 21 00 00       	push   $0x21d8
+     3c4:	6a 01                	push   $0x1
+     3c6:	e8 85 09 00 00       	call   d50 <printf>
+  for(n = strlen(s); n < w; n++)
+     3cb:	89 1c 24             	mov    %ebx,(%esp)
+     3ce:	e8 6d 02 00 00       	call   640 <strlen>
+     3d3:	83 c4 10             	add    $0x10,%esp
+     3d6:	39 f0                	cmp    %esi,%eax
+     3d8:	7d 1f                	jge    3f9 <pad+0x49>
+     3da:	89 c3                	mov    %eax,%ebx
+     3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, " ");
+     3e0:	83 ec 08             	sub    $0x8,%esp
+  for(n = strlen(s); n < w; n++)
+     3e3:	83 c3 01             	add    $0x1,%ebx
+    printf(1, " ");
+     3e6:	68 db 21 00 00       	push   $0x21db
+     3eb:	6a 01                	push   $0x1
+     3ed:	e8 5e 09 00 00       	call   d50 <printf>
+  for(n = strlen(s); n < w; n++)
+     3f2:	83 c4 10             	add    $0x10,%esp
+     3f5:	39 de                	cmp    %ebx,%esi
+     3f7:	75 e7                	jne    3e0 <pad+0x30>
+}
+     3f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     3fc:	5b                   	pop    %ebx
+     3fd:	5e                   	pop    %esi
+     3fe:	5d                   	pop    %ebp
+     3ff:	c3                   	ret
+
+00000400 <cycles>:
+{
+     400:	55                   	push   %ebp
+     401:	89 e5                	mov    %esp,%ebp
+     403:	57                   	push   %edi
+     404:	56                   	push   %esi
+     405:	53                   	push   %ebx
+     406:	83 ec 1c             	sub    $0x1c,%esp
+     409:	8b 55 08             	mov    0x8(%ebp),%edx
+     40c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     40f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(hi == 0 && lo < 100000000)
+     412:	85 d2                	test   %edx,%edx
+     414:	0f 85 9e 00 00 00    	jne    4b8 <cycles+0xb8>
+     41a:	3d ff e0 f5 05       	cmp    $0x5f5e0ff,%eax
+     41f:	0f 87 93 00 00 00    	ja     4b8 <cycles+0xb8>
+  buf[--i] = 0;
+     425:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+    v = lo;
+     429:	89 c6                	mov    %eax,%esi
+  buf[--i] = 0;
+     42b:	bb 0f 00 00 00       	mov    $0xf,%ebx
+    buf[--i] = '0' + v % 10;
+     430:	89 7d 10             	mov    %edi,0x10(%ebp)
+     433:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+     438:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     43f:	90                   	nop
+     440:	89 f0                	mov    %esi,%eax
+     442:	83 eb 01             	sub    $0x1,%ebx
+     445:	f7 e1                	mul    %ecx
+     447:	89 f0                	mov    %esi,%eax
+     449:	c1 ea 03             	shr    $0x3,%edx
+     44c:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+     44f:	01 ff                	add    %edi,%edi
+     451:	29 f8                	sub    %edi,%eax
+     453:	83 c0 30             	add    $0x30,%eax
+     456:	88 44 1d d8          	mov    %al,-0x28(%ebp,%ebx,1)
+    v /= 10;
+     45a:	89 f0                	mov    %esi,%eax
+     45c:	89 d6                	mov    %edx,%esi
+  } while(v != 0);
+     45e:	83 f8 09             	cmp    $0x9,%eax
+     461:	77 dd                	ja     440 <cycles+0x40>
+  for(n = sizeof(buf) - 1 - i; n < w; n++)
+     463:	be 0f 00 00 00       	mov    $0xf,%esi
+     468:	8b 7d 10             	mov    0x10(%ebp),%edi
+     46b:	29 de                	sub    %ebx,%esi
+     46d:	39 fe                	cmp    %edi,%esi
+     46f:	7d 20                	jge    491 <cycles+0x91>
+     471:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, " ");
+     478:	83 ec 08             	sub    $0x8,%esp
+  for(n = sizeof(buf) - 1 - i; n < w; n++)
+     47b:	83 c6 01             	add    $0x1,%esi
+    printf(1, " ");
+     47e:	68 db 21 00 00       	push   $0x21db
+     483:	6a 01                	push   $0x1
+     485:	e8 c6 08 00 00       	call   d50 <printf>
+  for(n = sizeof(buf) - 1 - i; n < w; n++)
+     48a:	83 c4 10             	add    $0x10,%esp
+     48d:	39 f7                	cmp    %esi,%edi
+     48f:	75 e7                	jne    478 <cycles+0x78>
+  printf(1, "%s", buf + i);
+     491:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     494:	83 ec 04             	sub    $0x4,%esp
+     497:	01 d8                	add    %ebx,%eax
+     499:	50                   	push   %eax
+     49a:	68 d8 21 00 00       	push   $0x21d8
+     49f:	6a 01                	push   $0x1
+     4a1:	e8 aa 08 00 00       	call   d50 <printf>
+}
+     4a6:	83 c4 10             	add    $0x10,%esp
+     4a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4ac:	5b                   	pop    %ebx
+     4ad:	5e                   	pop    %esi
+     4ae:	5f                   	pop    %edi
+     4af:	5d                   	pop    %ebp
+     4b0:	c3                   	ret
+     4b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    v = hi << 22 | lo >> 10;
+     4b8:	89 d6                	mov    %edx,%esi
+     4ba:	89 c1                	mov    %eax,%ecx
+  buf[--i] = 0;
+     4bc:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+    v = hi << 22 | lo >> 10;
+     4c0:	c1 e6 16             	shl    $0x16,%esi
+     4c3:	c1 e9 0a             	shr    $0xa,%ecx
+     4c6:	09 ce                	or     %ecx,%esi
+  if(v != lo || hi != 0)
+     4c8:	39 f0                	cmp    %esi,%eax
+     4ca:	75 0d                	jne    4d9 <cycles+0xd9>
+  buf[--i] = 0;
+     4cc:	bb 0f 00 00 00       	mov    $0xf,%ebx
+  if(v != lo || hi != 0)
+     4d1:	85 d2                	test   %edx,%edx
+     4d3:	0f 84 57 ff ff ff    	je     430 <cycles+0x30>
+    buf[--i] = 'K';
+     4d9:	c6 45 e6 4b          	movb   $0x4b,-0x1a(%ebp)
+     4dd:	bb 0e 00 00 00       	mov    $0xe,%ebx
+     4e2:	e9 49 ff ff ff       	jmp    430 <cycles+0x30>
+     4e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ee:	66 90                	xchg   %ax,%ax
+
+000004f0 <more>:
+{
+     4f0:	55                   	push   %ebp
+  return a->tothi > b->tothi || (a->tothi == b->tothi && a->totlo > b->totlo);
+     4f1:	b8 01 00 00 00       	mov    $0x1,%eax
+{
+     4f6:	89 e5                	mov    %esp,%ebp
+     4f8:	56                   	push   %esi
+     4f9:	53                   	push   %ebx
+     4fa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     4fd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  return a->tothi > b->tothi || (a->tothi == b->tothi && a->totlo > b->totlo);
+     500:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     503:	8b 56 08             	mov    0x8(%esi),%edx
+     506:	39 ca                	cmp    %ecx,%edx
+     508:	72 06                	jb     510 <more+0x20>
+     50a:	31 c0                	xor    %eax,%eax
+     50c:	39 d1                	cmp    %edx,%ecx
+     50e:	74 08                	je     518 <more+0x28>
+}
+     510:	5b                   	pop    %ebx
+     511:	5e                   	pop    %esi
+     512:	5d                   	pop    %ebp
+     513:	c3                   	ret
+     514:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return a->tothi > b->tothi || (a->tothi == b->tothi && a->totlo > b->totlo);
+     518:	8b 43 04             	mov    0x4(%ebx),%eax
+     51b:	39 46 04             	cmp    %eax,0x4(%esi)
+     51e:	0f 92 c0             	setb   %al
+}
+     521:	5b                   	pop    %ebx
+     522:	5e                   	pop    %esi
+  return a->tothi > b->tothi || (a->tothi == b->tothi && a->totlo > b->totlo);
+     523:	0f b6 c0             	movzbl %al,%eax
+}
+     526:	5d                   	pop    %ebp
+     527:	c3                   	ret
+     528:	66 90                	xchg   %ax,%ax
+     52a:	66 90                	xchg   %ax,%ax
+     52c:	66 90                	xchg   %ax,%ax
+     52e:	66 90                	xchg   %ax,%ax
+
+00000530 <fork>:
+int sysexit(void) __attribute__((noreturn));
+
+int
+fork(void)
+{
+  if(flushhook)
+     530:	a1 e0 35 00 00       	mov    0x35e0,%eax
+     535:	85 c0                	test   %eax,%eax
+     537:	74 17                	je     550 <fork+0x20>
+{
+     539:	55                   	push   %ebp
+     53a:	89 e5                	mov    %esp,%ebp
+     53c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     53f:	ff d0                	call   *%eax
+  return sysfork();
+}
+     541:	c9                   	leave
+  return sysfork();
+     542:	e9 7f 03 00 00       	jmp    8c6 <sysfork>
+     547:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     54e:	66 90                	xchg   %ax,%ax
+     550:	e9 71 03 00 00       	jmp    8c6 <sysfork>
+     555:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     55c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000560 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+     560:	55                   	push   %ebp
+  if(flushhook)
+     561:	a1 e0 35 00 00       	mov    0x35e0,%eax
+{
+     566:	89 e5                	mov    %esp,%ebp
+     568:	56                   	push   %esi
+     569:	53                   	push   %ebx
+     56a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     56d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     570:	85 c0                	test   %eax,%eax
+     572:	74 02                	je     576 <exec+0x16>
+    flushhook();
+     574:	ff d0                	call   *%eax
+  return sysexec(path, argv);
+     576:	89 75 0c             	mov    %esi,0xc(%ebp)
+     579:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     57c:	5b                   	pop    %ebx
+     57d:	5e                   	pop    %esi
+     57e:	5d                   	pop    %ebp
+  return sysexec(path, argv);
+     57f:	e9 ba 03 00 00       	jmp    93e <sysexec>
+     584:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     58b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     58f:	90                   	nop
+
+00000590 <exit>:
+
+int
+exit(void)
+{
+     590:	55                   	push   %ebp
+     591:	89 e5                	mov    %esp,%ebp
+     593:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     596:	a1 e0 35 00 00       	mov    0x35e0,%eax
+     59b:	85 c0                	test   %eax,%eax
+     59d:	74 02                	je     5a1 <exit+0x11>
+    flushhook();
+     59f:	ff d0                	call   *%eax
+  sysexit();
+     5a1:	e8 2f 03 00 00       	call   8d5 <sysexit>
+     5a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005b0 <strcpy>:
+}
+
+char*
+strcpy(char *s, const char *t)
+{
+     5b0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     5b1:	31 c0                	xor    %eax,%eax
+{
+     5b3:	89 e5                	mov    %esp,%ebp
+     5b5:	53                   	push   %ebx
+     5b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     5b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     5bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     5c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     5c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     5c7:	83 c0 01             	add    $0x1,%eax
+     5ca:	84 d2                	test   %dl,%dl
+     5cc:	75 f2                	jne    5c0 <strcpy+0x10>
+    ;
+  return os;
+}
+     5ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5d1:	89 c8                	mov    %ecx,%eax
+     5d3:	c9                   	leave
+     5d4:	c3                   	ret
+     5d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     5e0:	55                   	push   %ebp
+     5e1:	89 e5                	mov    %esp,%ebp
+     5e3:	53                   	push   %ebx
+     5e4:	8b 55 08             	mov    0x8(%ebp),%edx
+     5e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     5ea:	0f b6 02             	movzbl (%edx),%eax
+     5ed:	84 c0                	test   %al,%al
+     5ef:	75 17                	jne    608 <strcmp+0x28>
+     5f1:	eb 3a                	jmp    62d <strcmp+0x4d>
+     5f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5f7:	90                   	nop
+     5f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     5fc:	83 c2 01             	add    $0x1,%edx
+     5ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     602:	84 c0                	test   %al,%al
+     604:	74 1a                	je     620 <strcmp+0x40>
+    p++, q++;
+     606:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     608:	0f b6 19             	movzbl (%ecx),%ebx
+     60b:	38 c3                	cmp    %al,%bl
+     60d:	74 e9                	je     5f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     60f:	29 d8                	sub    %ebx,%eax
+}
+     611:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     614:	c9                   	leave
+     615:	c3                   	ret
+     616:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     61d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     620:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     624:	31 c0                	xor    %eax,%eax
+     626:	29 d8                	sub    %ebx,%eax
+}
+     628:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     62b:	c9                   	leave
+     62c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     62d:	0f b6 19             	movzbl (%ecx),%ebx
+     630:	31 c0                	xor    %eax,%eax
+     632:	eb db                	jmp    60f <strcmp+0x2f>
+     634:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     63b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     63f:	90                   	nop
+
+00000640 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     640:	55                   	push   %ebp
+     641:	89 e5                	mov    %esp,%ebp
+     643:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     646:	80 3a 00             	cmpb   $0x0,(%edx)
+     649:	74 15                	je     660 <strlen+0x20>
+     64b:	31 c0                	xor    %eax,%eax
+     64d:	8d 76 00             	lea    0x0(%esi),%esi
+     650:	83 c0 01             	add    $0x1,%eax
+     653:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     657:	89 c1                	mov    %eax,%ecx
+     659:	75 f5                	jne    650 <strlen+0x10>
+    ;
+  return n;
+}
+     65b:	89 c8                	mov    %ecx,%eax
+     65d:	5d                   	pop    %ebp
+     65e:	c3                   	ret
+     65f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     660:	31 c9                	xor    %ecx,%ecx
+}
+     662:	5d                   	pop    %ebp
+     663:	89 c8                	mov    %ecx,%eax
+     665:	c3                   	ret
+     666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     66d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000670 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     670:	55                   	push   %ebp
+     671:	89 e5                	mov    %esp,%ebp
+     673:	57                   	push   %edi
+     674:	8b 55 08             	mov    0x8(%ebp),%edx
+            "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt) {
+    asm volatile("cld; rep stosb" :
+     677:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     67a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     67d:	89 d7                	mov    %edx,%edi
+     67f:	fc                   	cld
+     680:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     682:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     685:	89 d0                	mov    %edx,%eax
+     687:	c9                   	leave
+     688:	c3                   	ret
+     689:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000690 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     690:	55                   	push   %ebp
+     691:	89 e5                	mov    %esp,%ebp
+     693:	8b 45 08             	mov    0x8(%ebp),%eax
+     696:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     69a:	0f b6 10             	movzbl (%eax),%edx
+     69d:	84 d2                	test   %dl,%dl
+     69f:	75 12                	jne    6b3 <strchr+0x23>
+     6a1:	eb 1d                	jmp    6c0 <strchr+0x30>
+     6a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6a7:	90                   	nop
+     6a8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     6ac:	83 c0 01             	add    $0x1,%eax
+     6af:	84 d2                	test   %dl,%dl
+     6b1:	74 0d                	je     6c0 <strchr+0x30>
+    if(*s == c)
+     6b3:	38 d1                	cmp    %dl,%cl
+     6b5:	75 f1                	jne    6a8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     6b7:	5d                   	pop    %ebp
+     6b8:	c3                   	ret
+     6b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     6c0:	31 c0                	xor    %eax,%eax
+}
+     6c2:	5d                   	pop    %ebp
+     6c3:	c3                   	ret
+     6c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6cf:	90                   	nop
+
+000006d0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     6d0:	55                   	push   %ebp
+     6d1:	89 e5                	mov    %esp,%ebp
+     6d3:	56                   	push   %esi
+     6d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     6d5:	83 ec 08             	sub    $0x8,%esp
+     6d8:	6a 00                	push   $0x0
+     6da:	ff 75 08             	push   0x8(%ebp)
+     6dd:	e8 6b 02 00 00       	call   94d <open>
+  if(fd < 0)
+     6e2:	83 c4 10             	add    $0x10,%esp
+     6e5:	85 c0                	test   %eax,%eax
+     6e7:	78 27                	js     710 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     6e9:	83 ec 08             	sub    $0x8,%esp
+     6ec:	ff 75 0c             	push   0xc(%ebp)
+     6ef:	89 c3                	mov    %eax,%ebx
+     6f1:	50                   	push   %eax
+     6f2:	e8 83 02 00 00       	call   97a <fstat>
+  close(fd);
+     6f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     6fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+     6fc:	e8 1f 02 00 00       	call   920 <close>
+  return r;
+     701:	83 c4 10             	add    $0x10,%esp
+}
+     704:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     707:	89 f0                	mov    %esi,%eax
+     709:	5b                   	pop    %ebx
+     70a:	5e                   	pop    %esi
+     70b:	5d                   	pop    %ebp
+     70c:	c3                   	ret
+     70d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     710:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     715:	eb ed                	jmp    704 <stat+0x34>
+     717:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     71e:	66 90                	xchg   %ax,%ax
+
+00000720 <atoi>:
+
+int
+atoi(const char *s)
+{
+     720:	55                   	push   %ebp
+     721:	89 e5                	mov    %esp,%ebp
+     723:	53                   	push   %ebx
+     724:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     727:	0f be 02             	movsbl (%edx),%eax
+     72a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     72d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     730:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     735:	77 1e                	ja     755 <atoi+0x35>
+     737:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     73e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     740:	83 c2 01             	add    $0x1,%edx
+     743:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     746:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     74a:	0f be 02             	movsbl (%edx),%eax
+     74d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     750:	80 fb 09             	cmp    $0x9,%bl
+     753:	76 eb                	jbe    740 <atoi+0x20>
+  return n;
+}
+     755:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     758:	89 c8                	mov    %ecx,%eax
+     75a:	c9                   	leave
+     75b:	c3                   	ret
+     75c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000760 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     760:	55                   	push   %ebp
+     761:	89 e5                	mov    %esp,%ebp
+     763:	57                   	push   %edi
+     764:	56                   	push   %esi
+     765:	8b 45 10             	mov    0x10(%ebp),%eax
+     768:	8b 55 08             	mov    0x8(%ebp),%edx
+     76b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     76e:	85 c0                	test   %eax,%eax
+     770:	7e 13                	jle    785 <memmove+0x25>
+     772:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     774:	89 d7                	mov    %edx,%edi
+     776:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     77d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     780:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     781:	39 f8                	cmp    %edi,%eax
+     783:	75 fb                	jne    780 <memmove+0x20>
+  return vdst;
+}
+     785:	5e                   	pop    %esi
+     786:	89 d0                	mov    %edx,%eax
+     788:	5f                   	pop    %edi
+     789:	5d                   	pop    %ebp
+     78a:	c3                   	ret
+     78b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     78f:	90                   	nop
+
+00000790 <mutex_init>:
+
+// Futex-based mutex (Drepper, "Futexes Are Tricky", mutex 2).
+// The uncontended paths never enter the kernel.
+void
+mutex_init(struct mutex *m)
+{
+     790:	55                   	push   %ebp
+     791:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+     793:	8b 45 08             	mov    0x8(%ebp),%eax
+     796:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     79c:	5d                   	pop    %ebp
+     79d:	c3                   	ret
+     79e:	66 90                	xchg   %ax,%ax
+
+000007a0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     7a0:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     7a1:	31 c0                	xor    %eax,%eax
+     7a3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+     7a8:	89 e5                	mov    %esp,%ebp
+     7aa:	56                   	push   %esi
+     7ab:	53                   	push   %ebx
+     7ac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     7af:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     7b3:	85 c0                	test   %eax,%eax
+     7b5:	74 32                	je     7e9 <mutex_lock+0x49>
+    return;
+  if(c != 2)
+     7b7:	83 f8 02             	cmp    $0x2,%eax
+     7ba:	74 0c                	je     7c8 <mutex_lock+0x28>
+static inline uint
+xchg(volatile uint *addr, uint newval) {
+    uint result;
+
+    // The + in "+m" denotes a read-modify-write operand.
+    asm volatile("lock; xchgl %0, %1" :
+     7bc:	b8 02 00 00 00       	mov    $0x2,%eax
+     7c1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+     7c4:	85 c0                	test   %eax,%eax
+     7c6:	74 21                	je     7e9 <mutex_lock+0x49>
+     7c8:	be 02 00 00 00       	mov    $0x2,%esi
+     7cd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAIT, 2);
+     7d0:	83 ec 04             	sub    $0x4,%esp
+     7d3:	6a 02                	push   $0x2
+     7d5:	6a 00                	push   $0x0
+     7d7:	53                   	push   %ebx
+     7d8:	e8 33 02 00 00       	call   a10 <futex>
+     7dd:	89 f0                	mov    %esi,%eax
+     7df:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     7e2:	83 c4 10             	add    $0x10,%esp
+     7e5:	85 c0                	test   %eax,%eax
+     7e7:	75 e7                	jne    7d0 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+     7e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     7ec:	5b                   	pop    %ebx
+     7ed:	5e                   	pop    %esi
+     7ee:	5d                   	pop    %ebp
+     7ef:	c3                   	ret
+
+000007f0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     7f0:	55                   	push   %ebp
+     7f1:	89 e5                	mov    %esp,%ebp
+     7f3:	83 ec 08             	sub    $0x8,%esp
+     7f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     7f9:	f0 83 28 01          	lock subl $0x1,(%eax)
+     7fd:	75 09                	jne    808 <mutex_unlock+0x18>
+    m->val = 0;
+    futex(&m->val, FUTEX_WAKE, 1);
+  }
+}
+     7ff:	c9                   	leave
+     800:	c3                   	ret
+     801:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     808:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     80b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex(&m->val, FUTEX_WAKE, 1);
+     811:	6a 01                	push   $0x1
+     813:	6a 01                	push   $0x1
+     815:	50                   	push   %eax
+     816:	e8 f5 01 00 00       	call   a10 <futex>
+     81b:	83 c4 10             	add    $0x10,%esp
+}
+     81e:	c9                   	leave
+     81f:	c3                   	ret
+
+00000820 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     820:	55                   	push   %ebp
+     821:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     823:	8b 45 08             	mov    0x8(%ebp),%eax
+     826:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     82c:	5d                   	pop    %ebp
+     82d:	c3                   	ret
+     82e:	66 90                	xchg   %ax,%ax
+
+00000830 <cond_wait>:
+
+// Release m and wait for a signal, then reacquire m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     830:	55                   	push   %ebp
+     831:	89 e5                	mov    %esp,%ebp
+     833:	57                   	push   %edi
+     834:	56                   	push   %esi
+     835:	53                   	push   %ebx
+     836:	83 ec 0c             	sub    $0xc,%esp
+     839:	8b 75 08             	mov    0x8(%ebp),%esi
+     83c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     83f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     841:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+     845:	75 21                	jne    868 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     847:	83 ec 04             	sub    $0x4,%esp
+     84a:	57                   	push   %edi
+     84b:	6a 00                	push   $0x0
+     84d:	56                   	push   %esi
+     84e:	e8 bd 01 00 00       	call   a10 <futex>
+  mutex_lock(m);
+     853:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     856:	83 c4 10             	add    $0x10,%esp
+}
+     859:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     85c:	5b                   	pop    %ebx
+     85d:	5e                   	pop    %esi
+     85e:	5f                   	pop    %edi
+     85f:	5d                   	pop    %ebp
+  mutex_lock(m);
+     860:	e9 3b ff ff ff       	jmp    7a0 <mutex_lock>
+     865:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     868:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     86b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex(&m->val, FUTEX_WAKE, 1);
+     871:	6a 01                	push   $0x1
+     873:	6a 01                	push   $0x1
+     875:	53                   	push   %ebx
+     876:	e8 95 01 00 00       	call   a10 <futex>
+     87b:	83 c4 10             	add    $0x10,%esp
+     87e:	eb c7                	jmp    847 <cond_wait+0x17>
+
+00000880 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+     880:	55                   	push   %ebp
+     881:	89 e5                	mov    %esp,%ebp
+     883:	83 ec 0c             	sub    $0xc,%esp
+     886:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     889:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+     88d:	6a 01                	push   $0x1
+     88f:	6a 01                	push   $0x1
+     891:	50                   	push   %eax
+     892:	e8 79 01 00 00       	call   a10 <futex>
+}
+     897:	83 c4 10             	add    $0x10,%esp
+     89a:	c9                   	leave
+     89b:	c3                   	ret
+     89c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008a0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     8a0:	55                   	push   %ebp
+     8a1:	89 e5                	mov    %esp,%ebp
+     8a3:	83 ec 0c             	sub    $0xc,%esp
+     8a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     8a9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+     8ad:	6a 40                	push   $0x40
+     8af:	6a 01                	push   $0x1
+     8b1:	50                   	push   %eax
+     8b2:	e8 59 01 00 00       	call   a10 <futex>
+}
+     8b7:	83 c4 10             	add    $0x10,%esp
+     8ba:	c9                   	leave
+     8bb:	c3                   	ret
+     8bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008c0 <uptime>:
+// Clock ticks since boot, read from the kernel's vdso page
+// without a system call.
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     8c0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+     8c5:	c3                   	ret
+
+000008c6 <sysfork>:
+  1: ret
+
+#define SYSCALL(name) SYSCALLAS(name, name)
+
+// ulib.c wraps these.
+SYSCALLAS(sysfork, fork)
+     8c6:	b8 01 00 00 00       	mov    $0x1,%eax
+     8cb:	89 e1                	mov    %esp,%ecx
+     8cd:	ba d4 08 00 00       	mov    $0x8d4,%edx
+     8d2:	0f 34                	sysenter
+     8d4:	c3                   	ret
+
+000008d5 <sysexit>:
+SYSCALLAS(sysexit, exit)
+     8d5:	b8 02 00 00 00       	mov    $0x2,%eax
+     8da:	89 e1                	mov    %esp,%ecx
+     8dc:	ba e3 08 00 00       	mov    $0x8e3,%edx
+     8e1:	0f 34                	sysenter
+     8e3:	c3                   	ret
+
+000008e4 <wait>:
+SYSCALL(wait)
+     8e4:	b8 03 00 00 00       	mov    $0x3,%eax
+     8e9:	89 e1                	mov    %esp,%ecx
+     8eb:	ba f2 08 00 00       	mov    $0x8f2,%edx
+     8f0:	0f 34                	sysenter
+     8f2:	c3                   	ret
+
+000008f3 <pipe>:
+SYSCALL(pipe)
+     8f3:	b8 04 00 00 00       	mov    $0x4,%eax
+     8f8:	89 e1                	mov    %esp,%ecx
+     8fa:	ba 01 09 00 00       	mov    $0x901,%edx
+     8ff:	0f 34                	sysenter
+     901:	c3                   	ret
+
+00000902 <read>:
+SYSCALL(read)
+     902:	b8 05 00 00 00       	mov    $0x5,%eax
+     907:	89 e1                	mov    %esp,%ecx
+     909:	ba 10 09 00 00       	mov    $0x910,%edx
+     90e:	0f 34                	sysenter
+     910:	c3                   	ret
+
+00000911 <write>:
+SYSCALL(write)
+     911:	b8 10 00 00 00       	mov    $0x10,%eax
+     916:	89 e1                	mov    %esp,%ecx
+     918:	ba 1f 09 00 00       	mov    $0x91f,%edx
+     91d:	0f 34                	sysenter
+     91f:	c3                   	ret
+
+00000920 <close>:
+SYSCALL(close)
+     920:	b8 15 00 00 00       	mov    $0x15,%eax
+     925:	89 e1                	mov    %esp,%ecx
+     927:	ba 2e 09 00 00       	mov    $0x92e,%edx
+     92c:	0f 34                	sysenter
+     92e:	c3                   	ret
+
+0000092f <kill>:
+SYSCALL(kill)
+     92f:	b8 06 00 00 00       	mov    $0x6,%eax
+     934:	89 e1                	mov    %esp,%ecx
+     936:	ba 3d 09 00 00       	mov    $0x93d,%edx
+     93b:	0f 34                	sysenter
+     93d:	c3                   	ret
+
+0000093e <sysexec>:
+SYSCALLAS(sysexec, exec)
+     93e:	b8 07 00 00 00       	mov    $0x7,%eax
+     943:	89 e1                	mov    %esp,%ecx
+     945:	ba 4c 09 00 00       	mov    $0x94c,%edx
+     94a:	0f 34                	sysenter
+     94c:	c3                   	ret
+
+0000094d <open>:
+SYSCALL(open)
+     94d:	b8 0f 00 00 00       	mov    $0xf,%eax
+     952:	89 e1                	mov    %esp,%ecx
+     954:	ba 5b 09 00 00       	mov    $0x95b,%edx
+     959:	0f 34                	sysenter
+     95b:	c3                   	ret
+
+0000095c <mknod>:
+SYSCALL(mknod)
+     95c:	b8 11 00 00 00       	mov    $0x11,%eax
+     961:	89 e1                	mov    %esp,%ecx
+     963:	ba 6a 09 00 00       	mov    $0x96a,%edx
+     968:	0f 34                	sysenter
+     96a:	c3                   	ret
+
+0000096b <unlink>:
+SYSCALL(unlink)
+     96b:	b8 12 00 00 00       	mov    $0x12,%eax
+     970:	89 e1                	mov    %esp,%ecx
+     972:	ba 79 09 00 00       	mov    $0x979,%edx
+     977:	0f 34                	sysenter
+     979:	c3                   	ret
+
+0000097a <fstat>:
+SYSCALL(fstat)
+     97a:	b8 08 00 00 00       	mov    $0x8,%eax
+     97f:	89 e1                	mov    %esp,%ecx
+     981:	ba 88 09 00 00       	mov    $0x988,%edx
+     986:	0f 34                	sysenter
+     988:	c3                   	ret
+
+00000989 <link>:
+SYSCALL(link)
+     989:	b8 13 00 00 00       	mov    $0x13,%eax
+     98e:	89 e1                	mov    %esp,%ecx
+     990:	ba 97 09 00 00       	mov    $0x997,%edx
+     995:	0f 34                	sysenter
+     997:	c3                   	ret
+
+00000998 <mkdir>:
+SYSCALL(mkdir)
+     998:	b8 14 00 00 00       	mov    $0x14,%eax
+     99d:	89 e1                	mov    %esp,%ecx
+     99f:	ba a6 09 00 00       	mov    $0x9a6,%edx
+     9a4:	0f 34                	sysenter
+     9a6:	c3                   	ret
+
+000009a7 <chdir>:
+SYSCALL(chdir)
+     9a7:	b8 09 00 00 00       	mov    $0x9,%eax
+     9ac:	89 e1                	mov    %esp,%ecx
+     9ae:	ba b5 09 00 00       	mov    $0x9b5,%edx
+     9b3:	0f 34                	sysenter
+     9b5:	c3                   	ret
+
+000009b6 <dup>:
+SYSCALL(dup)
+     9b6:	b8 0a 00 00 00       	mov    $0xa,%eax
+     9bb:	89 e1                	mov    %esp,%ecx
+     9bd:	ba c4 09 00 00       	mov    $0x9c4,%edx
+     9c2:	0f 34                	sysenter
+     9c4:	c3                   	ret
+
+000009c5 <getpid>:
+SYSCALL(getpid)
+     9c5:	b8 0b 00 00 00       	mov    $0xb,%eax
+     9ca:	89 e1                	mov    %esp,%ecx
+     9cc:	ba d3 09 00 00       	mov    $0x9d3,%edx
+     9d1:	0f 34                	sysenter
+     9d3:	c3                   	ret
+
+000009d4 <sbrk>:
+SYSCALL(sbrk)
+     9d4:	b8 0c 00 00 00       	mov    $0xc,%eax
+     9d9:	89 e1                	mov    %esp,%ecx
+     9db:	ba e2 09 00 00       	mov    $0x9e2,%edx
+     9e0:	0f 34                	sysenter
+     9e2:	c3                   	ret
+
+000009e3 <sleep>:
+SYSCALL(sleep)
+     9e3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     9e8:	89 e1                	mov    %esp,%ecx
+     9ea:	ba f1 09 00 00       	mov    $0x9f1,%edx
+     9ef:	0f 34                	sysenter
+     9f1:	c3                   	ret
+
+000009f2 <clone>:
+SYSCALL(clone)
+     9f2:	b8 16 00 00 00       	mov    $0x16,%eax
+     9f7:	89 e1                	mov    %esp,%ecx
+     9f9:	ba 00 0a 00 00       	mov    $0xa00,%edx
+     9fe:	0f 34                	sysenter
+     a00:	c3                   	ret
+
+00000a01 <join>:
+SYSCALL(join)
+     a01:	b8 17 00 00 00       	mov    $0x17,%eax
+     a06:	89 e1                	mov    %esp,%ecx
+     a08:	ba 0f 0a 00 00       	mov    $0xa0f,%edx
+     a0d:	0f 34                	sysenter
+     a0f:	c3                   	ret
+
+00000a10 <futex>:
+SYSCALL(futex)
+     a10:	b8 18 00 00 00       	mov    $0x18,%eax
+     a15:	89 e1                	mov    %esp,%ecx
+     a17:	ba 1e 0a 00 00       	mov    $0xa1e,%edx
+     a1c:	0f 34                	sysenter
+     a1e:	c3                   	ret
+
+00000a1f <yield>:
+SYSCALL(yield)
+     a1f:	b8 19 00 00 00       	mov    $0x19,%eax
+     a24:	89 e1                	mov    %esp,%ecx
+     a26:	ba 2d 0a 00 00       	mov    $0xa2d,%edx
+     a2b:	0f 34                	sysenter
+     a2d:	c3                   	ret
+
+00000a2e <lockstat>:
+SYSCALL(lockstat)
+     a2e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     a33:	89 e1                	mov    %esp,%ecx
+     a35:	ba 3c 0a 00 00       	mov    $0xa3c,%edx
+     a3a:	0f 34                	sysenter
+     a3c:	c3                   	ret
+
+00000a3d <lockhammer>:
+SYSCALL(lockhammer)
+     a3d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     a42:	89 e1                	mov    %esp,%ecx
+     a44:	ba 4b 0a 00 00       	mov    $0xa4b,%edx
+     a49:	0f 34                	sysenter
+     a4b:	c3                   	ret
+
+00000a4c <vmsplice>:
+SYSCALL(vmsplice)
+     a4c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     a51:	89 e1                	mov    %esp,%ecx
+     a53:	ba 5a 0a 00 00       	mov    $0xa5a,%edx
+     a58:	0f 34                	sysenter
+     a5a:	c3                   	ret
+
+00000a5b <hsbrk>:
+SYSCALL(hsbrk)
+     a5b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     a60:	89 e1                	mov    %esp,%ecx
+     a62:	ba 69 0a 00 00       	mov    $0xa69,%edx
+     a67:	0f 34                	sysenter
+     a69:	c3                   	ret
+
+00000a6a <mmap>:
+SYSCALL(mmap)
+     a6a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     a6f:	89 e1                	mov    %esp,%ecx
+     a71:	ba 78 0a 00 00       	mov    $0xa78,%edx
+     a76:	0f 34                	sysenter
+     a78:	c3                   	ret
+
+00000a79 <munmap>:
+SYSCALL(munmap)
+     a79:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     a7e:	89 e1                	mov    %esp,%ecx
+     a80:	ba 87 0a 00 00       	mov    $0xa87,%edx
+     a85:	0f 34                	sysenter
+     a87:	c3                   	ret
+
+00000a88 <ringenter>:
+SYSCALL(ringenter)
+     a88:	b8 20 00 00 00       	mov    $0x20,%eax
+     a8d:	89 e1                	mov    %esp,%ecx
+     a8f:	ba 96 0a 00 00       	mov    $0xa96,%edx
+     a94:	0f 34                	sysenter
+     a96:	c3                   	ret
+
+00000a97 <readv>:
+SYSCALL(readv)
+     a97:	b8 21 00 00 00       	mov    $0x21,%eax
+     a9c:	89 e1                	mov    %esp,%ecx
+     a9e:	ba a5 0a 00 00       	mov    $0xaa5,%edx
+     aa3:	0f 34                	sysenter
+     aa5:	c3                   	ret
+
+00000aa6 <writev>:
+SYSCALL(writev)
+     aa6:	b8 22 00 00 00       	mov    $0x22,%eax
+     aab:	89 e1                	mov    %esp,%ecx
+     aad:	ba b4 0a 00 00       	mov    $0xab4,%edx
+     ab2:	0f 34                	sysenter
+     ab4:	c3                   	ret
+
+00000ab5 <pread>:
+SYSCALL(pread)
+     ab5:	b8 23 00 00 00       	mov    $0x23,%eax
+     aba:	89 e1                	mov    %esp,%ecx
+     abc:	ba c3 0a 00 00       	mov    $0xac3,%edx
+     ac1:	0f 34                	sysenter
+     ac3:	c3                   	ret
+
+00000ac4 <pwrite>:
+SYSCALL(pwrite)
+     ac4:	b8 24 00 00 00       	mov    $0x24,%eax
+     ac9:	89 e1                	mov    %esp,%ecx
+     acb:	ba d2 0a 00 00       	mov    $0xad2,%edx
+     ad0:	0f 34                	sysenter
+     ad2:	c3                   	ret
+
+00000ad3 <prof>:
+SYSCALL(prof)
+     ad3:	b8 25 00 00 00       	mov    $0x25,%eax
+     ad8:	89 e1                	mov    %esp,%ecx
+     ada:	ba e1 0a 00 00       	mov    $0xae1,%edx
+     adf:	0f 34                	sysenter
+     ae1:	c3                   	ret
+
+00000ae2 <scstat>:
+SYSCALL(scstat)
+     ae2:	b8 26 00 00 00       	mov    $0x26,%eax
+     ae7:	89 e1                	mov    %esp,%ecx
+     ae9:	ba f0 0a 00 00       	mov    $0xaf0,%edx
+     aee:	0f 34                	sysenter
+     af0:	c3                   	ret
+     af1:	66 90                	xchg   %ax,%ax
+     af3:	66 90                	xchg   %ax,%ax
+     af5:	66 90                	xchg   %ax,%ax
+     af7:	66 90                	xchg   %ax,%ax
+     af9:	66 90                	xchg   %ax,%ax
+     afb:	66 90                	xchg   %ax,%ax
+     afd:	66 90                	xchg   %ax,%ax
+     aff:	90                   	nop
+
+00000b00 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+     b00:	55                   	push   %ebp
+     b01:	89 e5                	mov    %esp,%ebp
+     b03:	57                   	push   %edi
+     b04:	56                   	push   %esi
+     b05:	53                   	push   %ebx
+     b06:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     b08:	89 d1                	mov    %edx,%ecx
+{
+     b0a:	83 ec 2c             	sub    $0x2c,%esp
+     b0d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+     b10:	85 d2                	test   %edx,%edx
+     b12:	79 7c                	jns    b90 <printint+0x90>
+     b14:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     b18:	74 76                	je     b90 <printint+0x90>
+    x = -xx;
+     b1a:	f7 d9                	neg    %ecx
+    neg = 1;
+     b1c:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     b21:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     b24:	31 f6                	xor    %esi,%esi
+     b26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b2d:	8d 76 00             	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     b30:	89 c8                	mov    %ecx,%eax
+     b32:	31 d2                	xor    %edx,%edx
+     b34:	89 f7                	mov    %esi,%edi
+     b36:	f7 f3                	div    %ebx
+     b38:	8d 76 01             	lea    0x1(%esi),%esi
+     b3b:	0f b6 92 94 23 00 00 	movzbl 0x2394(%edx),%edx
+     b42:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     b46:	89 ca                	mov    %ecx,%edx
+     b48:	89 c1                	mov    %eax,%ecx
+     b4a:	39 da                	cmp    %ebx,%edx
+     b4c:	73 e2                	jae    b30 <printint+0x30>
+  if(neg)
+     b4e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     b51:	85 c0                	test   %eax,%eax
+     b53:	74 07                	je     b5c <printint+0x5c>
+    buf[i++] = '-';
+     b55:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     b5a:	89 f7                	mov    %esi,%edi
+     b5c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     b5f:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     b62:	01 df                	add    %ebx,%edi
+     b64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc_unlocked(buf[i], f);
+     b68:	83 ec 08             	sub    $0x8,%esp
+     b6b:	56                   	push   %esi
+     b6c:	0f be 07             	movsbl (%edi),%eax
+     b6f:	50                   	push   %eax
+     b70:	e8 cb 07 00 00       	call   1340 <putc_unlocked>
+  while(--i >= 0)
+     b75:	89 f8                	mov    %edi,%eax
+     b77:	83 c4 10             	add    $0x10,%esp
+     b7a:	83 ef 01             	sub    $0x1,%edi
+     b7d:	39 d8                	cmp    %ebx,%eax
+     b7f:	75 e7                	jne    b68 <printint+0x68>
+}
+     b81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b84:	5b                   	pop    %ebx
+     b85:	5e                   	pop    %esi
+     b86:	5f                   	pop    %edi
+     b87:	5d                   	pop    %ebp
+     b88:	c3                   	ret
+     b89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     b90:	31 c0                	xor    %eax,%eax
+     b92:	eb 8d                	jmp    b21 <printint+0x21>
+     b94:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b9f:	90                   	nop
+
+00000ba0 <vfprintf>:
+
+// Print to the given stream, which the caller has locked.
+// Only understands %d, %x, %p, %s.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+     ba0:	55                   	push   %ebp
+     ba1:	89 e5                	mov    %esp,%ebp
+     ba3:	57                   	push   %edi
+     ba4:	56                   	push   %esi
+     ba5:	53                   	push   %ebx
+     ba6:	83 ec 1c             	sub    $0x1c,%esp
+     ba9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     bac:	0f b6 0a             	movzbl (%edx),%ecx
+     baf:	84 c9                	test   %cl,%cl
+     bb1:	74 5c                	je     c0f <vfprintf+0x6f>
+     bb3:	89 c6                	mov    %eax,%esi
+     bb5:	8d 5a 01             	lea    0x1(%edx),%ebx
+     bb8:	31 ff                	xor    %edi,%edi
+     bba:	eb 20                	jmp    bdc <vfprintf+0x3c>
+     bbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     bc0:	83 f9 25             	cmp    $0x25,%ecx
+     bc3:	74 3b                	je     c00 <vfprintf+0x60>
+        state = '%';
+      } else {
+        putc_unlocked(c, f);
+     bc5:	83 ec 08             	sub    $0x8,%esp
+     bc8:	56                   	push   %esi
+     bc9:	51                   	push   %ecx
+     bca:	e8 71 07 00 00       	call   1340 <putc_unlocked>
+     bcf:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     bd2:	0f b6 0b             	movzbl (%ebx),%ecx
+     bd5:	83 c3 01             	add    $0x1,%ebx
+     bd8:	84 c9                	test   %cl,%cl
+     bda:	74 33                	je     c0f <vfprintf+0x6f>
+    if(state == 0){
+     bdc:	85 ff                	test   %edi,%edi
+     bde:	74 e0                	je     bc0 <vfprintf+0x20>
+      }
+    } else if(state == '%'){
+     be0:	83 ff 25             	cmp    $0x25,%edi
+     be3:	75 ed                	jne    bd2 <vfprintf+0x32>
+      if(c == 'd'){
+     be5:	83 f9 25             	cmp    $0x25,%ecx
+     be8:	0f 84 02 01 00 00    	je     cf0 <vfprintf+0x150>
+     bee:	8d 41 9d             	lea    -0x63(%ecx),%eax
+     bf1:	83 f8 15             	cmp    $0x15,%eax
+     bf4:	77 2a                	ja     c20 <vfprintf+0x80>
+     bf6:	ff 24 85 3c 23 00 00 	jmp    *0x233c(,%eax,4)
+     bfd:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     c00:	0f b6 0b             	movzbl (%ebx),%ecx
+     c03:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     c06:	bf 25 00 00 00       	mov    $0x25,%edi
+  for(i = 0; fmt[i]; i++){
+     c0b:	84 c9                	test   %cl,%cl
+     c0d:	75 cd                	jne    bdc <vfprintf+0x3c>
+        putc_unlocked(c, f);
+      }
+      state = 0;
+    }
+  }
+}
+     c0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c12:	5b                   	pop    %ebx
+     c13:	5e                   	pop    %esi
+     c14:	5f                   	pop    %edi
+     c15:	5d                   	pop    %ebp
+     c16:	c3                   	ret
+     c17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c1e:	66 90                	xchg   %ax,%ax
+        putc_unlocked('%', f);
+     c20:	83 ec 08             	sub    $0x8,%esp
+     c23:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     c26:	56                   	push   %esi
+     c27:	6a 25                	push   $0x25
+     c29:	e8 12 07 00 00       	call   1340 <putc_unlocked>
+        putc_unlocked(c, f);
+     c2e:	58                   	pop    %eax
+     c2f:	5a                   	pop    %edx
+     c30:	56                   	push   %esi
+     c31:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     c34:	51                   	push   %ecx
+     c35:	e8 06 07 00 00       	call   1340 <putc_unlocked>
+     c3a:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     c3d:	31 ff                	xor    %edi,%edi
+     c3f:	eb 91                	jmp    bd2 <vfprintf+0x32>
+     c41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+     c48:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     c4b:	83 ec 0c             	sub    $0xc,%esp
+     c4e:	b9 10 00 00 00       	mov    $0x10,%ecx
+     c53:	8b 17                	mov    (%edi),%edx
+     c55:	6a 00                	push   $0x0
+        ap++;
+     c57:	83 c7 04             	add    $0x4,%edi
+        printint(f, *ap, 16, 0);
+     c5a:	89 f0                	mov    %esi,%eax
+     c5c:	e8 9f fe ff ff       	call   b00 <printint>
+        ap++;
+     c61:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     c64:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     c67:	31 ff                	xor    %edi,%edi
+     c69:	e9 64 ff ff ff       	jmp    bd2 <vfprintf+0x32>
+     c6e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     c70:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c73:	8b 10                	mov    (%eax),%edx
+        ap++;
+     c75:	83 c0 04             	add    $0x4,%eax
+     c78:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     c7b:	85 d2                	test   %edx,%edx
+     c7d:	0f 84 85 00 00 00    	je     d08 <vfprintf+0x168>
+        while(*s != 0){
+     c83:	0f be 02             	movsbl (%edx),%eax
+        s = (char*)*ap;
+     c86:	89 d7                	mov    %edx,%edi
+        while(*s != 0){
+     c88:	84 c0                	test   %al,%al
+     c8a:	74 b1                	je     c3d <vfprintf+0x9d>
+     c8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+          putc_unlocked(*s, f);
+     c90:	83 ec 08             	sub    $0x8,%esp
+          s++;
+     c93:	83 c7 01             	add    $0x1,%edi
+          putc_unlocked(*s, f);
+     c96:	56                   	push   %esi
+     c97:	50                   	push   %eax
+     c98:	e8 a3 06 00 00       	call   1340 <putc_unlocked>
+        while(*s != 0){
+     c9d:	0f be 07             	movsbl (%edi),%eax
+     ca0:	83 c4 10             	add    $0x10,%esp
+     ca3:	84 c0                	test   %al,%al
+     ca5:	75 e9                	jne    c90 <vfprintf+0xf0>
+      state = 0;
+     ca7:	31 ff                	xor    %edi,%edi
+     ca9:	e9 24 ff ff ff       	jmp    bd2 <vfprintf+0x32>
+     cae:	66 90                	xchg   %ax,%ax
+        printint(f, *ap, 10, 1);
+     cb0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     cb3:	83 ec 0c             	sub    $0xc,%esp
+     cb6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     cbb:	8b 17                	mov    (%edi),%edx
+     cbd:	6a 01                	push   $0x1
+     cbf:	eb 96                	jmp    c57 <vfprintf+0xb7>
+     cc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc_unlocked(*ap, f);
+     cc8:	83 ec 08             	sub    $0x8,%esp
+     ccb:	56                   	push   %esi
+     ccc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     ccf:	ff 37                	push   (%edi)
+     cd1:	e8 6a 06 00 00       	call   1340 <putc_unlocked>
+        ap++;
+     cd6:	89 f8                	mov    %edi,%eax
+     cd8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     cdb:	31 ff                	xor    %edi,%edi
+        ap++;
+     cdd:	83 c0 04             	add    $0x4,%eax
+     ce0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     ce3:	e9 ea fe ff ff       	jmp    bd2 <vfprintf+0x32>
+     ce8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cef:	90                   	nop
+        putc_unlocked(c, f);
+     cf0:	83 ec 08             	sub    $0x8,%esp
+      state = 0;
+     cf3:	31 ff                	xor    %edi,%edi
+        putc_unlocked(c, f);
+     cf5:	56                   	push   %esi
+     cf6:	6a 25                	push   $0x25
+     cf8:	e8 43 06 00 00       	call   1340 <putc_unlocked>
+     cfd:	83 c4 10             	add    $0x10,%esp
+     d00:	e9 cd fe ff ff       	jmp    bd2 <vfprintf+0x32>
+     d05:	8d 76 00             	lea    0x0(%esi),%esi
+     d08:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     d0d:	bf 32 23 00 00       	mov    $0x2332,%edi
+     d12:	e9 79 ff ff ff       	jmp    c90 <vfprintf+0xf0>
+     d17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d1e:	66 90                	xchg   %ax,%ax
+
+00000d20 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+     d20:	55                   	push   %ebp
+     d21:	89 e5                	mov    %esp,%ebp
+     d23:	53                   	push   %ebx
+     d24:	83 ec 10             	sub    $0x10,%esp
+     d27:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  flockfile(f);
+     d2a:	53                   	push   %ebx
+     d2b:	e8 d0 02 00 00       	call   1000 <flockfile>
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     d30:	8b 55 0c             	mov    0xc(%ebp),%edx
+     d33:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     d36:	89 d8                	mov    %ebx,%eax
+     d38:	e8 63 fe ff ff       	call   ba0 <vfprintf>
+  funlockfile(f);
+     d3d:	89 1c 24             	mov    %ebx,(%esp)
+     d40:	e8 eb 02 00 00       	call   1030 <funlockfile>
+}
+     d45:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d48:	83 c4 10             	add    $0x10,%esp
+     d4b:	c9                   	leave
+     d4c:	c3                   	ret
+     d4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d50 <printf>:
+
+// Print to the given fd: through stdout or stderr for 1 and 2,
+// otherwise with one write() per call.
+void
+printf(int fd, const char *fmt, ...)
+{
+     d50:	55                   	push   %ebp
+     d51:	89 e5                	mov    %esp,%ebp
+     d53:	56                   	push   %esi
+     d54:	53                   	push   %ebx
+     d55:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+     d5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  char buf[128];
+  struct iobuf f;
+
+  if(fd == 1 || fd == 2){
+    flockfile(&_iob[fd]);
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     d5e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(fd == 1 || fd == 2){
+     d61:	8d 50 ff             	lea    -0x1(%eax),%edx
+     d64:	83 fa 01             	cmp    $0x1,%edx
+     d67:	76 77                	jbe    de0 <printf+0x90>
+    funlockfile(&_iob[fd]);
+    return;
+  }
+  f.fd = fd;
+     d69:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  f.flags = IO_WRITE|IO_SETUP;
+  f.buf = buf;
+     d6f:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  f.size = sizeof(buf);
+  f.r = f.n = 0;
+  mutex_init(&f.lock);
+     d75:	83 ec 0c             	sub    $0xc,%esp
+     d78:	8d 9d 5c ff ff ff    	lea    -0xa4(%ebp),%ebx
+  f.buf = buf;
+     d7e:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+  mutex_init(&f.lock);
+     d84:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  f.flags = IO_WRITE|IO_SETUP;
+     d8a:	c7 85 60 ff ff ff 42 	movl   $0x42,-0xa0(%ebp)
+     d91:	00 00 00 
+  f.size = sizeof(buf);
+     d94:	c7 85 68 ff ff ff 80 	movl   $0x80,-0x98(%ebp)
+     d9b:	00 00 00 
+  f.r = f.n = 0;
+     d9e:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+     da5:	00 00 00 
+     da8:	c7 85 6c ff ff ff 00 	movl   $0x0,-0x94(%ebp)
+     daf:	00 00 00 
+  mutex_init(&f.lock);
+     db2:	50                   	push   %eax
+     db3:	e8 d8 f9 ff ff       	call   790 <mutex_init>
+  vfprintf(&f, fmt, (uint*)(void*)&fmt + 1);
+     db8:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     dbb:	89 f2                	mov    %esi,%edx
+     dbd:	89 d8                	mov    %ebx,%eax
+     dbf:	e8 dc fd ff ff       	call   ba0 <vfprintf>
+  fflush(&f);
+     dc4:	89 1c 24             	mov    %ebx,(%esp)
+     dc7:	e8 f4 04 00 00       	call   12c0 <fflush>
+     dcc:	83 c4 10             	add    $0x10,%esp
+}
+     dcf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     dd2:	5b                   	pop    %ebx
+     dd3:	5e                   	pop    %esi
+     dd4:	5d                   	pop    %ebp
+     dd5:	c3                   	ret
+     dd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ddd:	8d 76 00             	lea    0x0(%esi),%esi
+    flockfile(&_iob[fd]);
+     de0:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     de3:	83 ec 0c             	sub    $0xc,%esp
+     de6:	8d 98 40 2e 00 00    	lea    0x2e40(%eax),%ebx
+     dec:	53                   	push   %ebx
+     ded:	e8 0e 02 00 00       	call   1000 <flockfile>
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     df2:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     df5:	89 f2                	mov    %esi,%edx
+     df7:	89 d8                	mov    %ebx,%eax
+     df9:	e8 a2 fd ff ff       	call   ba0 <vfprintf>
+    funlockfile(&_iob[fd]);
+     dfe:	89 1c 24             	mov    %ebx,(%esp)
+     e01:	e8 2a 02 00 00       	call   1030 <funlockfile>
+     e06:	83 c4 10             	add    $0x10,%esp
+}
+     e09:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e0c:	5b                   	pop    %ebx
+     e0d:	5e                   	pop    %esi
+     e0e:	5d                   	pop    %ebp
+     e0f:	c3                   	ret
+
+00000e10 <setup>:
+}
+
+// Choose how to buffer f on first use: by lines on a device.
+static void
+setup(FILE *f)
+{
+     e10:	55                   	push   %ebp
+     e11:	89 e5                	mov    %esp,%ebp
+     e13:	53                   	push   %ebx
+     e14:	89 c3                	mov    %eax,%ebx
+     e16:	83 ec 2c             	sub    $0x2c,%esp
+  struct stat st;
+
+  f->flags |= IO_SETUP;
+     e19:	83 48 04 40          	orl    $0x40,0x4(%eax)
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     e1d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     e20:	50                   	push   %eax
+     e21:	ff 33                	push   (%ebx)
+     e23:	e8 52 fb ff ff       	call   97a <fstat>
+     e28:	83 c4 10             	add    $0x10,%esp
+     e2b:	85 c0                	test   %eax,%eax
+    f->flags |= IO_DEV|IO_LINE;
+     e2d:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     e30:	75 07                	jne    e39 <setup+0x29>
+     e32:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+     e37:	74 17                	je     e50 <setup+0x40>
+  if(f->flags & IO_WRITE)
+     e39:	a8 02                	test   $0x2,%al
+     e3b:	74 0a                	je     e47 <setup+0x37>
+    flushhook = flushall;
+     e3d:	c7 05 e0 35 00 00 70 	movl   $0xf70,0x35e0
+     e44:	0f 00 00 
+}
+     e47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e4a:	c9                   	leave
+     e4b:	c3                   	ret
+     e4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    f->flags |= IO_DEV|IO_LINE;
+     e50:	83 c8 30             	or     $0x30,%eax
+     e53:	89 43 04             	mov    %eax,0x4(%ebx)
+     e56:	eb e1                	jmp    e39 <setup+0x29>
+     e58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e5f:	90                   	nop
+
+00000e60 <flush>:
+static int
+flush(FILE *f)
+{
+  int i, n;
+
+  if(!(f->flags & IO_WRITE))
+     e60:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+     e64:	74 6a                	je     ed0 <flush+0x70>
+{
+     e66:	55                   	push   %ebp
+     e67:	89 e5                	mov    %esp,%ebp
+     e69:	56                   	push   %esi
+     e6a:	89 c6                	mov    %eax,%esi
+     e6c:	53                   	push   %ebx
+    return 0;
+  for(i = 0; i < f->n; i += n){
+     e6d:	8b 40 14             	mov    0x14(%eax),%eax
+     e70:	85 c0                	test   %eax,%eax
+     e72:	7e 4c                	jle    ec0 <flush+0x60>
+     e74:	31 db                	xor    %ebx,%ebx
+     e76:	eb 11                	jmp    e89 <flush+0x29>
+     e78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e7f:	90                   	nop
+     e80:	01 c3                	add    %eax,%ebx
+     e82:	8b 46 14             	mov    0x14(%esi),%eax
+     e85:	39 d8                	cmp    %ebx,%eax
+     e87:	7e 37                	jle    ec0 <flush+0x60>
+    if((n = write(f->fd, f->buf + i, f->n - i)) <= 0){
+     e89:	83 ec 04             	sub    $0x4,%esp
+     e8c:	29 d8                	sub    %ebx,%eax
+     e8e:	50                   	push   %eax
+     e8f:	8b 46 08             	mov    0x8(%esi),%eax
+     e92:	01 d8                	add    %ebx,%eax
+     e94:	50                   	push   %eax
+     e95:	ff 36                	push   (%esi)
+     e97:	e8 75 fa ff ff       	call   911 <write>
+     e9c:	83 c4 10             	add    $0x10,%esp
+     e9f:	85 c0                	test   %eax,%eax
+     ea1:	7f dd                	jg     e80 <flush+0x20>
+      f->flags |= IO_ERR;
+     ea3:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+      f->n = 0;
+     ea7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     eac:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+      return EOF;
+    }
+  }
+  f->n = 0;
+  return 0;
+}
+     eb3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     eb6:	5b                   	pop    %ebx
+     eb7:	5e                   	pop    %esi
+     eb8:	5d                   	pop    %ebp
+     eb9:	c3                   	ret
+     eba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->n = 0;
+     ec0:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+}
+     ec7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+     eca:	31 c0                	xor    %eax,%eax
+}
+     ecc:	5b                   	pop    %ebx
+     ecd:	5e                   	pop    %esi
+     ece:	5d                   	pop    %ebp
+     ecf:	c3                   	ret
+    return 0;
+     ed0:	31 c0                	xor    %eax,%eax
+}
+     ed2:	c3                   	ret
+     ed3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     eda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ee0 <fflush.part.0>:
+fflush(FILE *f)
+     ee0:	55                   	push   %ebp
+     ee1:	89 e5                	mov    %esp,%ebp
+     ee3:	57                   	push   %edi
+     ee4:	bf 38 2f 00 00       	mov    $0x2f38,%edi
+     ee9:	56                   	push   %esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     eea:	31 f6                	xor    %esi,%esi
+fflush(FILE *f)
+     eec:	53                   	push   %ebx
+     eed:	bb 58 2e 00 00       	mov    $0x2e58,%ebx
+     ef2:	83 ec 1c             	sub    $0x1c,%esp
+     ef5:	eb 10                	jmp    f07 <fflush.part.0+0x27>
+     ef7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     efe:	66 90                	xchg   %ax,%ax
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     f00:	83 c3 1c             	add    $0x1c,%ebx
+     f03:	39 df                	cmp    %ebx,%edi
+     f05:	74 33                	je     f3a <fflush.part.0+0x5a>
+      if((f->flags & IO_WRITE) && fflush(f) < 0)
+     f07:	f6 43 ec 02          	testb  $0x2,-0x14(%ebx)
+     f0b:	74 f3                	je     f00 <fflush.part.0+0x20>
+  if(threaded)
+     f0d:	8b 0d 00 36 00 00    	mov    0x3600,%ecx
+     f13:	85 c9                	test   %ecx,%ecx
+     f15:	75 49                	jne    f60 <fflush.part.0+0x80>
+  r = flush(f);
+     f17:	8d 43 e8             	lea    -0x18(%ebx),%eax
+     f1a:	e8 41 ff ff ff       	call   e60 <flush>
+  if(threaded)
+     f1f:	8b 15 00 36 00 00    	mov    0x3600,%edx
+     f25:	85 d2                	test   %edx,%edx
+     f27:	75 1f                	jne    f48 <fflush.part.0+0x68>
+        r = EOF;
+     f29:	85 c0                	test   %eax,%eax
+     f2b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     f30:	0f 48 f0             	cmovs  %eax,%esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     f33:	83 c3 1c             	add    $0x1c,%ebx
+     f36:	39 df                	cmp    %ebx,%edi
+     f38:	75 cd                	jne    f07 <fflush.part.0+0x27>
+}
+     f3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f3d:	89 f0                	mov    %esi,%eax
+     f3f:	5b                   	pop    %ebx
+     f40:	5e                   	pop    %esi
+     f41:	5f                   	pop    %edi
+     f42:	5d                   	pop    %ebp
+     f43:	c3                   	ret
+     f44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     f48:	83 ec 0c             	sub    $0xc,%esp
+     f4b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     f4e:	53                   	push   %ebx
+     f4f:	e8 9c f8 ff ff       	call   7f0 <mutex_unlock>
+     f54:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     f57:	83 c4 10             	add    $0x10,%esp
+     f5a:	eb cd                	jmp    f29 <fflush.part.0+0x49>
+     f5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     f60:	83 ec 0c             	sub    $0xc,%esp
+     f63:	53                   	push   %ebx
+     f64:	e8 37 f8 ff ff       	call   7a0 <mutex_lock>
+     f69:	83 c4 10             	add    $0x10,%esp
+     f6c:	eb a9                	jmp    f17 <fflush.part.0+0x37>
+     f6e:	66 90                	xchg   %ax,%ax
+
+00000f70 <flushall>:
+  if(f == 0){
+     f70:	e9 6b ff ff ff       	jmp    ee0 <fflush.part.0>
+     f75:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000f80 <fill>:
+
+// Refill f's buffer. Returns the number of bytes read.
+// Caller holds f's lock.
+static int
+fill(FILE *f)
+{
+     f80:	55                   	push   %ebp
+     f81:	89 e5                	mov    %esp,%ebp
+     f83:	53                   	push   %ebx
+     f84:	89 c3                	mov    %eax,%ebx
+     f86:	83 ec 04             	sub    $0x4,%esp
+  int n;
+
+  if(!(f->flags & IO_SETUP))
+     f89:	8b 40 04             	mov    0x4(%eax),%eax
+     f8c:	a8 40                	test   $0x40,%al
+     f8e:	74 50                	je     fe0 <fill+0x60>
+    setup(f);
+  if(f->flags & IO_DEV)
+     f90:	a8 20                	test   $0x20,%al
+     f92:	75 3c                	jne    fd0 <fill+0x50>
+    fflush(0);
+  f->r = 0;
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     f94:	83 ec 04             	sub    $0x4,%esp
+  f->r = 0;
+     f97:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     f9e:	ff 73 0c             	push   0xc(%ebx)
+     fa1:	ff 73 08             	push   0x8(%ebx)
+     fa4:	ff 33                	push   (%ebx)
+     fa6:	e8 57 f9 ff ff       	call   902 <read>
+     fab:	83 c4 10             	add    $0x10,%esp
+     fae:	85 c0                	test   %eax,%eax
+     fb0:	7f 10                	jg     fc2 <fill+0x42>
+    f->flags |= n < 0 ? IO_ERR : IO_EOF;
+     fb2:	83 f8 01             	cmp    $0x1,%eax
+     fb5:	19 c0                	sbb    %eax,%eax
+     fb7:	83 e0 fc             	and    $0xfffffffc,%eax
+     fba:	83 c0 08             	add    $0x8,%eax
+     fbd:	09 43 04             	or     %eax,0x4(%ebx)
+    n = 0;
+     fc0:	31 c0                	xor    %eax,%eax
+  }
+  f->n = n;
+     fc2:	89 43 14             	mov    %eax,0x14(%ebx)
+  return n;
+}
+     fc5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     fc8:	c9                   	leave
+     fc9:	c3                   	ret
+     fca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == 0){
+     fd0:	e8 0b ff ff ff       	call   ee0 <fflush.part.0>
+     fd5:	eb bd                	jmp    f94 <fill+0x14>
+     fd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fde:	66 90                	xchg   %ax,%ax
+    setup(f);
+     fe0:	89 d8                	mov    %ebx,%eax
+     fe2:	e8 29 fe ff ff       	call   e10 <setup>
+  if(f->flags & IO_DEV)
+     fe7:	8b 43 04             	mov    0x4(%ebx),%eax
+     fea:	eb a4                	jmp    f90 <fill+0x10>
+     fec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ff0 <stdio_threaded>:
+  threaded = 1;
+     ff0:	c7 05 00 36 00 00 01 	movl   $0x1,0x3600
+     ff7:	00 00 00 
+}
+     ffa:	c3                   	ret
+     ffb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     fff:	90                   	nop
+
+00001000 <flockfile>:
+{
+    1000:	55                   	push   %ebp
+  if(threaded)
+    1001:	8b 15 00 36 00 00    	mov    0x3600,%edx
+{
+    1007:	89 e5                	mov    %esp,%ebp
+    1009:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+    100c:	85 d2                	test   %edx,%edx
+    100e:	75 08                	jne    1018 <flockfile+0x18>
+}
+    1010:	5d                   	pop    %ebp
+    1011:	c3                   	ret
+    1012:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_lock(&f->lock);
+    1018:	83 c0 18             	add    $0x18,%eax
+    101b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+    101e:	5d                   	pop    %ebp
+    mutex_lock(&f->lock);
+    101f:	e9 7c f7 ff ff       	jmp    7a0 <mutex_lock>
+    1024:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    102b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    102f:	90                   	nop
+
+00001030 <funlockfile>:
+{
+    1030:	55                   	push   %ebp
+  if(threaded)
+    1031:	8b 15 00 36 00 00    	mov    0x3600,%edx
+{
+    1037:	89 e5                	mov    %esp,%ebp
+    1039:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+    103c:	85 d2                	test   %edx,%edx
+    103e:	75 08                	jne    1048 <funlockfile+0x18>
+}
+    1040:	5d                   	pop    %ebp
+    1041:	c3                   	ret
+    1042:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&f->lock);
+    1048:	83 c0 18             	add    $0x18,%eax
+    104b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+    104e:	5d                   	pop    %ebp
+    mutex_unlock(&f->lock);
+    104f:	e9 9c f7 ff ff       	jmp    7f0 <mutex_unlock>
+    1054:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    105b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    105f:	90                   	nop
+
+00001060 <fopen>:
+{
+    1060:	55                   	push   %ebp
+    1061:	89 e5                	mov    %esp,%ebp
+    1063:	57                   	push   %edi
+    1064:	56                   	push   %esi
+    1065:	53                   	push   %ebx
+    1066:	83 ec 34             	sub    $0x34,%esp
+    1069:	8b 75 0c             	mov    0xc(%ebp),%esi
+    106c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(strcmp(mode, "r") != 0 && strcmp(mode, "w") != 0)
+    106f:	68 b7 22 00 00       	push   $0x22b7
+    1074:	56                   	push   %esi
+    1075:	e8 66 f5 ff ff       	call   5e0 <strcmp>
+    107a:	83 c4 10             	add    $0x10,%esp
+    107d:	85 c0                	test   %eax,%eax
+    107f:	74 15                	je     1096 <fopen+0x36>
+    1081:	83 ec 08             	sub    $0x8,%esp
+    1084:	68 a5 23 00 00       	push   $0x23a5
+    1089:	56                   	push   %esi
+    108a:	e8 51 f5 ff ff       	call   5e0 <strcmp>
+    108f:	83 c4 10             	add    $0x10,%esp
+    1092:	85 c0                	test   %eax,%eax
+    1094:	75 2c                	jne    10c2 <fopen+0x62>
+  if(threaded)
+    1096:	a1 00 36 00 00       	mov    0x3600,%eax
+    109b:	85 c0                	test   %eax,%eax
+    109d:	0f 85 ed 00 00 00    	jne    1190 <fopen+0x130>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+    10a3:	bb 94 2e 00 00       	mov    $0x2e94,%ebx
+    if(f->flags == 0)
+    10a8:	8b 53 04             	mov    0x4(%ebx),%edx
+    10ab:	85 d2                	test   %edx,%edx
+    10ad:	74 21                	je     10d0 <fopen+0x70>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+    10af:	83 c3 1c             	add    $0x1c,%ebx
+    10b2:	81 fb 20 2f 00 00    	cmp    $0x2f20,%ebx
+    10b8:	75 ee                	jne    10a8 <fopen+0x48>
+  if(threaded)
+    10ba:	85 c0                	test   %eax,%eax
+    10bc:	0f 85 36 01 00 00    	jne    11f8 <fopen+0x198>
+    return 0;
+    10c2:	31 db                	xor    %ebx,%ebx
+    10c4:	e9 96 00 00 00       	jmp    115f <fopen+0xff>
+    10c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f == &_iob[NSTREAM])
+    10d0:	81 fb 20 2f 00 00    	cmp    $0x2f20,%ebx
+    10d6:	74 e2                	je     10ba <fopen+0x5a>
+    f->flags = IO_MALLOC;
+    10d8:	c7 43 04 80 00 00 00 	movl   $0x80,0x4(%ebx)
+  if(threaded)
+    10df:	85 c0                	test   %eax,%eax
+    10e1:	0f 85 f9 00 00 00    	jne    11e0 <fopen+0x180>
+  if(mode[0] == 'r'){
+    10e7:	80 3e 72             	cmpb   $0x72,(%esi)
+    10ea:	0f 84 c0 00 00 00    	je     11b0 <fopen+0x150>
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+    10f0:	83 ec 08             	sub    $0x8,%esp
+    10f3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+    10f6:	50                   	push   %eax
+    10f7:	57                   	push   %edi
+    10f8:	e8 d3 f5 ff ff       	call   6d0 <stat>
+    10fd:	83 c4 10             	add    $0x10,%esp
+    1100:	85 c0                	test   %eax,%eax
+    1102:	74 6c                	je     1170 <fopen+0x110>
+    fd = open(path, O_CREATE|O_WRONLY);
+    1104:	83 ec 08             	sub    $0x8,%esp
+    1107:	68 01 02 00 00       	push   $0x201
+    110c:	57                   	push   %edi
+    flags = IO_WRITE;
+    110d:	bf 02 00 00 00       	mov    $0x2,%edi
+    fd = open(path, O_CREATE|O_WRONLY);
+    1112:	e8 36 f8 ff ff       	call   94d <open>
+    1117:	83 c4 10             	add    $0x10,%esp
+    111a:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+    111c:	85 f6                	test   %esi,%esi
+    111e:	0f 88 a9 00 00 00    	js     11cd <fopen+0x16d>
+    1124:	83 ec 0c             	sub    $0xc,%esp
+    1127:	68 00 02 00 00       	push   $0x200
+    112c:	e8 af 0c 00 00       	call   1de0 <malloc>
+    1131:	83 c4 10             	add    $0x10,%esp
+    1134:	89 43 08             	mov    %eax,0x8(%ebx)
+    1137:	85 c0                	test   %eax,%eax
+    1139:	0f 84 d0 00 00 00    	je     120f <fopen+0x1af>
+  f->flags = flags|IO_MALLOC;
+    113f:	81 cf 80 00 00 00    	or     $0x80,%edi
+  f->fd = fd;
+    1145:	89 33                	mov    %esi,(%ebx)
+  f->size = BUFSIZ;
+    1147:	c7 43 0c 00 02 00 00 	movl   $0x200,0xc(%ebx)
+  f->r = f->n = 0;
+    114e:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+    1155:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  f->flags = flags|IO_MALLOC;
+    115c:	89 7b 04             	mov    %edi,0x4(%ebx)
+}
+    115f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1162:	89 d8                	mov    %ebx,%eax
+    1164:	5b                   	pop    %ebx
+    1165:	5e                   	pop    %esi
+    1166:	5f                   	pop    %edi
+    1167:	5d                   	pop    %ebp
+    1168:	c3                   	ret
+    1169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+    1170:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+    1175:	75 8d                	jne    1104 <fopen+0xa4>
+      unlink(path);
+    1177:	83 ec 0c             	sub    $0xc,%esp
+    117a:	57                   	push   %edi
+    117b:	e8 eb f7 ff ff       	call   96b <unlink>
+    1180:	83 c4 10             	add    $0x10,%esp
+    1183:	e9 7c ff ff ff       	jmp    1104 <fopen+0xa4>
+    1188:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    118f:	90                   	nop
+    mutex_lock(&iolock);
+    1190:	83 ec 0c             	sub    $0xc,%esp
+    1193:	68 04 36 00 00       	push   $0x3604
+    1198:	e8 03 f6 ff ff       	call   7a0 <mutex_lock>
+  if(threaded)
+    119d:	a1 00 36 00 00       	mov    0x3600,%eax
+    11a2:	83 c4 10             	add    $0x10,%esp
+    11a5:	e9 f9 fe ff ff       	jmp    10a3 <fopen+0x43>
+    11aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    fd = open(path, O_RDONLY);
+    11b0:	83 ec 08             	sub    $0x8,%esp
+    11b3:	6a 00                	push   $0x0
+    11b5:	57                   	push   %edi
+    flags = IO_READ;
+    11b6:	bf 01 00 00 00       	mov    $0x1,%edi
+    fd = open(path, O_RDONLY);
+    11bb:	e8 8d f7 ff ff       	call   94d <open>
+    11c0:	83 c4 10             	add    $0x10,%esp
+    11c3:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+    11c5:	85 f6                	test   %esi,%esi
+    11c7:	0f 89 57 ff ff ff    	jns    1124 <fopen+0xc4>
+    f->flags = 0;
+    11cd:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    return 0;
+    11d4:	31 db                	xor    %ebx,%ebx
+    11d6:	eb 87                	jmp    115f <fopen+0xff>
+    11d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11df:	90                   	nop
+    mutex_unlock(&iolock);
+    11e0:	83 ec 0c             	sub    $0xc,%esp
+    11e3:	68 04 36 00 00       	push   $0x3604
+    11e8:	e8 03 f6 ff ff       	call   7f0 <mutex_unlock>
+    11ed:	83 c4 10             	add    $0x10,%esp
+    11f0:	e9 f2 fe ff ff       	jmp    10e7 <fopen+0x87>
+    11f5:	8d 76 00             	lea    0x0(%esi),%esi
+    11f8:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+    11fb:	31 db                	xor    %ebx,%ebx
+    mutex_unlock(&iolock);
+    11fd:	68 04 36 00 00       	push   $0x3604
+    1202:	e8 e9 f5 ff ff       	call   7f0 <mutex_unlock>
+    1207:	83 c4 10             	add    $0x10,%esp
+    120a:	e9 50 ff ff ff       	jmp    115f <fopen+0xff>
+      close(fd);
+    120f:	83 ec 0c             	sub    $0xc,%esp
+    1212:	56                   	push   %esi
+    1213:	e8 08 f7 ff ff       	call   920 <close>
+    1218:	83 c4 10             	add    $0x10,%esp
+    121b:	eb b0                	jmp    11cd <fopen+0x16d>
+    121d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001220 <fclose>:
+{
+    1220:	55                   	push   %ebp
+    1221:	89 e5                	mov    %esp,%ebp
+    1223:	56                   	push   %esi
+    1224:	53                   	push   %ebx
+  if(threaded)
+    1225:	8b 15 00 36 00 00    	mov    0x3600,%edx
+{
+    122b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    122e:	85 d2                	test   %edx,%edx
+    1230:	75 46                	jne    1278 <fclose+0x58>
+  r = flush(f);
+    1232:	89 d8                	mov    %ebx,%eax
+    1234:	e8 27 fc ff ff       	call   e60 <flush>
+  if(close(f->fd) < 0)
+    1239:	83 ec 0c             	sub    $0xc,%esp
+    123c:	ff 33                	push   (%ebx)
+  r = flush(f);
+    123e:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    1240:	e8 db f6 ff ff       	call   920 <close>
+    1245:	83 c4 10             	add    $0x10,%esp
+    r = EOF;
+    1248:	85 c0                	test   %eax,%eax
+    124a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    124f:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->flags & IO_MALLOC)
+    1252:	f6 43 04 80          	testb  $0x80,0x4(%ebx)
+    1256:	75 58                	jne    12b0 <fclose+0x90>
+  if(threaded)
+    1258:	a1 00 36 00 00       	mov    0x3600,%eax
+  f->flags = 0;
+    125d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  if(threaded)
+    1264:	85 c0                	test   %eax,%eax
+    1266:	75 28                	jne    1290 <fclose+0x70>
+}
+    1268:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    126b:	89 f0                	mov    %esi,%eax
+    126d:	5b                   	pop    %ebx
+    126e:	5e                   	pop    %esi
+    126f:	5d                   	pop    %ebp
+    1270:	c3                   	ret
+    1271:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    1278:	83 ec 0c             	sub    $0xc,%esp
+    127b:	8d 43 18             	lea    0x18(%ebx),%eax
+    127e:	50                   	push   %eax
+    127f:	e8 1c f5 ff ff       	call   7a0 <mutex_lock>
+    1284:	83 c4 10             	add    $0x10,%esp
+    1287:	eb a9                	jmp    1232 <fclose+0x12>
+    1289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1290:	83 ec 0c             	sub    $0xc,%esp
+    1293:	83 c3 18             	add    $0x18,%ebx
+    1296:	53                   	push   %ebx
+    1297:	e8 54 f5 ff ff       	call   7f0 <mutex_unlock>
+    129c:	83 c4 10             	add    $0x10,%esp
+}
+    129f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12a2:	89 f0                	mov    %esi,%eax
+    12a4:	5b                   	pop    %ebx
+    12a5:	5e                   	pop    %esi
+    12a6:	5d                   	pop    %ebp
+    12a7:	c3                   	ret
+    12a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12af:	90                   	nop
+    free(f->buf);
+    12b0:	83 ec 0c             	sub    $0xc,%esp
+    12b3:	ff 73 08             	push   0x8(%ebx)
+    12b6:	e8 f5 09 00 00       	call   1cb0 <free>
+    12bb:	83 c4 10             	add    $0x10,%esp
+    12be:	eb 98                	jmp    1258 <fclose+0x38>
+
+000012c0 <fflush>:
+{
+    12c0:	55                   	push   %ebp
+    12c1:	89 e5                	mov    %esp,%ebp
+    12c3:	53                   	push   %ebx
+    12c4:	83 ec 14             	sub    $0x14,%esp
+    12c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f == 0){
+    12ca:	85 db                	test   %ebx,%ebx
+    12cc:	74 5a                	je     1328 <fflush+0x68>
+  if(threaded)
+    12ce:	8b 0d 00 36 00 00    	mov    0x3600,%ecx
+    12d4:	85 c9                	test   %ecx,%ecx
+    12d6:	75 18                	jne    12f0 <fflush+0x30>
+  r = flush(f);
+    12d8:	89 d8                	mov    %ebx,%eax
+    12da:	e8 81 fb ff ff       	call   e60 <flush>
+  if(threaded)
+    12df:	8b 15 00 36 00 00    	mov    0x3600,%edx
+    12e5:	85 d2                	test   %edx,%edx
+    12e7:	75 1f                	jne    1308 <fflush+0x48>
+}
+    12e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    12ec:	c9                   	leave
+    12ed:	c3                   	ret
+    12ee:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    12f0:	83 ec 0c             	sub    $0xc,%esp
+    12f3:	8d 43 18             	lea    0x18(%ebx),%eax
+    12f6:	50                   	push   %eax
+    12f7:	e8 a4 f4 ff ff       	call   7a0 <mutex_lock>
+    12fc:	83 c4 10             	add    $0x10,%esp
+    12ff:	eb d7                	jmp    12d8 <fflush+0x18>
+    1301:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1308:	83 ec 0c             	sub    $0xc,%esp
+    130b:	83 c3 18             	add    $0x18,%ebx
+    130e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1311:	53                   	push   %ebx
+    1312:	e8 d9 f4 ff ff       	call   7f0 <mutex_unlock>
+    1317:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    131a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    mutex_unlock(&f->lock);
+    131d:	83 c4 10             	add    $0x10,%esp
+}
+    1320:	c9                   	leave
+    1321:	c3                   	ret
+    1322:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1328:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    132b:	c9                   	leave
+    132c:	e9 af fb ff ff       	jmp    ee0 <fflush.part.0>
+    1331:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1338:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    133f:	90                   	nop
+
+00001340 <putc_unlocked>:
+{
+    1340:	55                   	push   %ebp
+    1341:	89 e5                	mov    %esp,%ebp
+    1343:	56                   	push   %esi
+    1344:	53                   	push   %ebx
+    1345:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    1348:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(!(f->flags & IO_WRITE))
+    134b:	8b 43 04             	mov    0x4(%ebx),%eax
+    134e:	a8 02                	test   $0x2,%al
+    1350:	74 46                	je     1398 <putc_unlocked+0x58>
+  if(!(f->flags & IO_SETUP))
+    1352:	a8 40                	test   $0x40,%al
+    1354:	74 4a                	je     13a0 <putc_unlocked+0x60>
+  if(f->n == f->size && flush(f) < 0)
+    1356:	8b 43 14             	mov    0x14(%ebx),%eax
+    1359:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    135c:	74 51                	je     13af <putc_unlocked+0x6f>
+  f->buf[f->n++] = c;
+    135e:	8d 48 01             	lea    0x1(%eax),%ecx
+    1361:	8b 53 08             	mov    0x8(%ebx),%edx
+    1364:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    1367:	89 f1                	mov    %esi,%ecx
+    1369:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    136c:	83 fe 0a             	cmp    $0xa,%esi
+    136f:	74 0f                	je     1380 <putc_unlocked+0x40>
+  return c & 0xff;
+    1371:	89 f0                	mov    %esi,%eax
+    1373:	0f b6 c0             	movzbl %al,%eax
+}
+    1376:	5b                   	pop    %ebx
+    1377:	5e                   	pop    %esi
+    1378:	5d                   	pop    %ebp
+    1379:	c3                   	ret
+    137a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    1380:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1384:	74 eb                	je     1371 <putc_unlocked+0x31>
+    1386:	89 d8                	mov    %ebx,%eax
+    1388:	e8 d3 fa ff ff       	call   e60 <flush>
+    138d:	85 c0                	test   %eax,%eax
+    138f:	79 e0                	jns    1371 <putc_unlocked+0x31>
+    1391:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return EOF;
+    1398:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    139d:	eb d7                	jmp    1376 <putc_unlocked+0x36>
+    139f:	90                   	nop
+    setup(f);
+    13a0:	89 d8                	mov    %ebx,%eax
+    13a2:	e8 69 fa ff ff       	call   e10 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    13a7:	8b 43 14             	mov    0x14(%ebx),%eax
+    13aa:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    13ad:	75 af                	jne    135e <putc_unlocked+0x1e>
+    13af:	89 d8                	mov    %ebx,%eax
+    13b1:	e8 aa fa ff ff       	call   e60 <flush>
+    13b6:	85 c0                	test   %eax,%eax
+    13b8:	78 de                	js     1398 <putc_unlocked+0x58>
+  f->buf[f->n++] = c;
+    13ba:	8b 43 14             	mov    0x14(%ebx),%eax
+    13bd:	eb 9f                	jmp    135e <putc_unlocked+0x1e>
+    13bf:	90                   	nop
+
+000013c0 <fputc>:
+{
+    13c0:	55                   	push   %ebp
+    13c1:	89 e5                	mov    %esp,%ebp
+    13c3:	56                   	push   %esi
+    13c4:	53                   	push   %ebx
+  if(threaded)
+    13c5:	8b 15 00 36 00 00    	mov    0x3600,%edx
+{
+    13cb:	8b 75 08             	mov    0x8(%ebp),%esi
+    13ce:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(threaded)
+    13d1:	85 d2                	test   %edx,%edx
+    13d3:	75 6b                	jne    1440 <fputc+0x80>
+  if(!(f->flags & IO_WRITE))
+    13d5:	8b 43 04             	mov    0x4(%ebx),%eax
+    13d8:	a8 02                	test   $0x2,%al
+    13da:	0f 84 b8 00 00 00    	je     1498 <fputc+0xd8>
+  if(!(f->flags & IO_SETUP))
+    13e0:	a8 40                	test   $0x40,%al
+    13e2:	74 76                	je     145a <fputc+0x9a>
+  if(f->n == f->size && flush(f) < 0)
+    13e4:	8b 43 14             	mov    0x14(%ebx),%eax
+    13e7:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    13ea:	74 7d                	je     1469 <fputc+0xa9>
+  f->buf[f->n++] = c;
+    13ec:	8d 48 01             	lea    0x1(%eax),%ecx
+    13ef:	8b 53 08             	mov    0x8(%ebx),%edx
+    13f2:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    13f5:	89 f1                	mov    %esi,%ecx
+    13f7:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    13fa:	83 fe 0a             	cmp    $0xa,%esi
+    13fd:	74 21                	je     1420 <fputc+0x60>
+  return c & 0xff;
+    13ff:	89 f0                	mov    %esi,%eax
+    1401:	0f b6 f0             	movzbl %al,%esi
+  if(threaded)
+    1404:	a1 00 36 00 00       	mov    0x3600,%eax
+    1409:	85 c0                	test   %eax,%eax
+    140b:	75 73                	jne    1480 <fputc+0xc0>
+}
+    140d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1410:	89 f0                	mov    %esi,%eax
+    1412:	5b                   	pop    %ebx
+    1413:	5e                   	pop    %esi
+    1414:	5d                   	pop    %ebp
+    1415:	c3                   	ret
+    1416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    141d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    1420:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1424:	74 d9                	je     13ff <fputc+0x3f>
+    1426:	89 d8                	mov    %ebx,%eax
+    1428:	e8 33 fa ff ff       	call   e60 <flush>
+    142d:	85 c0                	test   %eax,%eax
+    142f:	79 ce                	jns    13ff <fputc+0x3f>
+    return EOF;
+    1431:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1436:	eb cc                	jmp    1404 <fputc+0x44>
+    1438:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    143f:	90                   	nop
+    mutex_lock(&f->lock);
+    1440:	83 ec 0c             	sub    $0xc,%esp
+    1443:	8d 43 18             	lea    0x18(%ebx),%eax
+    1446:	50                   	push   %eax
+    1447:	e8 54 f3 ff ff       	call   7a0 <mutex_lock>
+  if(!(f->flags & IO_WRITE))
+    144c:	8b 43 04             	mov    0x4(%ebx),%eax
+    144f:	83 c4 10             	add    $0x10,%esp
+    1452:	a8 02                	test   $0x2,%al
+    1454:	74 db                	je     1431 <fputc+0x71>
+  if(!(f->flags & IO_SETUP))
+    1456:	a8 40                	test   $0x40,%al
+    1458:	75 8a                	jne    13e4 <fputc+0x24>
+    setup(f);
+    145a:	89 d8                	mov    %ebx,%eax
+    145c:	e8 af f9 ff ff       	call   e10 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    1461:	8b 43 14             	mov    0x14(%ebx),%eax
+    1464:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    1467:	75 83                	jne    13ec <fputc+0x2c>
+    1469:	89 d8                	mov    %ebx,%eax
+    146b:	e8 f0 f9 ff ff       	call   e60 <flush>
+    1470:	85 c0                	test   %eax,%eax
+    1472:	78 bd                	js     1431 <fputc+0x71>
+  f->buf[f->n++] = c;
+    1474:	8b 43 14             	mov    0x14(%ebx),%eax
+    1477:	e9 70 ff ff ff       	jmp    13ec <fputc+0x2c>
+    147c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1480:	83 ec 0c             	sub    $0xc,%esp
+    1483:	83 c3 18             	add    $0x18,%ebx
+    1486:	53                   	push   %ebx
+    1487:	e8 64 f3 ff ff       	call   7f0 <mutex_unlock>
+    148c:	83 c4 10             	add    $0x10,%esp
+}
+    148f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1492:	89 f0                	mov    %esi,%eax
+    1494:	5b                   	pop    %ebx
+    1495:	5e                   	pop    %esi
+    1496:	5d                   	pop    %ebp
+    1497:	c3                   	ret
+    return EOF;
+    1498:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    149d:	e9 6b ff ff ff       	jmp    140d <fputc+0x4d>
+    14a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000014b0 <fwrite>:
+{
+    14b0:	55                   	push   %ebp
+    14b1:	89 e5                	mov    %esp,%ebp
+    14b3:	57                   	push   %edi
+    14b4:	56                   	push   %esi
+    14b5:	53                   	push   %ebx
+    14b6:	83 ec 1c             	sub    $0x1c,%esp
+    14b9:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  if(!(f->flags & IO_WRITE) || size <= 0)
+    14bc:	8b 43 04             	mov    0x4(%ebx),%eax
+    14bf:	a8 02                	test   $0x2,%al
+    14c1:	0f 84 ec 00 00 00    	je     15b3 <fwrite+0x103>
+    14c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    14ca:	85 c9                	test   %ecx,%ecx
+    14cc:	0f 8e e1 00 00 00    	jle    15b3 <fwrite+0x103>
+  if(threaded)
+    14d2:	8b 15 00 36 00 00    	mov    0x3600,%edx
+    14d8:	85 d2                	test   %edx,%edx
+    14da:	0f 85 1c 01 00 00    	jne    15fc <fwrite+0x14c>
+  if(!(f->flags & IO_SETUP))
+    14e0:	a8 40                	test   $0x40,%al
+    14e2:	0f 84 08 01 00 00    	je     15f0 <fwrite+0x140>
+  for(len = size*nmemb; len > 0; len -= n){
+    14e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+    14eb:	0f af 45 10          	imul   0x10(%ebp),%eax
+    14ef:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    14f2:	85 c0                	test   %eax,%eax
+    14f4:	0f 8e 2a 01 00 00    	jle    1624 <fwrite+0x174>
+  s = p;
+    14fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  nl = 0;
+    14fd:	31 ff                	xor    %edi,%edi
+    14ff:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+        nl = 1;
+    1502:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  s = p;
+    1505:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1508:	8b 43 14             	mov    0x14(%ebx),%eax
+        nl = 1;
+    150b:	89 ce                	mov    %ecx,%esi
+    if(f->n == f->size && flush(f) < 0)
+    150d:	89 c2                	mov    %eax,%edx
+    150f:	39 f0                	cmp    %esi,%eax
+    1511:	74 6e                	je     1581 <fwrite+0xd1>
+    1513:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1517:	90                   	nop
+    if(n > len)
+    1518:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    n = f->size - f->n;
+    151b:	89 f1                	mov    %esi,%ecx
+    151d:	29 c1                	sub    %eax,%ecx
+    151f:	39 f9                	cmp    %edi,%ecx
+    1521:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1524:	85 c9                	test   %ecx,%ecx
+    1526:	0f 8e 7c 00 00 00    	jle    15a8 <fwrite+0xf8>
+    152c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    152f:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1532:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    1535:	8d 34 08             	lea    (%eax,%ecx,1),%esi
+    1538:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    153b:	eb 06                	jmp    1543 <fwrite+0x93>
+    153d:	8d 76 00             	lea    0x0(%esi),%esi
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1540:	8b 53 14             	mov    0x14(%ebx),%edx
+    1543:	8d 4a 01             	lea    0x1(%edx),%ecx
+    1546:	8b 73 08             	mov    0x8(%ebx),%esi
+    1549:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    154c:	0f b6 08             	movzbl (%eax),%ecx
+        nl = 1;
+    154f:	80 f9 0a             	cmp    $0xa,%cl
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1552:	88 0c 16             	mov    %cl,(%esi,%edx,1)
+        nl = 1;
+    1555:	be 01 00 00 00       	mov    $0x1,%esi
+    155a:	0f 44 fe             	cmove  %esi,%edi
+    for(i = 0; i < n; i++)
+    155d:	83 c0 01             	add    $0x1,%eax
+    1560:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    1563:	75 db                	jne    1540 <fwrite+0x90>
+    s += n;
+    1565:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1568:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    156b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    s += n;
+    156e:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    1571:	85 c0                	test   %eax,%eax
+    1573:	7e 48                	jle    15bd <fwrite+0x10d>
+    1575:	8b 43 14             	mov    0x14(%ebx),%eax
+    1578:	8b 73 0c             	mov    0xc(%ebx),%esi
+    if(f->n == f->size && flush(f) < 0)
+    157b:	89 c2                	mov    %eax,%edx
+    157d:	39 f0                	cmp    %esi,%eax
+    157f:	75 97                	jne    1518 <fwrite+0x68>
+    1581:	89 d8                	mov    %ebx,%eax
+    1583:	e8 d8 f8 ff ff       	call   e60 <flush>
+    1588:	85 c0                	test   %eax,%eax
+    158a:	78 31                	js     15bd <fwrite+0x10d>
+    n = f->size - f->n;
+    158c:	8b 73 0c             	mov    0xc(%ebx),%esi
+    158f:	8b 43 14             	mov    0x14(%ebx),%eax
+    1592:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    1595:	89 f1                	mov    %esi,%ecx
+    1597:	89 c2                	mov    %eax,%edx
+    1599:	29 c1                	sub    %eax,%ecx
+    159b:	39 f9                	cmp    %edi,%ecx
+    159d:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    15a0:	85 c9                	test   %ecx,%ecx
+    15a2:	7f 88                	jg     152c <fwrite+0x7c>
+    15a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    s += n;
+    15a8:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    15ab:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    15ae:	e9 5a ff ff ff       	jmp    150d <fwrite+0x5d>
+}
+    15b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    15b6:	31 c0                	xor    %eax,%eax
+}
+    15b8:	5b                   	pop    %ebx
+    15b9:	5e                   	pop    %esi
+    15ba:	5f                   	pop    %edi
+    15bb:	5d                   	pop    %ebp
+    15bc:	c3                   	ret
+  if(nl && (f->flags & IO_LINE))
+    15bd:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    15c0:	85 ff                	test   %edi,%edi
+    15c2:	74 06                	je     15ca <fwrite+0x11a>
+    15c4:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    15c8:	75 1d                	jne    15e7 <fwrite+0x137>
+  return (s - (const char*)p) / size;
+    15ca:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    15cd:	2b 75 08             	sub    0x8(%ebp),%esi
+  if(threaded)
+    15d0:	a1 00 36 00 00       	mov    0x3600,%eax
+    15d5:	85 c0                	test   %eax,%eax
+    15d7:	75 3a                	jne    1613 <fwrite+0x163>
+  return (s - (const char*)p) / size;
+    15d9:	89 f0                	mov    %esi,%eax
+    15db:	99                   	cltd
+    15dc:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    15df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15e2:	5b                   	pop    %ebx
+    15e3:	5e                   	pop    %esi
+    15e4:	5f                   	pop    %edi
+    15e5:	5d                   	pop    %ebp
+    15e6:	c3                   	ret
+    flush(f);
+    15e7:	89 d8                	mov    %ebx,%eax
+    15e9:	e8 72 f8 ff ff       	call   e60 <flush>
+    15ee:	eb da                	jmp    15ca <fwrite+0x11a>
+    setup(f);
+    15f0:	89 d8                	mov    %ebx,%eax
+    15f2:	e8 19 f8 ff ff       	call   e10 <setup>
+    15f7:	e9 ec fe ff ff       	jmp    14e8 <fwrite+0x38>
+    mutex_lock(&f->lock);
+    15fc:	83 ec 0c             	sub    $0xc,%esp
+    15ff:	8d 43 18             	lea    0x18(%ebx),%eax
+    1602:	50                   	push   %eax
+    1603:	e8 98 f1 ff ff       	call   7a0 <mutex_lock>
+  if(!(f->flags & IO_SETUP))
+    1608:	8b 43 04             	mov    0x4(%ebx),%eax
+    160b:	83 c4 10             	add    $0x10,%esp
+    160e:	e9 cd fe ff ff       	jmp    14e0 <fwrite+0x30>
+    mutex_unlock(&f->lock);
+    1613:	83 ec 0c             	sub    $0xc,%esp
+    1616:	83 c3 18             	add    $0x18,%ebx
+    1619:	53                   	push   %ebx
+    161a:	e8 d1 f1 ff ff       	call   7f0 <mutex_unlock>
+    161f:	83 c4 10             	add    $0x10,%esp
+    1622:	eb b5                	jmp    15d9 <fwrite+0x129>
+  for(len = size*nmemb; len > 0; len -= n){
+    1624:	31 f6                	xor    %esi,%esi
+    1626:	eb a8                	jmp    15d0 <fwrite+0x120>
+    1628:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    162f:	90                   	nop
+
+00001630 <fgetc>:
+  return f->buf[f->r++] & 0xff;
+}
+
+int
+fgetc(FILE *f)
+{
+    1630:	55                   	push   %ebp
+    1631:	89 e5                	mov    %esp,%ebp
+    1633:	56                   	push   %esi
+    1634:	53                   	push   %ebx
+  if(threaded)
+    1635:	8b 15 00 36 00 00    	mov    0x3600,%edx
+{
+    163b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    163e:	85 d2                	test   %edx,%edx
+    1640:	75 2e                	jne    1670 <fgetc+0x40>
+  if(!(f->flags & IO_READ))
+    1642:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1646:	74 78                	je     16c0 <fgetc+0x90>
+  if(f->r == f->n && fill(f) == 0)
+    1648:	8b 43 10             	mov    0x10(%ebx),%eax
+    164b:	3b 43 14             	cmp    0x14(%ebx),%eax
+    164e:	74 60                	je     16b0 <fgetc+0x80>
+  return f->buf[f->r++] & 0xff;
+    1650:	8b 53 08             	mov    0x8(%ebx),%edx
+    1653:	8d 48 01             	lea    0x1(%eax),%ecx
+    1656:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1659:	0f b6 34 02          	movzbl (%edx,%eax,1),%esi
+  if(threaded)
+    165d:	a1 00 36 00 00       	mov    0x3600,%eax
+    1662:	85 c0                	test   %eax,%eax
+    1664:	75 2a                	jne    1690 <fgetc+0x60>
+
+  flockfile(f);
+  c = getc_unlocked(f);
+  funlockfile(f);
+  return c;
+}
+    1666:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1669:	89 f0                	mov    %esi,%eax
+    166b:	5b                   	pop    %ebx
+    166c:	5e                   	pop    %esi
+    166d:	5d                   	pop    %ebp
+    166e:	c3                   	ret
+    166f:	90                   	nop
+    mutex_lock(&f->lock);
+    1670:	83 ec 0c             	sub    $0xc,%esp
+    1673:	8d 43 18             	lea    0x18(%ebx),%eax
+    1676:	50                   	push   %eax
+    1677:	e8 24 f1 ff ff       	call   7a0 <mutex_lock>
+  if(!(f->flags & IO_READ))
+    167c:	83 c4 10             	add    $0x10,%esp
+    167f:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1683:	75 c3                	jne    1648 <fgetc+0x18>
+    return EOF;
+    1685:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    168a:	eb d1                	jmp    165d <fgetc+0x2d>
+    168c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1690:	83 ec 0c             	sub    $0xc,%esp
+    1693:	83 c3 18             	add    $0x18,%ebx
+    1696:	53                   	push   %ebx
+    1697:	e8 54 f1 ff ff       	call   7f0 <mutex_unlock>
+    169c:	83 c4 10             	add    $0x10,%esp
+}
+    169f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    16a2:	89 f0                	mov    %esi,%eax
+    16a4:	5b                   	pop    %ebx
+    16a5:	5e                   	pop    %esi
+    16a6:	5d                   	pop    %ebp
+    16a7:	c3                   	ret
+    16a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16af:	90                   	nop
+  if(f->r == f->n && fill(f) == 0)
+    16b0:	89 d8                	mov    %ebx,%eax
+    16b2:	e8 c9 f8 ff ff       	call   f80 <fill>
+    16b7:	85 c0                	test   %eax,%eax
+    16b9:	74 ca                	je     1685 <fgetc+0x55>
+  return f->buf[f->r++] & 0xff;
+    16bb:	8b 43 10             	mov    0x10(%ebx),%eax
+    16be:	eb 90                	jmp    1650 <fgetc+0x20>
+    return EOF;
+    16c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    16c5:	eb 9f                	jmp    1666 <fgetc+0x36>
+    16c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16ce:	66 90                	xchg   %ax,%ax
+
+000016d0 <fread>:
+
+int
+fread(void *p, int size, int nmemb, FILE *f)
+{
+    16d0:	55                   	push   %ebp
+    16d1:	89 e5                	mov    %esp,%ebp
+    16d3:	57                   	push   %edi
+    16d4:	56                   	push   %esi
+    16d5:	53                   	push   %ebx
+    16d6:	83 ec 1c             	sub    $0x1c,%esp
+    16d9:	8b 75 14             	mov    0x14(%ebp),%esi
+  char *d;
+  int n, len;
+
+  if(!(f->flags & IO_READ) || size <= 0)
+    16dc:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+    16e0:	74 7e                	je     1760 <fread+0x90>
+    16e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+    16e5:	85 d2                	test   %edx,%edx
+    16e7:	7e 77                	jle    1760 <fread+0x90>
+  if(threaded)
+    16e9:	a1 00 36 00 00       	mov    0x3600,%eax
+    return 0;
+  flockfile(f);
+  d = p;
+  for(len = size*nmemb; len > 0; len -= n){
+    16ee:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    16f1:	0f af 7d 10          	imul   0x10(%ebp),%edi
+  if(threaded)
+    16f5:	85 c0                	test   %eax,%eax
+    16f7:	0f 85 93 00 00 00    	jne    1790 <fread+0xc0>
+  for(len = size*nmemb; len > 0; len -= n){
+    16fd:	85 ff                	test   %edi,%edi
+    16ff:	7e 61                	jle    1762 <fread+0x92>
+    if(f->r == f->n && fill(f) == 0)
+    1701:	8b 46 10             	mov    0x10(%esi),%eax
+  d = p;
+    1704:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1707:	eb 35                	jmp    173e <fread+0x6e>
+    1709:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      break;
+    n = f->n - f->r;
+    1710:	29 c3                	sub    %eax,%ebx
+    1712:	39 fb                	cmp    %edi,%ebx
+    1714:	0f 4f df             	cmovg  %edi,%ebx
+    if(n > len)
+      n = len;
+    memmove(d, f->buf + f->r, n);
+    1717:	83 ec 04             	sub    $0x4,%esp
+    171a:	53                   	push   %ebx
+    171b:	03 46 08             	add    0x8(%esi),%eax
+  for(len = size*nmemb; len > 0; len -= n){
+    171e:	29 df                	sub    %ebx,%edi
+    memmove(d, f->buf + f->r, n);
+    1720:	50                   	push   %eax
+    1721:	51                   	push   %ecx
+    1722:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1725:	e8 36 f0 ff ff       	call   760 <memmove>
+    f->r += n;
+    172a:	8b 46 10             	mov    0x10(%esi),%eax
+    d += n;
+    172d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1730:	83 c4 10             	add    $0x10,%esp
+    f->r += n;
+    1733:	01 d8                	add    %ebx,%eax
+    d += n;
+    1735:	01 d9                	add    %ebx,%ecx
+    f->r += n;
+    1737:	89 46 10             	mov    %eax,0x10(%esi)
+  for(len = size*nmemb; len > 0; len -= n){
+    173a:	85 ff                	test   %edi,%edi
+    173c:	7e 32                	jle    1770 <fread+0xa0>
+    if(f->r == f->n && fill(f) == 0)
+    173e:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1741:	39 c3                	cmp    %eax,%ebx
+    1743:	75 cb                	jne    1710 <fread+0x40>
+    1745:	89 f0                	mov    %esi,%eax
+    1747:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    174a:	e8 31 f8 ff ff       	call   f80 <fill>
+    174f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1752:	85 c0                	test   %eax,%eax
+    1754:	74 1a                	je     1770 <fread+0xa0>
+    n = f->n - f->r;
+    1756:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1759:	8b 46 10             	mov    0x10(%esi),%eax
+    175c:	eb b2                	jmp    1710 <fread+0x40>
+    175e:	66 90                	xchg   %ax,%ax
+    return 0;
+    1760:	31 c0                	xor    %eax,%eax
+  }
+  funlockfile(f);
+  return (d - (char*)p) / size;
+}
+    1762:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1765:	5b                   	pop    %ebx
+    1766:	5e                   	pop    %esi
+    1767:	5f                   	pop    %edi
+    1768:	5d                   	pop    %ebp
+    1769:	c3                   	ret
+    176a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (d - (char*)p) / size;
+    1770:	2b 4d 08             	sub    0x8(%ebp),%ecx
+    1773:	89 cb                	mov    %ecx,%ebx
+  if(threaded)
+    1775:	a1 00 36 00 00       	mov    0x3600,%eax
+    177a:	85 c0                	test   %eax,%eax
+    177c:	75 32                	jne    17b0 <fread+0xe0>
+  return (d - (char*)p) / size;
+    177e:	89 d8                	mov    %ebx,%eax
+    1780:	99                   	cltd
+    1781:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1784:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1787:	5b                   	pop    %ebx
+    1788:	5e                   	pop    %esi
+    1789:	5f                   	pop    %edi
+    178a:	5d                   	pop    %ebp
+    178b:	c3                   	ret
+    178c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    1790:	83 ec 0c             	sub    $0xc,%esp
+    1793:	8d 46 18             	lea    0x18(%esi),%eax
+    1796:	50                   	push   %eax
+    1797:	e8 04 f0 ff ff       	call   7a0 <mutex_lock>
+  for(len = size*nmemb; len > 0; len -= n){
+    179c:	83 c4 10             	add    $0x10,%esp
+    179f:	85 ff                	test   %edi,%edi
+    17a1:	0f 8f 5a ff ff ff    	jg     1701 <fread+0x31>
+    17a7:	31 db                	xor    %ebx,%ebx
+    17a9:	eb ca                	jmp    1775 <fread+0xa5>
+    17ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    17af:	90                   	nop
+    mutex_unlock(&f->lock);
+    17b0:	83 ec 0c             	sub    $0xc,%esp
+    17b3:	83 c6 18             	add    $0x18,%esi
+    17b6:	56                   	push   %esi
+    17b7:	e8 34 f0 ff ff       	call   7f0 <mutex_unlock>
+  return (d - (char*)p) / size;
+    17bc:	89 d8                	mov    %ebx,%eax
+    17be:	83 c4 10             	add    $0x10,%esp
+    17c1:	99                   	cltd
+    17c2:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    17c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    17c8:	5b                   	pop    %ebx
+    17c9:	5e                   	pop    %esi
+    17ca:	5f                   	pop    %edi
+    17cb:	5d                   	pop    %ebp
+    17cc:	c3                   	ret
+    17cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000017d0 <fgets>:
+
+// Read a line of at most max-1 bytes, keeping the newline.
+// Returns 0 if there was nothing left to read.
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    17d0:	55                   	push   %ebp
+    17d1:	89 e5                	mov    %esp,%ebp
+    17d3:	57                   	push   %edi
+    17d4:	56                   	push   %esi
+    17d5:	53                   	push   %ebx
+    17d6:	83 ec 1c             	sub    $0x1c,%esp
+  if(threaded)
+    17d9:	8b 35 00 36 00 00    	mov    0x3600,%esi
+{
+    17df:	8b 7d 08             	mov    0x8(%ebp),%edi
+    17e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if(threaded)
+    17e5:	85 f6                	test   %esi,%esi
+    17e7:	0f 85 83 00 00 00    	jne    1870 <fgets+0xa0>
+{
+    17ed:	31 f6                	xor    %esi,%esi
+    17ef:	eb 2a                	jmp    181b <fgets+0x4b>
+    17f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return f->buf[f->r++] & 0xff;
+    17f8:	8b 53 08             	mov    0x8(%ebx),%edx
+    17fb:	8d 48 01             	lea    0x1(%eax),%ecx
+    17fe:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1801:	0f b6 14 02          	movzbl (%edx,%eax,1),%edx
+
+  flockfile(f);
+  for(i = 0; i+1 < max; ){
+    if((c = getc_unlocked(f)) == EOF)
+      break;
+    buf[i++] = c;
+    1805:	88 54 37 ff          	mov    %dl,-0x1(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    1809:	80 fa 0a             	cmp    $0xa,%dl
+    180c:	0f 84 96 00 00 00    	je     18a8 <fgets+0xd8>
+    1812:	83 fa 0d             	cmp    $0xd,%edx
+    1815:	0f 84 8d 00 00 00    	je     18a8 <fgets+0xd8>
+  for(i = 0; i+1 < max; ){
+    181b:	89 f2                	mov    %esi,%edx
+    181d:	83 c6 01             	add    $0x1,%esi
+    1820:	3b 75 0c             	cmp    0xc(%ebp),%esi
+    1823:	7d 2b                	jge    1850 <fgets+0x80>
+  if(!(f->flags & IO_READ))
+    1825:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1829:	74 25                	je     1850 <fgets+0x80>
+  if(f->r == f->n && fill(f) == 0)
+    182b:	8b 43 10             	mov    0x10(%ebx),%eax
+    182e:	3b 43 14             	cmp    0x14(%ebx),%eax
+    1831:	75 c5                	jne    17f8 <fgets+0x28>
+    1833:	89 d8                	mov    %ebx,%eax
+    1835:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1838:	e8 43 f7 ff ff       	call   f80 <fill>
+    183d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1840:	85 c0                	test   %eax,%eax
+    1842:	74 0c                	je     1850 <fgets+0x80>
+  return f->buf[f->r++] & 0xff;
+    1844:	8b 43 10             	mov    0x10(%ebx),%eax
+    1847:	eb af                	jmp    17f8 <fgets+0x28>
+    1849:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1850:	8b 0d 00 36 00 00    	mov    0x3600,%ecx
+      break;
+  }
+  buf[i] = '\0';
+    1856:	c6 04 17 00          	movb   $0x0,(%edi,%edx,1)
+  if(threaded)
+    185a:	85 c9                	test   %ecx,%ecx
+    185c:	75 2a                	jne    1888 <fgets+0xb8>
+  funlockfile(f);
+  return i > 0 ? buf : 0;
+    185e:	31 c0                	xor    %eax,%eax
+    1860:	85 d2                	test   %edx,%edx
+    1862:	74 02                	je     1866 <fgets+0x96>
+    1864:	89 f8                	mov    %edi,%eax
+}
+    1866:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1869:	5b                   	pop    %ebx
+    186a:	5e                   	pop    %esi
+    186b:	5f                   	pop    %edi
+    186c:	5d                   	pop    %ebp
+    186d:	c3                   	ret
+    186e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    1870:	83 ec 0c             	sub    $0xc,%esp
+    1873:	8d 43 18             	lea    0x18(%ebx),%eax
+    1876:	50                   	push   %eax
+    1877:	e8 24 ef ff ff       	call   7a0 <mutex_lock>
+    187c:	83 c4 10             	add    $0x10,%esp
+    187f:	e9 69 ff ff ff       	jmp    17ed <fgets+0x1d>
+    1884:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1888:	83 ec 0c             	sub    $0xc,%esp
+    188b:	83 c3 18             	add    $0x18,%ebx
+    188e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1891:	53                   	push   %ebx
+    1892:	e8 59 ef ff ff       	call   7f0 <mutex_unlock>
+    1897:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    189a:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    189d:	31 c0                	xor    %eax,%eax
+    189f:	85 d2                	test   %edx,%edx
+    18a1:	75 c1                	jne    1864 <fgets+0x94>
+    18a3:	eb c1                	jmp    1866 <fgets+0x96>
+    18a5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    18a8:	a1 00 36 00 00       	mov    0x3600,%eax
+  buf[i] = '\0';
+    18ad:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  if(threaded)
+    18b1:	85 c0                	test   %eax,%eax
+    18b3:	74 af                	je     1864 <fgets+0x94>
+    mutex_unlock(&f->lock);
+    18b5:	83 ec 0c             	sub    $0xc,%esp
+    18b8:	83 c3 18             	add    $0x18,%ebx
+    18bb:	53                   	push   %ebx
+    18bc:	e8 2f ef ff ff       	call   7f0 <mutex_unlock>
+    18c1:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    18c4:	89 f8                	mov    %edi,%eax
+    18c6:	eb 9e                	jmp    1866 <fgets+0x96>
+    18c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18cf:	90                   	nop
+
+000018d0 <gets>:
+// at most a line per read(), goes through stdin's buffer: from a
+// file or pipe, a buffered read could take input meant for a child
+// process, so read a byte at a time.
+char*
+gets(char *buf, int max)
+{
+    18d0:	55                   	push   %ebp
+    18d1:	89 e5                	mov    %esp,%ebp
+    18d3:	57                   	push   %edi
+    18d4:	56                   	push   %esi
+    18d5:	53                   	push   %ebx
+    18d6:	83 ec 2c             	sub    $0x2c,%esp
+  int i, cc;
+  char c;
+
+  if(!(stdin->flags & IO_SETUP))
+    18d9:	8b 15 44 2e 00 00    	mov    0x2e44,%edx
+{
+    18df:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!(stdin->flags & IO_SETUP))
+    18e2:	f6 c2 40             	test   $0x40,%dl
+    18e5:	74 79                	je     1960 <gets+0x90>
+    setup(stdin);
+  if(stdin->flags & IO_DEV){
+    18e7:	83 e2 20             	and    $0x20,%edx
+    18ea:	89 d7                	mov    %edx,%edi
+    18ec:	75 52                	jne    1940 <gets+0x70>
+  if(f == 0){
+    18ee:	e8 ed f5 ff ff       	call   ee0 <fflush.part.0>
+    fgets(buf, max, stdin);
+    return buf;
+  }
+  fflush(0);
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    18f3:	8d 75 e7             	lea    -0x19(%ebp),%esi
+  for(i=0; i+1 < max; ){
+    18f6:	eb 2c                	jmp    1924 <gets+0x54>
+    18f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18ff:	90                   	nop
+    cc = read(0, &c, 1);
+    1900:	83 ec 04             	sub    $0x4,%esp
+    1903:	6a 01                	push   $0x1
+    1905:	56                   	push   %esi
+    1906:	6a 00                	push   $0x0
+    1908:	e8 f5 ef ff ff       	call   902 <read>
+    if(cc < 1)
+    190d:	83 c4 10             	add    $0x10,%esp
+    1910:	85 c0                	test   %eax,%eax
+    1912:	7e 1b                	jle    192f <gets+0x5f>
+      break;
+    buf[i++] = c;
+    1914:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1918:	88 44 3b ff          	mov    %al,-0x1(%ebx,%edi,1)
+    if(c == '\n' || c == '\r')
+    191c:	3c 0a                	cmp    $0xa,%al
+    191e:	74 12                	je     1932 <gets+0x62>
+    1920:	3c 0d                	cmp    $0xd,%al
+    1922:	74 0e                	je     1932 <gets+0x62>
+  for(i=0; i+1 < max; ){
+    1924:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    1927:	83 c7 01             	add    $0x1,%edi
+    192a:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+    192d:	7c d1                	jl     1900 <gets+0x30>
+{
+    192f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      break;
+  }
+  buf[i] = '\0';
+    1932:	c6 04 3b 00          	movb   $0x0,(%ebx,%edi,1)
+  return buf;
+}
+    1936:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1939:	89 d8                	mov    %ebx,%eax
+    193b:	5b                   	pop    %ebx
+    193c:	5e                   	pop    %esi
+    193d:	5f                   	pop    %edi
+    193e:	5d                   	pop    %ebp
+    193f:	c3                   	ret
+    fgets(buf, max, stdin);
+    1940:	83 ec 04             	sub    $0x4,%esp
+    1943:	68 40 2e 00 00       	push   $0x2e40
+    1948:	ff 75 0c             	push   0xc(%ebp)
+    194b:	53                   	push   %ebx
+    194c:	e8 7f fe ff ff       	call   17d0 <fgets>
+    return buf;
+    1951:	83 c4 10             	add    $0x10,%esp
+}
+    1954:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1957:	89 d8                	mov    %ebx,%eax
+    1959:	5b                   	pop    %ebx
+    195a:	5e                   	pop    %esi
+    195b:	5f                   	pop    %edi
+    195c:	5d                   	pop    %ebp
+    195d:	c3                   	ret
+    195e:	66 90                	xchg   %ax,%ax
+    setup(stdin);
+    1960:	b8 40 2e 00 00       	mov    $0x2e40,%eax
+    1965:	e8 a6 f4 ff ff       	call   e10 <setup>
+  if(stdin->flags & IO_DEV){
+    196a:	8b 15 44 2e 00 00    	mov    0x2e44,%edx
+    1970:	e9 72 ff ff ff       	jmp    18e7 <gets+0x17>
+    1975:	66 90                	xchg   %ax,%ax
+    1977:	66 90                	xchg   %ax,%ax
+    1979:	66 90                	xchg   %ax,%ax
+    197b:	66 90                	xchg   %ax,%ax
+    197d:	66 90                	xchg   %ax,%ax
+    197f:	90                   	nop
+
+00001980 <bigfree>:
+
+// Give a big block back to the first-fit list, and return the
+// free block that now holds it. Caller holds lock.
+static Header*
+bigfree(Header *bp)
+{
+    1980:	55                   	push   %ebp
+    1981:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1983:	a1 a4 3c 00 00       	mov    0x3ca4,%eax
+{
+    1988:	89 e5                	mov    %esp,%ebp
+    198a:	56                   	push   %esi
+    198b:	53                   	push   %ebx
+    198c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1990:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1992:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1994:	39 ca                	cmp    %ecx,%edx
+    1996:	73 38                	jae    19d0 <bigfree+0x50>
+    1998:	39 c1                	cmp    %eax,%ecx
+    199a:	72 04                	jb     19a0 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    199c:	39 c2                	cmp    %eax,%edx
+    199e:	72 f0                	jb     1990 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    19a0:	8b 59 04             	mov    0x4(%ecx),%ebx
+    19a3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    19a6:	39 f0                	cmp    %esi,%eax
+    19a8:	74 36                	je     19e0 <bigfree+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    19aa:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  freep = p;
+  if(p + p->s.size == bp){
+    19ac:	8b 42 04             	mov    0x4(%edx),%eax
+    19af:	89 cb                	mov    %ecx,%ebx
+  freep = p;
+    19b1:	89 15 a4 3c 00 00    	mov    %edx,0x3ca4
+  if(p + p->s.size == bp){
+    19b7:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    19ba:	39 f1                	cmp    %esi,%ecx
+    19bc:	74 2e                	je     19ec <bigfree+0x6c>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    19be:	89 1a                	mov    %ebx,(%edx)
+    return p;
+  }
+  p->s.ptr = bp;
+  return bp;
+}
+    19c0:	89 c8                	mov    %ecx,%eax
+    19c2:	5b                   	pop    %ebx
+    19c3:	5e                   	pop    %esi
+    19c4:	5d                   	pop    %ebp
+    19c5:	c3                   	ret
+    19c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19cd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    19d0:	39 c1                	cmp    %eax,%ecx
+    19d2:	72 c8                	jb     199c <bigfree+0x1c>
+    19d4:	eb ba                	jmp    1990 <bigfree+0x10>
+    19d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    19e0:	03 58 04             	add    0x4(%eax),%ebx
+    19e3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    19e6:	8b 02                	mov    (%edx),%eax
+    19e8:	8b 00                	mov    (%eax),%eax
+    19ea:	eb be                	jmp    19aa <bigfree+0x2a>
+    p->s.size += bp->s.size;
+    19ec:	03 41 04             	add    0x4(%ecx),%eax
+    19ef:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    19f2:	8b 19                	mov    (%ecx),%ebx
+    return p;
+    19f4:	89 d1                	mov    %edx,%ecx
+}
+    19f6:	89 c8                	mov    %ecx,%eax
+    p->s.ptr = bp->s.ptr;
+    19f8:	89 1a                	mov    %ebx,(%edx)
+}
+    19fa:	5b                   	pop    %ebx
+    19fb:	5e                   	pop    %esi
+    19fc:	5d                   	pop    %ebp
+    19fd:	c3                   	ret
+    19fe:	66 90                	xchg   %ax,%ax
+
+00001a00 <trim>:
+// If free block bp ends the heap, return its whole pages to the
+// kernel, unless something else has moved the break since.
+// Caller holds lock.
+static void
+trim(Header *bp)
+{
+    1a00:	55                   	push   %ebp
+    1a01:	89 e5                	mov    %esp,%ebp
+    1a03:	57                   	push   %edi
+    1a04:	56                   	push   %esi
+    1a05:	53                   	push   %ebx
+    1a06:	89 c3                	mov    %eax,%ebx
+    1a08:	83 ec 0c             	sub    $0xc,%esp
+  char *end;
+  uint n;
+
+  if((char*)(bp + bp->s.size) != heapend)
+    1a0b:	8b 53 04             	mov    0x4(%ebx),%edx
+    1a0e:	a1 a0 3c 00 00       	mov    0x3ca0,%eax
+    1a13:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+    1a16:	39 d0                	cmp    %edx,%eax
+    1a18:	74 0e                	je     1a28 <trim+0x28>
+  n = heapend - end;
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    bp->s.size -= n / sizeof(Header);
+    heapend = end;
+  }
+}
+    1a1a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a1d:	5b                   	pop    %ebx
+    1a1e:	5e                   	pop    %esi
+    1a1f:	5f                   	pop    %edi
+    1a20:	5d                   	pop    %ebp
+    1a21:	c3                   	ret
+    1a22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  end = (char*)PGROUNDUP((uint)(bp + 2));
+    1a28:	8d bb 0f 10 00 00    	lea    0x100f(%ebx),%edi
+    1a2e:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  n = heapend - end;
+    1a34:	29 f8                	sub    %edi,%eax
+    1a36:	89 c6                	mov    %eax,%esi
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    1a38:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    1a3d:	76 db                	jbe    1a1a <trim+0x1a>
+    1a3f:	83 ec 0c             	sub    $0xc,%esp
+    1a42:	6a 00                	push   $0x0
+    1a44:	e8 8b ef ff ff       	call   9d4 <sbrk>
+    1a49:	83 c4 10             	add    $0x10,%esp
+    1a4c:	39 05 a0 3c 00 00    	cmp    %eax,0x3ca0
+    1a52:	75 c6                	jne    1a1a <trim+0x1a>
+    1a54:	89 f0                	mov    %esi,%eax
+    1a56:	83 ec 0c             	sub    $0xc,%esp
+    1a59:	f7 d8                	neg    %eax
+    1a5b:	50                   	push   %eax
+    1a5c:	e8 73 ef ff ff       	call   9d4 <sbrk>
+    1a61:	83 c4 10             	add    $0x10,%esp
+    1a64:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1a67:	74 b1                	je     1a1a <trim+0x1a>
+    bp->s.size -= n / sizeof(Header);
+    1a69:	89 f0                	mov    %esi,%eax
+    heapend = end;
+    1a6b:	89 3d a0 3c 00 00    	mov    %edi,0x3ca0
+    bp->s.size -= n / sizeof(Header);
+    1a71:	c1 e8 03             	shr    $0x3,%eax
+    1a74:	29 43 04             	sub    %eax,0x4(%ebx)
+    heapend = end;
+    1a77:	eb a1                	jmp    1a1a <trim+0x1a>
+    1a79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001a80 <bigalloc>:
+}
+
+// Allocate a big block of nunits units. Caller holds lock.
+static Header*
+bigalloc(uint nunits)
+{
+    1a80:	55                   	push   %ebp
+    1a81:	89 e5                	mov    %esp,%ebp
+    1a83:	57                   	push   %edi
+    1a84:	89 c7                	mov    %eax,%edi
+    1a86:	56                   	push   %esi
+    1a87:	53                   	push   %ebx
+    1a88:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    1a8b:	a1 a4 3c 00 00       	mov    0x3ca4,%eax
+    1a90:	85 c0                	test   %eax,%eax
+    1a92:	0f 84 98 00 00 00    	je     1b30 <bigalloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1a98:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    1a9a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    1a9d:	39 f9                	cmp    %edi,%ecx
+    1a9f:	73 67                	jae    1b08 <bigalloc+0x88>
+  if(nu < 4096)
+    1aa1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1aa6:	39 df                	cmp    %ebx,%edi
+    1aa8:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1aab:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    1ab2:	eb 0d                	jmp    1ac1 <bigalloc+0x41>
+    1ab4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1ab8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    1aba:	8b 4a 04             	mov    0x4(%edx),%ecx
+    1abd:	39 f9                	cmp    %edi,%ecx
+    1abf:	73 47                	jae    1b08 <bigalloc+0x88>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    1ac1:	89 d0                	mov    %edx,%eax
+    1ac3:	39 15 a4 3c 00 00    	cmp    %edx,0x3ca4
+    1ac9:	75 ed                	jne    1ab8 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    1acb:	83 ec 0c             	sub    $0xc,%esp
+    1ace:	56                   	push   %esi
+    1acf:	e8 00 ef ff ff       	call   9d4 <sbrk>
+  if(p == (char*)-1)
+    1ad4:	83 c4 10             	add    $0x10,%esp
+    1ad7:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1ada:	74 1a                	je     1af6 <bigalloc+0x76>
+  hp->s.size = nu;
+    1adc:	89 58 04             	mov    %ebx,0x4(%eax)
+  heapend = p + nu * sizeof(Header);
+    1adf:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    1ae2:	89 15 a0 3c 00 00    	mov    %edx,0x3ca0
+  bigfree(hp);
+    1ae8:	e8 93 fe ff ff       	call   1980 <bigfree>
+  return freep;
+    1aed:	a1 a4 3c 00 00       	mov    0x3ca4,%eax
+      if((p = morecore(nunits)) == 0)
+    1af2:	85 c0                	test   %eax,%eax
+    1af4:	75 c2                	jne    1ab8 <bigalloc+0x38>
+        return 0;
+  }
+}
+    1af6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1af9:	31 d2                	xor    %edx,%edx
+}
+    1afb:	5b                   	pop    %ebx
+    1afc:	89 d0                	mov    %edx,%eax
+    1afe:	5e                   	pop    %esi
+    1aff:	5f                   	pop    %edi
+    1b00:	5d                   	pop    %ebp
+    1b01:	c3                   	ret
+    1b02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1b08:	39 cf                	cmp    %ecx,%edi
+    1b0a:	74 54                	je     1b60 <bigalloc+0xe0>
+        p->s.size -= nunits;
+    1b0c:	29 f9                	sub    %edi,%ecx
+    1b0e:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    1b11:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    1b14:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    1b17:	a3 a4 3c 00 00       	mov    %eax,0x3ca4
+}
+    1b1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b1f:	89 d0                	mov    %edx,%eax
+    1b21:	5b                   	pop    %ebx
+    1b22:	5e                   	pop    %esi
+    1b23:	5f                   	pop    %edi
+    1b24:	5d                   	pop    %ebp
+    1b25:	c3                   	ret
+    1b26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b2d:	8d 76 00             	lea    0x0(%esi),%esi
+    base.s.ptr = freep = prevp = &base;
+    1b30:	c7 05 a4 3c 00 00 a8 	movl   $0x3ca8,0x3ca4
+    1b37:	3c 00 00 
+    base.s.size = 0;
+    1b3a:	ba a8 3c 00 00       	mov    $0x3ca8,%edx
+    base.s.ptr = freep = prevp = &base;
+    1b3f:	c7 05 a8 3c 00 00 a8 	movl   $0x3ca8,0x3ca8
+    1b46:	3c 00 00 
+    base.s.size = 0;
+    1b49:	c7 05 ac 3c 00 00 00 	movl   $0x0,0x3cac
+    1b50:	00 00 00 
+    if(p->s.size >= nunits){
+    1b53:	e9 49 ff ff ff       	jmp    1aa1 <bigalloc+0x21>
+    1b58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b5f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1b60:	8b 0a                	mov    (%edx),%ecx
+    1b62:	89 08                	mov    %ecx,(%eax)
+    1b64:	eb b1                	jmp    1b17 <bigalloc+0x97>
+    1b66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001b70 <drain>:
+}
+
+// Move n blocks of class c from cache tc to the shared list.
+static void
+drain(struct tcache *tc, int c, int n)
+{
+    1b70:	55                   	push   %ebp
+    1b71:	89 e5                	mov    %esp,%ebp
+    1b73:	57                   	push   %edi
+    1b74:	89 c7                	mov    %eax,%edi
+    1b76:	56                   	push   %esi
+    1b77:	89 d6                	mov    %edx,%esi
+    1b79:	53                   	push   %ebx
+    1b7a:	89 cb                	mov    %ecx,%ebx
+    1b7c:	83 ec 0c             	sub    $0xc,%esp
+  if(threaded)
+    1b7f:	8b 15 24 3c 00 00    	mov    0x3c24,%edx
+    1b85:	85 d2                	test   %edx,%edx
+    1b87:	75 57                	jne    1be0 <drain+0x70>
+  Header *p;
+
+  acquire();
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1b89:	85 c9                	test   %ecx,%ecx
+    1b8b:	7e 49                	jle    1bd6 <drain+0x66>
+    1b8d:	89 d9                	mov    %ebx,%ecx
+    1b8f:	8d 14 b7             	lea    (%edi,%esi,4),%edx
+    1b92:	eb 23                	jmp    1bb7 <drain+0x47>
+    1b94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    tc->list[c] = p->s.ptr;
+    1b98:	8b 18                	mov    (%eax),%ebx
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1b9a:	83 e9 01             	sub    $0x1,%ecx
+    tc->n[c]--;
+    1b9d:	83 6a 20 01          	subl   $0x1,0x20(%edx)
+    tc->list[c] = p->s.ptr;
+    1ba1:	89 1a                	mov    %ebx,(%edx)
+    p->s.ptr = small[c];
+    1ba3:	8b 1c b5 80 3c 00 00 	mov    0x3c80(,%esi,4),%ebx
+    1baa:	89 18                	mov    %ebx,(%eax)
+    small[c] = p;
+    1bac:	89 04 b5 80 3c 00 00 	mov    %eax,0x3c80(,%esi,4)
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1bb3:	85 c9                	test   %ecx,%ecx
+    1bb5:	7e 06                	jle    1bbd <drain+0x4d>
+    1bb7:	8b 02                	mov    (%edx),%eax
+    1bb9:	85 c0                	test   %eax,%eax
+    1bbb:	75 db                	jne    1b98 <drain+0x28>
+  if(threaded)
+    1bbd:	a1 24 3c 00 00       	mov    0x3c24,%eax
+    1bc2:	85 c0                	test   %eax,%eax
+    1bc4:	74 10                	je     1bd6 <drain+0x66>
+    mutex_unlock(&lock);
+    1bc6:	83 ec 0c             	sub    $0xc,%esp
+    1bc9:	68 28 3c 00 00       	push   $0x3c28
+    1bce:	e8 1d ec ff ff       	call   7f0 <mutex_unlock>
+}
+    1bd3:	83 c4 10             	add    $0x10,%esp
+  }
+  release();
+}
+    1bd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1bd9:	5b                   	pop    %ebx
+    1bda:	5e                   	pop    %esi
+    1bdb:	5f                   	pop    %edi
+    1bdc:	5d                   	pop    %ebp
+    1bdd:	c3                   	ret
+    1bde:	66 90                	xchg   %ax,%ax
+    mutex_lock(&lock);
+    1be0:	83 ec 0c             	sub    $0xc,%esp
+    1be3:	68 28 3c 00 00       	push   $0x3c28
+    1be8:	e8 b3 eb ff ff       	call   7a0 <mutex_lock>
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1bed:	83 c4 10             	add    $0x10,%esp
+    1bf0:	85 db                	test   %ebx,%ebx
+    1bf2:	7f 99                	jg     1b8d <drain+0x1d>
+    1bf4:	eb c7                	jmp    1bbd <drain+0x4d>
+    1bf6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bfd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001c00 <mycache>:
+{
+    1c00:	55                   	push   %ebp
+    return &maincache;
+    1c01:	b8 40 3c 00 00       	mov    $0x3c40,%eax
+{
+    1c06:	89 e5                	mov    %esp,%ebp
+    1c08:	53                   	push   %ebx
+  sp = PGROUNDDOWN((uint)&sp);
+    1c09:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+    1c0c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+    1c12:	83 ec 14             	sub    $0x14,%esp
+  if(!threaded || sp == mainstack)
+    1c15:	8b 0d 24 3c 00 00    	mov    0x3c24,%ecx
+  sp = PGROUNDDOWN((uint)&sp);
+    1c1b:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  if(!threaded || sp == mainstack)
+    1c1e:	85 c9                	test   %ecx,%ecx
+    1c20:	74 0f                	je     1c31 <mycache+0x31>
+    1c22:	3b 1d 20 3c 00 00    	cmp    0x3c20,%ebx
+    1c28:	74 07                	je     1c31 <mycache+0x31>
+  if(*cp == 0){
+    1c2a:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    1c2d:	85 c0                	test   %eax,%eax
+    1c2f:	74 0f                	je     1c40 <mycache+0x40>
+}
+    1c31:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1c34:	c9                   	leave
+    1c35:	c3                   	ret
+    1c36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c3d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1c40:	83 ec 0c             	sub    $0xc,%esp
+    1c43:	68 28 3c 00 00       	push   $0x3c28
+    1c48:	e8 53 eb ff ff       	call   7a0 <mutex_lock>
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    1c4d:	b8 09 00 00 00       	mov    $0x9,%eax
+    1c52:	e8 29 fe ff ff       	call   1a80 <bigalloc>
+  if(threaded)
+    1c57:	8b 15 24 3c 00 00    	mov    0x3c24,%edx
+    1c5d:	83 c4 10             	add    $0x10,%esp
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    1c60:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(threaded)
+    1c63:	85 d2                	test   %edx,%edx
+    1c65:	75 29                	jne    1c90 <mycache+0x90>
+    if(*cp == 0)
+    1c67:	85 c0                	test   %eax,%eax
+    1c69:	74 c6                	je     1c31 <mycache+0x31>
+    memset(*cp, 0, sizeof(**cp));
+    1c6b:	83 ec 04             	sub    $0x4,%esp
+    *cp = (struct tcache*)((Header*)*cp + 1);
+    1c6e:	83 c0 08             	add    $0x8,%eax
+    1c71:	89 43 f8             	mov    %eax,-0x8(%ebx)
+    memset(*cp, 0, sizeof(**cp));
+    1c74:	6a 40                	push   $0x40
+    1c76:	6a 00                	push   $0x0
+    1c78:	50                   	push   %eax
+    1c79:	e8 f2 e9 ff ff       	call   670 <memset>
+  return *cp;
+    1c7e:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    1c81:	83 c4 10             	add    $0x10,%esp
+    1c84:	eb ab                	jmp    1c31 <mycache+0x31>
+    1c86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c8d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1c90:	83 ec 0c             	sub    $0xc,%esp
+    1c93:	68 28 3c 00 00       	push   $0x3c28
+    1c98:	e8 53 eb ff ff       	call   7f0 <mutex_unlock>
+    if(*cp == 0)
+    1c9d:	8b 43 f8             	mov    -0x8(%ebx),%eax
+}
+    1ca0:	83 c4 10             	add    $0x10,%esp
+    1ca3:	eb c2                	jmp    1c67 <mycache+0x67>
+    1ca5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1cac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001cb0 <free>:
+
+void
+free(void *ap)
+{
+    1cb0:	55                   	push   %ebp
+    1cb1:	89 e5                	mov    %esp,%ebp
+    1cb3:	57                   	push   %edi
+    1cb4:	56                   	push   %esi
+    1cb5:	53                   	push   %ebx
+    1cb6:	83 ec 1c             	sub    $0x1c,%esp
+    1cb9:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  struct tcache *tc;
+  int c;
+
+  if(ap == 0)
+    1cbc:	85 f6                	test   %esi,%esi
+    1cbe:	74 51                	je     1d11 <free+0x61>
+    return;
+  bp = (Header*)ap - 1;
+    1cc0:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1cc3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(bp->s.size > SMALLMAX / sizeof(Header)){
+    1cc6:	8b 46 fc             	mov    -0x4(%esi),%eax
+    1cc9:	3d 00 01 00 00       	cmp    $0x100,%eax
+    1cce:	77 50                	ja     1d20 <free+0x70>
+    acquire();
+    trim(bigfree(bp));
+    release();
+    return;
+  }
+  for(c = 0; (2 << c) < bp->s.size; c++)
+    1cd0:	31 db                	xor    %ebx,%ebx
+    1cd2:	ba 02 00 00 00       	mov    $0x2,%edx
+    1cd7:	83 f8 02             	cmp    $0x2,%eax
+    1cda:	76 11                	jbe    1ced <free+0x3d>
+    1cdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1ce0:	83 c3 01             	add    $0x1,%ebx
+    1ce3:	89 d7                	mov    %edx,%edi
+    1ce5:	89 d9                	mov    %ebx,%ecx
+    1ce7:	d3 e7                	shl    %cl,%edi
+    1ce9:	39 c7                	cmp    %eax,%edi
+    1ceb:	72 f3                	jb     1ce0 <free+0x30>
+    ;
+  if((tc = mycache()) == 0){
+    1ced:	e8 0e ff ff ff       	call   1c00 <mycache>
+    1cf2:	85 c0                	test   %eax,%eax
+    1cf4:	74 7a                	je     1d70 <free+0xc0>
+    bp->s.ptr = small[c];
+    small[c] = bp;
+    release();
+    return;
+  }
+  bp->s.ptr = tc->list[c];
+    1cf6:	8d 0c 98             	lea    (%eax,%ebx,4),%ecx
+    1cf9:	8b 11                	mov    (%ecx),%edx
+    1cfb:	89 56 f8             	mov    %edx,-0x8(%esi)
+  tc->list[c] = bp;
+    1cfe:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1d01:	89 31                	mov    %esi,(%ecx)
+  if(++tc->n[c] > TCACHEMAX)
+    1d03:	8b 71 20             	mov    0x20(%ecx),%esi
+    1d06:	8d 56 01             	lea    0x1(%esi),%edx
+    1d09:	89 51 20             	mov    %edx,0x20(%ecx)
+    1d0c:	83 fa 20             	cmp    $0x20,%edx
+    1d0f:	7f 47                	jg     1d58 <free+0xa8>
+    drain(tc, c, BATCH);
+}
+    1d11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d14:	5b                   	pop    %ebx
+    1d15:	5e                   	pop    %esi
+    1d16:	5f                   	pop    %edi
+    1d17:	5d                   	pop    %ebp
+    1d18:	c3                   	ret
+    1d19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1d20:	8b 1d 24 3c 00 00    	mov    0x3c24,%ebx
+    1d26:	85 db                	test   %ebx,%ebx
+    1d28:	75 66                	jne    1d90 <free+0xe0>
+    trim(bigfree(bp));
+    1d2a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1d2d:	e8 4e fc ff ff       	call   1980 <bigfree>
+    1d32:	e8 c9 fc ff ff       	call   1a00 <trim>
+  if(threaded)
+    1d37:	8b 0d 24 3c 00 00    	mov    0x3c24,%ecx
+    1d3d:	85 c9                	test   %ecx,%ecx
+    1d3f:	74 d0                	je     1d11 <free+0x61>
+    mutex_unlock(&lock);
+    1d41:	c7 45 08 28 3c 00 00 	movl   $0x3c28,0x8(%ebp)
+}
+    1d48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d4b:	5b                   	pop    %ebx
+    1d4c:	5e                   	pop    %esi
+    1d4d:	5f                   	pop    %edi
+    1d4e:	5d                   	pop    %ebp
+    mutex_unlock(&lock);
+    1d4f:	e9 9c ea ff ff       	jmp    7f0 <mutex_unlock>
+    1d54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    1d58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    drain(tc, c, BATCH);
+    1d5b:	89 da                	mov    %ebx,%edx
+    1d5d:	b9 10 00 00 00       	mov    $0x10,%ecx
+}
+    1d62:	5b                   	pop    %ebx
+    1d63:	5e                   	pop    %esi
+    1d64:	5f                   	pop    %edi
+    1d65:	5d                   	pop    %ebp
+    drain(tc, c, BATCH);
+    1d66:	e9 05 fe ff ff       	jmp    1b70 <drain>
+    1d6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1d6f:	90                   	nop
+  if(threaded)
+    1d70:	8b 15 24 3c 00 00    	mov    0x3c24,%edx
+    1d76:	85 d2                	test   %edx,%edx
+    1d78:	75 28                	jne    1da2 <free+0xf2>
+    bp->s.ptr = small[c];
+    1d7a:	8b 04 9d 80 3c 00 00 	mov    0x3c80(,%ebx,4),%eax
+    1d81:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1d84:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1d87:	89 04 9d 80 3c 00 00 	mov    %eax,0x3c80(,%ebx,4)
+  if(threaded)
+    1d8e:	eb 81                	jmp    1d11 <free+0x61>
+    mutex_lock(&lock);
+    1d90:	83 ec 0c             	sub    $0xc,%esp
+    1d93:	68 28 3c 00 00       	push   $0x3c28
+    1d98:	e8 03 ea ff ff       	call   7a0 <mutex_lock>
+}
+    1d9d:	83 c4 10             	add    $0x10,%esp
+    1da0:	eb 88                	jmp    1d2a <free+0x7a>
+    mutex_lock(&lock);
+    1da2:	83 ec 0c             	sub    $0xc,%esp
+    1da5:	68 28 3c 00 00       	push   $0x3c28
+    1daa:	e8 f1 e9 ff ff       	call   7a0 <mutex_lock>
+    bp->s.ptr = small[c];
+    1daf:	8b 04 9d 80 3c 00 00 	mov    0x3c80(,%ebx,4),%eax
+  if(threaded)
+    1db6:	83 c4 10             	add    $0x10,%esp
+    bp->s.ptr = small[c];
+    1db9:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1dbc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1dbf:	89 04 9d 80 3c 00 00 	mov    %eax,0x3c80(,%ebx,4)
+  if(threaded)
+    1dc6:	a1 24 3c 00 00       	mov    0x3c24,%eax
+    1dcb:	85 c0                	test   %eax,%eax
+    1dcd:	0f 85 6e ff ff ff    	jne    1d41 <free+0x91>
+    1dd3:	e9 39 ff ff ff       	jmp    1d11 <free+0x61>
+    1dd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ddf:	90                   	nop
+
+00001de0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1de0:	55                   	push   %ebp
+    1de1:	89 e5                	mov    %esp,%ebp
+    1de3:	57                   	push   %edi
+    1de4:	56                   	push   %esi
+    1de5:	53                   	push   %ebx
+    1de6:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  struct tcache *tc;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1de9:	8b 45 08             	mov    0x8(%ebp),%eax
+    1dec:	8d 78 07             	lea    0x7(%eax),%edi
+    1def:	c1 ef 03             	shr    $0x3,%edi
+    1df2:	83 c7 01             	add    $0x1,%edi
+  if(nunits > SMALLMAX / sizeof(Header)){
+    1df5:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+    1dfb:	77 5b                	ja     1e58 <malloc+0x78>
+    acquire();
+    p = bigalloc(nunits);
+    release();
+    return p ? (void*)(p + 1) : 0;
+  }
+  for(c = 0; (2 << c) < nunits; c++)
+    1dfd:	31 c9                	xor    %ecx,%ecx
+    1dff:	b8 02 00 00 00       	mov    $0x2,%eax
+    1e04:	be 02 00 00 00       	mov    $0x2,%esi
+    1e09:	bb 02 00 00 00       	mov    $0x2,%ebx
+    1e0e:	83 ff 02             	cmp    $0x2,%edi
+    1e11:	76 12                	jbe    1e25 <malloc+0x45>
+    1e13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1e17:	90                   	nop
+    1e18:	83 c1 01             	add    $0x1,%ecx
+    1e1b:	89 c3                	mov    %eax,%ebx
+    1e1d:	d3 e3                	shl    %cl,%ebx
+    1e1f:	89 de                	mov    %ebx,%esi
+    1e21:	39 fb                	cmp    %edi,%ebx
+    1e23:	72 f3                	jb     1e18 <malloc+0x38>
+    1e25:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    ;
+  if((tc = mycache()) == 0)
+    1e28:	e8 d3 fd ff ff       	call   1c00 <mycache>
+    1e2d:	85 c0                	test   %eax,%eax
+    1e2f:	74 51                	je     1e82 <malloc+0xa2>
+    return 0;
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1e31:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1e34:	8d 3c 88             	lea    (%eax,%ecx,4),%edi
+    1e37:	8b 07                	mov    (%edi),%eax
+    1e39:	85 c0                	test   %eax,%eax
+    1e3b:	74 53                	je     1e90 <malloc+0xb0>
+    return 0;
+  p = tc->list[c];
+  tc->list[c] = p->s.ptr;
+  tc->n[c]--;
+    1e3d:	8b 57 20             	mov    0x20(%edi),%edx
+  tc->list[c] = p->s.ptr;
+    1e40:	8b 08                	mov    (%eax),%ecx
+  tc->n[c]--;
+    1e42:	83 ea 01             	sub    $0x1,%edx
+  return (void*)(p + 1);
+    1e45:	83 c0 08             	add    $0x8,%eax
+  tc->n[c]--;
+    1e48:	89 57 20             	mov    %edx,0x20(%edi)
+  tc->list[c] = p->s.ptr;
+    1e4b:	89 0f                	mov    %ecx,(%edi)
+}
+    1e4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1e50:	5b                   	pop    %ebx
+    1e51:	5e                   	pop    %esi
+    1e52:	5f                   	pop    %edi
+    1e53:	5d                   	pop    %ebp
+    1e54:	c3                   	ret
+    1e55:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1e58:	a1 24 3c 00 00       	mov    0x3c24,%eax
+    1e5d:	85 c0                	test   %eax,%eax
+    1e5f:	0f 85 b3 00 00 00    	jne    1f18 <malloc+0x138>
+    p = bigalloc(nunits);
+    1e65:	89 f8                	mov    %edi,%eax
+    1e67:	e8 14 fc ff ff       	call   1a80 <bigalloc>
+    1e6c:	89 c3                	mov    %eax,%ebx
+  if(threaded)
+    1e6e:	a1 24 3c 00 00       	mov    0x3c24,%eax
+    1e73:	85 c0                	test   %eax,%eax
+    1e75:	0f 85 85 00 00 00    	jne    1f00 <malloc+0x120>
+    return p ? (void*)(p + 1) : 0;
+    1e7b:	8d 43 08             	lea    0x8(%ebx),%eax
+    1e7e:	85 db                	test   %ebx,%ebx
+    1e80:	75 cb                	jne    1e4d <malloc+0x6d>
+    1e82:	31 c0                	xor    %eax,%eax
+}
+    1e84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1e87:	5b                   	pop    %ebx
+    1e88:	5e                   	pop    %esi
+    1e89:	5f                   	pop    %edi
+    1e8a:	5d                   	pop    %ebp
+    1e8b:	c3                   	ret
+    1e8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1e90:	a1 24 3c 00 00       	mov    0x3c24,%eax
+    1e95:	85 c0                	test   %eax,%eax
+    1e97:	0f 85 29 01 00 00    	jne    1fc6 <malloc+0x1e6>
+  if(small[c] == 0){
+    1e9d:	8b 04 8d 80 3c 00 00 	mov    0x3c80(,%ecx,4),%eax
+    1ea4:	85 c0                	test   %eax,%eax
+    1ea6:	0f 84 81 00 00 00    	je     1f2d <malloc+0x14d>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1eac:	31 db                	xor    %ebx,%ebx
+    1eae:	eb 22                	jmp    1ed2 <malloc+0xf2>
+    small[c] = p->s.ptr;
+    1eb0:	8b 10                	mov    (%eax),%edx
+  for(moved = 0; moved < n && small[c]; moved++){
+    1eb2:	83 c3 01             	add    $0x1,%ebx
+    small[c] = p->s.ptr;
+    1eb5:	89 14 8d 80 3c 00 00 	mov    %edx,0x3c80(,%ecx,4)
+    p->s.ptr = tc->list[c];
+    1ebc:	8b 17                	mov    (%edi),%edx
+    1ebe:	89 10                	mov    %edx,(%eax)
+    tc->list[c] = p;
+    1ec0:	89 07                	mov    %eax,(%edi)
+  for(moved = 0; moved < n && small[c]; moved++){
+    1ec2:	83 fb 10             	cmp    $0x10,%ebx
+    1ec5:	0f 84 e2 00 00 00    	je     1fad <malloc+0x1cd>
+    1ecb:	8b 04 8d 80 3c 00 00 	mov    0x3c80(,%ecx,4),%eax
+    1ed2:	85 c0                	test   %eax,%eax
+    1ed4:	75 da                	jne    1eb0 <malloc+0xd0>
+  if(threaded)
+    1ed6:	8b 15 24 3c 00 00    	mov    0x3c24,%edx
+    1edc:	85 d2                	test   %edx,%edx
+    1ede:	0f 85 b4 00 00 00    	jne    1f98 <malloc+0x1b8>
+  tc->n[c] += moved;
+    1ee4:	8b 57 20             	mov    0x20(%edi),%edx
+    1ee7:	01 da                	add    %ebx,%edx
+    1ee9:	89 57 20             	mov    %edx,0x20(%edi)
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1eec:	85 db                	test   %ebx,%ebx
+    1eee:	74 92                	je     1e82 <malloc+0xa2>
+  p = tc->list[c];
+    1ef0:	8b 07                	mov    (%edi),%eax
+    1ef2:	e9 49 ff ff ff       	jmp    1e40 <malloc+0x60>
+    1ef7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1efe:	66 90                	xchg   %ax,%ax
+    mutex_unlock(&lock);
+    1f00:	83 ec 0c             	sub    $0xc,%esp
+    1f03:	68 28 3c 00 00       	push   $0x3c28
+    1f08:	e8 e3 e8 ff ff       	call   7f0 <mutex_unlock>
+}
+    1f0d:	83 c4 10             	add    $0x10,%esp
+    1f10:	e9 66 ff ff ff       	jmp    1e7b <malloc+0x9b>
+    1f15:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1f18:	83 ec 0c             	sub    $0xc,%esp
+    1f1b:	68 28 3c 00 00       	push   $0x3c28
+    1f20:	e8 7b e8 ff ff       	call   7a0 <mutex_lock>
+}
+    1f25:	83 c4 10             	add    $0x10,%esp
+    1f28:	e9 38 ff ff ff       	jmp    1e65 <malloc+0x85>
+    if((chunk = bigalloc(CHUNK / sizeof(Header) + 1)) == 0){
+    1f2d:	b8 01 02 00 00       	mov    $0x201,%eax
+    1f32:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1f35:	e8 46 fb ff ff       	call   1a80 <bigalloc>
+    1f3a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1f3d:	85 c0                	test   %eax,%eax
+    1f3f:	89 c2                	mov    %eax,%edx
+    1f41:	0f 84 ba 00 00 00    	je     2001 <malloc+0x221>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1f47:	83 c2 08             	add    $0x8,%edx
+    1f4a:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+    1f50:	0f 87 d0 00 00 00    	ja     2026 <malloc+0x246>
+    1f56:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+    1f5d:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    1f60:	89 df                	mov    %ebx,%edi
+    1f62:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1f65:	8d 76 00             	lea    0x0(%esi),%esi
+      p->s.size = units;
+    1f68:	89 72 04             	mov    %esi,0x4(%edx)
+      p->s.ptr = small[c];
+    1f6b:	8b 04 8d 80 3c 00 00 	mov    0x3c80(,%ecx,4),%eax
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1f72:	01 df                	add    %ebx,%edi
+    1f74:	89 55 e0             	mov    %edx,-0x20(%ebp)
+      p->s.ptr = small[c];
+    1f77:	89 02                	mov    %eax,(%edx)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1f79:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      small[c] = p;
+    1f7c:	89 14 8d 80 3c 00 00 	mov    %edx,0x3c80(,%ecx,4)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1f83:	01 c2                	add    %eax,%edx
+    1f85:	81 ff 00 02 00 00    	cmp    $0x200,%edi
+    1f8b:	76 db                	jbe    1f68 <malloc+0x188>
+    1f8d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1f90:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1f93:	e9 14 ff ff ff       	jmp    1eac <malloc+0xcc>
+    mutex_unlock(&lock);
+    1f98:	83 ec 0c             	sub    $0xc,%esp
+    1f9b:	68 28 3c 00 00       	push   $0x3c28
+    1fa0:	e8 4b e8 ff ff       	call   7f0 <mutex_unlock>
+}
+    1fa5:	83 c4 10             	add    $0x10,%esp
+    1fa8:	e9 37 ff ff ff       	jmp    1ee4 <malloc+0x104>
+  if(threaded)
+    1fad:	a1 24 3c 00 00       	mov    0x3c24,%eax
+    1fb2:	85 c0                	test   %eax,%eax
+    1fb4:	75 2b                	jne    1fe1 <malloc+0x201>
+  tc->n[c] += moved;
+    1fb6:	8b 47 20             	mov    0x20(%edi),%eax
+    1fb9:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1fbc:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1fbe:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1fc1:	e9 7a fe ff ff       	jmp    1e40 <malloc+0x60>
+    mutex_lock(&lock);
+    1fc6:	83 ec 0c             	sub    $0xc,%esp
+    1fc9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1fcc:	68 28 3c 00 00       	push   $0x3c28
+    1fd1:	e8 ca e7 ff ff       	call   7a0 <mutex_lock>
+}
+    1fd6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1fd9:	83 c4 10             	add    $0x10,%esp
+    1fdc:	e9 bc fe ff ff       	jmp    1e9d <malloc+0xbd>
+    mutex_unlock(&lock);
+    1fe1:	83 ec 0c             	sub    $0xc,%esp
+    1fe4:	68 28 3c 00 00       	push   $0x3c28
+    1fe9:	e8 02 e8 ff ff       	call   7f0 <mutex_unlock>
+  tc->n[c] += moved;
+    1fee:	8b 47 20             	mov    0x20(%edi),%eax
+    1ff1:	83 c4 10             	add    $0x10,%esp
+    1ff4:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1ff7:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1ff9:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1ffc:	e9 3f fe ff ff       	jmp    1e40 <malloc+0x60>
+  if(threaded)
+    2001:	8b 0d 24 3c 00 00    	mov    0x3c24,%ecx
+    2007:	85 c9                	test   %ecx,%ecx
+    2009:	0f 84 73 fe ff ff    	je     1e82 <malloc+0xa2>
+    mutex_unlock(&lock);
+    200f:	83 ec 0c             	sub    $0xc,%esp
+    2012:	68 28 3c 00 00       	push   $0x3c28
+    2017:	e8 d4 e7 ff ff       	call   7f0 <mutex_unlock>
+    201c:	83 c4 10             	add    $0x10,%esp
+    return p ? (void*)(p + 1) : 0;
+    201f:	31 c0                	xor    %eax,%eax
+    2021:	e9 5e fe ff ff       	jmp    1e84 <malloc+0xa4>
+  for(moved = 0; moved < n && small[c]; moved++){
+    2026:	8b 04 8d 80 3c 00 00 	mov    0x3c80(,%ecx,4),%eax
+    202d:	e9 7a fe ff ff       	jmp    1eac <malloc+0xcc>
+    2032:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2039:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002040 <malloc_threaded>:
+void
+malloc_threaded(void)
+{
+  uint sp;
+
+  if(threaded)
+    2040:	a1 24 3c 00 00       	mov    0x3c24,%eax
+    2045:	85 c0                	test   %eax,%eax
+    2047:	74 07                	je     2050 <malloc_threaded+0x10>
+    2049:	c3                   	ret
+    204a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+{
+    2050:	55                   	push   %ebp
+    2051:	89 e5                	mov    %esp,%ebp
+    2053:	83 ec 24             	sub    $0x24,%esp
+    return;
+  mutex_init(&lock);
+    2056:	68 28 3c 00 00       	push   $0x3c28
+    205b:	e8 30 e7 ff ff       	call   790 <mutex_init>
+  mainstack = PGROUNDDOWN((uint)&sp);
+    2060:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    2063:	83 c4 10             	add    $0x10,%esp
+  threaded = 1;
+    2066:	c7 05 24 3c 00 00 01 	movl   $0x1,0x3c24
+    206d:	00 00 00 
+  mainstack = PGROUNDDOWN((uint)&sp);
+    2070:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    2075:	a3 20 3c 00 00       	mov    %eax,0x3c20
+}
+    207a:	c9                   	leave
+    207b:	c3                   	ret
+    207c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00002080 <malloc_thread_exit>:
+
+// Called by thread_join() with the cache slot of a finished
+// thread: give its blocks, and the cache itself, back.
+void
+malloc_thread_exit(void **cachep)
+{
+    2080:	55                   	push   %ebp
+    2081:	89 e5                	mov    %esp,%ebp
+    2083:	57                   	push   %edi
+    2084:	56                   	push   %esi
+    2085:	53                   	push   %ebx
+    2086:	83 ec 0c             	sub    $0xc,%esp
+    2089:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct tcache *tc;
+  int c;
+
+  if((tc = *cachep) == 0)
+    208c:	8b 37                	mov    (%edi),%esi
+    208e:	85 f6                	test   %esi,%esi
+    2090:	74 41                	je     20d3 <malloc_thread_exit+0x53>
+    return;
+  for(c = 0; c < NCLASS; c++)
+    2092:	31 db                	xor    %ebx,%ebx
+    2094:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    drain(tc, c, tc->n[c]);
+    2098:	8b 4c 9e 20          	mov    0x20(%esi,%ebx,4),%ecx
+    209c:	89 da                	mov    %ebx,%edx
+    209e:	89 f0                	mov    %esi,%eax
+  for(c = 0; c < NCLASS; c++)
+    20a0:	83 c3 01             	add    $0x1,%ebx
+    drain(tc, c, tc->n[c]);
+    20a3:	e8 c8 fa ff ff       	call   1b70 <drain>
+  for(c = 0; c < NCLASS; c++)
+    20a8:	83 fb 08             	cmp    $0x8,%ebx
+    20ab:	75 eb                	jne    2098 <malloc_thread_exit+0x18>
+  if(threaded)
+    20ad:	8b 15 24 3c 00 00    	mov    0x3c24,%edx
+    20b3:	85 d2                	test   %edx,%edx
+    20b5:	75 29                	jne    20e0 <malloc_thread_exit+0x60>
+  acquire();
+  trim(bigfree((Header*)tc - 1));
+    20b7:	8d 46 f8             	lea    -0x8(%esi),%eax
+    20ba:	e8 c1 f8 ff ff       	call   1980 <bigfree>
+    20bf:	e8 3c f9 ff ff       	call   1a00 <trim>
+  if(threaded)
+    20c4:	a1 24 3c 00 00       	mov    0x3c24,%eax
+    20c9:	85 c0                	test   %eax,%eax
+    20cb:	75 2b                	jne    20f8 <malloc_thread_exit+0x78>
+  release();
+  *cachep = 0;
+    20cd:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+}
+    20d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    20d6:	5b                   	pop    %ebx
+    20d7:	5e                   	pop    %esi
+    20d8:	5f                   	pop    %edi
+    20d9:	5d                   	pop    %ebp
+    20da:	c3                   	ret
+    20db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    20df:	90                   	nop
+    mutex_lock(&lock);
+    20e0:	83 ec 0c             	sub    $0xc,%esp
+    20e3:	68 28 3c 00 00       	push   $0x3c28
+    20e8:	e8 b3 e6 ff ff       	call   7a0 <mutex_lock>
+}
+    20ed:	83 c4 10             	add    $0x10,%esp
+    20f0:	eb c5                	jmp    20b7 <malloc_thread_exit+0x37>
+    20f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    20f8:	83 ec 0c             	sub    $0xc,%esp
+    20fb:	68 28 3c 00 00       	push   $0x3c28
+    2100:	e8 eb e6 ff ff       	call   7f0 <mutex_unlock>
+}
+    2105:	83 c4 10             	add    $0x10,%esp
+    2108:	eb c3                	jmp    20cd <malloc_thread_exit+0x4d>
+    210a:	66 90                	xchg   %ax,%ax
+    210c:	66 90                	xchg   %ax,%ax
+    210e:	66 90                	xchg   %ax,%ax
+
+00002110 <thread_create>:
+
+// Start fn(arg) in a new thread on a freshly allocated
+// page-aligned stack.  Returns the thread's pid.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    2110:	55                   	push   %ebp
+    2111:	89 e5                	mov    %esp,%ebp
+    2113:	53                   	push   %ebx
+    2114:	83 ec 14             	sub    $0x14,%esp
+  char *mem, *stack;
+  int pid;
+
+  malloc_threaded();
+    2117:	e8 24 ff ff ff       	call   2040 <malloc_threaded>
+  stdio_threaded();
+    211c:	e8 cf ee ff ff       	call   ff0 <stdio_threaded>
+  if((mem = malloc(2*PGSIZE)) == 0)
+    2121:	83 ec 0c             	sub    $0xc,%esp
+    2124:	68 00 20 00 00       	push   $0x2000
+    2129:	e8 b2 fc ff ff       	call   1de0 <malloc>
+    212e:	83 c4 10             	add    $0x10,%esp
+    2131:	85 c0                	test   %eax,%eax
+    2133:	74 52                	je     2187 <thread_create+0x77>
+    2135:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    2137:	8d 80 07 10 00 00    	lea    0x1007(%eax),%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+  ((char**)stack)[-2] = 0;
+  if((pid = clone(fn, arg, stack)) < 0)
+    213d:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    2140:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+    2145:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  ((char**)stack)[-2] = 0;
+    2148:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+  if((pid = clone(fn, arg, stack)) < 0)
+    214f:	50                   	push   %eax
+    2150:	ff 75 0c             	push   0xc(%ebp)
+    2153:	ff 75 08             	push   0x8(%ebp)
+    2156:	e8 97 e8 ff ff       	call   9f2 <clone>
+    215b:	83 c4 10             	add    $0x10,%esp
+    215e:	85 c0                	test   %eax,%eax
+    2160:	78 0e                	js     2170 <thread_create+0x60>
+    free(mem);
+  return pid;
+}
+    2162:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2165:	c9                   	leave
+    2166:	c3                   	ret
+    2167:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    216e:	66 90                	xchg   %ax,%ax
+    free(mem);
+    2170:	83 ec 0c             	sub    $0xc,%esp
+    2173:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    2176:	53                   	push   %ebx
+    2177:	e8 34 fb ff ff       	call   1cb0 <free>
+    217c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    217f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    2182:	83 c4 10             	add    $0x10,%esp
+}
+    2185:	c9                   	leave
+    2186:	c3                   	ret
+    return -1;
+    2187:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    218c:	eb d4                	jmp    2162 <thread_create+0x52>
+    218e:	66 90                	xchg   %ax,%ax
+
+00002190 <thread_join>:
+
+// Wait for a thread to finish and free its stack.
+int
+thread_join(void)
+{
+    2190:	55                   	push   %ebp
+    2191:	89 e5                	mov    %esp,%ebp
+    2193:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    2194:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    2197:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    219a:	50                   	push   %eax
+    219b:	e8 61 e8 ff ff       	call   a01 <join>
+    21a0:	83 c4 10             	add    $0x10,%esp
+    21a3:	85 c0                	test   %eax,%eax
+    21a5:	78 29                	js     21d0 <thread_join+0x40>
+    21a7:	89 c3                	mov    %eax,%ebx
+    return -1;
+  malloc_thread_exit(&((void**)stack)[-2]);
+    21a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    21ac:	83 ec 0c             	sub    $0xc,%esp
+    21af:	83 e8 08             	sub    $0x8,%eax
+    21b2:	50                   	push   %eax
+    21b3:	e8 c8 fe ff ff       	call   2080 <malloc_thread_exit>
+  free(((char**)stack)[-1]);
+    21b8:	58                   	pop    %eax
+    21b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    21bc:	ff 70 fc             	push   -0x4(%eax)
+    21bf:	e8 ec fa ff ff       	call   1cb0 <free>
+  return pid;
+    21c4:	83 c4 10             	add    $0x10,%esp
+}
+    21c7:	89 d8                	mov    %ebx,%eax
+    21c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    21cc:	c9                   	leave
+    21cd:	c3                   	ret
+    21ce:	66 90                	xchg   %ax,%ax
+    return -1;
+    21d0:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    21d5:	eb f0                	jmp    21c7 <thread_join+0x37>
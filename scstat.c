@@ -0,0 +1,172 @@
+// Report system call counts and times, most time first.
+//   scstat                counters since boot
+//   scstat -p pid         counters of a running process
+//   scstat cmd args...    counters accumulated while cmd runs
+// Times are in TSC cycles, or thousands of them (K) when large.
+// A call is counted when it returns, so exit() never is.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "syscall.h"
+#include "scstat.h"
+
+struct scstat before[NSCSTAT], after[NSCSTAT];
+int order[NSCSTAT];
+
+char *names[] = {
+[SYS_fork]       "fork",
+[SYS_exit]       "exit",
+[SYS_wait]       "wait",
+[SYS_pipe]       "pipe",
+[SYS_read]       "read",
+[SYS_kill]       "kill",
+[SYS_exec]       "exec",
+[SYS_fstat]      "fstat",
+[SYS_chdir]      "chdir",
+[SYS_dup]        "dup",
+[SYS_getpid]     "getpid",
+[SYS_sbrk]       "sbrk",
+[SYS_sleep]      "sleep",
+[SYS_uptime]     "uptime",
+[SYS_open]       "open",
+[SYS_write]      "write",
+[SYS_mknod]      "mknod",
+[SYS_unlink]     "unlink",
+[SYS_link]       "link",
+[SYS_mkdir]      "mkdir",
+[SYS_close]      "close",
+[SYS_clone]      "clone",
+[SYS_join]       "join",
+[SYS_futex]      "futex",
+[SYS_yield]      "yield",
+[SYS_lockstat]   "lockstat",
+[SYS_lockhammer] "lockhammer",
+[SYS_vmsplice]   "vmsplice",
+[SYS_hsbrk]      "hsbrk",
+[SYS_mmap]       "mmap",
+[SYS_munmap]     "munmap",
+[SYS_ringenter]  "ringenter",
+[SYS_readv]      "readv",
+[SYS_writev]     "writev",
+[SYS_pread]      "pread",
+[SYS_pwrite]     "pwrite",
+[SYS_prof]       "prof",
+[SYS_scstat]     "scstat",
+};
+
+void
+pad(char *s, int w)
+{
+  int n;
+
+  printf(1, "%s", s);
+  for(n = strlen(s); n < w; n++)
+    printf(1, " ");
+}
+
+// Print the 64-bit cycle count hi:lo in a column of width w.
+void
+cycles(uint hi, uint lo, int w)
+{
+  char buf[16];
+  int i, n;
+  uint v;
+
+  if(hi == 0 && lo < 100000000)
+    v = lo;
+  else
+    v = hi << 22 | lo >> 10;
+  i = sizeof(buf);
+  buf[--i] = 0;
+  if(v != lo || hi != 0)
+    buf[--i] = 'K';
+  do {
+    buf[--i] = '0' + v % 10;
+    v /= 10;
+  } while(v != 0);
+  for(n = sizeof(buf) - 1 - i; n < w; n++)
+    printf(1, " ");
+  printf(1, "%s", buf + i);
+}
+
+// Does entry a take more time in all than entry b?
+int
+more(struct scstat *a, struct scstat *b)
+{
+  return a->tothi > b->tothi || (a->tothi == b->tothi && a->totlo > b->totlo);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, j, n, nbefore, pid, t;
+  struct scstat *s;
+  uint k;
+
+  nbefore = 0;
+  if(argc > 2 && strcmp(argv[1], "-p") == 0){
+    if((n = scstat(atoi(argv[2]), after, NSCSTAT)) < 0){
+      printf(2, "scstat: no process %s\n", argv[2]);
+      exit();
+    }
+  } else {
+    if(argc > 1){
+      nbefore = scstat(0, before, NSCSTAT);
+      pid = fork();
+      if(pid < 0){
+        printf(2, "scstat: fork failed\n");
+        exit();
+      }
+      if(pid == 0){
+        exec(argv[1], argv+1);
+        printf(2, "scstat: exec %s failed\n", argv[1]);
+        exit();
+      }
+      wait();
+    }
+    n = scstat(0, after, NSCSTAT);
+  }
+
+  // Subtract the earlier snapshot. Max time cannot be
+  // differenced; it stays since boot.
+  for(i = 0; i < nbefore; i++){
+    after[i].count -= before[i].count;
+    after[i].tothi -= before[i].tothi + (after[i].totlo < before[i].totlo);
+    after[i].totlo -= before[i].totlo;
+  }
+
+  for(i = 0; i < n; i++){
+    t = i;
+    for(j = i; j > 0 && more(&after[t], &after[order[j-1]]); j--)
+      order[j] = order[j-1];
+    order[j] = t;
+  }
+
+  pad("syscall", 12);
+  printf(1, "      calls      total        avg        max\n");
+  for(i = 0; i < n; i++){
+    s = &after[order[i]];
+    if(s->count == 0)
+      continue;
+    if(order[i] < sizeof(names)/sizeof(names[0]) && names[order[i]])
+      pad(names[order[i]], 12);
+    else
+      pad("?", 12);
+    printf(1, " ");
+    cycles(0, s->count, 10);
+    printf(1, " ");
+    cycles(s->tothi, s->totlo, 10);
+    printf(1, " ");
+    if(s->tothi == 0)
+      cycles(0, s->totlo / s->count, 10);
+    else {
+      k = (s->tothi << 22 | s->totlo >> 10) / s->count;
+      cycles(k >> 22, k << 10, 10);
+    }
+    printf(1, " ");
+    cycles(0, s->max, 10);
+    printf(1, "\n");
+  }
+  exit();
+}
@@ -0,0 +1,11 @@
+// System call counts and times, per system call number.
+// Both the kernel and user programs use this header file.
+
+#define NSCSTAT 48    // more than the highest SYS_ number
+
+struct scstat {
+  uint count;     // Calls that returned
+  uint totlo;     // Total TSC cycles spent in them, low 32 bits
+  uint tothi;     //   and high 32 bits
+  uint max;       // Longest call, in TSC cycles
+};
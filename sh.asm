@@ -0,0 +1,5511 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return 0;
+}
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 04             	sub    $0x4,%esp
+  static char buf[100];
+  int fd;
+
+  // Ensure that three file descriptors are open.
+  while((fd = open("console", O_RDWR)) >= 0){
+      11:	eb 0e                	jmp    21 <main+0x21>
+      13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      17:	90                   	nop
+    if(fd >= 3){
+      18:	83 f8 02             	cmp    $0x2,%eax
+      1b:	0f 8f 96 00 00 00    	jg     b7 <main+0xb7>
+  while((fd = open("console", O_RDWR)) >= 0){
+      21:	83 ec 08             	sub    $0x8,%esp
+      24:	6a 02                	push   $0x2
+      26:	68 19 29 00 00       	push   $0x2919
+      2b:	e8 bd 0f 00 00       	call   fed <open>
+      30:	83 c4 10             	add    $0x10,%esp
+      33:	85 c0                	test   %eax,%eax
+      35:	79 e1                	jns    18 <main+0x18>
+      37:	eb 2e                	jmp    67 <main+0x67>
+      39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    }
+  }
+
+  // Read and run input commands.
+  while(getcmd(buf, sizeof(buf)) >= 0){
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      40:	80 3d 42 37 00 00 20 	cmpb   $0x20,0x3742
+      47:	0f 84 8d 00 00 00    	je     da <main+0xda>
+      4d:	8d 76 00             	lea    0x0(%esi),%esi
+int
+fork1(void)
+{
+  int pid;
+
+  pid = fork();
+      50:	e8 7b 0b 00 00       	call   bd0 <fork>
+  if(pid == -1)
+      55:	83 f8 ff             	cmp    $0xffffffff,%eax
+      58:	0f 84 c1 00 00 00    	je     11f <main+0x11f>
+    if(fork1() == 0)
+      5e:	85 c0                	test   %eax,%eax
+      60:	74 63                	je     c5 <main+0xc5>
+    wait();
+      62:	e8 1d 0f 00 00       	call   f84 <wait>
+  printf(2, "$ ");
+      67:	83 ec 08             	sub    $0x8,%esp
+      6a:	68 78 28 00 00       	push   $0x2878
+      6f:	6a 02                	push   $0x2
+      71:	e8 7a 13 00 00       	call   13f0 <printf>
+  memset(buf, 0, nbuf);
+      76:	83 c4 0c             	add    $0xc,%esp
+      79:	6a 64                	push   $0x64
+      7b:	6a 00                	push   $0x0
+      7d:	68 40 37 00 00       	push   $0x3740
+      82:	e8 89 0c 00 00       	call   d10 <memset>
+  gets(buf, nbuf);
+      87:	58                   	pop    %eax
+      88:	5a                   	pop    %edx
+      89:	6a 64                	push   $0x64
+      8b:	68 40 37 00 00       	push   $0x3740
+      90:	e8 db 1e 00 00       	call   1f70 <gets>
+  if(buf[0] == 0) // EOF
+      95:	0f b6 05 40 37 00 00 	movzbl 0x3740,%eax
+      9c:	83 c4 10             	add    $0x10,%esp
+      9f:	84 c0                	test   %al,%al
+      a1:	74 0f                	je     b2 <main+0xb2>
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      a3:	3c 63                	cmp    $0x63,%al
+      a5:	75 a9                	jne    50 <main+0x50>
+      a7:	80 3d 41 37 00 00 64 	cmpb   $0x64,0x3741
+      ae:	75 a0                	jne    50 <main+0x50>
+      b0:	eb 8e                	jmp    40 <main+0x40>
+  exit();
+      b2:	e8 79 0b 00 00       	call   c30 <exit>
+      close(fd);
+      b7:	83 ec 0c             	sub    $0xc,%esp
+      ba:	50                   	push   %eax
+      bb:	e8 00 0f 00 00       	call   fc0 <close>
+      break;
+      c0:	83 c4 10             	add    $0x10,%esp
+      c3:	eb a2                	jmp    67 <main+0x67>
+      runcmd(parsecmd(buf));
+      c5:	83 ec 0c             	sub    $0xc,%esp
+      c8:	68 40 37 00 00       	push   $0x3740
+      cd:	e8 8e 0a 00 00       	call   b60 <parsecmd>
+      d2:	89 04 24             	mov    %eax,(%esp)
+      d5:	e8 d6 00 00 00       	call   1b0 <runcmd>
+      buf[strlen(buf)-1] = 0;  // chop \n
+      da:	83 ec 0c             	sub    $0xc,%esp
+      dd:	68 40 37 00 00       	push   $0x3740
+      e2:	e8 f9 0b 00 00       	call   ce0 <strlen>
+      if(chdir(buf+3) < 0)
+      e7:	c7 04 24 43 37 00 00 	movl   $0x3743,(%esp)
+      buf[strlen(buf)-1] = 0;  // chop \n
+      ee:	c6 80 3f 37 00 00 00 	movb   $0x0,0x373f(%eax)
+      if(chdir(buf+3) < 0)
+      f5:	e8 4d 0f 00 00       	call   1047 <chdir>
+      fa:	83 c4 10             	add    $0x10,%esp
+      fd:	85 c0                	test   %eax,%eax
+      ff:	0f 89 62 ff ff ff    	jns    67 <main+0x67>
+        printf(2, "cannot cd %s\n", buf+3);
+     105:	51                   	push   %ecx
+     106:	68 43 37 00 00       	push   $0x3743
+     10b:	68 21 29 00 00       	push   $0x2921
+     110:	6a 02                	push   $0x2
+     112:	e8 d9 12 00 00       	call   13f0 <printf>
+     117:	83 c4 10             	add    $0x10,%esp
+     11a:	e9 48 ff ff ff       	jmp    67 <main+0x67>
+    panic("fork");
+     11f:	83 ec 0c             	sub    $0xc,%esp
+     122:	68 7b 28 00 00       	push   $0x287b
+     127:	e8 44 00 00 00       	call   170 <panic>
+     12c:	66 90                	xchg   %ax,%ax
+     12e:	66 90                	xchg   %ax,%ax
+
+00000130 <getcmd>:
+{
+     130:	55                   	push   %ebp
+     131:	89 e5                	mov    %esp,%ebp
+     133:	56                   	push   %esi
+     134:	53                   	push   %ebx
+     135:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     138:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(2, "$ ");
+     13b:	83 ec 08             	sub    $0x8,%esp
+     13e:	68 78 28 00 00       	push   $0x2878
+     143:	6a 02                	push   $0x2
+     145:	e8 a6 12 00 00       	call   13f0 <printf>
+  memset(buf, 0, nbuf);
+     14a:	83 c4 0c             	add    $0xc,%esp
+     14d:	56                   	push   %esi
+     14e:	6a 00                	push   $0x0
+     150:	53                   	push   %ebx
+     151:	e8 ba 0b 00 00       	call   d10 <memset>
+  gets(buf, nbuf);
+     156:	58                   	pop    %eax
+     157:	5a                   	pop    %edx
+     158:	56                   	push   %esi
+     159:	53                   	push   %ebx
+     15a:	e8 11 1e 00 00       	call   1f70 <gets>
+  if(buf[0] == 0) // EOF
+     15f:	83 c4 10             	add    $0x10,%esp
+     162:	80 3b 01             	cmpb   $0x1,(%ebx)
+     165:	19 c0                	sbb    %eax,%eax
+}
+     167:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     16a:	5b                   	pop    %ebx
+     16b:	5e                   	pop    %esi
+     16c:	5d                   	pop    %ebp
+     16d:	c3                   	ret
+     16e:	66 90                	xchg   %ax,%ax
+
+00000170 <panic>:
+{
+     170:	55                   	push   %ebp
+     171:	89 e5                	mov    %esp,%ebp
+     173:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+     176:	ff 75 08             	push   0x8(%ebp)
+     179:	68 15 29 00 00       	push   $0x2915
+     17e:	6a 02                	push   $0x2
+     180:	e8 6b 12 00 00       	call   13f0 <printf>
+  exit();
+     185:	e8 a6 0a 00 00       	call   c30 <exit>
+     18a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000190 <fork1>:
+{
+     190:	55                   	push   %ebp
+     191:	89 e5                	mov    %esp,%ebp
+     193:	83 ec 08             	sub    $0x8,%esp
+  pid = fork();
+     196:	e8 35 0a 00 00       	call   bd0 <fork>
+  if(pid == -1)
+     19b:	83 f8 ff             	cmp    $0xffffffff,%eax
+     19e:	74 02                	je     1a2 <fork1+0x12>
+  return pid;
+}
+     1a0:	c9                   	leave
+     1a1:	c3                   	ret
+    panic("fork");
+     1a2:	83 ec 0c             	sub    $0xc,%esp
+     1a5:	68 7b 28 00 00       	push   $0x287b
+     1aa:	e8 c1 ff ff ff       	call   170 <panic>
+     1af:	90                   	nop
+
+000001b0 <runcmd>:
+{
+     1b0:	55                   	push   %ebp
+     1b1:	89 e5                	mov    %esp,%ebp
+     1b3:	53                   	push   %ebx
+     1b4:	83 ec 14             	sub    $0x14,%esp
+     1b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+     1ba:	85 db                	test   %ebx,%ebx
+     1bc:	74 42                	je     200 <runcmd+0x50>
+  switch(cmd->type){
+     1be:	83 3b 05             	cmpl   $0x5,(%ebx)
+     1c1:	0f 87 e3 00 00 00    	ja     2aa <runcmd+0xfa>
+     1c7:	8b 03                	mov    (%ebx),%eax
+     1c9:	ff 24 85 30 29 00 00 	jmp    *0x2930(,%eax,4)
+    if(ecmd->argv[0] == 0)
+     1d0:	8b 43 04             	mov    0x4(%ebx),%eax
+     1d3:	85 c0                	test   %eax,%eax
+     1d5:	74 29                	je     200 <runcmd+0x50>
+    exec(ecmd->argv[0], ecmd->argv);
+     1d7:	8d 53 04             	lea    0x4(%ebx),%edx
+     1da:	51                   	push   %ecx
+     1db:	51                   	push   %ecx
+     1dc:	52                   	push   %edx
+     1dd:	50                   	push   %eax
+     1de:	e8 1d 0a 00 00       	call   c00 <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+     1e3:	83 c4 0c             	add    $0xc,%esp
+     1e6:	ff 73 04             	push   0x4(%ebx)
+     1e9:	68 87 28 00 00       	push   $0x2887
+     1ee:	6a 02                	push   $0x2
+     1f0:	e8 fb 11 00 00       	call   13f0 <printf>
+    break;
+     1f5:	83 c4 10             	add    $0x10,%esp
+     1f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ff:	90                   	nop
+    exit();
+     200:	e8 2b 0a 00 00       	call   c30 <exit>
+    if(fork1() == 0)
+     205:	e8 86 ff ff ff       	call   190 <fork1>
+     20a:	85 c0                	test   %eax,%eax
+     20c:	75 f2                	jne    200 <runcmd+0x50>
+     20e:	e9 8c 00 00 00       	jmp    29f <runcmd+0xef>
+    if(pipe(p) < 0)
+     213:	83 ec 0c             	sub    $0xc,%esp
+     216:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     219:	50                   	push   %eax
+     21a:	e8 74 0d 00 00       	call   f93 <pipe>
+     21f:	83 c4 10             	add    $0x10,%esp
+     222:	85 c0                	test   %eax,%eax
+     224:	0f 88 a2 00 00 00    	js     2cc <runcmd+0x11c>
+    if(fork1() == 0){
+     22a:	e8 61 ff ff ff       	call   190 <fork1>
+     22f:	85 c0                	test   %eax,%eax
+     231:	0f 84 a2 00 00 00    	je     2d9 <runcmd+0x129>
+    if(fork1() == 0){
+     237:	e8 54 ff ff ff       	call   190 <fork1>
+     23c:	85 c0                	test   %eax,%eax
+     23e:	0f 84 c3 00 00 00    	je     307 <runcmd+0x157>
+    close(p[0]);
+     244:	83 ec 0c             	sub    $0xc,%esp
+     247:	ff 75 f0             	push   -0x10(%ebp)
+     24a:	e8 71 0d 00 00       	call   fc0 <close>
+    close(p[1]);
+     24f:	58                   	pop    %eax
+     250:	ff 75 f4             	push   -0xc(%ebp)
+     253:	e8 68 0d 00 00       	call   fc0 <close>
+    wait();
+     258:	e8 27 0d 00 00       	call   f84 <wait>
+    wait();
+     25d:	e8 22 0d 00 00       	call   f84 <wait>
+    break;
+     262:	83 c4 10             	add    $0x10,%esp
+     265:	eb 99                	jmp    200 <runcmd+0x50>
+    if(fork1() == 0)
+     267:	e8 24 ff ff ff       	call   190 <fork1>
+     26c:	85 c0                	test   %eax,%eax
+     26e:	74 2f                	je     29f <runcmd+0xef>
+    wait();
+     270:	e8 0f 0d 00 00       	call   f84 <wait>
+    runcmd(lcmd->right);
+     275:	83 ec 0c             	sub    $0xc,%esp
+     278:	ff 73 08             	push   0x8(%ebx)
+     27b:	e8 30 ff ff ff       	call   1b0 <runcmd>
+    close(rcmd->fd);
+     280:	83 ec 0c             	sub    $0xc,%esp
+     283:	ff 73 14             	push   0x14(%ebx)
+     286:	e8 35 0d 00 00       	call   fc0 <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+     28b:	58                   	pop    %eax
+     28c:	5a                   	pop    %edx
+     28d:	ff 73 10             	push   0x10(%ebx)
+     290:	ff 73 08             	push   0x8(%ebx)
+     293:	e8 55 0d 00 00       	call   fed <open>
+     298:	83 c4 10             	add    $0x10,%esp
+     29b:	85 c0                	test   %eax,%eax
+     29d:	78 18                	js     2b7 <runcmd+0x107>
+      runcmd(bcmd->cmd);
+     29f:	83 ec 0c             	sub    $0xc,%esp
+     2a2:	ff 73 04             	push   0x4(%ebx)
+     2a5:	e8 06 ff ff ff       	call   1b0 <runcmd>
+    panic("runcmd");
+     2aa:	83 ec 0c             	sub    $0xc,%esp
+     2ad:	68 80 28 00 00       	push   $0x2880
+     2b2:	e8 b9 fe ff ff       	call   170 <panic>
+      printf(2, "open %s failed\n", rcmd->file);
+     2b7:	51                   	push   %ecx
+     2b8:	ff 73 08             	push   0x8(%ebx)
+     2bb:	68 97 28 00 00       	push   $0x2897
+     2c0:	6a 02                	push   $0x2
+     2c2:	e8 29 11 00 00       	call   13f0 <printf>
+      exit();
+     2c7:	e8 64 09 00 00       	call   c30 <exit>
+      panic("pipe");
+     2cc:	83 ec 0c             	sub    $0xc,%esp
+     2cf:	68 a7 28 00 00       	push   $0x28a7
+     2d4:	e8 97 fe ff ff       	call   170 <panic>
+      close(1);
+     2d9:	83 ec 0c             	sub    $0xc,%esp
+     2dc:	6a 01                	push   $0x1
+     2de:	e8 dd 0c 00 00       	call   fc0 <close>
+      dup(p[1]);
+     2e3:	58                   	pop    %eax
+     2e4:	ff 75 f4             	push   -0xc(%ebp)
+     2e7:	e8 6a 0d 00 00       	call   1056 <dup>
+      close(p[0]);
+     2ec:	58                   	pop    %eax
+     2ed:	ff 75 f0             	push   -0x10(%ebp)
+     2f0:	e8 cb 0c 00 00       	call   fc0 <close>
+      close(p[1]);
+     2f5:	58                   	pop    %eax
+     2f6:	ff 75 f4             	push   -0xc(%ebp)
+     2f9:	e8 c2 0c 00 00       	call   fc0 <close>
+      runcmd(pcmd->left);
+     2fe:	5a                   	pop    %edx
+     2ff:	ff 73 04             	push   0x4(%ebx)
+     302:	e8 a9 fe ff ff       	call   1b0 <runcmd>
+      close(0);
+     307:	83 ec 0c             	sub    $0xc,%esp
+     30a:	6a 00                	push   $0x0
+     30c:	e8 af 0c 00 00       	call   fc0 <close>
+      dup(p[0]);
+     311:	5a                   	pop    %edx
+     312:	ff 75 f0             	push   -0x10(%ebp)
+     315:	e8 3c 0d 00 00       	call   1056 <dup>
+      close(p[0]);
+     31a:	59                   	pop    %ecx
+     31b:	ff 75 f0             	push   -0x10(%ebp)
+     31e:	e8 9d 0c 00 00       	call   fc0 <close>
+      close(p[1]);
+     323:	58                   	pop    %eax
+     324:	ff 75 f4             	push   -0xc(%ebp)
+     327:	e8 94 0c 00 00       	call   fc0 <close>
+      runcmd(pcmd->right);
+     32c:	58                   	pop    %eax
+     32d:	ff 73 08             	push   0x8(%ebx)
+     330:	e8 7b fe ff ff       	call   1b0 <runcmd>
+     335:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     33c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000340 <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     340:	55                   	push   %ebp
+     341:	89 e5                	mov    %esp,%ebp
+     343:	53                   	push   %ebx
+     344:	83 ec 10             	sub    $0x10,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     347:	6a 54                	push   $0x54
+     349:	e8 32 21 00 00       	call   2480 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     34e:	83 c4 0c             	add    $0xc,%esp
+     351:	6a 54                	push   $0x54
+  cmd = malloc(sizeof(*cmd));
+     353:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     355:	6a 00                	push   $0x0
+     357:	50                   	push   %eax
+     358:	e8 b3 09 00 00       	call   d10 <memset>
+  cmd->type = EXEC;
+     35d:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  return (struct cmd*)cmd;
+}
+     363:	89 d8                	mov    %ebx,%eax
+     365:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     368:	c9                   	leave
+     369:	c3                   	ret
+     36a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000370 <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     370:	55                   	push   %ebp
+     371:	89 e5                	mov    %esp,%ebp
+     373:	53                   	push   %ebx
+     374:	83 ec 10             	sub    $0x10,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     377:	6a 18                	push   $0x18
+     379:	e8 02 21 00 00       	call   2480 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     37e:	83 c4 0c             	add    $0xc,%esp
+     381:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     383:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     385:	6a 00                	push   $0x0
+     387:	50                   	push   %eax
+     388:	e8 83 09 00 00       	call   d10 <memset>
+  cmd->type = REDIR;
+  cmd->cmd = subcmd;
+     38d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = REDIR;
+     390:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+     396:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+     399:	8b 45 0c             	mov    0xc(%ebp),%eax
+     39c:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+     39f:	8b 45 10             	mov    0x10(%ebp),%eax
+     3a2:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+     3a5:	8b 45 14             	mov    0x14(%ebp),%eax
+     3a8:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+     3ab:	8b 45 18             	mov    0x18(%ebp),%eax
+     3ae:	89 43 14             	mov    %eax,0x14(%ebx)
+  return (struct cmd*)cmd;
+}
+     3b1:	89 d8                	mov    %ebx,%eax
+     3b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3b6:	c9                   	leave
+     3b7:	c3                   	ret
+     3b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3bf:	90                   	nop
+
+000003c0 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     3c0:	55                   	push   %ebp
+     3c1:	89 e5                	mov    %esp,%ebp
+     3c3:	53                   	push   %ebx
+     3c4:	83 ec 10             	sub    $0x10,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     3c7:	6a 0c                	push   $0xc
+     3c9:	e8 b2 20 00 00       	call   2480 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     3ce:	83 c4 0c             	add    $0xc,%esp
+     3d1:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     3d3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     3d5:	6a 00                	push   $0x0
+     3d7:	50                   	push   %eax
+     3d8:	e8 33 09 00 00       	call   d10 <memset>
+  cmd->type = PIPE;
+  cmd->left = left;
+     3dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = PIPE;
+     3e0:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+     3e6:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     3e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     3ec:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     3ef:	89 d8                	mov    %ebx,%eax
+     3f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3f4:	c9                   	leave
+     3f5:	c3                   	ret
+     3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000400 <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     400:	55                   	push   %ebp
+     401:	89 e5                	mov    %esp,%ebp
+     403:	53                   	push   %ebx
+     404:	83 ec 10             	sub    $0x10,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     407:	6a 0c                	push   $0xc
+     409:	e8 72 20 00 00       	call   2480 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     40e:	83 c4 0c             	add    $0xc,%esp
+     411:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     413:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     415:	6a 00                	push   $0x0
+     417:	50                   	push   %eax
+     418:	e8 f3 08 00 00       	call   d10 <memset>
+  cmd->type = LIST;
+  cmd->left = left;
+     41d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = LIST;
+     420:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+     426:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     429:	8b 45 0c             	mov    0xc(%ebp),%eax
+     42c:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     42f:	89 d8                	mov    %ebx,%eax
+     431:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     434:	c9                   	leave
+     435:	c3                   	ret
+     436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     43d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000440 <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     440:	55                   	push   %ebp
+     441:	89 e5                	mov    %esp,%ebp
+     443:	53                   	push   %ebx
+     444:	83 ec 10             	sub    $0x10,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     447:	6a 08                	push   $0x8
+     449:	e8 32 20 00 00       	call   2480 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     44e:	83 c4 0c             	add    $0xc,%esp
+     451:	6a 08                	push   $0x8
+  cmd = malloc(sizeof(*cmd));
+     453:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     455:	6a 00                	push   $0x0
+     457:	50                   	push   %eax
+     458:	e8 b3 08 00 00       	call   d10 <memset>
+  cmd->type = BACK;
+  cmd->cmd = subcmd;
+     45d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = BACK;
+     460:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+     466:	89 43 04             	mov    %eax,0x4(%ebx)
+  return (struct cmd*)cmd;
+}
+     469:	89 d8                	mov    %ebx,%eax
+     46b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     46e:	c9                   	leave
+     46f:	c3                   	ret
+
+00000470 <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     470:	55                   	push   %ebp
+     471:	89 e5                	mov    %esp,%ebp
+     473:	57                   	push   %edi
+     474:	56                   	push   %esi
+     475:	53                   	push   %ebx
+     476:	83 ec 0c             	sub    $0xc,%esp
+  char *s;
+  int ret;
+
+  s = *ps;
+     479:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+     47c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     47f:	8b 75 10             	mov    0x10(%ebp),%esi
+  s = *ps;
+     482:	8b 38                	mov    (%eax),%edi
+  while(s < es && strchr(whitespace, *s))
+     484:	39 df                	cmp    %ebx,%edi
+     486:	72 0f                	jb     497 <gettoken+0x27>
+     488:	eb 25                	jmp    4af <gettoken+0x3f>
+     48a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    s++;
+     490:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     493:	39 fb                	cmp    %edi,%ebx
+     495:	74 18                	je     4af <gettoken+0x3f>
+     497:	0f be 07             	movsbl (%edi),%eax
+     49a:	83 ec 08             	sub    $0x8,%esp
+     49d:	50                   	push   %eax
+     49e:	68 48 36 00 00       	push   $0x3648
+     4a3:	e8 88 08 00 00       	call   d30 <strchr>
+     4a8:	83 c4 10             	add    $0x10,%esp
+     4ab:	85 c0                	test   %eax,%eax
+     4ad:	75 e1                	jne    490 <gettoken+0x20>
+  if(q)
+     4af:	85 f6                	test   %esi,%esi
+     4b1:	74 02                	je     4b5 <gettoken+0x45>
+    *q = s;
+     4b3:	89 3e                	mov    %edi,(%esi)
+  ret = *s;
+     4b5:	0f b6 07             	movzbl (%edi),%eax
+  switch(*s){
+     4b8:	3c 3c                	cmp    $0x3c,%al
+     4ba:	0f 8f d0 00 00 00    	jg     590 <gettoken+0x120>
+     4c0:	3c 3a                	cmp    $0x3a,%al
+     4c2:	0f 8f bc 00 00 00    	jg     584 <gettoken+0x114>
+     4c8:	84 c0                	test   %al,%al
+     4ca:	75 44                	jne    510 <gettoken+0xa0>
+     4cc:	31 f6                	xor    %esi,%esi
+    ret = 'a';
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+      s++;
+    break;
+  }
+  if(eq)
+     4ce:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     4d1:	85 c9                	test   %ecx,%ecx
+     4d3:	74 05                	je     4da <gettoken+0x6a>
+    *eq = s;
+     4d5:	8b 45 14             	mov    0x14(%ebp),%eax
+     4d8:	89 38                	mov    %edi,(%eax)
+
+  while(s < es && strchr(whitespace, *s))
+     4da:	39 df                	cmp    %ebx,%edi
+     4dc:	72 09                	jb     4e7 <gettoken+0x77>
+     4de:	eb 1f                	jmp    4ff <gettoken+0x8f>
+    s++;
+     4e0:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     4e3:	39 fb                	cmp    %edi,%ebx
+     4e5:	74 18                	je     4ff <gettoken+0x8f>
+     4e7:	0f be 07             	movsbl (%edi),%eax
+     4ea:	83 ec 08             	sub    $0x8,%esp
+     4ed:	50                   	push   %eax
+     4ee:	68 48 36 00 00       	push   $0x3648
+     4f3:	e8 38 08 00 00       	call   d30 <strchr>
+     4f8:	83 c4 10             	add    $0x10,%esp
+     4fb:	85 c0                	test   %eax,%eax
+     4fd:	75 e1                	jne    4e0 <gettoken+0x70>
+  *ps = s;
+     4ff:	8b 45 08             	mov    0x8(%ebp),%eax
+     502:	89 38                	mov    %edi,(%eax)
+  return ret;
+}
+     504:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     507:	89 f0                	mov    %esi,%eax
+     509:	5b                   	pop    %ebx
+     50a:	5e                   	pop    %esi
+     50b:	5f                   	pop    %edi
+     50c:	5d                   	pop    %ebp
+     50d:	c3                   	ret
+     50e:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     510:	79 66                	jns    578 <gettoken+0x108>
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     512:	39 df                	cmp    %ebx,%edi
+     514:	72 39                	jb     54f <gettoken+0xdf>
+  if(eq)
+     516:	8b 55 14             	mov    0x14(%ebp),%edx
+     519:	85 d2                	test   %edx,%edx
+     51b:	0f 84 b3 00 00 00    	je     5d4 <gettoken+0x164>
+    *eq = s;
+     521:	8b 45 14             	mov    0x14(%ebp),%eax
+     524:	89 38                	mov    %edi,(%eax)
+  while(s < es && strchr(whitespace, *s))
+     526:	e9 a9 00 00 00       	jmp    5d4 <gettoken+0x164>
+     52b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     52f:	90                   	nop
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     530:	0f be 07             	movsbl (%edi),%eax
+     533:	83 ec 08             	sub    $0x8,%esp
+     536:	50                   	push   %eax
+     537:	68 40 36 00 00       	push   $0x3640
+     53c:	e8 ef 07 00 00       	call   d30 <strchr>
+     541:	83 c4 10             	add    $0x10,%esp
+     544:	85 c0                	test   %eax,%eax
+     546:	75 1f                	jne    567 <gettoken+0xf7>
+      s++;
+     548:	83 c7 01             	add    $0x1,%edi
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     54b:	39 fb                	cmp    %edi,%ebx
+     54d:	74 77                	je     5c6 <gettoken+0x156>
+     54f:	0f be 07             	movsbl (%edi),%eax
+     552:	83 ec 08             	sub    $0x8,%esp
+     555:	50                   	push   %eax
+     556:	68 48 36 00 00       	push   $0x3648
+     55b:	e8 d0 07 00 00       	call   d30 <strchr>
+     560:	83 c4 10             	add    $0x10,%esp
+     563:	85 c0                	test   %eax,%eax
+     565:	74 c9                	je     530 <gettoken+0xc0>
+    ret = 'a';
+     567:	be 61 00 00 00       	mov    $0x61,%esi
+     56c:	e9 5d ff ff ff       	jmp    4ce <gettoken+0x5e>
+     571:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  switch(*s){
+     578:	3c 26                	cmp    $0x26,%al
+     57a:	74 08                	je     584 <gettoken+0x114>
+     57c:	8d 48 d8             	lea    -0x28(%eax),%ecx
+     57f:	80 f9 01             	cmp    $0x1,%cl
+     582:	77 8e                	ja     512 <gettoken+0xa2>
+  ret = *s;
+     584:	0f be f0             	movsbl %al,%esi
+    s++;
+     587:	83 c7 01             	add    $0x1,%edi
+    break;
+     58a:	e9 3f ff ff ff       	jmp    4ce <gettoken+0x5e>
+     58f:	90                   	nop
+  switch(*s){
+     590:	3c 3e                	cmp    $0x3e,%al
+     592:	75 1c                	jne    5b0 <gettoken+0x140>
+    if(*s == '>'){
+     594:	80 7f 01 3e          	cmpb   $0x3e,0x1(%edi)
+     598:	74 1f                	je     5b9 <gettoken+0x149>
+    s++;
+     59a:	83 c7 01             	add    $0x1,%edi
+  ret = *s;
+     59d:	be 3e 00 00 00       	mov    $0x3e,%esi
+     5a2:	e9 27 ff ff ff       	jmp    4ce <gettoken+0x5e>
+     5a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5ae:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     5b0:	3c 7c                	cmp    $0x7c,%al
+     5b2:	74 d0                	je     584 <gettoken+0x114>
+     5b4:	e9 59 ff ff ff       	jmp    512 <gettoken+0xa2>
+      s++;
+     5b9:	83 c7 02             	add    $0x2,%edi
+      ret = '+';
+     5bc:	be 2b 00 00 00       	mov    $0x2b,%esi
+     5c1:	e9 08 ff ff ff       	jmp    4ce <gettoken+0x5e>
+  if(eq)
+     5c6:	8b 45 14             	mov    0x14(%ebp),%eax
+     5c9:	85 c0                	test   %eax,%eax
+     5cb:	74 05                	je     5d2 <gettoken+0x162>
+    *eq = s;
+     5cd:	8b 45 14             	mov    0x14(%ebp),%eax
+     5d0:	89 18                	mov    %ebx,(%eax)
+      s++;
+     5d2:	89 df                	mov    %ebx,%edi
+    ret = 'a';
+     5d4:	be 61 00 00 00       	mov    $0x61,%esi
+     5d9:	e9 21 ff ff ff       	jmp    4ff <gettoken+0x8f>
+     5de:	66 90                	xchg   %ax,%ax
+
+000005e0 <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     5e0:	55                   	push   %ebp
+     5e1:	89 e5                	mov    %esp,%ebp
+     5e3:	57                   	push   %edi
+     5e4:	56                   	push   %esi
+     5e5:	53                   	push   %ebx
+     5e6:	83 ec 0c             	sub    $0xc,%esp
+     5e9:	8b 7d 08             	mov    0x8(%ebp),%edi
+     5ec:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s;
+
+  s = *ps;
+     5ef:	8b 1f                	mov    (%edi),%ebx
+  while(s < es && strchr(whitespace, *s))
+     5f1:	39 f3                	cmp    %esi,%ebx
+     5f3:	72 12                	jb     607 <peek+0x27>
+     5f5:	eb 28                	jmp    61f <peek+0x3f>
+     5f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5fe:	66 90                	xchg   %ax,%ax
+    s++;
+     600:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     603:	39 de                	cmp    %ebx,%esi
+     605:	74 18                	je     61f <peek+0x3f>
+     607:	0f be 03             	movsbl (%ebx),%eax
+     60a:	83 ec 08             	sub    $0x8,%esp
+     60d:	50                   	push   %eax
+     60e:	68 48 36 00 00       	push   $0x3648
+     613:	e8 18 07 00 00       	call   d30 <strchr>
+     618:	83 c4 10             	add    $0x10,%esp
+     61b:	85 c0                	test   %eax,%eax
+     61d:	75 e1                	jne    600 <peek+0x20>
+  *ps = s;
+     61f:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+     621:	0f be 03             	movsbl (%ebx),%eax
+     624:	31 d2                	xor    %edx,%edx
+     626:	84 c0                	test   %al,%al
+     628:	75 0e                	jne    638 <peek+0x58>
+}
+     62a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     62d:	89 d0                	mov    %edx,%eax
+     62f:	5b                   	pop    %ebx
+     630:	5e                   	pop    %esi
+     631:	5f                   	pop    %edi
+     632:	5d                   	pop    %ebp
+     633:	c3                   	ret
+     634:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return *s && strchr(toks, *s);
+     638:	83 ec 08             	sub    $0x8,%esp
+     63b:	50                   	push   %eax
+     63c:	ff 75 10             	push   0x10(%ebp)
+     63f:	e8 ec 06 00 00       	call   d30 <strchr>
+     644:	83 c4 10             	add    $0x10,%esp
+     647:	31 d2                	xor    %edx,%edx
+     649:	85 c0                	test   %eax,%eax
+     64b:	0f 95 c2             	setne  %dl
+}
+     64e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     651:	5b                   	pop    %ebx
+     652:	89 d0                	mov    %edx,%eax
+     654:	5e                   	pop    %esi
+     655:	5f                   	pop    %edi
+     656:	5d                   	pop    %ebp
+     657:	c3                   	ret
+     658:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     65f:	90                   	nop
+
+00000660 <parseredirs>:
+  return cmd;
+}
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     660:	55                   	push   %ebp
+     661:	89 e5                	mov    %esp,%ebp
+     663:	57                   	push   %edi
+     664:	56                   	push   %esi
+     665:	53                   	push   %ebx
+     666:	83 ec 2c             	sub    $0x2c,%esp
+     669:	8b 75 0c             	mov    0xc(%ebp),%esi
+     66c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     66f:	90                   	nop
+     670:	83 ec 04             	sub    $0x4,%esp
+     673:	68 c9 28 00 00       	push   $0x28c9
+     678:	53                   	push   %ebx
+     679:	56                   	push   %esi
+     67a:	e8 61 ff ff ff       	call   5e0 <peek>
+     67f:	83 c4 10             	add    $0x10,%esp
+     682:	85 c0                	test   %eax,%eax
+     684:	0f 84 f6 00 00 00    	je     780 <parseredirs+0x120>
+    tok = gettoken(ps, es, 0, 0);
+     68a:	6a 00                	push   $0x0
+     68c:	6a 00                	push   $0x0
+     68e:	53                   	push   %ebx
+     68f:	56                   	push   %esi
+     690:	e8 db fd ff ff       	call   470 <gettoken>
+     695:	89 c7                	mov    %eax,%edi
+    if(gettoken(ps, es, &q, &eq) != 'a')
+     697:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     69a:	50                   	push   %eax
+     69b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     69e:	50                   	push   %eax
+     69f:	53                   	push   %ebx
+     6a0:	56                   	push   %esi
+     6a1:	e8 ca fd ff ff       	call   470 <gettoken>
+     6a6:	83 c4 20             	add    $0x20,%esp
+     6a9:	83 f8 61             	cmp    $0x61,%eax
+     6ac:	0f 85 d9 00 00 00    	jne    78b <parseredirs+0x12b>
+      panic("missing file for redirection");
+    switch(tok){
+     6b2:	83 ff 3c             	cmp    $0x3c,%edi
+     6b5:	74 69                	je     720 <parseredirs+0xc0>
+     6b7:	83 ff 3e             	cmp    $0x3e,%edi
+     6ba:	74 05                	je     6c1 <parseredirs+0x61>
+     6bc:	83 ff 2b             	cmp    $0x2b,%edi
+     6bf:	75 af                	jne    670 <parseredirs+0x10>
+      break;
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+      break;
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     6c1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     6c4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     6c7:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     6ca:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     6cd:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     6d0:	6a 18                	push   $0x18
+     6d2:	e8 a9 1d 00 00       	call   2480 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     6d7:	83 c4 0c             	add    $0xc,%esp
+     6da:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     6dc:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     6de:	6a 00                	push   $0x0
+     6e0:	50                   	push   %eax
+     6e1:	e8 2a 06 00 00       	call   d10 <memset>
+  cmd->type = REDIR;
+     6e6:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  cmd->cmd = subcmd;
+     6ec:	8b 45 08             	mov    0x8(%ebp),%eax
+      break;
+     6ef:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     6f2:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     6f5:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     6f8:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     6fb:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->mode = mode;
+     6fe:	c7 47 10 01 02 00 00 	movl   $0x201,0x10(%edi)
+  cmd->efile = efile;
+     705:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->fd = fd;
+     708:	c7 47 14 01 00 00 00 	movl   $0x1,0x14(%edi)
+      break;
+     70f:	89 7d 08             	mov    %edi,0x8(%ebp)
+     712:	e9 59 ff ff ff       	jmp    670 <parseredirs+0x10>
+     717:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     71e:	66 90                	xchg   %ax,%ax
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     720:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     723:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     726:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     729:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     72c:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     72f:	6a 18                	push   $0x18
+     731:	e8 4a 1d 00 00       	call   2480 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     736:	83 c4 0c             	add    $0xc,%esp
+     739:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     73b:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     73d:	6a 00                	push   $0x0
+     73f:	50                   	push   %eax
+     740:	e8 cb 05 00 00       	call   d10 <memset>
+  cmd->cmd = subcmd;
+     745:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->file = file;
+     748:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+      break;
+     74b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  cmd->efile = efile;
+     74e:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->type = REDIR;
+     751:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+      break;
+     757:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     75a:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     75d:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     760:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->mode = mode;
+     763:	c7 47 10 00 00 00 00 	movl   $0x0,0x10(%edi)
+  cmd->fd = fd;
+     76a:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+      break;
+     771:	e9 fa fe ff ff       	jmp    670 <parseredirs+0x10>
+     776:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     77d:	8d 76 00             	lea    0x0(%esi),%esi
+    }
+  }
+  return cmd;
+}
+     780:	8b 45 08             	mov    0x8(%ebp),%eax
+     783:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     786:	5b                   	pop    %ebx
+     787:	5e                   	pop    %esi
+     788:	5f                   	pop    %edi
+     789:	5d                   	pop    %ebp
+     78a:	c3                   	ret
+      panic("missing file for redirection");
+     78b:	83 ec 0c             	sub    $0xc,%esp
+     78e:	68 ac 28 00 00       	push   $0x28ac
+     793:	e8 d8 f9 ff ff       	call   170 <panic>
+     798:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     79f:	90                   	nop
+
+000007a0 <parseexec>:
+  return cmd;
+}
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     7a0:	55                   	push   %ebp
+     7a1:	89 e5                	mov    %esp,%ebp
+     7a3:	57                   	push   %edi
+     7a4:	56                   	push   %esi
+     7a5:	53                   	push   %ebx
+     7a6:	83 ec 30             	sub    $0x30,%esp
+     7a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     7ac:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if(peek(ps, es, "("))
+     7af:	68 cc 28 00 00       	push   $0x28cc
+     7b4:	56                   	push   %esi
+     7b5:	53                   	push   %ebx
+     7b6:	e8 25 fe ff ff       	call   5e0 <peek>
+     7bb:	83 c4 10             	add    $0x10,%esp
+     7be:	85 c0                	test   %eax,%eax
+     7c0:	0f 85 aa 00 00 00    	jne    870 <parseexec+0xd0>
+  cmd = malloc(sizeof(*cmd));
+     7c6:	83 ec 0c             	sub    $0xc,%esp
+     7c9:	89 c7                	mov    %eax,%edi
+     7cb:	6a 54                	push   $0x54
+     7cd:	e8 ae 1c 00 00       	call   2480 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     7d2:	83 c4 0c             	add    $0xc,%esp
+     7d5:	6a 54                	push   $0x54
+     7d7:	6a 00                	push   $0x0
+     7d9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     7dc:	50                   	push   %eax
+     7dd:	e8 2e 05 00 00       	call   d10 <memset>
+  cmd->type = EXEC;
+     7e2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+
+  ret = execcmd();
+  cmd = (struct execcmd*)ret;
+
+  argc = 0;
+  ret = parseredirs(ret, ps, es);
+     7e5:	83 c4 0c             	add    $0xc,%esp
+  cmd->type = EXEC;
+     7e8:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  ret = parseredirs(ret, ps, es);
+     7ee:	56                   	push   %esi
+     7ef:	53                   	push   %ebx
+     7f0:	50                   	push   %eax
+     7f1:	e8 6a fe ff ff       	call   660 <parseredirs>
+  while(!peek(ps, es, "|)&;")){
+     7f6:	83 c4 10             	add    $0x10,%esp
+  ret = parseredirs(ret, ps, es);
+     7f9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     7fc:	eb 15                	jmp    813 <parseexec+0x73>
+     7fe:	66 90                	xchg   %ax,%ax
+    cmd->argv[argc] = q;
+    cmd->eargv[argc] = eq;
+    argc++;
+    if(argc >= MAXARGS)
+      panic("too many args");
+    ret = parseredirs(ret, ps, es);
+     800:	83 ec 04             	sub    $0x4,%esp
+     803:	56                   	push   %esi
+     804:	53                   	push   %ebx
+     805:	ff 75 d4             	push   -0x2c(%ebp)
+     808:	e8 53 fe ff ff       	call   660 <parseredirs>
+     80d:	83 c4 10             	add    $0x10,%esp
+     810:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     813:	83 ec 04             	sub    $0x4,%esp
+     816:	68 e3 28 00 00       	push   $0x28e3
+     81b:	56                   	push   %esi
+     81c:	53                   	push   %ebx
+     81d:	e8 be fd ff ff       	call   5e0 <peek>
+     822:	83 c4 10             	add    $0x10,%esp
+     825:	85 c0                	test   %eax,%eax
+     827:	75 5f                	jne    888 <parseexec+0xe8>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     829:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     82c:	50                   	push   %eax
+     82d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     830:	50                   	push   %eax
+     831:	56                   	push   %esi
+     832:	53                   	push   %ebx
+     833:	e8 38 fc ff ff       	call   470 <gettoken>
+     838:	83 c4 10             	add    $0x10,%esp
+     83b:	85 c0                	test   %eax,%eax
+     83d:	74 49                	je     888 <parseexec+0xe8>
+    if(tok != 'a')
+     83f:	83 f8 61             	cmp    $0x61,%eax
+     842:	75 62                	jne    8a6 <parseexec+0x106>
+    cmd->argv[argc] = q;
+     844:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     847:	8b 55 d0             	mov    -0x30(%ebp),%edx
+     84a:	89 44 ba 04          	mov    %eax,0x4(%edx,%edi,4)
+    cmd->eargv[argc] = eq;
+     84e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     851:	89 44 ba 2c          	mov    %eax,0x2c(%edx,%edi,4)
+    argc++;
+     855:	83 c7 01             	add    $0x1,%edi
+    if(argc >= MAXARGS)
+     858:	83 ff 0a             	cmp    $0xa,%edi
+     85b:	75 a3                	jne    800 <parseexec+0x60>
+      panic("too many args");
+     85d:	83 ec 0c             	sub    $0xc,%esp
+     860:	68 d5 28 00 00       	push   $0x28d5
+     865:	e8 06 f9 ff ff       	call   170 <panic>
+     86a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return parseblock(ps, es);
+     870:	89 75 0c             	mov    %esi,0xc(%ebp)
+     873:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  }
+  cmd->argv[argc] = 0;
+  cmd->eargv[argc] = 0;
+  return ret;
+}
+     876:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     879:	5b                   	pop    %ebx
+     87a:	5e                   	pop    %esi
+     87b:	5f                   	pop    %edi
+     87c:	5d                   	pop    %ebp
+    return parseblock(ps, es);
+     87d:	e9 ae 01 00 00       	jmp    a30 <parseblock>
+     882:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  cmd->argv[argc] = 0;
+     888:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     88b:	c7 44 b8 04 00 00 00 	movl   $0x0,0x4(%eax,%edi,4)
+     892:	00 
+  cmd->eargv[argc] = 0;
+     893:	c7 44 b8 2c 00 00 00 	movl   $0x0,0x2c(%eax,%edi,4)
+     89a:	00 
+}
+     89b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     89e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8a1:	5b                   	pop    %ebx
+     8a2:	5e                   	pop    %esi
+     8a3:	5f                   	pop    %edi
+     8a4:	5d                   	pop    %ebp
+     8a5:	c3                   	ret
+      panic("syntax");
+     8a6:	83 ec 0c             	sub    $0xc,%esp
+     8a9:	68 ce 28 00 00       	push   $0x28ce
+     8ae:	e8 bd f8 ff ff       	call   170 <panic>
+     8b3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000008c0 <parsepipe>:
+{
+     8c0:	55                   	push   %ebp
+     8c1:	89 e5                	mov    %esp,%ebp
+     8c3:	57                   	push   %edi
+     8c4:	56                   	push   %esi
+     8c5:	53                   	push   %ebx
+     8c6:	83 ec 14             	sub    $0x14,%esp
+     8c9:	8b 75 08             	mov    0x8(%ebp),%esi
+     8cc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parseexec(ps, es);
+     8cf:	57                   	push   %edi
+     8d0:	56                   	push   %esi
+     8d1:	e8 ca fe ff ff       	call   7a0 <parseexec>
+  if(peek(ps, es, "|")){
+     8d6:	83 c4 0c             	add    $0xc,%esp
+     8d9:	68 e8 28 00 00       	push   $0x28e8
+  cmd = parseexec(ps, es);
+     8de:	89 c3                	mov    %eax,%ebx
+  if(peek(ps, es, "|")){
+     8e0:	57                   	push   %edi
+     8e1:	56                   	push   %esi
+     8e2:	e8 f9 fc ff ff       	call   5e0 <peek>
+     8e7:	83 c4 10             	add    $0x10,%esp
+     8ea:	85 c0                	test   %eax,%eax
+     8ec:	75 12                	jne    900 <parsepipe+0x40>
+}
+     8ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8f1:	89 d8                	mov    %ebx,%eax
+     8f3:	5b                   	pop    %ebx
+     8f4:	5e                   	pop    %esi
+     8f5:	5f                   	pop    %edi
+     8f6:	5d                   	pop    %ebp
+     8f7:	c3                   	ret
+     8f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ff:	90                   	nop
+    gettoken(ps, es, 0, 0);
+     900:	6a 00                	push   $0x0
+     902:	6a 00                	push   $0x0
+     904:	57                   	push   %edi
+     905:	56                   	push   %esi
+     906:	e8 65 fb ff ff       	call   470 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     90b:	58                   	pop    %eax
+     90c:	5a                   	pop    %edx
+     90d:	57                   	push   %edi
+     90e:	56                   	push   %esi
+     90f:	e8 ac ff ff ff       	call   8c0 <parsepipe>
+  cmd = malloc(sizeof(*cmd));
+     914:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     91b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     91d:	e8 5e 1b 00 00       	call   2480 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     922:	83 c4 0c             	add    $0xc,%esp
+     925:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     927:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     929:	6a 00                	push   $0x0
+     92b:	50                   	push   %eax
+     92c:	e8 df 03 00 00       	call   d10 <memset>
+  cmd->left = left;
+     931:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     934:	83 c4 10             	add    $0x10,%esp
+     937:	89 f3                	mov    %esi,%ebx
+  cmd->type = PIPE;
+     939:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+}
+     93f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     941:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     944:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     947:	5b                   	pop    %ebx
+     948:	5e                   	pop    %esi
+     949:	5f                   	pop    %edi
+     94a:	5d                   	pop    %ebp
+     94b:	c3                   	ret
+     94c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000950 <parseline>:
+{
+     950:	55                   	push   %ebp
+     951:	89 e5                	mov    %esp,%ebp
+     953:	57                   	push   %edi
+     954:	56                   	push   %esi
+     955:	53                   	push   %ebx
+     956:	83 ec 24             	sub    $0x24,%esp
+     959:	8b 75 08             	mov    0x8(%ebp),%esi
+     95c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+     95f:	57                   	push   %edi
+     960:	56                   	push   %esi
+     961:	e8 5a ff ff ff       	call   8c0 <parsepipe>
+  while(peek(ps, es, "&")){
+     966:	83 c4 10             	add    $0x10,%esp
+  cmd = parsepipe(ps, es);
+     969:	89 c3                	mov    %eax,%ebx
+  while(peek(ps, es, "&")){
+     96b:	eb 3b                	jmp    9a8 <parseline+0x58>
+     96d:	8d 76 00             	lea    0x0(%esi),%esi
+    gettoken(ps, es, 0, 0);
+     970:	6a 00                	push   $0x0
+     972:	6a 00                	push   $0x0
+     974:	57                   	push   %edi
+     975:	56                   	push   %esi
+     976:	e8 f5 fa ff ff       	call   470 <gettoken>
+  cmd = malloc(sizeof(*cmd));
+     97b:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+     982:	e8 f9 1a 00 00       	call   2480 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     987:	83 c4 0c             	add    $0xc,%esp
+     98a:	6a 08                	push   $0x8
+     98c:	6a 00                	push   $0x0
+     98e:	50                   	push   %eax
+     98f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     992:	e8 79 03 00 00       	call   d10 <memset>
+  cmd->type = BACK;
+     997:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  cmd->cmd = subcmd;
+     99a:	83 c4 10             	add    $0x10,%esp
+  cmd->type = BACK;
+     99d:	c7 02 05 00 00 00    	movl   $0x5,(%edx)
+  cmd->cmd = subcmd;
+     9a3:	89 5a 04             	mov    %ebx,0x4(%edx)
+     9a6:	89 d3                	mov    %edx,%ebx
+  while(peek(ps, es, "&")){
+     9a8:	83 ec 04             	sub    $0x4,%esp
+     9ab:	68 ea 28 00 00       	push   $0x28ea
+     9b0:	57                   	push   %edi
+     9b1:	56                   	push   %esi
+     9b2:	e8 29 fc ff ff       	call   5e0 <peek>
+     9b7:	83 c4 10             	add    $0x10,%esp
+     9ba:	85 c0                	test   %eax,%eax
+     9bc:	75 b2                	jne    970 <parseline+0x20>
+  if(peek(ps, es, ";")){
+     9be:	83 ec 04             	sub    $0x4,%esp
+     9c1:	68 e6 28 00 00       	push   $0x28e6
+     9c6:	57                   	push   %edi
+     9c7:	56                   	push   %esi
+     9c8:	e8 13 fc ff ff       	call   5e0 <peek>
+     9cd:	83 c4 10             	add    $0x10,%esp
+     9d0:	85 c0                	test   %eax,%eax
+     9d2:	75 0c                	jne    9e0 <parseline+0x90>
+}
+     9d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9d7:	89 d8                	mov    %ebx,%eax
+     9d9:	5b                   	pop    %ebx
+     9da:	5e                   	pop    %esi
+     9db:	5f                   	pop    %edi
+     9dc:	5d                   	pop    %ebp
+     9dd:	c3                   	ret
+     9de:	66 90                	xchg   %ax,%ax
+    gettoken(ps, es, 0, 0);
+     9e0:	6a 00                	push   $0x0
+     9e2:	6a 00                	push   $0x0
+     9e4:	57                   	push   %edi
+     9e5:	56                   	push   %esi
+     9e6:	e8 85 fa ff ff       	call   470 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     9eb:	58                   	pop    %eax
+     9ec:	5a                   	pop    %edx
+     9ed:	57                   	push   %edi
+     9ee:	56                   	push   %esi
+     9ef:	e8 5c ff ff ff       	call   950 <parseline>
+  cmd = malloc(sizeof(*cmd));
+     9f4:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = listcmd(cmd, parseline(ps, es));
+     9fb:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     9fd:	e8 7e 1a 00 00       	call   2480 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     a02:	83 c4 0c             	add    $0xc,%esp
+     a05:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     a07:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     a09:	6a 00                	push   $0x0
+     a0b:	50                   	push   %eax
+     a0c:	e8 ff 02 00 00       	call   d10 <memset>
+  cmd->left = left;
+     a11:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     a14:	83 c4 10             	add    $0x10,%esp
+     a17:	89 f3                	mov    %esi,%ebx
+  cmd->type = LIST;
+     a19:	c7 06 04 00 00 00    	movl   $0x4,(%esi)
+}
+     a1f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     a21:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     a24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a27:	5b                   	pop    %ebx
+     a28:	5e                   	pop    %esi
+     a29:	5f                   	pop    %edi
+     a2a:	5d                   	pop    %ebp
+     a2b:	c3                   	ret
+     a2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a30 <parseblock>:
+{
+     a30:	55                   	push   %ebp
+     a31:	89 e5                	mov    %esp,%ebp
+     a33:	57                   	push   %edi
+     a34:	56                   	push   %esi
+     a35:	53                   	push   %ebx
+     a36:	83 ec 10             	sub    $0x10,%esp
+     a39:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     a3c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(!peek(ps, es, "("))
+     a3f:	68 cc 28 00 00       	push   $0x28cc
+     a44:	56                   	push   %esi
+     a45:	53                   	push   %ebx
+     a46:	e8 95 fb ff ff       	call   5e0 <peek>
+     a4b:	83 c4 10             	add    $0x10,%esp
+     a4e:	85 c0                	test   %eax,%eax
+     a50:	74 4a                	je     a9c <parseblock+0x6c>
+  gettoken(ps, es, 0, 0);
+     a52:	6a 00                	push   $0x0
+     a54:	6a 00                	push   $0x0
+     a56:	56                   	push   %esi
+     a57:	53                   	push   %ebx
+     a58:	e8 13 fa ff ff       	call   470 <gettoken>
+  cmd = parseline(ps, es);
+     a5d:	58                   	pop    %eax
+     a5e:	5a                   	pop    %edx
+     a5f:	56                   	push   %esi
+     a60:	53                   	push   %ebx
+     a61:	e8 ea fe ff ff       	call   950 <parseline>
+  if(!peek(ps, es, ")"))
+     a66:	83 c4 0c             	add    $0xc,%esp
+     a69:	68 08 29 00 00       	push   $0x2908
+  cmd = parseline(ps, es);
+     a6e:	89 c7                	mov    %eax,%edi
+  if(!peek(ps, es, ")"))
+     a70:	56                   	push   %esi
+     a71:	53                   	push   %ebx
+     a72:	e8 69 fb ff ff       	call   5e0 <peek>
+     a77:	83 c4 10             	add    $0x10,%esp
+     a7a:	85 c0                	test   %eax,%eax
+     a7c:	74 2b                	je     aa9 <parseblock+0x79>
+  gettoken(ps, es, 0, 0);
+     a7e:	6a 00                	push   $0x0
+     a80:	6a 00                	push   $0x0
+     a82:	56                   	push   %esi
+     a83:	53                   	push   %ebx
+     a84:	e8 e7 f9 ff ff       	call   470 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+     a89:	83 c4 0c             	add    $0xc,%esp
+     a8c:	56                   	push   %esi
+     a8d:	53                   	push   %ebx
+     a8e:	57                   	push   %edi
+     a8f:	e8 cc fb ff ff       	call   660 <parseredirs>
+}
+     a94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a97:	5b                   	pop    %ebx
+     a98:	5e                   	pop    %esi
+     a99:	5f                   	pop    %edi
+     a9a:	5d                   	pop    %ebp
+     a9b:	c3                   	ret
+    panic("parseblock");
+     a9c:	83 ec 0c             	sub    $0xc,%esp
+     a9f:	68 ec 28 00 00       	push   $0x28ec
+     aa4:	e8 c7 f6 ff ff       	call   170 <panic>
+    panic("syntax - missing )");
+     aa9:	83 ec 0c             	sub    $0xc,%esp
+     aac:	68 f7 28 00 00       	push   $0x28f7
+     ab1:	e8 ba f6 ff ff       	call   170 <panic>
+     ab6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     abd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ac0 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+     ac0:	55                   	push   %ebp
+     ac1:	89 e5                	mov    %esp,%ebp
+     ac3:	53                   	push   %ebx
+     ac4:	83 ec 04             	sub    $0x4,%esp
+     ac7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     aca:	85 db                	test   %ebx,%ebx
+     acc:	0f 84 7e 00 00 00    	je     b50 <nulterminate+0x90>
+    return 0;
+
+  switch(cmd->type){
+     ad2:	83 3b 05             	cmpl   $0x5,(%ebx)
+     ad5:	77 20                	ja     af7 <nulterminate+0x37>
+     ad7:	8b 03                	mov    (%ebx),%eax
+     ad9:	ff 24 85 48 29 00 00 	jmp    *0x2948(,%eax,4)
+    nulterminate(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    nulterminate(lcmd->left);
+     ae0:	83 ec 0c             	sub    $0xc,%esp
+     ae3:	ff 73 04             	push   0x4(%ebx)
+     ae6:	e8 d5 ff ff ff       	call   ac0 <nulterminate>
+    nulterminate(lcmd->right);
+     aeb:	58                   	pop    %eax
+     aec:	ff 73 08             	push   0x8(%ebx)
+     aef:	e8 cc ff ff ff       	call   ac0 <nulterminate>
+    break;
+     af4:	83 c4 10             	add    $0x10,%esp
+    return 0;
+     af7:	89 d8                	mov    %ebx,%eax
+    bcmd = (struct backcmd*)cmd;
+    nulterminate(bcmd->cmd);
+    break;
+  }
+  return cmd;
+}
+     af9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     afc:	c9                   	leave
+     afd:	c3                   	ret
+     afe:	66 90                	xchg   %ax,%ax
+    nulterminate(bcmd->cmd);
+     b00:	83 ec 0c             	sub    $0xc,%esp
+     b03:	ff 73 04             	push   0x4(%ebx)
+     b06:	e8 b5 ff ff ff       	call   ac0 <nulterminate>
+    break;
+     b0b:	83 c4 10             	add    $0x10,%esp
+     b0e:	eb e7                	jmp    af7 <nulterminate+0x37>
+    for(i=0; ecmd->argv[i]; i++)
+     b10:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     b13:	8d 43 08             	lea    0x8(%ebx),%eax
+     b16:	85 c9                	test   %ecx,%ecx
+     b18:	74 dd                	je     af7 <nulterminate+0x37>
+     b1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      *ecmd->eargv[i] = 0;
+     b20:	8b 50 24             	mov    0x24(%eax),%edx
+    for(i=0; ecmd->argv[i]; i++)
+     b23:	83 c0 04             	add    $0x4,%eax
+      *ecmd->eargv[i] = 0;
+     b26:	c6 02 00             	movb   $0x0,(%edx)
+    for(i=0; ecmd->argv[i]; i++)
+     b29:	8b 50 fc             	mov    -0x4(%eax),%edx
+     b2c:	85 d2                	test   %edx,%edx
+     b2e:	75 f0                	jne    b20 <nulterminate+0x60>
+     b30:	eb c5                	jmp    af7 <nulterminate+0x37>
+     b32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    nulterminate(rcmd->cmd);
+     b38:	83 ec 0c             	sub    $0xc,%esp
+     b3b:	ff 73 04             	push   0x4(%ebx)
+     b3e:	e8 7d ff ff ff       	call   ac0 <nulterminate>
+    *rcmd->efile = 0;
+     b43:	8b 43 0c             	mov    0xc(%ebx),%eax
+    break;
+     b46:	83 c4 10             	add    $0x10,%esp
+    *rcmd->efile = 0;
+     b49:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+     b4c:	eb a9                	jmp    af7 <nulterminate+0x37>
+     b4e:	66 90                	xchg   %ax,%ax
+    return 0;
+     b50:	31 c0                	xor    %eax,%eax
+     b52:	eb a5                	jmp    af9 <nulterminate+0x39>
+     b54:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b5f:	90                   	nop
+
+00000b60 <parsecmd>:
+{
+     b60:	55                   	push   %ebp
+     b61:	89 e5                	mov    %esp,%ebp
+     b63:	57                   	push   %edi
+     b64:	56                   	push   %esi
+  cmd = parseline(&s, es);
+     b65:	8d 7d 08             	lea    0x8(%ebp),%edi
+{
+     b68:	53                   	push   %ebx
+     b69:	83 ec 18             	sub    $0x18,%esp
+  es = s + strlen(s);
+     b6c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     b6f:	53                   	push   %ebx
+     b70:	e8 6b 01 00 00       	call   ce0 <strlen>
+  cmd = parseline(&s, es);
+     b75:	59                   	pop    %ecx
+     b76:	5e                   	pop    %esi
+  es = s + strlen(s);
+     b77:	01 c3                	add    %eax,%ebx
+  cmd = parseline(&s, es);
+     b79:	53                   	push   %ebx
+     b7a:	57                   	push   %edi
+     b7b:	e8 d0 fd ff ff       	call   950 <parseline>
+  peek(&s, es, "");
+     b80:	83 c4 0c             	add    $0xc,%esp
+     b83:	68 96 28 00 00       	push   $0x2896
+  cmd = parseline(&s, es);
+     b88:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+     b8a:	53                   	push   %ebx
+     b8b:	57                   	push   %edi
+     b8c:	e8 4f fa ff ff       	call   5e0 <peek>
+  if(s != es){
+     b91:	8b 45 08             	mov    0x8(%ebp),%eax
+     b94:	83 c4 10             	add    $0x10,%esp
+     b97:	39 d8                	cmp    %ebx,%eax
+     b99:	75 13                	jne    bae <parsecmd+0x4e>
+  nulterminate(cmd);
+     b9b:	83 ec 0c             	sub    $0xc,%esp
+     b9e:	56                   	push   %esi
+     b9f:	e8 1c ff ff ff       	call   ac0 <nulterminate>
+}
+     ba4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ba7:	89 f0                	mov    %esi,%eax
+     ba9:	5b                   	pop    %ebx
+     baa:	5e                   	pop    %esi
+     bab:	5f                   	pop    %edi
+     bac:	5d                   	pop    %ebp
+     bad:	c3                   	ret
+    printf(2, "leftovers: %s\n", s);
+     bae:	52                   	push   %edx
+     baf:	50                   	push   %eax
+     bb0:	68 0a 29 00 00       	push   $0x290a
+     bb5:	6a 02                	push   $0x2
+     bb7:	e8 34 08 00 00       	call   13f0 <printf>
+    panic("syntax");
+     bbc:	c7 04 24 ce 28 00 00 	movl   $0x28ce,(%esp)
+     bc3:	e8 a8 f5 ff ff       	call   170 <panic>
+     bc8:	66 90                	xchg   %ax,%ax
+     bca:	66 90                	xchg   %ax,%ax
+     bcc:	66 90                	xchg   %ax,%ax
+     bce:	66 90                	xchg   %ax,%ax
+
+00000bd0 <fork>:
+int sysexit(void) __attribute__((noreturn));
+
+int
+fork(void)
+{
+  if(flushhook)
+     bd0:	a1 a4 37 00 00       	mov    0x37a4,%eax
+     bd5:	85 c0                	test   %eax,%eax
+     bd7:	74 17                	je     bf0 <fork+0x20>
+{
+     bd9:	55                   	push   %ebp
+     bda:	89 e5                	mov    %esp,%ebp
+     bdc:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     bdf:	ff d0                	call   *%eax
+  return sysfork();
+}
+     be1:	c9                   	leave
+  return sysfork();
+     be2:	e9 7f 03 00 00       	jmp    f66 <sysfork>
+     be7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bee:	66 90                	xchg   %ax,%ax
+     bf0:	e9 71 03 00 00       	jmp    f66 <sysfork>
+     bf5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c00 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+     c00:	55                   	push   %ebp
+  if(flushhook)
+     c01:	a1 a4 37 00 00       	mov    0x37a4,%eax
+{
+     c06:	89 e5                	mov    %esp,%ebp
+     c08:	56                   	push   %esi
+     c09:	53                   	push   %ebx
+     c0a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     c0d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     c10:	85 c0                	test   %eax,%eax
+     c12:	74 02                	je     c16 <exec+0x16>
+    flushhook();
+     c14:	ff d0                	call   *%eax
+  return sysexec(path, argv);
+     c16:	89 75 0c             	mov    %esi,0xc(%ebp)
+     c19:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     c1c:	5b                   	pop    %ebx
+     c1d:	5e                   	pop    %esi
+     c1e:	5d                   	pop    %ebp
+  return sysexec(path, argv);
+     c1f:	e9 ba 03 00 00       	jmp    fde <sysexec>
+     c24:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c2f:	90                   	nop
+
+00000c30 <exit>:
+
+int
+exit(void)
+{
+     c30:	55                   	push   %ebp
+     c31:	89 e5                	mov    %esp,%ebp
+     c33:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     c36:	a1 a4 37 00 00       	mov    0x37a4,%eax
+     c3b:	85 c0                	test   %eax,%eax
+     c3d:	74 02                	je     c41 <exit+0x11>
+    flushhook();
+     c3f:	ff d0                	call   *%eax
+  sysexit();
+     c41:	e8 2f 03 00 00       	call   f75 <sysexit>
+     c46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c50 <strcpy>:
+}
+
+char*
+strcpy(char *s, const char *t)
+{
+     c50:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     c51:	31 c0                	xor    %eax,%eax
+{
+     c53:	89 e5                	mov    %esp,%ebp
+     c55:	53                   	push   %ebx
+     c56:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     c59:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     c5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     c60:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     c64:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     c67:	83 c0 01             	add    $0x1,%eax
+     c6a:	84 d2                	test   %dl,%dl
+     c6c:	75 f2                	jne    c60 <strcpy+0x10>
+    ;
+  return os;
+}
+     c6e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c71:	89 c8                	mov    %ecx,%eax
+     c73:	c9                   	leave
+     c74:	c3                   	ret
+     c75:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c80 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     c80:	55                   	push   %ebp
+     c81:	89 e5                	mov    %esp,%ebp
+     c83:	53                   	push   %ebx
+     c84:	8b 55 08             	mov    0x8(%ebp),%edx
+     c87:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     c8a:	0f b6 02             	movzbl (%edx),%eax
+     c8d:	84 c0                	test   %al,%al
+     c8f:	75 17                	jne    ca8 <strcmp+0x28>
+     c91:	eb 3a                	jmp    ccd <strcmp+0x4d>
+     c93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c97:	90                   	nop
+     c98:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     c9c:	83 c2 01             	add    $0x1,%edx
+     c9f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     ca2:	84 c0                	test   %al,%al
+     ca4:	74 1a                	je     cc0 <strcmp+0x40>
+    p++, q++;
+     ca6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     ca8:	0f b6 19             	movzbl (%ecx),%ebx
+     cab:	38 c3                	cmp    %al,%bl
+     cad:	74 e9                	je     c98 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     caf:	29 d8                	sub    %ebx,%eax
+}
+     cb1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     cb4:	c9                   	leave
+     cb5:	c3                   	ret
+     cb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cbd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     cc0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     cc4:	31 c0                	xor    %eax,%eax
+     cc6:	29 d8                	sub    %ebx,%eax
+}
+     cc8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ccb:	c9                   	leave
+     ccc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     ccd:	0f b6 19             	movzbl (%ecx),%ebx
+     cd0:	31 c0                	xor    %eax,%eax
+     cd2:	eb db                	jmp    caf <strcmp+0x2f>
+     cd4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cdf:	90                   	nop
+
+00000ce0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     ce0:	55                   	push   %ebp
+     ce1:	89 e5                	mov    %esp,%ebp
+     ce3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     ce6:	80 3a 00             	cmpb   $0x0,(%edx)
+     ce9:	74 15                	je     d00 <strlen+0x20>
+     ceb:	31 c0                	xor    %eax,%eax
+     ced:	8d 76 00             	lea    0x0(%esi),%esi
+     cf0:	83 c0 01             	add    $0x1,%eax
+     cf3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     cf7:	89 c1                	mov    %eax,%ecx
+     cf9:	75 f5                	jne    cf0 <strlen+0x10>
+    ;
+  return n;
+}
+     cfb:	89 c8                	mov    %ecx,%eax
+     cfd:	5d                   	pop    %ebp
+     cfe:	c3                   	ret
+     cff:	90                   	nop
+  for(n = 0; s[n]; n++)
+     d00:	31 c9                	xor    %ecx,%ecx
+}
+     d02:	5d                   	pop    %ebp
+     d03:	89 c8                	mov    %ecx,%eax
+     d05:	c3                   	ret
+     d06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d10 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     d10:	55                   	push   %ebp
+     d11:	89 e5                	mov    %esp,%ebp
+     d13:	57                   	push   %edi
+     d14:	8b 55 08             	mov    0x8(%ebp),%edx
+            "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt) {
+    asm volatile("cld; rep stosb" :
+     d17:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     d1a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     d1d:	89 d7                	mov    %edx,%edi
+     d1f:	fc                   	cld
+     d20:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     d22:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     d25:	89 d0                	mov    %edx,%eax
+     d27:	c9                   	leave
+     d28:	c3                   	ret
+     d29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d30 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     d30:	55                   	push   %ebp
+     d31:	89 e5                	mov    %esp,%ebp
+     d33:	8b 45 08             	mov    0x8(%ebp),%eax
+     d36:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     d3a:	0f b6 10             	movzbl (%eax),%edx
+     d3d:	84 d2                	test   %dl,%dl
+     d3f:	75 12                	jne    d53 <strchr+0x23>
+     d41:	eb 1d                	jmp    d60 <strchr+0x30>
+     d43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d47:	90                   	nop
+     d48:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     d4c:	83 c0 01             	add    $0x1,%eax
+     d4f:	84 d2                	test   %dl,%dl
+     d51:	74 0d                	je     d60 <strchr+0x30>
+    if(*s == c)
+     d53:	38 d1                	cmp    %dl,%cl
+     d55:	75 f1                	jne    d48 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     d57:	5d                   	pop    %ebp
+     d58:	c3                   	ret
+     d59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     d60:	31 c0                	xor    %eax,%eax
+}
+     d62:	5d                   	pop    %ebp
+     d63:	c3                   	ret
+     d64:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d6f:	90                   	nop
+
+00000d70 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     d70:	55                   	push   %ebp
+     d71:	89 e5                	mov    %esp,%ebp
+     d73:	56                   	push   %esi
+     d74:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     d75:	83 ec 08             	sub    $0x8,%esp
+     d78:	6a 00                	push   $0x0
+     d7a:	ff 75 08             	push   0x8(%ebp)
+     d7d:	e8 6b 02 00 00       	call   fed <open>
+  if(fd < 0)
+     d82:	83 c4 10             	add    $0x10,%esp
+     d85:	85 c0                	test   %eax,%eax
+     d87:	78 27                	js     db0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     d89:	83 ec 08             	sub    $0x8,%esp
+     d8c:	ff 75 0c             	push   0xc(%ebp)
+     d8f:	89 c3                	mov    %eax,%ebx
+     d91:	50                   	push   %eax
+     d92:	e8 83 02 00 00       	call   101a <fstat>
+  close(fd);
+     d97:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     d9a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     d9c:	e8 1f 02 00 00       	call   fc0 <close>
+  return r;
+     da1:	83 c4 10             	add    $0x10,%esp
+}
+     da4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     da7:	89 f0                	mov    %esi,%eax
+     da9:	5b                   	pop    %ebx
+     daa:	5e                   	pop    %esi
+     dab:	5d                   	pop    %ebp
+     dac:	c3                   	ret
+     dad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     db0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     db5:	eb ed                	jmp    da4 <stat+0x34>
+     db7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dbe:	66 90                	xchg   %ax,%ax
+
+00000dc0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     dc0:	55                   	push   %ebp
+     dc1:	89 e5                	mov    %esp,%ebp
+     dc3:	53                   	push   %ebx
+     dc4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     dc7:	0f be 02             	movsbl (%edx),%eax
+     dca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     dcd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     dd0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     dd5:	77 1e                	ja     df5 <atoi+0x35>
+     dd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dde:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     de0:	83 c2 01             	add    $0x1,%edx
+     de3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     de6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     dea:	0f be 02             	movsbl (%edx),%eax
+     ded:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     df0:	80 fb 09             	cmp    $0x9,%bl
+     df3:	76 eb                	jbe    de0 <atoi+0x20>
+  return n;
+}
+     df5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     df8:	89 c8                	mov    %ecx,%eax
+     dfa:	c9                   	leave
+     dfb:	c3                   	ret
+     dfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000e00 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     e00:	55                   	push   %ebp
+     e01:	89 e5                	mov    %esp,%ebp
+     e03:	57                   	push   %edi
+     e04:	56                   	push   %esi
+     e05:	8b 45 10             	mov    0x10(%ebp),%eax
+     e08:	8b 55 08             	mov    0x8(%ebp),%edx
+     e0b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     e0e:	85 c0                	test   %eax,%eax
+     e10:	7e 13                	jle    e25 <memmove+0x25>
+     e12:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     e14:	89 d7                	mov    %edx,%edi
+     e16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e1d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     e20:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     e21:	39 f8                	cmp    %edi,%eax
+     e23:	75 fb                	jne    e20 <memmove+0x20>
+  return vdst;
+}
+     e25:	5e                   	pop    %esi
+     e26:	89 d0                	mov    %edx,%eax
+     e28:	5f                   	pop    %edi
+     e29:	5d                   	pop    %ebp
+     e2a:	c3                   	ret
+     e2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e2f:	90                   	nop
+
+00000e30 <mutex_init>:
+
+// Futex-based mutex (Drepper, "Futexes Are Tricky", mutex 2).
+// The uncontended paths never enter the kernel.
+void
+mutex_init(struct mutex *m)
+{
+     e30:	55                   	push   %ebp
+     e31:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+     e33:	8b 45 08             	mov    0x8(%ebp),%eax
+     e36:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     e3c:	5d                   	pop    %ebp
+     e3d:	c3                   	ret
+     e3e:	66 90                	xchg   %ax,%ax
+
+00000e40 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     e40:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     e41:	31 c0                	xor    %eax,%eax
+     e43:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+     e48:	89 e5                	mov    %esp,%ebp
+     e4a:	56                   	push   %esi
+     e4b:	53                   	push   %ebx
+     e4c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     e4f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     e53:	85 c0                	test   %eax,%eax
+     e55:	74 32                	je     e89 <mutex_lock+0x49>
+    return;
+  if(c != 2)
+     e57:	83 f8 02             	cmp    $0x2,%eax
+     e5a:	74 0c                	je     e68 <mutex_lock+0x28>
+static inline uint
+xchg(volatile uint *addr, uint newval) {
+    uint result;
+
+    // The + in "+m" denotes a read-modify-write operand.
+    asm volatile("lock; xchgl %0, %1" :
+     e5c:	b8 02 00 00 00       	mov    $0x2,%eax
+     e61:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+     e64:	85 c0                	test   %eax,%eax
+     e66:	74 21                	je     e89 <mutex_lock+0x49>
+     e68:	be 02 00 00 00       	mov    $0x2,%esi
+     e6d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAIT, 2);
+     e70:	83 ec 04             	sub    $0x4,%esp
+     e73:	6a 02                	push   $0x2
+     e75:	6a 00                	push   $0x0
+     e77:	53                   	push   %ebx
+     e78:	e8 33 02 00 00       	call   10b0 <futex>
+     e7d:	89 f0                	mov    %esi,%eax
+     e7f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     e82:	83 c4 10             	add    $0x10,%esp
+     e85:	85 c0                	test   %eax,%eax
+     e87:	75 e7                	jne    e70 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+     e89:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e8c:	5b                   	pop    %ebx
+     e8d:	5e                   	pop    %esi
+     e8e:	5d                   	pop    %ebp
+     e8f:	c3                   	ret
+
+00000e90 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     e90:	55                   	push   %ebp
+     e91:	89 e5                	mov    %esp,%ebp
+     e93:	83 ec 08             	sub    $0x8,%esp
+     e96:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     e99:	f0 83 28 01          	lock subl $0x1,(%eax)
+     e9d:	75 09                	jne    ea8 <mutex_unlock+0x18>
+    m->val = 0;
+    futex(&m->val, FUTEX_WAKE, 1);
+  }
+}
+     e9f:	c9                   	leave
+     ea0:	c3                   	ret
+     ea1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     ea8:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     eab:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex(&m->val, FUTEX_WAKE, 1);
+     eb1:	6a 01                	push   $0x1
+     eb3:	6a 01                	push   $0x1
+     eb5:	50                   	push   %eax
+     eb6:	e8 f5 01 00 00       	call   10b0 <futex>
+     ebb:	83 c4 10             	add    $0x10,%esp
+}
+     ebe:	c9                   	leave
+     ebf:	c3                   	ret
+
+00000ec0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     ec0:	55                   	push   %ebp
+     ec1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     ec3:	8b 45 08             	mov    0x8(%ebp),%eax
+     ec6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     ecc:	5d                   	pop    %ebp
+     ecd:	c3                   	ret
+     ece:	66 90                	xchg   %ax,%ax
+
+00000ed0 <cond_wait>:
+
+// Release m and wait for a signal, then reacquire m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     ed0:	55                   	push   %ebp
+     ed1:	89 e5                	mov    %esp,%ebp
+     ed3:	57                   	push   %edi
+     ed4:	56                   	push   %esi
+     ed5:	53                   	push   %ebx
+     ed6:	83 ec 0c             	sub    $0xc,%esp
+     ed9:	8b 75 08             	mov    0x8(%ebp),%esi
+     edc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     edf:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     ee1:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+     ee5:	75 21                	jne    f08 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     ee7:	83 ec 04             	sub    $0x4,%esp
+     eea:	57                   	push   %edi
+     eeb:	6a 00                	push   $0x0
+     eed:	56                   	push   %esi
+     eee:	e8 bd 01 00 00       	call   10b0 <futex>
+  mutex_lock(m);
+     ef3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     ef6:	83 c4 10             	add    $0x10,%esp
+}
+     ef9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     efc:	5b                   	pop    %ebx
+     efd:	5e                   	pop    %esi
+     efe:	5f                   	pop    %edi
+     eff:	5d                   	pop    %ebp
+  mutex_lock(m);
+     f00:	e9 3b ff ff ff       	jmp    e40 <mutex_lock>
+     f05:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     f08:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     f0b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex(&m->val, FUTEX_WAKE, 1);
+     f11:	6a 01                	push   $0x1
+     f13:	6a 01                	push   $0x1
+     f15:	53                   	push   %ebx
+     f16:	e8 95 01 00 00       	call   10b0 <futex>
+     f1b:	83 c4 10             	add    $0x10,%esp
+     f1e:	eb c7                	jmp    ee7 <cond_wait+0x17>
+
+00000f20 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+     f20:	55                   	push   %ebp
+     f21:	89 e5                	mov    %esp,%ebp
+     f23:	83 ec 0c             	sub    $0xc,%esp
+     f26:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     f29:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+     f2d:	6a 01                	push   $0x1
+     f2f:	6a 01                	push   $0x1
+     f31:	50                   	push   %eax
+     f32:	e8 79 01 00 00       	call   10b0 <futex>
+}
+     f37:	83 c4 10             	add    $0x10,%esp
+     f3a:	c9                   	leave
+     f3b:	c3                   	ret
+     f3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000f40 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     f40:	55                   	push   %ebp
+     f41:	89 e5                	mov    %esp,%ebp
+     f43:	83 ec 0c             	sub    $0xc,%esp
+     f46:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     f49:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+     f4d:	6a 40                	push   $0x40
+     f4f:	6a 01                	push   $0x1
+     f51:	50                   	push   %eax
+     f52:	e8 59 01 00 00       	call   10b0 <futex>
+}
+     f57:	83 c4 10             	add    $0x10,%esp
+     f5a:	c9                   	leave
+     f5b:	c3                   	ret
+     f5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000f60 <uptime>:
+// Clock ticks since boot, read from the kernel's vdso page
+// without a system call.
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     f60:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+     f65:	c3                   	ret
+
+00000f66 <sysfork>:
+  1: ret
+
+#define SYSCALL(name) SYSCALLAS(name, name)
+
+// ulib.c wraps these.
+SYSCALLAS(sysfork, fork)
+     f66:	b8 01 00 00 00       	mov    $0x1,%eax
+     f6b:	89 e1                	mov    %esp,%ecx
+     f6d:	ba 74 0f 00 00       	mov    $0xf74,%edx
+     f72:	0f 34                	sysenter
+     f74:	c3                   	ret
+
+00000f75 <sysexit>:
+SYSCALLAS(sysexit, exit)
+     f75:	b8 02 00 00 00       	mov    $0x2,%eax
+     f7a:	89 e1                	mov    %esp,%ecx
+     f7c:	ba 83 0f 00 00       	mov    $0xf83,%edx
+     f81:	0f 34                	sysenter
+     f83:	c3                   	ret
+
+00000f84 <wait>:
+SYSCALL(wait)
+     f84:	b8 03 00 00 00       	mov    $0x3,%eax
+     f89:	89 e1                	mov    %esp,%ecx
+     f8b:	ba 92 0f 00 00       	mov    $0xf92,%edx
+     f90:	0f 34                	sysenter
+     f92:	c3                   	ret
+
+00000f93 <pipe>:
+SYSCALL(pipe)
+     f93:	b8 04 00 00 00       	mov    $0x4,%eax
+     f98:	89 e1                	mov    %esp,%ecx
+     f9a:	ba a1 0f 00 00       	mov    $0xfa1,%edx
+     f9f:	0f 34                	sysenter
+     fa1:	c3                   	ret
+
+00000fa2 <read>:
+SYSCALL(read)
+     fa2:	b8 05 00 00 00       	mov    $0x5,%eax
+     fa7:	89 e1                	mov    %esp,%ecx
+     fa9:	ba b0 0f 00 00       	mov    $0xfb0,%edx
+     fae:	0f 34                	sysenter
+     fb0:	c3                   	ret
+
+00000fb1 <write>:
+SYSCALL(write)
+     fb1:	b8 10 00 00 00       	mov    $0x10,%eax
+     fb6:	89 e1                	mov    %esp,%ecx
+     fb8:	ba bf 0f 00 00       	mov    $0xfbf,%edx
+     fbd:	0f 34                	sysenter
+     fbf:	c3                   	ret
+
+00000fc0 <close>:
+SYSCALL(close)
+     fc0:	b8 15 00 00 00       	mov    $0x15,%eax
+     fc5:	89 e1                	mov    %esp,%ecx
+     fc7:	ba ce 0f 00 00       	mov    $0xfce,%edx
+     fcc:	0f 34                	sysenter
+     fce:	c3                   	ret
+
+00000fcf <kill>:
+SYSCALL(kill)
+     fcf:	b8 06 00 00 00       	mov    $0x6,%eax
+     fd4:	89 e1                	mov    %esp,%ecx
+     fd6:	ba dd 0f 00 00       	mov    $0xfdd,%edx
+     fdb:	0f 34                	sysenter
+     fdd:	c3                   	ret
+
+00000fde <sysexec>:
+SYSCALLAS(sysexec, exec)
+     fde:	b8 07 00 00 00       	mov    $0x7,%eax
+     fe3:	89 e1                	mov    %esp,%ecx
+     fe5:	ba ec 0f 00 00       	mov    $0xfec,%edx
+     fea:	0f 34                	sysenter
+     fec:	c3                   	ret
+
+00000fed <open>:
+SYSCALL(open)
+     fed:	b8 0f 00 00 00       	mov    $0xf,%eax
+     ff2:	89 e1                	mov    %esp,%ecx
+     ff4:	ba fb 0f 00 00       	mov    $0xffb,%edx
+     ff9:	0f 34                	sysenter
+     ffb:	c3                   	ret
+
+00000ffc <mknod>:
+SYSCALL(mknod)
+     ffc:	b8 11 00 00 00       	mov    $0x11,%eax
+    1001:	89 e1                	mov    %esp,%ecx
+    1003:	ba 0a 10 00 00       	mov    $0x100a,%edx
+    1008:	0f 34                	sysenter
+    100a:	c3                   	ret
+
+0000100b <unlink>:
+SYSCALL(unlink)
+    100b:	b8 12 00 00 00       	mov    $0x12,%eax
+    1010:	89 e1                	mov    %esp,%ecx
+    1012:	ba 19 10 00 00       	mov    $0x1019,%edx
+    1017:	0f 34                	sysenter
+    1019:	c3                   	ret
+
+0000101a <fstat>:
+SYSCALL(fstat)
+    101a:	b8 08 00 00 00       	mov    $0x8,%eax
+    101f:	89 e1                	mov    %esp,%ecx
+    1021:	ba 28 10 00 00       	mov    $0x1028,%edx
+    1026:	0f 34                	sysenter
+    1028:	c3                   	ret
+
+00001029 <link>:
+SYSCALL(link)
+    1029:	b8 13 00 00 00       	mov    $0x13,%eax
+    102e:	89 e1                	mov    %esp,%ecx
+    1030:	ba 37 10 00 00       	mov    $0x1037,%edx
+    1035:	0f 34                	sysenter
+    1037:	c3                   	ret
+
+00001038 <mkdir>:
+SYSCALL(mkdir)
+    1038:	b8 14 00 00 00       	mov    $0x14,%eax
+    103d:	89 e1                	mov    %esp,%ecx
+    103f:	ba 46 10 00 00       	mov    $0x1046,%edx
+    1044:	0f 34                	sysenter
+    1046:	c3                   	ret
+
+00001047 <chdir>:
+SYSCALL(chdir)
+    1047:	b8 09 00 00 00       	mov    $0x9,%eax
+    104c:	89 e1                	mov    %esp,%ecx
+    104e:	ba 55 10 00 00       	mov    $0x1055,%edx
+    1053:	0f 34                	sysenter
+    1055:	c3                   	ret
+
+00001056 <dup>:
+SYSCALL(dup)
+    1056:	b8 0a 00 00 00       	mov    $0xa,%eax
+    105b:	89 e1                	mov    %esp,%ecx
+    105d:	ba 64 10 00 00       	mov    $0x1064,%edx
+    1062:	0f 34                	sysenter
+    1064:	c3                   	ret
+
+00001065 <getpid>:
+SYSCALL(getpid)
+    1065:	b8 0b 00 00 00       	mov    $0xb,%eax
+    106a:	89 e1                	mov    %esp,%ecx
+    106c:	ba 73 10 00 00       	mov    $0x1073,%edx
+    1071:	0f 34                	sysenter
+    1073:	c3                   	ret
+
+00001074 <sbrk>:
+SYSCALL(sbrk)
+    1074:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1079:	89 e1                	mov    %esp,%ecx
+    107b:	ba 82 10 00 00       	mov    $0x1082,%edx
+    1080:	0f 34                	sysenter
+    1082:	c3                   	ret
+
+00001083 <sleep>:
+SYSCALL(sleep)
+    1083:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1088:	89 e1                	mov    %esp,%ecx
+    108a:	ba 91 10 00 00       	mov    $0x1091,%edx
+    108f:	0f 34                	sysenter
+    1091:	c3                   	ret
+
+00001092 <clone>:
+SYSCALL(clone)
+    1092:	b8 16 00 00 00       	mov    $0x16,%eax
+    1097:	89 e1                	mov    %esp,%ecx
+    1099:	ba a0 10 00 00       	mov    $0x10a0,%edx
+    109e:	0f 34                	sysenter
+    10a0:	c3                   	ret
+
+000010a1 <join>:
+SYSCALL(join)
+    10a1:	b8 17 00 00 00       	mov    $0x17,%eax
+    10a6:	89 e1                	mov    %esp,%ecx
+    10a8:	ba af 10 00 00       	mov    $0x10af,%edx
+    10ad:	0f 34                	sysenter
+    10af:	c3                   	ret
+
+000010b0 <futex>:
+SYSCALL(futex)
+    10b0:	b8 18 00 00 00       	mov    $0x18,%eax
+    10b5:	89 e1                	mov    %esp,%ecx
+    10b7:	ba be 10 00 00       	mov    $0x10be,%edx
+    10bc:	0f 34                	sysenter
+    10be:	c3                   	ret
+
+000010bf <yield>:
+SYSCALL(yield)
+    10bf:	b8 19 00 00 00       	mov    $0x19,%eax
+    10c4:	89 e1                	mov    %esp,%ecx
+    10c6:	ba cd 10 00 00       	mov    $0x10cd,%edx
+    10cb:	0f 34                	sysenter
+    10cd:	c3                   	ret
+
+000010ce <lockstat>:
+SYSCALL(lockstat)
+    10ce:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    10d3:	89 e1                	mov    %esp,%ecx
+    10d5:	ba dc 10 00 00       	mov    $0x10dc,%edx
+    10da:	0f 34                	sysenter
+    10dc:	c3                   	ret
+
+000010dd <lockhammer>:
+SYSCALL(lockhammer)
+    10dd:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    10e2:	89 e1                	mov    %esp,%ecx
+    10e4:	ba eb 10 00 00       	mov    $0x10eb,%edx
+    10e9:	0f 34                	sysenter
+    10eb:	c3                   	ret
+
+000010ec <vmsplice>:
+SYSCALL(vmsplice)
+    10ec:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    10f1:	89 e1                	mov    %esp,%ecx
+    10f3:	ba fa 10 00 00       	mov    $0x10fa,%edx
+    10f8:	0f 34                	sysenter
+    10fa:	c3                   	ret
+
+000010fb <hsbrk>:
+SYSCALL(hsbrk)
+    10fb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1100:	89 e1                	mov    %esp,%ecx
+    1102:	ba 09 11 00 00       	mov    $0x1109,%edx
+    1107:	0f 34                	sysenter
+    1109:	c3                   	ret
+
+0000110a <mmap>:
+SYSCALL(mmap)
+    110a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    110f:	89 e1                	mov    %esp,%ecx
+    1111:	ba 18 11 00 00       	mov    $0x1118,%edx
+    1116:	0f 34                	sysenter
+    1118:	c3                   	ret
+
+00001119 <munmap>:
+SYSCALL(munmap)
+    1119:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    111e:	89 e1                	mov    %esp,%ecx
+    1120:	ba 27 11 00 00       	mov    $0x1127,%edx
+    1125:	0f 34                	sysenter
+    1127:	c3                   	ret
+
+00001128 <ringenter>:
+SYSCALL(ringenter)
+    1128:	b8 20 00 00 00       	mov    $0x20,%eax
+    112d:	89 e1                	mov    %esp,%ecx
+    112f:	ba 36 11 00 00       	mov    $0x1136,%edx
+    1134:	0f 34                	sysenter
+    1136:	c3                   	ret
+
+00001137 <readv>:
+SYSCALL(readv)
+    1137:	b8 21 00 00 00       	mov    $0x21,%eax
+    113c:	89 e1                	mov    %esp,%ecx
+    113e:	ba 45 11 00 00       	mov    $0x1145,%edx
+    1143:	0f 34                	sysenter
+    1145:	c3                   	ret
+
+00001146 <writev>:
+SYSCALL(writev)
+    1146:	b8 22 00 00 00       	mov    $0x22,%eax
+    114b:	89 e1                	mov    %esp,%ecx
+    114d:	ba 54 11 00 00       	mov    $0x1154,%edx
+    1152:	0f 34                	sysenter
+    1154:	c3                   	ret
+
+00001155 <pread>:
+SYSCALL(pread)
+    1155:	b8 23 00 00 00       	mov    $0x23,%eax
+    115a:	89 e1                	mov    %esp,%ecx
+    115c:	ba 63 11 00 00       	mov    $0x1163,%edx
+    1161:	0f 34                	sysenter
+    1163:	c3                   	ret
+
+00001164 <pwrite>:
+SYSCALL(pwrite)
+    1164:	b8 24 00 00 00       	mov    $0x24,%eax
+    1169:	89 e1                	mov    %esp,%ecx
+    116b:	ba 72 11 00 00       	mov    $0x1172,%edx
+    1170:	0f 34                	sysenter
+    1172:	c3                   	ret
+
+00001173 <prof>:
+SYSCALL(prof)
+    1173:	b8 25 00 00 00       	mov    $0x25,%eax
+    1178:	89 e1                	mov    %esp,%ecx
+    117a:	ba 81 11 00 00       	mov    $0x1181,%edx
+    117f:	0f 34                	sysenter
+    1181:	c3                   	ret
+
+00001182 <scstat>:
+SYSCALL(scstat)
+    1182:	b8 26 00 00 00       	mov    $0x26,%eax
+    1187:	89 e1                	mov    %esp,%ecx
+    1189:	ba 90 11 00 00       	mov    $0x1190,%edx
+    118e:	0f 34                	sysenter
+    1190:	c3                   	ret
+    1191:	66 90                	xchg   %ax,%ax
+    1193:	66 90                	xchg   %ax,%ax
+    1195:	66 90                	xchg   %ax,%ax
+    1197:	66 90                	xchg   %ax,%ax
+    1199:	66 90                	xchg   %ax,%ax
+    119b:	66 90                	xchg   %ax,%ax
+    119d:	66 90                	xchg   %ax,%ax
+    119f:	90                   	nop
+
+000011a0 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+    11a0:	55                   	push   %ebp
+    11a1:	89 e5                	mov    %esp,%ebp
+    11a3:	57                   	push   %edi
+    11a4:	56                   	push   %esi
+    11a5:	53                   	push   %ebx
+    11a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    11a8:	89 d1                	mov    %edx,%ecx
+{
+    11aa:	83 ec 2c             	sub    $0x2c,%esp
+    11ad:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+    11b0:	85 d2                	test   %edx,%edx
+    11b2:	79 7c                	jns    1230 <printint+0x90>
+    11b4:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    11b8:	74 76                	je     1230 <printint+0x90>
+    x = -xx;
+    11ba:	f7 d9                	neg    %ecx
+    neg = 1;
+    11bc:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    11c1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    11c4:	31 f6                	xor    %esi,%esi
+    11c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11cd:	8d 76 00             	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    11d0:	89 c8                	mov    %ecx,%eax
+    11d2:	31 d2                	xor    %edx,%edx
+    11d4:	89 f7                	mov    %esi,%edi
+    11d6:	f7 f3                	div    %ebx
+    11d8:	8d 76 01             	lea    0x1(%esi),%esi
+    11db:	0f b6 92 c0 29 00 00 	movzbl 0x29c0(%edx),%edx
+    11e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    11e6:	89 ca                	mov    %ecx,%edx
+    11e8:	89 c1                	mov    %eax,%ecx
+    11ea:	39 da                	cmp    %ebx,%edx
+    11ec:	73 e2                	jae    11d0 <printint+0x30>
+  if(neg)
+    11ee:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    11f1:	85 c0                	test   %eax,%eax
+    11f3:	74 07                	je     11fc <printint+0x5c>
+    buf[i++] = '-';
+    11f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    11fa:	89 f7                	mov    %esi,%edi
+    11fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    11ff:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    1202:	01 df                	add    %ebx,%edi
+    1204:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc_unlocked(buf[i], f);
+    1208:	83 ec 08             	sub    $0x8,%esp
+    120b:	56                   	push   %esi
+    120c:	0f be 07             	movsbl (%edi),%eax
+    120f:	50                   	push   %eax
+    1210:	e8 cb 07 00 00       	call   19e0 <putc_unlocked>
+  while(--i >= 0)
+    1215:	89 f8                	mov    %edi,%eax
+    1217:	83 c4 10             	add    $0x10,%esp
+    121a:	83 ef 01             	sub    $0x1,%edi
+    121d:	39 d8                	cmp    %ebx,%eax
+    121f:	75 e7                	jne    1208 <printint+0x68>
+}
+    1221:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1224:	5b                   	pop    %ebx
+    1225:	5e                   	pop    %esi
+    1226:	5f                   	pop    %edi
+    1227:	5d                   	pop    %ebp
+    1228:	c3                   	ret
+    1229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1230:	31 c0                	xor    %eax,%eax
+    1232:	eb 8d                	jmp    11c1 <printint+0x21>
+    1234:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    123b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    123f:	90                   	nop
+
+00001240 <vfprintf>:
+
+// Print to the given stream, which the caller has locked.
+// Only understands %d, %x, %p, %s.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+    1240:	55                   	push   %ebp
+    1241:	89 e5                	mov    %esp,%ebp
+    1243:	57                   	push   %edi
+    1244:	56                   	push   %esi
+    1245:	53                   	push   %ebx
+    1246:	83 ec 1c             	sub    $0x1c,%esp
+    1249:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+    124c:	0f b6 0a             	movzbl (%edx),%ecx
+    124f:	84 c9                	test   %cl,%cl
+    1251:	74 5c                	je     12af <vfprintf+0x6f>
+    1253:	89 c6                	mov    %eax,%esi
+    1255:	8d 5a 01             	lea    0x1(%edx),%ebx
+    1258:	31 ff                	xor    %edi,%edi
+    125a:	eb 20                	jmp    127c <vfprintf+0x3c>
+    125c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    1260:	83 f9 25             	cmp    $0x25,%ecx
+    1263:	74 3b                	je     12a0 <vfprintf+0x60>
+        state = '%';
+      } else {
+        putc_unlocked(c, f);
+    1265:	83 ec 08             	sub    $0x8,%esp
+    1268:	56                   	push   %esi
+    1269:	51                   	push   %ecx
+    126a:	e8 71 07 00 00       	call   19e0 <putc_unlocked>
+    126f:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    1272:	0f b6 0b             	movzbl (%ebx),%ecx
+    1275:	83 c3 01             	add    $0x1,%ebx
+    1278:	84 c9                	test   %cl,%cl
+    127a:	74 33                	je     12af <vfprintf+0x6f>
+    if(state == 0){
+    127c:	85 ff                	test   %edi,%edi
+    127e:	74 e0                	je     1260 <vfprintf+0x20>
+      }
+    } else if(state == '%'){
+    1280:	83 ff 25             	cmp    $0x25,%edi
+    1283:	75 ed                	jne    1272 <vfprintf+0x32>
+      if(c == 'd'){
+    1285:	83 f9 25             	cmp    $0x25,%ecx
+    1288:	0f 84 02 01 00 00    	je     1390 <vfprintf+0x150>
+    128e:	8d 41 9d             	lea    -0x63(%ecx),%eax
+    1291:	83 f8 15             	cmp    $0x15,%eax
+    1294:	77 2a                	ja     12c0 <vfprintf+0x80>
+    1296:	ff 24 85 68 29 00 00 	jmp    *0x2968(,%eax,4)
+    129d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+    12a0:	0f b6 0b             	movzbl (%ebx),%ecx
+    12a3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+    12a6:	bf 25 00 00 00       	mov    $0x25,%edi
+  for(i = 0; fmt[i]; i++){
+    12ab:	84 c9                	test   %cl,%cl
+    12ad:	75 cd                	jne    127c <vfprintf+0x3c>
+        putc_unlocked(c, f);
+      }
+      state = 0;
+    }
+  }
+}
+    12af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12b2:	5b                   	pop    %ebx
+    12b3:	5e                   	pop    %esi
+    12b4:	5f                   	pop    %edi
+    12b5:	5d                   	pop    %ebp
+    12b6:	c3                   	ret
+    12b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12be:	66 90                	xchg   %ax,%ax
+        putc_unlocked('%', f);
+    12c0:	83 ec 08             	sub    $0x8,%esp
+    12c3:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    12c6:	56                   	push   %esi
+    12c7:	6a 25                	push   $0x25
+    12c9:	e8 12 07 00 00       	call   19e0 <putc_unlocked>
+        putc_unlocked(c, f);
+    12ce:	58                   	pop    %eax
+    12cf:	5a                   	pop    %edx
+    12d0:	56                   	push   %esi
+    12d1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    12d4:	51                   	push   %ecx
+    12d5:	e8 06 07 00 00       	call   19e0 <putc_unlocked>
+    12da:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    12dd:	31 ff                	xor    %edi,%edi
+    12df:	eb 91                	jmp    1272 <vfprintf+0x32>
+    12e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+    12e8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    12eb:	83 ec 0c             	sub    $0xc,%esp
+    12ee:	b9 10 00 00 00       	mov    $0x10,%ecx
+    12f3:	8b 17                	mov    (%edi),%edx
+    12f5:	6a 00                	push   $0x0
+        ap++;
+    12f7:	83 c7 04             	add    $0x4,%edi
+        printint(f, *ap, 16, 0);
+    12fa:	89 f0                	mov    %esi,%eax
+    12fc:	e8 9f fe ff ff       	call   11a0 <printint>
+        ap++;
+    1301:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    1304:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1307:	31 ff                	xor    %edi,%edi
+    1309:	e9 64 ff ff ff       	jmp    1272 <vfprintf+0x32>
+    130e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+    1310:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1313:	8b 10                	mov    (%eax),%edx
+        ap++;
+    1315:	83 c0 04             	add    $0x4,%eax
+    1318:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    131b:	85 d2                	test   %edx,%edx
+    131d:	0f 84 85 00 00 00    	je     13a8 <vfprintf+0x168>
+        while(*s != 0){
+    1323:	0f be 02             	movsbl (%edx),%eax
+        s = (char*)*ap;
+    1326:	89 d7                	mov    %edx,%edi
+        while(*s != 0){
+    1328:	84 c0                	test   %al,%al
+    132a:	74 b1                	je     12dd <vfprintf+0x9d>
+    132c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+          putc_unlocked(*s, f);
+    1330:	83 ec 08             	sub    $0x8,%esp
+          s++;
+    1333:	83 c7 01             	add    $0x1,%edi
+          putc_unlocked(*s, f);
+    1336:	56                   	push   %esi
+    1337:	50                   	push   %eax
+    1338:	e8 a3 06 00 00       	call   19e0 <putc_unlocked>
+        while(*s != 0){
+    133d:	0f be 07             	movsbl (%edi),%eax
+    1340:	83 c4 10             	add    $0x10,%esp
+    1343:	84 c0                	test   %al,%al
+    1345:	75 e9                	jne    1330 <vfprintf+0xf0>
+      state = 0;
+    1347:	31 ff                	xor    %edi,%edi
+    1349:	e9 24 ff ff ff       	jmp    1272 <vfprintf+0x32>
+    134e:	66 90                	xchg   %ax,%ax
+        printint(f, *ap, 10, 1);
+    1350:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    1353:	83 ec 0c             	sub    $0xc,%esp
+    1356:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    135b:	8b 17                	mov    (%edi),%edx
+    135d:	6a 01                	push   $0x1
+    135f:	eb 96                	jmp    12f7 <vfprintf+0xb7>
+    1361:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc_unlocked(*ap, f);
+    1368:	83 ec 08             	sub    $0x8,%esp
+    136b:	56                   	push   %esi
+    136c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    136f:	ff 37                	push   (%edi)
+    1371:	e8 6a 06 00 00       	call   19e0 <putc_unlocked>
+        ap++;
+    1376:	89 f8                	mov    %edi,%eax
+    1378:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    137b:	31 ff                	xor    %edi,%edi
+        ap++;
+    137d:	83 c0 04             	add    $0x4,%eax
+    1380:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1383:	e9 ea fe ff ff       	jmp    1272 <vfprintf+0x32>
+    1388:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    138f:	90                   	nop
+        putc_unlocked(c, f);
+    1390:	83 ec 08             	sub    $0x8,%esp
+      state = 0;
+    1393:	31 ff                	xor    %edi,%edi
+        putc_unlocked(c, f);
+    1395:	56                   	push   %esi
+    1396:	6a 25                	push   $0x25
+    1398:	e8 43 06 00 00       	call   19e0 <putc_unlocked>
+    139d:	83 c4 10             	add    $0x10,%esp
+    13a0:	e9 cd fe ff ff       	jmp    1272 <vfprintf+0x32>
+    13a5:	8d 76 00             	lea    0x0(%esi),%esi
+    13a8:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    13ad:	bf 60 29 00 00       	mov    $0x2960,%edi
+    13b2:	e9 79 ff ff ff       	jmp    1330 <vfprintf+0xf0>
+    13b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13be:	66 90                	xchg   %ax,%ax
+
+000013c0 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+    13c0:	55                   	push   %ebp
+    13c1:	89 e5                	mov    %esp,%ebp
+    13c3:	53                   	push   %ebx
+    13c4:	83 ec 10             	sub    $0x10,%esp
+    13c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  flockfile(f);
+    13ca:	53                   	push   %ebx
+    13cb:	e8 d0 02 00 00       	call   16a0 <flockfile>
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+    13d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+    13d3:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    13d6:	89 d8                	mov    %ebx,%eax
+    13d8:	e8 63 fe ff ff       	call   1240 <vfprintf>
+  funlockfile(f);
+    13dd:	89 1c 24             	mov    %ebx,(%esp)
+    13e0:	e8 eb 02 00 00       	call   16d0 <funlockfile>
+}
+    13e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    13e8:	83 c4 10             	add    $0x10,%esp
+    13eb:	c9                   	leave
+    13ec:	c3                   	ret
+    13ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000013f0 <printf>:
+
+// Print to the given fd: through stdout or stderr for 1 and 2,
+// otherwise with one write() per call.
+void
+printf(int fd, const char *fmt, ...)
+{
+    13f0:	55                   	push   %ebp
+    13f1:	89 e5                	mov    %esp,%ebp
+    13f3:	56                   	push   %esi
+    13f4:	53                   	push   %ebx
+    13f5:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+    13fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  char buf[128];
+  struct iobuf f;
+
+  if(fd == 1 || fd == 2){
+    flockfile(&_iob[fd]);
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+    13fe:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(fd == 1 || fd == 2){
+    1401:	8d 50 ff             	lea    -0x1(%eax),%edx
+    1404:	83 fa 01             	cmp    $0x1,%edx
+    1407:	76 77                	jbe    1480 <printf+0x90>
+    funlockfile(&_iob[fd]);
+    return;
+  }
+  f.fd = fd;
+    1409:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  f.flags = IO_WRITE|IO_SETUP;
+  f.buf = buf;
+    140f:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  f.size = sizeof(buf);
+  f.r = f.n = 0;
+  mutex_init(&f.lock);
+    1415:	83 ec 0c             	sub    $0xc,%esp
+    1418:	8d 9d 5c ff ff ff    	lea    -0xa4(%ebp),%ebx
+  f.buf = buf;
+    141e:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+  mutex_init(&f.lock);
+    1424:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  f.flags = IO_WRITE|IO_SETUP;
+    142a:	c7 85 60 ff ff ff 42 	movl   $0x42,-0xa0(%ebp)
+    1431:	00 00 00 
+  f.size = sizeof(buf);
+    1434:	c7 85 68 ff ff ff 80 	movl   $0x80,-0x98(%ebp)
+    143b:	00 00 00 
+  f.r = f.n = 0;
+    143e:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+    1445:	00 00 00 
+    1448:	c7 85 6c ff ff ff 00 	movl   $0x0,-0x94(%ebp)
+    144f:	00 00 00 
+  mutex_init(&f.lock);
+    1452:	50                   	push   %eax
+    1453:	e8 d8 f9 ff ff       	call   e30 <mutex_init>
+  vfprintf(&f, fmt, (uint*)(void*)&fmt + 1);
+    1458:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    145b:	89 f2                	mov    %esi,%edx
+    145d:	89 d8                	mov    %ebx,%eax
+    145f:	e8 dc fd ff ff       	call   1240 <vfprintf>
+  fflush(&f);
+    1464:	89 1c 24             	mov    %ebx,(%esp)
+    1467:	e8 f4 04 00 00       	call   1960 <fflush>
+    146c:	83 c4 10             	add    $0x10,%esp
+}
+    146f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1472:	5b                   	pop    %ebx
+    1473:	5e                   	pop    %esi
+    1474:	5d                   	pop    %ebp
+    1475:	c3                   	ret
+    1476:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    147d:	8d 76 00             	lea    0x0(%esi),%esi
+    flockfile(&_iob[fd]);
+    1480:	6b c0 1c             	imul   $0x1c,%eax,%eax
+    1483:	83 ec 0c             	sub    $0xc,%esp
+    1486:	8d 98 60 36 00 00    	lea    0x3660(%eax),%ebx
+    148c:	53                   	push   %ebx
+    148d:	e8 0e 02 00 00       	call   16a0 <flockfile>
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+    1492:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    1495:	89 f2                	mov    %esi,%edx
+    1497:	89 d8                	mov    %ebx,%eax
+    1499:	e8 a2 fd ff ff       	call   1240 <vfprintf>
+    funlockfile(&_iob[fd]);
+    149e:	89 1c 24             	mov    %ebx,(%esp)
+    14a1:	e8 2a 02 00 00       	call   16d0 <funlockfile>
+    14a6:	83 c4 10             	add    $0x10,%esp
+}
+    14a9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    14ac:	5b                   	pop    %ebx
+    14ad:	5e                   	pop    %esi
+    14ae:	5d                   	pop    %ebp
+    14af:	c3                   	ret
+
+000014b0 <setup>:
+}
+
+// Choose how to buffer f on first use: by lines on a device.
+static void
+setup(FILE *f)
+{
+    14b0:	55                   	push   %ebp
+    14b1:	89 e5                	mov    %esp,%ebp
+    14b3:	53                   	push   %ebx
+    14b4:	89 c3                	mov    %eax,%ebx
+    14b6:	83 ec 2c             	sub    $0x2c,%esp
+  struct stat st;
+
+  f->flags |= IO_SETUP;
+    14b9:	83 48 04 40          	orl    $0x40,0x4(%eax)
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+    14bd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    14c0:	50                   	push   %eax
+    14c1:	ff 33                	push   (%ebx)
+    14c3:	e8 52 fb ff ff       	call   101a <fstat>
+    14c8:	83 c4 10             	add    $0x10,%esp
+    14cb:	85 c0                	test   %eax,%eax
+    f->flags |= IO_DEV|IO_LINE;
+    14cd:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+    14d0:	75 07                	jne    14d9 <setup+0x29>
+    14d2:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+    14d7:	74 17                	je     14f0 <setup+0x40>
+  if(f->flags & IO_WRITE)
+    14d9:	a8 02                	test   $0x2,%al
+    14db:	74 0a                	je     14e7 <setup+0x37>
+    flushhook = flushall;
+    14dd:	c7 05 a4 37 00 00 10 	movl   $0x1610,0x37a4
+    14e4:	16 00 00 
+}
+    14e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    14ea:	c9                   	leave
+    14eb:	c3                   	ret
+    14ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    f->flags |= IO_DEV|IO_LINE;
+    14f0:	83 c8 30             	or     $0x30,%eax
+    14f3:	89 43 04             	mov    %eax,0x4(%ebx)
+    14f6:	eb e1                	jmp    14d9 <setup+0x29>
+    14f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14ff:	90                   	nop
+
+00001500 <flush>:
+static int
+flush(FILE *f)
+{
+  int i, n;
+
+  if(!(f->flags & IO_WRITE))
+    1500:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+    1504:	74 6a                	je     1570 <flush+0x70>
+{
+    1506:	55                   	push   %ebp
+    1507:	89 e5                	mov    %esp,%ebp
+    1509:	56                   	push   %esi
+    150a:	89 c6                	mov    %eax,%esi
+    150c:	53                   	push   %ebx
+    return 0;
+  for(i = 0; i < f->n; i += n){
+    150d:	8b 40 14             	mov    0x14(%eax),%eax
+    1510:	85 c0                	test   %eax,%eax
+    1512:	7e 4c                	jle    1560 <flush+0x60>
+    1514:	31 db                	xor    %ebx,%ebx
+    1516:	eb 11                	jmp    1529 <flush+0x29>
+    1518:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    151f:	90                   	nop
+    1520:	01 c3                	add    %eax,%ebx
+    1522:	8b 46 14             	mov    0x14(%esi),%eax
+    1525:	39 d8                	cmp    %ebx,%eax
+    1527:	7e 37                	jle    1560 <flush+0x60>
+    if((n = write(f->fd, f->buf + i, f->n - i)) <= 0){
+    1529:	83 ec 04             	sub    $0x4,%esp
+    152c:	29 d8                	sub    %ebx,%eax
+    152e:	50                   	push   %eax
+    152f:	8b 46 08             	mov    0x8(%esi),%eax
+    1532:	01 d8                	add    %ebx,%eax
+    1534:	50                   	push   %eax
+    1535:	ff 36                	push   (%esi)
+    1537:	e8 75 fa ff ff       	call   fb1 <write>
+    153c:	83 c4 10             	add    $0x10,%esp
+    153f:	85 c0                	test   %eax,%eax
+    1541:	7f dd                	jg     1520 <flush+0x20>
+      f->flags |= IO_ERR;
+    1543:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+      f->n = 0;
+    1547:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    154c:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+      return EOF;
+    }
+  }
+  f->n = 0;
+  return 0;
+}
+    1553:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1556:	5b                   	pop    %ebx
+    1557:	5e                   	pop    %esi
+    1558:	5d                   	pop    %ebp
+    1559:	c3                   	ret
+    155a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->n = 0;
+    1560:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+}
+    1567:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+    156a:	31 c0                	xor    %eax,%eax
+}
+    156c:	5b                   	pop    %ebx
+    156d:	5e                   	pop    %esi
+    156e:	5d                   	pop    %ebp
+    156f:	c3                   	ret
+    return 0;
+    1570:	31 c0                	xor    %eax,%eax
+}
+    1572:	c3                   	ret
+    1573:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    157a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001580 <fflush.part.0>:
+fflush(FILE *f)
+    1580:	55                   	push   %ebp
+    1581:	89 e5                	mov    %esp,%ebp
+    1583:	57                   	push   %edi
+    1584:	bf 58 37 00 00       	mov    $0x3758,%edi
+    1589:	56                   	push   %esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+    158a:	31 f6                	xor    %esi,%esi
+fflush(FILE *f)
+    158c:	53                   	push   %ebx
+    158d:	bb 78 36 00 00       	mov    $0x3678,%ebx
+    1592:	83 ec 1c             	sub    $0x1c,%esp
+    1595:	eb 10                	jmp    15a7 <fflush.part.0+0x27>
+    1597:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    159e:	66 90                	xchg   %ax,%ax
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+    15a0:	83 c3 1c             	add    $0x1c,%ebx
+    15a3:	39 df                	cmp    %ebx,%edi
+    15a5:	74 33                	je     15da <fflush.part.0+0x5a>
+      if((f->flags & IO_WRITE) && fflush(f) < 0)
+    15a7:	f6 43 ec 02          	testb  $0x2,-0x14(%ebx)
+    15ab:	74 f3                	je     15a0 <fflush.part.0+0x20>
+  if(threaded)
+    15ad:	8b 0d c0 37 00 00    	mov    0x37c0,%ecx
+    15b3:	85 c9                	test   %ecx,%ecx
+    15b5:	75 49                	jne    1600 <fflush.part.0+0x80>
+  r = flush(f);
+    15b7:	8d 43 e8             	lea    -0x18(%ebx),%eax
+    15ba:	e8 41 ff ff ff       	call   1500 <flush>
+  if(threaded)
+    15bf:	8b 15 c0 37 00 00    	mov    0x37c0,%edx
+    15c5:	85 d2                	test   %edx,%edx
+    15c7:	75 1f                	jne    15e8 <fflush.part.0+0x68>
+        r = EOF;
+    15c9:	85 c0                	test   %eax,%eax
+    15cb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    15d0:	0f 48 f0             	cmovs  %eax,%esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+    15d3:	83 c3 1c             	add    $0x1c,%ebx
+    15d6:	39 df                	cmp    %ebx,%edi
+    15d8:	75 cd                	jne    15a7 <fflush.part.0+0x27>
+}
+    15da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15dd:	89 f0                	mov    %esi,%eax
+    15df:	5b                   	pop    %ebx
+    15e0:	5e                   	pop    %esi
+    15e1:	5f                   	pop    %edi
+    15e2:	5d                   	pop    %ebp
+    15e3:	c3                   	ret
+    15e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    15e8:	83 ec 0c             	sub    $0xc,%esp
+    15eb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    15ee:	53                   	push   %ebx
+    15ef:	e8 9c f8 ff ff       	call   e90 <mutex_unlock>
+    15f4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    15f7:	83 c4 10             	add    $0x10,%esp
+    15fa:	eb cd                	jmp    15c9 <fflush.part.0+0x49>
+    15fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    1600:	83 ec 0c             	sub    $0xc,%esp
+    1603:	53                   	push   %ebx
+    1604:	e8 37 f8 ff ff       	call   e40 <mutex_lock>
+    1609:	83 c4 10             	add    $0x10,%esp
+    160c:	eb a9                	jmp    15b7 <fflush.part.0+0x37>
+    160e:	66 90                	xchg   %ax,%ax
+
+00001610 <flushall>:
+  if(f == 0){
+    1610:	e9 6b ff ff ff       	jmp    1580 <fflush.part.0>
+    1615:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    161c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001620 <fill>:
+
+// Refill f's buffer. Returns the number of bytes read.
+// Caller holds f's lock.
+static int
+fill(FILE *f)
+{
+    1620:	55                   	push   %ebp
+    1621:	89 e5                	mov    %esp,%ebp
+    1623:	53                   	push   %ebx
+    1624:	89 c3                	mov    %eax,%ebx
+    1626:	83 ec 04             	sub    $0x4,%esp
+  int n;
+
+  if(!(f->flags & IO_SETUP))
+    1629:	8b 40 04             	mov    0x4(%eax),%eax
+    162c:	a8 40                	test   $0x40,%al
+    162e:	74 50                	je     1680 <fill+0x60>
+    setup(f);
+  if(f->flags & IO_DEV)
+    1630:	a8 20                	test   $0x20,%al
+    1632:	75 3c                	jne    1670 <fill+0x50>
+    fflush(0);
+  f->r = 0;
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+    1634:	83 ec 04             	sub    $0x4,%esp
+  f->r = 0;
+    1637:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+    163e:	ff 73 0c             	push   0xc(%ebx)
+    1641:	ff 73 08             	push   0x8(%ebx)
+    1644:	ff 33                	push   (%ebx)
+    1646:	e8 57 f9 ff ff       	call   fa2 <read>
+    164b:	83 c4 10             	add    $0x10,%esp
+    164e:	85 c0                	test   %eax,%eax
+    1650:	7f 10                	jg     1662 <fill+0x42>
+    f->flags |= n < 0 ? IO_ERR : IO_EOF;
+    1652:	83 f8 01             	cmp    $0x1,%eax
+    1655:	19 c0                	sbb    %eax,%eax
+    1657:	83 e0 fc             	and    $0xfffffffc,%eax
+    165a:	83 c0 08             	add    $0x8,%eax
+    165d:	09 43 04             	or     %eax,0x4(%ebx)
+    n = 0;
+    1660:	31 c0                	xor    %eax,%eax
+  }
+  f->n = n;
+    1662:	89 43 14             	mov    %eax,0x14(%ebx)
+  return n;
+}
+    1665:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1668:	c9                   	leave
+    1669:	c3                   	ret
+    166a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == 0){
+    1670:	e8 0b ff ff ff       	call   1580 <fflush.part.0>
+    1675:	eb bd                	jmp    1634 <fill+0x14>
+    1677:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    167e:	66 90                	xchg   %ax,%ax
+    setup(f);
+    1680:	89 d8                	mov    %ebx,%eax
+    1682:	e8 29 fe ff ff       	call   14b0 <setup>
+  if(f->flags & IO_DEV)
+    1687:	8b 43 04             	mov    0x4(%ebx),%eax
+    168a:	eb a4                	jmp    1630 <fill+0x10>
+    168c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001690 <stdio_threaded>:
+  threaded = 1;
+    1690:	c7 05 c0 37 00 00 01 	movl   $0x1,0x37c0
+    1697:	00 00 00 
+}
+    169a:	c3                   	ret
+    169b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    169f:	90                   	nop
+
+000016a0 <flockfile>:
+{
+    16a0:	55                   	push   %ebp
+  if(threaded)
+    16a1:	8b 15 c0 37 00 00    	mov    0x37c0,%edx
+{
+    16a7:	89 e5                	mov    %esp,%ebp
+    16a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+    16ac:	85 d2                	test   %edx,%edx
+    16ae:	75 08                	jne    16b8 <flockfile+0x18>
+}
+    16b0:	5d                   	pop    %ebp
+    16b1:	c3                   	ret
+    16b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_lock(&f->lock);
+    16b8:	83 c0 18             	add    $0x18,%eax
+    16bb:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+    16be:	5d                   	pop    %ebp
+    mutex_lock(&f->lock);
+    16bf:	e9 7c f7 ff ff       	jmp    e40 <mutex_lock>
+    16c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    16cf:	90                   	nop
+
+000016d0 <funlockfile>:
+{
+    16d0:	55                   	push   %ebp
+  if(threaded)
+    16d1:	8b 15 c0 37 00 00    	mov    0x37c0,%edx
+{
+    16d7:	89 e5                	mov    %esp,%ebp
+    16d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+    16dc:	85 d2                	test   %edx,%edx
+    16de:	75 08                	jne    16e8 <funlockfile+0x18>
+}
+    16e0:	5d                   	pop    %ebp
+    16e1:	c3                   	ret
+    16e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&f->lock);
+    16e8:	83 c0 18             	add    $0x18,%eax
+    16eb:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+    16ee:	5d                   	pop    %ebp
+    mutex_unlock(&f->lock);
+    16ef:	e9 9c f7 ff ff       	jmp    e90 <mutex_unlock>
+    16f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    16ff:	90                   	nop
+
+00001700 <fopen>:
+{
+    1700:	55                   	push   %ebp
+    1701:	89 e5                	mov    %esp,%ebp
+    1703:	57                   	push   %edi
+    1704:	56                   	push   %esi
+    1705:	53                   	push   %ebx
+    1706:	83 ec 34             	sub    $0x34,%esp
+    1709:	8b 75 0c             	mov    0xc(%ebp),%esi
+    170c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(strcmp(mode, "r") != 0 && strcmp(mode, "w") != 0)
+    170f:	68 d1 29 00 00       	push   $0x29d1
+    1714:	56                   	push   %esi
+    1715:	e8 66 f5 ff ff       	call   c80 <strcmp>
+    171a:	83 c4 10             	add    $0x10,%esp
+    171d:	85 c0                	test   %eax,%eax
+    171f:	74 15                	je     1736 <fopen+0x36>
+    1721:	83 ec 08             	sub    $0x8,%esp
+    1724:	68 d3 29 00 00       	push   $0x29d3
+    1729:	56                   	push   %esi
+    172a:	e8 51 f5 ff ff       	call   c80 <strcmp>
+    172f:	83 c4 10             	add    $0x10,%esp
+    1732:	85 c0                	test   %eax,%eax
+    1734:	75 2c                	jne    1762 <fopen+0x62>
+  if(threaded)
+    1736:	a1 c0 37 00 00       	mov    0x37c0,%eax
+    173b:	85 c0                	test   %eax,%eax
+    173d:	0f 85 ed 00 00 00    	jne    1830 <fopen+0x130>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+    1743:	bb b4 36 00 00       	mov    $0x36b4,%ebx
+    if(f->flags == 0)
+    1748:	8b 53 04             	mov    0x4(%ebx),%edx
+    174b:	85 d2                	test   %edx,%edx
+    174d:	74 21                	je     1770 <fopen+0x70>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+    174f:	83 c3 1c             	add    $0x1c,%ebx
+    1752:	81 fb 40 37 00 00    	cmp    $0x3740,%ebx
+    1758:	75 ee                	jne    1748 <fopen+0x48>
+  if(threaded)
+    175a:	85 c0                	test   %eax,%eax
+    175c:	0f 85 36 01 00 00    	jne    1898 <fopen+0x198>
+    return 0;
+    1762:	31 db                	xor    %ebx,%ebx
+    1764:	e9 96 00 00 00       	jmp    17ff <fopen+0xff>
+    1769:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f == &_iob[NSTREAM])
+    1770:	81 fb 40 37 00 00    	cmp    $0x3740,%ebx
+    1776:	74 e2                	je     175a <fopen+0x5a>
+    f->flags = IO_MALLOC;
+    1778:	c7 43 04 80 00 00 00 	movl   $0x80,0x4(%ebx)
+  if(threaded)
+    177f:	85 c0                	test   %eax,%eax
+    1781:	0f 85 f9 00 00 00    	jne    1880 <fopen+0x180>
+  if(mode[0] == 'r'){
+    1787:	80 3e 72             	cmpb   $0x72,(%esi)
+    178a:	0f 84 c0 00 00 00    	je     1850 <fopen+0x150>
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+    1790:	83 ec 08             	sub    $0x8,%esp
+    1793:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+    1796:	50                   	push   %eax
+    1797:	57                   	push   %edi
+    1798:	e8 d3 f5 ff ff       	call   d70 <stat>
+    179d:	83 c4 10             	add    $0x10,%esp
+    17a0:	85 c0                	test   %eax,%eax
+    17a2:	74 6c                	je     1810 <fopen+0x110>
+    fd = open(path, O_CREATE|O_WRONLY);
+    17a4:	83 ec 08             	sub    $0x8,%esp
+    17a7:	68 01 02 00 00       	push   $0x201
+    17ac:	57                   	push   %edi
+    flags = IO_WRITE;
+    17ad:	bf 02 00 00 00       	mov    $0x2,%edi
+    fd = open(path, O_CREATE|O_WRONLY);
+    17b2:	e8 36 f8 ff ff       	call   fed <open>
+    17b7:	83 c4 10             	add    $0x10,%esp
+    17ba:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+    17bc:	85 f6                	test   %esi,%esi
+    17be:	0f 88 a9 00 00 00    	js     186d <fopen+0x16d>
+    17c4:	83 ec 0c             	sub    $0xc,%esp
+    17c7:	68 00 02 00 00       	push   $0x200
+    17cc:	e8 af 0c 00 00       	call   2480 <malloc>
+    17d1:	83 c4 10             	add    $0x10,%esp
+    17d4:	89 43 08             	mov    %eax,0x8(%ebx)
+    17d7:	85 c0                	test   %eax,%eax
+    17d9:	0f 84 d0 00 00 00    	je     18af <fopen+0x1af>
+  f->flags = flags|IO_MALLOC;
+    17df:	81 cf 80 00 00 00    	or     $0x80,%edi
+  f->fd = fd;
+    17e5:	89 33                	mov    %esi,(%ebx)
+  f->size = BUFSIZ;
+    17e7:	c7 43 0c 00 02 00 00 	movl   $0x200,0xc(%ebx)
+  f->r = f->n = 0;
+    17ee:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+    17f5:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  f->flags = flags|IO_MALLOC;
+    17fc:	89 7b 04             	mov    %edi,0x4(%ebx)
+}
+    17ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1802:	89 d8                	mov    %ebx,%eax
+    1804:	5b                   	pop    %ebx
+    1805:	5e                   	pop    %esi
+    1806:	5f                   	pop    %edi
+    1807:	5d                   	pop    %ebp
+    1808:	c3                   	ret
+    1809:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+    1810:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+    1815:	75 8d                	jne    17a4 <fopen+0xa4>
+      unlink(path);
+    1817:	83 ec 0c             	sub    $0xc,%esp
+    181a:	57                   	push   %edi
+    181b:	e8 eb f7 ff ff       	call   100b <unlink>
+    1820:	83 c4 10             	add    $0x10,%esp
+    1823:	e9 7c ff ff ff       	jmp    17a4 <fopen+0xa4>
+    1828:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    182f:	90                   	nop
+    mutex_lock(&iolock);
+    1830:	83 ec 0c             	sub    $0xc,%esp
+    1833:	68 c4 37 00 00       	push   $0x37c4
+    1838:	e8 03 f6 ff ff       	call   e40 <mutex_lock>
+  if(threaded)
+    183d:	a1 c0 37 00 00       	mov    0x37c0,%eax
+    1842:	83 c4 10             	add    $0x10,%esp
+    1845:	e9 f9 fe ff ff       	jmp    1743 <fopen+0x43>
+    184a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    fd = open(path, O_RDONLY);
+    1850:	83 ec 08             	sub    $0x8,%esp
+    1853:	6a 00                	push   $0x0
+    1855:	57                   	push   %edi
+    flags = IO_READ;
+    1856:	bf 01 00 00 00       	mov    $0x1,%edi
+    fd = open(path, O_RDONLY);
+    185b:	e8 8d f7 ff ff       	call   fed <open>
+    1860:	83 c4 10             	add    $0x10,%esp
+    1863:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+    1865:	85 f6                	test   %esi,%esi
+    1867:	0f 89 57 ff ff ff    	jns    17c4 <fopen+0xc4>
+    f->flags = 0;
+    186d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    return 0;
+    1874:	31 db                	xor    %ebx,%ebx
+    1876:	eb 87                	jmp    17ff <fopen+0xff>
+    1878:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    187f:	90                   	nop
+    mutex_unlock(&iolock);
+    1880:	83 ec 0c             	sub    $0xc,%esp
+    1883:	68 c4 37 00 00       	push   $0x37c4
+    1888:	e8 03 f6 ff ff       	call   e90 <mutex_unlock>
+    188d:	83 c4 10             	add    $0x10,%esp
+    1890:	e9 f2 fe ff ff       	jmp    1787 <fopen+0x87>
+    1895:	8d 76 00             	lea    0x0(%esi),%esi
+    1898:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+    189b:	31 db                	xor    %ebx,%ebx
+    mutex_unlock(&iolock);
+    189d:	68 c4 37 00 00       	push   $0x37c4
+    18a2:	e8 e9 f5 ff ff       	call   e90 <mutex_unlock>
+    18a7:	83 c4 10             	add    $0x10,%esp
+    18aa:	e9 50 ff ff ff       	jmp    17ff <fopen+0xff>
+      close(fd);
+    18af:	83 ec 0c             	sub    $0xc,%esp
+    18b2:	56                   	push   %esi
+    18b3:	e8 08 f7 ff ff       	call   fc0 <close>
+    18b8:	83 c4 10             	add    $0x10,%esp
+    18bb:	eb b0                	jmp    186d <fopen+0x16d>
+    18bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000018c0 <fclose>:
+{
+    18c0:	55                   	push   %ebp
+    18c1:	89 e5                	mov    %esp,%ebp
+    18c3:	56                   	push   %esi
+    18c4:	53                   	push   %ebx
+  if(threaded)
+    18c5:	8b 15 c0 37 00 00    	mov    0x37c0,%edx
+{
+    18cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    18ce:	85 d2                	test   %edx,%edx
+    18d0:	75 46                	jne    1918 <fclose+0x58>
+  r = flush(f);
+    18d2:	89 d8                	mov    %ebx,%eax
+    18d4:	e8 27 fc ff ff       	call   1500 <flush>
+  if(close(f->fd) < 0)
+    18d9:	83 ec 0c             	sub    $0xc,%esp
+    18dc:	ff 33                	push   (%ebx)
+  r = flush(f);
+    18de:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    18e0:	e8 db f6 ff ff       	call   fc0 <close>
+    18e5:	83 c4 10             	add    $0x10,%esp
+    r = EOF;
+    18e8:	85 c0                	test   %eax,%eax
+    18ea:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    18ef:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->flags & IO_MALLOC)
+    18f2:	f6 43 04 80          	testb  $0x80,0x4(%ebx)
+    18f6:	75 58                	jne    1950 <fclose+0x90>
+  if(threaded)
+    18f8:	a1 c0 37 00 00       	mov    0x37c0,%eax
+  f->flags = 0;
+    18fd:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  if(threaded)
+    1904:	85 c0                	test   %eax,%eax
+    1906:	75 28                	jne    1930 <fclose+0x70>
+}
+    1908:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    190b:	89 f0                	mov    %esi,%eax
+    190d:	5b                   	pop    %ebx
+    190e:	5e                   	pop    %esi
+    190f:	5d                   	pop    %ebp
+    1910:	c3                   	ret
+    1911:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    1918:	83 ec 0c             	sub    $0xc,%esp
+    191b:	8d 43 18             	lea    0x18(%ebx),%eax
+    191e:	50                   	push   %eax
+    191f:	e8 1c f5 ff ff       	call   e40 <mutex_lock>
+    1924:	83 c4 10             	add    $0x10,%esp
+    1927:	eb a9                	jmp    18d2 <fclose+0x12>
+    1929:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1930:	83 ec 0c             	sub    $0xc,%esp
+    1933:	83 c3 18             	add    $0x18,%ebx
+    1936:	53                   	push   %ebx
+    1937:	e8 54 f5 ff ff       	call   e90 <mutex_unlock>
+    193c:	83 c4 10             	add    $0x10,%esp
+}
+    193f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1942:	89 f0                	mov    %esi,%eax
+    1944:	5b                   	pop    %ebx
+    1945:	5e                   	pop    %esi
+    1946:	5d                   	pop    %ebp
+    1947:	c3                   	ret
+    1948:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    194f:	90                   	nop
+    free(f->buf);
+    1950:	83 ec 0c             	sub    $0xc,%esp
+    1953:	ff 73 08             	push   0x8(%ebx)
+    1956:	e8 f5 09 00 00       	call   2350 <free>
+    195b:	83 c4 10             	add    $0x10,%esp
+    195e:	eb 98                	jmp    18f8 <fclose+0x38>
+
+00001960 <fflush>:
+{
+    1960:	55                   	push   %ebp
+    1961:	89 e5                	mov    %esp,%ebp
+    1963:	53                   	push   %ebx
+    1964:	83 ec 14             	sub    $0x14,%esp
+    1967:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f == 0){
+    196a:	85 db                	test   %ebx,%ebx
+    196c:	74 5a                	je     19c8 <fflush+0x68>
+  if(threaded)
+    196e:	8b 0d c0 37 00 00    	mov    0x37c0,%ecx
+    1974:	85 c9                	test   %ecx,%ecx
+    1976:	75 18                	jne    1990 <fflush+0x30>
+  r = flush(f);
+    1978:	89 d8                	mov    %ebx,%eax
+    197a:	e8 81 fb ff ff       	call   1500 <flush>
+  if(threaded)
+    197f:	8b 15 c0 37 00 00    	mov    0x37c0,%edx
+    1985:	85 d2                	test   %edx,%edx
+    1987:	75 1f                	jne    19a8 <fflush+0x48>
+}
+    1989:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    198c:	c9                   	leave
+    198d:	c3                   	ret
+    198e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    1990:	83 ec 0c             	sub    $0xc,%esp
+    1993:	8d 43 18             	lea    0x18(%ebx),%eax
+    1996:	50                   	push   %eax
+    1997:	e8 a4 f4 ff ff       	call   e40 <mutex_lock>
+    199c:	83 c4 10             	add    $0x10,%esp
+    199f:	eb d7                	jmp    1978 <fflush+0x18>
+    19a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    19a8:	83 ec 0c             	sub    $0xc,%esp
+    19ab:	83 c3 18             	add    $0x18,%ebx
+    19ae:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    19b1:	53                   	push   %ebx
+    19b2:	e8 d9 f4 ff ff       	call   e90 <mutex_unlock>
+    19b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    19ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    mutex_unlock(&f->lock);
+    19bd:	83 c4 10             	add    $0x10,%esp
+}
+    19c0:	c9                   	leave
+    19c1:	c3                   	ret
+    19c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    19c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    19cb:	c9                   	leave
+    19cc:	e9 af fb ff ff       	jmp    1580 <fflush.part.0>
+    19d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19df:	90                   	nop
+
+000019e0 <putc_unlocked>:
+{
+    19e0:	55                   	push   %ebp
+    19e1:	89 e5                	mov    %esp,%ebp
+    19e3:	56                   	push   %esi
+    19e4:	53                   	push   %ebx
+    19e5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    19e8:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(!(f->flags & IO_WRITE))
+    19eb:	8b 43 04             	mov    0x4(%ebx),%eax
+    19ee:	a8 02                	test   $0x2,%al
+    19f0:	74 46                	je     1a38 <putc_unlocked+0x58>
+  if(!(f->flags & IO_SETUP))
+    19f2:	a8 40                	test   $0x40,%al
+    19f4:	74 4a                	je     1a40 <putc_unlocked+0x60>
+  if(f->n == f->size && flush(f) < 0)
+    19f6:	8b 43 14             	mov    0x14(%ebx),%eax
+    19f9:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    19fc:	74 51                	je     1a4f <putc_unlocked+0x6f>
+  f->buf[f->n++] = c;
+    19fe:	8d 48 01             	lea    0x1(%eax),%ecx
+    1a01:	8b 53 08             	mov    0x8(%ebx),%edx
+    1a04:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    1a07:	89 f1                	mov    %esi,%ecx
+    1a09:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    1a0c:	83 fe 0a             	cmp    $0xa,%esi
+    1a0f:	74 0f                	je     1a20 <putc_unlocked+0x40>
+  return c & 0xff;
+    1a11:	89 f0                	mov    %esi,%eax
+    1a13:	0f b6 c0             	movzbl %al,%eax
+}
+    1a16:	5b                   	pop    %ebx
+    1a17:	5e                   	pop    %esi
+    1a18:	5d                   	pop    %ebp
+    1a19:	c3                   	ret
+    1a1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    1a20:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1a24:	74 eb                	je     1a11 <putc_unlocked+0x31>
+    1a26:	89 d8                	mov    %ebx,%eax
+    1a28:	e8 d3 fa ff ff       	call   1500 <flush>
+    1a2d:	85 c0                	test   %eax,%eax
+    1a2f:	79 e0                	jns    1a11 <putc_unlocked+0x31>
+    1a31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return EOF;
+    1a38:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1a3d:	eb d7                	jmp    1a16 <putc_unlocked+0x36>
+    1a3f:	90                   	nop
+    setup(f);
+    1a40:	89 d8                	mov    %ebx,%eax
+    1a42:	e8 69 fa ff ff       	call   14b0 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    1a47:	8b 43 14             	mov    0x14(%ebx),%eax
+    1a4a:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    1a4d:	75 af                	jne    19fe <putc_unlocked+0x1e>
+    1a4f:	89 d8                	mov    %ebx,%eax
+    1a51:	e8 aa fa ff ff       	call   1500 <flush>
+    1a56:	85 c0                	test   %eax,%eax
+    1a58:	78 de                	js     1a38 <putc_unlocked+0x58>
+  f->buf[f->n++] = c;
+    1a5a:	8b 43 14             	mov    0x14(%ebx),%eax
+    1a5d:	eb 9f                	jmp    19fe <putc_unlocked+0x1e>
+    1a5f:	90                   	nop
+
+00001a60 <fputc>:
+{
+    1a60:	55                   	push   %ebp
+    1a61:	89 e5                	mov    %esp,%ebp
+    1a63:	56                   	push   %esi
+    1a64:	53                   	push   %ebx
+  if(threaded)
+    1a65:	8b 15 c0 37 00 00    	mov    0x37c0,%edx
+{
+    1a6b:	8b 75 08             	mov    0x8(%ebp),%esi
+    1a6e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(threaded)
+    1a71:	85 d2                	test   %edx,%edx
+    1a73:	75 6b                	jne    1ae0 <fputc+0x80>
+  if(!(f->flags & IO_WRITE))
+    1a75:	8b 43 04             	mov    0x4(%ebx),%eax
+    1a78:	a8 02                	test   $0x2,%al
+    1a7a:	0f 84 b8 00 00 00    	je     1b38 <fputc+0xd8>
+  if(!(f->flags & IO_SETUP))
+    1a80:	a8 40                	test   $0x40,%al
+    1a82:	74 76                	je     1afa <fputc+0x9a>
+  if(f->n == f->size && flush(f) < 0)
+    1a84:	8b 43 14             	mov    0x14(%ebx),%eax
+    1a87:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    1a8a:	74 7d                	je     1b09 <fputc+0xa9>
+  f->buf[f->n++] = c;
+    1a8c:	8d 48 01             	lea    0x1(%eax),%ecx
+    1a8f:	8b 53 08             	mov    0x8(%ebx),%edx
+    1a92:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    1a95:	89 f1                	mov    %esi,%ecx
+    1a97:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    1a9a:	83 fe 0a             	cmp    $0xa,%esi
+    1a9d:	74 21                	je     1ac0 <fputc+0x60>
+  return c & 0xff;
+    1a9f:	89 f0                	mov    %esi,%eax
+    1aa1:	0f b6 f0             	movzbl %al,%esi
+  if(threaded)
+    1aa4:	a1 c0 37 00 00       	mov    0x37c0,%eax
+    1aa9:	85 c0                	test   %eax,%eax
+    1aab:	75 73                	jne    1b20 <fputc+0xc0>
+}
+    1aad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1ab0:	89 f0                	mov    %esi,%eax
+    1ab2:	5b                   	pop    %ebx
+    1ab3:	5e                   	pop    %esi
+    1ab4:	5d                   	pop    %ebp
+    1ab5:	c3                   	ret
+    1ab6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1abd:	8d 76 00             	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    1ac0:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1ac4:	74 d9                	je     1a9f <fputc+0x3f>
+    1ac6:	89 d8                	mov    %ebx,%eax
+    1ac8:	e8 33 fa ff ff       	call   1500 <flush>
+    1acd:	85 c0                	test   %eax,%eax
+    1acf:	79 ce                	jns    1a9f <fputc+0x3f>
+    return EOF;
+    1ad1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1ad6:	eb cc                	jmp    1aa4 <fputc+0x44>
+    1ad8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1adf:	90                   	nop
+    mutex_lock(&f->lock);
+    1ae0:	83 ec 0c             	sub    $0xc,%esp
+    1ae3:	8d 43 18             	lea    0x18(%ebx),%eax
+    1ae6:	50                   	push   %eax
+    1ae7:	e8 54 f3 ff ff       	call   e40 <mutex_lock>
+  if(!(f->flags & IO_WRITE))
+    1aec:	8b 43 04             	mov    0x4(%ebx),%eax
+    1aef:	83 c4 10             	add    $0x10,%esp
+    1af2:	a8 02                	test   $0x2,%al
+    1af4:	74 db                	je     1ad1 <fputc+0x71>
+  if(!(f->flags & IO_SETUP))
+    1af6:	a8 40                	test   $0x40,%al
+    1af8:	75 8a                	jne    1a84 <fputc+0x24>
+    setup(f);
+    1afa:	89 d8                	mov    %ebx,%eax
+    1afc:	e8 af f9 ff ff       	call   14b0 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    1b01:	8b 43 14             	mov    0x14(%ebx),%eax
+    1b04:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    1b07:	75 83                	jne    1a8c <fputc+0x2c>
+    1b09:	89 d8                	mov    %ebx,%eax
+    1b0b:	e8 f0 f9 ff ff       	call   1500 <flush>
+    1b10:	85 c0                	test   %eax,%eax
+    1b12:	78 bd                	js     1ad1 <fputc+0x71>
+  f->buf[f->n++] = c;
+    1b14:	8b 43 14             	mov    0x14(%ebx),%eax
+    1b17:	e9 70 ff ff ff       	jmp    1a8c <fputc+0x2c>
+    1b1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1b20:	83 ec 0c             	sub    $0xc,%esp
+    1b23:	83 c3 18             	add    $0x18,%ebx
+    1b26:	53                   	push   %ebx
+    1b27:	e8 64 f3 ff ff       	call   e90 <mutex_unlock>
+    1b2c:	83 c4 10             	add    $0x10,%esp
+}
+    1b2f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1b32:	89 f0                	mov    %esi,%eax
+    1b34:	5b                   	pop    %ebx
+    1b35:	5e                   	pop    %esi
+    1b36:	5d                   	pop    %ebp
+    1b37:	c3                   	ret
+    return EOF;
+    1b38:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    1b3d:	e9 6b ff ff ff       	jmp    1aad <fputc+0x4d>
+    1b42:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001b50 <fwrite>:
+{
+    1b50:	55                   	push   %ebp
+    1b51:	89 e5                	mov    %esp,%ebp
+    1b53:	57                   	push   %edi
+    1b54:	56                   	push   %esi
+    1b55:	53                   	push   %ebx
+    1b56:	83 ec 1c             	sub    $0x1c,%esp
+    1b59:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  if(!(f->flags & IO_WRITE) || size <= 0)
+    1b5c:	8b 43 04             	mov    0x4(%ebx),%eax
+    1b5f:	a8 02                	test   $0x2,%al
+    1b61:	0f 84 ec 00 00 00    	je     1c53 <fwrite+0x103>
+    1b67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    1b6a:	85 c9                	test   %ecx,%ecx
+    1b6c:	0f 8e e1 00 00 00    	jle    1c53 <fwrite+0x103>
+  if(threaded)
+    1b72:	8b 15 c0 37 00 00    	mov    0x37c0,%edx
+    1b78:	85 d2                	test   %edx,%edx
+    1b7a:	0f 85 1c 01 00 00    	jne    1c9c <fwrite+0x14c>
+  if(!(f->flags & IO_SETUP))
+    1b80:	a8 40                	test   $0x40,%al
+    1b82:	0f 84 08 01 00 00    	je     1c90 <fwrite+0x140>
+  for(len = size*nmemb; len > 0; len -= n){
+    1b88:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1b8b:	0f af 45 10          	imul   0x10(%ebp),%eax
+    1b8f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    1b92:	85 c0                	test   %eax,%eax
+    1b94:	0f 8e 2a 01 00 00    	jle    1cc4 <fwrite+0x174>
+  s = p;
+    1b9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  nl = 0;
+    1b9d:	31 ff                	xor    %edi,%edi
+    1b9f:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+        nl = 1;
+    1ba2:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  s = p;
+    1ba5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1ba8:	8b 43 14             	mov    0x14(%ebx),%eax
+        nl = 1;
+    1bab:	89 ce                	mov    %ecx,%esi
+    if(f->n == f->size && flush(f) < 0)
+    1bad:	89 c2                	mov    %eax,%edx
+    1baf:	39 f0                	cmp    %esi,%eax
+    1bb1:	74 6e                	je     1c21 <fwrite+0xd1>
+    1bb3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1bb7:	90                   	nop
+    if(n > len)
+    1bb8:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    n = f->size - f->n;
+    1bbb:	89 f1                	mov    %esi,%ecx
+    1bbd:	29 c1                	sub    %eax,%ecx
+    1bbf:	39 f9                	cmp    %edi,%ecx
+    1bc1:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1bc4:	85 c9                	test   %ecx,%ecx
+    1bc6:	0f 8e 7c 00 00 00    	jle    1c48 <fwrite+0xf8>
+    1bcc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1bcf:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1bd2:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    1bd5:	8d 34 08             	lea    (%eax,%ecx,1),%esi
+    1bd8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    1bdb:	eb 06                	jmp    1be3 <fwrite+0x93>
+    1bdd:	8d 76 00             	lea    0x0(%esi),%esi
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1be0:	8b 53 14             	mov    0x14(%ebx),%edx
+    1be3:	8d 4a 01             	lea    0x1(%edx),%ecx
+    1be6:	8b 73 08             	mov    0x8(%ebx),%esi
+    1be9:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    1bec:	0f b6 08             	movzbl (%eax),%ecx
+        nl = 1;
+    1bef:	80 f9 0a             	cmp    $0xa,%cl
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1bf2:	88 0c 16             	mov    %cl,(%esi,%edx,1)
+        nl = 1;
+    1bf5:	be 01 00 00 00       	mov    $0x1,%esi
+    1bfa:	0f 44 fe             	cmove  %esi,%edi
+    for(i = 0; i < n; i++)
+    1bfd:	83 c0 01             	add    $0x1,%eax
+    1c00:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    1c03:	75 db                	jne    1be0 <fwrite+0x90>
+    s += n;
+    1c05:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1c08:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    1c0b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    s += n;
+    1c0e:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    1c11:	85 c0                	test   %eax,%eax
+    1c13:	7e 48                	jle    1c5d <fwrite+0x10d>
+    1c15:	8b 43 14             	mov    0x14(%ebx),%eax
+    1c18:	8b 73 0c             	mov    0xc(%ebx),%esi
+    if(f->n == f->size && flush(f) < 0)
+    1c1b:	89 c2                	mov    %eax,%edx
+    1c1d:	39 f0                	cmp    %esi,%eax
+    1c1f:	75 97                	jne    1bb8 <fwrite+0x68>
+    1c21:	89 d8                	mov    %ebx,%eax
+    1c23:	e8 d8 f8 ff ff       	call   1500 <flush>
+    1c28:	85 c0                	test   %eax,%eax
+    1c2a:	78 31                	js     1c5d <fwrite+0x10d>
+    n = f->size - f->n;
+    1c2c:	8b 73 0c             	mov    0xc(%ebx),%esi
+    1c2f:	8b 43 14             	mov    0x14(%ebx),%eax
+    1c32:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    1c35:	89 f1                	mov    %esi,%ecx
+    1c37:	89 c2                	mov    %eax,%edx
+    1c39:	29 c1                	sub    %eax,%ecx
+    1c3b:	39 f9                	cmp    %edi,%ecx
+    1c3d:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1c40:	85 c9                	test   %ecx,%ecx
+    1c42:	7f 88                	jg     1bcc <fwrite+0x7c>
+    1c44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    s += n;
+    1c48:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    1c4b:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    1c4e:	e9 5a ff ff ff       	jmp    1bad <fwrite+0x5d>
+}
+    1c53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    1c56:	31 c0                	xor    %eax,%eax
+}
+    1c58:	5b                   	pop    %ebx
+    1c59:	5e                   	pop    %esi
+    1c5a:	5f                   	pop    %edi
+    1c5b:	5d                   	pop    %ebp
+    1c5c:	c3                   	ret
+  if(nl && (f->flags & IO_LINE))
+    1c5d:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1c60:	85 ff                	test   %edi,%edi
+    1c62:	74 06                	je     1c6a <fwrite+0x11a>
+    1c64:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1c68:	75 1d                	jne    1c87 <fwrite+0x137>
+  return (s - (const char*)p) / size;
+    1c6a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1c6d:	2b 75 08             	sub    0x8(%ebp),%esi
+  if(threaded)
+    1c70:	a1 c0 37 00 00       	mov    0x37c0,%eax
+    1c75:	85 c0                	test   %eax,%eax
+    1c77:	75 3a                	jne    1cb3 <fwrite+0x163>
+  return (s - (const char*)p) / size;
+    1c79:	89 f0                	mov    %esi,%eax
+    1c7b:	99                   	cltd
+    1c7c:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1c7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c82:	5b                   	pop    %ebx
+    1c83:	5e                   	pop    %esi
+    1c84:	5f                   	pop    %edi
+    1c85:	5d                   	pop    %ebp
+    1c86:	c3                   	ret
+    flush(f);
+    1c87:	89 d8                	mov    %ebx,%eax
+    1c89:	e8 72 f8 ff ff       	call   1500 <flush>
+    1c8e:	eb da                	jmp    1c6a <fwrite+0x11a>
+    setup(f);
+    1c90:	89 d8                	mov    %ebx,%eax
+    1c92:	e8 19 f8 ff ff       	call   14b0 <setup>
+    1c97:	e9 ec fe ff ff       	jmp    1b88 <fwrite+0x38>
+    mutex_lock(&f->lock);
+    1c9c:	83 ec 0c             	sub    $0xc,%esp
+    1c9f:	8d 43 18             	lea    0x18(%ebx),%eax
+    1ca2:	50                   	push   %eax
+    1ca3:	e8 98 f1 ff ff       	call   e40 <mutex_lock>
+  if(!(f->flags & IO_SETUP))
+    1ca8:	8b 43 04             	mov    0x4(%ebx),%eax
+    1cab:	83 c4 10             	add    $0x10,%esp
+    1cae:	e9 cd fe ff ff       	jmp    1b80 <fwrite+0x30>
+    mutex_unlock(&f->lock);
+    1cb3:	83 ec 0c             	sub    $0xc,%esp
+    1cb6:	83 c3 18             	add    $0x18,%ebx
+    1cb9:	53                   	push   %ebx
+    1cba:	e8 d1 f1 ff ff       	call   e90 <mutex_unlock>
+    1cbf:	83 c4 10             	add    $0x10,%esp
+    1cc2:	eb b5                	jmp    1c79 <fwrite+0x129>
+  for(len = size*nmemb; len > 0; len -= n){
+    1cc4:	31 f6                	xor    %esi,%esi
+    1cc6:	eb a8                	jmp    1c70 <fwrite+0x120>
+    1cc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ccf:	90                   	nop
+
+00001cd0 <fgetc>:
+  return f->buf[f->r++] & 0xff;
+}
+
+int
+fgetc(FILE *f)
+{
+    1cd0:	55                   	push   %ebp
+    1cd1:	89 e5                	mov    %esp,%ebp
+    1cd3:	56                   	push   %esi
+    1cd4:	53                   	push   %ebx
+  if(threaded)
+    1cd5:	8b 15 c0 37 00 00    	mov    0x37c0,%edx
+{
+    1cdb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    1cde:	85 d2                	test   %edx,%edx
+    1ce0:	75 2e                	jne    1d10 <fgetc+0x40>
+  if(!(f->flags & IO_READ))
+    1ce2:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1ce6:	74 78                	je     1d60 <fgetc+0x90>
+  if(f->r == f->n && fill(f) == 0)
+    1ce8:	8b 43 10             	mov    0x10(%ebx),%eax
+    1ceb:	3b 43 14             	cmp    0x14(%ebx),%eax
+    1cee:	74 60                	je     1d50 <fgetc+0x80>
+  return f->buf[f->r++] & 0xff;
+    1cf0:	8b 53 08             	mov    0x8(%ebx),%edx
+    1cf3:	8d 48 01             	lea    0x1(%eax),%ecx
+    1cf6:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1cf9:	0f b6 34 02          	movzbl (%edx,%eax,1),%esi
+  if(threaded)
+    1cfd:	a1 c0 37 00 00       	mov    0x37c0,%eax
+    1d02:	85 c0                	test   %eax,%eax
+    1d04:	75 2a                	jne    1d30 <fgetc+0x60>
+
+  flockfile(f);
+  c = getc_unlocked(f);
+  funlockfile(f);
+  return c;
+}
+    1d06:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1d09:	89 f0                	mov    %esi,%eax
+    1d0b:	5b                   	pop    %ebx
+    1d0c:	5e                   	pop    %esi
+    1d0d:	5d                   	pop    %ebp
+    1d0e:	c3                   	ret
+    1d0f:	90                   	nop
+    mutex_lock(&f->lock);
+    1d10:	83 ec 0c             	sub    $0xc,%esp
+    1d13:	8d 43 18             	lea    0x18(%ebx),%eax
+    1d16:	50                   	push   %eax
+    1d17:	e8 24 f1 ff ff       	call   e40 <mutex_lock>
+  if(!(f->flags & IO_READ))
+    1d1c:	83 c4 10             	add    $0x10,%esp
+    1d1f:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1d23:	75 c3                	jne    1ce8 <fgetc+0x18>
+    return EOF;
+    1d25:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1d2a:	eb d1                	jmp    1cfd <fgetc+0x2d>
+    1d2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1d30:	83 ec 0c             	sub    $0xc,%esp
+    1d33:	83 c3 18             	add    $0x18,%ebx
+    1d36:	53                   	push   %ebx
+    1d37:	e8 54 f1 ff ff       	call   e90 <mutex_unlock>
+    1d3c:	83 c4 10             	add    $0x10,%esp
+}
+    1d3f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1d42:	89 f0                	mov    %esi,%eax
+    1d44:	5b                   	pop    %ebx
+    1d45:	5e                   	pop    %esi
+    1d46:	5d                   	pop    %ebp
+    1d47:	c3                   	ret
+    1d48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d4f:	90                   	nop
+  if(f->r == f->n && fill(f) == 0)
+    1d50:	89 d8                	mov    %ebx,%eax
+    1d52:	e8 c9 f8 ff ff       	call   1620 <fill>
+    1d57:	85 c0                	test   %eax,%eax
+    1d59:	74 ca                	je     1d25 <fgetc+0x55>
+  return f->buf[f->r++] & 0xff;
+    1d5b:	8b 43 10             	mov    0x10(%ebx),%eax
+    1d5e:	eb 90                	jmp    1cf0 <fgetc+0x20>
+    return EOF;
+    1d60:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    1d65:	eb 9f                	jmp    1d06 <fgetc+0x36>
+    1d67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d6e:	66 90                	xchg   %ax,%ax
+
+00001d70 <fread>:
+
+int
+fread(void *p, int size, int nmemb, FILE *f)
+{
+    1d70:	55                   	push   %ebp
+    1d71:	89 e5                	mov    %esp,%ebp
+    1d73:	57                   	push   %edi
+    1d74:	56                   	push   %esi
+    1d75:	53                   	push   %ebx
+    1d76:	83 ec 1c             	sub    $0x1c,%esp
+    1d79:	8b 75 14             	mov    0x14(%ebp),%esi
+  char *d;
+  int n, len;
+
+  if(!(f->flags & IO_READ) || size <= 0)
+    1d7c:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+    1d80:	74 7e                	je     1e00 <fread+0x90>
+    1d82:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1d85:	85 d2                	test   %edx,%edx
+    1d87:	7e 77                	jle    1e00 <fread+0x90>
+  if(threaded)
+    1d89:	a1 c0 37 00 00       	mov    0x37c0,%eax
+    return 0;
+  flockfile(f);
+  d = p;
+  for(len = size*nmemb; len > 0; len -= n){
+    1d8e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1d91:	0f af 7d 10          	imul   0x10(%ebp),%edi
+  if(threaded)
+    1d95:	85 c0                	test   %eax,%eax
+    1d97:	0f 85 93 00 00 00    	jne    1e30 <fread+0xc0>
+  for(len = size*nmemb; len > 0; len -= n){
+    1d9d:	85 ff                	test   %edi,%edi
+    1d9f:	7e 61                	jle    1e02 <fread+0x92>
+    if(f->r == f->n && fill(f) == 0)
+    1da1:	8b 46 10             	mov    0x10(%esi),%eax
+  d = p;
+    1da4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1da7:	eb 35                	jmp    1dde <fread+0x6e>
+    1da9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      break;
+    n = f->n - f->r;
+    1db0:	29 c3                	sub    %eax,%ebx
+    1db2:	39 fb                	cmp    %edi,%ebx
+    1db4:	0f 4f df             	cmovg  %edi,%ebx
+    if(n > len)
+      n = len;
+    memmove(d, f->buf + f->r, n);
+    1db7:	83 ec 04             	sub    $0x4,%esp
+    1dba:	53                   	push   %ebx
+    1dbb:	03 46 08             	add    0x8(%esi),%eax
+  for(len = size*nmemb; len > 0; len -= n){
+    1dbe:	29 df                	sub    %ebx,%edi
+    memmove(d, f->buf + f->r, n);
+    1dc0:	50                   	push   %eax
+    1dc1:	51                   	push   %ecx
+    1dc2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1dc5:	e8 36 f0 ff ff       	call   e00 <memmove>
+    f->r += n;
+    1dca:	8b 46 10             	mov    0x10(%esi),%eax
+    d += n;
+    1dcd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1dd0:	83 c4 10             	add    $0x10,%esp
+    f->r += n;
+    1dd3:	01 d8                	add    %ebx,%eax
+    d += n;
+    1dd5:	01 d9                	add    %ebx,%ecx
+    f->r += n;
+    1dd7:	89 46 10             	mov    %eax,0x10(%esi)
+  for(len = size*nmemb; len > 0; len -= n){
+    1dda:	85 ff                	test   %edi,%edi
+    1ddc:	7e 32                	jle    1e10 <fread+0xa0>
+    if(f->r == f->n && fill(f) == 0)
+    1dde:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1de1:	39 c3                	cmp    %eax,%ebx
+    1de3:	75 cb                	jne    1db0 <fread+0x40>
+    1de5:	89 f0                	mov    %esi,%eax
+    1de7:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1dea:	e8 31 f8 ff ff       	call   1620 <fill>
+    1def:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1df2:	85 c0                	test   %eax,%eax
+    1df4:	74 1a                	je     1e10 <fread+0xa0>
+    n = f->n - f->r;
+    1df6:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1df9:	8b 46 10             	mov    0x10(%esi),%eax
+    1dfc:	eb b2                	jmp    1db0 <fread+0x40>
+    1dfe:	66 90                	xchg   %ax,%ax
+    return 0;
+    1e00:	31 c0                	xor    %eax,%eax
+  }
+  funlockfile(f);
+  return (d - (char*)p) / size;
+}
+    1e02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1e05:	5b                   	pop    %ebx
+    1e06:	5e                   	pop    %esi
+    1e07:	5f                   	pop    %edi
+    1e08:	5d                   	pop    %ebp
+    1e09:	c3                   	ret
+    1e0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (d - (char*)p) / size;
+    1e10:	2b 4d 08             	sub    0x8(%ebp),%ecx
+    1e13:	89 cb                	mov    %ecx,%ebx
+  if(threaded)
+    1e15:	a1 c0 37 00 00       	mov    0x37c0,%eax
+    1e1a:	85 c0                	test   %eax,%eax
+    1e1c:	75 32                	jne    1e50 <fread+0xe0>
+  return (d - (char*)p) / size;
+    1e1e:	89 d8                	mov    %ebx,%eax
+    1e20:	99                   	cltd
+    1e21:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1e24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1e27:	5b                   	pop    %ebx
+    1e28:	5e                   	pop    %esi
+    1e29:	5f                   	pop    %edi
+    1e2a:	5d                   	pop    %ebp
+    1e2b:	c3                   	ret
+    1e2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    1e30:	83 ec 0c             	sub    $0xc,%esp
+    1e33:	8d 46 18             	lea    0x18(%esi),%eax
+    1e36:	50                   	push   %eax
+    1e37:	e8 04 f0 ff ff       	call   e40 <mutex_lock>
+  for(len = size*nmemb; len > 0; len -= n){
+    1e3c:	83 c4 10             	add    $0x10,%esp
+    1e3f:	85 ff                	test   %edi,%edi
+    1e41:	0f 8f 5a ff ff ff    	jg     1da1 <fread+0x31>
+    1e47:	31 db                	xor    %ebx,%ebx
+    1e49:	eb ca                	jmp    1e15 <fread+0xa5>
+    1e4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1e4f:	90                   	nop
+    mutex_unlock(&f->lock);
+    1e50:	83 ec 0c             	sub    $0xc,%esp
+    1e53:	83 c6 18             	add    $0x18,%esi
+    1e56:	56                   	push   %esi
+    1e57:	e8 34 f0 ff ff       	call   e90 <mutex_unlock>
+  return (d - (char*)p) / size;
+    1e5c:	89 d8                	mov    %ebx,%eax
+    1e5e:	83 c4 10             	add    $0x10,%esp
+    1e61:	99                   	cltd
+    1e62:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1e65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1e68:	5b                   	pop    %ebx
+    1e69:	5e                   	pop    %esi
+    1e6a:	5f                   	pop    %edi
+    1e6b:	5d                   	pop    %ebp
+    1e6c:	c3                   	ret
+    1e6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001e70 <fgets>:
+
+// Read a line of at most max-1 bytes, keeping the newline.
+// Returns 0 if there was nothing left to read.
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    1e70:	55                   	push   %ebp
+    1e71:	89 e5                	mov    %esp,%ebp
+    1e73:	57                   	push   %edi
+    1e74:	56                   	push   %esi
+    1e75:	53                   	push   %ebx
+    1e76:	83 ec 1c             	sub    $0x1c,%esp
+  if(threaded)
+    1e79:	8b 35 c0 37 00 00    	mov    0x37c0,%esi
+{
+    1e7f:	8b 7d 08             	mov    0x8(%ebp),%edi
+    1e82:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if(threaded)
+    1e85:	85 f6                	test   %esi,%esi
+    1e87:	0f 85 83 00 00 00    	jne    1f10 <fgets+0xa0>
+{
+    1e8d:	31 f6                	xor    %esi,%esi
+    1e8f:	eb 2a                	jmp    1ebb <fgets+0x4b>
+    1e91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return f->buf[f->r++] & 0xff;
+    1e98:	8b 53 08             	mov    0x8(%ebx),%edx
+    1e9b:	8d 48 01             	lea    0x1(%eax),%ecx
+    1e9e:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1ea1:	0f b6 14 02          	movzbl (%edx,%eax,1),%edx
+
+  flockfile(f);
+  for(i = 0; i+1 < max; ){
+    if((c = getc_unlocked(f)) == EOF)
+      break;
+    buf[i++] = c;
+    1ea5:	88 54 37 ff          	mov    %dl,-0x1(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    1ea9:	80 fa 0a             	cmp    $0xa,%dl
+    1eac:	0f 84 96 00 00 00    	je     1f48 <fgets+0xd8>
+    1eb2:	83 fa 0d             	cmp    $0xd,%edx
+    1eb5:	0f 84 8d 00 00 00    	je     1f48 <fgets+0xd8>
+  for(i = 0; i+1 < max; ){
+    1ebb:	89 f2                	mov    %esi,%edx
+    1ebd:	83 c6 01             	add    $0x1,%esi
+    1ec0:	3b 75 0c             	cmp    0xc(%ebp),%esi
+    1ec3:	7d 2b                	jge    1ef0 <fgets+0x80>
+  if(!(f->flags & IO_READ))
+    1ec5:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1ec9:	74 25                	je     1ef0 <fgets+0x80>
+  if(f->r == f->n && fill(f) == 0)
+    1ecb:	8b 43 10             	mov    0x10(%ebx),%eax
+    1ece:	3b 43 14             	cmp    0x14(%ebx),%eax
+    1ed1:	75 c5                	jne    1e98 <fgets+0x28>
+    1ed3:	89 d8                	mov    %ebx,%eax
+    1ed5:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1ed8:	e8 43 f7 ff ff       	call   1620 <fill>
+    1edd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1ee0:	85 c0                	test   %eax,%eax
+    1ee2:	74 0c                	je     1ef0 <fgets+0x80>
+  return f->buf[f->r++] & 0xff;
+    1ee4:	8b 43 10             	mov    0x10(%ebx),%eax
+    1ee7:	eb af                	jmp    1e98 <fgets+0x28>
+    1ee9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1ef0:	8b 0d c0 37 00 00    	mov    0x37c0,%ecx
+      break;
+  }
+  buf[i] = '\0';
+    1ef6:	c6 04 17 00          	movb   $0x0,(%edi,%edx,1)
+  if(threaded)
+    1efa:	85 c9                	test   %ecx,%ecx
+    1efc:	75 2a                	jne    1f28 <fgets+0xb8>
+  funlockfile(f);
+  return i > 0 ? buf : 0;
+    1efe:	31 c0                	xor    %eax,%eax
+    1f00:	85 d2                	test   %edx,%edx
+    1f02:	74 02                	je     1f06 <fgets+0x96>
+    1f04:	89 f8                	mov    %edi,%eax
+}
+    1f06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1f09:	5b                   	pop    %ebx
+    1f0a:	5e                   	pop    %esi
+    1f0b:	5f                   	pop    %edi
+    1f0c:	5d                   	pop    %ebp
+    1f0d:	c3                   	ret
+    1f0e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    1f10:	83 ec 0c             	sub    $0xc,%esp
+    1f13:	8d 43 18             	lea    0x18(%ebx),%eax
+    1f16:	50                   	push   %eax
+    1f17:	e8 24 ef ff ff       	call   e40 <mutex_lock>
+    1f1c:	83 c4 10             	add    $0x10,%esp
+    1f1f:	e9 69 ff ff ff       	jmp    1e8d <fgets+0x1d>
+    1f24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1f28:	83 ec 0c             	sub    $0xc,%esp
+    1f2b:	83 c3 18             	add    $0x18,%ebx
+    1f2e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1f31:	53                   	push   %ebx
+    1f32:	e8 59 ef ff ff       	call   e90 <mutex_unlock>
+    1f37:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1f3a:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    1f3d:	31 c0                	xor    %eax,%eax
+    1f3f:	85 d2                	test   %edx,%edx
+    1f41:	75 c1                	jne    1f04 <fgets+0x94>
+    1f43:	eb c1                	jmp    1f06 <fgets+0x96>
+    1f45:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1f48:	a1 c0 37 00 00       	mov    0x37c0,%eax
+  buf[i] = '\0';
+    1f4d:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  if(threaded)
+    1f51:	85 c0                	test   %eax,%eax
+    1f53:	74 af                	je     1f04 <fgets+0x94>
+    mutex_unlock(&f->lock);
+    1f55:	83 ec 0c             	sub    $0xc,%esp
+    1f58:	83 c3 18             	add    $0x18,%ebx
+    1f5b:	53                   	push   %ebx
+    1f5c:	e8 2f ef ff ff       	call   e90 <mutex_unlock>
+    1f61:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    1f64:	89 f8                	mov    %edi,%eax
+    1f66:	eb 9e                	jmp    1f06 <fgets+0x96>
+    1f68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f6f:	90                   	nop
+
+00001f70 <gets>:
+// at most a line per read(), goes through stdin's buffer: from a
+// file or pipe, a buffered read could take input meant for a child
+// process, so read a byte at a time.
+char*
+gets(char *buf, int max)
+{
+    1f70:	55                   	push   %ebp
+    1f71:	89 e5                	mov    %esp,%ebp
+    1f73:	57                   	push   %edi
+    1f74:	56                   	push   %esi
+    1f75:	53                   	push   %ebx
+    1f76:	83 ec 2c             	sub    $0x2c,%esp
+  int i, cc;
+  char c;
+
+  if(!(stdin->flags & IO_SETUP))
+    1f79:	8b 15 64 36 00 00    	mov    0x3664,%edx
+{
+    1f7f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!(stdin->flags & IO_SETUP))
+    1f82:	f6 c2 40             	test   $0x40,%dl
+    1f85:	74 79                	je     2000 <gets+0x90>
+    setup(stdin);
+  if(stdin->flags & IO_DEV){
+    1f87:	83 e2 20             	and    $0x20,%edx
+    1f8a:	89 d7                	mov    %edx,%edi
+    1f8c:	75 52                	jne    1fe0 <gets+0x70>
+  if(f == 0){
+    1f8e:	e8 ed f5 ff ff       	call   1580 <fflush.part.0>
+    fgets(buf, max, stdin);
+    return buf;
+  }
+  fflush(0);
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1f93:	8d 75 e7             	lea    -0x19(%ebp),%esi
+  for(i=0; i+1 < max; ){
+    1f96:	eb 2c                	jmp    1fc4 <gets+0x54>
+    1f98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f9f:	90                   	nop
+    cc = read(0, &c, 1);
+    1fa0:	83 ec 04             	sub    $0x4,%esp
+    1fa3:	6a 01                	push   $0x1
+    1fa5:	56                   	push   %esi
+    1fa6:	6a 00                	push   $0x0
+    1fa8:	e8 f5 ef ff ff       	call   fa2 <read>
+    if(cc < 1)
+    1fad:	83 c4 10             	add    $0x10,%esp
+    1fb0:	85 c0                	test   %eax,%eax
+    1fb2:	7e 1b                	jle    1fcf <gets+0x5f>
+      break;
+    buf[i++] = c;
+    1fb4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1fb8:	88 44 3b ff          	mov    %al,-0x1(%ebx,%edi,1)
+    if(c == '\n' || c == '\r')
+    1fbc:	3c 0a                	cmp    $0xa,%al
+    1fbe:	74 12                	je     1fd2 <gets+0x62>
+    1fc0:	3c 0d                	cmp    $0xd,%al
+    1fc2:	74 0e                	je     1fd2 <gets+0x62>
+  for(i=0; i+1 < max; ){
+    1fc4:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    1fc7:	83 c7 01             	add    $0x1,%edi
+    1fca:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+    1fcd:	7c d1                	jl     1fa0 <gets+0x30>
+{
+    1fcf:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      break;
+  }
+  buf[i] = '\0';
+    1fd2:	c6 04 3b 00          	movb   $0x0,(%ebx,%edi,1)
+  return buf;
+}
+    1fd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1fd9:	89 d8                	mov    %ebx,%eax
+    1fdb:	5b                   	pop    %ebx
+    1fdc:	5e                   	pop    %esi
+    1fdd:	5f                   	pop    %edi
+    1fde:	5d                   	pop    %ebp
+    1fdf:	c3                   	ret
+    fgets(buf, max, stdin);
+    1fe0:	83 ec 04             	sub    $0x4,%esp
+    1fe3:	68 60 36 00 00       	push   $0x3660
+    1fe8:	ff 75 0c             	push   0xc(%ebp)
+    1feb:	53                   	push   %ebx
+    1fec:	e8 7f fe ff ff       	call   1e70 <fgets>
+    return buf;
+    1ff1:	83 c4 10             	add    $0x10,%esp
+}
+    1ff4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ff7:	89 d8                	mov    %ebx,%eax
+    1ff9:	5b                   	pop    %ebx
+    1ffa:	5e                   	pop    %esi
+    1ffb:	5f                   	pop    %edi
+    1ffc:	5d                   	pop    %ebp
+    1ffd:	c3                   	ret
+    1ffe:	66 90                	xchg   %ax,%ax
+    setup(stdin);
+    2000:	b8 60 36 00 00       	mov    $0x3660,%eax
+    2005:	e8 a6 f4 ff ff       	call   14b0 <setup>
+  if(stdin->flags & IO_DEV){
+    200a:	8b 15 64 36 00 00    	mov    0x3664,%edx
+    2010:	e9 72 ff ff ff       	jmp    1f87 <gets+0x17>
+    2015:	66 90                	xchg   %ax,%ax
+    2017:	66 90                	xchg   %ax,%ax
+    2019:	66 90                	xchg   %ax,%ax
+    201b:	66 90                	xchg   %ax,%ax
+    201d:	66 90                	xchg   %ax,%ax
+    201f:	90                   	nop
+
+00002020 <bigfree>:
+
+// Give a big block back to the first-fit list, and return the
+// free block that now holds it. Caller holds lock.
+static Header*
+bigfree(Header *bp)
+{
+    2020:	55                   	push   %ebp
+    2021:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2023:	a1 64 3e 00 00       	mov    0x3e64,%eax
+{
+    2028:	89 e5                	mov    %esp,%ebp
+    202a:	56                   	push   %esi
+    202b:	53                   	push   %ebx
+    202c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2030:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2032:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2034:	39 ca                	cmp    %ecx,%edx
+    2036:	73 38                	jae    2070 <bigfree+0x50>
+    2038:	39 c1                	cmp    %eax,%ecx
+    203a:	72 04                	jb     2040 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    203c:	39 c2                	cmp    %eax,%edx
+    203e:	72 f0                	jb     2030 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    2040:	8b 59 04             	mov    0x4(%ecx),%ebx
+    2043:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    2046:	39 f0                	cmp    %esi,%eax
+    2048:	74 36                	je     2080 <bigfree+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    204a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  freep = p;
+  if(p + p->s.size == bp){
+    204c:	8b 42 04             	mov    0x4(%edx),%eax
+    204f:	89 cb                	mov    %ecx,%ebx
+  freep = p;
+    2051:	89 15 64 3e 00 00    	mov    %edx,0x3e64
+  if(p + p->s.size == bp){
+    2057:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    205a:	39 f1                	cmp    %esi,%ecx
+    205c:	74 2e                	je     208c <bigfree+0x6c>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    205e:	89 1a                	mov    %ebx,(%edx)
+    return p;
+  }
+  p->s.ptr = bp;
+  return bp;
+}
+    2060:	89 c8                	mov    %ecx,%eax
+    2062:	5b                   	pop    %ebx
+    2063:	5e                   	pop    %esi
+    2064:	5d                   	pop    %ebp
+    2065:	c3                   	ret
+    2066:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    206d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2070:	39 c1                	cmp    %eax,%ecx
+    2072:	72 c8                	jb     203c <bigfree+0x1c>
+    2074:	eb ba                	jmp    2030 <bigfree+0x10>
+    2076:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    207d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    2080:	03 58 04             	add    0x4(%eax),%ebx
+    2083:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2086:	8b 02                	mov    (%edx),%eax
+    2088:	8b 00                	mov    (%eax),%eax
+    208a:	eb be                	jmp    204a <bigfree+0x2a>
+    p->s.size += bp->s.size;
+    208c:	03 41 04             	add    0x4(%ecx),%eax
+    208f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    2092:	8b 19                	mov    (%ecx),%ebx
+    return p;
+    2094:	89 d1                	mov    %edx,%ecx
+}
+    2096:	89 c8                	mov    %ecx,%eax
+    p->s.ptr = bp->s.ptr;
+    2098:	89 1a                	mov    %ebx,(%edx)
+}
+    209a:	5b                   	pop    %ebx
+    209b:	5e                   	pop    %esi
+    209c:	5d                   	pop    %ebp
+    209d:	c3                   	ret
+    209e:	66 90                	xchg   %ax,%ax
+
+000020a0 <trim>:
+// If free block bp ends the heap, return its whole pages to the
+// kernel, unless something else has moved the break since.
+// Caller holds lock.
+static void
+trim(Header *bp)
+{
+    20a0:	55                   	push   %ebp
+    20a1:	89 e5                	mov    %esp,%ebp
+    20a3:	57                   	push   %edi
+    20a4:	56                   	push   %esi
+    20a5:	53                   	push   %ebx
+    20a6:	89 c3                	mov    %eax,%ebx
+    20a8:	83 ec 0c             	sub    $0xc,%esp
+  char *end;
+  uint n;
+
+  if((char*)(bp + bp->s.size) != heapend)
+    20ab:	8b 53 04             	mov    0x4(%ebx),%edx
+    20ae:	a1 60 3e 00 00       	mov    0x3e60,%eax
+    20b3:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+    20b6:	39 d0                	cmp    %edx,%eax
+    20b8:	74 0e                	je     20c8 <trim+0x28>
+  n = heapend - end;
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    bp->s.size -= n / sizeof(Header);
+    heapend = end;
+  }
+}
+    20ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    20bd:	5b                   	pop    %ebx
+    20be:	5e                   	pop    %esi
+    20bf:	5f                   	pop    %edi
+    20c0:	5d                   	pop    %ebp
+    20c1:	c3                   	ret
+    20c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  end = (char*)PGROUNDUP((uint)(bp + 2));
+    20c8:	8d bb 0f 10 00 00    	lea    0x100f(%ebx),%edi
+    20ce:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  n = heapend - end;
+    20d4:	29 f8                	sub    %edi,%eax
+    20d6:	89 c6                	mov    %eax,%esi
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    20d8:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    20dd:	76 db                	jbe    20ba <trim+0x1a>
+    20df:	83 ec 0c             	sub    $0xc,%esp
+    20e2:	6a 00                	push   $0x0
+    20e4:	e8 8b ef ff ff       	call   1074 <sbrk>
+    20e9:	83 c4 10             	add    $0x10,%esp
+    20ec:	39 05 60 3e 00 00    	cmp    %eax,0x3e60
+    20f2:	75 c6                	jne    20ba <trim+0x1a>
+    20f4:	89 f0                	mov    %esi,%eax
+    20f6:	83 ec 0c             	sub    $0xc,%esp
+    20f9:	f7 d8                	neg    %eax
+    20fb:	50                   	push   %eax
+    20fc:	e8 73 ef ff ff       	call   1074 <sbrk>
+    2101:	83 c4 10             	add    $0x10,%esp
+    2104:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2107:	74 b1                	je     20ba <trim+0x1a>
+    bp->s.size -= n / sizeof(Header);
+    2109:	89 f0                	mov    %esi,%eax
+    heapend = end;
+    210b:	89 3d 60 3e 00 00    	mov    %edi,0x3e60
+    bp->s.size -= n / sizeof(Header);
+    2111:	c1 e8 03             	shr    $0x3,%eax
+    2114:	29 43 04             	sub    %eax,0x4(%ebx)
+    heapend = end;
+    2117:	eb a1                	jmp    20ba <trim+0x1a>
+    2119:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002120 <bigalloc>:
+}
+
+// Allocate a big block of nunits units. Caller holds lock.
+static Header*
+bigalloc(uint nunits)
+{
+    2120:	55                   	push   %ebp
+    2121:	89 e5                	mov    %esp,%ebp
+    2123:	57                   	push   %edi
+    2124:	89 c7                	mov    %eax,%edi
+    2126:	56                   	push   %esi
+    2127:	53                   	push   %ebx
+    2128:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    212b:	a1 64 3e 00 00       	mov    0x3e64,%eax
+    2130:	85 c0                	test   %eax,%eax
+    2132:	0f 84 98 00 00 00    	je     21d0 <bigalloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2138:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    213a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    213d:	39 f9                	cmp    %edi,%ecx
+    213f:	73 67                	jae    21a8 <bigalloc+0x88>
+  if(nu < 4096)
+    2141:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    2146:	39 df                	cmp    %ebx,%edi
+    2148:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    214b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    2152:	eb 0d                	jmp    2161 <bigalloc+0x41>
+    2154:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2158:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    215a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    215d:	39 f9                	cmp    %edi,%ecx
+    215f:	73 47                	jae    21a8 <bigalloc+0x88>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    2161:	89 d0                	mov    %edx,%eax
+    2163:	39 15 64 3e 00 00    	cmp    %edx,0x3e64
+    2169:	75 ed                	jne    2158 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    216b:	83 ec 0c             	sub    $0xc,%esp
+    216e:	56                   	push   %esi
+    216f:	e8 00 ef ff ff       	call   1074 <sbrk>
+  if(p == (char*)-1)
+    2174:	83 c4 10             	add    $0x10,%esp
+    2177:	83 f8 ff             	cmp    $0xffffffff,%eax
+    217a:	74 1a                	je     2196 <bigalloc+0x76>
+  hp->s.size = nu;
+    217c:	89 58 04             	mov    %ebx,0x4(%eax)
+  heapend = p + nu * sizeof(Header);
+    217f:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    2182:	89 15 60 3e 00 00    	mov    %edx,0x3e60
+  bigfree(hp);
+    2188:	e8 93 fe ff ff       	call   2020 <bigfree>
+  return freep;
+    218d:	a1 64 3e 00 00       	mov    0x3e64,%eax
+      if((p = morecore(nunits)) == 0)
+    2192:	85 c0                	test   %eax,%eax
+    2194:	75 c2                	jne    2158 <bigalloc+0x38>
+        return 0;
+  }
+}
+    2196:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    2199:	31 d2                	xor    %edx,%edx
+}
+    219b:	5b                   	pop    %ebx
+    219c:	89 d0                	mov    %edx,%eax
+    219e:	5e                   	pop    %esi
+    219f:	5f                   	pop    %edi
+    21a0:	5d                   	pop    %ebp
+    21a1:	c3                   	ret
+    21a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    21a8:	39 cf                	cmp    %ecx,%edi
+    21aa:	74 54                	je     2200 <bigalloc+0xe0>
+        p->s.size -= nunits;
+    21ac:	29 f9                	sub    %edi,%ecx
+    21ae:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    21b1:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    21b4:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    21b7:	a3 64 3e 00 00       	mov    %eax,0x3e64
+}
+    21bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    21bf:	89 d0                	mov    %edx,%eax
+    21c1:	5b                   	pop    %ebx
+    21c2:	5e                   	pop    %esi
+    21c3:	5f                   	pop    %edi
+    21c4:	5d                   	pop    %ebp
+    21c5:	c3                   	ret
+    21c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    21cd:	8d 76 00             	lea    0x0(%esi),%esi
+    base.s.ptr = freep = prevp = &base;
+    21d0:	c7 05 64 3e 00 00 68 	movl   $0x3e68,0x3e64
+    21d7:	3e 00 00 
+    base.s.size = 0;
+    21da:	ba 68 3e 00 00       	mov    $0x3e68,%edx
+    base.s.ptr = freep = prevp = &base;
+    21df:	c7 05 68 3e 00 00 68 	movl   $0x3e68,0x3e68
+    21e6:	3e 00 00 
+    base.s.size = 0;
+    21e9:	c7 05 6c 3e 00 00 00 	movl   $0x0,0x3e6c
+    21f0:	00 00 00 
+    if(p->s.size >= nunits){
+    21f3:	e9 49 ff ff ff       	jmp    2141 <bigalloc+0x21>
+    21f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    21ff:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    2200:	8b 0a                	mov    (%edx),%ecx
+    2202:	89 08                	mov    %ecx,(%eax)
+    2204:	eb b1                	jmp    21b7 <bigalloc+0x97>
+    2206:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    220d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002210 <drain>:
+}
+
+// Move n blocks of class c from cache tc to the shared list.
+static void
+drain(struct tcache *tc, int c, int n)
+{
+    2210:	55                   	push   %ebp
+    2211:	89 e5                	mov    %esp,%ebp
+    2213:	57                   	push   %edi
+    2214:	89 c7                	mov    %eax,%edi
+    2216:	56                   	push   %esi
+    2217:	89 d6                	mov    %edx,%esi
+    2219:	53                   	push   %ebx
+    221a:	89 cb                	mov    %ecx,%ebx
+    221c:	83 ec 0c             	sub    $0xc,%esp
+  if(threaded)
+    221f:	8b 15 e4 3d 00 00    	mov    0x3de4,%edx
+    2225:	85 d2                	test   %edx,%edx
+    2227:	75 57                	jne    2280 <drain+0x70>
+  Header *p;
+
+  acquire();
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    2229:	85 c9                	test   %ecx,%ecx
+    222b:	7e 49                	jle    2276 <drain+0x66>
+    222d:	89 d9                	mov    %ebx,%ecx
+    222f:	8d 14 b7             	lea    (%edi,%esi,4),%edx
+    2232:	eb 23                	jmp    2257 <drain+0x47>
+    2234:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    tc->list[c] = p->s.ptr;
+    2238:	8b 18                	mov    (%eax),%ebx
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    223a:	83 e9 01             	sub    $0x1,%ecx
+    tc->n[c]--;
+    223d:	83 6a 20 01          	subl   $0x1,0x20(%edx)
+    tc->list[c] = p->s.ptr;
+    2241:	89 1a                	mov    %ebx,(%edx)
+    p->s.ptr = small[c];
+    2243:	8b 1c b5 40 3e 00 00 	mov    0x3e40(,%esi,4),%ebx
+    224a:	89 18                	mov    %ebx,(%eax)
+    small[c] = p;
+    224c:	89 04 b5 40 3e 00 00 	mov    %eax,0x3e40(,%esi,4)
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    2253:	85 c9                	test   %ecx,%ecx
+    2255:	7e 06                	jle    225d <drain+0x4d>
+    2257:	8b 02                	mov    (%edx),%eax
+    2259:	85 c0                	test   %eax,%eax
+    225b:	75 db                	jne    2238 <drain+0x28>
+  if(threaded)
+    225d:	a1 e4 3d 00 00       	mov    0x3de4,%eax
+    2262:	85 c0                	test   %eax,%eax
+    2264:	74 10                	je     2276 <drain+0x66>
+    mutex_unlock(&lock);
+    2266:	83 ec 0c             	sub    $0xc,%esp
+    2269:	68 e8 3d 00 00       	push   $0x3de8
+    226e:	e8 1d ec ff ff       	call   e90 <mutex_unlock>
+}
+    2273:	83 c4 10             	add    $0x10,%esp
+  }
+  release();
+}
+    2276:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2279:	5b                   	pop    %ebx
+    227a:	5e                   	pop    %esi
+    227b:	5f                   	pop    %edi
+    227c:	5d                   	pop    %ebp
+    227d:	c3                   	ret
+    227e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&lock);
+    2280:	83 ec 0c             	sub    $0xc,%esp
+    2283:	68 e8 3d 00 00       	push   $0x3de8
+    2288:	e8 b3 eb ff ff       	call   e40 <mutex_lock>
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    228d:	83 c4 10             	add    $0x10,%esp
+    2290:	85 db                	test   %ebx,%ebx
+    2292:	7f 99                	jg     222d <drain+0x1d>
+    2294:	eb c7                	jmp    225d <drain+0x4d>
+    2296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    229d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000022a0 <mycache>:
+{
+    22a0:	55                   	push   %ebp
+    return &maincache;
+    22a1:	b8 00 3e 00 00       	mov    $0x3e00,%eax
+{
+    22a6:	89 e5                	mov    %esp,%ebp
+    22a8:	53                   	push   %ebx
+  sp = PGROUNDDOWN((uint)&sp);
+    22a9:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+    22ac:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+    22b2:	83 ec 14             	sub    $0x14,%esp
+  if(!threaded || sp == mainstack)
+    22b5:	8b 0d e4 3d 00 00    	mov    0x3de4,%ecx
+  sp = PGROUNDDOWN((uint)&sp);
+    22bb:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  if(!threaded || sp == mainstack)
+    22be:	85 c9                	test   %ecx,%ecx
+    22c0:	74 0f                	je     22d1 <mycache+0x31>
+    22c2:	3b 1d e0 3d 00 00    	cmp    0x3de0,%ebx
+    22c8:	74 07                	je     22d1 <mycache+0x31>
+  if(*cp == 0){
+    22ca:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    22cd:	85 c0                	test   %eax,%eax
+    22cf:	74 0f                	je     22e0 <mycache+0x40>
+}
+    22d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    22d4:	c9                   	leave
+    22d5:	c3                   	ret
+    22d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    22dd:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    22e0:	83 ec 0c             	sub    $0xc,%esp
+    22e3:	68 e8 3d 00 00       	push   $0x3de8
+    22e8:	e8 53 eb ff ff       	call   e40 <mutex_lock>
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    22ed:	b8 09 00 00 00       	mov    $0x9,%eax
+    22f2:	e8 29 fe ff ff       	call   2120 <bigalloc>
+  if(threaded)
+    22f7:	8b 15 e4 3d 00 00    	mov    0x3de4,%edx
+    22fd:	83 c4 10             	add    $0x10,%esp
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    2300:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(threaded)
+    2303:	85 d2                	test   %edx,%edx
+    2305:	75 29                	jne    2330 <mycache+0x90>
+    if(*cp == 0)
+    2307:	85 c0                	test   %eax,%eax
+    2309:	74 c6                	je     22d1 <mycache+0x31>
+    memset(*cp, 0, sizeof(**cp));
+    230b:	83 ec 04             	sub    $0x4,%esp
+    *cp = (struct tcache*)((Header*)*cp + 1);
+    230e:	83 c0 08             	add    $0x8,%eax
+    2311:	89 43 f8             	mov    %eax,-0x8(%ebx)
+    memset(*cp, 0, sizeof(**cp));
+    2314:	6a 40                	push   $0x40
+    2316:	6a 00                	push   $0x0
+    2318:	50                   	push   %eax
+    2319:	e8 f2 e9 ff ff       	call   d10 <memset>
+  return *cp;
+    231e:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    2321:	83 c4 10             	add    $0x10,%esp
+    2324:	eb ab                	jmp    22d1 <mycache+0x31>
+    2326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    232d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    2330:	83 ec 0c             	sub    $0xc,%esp
+    2333:	68 e8 3d 00 00       	push   $0x3de8
+    2338:	e8 53 eb ff ff       	call   e90 <mutex_unlock>
+    if(*cp == 0)
+    233d:	8b 43 f8             	mov    -0x8(%ebx),%eax
+}
+    2340:	83 c4 10             	add    $0x10,%esp
+    2343:	eb c2                	jmp    2307 <mycache+0x67>
+    2345:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    234c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00002350 <free>:
+
+void
+free(void *ap)
+{
+    2350:	55                   	push   %ebp
+    2351:	89 e5                	mov    %esp,%ebp
+    2353:	57                   	push   %edi
+    2354:	56                   	push   %esi
+    2355:	53                   	push   %ebx
+    2356:	83 ec 1c             	sub    $0x1c,%esp
+    2359:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  struct tcache *tc;
+  int c;
+
+  if(ap == 0)
+    235c:	85 f6                	test   %esi,%esi
+    235e:	74 51                	je     23b1 <free+0x61>
+    return;
+  bp = (Header*)ap - 1;
+    2360:	8d 46 f8             	lea    -0x8(%esi),%eax
+    2363:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(bp->s.size > SMALLMAX / sizeof(Header)){
+    2366:	8b 46 fc             	mov    -0x4(%esi),%eax
+    2369:	3d 00 01 00 00       	cmp    $0x100,%eax
+    236e:	77 50                	ja     23c0 <free+0x70>
+    acquire();
+    trim(bigfree(bp));
+    release();
+    return;
+  }
+  for(c = 0; (2 << c) < bp->s.size; c++)
+    2370:	31 db                	xor    %ebx,%ebx
+    2372:	ba 02 00 00 00       	mov    $0x2,%edx
+    2377:	83 f8 02             	cmp    $0x2,%eax
+    237a:	76 11                	jbe    238d <free+0x3d>
+    237c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2380:	83 c3 01             	add    $0x1,%ebx
+    2383:	89 d7                	mov    %edx,%edi
+    2385:	89 d9                	mov    %ebx,%ecx
+    2387:	d3 e7                	shl    %cl,%edi
+    2389:	39 c7                	cmp    %eax,%edi
+    238b:	72 f3                	jb     2380 <free+0x30>
+    ;
+  if((tc = mycache()) == 0){
+    238d:	e8 0e ff ff ff       	call   22a0 <mycache>
+    2392:	85 c0                	test   %eax,%eax
+    2394:	74 7a                	je     2410 <free+0xc0>
+    bp->s.ptr = small[c];
+    small[c] = bp;
+    release();
+    return;
+  }
+  bp->s.ptr = tc->list[c];
+    2396:	8d 0c 98             	lea    (%eax,%ebx,4),%ecx
+    2399:	8b 11                	mov    (%ecx),%edx
+    239b:	89 56 f8             	mov    %edx,-0x8(%esi)
+  tc->list[c] = bp;
+    239e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    23a1:	89 31                	mov    %esi,(%ecx)
+  if(++tc->n[c] > TCACHEMAX)
+    23a3:	8b 71 20             	mov    0x20(%ecx),%esi
+    23a6:	8d 56 01             	lea    0x1(%esi),%edx
+    23a9:	89 51 20             	mov    %edx,0x20(%ecx)
+    23ac:	83 fa 20             	cmp    $0x20,%edx
+    23af:	7f 47                	jg     23f8 <free+0xa8>
+    drain(tc, c, BATCH);
+}
+    23b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    23b4:	5b                   	pop    %ebx
+    23b5:	5e                   	pop    %esi
+    23b6:	5f                   	pop    %edi
+    23b7:	5d                   	pop    %ebp
+    23b8:	c3                   	ret
+    23b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    23c0:	8b 1d e4 3d 00 00    	mov    0x3de4,%ebx
+    23c6:	85 db                	test   %ebx,%ebx
+    23c8:	75 66                	jne    2430 <free+0xe0>
+    trim(bigfree(bp));
+    23ca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    23cd:	e8 4e fc ff ff       	call   2020 <bigfree>
+    23d2:	e8 c9 fc ff ff       	call   20a0 <trim>
+  if(threaded)
+    23d7:	8b 0d e4 3d 00 00    	mov    0x3de4,%ecx
+    23dd:	85 c9                	test   %ecx,%ecx
+    23df:	74 d0                	je     23b1 <free+0x61>
+    mutex_unlock(&lock);
+    23e1:	c7 45 08 e8 3d 00 00 	movl   $0x3de8,0x8(%ebp)
+}
+    23e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    23eb:	5b                   	pop    %ebx
+    23ec:	5e                   	pop    %esi
+    23ed:	5f                   	pop    %edi
+    23ee:	5d                   	pop    %ebp
+    mutex_unlock(&lock);
+    23ef:	e9 9c ea ff ff       	jmp    e90 <mutex_unlock>
+    23f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    23f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    drain(tc, c, BATCH);
+    23fb:	89 da                	mov    %ebx,%edx
+    23fd:	b9 10 00 00 00       	mov    $0x10,%ecx
+}
+    2402:	5b                   	pop    %ebx
+    2403:	5e                   	pop    %esi
+    2404:	5f                   	pop    %edi
+    2405:	5d                   	pop    %ebp
+    drain(tc, c, BATCH);
+    2406:	e9 05 fe ff ff       	jmp    2210 <drain>
+    240b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    240f:	90                   	nop
+  if(threaded)
+    2410:	8b 15 e4 3d 00 00    	mov    0x3de4,%edx
+    2416:	85 d2                	test   %edx,%edx
+    2418:	75 28                	jne    2442 <free+0xf2>
+    bp->s.ptr = small[c];
+    241a:	8b 04 9d 40 3e 00 00 	mov    0x3e40(,%ebx,4),%eax
+    2421:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    2424:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    2427:	89 04 9d 40 3e 00 00 	mov    %eax,0x3e40(,%ebx,4)
+  if(threaded)
+    242e:	eb 81                	jmp    23b1 <free+0x61>
+    mutex_lock(&lock);
+    2430:	83 ec 0c             	sub    $0xc,%esp
+    2433:	68 e8 3d 00 00       	push   $0x3de8
+    2438:	e8 03 ea ff ff       	call   e40 <mutex_lock>
+}
+    243d:	83 c4 10             	add    $0x10,%esp
+    2440:	eb 88                	jmp    23ca <free+0x7a>
+    mutex_lock(&lock);
+    2442:	83 ec 0c             	sub    $0xc,%esp
+    2445:	68 e8 3d 00 00       	push   $0x3de8
+    244a:	e8 f1 e9 ff ff       	call   e40 <mutex_lock>
+    bp->s.ptr = small[c];
+    244f:	8b 04 9d 40 3e 00 00 	mov    0x3e40(,%ebx,4),%eax
+  if(threaded)
+    2456:	83 c4 10             	add    $0x10,%esp
+    bp->s.ptr = small[c];
+    2459:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    245c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    245f:	89 04 9d 40 3e 00 00 	mov    %eax,0x3e40(,%ebx,4)
+  if(threaded)
+    2466:	a1 e4 3d 00 00       	mov    0x3de4,%eax
+    246b:	85 c0                	test   %eax,%eax
+    246d:	0f 85 6e ff ff ff    	jne    23e1 <free+0x91>
+    2473:	e9 39 ff ff ff       	jmp    23b1 <free+0x61>
+    2478:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    247f:	90                   	nop
+
+00002480 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    2480:	55                   	push   %ebp
+    2481:	89 e5                	mov    %esp,%ebp
+    2483:	57                   	push   %edi
+    2484:	56                   	push   %esi
+    2485:	53                   	push   %ebx
+    2486:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  struct tcache *tc;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2489:	8b 45 08             	mov    0x8(%ebp),%eax
+    248c:	8d 78 07             	lea    0x7(%eax),%edi
+    248f:	c1 ef 03             	shr    $0x3,%edi
+    2492:	83 c7 01             	add    $0x1,%edi
+  if(nunits > SMALLMAX / sizeof(Header)){
+    2495:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+    249b:	77 5b                	ja     24f8 <malloc+0x78>
+    acquire();
+    p = bigalloc(nunits);
+    release();
+    return p ? (void*)(p + 1) : 0;
+  }
+  for(c = 0; (2 << c) < nunits; c++)
+    249d:	31 c9                	xor    %ecx,%ecx
+    249f:	b8 02 00 00 00       	mov    $0x2,%eax
+    24a4:	be 02 00 00 00       	mov    $0x2,%esi
+    24a9:	bb 02 00 00 00       	mov    $0x2,%ebx
+    24ae:	83 ff 02             	cmp    $0x2,%edi
+    24b1:	76 12                	jbe    24c5 <malloc+0x45>
+    24b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    24b7:	90                   	nop
+    24b8:	83 c1 01             	add    $0x1,%ecx
+    24bb:	89 c3                	mov    %eax,%ebx
+    24bd:	d3 e3                	shl    %cl,%ebx
+    24bf:	89 de                	mov    %ebx,%esi
+    24c1:	39 fb                	cmp    %edi,%ebx
+    24c3:	72 f3                	jb     24b8 <malloc+0x38>
+    24c5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    ;
+  if((tc = mycache()) == 0)
+    24c8:	e8 d3 fd ff ff       	call   22a0 <mycache>
+    24cd:	85 c0                	test   %eax,%eax
+    24cf:	74 51                	je     2522 <malloc+0xa2>
+    return 0;
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    24d1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    24d4:	8d 3c 88             	lea    (%eax,%ecx,4),%edi
+    24d7:	8b 07                	mov    (%edi),%eax
+    24d9:	85 c0                	test   %eax,%eax
+    24db:	74 53                	je     2530 <malloc+0xb0>
+    return 0;
+  p = tc->list[c];
+  tc->list[c] = p->s.ptr;
+  tc->n[c]--;
+    24dd:	8b 57 20             	mov    0x20(%edi),%edx
+  tc->list[c] = p->s.ptr;
+    24e0:	8b 08                	mov    (%eax),%ecx
+  tc->n[c]--;
+    24e2:	83 ea 01             	sub    $0x1,%edx
+  return (void*)(p + 1);
+    24e5:	83 c0 08             	add    $0x8,%eax
+  tc->n[c]--;
+    24e8:	89 57 20             	mov    %edx,0x20(%edi)
+  tc->list[c] = p->s.ptr;
+    24eb:	89 0f                	mov    %ecx,(%edi)
+}
+    24ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    24f0:	5b                   	pop    %ebx
+    24f1:	5e                   	pop    %esi
+    24f2:	5f                   	pop    %edi
+    24f3:	5d                   	pop    %ebp
+    24f4:	c3                   	ret
+    24f5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    24f8:	a1 e4 3d 00 00       	mov    0x3de4,%eax
+    24fd:	85 c0                	test   %eax,%eax
+    24ff:	0f 85 b3 00 00 00    	jne    25b8 <malloc+0x138>
+    p = bigalloc(nunits);
+    2505:	89 f8                	mov    %edi,%eax
+    2507:	e8 14 fc ff ff       	call   2120 <bigalloc>
+    250c:	89 c3                	mov    %eax,%ebx
+  if(threaded)
+    250e:	a1 e4 3d 00 00       	mov    0x3de4,%eax
+    2513:	85 c0                	test   %eax,%eax
+    2515:	0f 85 85 00 00 00    	jne    25a0 <malloc+0x120>
+    return p ? (void*)(p + 1) : 0;
+    251b:	8d 43 08             	lea    0x8(%ebx),%eax
+    251e:	85 db                	test   %ebx,%ebx
+    2520:	75 cb                	jne    24ed <malloc+0x6d>
+    2522:	31 c0                	xor    %eax,%eax
+}
+    2524:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2527:	5b                   	pop    %ebx
+    2528:	5e                   	pop    %esi
+    2529:	5f                   	pop    %edi
+    252a:	5d                   	pop    %ebp
+    252b:	c3                   	ret
+    252c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    2530:	a1 e4 3d 00 00       	mov    0x3de4,%eax
+    2535:	85 c0                	test   %eax,%eax
+    2537:	0f 85 29 01 00 00    	jne    2666 <malloc+0x1e6>
+  if(small[c] == 0){
+    253d:	8b 04 8d 40 3e 00 00 	mov    0x3e40(,%ecx,4),%eax
+    2544:	85 c0                	test   %eax,%eax
+    2546:	0f 84 81 00 00 00    	je     25cd <malloc+0x14d>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    254c:	31 db                	xor    %ebx,%ebx
+    254e:	eb 22                	jmp    2572 <malloc+0xf2>
+    small[c] = p->s.ptr;
+    2550:	8b 10                	mov    (%eax),%edx
+  for(moved = 0; moved < n && small[c]; moved++){
+    2552:	83 c3 01             	add    $0x1,%ebx
+    small[c] = p->s.ptr;
+    2555:	89 14 8d 40 3e 00 00 	mov    %edx,0x3e40(,%ecx,4)
+    p->s.ptr = tc->list[c];
+    255c:	8b 17                	mov    (%edi),%edx
+    255e:	89 10                	mov    %edx,(%eax)
+    tc->list[c] = p;
+    2560:	89 07                	mov    %eax,(%edi)
+  for(moved = 0; moved < n && small[c]; moved++){
+    2562:	83 fb 10             	cmp    $0x10,%ebx
+    2565:	0f 84 e2 00 00 00    	je     264d <malloc+0x1cd>
+    256b:	8b 04 8d 40 3e 00 00 	mov    0x3e40(,%ecx,4),%eax
+    2572:	85 c0                	test   %eax,%eax
+    2574:	75 da                	jne    2550 <malloc+0xd0>
+  if(threaded)
+    2576:	8b 15 e4 3d 00 00    	mov    0x3de4,%edx
+    257c:	85 d2                	test   %edx,%edx
+    257e:	0f 85 b4 00 00 00    	jne    2638 <malloc+0x1b8>
+  tc->n[c] += moved;
+    2584:	8b 57 20             	mov    0x20(%edi),%edx
+    2587:	01 da                	add    %ebx,%edx
+    2589:	89 57 20             	mov    %edx,0x20(%edi)
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    258c:	85 db                	test   %ebx,%ebx
+    258e:	74 92                	je     2522 <malloc+0xa2>
+  p = tc->list[c];
+    2590:	8b 07                	mov    (%edi),%eax
+    2592:	e9 49 ff ff ff       	jmp    24e0 <malloc+0x60>
+    2597:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    259e:	66 90                	xchg   %ax,%ax
+    mutex_unlock(&lock);
+    25a0:	83 ec 0c             	sub    $0xc,%esp
+    25a3:	68 e8 3d 00 00       	push   $0x3de8
+    25a8:	e8 e3 e8 ff ff       	call   e90 <mutex_unlock>
+}
+    25ad:	83 c4 10             	add    $0x10,%esp
+    25b0:	e9 66 ff ff ff       	jmp    251b <malloc+0x9b>
+    25b5:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    25b8:	83 ec 0c             	sub    $0xc,%esp
+    25bb:	68 e8 3d 00 00       	push   $0x3de8
+    25c0:	e8 7b e8 ff ff       	call   e40 <mutex_lock>
+}
+    25c5:	83 c4 10             	add    $0x10,%esp
+    25c8:	e9 38 ff ff ff       	jmp    2505 <malloc+0x85>
+    if((chunk = bigalloc(CHUNK / sizeof(Header) + 1)) == 0){
+    25cd:	b8 01 02 00 00       	mov    $0x201,%eax
+    25d2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    25d5:	e8 46 fb ff ff       	call   2120 <bigalloc>
+    25da:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    25dd:	85 c0                	test   %eax,%eax
+    25df:	89 c2                	mov    %eax,%edx
+    25e1:	0f 84 ba 00 00 00    	je     26a1 <malloc+0x221>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    25e7:	83 c2 08             	add    $0x8,%edx
+    25ea:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+    25f0:	0f 87 d0 00 00 00    	ja     26c6 <malloc+0x246>
+    25f6:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+    25fd:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    2600:	89 df                	mov    %ebx,%edi
+    2602:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    2605:	8d 76 00             	lea    0x0(%esi),%esi
+      p->s.size = units;
+    2608:	89 72 04             	mov    %esi,0x4(%edx)
+      p->s.ptr = small[c];
+    260b:	8b 04 8d 40 3e 00 00 	mov    0x3e40(,%ecx,4),%eax
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    2612:	01 df                	add    %ebx,%edi
+    2614:	89 55 e0             	mov    %edx,-0x20(%ebp)
+      p->s.ptr = small[c];
+    2617:	89 02                	mov    %eax,(%edx)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    2619:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      small[c] = p;
+    261c:	89 14 8d 40 3e 00 00 	mov    %edx,0x3e40(,%ecx,4)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    2623:	01 c2                	add    %eax,%edx
+    2625:	81 ff 00 02 00 00    	cmp    $0x200,%edi
+    262b:	76 db                	jbe    2608 <malloc+0x188>
+    262d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    2630:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    2633:	e9 14 ff ff ff       	jmp    254c <malloc+0xcc>
+    mutex_unlock(&lock);
+    2638:	83 ec 0c             	sub    $0xc,%esp
+    263b:	68 e8 3d 00 00       	push   $0x3de8
+    2640:	e8 4b e8 ff ff       	call   e90 <mutex_unlock>
+}
+    2645:	83 c4 10             	add    $0x10,%esp
+    2648:	e9 37 ff ff ff       	jmp    2584 <malloc+0x104>
+  if(threaded)
+    264d:	a1 e4 3d 00 00       	mov    0x3de4,%eax
+    2652:	85 c0                	test   %eax,%eax
+    2654:	75 2b                	jne    2681 <malloc+0x201>
+  tc->n[c] += moved;
+    2656:	8b 47 20             	mov    0x20(%edi),%eax
+    2659:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    265c:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    265e:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    2661:	e9 7a fe ff ff       	jmp    24e0 <malloc+0x60>
+    mutex_lock(&lock);
+    2666:	83 ec 0c             	sub    $0xc,%esp
+    2669:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    266c:	68 e8 3d 00 00       	push   $0x3de8
+    2671:	e8 ca e7 ff ff       	call   e40 <mutex_lock>
+}
+    2676:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    2679:	83 c4 10             	add    $0x10,%esp
+    267c:	e9 bc fe ff ff       	jmp    253d <malloc+0xbd>
+    mutex_unlock(&lock);
+    2681:	83 ec 0c             	sub    $0xc,%esp
+    2684:	68 e8 3d 00 00       	push   $0x3de8
+    2689:	e8 02 e8 ff ff       	call   e90 <mutex_unlock>
+  tc->n[c] += moved;
+    268e:	8b 47 20             	mov    0x20(%edi),%eax
+    2691:	83 c4 10             	add    $0x10,%esp
+    2694:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    2697:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    2699:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    269c:	e9 3f fe ff ff       	jmp    24e0 <malloc+0x60>
+  if(threaded)
+    26a1:	8b 0d e4 3d 00 00    	mov    0x3de4,%ecx
+    26a7:	85 c9                	test   %ecx,%ecx
+    26a9:	0f 84 73 fe ff ff    	je     2522 <malloc+0xa2>
+    mutex_unlock(&lock);
+    26af:	83 ec 0c             	sub    $0xc,%esp
+    26b2:	68 e8 3d 00 00       	push   $0x3de8
+    26b7:	e8 d4 e7 ff ff       	call   e90 <mutex_unlock>
+    26bc:	83 c4 10             	add    $0x10,%esp
+    return p ? (void*)(p + 1) : 0;
+    26bf:	31 c0                	xor    %eax,%eax
+    26c1:	e9 5e fe ff ff       	jmp    2524 <malloc+0xa4>
+  for(moved = 0; moved < n && small[c]; moved++){
+    26c6:	8b 04 8d 40 3e 00 00 	mov    0x3e40(,%ecx,4),%eax
+    26cd:	e9 7a fe ff ff       	jmp    254c <malloc+0xcc>
+    26d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    26d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000026e0 <malloc_threaded>:
+void
+malloc_threaded(void)
+{
+  uint sp;
+
+  if(threaded)
+    26e0:	a1 e4 3d 00 00       	mov    0x3de4,%eax
+    26e5:	85 c0                	test   %eax,%eax
+    26e7:	74 07                	je     26f0 <malloc_threaded+0x10>
+    26e9:	c3                   	ret
+    26ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+{
+    26f0:	55                   	push   %ebp
+    26f1:	89 e5                	mov    %esp,%ebp
+    26f3:	83 ec 24             	sub    $0x24,%esp
+    return;
+  mutex_init(&lock);
+    26f6:	68 e8 3d 00 00       	push   $0x3de8
+    26fb:	e8 30 e7 ff ff       	call   e30 <mutex_init>
+  mainstack = PGROUNDDOWN((uint)&sp);
+    2700:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    2703:	83 c4 10             	add    $0x10,%esp
+  threaded = 1;
+    2706:	c7 05 e4 3d 00 00 01 	movl   $0x1,0x3de4
+    270d:	00 00 00 
+  mainstack = PGROUNDDOWN((uint)&sp);
+    2710:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    2715:	a3 e0 3d 00 00       	mov    %eax,0x3de0
+}
+    271a:	c9                   	leave
+    271b:	c3                   	ret
+    271c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00002720 <malloc_thread_exit>:
+
+// Called by thread_join() with the cache slot of a finished
+// thread: give its blocks, and the cache itself, back.
+void
+malloc_thread_exit(void **cachep)
+{
+    2720:	55                   	push   %ebp
+    2721:	89 e5                	mov    %esp,%ebp
+    2723:	57                   	push   %edi
+    2724:	56                   	push   %esi
+    2725:	53                   	push   %ebx
+    2726:	83 ec 0c             	sub    $0xc,%esp
+    2729:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct tcache *tc;
+  int c;
+
+  if((tc = *cachep) == 0)
+    272c:	8b 37                	mov    (%edi),%esi
+    272e:	85 f6                	test   %esi,%esi
+    2730:	74 41                	je     2773 <malloc_thread_exit+0x53>
+    return;
+  for(c = 0; c < NCLASS; c++)
+    2732:	31 db                	xor    %ebx,%ebx
+    2734:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    drain(tc, c, tc->n[c]);
+    2738:	8b 4c 9e 20          	mov    0x20(%esi,%ebx,4),%ecx
+    273c:	89 da                	mov    %ebx,%edx
+    273e:	89 f0                	mov    %esi,%eax
+  for(c = 0; c < NCLASS; c++)
+    2740:	83 c3 01             	add    $0x1,%ebx
+    drain(tc, c, tc->n[c]);
+    2743:	e8 c8 fa ff ff       	call   2210 <drain>
+  for(c = 0; c < NCLASS; c++)
+    2748:	83 fb 08             	cmp    $0x8,%ebx
+    274b:	75 eb                	jne    2738 <malloc_thread_exit+0x18>
+  if(threaded)
+    274d:	8b 15 e4 3d 00 00    	mov    0x3de4,%edx
+    2753:	85 d2                	test   %edx,%edx
+    2755:	75 29                	jne    2780 <malloc_thread_exit+0x60>
+  acquire();
+  trim(bigfree((Header*)tc - 1));
+    2757:	8d 46 f8             	lea    -0x8(%esi),%eax
+    275a:	e8 c1 f8 ff ff       	call   2020 <bigfree>
+    275f:	e8 3c f9 ff ff       	call   20a0 <trim>
+  if(threaded)
+    2764:	a1 e4 3d 00 00       	mov    0x3de4,%eax
+    2769:	85 c0                	test   %eax,%eax
+    276b:	75 2b                	jne    2798 <malloc_thread_exit+0x78>
+  release();
+  *cachep = 0;
+    276d:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+}
+    2773:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2776:	5b                   	pop    %ebx
+    2777:	5e                   	pop    %esi
+    2778:	5f                   	pop    %edi
+    2779:	5d                   	pop    %ebp
+    277a:	c3                   	ret
+    277b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    277f:	90                   	nop
+    mutex_lock(&lock);
+    2780:	83 ec 0c             	sub    $0xc,%esp
+    2783:	68 e8 3d 00 00       	push   $0x3de8
+    2788:	e8 b3 e6 ff ff       	call   e40 <mutex_lock>
+}
+    278d:	83 c4 10             	add    $0x10,%esp
+    2790:	eb c5                	jmp    2757 <malloc_thread_exit+0x37>
+    2792:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    2798:	83 ec 0c             	sub    $0xc,%esp
+    279b:	68 e8 3d 00 00       	push   $0x3de8
+    27a0:	e8 eb e6 ff ff       	call   e90 <mutex_unlock>
+}
+    27a5:	83 c4 10             	add    $0x10,%esp
+    27a8:	eb c3                	jmp    276d <malloc_thread_exit+0x4d>
+    27aa:	66 90                	xchg   %ax,%ax
+    27ac:	66 90                	xchg   %ax,%ax
+    27ae:	66 90                	xchg   %ax,%ax
+
+000027b0 <thread_create>:
+
+// Start fn(arg) in a new thread on a freshly allocated
+// page-aligned stack.  Returns the thread's pid.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    27b0:	55                   	push   %ebp
+    27b1:	89 e5                	mov    %esp,%ebp
+    27b3:	53                   	push   %ebx
+    27b4:	83 ec 14             	sub    $0x14,%esp
+  char *mem, *stack;
+  int pid;
+
+  malloc_threaded();
+    27b7:	e8 24 ff ff ff       	call   26e0 <malloc_threaded>
+  stdio_threaded();
+    27bc:	e8 cf ee ff ff       	call   1690 <stdio_threaded>
+  if((mem = malloc(2*PGSIZE)) == 0)
+    27c1:	83 ec 0c             	sub    $0xc,%esp
+    27c4:	68 00 20 00 00       	push   $0x2000
+    27c9:	e8 b2 fc ff ff       	call   2480 <malloc>
+    27ce:	83 c4 10             	add    $0x10,%esp
+    27d1:	85 c0                	test   %eax,%eax
+    27d3:	74 52                	je     2827 <thread_create+0x77>
+    27d5:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    27d7:	8d 80 07 10 00 00    	lea    0x1007(%eax),%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+  ((char**)stack)[-2] = 0;
+  if((pid = clone(fn, arg, stack)) < 0)
+    27dd:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    27e0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+    27e5:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  ((char**)stack)[-2] = 0;
+    27e8:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+  if((pid = clone(fn, arg, stack)) < 0)
+    27ef:	50                   	push   %eax
+    27f0:	ff 75 0c             	push   0xc(%ebp)
+    27f3:	ff 75 08             	push   0x8(%ebp)
+    27f6:	e8 97 e8 ff ff       	call   1092 <clone>
+    27fb:	83 c4 10             	add    $0x10,%esp
+    27fe:	85 c0                	test   %eax,%eax
+    2800:	78 0e                	js     2810 <thread_create+0x60>
+    free(mem);
+  return pid;
+}
+    2802:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2805:	c9                   	leave
+    2806:	c3                   	ret
+    2807:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    280e:	66 90                	xchg   %ax,%ax
+    free(mem);
+    2810:	83 ec 0c             	sub    $0xc,%esp
+    2813:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    2816:	53                   	push   %ebx
+    2817:	e8 34 fb ff ff       	call   2350 <free>
+    281c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    281f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    2822:	83 c4 10             	add    $0x10,%esp
+}
+    2825:	c9                   	leave
+    2826:	c3                   	ret
+    return -1;
+    2827:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    282c:	eb d4                	jmp    2802 <thread_create+0x52>
+    282e:	66 90                	xchg   %ax,%ax
+
+00002830 <thread_join>:
+
+// Wait for a thread to finish and free its stack.
+int
+thread_join(void)
+{
+    2830:	55                   	push   %ebp
+    2831:	89 e5                	mov    %esp,%ebp
+    2833:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    2834:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    2837:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    283a:	50                   	push   %eax
+    283b:	e8 61 e8 ff ff       	call   10a1 <join>
+    2840:	83 c4 10             	add    $0x10,%esp
+    2843:	85 c0                	test   %eax,%eax
+    2845:	78 29                	js     2870 <thread_join+0x40>
+    2847:	89 c3                	mov    %eax,%ebx
+    return -1;
+  malloc_thread_exit(&((void**)stack)[-2]);
+    2849:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    284c:	83 ec 0c             	sub    $0xc,%esp
+    284f:	83 e8 08             	sub    $0x8,%eax
+    2852:	50                   	push   %eax
+    2853:	e8 c8 fe ff ff       	call   2720 <malloc_thread_exit>
+  free(((char**)stack)[-1]);
+    2858:	58                   	pop    %eax
+    2859:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    285c:	ff 70 fc             	push   -0x4(%eax)
+    285f:	e8 ec fa ff ff       	call   2350 <free>
+  return pid;
+    2864:	83 c4 10             	add    $0x10,%esp
+}
+    2867:	89 d8                	mov    %ebx,%eax
+    2869:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    286c:	c9                   	leave
+    286d:	c3                   	ret
+    286e:	66 90                	xchg   %ax,%ax
+    return -1;
+    2870:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    2875:	eb f0                	jmp    2867 <thread_join+0x37>
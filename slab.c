@@ -0,0 +1,201 @@
+// Object caches for small, fixed-size kernel structures.
+//
+// Each cache carves pages from kalloc() into slabs of equal-size
+// objects; a struct slab header at the start of each page lets
+// kmem_cache_free() find the slab from the object address. Each CPU
+// keeps a small magazine of free objects so that most allocations
+// and frees touch neither the cache lock nor another CPU's memory.
+// A slab page goes back to kalloc() once none of its objects are in
+// use.
+//
+// A cache may have a constructor, which sets up state such as locks
+// once, when a slab page is carved; kmem_cache_alloc() then returns
+// objects as kmem_cache_free() got them instead of zeroing them, and
+// the free-list link lives past the end of each object. A destructor
+// undoes the constructor when the slab page goes back to kalloc().
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+
+#define NCACHE 12    // maximum number of caches
+#define NMAG  16     // free objects per magazine
+
+struct obj {
+    struct obj *next;
+};
+
+struct slab {
+    struct kmem_cache *cache;
+    struct slab *next;           // Next slab with free objects
+    struct obj *free;            // Free objects in this slab
+    int inuse;                   // Objects allocated or in a magazine
+};
+
+struct magazine {
+    int n;
+    void *obj[NMAG];
+};
+
+struct kmem_cache {
+    struct spinlock lock;        // Protects partial and the slabs on it
+    char *name;
+    uint size;                   // Object size
+    uint stride;                 // Bytes per object in a slab
+    uint link;                   // Offset of a free object's link
+    void (*ctor)(void *);        // Constructor, or 0 to zero objects
+    void (*dtor)(void *);        // Destructor, or 0
+    int perslab;                 // Objects per slab page
+    struct slab *partial;        // Slabs with free objects
+    struct magazine mag[NCPU];   // Per-CPU free objects
+};
+
+static struct kmem_cache caches[NCACHE];
+static int ncache;
+
+// Create a cache of objects of the given size, with constructor
+// ctor and destructor dtor if they are not 0. Called only during
+// initialization.
+struct kmem_cache *
+kmem_cache_create(char *name, uint size, void (*ctor)(void *),
+                  void (*dtor)(void *)) {
+    struct kmem_cache *c;
+    uint stride;
+
+    size = (size + 3) & ~3;
+    stride = size;
+    if (ctor)
+        stride += sizeof(struct obj);
+    if (stride < sizeof(struct obj))
+        stride = sizeof(struct obj);
+    if (ncache == NCACHE || stride > PGSIZE - sizeof(struct slab))
+        panic("kmem_cache_create");
+    c = &caches[ncache++];
+    initlock(&c->lock, name);
+    c->name = name;
+    c->size = size;
+    c->stride = stride;
+    c->link = ctor ? size : 0;
+    c->ctor = ctor;
+    c->dtor = dtor;
+    c->perslab = (PGSIZE - sizeof(struct slab)) / stride;
+    c->partial = 0;
+    return c;
+}
+
+// The free-list link of object v, and the object of link o.
+static struct obj *
+objlink(struct kmem_cache *c, void *v) {
+    return (struct obj *) ((char *) v + c->link);
+}
+
+static void *
+linkobj(struct kmem_cache *c, struct obj *o) {
+    return (char *) o - c->link;
+}
+
+// Take an object from a slab. Caller holds c->lock.
+static void *
+slaballoc(struct kmem_cache *c) {
+    struct slab *s;
+    struct obj *o;
+    char *p, *v;
+    int i;
+
+    if ((s = c->partial) == 0) {
+        if ((p = kalloc()) == 0)
+            return 0;
+        s = (struct slab *) p;
+        s->cache = c;
+        s->free = 0;
+        s->inuse = 0;
+        for (i = c->perslab - 1; i >= 0; i--) {
+            v = p + sizeof(struct slab) + i * c->stride;
+            if (c->ctor)
+                c->ctor(v);
+            o = objlink(c, v);
+            o->next = s->free;
+            s->free = o;
+        }
+        s->next = 0;
+        c->partial = s;
+    }
+    o = s->free;
+    s->free = o->next;
+    s->inuse++;
+    if (s->free == 0)
+        c->partial = s->next;
+    return linkobj(c, o);
+}
+
+// Return an object to its slab. Caller holds c->lock.
+static void
+slabfree(struct kmem_cache *c, void *v) {
+    struct slab *s, **pp;
+    struct obj *o;
+    int i;
+
+    s = (struct slab *) PGROUNDDOWN((uint) v);
+    if (s->cache != c)
+        panic("kmem_cache_free");
+    if (s->free == 0) {
+        s->next = c->partial;
+        c->partial = s;
+    }
+    o = objlink(c, v);
+    o->next = s->free;
+    s->free = o;
+    if (--s->inuse == 0) {
+        for (pp = &c->partial; *pp != s; pp = &(*pp)->next)
+            ;
+        *pp = s->next;
+        if (c->dtor)
+            for (i = 0; i < c->perslab; i++)
+                c->dtor((char *) s + sizeof(struct slab) + i * c->stride);
+        kfree((char *) s);
+    }
+}
+
+// Allocate an object from c: zeroed, or constructed if c has a
+// constructor.
+// Returns 0 if the memory cannot be allocated.
+void *
+kmem_cache_alloc(struct kmem_cache *c) {
+    struct magazine *m;
+    void *v;
+
+    pushcli();
+    m = &c->mag[cpuid()];
+    if (m->n == 0) {
+        // Refill half a magazine so the next few allocations
+        // on this CPU need no lock.
+        acquire(&c->lock);
+        while (m->n < NMAG / 2 && (v = slaballoc(c)) != 0)
+            m->obj[m->n++] = v;
+        release(&c->lock);
+    }
+    v = m->n > 0 ? m->obj[--m->n] : 0;
+    popcli();
+    if (v && !c->ctor)
+        memset(v, 0, c->size);
+    return v;
+}
+
+void
+kmem_cache_free(struct kmem_cache *c, void *v) {
+    struct magazine *m;
+
+    pushcli();
+    m = &c->mag[cpuid()];
+    if (m->n == NMAG) {
+        acquire(&c->lock);
+        while (m->n > NMAG / 2)
+            slabfree(c, m->obj[--m->n]);
+        release(&c->lock);
+    }
+    m->obj[m->n++] = v;
+    popcli();
+}
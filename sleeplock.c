@@ -10,22 +10,37 @@
 #include "spinlock.h"
 #include "sleeplock.h"
 
+// Every sleep lock's spinlock has the same name; see initlockstat().
+static struct lockstat *sleepstat;
+
 void
 initsleeplock(struct sleeplock *lk, char *name)
 {
-  initlock(&lk->lk, "sleep lock");
+  initlockstat(&lk->lk, "sleep lock", &sleepstat);
   lk->name = name;
   lk->locked = 0;
+  lk->readers = 0;
+  lk->writers = 0;
   lk->pid = 0;
 }
+
+// Forget lk, whose memory is about to be freed.
+void
+freesleeplock(struct sleeplock *lk)
+{
+  freelock(&lk->lk);
+}
+
 //睡眠锁是一种多进程间的同步机制，在某个进程持有睡眠锁时，其他进程必须等待该进程释放锁后才能获取
 void
 acquiresleep(struct sleeplock *lk)
 {
   acquire(&lk->lk); //相当当前cpu，一个cpu持有
-  while (lk->locked) {//表示锁已经被其他进程获取
+  lk->writers++;
+  while (lk->locked || lk->readers) {//表示锁已经被其他进程获取
     sleep(lk, &lk->lk);
   }
+  lk->writers--;
   lk->locked = 1;
   lk->pid = myproc()->pid;
   release(&lk->lk);
@@ -41,6 +56,31 @@ releasesleep(struct sleeplock *lk)
   release(&lk->lk);
 }
 
+// Acquire the lock in shared mode: any number of readers may
+// hold it at once, but not together with an exclusive holder.
+// New readers wait behind a waiting writer so it cannot starve.
+void
+acquiresleepshared(struct sleeplock *lk)
+{
+  acquire(&lk->lk);
+  while (lk->locked || lk->writers) {
+    sleep(lk, &lk->lk);
+  }
+  lk->readers++;
+  release(&lk->lk);
+}
+
+void
+releasesleepshared(struct sleeplock *lk)
+{
+  acquire(&lk->lk);
+  if (lk->readers < 1)
+    panic("releasesleepshared");
+  if (--lk->readers == 0)
+    wakeup(lk);
+  release(&lk->lk);
+}
+
 int
 holdingsleep(struct sleeplock *lk)
 {
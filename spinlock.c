@@ -8,13 +8,91 @@
 #include "mmu.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "lockstat.h"
 
+// Contention counters, keyed by lock name so that, e.g., all
+// pipe locks accumulate into one entry. Entries are never
+// removed, so their indices are stable for user snapshots.
+static struct {
+    uint locked;       // Guards registration of new names.
+    int n;
+    struct lockstat stat[NLOCKSTAT];
+} lockstats;
+
+// Find or create the statistics entry for name.
+// initlock() runs before mycpu() works, so this uses
+// a bare xchg loop rather than a spinlock.
+static struct lockstat *
+lockstatfor(char *name) {
+    struct lockstat *s;
+
+    while (xchg(&lockstats.locked, 1) != 0);
+    for (s = lockstats.stat; s < &lockstats.stat[lockstats.n]; s++)
+        if (strncmp(s->name, name, sizeof(s->name)) == 0)
+            goto found;
+    if (lockstats.n == NLOCKSTAT) {
+        s = 0;
+        goto found;
+    }
+    s = &lockstats.stat[lockstats.n++];
+    safestrcpy(s->name, name, sizeof(s->name));
+    found:
+    xchg(&lockstats.locked, 0);
+    return s;
+}
+
+// Copy up to n statistics entries to st; return how many.
+int
+getlockstats(struct lockstat *st, int n) {
+    int i;
+
+    for (i = 0; i < n && i < lockstats.n; i++)
+        st[i] = lockstats.stat[i];
+    return i;
+}
 
 void
 initlock(struct spinlock *lk, char *name) {
+    struct lockstat *st;
+
+    st = 0;
+    initlockstat(lk, name, &st);
+}
+
+// Initialize lk as initlock() does, for callers that set up
+// many locks of one name, such as one per object: *st caches
+// the statistics entry, so name is looked up only the first time.
+void
+initlockstat(struct spinlock *lk, char *name, struct lockstat **st) {
+    if (*st == 0)
+        *st = lockstatfor(name);
     lk->name = name;//业务名称
     lk->locked = 0; //空闲状态，没有被获取
     lk->cpu = 0;
+    lk->stat = *st;
+    lk->ticket = 0;
+    lk->next = 0;
+    lk->owner = 0;
+    if (lk->stat)
+        __sync_fetch_and_add(&lk->stat->nlock, 1);
+}
+
+// Drop lk, whose memory is about to be freed, from the
+// count of locks of its name.
+void
+freelock(struct spinlock *lk) {
+    if (lk->stat)
+        __sync_fetch_and_sub(&lk->stat->nlock, 1);
+    lk->stat = 0;
+}
+
+// Initialize a ticket lock: waiters take a number and are
+// served in arrival order, so no CPU can starve, and they spin
+// reading owner rather than bouncing the line with xchg.
+void
+initticketlock(struct spinlock *lk, char *name) {
+    initlock(lk, name);
+    lk->ticket = 1;
 }
 
 // Acquire the lock.
@@ -23,12 +101,24 @@ initlock(struct spinlock *lk, char *name) {
 // other CPUs to waste time spinning to acquire it.
 void
 acquire(struct spinlock *lk) {
+    uint spins, me;
+
     pushcli(); // disable interrupts to avoid deadlock.
     if (holding(lk))
         panic("acquire");
 
-    // The xchg is atomic.
-    while (xchg(&lk->locked, 1) != 0);
+    spins = 0;
+    if (lk->ticket) {
+        // The xadd is atomic.
+        me = __sync_fetch_and_add(&lk->next, 1);
+        while (*(volatile uint *) &lk->owner != me)
+            spins++;
+        lk->locked = 1;
+    } else {
+        // The xchg is atomic.
+        while (xchg(&lk->locked, 1) != 0)
+            spins++;
+    }
     //__sync_synchronize() 是GCC内置函数，用于保证在其前后的内存访问操作按正确的顺序执行，并且不会被编译器优化掉。
     //具体来说，__sync_synchronize() 会生成一个完整的内存屏障（memory barrier），它确保了在这个屏障之前和之后的所有内存读写操作都是按照程序代码中的顺序执行的，而不会受到编译器或CPU的重排或优化的影响。
     //使用 __sync_synchronize() 可以有效地避免多线程编程中出现的一些常见问题，例如数据竞争、缓存一致性等。但需要注意的是，过度依赖内存屏障可能会导致性能问题，因此需要根据具体的业务场景和需求进行权衡和选择。
@@ -37,14 +127,33 @@ acquire(struct spinlock *lk) {
     // Record info about lock acquisition for debugging.
     lk->cpu = mycpu();
     getcallerpcs(&lk, lk->pcs);
+
+    // Other locks with the same name may be held on other CPUs,
+    // so the shared counters need atomic updates.
+    if (lk->stat) {
+        __sync_fetch_and_add(&lk->stat->nacquire, 1);
+        if (spins) {
+            __sync_fetch_and_add(&lk->stat->ncontend, 1);
+            __sync_fetch_and_add(&lk->stat->nspin, spins);
+        }
+    }
+    lk->tsc = rdtsc();
 }
 
 // Release the lock.
 void
 release(struct spinlock *lk) {
+    uint held, max;
+
     if (!holding(lk))
         panic("release");
 
+    if (lk->stat) {
+        held = rdtsc() - lk->tsc;
+        while ((max = lk->stat->maxhold) < held &&
+               __sync_val_compare_and_swap(&lk->stat->maxhold, max, held) != max);
+    }
+
     lk->pcs[0] = 0;
     lk->cpu = 0;
 
@@ -60,6 +169,10 @@ release(struct spinlock *lk) {
     // not be atomic. A real OS would use C atomics here.
     asm volatile("movl $0, %0" : "+m" (lk->locked) : );
 
+    // Serve the next ticket. Only the holder writes owner.
+    if (lk->ticket)
+        asm volatile("incl %0" : "+m" (lk->owner) : );
+
     popcli();
 }
 
@@ -125,3 +238,33 @@ popcli(void) {
     if (mycpu()->ncli == 0 && mycpu()->intena)
         sti();
 }
+
+// Locks for the lockhammer benchmark: test-and-set and ticket.
+static struct spinlock hammer[2] = {
+        {.name = "hammer"},
+        {.name = "hammer", .ticket = 1},
+};
+static uint hammered;
+
+// Acquire and release a benchmark lock n times, doing a little
+// work inside. Returns the time taken in units of 1024 cycles.
+int
+lockhammer(int ticket, int n) {
+    struct spinlock *lk;
+    uint t0, kcycles;
+    int i;
+
+    lk = &hammer[ticket != 0];
+    kcycles = 0;
+    t0 = rdtsc();
+    for (i = 0; i < n; i++) {
+        acquire(lk);
+        hammered++;
+        release(lk);
+        if (i % 1024 == 1023) {
+            kcycles += (rdtsc() - t0) >> 10;
+            t0 = rdtsc();
+        }
+    }
+    return kcycles + ((rdtsc() - t0) >> 10);
+}
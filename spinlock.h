@@ -2,6 +2,11 @@
 struct spinlock {
     uint locked;       // Is the lock held? 非0是获取了锁
 
+    // For FIFO ticket locks (see initticketlock):
+    int ticket;        // Non-zero if acquired in ticket order.
+    uint next;         // Next ticket to hand out.
+    uint owner;        // Ticket now being served.
+
     // For debugging:
     char *name;        // Name of lock.
     struct cpu *cpu;   // The cpu holding the lock.
@@ -10,5 +15,9 @@ struct spinlock {
     // pcs 数组中存储了获取该锁时调用栈上的最多 10 个程序计数器值，这些值可以通过符号表和反汇编工具来还原出调用栈上的函数名称和代码行数信息。
     uint pcs[10];      // The call stack (an array of program counters)
     // that locked the lock.
+
+    // For profiling:
+    struct lockstat *stat; // Counters shared by locks of this name.
+    uint tsc;              // rdtsc() at acquisition.
 };
 
@@ -0,0 +1,4136 @@
+
+_splicebench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return uptime() - t0;
+}
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+  int size;
+
+  buf = sbrk(MAXSZ + PGSIZE);
+  buf = (char*)PGROUNDUP((uint)buf);
+
+  printf(1, "size\twrite\tvmsplice (ticks for %d KB)\n", TOTAL / 1024);
+       e:	bf 05 00 00 00       	mov    $0x5,%edi
+{
+      13:	56                   	push   %esi
+      14:	53                   	push   %ebx
+  for(size = PGSIZE; size <= MAXSZ; size *= 2)
+      15:	bb 00 10 00 00       	mov    $0x1000,%ebx
+{
+      1a:	51                   	push   %ecx
+      1b:	83 ec 14             	sub    $0x14,%esp
+  buf = sbrk(MAXSZ + PGSIZE);
+      1e:	68 00 10 01 00       	push   $0x11000
+      23:	e8 2c 06 00 00       	call   654 <sbrk>
+  printf(1, "size\twrite\tvmsplice (ticks for %d KB)\n", TOTAL / 1024);
+      28:	83 c4 0c             	add    $0xc,%esp
+      2b:	68 00 10 00 00       	push   $0x1000
+  buf = (char*)PGROUNDUP((uint)buf);
+      30:	05 ff 0f 00 00       	add    $0xfff,%eax
+  printf(1, "size\twrite\tvmsplice (ticks for %d KB)\n", TOTAL / 1024);
+      35:	68 c0 1e 00 00       	push   $0x1ec0
+  buf = (char*)PGROUNDUP((uint)buf);
+      3a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  printf(1, "size\twrite\tvmsplice (ticks for %d KB)\n", TOTAL / 1024);
+      3f:	6a 01                	push   $0x1
+  buf = (char*)PGROUNDUP((uint)buf);
+      41:	a3 e0 29 00 00       	mov    %eax,0x29e0
+  printf(1, "size\twrite\tvmsplice (ticks for %d KB)\n", TOTAL / 1024);
+      46:	e8 85 09 00 00       	call   9d0 <printf>
+      4b:	83 c4 10             	add    $0x10,%esp
+      4e:	66 90                	xchg   %ax,%ax
+    printf(1, "%d\t%d\t%d\n", size, run(size, 0), run(size, 1));
+      50:	83 ec 08             	sub    $0x8,%esp
+      53:	6a 01                	push   $0x1
+      55:	53                   	push   %ebx
+      56:	e8 35 00 00 00       	call   90 <run>
+      5b:	89 c6                	mov    %eax,%esi
+      5d:	58                   	pop    %eax
+      5e:	5a                   	pop    %edx
+      5f:	6a 00                	push   $0x0
+      61:	53                   	push   %ebx
+      62:	e8 29 00 00 00       	call   90 <run>
+      67:	89 34 24             	mov    %esi,(%esp)
+      6a:	50                   	push   %eax
+      6b:	53                   	push   %ebx
+  for(size = PGSIZE; size <= MAXSZ; size *= 2)
+      6c:	01 db                	add    %ebx,%ebx
+    printf(1, "%d\t%d\t%d\n", size, run(size, 0), run(size, 1));
+      6e:	68 8d 1e 00 00       	push   $0x1e8d
+      73:	6a 01                	push   $0x1
+      75:	e8 56 09 00 00       	call   9d0 <printf>
+  for(size = PGSIZE; size <= MAXSZ; size *= 2)
+      7a:	83 c4 20             	add    $0x20,%esp
+      7d:	83 ef 01             	sub    $0x1,%edi
+      80:	75 ce                	jne    50 <main+0x50>
+  exit();
+      82:	e8 89 01 00 00       	call   210 <exit>
+      87:	66 90                	xchg   %ax,%ax
+      89:	66 90                	xchg   %ax,%ax
+      8b:	66 90                	xchg   %ax,%ax
+      8d:	66 90                	xchg   %ax,%ax
+      8f:	90                   	nop
+
+00000090 <run>:
+{
+      90:	55                   	push   %ebp
+      91:	89 e5                	mov    %esp,%ebp
+      93:	57                   	push   %edi
+      94:	56                   	push   %esi
+  if(pipe(fds) < 0){
+      95:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+      98:	53                   	push   %ebx
+      99:	83 ec 38             	sub    $0x38,%esp
+      9c:	8b 7d 08             	mov    0x8(%ebp),%edi
+      9f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(pipe(fds) < 0){
+      a2:	50                   	push   %eax
+      a3:	e8 cb 04 00 00       	call   573 <pipe>
+      a8:	83 c4 10             	add    $0x10,%esp
+      ab:	85 c0                	test   %eax,%eax
+      ad:	0f 88 e9 00 00 00    	js     19c <run+0x10c>
+  t0 = uptime();
+      b3:	e8 88 04 00 00       	call   540 <uptime>
+      b8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  if(fork() == 0){
+      bb:	e8 f0 00 00 00       	call   1b0 <fork>
+      c0:	89 c6                	mov    %eax,%esi
+      c2:	85 c0                	test   %eax,%eax
+      c4:	0f 84 85 00 00 00    	je     14f <run+0xbf>
+  close(fds[0]);
+      ca:	83 ec 0c             	sub    $0xc,%esp
+      cd:	ff 75 e0             	push   -0x20(%ebp)
+  for(total = 0; total < TOTAL; total += size){
+      d0:	31 f6                	xor    %esi,%esi
+  close(fds[0]);
+      d2:	e8 c9 04 00 00       	call   5a0 <close>
+      d7:	83 c4 10             	add    $0x10,%esp
+      da:	eb 20                	jmp    fc <run+0x6c>
+      dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      n = vmsplice(fds[1], buf, size);
+      e0:	83 ec 04             	sub    $0x4,%esp
+      e3:	57                   	push   %edi
+      e4:	51                   	push   %ecx
+      e5:	50                   	push   %eax
+      e6:	e8 e1 05 00 00       	call   6cc <vmsplice>
+      eb:	83 c4 10             	add    $0x10,%esp
+    if(n != size){
+      ee:	39 f8                	cmp    %edi,%eax
+      f0:	75 29                	jne    11b <run+0x8b>
+  for(total = 0; total < TOTAL; total += size){
+      f2:	01 fe                	add    %edi,%esi
+      f4:	81 fe ff ff 3f 00    	cmp    $0x3fffff,%esi
+      fa:	7f 31                	jg     12d <run+0x9d>
+      n = vmsplice(fds[1], buf, size);
+      fc:	8b 0d e0 29 00 00    	mov    0x29e0,%ecx
+     102:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    if(splice)
+     105:	85 db                	test   %ebx,%ebx
+     107:	75 d7                	jne    e0 <run+0x50>
+      n = write(fds[1], buf, size);
+     109:	83 ec 04             	sub    $0x4,%esp
+     10c:	57                   	push   %edi
+     10d:	51                   	push   %ecx
+     10e:	50                   	push   %eax
+     10f:	e8 7d 04 00 00       	call   591 <write>
+     114:	83 c4 10             	add    $0x10,%esp
+    if(n != size){
+     117:	39 f8                	cmp    %edi,%eax
+     119:	74 d7                	je     f2 <run+0x62>
+      printf(2, "splicebench: write failed\n");
+     11b:	83 ec 08             	sub    $0x8,%esp
+     11e:	68 72 1e 00 00       	push   $0x1e72
+     123:	6a 02                	push   $0x2
+     125:	e8 a6 08 00 00       	call   9d0 <printf>
+      break;
+     12a:	83 c4 10             	add    $0x10,%esp
+  close(fds[1]);
+     12d:	83 ec 0c             	sub    $0xc,%esp
+     130:	ff 75 e4             	push   -0x1c(%ebp)
+     133:	e8 68 04 00 00       	call   5a0 <close>
+  wait();
+     138:	e8 27 04 00 00       	call   564 <wait>
+  return uptime() - t0;
+     13d:	e8 fe 03 00 00       	call   540 <uptime>
+     142:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+}
+     145:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     148:	5b                   	pop    %ebx
+     149:	5e                   	pop    %esi
+  return uptime() - t0;
+     14a:	29 d0                	sub    %edx,%eax
+}
+     14c:	5f                   	pop    %edi
+     14d:	5d                   	pop    %ebp
+     14e:	c3                   	ret
+    close(fds[1]);
+     14f:	83 ec 0c             	sub    $0xc,%esp
+     152:	ff 75 e4             	push   -0x1c(%ebp)
+     155:	e8 46 04 00 00       	call   5a0 <close>
+    while((n = read(fds[0], buf, size)) > 0)
+     15a:	83 c4 10             	add    $0x10,%esp
+     15d:	eb 02                	jmp    161 <run+0xd1>
+      total += n;
+     15f:	01 c6                	add    %eax,%esi
+    while((n = read(fds[0], buf, size)) > 0)
+     161:	83 ec 04             	sub    $0x4,%esp
+     164:	57                   	push   %edi
+     165:	ff 35 e0 29 00 00    	push   0x29e0
+     16b:	ff 75 e0             	push   -0x20(%ebp)
+     16e:	e8 0f 04 00 00       	call   582 <read>
+     173:	83 c4 10             	add    $0x10,%esp
+     176:	85 c0                	test   %eax,%eax
+     178:	7f e5                	jg     15f <run+0xcf>
+    if(total != TOTAL)
+     17a:	81 fe 00 00 40 00    	cmp    $0x400000,%esi
+     180:	74 15                	je     197 <run+0x107>
+      printf(2, "splicebench: read %d bytes, want %d\n", total, TOTAL);
+     182:	68 00 00 40 00       	push   $0x400000
+     187:	56                   	push   %esi
+     188:	68 98 1e 00 00       	push   $0x1e98
+     18d:	6a 02                	push   $0x2
+     18f:	e8 3c 08 00 00       	call   9d0 <printf>
+     194:	83 c4 10             	add    $0x10,%esp
+    exit();
+     197:	e8 74 00 00 00       	call   210 <exit>
+    printf(2, "splicebench: pipe failed\n");
+     19c:	50                   	push   %eax
+     19d:	50                   	push   %eax
+     19e:	68 58 1e 00 00       	push   $0x1e58
+     1a3:	6a 02                	push   $0x2
+     1a5:	e8 26 08 00 00       	call   9d0 <printf>
+    exit();
+     1aa:	e8 61 00 00 00       	call   210 <exit>
+     1af:	90                   	nop
+
+000001b0 <fork>:
+int sysexit(void) __attribute__((noreturn));
+
+int
+fork(void)
+{
+  if(flushhook)
+     1b0:	a1 e4 29 00 00       	mov    0x29e4,%eax
+     1b5:	85 c0                	test   %eax,%eax
+     1b7:	74 17                	je     1d0 <fork+0x20>
+{
+     1b9:	55                   	push   %ebp
+     1ba:	89 e5                	mov    %esp,%ebp
+     1bc:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     1bf:	ff d0                	call   *%eax
+  return sysfork();
+}
+     1c1:	c9                   	leave
+  return sysfork();
+     1c2:	e9 7f 03 00 00       	jmp    546 <sysfork>
+     1c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ce:	66 90                	xchg   %ax,%ax
+     1d0:	e9 71 03 00 00       	jmp    546 <sysfork>
+     1d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001e0 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+     1e0:	55                   	push   %ebp
+  if(flushhook)
+     1e1:	a1 e4 29 00 00       	mov    0x29e4,%eax
+{
+     1e6:	89 e5                	mov    %esp,%ebp
+     1e8:	56                   	push   %esi
+     1e9:	53                   	push   %ebx
+     1ea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     1ed:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     1f0:	85 c0                	test   %eax,%eax
+     1f2:	74 02                	je     1f6 <exec+0x16>
+    flushhook();
+     1f4:	ff d0                	call   *%eax
+  return sysexec(path, argv);
+     1f6:	89 75 0c             	mov    %esi,0xc(%ebp)
+     1f9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     1fc:	5b                   	pop    %ebx
+     1fd:	5e                   	pop    %esi
+     1fe:	5d                   	pop    %ebp
+  return sysexec(path, argv);
+     1ff:	e9 ba 03 00 00       	jmp    5be <sysexec>
+     204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     20b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     20f:	90                   	nop
+
+00000210 <exit>:
+
+int
+exit(void)
+{
+     210:	55                   	push   %ebp
+     211:	89 e5                	mov    %esp,%ebp
+     213:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     216:	a1 e4 29 00 00       	mov    0x29e4,%eax
+     21b:	85 c0                	test   %eax,%eax
+     21d:	74 02                	je     221 <exit+0x11>
+    flushhook();
+     21f:	ff d0                	call   *%eax
+  sysexit();
+     221:	e8 2f 03 00 00       	call   555 <sysexit>
+     226:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     22d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000230 <strcpy>:
+}
+
+char*
+strcpy(char *s, const char *t)
+{
+     230:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     231:	31 c0                	xor    %eax,%eax
+{
+     233:	89 e5                	mov    %esp,%ebp
+     235:	53                   	push   %ebx
+     236:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     239:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     240:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     244:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     247:	83 c0 01             	add    $0x1,%eax
+     24a:	84 d2                	test   %dl,%dl
+     24c:	75 f2                	jne    240 <strcpy+0x10>
+    ;
+  return os;
+}
+     24e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     251:	89 c8                	mov    %ecx,%eax
+     253:	c9                   	leave
+     254:	c3                   	ret
+     255:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     25c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     260:	55                   	push   %ebp
+     261:	89 e5                	mov    %esp,%ebp
+     263:	53                   	push   %ebx
+     264:	8b 55 08             	mov    0x8(%ebp),%edx
+     267:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     26a:	0f b6 02             	movzbl (%edx),%eax
+     26d:	84 c0                	test   %al,%al
+     26f:	75 17                	jne    288 <strcmp+0x28>
+     271:	eb 3a                	jmp    2ad <strcmp+0x4d>
+     273:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     277:	90                   	nop
+     278:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     27c:	83 c2 01             	add    $0x1,%edx
+     27f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     282:	84 c0                	test   %al,%al
+     284:	74 1a                	je     2a0 <strcmp+0x40>
+    p++, q++;
+     286:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     288:	0f b6 19             	movzbl (%ecx),%ebx
+     28b:	38 c3                	cmp    %al,%bl
+     28d:	74 e9                	je     278 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     28f:	29 d8                	sub    %ebx,%eax
+}
+     291:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     294:	c9                   	leave
+     295:	c3                   	ret
+     296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     29d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     2a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     2a4:	31 c0                	xor    %eax,%eax
+     2a6:	29 d8                	sub    %ebx,%eax
+}
+     2a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2ab:	c9                   	leave
+     2ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     2ad:	0f b6 19             	movzbl (%ecx),%ebx
+     2b0:	31 c0                	xor    %eax,%eax
+     2b2:	eb db                	jmp    28f <strcmp+0x2f>
+     2b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2bf:	90                   	nop
+
+000002c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     2c0:	55                   	push   %ebp
+     2c1:	89 e5                	mov    %esp,%ebp
+     2c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     2c6:	80 3a 00             	cmpb   $0x0,(%edx)
+     2c9:	74 15                	je     2e0 <strlen+0x20>
+     2cb:	31 c0                	xor    %eax,%eax
+     2cd:	8d 76 00             	lea    0x0(%esi),%esi
+     2d0:	83 c0 01             	add    $0x1,%eax
+     2d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     2d7:	89 c1                	mov    %eax,%ecx
+     2d9:	75 f5                	jne    2d0 <strlen+0x10>
+    ;
+  return n;
+}
+     2db:	89 c8                	mov    %ecx,%eax
+     2dd:	5d                   	pop    %ebp
+     2de:	c3                   	ret
+     2df:	90                   	nop
+  for(n = 0; s[n]; n++)
+     2e0:	31 c9                	xor    %ecx,%ecx
+}
+     2e2:	5d                   	pop    %ebp
+     2e3:	89 c8                	mov    %ecx,%eax
+     2e5:	c3                   	ret
+     2e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     2f0:	55                   	push   %ebp
+     2f1:	89 e5                	mov    %esp,%ebp
+     2f3:	57                   	push   %edi
+     2f4:	8b 55 08             	mov    0x8(%ebp),%edx
+            "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt) {
+    asm volatile("cld; rep stosb" :
+     2f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     2fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2fd:	89 d7                	mov    %edx,%edi
+     2ff:	fc                   	cld
+     300:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     302:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     305:	89 d0                	mov    %edx,%eax
+     307:	c9                   	leave
+     308:	c3                   	ret
+     309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     310:	55                   	push   %ebp
+     311:	89 e5                	mov    %esp,%ebp
+     313:	8b 45 08             	mov    0x8(%ebp),%eax
+     316:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     31a:	0f b6 10             	movzbl (%eax),%edx
+     31d:	84 d2                	test   %dl,%dl
+     31f:	75 12                	jne    333 <strchr+0x23>
+     321:	eb 1d                	jmp    340 <strchr+0x30>
+     323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     327:	90                   	nop
+     328:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     32c:	83 c0 01             	add    $0x1,%eax
+     32f:	84 d2                	test   %dl,%dl
+     331:	74 0d                	je     340 <strchr+0x30>
+    if(*s == c)
+     333:	38 d1                	cmp    %dl,%cl
+     335:	75 f1                	jne    328 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     337:	5d                   	pop    %ebp
+     338:	c3                   	ret
+     339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     340:	31 c0                	xor    %eax,%eax
+}
+     342:	5d                   	pop    %ebp
+     343:	c3                   	ret
+     344:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     34b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     34f:	90                   	nop
+
+00000350 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     350:	55                   	push   %ebp
+     351:	89 e5                	mov    %esp,%ebp
+     353:	56                   	push   %esi
+     354:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     355:	83 ec 08             	sub    $0x8,%esp
+     358:	6a 00                	push   $0x0
+     35a:	ff 75 08             	push   0x8(%ebp)
+     35d:	e8 6b 02 00 00       	call   5cd <open>
+  if(fd < 0)
+     362:	83 c4 10             	add    $0x10,%esp
+     365:	85 c0                	test   %eax,%eax
+     367:	78 27                	js     390 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     369:	83 ec 08             	sub    $0x8,%esp
+     36c:	ff 75 0c             	push   0xc(%ebp)
+     36f:	89 c3                	mov    %eax,%ebx
+     371:	50                   	push   %eax
+     372:	e8 83 02 00 00       	call   5fa <fstat>
+  close(fd);
+     377:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     37a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     37c:	e8 1f 02 00 00       	call   5a0 <close>
+  return r;
+     381:	83 c4 10             	add    $0x10,%esp
+}
+     384:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     387:	89 f0                	mov    %esi,%eax
+     389:	5b                   	pop    %ebx
+     38a:	5e                   	pop    %esi
+     38b:	5d                   	pop    %ebp
+     38c:	c3                   	ret
+     38d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     390:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     395:	eb ed                	jmp    384 <stat+0x34>
+     397:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     39e:	66 90                	xchg   %ax,%ax
+
+000003a0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     3a0:	55                   	push   %ebp
+     3a1:	89 e5                	mov    %esp,%ebp
+     3a3:	53                   	push   %ebx
+     3a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     3a7:	0f be 02             	movsbl (%edx),%eax
+     3aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     3ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     3b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     3b5:	77 1e                	ja     3d5 <atoi+0x35>
+     3b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     3c0:	83 c2 01             	add    $0x1,%edx
+     3c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     3c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     3ca:	0f be 02             	movsbl (%edx),%eax
+     3cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     3d0:	80 fb 09             	cmp    $0x9,%bl
+     3d3:	76 eb                	jbe    3c0 <atoi+0x20>
+  return n;
+}
+     3d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3d8:	89 c8                	mov    %ecx,%eax
+     3da:	c9                   	leave
+     3db:	c3                   	ret
+     3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     3e0:	55                   	push   %ebp
+     3e1:	89 e5                	mov    %esp,%ebp
+     3e3:	57                   	push   %edi
+     3e4:	56                   	push   %esi
+     3e5:	8b 45 10             	mov    0x10(%ebp),%eax
+     3e8:	8b 55 08             	mov    0x8(%ebp),%edx
+     3eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     3ee:	85 c0                	test   %eax,%eax
+     3f0:	7e 13                	jle    405 <memmove+0x25>
+     3f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     3f4:	89 d7                	mov    %edx,%edi
+     3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     400:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     401:	39 f8                	cmp    %edi,%eax
+     403:	75 fb                	jne    400 <memmove+0x20>
+  return vdst;
+}
+     405:	5e                   	pop    %esi
+     406:	89 d0                	mov    %edx,%eax
+     408:	5f                   	pop    %edi
+     409:	5d                   	pop    %ebp
+     40a:	c3                   	ret
+     40b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     40f:	90                   	nop
+
+00000410 <mutex_init>:
+
+// Futex-based mutex (Drepper, "Futexes Are Tricky", mutex 2).
+// The uncontended paths never enter the kernel.
+void
+mutex_init(struct mutex *m)
+{
+     410:	55                   	push   %ebp
+     411:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+     413:	8b 45 08             	mov    0x8(%ebp),%eax
+     416:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     41c:	5d                   	pop    %ebp
+     41d:	c3                   	ret
+     41e:	66 90                	xchg   %ax,%ax
+
+00000420 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     420:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     421:	31 c0                	xor    %eax,%eax
+     423:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+     428:	89 e5                	mov    %esp,%ebp
+     42a:	56                   	push   %esi
+     42b:	53                   	push   %ebx
+     42c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     42f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     433:	85 c0                	test   %eax,%eax
+     435:	74 32                	je     469 <mutex_lock+0x49>
+    return;
+  if(c != 2)
+     437:	83 f8 02             	cmp    $0x2,%eax
+     43a:	74 0c                	je     448 <mutex_lock+0x28>
+static inline uint
+xchg(volatile uint *addr, uint newval) {
+    uint result;
+
+    // The + in "+m" denotes a read-modify-write operand.
+    asm volatile("lock; xchgl %0, %1" :
+     43c:	b8 02 00 00 00       	mov    $0x2,%eax
+     441:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+     444:	85 c0                	test   %eax,%eax
+     446:	74 21                	je     469 <mutex_lock+0x49>
+     448:	be 02 00 00 00       	mov    $0x2,%esi
+     44d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAIT, 2);
+     450:	83 ec 04             	sub    $0x4,%esp
+     453:	6a 02                	push   $0x2
+     455:	6a 00                	push   $0x0
+     457:	53                   	push   %ebx
+     458:	e8 33 02 00 00       	call   690 <futex>
+     45d:	89 f0                	mov    %esi,%eax
+     45f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     462:	83 c4 10             	add    $0x10,%esp
+     465:	85 c0                	test   %eax,%eax
+     467:	75 e7                	jne    450 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+     469:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     46c:	5b                   	pop    %ebx
+     46d:	5e                   	pop    %esi
+     46e:	5d                   	pop    %ebp
+     46f:	c3                   	ret
+
+00000470 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     470:	55                   	push   %ebp
+     471:	89 e5                	mov    %esp,%ebp
+     473:	83 ec 08             	sub    $0x8,%esp
+     476:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     479:	f0 83 28 01          	lock subl $0x1,(%eax)
+     47d:	75 09                	jne    488 <mutex_unlock+0x18>
+    m->val = 0;
+    futex(&m->val, FUTEX_WAKE, 1);
+  }
+}
+     47f:	c9                   	leave
+     480:	c3                   	ret
+     481:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     488:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     48b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex(&m->val, FUTEX_WAKE, 1);
+     491:	6a 01                	push   $0x1
+     493:	6a 01                	push   $0x1
+     495:	50                   	push   %eax
+     496:	e8 f5 01 00 00       	call   690 <futex>
+     49b:	83 c4 10             	add    $0x10,%esp
+}
+     49e:	c9                   	leave
+     49f:	c3                   	ret
+
+000004a0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     4a0:	55                   	push   %ebp
+     4a1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     4a3:	8b 45 08             	mov    0x8(%ebp),%eax
+     4a6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     4ac:	5d                   	pop    %ebp
+     4ad:	c3                   	ret
+     4ae:	66 90                	xchg   %ax,%ax
+
+000004b0 <cond_wait>:
+
+// Release m and wait for a signal, then reacquire m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     4b0:	55                   	push   %ebp
+     4b1:	89 e5                	mov    %esp,%ebp
+     4b3:	57                   	push   %edi
+     4b4:	56                   	push   %esi
+     4b5:	53                   	push   %ebx
+     4b6:	83 ec 0c             	sub    $0xc,%esp
+     4b9:	8b 75 08             	mov    0x8(%ebp),%esi
+     4bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     4bf:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     4c1:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+     4c5:	75 21                	jne    4e8 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     4c7:	83 ec 04             	sub    $0x4,%esp
+     4ca:	57                   	push   %edi
+     4cb:	6a 00                	push   $0x0
+     4cd:	56                   	push   %esi
+     4ce:	e8 bd 01 00 00       	call   690 <futex>
+  mutex_lock(m);
+     4d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     4d6:	83 c4 10             	add    $0x10,%esp
+}
+     4d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4dc:	5b                   	pop    %ebx
+     4dd:	5e                   	pop    %esi
+     4de:	5f                   	pop    %edi
+     4df:	5d                   	pop    %ebp
+  mutex_lock(m);
+     4e0:	e9 3b ff ff ff       	jmp    420 <mutex_lock>
+     4e5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     4e8:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     4eb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex(&m->val, FUTEX_WAKE, 1);
+     4f1:	6a 01                	push   $0x1
+     4f3:	6a 01                	push   $0x1
+     4f5:	53                   	push   %ebx
+     4f6:	e8 95 01 00 00       	call   690 <futex>
+     4fb:	83 c4 10             	add    $0x10,%esp
+     4fe:	eb c7                	jmp    4c7 <cond_wait+0x17>
+
+00000500 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+     500:	55                   	push   %ebp
+     501:	89 e5                	mov    %esp,%ebp
+     503:	83 ec 0c             	sub    $0xc,%esp
+     506:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     509:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+     50d:	6a 01                	push   $0x1
+     50f:	6a 01                	push   $0x1
+     511:	50                   	push   %eax
+     512:	e8 79 01 00 00       	call   690 <futex>
+}
+     517:	83 c4 10             	add    $0x10,%esp
+     51a:	c9                   	leave
+     51b:	c3                   	ret
+     51c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     520:	55                   	push   %ebp
+     521:	89 e5                	mov    %esp,%ebp
+     523:	83 ec 0c             	sub    $0xc,%esp
+     526:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     529:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+     52d:	6a 40                	push   $0x40
+     52f:	6a 01                	push   $0x1
+     531:	50                   	push   %eax
+     532:	e8 59 01 00 00       	call   690 <futex>
+}
+     537:	83 c4 10             	add    $0x10,%esp
+     53a:	c9                   	leave
+     53b:	c3                   	ret
+     53c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000540 <uptime>:
+// Clock ticks since boot, read from the kernel's vdso page
+// without a system call.
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     540:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+     545:	c3                   	ret
+
+00000546 <sysfork>:
+  1: ret
+
+#define SYSCALL(name) SYSCALLAS(name, name)
+
+// ulib.c wraps these.
+SYSCALLAS(sysfork, fork)
+     546:	b8 01 00 00 00       	mov    $0x1,%eax
+     54b:	89 e1                	mov    %esp,%ecx
+     54d:	ba 54 05 00 00       	mov    $0x554,%edx
+     552:	0f 34                	sysenter
+     554:	c3                   	ret
+
+00000555 <sysexit>:
+SYSCALLAS(sysexit, exit)
+     555:	b8 02 00 00 00       	mov    $0x2,%eax
+     55a:	89 e1                	mov    %esp,%ecx
+     55c:	ba 63 05 00 00       	mov    $0x563,%edx
+     561:	0f 34                	sysenter
+     563:	c3                   	ret
+
+00000564 <wait>:
+SYSCALL(wait)
+     564:	b8 03 00 00 00       	mov    $0x3,%eax
+     569:	89 e1                	mov    %esp,%ecx
+     56b:	ba 72 05 00 00       	mov    $0x572,%edx
+     570:	0f 34                	sysenter
+     572:	c3                   	ret
+
+00000573 <pipe>:
+SYSCALL(pipe)
+     573:	b8 04 00 00 00       	mov    $0x4,%eax
+     578:	89 e1                	mov    %esp,%ecx
+     57a:	ba 81 05 00 00       	mov    $0x581,%edx
+     57f:	0f 34                	sysenter
+     581:	c3                   	ret
+
+00000582 <read>:
+SYSCALL(read)
+     582:	b8 05 00 00 00       	mov    $0x5,%eax
+     587:	89 e1                	mov    %esp,%ecx
+     589:	ba 90 05 00 00       	mov    $0x590,%edx
+     58e:	0f 34                	sysenter
+     590:	c3                   	ret
+
+00000591 <write>:
+SYSCALL(write)
+     591:	b8 10 00 00 00       	mov    $0x10,%eax
+     596:	89 e1                	mov    %esp,%ecx
+     598:	ba 9f 05 00 00       	mov    $0x59f,%edx
+     59d:	0f 34                	sysenter
+     59f:	c3                   	ret
+
+000005a0 <close>:
+SYSCALL(close)
+     5a0:	b8 15 00 00 00       	mov    $0x15,%eax
+     5a5:	89 e1                	mov    %esp,%ecx
+     5a7:	ba ae 05 00 00       	mov    $0x5ae,%edx
+     5ac:	0f 34                	sysenter
+     5ae:	c3                   	ret
+
+000005af <kill>:
+SYSCALL(kill)
+     5af:	b8 06 00 00 00       	mov    $0x6,%eax
+     5b4:	89 e1                	mov    %esp,%ecx
+     5b6:	ba bd 05 00 00       	mov    $0x5bd,%edx
+     5bb:	0f 34                	sysenter
+     5bd:	c3                   	ret
+
+000005be <sysexec>:
+SYSCALLAS(sysexec, exec)
+     5be:	b8 07 00 00 00       	mov    $0x7,%eax
+     5c3:	89 e1                	mov    %esp,%ecx
+     5c5:	ba cc 05 00 00       	mov    $0x5cc,%edx
+     5ca:	0f 34                	sysenter
+     5cc:	c3                   	ret
+
+000005cd <open>:
+SYSCALL(open)
+     5cd:	b8 0f 00 00 00       	mov    $0xf,%eax
+     5d2:	89 e1                	mov    %esp,%ecx
+     5d4:	ba db 05 00 00       	mov    $0x5db,%edx
+     5d9:	0f 34                	sysenter
+     5db:	c3                   	ret
+
+000005dc <mknod>:
+SYSCALL(mknod)
+     5dc:	b8 11 00 00 00       	mov    $0x11,%eax
+     5e1:	89 e1                	mov    %esp,%ecx
+     5e3:	ba ea 05 00 00       	mov    $0x5ea,%edx
+     5e8:	0f 34                	sysenter
+     5ea:	c3                   	ret
+
+000005eb <unlink>:
+SYSCALL(unlink)
+     5eb:	b8 12 00 00 00       	mov    $0x12,%eax
+     5f0:	89 e1                	mov    %esp,%ecx
+     5f2:	ba f9 05 00 00       	mov    $0x5f9,%edx
+     5f7:	0f 34                	sysenter
+     5f9:	c3                   	ret
+
+000005fa <fstat>:
+SYSCALL(fstat)
+     5fa:	b8 08 00 00 00       	mov    $0x8,%eax
+     5ff:	89 e1                	mov    %esp,%ecx
+     601:	ba 08 06 00 00       	mov    $0x608,%edx
+     606:	0f 34                	sysenter
+     608:	c3                   	ret
+
+00000609 <link>:
+SYSCALL(link)
+     609:	b8 13 00 00 00       	mov    $0x13,%eax
+     60e:	89 e1                	mov    %esp,%ecx
+     610:	ba 17 06 00 00       	mov    $0x617,%edx
+     615:	0f 34                	sysenter
+     617:	c3                   	ret
+
+00000618 <mkdir>:
+SYSCALL(mkdir)
+     618:	b8 14 00 00 00       	mov    $0x14,%eax
+     61d:	89 e1                	mov    %esp,%ecx
+     61f:	ba 26 06 00 00       	mov    $0x626,%edx
+     624:	0f 34                	sysenter
+     626:	c3                   	ret
+
+00000627 <chdir>:
+SYSCALL(chdir)
+     627:	b8 09 00 00 00       	mov    $0x9,%eax
+     62c:	89 e1                	mov    %esp,%ecx
+     62e:	ba 35 06 00 00       	mov    $0x635,%edx
+     633:	0f 34                	sysenter
+     635:	c3                   	ret
+
+00000636 <dup>:
+SYSCALL(dup)
+     636:	b8 0a 00 00 00       	mov    $0xa,%eax
+     63b:	89 e1                	mov    %esp,%ecx
+     63d:	ba 44 06 00 00       	mov    $0x644,%edx
+     642:	0f 34                	sysenter
+     644:	c3                   	ret
+
+00000645 <getpid>:
+SYSCALL(getpid)
+     645:	b8 0b 00 00 00       	mov    $0xb,%eax
+     64a:	89 e1                	mov    %esp,%ecx
+     64c:	ba 53 06 00 00       	mov    $0x653,%edx
+     651:	0f 34                	sysenter
+     653:	c3                   	ret
+
+00000654 <sbrk>:
+SYSCALL(sbrk)
+     654:	b8 0c 00 00 00       	mov    $0xc,%eax
+     659:	89 e1                	mov    %esp,%ecx
+     65b:	ba 62 06 00 00       	mov    $0x662,%edx
+     660:	0f 34                	sysenter
+     662:	c3                   	ret
+
+00000663 <sleep>:
+SYSCALL(sleep)
+     663:	b8 0d 00 00 00       	mov    $0xd,%eax
+     668:	89 e1                	mov    %esp,%ecx
+     66a:	ba 71 06 00 00       	mov    $0x671,%edx
+     66f:	0f 34                	sysenter
+     671:	c3                   	ret
+
+00000672 <clone>:
+SYSCALL(clone)
+     672:	b8 16 00 00 00       	mov    $0x16,%eax
+     677:	89 e1                	mov    %esp,%ecx
+     679:	ba 80 06 00 00       	mov    $0x680,%edx
+     67e:	0f 34                	sysenter
+     680:	c3                   	ret
+
+00000681 <join>:
+SYSCALL(join)
+     681:	b8 17 00 00 00       	mov    $0x17,%eax
+     686:	89 e1                	mov    %esp,%ecx
+     688:	ba 8f 06 00 00       	mov    $0x68f,%edx
+     68d:	0f 34                	sysenter
+     68f:	c3                   	ret
+
+00000690 <futex>:
+SYSCALL(futex)
+     690:	b8 18 00 00 00       	mov    $0x18,%eax
+     695:	89 e1                	mov    %esp,%ecx
+     697:	ba 9e 06 00 00       	mov    $0x69e,%edx
+     69c:	0f 34                	sysenter
+     69e:	c3                   	ret
+
+0000069f <yield>:
+SYSCALL(yield)
+     69f:	b8 19 00 00 00       	mov    $0x19,%eax
+     6a4:	89 e1                	mov    %esp,%ecx
+     6a6:	ba ad 06 00 00       	mov    $0x6ad,%edx
+     6ab:	0f 34                	sysenter
+     6ad:	c3                   	ret
+
+000006ae <lockstat>:
+SYSCALL(lockstat)
+     6ae:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     6b3:	89 e1                	mov    %esp,%ecx
+     6b5:	ba bc 06 00 00       	mov    $0x6bc,%edx
+     6ba:	0f 34                	sysenter
+     6bc:	c3                   	ret
+
+000006bd <lockhammer>:
+SYSCALL(lockhammer)
+     6bd:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     6c2:	89 e1                	mov    %esp,%ecx
+     6c4:	ba cb 06 00 00       	mov    $0x6cb,%edx
+     6c9:	0f 34                	sysenter
+     6cb:	c3                   	ret
+
+000006cc <vmsplice>:
+SYSCALL(vmsplice)
+     6cc:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     6d1:	89 e1                	mov    %esp,%ecx
+     6d3:	ba da 06 00 00       	mov    $0x6da,%edx
+     6d8:	0f 34                	sysenter
+     6da:	c3                   	ret
+
+000006db <hsbrk>:
+SYSCALL(hsbrk)
+     6db:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     6e0:	89 e1                	mov    %esp,%ecx
+     6e2:	ba e9 06 00 00       	mov    $0x6e9,%edx
+     6e7:	0f 34                	sysenter
+     6e9:	c3                   	ret
+
+000006ea <mmap>:
+SYSCALL(mmap)
+     6ea:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     6ef:	89 e1                	mov    %esp,%ecx
+     6f1:	ba f8 06 00 00       	mov    $0x6f8,%edx
+     6f6:	0f 34                	sysenter
+     6f8:	c3                   	ret
+
+000006f9 <munmap>:
+SYSCALL(munmap)
+     6f9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     6fe:	89 e1                	mov    %esp,%ecx
+     700:	ba 07 07 00 00       	mov    $0x707,%edx
+     705:	0f 34                	sysenter
+     707:	c3                   	ret
+
+00000708 <ringenter>:
+SYSCALL(ringenter)
+     708:	b8 20 00 00 00       	mov    $0x20,%eax
+     70d:	89 e1                	mov    %esp,%ecx
+     70f:	ba 16 07 00 00       	mov    $0x716,%edx
+     714:	0f 34                	sysenter
+     716:	c3                   	ret
+
+00000717 <readv>:
+SYSCALL(readv)
+     717:	b8 21 00 00 00       	mov    $0x21,%eax
+     71c:	89 e1                	mov    %esp,%ecx
+     71e:	ba 25 07 00 00       	mov    $0x725,%edx
+     723:	0f 34                	sysenter
+     725:	c3                   	ret
+
+00000726 <writev>:
+SYSCALL(writev)
+     726:	b8 22 00 00 00       	mov    $0x22,%eax
+     72b:	89 e1                	mov    %esp,%ecx
+     72d:	ba 34 07 00 00       	mov    $0x734,%edx
+     732:	0f 34                	sysenter
+     734:	c3                   	ret
+
+00000735 <pread>:
+SYSCALL(pread)
+     735:	b8 23 00 00 00       	mov    $0x23,%eax
+     73a:	89 e1                	mov    %esp,%ecx
+     73c:	ba 43 07 00 00       	mov    $0x743,%edx
+     741:	0f 34                	sysenter
+     743:	c3                   	ret
+
+00000744 <pwrite>:
+SYSCALL(pwrite)
+     744:	b8 24 00 00 00       	mov    $0x24,%eax
+     749:	89 e1                	mov    %esp,%ecx
+     74b:	ba 52 07 00 00       	mov    $0x752,%edx
+     750:	0f 34                	sysenter
+     752:	c3                   	ret
+
+00000753 <prof>:
+SYSCALL(prof)
+     753:	b8 25 00 00 00       	mov    $0x25,%eax
+     758:	89 e1                	mov    %esp,%ecx
+     75a:	ba 61 07 00 00       	mov    $0x761,%edx
+     75f:	0f 34                	sysenter
+     761:	c3                   	ret
+
+00000762 <scstat>:
+SYSCALL(scstat)
+     762:	b8 26 00 00 00       	mov    $0x26,%eax
+     767:	89 e1                	mov    %esp,%ecx
+     769:	ba 70 07 00 00       	mov    $0x770,%edx
+     76e:	0f 34                	sysenter
+     770:	c3                   	ret
+     771:	66 90                	xchg   %ax,%ax
+     773:	66 90                	xchg   %ax,%ax
+     775:	66 90                	xchg   %ax,%ax
+     777:	66 90                	xchg   %ax,%ax
+     779:	66 90                	xchg   %ax,%ax
+     77b:	66 90                	xchg   %ax,%ax
+     77d:	66 90                	xchg   %ax,%ax
+     77f:	90                   	nop
+
+00000780 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+     780:	55                   	push   %ebp
+     781:	89 e5                	mov    %esp,%ebp
+     783:	57                   	push   %edi
+     784:	56                   	push   %esi
+     785:	53                   	push   %ebx
+     786:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     788:	89 d1                	mov    %edx,%ecx
+{
+     78a:	83 ec 2c             	sub    $0x2c,%esp
+     78d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+     790:	85 d2                	test   %edx,%edx
+     792:	79 7c                	jns    810 <printint+0x90>
+     794:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     798:	74 76                	je     810 <printint+0x90>
+    x = -xx;
+     79a:	f7 d9                	neg    %ecx
+    neg = 1;
+     79c:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     7a1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     7a4:	31 f6                	xor    %esi,%esi
+     7a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ad:	8d 76 00             	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     7b0:	89 c8                	mov    %ecx,%eax
+     7b2:	31 d2                	xor    %edx,%edx
+     7b4:	89 f7                	mov    %esi,%edi
+     7b6:	f7 f3                	div    %ebx
+     7b8:	8d 76 01             	lea    0x1(%esi),%esi
+     7bb:	0f b6 92 48 1f 00 00 	movzbl 0x1f48(%edx),%edx
+     7c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     7c6:	89 ca                	mov    %ecx,%edx
+     7c8:	89 c1                	mov    %eax,%ecx
+     7ca:	39 da                	cmp    %ebx,%edx
+     7cc:	73 e2                	jae    7b0 <printint+0x30>
+  if(neg)
+     7ce:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     7d1:	85 c0                	test   %eax,%eax
+     7d3:	74 07                	je     7dc <printint+0x5c>
+    buf[i++] = '-';
+     7d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     7da:	89 f7                	mov    %esi,%edi
+     7dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     7df:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     7e2:	01 df                	add    %ebx,%edi
+     7e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc_unlocked(buf[i], f);
+     7e8:	83 ec 08             	sub    $0x8,%esp
+     7eb:	56                   	push   %esi
+     7ec:	0f be 07             	movsbl (%edi),%eax
+     7ef:	50                   	push   %eax
+     7f0:	e8 cb 07 00 00       	call   fc0 <putc_unlocked>
+  while(--i >= 0)
+     7f5:	89 f8                	mov    %edi,%eax
+     7f7:	83 c4 10             	add    $0x10,%esp
+     7fa:	83 ef 01             	sub    $0x1,%edi
+     7fd:	39 d8                	cmp    %ebx,%eax
+     7ff:	75 e7                	jne    7e8 <printint+0x68>
+}
+     801:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     804:	5b                   	pop    %ebx
+     805:	5e                   	pop    %esi
+     806:	5f                   	pop    %edi
+     807:	5d                   	pop    %ebp
+     808:	c3                   	ret
+     809:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     810:	31 c0                	xor    %eax,%eax
+     812:	eb 8d                	jmp    7a1 <printint+0x21>
+     814:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     81b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     81f:	90                   	nop
+
+00000820 <vfprintf>:
+
+// Print to the given stream, which the caller has locked.
+// Only understands %d, %x, %p, %s.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+     820:	55                   	push   %ebp
+     821:	89 e5                	mov    %esp,%ebp
+     823:	57                   	push   %edi
+     824:	56                   	push   %esi
+     825:	53                   	push   %ebx
+     826:	83 ec 1c             	sub    $0x1c,%esp
+     829:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     82c:	0f b6 0a             	movzbl (%edx),%ecx
+     82f:	84 c9                	test   %cl,%cl
+     831:	74 5c                	je     88f <vfprintf+0x6f>
+     833:	89 c6                	mov    %eax,%esi
+     835:	8d 5a 01             	lea    0x1(%edx),%ebx
+     838:	31 ff                	xor    %edi,%edi
+     83a:	eb 20                	jmp    85c <vfprintf+0x3c>
+     83c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     840:	83 f9 25             	cmp    $0x25,%ecx
+     843:	74 3b                	je     880 <vfprintf+0x60>
+        state = '%';
+      } else {
+        putc_unlocked(c, f);
+     845:	83 ec 08             	sub    $0x8,%esp
+     848:	56                   	push   %esi
+     849:	51                   	push   %ecx
+     84a:	e8 71 07 00 00       	call   fc0 <putc_unlocked>
+     84f:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     852:	0f b6 0b             	movzbl (%ebx),%ecx
+     855:	83 c3 01             	add    $0x1,%ebx
+     858:	84 c9                	test   %cl,%cl
+     85a:	74 33                	je     88f <vfprintf+0x6f>
+    if(state == 0){
+     85c:	85 ff                	test   %edi,%edi
+     85e:	74 e0                	je     840 <vfprintf+0x20>
+      }
+    } else if(state == '%'){
+     860:	83 ff 25             	cmp    $0x25,%edi
+     863:	75 ed                	jne    852 <vfprintf+0x32>
+      if(c == 'd'){
+     865:	83 f9 25             	cmp    $0x25,%ecx
+     868:	0f 84 02 01 00 00    	je     970 <vfprintf+0x150>
+     86e:	8d 41 9d             	lea    -0x63(%ecx),%eax
+     871:	83 f8 15             	cmp    $0x15,%eax
+     874:	77 2a                	ja     8a0 <vfprintf+0x80>
+     876:	ff 24 85 f0 1e 00 00 	jmp    *0x1ef0(,%eax,4)
+     87d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     880:	0f b6 0b             	movzbl (%ebx),%ecx
+     883:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     886:	bf 25 00 00 00       	mov    $0x25,%edi
+  for(i = 0; fmt[i]; i++){
+     88b:	84 c9                	test   %cl,%cl
+     88d:	75 cd                	jne    85c <vfprintf+0x3c>
+        putc_unlocked(c, f);
+      }
+      state = 0;
+    }
+  }
+}
+     88f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     892:	5b                   	pop    %ebx
+     893:	5e                   	pop    %esi
+     894:	5f                   	pop    %edi
+     895:	5d                   	pop    %ebp
+     896:	c3                   	ret
+     897:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     89e:	66 90                	xchg   %ax,%ax
+        putc_unlocked('%', f);
+     8a0:	83 ec 08             	sub    $0x8,%esp
+     8a3:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     8a6:	56                   	push   %esi
+     8a7:	6a 25                	push   $0x25
+     8a9:	e8 12 07 00 00       	call   fc0 <putc_unlocked>
+        putc_unlocked(c, f);
+     8ae:	58                   	pop    %eax
+     8af:	5a                   	pop    %edx
+     8b0:	56                   	push   %esi
+     8b1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     8b4:	51                   	push   %ecx
+     8b5:	e8 06 07 00 00       	call   fc0 <putc_unlocked>
+     8ba:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     8bd:	31 ff                	xor    %edi,%edi
+     8bf:	eb 91                	jmp    852 <vfprintf+0x32>
+     8c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+     8c8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     8cb:	83 ec 0c             	sub    $0xc,%esp
+     8ce:	b9 10 00 00 00       	mov    $0x10,%ecx
+     8d3:	8b 17                	mov    (%edi),%edx
+     8d5:	6a 00                	push   $0x0
+        ap++;
+     8d7:	83 c7 04             	add    $0x4,%edi
+        printint(f, *ap, 16, 0);
+     8da:	89 f0                	mov    %esi,%eax
+     8dc:	e8 9f fe ff ff       	call   780 <printint>
+        ap++;
+     8e1:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     8e4:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     8e7:	31 ff                	xor    %edi,%edi
+     8e9:	e9 64 ff ff ff       	jmp    852 <vfprintf+0x32>
+     8ee:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     8f0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     8f3:	8b 10                	mov    (%eax),%edx
+        ap++;
+     8f5:	83 c0 04             	add    $0x4,%eax
+     8f8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     8fb:	85 d2                	test   %edx,%edx
+     8fd:	0f 84 85 00 00 00    	je     988 <vfprintf+0x168>
+        while(*s != 0){
+     903:	0f be 02             	movsbl (%edx),%eax
+        s = (char*)*ap;
+     906:	89 d7                	mov    %edx,%edi
+        while(*s != 0){
+     908:	84 c0                	test   %al,%al
+     90a:	74 b1                	je     8bd <vfprintf+0x9d>
+     90c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+          putc_unlocked(*s, f);
+     910:	83 ec 08             	sub    $0x8,%esp
+          s++;
+     913:	83 c7 01             	add    $0x1,%edi
+          putc_unlocked(*s, f);
+     916:	56                   	push   %esi
+     917:	50                   	push   %eax
+     918:	e8 a3 06 00 00       	call   fc0 <putc_unlocked>
+        while(*s != 0){
+     91d:	0f be 07             	movsbl (%edi),%eax
+     920:	83 c4 10             	add    $0x10,%esp
+     923:	84 c0                	test   %al,%al
+     925:	75 e9                	jne    910 <vfprintf+0xf0>
+      state = 0;
+     927:	31 ff                	xor    %edi,%edi
+     929:	e9 24 ff ff ff       	jmp    852 <vfprintf+0x32>
+     92e:	66 90                	xchg   %ax,%ax
+        printint(f, *ap, 10, 1);
+     930:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     933:	83 ec 0c             	sub    $0xc,%esp
+     936:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     93b:	8b 17                	mov    (%edi),%edx
+     93d:	6a 01                	push   $0x1
+     93f:	eb 96                	jmp    8d7 <vfprintf+0xb7>
+     941:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc_unlocked(*ap, f);
+     948:	83 ec 08             	sub    $0x8,%esp
+     94b:	56                   	push   %esi
+     94c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     94f:	ff 37                	push   (%edi)
+     951:	e8 6a 06 00 00       	call   fc0 <putc_unlocked>
+        ap++;
+     956:	89 f8                	mov    %edi,%eax
+     958:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     95b:	31 ff                	xor    %edi,%edi
+        ap++;
+     95d:	83 c0 04             	add    $0x4,%eax
+     960:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     963:	e9 ea fe ff ff       	jmp    852 <vfprintf+0x32>
+     968:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     96f:	90                   	nop
+        putc_unlocked(c, f);
+     970:	83 ec 08             	sub    $0x8,%esp
+      state = 0;
+     973:	31 ff                	xor    %edi,%edi
+        putc_unlocked(c, f);
+     975:	56                   	push   %esi
+     976:	6a 25                	push   $0x25
+     978:	e8 43 06 00 00       	call   fc0 <putc_unlocked>
+     97d:	83 c4 10             	add    $0x10,%esp
+     980:	e9 cd fe ff ff       	jmp    852 <vfprintf+0x32>
+     985:	8d 76 00             	lea    0x0(%esi),%esi
+     988:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     98d:	bf e7 1e 00 00       	mov    $0x1ee7,%edi
+     992:	e9 79 ff ff ff       	jmp    910 <vfprintf+0xf0>
+     997:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     99e:	66 90                	xchg   %ax,%ax
+
+000009a0 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+     9a0:	55                   	push   %ebp
+     9a1:	89 e5                	mov    %esp,%ebp
+     9a3:	53                   	push   %ebx
+     9a4:	83 ec 10             	sub    $0x10,%esp
+     9a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  flockfile(f);
+     9aa:	53                   	push   %ebx
+     9ab:	e8 d0 02 00 00       	call   c80 <flockfile>
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     9b0:	8b 55 0c             	mov    0xc(%ebp),%edx
+     9b3:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     9b6:	89 d8                	mov    %ebx,%eax
+     9b8:	e8 63 fe ff ff       	call   820 <vfprintf>
+  funlockfile(f);
+     9bd:	89 1c 24             	mov    %ebx,(%esp)
+     9c0:	e8 eb 02 00 00       	call   cb0 <funlockfile>
+}
+     9c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9c8:	83 c4 10             	add    $0x10,%esp
+     9cb:	c9                   	leave
+     9cc:	c3                   	ret
+     9cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009d0 <printf>:
+
+// Print to the given fd: through stdout or stderr for 1 and 2,
+// otherwise with one write() per call.
+void
+printf(int fd, const char *fmt, ...)
+{
+     9d0:	55                   	push   %ebp
+     9d1:	89 e5                	mov    %esp,%ebp
+     9d3:	56                   	push   %esi
+     9d4:	53                   	push   %ebx
+     9d5:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+     9db:	8b 45 08             	mov    0x8(%ebp),%eax
+  char buf[128];
+  struct iobuf f;
+
+  if(fd == 1 || fd == 2){
+    flockfile(&_iob[fd]);
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     9de:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(fd == 1 || fd == 2){
+     9e1:	8d 50 ff             	lea    -0x1(%eax),%edx
+     9e4:	83 fa 01             	cmp    $0x1,%edx
+     9e7:	76 77                	jbe    a60 <printf+0x90>
+    funlockfile(&_iob[fd]);
+    return;
+  }
+  f.fd = fd;
+     9e9:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  f.flags = IO_WRITE|IO_SETUP;
+  f.buf = buf;
+     9ef:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  f.size = sizeof(buf);
+  f.r = f.n = 0;
+  mutex_init(&f.lock);
+     9f5:	83 ec 0c             	sub    $0xc,%esp
+     9f8:	8d 9d 5c ff ff ff    	lea    -0xa4(%ebp),%ebx
+  f.buf = buf;
+     9fe:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+  mutex_init(&f.lock);
+     a04:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  f.flags = IO_WRITE|IO_SETUP;
+     a0a:	c7 85 60 ff ff ff 42 	movl   $0x42,-0xa0(%ebp)
+     a11:	00 00 00 
+  f.size = sizeof(buf);
+     a14:	c7 85 68 ff ff ff 80 	movl   $0x80,-0x98(%ebp)
+     a1b:	00 00 00 
+  f.r = f.n = 0;
+     a1e:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+     a25:	00 00 00 
+     a28:	c7 85 6c ff ff ff 00 	movl   $0x0,-0x94(%ebp)
+     a2f:	00 00 00 
+  mutex_init(&f.lock);
+     a32:	50                   	push   %eax
+     a33:	e8 d8 f9 ff ff       	call   410 <mutex_init>
+  vfprintf(&f, fmt, (uint*)(void*)&fmt + 1);
+     a38:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     a3b:	89 f2                	mov    %esi,%edx
+     a3d:	89 d8                	mov    %ebx,%eax
+     a3f:	e8 dc fd ff ff       	call   820 <vfprintf>
+  fflush(&f);
+     a44:	89 1c 24             	mov    %ebx,(%esp)
+     a47:	e8 f4 04 00 00       	call   f40 <fflush>
+     a4c:	83 c4 10             	add    $0x10,%esp
+}
+     a4f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     a52:	5b                   	pop    %ebx
+     a53:	5e                   	pop    %esi
+     a54:	5d                   	pop    %ebp
+     a55:	c3                   	ret
+     a56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a5d:	8d 76 00             	lea    0x0(%esi),%esi
+    flockfile(&_iob[fd]);
+     a60:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     a63:	83 ec 0c             	sub    $0xc,%esp
+     a66:	8d 98 00 29 00 00    	lea    0x2900(%eax),%ebx
+     a6c:	53                   	push   %ebx
+     a6d:	e8 0e 02 00 00       	call   c80 <flockfile>
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     a72:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     a75:	89 f2                	mov    %esi,%edx
+     a77:	89 d8                	mov    %ebx,%eax
+     a79:	e8 a2 fd ff ff       	call   820 <vfprintf>
+    funlockfile(&_iob[fd]);
+     a7e:	89 1c 24             	mov    %ebx,(%esp)
+     a81:	e8 2a 02 00 00       	call   cb0 <funlockfile>
+     a86:	83 c4 10             	add    $0x10,%esp
+}
+     a89:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     a8c:	5b                   	pop    %ebx
+     a8d:	5e                   	pop    %esi
+     a8e:	5d                   	pop    %ebp
+     a8f:	c3                   	ret
+
+00000a90 <setup>:
+}
+
+// Choose how to buffer f on first use: by lines on a device.
+static void
+setup(FILE *f)
+{
+     a90:	55                   	push   %ebp
+     a91:	89 e5                	mov    %esp,%ebp
+     a93:	53                   	push   %ebx
+     a94:	89 c3                	mov    %eax,%ebx
+     a96:	83 ec 2c             	sub    $0x2c,%esp
+  struct stat st;
+
+  f->flags |= IO_SETUP;
+     a99:	83 48 04 40          	orl    $0x40,0x4(%eax)
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     a9d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     aa0:	50                   	push   %eax
+     aa1:	ff 33                	push   (%ebx)
+     aa3:	e8 52 fb ff ff       	call   5fa <fstat>
+     aa8:	83 c4 10             	add    $0x10,%esp
+     aab:	85 c0                	test   %eax,%eax
+    f->flags |= IO_DEV|IO_LINE;
+     aad:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     ab0:	75 07                	jne    ab9 <setup+0x29>
+     ab2:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+     ab7:	74 17                	je     ad0 <setup+0x40>
+  if(f->flags & IO_WRITE)
+     ab9:	a8 02                	test   $0x2,%al
+     abb:	74 0a                	je     ac7 <setup+0x37>
+    flushhook = flushall;
+     abd:	c7 05 e4 29 00 00 f0 	movl   $0xbf0,0x29e4
+     ac4:	0b 00 00 
+}
+     ac7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     aca:	c9                   	leave
+     acb:	c3                   	ret
+     acc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    f->flags |= IO_DEV|IO_LINE;
+     ad0:	83 c8 30             	or     $0x30,%eax
+     ad3:	89 43 04             	mov    %eax,0x4(%ebx)
+     ad6:	eb e1                	jmp    ab9 <setup+0x29>
+     ad8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     adf:	90                   	nop
+
+00000ae0 <flush>:
+static int
+flush(FILE *f)
+{
+  int i, n;
+
+  if(!(f->flags & IO_WRITE))
+     ae0:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+     ae4:	74 6a                	je     b50 <flush+0x70>
+{
+     ae6:	55                   	push   %ebp
+     ae7:	89 e5                	mov    %esp,%ebp
+     ae9:	56                   	push   %esi
+     aea:	89 c6                	mov    %eax,%esi
+     aec:	53                   	push   %ebx
+    return 0;
+  for(i = 0; i < f->n; i += n){
+     aed:	8b 40 14             	mov    0x14(%eax),%eax
+     af0:	85 c0                	test   %eax,%eax
+     af2:	7e 4c                	jle    b40 <flush+0x60>
+     af4:	31 db                	xor    %ebx,%ebx
+     af6:	eb 11                	jmp    b09 <flush+0x29>
+     af8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aff:	90                   	nop
+     b00:	01 c3                	add    %eax,%ebx
+     b02:	8b 46 14             	mov    0x14(%esi),%eax
+     b05:	39 d8                	cmp    %ebx,%eax
+     b07:	7e 37                	jle    b40 <flush+0x60>
+    if((n = write(f->fd, f->buf + i, f->n - i)) <= 0){
+     b09:	83 ec 04             	sub    $0x4,%esp
+     b0c:	29 d8                	sub    %ebx,%eax
+     b0e:	50                   	push   %eax
+     b0f:	8b 46 08             	mov    0x8(%esi),%eax
+     b12:	01 d8                	add    %ebx,%eax
+     b14:	50                   	push   %eax
+     b15:	ff 36                	push   (%esi)
+     b17:	e8 75 fa ff ff       	call   591 <write>
+     b1c:	83 c4 10             	add    $0x10,%esp
+     b1f:	85 c0                	test   %eax,%eax
+     b21:	7f dd                	jg     b00 <flush+0x20>
+      f->flags |= IO_ERR;
+     b23:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+      f->n = 0;
+     b27:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     b2c:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+      return EOF;
+    }
+  }
+  f->n = 0;
+  return 0;
+}
+     b33:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b36:	5b                   	pop    %ebx
+     b37:	5e                   	pop    %esi
+     b38:	5d                   	pop    %ebp
+     b39:	c3                   	ret
+     b3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->n = 0;
+     b40:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+}
+     b47:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+     b4a:	31 c0                	xor    %eax,%eax
+}
+     b4c:	5b                   	pop    %ebx
+     b4d:	5e                   	pop    %esi
+     b4e:	5d                   	pop    %ebp
+     b4f:	c3                   	ret
+    return 0;
+     b50:	31 c0                	xor    %eax,%eax
+}
+     b52:	c3                   	ret
+     b53:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000b60 <fflush.part.0>:
+fflush(FILE *f)
+     b60:	55                   	push   %ebp
+     b61:	89 e5                	mov    %esp,%ebp
+     b63:	57                   	push   %edi
+     b64:	bf f8 29 00 00       	mov    $0x29f8,%edi
+     b69:	56                   	push   %esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     b6a:	31 f6                	xor    %esi,%esi
+fflush(FILE *f)
+     b6c:	53                   	push   %ebx
+     b6d:	bb 18 29 00 00       	mov    $0x2918,%ebx
+     b72:	83 ec 1c             	sub    $0x1c,%esp
+     b75:	eb 10                	jmp    b87 <fflush.part.0+0x27>
+     b77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b7e:	66 90                	xchg   %ax,%ax
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     b80:	83 c3 1c             	add    $0x1c,%ebx
+     b83:	39 df                	cmp    %ebx,%edi
+     b85:	74 33                	je     bba <fflush.part.0+0x5a>
+      if((f->flags & IO_WRITE) && fflush(f) < 0)
+     b87:	f6 43 ec 02          	testb  $0x2,-0x14(%ebx)
+     b8b:	74 f3                	je     b80 <fflush.part.0+0x20>
+  if(threaded)
+     b8d:	8b 0d 00 2a 00 00    	mov    0x2a00,%ecx
+     b93:	85 c9                	test   %ecx,%ecx
+     b95:	75 49                	jne    be0 <fflush.part.0+0x80>
+  r = flush(f);
+     b97:	8d 43 e8             	lea    -0x18(%ebx),%eax
+     b9a:	e8 41 ff ff ff       	call   ae0 <flush>
+  if(threaded)
+     b9f:	8b 15 00 2a 00 00    	mov    0x2a00,%edx
+     ba5:	85 d2                	test   %edx,%edx
+     ba7:	75 1f                	jne    bc8 <fflush.part.0+0x68>
+        r = EOF;
+     ba9:	85 c0                	test   %eax,%eax
+     bab:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     bb0:	0f 48 f0             	cmovs  %eax,%esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     bb3:	83 c3 1c             	add    $0x1c,%ebx
+     bb6:	39 df                	cmp    %ebx,%edi
+     bb8:	75 cd                	jne    b87 <fflush.part.0+0x27>
+}
+     bba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bbd:	89 f0                	mov    %esi,%eax
+     bbf:	5b                   	pop    %ebx
+     bc0:	5e                   	pop    %esi
+     bc1:	5f                   	pop    %edi
+     bc2:	5d                   	pop    %ebp
+     bc3:	c3                   	ret
+     bc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     bc8:	83 ec 0c             	sub    $0xc,%esp
+     bcb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     bce:	53                   	push   %ebx
+     bcf:	e8 9c f8 ff ff       	call   470 <mutex_unlock>
+     bd4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     bd7:	83 c4 10             	add    $0x10,%esp
+     bda:	eb cd                	jmp    ba9 <fflush.part.0+0x49>
+     bdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     be0:	83 ec 0c             	sub    $0xc,%esp
+     be3:	53                   	push   %ebx
+     be4:	e8 37 f8 ff ff       	call   420 <mutex_lock>
+     be9:	83 c4 10             	add    $0x10,%esp
+     bec:	eb a9                	jmp    b97 <fflush.part.0+0x37>
+     bee:	66 90                	xchg   %ax,%ax
+
+00000bf0 <flushall>:
+  if(f == 0){
+     bf0:	e9 6b ff ff ff       	jmp    b60 <fflush.part.0>
+     bf5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c00 <fill>:
+
+// Refill f's buffer. Returns the number of bytes read.
+// Caller holds f's lock.
+static int
+fill(FILE *f)
+{
+     c00:	55                   	push   %ebp
+     c01:	89 e5                	mov    %esp,%ebp
+     c03:	53                   	push   %ebx
+     c04:	89 c3                	mov    %eax,%ebx
+     c06:	83 ec 04             	sub    $0x4,%esp
+  int n;
+
+  if(!(f->flags & IO_SETUP))
+     c09:	8b 40 04             	mov    0x4(%eax),%eax
+     c0c:	a8 40                	test   $0x40,%al
+     c0e:	74 50                	je     c60 <fill+0x60>
+    setup(f);
+  if(f->flags & IO_DEV)
+     c10:	a8 20                	test   $0x20,%al
+     c12:	75 3c                	jne    c50 <fill+0x50>
+    fflush(0);
+  f->r = 0;
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     c14:	83 ec 04             	sub    $0x4,%esp
+  f->r = 0;
+     c17:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     c1e:	ff 73 0c             	push   0xc(%ebx)
+     c21:	ff 73 08             	push   0x8(%ebx)
+     c24:	ff 33                	push   (%ebx)
+     c26:	e8 57 f9 ff ff       	call   582 <read>
+     c2b:	83 c4 10             	add    $0x10,%esp
+     c2e:	85 c0                	test   %eax,%eax
+     c30:	7f 10                	jg     c42 <fill+0x42>
+    f->flags |= n < 0 ? IO_ERR : IO_EOF;
+     c32:	83 f8 01             	cmp    $0x1,%eax
+     c35:	19 c0                	sbb    %eax,%eax
+     c37:	83 e0 fc             	and    $0xfffffffc,%eax
+     c3a:	83 c0 08             	add    $0x8,%eax
+     c3d:	09 43 04             	or     %eax,0x4(%ebx)
+    n = 0;
+     c40:	31 c0                	xor    %eax,%eax
+  }
+  f->n = n;
+     c42:	89 43 14             	mov    %eax,0x14(%ebx)
+  return n;
+}
+     c45:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c48:	c9                   	leave
+     c49:	c3                   	ret
+     c4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == 0){
+     c50:	e8 0b ff ff ff       	call   b60 <fflush.part.0>
+     c55:	eb bd                	jmp    c14 <fill+0x14>
+     c57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c5e:	66 90                	xchg   %ax,%ax
+    setup(f);
+     c60:	89 d8                	mov    %ebx,%eax
+     c62:	e8 29 fe ff ff       	call   a90 <setup>
+  if(f->flags & IO_DEV)
+     c67:	8b 43 04             	mov    0x4(%ebx),%eax
+     c6a:	eb a4                	jmp    c10 <fill+0x10>
+     c6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c70 <stdio_threaded>:
+  threaded = 1;
+     c70:	c7 05 00 2a 00 00 01 	movl   $0x1,0x2a00
+     c77:	00 00 00 
+}
+     c7a:	c3                   	ret
+     c7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c7f:	90                   	nop
+
+00000c80 <flockfile>:
+{
+     c80:	55                   	push   %ebp
+  if(threaded)
+     c81:	8b 15 00 2a 00 00    	mov    0x2a00,%edx
+{
+     c87:	89 e5                	mov    %esp,%ebp
+     c89:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     c8c:	85 d2                	test   %edx,%edx
+     c8e:	75 08                	jne    c98 <flockfile+0x18>
+}
+     c90:	5d                   	pop    %ebp
+     c91:	c3                   	ret
+     c92:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_lock(&f->lock);
+     c98:	83 c0 18             	add    $0x18,%eax
+     c9b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     c9e:	5d                   	pop    %ebp
+    mutex_lock(&f->lock);
+     c9f:	e9 7c f7 ff ff       	jmp    420 <mutex_lock>
+     ca4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     caf:	90                   	nop
+
+00000cb0 <funlockfile>:
+{
+     cb0:	55                   	push   %ebp
+  if(threaded)
+     cb1:	8b 15 00 2a 00 00    	mov    0x2a00,%edx
+{
+     cb7:	89 e5                	mov    %esp,%ebp
+     cb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     cbc:	85 d2                	test   %edx,%edx
+     cbe:	75 08                	jne    cc8 <funlockfile+0x18>
+}
+     cc0:	5d                   	pop    %ebp
+     cc1:	c3                   	ret
+     cc2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&f->lock);
+     cc8:	83 c0 18             	add    $0x18,%eax
+     ccb:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     cce:	5d                   	pop    %ebp
+    mutex_unlock(&f->lock);
+     ccf:	e9 9c f7 ff ff       	jmp    470 <mutex_unlock>
+     cd4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cdf:	90                   	nop
+
+00000ce0 <fopen>:
+{
+     ce0:	55                   	push   %ebp
+     ce1:	89 e5                	mov    %esp,%ebp
+     ce3:	57                   	push   %edi
+     ce4:	56                   	push   %esi
+     ce5:	53                   	push   %ebx
+     ce6:	83 ec 34             	sub    $0x34,%esp
+     ce9:	8b 75 0c             	mov    0xc(%ebp),%esi
+     cec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(strcmp(mode, "r") != 0 && strcmp(mode, "w") != 0)
+     cef:	68 59 1f 00 00       	push   $0x1f59
+     cf4:	56                   	push   %esi
+     cf5:	e8 66 f5 ff ff       	call   260 <strcmp>
+     cfa:	83 c4 10             	add    $0x10,%esp
+     cfd:	85 c0                	test   %eax,%eax
+     cff:	74 15                	je     d16 <fopen+0x36>
+     d01:	83 ec 08             	sub    $0x8,%esp
+     d04:	68 5b 1f 00 00       	push   $0x1f5b
+     d09:	56                   	push   %esi
+     d0a:	e8 51 f5 ff ff       	call   260 <strcmp>
+     d0f:	83 c4 10             	add    $0x10,%esp
+     d12:	85 c0                	test   %eax,%eax
+     d14:	75 2c                	jne    d42 <fopen+0x62>
+  if(threaded)
+     d16:	a1 00 2a 00 00       	mov    0x2a00,%eax
+     d1b:	85 c0                	test   %eax,%eax
+     d1d:	0f 85 ed 00 00 00    	jne    e10 <fopen+0x130>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     d23:	bb 54 29 00 00       	mov    $0x2954,%ebx
+    if(f->flags == 0)
+     d28:	8b 53 04             	mov    0x4(%ebx),%edx
+     d2b:	85 d2                	test   %edx,%edx
+     d2d:	74 21                	je     d50 <fopen+0x70>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     d2f:	83 c3 1c             	add    $0x1c,%ebx
+     d32:	81 fb e0 29 00 00    	cmp    $0x29e0,%ebx
+     d38:	75 ee                	jne    d28 <fopen+0x48>
+  if(threaded)
+     d3a:	85 c0                	test   %eax,%eax
+     d3c:	0f 85 36 01 00 00    	jne    e78 <fopen+0x198>
+    return 0;
+     d42:	31 db                	xor    %ebx,%ebx
+     d44:	e9 96 00 00 00       	jmp    ddf <fopen+0xff>
+     d49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f == &_iob[NSTREAM])
+     d50:	81 fb e0 29 00 00    	cmp    $0x29e0,%ebx
+     d56:	74 e2                	je     d3a <fopen+0x5a>
+    f->flags = IO_MALLOC;
+     d58:	c7 43 04 80 00 00 00 	movl   $0x80,0x4(%ebx)
+  if(threaded)
+     d5f:	85 c0                	test   %eax,%eax
+     d61:	0f 85 f9 00 00 00    	jne    e60 <fopen+0x180>
+  if(mode[0] == 'r'){
+     d67:	80 3e 72             	cmpb   $0x72,(%esi)
+     d6a:	0f 84 c0 00 00 00    	je     e30 <fopen+0x150>
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     d70:	83 ec 08             	sub    $0x8,%esp
+     d73:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     d76:	50                   	push   %eax
+     d77:	57                   	push   %edi
+     d78:	e8 d3 f5 ff ff       	call   350 <stat>
+     d7d:	83 c4 10             	add    $0x10,%esp
+     d80:	85 c0                	test   %eax,%eax
+     d82:	74 6c                	je     df0 <fopen+0x110>
+    fd = open(path, O_CREATE|O_WRONLY);
+     d84:	83 ec 08             	sub    $0x8,%esp
+     d87:	68 01 02 00 00       	push   $0x201
+     d8c:	57                   	push   %edi
+    flags = IO_WRITE;
+     d8d:	bf 02 00 00 00       	mov    $0x2,%edi
+    fd = open(path, O_CREATE|O_WRONLY);
+     d92:	e8 36 f8 ff ff       	call   5cd <open>
+     d97:	83 c4 10             	add    $0x10,%esp
+     d9a:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     d9c:	85 f6                	test   %esi,%esi
+     d9e:	0f 88 a9 00 00 00    	js     e4d <fopen+0x16d>
+     da4:	83 ec 0c             	sub    $0xc,%esp
+     da7:	68 00 02 00 00       	push   $0x200
+     dac:	e8 af 0c 00 00       	call   1a60 <malloc>
+     db1:	83 c4 10             	add    $0x10,%esp
+     db4:	89 43 08             	mov    %eax,0x8(%ebx)
+     db7:	85 c0                	test   %eax,%eax
+     db9:	0f 84 d0 00 00 00    	je     e8f <fopen+0x1af>
+  f->flags = flags|IO_MALLOC;
+     dbf:	81 cf 80 00 00 00    	or     $0x80,%edi
+  f->fd = fd;
+     dc5:	89 33                	mov    %esi,(%ebx)
+  f->size = BUFSIZ;
+     dc7:	c7 43 0c 00 02 00 00 	movl   $0x200,0xc(%ebx)
+  f->r = f->n = 0;
+     dce:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+     dd5:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  f->flags = flags|IO_MALLOC;
+     ddc:	89 7b 04             	mov    %edi,0x4(%ebx)
+}
+     ddf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     de2:	89 d8                	mov    %ebx,%eax
+     de4:	5b                   	pop    %ebx
+     de5:	5e                   	pop    %esi
+     de6:	5f                   	pop    %edi
+     de7:	5d                   	pop    %ebp
+     de8:	c3                   	ret
+     de9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     df0:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+     df5:	75 8d                	jne    d84 <fopen+0xa4>
+      unlink(path);
+     df7:	83 ec 0c             	sub    $0xc,%esp
+     dfa:	57                   	push   %edi
+     dfb:	e8 eb f7 ff ff       	call   5eb <unlink>
+     e00:	83 c4 10             	add    $0x10,%esp
+     e03:	e9 7c ff ff ff       	jmp    d84 <fopen+0xa4>
+     e08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e0f:	90                   	nop
+    mutex_lock(&iolock);
+     e10:	83 ec 0c             	sub    $0xc,%esp
+     e13:	68 04 2a 00 00       	push   $0x2a04
+     e18:	e8 03 f6 ff ff       	call   420 <mutex_lock>
+  if(threaded)
+     e1d:	a1 00 2a 00 00       	mov    0x2a00,%eax
+     e22:	83 c4 10             	add    $0x10,%esp
+     e25:	e9 f9 fe ff ff       	jmp    d23 <fopen+0x43>
+     e2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    fd = open(path, O_RDONLY);
+     e30:	83 ec 08             	sub    $0x8,%esp
+     e33:	6a 00                	push   $0x0
+     e35:	57                   	push   %edi
+    flags = IO_READ;
+     e36:	bf 01 00 00 00       	mov    $0x1,%edi
+    fd = open(path, O_RDONLY);
+     e3b:	e8 8d f7 ff ff       	call   5cd <open>
+     e40:	83 c4 10             	add    $0x10,%esp
+     e43:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     e45:	85 f6                	test   %esi,%esi
+     e47:	0f 89 57 ff ff ff    	jns    da4 <fopen+0xc4>
+    f->flags = 0;
+     e4d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    return 0;
+     e54:	31 db                	xor    %ebx,%ebx
+     e56:	eb 87                	jmp    ddf <fopen+0xff>
+     e58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e5f:	90                   	nop
+    mutex_unlock(&iolock);
+     e60:	83 ec 0c             	sub    $0xc,%esp
+     e63:	68 04 2a 00 00       	push   $0x2a04
+     e68:	e8 03 f6 ff ff       	call   470 <mutex_unlock>
+     e6d:	83 c4 10             	add    $0x10,%esp
+     e70:	e9 f2 fe ff ff       	jmp    d67 <fopen+0x87>
+     e75:	8d 76 00             	lea    0x0(%esi),%esi
+     e78:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+     e7b:	31 db                	xor    %ebx,%ebx
+    mutex_unlock(&iolock);
+     e7d:	68 04 2a 00 00       	push   $0x2a04
+     e82:	e8 e9 f5 ff ff       	call   470 <mutex_unlock>
+     e87:	83 c4 10             	add    $0x10,%esp
+     e8a:	e9 50 ff ff ff       	jmp    ddf <fopen+0xff>
+      close(fd);
+     e8f:	83 ec 0c             	sub    $0xc,%esp
+     e92:	56                   	push   %esi
+     e93:	e8 08 f7 ff ff       	call   5a0 <close>
+     e98:	83 c4 10             	add    $0x10,%esp
+     e9b:	eb b0                	jmp    e4d <fopen+0x16d>
+     e9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ea0 <fclose>:
+{
+     ea0:	55                   	push   %ebp
+     ea1:	89 e5                	mov    %esp,%ebp
+     ea3:	56                   	push   %esi
+     ea4:	53                   	push   %ebx
+  if(threaded)
+     ea5:	8b 15 00 2a 00 00    	mov    0x2a00,%edx
+{
+     eab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+     eae:	85 d2                	test   %edx,%edx
+     eb0:	75 46                	jne    ef8 <fclose+0x58>
+  r = flush(f);
+     eb2:	89 d8                	mov    %ebx,%eax
+     eb4:	e8 27 fc ff ff       	call   ae0 <flush>
+  if(close(f->fd) < 0)
+     eb9:	83 ec 0c             	sub    $0xc,%esp
+     ebc:	ff 33                	push   (%ebx)
+  r = flush(f);
+     ebe:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+     ec0:	e8 db f6 ff ff       	call   5a0 <close>
+     ec5:	83 c4 10             	add    $0x10,%esp
+    r = EOF;
+     ec8:	85 c0                	test   %eax,%eax
+     eca:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     ecf:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->flags & IO_MALLOC)
+     ed2:	f6 43 04 80          	testb  $0x80,0x4(%ebx)
+     ed6:	75 58                	jne    f30 <fclose+0x90>
+  if(threaded)
+     ed8:	a1 00 2a 00 00       	mov    0x2a00,%eax
+  f->flags = 0;
+     edd:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  if(threaded)
+     ee4:	85 c0                	test   %eax,%eax
+     ee6:	75 28                	jne    f10 <fclose+0x70>
+}
+     ee8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     eeb:	89 f0                	mov    %esi,%eax
+     eed:	5b                   	pop    %ebx
+     eee:	5e                   	pop    %esi
+     eef:	5d                   	pop    %ebp
+     ef0:	c3                   	ret
+     ef1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     ef8:	83 ec 0c             	sub    $0xc,%esp
+     efb:	8d 43 18             	lea    0x18(%ebx),%eax
+     efe:	50                   	push   %eax
+     eff:	e8 1c f5 ff ff       	call   420 <mutex_lock>
+     f04:	83 c4 10             	add    $0x10,%esp
+     f07:	eb a9                	jmp    eb2 <fclose+0x12>
+     f09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     f10:	83 ec 0c             	sub    $0xc,%esp
+     f13:	83 c3 18             	add    $0x18,%ebx
+     f16:	53                   	push   %ebx
+     f17:	e8 54 f5 ff ff       	call   470 <mutex_unlock>
+     f1c:	83 c4 10             	add    $0x10,%esp
+}
+     f1f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f22:	89 f0                	mov    %esi,%eax
+     f24:	5b                   	pop    %ebx
+     f25:	5e                   	pop    %esi
+     f26:	5d                   	pop    %ebp
+     f27:	c3                   	ret
+     f28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f2f:	90                   	nop
+    free(f->buf);
+     f30:	83 ec 0c             	sub    $0xc,%esp
+     f33:	ff 73 08             	push   0x8(%ebx)
+     f36:	e8 f5 09 00 00       	call   1930 <free>
+     f3b:	83 c4 10             	add    $0x10,%esp
+     f3e:	eb 98                	jmp    ed8 <fclose+0x38>
+
+00000f40 <fflush>:
+{
+     f40:	55                   	push   %ebp
+     f41:	89 e5                	mov    %esp,%ebp
+     f43:	53                   	push   %ebx
+     f44:	83 ec 14             	sub    $0x14,%esp
+     f47:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f == 0){
+     f4a:	85 db                	test   %ebx,%ebx
+     f4c:	74 5a                	je     fa8 <fflush+0x68>
+  if(threaded)
+     f4e:	8b 0d 00 2a 00 00    	mov    0x2a00,%ecx
+     f54:	85 c9                	test   %ecx,%ecx
+     f56:	75 18                	jne    f70 <fflush+0x30>
+  r = flush(f);
+     f58:	89 d8                	mov    %ebx,%eax
+     f5a:	e8 81 fb ff ff       	call   ae0 <flush>
+  if(threaded)
+     f5f:	8b 15 00 2a 00 00    	mov    0x2a00,%edx
+     f65:	85 d2                	test   %edx,%edx
+     f67:	75 1f                	jne    f88 <fflush+0x48>
+}
+     f69:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f6c:	c9                   	leave
+     f6d:	c3                   	ret
+     f6e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+     f70:	83 ec 0c             	sub    $0xc,%esp
+     f73:	8d 43 18             	lea    0x18(%ebx),%eax
+     f76:	50                   	push   %eax
+     f77:	e8 a4 f4 ff ff       	call   420 <mutex_lock>
+     f7c:	83 c4 10             	add    $0x10,%esp
+     f7f:	eb d7                	jmp    f58 <fflush+0x18>
+     f81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     f88:	83 ec 0c             	sub    $0xc,%esp
+     f8b:	83 c3 18             	add    $0x18,%ebx
+     f8e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     f91:	53                   	push   %ebx
+     f92:	e8 d9 f4 ff ff       	call   470 <mutex_unlock>
+     f97:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     f9a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    mutex_unlock(&f->lock);
+     f9d:	83 c4 10             	add    $0x10,%esp
+}
+     fa0:	c9                   	leave
+     fa1:	c3                   	ret
+     fa2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     fa8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     fab:	c9                   	leave
+     fac:	e9 af fb ff ff       	jmp    b60 <fflush.part.0>
+     fb1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fbf:	90                   	nop
+
+00000fc0 <putc_unlocked>:
+{
+     fc0:	55                   	push   %ebp
+     fc1:	89 e5                	mov    %esp,%ebp
+     fc3:	56                   	push   %esi
+     fc4:	53                   	push   %ebx
+     fc5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     fc8:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(!(f->flags & IO_WRITE))
+     fcb:	8b 43 04             	mov    0x4(%ebx),%eax
+     fce:	a8 02                	test   $0x2,%al
+     fd0:	74 46                	je     1018 <putc_unlocked+0x58>
+  if(!(f->flags & IO_SETUP))
+     fd2:	a8 40                	test   $0x40,%al
+     fd4:	74 4a                	je     1020 <putc_unlocked+0x60>
+  if(f->n == f->size && flush(f) < 0)
+     fd6:	8b 43 14             	mov    0x14(%ebx),%eax
+     fd9:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     fdc:	74 51                	je     102f <putc_unlocked+0x6f>
+  f->buf[f->n++] = c;
+     fde:	8d 48 01             	lea    0x1(%eax),%ecx
+     fe1:	8b 53 08             	mov    0x8(%ebx),%edx
+     fe4:	89 4b 14             	mov    %ecx,0x14(%ebx)
+     fe7:	89 f1                	mov    %esi,%ecx
+     fe9:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     fec:	83 fe 0a             	cmp    $0xa,%esi
+     fef:	74 0f                	je     1000 <putc_unlocked+0x40>
+  return c & 0xff;
+     ff1:	89 f0                	mov    %esi,%eax
+     ff3:	0f b6 c0             	movzbl %al,%eax
+}
+     ff6:	5b                   	pop    %ebx
+     ff7:	5e                   	pop    %esi
+     ff8:	5d                   	pop    %ebp
+     ff9:	c3                   	ret
+     ffa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    1000:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1004:	74 eb                	je     ff1 <putc_unlocked+0x31>
+    1006:	89 d8                	mov    %ebx,%eax
+    1008:	e8 d3 fa ff ff       	call   ae0 <flush>
+    100d:	85 c0                	test   %eax,%eax
+    100f:	79 e0                	jns    ff1 <putc_unlocked+0x31>
+    1011:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return EOF;
+    1018:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    101d:	eb d7                	jmp    ff6 <putc_unlocked+0x36>
+    101f:	90                   	nop
+    setup(f);
+    1020:	89 d8                	mov    %ebx,%eax
+    1022:	e8 69 fa ff ff       	call   a90 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    1027:	8b 43 14             	mov    0x14(%ebx),%eax
+    102a:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    102d:	75 af                	jne    fde <putc_unlocked+0x1e>
+    102f:	89 d8                	mov    %ebx,%eax
+    1031:	e8 aa fa ff ff       	call   ae0 <flush>
+    1036:	85 c0                	test   %eax,%eax
+    1038:	78 de                	js     1018 <putc_unlocked+0x58>
+  f->buf[f->n++] = c;
+    103a:	8b 43 14             	mov    0x14(%ebx),%eax
+    103d:	eb 9f                	jmp    fde <putc_unlocked+0x1e>
+    103f:	90                   	nop
+
+00001040 <fputc>:
+{
+    1040:	55                   	push   %ebp
+    1041:	89 e5                	mov    %esp,%ebp
+    1043:	56                   	push   %esi
+    1044:	53                   	push   %ebx
+  if(threaded)
+    1045:	8b 15 00 2a 00 00    	mov    0x2a00,%edx
+{
+    104b:	8b 75 08             	mov    0x8(%ebp),%esi
+    104e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(threaded)
+    1051:	85 d2                	test   %edx,%edx
+    1053:	75 6b                	jne    10c0 <fputc+0x80>
+  if(!(f->flags & IO_WRITE))
+    1055:	8b 43 04             	mov    0x4(%ebx),%eax
+    1058:	a8 02                	test   $0x2,%al
+    105a:	0f 84 b8 00 00 00    	je     1118 <fputc+0xd8>
+  if(!(f->flags & IO_SETUP))
+    1060:	a8 40                	test   $0x40,%al
+    1062:	74 76                	je     10da <fputc+0x9a>
+  if(f->n == f->size && flush(f) < 0)
+    1064:	8b 43 14             	mov    0x14(%ebx),%eax
+    1067:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    106a:	74 7d                	je     10e9 <fputc+0xa9>
+  f->buf[f->n++] = c;
+    106c:	8d 48 01             	lea    0x1(%eax),%ecx
+    106f:	8b 53 08             	mov    0x8(%ebx),%edx
+    1072:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    1075:	89 f1                	mov    %esi,%ecx
+    1077:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    107a:	83 fe 0a             	cmp    $0xa,%esi
+    107d:	74 21                	je     10a0 <fputc+0x60>
+  return c & 0xff;
+    107f:	89 f0                	mov    %esi,%eax
+    1081:	0f b6 f0             	movzbl %al,%esi
+  if(threaded)
+    1084:	a1 00 2a 00 00       	mov    0x2a00,%eax
+    1089:	85 c0                	test   %eax,%eax
+    108b:	75 73                	jne    1100 <fputc+0xc0>
+}
+    108d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1090:	89 f0                	mov    %esi,%eax
+    1092:	5b                   	pop    %ebx
+    1093:	5e                   	pop    %esi
+    1094:	5d                   	pop    %ebp
+    1095:	c3                   	ret
+    1096:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    109d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    10a0:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    10a4:	74 d9                	je     107f <fputc+0x3f>
+    10a6:	89 d8                	mov    %ebx,%eax
+    10a8:	e8 33 fa ff ff       	call   ae0 <flush>
+    10ad:	85 c0                	test   %eax,%eax
+    10af:	79 ce                	jns    107f <fputc+0x3f>
+    return EOF;
+    10b1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    10b6:	eb cc                	jmp    1084 <fputc+0x44>
+    10b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10bf:	90                   	nop
+    mutex_lock(&f->lock);
+    10c0:	83 ec 0c             	sub    $0xc,%esp
+    10c3:	8d 43 18             	lea    0x18(%ebx),%eax
+    10c6:	50                   	push   %eax
+    10c7:	e8 54 f3 ff ff       	call   420 <mutex_lock>
+  if(!(f->flags & IO_WRITE))
+    10cc:	8b 43 04             	mov    0x4(%ebx),%eax
+    10cf:	83 c4 10             	add    $0x10,%esp
+    10d2:	a8 02                	test   $0x2,%al
+    10d4:	74 db                	je     10b1 <fputc+0x71>
+  if(!(f->flags & IO_SETUP))
+    10d6:	a8 40                	test   $0x40,%al
+    10d8:	75 8a                	jne    1064 <fputc+0x24>
+    setup(f);
+    10da:	89 d8                	mov    %ebx,%eax
+    10dc:	e8 af f9 ff ff       	call   a90 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    10e1:	8b 43 14             	mov    0x14(%ebx),%eax
+    10e4:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    10e7:	75 83                	jne    106c <fputc+0x2c>
+    10e9:	89 d8                	mov    %ebx,%eax
+    10eb:	e8 f0 f9 ff ff       	call   ae0 <flush>
+    10f0:	85 c0                	test   %eax,%eax
+    10f2:	78 bd                	js     10b1 <fputc+0x71>
+  f->buf[f->n++] = c;
+    10f4:	8b 43 14             	mov    0x14(%ebx),%eax
+    10f7:	e9 70 ff ff ff       	jmp    106c <fputc+0x2c>
+    10fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1100:	83 ec 0c             	sub    $0xc,%esp
+    1103:	83 c3 18             	add    $0x18,%ebx
+    1106:	53                   	push   %ebx
+    1107:	e8 64 f3 ff ff       	call   470 <mutex_unlock>
+    110c:	83 c4 10             	add    $0x10,%esp
+}
+    110f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1112:	89 f0                	mov    %esi,%eax
+    1114:	5b                   	pop    %ebx
+    1115:	5e                   	pop    %esi
+    1116:	5d                   	pop    %ebp
+    1117:	c3                   	ret
+    return EOF;
+    1118:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    111d:	e9 6b ff ff ff       	jmp    108d <fputc+0x4d>
+    1122:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1129:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001130 <fwrite>:
+{
+    1130:	55                   	push   %ebp
+    1131:	89 e5                	mov    %esp,%ebp
+    1133:	57                   	push   %edi
+    1134:	56                   	push   %esi
+    1135:	53                   	push   %ebx
+    1136:	83 ec 1c             	sub    $0x1c,%esp
+    1139:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  if(!(f->flags & IO_WRITE) || size <= 0)
+    113c:	8b 43 04             	mov    0x4(%ebx),%eax
+    113f:	a8 02                	test   $0x2,%al
+    1141:	0f 84 ec 00 00 00    	je     1233 <fwrite+0x103>
+    1147:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    114a:	85 c9                	test   %ecx,%ecx
+    114c:	0f 8e e1 00 00 00    	jle    1233 <fwrite+0x103>
+  if(threaded)
+    1152:	8b 15 00 2a 00 00    	mov    0x2a00,%edx
+    1158:	85 d2                	test   %edx,%edx
+    115a:	0f 85 1c 01 00 00    	jne    127c <fwrite+0x14c>
+  if(!(f->flags & IO_SETUP))
+    1160:	a8 40                	test   $0x40,%al
+    1162:	0f 84 08 01 00 00    	je     1270 <fwrite+0x140>
+  for(len = size*nmemb; len > 0; len -= n){
+    1168:	8b 45 0c             	mov    0xc(%ebp),%eax
+    116b:	0f af 45 10          	imul   0x10(%ebp),%eax
+    116f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    1172:	85 c0                	test   %eax,%eax
+    1174:	0f 8e 2a 01 00 00    	jle    12a4 <fwrite+0x174>
+  s = p;
+    117a:	8b 45 08             	mov    0x8(%ebp),%eax
+  nl = 0;
+    117d:	31 ff                	xor    %edi,%edi
+    117f:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+        nl = 1;
+    1182:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  s = p;
+    1185:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1188:	8b 43 14             	mov    0x14(%ebx),%eax
+        nl = 1;
+    118b:	89 ce                	mov    %ecx,%esi
+    if(f->n == f->size && flush(f) < 0)
+    118d:	89 c2                	mov    %eax,%edx
+    118f:	39 f0                	cmp    %esi,%eax
+    1191:	74 6e                	je     1201 <fwrite+0xd1>
+    1193:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1197:	90                   	nop
+    if(n > len)
+    1198:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    n = f->size - f->n;
+    119b:	89 f1                	mov    %esi,%ecx
+    119d:	29 c1                	sub    %eax,%ecx
+    119f:	39 f9                	cmp    %edi,%ecx
+    11a1:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    11a4:	85 c9                	test   %ecx,%ecx
+    11a6:	0f 8e 7c 00 00 00    	jle    1228 <fwrite+0xf8>
+    11ac:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    11af:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    11b2:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    11b5:	8d 34 08             	lea    (%eax,%ecx,1),%esi
+    11b8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    11bb:	eb 06                	jmp    11c3 <fwrite+0x93>
+    11bd:	8d 76 00             	lea    0x0(%esi),%esi
+      if((f->buf[f->n++] = s[i]) == '\n')
+    11c0:	8b 53 14             	mov    0x14(%ebx),%edx
+    11c3:	8d 4a 01             	lea    0x1(%edx),%ecx
+    11c6:	8b 73 08             	mov    0x8(%ebx),%esi
+    11c9:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    11cc:	0f b6 08             	movzbl (%eax),%ecx
+        nl = 1;
+    11cf:	80 f9 0a             	cmp    $0xa,%cl
+      if((f->buf[f->n++] = s[i]) == '\n')
+    11d2:	88 0c 16             	mov    %cl,(%esi,%edx,1)
+        nl = 1;
+    11d5:	be 01 00 00 00       	mov    $0x1,%esi
+    11da:	0f 44 fe             	cmove  %esi,%edi
+    for(i = 0; i < n; i++)
+    11dd:	83 c0 01             	add    $0x1,%eax
+    11e0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    11e3:	75 db                	jne    11c0 <fwrite+0x90>
+    s += n;
+    11e5:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    11e8:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    11eb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    s += n;
+    11ee:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    11f1:	85 c0                	test   %eax,%eax
+    11f3:	7e 48                	jle    123d <fwrite+0x10d>
+    11f5:	8b 43 14             	mov    0x14(%ebx),%eax
+    11f8:	8b 73 0c             	mov    0xc(%ebx),%esi
+    if(f->n == f->size && flush(f) < 0)
+    11fb:	89 c2                	mov    %eax,%edx
+    11fd:	39 f0                	cmp    %esi,%eax
+    11ff:	75 97                	jne    1198 <fwrite+0x68>
+    1201:	89 d8                	mov    %ebx,%eax
+    1203:	e8 d8 f8 ff ff       	call   ae0 <flush>
+    1208:	85 c0                	test   %eax,%eax
+    120a:	78 31                	js     123d <fwrite+0x10d>
+    n = f->size - f->n;
+    120c:	8b 73 0c             	mov    0xc(%ebx),%esi
+    120f:	8b 43 14             	mov    0x14(%ebx),%eax
+    1212:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    1215:	89 f1                	mov    %esi,%ecx
+    1217:	89 c2                	mov    %eax,%edx
+    1219:	29 c1                	sub    %eax,%ecx
+    121b:	39 f9                	cmp    %edi,%ecx
+    121d:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1220:	85 c9                	test   %ecx,%ecx
+    1222:	7f 88                	jg     11ac <fwrite+0x7c>
+    1224:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    s += n;
+    1228:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    122b:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    122e:	e9 5a ff ff ff       	jmp    118d <fwrite+0x5d>
+}
+    1233:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    1236:	31 c0                	xor    %eax,%eax
+}
+    1238:	5b                   	pop    %ebx
+    1239:	5e                   	pop    %esi
+    123a:	5f                   	pop    %edi
+    123b:	5d                   	pop    %ebp
+    123c:	c3                   	ret
+  if(nl && (f->flags & IO_LINE))
+    123d:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1240:	85 ff                	test   %edi,%edi
+    1242:	74 06                	je     124a <fwrite+0x11a>
+    1244:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1248:	75 1d                	jne    1267 <fwrite+0x137>
+  return (s - (const char*)p) / size;
+    124a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    124d:	2b 75 08             	sub    0x8(%ebp),%esi
+  if(threaded)
+    1250:	a1 00 2a 00 00       	mov    0x2a00,%eax
+    1255:	85 c0                	test   %eax,%eax
+    1257:	75 3a                	jne    1293 <fwrite+0x163>
+  return (s - (const char*)p) / size;
+    1259:	89 f0                	mov    %esi,%eax
+    125b:	99                   	cltd
+    125c:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    125f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1262:	5b                   	pop    %ebx
+    1263:	5e                   	pop    %esi
+    1264:	5f                   	pop    %edi
+    1265:	5d                   	pop    %ebp
+    1266:	c3                   	ret
+    flush(f);
+    1267:	89 d8                	mov    %ebx,%eax
+    1269:	e8 72 f8 ff ff       	call   ae0 <flush>
+    126e:	eb da                	jmp    124a <fwrite+0x11a>
+    setup(f);
+    1270:	89 d8                	mov    %ebx,%eax
+    1272:	e8 19 f8 ff ff       	call   a90 <setup>
+    1277:	e9 ec fe ff ff       	jmp    1168 <fwrite+0x38>
+    mutex_lock(&f->lock);
+    127c:	83 ec 0c             	sub    $0xc,%esp
+    127f:	8d 43 18             	lea    0x18(%ebx),%eax
+    1282:	50                   	push   %eax
+    1283:	e8 98 f1 ff ff       	call   420 <mutex_lock>
+  if(!(f->flags & IO_SETUP))
+    1288:	8b 43 04             	mov    0x4(%ebx),%eax
+    128b:	83 c4 10             	add    $0x10,%esp
+    128e:	e9 cd fe ff ff       	jmp    1160 <fwrite+0x30>
+    mutex_unlock(&f->lock);
+    1293:	83 ec 0c             	sub    $0xc,%esp
+    1296:	83 c3 18             	add    $0x18,%ebx
+    1299:	53                   	push   %ebx
+    129a:	e8 d1 f1 ff ff       	call   470 <mutex_unlock>
+    129f:	83 c4 10             	add    $0x10,%esp
+    12a2:	eb b5                	jmp    1259 <fwrite+0x129>
+  for(len = size*nmemb; len > 0; len -= n){
+    12a4:	31 f6                	xor    %esi,%esi
+    12a6:	eb a8                	jmp    1250 <fwrite+0x120>
+    12a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12af:	90                   	nop
+
+000012b0 <fgetc>:
+  return f->buf[f->r++] & 0xff;
+}
+
+int
+fgetc(FILE *f)
+{
+    12b0:	55                   	push   %ebp
+    12b1:	89 e5                	mov    %esp,%ebp
+    12b3:	56                   	push   %esi
+    12b4:	53                   	push   %ebx
+  if(threaded)
+    12b5:	8b 15 00 2a 00 00    	mov    0x2a00,%edx
+{
+    12bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    12be:	85 d2                	test   %edx,%edx
+    12c0:	75 2e                	jne    12f0 <fgetc+0x40>
+  if(!(f->flags & IO_READ))
+    12c2:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    12c6:	74 78                	je     1340 <fgetc+0x90>
+  if(f->r == f->n && fill(f) == 0)
+    12c8:	8b 43 10             	mov    0x10(%ebx),%eax
+    12cb:	3b 43 14             	cmp    0x14(%ebx),%eax
+    12ce:	74 60                	je     1330 <fgetc+0x80>
+  return f->buf[f->r++] & 0xff;
+    12d0:	8b 53 08             	mov    0x8(%ebx),%edx
+    12d3:	8d 48 01             	lea    0x1(%eax),%ecx
+    12d6:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    12d9:	0f b6 34 02          	movzbl (%edx,%eax,1),%esi
+  if(threaded)
+    12dd:	a1 00 2a 00 00       	mov    0x2a00,%eax
+    12e2:	85 c0                	test   %eax,%eax
+    12e4:	75 2a                	jne    1310 <fgetc+0x60>
+
+  flockfile(f);
+  c = getc_unlocked(f);
+  funlockfile(f);
+  return c;
+}
+    12e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12e9:	89 f0                	mov    %esi,%eax
+    12eb:	5b                   	pop    %ebx
+    12ec:	5e                   	pop    %esi
+    12ed:	5d                   	pop    %ebp
+    12ee:	c3                   	ret
+    12ef:	90                   	nop
+    mutex_lock(&f->lock);
+    12f0:	83 ec 0c             	sub    $0xc,%esp
+    12f3:	8d 43 18             	lea    0x18(%ebx),%eax
+    12f6:	50                   	push   %eax
+    12f7:	e8 24 f1 ff ff       	call   420 <mutex_lock>
+  if(!(f->flags & IO_READ))
+    12fc:	83 c4 10             	add    $0x10,%esp
+    12ff:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1303:	75 c3                	jne    12c8 <fgetc+0x18>
+    return EOF;
+    1305:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    130a:	eb d1                	jmp    12dd <fgetc+0x2d>
+    130c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1310:	83 ec 0c             	sub    $0xc,%esp
+    1313:	83 c3 18             	add    $0x18,%ebx
+    1316:	53                   	push   %ebx
+    1317:	e8 54 f1 ff ff       	call   470 <mutex_unlock>
+    131c:	83 c4 10             	add    $0x10,%esp
+}
+    131f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1322:	89 f0                	mov    %esi,%eax
+    1324:	5b                   	pop    %ebx
+    1325:	5e                   	pop    %esi
+    1326:	5d                   	pop    %ebp
+    1327:	c3                   	ret
+    1328:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    132f:	90                   	nop
+  if(f->r == f->n && fill(f) == 0)
+    1330:	89 d8                	mov    %ebx,%eax
+    1332:	e8 c9 f8 ff ff       	call   c00 <fill>
+    1337:	85 c0                	test   %eax,%eax
+    1339:	74 ca                	je     1305 <fgetc+0x55>
+  return f->buf[f->r++] & 0xff;
+    133b:	8b 43 10             	mov    0x10(%ebx),%eax
+    133e:	eb 90                	jmp    12d0 <fgetc+0x20>
+    return EOF;
+    1340:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    1345:	eb 9f                	jmp    12e6 <fgetc+0x36>
+    1347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    134e:	66 90                	xchg   %ax,%ax
+
+00001350 <fread>:
+
+int
+fread(void *p, int size, int nmemb, FILE *f)
+{
+    1350:	55                   	push   %ebp
+    1351:	89 e5                	mov    %esp,%ebp
+    1353:	57                   	push   %edi
+    1354:	56                   	push   %esi
+    1355:	53                   	push   %ebx
+    1356:	83 ec 1c             	sub    $0x1c,%esp
+    1359:	8b 75 14             	mov    0x14(%ebp),%esi
+  char *d;
+  int n, len;
+
+  if(!(f->flags & IO_READ) || size <= 0)
+    135c:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+    1360:	74 7e                	je     13e0 <fread+0x90>
+    1362:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1365:	85 d2                	test   %edx,%edx
+    1367:	7e 77                	jle    13e0 <fread+0x90>
+  if(threaded)
+    1369:	a1 00 2a 00 00       	mov    0x2a00,%eax
+    return 0;
+  flockfile(f);
+  d = p;
+  for(len = size*nmemb; len > 0; len -= n){
+    136e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1371:	0f af 7d 10          	imul   0x10(%ebp),%edi
+  if(threaded)
+    1375:	85 c0                	test   %eax,%eax
+    1377:	0f 85 93 00 00 00    	jne    1410 <fread+0xc0>
+  for(len = size*nmemb; len > 0; len -= n){
+    137d:	85 ff                	test   %edi,%edi
+    137f:	7e 61                	jle    13e2 <fread+0x92>
+    if(f->r == f->n && fill(f) == 0)
+    1381:	8b 46 10             	mov    0x10(%esi),%eax
+  d = p;
+    1384:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1387:	eb 35                	jmp    13be <fread+0x6e>
+    1389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      break;
+    n = f->n - f->r;
+    1390:	29 c3                	sub    %eax,%ebx
+    1392:	39 fb                	cmp    %edi,%ebx
+    1394:	0f 4f df             	cmovg  %edi,%ebx
+    if(n > len)
+      n = len;
+    memmove(d, f->buf + f->r, n);
+    1397:	83 ec 04             	sub    $0x4,%esp
+    139a:	53                   	push   %ebx
+    139b:	03 46 08             	add    0x8(%esi),%eax
+  for(len = size*nmemb; len > 0; len -= n){
+    139e:	29 df                	sub    %ebx,%edi
+    memmove(d, f->buf + f->r, n);
+    13a0:	50                   	push   %eax
+    13a1:	51                   	push   %ecx
+    13a2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    13a5:	e8 36 f0 ff ff       	call   3e0 <memmove>
+    f->r += n;
+    13aa:	8b 46 10             	mov    0x10(%esi),%eax
+    d += n;
+    13ad:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    13b0:	83 c4 10             	add    $0x10,%esp
+    f->r += n;
+    13b3:	01 d8                	add    %ebx,%eax
+    d += n;
+    13b5:	01 d9                	add    %ebx,%ecx
+    f->r += n;
+    13b7:	89 46 10             	mov    %eax,0x10(%esi)
+  for(len = size*nmemb; len > 0; len -= n){
+    13ba:	85 ff                	test   %edi,%edi
+    13bc:	7e 32                	jle    13f0 <fread+0xa0>
+    if(f->r == f->n && fill(f) == 0)
+    13be:	8b 5e 14             	mov    0x14(%esi),%ebx
+    13c1:	39 c3                	cmp    %eax,%ebx
+    13c3:	75 cb                	jne    1390 <fread+0x40>
+    13c5:	89 f0                	mov    %esi,%eax
+    13c7:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    13ca:	e8 31 f8 ff ff       	call   c00 <fill>
+    13cf:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    13d2:	85 c0                	test   %eax,%eax
+    13d4:	74 1a                	je     13f0 <fread+0xa0>
+    n = f->n - f->r;
+    13d6:	8b 5e 14             	mov    0x14(%esi),%ebx
+    13d9:	8b 46 10             	mov    0x10(%esi),%eax
+    13dc:	eb b2                	jmp    1390 <fread+0x40>
+    13de:	66 90                	xchg   %ax,%ax
+    return 0;
+    13e0:	31 c0                	xor    %eax,%eax
+  }
+  funlockfile(f);
+  return (d - (char*)p) / size;
+}
+    13e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13e5:	5b                   	pop    %ebx
+    13e6:	5e                   	pop    %esi
+    13e7:	5f                   	pop    %edi
+    13e8:	5d                   	pop    %ebp
+    13e9:	c3                   	ret
+    13ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (d - (char*)p) / size;
+    13f0:	2b 4d 08             	sub    0x8(%ebp),%ecx
+    13f3:	89 cb                	mov    %ecx,%ebx
+  if(threaded)
+    13f5:	a1 00 2a 00 00       	mov    0x2a00,%eax
+    13fa:	85 c0                	test   %eax,%eax
+    13fc:	75 32                	jne    1430 <fread+0xe0>
+  return (d - (char*)p) / size;
+    13fe:	89 d8                	mov    %ebx,%eax
+    1400:	99                   	cltd
+    1401:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1404:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1407:	5b                   	pop    %ebx
+    1408:	5e                   	pop    %esi
+    1409:	5f                   	pop    %edi
+    140a:	5d                   	pop    %ebp
+    140b:	c3                   	ret
+    140c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    1410:	83 ec 0c             	sub    $0xc,%esp
+    1413:	8d 46 18             	lea    0x18(%esi),%eax
+    1416:	50                   	push   %eax
+    1417:	e8 04 f0 ff ff       	call   420 <mutex_lock>
+  for(len = size*nmemb; len > 0; len -= n){
+    141c:	83 c4 10             	add    $0x10,%esp
+    141f:	85 ff                	test   %edi,%edi
+    1421:	0f 8f 5a ff ff ff    	jg     1381 <fread+0x31>
+    1427:	31 db                	xor    %ebx,%ebx
+    1429:	eb ca                	jmp    13f5 <fread+0xa5>
+    142b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    142f:	90                   	nop
+    mutex_unlock(&f->lock);
+    1430:	83 ec 0c             	sub    $0xc,%esp
+    1433:	83 c6 18             	add    $0x18,%esi
+    1436:	56                   	push   %esi
+    1437:	e8 34 f0 ff ff       	call   470 <mutex_unlock>
+  return (d - (char*)p) / size;
+    143c:	89 d8                	mov    %ebx,%eax
+    143e:	83 c4 10             	add    $0x10,%esp
+    1441:	99                   	cltd
+    1442:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1445:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1448:	5b                   	pop    %ebx
+    1449:	5e                   	pop    %esi
+    144a:	5f                   	pop    %edi
+    144b:	5d                   	pop    %ebp
+    144c:	c3                   	ret
+    144d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001450 <fgets>:
+
+// Read a line of at most max-1 bytes, keeping the newline.
+// Returns 0 if there was nothing left to read.
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    1450:	55                   	push   %ebp
+    1451:	89 e5                	mov    %esp,%ebp
+    1453:	57                   	push   %edi
+    1454:	56                   	push   %esi
+    1455:	53                   	push   %ebx
+    1456:	83 ec 1c             	sub    $0x1c,%esp
+  if(threaded)
+    1459:	8b 35 00 2a 00 00    	mov    0x2a00,%esi
+{
+    145f:	8b 7d 08             	mov    0x8(%ebp),%edi
+    1462:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if(threaded)
+    1465:	85 f6                	test   %esi,%esi
+    1467:	0f 85 83 00 00 00    	jne    14f0 <fgets+0xa0>
+{
+    146d:	31 f6                	xor    %esi,%esi
+    146f:	eb 2a                	jmp    149b <fgets+0x4b>
+    1471:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return f->buf[f->r++] & 0xff;
+    1478:	8b 53 08             	mov    0x8(%ebx),%edx
+    147b:	8d 48 01             	lea    0x1(%eax),%ecx
+    147e:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1481:	0f b6 14 02          	movzbl (%edx,%eax,1),%edx
+
+  flockfile(f);
+  for(i = 0; i+1 < max; ){
+    if((c = getc_unlocked(f)) == EOF)
+      break;
+    buf[i++] = c;
+    1485:	88 54 37 ff          	mov    %dl,-0x1(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    1489:	80 fa 0a             	cmp    $0xa,%dl
+    148c:	0f 84 96 00 00 00    	je     1528 <fgets+0xd8>
+    1492:	83 fa 0d             	cmp    $0xd,%edx
+    1495:	0f 84 8d 00 00 00    	je     1528 <fgets+0xd8>
+  for(i = 0; i+1 < max; ){
+    149b:	89 f2                	mov    %esi,%edx
+    149d:	83 c6 01             	add    $0x1,%esi
+    14a0:	3b 75 0c             	cmp    0xc(%ebp),%esi
+    14a3:	7d 2b                	jge    14d0 <fgets+0x80>
+  if(!(f->flags & IO_READ))
+    14a5:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    14a9:	74 25                	je     14d0 <fgets+0x80>
+  if(f->r == f->n && fill(f) == 0)
+    14ab:	8b 43 10             	mov    0x10(%ebx),%eax
+    14ae:	3b 43 14             	cmp    0x14(%ebx),%eax
+    14b1:	75 c5                	jne    1478 <fgets+0x28>
+    14b3:	89 d8                	mov    %ebx,%eax
+    14b5:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    14b8:	e8 43 f7 ff ff       	call   c00 <fill>
+    14bd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    14c0:	85 c0                	test   %eax,%eax
+    14c2:	74 0c                	je     14d0 <fgets+0x80>
+  return f->buf[f->r++] & 0xff;
+    14c4:	8b 43 10             	mov    0x10(%ebx),%eax
+    14c7:	eb af                	jmp    1478 <fgets+0x28>
+    14c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    14d0:	8b 0d 00 2a 00 00    	mov    0x2a00,%ecx
+      break;
+  }
+  buf[i] = '\0';
+    14d6:	c6 04 17 00          	movb   $0x0,(%edi,%edx,1)
+  if(threaded)
+    14da:	85 c9                	test   %ecx,%ecx
+    14dc:	75 2a                	jne    1508 <fgets+0xb8>
+  funlockfile(f);
+  return i > 0 ? buf : 0;
+    14de:	31 c0                	xor    %eax,%eax
+    14e0:	85 d2                	test   %edx,%edx
+    14e2:	74 02                	je     14e6 <fgets+0x96>
+    14e4:	89 f8                	mov    %edi,%eax
+}
+    14e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    14e9:	5b                   	pop    %ebx
+    14ea:	5e                   	pop    %esi
+    14eb:	5f                   	pop    %edi
+    14ec:	5d                   	pop    %ebp
+    14ed:	c3                   	ret
+    14ee:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    14f0:	83 ec 0c             	sub    $0xc,%esp
+    14f3:	8d 43 18             	lea    0x18(%ebx),%eax
+    14f6:	50                   	push   %eax
+    14f7:	e8 24 ef ff ff       	call   420 <mutex_lock>
+    14fc:	83 c4 10             	add    $0x10,%esp
+    14ff:	e9 69 ff ff ff       	jmp    146d <fgets+0x1d>
+    1504:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1508:	83 ec 0c             	sub    $0xc,%esp
+    150b:	83 c3 18             	add    $0x18,%ebx
+    150e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1511:	53                   	push   %ebx
+    1512:	e8 59 ef ff ff       	call   470 <mutex_unlock>
+    1517:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    151a:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    151d:	31 c0                	xor    %eax,%eax
+    151f:	85 d2                	test   %edx,%edx
+    1521:	75 c1                	jne    14e4 <fgets+0x94>
+    1523:	eb c1                	jmp    14e6 <fgets+0x96>
+    1525:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1528:	a1 00 2a 00 00       	mov    0x2a00,%eax
+  buf[i] = '\0';
+    152d:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  if(threaded)
+    1531:	85 c0                	test   %eax,%eax
+    1533:	74 af                	je     14e4 <fgets+0x94>
+    mutex_unlock(&f->lock);
+    1535:	83 ec 0c             	sub    $0xc,%esp
+    1538:	83 c3 18             	add    $0x18,%ebx
+    153b:	53                   	push   %ebx
+    153c:	e8 2f ef ff ff       	call   470 <mutex_unlock>
+    1541:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    1544:	89 f8                	mov    %edi,%eax
+    1546:	eb 9e                	jmp    14e6 <fgets+0x96>
+    1548:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    154f:	90                   	nop
+
+00001550 <gets>:
+// at most a line per read(), goes through stdin's buffer: from a
+// file or pipe, a buffered read could take input meant for a child
+// process, so read a byte at a time.
+char*
+gets(char *buf, int max)
+{
+    1550:	55                   	push   %ebp
+    1551:	89 e5                	mov    %esp,%ebp
+    1553:	57                   	push   %edi
+    1554:	56                   	push   %esi
+    1555:	53                   	push   %ebx
+    1556:	83 ec 2c             	sub    $0x2c,%esp
+  int i, cc;
+  char c;
+
+  if(!(stdin->flags & IO_SETUP))
+    1559:	8b 15 04 29 00 00    	mov    0x2904,%edx
+{
+    155f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!(stdin->flags & IO_SETUP))
+    1562:	f6 c2 40             	test   $0x40,%dl
+    1565:	74 79                	je     15e0 <gets+0x90>
+    setup(stdin);
+  if(stdin->flags & IO_DEV){
+    1567:	83 e2 20             	and    $0x20,%edx
+    156a:	89 d7                	mov    %edx,%edi
+    156c:	75 52                	jne    15c0 <gets+0x70>
+  if(f == 0){
+    156e:	e8 ed f5 ff ff       	call   b60 <fflush.part.0>
+    fgets(buf, max, stdin);
+    return buf;
+  }
+  fflush(0);
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1573:	8d 75 e7             	lea    -0x19(%ebp),%esi
+  for(i=0; i+1 < max; ){
+    1576:	eb 2c                	jmp    15a4 <gets+0x54>
+    1578:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    157f:	90                   	nop
+    cc = read(0, &c, 1);
+    1580:	83 ec 04             	sub    $0x4,%esp
+    1583:	6a 01                	push   $0x1
+    1585:	56                   	push   %esi
+    1586:	6a 00                	push   $0x0
+    1588:	e8 f5 ef ff ff       	call   582 <read>
+    if(cc < 1)
+    158d:	83 c4 10             	add    $0x10,%esp
+    1590:	85 c0                	test   %eax,%eax
+    1592:	7e 1b                	jle    15af <gets+0x5f>
+      break;
+    buf[i++] = c;
+    1594:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1598:	88 44 3b ff          	mov    %al,-0x1(%ebx,%edi,1)
+    if(c == '\n' || c == '\r')
+    159c:	3c 0a                	cmp    $0xa,%al
+    159e:	74 12                	je     15b2 <gets+0x62>
+    15a0:	3c 0d                	cmp    $0xd,%al
+    15a2:	74 0e                	je     15b2 <gets+0x62>
+  for(i=0; i+1 < max; ){
+    15a4:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    15a7:	83 c7 01             	add    $0x1,%edi
+    15aa:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+    15ad:	7c d1                	jl     1580 <gets+0x30>
+{
+    15af:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      break;
+  }
+  buf[i] = '\0';
+    15b2:	c6 04 3b 00          	movb   $0x0,(%ebx,%edi,1)
+  return buf;
+}
+    15b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15b9:	89 d8                	mov    %ebx,%eax
+    15bb:	5b                   	pop    %ebx
+    15bc:	5e                   	pop    %esi
+    15bd:	5f                   	pop    %edi
+    15be:	5d                   	pop    %ebp
+    15bf:	c3                   	ret
+    fgets(buf, max, stdin);
+    15c0:	83 ec 04             	sub    $0x4,%esp
+    15c3:	68 00 29 00 00       	push   $0x2900
+    15c8:	ff 75 0c             	push   0xc(%ebp)
+    15cb:	53                   	push   %ebx
+    15cc:	e8 7f fe ff ff       	call   1450 <fgets>
+    return buf;
+    15d1:	83 c4 10             	add    $0x10,%esp
+}
+    15d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15d7:	89 d8                	mov    %ebx,%eax
+    15d9:	5b                   	pop    %ebx
+    15da:	5e                   	pop    %esi
+    15db:	5f                   	pop    %edi
+    15dc:	5d                   	pop    %ebp
+    15dd:	c3                   	ret
+    15de:	66 90                	xchg   %ax,%ax
+    setup(stdin);
+    15e0:	b8 00 29 00 00       	mov    $0x2900,%eax
+    15e5:	e8 a6 f4 ff ff       	call   a90 <setup>
+  if(stdin->flags & IO_DEV){
+    15ea:	8b 15 04 29 00 00    	mov    0x2904,%edx
+    15f0:	e9 72 ff ff ff       	jmp    1567 <gets+0x17>
+    15f5:	66 90                	xchg   %ax,%ax
+    15f7:	66 90                	xchg   %ax,%ax
+    15f9:	66 90                	xchg   %ax,%ax
+    15fb:	66 90                	xchg   %ax,%ax
+    15fd:	66 90                	xchg   %ax,%ax
+    15ff:	90                   	nop
+
+00001600 <bigfree>:
+
+// Give a big block back to the first-fit list, and return the
+// free block that now holds it. Caller holds lock.
+static Header*
+bigfree(Header *bp)
+{
+    1600:	55                   	push   %ebp
+    1601:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1603:	a1 a4 30 00 00       	mov    0x30a4,%eax
+{
+    1608:	89 e5                	mov    %esp,%ebp
+    160a:	56                   	push   %esi
+    160b:	53                   	push   %ebx
+    160c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1610:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1612:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1614:	39 ca                	cmp    %ecx,%edx
+    1616:	73 38                	jae    1650 <bigfree+0x50>
+    1618:	39 c1                	cmp    %eax,%ecx
+    161a:	72 04                	jb     1620 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    161c:	39 c2                	cmp    %eax,%edx
+    161e:	72 f0                	jb     1610 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1620:	8b 59 04             	mov    0x4(%ecx),%ebx
+    1623:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    1626:	39 f0                	cmp    %esi,%eax
+    1628:	74 36                	je     1660 <bigfree+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    162a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  freep = p;
+  if(p + p->s.size == bp){
+    162c:	8b 42 04             	mov    0x4(%edx),%eax
+    162f:	89 cb                	mov    %ecx,%ebx
+  freep = p;
+    1631:	89 15 a4 30 00 00    	mov    %edx,0x30a4
+  if(p + p->s.size == bp){
+    1637:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    163a:	39 f1                	cmp    %esi,%ecx
+    163c:	74 2e                	je     166c <bigfree+0x6c>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    163e:	89 1a                	mov    %ebx,(%edx)
+    return p;
+  }
+  p->s.ptr = bp;
+  return bp;
+}
+    1640:	89 c8                	mov    %ecx,%eax
+    1642:	5b                   	pop    %ebx
+    1643:	5e                   	pop    %esi
+    1644:	5d                   	pop    %ebp
+    1645:	c3                   	ret
+    1646:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    164d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1650:	39 c1                	cmp    %eax,%ecx
+    1652:	72 c8                	jb     161c <bigfree+0x1c>
+    1654:	eb ba                	jmp    1610 <bigfree+0x10>
+    1656:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    165d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1660:	03 58 04             	add    0x4(%eax),%ebx
+    1663:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1666:	8b 02                	mov    (%edx),%eax
+    1668:	8b 00                	mov    (%eax),%eax
+    166a:	eb be                	jmp    162a <bigfree+0x2a>
+    p->s.size += bp->s.size;
+    166c:	03 41 04             	add    0x4(%ecx),%eax
+    166f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1672:	8b 19                	mov    (%ecx),%ebx
+    return p;
+    1674:	89 d1                	mov    %edx,%ecx
+}
+    1676:	89 c8                	mov    %ecx,%eax
+    p->s.ptr = bp->s.ptr;
+    1678:	89 1a                	mov    %ebx,(%edx)
+}
+    167a:	5b                   	pop    %ebx
+    167b:	5e                   	pop    %esi
+    167c:	5d                   	pop    %ebp
+    167d:	c3                   	ret
+    167e:	66 90                	xchg   %ax,%ax
+
+00001680 <trim>:
+// If free block bp ends the heap, return its whole pages to the
+// kernel, unless something else has moved the break since.
+// Caller holds lock.
+static void
+trim(Header *bp)
+{
+    1680:	55                   	push   %ebp
+    1681:	89 e5                	mov    %esp,%ebp
+    1683:	57                   	push   %edi
+    1684:	56                   	push   %esi
+    1685:	53                   	push   %ebx
+    1686:	89 c3                	mov    %eax,%ebx
+    1688:	83 ec 0c             	sub    $0xc,%esp
+  char *end;
+  uint n;
+
+  if((char*)(bp + bp->s.size) != heapend)
+    168b:	8b 53 04             	mov    0x4(%ebx),%edx
+    168e:	a1 a0 30 00 00       	mov    0x30a0,%eax
+    1693:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+    1696:	39 d0                	cmp    %edx,%eax
+    1698:	74 0e                	je     16a8 <trim+0x28>
+  n = heapend - end;
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    bp->s.size -= n / sizeof(Header);
+    heapend = end;
+  }
+}
+    169a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    169d:	5b                   	pop    %ebx
+    169e:	5e                   	pop    %esi
+    169f:	5f                   	pop    %edi
+    16a0:	5d                   	pop    %ebp
+    16a1:	c3                   	ret
+    16a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  end = (char*)PGROUNDUP((uint)(bp + 2));
+    16a8:	8d bb 0f 10 00 00    	lea    0x100f(%ebx),%edi
+    16ae:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  n = heapend - end;
+    16b4:	29 f8                	sub    %edi,%eax
+    16b6:	89 c6                	mov    %eax,%esi
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    16b8:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    16bd:	76 db                	jbe    169a <trim+0x1a>
+    16bf:	83 ec 0c             	sub    $0xc,%esp
+    16c2:	6a 00                	push   $0x0
+    16c4:	e8 8b ef ff ff       	call   654 <sbrk>
+    16c9:	83 c4 10             	add    $0x10,%esp
+    16cc:	39 05 a0 30 00 00    	cmp    %eax,0x30a0
+    16d2:	75 c6                	jne    169a <trim+0x1a>
+    16d4:	89 f0                	mov    %esi,%eax
+    16d6:	83 ec 0c             	sub    $0xc,%esp
+    16d9:	f7 d8                	neg    %eax
+    16db:	50                   	push   %eax
+    16dc:	e8 73 ef ff ff       	call   654 <sbrk>
+    16e1:	83 c4 10             	add    $0x10,%esp
+    16e4:	83 f8 ff             	cmp    $0xffffffff,%eax
+    16e7:	74 b1                	je     169a <trim+0x1a>
+    bp->s.size -= n / sizeof(Header);
+    16e9:	89 f0                	mov    %esi,%eax
+    heapend = end;
+    16eb:	89 3d a0 30 00 00    	mov    %edi,0x30a0
+    bp->s.size -= n / sizeof(Header);
+    16f1:	c1 e8 03             	shr    $0x3,%eax
+    16f4:	29 43 04             	sub    %eax,0x4(%ebx)
+    heapend = end;
+    16f7:	eb a1                	jmp    169a <trim+0x1a>
+    16f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001700 <bigalloc>:
+}
+
+// Allocate a big block of nunits units. Caller holds lock.
+static Header*
+bigalloc(uint nunits)
+{
+    1700:	55                   	push   %ebp
+    1701:	89 e5                	mov    %esp,%ebp
+    1703:	57                   	push   %edi
+    1704:	89 c7                	mov    %eax,%edi
+    1706:	56                   	push   %esi
+    1707:	53                   	push   %ebx
+    1708:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    170b:	a1 a4 30 00 00       	mov    0x30a4,%eax
+    1710:	85 c0                	test   %eax,%eax
+    1712:	0f 84 98 00 00 00    	je     17b0 <bigalloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1718:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    171a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    171d:	39 f9                	cmp    %edi,%ecx
+    171f:	73 67                	jae    1788 <bigalloc+0x88>
+  if(nu < 4096)
+    1721:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1726:	39 df                	cmp    %ebx,%edi
+    1728:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    172b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    1732:	eb 0d                	jmp    1741 <bigalloc+0x41>
+    1734:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1738:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    173a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    173d:	39 f9                	cmp    %edi,%ecx
+    173f:	73 47                	jae    1788 <bigalloc+0x88>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    1741:	89 d0                	mov    %edx,%eax
+    1743:	39 15 a4 30 00 00    	cmp    %edx,0x30a4
+    1749:	75 ed                	jne    1738 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    174b:	83 ec 0c             	sub    $0xc,%esp
+    174e:	56                   	push   %esi
+    174f:	e8 00 ef ff ff       	call   654 <sbrk>
+  if(p == (char*)-1)
+    1754:	83 c4 10             	add    $0x10,%esp
+    1757:	83 f8 ff             	cmp    $0xffffffff,%eax
+    175a:	74 1a                	je     1776 <bigalloc+0x76>
+  hp->s.size = nu;
+    175c:	89 58 04             	mov    %ebx,0x4(%eax)
+  heapend = p + nu * sizeof(Header);
+    175f:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    1762:	89 15 a0 30 00 00    	mov    %edx,0x30a0
+  bigfree(hp);
+    1768:	e8 93 fe ff ff       	call   1600 <bigfree>
+  return freep;
+    176d:	a1 a4 30 00 00       	mov    0x30a4,%eax
+      if((p = morecore(nunits)) == 0)
+    1772:	85 c0                	test   %eax,%eax
+    1774:	75 c2                	jne    1738 <bigalloc+0x38>
+        return 0;
+  }
+}
+    1776:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1779:	31 d2                	xor    %edx,%edx
+}
+    177b:	5b                   	pop    %ebx
+    177c:	89 d0                	mov    %edx,%eax
+    177e:	5e                   	pop    %esi
+    177f:	5f                   	pop    %edi
+    1780:	5d                   	pop    %ebp
+    1781:	c3                   	ret
+    1782:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1788:	39 cf                	cmp    %ecx,%edi
+    178a:	74 54                	je     17e0 <bigalloc+0xe0>
+        p->s.size -= nunits;
+    178c:	29 f9                	sub    %edi,%ecx
+    178e:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    1791:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    1794:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    1797:	a3 a4 30 00 00       	mov    %eax,0x30a4
+}
+    179c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    179f:	89 d0                	mov    %edx,%eax
+    17a1:	5b                   	pop    %ebx
+    17a2:	5e                   	pop    %esi
+    17a3:	5f                   	pop    %edi
+    17a4:	5d                   	pop    %ebp
+    17a5:	c3                   	ret
+    17a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17ad:	8d 76 00             	lea    0x0(%esi),%esi
+    base.s.ptr = freep = prevp = &base;
+    17b0:	c7 05 a4 30 00 00 a8 	movl   $0x30a8,0x30a4
+    17b7:	30 00 00 
+    base.s.size = 0;
+    17ba:	ba a8 30 00 00       	mov    $0x30a8,%edx
+    base.s.ptr = freep = prevp = &base;
+    17bf:	c7 05 a8 30 00 00 a8 	movl   $0x30a8,0x30a8
+    17c6:	30 00 00 
+    base.s.size = 0;
+    17c9:	c7 05 ac 30 00 00 00 	movl   $0x0,0x30ac
+    17d0:	00 00 00 
+    if(p->s.size >= nunits){
+    17d3:	e9 49 ff ff ff       	jmp    1721 <bigalloc+0x21>
+    17d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17df:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    17e0:	8b 0a                	mov    (%edx),%ecx
+    17e2:	89 08                	mov    %ecx,(%eax)
+    17e4:	eb b1                	jmp    1797 <bigalloc+0x97>
+    17e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000017f0 <drain>:
+}
+
+// Move n blocks of class c from cache tc to the shared list.
+static void
+drain(struct tcache *tc, int c, int n)
+{
+    17f0:	55                   	push   %ebp
+    17f1:	89 e5                	mov    %esp,%ebp
+    17f3:	57                   	push   %edi
+    17f4:	89 c7                	mov    %eax,%edi
+    17f6:	56                   	push   %esi
+    17f7:	89 d6                	mov    %edx,%esi
+    17f9:	53                   	push   %ebx
+    17fa:	89 cb                	mov    %ecx,%ebx
+    17fc:	83 ec 0c             	sub    $0xc,%esp
+  if(threaded)
+    17ff:	8b 15 24 30 00 00    	mov    0x3024,%edx
+    1805:	85 d2                	test   %edx,%edx
+    1807:	75 57                	jne    1860 <drain+0x70>
+  Header *p;
+
+  acquire();
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1809:	85 c9                	test   %ecx,%ecx
+    180b:	7e 49                	jle    1856 <drain+0x66>
+    180d:	89 d9                	mov    %ebx,%ecx
+    180f:	8d 14 b7             	lea    (%edi,%esi,4),%edx
+    1812:	eb 23                	jmp    1837 <drain+0x47>
+    1814:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    tc->list[c] = p->s.ptr;
+    1818:	8b 18                	mov    (%eax),%ebx
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    181a:	83 e9 01             	sub    $0x1,%ecx
+    tc->n[c]--;
+    181d:	83 6a 20 01          	subl   $0x1,0x20(%edx)
+    tc->list[c] = p->s.ptr;
+    1821:	89 1a                	mov    %ebx,(%edx)
+    p->s.ptr = small[c];
+    1823:	8b 1c b5 80 30 00 00 	mov    0x3080(,%esi,4),%ebx
+    182a:	89 18                	mov    %ebx,(%eax)
+    small[c] = p;
+    182c:	89 04 b5 80 30 00 00 	mov    %eax,0x3080(,%esi,4)
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1833:	85 c9                	test   %ecx,%ecx
+    1835:	7e 06                	jle    183d <drain+0x4d>
+    1837:	8b 02                	mov    (%edx),%eax
+    1839:	85 c0                	test   %eax,%eax
+    183b:	75 db                	jne    1818 <drain+0x28>
+  if(threaded)
+    183d:	a1 24 30 00 00       	mov    0x3024,%eax
+    1842:	85 c0                	test   %eax,%eax
+    1844:	74 10                	je     1856 <drain+0x66>
+    mutex_unlock(&lock);
+    1846:	83 ec 0c             	sub    $0xc,%esp
+    1849:	68 28 30 00 00       	push   $0x3028
+    184e:	e8 1d ec ff ff       	call   470 <mutex_unlock>
+}
+    1853:	83 c4 10             	add    $0x10,%esp
+  }
+  release();
+}
+    1856:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1859:	5b                   	pop    %ebx
+    185a:	5e                   	pop    %esi
+    185b:	5f                   	pop    %edi
+    185c:	5d                   	pop    %ebp
+    185d:	c3                   	ret
+    185e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&lock);
+    1860:	83 ec 0c             	sub    $0xc,%esp
+    1863:	68 28 30 00 00       	push   $0x3028
+    1868:	e8 b3 eb ff ff       	call   420 <mutex_lock>
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    186d:	83 c4 10             	add    $0x10,%esp
+    1870:	85 db                	test   %ebx,%ebx
+    1872:	7f 99                	jg     180d <drain+0x1d>
+    1874:	eb c7                	jmp    183d <drain+0x4d>
+    1876:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    187d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001880 <mycache>:
+{
+    1880:	55                   	push   %ebp
+    return &maincache;
+    1881:	b8 40 30 00 00       	mov    $0x3040,%eax
+{
+    1886:	89 e5                	mov    %esp,%ebp
+    1888:	53                   	push   %ebx
+  sp = PGROUNDDOWN((uint)&sp);
+    1889:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+    188c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+    1892:	83 ec 14             	sub    $0x14,%esp
+  if(!threaded || sp == mainstack)
+    1895:	8b 0d 24 30 00 00    	mov    0x3024,%ecx
+  sp = PGROUNDDOWN((uint)&sp);
+    189b:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  if(!threaded || sp == mainstack)
+    189e:	85 c9                	test   %ecx,%ecx
+    18a0:	74 0f                	je     18b1 <mycache+0x31>
+    18a2:	3b 1d 20 30 00 00    	cmp    0x3020,%ebx
+    18a8:	74 07                	je     18b1 <mycache+0x31>
+  if(*cp == 0){
+    18aa:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    18ad:	85 c0                	test   %eax,%eax
+    18af:	74 0f                	je     18c0 <mycache+0x40>
+}
+    18b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    18b4:	c9                   	leave
+    18b5:	c3                   	ret
+    18b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18bd:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    18c0:	83 ec 0c             	sub    $0xc,%esp
+    18c3:	68 28 30 00 00       	push   $0x3028
+    18c8:	e8 53 eb ff ff       	call   420 <mutex_lock>
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    18cd:	b8 09 00 00 00       	mov    $0x9,%eax
+    18d2:	e8 29 fe ff ff       	call   1700 <bigalloc>
+  if(threaded)
+    18d7:	8b 15 24 30 00 00    	mov    0x3024,%edx
+    18dd:	83 c4 10             	add    $0x10,%esp
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    18e0:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(threaded)
+    18e3:	85 d2                	test   %edx,%edx
+    18e5:	75 29                	jne    1910 <mycache+0x90>
+    if(*cp == 0)
+    18e7:	85 c0                	test   %eax,%eax
+    18e9:	74 c6                	je     18b1 <mycache+0x31>
+    memset(*cp, 0, sizeof(**cp));
+    18eb:	83 ec 04             	sub    $0x4,%esp
+    *cp = (struct tcache*)((Header*)*cp + 1);
+    18ee:	83 c0 08             	add    $0x8,%eax
+    18f1:	89 43 f8             	mov    %eax,-0x8(%ebx)
+    memset(*cp, 0, sizeof(**cp));
+    18f4:	6a 40                	push   $0x40
+    18f6:	6a 00                	push   $0x0
+    18f8:	50                   	push   %eax
+    18f9:	e8 f2 e9 ff ff       	call   2f0 <memset>
+  return *cp;
+    18fe:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    1901:	83 c4 10             	add    $0x10,%esp
+    1904:	eb ab                	jmp    18b1 <mycache+0x31>
+    1906:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    190d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1910:	83 ec 0c             	sub    $0xc,%esp
+    1913:	68 28 30 00 00       	push   $0x3028
+    1918:	e8 53 eb ff ff       	call   470 <mutex_unlock>
+    if(*cp == 0)
+    191d:	8b 43 f8             	mov    -0x8(%ebx),%eax
+}
+    1920:	83 c4 10             	add    $0x10,%esp
+    1923:	eb c2                	jmp    18e7 <mycache+0x67>
+    1925:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    192c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001930 <free>:
+
+void
+free(void *ap)
+{
+    1930:	55                   	push   %ebp
+    1931:	89 e5                	mov    %esp,%ebp
+    1933:	57                   	push   %edi
+    1934:	56                   	push   %esi
+    1935:	53                   	push   %ebx
+    1936:	83 ec 1c             	sub    $0x1c,%esp
+    1939:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  struct tcache *tc;
+  int c;
+
+  if(ap == 0)
+    193c:	85 f6                	test   %esi,%esi
+    193e:	74 51                	je     1991 <free+0x61>
+    return;
+  bp = (Header*)ap - 1;
+    1940:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1943:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(bp->s.size > SMALLMAX / sizeof(Header)){
+    1946:	8b 46 fc             	mov    -0x4(%esi),%eax
+    1949:	3d 00 01 00 00       	cmp    $0x100,%eax
+    194e:	77 50                	ja     19a0 <free+0x70>
+    acquire();
+    trim(bigfree(bp));
+    release();
+    return;
+  }
+  for(c = 0; (2 << c) < bp->s.size; c++)
+    1950:	31 db                	xor    %ebx,%ebx
+    1952:	ba 02 00 00 00       	mov    $0x2,%edx
+    1957:	83 f8 02             	cmp    $0x2,%eax
+    195a:	76 11                	jbe    196d <free+0x3d>
+    195c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1960:	83 c3 01             	add    $0x1,%ebx
+    1963:	89 d7                	mov    %edx,%edi
+    1965:	89 d9                	mov    %ebx,%ecx
+    1967:	d3 e7                	shl    %cl,%edi
+    1969:	39 c7                	cmp    %eax,%edi
+    196b:	72 f3                	jb     1960 <free+0x30>
+    ;
+  if((tc = mycache()) == 0){
+    196d:	e8 0e ff ff ff       	call   1880 <mycache>
+    1972:	85 c0                	test   %eax,%eax
+    1974:	74 7a                	je     19f0 <free+0xc0>
+    bp->s.ptr = small[c];
+    small[c] = bp;
+    release();
+    return;
+  }
+  bp->s.ptr = tc->list[c];
+    1976:	8d 0c 98             	lea    (%eax,%ebx,4),%ecx
+    1979:	8b 11                	mov    (%ecx),%edx
+    197b:	89 56 f8             	mov    %edx,-0x8(%esi)
+  tc->list[c] = bp;
+    197e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1981:	89 31                	mov    %esi,(%ecx)
+  if(++tc->n[c] > TCACHEMAX)
+    1983:	8b 71 20             	mov    0x20(%ecx),%esi
+    1986:	8d 56 01             	lea    0x1(%esi),%edx
+    1989:	89 51 20             	mov    %edx,0x20(%ecx)
+    198c:	83 fa 20             	cmp    $0x20,%edx
+    198f:	7f 47                	jg     19d8 <free+0xa8>
+    drain(tc, c, BATCH);
+}
+    1991:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1994:	5b                   	pop    %ebx
+    1995:	5e                   	pop    %esi
+    1996:	5f                   	pop    %edi
+    1997:	5d                   	pop    %ebp
+    1998:	c3                   	ret
+    1999:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    19a0:	8b 1d 24 30 00 00    	mov    0x3024,%ebx
+    19a6:	85 db                	test   %ebx,%ebx
+    19a8:	75 66                	jne    1a10 <free+0xe0>
+    trim(bigfree(bp));
+    19aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    19ad:	e8 4e fc ff ff       	call   1600 <bigfree>
+    19b2:	e8 c9 fc ff ff       	call   1680 <trim>
+  if(threaded)
+    19b7:	8b 0d 24 30 00 00    	mov    0x3024,%ecx
+    19bd:	85 c9                	test   %ecx,%ecx
+    19bf:	74 d0                	je     1991 <free+0x61>
+    mutex_unlock(&lock);
+    19c1:	c7 45 08 28 30 00 00 	movl   $0x3028,0x8(%ebp)
+}
+    19c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19cb:	5b                   	pop    %ebx
+    19cc:	5e                   	pop    %esi
+    19cd:	5f                   	pop    %edi
+    19ce:	5d                   	pop    %ebp
+    mutex_unlock(&lock);
+    19cf:	e9 9c ea ff ff       	jmp    470 <mutex_unlock>
+    19d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    19d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    drain(tc, c, BATCH);
+    19db:	89 da                	mov    %ebx,%edx
+    19dd:	b9 10 00 00 00       	mov    $0x10,%ecx
+}
+    19e2:	5b                   	pop    %ebx
+    19e3:	5e                   	pop    %esi
+    19e4:	5f                   	pop    %edi
+    19e5:	5d                   	pop    %ebp
+    drain(tc, c, BATCH);
+    19e6:	e9 05 fe ff ff       	jmp    17f0 <drain>
+    19eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    19ef:	90                   	nop
+  if(threaded)
+    19f0:	8b 15 24 30 00 00    	mov    0x3024,%edx
+    19f6:	85 d2                	test   %edx,%edx
+    19f8:	75 28                	jne    1a22 <free+0xf2>
+    bp->s.ptr = small[c];
+    19fa:	8b 04 9d 80 30 00 00 	mov    0x3080(,%ebx,4),%eax
+    1a01:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1a04:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1a07:	89 04 9d 80 30 00 00 	mov    %eax,0x3080(,%ebx,4)
+  if(threaded)
+    1a0e:	eb 81                	jmp    1991 <free+0x61>
+    mutex_lock(&lock);
+    1a10:	83 ec 0c             	sub    $0xc,%esp
+    1a13:	68 28 30 00 00       	push   $0x3028
+    1a18:	e8 03 ea ff ff       	call   420 <mutex_lock>
+}
+    1a1d:	83 c4 10             	add    $0x10,%esp
+    1a20:	eb 88                	jmp    19aa <free+0x7a>
+    mutex_lock(&lock);
+    1a22:	83 ec 0c             	sub    $0xc,%esp
+    1a25:	68 28 30 00 00       	push   $0x3028
+    1a2a:	e8 f1 e9 ff ff       	call   420 <mutex_lock>
+    bp->s.ptr = small[c];
+    1a2f:	8b 04 9d 80 30 00 00 	mov    0x3080(,%ebx,4),%eax
+  if(threaded)
+    1a36:	83 c4 10             	add    $0x10,%esp
+    bp->s.ptr = small[c];
+    1a39:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1a3c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1a3f:	89 04 9d 80 30 00 00 	mov    %eax,0x3080(,%ebx,4)
+  if(threaded)
+    1a46:	a1 24 30 00 00       	mov    0x3024,%eax
+    1a4b:	85 c0                	test   %eax,%eax
+    1a4d:	0f 85 6e ff ff ff    	jne    19c1 <free+0x91>
+    1a53:	e9 39 ff ff ff       	jmp    1991 <free+0x61>
+    1a58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a5f:	90                   	nop
+
+00001a60 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1a60:	55                   	push   %ebp
+    1a61:	89 e5                	mov    %esp,%ebp
+    1a63:	57                   	push   %edi
+    1a64:	56                   	push   %esi
+    1a65:	53                   	push   %ebx
+    1a66:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  struct tcache *tc;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1a69:	8b 45 08             	mov    0x8(%ebp),%eax
+    1a6c:	8d 78 07             	lea    0x7(%eax),%edi
+    1a6f:	c1 ef 03             	shr    $0x3,%edi
+    1a72:	83 c7 01             	add    $0x1,%edi
+  if(nunits > SMALLMAX / sizeof(Header)){
+    1a75:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+    1a7b:	77 5b                	ja     1ad8 <malloc+0x78>
+    acquire();
+    p = bigalloc(nunits);
+    release();
+    return p ? (void*)(p + 1) : 0;
+  }
+  for(c = 0; (2 << c) < nunits; c++)
+    1a7d:	31 c9                	xor    %ecx,%ecx
+    1a7f:	b8 02 00 00 00       	mov    $0x2,%eax
+    1a84:	be 02 00 00 00       	mov    $0x2,%esi
+    1a89:	bb 02 00 00 00       	mov    $0x2,%ebx
+    1a8e:	83 ff 02             	cmp    $0x2,%edi
+    1a91:	76 12                	jbe    1aa5 <malloc+0x45>
+    1a93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1a97:	90                   	nop
+    1a98:	83 c1 01             	add    $0x1,%ecx
+    1a9b:	89 c3                	mov    %eax,%ebx
+    1a9d:	d3 e3                	shl    %cl,%ebx
+    1a9f:	89 de                	mov    %ebx,%esi
+    1aa1:	39 fb                	cmp    %edi,%ebx
+    1aa3:	72 f3                	jb     1a98 <malloc+0x38>
+    1aa5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    ;
+  if((tc = mycache()) == 0)
+    1aa8:	e8 d3 fd ff ff       	call   1880 <mycache>
+    1aad:	85 c0                	test   %eax,%eax
+    1aaf:	74 51                	je     1b02 <malloc+0xa2>
+    return 0;
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1ab1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1ab4:	8d 3c 88             	lea    (%eax,%ecx,4),%edi
+    1ab7:	8b 07                	mov    (%edi),%eax
+    1ab9:	85 c0                	test   %eax,%eax
+    1abb:	74 53                	je     1b10 <malloc+0xb0>
+    return 0;
+  p = tc->list[c];
+  tc->list[c] = p->s.ptr;
+  tc->n[c]--;
+    1abd:	8b 57 20             	mov    0x20(%edi),%edx
+  tc->list[c] = p->s.ptr;
+    1ac0:	8b 08                	mov    (%eax),%ecx
+  tc->n[c]--;
+    1ac2:	83 ea 01             	sub    $0x1,%edx
+  return (void*)(p + 1);
+    1ac5:	83 c0 08             	add    $0x8,%eax
+  tc->n[c]--;
+    1ac8:	89 57 20             	mov    %edx,0x20(%edi)
+  tc->list[c] = p->s.ptr;
+    1acb:	89 0f                	mov    %ecx,(%edi)
+}
+    1acd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ad0:	5b                   	pop    %ebx
+    1ad1:	5e                   	pop    %esi
+    1ad2:	5f                   	pop    %edi
+    1ad3:	5d                   	pop    %ebp
+    1ad4:	c3                   	ret
+    1ad5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1ad8:	a1 24 30 00 00       	mov    0x3024,%eax
+    1add:	85 c0                	test   %eax,%eax
+    1adf:	0f 85 b3 00 00 00    	jne    1b98 <malloc+0x138>
+    p = bigalloc(nunits);
+    1ae5:	89 f8                	mov    %edi,%eax
+    1ae7:	e8 14 fc ff ff       	call   1700 <bigalloc>
+    1aec:	89 c3                	mov    %eax,%ebx
+  if(threaded)
+    1aee:	a1 24 30 00 00       	mov    0x3024,%eax
+    1af3:	85 c0                	test   %eax,%eax
+    1af5:	0f 85 85 00 00 00    	jne    1b80 <malloc+0x120>
+    return p ? (void*)(p + 1) : 0;
+    1afb:	8d 43 08             	lea    0x8(%ebx),%eax
+    1afe:	85 db                	test   %ebx,%ebx
+    1b00:	75 cb                	jne    1acd <malloc+0x6d>
+    1b02:	31 c0                	xor    %eax,%eax
+}
+    1b04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b07:	5b                   	pop    %ebx
+    1b08:	5e                   	pop    %esi
+    1b09:	5f                   	pop    %edi
+    1b0a:	5d                   	pop    %ebp
+    1b0b:	c3                   	ret
+    1b0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1b10:	a1 24 30 00 00       	mov    0x3024,%eax
+    1b15:	85 c0                	test   %eax,%eax
+    1b17:	0f 85 29 01 00 00    	jne    1c46 <malloc+0x1e6>
+  if(small[c] == 0){
+    1b1d:	8b 04 8d 80 30 00 00 	mov    0x3080(,%ecx,4),%eax
+    1b24:	85 c0                	test   %eax,%eax
+    1b26:	0f 84 81 00 00 00    	je     1bad <malloc+0x14d>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1b2c:	31 db                	xor    %ebx,%ebx
+    1b2e:	eb 22                	jmp    1b52 <malloc+0xf2>
+    small[c] = p->s.ptr;
+    1b30:	8b 10                	mov    (%eax),%edx
+  for(moved = 0; moved < n && small[c]; moved++){
+    1b32:	83 c3 01             	add    $0x1,%ebx
+    small[c] = p->s.ptr;
+    1b35:	89 14 8d 80 30 00 00 	mov    %edx,0x3080(,%ecx,4)
+    p->s.ptr = tc->list[c];
+    1b3c:	8b 17                	mov    (%edi),%edx
+    1b3e:	89 10                	mov    %edx,(%eax)
+    tc->list[c] = p;
+    1b40:	89 07                	mov    %eax,(%edi)
+  for(moved = 0; moved < n && small[c]; moved++){
+    1b42:	83 fb 10             	cmp    $0x10,%ebx
+    1b45:	0f 84 e2 00 00 00    	je     1c2d <malloc+0x1cd>
+    1b4b:	8b 04 8d 80 30 00 00 	mov    0x3080(,%ecx,4),%eax
+    1b52:	85 c0                	test   %eax,%eax
+    1b54:	75 da                	jne    1b30 <malloc+0xd0>
+  if(threaded)
+    1b56:	8b 15 24 30 00 00    	mov    0x3024,%edx
+    1b5c:	85 d2                	test   %edx,%edx
+    1b5e:	0f 85 b4 00 00 00    	jne    1c18 <malloc+0x1b8>
+  tc->n[c] += moved;
+    1b64:	8b 57 20             	mov    0x20(%edi),%edx
+    1b67:	01 da                	add    %ebx,%edx
+    1b69:	89 57 20             	mov    %edx,0x20(%edi)
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1b6c:	85 db                	test   %ebx,%ebx
+    1b6e:	74 92                	je     1b02 <malloc+0xa2>
+  p = tc->list[c];
+    1b70:	8b 07                	mov    (%edi),%eax
+    1b72:	e9 49 ff ff ff       	jmp    1ac0 <malloc+0x60>
+    1b77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b7e:	66 90                	xchg   %ax,%ax
+    mutex_unlock(&lock);
+    1b80:	83 ec 0c             	sub    $0xc,%esp
+    1b83:	68 28 30 00 00       	push   $0x3028
+    1b88:	e8 e3 e8 ff ff       	call   470 <mutex_unlock>
+}
+    1b8d:	83 c4 10             	add    $0x10,%esp
+    1b90:	e9 66 ff ff ff       	jmp    1afb <malloc+0x9b>
+    1b95:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1b98:	83 ec 0c             	sub    $0xc,%esp
+    1b9b:	68 28 30 00 00       	push   $0x3028
+    1ba0:	e8 7b e8 ff ff       	call   420 <mutex_lock>
+}
+    1ba5:	83 c4 10             	add    $0x10,%esp
+    1ba8:	e9 38 ff ff ff       	jmp    1ae5 <malloc+0x85>
+    if((chunk = bigalloc(CHUNK / sizeof(Header) + 1)) == 0){
+    1bad:	b8 01 02 00 00       	mov    $0x201,%eax
+    1bb2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1bb5:	e8 46 fb ff ff       	call   1700 <bigalloc>
+    1bba:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1bbd:	85 c0                	test   %eax,%eax
+    1bbf:	89 c2                	mov    %eax,%edx
+    1bc1:	0f 84 ba 00 00 00    	je     1c81 <malloc+0x221>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1bc7:	83 c2 08             	add    $0x8,%edx
+    1bca:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+    1bd0:	0f 87 d0 00 00 00    	ja     1ca6 <malloc+0x246>
+    1bd6:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+    1bdd:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    1be0:	89 df                	mov    %ebx,%edi
+    1be2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1be5:	8d 76 00             	lea    0x0(%esi),%esi
+      p->s.size = units;
+    1be8:	89 72 04             	mov    %esi,0x4(%edx)
+      p->s.ptr = small[c];
+    1beb:	8b 04 8d 80 30 00 00 	mov    0x3080(,%ecx,4),%eax
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1bf2:	01 df                	add    %ebx,%edi
+    1bf4:	89 55 e0             	mov    %edx,-0x20(%ebp)
+      p->s.ptr = small[c];
+    1bf7:	89 02                	mov    %eax,(%edx)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1bf9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      small[c] = p;
+    1bfc:	89 14 8d 80 30 00 00 	mov    %edx,0x3080(,%ecx,4)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1c03:	01 c2                	add    %eax,%edx
+    1c05:	81 ff 00 02 00 00    	cmp    $0x200,%edi
+    1c0b:	76 db                	jbe    1be8 <malloc+0x188>
+    1c0d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1c10:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1c13:	e9 14 ff ff ff       	jmp    1b2c <malloc+0xcc>
+    mutex_unlock(&lock);
+    1c18:	83 ec 0c             	sub    $0xc,%esp
+    1c1b:	68 28 30 00 00       	push   $0x3028
+    1c20:	e8 4b e8 ff ff       	call   470 <mutex_unlock>
+}
+    1c25:	83 c4 10             	add    $0x10,%esp
+    1c28:	e9 37 ff ff ff       	jmp    1b64 <malloc+0x104>
+  if(threaded)
+    1c2d:	a1 24 30 00 00       	mov    0x3024,%eax
+    1c32:	85 c0                	test   %eax,%eax
+    1c34:	75 2b                	jne    1c61 <malloc+0x201>
+  tc->n[c] += moved;
+    1c36:	8b 47 20             	mov    0x20(%edi),%eax
+    1c39:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1c3c:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1c3e:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1c41:	e9 7a fe ff ff       	jmp    1ac0 <malloc+0x60>
+    mutex_lock(&lock);
+    1c46:	83 ec 0c             	sub    $0xc,%esp
+    1c49:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1c4c:	68 28 30 00 00       	push   $0x3028
+    1c51:	e8 ca e7 ff ff       	call   420 <mutex_lock>
+}
+    1c56:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1c59:	83 c4 10             	add    $0x10,%esp
+    1c5c:	e9 bc fe ff ff       	jmp    1b1d <malloc+0xbd>
+    mutex_unlock(&lock);
+    1c61:	83 ec 0c             	sub    $0xc,%esp
+    1c64:	68 28 30 00 00       	push   $0x3028
+    1c69:	e8 02 e8 ff ff       	call   470 <mutex_unlock>
+  tc->n[c] += moved;
+    1c6e:	8b 47 20             	mov    0x20(%edi),%eax
+    1c71:	83 c4 10             	add    $0x10,%esp
+    1c74:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1c77:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1c79:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1c7c:	e9 3f fe ff ff       	jmp    1ac0 <malloc+0x60>
+  if(threaded)
+    1c81:	8b 0d 24 30 00 00    	mov    0x3024,%ecx
+    1c87:	85 c9                	test   %ecx,%ecx
+    1c89:	0f 84 73 fe ff ff    	je     1b02 <malloc+0xa2>
+    mutex_unlock(&lock);
+    1c8f:	83 ec 0c             	sub    $0xc,%esp
+    1c92:	68 28 30 00 00       	push   $0x3028
+    1c97:	e8 d4 e7 ff ff       	call   470 <mutex_unlock>
+    1c9c:	83 c4 10             	add    $0x10,%esp
+    return p ? (void*)(p + 1) : 0;
+    1c9f:	31 c0                	xor    %eax,%eax
+    1ca1:	e9 5e fe ff ff       	jmp    1b04 <malloc+0xa4>
+  for(moved = 0; moved < n && small[c]; moved++){
+    1ca6:	8b 04 8d 80 30 00 00 	mov    0x3080(,%ecx,4),%eax
+    1cad:	e9 7a fe ff ff       	jmp    1b2c <malloc+0xcc>
+    1cb2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1cb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001cc0 <malloc_threaded>:
+void
+malloc_threaded(void)
+{
+  uint sp;
+
+  if(threaded)
+    1cc0:	a1 24 30 00 00       	mov    0x3024,%eax
+    1cc5:	85 c0                	test   %eax,%eax
+    1cc7:	74 07                	je     1cd0 <malloc_threaded+0x10>
+    1cc9:	c3                   	ret
+    1cca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+{
+    1cd0:	55                   	push   %ebp
+    1cd1:	89 e5                	mov    %esp,%ebp
+    1cd3:	83 ec 24             	sub    $0x24,%esp
+    return;
+  mutex_init(&lock);
+    1cd6:	68 28 30 00 00       	push   $0x3028
+    1cdb:	e8 30 e7 ff ff       	call   410 <mutex_init>
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1ce0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1ce3:	83 c4 10             	add    $0x10,%esp
+  threaded = 1;
+    1ce6:	c7 05 24 30 00 00 01 	movl   $0x1,0x3024
+    1ced:	00 00 00 
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1cf0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    1cf5:	a3 20 30 00 00       	mov    %eax,0x3020
+}
+    1cfa:	c9                   	leave
+    1cfb:	c3                   	ret
+    1cfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001d00 <malloc_thread_exit>:
+
+// Called by thread_join() with the cache slot of a finished
+// thread: give its blocks, and the cache itself, back.
+void
+malloc_thread_exit(void **cachep)
+{
+    1d00:	55                   	push   %ebp
+    1d01:	89 e5                	mov    %esp,%ebp
+    1d03:	57                   	push   %edi
+    1d04:	56                   	push   %esi
+    1d05:	53                   	push   %ebx
+    1d06:	83 ec 0c             	sub    $0xc,%esp
+    1d09:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct tcache *tc;
+  int c;
+
+  if((tc = *cachep) == 0)
+    1d0c:	8b 37                	mov    (%edi),%esi
+    1d0e:	85 f6                	test   %esi,%esi
+    1d10:	74 41                	je     1d53 <malloc_thread_exit+0x53>
+    return;
+  for(c = 0; c < NCLASS; c++)
+    1d12:	31 db                	xor    %ebx,%ebx
+    1d14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    drain(tc, c, tc->n[c]);
+    1d18:	8b 4c 9e 20          	mov    0x20(%esi,%ebx,4),%ecx
+    1d1c:	89 da                	mov    %ebx,%edx
+    1d1e:	89 f0                	mov    %esi,%eax
+  for(c = 0; c < NCLASS; c++)
+    1d20:	83 c3 01             	add    $0x1,%ebx
+    drain(tc, c, tc->n[c]);
+    1d23:	e8 c8 fa ff ff       	call   17f0 <drain>
+  for(c = 0; c < NCLASS; c++)
+    1d28:	83 fb 08             	cmp    $0x8,%ebx
+    1d2b:	75 eb                	jne    1d18 <malloc_thread_exit+0x18>
+  if(threaded)
+    1d2d:	8b 15 24 30 00 00    	mov    0x3024,%edx
+    1d33:	85 d2                	test   %edx,%edx
+    1d35:	75 29                	jne    1d60 <malloc_thread_exit+0x60>
+  acquire();
+  trim(bigfree((Header*)tc - 1));
+    1d37:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1d3a:	e8 c1 f8 ff ff       	call   1600 <bigfree>
+    1d3f:	e8 3c f9 ff ff       	call   1680 <trim>
+  if(threaded)
+    1d44:	a1 24 30 00 00       	mov    0x3024,%eax
+    1d49:	85 c0                	test   %eax,%eax
+    1d4b:	75 2b                	jne    1d78 <malloc_thread_exit+0x78>
+  release();
+  *cachep = 0;
+    1d4d:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+}
+    1d53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d56:	5b                   	pop    %ebx
+    1d57:	5e                   	pop    %esi
+    1d58:	5f                   	pop    %edi
+    1d59:	5d                   	pop    %ebp
+    1d5a:	c3                   	ret
+    1d5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1d5f:	90                   	nop
+    mutex_lock(&lock);
+    1d60:	83 ec 0c             	sub    $0xc,%esp
+    1d63:	68 28 30 00 00       	push   $0x3028
+    1d68:	e8 b3 e6 ff ff       	call   420 <mutex_lock>
+}
+    1d6d:	83 c4 10             	add    $0x10,%esp
+    1d70:	eb c5                	jmp    1d37 <malloc_thread_exit+0x37>
+    1d72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1d78:	83 ec 0c             	sub    $0xc,%esp
+    1d7b:	68 28 30 00 00       	push   $0x3028
+    1d80:	e8 eb e6 ff ff       	call   470 <mutex_unlock>
+}
+    1d85:	83 c4 10             	add    $0x10,%esp
+    1d88:	eb c3                	jmp    1d4d <malloc_thread_exit+0x4d>
+    1d8a:	66 90                	xchg   %ax,%ax
+    1d8c:	66 90                	xchg   %ax,%ax
+    1d8e:	66 90                	xchg   %ax,%ax
+
+00001d90 <thread_create>:
+
+// Start fn(arg) in a new thread on a freshly allocated
+// page-aligned stack.  Returns the thread's pid.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1d90:	55                   	push   %ebp
+    1d91:	89 e5                	mov    %esp,%ebp
+    1d93:	53                   	push   %ebx
+    1d94:	83 ec 14             	sub    $0x14,%esp
+  char *mem, *stack;
+  int pid;
+
+  malloc_threaded();
+    1d97:	e8 24 ff ff ff       	call   1cc0 <malloc_threaded>
+  stdio_threaded();
+    1d9c:	e8 cf ee ff ff       	call   c70 <stdio_threaded>
+  if((mem = malloc(2*PGSIZE)) == 0)
+    1da1:	83 ec 0c             	sub    $0xc,%esp
+    1da4:	68 00 20 00 00       	push   $0x2000
+    1da9:	e8 b2 fc ff ff       	call   1a60 <malloc>
+    1dae:	83 c4 10             	add    $0x10,%esp
+    1db1:	85 c0                	test   %eax,%eax
+    1db3:	74 52                	je     1e07 <thread_create+0x77>
+    1db5:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1db7:	8d 80 07 10 00 00    	lea    0x1007(%eax),%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+  ((char**)stack)[-2] = 0;
+  if((pid = clone(fn, arg, stack)) < 0)
+    1dbd:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1dc0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+    1dc5:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  ((char**)stack)[-2] = 0;
+    1dc8:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+  if((pid = clone(fn, arg, stack)) < 0)
+    1dcf:	50                   	push   %eax
+    1dd0:	ff 75 0c             	push   0xc(%ebp)
+    1dd3:	ff 75 08             	push   0x8(%ebp)
+    1dd6:	e8 97 e8 ff ff       	call   672 <clone>
+    1ddb:	83 c4 10             	add    $0x10,%esp
+    1dde:	85 c0                	test   %eax,%eax
+    1de0:	78 0e                	js     1df0 <thread_create+0x60>
+    free(mem);
+  return pid;
+}
+    1de2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1de5:	c9                   	leave
+    1de6:	c3                   	ret
+    1de7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1dee:	66 90                	xchg   %ax,%ax
+    free(mem);
+    1df0:	83 ec 0c             	sub    $0xc,%esp
+    1df3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1df6:	53                   	push   %ebx
+    1df7:	e8 34 fb ff ff       	call   1930 <free>
+    1dfc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1dff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    1e02:	83 c4 10             	add    $0x10,%esp
+}
+    1e05:	c9                   	leave
+    1e06:	c3                   	ret
+    return -1;
+    1e07:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1e0c:	eb d4                	jmp    1de2 <thread_create+0x52>
+    1e0e:	66 90                	xchg   %ax,%ax
+
+00001e10 <thread_join>:
+
+// Wait for a thread to finish and free its stack.
+int
+thread_join(void)
+{
+    1e10:	55                   	push   %ebp
+    1e11:	89 e5                	mov    %esp,%ebp
+    1e13:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    1e14:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    1e17:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    1e1a:	50                   	push   %eax
+    1e1b:	e8 61 e8 ff ff       	call   681 <join>
+    1e20:	83 c4 10             	add    $0x10,%esp
+    1e23:	85 c0                	test   %eax,%eax
+    1e25:	78 29                	js     1e50 <thread_join+0x40>
+    1e27:	89 c3                	mov    %eax,%ebx
+    return -1;
+  malloc_thread_exit(&((void**)stack)[-2]);
+    1e29:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1e2c:	83 ec 0c             	sub    $0xc,%esp
+    1e2f:	83 e8 08             	sub    $0x8,%eax
+    1e32:	50                   	push   %eax
+    1e33:	e8 c8 fe ff ff       	call   1d00 <malloc_thread_exit>
+  free(((char**)stack)[-1]);
+    1e38:	58                   	pop    %eax
+    1e39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1e3c:	ff 70 fc             	push   -0x4(%eax)
+    1e3f:	e8 ec fa ff ff       	call   1930 <free>
+  return pid;
+    1e44:	83 c4 10             	add    $0x10,%esp
+}
+    1e47:	89 d8                	mov    %ebx,%eax
+    1e49:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1e4c:	c9                   	leave
+    1e4d:	c3                   	ret
+    1e4e:	66 90                	xchg   %ax,%ax
+    return -1;
+    1e50:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    1e55:	eb f0                	jmp    1e47 <thread_join+0x37>
@@ -0,0 +1,63 @@
+// Compare copying pipe writes with vmsplice() page gifts.
+// For each transfer size a writer moves TOTAL bytes to a reader,
+// once with write() and once with vmsplice(); both use page-aligned
+// buffers so the reader can take gifted pages by remapping.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "mmu.h"
+
+#define TOTAL (4*1024*1024)
+#define MAXSZ (64*1024)
+
+char *buf;
+
+int
+run(int size, int splice)
+{
+  int fds[2], n, total, t0;
+
+  if(pipe(fds) < 0){
+    printf(2, "splicebench: pipe failed\n");
+    exit();
+  }
+  t0 = uptime();
+  if(fork() == 0){
+    close(fds[1]);
+    total = 0;
+    while((n = read(fds[0], buf, size)) > 0)
+      total += n;
+    if(total != TOTAL)
+      printf(2, "splicebench: read %d bytes, want %d\n", total, TOTAL);
+    exit();
+  }
+  close(fds[0]);
+  for(total = 0; total < TOTAL; total += size){
+    if(splice)
+      n = vmsplice(fds[1], buf, size);
+    else
+      n = write(fds[1], buf, size);
+    if(n != size){
+      printf(2, "splicebench: write failed\n");
+      break;
+    }
+  }
+  close(fds[1]);
+  wait();
+  return uptime() - t0;
+}
+
+int
+main(void)
+{
+  int size;
+
+  buf = sbrk(MAXSZ + PGSIZE);
+  buf = (char*)PGROUNDUP((uint)buf);
+
+  printf(1, "size\twrite\tvmsplice (ticks for %d KB)\n", TOTAL / 1024);
+  for(size = PGSIZE; size <= MAXSZ; size *= 2)
+    printf(1, "%d\t%d\t%d\n", size, run(size, 0), run(size, 1));
+  exit();
+}
@@ -0,0 +1,349 @@
+// Buffered I/O streams.
+//
+// A stream collects output in its buffer and writes it out with one
+// system call when the buffer fills, on fflush(), and before fork(),
+// exec() and exit() (see ulib.c). A line-buffered stream, such as
+// one on the console, also flushes whenever a newline goes in.
+// Input is read a buffer at a time; reading from the console first
+// flushes all output, so that prompts appear.
+//
+// Once thread_create() has started a thread, each stream's mutex
+// serializes the threads using it, and another guards the choice of
+// a free stream in fopen(). printf() holds the lock for a whole
+// call, so that lines from different threads do not interleave.
+
+#include "types.h"
+#include "stat.h"
+#include "fcntl.h"
+#include "user.h"
+
+#define NSTREAM 8
+
+static char inbuf[BUFSIZ], outbuf[BUFSIZ], errbuf[BUFSIZ];
+
+static struct mutex iolock;   // guards the choice of a free stream
+static int threaded;
+
+struct iobuf _iob[NSTREAM] = {
+  { 0, IO_READ, inbuf, BUFSIZ },
+  { 1, IO_WRITE, outbuf, BUFSIZ },
+  { 2, IO_WRITE|IO_LINE, errbuf, BUFSIZ },
+};
+
+static int flush(FILE*);
+
+static void
+flushall(void)
+{
+  fflush(0);
+}
+
+// Called by thread_create() before the first thread starts.
+void
+stdio_threaded(void)
+{
+  threaded = 1;
+}
+
+void
+flockfile(FILE *f)
+{
+  if(threaded)
+    mutex_lock(&f->lock);
+}
+
+void
+funlockfile(FILE *f)
+{
+  if(threaded)
+    mutex_unlock(&f->lock);
+}
+
+// Choose how to buffer f on first use: by lines on a device.
+static void
+setup(FILE *f)
+{
+  struct stat st;
+
+  f->flags |= IO_SETUP;
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+    f->flags |= IO_DEV|IO_LINE;
+  if(f->flags & IO_WRITE)
+    flushhook = flushall;
+}
+
+// Claim a free stream, marking it in use. Returns 0 if none.
+static FILE*
+claim(void)
+{
+  FILE *f;
+
+  if(threaded)
+    mutex_lock(&iolock);
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+    if(f->flags == 0)
+      break;
+  if(f == &_iob[NSTREAM])
+    f = 0;
+  else
+    f->flags = IO_MALLOC;
+  if(threaded)
+    mutex_unlock(&iolock);
+  return f;
+}
+
+FILE*
+fopen(const char *path, const char *mode)
+{
+  struct stat st;
+  FILE *f;
+  int fd, flags;
+
+  if(strcmp(mode, "r") != 0 && strcmp(mode, "w") != 0)
+    return 0;
+  if((f = claim()) == 0)
+    return 0;
+  if(mode[0] == 'r'){
+    fd = open(path, O_RDONLY);
+    flags = IO_READ;
+  } else {
+    // There is no O_TRUNC: start a plain file afresh.
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+      unlink(path);
+    fd = open(path, O_CREATE|O_WRONLY);
+    flags = IO_WRITE;
+  }
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+    if(fd >= 0)
+      close(fd);
+    f->flags = 0;
+    return 0;
+  }
+  f->fd = fd;
+  f->size = BUFSIZ;
+  f->r = f->n = 0;
+  f->flags = flags|IO_MALLOC;
+  return f;
+}
+
+int
+fclose(FILE *f)
+{
+  int r;
+
+  flockfile(f);
+  r = flush(f);
+  if(close(f->fd) < 0)
+    r = EOF;
+  if(f->flags & IO_MALLOC)
+    free(f->buf);
+  f->flags = 0;
+  funlockfile(f);
+  return r;
+}
+
+// Write out f's buffered output, or that of every stream if f is 0.
+int
+fflush(FILE *f)
+{
+  int r;
+
+  if(f == 0){
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+      if((f->flags & IO_WRITE) && fflush(f) < 0)
+        r = EOF;
+    return r;
+  }
+  flockfile(f);
+  r = flush(f);
+  funlockfile(f);
+  return r;
+}
+
+// Write out f's buffered output. Caller holds f's lock.
+static int
+flush(FILE *f)
+{
+  int i, n;
+
+  if(!(f->flags & IO_WRITE))
+    return 0;
+  for(i = 0; i < f->n; i += n){
+    if((n = write(f->fd, f->buf + i, f->n - i)) <= 0){
+      f->flags |= IO_ERR;
+      f->n = 0;
+      return EOF;
+    }
+  }
+  f->n = 0;
+  return 0;
+}
+
+// fputc() for a caller that holds f's lock.
+int
+putc_unlocked(int c, FILE *f)
+{
+  if(!(f->flags & IO_WRITE))
+    return EOF;
+  if(!(f->flags & IO_SETUP))
+    setup(f);
+  if(f->n == f->size && flush(f) < 0)
+    return EOF;
+  f->buf[f->n++] = c;
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    return EOF;
+  return c & 0xff;
+}
+
+int
+fputc(int c, FILE *f)
+{
+  flockfile(f);
+  c = putc_unlocked(c, f);
+  funlockfile(f);
+  return c;
+}
+
+int
+fwrite(const void *p, int size, int nmemb, FILE *f)
+{
+  const char *s;
+  int i, n, len, nl;
+
+  if(!(f->flags & IO_WRITE) || size <= 0)
+    return 0;
+  flockfile(f);
+  if(!(f->flags & IO_SETUP))
+    setup(f);
+  s = p;
+  nl = 0;
+  for(len = size*nmemb; len > 0; len -= n){
+    if(f->n == f->size && flush(f) < 0)
+      break;
+    n = f->size - f->n;
+    if(n > len)
+      n = len;
+    for(i = 0; i < n; i++)
+      if((f->buf[f->n++] = s[i]) == '\n')
+        nl = 1;
+    s += n;
+  }
+  if(nl && (f->flags & IO_LINE))
+    flush(f);
+  funlockfile(f);
+  return (s - (const char*)p) / size;
+}
+
+// Refill f's buffer. Returns the number of bytes read.
+// Caller holds f's lock.
+static int
+fill(FILE *f)
+{
+  int n;
+
+  if(!(f->flags & IO_SETUP))
+    setup(f);
+  if(f->flags & IO_DEV)
+    fflush(0);
+  f->r = 0;
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+    f->flags |= n < 0 ? IO_ERR : IO_EOF;
+    n = 0;
+  }
+  f->n = n;
+  return n;
+}
+
+static int
+getc_unlocked(FILE *f)
+{
+  if(!(f->flags & IO_READ))
+    return EOF;
+  if(f->r == f->n && fill(f) == 0)
+    return EOF;
+  return f->buf[f->r++] & 0xff;
+}
+
+int
+fgetc(FILE *f)
+{
+  int c;
+
+  flockfile(f);
+  c = getc_unlocked(f);
+  funlockfile(f);
+  return c;
+}
+
+int
+fread(void *p, int size, int nmemb, FILE *f)
+{
+  char *d;
+  int n, len;
+
+  if(!(f->flags & IO_READ) || size <= 0)
+    return 0;
+  flockfile(f);
+  d = p;
+  for(len = size*nmemb; len > 0; len -= n){
+    if(f->r == f->n && fill(f) == 0)
+      break;
+    n = f->n - f->r;
+    if(n > len)
+      n = len;
+    memmove(d, f->buf + f->r, n);
+    f->r += n;
+    d += n;
+  }
+  funlockfile(f);
+  return (d - (char*)p) / size;
+}
+
+// Read a line of at most max-1 bytes, keeping the newline.
+// Returns 0 if there was nothing left to read.
+char*
+fgets(char *buf, int max, FILE *f)
+{
+  int i, c;
+
+  flockfile(f);
+  for(i = 0; i+1 < max; ){
+    if((c = getc_unlocked(f)) == EOF)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+  }
+  buf[i] = '\0';
+  funlockfile(f);
+  return i > 0 ? buf : 0;
+}
+
+// Read a line from standard input. Only the console, which returns
+// at most a line per read(), goes through stdin's buffer: from a
+// file or pipe, a buffered read could take input meant for a child
+// process, so read a byte at a time.
+char*
+gets(char *buf, int max)
+{
+  int i, cc;
+  char c;
+
+  if(!(stdin->flags & IO_SETUP))
+    setup(stdin);
+  if(stdin->flags & IO_DEV){
+    fgets(buf, max, stdin);
+    return buf;
+  }
+  fflush(0);
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    if(cc < 1)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+  }
+  buf[i] = '\0';
+  return buf;
+}
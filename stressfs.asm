@@ -0,0 +1,4060 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+  int fd, i;
+  char path[] = "stressfs0";
+       7:	b8 30 00 00 00       	mov    $0x30,%eax
+{
+       c:	ff 71 fc             	push   -0x4(%ecx)
+       f:	55                   	push   %ebp
+      10:	89 e5                	mov    %esp,%ebp
+      12:	57                   	push   %edi
+      13:	56                   	push   %esi
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+  memset(data, 'a', sizeof(data));
+      14:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+{
+      1a:	53                   	push   %ebx
+
+  for(i = 0; i < 4; i++)
+      1b:	31 db                	xor    %ebx,%ebx
+{
+      1d:	51                   	push   %ecx
+      1e:	81 ec 20 02 00 00    	sub    $0x220,%esp
+  char path[] = "stressfs0";
+      24:	66 89 85 e6 fd ff ff 	mov    %ax,-0x21a(%ebp)
+      2b:	c7 85 de fd ff ff 73 	movl   $0x65727473,-0x222(%ebp)
+      32:	74 72 65 
+      35:	c7 85 e2 fd ff ff 73 	movl   $0x73667373,-0x21e(%ebp)
+      3c:	73 66 73 
+  printf(1, "stressfs starting\n");
+      3f:	68 c8 1d 00 00       	push   $0x1dc8
+      44:	6a 01                	push   $0x1
+      46:	e8 f5 08 00 00       	call   940 <printf>
+  memset(data, 'a', sizeof(data));
+      4b:	83 c4 0c             	add    $0xc,%esp
+      4e:	68 00 02 00 00       	push   $0x200
+      53:	6a 61                	push   $0x61
+      55:	56                   	push   %esi
+      56:	e8 05 02 00 00       	call   260 <memset>
+      5b:	83 c4 10             	add    $0x10,%esp
+    if(fork() > 0)
+      5e:	e8 bd 00 00 00       	call   120 <fork>
+      63:	85 c0                	test   %eax,%eax
+      65:	7f 08                	jg     6f <main+0x6f>
+  for(i = 0; i < 4; i++)
+      67:	83 c3 01             	add    $0x1,%ebx
+      6a:	83 fb 04             	cmp    $0x4,%ebx
+      6d:	75 ef                	jne    5e <main+0x5e>
+      break;
+
+  printf(1, "write %d\n", i);
+      6f:	83 ec 04             	sub    $0x4,%esp
+      72:	53                   	push   %ebx
+      73:	68 db 1d 00 00       	push   $0x1ddb
+      78:	6a 01                	push   $0x1
+      7a:	e8 c1 08 00 00       	call   940 <printf>
+
+  path[8] += i;
+      7f:	00 9d e6 fd ff ff    	add    %bl,-0x21a(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+      85:	5f                   	pop    %edi
+      86:	bb 14 00 00 00       	mov    $0x14,%ebx
+      8b:	58                   	pop    %eax
+      8c:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+      92:	68 02 02 00 00       	push   $0x202
+      97:	50                   	push   %eax
+      98:	e8 a0 04 00 00       	call   53d <open>
+      9d:	83 c4 10             	add    $0x10,%esp
+      a0:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < 20; i++)
+      a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+      a8:	83 ec 04             	sub    $0x4,%esp
+      ab:	68 00 02 00 00       	push   $0x200
+      b0:	56                   	push   %esi
+      b1:	57                   	push   %edi
+      b2:	e8 4a 04 00 00       	call   501 <write>
+  for(i = 0; i < 20; i++)
+      b7:	83 c4 10             	add    $0x10,%esp
+      ba:	83 eb 01             	sub    $0x1,%ebx
+      bd:	75 e9                	jne    a8 <main+0xa8>
+  close(fd);
+      bf:	83 ec 0c             	sub    $0xc,%esp
+      c2:	57                   	push   %edi
+      c3:	e8 48 04 00 00       	call   510 <close>
+
+  printf(1, "read\n");
+      c8:	58                   	pop    %eax
+      c9:	5a                   	pop    %edx
+      ca:	68 e5 1d 00 00       	push   $0x1de5
+      cf:	6a 01                	push   $0x1
+      d1:	e8 6a 08 00 00       	call   940 <printf>
+
+  fd = open(path, O_RDONLY);
+      d6:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+      dc:	59                   	pop    %ecx
+      dd:	5b                   	pop    %ebx
+      de:	6a 00                	push   $0x0
+      e0:	bb 14 00 00 00       	mov    $0x14,%ebx
+      e5:	50                   	push   %eax
+      e6:	e8 52 04 00 00       	call   53d <open>
+      eb:	83 c4 10             	add    $0x10,%esp
+      ee:	89 c7                	mov    %eax,%edi
+  for (i = 0; i < 20; i++)
+    read(fd, data, sizeof(data));
+      f0:	83 ec 04             	sub    $0x4,%esp
+      f3:	68 00 02 00 00       	push   $0x200
+      f8:	56                   	push   %esi
+      f9:	57                   	push   %edi
+      fa:	e8 f3 03 00 00       	call   4f2 <read>
+  for (i = 0; i < 20; i++)
+      ff:	83 c4 10             	add    $0x10,%esp
+     102:	83 eb 01             	sub    $0x1,%ebx
+     105:	75 e9                	jne    f0 <main+0xf0>
+  close(fd);
+     107:	83 ec 0c             	sub    $0xc,%esp
+     10a:	57                   	push   %edi
+     10b:	e8 00 04 00 00       	call   510 <close>
+
+  wait();
+     110:	e8 bf 03 00 00       	call   4d4 <wait>
+
+  exit();
+     115:	e8 66 00 00 00       	call   180 <exit>
+     11a:	66 90                	xchg   %ax,%ax
+     11c:	66 90                	xchg   %ax,%ax
+     11e:	66 90                	xchg   %ax,%ax
+
+00000120 <fork>:
+int sysexit(void) __attribute__((noreturn));
+
+int
+fork(void)
+{
+  if(flushhook)
+     120:	a1 a0 28 00 00       	mov    0x28a0,%eax
+     125:	85 c0                	test   %eax,%eax
+     127:	74 17                	je     140 <fork+0x20>
+{
+     129:	55                   	push   %ebp
+     12a:	89 e5                	mov    %esp,%ebp
+     12c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     12f:	ff d0                	call   *%eax
+  return sysfork();
+}
+     131:	c9                   	leave
+  return sysfork();
+     132:	e9 7f 03 00 00       	jmp    4b6 <sysfork>
+     137:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     13e:	66 90                	xchg   %ax,%ax
+     140:	e9 71 03 00 00       	jmp    4b6 <sysfork>
+     145:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+     150:	55                   	push   %ebp
+  if(flushhook)
+     151:	a1 a0 28 00 00       	mov    0x28a0,%eax
+{
+     156:	89 e5                	mov    %esp,%ebp
+     158:	56                   	push   %esi
+     159:	53                   	push   %ebx
+     15a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     15d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     160:	85 c0                	test   %eax,%eax
+     162:	74 02                	je     166 <exec+0x16>
+    flushhook();
+     164:	ff d0                	call   *%eax
+  return sysexec(path, argv);
+     166:	89 75 0c             	mov    %esi,0xc(%ebp)
+     169:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     16c:	5b                   	pop    %ebx
+     16d:	5e                   	pop    %esi
+     16e:	5d                   	pop    %ebp
+  return sysexec(path, argv);
+     16f:	e9 ba 03 00 00       	jmp    52e <sysexec>
+     174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     17b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     17f:	90                   	nop
+
+00000180 <exit>:
+
+int
+exit(void)
+{
+     180:	55                   	push   %ebp
+     181:	89 e5                	mov    %esp,%ebp
+     183:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     186:	a1 a0 28 00 00       	mov    0x28a0,%eax
+     18b:	85 c0                	test   %eax,%eax
+     18d:	74 02                	je     191 <exit+0x11>
+    flushhook();
+     18f:	ff d0                	call   *%eax
+  sysexit();
+     191:	e8 2f 03 00 00       	call   4c5 <sysexit>
+     196:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     19d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001a0 <strcpy>:
+}
+
+char*
+strcpy(char *s, const char *t)
+{
+     1a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     1a1:	31 c0                	xor    %eax,%eax
+{
+     1a3:	89 e5                	mov    %esp,%ebp
+     1a5:	53                   	push   %ebx
+     1a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     1a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     1ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     1b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     1b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     1b7:	83 c0 01             	add    $0x1,%eax
+     1ba:	84 d2                	test   %dl,%dl
+     1bc:	75 f2                	jne    1b0 <strcpy+0x10>
+    ;
+  return os;
+}
+     1be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1c1:	89 c8                	mov    %ecx,%eax
+     1c3:	c9                   	leave
+     1c4:	c3                   	ret
+     1c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     1d0:	55                   	push   %ebp
+     1d1:	89 e5                	mov    %esp,%ebp
+     1d3:	53                   	push   %ebx
+     1d4:	8b 55 08             	mov    0x8(%ebp),%edx
+     1d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     1da:	0f b6 02             	movzbl (%edx),%eax
+     1dd:	84 c0                	test   %al,%al
+     1df:	75 17                	jne    1f8 <strcmp+0x28>
+     1e1:	eb 3a                	jmp    21d <strcmp+0x4d>
+     1e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1e7:	90                   	nop
+     1e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     1ec:	83 c2 01             	add    $0x1,%edx
+     1ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     1f2:	84 c0                	test   %al,%al
+     1f4:	74 1a                	je     210 <strcmp+0x40>
+    p++, q++;
+     1f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     1f8:	0f b6 19             	movzbl (%ecx),%ebx
+     1fb:	38 c3                	cmp    %al,%bl
+     1fd:	74 e9                	je     1e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     1ff:	29 d8                	sub    %ebx,%eax
+}
+     201:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     204:	c9                   	leave
+     205:	c3                   	ret
+     206:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     20d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     210:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     214:	31 c0                	xor    %eax,%eax
+     216:	29 d8                	sub    %ebx,%eax
+}
+     218:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     21b:	c9                   	leave
+     21c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     21d:	0f b6 19             	movzbl (%ecx),%ebx
+     220:	31 c0                	xor    %eax,%eax
+     222:	eb db                	jmp    1ff <strcmp+0x2f>
+     224:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     22b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     22f:	90                   	nop
+
+00000230 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     230:	55                   	push   %ebp
+     231:	89 e5                	mov    %esp,%ebp
+     233:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     236:	80 3a 00             	cmpb   $0x0,(%edx)
+     239:	74 15                	je     250 <strlen+0x20>
+     23b:	31 c0                	xor    %eax,%eax
+     23d:	8d 76 00             	lea    0x0(%esi),%esi
+     240:	83 c0 01             	add    $0x1,%eax
+     243:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     247:	89 c1                	mov    %eax,%ecx
+     249:	75 f5                	jne    240 <strlen+0x10>
+    ;
+  return n;
+}
+     24b:	89 c8                	mov    %ecx,%eax
+     24d:	5d                   	pop    %ebp
+     24e:	c3                   	ret
+     24f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     250:	31 c9                	xor    %ecx,%ecx
+}
+     252:	5d                   	pop    %ebp
+     253:	89 c8                	mov    %ecx,%eax
+     255:	c3                   	ret
+     256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     25d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000260 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     260:	55                   	push   %ebp
+     261:	89 e5                	mov    %esp,%ebp
+     263:	57                   	push   %edi
+     264:	8b 55 08             	mov    0x8(%ebp),%edx
+            "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt) {
+    asm volatile("cld; rep stosb" :
+     267:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     26a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     26d:	89 d7                	mov    %edx,%edi
+     26f:	fc                   	cld
+     270:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     272:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     275:	89 d0                	mov    %edx,%eax
+     277:	c9                   	leave
+     278:	c3                   	ret
+     279:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     280:	55                   	push   %ebp
+     281:	89 e5                	mov    %esp,%ebp
+     283:	8b 45 08             	mov    0x8(%ebp),%eax
+     286:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     28a:	0f b6 10             	movzbl (%eax),%edx
+     28d:	84 d2                	test   %dl,%dl
+     28f:	75 12                	jne    2a3 <strchr+0x23>
+     291:	eb 1d                	jmp    2b0 <strchr+0x30>
+     293:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     297:	90                   	nop
+     298:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     29c:	83 c0 01             	add    $0x1,%eax
+     29f:	84 d2                	test   %dl,%dl
+     2a1:	74 0d                	je     2b0 <strchr+0x30>
+    if(*s == c)
+     2a3:	38 d1                	cmp    %dl,%cl
+     2a5:	75 f1                	jne    298 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     2a7:	5d                   	pop    %ebp
+     2a8:	c3                   	ret
+     2a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     2b0:	31 c0                	xor    %eax,%eax
+}
+     2b2:	5d                   	pop    %ebp
+     2b3:	c3                   	ret
+     2b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2bf:	90                   	nop
+
+000002c0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     2c0:	55                   	push   %ebp
+     2c1:	89 e5                	mov    %esp,%ebp
+     2c3:	56                   	push   %esi
+     2c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     2c5:	83 ec 08             	sub    $0x8,%esp
+     2c8:	6a 00                	push   $0x0
+     2ca:	ff 75 08             	push   0x8(%ebp)
+     2cd:	e8 6b 02 00 00       	call   53d <open>
+  if(fd < 0)
+     2d2:	83 c4 10             	add    $0x10,%esp
+     2d5:	85 c0                	test   %eax,%eax
+     2d7:	78 27                	js     300 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     2d9:	83 ec 08             	sub    $0x8,%esp
+     2dc:	ff 75 0c             	push   0xc(%ebp)
+     2df:	89 c3                	mov    %eax,%ebx
+     2e1:	50                   	push   %eax
+     2e2:	e8 83 02 00 00       	call   56a <fstat>
+  close(fd);
+     2e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     2ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+     2ec:	e8 1f 02 00 00       	call   510 <close>
+  return r;
+     2f1:	83 c4 10             	add    $0x10,%esp
+}
+     2f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     2f7:	89 f0                	mov    %esi,%eax
+     2f9:	5b                   	pop    %ebx
+     2fa:	5e                   	pop    %esi
+     2fb:	5d                   	pop    %ebp
+     2fc:	c3                   	ret
+     2fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     300:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     305:	eb ed                	jmp    2f4 <stat+0x34>
+     307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     30e:	66 90                	xchg   %ax,%ax
+
+00000310 <atoi>:
+
+int
+atoi(const char *s)
+{
+     310:	55                   	push   %ebp
+     311:	89 e5                	mov    %esp,%ebp
+     313:	53                   	push   %ebx
+     314:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     317:	0f be 02             	movsbl (%edx),%eax
+     31a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     31d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     320:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     325:	77 1e                	ja     345 <atoi+0x35>
+     327:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     32e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     330:	83 c2 01             	add    $0x1,%edx
+     333:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     336:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     33a:	0f be 02             	movsbl (%edx),%eax
+     33d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     340:	80 fb 09             	cmp    $0x9,%bl
+     343:	76 eb                	jbe    330 <atoi+0x20>
+  return n;
+}
+     345:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     348:	89 c8                	mov    %ecx,%eax
+     34a:	c9                   	leave
+     34b:	c3                   	ret
+     34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000350 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     350:	55                   	push   %ebp
+     351:	89 e5                	mov    %esp,%ebp
+     353:	57                   	push   %edi
+     354:	56                   	push   %esi
+     355:	8b 45 10             	mov    0x10(%ebp),%eax
+     358:	8b 55 08             	mov    0x8(%ebp),%edx
+     35b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     35e:	85 c0                	test   %eax,%eax
+     360:	7e 13                	jle    375 <memmove+0x25>
+     362:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     364:	89 d7                	mov    %edx,%edi
+     366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     36d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     370:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     371:	39 f8                	cmp    %edi,%eax
+     373:	75 fb                	jne    370 <memmove+0x20>
+  return vdst;
+}
+     375:	5e                   	pop    %esi
+     376:	89 d0                	mov    %edx,%eax
+     378:	5f                   	pop    %edi
+     379:	5d                   	pop    %ebp
+     37a:	c3                   	ret
+     37b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     37f:	90                   	nop
+
+00000380 <mutex_init>:
+
+// Futex-based mutex (Drepper, "Futexes Are Tricky", mutex 2).
+// The uncontended paths never enter the kernel.
+void
+mutex_init(struct mutex *m)
+{
+     380:	55                   	push   %ebp
+     381:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+     383:	8b 45 08             	mov    0x8(%ebp),%eax
+     386:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     38c:	5d                   	pop    %ebp
+     38d:	c3                   	ret
+     38e:	66 90                	xchg   %ax,%ax
+
+00000390 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     390:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     391:	31 c0                	xor    %eax,%eax
+     393:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+     398:	89 e5                	mov    %esp,%ebp
+     39a:	56                   	push   %esi
+     39b:	53                   	push   %ebx
+     39c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     39f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     3a3:	85 c0                	test   %eax,%eax
+     3a5:	74 32                	je     3d9 <mutex_lock+0x49>
+    return;
+  if(c != 2)
+     3a7:	83 f8 02             	cmp    $0x2,%eax
+     3aa:	74 0c                	je     3b8 <mutex_lock+0x28>
+static inline uint
+xchg(volatile uint *addr, uint newval) {
+    uint result;
+
+    // The + in "+m" denotes a read-modify-write operand.
+    asm volatile("lock; xchgl %0, %1" :
+     3ac:	b8 02 00 00 00       	mov    $0x2,%eax
+     3b1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+     3b4:	85 c0                	test   %eax,%eax
+     3b6:	74 21                	je     3d9 <mutex_lock+0x49>
+     3b8:	be 02 00 00 00       	mov    $0x2,%esi
+     3bd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAIT, 2);
+     3c0:	83 ec 04             	sub    $0x4,%esp
+     3c3:	6a 02                	push   $0x2
+     3c5:	6a 00                	push   $0x0
+     3c7:	53                   	push   %ebx
+     3c8:	e8 33 02 00 00       	call   600 <futex>
+     3cd:	89 f0                	mov    %esi,%eax
+     3cf:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     3d2:	83 c4 10             	add    $0x10,%esp
+     3d5:	85 c0                	test   %eax,%eax
+     3d7:	75 e7                	jne    3c0 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+     3d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     3dc:	5b                   	pop    %ebx
+     3dd:	5e                   	pop    %esi
+     3de:	5d                   	pop    %ebp
+     3df:	c3                   	ret
+
+000003e0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     3e0:	55                   	push   %ebp
+     3e1:	89 e5                	mov    %esp,%ebp
+     3e3:	83 ec 08             	sub    $0x8,%esp
+     3e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     3e9:	f0 83 28 01          	lock subl $0x1,(%eax)
+     3ed:	75 09                	jne    3f8 <mutex_unlock+0x18>
+    m->val = 0;
+    futex(&m->val, FUTEX_WAKE, 1);
+  }
+}
+     3ef:	c9                   	leave
+     3f0:	c3                   	ret
+     3f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     3f8:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     3fb:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex(&m->val, FUTEX_WAKE, 1);
+     401:	6a 01                	push   $0x1
+     403:	6a 01                	push   $0x1
+     405:	50                   	push   %eax
+     406:	e8 f5 01 00 00       	call   600 <futex>
+     40b:	83 c4 10             	add    $0x10,%esp
+}
+     40e:	c9                   	leave
+     40f:	c3                   	ret
+
+00000410 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     410:	55                   	push   %ebp
+     411:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     413:	8b 45 08             	mov    0x8(%ebp),%eax
+     416:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     41c:	5d                   	pop    %ebp
+     41d:	c3                   	ret
+     41e:	66 90                	xchg   %ax,%ax
+
+00000420 <cond_wait>:
+
+// Release m and wait for a signal, then reacquire m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     420:	55                   	push   %ebp
+     421:	89 e5                	mov    %esp,%ebp
+     423:	57                   	push   %edi
+     424:	56                   	push   %esi
+     425:	53                   	push   %ebx
+     426:	83 ec 0c             	sub    $0xc,%esp
+     429:	8b 75 08             	mov    0x8(%ebp),%esi
+     42c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     42f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     431:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+     435:	75 21                	jne    458 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     437:	83 ec 04             	sub    $0x4,%esp
+     43a:	57                   	push   %edi
+     43b:	6a 00                	push   $0x0
+     43d:	56                   	push   %esi
+     43e:	e8 bd 01 00 00       	call   600 <futex>
+  mutex_lock(m);
+     443:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     446:	83 c4 10             	add    $0x10,%esp
+}
+     449:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     44c:	5b                   	pop    %ebx
+     44d:	5e                   	pop    %esi
+     44e:	5f                   	pop    %edi
+     44f:	5d                   	pop    %ebp
+  mutex_lock(m);
+     450:	e9 3b ff ff ff       	jmp    390 <mutex_lock>
+     455:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     458:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     45b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex(&m->val, FUTEX_WAKE, 1);
+     461:	6a 01                	push   $0x1
+     463:	6a 01                	push   $0x1
+     465:	53                   	push   %ebx
+     466:	e8 95 01 00 00       	call   600 <futex>
+     46b:	83 c4 10             	add    $0x10,%esp
+     46e:	eb c7                	jmp    437 <cond_wait+0x17>
+
+00000470 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+     470:	55                   	push   %ebp
+     471:	89 e5                	mov    %esp,%ebp
+     473:	83 ec 0c             	sub    $0xc,%esp
+     476:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     479:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+     47d:	6a 01                	push   $0x1
+     47f:	6a 01                	push   $0x1
+     481:	50                   	push   %eax
+     482:	e8 79 01 00 00       	call   600 <futex>
+}
+     487:	83 c4 10             	add    $0x10,%esp
+     48a:	c9                   	leave
+     48b:	c3                   	ret
+     48c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     490:	55                   	push   %ebp
+     491:	89 e5                	mov    %esp,%ebp
+     493:	83 ec 0c             	sub    $0xc,%esp
+     496:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     499:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+     49d:	6a 40                	push   $0x40
+     49f:	6a 01                	push   $0x1
+     4a1:	50                   	push   %eax
+     4a2:	e8 59 01 00 00       	call   600 <futex>
+}
+     4a7:	83 c4 10             	add    $0x10,%esp
+     4aa:	c9                   	leave
+     4ab:	c3                   	ret
+     4ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004b0 <uptime>:
+// Clock ticks since boot, read from the kernel's vdso page
+// without a system call.
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     4b0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+     4b5:	c3                   	ret
+
+000004b6 <sysfork>:
+  1: ret
+
+#define SYSCALL(name) SYSCALLAS(name, name)
+
+// ulib.c wraps these.
+SYSCALLAS(sysfork, fork)
+     4b6:	b8 01 00 00 00       	mov    $0x1,%eax
+     4bb:	89 e1                	mov    %esp,%ecx
+     4bd:	ba c4 04 00 00       	mov    $0x4c4,%edx
+     4c2:	0f 34                	sysenter
+     4c4:	c3                   	ret
+
+000004c5 <sysexit>:
+SYSCALLAS(sysexit, exit)
+     4c5:	b8 02 00 00 00       	mov    $0x2,%eax
+     4ca:	89 e1                	mov    %esp,%ecx
+     4cc:	ba d3 04 00 00       	mov    $0x4d3,%edx
+     4d1:	0f 34                	sysenter
+     4d3:	c3                   	ret
+
+000004d4 <wait>:
+SYSCALL(wait)
+     4d4:	b8 03 00 00 00       	mov    $0x3,%eax
+     4d9:	89 e1                	mov    %esp,%ecx
+     4db:	ba e2 04 00 00       	mov    $0x4e2,%edx
+     4e0:	0f 34                	sysenter
+     4e2:	c3                   	ret
+
+000004e3 <pipe>:
+SYSCALL(pipe)
+     4e3:	b8 04 00 00 00       	mov    $0x4,%eax
+     4e8:	89 e1                	mov    %esp,%ecx
+     4ea:	ba f1 04 00 00       	mov    $0x4f1,%edx
+     4ef:	0f 34                	sysenter
+     4f1:	c3                   	ret
+
+000004f2 <read>:
+SYSCALL(read)
+     4f2:	b8 05 00 00 00       	mov    $0x5,%eax
+     4f7:	89 e1                	mov    %esp,%ecx
+     4f9:	ba 00 05 00 00       	mov    $0x500,%edx
+     4fe:	0f 34                	sysenter
+     500:	c3                   	ret
+
+00000501 <write>:
+SYSCALL(write)
+     501:	b8 10 00 00 00       	mov    $0x10,%eax
+     506:	89 e1                	mov    %esp,%ecx
+     508:	ba 0f 05 00 00       	mov    $0x50f,%edx
+     50d:	0f 34                	sysenter
+     50f:	c3                   	ret
+
+00000510 <close>:
+SYSCALL(close)
+     510:	b8 15 00 00 00       	mov    $0x15,%eax
+     515:	89 e1                	mov    %esp,%ecx
+     517:	ba 1e 05 00 00       	mov    $0x51e,%edx
+     51c:	0f 34                	sysenter
+     51e:	c3                   	ret
+
+0000051f <kill>:
+SYSCALL(kill)
+     51f:	b8 06 00 00 00       	mov    $0x6,%eax
+     524:	89 e1                	mov    %esp,%ecx
+     526:	ba 2d 05 00 00       	mov    $0x52d,%edx
+     52b:	0f 34                	sysenter
+     52d:	c3                   	ret
+
+0000052e <sysexec>:
+SYSCALLAS(sysexec, exec)
+     52e:	b8 07 00 00 00       	mov    $0x7,%eax
+     533:	89 e1                	mov    %esp,%ecx
+     535:	ba 3c 05 00 00       	mov    $0x53c,%edx
+     53a:	0f 34                	sysenter
+     53c:	c3                   	ret
+
+0000053d <open>:
+SYSCALL(open)
+     53d:	b8 0f 00 00 00       	mov    $0xf,%eax
+     542:	89 e1                	mov    %esp,%ecx
+     544:	ba 4b 05 00 00       	mov    $0x54b,%edx
+     549:	0f 34                	sysenter
+     54b:	c3                   	ret
+
+0000054c <mknod>:
+SYSCALL(mknod)
+     54c:	b8 11 00 00 00       	mov    $0x11,%eax
+     551:	89 e1                	mov    %esp,%ecx
+     553:	ba 5a 05 00 00       	mov    $0x55a,%edx
+     558:	0f 34                	sysenter
+     55a:	c3                   	ret
+
+0000055b <unlink>:
+SYSCALL(unlink)
+     55b:	b8 12 00 00 00       	mov    $0x12,%eax
+     560:	89 e1                	mov    %esp,%ecx
+     562:	ba 69 05 00 00       	mov    $0x569,%edx
+     567:	0f 34                	sysenter
+     569:	c3                   	ret
+
+0000056a <fstat>:
+SYSCALL(fstat)
+     56a:	b8 08 00 00 00       	mov    $0x8,%eax
+     56f:	89 e1                	mov    %esp,%ecx
+     571:	ba 78 05 00 00       	mov    $0x578,%edx
+     576:	0f 34                	sysenter
+     578:	c3                   	ret
+
+00000579 <link>:
+SYSCALL(link)
+     579:	b8 13 00 00 00       	mov    $0x13,%eax
+     57e:	89 e1                	mov    %esp,%ecx
+     580:	ba 87 05 00 00       	mov    $0x587,%edx
+     585:	0f 34                	sysenter
+     587:	c3                   	ret
+
+00000588 <mkdir>:
+SYSCALL(mkdir)
+     588:	b8 14 00 00 00       	mov    $0x14,%eax
+     58d:	89 e1                	mov    %esp,%ecx
+     58f:	ba 96 05 00 00       	mov    $0x596,%edx
+     594:	0f 34                	sysenter
+     596:	c3                   	ret
+
+00000597 <chdir>:
+SYSCALL(chdir)
+     597:	b8 09 00 00 00       	mov    $0x9,%eax
+     59c:	89 e1                	mov    %esp,%ecx
+     59e:	ba a5 05 00 00       	mov    $0x5a5,%edx
+     5a3:	0f 34                	sysenter
+     5a5:	c3                   	ret
+
+000005a6 <dup>:
+SYSCALL(dup)
+     5a6:	b8 0a 00 00 00       	mov    $0xa,%eax
+     5ab:	89 e1                	mov    %esp,%ecx
+     5ad:	ba b4 05 00 00       	mov    $0x5b4,%edx
+     5b2:	0f 34                	sysenter
+     5b4:	c3                   	ret
+
+000005b5 <getpid>:
+SYSCALL(getpid)
+     5b5:	b8 0b 00 00 00       	mov    $0xb,%eax
+     5ba:	89 e1                	mov    %esp,%ecx
+     5bc:	ba c3 05 00 00       	mov    $0x5c3,%edx
+     5c1:	0f 34                	sysenter
+     5c3:	c3                   	ret
+
+000005c4 <sbrk>:
+SYSCALL(sbrk)
+     5c4:	b8 0c 00 00 00       	mov    $0xc,%eax
+     5c9:	89 e1                	mov    %esp,%ecx
+     5cb:	ba d2 05 00 00       	mov    $0x5d2,%edx
+     5d0:	0f 34                	sysenter
+     5d2:	c3                   	ret
+
+000005d3 <sleep>:
+SYSCALL(sleep)
+     5d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     5d8:	89 e1                	mov    %esp,%ecx
+     5da:	ba e1 05 00 00       	mov    $0x5e1,%edx
+     5df:	0f 34                	sysenter
+     5e1:	c3                   	ret
+
+000005e2 <clone>:
+SYSCALL(clone)
+     5e2:	b8 16 00 00 00       	mov    $0x16,%eax
+     5e7:	89 e1                	mov    %esp,%ecx
+     5e9:	ba f0 05 00 00       	mov    $0x5f0,%edx
+     5ee:	0f 34                	sysenter
+     5f0:	c3                   	ret
+
+000005f1 <join>:
+SYSCALL(join)
+     5f1:	b8 17 00 00 00       	mov    $0x17,%eax
+     5f6:	89 e1                	mov    %esp,%ecx
+     5f8:	ba ff 05 00 00       	mov    $0x5ff,%edx
+     5fd:	0f 34                	sysenter
+     5ff:	c3                   	ret
+
+00000600 <futex>:
+SYSCALL(futex)
+     600:	b8 18 00 00 00       	mov    $0x18,%eax
+     605:	89 e1                	mov    %esp,%ecx
+     607:	ba 0e 06 00 00       	mov    $0x60e,%edx
+     60c:	0f 34                	sysenter
+     60e:	c3                   	ret
+
+0000060f <yield>:
+SYSCALL(yield)
+     60f:	b8 19 00 00 00       	mov    $0x19,%eax
+     614:	89 e1                	mov    %esp,%ecx
+     616:	ba 1d 06 00 00       	mov    $0x61d,%edx
+     61b:	0f 34                	sysenter
+     61d:	c3                   	ret
+
+0000061e <lockstat>:
+SYSCALL(lockstat)
+     61e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     623:	89 e1                	mov    %esp,%ecx
+     625:	ba 2c 06 00 00       	mov    $0x62c,%edx
+     62a:	0f 34                	sysenter
+     62c:	c3                   	ret
+
+0000062d <lockhammer>:
+SYSCALL(lockhammer)
+     62d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     632:	89 e1                	mov    %esp,%ecx
+     634:	ba 3b 06 00 00       	mov    $0x63b,%edx
+     639:	0f 34                	sysenter
+     63b:	c3                   	ret
+
+0000063c <vmsplice>:
+SYSCALL(vmsplice)
+     63c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     641:	89 e1                	mov    %esp,%ecx
+     643:	ba 4a 06 00 00       	mov    $0x64a,%edx
+     648:	0f 34                	sysenter
+     64a:	c3                   	ret
+
+0000064b <hsbrk>:
+SYSCALL(hsbrk)
+     64b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     650:	89 e1                	mov    %esp,%ecx
+     652:	ba 59 06 00 00       	mov    $0x659,%edx
+     657:	0f 34                	sysenter
+     659:	c3                   	ret
+
+0000065a <mmap>:
+SYSCALL(mmap)
+     65a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     65f:	89 e1                	mov    %esp,%ecx
+     661:	ba 68 06 00 00       	mov    $0x668,%edx
+     666:	0f 34                	sysenter
+     668:	c3                   	ret
+
+00000669 <munmap>:
+SYSCALL(munmap)
+     669:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     66e:	89 e1                	mov    %esp,%ecx
+     670:	ba 77 06 00 00       	mov    $0x677,%edx
+     675:	0f 34                	sysenter
+     677:	c3                   	ret
+
+00000678 <ringenter>:
+SYSCALL(ringenter)
+     678:	b8 20 00 00 00       	mov    $0x20,%eax
+     67d:	89 e1                	mov    %esp,%ecx
+     67f:	ba 86 06 00 00       	mov    $0x686,%edx
+     684:	0f 34                	sysenter
+     686:	c3                   	ret
+
+00000687 <readv>:
+SYSCALL(readv)
+     687:	b8 21 00 00 00       	mov    $0x21,%eax
+     68c:	89 e1                	mov    %esp,%ecx
+     68e:	ba 95 06 00 00       	mov    $0x695,%edx
+     693:	0f 34                	sysenter
+     695:	c3                   	ret
+
+00000696 <writev>:
+SYSCALL(writev)
+     696:	b8 22 00 00 00       	mov    $0x22,%eax
+     69b:	89 e1                	mov    %esp,%ecx
+     69d:	ba a4 06 00 00       	mov    $0x6a4,%edx
+     6a2:	0f 34                	sysenter
+     6a4:	c3                   	ret
+
+000006a5 <pread>:
+SYSCALL(pread)
+     6a5:	b8 23 00 00 00       	mov    $0x23,%eax
+     6aa:	89 e1                	mov    %esp,%ecx
+     6ac:	ba b3 06 00 00       	mov    $0x6b3,%edx
+     6b1:	0f 34                	sysenter
+     6b3:	c3                   	ret
+
+000006b4 <pwrite>:
+SYSCALL(pwrite)
+     6b4:	b8 24 00 00 00       	mov    $0x24,%eax
+     6b9:	89 e1                	mov    %esp,%ecx
+     6bb:	ba c2 06 00 00       	mov    $0x6c2,%edx
+     6c0:	0f 34                	sysenter
+     6c2:	c3                   	ret
+
+000006c3 <prof>:
+SYSCALL(prof)
+     6c3:	b8 25 00 00 00       	mov    $0x25,%eax
+     6c8:	89 e1                	mov    %esp,%ecx
+     6ca:	ba d1 06 00 00       	mov    $0x6d1,%edx
+     6cf:	0f 34                	sysenter
+     6d1:	c3                   	ret
+
+000006d2 <scstat>:
+SYSCALL(scstat)
+     6d2:	b8 26 00 00 00       	mov    $0x26,%eax
+     6d7:	89 e1                	mov    %esp,%ecx
+     6d9:	ba e0 06 00 00       	mov    $0x6e0,%edx
+     6de:	0f 34                	sysenter
+     6e0:	c3                   	ret
+     6e1:	66 90                	xchg   %ax,%ax
+     6e3:	66 90                	xchg   %ax,%ax
+     6e5:	66 90                	xchg   %ax,%ax
+     6e7:	66 90                	xchg   %ax,%ax
+     6e9:	66 90                	xchg   %ax,%ax
+     6eb:	66 90                	xchg   %ax,%ax
+     6ed:	66 90                	xchg   %ax,%ax
+     6ef:	90                   	nop
+
+000006f0 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+     6f0:	55                   	push   %ebp
+     6f1:	89 e5                	mov    %esp,%ebp
+     6f3:	57                   	push   %edi
+     6f4:	56                   	push   %esi
+     6f5:	53                   	push   %ebx
+     6f6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     6f8:	89 d1                	mov    %edx,%ecx
+{
+     6fa:	83 ec 2c             	sub    $0x2c,%esp
+     6fd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+     700:	85 d2                	test   %edx,%edx
+     702:	79 7c                	jns    780 <printint+0x90>
+     704:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     708:	74 76                	je     780 <printint+0x90>
+    x = -xx;
+     70a:	f7 d9                	neg    %ecx
+    neg = 1;
+     70c:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     711:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     714:	31 f6                	xor    %esi,%esi
+     716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     71d:	8d 76 00             	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     720:	89 c8                	mov    %ecx,%eax
+     722:	31 d2                	xor    %edx,%edx
+     724:	89 f7                	mov    %esi,%edi
+     726:	f7 f3                	div    %ebx
+     728:	8d 76 01             	lea    0x1(%esi),%esi
+     72b:	0f b6 92 4c 1e 00 00 	movzbl 0x1e4c(%edx),%edx
+     732:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     736:	89 ca                	mov    %ecx,%edx
+     738:	89 c1                	mov    %eax,%ecx
+     73a:	39 da                	cmp    %ebx,%edx
+     73c:	73 e2                	jae    720 <printint+0x30>
+  if(neg)
+     73e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     741:	85 c0                	test   %eax,%eax
+     743:	74 07                	je     74c <printint+0x5c>
+    buf[i++] = '-';
+     745:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     74a:	89 f7                	mov    %esi,%edi
+     74c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     74f:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     752:	01 df                	add    %ebx,%edi
+     754:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc_unlocked(buf[i], f);
+     758:	83 ec 08             	sub    $0x8,%esp
+     75b:	56                   	push   %esi
+     75c:	0f be 07             	movsbl (%edi),%eax
+     75f:	50                   	push   %eax
+     760:	e8 cb 07 00 00       	call   f30 <putc_unlocked>
+  while(--i >= 0)
+     765:	89 f8                	mov    %edi,%eax
+     767:	83 c4 10             	add    $0x10,%esp
+     76a:	83 ef 01             	sub    $0x1,%edi
+     76d:	39 d8                	cmp    %ebx,%eax
+     76f:	75 e7                	jne    758 <printint+0x68>
+}
+     771:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     774:	5b                   	pop    %ebx
+     775:	5e                   	pop    %esi
+     776:	5f                   	pop    %edi
+     777:	5d                   	pop    %ebp
+     778:	c3                   	ret
+     779:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     780:	31 c0                	xor    %eax,%eax
+     782:	eb 8d                	jmp    711 <printint+0x21>
+     784:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     78b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     78f:	90                   	nop
+
+00000790 <vfprintf>:
+
+// Print to the given stream, which the caller has locked.
+// Only understands %d, %x, %p, %s.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+     790:	55                   	push   %ebp
+     791:	89 e5                	mov    %esp,%ebp
+     793:	57                   	push   %edi
+     794:	56                   	push   %esi
+     795:	53                   	push   %ebx
+     796:	83 ec 1c             	sub    $0x1c,%esp
+     799:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     79c:	0f b6 0a             	movzbl (%edx),%ecx
+     79f:	84 c9                	test   %cl,%cl
+     7a1:	74 5c                	je     7ff <vfprintf+0x6f>
+     7a3:	89 c6                	mov    %eax,%esi
+     7a5:	8d 5a 01             	lea    0x1(%edx),%ebx
+     7a8:	31 ff                	xor    %edi,%edi
+     7aa:	eb 20                	jmp    7cc <vfprintf+0x3c>
+     7ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     7b0:	83 f9 25             	cmp    $0x25,%ecx
+     7b3:	74 3b                	je     7f0 <vfprintf+0x60>
+        state = '%';
+      } else {
+        putc_unlocked(c, f);
+     7b5:	83 ec 08             	sub    $0x8,%esp
+     7b8:	56                   	push   %esi
+     7b9:	51                   	push   %ecx
+     7ba:	e8 71 07 00 00       	call   f30 <putc_unlocked>
+     7bf:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     7c2:	0f b6 0b             	movzbl (%ebx),%ecx
+     7c5:	83 c3 01             	add    $0x1,%ebx
+     7c8:	84 c9                	test   %cl,%cl
+     7ca:	74 33                	je     7ff <vfprintf+0x6f>
+    if(state == 0){
+     7cc:	85 ff                	test   %edi,%edi
+     7ce:	74 e0                	je     7b0 <vfprintf+0x20>
+      }
+    } else if(state == '%'){
+     7d0:	83 ff 25             	cmp    $0x25,%edi
+     7d3:	75 ed                	jne    7c2 <vfprintf+0x32>
+      if(c == 'd'){
+     7d5:	83 f9 25             	cmp    $0x25,%ecx
+     7d8:	0f 84 02 01 00 00    	je     8e0 <vfprintf+0x150>
+     7de:	8d 41 9d             	lea    -0x63(%ecx),%eax
+     7e1:	83 f8 15             	cmp    $0x15,%eax
+     7e4:	77 2a                	ja     810 <vfprintf+0x80>
+     7e6:	ff 24 85 f4 1d 00 00 	jmp    *0x1df4(,%eax,4)
+     7ed:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     7f0:	0f b6 0b             	movzbl (%ebx),%ecx
+     7f3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     7f6:	bf 25 00 00 00       	mov    $0x25,%edi
+  for(i = 0; fmt[i]; i++){
+     7fb:	84 c9                	test   %cl,%cl
+     7fd:	75 cd                	jne    7cc <vfprintf+0x3c>
+        putc_unlocked(c, f);
+      }
+      state = 0;
+    }
+  }
+}
+     7ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     802:	5b                   	pop    %ebx
+     803:	5e                   	pop    %esi
+     804:	5f                   	pop    %edi
+     805:	5d                   	pop    %ebp
+     806:	c3                   	ret
+     807:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     80e:	66 90                	xchg   %ax,%ax
+        putc_unlocked('%', f);
+     810:	83 ec 08             	sub    $0x8,%esp
+     813:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     816:	56                   	push   %esi
+     817:	6a 25                	push   $0x25
+     819:	e8 12 07 00 00       	call   f30 <putc_unlocked>
+        putc_unlocked(c, f);
+     81e:	58                   	pop    %eax
+     81f:	5a                   	pop    %edx
+     820:	56                   	push   %esi
+     821:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     824:	51                   	push   %ecx
+     825:	e8 06 07 00 00       	call   f30 <putc_unlocked>
+     82a:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     82d:	31 ff                	xor    %edi,%edi
+     82f:	eb 91                	jmp    7c2 <vfprintf+0x32>
+     831:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+     838:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     83b:	83 ec 0c             	sub    $0xc,%esp
+     83e:	b9 10 00 00 00       	mov    $0x10,%ecx
+     843:	8b 17                	mov    (%edi),%edx
+     845:	6a 00                	push   $0x0
+        ap++;
+     847:	83 c7 04             	add    $0x4,%edi
+        printint(f, *ap, 16, 0);
+     84a:	89 f0                	mov    %esi,%eax
+     84c:	e8 9f fe ff ff       	call   6f0 <printint>
+        ap++;
+     851:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     854:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     857:	31 ff                	xor    %edi,%edi
+     859:	e9 64 ff ff ff       	jmp    7c2 <vfprintf+0x32>
+     85e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     860:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     863:	8b 10                	mov    (%eax),%edx
+        ap++;
+     865:	83 c0 04             	add    $0x4,%eax
+     868:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     86b:	85 d2                	test   %edx,%edx
+     86d:	0f 84 85 00 00 00    	je     8f8 <vfprintf+0x168>
+        while(*s != 0){
+     873:	0f be 02             	movsbl (%edx),%eax
+        s = (char*)*ap;
+     876:	89 d7                	mov    %edx,%edi
+        while(*s != 0){
+     878:	84 c0                	test   %al,%al
+     87a:	74 b1                	je     82d <vfprintf+0x9d>
+     87c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+          putc_unlocked(*s, f);
+     880:	83 ec 08             	sub    $0x8,%esp
+          s++;
+     883:	83 c7 01             	add    $0x1,%edi
+          putc_unlocked(*s, f);
+     886:	56                   	push   %esi
+     887:	50                   	push   %eax
+     888:	e8 a3 06 00 00       	call   f30 <putc_unlocked>
+        while(*s != 0){
+     88d:	0f be 07             	movsbl (%edi),%eax
+     890:	83 c4 10             	add    $0x10,%esp
+     893:	84 c0                	test   %al,%al
+     895:	75 e9                	jne    880 <vfprintf+0xf0>
+      state = 0;
+     897:	31 ff                	xor    %edi,%edi
+     899:	e9 24 ff ff ff       	jmp    7c2 <vfprintf+0x32>
+     89e:	66 90                	xchg   %ax,%ax
+        printint(f, *ap, 10, 1);
+     8a0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     8a3:	83 ec 0c             	sub    $0xc,%esp
+     8a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     8ab:	8b 17                	mov    (%edi),%edx
+     8ad:	6a 01                	push   $0x1
+     8af:	eb 96                	jmp    847 <vfprintf+0xb7>
+     8b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc_unlocked(*ap, f);
+     8b8:	83 ec 08             	sub    $0x8,%esp
+     8bb:	56                   	push   %esi
+     8bc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     8bf:	ff 37                	push   (%edi)
+     8c1:	e8 6a 06 00 00       	call   f30 <putc_unlocked>
+        ap++;
+     8c6:	89 f8                	mov    %edi,%eax
+     8c8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     8cb:	31 ff                	xor    %edi,%edi
+        ap++;
+     8cd:	83 c0 04             	add    $0x4,%eax
+     8d0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     8d3:	e9 ea fe ff ff       	jmp    7c2 <vfprintf+0x32>
+     8d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8df:	90                   	nop
+        putc_unlocked(c, f);
+     8e0:	83 ec 08             	sub    $0x8,%esp
+      state = 0;
+     8e3:	31 ff                	xor    %edi,%edi
+        putc_unlocked(c, f);
+     8e5:	56                   	push   %esi
+     8e6:	6a 25                	push   $0x25
+     8e8:	e8 43 06 00 00       	call   f30 <putc_unlocked>
+     8ed:	83 c4 10             	add    $0x10,%esp
+     8f0:	e9 cd fe ff ff       	jmp    7c2 <vfprintf+0x32>
+     8f5:	8d 76 00             	lea    0x0(%esi),%esi
+     8f8:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     8fd:	bf eb 1d 00 00       	mov    $0x1deb,%edi
+     902:	e9 79 ff ff ff       	jmp    880 <vfprintf+0xf0>
+     907:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     90e:	66 90                	xchg   %ax,%ax
+
+00000910 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+     910:	55                   	push   %ebp
+     911:	89 e5                	mov    %esp,%ebp
+     913:	53                   	push   %ebx
+     914:	83 ec 10             	sub    $0x10,%esp
+     917:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  flockfile(f);
+     91a:	53                   	push   %ebx
+     91b:	e8 d0 02 00 00       	call   bf0 <flockfile>
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     920:	8b 55 0c             	mov    0xc(%ebp),%edx
+     923:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     926:	89 d8                	mov    %ebx,%eax
+     928:	e8 63 fe ff ff       	call   790 <vfprintf>
+  funlockfile(f);
+     92d:	89 1c 24             	mov    %ebx,(%esp)
+     930:	e8 eb 02 00 00       	call   c20 <funlockfile>
+}
+     935:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     938:	83 c4 10             	add    $0x10,%esp
+     93b:	c9                   	leave
+     93c:	c3                   	ret
+     93d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000940 <printf>:
+
+// Print to the given fd: through stdout or stderr for 1 and 2,
+// otherwise with one write() per call.
+void
+printf(int fd, const char *fmt, ...)
+{
+     940:	55                   	push   %ebp
+     941:	89 e5                	mov    %esp,%ebp
+     943:	56                   	push   %esi
+     944:	53                   	push   %ebx
+     945:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+     94b:	8b 45 08             	mov    0x8(%ebp),%eax
+  char buf[128];
+  struct iobuf f;
+
+  if(fd == 1 || fd == 2){
+    flockfile(&_iob[fd]);
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     94e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(fd == 1 || fd == 2){
+     951:	8d 50 ff             	lea    -0x1(%eax),%edx
+     954:	83 fa 01             	cmp    $0x1,%edx
+     957:	76 77                	jbe    9d0 <printf+0x90>
+    funlockfile(&_iob[fd]);
+    return;
+  }
+  f.fd = fd;
+     959:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  f.flags = IO_WRITE|IO_SETUP;
+  f.buf = buf;
+     95f:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  f.size = sizeof(buf);
+  f.r = f.n = 0;
+  mutex_init(&f.lock);
+     965:	83 ec 0c             	sub    $0xc,%esp
+     968:	8d 9d 5c ff ff ff    	lea    -0xa4(%ebp),%ebx
+  f.buf = buf;
+     96e:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+  mutex_init(&f.lock);
+     974:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  f.flags = IO_WRITE|IO_SETUP;
+     97a:	c7 85 60 ff ff ff 42 	movl   $0x42,-0xa0(%ebp)
+     981:	00 00 00 
+  f.size = sizeof(buf);
+     984:	c7 85 68 ff ff ff 80 	movl   $0x80,-0x98(%ebp)
+     98b:	00 00 00 
+  f.r = f.n = 0;
+     98e:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+     995:	00 00 00 
+     998:	c7 85 6c ff ff ff 00 	movl   $0x0,-0x94(%ebp)
+     99f:	00 00 00 
+  mutex_init(&f.lock);
+     9a2:	50                   	push   %eax
+     9a3:	e8 d8 f9 ff ff       	call   380 <mutex_init>
+  vfprintf(&f, fmt, (uint*)(void*)&fmt + 1);
+     9a8:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     9ab:	89 f2                	mov    %esi,%edx
+     9ad:	89 d8                	mov    %ebx,%eax
+     9af:	e8 dc fd ff ff       	call   790 <vfprintf>
+  fflush(&f);
+     9b4:	89 1c 24             	mov    %ebx,(%esp)
+     9b7:	e8 f4 04 00 00       	call   eb0 <fflush>
+     9bc:	83 c4 10             	add    $0x10,%esp
+}
+     9bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     9c2:	5b                   	pop    %ebx
+     9c3:	5e                   	pop    %esi
+     9c4:	5d                   	pop    %ebp
+     9c5:	c3                   	ret
+     9c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9cd:	8d 76 00             	lea    0x0(%esi),%esi
+    flockfile(&_iob[fd]);
+     9d0:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     9d3:	83 ec 0c             	sub    $0xc,%esp
+     9d6:	8d 98 c0 27 00 00    	lea    0x27c0(%eax),%ebx
+     9dc:	53                   	push   %ebx
+     9dd:	e8 0e 02 00 00       	call   bf0 <flockfile>
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     9e2:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     9e5:	89 f2                	mov    %esi,%edx
+     9e7:	89 d8                	mov    %ebx,%eax
+     9e9:	e8 a2 fd ff ff       	call   790 <vfprintf>
+    funlockfile(&_iob[fd]);
+     9ee:	89 1c 24             	mov    %ebx,(%esp)
+     9f1:	e8 2a 02 00 00       	call   c20 <funlockfile>
+     9f6:	83 c4 10             	add    $0x10,%esp
+}
+     9f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     9fc:	5b                   	pop    %ebx
+     9fd:	5e                   	pop    %esi
+     9fe:	5d                   	pop    %ebp
+     9ff:	c3                   	ret
+
+00000a00 <setup>:
+}
+
+// Choose how to buffer f on first use: by lines on a device.
+static void
+setup(FILE *f)
+{
+     a00:	55                   	push   %ebp
+     a01:	89 e5                	mov    %esp,%ebp
+     a03:	53                   	push   %ebx
+     a04:	89 c3                	mov    %eax,%ebx
+     a06:	83 ec 2c             	sub    $0x2c,%esp
+  struct stat st;
+
+  f->flags |= IO_SETUP;
+     a09:	83 48 04 40          	orl    $0x40,0x4(%eax)
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     a0d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     a10:	50                   	push   %eax
+     a11:	ff 33                	push   (%ebx)
+     a13:	e8 52 fb ff ff       	call   56a <fstat>
+     a18:	83 c4 10             	add    $0x10,%esp
+     a1b:	85 c0                	test   %eax,%eax
+    f->flags |= IO_DEV|IO_LINE;
+     a1d:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     a20:	75 07                	jne    a29 <setup+0x29>
+     a22:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+     a27:	74 17                	je     a40 <setup+0x40>
+  if(f->flags & IO_WRITE)
+     a29:	a8 02                	test   $0x2,%al
+     a2b:	74 0a                	je     a37 <setup+0x37>
+    flushhook = flushall;
+     a2d:	c7 05 a0 28 00 00 60 	movl   $0xb60,0x28a0
+     a34:	0b 00 00 
+}
+     a37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a3a:	c9                   	leave
+     a3b:	c3                   	ret
+     a3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    f->flags |= IO_DEV|IO_LINE;
+     a40:	83 c8 30             	or     $0x30,%eax
+     a43:	89 43 04             	mov    %eax,0x4(%ebx)
+     a46:	eb e1                	jmp    a29 <setup+0x29>
+     a48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a4f:	90                   	nop
+
+00000a50 <flush>:
+static int
+flush(FILE *f)
+{
+  int i, n;
+
+  if(!(f->flags & IO_WRITE))
+     a50:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+     a54:	74 6a                	je     ac0 <flush+0x70>
+{
+     a56:	55                   	push   %ebp
+     a57:	89 e5                	mov    %esp,%ebp
+     a59:	56                   	push   %esi
+     a5a:	89 c6                	mov    %eax,%esi
+     a5c:	53                   	push   %ebx
+    return 0;
+  for(i = 0; i < f->n; i += n){
+     a5d:	8b 40 14             	mov    0x14(%eax),%eax
+     a60:	85 c0                	test   %eax,%eax
+     a62:	7e 4c                	jle    ab0 <flush+0x60>
+     a64:	31 db                	xor    %ebx,%ebx
+     a66:	eb 11                	jmp    a79 <flush+0x29>
+     a68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a6f:	90                   	nop
+     a70:	01 c3                	add    %eax,%ebx
+     a72:	8b 46 14             	mov    0x14(%esi),%eax
+     a75:	39 d8                	cmp    %ebx,%eax
+     a77:	7e 37                	jle    ab0 <flush+0x60>
+    if((n = write(f->fd, f->buf + i, f->n - i)) <= 0){
+     a79:	83 ec 04             	sub    $0x4,%esp
+     a7c:	29 d8                	sub    %ebx,%eax
+     a7e:	50                   	push   %eax
+     a7f:	8b 46 08             	mov    0x8(%esi),%eax
+     a82:	01 d8                	add    %ebx,%eax
+     a84:	50                   	push   %eax
+     a85:	ff 36                	push   (%esi)
+     a87:	e8 75 fa ff ff       	call   501 <write>
+     a8c:	83 c4 10             	add    $0x10,%esp
+     a8f:	85 c0                	test   %eax,%eax
+     a91:	7f dd                	jg     a70 <flush+0x20>
+      f->flags |= IO_ERR;
+     a93:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+      f->n = 0;
+     a97:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     a9c:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+      return EOF;
+    }
+  }
+  f->n = 0;
+  return 0;
+}
+     aa3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     aa6:	5b                   	pop    %ebx
+     aa7:	5e                   	pop    %esi
+     aa8:	5d                   	pop    %ebp
+     aa9:	c3                   	ret
+     aaa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->n = 0;
+     ab0:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+}
+     ab7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+     aba:	31 c0                	xor    %eax,%eax
+}
+     abc:	5b                   	pop    %ebx
+     abd:	5e                   	pop    %esi
+     abe:	5d                   	pop    %ebp
+     abf:	c3                   	ret
+    return 0;
+     ac0:	31 c0                	xor    %eax,%eax
+}
+     ac2:	c3                   	ret
+     ac3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ad0 <fflush.part.0>:
+fflush(FILE *f)
+     ad0:	55                   	push   %ebp
+     ad1:	89 e5                	mov    %esp,%ebp
+     ad3:	57                   	push   %edi
+     ad4:	bf b8 28 00 00       	mov    $0x28b8,%edi
+     ad9:	56                   	push   %esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     ada:	31 f6                	xor    %esi,%esi
+fflush(FILE *f)
+     adc:	53                   	push   %ebx
+     add:	bb d8 27 00 00       	mov    $0x27d8,%ebx
+     ae2:	83 ec 1c             	sub    $0x1c,%esp
+     ae5:	eb 10                	jmp    af7 <fflush.part.0+0x27>
+     ae7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aee:	66 90                	xchg   %ax,%ax
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     af0:	83 c3 1c             	add    $0x1c,%ebx
+     af3:	39 df                	cmp    %ebx,%edi
+     af5:	74 33                	je     b2a <fflush.part.0+0x5a>
+      if((f->flags & IO_WRITE) && fflush(f) < 0)
+     af7:	f6 43 ec 02          	testb  $0x2,-0x14(%ebx)
+     afb:	74 f3                	je     af0 <fflush.part.0+0x20>
+  if(threaded)
+     afd:	8b 0d c0 28 00 00    	mov    0x28c0,%ecx
+     b03:	85 c9                	test   %ecx,%ecx
+     b05:	75 49                	jne    b50 <fflush.part.0+0x80>
+  r = flush(f);
+     b07:	8d 43 e8             	lea    -0x18(%ebx),%eax
+     b0a:	e8 41 ff ff ff       	call   a50 <flush>
+  if(threaded)
+     b0f:	8b 15 c0 28 00 00    	mov    0x28c0,%edx
+     b15:	85 d2                	test   %edx,%edx
+     b17:	75 1f                	jne    b38 <fflush.part.0+0x68>
+        r = EOF;
+     b19:	85 c0                	test   %eax,%eax
+     b1b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     b20:	0f 48 f0             	cmovs  %eax,%esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     b23:	83 c3 1c             	add    $0x1c,%ebx
+     b26:	39 df                	cmp    %ebx,%edi
+     b28:	75 cd                	jne    af7 <fflush.part.0+0x27>
+}
+     b2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b2d:	89 f0                	mov    %esi,%eax
+     b2f:	5b                   	pop    %ebx
+     b30:	5e                   	pop    %esi
+     b31:	5f                   	pop    %edi
+     b32:	5d                   	pop    %ebp
+     b33:	c3                   	ret
+     b34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     b38:	83 ec 0c             	sub    $0xc,%esp
+     b3b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     b3e:	53                   	push   %ebx
+     b3f:	e8 9c f8 ff ff       	call   3e0 <mutex_unlock>
+     b44:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     b47:	83 c4 10             	add    $0x10,%esp
+     b4a:	eb cd                	jmp    b19 <fflush.part.0+0x49>
+     b4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     b50:	83 ec 0c             	sub    $0xc,%esp
+     b53:	53                   	push   %ebx
+     b54:	e8 37 f8 ff ff       	call   390 <mutex_lock>
+     b59:	83 c4 10             	add    $0x10,%esp
+     b5c:	eb a9                	jmp    b07 <fflush.part.0+0x37>
+     b5e:	66 90                	xchg   %ax,%ax
+
+00000b60 <flushall>:
+  if(f == 0){
+     b60:	e9 6b ff ff ff       	jmp    ad0 <fflush.part.0>
+     b65:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b70 <fill>:
+
+// Refill f's buffer. Returns the number of bytes read.
+// Caller holds f's lock.
+static int
+fill(FILE *f)
+{
+     b70:	55                   	push   %ebp
+     b71:	89 e5                	mov    %esp,%ebp
+     b73:	53                   	push   %ebx
+     b74:	89 c3                	mov    %eax,%ebx
+     b76:	83 ec 04             	sub    $0x4,%esp
+  int n;
+
+  if(!(f->flags & IO_SETUP))
+     b79:	8b 40 04             	mov    0x4(%eax),%eax
+     b7c:	a8 40                	test   $0x40,%al
+     b7e:	74 50                	je     bd0 <fill+0x60>
+    setup(f);
+  if(f->flags & IO_DEV)
+     b80:	a8 20                	test   $0x20,%al
+     b82:	75 3c                	jne    bc0 <fill+0x50>
+    fflush(0);
+  f->r = 0;
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     b84:	83 ec 04             	sub    $0x4,%esp
+  f->r = 0;
+     b87:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     b8e:	ff 73 0c             	push   0xc(%ebx)
+     b91:	ff 73 08             	push   0x8(%ebx)
+     b94:	ff 33                	push   (%ebx)
+     b96:	e8 57 f9 ff ff       	call   4f2 <read>
+     b9b:	83 c4 10             	add    $0x10,%esp
+     b9e:	85 c0                	test   %eax,%eax
+     ba0:	7f 10                	jg     bb2 <fill+0x42>
+    f->flags |= n < 0 ? IO_ERR : IO_EOF;
+     ba2:	83 f8 01             	cmp    $0x1,%eax
+     ba5:	19 c0                	sbb    %eax,%eax
+     ba7:	83 e0 fc             	and    $0xfffffffc,%eax
+     baa:	83 c0 08             	add    $0x8,%eax
+     bad:	09 43 04             	or     %eax,0x4(%ebx)
+    n = 0;
+     bb0:	31 c0                	xor    %eax,%eax
+  }
+  f->n = n;
+     bb2:	89 43 14             	mov    %eax,0x14(%ebx)
+  return n;
+}
+     bb5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     bb8:	c9                   	leave
+     bb9:	c3                   	ret
+     bba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == 0){
+     bc0:	e8 0b ff ff ff       	call   ad0 <fflush.part.0>
+     bc5:	eb bd                	jmp    b84 <fill+0x14>
+     bc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bce:	66 90                	xchg   %ax,%ax
+    setup(f);
+     bd0:	89 d8                	mov    %ebx,%eax
+     bd2:	e8 29 fe ff ff       	call   a00 <setup>
+  if(f->flags & IO_DEV)
+     bd7:	8b 43 04             	mov    0x4(%ebx),%eax
+     bda:	eb a4                	jmp    b80 <fill+0x10>
+     bdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000be0 <stdio_threaded>:
+  threaded = 1;
+     be0:	c7 05 c0 28 00 00 01 	movl   $0x1,0x28c0
+     be7:	00 00 00 
+}
+     bea:	c3                   	ret
+     beb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bef:	90                   	nop
+
+00000bf0 <flockfile>:
+{
+     bf0:	55                   	push   %ebp
+  if(threaded)
+     bf1:	8b 15 c0 28 00 00    	mov    0x28c0,%edx
+{
+     bf7:	89 e5                	mov    %esp,%ebp
+     bf9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     bfc:	85 d2                	test   %edx,%edx
+     bfe:	75 08                	jne    c08 <flockfile+0x18>
+}
+     c00:	5d                   	pop    %ebp
+     c01:	c3                   	ret
+     c02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_lock(&f->lock);
+     c08:	83 c0 18             	add    $0x18,%eax
+     c0b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     c0e:	5d                   	pop    %ebp
+    mutex_lock(&f->lock);
+     c0f:	e9 7c f7 ff ff       	jmp    390 <mutex_lock>
+     c14:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c1f:	90                   	nop
+
+00000c20 <funlockfile>:
+{
+     c20:	55                   	push   %ebp
+  if(threaded)
+     c21:	8b 15 c0 28 00 00    	mov    0x28c0,%edx
+{
+     c27:	89 e5                	mov    %esp,%ebp
+     c29:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     c2c:	85 d2                	test   %edx,%edx
+     c2e:	75 08                	jne    c38 <funlockfile+0x18>
+}
+     c30:	5d                   	pop    %ebp
+     c31:	c3                   	ret
+     c32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&f->lock);
+     c38:	83 c0 18             	add    $0x18,%eax
+     c3b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     c3e:	5d                   	pop    %ebp
+    mutex_unlock(&f->lock);
+     c3f:	e9 9c f7 ff ff       	jmp    3e0 <mutex_unlock>
+     c44:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c4f:	90                   	nop
+
+00000c50 <fopen>:
+{
+     c50:	55                   	push   %ebp
+     c51:	89 e5                	mov    %esp,%ebp
+     c53:	57                   	push   %edi
+     c54:	56                   	push   %esi
+     c55:	53                   	push   %ebx
+     c56:	83 ec 34             	sub    $0x34,%esp
+     c59:	8b 75 0c             	mov    0xc(%ebp),%esi
+     c5c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(strcmp(mode, "r") != 0 && strcmp(mode, "w") != 0)
+     c5f:	68 5d 1e 00 00       	push   $0x1e5d
+     c64:	56                   	push   %esi
+     c65:	e8 66 f5 ff ff       	call   1d0 <strcmp>
+     c6a:	83 c4 10             	add    $0x10,%esp
+     c6d:	85 c0                	test   %eax,%eax
+     c6f:	74 15                	je     c86 <fopen+0x36>
+     c71:	83 ec 08             	sub    $0x8,%esp
+     c74:	68 5f 1e 00 00       	push   $0x1e5f
+     c79:	56                   	push   %esi
+     c7a:	e8 51 f5 ff ff       	call   1d0 <strcmp>
+     c7f:	83 c4 10             	add    $0x10,%esp
+     c82:	85 c0                	test   %eax,%eax
+     c84:	75 2c                	jne    cb2 <fopen+0x62>
+  if(threaded)
+     c86:	a1 c0 28 00 00       	mov    0x28c0,%eax
+     c8b:	85 c0                	test   %eax,%eax
+     c8d:	0f 85 ed 00 00 00    	jne    d80 <fopen+0x130>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     c93:	bb 14 28 00 00       	mov    $0x2814,%ebx
+    if(f->flags == 0)
+     c98:	8b 53 04             	mov    0x4(%ebx),%edx
+     c9b:	85 d2                	test   %edx,%edx
+     c9d:	74 21                	je     cc0 <fopen+0x70>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     c9f:	83 c3 1c             	add    $0x1c,%ebx
+     ca2:	81 fb a0 28 00 00    	cmp    $0x28a0,%ebx
+     ca8:	75 ee                	jne    c98 <fopen+0x48>
+  if(threaded)
+     caa:	85 c0                	test   %eax,%eax
+     cac:	0f 85 36 01 00 00    	jne    de8 <fopen+0x198>
+    return 0;
+     cb2:	31 db                	xor    %ebx,%ebx
+     cb4:	e9 96 00 00 00       	jmp    d4f <fopen+0xff>
+     cb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f == &_iob[NSTREAM])
+     cc0:	81 fb a0 28 00 00    	cmp    $0x28a0,%ebx
+     cc6:	74 e2                	je     caa <fopen+0x5a>
+    f->flags = IO_MALLOC;
+     cc8:	c7 43 04 80 00 00 00 	movl   $0x80,0x4(%ebx)
+  if(threaded)
+     ccf:	85 c0                	test   %eax,%eax
+     cd1:	0f 85 f9 00 00 00    	jne    dd0 <fopen+0x180>
+  if(mode[0] == 'r'){
+     cd7:	80 3e 72             	cmpb   $0x72,(%esi)
+     cda:	0f 84 c0 00 00 00    	je     da0 <fopen+0x150>
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     ce0:	83 ec 08             	sub    $0x8,%esp
+     ce3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     ce6:	50                   	push   %eax
+     ce7:	57                   	push   %edi
+     ce8:	e8 d3 f5 ff ff       	call   2c0 <stat>
+     ced:	83 c4 10             	add    $0x10,%esp
+     cf0:	85 c0                	test   %eax,%eax
+     cf2:	74 6c                	je     d60 <fopen+0x110>
+    fd = open(path, O_CREATE|O_WRONLY);
+     cf4:	83 ec 08             	sub    $0x8,%esp
+     cf7:	68 01 02 00 00       	push   $0x201
+     cfc:	57                   	push   %edi
+    flags = IO_WRITE;
+     cfd:	bf 02 00 00 00       	mov    $0x2,%edi
+    fd = open(path, O_CREATE|O_WRONLY);
+     d02:	e8 36 f8 ff ff       	call   53d <open>
+     d07:	83 c4 10             	add    $0x10,%esp
+     d0a:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     d0c:	85 f6                	test   %esi,%esi
+     d0e:	0f 88 a9 00 00 00    	js     dbd <fopen+0x16d>
+     d14:	83 ec 0c             	sub    $0xc,%esp
+     d17:	68 00 02 00 00       	push   $0x200
+     d1c:	e8 af 0c 00 00       	call   19d0 <malloc>
+     d21:	83 c4 10             	add    $0x10,%esp
+     d24:	89 43 08             	mov    %eax,0x8(%ebx)
+     d27:	85 c0                	test   %eax,%eax
+     d29:	0f 84 d0 00 00 00    	je     dff <fopen+0x1af>
+  f->flags = flags|IO_MALLOC;
+     d2f:	81 cf 80 00 00 00    	or     $0x80,%edi
+  f->fd = fd;
+     d35:	89 33                	mov    %esi,(%ebx)
+  f->size = BUFSIZ;
+     d37:	c7 43 0c 00 02 00 00 	movl   $0x200,0xc(%ebx)
+  f->r = f->n = 0;
+     d3e:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+     d45:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  f->flags = flags|IO_MALLOC;
+     d4c:	89 7b 04             	mov    %edi,0x4(%ebx)
+}
+     d4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d52:	89 d8                	mov    %ebx,%eax
+     d54:	5b                   	pop    %ebx
+     d55:	5e                   	pop    %esi
+     d56:	5f                   	pop    %edi
+     d57:	5d                   	pop    %ebp
+     d58:	c3                   	ret
+     d59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     d60:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+     d65:	75 8d                	jne    cf4 <fopen+0xa4>
+      unlink(path);
+     d67:	83 ec 0c             	sub    $0xc,%esp
+     d6a:	57                   	push   %edi
+     d6b:	e8 eb f7 ff ff       	call   55b <unlink>
+     d70:	83 c4 10             	add    $0x10,%esp
+     d73:	e9 7c ff ff ff       	jmp    cf4 <fopen+0xa4>
+     d78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d7f:	90                   	nop
+    mutex_lock(&iolock);
+     d80:	83 ec 0c             	sub    $0xc,%esp
+     d83:	68 c4 28 00 00       	push   $0x28c4
+     d88:	e8 03 f6 ff ff       	call   390 <mutex_lock>
+  if(threaded)
+     d8d:	a1 c0 28 00 00       	mov    0x28c0,%eax
+     d92:	83 c4 10             	add    $0x10,%esp
+     d95:	e9 f9 fe ff ff       	jmp    c93 <fopen+0x43>
+     d9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    fd = open(path, O_RDONLY);
+     da0:	83 ec 08             	sub    $0x8,%esp
+     da3:	6a 00                	push   $0x0
+     da5:	57                   	push   %edi
+    flags = IO_READ;
+     da6:	bf 01 00 00 00       	mov    $0x1,%edi
+    fd = open(path, O_RDONLY);
+     dab:	e8 8d f7 ff ff       	call   53d <open>
+     db0:	83 c4 10             	add    $0x10,%esp
+     db3:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     db5:	85 f6                	test   %esi,%esi
+     db7:	0f 89 57 ff ff ff    	jns    d14 <fopen+0xc4>
+    f->flags = 0;
+     dbd:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    return 0;
+     dc4:	31 db                	xor    %ebx,%ebx
+     dc6:	eb 87                	jmp    d4f <fopen+0xff>
+     dc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dcf:	90                   	nop
+    mutex_unlock(&iolock);
+     dd0:	83 ec 0c             	sub    $0xc,%esp
+     dd3:	68 c4 28 00 00       	push   $0x28c4
+     dd8:	e8 03 f6 ff ff       	call   3e0 <mutex_unlock>
+     ddd:	83 c4 10             	add    $0x10,%esp
+     de0:	e9 f2 fe ff ff       	jmp    cd7 <fopen+0x87>
+     de5:	8d 76 00             	lea    0x0(%esi),%esi
+     de8:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+     deb:	31 db                	xor    %ebx,%ebx
+    mutex_unlock(&iolock);
+     ded:	68 c4 28 00 00       	push   $0x28c4
+     df2:	e8 e9 f5 ff ff       	call   3e0 <mutex_unlock>
+     df7:	83 c4 10             	add    $0x10,%esp
+     dfa:	e9 50 ff ff ff       	jmp    d4f <fopen+0xff>
+      close(fd);
+     dff:	83 ec 0c             	sub    $0xc,%esp
+     e02:	56                   	push   %esi
+     e03:	e8 08 f7 ff ff       	call   510 <close>
+     e08:	83 c4 10             	add    $0x10,%esp
+     e0b:	eb b0                	jmp    dbd <fopen+0x16d>
+     e0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e10 <fclose>:
+{
+     e10:	55                   	push   %ebp
+     e11:	89 e5                	mov    %esp,%ebp
+     e13:	56                   	push   %esi
+     e14:	53                   	push   %ebx
+  if(threaded)
+     e15:	8b 15 c0 28 00 00    	mov    0x28c0,%edx
+{
+     e1b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+     e1e:	85 d2                	test   %edx,%edx
+     e20:	75 46                	jne    e68 <fclose+0x58>
+  r = flush(f);
+     e22:	89 d8                	mov    %ebx,%eax
+     e24:	e8 27 fc ff ff       	call   a50 <flush>
+  if(close(f->fd) < 0)
+     e29:	83 ec 0c             	sub    $0xc,%esp
+     e2c:	ff 33                	push   (%ebx)
+  r = flush(f);
+     e2e:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+     e30:	e8 db f6 ff ff       	call   510 <close>
+     e35:	83 c4 10             	add    $0x10,%esp
+    r = EOF;
+     e38:	85 c0                	test   %eax,%eax
+     e3a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     e3f:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->flags & IO_MALLOC)
+     e42:	f6 43 04 80          	testb  $0x80,0x4(%ebx)
+     e46:	75 58                	jne    ea0 <fclose+0x90>
+  if(threaded)
+     e48:	a1 c0 28 00 00       	mov    0x28c0,%eax
+  f->flags = 0;
+     e4d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  if(threaded)
+     e54:	85 c0                	test   %eax,%eax
+     e56:	75 28                	jne    e80 <fclose+0x70>
+}
+     e58:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e5b:	89 f0                	mov    %esi,%eax
+     e5d:	5b                   	pop    %ebx
+     e5e:	5e                   	pop    %esi
+     e5f:	5d                   	pop    %ebp
+     e60:	c3                   	ret
+     e61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     e68:	83 ec 0c             	sub    $0xc,%esp
+     e6b:	8d 43 18             	lea    0x18(%ebx),%eax
+     e6e:	50                   	push   %eax
+     e6f:	e8 1c f5 ff ff       	call   390 <mutex_lock>
+     e74:	83 c4 10             	add    $0x10,%esp
+     e77:	eb a9                	jmp    e22 <fclose+0x12>
+     e79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     e80:	83 ec 0c             	sub    $0xc,%esp
+     e83:	83 c3 18             	add    $0x18,%ebx
+     e86:	53                   	push   %ebx
+     e87:	e8 54 f5 ff ff       	call   3e0 <mutex_unlock>
+     e8c:	83 c4 10             	add    $0x10,%esp
+}
+     e8f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e92:	89 f0                	mov    %esi,%eax
+     e94:	5b                   	pop    %ebx
+     e95:	5e                   	pop    %esi
+     e96:	5d                   	pop    %ebp
+     e97:	c3                   	ret
+     e98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e9f:	90                   	nop
+    free(f->buf);
+     ea0:	83 ec 0c             	sub    $0xc,%esp
+     ea3:	ff 73 08             	push   0x8(%ebx)
+     ea6:	e8 f5 09 00 00       	call   18a0 <free>
+     eab:	83 c4 10             	add    $0x10,%esp
+     eae:	eb 98                	jmp    e48 <fclose+0x38>
+
+00000eb0 <fflush>:
+{
+     eb0:	55                   	push   %ebp
+     eb1:	89 e5                	mov    %esp,%ebp
+     eb3:	53                   	push   %ebx
+     eb4:	83 ec 14             	sub    $0x14,%esp
+     eb7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f == 0){
+     eba:	85 db                	test   %ebx,%ebx
+     ebc:	74 5a                	je     f18 <fflush+0x68>
+  if(threaded)
+     ebe:	8b 0d c0 28 00 00    	mov    0x28c0,%ecx
+     ec4:	85 c9                	test   %ecx,%ecx
+     ec6:	75 18                	jne    ee0 <fflush+0x30>
+  r = flush(f);
+     ec8:	89 d8                	mov    %ebx,%eax
+     eca:	e8 81 fb ff ff       	call   a50 <flush>
+  if(threaded)
+     ecf:	8b 15 c0 28 00 00    	mov    0x28c0,%edx
+     ed5:	85 d2                	test   %edx,%edx
+     ed7:	75 1f                	jne    ef8 <fflush+0x48>
+}
+     ed9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     edc:	c9                   	leave
+     edd:	c3                   	ret
+     ede:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+     ee0:	83 ec 0c             	sub    $0xc,%esp
+     ee3:	8d 43 18             	lea    0x18(%ebx),%eax
+     ee6:	50                   	push   %eax
+     ee7:	e8 a4 f4 ff ff       	call   390 <mutex_lock>
+     eec:	83 c4 10             	add    $0x10,%esp
+     eef:	eb d7                	jmp    ec8 <fflush+0x18>
+     ef1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     ef8:	83 ec 0c             	sub    $0xc,%esp
+     efb:	83 c3 18             	add    $0x18,%ebx
+     efe:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     f01:	53                   	push   %ebx
+     f02:	e8 d9 f4 ff ff       	call   3e0 <mutex_unlock>
+     f07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     f0a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    mutex_unlock(&f->lock);
+     f0d:	83 c4 10             	add    $0x10,%esp
+}
+     f10:	c9                   	leave
+     f11:	c3                   	ret
+     f12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     f18:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f1b:	c9                   	leave
+     f1c:	e9 af fb ff ff       	jmp    ad0 <fflush.part.0>
+     f21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f2f:	90                   	nop
+
+00000f30 <putc_unlocked>:
+{
+     f30:	55                   	push   %ebp
+     f31:	89 e5                	mov    %esp,%ebp
+     f33:	56                   	push   %esi
+     f34:	53                   	push   %ebx
+     f35:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     f38:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(!(f->flags & IO_WRITE))
+     f3b:	8b 43 04             	mov    0x4(%ebx),%eax
+     f3e:	a8 02                	test   $0x2,%al
+     f40:	74 46                	je     f88 <putc_unlocked+0x58>
+  if(!(f->flags & IO_SETUP))
+     f42:	a8 40                	test   $0x40,%al
+     f44:	74 4a                	je     f90 <putc_unlocked+0x60>
+  if(f->n == f->size && flush(f) < 0)
+     f46:	8b 43 14             	mov    0x14(%ebx),%eax
+     f49:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     f4c:	74 51                	je     f9f <putc_unlocked+0x6f>
+  f->buf[f->n++] = c;
+     f4e:	8d 48 01             	lea    0x1(%eax),%ecx
+     f51:	8b 53 08             	mov    0x8(%ebx),%edx
+     f54:	89 4b 14             	mov    %ecx,0x14(%ebx)
+     f57:	89 f1                	mov    %esi,%ecx
+     f59:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     f5c:	83 fe 0a             	cmp    $0xa,%esi
+     f5f:	74 0f                	je     f70 <putc_unlocked+0x40>
+  return c & 0xff;
+     f61:	89 f0                	mov    %esi,%eax
+     f63:	0f b6 c0             	movzbl %al,%eax
+}
+     f66:	5b                   	pop    %ebx
+     f67:	5e                   	pop    %esi
+     f68:	5d                   	pop    %ebp
+     f69:	c3                   	ret
+     f6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     f70:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+     f74:	74 eb                	je     f61 <putc_unlocked+0x31>
+     f76:	89 d8                	mov    %ebx,%eax
+     f78:	e8 d3 fa ff ff       	call   a50 <flush>
+     f7d:	85 c0                	test   %eax,%eax
+     f7f:	79 e0                	jns    f61 <putc_unlocked+0x31>
+     f81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return EOF;
+     f88:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     f8d:	eb d7                	jmp    f66 <putc_unlocked+0x36>
+     f8f:	90                   	nop
+    setup(f);
+     f90:	89 d8                	mov    %ebx,%eax
+     f92:	e8 69 fa ff ff       	call   a00 <setup>
+  if(f->n == f->size && flush(f) < 0)
+     f97:	8b 43 14             	mov    0x14(%ebx),%eax
+     f9a:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     f9d:	75 af                	jne    f4e <putc_unlocked+0x1e>
+     f9f:	89 d8                	mov    %ebx,%eax
+     fa1:	e8 aa fa ff ff       	call   a50 <flush>
+     fa6:	85 c0                	test   %eax,%eax
+     fa8:	78 de                	js     f88 <putc_unlocked+0x58>
+  f->buf[f->n++] = c;
+     faa:	8b 43 14             	mov    0x14(%ebx),%eax
+     fad:	eb 9f                	jmp    f4e <putc_unlocked+0x1e>
+     faf:	90                   	nop
+
+00000fb0 <fputc>:
+{
+     fb0:	55                   	push   %ebp
+     fb1:	89 e5                	mov    %esp,%ebp
+     fb3:	56                   	push   %esi
+     fb4:	53                   	push   %ebx
+  if(threaded)
+     fb5:	8b 15 c0 28 00 00    	mov    0x28c0,%edx
+{
+     fbb:	8b 75 08             	mov    0x8(%ebp),%esi
+     fbe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(threaded)
+     fc1:	85 d2                	test   %edx,%edx
+     fc3:	75 6b                	jne    1030 <fputc+0x80>
+  if(!(f->flags & IO_WRITE))
+     fc5:	8b 43 04             	mov    0x4(%ebx),%eax
+     fc8:	a8 02                	test   $0x2,%al
+     fca:	0f 84 b8 00 00 00    	je     1088 <fputc+0xd8>
+  if(!(f->flags & IO_SETUP))
+     fd0:	a8 40                	test   $0x40,%al
+     fd2:	74 76                	je     104a <fputc+0x9a>
+  if(f->n == f->size && flush(f) < 0)
+     fd4:	8b 43 14             	mov    0x14(%ebx),%eax
+     fd7:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     fda:	74 7d                	je     1059 <fputc+0xa9>
+  f->buf[f->n++] = c;
+     fdc:	8d 48 01             	lea    0x1(%eax),%ecx
+     fdf:	8b 53 08             	mov    0x8(%ebx),%edx
+     fe2:	89 4b 14             	mov    %ecx,0x14(%ebx)
+     fe5:	89 f1                	mov    %esi,%ecx
+     fe7:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     fea:	83 fe 0a             	cmp    $0xa,%esi
+     fed:	74 21                	je     1010 <fputc+0x60>
+  return c & 0xff;
+     fef:	89 f0                	mov    %esi,%eax
+     ff1:	0f b6 f0             	movzbl %al,%esi
+  if(threaded)
+     ff4:	a1 c0 28 00 00       	mov    0x28c0,%eax
+     ff9:	85 c0                	test   %eax,%eax
+     ffb:	75 73                	jne    1070 <fputc+0xc0>
+}
+     ffd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1000:	89 f0                	mov    %esi,%eax
+    1002:	5b                   	pop    %ebx
+    1003:	5e                   	pop    %esi
+    1004:	5d                   	pop    %ebp
+    1005:	c3                   	ret
+    1006:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    100d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    1010:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1014:	74 d9                	je     fef <fputc+0x3f>
+    1016:	89 d8                	mov    %ebx,%eax
+    1018:	e8 33 fa ff ff       	call   a50 <flush>
+    101d:	85 c0                	test   %eax,%eax
+    101f:	79 ce                	jns    fef <fputc+0x3f>
+    return EOF;
+    1021:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1026:	eb cc                	jmp    ff4 <fputc+0x44>
+    1028:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    102f:	90                   	nop
+    mutex_lock(&f->lock);
+    1030:	83 ec 0c             	sub    $0xc,%esp
+    1033:	8d 43 18             	lea    0x18(%ebx),%eax
+    1036:	50                   	push   %eax
+    1037:	e8 54 f3 ff ff       	call   390 <mutex_lock>
+  if(!(f->flags & IO_WRITE))
+    103c:	8b 43 04             	mov    0x4(%ebx),%eax
+    103f:	83 c4 10             	add    $0x10,%esp
+    1042:	a8 02                	test   $0x2,%al
+    1044:	74 db                	je     1021 <fputc+0x71>
+  if(!(f->flags & IO_SETUP))
+    1046:	a8 40                	test   $0x40,%al
+    1048:	75 8a                	jne    fd4 <fputc+0x24>
+    setup(f);
+    104a:	89 d8                	mov    %ebx,%eax
+    104c:	e8 af f9 ff ff       	call   a00 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    1051:	8b 43 14             	mov    0x14(%ebx),%eax
+    1054:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    1057:	75 83                	jne    fdc <fputc+0x2c>
+    1059:	89 d8                	mov    %ebx,%eax
+    105b:	e8 f0 f9 ff ff       	call   a50 <flush>
+    1060:	85 c0                	test   %eax,%eax
+    1062:	78 bd                	js     1021 <fputc+0x71>
+  f->buf[f->n++] = c;
+    1064:	8b 43 14             	mov    0x14(%ebx),%eax
+    1067:	e9 70 ff ff ff       	jmp    fdc <fputc+0x2c>
+    106c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1070:	83 ec 0c             	sub    $0xc,%esp
+    1073:	83 c3 18             	add    $0x18,%ebx
+    1076:	53                   	push   %ebx
+    1077:	e8 64 f3 ff ff       	call   3e0 <mutex_unlock>
+    107c:	83 c4 10             	add    $0x10,%esp
+}
+    107f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1082:	89 f0                	mov    %esi,%eax
+    1084:	5b                   	pop    %ebx
+    1085:	5e                   	pop    %esi
+    1086:	5d                   	pop    %ebp
+    1087:	c3                   	ret
+    return EOF;
+    1088:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    108d:	e9 6b ff ff ff       	jmp    ffd <fputc+0x4d>
+    1092:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1099:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000010a0 <fwrite>:
+{
+    10a0:	55                   	push   %ebp
+    10a1:	89 e5                	mov    %esp,%ebp
+    10a3:	57                   	push   %edi
+    10a4:	56                   	push   %esi
+    10a5:	53                   	push   %ebx
+    10a6:	83 ec 1c             	sub    $0x1c,%esp
+    10a9:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  if(!(f->flags & IO_WRITE) || size <= 0)
+    10ac:	8b 43 04             	mov    0x4(%ebx),%eax
+    10af:	a8 02                	test   $0x2,%al
+    10b1:	0f 84 ec 00 00 00    	je     11a3 <fwrite+0x103>
+    10b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    10ba:	85 c9                	test   %ecx,%ecx
+    10bc:	0f 8e e1 00 00 00    	jle    11a3 <fwrite+0x103>
+  if(threaded)
+    10c2:	8b 15 c0 28 00 00    	mov    0x28c0,%edx
+    10c8:	85 d2                	test   %edx,%edx
+    10ca:	0f 85 1c 01 00 00    	jne    11ec <fwrite+0x14c>
+  if(!(f->flags & IO_SETUP))
+    10d0:	a8 40                	test   $0x40,%al
+    10d2:	0f 84 08 01 00 00    	je     11e0 <fwrite+0x140>
+  for(len = size*nmemb; len > 0; len -= n){
+    10d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+    10db:	0f af 45 10          	imul   0x10(%ebp),%eax
+    10df:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    10e2:	85 c0                	test   %eax,%eax
+    10e4:	0f 8e 2a 01 00 00    	jle    1214 <fwrite+0x174>
+  s = p;
+    10ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  nl = 0;
+    10ed:	31 ff                	xor    %edi,%edi
+    10ef:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+        nl = 1;
+    10f2:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  s = p;
+    10f5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    10f8:	8b 43 14             	mov    0x14(%ebx),%eax
+        nl = 1;
+    10fb:	89 ce                	mov    %ecx,%esi
+    if(f->n == f->size && flush(f) < 0)
+    10fd:	89 c2                	mov    %eax,%edx
+    10ff:	39 f0                	cmp    %esi,%eax
+    1101:	74 6e                	je     1171 <fwrite+0xd1>
+    1103:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1107:	90                   	nop
+    if(n > len)
+    1108:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    n = f->size - f->n;
+    110b:	89 f1                	mov    %esi,%ecx
+    110d:	29 c1                	sub    %eax,%ecx
+    110f:	39 f9                	cmp    %edi,%ecx
+    1111:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1114:	85 c9                	test   %ecx,%ecx
+    1116:	0f 8e 7c 00 00 00    	jle    1198 <fwrite+0xf8>
+    111c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    111f:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1122:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    1125:	8d 34 08             	lea    (%eax,%ecx,1),%esi
+    1128:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    112b:	eb 06                	jmp    1133 <fwrite+0x93>
+    112d:	8d 76 00             	lea    0x0(%esi),%esi
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1130:	8b 53 14             	mov    0x14(%ebx),%edx
+    1133:	8d 4a 01             	lea    0x1(%edx),%ecx
+    1136:	8b 73 08             	mov    0x8(%ebx),%esi
+    1139:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    113c:	0f b6 08             	movzbl (%eax),%ecx
+        nl = 1;
+    113f:	80 f9 0a             	cmp    $0xa,%cl
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1142:	88 0c 16             	mov    %cl,(%esi,%edx,1)
+        nl = 1;
+    1145:	be 01 00 00 00       	mov    $0x1,%esi
+    114a:	0f 44 fe             	cmove  %esi,%edi
+    for(i = 0; i < n; i++)
+    114d:	83 c0 01             	add    $0x1,%eax
+    1150:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    1153:	75 db                	jne    1130 <fwrite+0x90>
+    s += n;
+    1155:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1158:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    115b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    s += n;
+    115e:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    1161:	85 c0                	test   %eax,%eax
+    1163:	7e 48                	jle    11ad <fwrite+0x10d>
+    1165:	8b 43 14             	mov    0x14(%ebx),%eax
+    1168:	8b 73 0c             	mov    0xc(%ebx),%esi
+    if(f->n == f->size && flush(f) < 0)
+    116b:	89 c2                	mov    %eax,%edx
+    116d:	39 f0                	cmp    %esi,%eax
+    116f:	75 97                	jne    1108 <fwrite+0x68>
+    1171:	89 d8                	mov    %ebx,%eax
+    1173:	e8 d8 f8 ff ff       	call   a50 <flush>
+    1178:	85 c0                	test   %eax,%eax
+    117a:	78 31                	js     11ad <fwrite+0x10d>
+    n = f->size - f->n;
+    117c:	8b 73 0c             	mov    0xc(%ebx),%esi
+    117f:	8b 43 14             	mov    0x14(%ebx),%eax
+    1182:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    1185:	89 f1                	mov    %esi,%ecx
+    1187:	89 c2                	mov    %eax,%edx
+    1189:	29 c1                	sub    %eax,%ecx
+    118b:	39 f9                	cmp    %edi,%ecx
+    118d:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1190:	85 c9                	test   %ecx,%ecx
+    1192:	7f 88                	jg     111c <fwrite+0x7c>
+    1194:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    s += n;
+    1198:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    119b:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    119e:	e9 5a ff ff ff       	jmp    10fd <fwrite+0x5d>
+}
+    11a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    11a6:	31 c0                	xor    %eax,%eax
+}
+    11a8:	5b                   	pop    %ebx
+    11a9:	5e                   	pop    %esi
+    11aa:	5f                   	pop    %edi
+    11ab:	5d                   	pop    %ebp
+    11ac:	c3                   	ret
+  if(nl && (f->flags & IO_LINE))
+    11ad:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    11b0:	85 ff                	test   %edi,%edi
+    11b2:	74 06                	je     11ba <fwrite+0x11a>
+    11b4:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    11b8:	75 1d                	jne    11d7 <fwrite+0x137>
+  return (s - (const char*)p) / size;
+    11ba:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    11bd:	2b 75 08             	sub    0x8(%ebp),%esi
+  if(threaded)
+    11c0:	a1 c0 28 00 00       	mov    0x28c0,%eax
+    11c5:	85 c0                	test   %eax,%eax
+    11c7:	75 3a                	jne    1203 <fwrite+0x163>
+  return (s - (const char*)p) / size;
+    11c9:	89 f0                	mov    %esi,%eax
+    11cb:	99                   	cltd
+    11cc:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    11cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11d2:	5b                   	pop    %ebx
+    11d3:	5e                   	pop    %esi
+    11d4:	5f                   	pop    %edi
+    11d5:	5d                   	pop    %ebp
+    11d6:	c3                   	ret
+    flush(f);
+    11d7:	89 d8                	mov    %ebx,%eax
+    11d9:	e8 72 f8 ff ff       	call   a50 <flush>
+    11de:	eb da                	jmp    11ba <fwrite+0x11a>
+    setup(f);
+    11e0:	89 d8                	mov    %ebx,%eax
+    11e2:	e8 19 f8 ff ff       	call   a00 <setup>
+    11e7:	e9 ec fe ff ff       	jmp    10d8 <fwrite+0x38>
+    mutex_lock(&f->lock);
+    11ec:	83 ec 0c             	sub    $0xc,%esp
+    11ef:	8d 43 18             	lea    0x18(%ebx),%eax
+    11f2:	50                   	push   %eax
+    11f3:	e8 98 f1 ff ff       	call   390 <mutex_lock>
+  if(!(f->flags & IO_SETUP))
+    11f8:	8b 43 04             	mov    0x4(%ebx),%eax
+    11fb:	83 c4 10             	add    $0x10,%esp
+    11fe:	e9 cd fe ff ff       	jmp    10d0 <fwrite+0x30>
+    mutex_unlock(&f->lock);
+    1203:	83 ec 0c             	sub    $0xc,%esp
+    1206:	83 c3 18             	add    $0x18,%ebx
+    1209:	53                   	push   %ebx
+    120a:	e8 d1 f1 ff ff       	call   3e0 <mutex_unlock>
+    120f:	83 c4 10             	add    $0x10,%esp
+    1212:	eb b5                	jmp    11c9 <fwrite+0x129>
+  for(len = size*nmemb; len > 0; len -= n){
+    1214:	31 f6                	xor    %esi,%esi
+    1216:	eb a8                	jmp    11c0 <fwrite+0x120>
+    1218:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    121f:	90                   	nop
+
+00001220 <fgetc>:
+  return f->buf[f->r++] & 0xff;
+}
+
+int
+fgetc(FILE *f)
+{
+    1220:	55                   	push   %ebp
+    1221:	89 e5                	mov    %esp,%ebp
+    1223:	56                   	push   %esi
+    1224:	53                   	push   %ebx
+  if(threaded)
+    1225:	8b 15 c0 28 00 00    	mov    0x28c0,%edx
+{
+    122b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    122e:	85 d2                	test   %edx,%edx
+    1230:	75 2e                	jne    1260 <fgetc+0x40>
+  if(!(f->flags & IO_READ))
+    1232:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1236:	74 78                	je     12b0 <fgetc+0x90>
+  if(f->r == f->n && fill(f) == 0)
+    1238:	8b 43 10             	mov    0x10(%ebx),%eax
+    123b:	3b 43 14             	cmp    0x14(%ebx),%eax
+    123e:	74 60                	je     12a0 <fgetc+0x80>
+  return f->buf[f->r++] & 0xff;
+    1240:	8b 53 08             	mov    0x8(%ebx),%edx
+    1243:	8d 48 01             	lea    0x1(%eax),%ecx
+    1246:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1249:	0f b6 34 02          	movzbl (%edx,%eax,1),%esi
+  if(threaded)
+    124d:	a1 c0 28 00 00       	mov    0x28c0,%eax
+    1252:	85 c0                	test   %eax,%eax
+    1254:	75 2a                	jne    1280 <fgetc+0x60>
+
+  flockfile(f);
+  c = getc_unlocked(f);
+  funlockfile(f);
+  return c;
+}
+    1256:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1259:	89 f0                	mov    %esi,%eax
+    125b:	5b                   	pop    %ebx
+    125c:	5e                   	pop    %esi
+    125d:	5d                   	pop    %ebp
+    125e:	c3                   	ret
+    125f:	90                   	nop
+    mutex_lock(&f->lock);
+    1260:	83 ec 0c             	sub    $0xc,%esp
+    1263:	8d 43 18             	lea    0x18(%ebx),%eax
+    1266:	50                   	push   %eax
+    1267:	e8 24 f1 ff ff       	call   390 <mutex_lock>
+  if(!(f->flags & IO_READ))
+    126c:	83 c4 10             	add    $0x10,%esp
+    126f:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1273:	75 c3                	jne    1238 <fgetc+0x18>
+    return EOF;
+    1275:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    127a:	eb d1                	jmp    124d <fgetc+0x2d>
+    127c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1280:	83 ec 0c             	sub    $0xc,%esp
+    1283:	83 c3 18             	add    $0x18,%ebx
+    1286:	53                   	push   %ebx
+    1287:	e8 54 f1 ff ff       	call   3e0 <mutex_unlock>
+    128c:	83 c4 10             	add    $0x10,%esp
+}
+    128f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1292:	89 f0                	mov    %esi,%eax
+    1294:	5b                   	pop    %ebx
+    1295:	5e                   	pop    %esi
+    1296:	5d                   	pop    %ebp
+    1297:	c3                   	ret
+    1298:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    129f:	90                   	nop
+  if(f->r == f->n && fill(f) == 0)
+    12a0:	89 d8                	mov    %ebx,%eax
+    12a2:	e8 c9 f8 ff ff       	call   b70 <fill>
+    12a7:	85 c0                	test   %eax,%eax
+    12a9:	74 ca                	je     1275 <fgetc+0x55>
+  return f->buf[f->r++] & 0xff;
+    12ab:	8b 43 10             	mov    0x10(%ebx),%eax
+    12ae:	eb 90                	jmp    1240 <fgetc+0x20>
+    return EOF;
+    12b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    12b5:	eb 9f                	jmp    1256 <fgetc+0x36>
+    12b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12be:	66 90                	xchg   %ax,%ax
+
+000012c0 <fread>:
+
+int
+fread(void *p, int size, int nmemb, FILE *f)
+{
+    12c0:	55                   	push   %ebp
+    12c1:	89 e5                	mov    %esp,%ebp
+    12c3:	57                   	push   %edi
+    12c4:	56                   	push   %esi
+    12c5:	53                   	push   %ebx
+    12c6:	83 ec 1c             	sub    $0x1c,%esp
+    12c9:	8b 75 14             	mov    0x14(%ebp),%esi
+  char *d;
+  int n, len;
+
+  if(!(f->flags & IO_READ) || size <= 0)
+    12cc:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+    12d0:	74 7e                	je     1350 <fread+0x90>
+    12d2:	8b 55 0c             	mov    0xc(%ebp),%edx
+    12d5:	85 d2                	test   %edx,%edx
+    12d7:	7e 77                	jle    1350 <fread+0x90>
+  if(threaded)
+    12d9:	a1 c0 28 00 00       	mov    0x28c0,%eax
+    return 0;
+  flockfile(f);
+  d = p;
+  for(len = size*nmemb; len > 0; len -= n){
+    12de:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    12e1:	0f af 7d 10          	imul   0x10(%ebp),%edi
+  if(threaded)
+    12e5:	85 c0                	test   %eax,%eax
+    12e7:	0f 85 93 00 00 00    	jne    1380 <fread+0xc0>
+  for(len = size*nmemb; len > 0; len -= n){
+    12ed:	85 ff                	test   %edi,%edi
+    12ef:	7e 61                	jle    1352 <fread+0x92>
+    if(f->r == f->n && fill(f) == 0)
+    12f1:	8b 46 10             	mov    0x10(%esi),%eax
+  d = p;
+    12f4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    12f7:	eb 35                	jmp    132e <fread+0x6e>
+    12f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      break;
+    n = f->n - f->r;
+    1300:	29 c3                	sub    %eax,%ebx
+    1302:	39 fb                	cmp    %edi,%ebx
+    1304:	0f 4f df             	cmovg  %edi,%ebx
+    if(n > len)
+      n = len;
+    memmove(d, f->buf + f->r, n);
+    1307:	83 ec 04             	sub    $0x4,%esp
+    130a:	53                   	push   %ebx
+    130b:	03 46 08             	add    0x8(%esi),%eax
+  for(len = size*nmemb; len > 0; len -= n){
+    130e:	29 df                	sub    %ebx,%edi
+    memmove(d, f->buf + f->r, n);
+    1310:	50                   	push   %eax
+    1311:	51                   	push   %ecx
+    1312:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1315:	e8 36 f0 ff ff       	call   350 <memmove>
+    f->r += n;
+    131a:	8b 46 10             	mov    0x10(%esi),%eax
+    d += n;
+    131d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1320:	83 c4 10             	add    $0x10,%esp
+    f->r += n;
+    1323:	01 d8                	add    %ebx,%eax
+    d += n;
+    1325:	01 d9                	add    %ebx,%ecx
+    f->r += n;
+    1327:	89 46 10             	mov    %eax,0x10(%esi)
+  for(len = size*nmemb; len > 0; len -= n){
+    132a:	85 ff                	test   %edi,%edi
+    132c:	7e 32                	jle    1360 <fread+0xa0>
+    if(f->r == f->n && fill(f) == 0)
+    132e:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1331:	39 c3                	cmp    %eax,%ebx
+    1333:	75 cb                	jne    1300 <fread+0x40>
+    1335:	89 f0                	mov    %esi,%eax
+    1337:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    133a:	e8 31 f8 ff ff       	call   b70 <fill>
+    133f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1342:	85 c0                	test   %eax,%eax
+    1344:	74 1a                	je     1360 <fread+0xa0>
+    n = f->n - f->r;
+    1346:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1349:	8b 46 10             	mov    0x10(%esi),%eax
+    134c:	eb b2                	jmp    1300 <fread+0x40>
+    134e:	66 90                	xchg   %ax,%ax
+    return 0;
+    1350:	31 c0                	xor    %eax,%eax
+  }
+  funlockfile(f);
+  return (d - (char*)p) / size;
+}
+    1352:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1355:	5b                   	pop    %ebx
+    1356:	5e                   	pop    %esi
+    1357:	5f                   	pop    %edi
+    1358:	5d                   	pop    %ebp
+    1359:	c3                   	ret
+    135a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (d - (char*)p) / size;
+    1360:	2b 4d 08             	sub    0x8(%ebp),%ecx
+    1363:	89 cb                	mov    %ecx,%ebx
+  if(threaded)
+    1365:	a1 c0 28 00 00       	mov    0x28c0,%eax
+    136a:	85 c0                	test   %eax,%eax
+    136c:	75 32                	jne    13a0 <fread+0xe0>
+  return (d - (char*)p) / size;
+    136e:	89 d8                	mov    %ebx,%eax
+    1370:	99                   	cltd
+    1371:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1374:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1377:	5b                   	pop    %ebx
+    1378:	5e                   	pop    %esi
+    1379:	5f                   	pop    %edi
+    137a:	5d                   	pop    %ebp
+    137b:	c3                   	ret
+    137c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    1380:	83 ec 0c             	sub    $0xc,%esp
+    1383:	8d 46 18             	lea    0x18(%esi),%eax
+    1386:	50                   	push   %eax
+    1387:	e8 04 f0 ff ff       	call   390 <mutex_lock>
+  for(len = size*nmemb; len > 0; len -= n){
+    138c:	83 c4 10             	add    $0x10,%esp
+    138f:	85 ff                	test   %edi,%edi
+    1391:	0f 8f 5a ff ff ff    	jg     12f1 <fread+0x31>
+    1397:	31 db                	xor    %ebx,%ebx
+    1399:	eb ca                	jmp    1365 <fread+0xa5>
+    139b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    139f:	90                   	nop
+    mutex_unlock(&f->lock);
+    13a0:	83 ec 0c             	sub    $0xc,%esp
+    13a3:	83 c6 18             	add    $0x18,%esi
+    13a6:	56                   	push   %esi
+    13a7:	e8 34 f0 ff ff       	call   3e0 <mutex_unlock>
+  return (d - (char*)p) / size;
+    13ac:	89 d8                	mov    %ebx,%eax
+    13ae:	83 c4 10             	add    $0x10,%esp
+    13b1:	99                   	cltd
+    13b2:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    13b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13b8:	5b                   	pop    %ebx
+    13b9:	5e                   	pop    %esi
+    13ba:	5f                   	pop    %edi
+    13bb:	5d                   	pop    %ebp
+    13bc:	c3                   	ret
+    13bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000013c0 <fgets>:
+
+// Read a line of at most max-1 bytes, keeping the newline.
+// Returns 0 if there was nothing left to read.
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    13c0:	55                   	push   %ebp
+    13c1:	89 e5                	mov    %esp,%ebp
+    13c3:	57                   	push   %edi
+    13c4:	56                   	push   %esi
+    13c5:	53                   	push   %ebx
+    13c6:	83 ec 1c             	sub    $0x1c,%esp
+  if(threaded)
+    13c9:	8b 35 c0 28 00 00    	mov    0x28c0,%esi
+{
+    13cf:	8b 7d 08             	mov    0x8(%ebp),%edi
+    13d2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if(threaded)
+    13d5:	85 f6                	test   %esi,%esi
+    13d7:	0f 85 83 00 00 00    	jne    1460 <fgets+0xa0>
+{
+    13dd:	31 f6                	xor    %esi,%esi
+    13df:	eb 2a                	jmp    140b <fgets+0x4b>
+    13e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return f->buf[f->r++] & 0xff;
+    13e8:	8b 53 08             	mov    0x8(%ebx),%edx
+    13eb:	8d 48 01             	lea    0x1(%eax),%ecx
+    13ee:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    13f1:	0f b6 14 02          	movzbl (%edx,%eax,1),%edx
+
+  flockfile(f);
+  for(i = 0; i+1 < max; ){
+    if((c = getc_unlocked(f)) == EOF)
+      break;
+    buf[i++] = c;
+    13f5:	88 54 37 ff          	mov    %dl,-0x1(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    13f9:	80 fa 0a             	cmp    $0xa,%dl
+    13fc:	0f 84 96 00 00 00    	je     1498 <fgets+0xd8>
+    1402:	83 fa 0d             	cmp    $0xd,%edx
+    1405:	0f 84 8d 00 00 00    	je     1498 <fgets+0xd8>
+  for(i = 0; i+1 < max; ){
+    140b:	89 f2                	mov    %esi,%edx
+    140d:	83 c6 01             	add    $0x1,%esi
+    1410:	3b 75 0c             	cmp    0xc(%ebp),%esi
+    1413:	7d 2b                	jge    1440 <fgets+0x80>
+  if(!(f->flags & IO_READ))
+    1415:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1419:	74 25                	je     1440 <fgets+0x80>
+  if(f->r == f->n && fill(f) == 0)
+    141b:	8b 43 10             	mov    0x10(%ebx),%eax
+    141e:	3b 43 14             	cmp    0x14(%ebx),%eax
+    1421:	75 c5                	jne    13e8 <fgets+0x28>
+    1423:	89 d8                	mov    %ebx,%eax
+    1425:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1428:	e8 43 f7 ff ff       	call   b70 <fill>
+    142d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1430:	85 c0                	test   %eax,%eax
+    1432:	74 0c                	je     1440 <fgets+0x80>
+  return f->buf[f->r++] & 0xff;
+    1434:	8b 43 10             	mov    0x10(%ebx),%eax
+    1437:	eb af                	jmp    13e8 <fgets+0x28>
+    1439:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1440:	8b 0d c0 28 00 00    	mov    0x28c0,%ecx
+      break;
+  }
+  buf[i] = '\0';
+    1446:	c6 04 17 00          	movb   $0x0,(%edi,%edx,1)
+  if(threaded)
+    144a:	85 c9                	test   %ecx,%ecx
+    144c:	75 2a                	jne    1478 <fgets+0xb8>
+  funlockfile(f);
+  return i > 0 ? buf : 0;
+    144e:	31 c0                	xor    %eax,%eax
+    1450:	85 d2                	test   %edx,%edx
+    1452:	74 02                	je     1456 <fgets+0x96>
+    1454:	89 f8                	mov    %edi,%eax
+}
+    1456:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1459:	5b                   	pop    %ebx
+    145a:	5e                   	pop    %esi
+    145b:	5f                   	pop    %edi
+    145c:	5d                   	pop    %ebp
+    145d:	c3                   	ret
+    145e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    1460:	83 ec 0c             	sub    $0xc,%esp
+    1463:	8d 43 18             	lea    0x18(%ebx),%eax
+    1466:	50                   	push   %eax
+    1467:	e8 24 ef ff ff       	call   390 <mutex_lock>
+    146c:	83 c4 10             	add    $0x10,%esp
+    146f:	e9 69 ff ff ff       	jmp    13dd <fgets+0x1d>
+    1474:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1478:	83 ec 0c             	sub    $0xc,%esp
+    147b:	83 c3 18             	add    $0x18,%ebx
+    147e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1481:	53                   	push   %ebx
+    1482:	e8 59 ef ff ff       	call   3e0 <mutex_unlock>
+    1487:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    148a:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    148d:	31 c0                	xor    %eax,%eax
+    148f:	85 d2                	test   %edx,%edx
+    1491:	75 c1                	jne    1454 <fgets+0x94>
+    1493:	eb c1                	jmp    1456 <fgets+0x96>
+    1495:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1498:	a1 c0 28 00 00       	mov    0x28c0,%eax
+  buf[i] = '\0';
+    149d:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  if(threaded)
+    14a1:	85 c0                	test   %eax,%eax
+    14a3:	74 af                	je     1454 <fgets+0x94>
+    mutex_unlock(&f->lock);
+    14a5:	83 ec 0c             	sub    $0xc,%esp
+    14a8:	83 c3 18             	add    $0x18,%ebx
+    14ab:	53                   	push   %ebx
+    14ac:	e8 2f ef ff ff       	call   3e0 <mutex_unlock>
+    14b1:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    14b4:	89 f8                	mov    %edi,%eax
+    14b6:	eb 9e                	jmp    1456 <fgets+0x96>
+    14b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14bf:	90                   	nop
+
+000014c0 <gets>:
+// at most a line per read(), goes through stdin's buffer: from a
+// file or pipe, a buffered read could take input meant for a child
+// process, so read a byte at a time.
+char*
+gets(char *buf, int max)
+{
+    14c0:	55                   	push   %ebp
+    14c1:	89 e5                	mov    %esp,%ebp
+    14c3:	57                   	push   %edi
+    14c4:	56                   	push   %esi
+    14c5:	53                   	push   %ebx
+    14c6:	83 ec 2c             	sub    $0x2c,%esp
+  int i, cc;
+  char c;
+
+  if(!(stdin->flags & IO_SETUP))
+    14c9:	8b 15 c4 27 00 00    	mov    0x27c4,%edx
+{
+    14cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!(stdin->flags & IO_SETUP))
+    14d2:	f6 c2 40             	test   $0x40,%dl
+    14d5:	74 79                	je     1550 <gets+0x90>
+    setup(stdin);
+  if(stdin->flags & IO_DEV){
+    14d7:	83 e2 20             	and    $0x20,%edx
+    14da:	89 d7                	mov    %edx,%edi
+    14dc:	75 52                	jne    1530 <gets+0x70>
+  if(f == 0){
+    14de:	e8 ed f5 ff ff       	call   ad0 <fflush.part.0>
+    fgets(buf, max, stdin);
+    return buf;
+  }
+  fflush(0);
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    14e3:	8d 75 e7             	lea    -0x19(%ebp),%esi
+  for(i=0; i+1 < max; ){
+    14e6:	eb 2c                	jmp    1514 <gets+0x54>
+    14e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14ef:	90                   	nop
+    cc = read(0, &c, 1);
+    14f0:	83 ec 04             	sub    $0x4,%esp
+    14f3:	6a 01                	push   $0x1
+    14f5:	56                   	push   %esi
+    14f6:	6a 00                	push   $0x0
+    14f8:	e8 f5 ef ff ff       	call   4f2 <read>
+    if(cc < 1)
+    14fd:	83 c4 10             	add    $0x10,%esp
+    1500:	85 c0                	test   %eax,%eax
+    1502:	7e 1b                	jle    151f <gets+0x5f>
+      break;
+    buf[i++] = c;
+    1504:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1508:	88 44 3b ff          	mov    %al,-0x1(%ebx,%edi,1)
+    if(c == '\n' || c == '\r')
+    150c:	3c 0a                	cmp    $0xa,%al
+    150e:	74 12                	je     1522 <gets+0x62>
+    1510:	3c 0d                	cmp    $0xd,%al
+    1512:	74 0e                	je     1522 <gets+0x62>
+  for(i=0; i+1 < max; ){
+    1514:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    1517:	83 c7 01             	add    $0x1,%edi
+    151a:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+    151d:	7c d1                	jl     14f0 <gets+0x30>
+{
+    151f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      break;
+  }
+  buf[i] = '\0';
+    1522:	c6 04 3b 00          	movb   $0x0,(%ebx,%edi,1)
+  return buf;
+}
+    1526:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1529:	89 d8                	mov    %ebx,%eax
+    152b:	5b                   	pop    %ebx
+    152c:	5e                   	pop    %esi
+    152d:	5f                   	pop    %edi
+    152e:	5d                   	pop    %ebp
+    152f:	c3                   	ret
+    fgets(buf, max, stdin);
+    1530:	83 ec 04             	sub    $0x4,%esp
+    1533:	68 c0 27 00 00       	push   $0x27c0
+    1538:	ff 75 0c             	push   0xc(%ebp)
+    153b:	53                   	push   %ebx
+    153c:	e8 7f fe ff ff       	call   13c0 <fgets>
+    return buf;
+    1541:	83 c4 10             	add    $0x10,%esp
+}
+    1544:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1547:	89 d8                	mov    %ebx,%eax
+    1549:	5b                   	pop    %ebx
+    154a:	5e                   	pop    %esi
+    154b:	5f                   	pop    %edi
+    154c:	5d                   	pop    %ebp
+    154d:	c3                   	ret
+    154e:	66 90                	xchg   %ax,%ax
+    setup(stdin);
+    1550:	b8 c0 27 00 00       	mov    $0x27c0,%eax
+    1555:	e8 a6 f4 ff ff       	call   a00 <setup>
+  if(stdin->flags & IO_DEV){
+    155a:	8b 15 c4 27 00 00    	mov    0x27c4,%edx
+    1560:	e9 72 ff ff ff       	jmp    14d7 <gets+0x17>
+    1565:	66 90                	xchg   %ax,%ax
+    1567:	66 90                	xchg   %ax,%ax
+    1569:	66 90                	xchg   %ax,%ax
+    156b:	66 90                	xchg   %ax,%ax
+    156d:	66 90                	xchg   %ax,%ax
+    156f:	90                   	nop
+
+00001570 <bigfree>:
+
+// Give a big block back to the first-fit list, and return the
+// free block that now holds it. Caller holds lock.
+static Header*
+bigfree(Header *bp)
+{
+    1570:	55                   	push   %ebp
+    1571:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1573:	a1 64 2f 00 00       	mov    0x2f64,%eax
+{
+    1578:	89 e5                	mov    %esp,%ebp
+    157a:	56                   	push   %esi
+    157b:	53                   	push   %ebx
+    157c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1580:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1582:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1584:	39 ca                	cmp    %ecx,%edx
+    1586:	73 38                	jae    15c0 <bigfree+0x50>
+    1588:	39 c1                	cmp    %eax,%ecx
+    158a:	72 04                	jb     1590 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    158c:	39 c2                	cmp    %eax,%edx
+    158e:	72 f0                	jb     1580 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1590:	8b 59 04             	mov    0x4(%ecx),%ebx
+    1593:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    1596:	39 f0                	cmp    %esi,%eax
+    1598:	74 36                	je     15d0 <bigfree+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    159a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  freep = p;
+  if(p + p->s.size == bp){
+    159c:	8b 42 04             	mov    0x4(%edx),%eax
+    159f:	89 cb                	mov    %ecx,%ebx
+  freep = p;
+    15a1:	89 15 64 2f 00 00    	mov    %edx,0x2f64
+  if(p + p->s.size == bp){
+    15a7:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    15aa:	39 f1                	cmp    %esi,%ecx
+    15ac:	74 2e                	je     15dc <bigfree+0x6c>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    15ae:	89 1a                	mov    %ebx,(%edx)
+    return p;
+  }
+  p->s.ptr = bp;
+  return bp;
+}
+    15b0:	89 c8                	mov    %ecx,%eax
+    15b2:	5b                   	pop    %ebx
+    15b3:	5e                   	pop    %esi
+    15b4:	5d                   	pop    %ebp
+    15b5:	c3                   	ret
+    15b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15bd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    15c0:	39 c1                	cmp    %eax,%ecx
+    15c2:	72 c8                	jb     158c <bigfree+0x1c>
+    15c4:	eb ba                	jmp    1580 <bigfree+0x10>
+    15c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15cd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    15d0:	03 58 04             	add    0x4(%eax),%ebx
+    15d3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    15d6:	8b 02                	mov    (%edx),%eax
+    15d8:	8b 00                	mov    (%eax),%eax
+    15da:	eb be                	jmp    159a <bigfree+0x2a>
+    p->s.size += bp->s.size;
+    15dc:	03 41 04             	add    0x4(%ecx),%eax
+    15df:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    15e2:	8b 19                	mov    (%ecx),%ebx
+    return p;
+    15e4:	89 d1                	mov    %edx,%ecx
+}
+    15e6:	89 c8                	mov    %ecx,%eax
+    p->s.ptr = bp->s.ptr;
+    15e8:	89 1a                	mov    %ebx,(%edx)
+}
+    15ea:	5b                   	pop    %ebx
+    15eb:	5e                   	pop    %esi
+    15ec:	5d                   	pop    %ebp
+    15ed:	c3                   	ret
+    15ee:	66 90                	xchg   %ax,%ax
+
+000015f0 <trim>:
+// If free block bp ends the heap, return its whole pages to the
+// kernel, unless something else has moved the break since.
+// Caller holds lock.
+static void
+trim(Header *bp)
+{
+    15f0:	55                   	push   %ebp
+    15f1:	89 e5                	mov    %esp,%ebp
+    15f3:	57                   	push   %edi
+    15f4:	56                   	push   %esi
+    15f5:	53                   	push   %ebx
+    15f6:	89 c3                	mov    %eax,%ebx
+    15f8:	83 ec 0c             	sub    $0xc,%esp
+  char *end;
+  uint n;
+
+  if((char*)(bp + bp->s.size) != heapend)
+    15fb:	8b 53 04             	mov    0x4(%ebx),%edx
+    15fe:	a1 60 2f 00 00       	mov    0x2f60,%eax
+    1603:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+    1606:	39 d0                	cmp    %edx,%eax
+    1608:	74 0e                	je     1618 <trim+0x28>
+  n = heapend - end;
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    bp->s.size -= n / sizeof(Header);
+    heapend = end;
+  }
+}
+    160a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    160d:	5b                   	pop    %ebx
+    160e:	5e                   	pop    %esi
+    160f:	5f                   	pop    %edi
+    1610:	5d                   	pop    %ebp
+    1611:	c3                   	ret
+    1612:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  end = (char*)PGROUNDUP((uint)(bp + 2));
+    1618:	8d bb 0f 10 00 00    	lea    0x100f(%ebx),%edi
+    161e:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  n = heapend - end;
+    1624:	29 f8                	sub    %edi,%eax
+    1626:	89 c6                	mov    %eax,%esi
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    1628:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    162d:	76 db                	jbe    160a <trim+0x1a>
+    162f:	83 ec 0c             	sub    $0xc,%esp
+    1632:	6a 00                	push   $0x0
+    1634:	e8 8b ef ff ff       	call   5c4 <sbrk>
+    1639:	83 c4 10             	add    $0x10,%esp
+    163c:	39 05 60 2f 00 00    	cmp    %eax,0x2f60
+    1642:	75 c6                	jne    160a <trim+0x1a>
+    1644:	89 f0                	mov    %esi,%eax
+    1646:	83 ec 0c             	sub    $0xc,%esp
+    1649:	f7 d8                	neg    %eax
+    164b:	50                   	push   %eax
+    164c:	e8 73 ef ff ff       	call   5c4 <sbrk>
+    1651:	83 c4 10             	add    $0x10,%esp
+    1654:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1657:	74 b1                	je     160a <trim+0x1a>
+    bp->s.size -= n / sizeof(Header);
+    1659:	89 f0                	mov    %esi,%eax
+    heapend = end;
+    165b:	89 3d 60 2f 00 00    	mov    %edi,0x2f60
+    bp->s.size -= n / sizeof(Header);
+    1661:	c1 e8 03             	shr    $0x3,%eax
+    1664:	29 43 04             	sub    %eax,0x4(%ebx)
+    heapend = end;
+    1667:	eb a1                	jmp    160a <trim+0x1a>
+    1669:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001670 <bigalloc>:
+}
+
+// Allocate a big block of nunits units. Caller holds lock.
+static Header*
+bigalloc(uint nunits)
+{
+    1670:	55                   	push   %ebp
+    1671:	89 e5                	mov    %esp,%ebp
+    1673:	57                   	push   %edi
+    1674:	89 c7                	mov    %eax,%edi
+    1676:	56                   	push   %esi
+    1677:	53                   	push   %ebx
+    1678:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    167b:	a1 64 2f 00 00       	mov    0x2f64,%eax
+    1680:	85 c0                	test   %eax,%eax
+    1682:	0f 84 98 00 00 00    	je     1720 <bigalloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1688:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    168a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    168d:	39 f9                	cmp    %edi,%ecx
+    168f:	73 67                	jae    16f8 <bigalloc+0x88>
+  if(nu < 4096)
+    1691:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1696:	39 df                	cmp    %ebx,%edi
+    1698:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    169b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    16a2:	eb 0d                	jmp    16b1 <bigalloc+0x41>
+    16a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    16a8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    16aa:	8b 4a 04             	mov    0x4(%edx),%ecx
+    16ad:	39 f9                	cmp    %edi,%ecx
+    16af:	73 47                	jae    16f8 <bigalloc+0x88>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    16b1:	89 d0                	mov    %edx,%eax
+    16b3:	39 15 64 2f 00 00    	cmp    %edx,0x2f64
+    16b9:	75 ed                	jne    16a8 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    16bb:	83 ec 0c             	sub    $0xc,%esp
+    16be:	56                   	push   %esi
+    16bf:	e8 00 ef ff ff       	call   5c4 <sbrk>
+  if(p == (char*)-1)
+    16c4:	83 c4 10             	add    $0x10,%esp
+    16c7:	83 f8 ff             	cmp    $0xffffffff,%eax
+    16ca:	74 1a                	je     16e6 <bigalloc+0x76>
+  hp->s.size = nu;
+    16cc:	89 58 04             	mov    %ebx,0x4(%eax)
+  heapend = p + nu * sizeof(Header);
+    16cf:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    16d2:	89 15 60 2f 00 00    	mov    %edx,0x2f60
+  bigfree(hp);
+    16d8:	e8 93 fe ff ff       	call   1570 <bigfree>
+  return freep;
+    16dd:	a1 64 2f 00 00       	mov    0x2f64,%eax
+      if((p = morecore(nunits)) == 0)
+    16e2:	85 c0                	test   %eax,%eax
+    16e4:	75 c2                	jne    16a8 <bigalloc+0x38>
+        return 0;
+  }
+}
+    16e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    16e9:	31 d2                	xor    %edx,%edx
+}
+    16eb:	5b                   	pop    %ebx
+    16ec:	89 d0                	mov    %edx,%eax
+    16ee:	5e                   	pop    %esi
+    16ef:	5f                   	pop    %edi
+    16f0:	5d                   	pop    %ebp
+    16f1:	c3                   	ret
+    16f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    16f8:	39 cf                	cmp    %ecx,%edi
+    16fa:	74 54                	je     1750 <bigalloc+0xe0>
+        p->s.size -= nunits;
+    16fc:	29 f9                	sub    %edi,%ecx
+    16fe:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    1701:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    1704:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    1707:	a3 64 2f 00 00       	mov    %eax,0x2f64
+}
+    170c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    170f:	89 d0                	mov    %edx,%eax
+    1711:	5b                   	pop    %ebx
+    1712:	5e                   	pop    %esi
+    1713:	5f                   	pop    %edi
+    1714:	5d                   	pop    %ebp
+    1715:	c3                   	ret
+    1716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    171d:	8d 76 00             	lea    0x0(%esi),%esi
+    base.s.ptr = freep = prevp = &base;
+    1720:	c7 05 64 2f 00 00 68 	movl   $0x2f68,0x2f64
+    1727:	2f 00 00 
+    base.s.size = 0;
+    172a:	ba 68 2f 00 00       	mov    $0x2f68,%edx
+    base.s.ptr = freep = prevp = &base;
+    172f:	c7 05 68 2f 00 00 68 	movl   $0x2f68,0x2f68
+    1736:	2f 00 00 
+    base.s.size = 0;
+    1739:	c7 05 6c 2f 00 00 00 	movl   $0x0,0x2f6c
+    1740:	00 00 00 
+    if(p->s.size >= nunits){
+    1743:	e9 49 ff ff ff       	jmp    1691 <bigalloc+0x21>
+    1748:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    174f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1750:	8b 0a                	mov    (%edx),%ecx
+    1752:	89 08                	mov    %ecx,(%eax)
+    1754:	eb b1                	jmp    1707 <bigalloc+0x97>
+    1756:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    175d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001760 <drain>:
+}
+
+// Move n blocks of class c from cache tc to the shared list.
+static void
+drain(struct tcache *tc, int c, int n)
+{
+    1760:	55                   	push   %ebp
+    1761:	89 e5                	mov    %esp,%ebp
+    1763:	57                   	push   %edi
+    1764:	89 c7                	mov    %eax,%edi
+    1766:	56                   	push   %esi
+    1767:	89 d6                	mov    %edx,%esi
+    1769:	53                   	push   %ebx
+    176a:	89 cb                	mov    %ecx,%ebx
+    176c:	83 ec 0c             	sub    $0xc,%esp
+  if(threaded)
+    176f:	8b 15 e4 2e 00 00    	mov    0x2ee4,%edx
+    1775:	85 d2                	test   %edx,%edx
+    1777:	75 57                	jne    17d0 <drain+0x70>
+  Header *p;
+
+  acquire();
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1779:	85 c9                	test   %ecx,%ecx
+    177b:	7e 49                	jle    17c6 <drain+0x66>
+    177d:	89 d9                	mov    %ebx,%ecx
+    177f:	8d 14 b7             	lea    (%edi,%esi,4),%edx
+    1782:	eb 23                	jmp    17a7 <drain+0x47>
+    1784:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    tc->list[c] = p->s.ptr;
+    1788:	8b 18                	mov    (%eax),%ebx
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    178a:	83 e9 01             	sub    $0x1,%ecx
+    tc->n[c]--;
+    178d:	83 6a 20 01          	subl   $0x1,0x20(%edx)
+    tc->list[c] = p->s.ptr;
+    1791:	89 1a                	mov    %ebx,(%edx)
+    p->s.ptr = small[c];
+    1793:	8b 1c b5 40 2f 00 00 	mov    0x2f40(,%esi,4),%ebx
+    179a:	89 18                	mov    %ebx,(%eax)
+    small[c] = p;
+    179c:	89 04 b5 40 2f 00 00 	mov    %eax,0x2f40(,%esi,4)
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    17a3:	85 c9                	test   %ecx,%ecx
+    17a5:	7e 06                	jle    17ad <drain+0x4d>
+    17a7:	8b 02                	mov    (%edx),%eax
+    17a9:	85 c0                	test   %eax,%eax
+    17ab:	75 db                	jne    1788 <drain+0x28>
+  if(threaded)
+    17ad:	a1 e4 2e 00 00       	mov    0x2ee4,%eax
+    17b2:	85 c0                	test   %eax,%eax
+    17b4:	74 10                	je     17c6 <drain+0x66>
+    mutex_unlock(&lock);
+    17b6:	83 ec 0c             	sub    $0xc,%esp
+    17b9:	68 e8 2e 00 00       	push   $0x2ee8
+    17be:	e8 1d ec ff ff       	call   3e0 <mutex_unlock>
+}
+    17c3:	83 c4 10             	add    $0x10,%esp
+  }
+  release();
+}
+    17c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    17c9:	5b                   	pop    %ebx
+    17ca:	5e                   	pop    %esi
+    17cb:	5f                   	pop    %edi
+    17cc:	5d                   	pop    %ebp
+    17cd:	c3                   	ret
+    17ce:	66 90                	xchg   %ax,%ax
+    mutex_lock(&lock);
+    17d0:	83 ec 0c             	sub    $0xc,%esp
+    17d3:	68 e8 2e 00 00       	push   $0x2ee8
+    17d8:	e8 b3 eb ff ff       	call   390 <mutex_lock>
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    17dd:	83 c4 10             	add    $0x10,%esp
+    17e0:	85 db                	test   %ebx,%ebx
+    17e2:	7f 99                	jg     177d <drain+0x1d>
+    17e4:	eb c7                	jmp    17ad <drain+0x4d>
+    17e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000017f0 <mycache>:
+{
+    17f0:	55                   	push   %ebp
+    return &maincache;
+    17f1:	b8 00 2f 00 00       	mov    $0x2f00,%eax
+{
+    17f6:	89 e5                	mov    %esp,%ebp
+    17f8:	53                   	push   %ebx
+  sp = PGROUNDDOWN((uint)&sp);
+    17f9:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+    17fc:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+    1802:	83 ec 14             	sub    $0x14,%esp
+  if(!threaded || sp == mainstack)
+    1805:	8b 0d e4 2e 00 00    	mov    0x2ee4,%ecx
+  sp = PGROUNDDOWN((uint)&sp);
+    180b:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  if(!threaded || sp == mainstack)
+    180e:	85 c9                	test   %ecx,%ecx
+    1810:	74 0f                	je     1821 <mycache+0x31>
+    1812:	3b 1d e0 2e 00 00    	cmp    0x2ee0,%ebx
+    1818:	74 07                	je     1821 <mycache+0x31>
+  if(*cp == 0){
+    181a:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    181d:	85 c0                	test   %eax,%eax
+    181f:	74 0f                	je     1830 <mycache+0x40>
+}
+    1821:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1824:	c9                   	leave
+    1825:	c3                   	ret
+    1826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    182d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1830:	83 ec 0c             	sub    $0xc,%esp
+    1833:	68 e8 2e 00 00       	push   $0x2ee8
+    1838:	e8 53 eb ff ff       	call   390 <mutex_lock>
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    183d:	b8 09 00 00 00       	mov    $0x9,%eax
+    1842:	e8 29 fe ff ff       	call   1670 <bigalloc>
+  if(threaded)
+    1847:	8b 15 e4 2e 00 00    	mov    0x2ee4,%edx
+    184d:	83 c4 10             	add    $0x10,%esp
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    1850:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(threaded)
+    1853:	85 d2                	test   %edx,%edx
+    1855:	75 29                	jne    1880 <mycache+0x90>
+    if(*cp == 0)
+    1857:	85 c0                	test   %eax,%eax
+    1859:	74 c6                	je     1821 <mycache+0x31>
+    memset(*cp, 0, sizeof(**cp));
+    185b:	83 ec 04             	sub    $0x4,%esp
+    *cp = (struct tcache*)((Header*)*cp + 1);
+    185e:	83 c0 08             	add    $0x8,%eax
+    1861:	89 43 f8             	mov    %eax,-0x8(%ebx)
+    memset(*cp, 0, sizeof(**cp));
+    1864:	6a 40                	push   $0x40
+    1866:	6a 00                	push   $0x0
+    1868:	50                   	push   %eax
+    1869:	e8 f2 e9 ff ff       	call   260 <memset>
+  return *cp;
+    186e:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    1871:	83 c4 10             	add    $0x10,%esp
+    1874:	eb ab                	jmp    1821 <mycache+0x31>
+    1876:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    187d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1880:	83 ec 0c             	sub    $0xc,%esp
+    1883:	68 e8 2e 00 00       	push   $0x2ee8
+    1888:	e8 53 eb ff ff       	call   3e0 <mutex_unlock>
+    if(*cp == 0)
+    188d:	8b 43 f8             	mov    -0x8(%ebx),%eax
+}
+    1890:	83 c4 10             	add    $0x10,%esp
+    1893:	eb c2                	jmp    1857 <mycache+0x67>
+    1895:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    189c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000018a0 <free>:
+
+void
+free(void *ap)
+{
+    18a0:	55                   	push   %ebp
+    18a1:	89 e5                	mov    %esp,%ebp
+    18a3:	57                   	push   %edi
+    18a4:	56                   	push   %esi
+    18a5:	53                   	push   %ebx
+    18a6:	83 ec 1c             	sub    $0x1c,%esp
+    18a9:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  struct tcache *tc;
+  int c;
+
+  if(ap == 0)
+    18ac:	85 f6                	test   %esi,%esi
+    18ae:	74 51                	je     1901 <free+0x61>
+    return;
+  bp = (Header*)ap - 1;
+    18b0:	8d 46 f8             	lea    -0x8(%esi),%eax
+    18b3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(bp->s.size > SMALLMAX / sizeof(Header)){
+    18b6:	8b 46 fc             	mov    -0x4(%esi),%eax
+    18b9:	3d 00 01 00 00       	cmp    $0x100,%eax
+    18be:	77 50                	ja     1910 <free+0x70>
+    acquire();
+    trim(bigfree(bp));
+    release();
+    return;
+  }
+  for(c = 0; (2 << c) < bp->s.size; c++)
+    18c0:	31 db                	xor    %ebx,%ebx
+    18c2:	ba 02 00 00 00       	mov    $0x2,%edx
+    18c7:	83 f8 02             	cmp    $0x2,%eax
+    18ca:	76 11                	jbe    18dd <free+0x3d>
+    18cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    18d0:	83 c3 01             	add    $0x1,%ebx
+    18d3:	89 d7                	mov    %edx,%edi
+    18d5:	89 d9                	mov    %ebx,%ecx
+    18d7:	d3 e7                	shl    %cl,%edi
+    18d9:	39 c7                	cmp    %eax,%edi
+    18db:	72 f3                	jb     18d0 <free+0x30>
+    ;
+  if((tc = mycache()) == 0){
+    18dd:	e8 0e ff ff ff       	call   17f0 <mycache>
+    18e2:	85 c0                	test   %eax,%eax
+    18e4:	74 7a                	je     1960 <free+0xc0>
+    bp->s.ptr = small[c];
+    small[c] = bp;
+    release();
+    return;
+  }
+  bp->s.ptr = tc->list[c];
+    18e6:	8d 0c 98             	lea    (%eax,%ebx,4),%ecx
+    18e9:	8b 11                	mov    (%ecx),%edx
+    18eb:	89 56 f8             	mov    %edx,-0x8(%esi)
+  tc->list[c] = bp;
+    18ee:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    18f1:	89 31                	mov    %esi,(%ecx)
+  if(++tc->n[c] > TCACHEMAX)
+    18f3:	8b 71 20             	mov    0x20(%ecx),%esi
+    18f6:	8d 56 01             	lea    0x1(%esi),%edx
+    18f9:	89 51 20             	mov    %edx,0x20(%ecx)
+    18fc:	83 fa 20             	cmp    $0x20,%edx
+    18ff:	7f 47                	jg     1948 <free+0xa8>
+    drain(tc, c, BATCH);
+}
+    1901:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1904:	5b                   	pop    %ebx
+    1905:	5e                   	pop    %esi
+    1906:	5f                   	pop    %edi
+    1907:	5d                   	pop    %ebp
+    1908:	c3                   	ret
+    1909:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1910:	8b 1d e4 2e 00 00    	mov    0x2ee4,%ebx
+    1916:	85 db                	test   %ebx,%ebx
+    1918:	75 66                	jne    1980 <free+0xe0>
+    trim(bigfree(bp));
+    191a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    191d:	e8 4e fc ff ff       	call   1570 <bigfree>
+    1922:	e8 c9 fc ff ff       	call   15f0 <trim>
+  if(threaded)
+    1927:	8b 0d e4 2e 00 00    	mov    0x2ee4,%ecx
+    192d:	85 c9                	test   %ecx,%ecx
+    192f:	74 d0                	je     1901 <free+0x61>
+    mutex_unlock(&lock);
+    1931:	c7 45 08 e8 2e 00 00 	movl   $0x2ee8,0x8(%ebp)
+}
+    1938:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    193b:	5b                   	pop    %ebx
+    193c:	5e                   	pop    %esi
+    193d:	5f                   	pop    %edi
+    193e:	5d                   	pop    %ebp
+    mutex_unlock(&lock);
+    193f:	e9 9c ea ff ff       	jmp    3e0 <mutex_unlock>
+    1944:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    1948:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    drain(tc, c, BATCH);
+    194b:	89 da                	mov    %ebx,%edx
+    194d:	b9 10 00 00 00       	mov    $0x10,%ecx
+}
+    1952:	5b                   	pop    %ebx
+    1953:	5e                   	pop    %esi
+    1954:	5f                   	pop    %edi
+    1955:	5d                   	pop    %ebp
+    drain(tc, c, BATCH);
+    1956:	e9 05 fe ff ff       	jmp    1760 <drain>
+    195b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    195f:	90                   	nop
+  if(threaded)
+    1960:	8b 15 e4 2e 00 00    	mov    0x2ee4,%edx
+    1966:	85 d2                	test   %edx,%edx
+    1968:	75 28                	jne    1992 <free+0xf2>
+    bp->s.ptr = small[c];
+    196a:	8b 04 9d 40 2f 00 00 	mov    0x2f40(,%ebx,4),%eax
+    1971:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1974:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1977:	89 04 9d 40 2f 00 00 	mov    %eax,0x2f40(,%ebx,4)
+  if(threaded)
+    197e:	eb 81                	jmp    1901 <free+0x61>
+    mutex_lock(&lock);
+    1980:	83 ec 0c             	sub    $0xc,%esp
+    1983:	68 e8 2e 00 00       	push   $0x2ee8
+    1988:	e8 03 ea ff ff       	call   390 <mutex_lock>
+}
+    198d:	83 c4 10             	add    $0x10,%esp
+    1990:	eb 88                	jmp    191a <free+0x7a>
+    mutex_lock(&lock);
+    1992:	83 ec 0c             	sub    $0xc,%esp
+    1995:	68 e8 2e 00 00       	push   $0x2ee8
+    199a:	e8 f1 e9 ff ff       	call   390 <mutex_lock>
+    bp->s.ptr = small[c];
+    199f:	8b 04 9d 40 2f 00 00 	mov    0x2f40(,%ebx,4),%eax
+  if(threaded)
+    19a6:	83 c4 10             	add    $0x10,%esp
+    bp->s.ptr = small[c];
+    19a9:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    19ac:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    19af:	89 04 9d 40 2f 00 00 	mov    %eax,0x2f40(,%ebx,4)
+  if(threaded)
+    19b6:	a1 e4 2e 00 00       	mov    0x2ee4,%eax
+    19bb:	85 c0                	test   %eax,%eax
+    19bd:	0f 85 6e ff ff ff    	jne    1931 <free+0x91>
+    19c3:	e9 39 ff ff ff       	jmp    1901 <free+0x61>
+    19c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19cf:	90                   	nop
+
+000019d0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    19d0:	55                   	push   %ebp
+    19d1:	89 e5                	mov    %esp,%ebp
+    19d3:	57                   	push   %edi
+    19d4:	56                   	push   %esi
+    19d5:	53                   	push   %ebx
+    19d6:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  struct tcache *tc;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    19d9:	8b 45 08             	mov    0x8(%ebp),%eax
+    19dc:	8d 78 07             	lea    0x7(%eax),%edi
+    19df:	c1 ef 03             	shr    $0x3,%edi
+    19e2:	83 c7 01             	add    $0x1,%edi
+  if(nunits > SMALLMAX / sizeof(Header)){
+    19e5:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+    19eb:	77 5b                	ja     1a48 <malloc+0x78>
+    acquire();
+    p = bigalloc(nunits);
+    release();
+    return p ? (void*)(p + 1) : 0;
+  }
+  for(c = 0; (2 << c) < nunits; c++)
+    19ed:	31 c9                	xor    %ecx,%ecx
+    19ef:	b8 02 00 00 00       	mov    $0x2,%eax
+    19f4:	be 02 00 00 00       	mov    $0x2,%esi
+    19f9:	bb 02 00 00 00       	mov    $0x2,%ebx
+    19fe:	83 ff 02             	cmp    $0x2,%edi
+    1a01:	76 12                	jbe    1a15 <malloc+0x45>
+    1a03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1a07:	90                   	nop
+    1a08:	83 c1 01             	add    $0x1,%ecx
+    1a0b:	89 c3                	mov    %eax,%ebx
+    1a0d:	d3 e3                	shl    %cl,%ebx
+    1a0f:	89 de                	mov    %ebx,%esi
+    1a11:	39 fb                	cmp    %edi,%ebx
+    1a13:	72 f3                	jb     1a08 <malloc+0x38>
+    1a15:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    ;
+  if((tc = mycache()) == 0)
+    1a18:	e8 d3 fd ff ff       	call   17f0 <mycache>
+    1a1d:	85 c0                	test   %eax,%eax
+    1a1f:	74 51                	je     1a72 <malloc+0xa2>
+    return 0;
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1a21:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1a24:	8d 3c 88             	lea    (%eax,%ecx,4),%edi
+    1a27:	8b 07                	mov    (%edi),%eax
+    1a29:	85 c0                	test   %eax,%eax
+    1a2b:	74 53                	je     1a80 <malloc+0xb0>
+    return 0;
+  p = tc->list[c];
+  tc->list[c] = p->s.ptr;
+  tc->n[c]--;
+    1a2d:	8b 57 20             	mov    0x20(%edi),%edx
+  tc->list[c] = p->s.ptr;
+    1a30:	8b 08                	mov    (%eax),%ecx
+  tc->n[c]--;
+    1a32:	83 ea 01             	sub    $0x1,%edx
+  return (void*)(p + 1);
+    1a35:	83 c0 08             	add    $0x8,%eax
+  tc->n[c]--;
+    1a38:	89 57 20             	mov    %edx,0x20(%edi)
+  tc->list[c] = p->s.ptr;
+    1a3b:	89 0f                	mov    %ecx,(%edi)
+}
+    1a3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a40:	5b                   	pop    %ebx
+    1a41:	5e                   	pop    %esi
+    1a42:	5f                   	pop    %edi
+    1a43:	5d                   	pop    %ebp
+    1a44:	c3                   	ret
+    1a45:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1a48:	a1 e4 2e 00 00       	mov    0x2ee4,%eax
+    1a4d:	85 c0                	test   %eax,%eax
+    1a4f:	0f 85 b3 00 00 00    	jne    1b08 <malloc+0x138>
+    p = bigalloc(nunits);
+    1a55:	89 f8                	mov    %edi,%eax
+    1a57:	e8 14 fc ff ff       	call   1670 <bigalloc>
+    1a5c:	89 c3                	mov    %eax,%ebx
+  if(threaded)
+    1a5e:	a1 e4 2e 00 00       	mov    0x2ee4,%eax
+    1a63:	85 c0                	test   %eax,%eax
+    1a65:	0f 85 85 00 00 00    	jne    1af0 <malloc+0x120>
+    return p ? (void*)(p + 1) : 0;
+    1a6b:	8d 43 08             	lea    0x8(%ebx),%eax
+    1a6e:	85 db                	test   %ebx,%ebx
+    1a70:	75 cb                	jne    1a3d <malloc+0x6d>
+    1a72:	31 c0                	xor    %eax,%eax
+}
+    1a74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a77:	5b                   	pop    %ebx
+    1a78:	5e                   	pop    %esi
+    1a79:	5f                   	pop    %edi
+    1a7a:	5d                   	pop    %ebp
+    1a7b:	c3                   	ret
+    1a7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1a80:	a1 e4 2e 00 00       	mov    0x2ee4,%eax
+    1a85:	85 c0                	test   %eax,%eax
+    1a87:	0f 85 29 01 00 00    	jne    1bb6 <malloc+0x1e6>
+  if(small[c] == 0){
+    1a8d:	8b 04 8d 40 2f 00 00 	mov    0x2f40(,%ecx,4),%eax
+    1a94:	85 c0                	test   %eax,%eax
+    1a96:	0f 84 81 00 00 00    	je     1b1d <malloc+0x14d>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1a9c:	31 db                	xor    %ebx,%ebx
+    1a9e:	eb 22                	jmp    1ac2 <malloc+0xf2>
+    small[c] = p->s.ptr;
+    1aa0:	8b 10                	mov    (%eax),%edx
+  for(moved = 0; moved < n && small[c]; moved++){
+    1aa2:	83 c3 01             	add    $0x1,%ebx
+    small[c] = p->s.ptr;
+    1aa5:	89 14 8d 40 2f 00 00 	mov    %edx,0x2f40(,%ecx,4)
+    p->s.ptr = tc->list[c];
+    1aac:	8b 17                	mov    (%edi),%edx
+    1aae:	89 10                	mov    %edx,(%eax)
+    tc->list[c] = p;
+    1ab0:	89 07                	mov    %eax,(%edi)
+  for(moved = 0; moved < n && small[c]; moved++){
+    1ab2:	83 fb 10             	cmp    $0x10,%ebx
+    1ab5:	0f 84 e2 00 00 00    	je     1b9d <malloc+0x1cd>
+    1abb:	8b 04 8d 40 2f 00 00 	mov    0x2f40(,%ecx,4),%eax
+    1ac2:	85 c0                	test   %eax,%eax
+    1ac4:	75 da                	jne    1aa0 <malloc+0xd0>
+  if(threaded)
+    1ac6:	8b 15 e4 2e 00 00    	mov    0x2ee4,%edx
+    1acc:	85 d2                	test   %edx,%edx
+    1ace:	0f 85 b4 00 00 00    	jne    1b88 <malloc+0x1b8>
+  tc->n[c] += moved;
+    1ad4:	8b 57 20             	mov    0x20(%edi),%edx
+    1ad7:	01 da                	add    %ebx,%edx
+    1ad9:	89 57 20             	mov    %edx,0x20(%edi)
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1adc:	85 db                	test   %ebx,%ebx
+    1ade:	74 92                	je     1a72 <malloc+0xa2>
+  p = tc->list[c];
+    1ae0:	8b 07                	mov    (%edi),%eax
+    1ae2:	e9 49 ff ff ff       	jmp    1a30 <malloc+0x60>
+    1ae7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1aee:	66 90                	xchg   %ax,%ax
+    mutex_unlock(&lock);
+    1af0:	83 ec 0c             	sub    $0xc,%esp
+    1af3:	68 e8 2e 00 00       	push   $0x2ee8
+    1af8:	e8 e3 e8 ff ff       	call   3e0 <mutex_unlock>
+}
+    1afd:	83 c4 10             	add    $0x10,%esp
+    1b00:	e9 66 ff ff ff       	jmp    1a6b <malloc+0x9b>
+    1b05:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1b08:	83 ec 0c             	sub    $0xc,%esp
+    1b0b:	68 e8 2e 00 00       	push   $0x2ee8
+    1b10:	e8 7b e8 ff ff       	call   390 <mutex_lock>
+}
+    1b15:	83 c4 10             	add    $0x10,%esp
+    1b18:	e9 38 ff ff ff       	jmp    1a55 <malloc+0x85>
+    if((chunk = bigalloc(CHUNK / sizeof(Header) + 1)) == 0){
+    1b1d:	b8 01 02 00 00       	mov    $0x201,%eax
+    1b22:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1b25:	e8 46 fb ff ff       	call   1670 <bigalloc>
+    1b2a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1b2d:	85 c0                	test   %eax,%eax
+    1b2f:	89 c2                	mov    %eax,%edx
+    1b31:	0f 84 ba 00 00 00    	je     1bf1 <malloc+0x221>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1b37:	83 c2 08             	add    $0x8,%edx
+    1b3a:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+    1b40:	0f 87 d0 00 00 00    	ja     1c16 <malloc+0x246>
+    1b46:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+    1b4d:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    1b50:	89 df                	mov    %ebx,%edi
+    1b52:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1b55:	8d 76 00             	lea    0x0(%esi),%esi
+      p->s.size = units;
+    1b58:	89 72 04             	mov    %esi,0x4(%edx)
+      p->s.ptr = small[c];
+    1b5b:	8b 04 8d 40 2f 00 00 	mov    0x2f40(,%ecx,4),%eax
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1b62:	01 df                	add    %ebx,%edi
+    1b64:	89 55 e0             	mov    %edx,-0x20(%ebp)
+      p->s.ptr = small[c];
+    1b67:	89 02                	mov    %eax,(%edx)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1b69:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      small[c] = p;
+    1b6c:	89 14 8d 40 2f 00 00 	mov    %edx,0x2f40(,%ecx,4)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1b73:	01 c2                	add    %eax,%edx
+    1b75:	81 ff 00 02 00 00    	cmp    $0x200,%edi
+    1b7b:	76 db                	jbe    1b58 <malloc+0x188>
+    1b7d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1b80:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1b83:	e9 14 ff ff ff       	jmp    1a9c <malloc+0xcc>
+    mutex_unlock(&lock);
+    1b88:	83 ec 0c             	sub    $0xc,%esp
+    1b8b:	68 e8 2e 00 00       	push   $0x2ee8
+    1b90:	e8 4b e8 ff ff       	call   3e0 <mutex_unlock>
+}
+    1b95:	83 c4 10             	add    $0x10,%esp
+    1b98:	e9 37 ff ff ff       	jmp    1ad4 <malloc+0x104>
+  if(threaded)
+    1b9d:	a1 e4 2e 00 00       	mov    0x2ee4,%eax
+    1ba2:	85 c0                	test   %eax,%eax
+    1ba4:	75 2b                	jne    1bd1 <malloc+0x201>
+  tc->n[c] += moved;
+    1ba6:	8b 47 20             	mov    0x20(%edi),%eax
+    1ba9:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1bac:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1bae:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1bb1:	e9 7a fe ff ff       	jmp    1a30 <malloc+0x60>
+    mutex_lock(&lock);
+    1bb6:	83 ec 0c             	sub    $0xc,%esp
+    1bb9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1bbc:	68 e8 2e 00 00       	push   $0x2ee8
+    1bc1:	e8 ca e7 ff ff       	call   390 <mutex_lock>
+}
+    1bc6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1bc9:	83 c4 10             	add    $0x10,%esp
+    1bcc:	e9 bc fe ff ff       	jmp    1a8d <malloc+0xbd>
+    mutex_unlock(&lock);
+    1bd1:	83 ec 0c             	sub    $0xc,%esp
+    1bd4:	68 e8 2e 00 00       	push   $0x2ee8
+    1bd9:	e8 02 e8 ff ff       	call   3e0 <mutex_unlock>
+  tc->n[c] += moved;
+    1bde:	8b 47 20             	mov    0x20(%edi),%eax
+    1be1:	83 c4 10             	add    $0x10,%esp
+    1be4:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1be7:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1be9:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1bec:	e9 3f fe ff ff       	jmp    1a30 <malloc+0x60>
+  if(threaded)
+    1bf1:	8b 0d e4 2e 00 00    	mov    0x2ee4,%ecx
+    1bf7:	85 c9                	test   %ecx,%ecx
+    1bf9:	0f 84 73 fe ff ff    	je     1a72 <malloc+0xa2>
+    mutex_unlock(&lock);
+    1bff:	83 ec 0c             	sub    $0xc,%esp
+    1c02:	68 e8 2e 00 00       	push   $0x2ee8
+    1c07:	e8 d4 e7 ff ff       	call   3e0 <mutex_unlock>
+    1c0c:	83 c4 10             	add    $0x10,%esp
+    return p ? (void*)(p + 1) : 0;
+    1c0f:	31 c0                	xor    %eax,%eax
+    1c11:	e9 5e fe ff ff       	jmp    1a74 <malloc+0xa4>
+  for(moved = 0; moved < n && small[c]; moved++){
+    1c16:	8b 04 8d 40 2f 00 00 	mov    0x2f40(,%ecx,4),%eax
+    1c1d:	e9 7a fe ff ff       	jmp    1a9c <malloc+0xcc>
+    1c22:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001c30 <malloc_threaded>:
+void
+malloc_threaded(void)
+{
+  uint sp;
+
+  if(threaded)
+    1c30:	a1 e4 2e 00 00       	mov    0x2ee4,%eax
+    1c35:	85 c0                	test   %eax,%eax
+    1c37:	74 07                	je     1c40 <malloc_threaded+0x10>
+    1c39:	c3                   	ret
+    1c3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+{
+    1c40:	55                   	push   %ebp
+    1c41:	89 e5                	mov    %esp,%ebp
+    1c43:	83 ec 24             	sub    $0x24,%esp
+    return;
+  mutex_init(&lock);
+    1c46:	68 e8 2e 00 00       	push   $0x2ee8
+    1c4b:	e8 30 e7 ff ff       	call   380 <mutex_init>
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1c50:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1c53:	83 c4 10             	add    $0x10,%esp
+  threaded = 1;
+    1c56:	c7 05 e4 2e 00 00 01 	movl   $0x1,0x2ee4
+    1c5d:	00 00 00 
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1c60:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    1c65:	a3 e0 2e 00 00       	mov    %eax,0x2ee0
+}
+    1c6a:	c9                   	leave
+    1c6b:	c3                   	ret
+    1c6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001c70 <malloc_thread_exit>:
+
+// Called by thread_join() with the cache slot of a finished
+// thread: give its blocks, and the cache itself, back.
+void
+malloc_thread_exit(void **cachep)
+{
+    1c70:	55                   	push   %ebp
+    1c71:	89 e5                	mov    %esp,%ebp
+    1c73:	57                   	push   %edi
+    1c74:	56                   	push   %esi
+    1c75:	53                   	push   %ebx
+    1c76:	83 ec 0c             	sub    $0xc,%esp
+    1c79:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct tcache *tc;
+  int c;
+
+  if((tc = *cachep) == 0)
+    1c7c:	8b 37                	mov    (%edi),%esi
+    1c7e:	85 f6                	test   %esi,%esi
+    1c80:	74 41                	je     1cc3 <malloc_thread_exit+0x53>
+    return;
+  for(c = 0; c < NCLASS; c++)
+    1c82:	31 db                	xor    %ebx,%ebx
+    1c84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    drain(tc, c, tc->n[c]);
+    1c88:	8b 4c 9e 20          	mov    0x20(%esi,%ebx,4),%ecx
+    1c8c:	89 da                	mov    %ebx,%edx
+    1c8e:	89 f0                	mov    %esi,%eax
+  for(c = 0; c < NCLASS; c++)
+    1c90:	83 c3 01             	add    $0x1,%ebx
+    drain(tc, c, tc->n[c]);
+    1c93:	e8 c8 fa ff ff       	call   1760 <drain>
+  for(c = 0; c < NCLASS; c++)
+    1c98:	83 fb 08             	cmp    $0x8,%ebx
+    1c9b:	75 eb                	jne    1c88 <malloc_thread_exit+0x18>
+  if(threaded)
+    1c9d:	8b 15 e4 2e 00 00    	mov    0x2ee4,%edx
+    1ca3:	85 d2                	test   %edx,%edx
+    1ca5:	75 29                	jne    1cd0 <malloc_thread_exit+0x60>
+  acquire();
+  trim(bigfree((Header*)tc - 1));
+    1ca7:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1caa:	e8 c1 f8 ff ff       	call   1570 <bigfree>
+    1caf:	e8 3c f9 ff ff       	call   15f0 <trim>
+  if(threaded)
+    1cb4:	a1 e4 2e 00 00       	mov    0x2ee4,%eax
+    1cb9:	85 c0                	test   %eax,%eax
+    1cbb:	75 2b                	jne    1ce8 <malloc_thread_exit+0x78>
+  release();
+  *cachep = 0;
+    1cbd:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+}
+    1cc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1cc6:	5b                   	pop    %ebx
+    1cc7:	5e                   	pop    %esi
+    1cc8:	5f                   	pop    %edi
+    1cc9:	5d                   	pop    %ebp
+    1cca:	c3                   	ret
+    1ccb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1ccf:	90                   	nop
+    mutex_lock(&lock);
+    1cd0:	83 ec 0c             	sub    $0xc,%esp
+    1cd3:	68 e8 2e 00 00       	push   $0x2ee8
+    1cd8:	e8 b3 e6 ff ff       	call   390 <mutex_lock>
+}
+    1cdd:	83 c4 10             	add    $0x10,%esp
+    1ce0:	eb c5                	jmp    1ca7 <malloc_thread_exit+0x37>
+    1ce2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1ce8:	83 ec 0c             	sub    $0xc,%esp
+    1ceb:	68 e8 2e 00 00       	push   $0x2ee8
+    1cf0:	e8 eb e6 ff ff       	call   3e0 <mutex_unlock>
+}
+    1cf5:	83 c4 10             	add    $0x10,%esp
+    1cf8:	eb c3                	jmp    1cbd <malloc_thread_exit+0x4d>
+    1cfa:	66 90                	xchg   %ax,%ax
+    1cfc:	66 90                	xchg   %ax,%ax
+    1cfe:	66 90                	xchg   %ax,%ax
+
+00001d00 <thread_create>:
+
+// Start fn(arg) in a new thread on a freshly allocated
+// page-aligned stack.  Returns the thread's pid.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1d00:	55                   	push   %ebp
+    1d01:	89 e5                	mov    %esp,%ebp
+    1d03:	53                   	push   %ebx
+    1d04:	83 ec 14             	sub    $0x14,%esp
+  char *mem, *stack;
+  int pid;
+
+  malloc_threaded();
+    1d07:	e8 24 ff ff ff       	call   1c30 <malloc_threaded>
+  stdio_threaded();
+    1d0c:	e8 cf ee ff ff       	call   be0 <stdio_threaded>
+  if((mem = malloc(2*PGSIZE)) == 0)
+    1d11:	83 ec 0c             	sub    $0xc,%esp
+    1d14:	68 00 20 00 00       	push   $0x2000
+    1d19:	e8 b2 fc ff ff       	call   19d0 <malloc>
+    1d1e:	83 c4 10             	add    $0x10,%esp
+    1d21:	85 c0                	test   %eax,%eax
+    1d23:	74 52                	je     1d77 <thread_create+0x77>
+    1d25:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1d27:	8d 80 07 10 00 00    	lea    0x1007(%eax),%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+  ((char**)stack)[-2] = 0;
+  if((pid = clone(fn, arg, stack)) < 0)
+    1d2d:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1d30:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+    1d35:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  ((char**)stack)[-2] = 0;
+    1d38:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+  if((pid = clone(fn, arg, stack)) < 0)
+    1d3f:	50                   	push   %eax
+    1d40:	ff 75 0c             	push   0xc(%ebp)
+    1d43:	ff 75 08             	push   0x8(%ebp)
+    1d46:	e8 97 e8 ff ff       	call   5e2 <clone>
+    1d4b:	83 c4 10             	add    $0x10,%esp
+    1d4e:	85 c0                	test   %eax,%eax
+    1d50:	78 0e                	js     1d60 <thread_create+0x60>
+    free(mem);
+  return pid;
+}
+    1d52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1d55:	c9                   	leave
+    1d56:	c3                   	ret
+    1d57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d5e:	66 90                	xchg   %ax,%ax
+    free(mem);
+    1d60:	83 ec 0c             	sub    $0xc,%esp
+    1d63:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1d66:	53                   	push   %ebx
+    1d67:	e8 34 fb ff ff       	call   18a0 <free>
+    1d6c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1d6f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    1d72:	83 c4 10             	add    $0x10,%esp
+}
+    1d75:	c9                   	leave
+    1d76:	c3                   	ret
+    return -1;
+    1d77:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1d7c:	eb d4                	jmp    1d52 <thread_create+0x52>
+    1d7e:	66 90                	xchg   %ax,%ax
+
+00001d80 <thread_join>:
+
+// Wait for a thread to finish and free its stack.
+int
+thread_join(void)
+{
+    1d80:	55                   	push   %ebp
+    1d81:	89 e5                	mov    %esp,%ebp
+    1d83:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    1d84:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    1d87:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    1d8a:	50                   	push   %eax
+    1d8b:	e8 61 e8 ff ff       	call   5f1 <join>
+    1d90:	83 c4 10             	add    $0x10,%esp
+    1d93:	85 c0                	test   %eax,%eax
+    1d95:	78 29                	js     1dc0 <thread_join+0x40>
+    1d97:	89 c3                	mov    %eax,%ebx
+    return -1;
+  malloc_thread_exit(&((void**)stack)[-2]);
+    1d99:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1d9c:	83 ec 0c             	sub    $0xc,%esp
+    1d9f:	83 e8 08             	sub    $0x8,%eax
+    1da2:	50                   	push   %eax
+    1da3:	e8 c8 fe ff ff       	call   1c70 <malloc_thread_exit>
+  free(((char**)stack)[-1]);
+    1da8:	58                   	pop    %eax
+    1da9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1dac:	ff 70 fc             	push   -0x4(%eax)
+    1daf:	e8 ec fa ff ff       	call   18a0 <free>
+  return pid;
+    1db4:	83 c4 10             	add    $0x10,%esp
+}
+    1db7:	89 d8                	mov    %ebx,%eax
+    1db9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1dbc:	c9                   	leave
+    1dbd:	c3                   	ret
+    1dbe:	66 90                	xchg   %ax,%ax
+    return -1;
+    1dc0:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    1dc5:	eb f0                	jmp    1db7 <thread_join+0x37>
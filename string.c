@@ -1,6 +1,15 @@
 #include "types.h"
+#include "defs.h"
+#include "mmu.h"
 #include "x86.h"
 
+#ifndef STRINGTEST
+#define STRINGTEST 0     // check memmove() and memcmp() at boot
+#endif
+#ifndef STRINGBENCH
+#define STRINGBENCH 0    // time memmove() at boot
+#endif
+
 
 
 ///这是一个C语言中的内存清零函数，用于将一段内存区域中的所有字节都设置为指定的值。
@@ -19,12 +28,18 @@ memset(void *dst, int c, uint n) {
     return dst;
 }
 
+// Compare a word at a time while the words are equal,
+// then find the first differing byte.
 int
 memcmp(const void *v1, const void *v2, uint n) {
     const uchar *s1, *s2;
 
     s1 = v1;
     s2 = v2;
+    while (n >= 4 && *(uint *) s1 == *(uint *) s2) {
+        s1 += 4, s2 += 4;
+        n -= 4;
+    }
     while (n-- > 0) {
         if (*s1 != *s2)
             return *s1 - *s2;
@@ -34,22 +49,38 @@ memcmp(const void *v1, const void *v2, uint n) {
     return 0;
 }
 
+// Bulk copies with rep movs: a dword at a time when src and dst
+// share alignment, otherwise a byte at a time, which the CPU may
+// still do in bigger pieces. An overlapping copy to a higher
+// address runs backward.
 void *
 memmove(void *dst, const void *src, uint n) {
     const char *s;
     char *d;
+    uint head, tail;
 
     s = src;
     d = dst;
+    if (n < 16 || (((uint) s ^ (uint) d) & 3) != 0) {
+        if (s < d && s + n > d)
+            rmovsb(d + n - 1, s + n - 1, n);
+        else
+            movsb(d, s, n);
+        return dst;
+    }
     if (s < d && s + n > d) {
-        s += n;
-        d += n;
-        while (n-- > 0)
-            *--d = *--s;
-    } else
-        while (n-- > 0)
-            *d++ = *s++;
-
+        tail = (uint) (d + n) & 3;
+        rmovsb(d + n - 1, s + n - 1, tail);
+        n -= tail;
+        rmovsl(d + n - 4, s + n - 4, n / 4);
+        rmovsb(d + n % 4 - 1, s + n % 4 - 1, n % 4);
+    } else {
+        head = -(uint) d & 3;
+        movsb(d, s, head);
+        movsl(d + head, s + head, (n - head) / 4);
+        tail = (n - head) & 3;
+        movsb(d + n - tail, s + n - tail, tail);
+    }
     return dst;
 }
 
@@ -100,3 +131,82 @@ strlen(const char *s) {
     return n;
 }
 
+static void
+bytecopy(char *d, const char *s, uint n) {
+    if (s < d && s + n > d)
+        while (n-- > 0)
+            d[n] = s[n];
+    else
+        while (n-- > 0)
+            *d++ = *s++;
+}
+
+// If STRINGTEST, check memmove() against a byte loop for every
+// alignment of source and destination, short lengths and overlaps
+// both ways, and memcmp() on where the first difference falls.
+// Only the first TESTWIN bytes of each buffer are touched, so only
+// those are re-copied and compared. Then, if STRINGBENCH, report
+// the cycles a page copy takes.
+#define TESTWIN 512
+void
+stringtest(void) {
+    char *a, *b, *c;
+    int so, dofs, n, i;
+    uint t[4];
+
+    if (!STRINGTEST && !STRINGBENCH)
+        return;
+    if ((a = kalloc()) == 0 || (b = kalloc()) == 0 || (c = kalloc()) == 0)
+        panic("stringtest");
+    for (i = 0; i < PGSIZE; i++)
+        a[i] = i * 7 + 1;
+    for (so = 0; STRINGTEST && so < 8; so++) {
+        for (dofs = 0; dofs < 8; dofs++) {
+            for (n = 0; n < 80; n++) {
+                // Separate buffers.
+                bytecopy(b, a, TESTWIN);
+                bytecopy(c, a, TESTWIN);
+                memmove(b + dofs, a + so + 256, n);
+                bytecopy(c + dofs, a + so + 256, n);
+                if (memcmp(b, c, TESTWIN) != 0)
+                    panic("memmove");
+                // Overlapping, within one buffer.
+                bytecopy(b, a, TESTWIN);
+                bytecopy(c, a, TESTWIN);
+                memmove(b + 64 + dofs, b + 64 + so, n + 64);
+                bytecopy(c + 64 + dofs, c + 64 + so, n + 64);
+                if (memcmp(b, c, TESTWIN) != 0)
+                    panic("memmove overlap");
+            }
+        }
+    }
+    for (n = 0; STRINGTEST && n < 64; n++) {
+        bytecopy(b, a, 64);
+        b[n] = a[n] + 1;
+        if (memcmp(a, b, 64) >= 0 || memcmp(b, a, 64) <= 0 || memcmp(a, b, n) != 0)
+            panic("memcmp");
+    }
+
+    if (STRINGBENCH) {
+        t[0] = rdtsc();
+        for (i = 0; i < 64; i++)
+            memmove(b, a, PGSIZE);
+        t[1] = rdtsc();
+        for (i = 0; i < 64; i++)
+            memmove(b + 1, a + 2, PGSIZE - 2);
+        t[2] = rdtsc();
+        for (i = 0; i < 64; i++)
+            memmove(a + 4, a, PGSIZE - 4);
+        t[3] = rdtsc();
+        cprintf("memmove: %d aligned, %d unaligned, %d backward cycles/page\n",
+                (t[1] - t[0]) / 64, (t[2] - t[1]) / 64, (t[3] - t[2]) / 64);
+        t[0] = rdtsc();
+        for (i = 0; i < 64; i++)
+            bytecopy(b, a, PGSIZE);
+        t[1] = rdtsc();
+        cprintf("memmove: %d cycles/page for a byte loop\n", (t[1] - t[0]) / 64);
+    }
+    kfree(a);
+    kfree(b);
+    kfree(c);
+}
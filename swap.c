@@ -0,0 +1,262 @@
+// Paging to the swap area.
+//
+// mkfs leaves a swap area of sb.nswap page-sized slots after the
+// file system. The kswapd kernel thread wakes every tick and, when
+// free memory runs low or an allocation is waiting, writes cold user
+// pages out to free slots through the buffer cache. A swapped-out
+// page's PTE is left not present, with PTE_SWAP set and the slot
+// number in place of the physical address. The page fault handler
+// reads it back in on the next touch.
+//
+// Pages are taken only from processes that were preempted in user
+// mode and do not share their page table (see swapscan() in proc.c).
+// Such a process is not using its memory from the kernel, and no
+// CPU's TLB holds its translations. Once a process is back in the
+// kernel, its pages stay put until it returns to user mode, so a
+// system call can use a user buffer that argptr() has checked, even
+// while holding a spinlock.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+
+#define BPP       (PGSIZE / BSIZE)  // blocks per slot
+#define SWAPLOW   64    // kswapd pages out below this many free pages
+#define SWAPHIGH  128   // until this many are free
+#define SWAPBATCH 16    // pages written per swapscan()
+
+struct {
+    struct spinlock lock;        // Protects next and used
+    uint dev;
+    uint start;                  // First swap block
+    uint n;                      // Number of slots
+    uint next;                   // Where to look for a free slot
+    uchar used[NSWAP];
+    // sleep() and wakeup() take ptable.lock while holding waitlock,
+    // and swapscan() takes lock while holding ptable.lock, so the
+    // two must differ.
+    struct spinlock waitlock;    // Protects want, pass and freed
+    int want;                    // Pages swapwait() callers need
+    int pass;                    // kswapd passes made for them
+    int freed;                   // Pages freed by the last one
+} swap;
+
+// Held while writing pages out, from the moment their PTEs point
+// at swap, and while reading pages in.
+static struct sleeplock swapio;
+
+static void kswapd(void);
+
+// Find the swap area and start kswapd. Called once, from the first
+// process, since reading the super block may sleep.
+void
+swapinit(int dev) {
+    struct superblock sb;
+
+    initlock(&swap.lock, "swap");
+    initlock(&swap.waitlock, "swapwait");
+    initsleeplock(&swapio, "swapio");
+    readsb(dev, &sb);
+    swap.dev = dev;
+    swap.start = sb.swapstart;
+    swap.n = sb.nswap;
+    if (swap.n > NSWAP || swap.start + swap.n * BPP > FSSIZE + SWAPBLOCKS)
+        swap.n = 0;
+    if (swap.n > 0)
+        kthread(kswapd, "kswapd");
+}
+
+// Allocate a swap slot. Returns -1 if swap is full.
+int
+swapalloc(void) {
+    uint i, s;
+
+    acquire(&swap.lock);
+    for (i = 0; i < swap.n; i++) {
+        s = (swap.next + i) % swap.n;
+        if (!swap.used[s]) {
+            swap.used[s] = 1;
+            swap.next = s + 1;
+            release(&swap.lock);
+            return s;
+        }
+    }
+    release(&swap.lock);
+    return -1;
+}
+
+void
+swapfree(uint s) {
+    acquire(&swap.lock);
+    if (s >= swap.n || !swap.used[s])
+        panic("swapfree");
+    swap.used[s] = 0;
+    release(&swap.lock);
+}
+
+// Read or write the page at mem from or to slot s.
+// Caller holds swapio.
+static void
+rwslot(uint s, char *mem, int write) {
+    struct buf *b;
+    int i;
+
+    for (i = 0; i < BPP; i++) {
+        if (write) {
+            // The block is overwritten whole: don't read it first.
+            b = bgetw(swap.dev, swap.start + s * BPP + i);
+            memmove(b->data, mem + i * BSIZE, BSIZE);
+            bwrite(b);
+        } else {
+            b = bread(swap.dev, swap.start + s * BPP + i);
+            memmove(mem + i * BSIZE, b->data, BSIZE);
+        }
+        brelse(b);
+    }
+}
+
+// Copy the page in slot s to mem, leaving the slot in use.
+void
+swapread(uint s, char *mem) {
+    acquiresleep(&swapio);
+    rwslot(s, mem, 0);
+    releasesleep(&swapio);
+}
+
+// Ask kswapd to free n pages beyond its usual target and wait for
+// it to try. Called by a process that could not allocate memory.
+// Returns 0 if it is worth retrying the allocation: kswapd freed
+// some pages, or n are free anyway. Returns -1 if not, or if the
+// caller was killed.
+int
+swapwait(int n) {
+    int pass, freed;
+
+    if (swap.n == 0)
+        return -1;
+    acquire(&swap.waitlock);
+    swap.want += n;
+    pass = swap.pass;
+    while (swap.pass == pass) {
+        if (myproc()->killed) {
+            release(&swap.waitlock);
+            return -1;
+        }
+        sleep(&swap.pass, &swap.waitlock);
+    }
+    freed = swap.freed;
+    release(&swap.waitlock);
+    return (freed > 0 || kfreecount() >= n) ? 0 : -1;
+}
+
+// Swap in the page at user address va of pgdir, if it is still
+// swapped out. Returns 0 if the page is present, -1 if not.
+int
+swapin(pde_t *pgdir, uint va) {
+    pte_t *pte;
+    char *mem;
+    uint s;
+
+    while ((mem = kalloc()) == 0)
+        if (swapwait(1) < 0)
+            return -1;
+    acquiresleep(&swapio);
+    pte = walkpgdir(pgdir, (char *) va, 0);
+    if (pte == 0 || !(*pte & PTE_SWAP)) {
+        // Another thread on this page table brought it in.
+        releasesleep(&swapio);
+        kfree(mem);
+        return (pte && (*pte & PTE_P)) ? 0 : -1;
+    }
+    s = PTE_ADDR(*pte) / PGSIZE;
+    rwslot(s, mem, 0);
+    *pte = V2P(mem) | (PTE_FLAGS(*pte) & ~PTE_SWAP) | PTE_P;
+    releasesleep(&swapio);
+    swapfree(s);
+    return 0;
+}
+
+// Handle a page fault at va by the current process.
+// Returns 0 if va was swapped out and is now back in.
+int
+swapfault(uint va) {
+    struct proc *p = myproc();
+    pte_t *pte;
+
+    if (va >= p->sz)
+        return -1;
+    pte = walkpgdir(p->pgdir, (char *) va, 0);
+    if (pte == 0 || !(*pte & PTE_SWAP))
+        return -1;
+    return swapin(p->pgdir, va);
+}
+
+// Swap in any swapped-out pages of [va, va+len) in pgdir.
+// The range must lie below the process size.
+int
+swapinrange(pde_t *pgdir, uint va, uint len) {
+    pte_t *pte;
+    uint a;
+
+    for (a = PGROUNDDOWN(va); a < va + len; a += PGSIZE) {
+        pte = walkpgdir(pgdir, (char *) a, 0);
+        if (pte && (*pte & PTE_SWAP) && swapin(pgdir, a) < 0)
+            return -1;
+    }
+    return 0;
+}
+
+// Page out up to n pages. Returns the number freed.
+static int
+swapout(int n) {
+    char *mem[SWAPBATCH];
+    uint slot[SWAPBATCH];
+    int i, k, freed;
+
+    for (freed = 0; freed < n; freed += k) {
+        acquiresleep(&swapio);
+        k = swapscan(mem, slot, n - freed < SWAPBATCH ? n - freed : SWAPBATCH);
+        for (i = 0; i < k; i++)
+            rwslot(slot[i], mem[i], 1);
+        releasesleep(&swapio);
+        for (i = 0; i < k; i++)
+            kfree(mem[i]);
+        if (k == 0)
+            break;
+    }
+    return freed;
+}
+
+// The swap daemon. Checks free memory every tick.
+static void
+kswapd(void) {
+    int want, freed;
+
+    for (;;) {
+        acquire(&swap.waitlock);
+        want = swap.want;
+        swap.want = 0;
+        release(&swap.waitlock);
+
+        freed = 0;
+        if (want > 0 || kfreecount() < SWAPLOW)
+            freed = swapout(want + SWAPHIGH - kfreecount());
+
+        if (want > 0) {
+            acquire(&swap.waitlock);
+            swap.freed = freed;
+            swap.pass++;
+            wakeup(&swap.pass);
+            release(&swap.waitlock);
+        }
+        if (swap.want == 0)
+            timersleep(1);
+    }
+}
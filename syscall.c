@@ -6,6 +6,8 @@
 #include "proc.h"
 #include "x86.h"
 #include "syscall.h"
+#include "ring.h"
+#include "scstat.h"
 
 // User code makes a system call with INT T_SYSCALL.
 // System call number in %eax.
@@ -49,22 +51,48 @@ argint(int n, int *ip) {
     return fetchint((myproc()->tf->esp) + 4 + 4 * n, ip);
 }
 
-// Fetch the nth word-sized system call argument as a pointer
-// to a block of memory of size bytes.  Check that the pointer
-// lies within the process address space.
+// Check that the block of size bytes at addr lies within the
+// process address space. Beyond the program image, the block must
+// lie in mmap() regions. Either way, bring its pages in now: the
+// kernel may use the block while holding a spinlock, when it
+// cannot fault.
 int
-argptr(int n, char **pp, int size) {
-    int i;
+fetchbuf(uint addr, int size, int write) {
     struct proc *curproc = myproc();
 
+    if (size < 0)
+        return -1;
+    if (addr >= curproc->sz || addr + size > curproc->sz)
+        return mmapprefault(addr, size, write);
+    return swapinrange(curproc->pgdir, addr, size);
+}
+
+static int
+fetchptr(int n, char **pp, int size, int write) {
+    int i;
+
     if (argint(n, &i) < 0)
         return -1;
-    if (size < 0 || (uint) i >= curproc->sz || (uint) i + size > curproc->sz)
+    if (fetchbuf(i, size, write) < 0)
         return -1;
     *pp = (char *) i;
     return 0;
 }
 
+// Fetch the nth word-sized system call argument as a pointer
+// to a block of memory of size bytes.  Check that the pointer
+// lies within the process address space.
+int
+argptr(int n, char **pp, int size) {
+    return fetchptr(n, pp, size, 0);
+}
+
+// Like argptr(), for a block the kernel will write to.
+int
+argptrw(int n, char **pp, int size) {
+    return fetchptr(n, pp, size, 1);
+}
+
 // Fetch the nth word-sized system call argument as a string pointer.
 // Check that the pointer is valid and the string is nul-terminated.
 // (There is no shared writable memory, so the string can't change
@@ -119,6 +147,40 @@ extern int sys_write(void);
 
 extern int sys_uptime(void);
 
+extern int sys_clone(void);
+
+extern int sys_join(void);
+
+extern int sys_futex(void);
+
+extern int sys_yield(void);
+
+extern int sys_lockstat(void);
+
+extern int sys_lockhammer(void);
+
+extern int sys_vmsplice(void);
+
+extern int sys_hsbrk(void);
+
+extern int sys_mmap(void);
+
+extern int sys_munmap(void);
+
+extern int sys_ringenter(void);
+
+extern int sys_readv(void);
+
+extern int sys_writev(void);
+
+extern int sys_pread(void);
+
+extern int sys_pwrite(void);
+
+extern int sys_prof(void);
+
+extern int sys_scstat(void);
+
 static int (*syscalls[])(void) = {
         [SYS_fork]    = sys_fork,
         [SYS_exit]    = sys_exit,
@@ -141,16 +203,148 @@ static int (*syscalls[])(void) = {
         [SYS_link]    = sys_link,
         [SYS_mkdir]   = sys_mkdir,
         [SYS_close]   = sys_close,
+        [SYS_clone]   = sys_clone,
+        [SYS_join]    = sys_join,
+        [SYS_futex]   = sys_futex,
+        [SYS_yield]   = sys_yield,
+        [SYS_lockstat] = sys_lockstat,
+        [SYS_lockhammer] = sys_lockhammer,
+        [SYS_vmsplice] = sys_vmsplice,
+        [SYS_hsbrk] = sys_hsbrk,
+        [SYS_mmap] = sys_mmap,
+        [SYS_munmap] = sys_munmap,
+        [SYS_ringenter] = sys_ringenter,
+        [SYS_readv] = sys_readv,
+        [SYS_writev] = sys_writev,
+        [SYS_pread] = sys_pread,
+        [SYS_pwrite] = sys_pwrite,
+        [SYS_prof] = sys_prof,
+        [SYS_scstat] = sys_scstat,
+};
+
+// System calls ringenter() may run.
+static char ringok[] = {
+        [SYS_read]    = 1,
+        [SYS_write]   = 1,
+        [SYS_open]    = 1,
+        [SYS_close]   = 1,
+        [SYS_fstat]   = 1,
+        [SYS_dup]     = 1,
+        [SYS_readv]   = 1,
+        [SYS_writev]  = 1,
+        [SYS_pread]   = 1,
+        [SYS_pwrite]  = 1,
 };
 
+// Run up to n requests queued in the ring at argument 0 (see ring.h).
+// Each goes through syscalls[] with the saved user %esp pointed at
+// the request, so that argint() finds its arguments just as for an
+// ordinary call. Stops early if the completion queue fills or the
+// process is killed. Returns the number of requests run.
+int
+sys_ringenter(void) {
+    struct proc *curproc = myproc();
+    struct ring *r;
+    struct sqe *e;
+    struct cqe *c;
+    uint esp, head;
+    int n, done, op, res;
+
+    if (argptrw(0, (char **) &r, sizeof(*r)) < 0 || argint(1, &n) < 0)
+        return -1;
+    // argint() only reads the program image, not mmap() regions.
+    if ((uint) r + sizeof(*r) > curproc->sz)
+        return -1;
+
+    esp = curproc->tf->esp;
+    for (done = 0; done < n && !curproc->killed; done++) {
+        head = r->sqhead;
+        if (head == r->sqtail || r->cqtail - r->cqhead >= RINGSIZE)
+            break;
+        e = &r->sq[head % RINGSIZE];
+        op = e->op;
+        if (op > 0 && op < NELEM(ringok) && ringok[op]) {
+            curproc->tf->esp = (uint) e;
+            res = syscalls[op]();
+            curproc->tf->esp = esp;
+        } else
+            res = -1;
+        c = &r->cq[r->cqtail % RINGSIZE];
+        c->res = res;
+        c->data = e->data;
+        r->cqtail++;
+        r->sqhead = head + 1;
+    }
+    return done;
+}
+
+// System call counters since boot. Each CPU updates its own,
+// so they need no lock; getscstats() adds them up.
+static struct scstat cpustats[NCPU][NSCSTAT];
+
+// Add count calls taking hi:lo cycles in all, the longest
+// taking max, to st.
+static void
+scadd(struct scstat *st, uint count, uint lo, uint hi, uint max) {
+    st->count += count;
+    st->totlo += lo;
+    st->tothi += hi + (st->totlo < lo);
+    if (max > st->max)
+        st->max = max;
+}
+
+// Charge a call of system call num, which took t cycles,
+// to this CPU and to process p.
+static void
+scaccount(struct proc *p, int num, unsigned long long t) {
+    uint lo, hi, max;
+
+    lo = t;
+    hi = t >> 32;
+    max = hi ? 0xffffffff : lo;
+    pushcli();
+    scadd(&cpustats[cpuid()][num], 1, lo, hi, max);
+    popcli();
+    scadd(&p->scstat[num], 1, lo, hi, max);
+}
+
+// Copy the first n system call counters to st: those of the
+// process with the given pid, or if pid is 0, the totals since
+// boot. Returns the number copied, or -1 if there is no such
+// process.
+int
+getscstats(int pid, struct scstat *st, int n) {
+    struct scstat *c;
+    int i, num;
+
+    if (n > NSCSTAT)
+        n = NSCSTAT;
+    if (pid != 0)
+        return procscstat(pid, st, n);
+    memset(st, 0, n * sizeof(*st));
+    for (i = 0; i < ncpu; i++) {
+        for (num = 0; num < n; num++) {
+            c = &cpustats[i][num];
+            scadd(&st[num], c->count, c->totlo, c->tothi, c->max);
+        }
+    }
+    return n;
+}
+
 void
 syscall(void) {
     int num;
+    unsigned long long t0, t1;
     struct proc *curproc = myproc();
 
     num = curproc->tf->eax;
     if (num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+        t0 = rdtsc64();
         curproc->tf->eax = syscalls[num]();
+        // The call may have moved to a CPU whose counter is behind.
+        t1 = rdtsc64();
+        if (num < NSCSTAT)
+            scaccount(curproc, num, t1 > t0 ? t1 - t0 : 0);
     } else {
         cprintf("%d %s: unknown sys call %d\n",
                 curproc->pid, curproc->name, num);
@@ -20,3 +20,20 @@
 #define SYS_link   19
 #define SYS_mkdir  20
 #define SYS_close  21
+#define SYS_clone  22
+#define SYS_join   23
+#define SYS_futex  24
+#define SYS_yield  25
+#define SYS_lockstat 26
+#define SYS_lockhammer 27
+#define SYS_vmsplice 28
+#define SYS_hsbrk 29
+#define SYS_mmap 30
+#define SYS_munmap 31
+#define SYS_ringenter 32
+#define SYS_readv 33
+#define SYS_writev 34
+#define SYS_pread 35
+#define SYS_pwrite 36
+#define SYS_prof 37
+#define SYS_scstat 38
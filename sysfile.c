@@ -15,6 +15,8 @@
 #include "sleeplock.h"
 #include "file.h"
 #include "fcntl.h"
+#include "mmap.h"
+#include "uio.h"
 
 // Fetch the nth word-sized system call argument as a file descriptor
 // and return both the descriptor and the corresponding struct file.
@@ -73,7 +75,7 @@ sys_read(void)
   int n;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptrw(1, &p, n) < 0)
     return -1;
   return fileread(f, p, n);
 }
@@ -90,6 +92,81 @@ sys_write(void)
   return filewrite(f, p, n);
 }
 
+// Fetch the iovec array at argument n, of length argument n+1,
+// into iov, checking each buffer. Returns the number of buffers.
+static int
+argiov(int n, struct iovec *iov, int write)
+{
+  struct iovec *uiov;
+  int i, cnt, tot;
+
+  if(argint(n+1, &cnt) < 0 || cnt < 0 || cnt > IOV_MAX)
+    return -1;
+  if(argptr(n, (void*)&uiov, cnt*sizeof(*uiov)) < 0)
+    return -1;
+  // Copy first, so the buffers can't change after the check.
+  memmove(iov, uiov, cnt*sizeof(*uiov));
+  for(i = tot = 0; i < cnt; i++){
+    if(fetchbuf((uint)iov[i].base, iov[i].len, write) < 0)
+      return -1;
+    if(tot + iov[i].len < tot)
+      return -1;
+    tot += iov[i].len;
+  }
+  return cnt;
+}
+
+int
+sys_readv(void)
+{
+  struct file *f;
+  struct iovec iov[IOV_MAX];
+  int cnt;
+
+  if(argfd(0, 0, &f) < 0 || (cnt = argiov(1, iov, 1)) < 0)
+    return -1;
+  return filereadv(f, iov, cnt, -1);
+}
+
+int
+sys_writev(void)
+{
+  struct file *f;
+  struct iovec iov[IOV_MAX];
+  int cnt;
+
+  if(argfd(0, 0, &f) < 0 || (cnt = argiov(1, iov, 0)) < 0)
+    return -1;
+  return filewritev(f, iov, cnt, -1);
+}
+
+// Read or write at an offset, leaving the file offset alone.
+int
+sys_pread(void)
+{
+  struct file *f;
+  struct iovec iov;
+  int off;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &iov.len) < 0 ||
+     argptrw(1, (void*)&iov.base, iov.len) < 0 || argint(3, &off) < 0 || off < 0)
+    return -1;
+  return filereadv(f, &iov, 1, off);
+}
+
+int
+sys_pwrite(void)
+{
+  struct file *f;
+  struct iovec iov;
+  int off;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &iov.len) < 0 ||
+     argptr(1, (void*)&iov.base, iov.len) < 0 || argint(3, &off) < 0 || off < 0)
+    return -1;
+  return filewritev(f, &iov, 1, off);
+}
+
 int
 sys_close(void)
 {
@@ -109,7 +186,7 @@ sys_fstat(void)
   struct file *f;
   struct stat *st;
 
-  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+  if(argfd(0, 0, &f) < 0 || argptrw(1, (void*)&st, sizeof(*st)) < 0)
     return -1;
   return filestat(f, st);
 }
@@ -427,7 +504,7 @@ sys_pipe(void)
   struct file *rf, *wf;
   int fd0, fd1;
 
-  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+  if(argptrw(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
     return -1;
   if(pipealloc(&rf, &wf) < 0)
     return -1;
@@ -443,3 +520,45 @@ sys_pipe(void)
   fd[1] = fd1;
   return 0;
 }
+
+int
+sys_vmsplice(void)
+{
+  struct file *f;
+  int n;
+  char *p;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+    return -1;
+  if(f->type != FD_PIPE || f->writable == 0)
+    return -1;
+  return pipesplice(f->pipe, p, n);
+}
+
+int
+sys_mmap(void)
+{
+  int len, prot, flags, off;
+  struct file *f;
+
+  // The address hint, argument 0, is ignored.
+  if(argint(1, &len) < 0 || argint(2, &prot) < 0 ||
+     argint(3, &flags) < 0 || argint(5, &off) < 0)
+    return -1;
+  if(len <= 0 || off < 0)
+    return -1;
+  f = 0;
+  if(!(flags & MAP_ANON) && argfd(4, 0, &f) < 0)
+    return -1;
+  return mmap(len, prot, flags, f, off);
+}
+
+int
+sys_munmap(void)
+{
+  int addr, len;
+
+  if(argint(0, &addr) < 0 || argint(1, &len) < 0 || len <= 0)
+    return -1;
+  return munmap(addr, len);
+}
@@ -6,6 +6,10 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "futex.h"
+#include "lockstat.h"
+#include "prof.h"
+#include "scstat.h"
 
 int
 sys_fork(void)
@@ -51,7 +55,23 @@ sys_sbrk(void)
   if(argint(0, &n) < 0)
     return -1;
   addr = myproc()->sz;
-  if(growproc(n) < 0)
+  if(growproc(n, 0) < 0)
+    return -1;
+  return addr;
+}
+
+// Like sbrk(), but back whole 4MB-aligned stretches of the new
+// memory with 4MB pages while any are left.
+int
+sys_hsbrk(void)
+{
+  int addr;
+  int n;
+
+  if(argint(0, &n) < 0)
+    return -1;
+  addr = myproc()->sz;
+  if(growproc(n, 1) < 0)
     return -1;
   return addr;
 }
@@ -60,21 +80,10 @@ int
 sys_sleep(void)
 {
   int n;
-  uint ticks0;
 
   if(argint(0, &n) < 0)
     return -1;
-  acquire(&tickslock);
-  ticks0 = ticks;
-  while(ticks - ticks0 < n){
-    if(myproc()->killed){
-      release(&tickslock);
-      return -1;
-    }
-    sleep(&ticks, &tickslock);
-  }
-  release(&tickslock);
-  return 0;
+  return timersleep(n);
 }
 
 // return how many clock tick interrupts have occurred
@@ -89,3 +98,125 @@ sys_uptime(void)
   release(&tickslock);
   return xticks;
 }
+
+int
+sys_clone(void)
+{
+  int fn, arg, stack;
+
+  if(argint(0, &fn) < 0 || argint(1, &arg) < 0 || argint(2, &stack) < 0)
+    return -1;
+  return clone((void(*)(void*))fn, (void*)arg, (char*)stack);
+}
+
+int
+sys_join(void)
+{
+  char **stack;
+
+  if(argptrw(0, (void*)&stack, sizeof(*stack)) < 0)
+    return -1;
+  return join(stack);
+}
+
+int
+sys_futex(void)
+{
+  int *addr;
+  int op, val;
+
+  if(argptr(0, (void*)&addr, sizeof(*addr)) < 0 ||
+     argint(1, &op) < 0 || argint(2, &val) < 0)
+    return -1;
+  if((uint)addr % sizeof(*addr) != 0)
+    return -1;
+  switch(op){
+  case FUTEX_WAIT:
+    return futexwait(addr, val);
+  case FUTEX_WAKE:
+    return futexwake(addr, val);
+  }
+  return -1;
+}
+
+int
+sys_yield(void)
+{
+  yield();
+  return 0;
+}
+
+// Copy up to n per-name spin-lock statistics entries
+// to the user buffer; return how many were copied.
+int
+sys_lockstat(void)
+{
+  struct lockstat *st;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0)
+    return -1;
+  if(n > NLOCKSTAT)
+    n = NLOCKSTAT;
+  if(argptrw(0, (void*)&st, n*sizeof(*st)) < 0)
+    return -1;
+  return getlockstats(st, n);
+}
+
+// Hammer a kernel test lock n times; ticket selects a ticket
+// lock rather than test-and-set. Returns kilocycles taken.
+int
+sys_lockhammer(void)
+{
+  int ticket, n;
+
+  if(argint(0, &ticket) < 0 || argint(1, &n) < 0)
+    return -1;
+  return lockhammer(ticket, n);
+}
+
+// prof(cmd, buf, n): start or stop the sampling profiler, or
+// read up to n samples into buf. See prof.h.
+int
+sys_prof(void)
+{
+  struct sample *buf;
+  int cmd, n;
+
+  if(argint(0, &cmd) < 0)
+    return -1;
+  switch(cmd){
+  case PROF_START:
+    profstart();
+    return 0;
+  case PROF_STOP:
+    return profstop();
+  case PROF_READ:
+    if(argint(2, &n) < 0 || n < 0)
+      return -1;
+    if(n > NCPU*NSAMPLE)
+      n = NCPU*NSAMPLE;
+    if(argptrw(1, (void*)&buf, n*sizeof(*buf)) < 0)
+      return -1;
+    return profread(buf, n);
+  }
+  return -1;
+}
+
+// Copy up to n system call counters of process pid, or the
+// totals since boot if pid is 0, to the user buffer; return
+// how many were copied.
+int
+sys_scstat(void)
+{
+  struct scstat *st;
+  int pid, n;
+
+  if(argint(0, &pid) < 0 || argint(2, &n) < 0 || n < 0)
+    return -1;
+  if(n > NSCSTAT)
+    n = NSCSTAT;
+  if(argptrw(1, (void*)&st, n*sizeof(*st)) < 0)
+    return -1;
+  return getscstats(pid, st, n);
+}
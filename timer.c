@@ -0,0 +1,144 @@
+// Sleep timers.
+//
+// Each CPU keeps a timer wheel of processes sleeping in sys_sleep(),
+// hashed by wake-up tick. A CPU expires its own wheel on every timer
+// interrupt and wakes only the processes whose deadline has come,
+// instead of every sleeper re-checking ticks on every tick.
+//
+// CPU 0 keeps the periodic timer because it advances ticks. Other
+// CPUs with nothing to run stop the periodic timer, program a single
+// interrupt for the earliest deadline on their wheel, and halt.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "proc.h"
+#include "spinlock.h"
+
+#define NSLOT 64
+
+struct wheel {
+    struct spinlock lock;
+    uint next;                   // Next tick to expire
+    int n;                       // Number of queued processes
+    struct proc *slot[NSLOT];    // Queued processes, by deadline % NSLOT
+};
+
+static struct wheel wheels[NCPU];
+
+void
+timerinit(void) {
+    struct wheel *w;
+
+    for (w = wheels; w < &wheels[NCPU]; w++)
+        initlock(&w->lock, "timer");
+}
+
+// Remove p from its wheel. Caller holds the wheel's lock.
+static void
+dequeue(struct proc *p) {
+    struct wheel *w = p->wheel;
+    struct proc **pp;
+
+    for (pp = &w->slot[p->deadline % NSLOT]; *pp; pp = &(*pp)->tnext) {
+        if (*pp == p) {
+            *pp = p->tnext;
+            p->wheel = 0;
+            w->n--;
+            return;
+        }
+    }
+    panic("timer dequeue");
+}
+
+// Sleep for n ticks. Returns -1 if killed before the time is up.
+int
+timersleep(int n) {
+    struct proc *p = myproc();
+    struct wheel *w;
+
+    if (n <= 0)
+        return 0;
+
+    pushcli();
+    w = &wheels[cpuid()];
+    popcli();
+
+    acquire(&w->lock);
+    p->deadline = ticks + n;
+    p->wheel = w;
+    p->tnext = w->slot[p->deadline % NSLOT];
+    w->slot[p->deadline % NSLOT] = p;
+    w->n++;
+    while (p->wheel && !p->killed)
+        sleep(&p->deadline, &w->lock);
+    if (p->wheel)
+        dequeue(p);
+    release(&w->lock);
+    return p->killed ? -1 : 0;
+}
+
+// Wake the processes on this CPU's wheel whose deadline has passed.
+// Called on every timer interrupt.
+void
+timerexpire(void) {
+    struct wheel *w = &wheels[cpuid()];
+    struct proc *p, *next;
+    uint now = ticks;
+    int i;
+
+    acquire(&w->lock);
+    // A halted CPU may have missed many ticks; visiting each slot
+    // once covers them all.
+    for (i = 0; w->n > 0 && i < NSLOT && (int) (now - w->next) >= 0; i++) {
+        for (p = w->slot[w->next % NSLOT]; p; p = next) {
+            next = p->tnext;
+            if ((int) (p->deadline - now) <= 0) {
+                dequeue(p);
+                wakeup(&p->deadline);
+            }
+        }
+        w->next++;
+    }
+    if ((int) (now - w->next) >= 0)
+        w->next = now + 1;
+    release(&w->lock);
+}
+
+// Ticks until the earliest deadline on w, or 0 if w is empty.
+static int
+nextdeadline(struct wheel *w) {
+    struct proc *p;
+    int i, d, min;
+
+    min = 0;
+    acquire(&w->lock);
+    for (i = 0; w->n > 0 && i < NSLOT; i++) {
+        for (p = w->slot[i]; p; p = p->tnext) {
+            d = p->deadline - ticks;
+            if (d < 1)
+                d = 1;
+            if (min == 0 || d < min)
+                min = d;
+        }
+    }
+    release(&w->lock);
+    return min;
+}
+
+// Halt this CPU until the next interrupt. Called by scheduler()
+// with interrupts disabled; returns with them disabled.
+void
+timeridle(void) {
+    int id = cpuid();
+
+    if (id != 0)
+        lapiconeshot(nextdeadline(&wheels[id]));
+    stihlt();
+    cli();
+    if (id != 0)
+        lapicperiodic();
+}
@@ -0,0 +1,4065 @@
+
+_tlbbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return t1 - t0;
+}
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "tlbbench: %d MB, %d rounds\n", SZ / (1024*1024), ROUNDS);
+      11:	68 c8 00 00 00       	push   $0xc8
+      16:	6a 0c                	push   $0xc
+      18:	68 01 1e 00 00       	push   $0x1e01
+      1d:	6a 01                	push   $0x1
+      1f:	e8 3c 09 00 00       	call   960 <printf>
+  printf(1, "4KB pages: %d ticks\n", run(sbrk));
+      24:	c7 04 24 e4 05 00 00 	movl   $0x5e4,(%esp)
+      2b:	e8 40 00 00 00       	call   70 <run>
+      30:	83 c4 0c             	add    $0xc,%esp
+      33:	50                   	push   %eax
+      34:	68 1d 1e 00 00       	push   $0x1e1d
+      39:	6a 01                	push   $0x1
+      3b:	e8 20 09 00 00       	call   960 <printf>
+  printf(1, "4MB pages: %d ticks\n", run(hsbrk));
+      40:	c7 04 24 6b 06 00 00 	movl   $0x66b,(%esp)
+      47:	e8 24 00 00 00       	call   70 <run>
+      4c:	83 c4 0c             	add    $0xc,%esp
+      4f:	50                   	push   %eax
+      50:	68 32 1e 00 00       	push   $0x1e32
+      55:	6a 01                	push   $0x1
+      57:	e8 04 09 00 00       	call   960 <printf>
+  exit();
+      5c:	e8 3f 01 00 00       	call   1a0 <exit>
+      61:	66 90                	xchg   %ax,%ax
+      63:	66 90                	xchg   %ax,%ax
+      65:	66 90                	xchg   %ax,%ax
+      67:	66 90                	xchg   %ax,%ax
+      69:	66 90                	xchg   %ax,%ax
+      6b:	66 90                	xchg   %ax,%ax
+      6d:	66 90                	xchg   %ax,%ax
+      6f:	90                   	nop
+
+00000070 <run>:
+{
+      70:	55                   	push   %ebp
+      71:	89 e5                	mov    %esp,%ebp
+      73:	57                   	push   %edi
+      74:	56                   	push   %esi
+      75:	53                   	push   %ebx
+      76:	83 ec 28             	sub    $0x28,%esp
+  cur = sbrk(0);
+      79:	6a 00                	push   $0x0
+      7b:	e8 64 05 00 00       	call   5e4 <sbrk>
+      80:	89 c2                	mov    %eax,%edx
+  sbrk(HPGROUNDUP((uint)cur) - (uint)cur);
+      82:	05 ff ff 3f 00       	add    $0x3fffff,%eax
+      87:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+      8c:	29 d0                	sub    %edx,%eax
+      8e:	89 04 24             	mov    %eax,(%esp)
+      91:	e8 4e 05 00 00       	call   5e4 <sbrk>
+  if((base = grow(SZ)) == (char*)-1){
+      96:	c7 04 24 00 00 c0 00 	movl   $0xc00000,(%esp)
+      9d:	ff 55 08             	call   *0x8(%ebp)
+      a0:	83 c4 10             	add    $0x10,%esp
+      a3:	83 f8 ff             	cmp    $0xffffffff,%eax
+      a6:	74 7b                	je     123 <run+0xb3>
+      a8:	89 c6                	mov    %eax,%esi
+      pg = (pg + STRIDE) % npg;
+      aa:	bf ab aa aa aa       	mov    $0xaaaaaaab,%edi
+  t0 = uptime();
+      af:	e8 1c 04 00 00       	call   4d0 <uptime>
+      b4:	c7 45 e4 c8 00 00 00 	movl   $0xc8,-0x1c(%ebp)
+      bb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      be:	66 90                	xchg   %ax,%ax
+{
+      c0:	b9 00 0c 00 00       	mov    $0xc00,%ecx
+    pg = 0;
+      c5:	31 d2                	xor    %edx,%edx
+      c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      ce:	66 90                	xchg   %ax,%ax
+      (*(volatile int*)(base + pg*PGSIZE))++;
+      d0:	89 d0                	mov    %edx,%eax
+      d2:	c1 e0 0c             	shl    $0xc,%eax
+      d5:	01 f0                	add    %esi,%eax
+      d7:	8b 18                	mov    (%eax),%ebx
+      d9:	83 c3 01             	add    $0x1,%ebx
+      dc:	89 18                	mov    %ebx,(%eax)
+      pg = (pg + STRIDE) % npg;
+      de:	8d 9a 7f 01 00 00    	lea    0x17f(%edx),%ebx
+      e4:	89 d8                	mov    %ebx,%eax
+      e6:	f7 e7                	mul    %edi
+      e8:	c1 ea 0b             	shr    $0xb,%edx
+      eb:	8d 04 52             	lea    (%edx,%edx,2),%eax
+      ee:	c1 e0 0a             	shl    $0xa,%eax
+      f1:	29 c3                	sub    %eax,%ebx
+      f3:	89 da                	mov    %ebx,%edx
+    for(i = 0; i < npg; i++){
+      f5:	83 e9 01             	sub    $0x1,%ecx
+      f8:	75 d6                	jne    d0 <run+0x60>
+  for(r = 0; r < ROUNDS; r++){
+      fa:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+      fe:	75 c0                	jne    c0 <run+0x50>
+  t1 = uptime();
+     100:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+     103:	e8 c8 03 00 00       	call   4d0 <uptime>
+  sbrk(-SZ);
+     108:	83 ec 0c             	sub    $0xc,%esp
+     10b:	68 00 00 40 ff       	push   $0xff400000
+  t1 = uptime();
+     110:	89 c6                	mov    %eax,%esi
+  sbrk(-SZ);
+     112:	e8 cd 04 00 00       	call   5e4 <sbrk>
+}
+     117:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return t1 - t0;
+     11a:	89 f0                	mov    %esi,%eax
+     11c:	29 d8                	sub    %ebx,%eax
+}
+     11e:	5b                   	pop    %ebx
+     11f:	5e                   	pop    %esi
+     120:	5f                   	pop    %edi
+     121:	5d                   	pop    %ebp
+     122:	c3                   	ret
+    printf(2, "tlbbench: out of memory\n");
+     123:	50                   	push   %eax
+     124:	50                   	push   %eax
+     125:	68 e8 1d 00 00       	push   $0x1de8
+     12a:	6a 02                	push   $0x2
+     12c:	e8 2f 08 00 00       	call   960 <printf>
+    exit();
+     131:	e8 6a 00 00 00       	call   1a0 <exit>
+     136:	66 90                	xchg   %ax,%ax
+     138:	66 90                	xchg   %ax,%ax
+     13a:	66 90                	xchg   %ax,%ax
+     13c:	66 90                	xchg   %ax,%ax
+     13e:	66 90                	xchg   %ax,%ax
+
+00000140 <fork>:
+int sysexit(void) __attribute__((noreturn));
+
+int
+fork(void)
+{
+  if(flushhook)
+     140:	a1 20 29 00 00       	mov    0x2920,%eax
+     145:	85 c0                	test   %eax,%eax
+     147:	74 17                	je     160 <fork+0x20>
+{
+     149:	55                   	push   %ebp
+     14a:	89 e5                	mov    %esp,%ebp
+     14c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     14f:	ff d0                	call   *%eax
+  return sysfork();
+}
+     151:	c9                   	leave
+  return sysfork();
+     152:	e9 7f 03 00 00       	jmp    4d6 <sysfork>
+     157:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     15e:	66 90                	xchg   %ax,%ax
+     160:	e9 71 03 00 00       	jmp    4d6 <sysfork>
+     165:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     16c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000170 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+     170:	55                   	push   %ebp
+  if(flushhook)
+     171:	a1 20 29 00 00       	mov    0x2920,%eax
+{
+     176:	89 e5                	mov    %esp,%ebp
+     178:	56                   	push   %esi
+     179:	53                   	push   %ebx
+     17a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     17d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     180:	85 c0                	test   %eax,%eax
+     182:	74 02                	je     186 <exec+0x16>
+    flushhook();
+     184:	ff d0                	call   *%eax
+  return sysexec(path, argv);
+     186:	89 75 0c             	mov    %esi,0xc(%ebp)
+     189:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     18c:	5b                   	pop    %ebx
+     18d:	5e                   	pop    %esi
+     18e:	5d                   	pop    %ebp
+  return sysexec(path, argv);
+     18f:	e9 ba 03 00 00       	jmp    54e <sysexec>
+     194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     19f:	90                   	nop
+
+000001a0 <exit>:
+
+int
+exit(void)
+{
+     1a0:	55                   	push   %ebp
+     1a1:	89 e5                	mov    %esp,%ebp
+     1a3:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     1a6:	a1 20 29 00 00       	mov    0x2920,%eax
+     1ab:	85 c0                	test   %eax,%eax
+     1ad:	74 02                	je     1b1 <exit+0x11>
+    flushhook();
+     1af:	ff d0                	call   *%eax
+  sysexit();
+     1b1:	e8 2f 03 00 00       	call   4e5 <sysexit>
+     1b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001c0 <strcpy>:
+}
+
+char*
+strcpy(char *s, const char *t)
+{
+     1c0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     1c1:	31 c0                	xor    %eax,%eax
+{
+     1c3:	89 e5                	mov    %esp,%ebp
+     1c5:	53                   	push   %ebx
+     1c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     1c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     1cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     1d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     1d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     1d7:	83 c0 01             	add    $0x1,%eax
+     1da:	84 d2                	test   %dl,%dl
+     1dc:	75 f2                	jne    1d0 <strcpy+0x10>
+    ;
+  return os;
+}
+     1de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1e1:	89 c8                	mov    %ecx,%eax
+     1e3:	c9                   	leave
+     1e4:	c3                   	ret
+     1e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     1f0:	55                   	push   %ebp
+     1f1:	89 e5                	mov    %esp,%ebp
+     1f3:	53                   	push   %ebx
+     1f4:	8b 55 08             	mov    0x8(%ebp),%edx
+     1f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     1fa:	0f b6 02             	movzbl (%edx),%eax
+     1fd:	84 c0                	test   %al,%al
+     1ff:	75 17                	jne    218 <strcmp+0x28>
+     201:	eb 3a                	jmp    23d <strcmp+0x4d>
+     203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     207:	90                   	nop
+     208:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     20c:	83 c2 01             	add    $0x1,%edx
+     20f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     212:	84 c0                	test   %al,%al
+     214:	74 1a                	je     230 <strcmp+0x40>
+    p++, q++;
+     216:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     218:	0f b6 19             	movzbl (%ecx),%ebx
+     21b:	38 c3                	cmp    %al,%bl
+     21d:	74 e9                	je     208 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     21f:	29 d8                	sub    %ebx,%eax
+}
+     221:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     224:	c9                   	leave
+     225:	c3                   	ret
+     226:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     22d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     230:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     234:	31 c0                	xor    %eax,%eax
+     236:	29 d8                	sub    %ebx,%eax
+}
+     238:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     23b:	c9                   	leave
+     23c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     23d:	0f b6 19             	movzbl (%ecx),%ebx
+     240:	31 c0                	xor    %eax,%eax
+     242:	eb db                	jmp    21f <strcmp+0x2f>
+     244:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     24b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     24f:	90                   	nop
+
+00000250 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     250:	55                   	push   %ebp
+     251:	89 e5                	mov    %esp,%ebp
+     253:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     256:	80 3a 00             	cmpb   $0x0,(%edx)
+     259:	74 15                	je     270 <strlen+0x20>
+     25b:	31 c0                	xor    %eax,%eax
+     25d:	8d 76 00             	lea    0x0(%esi),%esi
+     260:	83 c0 01             	add    $0x1,%eax
+     263:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     267:	89 c1                	mov    %eax,%ecx
+     269:	75 f5                	jne    260 <strlen+0x10>
+    ;
+  return n;
+}
+     26b:	89 c8                	mov    %ecx,%eax
+     26d:	5d                   	pop    %ebp
+     26e:	c3                   	ret
+     26f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     270:	31 c9                	xor    %ecx,%ecx
+}
+     272:	5d                   	pop    %ebp
+     273:	89 c8                	mov    %ecx,%eax
+     275:	c3                   	ret
+     276:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     27d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000280 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     280:	55                   	push   %ebp
+     281:	89 e5                	mov    %esp,%ebp
+     283:	57                   	push   %edi
+     284:	8b 55 08             	mov    0x8(%ebp),%edx
+            "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt) {
+    asm volatile("cld; rep stosb" :
+     287:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     28a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     28d:	89 d7                	mov    %edx,%edi
+     28f:	fc                   	cld
+     290:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     292:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     295:	89 d0                	mov    %edx,%eax
+     297:	c9                   	leave
+     298:	c3                   	ret
+     299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     2a0:	55                   	push   %ebp
+     2a1:	89 e5                	mov    %esp,%ebp
+     2a3:	8b 45 08             	mov    0x8(%ebp),%eax
+     2a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     2aa:	0f b6 10             	movzbl (%eax),%edx
+     2ad:	84 d2                	test   %dl,%dl
+     2af:	75 12                	jne    2c3 <strchr+0x23>
+     2b1:	eb 1d                	jmp    2d0 <strchr+0x30>
+     2b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2b7:	90                   	nop
+     2b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     2bc:	83 c0 01             	add    $0x1,%eax
+     2bf:	84 d2                	test   %dl,%dl
+     2c1:	74 0d                	je     2d0 <strchr+0x30>
+    if(*s == c)
+     2c3:	38 d1                	cmp    %dl,%cl
+     2c5:	75 f1                	jne    2b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     2c7:	5d                   	pop    %ebp
+     2c8:	c3                   	ret
+     2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     2d0:	31 c0                	xor    %eax,%eax
+}
+     2d2:	5d                   	pop    %ebp
+     2d3:	c3                   	ret
+     2d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2df:	90                   	nop
+
+000002e0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     2e0:	55                   	push   %ebp
+     2e1:	89 e5                	mov    %esp,%ebp
+     2e3:	56                   	push   %esi
+     2e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     2e5:	83 ec 08             	sub    $0x8,%esp
+     2e8:	6a 00                	push   $0x0
+     2ea:	ff 75 08             	push   0x8(%ebp)
+     2ed:	e8 6b 02 00 00       	call   55d <open>
+  if(fd < 0)
+     2f2:	83 c4 10             	add    $0x10,%esp
+     2f5:	85 c0                	test   %eax,%eax
+     2f7:	78 27                	js     320 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     2f9:	83 ec 08             	sub    $0x8,%esp
+     2fc:	ff 75 0c             	push   0xc(%ebp)
+     2ff:	89 c3                	mov    %eax,%ebx
+     301:	50                   	push   %eax
+     302:	e8 83 02 00 00       	call   58a <fstat>
+  close(fd);
+     307:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     30a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     30c:	e8 1f 02 00 00       	call   530 <close>
+  return r;
+     311:	83 c4 10             	add    $0x10,%esp
+}
+     314:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     317:	89 f0                	mov    %esi,%eax
+     319:	5b                   	pop    %ebx
+     31a:	5e                   	pop    %esi
+     31b:	5d                   	pop    %ebp
+     31c:	c3                   	ret
+     31d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     320:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     325:	eb ed                	jmp    314 <stat+0x34>
+     327:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     32e:	66 90                	xchg   %ax,%ax
+
+00000330 <atoi>:
+
+int
+atoi(const char *s)
+{
+     330:	55                   	push   %ebp
+     331:	89 e5                	mov    %esp,%ebp
+     333:	53                   	push   %ebx
+     334:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     337:	0f be 02             	movsbl (%edx),%eax
+     33a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     33d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     340:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     345:	77 1e                	ja     365 <atoi+0x35>
+     347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     34e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     350:	83 c2 01             	add    $0x1,%edx
+     353:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     356:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     35a:	0f be 02             	movsbl (%edx),%eax
+     35d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     360:	80 fb 09             	cmp    $0x9,%bl
+     363:	76 eb                	jbe    350 <atoi+0x20>
+  return n;
+}
+     365:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     368:	89 c8                	mov    %ecx,%eax
+     36a:	c9                   	leave
+     36b:	c3                   	ret
+     36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     370:	55                   	push   %ebp
+     371:	89 e5                	mov    %esp,%ebp
+     373:	57                   	push   %edi
+     374:	56                   	push   %esi
+     375:	8b 45 10             	mov    0x10(%ebp),%eax
+     378:	8b 55 08             	mov    0x8(%ebp),%edx
+     37b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     37e:	85 c0                	test   %eax,%eax
+     380:	7e 13                	jle    395 <memmove+0x25>
+     382:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     384:	89 d7                	mov    %edx,%edi
+     386:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     38d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     390:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     391:	39 f8                	cmp    %edi,%eax
+     393:	75 fb                	jne    390 <memmove+0x20>
+  return vdst;
+}
+     395:	5e                   	pop    %esi
+     396:	89 d0                	mov    %edx,%eax
+     398:	5f                   	pop    %edi
+     399:	5d                   	pop    %ebp
+     39a:	c3                   	ret
+     39b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     39f:	90                   	nop
+
+000003a0 <mutex_init>:
+
+// Futex-based mutex (Drepper, "Futexes Are Tricky", mutex 2).
+// The uncontended paths never enter the kernel.
+void
+mutex_init(struct mutex *m)
+{
+     3a0:	55                   	push   %ebp
+     3a1:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+     3a3:	8b 45 08             	mov    0x8(%ebp),%eax
+     3a6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     3ac:	5d                   	pop    %ebp
+     3ad:	c3                   	ret
+     3ae:	66 90                	xchg   %ax,%ax
+
+000003b0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     3b0:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     3b1:	31 c0                	xor    %eax,%eax
+     3b3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+     3b8:	89 e5                	mov    %esp,%ebp
+     3ba:	56                   	push   %esi
+     3bb:	53                   	push   %ebx
+     3bc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     3bf:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     3c3:	85 c0                	test   %eax,%eax
+     3c5:	74 32                	je     3f9 <mutex_lock+0x49>
+    return;
+  if(c != 2)
+     3c7:	83 f8 02             	cmp    $0x2,%eax
+     3ca:	74 0c                	je     3d8 <mutex_lock+0x28>
+static inline uint
+xchg(volatile uint *addr, uint newval) {
+    uint result;
+
+    // The + in "+m" denotes a read-modify-write operand.
+    asm volatile("lock; xchgl %0, %1" :
+     3cc:	b8 02 00 00 00       	mov    $0x2,%eax
+     3d1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+     3d4:	85 c0                	test   %eax,%eax
+     3d6:	74 21                	je     3f9 <mutex_lock+0x49>
+     3d8:	be 02 00 00 00       	mov    $0x2,%esi
+     3dd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAIT, 2);
+     3e0:	83 ec 04             	sub    $0x4,%esp
+     3e3:	6a 02                	push   $0x2
+     3e5:	6a 00                	push   $0x0
+     3e7:	53                   	push   %ebx
+     3e8:	e8 33 02 00 00       	call   620 <futex>
+     3ed:	89 f0                	mov    %esi,%eax
+     3ef:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     3f2:	83 c4 10             	add    $0x10,%esp
+     3f5:	85 c0                	test   %eax,%eax
+     3f7:	75 e7                	jne    3e0 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+     3f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     3fc:	5b                   	pop    %ebx
+     3fd:	5e                   	pop    %esi
+     3fe:	5d                   	pop    %ebp
+     3ff:	c3                   	ret
+
+00000400 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     400:	55                   	push   %ebp
+     401:	89 e5                	mov    %esp,%ebp
+     403:	83 ec 08             	sub    $0x8,%esp
+     406:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     409:	f0 83 28 01          	lock subl $0x1,(%eax)
+     40d:	75 09                	jne    418 <mutex_unlock+0x18>
+    m->val = 0;
+    futex(&m->val, FUTEX_WAKE, 1);
+  }
+}
+     40f:	c9                   	leave
+     410:	c3                   	ret
+     411:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     418:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     41b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex(&m->val, FUTEX_WAKE, 1);
+     421:	6a 01                	push   $0x1
+     423:	6a 01                	push   $0x1
+     425:	50                   	push   %eax
+     426:	e8 f5 01 00 00       	call   620 <futex>
+     42b:	83 c4 10             	add    $0x10,%esp
+}
+     42e:	c9                   	leave
+     42f:	c3                   	ret
+
+00000430 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     430:	55                   	push   %ebp
+     431:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     433:	8b 45 08             	mov    0x8(%ebp),%eax
+     436:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     43c:	5d                   	pop    %ebp
+     43d:	c3                   	ret
+     43e:	66 90                	xchg   %ax,%ax
+
+00000440 <cond_wait>:
+
+// Release m and wait for a signal, then reacquire m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     440:	55                   	push   %ebp
+     441:	89 e5                	mov    %esp,%ebp
+     443:	57                   	push   %edi
+     444:	56                   	push   %esi
+     445:	53                   	push   %ebx
+     446:	83 ec 0c             	sub    $0xc,%esp
+     449:	8b 75 08             	mov    0x8(%ebp),%esi
+     44c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     44f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     451:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+     455:	75 21                	jne    478 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     457:	83 ec 04             	sub    $0x4,%esp
+     45a:	57                   	push   %edi
+     45b:	6a 00                	push   $0x0
+     45d:	56                   	push   %esi
+     45e:	e8 bd 01 00 00       	call   620 <futex>
+  mutex_lock(m);
+     463:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     466:	83 c4 10             	add    $0x10,%esp
+}
+     469:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     46c:	5b                   	pop    %ebx
+     46d:	5e                   	pop    %esi
+     46e:	5f                   	pop    %edi
+     46f:	5d                   	pop    %ebp
+  mutex_lock(m);
+     470:	e9 3b ff ff ff       	jmp    3b0 <mutex_lock>
+     475:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     478:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     47b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex(&m->val, FUTEX_WAKE, 1);
+     481:	6a 01                	push   $0x1
+     483:	6a 01                	push   $0x1
+     485:	53                   	push   %ebx
+     486:	e8 95 01 00 00       	call   620 <futex>
+     48b:	83 c4 10             	add    $0x10,%esp
+     48e:	eb c7                	jmp    457 <cond_wait+0x17>
+
+00000490 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+     490:	55                   	push   %ebp
+     491:	89 e5                	mov    %esp,%ebp
+     493:	83 ec 0c             	sub    $0xc,%esp
+     496:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     499:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+     49d:	6a 01                	push   $0x1
+     49f:	6a 01                	push   $0x1
+     4a1:	50                   	push   %eax
+     4a2:	e8 79 01 00 00       	call   620 <futex>
+}
+     4a7:	83 c4 10             	add    $0x10,%esp
+     4aa:	c9                   	leave
+     4ab:	c3                   	ret
+     4ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004b0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     4b0:	55                   	push   %ebp
+     4b1:	89 e5                	mov    %esp,%ebp
+     4b3:	83 ec 0c             	sub    $0xc,%esp
+     4b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     4b9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+     4bd:	6a 40                	push   $0x40
+     4bf:	6a 01                	push   $0x1
+     4c1:	50                   	push   %eax
+     4c2:	e8 59 01 00 00       	call   620 <futex>
+}
+     4c7:	83 c4 10             	add    $0x10,%esp
+     4ca:	c9                   	leave
+     4cb:	c3                   	ret
+     4cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004d0 <uptime>:
+// Clock ticks since boot, read from the kernel's vdso page
+// without a system call.
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     4d0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+     4d5:	c3                   	ret
+
+000004d6 <sysfork>:
+  1: ret
+
+#define SYSCALL(name) SYSCALLAS(name, name)
+
+// ulib.c wraps these.
+SYSCALLAS(sysfork, fork)
+     4d6:	b8 01 00 00 00       	mov    $0x1,%eax
+     4db:	89 e1                	mov    %esp,%ecx
+     4dd:	ba e4 04 00 00       	mov    $0x4e4,%edx
+     4e2:	0f 34                	sysenter
+     4e4:	c3                   	ret
+
+000004e5 <sysexit>:
+SYSCALLAS(sysexit, exit)
+     4e5:	b8 02 00 00 00       	mov    $0x2,%eax
+     4ea:	89 e1                	mov    %esp,%ecx
+     4ec:	ba f3 04 00 00       	mov    $0x4f3,%edx
+     4f1:	0f 34                	sysenter
+     4f3:	c3                   	ret
+
+000004f4 <wait>:
+SYSCALL(wait)
+     4f4:	b8 03 00 00 00       	mov    $0x3,%eax
+     4f9:	89 e1                	mov    %esp,%ecx
+     4fb:	ba 02 05 00 00       	mov    $0x502,%edx
+     500:	0f 34                	sysenter
+     502:	c3                   	ret
+
+00000503 <pipe>:
+SYSCALL(pipe)
+     503:	b8 04 00 00 00       	mov    $0x4,%eax
+     508:	89 e1                	mov    %esp,%ecx
+     50a:	ba 11 05 00 00       	mov    $0x511,%edx
+     50f:	0f 34                	sysenter
+     511:	c3                   	ret
+
+00000512 <read>:
+SYSCALL(read)
+     512:	b8 05 00 00 00       	mov    $0x5,%eax
+     517:	89 e1                	mov    %esp,%ecx
+     519:	ba 20 05 00 00       	mov    $0x520,%edx
+     51e:	0f 34                	sysenter
+     520:	c3                   	ret
+
+00000521 <write>:
+SYSCALL(write)
+     521:	b8 10 00 00 00       	mov    $0x10,%eax
+     526:	89 e1                	mov    %esp,%ecx
+     528:	ba 2f 05 00 00       	mov    $0x52f,%edx
+     52d:	0f 34                	sysenter
+     52f:	c3                   	ret
+
+00000530 <close>:
+SYSCALL(close)
+     530:	b8 15 00 00 00       	mov    $0x15,%eax
+     535:	89 e1                	mov    %esp,%ecx
+     537:	ba 3e 05 00 00       	mov    $0x53e,%edx
+     53c:	0f 34                	sysenter
+     53e:	c3                   	ret
+
+0000053f <kill>:
+SYSCALL(kill)
+     53f:	b8 06 00 00 00       	mov    $0x6,%eax
+     544:	89 e1                	mov    %esp,%ecx
+     546:	ba 4d 05 00 00       	mov    $0x54d,%edx
+     54b:	0f 34                	sysenter
+     54d:	c3                   	ret
+
+0000054e <sysexec>:
+SYSCALLAS(sysexec, exec)
+     54e:	b8 07 00 00 00       	mov    $0x7,%eax
+     553:	89 e1                	mov    %esp,%ecx
+     555:	ba 5c 05 00 00       	mov    $0x55c,%edx
+     55a:	0f 34                	sysenter
+     55c:	c3                   	ret
+
+0000055d <open>:
+SYSCALL(open)
+     55d:	b8 0f 00 00 00       	mov    $0xf,%eax
+     562:	89 e1                	mov    %esp,%ecx
+     564:	ba 6b 05 00 00       	mov    $0x56b,%edx
+     569:	0f 34                	sysenter
+     56b:	c3                   	ret
+
+0000056c <mknod>:
+SYSCALL(mknod)
+     56c:	b8 11 00 00 00       	mov    $0x11,%eax
+     571:	89 e1                	mov    %esp,%ecx
+     573:	ba 7a 05 00 00       	mov    $0x57a,%edx
+     578:	0f 34                	sysenter
+     57a:	c3                   	ret
+
+0000057b <unlink>:
+SYSCALL(unlink)
+     57b:	b8 12 00 00 00       	mov    $0x12,%eax
+     580:	89 e1                	mov    %esp,%ecx
+     582:	ba 89 05 00 00       	mov    $0x589,%edx
+     587:	0f 34                	sysenter
+     589:	c3                   	ret
+
+0000058a <fstat>:
+SYSCALL(fstat)
+     58a:	b8 08 00 00 00       	mov    $0x8,%eax
+     58f:	89 e1                	mov    %esp,%ecx
+     591:	ba 98 05 00 00       	mov    $0x598,%edx
+     596:	0f 34                	sysenter
+     598:	c3                   	ret
+
+00000599 <link>:
+SYSCALL(link)
+     599:	b8 13 00 00 00       	mov    $0x13,%eax
+     59e:	89 e1                	mov    %esp,%ecx
+     5a0:	ba a7 05 00 00       	mov    $0x5a7,%edx
+     5a5:	0f 34                	sysenter
+     5a7:	c3                   	ret
+
+000005a8 <mkdir>:
+SYSCALL(mkdir)
+     5a8:	b8 14 00 00 00       	mov    $0x14,%eax
+     5ad:	89 e1                	mov    %esp,%ecx
+     5af:	ba b6 05 00 00       	mov    $0x5b6,%edx
+     5b4:	0f 34                	sysenter
+     5b6:	c3                   	ret
+
+000005b7 <chdir>:
+SYSCALL(chdir)
+     5b7:	b8 09 00 00 00       	mov    $0x9,%eax
+     5bc:	89 e1                	mov    %esp,%ecx
+     5be:	ba c5 05 00 00       	mov    $0x5c5,%edx
+     5c3:	0f 34                	sysenter
+     5c5:	c3                   	ret
+
+000005c6 <dup>:
+SYSCALL(dup)
+     5c6:	b8 0a 00 00 00       	mov    $0xa,%eax
+     5cb:	89 e1                	mov    %esp,%ecx
+     5cd:	ba d4 05 00 00       	mov    $0x5d4,%edx
+     5d2:	0f 34                	sysenter
+     5d4:	c3                   	ret
+
+000005d5 <getpid>:
+SYSCALL(getpid)
+     5d5:	b8 0b 00 00 00       	mov    $0xb,%eax
+     5da:	89 e1                	mov    %esp,%ecx
+     5dc:	ba e3 05 00 00       	mov    $0x5e3,%edx
+     5e1:	0f 34                	sysenter
+     5e3:	c3                   	ret
+
+000005e4 <sbrk>:
+SYSCALL(sbrk)
+     5e4:	b8 0c 00 00 00       	mov    $0xc,%eax
+     5e9:	89 e1                	mov    %esp,%ecx
+     5eb:	ba f2 05 00 00       	mov    $0x5f2,%edx
+     5f0:	0f 34                	sysenter
+     5f2:	c3                   	ret
+
+000005f3 <sleep>:
+SYSCALL(sleep)
+     5f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     5f8:	89 e1                	mov    %esp,%ecx
+     5fa:	ba 01 06 00 00       	mov    $0x601,%edx
+     5ff:	0f 34                	sysenter
+     601:	c3                   	ret
+
+00000602 <clone>:
+SYSCALL(clone)
+     602:	b8 16 00 00 00       	mov    $0x16,%eax
+     607:	89 e1                	mov    %esp,%ecx
+     609:	ba 10 06 00 00       	mov    $0x610,%edx
+     60e:	0f 34                	sysenter
+     610:	c3                   	ret
+
+00000611 <join>:
+SYSCALL(join)
+     611:	b8 17 00 00 00       	mov    $0x17,%eax
+     616:	89 e1                	mov    %esp,%ecx
+     618:	ba 1f 06 00 00       	mov    $0x61f,%edx
+     61d:	0f 34                	sysenter
+     61f:	c3                   	ret
+
+00000620 <futex>:
+SYSCALL(futex)
+     620:	b8 18 00 00 00       	mov    $0x18,%eax
+     625:	89 e1                	mov    %esp,%ecx
+     627:	ba 2e 06 00 00       	mov    $0x62e,%edx
+     62c:	0f 34                	sysenter
+     62e:	c3                   	ret
+
+0000062f <yield>:
+SYSCALL(yield)
+     62f:	b8 19 00 00 00       	mov    $0x19,%eax
+     634:	89 e1                	mov    %esp,%ecx
+     636:	ba 3d 06 00 00       	mov    $0x63d,%edx
+     63b:	0f 34                	sysenter
+     63d:	c3                   	ret
+
+0000063e <lockstat>:
+SYSCALL(lockstat)
+     63e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     643:	89 e1                	mov    %esp,%ecx
+     645:	ba 4c 06 00 00       	mov    $0x64c,%edx
+     64a:	0f 34                	sysenter
+     64c:	c3                   	ret
+
+0000064d <lockhammer>:
+SYSCALL(lockhammer)
+     64d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     652:	89 e1                	mov    %esp,%ecx
+     654:	ba 5b 06 00 00       	mov    $0x65b,%edx
+     659:	0f 34                	sysenter
+     65b:	c3                   	ret
+
+0000065c <vmsplice>:
+SYSCALL(vmsplice)
+     65c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     661:	89 e1                	mov    %esp,%ecx
+     663:	ba 6a 06 00 00       	mov    $0x66a,%edx
+     668:	0f 34                	sysenter
+     66a:	c3                   	ret
+
+0000066b <hsbrk>:
+SYSCALL(hsbrk)
+     66b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     670:	89 e1                	mov    %esp,%ecx
+     672:	ba 79 06 00 00       	mov    $0x679,%edx
+     677:	0f 34                	sysenter
+     679:	c3                   	ret
+
+0000067a <mmap>:
+SYSCALL(mmap)
+     67a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     67f:	89 e1                	mov    %esp,%ecx
+     681:	ba 88 06 00 00       	mov    $0x688,%edx
+     686:	0f 34                	sysenter
+     688:	c3                   	ret
+
+00000689 <munmap>:
+SYSCALL(munmap)
+     689:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     68e:	89 e1                	mov    %esp,%ecx
+     690:	ba 97 06 00 00       	mov    $0x697,%edx
+     695:	0f 34                	sysenter
+     697:	c3                   	ret
+
+00000698 <ringenter>:
+SYSCALL(ringenter)
+     698:	b8 20 00 00 00       	mov    $0x20,%eax
+     69d:	89 e1                	mov    %esp,%ecx
+     69f:	ba a6 06 00 00       	mov    $0x6a6,%edx
+     6a4:	0f 34                	sysenter
+     6a6:	c3                   	ret
+
+000006a7 <readv>:
+SYSCALL(readv)
+     6a7:	b8 21 00 00 00       	mov    $0x21,%eax
+     6ac:	89 e1                	mov    %esp,%ecx
+     6ae:	ba b5 06 00 00       	mov    $0x6b5,%edx
+     6b3:	0f 34                	sysenter
+     6b5:	c3                   	ret
+
+000006b6 <writev>:
+SYSCALL(writev)
+     6b6:	b8 22 00 00 00       	mov    $0x22,%eax
+     6bb:	89 e1                	mov    %esp,%ecx
+     6bd:	ba c4 06 00 00       	mov    $0x6c4,%edx
+     6c2:	0f 34                	sysenter
+     6c4:	c3                   	ret
+
+000006c5 <pread>:
+SYSCALL(pread)
+     6c5:	b8 23 00 00 00       	mov    $0x23,%eax
+     6ca:	89 e1                	mov    %esp,%ecx
+     6cc:	ba d3 06 00 00       	mov    $0x6d3,%edx
+     6d1:	0f 34                	sysenter
+     6d3:	c3                   	ret
+
+000006d4 <pwrite>:
+SYSCALL(pwrite)
+     6d4:	b8 24 00 00 00       	mov    $0x24,%eax
+     6d9:	89 e1                	mov    %esp,%ecx
+     6db:	ba e2 06 00 00       	mov    $0x6e2,%edx
+     6e0:	0f 34                	sysenter
+     6e2:	c3                   	ret
+
+000006e3 <prof>:
+SYSCALL(prof)
+     6e3:	b8 25 00 00 00       	mov    $0x25,%eax
+     6e8:	89 e1                	mov    %esp,%ecx
+     6ea:	ba f1 06 00 00       	mov    $0x6f1,%edx
+     6ef:	0f 34                	sysenter
+     6f1:	c3                   	ret
+
+000006f2 <scstat>:
+SYSCALL(scstat)
+     6f2:	b8 26 00 00 00       	mov    $0x26,%eax
+     6f7:	89 e1                	mov    %esp,%ecx
+     6f9:	ba 00 07 00 00       	mov    $0x700,%edx
+     6fe:	0f 34                	sysenter
+     700:	c3                   	ret
+     701:	66 90                	xchg   %ax,%ax
+     703:	66 90                	xchg   %ax,%ax
+     705:	66 90                	xchg   %ax,%ax
+     707:	66 90                	xchg   %ax,%ax
+     709:	66 90                	xchg   %ax,%ax
+     70b:	66 90                	xchg   %ax,%ax
+     70d:	66 90                	xchg   %ax,%ax
+     70f:	90                   	nop
+
+00000710 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+     710:	55                   	push   %ebp
+     711:	89 e5                	mov    %esp,%ebp
+     713:	57                   	push   %edi
+     714:	56                   	push   %esi
+     715:	53                   	push   %ebx
+     716:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     718:	89 d1                	mov    %edx,%ecx
+{
+     71a:	83 ec 2c             	sub    $0x2c,%esp
+     71d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+     720:	85 d2                	test   %edx,%edx
+     722:	79 7c                	jns    7a0 <printint+0x90>
+     724:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     728:	74 76                	je     7a0 <printint+0x90>
+    x = -xx;
+     72a:	f7 d9                	neg    %ecx
+    neg = 1;
+     72c:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     731:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     734:	31 f6                	xor    %esi,%esi
+     736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     73d:	8d 76 00             	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     740:	89 c8                	mov    %ecx,%eax
+     742:	31 d2                	xor    %edx,%edx
+     744:	89 f7                	mov    %esi,%edi
+     746:	f7 f3                	div    %ebx
+     748:	8d 76 01             	lea    0x1(%esi),%esi
+     74b:	0f b6 92 a8 1e 00 00 	movzbl 0x1ea8(%edx),%edx
+     752:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     756:	89 ca                	mov    %ecx,%edx
+     758:	89 c1                	mov    %eax,%ecx
+     75a:	39 da                	cmp    %ebx,%edx
+     75c:	73 e2                	jae    740 <printint+0x30>
+  if(neg)
+     75e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     761:	85 c0                	test   %eax,%eax
+     763:	74 07                	je     76c <printint+0x5c>
+    buf[i++] = '-';
+     765:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     76a:	89 f7                	mov    %esi,%edi
+     76c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     76f:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     772:	01 df                	add    %ebx,%edi
+     774:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc_unlocked(buf[i], f);
+     778:	83 ec 08             	sub    $0x8,%esp
+     77b:	56                   	push   %esi
+     77c:	0f be 07             	movsbl (%edi),%eax
+     77f:	50                   	push   %eax
+     780:	e8 cb 07 00 00       	call   f50 <putc_unlocked>
+  while(--i >= 0)
+     785:	89 f8                	mov    %edi,%eax
+     787:	83 c4 10             	add    $0x10,%esp
+     78a:	83 ef 01             	sub    $0x1,%edi
+     78d:	39 d8                	cmp    %ebx,%eax
+     78f:	75 e7                	jne    778 <printint+0x68>
+}
+     791:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     794:	5b                   	pop    %ebx
+     795:	5e                   	pop    %esi
+     796:	5f                   	pop    %edi
+     797:	5d                   	pop    %ebp
+     798:	c3                   	ret
+     799:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     7a0:	31 c0                	xor    %eax,%eax
+     7a2:	eb 8d                	jmp    731 <printint+0x21>
+     7a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7af:	90                   	nop
+
+000007b0 <vfprintf>:
+
+// Print to the given stream, which the caller has locked.
+// Only understands %d, %x, %p, %s.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+     7b0:	55                   	push   %ebp
+     7b1:	89 e5                	mov    %esp,%ebp
+     7b3:	57                   	push   %edi
+     7b4:	56                   	push   %esi
+     7b5:	53                   	push   %ebx
+     7b6:	83 ec 1c             	sub    $0x1c,%esp
+     7b9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     7bc:	0f b6 0a             	movzbl (%edx),%ecx
+     7bf:	84 c9                	test   %cl,%cl
+     7c1:	74 5c                	je     81f <vfprintf+0x6f>
+     7c3:	89 c6                	mov    %eax,%esi
+     7c5:	8d 5a 01             	lea    0x1(%edx),%ebx
+     7c8:	31 ff                	xor    %edi,%edi
+     7ca:	eb 20                	jmp    7ec <vfprintf+0x3c>
+     7cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     7d0:	83 f9 25             	cmp    $0x25,%ecx
+     7d3:	74 3b                	je     810 <vfprintf+0x60>
+        state = '%';
+      } else {
+        putc_unlocked(c, f);
+     7d5:	83 ec 08             	sub    $0x8,%esp
+     7d8:	56                   	push   %esi
+     7d9:	51                   	push   %ecx
+     7da:	e8 71 07 00 00       	call   f50 <putc_unlocked>
+     7df:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     7e2:	0f b6 0b             	movzbl (%ebx),%ecx
+     7e5:	83 c3 01             	add    $0x1,%ebx
+     7e8:	84 c9                	test   %cl,%cl
+     7ea:	74 33                	je     81f <vfprintf+0x6f>
+    if(state == 0){
+     7ec:	85 ff                	test   %edi,%edi
+     7ee:	74 e0                	je     7d0 <vfprintf+0x20>
+      }
+    } else if(state == '%'){
+     7f0:	83 ff 25             	cmp    $0x25,%edi
+     7f3:	75 ed                	jne    7e2 <vfprintf+0x32>
+      if(c == 'd'){
+     7f5:	83 f9 25             	cmp    $0x25,%ecx
+     7f8:	0f 84 02 01 00 00    	je     900 <vfprintf+0x150>
+     7fe:	8d 41 9d             	lea    -0x63(%ecx),%eax
+     801:	83 f8 15             	cmp    $0x15,%eax
+     804:	77 2a                	ja     830 <vfprintf+0x80>
+     806:	ff 24 85 50 1e 00 00 	jmp    *0x1e50(,%eax,4)
+     80d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     810:	0f b6 0b             	movzbl (%ebx),%ecx
+     813:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     816:	bf 25 00 00 00       	mov    $0x25,%edi
+  for(i = 0; fmt[i]; i++){
+     81b:	84 c9                	test   %cl,%cl
+     81d:	75 cd                	jne    7ec <vfprintf+0x3c>
+        putc_unlocked(c, f);
+      }
+      state = 0;
+    }
+  }
+}
+     81f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     822:	5b                   	pop    %ebx
+     823:	5e                   	pop    %esi
+     824:	5f                   	pop    %edi
+     825:	5d                   	pop    %ebp
+     826:	c3                   	ret
+     827:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     82e:	66 90                	xchg   %ax,%ax
+        putc_unlocked('%', f);
+     830:	83 ec 08             	sub    $0x8,%esp
+     833:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     836:	56                   	push   %esi
+     837:	6a 25                	push   $0x25
+     839:	e8 12 07 00 00       	call   f50 <putc_unlocked>
+        putc_unlocked(c, f);
+     83e:	58                   	pop    %eax
+     83f:	5a                   	pop    %edx
+     840:	56                   	push   %esi
+     841:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     844:	51                   	push   %ecx
+     845:	e8 06 07 00 00       	call   f50 <putc_unlocked>
+     84a:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     84d:	31 ff                	xor    %edi,%edi
+     84f:	eb 91                	jmp    7e2 <vfprintf+0x32>
+     851:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+     858:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     85b:	83 ec 0c             	sub    $0xc,%esp
+     85e:	b9 10 00 00 00       	mov    $0x10,%ecx
+     863:	8b 17                	mov    (%edi),%edx
+     865:	6a 00                	push   $0x0
+        ap++;
+     867:	83 c7 04             	add    $0x4,%edi
+        printint(f, *ap, 16, 0);
+     86a:	89 f0                	mov    %esi,%eax
+     86c:	e8 9f fe ff ff       	call   710 <printint>
+        ap++;
+     871:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     874:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     877:	31 ff                	xor    %edi,%edi
+     879:	e9 64 ff ff ff       	jmp    7e2 <vfprintf+0x32>
+     87e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     880:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     883:	8b 10                	mov    (%eax),%edx
+        ap++;
+     885:	83 c0 04             	add    $0x4,%eax
+     888:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     88b:	85 d2                	test   %edx,%edx
+     88d:	0f 84 85 00 00 00    	je     918 <vfprintf+0x168>
+        while(*s != 0){
+     893:	0f be 02             	movsbl (%edx),%eax
+        s = (char*)*ap;
+     896:	89 d7                	mov    %edx,%edi
+        while(*s != 0){
+     898:	84 c0                	test   %al,%al
+     89a:	74 b1                	je     84d <vfprintf+0x9d>
+     89c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+          putc_unlocked(*s, f);
+     8a0:	83 ec 08             	sub    $0x8,%esp
+          s++;
+     8a3:	83 c7 01             	add    $0x1,%edi
+          putc_unlocked(*s, f);
+     8a6:	56                   	push   %esi
+     8a7:	50                   	push   %eax
+     8a8:	e8 a3 06 00 00       	call   f50 <putc_unlocked>
+        while(*s != 0){
+     8ad:	0f be 07             	movsbl (%edi),%eax
+     8b0:	83 c4 10             	add    $0x10,%esp
+     8b3:	84 c0                	test   %al,%al
+     8b5:	75 e9                	jne    8a0 <vfprintf+0xf0>
+      state = 0;
+     8b7:	31 ff                	xor    %edi,%edi
+     8b9:	e9 24 ff ff ff       	jmp    7e2 <vfprintf+0x32>
+     8be:	66 90                	xchg   %ax,%ax
+        printint(f, *ap, 10, 1);
+     8c0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     8c3:	83 ec 0c             	sub    $0xc,%esp
+     8c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     8cb:	8b 17                	mov    (%edi),%edx
+     8cd:	6a 01                	push   $0x1
+     8cf:	eb 96                	jmp    867 <vfprintf+0xb7>
+     8d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc_unlocked(*ap, f);
+     8d8:	83 ec 08             	sub    $0x8,%esp
+     8db:	56                   	push   %esi
+     8dc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     8df:	ff 37                	push   (%edi)
+     8e1:	e8 6a 06 00 00       	call   f50 <putc_unlocked>
+        ap++;
+     8e6:	89 f8                	mov    %edi,%eax
+     8e8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     8eb:	31 ff                	xor    %edi,%edi
+        ap++;
+     8ed:	83 c0 04             	add    $0x4,%eax
+     8f0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     8f3:	e9 ea fe ff ff       	jmp    7e2 <vfprintf+0x32>
+     8f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ff:	90                   	nop
+        putc_unlocked(c, f);
+     900:	83 ec 08             	sub    $0x8,%esp
+      state = 0;
+     903:	31 ff                	xor    %edi,%edi
+        putc_unlocked(c, f);
+     905:	56                   	push   %esi
+     906:	6a 25                	push   $0x25
+     908:	e8 43 06 00 00       	call   f50 <putc_unlocked>
+     90d:	83 c4 10             	add    $0x10,%esp
+     910:	e9 cd fe ff ff       	jmp    7e2 <vfprintf+0x32>
+     915:	8d 76 00             	lea    0x0(%esi),%esi
+     918:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     91d:	bf 47 1e 00 00       	mov    $0x1e47,%edi
+     922:	e9 79 ff ff ff       	jmp    8a0 <vfprintf+0xf0>
+     927:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     92e:	66 90                	xchg   %ax,%ax
+
+00000930 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+     930:	55                   	push   %ebp
+     931:	89 e5                	mov    %esp,%ebp
+     933:	53                   	push   %ebx
+     934:	83 ec 10             	sub    $0x10,%esp
+     937:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  flockfile(f);
+     93a:	53                   	push   %ebx
+     93b:	e8 d0 02 00 00       	call   c10 <flockfile>
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     940:	8b 55 0c             	mov    0xc(%ebp),%edx
+     943:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     946:	89 d8                	mov    %ebx,%eax
+     948:	e8 63 fe ff ff       	call   7b0 <vfprintf>
+  funlockfile(f);
+     94d:	89 1c 24             	mov    %ebx,(%esp)
+     950:	e8 eb 02 00 00       	call   c40 <funlockfile>
+}
+     955:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     958:	83 c4 10             	add    $0x10,%esp
+     95b:	c9                   	leave
+     95c:	c3                   	ret
+     95d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000960 <printf>:
+
+// Print to the given fd: through stdout or stderr for 1 and 2,
+// otherwise with one write() per call.
+void
+printf(int fd, const char *fmt, ...)
+{
+     960:	55                   	push   %ebp
+     961:	89 e5                	mov    %esp,%ebp
+     963:	56                   	push   %esi
+     964:	53                   	push   %ebx
+     965:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+     96b:	8b 45 08             	mov    0x8(%ebp),%eax
+  char buf[128];
+  struct iobuf f;
+
+  if(fd == 1 || fd == 2){
+    flockfile(&_iob[fd]);
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     96e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(fd == 1 || fd == 2){
+     971:	8d 50 ff             	lea    -0x1(%eax),%edx
+     974:	83 fa 01             	cmp    $0x1,%edx
+     977:	76 77                	jbe    9f0 <printf+0x90>
+    funlockfile(&_iob[fd]);
+    return;
+  }
+  f.fd = fd;
+     979:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  f.flags = IO_WRITE|IO_SETUP;
+  f.buf = buf;
+     97f:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  f.size = sizeof(buf);
+  f.r = f.n = 0;
+  mutex_init(&f.lock);
+     985:	83 ec 0c             	sub    $0xc,%esp
+     988:	8d 9d 5c ff ff ff    	lea    -0xa4(%ebp),%ebx
+  f.buf = buf;
+     98e:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+  mutex_init(&f.lock);
+     994:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  f.flags = IO_WRITE|IO_SETUP;
+     99a:	c7 85 60 ff ff ff 42 	movl   $0x42,-0xa0(%ebp)
+     9a1:	00 00 00 
+  f.size = sizeof(buf);
+     9a4:	c7 85 68 ff ff ff 80 	movl   $0x80,-0x98(%ebp)
+     9ab:	00 00 00 
+  f.r = f.n = 0;
+     9ae:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+     9b5:	00 00 00 
+     9b8:	c7 85 6c ff ff ff 00 	movl   $0x0,-0x94(%ebp)
+     9bf:	00 00 00 
+  mutex_init(&f.lock);
+     9c2:	50                   	push   %eax
+     9c3:	e8 d8 f9 ff ff       	call   3a0 <mutex_init>
+  vfprintf(&f, fmt, (uint*)(void*)&fmt + 1);
+     9c8:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     9cb:	89 f2                	mov    %esi,%edx
+     9cd:	89 d8                	mov    %ebx,%eax
+     9cf:	e8 dc fd ff ff       	call   7b0 <vfprintf>
+  fflush(&f);
+     9d4:	89 1c 24             	mov    %ebx,(%esp)
+     9d7:	e8 f4 04 00 00       	call   ed0 <fflush>
+     9dc:	83 c4 10             	add    $0x10,%esp
+}
+     9df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     9e2:	5b                   	pop    %ebx
+     9e3:	5e                   	pop    %esi
+     9e4:	5d                   	pop    %ebp
+     9e5:	c3                   	ret
+     9e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9ed:	8d 76 00             	lea    0x0(%esi),%esi
+    flockfile(&_iob[fd]);
+     9f0:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     9f3:	83 ec 0c             	sub    $0xc,%esp
+     9f6:	8d 98 40 28 00 00    	lea    0x2840(%eax),%ebx
+     9fc:	53                   	push   %ebx
+     9fd:	e8 0e 02 00 00       	call   c10 <flockfile>
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     a02:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     a05:	89 f2                	mov    %esi,%edx
+     a07:	89 d8                	mov    %ebx,%eax
+     a09:	e8 a2 fd ff ff       	call   7b0 <vfprintf>
+    funlockfile(&_iob[fd]);
+     a0e:	89 1c 24             	mov    %ebx,(%esp)
+     a11:	e8 2a 02 00 00       	call   c40 <funlockfile>
+     a16:	83 c4 10             	add    $0x10,%esp
+}
+     a19:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     a1c:	5b                   	pop    %ebx
+     a1d:	5e                   	pop    %esi
+     a1e:	5d                   	pop    %ebp
+     a1f:	c3                   	ret
+
+00000a20 <setup>:
+}
+
+// Choose how to buffer f on first use: by lines on a device.
+static void
+setup(FILE *f)
+{
+     a20:	55                   	push   %ebp
+     a21:	89 e5                	mov    %esp,%ebp
+     a23:	53                   	push   %ebx
+     a24:	89 c3                	mov    %eax,%ebx
+     a26:	83 ec 2c             	sub    $0x2c,%esp
+  struct stat st;
+
+  f->flags |= IO_SETUP;
+     a29:	83 48 04 40          	orl    $0x40,0x4(%eax)
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     a2d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     a30:	50                   	push   %eax
+     a31:	ff 33                	push   (%ebx)
+     a33:	e8 52 fb ff ff       	call   58a <fstat>
+     a38:	83 c4 10             	add    $0x10,%esp
+     a3b:	85 c0                	test   %eax,%eax
+    f->flags |= IO_DEV|IO_LINE;
+     a3d:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     a40:	75 07                	jne    a49 <setup+0x29>
+     a42:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+     a47:	74 17                	je     a60 <setup+0x40>
+  if(f->flags & IO_WRITE)
+     a49:	a8 02                	test   $0x2,%al
+     a4b:	74 0a                	je     a57 <setup+0x37>
+    flushhook = flushall;
+     a4d:	c7 05 20 29 00 00 80 	movl   $0xb80,0x2920
+     a54:	0b 00 00 
+}
+     a57:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a5a:	c9                   	leave
+     a5b:	c3                   	ret
+     a5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    f->flags |= IO_DEV|IO_LINE;
+     a60:	83 c8 30             	or     $0x30,%eax
+     a63:	89 43 04             	mov    %eax,0x4(%ebx)
+     a66:	eb e1                	jmp    a49 <setup+0x29>
+     a68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a6f:	90                   	nop
+
+00000a70 <flush>:
+static int
+flush(FILE *f)
+{
+  int i, n;
+
+  if(!(f->flags & IO_WRITE))
+     a70:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+     a74:	74 6a                	je     ae0 <flush+0x70>
+{
+     a76:	55                   	push   %ebp
+     a77:	89 e5                	mov    %esp,%ebp
+     a79:	56                   	push   %esi
+     a7a:	89 c6                	mov    %eax,%esi
+     a7c:	53                   	push   %ebx
+    return 0;
+  for(i = 0; i < f->n; i += n){
+     a7d:	8b 40 14             	mov    0x14(%eax),%eax
+     a80:	85 c0                	test   %eax,%eax
+     a82:	7e 4c                	jle    ad0 <flush+0x60>
+     a84:	31 db                	xor    %ebx,%ebx
+     a86:	eb 11                	jmp    a99 <flush+0x29>
+     a88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a8f:	90                   	nop
+     a90:	01 c3                	add    %eax,%ebx
+     a92:	8b 46 14             	mov    0x14(%esi),%eax
+     a95:	39 d8                	cmp    %ebx,%eax
+     a97:	7e 37                	jle    ad0 <flush+0x60>
+    if((n = write(f->fd, f->buf + i, f->n - i)) <= 0){
+     a99:	83 ec 04             	sub    $0x4,%esp
+     a9c:	29 d8                	sub    %ebx,%eax
+     a9e:	50                   	push   %eax
+     a9f:	8b 46 08             	mov    0x8(%esi),%eax
+     aa2:	01 d8                	add    %ebx,%eax
+     aa4:	50                   	push   %eax
+     aa5:	ff 36                	push   (%esi)
+     aa7:	e8 75 fa ff ff       	call   521 <write>
+     aac:	83 c4 10             	add    $0x10,%esp
+     aaf:	85 c0                	test   %eax,%eax
+     ab1:	7f dd                	jg     a90 <flush+0x20>
+      f->flags |= IO_ERR;
+     ab3:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+      f->n = 0;
+     ab7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     abc:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+      return EOF;
+    }
+  }
+  f->n = 0;
+  return 0;
+}
+     ac3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ac6:	5b                   	pop    %ebx
+     ac7:	5e                   	pop    %esi
+     ac8:	5d                   	pop    %ebp
+     ac9:	c3                   	ret
+     aca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->n = 0;
+     ad0:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+}
+     ad7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+     ada:	31 c0                	xor    %eax,%eax
+}
+     adc:	5b                   	pop    %ebx
+     add:	5e                   	pop    %esi
+     ade:	5d                   	pop    %ebp
+     adf:	c3                   	ret
+    return 0;
+     ae0:	31 c0                	xor    %eax,%eax
+}
+     ae2:	c3                   	ret
+     ae3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000af0 <fflush.part.0>:
+fflush(FILE *f)
+     af0:	55                   	push   %ebp
+     af1:	89 e5                	mov    %esp,%ebp
+     af3:	57                   	push   %edi
+     af4:	bf 38 29 00 00       	mov    $0x2938,%edi
+     af9:	56                   	push   %esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     afa:	31 f6                	xor    %esi,%esi
+fflush(FILE *f)
+     afc:	53                   	push   %ebx
+     afd:	bb 58 28 00 00       	mov    $0x2858,%ebx
+     b02:	83 ec 1c             	sub    $0x1c,%esp
+     b05:	eb 10                	jmp    b17 <fflush.part.0+0x27>
+     b07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b0e:	66 90                	xchg   %ax,%ax
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     b10:	83 c3 1c             	add    $0x1c,%ebx
+     b13:	39 df                	cmp    %ebx,%edi
+     b15:	74 33                	je     b4a <fflush.part.0+0x5a>
+      if((f->flags & IO_WRITE) && fflush(f) < 0)
+     b17:	f6 43 ec 02          	testb  $0x2,-0x14(%ebx)
+     b1b:	74 f3                	je     b10 <fflush.part.0+0x20>
+  if(threaded)
+     b1d:	8b 0d 40 29 00 00    	mov    0x2940,%ecx
+     b23:	85 c9                	test   %ecx,%ecx
+     b25:	75 49                	jne    b70 <fflush.part.0+0x80>
+  r = flush(f);
+     b27:	8d 43 e8             	lea    -0x18(%ebx),%eax
+     b2a:	e8 41 ff ff ff       	call   a70 <flush>
+  if(threaded)
+     b2f:	8b 15 40 29 00 00    	mov    0x2940,%edx
+     b35:	85 d2                	test   %edx,%edx
+     b37:	75 1f                	jne    b58 <fflush.part.0+0x68>
+        r = EOF;
+     b39:	85 c0                	test   %eax,%eax
+     b3b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     b40:	0f 48 f0             	cmovs  %eax,%esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     b43:	83 c3 1c             	add    $0x1c,%ebx
+     b46:	39 df                	cmp    %ebx,%edi
+     b48:	75 cd                	jne    b17 <fflush.part.0+0x27>
+}
+     b4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b4d:	89 f0                	mov    %esi,%eax
+     b4f:	5b                   	pop    %ebx
+     b50:	5e                   	pop    %esi
+     b51:	5f                   	pop    %edi
+     b52:	5d                   	pop    %ebp
+     b53:	c3                   	ret
+     b54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     b58:	83 ec 0c             	sub    $0xc,%esp
+     b5b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     b5e:	53                   	push   %ebx
+     b5f:	e8 9c f8 ff ff       	call   400 <mutex_unlock>
+     b64:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     b67:	83 c4 10             	add    $0x10,%esp
+     b6a:	eb cd                	jmp    b39 <fflush.part.0+0x49>
+     b6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     b70:	83 ec 0c             	sub    $0xc,%esp
+     b73:	53                   	push   %ebx
+     b74:	e8 37 f8 ff ff       	call   3b0 <mutex_lock>
+     b79:	83 c4 10             	add    $0x10,%esp
+     b7c:	eb a9                	jmp    b27 <fflush.part.0+0x37>
+     b7e:	66 90                	xchg   %ax,%ax
+
+00000b80 <flushall>:
+  if(f == 0){
+     b80:	e9 6b ff ff ff       	jmp    af0 <fflush.part.0>
+     b85:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b90 <fill>:
+
+// Refill f's buffer. Returns the number of bytes read.
+// Caller holds f's lock.
+static int
+fill(FILE *f)
+{
+     b90:	55                   	push   %ebp
+     b91:	89 e5                	mov    %esp,%ebp
+     b93:	53                   	push   %ebx
+     b94:	89 c3                	mov    %eax,%ebx
+     b96:	83 ec 04             	sub    $0x4,%esp
+  int n;
+
+  if(!(f->flags & IO_SETUP))
+     b99:	8b 40 04             	mov    0x4(%eax),%eax
+     b9c:	a8 40                	test   $0x40,%al
+     b9e:	74 50                	je     bf0 <fill+0x60>
+    setup(f);
+  if(f->flags & IO_DEV)
+     ba0:	a8 20                	test   $0x20,%al
+     ba2:	75 3c                	jne    be0 <fill+0x50>
+    fflush(0);
+  f->r = 0;
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     ba4:	83 ec 04             	sub    $0x4,%esp
+  f->r = 0;
+     ba7:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     bae:	ff 73 0c             	push   0xc(%ebx)
+     bb1:	ff 73 08             	push   0x8(%ebx)
+     bb4:	ff 33                	push   (%ebx)
+     bb6:	e8 57 f9 ff ff       	call   512 <read>
+     bbb:	83 c4 10             	add    $0x10,%esp
+     bbe:	85 c0                	test   %eax,%eax
+     bc0:	7f 10                	jg     bd2 <fill+0x42>
+    f->flags |= n < 0 ? IO_ERR : IO_EOF;
+     bc2:	83 f8 01             	cmp    $0x1,%eax
+     bc5:	19 c0                	sbb    %eax,%eax
+     bc7:	83 e0 fc             	and    $0xfffffffc,%eax
+     bca:	83 c0 08             	add    $0x8,%eax
+     bcd:	09 43 04             	or     %eax,0x4(%ebx)
+    n = 0;
+     bd0:	31 c0                	xor    %eax,%eax
+  }
+  f->n = n;
+     bd2:	89 43 14             	mov    %eax,0x14(%ebx)
+  return n;
+}
+     bd5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     bd8:	c9                   	leave
+     bd9:	c3                   	ret
+     bda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == 0){
+     be0:	e8 0b ff ff ff       	call   af0 <fflush.part.0>
+     be5:	eb bd                	jmp    ba4 <fill+0x14>
+     be7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bee:	66 90                	xchg   %ax,%ax
+    setup(f);
+     bf0:	89 d8                	mov    %ebx,%eax
+     bf2:	e8 29 fe ff ff       	call   a20 <setup>
+  if(f->flags & IO_DEV)
+     bf7:	8b 43 04             	mov    0x4(%ebx),%eax
+     bfa:	eb a4                	jmp    ba0 <fill+0x10>
+     bfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c00 <stdio_threaded>:
+  threaded = 1;
+     c00:	c7 05 40 29 00 00 01 	movl   $0x1,0x2940
+     c07:	00 00 00 
+}
+     c0a:	c3                   	ret
+     c0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c0f:	90                   	nop
+
+00000c10 <flockfile>:
+{
+     c10:	55                   	push   %ebp
+  if(threaded)
+     c11:	8b 15 40 29 00 00    	mov    0x2940,%edx
+{
+     c17:	89 e5                	mov    %esp,%ebp
+     c19:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     c1c:	85 d2                	test   %edx,%edx
+     c1e:	75 08                	jne    c28 <flockfile+0x18>
+}
+     c20:	5d                   	pop    %ebp
+     c21:	c3                   	ret
+     c22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_lock(&f->lock);
+     c28:	83 c0 18             	add    $0x18,%eax
+     c2b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     c2e:	5d                   	pop    %ebp
+    mutex_lock(&f->lock);
+     c2f:	e9 7c f7 ff ff       	jmp    3b0 <mutex_lock>
+     c34:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c3f:	90                   	nop
+
+00000c40 <funlockfile>:
+{
+     c40:	55                   	push   %ebp
+  if(threaded)
+     c41:	8b 15 40 29 00 00    	mov    0x2940,%edx
+{
+     c47:	89 e5                	mov    %esp,%ebp
+     c49:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     c4c:	85 d2                	test   %edx,%edx
+     c4e:	75 08                	jne    c58 <funlockfile+0x18>
+}
+     c50:	5d                   	pop    %ebp
+     c51:	c3                   	ret
+     c52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&f->lock);
+     c58:	83 c0 18             	add    $0x18,%eax
+     c5b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     c5e:	5d                   	pop    %ebp
+    mutex_unlock(&f->lock);
+     c5f:	e9 9c f7 ff ff       	jmp    400 <mutex_unlock>
+     c64:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c6f:	90                   	nop
+
+00000c70 <fopen>:
+{
+     c70:	55                   	push   %ebp
+     c71:	89 e5                	mov    %esp,%ebp
+     c73:	57                   	push   %edi
+     c74:	56                   	push   %esi
+     c75:	53                   	push   %ebx
+     c76:	83 ec 34             	sub    $0x34,%esp
+     c79:	8b 75 0c             	mov    0xc(%ebp),%esi
+     c7c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(strcmp(mode, "r") != 0 && strcmp(mode, "w") != 0)
+     c7f:	68 b9 1e 00 00       	push   $0x1eb9
+     c84:	56                   	push   %esi
+     c85:	e8 66 f5 ff ff       	call   1f0 <strcmp>
+     c8a:	83 c4 10             	add    $0x10,%esp
+     c8d:	85 c0                	test   %eax,%eax
+     c8f:	74 15                	je     ca6 <fopen+0x36>
+     c91:	83 ec 08             	sub    $0x8,%esp
+     c94:	68 bb 1e 00 00       	push   $0x1ebb
+     c99:	56                   	push   %esi
+     c9a:	e8 51 f5 ff ff       	call   1f0 <strcmp>
+     c9f:	83 c4 10             	add    $0x10,%esp
+     ca2:	85 c0                	test   %eax,%eax
+     ca4:	75 2c                	jne    cd2 <fopen+0x62>
+  if(threaded)
+     ca6:	a1 40 29 00 00       	mov    0x2940,%eax
+     cab:	85 c0                	test   %eax,%eax
+     cad:	0f 85 ed 00 00 00    	jne    da0 <fopen+0x130>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     cb3:	bb 94 28 00 00       	mov    $0x2894,%ebx
+    if(f->flags == 0)
+     cb8:	8b 53 04             	mov    0x4(%ebx),%edx
+     cbb:	85 d2                	test   %edx,%edx
+     cbd:	74 21                	je     ce0 <fopen+0x70>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     cbf:	83 c3 1c             	add    $0x1c,%ebx
+     cc2:	81 fb 20 29 00 00    	cmp    $0x2920,%ebx
+     cc8:	75 ee                	jne    cb8 <fopen+0x48>
+  if(threaded)
+     cca:	85 c0                	test   %eax,%eax
+     ccc:	0f 85 36 01 00 00    	jne    e08 <fopen+0x198>
+    return 0;
+     cd2:	31 db                	xor    %ebx,%ebx
+     cd4:	e9 96 00 00 00       	jmp    d6f <fopen+0xff>
+     cd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f == &_iob[NSTREAM])
+     ce0:	81 fb 20 29 00 00    	cmp    $0x2920,%ebx
+     ce6:	74 e2                	je     cca <fopen+0x5a>
+    f->flags = IO_MALLOC;
+     ce8:	c7 43 04 80 00 00 00 	movl   $0x80,0x4(%ebx)
+  if(threaded)
+     cef:	85 c0                	test   %eax,%eax
+     cf1:	0f 85 f9 00 00 00    	jne    df0 <fopen+0x180>
+  if(mode[0] == 'r'){
+     cf7:	80 3e 72             	cmpb   $0x72,(%esi)
+     cfa:	0f 84 c0 00 00 00    	je     dc0 <fopen+0x150>
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     d00:	83 ec 08             	sub    $0x8,%esp
+     d03:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     d06:	50                   	push   %eax
+     d07:	57                   	push   %edi
+     d08:	e8 d3 f5 ff ff       	call   2e0 <stat>
+     d0d:	83 c4 10             	add    $0x10,%esp
+     d10:	85 c0                	test   %eax,%eax
+     d12:	74 6c                	je     d80 <fopen+0x110>
+    fd = open(path, O_CREATE|O_WRONLY);
+     d14:	83 ec 08             	sub    $0x8,%esp
+     d17:	68 01 02 00 00       	push   $0x201
+     d1c:	57                   	push   %edi
+    flags = IO_WRITE;
+     d1d:	bf 02 00 00 00       	mov    $0x2,%edi
+    fd = open(path, O_CREATE|O_WRONLY);
+     d22:	e8 36 f8 ff ff       	call   55d <open>
+     d27:	83 c4 10             	add    $0x10,%esp
+     d2a:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     d2c:	85 f6                	test   %esi,%esi
+     d2e:	0f 88 a9 00 00 00    	js     ddd <fopen+0x16d>
+     d34:	83 ec 0c             	sub    $0xc,%esp
+     d37:	68 00 02 00 00       	push   $0x200
+     d3c:	e8 af 0c 00 00       	call   19f0 <malloc>
+     d41:	83 c4 10             	add    $0x10,%esp
+     d44:	89 43 08             	mov    %eax,0x8(%ebx)
+     d47:	85 c0                	test   %eax,%eax
+     d49:	0f 84 d0 00 00 00    	je     e1f <fopen+0x1af>
+  f->flags = flags|IO_MALLOC;
+     d4f:	81 cf 80 00 00 00    	or     $0x80,%edi
+  f->fd = fd;
+     d55:	89 33                	mov    %esi,(%ebx)
+  f->size = BUFSIZ;
+     d57:	c7 43 0c 00 02 00 00 	movl   $0x200,0xc(%ebx)
+  f->r = f->n = 0;
+     d5e:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+     d65:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  f->flags = flags|IO_MALLOC;
+     d6c:	89 7b 04             	mov    %edi,0x4(%ebx)
+}
+     d6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d72:	89 d8                	mov    %ebx,%eax
+     d74:	5b                   	pop    %ebx
+     d75:	5e                   	pop    %esi
+     d76:	5f                   	pop    %edi
+     d77:	5d                   	pop    %ebp
+     d78:	c3                   	ret
+     d79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     d80:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+     d85:	75 8d                	jne    d14 <fopen+0xa4>
+      unlink(path);
+     d87:	83 ec 0c             	sub    $0xc,%esp
+     d8a:	57                   	push   %edi
+     d8b:	e8 eb f7 ff ff       	call   57b <unlink>
+     d90:	83 c4 10             	add    $0x10,%esp
+     d93:	e9 7c ff ff ff       	jmp    d14 <fopen+0xa4>
+     d98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d9f:	90                   	nop
+    mutex_lock(&iolock);
+     da0:	83 ec 0c             	sub    $0xc,%esp
+     da3:	68 44 29 00 00       	push   $0x2944
+     da8:	e8 03 f6 ff ff       	call   3b0 <mutex_lock>
+  if(threaded)
+     dad:	a1 40 29 00 00       	mov    0x2940,%eax
+     db2:	83 c4 10             	add    $0x10,%esp
+     db5:	e9 f9 fe ff ff       	jmp    cb3 <fopen+0x43>
+     dba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    fd = open(path, O_RDONLY);
+     dc0:	83 ec 08             	sub    $0x8,%esp
+     dc3:	6a 00                	push   $0x0
+     dc5:	57                   	push   %edi
+    flags = IO_READ;
+     dc6:	bf 01 00 00 00       	mov    $0x1,%edi
+    fd = open(path, O_RDONLY);
+     dcb:	e8 8d f7 ff ff       	call   55d <open>
+     dd0:	83 c4 10             	add    $0x10,%esp
+     dd3:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     dd5:	85 f6                	test   %esi,%esi
+     dd7:	0f 89 57 ff ff ff    	jns    d34 <fopen+0xc4>
+    f->flags = 0;
+     ddd:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    return 0;
+     de4:	31 db                	xor    %ebx,%ebx
+     de6:	eb 87                	jmp    d6f <fopen+0xff>
+     de8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     def:	90                   	nop
+    mutex_unlock(&iolock);
+     df0:	83 ec 0c             	sub    $0xc,%esp
+     df3:	68 44 29 00 00       	push   $0x2944
+     df8:	e8 03 f6 ff ff       	call   400 <mutex_unlock>
+     dfd:	83 c4 10             	add    $0x10,%esp
+     e00:	e9 f2 fe ff ff       	jmp    cf7 <fopen+0x87>
+     e05:	8d 76 00             	lea    0x0(%esi),%esi
+     e08:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+     e0b:	31 db                	xor    %ebx,%ebx
+    mutex_unlock(&iolock);
+     e0d:	68 44 29 00 00       	push   $0x2944
+     e12:	e8 e9 f5 ff ff       	call   400 <mutex_unlock>
+     e17:	83 c4 10             	add    $0x10,%esp
+     e1a:	e9 50 ff ff ff       	jmp    d6f <fopen+0xff>
+      close(fd);
+     e1f:	83 ec 0c             	sub    $0xc,%esp
+     e22:	56                   	push   %esi
+     e23:	e8 08 f7 ff ff       	call   530 <close>
+     e28:	83 c4 10             	add    $0x10,%esp
+     e2b:	eb b0                	jmp    ddd <fopen+0x16d>
+     e2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e30 <fclose>:
+{
+     e30:	55                   	push   %ebp
+     e31:	89 e5                	mov    %esp,%ebp
+     e33:	56                   	push   %esi
+     e34:	53                   	push   %ebx
+  if(threaded)
+     e35:	8b 15 40 29 00 00    	mov    0x2940,%edx
+{
+     e3b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+     e3e:	85 d2                	test   %edx,%edx
+     e40:	75 46                	jne    e88 <fclose+0x58>
+  r = flush(f);
+     e42:	89 d8                	mov    %ebx,%eax
+     e44:	e8 27 fc ff ff       	call   a70 <flush>
+  if(close(f->fd) < 0)
+     e49:	83 ec 0c             	sub    $0xc,%esp
+     e4c:	ff 33                	push   (%ebx)
+  r = flush(f);
+     e4e:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+     e50:	e8 db f6 ff ff       	call   530 <close>
+     e55:	83 c4 10             	add    $0x10,%esp
+    r = EOF;
+     e58:	85 c0                	test   %eax,%eax
+     e5a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     e5f:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->flags & IO_MALLOC)
+     e62:	f6 43 04 80          	testb  $0x80,0x4(%ebx)
+     e66:	75 58                	jne    ec0 <fclose+0x90>
+  if(threaded)
+     e68:	a1 40 29 00 00       	mov    0x2940,%eax
+  f->flags = 0;
+     e6d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  if(threaded)
+     e74:	85 c0                	test   %eax,%eax
+     e76:	75 28                	jne    ea0 <fclose+0x70>
+}
+     e78:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e7b:	89 f0                	mov    %esi,%eax
+     e7d:	5b                   	pop    %ebx
+     e7e:	5e                   	pop    %esi
+     e7f:	5d                   	pop    %ebp
+     e80:	c3                   	ret
+     e81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     e88:	83 ec 0c             	sub    $0xc,%esp
+     e8b:	8d 43 18             	lea    0x18(%ebx),%eax
+     e8e:	50                   	push   %eax
+     e8f:	e8 1c f5 ff ff       	call   3b0 <mutex_lock>
+     e94:	83 c4 10             	add    $0x10,%esp
+     e97:	eb a9                	jmp    e42 <fclose+0x12>
+     e99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     ea0:	83 ec 0c             	sub    $0xc,%esp
+     ea3:	83 c3 18             	add    $0x18,%ebx
+     ea6:	53                   	push   %ebx
+     ea7:	e8 54 f5 ff ff       	call   400 <mutex_unlock>
+     eac:	83 c4 10             	add    $0x10,%esp
+}
+     eaf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     eb2:	89 f0                	mov    %esi,%eax
+     eb4:	5b                   	pop    %ebx
+     eb5:	5e                   	pop    %esi
+     eb6:	5d                   	pop    %ebp
+     eb7:	c3                   	ret
+     eb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ebf:	90                   	nop
+    free(f->buf);
+     ec0:	83 ec 0c             	sub    $0xc,%esp
+     ec3:	ff 73 08             	push   0x8(%ebx)
+     ec6:	e8 f5 09 00 00       	call   18c0 <free>
+     ecb:	83 c4 10             	add    $0x10,%esp
+     ece:	eb 98                	jmp    e68 <fclose+0x38>
+
+00000ed0 <fflush>:
+{
+     ed0:	55                   	push   %ebp
+     ed1:	89 e5                	mov    %esp,%ebp
+     ed3:	53                   	push   %ebx
+     ed4:	83 ec 14             	sub    $0x14,%esp
+     ed7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f == 0){
+     eda:	85 db                	test   %ebx,%ebx
+     edc:	74 5a                	je     f38 <fflush+0x68>
+  if(threaded)
+     ede:	8b 0d 40 29 00 00    	mov    0x2940,%ecx
+     ee4:	85 c9                	test   %ecx,%ecx
+     ee6:	75 18                	jne    f00 <fflush+0x30>
+  r = flush(f);
+     ee8:	89 d8                	mov    %ebx,%eax
+     eea:	e8 81 fb ff ff       	call   a70 <flush>
+  if(threaded)
+     eef:	8b 15 40 29 00 00    	mov    0x2940,%edx
+     ef5:	85 d2                	test   %edx,%edx
+     ef7:	75 1f                	jne    f18 <fflush+0x48>
+}
+     ef9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     efc:	c9                   	leave
+     efd:	c3                   	ret
+     efe:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+     f00:	83 ec 0c             	sub    $0xc,%esp
+     f03:	8d 43 18             	lea    0x18(%ebx),%eax
+     f06:	50                   	push   %eax
+     f07:	e8 a4 f4 ff ff       	call   3b0 <mutex_lock>
+     f0c:	83 c4 10             	add    $0x10,%esp
+     f0f:	eb d7                	jmp    ee8 <fflush+0x18>
+     f11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     f18:	83 ec 0c             	sub    $0xc,%esp
+     f1b:	83 c3 18             	add    $0x18,%ebx
+     f1e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     f21:	53                   	push   %ebx
+     f22:	e8 d9 f4 ff ff       	call   400 <mutex_unlock>
+     f27:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     f2a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    mutex_unlock(&f->lock);
+     f2d:	83 c4 10             	add    $0x10,%esp
+}
+     f30:	c9                   	leave
+     f31:	c3                   	ret
+     f32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     f38:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f3b:	c9                   	leave
+     f3c:	e9 af fb ff ff       	jmp    af0 <fflush.part.0>
+     f41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f4f:	90                   	nop
+
+00000f50 <putc_unlocked>:
+{
+     f50:	55                   	push   %ebp
+     f51:	89 e5                	mov    %esp,%ebp
+     f53:	56                   	push   %esi
+     f54:	53                   	push   %ebx
+     f55:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     f58:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(!(f->flags & IO_WRITE))
+     f5b:	8b 43 04             	mov    0x4(%ebx),%eax
+     f5e:	a8 02                	test   $0x2,%al
+     f60:	74 46                	je     fa8 <putc_unlocked+0x58>
+  if(!(f->flags & IO_SETUP))
+     f62:	a8 40                	test   $0x40,%al
+     f64:	74 4a                	je     fb0 <putc_unlocked+0x60>
+  if(f->n == f->size && flush(f) < 0)
+     f66:	8b 43 14             	mov    0x14(%ebx),%eax
+     f69:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     f6c:	74 51                	je     fbf <putc_unlocked+0x6f>
+  f->buf[f->n++] = c;
+     f6e:	8d 48 01             	lea    0x1(%eax),%ecx
+     f71:	8b 53 08             	mov    0x8(%ebx),%edx
+     f74:	89 4b 14             	mov    %ecx,0x14(%ebx)
+     f77:	89 f1                	mov    %esi,%ecx
+     f79:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     f7c:	83 fe 0a             	cmp    $0xa,%esi
+     f7f:	74 0f                	je     f90 <putc_unlocked+0x40>
+  return c & 0xff;
+     f81:	89 f0                	mov    %esi,%eax
+     f83:	0f b6 c0             	movzbl %al,%eax
+}
+     f86:	5b                   	pop    %ebx
+     f87:	5e                   	pop    %esi
+     f88:	5d                   	pop    %ebp
+     f89:	c3                   	ret
+     f8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     f90:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+     f94:	74 eb                	je     f81 <putc_unlocked+0x31>
+     f96:	89 d8                	mov    %ebx,%eax
+     f98:	e8 d3 fa ff ff       	call   a70 <flush>
+     f9d:	85 c0                	test   %eax,%eax
+     f9f:	79 e0                	jns    f81 <putc_unlocked+0x31>
+     fa1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return EOF;
+     fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     fad:	eb d7                	jmp    f86 <putc_unlocked+0x36>
+     faf:	90                   	nop
+    setup(f);
+     fb0:	89 d8                	mov    %ebx,%eax
+     fb2:	e8 69 fa ff ff       	call   a20 <setup>
+  if(f->n == f->size && flush(f) < 0)
+     fb7:	8b 43 14             	mov    0x14(%ebx),%eax
+     fba:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     fbd:	75 af                	jne    f6e <putc_unlocked+0x1e>
+     fbf:	89 d8                	mov    %ebx,%eax
+     fc1:	e8 aa fa ff ff       	call   a70 <flush>
+     fc6:	85 c0                	test   %eax,%eax
+     fc8:	78 de                	js     fa8 <putc_unlocked+0x58>
+  f->buf[f->n++] = c;
+     fca:	8b 43 14             	mov    0x14(%ebx),%eax
+     fcd:	eb 9f                	jmp    f6e <putc_unlocked+0x1e>
+     fcf:	90                   	nop
+
+00000fd0 <fputc>:
+{
+     fd0:	55                   	push   %ebp
+     fd1:	89 e5                	mov    %esp,%ebp
+     fd3:	56                   	push   %esi
+     fd4:	53                   	push   %ebx
+  if(threaded)
+     fd5:	8b 15 40 29 00 00    	mov    0x2940,%edx
+{
+     fdb:	8b 75 08             	mov    0x8(%ebp),%esi
+     fde:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(threaded)
+     fe1:	85 d2                	test   %edx,%edx
+     fe3:	75 6b                	jne    1050 <fputc+0x80>
+  if(!(f->flags & IO_WRITE))
+     fe5:	8b 43 04             	mov    0x4(%ebx),%eax
+     fe8:	a8 02                	test   $0x2,%al
+     fea:	0f 84 b8 00 00 00    	je     10a8 <fputc+0xd8>
+  if(!(f->flags & IO_SETUP))
+     ff0:	a8 40                	test   $0x40,%al
+     ff2:	74 76                	je     106a <fputc+0x9a>
+  if(f->n == f->size && flush(f) < 0)
+     ff4:	8b 43 14             	mov    0x14(%ebx),%eax
+     ff7:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     ffa:	74 7d                	je     1079 <fputc+0xa9>
+  f->buf[f->n++] = c;
+     ffc:	8d 48 01             	lea    0x1(%eax),%ecx
+     fff:	8b 53 08             	mov    0x8(%ebx),%edx
+    1002:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    1005:	89 f1                	mov    %esi,%ecx
+    1007:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    100a:	83 fe 0a             	cmp    $0xa,%esi
+    100d:	74 21                	je     1030 <fputc+0x60>
+  return c & 0xff;
+    100f:	89 f0                	mov    %esi,%eax
+    1011:	0f b6 f0             	movzbl %al,%esi
+  if(threaded)
+    1014:	a1 40 29 00 00       	mov    0x2940,%eax
+    1019:	85 c0                	test   %eax,%eax
+    101b:	75 73                	jne    1090 <fputc+0xc0>
+}
+    101d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1020:	89 f0                	mov    %esi,%eax
+    1022:	5b                   	pop    %ebx
+    1023:	5e                   	pop    %esi
+    1024:	5d                   	pop    %ebp
+    1025:	c3                   	ret
+    1026:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    102d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    1030:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1034:	74 d9                	je     100f <fputc+0x3f>
+    1036:	89 d8                	mov    %ebx,%eax
+    1038:	e8 33 fa ff ff       	call   a70 <flush>
+    103d:	85 c0                	test   %eax,%eax
+    103f:	79 ce                	jns    100f <fputc+0x3f>
+    return EOF;
+    1041:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1046:	eb cc                	jmp    1014 <fputc+0x44>
+    1048:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    104f:	90                   	nop
+    mutex_lock(&f->lock);
+    1050:	83 ec 0c             	sub    $0xc,%esp
+    1053:	8d 43 18             	lea    0x18(%ebx),%eax
+    1056:	50                   	push   %eax
+    1057:	e8 54 f3 ff ff       	call   3b0 <mutex_lock>
+  if(!(f->flags & IO_WRITE))
+    105c:	8b 43 04             	mov    0x4(%ebx),%eax
+    105f:	83 c4 10             	add    $0x10,%esp
+    1062:	a8 02                	test   $0x2,%al
+    1064:	74 db                	je     1041 <fputc+0x71>
+  if(!(f->flags & IO_SETUP))
+    1066:	a8 40                	test   $0x40,%al
+    1068:	75 8a                	jne    ff4 <fputc+0x24>
+    setup(f);
+    106a:	89 d8                	mov    %ebx,%eax
+    106c:	e8 af f9 ff ff       	call   a20 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    1071:	8b 43 14             	mov    0x14(%ebx),%eax
+    1074:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    1077:	75 83                	jne    ffc <fputc+0x2c>
+    1079:	89 d8                	mov    %ebx,%eax
+    107b:	e8 f0 f9 ff ff       	call   a70 <flush>
+    1080:	85 c0                	test   %eax,%eax
+    1082:	78 bd                	js     1041 <fputc+0x71>
+  f->buf[f->n++] = c;
+    1084:	8b 43 14             	mov    0x14(%ebx),%eax
+    1087:	e9 70 ff ff ff       	jmp    ffc <fputc+0x2c>
+    108c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1090:	83 ec 0c             	sub    $0xc,%esp
+    1093:	83 c3 18             	add    $0x18,%ebx
+    1096:	53                   	push   %ebx
+    1097:	e8 64 f3 ff ff       	call   400 <mutex_unlock>
+    109c:	83 c4 10             	add    $0x10,%esp
+}
+    109f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    10a2:	89 f0                	mov    %esi,%eax
+    10a4:	5b                   	pop    %ebx
+    10a5:	5e                   	pop    %esi
+    10a6:	5d                   	pop    %ebp
+    10a7:	c3                   	ret
+    return EOF;
+    10a8:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    10ad:	e9 6b ff ff ff       	jmp    101d <fputc+0x4d>
+    10b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000010c0 <fwrite>:
+{
+    10c0:	55                   	push   %ebp
+    10c1:	89 e5                	mov    %esp,%ebp
+    10c3:	57                   	push   %edi
+    10c4:	56                   	push   %esi
+    10c5:	53                   	push   %ebx
+    10c6:	83 ec 1c             	sub    $0x1c,%esp
+    10c9:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  if(!(f->flags & IO_WRITE) || size <= 0)
+    10cc:	8b 43 04             	mov    0x4(%ebx),%eax
+    10cf:	a8 02                	test   $0x2,%al
+    10d1:	0f 84 ec 00 00 00    	je     11c3 <fwrite+0x103>
+    10d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    10da:	85 c9                	test   %ecx,%ecx
+    10dc:	0f 8e e1 00 00 00    	jle    11c3 <fwrite+0x103>
+  if(threaded)
+    10e2:	8b 15 40 29 00 00    	mov    0x2940,%edx
+    10e8:	85 d2                	test   %edx,%edx
+    10ea:	0f 85 1c 01 00 00    	jne    120c <fwrite+0x14c>
+  if(!(f->flags & IO_SETUP))
+    10f0:	a8 40                	test   $0x40,%al
+    10f2:	0f 84 08 01 00 00    	je     1200 <fwrite+0x140>
+  for(len = size*nmemb; len > 0; len -= n){
+    10f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+    10fb:	0f af 45 10          	imul   0x10(%ebp),%eax
+    10ff:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    1102:	85 c0                	test   %eax,%eax
+    1104:	0f 8e 2a 01 00 00    	jle    1234 <fwrite+0x174>
+  s = p;
+    110a:	8b 45 08             	mov    0x8(%ebp),%eax
+  nl = 0;
+    110d:	31 ff                	xor    %edi,%edi
+    110f:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+        nl = 1;
+    1112:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  s = p;
+    1115:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1118:	8b 43 14             	mov    0x14(%ebx),%eax
+        nl = 1;
+    111b:	89 ce                	mov    %ecx,%esi
+    if(f->n == f->size && flush(f) < 0)
+    111d:	89 c2                	mov    %eax,%edx
+    111f:	39 f0                	cmp    %esi,%eax
+    1121:	74 6e                	je     1191 <fwrite+0xd1>
+    1123:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1127:	90                   	nop
+    if(n > len)
+    1128:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    n = f->size - f->n;
+    112b:	89 f1                	mov    %esi,%ecx
+    112d:	29 c1                	sub    %eax,%ecx
+    112f:	39 f9                	cmp    %edi,%ecx
+    1131:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1134:	85 c9                	test   %ecx,%ecx
+    1136:	0f 8e 7c 00 00 00    	jle    11b8 <fwrite+0xf8>
+    113c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    113f:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1142:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    1145:	8d 34 08             	lea    (%eax,%ecx,1),%esi
+    1148:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    114b:	eb 06                	jmp    1153 <fwrite+0x93>
+    114d:	8d 76 00             	lea    0x0(%esi),%esi
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1150:	8b 53 14             	mov    0x14(%ebx),%edx
+    1153:	8d 4a 01             	lea    0x1(%edx),%ecx
+    1156:	8b 73 08             	mov    0x8(%ebx),%esi
+    1159:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    115c:	0f b6 08             	movzbl (%eax),%ecx
+        nl = 1;
+    115f:	80 f9 0a             	cmp    $0xa,%cl
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1162:	88 0c 16             	mov    %cl,(%esi,%edx,1)
+        nl = 1;
+    1165:	be 01 00 00 00       	mov    $0x1,%esi
+    116a:	0f 44 fe             	cmove  %esi,%edi
+    for(i = 0; i < n; i++)
+    116d:	83 c0 01             	add    $0x1,%eax
+    1170:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    1173:	75 db                	jne    1150 <fwrite+0x90>
+    s += n;
+    1175:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1178:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    117b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    s += n;
+    117e:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    1181:	85 c0                	test   %eax,%eax
+    1183:	7e 48                	jle    11cd <fwrite+0x10d>
+    1185:	8b 43 14             	mov    0x14(%ebx),%eax
+    1188:	8b 73 0c             	mov    0xc(%ebx),%esi
+    if(f->n == f->size && flush(f) < 0)
+    118b:	89 c2                	mov    %eax,%edx
+    118d:	39 f0                	cmp    %esi,%eax
+    118f:	75 97                	jne    1128 <fwrite+0x68>
+    1191:	89 d8                	mov    %ebx,%eax
+    1193:	e8 d8 f8 ff ff       	call   a70 <flush>
+    1198:	85 c0                	test   %eax,%eax
+    119a:	78 31                	js     11cd <fwrite+0x10d>
+    n = f->size - f->n;
+    119c:	8b 73 0c             	mov    0xc(%ebx),%esi
+    119f:	8b 43 14             	mov    0x14(%ebx),%eax
+    11a2:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    11a5:	89 f1                	mov    %esi,%ecx
+    11a7:	89 c2                	mov    %eax,%edx
+    11a9:	29 c1                	sub    %eax,%ecx
+    11ab:	39 f9                	cmp    %edi,%ecx
+    11ad:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    11b0:	85 c9                	test   %ecx,%ecx
+    11b2:	7f 88                	jg     113c <fwrite+0x7c>
+    11b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    s += n;
+    11b8:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    11bb:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    11be:	e9 5a ff ff ff       	jmp    111d <fwrite+0x5d>
+}
+    11c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    11c6:	31 c0                	xor    %eax,%eax
+}
+    11c8:	5b                   	pop    %ebx
+    11c9:	5e                   	pop    %esi
+    11ca:	5f                   	pop    %edi
+    11cb:	5d                   	pop    %ebp
+    11cc:	c3                   	ret
+  if(nl && (f->flags & IO_LINE))
+    11cd:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    11d0:	85 ff                	test   %edi,%edi
+    11d2:	74 06                	je     11da <fwrite+0x11a>
+    11d4:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    11d8:	75 1d                	jne    11f7 <fwrite+0x137>
+  return (s - (const char*)p) / size;
+    11da:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    11dd:	2b 75 08             	sub    0x8(%ebp),%esi
+  if(threaded)
+    11e0:	a1 40 29 00 00       	mov    0x2940,%eax
+    11e5:	85 c0                	test   %eax,%eax
+    11e7:	75 3a                	jne    1223 <fwrite+0x163>
+  return (s - (const char*)p) / size;
+    11e9:	89 f0                	mov    %esi,%eax
+    11eb:	99                   	cltd
+    11ec:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    11ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11f2:	5b                   	pop    %ebx
+    11f3:	5e                   	pop    %esi
+    11f4:	5f                   	pop    %edi
+    11f5:	5d                   	pop    %ebp
+    11f6:	c3                   	ret
+    flush(f);
+    11f7:	89 d8                	mov    %ebx,%eax
+    11f9:	e8 72 f8 ff ff       	call   a70 <flush>
+    11fe:	eb da                	jmp    11da <fwrite+0x11a>
+    setup(f);
+    1200:	89 d8                	mov    %ebx,%eax
+    1202:	e8 19 f8 ff ff       	call   a20 <setup>
+    1207:	e9 ec fe ff ff       	jmp    10f8 <fwrite+0x38>
+    mutex_lock(&f->lock);
+    120c:	83 ec 0c             	sub    $0xc,%esp
+    120f:	8d 43 18             	lea    0x18(%ebx),%eax
+    1212:	50                   	push   %eax
+    1213:	e8 98 f1 ff ff       	call   3b0 <mutex_lock>
+  if(!(f->flags & IO_SETUP))
+    1218:	8b 43 04             	mov    0x4(%ebx),%eax
+    121b:	83 c4 10             	add    $0x10,%esp
+    121e:	e9 cd fe ff ff       	jmp    10f0 <fwrite+0x30>
+    mutex_unlock(&f->lock);
+    1223:	83 ec 0c             	sub    $0xc,%esp
+    1226:	83 c3 18             	add    $0x18,%ebx
+    1229:	53                   	push   %ebx
+    122a:	e8 d1 f1 ff ff       	call   400 <mutex_unlock>
+    122f:	83 c4 10             	add    $0x10,%esp
+    1232:	eb b5                	jmp    11e9 <fwrite+0x129>
+  for(len = size*nmemb; len > 0; len -= n){
+    1234:	31 f6                	xor    %esi,%esi
+    1236:	eb a8                	jmp    11e0 <fwrite+0x120>
+    1238:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    123f:	90                   	nop
+
+00001240 <fgetc>:
+  return f->buf[f->r++] & 0xff;
+}
+
+int
+fgetc(FILE *f)
+{
+    1240:	55                   	push   %ebp
+    1241:	89 e5                	mov    %esp,%ebp
+    1243:	56                   	push   %esi
+    1244:	53                   	push   %ebx
+  if(threaded)
+    1245:	8b 15 40 29 00 00    	mov    0x2940,%edx
+{
+    124b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    124e:	85 d2                	test   %edx,%edx
+    1250:	75 2e                	jne    1280 <fgetc+0x40>
+  if(!(f->flags & IO_READ))
+    1252:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1256:	74 78                	je     12d0 <fgetc+0x90>
+  if(f->r == f->n && fill(f) == 0)
+    1258:	8b 43 10             	mov    0x10(%ebx),%eax
+    125b:	3b 43 14             	cmp    0x14(%ebx),%eax
+    125e:	74 60                	je     12c0 <fgetc+0x80>
+  return f->buf[f->r++] & 0xff;
+    1260:	8b 53 08             	mov    0x8(%ebx),%edx
+    1263:	8d 48 01             	lea    0x1(%eax),%ecx
+    1266:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1269:	0f b6 34 02          	movzbl (%edx,%eax,1),%esi
+  if(threaded)
+    126d:	a1 40 29 00 00       	mov    0x2940,%eax
+    1272:	85 c0                	test   %eax,%eax
+    1274:	75 2a                	jne    12a0 <fgetc+0x60>
+
+  flockfile(f);
+  c = getc_unlocked(f);
+  funlockfile(f);
+  return c;
+}
+    1276:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1279:	89 f0                	mov    %esi,%eax
+    127b:	5b                   	pop    %ebx
+    127c:	5e                   	pop    %esi
+    127d:	5d                   	pop    %ebp
+    127e:	c3                   	ret
+    127f:	90                   	nop
+    mutex_lock(&f->lock);
+    1280:	83 ec 0c             	sub    $0xc,%esp
+    1283:	8d 43 18             	lea    0x18(%ebx),%eax
+    1286:	50                   	push   %eax
+    1287:	e8 24 f1 ff ff       	call   3b0 <mutex_lock>
+  if(!(f->flags & IO_READ))
+    128c:	83 c4 10             	add    $0x10,%esp
+    128f:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1293:	75 c3                	jne    1258 <fgetc+0x18>
+    return EOF;
+    1295:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    129a:	eb d1                	jmp    126d <fgetc+0x2d>
+    129c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    12a0:	83 ec 0c             	sub    $0xc,%esp
+    12a3:	83 c3 18             	add    $0x18,%ebx
+    12a6:	53                   	push   %ebx
+    12a7:	e8 54 f1 ff ff       	call   400 <mutex_unlock>
+    12ac:	83 c4 10             	add    $0x10,%esp
+}
+    12af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12b2:	89 f0                	mov    %esi,%eax
+    12b4:	5b                   	pop    %ebx
+    12b5:	5e                   	pop    %esi
+    12b6:	5d                   	pop    %ebp
+    12b7:	c3                   	ret
+    12b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12bf:	90                   	nop
+  if(f->r == f->n && fill(f) == 0)
+    12c0:	89 d8                	mov    %ebx,%eax
+    12c2:	e8 c9 f8 ff ff       	call   b90 <fill>
+    12c7:	85 c0                	test   %eax,%eax
+    12c9:	74 ca                	je     1295 <fgetc+0x55>
+  return f->buf[f->r++] & 0xff;
+    12cb:	8b 43 10             	mov    0x10(%ebx),%eax
+    12ce:	eb 90                	jmp    1260 <fgetc+0x20>
+    return EOF;
+    12d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    12d5:	eb 9f                	jmp    1276 <fgetc+0x36>
+    12d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12de:	66 90                	xchg   %ax,%ax
+
+000012e0 <fread>:
+
+int
+fread(void *p, int size, int nmemb, FILE *f)
+{
+    12e0:	55                   	push   %ebp
+    12e1:	89 e5                	mov    %esp,%ebp
+    12e3:	57                   	push   %edi
+    12e4:	56                   	push   %esi
+    12e5:	53                   	push   %ebx
+    12e6:	83 ec 1c             	sub    $0x1c,%esp
+    12e9:	8b 75 14             	mov    0x14(%ebp),%esi
+  char *d;
+  int n, len;
+
+  if(!(f->flags & IO_READ) || size <= 0)
+    12ec:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+    12f0:	74 7e                	je     1370 <fread+0x90>
+    12f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+    12f5:	85 d2                	test   %edx,%edx
+    12f7:	7e 77                	jle    1370 <fread+0x90>
+  if(threaded)
+    12f9:	a1 40 29 00 00       	mov    0x2940,%eax
+    return 0;
+  flockfile(f);
+  d = p;
+  for(len = size*nmemb; len > 0; len -= n){
+    12fe:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1301:	0f af 7d 10          	imul   0x10(%ebp),%edi
+  if(threaded)
+    1305:	85 c0                	test   %eax,%eax
+    1307:	0f 85 93 00 00 00    	jne    13a0 <fread+0xc0>
+  for(len = size*nmemb; len > 0; len -= n){
+    130d:	85 ff                	test   %edi,%edi
+    130f:	7e 61                	jle    1372 <fread+0x92>
+    if(f->r == f->n && fill(f) == 0)
+    1311:	8b 46 10             	mov    0x10(%esi),%eax
+  d = p;
+    1314:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1317:	eb 35                	jmp    134e <fread+0x6e>
+    1319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      break;
+    n = f->n - f->r;
+    1320:	29 c3                	sub    %eax,%ebx
+    1322:	39 fb                	cmp    %edi,%ebx
+    1324:	0f 4f df             	cmovg  %edi,%ebx
+    if(n > len)
+      n = len;
+    memmove(d, f->buf + f->r, n);
+    1327:	83 ec 04             	sub    $0x4,%esp
+    132a:	53                   	push   %ebx
+    132b:	03 46 08             	add    0x8(%esi),%eax
+  for(len = size*nmemb; len > 0; len -= n){
+    132e:	29 df                	sub    %ebx,%edi
+    memmove(d, f->buf + f->r, n);
+    1330:	50                   	push   %eax
+    1331:	51                   	push   %ecx
+    1332:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1335:	e8 36 f0 ff ff       	call   370 <memmove>
+    f->r += n;
+    133a:	8b 46 10             	mov    0x10(%esi),%eax
+    d += n;
+    133d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1340:	83 c4 10             	add    $0x10,%esp
+    f->r += n;
+    1343:	01 d8                	add    %ebx,%eax
+    d += n;
+    1345:	01 d9                	add    %ebx,%ecx
+    f->r += n;
+    1347:	89 46 10             	mov    %eax,0x10(%esi)
+  for(len = size*nmemb; len > 0; len -= n){
+    134a:	85 ff                	test   %edi,%edi
+    134c:	7e 32                	jle    1380 <fread+0xa0>
+    if(f->r == f->n && fill(f) == 0)
+    134e:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1351:	39 c3                	cmp    %eax,%ebx
+    1353:	75 cb                	jne    1320 <fread+0x40>
+    1355:	89 f0                	mov    %esi,%eax
+    1357:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    135a:	e8 31 f8 ff ff       	call   b90 <fill>
+    135f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1362:	85 c0                	test   %eax,%eax
+    1364:	74 1a                	je     1380 <fread+0xa0>
+    n = f->n - f->r;
+    1366:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1369:	8b 46 10             	mov    0x10(%esi),%eax
+    136c:	eb b2                	jmp    1320 <fread+0x40>
+    136e:	66 90                	xchg   %ax,%ax
+    return 0;
+    1370:	31 c0                	xor    %eax,%eax
+  }
+  funlockfile(f);
+  return (d - (char*)p) / size;
+}
+    1372:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1375:	5b                   	pop    %ebx
+    1376:	5e                   	pop    %esi
+    1377:	5f                   	pop    %edi
+    1378:	5d                   	pop    %ebp
+    1379:	c3                   	ret
+    137a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (d - (char*)p) / size;
+    1380:	2b 4d 08             	sub    0x8(%ebp),%ecx
+    1383:	89 cb                	mov    %ecx,%ebx
+  if(threaded)
+    1385:	a1 40 29 00 00       	mov    0x2940,%eax
+    138a:	85 c0                	test   %eax,%eax
+    138c:	75 32                	jne    13c0 <fread+0xe0>
+  return (d - (char*)p) / size;
+    138e:	89 d8                	mov    %ebx,%eax
+    1390:	99                   	cltd
+    1391:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1394:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1397:	5b                   	pop    %ebx
+    1398:	5e                   	pop    %esi
+    1399:	5f                   	pop    %edi
+    139a:	5d                   	pop    %ebp
+    139b:	c3                   	ret
+    139c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    13a0:	83 ec 0c             	sub    $0xc,%esp
+    13a3:	8d 46 18             	lea    0x18(%esi),%eax
+    13a6:	50                   	push   %eax
+    13a7:	e8 04 f0 ff ff       	call   3b0 <mutex_lock>
+  for(len = size*nmemb; len > 0; len -= n){
+    13ac:	83 c4 10             	add    $0x10,%esp
+    13af:	85 ff                	test   %edi,%edi
+    13b1:	0f 8f 5a ff ff ff    	jg     1311 <fread+0x31>
+    13b7:	31 db                	xor    %ebx,%ebx
+    13b9:	eb ca                	jmp    1385 <fread+0xa5>
+    13bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    13bf:	90                   	nop
+    mutex_unlock(&f->lock);
+    13c0:	83 ec 0c             	sub    $0xc,%esp
+    13c3:	83 c6 18             	add    $0x18,%esi
+    13c6:	56                   	push   %esi
+    13c7:	e8 34 f0 ff ff       	call   400 <mutex_unlock>
+  return (d - (char*)p) / size;
+    13cc:	89 d8                	mov    %ebx,%eax
+    13ce:	83 c4 10             	add    $0x10,%esp
+    13d1:	99                   	cltd
+    13d2:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    13d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13d8:	5b                   	pop    %ebx
+    13d9:	5e                   	pop    %esi
+    13da:	5f                   	pop    %edi
+    13db:	5d                   	pop    %ebp
+    13dc:	c3                   	ret
+    13dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000013e0 <fgets>:
+
+// Read a line of at most max-1 bytes, keeping the newline.
+// Returns 0 if there was nothing left to read.
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    13e0:	55                   	push   %ebp
+    13e1:	89 e5                	mov    %esp,%ebp
+    13e3:	57                   	push   %edi
+    13e4:	56                   	push   %esi
+    13e5:	53                   	push   %ebx
+    13e6:	83 ec 1c             	sub    $0x1c,%esp
+  if(threaded)
+    13e9:	8b 35 40 29 00 00    	mov    0x2940,%esi
+{
+    13ef:	8b 7d 08             	mov    0x8(%ebp),%edi
+    13f2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if(threaded)
+    13f5:	85 f6                	test   %esi,%esi
+    13f7:	0f 85 83 00 00 00    	jne    1480 <fgets+0xa0>
+{
+    13fd:	31 f6                	xor    %esi,%esi
+    13ff:	eb 2a                	jmp    142b <fgets+0x4b>
+    1401:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return f->buf[f->r++] & 0xff;
+    1408:	8b 53 08             	mov    0x8(%ebx),%edx
+    140b:	8d 48 01             	lea    0x1(%eax),%ecx
+    140e:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1411:	0f b6 14 02          	movzbl (%edx,%eax,1),%edx
+
+  flockfile(f);
+  for(i = 0; i+1 < max; ){
+    if((c = getc_unlocked(f)) == EOF)
+      break;
+    buf[i++] = c;
+    1415:	88 54 37 ff          	mov    %dl,-0x1(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    1419:	80 fa 0a             	cmp    $0xa,%dl
+    141c:	0f 84 96 00 00 00    	je     14b8 <fgets+0xd8>
+    1422:	83 fa 0d             	cmp    $0xd,%edx
+    1425:	0f 84 8d 00 00 00    	je     14b8 <fgets+0xd8>
+  for(i = 0; i+1 < max; ){
+    142b:	89 f2                	mov    %esi,%edx
+    142d:	83 c6 01             	add    $0x1,%esi
+    1430:	3b 75 0c             	cmp    0xc(%ebp),%esi
+    1433:	7d 2b                	jge    1460 <fgets+0x80>
+  if(!(f->flags & IO_READ))
+    1435:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1439:	74 25                	je     1460 <fgets+0x80>
+  if(f->r == f->n && fill(f) == 0)
+    143b:	8b 43 10             	mov    0x10(%ebx),%eax
+    143e:	3b 43 14             	cmp    0x14(%ebx),%eax
+    1441:	75 c5                	jne    1408 <fgets+0x28>
+    1443:	89 d8                	mov    %ebx,%eax
+    1445:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1448:	e8 43 f7 ff ff       	call   b90 <fill>
+    144d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1450:	85 c0                	test   %eax,%eax
+    1452:	74 0c                	je     1460 <fgets+0x80>
+  return f->buf[f->r++] & 0xff;
+    1454:	8b 43 10             	mov    0x10(%ebx),%eax
+    1457:	eb af                	jmp    1408 <fgets+0x28>
+    1459:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1460:	8b 0d 40 29 00 00    	mov    0x2940,%ecx
+      break;
+  }
+  buf[i] = '\0';
+    1466:	c6 04 17 00          	movb   $0x0,(%edi,%edx,1)
+  if(threaded)
+    146a:	85 c9                	test   %ecx,%ecx
+    146c:	75 2a                	jne    1498 <fgets+0xb8>
+  funlockfile(f);
+  return i > 0 ? buf : 0;
+    146e:	31 c0                	xor    %eax,%eax
+    1470:	85 d2                	test   %edx,%edx
+    1472:	74 02                	je     1476 <fgets+0x96>
+    1474:	89 f8                	mov    %edi,%eax
+}
+    1476:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1479:	5b                   	pop    %ebx
+    147a:	5e                   	pop    %esi
+    147b:	5f                   	pop    %edi
+    147c:	5d                   	pop    %ebp
+    147d:	c3                   	ret
+    147e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    1480:	83 ec 0c             	sub    $0xc,%esp
+    1483:	8d 43 18             	lea    0x18(%ebx),%eax
+    1486:	50                   	push   %eax
+    1487:	e8 24 ef ff ff       	call   3b0 <mutex_lock>
+    148c:	83 c4 10             	add    $0x10,%esp
+    148f:	e9 69 ff ff ff       	jmp    13fd <fgets+0x1d>
+    1494:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1498:	83 ec 0c             	sub    $0xc,%esp
+    149b:	83 c3 18             	add    $0x18,%ebx
+    149e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    14a1:	53                   	push   %ebx
+    14a2:	e8 59 ef ff ff       	call   400 <mutex_unlock>
+    14a7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    14aa:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    14ad:	31 c0                	xor    %eax,%eax
+    14af:	85 d2                	test   %edx,%edx
+    14b1:	75 c1                	jne    1474 <fgets+0x94>
+    14b3:	eb c1                	jmp    1476 <fgets+0x96>
+    14b5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    14b8:	a1 40 29 00 00       	mov    0x2940,%eax
+  buf[i] = '\0';
+    14bd:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  if(threaded)
+    14c1:	85 c0                	test   %eax,%eax
+    14c3:	74 af                	je     1474 <fgets+0x94>
+    mutex_unlock(&f->lock);
+    14c5:	83 ec 0c             	sub    $0xc,%esp
+    14c8:	83 c3 18             	add    $0x18,%ebx
+    14cb:	53                   	push   %ebx
+    14cc:	e8 2f ef ff ff       	call   400 <mutex_unlock>
+    14d1:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    14d4:	89 f8                	mov    %edi,%eax
+    14d6:	eb 9e                	jmp    1476 <fgets+0x96>
+    14d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14df:	90                   	nop
+
+000014e0 <gets>:
+// at most a line per read(), goes through stdin's buffer: from a
+// file or pipe, a buffered read could take input meant for a child
+// process, so read a byte at a time.
+char*
+gets(char *buf, int max)
+{
+    14e0:	55                   	push   %ebp
+    14e1:	89 e5                	mov    %esp,%ebp
+    14e3:	57                   	push   %edi
+    14e4:	56                   	push   %esi
+    14e5:	53                   	push   %ebx
+    14e6:	83 ec 2c             	sub    $0x2c,%esp
+  int i, cc;
+  char c;
+
+  if(!(stdin->flags & IO_SETUP))
+    14e9:	8b 15 44 28 00 00    	mov    0x2844,%edx
+{
+    14ef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!(stdin->flags & IO_SETUP))
+    14f2:	f6 c2 40             	test   $0x40,%dl
+    14f5:	74 79                	je     1570 <gets+0x90>
+    setup(stdin);
+  if(stdin->flags & IO_DEV){
+    14f7:	83 e2 20             	and    $0x20,%edx
+    14fa:	89 d7                	mov    %edx,%edi
+    14fc:	75 52                	jne    1550 <gets+0x70>
+  if(f == 0){
+    14fe:	e8 ed f5 ff ff       	call   af0 <fflush.part.0>
+    fgets(buf, max, stdin);
+    return buf;
+  }
+  fflush(0);
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1503:	8d 75 e7             	lea    -0x19(%ebp),%esi
+  for(i=0; i+1 < max; ){
+    1506:	eb 2c                	jmp    1534 <gets+0x54>
+    1508:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    150f:	90                   	nop
+    cc = read(0, &c, 1);
+    1510:	83 ec 04             	sub    $0x4,%esp
+    1513:	6a 01                	push   $0x1
+    1515:	56                   	push   %esi
+    1516:	6a 00                	push   $0x0
+    1518:	e8 f5 ef ff ff       	call   512 <read>
+    if(cc < 1)
+    151d:	83 c4 10             	add    $0x10,%esp
+    1520:	85 c0                	test   %eax,%eax
+    1522:	7e 1b                	jle    153f <gets+0x5f>
+      break;
+    buf[i++] = c;
+    1524:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1528:	88 44 3b ff          	mov    %al,-0x1(%ebx,%edi,1)
+    if(c == '\n' || c == '\r')
+    152c:	3c 0a                	cmp    $0xa,%al
+    152e:	74 12                	je     1542 <gets+0x62>
+    1530:	3c 0d                	cmp    $0xd,%al
+    1532:	74 0e                	je     1542 <gets+0x62>
+  for(i=0; i+1 < max; ){
+    1534:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    1537:	83 c7 01             	add    $0x1,%edi
+    153a:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+    153d:	7c d1                	jl     1510 <gets+0x30>
+{
+    153f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      break;
+  }
+  buf[i] = '\0';
+    1542:	c6 04 3b 00          	movb   $0x0,(%ebx,%edi,1)
+  return buf;
+}
+    1546:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1549:	89 d8                	mov    %ebx,%eax
+    154b:	5b                   	pop    %ebx
+    154c:	5e                   	pop    %esi
+    154d:	5f                   	pop    %edi
+    154e:	5d                   	pop    %ebp
+    154f:	c3                   	ret
+    fgets(buf, max, stdin);
+    1550:	83 ec 04             	sub    $0x4,%esp
+    1553:	68 40 28 00 00       	push   $0x2840
+    1558:	ff 75 0c             	push   0xc(%ebp)
+    155b:	53                   	push   %ebx
+    155c:	e8 7f fe ff ff       	call   13e0 <fgets>
+    return buf;
+    1561:	83 c4 10             	add    $0x10,%esp
+}
+    1564:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1567:	89 d8                	mov    %ebx,%eax
+    1569:	5b                   	pop    %ebx
+    156a:	5e                   	pop    %esi
+    156b:	5f                   	pop    %edi
+    156c:	5d                   	pop    %ebp
+    156d:	c3                   	ret
+    156e:	66 90                	xchg   %ax,%ax
+    setup(stdin);
+    1570:	b8 40 28 00 00       	mov    $0x2840,%eax
+    1575:	e8 a6 f4 ff ff       	call   a20 <setup>
+  if(stdin->flags & IO_DEV){
+    157a:	8b 15 44 28 00 00    	mov    0x2844,%edx
+    1580:	e9 72 ff ff ff       	jmp    14f7 <gets+0x17>
+    1585:	66 90                	xchg   %ax,%ax
+    1587:	66 90                	xchg   %ax,%ax
+    1589:	66 90                	xchg   %ax,%ax
+    158b:	66 90                	xchg   %ax,%ax
+    158d:	66 90                	xchg   %ax,%ax
+    158f:	90                   	nop
+
+00001590 <bigfree>:
+
+// Give a big block back to the first-fit list, and return the
+// free block that now holds it. Caller holds lock.
+static Header*
+bigfree(Header *bp)
+{
+    1590:	55                   	push   %ebp
+    1591:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1593:	a1 e4 2f 00 00       	mov    0x2fe4,%eax
+{
+    1598:	89 e5                	mov    %esp,%ebp
+    159a:	56                   	push   %esi
+    159b:	53                   	push   %ebx
+    159c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    15a0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    15a2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    15a4:	39 ca                	cmp    %ecx,%edx
+    15a6:	73 38                	jae    15e0 <bigfree+0x50>
+    15a8:	39 c1                	cmp    %eax,%ecx
+    15aa:	72 04                	jb     15b0 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    15ac:	39 c2                	cmp    %eax,%edx
+    15ae:	72 f0                	jb     15a0 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    15b0:	8b 59 04             	mov    0x4(%ecx),%ebx
+    15b3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    15b6:	39 f0                	cmp    %esi,%eax
+    15b8:	74 36                	je     15f0 <bigfree+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    15ba:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  freep = p;
+  if(p + p->s.size == bp){
+    15bc:	8b 42 04             	mov    0x4(%edx),%eax
+    15bf:	89 cb                	mov    %ecx,%ebx
+  freep = p;
+    15c1:	89 15 e4 2f 00 00    	mov    %edx,0x2fe4
+  if(p + p->s.size == bp){
+    15c7:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    15ca:	39 f1                	cmp    %esi,%ecx
+    15cc:	74 2e                	je     15fc <bigfree+0x6c>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    15ce:	89 1a                	mov    %ebx,(%edx)
+    return p;
+  }
+  p->s.ptr = bp;
+  return bp;
+}
+    15d0:	89 c8                	mov    %ecx,%eax
+    15d2:	5b                   	pop    %ebx
+    15d3:	5e                   	pop    %esi
+    15d4:	5d                   	pop    %ebp
+    15d5:	c3                   	ret
+    15d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15dd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    15e0:	39 c1                	cmp    %eax,%ecx
+    15e2:	72 c8                	jb     15ac <bigfree+0x1c>
+    15e4:	eb ba                	jmp    15a0 <bigfree+0x10>
+    15e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15ed:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    15f0:	03 58 04             	add    0x4(%eax),%ebx
+    15f3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    15f6:	8b 02                	mov    (%edx),%eax
+    15f8:	8b 00                	mov    (%eax),%eax
+    15fa:	eb be                	jmp    15ba <bigfree+0x2a>
+    p->s.size += bp->s.size;
+    15fc:	03 41 04             	add    0x4(%ecx),%eax
+    15ff:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1602:	8b 19                	mov    (%ecx),%ebx
+    return p;
+    1604:	89 d1                	mov    %edx,%ecx
+}
+    1606:	89 c8                	mov    %ecx,%eax
+    p->s.ptr = bp->s.ptr;
+    1608:	89 1a                	mov    %ebx,(%edx)
+}
+    160a:	5b                   	pop    %ebx
+    160b:	5e                   	pop    %esi
+    160c:	5d                   	pop    %ebp
+    160d:	c3                   	ret
+    160e:	66 90                	xchg   %ax,%ax
+
+00001610 <trim>:
+// If free block bp ends the heap, return its whole pages to the
+// kernel, unless something else has moved the break since.
+// Caller holds lock.
+static void
+trim(Header *bp)
+{
+    1610:	55                   	push   %ebp
+    1611:	89 e5                	mov    %esp,%ebp
+    1613:	57                   	push   %edi
+    1614:	56                   	push   %esi
+    1615:	53                   	push   %ebx
+    1616:	89 c3                	mov    %eax,%ebx
+    1618:	83 ec 0c             	sub    $0xc,%esp
+  char *end;
+  uint n;
+
+  if((char*)(bp + bp->s.size) != heapend)
+    161b:	8b 53 04             	mov    0x4(%ebx),%edx
+    161e:	a1 e0 2f 00 00       	mov    0x2fe0,%eax
+    1623:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+    1626:	39 d0                	cmp    %edx,%eax
+    1628:	74 0e                	je     1638 <trim+0x28>
+  n = heapend - end;
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    bp->s.size -= n / sizeof(Header);
+    heapend = end;
+  }
+}
+    162a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    162d:	5b                   	pop    %ebx
+    162e:	5e                   	pop    %esi
+    162f:	5f                   	pop    %edi
+    1630:	5d                   	pop    %ebp
+    1631:	c3                   	ret
+    1632:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  end = (char*)PGROUNDUP((uint)(bp + 2));
+    1638:	8d bb 0f 10 00 00    	lea    0x100f(%ebx),%edi
+    163e:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  n = heapend - end;
+    1644:	29 f8                	sub    %edi,%eax
+    1646:	89 c6                	mov    %eax,%esi
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    1648:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    164d:	76 db                	jbe    162a <trim+0x1a>
+    164f:	83 ec 0c             	sub    $0xc,%esp
+    1652:	6a 00                	push   $0x0
+    1654:	e8 8b ef ff ff       	call   5e4 <sbrk>
+    1659:	83 c4 10             	add    $0x10,%esp
+    165c:	39 05 e0 2f 00 00    	cmp    %eax,0x2fe0
+    1662:	75 c6                	jne    162a <trim+0x1a>
+    1664:	89 f0                	mov    %esi,%eax
+    1666:	83 ec 0c             	sub    $0xc,%esp
+    1669:	f7 d8                	neg    %eax
+    166b:	50                   	push   %eax
+    166c:	e8 73 ef ff ff       	call   5e4 <sbrk>
+    1671:	83 c4 10             	add    $0x10,%esp
+    1674:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1677:	74 b1                	je     162a <trim+0x1a>
+    bp->s.size -= n / sizeof(Header);
+    1679:	89 f0                	mov    %esi,%eax
+    heapend = end;
+    167b:	89 3d e0 2f 00 00    	mov    %edi,0x2fe0
+    bp->s.size -= n / sizeof(Header);
+    1681:	c1 e8 03             	shr    $0x3,%eax
+    1684:	29 43 04             	sub    %eax,0x4(%ebx)
+    heapend = end;
+    1687:	eb a1                	jmp    162a <trim+0x1a>
+    1689:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001690 <bigalloc>:
+}
+
+// Allocate a big block of nunits units. Caller holds lock.
+static Header*
+bigalloc(uint nunits)
+{
+    1690:	55                   	push   %ebp
+    1691:	89 e5                	mov    %esp,%ebp
+    1693:	57                   	push   %edi
+    1694:	89 c7                	mov    %eax,%edi
+    1696:	56                   	push   %esi
+    1697:	53                   	push   %ebx
+    1698:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    169b:	a1 e4 2f 00 00       	mov    0x2fe4,%eax
+    16a0:	85 c0                	test   %eax,%eax
+    16a2:	0f 84 98 00 00 00    	je     1740 <bigalloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    16a8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    16aa:	8b 4a 04             	mov    0x4(%edx),%ecx
+    16ad:	39 f9                	cmp    %edi,%ecx
+    16af:	73 67                	jae    1718 <bigalloc+0x88>
+  if(nu < 4096)
+    16b1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    16b6:	39 df                	cmp    %ebx,%edi
+    16b8:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    16bb:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    16c2:	eb 0d                	jmp    16d1 <bigalloc+0x41>
+    16c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    16c8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    16ca:	8b 4a 04             	mov    0x4(%edx),%ecx
+    16cd:	39 f9                	cmp    %edi,%ecx
+    16cf:	73 47                	jae    1718 <bigalloc+0x88>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    16d1:	89 d0                	mov    %edx,%eax
+    16d3:	39 15 e4 2f 00 00    	cmp    %edx,0x2fe4
+    16d9:	75 ed                	jne    16c8 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    16db:	83 ec 0c             	sub    $0xc,%esp
+    16de:	56                   	push   %esi
+    16df:	e8 00 ef ff ff       	call   5e4 <sbrk>
+  if(p == (char*)-1)
+    16e4:	83 c4 10             	add    $0x10,%esp
+    16e7:	83 f8 ff             	cmp    $0xffffffff,%eax
+    16ea:	74 1a                	je     1706 <bigalloc+0x76>
+  hp->s.size = nu;
+    16ec:	89 58 04             	mov    %ebx,0x4(%eax)
+  heapend = p + nu * sizeof(Header);
+    16ef:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    16f2:	89 15 e0 2f 00 00    	mov    %edx,0x2fe0
+  bigfree(hp);
+    16f8:	e8 93 fe ff ff       	call   1590 <bigfree>
+  return freep;
+    16fd:	a1 e4 2f 00 00       	mov    0x2fe4,%eax
+      if((p = morecore(nunits)) == 0)
+    1702:	85 c0                	test   %eax,%eax
+    1704:	75 c2                	jne    16c8 <bigalloc+0x38>
+        return 0;
+  }
+}
+    1706:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1709:	31 d2                	xor    %edx,%edx
+}
+    170b:	5b                   	pop    %ebx
+    170c:	89 d0                	mov    %edx,%eax
+    170e:	5e                   	pop    %esi
+    170f:	5f                   	pop    %edi
+    1710:	5d                   	pop    %ebp
+    1711:	c3                   	ret
+    1712:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1718:	39 cf                	cmp    %ecx,%edi
+    171a:	74 54                	je     1770 <bigalloc+0xe0>
+        p->s.size -= nunits;
+    171c:	29 f9                	sub    %edi,%ecx
+    171e:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    1721:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    1724:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    1727:	a3 e4 2f 00 00       	mov    %eax,0x2fe4
+}
+    172c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    172f:	89 d0                	mov    %edx,%eax
+    1731:	5b                   	pop    %ebx
+    1732:	5e                   	pop    %esi
+    1733:	5f                   	pop    %edi
+    1734:	5d                   	pop    %ebp
+    1735:	c3                   	ret
+    1736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    173d:	8d 76 00             	lea    0x0(%esi),%esi
+    base.s.ptr = freep = prevp = &base;
+    1740:	c7 05 e4 2f 00 00 e8 	movl   $0x2fe8,0x2fe4
+    1747:	2f 00 00 
+    base.s.size = 0;
+    174a:	ba e8 2f 00 00       	mov    $0x2fe8,%edx
+    base.s.ptr = freep = prevp = &base;
+    174f:	c7 05 e8 2f 00 00 e8 	movl   $0x2fe8,0x2fe8
+    1756:	2f 00 00 
+    base.s.size = 0;
+    1759:	c7 05 ec 2f 00 00 00 	movl   $0x0,0x2fec
+    1760:	00 00 00 
+    if(p->s.size >= nunits){
+    1763:	e9 49 ff ff ff       	jmp    16b1 <bigalloc+0x21>
+    1768:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    176f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1770:	8b 0a                	mov    (%edx),%ecx
+    1772:	89 08                	mov    %ecx,(%eax)
+    1774:	eb b1                	jmp    1727 <bigalloc+0x97>
+    1776:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    177d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001780 <drain>:
+}
+
+// Move n blocks of class c from cache tc to the shared list.
+static void
+drain(struct tcache *tc, int c, int n)
+{
+    1780:	55                   	push   %ebp
+    1781:	89 e5                	mov    %esp,%ebp
+    1783:	57                   	push   %edi
+    1784:	89 c7                	mov    %eax,%edi
+    1786:	56                   	push   %esi
+    1787:	89 d6                	mov    %edx,%esi
+    1789:	53                   	push   %ebx
+    178a:	89 cb                	mov    %ecx,%ebx
+    178c:	83 ec 0c             	sub    $0xc,%esp
+  if(threaded)
+    178f:	8b 15 64 2f 00 00    	mov    0x2f64,%edx
+    1795:	85 d2                	test   %edx,%edx
+    1797:	75 57                	jne    17f0 <drain+0x70>
+  Header *p;
+
+  acquire();
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1799:	85 c9                	test   %ecx,%ecx
+    179b:	7e 49                	jle    17e6 <drain+0x66>
+    179d:	89 d9                	mov    %ebx,%ecx
+    179f:	8d 14 b7             	lea    (%edi,%esi,4),%edx
+    17a2:	eb 23                	jmp    17c7 <drain+0x47>
+    17a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    tc->list[c] = p->s.ptr;
+    17a8:	8b 18                	mov    (%eax),%ebx
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    17aa:	83 e9 01             	sub    $0x1,%ecx
+    tc->n[c]--;
+    17ad:	83 6a 20 01          	subl   $0x1,0x20(%edx)
+    tc->list[c] = p->s.ptr;
+    17b1:	89 1a                	mov    %ebx,(%edx)
+    p->s.ptr = small[c];
+    17b3:	8b 1c b5 c0 2f 00 00 	mov    0x2fc0(,%esi,4),%ebx
+    17ba:	89 18                	mov    %ebx,(%eax)
+    small[c] = p;
+    17bc:	89 04 b5 c0 2f 00 00 	mov    %eax,0x2fc0(,%esi,4)
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    17c3:	85 c9                	test   %ecx,%ecx
+    17c5:	7e 06                	jle    17cd <drain+0x4d>
+    17c7:	8b 02                	mov    (%edx),%eax
+    17c9:	85 c0                	test   %eax,%eax
+    17cb:	75 db                	jne    17a8 <drain+0x28>
+  if(threaded)
+    17cd:	a1 64 2f 00 00       	mov    0x2f64,%eax
+    17d2:	85 c0                	test   %eax,%eax
+    17d4:	74 10                	je     17e6 <drain+0x66>
+    mutex_unlock(&lock);
+    17d6:	83 ec 0c             	sub    $0xc,%esp
+    17d9:	68 68 2f 00 00       	push   $0x2f68
+    17de:	e8 1d ec ff ff       	call   400 <mutex_unlock>
+}
+    17e3:	83 c4 10             	add    $0x10,%esp
+  }
+  release();
+}
+    17e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    17e9:	5b                   	pop    %ebx
+    17ea:	5e                   	pop    %esi
+    17eb:	5f                   	pop    %edi
+    17ec:	5d                   	pop    %ebp
+    17ed:	c3                   	ret
+    17ee:	66 90                	xchg   %ax,%ax
+    mutex_lock(&lock);
+    17f0:	83 ec 0c             	sub    $0xc,%esp
+    17f3:	68 68 2f 00 00       	push   $0x2f68
+    17f8:	e8 b3 eb ff ff       	call   3b0 <mutex_lock>
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    17fd:	83 c4 10             	add    $0x10,%esp
+    1800:	85 db                	test   %ebx,%ebx
+    1802:	7f 99                	jg     179d <drain+0x1d>
+    1804:	eb c7                	jmp    17cd <drain+0x4d>
+    1806:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    180d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001810 <mycache>:
+{
+    1810:	55                   	push   %ebp
+    return &maincache;
+    1811:	b8 80 2f 00 00       	mov    $0x2f80,%eax
+{
+    1816:	89 e5                	mov    %esp,%ebp
+    1818:	53                   	push   %ebx
+  sp = PGROUNDDOWN((uint)&sp);
+    1819:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+    181c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+    1822:	83 ec 14             	sub    $0x14,%esp
+  if(!threaded || sp == mainstack)
+    1825:	8b 0d 64 2f 00 00    	mov    0x2f64,%ecx
+  sp = PGROUNDDOWN((uint)&sp);
+    182b:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  if(!threaded || sp == mainstack)
+    182e:	85 c9                	test   %ecx,%ecx
+    1830:	74 0f                	je     1841 <mycache+0x31>
+    1832:	3b 1d 60 2f 00 00    	cmp    0x2f60,%ebx
+    1838:	74 07                	je     1841 <mycache+0x31>
+  if(*cp == 0){
+    183a:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    183d:	85 c0                	test   %eax,%eax
+    183f:	74 0f                	je     1850 <mycache+0x40>
+}
+    1841:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1844:	c9                   	leave
+    1845:	c3                   	ret
+    1846:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    184d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1850:	83 ec 0c             	sub    $0xc,%esp
+    1853:	68 68 2f 00 00       	push   $0x2f68
+    1858:	e8 53 eb ff ff       	call   3b0 <mutex_lock>
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    185d:	b8 09 00 00 00       	mov    $0x9,%eax
+    1862:	e8 29 fe ff ff       	call   1690 <bigalloc>
+  if(threaded)
+    1867:	8b 15 64 2f 00 00    	mov    0x2f64,%edx
+    186d:	83 c4 10             	add    $0x10,%esp
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    1870:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(threaded)
+    1873:	85 d2                	test   %edx,%edx
+    1875:	75 29                	jne    18a0 <mycache+0x90>
+    if(*cp == 0)
+    1877:	85 c0                	test   %eax,%eax
+    1879:	74 c6                	je     1841 <mycache+0x31>
+    memset(*cp, 0, sizeof(**cp));
+    187b:	83 ec 04             	sub    $0x4,%esp
+    *cp = (struct tcache*)((Header*)*cp + 1);
+    187e:	83 c0 08             	add    $0x8,%eax
+    1881:	89 43 f8             	mov    %eax,-0x8(%ebx)
+    memset(*cp, 0, sizeof(**cp));
+    1884:	6a 40                	push   $0x40
+    1886:	6a 00                	push   $0x0
+    1888:	50                   	push   %eax
+    1889:	e8 f2 e9 ff ff       	call   280 <memset>
+  return *cp;
+    188e:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    1891:	83 c4 10             	add    $0x10,%esp
+    1894:	eb ab                	jmp    1841 <mycache+0x31>
+    1896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    189d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    18a0:	83 ec 0c             	sub    $0xc,%esp
+    18a3:	68 68 2f 00 00       	push   $0x2f68
+    18a8:	e8 53 eb ff ff       	call   400 <mutex_unlock>
+    if(*cp == 0)
+    18ad:	8b 43 f8             	mov    -0x8(%ebx),%eax
+}
+    18b0:	83 c4 10             	add    $0x10,%esp
+    18b3:	eb c2                	jmp    1877 <mycache+0x67>
+    18b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000018c0 <free>:
+
+void
+free(void *ap)
+{
+    18c0:	55                   	push   %ebp
+    18c1:	89 e5                	mov    %esp,%ebp
+    18c3:	57                   	push   %edi
+    18c4:	56                   	push   %esi
+    18c5:	53                   	push   %ebx
+    18c6:	83 ec 1c             	sub    $0x1c,%esp
+    18c9:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  struct tcache *tc;
+  int c;
+
+  if(ap == 0)
+    18cc:	85 f6                	test   %esi,%esi
+    18ce:	74 51                	je     1921 <free+0x61>
+    return;
+  bp = (Header*)ap - 1;
+    18d0:	8d 46 f8             	lea    -0x8(%esi),%eax
+    18d3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(bp->s.size > SMALLMAX / sizeof(Header)){
+    18d6:	8b 46 fc             	mov    -0x4(%esi),%eax
+    18d9:	3d 00 01 00 00       	cmp    $0x100,%eax
+    18de:	77 50                	ja     1930 <free+0x70>
+    acquire();
+    trim(bigfree(bp));
+    release();
+    return;
+  }
+  for(c = 0; (2 << c) < bp->s.size; c++)
+    18e0:	31 db                	xor    %ebx,%ebx
+    18e2:	ba 02 00 00 00       	mov    $0x2,%edx
+    18e7:	83 f8 02             	cmp    $0x2,%eax
+    18ea:	76 11                	jbe    18fd <free+0x3d>
+    18ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    18f0:	83 c3 01             	add    $0x1,%ebx
+    18f3:	89 d7                	mov    %edx,%edi
+    18f5:	89 d9                	mov    %ebx,%ecx
+    18f7:	d3 e7                	shl    %cl,%edi
+    18f9:	39 c7                	cmp    %eax,%edi
+    18fb:	72 f3                	jb     18f0 <free+0x30>
+    ;
+  if((tc = mycache()) == 0){
+    18fd:	e8 0e ff ff ff       	call   1810 <mycache>
+    1902:	85 c0                	test   %eax,%eax
+    1904:	74 7a                	je     1980 <free+0xc0>
+    bp->s.ptr = small[c];
+    small[c] = bp;
+    release();
+    return;
+  }
+  bp->s.ptr = tc->list[c];
+    1906:	8d 0c 98             	lea    (%eax,%ebx,4),%ecx
+    1909:	8b 11                	mov    (%ecx),%edx
+    190b:	89 56 f8             	mov    %edx,-0x8(%esi)
+  tc->list[c] = bp;
+    190e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1911:	89 31                	mov    %esi,(%ecx)
+  if(++tc->n[c] > TCACHEMAX)
+    1913:	8b 71 20             	mov    0x20(%ecx),%esi
+    1916:	8d 56 01             	lea    0x1(%esi),%edx
+    1919:	89 51 20             	mov    %edx,0x20(%ecx)
+    191c:	83 fa 20             	cmp    $0x20,%edx
+    191f:	7f 47                	jg     1968 <free+0xa8>
+    drain(tc, c, BATCH);
+}
+    1921:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1924:	5b                   	pop    %ebx
+    1925:	5e                   	pop    %esi
+    1926:	5f                   	pop    %edi
+    1927:	5d                   	pop    %ebp
+    1928:	c3                   	ret
+    1929:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1930:	8b 1d 64 2f 00 00    	mov    0x2f64,%ebx
+    1936:	85 db                	test   %ebx,%ebx
+    1938:	75 66                	jne    19a0 <free+0xe0>
+    trim(bigfree(bp));
+    193a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    193d:	e8 4e fc ff ff       	call   1590 <bigfree>
+    1942:	e8 c9 fc ff ff       	call   1610 <trim>
+  if(threaded)
+    1947:	8b 0d 64 2f 00 00    	mov    0x2f64,%ecx
+    194d:	85 c9                	test   %ecx,%ecx
+    194f:	74 d0                	je     1921 <free+0x61>
+    mutex_unlock(&lock);
+    1951:	c7 45 08 68 2f 00 00 	movl   $0x2f68,0x8(%ebp)
+}
+    1958:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    195b:	5b                   	pop    %ebx
+    195c:	5e                   	pop    %esi
+    195d:	5f                   	pop    %edi
+    195e:	5d                   	pop    %ebp
+    mutex_unlock(&lock);
+    195f:	e9 9c ea ff ff       	jmp    400 <mutex_unlock>
+    1964:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    1968:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    drain(tc, c, BATCH);
+    196b:	89 da                	mov    %ebx,%edx
+    196d:	b9 10 00 00 00       	mov    $0x10,%ecx
+}
+    1972:	5b                   	pop    %ebx
+    1973:	5e                   	pop    %esi
+    1974:	5f                   	pop    %edi
+    1975:	5d                   	pop    %ebp
+    drain(tc, c, BATCH);
+    1976:	e9 05 fe ff ff       	jmp    1780 <drain>
+    197b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    197f:	90                   	nop
+  if(threaded)
+    1980:	8b 15 64 2f 00 00    	mov    0x2f64,%edx
+    1986:	85 d2                	test   %edx,%edx
+    1988:	75 28                	jne    19b2 <free+0xf2>
+    bp->s.ptr = small[c];
+    198a:	8b 04 9d c0 2f 00 00 	mov    0x2fc0(,%ebx,4),%eax
+    1991:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1994:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1997:	89 04 9d c0 2f 00 00 	mov    %eax,0x2fc0(,%ebx,4)
+  if(threaded)
+    199e:	eb 81                	jmp    1921 <free+0x61>
+    mutex_lock(&lock);
+    19a0:	83 ec 0c             	sub    $0xc,%esp
+    19a3:	68 68 2f 00 00       	push   $0x2f68
+    19a8:	e8 03 ea ff ff       	call   3b0 <mutex_lock>
+}
+    19ad:	83 c4 10             	add    $0x10,%esp
+    19b0:	eb 88                	jmp    193a <free+0x7a>
+    mutex_lock(&lock);
+    19b2:	83 ec 0c             	sub    $0xc,%esp
+    19b5:	68 68 2f 00 00       	push   $0x2f68
+    19ba:	e8 f1 e9 ff ff       	call   3b0 <mutex_lock>
+    bp->s.ptr = small[c];
+    19bf:	8b 04 9d c0 2f 00 00 	mov    0x2fc0(,%ebx,4),%eax
+  if(threaded)
+    19c6:	83 c4 10             	add    $0x10,%esp
+    bp->s.ptr = small[c];
+    19c9:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    19cc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    19cf:	89 04 9d c0 2f 00 00 	mov    %eax,0x2fc0(,%ebx,4)
+  if(threaded)
+    19d6:	a1 64 2f 00 00       	mov    0x2f64,%eax
+    19db:	85 c0                	test   %eax,%eax
+    19dd:	0f 85 6e ff ff ff    	jne    1951 <free+0x91>
+    19e3:	e9 39 ff ff ff       	jmp    1921 <free+0x61>
+    19e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19ef:	90                   	nop
+
+000019f0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    19f0:	55                   	push   %ebp
+    19f1:	89 e5                	mov    %esp,%ebp
+    19f3:	57                   	push   %edi
+    19f4:	56                   	push   %esi
+    19f5:	53                   	push   %ebx
+    19f6:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  struct tcache *tc;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    19f9:	8b 45 08             	mov    0x8(%ebp),%eax
+    19fc:	8d 78 07             	lea    0x7(%eax),%edi
+    19ff:	c1 ef 03             	shr    $0x3,%edi
+    1a02:	83 c7 01             	add    $0x1,%edi
+  if(nunits > SMALLMAX / sizeof(Header)){
+    1a05:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+    1a0b:	77 5b                	ja     1a68 <malloc+0x78>
+    acquire();
+    p = bigalloc(nunits);
+    release();
+    return p ? (void*)(p + 1) : 0;
+  }
+  for(c = 0; (2 << c) < nunits; c++)
+    1a0d:	31 c9                	xor    %ecx,%ecx
+    1a0f:	b8 02 00 00 00       	mov    $0x2,%eax
+    1a14:	be 02 00 00 00       	mov    $0x2,%esi
+    1a19:	bb 02 00 00 00       	mov    $0x2,%ebx
+    1a1e:	83 ff 02             	cmp    $0x2,%edi
+    1a21:	76 12                	jbe    1a35 <malloc+0x45>
+    1a23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1a27:	90                   	nop
+    1a28:	83 c1 01             	add    $0x1,%ecx
+    1a2b:	89 c3                	mov    %eax,%ebx
+    1a2d:	d3 e3                	shl    %cl,%ebx
+    1a2f:	89 de                	mov    %ebx,%esi
+    1a31:	39 fb                	cmp    %edi,%ebx
+    1a33:	72 f3                	jb     1a28 <malloc+0x38>
+    1a35:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    ;
+  if((tc = mycache()) == 0)
+    1a38:	e8 d3 fd ff ff       	call   1810 <mycache>
+    1a3d:	85 c0                	test   %eax,%eax
+    1a3f:	74 51                	je     1a92 <malloc+0xa2>
+    return 0;
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1a41:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1a44:	8d 3c 88             	lea    (%eax,%ecx,4),%edi
+    1a47:	8b 07                	mov    (%edi),%eax
+    1a49:	85 c0                	test   %eax,%eax
+    1a4b:	74 53                	je     1aa0 <malloc+0xb0>
+    return 0;
+  p = tc->list[c];
+  tc->list[c] = p->s.ptr;
+  tc->n[c]--;
+    1a4d:	8b 57 20             	mov    0x20(%edi),%edx
+  tc->list[c] = p->s.ptr;
+    1a50:	8b 08                	mov    (%eax),%ecx
+  tc->n[c]--;
+    1a52:	83 ea 01             	sub    $0x1,%edx
+  return (void*)(p + 1);
+    1a55:	83 c0 08             	add    $0x8,%eax
+  tc->n[c]--;
+    1a58:	89 57 20             	mov    %edx,0x20(%edi)
+  tc->list[c] = p->s.ptr;
+    1a5b:	89 0f                	mov    %ecx,(%edi)
+}
+    1a5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a60:	5b                   	pop    %ebx
+    1a61:	5e                   	pop    %esi
+    1a62:	5f                   	pop    %edi
+    1a63:	5d                   	pop    %ebp
+    1a64:	c3                   	ret
+    1a65:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1a68:	a1 64 2f 00 00       	mov    0x2f64,%eax
+    1a6d:	85 c0                	test   %eax,%eax
+    1a6f:	0f 85 b3 00 00 00    	jne    1b28 <malloc+0x138>
+    p = bigalloc(nunits);
+    1a75:	89 f8                	mov    %edi,%eax
+    1a77:	e8 14 fc ff ff       	call   1690 <bigalloc>
+    1a7c:	89 c3                	mov    %eax,%ebx
+  if(threaded)
+    1a7e:	a1 64 2f 00 00       	mov    0x2f64,%eax
+    1a83:	85 c0                	test   %eax,%eax
+    1a85:	0f 85 85 00 00 00    	jne    1b10 <malloc+0x120>
+    return p ? (void*)(p + 1) : 0;
+    1a8b:	8d 43 08             	lea    0x8(%ebx),%eax
+    1a8e:	85 db                	test   %ebx,%ebx
+    1a90:	75 cb                	jne    1a5d <malloc+0x6d>
+    1a92:	31 c0                	xor    %eax,%eax
+}
+    1a94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a97:	5b                   	pop    %ebx
+    1a98:	5e                   	pop    %esi
+    1a99:	5f                   	pop    %edi
+    1a9a:	5d                   	pop    %ebp
+    1a9b:	c3                   	ret
+    1a9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1aa0:	a1 64 2f 00 00       	mov    0x2f64,%eax
+    1aa5:	85 c0                	test   %eax,%eax
+    1aa7:	0f 85 29 01 00 00    	jne    1bd6 <malloc+0x1e6>
+  if(small[c] == 0){
+    1aad:	8b 04 8d c0 2f 00 00 	mov    0x2fc0(,%ecx,4),%eax
+    1ab4:	85 c0                	test   %eax,%eax
+    1ab6:	0f 84 81 00 00 00    	je     1b3d <malloc+0x14d>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1abc:	31 db                	xor    %ebx,%ebx
+    1abe:	eb 22                	jmp    1ae2 <malloc+0xf2>
+    small[c] = p->s.ptr;
+    1ac0:	8b 10                	mov    (%eax),%edx
+  for(moved = 0; moved < n && small[c]; moved++){
+    1ac2:	83 c3 01             	add    $0x1,%ebx
+    small[c] = p->s.ptr;
+    1ac5:	89 14 8d c0 2f 00 00 	mov    %edx,0x2fc0(,%ecx,4)
+    p->s.ptr = tc->list[c];
+    1acc:	8b 17                	mov    (%edi),%edx
+    1ace:	89 10                	mov    %edx,(%eax)
+    tc->list[c] = p;
+    1ad0:	89 07                	mov    %eax,(%edi)
+  for(moved = 0; moved < n && small[c]; moved++){
+    1ad2:	83 fb 10             	cmp    $0x10,%ebx
+    1ad5:	0f 84 e2 00 00 00    	je     1bbd <malloc+0x1cd>
+    1adb:	8b 04 8d c0 2f 00 00 	mov    0x2fc0(,%ecx,4),%eax
+    1ae2:	85 c0                	test   %eax,%eax
+    1ae4:	75 da                	jne    1ac0 <malloc+0xd0>
+  if(threaded)
+    1ae6:	8b 15 64 2f 00 00    	mov    0x2f64,%edx
+    1aec:	85 d2                	test   %edx,%edx
+    1aee:	0f 85 b4 00 00 00    	jne    1ba8 <malloc+0x1b8>
+  tc->n[c] += moved;
+    1af4:	8b 57 20             	mov    0x20(%edi),%edx
+    1af7:	01 da                	add    %ebx,%edx
+    1af9:	89 57 20             	mov    %edx,0x20(%edi)
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1afc:	85 db                	test   %ebx,%ebx
+    1afe:	74 92                	je     1a92 <malloc+0xa2>
+  p = tc->list[c];
+    1b00:	8b 07                	mov    (%edi),%eax
+    1b02:	e9 49 ff ff ff       	jmp    1a50 <malloc+0x60>
+    1b07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b0e:	66 90                	xchg   %ax,%ax
+    mutex_unlock(&lock);
+    1b10:	83 ec 0c             	sub    $0xc,%esp
+    1b13:	68 68 2f 00 00       	push   $0x2f68
+    1b18:	e8 e3 e8 ff ff       	call   400 <mutex_unlock>
+}
+    1b1d:	83 c4 10             	add    $0x10,%esp
+    1b20:	e9 66 ff ff ff       	jmp    1a8b <malloc+0x9b>
+    1b25:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1b28:	83 ec 0c             	sub    $0xc,%esp
+    1b2b:	68 68 2f 00 00       	push   $0x2f68
+    1b30:	e8 7b e8 ff ff       	call   3b0 <mutex_lock>
+}
+    1b35:	83 c4 10             	add    $0x10,%esp
+    1b38:	e9 38 ff ff ff       	jmp    1a75 <malloc+0x85>
+    if((chunk = bigalloc(CHUNK / sizeof(Header) + 1)) == 0){
+    1b3d:	b8 01 02 00 00       	mov    $0x201,%eax
+    1b42:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1b45:	e8 46 fb ff ff       	call   1690 <bigalloc>
+    1b4a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1b4d:	85 c0                	test   %eax,%eax
+    1b4f:	89 c2                	mov    %eax,%edx
+    1b51:	0f 84 ba 00 00 00    	je     1c11 <malloc+0x221>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1b57:	83 c2 08             	add    $0x8,%edx
+    1b5a:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+    1b60:	0f 87 d0 00 00 00    	ja     1c36 <malloc+0x246>
+    1b66:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+    1b6d:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    1b70:	89 df                	mov    %ebx,%edi
+    1b72:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1b75:	8d 76 00             	lea    0x0(%esi),%esi
+      p->s.size = units;
+    1b78:	89 72 04             	mov    %esi,0x4(%edx)
+      p->s.ptr = small[c];
+    1b7b:	8b 04 8d c0 2f 00 00 	mov    0x2fc0(,%ecx,4),%eax
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1b82:	01 df                	add    %ebx,%edi
+    1b84:	89 55 e0             	mov    %edx,-0x20(%ebp)
+      p->s.ptr = small[c];
+    1b87:	89 02                	mov    %eax,(%edx)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1b89:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      small[c] = p;
+    1b8c:	89 14 8d c0 2f 00 00 	mov    %edx,0x2fc0(,%ecx,4)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1b93:	01 c2                	add    %eax,%edx
+    1b95:	81 ff 00 02 00 00    	cmp    $0x200,%edi
+    1b9b:	76 db                	jbe    1b78 <malloc+0x188>
+    1b9d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1ba0:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1ba3:	e9 14 ff ff ff       	jmp    1abc <malloc+0xcc>
+    mutex_unlock(&lock);
+    1ba8:	83 ec 0c             	sub    $0xc,%esp
+    1bab:	68 68 2f 00 00       	push   $0x2f68
+    1bb0:	e8 4b e8 ff ff       	call   400 <mutex_unlock>
+}
+    1bb5:	83 c4 10             	add    $0x10,%esp
+    1bb8:	e9 37 ff ff ff       	jmp    1af4 <malloc+0x104>
+  if(threaded)
+    1bbd:	a1 64 2f 00 00       	mov    0x2f64,%eax
+    1bc2:	85 c0                	test   %eax,%eax
+    1bc4:	75 2b                	jne    1bf1 <malloc+0x201>
+  tc->n[c] += moved;
+    1bc6:	8b 47 20             	mov    0x20(%edi),%eax
+    1bc9:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1bcc:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1bce:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1bd1:	e9 7a fe ff ff       	jmp    1a50 <malloc+0x60>
+    mutex_lock(&lock);
+    1bd6:	83 ec 0c             	sub    $0xc,%esp
+    1bd9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1bdc:	68 68 2f 00 00       	push   $0x2f68
+    1be1:	e8 ca e7 ff ff       	call   3b0 <mutex_lock>
+}
+    1be6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1be9:	83 c4 10             	add    $0x10,%esp
+    1bec:	e9 bc fe ff ff       	jmp    1aad <malloc+0xbd>
+    mutex_unlock(&lock);
+    1bf1:	83 ec 0c             	sub    $0xc,%esp
+    1bf4:	68 68 2f 00 00       	push   $0x2f68
+    1bf9:	e8 02 e8 ff ff       	call   400 <mutex_unlock>
+  tc->n[c] += moved;
+    1bfe:	8b 47 20             	mov    0x20(%edi),%eax
+    1c01:	83 c4 10             	add    $0x10,%esp
+    1c04:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1c07:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1c09:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1c0c:	e9 3f fe ff ff       	jmp    1a50 <malloc+0x60>
+  if(threaded)
+    1c11:	8b 0d 64 2f 00 00    	mov    0x2f64,%ecx
+    1c17:	85 c9                	test   %ecx,%ecx
+    1c19:	0f 84 73 fe ff ff    	je     1a92 <malloc+0xa2>
+    mutex_unlock(&lock);
+    1c1f:	83 ec 0c             	sub    $0xc,%esp
+    1c22:	68 68 2f 00 00       	push   $0x2f68
+    1c27:	e8 d4 e7 ff ff       	call   400 <mutex_unlock>
+    1c2c:	83 c4 10             	add    $0x10,%esp
+    return p ? (void*)(p + 1) : 0;
+    1c2f:	31 c0                	xor    %eax,%eax
+    1c31:	e9 5e fe ff ff       	jmp    1a94 <malloc+0xa4>
+  for(moved = 0; moved < n && small[c]; moved++){
+    1c36:	8b 04 8d c0 2f 00 00 	mov    0x2fc0(,%ecx,4),%eax
+    1c3d:	e9 7a fe ff ff       	jmp    1abc <malloc+0xcc>
+    1c42:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001c50 <malloc_threaded>:
+void
+malloc_threaded(void)
+{
+  uint sp;
+
+  if(threaded)
+    1c50:	a1 64 2f 00 00       	mov    0x2f64,%eax
+    1c55:	85 c0                	test   %eax,%eax
+    1c57:	74 07                	je     1c60 <malloc_threaded+0x10>
+    1c59:	c3                   	ret
+    1c5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+{
+    1c60:	55                   	push   %ebp
+    1c61:	89 e5                	mov    %esp,%ebp
+    1c63:	83 ec 24             	sub    $0x24,%esp
+    return;
+  mutex_init(&lock);
+    1c66:	68 68 2f 00 00       	push   $0x2f68
+    1c6b:	e8 30 e7 ff ff       	call   3a0 <mutex_init>
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1c70:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1c73:	83 c4 10             	add    $0x10,%esp
+  threaded = 1;
+    1c76:	c7 05 64 2f 00 00 01 	movl   $0x1,0x2f64
+    1c7d:	00 00 00 
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1c80:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    1c85:	a3 60 2f 00 00       	mov    %eax,0x2f60
+}
+    1c8a:	c9                   	leave
+    1c8b:	c3                   	ret
+    1c8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001c90 <malloc_thread_exit>:
+
+// Called by thread_join() with the cache slot of a finished
+// thread: give its blocks, and the cache itself, back.
+void
+malloc_thread_exit(void **cachep)
+{
+    1c90:	55                   	push   %ebp
+    1c91:	89 e5                	mov    %esp,%ebp
+    1c93:	57                   	push   %edi
+    1c94:	56                   	push   %esi
+    1c95:	53                   	push   %ebx
+    1c96:	83 ec 0c             	sub    $0xc,%esp
+    1c99:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct tcache *tc;
+  int c;
+
+  if((tc = *cachep) == 0)
+    1c9c:	8b 37                	mov    (%edi),%esi
+    1c9e:	85 f6                	test   %esi,%esi
+    1ca0:	74 41                	je     1ce3 <malloc_thread_exit+0x53>
+    return;
+  for(c = 0; c < NCLASS; c++)
+    1ca2:	31 db                	xor    %ebx,%ebx
+    1ca4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    drain(tc, c, tc->n[c]);
+    1ca8:	8b 4c 9e 20          	mov    0x20(%esi,%ebx,4),%ecx
+    1cac:	89 da                	mov    %ebx,%edx
+    1cae:	89 f0                	mov    %esi,%eax
+  for(c = 0; c < NCLASS; c++)
+    1cb0:	83 c3 01             	add    $0x1,%ebx
+    drain(tc, c, tc->n[c]);
+    1cb3:	e8 c8 fa ff ff       	call   1780 <drain>
+  for(c = 0; c < NCLASS; c++)
+    1cb8:	83 fb 08             	cmp    $0x8,%ebx
+    1cbb:	75 eb                	jne    1ca8 <malloc_thread_exit+0x18>
+  if(threaded)
+    1cbd:	8b 15 64 2f 00 00    	mov    0x2f64,%edx
+    1cc3:	85 d2                	test   %edx,%edx
+    1cc5:	75 29                	jne    1cf0 <malloc_thread_exit+0x60>
+  acquire();
+  trim(bigfree((Header*)tc - 1));
+    1cc7:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1cca:	e8 c1 f8 ff ff       	call   1590 <bigfree>
+    1ccf:	e8 3c f9 ff ff       	call   1610 <trim>
+  if(threaded)
+    1cd4:	a1 64 2f 00 00       	mov    0x2f64,%eax
+    1cd9:	85 c0                	test   %eax,%eax
+    1cdb:	75 2b                	jne    1d08 <malloc_thread_exit+0x78>
+  release();
+  *cachep = 0;
+    1cdd:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+}
+    1ce3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ce6:	5b                   	pop    %ebx
+    1ce7:	5e                   	pop    %esi
+    1ce8:	5f                   	pop    %edi
+    1ce9:	5d                   	pop    %ebp
+    1cea:	c3                   	ret
+    1ceb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1cef:	90                   	nop
+    mutex_lock(&lock);
+    1cf0:	83 ec 0c             	sub    $0xc,%esp
+    1cf3:	68 68 2f 00 00       	push   $0x2f68
+    1cf8:	e8 b3 e6 ff ff       	call   3b0 <mutex_lock>
+}
+    1cfd:	83 c4 10             	add    $0x10,%esp
+    1d00:	eb c5                	jmp    1cc7 <malloc_thread_exit+0x37>
+    1d02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1d08:	83 ec 0c             	sub    $0xc,%esp
+    1d0b:	68 68 2f 00 00       	push   $0x2f68
+    1d10:	e8 eb e6 ff ff       	call   400 <mutex_unlock>
+}
+    1d15:	83 c4 10             	add    $0x10,%esp
+    1d18:	eb c3                	jmp    1cdd <malloc_thread_exit+0x4d>
+    1d1a:	66 90                	xchg   %ax,%ax
+    1d1c:	66 90                	xchg   %ax,%ax
+    1d1e:	66 90                	xchg   %ax,%ax
+
+00001d20 <thread_create>:
+
+// Start fn(arg) in a new thread on a freshly allocated
+// page-aligned stack.  Returns the thread's pid.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1d20:	55                   	push   %ebp
+    1d21:	89 e5                	mov    %esp,%ebp
+    1d23:	53                   	push   %ebx
+    1d24:	83 ec 14             	sub    $0x14,%esp
+  char *mem, *stack;
+  int pid;
+
+  malloc_threaded();
+    1d27:	e8 24 ff ff ff       	call   1c50 <malloc_threaded>
+  stdio_threaded();
+    1d2c:	e8 cf ee ff ff       	call   c00 <stdio_threaded>
+  if((mem = malloc(2*PGSIZE)) == 0)
+    1d31:	83 ec 0c             	sub    $0xc,%esp
+    1d34:	68 00 20 00 00       	push   $0x2000
+    1d39:	e8 b2 fc ff ff       	call   19f0 <malloc>
+    1d3e:	83 c4 10             	add    $0x10,%esp
+    1d41:	85 c0                	test   %eax,%eax
+    1d43:	74 52                	je     1d97 <thread_create+0x77>
+    1d45:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1d47:	8d 80 07 10 00 00    	lea    0x1007(%eax),%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+  ((char**)stack)[-2] = 0;
+  if((pid = clone(fn, arg, stack)) < 0)
+    1d4d:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1d50:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+    1d55:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  ((char**)stack)[-2] = 0;
+    1d58:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+  if((pid = clone(fn, arg, stack)) < 0)
+    1d5f:	50                   	push   %eax
+    1d60:	ff 75 0c             	push   0xc(%ebp)
+    1d63:	ff 75 08             	push   0x8(%ebp)
+    1d66:	e8 97 e8 ff ff       	call   602 <clone>
+    1d6b:	83 c4 10             	add    $0x10,%esp
+    1d6e:	85 c0                	test   %eax,%eax
+    1d70:	78 0e                	js     1d80 <thread_create+0x60>
+    free(mem);
+  return pid;
+}
+    1d72:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1d75:	c9                   	leave
+    1d76:	c3                   	ret
+    1d77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d7e:	66 90                	xchg   %ax,%ax
+    free(mem);
+    1d80:	83 ec 0c             	sub    $0xc,%esp
+    1d83:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1d86:	53                   	push   %ebx
+    1d87:	e8 34 fb ff ff       	call   18c0 <free>
+    1d8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1d8f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    1d92:	83 c4 10             	add    $0x10,%esp
+}
+    1d95:	c9                   	leave
+    1d96:	c3                   	ret
+    return -1;
+    1d97:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1d9c:	eb d4                	jmp    1d72 <thread_create+0x52>
+    1d9e:	66 90                	xchg   %ax,%ax
+
+00001da0 <thread_join>:
+
+// Wait for a thread to finish and free its stack.
+int
+thread_join(void)
+{
+    1da0:	55                   	push   %ebp
+    1da1:	89 e5                	mov    %esp,%ebp
+    1da3:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    1da4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    1da7:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    1daa:	50                   	push   %eax
+    1dab:	e8 61 e8 ff ff       	call   611 <join>
+    1db0:	83 c4 10             	add    $0x10,%esp
+    1db3:	85 c0                	test   %eax,%eax
+    1db5:	78 29                	js     1de0 <thread_join+0x40>
+    1db7:	89 c3                	mov    %eax,%ebx
+    return -1;
+  malloc_thread_exit(&((void**)stack)[-2]);
+    1db9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1dbc:	83 ec 0c             	sub    $0xc,%esp
+    1dbf:	83 e8 08             	sub    $0x8,%eax
+    1dc2:	50                   	push   %eax
+    1dc3:	e8 c8 fe ff ff       	call   1c90 <malloc_thread_exit>
+  free(((char**)stack)[-1]);
+    1dc8:	58                   	pop    %eax
+    1dc9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1dcc:	ff 70 fc             	push   -0x4(%eax)
+    1dcf:	e8 ec fa ff ff       	call   18c0 <free>
+  return pid;
+    1dd4:	83 c4 10             	add    $0x10,%esp
+}
+    1dd7:	89 d8                	mov    %ebx,%eax
+    1dd9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1ddc:	c9                   	leave
+    1ddd:	c3                   	ret
+    1dde:	66 90                	xchg   %ax,%ax
+    return -1;
+    1de0:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    1de5:	eb f0                	jmp    1dd7 <thread_join+0x37>
@@ -0,0 +1,52 @@
+// TLB reach benchmark.
+// Touches one word in every page of a large region, in a scattered
+// order, first with the region from sbrk() (4KB pages) and then from
+// hsbrk() (4MB pages where available).
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "mmu.h"
+
+#define SZ     (3*HPGSIZE)
+#define ROUNDS 200
+#define STRIDE 383          // pages; odd, so every page is visited
+
+int
+run(char *(*grow)(int))
+{
+  char *cur, *base;
+  uint npg, i, pg;
+  int r, t0, t1;
+
+  // Start on a 4MB boundary so hsbrk() can use whole 4MB pages.
+  cur = sbrk(0);
+  sbrk(HPGROUNDUP((uint)cur) - (uint)cur);
+  if((base = grow(SZ)) == (char*)-1){
+    printf(2, "tlbbench: out of memory\n");
+    exit();
+  }
+
+  npg = SZ / PGSIZE;
+  t0 = uptime();
+  for(r = 0; r < ROUNDS; r++){
+    pg = 0;
+    for(i = 0; i < npg; i++){
+      (*(volatile int*)(base + pg*PGSIZE))++;
+      pg = (pg + STRIDE) % npg;
+    }
+  }
+  t1 = uptime();
+
+  sbrk(-SZ);
+  return t1 - t0;
+}
+
+int
+main(void)
+{
+  printf(1, "tlbbench: %d MB, %d rounds\n", SZ / (1024*1024), ROUNDS);
+  printf(1, "4KB pages: %d ticks\n", run(sbrk));
+  printf(1, "4MB pages: %d ticks\n", run(hsbrk));
+  exit();
+}
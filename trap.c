@@ -37,9 +37,65 @@ idtinit(void) {
     lidt(idt, sizeof(idt));
 }
 
+#define MSR_SYSENTER_CS  0x174
+#define MSR_SYSENTER_ESP 0x175
+#define MSR_SYSENTER_EIP 0x176
+#define CPUID_SEP 0x00000800     // CPUID 1 %edx: SYSENTER/SYSEXIT supported
+
+extern void sysenter(void);      // in trapasm.S
+extern void sysentertf(void);
+
+// Point SYSENTER at sysenter in trapasm.S on this CPU, if it has
+// SYSENTER. The stack pointer it loads is the address of this CPU's
+// ts.esp0, from which the entry code loads the kernel stack that
+// switchuvm() set for the current process; so no MSR needs changing
+// on a context switch. A debug trap taken before that load pushes
+// its frame below ts.esp0, onto the CPU's dbstack.
+void
+sysenterinit(void) {
+    if (!(cpuidedx(1) & CPUID_SEP))
+        return;
+    wrmsr(MSR_SYSENTER_CS, SEG_KCODE << 3);
+    wrmsr(MSR_SYSENTER_ESP, (uint) &mycpu()->ts.esp0);
+    wrmsr(MSR_SYSENTER_EIP, (uint) sysenter);
+}
+
+// Return 1 if the user instruction that trapped is SYSENTER.
+static int
+issysenter(struct trapframe *tf) {
+    struct proc *p = myproc();
+    char *k;
+
+    if (p == 0 || (tf->cs & 3) != DPL_USER || tf->eip + 2 > p->sz ||
+        tf->eip % PGSIZE == PGSIZE - 1)
+        return 0;
+    k = uva2ka(p->pgdir, (char *) PGROUNDDOWN(tf->eip));
+    return k != 0 && *(ushort *) (k + tf->eip % PGSIZE) == 0x340F;
+}
+
 //PAGEBREAK: 41
 void
 trap(struct trapframe *tf) {
+    uint va;
+
+    if (tf->trapno == T_DEBUG &&
+        (tf->eip == (uint) sysenter || tf->eip == (uint) sysenter + 3)) {
+        // SYSENTER kept the user's FL_TF. Before the entry's first
+        // instruction, the 3-byte movl (%esp), %esp, the trap frame
+        // sits on mycpu()->dbstack below ts.esp0. Run the rest of the
+        // entry without FL_TF, in the copy that restores it for the user.
+        tf->eflags &= ~FL_TF;
+        tf->eip = (uint) sysentertf + (tf->eip - (uint) sysenter);
+        return;
+    }
+    if (tf->trapno == T_ILLOP && issysenter(tf)) {
+        // A CPU without SYSENTER: carry out the system call as if
+        // usys.S had used int $T_SYSCALL, returning past SYSENTER.
+        tf->eip = tf->edx;
+        tf->esp = tf->ecx;
+        tf->trapno = T_SYSCALL;
+        sti();
+    }
     if (tf->trapno == T_SYSCALL) {
         if (myproc()->killed)
             exit();
@@ -55,9 +111,22 @@ trap(struct trapframe *tf) {
             if (cpuid() == 0) {
                 acquire(&tickslock);
                 ticks++;
-                wakeup(&ticks);
                 release(&tickslock);
+                vdsotick(ticks);
             }
+            proftick(tf);
+            timerexpire();
+            lapiceoi();
+            break;
+        case T_IRQ0 + IRQ_WAKEUP:
+            // Sent by kickidle(); the interrupt itself ends hlt.
+            lapiceoi();
+            break;
+        case T_IRQ0 + IRQ_TLB:
+            // Sent by tlbshootdown(). Nothing on this CPU touches
+            // user memory between the two steps.
+            mycpu()->tlbflush = 0;
+            lcr3(rcr3());
             lapiceoi();
             break;
         case T_IRQ0 + IRQ_IDE:
@@ -81,6 +150,28 @@ trap(struct trapframe *tf) {
                     cpuid(), tf->cs, tf->eip);
             lapiceoi();
             break;
+        case T_DEVICE:
+            // First FPU or SSE instruction since the scheduler
+            // switched to this process; see fpu.c.
+            if (myproc() == 0 || (tf->cs & 3) == 0)
+                panic("trap: kernel used the FPU");
+            fpufault();
+            break;
+        case T_PGFLT:
+            // Bring in a swapped-out page or a page of an mmap()
+            // region. Reading it from disk may sleep, so allow
+            // interrupts as a system call would. The kernel may
+            // fault on a user page too, as long as it had interrupts
+            // on and so holds no spinlock. Any other fault is
+            // unexpected.
+            if (myproc() != 0 && (tf->eflags & FL_IF)) {
+                va = rcr2();
+                sti();
+                if (swapfault(va) == 0 || mmapfault(va, tf->err) == 0)
+                    break;
+                cli();
+            }
+            // fall through
 
             //PAGEBREAK: 13
         default:
@@ -107,8 +198,13 @@ trap(struct trapframe *tf) {
     // Force process to give up CPU on clock tick.
     // If interrupts were on while locks held, would need to check nlock.
     if (myproc() && myproc()->state == RUNNING &&
-        tf->trapno == T_IRQ0 + IRQ_TIMER)
+        tf->trapno == T_IRQ0 + IRQ_TIMER) {
+        // Only a process preempted in user mode may have its
+        // pages swapped out while it waits.
+        myproc()->swappable = (tf->cs & 3) == DPL_USER;
         yield();
+        myproc()->swappable = 0;
+    }
 
     // Check if the process has been killed since we yielded
     if (myproc() && myproc()->killed && (tf->cs & 3) == DPL_USER)
@@ -0,0 +1,9 @@
+// Buffers for readv() and writev().
+// Both the kernel and user programs use this header file.
+
+#define IOV_MAX 16      // most buffers per call
+
+struct iovec {
+  void *base;
+  int len;
+};
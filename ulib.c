@@ -3,6 +3,43 @@
 #include "fcntl.h"
 #include "user.h"
 #include "x86.h"
+#include "futex.h"
+#include "param.h"
+#include "mmu.h"
+#include "memlayout.h"
+#include "vdso.h"
+
+// Called before fork(), exec() and exit(), once stdio.c has
+// output to flush, so that it is neither copied nor lost.
+void (*flushhook)(void);
+
+int sysfork(void);
+int sysexec(char*, char**);
+int sysexit(void) __attribute__((noreturn));
+
+int
+fork(void)
+{
+  if(flushhook)
+    flushhook();
+  return sysfork();
+}
+
+int
+exec(char *path, char **argv)
+{
+  if(flushhook)
+    flushhook();
+  return sysexec(path, argv);
+}
+
+int
+exit(void)
+{
+  if(flushhook)
+    flushhook();
+  sysexit();
+}
 
 char*
 strcpy(char *s, const char *t)
@@ -49,24 +86,6 @@ strchr(const char *s, char c)
   return 0;
 }
 
-char*
-gets(char *buf, int max)
-{
-  int i, cc;
-  char c;
-
-  for(i=0; i+1 < max; ){
-    cc = read(0, &c, 1);
-    if(cc < 1)
-      break;
-    buf[i++] = c;
-    if(c == '\n' || c == '\r')
-      break;
-  }
-  buf[i] = '\0';
-  return buf;
-}
-
 int
 stat(const char *n, struct stat *st)
 {
@@ -104,3 +123,76 @@ memmove(void *vdst, const void *vsrc, int n)
     *dst++ = *src++;
   return vdst;
 }
+
+// Futex-based mutex (Drepper, "Futexes Are Tricky", mutex 2).
+// The uncontended paths never enter the kernel.
+void
+mutex_init(struct mutex *m)
+{
+  m->val = 0;
+}
+
+void
+mutex_lock(struct mutex *m)
+{
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+    return;
+  if(c != 2)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+    futex(&m->val, FUTEX_WAIT, 2);
+    c = xchg(&m->val, 2);
+  }
+}
+
+void
+mutex_unlock(struct mutex *m)
+{
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+    m->val = 0;
+    futex(&m->val, FUTEX_WAKE, 1);
+  }
+}
+
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+// Release m and wait for a signal, then reacquire m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  uint seq;
+
+  seq = c->seq;
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+  mutex_lock(m);
+}
+
+void
+cond_signal(struct cond *c)
+{
+  __sync_fetch_and_add(&c->seq, 1);
+  futex(&c->seq, FUTEX_WAKE, 1);
+}
+
+void
+cond_broadcast(struct cond *c)
+{
+  __sync_fetch_and_add(&c->seq, 1);
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+}
+
+// Clock ticks since boot, read from the kernel's vdso page
+// without a system call.
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+}
@@ -2,31 +2,83 @@
 #include "stat.h"
 #include "user.h"
 #include "param.h"
+#include "mmu.h"
 
-// Memory allocator by Kernighan and Ritchie,
-// The C programming Language, 2nd ed.  Section 8.7.
+// Memory allocator.
+//
+// Small blocks, of up to SMALLMAX bytes with their header, come in
+// NCLASS power-of-two size classes, each with its own free list, so
+// that malloc() and free() of one take constant time. A class list
+// is refilled by carving up a CHUNK-byte block.
+//
+// Larger blocks, and the chunks, come from the address-ordered
+// first-fit list by Kernighan and Ritchie, The C Programming
+// Language, 2nd ed., Section 8.7, which coalesces neighbours on
+// free(). When a free block of at least TRIM bytes reaches the top
+// of the heap, its whole pages go back to the kernel with a
+// negative sbrk().
+//
+// Once thread_create() has started a thread, a mutex guards the
+// shared lists, and each thread keeps a cache of up to TCACHEMAX
+// free small blocks per class that it uses without locking. The
+// main thread's cache is static; another thread's hangs off the
+// block below its stack page, so threads that call malloc() must
+// come from thread_create() (see uthread.c).
 
 typedef long Align;
 
 union header {
   struct {
     union header *ptr;
-    uint size;
+    uint size;          // in units of sizeof(Header)
   } s;
   Align x;
 };
 
 typedef union header Header;
 
+#define NCLASS     8
+#define SMALLMAX   (16 << (NCLASS-1))   // bytes, with the header
+#define CHUNK      4096
+#define TRIM       (64*1024)
+#define TCACHEMAX  32
+#define BATCH      (TCACHEMAX/2)        // blocks moved at a time
+
+struct tcache {
+  Header *list[NCLASS];
+  int n[NCLASS];
+};
+
 static Header base;
 static Header *freep;
+static char *heapend;   // end of the memory from morecore()
+static Header *small[NCLASS];
+static struct tcache maincache;
+static struct mutex lock;
+static int threaded;
+static uint mainstack;  // the main thread's stack page
 
-void
-free(void *ap)
+static void
+acquire(void)
 {
-  Header *bp, *p;
+  if(threaded)
+    mutex_lock(&lock);
+}
+
+static void
+release(void)
+{
+  if(threaded)
+    mutex_unlock(&lock);
+}
+
+// Give a big block back to the first-fit list, and return the
+// free block that now holds it. Caller holds lock.
+static Header*
+bigfree(Header *bp)
+{
+  Header *p;
 
-  bp = (Header*)ap - 1;
   for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
     if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
       break;
@@ -35,12 +87,33 @@ free(void *ap)
     bp->s.ptr = p->s.ptr->s.ptr;
   } else
     bp->s.ptr = p->s.ptr;
+  freep = p;
   if(p + p->s.size == bp){
     p->s.size += bp->s.size;
     p->s.ptr = bp->s.ptr;
-  } else
-    p->s.ptr = bp;
-  freep = p;
+    return p;
+  }
+  p->s.ptr = bp;
+  return bp;
+}
+
+// If free block bp ends the heap, return its whole pages to the
+// kernel, unless something else has moved the break since.
+// Caller holds lock.
+static void
+trim(Header *bp)
+{
+  char *end;
+  uint n;
+
+  if((char*)(bp + bp->s.size) != heapend)
+    return;
+  end = (char*)PGROUNDUP((uint)(bp + 2));
+  n = heapend - end;
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    bp->s.size -= n / sizeof(Header);
+    heapend = end;
+  }
 }
 
 static Header*
@@ -54,19 +127,19 @@ morecore(uint nu)
   p = sbrk(nu * sizeof(Header));
   if(p == (char*)-1)
     return 0;
+  heapend = p + nu * sizeof(Header);
   hp = (Header*)p;
   hp->s.size = nu;
-  free((void*)(hp + 1));
+  bigfree(hp);
   return freep;
 }
 
-void*
-malloc(uint nbytes)
+// Allocate a big block of nunits units. Caller holds lock.
+static Header*
+bigalloc(uint nunits)
 {
   Header *p, *prevp;
-  uint nunits;
 
-  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
   if((prevp = freep) == 0){
     base.s.ptr = freep = prevp = &base;
     base.s.size = 0;
@@ -81,10 +154,171 @@ malloc(uint nbytes)
         p->s.size = nunits;
       }
       freep = prevp;
-      return (void*)(p + 1);
+      return p;
     }
     if(p == freep)
       if((p = morecore(nunits)) == 0)
         return 0;
   }
 }
+
+// Return the calling thread's cache.
+static struct tcache*
+mycache(void)
+{
+  uint sp;
+  struct tcache **cp;
+
+  sp = PGROUNDDOWN((uint)&sp);
+  if(!threaded || sp == mainstack)
+    return &maincache;
+  cp = (struct tcache**)sp - 2;
+  if(*cp == 0){
+    acquire();
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    release();
+    if(*cp == 0)
+      return 0;
+    *cp = (struct tcache*)((Header*)*cp + 1);
+    memset(*cp, 0, sizeof(**cp));
+  }
+  return *cp;
+}
+
+// Move up to n blocks of class c from the shared list to cache tc,
+// carving a new chunk if the list is empty. Returns the number moved.
+static int
+refill(struct tcache *tc, int c, int n)
+{
+  Header *p, *chunk;
+  int i, units, moved;
+
+  units = 2 << c;
+  acquire();
+  if(small[c] == 0){
+    if((chunk = bigalloc(CHUNK / sizeof(Header) + 1)) == 0){
+      release();
+      return 0;
+    }
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+      p->s.size = units;
+      p->s.ptr = small[c];
+      small[c] = p;
+    }
+  }
+  for(moved = 0; moved < n && small[c]; moved++){
+    p = small[c];
+    small[c] = p->s.ptr;
+    p->s.ptr = tc->list[c];
+    tc->list[c] = p;
+  }
+  release();
+  tc->n[c] += moved;
+  return moved;
+}
+
+// Move n blocks of class c from cache tc to the shared list.
+static void
+drain(struct tcache *tc, int c, int n)
+{
+  Header *p;
+
+  acquire();
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    tc->list[c] = p->s.ptr;
+    tc->n[c]--;
+    p->s.ptr = small[c];
+    small[c] = p;
+  }
+  release();
+}
+
+void
+free(void *ap)
+{
+  Header *bp;
+  struct tcache *tc;
+  int c;
+
+  if(ap == 0)
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLMAX / sizeof(Header)){
+    acquire();
+    trim(bigfree(bp));
+    release();
+    return;
+  }
+  for(c = 0; (2 << c) < bp->s.size; c++)
+    ;
+  if((tc = mycache()) == 0){
+    acquire();
+    bp->s.ptr = small[c];
+    small[c] = bp;
+    release();
+    return;
+  }
+  bp->s.ptr = tc->list[c];
+  tc->list[c] = bp;
+  if(++tc->n[c] > TCACHEMAX)
+    drain(tc, c, BATCH);
+}
+
+void*
+malloc(uint nbytes)
+{
+  Header *p;
+  struct tcache *tc;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+  if(nunits > SMALLMAX / sizeof(Header)){
+    acquire();
+    p = bigalloc(nunits);
+    release();
+    return p ? (void*)(p + 1) : 0;
+  }
+  for(c = 0; (2 << c) < nunits; c++)
+    ;
+  if((tc = mycache()) == 0)
+    return 0;
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    return 0;
+  p = tc->list[c];
+  tc->list[c] = p->s.ptr;
+  tc->n[c]--;
+  return (void*)(p + 1);
+}
+
+// Called by thread_create() before the first thread starts,
+// so by the main thread.
+void
+malloc_threaded(void)
+{
+  uint sp;
+
+  if(threaded)
+    return;
+  mutex_init(&lock);
+  mainstack = PGROUNDDOWN((uint)&sp);
+  threaded = 1;
+}
+
+// Called by thread_join() with the cache slot of a finished
+// thread: give its blocks, and the cache itself, back.
+void
+malloc_thread_exit(void **cachep)
+{
+  struct tcache *tc;
+  int c;
+
+  if((tc = *cachep) == 0)
+    return;
+  for(c = 0; c < NCLASS; c++)
+    drain(tc, c, tc->n[c]);
+  acquire();
+  trim(bigfree((Header*)tc - 1));
+  release();
+  *cachep = 0;
+}
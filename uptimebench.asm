@@ -0,0 +1,4020 @@
+
+_uptimebench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "%s: %d calls in %d ticks, %d calls/s\n", name, N, t, N / t * 100);
+}
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  run("vdso", uptime);
+      11:	68 50 04 00 00       	push   $0x450
+      16:	68 8e 1d 00 00       	push   $0x1d8e
+      1b:	e8 30 00 00 00       	call   50 <run>
+  run("syscall", uptimeint);
+      20:	58                   	pop    %eax
+      21:	5a                   	pop    %edx
+      22:	68 40 00 00 00       	push   $0x40
+      27:	68 93 1d 00 00       	push   $0x1d93
+      2c:	e8 1f 00 00 00       	call   50 <run>
+  exit();
+      31:	e8 ea 00 00 00       	call   120 <exit>
+      36:	66 90                	xchg   %ax,%ax
+      38:	66 90                	xchg   %ax,%ax
+      3a:	66 90                	xchg   %ax,%ax
+      3c:	66 90                	xchg   %ax,%ax
+      3e:	66 90                	xchg   %ax,%ax
+
+00000040 <uptimeint>:
+  asm volatile("int %1" : "=a" (r) : "i" (T_SYSCALL), "a" (SYS_uptime) : "memory");
+      40:	b8 0e 00 00 00       	mov    $0xe,%eax
+      45:	cd 40                	int    $0x40
+}
+      47:	c3                   	ret
+      48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      4f:	90                   	nop
+
+00000050 <run>:
+{
+      50:	55                   	push   %ebp
+      51:	89 e5                	mov    %esp,%ebp
+      53:	57                   	push   %edi
+      54:	56                   	push   %esi
+      55:	53                   	push   %ebx
+  t = uptime();
+      56:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+{
+      5b:	83 ec 0c             	sub    $0xc,%esp
+      5e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  t = uptime();
+      61:	e8 ea 03 00 00       	call   450 <uptime>
+      66:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < N; i++)
+      68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      6f:	90                   	nop
+    fn();
+      70:	ff d6                	call   *%esi
+  for(i = 0; i < N; i++)
+      72:	83 eb 01             	sub    $0x1,%ebx
+      75:	75 f9                	jne    70 <run+0x20>
+  t = uptime() - t;
+      77:	e8 d4 03 00 00       	call   450 <uptime>
+  if(t == 0)
+      7c:	29 f8                	sub    %edi,%eax
+      7e:	89 c1                	mov    %eax,%ecx
+      80:	74 30                	je     b2 <run+0x62>
+  printf(1, "%s: %d calls in %d ticks, %d calls/s\n", name, N, t, N / t * 100);
+      82:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+      87:	31 d2                	xor    %edx,%edx
+      89:	f7 f9                	idiv   %ecx
+      8b:	6b c0 64             	imul   $0x64,%eax,%eax
+      8e:	83 ec 08             	sub    $0x8,%esp
+      91:	50                   	push   %eax
+      92:	51                   	push   %ecx
+      93:	68 40 42 0f 00       	push   $0xf4240
+      98:	ff 75 08             	push   0x8(%ebp)
+      9b:	68 68 1d 00 00       	push   $0x1d68
+      a0:	6a 01                	push   $0x1
+      a2:	e8 39 08 00 00       	call   8e0 <printf>
+}
+      a7:	83 c4 20             	add    $0x20,%esp
+      aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      ad:	5b                   	pop    %ebx
+      ae:	5e                   	pop    %esi
+      af:	5f                   	pop    %edi
+      b0:	5d                   	pop    %ebp
+      b1:	c3                   	ret
+      b2:	b8 00 e1 f5 05       	mov    $0x5f5e100,%eax
+    t = 1;
+      b7:	b9 01 00 00 00       	mov    $0x1,%ecx
+      bc:	eb d0                	jmp    8e <run+0x3e>
+      be:	66 90                	xchg   %ax,%ax
+
+000000c0 <fork>:
+int sysexit(void) __attribute__((noreturn));
+
+int
+fork(void)
+{
+  if(flushhook)
+      c0:	a1 80 28 00 00       	mov    0x2880,%eax
+      c5:	85 c0                	test   %eax,%eax
+      c7:	74 17                	je     e0 <fork+0x20>
+{
+      c9:	55                   	push   %ebp
+      ca:	89 e5                	mov    %esp,%ebp
+      cc:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+      cf:	ff d0                	call   *%eax
+  return sysfork();
+}
+      d1:	c9                   	leave
+  return sysfork();
+      d2:	e9 7f 03 00 00       	jmp    456 <sysfork>
+      d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      de:	66 90                	xchg   %ax,%ax
+      e0:	e9 71 03 00 00       	jmp    456 <sysfork>
+      e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000f0 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+      f0:	55                   	push   %ebp
+  if(flushhook)
+      f1:	a1 80 28 00 00       	mov    0x2880,%eax
+{
+      f6:	89 e5                	mov    %esp,%ebp
+      f8:	56                   	push   %esi
+      f9:	53                   	push   %ebx
+      fa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+      fd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     100:	85 c0                	test   %eax,%eax
+     102:	74 02                	je     106 <exec+0x16>
+    flushhook();
+     104:	ff d0                	call   *%eax
+  return sysexec(path, argv);
+     106:	89 75 0c             	mov    %esi,0xc(%ebp)
+     109:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     10c:	5b                   	pop    %ebx
+     10d:	5e                   	pop    %esi
+     10e:	5d                   	pop    %ebp
+  return sysexec(path, argv);
+     10f:	e9 ba 03 00 00       	jmp    4ce <sysexec>
+     114:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     11b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     11f:	90                   	nop
+
+00000120 <exit>:
+
+int
+exit(void)
+{
+     120:	55                   	push   %ebp
+     121:	89 e5                	mov    %esp,%ebp
+     123:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     126:	a1 80 28 00 00       	mov    0x2880,%eax
+     12b:	85 c0                	test   %eax,%eax
+     12d:	74 02                	je     131 <exit+0x11>
+    flushhook();
+     12f:	ff d0                	call   *%eax
+  sysexit();
+     131:	e8 2f 03 00 00       	call   465 <sysexit>
+     136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     13d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000140 <strcpy>:
+}
+
+char*
+strcpy(char *s, const char *t)
+{
+     140:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     141:	31 c0                	xor    %eax,%eax
+{
+     143:	89 e5                	mov    %esp,%ebp
+     145:	53                   	push   %ebx
+     146:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     149:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     150:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     154:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     157:	83 c0 01             	add    $0x1,%eax
+     15a:	84 d2                	test   %dl,%dl
+     15c:	75 f2                	jne    150 <strcpy+0x10>
+    ;
+  return os;
+}
+     15e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     161:	89 c8                	mov    %ecx,%eax
+     163:	c9                   	leave
+     164:	c3                   	ret
+     165:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     16c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000170 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     170:	55                   	push   %ebp
+     171:	89 e5                	mov    %esp,%ebp
+     173:	53                   	push   %ebx
+     174:	8b 55 08             	mov    0x8(%ebp),%edx
+     177:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     17a:	0f b6 02             	movzbl (%edx),%eax
+     17d:	84 c0                	test   %al,%al
+     17f:	75 17                	jne    198 <strcmp+0x28>
+     181:	eb 3a                	jmp    1bd <strcmp+0x4d>
+     183:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     187:	90                   	nop
+     188:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     18c:	83 c2 01             	add    $0x1,%edx
+     18f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     192:	84 c0                	test   %al,%al
+     194:	74 1a                	je     1b0 <strcmp+0x40>
+    p++, q++;
+     196:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     198:	0f b6 19             	movzbl (%ecx),%ebx
+     19b:	38 c3                	cmp    %al,%bl
+     19d:	74 e9                	je     188 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     19f:	29 d8                	sub    %ebx,%eax
+}
+     1a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1a4:	c9                   	leave
+     1a5:	c3                   	ret
+     1a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     1b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     1b4:	31 c0                	xor    %eax,%eax
+     1b6:	29 d8                	sub    %ebx,%eax
+}
+     1b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1bb:	c9                   	leave
+     1bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     1bd:	0f b6 19             	movzbl (%ecx),%ebx
+     1c0:	31 c0                	xor    %eax,%eax
+     1c2:	eb db                	jmp    19f <strcmp+0x2f>
+     1c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1cf:	90                   	nop
+
+000001d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     1d0:	55                   	push   %ebp
+     1d1:	89 e5                	mov    %esp,%ebp
+     1d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     1d6:	80 3a 00             	cmpb   $0x0,(%edx)
+     1d9:	74 15                	je     1f0 <strlen+0x20>
+     1db:	31 c0                	xor    %eax,%eax
+     1dd:	8d 76 00             	lea    0x0(%esi),%esi
+     1e0:	83 c0 01             	add    $0x1,%eax
+     1e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     1e7:	89 c1                	mov    %eax,%ecx
+     1e9:	75 f5                	jne    1e0 <strlen+0x10>
+    ;
+  return n;
+}
+     1eb:	89 c8                	mov    %ecx,%eax
+     1ed:	5d                   	pop    %ebp
+     1ee:	c3                   	ret
+     1ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+     1f0:	31 c9                	xor    %ecx,%ecx
+}
+     1f2:	5d                   	pop    %ebp
+     1f3:	89 c8                	mov    %ecx,%eax
+     1f5:	c3                   	ret
+     1f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000200 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     200:	55                   	push   %ebp
+     201:	89 e5                	mov    %esp,%ebp
+     203:	57                   	push   %edi
+     204:	8b 55 08             	mov    0x8(%ebp),%edx
+            "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt) {
+    asm volatile("cld; rep stosb" :
+     207:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     20a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     20d:	89 d7                	mov    %edx,%edi
+     20f:	fc                   	cld
+     210:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     212:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     215:	89 d0                	mov    %edx,%eax
+     217:	c9                   	leave
+     218:	c3                   	ret
+     219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000220 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     220:	55                   	push   %ebp
+     221:	89 e5                	mov    %esp,%ebp
+     223:	8b 45 08             	mov    0x8(%ebp),%eax
+     226:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     22a:	0f b6 10             	movzbl (%eax),%edx
+     22d:	84 d2                	test   %dl,%dl
+     22f:	75 12                	jne    243 <strchr+0x23>
+     231:	eb 1d                	jmp    250 <strchr+0x30>
+     233:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     237:	90                   	nop
+     238:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     23c:	83 c0 01             	add    $0x1,%eax
+     23f:	84 d2                	test   %dl,%dl
+     241:	74 0d                	je     250 <strchr+0x30>
+    if(*s == c)
+     243:	38 d1                	cmp    %dl,%cl
+     245:	75 f1                	jne    238 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     247:	5d                   	pop    %ebp
+     248:	c3                   	ret
+     249:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     250:	31 c0                	xor    %eax,%eax
+}
+     252:	5d                   	pop    %ebp
+     253:	c3                   	ret
+     254:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     25b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     25f:	90                   	nop
+
+00000260 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     260:	55                   	push   %ebp
+     261:	89 e5                	mov    %esp,%ebp
+     263:	56                   	push   %esi
+     264:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     265:	83 ec 08             	sub    $0x8,%esp
+     268:	6a 00                	push   $0x0
+     26a:	ff 75 08             	push   0x8(%ebp)
+     26d:	e8 6b 02 00 00       	call   4dd <open>
+  if(fd < 0)
+     272:	83 c4 10             	add    $0x10,%esp
+     275:	85 c0                	test   %eax,%eax
+     277:	78 27                	js     2a0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     279:	83 ec 08             	sub    $0x8,%esp
+     27c:	ff 75 0c             	push   0xc(%ebp)
+     27f:	89 c3                	mov    %eax,%ebx
+     281:	50                   	push   %eax
+     282:	e8 83 02 00 00       	call   50a <fstat>
+  close(fd);
+     287:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     28a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     28c:	e8 1f 02 00 00       	call   4b0 <close>
+  return r;
+     291:	83 c4 10             	add    $0x10,%esp
+}
+     294:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     297:	89 f0                	mov    %esi,%eax
+     299:	5b                   	pop    %ebx
+     29a:	5e                   	pop    %esi
+     29b:	5d                   	pop    %ebp
+     29c:	c3                   	ret
+     29d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     2a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     2a5:	eb ed                	jmp    294 <stat+0x34>
+     2a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2ae:	66 90                	xchg   %ax,%ax
+
+000002b0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     2b0:	55                   	push   %ebp
+     2b1:	89 e5                	mov    %esp,%ebp
+     2b3:	53                   	push   %ebx
+     2b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     2b7:	0f be 02             	movsbl (%edx),%eax
+     2ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     2bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     2c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     2c5:	77 1e                	ja     2e5 <atoi+0x35>
+     2c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     2d0:	83 c2 01             	add    $0x1,%edx
+     2d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     2d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     2da:	0f be 02             	movsbl (%edx),%eax
+     2dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     2e0:	80 fb 09             	cmp    $0x9,%bl
+     2e3:	76 eb                	jbe    2d0 <atoi+0x20>
+  return n;
+}
+     2e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2e8:	89 c8                	mov    %ecx,%eax
+     2ea:	c9                   	leave
+     2eb:	c3                   	ret
+     2ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002f0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     2f0:	55                   	push   %ebp
+     2f1:	89 e5                	mov    %esp,%ebp
+     2f3:	57                   	push   %edi
+     2f4:	56                   	push   %esi
+     2f5:	8b 45 10             	mov    0x10(%ebp),%eax
+     2f8:	8b 55 08             	mov    0x8(%ebp),%edx
+     2fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     2fe:	85 c0                	test   %eax,%eax
+     300:	7e 13                	jle    315 <memmove+0x25>
+     302:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     304:	89 d7                	mov    %edx,%edi
+     306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     30d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     310:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     311:	39 f8                	cmp    %edi,%eax
+     313:	75 fb                	jne    310 <memmove+0x20>
+  return vdst;
+}
+     315:	5e                   	pop    %esi
+     316:	89 d0                	mov    %edx,%eax
+     318:	5f                   	pop    %edi
+     319:	5d                   	pop    %ebp
+     31a:	c3                   	ret
+     31b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     31f:	90                   	nop
+
+00000320 <mutex_init>:
+
+// Futex-based mutex (Drepper, "Futexes Are Tricky", mutex 2).
+// The uncontended paths never enter the kernel.
+void
+mutex_init(struct mutex *m)
+{
+     320:	55                   	push   %ebp
+     321:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+     323:	8b 45 08             	mov    0x8(%ebp),%eax
+     326:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     32c:	5d                   	pop    %ebp
+     32d:	c3                   	ret
+     32e:	66 90                	xchg   %ax,%ax
+
+00000330 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     330:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     331:	31 c0                	xor    %eax,%eax
+     333:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+     338:	89 e5                	mov    %esp,%ebp
+     33a:	56                   	push   %esi
+     33b:	53                   	push   %ebx
+     33c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     33f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     343:	85 c0                	test   %eax,%eax
+     345:	74 32                	je     379 <mutex_lock+0x49>
+    return;
+  if(c != 2)
+     347:	83 f8 02             	cmp    $0x2,%eax
+     34a:	74 0c                	je     358 <mutex_lock+0x28>
+static inline uint
+xchg(volatile uint *addr, uint newval) {
+    uint result;
+
+    // The + in "+m" denotes a read-modify-write operand.
+    asm volatile("lock; xchgl %0, %1" :
+     34c:	b8 02 00 00 00       	mov    $0x2,%eax
+     351:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+     354:	85 c0                	test   %eax,%eax
+     356:	74 21                	je     379 <mutex_lock+0x49>
+     358:	be 02 00 00 00       	mov    $0x2,%esi
+     35d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAIT, 2);
+     360:	83 ec 04             	sub    $0x4,%esp
+     363:	6a 02                	push   $0x2
+     365:	6a 00                	push   $0x0
+     367:	53                   	push   %ebx
+     368:	e8 33 02 00 00       	call   5a0 <futex>
+     36d:	89 f0                	mov    %esi,%eax
+     36f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     372:	83 c4 10             	add    $0x10,%esp
+     375:	85 c0                	test   %eax,%eax
+     377:	75 e7                	jne    360 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+     379:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     37c:	5b                   	pop    %ebx
+     37d:	5e                   	pop    %esi
+     37e:	5d                   	pop    %ebp
+     37f:	c3                   	ret
+
+00000380 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     380:	55                   	push   %ebp
+     381:	89 e5                	mov    %esp,%ebp
+     383:	83 ec 08             	sub    $0x8,%esp
+     386:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     389:	f0 83 28 01          	lock subl $0x1,(%eax)
+     38d:	75 09                	jne    398 <mutex_unlock+0x18>
+    m->val = 0;
+    futex(&m->val, FUTEX_WAKE, 1);
+  }
+}
+     38f:	c9                   	leave
+     390:	c3                   	ret
+     391:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     398:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     39b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex(&m->val, FUTEX_WAKE, 1);
+     3a1:	6a 01                	push   $0x1
+     3a3:	6a 01                	push   $0x1
+     3a5:	50                   	push   %eax
+     3a6:	e8 f5 01 00 00       	call   5a0 <futex>
+     3ab:	83 c4 10             	add    $0x10,%esp
+}
+     3ae:	c9                   	leave
+     3af:	c3                   	ret
+
+000003b0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     3b0:	55                   	push   %ebp
+     3b1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     3b3:	8b 45 08             	mov    0x8(%ebp),%eax
+     3b6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     3bc:	5d                   	pop    %ebp
+     3bd:	c3                   	ret
+     3be:	66 90                	xchg   %ax,%ax
+
+000003c0 <cond_wait>:
+
+// Release m and wait for a signal, then reacquire m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     3c0:	55                   	push   %ebp
+     3c1:	89 e5                	mov    %esp,%ebp
+     3c3:	57                   	push   %edi
+     3c4:	56                   	push   %esi
+     3c5:	53                   	push   %ebx
+     3c6:	83 ec 0c             	sub    $0xc,%esp
+     3c9:	8b 75 08             	mov    0x8(%ebp),%esi
+     3cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     3cf:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     3d1:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+     3d5:	75 21                	jne    3f8 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     3d7:	83 ec 04             	sub    $0x4,%esp
+     3da:	57                   	push   %edi
+     3db:	6a 00                	push   $0x0
+     3dd:	56                   	push   %esi
+     3de:	e8 bd 01 00 00       	call   5a0 <futex>
+  mutex_lock(m);
+     3e3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     3e6:	83 c4 10             	add    $0x10,%esp
+}
+     3e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     3ec:	5b                   	pop    %ebx
+     3ed:	5e                   	pop    %esi
+     3ee:	5f                   	pop    %edi
+     3ef:	5d                   	pop    %ebp
+  mutex_lock(m);
+     3f0:	e9 3b ff ff ff       	jmp    330 <mutex_lock>
+     3f5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     3f8:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     3fb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex(&m->val, FUTEX_WAKE, 1);
+     401:	6a 01                	push   $0x1
+     403:	6a 01                	push   $0x1
+     405:	53                   	push   %ebx
+     406:	e8 95 01 00 00       	call   5a0 <futex>
+     40b:	83 c4 10             	add    $0x10,%esp
+     40e:	eb c7                	jmp    3d7 <cond_wait+0x17>
+
+00000410 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+     410:	55                   	push   %ebp
+     411:	89 e5                	mov    %esp,%ebp
+     413:	83 ec 0c             	sub    $0xc,%esp
+     416:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     419:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+     41d:	6a 01                	push   $0x1
+     41f:	6a 01                	push   $0x1
+     421:	50                   	push   %eax
+     422:	e8 79 01 00 00       	call   5a0 <futex>
+}
+     427:	83 c4 10             	add    $0x10,%esp
+     42a:	c9                   	leave
+     42b:	c3                   	ret
+     42c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000430 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     430:	55                   	push   %ebp
+     431:	89 e5                	mov    %esp,%ebp
+     433:	83 ec 0c             	sub    $0xc,%esp
+     436:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     439:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+     43d:	6a 40                	push   $0x40
+     43f:	6a 01                	push   $0x1
+     441:	50                   	push   %eax
+     442:	e8 59 01 00 00       	call   5a0 <futex>
+}
+     447:	83 c4 10             	add    $0x10,%esp
+     44a:	c9                   	leave
+     44b:	c3                   	ret
+     44c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000450 <uptime>:
+// Clock ticks since boot, read from the kernel's vdso page
+// without a system call.
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     450:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+     455:	c3                   	ret
+
+00000456 <sysfork>:
+  1: ret
+
+#define SYSCALL(name) SYSCALLAS(name, name)
+
+// ulib.c wraps these.
+SYSCALLAS(sysfork, fork)
+     456:	b8 01 00 00 00       	mov    $0x1,%eax
+     45b:	89 e1                	mov    %esp,%ecx
+     45d:	ba 64 04 00 00       	mov    $0x464,%edx
+     462:	0f 34                	sysenter
+     464:	c3                   	ret
+
+00000465 <sysexit>:
+SYSCALLAS(sysexit, exit)
+     465:	b8 02 00 00 00       	mov    $0x2,%eax
+     46a:	89 e1                	mov    %esp,%ecx
+     46c:	ba 73 04 00 00       	mov    $0x473,%edx
+     471:	0f 34                	sysenter
+     473:	c3                   	ret
+
+00000474 <wait>:
+SYSCALL(wait)
+     474:	b8 03 00 00 00       	mov    $0x3,%eax
+     479:	89 e1                	mov    %esp,%ecx
+     47b:	ba 82 04 00 00       	mov    $0x482,%edx
+     480:	0f 34                	sysenter
+     482:	c3                   	ret
+
+00000483 <pipe>:
+SYSCALL(pipe)
+     483:	b8 04 00 00 00       	mov    $0x4,%eax
+     488:	89 e1                	mov    %esp,%ecx
+     48a:	ba 91 04 00 00       	mov    $0x491,%edx
+     48f:	0f 34                	sysenter
+     491:	c3                   	ret
+
+00000492 <read>:
+SYSCALL(read)
+     492:	b8 05 00 00 00       	mov    $0x5,%eax
+     497:	89 e1                	mov    %esp,%ecx
+     499:	ba a0 04 00 00       	mov    $0x4a0,%edx
+     49e:	0f 34                	sysenter
+     4a0:	c3                   	ret
+
+000004a1 <write>:
+SYSCALL(write)
+     4a1:	b8 10 00 00 00       	mov    $0x10,%eax
+     4a6:	89 e1                	mov    %esp,%ecx
+     4a8:	ba af 04 00 00       	mov    $0x4af,%edx
+     4ad:	0f 34                	sysenter
+     4af:	c3                   	ret
+
+000004b0 <close>:
+SYSCALL(close)
+     4b0:	b8 15 00 00 00       	mov    $0x15,%eax
+     4b5:	89 e1                	mov    %esp,%ecx
+     4b7:	ba be 04 00 00       	mov    $0x4be,%edx
+     4bc:	0f 34                	sysenter
+     4be:	c3                   	ret
+
+000004bf <kill>:
+SYSCALL(kill)
+     4bf:	b8 06 00 00 00       	mov    $0x6,%eax
+     4c4:	89 e1                	mov    %esp,%ecx
+     4c6:	ba cd 04 00 00       	mov    $0x4cd,%edx
+     4cb:	0f 34                	sysenter
+     4cd:	c3                   	ret
+
+000004ce <sysexec>:
+SYSCALLAS(sysexec, exec)
+     4ce:	b8 07 00 00 00       	mov    $0x7,%eax
+     4d3:	89 e1                	mov    %esp,%ecx
+     4d5:	ba dc 04 00 00       	mov    $0x4dc,%edx
+     4da:	0f 34                	sysenter
+     4dc:	c3                   	ret
+
+000004dd <open>:
+SYSCALL(open)
+     4dd:	b8 0f 00 00 00       	mov    $0xf,%eax
+     4e2:	89 e1                	mov    %esp,%ecx
+     4e4:	ba eb 04 00 00       	mov    $0x4eb,%edx
+     4e9:	0f 34                	sysenter
+     4eb:	c3                   	ret
+
+000004ec <mknod>:
+SYSCALL(mknod)
+     4ec:	b8 11 00 00 00       	mov    $0x11,%eax
+     4f1:	89 e1                	mov    %esp,%ecx
+     4f3:	ba fa 04 00 00       	mov    $0x4fa,%edx
+     4f8:	0f 34                	sysenter
+     4fa:	c3                   	ret
+
+000004fb <unlink>:
+SYSCALL(unlink)
+     4fb:	b8 12 00 00 00       	mov    $0x12,%eax
+     500:	89 e1                	mov    %esp,%ecx
+     502:	ba 09 05 00 00       	mov    $0x509,%edx
+     507:	0f 34                	sysenter
+     509:	c3                   	ret
+
+0000050a <fstat>:
+SYSCALL(fstat)
+     50a:	b8 08 00 00 00       	mov    $0x8,%eax
+     50f:	89 e1                	mov    %esp,%ecx
+     511:	ba 18 05 00 00       	mov    $0x518,%edx
+     516:	0f 34                	sysenter
+     518:	c3                   	ret
+
+00000519 <link>:
+SYSCALL(link)
+     519:	b8 13 00 00 00       	mov    $0x13,%eax
+     51e:	89 e1                	mov    %esp,%ecx
+     520:	ba 27 05 00 00       	mov    $0x527,%edx
+     525:	0f 34                	sysenter
+     527:	c3                   	ret
+
+00000528 <mkdir>:
+SYSCALL(mkdir)
+     528:	b8 14 00 00 00       	mov    $0x14,%eax
+     52d:	89 e1                	mov    %esp,%ecx
+     52f:	ba 36 05 00 00       	mov    $0x536,%edx
+     534:	0f 34                	sysenter
+     536:	c3                   	ret
+
+00000537 <chdir>:
+SYSCALL(chdir)
+     537:	b8 09 00 00 00       	mov    $0x9,%eax
+     53c:	89 e1                	mov    %esp,%ecx
+     53e:	ba 45 05 00 00       	mov    $0x545,%edx
+     543:	0f 34                	sysenter
+     545:	c3                   	ret
+
+00000546 <dup>:
+SYSCALL(dup)
+     546:	b8 0a 00 00 00       	mov    $0xa,%eax
+     54b:	89 e1                	mov    %esp,%ecx
+     54d:	ba 54 05 00 00       	mov    $0x554,%edx
+     552:	0f 34                	sysenter
+     554:	c3                   	ret
+
+00000555 <getpid>:
+SYSCALL(getpid)
+     555:	b8 0b 00 00 00       	mov    $0xb,%eax
+     55a:	89 e1                	mov    %esp,%ecx
+     55c:	ba 63 05 00 00       	mov    $0x563,%edx
+     561:	0f 34                	sysenter
+     563:	c3                   	ret
+
+00000564 <sbrk>:
+SYSCALL(sbrk)
+     564:	b8 0c 00 00 00       	mov    $0xc,%eax
+     569:	89 e1                	mov    %esp,%ecx
+     56b:	ba 72 05 00 00       	mov    $0x572,%edx
+     570:	0f 34                	sysenter
+     572:	c3                   	ret
+
+00000573 <sleep>:
+SYSCALL(sleep)
+     573:	b8 0d 00 00 00       	mov    $0xd,%eax
+     578:	89 e1                	mov    %esp,%ecx
+     57a:	ba 81 05 00 00       	mov    $0x581,%edx
+     57f:	0f 34                	sysenter
+     581:	c3                   	ret
+
+00000582 <clone>:
+SYSCALL(clone)
+     582:	b8 16 00 00 00       	mov    $0x16,%eax
+     587:	89 e1                	mov    %esp,%ecx
+     589:	ba 90 05 00 00       	mov    $0x590,%edx
+     58e:	0f 34                	sysenter
+     590:	c3                   	ret
+
+00000591 <join>:
+SYSCALL(join)
+     591:	b8 17 00 00 00       	mov    $0x17,%eax
+     596:	89 e1                	mov    %esp,%ecx
+     598:	ba 9f 05 00 00       	mov    $0x59f,%edx
+     59d:	0f 34                	sysenter
+     59f:	c3                   	ret
+
+000005a0 <futex>:
+SYSCALL(futex)
+     5a0:	b8 18 00 00 00       	mov    $0x18,%eax
+     5a5:	89 e1                	mov    %esp,%ecx
+     5a7:	ba ae 05 00 00       	mov    $0x5ae,%edx
+     5ac:	0f 34                	sysenter
+     5ae:	c3                   	ret
+
+000005af <yield>:
+SYSCALL(yield)
+     5af:	b8 19 00 00 00       	mov    $0x19,%eax
+     5b4:	89 e1                	mov    %esp,%ecx
+     5b6:	ba bd 05 00 00       	mov    $0x5bd,%edx
+     5bb:	0f 34                	sysenter
+     5bd:	c3                   	ret
+
+000005be <lockstat>:
+SYSCALL(lockstat)
+     5be:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     5c3:	89 e1                	mov    %esp,%ecx
+     5c5:	ba cc 05 00 00       	mov    $0x5cc,%edx
+     5ca:	0f 34                	sysenter
+     5cc:	c3                   	ret
+
+000005cd <lockhammer>:
+SYSCALL(lockhammer)
+     5cd:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     5d2:	89 e1                	mov    %esp,%ecx
+     5d4:	ba db 05 00 00       	mov    $0x5db,%edx
+     5d9:	0f 34                	sysenter
+     5db:	c3                   	ret
+
+000005dc <vmsplice>:
+SYSCALL(vmsplice)
+     5dc:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     5e1:	89 e1                	mov    %esp,%ecx
+     5e3:	ba ea 05 00 00       	mov    $0x5ea,%edx
+     5e8:	0f 34                	sysenter
+     5ea:	c3                   	ret
+
+000005eb <hsbrk>:
+SYSCALL(hsbrk)
+     5eb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     5f0:	89 e1                	mov    %esp,%ecx
+     5f2:	ba f9 05 00 00       	mov    $0x5f9,%edx
+     5f7:	0f 34                	sysenter
+     5f9:	c3                   	ret
+
+000005fa <mmap>:
+SYSCALL(mmap)
+     5fa:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     5ff:	89 e1                	mov    %esp,%ecx
+     601:	ba 08 06 00 00       	mov    $0x608,%edx
+     606:	0f 34                	sysenter
+     608:	c3                   	ret
+
+00000609 <munmap>:
+SYSCALL(munmap)
+     609:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     60e:	89 e1                	mov    %esp,%ecx
+     610:	ba 17 06 00 00       	mov    $0x617,%edx
+     615:	0f 34                	sysenter
+     617:	c3                   	ret
+
+00000618 <ringenter>:
+SYSCALL(ringenter)
+     618:	b8 20 00 00 00       	mov    $0x20,%eax
+     61d:	89 e1                	mov    %esp,%ecx
+     61f:	ba 26 06 00 00       	mov    $0x626,%edx
+     624:	0f 34                	sysenter
+     626:	c3                   	ret
+
+00000627 <readv>:
+SYSCALL(readv)
+     627:	b8 21 00 00 00       	mov    $0x21,%eax
+     62c:	89 e1                	mov    %esp,%ecx
+     62e:	ba 35 06 00 00       	mov    $0x635,%edx
+     633:	0f 34                	sysenter
+     635:	c3                   	ret
+
+00000636 <writev>:
+SYSCALL(writev)
+     636:	b8 22 00 00 00       	mov    $0x22,%eax
+     63b:	89 e1                	mov    %esp,%ecx
+     63d:	ba 44 06 00 00       	mov    $0x644,%edx
+     642:	0f 34                	sysenter
+     644:	c3                   	ret
+
+00000645 <pread>:
+SYSCALL(pread)
+     645:	b8 23 00 00 00       	mov    $0x23,%eax
+     64a:	89 e1                	mov    %esp,%ecx
+     64c:	ba 53 06 00 00       	mov    $0x653,%edx
+     651:	0f 34                	sysenter
+     653:	c3                   	ret
+
+00000654 <pwrite>:
+SYSCALL(pwrite)
+     654:	b8 24 00 00 00       	mov    $0x24,%eax
+     659:	89 e1                	mov    %esp,%ecx
+     65b:	ba 62 06 00 00       	mov    $0x662,%edx
+     660:	0f 34                	sysenter
+     662:	c3                   	ret
+
+00000663 <prof>:
+SYSCALL(prof)
+     663:	b8 25 00 00 00       	mov    $0x25,%eax
+     668:	89 e1                	mov    %esp,%ecx
+     66a:	ba 71 06 00 00       	mov    $0x671,%edx
+     66f:	0f 34                	sysenter
+     671:	c3                   	ret
+
+00000672 <scstat>:
+SYSCALL(scstat)
+     672:	b8 26 00 00 00       	mov    $0x26,%eax
+     677:	89 e1                	mov    %esp,%ecx
+     679:	ba 80 06 00 00       	mov    $0x680,%edx
+     67e:	0f 34                	sysenter
+     680:	c3                   	ret
+     681:	66 90                	xchg   %ax,%ax
+     683:	66 90                	xchg   %ax,%ax
+     685:	66 90                	xchg   %ax,%ax
+     687:	66 90                	xchg   %ax,%ax
+     689:	66 90                	xchg   %ax,%ax
+     68b:	66 90                	xchg   %ax,%ax
+     68d:	66 90                	xchg   %ax,%ax
+     68f:	90                   	nop
+
+00000690 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+     690:	55                   	push   %ebp
+     691:	89 e5                	mov    %esp,%ebp
+     693:	57                   	push   %edi
+     694:	56                   	push   %esi
+     695:	53                   	push   %ebx
+     696:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     698:	89 d1                	mov    %edx,%ecx
+{
+     69a:	83 ec 2c             	sub    $0x2c,%esp
+     69d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+     6a0:	85 d2                	test   %edx,%edx
+     6a2:	79 7c                	jns    720 <printint+0x90>
+     6a4:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     6a8:	74 76                	je     720 <printint+0x90>
+    x = -xx;
+     6aa:	f7 d9                	neg    %ecx
+    neg = 1;
+     6ac:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     6b1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     6b4:	31 f6                	xor    %esi,%esi
+     6b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6bd:	8d 76 00             	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     6c0:	89 c8                	mov    %ecx,%eax
+     6c2:	31 d2                	xor    %edx,%edx
+     6c4:	89 f7                	mov    %esi,%edi
+     6c6:	f7 f3                	div    %ebx
+     6c8:	8d 76 01             	lea    0x1(%esi),%esi
+     6cb:	0f b6 92 fc 1d 00 00 	movzbl 0x1dfc(%edx),%edx
+     6d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     6d6:	89 ca                	mov    %ecx,%edx
+     6d8:	89 c1                	mov    %eax,%ecx
+     6da:	39 da                	cmp    %ebx,%edx
+     6dc:	73 e2                	jae    6c0 <printint+0x30>
+  if(neg)
+     6de:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     6e1:	85 c0                	test   %eax,%eax
+     6e3:	74 07                	je     6ec <printint+0x5c>
+    buf[i++] = '-';
+     6e5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     6ea:	89 f7                	mov    %esi,%edi
+     6ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     6ef:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     6f2:	01 df                	add    %ebx,%edi
+     6f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc_unlocked(buf[i], f);
+     6f8:	83 ec 08             	sub    $0x8,%esp
+     6fb:	56                   	push   %esi
+     6fc:	0f be 07             	movsbl (%edi),%eax
+     6ff:	50                   	push   %eax
+     700:	e8 cb 07 00 00       	call   ed0 <putc_unlocked>
+  while(--i >= 0)
+     705:	89 f8                	mov    %edi,%eax
+     707:	83 c4 10             	add    $0x10,%esp
+     70a:	83 ef 01             	sub    $0x1,%edi
+     70d:	39 d8                	cmp    %ebx,%eax
+     70f:	75 e7                	jne    6f8 <printint+0x68>
+}
+     711:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     714:	5b                   	pop    %ebx
+     715:	5e                   	pop    %esi
+     716:	5f                   	pop    %edi
+     717:	5d                   	pop    %ebp
+     718:	c3                   	ret
+     719:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     720:	31 c0                	xor    %eax,%eax
+     722:	eb 8d                	jmp    6b1 <printint+0x21>
+     724:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     72b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     72f:	90                   	nop
+
+00000730 <vfprintf>:
+
+// Print to the given stream, which the caller has locked.
+// Only understands %d, %x, %p, %s.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+     730:	55                   	push   %ebp
+     731:	89 e5                	mov    %esp,%ebp
+     733:	57                   	push   %edi
+     734:	56                   	push   %esi
+     735:	53                   	push   %ebx
+     736:	83 ec 1c             	sub    $0x1c,%esp
+     739:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     73c:	0f b6 0a             	movzbl (%edx),%ecx
+     73f:	84 c9                	test   %cl,%cl
+     741:	74 5c                	je     79f <vfprintf+0x6f>
+     743:	89 c6                	mov    %eax,%esi
+     745:	8d 5a 01             	lea    0x1(%edx),%ebx
+     748:	31 ff                	xor    %edi,%edi
+     74a:	eb 20                	jmp    76c <vfprintf+0x3c>
+     74c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     750:	83 f9 25             	cmp    $0x25,%ecx
+     753:	74 3b                	je     790 <vfprintf+0x60>
+        state = '%';
+      } else {
+        putc_unlocked(c, f);
+     755:	83 ec 08             	sub    $0x8,%esp
+     758:	56                   	push   %esi
+     759:	51                   	push   %ecx
+     75a:	e8 71 07 00 00       	call   ed0 <putc_unlocked>
+     75f:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     762:	0f b6 0b             	movzbl (%ebx),%ecx
+     765:	83 c3 01             	add    $0x1,%ebx
+     768:	84 c9                	test   %cl,%cl
+     76a:	74 33                	je     79f <vfprintf+0x6f>
+    if(state == 0){
+     76c:	85 ff                	test   %edi,%edi
+     76e:	74 e0                	je     750 <vfprintf+0x20>
+      }
+    } else if(state == '%'){
+     770:	83 ff 25             	cmp    $0x25,%edi
+     773:	75 ed                	jne    762 <vfprintf+0x32>
+      if(c == 'd'){
+     775:	83 f9 25             	cmp    $0x25,%ecx
+     778:	0f 84 02 01 00 00    	je     880 <vfprintf+0x150>
+     77e:	8d 41 9d             	lea    -0x63(%ecx),%eax
+     781:	83 f8 15             	cmp    $0x15,%eax
+     784:	77 2a                	ja     7b0 <vfprintf+0x80>
+     786:	ff 24 85 a4 1d 00 00 	jmp    *0x1da4(,%eax,4)
+     78d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     790:	0f b6 0b             	movzbl (%ebx),%ecx
+     793:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     796:	bf 25 00 00 00       	mov    $0x25,%edi
+  for(i = 0; fmt[i]; i++){
+     79b:	84 c9                	test   %cl,%cl
+     79d:	75 cd                	jne    76c <vfprintf+0x3c>
+        putc_unlocked(c, f);
+      }
+      state = 0;
+    }
+  }
+}
+     79f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     7a2:	5b                   	pop    %ebx
+     7a3:	5e                   	pop    %esi
+     7a4:	5f                   	pop    %edi
+     7a5:	5d                   	pop    %ebp
+     7a6:	c3                   	ret
+     7a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ae:	66 90                	xchg   %ax,%ax
+        putc_unlocked('%', f);
+     7b0:	83 ec 08             	sub    $0x8,%esp
+     7b3:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     7b6:	56                   	push   %esi
+     7b7:	6a 25                	push   $0x25
+     7b9:	e8 12 07 00 00       	call   ed0 <putc_unlocked>
+        putc_unlocked(c, f);
+     7be:	58                   	pop    %eax
+     7bf:	5a                   	pop    %edx
+     7c0:	56                   	push   %esi
+     7c1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     7c4:	51                   	push   %ecx
+     7c5:	e8 06 07 00 00       	call   ed0 <putc_unlocked>
+     7ca:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     7cd:	31 ff                	xor    %edi,%edi
+     7cf:	eb 91                	jmp    762 <vfprintf+0x32>
+     7d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+     7d8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     7db:	83 ec 0c             	sub    $0xc,%esp
+     7de:	b9 10 00 00 00       	mov    $0x10,%ecx
+     7e3:	8b 17                	mov    (%edi),%edx
+     7e5:	6a 00                	push   $0x0
+        ap++;
+     7e7:	83 c7 04             	add    $0x4,%edi
+        printint(f, *ap, 16, 0);
+     7ea:	89 f0                	mov    %esi,%eax
+     7ec:	e8 9f fe ff ff       	call   690 <printint>
+        ap++;
+     7f1:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     7f4:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     7f7:	31 ff                	xor    %edi,%edi
+     7f9:	e9 64 ff ff ff       	jmp    762 <vfprintf+0x32>
+     7fe:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     800:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     803:	8b 10                	mov    (%eax),%edx
+        ap++;
+     805:	83 c0 04             	add    $0x4,%eax
+     808:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     80b:	85 d2                	test   %edx,%edx
+     80d:	0f 84 85 00 00 00    	je     898 <vfprintf+0x168>
+        while(*s != 0){
+     813:	0f be 02             	movsbl (%edx),%eax
+        s = (char*)*ap;
+     816:	89 d7                	mov    %edx,%edi
+        while(*s != 0){
+     818:	84 c0                	test   %al,%al
+     81a:	74 b1                	je     7cd <vfprintf+0x9d>
+     81c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+          putc_unlocked(*s, f);
+     820:	83 ec 08             	sub    $0x8,%esp
+          s++;
+     823:	83 c7 01             	add    $0x1,%edi
+          putc_unlocked(*s, f);
+     826:	56                   	push   %esi
+     827:	50                   	push   %eax
+     828:	e8 a3 06 00 00       	call   ed0 <putc_unlocked>
+        while(*s != 0){
+     82d:	0f be 07             	movsbl (%edi),%eax
+     830:	83 c4 10             	add    $0x10,%esp
+     833:	84 c0                	test   %al,%al
+     835:	75 e9                	jne    820 <vfprintf+0xf0>
+      state = 0;
+     837:	31 ff                	xor    %edi,%edi
+     839:	e9 24 ff ff ff       	jmp    762 <vfprintf+0x32>
+     83e:	66 90                	xchg   %ax,%ax
+        printint(f, *ap, 10, 1);
+     840:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     843:	83 ec 0c             	sub    $0xc,%esp
+     846:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     84b:	8b 17                	mov    (%edi),%edx
+     84d:	6a 01                	push   $0x1
+     84f:	eb 96                	jmp    7e7 <vfprintf+0xb7>
+     851:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc_unlocked(*ap, f);
+     858:	83 ec 08             	sub    $0x8,%esp
+     85b:	56                   	push   %esi
+     85c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     85f:	ff 37                	push   (%edi)
+     861:	e8 6a 06 00 00       	call   ed0 <putc_unlocked>
+        ap++;
+     866:	89 f8                	mov    %edi,%eax
+     868:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     86b:	31 ff                	xor    %edi,%edi
+        ap++;
+     86d:	83 c0 04             	add    $0x4,%eax
+     870:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     873:	e9 ea fe ff ff       	jmp    762 <vfprintf+0x32>
+     878:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     87f:	90                   	nop
+        putc_unlocked(c, f);
+     880:	83 ec 08             	sub    $0x8,%esp
+      state = 0;
+     883:	31 ff                	xor    %edi,%edi
+        putc_unlocked(c, f);
+     885:	56                   	push   %esi
+     886:	6a 25                	push   $0x25
+     888:	e8 43 06 00 00       	call   ed0 <putc_unlocked>
+     88d:	83 c4 10             	add    $0x10,%esp
+     890:	e9 cd fe ff ff       	jmp    762 <vfprintf+0x32>
+     895:	8d 76 00             	lea    0x0(%esi),%esi
+     898:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     89d:	bf 9b 1d 00 00       	mov    $0x1d9b,%edi
+     8a2:	e9 79 ff ff ff       	jmp    820 <vfprintf+0xf0>
+     8a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ae:	66 90                	xchg   %ax,%ax
+
+000008b0 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+     8b0:	55                   	push   %ebp
+     8b1:	89 e5                	mov    %esp,%ebp
+     8b3:	53                   	push   %ebx
+     8b4:	83 ec 10             	sub    $0x10,%esp
+     8b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  flockfile(f);
+     8ba:	53                   	push   %ebx
+     8bb:	e8 d0 02 00 00       	call   b90 <flockfile>
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     8c0:	8b 55 0c             	mov    0xc(%ebp),%edx
+     8c3:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     8c6:	89 d8                	mov    %ebx,%eax
+     8c8:	e8 63 fe ff ff       	call   730 <vfprintf>
+  funlockfile(f);
+     8cd:	89 1c 24             	mov    %ebx,(%esp)
+     8d0:	e8 eb 02 00 00       	call   bc0 <funlockfile>
+}
+     8d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8d8:	83 c4 10             	add    $0x10,%esp
+     8db:	c9                   	leave
+     8dc:	c3                   	ret
+     8dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008e0 <printf>:
+
+// Print to the given fd: through stdout or stderr for 1 and 2,
+// otherwise with one write() per call.
+void
+printf(int fd, const char *fmt, ...)
+{
+     8e0:	55                   	push   %ebp
+     8e1:	89 e5                	mov    %esp,%ebp
+     8e3:	56                   	push   %esi
+     8e4:	53                   	push   %ebx
+     8e5:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+     8eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  char buf[128];
+  struct iobuf f;
+
+  if(fd == 1 || fd == 2){
+    flockfile(&_iob[fd]);
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     8ee:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(fd == 1 || fd == 2){
+     8f1:	8d 50 ff             	lea    -0x1(%eax),%edx
+     8f4:	83 fa 01             	cmp    $0x1,%edx
+     8f7:	76 77                	jbe    970 <printf+0x90>
+    funlockfile(&_iob[fd]);
+    return;
+  }
+  f.fd = fd;
+     8f9:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  f.flags = IO_WRITE|IO_SETUP;
+  f.buf = buf;
+     8ff:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  f.size = sizeof(buf);
+  f.r = f.n = 0;
+  mutex_init(&f.lock);
+     905:	83 ec 0c             	sub    $0xc,%esp
+     908:	8d 9d 5c ff ff ff    	lea    -0xa4(%ebp),%ebx
+  f.buf = buf;
+     90e:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+  mutex_init(&f.lock);
+     914:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  f.flags = IO_WRITE|IO_SETUP;
+     91a:	c7 85 60 ff ff ff 42 	movl   $0x42,-0xa0(%ebp)
+     921:	00 00 00 
+  f.size = sizeof(buf);
+     924:	c7 85 68 ff ff ff 80 	movl   $0x80,-0x98(%ebp)
+     92b:	00 00 00 
+  f.r = f.n = 0;
+     92e:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+     935:	00 00 00 
+     938:	c7 85 6c ff ff ff 00 	movl   $0x0,-0x94(%ebp)
+     93f:	00 00 00 
+  mutex_init(&f.lock);
+     942:	50                   	push   %eax
+     943:	e8 d8 f9 ff ff       	call   320 <mutex_init>
+  vfprintf(&f, fmt, (uint*)(void*)&fmt + 1);
+     948:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     94b:	89 f2                	mov    %esi,%edx
+     94d:	89 d8                	mov    %ebx,%eax
+     94f:	e8 dc fd ff ff       	call   730 <vfprintf>
+  fflush(&f);
+     954:	89 1c 24             	mov    %ebx,(%esp)
+     957:	e8 f4 04 00 00       	call   e50 <fflush>
+     95c:	83 c4 10             	add    $0x10,%esp
+}
+     95f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     962:	5b                   	pop    %ebx
+     963:	5e                   	pop    %esi
+     964:	5d                   	pop    %ebp
+     965:	c3                   	ret
+     966:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     96d:	8d 76 00             	lea    0x0(%esi),%esi
+    flockfile(&_iob[fd]);
+     970:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     973:	83 ec 0c             	sub    $0xc,%esp
+     976:	8d 98 a0 27 00 00    	lea    0x27a0(%eax),%ebx
+     97c:	53                   	push   %ebx
+     97d:	e8 0e 02 00 00       	call   b90 <flockfile>
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     982:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     985:	89 f2                	mov    %esi,%edx
+     987:	89 d8                	mov    %ebx,%eax
+     989:	e8 a2 fd ff ff       	call   730 <vfprintf>
+    funlockfile(&_iob[fd]);
+     98e:	89 1c 24             	mov    %ebx,(%esp)
+     991:	e8 2a 02 00 00       	call   bc0 <funlockfile>
+     996:	83 c4 10             	add    $0x10,%esp
+}
+     999:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     99c:	5b                   	pop    %ebx
+     99d:	5e                   	pop    %esi
+     99e:	5d                   	pop    %ebp
+     99f:	c3                   	ret
+
+000009a0 <setup>:
+}
+
+// Choose how to buffer f on first use: by lines on a device.
+static void
+setup(FILE *f)
+{
+     9a0:	55                   	push   %ebp
+     9a1:	89 e5                	mov    %esp,%ebp
+     9a3:	53                   	push   %ebx
+     9a4:	89 c3                	mov    %eax,%ebx
+     9a6:	83 ec 2c             	sub    $0x2c,%esp
+  struct stat st;
+
+  f->flags |= IO_SETUP;
+     9a9:	83 48 04 40          	orl    $0x40,0x4(%eax)
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     9ad:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     9b0:	50                   	push   %eax
+     9b1:	ff 33                	push   (%ebx)
+     9b3:	e8 52 fb ff ff       	call   50a <fstat>
+     9b8:	83 c4 10             	add    $0x10,%esp
+     9bb:	85 c0                	test   %eax,%eax
+    f->flags |= IO_DEV|IO_LINE;
+     9bd:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     9c0:	75 07                	jne    9c9 <setup+0x29>
+     9c2:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+     9c7:	74 17                	je     9e0 <setup+0x40>
+  if(f->flags & IO_WRITE)
+     9c9:	a8 02                	test   $0x2,%al
+     9cb:	74 0a                	je     9d7 <setup+0x37>
+    flushhook = flushall;
+     9cd:	c7 05 80 28 00 00 00 	movl   $0xb00,0x2880
+     9d4:	0b 00 00 
+}
+     9d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9da:	c9                   	leave
+     9db:	c3                   	ret
+     9dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    f->flags |= IO_DEV|IO_LINE;
+     9e0:	83 c8 30             	or     $0x30,%eax
+     9e3:	89 43 04             	mov    %eax,0x4(%ebx)
+     9e6:	eb e1                	jmp    9c9 <setup+0x29>
+     9e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9ef:	90                   	nop
+
+000009f0 <flush>:
+static int
+flush(FILE *f)
+{
+  int i, n;
+
+  if(!(f->flags & IO_WRITE))
+     9f0:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+     9f4:	74 6a                	je     a60 <flush+0x70>
+{
+     9f6:	55                   	push   %ebp
+     9f7:	89 e5                	mov    %esp,%ebp
+     9f9:	56                   	push   %esi
+     9fa:	89 c6                	mov    %eax,%esi
+     9fc:	53                   	push   %ebx
+    return 0;
+  for(i = 0; i < f->n; i += n){
+     9fd:	8b 40 14             	mov    0x14(%eax),%eax
+     a00:	85 c0                	test   %eax,%eax
+     a02:	7e 4c                	jle    a50 <flush+0x60>
+     a04:	31 db                	xor    %ebx,%ebx
+     a06:	eb 11                	jmp    a19 <flush+0x29>
+     a08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a0f:	90                   	nop
+     a10:	01 c3                	add    %eax,%ebx
+     a12:	8b 46 14             	mov    0x14(%esi),%eax
+     a15:	39 d8                	cmp    %ebx,%eax
+     a17:	7e 37                	jle    a50 <flush+0x60>
+    if((n = write(f->fd, f->buf + i, f->n - i)) <= 0){
+     a19:	83 ec 04             	sub    $0x4,%esp
+     a1c:	29 d8                	sub    %ebx,%eax
+     a1e:	50                   	push   %eax
+     a1f:	8b 46 08             	mov    0x8(%esi),%eax
+     a22:	01 d8                	add    %ebx,%eax
+     a24:	50                   	push   %eax
+     a25:	ff 36                	push   (%esi)
+     a27:	e8 75 fa ff ff       	call   4a1 <write>
+     a2c:	83 c4 10             	add    $0x10,%esp
+     a2f:	85 c0                	test   %eax,%eax
+     a31:	7f dd                	jg     a10 <flush+0x20>
+      f->flags |= IO_ERR;
+     a33:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+      f->n = 0;
+     a37:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     a3c:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+      return EOF;
+    }
+  }
+  f->n = 0;
+  return 0;
+}
+     a43:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     a46:	5b                   	pop    %ebx
+     a47:	5e                   	pop    %esi
+     a48:	5d                   	pop    %ebp
+     a49:	c3                   	ret
+     a4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->n = 0;
+     a50:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+}
+     a57:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+     a5a:	31 c0                	xor    %eax,%eax
+}
+     a5c:	5b                   	pop    %ebx
+     a5d:	5e                   	pop    %esi
+     a5e:	5d                   	pop    %ebp
+     a5f:	c3                   	ret
+    return 0;
+     a60:	31 c0                	xor    %eax,%eax
+}
+     a62:	c3                   	ret
+     a63:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a70 <fflush.part.0>:
+fflush(FILE *f)
+     a70:	55                   	push   %ebp
+     a71:	89 e5                	mov    %esp,%ebp
+     a73:	57                   	push   %edi
+     a74:	bf 98 28 00 00       	mov    $0x2898,%edi
+     a79:	56                   	push   %esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     a7a:	31 f6                	xor    %esi,%esi
+fflush(FILE *f)
+     a7c:	53                   	push   %ebx
+     a7d:	bb b8 27 00 00       	mov    $0x27b8,%ebx
+     a82:	83 ec 1c             	sub    $0x1c,%esp
+     a85:	eb 10                	jmp    a97 <fflush.part.0+0x27>
+     a87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a8e:	66 90                	xchg   %ax,%ax
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     a90:	83 c3 1c             	add    $0x1c,%ebx
+     a93:	39 df                	cmp    %ebx,%edi
+     a95:	74 33                	je     aca <fflush.part.0+0x5a>
+      if((f->flags & IO_WRITE) && fflush(f) < 0)
+     a97:	f6 43 ec 02          	testb  $0x2,-0x14(%ebx)
+     a9b:	74 f3                	je     a90 <fflush.part.0+0x20>
+  if(threaded)
+     a9d:	8b 0d a0 28 00 00    	mov    0x28a0,%ecx
+     aa3:	85 c9                	test   %ecx,%ecx
+     aa5:	75 49                	jne    af0 <fflush.part.0+0x80>
+  r = flush(f);
+     aa7:	8d 43 e8             	lea    -0x18(%ebx),%eax
+     aaa:	e8 41 ff ff ff       	call   9f0 <flush>
+  if(threaded)
+     aaf:	8b 15 a0 28 00 00    	mov    0x28a0,%edx
+     ab5:	85 d2                	test   %edx,%edx
+     ab7:	75 1f                	jne    ad8 <fflush.part.0+0x68>
+        r = EOF;
+     ab9:	85 c0                	test   %eax,%eax
+     abb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     ac0:	0f 48 f0             	cmovs  %eax,%esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     ac3:	83 c3 1c             	add    $0x1c,%ebx
+     ac6:	39 df                	cmp    %ebx,%edi
+     ac8:	75 cd                	jne    a97 <fflush.part.0+0x27>
+}
+     aca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     acd:	89 f0                	mov    %esi,%eax
+     acf:	5b                   	pop    %ebx
+     ad0:	5e                   	pop    %esi
+     ad1:	5f                   	pop    %edi
+     ad2:	5d                   	pop    %ebp
+     ad3:	c3                   	ret
+     ad4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     ad8:	83 ec 0c             	sub    $0xc,%esp
+     adb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     ade:	53                   	push   %ebx
+     adf:	e8 9c f8 ff ff       	call   380 <mutex_unlock>
+     ae4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     ae7:	83 c4 10             	add    $0x10,%esp
+     aea:	eb cd                	jmp    ab9 <fflush.part.0+0x49>
+     aec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     af0:	83 ec 0c             	sub    $0xc,%esp
+     af3:	53                   	push   %ebx
+     af4:	e8 37 f8 ff ff       	call   330 <mutex_lock>
+     af9:	83 c4 10             	add    $0x10,%esp
+     afc:	eb a9                	jmp    aa7 <fflush.part.0+0x37>
+     afe:	66 90                	xchg   %ax,%ax
+
+00000b00 <flushall>:
+  if(f == 0){
+     b00:	e9 6b ff ff ff       	jmp    a70 <fflush.part.0>
+     b05:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b10 <fill>:
+
+// Refill f's buffer. Returns the number of bytes read.
+// Caller holds f's lock.
+static int
+fill(FILE *f)
+{
+     b10:	55                   	push   %ebp
+     b11:	89 e5                	mov    %esp,%ebp
+     b13:	53                   	push   %ebx
+     b14:	89 c3                	mov    %eax,%ebx
+     b16:	83 ec 04             	sub    $0x4,%esp
+  int n;
+
+  if(!(f->flags & IO_SETUP))
+     b19:	8b 40 04             	mov    0x4(%eax),%eax
+     b1c:	a8 40                	test   $0x40,%al
+     b1e:	74 50                	je     b70 <fill+0x60>
+    setup(f);
+  if(f->flags & IO_DEV)
+     b20:	a8 20                	test   $0x20,%al
+     b22:	75 3c                	jne    b60 <fill+0x50>
+    fflush(0);
+  f->r = 0;
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     b24:	83 ec 04             	sub    $0x4,%esp
+  f->r = 0;
+     b27:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     b2e:	ff 73 0c             	push   0xc(%ebx)
+     b31:	ff 73 08             	push   0x8(%ebx)
+     b34:	ff 33                	push   (%ebx)
+     b36:	e8 57 f9 ff ff       	call   492 <read>
+     b3b:	83 c4 10             	add    $0x10,%esp
+     b3e:	85 c0                	test   %eax,%eax
+     b40:	7f 10                	jg     b52 <fill+0x42>
+    f->flags |= n < 0 ? IO_ERR : IO_EOF;
+     b42:	83 f8 01             	cmp    $0x1,%eax
+     b45:	19 c0                	sbb    %eax,%eax
+     b47:	83 e0 fc             	and    $0xfffffffc,%eax
+     b4a:	83 c0 08             	add    $0x8,%eax
+     b4d:	09 43 04             	or     %eax,0x4(%ebx)
+    n = 0;
+     b50:	31 c0                	xor    %eax,%eax
+  }
+  f->n = n;
+     b52:	89 43 14             	mov    %eax,0x14(%ebx)
+  return n;
+}
+     b55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b58:	c9                   	leave
+     b59:	c3                   	ret
+     b5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == 0){
+     b60:	e8 0b ff ff ff       	call   a70 <fflush.part.0>
+     b65:	eb bd                	jmp    b24 <fill+0x14>
+     b67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b6e:	66 90                	xchg   %ax,%ax
+    setup(f);
+     b70:	89 d8                	mov    %ebx,%eax
+     b72:	e8 29 fe ff ff       	call   9a0 <setup>
+  if(f->flags & IO_DEV)
+     b77:	8b 43 04             	mov    0x4(%ebx),%eax
+     b7a:	eb a4                	jmp    b20 <fill+0x10>
+     b7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b80 <stdio_threaded>:
+  threaded = 1;
+     b80:	c7 05 a0 28 00 00 01 	movl   $0x1,0x28a0
+     b87:	00 00 00 
+}
+     b8a:	c3                   	ret
+     b8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b8f:	90                   	nop
+
+00000b90 <flockfile>:
+{
+     b90:	55                   	push   %ebp
+  if(threaded)
+     b91:	8b 15 a0 28 00 00    	mov    0x28a0,%edx
+{
+     b97:	89 e5                	mov    %esp,%ebp
+     b99:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     b9c:	85 d2                	test   %edx,%edx
+     b9e:	75 08                	jne    ba8 <flockfile+0x18>
+}
+     ba0:	5d                   	pop    %ebp
+     ba1:	c3                   	ret
+     ba2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_lock(&f->lock);
+     ba8:	83 c0 18             	add    $0x18,%eax
+     bab:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     bae:	5d                   	pop    %ebp
+    mutex_lock(&f->lock);
+     baf:	e9 7c f7 ff ff       	jmp    330 <mutex_lock>
+     bb4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bbf:	90                   	nop
+
+00000bc0 <funlockfile>:
+{
+     bc0:	55                   	push   %ebp
+  if(threaded)
+     bc1:	8b 15 a0 28 00 00    	mov    0x28a0,%edx
+{
+     bc7:	89 e5                	mov    %esp,%ebp
+     bc9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     bcc:	85 d2                	test   %edx,%edx
+     bce:	75 08                	jne    bd8 <funlockfile+0x18>
+}
+     bd0:	5d                   	pop    %ebp
+     bd1:	c3                   	ret
+     bd2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&f->lock);
+     bd8:	83 c0 18             	add    $0x18,%eax
+     bdb:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     bde:	5d                   	pop    %ebp
+    mutex_unlock(&f->lock);
+     bdf:	e9 9c f7 ff ff       	jmp    380 <mutex_unlock>
+     be4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     beb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bef:	90                   	nop
+
+00000bf0 <fopen>:
+{
+     bf0:	55                   	push   %ebp
+     bf1:	89 e5                	mov    %esp,%ebp
+     bf3:	57                   	push   %edi
+     bf4:	56                   	push   %esi
+     bf5:	53                   	push   %ebx
+     bf6:	83 ec 34             	sub    $0x34,%esp
+     bf9:	8b 75 0c             	mov    0xc(%ebp),%esi
+     bfc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(strcmp(mode, "r") != 0 && strcmp(mode, "w") != 0)
+     bff:	68 0d 1e 00 00       	push   $0x1e0d
+     c04:	56                   	push   %esi
+     c05:	e8 66 f5 ff ff       	call   170 <strcmp>
+     c0a:	83 c4 10             	add    $0x10,%esp
+     c0d:	85 c0                	test   %eax,%eax
+     c0f:	74 15                	je     c26 <fopen+0x36>
+     c11:	83 ec 08             	sub    $0x8,%esp
+     c14:	68 0f 1e 00 00       	push   $0x1e0f
+     c19:	56                   	push   %esi
+     c1a:	e8 51 f5 ff ff       	call   170 <strcmp>
+     c1f:	83 c4 10             	add    $0x10,%esp
+     c22:	85 c0                	test   %eax,%eax
+     c24:	75 2c                	jne    c52 <fopen+0x62>
+  if(threaded)
+     c26:	a1 a0 28 00 00       	mov    0x28a0,%eax
+     c2b:	85 c0                	test   %eax,%eax
+     c2d:	0f 85 ed 00 00 00    	jne    d20 <fopen+0x130>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     c33:	bb f4 27 00 00       	mov    $0x27f4,%ebx
+    if(f->flags == 0)
+     c38:	8b 53 04             	mov    0x4(%ebx),%edx
+     c3b:	85 d2                	test   %edx,%edx
+     c3d:	74 21                	je     c60 <fopen+0x70>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     c3f:	83 c3 1c             	add    $0x1c,%ebx
+     c42:	81 fb 80 28 00 00    	cmp    $0x2880,%ebx
+     c48:	75 ee                	jne    c38 <fopen+0x48>
+  if(threaded)
+     c4a:	85 c0                	test   %eax,%eax
+     c4c:	0f 85 36 01 00 00    	jne    d88 <fopen+0x198>
+    return 0;
+     c52:	31 db                	xor    %ebx,%ebx
+     c54:	e9 96 00 00 00       	jmp    cef <fopen+0xff>
+     c59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f == &_iob[NSTREAM])
+     c60:	81 fb 80 28 00 00    	cmp    $0x2880,%ebx
+     c66:	74 e2                	je     c4a <fopen+0x5a>
+    f->flags = IO_MALLOC;
+     c68:	c7 43 04 80 00 00 00 	movl   $0x80,0x4(%ebx)
+  if(threaded)
+     c6f:	85 c0                	test   %eax,%eax
+     c71:	0f 85 f9 00 00 00    	jne    d70 <fopen+0x180>
+  if(mode[0] == 'r'){
+     c77:	80 3e 72             	cmpb   $0x72,(%esi)
+     c7a:	0f 84 c0 00 00 00    	je     d40 <fopen+0x150>
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     c80:	83 ec 08             	sub    $0x8,%esp
+     c83:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     c86:	50                   	push   %eax
+     c87:	57                   	push   %edi
+     c88:	e8 d3 f5 ff ff       	call   260 <stat>
+     c8d:	83 c4 10             	add    $0x10,%esp
+     c90:	85 c0                	test   %eax,%eax
+     c92:	74 6c                	je     d00 <fopen+0x110>
+    fd = open(path, O_CREATE|O_WRONLY);
+     c94:	83 ec 08             	sub    $0x8,%esp
+     c97:	68 01 02 00 00       	push   $0x201
+     c9c:	57                   	push   %edi
+    flags = IO_WRITE;
+     c9d:	bf 02 00 00 00       	mov    $0x2,%edi
+    fd = open(path, O_CREATE|O_WRONLY);
+     ca2:	e8 36 f8 ff ff       	call   4dd <open>
+     ca7:	83 c4 10             	add    $0x10,%esp
+     caa:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     cac:	85 f6                	test   %esi,%esi
+     cae:	0f 88 a9 00 00 00    	js     d5d <fopen+0x16d>
+     cb4:	83 ec 0c             	sub    $0xc,%esp
+     cb7:	68 00 02 00 00       	push   $0x200
+     cbc:	e8 af 0c 00 00       	call   1970 <malloc>
+     cc1:	83 c4 10             	add    $0x10,%esp
+     cc4:	89 43 08             	mov    %eax,0x8(%ebx)
+     cc7:	85 c0                	test   %eax,%eax
+     cc9:	0f 84 d0 00 00 00    	je     d9f <fopen+0x1af>
+  f->flags = flags|IO_MALLOC;
+     ccf:	81 cf 80 00 00 00    	or     $0x80,%edi
+  f->fd = fd;
+     cd5:	89 33                	mov    %esi,(%ebx)
+  f->size = BUFSIZ;
+     cd7:	c7 43 0c 00 02 00 00 	movl   $0x200,0xc(%ebx)
+  f->r = f->n = 0;
+     cde:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+     ce5:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  f->flags = flags|IO_MALLOC;
+     cec:	89 7b 04             	mov    %edi,0x4(%ebx)
+}
+     cef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cf2:	89 d8                	mov    %ebx,%eax
+     cf4:	5b                   	pop    %ebx
+     cf5:	5e                   	pop    %esi
+     cf6:	5f                   	pop    %edi
+     cf7:	5d                   	pop    %ebp
+     cf8:	c3                   	ret
+     cf9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     d00:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+     d05:	75 8d                	jne    c94 <fopen+0xa4>
+      unlink(path);
+     d07:	83 ec 0c             	sub    $0xc,%esp
+     d0a:	57                   	push   %edi
+     d0b:	e8 eb f7 ff ff       	call   4fb <unlink>
+     d10:	83 c4 10             	add    $0x10,%esp
+     d13:	e9 7c ff ff ff       	jmp    c94 <fopen+0xa4>
+     d18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d1f:	90                   	nop
+    mutex_lock(&iolock);
+     d20:	83 ec 0c             	sub    $0xc,%esp
+     d23:	68 a4 28 00 00       	push   $0x28a4
+     d28:	e8 03 f6 ff ff       	call   330 <mutex_lock>
+  if(threaded)
+     d2d:	a1 a0 28 00 00       	mov    0x28a0,%eax
+     d32:	83 c4 10             	add    $0x10,%esp
+     d35:	e9 f9 fe ff ff       	jmp    c33 <fopen+0x43>
+     d3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    fd = open(path, O_RDONLY);
+     d40:	83 ec 08             	sub    $0x8,%esp
+     d43:	6a 00                	push   $0x0
+     d45:	57                   	push   %edi
+    flags = IO_READ;
+     d46:	bf 01 00 00 00       	mov    $0x1,%edi
+    fd = open(path, O_RDONLY);
+     d4b:	e8 8d f7 ff ff       	call   4dd <open>
+     d50:	83 c4 10             	add    $0x10,%esp
+     d53:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     d55:	85 f6                	test   %esi,%esi
+     d57:	0f 89 57 ff ff ff    	jns    cb4 <fopen+0xc4>
+    f->flags = 0;
+     d5d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    return 0;
+     d64:	31 db                	xor    %ebx,%ebx
+     d66:	eb 87                	jmp    cef <fopen+0xff>
+     d68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d6f:	90                   	nop
+    mutex_unlock(&iolock);
+     d70:	83 ec 0c             	sub    $0xc,%esp
+     d73:	68 a4 28 00 00       	push   $0x28a4
+     d78:	e8 03 f6 ff ff       	call   380 <mutex_unlock>
+     d7d:	83 c4 10             	add    $0x10,%esp
+     d80:	e9 f2 fe ff ff       	jmp    c77 <fopen+0x87>
+     d85:	8d 76 00             	lea    0x0(%esi),%esi
+     d88:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+     d8b:	31 db                	xor    %ebx,%ebx
+    mutex_unlock(&iolock);
+     d8d:	68 a4 28 00 00       	push   $0x28a4
+     d92:	e8 e9 f5 ff ff       	call   380 <mutex_unlock>
+     d97:	83 c4 10             	add    $0x10,%esp
+     d9a:	e9 50 ff ff ff       	jmp    cef <fopen+0xff>
+      close(fd);
+     d9f:	83 ec 0c             	sub    $0xc,%esp
+     da2:	56                   	push   %esi
+     da3:	e8 08 f7 ff ff       	call   4b0 <close>
+     da8:	83 c4 10             	add    $0x10,%esp
+     dab:	eb b0                	jmp    d5d <fopen+0x16d>
+     dad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000db0 <fclose>:
+{
+     db0:	55                   	push   %ebp
+     db1:	89 e5                	mov    %esp,%ebp
+     db3:	56                   	push   %esi
+     db4:	53                   	push   %ebx
+  if(threaded)
+     db5:	8b 15 a0 28 00 00    	mov    0x28a0,%edx
+{
+     dbb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+     dbe:	85 d2                	test   %edx,%edx
+     dc0:	75 46                	jne    e08 <fclose+0x58>
+  r = flush(f);
+     dc2:	89 d8                	mov    %ebx,%eax
+     dc4:	e8 27 fc ff ff       	call   9f0 <flush>
+  if(close(f->fd) < 0)
+     dc9:	83 ec 0c             	sub    $0xc,%esp
+     dcc:	ff 33                	push   (%ebx)
+  r = flush(f);
+     dce:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+     dd0:	e8 db f6 ff ff       	call   4b0 <close>
+     dd5:	83 c4 10             	add    $0x10,%esp
+    r = EOF;
+     dd8:	85 c0                	test   %eax,%eax
+     dda:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     ddf:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->flags & IO_MALLOC)
+     de2:	f6 43 04 80          	testb  $0x80,0x4(%ebx)
+     de6:	75 58                	jne    e40 <fclose+0x90>
+  if(threaded)
+     de8:	a1 a0 28 00 00       	mov    0x28a0,%eax
+  f->flags = 0;
+     ded:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  if(threaded)
+     df4:	85 c0                	test   %eax,%eax
+     df6:	75 28                	jne    e20 <fclose+0x70>
+}
+     df8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     dfb:	89 f0                	mov    %esi,%eax
+     dfd:	5b                   	pop    %ebx
+     dfe:	5e                   	pop    %esi
+     dff:	5d                   	pop    %ebp
+     e00:	c3                   	ret
+     e01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     e08:	83 ec 0c             	sub    $0xc,%esp
+     e0b:	8d 43 18             	lea    0x18(%ebx),%eax
+     e0e:	50                   	push   %eax
+     e0f:	e8 1c f5 ff ff       	call   330 <mutex_lock>
+     e14:	83 c4 10             	add    $0x10,%esp
+     e17:	eb a9                	jmp    dc2 <fclose+0x12>
+     e19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     e20:	83 ec 0c             	sub    $0xc,%esp
+     e23:	83 c3 18             	add    $0x18,%ebx
+     e26:	53                   	push   %ebx
+     e27:	e8 54 f5 ff ff       	call   380 <mutex_unlock>
+     e2c:	83 c4 10             	add    $0x10,%esp
+}
+     e2f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e32:	89 f0                	mov    %esi,%eax
+     e34:	5b                   	pop    %ebx
+     e35:	5e                   	pop    %esi
+     e36:	5d                   	pop    %ebp
+     e37:	c3                   	ret
+     e38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e3f:	90                   	nop
+    free(f->buf);
+     e40:	83 ec 0c             	sub    $0xc,%esp
+     e43:	ff 73 08             	push   0x8(%ebx)
+     e46:	e8 f5 09 00 00       	call   1840 <free>
+     e4b:	83 c4 10             	add    $0x10,%esp
+     e4e:	eb 98                	jmp    de8 <fclose+0x38>
+
+00000e50 <fflush>:
+{
+     e50:	55                   	push   %ebp
+     e51:	89 e5                	mov    %esp,%ebp
+     e53:	53                   	push   %ebx
+     e54:	83 ec 14             	sub    $0x14,%esp
+     e57:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f == 0){
+     e5a:	85 db                	test   %ebx,%ebx
+     e5c:	74 5a                	je     eb8 <fflush+0x68>
+  if(threaded)
+     e5e:	8b 0d a0 28 00 00    	mov    0x28a0,%ecx
+     e64:	85 c9                	test   %ecx,%ecx
+     e66:	75 18                	jne    e80 <fflush+0x30>
+  r = flush(f);
+     e68:	89 d8                	mov    %ebx,%eax
+     e6a:	e8 81 fb ff ff       	call   9f0 <flush>
+  if(threaded)
+     e6f:	8b 15 a0 28 00 00    	mov    0x28a0,%edx
+     e75:	85 d2                	test   %edx,%edx
+     e77:	75 1f                	jne    e98 <fflush+0x48>
+}
+     e79:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e7c:	c9                   	leave
+     e7d:	c3                   	ret
+     e7e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+     e80:	83 ec 0c             	sub    $0xc,%esp
+     e83:	8d 43 18             	lea    0x18(%ebx),%eax
+     e86:	50                   	push   %eax
+     e87:	e8 a4 f4 ff ff       	call   330 <mutex_lock>
+     e8c:	83 c4 10             	add    $0x10,%esp
+     e8f:	eb d7                	jmp    e68 <fflush+0x18>
+     e91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     e98:	83 ec 0c             	sub    $0xc,%esp
+     e9b:	83 c3 18             	add    $0x18,%ebx
+     e9e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     ea1:	53                   	push   %ebx
+     ea2:	e8 d9 f4 ff ff       	call   380 <mutex_unlock>
+     ea7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     eaa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    mutex_unlock(&f->lock);
+     ead:	83 c4 10             	add    $0x10,%esp
+}
+     eb0:	c9                   	leave
+     eb1:	c3                   	ret
+     eb2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     eb8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ebb:	c9                   	leave
+     ebc:	e9 af fb ff ff       	jmp    a70 <fflush.part.0>
+     ec1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ec8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ecf:	90                   	nop
+
+00000ed0 <putc_unlocked>:
+{
+     ed0:	55                   	push   %ebp
+     ed1:	89 e5                	mov    %esp,%ebp
+     ed3:	56                   	push   %esi
+     ed4:	53                   	push   %ebx
+     ed5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     ed8:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(!(f->flags & IO_WRITE))
+     edb:	8b 43 04             	mov    0x4(%ebx),%eax
+     ede:	a8 02                	test   $0x2,%al
+     ee0:	74 46                	je     f28 <putc_unlocked+0x58>
+  if(!(f->flags & IO_SETUP))
+     ee2:	a8 40                	test   $0x40,%al
+     ee4:	74 4a                	je     f30 <putc_unlocked+0x60>
+  if(f->n == f->size && flush(f) < 0)
+     ee6:	8b 43 14             	mov    0x14(%ebx),%eax
+     ee9:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     eec:	74 51                	je     f3f <putc_unlocked+0x6f>
+  f->buf[f->n++] = c;
+     eee:	8d 48 01             	lea    0x1(%eax),%ecx
+     ef1:	8b 53 08             	mov    0x8(%ebx),%edx
+     ef4:	89 4b 14             	mov    %ecx,0x14(%ebx)
+     ef7:	89 f1                	mov    %esi,%ecx
+     ef9:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     efc:	83 fe 0a             	cmp    $0xa,%esi
+     eff:	74 0f                	je     f10 <putc_unlocked+0x40>
+  return c & 0xff;
+     f01:	89 f0                	mov    %esi,%eax
+     f03:	0f b6 c0             	movzbl %al,%eax
+}
+     f06:	5b                   	pop    %ebx
+     f07:	5e                   	pop    %esi
+     f08:	5d                   	pop    %ebp
+     f09:	c3                   	ret
+     f0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     f10:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+     f14:	74 eb                	je     f01 <putc_unlocked+0x31>
+     f16:	89 d8                	mov    %ebx,%eax
+     f18:	e8 d3 fa ff ff       	call   9f0 <flush>
+     f1d:	85 c0                	test   %eax,%eax
+     f1f:	79 e0                	jns    f01 <putc_unlocked+0x31>
+     f21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return EOF;
+     f28:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     f2d:	eb d7                	jmp    f06 <putc_unlocked+0x36>
+     f2f:	90                   	nop
+    setup(f);
+     f30:	89 d8                	mov    %ebx,%eax
+     f32:	e8 69 fa ff ff       	call   9a0 <setup>
+  if(f->n == f->size && flush(f) < 0)
+     f37:	8b 43 14             	mov    0x14(%ebx),%eax
+     f3a:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     f3d:	75 af                	jne    eee <putc_unlocked+0x1e>
+     f3f:	89 d8                	mov    %ebx,%eax
+     f41:	e8 aa fa ff ff       	call   9f0 <flush>
+     f46:	85 c0                	test   %eax,%eax
+     f48:	78 de                	js     f28 <putc_unlocked+0x58>
+  f->buf[f->n++] = c;
+     f4a:	8b 43 14             	mov    0x14(%ebx),%eax
+     f4d:	eb 9f                	jmp    eee <putc_unlocked+0x1e>
+     f4f:	90                   	nop
+
+00000f50 <fputc>:
+{
+     f50:	55                   	push   %ebp
+     f51:	89 e5                	mov    %esp,%ebp
+     f53:	56                   	push   %esi
+     f54:	53                   	push   %ebx
+  if(threaded)
+     f55:	8b 15 a0 28 00 00    	mov    0x28a0,%edx
+{
+     f5b:	8b 75 08             	mov    0x8(%ebp),%esi
+     f5e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(threaded)
+     f61:	85 d2                	test   %edx,%edx
+     f63:	75 6b                	jne    fd0 <fputc+0x80>
+  if(!(f->flags & IO_WRITE))
+     f65:	8b 43 04             	mov    0x4(%ebx),%eax
+     f68:	a8 02                	test   $0x2,%al
+     f6a:	0f 84 b8 00 00 00    	je     1028 <fputc+0xd8>
+  if(!(f->flags & IO_SETUP))
+     f70:	a8 40                	test   $0x40,%al
+     f72:	74 76                	je     fea <fputc+0x9a>
+  if(f->n == f->size && flush(f) < 0)
+     f74:	8b 43 14             	mov    0x14(%ebx),%eax
+     f77:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     f7a:	74 7d                	je     ff9 <fputc+0xa9>
+  f->buf[f->n++] = c;
+     f7c:	8d 48 01             	lea    0x1(%eax),%ecx
+     f7f:	8b 53 08             	mov    0x8(%ebx),%edx
+     f82:	89 4b 14             	mov    %ecx,0x14(%ebx)
+     f85:	89 f1                	mov    %esi,%ecx
+     f87:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     f8a:	83 fe 0a             	cmp    $0xa,%esi
+     f8d:	74 21                	je     fb0 <fputc+0x60>
+  return c & 0xff;
+     f8f:	89 f0                	mov    %esi,%eax
+     f91:	0f b6 f0             	movzbl %al,%esi
+  if(threaded)
+     f94:	a1 a0 28 00 00       	mov    0x28a0,%eax
+     f99:	85 c0                	test   %eax,%eax
+     f9b:	75 73                	jne    1010 <fputc+0xc0>
+}
+     f9d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     fa0:	89 f0                	mov    %esi,%eax
+     fa2:	5b                   	pop    %ebx
+     fa3:	5e                   	pop    %esi
+     fa4:	5d                   	pop    %ebp
+     fa5:	c3                   	ret
+     fa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fad:	8d 76 00             	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     fb0:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+     fb4:	74 d9                	je     f8f <fputc+0x3f>
+     fb6:	89 d8                	mov    %ebx,%eax
+     fb8:	e8 33 fa ff ff       	call   9f0 <flush>
+     fbd:	85 c0                	test   %eax,%eax
+     fbf:	79 ce                	jns    f8f <fputc+0x3f>
+    return EOF;
+     fc1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     fc6:	eb cc                	jmp    f94 <fputc+0x44>
+     fc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fcf:	90                   	nop
+    mutex_lock(&f->lock);
+     fd0:	83 ec 0c             	sub    $0xc,%esp
+     fd3:	8d 43 18             	lea    0x18(%ebx),%eax
+     fd6:	50                   	push   %eax
+     fd7:	e8 54 f3 ff ff       	call   330 <mutex_lock>
+  if(!(f->flags & IO_WRITE))
+     fdc:	8b 43 04             	mov    0x4(%ebx),%eax
+     fdf:	83 c4 10             	add    $0x10,%esp
+     fe2:	a8 02                	test   $0x2,%al
+     fe4:	74 db                	je     fc1 <fputc+0x71>
+  if(!(f->flags & IO_SETUP))
+     fe6:	a8 40                	test   $0x40,%al
+     fe8:	75 8a                	jne    f74 <fputc+0x24>
+    setup(f);
+     fea:	89 d8                	mov    %ebx,%eax
+     fec:	e8 af f9 ff ff       	call   9a0 <setup>
+  if(f->n == f->size && flush(f) < 0)
+     ff1:	8b 43 14             	mov    0x14(%ebx),%eax
+     ff4:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     ff7:	75 83                	jne    f7c <fputc+0x2c>
+     ff9:	89 d8                	mov    %ebx,%eax
+     ffb:	e8 f0 f9 ff ff       	call   9f0 <flush>
+    1000:	85 c0                	test   %eax,%eax
+    1002:	78 bd                	js     fc1 <fputc+0x71>
+  f->buf[f->n++] = c;
+    1004:	8b 43 14             	mov    0x14(%ebx),%eax
+    1007:	e9 70 ff ff ff       	jmp    f7c <fputc+0x2c>
+    100c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1010:	83 ec 0c             	sub    $0xc,%esp
+    1013:	83 c3 18             	add    $0x18,%ebx
+    1016:	53                   	push   %ebx
+    1017:	e8 64 f3 ff ff       	call   380 <mutex_unlock>
+    101c:	83 c4 10             	add    $0x10,%esp
+}
+    101f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1022:	89 f0                	mov    %esi,%eax
+    1024:	5b                   	pop    %ebx
+    1025:	5e                   	pop    %esi
+    1026:	5d                   	pop    %ebp
+    1027:	c3                   	ret
+    return EOF;
+    1028:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    102d:	e9 6b ff ff ff       	jmp    f9d <fputc+0x4d>
+    1032:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1039:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001040 <fwrite>:
+{
+    1040:	55                   	push   %ebp
+    1041:	89 e5                	mov    %esp,%ebp
+    1043:	57                   	push   %edi
+    1044:	56                   	push   %esi
+    1045:	53                   	push   %ebx
+    1046:	83 ec 1c             	sub    $0x1c,%esp
+    1049:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  if(!(f->flags & IO_WRITE) || size <= 0)
+    104c:	8b 43 04             	mov    0x4(%ebx),%eax
+    104f:	a8 02                	test   $0x2,%al
+    1051:	0f 84 ec 00 00 00    	je     1143 <fwrite+0x103>
+    1057:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    105a:	85 c9                	test   %ecx,%ecx
+    105c:	0f 8e e1 00 00 00    	jle    1143 <fwrite+0x103>
+  if(threaded)
+    1062:	8b 15 a0 28 00 00    	mov    0x28a0,%edx
+    1068:	85 d2                	test   %edx,%edx
+    106a:	0f 85 1c 01 00 00    	jne    118c <fwrite+0x14c>
+  if(!(f->flags & IO_SETUP))
+    1070:	a8 40                	test   $0x40,%al
+    1072:	0f 84 08 01 00 00    	je     1180 <fwrite+0x140>
+  for(len = size*nmemb; len > 0; len -= n){
+    1078:	8b 45 0c             	mov    0xc(%ebp),%eax
+    107b:	0f af 45 10          	imul   0x10(%ebp),%eax
+    107f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    1082:	85 c0                	test   %eax,%eax
+    1084:	0f 8e 2a 01 00 00    	jle    11b4 <fwrite+0x174>
+  s = p;
+    108a:	8b 45 08             	mov    0x8(%ebp),%eax
+  nl = 0;
+    108d:	31 ff                	xor    %edi,%edi
+    108f:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+        nl = 1;
+    1092:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  s = p;
+    1095:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1098:	8b 43 14             	mov    0x14(%ebx),%eax
+        nl = 1;
+    109b:	89 ce                	mov    %ecx,%esi
+    if(f->n == f->size && flush(f) < 0)
+    109d:	89 c2                	mov    %eax,%edx
+    109f:	39 f0                	cmp    %esi,%eax
+    10a1:	74 6e                	je     1111 <fwrite+0xd1>
+    10a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10a7:	90                   	nop
+    if(n > len)
+    10a8:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    n = f->size - f->n;
+    10ab:	89 f1                	mov    %esi,%ecx
+    10ad:	29 c1                	sub    %eax,%ecx
+    10af:	39 f9                	cmp    %edi,%ecx
+    10b1:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    10b4:	85 c9                	test   %ecx,%ecx
+    10b6:	0f 8e 7c 00 00 00    	jle    1138 <fwrite+0xf8>
+    10bc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    10bf:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    10c2:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    10c5:	8d 34 08             	lea    (%eax,%ecx,1),%esi
+    10c8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    10cb:	eb 06                	jmp    10d3 <fwrite+0x93>
+    10cd:	8d 76 00             	lea    0x0(%esi),%esi
+      if((f->buf[f->n++] = s[i]) == '\n')
+    10d0:	8b 53 14             	mov    0x14(%ebx),%edx
+    10d3:	8d 4a 01             	lea    0x1(%edx),%ecx
+    10d6:	8b 73 08             	mov    0x8(%ebx),%esi
+    10d9:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    10dc:	0f b6 08             	movzbl (%eax),%ecx
+        nl = 1;
+    10df:	80 f9 0a             	cmp    $0xa,%cl
+      if((f->buf[f->n++] = s[i]) == '\n')
+    10e2:	88 0c 16             	mov    %cl,(%esi,%edx,1)
+        nl = 1;
+    10e5:	be 01 00 00 00       	mov    $0x1,%esi
+    10ea:	0f 44 fe             	cmove  %esi,%edi
+    for(i = 0; i < n; i++)
+    10ed:	83 c0 01             	add    $0x1,%eax
+    10f0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    10f3:	75 db                	jne    10d0 <fwrite+0x90>
+    s += n;
+    10f5:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    10f8:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    10fb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    s += n;
+    10fe:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    1101:	85 c0                	test   %eax,%eax
+    1103:	7e 48                	jle    114d <fwrite+0x10d>
+    1105:	8b 43 14             	mov    0x14(%ebx),%eax
+    1108:	8b 73 0c             	mov    0xc(%ebx),%esi
+    if(f->n == f->size && flush(f) < 0)
+    110b:	89 c2                	mov    %eax,%edx
+    110d:	39 f0                	cmp    %esi,%eax
+    110f:	75 97                	jne    10a8 <fwrite+0x68>
+    1111:	89 d8                	mov    %ebx,%eax
+    1113:	e8 d8 f8 ff ff       	call   9f0 <flush>
+    1118:	85 c0                	test   %eax,%eax
+    111a:	78 31                	js     114d <fwrite+0x10d>
+    n = f->size - f->n;
+    111c:	8b 73 0c             	mov    0xc(%ebx),%esi
+    111f:	8b 43 14             	mov    0x14(%ebx),%eax
+    1122:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    1125:	89 f1                	mov    %esi,%ecx
+    1127:	89 c2                	mov    %eax,%edx
+    1129:	29 c1                	sub    %eax,%ecx
+    112b:	39 f9                	cmp    %edi,%ecx
+    112d:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1130:	85 c9                	test   %ecx,%ecx
+    1132:	7f 88                	jg     10bc <fwrite+0x7c>
+    1134:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    s += n;
+    1138:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    113b:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    113e:	e9 5a ff ff ff       	jmp    109d <fwrite+0x5d>
+}
+    1143:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    1146:	31 c0                	xor    %eax,%eax
+}
+    1148:	5b                   	pop    %ebx
+    1149:	5e                   	pop    %esi
+    114a:	5f                   	pop    %edi
+    114b:	5d                   	pop    %ebp
+    114c:	c3                   	ret
+  if(nl && (f->flags & IO_LINE))
+    114d:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1150:	85 ff                	test   %edi,%edi
+    1152:	74 06                	je     115a <fwrite+0x11a>
+    1154:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1158:	75 1d                	jne    1177 <fwrite+0x137>
+  return (s - (const char*)p) / size;
+    115a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    115d:	2b 75 08             	sub    0x8(%ebp),%esi
+  if(threaded)
+    1160:	a1 a0 28 00 00       	mov    0x28a0,%eax
+    1165:	85 c0                	test   %eax,%eax
+    1167:	75 3a                	jne    11a3 <fwrite+0x163>
+  return (s - (const char*)p) / size;
+    1169:	89 f0                	mov    %esi,%eax
+    116b:	99                   	cltd
+    116c:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    116f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1172:	5b                   	pop    %ebx
+    1173:	5e                   	pop    %esi
+    1174:	5f                   	pop    %edi
+    1175:	5d                   	pop    %ebp
+    1176:	c3                   	ret
+    flush(f);
+    1177:	89 d8                	mov    %ebx,%eax
+    1179:	e8 72 f8 ff ff       	call   9f0 <flush>
+    117e:	eb da                	jmp    115a <fwrite+0x11a>
+    setup(f);
+    1180:	89 d8                	mov    %ebx,%eax
+    1182:	e8 19 f8 ff ff       	call   9a0 <setup>
+    1187:	e9 ec fe ff ff       	jmp    1078 <fwrite+0x38>
+    mutex_lock(&f->lock);
+    118c:	83 ec 0c             	sub    $0xc,%esp
+    118f:	8d 43 18             	lea    0x18(%ebx),%eax
+    1192:	50                   	push   %eax
+    1193:	e8 98 f1 ff ff       	call   330 <mutex_lock>
+  if(!(f->flags & IO_SETUP))
+    1198:	8b 43 04             	mov    0x4(%ebx),%eax
+    119b:	83 c4 10             	add    $0x10,%esp
+    119e:	e9 cd fe ff ff       	jmp    1070 <fwrite+0x30>
+    mutex_unlock(&f->lock);
+    11a3:	83 ec 0c             	sub    $0xc,%esp
+    11a6:	83 c3 18             	add    $0x18,%ebx
+    11a9:	53                   	push   %ebx
+    11aa:	e8 d1 f1 ff ff       	call   380 <mutex_unlock>
+    11af:	83 c4 10             	add    $0x10,%esp
+    11b2:	eb b5                	jmp    1169 <fwrite+0x129>
+  for(len = size*nmemb; len > 0; len -= n){
+    11b4:	31 f6                	xor    %esi,%esi
+    11b6:	eb a8                	jmp    1160 <fwrite+0x120>
+    11b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11bf:	90                   	nop
+
+000011c0 <fgetc>:
+  return f->buf[f->r++] & 0xff;
+}
+
+int
+fgetc(FILE *f)
+{
+    11c0:	55                   	push   %ebp
+    11c1:	89 e5                	mov    %esp,%ebp
+    11c3:	56                   	push   %esi
+    11c4:	53                   	push   %ebx
+  if(threaded)
+    11c5:	8b 15 a0 28 00 00    	mov    0x28a0,%edx
+{
+    11cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    11ce:	85 d2                	test   %edx,%edx
+    11d0:	75 2e                	jne    1200 <fgetc+0x40>
+  if(!(f->flags & IO_READ))
+    11d2:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    11d6:	74 78                	je     1250 <fgetc+0x90>
+  if(f->r == f->n && fill(f) == 0)
+    11d8:	8b 43 10             	mov    0x10(%ebx),%eax
+    11db:	3b 43 14             	cmp    0x14(%ebx),%eax
+    11de:	74 60                	je     1240 <fgetc+0x80>
+  return f->buf[f->r++] & 0xff;
+    11e0:	8b 53 08             	mov    0x8(%ebx),%edx
+    11e3:	8d 48 01             	lea    0x1(%eax),%ecx
+    11e6:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    11e9:	0f b6 34 02          	movzbl (%edx,%eax,1),%esi
+  if(threaded)
+    11ed:	a1 a0 28 00 00       	mov    0x28a0,%eax
+    11f2:	85 c0                	test   %eax,%eax
+    11f4:	75 2a                	jne    1220 <fgetc+0x60>
+
+  flockfile(f);
+  c = getc_unlocked(f);
+  funlockfile(f);
+  return c;
+}
+    11f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    11f9:	89 f0                	mov    %esi,%eax
+    11fb:	5b                   	pop    %ebx
+    11fc:	5e                   	pop    %esi
+    11fd:	5d                   	pop    %ebp
+    11fe:	c3                   	ret
+    11ff:	90                   	nop
+    mutex_lock(&f->lock);
+    1200:	83 ec 0c             	sub    $0xc,%esp
+    1203:	8d 43 18             	lea    0x18(%ebx),%eax
+    1206:	50                   	push   %eax
+    1207:	e8 24 f1 ff ff       	call   330 <mutex_lock>
+  if(!(f->flags & IO_READ))
+    120c:	83 c4 10             	add    $0x10,%esp
+    120f:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1213:	75 c3                	jne    11d8 <fgetc+0x18>
+    return EOF;
+    1215:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    121a:	eb d1                	jmp    11ed <fgetc+0x2d>
+    121c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1220:	83 ec 0c             	sub    $0xc,%esp
+    1223:	83 c3 18             	add    $0x18,%ebx
+    1226:	53                   	push   %ebx
+    1227:	e8 54 f1 ff ff       	call   380 <mutex_unlock>
+    122c:	83 c4 10             	add    $0x10,%esp
+}
+    122f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1232:	89 f0                	mov    %esi,%eax
+    1234:	5b                   	pop    %ebx
+    1235:	5e                   	pop    %esi
+    1236:	5d                   	pop    %ebp
+    1237:	c3                   	ret
+    1238:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    123f:	90                   	nop
+  if(f->r == f->n && fill(f) == 0)
+    1240:	89 d8                	mov    %ebx,%eax
+    1242:	e8 c9 f8 ff ff       	call   b10 <fill>
+    1247:	85 c0                	test   %eax,%eax
+    1249:	74 ca                	je     1215 <fgetc+0x55>
+  return f->buf[f->r++] & 0xff;
+    124b:	8b 43 10             	mov    0x10(%ebx),%eax
+    124e:	eb 90                	jmp    11e0 <fgetc+0x20>
+    return EOF;
+    1250:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    1255:	eb 9f                	jmp    11f6 <fgetc+0x36>
+    1257:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    125e:	66 90                	xchg   %ax,%ax
+
+00001260 <fread>:
+
+int
+fread(void *p, int size, int nmemb, FILE *f)
+{
+    1260:	55                   	push   %ebp
+    1261:	89 e5                	mov    %esp,%ebp
+    1263:	57                   	push   %edi
+    1264:	56                   	push   %esi
+    1265:	53                   	push   %ebx
+    1266:	83 ec 1c             	sub    $0x1c,%esp
+    1269:	8b 75 14             	mov    0x14(%ebp),%esi
+  char *d;
+  int n, len;
+
+  if(!(f->flags & IO_READ) || size <= 0)
+    126c:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+    1270:	74 7e                	je     12f0 <fread+0x90>
+    1272:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1275:	85 d2                	test   %edx,%edx
+    1277:	7e 77                	jle    12f0 <fread+0x90>
+  if(threaded)
+    1279:	a1 a0 28 00 00       	mov    0x28a0,%eax
+    return 0;
+  flockfile(f);
+  d = p;
+  for(len = size*nmemb; len > 0; len -= n){
+    127e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1281:	0f af 7d 10          	imul   0x10(%ebp),%edi
+  if(threaded)
+    1285:	85 c0                	test   %eax,%eax
+    1287:	0f 85 93 00 00 00    	jne    1320 <fread+0xc0>
+  for(len = size*nmemb; len > 0; len -= n){
+    128d:	85 ff                	test   %edi,%edi
+    128f:	7e 61                	jle    12f2 <fread+0x92>
+    if(f->r == f->n && fill(f) == 0)
+    1291:	8b 46 10             	mov    0x10(%esi),%eax
+  d = p;
+    1294:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1297:	eb 35                	jmp    12ce <fread+0x6e>
+    1299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      break;
+    n = f->n - f->r;
+    12a0:	29 c3                	sub    %eax,%ebx
+    12a2:	39 fb                	cmp    %edi,%ebx
+    12a4:	0f 4f df             	cmovg  %edi,%ebx
+    if(n > len)
+      n = len;
+    memmove(d, f->buf + f->r, n);
+    12a7:	83 ec 04             	sub    $0x4,%esp
+    12aa:	53                   	push   %ebx
+    12ab:	03 46 08             	add    0x8(%esi),%eax
+  for(len = size*nmemb; len > 0; len -= n){
+    12ae:	29 df                	sub    %ebx,%edi
+    memmove(d, f->buf + f->r, n);
+    12b0:	50                   	push   %eax
+    12b1:	51                   	push   %ecx
+    12b2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    12b5:	e8 36 f0 ff ff       	call   2f0 <memmove>
+    f->r += n;
+    12ba:	8b 46 10             	mov    0x10(%esi),%eax
+    d += n;
+    12bd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    12c0:	83 c4 10             	add    $0x10,%esp
+    f->r += n;
+    12c3:	01 d8                	add    %ebx,%eax
+    d += n;
+    12c5:	01 d9                	add    %ebx,%ecx
+    f->r += n;
+    12c7:	89 46 10             	mov    %eax,0x10(%esi)
+  for(len = size*nmemb; len > 0; len -= n){
+    12ca:	85 ff                	test   %edi,%edi
+    12cc:	7e 32                	jle    1300 <fread+0xa0>
+    if(f->r == f->n && fill(f) == 0)
+    12ce:	8b 5e 14             	mov    0x14(%esi),%ebx
+    12d1:	39 c3                	cmp    %eax,%ebx
+    12d3:	75 cb                	jne    12a0 <fread+0x40>
+    12d5:	89 f0                	mov    %esi,%eax
+    12d7:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    12da:	e8 31 f8 ff ff       	call   b10 <fill>
+    12df:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    12e2:	85 c0                	test   %eax,%eax
+    12e4:	74 1a                	je     1300 <fread+0xa0>
+    n = f->n - f->r;
+    12e6:	8b 5e 14             	mov    0x14(%esi),%ebx
+    12e9:	8b 46 10             	mov    0x10(%esi),%eax
+    12ec:	eb b2                	jmp    12a0 <fread+0x40>
+    12ee:	66 90                	xchg   %ax,%ax
+    return 0;
+    12f0:	31 c0                	xor    %eax,%eax
+  }
+  funlockfile(f);
+  return (d - (char*)p) / size;
+}
+    12f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12f5:	5b                   	pop    %ebx
+    12f6:	5e                   	pop    %esi
+    12f7:	5f                   	pop    %edi
+    12f8:	5d                   	pop    %ebp
+    12f9:	c3                   	ret
+    12fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (d - (char*)p) / size;
+    1300:	2b 4d 08             	sub    0x8(%ebp),%ecx
+    1303:	89 cb                	mov    %ecx,%ebx
+  if(threaded)
+    1305:	a1 a0 28 00 00       	mov    0x28a0,%eax
+    130a:	85 c0                	test   %eax,%eax
+    130c:	75 32                	jne    1340 <fread+0xe0>
+  return (d - (char*)p) / size;
+    130e:	89 d8                	mov    %ebx,%eax
+    1310:	99                   	cltd
+    1311:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1314:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1317:	5b                   	pop    %ebx
+    1318:	5e                   	pop    %esi
+    1319:	5f                   	pop    %edi
+    131a:	5d                   	pop    %ebp
+    131b:	c3                   	ret
+    131c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    1320:	83 ec 0c             	sub    $0xc,%esp
+    1323:	8d 46 18             	lea    0x18(%esi),%eax
+    1326:	50                   	push   %eax
+    1327:	e8 04 f0 ff ff       	call   330 <mutex_lock>
+  for(len = size*nmemb; len > 0; len -= n){
+    132c:	83 c4 10             	add    $0x10,%esp
+    132f:	85 ff                	test   %edi,%edi
+    1331:	0f 8f 5a ff ff ff    	jg     1291 <fread+0x31>
+    1337:	31 db                	xor    %ebx,%ebx
+    1339:	eb ca                	jmp    1305 <fread+0xa5>
+    133b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    133f:	90                   	nop
+    mutex_unlock(&f->lock);
+    1340:	83 ec 0c             	sub    $0xc,%esp
+    1343:	83 c6 18             	add    $0x18,%esi
+    1346:	56                   	push   %esi
+    1347:	e8 34 f0 ff ff       	call   380 <mutex_unlock>
+  return (d - (char*)p) / size;
+    134c:	89 d8                	mov    %ebx,%eax
+    134e:	83 c4 10             	add    $0x10,%esp
+    1351:	99                   	cltd
+    1352:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1355:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1358:	5b                   	pop    %ebx
+    1359:	5e                   	pop    %esi
+    135a:	5f                   	pop    %edi
+    135b:	5d                   	pop    %ebp
+    135c:	c3                   	ret
+    135d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001360 <fgets>:
+
+// Read a line of at most max-1 bytes, keeping the newline.
+// Returns 0 if there was nothing left to read.
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    1360:	55                   	push   %ebp
+    1361:	89 e5                	mov    %esp,%ebp
+    1363:	57                   	push   %edi
+    1364:	56                   	push   %esi
+    1365:	53                   	push   %ebx
+    1366:	83 ec 1c             	sub    $0x1c,%esp
+  if(threaded)
+    1369:	8b 35 a0 28 00 00    	mov    0x28a0,%esi
+{
+    136f:	8b 7d 08             	mov    0x8(%ebp),%edi
+    1372:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if(threaded)
+    1375:	85 f6                	test   %esi,%esi
+    1377:	0f 85 83 00 00 00    	jne    1400 <fgets+0xa0>
+{
+    137d:	31 f6                	xor    %esi,%esi
+    137f:	eb 2a                	jmp    13ab <fgets+0x4b>
+    1381:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return f->buf[f->r++] & 0xff;
+    1388:	8b 53 08             	mov    0x8(%ebx),%edx
+    138b:	8d 48 01             	lea    0x1(%eax),%ecx
+    138e:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1391:	0f b6 14 02          	movzbl (%edx,%eax,1),%edx
+
+  flockfile(f);
+  for(i = 0; i+1 < max; ){
+    if((c = getc_unlocked(f)) == EOF)
+      break;
+    buf[i++] = c;
+    1395:	88 54 37 ff          	mov    %dl,-0x1(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    1399:	80 fa 0a             	cmp    $0xa,%dl
+    139c:	0f 84 96 00 00 00    	je     1438 <fgets+0xd8>
+    13a2:	83 fa 0d             	cmp    $0xd,%edx
+    13a5:	0f 84 8d 00 00 00    	je     1438 <fgets+0xd8>
+  for(i = 0; i+1 < max; ){
+    13ab:	89 f2                	mov    %esi,%edx
+    13ad:	83 c6 01             	add    $0x1,%esi
+    13b0:	3b 75 0c             	cmp    0xc(%ebp),%esi
+    13b3:	7d 2b                	jge    13e0 <fgets+0x80>
+  if(!(f->flags & IO_READ))
+    13b5:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    13b9:	74 25                	je     13e0 <fgets+0x80>
+  if(f->r == f->n && fill(f) == 0)
+    13bb:	8b 43 10             	mov    0x10(%ebx),%eax
+    13be:	3b 43 14             	cmp    0x14(%ebx),%eax
+    13c1:	75 c5                	jne    1388 <fgets+0x28>
+    13c3:	89 d8                	mov    %ebx,%eax
+    13c5:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    13c8:	e8 43 f7 ff ff       	call   b10 <fill>
+    13cd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    13d0:	85 c0                	test   %eax,%eax
+    13d2:	74 0c                	je     13e0 <fgets+0x80>
+  return f->buf[f->r++] & 0xff;
+    13d4:	8b 43 10             	mov    0x10(%ebx),%eax
+    13d7:	eb af                	jmp    1388 <fgets+0x28>
+    13d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    13e0:	8b 0d a0 28 00 00    	mov    0x28a0,%ecx
+      break;
+  }
+  buf[i] = '\0';
+    13e6:	c6 04 17 00          	movb   $0x0,(%edi,%edx,1)
+  if(threaded)
+    13ea:	85 c9                	test   %ecx,%ecx
+    13ec:	75 2a                	jne    1418 <fgets+0xb8>
+  funlockfile(f);
+  return i > 0 ? buf : 0;
+    13ee:	31 c0                	xor    %eax,%eax
+    13f0:	85 d2                	test   %edx,%edx
+    13f2:	74 02                	je     13f6 <fgets+0x96>
+    13f4:	89 f8                	mov    %edi,%eax
+}
+    13f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13f9:	5b                   	pop    %ebx
+    13fa:	5e                   	pop    %esi
+    13fb:	5f                   	pop    %edi
+    13fc:	5d                   	pop    %ebp
+    13fd:	c3                   	ret
+    13fe:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    1400:	83 ec 0c             	sub    $0xc,%esp
+    1403:	8d 43 18             	lea    0x18(%ebx),%eax
+    1406:	50                   	push   %eax
+    1407:	e8 24 ef ff ff       	call   330 <mutex_lock>
+    140c:	83 c4 10             	add    $0x10,%esp
+    140f:	e9 69 ff ff ff       	jmp    137d <fgets+0x1d>
+    1414:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1418:	83 ec 0c             	sub    $0xc,%esp
+    141b:	83 c3 18             	add    $0x18,%ebx
+    141e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1421:	53                   	push   %ebx
+    1422:	e8 59 ef ff ff       	call   380 <mutex_unlock>
+    1427:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    142a:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    142d:	31 c0                	xor    %eax,%eax
+    142f:	85 d2                	test   %edx,%edx
+    1431:	75 c1                	jne    13f4 <fgets+0x94>
+    1433:	eb c1                	jmp    13f6 <fgets+0x96>
+    1435:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1438:	a1 a0 28 00 00       	mov    0x28a0,%eax
+  buf[i] = '\0';
+    143d:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  if(threaded)
+    1441:	85 c0                	test   %eax,%eax
+    1443:	74 af                	je     13f4 <fgets+0x94>
+    mutex_unlock(&f->lock);
+    1445:	83 ec 0c             	sub    $0xc,%esp
+    1448:	83 c3 18             	add    $0x18,%ebx
+    144b:	53                   	push   %ebx
+    144c:	e8 2f ef ff ff       	call   380 <mutex_unlock>
+    1451:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    1454:	89 f8                	mov    %edi,%eax
+    1456:	eb 9e                	jmp    13f6 <fgets+0x96>
+    1458:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    145f:	90                   	nop
+
+00001460 <gets>:
+// at most a line per read(), goes through stdin's buffer: from a
+// file or pipe, a buffered read could take input meant for a child
+// process, so read a byte at a time.
+char*
+gets(char *buf, int max)
+{
+    1460:	55                   	push   %ebp
+    1461:	89 e5                	mov    %esp,%ebp
+    1463:	57                   	push   %edi
+    1464:	56                   	push   %esi
+    1465:	53                   	push   %ebx
+    1466:	83 ec 2c             	sub    $0x2c,%esp
+  int i, cc;
+  char c;
+
+  if(!(stdin->flags & IO_SETUP))
+    1469:	8b 15 a4 27 00 00    	mov    0x27a4,%edx
+{
+    146f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!(stdin->flags & IO_SETUP))
+    1472:	f6 c2 40             	test   $0x40,%dl
+    1475:	74 79                	je     14f0 <gets+0x90>
+    setup(stdin);
+  if(stdin->flags & IO_DEV){
+    1477:	83 e2 20             	and    $0x20,%edx
+    147a:	89 d7                	mov    %edx,%edi
+    147c:	75 52                	jne    14d0 <gets+0x70>
+  if(f == 0){
+    147e:	e8 ed f5 ff ff       	call   a70 <fflush.part.0>
+    fgets(buf, max, stdin);
+    return buf;
+  }
+  fflush(0);
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1483:	8d 75 e7             	lea    -0x19(%ebp),%esi
+  for(i=0; i+1 < max; ){
+    1486:	eb 2c                	jmp    14b4 <gets+0x54>
+    1488:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    148f:	90                   	nop
+    cc = read(0, &c, 1);
+    1490:	83 ec 04             	sub    $0x4,%esp
+    1493:	6a 01                	push   $0x1
+    1495:	56                   	push   %esi
+    1496:	6a 00                	push   $0x0
+    1498:	e8 f5 ef ff ff       	call   492 <read>
+    if(cc < 1)
+    149d:	83 c4 10             	add    $0x10,%esp
+    14a0:	85 c0                	test   %eax,%eax
+    14a2:	7e 1b                	jle    14bf <gets+0x5f>
+      break;
+    buf[i++] = c;
+    14a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    14a8:	88 44 3b ff          	mov    %al,-0x1(%ebx,%edi,1)
+    if(c == '\n' || c == '\r')
+    14ac:	3c 0a                	cmp    $0xa,%al
+    14ae:	74 12                	je     14c2 <gets+0x62>
+    14b0:	3c 0d                	cmp    $0xd,%al
+    14b2:	74 0e                	je     14c2 <gets+0x62>
+  for(i=0; i+1 < max; ){
+    14b4:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    14b7:	83 c7 01             	add    $0x1,%edi
+    14ba:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+    14bd:	7c d1                	jl     1490 <gets+0x30>
+{
+    14bf:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      break;
+  }
+  buf[i] = '\0';
+    14c2:	c6 04 3b 00          	movb   $0x0,(%ebx,%edi,1)
+  return buf;
+}
+    14c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    14c9:	89 d8                	mov    %ebx,%eax
+    14cb:	5b                   	pop    %ebx
+    14cc:	5e                   	pop    %esi
+    14cd:	5f                   	pop    %edi
+    14ce:	5d                   	pop    %ebp
+    14cf:	c3                   	ret
+    fgets(buf, max, stdin);
+    14d0:	83 ec 04             	sub    $0x4,%esp
+    14d3:	68 a0 27 00 00       	push   $0x27a0
+    14d8:	ff 75 0c             	push   0xc(%ebp)
+    14db:	53                   	push   %ebx
+    14dc:	e8 7f fe ff ff       	call   1360 <fgets>
+    return buf;
+    14e1:	83 c4 10             	add    $0x10,%esp
+}
+    14e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    14e7:	89 d8                	mov    %ebx,%eax
+    14e9:	5b                   	pop    %ebx
+    14ea:	5e                   	pop    %esi
+    14eb:	5f                   	pop    %edi
+    14ec:	5d                   	pop    %ebp
+    14ed:	c3                   	ret
+    14ee:	66 90                	xchg   %ax,%ax
+    setup(stdin);
+    14f0:	b8 a0 27 00 00       	mov    $0x27a0,%eax
+    14f5:	e8 a6 f4 ff ff       	call   9a0 <setup>
+  if(stdin->flags & IO_DEV){
+    14fa:	8b 15 a4 27 00 00    	mov    0x27a4,%edx
+    1500:	e9 72 ff ff ff       	jmp    1477 <gets+0x17>
+    1505:	66 90                	xchg   %ax,%ax
+    1507:	66 90                	xchg   %ax,%ax
+    1509:	66 90                	xchg   %ax,%ax
+    150b:	66 90                	xchg   %ax,%ax
+    150d:	66 90                	xchg   %ax,%ax
+    150f:	90                   	nop
+
+00001510 <bigfree>:
+
+// Give a big block back to the first-fit list, and return the
+// free block that now holds it. Caller holds lock.
+static Header*
+bigfree(Header *bp)
+{
+    1510:	55                   	push   %ebp
+    1511:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1513:	a1 44 2f 00 00       	mov    0x2f44,%eax
+{
+    1518:	89 e5                	mov    %esp,%ebp
+    151a:	56                   	push   %esi
+    151b:	53                   	push   %ebx
+    151c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1520:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1522:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1524:	39 ca                	cmp    %ecx,%edx
+    1526:	73 38                	jae    1560 <bigfree+0x50>
+    1528:	39 c1                	cmp    %eax,%ecx
+    152a:	72 04                	jb     1530 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    152c:	39 c2                	cmp    %eax,%edx
+    152e:	72 f0                	jb     1520 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1530:	8b 59 04             	mov    0x4(%ecx),%ebx
+    1533:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    1536:	39 f0                	cmp    %esi,%eax
+    1538:	74 36                	je     1570 <bigfree+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    153a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  freep = p;
+  if(p + p->s.size == bp){
+    153c:	8b 42 04             	mov    0x4(%edx),%eax
+    153f:	89 cb                	mov    %ecx,%ebx
+  freep = p;
+    1541:	89 15 44 2f 00 00    	mov    %edx,0x2f44
+  if(p + p->s.size == bp){
+    1547:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    154a:	39 f1                	cmp    %esi,%ecx
+    154c:	74 2e                	je     157c <bigfree+0x6c>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    154e:	89 1a                	mov    %ebx,(%edx)
+    return p;
+  }
+  p->s.ptr = bp;
+  return bp;
+}
+    1550:	89 c8                	mov    %ecx,%eax
+    1552:	5b                   	pop    %ebx
+    1553:	5e                   	pop    %esi
+    1554:	5d                   	pop    %ebp
+    1555:	c3                   	ret
+    1556:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    155d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1560:	39 c1                	cmp    %eax,%ecx
+    1562:	72 c8                	jb     152c <bigfree+0x1c>
+    1564:	eb ba                	jmp    1520 <bigfree+0x10>
+    1566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    156d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1570:	03 58 04             	add    0x4(%eax),%ebx
+    1573:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1576:	8b 02                	mov    (%edx),%eax
+    1578:	8b 00                	mov    (%eax),%eax
+    157a:	eb be                	jmp    153a <bigfree+0x2a>
+    p->s.size += bp->s.size;
+    157c:	03 41 04             	add    0x4(%ecx),%eax
+    157f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1582:	8b 19                	mov    (%ecx),%ebx
+    return p;
+    1584:	89 d1                	mov    %edx,%ecx
+}
+    1586:	89 c8                	mov    %ecx,%eax
+    p->s.ptr = bp->s.ptr;
+    1588:	89 1a                	mov    %ebx,(%edx)
+}
+    158a:	5b                   	pop    %ebx
+    158b:	5e                   	pop    %esi
+    158c:	5d                   	pop    %ebp
+    158d:	c3                   	ret
+    158e:	66 90                	xchg   %ax,%ax
+
+00001590 <trim>:
+// If free block bp ends the heap, return its whole pages to the
+// kernel, unless something else has moved the break since.
+// Caller holds lock.
+static void
+trim(Header *bp)
+{
+    1590:	55                   	push   %ebp
+    1591:	89 e5                	mov    %esp,%ebp
+    1593:	57                   	push   %edi
+    1594:	56                   	push   %esi
+    1595:	53                   	push   %ebx
+    1596:	89 c3                	mov    %eax,%ebx
+    1598:	83 ec 0c             	sub    $0xc,%esp
+  char *end;
+  uint n;
+
+  if((char*)(bp + bp->s.size) != heapend)
+    159b:	8b 53 04             	mov    0x4(%ebx),%edx
+    159e:	a1 40 2f 00 00       	mov    0x2f40,%eax
+    15a3:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+    15a6:	39 d0                	cmp    %edx,%eax
+    15a8:	74 0e                	je     15b8 <trim+0x28>
+  n = heapend - end;
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    bp->s.size -= n / sizeof(Header);
+    heapend = end;
+  }
+}
+    15aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15ad:	5b                   	pop    %ebx
+    15ae:	5e                   	pop    %esi
+    15af:	5f                   	pop    %edi
+    15b0:	5d                   	pop    %ebp
+    15b1:	c3                   	ret
+    15b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  end = (char*)PGROUNDUP((uint)(bp + 2));
+    15b8:	8d bb 0f 10 00 00    	lea    0x100f(%ebx),%edi
+    15be:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  n = heapend - end;
+    15c4:	29 f8                	sub    %edi,%eax
+    15c6:	89 c6                	mov    %eax,%esi
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    15c8:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    15cd:	76 db                	jbe    15aa <trim+0x1a>
+    15cf:	83 ec 0c             	sub    $0xc,%esp
+    15d2:	6a 00                	push   $0x0
+    15d4:	e8 8b ef ff ff       	call   564 <sbrk>
+    15d9:	83 c4 10             	add    $0x10,%esp
+    15dc:	39 05 40 2f 00 00    	cmp    %eax,0x2f40
+    15e2:	75 c6                	jne    15aa <trim+0x1a>
+    15e4:	89 f0                	mov    %esi,%eax
+    15e6:	83 ec 0c             	sub    $0xc,%esp
+    15e9:	f7 d8                	neg    %eax
+    15eb:	50                   	push   %eax
+    15ec:	e8 73 ef ff ff       	call   564 <sbrk>
+    15f1:	83 c4 10             	add    $0x10,%esp
+    15f4:	83 f8 ff             	cmp    $0xffffffff,%eax
+    15f7:	74 b1                	je     15aa <trim+0x1a>
+    bp->s.size -= n / sizeof(Header);
+    15f9:	89 f0                	mov    %esi,%eax
+    heapend = end;
+    15fb:	89 3d 40 2f 00 00    	mov    %edi,0x2f40
+    bp->s.size -= n / sizeof(Header);
+    1601:	c1 e8 03             	shr    $0x3,%eax
+    1604:	29 43 04             	sub    %eax,0x4(%ebx)
+    heapend = end;
+    1607:	eb a1                	jmp    15aa <trim+0x1a>
+    1609:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001610 <bigalloc>:
+}
+
+// Allocate a big block of nunits units. Caller holds lock.
+static Header*
+bigalloc(uint nunits)
+{
+    1610:	55                   	push   %ebp
+    1611:	89 e5                	mov    %esp,%ebp
+    1613:	57                   	push   %edi
+    1614:	89 c7                	mov    %eax,%edi
+    1616:	56                   	push   %esi
+    1617:	53                   	push   %ebx
+    1618:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    161b:	a1 44 2f 00 00       	mov    0x2f44,%eax
+    1620:	85 c0                	test   %eax,%eax
+    1622:	0f 84 98 00 00 00    	je     16c0 <bigalloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1628:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    162a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    162d:	39 f9                	cmp    %edi,%ecx
+    162f:	73 67                	jae    1698 <bigalloc+0x88>
+  if(nu < 4096)
+    1631:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1636:	39 df                	cmp    %ebx,%edi
+    1638:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    163b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    1642:	eb 0d                	jmp    1651 <bigalloc+0x41>
+    1644:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1648:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    164a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    164d:	39 f9                	cmp    %edi,%ecx
+    164f:	73 47                	jae    1698 <bigalloc+0x88>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    1651:	89 d0                	mov    %edx,%eax
+    1653:	39 15 44 2f 00 00    	cmp    %edx,0x2f44
+    1659:	75 ed                	jne    1648 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    165b:	83 ec 0c             	sub    $0xc,%esp
+    165e:	56                   	push   %esi
+    165f:	e8 00 ef ff ff       	call   564 <sbrk>
+  if(p == (char*)-1)
+    1664:	83 c4 10             	add    $0x10,%esp
+    1667:	83 f8 ff             	cmp    $0xffffffff,%eax
+    166a:	74 1a                	je     1686 <bigalloc+0x76>
+  hp->s.size = nu;
+    166c:	89 58 04             	mov    %ebx,0x4(%eax)
+  heapend = p + nu * sizeof(Header);
+    166f:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    1672:	89 15 40 2f 00 00    	mov    %edx,0x2f40
+  bigfree(hp);
+    1678:	e8 93 fe ff ff       	call   1510 <bigfree>
+  return freep;
+    167d:	a1 44 2f 00 00       	mov    0x2f44,%eax
+      if((p = morecore(nunits)) == 0)
+    1682:	85 c0                	test   %eax,%eax
+    1684:	75 c2                	jne    1648 <bigalloc+0x38>
+        return 0;
+  }
+}
+    1686:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1689:	31 d2                	xor    %edx,%edx
+}
+    168b:	5b                   	pop    %ebx
+    168c:	89 d0                	mov    %edx,%eax
+    168e:	5e                   	pop    %esi
+    168f:	5f                   	pop    %edi
+    1690:	5d                   	pop    %ebp
+    1691:	c3                   	ret
+    1692:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1698:	39 cf                	cmp    %ecx,%edi
+    169a:	74 54                	je     16f0 <bigalloc+0xe0>
+        p->s.size -= nunits;
+    169c:	29 f9                	sub    %edi,%ecx
+    169e:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    16a1:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    16a4:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    16a7:	a3 44 2f 00 00       	mov    %eax,0x2f44
+}
+    16ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    16af:	89 d0                	mov    %edx,%eax
+    16b1:	5b                   	pop    %ebx
+    16b2:	5e                   	pop    %esi
+    16b3:	5f                   	pop    %edi
+    16b4:	5d                   	pop    %ebp
+    16b5:	c3                   	ret
+    16b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16bd:	8d 76 00             	lea    0x0(%esi),%esi
+    base.s.ptr = freep = prevp = &base;
+    16c0:	c7 05 44 2f 00 00 48 	movl   $0x2f48,0x2f44
+    16c7:	2f 00 00 
+    base.s.size = 0;
+    16ca:	ba 48 2f 00 00       	mov    $0x2f48,%edx
+    base.s.ptr = freep = prevp = &base;
+    16cf:	c7 05 48 2f 00 00 48 	movl   $0x2f48,0x2f48
+    16d6:	2f 00 00 
+    base.s.size = 0;
+    16d9:	c7 05 4c 2f 00 00 00 	movl   $0x0,0x2f4c
+    16e0:	00 00 00 
+    if(p->s.size >= nunits){
+    16e3:	e9 49 ff ff ff       	jmp    1631 <bigalloc+0x21>
+    16e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16ef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    16f0:	8b 0a                	mov    (%edx),%ecx
+    16f2:	89 08                	mov    %ecx,(%eax)
+    16f4:	eb b1                	jmp    16a7 <bigalloc+0x97>
+    16f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001700 <drain>:
+}
+
+// Move n blocks of class c from cache tc to the shared list.
+static void
+drain(struct tcache *tc, int c, int n)
+{
+    1700:	55                   	push   %ebp
+    1701:	89 e5                	mov    %esp,%ebp
+    1703:	57                   	push   %edi
+    1704:	89 c7                	mov    %eax,%edi
+    1706:	56                   	push   %esi
+    1707:	89 d6                	mov    %edx,%esi
+    1709:	53                   	push   %ebx
+    170a:	89 cb                	mov    %ecx,%ebx
+    170c:	83 ec 0c             	sub    $0xc,%esp
+  if(threaded)
+    170f:	8b 15 c4 2e 00 00    	mov    0x2ec4,%edx
+    1715:	85 d2                	test   %edx,%edx
+    1717:	75 57                	jne    1770 <drain+0x70>
+  Header *p;
+
+  acquire();
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1719:	85 c9                	test   %ecx,%ecx
+    171b:	7e 49                	jle    1766 <drain+0x66>
+    171d:	89 d9                	mov    %ebx,%ecx
+    171f:	8d 14 b7             	lea    (%edi,%esi,4),%edx
+    1722:	eb 23                	jmp    1747 <drain+0x47>
+    1724:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    tc->list[c] = p->s.ptr;
+    1728:	8b 18                	mov    (%eax),%ebx
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    172a:	83 e9 01             	sub    $0x1,%ecx
+    tc->n[c]--;
+    172d:	83 6a 20 01          	subl   $0x1,0x20(%edx)
+    tc->list[c] = p->s.ptr;
+    1731:	89 1a                	mov    %ebx,(%edx)
+    p->s.ptr = small[c];
+    1733:	8b 1c b5 20 2f 00 00 	mov    0x2f20(,%esi,4),%ebx
+    173a:	89 18                	mov    %ebx,(%eax)
+    small[c] = p;
+    173c:	89 04 b5 20 2f 00 00 	mov    %eax,0x2f20(,%esi,4)
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1743:	85 c9                	test   %ecx,%ecx
+    1745:	7e 06                	jle    174d <drain+0x4d>
+    1747:	8b 02                	mov    (%edx),%eax
+    1749:	85 c0                	test   %eax,%eax
+    174b:	75 db                	jne    1728 <drain+0x28>
+  if(threaded)
+    174d:	a1 c4 2e 00 00       	mov    0x2ec4,%eax
+    1752:	85 c0                	test   %eax,%eax
+    1754:	74 10                	je     1766 <drain+0x66>
+    mutex_unlock(&lock);
+    1756:	83 ec 0c             	sub    $0xc,%esp
+    1759:	68 c8 2e 00 00       	push   $0x2ec8
+    175e:	e8 1d ec ff ff       	call   380 <mutex_unlock>
+}
+    1763:	83 c4 10             	add    $0x10,%esp
+  }
+  release();
+}
+    1766:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1769:	5b                   	pop    %ebx
+    176a:	5e                   	pop    %esi
+    176b:	5f                   	pop    %edi
+    176c:	5d                   	pop    %ebp
+    176d:	c3                   	ret
+    176e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&lock);
+    1770:	83 ec 0c             	sub    $0xc,%esp
+    1773:	68 c8 2e 00 00       	push   $0x2ec8
+    1778:	e8 b3 eb ff ff       	call   330 <mutex_lock>
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    177d:	83 c4 10             	add    $0x10,%esp
+    1780:	85 db                	test   %ebx,%ebx
+    1782:	7f 99                	jg     171d <drain+0x1d>
+    1784:	eb c7                	jmp    174d <drain+0x4d>
+    1786:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    178d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001790 <mycache>:
+{
+    1790:	55                   	push   %ebp
+    return &maincache;
+    1791:	b8 e0 2e 00 00       	mov    $0x2ee0,%eax
+{
+    1796:	89 e5                	mov    %esp,%ebp
+    1798:	53                   	push   %ebx
+  sp = PGROUNDDOWN((uint)&sp);
+    1799:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+    179c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+    17a2:	83 ec 14             	sub    $0x14,%esp
+  if(!threaded || sp == mainstack)
+    17a5:	8b 0d c4 2e 00 00    	mov    0x2ec4,%ecx
+  sp = PGROUNDDOWN((uint)&sp);
+    17ab:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  if(!threaded || sp == mainstack)
+    17ae:	85 c9                	test   %ecx,%ecx
+    17b0:	74 0f                	je     17c1 <mycache+0x31>
+    17b2:	3b 1d c0 2e 00 00    	cmp    0x2ec0,%ebx
+    17b8:	74 07                	je     17c1 <mycache+0x31>
+  if(*cp == 0){
+    17ba:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    17bd:	85 c0                	test   %eax,%eax
+    17bf:	74 0f                	je     17d0 <mycache+0x40>
+}
+    17c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    17c4:	c9                   	leave
+    17c5:	c3                   	ret
+    17c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17cd:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    17d0:	83 ec 0c             	sub    $0xc,%esp
+    17d3:	68 c8 2e 00 00       	push   $0x2ec8
+    17d8:	e8 53 eb ff ff       	call   330 <mutex_lock>
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    17dd:	b8 09 00 00 00       	mov    $0x9,%eax
+    17e2:	e8 29 fe ff ff       	call   1610 <bigalloc>
+  if(threaded)
+    17e7:	8b 15 c4 2e 00 00    	mov    0x2ec4,%edx
+    17ed:	83 c4 10             	add    $0x10,%esp
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    17f0:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(threaded)
+    17f3:	85 d2                	test   %edx,%edx
+    17f5:	75 29                	jne    1820 <mycache+0x90>
+    if(*cp == 0)
+    17f7:	85 c0                	test   %eax,%eax
+    17f9:	74 c6                	je     17c1 <mycache+0x31>
+    memset(*cp, 0, sizeof(**cp));
+    17fb:	83 ec 04             	sub    $0x4,%esp
+    *cp = (struct tcache*)((Header*)*cp + 1);
+    17fe:	83 c0 08             	add    $0x8,%eax
+    1801:	89 43 f8             	mov    %eax,-0x8(%ebx)
+    memset(*cp, 0, sizeof(**cp));
+    1804:	6a 40                	push   $0x40
+    1806:	6a 00                	push   $0x0
+    1808:	50                   	push   %eax
+    1809:	e8 f2 e9 ff ff       	call   200 <memset>
+  return *cp;
+    180e:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    1811:	83 c4 10             	add    $0x10,%esp
+    1814:	eb ab                	jmp    17c1 <mycache+0x31>
+    1816:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    181d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1820:	83 ec 0c             	sub    $0xc,%esp
+    1823:	68 c8 2e 00 00       	push   $0x2ec8
+    1828:	e8 53 eb ff ff       	call   380 <mutex_unlock>
+    if(*cp == 0)
+    182d:	8b 43 f8             	mov    -0x8(%ebx),%eax
+}
+    1830:	83 c4 10             	add    $0x10,%esp
+    1833:	eb c2                	jmp    17f7 <mycache+0x67>
+    1835:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    183c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001840 <free>:
+
+void
+free(void *ap)
+{
+    1840:	55                   	push   %ebp
+    1841:	89 e5                	mov    %esp,%ebp
+    1843:	57                   	push   %edi
+    1844:	56                   	push   %esi
+    1845:	53                   	push   %ebx
+    1846:	83 ec 1c             	sub    $0x1c,%esp
+    1849:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  struct tcache *tc;
+  int c;
+
+  if(ap == 0)
+    184c:	85 f6                	test   %esi,%esi
+    184e:	74 51                	je     18a1 <free+0x61>
+    return;
+  bp = (Header*)ap - 1;
+    1850:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1853:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(bp->s.size > SMALLMAX / sizeof(Header)){
+    1856:	8b 46 fc             	mov    -0x4(%esi),%eax
+    1859:	3d 00 01 00 00       	cmp    $0x100,%eax
+    185e:	77 50                	ja     18b0 <free+0x70>
+    acquire();
+    trim(bigfree(bp));
+    release();
+    return;
+  }
+  for(c = 0; (2 << c) < bp->s.size; c++)
+    1860:	31 db                	xor    %ebx,%ebx
+    1862:	ba 02 00 00 00       	mov    $0x2,%edx
+    1867:	83 f8 02             	cmp    $0x2,%eax
+    186a:	76 11                	jbe    187d <free+0x3d>
+    186c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1870:	83 c3 01             	add    $0x1,%ebx
+    1873:	89 d7                	mov    %edx,%edi
+    1875:	89 d9                	mov    %ebx,%ecx
+    1877:	d3 e7                	shl    %cl,%edi
+    1879:	39 c7                	cmp    %eax,%edi
+    187b:	72 f3                	jb     1870 <free+0x30>
+    ;
+  if((tc = mycache()) == 0){
+    187d:	e8 0e ff ff ff       	call   1790 <mycache>
+    1882:	85 c0                	test   %eax,%eax
+    1884:	74 7a                	je     1900 <free+0xc0>
+    bp->s.ptr = small[c];
+    small[c] = bp;
+    release();
+    return;
+  }
+  bp->s.ptr = tc->list[c];
+    1886:	8d 0c 98             	lea    (%eax,%ebx,4),%ecx
+    1889:	8b 11                	mov    (%ecx),%edx
+    188b:	89 56 f8             	mov    %edx,-0x8(%esi)
+  tc->list[c] = bp;
+    188e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1891:	89 31                	mov    %esi,(%ecx)
+  if(++tc->n[c] > TCACHEMAX)
+    1893:	8b 71 20             	mov    0x20(%ecx),%esi
+    1896:	8d 56 01             	lea    0x1(%esi),%edx
+    1899:	89 51 20             	mov    %edx,0x20(%ecx)
+    189c:	83 fa 20             	cmp    $0x20,%edx
+    189f:	7f 47                	jg     18e8 <free+0xa8>
+    drain(tc, c, BATCH);
+}
+    18a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    18a4:	5b                   	pop    %ebx
+    18a5:	5e                   	pop    %esi
+    18a6:	5f                   	pop    %edi
+    18a7:	5d                   	pop    %ebp
+    18a8:	c3                   	ret
+    18a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    18b0:	8b 1d c4 2e 00 00    	mov    0x2ec4,%ebx
+    18b6:	85 db                	test   %ebx,%ebx
+    18b8:	75 66                	jne    1920 <free+0xe0>
+    trim(bigfree(bp));
+    18ba:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    18bd:	e8 4e fc ff ff       	call   1510 <bigfree>
+    18c2:	e8 c9 fc ff ff       	call   1590 <trim>
+  if(threaded)
+    18c7:	8b 0d c4 2e 00 00    	mov    0x2ec4,%ecx
+    18cd:	85 c9                	test   %ecx,%ecx
+    18cf:	74 d0                	je     18a1 <free+0x61>
+    mutex_unlock(&lock);
+    18d1:	c7 45 08 c8 2e 00 00 	movl   $0x2ec8,0x8(%ebp)
+}
+    18d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    18db:	5b                   	pop    %ebx
+    18dc:	5e                   	pop    %esi
+    18dd:	5f                   	pop    %edi
+    18de:	5d                   	pop    %ebp
+    mutex_unlock(&lock);
+    18df:	e9 9c ea ff ff       	jmp    380 <mutex_unlock>
+    18e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    18e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    drain(tc, c, BATCH);
+    18eb:	89 da                	mov    %ebx,%edx
+    18ed:	b9 10 00 00 00       	mov    $0x10,%ecx
+}
+    18f2:	5b                   	pop    %ebx
+    18f3:	5e                   	pop    %esi
+    18f4:	5f                   	pop    %edi
+    18f5:	5d                   	pop    %ebp
+    drain(tc, c, BATCH);
+    18f6:	e9 05 fe ff ff       	jmp    1700 <drain>
+    18fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    18ff:	90                   	nop
+  if(threaded)
+    1900:	8b 15 c4 2e 00 00    	mov    0x2ec4,%edx
+    1906:	85 d2                	test   %edx,%edx
+    1908:	75 28                	jne    1932 <free+0xf2>
+    bp->s.ptr = small[c];
+    190a:	8b 04 9d 20 2f 00 00 	mov    0x2f20(,%ebx,4),%eax
+    1911:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1914:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1917:	89 04 9d 20 2f 00 00 	mov    %eax,0x2f20(,%ebx,4)
+  if(threaded)
+    191e:	eb 81                	jmp    18a1 <free+0x61>
+    mutex_lock(&lock);
+    1920:	83 ec 0c             	sub    $0xc,%esp
+    1923:	68 c8 2e 00 00       	push   $0x2ec8
+    1928:	e8 03 ea ff ff       	call   330 <mutex_lock>
+}
+    192d:	83 c4 10             	add    $0x10,%esp
+    1930:	eb 88                	jmp    18ba <free+0x7a>
+    mutex_lock(&lock);
+    1932:	83 ec 0c             	sub    $0xc,%esp
+    1935:	68 c8 2e 00 00       	push   $0x2ec8
+    193a:	e8 f1 e9 ff ff       	call   330 <mutex_lock>
+    bp->s.ptr = small[c];
+    193f:	8b 04 9d 20 2f 00 00 	mov    0x2f20(,%ebx,4),%eax
+  if(threaded)
+    1946:	83 c4 10             	add    $0x10,%esp
+    bp->s.ptr = small[c];
+    1949:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    194c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    194f:	89 04 9d 20 2f 00 00 	mov    %eax,0x2f20(,%ebx,4)
+  if(threaded)
+    1956:	a1 c4 2e 00 00       	mov    0x2ec4,%eax
+    195b:	85 c0                	test   %eax,%eax
+    195d:	0f 85 6e ff ff ff    	jne    18d1 <free+0x91>
+    1963:	e9 39 ff ff ff       	jmp    18a1 <free+0x61>
+    1968:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    196f:	90                   	nop
+
+00001970 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1970:	55                   	push   %ebp
+    1971:	89 e5                	mov    %esp,%ebp
+    1973:	57                   	push   %edi
+    1974:	56                   	push   %esi
+    1975:	53                   	push   %ebx
+    1976:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  struct tcache *tc;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1979:	8b 45 08             	mov    0x8(%ebp),%eax
+    197c:	8d 78 07             	lea    0x7(%eax),%edi
+    197f:	c1 ef 03             	shr    $0x3,%edi
+    1982:	83 c7 01             	add    $0x1,%edi
+  if(nunits > SMALLMAX / sizeof(Header)){
+    1985:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+    198b:	77 5b                	ja     19e8 <malloc+0x78>
+    acquire();
+    p = bigalloc(nunits);
+    release();
+    return p ? (void*)(p + 1) : 0;
+  }
+  for(c = 0; (2 << c) < nunits; c++)
+    198d:	31 c9                	xor    %ecx,%ecx
+    198f:	b8 02 00 00 00       	mov    $0x2,%eax
+    1994:	be 02 00 00 00       	mov    $0x2,%esi
+    1999:	bb 02 00 00 00       	mov    $0x2,%ebx
+    199e:	83 ff 02             	cmp    $0x2,%edi
+    19a1:	76 12                	jbe    19b5 <malloc+0x45>
+    19a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    19a7:	90                   	nop
+    19a8:	83 c1 01             	add    $0x1,%ecx
+    19ab:	89 c3                	mov    %eax,%ebx
+    19ad:	d3 e3                	shl    %cl,%ebx
+    19af:	89 de                	mov    %ebx,%esi
+    19b1:	39 fb                	cmp    %edi,%ebx
+    19b3:	72 f3                	jb     19a8 <malloc+0x38>
+    19b5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    ;
+  if((tc = mycache()) == 0)
+    19b8:	e8 d3 fd ff ff       	call   1790 <mycache>
+    19bd:	85 c0                	test   %eax,%eax
+    19bf:	74 51                	je     1a12 <malloc+0xa2>
+    return 0;
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    19c1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    19c4:	8d 3c 88             	lea    (%eax,%ecx,4),%edi
+    19c7:	8b 07                	mov    (%edi),%eax
+    19c9:	85 c0                	test   %eax,%eax
+    19cb:	74 53                	je     1a20 <malloc+0xb0>
+    return 0;
+  p = tc->list[c];
+  tc->list[c] = p->s.ptr;
+  tc->n[c]--;
+    19cd:	8b 57 20             	mov    0x20(%edi),%edx
+  tc->list[c] = p->s.ptr;
+    19d0:	8b 08                	mov    (%eax),%ecx
+  tc->n[c]--;
+    19d2:	83 ea 01             	sub    $0x1,%edx
+  return (void*)(p + 1);
+    19d5:	83 c0 08             	add    $0x8,%eax
+  tc->n[c]--;
+    19d8:	89 57 20             	mov    %edx,0x20(%edi)
+  tc->list[c] = p->s.ptr;
+    19db:	89 0f                	mov    %ecx,(%edi)
+}
+    19dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19e0:	5b                   	pop    %ebx
+    19e1:	5e                   	pop    %esi
+    19e2:	5f                   	pop    %edi
+    19e3:	5d                   	pop    %ebp
+    19e4:	c3                   	ret
+    19e5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    19e8:	a1 c4 2e 00 00       	mov    0x2ec4,%eax
+    19ed:	85 c0                	test   %eax,%eax
+    19ef:	0f 85 b3 00 00 00    	jne    1aa8 <malloc+0x138>
+    p = bigalloc(nunits);
+    19f5:	89 f8                	mov    %edi,%eax
+    19f7:	e8 14 fc ff ff       	call   1610 <bigalloc>
+    19fc:	89 c3                	mov    %eax,%ebx
+  if(threaded)
+    19fe:	a1 c4 2e 00 00       	mov    0x2ec4,%eax
+    1a03:	85 c0                	test   %eax,%eax
+    1a05:	0f 85 85 00 00 00    	jne    1a90 <malloc+0x120>
+    return p ? (void*)(p + 1) : 0;
+    1a0b:	8d 43 08             	lea    0x8(%ebx),%eax
+    1a0e:	85 db                	test   %ebx,%ebx
+    1a10:	75 cb                	jne    19dd <malloc+0x6d>
+    1a12:	31 c0                	xor    %eax,%eax
+}
+    1a14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a17:	5b                   	pop    %ebx
+    1a18:	5e                   	pop    %esi
+    1a19:	5f                   	pop    %edi
+    1a1a:	5d                   	pop    %ebp
+    1a1b:	c3                   	ret
+    1a1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1a20:	a1 c4 2e 00 00       	mov    0x2ec4,%eax
+    1a25:	85 c0                	test   %eax,%eax
+    1a27:	0f 85 29 01 00 00    	jne    1b56 <malloc+0x1e6>
+  if(small[c] == 0){
+    1a2d:	8b 04 8d 20 2f 00 00 	mov    0x2f20(,%ecx,4),%eax
+    1a34:	85 c0                	test   %eax,%eax
+    1a36:	0f 84 81 00 00 00    	je     1abd <malloc+0x14d>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1a3c:	31 db                	xor    %ebx,%ebx
+    1a3e:	eb 22                	jmp    1a62 <malloc+0xf2>
+    small[c] = p->s.ptr;
+    1a40:	8b 10                	mov    (%eax),%edx
+  for(moved = 0; moved < n && small[c]; moved++){
+    1a42:	83 c3 01             	add    $0x1,%ebx
+    small[c] = p->s.ptr;
+    1a45:	89 14 8d 20 2f 00 00 	mov    %edx,0x2f20(,%ecx,4)
+    p->s.ptr = tc->list[c];
+    1a4c:	8b 17                	mov    (%edi),%edx
+    1a4e:	89 10                	mov    %edx,(%eax)
+    tc->list[c] = p;
+    1a50:	89 07                	mov    %eax,(%edi)
+  for(moved = 0; moved < n && small[c]; moved++){
+    1a52:	83 fb 10             	cmp    $0x10,%ebx
+    1a55:	0f 84 e2 00 00 00    	je     1b3d <malloc+0x1cd>
+    1a5b:	8b 04 8d 20 2f 00 00 	mov    0x2f20(,%ecx,4),%eax
+    1a62:	85 c0                	test   %eax,%eax
+    1a64:	75 da                	jne    1a40 <malloc+0xd0>
+  if(threaded)
+    1a66:	8b 15 c4 2e 00 00    	mov    0x2ec4,%edx
+    1a6c:	85 d2                	test   %edx,%edx
+    1a6e:	0f 85 b4 00 00 00    	jne    1b28 <malloc+0x1b8>
+  tc->n[c] += moved;
+    1a74:	8b 57 20             	mov    0x20(%edi),%edx
+    1a77:	01 da                	add    %ebx,%edx
+    1a79:	89 57 20             	mov    %edx,0x20(%edi)
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1a7c:	85 db                	test   %ebx,%ebx
+    1a7e:	74 92                	je     1a12 <malloc+0xa2>
+  p = tc->list[c];
+    1a80:	8b 07                	mov    (%edi),%eax
+    1a82:	e9 49 ff ff ff       	jmp    19d0 <malloc+0x60>
+    1a87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a8e:	66 90                	xchg   %ax,%ax
+    mutex_unlock(&lock);
+    1a90:	83 ec 0c             	sub    $0xc,%esp
+    1a93:	68 c8 2e 00 00       	push   $0x2ec8
+    1a98:	e8 e3 e8 ff ff       	call   380 <mutex_unlock>
+}
+    1a9d:	83 c4 10             	add    $0x10,%esp
+    1aa0:	e9 66 ff ff ff       	jmp    1a0b <malloc+0x9b>
+    1aa5:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1aa8:	83 ec 0c             	sub    $0xc,%esp
+    1aab:	68 c8 2e 00 00       	push   $0x2ec8
+    1ab0:	e8 7b e8 ff ff       	call   330 <mutex_lock>
+}
+    1ab5:	83 c4 10             	add    $0x10,%esp
+    1ab8:	e9 38 ff ff ff       	jmp    19f5 <malloc+0x85>
+    if((chunk = bigalloc(CHUNK / sizeof(Header) + 1)) == 0){
+    1abd:	b8 01 02 00 00       	mov    $0x201,%eax
+    1ac2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1ac5:	e8 46 fb ff ff       	call   1610 <bigalloc>
+    1aca:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1acd:	85 c0                	test   %eax,%eax
+    1acf:	89 c2                	mov    %eax,%edx
+    1ad1:	0f 84 ba 00 00 00    	je     1b91 <malloc+0x221>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1ad7:	83 c2 08             	add    $0x8,%edx
+    1ada:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+    1ae0:	0f 87 d0 00 00 00    	ja     1bb6 <malloc+0x246>
+    1ae6:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+    1aed:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    1af0:	89 df                	mov    %ebx,%edi
+    1af2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1af5:	8d 76 00             	lea    0x0(%esi),%esi
+      p->s.size = units;
+    1af8:	89 72 04             	mov    %esi,0x4(%edx)
+      p->s.ptr = small[c];
+    1afb:	8b 04 8d 20 2f 00 00 	mov    0x2f20(,%ecx,4),%eax
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1b02:	01 df                	add    %ebx,%edi
+    1b04:	89 55 e0             	mov    %edx,-0x20(%ebp)
+      p->s.ptr = small[c];
+    1b07:	89 02                	mov    %eax,(%edx)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1b09:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      small[c] = p;
+    1b0c:	89 14 8d 20 2f 00 00 	mov    %edx,0x2f20(,%ecx,4)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1b13:	01 c2                	add    %eax,%edx
+    1b15:	81 ff 00 02 00 00    	cmp    $0x200,%edi
+    1b1b:	76 db                	jbe    1af8 <malloc+0x188>
+    1b1d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1b20:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1b23:	e9 14 ff ff ff       	jmp    1a3c <malloc+0xcc>
+    mutex_unlock(&lock);
+    1b28:	83 ec 0c             	sub    $0xc,%esp
+    1b2b:	68 c8 2e 00 00       	push   $0x2ec8
+    1b30:	e8 4b e8 ff ff       	call   380 <mutex_unlock>
+}
+    1b35:	83 c4 10             	add    $0x10,%esp
+    1b38:	e9 37 ff ff ff       	jmp    1a74 <malloc+0x104>
+  if(threaded)
+    1b3d:	a1 c4 2e 00 00       	mov    0x2ec4,%eax
+    1b42:	85 c0                	test   %eax,%eax
+    1b44:	75 2b                	jne    1b71 <malloc+0x201>
+  tc->n[c] += moved;
+    1b46:	8b 47 20             	mov    0x20(%edi),%eax
+    1b49:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1b4c:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1b4e:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1b51:	e9 7a fe ff ff       	jmp    19d0 <malloc+0x60>
+    mutex_lock(&lock);
+    1b56:	83 ec 0c             	sub    $0xc,%esp
+    1b59:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1b5c:	68 c8 2e 00 00       	push   $0x2ec8
+    1b61:	e8 ca e7 ff ff       	call   330 <mutex_lock>
+}
+    1b66:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1b69:	83 c4 10             	add    $0x10,%esp
+    1b6c:	e9 bc fe ff ff       	jmp    1a2d <malloc+0xbd>
+    mutex_unlock(&lock);
+    1b71:	83 ec 0c             	sub    $0xc,%esp
+    1b74:	68 c8 2e 00 00       	push   $0x2ec8
+    1b79:	e8 02 e8 ff ff       	call   380 <mutex_unlock>
+  tc->n[c] += moved;
+    1b7e:	8b 47 20             	mov    0x20(%edi),%eax
+    1b81:	83 c4 10             	add    $0x10,%esp
+    1b84:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1b87:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1b89:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1b8c:	e9 3f fe ff ff       	jmp    19d0 <malloc+0x60>
+  if(threaded)
+    1b91:	8b 0d c4 2e 00 00    	mov    0x2ec4,%ecx
+    1b97:	85 c9                	test   %ecx,%ecx
+    1b99:	0f 84 73 fe ff ff    	je     1a12 <malloc+0xa2>
+    mutex_unlock(&lock);
+    1b9f:	83 ec 0c             	sub    $0xc,%esp
+    1ba2:	68 c8 2e 00 00       	push   $0x2ec8
+    1ba7:	e8 d4 e7 ff ff       	call   380 <mutex_unlock>
+    1bac:	83 c4 10             	add    $0x10,%esp
+    return p ? (void*)(p + 1) : 0;
+    1baf:	31 c0                	xor    %eax,%eax
+    1bb1:	e9 5e fe ff ff       	jmp    1a14 <malloc+0xa4>
+  for(moved = 0; moved < n && small[c]; moved++){
+    1bb6:	8b 04 8d 20 2f 00 00 	mov    0x2f20(,%ecx,4),%eax
+    1bbd:	e9 7a fe ff ff       	jmp    1a3c <malloc+0xcc>
+    1bc2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001bd0 <malloc_threaded>:
+void
+malloc_threaded(void)
+{
+  uint sp;
+
+  if(threaded)
+    1bd0:	a1 c4 2e 00 00       	mov    0x2ec4,%eax
+    1bd5:	85 c0                	test   %eax,%eax
+    1bd7:	74 07                	je     1be0 <malloc_threaded+0x10>
+    1bd9:	c3                   	ret
+    1bda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+{
+    1be0:	55                   	push   %ebp
+    1be1:	89 e5                	mov    %esp,%ebp
+    1be3:	83 ec 24             	sub    $0x24,%esp
+    return;
+  mutex_init(&lock);
+    1be6:	68 c8 2e 00 00       	push   $0x2ec8
+    1beb:	e8 30 e7 ff ff       	call   320 <mutex_init>
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1bf0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1bf3:	83 c4 10             	add    $0x10,%esp
+  threaded = 1;
+    1bf6:	c7 05 c4 2e 00 00 01 	movl   $0x1,0x2ec4
+    1bfd:	00 00 00 
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1c00:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    1c05:	a3 c0 2e 00 00       	mov    %eax,0x2ec0
+}
+    1c0a:	c9                   	leave
+    1c0b:	c3                   	ret
+    1c0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001c10 <malloc_thread_exit>:
+
+// Called by thread_join() with the cache slot of a finished
+// thread: give its blocks, and the cache itself, back.
+void
+malloc_thread_exit(void **cachep)
+{
+    1c10:	55                   	push   %ebp
+    1c11:	89 e5                	mov    %esp,%ebp
+    1c13:	57                   	push   %edi
+    1c14:	56                   	push   %esi
+    1c15:	53                   	push   %ebx
+    1c16:	83 ec 0c             	sub    $0xc,%esp
+    1c19:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct tcache *tc;
+  int c;
+
+  if((tc = *cachep) == 0)
+    1c1c:	8b 37                	mov    (%edi),%esi
+    1c1e:	85 f6                	test   %esi,%esi
+    1c20:	74 41                	je     1c63 <malloc_thread_exit+0x53>
+    return;
+  for(c = 0; c < NCLASS; c++)
+    1c22:	31 db                	xor    %ebx,%ebx
+    1c24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    drain(tc, c, tc->n[c]);
+    1c28:	8b 4c 9e 20          	mov    0x20(%esi,%ebx,4),%ecx
+    1c2c:	89 da                	mov    %ebx,%edx
+    1c2e:	89 f0                	mov    %esi,%eax
+  for(c = 0; c < NCLASS; c++)
+    1c30:	83 c3 01             	add    $0x1,%ebx
+    drain(tc, c, tc->n[c]);
+    1c33:	e8 c8 fa ff ff       	call   1700 <drain>
+  for(c = 0; c < NCLASS; c++)
+    1c38:	83 fb 08             	cmp    $0x8,%ebx
+    1c3b:	75 eb                	jne    1c28 <malloc_thread_exit+0x18>
+  if(threaded)
+    1c3d:	8b 15 c4 2e 00 00    	mov    0x2ec4,%edx
+    1c43:	85 d2                	test   %edx,%edx
+    1c45:	75 29                	jne    1c70 <malloc_thread_exit+0x60>
+  acquire();
+  trim(bigfree((Header*)tc - 1));
+    1c47:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1c4a:	e8 c1 f8 ff ff       	call   1510 <bigfree>
+    1c4f:	e8 3c f9 ff ff       	call   1590 <trim>
+  if(threaded)
+    1c54:	a1 c4 2e 00 00       	mov    0x2ec4,%eax
+    1c59:	85 c0                	test   %eax,%eax
+    1c5b:	75 2b                	jne    1c88 <malloc_thread_exit+0x78>
+  release();
+  *cachep = 0;
+    1c5d:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+}
+    1c63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c66:	5b                   	pop    %ebx
+    1c67:	5e                   	pop    %esi
+    1c68:	5f                   	pop    %edi
+    1c69:	5d                   	pop    %ebp
+    1c6a:	c3                   	ret
+    1c6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1c6f:	90                   	nop
+    mutex_lock(&lock);
+    1c70:	83 ec 0c             	sub    $0xc,%esp
+    1c73:	68 c8 2e 00 00       	push   $0x2ec8
+    1c78:	e8 b3 e6 ff ff       	call   330 <mutex_lock>
+}
+    1c7d:	83 c4 10             	add    $0x10,%esp
+    1c80:	eb c5                	jmp    1c47 <malloc_thread_exit+0x37>
+    1c82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1c88:	83 ec 0c             	sub    $0xc,%esp
+    1c8b:	68 c8 2e 00 00       	push   $0x2ec8
+    1c90:	e8 eb e6 ff ff       	call   380 <mutex_unlock>
+}
+    1c95:	83 c4 10             	add    $0x10,%esp
+    1c98:	eb c3                	jmp    1c5d <malloc_thread_exit+0x4d>
+    1c9a:	66 90                	xchg   %ax,%ax
+    1c9c:	66 90                	xchg   %ax,%ax
+    1c9e:	66 90                	xchg   %ax,%ax
+
+00001ca0 <thread_create>:
+
+// Start fn(arg) in a new thread on a freshly allocated
+// page-aligned stack.  Returns the thread's pid.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1ca0:	55                   	push   %ebp
+    1ca1:	89 e5                	mov    %esp,%ebp
+    1ca3:	53                   	push   %ebx
+    1ca4:	83 ec 14             	sub    $0x14,%esp
+  char *mem, *stack;
+  int pid;
+
+  malloc_threaded();
+    1ca7:	e8 24 ff ff ff       	call   1bd0 <malloc_threaded>
+  stdio_threaded();
+    1cac:	e8 cf ee ff ff       	call   b80 <stdio_threaded>
+  if((mem = malloc(2*PGSIZE)) == 0)
+    1cb1:	83 ec 0c             	sub    $0xc,%esp
+    1cb4:	68 00 20 00 00       	push   $0x2000
+    1cb9:	e8 b2 fc ff ff       	call   1970 <malloc>
+    1cbe:	83 c4 10             	add    $0x10,%esp
+    1cc1:	85 c0                	test   %eax,%eax
+    1cc3:	74 52                	je     1d17 <thread_create+0x77>
+    1cc5:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1cc7:	8d 80 07 10 00 00    	lea    0x1007(%eax),%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+  ((char**)stack)[-2] = 0;
+  if((pid = clone(fn, arg, stack)) < 0)
+    1ccd:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1cd0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+    1cd5:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  ((char**)stack)[-2] = 0;
+    1cd8:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+  if((pid = clone(fn, arg, stack)) < 0)
+    1cdf:	50                   	push   %eax
+    1ce0:	ff 75 0c             	push   0xc(%ebp)
+    1ce3:	ff 75 08             	push   0x8(%ebp)
+    1ce6:	e8 97 e8 ff ff       	call   582 <clone>
+    1ceb:	83 c4 10             	add    $0x10,%esp
+    1cee:	85 c0                	test   %eax,%eax
+    1cf0:	78 0e                	js     1d00 <thread_create+0x60>
+    free(mem);
+  return pid;
+}
+    1cf2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1cf5:	c9                   	leave
+    1cf6:	c3                   	ret
+    1cf7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1cfe:	66 90                	xchg   %ax,%ax
+    free(mem);
+    1d00:	83 ec 0c             	sub    $0xc,%esp
+    1d03:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1d06:	53                   	push   %ebx
+    1d07:	e8 34 fb ff ff       	call   1840 <free>
+    1d0c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1d0f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    1d12:	83 c4 10             	add    $0x10,%esp
+}
+    1d15:	c9                   	leave
+    1d16:	c3                   	ret
+    return -1;
+    1d17:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1d1c:	eb d4                	jmp    1cf2 <thread_create+0x52>
+    1d1e:	66 90                	xchg   %ax,%ax
+
+00001d20 <thread_join>:
+
+// Wait for a thread to finish and free its stack.
+int
+thread_join(void)
+{
+    1d20:	55                   	push   %ebp
+    1d21:	89 e5                	mov    %esp,%ebp
+    1d23:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    1d24:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    1d27:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    1d2a:	50                   	push   %eax
+    1d2b:	e8 61 e8 ff ff       	call   591 <join>
+    1d30:	83 c4 10             	add    $0x10,%esp
+    1d33:	85 c0                	test   %eax,%eax
+    1d35:	78 29                	js     1d60 <thread_join+0x40>
+    1d37:	89 c3                	mov    %eax,%ebx
+    return -1;
+  malloc_thread_exit(&((void**)stack)[-2]);
+    1d39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1d3c:	83 ec 0c             	sub    $0xc,%esp
+    1d3f:	83 e8 08             	sub    $0x8,%eax
+    1d42:	50                   	push   %eax
+    1d43:	e8 c8 fe ff ff       	call   1c10 <malloc_thread_exit>
+  free(((char**)stack)[-1]);
+    1d48:	58                   	pop    %eax
+    1d49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1d4c:	ff 70 fc             	push   -0x4(%eax)
+    1d4f:	e8 ec fa ff ff       	call   1840 <free>
+  return pid;
+    1d54:	83 c4 10             	add    $0x10,%esp
+}
+    1d57:	89 d8                	mov    %ebx,%eax
+    1d59:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1d5c:	c9                   	leave
+    1d5d:	c3                   	ret
+    1d5e:	66 90                	xchg   %ax,%ax
+    return -1;
+    1d60:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    1d65:	eb f0                	jmp    1d57 <thread_join+0x37>
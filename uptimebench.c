@@ -0,0 +1,43 @@
+// uptime() benchmark.
+// Times N uptime() calls, which read the vdso page, against the
+// same number of SYS_uptime system calls through int $T_SYSCALL.
+// Calls per second assume the default 100 ticks per second.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "syscall.h"
+#include "traps.h"
+
+#define N 1000000
+
+int
+uptimeint(void)
+{
+  int r;
+
+  asm volatile("int %1" : "=a" (r) : "i" (T_SYSCALL), "a" (SYS_uptime) : "memory");
+  return r;
+}
+
+void
+run(char *name, int (*fn)(void))
+{
+  int i, t;
+
+  t = uptime();
+  for(i = 0; i < N; i++)
+    fn();
+  t = uptime() - t;
+  if(t == 0)
+    t = 1;
+  printf(1, "%s: %d calls in %d ticks, %d calls/s\n", name, N, t, N / t * 100);
+}
+
+int
+main(void)
+{
+  run("vdso", uptime);
+  run("syscall", uptimeint);
+  exit();
+}
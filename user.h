@@ -1,5 +1,50 @@
 struct stat;
 struct rtcdate;
+struct lockstat;
+struct ring;
+struct sample;
+struct scstat;
+struct iovec;
+
+// User-level locks built on futex(); see ulib.c.
+struct mutex {
+  volatile uint val;  // 0 unlocked, 1 locked, 2 locked with waiters
+};
+
+struct cond {
+  volatile uint seq;  // bumped by every signal
+};
+
+// A buffered stream; see stdio.c.
+struct iobuf {
+  int fd;
+  int flags;
+  char *buf;
+  int size;
+  int r;              // next byte to read from buf
+  int n;              // bytes in buf
+  struct mutex lock;  // once threads exist; see flockfile()
+};
+
+typedef struct iobuf FILE;
+
+// iobuf flags
+#define IO_READ    0x01
+#define IO_WRITE   0x02
+#define IO_EOF     0x04
+#define IO_ERR     0x08
+#define IO_LINE    0x10   // flush output at each newline
+#define IO_DEV     0x20   // fd is a device
+#define IO_SETUP   0x40   // IO_DEV and IO_LINE decided
+#define IO_MALLOC  0x80   // buf from malloc()
+
+#define BUFSIZ  512
+#define EOF     (-1)
+
+extern struct iobuf _iob[];
+#define stdin   (&_iob[0])
+#define stdout  (&_iob[1])
+#define stderr  (&_iob[2])
 
 // system calls
 int fork(void);
@@ -23,17 +68,63 @@ int getpid(void);
 char* sbrk(int);
 int sleep(int);
 int uptime(void);
+int clone(void(*)(void*), void*, void*);
+int join(void**);
+int futex(volatile uint*, int, int);
+int yield(void);
+int lockstat(struct lockstat*, int);
+int lockhammer(int, int);
+int vmsplice(int, void*, int);
+char* hsbrk(int);
+void* mmap(void*, int, int, int, int, int);
+int munmap(void*, int);
+int ringenter(struct ring*, int);
+int readv(int, struct iovec*, int);
+int writev(int, struct iovec*, int);
+int pread(int, void*, int, int);
+int pwrite(int, const void*, int, int);
+int prof(int, struct sample*, int);
+int scstat(int, struct scstat*, int);
 
 // ulib.c
+extern void (*flushhook)(void);
 int stat(const char*, struct stat*);
 char* strcpy(char*, const char*);
 void *memmove(void*, const void*, int);
 char* strchr(const char*, char c);
 int strcmp(const char*, const char*);
 void printf(int, const char*, ...);
-char* gets(char*, int max);
 uint strlen(const char*);
 void* memset(void*, int, uint);
 void* malloc(uint);
 void free(void*);
+void malloc_threaded(void);
+void malloc_thread_exit(void**);
 int atoi(const char*);
+int thread_create(void(*)(void*), void*);
+int thread_join(void);
+void mutex_init(struct mutex*);
+void mutex_lock(struct mutex*);
+void mutex_unlock(struct mutex*);
+void cond_init(struct cond*);
+void cond_wait(struct cond*, struct mutex*);
+void cond_signal(struct cond*);
+void cond_broadcast(struct cond*);
+
+// printf.c
+void fprintf(FILE*, const char*, ...);
+
+// stdio.c
+FILE* fopen(const char*, const char*);
+int fclose(FILE*);
+int fflush(FILE*);
+int fputc(int, FILE*);
+int fgetc(FILE*);
+int fwrite(const void*, int, int, FILE*);
+int fread(void*, int, int, FILE*);
+char* fgets(char*, int, FILE*);
+char* gets(char*, int max);
+void flockfile(FILE*);
+void funlockfile(FILE*);
+int putc_unlocked(int, FILE*);
+void stdio_threaded(void);
@@ -0,0 +1,10947 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return randstate;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+      11:	68 7d 76 00 00       	push   $0x767d
+      16:	6a 01                	push   $0x1
+      18:	e8 d3 4e 00 00       	call   4ef0 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+      1d:	59                   	pop    %ecx
+      1e:	58                   	pop    %eax
+      1f:	6a 00                	push   $0x0
+      21:	68 91 76 00 00       	push   $0x7691
+      26:	e8 c2 4a 00 00       	call   4aed <open>
+      2b:	83 c4 10             	add    $0x10,%esp
+      2e:	85 c0                	test   %eax,%eax
+      30:	78 13                	js     45 <main+0x45>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+      32:	52                   	push   %edx
+      33:	52                   	push   %edx
+      34:	68 c8 7f 00 00       	push   $0x7fc8
+      39:	6a 01                	push   $0x1
+      3b:	e8 b0 4e 00 00       	call   4ef0 <printf>
+    exit();
+      40:	e8 eb 46 00 00       	call   4730 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+      45:	50                   	push   %eax
+      46:	50                   	push   %eax
+      47:	68 00 02 00 00       	push   $0x200
+      4c:	68 91 76 00 00       	push   $0x7691
+      51:	e8 97 4a 00 00       	call   4aed <open>
+      56:	89 04 24             	mov    %eax,(%esp)
+      59:	e8 62 4a 00 00       	call   4ac0 <close>
+
+  argptest();
+      5e:	e8 dd 45 00 00       	call   4640 <argptest>
+  createdelete();
+      63:	e8 d8 12 00 00       	call   1340 <createdelete>
+  linkunlink();
+      68:	e8 73 1b 00 00       	call   1be0 <linkunlink>
+  concreate();
+      6d:	e8 6e 18 00 00       	call   18e0 <concreate>
+  fourfiles();
+      72:	e8 c9 10 00 00       	call   1140 <fourfiles>
+  sharedfd();
+      77:	e8 04 0f 00 00       	call   f80 <sharedfd>
+
+  bigargtest();
+      7c:	e8 7f 42 00 00       	call   4300 <bigargtest>
+  bigwrite();
+      81:	e8 7a 24 00 00       	call   2500 <bigwrite>
+  bigargtest();
+      86:	e8 75 42 00 00       	call   4300 <bigargtest>
+  bsstest();
+      8b:	e8 00 42 00 00       	call   4290 <bsstest>
+  sbrktest();
+      90:	e8 ab 2d 00 00       	call   2e40 <sbrktest>
+  hsbrktest();
+      95:	e8 f6 31 00 00       	call   3290 <hsbrktest>
+  validatetest();
+      9a:	e8 41 41 00 00       	call   41e0 <validatetest>
+
+  opentest();
+      9f:	e8 6c 04 00 00       	call   510 <opentest>
+  writetest();
+      a4:	e8 f7 04 00 00       	call   5a0 <writetest>
+  writetest1();
+      a9:	e8 d2 06 00 00       	call   780 <writetest1>
+  createtest();
+      ae:	e8 9d 08 00 00       	call   950 <createtest>
+
+  openiputtest();
+      b3:	e8 58 03 00 00       	call   410 <openiputtest>
+  exitiputtest();
+      b8:	e8 53 02 00 00       	call   310 <exitiputtest>
+  iputtest();
+      bd:	e8 6e 01 00 00       	call   230 <iputtest>
+
+  mem();
+      c2:	e8 e9 0d 00 00       	call   eb0 <mem>
+  pipe1();
+      c7:	e8 64 0a 00 00       	call   b30 <pipe1>
+  threadtest();
+      cc:	e8 1f 33 00 00       	call   33f0 <threadtest>
+  mmaptest();
+      d1:	e8 3a 34 00 00       	call   3510 <mmaptest>
+  mmapthreadtest();
+      d6:	e8 05 38 00 00       	call   38e0 <mmapthreadtest>
+  mmapsharedtest();
+      db:	e8 00 36 00 00       	call   36e0 <mmapsharedtest>
+  ringtest();
+      e0:	e8 cb 38 00 00       	call   39b0 <ringtest>
+  uiotest();
+      e5:	e8 66 3a 00 00       	call   3b50 <uiotest>
+  stdiotest();
+      ea:	e8 61 3b 00 00       	call   3c50 <stdiotest>
+  fputest();
+      ef:	e8 dc 3e 00 00       	call   3fd0 <fputest>
+  proftest();
+      f4:	e8 f7 3c 00 00       	call   3df0 <proftest>
+  scstattest();
+      f9:	e8 02 3e 00 00       	call   3f00 <scstattest>
+  preempt();
+      fe:	e8 cd 0b 00 00       	call   cd0 <preempt>
+  exitwait();
+     103:	e8 28 0d 00 00       	call   e30 <exitwait>
+
+  rmdot();
+     108:	e8 e3 27 00 00       	call   28f0 <rmdot>
+  fourteen();
+     10d:	e8 9e 26 00 00       	call   27b0 <fourteen>
+  bigfile();
+     112:	e8 c9 24 00 00       	call   25e0 <bigfile>
+  subdir();
+     117:	e8 04 1d 00 00       	call   1e20 <subdir>
+  linktest();
+     11c:	e8 af 15 00 00       	call   16d0 <linktest>
+  unlinkread();
+     121:	e8 1a 14 00 00       	call   1540 <unlinkread>
+  dirfile();
+     126:	e8 45 29 00 00       	call   2a70 <dirfile>
+  iref();
+     12b:	e8 40 2b 00 00       	call   2c70 <iref>
+  forktest();
+     130:	e8 5b 2c 00 00       	call   2d90 <forktest>
+  bigdir(); // slow
+     135:	e8 b6 1b 00 00       	call   1cf0 <bigdir>
+
+  uio();
+     13a:	e8 91 44 00 00       	call   45d0 <uio>
+
+  exectest();
+     13f:	e8 9c 09 00 00       	call   ae0 <exectest>
+
+  exit();
+     144:	e8 e7 45 00 00       	call   4730 <exit>
+     149:	66 90                	xchg   %ax,%ax
+     14b:	66 90                	xchg   %ax,%ax
+     14d:	66 90                	xchg   %ax,%ax
+     14f:	90                   	nop
+
+00000150 <threadworker>:
+{
+     150:	55                   	push   %ebp
+     151:	89 e5                	mov    %esp,%ebp
+     153:	56                   	push   %esi
+     154:	53                   	push   %ebx
+     155:	8b 75 08             	mov    0x8(%ebp),%esi
+  me = (int)arg;
+     158:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+     15d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&tmu);
+     160:	83 ec 0c             	sub    $0xc,%esp
+     163:	68 40 ba 00 00       	push   $0xba40
+     168:	e8 d3 47 00 00       	call   4940 <mutex_lock>
+    tcount++;
+     16d:	a1 38 ba 00 00       	mov    0xba38,%eax
+    mutex_unlock(&tmu);
+     172:	c7 04 24 40 ba 00 00 	movl   $0xba40,(%esp)
+    tcount++;
+     179:	83 c0 01             	add    $0x1,%eax
+     17c:	a3 38 ba 00 00       	mov    %eax,0xba38
+    mutex_unlock(&tmu);
+     181:	e8 0a 48 00 00       	call   4990 <mutex_unlock>
+  for(i = 0; i < 1000; i++){
+     186:	83 c4 10             	add    $0x10,%esp
+     189:	83 eb 01             	sub    $0x1,%ebx
+     18c:	75 d2                	jne    160 <threadworker+0x10>
+  mutex_lock(&tmu);
+     18e:	83 ec 0c             	sub    $0xc,%esp
+     191:	68 40 ba 00 00       	push   $0xba40
+     196:	e8 a5 47 00 00       	call   4940 <mutex_lock>
+  while(tturn != me)
+     19b:	a1 34 ba 00 00       	mov    0xba34,%eax
+     1a0:	83 c4 10             	add    $0x10,%esp
+     1a3:	39 c6                	cmp    %eax,%esi
+     1a5:	74 27                	je     1ce <threadworker+0x7e>
+     1a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ae:	66 90                	xchg   %ax,%ax
+    cond_wait(&tcond, &tmu);
+     1b0:	83 ec 08             	sub    $0x8,%esp
+     1b3:	68 40 ba 00 00       	push   $0xba40
+     1b8:	68 3c ba 00 00       	push   $0xba3c
+     1bd:	e8 0e 48 00 00       	call   49d0 <cond_wait>
+  while(tturn != me)
+     1c2:	a1 34 ba 00 00       	mov    0xba34,%eax
+     1c7:	83 c4 10             	add    $0x10,%esp
+     1ca:	39 f0                	cmp    %esi,%eax
+     1cc:	75 e2                	jne    1b0 <threadworker+0x60>
+  cond_broadcast(&tcond);
+     1ce:	83 ec 0c             	sub    $0xc,%esp
+  tturn++;
+     1d1:	a1 34 ba 00 00       	mov    0xba34,%eax
+  cond_broadcast(&tcond);
+     1d6:	68 3c ba 00 00       	push   $0xba3c
+  tturn++;
+     1db:	83 c0 01             	add    $0x1,%eax
+     1de:	a3 34 ba 00 00       	mov    %eax,0xba34
+  cond_broadcast(&tcond);
+     1e3:	e8 58 48 00 00       	call   4a40 <cond_broadcast>
+  mutex_unlock(&tmu);
+     1e8:	c7 04 24 40 ba 00 00 	movl   $0xba40,(%esp)
+     1ef:	e8 9c 47 00 00       	call   4990 <mutex_unlock>
+  exit();
+     1f4:	e8 37 45 00 00       	call   4730 <exit>
+     1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <mmapthread>:
+{
+     200:	55                   	push   %ebp
+     201:	89 e5                	mov    %esp,%ebp
+     203:	83 ec 10             	sub    $0x10,%esp
+  tmap = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+     206:	6a 00                	push   $0x0
+     208:	6a ff                	push   $0xffffffff
+     20a:	6a 06                	push   $0x6
+     20c:	6a 03                	push   $0x3
+     20e:	68 00 10 00 00       	push   $0x1000
+     213:	6a 00                	push   $0x0
+     215:	e8 f0 49 00 00       	call   4c0a <mmap>
+  if(tmap != (char*)-1)
+     21a:	83 c4 20             	add    $0x20,%esp
+  tmap = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+     21d:	a3 30 ba 00 00       	mov    %eax,0xba30
+  if(tmap != (char*)-1)
+     222:	83 f8 ff             	cmp    $0xffffffff,%eax
+     225:	74 03                	je     22a <mmapthread+0x2a>
+    tmap[0] = 'x';
+     227:	c6 00 78             	movb   $0x78,(%eax)
+  exit();
+     22a:	e8 01 45 00 00       	call   4730 <exit>
+     22f:	90                   	nop
+
+00000230 <iputtest>:
+{
+     230:	55                   	push   %ebp
+     231:	89 e5                	mov    %esp,%ebp
+     233:	83 ec 10             	sub    $0x10,%esp
+  printf(out, "iput test\n");
+     236:	68 0c 64 00 00       	push   $0x640c
+     23b:	ff 35 24 92 00 00    	push   0x9224
+     241:	e8 aa 4c 00 00       	call   4ef0 <printf>
+  if(mkdir("iputdir") < 0){
+     246:	c7 04 24 9f 63 00 00 	movl   $0x639f,(%esp)
+     24d:	e8 e6 48 00 00       	call   4b38 <mkdir>
+     252:	83 c4 10             	add    $0x10,%esp
+     255:	85 c0                	test   %eax,%eax
+     257:	78 58                	js     2b1 <iputtest+0x81>
+  if(chdir("iputdir") < 0){
+     259:	83 ec 0c             	sub    $0xc,%esp
+     25c:	68 9f 63 00 00       	push   $0x639f
+     261:	e8 e1 48 00 00       	call   4b47 <chdir>
+     266:	83 c4 10             	add    $0x10,%esp
+     269:	85 c0                	test   %eax,%eax
+     26b:	0f 88 85 00 00 00    	js     2f6 <iputtest+0xc6>
+  if(unlink("../iputdir") < 0){
+     271:	83 ec 0c             	sub    $0xc,%esp
+     274:	68 9c 63 00 00       	push   $0x639c
+     279:	e8 8d 48 00 00       	call   4b0b <unlink>
+     27e:	83 c4 10             	add    $0x10,%esp
+     281:	85 c0                	test   %eax,%eax
+     283:	78 5a                	js     2df <iputtest+0xaf>
+  if(chdir("/") < 0){
+     285:	83 ec 0c             	sub    $0xc,%esp
+     288:	68 c1 63 00 00       	push   $0x63c1
+     28d:	e8 b5 48 00 00       	call   4b47 <chdir>
+     292:	83 c4 10             	add    $0x10,%esp
+     295:	85 c0                	test   %eax,%eax
+     297:	78 2f                	js     2c8 <iputtest+0x98>
+  printf(out, "iput test ok\n");
+     299:	83 ec 08             	sub    $0x8,%esp
+     29c:	68 44 64 00 00       	push   $0x6444
+     2a1:	ff 35 24 92 00 00    	push   0x9224
+     2a7:	e8 44 4c 00 00       	call   4ef0 <printf>
+}
+     2ac:	83 c4 10             	add    $0x10,%esp
+     2af:	c9                   	leave
+     2b0:	c3                   	ret
+    printf(out, "mkdir failed\n");
+     2b1:	50                   	push   %eax
+     2b2:	50                   	push   %eax
+     2b3:	68 78 63 00 00       	push   $0x6378
+     2b8:	ff 35 24 92 00 00    	push   0x9224
+     2be:	e8 2d 4c 00 00       	call   4ef0 <printf>
+    exit();
+     2c3:	e8 68 44 00 00       	call   4730 <exit>
+    printf(out, "chdir / failed\n");
+     2c8:	50                   	push   %eax
+     2c9:	50                   	push   %eax
+     2ca:	68 c3 63 00 00       	push   $0x63c3
+     2cf:	ff 35 24 92 00 00    	push   0x9224
+     2d5:	e8 16 4c 00 00       	call   4ef0 <printf>
+    exit();
+     2da:	e8 51 44 00 00       	call   4730 <exit>
+    printf(out, "unlink ../iputdir failed\n");
+     2df:	52                   	push   %edx
+     2e0:	52                   	push   %edx
+     2e1:	68 a7 63 00 00       	push   $0x63a7
+     2e6:	ff 35 24 92 00 00    	push   0x9224
+     2ec:	e8 ff 4b 00 00       	call   4ef0 <printf>
+    exit();
+     2f1:	e8 3a 44 00 00       	call   4730 <exit>
+    printf(out, "chdir iputdir failed\n");
+     2f6:	51                   	push   %ecx
+     2f7:	51                   	push   %ecx
+     2f8:	68 86 63 00 00       	push   $0x6386
+     2fd:	ff 35 24 92 00 00    	push   0x9224
+     303:	e8 e8 4b 00 00       	call   4ef0 <printf>
+    exit();
+     308:	e8 23 44 00 00       	call   4730 <exit>
+     30d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000310 <exitiputtest>:
+{
+     310:	55                   	push   %ebp
+     311:	89 e5                	mov    %esp,%ebp
+     313:	83 ec 10             	sub    $0x10,%esp
+  printf(out, "exitiput test\n");
+     316:	68 d3 63 00 00       	push   $0x63d3
+     31b:	ff 35 24 92 00 00    	push   0x9224
+     321:	e8 ca 4b 00 00       	call   4ef0 <printf>
+  pid = fork();
+     326:	e8 a5 43 00 00       	call   46d0 <fork>
+  if(pid < 0){
+     32b:	83 c4 10             	add    $0x10,%esp
+     32e:	85 c0                	test   %eax,%eax
+     330:	0f 88 8a 00 00 00    	js     3c0 <exitiputtest+0xb0>
+  if(pid == 0){
+     336:	75 50                	jne    388 <exitiputtest+0x78>
+    if(mkdir("iputdir") < 0){
+     338:	83 ec 0c             	sub    $0xc,%esp
+     33b:	68 9f 63 00 00       	push   $0x639f
+     340:	e8 f3 47 00 00       	call   4b38 <mkdir>
+     345:	83 c4 10             	add    $0x10,%esp
+     348:	85 c0                	test   %eax,%eax
+     34a:	0f 88 87 00 00 00    	js     3d7 <exitiputtest+0xc7>
+    if(chdir("iputdir") < 0){
+     350:	83 ec 0c             	sub    $0xc,%esp
+     353:	68 9f 63 00 00       	push   $0x639f
+     358:	e8 ea 47 00 00       	call   4b47 <chdir>
+     35d:	83 c4 10             	add    $0x10,%esp
+     360:	85 c0                	test   %eax,%eax
+     362:	0f 88 86 00 00 00    	js     3ee <exitiputtest+0xde>
+    if(unlink("../iputdir") < 0){
+     368:	83 ec 0c             	sub    $0xc,%esp
+     36b:	68 9c 63 00 00       	push   $0x639c
+     370:	e8 96 47 00 00       	call   4b0b <unlink>
+     375:	83 c4 10             	add    $0x10,%esp
+     378:	85 c0                	test   %eax,%eax
+     37a:	78 2c                	js     3a8 <exitiputtest+0x98>
+    exit();
+     37c:	e8 af 43 00 00       	call   4730 <exit>
+     381:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+     388:	e8 f7 46 00 00       	call   4a84 <wait>
+  printf(out, "exitiput test ok\n");
+     38d:	83 ec 08             	sub    $0x8,%esp
+     390:	68 f6 63 00 00       	push   $0x63f6
+     395:	ff 35 24 92 00 00    	push   0x9224
+     39b:	e8 50 4b 00 00       	call   4ef0 <printf>
+}
+     3a0:	83 c4 10             	add    $0x10,%esp
+     3a3:	c9                   	leave
+     3a4:	c3                   	ret
+     3a5:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(out, "unlink ../iputdir failed\n");
+     3a8:	83 ec 08             	sub    $0x8,%esp
+     3ab:	68 a7 63 00 00       	push   $0x63a7
+     3b0:	ff 35 24 92 00 00    	push   0x9224
+     3b6:	e8 35 4b 00 00       	call   4ef0 <printf>
+      exit();
+     3bb:	e8 70 43 00 00       	call   4730 <exit>
+    printf(out, "fork failed\n");
+     3c0:	51                   	push   %ecx
+     3c1:	51                   	push   %ecx
+     3c2:	68 2e 72 00 00       	push   $0x722e
+     3c7:	ff 35 24 92 00 00    	push   0x9224
+     3cd:	e8 1e 4b 00 00       	call   4ef0 <printf>
+    exit();
+     3d2:	e8 59 43 00 00       	call   4730 <exit>
+      printf(out, "mkdir failed\n");
+     3d7:	52                   	push   %edx
+     3d8:	52                   	push   %edx
+     3d9:	68 78 63 00 00       	push   $0x6378
+     3de:	ff 35 24 92 00 00    	push   0x9224
+     3e4:	e8 07 4b 00 00       	call   4ef0 <printf>
+      exit();
+     3e9:	e8 42 43 00 00       	call   4730 <exit>
+      printf(out, "child chdir failed\n");
+     3ee:	50                   	push   %eax
+     3ef:	50                   	push   %eax
+     3f0:	68 e2 63 00 00       	push   $0x63e2
+     3f5:	ff 35 24 92 00 00    	push   0x9224
+     3fb:	e8 f0 4a 00 00       	call   4ef0 <printf>
+      exit();
+     400:	e8 2b 43 00 00       	call   4730 <exit>
+     405:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     40c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000410 <openiputtest>:
+{
+     410:	55                   	push   %ebp
+     411:	89 e5                	mov    %esp,%ebp
+     413:	83 ec 10             	sub    $0x10,%esp
+  printf(out, "openiput test\n");
+     416:	68 08 64 00 00       	push   $0x6408
+     41b:	ff 35 24 92 00 00    	push   0x9224
+     421:	e8 ca 4a 00 00       	call   4ef0 <printf>
+  if(mkdir("oidir") < 0){
+     426:	c7 04 24 17 64 00 00 	movl   $0x6417,(%esp)
+     42d:	e8 06 47 00 00       	call   4b38 <mkdir>
+     432:	83 c4 10             	add    $0x10,%esp
+     435:	85 c0                	test   %eax,%eax
+     437:	0f 88 9f 00 00 00    	js     4dc <openiputtest+0xcc>
+  pid = fork();
+     43d:	e8 8e 42 00 00       	call   46d0 <fork>
+  if(pid < 0){
+     442:	85 c0                	test   %eax,%eax
+     444:	78 7f                	js     4c5 <openiputtest+0xb5>
+  if(pid == 0){
+     446:	75 38                	jne    480 <openiputtest+0x70>
+    int fd = open("oidir", O_RDWR);
+     448:	83 ec 08             	sub    $0x8,%esp
+     44b:	6a 02                	push   $0x2
+     44d:	68 17 64 00 00       	push   $0x6417
+     452:	e8 96 46 00 00       	call   4aed <open>
+    if(fd >= 0){
+     457:	83 c4 10             	add    $0x10,%esp
+     45a:	85 c0                	test   %eax,%eax
+     45c:	78 62                	js     4c0 <openiputtest+0xb0>
+      printf(out, "open directory for write succeeded\n");
+     45e:	83 ec 08             	sub    $0x8,%esp
+     461:	68 b0 76 00 00       	push   $0x76b0
+     466:	ff 35 24 92 00 00    	push   0x9224
+     46c:	e8 7f 4a 00 00       	call   4ef0 <printf>
+      exit();
+     471:	e8 ba 42 00 00       	call   4730 <exit>
+     476:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     47d:	8d 76 00             	lea    0x0(%esi),%esi
+  sleep(1);
+     480:	83 ec 0c             	sub    $0xc,%esp
+     483:	6a 01                	push   $0x1
+     485:	e8 f9 46 00 00       	call   4b83 <sleep>
+  if(unlink("oidir") != 0){
+     48a:	c7 04 24 17 64 00 00 	movl   $0x6417,(%esp)
+     491:	e8 75 46 00 00       	call   4b0b <unlink>
+     496:	83 c4 10             	add    $0x10,%esp
+     499:	85 c0                	test   %eax,%eax
+     49b:	75 56                	jne    4f3 <openiputtest+0xe3>
+  wait();
+     49d:	e8 e2 45 00 00       	call   4a84 <wait>
+  printf(out, "openiput test ok\n");
+     4a2:	83 ec 08             	sub    $0x8,%esp
+     4a5:	68 40 64 00 00       	push   $0x6440
+     4aa:	ff 35 24 92 00 00    	push   0x9224
+     4b0:	e8 3b 4a 00 00       	call   4ef0 <printf>
+}
+     4b5:	83 c4 10             	add    $0x10,%esp
+     4b8:	c9                   	leave
+     4b9:	c3                   	ret
+     4ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    exit();
+     4c0:	e8 6b 42 00 00       	call   4730 <exit>
+    printf(out, "fork failed\n");
+     4c5:	52                   	push   %edx
+     4c6:	52                   	push   %edx
+     4c7:	68 2e 72 00 00       	push   $0x722e
+     4cc:	ff 35 24 92 00 00    	push   0x9224
+     4d2:	e8 19 4a 00 00       	call   4ef0 <printf>
+    exit();
+     4d7:	e8 54 42 00 00       	call   4730 <exit>
+    printf(out, "mkdir oidir failed\n");
+     4dc:	51                   	push   %ecx
+     4dd:	51                   	push   %ecx
+     4de:	68 1d 64 00 00       	push   $0x641d
+     4e3:	ff 35 24 92 00 00    	push   0x9224
+     4e9:	e8 02 4a 00 00       	call   4ef0 <printf>
+    exit();
+     4ee:	e8 3d 42 00 00       	call   4730 <exit>
+    printf(out, "unlink failed\n");
+     4f3:	50                   	push   %eax
+     4f4:	50                   	push   %eax
+     4f5:	68 31 64 00 00       	push   $0x6431
+     4fa:	ff 35 24 92 00 00    	push   0x9224
+     500:	e8 eb 49 00 00       	call   4ef0 <printf>
+    exit();
+     505:	e8 26 42 00 00       	call   4730 <exit>
+     50a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000510 <opentest>:
+{
+     510:	55                   	push   %ebp
+     511:	89 e5                	mov    %esp,%ebp
+     513:	83 ec 10             	sub    $0x10,%esp
+  printf(out, "open test\n");
+     516:	68 52 64 00 00       	push   $0x6452
+     51b:	ff 35 24 92 00 00    	push   0x9224
+     521:	e8 ca 49 00 00       	call   4ef0 <printf>
+  fd = open("echo", 0);
+     526:	58                   	pop    %eax
+     527:	5a                   	pop    %edx
+     528:	6a 00                	push   $0x0
+     52a:	68 5d 64 00 00       	push   $0x645d
+     52f:	e8 b9 45 00 00       	call   4aed <open>
+  if(fd < 0){
+     534:	83 c4 10             	add    $0x10,%esp
+     537:	85 c0                	test   %eax,%eax
+     539:	78 36                	js     571 <opentest+0x61>
+  close(fd);
+     53b:	83 ec 0c             	sub    $0xc,%esp
+     53e:	50                   	push   %eax
+     53f:	e8 7c 45 00 00       	call   4ac0 <close>
+  fd = open("doesnotexist", 0);
+     544:	5a                   	pop    %edx
+     545:	59                   	pop    %ecx
+     546:	6a 00                	push   $0x0
+     548:	68 75 64 00 00       	push   $0x6475
+     54d:	e8 9b 45 00 00       	call   4aed <open>
+  if(fd >= 0){
+     552:	83 c4 10             	add    $0x10,%esp
+     555:	85 c0                	test   %eax,%eax
+     557:	79 2f                	jns    588 <opentest+0x78>
+  printf(out, "open test ok\n");
+     559:	83 ec 08             	sub    $0x8,%esp
+     55c:	68 a0 64 00 00       	push   $0x64a0
+     561:	ff 35 24 92 00 00    	push   0x9224
+     567:	e8 84 49 00 00       	call   4ef0 <printf>
+}
+     56c:	83 c4 10             	add    $0x10,%esp
+     56f:	c9                   	leave
+     570:	c3                   	ret
+    printf(out, "open echo failed!\n");
+     571:	50                   	push   %eax
+     572:	50                   	push   %eax
+     573:	68 62 64 00 00       	push   $0x6462
+     578:	ff 35 24 92 00 00    	push   0x9224
+     57e:	e8 6d 49 00 00       	call   4ef0 <printf>
+    exit();
+     583:	e8 a8 41 00 00       	call   4730 <exit>
+    printf(out, "open doesnotexist succeeded!\n");
+     588:	50                   	push   %eax
+     589:	50                   	push   %eax
+     58a:	68 82 64 00 00       	push   $0x6482
+     58f:	ff 35 24 92 00 00    	push   0x9224
+     595:	e8 56 49 00 00       	call   4ef0 <printf>
+    exit();
+     59a:	e8 91 41 00 00       	call   4730 <exit>
+     59f:	90                   	nop
+
+000005a0 <writetest>:
+{
+     5a0:	55                   	push   %ebp
+     5a1:	89 e5                	mov    %esp,%ebp
+     5a3:	56                   	push   %esi
+     5a4:	53                   	push   %ebx
+  printf(out, "small file test\n");
+     5a5:	83 ec 08             	sub    $0x8,%esp
+     5a8:	68 ae 64 00 00       	push   $0x64ae
+     5ad:	ff 35 24 92 00 00    	push   0x9224
+     5b3:	e8 38 49 00 00       	call   4ef0 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     5b8:	58                   	pop    %eax
+     5b9:	5a                   	pop    %edx
+     5ba:	68 02 02 00 00       	push   $0x202
+     5bf:	68 bf 64 00 00       	push   $0x64bf
+     5c4:	e8 24 45 00 00       	call   4aed <open>
+  if(fd >= 0){
+     5c9:	83 c4 10             	add    $0x10,%esp
+     5cc:	85 c0                	test   %eax,%eax
+     5ce:	0f 88 88 01 00 00    	js     75c <writetest+0x1bc>
+    printf(out, "creat small succeeded; ok\n");
+     5d4:	83 ec 08             	sub    $0x8,%esp
+     5d7:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     5d9:	31 db                	xor    %ebx,%ebx
+    printf(out, "creat small succeeded; ok\n");
+     5db:	68 c5 64 00 00       	push   $0x64c5
+     5e0:	ff 35 24 92 00 00    	push   0x9224
+     5e6:	e8 05 49 00 00       	call   4ef0 <printf>
+     5eb:	83 c4 10             	add    $0x10,%esp
+     5ee:	66 90                	xchg   %ax,%ax
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     5f0:	83 ec 04             	sub    $0x4,%esp
+     5f3:	6a 0a                	push   $0xa
+     5f5:	68 fc 64 00 00       	push   $0x64fc
+     5fa:	56                   	push   %esi
+     5fb:	e8 b1 44 00 00       	call   4ab1 <write>
+     600:	83 c4 10             	add    $0x10,%esp
+     603:	83 f8 0a             	cmp    $0xa,%eax
+     606:	0f 85 d9 00 00 00    	jne    6e5 <writetest+0x145>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     60c:	83 ec 04             	sub    $0x4,%esp
+     60f:	6a 0a                	push   $0xa
+     611:	68 07 65 00 00       	push   $0x6507
+     616:	56                   	push   %esi
+     617:	e8 95 44 00 00       	call   4ab1 <write>
+     61c:	83 c4 10             	add    $0x10,%esp
+     61f:	83 f8 0a             	cmp    $0xa,%eax
+     622:	0f 85 d6 00 00 00    	jne    6fe <writetest+0x15e>
+  for(i = 0; i < 100; i++){
+     628:	83 c3 01             	add    $0x1,%ebx
+     62b:	83 fb 64             	cmp    $0x64,%ebx
+     62e:	75 c0                	jne    5f0 <writetest+0x50>
+  printf(out, "writes ok\n");
+     630:	83 ec 08             	sub    $0x8,%esp
+     633:	68 12 65 00 00       	push   $0x6512
+     638:	ff 35 24 92 00 00    	push   0x9224
+     63e:	e8 ad 48 00 00       	call   4ef0 <printf>
+  close(fd);
+     643:	89 34 24             	mov    %esi,(%esp)
+     646:	e8 75 44 00 00       	call   4ac0 <close>
+  fd = open("small", O_RDONLY);
+     64b:	5b                   	pop    %ebx
+     64c:	5e                   	pop    %esi
+     64d:	6a 00                	push   $0x0
+     64f:	68 bf 64 00 00       	push   $0x64bf
+     654:	e8 94 44 00 00       	call   4aed <open>
+  if(fd >= 0){
+     659:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     65c:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     65e:	85 c0                	test   %eax,%eax
+     660:	0f 88 b1 00 00 00    	js     717 <writetest+0x177>
+    printf(out, "open small succeeded ok\n");
+     666:	83 ec 08             	sub    $0x8,%esp
+     669:	68 1d 65 00 00       	push   $0x651d
+     66e:	ff 35 24 92 00 00    	push   0x9224
+     674:	e8 77 48 00 00       	call   4ef0 <printf>
+  i = read(fd, buf, 2000);
+     679:	83 c4 0c             	add    $0xc,%esp
+     67c:	68 d0 07 00 00       	push   $0x7d0
+     681:	68 60 ba 00 00       	push   $0xba60
+     686:	53                   	push   %ebx
+     687:	e8 16 44 00 00       	call   4aa2 <read>
+  if(i == 2000){
+     68c:	83 c4 10             	add    $0x10,%esp
+     68f:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     694:	0f 85 94 00 00 00    	jne    72e <writetest+0x18e>
+    printf(out, "read succeeded ok\n");
+     69a:	83 ec 08             	sub    $0x8,%esp
+     69d:	68 51 65 00 00       	push   $0x6551
+     6a2:	ff 35 24 92 00 00    	push   0x9224
+     6a8:	e8 43 48 00 00       	call   4ef0 <printf>
+  close(fd);
+     6ad:	89 1c 24             	mov    %ebx,(%esp)
+     6b0:	e8 0b 44 00 00       	call   4ac0 <close>
+  if(unlink("small") < 0){
+     6b5:	c7 04 24 bf 64 00 00 	movl   $0x64bf,(%esp)
+     6bc:	e8 4a 44 00 00       	call   4b0b <unlink>
+     6c1:	83 c4 10             	add    $0x10,%esp
+     6c4:	85 c0                	test   %eax,%eax
+     6c6:	78 7d                	js     745 <writetest+0x1a5>
+  printf(out, "small file test ok\n");
+     6c8:	83 ec 08             	sub    $0x8,%esp
+     6cb:	68 79 65 00 00       	push   $0x6579
+     6d0:	ff 35 24 92 00 00    	push   0x9224
+     6d6:	e8 15 48 00 00       	call   4ef0 <printf>
+}
+     6db:	83 c4 10             	add    $0x10,%esp
+     6de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     6e1:	5b                   	pop    %ebx
+     6e2:	5e                   	pop    %esi
+     6e3:	5d                   	pop    %ebp
+     6e4:	c3                   	ret
+      printf(out, "error: write aa %d new file failed\n", i);
+     6e5:	83 ec 04             	sub    $0x4,%esp
+     6e8:	53                   	push   %ebx
+     6e9:	68 d4 76 00 00       	push   $0x76d4
+     6ee:	ff 35 24 92 00 00    	push   0x9224
+     6f4:	e8 f7 47 00 00       	call   4ef0 <printf>
+      exit();
+     6f9:	e8 32 40 00 00       	call   4730 <exit>
+      printf(out, "error: write bb %d new file failed\n", i);
+     6fe:	83 ec 04             	sub    $0x4,%esp
+     701:	53                   	push   %ebx
+     702:	68 f8 76 00 00       	push   $0x76f8
+     707:	ff 35 24 92 00 00    	push   0x9224
+     70d:	e8 de 47 00 00       	call   4ef0 <printf>
+      exit();
+     712:	e8 19 40 00 00       	call   4730 <exit>
+    printf(out, "error: open small failed!\n");
+     717:	51                   	push   %ecx
+     718:	51                   	push   %ecx
+     719:	68 36 65 00 00       	push   $0x6536
+     71e:	ff 35 24 92 00 00    	push   0x9224
+     724:	e8 c7 47 00 00       	call   4ef0 <printf>
+    exit();
+     729:	e8 02 40 00 00       	call   4730 <exit>
+    printf(out, "read failed\n");
+     72e:	52                   	push   %edx
+     72f:	52                   	push   %edx
+     730:	68 7d 68 00 00       	push   $0x687d
+     735:	ff 35 24 92 00 00    	push   0x9224
+     73b:	e8 b0 47 00 00       	call   4ef0 <printf>
+    exit();
+     740:	e8 eb 3f 00 00       	call   4730 <exit>
+    printf(out, "unlink small failed\n");
+     745:	50                   	push   %eax
+     746:	50                   	push   %eax
+     747:	68 64 65 00 00       	push   $0x6564
+     74c:	ff 35 24 92 00 00    	push   0x9224
+     752:	e8 99 47 00 00       	call   4ef0 <printf>
+    exit();
+     757:	e8 d4 3f 00 00       	call   4730 <exit>
+    printf(out, "error: creat small failed!\n");
+     75c:	50                   	push   %eax
+     75d:	50                   	push   %eax
+     75e:	68 e0 64 00 00       	push   $0x64e0
+     763:	ff 35 24 92 00 00    	push   0x9224
+     769:	e8 82 47 00 00       	call   4ef0 <printf>
+    exit();
+     76e:	e8 bd 3f 00 00       	call   4730 <exit>
+     773:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     77a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000780 <writetest1>:
+{
+     780:	55                   	push   %ebp
+     781:	89 e5                	mov    %esp,%ebp
+     783:	56                   	push   %esi
+     784:	53                   	push   %ebx
+  printf(out, "big files test\n");
+     785:	83 ec 08             	sub    $0x8,%esp
+     788:	68 8d 65 00 00       	push   $0x658d
+     78d:	ff 35 24 92 00 00    	push   0x9224
+     793:	e8 58 47 00 00       	call   4ef0 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     798:	58                   	pop    %eax
+     799:	5a                   	pop    %edx
+     79a:	68 02 02 00 00       	push   $0x202
+     79f:	68 07 66 00 00       	push   $0x6607
+     7a4:	e8 44 43 00 00       	call   4aed <open>
+  if(fd < 0){
+     7a9:	83 c4 10             	add    $0x10,%esp
+     7ac:	85 c0                	test   %eax,%eax
+     7ae:	0f 88 61 01 00 00    	js     915 <writetest1+0x195>
+     7b4:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < MAXFILE; i++){
+     7b6:	31 db                	xor    %ebx,%ebx
+     7b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7bf:	90                   	nop
+    if(write(fd, buf, 512) != 512){
+     7c0:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+     7c3:	89 1d 60 ba 00 00    	mov    %ebx,0xba60
+    if(write(fd, buf, 512) != 512){
+     7c9:	68 00 02 00 00       	push   $0x200
+     7ce:	68 60 ba 00 00       	push   $0xba60
+     7d3:	56                   	push   %esi
+     7d4:	e8 d8 42 00 00       	call   4ab1 <write>
+     7d9:	83 c4 10             	add    $0x10,%esp
+     7dc:	3d 00 02 00 00       	cmp    $0x200,%eax
+     7e1:	0f 85 b3 00 00 00    	jne    89a <writetest1+0x11a>
+  for(i = 0; i < MAXFILE; i++){
+     7e7:	83 c3 01             	add    $0x1,%ebx
+     7ea:	81 fb 8c 00 00 00    	cmp    $0x8c,%ebx
+     7f0:	75 ce                	jne    7c0 <writetest1+0x40>
+  close(fd);
+     7f2:	83 ec 0c             	sub    $0xc,%esp
+     7f5:	56                   	push   %esi
+     7f6:	e8 c5 42 00 00       	call   4ac0 <close>
+  fd = open("big", O_RDONLY);
+     7fb:	5b                   	pop    %ebx
+     7fc:	5e                   	pop    %esi
+     7fd:	6a 00                	push   $0x0
+     7ff:	68 07 66 00 00       	push   $0x6607
+     804:	e8 e4 42 00 00       	call   4aed <open>
+  if(fd < 0){
+     809:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+     80c:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     80e:	85 c0                	test   %eax,%eax
+     810:	0f 88 e8 00 00 00    	js     8fe <writetest1+0x17e>
+  n = 0;
+     816:	31 f6                	xor    %esi,%esi
+     818:	eb 1d                	jmp    837 <writetest1+0xb7>
+     81a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != 512){
+     820:	3d 00 02 00 00       	cmp    $0x200,%eax
+     825:	0f 85 9f 00 00 00    	jne    8ca <writetest1+0x14a>
+    if(((int*)buf)[0] != n){
+     82b:	a1 60 ba 00 00       	mov    0xba60,%eax
+     830:	39 f0                	cmp    %esi,%eax
+     832:	75 7f                	jne    8b3 <writetest1+0x133>
+    n++;
+     834:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, 512);
+     837:	83 ec 04             	sub    $0x4,%esp
+     83a:	68 00 02 00 00       	push   $0x200
+     83f:	68 60 ba 00 00       	push   $0xba60
+     844:	53                   	push   %ebx
+     845:	e8 58 42 00 00       	call   4aa2 <read>
+    if(i == 0){
+     84a:	83 c4 10             	add    $0x10,%esp
+     84d:	85 c0                	test   %eax,%eax
+     84f:	75 cf                	jne    820 <writetest1+0xa0>
+      if(n == MAXFILE - 1){
+     851:	81 fe 8b 00 00 00    	cmp    $0x8b,%esi
+     857:	0f 84 86 00 00 00    	je     8e3 <writetest1+0x163>
+  close(fd);
+     85d:	83 ec 0c             	sub    $0xc,%esp
+     860:	53                   	push   %ebx
+     861:	e8 5a 42 00 00       	call   4ac0 <close>
+  if(unlink("big") < 0){
+     866:	c7 04 24 07 66 00 00 	movl   $0x6607,(%esp)
+     86d:	e8 99 42 00 00       	call   4b0b <unlink>
+     872:	83 c4 10             	add    $0x10,%esp
+     875:	85 c0                	test   %eax,%eax
+     877:	0f 88 af 00 00 00    	js     92c <writetest1+0x1ac>
+  printf(out, "big files ok\n");
+     87d:	83 ec 08             	sub    $0x8,%esp
+     880:	68 2e 66 00 00       	push   $0x662e
+     885:	ff 35 24 92 00 00    	push   0x9224
+     88b:	e8 60 46 00 00       	call   4ef0 <printf>
+}
+     890:	83 c4 10             	add    $0x10,%esp
+     893:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     896:	5b                   	pop    %ebx
+     897:	5e                   	pop    %esi
+     898:	5d                   	pop    %ebp
+     899:	c3                   	ret
+      printf(out, "error: write big file failed\n", i);
+     89a:	83 ec 04             	sub    $0x4,%esp
+     89d:	53                   	push   %ebx
+     89e:	68 b7 65 00 00       	push   $0x65b7
+     8a3:	ff 35 24 92 00 00    	push   0x9224
+     8a9:	e8 42 46 00 00       	call   4ef0 <printf>
+      exit();
+     8ae:	e8 7d 3e 00 00       	call   4730 <exit>
+      printf(out, "read content of block %d is %d\n",
+     8b3:	50                   	push   %eax
+     8b4:	56                   	push   %esi
+     8b5:	68 1c 77 00 00       	push   $0x771c
+     8ba:	ff 35 24 92 00 00    	push   0x9224
+     8c0:	e8 2b 46 00 00       	call   4ef0 <printf>
+      exit();
+     8c5:	e8 66 3e 00 00       	call   4730 <exit>
+      printf(out, "read failed %d\n", i);
+     8ca:	83 ec 04             	sub    $0x4,%esp
+     8cd:	50                   	push   %eax
+     8ce:	68 0b 66 00 00       	push   $0x660b
+     8d3:	ff 35 24 92 00 00    	push   0x9224
+     8d9:	e8 12 46 00 00       	call   4ef0 <printf>
+      exit();
+     8de:	e8 4d 3e 00 00       	call   4730 <exit>
+        printf(out, "read only %d blocks from big", n);
+     8e3:	52                   	push   %edx
+     8e4:	68 8b 00 00 00       	push   $0x8b
+     8e9:	68 ee 65 00 00       	push   $0x65ee
+     8ee:	ff 35 24 92 00 00    	push   0x9224
+     8f4:	e8 f7 45 00 00       	call   4ef0 <printf>
+        exit();
+     8f9:	e8 32 3e 00 00       	call   4730 <exit>
+    printf(out, "error: open big failed!\n");
+     8fe:	51                   	push   %ecx
+     8ff:	51                   	push   %ecx
+     900:	68 d5 65 00 00       	push   $0x65d5
+     905:	ff 35 24 92 00 00    	push   0x9224
+     90b:	e8 e0 45 00 00       	call   4ef0 <printf>
+    exit();
+     910:	e8 1b 3e 00 00       	call   4730 <exit>
+    printf(out, "error: creat big failed!\n");
+     915:	50                   	push   %eax
+     916:	50                   	push   %eax
+     917:	68 9d 65 00 00       	push   $0x659d
+     91c:	ff 35 24 92 00 00    	push   0x9224
+     922:	e8 c9 45 00 00       	call   4ef0 <printf>
+    exit();
+     927:	e8 04 3e 00 00       	call   4730 <exit>
+    printf(out, "unlink big failed\n");
+     92c:	50                   	push   %eax
+     92d:	50                   	push   %eax
+     92e:	68 1b 66 00 00       	push   $0x661b
+     933:	ff 35 24 92 00 00    	push   0x9224
+     939:	e8 b2 45 00 00       	call   4ef0 <printf>
+    exit();
+     93e:	e8 ed 3d 00 00       	call   4730 <exit>
+     943:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     94a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000950 <createtest>:
+{
+     950:	55                   	push   %ebp
+     951:	89 e5                	mov    %esp,%ebp
+     953:	53                   	push   %ebx
+  name[2] = '\0';
+     954:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+     959:	83 ec 0c             	sub    $0xc,%esp
+  printf(out, "many creates, followed by unlink test\n");
+     95c:	68 3c 77 00 00       	push   $0x773c
+     961:	ff 35 24 92 00 00    	push   0x9224
+     967:	e8 84 45 00 00       	call   4ef0 <printf>
+  name[0] = 'a';
+     96c:	c6 05 44 ba 00 00 61 	movb   $0x61,0xba44
+  name[2] = '\0';
+     973:	83 c4 10             	add    $0x10,%esp
+     976:	c6 05 46 ba 00 00 00 	movb   $0x0,0xba46
+  for(i = 0; i < 52; i++){
+     97d:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+     980:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+     983:	88 1d 45 ba 00 00    	mov    %bl,0xba45
+  for(i = 0; i < 52; i++){
+     989:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+     98c:	68 02 02 00 00       	push   $0x202
+     991:	68 44 ba 00 00       	push   $0xba44
+     996:	e8 52 41 00 00       	call   4aed <open>
+    close(fd);
+     99b:	89 04 24             	mov    %eax,(%esp)
+     99e:	e8 1d 41 00 00       	call   4ac0 <close>
+  for(i = 0; i < 52; i++){
+     9a3:	83 c4 10             	add    $0x10,%esp
+     9a6:	80 fb 64             	cmp    $0x64,%bl
+     9a9:	75 d5                	jne    980 <createtest+0x30>
+  name[0] = 'a';
+     9ab:	c6 05 44 ba 00 00 61 	movb   $0x61,0xba44
+  name[2] = '\0';
+     9b2:	bb 30 00 00 00       	mov    $0x30,%ebx
+     9b7:	c6 05 46 ba 00 00 00 	movb   $0x0,0xba46
+  for(i = 0; i < 52; i++){
+     9be:	66 90                	xchg   %ax,%ax
+    unlink(name);
+     9c0:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+     9c3:	88 1d 45 ba 00 00    	mov    %bl,0xba45
+  for(i = 0; i < 52; i++){
+     9c9:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+     9cc:	68 44 ba 00 00       	push   $0xba44
+     9d1:	e8 35 41 00 00       	call   4b0b <unlink>
+  for(i = 0; i < 52; i++){
+     9d6:	83 c4 10             	add    $0x10,%esp
+     9d9:	80 fb 64             	cmp    $0x64,%bl
+     9dc:	75 e2                	jne    9c0 <createtest+0x70>
+  printf(out, "many creates, followed by unlink; ok\n");
+     9de:	83 ec 08             	sub    $0x8,%esp
+     9e1:	68 64 77 00 00       	push   $0x7764
+     9e6:	ff 35 24 92 00 00    	push   0x9224
+     9ec:	e8 ff 44 00 00       	call   4ef0 <printf>
+}
+     9f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9f4:	83 c4 10             	add    $0x10,%esp
+     9f7:	c9                   	leave
+     9f8:	c3                   	ret
+     9f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a00 <dirtest>:
+{
+     a00:	55                   	push   %ebp
+     a01:	89 e5                	mov    %esp,%ebp
+     a03:	83 ec 10             	sub    $0x10,%esp
+  printf(out, "mkdir test\n");
+     a06:	68 3c 66 00 00       	push   $0x663c
+     a0b:	ff 35 24 92 00 00    	push   0x9224
+     a11:	e8 da 44 00 00       	call   4ef0 <printf>
+  if(mkdir("dir0") < 0){
+     a16:	c7 04 24 48 66 00 00 	movl   $0x6648,(%esp)
+     a1d:	e8 16 41 00 00       	call   4b38 <mkdir>
+     a22:	83 c4 10             	add    $0x10,%esp
+     a25:	85 c0                	test   %eax,%eax
+     a27:	78 58                	js     a81 <dirtest+0x81>
+  if(chdir("dir0") < 0){
+     a29:	83 ec 0c             	sub    $0xc,%esp
+     a2c:	68 48 66 00 00       	push   $0x6648
+     a31:	e8 11 41 00 00       	call   4b47 <chdir>
+     a36:	83 c4 10             	add    $0x10,%esp
+     a39:	85 c0                	test   %eax,%eax
+     a3b:	0f 88 85 00 00 00    	js     ac6 <dirtest+0xc6>
+  if(chdir("..") < 0){
+     a41:	83 ec 0c             	sub    $0xc,%esp
+     a44:	68 ed 6b 00 00       	push   $0x6bed
+     a49:	e8 f9 40 00 00       	call   4b47 <chdir>
+     a4e:	83 c4 10             	add    $0x10,%esp
+     a51:	85 c0                	test   %eax,%eax
+     a53:	78 5a                	js     aaf <dirtest+0xaf>
+  if(unlink("dir0") < 0){
+     a55:	83 ec 0c             	sub    $0xc,%esp
+     a58:	68 48 66 00 00       	push   $0x6648
+     a5d:	e8 a9 40 00 00       	call   4b0b <unlink>
+     a62:	83 c4 10             	add    $0x10,%esp
+     a65:	85 c0                	test   %eax,%eax
+     a67:	78 2f                	js     a98 <dirtest+0x98>
+  printf(out, "mkdir test ok\n");
+     a69:	83 ec 08             	sub    $0x8,%esp
+     a6c:	68 85 66 00 00       	push   $0x6685
+     a71:	ff 35 24 92 00 00    	push   0x9224
+     a77:	e8 74 44 00 00       	call   4ef0 <printf>
+}
+     a7c:	83 c4 10             	add    $0x10,%esp
+     a7f:	c9                   	leave
+     a80:	c3                   	ret
+    printf(out, "mkdir failed\n");
+     a81:	50                   	push   %eax
+     a82:	50                   	push   %eax
+     a83:	68 78 63 00 00       	push   $0x6378
+     a88:	ff 35 24 92 00 00    	push   0x9224
+     a8e:	e8 5d 44 00 00       	call   4ef0 <printf>
+    exit();
+     a93:	e8 98 3c 00 00       	call   4730 <exit>
+    printf(out, "unlink dir0 failed\n");
+     a98:	50                   	push   %eax
+     a99:	50                   	push   %eax
+     a9a:	68 71 66 00 00       	push   $0x6671
+     a9f:	ff 35 24 92 00 00    	push   0x9224
+     aa5:	e8 46 44 00 00       	call   4ef0 <printf>
+    exit();
+     aaa:	e8 81 3c 00 00       	call   4730 <exit>
+    printf(out, "chdir .. failed\n");
+     aaf:	52                   	push   %edx
+     ab0:	52                   	push   %edx
+     ab1:	68 60 66 00 00       	push   $0x6660
+     ab6:	ff 35 24 92 00 00    	push   0x9224
+     abc:	e8 2f 44 00 00       	call   4ef0 <printf>
+    exit();
+     ac1:	e8 6a 3c 00 00       	call   4730 <exit>
+    printf(out, "chdir dir0 failed\n");
+     ac6:	51                   	push   %ecx
+     ac7:	51                   	push   %ecx
+     ac8:	68 4d 66 00 00       	push   $0x664d
+     acd:	ff 35 24 92 00 00    	push   0x9224
+     ad3:	e8 18 44 00 00       	call   4ef0 <printf>
+    exit();
+     ad8:	e8 53 3c 00 00       	call   4730 <exit>
+     add:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ae0 <exectest>:
+{
+     ae0:	55                   	push   %ebp
+     ae1:	89 e5                	mov    %esp,%ebp
+     ae3:	83 ec 10             	sub    $0x10,%esp
+  printf(out, "exec test\n");
+     ae6:	68 94 66 00 00       	push   $0x6694
+     aeb:	ff 35 24 92 00 00    	push   0x9224
+     af1:	e8 fa 43 00 00       	call   4ef0 <printf>
+  if(exec("echo", echoargv) < 0){
+     af6:	5a                   	pop    %edx
+     af7:	59                   	pop    %ecx
+     af8:	68 28 92 00 00       	push   $0x9228
+     afd:	68 5d 64 00 00       	push   $0x645d
+     b02:	e8 f9 3b 00 00       	call   4700 <exec>
+     b07:	83 c4 10             	add    $0x10,%esp
+     b0a:	85 c0                	test   %eax,%eax
+     b0c:	78 02                	js     b10 <exectest+0x30>
+}
+     b0e:	c9                   	leave
+     b0f:	c3                   	ret
+    printf(out, "exec echo failed\n");
+     b10:	50                   	push   %eax
+     b11:	50                   	push   %eax
+     b12:	68 9f 66 00 00       	push   $0x669f
+     b17:	ff 35 24 92 00 00    	push   0x9224
+     b1d:	e8 ce 43 00 00       	call   4ef0 <printf>
+    exit();
+     b22:	e8 09 3c 00 00       	call   4730 <exit>
+     b27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b2e:	66 90                	xchg   %ax,%ax
+
+00000b30 <pipe1>:
+{
+     b30:	55                   	push   %ebp
+     b31:	89 e5                	mov    %esp,%ebp
+     b33:	57                   	push   %edi
+     b34:	56                   	push   %esi
+  if(pipe(fds) != 0){
+     b35:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     b38:	53                   	push   %ebx
+     b39:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+     b3c:	50                   	push   %eax
+     b3d:	e8 51 3f 00 00       	call   4a93 <pipe>
+     b42:	83 c4 10             	add    $0x10,%esp
+     b45:	85 c0                	test   %eax,%eax
+     b47:	0f 85 41 01 00 00    	jne    c8e <pipe1+0x15e>
+     b4d:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     b4f:	e8 7c 3b 00 00       	call   46d0 <fork>
+  if(pid == 0){
+     b54:	85 c0                	test   %eax,%eax
+     b56:	0f 84 92 00 00 00    	je     bee <pipe1+0xbe>
+  } else if(pid > 0){
+     b5c:	0f 8e 3f 01 00 00    	jle    ca1 <pipe1+0x171>
+    close(fds[1]);
+     b62:	83 ec 0c             	sub    $0xc,%esp
+     b65:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+     b68:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+     b6a:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+     b6f:	e8 4c 3f 00 00       	call   4ac0 <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+     b74:	83 c4 10             	add    $0x10,%esp
+     b77:	83 ec 04             	sub    $0x4,%esp
+     b7a:	57                   	push   %edi
+     b7b:	68 60 ba 00 00       	push   $0xba60
+     b80:	ff 75 e0             	push   -0x20(%ebp)
+     b83:	e8 1a 3f 00 00       	call   4aa2 <read>
+     b88:	83 c4 10             	add    $0x10,%esp
+     b8b:	89 c1                	mov    %eax,%ecx
+     b8d:	85 c0                	test   %eax,%eax
+     b8f:	0f 8e b8 00 00 00    	jle    c4d <pipe1+0x11d>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     b95:	89 f0                	mov    %esi,%eax
+     b97:	32 05 60 ba 00 00    	xor    0xba60,%al
+     b9d:	0f b6 c0             	movzbl %al,%eax
+     ba0:	85 c0                	test   %eax,%eax
+     ba2:	75 30                	jne    bd4 <pipe1+0xa4>
+     ba4:	83 c6 01             	add    $0x1,%esi
+     ba7:	eb 0f                	jmp    bb8 <pipe1+0x88>
+     ba9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bb0:	38 90 60 ba 00 00    	cmp    %dl,0xba60(%eax)
+     bb6:	75 1c                	jne    bd4 <pipe1+0xa4>
+     bb8:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+     bbb:	83 c0 01             	add    $0x1,%eax
+     bbe:	39 c1                	cmp    %eax,%ecx
+     bc0:	75 ee                	jne    bb0 <pipe1+0x80>
+      cc = cc * 2;
+     bc2:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+     bc4:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+     bc9:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+     bcb:	89 d6                	mov    %edx,%esi
+     bcd:	39 c7                	cmp    %eax,%edi
+     bcf:	0f 4f f8             	cmovg  %eax,%edi
+     bd2:	eb a3                	jmp    b77 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+     bd4:	83 ec 08             	sub    $0x8,%esp
+     bd7:	68 ce 66 00 00       	push   $0x66ce
+     bdc:	6a 01                	push   $0x1
+     bde:	e8 0d 43 00 00       	call   4ef0 <printf>
+     be3:	83 c4 10             	add    $0x10,%esp
+}
+     be6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     be9:	5b                   	pop    %ebx
+     bea:	5e                   	pop    %esi
+     beb:	5f                   	pop    %edi
+     bec:	5d                   	pop    %ebp
+     bed:	c3                   	ret
+    close(fds[0]);
+     bee:	83 ec 0c             	sub    $0xc,%esp
+     bf1:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+     bf4:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+     bf6:	e8 c5 3e 00 00       	call   4ac0 <close>
+     bfb:	83 c4 10             	add    $0x10,%esp
+     bfe:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+     c00:	31 c0                	xor    %eax,%eax
+     c02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+     c08:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+     c0b:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     c0e:	88 90 5f ba 00 00    	mov    %dl,0xba5f(%eax)
+      for(i = 0; i < 1033; i++)
+     c14:	3d 09 04 00 00       	cmp    $0x409,%eax
+     c19:	75 ed                	jne    c08 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+     c1b:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+     c1e:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+     c24:	68 09 04 00 00       	push   $0x409
+     c29:	68 60 ba 00 00       	push   $0xba60
+     c2e:	ff 75 e4             	push   -0x1c(%ebp)
+     c31:	e8 7b 3e 00 00       	call   4ab1 <write>
+     c36:	83 c4 10             	add    $0x10,%esp
+     c39:	3d 09 04 00 00       	cmp    $0x409,%eax
+     c3e:	75 74                	jne    cb4 <pipe1+0x184>
+    for(n = 0; n < 5; n++){
+     c40:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     c46:	75 b8                	jne    c00 <pipe1+0xd0>
+    exit();
+     c48:	e8 e3 3a 00 00       	call   4730 <exit>
+    if(total != 5 * 1033){
+     c4d:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     c53:	75 26                	jne    c7b <pipe1+0x14b>
+    close(fds[0]);
+     c55:	83 ec 0c             	sub    $0xc,%esp
+     c58:	ff 75 e0             	push   -0x20(%ebp)
+     c5b:	e8 60 3e 00 00       	call   4ac0 <close>
+    wait();
+     c60:	e8 1f 3e 00 00       	call   4a84 <wait>
+  printf(1, "pipe1 ok\n");
+     c65:	5a                   	pop    %edx
+     c66:	59                   	pop    %ecx
+     c67:	68 f3 66 00 00       	push   $0x66f3
+     c6c:	6a 01                	push   $0x1
+     c6e:	e8 7d 42 00 00       	call   4ef0 <printf>
+     c73:	83 c4 10             	add    $0x10,%esp
+     c76:	e9 6b ff ff ff       	jmp    be6 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     c7b:	56                   	push   %esi
+     c7c:	53                   	push   %ebx
+     c7d:	68 dc 66 00 00       	push   $0x66dc
+     c82:	6a 01                	push   $0x1
+     c84:	e8 67 42 00 00       	call   4ef0 <printf>
+      exit();
+     c89:	e8 a2 3a 00 00       	call   4730 <exit>
+    printf(1, "pipe() failed\n");
+     c8e:	50                   	push   %eax
+     c8f:	50                   	push   %eax
+     c90:	68 b1 66 00 00       	push   $0x66b1
+     c95:	6a 01                	push   $0x1
+     c97:	e8 54 42 00 00       	call   4ef0 <printf>
+    exit();
+     c9c:	e8 8f 3a 00 00       	call   4730 <exit>
+    printf(1, "fork() failed\n");
+     ca1:	50                   	push   %eax
+     ca2:	50                   	push   %eax
+     ca3:	68 fd 66 00 00       	push   $0x66fd
+     ca8:	6a 01                	push   $0x1
+     caa:	e8 41 42 00 00       	call   4ef0 <printf>
+    exit();
+     caf:	e8 7c 3a 00 00       	call   4730 <exit>
+        printf(1, "pipe1 oops 1\n");
+     cb4:	57                   	push   %edi
+     cb5:	57                   	push   %edi
+     cb6:	68 c0 66 00 00       	push   $0x66c0
+     cbb:	6a 01                	push   $0x1
+     cbd:	e8 2e 42 00 00       	call   4ef0 <printf>
+        exit();
+     cc2:	e8 69 3a 00 00       	call   4730 <exit>
+     cc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cce:	66 90                	xchg   %ax,%ax
+
+00000cd0 <preempt>:
+{
+     cd0:	55                   	push   %ebp
+     cd1:	89 e5                	mov    %esp,%ebp
+     cd3:	57                   	push   %edi
+     cd4:	56                   	push   %esi
+     cd5:	53                   	push   %ebx
+     cd6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+     cd9:	68 0c 67 00 00       	push   $0x670c
+     cde:	6a 01                	push   $0x1
+     ce0:	e8 0b 42 00 00       	call   4ef0 <printf>
+  pid1 = fork();
+     ce5:	e8 e6 39 00 00       	call   46d0 <fork>
+  if(pid1 == 0)
+     cea:	83 c4 10             	add    $0x10,%esp
+     ced:	85 c0                	test   %eax,%eax
+     cef:	75 07                	jne    cf8 <preempt+0x28>
+    for(;;)
+     cf1:	eb fe                	jmp    cf1 <preempt+0x21>
+     cf3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cf7:	90                   	nop
+     cf8:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+     cfa:	e8 d1 39 00 00       	call   46d0 <fork>
+     cff:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+     d01:	85 c0                	test   %eax,%eax
+     d03:	75 0b                	jne    d10 <preempt+0x40>
+    for(;;)
+     d05:	eb fe                	jmp    d05 <preempt+0x35>
+     d07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d0e:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+     d10:	83 ec 0c             	sub    $0xc,%esp
+     d13:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     d16:	50                   	push   %eax
+     d17:	e8 77 3d 00 00       	call   4a93 <pipe>
+  pid3 = fork();
+     d1c:	e8 af 39 00 00       	call   46d0 <fork>
+  if(pid3 == 0){
+     d21:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+     d24:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+     d26:	85 c0                	test   %eax,%eax
+     d28:	75 3e                	jne    d68 <preempt+0x98>
+    close(pfds[0]);
+     d2a:	83 ec 0c             	sub    $0xc,%esp
+     d2d:	ff 75 e0             	push   -0x20(%ebp)
+     d30:	e8 8b 3d 00 00       	call   4ac0 <close>
+    if(write(pfds[1], "x", 1) != 1)
+     d35:	83 c4 0c             	add    $0xc,%esp
+     d38:	6a 01                	push   $0x1
+     d3a:	68 d1 6c 00 00       	push   $0x6cd1
+     d3f:	ff 75 e4             	push   -0x1c(%ebp)
+     d42:	e8 6a 3d 00 00       	call   4ab1 <write>
+     d47:	83 c4 10             	add    $0x10,%esp
+     d4a:	83 f8 01             	cmp    $0x1,%eax
+     d4d:	0f 85 b8 00 00 00    	jne    e0b <preempt+0x13b>
+    close(pfds[1]);
+     d53:	83 ec 0c             	sub    $0xc,%esp
+     d56:	ff 75 e4             	push   -0x1c(%ebp)
+     d59:	e8 62 3d 00 00       	call   4ac0 <close>
+     d5e:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     d61:	eb fe                	jmp    d61 <preempt+0x91>
+     d63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d67:	90                   	nop
+  close(pfds[1]);
+     d68:	83 ec 0c             	sub    $0xc,%esp
+     d6b:	ff 75 e4             	push   -0x1c(%ebp)
+     d6e:	e8 4d 3d 00 00       	call   4ac0 <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     d73:	83 c4 0c             	add    $0xc,%esp
+     d76:	68 00 20 00 00       	push   $0x2000
+     d7b:	68 60 ba 00 00       	push   $0xba60
+     d80:	ff 75 e0             	push   -0x20(%ebp)
+     d83:	e8 1a 3d 00 00       	call   4aa2 <read>
+     d88:	83 c4 10             	add    $0x10,%esp
+     d8b:	83 f8 01             	cmp    $0x1,%eax
+     d8e:	75 67                	jne    df7 <preempt+0x127>
+  close(pfds[0]);
+     d90:	83 ec 0c             	sub    $0xc,%esp
+     d93:	ff 75 e0             	push   -0x20(%ebp)
+     d96:	e8 25 3d 00 00       	call   4ac0 <close>
+  printf(1, "kill... ");
+     d9b:	58                   	pop    %eax
+     d9c:	5a                   	pop    %edx
+     d9d:	68 3d 67 00 00       	push   $0x673d
+     da2:	6a 01                	push   $0x1
+     da4:	e8 47 41 00 00       	call   4ef0 <printf>
+  kill(pid1);
+     da9:	89 1c 24             	mov    %ebx,(%esp)
+     dac:	e8 1e 3d 00 00       	call   4acf <kill>
+  kill(pid2);
+     db1:	89 34 24             	mov    %esi,(%esp)
+     db4:	e8 16 3d 00 00       	call   4acf <kill>
+  kill(pid3);
+     db9:	89 3c 24             	mov    %edi,(%esp)
+     dbc:	e8 0e 3d 00 00       	call   4acf <kill>
+  printf(1, "wait... ");
+     dc1:	59                   	pop    %ecx
+     dc2:	5b                   	pop    %ebx
+     dc3:	68 46 67 00 00       	push   $0x6746
+     dc8:	6a 01                	push   $0x1
+     dca:	e8 21 41 00 00       	call   4ef0 <printf>
+  wait();
+     dcf:	e8 b0 3c 00 00       	call   4a84 <wait>
+  wait();
+     dd4:	e8 ab 3c 00 00       	call   4a84 <wait>
+  wait();
+     dd9:	e8 a6 3c 00 00       	call   4a84 <wait>
+  printf(1, "preempt ok\n");
+     dde:	5e                   	pop    %esi
+     ddf:	5f                   	pop    %edi
+     de0:	68 4f 67 00 00       	push   $0x674f
+     de5:	6a 01                	push   $0x1
+     de7:	e8 04 41 00 00       	call   4ef0 <printf>
+     dec:	83 c4 10             	add    $0x10,%esp
+}
+     def:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     df2:	5b                   	pop    %ebx
+     df3:	5e                   	pop    %esi
+     df4:	5f                   	pop    %edi
+     df5:	5d                   	pop    %ebp
+     df6:	c3                   	ret
+    printf(1, "preempt read error");
+     df7:	83 ec 08             	sub    $0x8,%esp
+     dfa:	68 2a 67 00 00       	push   $0x672a
+     dff:	6a 01                	push   $0x1
+     e01:	e8 ea 40 00 00       	call   4ef0 <printf>
+     e06:	83 c4 10             	add    $0x10,%esp
+     e09:	eb e4                	jmp    def <preempt+0x11f>
+      printf(1, "preempt write error");
+     e0b:	83 ec 08             	sub    $0x8,%esp
+     e0e:	68 16 67 00 00       	push   $0x6716
+     e13:	6a 01                	push   $0x1
+     e15:	e8 d6 40 00 00       	call   4ef0 <printf>
+     e1a:	83 c4 10             	add    $0x10,%esp
+     e1d:	e9 31 ff ff ff       	jmp    d53 <preempt+0x83>
+     e22:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000e30 <exitwait>:
+{
+     e30:	55                   	push   %ebp
+     e31:	89 e5                	mov    %esp,%ebp
+     e33:	56                   	push   %esi
+     e34:	be 64 00 00 00       	mov    $0x64,%esi
+     e39:	53                   	push   %ebx
+     e3a:	eb 14                	jmp    e50 <exitwait+0x20>
+     e3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+     e40:	74 68                	je     eaa <exitwait+0x7a>
+      if(wait() != pid){
+     e42:	e8 3d 3c 00 00       	call   4a84 <wait>
+     e47:	39 d8                	cmp    %ebx,%eax
+     e49:	75 2d                	jne    e78 <exitwait+0x48>
+  for(i = 0; i < 100; i++){
+     e4b:	83 ee 01             	sub    $0x1,%esi
+     e4e:	74 41                	je     e91 <exitwait+0x61>
+    pid = fork();
+     e50:	e8 7b 38 00 00       	call   46d0 <fork>
+     e55:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     e57:	85 c0                	test   %eax,%eax
+     e59:	79 e5                	jns    e40 <exitwait+0x10>
+      printf(1, "fork failed\n");
+     e5b:	83 ec 08             	sub    $0x8,%esp
+     e5e:	68 2e 72 00 00       	push   $0x722e
+     e63:	6a 01                	push   $0x1
+     e65:	e8 86 40 00 00       	call   4ef0 <printf>
+      return;
+     e6a:	83 c4 10             	add    $0x10,%esp
+}
+     e6d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e70:	5b                   	pop    %ebx
+     e71:	5e                   	pop    %esi
+     e72:	5d                   	pop    %ebp
+     e73:	c3                   	ret
+     e74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "wait wrong pid\n");
+     e78:	83 ec 08             	sub    $0x8,%esp
+     e7b:	68 5b 67 00 00       	push   $0x675b
+     e80:	6a 01                	push   $0x1
+     e82:	e8 69 40 00 00       	call   4ef0 <printf>
+        return;
+     e87:	83 c4 10             	add    $0x10,%esp
+}
+     e8a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e8d:	5b                   	pop    %ebx
+     e8e:	5e                   	pop    %esi
+     e8f:	5d                   	pop    %ebp
+     e90:	c3                   	ret
+  printf(1, "exitwait ok\n");
+     e91:	83 ec 08             	sub    $0x8,%esp
+     e94:	68 6b 67 00 00       	push   $0x676b
+     e99:	6a 01                	push   $0x1
+     e9b:	e8 50 40 00 00       	call   4ef0 <printf>
+     ea0:	83 c4 10             	add    $0x10,%esp
+}
+     ea3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ea6:	5b                   	pop    %ebx
+     ea7:	5e                   	pop    %esi
+     ea8:	5d                   	pop    %ebp
+     ea9:	c3                   	ret
+      exit();
+     eaa:	e8 81 38 00 00       	call   4730 <exit>
+     eaf:	90                   	nop
+
+00000eb0 <mem>:
+{
+     eb0:	55                   	push   %ebp
+     eb1:	89 e5                	mov    %esp,%ebp
+     eb3:	56                   	push   %esi
+     eb4:	31 f6                	xor    %esi,%esi
+     eb6:	53                   	push   %ebx
+  printf(1, "mem test\n");
+     eb7:	83 ec 08             	sub    $0x8,%esp
+     eba:	68 78 67 00 00       	push   $0x6778
+     ebf:	6a 01                	push   $0x1
+     ec1:	e8 2a 40 00 00       	call   4ef0 <printf>
+  ppid = getpid();
+     ec6:	e8 9a 3c 00 00       	call   4b65 <getpid>
+     ecb:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0){
+     ecd:	e8 fe 37 00 00       	call   46d0 <fork>
+     ed2:	83 c4 10             	add    $0x10,%esp
+     ed5:	85 c0                	test   %eax,%eax
+     ed7:	74 0b                	je     ee4 <mem+0x34>
+     ed9:	e9 8a 00 00 00       	jmp    f68 <mem+0xb8>
+     ede:	66 90                	xchg   %ax,%ax
+      *(char**)m2 = m1;
+     ee0:	89 30                	mov    %esi,(%eax)
+     ee2:	89 c6                	mov    %eax,%esi
+    while((m2 = malloc(10001)) != 0){
+     ee4:	83 ec 0c             	sub    $0xc,%esp
+     ee7:	68 11 27 00 00       	push   $0x2711
+     eec:	e8 8f 50 00 00       	call   5f80 <malloc>
+     ef1:	83 c4 10             	add    $0x10,%esp
+     ef4:	85 c0                	test   %eax,%eax
+     ef6:	75 e8                	jne    ee0 <mem+0x30>
+    while(m1){
+     ef8:	85 f6                	test   %esi,%esi
+     efa:	74 18                	je     f14 <mem+0x64>
+     efc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      m2 = *(char**)m1;
+     f00:	89 f0                	mov    %esi,%eax
+      free(m1);
+     f02:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+     f05:	8b 36                	mov    (%esi),%esi
+      free(m1);
+     f07:	50                   	push   %eax
+     f08:	e8 43 4f 00 00       	call   5e50 <free>
+    while(m1){
+     f0d:	83 c4 10             	add    $0x10,%esp
+     f10:	85 f6                	test   %esi,%esi
+     f12:	75 ec                	jne    f00 <mem+0x50>
+    m1 = malloc(1024*20);
+     f14:	83 ec 0c             	sub    $0xc,%esp
+     f17:	68 00 50 00 00       	push   $0x5000
+     f1c:	e8 5f 50 00 00       	call   5f80 <malloc>
+    if(m1 == 0){
+     f21:	83 c4 10             	add    $0x10,%esp
+     f24:	85 c0                	test   %eax,%eax
+     f26:	74 20                	je     f48 <mem+0x98>
+    free(m1);
+     f28:	83 ec 0c             	sub    $0xc,%esp
+     f2b:	50                   	push   %eax
+     f2c:	e8 1f 4f 00 00       	call   5e50 <free>
+    printf(1, "mem ok\n");
+     f31:	58                   	pop    %eax
+     f32:	5a                   	pop    %edx
+     f33:	68 9c 67 00 00       	push   $0x679c
+     f38:	6a 01                	push   $0x1
+     f3a:	e8 b1 3f 00 00       	call   4ef0 <printf>
+    exit();
+     f3f:	e8 ec 37 00 00       	call   4730 <exit>
+     f44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "couldn't allocate mem?!!\n");
+     f48:	83 ec 08             	sub    $0x8,%esp
+     f4b:	68 82 67 00 00       	push   $0x6782
+     f50:	6a 01                	push   $0x1
+     f52:	e8 99 3f 00 00       	call   4ef0 <printf>
+      kill(ppid);
+     f57:	89 1c 24             	mov    %ebx,(%esp)
+     f5a:	e8 70 3b 00 00       	call   4acf <kill>
+      exit();
+     f5f:	e8 cc 37 00 00       	call   4730 <exit>
+     f64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+     f68:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f6b:	5b                   	pop    %ebx
+     f6c:	5e                   	pop    %esi
+     f6d:	5d                   	pop    %ebp
+    wait();
+     f6e:	e9 11 3b 00 00       	jmp    4a84 <wait>
+     f73:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000f80 <sharedfd>:
+{
+     f80:	55                   	push   %ebp
+     f81:	89 e5                	mov    %esp,%ebp
+     f83:	57                   	push   %edi
+     f84:	56                   	push   %esi
+     f85:	53                   	push   %ebx
+     f86:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+     f89:	68 a4 67 00 00       	push   $0x67a4
+     f8e:	6a 01                	push   $0x1
+     f90:	e8 5b 3f 00 00       	call   4ef0 <printf>
+  unlink("sharedfd");
+     f95:	c7 04 24 b3 67 00 00 	movl   $0x67b3,(%esp)
+     f9c:	e8 6a 3b 00 00       	call   4b0b <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+     fa1:	5b                   	pop    %ebx
+     fa2:	5e                   	pop    %esi
+     fa3:	68 02 02 00 00       	push   $0x202
+     fa8:	68 b3 67 00 00       	push   $0x67b3
+     fad:	e8 3b 3b 00 00       	call   4aed <open>
+  if(fd < 0){
+     fb2:	83 c4 10             	add    $0x10,%esp
+     fb5:	85 c0                	test   %eax,%eax
+     fb7:	0f 88 2a 01 00 00    	js     10e7 <sharedfd+0x167>
+     fbd:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     fbf:	8d 75 de             	lea    -0x22(%ebp),%esi
+     fc2:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+     fc7:	e8 04 37 00 00       	call   46d0 <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     fcc:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+     fcf:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     fd2:	19 c0                	sbb    %eax,%eax
+     fd4:	83 ec 04             	sub    $0x4,%esp
+     fd7:	83 e0 f3             	and    $0xfffffff3,%eax
+     fda:	6a 0a                	push   $0xa
+     fdc:	83 c0 70             	add    $0x70,%eax
+     fdf:	50                   	push   %eax
+     fe0:	56                   	push   %esi
+     fe1:	e8 2a 38 00 00       	call   4810 <memset>
+     fe6:	83 c4 10             	add    $0x10,%esp
+     fe9:	eb 0a                	jmp    ff5 <sharedfd+0x75>
+     feb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     fef:	90                   	nop
+  for(i = 0; i < 1000; i++){
+     ff0:	83 eb 01             	sub    $0x1,%ebx
+     ff3:	74 26                	je     101b <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+     ff5:	83 ec 04             	sub    $0x4,%esp
+     ff8:	6a 0a                	push   $0xa
+     ffa:	56                   	push   %esi
+     ffb:	57                   	push   %edi
+     ffc:	e8 b0 3a 00 00       	call   4ab1 <write>
+    1001:	83 c4 10             	add    $0x10,%esp
+    1004:	83 f8 0a             	cmp    $0xa,%eax
+    1007:	74 e7                	je     ff0 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+    1009:	83 ec 08             	sub    $0x8,%esp
+    100c:	68 b8 77 00 00       	push   $0x77b8
+    1011:	6a 01                	push   $0x1
+    1013:	e8 d8 3e 00 00       	call   4ef0 <printf>
+      break;
+    1018:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+    101b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    101e:	85 c9                	test   %ecx,%ecx
+    1020:	0f 84 f5 00 00 00    	je     111b <sharedfd+0x19b>
+    wait();
+    1026:	e8 59 3a 00 00       	call   4a84 <wait>
+  close(fd);
+    102b:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+    102e:	31 db                	xor    %ebx,%ebx
+  close(fd);
+    1030:	57                   	push   %edi
+    1031:	8d 7d e8             	lea    -0x18(%ebp),%edi
+    1034:	e8 87 3a 00 00       	call   4ac0 <close>
+  fd = open("sharedfd", 0);
+    1039:	58                   	pop    %eax
+    103a:	5a                   	pop    %edx
+    103b:	6a 00                	push   $0x0
+    103d:	68 b3 67 00 00       	push   $0x67b3
+    1042:	e8 a6 3a 00 00       	call   4aed <open>
+  if(fd < 0){
+    1047:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+    104a:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+    104c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+    104f:	85 c0                	test   %eax,%eax
+    1051:	0f 88 aa 00 00 00    	js     1101 <sharedfd+0x181>
+    1057:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    105e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    1060:	83 ec 04             	sub    $0x4,%esp
+    1063:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1066:	6a 0a                	push   $0xa
+    1068:	56                   	push   %esi
+    1069:	ff 75 d0             	push   -0x30(%ebp)
+    106c:	e8 31 3a 00 00       	call   4aa2 <read>
+    1071:	83 c4 10             	add    $0x10,%esp
+    1074:	85 c0                	test   %eax,%eax
+    1076:	7e 28                	jle    10a0 <sharedfd+0x120>
+    1078:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    107b:	89 f0                	mov    %esi,%eax
+    107d:	eb 13                	jmp    1092 <sharedfd+0x112>
+    107f:	90                   	nop
+        np++;
+    1080:	80 f9 70             	cmp    $0x70,%cl
+    1083:	0f 94 c1             	sete   %cl
+    1086:	0f b6 c9             	movzbl %cl,%ecx
+    1089:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+    108b:	83 c0 01             	add    $0x1,%eax
+    108e:	39 f8                	cmp    %edi,%eax
+    1090:	74 ce                	je     1060 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+    1092:	0f b6 08             	movzbl (%eax),%ecx
+    1095:	80 f9 63             	cmp    $0x63,%cl
+    1098:	75 e6                	jne    1080 <sharedfd+0x100>
+        nc++;
+    109a:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+    109d:	eb ec                	jmp    108b <sharedfd+0x10b>
+    109f:	90                   	nop
+  close(fd);
+    10a0:	83 ec 0c             	sub    $0xc,%esp
+    10a3:	ff 75 d0             	push   -0x30(%ebp)
+    10a6:	e8 15 3a 00 00       	call   4ac0 <close>
+  unlink("sharedfd");
+    10ab:	c7 04 24 b3 67 00 00 	movl   $0x67b3,(%esp)
+    10b2:	e8 54 3a 00 00       	call   4b0b <unlink>
+  if(nc == 10000 && np == 10000){
+    10b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    10ba:	83 c4 10             	add    $0x10,%esp
+    10bd:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+    10c3:	75 5b                	jne    1120 <sharedfd+0x1a0>
+    10c5:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+    10cb:	75 53                	jne    1120 <sharedfd+0x1a0>
+    printf(1, "sharedfd ok\n");
+    10cd:	83 ec 08             	sub    $0x8,%esp
+    10d0:	68 bc 67 00 00       	push   $0x67bc
+    10d5:	6a 01                	push   $0x1
+    10d7:	e8 14 3e 00 00       	call   4ef0 <printf>
+    10dc:	83 c4 10             	add    $0x10,%esp
+}
+    10df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    10e2:	5b                   	pop    %ebx
+    10e3:	5e                   	pop    %esi
+    10e4:	5f                   	pop    %edi
+    10e5:	5d                   	pop    %ebp
+    10e6:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+    10e7:	83 ec 08             	sub    $0x8,%esp
+    10ea:	68 8c 77 00 00       	push   $0x778c
+    10ef:	6a 01                	push   $0x1
+    10f1:	e8 fa 3d 00 00       	call   4ef0 <printf>
+    return;
+    10f6:	83 c4 10             	add    $0x10,%esp
+}
+    10f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    10fc:	5b                   	pop    %ebx
+    10fd:	5e                   	pop    %esi
+    10fe:	5f                   	pop    %edi
+    10ff:	5d                   	pop    %ebp
+    1100:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    1101:	83 ec 08             	sub    $0x8,%esp
+    1104:	68 d8 77 00 00       	push   $0x77d8
+    1109:	6a 01                	push   $0x1
+    110b:	e8 e0 3d 00 00       	call   4ef0 <printf>
+    return;
+    1110:	83 c4 10             	add    $0x10,%esp
+}
+    1113:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1116:	5b                   	pop    %ebx
+    1117:	5e                   	pop    %esi
+    1118:	5f                   	pop    %edi
+    1119:	5d                   	pop    %ebp
+    111a:	c3                   	ret
+    exit();
+    111b:	e8 10 36 00 00       	call   4730 <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    1120:	53                   	push   %ebx
+    1121:	52                   	push   %edx
+    1122:	68 c9 67 00 00       	push   $0x67c9
+    1127:	6a 01                	push   $0x1
+    1129:	e8 c2 3d 00 00       	call   4ef0 <printf>
+    exit();
+    112e:	e8 fd 35 00 00       	call   4730 <exit>
+    1133:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    113a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001140 <fourfiles>:
+{
+    1140:	55                   	push   %ebp
+    1141:	89 e5                	mov    %esp,%ebp
+    1143:	57                   	push   %edi
+    1144:	56                   	push   %esi
+    1145:	53                   	push   %ebx
+  for(pi = 0; pi < 4; pi++){
+    1146:	31 db                	xor    %ebx,%ebx
+{
+    1148:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    114b:	c7 45 d8 de 67 00 00 	movl   $0x67de,-0x28(%ebp)
+    1152:	c7 45 dc 27 69 00 00 	movl   $0x6927,-0x24(%ebp)
+    1159:	c7 45 e0 2b 69 00 00 	movl   $0x692b,-0x20(%ebp)
+    1160:	c7 45 e4 e1 67 00 00 	movl   $0x67e1,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+    1167:	68 e4 67 00 00       	push   $0x67e4
+    116c:	6a 01                	push   $0x1
+    116e:	e8 7d 3d 00 00       	call   4ef0 <printf>
+    1173:	83 c4 10             	add    $0x10,%esp
+    fname = names[pi];
+    1176:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+    117a:	83 ec 0c             	sub    $0xc,%esp
+    117d:	56                   	push   %esi
+    117e:	e8 88 39 00 00       	call   4b0b <unlink>
+    pid = fork();
+    1183:	e8 48 35 00 00       	call   46d0 <fork>
+    if(pid < 0){
+    1188:	83 c4 10             	add    $0x10,%esp
+    118b:	85 c0                	test   %eax,%eax
+    118d:	0f 88 65 01 00 00    	js     12f8 <fourfiles+0x1b8>
+    if(pid == 0){
+    1193:	0f 84 eb 00 00 00    	je     1284 <fourfiles+0x144>
+  for(pi = 0; pi < 4; pi++){
+    1199:	83 c3 01             	add    $0x1,%ebx
+    119c:	83 fb 04             	cmp    $0x4,%ebx
+    119f:	75 d5                	jne    1176 <fourfiles+0x36>
+    wait();
+    11a1:	e8 de 38 00 00       	call   4a84 <wait>
+  for(i = 0; i < 2; i++){
+    11a6:	31 f6                	xor    %esi,%esi
+    wait();
+    11a8:	e8 d7 38 00 00       	call   4a84 <wait>
+    11ad:	e8 d2 38 00 00       	call   4a84 <wait>
+    11b2:	e8 cd 38 00 00       	call   4a84 <wait>
+    fname = names[i];
+    11b7:	8b 5c b5 d8          	mov    -0x28(%ebp,%esi,4),%ebx
+    fd = open(fname, 0);
+    11bb:	83 ec 08             	sub    $0x8,%esp
+    total = 0;
+    11be:	31 ff                	xor    %edi,%edi
+    fd = open(fname, 0);
+    11c0:	6a 00                	push   $0x0
+    11c2:	53                   	push   %ebx
+    11c3:	e8 25 39 00 00       	call   4aed <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    11c8:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    11cb:	83 c4 10             	add    $0x10,%esp
+    11ce:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    11d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11d8:	83 ec 04             	sub    $0x4,%esp
+    11db:	68 00 20 00 00       	push   $0x2000
+    11e0:	68 60 ba 00 00       	push   $0xba60
+    11e5:	ff 75 d4             	push   -0x2c(%ebp)
+    11e8:	e8 b5 38 00 00       	call   4aa2 <read>
+    11ed:	83 c4 10             	add    $0x10,%esp
+    11f0:	89 c3                	mov    %eax,%ebx
+    11f2:	85 c0                	test   %eax,%eax
+    11f4:	7e 28                	jle    121e <fourfiles+0xde>
+      for(j = 0; j < n; j++){
+    11f6:	31 c0                	xor    %eax,%eax
+    11f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11ff:	90                   	nop
+        if(buf[j] != '0'+i){
+    1200:	83 fe 01             	cmp    $0x1,%esi
+    1203:	0f be 88 60 ba 00 00 	movsbl 0xba60(%eax),%ecx
+    120a:	19 d2                	sbb    %edx,%edx
+    120c:	83 c2 31             	add    $0x31,%edx
+    120f:	39 d1                	cmp    %edx,%ecx
+    1211:	75 5d                	jne    1270 <fourfiles+0x130>
+      for(j = 0; j < n; j++){
+    1213:	83 c0 01             	add    $0x1,%eax
+    1216:	39 c3                	cmp    %eax,%ebx
+    1218:	75 e6                	jne    1200 <fourfiles+0xc0>
+      total += n;
+    121a:	01 df                	add    %ebx,%edi
+    121c:	eb ba                	jmp    11d8 <fourfiles+0x98>
+    close(fd);
+    121e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    1221:	83 ec 0c             	sub    $0xc,%esp
+    1224:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1227:	51                   	push   %ecx
+    1228:	e8 93 38 00 00       	call   4ac0 <close>
+    if(total != 12*500){
+    122d:	83 c4 10             	add    $0x10,%esp
+    1230:	81 ff 70 17 00 00    	cmp    $0x1770,%edi
+    1236:	0f 85 d0 00 00 00    	jne    130c <fourfiles+0x1cc>
+    unlink(fname);
+    123c:	83 ec 0c             	sub    $0xc,%esp
+    123f:	53                   	push   %ebx
+    1240:	e8 c6 38 00 00       	call   4b0b <unlink>
+  for(i = 0; i < 2; i++){
+    1245:	83 c4 10             	add    $0x10,%esp
+    1248:	85 f6                	test   %esi,%esi
+    124a:	75 0a                	jne    1256 <fourfiles+0x116>
+    124c:	be 01 00 00 00       	mov    $0x1,%esi
+    1251:	e9 61 ff ff ff       	jmp    11b7 <fourfiles+0x77>
+  printf(1, "fourfiles ok\n");
+    1256:	83 ec 08             	sub    $0x8,%esp
+    1259:	68 22 68 00 00       	push   $0x6822
+    125e:	6a 01                	push   $0x1
+    1260:	e8 8b 3c 00 00       	call   4ef0 <printf>
+}
+    1265:	83 c4 10             	add    $0x10,%esp
+    1268:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    126b:	5b                   	pop    %ebx
+    126c:	5e                   	pop    %esi
+    126d:	5f                   	pop    %edi
+    126e:	5d                   	pop    %ebp
+    126f:	c3                   	ret
+          printf(1, "wrong char\n");
+    1270:	83 ec 08             	sub    $0x8,%esp
+    1273:	68 05 68 00 00       	push   $0x6805
+    1278:	6a 01                	push   $0x1
+    127a:	e8 71 3c 00 00       	call   4ef0 <printf>
+          exit();
+    127f:	e8 ac 34 00 00       	call   4730 <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+    1284:	83 ec 08             	sub    $0x8,%esp
+    1287:	68 02 02 00 00       	push   $0x202
+    128c:	56                   	push   %esi
+    128d:	e8 5b 38 00 00       	call   4aed <open>
+      if(fd < 0){
+    1292:	83 c4 10             	add    $0x10,%esp
+      fd = open(fname, O_CREATE | O_RDWR);
+    1295:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    1297:	85 c0                	test   %eax,%eax
+    1299:	78 45                	js     12e0 <fourfiles+0x1a0>
+      memset(buf, '0'+pi, 512);
+    129b:	83 ec 04             	sub    $0x4,%esp
+    129e:	83 c3 30             	add    $0x30,%ebx
+    12a1:	68 00 02 00 00       	push   $0x200
+    12a6:	53                   	push   %ebx
+    12a7:	bb 0c 00 00 00       	mov    $0xc,%ebx
+    12ac:	68 60 ba 00 00       	push   $0xba60
+    12b1:	e8 5a 35 00 00       	call   4810 <memset>
+    12b6:	83 c4 10             	add    $0x10,%esp
+        if((n = write(fd, buf, 500)) != 500){
+    12b9:	83 ec 04             	sub    $0x4,%esp
+    12bc:	68 f4 01 00 00       	push   $0x1f4
+    12c1:	68 60 ba 00 00       	push   $0xba60
+    12c6:	56                   	push   %esi
+    12c7:	e8 e5 37 00 00       	call   4ab1 <write>
+    12cc:	83 c4 10             	add    $0x10,%esp
+    12cf:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    12d4:	75 49                	jne    131f <fourfiles+0x1df>
+      for(i = 0; i < 12; i++){
+    12d6:	83 eb 01             	sub    $0x1,%ebx
+    12d9:	75 de                	jne    12b9 <fourfiles+0x179>
+      exit();
+    12db:	e8 50 34 00 00       	call   4730 <exit>
+        printf(1, "create failed\n");
+    12e0:	51                   	push   %ecx
+    12e1:	51                   	push   %ecx
+    12e2:	68 90 73 00 00       	push   $0x7390
+    12e7:	6a 01                	push   $0x1
+    12e9:	e8 02 3c 00 00       	call   4ef0 <printf>
+        exit();
+    12ee:	e8 3d 34 00 00       	call   4730 <exit>
+    12f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12f7:	90                   	nop
+      printf(1, "fork failed\n");
+    12f8:	83 ec 08             	sub    $0x8,%esp
+    12fb:	68 2e 72 00 00       	push   $0x722e
+    1300:	6a 01                	push   $0x1
+    1302:	e8 e9 3b 00 00       	call   4ef0 <printf>
+      exit();
+    1307:	e8 24 34 00 00       	call   4730 <exit>
+      printf(1, "wrong length %d\n", total);
+    130c:	50                   	push   %eax
+    130d:	57                   	push   %edi
+    130e:	68 11 68 00 00       	push   $0x6811
+    1313:	6a 01                	push   $0x1
+    1315:	e8 d6 3b 00 00       	call   4ef0 <printf>
+      exit();
+    131a:	e8 11 34 00 00       	call   4730 <exit>
+          printf(1, "write failed %d\n", n);
+    131f:	52                   	push   %edx
+    1320:	50                   	push   %eax
+    1321:	68 f4 67 00 00       	push   $0x67f4
+    1326:	6a 01                	push   $0x1
+    1328:	e8 c3 3b 00 00       	call   4ef0 <printf>
+          exit();
+    132d:	e8 fe 33 00 00       	call   4730 <exit>
+    1332:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001340 <createdelete>:
+{
+    1340:	55                   	push   %ebp
+    1341:	89 e5                	mov    %esp,%ebp
+    1343:	57                   	push   %edi
+    1344:	56                   	push   %esi
+  for(pi = 0; pi < 4; pi++){
+    1345:	31 f6                	xor    %esi,%esi
+{
+    1347:	53                   	push   %ebx
+    1348:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "createdelete test\n");
+    134b:	68 30 68 00 00       	push   $0x6830
+    1350:	6a 01                	push   $0x1
+    1352:	e8 99 3b 00 00       	call   4ef0 <printf>
+    1357:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    135a:	e8 71 33 00 00       	call   46d0 <fork>
+    135f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    1361:	85 c0                	test   %eax,%eax
+    1363:	0f 88 ac 01 00 00    	js     1515 <createdelete+0x1d5>
+    if(pid == 0){
+    1369:	0f 84 01 01 00 00    	je     1470 <createdelete+0x130>
+  for(pi = 0; pi < 4; pi++){
+    136f:	83 c6 01             	add    $0x1,%esi
+    1372:	83 fe 04             	cmp    $0x4,%esi
+    1375:	75 e3                	jne    135a <createdelete+0x1a>
+    wait();
+    1377:	e8 08 37 00 00       	call   4a84 <wait>
+  for(i = 0; i < N; i++){
+    137c:	31 ff                	xor    %edi,%edi
+    137e:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    wait();
+    1381:	e8 fe 36 00 00       	call   4a84 <wait>
+    1386:	e8 f9 36 00 00       	call   4a84 <wait>
+    138b:	e8 f4 36 00 00       	call   4a84 <wait>
+  name[0] = name[1] = name[2] = 0;
+    1390:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+  for(i = 0; i < N; i++){
+    1394:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((i == 0 || i >= N/2) && fd < 0){
+    1398:	85 ff                	test   %edi,%edi
+      name[1] = '0' + i;
+    139a:	8d 47 30             	lea    0x30(%edi),%eax
+      if((i == 0 || i >= N/2) && fd < 0){
+    139d:	bb 70 00 00 00       	mov    $0x70,%ebx
+    13a2:	0f 94 c2             	sete   %dl
+    13a5:	83 ff 09             	cmp    $0x9,%edi
+      name[1] = '0' + i;
+    13a8:	88 45 c6             	mov    %al,-0x3a(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    13ab:	0f 9f c0             	setg   %al
+    13ae:	09 c2                	or     %eax,%edx
+    13b0:	88 55 c7             	mov    %dl,-0x39(%ebp)
+      name[1] = '0' + i;
+    13b3:	0f b6 45 c6          	movzbl -0x3a(%ebp),%eax
+      fd = open(name, 0);
+    13b7:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'p' + pi;
+    13ba:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    13bd:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    13c0:	6a 00                	push   $0x0
+    13c2:	56                   	push   %esi
+    13c3:	e8 25 37 00 00       	call   4aed <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    13c8:	83 c4 10             	add    $0x10,%esp
+    13cb:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+    13cf:	74 7f                	je     1450 <createdelete+0x110>
+    13d1:	85 c0                	test   %eax,%eax
+    13d3:	0f 88 27 01 00 00    	js     1500 <createdelete+0x1c0>
+        close(fd);
+    13d9:	83 ec 0c             	sub    $0xc,%esp
+    13dc:	50                   	push   %eax
+    13dd:	e8 de 36 00 00       	call   4ac0 <close>
+    13e2:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    13e5:	83 c3 01             	add    $0x1,%ebx
+    13e8:	80 fb 74             	cmp    $0x74,%bl
+    13eb:	75 c6                	jne    13b3 <createdelete+0x73>
+  for(i = 0; i < N; i++){
+    13ed:	83 c7 01             	add    $0x1,%edi
+    13f0:	83 ff 14             	cmp    $0x14,%edi
+    13f3:	75 a3                	jne    1398 <createdelete+0x58>
+    13f5:	bf 70 00 00 00       	mov    $0x70,%edi
+    13fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + i;
+    1400:	8d 47 c0             	lea    -0x40(%edi),%eax
+    1403:	bb 04 00 00 00       	mov    $0x4,%ebx
+    1408:	88 45 c7             	mov    %al,-0x39(%ebp)
+      name[0] = 'p' + i;
+    140b:	89 f8                	mov    %edi,%eax
+      unlink(name);
+    140d:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 'p' + i;
+    1410:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    1413:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    1417:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    141a:	56                   	push   %esi
+    141b:	e8 eb 36 00 00       	call   4b0b <unlink>
+    for(pi = 0; pi < 4; pi++){
+    1420:	83 c4 10             	add    $0x10,%esp
+    1423:	83 eb 01             	sub    $0x1,%ebx
+    1426:	75 e3                	jne    140b <createdelete+0xcb>
+  for(i = 0; i < N; i++){
+    1428:	83 c7 01             	add    $0x1,%edi
+    142b:	89 f8                	mov    %edi,%eax
+    142d:	3c 84                	cmp    $0x84,%al
+    142f:	75 cf                	jne    1400 <createdelete+0xc0>
+  printf(1, "createdelete ok\n");
+    1431:	83 ec 08             	sub    $0x8,%esp
+    1434:	68 43 68 00 00       	push   $0x6843
+    1439:	6a 01                	push   $0x1
+    143b:	e8 b0 3a 00 00       	call   4ef0 <printf>
+}
+    1440:	83 c4 10             	add    $0x10,%esp
+    1443:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1446:	5b                   	pop    %ebx
+    1447:	5e                   	pop    %esi
+    1448:	5f                   	pop    %edi
+    1449:	5d                   	pop    %ebp
+    144a:	c3                   	ret
+    144b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    144f:	90                   	nop
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    1450:	85 c0                	test   %eax,%eax
+    1452:	78 91                	js     13e5 <createdelete+0xa5>
+        printf(1, "oops createdelete %s did exist\n", name);
+    1454:	50                   	push   %eax
+    1455:	56                   	push   %esi
+    1456:	68 28 78 00 00       	push   $0x7828
+    145b:	6a 01                	push   $0x1
+    145d:	e8 8e 3a 00 00       	call   4ef0 <printf>
+        exit();
+    1462:	e8 c9 32 00 00       	call   4730 <exit>
+    1467:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    146e:	66 90                	xchg   %ax,%ax
+      name[0] = 'p' + pi;
+    1470:	8d 46 70             	lea    0x70(%esi),%eax
+      name[2] = '\0';
+    1473:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    1477:	8d 75 c8             	lea    -0x38(%ebp),%esi
+      name[0] = 'p' + pi;
+    147a:	88 45 c8             	mov    %al,-0x38(%ebp)
+      for(i = 0; i < N; i++){
+    147d:	8d 76 00             	lea    0x0(%esi),%esi
+        fd = open(name, O_CREATE | O_RDWR);
+    1480:	83 ec 08             	sub    $0x8,%esp
+        name[1] = '0' + i;
+    1483:	8d 43 30             	lea    0x30(%ebx),%eax
+    1486:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    1489:	68 02 02 00 00       	push   $0x202
+    148e:	56                   	push   %esi
+    148f:	e8 59 36 00 00       	call   4aed <open>
+        if(fd < 0){
+    1494:	83 c4 10             	add    $0x10,%esp
+    1497:	85 c0                	test   %eax,%eax
+    1499:	0f 88 8a 00 00 00    	js     1529 <createdelete+0x1e9>
+        close(fd);
+    149f:	83 ec 0c             	sub    $0xc,%esp
+    14a2:	50                   	push   %eax
+    14a3:	e8 18 36 00 00       	call   4ac0 <close>
+        if(i > 0 && (i % 2 ) == 0){
+    14a8:	83 c4 10             	add    $0x10,%esp
+    14ab:	85 db                	test   %ebx,%ebx
+    14ad:	74 19                	je     14c8 <createdelete+0x188>
+    14af:	f6 c3 01             	test   $0x1,%bl
+    14b2:	74 1b                	je     14cf <createdelete+0x18f>
+      for(i = 0; i < N; i++){
+    14b4:	83 c3 01             	add    $0x1,%ebx
+    14b7:	83 fb 14             	cmp    $0x14,%ebx
+    14ba:	75 c4                	jne    1480 <createdelete+0x140>
+      exit();
+    14bc:	e8 6f 32 00 00       	call   4730 <exit>
+    14c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      for(i = 0; i < N; i++){
+    14c8:	bb 01 00 00 00       	mov    $0x1,%ebx
+    14cd:	eb b1                	jmp    1480 <createdelete+0x140>
+          name[1] = '0' + (i / 2);
+    14cf:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+    14d1:	83 ec 0c             	sub    $0xc,%esp
+          name[1] = '0' + (i / 2);
+    14d4:	d1 f8                	sar    %eax
+    14d6:	83 c0 30             	add    $0x30,%eax
+    14d9:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    14dc:	56                   	push   %esi
+    14dd:	e8 29 36 00 00       	call   4b0b <unlink>
+    14e2:	83 c4 10             	add    $0x10,%esp
+    14e5:	85 c0                	test   %eax,%eax
+    14e7:	79 cb                	jns    14b4 <createdelete+0x174>
+            printf(1, "unlink failed\n");
+    14e9:	52                   	push   %edx
+    14ea:	52                   	push   %edx
+    14eb:	68 31 64 00 00       	push   $0x6431
+    14f0:	6a 01                	push   $0x1
+    14f2:	e8 f9 39 00 00       	call   4ef0 <printf>
+            exit();
+    14f7:	e8 34 32 00 00       	call   4730 <exit>
+    14fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    1500:	83 ec 04             	sub    $0x4,%esp
+    1503:	56                   	push   %esi
+    1504:	68 04 78 00 00       	push   $0x7804
+    1509:	6a 01                	push   $0x1
+    150b:	e8 e0 39 00 00       	call   4ef0 <printf>
+        exit();
+    1510:	e8 1b 32 00 00       	call   4730 <exit>
+      printf(1, "fork failed\n");
+    1515:	83 ec 08             	sub    $0x8,%esp
+    1518:	68 2e 72 00 00       	push   $0x722e
+    151d:	6a 01                	push   $0x1
+    151f:	e8 cc 39 00 00       	call   4ef0 <printf>
+      exit();
+    1524:	e8 07 32 00 00       	call   4730 <exit>
+          printf(1, "create failed\n");
+    1529:	83 ec 08             	sub    $0x8,%esp
+    152c:	68 90 73 00 00       	push   $0x7390
+    1531:	6a 01                	push   $0x1
+    1533:	e8 b8 39 00 00       	call   4ef0 <printf>
+          exit();
+    1538:	e8 f3 31 00 00       	call   4730 <exit>
+    153d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001540 <unlinkread>:
+{
+    1540:	55                   	push   %ebp
+    1541:	89 e5                	mov    %esp,%ebp
+    1543:	56                   	push   %esi
+    1544:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    1545:	83 ec 08             	sub    $0x8,%esp
+    1548:	68 54 68 00 00       	push   $0x6854
+    154d:	6a 01                	push   $0x1
+    154f:	e8 9c 39 00 00       	call   4ef0 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    1554:	5b                   	pop    %ebx
+    1555:	5e                   	pop    %esi
+    1556:	68 02 02 00 00       	push   $0x202
+    155b:	68 65 68 00 00       	push   $0x6865
+    1560:	e8 88 35 00 00       	call   4aed <open>
+  if(fd < 0){
+    1565:	83 c4 10             	add    $0x10,%esp
+    1568:	85 c0                	test   %eax,%eax
+    156a:	0f 88 e6 00 00 00    	js     1656 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    1570:	83 ec 04             	sub    $0x4,%esp
+    1573:	89 c3                	mov    %eax,%ebx
+    1575:	6a 05                	push   $0x5
+    1577:	68 8a 68 00 00       	push   $0x688a
+    157c:	50                   	push   %eax
+    157d:	e8 2f 35 00 00       	call   4ab1 <write>
+  close(fd);
+    1582:	89 1c 24             	mov    %ebx,(%esp)
+    1585:	e8 36 35 00 00       	call   4ac0 <close>
+  fd = open("unlinkread", O_RDWR);
+    158a:	58                   	pop    %eax
+    158b:	5a                   	pop    %edx
+    158c:	6a 02                	push   $0x2
+    158e:	68 65 68 00 00       	push   $0x6865
+    1593:	e8 55 35 00 00       	call   4aed <open>
+  if(fd < 0){
+    1598:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    159b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    159d:	85 c0                	test   %eax,%eax
+    159f:	0f 88 10 01 00 00    	js     16b5 <unlinkread+0x175>
+  if(unlink("unlinkread") != 0){
+    15a5:	83 ec 0c             	sub    $0xc,%esp
+    15a8:	68 65 68 00 00       	push   $0x6865
+    15ad:	e8 59 35 00 00       	call   4b0b <unlink>
+    15b2:	83 c4 10             	add    $0x10,%esp
+    15b5:	85 c0                	test   %eax,%eax
+    15b7:	0f 85 e5 00 00 00    	jne    16a2 <unlinkread+0x162>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    15bd:	83 ec 08             	sub    $0x8,%esp
+    15c0:	68 02 02 00 00       	push   $0x202
+    15c5:	68 65 68 00 00       	push   $0x6865
+    15ca:	e8 1e 35 00 00       	call   4aed <open>
+  write(fd1, "yyy", 3);
+    15cf:	83 c4 0c             	add    $0xc,%esp
+    15d2:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    15d4:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    15d6:	68 c2 68 00 00       	push   $0x68c2
+    15db:	50                   	push   %eax
+    15dc:	e8 d0 34 00 00       	call   4ab1 <write>
+  close(fd1);
+    15e1:	89 34 24             	mov    %esi,(%esp)
+    15e4:	e8 d7 34 00 00       	call   4ac0 <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    15e9:	83 c4 0c             	add    $0xc,%esp
+    15ec:	68 00 20 00 00       	push   $0x2000
+    15f1:	68 60 ba 00 00       	push   $0xba60
+    15f6:	53                   	push   %ebx
+    15f7:	e8 a6 34 00 00       	call   4aa2 <read>
+    15fc:	83 c4 10             	add    $0x10,%esp
+    15ff:	83 f8 05             	cmp    $0x5,%eax
+    1602:	0f 85 87 00 00 00    	jne    168f <unlinkread+0x14f>
+  if(buf[0] != 'h'){
+    1608:	80 3d 60 ba 00 00 68 	cmpb   $0x68,0xba60
+    160f:	75 6b                	jne    167c <unlinkread+0x13c>
+  if(write(fd, buf, 10) != 10){
+    1611:	83 ec 04             	sub    $0x4,%esp
+    1614:	6a 0a                	push   $0xa
+    1616:	68 60 ba 00 00       	push   $0xba60
+    161b:	53                   	push   %ebx
+    161c:	e8 90 34 00 00       	call   4ab1 <write>
+    1621:	83 c4 10             	add    $0x10,%esp
+    1624:	83 f8 0a             	cmp    $0xa,%eax
+    1627:	75 40                	jne    1669 <unlinkread+0x129>
+  close(fd);
+    1629:	83 ec 0c             	sub    $0xc,%esp
+    162c:	53                   	push   %ebx
+    162d:	e8 8e 34 00 00       	call   4ac0 <close>
+  unlink("unlinkread");
+    1632:	c7 04 24 65 68 00 00 	movl   $0x6865,(%esp)
+    1639:	e8 cd 34 00 00       	call   4b0b <unlink>
+  printf(1, "unlinkread ok\n");
+    163e:	58                   	pop    %eax
+    163f:	5a                   	pop    %edx
+    1640:	68 0d 69 00 00       	push   $0x690d
+    1645:	6a 01                	push   $0x1
+    1647:	e8 a4 38 00 00       	call   4ef0 <printf>
+}
+    164c:	83 c4 10             	add    $0x10,%esp
+    164f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1652:	5b                   	pop    %ebx
+    1653:	5e                   	pop    %esi
+    1654:	5d                   	pop    %ebp
+    1655:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    1656:	51                   	push   %ecx
+    1657:	51                   	push   %ecx
+    1658:	68 70 68 00 00       	push   $0x6870
+    165d:	6a 01                	push   $0x1
+    165f:	e8 8c 38 00 00       	call   4ef0 <printf>
+    exit();
+    1664:	e8 c7 30 00 00       	call   4730 <exit>
+    printf(1, "unlinkread write failed\n");
+    1669:	51                   	push   %ecx
+    166a:	51                   	push   %ecx
+    166b:	68 f4 68 00 00       	push   $0x68f4
+    1670:	6a 01                	push   $0x1
+    1672:	e8 79 38 00 00       	call   4ef0 <printf>
+    exit();
+    1677:	e8 b4 30 00 00       	call   4730 <exit>
+    printf(1, "unlinkread wrong data\n");
+    167c:	53                   	push   %ebx
+    167d:	53                   	push   %ebx
+    167e:	68 dd 68 00 00       	push   $0x68dd
+    1683:	6a 01                	push   $0x1
+    1685:	e8 66 38 00 00       	call   4ef0 <printf>
+    exit();
+    168a:	e8 a1 30 00 00       	call   4730 <exit>
+    printf(1, "unlinkread read failed");
+    168f:	56                   	push   %esi
+    1690:	56                   	push   %esi
+    1691:	68 c6 68 00 00       	push   $0x68c6
+    1696:	6a 01                	push   $0x1
+    1698:	e8 53 38 00 00       	call   4ef0 <printf>
+    exit();
+    169d:	e8 8e 30 00 00       	call   4730 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    16a2:	50                   	push   %eax
+    16a3:	50                   	push   %eax
+    16a4:	68 a8 68 00 00       	push   $0x68a8
+    16a9:	6a 01                	push   $0x1
+    16ab:	e8 40 38 00 00       	call   4ef0 <printf>
+    exit();
+    16b0:	e8 7b 30 00 00       	call   4730 <exit>
+    printf(1, "open unlinkread failed\n");
+    16b5:	50                   	push   %eax
+    16b6:	50                   	push   %eax
+    16b7:	68 90 68 00 00       	push   $0x6890
+    16bc:	6a 01                	push   $0x1
+    16be:	e8 2d 38 00 00       	call   4ef0 <printf>
+    exit();
+    16c3:	e8 68 30 00 00       	call   4730 <exit>
+    16c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16cf:	90                   	nop
+
+000016d0 <linktest>:
+{
+    16d0:	55                   	push   %ebp
+    16d1:	89 e5                	mov    %esp,%ebp
+    16d3:	53                   	push   %ebx
+    16d4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    16d7:	68 1c 69 00 00       	push   $0x691c
+    16dc:	6a 01                	push   $0x1
+    16de:	e8 0d 38 00 00       	call   4ef0 <printf>
+  unlink("lf1");
+    16e3:	c7 04 24 26 69 00 00 	movl   $0x6926,(%esp)
+    16ea:	e8 1c 34 00 00       	call   4b0b <unlink>
+  unlink("lf2");
+    16ef:	c7 04 24 2a 69 00 00 	movl   $0x692a,(%esp)
+    16f6:	e8 10 34 00 00       	call   4b0b <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    16fb:	58                   	pop    %eax
+    16fc:	5a                   	pop    %edx
+    16fd:	68 02 02 00 00       	push   $0x202
+    1702:	68 26 69 00 00       	push   $0x6926
+    1707:	e8 e1 33 00 00       	call   4aed <open>
+  if(fd < 0){
+    170c:	83 c4 10             	add    $0x10,%esp
+    170f:	85 c0                	test   %eax,%eax
+    1711:	0f 88 1e 01 00 00    	js     1835 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    1717:	83 ec 04             	sub    $0x4,%esp
+    171a:	89 c3                	mov    %eax,%ebx
+    171c:	6a 05                	push   $0x5
+    171e:	68 8a 68 00 00       	push   $0x688a
+    1723:	50                   	push   %eax
+    1724:	e8 88 33 00 00       	call   4ab1 <write>
+    1729:	83 c4 10             	add    $0x10,%esp
+    172c:	83 f8 05             	cmp    $0x5,%eax
+    172f:	0f 85 98 01 00 00    	jne    18cd <linktest+0x1fd>
+  close(fd);
+    1735:	83 ec 0c             	sub    $0xc,%esp
+    1738:	53                   	push   %ebx
+    1739:	e8 82 33 00 00       	call   4ac0 <close>
+  if(link("lf1", "lf2") < 0){
+    173e:	5b                   	pop    %ebx
+    173f:	58                   	pop    %eax
+    1740:	68 2a 69 00 00       	push   $0x692a
+    1745:	68 26 69 00 00       	push   $0x6926
+    174a:	e8 da 33 00 00       	call   4b29 <link>
+    174f:	83 c4 10             	add    $0x10,%esp
+    1752:	85 c0                	test   %eax,%eax
+    1754:	0f 88 60 01 00 00    	js     18ba <linktest+0x1ea>
+  unlink("lf1");
+    175a:	83 ec 0c             	sub    $0xc,%esp
+    175d:	68 26 69 00 00       	push   $0x6926
+    1762:	e8 a4 33 00 00       	call   4b0b <unlink>
+  if(open("lf1", 0) >= 0){
+    1767:	58                   	pop    %eax
+    1768:	5a                   	pop    %edx
+    1769:	6a 00                	push   $0x0
+    176b:	68 26 69 00 00       	push   $0x6926
+    1770:	e8 78 33 00 00       	call   4aed <open>
+    1775:	83 c4 10             	add    $0x10,%esp
+    1778:	85 c0                	test   %eax,%eax
+    177a:	0f 89 27 01 00 00    	jns    18a7 <linktest+0x1d7>
+  fd = open("lf2", 0);
+    1780:	83 ec 08             	sub    $0x8,%esp
+    1783:	6a 00                	push   $0x0
+    1785:	68 2a 69 00 00       	push   $0x692a
+    178a:	e8 5e 33 00 00       	call   4aed <open>
+  if(fd < 0){
+    178f:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    1792:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1794:	85 c0                	test   %eax,%eax
+    1796:	0f 88 f8 00 00 00    	js     1894 <linktest+0x1c4>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    179c:	83 ec 04             	sub    $0x4,%esp
+    179f:	68 00 20 00 00       	push   $0x2000
+    17a4:	68 60 ba 00 00       	push   $0xba60
+    17a9:	50                   	push   %eax
+    17aa:	e8 f3 32 00 00       	call   4aa2 <read>
+    17af:	83 c4 10             	add    $0x10,%esp
+    17b2:	83 f8 05             	cmp    $0x5,%eax
+    17b5:	0f 85 c6 00 00 00    	jne    1881 <linktest+0x1b1>
+  close(fd);
+    17bb:	83 ec 0c             	sub    $0xc,%esp
+    17be:	53                   	push   %ebx
+    17bf:	e8 fc 32 00 00       	call   4ac0 <close>
+  if(link("lf2", "lf2") >= 0){
+    17c4:	58                   	pop    %eax
+    17c5:	5a                   	pop    %edx
+    17c6:	68 2a 69 00 00       	push   $0x692a
+    17cb:	68 2a 69 00 00       	push   $0x692a
+    17d0:	e8 54 33 00 00       	call   4b29 <link>
+    17d5:	83 c4 10             	add    $0x10,%esp
+    17d8:	85 c0                	test   %eax,%eax
+    17da:	0f 89 8e 00 00 00    	jns    186e <linktest+0x19e>
+  unlink("lf2");
+    17e0:	83 ec 0c             	sub    $0xc,%esp
+    17e3:	68 2a 69 00 00       	push   $0x692a
+    17e8:	e8 1e 33 00 00       	call   4b0b <unlink>
+  if(link("lf2", "lf1") >= 0){
+    17ed:	59                   	pop    %ecx
+    17ee:	5b                   	pop    %ebx
+    17ef:	68 26 69 00 00       	push   $0x6926
+    17f4:	68 2a 69 00 00       	push   $0x692a
+    17f9:	e8 2b 33 00 00       	call   4b29 <link>
+    17fe:	83 c4 10             	add    $0x10,%esp
+    1801:	85 c0                	test   %eax,%eax
+    1803:	79 56                	jns    185b <linktest+0x18b>
+  if(link(".", "lf1") >= 0){
+    1805:	83 ec 08             	sub    $0x8,%esp
+    1808:	68 26 69 00 00       	push   $0x6926
+    180d:	68 ee 6b 00 00       	push   $0x6bee
+    1812:	e8 12 33 00 00       	call   4b29 <link>
+    1817:	83 c4 10             	add    $0x10,%esp
+    181a:	85 c0                	test   %eax,%eax
+    181c:	79 2a                	jns    1848 <linktest+0x178>
+  printf(1, "linktest ok\n");
+    181e:	83 ec 08             	sub    $0x8,%esp
+    1821:	68 c4 69 00 00       	push   $0x69c4
+    1826:	6a 01                	push   $0x1
+    1828:	e8 c3 36 00 00       	call   4ef0 <printf>
+}
+    182d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1830:	83 c4 10             	add    $0x10,%esp
+    1833:	c9                   	leave
+    1834:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    1835:	50                   	push   %eax
+    1836:	50                   	push   %eax
+    1837:	68 2e 69 00 00       	push   $0x692e
+    183c:	6a 01                	push   $0x1
+    183e:	e8 ad 36 00 00       	call   4ef0 <printf>
+    exit();
+    1843:	e8 e8 2e 00 00       	call   4730 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    1848:	50                   	push   %eax
+    1849:	50                   	push   %eax
+    184a:	68 a8 69 00 00       	push   $0x69a8
+    184f:	6a 01                	push   $0x1
+    1851:	e8 9a 36 00 00       	call   4ef0 <printf>
+    exit();
+    1856:	e8 d5 2e 00 00       	call   4730 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    185b:	52                   	push   %edx
+    185c:	52                   	push   %edx
+    185d:	68 70 78 00 00       	push   $0x7870
+    1862:	6a 01                	push   $0x1
+    1864:	e8 87 36 00 00       	call   4ef0 <printf>
+    exit();
+    1869:	e8 c2 2e 00 00       	call   4730 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    186e:	50                   	push   %eax
+    186f:	50                   	push   %eax
+    1870:	68 8a 69 00 00       	push   $0x698a
+    1875:	6a 01                	push   $0x1
+    1877:	e8 74 36 00 00       	call   4ef0 <printf>
+    exit();
+    187c:	e8 af 2e 00 00       	call   4730 <exit>
+    printf(1, "read lf2 failed\n");
+    1881:	51                   	push   %ecx
+    1882:	51                   	push   %ecx
+    1883:	68 79 69 00 00       	push   $0x6979
+    1888:	6a 01                	push   $0x1
+    188a:	e8 61 36 00 00       	call   4ef0 <printf>
+    exit();
+    188f:	e8 9c 2e 00 00       	call   4730 <exit>
+    printf(1, "open lf2 failed\n");
+    1894:	53                   	push   %ebx
+    1895:	53                   	push   %ebx
+    1896:	68 68 69 00 00       	push   $0x6968
+    189b:	6a 01                	push   $0x1
+    189d:	e8 4e 36 00 00       	call   4ef0 <printf>
+    exit();
+    18a2:	e8 89 2e 00 00       	call   4730 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    18a7:	50                   	push   %eax
+    18a8:	50                   	push   %eax
+    18a9:	68 48 78 00 00       	push   $0x7848
+    18ae:	6a 01                	push   $0x1
+    18b0:	e8 3b 36 00 00       	call   4ef0 <printf>
+    exit();
+    18b5:	e8 76 2e 00 00       	call   4730 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    18ba:	51                   	push   %ecx
+    18bb:	51                   	push   %ecx
+    18bc:	68 53 69 00 00       	push   $0x6953
+    18c1:	6a 01                	push   $0x1
+    18c3:	e8 28 36 00 00       	call   4ef0 <printf>
+    exit();
+    18c8:	e8 63 2e 00 00       	call   4730 <exit>
+    printf(1, "write lf1 failed\n");
+    18cd:	50                   	push   %eax
+    18ce:	50                   	push   %eax
+    18cf:	68 41 69 00 00       	push   $0x6941
+    18d4:	6a 01                	push   $0x1
+    18d6:	e8 15 36 00 00       	call   4ef0 <printf>
+    exit();
+    18db:	e8 50 2e 00 00       	call   4730 <exit>
+
+000018e0 <concreate>:
+{
+    18e0:	55                   	push   %ebp
+    18e1:	89 e5                	mov    %esp,%ebp
+    18e3:	57                   	push   %edi
+    18e4:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+    18e5:	31 f6                	xor    %esi,%esi
+{
+    18e7:	53                   	push   %ebx
+    18e8:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+    18eb:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+    18ee:	68 d1 69 00 00       	push   $0x69d1
+    18f3:	6a 01                	push   $0x1
+    18f5:	e8 f6 35 00 00       	call   4ef0 <printf>
+  file[0] = 'C';
+    18fa:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+    18fe:	83 c4 10             	add    $0x10,%esp
+    1901:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+    1905:	eb 4c                	jmp    1953 <concreate+0x73>
+    1907:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    190e:	66 90                	xchg   %ax,%ax
+    1910:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+    1916:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+    191b:	0f 83 8f 00 00 00    	jae    19b0 <concreate+0xd0>
+      fd = open(file, O_CREATE | O_RDWR);
+    1921:	83 ec 08             	sub    $0x8,%esp
+    1924:	68 02 02 00 00       	push   $0x202
+    1929:	53                   	push   %ebx
+    192a:	e8 be 31 00 00       	call   4aed <open>
+      if(fd < 0){
+    192f:	83 c4 10             	add    $0x10,%esp
+    1932:	85 c0                	test   %eax,%eax
+    1934:	78 63                	js     1999 <concreate+0xb9>
+      close(fd);
+    1936:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    1939:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+    193c:	50                   	push   %eax
+    193d:	e8 7e 31 00 00       	call   4ac0 <close>
+    1942:	83 c4 10             	add    $0x10,%esp
+      wait();
+    1945:	e8 3a 31 00 00       	call   4a84 <wait>
+  for(i = 0; i < 40; i++){
+    194a:	83 fe 28             	cmp    $0x28,%esi
+    194d:	0f 84 7f 00 00 00    	je     19d2 <concreate+0xf2>
+    unlink(file);
+    1953:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+    1956:	8d 46 30             	lea    0x30(%esi),%eax
+    1959:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+    195c:	53                   	push   %ebx
+    195d:	e8 a9 31 00 00       	call   4b0b <unlink>
+    pid = fork();
+    1962:	e8 69 2d 00 00       	call   46d0 <fork>
+    if(pid && (i % 3) == 1){
+    1967:	83 c4 10             	add    $0x10,%esp
+    196a:	85 c0                	test   %eax,%eax
+    196c:	75 a2                	jne    1910 <concreate+0x30>
+      link("C0", file);
+    196e:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+    1974:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+    197a:	0f 83 d0 00 00 00    	jae    1a50 <concreate+0x170>
+      fd = open(file, O_CREATE | O_RDWR);
+    1980:	83 ec 08             	sub    $0x8,%esp
+    1983:	68 02 02 00 00       	push   $0x202
+    1988:	53                   	push   %ebx
+    1989:	e8 5f 31 00 00       	call   4aed <open>
+      if(fd < 0){
+    198e:	83 c4 10             	add    $0x10,%esp
+    1991:	85 c0                	test   %eax,%eax
+    1993:	0f 89 ea 01 00 00    	jns    1b83 <concreate+0x2a3>
+        printf(1, "concreate create %s failed\n", file);
+    1999:	83 ec 04             	sub    $0x4,%esp
+    199c:	53                   	push   %ebx
+    199d:	68 e4 69 00 00       	push   $0x69e4
+    19a2:	6a 01                	push   $0x1
+    19a4:	e8 47 35 00 00       	call   4ef0 <printf>
+        exit();
+    19a9:	e8 82 2d 00 00       	call   4730 <exit>
+    19ae:	66 90                	xchg   %ax,%ax
+      link("C0", file);
+    19b0:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 40; i++){
+    19b3:	83 c6 01             	add    $0x1,%esi
+      link("C0", file);
+    19b6:	53                   	push   %ebx
+    19b7:	68 e1 69 00 00       	push   $0x69e1
+    19bc:	e8 68 31 00 00       	call   4b29 <link>
+    19c1:	83 c4 10             	add    $0x10,%esp
+      wait();
+    19c4:	e8 bb 30 00 00       	call   4a84 <wait>
+  for(i = 0; i < 40; i++){
+    19c9:	83 fe 28             	cmp    $0x28,%esi
+    19cc:	0f 85 81 ff ff ff    	jne    1953 <concreate+0x73>
+  memset(fa, 0, sizeof(fa));
+    19d2:	83 ec 04             	sub    $0x4,%esp
+    19d5:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    19d8:	6a 28                	push   $0x28
+    19da:	6a 00                	push   $0x0
+    19dc:	50                   	push   %eax
+    19dd:	e8 2e 2e 00 00       	call   4810 <memset>
+  fd = open(".", 0);
+    19e2:	5e                   	pop    %esi
+    19e3:	5f                   	pop    %edi
+    19e4:	6a 00                	push   $0x0
+    19e6:	68 ee 6b 00 00       	push   $0x6bee
+    19eb:	8d 7d b0             	lea    -0x50(%ebp),%edi
+    19ee:	e8 fa 30 00 00       	call   4aed <open>
+  n = 0;
+    19f3:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    19fa:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    19fd:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    19ff:	90                   	nop
+    1a00:	83 ec 04             	sub    $0x4,%esp
+    1a03:	6a 10                	push   $0x10
+    1a05:	57                   	push   %edi
+    1a06:	56                   	push   %esi
+    1a07:	e8 96 30 00 00       	call   4aa2 <read>
+    1a0c:	83 c4 10             	add    $0x10,%esp
+    1a0f:	85 c0                	test   %eax,%eax
+    1a11:	7e 5d                	jle    1a70 <concreate+0x190>
+    if(de.inum == 0)
+    1a13:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+    1a18:	74 e6                	je     1a00 <concreate+0x120>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    1a1a:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+    1a1e:	75 e0                	jne    1a00 <concreate+0x120>
+    1a20:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+    1a24:	75 da                	jne    1a00 <concreate+0x120>
+      i = de.name[1] - '0';
+    1a26:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+    1a2a:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    1a2d:	83 f8 27             	cmp    $0x27,%eax
+    1a30:	0f 87 5e 01 00 00    	ja     1b94 <concreate+0x2b4>
+      if(fa[i]){
+    1a36:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+    1a3b:	0f 85 7e 01 00 00    	jne    1bbf <concreate+0x2df>
+      n++;
+    1a41:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+    1a45:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+    1a4a:	eb b4                	jmp    1a00 <concreate+0x120>
+    1a4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+    1a50:	83 ec 08             	sub    $0x8,%esp
+    1a53:	53                   	push   %ebx
+    1a54:	68 e1 69 00 00       	push   $0x69e1
+    1a59:	e8 cb 30 00 00       	call   4b29 <link>
+    1a5e:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1a61:	e8 ca 2c 00 00       	call   4730 <exit>
+    1a66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a6d:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+    1a70:	83 ec 0c             	sub    $0xc,%esp
+    1a73:	56                   	push   %esi
+    1a74:	e8 47 30 00 00       	call   4ac0 <close>
+  if(n != 40){
+    1a79:	83 c4 10             	add    $0x10,%esp
+    1a7c:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    1a80:	0f 85 26 01 00 00    	jne    1bac <concreate+0x2cc>
+  for(i = 0; i < 40; i++){
+    1a86:	31 f6                	xor    %esi,%esi
+    1a88:	eb 48                	jmp    1ad2 <concreate+0x1f2>
+    1a8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    1a90:	85 ff                	test   %edi,%edi
+    1a92:	74 05                	je     1a99 <concreate+0x1b9>
+    1a94:	83 f8 01             	cmp    $0x1,%eax
+    1a97:	74 68                	je     1b01 <concreate+0x221>
+      unlink(file);
+    1a99:	83 ec 0c             	sub    $0xc,%esp
+    1a9c:	53                   	push   %ebx
+    1a9d:	e8 69 30 00 00       	call   4b0b <unlink>
+      unlink(file);
+    1aa2:	89 1c 24             	mov    %ebx,(%esp)
+    1aa5:	e8 61 30 00 00       	call   4b0b <unlink>
+      unlink(file);
+    1aaa:	89 1c 24             	mov    %ebx,(%esp)
+    1aad:	e8 59 30 00 00       	call   4b0b <unlink>
+      unlink(file);
+    1ab2:	89 1c 24             	mov    %ebx,(%esp)
+    1ab5:	e8 51 30 00 00       	call   4b0b <unlink>
+    1aba:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    1abd:	85 ff                	test   %edi,%edi
+    1abf:	74 a0                	je     1a61 <concreate+0x181>
+      wait();
+    1ac1:	e8 be 2f 00 00       	call   4a84 <wait>
+  for(i = 0; i < 40; i++){
+    1ac6:	83 c6 01             	add    $0x1,%esi
+    1ac9:	83 fe 28             	cmp    $0x28,%esi
+    1acc:	0f 84 86 00 00 00    	je     1b58 <concreate+0x278>
+    file[1] = '0' + i;
+    1ad2:	8d 46 30             	lea    0x30(%esi),%eax
+    1ad5:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    1ad8:	e8 f3 2b 00 00       	call   46d0 <fork>
+    1add:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    1adf:	85 c0                	test   %eax,%eax
+    1ae1:	0f 88 88 00 00 00    	js     1b6f <concreate+0x28f>
+    if(((i % 3) == 0 && pid == 0) ||
+    1ae7:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    1aec:	f7 e6                	mul    %esi
+    1aee:	89 d0                	mov    %edx,%eax
+    1af0:	83 e2 fe             	and    $0xfffffffe,%edx
+    1af3:	d1 e8                	shr    %eax
+    1af5:	01 c2                	add    %eax,%edx
+    1af7:	89 f0                	mov    %esi,%eax
+    1af9:	29 d0                	sub    %edx,%eax
+    1afb:	89 c1                	mov    %eax,%ecx
+    1afd:	09 f9                	or     %edi,%ecx
+    1aff:	75 8f                	jne    1a90 <concreate+0x1b0>
+      close(open(file, 0));
+    1b01:	83 ec 08             	sub    $0x8,%esp
+    1b04:	6a 00                	push   $0x0
+    1b06:	53                   	push   %ebx
+    1b07:	e8 e1 2f 00 00       	call   4aed <open>
+    1b0c:	89 04 24             	mov    %eax,(%esp)
+    1b0f:	e8 ac 2f 00 00       	call   4ac0 <close>
+      close(open(file, 0));
+    1b14:	58                   	pop    %eax
+    1b15:	5a                   	pop    %edx
+    1b16:	6a 00                	push   $0x0
+    1b18:	53                   	push   %ebx
+    1b19:	e8 cf 2f 00 00       	call   4aed <open>
+    1b1e:	89 04 24             	mov    %eax,(%esp)
+    1b21:	e8 9a 2f 00 00       	call   4ac0 <close>
+      close(open(file, 0));
+    1b26:	59                   	pop    %ecx
+    1b27:	58                   	pop    %eax
+    1b28:	6a 00                	push   $0x0
+    1b2a:	53                   	push   %ebx
+    1b2b:	e8 bd 2f 00 00       	call   4aed <open>
+    1b30:	89 04 24             	mov    %eax,(%esp)
+    1b33:	e8 88 2f 00 00       	call   4ac0 <close>
+      close(open(file, 0));
+    1b38:	58                   	pop    %eax
+    1b39:	5a                   	pop    %edx
+    1b3a:	6a 00                	push   $0x0
+    1b3c:	53                   	push   %ebx
+    1b3d:	e8 ab 2f 00 00       	call   4aed <open>
+    1b42:	89 04 24             	mov    %eax,(%esp)
+    1b45:	e8 76 2f 00 00       	call   4ac0 <close>
+    1b4a:	83 c4 10             	add    $0x10,%esp
+    1b4d:	e9 6b ff ff ff       	jmp    1abd <concreate+0x1dd>
+    1b52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "concreate ok\n");
+    1b58:	83 ec 08             	sub    $0x8,%esp
+    1b5b:	68 36 6a 00 00       	push   $0x6a36
+    1b60:	6a 01                	push   $0x1
+    1b62:	e8 89 33 00 00       	call   4ef0 <printf>
+}
+    1b67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b6a:	5b                   	pop    %ebx
+    1b6b:	5e                   	pop    %esi
+    1b6c:	5f                   	pop    %edi
+    1b6d:	5d                   	pop    %ebp
+    1b6e:	c3                   	ret
+      printf(1, "fork failed\n");
+    1b6f:	83 ec 08             	sub    $0x8,%esp
+    1b72:	68 2e 72 00 00       	push   $0x722e
+    1b77:	6a 01                	push   $0x1
+    1b79:	e8 72 33 00 00       	call   4ef0 <printf>
+      exit();
+    1b7e:	e8 ad 2b 00 00       	call   4730 <exit>
+      close(fd);
+    1b83:	83 ec 0c             	sub    $0xc,%esp
+    1b86:	50                   	push   %eax
+    1b87:	e8 34 2f 00 00       	call   4ac0 <close>
+    1b8c:	83 c4 10             	add    $0x10,%esp
+    1b8f:	e9 cd fe ff ff       	jmp    1a61 <concreate+0x181>
+        printf(1, "concreate weird file %s\n", de.name);
+    1b94:	83 ec 04             	sub    $0x4,%esp
+    1b97:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1b9a:	50                   	push   %eax
+    1b9b:	68 00 6a 00 00       	push   $0x6a00
+    1ba0:	6a 01                	push   $0x1
+    1ba2:	e8 49 33 00 00       	call   4ef0 <printf>
+        exit();
+    1ba7:	e8 84 2b 00 00       	call   4730 <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    1bac:	51                   	push   %ecx
+    1bad:	51                   	push   %ecx
+    1bae:	68 94 78 00 00       	push   $0x7894
+    1bb3:	6a 01                	push   $0x1
+    1bb5:	e8 36 33 00 00       	call   4ef0 <printf>
+    exit();
+    1bba:	e8 71 2b 00 00       	call   4730 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    1bbf:	83 ec 04             	sub    $0x4,%esp
+    1bc2:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1bc5:	50                   	push   %eax
+    1bc6:	68 19 6a 00 00       	push   $0x6a19
+    1bcb:	6a 01                	push   $0x1
+    1bcd:	e8 1e 33 00 00       	call   4ef0 <printf>
+        exit();
+    1bd2:	e8 59 2b 00 00       	call   4730 <exit>
+    1bd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bde:	66 90                	xchg   %ax,%ax
+
+00001be0 <linkunlink>:
+{
+    1be0:	55                   	push   %ebp
+    1be1:	89 e5                	mov    %esp,%ebp
+    1be3:	57                   	push   %edi
+    1be4:	56                   	push   %esi
+    1be5:	53                   	push   %ebx
+    1be6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    1be9:	68 44 6a 00 00       	push   $0x6a44
+    1bee:	6a 01                	push   $0x1
+    1bf0:	e8 fb 32 00 00       	call   4ef0 <printf>
+  unlink("x");
+    1bf5:	c7 04 24 d1 6c 00 00 	movl   $0x6cd1,(%esp)
+    1bfc:	e8 0a 2f 00 00       	call   4b0b <unlink>
+  pid = fork();
+    1c01:	e8 ca 2a 00 00       	call   46d0 <fork>
+  if(pid < 0){
+    1c06:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    1c09:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    1c0c:	85 c0                	test   %eax,%eax
+    1c0e:	0f 88 b6 00 00 00    	js     1cca <linkunlink+0xea>
+  unsigned int x = (pid ? 1 : 97);
+    1c14:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    1c18:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    1c1d:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    1c22:	19 ff                	sbb    %edi,%edi
+    1c24:	83 e7 60             	and    $0x60,%edi
+    1c27:	83 c7 01             	add    $0x1,%edi
+    1c2a:	eb 1e                	jmp    1c4a <linkunlink+0x6a>
+    1c2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    1c30:	83 f8 01             	cmp    $0x1,%eax
+    1c33:	74 7b                	je     1cb0 <linkunlink+0xd0>
+      unlink("x");
+    1c35:	83 ec 0c             	sub    $0xc,%esp
+    1c38:	68 d1 6c 00 00       	push   $0x6cd1
+    1c3d:	e8 c9 2e 00 00       	call   4b0b <unlink>
+    1c42:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1c45:	83 eb 01             	sub    $0x1,%ebx
+    1c48:	74 41                	je     1c8b <linkunlink+0xab>
+    x = x * 1103515245 + 12345;
+    1c4a:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    1c50:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    1c56:	89 f8                	mov    %edi,%eax
+    1c58:	f7 e6                	mul    %esi
+    1c5a:	89 d0                	mov    %edx,%eax
+    1c5c:	83 e2 fe             	and    $0xfffffffe,%edx
+    1c5f:	d1 e8                	shr    %eax
+    1c61:	01 c2                	add    %eax,%edx
+    1c63:	89 f8                	mov    %edi,%eax
+    1c65:	29 d0                	sub    %edx,%eax
+    1c67:	75 c7                	jne    1c30 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    1c69:	83 ec 08             	sub    $0x8,%esp
+    1c6c:	68 02 02 00 00       	push   $0x202
+    1c71:	68 d1 6c 00 00       	push   $0x6cd1
+    1c76:	e8 72 2e 00 00       	call   4aed <open>
+    1c7b:	89 04 24             	mov    %eax,(%esp)
+    1c7e:	e8 3d 2e 00 00       	call   4ac0 <close>
+    1c83:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1c86:	83 eb 01             	sub    $0x1,%ebx
+    1c89:	75 bf                	jne    1c4a <linkunlink+0x6a>
+  if(pid)
+    1c8b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1c8e:	85 c0                	test   %eax,%eax
+    1c90:	74 4b                	je     1cdd <linkunlink+0xfd>
+    wait();
+    1c92:	e8 ed 2d 00 00       	call   4a84 <wait>
+  printf(1, "linkunlink ok\n");
+    1c97:	83 ec 08             	sub    $0x8,%esp
+    1c9a:	68 59 6a 00 00       	push   $0x6a59
+    1c9f:	6a 01                	push   $0x1
+    1ca1:	e8 4a 32 00 00       	call   4ef0 <printf>
+}
+    1ca6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ca9:	5b                   	pop    %ebx
+    1caa:	5e                   	pop    %esi
+    1cab:	5f                   	pop    %edi
+    1cac:	5d                   	pop    %ebp
+    1cad:	c3                   	ret
+    1cae:	66 90                	xchg   %ax,%ax
+      link("cat", "x");
+    1cb0:	83 ec 08             	sub    $0x8,%esp
+    1cb3:	68 d1 6c 00 00       	push   $0x6cd1
+    1cb8:	68 55 6a 00 00       	push   $0x6a55
+    1cbd:	e8 67 2e 00 00       	call   4b29 <link>
+    1cc2:	83 c4 10             	add    $0x10,%esp
+    1cc5:	e9 7b ff ff ff       	jmp    1c45 <linkunlink+0x65>
+    printf(1, "fork failed\n");
+    1cca:	52                   	push   %edx
+    1ccb:	52                   	push   %edx
+    1ccc:	68 2e 72 00 00       	push   $0x722e
+    1cd1:	6a 01                	push   $0x1
+    1cd3:	e8 18 32 00 00       	call   4ef0 <printf>
+    exit();
+    1cd8:	e8 53 2a 00 00       	call   4730 <exit>
+    exit();
+    1cdd:	e8 4e 2a 00 00       	call   4730 <exit>
+    1ce2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ce9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001cf0 <bigdir>:
+{
+    1cf0:	55                   	push   %ebp
+    1cf1:	89 e5                	mov    %esp,%ebp
+    1cf3:	57                   	push   %edi
+    1cf4:	56                   	push   %esi
+    1cf5:	53                   	push   %ebx
+    1cf6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    1cf9:	68 68 6a 00 00       	push   $0x6a68
+    1cfe:	6a 01                	push   $0x1
+    1d00:	e8 eb 31 00 00       	call   4ef0 <printf>
+  unlink("bd");
+    1d05:	c7 04 24 75 6a 00 00 	movl   $0x6a75,(%esp)
+    1d0c:	e8 fa 2d 00 00       	call   4b0b <unlink>
+  fd = open("bd", O_CREATE);
+    1d11:	5a                   	pop    %edx
+    1d12:	59                   	pop    %ecx
+    1d13:	68 00 02 00 00       	push   $0x200
+    1d18:	68 75 6a 00 00       	push   $0x6a75
+    1d1d:	e8 cb 2d 00 00       	call   4aed <open>
+  if(fd < 0){
+    1d22:	83 c4 10             	add    $0x10,%esp
+    1d25:	85 c0                	test   %eax,%eax
+    1d27:	0f 88 de 00 00 00    	js     1e0b <bigdir+0x11b>
+  close(fd);
+    1d2d:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    1d30:	31 f6                	xor    %esi,%esi
+    1d32:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    1d35:	50                   	push   %eax
+    1d36:	e8 85 2d 00 00       	call   4ac0 <close>
+    1d3b:	83 c4 10             	add    $0x10,%esp
+    1d3e:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    1d40:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    1d42:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    1d45:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1d49:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1d4c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1d50:	83 c0 30             	add    $0x30,%eax
+    1d53:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1d56:	89 f0                	mov    %esi,%eax
+    1d58:	83 e0 3f             	and    $0x3f,%eax
+    1d5b:	83 c0 30             	add    $0x30,%eax
+    1d5e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    1d61:	57                   	push   %edi
+    1d62:	68 75 6a 00 00       	push   $0x6a75
+    1d67:	e8 bd 2d 00 00       	call   4b29 <link>
+    1d6c:	83 c4 10             	add    $0x10,%esp
+    1d6f:	89 c3                	mov    %eax,%ebx
+    1d71:	85 c0                	test   %eax,%eax
+    1d73:	75 6e                	jne    1de3 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    1d75:	83 c6 01             	add    $0x1,%esi
+    1d78:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    1d7e:	75 c0                	jne    1d40 <bigdir+0x50>
+  unlink("bd");
+    1d80:	83 ec 0c             	sub    $0xc,%esp
+    1d83:	68 75 6a 00 00       	push   $0x6a75
+    1d88:	e8 7e 2d 00 00       	call   4b0b <unlink>
+    1d8d:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    1d90:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    1d92:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    1d95:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1d99:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1d9c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1da0:	83 c0 30             	add    $0x30,%eax
+    1da3:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1da6:	89 d8                	mov    %ebx,%eax
+    1da8:	83 e0 3f             	and    $0x3f,%eax
+    1dab:	83 c0 30             	add    $0x30,%eax
+    1dae:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    1db1:	57                   	push   %edi
+    1db2:	e8 54 2d 00 00       	call   4b0b <unlink>
+    1db7:	83 c4 10             	add    $0x10,%esp
+    1dba:	85 c0                	test   %eax,%eax
+    1dbc:	75 39                	jne    1df7 <bigdir+0x107>
+  for(i = 0; i < 500; i++){
+    1dbe:	83 c3 01             	add    $0x1,%ebx
+    1dc1:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    1dc7:	75 c7                	jne    1d90 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    1dc9:	83 ec 08             	sub    $0x8,%esp
+    1dcc:	68 b7 6a 00 00       	push   $0x6ab7
+    1dd1:	6a 01                	push   $0x1
+    1dd3:	e8 18 31 00 00       	call   4ef0 <printf>
+    1dd8:	83 c4 10             	add    $0x10,%esp
+}
+    1ddb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1dde:	5b                   	pop    %ebx
+    1ddf:	5e                   	pop    %esi
+    1de0:	5f                   	pop    %edi
+    1de1:	5d                   	pop    %ebp
+    1de2:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    1de3:	83 ec 08             	sub    $0x8,%esp
+    1de6:	68 8e 6a 00 00       	push   $0x6a8e
+    1deb:	6a 01                	push   $0x1
+    1ded:	e8 fe 30 00 00       	call   4ef0 <printf>
+      exit();
+    1df2:	e8 39 29 00 00       	call   4730 <exit>
+      printf(1, "bigdir unlink failed");
+    1df7:	83 ec 08             	sub    $0x8,%esp
+    1dfa:	68 a2 6a 00 00       	push   $0x6aa2
+    1dff:	6a 01                	push   $0x1
+    1e01:	e8 ea 30 00 00       	call   4ef0 <printf>
+      exit();
+    1e06:	e8 25 29 00 00       	call   4730 <exit>
+    printf(1, "bigdir create failed\n");
+    1e0b:	50                   	push   %eax
+    1e0c:	50                   	push   %eax
+    1e0d:	68 78 6a 00 00       	push   $0x6a78
+    1e12:	6a 01                	push   $0x1
+    1e14:	e8 d7 30 00 00       	call   4ef0 <printf>
+    exit();
+    1e19:	e8 12 29 00 00       	call   4730 <exit>
+    1e1e:	66 90                	xchg   %ax,%ax
+
+00001e20 <subdir>:
+{
+    1e20:	55                   	push   %ebp
+    1e21:	89 e5                	mov    %esp,%ebp
+    1e23:	53                   	push   %ebx
+    1e24:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    1e27:	68 c2 6a 00 00       	push   $0x6ac2
+    1e2c:	6a 01                	push   $0x1
+    1e2e:	e8 bd 30 00 00       	call   4ef0 <printf>
+  unlink("ff");
+    1e33:	c7 04 24 4b 6b 00 00 	movl   $0x6b4b,(%esp)
+    1e3a:	e8 cc 2c 00 00       	call   4b0b <unlink>
+  if(mkdir("dd") != 0){
+    1e3f:	c7 04 24 e8 6b 00 00 	movl   $0x6be8,(%esp)
+    1e46:	e8 ed 2c 00 00       	call   4b38 <mkdir>
+    1e4b:	83 c4 10             	add    $0x10,%esp
+    1e4e:	85 c0                	test   %eax,%eax
+    1e50:	0f 85 b3 05 00 00    	jne    2409 <subdir+0x5e9>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1e56:	83 ec 08             	sub    $0x8,%esp
+    1e59:	68 02 02 00 00       	push   $0x202
+    1e5e:	68 21 6b 00 00       	push   $0x6b21
+    1e63:	e8 85 2c 00 00       	call   4aed <open>
+  if(fd < 0){
+    1e68:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1e6b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1e6d:	85 c0                	test   %eax,%eax
+    1e6f:	0f 88 81 05 00 00    	js     23f6 <subdir+0x5d6>
+  write(fd, "ff", 2);
+    1e75:	83 ec 04             	sub    $0x4,%esp
+    1e78:	6a 02                	push   $0x2
+    1e7a:	68 4b 6b 00 00       	push   $0x6b4b
+    1e7f:	50                   	push   %eax
+    1e80:	e8 2c 2c 00 00       	call   4ab1 <write>
+  close(fd);
+    1e85:	89 1c 24             	mov    %ebx,(%esp)
+    1e88:	e8 33 2c 00 00       	call   4ac0 <close>
+  if(unlink("dd") >= 0){
+    1e8d:	c7 04 24 e8 6b 00 00 	movl   $0x6be8,(%esp)
+    1e94:	e8 72 2c 00 00       	call   4b0b <unlink>
+    1e99:	83 c4 10             	add    $0x10,%esp
+    1e9c:	85 c0                	test   %eax,%eax
+    1e9e:	0f 89 3f 05 00 00    	jns    23e3 <subdir+0x5c3>
+  if(mkdir("/dd/dd") != 0){
+    1ea4:	83 ec 0c             	sub    $0xc,%esp
+    1ea7:	68 fc 6a 00 00       	push   $0x6afc
+    1eac:	e8 87 2c 00 00       	call   4b38 <mkdir>
+    1eb1:	83 c4 10             	add    $0x10,%esp
+    1eb4:	85 c0                	test   %eax,%eax
+    1eb6:	0f 85 14 05 00 00    	jne    23d0 <subdir+0x5b0>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    1ebc:	83 ec 08             	sub    $0x8,%esp
+    1ebf:	68 02 02 00 00       	push   $0x202
+    1ec4:	68 1e 6b 00 00       	push   $0x6b1e
+    1ec9:	e8 1f 2c 00 00       	call   4aed <open>
+  if(fd < 0){
+    1ece:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    1ed1:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1ed3:	85 c0                	test   %eax,%eax
+    1ed5:	0f 88 24 04 00 00    	js     22ff <subdir+0x4df>
+  write(fd, "FF", 2);
+    1edb:	83 ec 04             	sub    $0x4,%esp
+    1ede:	6a 02                	push   $0x2
+    1ee0:	68 3f 6b 00 00       	push   $0x6b3f
+    1ee5:	50                   	push   %eax
+    1ee6:	e8 c6 2b 00 00       	call   4ab1 <write>
+  close(fd);
+    1eeb:	89 1c 24             	mov    %ebx,(%esp)
+    1eee:	e8 cd 2b 00 00       	call   4ac0 <close>
+  fd = open("dd/dd/../ff", 0);
+    1ef3:	58                   	pop    %eax
+    1ef4:	5a                   	pop    %edx
+    1ef5:	6a 00                	push   $0x0
+    1ef7:	68 42 6b 00 00       	push   $0x6b42
+    1efc:	e8 ec 2b 00 00       	call   4aed <open>
+  if(fd < 0){
+    1f01:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    1f04:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1f06:	85 c0                	test   %eax,%eax
+    1f08:	0f 88 de 03 00 00    	js     22ec <subdir+0x4cc>
+  cc = read(fd, buf, sizeof(buf));
+    1f0e:	83 ec 04             	sub    $0x4,%esp
+    1f11:	68 00 20 00 00       	push   $0x2000
+    1f16:	68 60 ba 00 00       	push   $0xba60
+    1f1b:	50                   	push   %eax
+    1f1c:	e8 81 2b 00 00       	call   4aa2 <read>
+  if(cc != 2 || buf[0] != 'f'){
+    1f21:	83 c4 10             	add    $0x10,%esp
+    1f24:	83 f8 02             	cmp    $0x2,%eax
+    1f27:	0f 85 3a 03 00 00    	jne    2267 <subdir+0x447>
+    1f2d:	80 3d 60 ba 00 00 66 	cmpb   $0x66,0xba60
+    1f34:	0f 85 2d 03 00 00    	jne    2267 <subdir+0x447>
+  close(fd);
+    1f3a:	83 ec 0c             	sub    $0xc,%esp
+    1f3d:	53                   	push   %ebx
+    1f3e:	e8 7d 2b 00 00       	call   4ac0 <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    1f43:	59                   	pop    %ecx
+    1f44:	5b                   	pop    %ebx
+    1f45:	68 82 6b 00 00       	push   $0x6b82
+    1f4a:	68 1e 6b 00 00       	push   $0x6b1e
+    1f4f:	e8 d5 2b 00 00       	call   4b29 <link>
+    1f54:	83 c4 10             	add    $0x10,%esp
+    1f57:	85 c0                	test   %eax,%eax
+    1f59:	0f 85 c6 03 00 00    	jne    2325 <subdir+0x505>
+  if(unlink("dd/dd/ff") != 0){
+    1f5f:	83 ec 0c             	sub    $0xc,%esp
+    1f62:	68 1e 6b 00 00       	push   $0x6b1e
+    1f67:	e8 9f 2b 00 00       	call   4b0b <unlink>
+    1f6c:	83 c4 10             	add    $0x10,%esp
+    1f6f:	85 c0                	test   %eax,%eax
+    1f71:	0f 85 16 03 00 00    	jne    228d <subdir+0x46d>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    1f77:	83 ec 08             	sub    $0x8,%esp
+    1f7a:	6a 00                	push   $0x0
+    1f7c:	68 1e 6b 00 00       	push   $0x6b1e
+    1f81:	e8 67 2b 00 00       	call   4aed <open>
+    1f86:	83 c4 10             	add    $0x10,%esp
+    1f89:	85 c0                	test   %eax,%eax
+    1f8b:	0f 89 2c 04 00 00    	jns    23bd <subdir+0x59d>
+  if(chdir("dd") != 0){
+    1f91:	83 ec 0c             	sub    $0xc,%esp
+    1f94:	68 e8 6b 00 00       	push   $0x6be8
+    1f99:	e8 a9 2b 00 00       	call   4b47 <chdir>
+    1f9e:	83 c4 10             	add    $0x10,%esp
+    1fa1:	85 c0                	test   %eax,%eax
+    1fa3:	0f 85 01 04 00 00    	jne    23aa <subdir+0x58a>
+  if(chdir("dd/../../dd") != 0){
+    1fa9:	83 ec 0c             	sub    $0xc,%esp
+    1fac:	68 b6 6b 00 00       	push   $0x6bb6
+    1fb1:	e8 91 2b 00 00       	call   4b47 <chdir>
+    1fb6:	83 c4 10             	add    $0x10,%esp
+    1fb9:	85 c0                	test   %eax,%eax
+    1fbb:	0f 85 b9 02 00 00    	jne    227a <subdir+0x45a>
+  if(chdir("dd/../../../dd") != 0){
+    1fc1:	83 ec 0c             	sub    $0xc,%esp
+    1fc4:	68 dc 6b 00 00       	push   $0x6bdc
+    1fc9:	e8 79 2b 00 00       	call   4b47 <chdir>
+    1fce:	83 c4 10             	add    $0x10,%esp
+    1fd1:	85 c0                	test   %eax,%eax
+    1fd3:	0f 85 a1 02 00 00    	jne    227a <subdir+0x45a>
+  if(chdir("./..") != 0){
+    1fd9:	83 ec 0c             	sub    $0xc,%esp
+    1fdc:	68 eb 6b 00 00       	push   $0x6beb
+    1fe1:	e8 61 2b 00 00       	call   4b47 <chdir>
+    1fe6:	83 c4 10             	add    $0x10,%esp
+    1fe9:	85 c0                	test   %eax,%eax
+    1feb:	0f 85 21 03 00 00    	jne    2312 <subdir+0x4f2>
+  fd = open("dd/dd/ffff", 0);
+    1ff1:	83 ec 08             	sub    $0x8,%esp
+    1ff4:	6a 00                	push   $0x0
+    1ff6:	68 82 6b 00 00       	push   $0x6b82
+    1ffb:	e8 ed 2a 00 00       	call   4aed <open>
+  if(fd < 0){
+    2000:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    2003:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2005:	85 c0                	test   %eax,%eax
+    2007:	0f 88 e0 04 00 00    	js     24ed <subdir+0x6cd>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    200d:	83 ec 04             	sub    $0x4,%esp
+    2010:	68 00 20 00 00       	push   $0x2000
+    2015:	68 60 ba 00 00       	push   $0xba60
+    201a:	50                   	push   %eax
+    201b:	e8 82 2a 00 00       	call   4aa2 <read>
+    2020:	83 c4 10             	add    $0x10,%esp
+    2023:	83 f8 02             	cmp    $0x2,%eax
+    2026:	0f 85 ae 04 00 00    	jne    24da <subdir+0x6ba>
+  close(fd);
+    202c:	83 ec 0c             	sub    $0xc,%esp
+    202f:	53                   	push   %ebx
+    2030:	e8 8b 2a 00 00       	call   4ac0 <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2035:	58                   	pop    %eax
+    2036:	5a                   	pop    %edx
+    2037:	6a 00                	push   $0x0
+    2039:	68 1e 6b 00 00       	push   $0x6b1e
+    203e:	e8 aa 2a 00 00       	call   4aed <open>
+    2043:	83 c4 10             	add    $0x10,%esp
+    2046:	85 c0                	test   %eax,%eax
+    2048:	0f 89 65 02 00 00    	jns    22b3 <subdir+0x493>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    204e:	83 ec 08             	sub    $0x8,%esp
+    2051:	68 02 02 00 00       	push   $0x202
+    2056:	68 36 6c 00 00       	push   $0x6c36
+    205b:	e8 8d 2a 00 00       	call   4aed <open>
+    2060:	83 c4 10             	add    $0x10,%esp
+    2063:	85 c0                	test   %eax,%eax
+    2065:	0f 89 35 02 00 00    	jns    22a0 <subdir+0x480>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    206b:	83 ec 08             	sub    $0x8,%esp
+    206e:	68 02 02 00 00       	push   $0x202
+    2073:	68 5b 6c 00 00       	push   $0x6c5b
+    2078:	e8 70 2a 00 00       	call   4aed <open>
+    207d:	83 c4 10             	add    $0x10,%esp
+    2080:	85 c0                	test   %eax,%eax
+    2082:	0f 89 0f 03 00 00    	jns    2397 <subdir+0x577>
+  if(open("dd", O_CREATE) >= 0){
+    2088:	83 ec 08             	sub    $0x8,%esp
+    208b:	68 00 02 00 00       	push   $0x200
+    2090:	68 e8 6b 00 00       	push   $0x6be8
+    2095:	e8 53 2a 00 00       	call   4aed <open>
+    209a:	83 c4 10             	add    $0x10,%esp
+    209d:	85 c0                	test   %eax,%eax
+    209f:	0f 89 df 02 00 00    	jns    2384 <subdir+0x564>
+  if(open("dd", O_RDWR) >= 0){
+    20a5:	83 ec 08             	sub    $0x8,%esp
+    20a8:	6a 02                	push   $0x2
+    20aa:	68 e8 6b 00 00       	push   $0x6be8
+    20af:	e8 39 2a 00 00       	call   4aed <open>
+    20b4:	83 c4 10             	add    $0x10,%esp
+    20b7:	85 c0                	test   %eax,%eax
+    20b9:	0f 89 b2 02 00 00    	jns    2371 <subdir+0x551>
+  if(open("dd", O_WRONLY) >= 0){
+    20bf:	83 ec 08             	sub    $0x8,%esp
+    20c2:	6a 01                	push   $0x1
+    20c4:	68 e8 6b 00 00       	push   $0x6be8
+    20c9:	e8 1f 2a 00 00       	call   4aed <open>
+    20ce:	83 c4 10             	add    $0x10,%esp
+    20d1:	85 c0                	test   %eax,%eax
+    20d3:	0f 89 85 02 00 00    	jns    235e <subdir+0x53e>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    20d9:	83 ec 08             	sub    $0x8,%esp
+    20dc:	68 ca 6c 00 00       	push   $0x6cca
+    20e1:	68 36 6c 00 00       	push   $0x6c36
+    20e6:	e8 3e 2a 00 00       	call   4b29 <link>
+    20eb:	83 c4 10             	add    $0x10,%esp
+    20ee:	85 c0                	test   %eax,%eax
+    20f0:	0f 84 55 02 00 00    	je     234b <subdir+0x52b>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    20f6:	83 ec 08             	sub    $0x8,%esp
+    20f9:	68 ca 6c 00 00       	push   $0x6cca
+    20fe:	68 5b 6c 00 00       	push   $0x6c5b
+    2103:	e8 21 2a 00 00       	call   4b29 <link>
+    2108:	83 c4 10             	add    $0x10,%esp
+    210b:	85 c0                	test   %eax,%eax
+    210d:	0f 84 25 02 00 00    	je     2338 <subdir+0x518>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    2113:	83 ec 08             	sub    $0x8,%esp
+    2116:	68 82 6b 00 00       	push   $0x6b82
+    211b:	68 21 6b 00 00       	push   $0x6b21
+    2120:	e8 04 2a 00 00       	call   4b29 <link>
+    2125:	83 c4 10             	add    $0x10,%esp
+    2128:	85 c0                	test   %eax,%eax
+    212a:	0f 84 a9 01 00 00    	je     22d9 <subdir+0x4b9>
+  if(mkdir("dd/ff/ff") == 0){
+    2130:	83 ec 0c             	sub    $0xc,%esp
+    2133:	68 36 6c 00 00       	push   $0x6c36
+    2138:	e8 fb 29 00 00       	call   4b38 <mkdir>
+    213d:	83 c4 10             	add    $0x10,%esp
+    2140:	85 c0                	test   %eax,%eax
+    2142:	0f 84 7e 01 00 00    	je     22c6 <subdir+0x4a6>
+  if(mkdir("dd/xx/ff") == 0){
+    2148:	83 ec 0c             	sub    $0xc,%esp
+    214b:	68 5b 6c 00 00       	push   $0x6c5b
+    2150:	e8 e3 29 00 00       	call   4b38 <mkdir>
+    2155:	83 c4 10             	add    $0x10,%esp
+    2158:	85 c0                	test   %eax,%eax
+    215a:	0f 84 67 03 00 00    	je     24c7 <subdir+0x6a7>
+  if(mkdir("dd/dd/ffff") == 0){
+    2160:	83 ec 0c             	sub    $0xc,%esp
+    2163:	68 82 6b 00 00       	push   $0x6b82
+    2168:	e8 cb 29 00 00       	call   4b38 <mkdir>
+    216d:	83 c4 10             	add    $0x10,%esp
+    2170:	85 c0                	test   %eax,%eax
+    2172:	0f 84 3c 03 00 00    	je     24b4 <subdir+0x694>
+  if(unlink("dd/xx/ff") == 0){
+    2178:	83 ec 0c             	sub    $0xc,%esp
+    217b:	68 5b 6c 00 00       	push   $0x6c5b
+    2180:	e8 86 29 00 00       	call   4b0b <unlink>
+    2185:	83 c4 10             	add    $0x10,%esp
+    2188:	85 c0                	test   %eax,%eax
+    218a:	0f 84 11 03 00 00    	je     24a1 <subdir+0x681>
+  if(unlink("dd/ff/ff") == 0){
+    2190:	83 ec 0c             	sub    $0xc,%esp
+    2193:	68 36 6c 00 00       	push   $0x6c36
+    2198:	e8 6e 29 00 00       	call   4b0b <unlink>
+    219d:	83 c4 10             	add    $0x10,%esp
+    21a0:	85 c0                	test   %eax,%eax
+    21a2:	0f 84 e6 02 00 00    	je     248e <subdir+0x66e>
+  if(chdir("dd/ff") == 0){
+    21a8:	83 ec 0c             	sub    $0xc,%esp
+    21ab:	68 21 6b 00 00       	push   $0x6b21
+    21b0:	e8 92 29 00 00       	call   4b47 <chdir>
+    21b5:	83 c4 10             	add    $0x10,%esp
+    21b8:	85 c0                	test   %eax,%eax
+    21ba:	0f 84 bb 02 00 00    	je     247b <subdir+0x65b>
+  if(chdir("dd/xx") == 0){
+    21c0:	83 ec 0c             	sub    $0xc,%esp
+    21c3:	68 cd 6c 00 00       	push   $0x6ccd
+    21c8:	e8 7a 29 00 00       	call   4b47 <chdir>
+    21cd:	83 c4 10             	add    $0x10,%esp
+    21d0:	85 c0                	test   %eax,%eax
+    21d2:	0f 84 90 02 00 00    	je     2468 <subdir+0x648>
+  if(unlink("dd/dd/ffff") != 0){
+    21d8:	83 ec 0c             	sub    $0xc,%esp
+    21db:	68 82 6b 00 00       	push   $0x6b82
+    21e0:	e8 26 29 00 00       	call   4b0b <unlink>
+    21e5:	83 c4 10             	add    $0x10,%esp
+    21e8:	85 c0                	test   %eax,%eax
+    21ea:	0f 85 9d 00 00 00    	jne    228d <subdir+0x46d>
+  if(unlink("dd/ff") != 0){
+    21f0:	83 ec 0c             	sub    $0xc,%esp
+    21f3:	68 21 6b 00 00       	push   $0x6b21
+    21f8:	e8 0e 29 00 00       	call   4b0b <unlink>
+    21fd:	83 c4 10             	add    $0x10,%esp
+    2200:	85 c0                	test   %eax,%eax
+    2202:	0f 85 4d 02 00 00    	jne    2455 <subdir+0x635>
+  if(unlink("dd") == 0){
+    2208:	83 ec 0c             	sub    $0xc,%esp
+    220b:	68 e8 6b 00 00       	push   $0x6be8
+    2210:	e8 f6 28 00 00       	call   4b0b <unlink>
+    2215:	83 c4 10             	add    $0x10,%esp
+    2218:	85 c0                	test   %eax,%eax
+    221a:	0f 84 22 02 00 00    	je     2442 <subdir+0x622>
+  if(unlink("dd/dd") < 0){
+    2220:	83 ec 0c             	sub    $0xc,%esp
+    2223:	68 fd 6a 00 00       	push   $0x6afd
+    2228:	e8 de 28 00 00       	call   4b0b <unlink>
+    222d:	83 c4 10             	add    $0x10,%esp
+    2230:	85 c0                	test   %eax,%eax
+    2232:	0f 88 f7 01 00 00    	js     242f <subdir+0x60f>
+  if(unlink("dd") < 0){
+    2238:	83 ec 0c             	sub    $0xc,%esp
+    223b:	68 e8 6b 00 00       	push   $0x6be8
+    2240:	e8 c6 28 00 00       	call   4b0b <unlink>
+    2245:	83 c4 10             	add    $0x10,%esp
+    2248:	85 c0                	test   %eax,%eax
+    224a:	0f 88 cc 01 00 00    	js     241c <subdir+0x5fc>
+  printf(1, "subdir ok\n");
+    2250:	83 ec 08             	sub    $0x8,%esp
+    2253:	68 ca 6d 00 00       	push   $0x6dca
+    2258:	6a 01                	push   $0x1
+    225a:	e8 91 2c 00 00       	call   4ef0 <printf>
+}
+    225f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2262:	83 c4 10             	add    $0x10,%esp
+    2265:	c9                   	leave
+    2266:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    2267:	50                   	push   %eax
+    2268:	50                   	push   %eax
+    2269:	68 67 6b 00 00       	push   $0x6b67
+    226e:	6a 01                	push   $0x1
+    2270:	e8 7b 2c 00 00       	call   4ef0 <printf>
+    exit();
+    2275:	e8 b6 24 00 00       	call   4730 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    227a:	50                   	push   %eax
+    227b:	50                   	push   %eax
+    227c:	68 c2 6b 00 00       	push   $0x6bc2
+    2281:	6a 01                	push   $0x1
+    2283:	e8 68 2c 00 00       	call   4ef0 <printf>
+    exit();
+    2288:	e8 a3 24 00 00       	call   4730 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    228d:	50                   	push   %eax
+    228e:	50                   	push   %eax
+    228f:	68 8d 6b 00 00       	push   $0x6b8d
+    2294:	6a 01                	push   $0x1
+    2296:	e8 55 2c 00 00       	call   4ef0 <printf>
+    exit();
+    229b:	e8 90 24 00 00       	call   4730 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    22a0:	51                   	push   %ecx
+    22a1:	51                   	push   %ecx
+    22a2:	68 3f 6c 00 00       	push   $0x6c3f
+    22a7:	6a 01                	push   $0x1
+    22a9:	e8 42 2c 00 00       	call   4ef0 <printf>
+    exit();
+    22ae:	e8 7d 24 00 00       	call   4730 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    22b3:	53                   	push   %ebx
+    22b4:	53                   	push   %ebx
+    22b5:	68 38 79 00 00       	push   $0x7938
+    22ba:	6a 01                	push   $0x1
+    22bc:	e8 2f 2c 00 00       	call   4ef0 <printf>
+    exit();
+    22c1:	e8 6a 24 00 00       	call   4730 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    22c6:	51                   	push   %ecx
+    22c7:	51                   	push   %ecx
+    22c8:	68 d3 6c 00 00       	push   $0x6cd3
+    22cd:	6a 01                	push   $0x1
+    22cf:	e8 1c 2c 00 00       	call   4ef0 <printf>
+    exit();
+    22d4:	e8 57 24 00 00       	call   4730 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    22d9:	53                   	push   %ebx
+    22da:	53                   	push   %ebx
+    22db:	68 a8 79 00 00       	push   $0x79a8
+    22e0:	6a 01                	push   $0x1
+    22e2:	e8 09 2c 00 00       	call   4ef0 <printf>
+    exit();
+    22e7:	e8 44 24 00 00       	call   4730 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    22ec:	50                   	push   %eax
+    22ed:	50                   	push   %eax
+    22ee:	68 4e 6b 00 00       	push   $0x6b4e
+    22f3:	6a 01                	push   $0x1
+    22f5:	e8 f6 2b 00 00       	call   4ef0 <printf>
+    exit();
+    22fa:	e8 31 24 00 00       	call   4730 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    22ff:	51                   	push   %ecx
+    2300:	51                   	push   %ecx
+    2301:	68 27 6b 00 00       	push   $0x6b27
+    2306:	6a 01                	push   $0x1
+    2308:	e8 e3 2b 00 00       	call   4ef0 <printf>
+    exit();
+    230d:	e8 1e 24 00 00       	call   4730 <exit>
+    printf(1, "chdir ./.. failed\n");
+    2312:	50                   	push   %eax
+    2313:	50                   	push   %eax
+    2314:	68 f0 6b 00 00       	push   $0x6bf0
+    2319:	6a 01                	push   $0x1
+    231b:	e8 d0 2b 00 00       	call   4ef0 <printf>
+    exit();
+    2320:	e8 0b 24 00 00       	call   4730 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    2325:	52                   	push   %edx
+    2326:	52                   	push   %edx
+    2327:	68 f0 78 00 00       	push   $0x78f0
+    232c:	6a 01                	push   $0x1
+    232e:	e8 bd 2b 00 00       	call   4ef0 <printf>
+    exit();
+    2333:	e8 f8 23 00 00       	call   4730 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    2338:	50                   	push   %eax
+    2339:	50                   	push   %eax
+    233a:	68 84 79 00 00       	push   $0x7984
+    233f:	6a 01                	push   $0x1
+    2341:	e8 aa 2b 00 00       	call   4ef0 <printf>
+    exit();
+    2346:	e8 e5 23 00 00       	call   4730 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    234b:	50                   	push   %eax
+    234c:	50                   	push   %eax
+    234d:	68 60 79 00 00       	push   $0x7960
+    2352:	6a 01                	push   $0x1
+    2354:	e8 97 2b 00 00       	call   4ef0 <printf>
+    exit();
+    2359:	e8 d2 23 00 00       	call   4730 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    235e:	50                   	push   %eax
+    235f:	50                   	push   %eax
+    2360:	68 af 6c 00 00       	push   $0x6caf
+    2365:	6a 01                	push   $0x1
+    2367:	e8 84 2b 00 00       	call   4ef0 <printf>
+    exit();
+    236c:	e8 bf 23 00 00       	call   4730 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    2371:	50                   	push   %eax
+    2372:	50                   	push   %eax
+    2373:	68 96 6c 00 00       	push   $0x6c96
+    2378:	6a 01                	push   $0x1
+    237a:	e8 71 2b 00 00       	call   4ef0 <printf>
+    exit();
+    237f:	e8 ac 23 00 00       	call   4730 <exit>
+    printf(1, "create dd succeeded!\n");
+    2384:	50                   	push   %eax
+    2385:	50                   	push   %eax
+    2386:	68 80 6c 00 00       	push   $0x6c80
+    238b:	6a 01                	push   $0x1
+    238d:	e8 5e 2b 00 00       	call   4ef0 <printf>
+    exit();
+    2392:	e8 99 23 00 00       	call   4730 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    2397:	52                   	push   %edx
+    2398:	52                   	push   %edx
+    2399:	68 64 6c 00 00       	push   $0x6c64
+    239e:	6a 01                	push   $0x1
+    23a0:	e8 4b 2b 00 00       	call   4ef0 <printf>
+    exit();
+    23a5:	e8 86 23 00 00       	call   4730 <exit>
+    printf(1, "chdir dd failed\n");
+    23aa:	50                   	push   %eax
+    23ab:	50                   	push   %eax
+    23ac:	68 a5 6b 00 00       	push   $0x6ba5
+    23b1:	6a 01                	push   $0x1
+    23b3:	e8 38 2b 00 00       	call   4ef0 <printf>
+    exit();
+    23b8:	e8 73 23 00 00       	call   4730 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    23bd:	50                   	push   %eax
+    23be:	50                   	push   %eax
+    23bf:	68 14 79 00 00       	push   $0x7914
+    23c4:	6a 01                	push   $0x1
+    23c6:	e8 25 2b 00 00       	call   4ef0 <printf>
+    exit();
+    23cb:	e8 60 23 00 00       	call   4730 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    23d0:	53                   	push   %ebx
+    23d1:	53                   	push   %ebx
+    23d2:	68 03 6b 00 00       	push   $0x6b03
+    23d7:	6a 01                	push   $0x1
+    23d9:	e8 12 2b 00 00       	call   4ef0 <printf>
+    exit();
+    23de:	e8 4d 23 00 00       	call   4730 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    23e3:	50                   	push   %eax
+    23e4:	50                   	push   %eax
+    23e5:	68 c8 78 00 00       	push   $0x78c8
+    23ea:	6a 01                	push   $0x1
+    23ec:	e8 ff 2a 00 00       	call   4ef0 <printf>
+    exit();
+    23f1:	e8 3a 23 00 00       	call   4730 <exit>
+    printf(1, "create dd/ff failed\n");
+    23f6:	50                   	push   %eax
+    23f7:	50                   	push   %eax
+    23f8:	68 e7 6a 00 00       	push   $0x6ae7
+    23fd:	6a 01                	push   $0x1
+    23ff:	e8 ec 2a 00 00       	call   4ef0 <printf>
+    exit();
+    2404:	e8 27 23 00 00       	call   4730 <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    2409:	50                   	push   %eax
+    240a:	50                   	push   %eax
+    240b:	68 cf 6a 00 00       	push   $0x6acf
+    2410:	6a 01                	push   $0x1
+    2412:	e8 d9 2a 00 00       	call   4ef0 <printf>
+    exit();
+    2417:	e8 14 23 00 00       	call   4730 <exit>
+    printf(1, "unlink dd failed\n");
+    241c:	50                   	push   %eax
+    241d:	50                   	push   %eax
+    241e:	68 b8 6d 00 00       	push   $0x6db8
+    2423:	6a 01                	push   $0x1
+    2425:	e8 c6 2a 00 00       	call   4ef0 <printf>
+    exit();
+    242a:	e8 01 23 00 00       	call   4730 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    242f:	52                   	push   %edx
+    2430:	52                   	push   %edx
+    2431:	68 a3 6d 00 00       	push   $0x6da3
+    2436:	6a 01                	push   $0x1
+    2438:	e8 b3 2a 00 00       	call   4ef0 <printf>
+    exit();
+    243d:	e8 ee 22 00 00       	call   4730 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    2442:	51                   	push   %ecx
+    2443:	51                   	push   %ecx
+    2444:	68 cc 79 00 00       	push   $0x79cc
+    2449:	6a 01                	push   $0x1
+    244b:	e8 a0 2a 00 00       	call   4ef0 <printf>
+    exit();
+    2450:	e8 db 22 00 00       	call   4730 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    2455:	53                   	push   %ebx
+    2456:	53                   	push   %ebx
+    2457:	68 8e 6d 00 00       	push   $0x6d8e
+    245c:	6a 01                	push   $0x1
+    245e:	e8 8d 2a 00 00       	call   4ef0 <printf>
+    exit();
+    2463:	e8 c8 22 00 00       	call   4730 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    2468:	50                   	push   %eax
+    2469:	50                   	push   %eax
+    246a:	68 76 6d 00 00       	push   $0x6d76
+    246f:	6a 01                	push   $0x1
+    2471:	e8 7a 2a 00 00       	call   4ef0 <printf>
+    exit();
+    2476:	e8 b5 22 00 00       	call   4730 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    247b:	50                   	push   %eax
+    247c:	50                   	push   %eax
+    247d:	68 5e 6d 00 00       	push   $0x6d5e
+    2482:	6a 01                	push   $0x1
+    2484:	e8 67 2a 00 00       	call   4ef0 <printf>
+    exit();
+    2489:	e8 a2 22 00 00       	call   4730 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    248e:	50                   	push   %eax
+    248f:	50                   	push   %eax
+    2490:	68 42 6d 00 00       	push   $0x6d42
+    2495:	6a 01                	push   $0x1
+    2497:	e8 54 2a 00 00       	call   4ef0 <printf>
+    exit();
+    249c:	e8 8f 22 00 00       	call   4730 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    24a1:	50                   	push   %eax
+    24a2:	50                   	push   %eax
+    24a3:	68 26 6d 00 00       	push   $0x6d26
+    24a8:	6a 01                	push   $0x1
+    24aa:	e8 41 2a 00 00       	call   4ef0 <printf>
+    exit();
+    24af:	e8 7c 22 00 00       	call   4730 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    24b4:	50                   	push   %eax
+    24b5:	50                   	push   %eax
+    24b6:	68 09 6d 00 00       	push   $0x6d09
+    24bb:	6a 01                	push   $0x1
+    24bd:	e8 2e 2a 00 00       	call   4ef0 <printf>
+    exit();
+    24c2:	e8 69 22 00 00       	call   4730 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    24c7:	52                   	push   %edx
+    24c8:	52                   	push   %edx
+    24c9:	68 ee 6c 00 00       	push   $0x6cee
+    24ce:	6a 01                	push   $0x1
+    24d0:	e8 1b 2a 00 00       	call   4ef0 <printf>
+    exit();
+    24d5:	e8 56 22 00 00       	call   4730 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    24da:	51                   	push   %ecx
+    24db:	51                   	push   %ecx
+    24dc:	68 1b 6c 00 00       	push   $0x6c1b
+    24e1:	6a 01                	push   $0x1
+    24e3:	e8 08 2a 00 00       	call   4ef0 <printf>
+    exit();
+    24e8:	e8 43 22 00 00       	call   4730 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    24ed:	53                   	push   %ebx
+    24ee:	53                   	push   %ebx
+    24ef:	68 03 6c 00 00       	push   $0x6c03
+    24f4:	6a 01                	push   $0x1
+    24f6:	e8 f5 29 00 00       	call   4ef0 <printf>
+    exit();
+    24fb:	e8 30 22 00 00       	call   4730 <exit>
+
+00002500 <bigwrite>:
+{
+    2500:	55                   	push   %ebp
+    2501:	89 e5                	mov    %esp,%ebp
+    2503:	56                   	push   %esi
+    2504:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+    2505:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    250a:	83 ec 08             	sub    $0x8,%esp
+    250d:	68 d5 6d 00 00       	push   $0x6dd5
+    2512:	6a 01                	push   $0x1
+    2514:	e8 d7 29 00 00       	call   4ef0 <printf>
+  unlink("bigwrite");
+    2519:	c7 04 24 e4 6d 00 00 	movl   $0x6de4,(%esp)
+    2520:	e8 e6 25 00 00       	call   4b0b <unlink>
+    2525:	83 c4 10             	add    $0x10,%esp
+    2528:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    252f:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2530:	83 ec 08             	sub    $0x8,%esp
+    2533:	68 02 02 00 00       	push   $0x202
+    2538:	68 e4 6d 00 00       	push   $0x6de4
+    253d:	e8 ab 25 00 00       	call   4aed <open>
+    if(fd < 0){
+    2542:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2545:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    2547:	85 c0                	test   %eax,%eax
+    2549:	78 7e                	js     25c9 <bigwrite+0xc9>
+      int cc = write(fd, buf, sz);
+    254b:	83 ec 04             	sub    $0x4,%esp
+    254e:	53                   	push   %ebx
+    254f:	68 60 ba 00 00       	push   $0xba60
+    2554:	50                   	push   %eax
+    2555:	e8 57 25 00 00       	call   4ab1 <write>
+      if(cc != sz){
+    255a:	83 c4 10             	add    $0x10,%esp
+    255d:	39 d8                	cmp    %ebx,%eax
+    255f:	75 55                	jne    25b6 <bigwrite+0xb6>
+      int cc = write(fd, buf, sz);
+    2561:	83 ec 04             	sub    $0x4,%esp
+    2564:	53                   	push   %ebx
+    2565:	68 60 ba 00 00       	push   $0xba60
+    256a:	56                   	push   %esi
+    256b:	e8 41 25 00 00       	call   4ab1 <write>
+      if(cc != sz){
+    2570:	83 c4 10             	add    $0x10,%esp
+    2573:	39 c3                	cmp    %eax,%ebx
+    2575:	75 3f                	jne    25b6 <bigwrite+0xb6>
+    close(fd);
+    2577:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    257a:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    2580:	56                   	push   %esi
+    2581:	e8 3a 25 00 00       	call   4ac0 <close>
+    unlink("bigwrite");
+    2586:	c7 04 24 e4 6d 00 00 	movl   $0x6de4,(%esp)
+    258d:	e8 79 25 00 00       	call   4b0b <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    2592:	83 c4 10             	add    $0x10,%esp
+    2595:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    259b:	75 93                	jne    2530 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+    259d:	83 ec 08             	sub    $0x8,%esp
+    25a0:	68 17 6e 00 00       	push   $0x6e17
+    25a5:	6a 01                	push   $0x1
+    25a7:	e8 44 29 00 00       	call   4ef0 <printf>
+}
+    25ac:	83 c4 10             	add    $0x10,%esp
+    25af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    25b2:	5b                   	pop    %ebx
+    25b3:	5e                   	pop    %esi
+    25b4:	5d                   	pop    %ebp
+    25b5:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    25b6:	50                   	push   %eax
+    25b7:	53                   	push   %ebx
+    25b8:	68 05 6e 00 00       	push   $0x6e05
+    25bd:	6a 01                	push   $0x1
+    25bf:	e8 2c 29 00 00       	call   4ef0 <printf>
+        exit();
+    25c4:	e8 67 21 00 00       	call   4730 <exit>
+      printf(1, "cannot create bigwrite\n");
+    25c9:	83 ec 08             	sub    $0x8,%esp
+    25cc:	68 ed 6d 00 00       	push   $0x6ded
+    25d1:	6a 01                	push   $0x1
+    25d3:	e8 18 29 00 00       	call   4ef0 <printf>
+      exit();
+    25d8:	e8 53 21 00 00       	call   4730 <exit>
+    25dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000025e0 <bigfile>:
+{
+    25e0:	55                   	push   %ebp
+    25e1:	89 e5                	mov    %esp,%ebp
+    25e3:	57                   	push   %edi
+    25e4:	56                   	push   %esi
+    25e5:	53                   	push   %ebx
+    25e6:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+    25e9:	68 24 6e 00 00       	push   $0x6e24
+    25ee:	6a 01                	push   $0x1
+    25f0:	e8 fb 28 00 00       	call   4ef0 <printf>
+  unlink("bigfile");
+    25f5:	c7 04 24 40 6e 00 00 	movl   $0x6e40,(%esp)
+    25fc:	e8 0a 25 00 00       	call   4b0b <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    2601:	58                   	pop    %eax
+    2602:	5a                   	pop    %edx
+    2603:	68 02 02 00 00       	push   $0x202
+    2608:	68 40 6e 00 00       	push   $0x6e40
+    260d:	e8 db 24 00 00       	call   4aed <open>
+  if(fd < 0){
+    2612:	83 c4 10             	add    $0x10,%esp
+    2615:	85 c0                	test   %eax,%eax
+    2617:	0f 88 5e 01 00 00    	js     277b <bigfile+0x19b>
+    261d:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    261f:	31 db                	xor    %ebx,%ebx
+    2621:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+    2628:	83 ec 04             	sub    $0x4,%esp
+    262b:	68 58 02 00 00       	push   $0x258
+    2630:	53                   	push   %ebx
+    2631:	68 60 ba 00 00       	push   $0xba60
+    2636:	e8 d5 21 00 00       	call   4810 <memset>
+    if(write(fd, buf, 600) != 600){
+    263b:	83 c4 0c             	add    $0xc,%esp
+    263e:	68 58 02 00 00       	push   $0x258
+    2643:	68 60 ba 00 00       	push   $0xba60
+    2648:	56                   	push   %esi
+    2649:	e8 63 24 00 00       	call   4ab1 <write>
+    264e:	83 c4 10             	add    $0x10,%esp
+    2651:	3d 58 02 00 00       	cmp    $0x258,%eax
+    2656:	0f 85 f8 00 00 00    	jne    2754 <bigfile+0x174>
+  for(i = 0; i < 20; i++){
+    265c:	83 c3 01             	add    $0x1,%ebx
+    265f:	83 fb 14             	cmp    $0x14,%ebx
+    2662:	75 c4                	jne    2628 <bigfile+0x48>
+  close(fd);
+    2664:	83 ec 0c             	sub    $0xc,%esp
+    2667:	56                   	push   %esi
+    2668:	e8 53 24 00 00       	call   4ac0 <close>
+  fd = open("bigfile", 0);
+    266d:	5e                   	pop    %esi
+    266e:	5f                   	pop    %edi
+    266f:	6a 00                	push   $0x0
+    2671:	68 40 6e 00 00       	push   $0x6e40
+    2676:	e8 72 24 00 00       	call   4aed <open>
+  if(fd < 0){
+    267b:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    267e:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    2680:	85 c0                	test   %eax,%eax
+    2682:	0f 88 e0 00 00 00    	js     2768 <bigfile+0x188>
+  total = 0;
+    2688:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+    268a:	31 ff                	xor    %edi,%edi
+    268c:	eb 30                	jmp    26be <bigfile+0xde>
+    268e:	66 90                	xchg   %ax,%ax
+    if(cc != 300){
+    2690:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    2695:	0f 85 91 00 00 00    	jne    272c <bigfile+0x14c>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    269b:	89 fa                	mov    %edi,%edx
+    269d:	0f be 05 60 ba 00 00 	movsbl 0xba60,%eax
+    26a4:	d1 fa                	sar    %edx
+    26a6:	39 d0                	cmp    %edx,%eax
+    26a8:	75 6e                	jne    2718 <bigfile+0x138>
+    26aa:	0f be 15 8b bb 00 00 	movsbl 0xbb8b,%edx
+    26b1:	39 d0                	cmp    %edx,%eax
+    26b3:	75 63                	jne    2718 <bigfile+0x138>
+    total += cc;
+    26b5:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+    26bb:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+    26be:	83 ec 04             	sub    $0x4,%esp
+    26c1:	68 2c 01 00 00       	push   $0x12c
+    26c6:	68 60 ba 00 00       	push   $0xba60
+    26cb:	56                   	push   %esi
+    26cc:	e8 d1 23 00 00       	call   4aa2 <read>
+    if(cc < 0){
+    26d1:	83 c4 10             	add    $0x10,%esp
+    26d4:	85 c0                	test   %eax,%eax
+    26d6:	78 68                	js     2740 <bigfile+0x160>
+    if(cc == 0)
+    26d8:	75 b6                	jne    2690 <bigfile+0xb0>
+  close(fd);
+    26da:	83 ec 0c             	sub    $0xc,%esp
+    26dd:	56                   	push   %esi
+    26de:	e8 dd 23 00 00       	call   4ac0 <close>
+  if(total != 20*600){
+    26e3:	83 c4 10             	add    $0x10,%esp
+    26e6:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    26ec:	0f 85 9c 00 00 00    	jne    278e <bigfile+0x1ae>
+  unlink("bigfile");
+    26f2:	83 ec 0c             	sub    $0xc,%esp
+    26f5:	68 40 6e 00 00       	push   $0x6e40
+    26fa:	e8 0c 24 00 00       	call   4b0b <unlink>
+  printf(1, "bigfile test ok\n");
+    26ff:	58                   	pop    %eax
+    2700:	5a                   	pop    %edx
+    2701:	68 cf 6e 00 00       	push   $0x6ecf
+    2706:	6a 01                	push   $0x1
+    2708:	e8 e3 27 00 00       	call   4ef0 <printf>
+}
+    270d:	83 c4 10             	add    $0x10,%esp
+    2710:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2713:	5b                   	pop    %ebx
+    2714:	5e                   	pop    %esi
+    2715:	5f                   	pop    %edi
+    2716:	5d                   	pop    %ebp
+    2717:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+    2718:	83 ec 08             	sub    $0x8,%esp
+    271b:	68 9c 6e 00 00       	push   $0x6e9c
+    2720:	6a 01                	push   $0x1
+    2722:	e8 c9 27 00 00       	call   4ef0 <printf>
+      exit();
+    2727:	e8 04 20 00 00       	call   4730 <exit>
+      printf(1, "short read bigfile\n");
+    272c:	83 ec 08             	sub    $0x8,%esp
+    272f:	68 88 6e 00 00       	push   $0x6e88
+    2734:	6a 01                	push   $0x1
+    2736:	e8 b5 27 00 00       	call   4ef0 <printf>
+      exit();
+    273b:	e8 f0 1f 00 00       	call   4730 <exit>
+      printf(1, "read bigfile failed\n");
+    2740:	83 ec 08             	sub    $0x8,%esp
+    2743:	68 73 6e 00 00       	push   $0x6e73
+    2748:	6a 01                	push   $0x1
+    274a:	e8 a1 27 00 00       	call   4ef0 <printf>
+      exit();
+    274f:	e8 dc 1f 00 00       	call   4730 <exit>
+      printf(1, "write bigfile failed\n");
+    2754:	83 ec 08             	sub    $0x8,%esp
+    2757:	68 48 6e 00 00       	push   $0x6e48
+    275c:	6a 01                	push   $0x1
+    275e:	e8 8d 27 00 00       	call   4ef0 <printf>
+      exit();
+    2763:	e8 c8 1f 00 00       	call   4730 <exit>
+    printf(1, "cannot open bigfile\n");
+    2768:	53                   	push   %ebx
+    2769:	53                   	push   %ebx
+    276a:	68 5e 6e 00 00       	push   $0x6e5e
+    276f:	6a 01                	push   $0x1
+    2771:	e8 7a 27 00 00       	call   4ef0 <printf>
+    exit();
+    2776:	e8 b5 1f 00 00       	call   4730 <exit>
+    printf(1, "cannot create bigfile");
+    277b:	50                   	push   %eax
+    277c:	50                   	push   %eax
+    277d:	68 32 6e 00 00       	push   $0x6e32
+    2782:	6a 01                	push   $0x1
+    2784:	e8 67 27 00 00       	call   4ef0 <printf>
+    exit();
+    2789:	e8 a2 1f 00 00       	call   4730 <exit>
+    printf(1, "read bigfile wrong total\n");
+    278e:	51                   	push   %ecx
+    278f:	51                   	push   %ecx
+    2790:	68 b5 6e 00 00       	push   $0x6eb5
+    2795:	6a 01                	push   $0x1
+    2797:	e8 54 27 00 00       	call   4ef0 <printf>
+    exit();
+    279c:	e8 8f 1f 00 00       	call   4730 <exit>
+    27a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    27a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    27af:	90                   	nop
+
+000027b0 <fourteen>:
+{
+    27b0:	55                   	push   %ebp
+    27b1:	89 e5                	mov    %esp,%ebp
+    27b3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+    27b6:	68 e0 6e 00 00       	push   $0x6ee0
+    27bb:	6a 01                	push   $0x1
+    27bd:	e8 2e 27 00 00       	call   4ef0 <printf>
+  if(mkdir("12345678901234") != 0){
+    27c2:	c7 04 24 1b 6f 00 00 	movl   $0x6f1b,(%esp)
+    27c9:	e8 6a 23 00 00       	call   4b38 <mkdir>
+    27ce:	83 c4 10             	add    $0x10,%esp
+    27d1:	85 c0                	test   %eax,%eax
+    27d3:	0f 85 97 00 00 00    	jne    2870 <fourteen+0xc0>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    27d9:	83 ec 0c             	sub    $0xc,%esp
+    27dc:	68 ec 79 00 00       	push   $0x79ec
+    27e1:	e8 52 23 00 00       	call   4b38 <mkdir>
+    27e6:	83 c4 10             	add    $0x10,%esp
+    27e9:	85 c0                	test   %eax,%eax
+    27eb:	0f 85 de 00 00 00    	jne    28cf <fourteen+0x11f>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    27f1:	83 ec 08             	sub    $0x8,%esp
+    27f4:	68 00 02 00 00       	push   $0x200
+    27f9:	68 3c 7a 00 00       	push   $0x7a3c
+    27fe:	e8 ea 22 00 00       	call   4aed <open>
+  if(fd < 0){
+    2803:	83 c4 10             	add    $0x10,%esp
+    2806:	85 c0                	test   %eax,%eax
+    2808:	0f 88 ae 00 00 00    	js     28bc <fourteen+0x10c>
+  close(fd);
+    280e:	83 ec 0c             	sub    $0xc,%esp
+    2811:	50                   	push   %eax
+    2812:	e8 a9 22 00 00       	call   4ac0 <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    2817:	58                   	pop    %eax
+    2818:	5a                   	pop    %edx
+    2819:	6a 00                	push   $0x0
+    281b:	68 ac 7a 00 00       	push   $0x7aac
+    2820:	e8 c8 22 00 00       	call   4aed <open>
+  if(fd < 0){
+    2825:	83 c4 10             	add    $0x10,%esp
+    2828:	85 c0                	test   %eax,%eax
+    282a:	78 7d                	js     28a9 <fourteen+0xf9>
+  close(fd);
+    282c:	83 ec 0c             	sub    $0xc,%esp
+    282f:	50                   	push   %eax
+    2830:	e8 8b 22 00 00       	call   4ac0 <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    2835:	c7 04 24 0c 6f 00 00 	movl   $0x6f0c,(%esp)
+    283c:	e8 f7 22 00 00       	call   4b38 <mkdir>
+    2841:	83 c4 10             	add    $0x10,%esp
+    2844:	85 c0                	test   %eax,%eax
+    2846:	74 4e                	je     2896 <fourteen+0xe6>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    2848:	83 ec 0c             	sub    $0xc,%esp
+    284b:	68 48 7b 00 00       	push   $0x7b48
+    2850:	e8 e3 22 00 00       	call   4b38 <mkdir>
+    2855:	83 c4 10             	add    $0x10,%esp
+    2858:	85 c0                	test   %eax,%eax
+    285a:	74 27                	je     2883 <fourteen+0xd3>
+  printf(1, "fourteen ok\n");
+    285c:	83 ec 08             	sub    $0x8,%esp
+    285f:	68 2a 6f 00 00       	push   $0x6f2a
+    2864:	6a 01                	push   $0x1
+    2866:	e8 85 26 00 00       	call   4ef0 <printf>
+}
+    286b:	83 c4 10             	add    $0x10,%esp
+    286e:	c9                   	leave
+    286f:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    2870:	50                   	push   %eax
+    2871:	50                   	push   %eax
+    2872:	68 ef 6e 00 00       	push   $0x6eef
+    2877:	6a 01                	push   $0x1
+    2879:	e8 72 26 00 00       	call   4ef0 <printf>
+    exit();
+    287e:	e8 ad 1e 00 00       	call   4730 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    2883:	50                   	push   %eax
+    2884:	50                   	push   %eax
+    2885:	68 68 7b 00 00       	push   $0x7b68
+    288a:	6a 01                	push   $0x1
+    288c:	e8 5f 26 00 00       	call   4ef0 <printf>
+    exit();
+    2891:	e8 9a 1e 00 00       	call   4730 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    2896:	52                   	push   %edx
+    2897:	52                   	push   %edx
+    2898:	68 18 7b 00 00       	push   $0x7b18
+    289d:	6a 01                	push   $0x1
+    289f:	e8 4c 26 00 00       	call   4ef0 <printf>
+    exit();
+    28a4:	e8 87 1e 00 00       	call   4730 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    28a9:	51                   	push   %ecx
+    28aa:	51                   	push   %ecx
+    28ab:	68 dc 7a 00 00       	push   $0x7adc
+    28b0:	6a 01                	push   $0x1
+    28b2:	e8 39 26 00 00       	call   4ef0 <printf>
+    exit();
+    28b7:	e8 74 1e 00 00       	call   4730 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    28bc:	51                   	push   %ecx
+    28bd:	51                   	push   %ecx
+    28be:	68 6c 7a 00 00       	push   $0x7a6c
+    28c3:	6a 01                	push   $0x1
+    28c5:	e8 26 26 00 00       	call   4ef0 <printf>
+    exit();
+    28ca:	e8 61 1e 00 00       	call   4730 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    28cf:	50                   	push   %eax
+    28d0:	50                   	push   %eax
+    28d1:	68 0c 7a 00 00       	push   $0x7a0c
+    28d6:	6a 01                	push   $0x1
+    28d8:	e8 13 26 00 00       	call   4ef0 <printf>
+    exit();
+    28dd:	e8 4e 1e 00 00       	call   4730 <exit>
+    28e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    28e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000028f0 <rmdot>:
+{
+    28f0:	55                   	push   %ebp
+    28f1:	89 e5                	mov    %esp,%ebp
+    28f3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    28f6:	68 37 6f 00 00       	push   $0x6f37
+    28fb:	6a 01                	push   $0x1
+    28fd:	e8 ee 25 00 00       	call   4ef0 <printf>
+  if(mkdir("dots") != 0){
+    2902:	c7 04 24 43 6f 00 00 	movl   $0x6f43,(%esp)
+    2909:	e8 2a 22 00 00       	call   4b38 <mkdir>
+    290e:	83 c4 10             	add    $0x10,%esp
+    2911:	85 c0                	test   %eax,%eax
+    2913:	0f 85 b0 00 00 00    	jne    29c9 <rmdot+0xd9>
+  if(chdir("dots") != 0){
+    2919:	83 ec 0c             	sub    $0xc,%esp
+    291c:	68 43 6f 00 00       	push   $0x6f43
+    2921:	e8 21 22 00 00       	call   4b47 <chdir>
+    2926:	83 c4 10             	add    $0x10,%esp
+    2929:	85 c0                	test   %eax,%eax
+    292b:	0f 85 1d 01 00 00    	jne    2a4e <rmdot+0x15e>
+  if(unlink(".") == 0){
+    2931:	83 ec 0c             	sub    $0xc,%esp
+    2934:	68 ee 6b 00 00       	push   $0x6bee
+    2939:	e8 cd 21 00 00       	call   4b0b <unlink>
+    293e:	83 c4 10             	add    $0x10,%esp
+    2941:	85 c0                	test   %eax,%eax
+    2943:	0f 84 f2 00 00 00    	je     2a3b <rmdot+0x14b>
+  if(unlink("..") == 0){
+    2949:	83 ec 0c             	sub    $0xc,%esp
+    294c:	68 ed 6b 00 00       	push   $0x6bed
+    2951:	e8 b5 21 00 00       	call   4b0b <unlink>
+    2956:	83 c4 10             	add    $0x10,%esp
+    2959:	85 c0                	test   %eax,%eax
+    295b:	0f 84 c7 00 00 00    	je     2a28 <rmdot+0x138>
+  if(chdir("/") != 0){
+    2961:	83 ec 0c             	sub    $0xc,%esp
+    2964:	68 c1 63 00 00       	push   $0x63c1
+    2969:	e8 d9 21 00 00       	call   4b47 <chdir>
+    296e:	83 c4 10             	add    $0x10,%esp
+    2971:	85 c0                	test   %eax,%eax
+    2973:	0f 85 9c 00 00 00    	jne    2a15 <rmdot+0x125>
+  if(unlink("dots/.") == 0){
+    2979:	83 ec 0c             	sub    $0xc,%esp
+    297c:	68 8b 6f 00 00       	push   $0x6f8b
+    2981:	e8 85 21 00 00       	call   4b0b <unlink>
+    2986:	83 c4 10             	add    $0x10,%esp
+    2989:	85 c0                	test   %eax,%eax
+    298b:	74 75                	je     2a02 <rmdot+0x112>
+  if(unlink("dots/..") == 0){
+    298d:	83 ec 0c             	sub    $0xc,%esp
+    2990:	68 a9 6f 00 00       	push   $0x6fa9
+    2995:	e8 71 21 00 00       	call   4b0b <unlink>
+    299a:	83 c4 10             	add    $0x10,%esp
+    299d:	85 c0                	test   %eax,%eax
+    299f:	74 4e                	je     29ef <rmdot+0xff>
+  if(unlink("dots") != 0){
+    29a1:	83 ec 0c             	sub    $0xc,%esp
+    29a4:	68 43 6f 00 00       	push   $0x6f43
+    29a9:	e8 5d 21 00 00       	call   4b0b <unlink>
+    29ae:	83 c4 10             	add    $0x10,%esp
+    29b1:	85 c0                	test   %eax,%eax
+    29b3:	75 27                	jne    29dc <rmdot+0xec>
+  printf(1, "rmdot ok\n");
+    29b5:	83 ec 08             	sub    $0x8,%esp
+    29b8:	68 de 6f 00 00       	push   $0x6fde
+    29bd:	6a 01                	push   $0x1
+    29bf:	e8 2c 25 00 00       	call   4ef0 <printf>
+}
+    29c4:	83 c4 10             	add    $0x10,%esp
+    29c7:	c9                   	leave
+    29c8:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    29c9:	50                   	push   %eax
+    29ca:	50                   	push   %eax
+    29cb:	68 48 6f 00 00       	push   $0x6f48
+    29d0:	6a 01                	push   $0x1
+    29d2:	e8 19 25 00 00       	call   4ef0 <printf>
+    exit();
+    29d7:	e8 54 1d 00 00       	call   4730 <exit>
+    printf(1, "unlink dots failed!\n");
+    29dc:	50                   	push   %eax
+    29dd:	50                   	push   %eax
+    29de:	68 c9 6f 00 00       	push   $0x6fc9
+    29e3:	6a 01                	push   $0x1
+    29e5:	e8 06 25 00 00       	call   4ef0 <printf>
+    exit();
+    29ea:	e8 41 1d 00 00       	call   4730 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    29ef:	52                   	push   %edx
+    29f0:	52                   	push   %edx
+    29f1:	68 b1 6f 00 00       	push   $0x6fb1
+    29f6:	6a 01                	push   $0x1
+    29f8:	e8 f3 24 00 00       	call   4ef0 <printf>
+    exit();
+    29fd:	e8 2e 1d 00 00       	call   4730 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    2a02:	51                   	push   %ecx
+    2a03:	51                   	push   %ecx
+    2a04:	68 92 6f 00 00       	push   $0x6f92
+    2a09:	6a 01                	push   $0x1
+    2a0b:	e8 e0 24 00 00       	call   4ef0 <printf>
+    exit();
+    2a10:	e8 1b 1d 00 00       	call   4730 <exit>
+    printf(1, "chdir / failed\n");
+    2a15:	50                   	push   %eax
+    2a16:	50                   	push   %eax
+    2a17:	68 c3 63 00 00       	push   $0x63c3
+    2a1c:	6a 01                	push   $0x1
+    2a1e:	e8 cd 24 00 00       	call   4ef0 <printf>
+    exit();
+    2a23:	e8 08 1d 00 00       	call   4730 <exit>
+    printf(1, "rm .. worked!\n");
+    2a28:	50                   	push   %eax
+    2a29:	50                   	push   %eax
+    2a2a:	68 7c 6f 00 00       	push   $0x6f7c
+    2a2f:	6a 01                	push   $0x1
+    2a31:	e8 ba 24 00 00       	call   4ef0 <printf>
+    exit();
+    2a36:	e8 f5 1c 00 00       	call   4730 <exit>
+    printf(1, "rm . worked!\n");
+    2a3b:	50                   	push   %eax
+    2a3c:	50                   	push   %eax
+    2a3d:	68 6e 6f 00 00       	push   $0x6f6e
+    2a42:	6a 01                	push   $0x1
+    2a44:	e8 a7 24 00 00       	call   4ef0 <printf>
+    exit();
+    2a49:	e8 e2 1c 00 00       	call   4730 <exit>
+    printf(1, "chdir dots failed\n");
+    2a4e:	50                   	push   %eax
+    2a4f:	50                   	push   %eax
+    2a50:	68 5b 6f 00 00       	push   $0x6f5b
+    2a55:	6a 01                	push   $0x1
+    2a57:	e8 94 24 00 00       	call   4ef0 <printf>
+    exit();
+    2a5c:	e8 cf 1c 00 00       	call   4730 <exit>
+    2a61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2a68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2a6f:	90                   	nop
+
+00002a70 <dirfile>:
+{
+    2a70:	55                   	push   %ebp
+    2a71:	89 e5                	mov    %esp,%ebp
+    2a73:	53                   	push   %ebx
+    2a74:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    2a77:	68 e8 6f 00 00       	push   $0x6fe8
+    2a7c:	6a 01                	push   $0x1
+    2a7e:	e8 6d 24 00 00       	call   4ef0 <printf>
+  fd = open("dirfile", O_CREATE);
+    2a83:	5b                   	pop    %ebx
+    2a84:	58                   	pop    %eax
+    2a85:	68 00 02 00 00       	push   $0x200
+    2a8a:	68 f5 6f 00 00       	push   $0x6ff5
+    2a8f:	e8 59 20 00 00       	call   4aed <open>
+  if(fd < 0){
+    2a94:	83 c4 10             	add    $0x10,%esp
+    2a97:	85 c0                	test   %eax,%eax
+    2a99:	0f 88 43 01 00 00    	js     2be2 <dirfile+0x172>
+  close(fd);
+    2a9f:	83 ec 0c             	sub    $0xc,%esp
+    2aa2:	50                   	push   %eax
+    2aa3:	e8 18 20 00 00       	call   4ac0 <close>
+  if(chdir("dirfile") == 0){
+    2aa8:	c7 04 24 f5 6f 00 00 	movl   $0x6ff5,(%esp)
+    2aaf:	e8 93 20 00 00       	call   4b47 <chdir>
+    2ab4:	83 c4 10             	add    $0x10,%esp
+    2ab7:	85 c0                	test   %eax,%eax
+    2ab9:	0f 84 10 01 00 00    	je     2bcf <dirfile+0x15f>
+  fd = open("dirfile/xx", 0);
+    2abf:	83 ec 08             	sub    $0x8,%esp
+    2ac2:	6a 00                	push   $0x0
+    2ac4:	68 2e 70 00 00       	push   $0x702e
+    2ac9:	e8 1f 20 00 00       	call   4aed <open>
+  if(fd >= 0){
+    2ace:	83 c4 10             	add    $0x10,%esp
+    2ad1:	85 c0                	test   %eax,%eax
+    2ad3:	0f 89 e3 00 00 00    	jns    2bbc <dirfile+0x14c>
+  fd = open("dirfile/xx", O_CREATE);
+    2ad9:	83 ec 08             	sub    $0x8,%esp
+    2adc:	68 00 02 00 00       	push   $0x200
+    2ae1:	68 2e 70 00 00       	push   $0x702e
+    2ae6:	e8 02 20 00 00       	call   4aed <open>
+  if(fd >= 0){
+    2aeb:	83 c4 10             	add    $0x10,%esp
+    2aee:	85 c0                	test   %eax,%eax
+    2af0:	0f 89 c6 00 00 00    	jns    2bbc <dirfile+0x14c>
+  if(mkdir("dirfile/xx") == 0){
+    2af6:	83 ec 0c             	sub    $0xc,%esp
+    2af9:	68 2e 70 00 00       	push   $0x702e
+    2afe:	e8 35 20 00 00       	call   4b38 <mkdir>
+    2b03:	83 c4 10             	add    $0x10,%esp
+    2b06:	85 c0                	test   %eax,%eax
+    2b08:	0f 84 46 01 00 00    	je     2c54 <dirfile+0x1e4>
+  if(unlink("dirfile/xx") == 0){
+    2b0e:	83 ec 0c             	sub    $0xc,%esp
+    2b11:	68 2e 70 00 00       	push   $0x702e
+    2b16:	e8 f0 1f 00 00       	call   4b0b <unlink>
+    2b1b:	83 c4 10             	add    $0x10,%esp
+    2b1e:	85 c0                	test   %eax,%eax
+    2b20:	0f 84 1b 01 00 00    	je     2c41 <dirfile+0x1d1>
+  if(link("README.md", "dirfile/xx") == 0){
+    2b26:	83 ec 08             	sub    $0x8,%esp
+    2b29:	68 2e 70 00 00       	push   $0x702e
+    2b2e:	68 92 70 00 00       	push   $0x7092
+    2b33:	e8 f1 1f 00 00       	call   4b29 <link>
+    2b38:	83 c4 10             	add    $0x10,%esp
+    2b3b:	85 c0                	test   %eax,%eax
+    2b3d:	0f 84 eb 00 00 00    	je     2c2e <dirfile+0x1be>
+  if(unlink("dirfile") != 0){
+    2b43:	83 ec 0c             	sub    $0xc,%esp
+    2b46:	68 f5 6f 00 00       	push   $0x6ff5
+    2b4b:	e8 bb 1f 00 00       	call   4b0b <unlink>
+    2b50:	83 c4 10             	add    $0x10,%esp
+    2b53:	85 c0                	test   %eax,%eax
+    2b55:	0f 85 c0 00 00 00    	jne    2c1b <dirfile+0x1ab>
+  fd = open(".", O_RDWR);
+    2b5b:	83 ec 08             	sub    $0x8,%esp
+    2b5e:	6a 02                	push   $0x2
+    2b60:	68 ee 6b 00 00       	push   $0x6bee
+    2b65:	e8 83 1f 00 00       	call   4aed <open>
+  if(fd >= 0){
+    2b6a:	83 c4 10             	add    $0x10,%esp
+    2b6d:	85 c0                	test   %eax,%eax
+    2b6f:	0f 89 93 00 00 00    	jns    2c08 <dirfile+0x198>
+  fd = open(".", 0);
+    2b75:	83 ec 08             	sub    $0x8,%esp
+    2b78:	6a 00                	push   $0x0
+    2b7a:	68 ee 6b 00 00       	push   $0x6bee
+    2b7f:	e8 69 1f 00 00       	call   4aed <open>
+  if(write(fd, "x", 1) > 0){
+    2b84:	83 c4 0c             	add    $0xc,%esp
+    2b87:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    2b89:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    2b8b:	68 d1 6c 00 00       	push   $0x6cd1
+    2b90:	50                   	push   %eax
+    2b91:	e8 1b 1f 00 00       	call   4ab1 <write>
+    2b96:	83 c4 10             	add    $0x10,%esp
+    2b99:	85 c0                	test   %eax,%eax
+    2b9b:	7f 58                	jg     2bf5 <dirfile+0x185>
+  close(fd);
+    2b9d:	83 ec 0c             	sub    $0xc,%esp
+    2ba0:	53                   	push   %ebx
+    2ba1:	e8 1a 1f 00 00       	call   4ac0 <close>
+  printf(1, "dir vs file OK\n");
+    2ba6:	58                   	pop    %eax
+    2ba7:	5a                   	pop    %edx
+    2ba8:	68 c8 70 00 00       	push   $0x70c8
+    2bad:	6a 01                	push   $0x1
+    2baf:	e8 3c 23 00 00       	call   4ef0 <printf>
+}
+    2bb4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2bb7:	83 c4 10             	add    $0x10,%esp
+    2bba:	c9                   	leave
+    2bbb:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    2bbc:	50                   	push   %eax
+    2bbd:	50                   	push   %eax
+    2bbe:	68 39 70 00 00       	push   $0x7039
+    2bc3:	6a 01                	push   $0x1
+    2bc5:	e8 26 23 00 00       	call   4ef0 <printf>
+    exit();
+    2bca:	e8 61 1b 00 00       	call   4730 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    2bcf:	52                   	push   %edx
+    2bd0:	52                   	push   %edx
+    2bd1:	68 14 70 00 00       	push   $0x7014
+    2bd6:	6a 01                	push   $0x1
+    2bd8:	e8 13 23 00 00       	call   4ef0 <printf>
+    exit();
+    2bdd:	e8 4e 1b 00 00       	call   4730 <exit>
+    printf(1, "create dirfile failed\n");
+    2be2:	51                   	push   %ecx
+    2be3:	51                   	push   %ecx
+    2be4:	68 fd 6f 00 00       	push   $0x6ffd
+    2be9:	6a 01                	push   $0x1
+    2beb:	e8 00 23 00 00       	call   4ef0 <printf>
+    exit();
+    2bf0:	e8 3b 1b 00 00       	call   4730 <exit>
+    printf(1, "write . succeeded!\n");
+    2bf5:	51                   	push   %ecx
+    2bf6:	51                   	push   %ecx
+    2bf7:	68 b4 70 00 00       	push   $0x70b4
+    2bfc:	6a 01                	push   $0x1
+    2bfe:	e8 ed 22 00 00       	call   4ef0 <printf>
+    exit();
+    2c03:	e8 28 1b 00 00       	call   4730 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    2c08:	53                   	push   %ebx
+    2c09:	53                   	push   %ebx
+    2c0a:	68 bc 7b 00 00       	push   $0x7bbc
+    2c0f:	6a 01                	push   $0x1
+    2c11:	e8 da 22 00 00       	call   4ef0 <printf>
+    exit();
+    2c16:	e8 15 1b 00 00       	call   4730 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    2c1b:	50                   	push   %eax
+    2c1c:	50                   	push   %eax
+    2c1d:	68 9c 70 00 00       	push   $0x709c
+    2c22:	6a 01                	push   $0x1
+    2c24:	e8 c7 22 00 00       	call   4ef0 <printf>
+    exit();
+    2c29:	e8 02 1b 00 00       	call   4730 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    2c2e:	50                   	push   %eax
+    2c2f:	50                   	push   %eax
+    2c30:	68 9c 7b 00 00       	push   $0x7b9c
+    2c35:	6a 01                	push   $0x1
+    2c37:	e8 b4 22 00 00       	call   4ef0 <printf>
+    exit();
+    2c3c:	e8 ef 1a 00 00       	call   4730 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    2c41:	50                   	push   %eax
+    2c42:	50                   	push   %eax
+    2c43:	68 74 70 00 00       	push   $0x7074
+    2c48:	6a 01                	push   $0x1
+    2c4a:	e8 a1 22 00 00       	call   4ef0 <printf>
+    exit();
+    2c4f:	e8 dc 1a 00 00       	call   4730 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    2c54:	50                   	push   %eax
+    2c55:	50                   	push   %eax
+    2c56:	68 57 70 00 00       	push   $0x7057
+    2c5b:	6a 01                	push   $0x1
+    2c5d:	e8 8e 22 00 00       	call   4ef0 <printf>
+    exit();
+    2c62:	e8 c9 1a 00 00       	call   4730 <exit>
+    2c67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2c6e:	66 90                	xchg   %ax,%ax
+
+00002c70 <iref>:
+{
+    2c70:	55                   	push   %ebp
+    2c71:	89 e5                	mov    %esp,%ebp
+    2c73:	53                   	push   %ebx
+  printf(1, "empty file name\n");
+    2c74:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    2c79:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    2c7c:	68 d8 70 00 00       	push   $0x70d8
+    2c81:	6a 01                	push   $0x1
+    2c83:	e8 68 22 00 00       	call   4ef0 <printf>
+    2c88:	83 c4 10             	add    $0x10,%esp
+    2c8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2c8f:	90                   	nop
+    if(mkdir("irefd") != 0){
+    2c90:	83 ec 0c             	sub    $0xc,%esp
+    2c93:	68 e9 70 00 00       	push   $0x70e9
+    2c98:	e8 9b 1e 00 00       	call   4b38 <mkdir>
+    2c9d:	83 c4 10             	add    $0x10,%esp
+    2ca0:	85 c0                	test   %eax,%eax
+    2ca2:	0f 85 bb 00 00 00    	jne    2d63 <iref+0xf3>
+    if(chdir("irefd") != 0){
+    2ca8:	83 ec 0c             	sub    $0xc,%esp
+    2cab:	68 e9 70 00 00       	push   $0x70e9
+    2cb0:	e8 92 1e 00 00       	call   4b47 <chdir>
+    2cb5:	83 c4 10             	add    $0x10,%esp
+    2cb8:	85 c0                	test   %eax,%eax
+    2cba:	0f 85 b7 00 00 00    	jne    2d77 <iref+0x107>
+    mkdir("");
+    2cc0:	83 ec 0c             	sub    $0xc,%esp
+    2cc3:	68 9b 67 00 00       	push   $0x679b
+    2cc8:	e8 6b 1e 00 00       	call   4b38 <mkdir>
+    link("README.md", "");
+    2ccd:	59                   	pop    %ecx
+    2cce:	58                   	pop    %eax
+    2ccf:	68 9b 67 00 00       	push   $0x679b
+    2cd4:	68 92 70 00 00       	push   $0x7092
+    2cd9:	e8 4b 1e 00 00       	call   4b29 <link>
+    fd = open("", O_CREATE);
+    2cde:	58                   	pop    %eax
+    2cdf:	5a                   	pop    %edx
+    2ce0:	68 00 02 00 00       	push   $0x200
+    2ce5:	68 9b 67 00 00       	push   $0x679b
+    2cea:	e8 fe 1d 00 00       	call   4aed <open>
+    if(fd >= 0)
+    2cef:	83 c4 10             	add    $0x10,%esp
+    2cf2:	85 c0                	test   %eax,%eax
+    2cf4:	78 0c                	js     2d02 <iref+0x92>
+      close(fd);
+    2cf6:	83 ec 0c             	sub    $0xc,%esp
+    2cf9:	50                   	push   %eax
+    2cfa:	e8 c1 1d 00 00       	call   4ac0 <close>
+    2cff:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    2d02:	83 ec 08             	sub    $0x8,%esp
+    2d05:	68 00 02 00 00       	push   $0x200
+    2d0a:	68 d0 6c 00 00       	push   $0x6cd0
+    2d0f:	e8 d9 1d 00 00       	call   4aed <open>
+    if(fd >= 0)
+    2d14:	83 c4 10             	add    $0x10,%esp
+    2d17:	85 c0                	test   %eax,%eax
+    2d19:	78 0c                	js     2d27 <iref+0xb7>
+      close(fd);
+    2d1b:	83 ec 0c             	sub    $0xc,%esp
+    2d1e:	50                   	push   %eax
+    2d1f:	e8 9c 1d 00 00       	call   4ac0 <close>
+    2d24:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    2d27:	83 ec 0c             	sub    $0xc,%esp
+    2d2a:	68 d0 6c 00 00       	push   $0x6cd0
+    2d2f:	e8 d7 1d 00 00       	call   4b0b <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    2d34:	83 c4 10             	add    $0x10,%esp
+    2d37:	83 eb 01             	sub    $0x1,%ebx
+    2d3a:	0f 85 50 ff ff ff    	jne    2c90 <iref+0x20>
+  chdir("/");
+    2d40:	83 ec 0c             	sub    $0xc,%esp
+    2d43:	68 c1 63 00 00       	push   $0x63c1
+    2d48:	e8 fa 1d 00 00       	call   4b47 <chdir>
+  printf(1, "empty file name OK\n");
+    2d4d:	58                   	pop    %eax
+    2d4e:	5a                   	pop    %edx
+    2d4f:	68 17 71 00 00       	push   $0x7117
+    2d54:	6a 01                	push   $0x1
+    2d56:	e8 95 21 00 00       	call   4ef0 <printf>
+}
+    2d5b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2d5e:	83 c4 10             	add    $0x10,%esp
+    2d61:	c9                   	leave
+    2d62:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    2d63:	83 ec 08             	sub    $0x8,%esp
+    2d66:	68 ef 70 00 00       	push   $0x70ef
+    2d6b:	6a 01                	push   $0x1
+    2d6d:	e8 7e 21 00 00       	call   4ef0 <printf>
+      exit();
+    2d72:	e8 b9 19 00 00       	call   4730 <exit>
+      printf(1, "chdir irefd failed\n");
+    2d77:	83 ec 08             	sub    $0x8,%esp
+    2d7a:	68 03 71 00 00       	push   $0x7103
+    2d7f:	6a 01                	push   $0x1
+    2d81:	e8 6a 21 00 00       	call   4ef0 <printf>
+      exit();
+    2d86:	e8 a5 19 00 00       	call   4730 <exit>
+    2d8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2d8f:	90                   	nop
+
+00002d90 <forktest>:
+{
+    2d90:	55                   	push   %ebp
+    2d91:	89 e5                	mov    %esp,%ebp
+    2d93:	53                   	push   %ebx
+  for(n=0; n<1000; n++){
+    2d94:	31 db                	xor    %ebx,%ebx
+{
+    2d96:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    2d99:	68 2b 71 00 00       	push   $0x712b
+    2d9e:	6a 01                	push   $0x1
+    2da0:	e8 4b 21 00 00       	call   4ef0 <printf>
+    2da5:	83 c4 10             	add    $0x10,%esp
+    2da8:	eb 13                	jmp    2dbd <forktest+0x2d>
+    2daa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+    2db0:	74 4d                	je     2dff <forktest+0x6f>
+  for(n=0; n<1000; n++){
+    2db2:	83 c3 01             	add    $0x1,%ebx
+    2db5:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    2dbb:	74 6e                	je     2e2b <forktest+0x9b>
+    pid = fork();
+    2dbd:	e8 0e 19 00 00       	call   46d0 <fork>
+    if(pid < 0)
+    2dc2:	85 c0                	test   %eax,%eax
+    2dc4:	79 ea                	jns    2db0 <forktest+0x20>
+  for(; n > 0; n--){
+    2dc6:	85 db                	test   %ebx,%ebx
+    2dc8:	74 14                	je     2dde <forktest+0x4e>
+    2dca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(wait() < 0){
+    2dd0:	e8 af 1c 00 00       	call   4a84 <wait>
+    2dd5:	85 c0                	test   %eax,%eax
+    2dd7:	78 2b                	js     2e04 <forktest+0x74>
+  for(; n > 0; n--){
+    2dd9:	83 eb 01             	sub    $0x1,%ebx
+    2ddc:	75 f2                	jne    2dd0 <forktest+0x40>
+  if(wait() != -1){
+    2dde:	e8 a1 1c 00 00       	call   4a84 <wait>
+    2de3:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2de6:	75 30                	jne    2e18 <forktest+0x88>
+  printf(1, "fork test OK\n");
+    2de8:	83 ec 08             	sub    $0x8,%esp
+    2deb:	68 5d 71 00 00       	push   $0x715d
+    2df0:	6a 01                	push   $0x1
+    2df2:	e8 f9 20 00 00       	call   4ef0 <printf>
+}
+    2df7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2dfa:	83 c4 10             	add    $0x10,%esp
+    2dfd:	c9                   	leave
+    2dfe:	c3                   	ret
+      exit();
+    2dff:	e8 2c 19 00 00       	call   4730 <exit>
+      printf(1, "wait stopped early\n");
+    2e04:	83 ec 08             	sub    $0x8,%esp
+    2e07:	68 36 71 00 00       	push   $0x7136
+    2e0c:	6a 01                	push   $0x1
+    2e0e:	e8 dd 20 00 00       	call   4ef0 <printf>
+      exit();
+    2e13:	e8 18 19 00 00       	call   4730 <exit>
+    printf(1, "wait got too many\n");
+    2e18:	50                   	push   %eax
+    2e19:	50                   	push   %eax
+    2e1a:	68 4a 71 00 00       	push   $0x714a
+    2e1f:	6a 01                	push   $0x1
+    2e21:	e8 ca 20 00 00       	call   4ef0 <printf>
+    exit();
+    2e26:	e8 05 19 00 00       	call   4730 <exit>
+    printf(1, "fork claimed to work 1000 times!\n");
+    2e2b:	52                   	push   %edx
+    2e2c:	52                   	push   %edx
+    2e2d:	68 dc 7b 00 00       	push   $0x7bdc
+    2e32:	6a 01                	push   $0x1
+    2e34:	e8 b7 20 00 00       	call   4ef0 <printf>
+    exit();
+    2e39:	e8 f2 18 00 00       	call   4730 <exit>
+    2e3e:	66 90                	xchg   %ax,%ax
+
+00002e40 <sbrktest>:
+{
+    2e40:	55                   	push   %ebp
+    2e41:	89 e5                	mov    %esp,%ebp
+    2e43:	57                   	push   %edi
+    2e44:	56                   	push   %esi
+  for(i = 0; i < 5000; i++){
+    2e45:	31 f6                	xor    %esi,%esi
+{
+    2e47:	53                   	push   %ebx
+    2e48:	83 ec 64             	sub    $0x64,%esp
+  printf(out, "sbrk test\n");
+    2e4b:	68 17 72 00 00       	push   $0x7217
+    2e50:	ff 35 24 92 00 00    	push   0x9224
+    2e56:	e8 95 20 00 00       	call   4ef0 <printf>
+  oldbrk = sbrk(0);
+    2e5b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2e62:	e8 0d 1d 00 00       	call   4b74 <sbrk>
+    2e67:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+    2e6a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2e71:	e8 fe 1c 00 00       	call   4b74 <sbrk>
+    2e76:	83 c4 10             	add    $0x10,%esp
+    2e79:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 5000; i++){
+    2e7b:	eb 05                	jmp    2e82 <sbrktest+0x42>
+    2e7d:	8d 76 00             	lea    0x0(%esi),%esi
+    a = b + 1;
+    2e80:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    2e82:	83 ec 0c             	sub    $0xc,%esp
+    2e85:	6a 01                	push   $0x1
+    2e87:	e8 e8 1c 00 00       	call   4b74 <sbrk>
+    if(b != a){
+    2e8c:	83 c4 10             	add    $0x10,%esp
+    2e8f:	39 d8                	cmp    %ebx,%eax
+    2e91:	0f 85 9c 02 00 00    	jne    3133 <sbrktest+0x2f3>
+  for(i = 0; i < 5000; i++){
+    2e97:	83 c6 01             	add    $0x1,%esi
+    *b = 1;
+    2e9a:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    2e9d:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+    2ea0:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    2ea6:	75 d8                	jne    2e80 <sbrktest+0x40>
+  pid = fork();
+    2ea8:	e8 23 18 00 00       	call   46d0 <fork>
+    2ead:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    2eaf:	85 c0                	test   %eax,%eax
+    2eb1:	0f 88 02 03 00 00    	js     31b9 <sbrktest+0x379>
+  c = sbrk(1);
+    2eb7:	83 ec 0c             	sub    $0xc,%esp
+  if(c != a + 1){
+    2eba:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+    2ebd:	6a 01                	push   $0x1
+    2ebf:	e8 b0 1c 00 00       	call   4b74 <sbrk>
+  c = sbrk(1);
+    2ec4:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2ecb:	e8 a4 1c 00 00       	call   4b74 <sbrk>
+  if(c != a + 1){
+    2ed0:	83 c4 10             	add    $0x10,%esp
+    2ed3:	39 c3                	cmp    %eax,%ebx
+    2ed5:	0f 85 3b 03 00 00    	jne    3216 <sbrktest+0x3d6>
+  if(pid == 0)
+    2edb:	85 f6                	test   %esi,%esi
+    2edd:	0f 84 2e 03 00 00    	je     3211 <sbrktest+0x3d1>
+  wait();
+    2ee3:	e8 9c 1b 00 00       	call   4a84 <wait>
+  a = sbrk(0);
+    2ee8:	83 ec 0c             	sub    $0xc,%esp
+    2eeb:	6a 00                	push   $0x0
+    2eed:	e8 82 1c 00 00       	call   4b74 <sbrk>
+    2ef2:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    2ef4:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    2ef9:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    2efb:	89 04 24             	mov    %eax,(%esp)
+    2efe:	e8 71 1c 00 00       	call   4b74 <sbrk>
+  if (p != a) {
+    2f03:	83 c4 10             	add    $0x10,%esp
+    2f06:	39 c3                	cmp    %eax,%ebx
+    2f08:	0f 85 94 02 00 00    	jne    31a2 <sbrktest+0x362>
+  a = sbrk(0);
+    2f0e:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+    2f11:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    2f18:	6a 00                	push   $0x0
+    2f1a:	e8 55 1c 00 00       	call   4b74 <sbrk>
+  c = sbrk(-4096);
+    2f1f:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+    2f26:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    2f28:	e8 47 1c 00 00       	call   4b74 <sbrk>
+  if(c == (char*)0xffffffff){
+    2f2d:	83 c4 10             	add    $0x10,%esp
+    2f30:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2f33:	0f 84 22 03 00 00    	je     325b <sbrktest+0x41b>
+  c = sbrk(0);
+    2f39:	83 ec 0c             	sub    $0xc,%esp
+    2f3c:	6a 00                	push   $0x0
+    2f3e:	e8 31 1c 00 00       	call   4b74 <sbrk>
+  if(c != a - 4096){
+    2f43:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    2f49:	83 c4 10             	add    $0x10,%esp
+    2f4c:	39 d0                	cmp    %edx,%eax
+    2f4e:	0f 85 f0 02 00 00    	jne    3244 <sbrktest+0x404>
+  a = sbrk(0);
+    2f54:	83 ec 0c             	sub    $0xc,%esp
+    2f57:	6a 00                	push   $0x0
+    2f59:	e8 16 1c 00 00       	call   4b74 <sbrk>
+  c = sbrk(4096);
+    2f5e:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+    2f65:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    2f67:	e8 08 1c 00 00       	call   4b74 <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+    2f6c:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+    2f6f:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    2f71:	39 c3                	cmp    %eax,%ebx
+    2f73:	0f 85 b4 02 00 00    	jne    322d <sbrktest+0x3ed>
+    2f79:	83 ec 0c             	sub    $0xc,%esp
+    2f7c:	6a 00                	push   $0x0
+    2f7e:	e8 f1 1b 00 00       	call   4b74 <sbrk>
+    2f83:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    2f89:	83 c4 10             	add    $0x10,%esp
+    2f8c:	39 c2                	cmp    %eax,%edx
+    2f8e:	0f 85 99 02 00 00    	jne    322d <sbrktest+0x3ed>
+  if(*lastaddr == 99){
+    2f94:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    2f9b:	0f 84 2f 02 00 00    	je     31d0 <sbrktest+0x390>
+  a = sbrk(0);
+    2fa1:	83 ec 0c             	sub    $0xc,%esp
+    2fa4:	6a 00                	push   $0x0
+    2fa6:	e8 c9 1b 00 00       	call   4b74 <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    2fab:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+    2fb2:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    2fb4:	e8 bb 1b 00 00       	call   4b74 <sbrk>
+    2fb9:	89 c2                	mov    %eax,%edx
+    2fbb:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    2fbe:	29 d0                	sub    %edx,%eax
+    2fc0:	89 04 24             	mov    %eax,(%esp)
+    2fc3:	e8 ac 1b 00 00       	call   4b74 <sbrk>
+  if(c != a){
+    2fc8:	83 c4 10             	add    $0x10,%esp
+    2fcb:	39 c3                	cmp    %eax,%ebx
+    2fcd:	0f 85 b8 01 00 00    	jne    318b <sbrktest+0x34b>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    2fd3:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    2fd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2fdf:	90                   	nop
+    ppid = getpid();
+    2fe0:	e8 80 1b 00 00       	call   4b65 <getpid>
+    2fe5:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    2fe7:	e8 e4 16 00 00       	call   46d0 <fork>
+    if(pid < 0){
+    2fec:	85 c0                	test   %eax,%eax
+    2fee:	0f 88 5d 01 00 00    	js     3151 <sbrktest+0x311>
+    if(pid == 0){
+    2ff4:	0f 84 6f 01 00 00    	je     3169 <sbrktest+0x329>
+    wait();
+    2ffa:	e8 85 1a 00 00       	call   4a84 <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    2fff:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    3005:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    300b:	75 d3                	jne    2fe0 <sbrktest+0x1a0>
+  if(pipe(fds) != 0){
+    300d:	83 ec 0c             	sub    $0xc,%esp
+    3010:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    3013:	50                   	push   %eax
+    3014:	e8 7a 1a 00 00       	call   4a93 <pipe>
+    3019:	83 c4 10             	add    $0x10,%esp
+    301c:	85 c0                	test   %eax,%eax
+    301e:	0f 85 da 01 00 00    	jne    31fe <sbrktest+0x3be>
+    3024:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+    3027:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    302a:	89 df                	mov    %ebx,%edi
+    302c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((pids[i] = fork()) == 0){
+    3030:	e8 9b 16 00 00       	call   46d0 <fork>
+    3035:	89 07                	mov    %eax,(%edi)
+    3037:	85 c0                	test   %eax,%eax
+    3039:	0f 84 91 00 00 00    	je     30d0 <sbrktest+0x290>
+    if(pids[i] != -1)
+    303f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3042:	74 14                	je     3058 <sbrktest+0x218>
+      read(fds[0], &scratch, 1);
+    3044:	83 ec 04             	sub    $0x4,%esp
+    3047:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    304a:	6a 01                	push   $0x1
+    304c:	50                   	push   %eax
+    304d:	ff 75 b8             	push   -0x48(%ebp)
+    3050:	e8 4d 1a 00 00       	call   4aa2 <read>
+    3055:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3058:	83 c7 04             	add    $0x4,%edi
+    305b:	39 f7                	cmp    %esi,%edi
+    305d:	75 d1                	jne    3030 <sbrktest+0x1f0>
+  c = sbrk(4096);
+    305f:	83 ec 0c             	sub    $0xc,%esp
+    3062:	68 00 10 00 00       	push   $0x1000
+    3067:	e8 08 1b 00 00       	call   4b74 <sbrk>
+    306c:	83 c4 10             	add    $0x10,%esp
+    306f:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3071:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+    3078:	8b 03                	mov    (%ebx),%eax
+    307a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    307d:	74 11                	je     3090 <sbrktest+0x250>
+    kill(pids[i]);
+    307f:	83 ec 0c             	sub    $0xc,%esp
+    3082:	50                   	push   %eax
+    3083:	e8 47 1a 00 00       	call   4acf <kill>
+    wait();
+    3088:	e8 f7 19 00 00       	call   4a84 <wait>
+    308d:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3090:	83 c3 04             	add    $0x4,%ebx
+    3093:	39 f3                	cmp    %esi,%ebx
+    3095:	75 e1                	jne    3078 <sbrktest+0x238>
+  if(c == (char*)0xffffffff){
+    3097:	83 ff ff             	cmp    $0xffffffff,%edi
+    309a:	0f 84 47 01 00 00    	je     31e7 <sbrktest+0x3a7>
+  if(sbrk(0) > oldbrk)
+    30a0:	83 ec 0c             	sub    $0xc,%esp
+    30a3:	6a 00                	push   $0x0
+    30a5:	e8 ca 1a 00 00       	call   4b74 <sbrk>
+    30aa:	83 c4 10             	add    $0x10,%esp
+    30ad:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    30b0:	72 60                	jb     3112 <sbrktest+0x2d2>
+  printf(out, "sbrk test OK\n");
+    30b2:	83 ec 08             	sub    $0x8,%esp
+    30b5:	68 08 72 00 00       	push   $0x7208
+    30ba:	ff 35 24 92 00 00    	push   0x9224
+    30c0:	e8 2b 1e 00 00       	call   4ef0 <printf>
+}
+    30c5:	83 c4 10             	add    $0x10,%esp
+    30c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    30cb:	5b                   	pop    %ebx
+    30cc:	5e                   	pop    %esi
+    30cd:	5f                   	pop    %edi
+    30ce:	5d                   	pop    %ebp
+    30cf:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+    30d0:	83 ec 0c             	sub    $0xc,%esp
+    30d3:	6a 00                	push   $0x0
+    30d5:	e8 9a 1a 00 00       	call   4b74 <sbrk>
+    30da:	89 c2                	mov    %eax,%edx
+    30dc:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    30e1:	29 d0                	sub    %edx,%eax
+    30e3:	89 04 24             	mov    %eax,(%esp)
+    30e6:	e8 89 1a 00 00       	call   4b74 <sbrk>
+      write(fds[1], "x", 1);
+    30eb:	83 c4 0c             	add    $0xc,%esp
+    30ee:	6a 01                	push   $0x1
+    30f0:	68 d1 6c 00 00       	push   $0x6cd1
+    30f5:	ff 75 bc             	push   -0x44(%ebp)
+    30f8:	e8 b4 19 00 00       	call   4ab1 <write>
+    30fd:	83 c4 10             	add    $0x10,%esp
+      for(;;) sleep(1000);
+    3100:	83 ec 0c             	sub    $0xc,%esp
+    3103:	68 e8 03 00 00       	push   $0x3e8
+    3108:	e8 76 1a 00 00       	call   4b83 <sleep>
+    310d:	83 c4 10             	add    $0x10,%esp
+    3110:	eb ee                	jmp    3100 <sbrktest+0x2c0>
+    sbrk(-(sbrk(0) - oldbrk));
+    3112:	83 ec 0c             	sub    $0xc,%esp
+    3115:	6a 00                	push   $0x0
+    3117:	e8 58 1a 00 00       	call   4b74 <sbrk>
+    311c:	89 c2                	mov    %eax,%edx
+    311e:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    3121:	29 d0                	sub    %edx,%eax
+    3123:	89 04 24             	mov    %eax,(%esp)
+    3126:	e8 49 1a 00 00       	call   4b74 <sbrk>
+    312b:	83 c4 10             	add    $0x10,%esp
+    312e:	e9 7f ff ff ff       	jmp    30b2 <sbrktest+0x272>
+      printf(out, "sbrk test failed %d %x %x\n", i, a, b);
+    3133:	83 ec 0c             	sub    $0xc,%esp
+    3136:	50                   	push   %eax
+    3137:	53                   	push   %ebx
+    3138:	56                   	push   %esi
+    3139:	68 6b 71 00 00       	push   $0x716b
+    313e:	ff 35 24 92 00 00    	push   0x9224
+    3144:	e8 a7 1d 00 00       	call   4ef0 <printf>
+      exit();
+    3149:	83 c4 20             	add    $0x20,%esp
+    314c:	e8 df 15 00 00       	call   4730 <exit>
+      printf(out, "fork failed\n");
+    3151:	83 ec 08             	sub    $0x8,%esp
+    3154:	68 2e 72 00 00       	push   $0x722e
+    3159:	ff 35 24 92 00 00    	push   0x9224
+    315f:	e8 8c 1d 00 00       	call   4ef0 <printf>
+      exit();
+    3164:	e8 c7 15 00 00       	call   4730 <exit>
+      printf(out, "oops could read %x = %x\n", a, *a);
+    3169:	0f be 03             	movsbl (%ebx),%eax
+    316c:	50                   	push   %eax
+    316d:	53                   	push   %ebx
+    316e:	68 d4 71 00 00       	push   $0x71d4
+    3173:	ff 35 24 92 00 00    	push   0x9224
+    3179:	e8 72 1d 00 00       	call   4ef0 <printf>
+      kill(ppid);
+    317e:	89 34 24             	mov    %esi,(%esp)
+    3181:	e8 49 19 00 00       	call   4acf <kill>
+      exit();
+    3186:	e8 a5 15 00 00       	call   4730 <exit>
+    printf(out, "sbrk downsize failed, a %x c %x\n", a, c);
+    318b:	50                   	push   %eax
+    318c:	53                   	push   %ebx
+    318d:	68 d0 7c 00 00       	push   $0x7cd0
+    3192:	ff 35 24 92 00 00    	push   0x9224
+    3198:	e8 53 1d 00 00       	call   4ef0 <printf>
+    exit();
+    319d:	e8 8e 15 00 00       	call   4730 <exit>
+    printf(out, "sbrk test failed to grow big address space; enough phys mem?\n");
+    31a2:	56                   	push   %esi
+    31a3:	56                   	push   %esi
+    31a4:	68 00 7c 00 00       	push   $0x7c00
+    31a9:	ff 35 24 92 00 00    	push   0x9224
+    31af:	e8 3c 1d 00 00       	call   4ef0 <printf>
+    exit();
+    31b4:	e8 77 15 00 00       	call   4730 <exit>
+    printf(out, "sbrk test fork failed\n");
+    31b9:	50                   	push   %eax
+    31ba:	50                   	push   %eax
+    31bb:	68 86 71 00 00       	push   $0x7186
+    31c0:	ff 35 24 92 00 00    	push   0x9224
+    31c6:	e8 25 1d 00 00       	call   4ef0 <printf>
+    exit();
+    31cb:	e8 60 15 00 00       	call   4730 <exit>
+    printf(out, "sbrk de-allocation didn't really deallocate\n");
+    31d0:	51                   	push   %ecx
+    31d1:	51                   	push   %ecx
+    31d2:	68 a0 7c 00 00       	push   $0x7ca0
+    31d7:	ff 35 24 92 00 00    	push   0x9224
+    31dd:	e8 0e 1d 00 00       	call   4ef0 <printf>
+    exit();
+    31e2:	e8 49 15 00 00       	call   4730 <exit>
+    printf(out, "failed sbrk leaked memory\n");
+    31e7:	50                   	push   %eax
+    31e8:	50                   	push   %eax
+    31e9:	68 ed 71 00 00       	push   $0x71ed
+    31ee:	ff 35 24 92 00 00    	push   0x9224
+    31f4:	e8 f7 1c 00 00       	call   4ef0 <printf>
+    exit();
+    31f9:	e8 32 15 00 00       	call   4730 <exit>
+    printf(1, "pipe() failed\n");
+    31fe:	52                   	push   %edx
+    31ff:	52                   	push   %edx
+    3200:	68 b1 66 00 00       	push   $0x66b1
+    3205:	6a 01                	push   $0x1
+    3207:	e8 e4 1c 00 00       	call   4ef0 <printf>
+    exit();
+    320c:	e8 1f 15 00 00       	call   4730 <exit>
+    exit();
+    3211:	e8 1a 15 00 00       	call   4730 <exit>
+    printf(out, "sbrk test failed post-fork\n");
+    3216:	57                   	push   %edi
+    3217:	57                   	push   %edi
+    3218:	68 9d 71 00 00       	push   $0x719d
+    321d:	ff 35 24 92 00 00    	push   0x9224
+    3223:	e8 c8 1c 00 00       	call   4ef0 <printf>
+    exit();
+    3228:	e8 03 15 00 00       	call   4730 <exit>
+    printf(out, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    322d:	56                   	push   %esi
+    322e:	53                   	push   %ebx
+    322f:	68 78 7c 00 00       	push   $0x7c78
+    3234:	ff 35 24 92 00 00    	push   0x9224
+    323a:	e8 b1 1c 00 00       	call   4ef0 <printf>
+    exit();
+    323f:	e8 ec 14 00 00       	call   4730 <exit>
+    printf(out, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    3244:	50                   	push   %eax
+    3245:	53                   	push   %ebx
+    3246:	68 40 7c 00 00       	push   $0x7c40
+    324b:	ff 35 24 92 00 00    	push   0x9224
+    3251:	e8 9a 1c 00 00       	call   4ef0 <printf>
+    exit();
+    3256:	e8 d5 14 00 00       	call   4730 <exit>
+    printf(out, "sbrk could not deallocate\n");
+    325b:	53                   	push   %ebx
+    325c:	53                   	push   %ebx
+    325d:	68 b9 71 00 00       	push   $0x71b9
+    3262:	ff 35 24 92 00 00    	push   0x9224
+    3268:	e8 83 1c 00 00       	call   4ef0 <printf>
+    exit();
+    326d:	e8 be 14 00 00       	call   4730 <exit>
+    3272:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3279:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003280 <validateint>:
+}
+    3280:	c3                   	ret
+    3281:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3288:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    328f:	90                   	nop
+
+00003290 <hsbrktest>:
+{
+    3290:	55                   	push   %ebp
+    3291:	89 e5                	mov    %esp,%ebp
+    3293:	53                   	push   %ebx
+    3294:	83 ec 0c             	sub    $0xc,%esp
+  printf(out, "hsbrk test\n");
+    3297:	68 16 72 00 00       	push   $0x7216
+    329c:	ff 35 24 92 00 00    	push   0x9224
+    32a2:	e8 49 1c 00 00       	call   4ef0 <printf>
+  if((pid = fork()) < 0){
+    32a7:	e8 24 14 00 00       	call   46d0 <fork>
+    32ac:	83 c4 10             	add    $0x10,%esp
+    32af:	85 c0                	test   %eax,%eax
+    32b1:	0f 88 e5 00 00 00    	js     339c <hsbrktest+0x10c>
+  if(pid == 0){
+    32b7:	0f 85 ab 00 00 00    	jne    3368 <hsbrktest+0xd8>
+    cur = sbrk(0);
+    32bd:	83 ec 0c             	sub    $0xc,%esp
+    32c0:	6a 00                	push   $0x0
+    32c2:	e8 ad 18 00 00       	call   4b74 <sbrk>
+    sbrk(((uint)cur + big - 1) / big * big - (uint)cur);
+    32c7:	8d 90 ff ff 3f 00    	lea    0x3fffff(%eax),%edx
+    32cd:	81 e2 00 00 c0 ff    	and    $0xffc00000,%edx
+    32d3:	29 c2                	sub    %eax,%edx
+    32d5:	89 14 24             	mov    %edx,(%esp)
+    32d8:	e8 97 18 00 00       	call   4b74 <sbrk>
+    if((base = hsbrk(big)) == (char*)-1){
+    32dd:	c7 04 24 00 00 40 00 	movl   $0x400000,(%esp)
+    32e4:	e8 12 19 00 00       	call   4bfb <hsbrk>
+    32e9:	83 c4 10             	add    $0x10,%esp
+    32ec:	89 c3                	mov    %eax,%ebx
+    32ee:	83 f8 ff             	cmp    $0xffffffff,%eax
+    32f1:	0f 84 bc 00 00 00    	je     33b3 <hsbrktest+0x123>
+    base[big-pg-1] = 'a';
+    32f7:	0f b7 05 f2 7f 00 00 	movzwl 0x7ff2,%eax
+    sbrk(-pg);
+    32fe:	83 ec 0c             	sub    $0xc,%esp
+    base[big-1] = 'c';
+    3301:	c6 83 ff ff 3f 00 63 	movb   $0x63,0x3fffff(%ebx)
+    base[big-pg-1] = 'a';
+    3308:	66 89 83 ff ef 3f 00 	mov    %ax,0x3fefff(%ebx)
+    sbrk(-pg);
+    330f:	68 00 f0 ff ff       	push   $0xfffff000
+    3314:	e8 5b 18 00 00       	call   4b74 <sbrk>
+    if(sbrk(pg) == (char*)-1){
+    3319:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+    3320:	e8 4f 18 00 00       	call   4b74 <sbrk>
+    3325:	83 c4 10             	add    $0x10,%esp
+    3328:	83 f8 ff             	cmp    $0xffffffff,%eax
+    332b:	0f 84 99 00 00 00    	je     33ca <hsbrktest+0x13a>
+    if(base[big-pg-1] != 'a' || base[big-pg] != 0 || base[big-1] != 0){
+    3331:	80 bb ff ef 3f 00 61 	cmpb   $0x61,0x3fefff(%ebx)
+    3338:	75 12                	jne    334c <hsbrktest+0xbc>
+    333a:	80 bb 00 f0 3f 00 00 	cmpb   $0x0,0x3ff000(%ebx)
+    3341:	75 09                	jne    334c <hsbrktest+0xbc>
+    3343:	80 bb ff ff 3f 00 00 	cmpb   $0x0,0x3fffff(%ebx)
+    334a:	74 2c                	je     3378 <hsbrktest+0xe8>
+      printf(out, "hsbrk test failed\n");
+    334c:	83 ec 08             	sub    $0x8,%esp
+    334f:	68 71 72 00 00       	push   $0x7271
+    3354:	ff 35 24 92 00 00    	push   0x9224
+    335a:	e8 91 1b 00 00       	call   4ef0 <printf>
+      exit();
+    335f:	e8 cc 13 00 00       	call   4730 <exit>
+    3364:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    3368:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    336b:	c9                   	leave
+  wait();
+    336c:	e9 13 17 00 00       	jmp    4a84 <wait>
+    3371:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    sbrk(-big);
+    3378:	83 ec 0c             	sub    $0xc,%esp
+    337b:	68 00 00 c0 ff       	push   $0xffc00000
+    3380:	e8 ef 17 00 00       	call   4b74 <sbrk>
+    printf(out, "hsbrk test ok\n");
+    3385:	58                   	pop    %eax
+    3386:	5a                   	pop    %edx
+    3387:	68 84 72 00 00       	push   $0x7284
+    338c:	ff 35 24 92 00 00    	push   0x9224
+    3392:	e8 59 1b 00 00       	call   4ef0 <printf>
+    exit();
+    3397:	e8 94 13 00 00       	call   4730 <exit>
+    printf(out, "hsbrk test: fork failed\n");
+    339c:	50                   	push   %eax
+    339d:	50                   	push   %eax
+    339e:	68 22 72 00 00       	push   $0x7222
+    33a3:	ff 35 24 92 00 00    	push   0x9224
+    33a9:	e8 42 1b 00 00       	call   4ef0 <printf>
+    exit();
+    33ae:	e8 7d 13 00 00       	call   4730 <exit>
+      printf(out, "hsbrk test: out of memory\n");
+    33b3:	53                   	push   %ebx
+    33b4:	53                   	push   %ebx
+    33b5:	68 3b 72 00 00       	push   $0x723b
+    33ba:	ff 35 24 92 00 00    	push   0x9224
+    33c0:	e8 2b 1b 00 00       	call   4ef0 <printf>
+      exit();
+    33c5:	e8 66 13 00 00       	call   4730 <exit>
+      printf(out, "hsbrk test: regrow failed\n");
+    33ca:	51                   	push   %ecx
+    33cb:	51                   	push   %ecx
+    33cc:	68 56 72 00 00       	push   $0x7256
+    33d1:	ff 35 24 92 00 00    	push   0x9224
+    33d7:	e8 14 1b 00 00       	call   4ef0 <printf>
+      exit();
+    33dc:	e8 4f 13 00 00       	call   4730 <exit>
+    33e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    33e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    33ef:	90                   	nop
+
+000033f0 <threadtest>:
+{
+    33f0:	55                   	push   %ebp
+    33f1:	89 e5                	mov    %esp,%ebp
+    33f3:	53                   	push   %ebx
+  for(i = 0; i < 4; i++){
+    33f4:	31 db                	xor    %ebx,%ebx
+{
+    33f6:	83 ec 0c             	sub    $0xc,%esp
+  printf(out, "thread test\n");
+    33f9:	68 40 73 00 00       	push   $0x7340
+    33fe:	ff 35 24 92 00 00    	push   0x9224
+    3404:	e8 e7 1a 00 00       	call   4ef0 <printf>
+  mutex_init(&tmu);
+    3409:	c7 04 24 40 ba 00 00 	movl   $0xba40,(%esp)
+    3410:	e8 1b 15 00 00       	call   4930 <mutex_init>
+  cond_init(&tcond);
+    3415:	c7 04 24 3c ba 00 00 	movl   $0xba3c,(%esp)
+    341c:	e8 9f 15 00 00       	call   49c0 <cond_init>
+  tcount = tturn = 0;
+    3421:	83 c4 10             	add    $0x10,%esp
+    3424:	c7 05 34 ba 00 00 00 	movl   $0x0,0xba34
+    342b:	00 00 00 
+    342e:	c7 05 38 ba 00 00 00 	movl   $0x0,0xba38
+    3435:	00 00 00 
+    if(thread_create(threadworker, (void*)i) < 0){
+    3438:	83 ec 08             	sub    $0x8,%esp
+    343b:	53                   	push   %ebx
+    343c:	68 50 01 00 00       	push   $0x150
+    3441:	e8 6a 2e 00 00       	call   62b0 <thread_create>
+    3446:	83 c4 10             	add    $0x10,%esp
+    3449:	85 c0                	test   %eax,%eax
+    344b:	78 58                	js     34a5 <threadtest+0xb5>
+  for(i = 0; i < 4; i++){
+    344d:	83 c3 01             	add    $0x1,%ebx
+    3450:	83 fb 04             	cmp    $0x4,%ebx
+    3453:	75 e3                	jne    3438 <threadtest+0x48>
+    if(thread_join() < 0){
+    3455:	e8 d6 2e 00 00       	call   6330 <thread_join>
+    345a:	85 c0                	test   %eax,%eax
+    345c:	78 5f                	js     34bd <threadtest+0xcd>
+  for(i = 0; i < 4; i++){
+    345e:	83 eb 01             	sub    $0x1,%ebx
+    3461:	75 f2                	jne    3455 <threadtest+0x65>
+  if(thread_join() != -1){
+    3463:	e8 c8 2e 00 00       	call   6330 <thread_join>
+    3468:	83 f8 ff             	cmp    $0xffffffff,%eax
+    346b:	0f 85 82 00 00 00    	jne    34f3 <threadtest+0x103>
+  if(tcount != 4000 || tturn != 4){
+    3471:	8b 15 38 ba 00 00    	mov    0xba38,%edx
+    printf(out, "thread_join with no threads succeeded\n");
+    3477:	a1 24 92 00 00       	mov    0x9224,%eax
+  if(tcount != 4000 || tturn != 4){
+    347c:	81 fa a0 0f 00 00    	cmp    $0xfa0,%edx
+    3482:	75 51                	jne    34d5 <threadtest+0xe5>
+    3484:	8b 15 34 ba 00 00    	mov    0xba34,%edx
+    348a:	83 fa 04             	cmp    $0x4,%edx
+    348d:	75 46                	jne    34d5 <threadtest+0xe5>
+  printf(out, "thread test ok\n");
+    348f:	83 ec 08             	sub    $0x8,%esp
+    3492:	68 52 73 00 00       	push   $0x7352
+    3497:	50                   	push   %eax
+    3498:	e8 53 1a 00 00       	call   4ef0 <printf>
+}
+    349d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    34a0:	83 c4 10             	add    $0x10,%esp
+    34a3:	c9                   	leave
+    34a4:	c3                   	ret
+      printf(out, "thread_create failed\n");
+    34a5:	83 ec 08             	sub    $0x8,%esp
+    34a8:	68 93 72 00 00       	push   $0x7293
+    34ad:	ff 35 24 92 00 00    	push   0x9224
+    34b3:	e8 38 1a 00 00       	call   4ef0 <printf>
+      exit();
+    34b8:	e8 73 12 00 00       	call   4730 <exit>
+      printf(out, "thread_join failed\n");
+    34bd:	83 ec 08             	sub    $0x8,%esp
+    34c0:	68 a9 72 00 00       	push   $0x72a9
+    34c5:	ff 35 24 92 00 00    	push   0x9224
+    34cb:	e8 20 1a 00 00       	call   4ef0 <printf>
+      exit();
+    34d0:	e8 5b 12 00 00       	call   4730 <exit>
+    printf(out, "thread test failed: count %d turn %d\n", tcount, tturn);
+    34d5:	8b 0d 34 ba 00 00    	mov    0xba34,%ecx
+    34db:	8b 15 38 ba 00 00    	mov    0xba38,%edx
+    34e1:	51                   	push   %ecx
+    34e2:	52                   	push   %edx
+    34e3:	68 1c 7d 00 00       	push   $0x7d1c
+    34e8:	50                   	push   %eax
+    34e9:	e8 02 1a 00 00       	call   4ef0 <printf>
+    exit();
+    34ee:	e8 3d 12 00 00       	call   4730 <exit>
+    printf(out, "thread_join with no threads succeeded\n");
+    34f3:	50                   	push   %eax
+    34f4:	50                   	push   %eax
+    34f5:	68 f4 7c 00 00       	push   $0x7cf4
+    34fa:	ff 35 24 92 00 00    	push   0x9224
+    3500:	e8 eb 19 00 00       	call   4ef0 <printf>
+    exit();
+    3505:	e8 26 12 00 00       	call   4730 <exit>
+    350a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003510 <mmaptest>:
+{
+    3510:	55                   	push   %ebp
+    3511:	89 e5                	mov    %esp,%ebp
+    3513:	56                   	push   %esi
+    3514:	53                   	push   %ebx
+  printf(out, "mmap test\n");
+    3515:	83 ec 08             	sub    $0x8,%esp
+    3518:	68 bd 72 00 00       	push   $0x72bd
+    351d:	ff 35 24 92 00 00    	push   0x9224
+    3523:	e8 c8 19 00 00       	call   4ef0 <printf>
+  fd = open("mmapf", O_CREATE|O_RDWR);
+    3528:	58                   	pop    %eax
+    3529:	5a                   	pop    %edx
+    352a:	68 02 02 00 00       	push   $0x202
+    352f:	68 c8 72 00 00       	push   $0x72c8
+    3534:	e8 b4 15 00 00       	call   4aed <open>
+  memset(buf, 'a', 600);
+    3539:	83 c4 0c             	add    $0xc,%esp
+    353c:	68 58 02 00 00       	push   $0x258
+  fd = open("mmapf", O_CREATE|O_RDWR);
+    3541:	89 c6                	mov    %eax,%esi
+  memset(buf, 'a', 600);
+    3543:	6a 61                	push   $0x61
+    3545:	68 60 ba 00 00       	push   $0xba60
+    354a:	e8 c1 12 00 00       	call   4810 <memset>
+  if(fd < 0 || write(fd, buf, 600) != 600){
+    354f:	83 c4 10             	add    $0x10,%esp
+    3552:	85 f6                	test   %esi,%esi
+    3554:	0f 88 53 01 00 00    	js     36ad <mmaptest+0x19d>
+    355a:	83 ec 04             	sub    $0x4,%esp
+    355d:	68 58 02 00 00       	push   $0x258
+    3562:	68 60 ba 00 00       	push   $0xba60
+    3567:	56                   	push   %esi
+    3568:	e8 44 15 00 00       	call   4ab1 <write>
+    356d:	83 c4 10             	add    $0x10,%esp
+    3570:	3d 58 02 00 00       	cmp    $0x258,%eax
+    3575:	0f 85 32 01 00 00    	jne    36ad <mmaptest+0x19d>
+  p = mmap(0, 600, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+    357b:	83 ec 08             	sub    $0x8,%esp
+    357e:	6a 00                	push   $0x0
+    3580:	56                   	push   %esi
+    3581:	6a 01                	push   $0x1
+    3583:	6a 03                	push   $0x3
+    3585:	68 58 02 00 00       	push   $0x258
+    358a:	6a 00                	push   $0x0
+    358c:	e8 79 16 00 00       	call   4c0a <mmap>
+  if(p == (char*)-1 || p[599] != 'a' || p[600] != 0){
+    3591:	83 c4 20             	add    $0x20,%esp
+  p = mmap(0, 600, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+    3594:	89 c3                	mov    %eax,%ebx
+  if(p == (char*)-1 || p[599] != 'a' || p[600] != 0){
+    3596:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3599:	0f 84 de 00 00 00    	je     367d <mmaptest+0x16d>
+    359f:	80 b8 57 02 00 00 61 	cmpb   $0x61,0x257(%eax)
+    35a6:	0f 85 d1 00 00 00    	jne    367d <mmaptest+0x16d>
+    35ac:	80 b8 58 02 00 00 00 	cmpb   $0x0,0x258(%eax)
+    35b3:	0f 85 c4 00 00 00    	jne    367d <mmaptest+0x16d>
+  close(fd);
+    35b9:	83 ec 0c             	sub    $0xc,%esp
+  p[0] = 'b';
+    35bc:	c6 00 62             	movb   $0x62,(%eax)
+  close(fd);
+    35bf:	56                   	push   %esi
+    35c0:	e8 fb 14 00 00       	call   4ac0 <close>
+  fd = open("mmapf", O_RDONLY);
+    35c5:	58                   	pop    %eax
+    35c6:	5a                   	pop    %edx
+    35c7:	6a 00                	push   $0x0
+    35c9:	68 c8 72 00 00       	push   $0x72c8
+    35ce:	e8 1a 15 00 00       	call   4aed <open>
+  if(munmap(p, 600) < 0 || read(fd, buf, 600) != 600 || buf[0] != 'b'){
+    35d3:	59                   	pop    %ecx
+  fd = open("mmapf", O_RDONLY);
+    35d4:	89 c6                	mov    %eax,%esi
+  if(munmap(p, 600) < 0 || read(fd, buf, 600) != 600 || buf[0] != 'b'){
+    35d6:	58                   	pop    %eax
+    35d7:	68 58 02 00 00       	push   $0x258
+    35dc:	53                   	push   %ebx
+    35dd:	e8 37 16 00 00       	call   4c19 <munmap>
+    35e2:	83 c4 10             	add    $0x10,%esp
+    35e5:	85 c0                	test   %eax,%eax
+    35e7:	0f 88 a8 00 00 00    	js     3695 <mmaptest+0x185>
+    35ed:	83 ec 04             	sub    $0x4,%esp
+    35f0:	68 58 02 00 00       	push   $0x258
+    35f5:	68 60 ba 00 00       	push   $0xba60
+    35fa:	56                   	push   %esi
+    35fb:	e8 a2 14 00 00       	call   4aa2 <read>
+    3600:	83 c4 10             	add    $0x10,%esp
+    3603:	3d 58 02 00 00       	cmp    $0x258,%eax
+    3608:	0f 85 87 00 00 00    	jne    3695 <mmaptest+0x185>
+    360e:	80 3d 60 ba 00 00 62 	cmpb   $0x62,0xba60
+    3615:	75 7e                	jne    3695 <mmaptest+0x185>
+  close(fd);
+    3617:	83 ec 0c             	sub    $0xc,%esp
+    361a:	56                   	push   %esi
+    361b:	e8 a0 14 00 00       	call   4ac0 <close>
+  unlink("mmapf");
+    3620:	c7 04 24 c8 72 00 00 	movl   $0x72c8,(%esp)
+    3627:	e8 df 14 00 00       	call   4b0b <unlink>
+  p = mmap(0, 8192, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    362c:	5b                   	pop    %ebx
+    362d:	5e                   	pop    %esi
+    362e:	6a 00                	push   $0x0
+    3630:	6a ff                	push   $0xffffffff
+    3632:	6a 06                	push   $0x6
+    3634:	6a 03                	push   $0x3
+    3636:	68 00 20 00 00       	push   $0x2000
+    363b:	6a 00                	push   $0x0
+    363d:	e8 c8 15 00 00       	call   4c0a <mmap>
+  if(p == (char*)-1 || p[4096] != 0){
+    3642:	83 c4 20             	add    $0x20,%esp
+    3645:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3648:	74 7a                	je     36c4 <mmaptest+0x1b4>
+    364a:	80 b8 00 10 00 00 00 	cmpb   $0x0,0x1000(%eax)
+    3651:	75 71                	jne    36c4 <mmaptest+0x1b4>
+  munmap(p, 8192);
+    3653:	83 ec 08             	sub    $0x8,%esp
+    3656:	68 00 20 00 00       	push   $0x2000
+    365b:	50                   	push   %eax
+    365c:	e8 b8 15 00 00       	call   4c19 <munmap>
+  printf(out, "mmap test ok\n");
+    3661:	58                   	pop    %eax
+    3662:	5a                   	pop    %edx
+    3663:	68 06 73 00 00       	push   $0x7306
+    3668:	ff 35 24 92 00 00    	push   0x9224
+    366e:	e8 7d 18 00 00       	call   4ef0 <printf>
+}
+    3673:	83 c4 10             	add    $0x10,%esp
+    3676:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3679:	5b                   	pop    %ebx
+    367a:	5e                   	pop    %esi
+    367b:	5d                   	pop    %ebp
+    367c:	c3                   	ret
+    printf(out, "mmap test: file mapping failed\n");
+    367d:	83 ec 08             	sub    $0x8,%esp
+    3680:	68 44 7d 00 00       	push   $0x7d44
+    3685:	ff 35 24 92 00 00    	push   0x9224
+    368b:	e8 60 18 00 00       	call   4ef0 <printf>
+    exit();
+    3690:	e8 9b 10 00 00       	call   4730 <exit>
+    printf(out, "mmap test: write back failed\n");
+    3695:	83 ec 08             	sub    $0x8,%esp
+    3698:	68 e8 72 00 00       	push   $0x72e8
+    369d:	ff 35 24 92 00 00    	push   0x9224
+    36a3:	e8 48 18 00 00       	call   4ef0 <printf>
+    exit();
+    36a8:	e8 83 10 00 00       	call   4730 <exit>
+    printf(out, "mmap test: create failed\n");
+    36ad:	50                   	push   %eax
+    36ae:	50                   	push   %eax
+    36af:	68 ce 72 00 00       	push   $0x72ce
+    36b4:	ff 35 24 92 00 00    	push   0x9224
+    36ba:	e8 31 18 00 00       	call   4ef0 <printf>
+    exit();
+    36bf:	e8 6c 10 00 00       	call   4730 <exit>
+    printf(out, "mmap test: anonymous mapping failed\n");
+    36c4:	51                   	push   %ecx
+    36c5:	51                   	push   %ecx
+    36c6:	68 64 7d 00 00       	push   $0x7d64
+    36cb:	ff 35 24 92 00 00    	push   0x9224
+    36d1:	e8 1a 18 00 00       	call   4ef0 <printf>
+    exit();
+    36d6:	e8 55 10 00 00       	call   4730 <exit>
+    36db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    36df:	90                   	nop
+
+000036e0 <mmapsharedtest>:
+{
+    36e0:	55                   	push   %ebp
+    36e1:	89 e5                	mov    %esp,%ebp
+    36e3:	57                   	push   %edi
+    36e4:	56                   	push   %esi
+    36e5:	53                   	push   %ebx
+    36e6:	83 ec 14             	sub    $0x14,%esp
+  printf(out, "mmap shared test\n");
+    36e9:	68 14 73 00 00       	push   $0x7314
+    36ee:	ff 35 24 92 00 00    	push   0x9224
+    36f4:	e8 f7 17 00 00       	call   4ef0 <printf>
+  p = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANON, -1, 0);
+    36f9:	5f                   	pop    %edi
+    36fa:	58                   	pop    %eax
+    36fb:	6a 00                	push   $0x0
+    36fd:	6a ff                	push   $0xffffffff
+    36ff:	6a 05                	push   $0x5
+    3701:	6a 03                	push   $0x3
+    3703:	68 00 10 00 00       	push   $0x1000
+    3708:	6a 00                	push   $0x0
+    370a:	e8 fb 14 00 00       	call   4c0a <mmap>
+  if(p == (char*)-1){
+    370f:	83 c4 20             	add    $0x20,%esp
+    3712:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3715:	0f 84 9f 01 00 00    	je     38ba <mmapsharedtest+0x1da>
+  p[0] = 'a';
+    371b:	c6 00 61             	movb   $0x61,(%eax)
+    371e:	89 c3                	mov    %eax,%ebx
+  pid = fork();
+    3720:	e8 ab 0f 00 00       	call   46d0 <fork>
+  if(pid < 0){
+    3725:	85 c0                	test   %eax,%eax
+    3727:	0f 88 76 01 00 00    	js     38a3 <mmapsharedtest+0x1c3>
+  if(pid == 0){
+    372d:	0f 84 68 01 00 00    	je     389b <mmapsharedtest+0x1bb>
+  wait();
+    3733:	e8 4c 13 00 00       	call   4a84 <wait>
+  if(p[0] != 'b'){
+    3738:	80 3b 62             	cmpb   $0x62,(%ebx)
+    373b:	0f 85 43 01 00 00    	jne    3884 <mmapsharedtest+0x1a4>
+  munmap(p, 4096);
+    3741:	83 ec 08             	sub    $0x8,%esp
+    3744:	68 00 10 00 00       	push   $0x1000
+    3749:	53                   	push   %ebx
+    374a:	e8 ca 14 00 00       	call   4c19 <munmap>
+  fd = open("mmapf", O_CREATE|O_RDWR);
+    374f:	58                   	pop    %eax
+    3750:	5a                   	pop    %edx
+    3751:	68 02 02 00 00       	push   $0x202
+    3756:	68 c8 72 00 00       	push   $0x72c8
+    375b:	e8 8d 13 00 00       	call   4aed <open>
+  memset(buf, 'a', 600);
+    3760:	83 c4 0c             	add    $0xc,%esp
+    3763:	68 58 02 00 00       	push   $0x258
+  fd = open("mmapf", O_CREATE|O_RDWR);
+    3768:	89 c3                	mov    %eax,%ebx
+  memset(buf, 'a', 600);
+    376a:	6a 61                	push   $0x61
+    376c:	68 60 ba 00 00       	push   $0xba60
+    3771:	e8 9a 10 00 00       	call   4810 <memset>
+  if(fd < 0 || write(fd, buf, 600) != 600){
+    3776:	83 c4 10             	add    $0x10,%esp
+    3779:	85 db                	test   %ebx,%ebx
+    377b:	0f 88 be 00 00 00    	js     383f <mmapsharedtest+0x15f>
+    3781:	83 ec 04             	sub    $0x4,%esp
+    3784:	68 58 02 00 00       	push   $0x258
+    3789:	68 60 ba 00 00       	push   $0xba60
+    378e:	53                   	push   %ebx
+    378f:	e8 1d 13 00 00       	call   4ab1 <write>
+    3794:	83 c4 10             	add    $0x10,%esp
+    3797:	3d 58 02 00 00       	cmp    $0x258,%eax
+    379c:	0f 85 9d 00 00 00    	jne    383f <mmapsharedtest+0x15f>
+  p = mmap(0, 600, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+    37a2:	83 ec 08             	sub    $0x8,%esp
+    37a5:	6a 00                	push   $0x0
+    37a7:	53                   	push   %ebx
+    37a8:	6a 01                	push   $0x1
+    37aa:	6a 03                	push   $0x3
+    37ac:	68 58 02 00 00       	push   $0x258
+    37b1:	6a 00                	push   $0x0
+    37b3:	e8 52 14 00 00       	call   4c0a <mmap>
+  q = mmap(0, 600, PROT_READ, MAP_SHARED, fd, 0);
+    37b8:	83 c4 18             	add    $0x18,%esp
+    37bb:	6a 00                	push   $0x0
+  p = mmap(0, 600, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+    37bd:	89 c7                	mov    %eax,%edi
+  q = mmap(0, 600, PROT_READ, MAP_SHARED, fd, 0);
+    37bf:	53                   	push   %ebx
+    37c0:	6a 01                	push   $0x1
+    37c2:	6a 01                	push   $0x1
+    37c4:	68 58 02 00 00       	push   $0x258
+    37c9:	6a 00                	push   $0x0
+    37cb:	e8 3a 14 00 00       	call   4c0a <mmap>
+  if(p == (char*)-1 || q == (char*)-1 || p == q){
+    37d0:	83 c4 20             	add    $0x20,%esp
+    37d3:	83 ff ff             	cmp    $0xffffffff,%edi
+  q = mmap(0, 600, PROT_READ, MAP_SHARED, fd, 0);
+    37d6:	89 c6                	mov    %eax,%esi
+  if(p == (char*)-1 || q == (char*)-1 || p == q){
+    37d8:	0f 94 c0             	sete   %al
+    37db:	83 fe ff             	cmp    $0xffffffff,%esi
+    37de:	0f 94 c2             	sete   %dl
+    37e1:	08 d0                	or     %dl,%al
+    37e3:	75 71                	jne    3856 <mmapsharedtest+0x176>
+    37e5:	39 f7                	cmp    %esi,%edi
+    37e7:	74 6d                	je     3856 <mmapsharedtest+0x176>
+  p[1] = 'c';
+    37e9:	c6 47 01 63          	movb   $0x63,0x1(%edi)
+  if(q[1] != 'c'){
+    37ed:	80 7e 01 63          	cmpb   $0x63,0x1(%esi)
+    37f1:	75 7a                	jne    386d <mmapsharedtest+0x18d>
+  munmap(p, 600);
+    37f3:	83 ec 08             	sub    $0x8,%esp
+    37f6:	68 58 02 00 00       	push   $0x258
+    37fb:	57                   	push   %edi
+    37fc:	e8 18 14 00 00       	call   4c19 <munmap>
+  munmap(q, 600);
+    3801:	58                   	pop    %eax
+    3802:	5a                   	pop    %edx
+    3803:	68 58 02 00 00       	push   $0x258
+    3808:	56                   	push   %esi
+    3809:	e8 0b 14 00 00       	call   4c19 <munmap>
+  close(fd);
+    380e:	89 1c 24             	mov    %ebx,(%esp)
+    3811:	e8 aa 12 00 00       	call   4ac0 <close>
+  unlink("mmapf");
+    3816:	c7 04 24 c8 72 00 00 	movl   $0x72c8,(%esp)
+    381d:	e8 e9 12 00 00       	call   4b0b <unlink>
+  printf(out, "mmap shared test ok\n");
+    3822:	59                   	pop    %ecx
+    3823:	5b                   	pop    %ebx
+    3824:	68 26 73 00 00       	push   $0x7326
+    3829:	ff 35 24 92 00 00    	push   0x9224
+    382f:	e8 bc 16 00 00       	call   4ef0 <printf>
+}
+    3834:	83 c4 10             	add    $0x10,%esp
+    3837:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    383a:	5b                   	pop    %ebx
+    383b:	5e                   	pop    %esi
+    383c:	5f                   	pop    %edi
+    383d:	5d                   	pop    %ebp
+    383e:	c3                   	ret
+    printf(out, "mmap shared test: create failed\n");
+    383f:	50                   	push   %eax
+    3840:	50                   	push   %eax
+    3841:	68 f0 7d 00 00       	push   $0x7df0
+    3846:	ff 35 24 92 00 00    	push   0x9224
+    384c:	e8 9f 16 00 00       	call   4ef0 <printf>
+    exit();
+    3851:	e8 da 0e 00 00       	call   4730 <exit>
+    printf(out, "mmap shared test: file mmap failed\n");
+    3856:	57                   	push   %edi
+    3857:	57                   	push   %edi
+    3858:	68 14 7e 00 00       	push   $0x7e14
+    385d:	ff 35 24 92 00 00    	push   0x9224
+    3863:	e8 88 16 00 00       	call   4ef0 <printf>
+    exit();
+    3868:	e8 c3 0e 00 00       	call   4730 <exit>
+    printf(out, "mmap shared test: mappings differ\n");
+    386d:	56                   	push   %esi
+    386e:	56                   	push   %esi
+    386f:	68 38 7e 00 00       	push   $0x7e38
+    3874:	ff 35 24 92 00 00    	push   0x9224
+    387a:	e8 71 16 00 00       	call   4ef0 <printf>
+    exit();
+    387f:	e8 ac 0e 00 00       	call   4730 <exit>
+    printf(out, "mmap shared test: child write lost\n");
+    3884:	51                   	push   %ecx
+    3885:	51                   	push   %ecx
+    3886:	68 cc 7d 00 00       	push   $0x7dcc
+    388b:	ff 35 24 92 00 00    	push   0x9224
+    3891:	e8 5a 16 00 00       	call   4ef0 <printf>
+    exit();
+    3896:	e8 95 0e 00 00       	call   4730 <exit>
+    p[0] = 'b';
+    389b:	c6 03 62             	movb   $0x62,(%ebx)
+    exit();
+    389e:	e8 8d 0e 00 00       	call   4730 <exit>
+    printf(out, "mmap shared test: fork failed\n");
+    38a3:	53                   	push   %ebx
+    38a4:	53                   	push   %ebx
+    38a5:	68 ac 7d 00 00       	push   $0x7dac
+    38aa:	ff 35 24 92 00 00    	push   0x9224
+    38b0:	e8 3b 16 00 00       	call   4ef0 <printf>
+    exit();
+    38b5:	e8 76 0e 00 00       	call   4730 <exit>
+    printf(out, "mmap shared test: mmap failed\n");
+    38ba:	56                   	push   %esi
+    38bb:	56                   	push   %esi
+    38bc:	68 8c 7d 00 00       	push   $0x7d8c
+    38c1:	ff 35 24 92 00 00    	push   0x9224
+    38c7:	e8 24 16 00 00       	call   4ef0 <printf>
+    exit();
+    38cc:	e8 5f 0e 00 00       	call   4730 <exit>
+    38d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    38d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    38df:	90                   	nop
+
+000038e0 <mmapthreadtest>:
+{
+    38e0:	55                   	push   %ebp
+    38e1:	89 e5                	mov    %esp,%ebp
+    38e3:	83 ec 10             	sub    $0x10,%esp
+  printf(out, "mmap thread test\n");
+    38e6:	68 3b 73 00 00       	push   $0x733b
+    38eb:	ff 35 24 92 00 00    	push   0x9224
+    38f1:	e8 fa 15 00 00       	call   4ef0 <printf>
+  tmap = 0;
+    38f6:	c7 05 30 ba 00 00 00 	movl   $0x0,0xba30
+    38fd:	00 00 00 
+  if(thread_create(mmapthread, 0) < 0 || thread_join() < 0){
+    3900:	58                   	pop    %eax
+    3901:	5a                   	pop    %edx
+    3902:	6a 00                	push   $0x0
+    3904:	68 00 02 00 00       	push   $0x200
+    3909:	e8 a2 29 00 00       	call   62b0 <thread_create>
+    390e:	83 c4 10             	add    $0x10,%esp
+    3911:	85 c0                	test   %eax,%eax
+    3913:	78 48                	js     395d <mmapthreadtest+0x7d>
+    3915:	e8 16 2a 00 00       	call   6330 <thread_join>
+    391a:	85 c0                	test   %eax,%eax
+    391c:	78 3f                	js     395d <mmapthreadtest+0x7d>
+  if(tmap == 0 || tmap == (char*)-1 || tmap[0] != 'x'){
+    391e:	a1 30 ba 00 00       	mov    0xba30,%eax
+    3923:	8d 50 ff             	lea    -0x1(%eax),%edx
+    3926:	83 fa fd             	cmp    $0xfffffffd,%edx
+    3929:	77 49                	ja     3974 <mmapthreadtest+0x94>
+    392b:	80 38 78             	cmpb   $0x78,(%eax)
+    392e:	75 44                	jne    3974 <mmapthreadtest+0x94>
+  if(munmap(tmap, 4096) < 0){
+    3930:	83 ec 08             	sub    $0x8,%esp
+    3933:	68 00 10 00 00       	push   $0x1000
+    3938:	50                   	push   %eax
+    3939:	e8 db 12 00 00       	call   4c19 <munmap>
+    393e:	83 c4 10             	add    $0x10,%esp
+    3941:	85 c0                	test   %eax,%eax
+    3943:	78 46                	js     398b <mmapthreadtest+0xab>
+  printf(out, "mmap thread test ok\n");
+    3945:	83 ec 08             	sub    $0x8,%esp
+    3948:	68 4d 73 00 00       	push   $0x734d
+    394d:	ff 35 24 92 00 00    	push   0x9224
+    3953:	e8 98 15 00 00       	call   4ef0 <printf>
+}
+    3958:	83 c4 10             	add    $0x10,%esp
+    395b:	c9                   	leave
+    395c:	c3                   	ret
+    printf(out, "mmap thread test: thread failed\n");
+    395d:	51                   	push   %ecx
+    395e:	51                   	push   %ecx
+    395f:	68 5c 7e 00 00       	push   $0x7e5c
+    3964:	ff 35 24 92 00 00    	push   0x9224
+    396a:	e8 81 15 00 00       	call   4ef0 <printf>
+    exit();
+    396f:	e8 bc 0d 00 00       	call   4730 <exit>
+    printf(out, "mmap thread test: mapping lost\n");
+    3974:	52                   	push   %edx
+    3975:	52                   	push   %edx
+    3976:	68 80 7e 00 00       	push   $0x7e80
+    397b:	ff 35 24 92 00 00    	push   0x9224
+    3981:	e8 6a 15 00 00       	call   4ef0 <printf>
+    exit();
+    3986:	e8 a5 0d 00 00       	call   4730 <exit>
+    printf(out, "mmap thread test: munmap failed\n");
+    398b:	50                   	push   %eax
+    398c:	50                   	push   %eax
+    398d:	68 a0 7e 00 00       	push   $0x7ea0
+    3992:	ff 35 24 92 00 00    	push   0x9224
+    3998:	e8 53 15 00 00       	call   4ef0 <printf>
+    exit();
+    399d:	e8 8e 0d 00 00       	call   4730 <exit>
+    39a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    39a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000039b0 <ringtest>:
+{
+    39b0:	55                   	push   %ebp
+    39b1:	89 e5                	mov    %esp,%ebp
+    39b3:	53                   	push   %ebx
+    39b4:	83 ec 0c             	sub    $0xc,%esp
+  printf(out, "ring test\n");
+    39b7:	68 62 73 00 00       	push   $0x7362
+    39bc:	ff 35 24 92 00 00    	push   0x9224
+    39c2:	e8 29 15 00 00       	call   4ef0 <printf>
+  r.sq[0].op = SYS_dup;
+    39c7:	c7 05 f0 e0 00 00 0a 	movl   $0xa,0xe0f0
+    39ce:	00 00 00 
+  r.sq[1].op = SYS_fork;
+    39d1:	c7 05 08 e1 00 00 01 	movl   $0x1,0xe108
+    39d8:	00 00 00 
+  r.sqtail = 2;
+    39db:	c7 05 e4 e0 00 00 02 	movl   $0x2,0xe0e4
+    39e2:	00 00 00 
+  if(ringenter(&r, 3) != 2 || r.cq[0].res < 0 || r.cq[1].res != -1){
+    39e5:	58                   	pop    %eax
+    39e6:	5a                   	pop    %edx
+    39e7:	6a 03                	push   $0x3
+    39e9:	68 e0 e0 00 00       	push   $0xe0e0
+    39ee:	e8 35 12 00 00       	call   4c28 <ringenter>
+    39f3:	83 c4 10             	add    $0x10,%esp
+    39f6:	83 f8 02             	cmp    $0x2,%eax
+    39f9:	0f 85 1f 01 00 00    	jne    3b1e <ringtest+0x16e>
+    39ff:	a1 70 e2 00 00       	mov    0xe270,%eax
+    3a04:	85 c0                	test   %eax,%eax
+    3a06:	0f 88 12 01 00 00    	js     3b1e <ringtest+0x16e>
+    3a0c:	83 3d 78 e2 00 00 ff 	cmpl   $0xffffffff,0xe278
+    3a13:	0f 85 05 01 00 00    	jne    3b1e <ringtest+0x16e>
+  close(r.cq[0].res);
+    3a19:	83 ec 0c             	sub    $0xc,%esp
+    3a1c:	50                   	push   %eax
+    3a1d:	e8 9e 10 00 00       	call   4ac0 <close>
+  fd = open("ringf", O_CREATE|O_RDWR);
+    3a22:	5b                   	pop    %ebx
+    3a23:	58                   	pop    %eax
+    3a24:	68 02 02 00 00       	push   $0x202
+    3a29:	68 7f 73 00 00       	push   $0x737f
+    3a2e:	e8 ba 10 00 00       	call   4aed <open>
+  if(fd < 0 || write(fd, "abc", 3) != 3){
+    3a33:	83 c4 10             	add    $0x10,%esp
+  fd = open("ringf", O_CREATE|O_RDWR);
+    3a36:	89 c3                	mov    %eax,%ebx
+  if(fd < 0 || write(fd, "abc", 3) != 3){
+    3a38:	85 c0                	test   %eax,%eax
+    3a3a:	0f 88 f6 00 00 00    	js     3b36 <ringtest+0x186>
+    3a40:	83 ec 04             	sub    $0x4,%esp
+    3a43:	6a 03                	push   $0x3
+    3a45:	68 9f 73 00 00       	push   $0x739f
+    3a4a:	50                   	push   %eax
+    3a4b:	e8 61 10 00 00       	call   4ab1 <write>
+    3a50:	83 c4 10             	add    $0x10,%esp
+    3a53:	83 f8 03             	cmp    $0x3,%eax
+    3a56:	0f 85 da 00 00 00    	jne    3b36 <ringtest+0x186>
+  if(ringenter(&r, 1) != 1 || r.cq[2].res != 2 || buf[0] != 'b' || buf[1] != 'c'){
+    3a5c:	83 ec 08             	sub    $0x8,%esp
+  r.sq[2].op = SYS_pread;
+    3a5f:	c7 05 20 e1 00 00 23 	movl   $0x23,0xe120
+    3a66:	00 00 00 
+  r.sq[2].arg[0] = fd;
+    3a69:	89 1d 24 e1 00 00    	mov    %ebx,0xe124
+  r.sq[2].arg[1] = (int)buf;
+    3a6f:	c7 05 28 e1 00 00 60 	movl   $0xba60,0xe128
+    3a76:	ba 00 00 
+  r.sq[2].arg[2] = 2;
+    3a79:	c7 05 2c e1 00 00 02 	movl   $0x2,0xe12c
+    3a80:	00 00 00 
+  r.sq[2].arg[3] = 1;
+    3a83:	c7 05 30 e1 00 00 01 	movl   $0x1,0xe130
+    3a8a:	00 00 00 
+  r.sq[2].data = 0;
+    3a8d:	c7 05 34 e1 00 00 00 	movl   $0x0,0xe134
+    3a94:	00 00 00 
+  r.sqtail = 3;
+    3a97:	c7 05 e4 e0 00 00 03 	movl   $0x3,0xe0e4
+    3a9e:	00 00 00 
+  buf[0] = 0;
+    3aa1:	c6 05 60 ba 00 00 00 	movb   $0x0,0xba60
+  if(ringenter(&r, 1) != 1 || r.cq[2].res != 2 || buf[0] != 'b' || buf[1] != 'c'){
+    3aa8:	6a 01                	push   $0x1
+    3aaa:	68 e0 e0 00 00       	push   $0xe0e0
+    3aaf:	e8 74 11 00 00       	call   4c28 <ringenter>
+    3ab4:	83 c4 10             	add    $0x10,%esp
+    3ab7:	83 f8 01             	cmp    $0x1,%eax
+    3aba:	75 4a                	jne    3b06 <ringtest+0x156>
+    3abc:	83 3d 80 e2 00 00 02 	cmpl   $0x2,0xe280
+    3ac3:	75 41                	jne    3b06 <ringtest+0x156>
+    3ac5:	80 3d 60 ba 00 00 62 	cmpb   $0x62,0xba60
+    3acc:	75 38                	jne    3b06 <ringtest+0x156>
+    3ace:	80 3d 61 ba 00 00 63 	cmpb   $0x63,0xba61
+    3ad5:	75 2f                	jne    3b06 <ringtest+0x156>
+  close(fd);
+    3ad7:	83 ec 0c             	sub    $0xc,%esp
+    3ada:	53                   	push   %ebx
+    3adb:	e8 e0 0f 00 00       	call   4ac0 <close>
+  unlink("ringf");
+    3ae0:	c7 04 24 7f 73 00 00 	movl   $0x737f,(%esp)
+    3ae7:	e8 1f 10 00 00       	call   4b0b <unlink>
+  printf(out, "ring test ok\n");
+    3aec:	58                   	pop    %eax
+    3aed:	5a                   	pop    %edx
+    3aee:	68 bc 73 00 00       	push   $0x73bc
+    3af3:	ff 35 24 92 00 00    	push   0x9224
+    3af9:	e8 f2 13 00 00       	call   4ef0 <printf>
+}
+    3afe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3b01:	83 c4 10             	add    $0x10,%esp
+    3b04:	c9                   	leave
+    3b05:	c3                   	ret
+    printf(out, "ring test: pread failed\n");
+    3b06:	83 ec 08             	sub    $0x8,%esp
+    3b09:	68 a3 73 00 00       	push   $0x73a3
+    3b0e:	ff 35 24 92 00 00    	push   0x9224
+    3b14:	e8 d7 13 00 00       	call   4ef0 <printf>
+    exit();
+    3b19:	e8 12 0c 00 00       	call   4730 <exit>
+    printf(out, "ring test failed\n");
+    3b1e:	83 ec 08             	sub    $0x8,%esp
+    3b21:	68 6d 73 00 00       	push   $0x736d
+    3b26:	ff 35 24 92 00 00    	push   0x9224
+    3b2c:	e8 bf 13 00 00       	call   4ef0 <printf>
+    exit();
+    3b31:	e8 fa 0b 00 00       	call   4730 <exit>
+    printf(out, "ring test: create failed\n");
+    3b36:	51                   	push   %ecx
+    3b37:	51                   	push   %ecx
+    3b38:	68 85 73 00 00       	push   $0x7385
+    3b3d:	ff 35 24 92 00 00    	push   0x9224
+    3b43:	e8 a8 13 00 00       	call   4ef0 <printf>
+    exit();
+    3b48:	e8 e3 0b 00 00       	call   4730 <exit>
+    3b4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003b50 <uiotest>:
+{
+    3b50:	55                   	push   %ebp
+    3b51:	89 e5                	mov    %esp,%ebp
+    3b53:	53                   	push   %ebx
+    3b54:	83 ec 1c             	sub    $0x1c,%esp
+  struct iovec iov[2] = { { buf, 1 }, { buf+8, 2 } };
+    3b57:	c7 45 e8 60 ba 00 00 	movl   $0xba60,-0x18(%ebp)
+    3b5e:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%ebp)
+    3b65:	c7 45 f0 68 ba 00 00 	movl   $0xba68,-0x10(%ebp)
+    3b6c:	c7 45 f4 02 00 00 00 	movl   $0x2,-0xc(%ebp)
+  printf(out, "uio test\n");
+    3b73:	68 ca 73 00 00       	push   $0x73ca
+    3b78:	ff 35 24 92 00 00    	push   0x9224
+    3b7e:	e8 6d 13 00 00       	call   4ef0 <printf>
+  fd = open("uiof", O_CREATE|O_RDWR);
+    3b83:	59                   	pop    %ecx
+    3b84:	5b                   	pop    %ebx
+    3b85:	68 02 02 00 00       	push   $0x202
+    3b8a:	68 d4 73 00 00       	push   $0x73d4
+    3b8f:	e8 59 0f 00 00       	call   4aed <open>
+  if(fd < 0 || pwrite(fd, "abc", 3, 0) != 3 || pread(fd, buf, 2, 1) != 2 ||
+    3b94:	83 c4 10             	add    $0x10,%esp
+    3b97:	85 c0                	test   %eax,%eax
+    3b99:	0f 88 91 00 00 00    	js     3c30 <uiotest+0xe0>
+    3b9f:	6a 00                	push   $0x0
+    3ba1:	89 c3                	mov    %eax,%ebx
+    3ba3:	6a 03                	push   $0x3
+    3ba5:	68 9f 73 00 00       	push   $0x739f
+    3baa:	50                   	push   %eax
+    3bab:	e8 b4 10 00 00       	call   4c64 <pwrite>
+    3bb0:	83 c4 10             	add    $0x10,%esp
+    3bb3:	83 f8 03             	cmp    $0x3,%eax
+    3bb6:	75 78                	jne    3c30 <uiotest+0xe0>
+    3bb8:	6a 01                	push   $0x1
+    3bba:	6a 02                	push   $0x2
+    3bbc:	68 60 ba 00 00       	push   $0xba60
+    3bc1:	53                   	push   %ebx
+    3bc2:	e8 8e 10 00 00       	call   4c55 <pread>
+    3bc7:	83 c4 10             	add    $0x10,%esp
+    3bca:	83 f8 02             	cmp    $0x2,%eax
+    3bcd:	75 61                	jne    3c30 <uiotest+0xe0>
+    3bcf:	80 3d 61 ba 00 00 63 	cmpb   $0x63,0xba61
+    3bd6:	75 58                	jne    3c30 <uiotest+0xe0>
+     buf[1] != 'c' || readv(fd, iov, 2) != 3 || buf[0] != 'a' || buf[9] != 'c'){
+    3bd8:	83 ec 04             	sub    $0x4,%esp
+    3bdb:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    3bde:	6a 02                	push   $0x2
+    3be0:	50                   	push   %eax
+    3be1:	53                   	push   %ebx
+    3be2:	e8 50 10 00 00       	call   4c37 <readv>
+    3be7:	83 c4 10             	add    $0x10,%esp
+    3bea:	83 f8 03             	cmp    $0x3,%eax
+    3bed:	75 41                	jne    3c30 <uiotest+0xe0>
+    3bef:	80 3d 60 ba 00 00 61 	cmpb   $0x61,0xba60
+    3bf6:	75 38                	jne    3c30 <uiotest+0xe0>
+    3bf8:	80 3d 69 ba 00 00 63 	cmpb   $0x63,0xba69
+    3bff:	75 2f                	jne    3c30 <uiotest+0xe0>
+  close(fd);
+    3c01:	83 ec 0c             	sub    $0xc,%esp
+    3c04:	53                   	push   %ebx
+    3c05:	e8 b6 0e 00 00       	call   4ac0 <close>
+  unlink("uiof");
+    3c0a:	c7 04 24 d4 73 00 00 	movl   $0x73d4,(%esp)
+    3c11:	e8 f5 0e 00 00       	call   4b0b <unlink>
+  printf(out, "uio test ok\n");
+    3c16:	58                   	pop    %eax
+    3c17:	5a                   	pop    %edx
+    3c18:	68 ea 73 00 00       	push   $0x73ea
+    3c1d:	ff 35 24 92 00 00    	push   0x9224
+    3c23:	e8 c8 12 00 00       	call   4ef0 <printf>
+}
+    3c28:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3c2b:	83 c4 10             	add    $0x10,%esp
+    3c2e:	c9                   	leave
+    3c2f:	c3                   	ret
+    printf(out, "uio test failed\n");
+    3c30:	83 ec 08             	sub    $0x8,%esp
+    3c33:	68 d9 73 00 00       	push   $0x73d9
+    3c38:	ff 35 24 92 00 00    	push   0x9224
+    3c3e:	e8 ad 12 00 00       	call   4ef0 <printf>
+    exit();
+    3c43:	e8 e8 0a 00 00       	call   4730 <exit>
+    3c48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3c4f:	90                   	nop
+
+00003c50 <stdiotest>:
+{
+    3c50:	55                   	push   %ebp
+    3c51:	89 e5                	mov    %esp,%ebp
+    3c53:	53                   	push   %ebx
+    3c54:	83 ec 0c             	sub    $0xc,%esp
+  printf(out, "stdio test\n");
+    3c57:	68 f7 73 00 00       	push   $0x73f7
+    3c5c:	ff 35 24 92 00 00    	push   0x9224
+    3c62:	e8 89 12 00 00       	call   4ef0 <printf>
+    if((f = fopen("stdiof", "w")) == 0){
+    3c67:	58                   	pop    %eax
+    3c68:	5a                   	pop    %edx
+    3c69:	68 03 74 00 00       	push   $0x7403
+    3c6e:	68 05 74 00 00       	push   $0x7405
+    3c73:	e8 88 15 00 00       	call   5200 <fopen>
+    3c78:	83 c4 10             	add    $0x10,%esp
+    3c7b:	85 c0                	test   %eax,%eax
+    3c7d:	0f 84 53 01 00 00    	je     3dd6 <stdiotest+0x186>
+    fprintf(f, "%d line\n", 100+i);
+    3c83:	83 ec 04             	sub    $0x4,%esp
+    3c86:	89 c3                	mov    %eax,%ebx
+    3c88:	6a 64                	push   $0x64
+    3c8a:	68 0c 74 00 00       	push   $0x740c
+    3c8f:	50                   	push   %eax
+    3c90:	e8 2b 12 00 00       	call   4ec0 <fprintf>
+    fprintf(f, "tail");
+    3c95:	58                   	pop    %eax
+    3c96:	5a                   	pop    %edx
+    3c97:	68 15 74 00 00       	push   $0x7415
+    3c9c:	53                   	push   %ebx
+    3c9d:	e8 1e 12 00 00       	call   4ec0 <fprintf>
+    fclose(f);
+    3ca2:	89 1c 24             	mov    %ebx,(%esp)
+    3ca5:	e8 16 17 00 00       	call   53c0 <fclose>
+    if((f = fopen("stdiof", "w")) == 0){
+    3caa:	59                   	pop    %ecx
+    3cab:	5b                   	pop    %ebx
+    3cac:	68 03 74 00 00       	push   $0x7403
+    3cb1:	68 05 74 00 00       	push   $0x7405
+    3cb6:	e8 45 15 00 00       	call   5200 <fopen>
+    3cbb:	83 c4 10             	add    $0x10,%esp
+    3cbe:	89 c3                	mov    %eax,%ebx
+    3cc0:	85 c0                	test   %eax,%eax
+    3cc2:	0f 84 0e 01 00 00    	je     3dd6 <stdiotest+0x186>
+    fprintf(f, "%d line\n", 100+i);
+    3cc8:	83 ec 04             	sub    $0x4,%esp
+    3ccb:	6a 65                	push   $0x65
+    3ccd:	68 0c 74 00 00       	push   $0x740c
+    3cd2:	50                   	push   %eax
+    3cd3:	e8 e8 11 00 00       	call   4ec0 <fprintf>
+    fprintf(f, "tail");
+    3cd8:	59                   	pop    %ecx
+    3cd9:	58                   	pop    %eax
+    3cda:	68 15 74 00 00       	push   $0x7415
+    3cdf:	53                   	push   %ebx
+    3ce0:	e8 db 11 00 00       	call   4ec0 <fprintf>
+    fclose(f);
+    3ce5:	89 1c 24             	mov    %ebx,(%esp)
+    3ce8:	e8 d3 16 00 00       	call   53c0 <fclose>
+  if((f = fopen("stdiof", "r")) == 0 || fgets(buf, sizeof(buf), f) == 0 ||
+    3ced:	58                   	pop    %eax
+    3cee:	5a                   	pop    %edx
+    3cef:	68 1b 64 00 00       	push   $0x641b
+    3cf4:	68 05 74 00 00       	push   $0x7405
+    3cf9:	e8 02 15 00 00       	call   5200 <fopen>
+    3cfe:	83 c4 10             	add    $0x10,%esp
+    3d01:	89 c3                	mov    %eax,%ebx
+    3d03:	85 c0                	test   %eax,%eax
+    3d05:	0f 84 b3 00 00 00    	je     3dbe <stdiotest+0x16e>
+    3d0b:	83 ec 04             	sub    $0x4,%esp
+    3d0e:	50                   	push   %eax
+    3d0f:	68 00 20 00 00       	push   $0x2000
+    3d14:	68 60 ba 00 00       	push   $0xba60
+    3d19:	e8 52 1c 00 00       	call   5970 <fgets>
+    3d1e:	83 c4 10             	add    $0x10,%esp
+    3d21:	85 c0                	test   %eax,%eax
+    3d23:	0f 84 95 00 00 00    	je     3dbe <stdiotest+0x16e>
+     strcmp(buf, "101 line\n") != 0 || fgets(buf, sizeof(buf), f) == 0 ||
+    3d29:	83 ec 08             	sub    $0x8,%esp
+    3d2c:	68 54 74 00 00       	push   $0x7454
+    3d31:	68 60 ba 00 00       	push   $0xba60
+    3d36:	e8 45 0a 00 00       	call   4780 <strcmp>
+  if((f = fopen("stdiof", "r")) == 0 || fgets(buf, sizeof(buf), f) == 0 ||
+    3d3b:	83 c4 10             	add    $0x10,%esp
+    3d3e:	85 c0                	test   %eax,%eax
+    3d40:	75 7c                	jne    3dbe <stdiotest+0x16e>
+     strcmp(buf, "101 line\n") != 0 || fgets(buf, sizeof(buf), f) == 0 ||
+    3d42:	83 ec 04             	sub    $0x4,%esp
+    3d45:	53                   	push   %ebx
+    3d46:	68 00 20 00 00       	push   $0x2000
+    3d4b:	68 60 ba 00 00       	push   $0xba60
+    3d50:	e8 1b 1c 00 00       	call   5970 <fgets>
+    3d55:	83 c4 10             	add    $0x10,%esp
+    3d58:	85 c0                	test   %eax,%eax
+    3d5a:	74 62                	je     3dbe <stdiotest+0x16e>
+     strcmp(buf, "tail") != 0 || fgets(buf, sizeof(buf), f) != 0){
+    3d5c:	83 ec 08             	sub    $0x8,%esp
+    3d5f:	68 15 74 00 00       	push   $0x7415
+    3d64:	68 60 ba 00 00       	push   $0xba60
+    3d69:	e8 12 0a 00 00       	call   4780 <strcmp>
+     strcmp(buf, "101 line\n") != 0 || fgets(buf, sizeof(buf), f) == 0 ||
+    3d6e:	83 c4 10             	add    $0x10,%esp
+    3d71:	85 c0                	test   %eax,%eax
+    3d73:	75 49                	jne    3dbe <stdiotest+0x16e>
+     strcmp(buf, "tail") != 0 || fgets(buf, sizeof(buf), f) != 0){
+    3d75:	83 ec 04             	sub    $0x4,%esp
+    3d78:	53                   	push   %ebx
+    3d79:	68 00 20 00 00       	push   $0x2000
+    3d7e:	68 60 ba 00 00       	push   $0xba60
+    3d83:	e8 e8 1b 00 00       	call   5970 <fgets>
+    3d88:	83 c4 10             	add    $0x10,%esp
+    3d8b:	85 c0                	test   %eax,%eax
+    3d8d:	75 2f                	jne    3dbe <stdiotest+0x16e>
+  fclose(f);
+    3d8f:	83 ec 0c             	sub    $0xc,%esp
+    3d92:	53                   	push   %ebx
+    3d93:	e8 28 16 00 00       	call   53c0 <fclose>
+  unlink("stdiof");
+    3d98:	c7 04 24 05 74 00 00 	movl   $0x7405,(%esp)
+    3d9f:	e8 67 0d 00 00       	call   4b0b <unlink>
+  printf(out, "stdio test ok\n");
+    3da4:	58                   	pop    %eax
+    3da5:	5a                   	pop    %edx
+    3da6:	68 5e 74 00 00       	push   $0x745e
+    3dab:	ff 35 24 92 00 00    	push   0x9224
+    3db1:	e8 3a 11 00 00       	call   4ef0 <printf>
+}
+    3db6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3db9:	83 c4 10             	add    $0x10,%esp
+    3dbc:	c9                   	leave
+    3dbd:	c3                   	ret
+    printf(out, "stdio test: read back failed\n");
+    3dbe:	83 ec 08             	sub    $0x8,%esp
+    3dc1:	68 36 74 00 00       	push   $0x7436
+    3dc6:	ff 35 24 92 00 00    	push   0x9224
+    3dcc:	e8 1f 11 00 00       	call   4ef0 <printf>
+    exit();
+    3dd1:	e8 5a 09 00 00       	call   4730 <exit>
+      printf(out, "stdio test: fopen w failed\n");
+    3dd6:	51                   	push   %ecx
+    3dd7:	51                   	push   %ecx
+    3dd8:	68 1a 74 00 00       	push   $0x741a
+    3ddd:	ff 35 24 92 00 00    	push   0x9224
+    3de3:	e8 08 11 00 00       	call   4ef0 <printf>
+      exit();
+    3de8:	e8 43 09 00 00       	call   4730 <exit>
+    3ded:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003df0 <proftest>:
+{
+    3df0:	55                   	push   %ebp
+    3df1:	89 e5                	mov    %esp,%ebp
+    3df3:	57                   	push   %edi
+    3df4:	56                   	push   %esi
+    3df5:	53                   	push   %ebx
+    3df6:	81 ec 04 01 00 00    	sub    $0x104,%esp
+  printf(out, "prof test\n");
+    3dfc:	68 6d 74 00 00       	push   $0x746d
+    3e01:	ff 35 24 92 00 00    	push   0x9224
+    3e07:	e8 e4 10 00 00       	call   4ef0 <printf>
+  if(prof(PROF_START, 0, 0) < 0){
+    3e0c:	83 c4 0c             	add    $0xc,%esp
+    3e0f:	6a 00                	push   $0x0
+    3e11:	6a 00                	push   $0x0
+    3e13:	6a 01                	push   $0x1
+    3e15:	e8 59 0e 00 00       	call   4c73 <prof>
+    3e1a:	83 c4 10             	add    $0x10,%esp
+    3e1d:	85 c0                	test   %eax,%eax
+    3e1f:	0f 88 b1 00 00 00    	js     3ed6 <proftest+0xe6>
+  t = uptime();
+    3e25:	e8 36 0c 00 00       	call   4a60 <uptime>
+  while(uptime() < t + 5)
+    3e2a:	8d 58 04             	lea    0x4(%eax),%ebx
+    3e2d:	8d 76 00             	lea    0x0(%esi),%esi
+    3e30:	e8 2b 0c 00 00       	call   4a60 <uptime>
+    3e35:	39 d8                	cmp    %ebx,%eax
+    3e37:	7e f7                	jle    3e30 <proftest+0x40>
+  prof(PROF_STOP, 0, 0);
+    3e39:	83 ec 04             	sub    $0x4,%esp
+    3e3c:	6a 00                	push   $0x0
+    3e3e:	6a 00                	push   $0x0
+    3e40:	6a 02                	push   $0x2
+    3e42:	e8 2c 0e 00 00       	call   4c73 <prof>
+  while((n = prof(PROF_READ, s, 8)) > 0)
+    3e47:	83 c4 10             	add    $0x10,%esp
+  mine = 0;
+    3e4a:	c7 85 04 ff ff ff 00 	movl   $0x0,-0xfc(%ebp)
+    3e51:	00 00 00 
+    3e54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((n = prof(PROF_READ, s, 8)) > 0)
+    3e58:	83 ec 04             	sub    $0x4,%esp
+    3e5b:	8d 85 08 ff ff ff    	lea    -0xf8(%ebp),%eax
+    3e61:	6a 08                	push   $0x8
+    3e63:	50                   	push   %eax
+    3e64:	6a 03                	push   $0x3
+    3e66:	e8 08 0e 00 00       	call   4c73 <prof>
+    3e6b:	83 c4 10             	add    $0x10,%esp
+    3e6e:	85 c0                	test   %eax,%eax
+    3e70:	7e 36                	jle    3ea8 <proftest+0xb8>
+    while(n-- > 0)
+    3e72:	8d 70 ff             	lea    -0x1(%eax),%esi
+    3e75:	6b c0 1c             	imul   $0x1c,%eax,%eax
+    3e78:	8d bc 05 f0 fe ff ff 	lea    -0x110(%ebp,%eax,1),%edi
+    3e7f:	90                   	nop
+      if(s[n].pid == getpid() && s[n].user)
+    3e80:	8b 1f                	mov    (%edi),%ebx
+    3e82:	e8 de 0c 00 00       	call   4b65 <getpid>
+    3e87:	39 c3                	cmp    %eax,%ebx
+    3e89:	75 0c                	jne    3e97 <proftest+0xa7>
+        mine++;
+    3e8b:	66 83 7f 06 01       	cmpw   $0x1,0x6(%edi)
+    3e90:	83 9d 04 ff ff ff ff 	sbbl   $0xffffffff,-0xfc(%ebp)
+    while(n-- > 0)
+    3e97:	83 ee 01             	sub    $0x1,%esi
+    3e9a:	83 ef 1c             	sub    $0x1c,%edi
+    3e9d:	83 fe ff             	cmp    $0xffffffff,%esi
+    3ea0:	75 de                	jne    3e80 <proftest+0x90>
+    3ea2:	eb b4                	jmp    3e58 <proftest+0x68>
+    3ea4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    printf(out, "prof test failed\n");
+    3ea8:	8b 15 24 92 00 00    	mov    0x9224,%edx
+  if(n != -1 || mine == 0){
+    3eae:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3eb1:	75 3a                	jne    3eed <proftest+0xfd>
+    3eb3:	8b 8d 04 ff ff ff    	mov    -0xfc(%ebp),%ecx
+    3eb9:	85 c9                	test   %ecx,%ecx
+    3ebb:	74 30                	je     3eed <proftest+0xfd>
+  printf(out, "prof test ok\n");
+    3ebd:	83 ec 08             	sub    $0x8,%esp
+    3ec0:	68 a3 74 00 00       	push   $0x74a3
+    3ec5:	52                   	push   %edx
+    3ec6:	e8 25 10 00 00       	call   4ef0 <printf>
+}
+    3ecb:	83 c4 10             	add    $0x10,%esp
+    3ece:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3ed1:	5b                   	pop    %ebx
+    3ed2:	5e                   	pop    %esi
+    3ed3:	5f                   	pop    %edi
+    3ed4:	5d                   	pop    %ebp
+    3ed5:	c3                   	ret
+    printf(out, "prof test: start failed\n");
+    3ed6:	53                   	push   %ebx
+    3ed7:	53                   	push   %ebx
+    3ed8:	68 78 74 00 00       	push   $0x7478
+    3edd:	ff 35 24 92 00 00    	push   0x9224
+    3ee3:	e8 08 10 00 00       	call   4ef0 <printf>
+    exit();
+    3ee8:	e8 43 08 00 00       	call   4730 <exit>
+    printf(out, "prof test failed\n");
+    3eed:	50                   	push   %eax
+    3eee:	50                   	push   %eax
+    3eef:	68 91 74 00 00       	push   $0x7491
+    3ef4:	52                   	push   %edx
+    3ef5:	e8 f6 0f 00 00       	call   4ef0 <printf>
+    exit();
+    3efa:	e8 31 08 00 00       	call   4730 <exit>
+    3eff:	90                   	nop
+
+00003f00 <scstattest>:
+{
+    3f00:	55                   	push   %ebp
+    3f01:	89 e5                	mov    %esp,%ebp
+    3f03:	53                   	push   %ebx
+  printf(out, "scstat test\n");
+    3f04:	bb 64 00 00 00       	mov    $0x64,%ebx
+{
+    3f09:	83 ec 0c             	sub    $0xc,%esp
+  printf(out, "scstat test\n");
+    3f0c:	68 b1 74 00 00       	push   $0x74b1
+    3f11:	ff 35 24 92 00 00    	push   0x9224
+    3f17:	e8 d4 0f 00 00       	call   4ef0 <printf>
+    3f1c:	83 c4 10             	add    $0x10,%esp
+    3f1f:	90                   	nop
+    getpid();
+    3f20:	e8 40 0c 00 00       	call   4b65 <getpid>
+  for(i = 0; i < 100; i++)
+    3f25:	83 eb 01             	sub    $0x1,%ebx
+    3f28:	75 f6                	jne    3f20 <scstattest+0x20>
+  if(scstat(getpid(), mine, NSCSTAT) != NSCSTAT || scstat(0, all, NSCSTAT) != NSCSTAT ||
+    3f2a:	e8 36 0c 00 00       	call   4b65 <getpid>
+    3f2f:	83 ec 04             	sub    $0x4,%esp
+    3f32:	6a 30                	push   $0x30
+    3f34:	68 e0 dd 00 00       	push   $0xdde0
+    3f39:	50                   	push   %eax
+    3f3a:	e8 43 0d 00 00       	call   4c82 <scstat>
+    3f3f:	83 c4 10             	add    $0x10,%esp
+    3f42:	83 f8 30             	cmp    $0x30,%eax
+    3f45:	75 68                	jne    3faf <scstattest+0xaf>
+    3f47:	83 ec 04             	sub    $0x4,%esp
+    3f4a:	6a 30                	push   $0x30
+    3f4c:	68 e0 da 00 00       	push   $0xdae0
+    3f51:	6a 00                	push   $0x0
+    3f53:	e8 2a 0d 00 00       	call   4c82 <scstat>
+    3f58:	83 c4 10             	add    $0x10,%esp
+    3f5b:	83 f8 30             	cmp    $0x30,%eax
+    3f5e:	75 4f                	jne    3faf <scstattest+0xaf>
+     mine[SYS_getpid].count < 100 || all[SYS_getpid].count < mine[SYS_getpid].count ||
+    3f60:	a1 90 de 00 00       	mov    0xde90,%eax
+  if(scstat(getpid(), mine, NSCSTAT) != NSCSTAT || scstat(0, all, NSCSTAT) != NSCSTAT ||
+    3f65:	83 f8 63             	cmp    $0x63,%eax
+    3f68:	76 45                	jbe    3faf <scstattest+0xaf>
+     mine[SYS_getpid].count < 100 || all[SYS_getpid].count < mine[SYS_getpid].count ||
+    3f6a:	39 05 90 db 00 00    	cmp    %eax,0xdb90
+    3f70:	72 3d                	jb     3faf <scstattest+0xaf>
+    3f72:	a1 9c de 00 00       	mov    0xde9c,%eax
+    3f77:	85 c0                	test   %eax,%eax
+    3f79:	74 34                	je     3faf <scstattest+0xaf>
+     mine[SYS_getpid].max == 0 || scstat(-1, mine, NSCSTAT) != -1){
+    3f7b:	83 ec 04             	sub    $0x4,%esp
+    3f7e:	6a 30                	push   $0x30
+    3f80:	68 e0 dd 00 00       	push   $0xdde0
+    3f85:	6a ff                	push   $0xffffffff
+    3f87:	e8 f6 0c 00 00       	call   4c82 <scstat>
+    3f8c:	83 c4 10             	add    $0x10,%esp
+    3f8f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3f92:	75 1b                	jne    3faf <scstattest+0xaf>
+  printf(out, "scstat test ok\n");
+    3f94:	83 ec 08             	sub    $0x8,%esp
+    3f97:	68 d2 74 00 00       	push   $0x74d2
+    3f9c:	ff 35 24 92 00 00    	push   0x9224
+    3fa2:	e8 49 0f 00 00       	call   4ef0 <printf>
+}
+    3fa7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3faa:	83 c4 10             	add    $0x10,%esp
+    3fad:	c9                   	leave
+    3fae:	c3                   	ret
+    printf(out, "scstat test failed\n");
+    3faf:	83 ec 08             	sub    $0x8,%esp
+    3fb2:	68 be 74 00 00       	push   $0x74be
+    3fb7:	ff 35 24 92 00 00    	push   0x9224
+    3fbd:	e8 2e 0f 00 00       	call   4ef0 <printf>
+    exit();
+    3fc2:	e8 69 07 00 00       	call   4730 <exit>
+    3fc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3fce:	66 90                	xchg   %ax,%ax
+
+00003fd0 <fputest>:
+{
+    3fd0:	55                   	push   %ebp
+    3fd1:	89 e5                	mov    %esp,%ebp
+    3fd3:	56                   	push   %esi
+    3fd4:	53                   	push   %ebx
+    3fd5:	83 ec 38             	sub    $0x38,%esp
+  printf(out, "fpu test\n");
+    3fd8:	68 e2 74 00 00       	push   $0x74e2
+    3fdd:	ff 35 24 92 00 00    	push   0x9224
+    3fe3:	e8 08 0f 00 00       	call   4ef0 <printf>
+  if(pipe(fds) < 0){
+    3fe8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    3feb:	89 04 24             	mov    %eax,(%esp)
+    3fee:	e8 a0 0a 00 00       	call   4a93 <pipe>
+    3ff3:	83 c4 10             	add    $0x10,%esp
+    3ff6:	85 c0                	test   %eax,%eax
+    3ff8:	0f 88 c3 01 00 00    	js     41c1 <fputest+0x1f1>
+  for(i = 0; i < 4; i++){
+    3ffe:	31 db                	xor    %ebx,%ebx
+  x = seed;
+    4000:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    4003:	db 45 d0             	fildl  -0x30(%ebp)
+    x = x * 0.999 + seed * 0.5;
+    4006:	b8 40 0d 03 00       	mov    $0x30d40,%eax
+    400b:	d9 c0                	fld    %st(0)
+    400d:	d8 0d f4 7f 00 00    	fmuls  0x7ff4
+  x = seed;
+    4013:	d9 c1                	fld    %st(1)
+    x = x * 0.999 + seed * 0.5;
+    4015:	dd 05 f8 7f 00 00    	fldl   0x7ff8
+    401b:	eb 05                	jmp    4022 <fputest+0x52>
+    401d:	8d 76 00             	lea    0x0(%esi),%esi
+    4020:	d9 c9                	fxch   %st(1)
+    4022:	dc c9                	fmul   %st,%st(1)
+    4024:	d9 c9                	fxch   %st(1)
+    4026:	d8 c2                	fadd   %st(2),%st
+  for(i = 0; i < 200000; i++)
+    4028:	83 e8 01             	sub    $0x1,%eax
+    402b:	75 f3                	jne    4020 <fputest+0x50>
+    402d:	dd d9                	fstp   %st(1)
+    402f:	d9 c9                	fxch   %st(1)
+    4031:	dd 5d c8             	fstpl  -0x38(%ebp)
+    4034:	d9 c9                	fxch   %st(1)
+    4036:	dd 5d d0             	fstpl  -0x30(%ebp)
+    want = fpwork(i);
+    4039:	dd 5d e0             	fstpl  -0x20(%ebp)
+    if((pid = fork()) < 0){
+    403c:	e8 8f 06 00 00       	call   46d0 <fork>
+    4041:	dd 45 d0             	fldl   -0x30(%ebp)
+    4044:	dd 45 c8             	fldl   -0x38(%ebp)
+    4047:	85 c0                	test   %eax,%eax
+    4049:	0f 88 56 01 00 00    	js     41a5 <fputest+0x1d5>
+    if(pid == 0){
+    404f:	0f 84 b4 00 00 00    	je     4109 <fputest+0x139>
+    4055:	dd d8                	fstp   %st(0)
+    4057:	dd d8                	fstp   %st(0)
+  for(i = 0; i < 4; i++){
+    4059:	83 c3 01             	add    $0x1,%ebx
+    405c:	83 fb 04             	cmp    $0x4,%ebx
+    405f:	75 9f                	jne    4000 <fputest+0x30>
+  close(fds[1]);
+    4061:	83 ec 0c             	sub    $0xc,%esp
+    4064:	ff 75 f4             	push   -0xc(%ebp)
+  for(n = 0; n < 4 && read(fds[0], &c, 1) == 1 && c; n++)
+    4067:	31 db                	xor    %ebx,%ebx
+    4069:	8d 75 df             	lea    -0x21(%ebp),%esi
+  close(fds[1]);
+    406c:	e8 4f 0a 00 00       	call   4ac0 <close>
+    4071:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < 4 && read(fds[0], &c, 1) == 1 && c; n++)
+    4074:	83 ec 04             	sub    $0x4,%esp
+    4077:	6a 01                	push   $0x1
+    4079:	56                   	push   %esi
+    407a:	ff 75 f0             	push   -0x10(%ebp)
+    407d:	e8 20 0a 00 00       	call   4aa2 <read>
+    4082:	83 c4 10             	add    $0x10,%esp
+    4085:	83 f8 01             	cmp    $0x1,%eax
+    4088:	75 49                	jne    40d3 <fputest+0x103>
+    408a:	80 7d df 00          	cmpb   $0x0,-0x21(%ebp)
+    408e:	74 43                	je     40d3 <fputest+0x103>
+    4090:	83 c3 01             	add    $0x1,%ebx
+    4093:	83 fb 04             	cmp    $0x4,%ebx
+    4096:	75 dc                	jne    4074 <fputest+0xa4>
+  close(fds[0]);
+    4098:	83 ec 0c             	sub    $0xc,%esp
+    409b:	ff 75 f0             	push   -0x10(%ebp)
+    409e:	e8 1d 0a 00 00       	call   4ac0 <close>
+    wait();
+    40a3:	e8 dc 09 00 00       	call   4a84 <wait>
+    40a8:	e8 d7 09 00 00       	call   4a84 <wait>
+    40ad:	e8 d2 09 00 00       	call   4a84 <wait>
+    40b2:	e8 cd 09 00 00       	call   4a84 <wait>
+  printf(out, "fpu test ok\n");
+    40b7:	58                   	pop    %eax
+    40b8:	5a                   	pop    %edx
+    40b9:	68 32 75 00 00       	push   $0x7532
+    40be:	ff 35 24 92 00 00    	push   0x9224
+    40c4:	e8 27 0e 00 00       	call   4ef0 <printf>
+}
+    40c9:	83 c4 10             	add    $0x10,%esp
+    40cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    40cf:	5b                   	pop    %ebx
+    40d0:	5e                   	pop    %esi
+    40d1:	5d                   	pop    %ebp
+    40d2:	c3                   	ret
+  close(fds[0]);
+    40d3:	83 ec 0c             	sub    $0xc,%esp
+    40d6:	ff 75 f0             	push   -0x10(%ebp)
+    40d9:	e8 e2 09 00 00       	call   4ac0 <close>
+    wait();
+    40de:	e8 a1 09 00 00       	call   4a84 <wait>
+    40e3:	e8 9c 09 00 00       	call   4a84 <wait>
+    40e8:	e8 97 09 00 00       	call   4a84 <wait>
+    40ed:	e8 92 09 00 00       	call   4a84 <wait>
+    printf(out, "fpu test: wrong result\n");
+    40f2:	59                   	pop    %ecx
+    40f3:	5b                   	pop    %ebx
+    40f4:	68 1a 75 00 00       	push   $0x751a
+    40f9:	ff 35 24 92 00 00    	push   0x9224
+    40ff:	e8 ec 0d 00 00       	call   4ef0 <printf>
+    exit();
+    4104:	e8 27 06 00 00       	call   4730 <exit>
+  x = seed;
+    4109:	d9 c1                	fld    %st(1)
+    410b:	ba 40 0d 03 00       	mov    $0x30d40,%edx
+    x = x * 0.999 + seed * 0.5;
+    4110:	dc 0d f8 7f 00 00    	fmull  0x7ff8
+    4116:	d8 c1                	fadd   %st(1),%st
+  for(i = 0; i < 200000; i++)
+    4118:	83 ea 01             	sub    $0x1,%edx
+    411b:	75 f3                	jne    4110 <fputest+0x140>
+      c = want == fpwork(i);
+    411d:	dd 45 e0             	fldl   -0x20(%ebp)
+    4120:	b9 00 00 00 00       	mov    $0x0,%ecx
+    4125:	df e9                	fucomip %st(1),%st
+    4127:	dd d8                	fstp   %st(0)
+    4129:	0f 9b c2             	setnp  %dl
+    412c:	0f 45 d1             	cmovne %ecx,%edx
+    412f:	88 55 df             	mov    %dl,-0x21(%ebp)
+      for(j = 0; j < 20 && c; j++){
+    4132:	7a 51                	jp     4185 <fputest+0x1b5>
+    4134:	75 55                	jne    418b <fputest+0x1bb>
+  x = seed;
+    4136:	d9 c1                	fld    %st(1)
+    x = x * 0.999 + seed * 0.5;
+    4138:	dd 05 f8 7f 00 00    	fldl   0x7ff8
+  x = seed;
+    413e:	ba 40 0d 03 00       	mov    $0x30d40,%edx
+    4143:	eb 05                	jmp    414a <fputest+0x17a>
+    4145:	8d 76 00             	lea    0x0(%esi),%esi
+    4148:	d9 c9                	fxch   %st(1)
+    x = x * 0.999 + seed * 0.5;
+    414a:	dc c9                	fmul   %st,%st(1)
+    414c:	d9 c9                	fxch   %st(1)
+    414e:	d8 c2                	fadd   %st(2),%st
+  for(i = 0; i < 200000; i++)
+    4150:	83 ea 01             	sub    $0x1,%edx
+    4153:	75 f3                	jne    4148 <fputest+0x178>
+    4155:	dd d9                	fstp   %st(1)
+        got = fpwork(i);
+    4157:	dd 5d e8             	fstpl  -0x18(%ebp)
+        c = got == want;
+    415a:	dd 45 e8             	fldl   -0x18(%ebp)
+    415d:	dd 45 e0             	fldl   -0x20(%ebp)
+    4160:	df e9                	fucomip %st(1),%st
+    4162:	dd d8                	fstp   %st(0)
+    4164:	0f 9b c2             	setnp  %dl
+    4167:	0f 45 d1             	cmovne %ecx,%edx
+      for(j = 0; j < 20 && c; j++){
+    416a:	83 c0 01             	add    $0x1,%eax
+    416d:	83 f8 13             	cmp    $0x13,%eax
+    4170:	7f 0a                	jg     417c <fputest+0x1ac>
+    4172:	84 d2                	test   %dl,%dl
+    4174:	75 c0                	jne    4136 <fputest+0x166>
+    4176:	dd d8                	fstp   %st(0)
+    4178:	dd d8                	fstp   %st(0)
+    417a:	eb 04                	jmp    4180 <fputest+0x1b0>
+    417c:	dd d8                	fstp   %st(0)
+    417e:	dd d8                	fstp   %st(0)
+    4180:	88 55 df             	mov    %dl,-0x21(%ebp)
+    4183:	eb 0a                	jmp    418f <fputest+0x1bf>
+    4185:	dd d8                	fstp   %st(0)
+    4187:	dd d8                	fstp   %st(0)
+    4189:	eb 04                	jmp    418f <fputest+0x1bf>
+    418b:	dd d8                	fstp   %st(0)
+    418d:	dd d8                	fstp   %st(0)
+      write(fds[1], &c, 1);
+    418f:	83 ec 04             	sub    $0x4,%esp
+    4192:	8d 45 df             	lea    -0x21(%ebp),%eax
+    4195:	6a 01                	push   $0x1
+    4197:	50                   	push   %eax
+    4198:	ff 75 f4             	push   -0xc(%ebp)
+    419b:	e8 11 09 00 00       	call   4ab1 <write>
+      exit();
+    41a0:	e8 8b 05 00 00       	call   4730 <exit>
+    41a5:	dd d8                	fstp   %st(0)
+    41a7:	dd d8                	fstp   %st(0)
+      printf(out, "fpu test: fork failed\n");
+    41a9:	83 ec 08             	sub    $0x8,%esp
+    41ac:	68 03 75 00 00       	push   $0x7503
+    41b1:	ff 35 24 92 00 00    	push   0x9224
+    41b7:	e8 34 0d 00 00       	call   4ef0 <printf>
+      exit();
+    41bc:	e8 6f 05 00 00       	call   4730 <exit>
+    printf(out, "fpu test: pipe failed\n");
+    41c1:	56                   	push   %esi
+    41c2:	56                   	push   %esi
+    41c3:	68 ec 74 00 00       	push   $0x74ec
+    41c8:	ff 35 24 92 00 00    	push   0x9224
+    41ce:	e8 1d 0d 00 00       	call   4ef0 <printf>
+    exit();
+    41d3:	e8 58 05 00 00       	call   4730 <exit>
+    41d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    41df:	90                   	nop
+
+000041e0 <validatetest>:
+{
+    41e0:	55                   	push   %ebp
+    41e1:	89 e5                	mov    %esp,%ebp
+    41e3:	56                   	push   %esi
+  for(p = 0; p <= (uint)hi; p += 4096){
+    41e4:	31 f6                	xor    %esi,%esi
+{
+    41e6:	53                   	push   %ebx
+  printf(out, "validate test\n");
+    41e7:	83 ec 08             	sub    $0x8,%esp
+    41ea:	68 3f 75 00 00       	push   $0x753f
+    41ef:	ff 35 24 92 00 00    	push   0x9224
+    41f5:	e8 f6 0c 00 00       	call   4ef0 <printf>
+    41fa:	83 c4 10             	add    $0x10,%esp
+    41fd:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) == 0){
+    4200:	e8 cb 04 00 00       	call   46d0 <fork>
+    4205:	89 c3                	mov    %eax,%ebx
+    4207:	85 c0                	test   %eax,%eax
+    4209:	74 63                	je     426e <validatetest+0x8e>
+    sleep(0);
+    420b:	83 ec 0c             	sub    $0xc,%esp
+    420e:	6a 00                	push   $0x0
+    4210:	e8 6e 09 00 00       	call   4b83 <sleep>
+    sleep(0);
+    4215:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    421c:	e8 62 09 00 00       	call   4b83 <sleep>
+    kill(pid);
+    4221:	89 1c 24             	mov    %ebx,(%esp)
+    4224:	e8 a6 08 00 00       	call   4acf <kill>
+    wait();
+    4229:	e8 56 08 00 00       	call   4a84 <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    422e:	58                   	pop    %eax
+    422f:	5a                   	pop    %edx
+    4230:	56                   	push   %esi
+    4231:	68 4e 75 00 00       	push   $0x754e
+    4236:	e8 ee 08 00 00       	call   4b29 <link>
+    423b:	83 c4 10             	add    $0x10,%esp
+    423e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4241:	75 30                	jne    4273 <validatetest+0x93>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    4243:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    4249:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    424f:	75 af                	jne    4200 <validatetest+0x20>
+  printf(out, "validate ok\n");
+    4251:	83 ec 08             	sub    $0x8,%esp
+    4254:	68 72 75 00 00       	push   $0x7572
+    4259:	ff 35 24 92 00 00    	push   0x9224
+    425f:	e8 8c 0c 00 00       	call   4ef0 <printf>
+}
+    4264:	83 c4 10             	add    $0x10,%esp
+    4267:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    426a:	5b                   	pop    %ebx
+    426b:	5e                   	pop    %esi
+    426c:	5d                   	pop    %ebp
+    426d:	c3                   	ret
+      exit();
+    426e:	e8 bd 04 00 00       	call   4730 <exit>
+      printf(out, "link should not succeed\n");
+    4273:	83 ec 08             	sub    $0x8,%esp
+    4276:	68 59 75 00 00       	push   $0x7559
+    427b:	ff 35 24 92 00 00    	push   0x9224
+    4281:	e8 6a 0c 00 00       	call   4ef0 <printf>
+      exit();
+    4286:	e8 a5 04 00 00       	call   4730 <exit>
+    428b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    428f:	90                   	nop
+
+00004290 <bsstest>:
+{
+    4290:	55                   	push   %ebp
+    4291:	89 e5                	mov    %esp,%ebp
+    4293:	83 ec 10             	sub    $0x10,%esp
+  printf(out, "bss test\n");
+    4296:	68 7f 75 00 00       	push   $0x757f
+    429b:	ff 35 24 92 00 00    	push   0x9224
+    42a1:	e8 4a 0c 00 00       	call   4ef0 <printf>
+    42a6:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    42a9:	31 c0                	xor    %eax,%eax
+    42ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    42af:	90                   	nop
+    if(uninit[i] != '\0'){
+    42b0:	80 b8 20 93 00 00 00 	cmpb   $0x0,0x9320(%eax)
+    42b7:	75 22                	jne    42db <bsstest+0x4b>
+  for(i = 0; i < sizeof(uninit); i++){
+    42b9:	83 c0 01             	add    $0x1,%eax
+    42bc:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    42c1:	75 ed                	jne    42b0 <bsstest+0x20>
+  printf(out, "bss test ok\n");
+    42c3:	83 ec 08             	sub    $0x8,%esp
+    42c6:	68 9a 75 00 00       	push   $0x759a
+    42cb:	ff 35 24 92 00 00    	push   0x9224
+    42d1:	e8 1a 0c 00 00       	call   4ef0 <printf>
+}
+    42d6:	83 c4 10             	add    $0x10,%esp
+    42d9:	c9                   	leave
+    42da:	c3                   	ret
+      printf(out, "bss test failed\n");
+    42db:	83 ec 08             	sub    $0x8,%esp
+    42de:	68 89 75 00 00       	push   $0x7589
+    42e3:	ff 35 24 92 00 00    	push   0x9224
+    42e9:	e8 02 0c 00 00       	call   4ef0 <printf>
+      exit();
+    42ee:	e8 3d 04 00 00       	call   4730 <exit>
+    42f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    42fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00004300 <bigargtest>:
+{
+    4300:	55                   	push   %ebp
+    4301:	89 e5                	mov    %esp,%ebp
+    4303:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    4306:	68 a7 75 00 00       	push   $0x75a7
+    430b:	e8 fb 07 00 00       	call   4b0b <unlink>
+  pid = fork();
+    4310:	e8 bb 03 00 00       	call   46d0 <fork>
+  if(pid == 0){
+    4315:	83 c4 10             	add    $0x10,%esp
+    4318:	85 c0                	test   %eax,%eax
+    431a:	74 44                	je     4360 <bigargtest+0x60>
+  } else if(pid < 0){
+    431c:	0f 88 c3 00 00 00    	js     43e5 <bigargtest+0xe5>
+  wait();
+    4322:	e8 5d 07 00 00       	call   4a84 <wait>
+  fd = open("bigarg-ok", 0);
+    4327:	83 ec 08             	sub    $0x8,%esp
+    432a:	6a 00                	push   $0x0
+    432c:	68 a7 75 00 00       	push   $0x75a7
+    4331:	e8 b7 07 00 00       	call   4aed <open>
+  if(fd < 0){
+    4336:	83 c4 10             	add    $0x10,%esp
+    4339:	85 c0                	test   %eax,%eax
+    433b:	0f 88 8d 00 00 00    	js     43ce <bigargtest+0xce>
+  close(fd);
+    4341:	83 ec 0c             	sub    $0xc,%esp
+    4344:	50                   	push   %eax
+    4345:	e8 76 07 00 00       	call   4ac0 <close>
+  unlink("bigarg-ok");
+    434a:	c7 04 24 a7 75 00 00 	movl   $0x75a7,(%esp)
+    4351:	e8 b5 07 00 00       	call   4b0b <unlink>
+}
+    4356:	83 c4 10             	add    $0x10,%esp
+    4359:	c9                   	leave
+    435a:	c3                   	ret
+    435b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    435f:	90                   	nop
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    4360:	c7 04 85 60 da 00 00 	movl   $0x7ec4,0xda60(,%eax,4)
+    4367:	c4 7e 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    436b:	83 c0 01             	add    $0x1,%eax
+    436e:	83 f8 1f             	cmp    $0x1f,%eax
+    4371:	75 ed                	jne    4360 <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    4373:	31 c9                	xor    %ecx,%ecx
+    4375:	89 0d dc da 00 00    	mov    %ecx,0xdadc
+    printf(out, "bigarg test\n");
+    437b:	50                   	push   %eax
+    437c:	50                   	push   %eax
+    437d:	68 b1 75 00 00       	push   $0x75b1
+    4382:	ff 35 24 92 00 00    	push   0x9224
+    4388:	e8 63 0b 00 00       	call   4ef0 <printf>
+    exec("echo", args);
+    438d:	58                   	pop    %eax
+    438e:	5a                   	pop    %edx
+    438f:	68 60 da 00 00       	push   $0xda60
+    4394:	68 5d 64 00 00       	push   $0x645d
+    4399:	e8 62 03 00 00       	call   4700 <exec>
+    printf(out, "bigarg test ok\n");
+    439e:	59                   	pop    %ecx
+    439f:	58                   	pop    %eax
+    43a0:	68 be 75 00 00       	push   $0x75be
+    43a5:	ff 35 24 92 00 00    	push   0x9224
+    43ab:	e8 40 0b 00 00       	call   4ef0 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    43b0:	58                   	pop    %eax
+    43b1:	5a                   	pop    %edx
+    43b2:	68 00 02 00 00       	push   $0x200
+    43b7:	68 a7 75 00 00       	push   $0x75a7
+    43bc:	e8 2c 07 00 00       	call   4aed <open>
+    close(fd);
+    43c1:	89 04 24             	mov    %eax,(%esp)
+    43c4:	e8 f7 06 00 00       	call   4ac0 <close>
+    exit();
+    43c9:	e8 62 03 00 00       	call   4730 <exit>
+    printf(out, "bigarg test failed!\n");
+    43ce:	50                   	push   %eax
+    43cf:	50                   	push   %eax
+    43d0:	68 e7 75 00 00       	push   $0x75e7
+    43d5:	ff 35 24 92 00 00    	push   0x9224
+    43db:	e8 10 0b 00 00       	call   4ef0 <printf>
+    exit();
+    43e0:	e8 4b 03 00 00       	call   4730 <exit>
+    printf(out, "bigargtest: fork failed\n");
+    43e5:	52                   	push   %edx
+    43e6:	52                   	push   %edx
+    43e7:	68 ce 75 00 00       	push   $0x75ce
+    43ec:	ff 35 24 92 00 00    	push   0x9224
+    43f2:	e8 f9 0a 00 00       	call   4ef0 <printf>
+    exit();
+    43f7:	e8 34 03 00 00       	call   4730 <exit>
+    43fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004400 <fsfull>:
+{
+    4400:	55                   	push   %ebp
+    4401:	89 e5                	mov    %esp,%ebp
+    4403:	57                   	push   %edi
+    4404:	56                   	push   %esi
+  for(nfiles = 0; ; nfiles++){
+    4405:	31 f6                	xor    %esi,%esi
+{
+    4407:	53                   	push   %ebx
+    4408:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    440b:	68 fc 75 00 00       	push   $0x75fc
+    4410:	6a 01                	push   $0x1
+    4412:	e8 d9 0a 00 00       	call   4ef0 <printf>
+    4417:	83 c4 10             	add    $0x10,%esp
+    441a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    4420:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    4425:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    printf(1, "writing %s\n", name);
+    442a:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    442d:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4431:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    4433:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4437:	c1 ea 06             	shr    $0x6,%edx
+    443a:	8d 42 30             	lea    0x30(%edx),%eax
+    443d:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4440:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    4446:	89 f2                	mov    %esi,%edx
+    4448:	29 c2                	sub    %eax,%edx
+    444a:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    444f:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    4451:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4456:	c1 ea 05             	shr    $0x5,%edx
+    4459:	83 c2 30             	add    $0x30,%edx
+    445c:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    445f:	f7 e6                	mul    %esi
+    4461:	c1 ea 05             	shr    $0x5,%edx
+    4464:	6b c2 64             	imul   $0x64,%edx,%eax
+    4467:	89 f2                	mov    %esi,%edx
+    4469:	29 c2                	sub    %eax,%edx
+    446b:	89 d0                	mov    %edx,%eax
+    446d:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    446f:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    4471:	c1 ea 03             	shr    $0x3,%edx
+    4474:	83 c2 30             	add    $0x30,%edx
+    4477:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    447a:	f7 e1                	mul    %ecx
+    447c:	89 f0                	mov    %esi,%eax
+    447e:	c1 ea 03             	shr    $0x3,%edx
+    4481:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    4484:	01 d2                	add    %edx,%edx
+    4486:	29 d0                	sub    %edx,%eax
+    4488:	83 c0 30             	add    $0x30,%eax
+    448b:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    448e:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    4491:	50                   	push   %eax
+    4492:	68 09 76 00 00       	push   $0x7609
+    4497:	6a 01                	push   $0x1
+    4499:	e8 52 0a 00 00       	call   4ef0 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    449e:	58                   	pop    %eax
+    449f:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    44a2:	5a                   	pop    %edx
+    44a3:	68 02 02 00 00       	push   $0x202
+    44a8:	50                   	push   %eax
+    44a9:	e8 3f 06 00 00       	call   4aed <open>
+    if(fd < 0){
+    44ae:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    44b1:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    44b3:	85 c0                	test   %eax,%eax
+    44b5:	78 4f                	js     4506 <fsfull+0x106>
+    int total = 0;
+    44b7:	31 db                	xor    %ebx,%ebx
+    44b9:	eb 07                	jmp    44c2 <fsfull+0xc2>
+    44bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    44bf:	90                   	nop
+      total += cc;
+    44c0:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    44c2:	83 ec 04             	sub    $0x4,%esp
+    44c5:	68 00 02 00 00       	push   $0x200
+    44ca:	68 60 ba 00 00       	push   $0xba60
+    44cf:	57                   	push   %edi
+    44d0:	e8 dc 05 00 00       	call   4ab1 <write>
+      if(cc < 512)
+    44d5:	83 c4 10             	add    $0x10,%esp
+    44d8:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    44dd:	7f e1                	jg     44c0 <fsfull+0xc0>
+    printf(1, "wrote %d bytes\n", total);
+    44df:	83 ec 04             	sub    $0x4,%esp
+    44e2:	53                   	push   %ebx
+    44e3:	68 25 76 00 00       	push   $0x7625
+    44e8:	6a 01                	push   $0x1
+    44ea:	e8 01 0a 00 00       	call   4ef0 <printf>
+    close(fd);
+    44ef:	89 3c 24             	mov    %edi,(%esp)
+    44f2:	e8 c9 05 00 00       	call   4ac0 <close>
+    if(total == 0)
+    44f7:	83 c4 10             	add    $0x10,%esp
+    44fa:	85 db                	test   %ebx,%ebx
+    44fc:	74 1e                	je     451c <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    44fe:	83 c6 01             	add    $0x1,%esi
+    4501:	e9 1a ff ff ff       	jmp    4420 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    4506:	83 ec 04             	sub    $0x4,%esp
+    4509:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    450c:	50                   	push   %eax
+    450d:	68 15 76 00 00       	push   $0x7615
+    4512:	6a 01                	push   $0x1
+    4514:	e8 d7 09 00 00       	call   4ef0 <printf>
+      break;
+    4519:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + nfiles / 1000;
+    451c:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4521:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    4526:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    452d:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    4530:	89 f0                	mov    %esi,%eax
+    unlink(name);
+    4532:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    4535:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4539:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    453b:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    453f:	c1 ea 06             	shr    $0x6,%edx
+    4542:	8d 42 30             	lea    0x30(%edx),%eax
+    4545:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4548:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    454e:	89 f2                	mov    %esi,%edx
+    4550:	29 c2                	sub    %eax,%edx
+    4552:	89 d0                	mov    %edx,%eax
+    4554:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    4556:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4558:	c1 ea 05             	shr    $0x5,%edx
+    455b:	83 c2 30             	add    $0x30,%edx
+    455e:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    4561:	f7 e3                	mul    %ebx
+    4563:	c1 ea 05             	shr    $0x5,%edx
+    4566:	6b ca 64             	imul   $0x64,%edx,%ecx
+    4569:	89 f2                	mov    %esi,%edx
+    456b:	29 ca                	sub    %ecx,%edx
+    456d:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    4572:	89 d0                	mov    %edx,%eax
+    4574:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    4576:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    4578:	c1 ea 03             	shr    $0x3,%edx
+    457b:	83 c2 30             	add    $0x30,%edx
+    457e:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    4581:	f7 e1                	mul    %ecx
+    4583:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    4585:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    4588:	c1 ea 03             	shr    $0x3,%edx
+    458b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    458e:	01 d2                	add    %edx,%edx
+    4590:	29 d0                	sub    %edx,%eax
+    4592:	83 c0 30             	add    $0x30,%eax
+    4595:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    4598:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    459b:	50                   	push   %eax
+    459c:	e8 6a 05 00 00       	call   4b0b <unlink>
+  while(nfiles >= 0){
+    45a1:	83 c4 10             	add    $0x10,%esp
+    45a4:	83 fe ff             	cmp    $0xffffffff,%esi
+    45a7:	75 87                	jne    4530 <fsfull+0x130>
+  printf(1, "fsfull test finished\n");
+    45a9:	83 ec 08             	sub    $0x8,%esp
+    45ac:	68 35 76 00 00       	push   $0x7635
+    45b1:	6a 01                	push   $0x1
+    45b3:	e8 38 09 00 00       	call   4ef0 <printf>
+}
+    45b8:	83 c4 10             	add    $0x10,%esp
+    45bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    45be:	5b                   	pop    %ebx
+    45bf:	5e                   	pop    %esi
+    45c0:	5f                   	pop    %edi
+    45c1:	5d                   	pop    %ebp
+    45c2:	c3                   	ret
+    45c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    45ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000045d0 <uio>:
+{
+    45d0:	55                   	push   %ebp
+    45d1:	89 e5                	mov    %esp,%ebp
+    45d3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "uio test\n");
+    45d6:	68 ca 73 00 00       	push   $0x73ca
+    45db:	6a 01                	push   $0x1
+    45dd:	e8 0e 09 00 00       	call   4ef0 <printf>
+  pid = fork();
+    45e2:	e8 e9 00 00 00       	call   46d0 <fork>
+  if(pid == 0){
+    45e7:	83 c4 10             	add    $0x10,%esp
+    45ea:	85 c0                	test   %eax,%eax
+    45ec:	74 1b                	je     4609 <uio+0x39>
+  } else if(pid < 0){
+    45ee:	78 3d                	js     462d <uio+0x5d>
+  wait();
+    45f0:	e8 8f 04 00 00       	call   4a84 <wait>
+  printf(1, "uio test done\n");
+    45f5:	83 ec 08             	sub    $0x8,%esp
+    45f8:	68 4b 76 00 00       	push   $0x764b
+    45fd:	6a 01                	push   $0x1
+    45ff:	e8 ec 08 00 00       	call   4ef0 <printf>
+}
+    4604:	83 c4 10             	add    $0x10,%esp
+    4607:	c9                   	leave
+    4608:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    4609:	b8 09 00 00 00       	mov    $0x9,%eax
+    460e:	ba 70 00 00 00       	mov    $0x70,%edx
+    4613:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    4614:	ba 71 00 00 00       	mov    $0x71,%edx
+    4619:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    461a:	52                   	push   %edx
+    461b:	52                   	push   %edx
+    461c:	68 a4 7f 00 00       	push   $0x7fa4
+    4621:	6a 01                	push   $0x1
+    4623:	e8 c8 08 00 00       	call   4ef0 <printf>
+    exit();
+    4628:	e8 03 01 00 00       	call   4730 <exit>
+    printf (1, "fork failed\n");
+    462d:	50                   	push   %eax
+    462e:	50                   	push   %eax
+    462f:	68 2e 72 00 00       	push   $0x722e
+    4634:	6a 01                	push   $0x1
+    4636:	e8 b5 08 00 00       	call   4ef0 <printf>
+    exit();
+    463b:	e8 f0 00 00 00       	call   4730 <exit>
+
+00004640 <argptest>:
+{
+    4640:	55                   	push   %ebp
+    4641:	89 e5                	mov    %esp,%ebp
+    4643:	53                   	push   %ebx
+    4644:	83 ec 0c             	sub    $0xc,%esp
+  fd = open("init", O_RDONLY);
+    4647:	6a 00                	push   $0x0
+    4649:	68 5a 76 00 00       	push   $0x765a
+    464e:	e8 9a 04 00 00       	call   4aed <open>
+  if (fd < 0) {
+    4653:	83 c4 10             	add    $0x10,%esp
+    4656:	85 c0                	test   %eax,%eax
+    4658:	78 39                	js     4693 <argptest+0x53>
+  read(fd, sbrk(0) - 1, -1);
+    465a:	83 ec 0c             	sub    $0xc,%esp
+    465d:	89 c3                	mov    %eax,%ebx
+    465f:	6a 00                	push   $0x0
+    4661:	e8 0e 05 00 00       	call   4b74 <sbrk>
+    4666:	83 c4 0c             	add    $0xc,%esp
+    4669:	83 e8 01             	sub    $0x1,%eax
+    466c:	6a ff                	push   $0xffffffff
+    466e:	50                   	push   %eax
+    466f:	53                   	push   %ebx
+    4670:	e8 2d 04 00 00       	call   4aa2 <read>
+  close(fd);
+    4675:	89 1c 24             	mov    %ebx,(%esp)
+    4678:	e8 43 04 00 00       	call   4ac0 <close>
+  printf(1, "arg test passed\n");
+    467d:	58                   	pop    %eax
+    467e:	5a                   	pop    %edx
+    467f:	68 6c 76 00 00       	push   $0x766c
+    4684:	6a 01                	push   $0x1
+    4686:	e8 65 08 00 00       	call   4ef0 <printf>
+}
+    468b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    468e:	83 c4 10             	add    $0x10,%esp
+    4691:	c9                   	leave
+    4692:	c3                   	ret
+    printf(2, "open failed\n");
+    4693:	51                   	push   %ecx
+    4694:	51                   	push   %ecx
+    4695:	68 5f 76 00 00       	push   $0x765f
+    469a:	6a 02                	push   $0x2
+    469c:	e8 4f 08 00 00       	call   4ef0 <printf>
+    exit();
+    46a1:	e8 8a 00 00 00       	call   4730 <exit>
+    46a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    46ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000046b0 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    46b0:	69 05 20 92 00 00 0d 	imul   $0x19660d,0x9220,%eax
+    46b7:	66 19 00 
+    46ba:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    46bf:	a3 20 92 00 00       	mov    %eax,0x9220
+}
+    46c4:	c3                   	ret
+    46c5:	66 90                	xchg   %ax,%ax
+    46c7:	66 90                	xchg   %ax,%ax
+    46c9:	66 90                	xchg   %ax,%ax
+    46cb:	66 90                	xchg   %ax,%ax
+    46cd:	66 90                	xchg   %ax,%ax
+    46cf:	90                   	nop
+
+000046d0 <fork>:
+int sysexit(void) __attribute__((noreturn));
+
+int
+fork(void)
+{
+  if(flushhook)
+    46d0:	a1 f0 e2 00 00       	mov    0xe2f0,%eax
+    46d5:	85 c0                	test   %eax,%eax
+    46d7:	74 17                	je     46f0 <fork+0x20>
+{
+    46d9:	55                   	push   %ebp
+    46da:	89 e5                	mov    %esp,%ebp
+    46dc:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+    46df:	ff d0                	call   *%eax
+  return sysfork();
+}
+    46e1:	c9                   	leave
+  return sysfork();
+    46e2:	e9 7f 03 00 00       	jmp    4a66 <sysfork>
+    46e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    46ee:	66 90                	xchg   %ax,%ax
+    46f0:	e9 71 03 00 00       	jmp    4a66 <sysfork>
+    46f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    46fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004700 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+    4700:	55                   	push   %ebp
+  if(flushhook)
+    4701:	a1 f0 e2 00 00       	mov    0xe2f0,%eax
+{
+    4706:	89 e5                	mov    %esp,%ebp
+    4708:	56                   	push   %esi
+    4709:	53                   	push   %ebx
+    470a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    470d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+    4710:	85 c0                	test   %eax,%eax
+    4712:	74 02                	je     4716 <exec+0x16>
+    flushhook();
+    4714:	ff d0                	call   *%eax
+  return sysexec(path, argv);
+    4716:	89 75 0c             	mov    %esi,0xc(%ebp)
+    4719:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    471c:	5b                   	pop    %ebx
+    471d:	5e                   	pop    %esi
+    471e:	5d                   	pop    %ebp
+  return sysexec(path, argv);
+    471f:	e9 ba 03 00 00       	jmp    4ade <sysexec>
+    4724:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    472b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    472f:	90                   	nop
+
+00004730 <exit>:
+
+int
+exit(void)
+{
+    4730:	55                   	push   %ebp
+    4731:	89 e5                	mov    %esp,%ebp
+    4733:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+    4736:	a1 f0 e2 00 00       	mov    0xe2f0,%eax
+    473b:	85 c0                	test   %eax,%eax
+    473d:	74 02                	je     4741 <exit+0x11>
+    flushhook();
+    473f:	ff d0                	call   *%eax
+  sysexit();
+    4741:	e8 2f 03 00 00       	call   4a75 <sysexit>
+    4746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    474d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004750 <strcpy>:
+}
+
+char*
+strcpy(char *s, const char *t)
+{
+    4750:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    4751:	31 c0                	xor    %eax,%eax
+{
+    4753:	89 e5                	mov    %esp,%ebp
+    4755:	53                   	push   %ebx
+    4756:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    4759:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    475c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    4760:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    4764:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    4767:	83 c0 01             	add    $0x1,%eax
+    476a:	84 d2                	test   %dl,%dl
+    476c:	75 f2                	jne    4760 <strcpy+0x10>
+    ;
+  return os;
+}
+    476e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4771:	89 c8                	mov    %ecx,%eax
+    4773:	c9                   	leave
+    4774:	c3                   	ret
+    4775:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    477c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004780 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    4780:	55                   	push   %ebp
+    4781:	89 e5                	mov    %esp,%ebp
+    4783:	53                   	push   %ebx
+    4784:	8b 55 08             	mov    0x8(%ebp),%edx
+    4787:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    478a:	0f b6 02             	movzbl (%edx),%eax
+    478d:	84 c0                	test   %al,%al
+    478f:	75 17                	jne    47a8 <strcmp+0x28>
+    4791:	eb 3a                	jmp    47cd <strcmp+0x4d>
+    4793:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4797:	90                   	nop
+    4798:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    479c:	83 c2 01             	add    $0x1,%edx
+    479f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    47a2:	84 c0                	test   %al,%al
+    47a4:	74 1a                	je     47c0 <strcmp+0x40>
+    p++, q++;
+    47a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    47a8:	0f b6 19             	movzbl (%ecx),%ebx
+    47ab:	38 c3                	cmp    %al,%bl
+    47ad:	74 e9                	je     4798 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    47af:	29 d8                	sub    %ebx,%eax
+}
+    47b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    47b4:	c9                   	leave
+    47b5:	c3                   	ret
+    47b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    47bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    47c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    47c4:	31 c0                	xor    %eax,%eax
+    47c6:	29 d8                	sub    %ebx,%eax
+}
+    47c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    47cb:	c9                   	leave
+    47cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    47cd:	0f b6 19             	movzbl (%ecx),%ebx
+    47d0:	31 c0                	xor    %eax,%eax
+    47d2:	eb db                	jmp    47af <strcmp+0x2f>
+    47d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    47db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    47df:	90                   	nop
+
+000047e0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    47e0:	55                   	push   %ebp
+    47e1:	89 e5                	mov    %esp,%ebp
+    47e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    47e6:	80 3a 00             	cmpb   $0x0,(%edx)
+    47e9:	74 15                	je     4800 <strlen+0x20>
+    47eb:	31 c0                	xor    %eax,%eax
+    47ed:	8d 76 00             	lea    0x0(%esi),%esi
+    47f0:	83 c0 01             	add    $0x1,%eax
+    47f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    47f7:	89 c1                	mov    %eax,%ecx
+    47f9:	75 f5                	jne    47f0 <strlen+0x10>
+    ;
+  return n;
+}
+    47fb:	89 c8                	mov    %ecx,%eax
+    47fd:	5d                   	pop    %ebp
+    47fe:	c3                   	ret
+    47ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+    4800:	31 c9                	xor    %ecx,%ecx
+}
+    4802:	5d                   	pop    %ebp
+    4803:	89 c8                	mov    %ecx,%eax
+    4805:	c3                   	ret
+    4806:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    480d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004810 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    4810:	55                   	push   %ebp
+    4811:	89 e5                	mov    %esp,%ebp
+    4813:	57                   	push   %edi
+    4814:	8b 55 08             	mov    0x8(%ebp),%edx
+            "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt) {
+    asm volatile("cld; rep stosb" :
+    4817:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    481a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    481d:	89 d7                	mov    %edx,%edi
+    481f:	fc                   	cld
+    4820:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    4822:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    4825:	89 d0                	mov    %edx,%eax
+    4827:	c9                   	leave
+    4828:	c3                   	ret
+    4829:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00004830 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    4830:	55                   	push   %ebp
+    4831:	89 e5                	mov    %esp,%ebp
+    4833:	8b 45 08             	mov    0x8(%ebp),%eax
+    4836:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    483a:	0f b6 10             	movzbl (%eax),%edx
+    483d:	84 d2                	test   %dl,%dl
+    483f:	75 12                	jne    4853 <strchr+0x23>
+    4841:	eb 1d                	jmp    4860 <strchr+0x30>
+    4843:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4847:	90                   	nop
+    4848:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    484c:	83 c0 01             	add    $0x1,%eax
+    484f:	84 d2                	test   %dl,%dl
+    4851:	74 0d                	je     4860 <strchr+0x30>
+    if(*s == c)
+    4853:	38 d1                	cmp    %dl,%cl
+    4855:	75 f1                	jne    4848 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    4857:	5d                   	pop    %ebp
+    4858:	c3                   	ret
+    4859:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    4860:	31 c0                	xor    %eax,%eax
+}
+    4862:	5d                   	pop    %ebp
+    4863:	c3                   	ret
+    4864:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    486b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    486f:	90                   	nop
+
+00004870 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    4870:	55                   	push   %ebp
+    4871:	89 e5                	mov    %esp,%ebp
+    4873:	56                   	push   %esi
+    4874:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    4875:	83 ec 08             	sub    $0x8,%esp
+    4878:	6a 00                	push   $0x0
+    487a:	ff 75 08             	push   0x8(%ebp)
+    487d:	e8 6b 02 00 00       	call   4aed <open>
+  if(fd < 0)
+    4882:	83 c4 10             	add    $0x10,%esp
+    4885:	85 c0                	test   %eax,%eax
+    4887:	78 27                	js     48b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    4889:	83 ec 08             	sub    $0x8,%esp
+    488c:	ff 75 0c             	push   0xc(%ebp)
+    488f:	89 c3                	mov    %eax,%ebx
+    4891:	50                   	push   %eax
+    4892:	e8 83 02 00 00       	call   4b1a <fstat>
+  close(fd);
+    4897:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    489a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    489c:	e8 1f 02 00 00       	call   4ac0 <close>
+  return r;
+    48a1:	83 c4 10             	add    $0x10,%esp
+}
+    48a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    48a7:	89 f0                	mov    %esi,%eax
+    48a9:	5b                   	pop    %ebx
+    48aa:	5e                   	pop    %esi
+    48ab:	5d                   	pop    %ebp
+    48ac:	c3                   	ret
+    48ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    48b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    48b5:	eb ed                	jmp    48a4 <stat+0x34>
+    48b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    48be:	66 90                	xchg   %ax,%ax
+
+000048c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    48c0:	55                   	push   %ebp
+    48c1:	89 e5                	mov    %esp,%ebp
+    48c3:	53                   	push   %ebx
+    48c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    48c7:	0f be 02             	movsbl (%edx),%eax
+    48ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    48cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    48d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    48d5:	77 1e                	ja     48f5 <atoi+0x35>
+    48d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    48de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    48e0:	83 c2 01             	add    $0x1,%edx
+    48e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    48e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    48ea:	0f be 02             	movsbl (%edx),%eax
+    48ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    48f0:	80 fb 09             	cmp    $0x9,%bl
+    48f3:	76 eb                	jbe    48e0 <atoi+0x20>
+  return n;
+}
+    48f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    48f8:	89 c8                	mov    %ecx,%eax
+    48fa:	c9                   	leave
+    48fb:	c3                   	ret
+    48fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004900 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    4900:	55                   	push   %ebp
+    4901:	89 e5                	mov    %esp,%ebp
+    4903:	57                   	push   %edi
+    4904:	56                   	push   %esi
+    4905:	8b 45 10             	mov    0x10(%ebp),%eax
+    4908:	8b 55 08             	mov    0x8(%ebp),%edx
+    490b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    490e:	85 c0                	test   %eax,%eax
+    4910:	7e 13                	jle    4925 <memmove+0x25>
+    4912:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    4914:	89 d7                	mov    %edx,%edi
+    4916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    491d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    4920:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    4921:	39 f8                	cmp    %edi,%eax
+    4923:	75 fb                	jne    4920 <memmove+0x20>
+  return vdst;
+}
+    4925:	5e                   	pop    %esi
+    4926:	89 d0                	mov    %edx,%eax
+    4928:	5f                   	pop    %edi
+    4929:	5d                   	pop    %ebp
+    492a:	c3                   	ret
+    492b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    492f:	90                   	nop
+
+00004930 <mutex_init>:
+
+// Futex-based mutex (Drepper, "Futexes Are Tricky", mutex 2).
+// The uncontended paths never enter the kernel.
+void
+mutex_init(struct mutex *m)
+{
+    4930:	55                   	push   %ebp
+    4931:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+    4933:	8b 45 08             	mov    0x8(%ebp),%eax
+    4936:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    493c:	5d                   	pop    %ebp
+    493d:	c3                   	ret
+    493e:	66 90                	xchg   %ax,%ax
+
+00004940 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+    4940:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+    4941:	31 c0                	xor    %eax,%eax
+    4943:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+    4948:	89 e5                	mov    %esp,%ebp
+    494a:	56                   	push   %esi
+    494b:	53                   	push   %ebx
+    494c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+    494f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+    4953:	85 c0                	test   %eax,%eax
+    4955:	74 32                	je     4989 <mutex_lock+0x49>
+    return;
+  if(c != 2)
+    4957:	83 f8 02             	cmp    $0x2,%eax
+    495a:	74 0c                	je     4968 <mutex_lock+0x28>
+static inline uint
+xchg(volatile uint *addr, uint newval) {
+    uint result;
+
+    // The + in "+m" denotes a read-modify-write operand.
+    asm volatile("lock; xchgl %0, %1" :
+    495c:	b8 02 00 00 00       	mov    $0x2,%eax
+    4961:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+    4964:	85 c0                	test   %eax,%eax
+    4966:	74 21                	je     4989 <mutex_lock+0x49>
+    4968:	be 02 00 00 00       	mov    $0x2,%esi
+    496d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAIT, 2);
+    4970:	83 ec 04             	sub    $0x4,%esp
+    4973:	6a 02                	push   $0x2
+    4975:	6a 00                	push   $0x0
+    4977:	53                   	push   %ebx
+    4978:	e8 33 02 00 00       	call   4bb0 <futex>
+    497d:	89 f0                	mov    %esi,%eax
+    497f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+    4982:	83 c4 10             	add    $0x10,%esp
+    4985:	85 c0                	test   %eax,%eax
+    4987:	75 e7                	jne    4970 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+    4989:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    498c:	5b                   	pop    %ebx
+    498d:	5e                   	pop    %esi
+    498e:	5d                   	pop    %ebp
+    498f:	c3                   	ret
+
+00004990 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+    4990:	55                   	push   %ebp
+    4991:	89 e5                	mov    %esp,%ebp
+    4993:	83 ec 08             	sub    $0x8,%esp
+    4996:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+    4999:	f0 83 28 01          	lock subl $0x1,(%eax)
+    499d:	75 09                	jne    49a8 <mutex_unlock+0x18>
+    m->val = 0;
+    futex(&m->val, FUTEX_WAKE, 1);
+  }
+}
+    499f:	c9                   	leave
+    49a0:	c3                   	ret
+    49a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+    49a8:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+    49ab:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex(&m->val, FUTEX_WAKE, 1);
+    49b1:	6a 01                	push   $0x1
+    49b3:	6a 01                	push   $0x1
+    49b5:	50                   	push   %eax
+    49b6:	e8 f5 01 00 00       	call   4bb0 <futex>
+    49bb:	83 c4 10             	add    $0x10,%esp
+}
+    49be:	c9                   	leave
+    49bf:	c3                   	ret
+
+000049c0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+    49c0:	55                   	push   %ebp
+    49c1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    49c3:	8b 45 08             	mov    0x8(%ebp),%eax
+    49c6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    49cc:	5d                   	pop    %ebp
+    49cd:	c3                   	ret
+    49ce:	66 90                	xchg   %ax,%ax
+
+000049d0 <cond_wait>:
+
+// Release m and wait for a signal, then reacquire m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+    49d0:	55                   	push   %ebp
+    49d1:	89 e5                	mov    %esp,%ebp
+    49d3:	57                   	push   %edi
+    49d4:	56                   	push   %esi
+    49d5:	53                   	push   %ebx
+    49d6:	83 ec 0c             	sub    $0xc,%esp
+    49d9:	8b 75 08             	mov    0x8(%ebp),%esi
+    49dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    49df:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+    49e1:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+    49e5:	75 21                	jne    4a08 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+    49e7:	83 ec 04             	sub    $0x4,%esp
+    49ea:	57                   	push   %edi
+    49eb:	6a 00                	push   $0x0
+    49ed:	56                   	push   %esi
+    49ee:	e8 bd 01 00 00       	call   4bb0 <futex>
+  mutex_lock(m);
+    49f3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+    49f6:	83 c4 10             	add    $0x10,%esp
+}
+    49f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    49fc:	5b                   	pop    %ebx
+    49fd:	5e                   	pop    %esi
+    49fe:	5f                   	pop    %edi
+    49ff:	5d                   	pop    %ebp
+  mutex_lock(m);
+    4a00:	e9 3b ff ff ff       	jmp    4940 <mutex_lock>
+    4a05:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+    4a08:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+    4a0b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex(&m->val, FUTEX_WAKE, 1);
+    4a11:	6a 01                	push   $0x1
+    4a13:	6a 01                	push   $0x1
+    4a15:	53                   	push   %ebx
+    4a16:	e8 95 01 00 00       	call   4bb0 <futex>
+    4a1b:	83 c4 10             	add    $0x10,%esp
+    4a1e:	eb c7                	jmp    49e7 <cond_wait+0x17>
+
+00004a20 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+    4a20:	55                   	push   %ebp
+    4a21:	89 e5                	mov    %esp,%ebp
+    4a23:	83 ec 0c             	sub    $0xc,%esp
+    4a26:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    4a29:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+    4a2d:	6a 01                	push   $0x1
+    4a2f:	6a 01                	push   $0x1
+    4a31:	50                   	push   %eax
+    4a32:	e8 79 01 00 00       	call   4bb0 <futex>
+}
+    4a37:	83 c4 10             	add    $0x10,%esp
+    4a3a:	c9                   	leave
+    4a3b:	c3                   	ret
+    4a3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004a40 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+    4a40:	55                   	push   %ebp
+    4a41:	89 e5                	mov    %esp,%ebp
+    4a43:	83 ec 0c             	sub    $0xc,%esp
+    4a46:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    4a49:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+    4a4d:	6a 40                	push   $0x40
+    4a4f:	6a 01                	push   $0x1
+    4a51:	50                   	push   %eax
+    4a52:	e8 59 01 00 00       	call   4bb0 <futex>
+}
+    4a57:	83 c4 10             	add    $0x10,%esp
+    4a5a:	c9                   	leave
+    4a5b:	c3                   	ret
+    4a5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004a60 <uptime>:
+// Clock ticks since boot, read from the kernel's vdso page
+// without a system call.
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+    4a60:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+    4a65:	c3                   	ret
+
+00004a66 <sysfork>:
+  1: ret
+
+#define SYSCALL(name) SYSCALLAS(name, name)
+
+// ulib.c wraps these.
+SYSCALLAS(sysfork, fork)
+    4a66:	b8 01 00 00 00       	mov    $0x1,%eax
+    4a6b:	89 e1                	mov    %esp,%ecx
+    4a6d:	ba 74 4a 00 00       	mov    $0x4a74,%edx
+    4a72:	0f 34                	sysenter
+    4a74:	c3                   	ret
+
+00004a75 <sysexit>:
+SYSCALLAS(sysexit, exit)
+    4a75:	b8 02 00 00 00       	mov    $0x2,%eax
+    4a7a:	89 e1                	mov    %esp,%ecx
+    4a7c:	ba 83 4a 00 00       	mov    $0x4a83,%edx
+    4a81:	0f 34                	sysenter
+    4a83:	c3                   	ret
+
+00004a84 <wait>:
+SYSCALL(wait)
+    4a84:	b8 03 00 00 00       	mov    $0x3,%eax
+    4a89:	89 e1                	mov    %esp,%ecx
+    4a8b:	ba 92 4a 00 00       	mov    $0x4a92,%edx
+    4a90:	0f 34                	sysenter
+    4a92:	c3                   	ret
+
+00004a93 <pipe>:
+SYSCALL(pipe)
+    4a93:	b8 04 00 00 00       	mov    $0x4,%eax
+    4a98:	89 e1                	mov    %esp,%ecx
+    4a9a:	ba a1 4a 00 00       	mov    $0x4aa1,%edx
+    4a9f:	0f 34                	sysenter
+    4aa1:	c3                   	ret
+
+00004aa2 <read>:
+SYSCALL(read)
+    4aa2:	b8 05 00 00 00       	mov    $0x5,%eax
+    4aa7:	89 e1                	mov    %esp,%ecx
+    4aa9:	ba b0 4a 00 00       	mov    $0x4ab0,%edx
+    4aae:	0f 34                	sysenter
+    4ab0:	c3                   	ret
+
+00004ab1 <write>:
+SYSCALL(write)
+    4ab1:	b8 10 00 00 00       	mov    $0x10,%eax
+    4ab6:	89 e1                	mov    %esp,%ecx
+    4ab8:	ba bf 4a 00 00       	mov    $0x4abf,%edx
+    4abd:	0f 34                	sysenter
+    4abf:	c3                   	ret
+
+00004ac0 <close>:
+SYSCALL(close)
+    4ac0:	b8 15 00 00 00       	mov    $0x15,%eax
+    4ac5:	89 e1                	mov    %esp,%ecx
+    4ac7:	ba ce 4a 00 00       	mov    $0x4ace,%edx
+    4acc:	0f 34                	sysenter
+    4ace:	c3                   	ret
+
+00004acf <kill>:
+SYSCALL(kill)
+    4acf:	b8 06 00 00 00       	mov    $0x6,%eax
+    4ad4:	89 e1                	mov    %esp,%ecx
+    4ad6:	ba dd 4a 00 00       	mov    $0x4add,%edx
+    4adb:	0f 34                	sysenter
+    4add:	c3                   	ret
+
+00004ade <sysexec>:
+SYSCALLAS(sysexec, exec)
+    4ade:	b8 07 00 00 00       	mov    $0x7,%eax
+    4ae3:	89 e1                	mov    %esp,%ecx
+    4ae5:	ba ec 4a 00 00       	mov    $0x4aec,%edx
+    4aea:	0f 34                	sysenter
+    4aec:	c3                   	ret
+
+00004aed <open>:
+SYSCALL(open)
+    4aed:	b8 0f 00 00 00       	mov    $0xf,%eax
+    4af2:	89 e1                	mov    %esp,%ecx
+    4af4:	ba fb 4a 00 00       	mov    $0x4afb,%edx
+    4af9:	0f 34                	sysenter
+    4afb:	c3                   	ret
+
+00004afc <mknod>:
+SYSCALL(mknod)
+    4afc:	b8 11 00 00 00       	mov    $0x11,%eax
+    4b01:	89 e1                	mov    %esp,%ecx
+    4b03:	ba 0a 4b 00 00       	mov    $0x4b0a,%edx
+    4b08:	0f 34                	sysenter
+    4b0a:	c3                   	ret
+
+00004b0b <unlink>:
+SYSCALL(unlink)
+    4b0b:	b8 12 00 00 00       	mov    $0x12,%eax
+    4b10:	89 e1                	mov    %esp,%ecx
+    4b12:	ba 19 4b 00 00       	mov    $0x4b19,%edx
+    4b17:	0f 34                	sysenter
+    4b19:	c3                   	ret
+
+00004b1a <fstat>:
+SYSCALL(fstat)
+    4b1a:	b8 08 00 00 00       	mov    $0x8,%eax
+    4b1f:	89 e1                	mov    %esp,%ecx
+    4b21:	ba 28 4b 00 00       	mov    $0x4b28,%edx
+    4b26:	0f 34                	sysenter
+    4b28:	c3                   	ret
+
+00004b29 <link>:
+SYSCALL(link)
+    4b29:	b8 13 00 00 00       	mov    $0x13,%eax
+    4b2e:	89 e1                	mov    %esp,%ecx
+    4b30:	ba 37 4b 00 00       	mov    $0x4b37,%edx
+    4b35:	0f 34                	sysenter
+    4b37:	c3                   	ret
+
+00004b38 <mkdir>:
+SYSCALL(mkdir)
+    4b38:	b8 14 00 00 00       	mov    $0x14,%eax
+    4b3d:	89 e1                	mov    %esp,%ecx
+    4b3f:	ba 46 4b 00 00       	mov    $0x4b46,%edx
+    4b44:	0f 34                	sysenter
+    4b46:	c3                   	ret
+
+00004b47 <chdir>:
+SYSCALL(chdir)
+    4b47:	b8 09 00 00 00       	mov    $0x9,%eax
+    4b4c:	89 e1                	mov    %esp,%ecx
+    4b4e:	ba 55 4b 00 00       	mov    $0x4b55,%edx
+    4b53:	0f 34                	sysenter
+    4b55:	c3                   	ret
+
+00004b56 <dup>:
+SYSCALL(dup)
+    4b56:	b8 0a 00 00 00       	mov    $0xa,%eax
+    4b5b:	89 e1                	mov    %esp,%ecx
+    4b5d:	ba 64 4b 00 00       	mov    $0x4b64,%edx
+    4b62:	0f 34                	sysenter
+    4b64:	c3                   	ret
+
+00004b65 <getpid>:
+SYSCALL(getpid)
+    4b65:	b8 0b 00 00 00       	mov    $0xb,%eax
+    4b6a:	89 e1                	mov    %esp,%ecx
+    4b6c:	ba 73 4b 00 00       	mov    $0x4b73,%edx
+    4b71:	0f 34                	sysenter
+    4b73:	c3                   	ret
+
+00004b74 <sbrk>:
+SYSCALL(sbrk)
+    4b74:	b8 0c 00 00 00       	mov    $0xc,%eax
+    4b79:	89 e1                	mov    %esp,%ecx
+    4b7b:	ba 82 4b 00 00       	mov    $0x4b82,%edx
+    4b80:	0f 34                	sysenter
+    4b82:	c3                   	ret
+
+00004b83 <sleep>:
+SYSCALL(sleep)
+    4b83:	b8 0d 00 00 00       	mov    $0xd,%eax
+    4b88:	89 e1                	mov    %esp,%ecx
+    4b8a:	ba 91 4b 00 00       	mov    $0x4b91,%edx
+    4b8f:	0f 34                	sysenter
+    4b91:	c3                   	ret
+
+00004b92 <clone>:
+SYSCALL(clone)
+    4b92:	b8 16 00 00 00       	mov    $0x16,%eax
+    4b97:	89 e1                	mov    %esp,%ecx
+    4b99:	ba a0 4b 00 00       	mov    $0x4ba0,%edx
+    4b9e:	0f 34                	sysenter
+    4ba0:	c3                   	ret
+
+00004ba1 <join>:
+SYSCALL(join)
+    4ba1:	b8 17 00 00 00       	mov    $0x17,%eax
+    4ba6:	89 e1                	mov    %esp,%ecx
+    4ba8:	ba af 4b 00 00       	mov    $0x4baf,%edx
+    4bad:	0f 34                	sysenter
+    4baf:	c3                   	ret
+
+00004bb0 <futex>:
+SYSCALL(futex)
+    4bb0:	b8 18 00 00 00       	mov    $0x18,%eax
+    4bb5:	89 e1                	mov    %esp,%ecx
+    4bb7:	ba be 4b 00 00       	mov    $0x4bbe,%edx
+    4bbc:	0f 34                	sysenter
+    4bbe:	c3                   	ret
+
+00004bbf <yield>:
+SYSCALL(yield)
+    4bbf:	b8 19 00 00 00       	mov    $0x19,%eax
+    4bc4:	89 e1                	mov    %esp,%ecx
+    4bc6:	ba cd 4b 00 00       	mov    $0x4bcd,%edx
+    4bcb:	0f 34                	sysenter
+    4bcd:	c3                   	ret
+
+00004bce <lockstat>:
+SYSCALL(lockstat)
+    4bce:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    4bd3:	89 e1                	mov    %esp,%ecx
+    4bd5:	ba dc 4b 00 00       	mov    $0x4bdc,%edx
+    4bda:	0f 34                	sysenter
+    4bdc:	c3                   	ret
+
+00004bdd <lockhammer>:
+SYSCALL(lockhammer)
+    4bdd:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    4be2:	89 e1                	mov    %esp,%ecx
+    4be4:	ba eb 4b 00 00       	mov    $0x4beb,%edx
+    4be9:	0f 34                	sysenter
+    4beb:	c3                   	ret
+
+00004bec <vmsplice>:
+SYSCALL(vmsplice)
+    4bec:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    4bf1:	89 e1                	mov    %esp,%ecx
+    4bf3:	ba fa 4b 00 00       	mov    $0x4bfa,%edx
+    4bf8:	0f 34                	sysenter
+    4bfa:	c3                   	ret
+
+00004bfb <hsbrk>:
+SYSCALL(hsbrk)
+    4bfb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    4c00:	89 e1                	mov    %esp,%ecx
+    4c02:	ba 09 4c 00 00       	mov    $0x4c09,%edx
+    4c07:	0f 34                	sysenter
+    4c09:	c3                   	ret
+
+00004c0a <mmap>:
+SYSCALL(mmap)
+    4c0a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    4c0f:	89 e1                	mov    %esp,%ecx
+    4c11:	ba 18 4c 00 00       	mov    $0x4c18,%edx
+    4c16:	0f 34                	sysenter
+    4c18:	c3                   	ret
+
+00004c19 <munmap>:
+SYSCALL(munmap)
+    4c19:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    4c1e:	89 e1                	mov    %esp,%ecx
+    4c20:	ba 27 4c 00 00       	mov    $0x4c27,%edx
+    4c25:	0f 34                	sysenter
+    4c27:	c3                   	ret
+
+00004c28 <ringenter>:
+SYSCALL(ringenter)
+    4c28:	b8 20 00 00 00       	mov    $0x20,%eax
+    4c2d:	89 e1                	mov    %esp,%ecx
+    4c2f:	ba 36 4c 00 00       	mov    $0x4c36,%edx
+    4c34:	0f 34                	sysenter
+    4c36:	c3                   	ret
+
+00004c37 <readv>:
+SYSCALL(readv)
+    4c37:	b8 21 00 00 00       	mov    $0x21,%eax
+    4c3c:	89 e1                	mov    %esp,%ecx
+    4c3e:	ba 45 4c 00 00       	mov    $0x4c45,%edx
+    4c43:	0f 34                	sysenter
+    4c45:	c3                   	ret
+
+00004c46 <writev>:
+SYSCALL(writev)
+    4c46:	b8 22 00 00 00       	mov    $0x22,%eax
+    4c4b:	89 e1                	mov    %esp,%ecx
+    4c4d:	ba 54 4c 00 00       	mov    $0x4c54,%edx
+    4c52:	0f 34                	sysenter
+    4c54:	c3                   	ret
+
+00004c55 <pread>:
+SYSCALL(pread)
+    4c55:	b8 23 00 00 00       	mov    $0x23,%eax
+    4c5a:	89 e1                	mov    %esp,%ecx
+    4c5c:	ba 63 4c 00 00       	mov    $0x4c63,%edx
+    4c61:	0f 34                	sysenter
+    4c63:	c3                   	ret
+
+00004c64 <pwrite>:
+SYSCALL(pwrite)
+    4c64:	b8 24 00 00 00       	mov    $0x24,%eax
+    4c69:	89 e1                	mov    %esp,%ecx
+    4c6b:	ba 72 4c 00 00       	mov    $0x4c72,%edx
+    4c70:	0f 34                	sysenter
+    4c72:	c3                   	ret
+
+00004c73 <prof>:
+SYSCALL(prof)
+    4c73:	b8 25 00 00 00       	mov    $0x25,%eax
+    4c78:	89 e1                	mov    %esp,%ecx
+    4c7a:	ba 81 4c 00 00       	mov    $0x4c81,%edx
+    4c7f:	0f 34                	sysenter
+    4c81:	c3                   	ret
+
+00004c82 <scstat>:
+SYSCALL(scstat)
+    4c82:	b8 26 00 00 00       	mov    $0x26,%eax
+    4c87:	89 e1                	mov    %esp,%ecx
+    4c89:	ba 90 4c 00 00       	mov    $0x4c90,%edx
+    4c8e:	0f 34                	sysenter
+    4c90:	c3                   	ret
+    4c91:	66 90                	xchg   %ax,%ax
+    4c93:	66 90                	xchg   %ax,%ax
+    4c95:	66 90                	xchg   %ax,%ax
+    4c97:	66 90                	xchg   %ax,%ax
+    4c99:	66 90                	xchg   %ax,%ax
+    4c9b:	66 90                	xchg   %ax,%ax
+    4c9d:	66 90                	xchg   %ax,%ax
+    4c9f:	90                   	nop
+
+00004ca0 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+    4ca0:	55                   	push   %ebp
+    4ca1:	89 e5                	mov    %esp,%ebp
+    4ca3:	57                   	push   %edi
+    4ca4:	56                   	push   %esi
+    4ca5:	53                   	push   %ebx
+    4ca6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    4ca8:	89 d1                	mov    %edx,%ecx
+{
+    4caa:	83 ec 2c             	sub    $0x2c,%esp
+    4cad:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+    4cb0:	85 d2                	test   %edx,%edx
+    4cb2:	79 7c                	jns    4d30 <printint+0x90>
+    4cb4:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    4cb8:	74 76                	je     4d30 <printint+0x90>
+    x = -xx;
+    4cba:	f7 d9                	neg    %ecx
+    neg = 1;
+    4cbc:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    4cc1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    4cc4:	31 f6                	xor    %esi,%esi
+    4cc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4ccd:	8d 76 00             	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    4cd0:	89 c8                	mov    %ecx,%eax
+    4cd2:	31 d2                	xor    %edx,%edx
+    4cd4:	89 f7                	mov    %esi,%edi
+    4cd6:	f7 f3                	div    %ebx
+    4cd8:	8d 76 01             	lea    0x1(%esi),%esi
+    4cdb:	0f b6 92 60 80 00 00 	movzbl 0x8060(%edx),%edx
+    4ce2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    4ce6:	89 ca                	mov    %ecx,%edx
+    4ce8:	89 c1                	mov    %eax,%ecx
+    4cea:	39 da                	cmp    %ebx,%edx
+    4cec:	73 e2                	jae    4cd0 <printint+0x30>
+  if(neg)
+    4cee:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    4cf1:	85 c0                	test   %eax,%eax
+    4cf3:	74 07                	je     4cfc <printint+0x5c>
+    buf[i++] = '-';
+    4cf5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    4cfa:	89 f7                	mov    %esi,%edi
+    4cfc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    4cff:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    4d02:	01 df                	add    %ebx,%edi
+    4d04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc_unlocked(buf[i], f);
+    4d08:	83 ec 08             	sub    $0x8,%esp
+    4d0b:	56                   	push   %esi
+    4d0c:	0f be 07             	movsbl (%edi),%eax
+    4d0f:	50                   	push   %eax
+    4d10:	e8 cb 07 00 00       	call   54e0 <putc_unlocked>
+  while(--i >= 0)
+    4d15:	89 f8                	mov    %edi,%eax
+    4d17:	83 c4 10             	add    $0x10,%esp
+    4d1a:	83 ef 01             	sub    $0x1,%edi
+    4d1d:	39 d8                	cmp    %ebx,%eax
+    4d1f:	75 e7                	jne    4d08 <printint+0x68>
+}
+    4d21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4d24:	5b                   	pop    %ebx
+    4d25:	5e                   	pop    %esi
+    4d26:	5f                   	pop    %edi
+    4d27:	5d                   	pop    %ebp
+    4d28:	c3                   	ret
+    4d29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    4d30:	31 c0                	xor    %eax,%eax
+    4d32:	eb 8d                	jmp    4cc1 <printint+0x21>
+    4d34:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4d3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4d3f:	90                   	nop
+
+00004d40 <vfprintf>:
+
+// Print to the given stream, which the caller has locked.
+// Only understands %d, %x, %p, %s.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+    4d40:	55                   	push   %ebp
+    4d41:	89 e5                	mov    %esp,%ebp
+    4d43:	57                   	push   %edi
+    4d44:	56                   	push   %esi
+    4d45:	53                   	push   %ebx
+    4d46:	83 ec 1c             	sub    $0x1c,%esp
+    4d49:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+    4d4c:	0f b6 0a             	movzbl (%edx),%ecx
+    4d4f:	84 c9                	test   %cl,%cl
+    4d51:	74 5c                	je     4daf <vfprintf+0x6f>
+    4d53:	89 c6                	mov    %eax,%esi
+    4d55:	8d 5a 01             	lea    0x1(%edx),%ebx
+    4d58:	31 ff                	xor    %edi,%edi
+    4d5a:	eb 20                	jmp    4d7c <vfprintf+0x3c>
+    4d5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    4d60:	83 f9 25             	cmp    $0x25,%ecx
+    4d63:	74 3b                	je     4da0 <vfprintf+0x60>
+        state = '%';
+      } else {
+        putc_unlocked(c, f);
+    4d65:	83 ec 08             	sub    $0x8,%esp
+    4d68:	56                   	push   %esi
+    4d69:	51                   	push   %ecx
+    4d6a:	e8 71 07 00 00       	call   54e0 <putc_unlocked>
+    4d6f:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    4d72:	0f b6 0b             	movzbl (%ebx),%ecx
+    4d75:	83 c3 01             	add    $0x1,%ebx
+    4d78:	84 c9                	test   %cl,%cl
+    4d7a:	74 33                	je     4daf <vfprintf+0x6f>
+    if(state == 0){
+    4d7c:	85 ff                	test   %edi,%edi
+    4d7e:	74 e0                	je     4d60 <vfprintf+0x20>
+      }
+    } else if(state == '%'){
+    4d80:	83 ff 25             	cmp    $0x25,%edi
+    4d83:	75 ed                	jne    4d72 <vfprintf+0x32>
+      if(c == 'd'){
+    4d85:	83 f9 25             	cmp    $0x25,%ecx
+    4d88:	0f 84 02 01 00 00    	je     4e90 <vfprintf+0x150>
+    4d8e:	8d 41 9d             	lea    -0x63(%ecx),%eax
+    4d91:	83 f8 15             	cmp    $0x15,%eax
+    4d94:	77 2a                	ja     4dc0 <vfprintf+0x80>
+    4d96:	ff 24 85 08 80 00 00 	jmp    *0x8008(,%eax,4)
+    4d9d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+    4da0:	0f b6 0b             	movzbl (%ebx),%ecx
+    4da3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+    4da6:	bf 25 00 00 00       	mov    $0x25,%edi
+  for(i = 0; fmt[i]; i++){
+    4dab:	84 c9                	test   %cl,%cl
+    4dad:	75 cd                	jne    4d7c <vfprintf+0x3c>
+        putc_unlocked(c, f);
+      }
+      state = 0;
+    }
+  }
+}
+    4daf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4db2:	5b                   	pop    %ebx
+    4db3:	5e                   	pop    %esi
+    4db4:	5f                   	pop    %edi
+    4db5:	5d                   	pop    %ebp
+    4db6:	c3                   	ret
+    4db7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4dbe:	66 90                	xchg   %ax,%ax
+        putc_unlocked('%', f);
+    4dc0:	83 ec 08             	sub    $0x8,%esp
+    4dc3:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    4dc6:	56                   	push   %esi
+    4dc7:	6a 25                	push   $0x25
+    4dc9:	e8 12 07 00 00       	call   54e0 <putc_unlocked>
+        putc_unlocked(c, f);
+    4dce:	58                   	pop    %eax
+    4dcf:	5a                   	pop    %edx
+    4dd0:	56                   	push   %esi
+    4dd1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    4dd4:	51                   	push   %ecx
+    4dd5:	e8 06 07 00 00       	call   54e0 <putc_unlocked>
+    4dda:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    4ddd:	31 ff                	xor    %edi,%edi
+    4ddf:	eb 91                	jmp    4d72 <vfprintf+0x32>
+    4de1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+    4de8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    4deb:	83 ec 0c             	sub    $0xc,%esp
+    4dee:	b9 10 00 00 00       	mov    $0x10,%ecx
+    4df3:	8b 17                	mov    (%edi),%edx
+    4df5:	6a 00                	push   $0x0
+        ap++;
+    4df7:	83 c7 04             	add    $0x4,%edi
+        printint(f, *ap, 16, 0);
+    4dfa:	89 f0                	mov    %esi,%eax
+    4dfc:	e8 9f fe ff ff       	call   4ca0 <printint>
+        ap++;
+    4e01:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    4e04:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    4e07:	31 ff                	xor    %edi,%edi
+    4e09:	e9 64 ff ff ff       	jmp    4d72 <vfprintf+0x32>
+    4e0e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+    4e10:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    4e13:	8b 10                	mov    (%eax),%edx
+        ap++;
+    4e15:	83 c0 04             	add    $0x4,%eax
+    4e18:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    4e1b:	85 d2                	test   %edx,%edx
+    4e1d:	0f 84 85 00 00 00    	je     4ea8 <vfprintf+0x168>
+        while(*s != 0){
+    4e23:	0f be 02             	movsbl (%edx),%eax
+        s = (char*)*ap;
+    4e26:	89 d7                	mov    %edx,%edi
+        while(*s != 0){
+    4e28:	84 c0                	test   %al,%al
+    4e2a:	74 b1                	je     4ddd <vfprintf+0x9d>
+    4e2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+          putc_unlocked(*s, f);
+    4e30:	83 ec 08             	sub    $0x8,%esp
+          s++;
+    4e33:	83 c7 01             	add    $0x1,%edi
+          putc_unlocked(*s, f);
+    4e36:	56                   	push   %esi
+    4e37:	50                   	push   %eax
+    4e38:	e8 a3 06 00 00       	call   54e0 <putc_unlocked>
+        while(*s != 0){
+    4e3d:	0f be 07             	movsbl (%edi),%eax
+    4e40:	83 c4 10             	add    $0x10,%esp
+    4e43:	84 c0                	test   %al,%al
+    4e45:	75 e9                	jne    4e30 <vfprintf+0xf0>
+      state = 0;
+    4e47:	31 ff                	xor    %edi,%edi
+    4e49:	e9 24 ff ff ff       	jmp    4d72 <vfprintf+0x32>
+    4e4e:	66 90                	xchg   %ax,%ax
+        printint(f, *ap, 10, 1);
+    4e50:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    4e53:	83 ec 0c             	sub    $0xc,%esp
+    4e56:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    4e5b:	8b 17                	mov    (%edi),%edx
+    4e5d:	6a 01                	push   $0x1
+    4e5f:	eb 96                	jmp    4df7 <vfprintf+0xb7>
+    4e61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc_unlocked(*ap, f);
+    4e68:	83 ec 08             	sub    $0x8,%esp
+    4e6b:	56                   	push   %esi
+    4e6c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    4e6f:	ff 37                	push   (%edi)
+    4e71:	e8 6a 06 00 00       	call   54e0 <putc_unlocked>
+        ap++;
+    4e76:	89 f8                	mov    %edi,%eax
+    4e78:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    4e7b:	31 ff                	xor    %edi,%edi
+        ap++;
+    4e7d:	83 c0 04             	add    $0x4,%eax
+    4e80:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    4e83:	e9 ea fe ff ff       	jmp    4d72 <vfprintf+0x32>
+    4e88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4e8f:	90                   	nop
+        putc_unlocked(c, f);
+    4e90:	83 ec 08             	sub    $0x8,%esp
+      state = 0;
+    4e93:	31 ff                	xor    %edi,%edi
+        putc_unlocked(c, f);
+    4e95:	56                   	push   %esi
+    4e96:	6a 25                	push   $0x25
+    4e98:	e8 43 06 00 00       	call   54e0 <putc_unlocked>
+    4e9d:	83 c4 10             	add    $0x10,%esp
+    4ea0:	e9 cd fe ff ff       	jmp    4d72 <vfprintf+0x32>
+    4ea5:	8d 76 00             	lea    0x0(%esi),%esi
+    4ea8:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    4ead:	bf 00 80 00 00       	mov    $0x8000,%edi
+    4eb2:	e9 79 ff ff ff       	jmp    4e30 <vfprintf+0xf0>
+    4eb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4ebe:	66 90                	xchg   %ax,%ax
+
+00004ec0 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+    4ec0:	55                   	push   %ebp
+    4ec1:	89 e5                	mov    %esp,%ebp
+    4ec3:	53                   	push   %ebx
+    4ec4:	83 ec 10             	sub    $0x10,%esp
+    4ec7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  flockfile(f);
+    4eca:	53                   	push   %ebx
+    4ecb:	e8 d0 02 00 00       	call   51a0 <flockfile>
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+    4ed0:	8b 55 0c             	mov    0xc(%ebp),%edx
+    4ed3:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    4ed6:	89 d8                	mov    %ebx,%eax
+    4ed8:	e8 63 fe ff ff       	call   4d40 <vfprintf>
+  funlockfile(f);
+    4edd:	89 1c 24             	mov    %ebx,(%esp)
+    4ee0:	e8 eb 02 00 00       	call   51d0 <funlockfile>
+}
+    4ee5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4ee8:	83 c4 10             	add    $0x10,%esp
+    4eeb:	c9                   	leave
+    4eec:	c3                   	ret
+    4eed:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004ef0 <printf>:
+
+// Print to the given fd: through stdout or stderr for 1 and 2,
+// otherwise with one write() per call.
+void
+printf(int fd, const char *fmt, ...)
+{
+    4ef0:	55                   	push   %ebp
+    4ef1:	89 e5                	mov    %esp,%ebp
+    4ef3:	56                   	push   %esi
+    4ef4:	53                   	push   %ebx
+    4ef5:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+    4efb:	8b 45 08             	mov    0x8(%ebp),%eax
+  char buf[128];
+  struct iobuf f;
+
+  if(fd == 1 || fd == 2){
+    flockfile(&_iob[fd]);
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+    4efe:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(fd == 1 || fd == 2){
+    4f01:	8d 50 ff             	lea    -0x1(%eax),%edx
+    4f04:	83 fa 01             	cmp    $0x1,%edx
+    4f07:	76 77                	jbe    4f80 <printf+0x90>
+    funlockfile(&_iob[fd]);
+    return;
+  }
+  f.fd = fd;
+    4f09:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  f.flags = IO_WRITE|IO_SETUP;
+  f.buf = buf;
+    4f0f:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  f.size = sizeof(buf);
+  f.r = f.n = 0;
+  mutex_init(&f.lock);
+    4f15:	83 ec 0c             	sub    $0xc,%esp
+    4f18:	8d 9d 5c ff ff ff    	lea    -0xa4(%ebp),%ebx
+  f.buf = buf;
+    4f1e:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+  mutex_init(&f.lock);
+    4f24:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  f.flags = IO_WRITE|IO_SETUP;
+    4f2a:	c7 85 60 ff ff ff 42 	movl   $0x42,-0xa0(%ebp)
+    4f31:	00 00 00 
+  f.size = sizeof(buf);
+    4f34:	c7 85 68 ff ff ff 80 	movl   $0x80,-0x98(%ebp)
+    4f3b:	00 00 00 
+  f.r = f.n = 0;
+    4f3e:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+    4f45:	00 00 00 
+    4f48:	c7 85 6c ff ff ff 00 	movl   $0x0,-0x94(%ebp)
+    4f4f:	00 00 00 
+  mutex_init(&f.lock);
+    4f52:	50                   	push   %eax
+    4f53:	e8 d8 f9 ff ff       	call   4930 <mutex_init>
+  vfprintf(&f, fmt, (uint*)(void*)&fmt + 1);
+    4f58:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    4f5b:	89 f2                	mov    %esi,%edx
+    4f5d:	89 d8                	mov    %ebx,%eax
+    4f5f:	e8 dc fd ff ff       	call   4d40 <vfprintf>
+  fflush(&f);
+    4f64:	89 1c 24             	mov    %ebx,(%esp)
+    4f67:	e8 f4 04 00 00       	call   5460 <fflush>
+    4f6c:	83 c4 10             	add    $0x10,%esp
+}
+    4f6f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    4f72:	5b                   	pop    %ebx
+    4f73:	5e                   	pop    %esi
+    4f74:	5d                   	pop    %ebp
+    4f75:	c3                   	ret
+    4f76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4f7d:	8d 76 00             	lea    0x0(%esi),%esi
+    flockfile(&_iob[fd]);
+    4f80:	6b c0 1c             	imul   $0x1c,%eax,%eax
+    4f83:	83 ec 0c             	sub    $0xc,%esp
+    4f86:	8d 98 40 92 00 00    	lea    0x9240(%eax),%ebx
+    4f8c:	53                   	push   %ebx
+    4f8d:	e8 0e 02 00 00       	call   51a0 <flockfile>
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+    4f92:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    4f95:	89 f2                	mov    %esi,%edx
+    4f97:	89 d8                	mov    %ebx,%eax
+    4f99:	e8 a2 fd ff ff       	call   4d40 <vfprintf>
+    funlockfile(&_iob[fd]);
+    4f9e:	89 1c 24             	mov    %ebx,(%esp)
+    4fa1:	e8 2a 02 00 00       	call   51d0 <funlockfile>
+    4fa6:	83 c4 10             	add    $0x10,%esp
+}
+    4fa9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    4fac:	5b                   	pop    %ebx
+    4fad:	5e                   	pop    %esi
+    4fae:	5d                   	pop    %ebp
+    4faf:	c3                   	ret
+
+00004fb0 <setup>:
+}
+
+// Choose how to buffer f on first use: by lines on a device.
+static void
+setup(FILE *f)
+{
+    4fb0:	55                   	push   %ebp
+    4fb1:	89 e5                	mov    %esp,%ebp
+    4fb3:	53                   	push   %ebx
+    4fb4:	89 c3                	mov    %eax,%ebx
+    4fb6:	83 ec 2c             	sub    $0x2c,%esp
+  struct stat st;
+
+  f->flags |= IO_SETUP;
+    4fb9:	83 48 04 40          	orl    $0x40,0x4(%eax)
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+    4fbd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    4fc0:	50                   	push   %eax
+    4fc1:	ff 33                	push   (%ebx)
+    4fc3:	e8 52 fb ff ff       	call   4b1a <fstat>
+    4fc8:	83 c4 10             	add    $0x10,%esp
+    4fcb:	85 c0                	test   %eax,%eax
+    f->flags |= IO_DEV|IO_LINE;
+    4fcd:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+    4fd0:	75 07                	jne    4fd9 <setup+0x29>
+    4fd2:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+    4fd7:	74 17                	je     4ff0 <setup+0x40>
+  if(f->flags & IO_WRITE)
+    4fd9:	a8 02                	test   $0x2,%al
+    4fdb:	74 0a                	je     4fe7 <setup+0x37>
+    flushhook = flushall;
+    4fdd:	c7 05 f0 e2 00 00 10 	movl   $0x5110,0xe2f0
+    4fe4:	51 00 00 
+}
+    4fe7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4fea:	c9                   	leave
+    4feb:	c3                   	ret
+    4fec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    f->flags |= IO_DEV|IO_LINE;
+    4ff0:	83 c8 30             	or     $0x30,%eax
+    4ff3:	89 43 04             	mov    %eax,0x4(%ebx)
+    4ff6:	eb e1                	jmp    4fd9 <setup+0x29>
+    4ff8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4fff:	90                   	nop
+
+00005000 <flush>:
+static int
+flush(FILE *f)
+{
+  int i, n;
+
+  if(!(f->flags & IO_WRITE))
+    5000:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+    5004:	74 6a                	je     5070 <flush+0x70>
+{
+    5006:	55                   	push   %ebp
+    5007:	89 e5                	mov    %esp,%ebp
+    5009:	56                   	push   %esi
+    500a:	89 c6                	mov    %eax,%esi
+    500c:	53                   	push   %ebx
+    return 0;
+  for(i = 0; i < f->n; i += n){
+    500d:	8b 40 14             	mov    0x14(%eax),%eax
+    5010:	85 c0                	test   %eax,%eax
+    5012:	7e 4c                	jle    5060 <flush+0x60>
+    5014:	31 db                	xor    %ebx,%ebx
+    5016:	eb 11                	jmp    5029 <flush+0x29>
+    5018:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    501f:	90                   	nop
+    5020:	01 c3                	add    %eax,%ebx
+    5022:	8b 46 14             	mov    0x14(%esi),%eax
+    5025:	39 d8                	cmp    %ebx,%eax
+    5027:	7e 37                	jle    5060 <flush+0x60>
+    if((n = write(f->fd, f->buf + i, f->n - i)) <= 0){
+    5029:	83 ec 04             	sub    $0x4,%esp
+    502c:	29 d8                	sub    %ebx,%eax
+    502e:	50                   	push   %eax
+    502f:	8b 46 08             	mov    0x8(%esi),%eax
+    5032:	01 d8                	add    %ebx,%eax
+    5034:	50                   	push   %eax
+    5035:	ff 36                	push   (%esi)
+    5037:	e8 75 fa ff ff       	call   4ab1 <write>
+    503c:	83 c4 10             	add    $0x10,%esp
+    503f:	85 c0                	test   %eax,%eax
+    5041:	7f dd                	jg     5020 <flush+0x20>
+      f->flags |= IO_ERR;
+    5043:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+      f->n = 0;
+    5047:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    504c:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+      return EOF;
+    }
+  }
+  f->n = 0;
+  return 0;
+}
+    5053:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    5056:	5b                   	pop    %ebx
+    5057:	5e                   	pop    %esi
+    5058:	5d                   	pop    %ebp
+    5059:	c3                   	ret
+    505a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->n = 0;
+    5060:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+}
+    5067:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+    506a:	31 c0                	xor    %eax,%eax
+}
+    506c:	5b                   	pop    %ebx
+    506d:	5e                   	pop    %esi
+    506e:	5d                   	pop    %ebp
+    506f:	c3                   	ret
+    return 0;
+    5070:	31 c0                	xor    %eax,%eax
+}
+    5072:	c3                   	ret
+    5073:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    507a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00005080 <fflush.part.0>:
+fflush(FILE *f)
+    5080:	55                   	push   %ebp
+    5081:	89 e5                	mov    %esp,%ebp
+    5083:	57                   	push   %edi
+    5084:	bf 38 93 00 00       	mov    $0x9338,%edi
+    5089:	56                   	push   %esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+    508a:	31 f6                	xor    %esi,%esi
+fflush(FILE *f)
+    508c:	53                   	push   %ebx
+    508d:	bb 58 92 00 00       	mov    $0x9258,%ebx
+    5092:	83 ec 1c             	sub    $0x1c,%esp
+    5095:	eb 10                	jmp    50a7 <fflush.part.0+0x27>
+    5097:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    509e:	66 90                	xchg   %ax,%ax
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+    50a0:	83 c3 1c             	add    $0x1c,%ebx
+    50a3:	39 df                	cmp    %ebx,%edi
+    50a5:	74 33                	je     50da <fflush.part.0+0x5a>
+      if((f->flags & IO_WRITE) && fflush(f) < 0)
+    50a7:	f6 43 ec 02          	testb  $0x2,-0x14(%ebx)
+    50ab:	74 f3                	je     50a0 <fflush.part.0+0x20>
+  if(threaded)
+    50ad:	8b 0d 00 e3 00 00    	mov    0xe300,%ecx
+    50b3:	85 c9                	test   %ecx,%ecx
+    50b5:	75 49                	jne    5100 <fflush.part.0+0x80>
+  r = flush(f);
+    50b7:	8d 43 e8             	lea    -0x18(%ebx),%eax
+    50ba:	e8 41 ff ff ff       	call   5000 <flush>
+  if(threaded)
+    50bf:	8b 15 00 e3 00 00    	mov    0xe300,%edx
+    50c5:	85 d2                	test   %edx,%edx
+    50c7:	75 1f                	jne    50e8 <fflush.part.0+0x68>
+        r = EOF;
+    50c9:	85 c0                	test   %eax,%eax
+    50cb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    50d0:	0f 48 f0             	cmovs  %eax,%esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+    50d3:	83 c3 1c             	add    $0x1c,%ebx
+    50d6:	39 df                	cmp    %ebx,%edi
+    50d8:	75 cd                	jne    50a7 <fflush.part.0+0x27>
+}
+    50da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    50dd:	89 f0                	mov    %esi,%eax
+    50df:	5b                   	pop    %ebx
+    50e0:	5e                   	pop    %esi
+    50e1:	5f                   	pop    %edi
+    50e2:	5d                   	pop    %ebp
+    50e3:	c3                   	ret
+    50e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    50e8:	83 ec 0c             	sub    $0xc,%esp
+    50eb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    50ee:	53                   	push   %ebx
+    50ef:	e8 9c f8 ff ff       	call   4990 <mutex_unlock>
+    50f4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    50f7:	83 c4 10             	add    $0x10,%esp
+    50fa:	eb cd                	jmp    50c9 <fflush.part.0+0x49>
+    50fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    5100:	83 ec 0c             	sub    $0xc,%esp
+    5103:	53                   	push   %ebx
+    5104:	e8 37 f8 ff ff       	call   4940 <mutex_lock>
+    5109:	83 c4 10             	add    $0x10,%esp
+    510c:	eb a9                	jmp    50b7 <fflush.part.0+0x37>
+    510e:	66 90                	xchg   %ax,%ax
+
+00005110 <flushall>:
+  if(f == 0){
+    5110:	e9 6b ff ff ff       	jmp    5080 <fflush.part.0>
+    5115:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    511c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00005120 <fill>:
+
+// Refill f's buffer. Returns the number of bytes read.
+// Caller holds f's lock.
+static int
+fill(FILE *f)
+{
+    5120:	55                   	push   %ebp
+    5121:	89 e5                	mov    %esp,%ebp
+    5123:	53                   	push   %ebx
+    5124:	89 c3                	mov    %eax,%ebx
+    5126:	83 ec 04             	sub    $0x4,%esp
+  int n;
+
+  if(!(f->flags & IO_SETUP))
+    5129:	8b 40 04             	mov    0x4(%eax),%eax
+    512c:	a8 40                	test   $0x40,%al
+    512e:	74 50                	je     5180 <fill+0x60>
+    setup(f);
+  if(f->flags & IO_DEV)
+    5130:	a8 20                	test   $0x20,%al
+    5132:	75 3c                	jne    5170 <fill+0x50>
+    fflush(0);
+  f->r = 0;
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+    5134:	83 ec 04             	sub    $0x4,%esp
+  f->r = 0;
+    5137:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+    513e:	ff 73 0c             	push   0xc(%ebx)
+    5141:	ff 73 08             	push   0x8(%ebx)
+    5144:	ff 33                	push   (%ebx)
+    5146:	e8 57 f9 ff ff       	call   4aa2 <read>
+    514b:	83 c4 10             	add    $0x10,%esp
+    514e:	85 c0                	test   %eax,%eax
+    5150:	7f 10                	jg     5162 <fill+0x42>
+    f->flags |= n < 0 ? IO_ERR : IO_EOF;
+    5152:	83 f8 01             	cmp    $0x1,%eax
+    5155:	19 c0                	sbb    %eax,%eax
+    5157:	83 e0 fc             	and    $0xfffffffc,%eax
+    515a:	83 c0 08             	add    $0x8,%eax
+    515d:	09 43 04             	or     %eax,0x4(%ebx)
+    n = 0;
+    5160:	31 c0                	xor    %eax,%eax
+  }
+  f->n = n;
+    5162:	89 43 14             	mov    %eax,0x14(%ebx)
+  return n;
+}
+    5165:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    5168:	c9                   	leave
+    5169:	c3                   	ret
+    516a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == 0){
+    5170:	e8 0b ff ff ff       	call   5080 <fflush.part.0>
+    5175:	eb bd                	jmp    5134 <fill+0x14>
+    5177:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    517e:	66 90                	xchg   %ax,%ax
+    setup(f);
+    5180:	89 d8                	mov    %ebx,%eax
+    5182:	e8 29 fe ff ff       	call   4fb0 <setup>
+  if(f->flags & IO_DEV)
+    5187:	8b 43 04             	mov    0x4(%ebx),%eax
+    518a:	eb a4                	jmp    5130 <fill+0x10>
+    518c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00005190 <stdio_threaded>:
+  threaded = 1;
+    5190:	c7 05 00 e3 00 00 01 	movl   $0x1,0xe300
+    5197:	00 00 00 
+}
+    519a:	c3                   	ret
+    519b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    519f:	90                   	nop
+
+000051a0 <flockfile>:
+{
+    51a0:	55                   	push   %ebp
+  if(threaded)
+    51a1:	8b 15 00 e3 00 00    	mov    0xe300,%edx
+{
+    51a7:	89 e5                	mov    %esp,%ebp
+    51a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+    51ac:	85 d2                	test   %edx,%edx
+    51ae:	75 08                	jne    51b8 <flockfile+0x18>
+}
+    51b0:	5d                   	pop    %ebp
+    51b1:	c3                   	ret
+    51b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_lock(&f->lock);
+    51b8:	83 c0 18             	add    $0x18,%eax
+    51bb:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+    51be:	5d                   	pop    %ebp
+    mutex_lock(&f->lock);
+    51bf:	e9 7c f7 ff ff       	jmp    4940 <mutex_lock>
+    51c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    51cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    51cf:	90                   	nop
+
+000051d0 <funlockfile>:
+{
+    51d0:	55                   	push   %ebp
+  if(threaded)
+    51d1:	8b 15 00 e3 00 00    	mov    0xe300,%edx
+{
+    51d7:	89 e5                	mov    %esp,%ebp
+    51d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+    51dc:	85 d2                	test   %edx,%edx
+    51de:	75 08                	jne    51e8 <funlockfile+0x18>
+}
+    51e0:	5d                   	pop    %ebp
+    51e1:	c3                   	ret
+    51e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&f->lock);
+    51e8:	83 c0 18             	add    $0x18,%eax
+    51eb:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+    51ee:	5d                   	pop    %ebp
+    mutex_unlock(&f->lock);
+    51ef:	e9 9c f7 ff ff       	jmp    4990 <mutex_unlock>
+    51f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    51fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    51ff:	90                   	nop
+
+00005200 <fopen>:
+{
+    5200:	55                   	push   %ebp
+    5201:	89 e5                	mov    %esp,%ebp
+    5203:	57                   	push   %edi
+    5204:	56                   	push   %esi
+    5205:	53                   	push   %ebx
+    5206:	83 ec 34             	sub    $0x34,%esp
+    5209:	8b 75 0c             	mov    0xc(%ebp),%esi
+    520c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(strcmp(mode, "r") != 0 && strcmp(mode, "w") != 0)
+    520f:	68 1b 64 00 00       	push   $0x641b
+    5214:	56                   	push   %esi
+    5215:	e8 66 f5 ff ff       	call   4780 <strcmp>
+    521a:	83 c4 10             	add    $0x10,%esp
+    521d:	85 c0                	test   %eax,%eax
+    521f:	74 15                	je     5236 <fopen+0x36>
+    5221:	83 ec 08             	sub    $0x8,%esp
+    5224:	68 03 74 00 00       	push   $0x7403
+    5229:	56                   	push   %esi
+    522a:	e8 51 f5 ff ff       	call   4780 <strcmp>
+    522f:	83 c4 10             	add    $0x10,%esp
+    5232:	85 c0                	test   %eax,%eax
+    5234:	75 2c                	jne    5262 <fopen+0x62>
+  if(threaded)
+    5236:	a1 00 e3 00 00       	mov    0xe300,%eax
+    523b:	85 c0                	test   %eax,%eax
+    523d:	0f 85 ed 00 00 00    	jne    5330 <fopen+0x130>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+    5243:	bb 94 92 00 00       	mov    $0x9294,%ebx
+    if(f->flags == 0)
+    5248:	8b 53 04             	mov    0x4(%ebx),%edx
+    524b:	85 d2                	test   %edx,%edx
+    524d:	74 21                	je     5270 <fopen+0x70>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+    524f:	83 c3 1c             	add    $0x1c,%ebx
+    5252:	81 fb 20 93 00 00    	cmp    $0x9320,%ebx
+    5258:	75 ee                	jne    5248 <fopen+0x48>
+  if(threaded)
+    525a:	85 c0                	test   %eax,%eax
+    525c:	0f 85 36 01 00 00    	jne    5398 <fopen+0x198>
+    return 0;
+    5262:	31 db                	xor    %ebx,%ebx
+    5264:	e9 96 00 00 00       	jmp    52ff <fopen+0xff>
+    5269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f == &_iob[NSTREAM])
+    5270:	81 fb 20 93 00 00    	cmp    $0x9320,%ebx
+    5276:	74 e2                	je     525a <fopen+0x5a>
+    f->flags = IO_MALLOC;
+    5278:	c7 43 04 80 00 00 00 	movl   $0x80,0x4(%ebx)
+  if(threaded)
+    527f:	85 c0                	test   %eax,%eax
+    5281:	0f 85 f9 00 00 00    	jne    5380 <fopen+0x180>
+  if(mode[0] == 'r'){
+    5287:	80 3e 72             	cmpb   $0x72,(%esi)
+    528a:	0f 84 c0 00 00 00    	je     5350 <fopen+0x150>
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+    5290:	83 ec 08             	sub    $0x8,%esp
+    5293:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+    5296:	50                   	push   %eax
+    5297:	57                   	push   %edi
+    5298:	e8 d3 f5 ff ff       	call   4870 <stat>
+    529d:	83 c4 10             	add    $0x10,%esp
+    52a0:	85 c0                	test   %eax,%eax
+    52a2:	74 6c                	je     5310 <fopen+0x110>
+    fd = open(path, O_CREATE|O_WRONLY);
+    52a4:	83 ec 08             	sub    $0x8,%esp
+    52a7:	68 01 02 00 00       	push   $0x201
+    52ac:	57                   	push   %edi
+    flags = IO_WRITE;
+    52ad:	bf 02 00 00 00       	mov    $0x2,%edi
+    fd = open(path, O_CREATE|O_WRONLY);
+    52b2:	e8 36 f8 ff ff       	call   4aed <open>
+    52b7:	83 c4 10             	add    $0x10,%esp
+    52ba:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+    52bc:	85 f6                	test   %esi,%esi
+    52be:	0f 88 a9 00 00 00    	js     536d <fopen+0x16d>
+    52c4:	83 ec 0c             	sub    $0xc,%esp
+    52c7:	68 00 02 00 00       	push   $0x200
+    52cc:	e8 af 0c 00 00       	call   5f80 <malloc>
+    52d1:	83 c4 10             	add    $0x10,%esp
+    52d4:	89 43 08             	mov    %eax,0x8(%ebx)
+    52d7:	85 c0                	test   %eax,%eax
+    52d9:	0f 84 d0 00 00 00    	je     53af <fopen+0x1af>
+  f->flags = flags|IO_MALLOC;
+    52df:	81 cf 80 00 00 00    	or     $0x80,%edi
+  f->fd = fd;
+    52e5:	89 33                	mov    %esi,(%ebx)
+  f->size = BUFSIZ;
+    52e7:	c7 43 0c 00 02 00 00 	movl   $0x200,0xc(%ebx)
+  f->r = f->n = 0;
+    52ee:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+    52f5:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  f->flags = flags|IO_MALLOC;
+    52fc:	89 7b 04             	mov    %edi,0x4(%ebx)
+}
+    52ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    5302:	89 d8                	mov    %ebx,%eax
+    5304:	5b                   	pop    %ebx
+    5305:	5e                   	pop    %esi
+    5306:	5f                   	pop    %edi
+    5307:	5d                   	pop    %ebp
+    5308:	c3                   	ret
+    5309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+    5310:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+    5315:	75 8d                	jne    52a4 <fopen+0xa4>
+      unlink(path);
+    5317:	83 ec 0c             	sub    $0xc,%esp
+    531a:	57                   	push   %edi
+    531b:	e8 eb f7 ff ff       	call   4b0b <unlink>
+    5320:	83 c4 10             	add    $0x10,%esp
+    5323:	e9 7c ff ff ff       	jmp    52a4 <fopen+0xa4>
+    5328:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    532f:	90                   	nop
+    mutex_lock(&iolock);
+    5330:	83 ec 0c             	sub    $0xc,%esp
+    5333:	68 04 e3 00 00       	push   $0xe304
+    5338:	e8 03 f6 ff ff       	call   4940 <mutex_lock>
+  if(threaded)
+    533d:	a1 00 e3 00 00       	mov    0xe300,%eax
+    5342:	83 c4 10             	add    $0x10,%esp
+    5345:	e9 f9 fe ff ff       	jmp    5243 <fopen+0x43>
+    534a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    fd = open(path, O_RDONLY);
+    5350:	83 ec 08             	sub    $0x8,%esp
+    5353:	6a 00                	push   $0x0
+    5355:	57                   	push   %edi
+    flags = IO_READ;
+    5356:	bf 01 00 00 00       	mov    $0x1,%edi
+    fd = open(path, O_RDONLY);
+    535b:	e8 8d f7 ff ff       	call   4aed <open>
+    5360:	83 c4 10             	add    $0x10,%esp
+    5363:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+    5365:	85 f6                	test   %esi,%esi
+    5367:	0f 89 57 ff ff ff    	jns    52c4 <fopen+0xc4>
+    f->flags = 0;
+    536d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    return 0;
+    5374:	31 db                	xor    %ebx,%ebx
+    5376:	eb 87                	jmp    52ff <fopen+0xff>
+    5378:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    537f:	90                   	nop
+    mutex_unlock(&iolock);
+    5380:	83 ec 0c             	sub    $0xc,%esp
+    5383:	68 04 e3 00 00       	push   $0xe304
+    5388:	e8 03 f6 ff ff       	call   4990 <mutex_unlock>
+    538d:	83 c4 10             	add    $0x10,%esp
+    5390:	e9 f2 fe ff ff       	jmp    5287 <fopen+0x87>
+    5395:	8d 76 00             	lea    0x0(%esi),%esi
+    5398:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+    539b:	31 db                	xor    %ebx,%ebx
+    mutex_unlock(&iolock);
+    539d:	68 04 e3 00 00       	push   $0xe304
+    53a2:	e8 e9 f5 ff ff       	call   4990 <mutex_unlock>
+    53a7:	83 c4 10             	add    $0x10,%esp
+    53aa:	e9 50 ff ff ff       	jmp    52ff <fopen+0xff>
+      close(fd);
+    53af:	83 ec 0c             	sub    $0xc,%esp
+    53b2:	56                   	push   %esi
+    53b3:	e8 08 f7 ff ff       	call   4ac0 <close>
+    53b8:	83 c4 10             	add    $0x10,%esp
+    53bb:	eb b0                	jmp    536d <fopen+0x16d>
+    53bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000053c0 <fclose>:
+{
+    53c0:	55                   	push   %ebp
+    53c1:	89 e5                	mov    %esp,%ebp
+    53c3:	56                   	push   %esi
+    53c4:	53                   	push   %ebx
+  if(threaded)
+    53c5:	8b 15 00 e3 00 00    	mov    0xe300,%edx
+{
+    53cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    53ce:	85 d2                	test   %edx,%edx
+    53d0:	75 46                	jne    5418 <fclose+0x58>
+  r = flush(f);
+    53d2:	89 d8                	mov    %ebx,%eax
+    53d4:	e8 27 fc ff ff       	call   5000 <flush>
+  if(close(f->fd) < 0)
+    53d9:	83 ec 0c             	sub    $0xc,%esp
+    53dc:	ff 33                	push   (%ebx)
+  r = flush(f);
+    53de:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    53e0:	e8 db f6 ff ff       	call   4ac0 <close>
+    53e5:	83 c4 10             	add    $0x10,%esp
+    r = EOF;
+    53e8:	85 c0                	test   %eax,%eax
+    53ea:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    53ef:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->flags & IO_MALLOC)
+    53f2:	f6 43 04 80          	testb  $0x80,0x4(%ebx)
+    53f6:	75 58                	jne    5450 <fclose+0x90>
+  if(threaded)
+    53f8:	a1 00 e3 00 00       	mov    0xe300,%eax
+  f->flags = 0;
+    53fd:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  if(threaded)
+    5404:	85 c0                	test   %eax,%eax
+    5406:	75 28                	jne    5430 <fclose+0x70>
+}
+    5408:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    540b:	89 f0                	mov    %esi,%eax
+    540d:	5b                   	pop    %ebx
+    540e:	5e                   	pop    %esi
+    540f:	5d                   	pop    %ebp
+    5410:	c3                   	ret
+    5411:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    5418:	83 ec 0c             	sub    $0xc,%esp
+    541b:	8d 43 18             	lea    0x18(%ebx),%eax
+    541e:	50                   	push   %eax
+    541f:	e8 1c f5 ff ff       	call   4940 <mutex_lock>
+    5424:	83 c4 10             	add    $0x10,%esp
+    5427:	eb a9                	jmp    53d2 <fclose+0x12>
+    5429:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    5430:	83 ec 0c             	sub    $0xc,%esp
+    5433:	83 c3 18             	add    $0x18,%ebx
+    5436:	53                   	push   %ebx
+    5437:	e8 54 f5 ff ff       	call   4990 <mutex_unlock>
+    543c:	83 c4 10             	add    $0x10,%esp
+}
+    543f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    5442:	89 f0                	mov    %esi,%eax
+    5444:	5b                   	pop    %ebx
+    5445:	5e                   	pop    %esi
+    5446:	5d                   	pop    %ebp
+    5447:	c3                   	ret
+    5448:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    544f:	90                   	nop
+    free(f->buf);
+    5450:	83 ec 0c             	sub    $0xc,%esp
+    5453:	ff 73 08             	push   0x8(%ebx)
+    5456:	e8 f5 09 00 00       	call   5e50 <free>
+    545b:	83 c4 10             	add    $0x10,%esp
+    545e:	eb 98                	jmp    53f8 <fclose+0x38>
+
+00005460 <fflush>:
+{
+    5460:	55                   	push   %ebp
+    5461:	89 e5                	mov    %esp,%ebp
+    5463:	53                   	push   %ebx
+    5464:	83 ec 14             	sub    $0x14,%esp
+    5467:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f == 0){
+    546a:	85 db                	test   %ebx,%ebx
+    546c:	74 5a                	je     54c8 <fflush+0x68>
+  if(threaded)
+    546e:	8b 0d 00 e3 00 00    	mov    0xe300,%ecx
+    5474:	85 c9                	test   %ecx,%ecx
+    5476:	75 18                	jne    5490 <fflush+0x30>
+  r = flush(f);
+    5478:	89 d8                	mov    %ebx,%eax
+    547a:	e8 81 fb ff ff       	call   5000 <flush>
+  if(threaded)
+    547f:	8b 15 00 e3 00 00    	mov    0xe300,%edx
+    5485:	85 d2                	test   %edx,%edx
+    5487:	75 1f                	jne    54a8 <fflush+0x48>
+}
+    5489:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    548c:	c9                   	leave
+    548d:	c3                   	ret
+    548e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    5490:	83 ec 0c             	sub    $0xc,%esp
+    5493:	8d 43 18             	lea    0x18(%ebx),%eax
+    5496:	50                   	push   %eax
+    5497:	e8 a4 f4 ff ff       	call   4940 <mutex_lock>
+    549c:	83 c4 10             	add    $0x10,%esp
+    549f:	eb d7                	jmp    5478 <fflush+0x18>
+    54a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    54a8:	83 ec 0c             	sub    $0xc,%esp
+    54ab:	83 c3 18             	add    $0x18,%ebx
+    54ae:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    54b1:	53                   	push   %ebx
+    54b2:	e8 d9 f4 ff ff       	call   4990 <mutex_unlock>
+    54b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    54ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    mutex_unlock(&f->lock);
+    54bd:	83 c4 10             	add    $0x10,%esp
+}
+    54c0:	c9                   	leave
+    54c1:	c3                   	ret
+    54c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    54c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    54cb:	c9                   	leave
+    54cc:	e9 af fb ff ff       	jmp    5080 <fflush.part.0>
+    54d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    54d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    54df:	90                   	nop
+
+000054e0 <putc_unlocked>:
+{
+    54e0:	55                   	push   %ebp
+    54e1:	89 e5                	mov    %esp,%ebp
+    54e3:	56                   	push   %esi
+    54e4:	53                   	push   %ebx
+    54e5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    54e8:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(!(f->flags & IO_WRITE))
+    54eb:	8b 43 04             	mov    0x4(%ebx),%eax
+    54ee:	a8 02                	test   $0x2,%al
+    54f0:	74 46                	je     5538 <putc_unlocked+0x58>
+  if(!(f->flags & IO_SETUP))
+    54f2:	a8 40                	test   $0x40,%al
+    54f4:	74 4a                	je     5540 <putc_unlocked+0x60>
+  if(f->n == f->size && flush(f) < 0)
+    54f6:	8b 43 14             	mov    0x14(%ebx),%eax
+    54f9:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    54fc:	74 51                	je     554f <putc_unlocked+0x6f>
+  f->buf[f->n++] = c;
+    54fe:	8d 48 01             	lea    0x1(%eax),%ecx
+    5501:	8b 53 08             	mov    0x8(%ebx),%edx
+    5504:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    5507:	89 f1                	mov    %esi,%ecx
+    5509:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    550c:	83 fe 0a             	cmp    $0xa,%esi
+    550f:	74 0f                	je     5520 <putc_unlocked+0x40>
+  return c & 0xff;
+    5511:	89 f0                	mov    %esi,%eax
+    5513:	0f b6 c0             	movzbl %al,%eax
+}
+    5516:	5b                   	pop    %ebx
+    5517:	5e                   	pop    %esi
+    5518:	5d                   	pop    %ebp
+    5519:	c3                   	ret
+    551a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    5520:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    5524:	74 eb                	je     5511 <putc_unlocked+0x31>
+    5526:	89 d8                	mov    %ebx,%eax
+    5528:	e8 d3 fa ff ff       	call   5000 <flush>
+    552d:	85 c0                	test   %eax,%eax
+    552f:	79 e0                	jns    5511 <putc_unlocked+0x31>
+    5531:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return EOF;
+    5538:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    553d:	eb d7                	jmp    5516 <putc_unlocked+0x36>
+    553f:	90                   	nop
+    setup(f);
+    5540:	89 d8                	mov    %ebx,%eax
+    5542:	e8 69 fa ff ff       	call   4fb0 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    5547:	8b 43 14             	mov    0x14(%ebx),%eax
+    554a:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    554d:	75 af                	jne    54fe <putc_unlocked+0x1e>
+    554f:	89 d8                	mov    %ebx,%eax
+    5551:	e8 aa fa ff ff       	call   5000 <flush>
+    5556:	85 c0                	test   %eax,%eax
+    5558:	78 de                	js     5538 <putc_unlocked+0x58>
+  f->buf[f->n++] = c;
+    555a:	8b 43 14             	mov    0x14(%ebx),%eax
+    555d:	eb 9f                	jmp    54fe <putc_unlocked+0x1e>
+    555f:	90                   	nop
+
+00005560 <fputc>:
+{
+    5560:	55                   	push   %ebp
+    5561:	89 e5                	mov    %esp,%ebp
+    5563:	56                   	push   %esi
+    5564:	53                   	push   %ebx
+  if(threaded)
+    5565:	8b 15 00 e3 00 00    	mov    0xe300,%edx
+{
+    556b:	8b 75 08             	mov    0x8(%ebp),%esi
+    556e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(threaded)
+    5571:	85 d2                	test   %edx,%edx
+    5573:	75 6b                	jne    55e0 <fputc+0x80>
+  if(!(f->flags & IO_WRITE))
+    5575:	8b 43 04             	mov    0x4(%ebx),%eax
+    5578:	a8 02                	test   $0x2,%al
+    557a:	0f 84 b8 00 00 00    	je     5638 <fputc+0xd8>
+  if(!(f->flags & IO_SETUP))
+    5580:	a8 40                	test   $0x40,%al
+    5582:	74 76                	je     55fa <fputc+0x9a>
+  if(f->n == f->size && flush(f) < 0)
+    5584:	8b 43 14             	mov    0x14(%ebx),%eax
+    5587:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    558a:	74 7d                	je     5609 <fputc+0xa9>
+  f->buf[f->n++] = c;
+    558c:	8d 48 01             	lea    0x1(%eax),%ecx
+    558f:	8b 53 08             	mov    0x8(%ebx),%edx
+    5592:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    5595:	89 f1                	mov    %esi,%ecx
+    5597:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    559a:	83 fe 0a             	cmp    $0xa,%esi
+    559d:	74 21                	je     55c0 <fputc+0x60>
+  return c & 0xff;
+    559f:	89 f0                	mov    %esi,%eax
+    55a1:	0f b6 f0             	movzbl %al,%esi
+  if(threaded)
+    55a4:	a1 00 e3 00 00       	mov    0xe300,%eax
+    55a9:	85 c0                	test   %eax,%eax
+    55ab:	75 73                	jne    5620 <fputc+0xc0>
+}
+    55ad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    55b0:	89 f0                	mov    %esi,%eax
+    55b2:	5b                   	pop    %ebx
+    55b3:	5e                   	pop    %esi
+    55b4:	5d                   	pop    %ebp
+    55b5:	c3                   	ret
+    55b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    55bd:	8d 76 00             	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    55c0:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    55c4:	74 d9                	je     559f <fputc+0x3f>
+    55c6:	89 d8                	mov    %ebx,%eax
+    55c8:	e8 33 fa ff ff       	call   5000 <flush>
+    55cd:	85 c0                	test   %eax,%eax
+    55cf:	79 ce                	jns    559f <fputc+0x3f>
+    return EOF;
+    55d1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    55d6:	eb cc                	jmp    55a4 <fputc+0x44>
+    55d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    55df:	90                   	nop
+    mutex_lock(&f->lock);
+    55e0:	83 ec 0c             	sub    $0xc,%esp
+    55e3:	8d 43 18             	lea    0x18(%ebx),%eax
+    55e6:	50                   	push   %eax
+    55e7:	e8 54 f3 ff ff       	call   4940 <mutex_lock>
+  if(!(f->flags & IO_WRITE))
+    55ec:	8b 43 04             	mov    0x4(%ebx),%eax
+    55ef:	83 c4 10             	add    $0x10,%esp
+    55f2:	a8 02                	test   $0x2,%al
+    55f4:	74 db                	je     55d1 <fputc+0x71>
+  if(!(f->flags & IO_SETUP))
+    55f6:	a8 40                	test   $0x40,%al
+    55f8:	75 8a                	jne    5584 <fputc+0x24>
+    setup(f);
+    55fa:	89 d8                	mov    %ebx,%eax
+    55fc:	e8 af f9 ff ff       	call   4fb0 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    5601:	8b 43 14             	mov    0x14(%ebx),%eax
+    5604:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    5607:	75 83                	jne    558c <fputc+0x2c>
+    5609:	89 d8                	mov    %ebx,%eax
+    560b:	e8 f0 f9 ff ff       	call   5000 <flush>
+    5610:	85 c0                	test   %eax,%eax
+    5612:	78 bd                	js     55d1 <fputc+0x71>
+  f->buf[f->n++] = c;
+    5614:	8b 43 14             	mov    0x14(%ebx),%eax
+    5617:	e9 70 ff ff ff       	jmp    558c <fputc+0x2c>
+    561c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    5620:	83 ec 0c             	sub    $0xc,%esp
+    5623:	83 c3 18             	add    $0x18,%ebx
+    5626:	53                   	push   %ebx
+    5627:	e8 64 f3 ff ff       	call   4990 <mutex_unlock>
+    562c:	83 c4 10             	add    $0x10,%esp
+}
+    562f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    5632:	89 f0                	mov    %esi,%eax
+    5634:	5b                   	pop    %ebx
+    5635:	5e                   	pop    %esi
+    5636:	5d                   	pop    %ebp
+    5637:	c3                   	ret
+    return EOF;
+    5638:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    563d:	e9 6b ff ff ff       	jmp    55ad <fputc+0x4d>
+    5642:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5649:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00005650 <fwrite>:
+{
+    5650:	55                   	push   %ebp
+    5651:	89 e5                	mov    %esp,%ebp
+    5653:	57                   	push   %edi
+    5654:	56                   	push   %esi
+    5655:	53                   	push   %ebx
+    5656:	83 ec 1c             	sub    $0x1c,%esp
+    5659:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  if(!(f->flags & IO_WRITE) || size <= 0)
+    565c:	8b 43 04             	mov    0x4(%ebx),%eax
+    565f:	a8 02                	test   $0x2,%al
+    5661:	0f 84 ec 00 00 00    	je     5753 <fwrite+0x103>
+    5667:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    566a:	85 c9                	test   %ecx,%ecx
+    566c:	0f 8e e1 00 00 00    	jle    5753 <fwrite+0x103>
+  if(threaded)
+    5672:	8b 15 00 e3 00 00    	mov    0xe300,%edx
+    5678:	85 d2                	test   %edx,%edx
+    567a:	0f 85 1c 01 00 00    	jne    579c <fwrite+0x14c>
+  if(!(f->flags & IO_SETUP))
+    5680:	a8 40                	test   $0x40,%al
+    5682:	0f 84 08 01 00 00    	je     5790 <fwrite+0x140>
+  for(len = size*nmemb; len > 0; len -= n){
+    5688:	8b 45 0c             	mov    0xc(%ebp),%eax
+    568b:	0f af 45 10          	imul   0x10(%ebp),%eax
+    568f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    5692:	85 c0                	test   %eax,%eax
+    5694:	0f 8e 2a 01 00 00    	jle    57c4 <fwrite+0x174>
+  s = p;
+    569a:	8b 45 08             	mov    0x8(%ebp),%eax
+  nl = 0;
+    569d:	31 ff                	xor    %edi,%edi
+    569f:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+        nl = 1;
+    56a2:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  s = p;
+    56a5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    56a8:	8b 43 14             	mov    0x14(%ebx),%eax
+        nl = 1;
+    56ab:	89 ce                	mov    %ecx,%esi
+    if(f->n == f->size && flush(f) < 0)
+    56ad:	89 c2                	mov    %eax,%edx
+    56af:	39 f0                	cmp    %esi,%eax
+    56b1:	74 6e                	je     5721 <fwrite+0xd1>
+    56b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    56b7:	90                   	nop
+    if(n > len)
+    56b8:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    n = f->size - f->n;
+    56bb:	89 f1                	mov    %esi,%ecx
+    56bd:	29 c1                	sub    %eax,%ecx
+    56bf:	39 f9                	cmp    %edi,%ecx
+    56c1:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    56c4:	85 c9                	test   %ecx,%ecx
+    56c6:	0f 8e 7c 00 00 00    	jle    5748 <fwrite+0xf8>
+    56cc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    56cf:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    56d2:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    56d5:	8d 34 08             	lea    (%eax,%ecx,1),%esi
+    56d8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    56db:	eb 06                	jmp    56e3 <fwrite+0x93>
+    56dd:	8d 76 00             	lea    0x0(%esi),%esi
+      if((f->buf[f->n++] = s[i]) == '\n')
+    56e0:	8b 53 14             	mov    0x14(%ebx),%edx
+    56e3:	8d 4a 01             	lea    0x1(%edx),%ecx
+    56e6:	8b 73 08             	mov    0x8(%ebx),%esi
+    56e9:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    56ec:	0f b6 08             	movzbl (%eax),%ecx
+        nl = 1;
+    56ef:	80 f9 0a             	cmp    $0xa,%cl
+      if((f->buf[f->n++] = s[i]) == '\n')
+    56f2:	88 0c 16             	mov    %cl,(%esi,%edx,1)
+        nl = 1;
+    56f5:	be 01 00 00 00       	mov    $0x1,%esi
+    56fa:	0f 44 fe             	cmove  %esi,%edi
+    for(i = 0; i < n; i++)
+    56fd:	83 c0 01             	add    $0x1,%eax
+    5700:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    5703:	75 db                	jne    56e0 <fwrite+0x90>
+    s += n;
+    5705:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    5708:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    570b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    s += n;
+    570e:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    5711:	85 c0                	test   %eax,%eax
+    5713:	7e 48                	jle    575d <fwrite+0x10d>
+    5715:	8b 43 14             	mov    0x14(%ebx),%eax
+    5718:	8b 73 0c             	mov    0xc(%ebx),%esi
+    if(f->n == f->size && flush(f) < 0)
+    571b:	89 c2                	mov    %eax,%edx
+    571d:	39 f0                	cmp    %esi,%eax
+    571f:	75 97                	jne    56b8 <fwrite+0x68>
+    5721:	89 d8                	mov    %ebx,%eax
+    5723:	e8 d8 f8 ff ff       	call   5000 <flush>
+    5728:	85 c0                	test   %eax,%eax
+    572a:	78 31                	js     575d <fwrite+0x10d>
+    n = f->size - f->n;
+    572c:	8b 73 0c             	mov    0xc(%ebx),%esi
+    572f:	8b 43 14             	mov    0x14(%ebx),%eax
+    5732:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    5735:	89 f1                	mov    %esi,%ecx
+    5737:	89 c2                	mov    %eax,%edx
+    5739:	29 c1                	sub    %eax,%ecx
+    573b:	39 f9                	cmp    %edi,%ecx
+    573d:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    5740:	85 c9                	test   %ecx,%ecx
+    5742:	7f 88                	jg     56cc <fwrite+0x7c>
+    5744:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    s += n;
+    5748:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    574b:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    574e:	e9 5a ff ff ff       	jmp    56ad <fwrite+0x5d>
+}
+    5753:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    5756:	31 c0                	xor    %eax,%eax
+}
+    5758:	5b                   	pop    %ebx
+    5759:	5e                   	pop    %esi
+    575a:	5f                   	pop    %edi
+    575b:	5d                   	pop    %ebp
+    575c:	c3                   	ret
+  if(nl && (f->flags & IO_LINE))
+    575d:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    5760:	85 ff                	test   %edi,%edi
+    5762:	74 06                	je     576a <fwrite+0x11a>
+    5764:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    5768:	75 1d                	jne    5787 <fwrite+0x137>
+  return (s - (const char*)p) / size;
+    576a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    576d:	2b 75 08             	sub    0x8(%ebp),%esi
+  if(threaded)
+    5770:	a1 00 e3 00 00       	mov    0xe300,%eax
+    5775:	85 c0                	test   %eax,%eax
+    5777:	75 3a                	jne    57b3 <fwrite+0x163>
+  return (s - (const char*)p) / size;
+    5779:	89 f0                	mov    %esi,%eax
+    577b:	99                   	cltd
+    577c:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    577f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    5782:	5b                   	pop    %ebx
+    5783:	5e                   	pop    %esi
+    5784:	5f                   	pop    %edi
+    5785:	5d                   	pop    %ebp
+    5786:	c3                   	ret
+    flush(f);
+    5787:	89 d8                	mov    %ebx,%eax
+    5789:	e8 72 f8 ff ff       	call   5000 <flush>
+    578e:	eb da                	jmp    576a <fwrite+0x11a>
+    setup(f);
+    5790:	89 d8                	mov    %ebx,%eax
+    5792:	e8 19 f8 ff ff       	call   4fb0 <setup>
+    5797:	e9 ec fe ff ff       	jmp    5688 <fwrite+0x38>
+    mutex_lock(&f->lock);
+    579c:	83 ec 0c             	sub    $0xc,%esp
+    579f:	8d 43 18             	lea    0x18(%ebx),%eax
+    57a2:	50                   	push   %eax
+    57a3:	e8 98 f1 ff ff       	call   4940 <mutex_lock>
+  if(!(f->flags & IO_SETUP))
+    57a8:	8b 43 04             	mov    0x4(%ebx),%eax
+    57ab:	83 c4 10             	add    $0x10,%esp
+    57ae:	e9 cd fe ff ff       	jmp    5680 <fwrite+0x30>
+    mutex_unlock(&f->lock);
+    57b3:	83 ec 0c             	sub    $0xc,%esp
+    57b6:	83 c3 18             	add    $0x18,%ebx
+    57b9:	53                   	push   %ebx
+    57ba:	e8 d1 f1 ff ff       	call   4990 <mutex_unlock>
+    57bf:	83 c4 10             	add    $0x10,%esp
+    57c2:	eb b5                	jmp    5779 <fwrite+0x129>
+  for(len = size*nmemb; len > 0; len -= n){
+    57c4:	31 f6                	xor    %esi,%esi
+    57c6:	eb a8                	jmp    5770 <fwrite+0x120>
+    57c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    57cf:	90                   	nop
+
+000057d0 <fgetc>:
+  return f->buf[f->r++] & 0xff;
+}
+
+int
+fgetc(FILE *f)
+{
+    57d0:	55                   	push   %ebp
+    57d1:	89 e5                	mov    %esp,%ebp
+    57d3:	56                   	push   %esi
+    57d4:	53                   	push   %ebx
+  if(threaded)
+    57d5:	8b 15 00 e3 00 00    	mov    0xe300,%edx
+{
+    57db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    57de:	85 d2                	test   %edx,%edx
+    57e0:	75 2e                	jne    5810 <fgetc+0x40>
+  if(!(f->flags & IO_READ))
+    57e2:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    57e6:	74 78                	je     5860 <fgetc+0x90>
+  if(f->r == f->n && fill(f) == 0)
+    57e8:	8b 43 10             	mov    0x10(%ebx),%eax
+    57eb:	3b 43 14             	cmp    0x14(%ebx),%eax
+    57ee:	74 60                	je     5850 <fgetc+0x80>
+  return f->buf[f->r++] & 0xff;
+    57f0:	8b 53 08             	mov    0x8(%ebx),%edx
+    57f3:	8d 48 01             	lea    0x1(%eax),%ecx
+    57f6:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    57f9:	0f b6 34 02          	movzbl (%edx,%eax,1),%esi
+  if(threaded)
+    57fd:	a1 00 e3 00 00       	mov    0xe300,%eax
+    5802:	85 c0                	test   %eax,%eax
+    5804:	75 2a                	jne    5830 <fgetc+0x60>
+
+  flockfile(f);
+  c = getc_unlocked(f);
+  funlockfile(f);
+  return c;
+}
+    5806:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    5809:	89 f0                	mov    %esi,%eax
+    580b:	5b                   	pop    %ebx
+    580c:	5e                   	pop    %esi
+    580d:	5d                   	pop    %ebp
+    580e:	c3                   	ret
+    580f:	90                   	nop
+    mutex_lock(&f->lock);
+    5810:	83 ec 0c             	sub    $0xc,%esp
+    5813:	8d 43 18             	lea    0x18(%ebx),%eax
+    5816:	50                   	push   %eax
+    5817:	e8 24 f1 ff ff       	call   4940 <mutex_lock>
+  if(!(f->flags & IO_READ))
+    581c:	83 c4 10             	add    $0x10,%esp
+    581f:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    5823:	75 c3                	jne    57e8 <fgetc+0x18>
+    return EOF;
+    5825:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    582a:	eb d1                	jmp    57fd <fgetc+0x2d>
+    582c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    5830:	83 ec 0c             	sub    $0xc,%esp
+    5833:	83 c3 18             	add    $0x18,%ebx
+    5836:	53                   	push   %ebx
+    5837:	e8 54 f1 ff ff       	call   4990 <mutex_unlock>
+    583c:	83 c4 10             	add    $0x10,%esp
+}
+    583f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    5842:	89 f0                	mov    %esi,%eax
+    5844:	5b                   	pop    %ebx
+    5845:	5e                   	pop    %esi
+    5846:	5d                   	pop    %ebp
+    5847:	c3                   	ret
+    5848:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    584f:	90                   	nop
+  if(f->r == f->n && fill(f) == 0)
+    5850:	89 d8                	mov    %ebx,%eax
+    5852:	e8 c9 f8 ff ff       	call   5120 <fill>
+    5857:	85 c0                	test   %eax,%eax
+    5859:	74 ca                	je     5825 <fgetc+0x55>
+  return f->buf[f->r++] & 0xff;
+    585b:	8b 43 10             	mov    0x10(%ebx),%eax
+    585e:	eb 90                	jmp    57f0 <fgetc+0x20>
+    return EOF;
+    5860:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    5865:	eb 9f                	jmp    5806 <fgetc+0x36>
+    5867:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    586e:	66 90                	xchg   %ax,%ax
+
+00005870 <fread>:
+
+int
+fread(void *p, int size, int nmemb, FILE *f)
+{
+    5870:	55                   	push   %ebp
+    5871:	89 e5                	mov    %esp,%ebp
+    5873:	57                   	push   %edi
+    5874:	56                   	push   %esi
+    5875:	53                   	push   %ebx
+    5876:	83 ec 1c             	sub    $0x1c,%esp
+    5879:	8b 75 14             	mov    0x14(%ebp),%esi
+  char *d;
+  int n, len;
+
+  if(!(f->flags & IO_READ) || size <= 0)
+    587c:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+    5880:	74 7e                	je     5900 <fread+0x90>
+    5882:	8b 55 0c             	mov    0xc(%ebp),%edx
+    5885:	85 d2                	test   %edx,%edx
+    5887:	7e 77                	jle    5900 <fread+0x90>
+  if(threaded)
+    5889:	a1 00 e3 00 00       	mov    0xe300,%eax
+    return 0;
+  flockfile(f);
+  d = p;
+  for(len = size*nmemb; len > 0; len -= n){
+    588e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    5891:	0f af 7d 10          	imul   0x10(%ebp),%edi
+  if(threaded)
+    5895:	85 c0                	test   %eax,%eax
+    5897:	0f 85 93 00 00 00    	jne    5930 <fread+0xc0>
+  for(len = size*nmemb; len > 0; len -= n){
+    589d:	85 ff                	test   %edi,%edi
+    589f:	7e 61                	jle    5902 <fread+0x92>
+    if(f->r == f->n && fill(f) == 0)
+    58a1:	8b 46 10             	mov    0x10(%esi),%eax
+  d = p;
+    58a4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    58a7:	eb 35                	jmp    58de <fread+0x6e>
+    58a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      break;
+    n = f->n - f->r;
+    58b0:	29 c3                	sub    %eax,%ebx
+    58b2:	39 fb                	cmp    %edi,%ebx
+    58b4:	0f 4f df             	cmovg  %edi,%ebx
+    if(n > len)
+      n = len;
+    memmove(d, f->buf + f->r, n);
+    58b7:	83 ec 04             	sub    $0x4,%esp
+    58ba:	53                   	push   %ebx
+    58bb:	03 46 08             	add    0x8(%esi),%eax
+  for(len = size*nmemb; len > 0; len -= n){
+    58be:	29 df                	sub    %ebx,%edi
+    memmove(d, f->buf + f->r, n);
+    58c0:	50                   	push   %eax
+    58c1:	51                   	push   %ecx
+    58c2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    58c5:	e8 36 f0 ff ff       	call   4900 <memmove>
+    f->r += n;
+    58ca:	8b 46 10             	mov    0x10(%esi),%eax
+    d += n;
+    58cd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    58d0:	83 c4 10             	add    $0x10,%esp
+    f->r += n;
+    58d3:	01 d8                	add    %ebx,%eax
+    d += n;
+    58d5:	01 d9                	add    %ebx,%ecx
+    f->r += n;
+    58d7:	89 46 10             	mov    %eax,0x10(%esi)
+  for(len = size*nmemb; len > 0; len -= n){
+    58da:	85 ff                	test   %edi,%edi
+    58dc:	7e 32                	jle    5910 <fread+0xa0>
+    if(f->r == f->n && fill(f) == 0)
+    58de:	8b 5e 14             	mov    0x14(%esi),%ebx
+    58e1:	39 c3                	cmp    %eax,%ebx
+    58e3:	75 cb                	jne    58b0 <fread+0x40>
+    58e5:	89 f0                	mov    %esi,%eax
+    58e7:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    58ea:	e8 31 f8 ff ff       	call   5120 <fill>
+    58ef:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    58f2:	85 c0                	test   %eax,%eax
+    58f4:	74 1a                	je     5910 <fread+0xa0>
+    n = f->n - f->r;
+    58f6:	8b 5e 14             	mov    0x14(%esi),%ebx
+    58f9:	8b 46 10             	mov    0x10(%esi),%eax
+    58fc:	eb b2                	jmp    58b0 <fread+0x40>
+    58fe:	66 90                	xchg   %ax,%ax
+    return 0;
+    5900:	31 c0                	xor    %eax,%eax
+  }
+  funlockfile(f);
+  return (d - (char*)p) / size;
+}
+    5902:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    5905:	5b                   	pop    %ebx
+    5906:	5e                   	pop    %esi
+    5907:	5f                   	pop    %edi
+    5908:	5d                   	pop    %ebp
+    5909:	c3                   	ret
+    590a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (d - (char*)p) / size;
+    5910:	2b 4d 08             	sub    0x8(%ebp),%ecx
+    5913:	89 cb                	mov    %ecx,%ebx
+  if(threaded)
+    5915:	a1 00 e3 00 00       	mov    0xe300,%eax
+    591a:	85 c0                	test   %eax,%eax
+    591c:	75 32                	jne    5950 <fread+0xe0>
+  return (d - (char*)p) / size;
+    591e:	89 d8                	mov    %ebx,%eax
+    5920:	99                   	cltd
+    5921:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    5924:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    5927:	5b                   	pop    %ebx
+    5928:	5e                   	pop    %esi
+    5929:	5f                   	pop    %edi
+    592a:	5d                   	pop    %ebp
+    592b:	c3                   	ret
+    592c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    5930:	83 ec 0c             	sub    $0xc,%esp
+    5933:	8d 46 18             	lea    0x18(%esi),%eax
+    5936:	50                   	push   %eax
+    5937:	e8 04 f0 ff ff       	call   4940 <mutex_lock>
+  for(len = size*nmemb; len > 0; len -= n){
+    593c:	83 c4 10             	add    $0x10,%esp
+    593f:	85 ff                	test   %edi,%edi
+    5941:	0f 8f 5a ff ff ff    	jg     58a1 <fread+0x31>
+    5947:	31 db                	xor    %ebx,%ebx
+    5949:	eb ca                	jmp    5915 <fread+0xa5>
+    594b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    594f:	90                   	nop
+    mutex_unlock(&f->lock);
+    5950:	83 ec 0c             	sub    $0xc,%esp
+    5953:	83 c6 18             	add    $0x18,%esi
+    5956:	56                   	push   %esi
+    5957:	e8 34 f0 ff ff       	call   4990 <mutex_unlock>
+  return (d - (char*)p) / size;
+    595c:	89 d8                	mov    %ebx,%eax
+    595e:	83 c4 10             	add    $0x10,%esp
+    5961:	99                   	cltd
+    5962:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    5965:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    5968:	5b                   	pop    %ebx
+    5969:	5e                   	pop    %esi
+    596a:	5f                   	pop    %edi
+    596b:	5d                   	pop    %ebp
+    596c:	c3                   	ret
+    596d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00005970 <fgets>:
+
+// Read a line of at most max-1 bytes, keeping the newline.
+// Returns 0 if there was nothing left to read.
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    5970:	55                   	push   %ebp
+    5971:	89 e5                	mov    %esp,%ebp
+    5973:	57                   	push   %edi
+    5974:	56                   	push   %esi
+    5975:	53                   	push   %ebx
+    5976:	83 ec 1c             	sub    $0x1c,%esp
+  if(threaded)
+    5979:	8b 35 00 e3 00 00    	mov    0xe300,%esi
+{
+    597f:	8b 7d 08             	mov    0x8(%ebp),%edi
+    5982:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if(threaded)
+    5985:	85 f6                	test   %esi,%esi
+    5987:	0f 85 83 00 00 00    	jne    5a10 <fgets+0xa0>
+{
+    598d:	31 f6                	xor    %esi,%esi
+    598f:	eb 2a                	jmp    59bb <fgets+0x4b>
+    5991:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return f->buf[f->r++] & 0xff;
+    5998:	8b 53 08             	mov    0x8(%ebx),%edx
+    599b:	8d 48 01             	lea    0x1(%eax),%ecx
+    599e:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    59a1:	0f b6 14 02          	movzbl (%edx,%eax,1),%edx
+
+  flockfile(f);
+  for(i = 0; i+1 < max; ){
+    if((c = getc_unlocked(f)) == EOF)
+      break;
+    buf[i++] = c;
+    59a5:	88 54 37 ff          	mov    %dl,-0x1(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    59a9:	80 fa 0a             	cmp    $0xa,%dl
+    59ac:	0f 84 96 00 00 00    	je     5a48 <fgets+0xd8>
+    59b2:	83 fa 0d             	cmp    $0xd,%edx
+    59b5:	0f 84 8d 00 00 00    	je     5a48 <fgets+0xd8>
+  for(i = 0; i+1 < max; ){
+    59bb:	89 f2                	mov    %esi,%edx
+    59bd:	83 c6 01             	add    $0x1,%esi
+    59c0:	3b 75 0c             	cmp    0xc(%ebp),%esi
+    59c3:	7d 2b                	jge    59f0 <fgets+0x80>
+  if(!(f->flags & IO_READ))
+    59c5:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    59c9:	74 25                	je     59f0 <fgets+0x80>
+  if(f->r == f->n && fill(f) == 0)
+    59cb:	8b 43 10             	mov    0x10(%ebx),%eax
+    59ce:	3b 43 14             	cmp    0x14(%ebx),%eax
+    59d1:	75 c5                	jne    5998 <fgets+0x28>
+    59d3:	89 d8                	mov    %ebx,%eax
+    59d5:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    59d8:	e8 43 f7 ff ff       	call   5120 <fill>
+    59dd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    59e0:	85 c0                	test   %eax,%eax
+    59e2:	74 0c                	je     59f0 <fgets+0x80>
+  return f->buf[f->r++] & 0xff;
+    59e4:	8b 43 10             	mov    0x10(%ebx),%eax
+    59e7:	eb af                	jmp    5998 <fgets+0x28>
+    59e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    59f0:	8b 0d 00 e3 00 00    	mov    0xe300,%ecx
+      break;
+  }
+  buf[i] = '\0';
+    59f6:	c6 04 17 00          	movb   $0x0,(%edi,%edx,1)
+  if(threaded)
+    59fa:	85 c9                	test   %ecx,%ecx
+    59fc:	75 2a                	jne    5a28 <fgets+0xb8>
+  funlockfile(f);
+  return i > 0 ? buf : 0;
+    59fe:	31 c0                	xor    %eax,%eax
+    5a00:	85 d2                	test   %edx,%edx
+    5a02:	74 02                	je     5a06 <fgets+0x96>
+    5a04:	89 f8                	mov    %edi,%eax
+}
+    5a06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    5a09:	5b                   	pop    %ebx
+    5a0a:	5e                   	pop    %esi
+    5a0b:	5f                   	pop    %edi
+    5a0c:	5d                   	pop    %ebp
+    5a0d:	c3                   	ret
+    5a0e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    5a10:	83 ec 0c             	sub    $0xc,%esp
+    5a13:	8d 43 18             	lea    0x18(%ebx),%eax
+    5a16:	50                   	push   %eax
+    5a17:	e8 24 ef ff ff       	call   4940 <mutex_lock>
+    5a1c:	83 c4 10             	add    $0x10,%esp
+    5a1f:	e9 69 ff ff ff       	jmp    598d <fgets+0x1d>
+    5a24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    5a28:	83 ec 0c             	sub    $0xc,%esp
+    5a2b:	83 c3 18             	add    $0x18,%ebx
+    5a2e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    5a31:	53                   	push   %ebx
+    5a32:	e8 59 ef ff ff       	call   4990 <mutex_unlock>
+    5a37:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    5a3a:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    5a3d:	31 c0                	xor    %eax,%eax
+    5a3f:	85 d2                	test   %edx,%edx
+    5a41:	75 c1                	jne    5a04 <fgets+0x94>
+    5a43:	eb c1                	jmp    5a06 <fgets+0x96>
+    5a45:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    5a48:	a1 00 e3 00 00       	mov    0xe300,%eax
+  buf[i] = '\0';
+    5a4d:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  if(threaded)
+    5a51:	85 c0                	test   %eax,%eax
+    5a53:	74 af                	je     5a04 <fgets+0x94>
+    mutex_unlock(&f->lock);
+    5a55:	83 ec 0c             	sub    $0xc,%esp
+    5a58:	83 c3 18             	add    $0x18,%ebx
+    5a5b:	53                   	push   %ebx
+    5a5c:	e8 2f ef ff ff       	call   4990 <mutex_unlock>
+    5a61:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    5a64:	89 f8                	mov    %edi,%eax
+    5a66:	eb 9e                	jmp    5a06 <fgets+0x96>
+    5a68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5a6f:	90                   	nop
+
+00005a70 <gets>:
+// at most a line per read(), goes through stdin's buffer: from a
+// file or pipe, a buffered read could take input meant for a child
+// process, so read a byte at a time.
+char*
+gets(char *buf, int max)
+{
+    5a70:	55                   	push   %ebp
+    5a71:	89 e5                	mov    %esp,%ebp
+    5a73:	57                   	push   %edi
+    5a74:	56                   	push   %esi
+    5a75:	53                   	push   %ebx
+    5a76:	83 ec 2c             	sub    $0x2c,%esp
+  int i, cc;
+  char c;
+
+  if(!(stdin->flags & IO_SETUP))
+    5a79:	8b 15 44 92 00 00    	mov    0x9244,%edx
+{
+    5a7f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!(stdin->flags & IO_SETUP))
+    5a82:	f6 c2 40             	test   $0x40,%dl
+    5a85:	74 79                	je     5b00 <gets+0x90>
+    setup(stdin);
+  if(stdin->flags & IO_DEV){
+    5a87:	83 e2 20             	and    $0x20,%edx
+    5a8a:	89 d7                	mov    %edx,%edi
+    5a8c:	75 52                	jne    5ae0 <gets+0x70>
+  if(f == 0){
+    5a8e:	e8 ed f5 ff ff       	call   5080 <fflush.part.0>
+    fgets(buf, max, stdin);
+    return buf;
+  }
+  fflush(0);
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    5a93:	8d 75 e7             	lea    -0x19(%ebp),%esi
+  for(i=0; i+1 < max; ){
+    5a96:	eb 2c                	jmp    5ac4 <gets+0x54>
+    5a98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5a9f:	90                   	nop
+    cc = read(0, &c, 1);
+    5aa0:	83 ec 04             	sub    $0x4,%esp
+    5aa3:	6a 01                	push   $0x1
+    5aa5:	56                   	push   %esi
+    5aa6:	6a 00                	push   $0x0
+    5aa8:	e8 f5 ef ff ff       	call   4aa2 <read>
+    if(cc < 1)
+    5aad:	83 c4 10             	add    $0x10,%esp
+    5ab0:	85 c0                	test   %eax,%eax
+    5ab2:	7e 1b                	jle    5acf <gets+0x5f>
+      break;
+    buf[i++] = c;
+    5ab4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    5ab8:	88 44 3b ff          	mov    %al,-0x1(%ebx,%edi,1)
+    if(c == '\n' || c == '\r')
+    5abc:	3c 0a                	cmp    $0xa,%al
+    5abe:	74 12                	je     5ad2 <gets+0x62>
+    5ac0:	3c 0d                	cmp    $0xd,%al
+    5ac2:	74 0e                	je     5ad2 <gets+0x62>
+  for(i=0; i+1 < max; ){
+    5ac4:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    5ac7:	83 c7 01             	add    $0x1,%edi
+    5aca:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+    5acd:	7c d1                	jl     5aa0 <gets+0x30>
+{
+    5acf:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      break;
+  }
+  buf[i] = '\0';
+    5ad2:	c6 04 3b 00          	movb   $0x0,(%ebx,%edi,1)
+  return buf;
+}
+    5ad6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    5ad9:	89 d8                	mov    %ebx,%eax
+    5adb:	5b                   	pop    %ebx
+    5adc:	5e                   	pop    %esi
+    5add:	5f                   	pop    %edi
+    5ade:	5d                   	pop    %ebp
+    5adf:	c3                   	ret
+    fgets(buf, max, stdin);
+    5ae0:	83 ec 04             	sub    $0x4,%esp
+    5ae3:	68 40 92 00 00       	push   $0x9240
+    5ae8:	ff 75 0c             	push   0xc(%ebp)
+    5aeb:	53                   	push   %ebx
+    5aec:	e8 7f fe ff ff       	call   5970 <fgets>
+    return buf;
+    5af1:	83 c4 10             	add    $0x10,%esp
+}
+    5af4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    5af7:	89 d8                	mov    %ebx,%eax
+    5af9:	5b                   	pop    %ebx
+    5afa:	5e                   	pop    %esi
+    5afb:	5f                   	pop    %edi
+    5afc:	5d                   	pop    %ebp
+    5afd:	c3                   	ret
+    5afe:	66 90                	xchg   %ax,%ax
+    setup(stdin);
+    5b00:	b8 40 92 00 00       	mov    $0x9240,%eax
+    5b05:	e8 a6 f4 ff ff       	call   4fb0 <setup>
+  if(stdin->flags & IO_DEV){
+    5b0a:	8b 15 44 92 00 00    	mov    0x9244,%edx
+    5b10:	e9 72 ff ff ff       	jmp    5a87 <gets+0x17>
+    5b15:	66 90                	xchg   %ax,%ax
+    5b17:	66 90                	xchg   %ax,%ax
+    5b19:	66 90                	xchg   %ax,%ax
+    5b1b:	66 90                	xchg   %ax,%ax
+    5b1d:	66 90                	xchg   %ax,%ax
+    5b1f:	90                   	nop
+
+00005b20 <bigfree>:
+
+// Give a big block back to the first-fit list, and return the
+// free block that now holds it. Caller holds lock.
+static Header*
+bigfree(Header *bp)
+{
+    5b20:	55                   	push   %ebp
+    5b21:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    5b23:	a1 a4 e9 00 00       	mov    0xe9a4,%eax
+{
+    5b28:	89 e5                	mov    %esp,%ebp
+    5b2a:	56                   	push   %esi
+    5b2b:	53                   	push   %ebx
+    5b2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    5b30:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    5b32:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    5b34:	39 ca                	cmp    %ecx,%edx
+    5b36:	73 38                	jae    5b70 <bigfree+0x50>
+    5b38:	39 c1                	cmp    %eax,%ecx
+    5b3a:	72 04                	jb     5b40 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    5b3c:	39 c2                	cmp    %eax,%edx
+    5b3e:	72 f0                	jb     5b30 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    5b40:	8b 59 04             	mov    0x4(%ecx),%ebx
+    5b43:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    5b46:	39 f0                	cmp    %esi,%eax
+    5b48:	74 36                	je     5b80 <bigfree+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    5b4a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  freep = p;
+  if(p + p->s.size == bp){
+    5b4c:	8b 42 04             	mov    0x4(%edx),%eax
+    5b4f:	89 cb                	mov    %ecx,%ebx
+  freep = p;
+    5b51:	89 15 a4 e9 00 00    	mov    %edx,0xe9a4
+  if(p + p->s.size == bp){
+    5b57:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    5b5a:	39 f1                	cmp    %esi,%ecx
+    5b5c:	74 2e                	je     5b8c <bigfree+0x6c>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    5b5e:	89 1a                	mov    %ebx,(%edx)
+    return p;
+  }
+  p->s.ptr = bp;
+  return bp;
+}
+    5b60:	89 c8                	mov    %ecx,%eax
+    5b62:	5b                   	pop    %ebx
+    5b63:	5e                   	pop    %esi
+    5b64:	5d                   	pop    %ebp
+    5b65:	c3                   	ret
+    5b66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5b6d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    5b70:	39 c1                	cmp    %eax,%ecx
+    5b72:	72 c8                	jb     5b3c <bigfree+0x1c>
+    5b74:	eb ba                	jmp    5b30 <bigfree+0x10>
+    5b76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5b7d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    5b80:	03 58 04             	add    0x4(%eax),%ebx
+    5b83:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    5b86:	8b 02                	mov    (%edx),%eax
+    5b88:	8b 00                	mov    (%eax),%eax
+    5b8a:	eb be                	jmp    5b4a <bigfree+0x2a>
+    p->s.size += bp->s.size;
+    5b8c:	03 41 04             	add    0x4(%ecx),%eax
+    5b8f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    5b92:	8b 19                	mov    (%ecx),%ebx
+    return p;
+    5b94:	89 d1                	mov    %edx,%ecx
+}
+    5b96:	89 c8                	mov    %ecx,%eax
+    p->s.ptr = bp->s.ptr;
+    5b98:	89 1a                	mov    %ebx,(%edx)
+}
+    5b9a:	5b                   	pop    %ebx
+    5b9b:	5e                   	pop    %esi
+    5b9c:	5d                   	pop    %ebp
+    5b9d:	c3                   	ret
+    5b9e:	66 90                	xchg   %ax,%ax
+
+00005ba0 <trim>:
+// If free block bp ends the heap, return its whole pages to the
+// kernel, unless something else has moved the break since.
+// Caller holds lock.
+static void
+trim(Header *bp)
+{
+    5ba0:	55                   	push   %ebp
+    5ba1:	89 e5                	mov    %esp,%ebp
+    5ba3:	57                   	push   %edi
+    5ba4:	56                   	push   %esi
+    5ba5:	53                   	push   %ebx
+    5ba6:	89 c3                	mov    %eax,%ebx
+    5ba8:	83 ec 0c             	sub    $0xc,%esp
+  char *end;
+  uint n;
+
+  if((char*)(bp + bp->s.size) != heapend)
+    5bab:	8b 53 04             	mov    0x4(%ebx),%edx
+    5bae:	a1 a0 e9 00 00       	mov    0xe9a0,%eax
+    5bb3:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+    5bb6:	39 d0                	cmp    %edx,%eax
+    5bb8:	74 0e                	je     5bc8 <trim+0x28>
+  n = heapend - end;
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    bp->s.size -= n / sizeof(Header);
+    heapend = end;
+  }
+}
+    5bba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    5bbd:	5b                   	pop    %ebx
+    5bbe:	5e                   	pop    %esi
+    5bbf:	5f                   	pop    %edi
+    5bc0:	5d                   	pop    %ebp
+    5bc1:	c3                   	ret
+    5bc2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  end = (char*)PGROUNDUP((uint)(bp + 2));
+    5bc8:	8d bb 0f 10 00 00    	lea    0x100f(%ebx),%edi
+    5bce:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  n = heapend - end;
+    5bd4:	29 f8                	sub    %edi,%eax
+    5bd6:	89 c6                	mov    %eax,%esi
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    5bd8:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    5bdd:	76 db                	jbe    5bba <trim+0x1a>
+    5bdf:	83 ec 0c             	sub    $0xc,%esp
+    5be2:	6a 00                	push   $0x0
+    5be4:	e8 8b ef ff ff       	call   4b74 <sbrk>
+    5be9:	83 c4 10             	add    $0x10,%esp
+    5bec:	39 05 a0 e9 00 00    	cmp    %eax,0xe9a0
+    5bf2:	75 c6                	jne    5bba <trim+0x1a>
+    5bf4:	89 f0                	mov    %esi,%eax
+    5bf6:	83 ec 0c             	sub    $0xc,%esp
+    5bf9:	f7 d8                	neg    %eax
+    5bfb:	50                   	push   %eax
+    5bfc:	e8 73 ef ff ff       	call   4b74 <sbrk>
+    5c01:	83 c4 10             	add    $0x10,%esp
+    5c04:	83 f8 ff             	cmp    $0xffffffff,%eax
+    5c07:	74 b1                	je     5bba <trim+0x1a>
+    bp->s.size -= n / sizeof(Header);
+    5c09:	89 f0                	mov    %esi,%eax
+    heapend = end;
+    5c0b:	89 3d a0 e9 00 00    	mov    %edi,0xe9a0
+    bp->s.size -= n / sizeof(Header);
+    5c11:	c1 e8 03             	shr    $0x3,%eax
+    5c14:	29 43 04             	sub    %eax,0x4(%ebx)
+    heapend = end;
+    5c17:	eb a1                	jmp    5bba <trim+0x1a>
+    5c19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00005c20 <bigalloc>:
+}
+
+// Allocate a big block of nunits units. Caller holds lock.
+static Header*
+bigalloc(uint nunits)
+{
+    5c20:	55                   	push   %ebp
+    5c21:	89 e5                	mov    %esp,%ebp
+    5c23:	57                   	push   %edi
+    5c24:	89 c7                	mov    %eax,%edi
+    5c26:	56                   	push   %esi
+    5c27:	53                   	push   %ebx
+    5c28:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    5c2b:	a1 a4 e9 00 00       	mov    0xe9a4,%eax
+    5c30:	85 c0                	test   %eax,%eax
+    5c32:	0f 84 98 00 00 00    	je     5cd0 <bigalloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    5c38:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    5c3a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    5c3d:	39 f9                	cmp    %edi,%ecx
+    5c3f:	73 67                	jae    5ca8 <bigalloc+0x88>
+  if(nu < 4096)
+    5c41:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    5c46:	39 df                	cmp    %ebx,%edi
+    5c48:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    5c4b:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    5c52:	eb 0d                	jmp    5c61 <bigalloc+0x41>
+    5c54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    5c58:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    5c5a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    5c5d:	39 f9                	cmp    %edi,%ecx
+    5c5f:	73 47                	jae    5ca8 <bigalloc+0x88>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    5c61:	89 d0                	mov    %edx,%eax
+    5c63:	39 15 a4 e9 00 00    	cmp    %edx,0xe9a4
+    5c69:	75 ed                	jne    5c58 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    5c6b:	83 ec 0c             	sub    $0xc,%esp
+    5c6e:	56                   	push   %esi
+    5c6f:	e8 00 ef ff ff       	call   4b74 <sbrk>
+  if(p == (char*)-1)
+    5c74:	83 c4 10             	add    $0x10,%esp
+    5c77:	83 f8 ff             	cmp    $0xffffffff,%eax
+    5c7a:	74 1a                	je     5c96 <bigalloc+0x76>
+  hp->s.size = nu;
+    5c7c:	89 58 04             	mov    %ebx,0x4(%eax)
+  heapend = p + nu * sizeof(Header);
+    5c7f:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    5c82:	89 15 a0 e9 00 00    	mov    %edx,0xe9a0
+  bigfree(hp);
+    5c88:	e8 93 fe ff ff       	call   5b20 <bigfree>
+  return freep;
+    5c8d:	a1 a4 e9 00 00       	mov    0xe9a4,%eax
+      if((p = morecore(nunits)) == 0)
+    5c92:	85 c0                	test   %eax,%eax
+    5c94:	75 c2                	jne    5c58 <bigalloc+0x38>
+        return 0;
+  }
+}
+    5c96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    5c99:	31 d2                	xor    %edx,%edx
+}
+    5c9b:	5b                   	pop    %ebx
+    5c9c:	89 d0                	mov    %edx,%eax
+    5c9e:	5e                   	pop    %esi
+    5c9f:	5f                   	pop    %edi
+    5ca0:	5d                   	pop    %ebp
+    5ca1:	c3                   	ret
+    5ca2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    5ca8:	39 cf                	cmp    %ecx,%edi
+    5caa:	74 54                	je     5d00 <bigalloc+0xe0>
+        p->s.size -= nunits;
+    5cac:	29 f9                	sub    %edi,%ecx
+    5cae:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    5cb1:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    5cb4:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    5cb7:	a3 a4 e9 00 00       	mov    %eax,0xe9a4
+}
+    5cbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    5cbf:	89 d0                	mov    %edx,%eax
+    5cc1:	5b                   	pop    %ebx
+    5cc2:	5e                   	pop    %esi
+    5cc3:	5f                   	pop    %edi
+    5cc4:	5d                   	pop    %ebp
+    5cc5:	c3                   	ret
+    5cc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5ccd:	8d 76 00             	lea    0x0(%esi),%esi
+    base.s.ptr = freep = prevp = &base;
+    5cd0:	c7 05 a4 e9 00 00 a8 	movl   $0xe9a8,0xe9a4
+    5cd7:	e9 00 00 
+    base.s.size = 0;
+    5cda:	ba a8 e9 00 00       	mov    $0xe9a8,%edx
+    base.s.ptr = freep = prevp = &base;
+    5cdf:	c7 05 a8 e9 00 00 a8 	movl   $0xe9a8,0xe9a8
+    5ce6:	e9 00 00 
+    base.s.size = 0;
+    5ce9:	c7 05 ac e9 00 00 00 	movl   $0x0,0xe9ac
+    5cf0:	00 00 00 
+    if(p->s.size >= nunits){
+    5cf3:	e9 49 ff ff ff       	jmp    5c41 <bigalloc+0x21>
+    5cf8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5cff:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    5d00:	8b 0a                	mov    (%edx),%ecx
+    5d02:	89 08                	mov    %ecx,(%eax)
+    5d04:	eb b1                	jmp    5cb7 <bigalloc+0x97>
+    5d06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5d0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00005d10 <drain>:
+}
+
+// Move n blocks of class c from cache tc to the shared list.
+static void
+drain(struct tcache *tc, int c, int n)
+{
+    5d10:	55                   	push   %ebp
+    5d11:	89 e5                	mov    %esp,%ebp
+    5d13:	57                   	push   %edi
+    5d14:	89 c7                	mov    %eax,%edi
+    5d16:	56                   	push   %esi
+    5d17:	89 d6                	mov    %edx,%esi
+    5d19:	53                   	push   %ebx
+    5d1a:	89 cb                	mov    %ecx,%ebx
+    5d1c:	83 ec 0c             	sub    $0xc,%esp
+  if(threaded)
+    5d1f:	8b 15 24 e9 00 00    	mov    0xe924,%edx
+    5d25:	85 d2                	test   %edx,%edx
+    5d27:	75 57                	jne    5d80 <drain+0x70>
+  Header *p;
+
+  acquire();
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    5d29:	85 c9                	test   %ecx,%ecx
+    5d2b:	7e 49                	jle    5d76 <drain+0x66>
+    5d2d:	89 d9                	mov    %ebx,%ecx
+    5d2f:	8d 14 b7             	lea    (%edi,%esi,4),%edx
+    5d32:	eb 23                	jmp    5d57 <drain+0x47>
+    5d34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    tc->list[c] = p->s.ptr;
+    5d38:	8b 18                	mov    (%eax),%ebx
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    5d3a:	83 e9 01             	sub    $0x1,%ecx
+    tc->n[c]--;
+    5d3d:	83 6a 20 01          	subl   $0x1,0x20(%edx)
+    tc->list[c] = p->s.ptr;
+    5d41:	89 1a                	mov    %ebx,(%edx)
+    p->s.ptr = small[c];
+    5d43:	8b 1c b5 80 e9 00 00 	mov    0xe980(,%esi,4),%ebx
+    5d4a:	89 18                	mov    %ebx,(%eax)
+    small[c] = p;
+    5d4c:	89 04 b5 80 e9 00 00 	mov    %eax,0xe980(,%esi,4)
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    5d53:	85 c9                	test   %ecx,%ecx
+    5d55:	7e 06                	jle    5d5d <drain+0x4d>
+    5d57:	8b 02                	mov    (%edx),%eax
+    5d59:	85 c0                	test   %eax,%eax
+    5d5b:	75 db                	jne    5d38 <drain+0x28>
+  if(threaded)
+    5d5d:	a1 24 e9 00 00       	mov    0xe924,%eax
+    5d62:	85 c0                	test   %eax,%eax
+    5d64:	74 10                	je     5d76 <drain+0x66>
+    mutex_unlock(&lock);
+    5d66:	83 ec 0c             	sub    $0xc,%esp
+    5d69:	68 28 e9 00 00       	push   $0xe928
+    5d6e:	e8 1d ec ff ff       	call   4990 <mutex_unlock>
+}
+    5d73:	83 c4 10             	add    $0x10,%esp
+  }
+  release();
+}
+    5d76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    5d79:	5b                   	pop    %ebx
+    5d7a:	5e                   	pop    %esi
+    5d7b:	5f                   	pop    %edi
+    5d7c:	5d                   	pop    %ebp
+    5d7d:	c3                   	ret
+    5d7e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&lock);
+    5d80:	83 ec 0c             	sub    $0xc,%esp
+    5d83:	68 28 e9 00 00       	push   $0xe928
+    5d88:	e8 b3 eb ff ff       	call   4940 <mutex_lock>
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    5d8d:	83 c4 10             	add    $0x10,%esp
+    5d90:	85 db                	test   %ebx,%ebx
+    5d92:	7f 99                	jg     5d2d <drain+0x1d>
+    5d94:	eb c7                	jmp    5d5d <drain+0x4d>
+    5d96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5d9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00005da0 <mycache>:
+{
+    5da0:	55                   	push   %ebp
+    return &maincache;
+    5da1:	b8 40 e9 00 00       	mov    $0xe940,%eax
+{
+    5da6:	89 e5                	mov    %esp,%ebp
+    5da8:	53                   	push   %ebx
+  sp = PGROUNDDOWN((uint)&sp);
+    5da9:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+    5dac:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+    5db2:	83 ec 14             	sub    $0x14,%esp
+  if(!threaded || sp == mainstack)
+    5db5:	8b 0d 24 e9 00 00    	mov    0xe924,%ecx
+  sp = PGROUNDDOWN((uint)&sp);
+    5dbb:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  if(!threaded || sp == mainstack)
+    5dbe:	85 c9                	test   %ecx,%ecx
+    5dc0:	74 0f                	je     5dd1 <mycache+0x31>
+    5dc2:	3b 1d 20 e9 00 00    	cmp    0xe920,%ebx
+    5dc8:	74 07                	je     5dd1 <mycache+0x31>
+  if(*cp == 0){
+    5dca:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    5dcd:	85 c0                	test   %eax,%eax
+    5dcf:	74 0f                	je     5de0 <mycache+0x40>
+}
+    5dd1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    5dd4:	c9                   	leave
+    5dd5:	c3                   	ret
+    5dd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5ddd:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    5de0:	83 ec 0c             	sub    $0xc,%esp
+    5de3:	68 28 e9 00 00       	push   $0xe928
+    5de8:	e8 53 eb ff ff       	call   4940 <mutex_lock>
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    5ded:	b8 09 00 00 00       	mov    $0x9,%eax
+    5df2:	e8 29 fe ff ff       	call   5c20 <bigalloc>
+  if(threaded)
+    5df7:	8b 15 24 e9 00 00    	mov    0xe924,%edx
+    5dfd:	83 c4 10             	add    $0x10,%esp
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    5e00:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(threaded)
+    5e03:	85 d2                	test   %edx,%edx
+    5e05:	75 29                	jne    5e30 <mycache+0x90>
+    if(*cp == 0)
+    5e07:	85 c0                	test   %eax,%eax
+    5e09:	74 c6                	je     5dd1 <mycache+0x31>
+    memset(*cp, 0, sizeof(**cp));
+    5e0b:	83 ec 04             	sub    $0x4,%esp
+    *cp = (struct tcache*)((Header*)*cp + 1);
+    5e0e:	83 c0 08             	add    $0x8,%eax
+    5e11:	89 43 f8             	mov    %eax,-0x8(%ebx)
+    memset(*cp, 0, sizeof(**cp));
+    5e14:	6a 40                	push   $0x40
+    5e16:	6a 00                	push   $0x0
+    5e18:	50                   	push   %eax
+    5e19:	e8 f2 e9 ff ff       	call   4810 <memset>
+  return *cp;
+    5e1e:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    5e21:	83 c4 10             	add    $0x10,%esp
+    5e24:	eb ab                	jmp    5dd1 <mycache+0x31>
+    5e26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5e2d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    5e30:	83 ec 0c             	sub    $0xc,%esp
+    5e33:	68 28 e9 00 00       	push   $0xe928
+    5e38:	e8 53 eb ff ff       	call   4990 <mutex_unlock>
+    if(*cp == 0)
+    5e3d:	8b 43 f8             	mov    -0x8(%ebx),%eax
+}
+    5e40:	83 c4 10             	add    $0x10,%esp
+    5e43:	eb c2                	jmp    5e07 <mycache+0x67>
+    5e45:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5e4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00005e50 <free>:
+
+void
+free(void *ap)
+{
+    5e50:	55                   	push   %ebp
+    5e51:	89 e5                	mov    %esp,%ebp
+    5e53:	57                   	push   %edi
+    5e54:	56                   	push   %esi
+    5e55:	53                   	push   %ebx
+    5e56:	83 ec 1c             	sub    $0x1c,%esp
+    5e59:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  struct tcache *tc;
+  int c;
+
+  if(ap == 0)
+    5e5c:	85 f6                	test   %esi,%esi
+    5e5e:	74 51                	je     5eb1 <free+0x61>
+    return;
+  bp = (Header*)ap - 1;
+    5e60:	8d 46 f8             	lea    -0x8(%esi),%eax
+    5e63:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(bp->s.size > SMALLMAX / sizeof(Header)){
+    5e66:	8b 46 fc             	mov    -0x4(%esi),%eax
+    5e69:	3d 00 01 00 00       	cmp    $0x100,%eax
+    5e6e:	77 50                	ja     5ec0 <free+0x70>
+    acquire();
+    trim(bigfree(bp));
+    release();
+    return;
+  }
+  for(c = 0; (2 << c) < bp->s.size; c++)
+    5e70:	31 db                	xor    %ebx,%ebx
+    5e72:	ba 02 00 00 00       	mov    $0x2,%edx
+    5e77:	83 f8 02             	cmp    $0x2,%eax
+    5e7a:	76 11                	jbe    5e8d <free+0x3d>
+    5e7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    5e80:	83 c3 01             	add    $0x1,%ebx
+    5e83:	89 d7                	mov    %edx,%edi
+    5e85:	89 d9                	mov    %ebx,%ecx
+    5e87:	d3 e7                	shl    %cl,%edi
+    5e89:	39 c7                	cmp    %eax,%edi
+    5e8b:	72 f3                	jb     5e80 <free+0x30>
+    ;
+  if((tc = mycache()) == 0){
+    5e8d:	e8 0e ff ff ff       	call   5da0 <mycache>
+    5e92:	85 c0                	test   %eax,%eax
+    5e94:	74 7a                	je     5f10 <free+0xc0>
+    bp->s.ptr = small[c];
+    small[c] = bp;
+    release();
+    return;
+  }
+  bp->s.ptr = tc->list[c];
+    5e96:	8d 0c 98             	lea    (%eax,%ebx,4),%ecx
+    5e99:	8b 11                	mov    (%ecx),%edx
+    5e9b:	89 56 f8             	mov    %edx,-0x8(%esi)
+  tc->list[c] = bp;
+    5e9e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    5ea1:	89 31                	mov    %esi,(%ecx)
+  if(++tc->n[c] > TCACHEMAX)
+    5ea3:	8b 71 20             	mov    0x20(%ecx),%esi
+    5ea6:	8d 56 01             	lea    0x1(%esi),%edx
+    5ea9:	89 51 20             	mov    %edx,0x20(%ecx)
+    5eac:	83 fa 20             	cmp    $0x20,%edx
+    5eaf:	7f 47                	jg     5ef8 <free+0xa8>
+    drain(tc, c, BATCH);
+}
+    5eb1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    5eb4:	5b                   	pop    %ebx
+    5eb5:	5e                   	pop    %esi
+    5eb6:	5f                   	pop    %edi
+    5eb7:	5d                   	pop    %ebp
+    5eb8:	c3                   	ret
+    5eb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    5ec0:	8b 1d 24 e9 00 00    	mov    0xe924,%ebx
+    5ec6:	85 db                	test   %ebx,%ebx
+    5ec8:	75 66                	jne    5f30 <free+0xe0>
+    trim(bigfree(bp));
+    5eca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    5ecd:	e8 4e fc ff ff       	call   5b20 <bigfree>
+    5ed2:	e8 c9 fc ff ff       	call   5ba0 <trim>
+  if(threaded)
+    5ed7:	8b 0d 24 e9 00 00    	mov    0xe924,%ecx
+    5edd:	85 c9                	test   %ecx,%ecx
+    5edf:	74 d0                	je     5eb1 <free+0x61>
+    mutex_unlock(&lock);
+    5ee1:	c7 45 08 28 e9 00 00 	movl   $0xe928,0x8(%ebp)
+}
+    5ee8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    5eeb:	5b                   	pop    %ebx
+    5eec:	5e                   	pop    %esi
+    5eed:	5f                   	pop    %edi
+    5eee:	5d                   	pop    %ebp
+    mutex_unlock(&lock);
+    5eef:	e9 9c ea ff ff       	jmp    4990 <mutex_unlock>
+    5ef4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    5ef8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    drain(tc, c, BATCH);
+    5efb:	89 da                	mov    %ebx,%edx
+    5efd:	b9 10 00 00 00       	mov    $0x10,%ecx
+}
+    5f02:	5b                   	pop    %ebx
+    5f03:	5e                   	pop    %esi
+    5f04:	5f                   	pop    %edi
+    5f05:	5d                   	pop    %ebp
+    drain(tc, c, BATCH);
+    5f06:	e9 05 fe ff ff       	jmp    5d10 <drain>
+    5f0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    5f0f:	90                   	nop
+  if(threaded)
+    5f10:	8b 15 24 e9 00 00    	mov    0xe924,%edx
+    5f16:	85 d2                	test   %edx,%edx
+    5f18:	75 28                	jne    5f42 <free+0xf2>
+    bp->s.ptr = small[c];
+    5f1a:	8b 04 9d 80 e9 00 00 	mov    0xe980(,%ebx,4),%eax
+    5f21:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    5f24:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    5f27:	89 04 9d 80 e9 00 00 	mov    %eax,0xe980(,%ebx,4)
+  if(threaded)
+    5f2e:	eb 81                	jmp    5eb1 <free+0x61>
+    mutex_lock(&lock);
+    5f30:	83 ec 0c             	sub    $0xc,%esp
+    5f33:	68 28 e9 00 00       	push   $0xe928
+    5f38:	e8 03 ea ff ff       	call   4940 <mutex_lock>
+}
+    5f3d:	83 c4 10             	add    $0x10,%esp
+    5f40:	eb 88                	jmp    5eca <free+0x7a>
+    mutex_lock(&lock);
+    5f42:	83 ec 0c             	sub    $0xc,%esp
+    5f45:	68 28 e9 00 00       	push   $0xe928
+    5f4a:	e8 f1 e9 ff ff       	call   4940 <mutex_lock>
+    bp->s.ptr = small[c];
+    5f4f:	8b 04 9d 80 e9 00 00 	mov    0xe980(,%ebx,4),%eax
+  if(threaded)
+    5f56:	83 c4 10             	add    $0x10,%esp
+    bp->s.ptr = small[c];
+    5f59:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    5f5c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    5f5f:	89 04 9d 80 e9 00 00 	mov    %eax,0xe980(,%ebx,4)
+  if(threaded)
+    5f66:	a1 24 e9 00 00       	mov    0xe924,%eax
+    5f6b:	85 c0                	test   %eax,%eax
+    5f6d:	0f 85 6e ff ff ff    	jne    5ee1 <free+0x91>
+    5f73:	e9 39 ff ff ff       	jmp    5eb1 <free+0x61>
+    5f78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5f7f:	90                   	nop
+
+00005f80 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    5f80:	55                   	push   %ebp
+    5f81:	89 e5                	mov    %esp,%ebp
+    5f83:	57                   	push   %edi
+    5f84:	56                   	push   %esi
+    5f85:	53                   	push   %ebx
+    5f86:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  struct tcache *tc;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    5f89:	8b 45 08             	mov    0x8(%ebp),%eax
+    5f8c:	8d 78 07             	lea    0x7(%eax),%edi
+    5f8f:	c1 ef 03             	shr    $0x3,%edi
+    5f92:	83 c7 01             	add    $0x1,%edi
+  if(nunits > SMALLMAX / sizeof(Header)){
+    5f95:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+    5f9b:	77 5b                	ja     5ff8 <malloc+0x78>
+    acquire();
+    p = bigalloc(nunits);
+    release();
+    return p ? (void*)(p + 1) : 0;
+  }
+  for(c = 0; (2 << c) < nunits; c++)
+    5f9d:	31 c9                	xor    %ecx,%ecx
+    5f9f:	b8 02 00 00 00       	mov    $0x2,%eax
+    5fa4:	be 02 00 00 00       	mov    $0x2,%esi
+    5fa9:	bb 02 00 00 00       	mov    $0x2,%ebx
+    5fae:	83 ff 02             	cmp    $0x2,%edi
+    5fb1:	76 12                	jbe    5fc5 <malloc+0x45>
+    5fb3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    5fb7:	90                   	nop
+    5fb8:	83 c1 01             	add    $0x1,%ecx
+    5fbb:	89 c3                	mov    %eax,%ebx
+    5fbd:	d3 e3                	shl    %cl,%ebx
+    5fbf:	89 de                	mov    %ebx,%esi
+    5fc1:	39 fb                	cmp    %edi,%ebx
+    5fc3:	72 f3                	jb     5fb8 <malloc+0x38>
+    5fc5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    ;
+  if((tc = mycache()) == 0)
+    5fc8:	e8 d3 fd ff ff       	call   5da0 <mycache>
+    5fcd:	85 c0                	test   %eax,%eax
+    5fcf:	74 51                	je     6022 <malloc+0xa2>
+    return 0;
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    5fd1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    5fd4:	8d 3c 88             	lea    (%eax,%ecx,4),%edi
+    5fd7:	8b 07                	mov    (%edi),%eax
+    5fd9:	85 c0                	test   %eax,%eax
+    5fdb:	74 53                	je     6030 <malloc+0xb0>
+    return 0;
+  p = tc->list[c];
+  tc->list[c] = p->s.ptr;
+  tc->n[c]--;
+    5fdd:	8b 57 20             	mov    0x20(%edi),%edx
+  tc->list[c] = p->s.ptr;
+    5fe0:	8b 08                	mov    (%eax),%ecx
+  tc->n[c]--;
+    5fe2:	83 ea 01             	sub    $0x1,%edx
+  return (void*)(p + 1);
+    5fe5:	83 c0 08             	add    $0x8,%eax
+  tc->n[c]--;
+    5fe8:	89 57 20             	mov    %edx,0x20(%edi)
+  tc->list[c] = p->s.ptr;
+    5feb:	89 0f                	mov    %ecx,(%edi)
+}
+    5fed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    5ff0:	5b                   	pop    %ebx
+    5ff1:	5e                   	pop    %esi
+    5ff2:	5f                   	pop    %edi
+    5ff3:	5d                   	pop    %ebp
+    5ff4:	c3                   	ret
+    5ff5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    5ff8:	a1 24 e9 00 00       	mov    0xe924,%eax
+    5ffd:	85 c0                	test   %eax,%eax
+    5fff:	0f 85 b3 00 00 00    	jne    60b8 <malloc+0x138>
+    p = bigalloc(nunits);
+    6005:	89 f8                	mov    %edi,%eax
+    6007:	e8 14 fc ff ff       	call   5c20 <bigalloc>
+    600c:	89 c3                	mov    %eax,%ebx
+  if(threaded)
+    600e:	a1 24 e9 00 00       	mov    0xe924,%eax
+    6013:	85 c0                	test   %eax,%eax
+    6015:	0f 85 85 00 00 00    	jne    60a0 <malloc+0x120>
+    return p ? (void*)(p + 1) : 0;
+    601b:	8d 43 08             	lea    0x8(%ebx),%eax
+    601e:	85 db                	test   %ebx,%ebx
+    6020:	75 cb                	jne    5fed <malloc+0x6d>
+    6022:	31 c0                	xor    %eax,%eax
+}
+    6024:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    6027:	5b                   	pop    %ebx
+    6028:	5e                   	pop    %esi
+    6029:	5f                   	pop    %edi
+    602a:	5d                   	pop    %ebp
+    602b:	c3                   	ret
+    602c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    6030:	a1 24 e9 00 00       	mov    0xe924,%eax
+    6035:	85 c0                	test   %eax,%eax
+    6037:	0f 85 29 01 00 00    	jne    6166 <malloc+0x1e6>
+  if(small[c] == 0){
+    603d:	8b 04 8d 80 e9 00 00 	mov    0xe980(,%ecx,4),%eax
+    6044:	85 c0                	test   %eax,%eax
+    6046:	0f 84 81 00 00 00    	je     60cd <malloc+0x14d>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    604c:	31 db                	xor    %ebx,%ebx
+    604e:	eb 22                	jmp    6072 <malloc+0xf2>
+    small[c] = p->s.ptr;
+    6050:	8b 10                	mov    (%eax),%edx
+  for(moved = 0; moved < n && small[c]; moved++){
+    6052:	83 c3 01             	add    $0x1,%ebx
+    small[c] = p->s.ptr;
+    6055:	89 14 8d 80 e9 00 00 	mov    %edx,0xe980(,%ecx,4)
+    p->s.ptr = tc->list[c];
+    605c:	8b 17                	mov    (%edi),%edx
+    605e:	89 10                	mov    %edx,(%eax)
+    tc->list[c] = p;
+    6060:	89 07                	mov    %eax,(%edi)
+  for(moved = 0; moved < n && small[c]; moved++){
+    6062:	83 fb 10             	cmp    $0x10,%ebx
+    6065:	0f 84 e2 00 00 00    	je     614d <malloc+0x1cd>
+    606b:	8b 04 8d 80 e9 00 00 	mov    0xe980(,%ecx,4),%eax
+    6072:	85 c0                	test   %eax,%eax
+    6074:	75 da                	jne    6050 <malloc+0xd0>
+  if(threaded)
+    6076:	8b 15 24 e9 00 00    	mov    0xe924,%edx
+    607c:	85 d2                	test   %edx,%edx
+    607e:	0f 85 b4 00 00 00    	jne    6138 <malloc+0x1b8>
+  tc->n[c] += moved;
+    6084:	8b 57 20             	mov    0x20(%edi),%edx
+    6087:	01 da                	add    %ebx,%edx
+    6089:	89 57 20             	mov    %edx,0x20(%edi)
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    608c:	85 db                	test   %ebx,%ebx
+    608e:	74 92                	je     6022 <malloc+0xa2>
+  p = tc->list[c];
+    6090:	8b 07                	mov    (%edi),%eax
+    6092:	e9 49 ff ff ff       	jmp    5fe0 <malloc+0x60>
+    6097:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    609e:	66 90                	xchg   %ax,%ax
+    mutex_unlock(&lock);
+    60a0:	83 ec 0c             	sub    $0xc,%esp
+    60a3:	68 28 e9 00 00       	push   $0xe928
+    60a8:	e8 e3 e8 ff ff       	call   4990 <mutex_unlock>
+}
+    60ad:	83 c4 10             	add    $0x10,%esp
+    60b0:	e9 66 ff ff ff       	jmp    601b <malloc+0x9b>
+    60b5:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    60b8:	83 ec 0c             	sub    $0xc,%esp
+    60bb:	68 28 e9 00 00       	push   $0xe928
+    60c0:	e8 7b e8 ff ff       	call   4940 <mutex_lock>
+}
+    60c5:	83 c4 10             	add    $0x10,%esp
+    60c8:	e9 38 ff ff ff       	jmp    6005 <malloc+0x85>
+    if((chunk = bigalloc(CHUNK / sizeof(Header) + 1)) == 0){
+    60cd:	b8 01 02 00 00       	mov    $0x201,%eax
+    60d2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    60d5:	e8 46 fb ff ff       	call   5c20 <bigalloc>
+    60da:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    60dd:	85 c0                	test   %eax,%eax
+    60df:	89 c2                	mov    %eax,%edx
+    60e1:	0f 84 ba 00 00 00    	je     61a1 <malloc+0x221>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    60e7:	83 c2 08             	add    $0x8,%edx
+    60ea:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+    60f0:	0f 87 d0 00 00 00    	ja     61c6 <malloc+0x246>
+    60f6:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+    60fd:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    6100:	89 df                	mov    %ebx,%edi
+    6102:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    6105:	8d 76 00             	lea    0x0(%esi),%esi
+      p->s.size = units;
+    6108:	89 72 04             	mov    %esi,0x4(%edx)
+      p->s.ptr = small[c];
+    610b:	8b 04 8d 80 e9 00 00 	mov    0xe980(,%ecx,4),%eax
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    6112:	01 df                	add    %ebx,%edi
+    6114:	89 55 e0             	mov    %edx,-0x20(%ebp)
+      p->s.ptr = small[c];
+    6117:	89 02                	mov    %eax,(%edx)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    6119:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      small[c] = p;
+    611c:	89 14 8d 80 e9 00 00 	mov    %edx,0xe980(,%ecx,4)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    6123:	01 c2                	add    %eax,%edx
+    6125:	81 ff 00 02 00 00    	cmp    $0x200,%edi
+    612b:	76 db                	jbe    6108 <malloc+0x188>
+    612d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    6130:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    6133:	e9 14 ff ff ff       	jmp    604c <malloc+0xcc>
+    mutex_unlock(&lock);
+    6138:	83 ec 0c             	sub    $0xc,%esp
+    613b:	68 28 e9 00 00       	push   $0xe928
+    6140:	e8 4b e8 ff ff       	call   4990 <mutex_unlock>
+}
+    6145:	83 c4 10             	add    $0x10,%esp
+    6148:	e9 37 ff ff ff       	jmp    6084 <malloc+0x104>
+  if(threaded)
+    614d:	a1 24 e9 00 00       	mov    0xe924,%eax
+    6152:	85 c0                	test   %eax,%eax
+    6154:	75 2b                	jne    6181 <malloc+0x201>
+  tc->n[c] += moved;
+    6156:	8b 47 20             	mov    0x20(%edi),%eax
+    6159:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    615c:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    615e:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    6161:	e9 7a fe ff ff       	jmp    5fe0 <malloc+0x60>
+    mutex_lock(&lock);
+    6166:	83 ec 0c             	sub    $0xc,%esp
+    6169:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    616c:	68 28 e9 00 00       	push   $0xe928
+    6171:	e8 ca e7 ff ff       	call   4940 <mutex_lock>
+}
+    6176:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    6179:	83 c4 10             	add    $0x10,%esp
+    617c:	e9 bc fe ff ff       	jmp    603d <malloc+0xbd>
+    mutex_unlock(&lock);
+    6181:	83 ec 0c             	sub    $0xc,%esp
+    6184:	68 28 e9 00 00       	push   $0xe928
+    6189:	e8 02 e8 ff ff       	call   4990 <mutex_unlock>
+  tc->n[c] += moved;
+    618e:	8b 47 20             	mov    0x20(%edi),%eax
+    6191:	83 c4 10             	add    $0x10,%esp
+    6194:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    6197:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    6199:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    619c:	e9 3f fe ff ff       	jmp    5fe0 <malloc+0x60>
+  if(threaded)
+    61a1:	8b 0d 24 e9 00 00    	mov    0xe924,%ecx
+    61a7:	85 c9                	test   %ecx,%ecx
+    61a9:	0f 84 73 fe ff ff    	je     6022 <malloc+0xa2>
+    mutex_unlock(&lock);
+    61af:	83 ec 0c             	sub    $0xc,%esp
+    61b2:	68 28 e9 00 00       	push   $0xe928
+    61b7:	e8 d4 e7 ff ff       	call   4990 <mutex_unlock>
+    61bc:	83 c4 10             	add    $0x10,%esp
+    return p ? (void*)(p + 1) : 0;
+    61bf:	31 c0                	xor    %eax,%eax
+    61c1:	e9 5e fe ff ff       	jmp    6024 <malloc+0xa4>
+  for(moved = 0; moved < n && small[c]; moved++){
+    61c6:	8b 04 8d 80 e9 00 00 	mov    0xe980(,%ecx,4),%eax
+    61cd:	e9 7a fe ff ff       	jmp    604c <malloc+0xcc>
+    61d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    61d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000061e0 <malloc_threaded>:
+void
+malloc_threaded(void)
+{
+  uint sp;
+
+  if(threaded)
+    61e0:	a1 24 e9 00 00       	mov    0xe924,%eax
+    61e5:	85 c0                	test   %eax,%eax
+    61e7:	74 07                	je     61f0 <malloc_threaded+0x10>
+    61e9:	c3                   	ret
+    61ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+{
+    61f0:	55                   	push   %ebp
+    61f1:	89 e5                	mov    %esp,%ebp
+    61f3:	83 ec 24             	sub    $0x24,%esp
+    return;
+  mutex_init(&lock);
+    61f6:	68 28 e9 00 00       	push   $0xe928
+    61fb:	e8 30 e7 ff ff       	call   4930 <mutex_init>
+  mainstack = PGROUNDDOWN((uint)&sp);
+    6200:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    6203:	83 c4 10             	add    $0x10,%esp
+  threaded = 1;
+    6206:	c7 05 24 e9 00 00 01 	movl   $0x1,0xe924
+    620d:	00 00 00 
+  mainstack = PGROUNDDOWN((uint)&sp);
+    6210:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    6215:	a3 20 e9 00 00       	mov    %eax,0xe920
+}
+    621a:	c9                   	leave
+    621b:	c3                   	ret
+    621c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00006220 <malloc_thread_exit>:
+
+// Called by thread_join() with the cache slot of a finished
+// thread: give its blocks, and the cache itself, back.
+void
+malloc_thread_exit(void **cachep)
+{
+    6220:	55                   	push   %ebp
+    6221:	89 e5                	mov    %esp,%ebp
+    6223:	57                   	push   %edi
+    6224:	56                   	push   %esi
+    6225:	53                   	push   %ebx
+    6226:	83 ec 0c             	sub    $0xc,%esp
+    6229:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct tcache *tc;
+  int c;
+
+  if((tc = *cachep) == 0)
+    622c:	8b 37                	mov    (%edi),%esi
+    622e:	85 f6                	test   %esi,%esi
+    6230:	74 41                	je     6273 <malloc_thread_exit+0x53>
+    return;
+  for(c = 0; c < NCLASS; c++)
+    6232:	31 db                	xor    %ebx,%ebx
+    6234:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    drain(tc, c, tc->n[c]);
+    6238:	8b 4c 9e 20          	mov    0x20(%esi,%ebx,4),%ecx
+    623c:	89 da                	mov    %ebx,%edx
+    623e:	89 f0                	mov    %esi,%eax
+  for(c = 0; c < NCLASS; c++)
+    6240:	83 c3 01             	add    $0x1,%ebx
+    drain(tc, c, tc->n[c]);
+    6243:	e8 c8 fa ff ff       	call   5d10 <drain>
+  for(c = 0; c < NCLASS; c++)
+    6248:	83 fb 08             	cmp    $0x8,%ebx
+    624b:	75 eb                	jne    6238 <malloc_thread_exit+0x18>
+  if(threaded)
+    624d:	8b 15 24 e9 00 00    	mov    0xe924,%edx
+    6253:	85 d2                	test   %edx,%edx
+    6255:	75 29                	jne    6280 <malloc_thread_exit+0x60>
+  acquire();
+  trim(bigfree((Header*)tc - 1));
+    6257:	8d 46 f8             	lea    -0x8(%esi),%eax
+    625a:	e8 c1 f8 ff ff       	call   5b20 <bigfree>
+    625f:	e8 3c f9 ff ff       	call   5ba0 <trim>
+  if(threaded)
+    6264:	a1 24 e9 00 00       	mov    0xe924,%eax
+    6269:	85 c0                	test   %eax,%eax
+    626b:	75 2b                	jne    6298 <malloc_thread_exit+0x78>
+  release();
+  *cachep = 0;
+    626d:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+}
+    6273:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    6276:	5b                   	pop    %ebx
+    6277:	5e                   	pop    %esi
+    6278:	5f                   	pop    %edi
+    6279:	5d                   	pop    %ebp
+    627a:	c3                   	ret
+    627b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    627f:	90                   	nop
+    mutex_lock(&lock);
+    6280:	83 ec 0c             	sub    $0xc,%esp
+    6283:	68 28 e9 00 00       	push   $0xe928
+    6288:	e8 b3 e6 ff ff       	call   4940 <mutex_lock>
+}
+    628d:	83 c4 10             	add    $0x10,%esp
+    6290:	eb c5                	jmp    6257 <malloc_thread_exit+0x37>
+    6292:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    6298:	83 ec 0c             	sub    $0xc,%esp
+    629b:	68 28 e9 00 00       	push   $0xe928
+    62a0:	e8 eb e6 ff ff       	call   4990 <mutex_unlock>
+}
+    62a5:	83 c4 10             	add    $0x10,%esp
+    62a8:	eb c3                	jmp    626d <malloc_thread_exit+0x4d>
+    62aa:	66 90                	xchg   %ax,%ax
+    62ac:	66 90                	xchg   %ax,%ax
+    62ae:	66 90                	xchg   %ax,%ax
+
+000062b0 <thread_create>:
+
+// Start fn(arg) in a new thread on a freshly allocated
+// page-aligned stack.  Returns the thread's pid.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    62b0:	55                   	push   %ebp
+    62b1:	89 e5                	mov    %esp,%ebp
+    62b3:	53                   	push   %ebx
+    62b4:	83 ec 14             	sub    $0x14,%esp
+  char *mem, *stack;
+  int pid;
+
+  malloc_threaded();
+    62b7:	e8 24 ff ff ff       	call   61e0 <malloc_threaded>
+  stdio_threaded();
+    62bc:	e8 cf ee ff ff       	call   5190 <stdio_threaded>
+  if((mem = malloc(2*PGSIZE)) == 0)
+    62c1:	83 ec 0c             	sub    $0xc,%esp
+    62c4:	68 00 20 00 00       	push   $0x2000
+    62c9:	e8 b2 fc ff ff       	call   5f80 <malloc>
+    62ce:	83 c4 10             	add    $0x10,%esp
+    62d1:	85 c0                	test   %eax,%eax
+    62d3:	74 52                	je     6327 <thread_create+0x77>
+    62d5:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    62d7:	8d 80 07 10 00 00    	lea    0x1007(%eax),%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+  ((char**)stack)[-2] = 0;
+  if((pid = clone(fn, arg, stack)) < 0)
+    62dd:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    62e0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+    62e5:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  ((char**)stack)[-2] = 0;
+    62e8:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+  if((pid = clone(fn, arg, stack)) < 0)
+    62ef:	50                   	push   %eax
+    62f0:	ff 75 0c             	push   0xc(%ebp)
+    62f3:	ff 75 08             	push   0x8(%ebp)
+    62f6:	e8 97 e8 ff ff       	call   4b92 <clone>
+    62fb:	83 c4 10             	add    $0x10,%esp
+    62fe:	85 c0                	test   %eax,%eax
+    6300:	78 0e                	js     6310 <thread_create+0x60>
+    free(mem);
+  return pid;
+}
+    6302:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    6305:	c9                   	leave
+    6306:	c3                   	ret
+    6307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    630e:	66 90                	xchg   %ax,%ax
+    free(mem);
+    6310:	83 ec 0c             	sub    $0xc,%esp
+    6313:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    6316:	53                   	push   %ebx
+    6317:	e8 34 fb ff ff       	call   5e50 <free>
+    631c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    631f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    6322:	83 c4 10             	add    $0x10,%esp
+}
+    6325:	c9                   	leave
+    6326:	c3                   	ret
+    return -1;
+    6327:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    632c:	eb d4                	jmp    6302 <thread_create+0x52>
+    632e:	66 90                	xchg   %ax,%ax
+
+00006330 <thread_join>:
+
+// Wait for a thread to finish and free its stack.
+int
+thread_join(void)
+{
+    6330:	55                   	push   %ebp
+    6331:	89 e5                	mov    %esp,%ebp
+    6333:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    6334:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    6337:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    633a:	50                   	push   %eax
+    633b:	e8 61 e8 ff ff       	call   4ba1 <join>
+    6340:	83 c4 10             	add    $0x10,%esp
+    6343:	85 c0                	test   %eax,%eax
+    6345:	78 29                	js     6370 <thread_join+0x40>
+    6347:	89 c3                	mov    %eax,%ebx
+    return -1;
+  malloc_thread_exit(&((void**)stack)[-2]);
+    6349:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    634c:	83 ec 0c             	sub    $0xc,%esp
+    634f:	83 e8 08             	sub    $0x8,%eax
+    6352:	50                   	push   %eax
+    6353:	e8 c8 fe ff ff       	call   6220 <malloc_thread_exit>
+  free(((char**)stack)[-1]);
+    6358:	58                   	pop    %eax
+    6359:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    635c:	ff 70 fc             	push   -0x4(%eax)
+    635f:	e8 ec fa ff ff       	call   5e50 <free>
+  return pid;
+    6364:	83 c4 10             	add    $0x10,%esp
+}
+    6367:	89 d8                	mov    %ebx,%eax
+    6369:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    636c:	c9                   	leave
+    636d:	c3                   	ret
+    636e:	66 90                	xchg   %ax,%ax
+    return -1;
+    6370:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    6375:	eb f0                	jmp    6367 <thread_join+0x37>
@@ -7,35 +7,40 @@
 #include "syscall.h"
 #include "traps.h"
 #include "memlayout.h"
+#include "mmap.h"
+#include "ring.h"
+#include "uio.h"
+#include "prof.h"
+#include "scstat.h"
 
 char buf[8192];
 char name[3];
 char *echoargv[] = { "echo", "ALL", "TESTS", "PASSED", 0 };
-int stdout = 1;
+int out = 1;
 
 // does chdir() call iput(p->cwd) in a transaction?
 void
 iputtest(void)
 {
-  printf(stdout, "iput test\n");
+  printf(out, "iput test\n");
 
   if(mkdir("iputdir") < 0){
-    printf(stdout, "mkdir failed\n");
+    printf(out, "mkdir failed\n");
     exit();
   }
   if(chdir("iputdir") < 0){
-    printf(stdout, "chdir iputdir failed\n");
+    printf(out, "chdir iputdir failed\n");
     exit();
   }
   if(unlink("../iputdir") < 0){
-    printf(stdout, "unlink ../iputdir failed\n");
+    printf(out, "unlink ../iputdir failed\n");
     exit();
   }
   if(chdir("/") < 0){
-    printf(stdout, "chdir / failed\n");
+    printf(out, "chdir / failed\n");
     exit();
   }
-  printf(stdout, "iput test ok\n");
+  printf(out, "iput test ok\n");
 }
 
 // does exit() call iput(p->cwd) in a transaction?
@@ -44,30 +49,30 @@ exitiputtest(void)
 {
   int pid;
 
-  printf(stdout, "exitiput test\n");
+  printf(out, "exitiput test\n");
 
   pid = fork();
   if(pid < 0){
-    printf(stdout, "fork failed\n");
+    printf(out, "fork failed\n");
     exit();
   }
   if(pid == 0){
     if(mkdir("iputdir") < 0){
-      printf(stdout, "mkdir failed\n");
+      printf(out, "mkdir failed\n");
       exit();
     }
     if(chdir("iputdir") < 0){
-      printf(stdout, "child chdir failed\n");
+      printf(out, "child chdir failed\n");
       exit();
     }
     if(unlink("../iputdir") < 0){
-      printf(stdout, "unlink ../iputdir failed\n");
+      printf(out, "unlink ../iputdir failed\n");
       exit();
     }
     exit();
   }
   wait();
-  printf(stdout, "exitiput test ok\n");
+  printf(out, "exitiput test ok\n");
 }
 
 // does the error path in open() for attempt to write a
@@ -86,31 +91,31 @@ openiputtest(void)
 {
   int pid;
 
-  printf(stdout, "openiput test\n");
+  printf(out, "openiput test\n");
   if(mkdir("oidir") < 0){
-    printf(stdout, "mkdir oidir failed\n");
+    printf(out, "mkdir oidir failed\n");
     exit();
   }
   pid = fork();
   if(pid < 0){
-    printf(stdout, "fork failed\n");
+    printf(out, "fork failed\n");
     exit();
   }
   if(pid == 0){
     int fd = open("oidir", O_RDWR);
     if(fd >= 0){
-      printf(stdout, "open directory for write succeeded\n");
+      printf(out, "open directory for write succeeded\n");
       exit();
     }
     exit();
   }
   sleep(1);
   if(unlink("oidir") != 0){
-    printf(stdout, "unlink failed\n");
+    printf(out, "unlink failed\n");
     exit();
   }
   wait();
-  printf(stdout, "openiput test ok\n");
+  printf(out, "openiput test ok\n");
 }
 
 // simple file system tests
@@ -120,19 +125,19 @@ opentest(void)
 {
   int fd;
 
-  printf(stdout, "open test\n");
+  printf(out, "open test\n");
   fd = open("echo", 0);
   if(fd < 0){
-    printf(stdout, "open echo failed!\n");
+    printf(out, "open echo failed!\n");
     exit();
   }
   close(fd);
   fd = open("doesnotexist", 0);
   if(fd >= 0){
-    printf(stdout, "open doesnotexist succeeded!\n");
+    printf(out, "open doesnotexist succeeded!\n");
     exit();
   }
-  printf(stdout, "open test ok\n");
+  printf(out, "open test ok\n");
 }
 
 void
@@ -141,47 +146,47 @@ writetest(void)
   int fd;
   int i;
 
-  printf(stdout, "small file test\n");
+  printf(out, "small file test\n");
   fd = open("small", O_CREATE|O_RDWR);
   if(fd >= 0){
-    printf(stdout, "creat small succeeded; ok\n");
+    printf(out, "creat small succeeded; ok\n");
   } else {
-    printf(stdout, "error: creat small failed!\n");
+    printf(out, "error: creat small failed!\n");
     exit();
   }
   for(i = 0; i < 100; i++){
     if(write(fd, "aaaaaaaaaa", 10) != 10){
-      printf(stdout, "error: write aa %d new file failed\n", i);
+      printf(out, "error: write aa %d new file failed\n", i);
       exit();
     }
     if(write(fd, "bbbbbbbbbb", 10) != 10){
-      printf(stdout, "error: write bb %d new file failed\n", i);
+      printf(out, "error: write bb %d new file failed\n", i);
       exit();
     }
   }
-  printf(stdout, "writes ok\n");
+  printf(out, "writes ok\n");
   close(fd);
   fd = open("small", O_RDONLY);
   if(fd >= 0){
-    printf(stdout, "open small succeeded ok\n");
+    printf(out, "open small succeeded ok\n");
   } else {
-    printf(stdout, "error: open small failed!\n");
+    printf(out, "error: open small failed!\n");
     exit();
   }
   i = read(fd, buf, 2000);
   if(i == 2000){
-    printf(stdout, "read succeeded ok\n");
+    printf(out, "read succeeded ok\n");
   } else {
-    printf(stdout, "read failed\n");
+    printf(out, "read failed\n");
     exit();
   }
   close(fd);
 
   if(unlink("small") < 0){
-    printf(stdout, "unlink small failed\n");
+    printf(out, "unlink small failed\n");
     exit();
   }
-  printf(stdout, "small file test ok\n");
+  printf(out, "small file test ok\n");
 }
 
 void
@@ -189,18 +194,18 @@ writetest1(void)
 {
   int i, fd, n;
 
-  printf(stdout, "big files test\n");
+  printf(out, "big files test\n");
 
   fd = open("big", O_CREATE|O_RDWR);
   if(fd < 0){
-    printf(stdout, "error: creat big failed!\n");
+    printf(out, "error: creat big failed!\n");
     exit();
   }
 
   for(i = 0; i < MAXFILE; i++){
     ((int*)buf)[0] = i;
     if(write(fd, buf, 512) != 512){
-      printf(stdout, "error: write big file failed\n", i);
+      printf(out, "error: write big file failed\n", i);
       exit();
     }
   }
@@ -209,7 +214,7 @@ writetest1(void)
 
   fd = open("big", O_RDONLY);
   if(fd < 0){
-    printf(stdout, "error: open big failed!\n");
+    printf(out, "error: open big failed!\n");
     exit();
   }
 
@@ -218,16 +223,16 @@ writetest1(void)
     i = read(fd, buf, 512);
     if(i == 0){
       if(n == MAXFILE - 1){
-        printf(stdout, "read only %d blocks from big", n);
+        printf(out, "read only %d blocks from big", n);
         exit();
       }
       break;
     } else if(i != 512){
-      printf(stdout, "read failed %d\n", i);
+      printf(out, "read failed %d\n", i);
       exit();
     }
     if(((int*)buf)[0] != n){
-      printf(stdout, "read content of block %d is %d\n",
+      printf(out, "read content of block %d is %d\n",
              n, ((int*)buf)[0]);
       exit();
     }
@@ -235,10 +240,10 @@ writetest1(void)
   }
   close(fd);
   if(unlink("big") < 0){
-    printf(stdout, "unlink big failed\n");
+    printf(out, "unlink big failed\n");
     exit();
   }
-  printf(stdout, "big files ok\n");
+  printf(out, "big files ok\n");
 }
 
 void
@@ -246,7 +251,7 @@ createtest(void)
 {
   int i, fd;
 
-  printf(stdout, "many creates, followed by unlink test\n");
+  printf(out, "many creates, followed by unlink test\n");
 
   name[0] = 'a';
   name[2] = '\0';
@@ -261,41 +266,41 @@ createtest(void)
     name[1] = '0' + i;
     unlink(name);
   }
-  printf(stdout, "many creates, followed by unlink; ok\n");
+  printf(out, "many creates, followed by unlink; ok\n");
 }
 
 void dirtest(void)
 {
-  printf(stdout, "mkdir test\n");
+  printf(out, "mkdir test\n");
 
   if(mkdir("dir0") < 0){
-    printf(stdout, "mkdir failed\n");
+    printf(out, "mkdir failed\n");
     exit();
   }
 
   if(chdir("dir0") < 0){
-    printf(stdout, "chdir dir0 failed\n");
+    printf(out, "chdir dir0 failed\n");
     exit();
   }
 
   if(chdir("..") < 0){
-    printf(stdout, "chdir .. failed\n");
+    printf(out, "chdir .. failed\n");
     exit();
   }
 
   if(unlink("dir0") < 0){
-    printf(stdout, "unlink dir0 failed\n");
+    printf(out, "unlink dir0 failed\n");
     exit();
   }
-  printf(stdout, "mkdir test ok\n");
+  printf(out, "mkdir test ok\n");
 }
 
 void
 exectest(void)
 {
-  printf(stdout, "exec test\n");
+  printf(out, "exec test\n");
   if(exec("echo", echoargv) < 0){
-    printf(stdout, "exec echo failed\n");
+    printf(out, "exec echo failed\n");
     exit();
   }
 }
@@ -1418,7 +1423,7 @@ sbrktest(void)
   char *a, *b, *c, *lastaddr, *oldbrk, *p, scratch;
   uint amt;
 
-  printf(stdout, "sbrk test\n");
+  printf(out, "sbrk test\n");
   oldbrk = sbrk(0);
 
   // can one sbrk() less than a page?
@@ -1427,7 +1432,7 @@ sbrktest(void)
   for(i = 0; i < 5000; i++){
     b = sbrk(1);
     if(b != a){
-      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+      printf(out, "sbrk test failed %d %x %x\n", i, a, b);
       exit();
     }
     *b = 1;
@@ -1435,13 +1440,13 @@ sbrktest(void)
   }
   pid = fork();
   if(pid < 0){
-    printf(stdout, "sbrk test fork failed\n");
+    printf(out, "sbrk test fork failed\n");
     exit();
   }
   c = sbrk(1);
   c = sbrk(1);
   if(c != a + 1){
-    printf(stdout, "sbrk test failed post-fork\n");
+    printf(out, "sbrk test failed post-fork\n");
     exit();
   }
   if(pid == 0)
@@ -1454,7 +1459,7 @@ sbrktest(void)
   amt = (BIG) - (uint)a;
   p = sbrk(amt);
   if (p != a) {
-    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    printf(out, "sbrk test failed to grow big address space; enough phys mem?\n");
     exit();
   }
   lastaddr = (char*) (BIG-1);
@@ -1464,12 +1469,12 @@ sbrktest(void)
   a = sbrk(0);
   c = sbrk(-4096);
   if(c == (char*)0xffffffff){
-    printf(stdout, "sbrk could not deallocate\n");
+    printf(out, "sbrk could not deallocate\n");
     exit();
   }
   c = sbrk(0);
   if(c != a - 4096){
-    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    printf(out, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
     exit();
   }
 
@@ -1477,19 +1482,19 @@ sbrktest(void)
   a = sbrk(0);
   c = sbrk(4096);
   if(c != a || sbrk(0) != a + 4096){
-    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    printf(out, "sbrk re-allocation failed, a %x c %x\n", a, c);
     exit();
   }
   if(*lastaddr == 99){
     // should be zero
-    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    printf(out, "sbrk de-allocation didn't really deallocate\n");
     exit();
   }
 
   a = sbrk(0);
   c = sbrk(-(sbrk(0) - oldbrk));
   if(c != a){
-    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    printf(out, "sbrk downsize failed, a %x c %x\n", a, c);
     exit();
   }
 
@@ -1498,11 +1503,11 @@ sbrktest(void)
     ppid = getpid();
     pid = fork();
     if(pid < 0){
-      printf(stdout, "fork failed\n");
+      printf(out, "fork failed\n");
       exit();
     }
     if(pid == 0){
-      printf(stdout, "oops could read %x = %x\n", a, *a);
+      printf(out, "oops could read %x = %x\n", a, *a);
       kill(ppid);
       exit();
     }
@@ -1536,14 +1541,14 @@ sbrktest(void)
     wait();
   }
   if(c == (char*)0xffffffff){
-    printf(stdout, "failed sbrk leaked memory\n");
+    printf(out, "failed sbrk leaked memory\n");
     exit();
   }
 
   if(sbrk(0) > oldbrk)
     sbrk(-(sbrk(0) - oldbrk));
 
-  printf(stdout, "sbrk test OK\n");
+  printf(out, "sbrk test OK\n");
 }
 
 void
@@ -1559,13 +1564,432 @@ validateint(int *p)
       "ebx");
 }
 
+// does shrinking into a 4MB page from hsbrk() free the pages
+// above the new size, so that growing again gives zeroed pages,
+// while keeping those below?
+void
+hsbrktest(void)
+{
+  uint big, pg;
+  char *cur, *base;
+  int pid;
+
+  printf(out, "hsbrk test\n");
+  big = 4*1024*1024;
+  pg = 4096;
+  if((pid = fork()) < 0){
+    printf(out, "hsbrk test: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    cur = sbrk(0);
+    sbrk(((uint)cur + big - 1) / big * big - (uint)cur);
+    if((base = hsbrk(big)) == (char*)-1){
+      printf(out, "hsbrk test: out of memory\n");
+      exit();
+    }
+    base[big-pg-1] = 'a';
+    base[big-pg] = 'b';
+    base[big-1] = 'c';
+    sbrk(-pg);
+    if(sbrk(pg) == (char*)-1){
+      printf(out, "hsbrk test: regrow failed\n");
+      exit();
+    }
+    if(base[big-pg-1] != 'a' || base[big-pg] != 0 || base[big-1] != 0){
+      printf(out, "hsbrk test failed\n");
+      exit();
+    }
+    sbrk(-big);
+    printf(out, "hsbrk test ok\n");
+    exit();
+  }
+  wait();
+}
+
+// threads made by clone() share memory; does the futex
+// mutex keep their updates to a shared counter atomic, and
+// do condition variables hand off between them?
+struct mutex tmu;
+struct cond tcond;
+volatile int tcount, tturn;
+
+void
+threadworker(void *arg)
+{
+  int i, me;
+
+  me = (int)arg;
+  for(i = 0; i < 1000; i++){
+    mutex_lock(&tmu);
+    tcount++;
+    mutex_unlock(&tmu);
+  }
+  mutex_lock(&tmu);
+  while(tturn != me)
+    cond_wait(&tcond, &tmu);
+  tturn++;
+  cond_broadcast(&tcond);
+  mutex_unlock(&tmu);
+  exit();
+}
+
+void
+threadtest(void)
+{
+  int i;
+
+  printf(out, "thread test\n");
+  mutex_init(&tmu);
+  cond_init(&tcond);
+  tcount = tturn = 0;
+  for(i = 0; i < 4; i++){
+    if(thread_create(threadworker, (void*)i) < 0){
+      printf(out, "thread_create failed\n");
+      exit();
+    }
+  }
+  for(i = 0; i < 4; i++){
+    if(thread_join() < 0){
+      printf(out, "thread_join failed\n");
+      exit();
+    }
+  }
+  if(thread_join() != -1){
+    printf(out, "thread_join with no threads succeeded\n");
+    exit();
+  }
+  if(tcount != 4000 || tturn != 4){
+    printf(out, "thread test failed: count %d turn %d\n", tcount, tturn);
+    exit();
+  }
+  printf(out, "thread test ok\n");
+}
+
+// file and anonymous mmap(); MAP_SHARED writes reach the file.
+void
+mmaptest(void)
+{
+  int fd;
+  char *p;
+
+  printf(out, "mmap test\n");
+  fd = open("mmapf", O_CREATE|O_RDWR);
+  memset(buf, 'a', 600);
+  if(fd < 0 || write(fd, buf, 600) != 600){
+    printf(out, "mmap test: create failed\n");
+    exit();
+  }
+  p = mmap(0, 600, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+  if(p == (char*)-1 || p[599] != 'a' || p[600] != 0){
+    printf(out, "mmap test: file mapping failed\n");
+    exit();
+  }
+  p[0] = 'b';
+  close(fd);
+  fd = open("mmapf", O_RDONLY);
+  if(munmap(p, 600) < 0 || read(fd, buf, 600) != 600 || buf[0] != 'b'){
+    printf(out, "mmap test: write back failed\n");
+    exit();
+  }
+  close(fd);
+  unlink("mmapf");
+  p = mmap(0, 8192, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+  if(p == (char*)-1 || p[4096] != 0){
+    printf(out, "mmap test: anonymous mapping failed\n");
+    exit();
+  }
+  munmap(p, 8192);
+  printf(out, "mmap test ok\n");
+}
+
+// MAP_SHARED pages are shared: a forked child's writes reach
+// the parent, and two mappings of one file see the same page.
+void
+mmapsharedtest(void)
+{
+  int fd, pid;
+  char *p, *q;
+
+  printf(out, "mmap shared test\n");
+  p = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANON, -1, 0);
+  if(p == (char*)-1){
+    printf(out, "mmap shared test: mmap failed\n");
+    exit();
+  }
+  p[0] = 'a';
+  pid = fork();
+  if(pid < 0){
+    printf(out, "mmap shared test: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    p[0] = 'b';
+    exit();
+  }
+  wait();
+  if(p[0] != 'b'){
+    printf(out, "mmap shared test: child write lost\n");
+    exit();
+  }
+  munmap(p, 4096);
+
+  fd = open("mmapf", O_CREATE|O_RDWR);
+  memset(buf, 'a', 600);
+  if(fd < 0 || write(fd, buf, 600) != 600){
+    printf(out, "mmap shared test: create failed\n");
+    exit();
+  }
+  p = mmap(0, 600, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+  q = mmap(0, 600, PROT_READ, MAP_SHARED, fd, 0);
+  if(p == (char*)-1 || q == (char*)-1 || p == q){
+    printf(out, "mmap shared test: file mmap failed\n");
+    exit();
+  }
+  p[1] = 'c';
+  if(q[1] != 'c'){
+    printf(out, "mmap shared test: mappings differ\n");
+    exit();
+  }
+  munmap(p, 600);
+  munmap(q, 600);
+  close(fd);
+  unlink("mmapf");
+  printf(out, "mmap shared test ok\n");
+}
+
+// threads made by clone() share mmap() regions: one made by
+// a thread outlives it and is visible to the others.
+char *tmap;
+
+void
+mmapthread(void *arg)
+{
+  tmap = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+  if(tmap != (char*)-1)
+    tmap[0] = 'x';
+  exit();
+}
+
+void
+mmapthreadtest(void)
+{
+  printf(out, "mmap thread test\n");
+  tmap = 0;
+  if(thread_create(mmapthread, 0) < 0 || thread_join() < 0){
+    printf(out, "mmap thread test: thread failed\n");
+    exit();
+  }
+  if(tmap == 0 || tmap == (char*)-1 || tmap[0] != 'x'){
+    printf(out, "mmap thread test: mapping lost\n");
+    exit();
+  }
+  if(munmap(tmap, 4096) < 0){
+    printf(out, "mmap thread test: munmap failed\n");
+    exit();
+  }
+  printf(out, "mmap thread test ok\n");
+}
+
+// ringenter() runs requests in order and refuses fork.
+void
+ringtest(void)
+{
+  static struct ring r;
+  int fd;
+
+  printf(out, "ring test\n");
+  r.sq[0].op = SYS_dup;
+  r.sq[1].op = SYS_fork;
+  r.sqtail = 2;
+  if(ringenter(&r, 3) != 2 || r.cq[0].res < 0 || r.cq[1].res != -1){
+    printf(out, "ring test failed\n");
+    exit();
+  }
+  close(r.cq[0].res);
+
+  // A four-argument call: the offset must not come from data.
+  fd = open("ringf", O_CREATE|O_RDWR);
+  if(fd < 0 || write(fd, "abc", 3) != 3){
+    printf(out, "ring test: create failed\n");
+    exit();
+  }
+  r.sq[2].op = SYS_pread;
+  r.sq[2].arg[0] = fd;
+  r.sq[2].arg[1] = (int)buf;
+  r.sq[2].arg[2] = 2;
+  r.sq[2].arg[3] = 1;
+  r.sq[2].data = 0;
+  r.sqtail = 3;
+  buf[0] = 0;
+  if(ringenter(&r, 1) != 1 || r.cq[2].res != 2 || buf[0] != 'b' || buf[1] != 'c'){
+    printf(out, "ring test: pread failed\n");
+    exit();
+  }
+  close(fd);
+  unlink("ringf");
+  printf(out, "ring test ok\n");
+}
+
+// pread() and pwrite() leave the offset alone;
+// readv() fills its buffers in turn.
+void
+uiotest(void)
+{
+  struct iovec iov[2] = { { buf, 1 }, { buf+8, 2 } };
+  int fd;
+
+  printf(out, "uio test\n");
+  fd = open("uiof", O_CREATE|O_RDWR);
+  if(fd < 0 || pwrite(fd, "abc", 3, 0) != 3 || pread(fd, buf, 2, 1) != 2 ||
+     buf[1] != 'c' || readv(fd, iov, 2) != 3 || buf[0] != 'a' || buf[9] != 'c'){
+    printf(out, "uio test failed\n");
+    exit();
+  }
+  close(fd);
+  unlink("uiof");
+  printf(out, "uio test ok\n");
+}
+
+// A stream written with fprintf() reads back with fgets(),
+// and fopen("w") starts the file afresh.
+void
+stdiotest(void)
+{
+  FILE *f;
+  int i;
+
+  printf(out, "stdio test\n");
+  for(i = 0; i < 2; i++){
+    if((f = fopen("stdiof", "w")) == 0){
+      printf(out, "stdio test: fopen w failed\n");
+      exit();
+    }
+    fprintf(f, "%d line\n", 100+i);
+    fprintf(f, "tail");
+    fclose(f);
+  }
+  if((f = fopen("stdiof", "r")) == 0 || fgets(buf, sizeof(buf), f) == 0 ||
+     strcmp(buf, "101 line\n") != 0 || fgets(buf, sizeof(buf), f) == 0 ||
+     strcmp(buf, "tail") != 0 || fgets(buf, sizeof(buf), f) != 0){
+    printf(out, "stdio test: read back failed\n");
+    exit();
+  }
+  fclose(f);
+  unlink("stdiof");
+  printf(out, "stdio test ok\n");
+}
+
+// The profiler takes samples of this process while it spins,
+// and reports the end of the samples once stopped.
+void
+proftest(void)
+{
+  struct sample s[8];
+  int n, mine, t;
+
+  printf(out, "prof test\n");
+  if(prof(PROF_START, 0, 0) < 0){
+    printf(out, "prof test: start failed\n");
+    exit();
+  }
+  t = uptime();
+  while(uptime() < t + 5)
+    ;
+  prof(PROF_STOP, 0, 0);
+  mine = 0;
+  while((n = prof(PROF_READ, s, 8)) > 0)
+    while(n-- > 0)
+      if(s[n].pid == getpid() && s[n].user)
+        mine++;
+  if(n != -1 || mine == 0){
+    printf(out, "prof test failed\n");
+    exit();
+  }
+  printf(out, "prof test ok\n");
+}
+
+// System calls are counted for the process and since boot.
+void
+scstattest(void)
+{
+  static struct scstat mine[NSCSTAT], all[NSCSTAT];
+  int i;
+
+  printf(out, "scstat test\n");
+  for(i = 0; i < 100; i++)
+    getpid();
+  if(scstat(getpid(), mine, NSCSTAT) != NSCSTAT || scstat(0, all, NSCSTAT) != NSCSTAT ||
+     mine[SYS_getpid].count < 100 || all[SYS_getpid].count < mine[SYS_getpid].count ||
+     mine[SYS_getpid].max == 0 || scstat(-1, mine, NSCSTAT) != -1){
+    printf(out, "scstat test failed\n");
+    exit();
+  }
+  printf(out, "scstat test ok\n");
+}
+
+static double
+fpwork(int seed)
+{
+  double x;
+  int i;
+
+  x = seed;
+  for(i = 0; i < 200000; i++)
+    x = x * 0.999 + seed * 0.5;
+  return x;
+}
+
+// Processes doing floating point at the same time each keep
+// their own FPU state across preemption.
+void
+fputest(void)
+{
+  volatile double want, got;
+  int fds[2], i, j, n, pid;
+  char c;
+
+  printf(out, "fpu test\n");
+  if(pipe(fds) < 0){
+    printf(out, "fpu test: pipe failed\n");
+    exit();
+  }
+  for(i = 0; i < 4; i++){
+    want = fpwork(i);
+    if((pid = fork()) < 0){
+      printf(out, "fpu test: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      c = want == fpwork(i);
+      for(j = 0; j < 20 && c; j++){
+        got = fpwork(i);
+        c = got == want;
+      }
+      write(fds[1], &c, 1);
+      exit();
+    }
+  }
+  close(fds[1]);
+  for(n = 0; n < 4 && read(fds[0], &c, 1) == 1 && c; n++)
+    ;
+  close(fds[0]);
+  for(i = 0; i < 4; i++)
+    wait();
+  if(n != 4){
+    printf(out, "fpu test: wrong result\n");
+    exit();
+  }
+  printf(out, "fpu test ok\n");
+}
+
 void
 validatetest(void)
 {
   int hi, pid;
   uint p;
 
-  printf(stdout, "validate test\n");
+  printf(out, "validate test\n");
   hi = 1100*1024;
 
   for(p = 0; p <= (uint)hi; p += 4096){
@@ -1581,12 +2005,12 @@ validatetest(void)
 
     // try to crash the kernel by passing in a bad string pointer
     if(link("nosuchfile", (char*)p) != -1){
-      printf(stdout, "link should not succeed\n");
+      printf(out, "link should not succeed\n");
       exit();
     }
   }
 
-  printf(stdout, "validate ok\n");
+  printf(out, "validate ok\n");
 }
 
 // does unintialized data start out zero?
@@ -1596,14 +2020,14 @@ bsstest(void)
 {
   int i;
 
-  printf(stdout, "bss test\n");
+  printf(out, "bss test\n");
   for(i = 0; i < sizeof(uninit); i++){
     if(uninit[i] != '\0'){
-      printf(stdout, "bss test failed\n");
+      printf(out, "bss test failed\n");
       exit();
     }
   }
-  printf(stdout, "bss test ok\n");
+  printf(out, "bss test ok\n");
 }
 
 // does exec return an error if the arguments
@@ -1622,20 +2046,20 @@ bigargtest(void)
     for(i = 0; i < MAXARG-1; i++)
       args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
     args[MAXARG-1] = 0;
-    printf(stdout, "bigarg test\n");
+    printf(out, "bigarg test\n");
     exec("echo", args);
-    printf(stdout, "bigarg test ok\n");
+    printf(out, "bigarg test ok\n");
     fd = open("bigarg-ok", O_CREATE);
     close(fd);
     exit();
   } else if(pid < 0){
-    printf(stdout, "bigargtest: fork failed\n");
+    printf(out, "bigargtest: fork failed\n");
     exit();
   }
   wait();
   fd = open("bigarg-ok", 0);
   if(fd < 0){
-    printf(stdout, "bigarg test failed!\n");
+    printf(out, "bigarg test failed!\n");
     exit();
   }
   close(fd);
@@ -1768,6 +2192,7 @@ main(int argc, char *argv[])
   bigargtest();
   bsstest();
   sbrktest();
+  hsbrktest();
   validatetest();
 
   opentest();
@@ -1781,6 +2206,16 @@ main(int argc, char *argv[])
 
   mem();
   pipe1();
+  threadtest();
+  mmaptest();
+  mmapthreadtest();
+  mmapsharedtest();
+  ringtest();
+  uiotest();
+  stdiotest();
+  fputest();
+  proftest();
+  scstattest();
   preempt();
   exitwait();
 
@@ -0,0 +1,43 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "mmu.h"
+
+// A thread's stack is one page. Just below it, in the same
+// malloc() block, are two words:
+//   stack[-1]  the block, to free
+//   stack[-2]  the thread's malloc() cache (see umalloc.c)
+
+// Start fn(arg) in a new thread on a freshly allocated
+// page-aligned stack.  Returns the thread's pid.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+  char *mem, *stack;
+  int pid;
+
+  malloc_threaded();
+  stdio_threaded();
+  if((mem = malloc(2*PGSIZE)) == 0)
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+  ((char**)stack)[-1] = mem;  // remember what to free
+  ((char**)stack)[-2] = 0;
+  if((pid = clone(fn, arg, stack)) < 0)
+    free(mem);
+  return pid;
+}
+
+// Wait for a thread to finish and free its stack.
+int
+thread_join(void)
+{
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    return -1;
+  malloc_thread_exit(&((void**)stack)[-2]);
+  free(((char**)stack)[-1]);
+  return pid;
+}
@@ -0,0 +1,33 @@
+// The read-only page mapped into every process (see vdso.h), which
+// the kernel updates as ticks advance.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "vdso.h"
+
+static struct vdso *vdso;
+
+void
+vdsoinit(void) {
+    if ((vdso = (struct vdso *) kzalloc()) == 0)
+        panic("vdsoinit");
+    vdso->ncpu = ncpu;
+}
+
+// Map the shared page into pgdir.
+// Returns 0 on success, -1 if out of memory.
+int
+vdsomap(pde_t *pgdir) {
+    // PTE_SHARED keeps freevm() from freeing it.
+    return mappages(pgdir, (char *) VDSO, PGSIZE, V2P(vdso), PTE_U | PTE_SHARED);
+}
+
+// Called on each tick.
+void
+vdsotick(uint t) {
+    vdso->ticks = t;
+}
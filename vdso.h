@@ -0,0 +1,10 @@
+// A page the kernel shares read-only with user programs, mapped by
+// exec() at VDSO (see memlayout.h) so that a program can read it
+// without a system call.
+// Both the kernel and user programs use this header file.
+
+// At VDSO: one page shared by all processes.
+struct vdso {
+    volatile uint ticks;         // Timer ticks since boot, as uptime()
+    int ncpu;                    // Number of CPUs
+};
@@ -50,19 +50,21 @@ seginit(void) {
 //实际上，在 xv6 中有一个名为 `walkpgdir` 的函数，用于执行以上的步骤，并返回对应物理地址的指针。
 
 
-static pte_t *
+pte_t *
 walkpgdir(pde_t *pgdir, const void *va, int alloc) {
     pde_t *pde;
     pte_t *pgtab; //虚拟地址
 
     pde = &pgdir[PDX(va)];
-    if (*pde & PTE_P) {
+    if (*pde & PTE_PS) {
+        // A 4MB page has no page table; the PDE maps it.
+        return pde;
+    } else if (*pde & PTE_P) {
         pgtab = (pte_t *) P2V(PTE_ADDR(*pde));
     } else {
-        if (!alloc || (pgtab = (pte_t *) kalloc()) == 0)
-            return 0;
         // Make sure all those PTE_P bits are zero.
-        memset(pgtab, 0, PGSIZE);
+        if (!alloc || (pgtab = (pte_t *) kzalloc()) == 0)
+            return 0;
         // The permissions here are overly generous, but they can
         // be further restricted by the permissions in the page table
         // entries, if necessary.
@@ -82,7 +84,7 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc) {
 //uint pa：物理地址，映射到该地址上。
 //int perm：权限位掩码，包含可读、可写和可执行等权限信息。
 ///用于将指定的虚拟地址空间映射到给定的物理地址上，并设置相应的权限
-static int
+int
 mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm) {
     char *a, *last;
     pte_t *pte;
@@ -129,7 +131,14 @@ mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm) {
 //
 // The kernel allocates physical memory for its heap and for user memory
 // between V2P(end) and the end of physical memory (PHYSTOP)
-// (directly addressable from end..P2V(PHYSTOP)).
+// (directly addressable from end..P2V(PHYSTOP)). PHYSTOP is as high
+// as the device space allows; kinit2() frees only the parts the
+// BIOS memory map reports as RAM.
+//
+// Memory above the first 4MB and the device space are mapped with
+// 4MB (PTE_PS) pages, which need no page-table pages and use far
+// fewer TLB entries. The first 4MB holds the read-only kernel text
+// and so keeps 4KB pages.
 
 // This table defines the kernel's mappings, which are present in
 // every process's page table.
@@ -141,45 +150,83 @@ static struct kmap {
 } kmap[] = {
         {(void *) KERNBASE, 0,             EXTMEM,  PTE_W}, // I/O space
         {(void *) KERNLINK, V2P(KERNLINK), V2P(data), 0},     // kern text+rodata
-        {(void *) data,     V2P(data),     PHYSTOP, PTE_W}, // kern data+memory
-        {(void *) DEVSPACE, DEVSPACE, 0,            PTE_W}, // more devices
+        {(void *) data,     V2P(data),     HPGSIZE, PTE_W}, // kern data+memory
+        {(void *) P2V(HPGSIZE), HPGSIZE,   PHYSTOP, PTE_W | PTE_PS}, // memory
+        {(void *) DEVSPACE, DEVSPACE, 0,            PTE_W | PTE_PS}, // more devices
 };
 
-// Set up kernel part of a page table.
+// Map size bytes at va to pa with 4MB pages. va, pa and size
+// must be 4MB-aligned.
+static void
+maphuge(pde_t *pgdir, void *va, uint size, uint pa, int perm) {
+    uint a;
+
+    for (a = (uint) va; size > 0; a += HPGSIZE, pa += HPGSIZE, size -= HPGSIZE) {
+        if (pgdir[PDX(a)] & PTE_P)
+            panic("remap");
+        pgdir[PDX(a)] = pa | perm | PTE_PS | PTE_P;
+    }
+}
+
+// Set up kernel part of a page table by copying the kernel half
+// of kpgdir. The page-table pages it points to are built once, by
+// kvmalloc(), and shared by every page table; freevm() leaves
+// them alone.
 pde_t *
 setupkvm(void) {
     pde_t *pgdir;
-    struct kmap *k;
 
-    if ((pgdir = (pde_t *) kalloc()) == 0)
+    if ((pgdir = (pde_t *) kzalloc()) == 0)
         return 0;
-    memset(pgdir, 0, PGSIZE);
+    memmove(&pgdir[PDX(KERNBASE)], &kpgdir[PDX(KERNBASE)],
+            (NPDENTRIES - PDX(KERNBASE)) * sizeof(pde_t));
+    return pgdir;
+}
+
+#define CPUID_PGE 0x00002000     // CPUID 1 %edx: global pages supported
+
+// Allocate one page table for the machine for the kernel address
+// space for scheduler processes, and build the kernel mappings
+// that setupkvm() copies. Kernel mappings are global if the CPU
+// supports it, so they stay in the TLB when switchuvm() loads %cr3.
+void
+kvmalloc(void) {
+    struct kmap *k;
+    int g;
+
+    if ((kpgdir = (pde_t *) kzalloc()) == 0)
+        panic("kvmalloc");
     if (P2V(PHYSTOP) > (void *) DEVSPACE) {
         panic("PHYSTOP too high");
     }
+    g = (cpuidedx(1) & CPUID_PGE) ? PTE_G : 0;
     for (k = kmap; k < &kmap[NELEM(kmap)];
     k++){
-        if (mappages(pgdir, k->virt, k->phys_end - k->phys_start, (uint) k->phys_start, k->perm) < 0) {
-            freevm(pgdir);
-            return 0;
+        if (k->perm & PTE_PS) {
+            maphuge(kpgdir, k->virt, k->phys_end - k->phys_start, (uint) k->phys_start, k->perm | g);
+            continue;
         }
+        if (mappages(kpgdir, k->virt, k->phys_end - k->phys_start, (uint) k->phys_start, k->perm | g) < 0)
+            panic("kvmalloc");
     }
-    return pgdir;
+    switchkvm();
 }
 
-// Allocate one page table for the machine for the kernel address
-// space for scheduler processes.
+// Turn on global pages on this CPU, if it has them.
+// PCIDs would also keep user translations across switches,
+// but they exist only in 64-bit mode.
 void
-kvmalloc(void) {
-    kpgdir = setupkvm();
-    switchkvm();
+pgeinit(void) {
+    if (cpuidedx(1) & CPUID_PGE)
+        lcr4(rcr4() | CR4_PGE);
 }
 
 // Switch h/w page table register to the kernel-only page table,
 // for when no process is running.
 void
 switchkvm(void) {
-    lcr3(V2P(kpgdir));   // switch to the kernel page table
+    if (rcr3() != V2P(kpgdir))
+        lcr3(V2P(kpgdir));   // switch to the kernel page table
 }
 
 // Switch TSS and h/w page table to correspond to process p.
@@ -202,7 +249,11 @@ switchuvm(struct proc *p) {
     // forbids I/O instructions (e.g., inb and outb) from user space
     mycpu()->ts.iomb = (ushort) 0xFFFF;
     ltr(SEG_TSS << 3);
-    lcr3(V2P(p->pgdir));  // switch to process's address space
+    // Reloading %cr3 with the page table already in use would
+    // only throw away its TLB entries.
+    if (rcr3() != V2P(p->pgdir))
+        lcr3(V2P(p->pgdir));  // switch to process's address space
+    mycpu()->pgdir = p->pgdir;
     popcli();
 }
 
@@ -214,8 +265,7 @@ inituvm(pde_t *pgdir, char *init, uint sz) {
 
     if (sz >= PGSIZE)
         panic("inituvm: more than a page");
-    mem = kalloc();
-    memset(mem, 0, PGSIZE);
+    mem = kzalloc();
     mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W | PTE_U);
     memmove(mem, init, sz);
 }
@@ -257,13 +307,17 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz) {
 
     a = PGROUNDUP(oldsz);
     for (; a < newsz; a += PGSIZE) {
-        mem = kalloc();
+        // Still inside a 4MB page kept by deallocuvm().
+        if (pgdir[PDX(a)] & PTE_PS) {
+            a = HPGROUNDDOWN(a) + HPGSIZE - PGSIZE;
+            continue;
+        }
+        mem = kzalloc();
         if (mem == 0) {
             cprintf("allocuvm out of memory\n");
             deallocuvm(pgdir, newsz, oldsz);
             return 0;
         }
-        memset(mem, 0, PGSIZE);
         if (mappages(pgdir, (char *) a, PGSIZE, V2P(mem), PTE_W | PTE_U) < 0) {
             cprintf("allocuvm out of memory (2)\n");
             deallocuvm(pgdir, newsz, oldsz);
@@ -274,6 +328,25 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz) {
     return newsz;
 }
 
+// Map the 4MB page holding user address va with a page table of
+// 4KB PTEs for the same memory instead, so that the pages from va
+// up can be freed one by one; they lose PTE_U, as revokeuvm()
+// would clear it. Returns -1 if there is no page for the table.
+static int
+splithuge(pde_t *pgdir, uint va) {
+    pte_t *pt;
+    uint pa, flags, i;
+
+    if ((pt = (pte_t *) kalloc()) == 0)
+        return -1;
+    pa = PTE_ADDR(pgdir[PDX(va)]);
+    flags = PTE_FLAGS(pgdir[PDX(va)]) & ~PTE_PS;
+    for (i = 0; i < NPTENTRIES; i++)
+        pt[i] = (pa + i * PGSIZE) | (i < PTX(va) ? flags : flags & ~PTE_U);
+    pgdir[PDX(va)] = V2P(pt) | PTE_P | PTE_W | PTE_U;
+    return 0;
+}
+
 // Deallocate user pages to bring the process size from oldsz to
 // newsz.  oldsz and newsz need not be page-aligned, nor does newsz
 // need to be less than oldsz.  oldsz can be larger than the actual
@@ -288,6 +361,19 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz) {
 
     a = PGROUNDUP(newsz);
     for (; a < oldsz; a += PGSIZE) {
+        // Free a 4MB page whole if nothing below newsz uses it,
+        // else split it and free the 4KB pages above newsz. Only
+        // if there is no memory for the split does it stay mapped
+        // whole, to be freed with the pages below it.
+        if ((pgdir[PDX(a)] & PTE_PS) &&
+            (a % HPGSIZE == 0 || splithuge(pgdir, a) < 0)) {
+            if (a % HPGSIZE == 0) {
+                khugefree(P2V(PTE_ADDR(pgdir[PDX(a)])));
+                pgdir[PDX(a)] = 0;
+            }
+            a = HPGROUNDDOWN(a) + HPGSIZE - PGSIZE;
+            continue;
+        }
         pte = walkpgdir(pgdir, (char *) a, 0);
         if (!pte)
             a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
@@ -296,15 +382,44 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz) {
             if (pa == 0)
                 panic("kfree");
             char *v = P2V(pa);
-            kfree(v);
+            if (!(*pte & PTE_SHARED))
+                kfree(v);
+            *pte = 0;
+        } else if (*pte & PTE_SWAP) {
+            swapfree(PTE_ADDR(*pte) / PGSIZE);
             *pte = 0;
         }
     }
     return newsz;
 }
 
+// Clear PTE_U on the pages that deallocuvm(pgdir, oldsz, newsz)
+// would free, so that once stale TLB entries are flushed (see
+// tlbshootdown) no thread can reach them from user mode.
+void
+revokeuvm(pde_t *pgdir, uint oldsz, uint newsz) {
+    pte_t *pte;
+    uint a;
+
+    for (a = PGROUNDUP(newsz); a < oldsz; a += PGSIZE) {
+        if ((pgdir[PDX(a)] & PTE_PS) &&
+            (a % HPGSIZE == 0 || splithuge(pgdir, a) < 0)) {
+            if (a % HPGSIZE == 0)
+                pgdir[PDX(a)] &= ~PTE_U;
+            a = HPGROUNDDOWN(a) + HPGSIZE - PGSIZE;
+            continue;
+        }
+        pte = walkpgdir(pgdir, (char *) a, 0);
+        if (!pte)
+            a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+        else
+            *pte &= ~PTE_U;
+    }
+}
+
 // Free a page table and all the physical memory pages
-// in the user part.
+// in the user part. The kernel part's page tables are
+// shared with kpgdir and stay.
 void
 freevm(pde_t *pgdir) {
     uint i;
@@ -312,8 +427,8 @@ freevm(pde_t *pgdir) {
     if (pgdir == 0)
         panic("freevm: no pgdir");
     deallocuvm(pgdir, KERNBASE, 0);
-    for (i = 0; i < NPDENTRIES; i++) {
-        if (pgdir[i] & PTE_P) {
+    for (i = 0; i < PDX(KERNBASE); i++) {
+        if ((pgdir[i] & (PTE_P | PTE_PS)) == PTE_P) {
             char *v = P2V(PTE_ADDR(pgdir[i]));
             kfree(v);
         }
@@ -321,6 +436,38 @@ freevm(pde_t *pgdir) {
     kfree((char *) pgdir);
 }
 
+// Like allocuvm(), but map each whole, 4MB-aligned 4MB stretch of
+// the new region with a single PTE_PS page while the huge page pool
+// lasts, and the rest with 4KB pages.
+int
+allocuvmhuge(pde_t *pgdir, uint oldsz, uint newsz) {
+    char *mem;
+    uint a, next;
+
+    if (newsz >= KERNBASE)
+        return 0;
+    if (newsz < oldsz)
+        return oldsz;
+
+    for (a = oldsz; a < newsz; a = next) {
+        if (a % HPGSIZE == 0 && newsz - a >= HPGSIZE && pgdir[PDX(a)] == 0 &&
+            (mem = khugealloc()) != 0) {
+            memset(mem, 0, HPGSIZE);
+            pgdir[PDX(a)] = V2P(mem) | PTE_PS | PTE_W | PTE_U | PTE_P;
+            next = a + HPGSIZE;
+            continue;
+        }
+        next = HPGROUNDDOWN(a) + HPGSIZE;
+        if (next > newsz)
+            next = newsz;
+        if (allocuvm(pgdir, a, next) == 0) {
+            deallocuvm(pgdir, a, oldsz);
+            return 0;
+        }
+    }
+    return newsz;
+}
+
 // Clear PTE_U on a page. Used to create an inaccessible
 // page beneath the user stack.
 void
@@ -347,10 +494,33 @@ copyuvm(pde_t *pgdir, uint sz) {
     for (i = 0; i < sz; i += PGSIZE) {
         if ((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
             panic("copyuvm: pte should exist");
+        if (*pte & PTE_SWAP) {
+            // Give the child its own copy in memory.
+            if ((mem = kalloc()) == 0)
+                goto bad;
+            swapread(PTE_ADDR(*pte) / PGSIZE, mem);
+            if (mappages(d, (void *) i, PGSIZE, V2P(mem), PTE_FLAGS(*pte) & ~PTE_SWAP) < 0) {
+                kfree(mem);
+                goto bad;
+            }
+            continue;
+        }
         if (!(*pte & PTE_P))
             panic("copyuvm: page not present");
         pa = PTE_ADDR(*pte);
         flags = PTE_FLAGS(*pte);
+        if (flags & PTE_PS) {
+            // Copy a 4MB page whole if the pool allows,
+            // else split it into 4KB pages.
+            if (i % HPGSIZE == 0 && (mem = khugealloc()) != 0) {
+                memmove(mem, (char *) P2V(pa), HPGSIZE);
+                d[PDX(i)] = V2P(mem) | flags;
+                i += HPGSIZE - PGSIZE;
+                continue;
+            }
+            pa += i % HPGSIZE;
+            flags &= ~PTE_PS;
+        }
         if ((mem = kalloc()) == 0)
             goto bad;
         memmove(mem, (char *) P2V(pa), PGSIZE);
@@ -366,6 +536,25 @@ copyuvm(pde_t *pgdir, uint sz) {
     return 0;
 }
 
+// Replace the page mapped at page-aligned user address uva with
+// the page at kernel address ka, keeping its permissions. Returns
+// the kernel address of the old page, or 0 if uva is not a present,
+// writable user page. pgdir must be the current page table and not
+// in use on any other CPU, since only this CPU's TLB is flushed.
+char *
+remapupage(pde_t *pgdir, char *uva, char *ka) {
+    pte_t *pte;
+    char *old;
+
+    pte = walkpgdir(pgdir, uva, 0);
+    if (pte == 0 || (*pte & (PTE_P | PTE_U | PTE_W | PTE_PS)) != (PTE_P | PTE_U | PTE_W))
+        return 0;
+    old = (char *) P2V(PTE_ADDR(*pte));
+    *pte = V2P(ka) | PTE_FLAGS(*pte);
+    lcr3(V2P(pgdir));
+    return old;
+}
+
 //PAGEBREAK!
 // Map user virtual address to kernel address.
 char *
@@ -377,6 +566,8 @@ uva2ka(pde_t *pgdir, char *uva) {
         return 0;
     if ((*pte & PTE_U) == 0)
         return 0;
+    if (*pte & PTE_PS)
+        return (char *) P2V(PTE_ADDR(*pte)) + PGROUNDDOWN((uint) uva % HPGSIZE);
     return (char *) P2V(PTE_ADDR(*pte));
 }
 
@@ -0,0 +1,4119 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	be 01 00 00 00       	mov    $0x1,%esi
+      14:	53                   	push   %ebx
+      15:	51                   	push   %ecx
+      16:	83 ec 18             	sub    $0x18,%esp
+      19:	8b 01                	mov    (%ecx),%eax
+      1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+      1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+      24:	83 f8 01             	cmp    $0x1,%eax
+      27:	7f 28                	jg     51 <main+0x51>
+      29:	eb 54                	jmp    7f <main+0x7f>
+      2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "wc: cannot open %s\n", argv[i]);
+      exit();
+    }
+    wc(fd, argv[i]);
+      30:	83 ec 08             	sub    $0x8,%esp
+      33:	ff 33                	push   (%ebx)
+  for(i = 1; i < argc; i++){
+      35:	83 c6 01             	add    $0x1,%esi
+      38:	83 c3 04             	add    $0x4,%ebx
+    wc(fd, argv[i]);
+      3b:	50                   	push   %eax
+      3c:	e8 5f 00 00 00       	call   a0 <wc>
+    close(fd);
+      41:	89 3c 24             	mov    %edi,(%esp)
+      44:	e8 27 05 00 00       	call   570 <close>
+  for(i = 1; i < argc; i++){
+      49:	83 c4 10             	add    $0x10,%esp
+      4c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+      4f:	74 29                	je     7a <main+0x7a>
+    if((fd = open(argv[i], 0)) < 0){
+      51:	83 ec 08             	sub    $0x8,%esp
+      54:	6a 00                	push   $0x0
+      56:	ff 33                	push   (%ebx)
+      58:	e8 40 05 00 00       	call   59d <open>
+      5d:	83 c4 10             	add    $0x10,%esp
+      60:	89 c7                	mov    %eax,%edi
+      62:	85 c0                	test   %eax,%eax
+      64:	79 ca                	jns    30 <main+0x30>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+      66:	50                   	push   %eax
+      67:	ff 33                	push   (%ebx)
+      69:	68 4b 1e 00 00       	push   $0x1e4b
+      6e:	6a 01                	push   $0x1
+      70:	e8 2b 09 00 00       	call   9a0 <printf>
+      exit();
+      75:	e8 66 01 00 00       	call   1e0 <exit>
+  }
+  exit();
+      7a:	e8 61 01 00 00       	call   1e0 <exit>
+    wc(0, "");
+      7f:	52                   	push   %edx
+      80:	52                   	push   %edx
+      81:	68 3d 1e 00 00       	push   $0x1e3d
+      86:	6a 00                	push   $0x0
+      88:	e8 13 00 00 00       	call   a0 <wc>
+    exit();
+      8d:	e8 4e 01 00 00       	call   1e0 <exit>
+      92:	66 90                	xchg   %ax,%ax
+      94:	66 90                	xchg   %ax,%ax
+      96:	66 90                	xchg   %ax,%ax
+      98:	66 90                	xchg   %ax,%ax
+      9a:	66 90                	xchg   %ax,%ax
+      9c:	66 90                	xchg   %ax,%ax
+      9e:	66 90                	xchg   %ax,%ax
+
+000000a0 <wc>:
+{
+      a0:	55                   	push   %ebp
+  l = w = c = 0;
+      a1:	31 d2                	xor    %edx,%edx
+{
+      a3:	89 e5                	mov    %esp,%ebp
+      a5:	57                   	push   %edi
+      a6:	56                   	push   %esi
+  inword = 0;
+      a7:	31 f6                	xor    %esi,%esi
+{
+      a9:	53                   	push   %ebx
+  l = w = c = 0;
+      aa:	31 db                	xor    %ebx,%ebx
+{
+      ac:	83 ec 1c             	sub    $0x1c,%esp
+  l = w = c = 0;
+      af:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+      b6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+      b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+      c0:	83 ec 04             	sub    $0x4,%esp
+      c3:	68 00 02 00 00       	push   $0x200
+      c8:	68 40 29 00 00       	push   $0x2940
+      cd:	ff 75 08             	push   0x8(%ebp)
+      d0:	e8 7d 04 00 00       	call   552 <read>
+      d5:	83 c4 10             	add    $0x10,%esp
+      d8:	89 c1                	mov    %eax,%ecx
+      da:	85 c0                	test   %eax,%eax
+      dc:	7e 62                	jle    140 <wc+0xa0>
+    for(i=0; i<n; i++){
+      de:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+      e1:	31 ff                	xor    %edi,%edi
+      e3:	eb 0d                	jmp    f2 <wc+0x52>
+      e5:	8d 76 00             	lea    0x0(%esi),%esi
+        inword = 0;
+      e8:	31 f6                	xor    %esi,%esi
+    for(i=0; i<n; i++){
+      ea:	83 c7 01             	add    $0x1,%edi
+      ed:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+      f0:	74 3e                	je     130 <wc+0x90>
+      if(buf[i] == '\n')
+      f2:	0f be 87 40 29 00 00 	movsbl 0x2940(%edi),%eax
+        l++;
+      f9:	31 c9                	xor    %ecx,%ecx
+      fb:	3c 0a                	cmp    $0xa,%al
+      fd:	0f 94 c1             	sete   %cl
+      if(strchr(" \r\t\n\v", buf[i]))
+     100:	83 ec 08             	sub    $0x8,%esp
+     103:	50                   	push   %eax
+        l++;
+     104:	01 cb                	add    %ecx,%ebx
+      if(strchr(" \r\t\n\v", buf[i]))
+     106:	68 28 1e 00 00       	push   $0x1e28
+     10b:	e8 d0 01 00 00       	call   2e0 <strchr>
+     110:	83 c4 10             	add    $0x10,%esp
+     113:	85 c0                	test   %eax,%eax
+     115:	75 d1                	jne    e8 <wc+0x48>
+      else if(!inword){
+     117:	85 f6                	test   %esi,%esi
+     119:	75 cf                	jne    ea <wc+0x4a>
+        w++;
+     11b:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+        inword = 1;
+     11f:	be 01 00 00 00       	mov    $0x1,%esi
+    for(i=0; i<n; i++){
+     124:	83 c7 01             	add    $0x1,%edi
+     127:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+     12a:	75 c6                	jne    f2 <wc+0x52>
+     12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      c++;
+     130:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     133:	01 4d dc             	add    %ecx,-0x24(%ebp)
+     136:	eb 88                	jmp    c0 <wc+0x20>
+     138:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     13f:	90                   	nop
+  if(n < 0){
+     140:	8b 55 dc             	mov    -0x24(%ebp),%edx
+     143:	75 22                	jne    167 <wc+0xc7>
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+     145:	83 ec 08             	sub    $0x8,%esp
+     148:	ff 75 0c             	push   0xc(%ebp)
+     14b:	52                   	push   %edx
+     14c:	ff 75 e0             	push   -0x20(%ebp)
+     14f:	53                   	push   %ebx
+     150:	68 3e 1e 00 00       	push   $0x1e3e
+     155:	6a 01                	push   $0x1
+     157:	e8 44 08 00 00       	call   9a0 <printf>
+}
+     15c:	83 c4 20             	add    $0x20,%esp
+     15f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     162:	5b                   	pop    %ebx
+     163:	5e                   	pop    %esi
+     164:	5f                   	pop    %edi
+     165:	5d                   	pop    %ebp
+     166:	c3                   	ret
+    printf(1, "wc: read error\n");
+     167:	50                   	push   %eax
+     168:	50                   	push   %eax
+     169:	68 2e 1e 00 00       	push   $0x1e2e
+     16e:	6a 01                	push   $0x1
+     170:	e8 2b 08 00 00       	call   9a0 <printf>
+    exit();
+     175:	e8 66 00 00 00       	call   1e0 <exit>
+     17a:	66 90                	xchg   %ax,%ax
+     17c:	66 90                	xchg   %ax,%ax
+     17e:	66 90                	xchg   %ax,%ax
+
+00000180 <fork>:
+int sysexit(void) __attribute__((noreturn));
+
+int
+fork(void)
+{
+  if(flushhook)
+     180:	a1 40 2b 00 00       	mov    0x2b40,%eax
+     185:	85 c0                	test   %eax,%eax
+     187:	74 17                	je     1a0 <fork+0x20>
+{
+     189:	55                   	push   %ebp
+     18a:	89 e5                	mov    %esp,%ebp
+     18c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     18f:	ff d0                	call   *%eax
+  return sysfork();
+}
+     191:	c9                   	leave
+  return sysfork();
+     192:	e9 7f 03 00 00       	jmp    516 <sysfork>
+     197:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     19e:	66 90                	xchg   %ax,%ax
+     1a0:	e9 71 03 00 00       	jmp    516 <sysfork>
+     1a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001b0 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+     1b0:	55                   	push   %ebp
+  if(flushhook)
+     1b1:	a1 40 2b 00 00       	mov    0x2b40,%eax
+{
+     1b6:	89 e5                	mov    %esp,%ebp
+     1b8:	56                   	push   %esi
+     1b9:	53                   	push   %ebx
+     1ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     1bd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     1c0:	85 c0                	test   %eax,%eax
+     1c2:	74 02                	je     1c6 <exec+0x16>
+    flushhook();
+     1c4:	ff d0                	call   *%eax
+  return sysexec(path, argv);
+     1c6:	89 75 0c             	mov    %esi,0xc(%ebp)
+     1c9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     1cc:	5b                   	pop    %ebx
+     1cd:	5e                   	pop    %esi
+     1ce:	5d                   	pop    %ebp
+  return sysexec(path, argv);
+     1cf:	e9 ba 03 00 00       	jmp    58e <sysexec>
+     1d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1df:	90                   	nop
+
+000001e0 <exit>:
+
+int
+exit(void)
+{
+     1e0:	55                   	push   %ebp
+     1e1:	89 e5                	mov    %esp,%ebp
+     1e3:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     1e6:	a1 40 2b 00 00       	mov    0x2b40,%eax
+     1eb:	85 c0                	test   %eax,%eax
+     1ed:	74 02                	je     1f1 <exit+0x11>
+    flushhook();
+     1ef:	ff d0                	call   *%eax
+  sysexit();
+     1f1:	e8 2f 03 00 00       	call   525 <sysexit>
+     1f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000200 <strcpy>:
+}
+
+char*
+strcpy(char *s, const char *t)
+{
+     200:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     201:	31 c0                	xor    %eax,%eax
+{
+     203:	89 e5                	mov    %esp,%ebp
+     205:	53                   	push   %ebx
+     206:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     209:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     20c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     210:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     214:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     217:	83 c0 01             	add    $0x1,%eax
+     21a:	84 d2                	test   %dl,%dl
+     21c:	75 f2                	jne    210 <strcpy+0x10>
+    ;
+  return os;
+}
+     21e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     221:	89 c8                	mov    %ecx,%eax
+     223:	c9                   	leave
+     224:	c3                   	ret
+     225:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     22c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000230 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     230:	55                   	push   %ebp
+     231:	89 e5                	mov    %esp,%ebp
+     233:	53                   	push   %ebx
+     234:	8b 55 08             	mov    0x8(%ebp),%edx
+     237:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     23a:	0f b6 02             	movzbl (%edx),%eax
+     23d:	84 c0                	test   %al,%al
+     23f:	75 17                	jne    258 <strcmp+0x28>
+     241:	eb 3a                	jmp    27d <strcmp+0x4d>
+     243:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     247:	90                   	nop
+     248:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     24c:	83 c2 01             	add    $0x1,%edx
+     24f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     252:	84 c0                	test   %al,%al
+     254:	74 1a                	je     270 <strcmp+0x40>
+    p++, q++;
+     256:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     258:	0f b6 19             	movzbl (%ecx),%ebx
+     25b:	38 c3                	cmp    %al,%bl
+     25d:	74 e9                	je     248 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     25f:	29 d8                	sub    %ebx,%eax
+}
+     261:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     264:	c9                   	leave
+     265:	c3                   	ret
+     266:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     26d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     270:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     274:	31 c0                	xor    %eax,%eax
+     276:	29 d8                	sub    %ebx,%eax
+}
+     278:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     27b:	c9                   	leave
+     27c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     27d:	0f b6 19             	movzbl (%ecx),%ebx
+     280:	31 c0                	xor    %eax,%eax
+     282:	eb db                	jmp    25f <strcmp+0x2f>
+     284:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     28b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     28f:	90                   	nop
+
+00000290 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     290:	55                   	push   %ebp
+     291:	89 e5                	mov    %esp,%ebp
+     293:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     296:	80 3a 00             	cmpb   $0x0,(%edx)
+     299:	74 15                	je     2b0 <strlen+0x20>
+     29b:	31 c0                	xor    %eax,%eax
+     29d:	8d 76 00             	lea    0x0(%esi),%esi
+     2a0:	83 c0 01             	add    $0x1,%eax
+     2a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     2a7:	89 c1                	mov    %eax,%ecx
+     2a9:	75 f5                	jne    2a0 <strlen+0x10>
+    ;
+  return n;
+}
+     2ab:	89 c8                	mov    %ecx,%eax
+     2ad:	5d                   	pop    %ebp
+     2ae:	c3                   	ret
+     2af:	90                   	nop
+  for(n = 0; s[n]; n++)
+     2b0:	31 c9                	xor    %ecx,%ecx
+}
+     2b2:	5d                   	pop    %ebp
+     2b3:	89 c8                	mov    %ecx,%eax
+     2b5:	c3                   	ret
+     2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     2c0:	55                   	push   %ebp
+     2c1:	89 e5                	mov    %esp,%ebp
+     2c3:	57                   	push   %edi
+     2c4:	8b 55 08             	mov    0x8(%ebp),%edx
+            "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt) {
+    asm volatile("cld; rep stosb" :
+     2c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     2ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2cd:	89 d7                	mov    %edx,%edi
+     2cf:	fc                   	cld
+     2d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     2d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     2d5:	89 d0                	mov    %edx,%eax
+     2d7:	c9                   	leave
+     2d8:	c3                   	ret
+     2d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     2e0:	55                   	push   %ebp
+     2e1:	89 e5                	mov    %esp,%ebp
+     2e3:	8b 45 08             	mov    0x8(%ebp),%eax
+     2e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     2ea:	0f b6 10             	movzbl (%eax),%edx
+     2ed:	84 d2                	test   %dl,%dl
+     2ef:	75 12                	jne    303 <strchr+0x23>
+     2f1:	eb 1d                	jmp    310 <strchr+0x30>
+     2f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2f7:	90                   	nop
+     2f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     2fc:	83 c0 01             	add    $0x1,%eax
+     2ff:	84 d2                	test   %dl,%dl
+     301:	74 0d                	je     310 <strchr+0x30>
+    if(*s == c)
+     303:	38 d1                	cmp    %dl,%cl
+     305:	75 f1                	jne    2f8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     307:	5d                   	pop    %ebp
+     308:	c3                   	ret
+     309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     310:	31 c0                	xor    %eax,%eax
+}
+     312:	5d                   	pop    %ebp
+     313:	c3                   	ret
+     314:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     31b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     31f:	90                   	nop
+
+00000320 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     320:	55                   	push   %ebp
+     321:	89 e5                	mov    %esp,%ebp
+     323:	56                   	push   %esi
+     324:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     325:	83 ec 08             	sub    $0x8,%esp
+     328:	6a 00                	push   $0x0
+     32a:	ff 75 08             	push   0x8(%ebp)
+     32d:	e8 6b 02 00 00       	call   59d <open>
+  if(fd < 0)
+     332:	83 c4 10             	add    $0x10,%esp
+     335:	85 c0                	test   %eax,%eax
+     337:	78 27                	js     360 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     339:	83 ec 08             	sub    $0x8,%esp
+     33c:	ff 75 0c             	push   0xc(%ebp)
+     33f:	89 c3                	mov    %eax,%ebx
+     341:	50                   	push   %eax
+     342:	e8 83 02 00 00       	call   5ca <fstat>
+  close(fd);
+     347:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     34a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     34c:	e8 1f 02 00 00       	call   570 <close>
+  return r;
+     351:	83 c4 10             	add    $0x10,%esp
+}
+     354:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     357:	89 f0                	mov    %esi,%eax
+     359:	5b                   	pop    %ebx
+     35a:	5e                   	pop    %esi
+     35b:	5d                   	pop    %ebp
+     35c:	c3                   	ret
+     35d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     360:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     365:	eb ed                	jmp    354 <stat+0x34>
+     367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     36e:	66 90                	xchg   %ax,%ax
+
+00000370 <atoi>:
+
+int
+atoi(const char *s)
+{
+     370:	55                   	push   %ebp
+     371:	89 e5                	mov    %esp,%ebp
+     373:	53                   	push   %ebx
+     374:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     377:	0f be 02             	movsbl (%edx),%eax
+     37a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     37d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     380:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     385:	77 1e                	ja     3a5 <atoi+0x35>
+     387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     38e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     390:	83 c2 01             	add    $0x1,%edx
+     393:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     396:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     39a:	0f be 02             	movsbl (%edx),%eax
+     39d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     3a0:	80 fb 09             	cmp    $0x9,%bl
+     3a3:	76 eb                	jbe    390 <atoi+0x20>
+  return n;
+}
+     3a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3a8:	89 c8                	mov    %ecx,%eax
+     3aa:	c9                   	leave
+     3ab:	c3                   	ret
+     3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     3b0:	55                   	push   %ebp
+     3b1:	89 e5                	mov    %esp,%ebp
+     3b3:	57                   	push   %edi
+     3b4:	56                   	push   %esi
+     3b5:	8b 45 10             	mov    0x10(%ebp),%eax
+     3b8:	8b 55 08             	mov    0x8(%ebp),%edx
+     3bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     3be:	85 c0                	test   %eax,%eax
+     3c0:	7e 13                	jle    3d5 <memmove+0x25>
+     3c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     3c4:	89 d7                	mov    %edx,%edi
+     3c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     3d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     3d1:	39 f8                	cmp    %edi,%eax
+     3d3:	75 fb                	jne    3d0 <memmove+0x20>
+  return vdst;
+}
+     3d5:	5e                   	pop    %esi
+     3d6:	89 d0                	mov    %edx,%eax
+     3d8:	5f                   	pop    %edi
+     3d9:	5d                   	pop    %ebp
+     3da:	c3                   	ret
+     3db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3df:	90                   	nop
+
+000003e0 <mutex_init>:
+
+// Futex-based mutex (Drepper, "Futexes Are Tricky", mutex 2).
+// The uncontended paths never enter the kernel.
+void
+mutex_init(struct mutex *m)
+{
+     3e0:	55                   	push   %ebp
+     3e1:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+     3e3:	8b 45 08             	mov    0x8(%ebp),%eax
+     3e6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     3ec:	5d                   	pop    %ebp
+     3ed:	c3                   	ret
+     3ee:	66 90                	xchg   %ax,%ax
+
+000003f0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     3f0:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     3f1:	31 c0                	xor    %eax,%eax
+     3f3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+     3f8:	89 e5                	mov    %esp,%ebp
+     3fa:	56                   	push   %esi
+     3fb:	53                   	push   %ebx
+     3fc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     3ff:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     403:	85 c0                	test   %eax,%eax
+     405:	74 32                	je     439 <mutex_lock+0x49>
+    return;
+  if(c != 2)
+     407:	83 f8 02             	cmp    $0x2,%eax
+     40a:	74 0c                	je     418 <mutex_lock+0x28>
+static inline uint
+xchg(volatile uint *addr, uint newval) {
+    uint result;
+
+    // The + in "+m" denotes a read-modify-write operand.
+    asm volatile("lock; xchgl %0, %1" :
+     40c:	b8 02 00 00 00       	mov    $0x2,%eax
+     411:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+     414:	85 c0                	test   %eax,%eax
+     416:	74 21                	je     439 <mutex_lock+0x49>
+     418:	be 02 00 00 00       	mov    $0x2,%esi
+     41d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAIT, 2);
+     420:	83 ec 04             	sub    $0x4,%esp
+     423:	6a 02                	push   $0x2
+     425:	6a 00                	push   $0x0
+     427:	53                   	push   %ebx
+     428:	e8 33 02 00 00       	call   660 <futex>
+     42d:	89 f0                	mov    %esi,%eax
+     42f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     432:	83 c4 10             	add    $0x10,%esp
+     435:	85 c0                	test   %eax,%eax
+     437:	75 e7                	jne    420 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+     439:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     43c:	5b                   	pop    %ebx
+     43d:	5e                   	pop    %esi
+     43e:	5d                   	pop    %ebp
+     43f:	c3                   	ret
+
+00000440 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     440:	55                   	push   %ebp
+     441:	89 e5                	mov    %esp,%ebp
+     443:	83 ec 08             	sub    $0x8,%esp
+     446:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     449:	f0 83 28 01          	lock subl $0x1,(%eax)
+     44d:	75 09                	jne    458 <mutex_unlock+0x18>
+    m->val = 0;
+    futex(&m->val, FUTEX_WAKE, 1);
+  }
+}
+     44f:	c9                   	leave
+     450:	c3                   	ret
+     451:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     458:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     45b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex(&m->val, FUTEX_WAKE, 1);
+     461:	6a 01                	push   $0x1
+     463:	6a 01                	push   $0x1
+     465:	50                   	push   %eax
+     466:	e8 f5 01 00 00       	call   660 <futex>
+     46b:	83 c4 10             	add    $0x10,%esp
+}
+     46e:	c9                   	leave
+     46f:	c3                   	ret
+
+00000470 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     470:	55                   	push   %ebp
+     471:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     473:	8b 45 08             	mov    0x8(%ebp),%eax
+     476:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     47c:	5d                   	pop    %ebp
+     47d:	c3                   	ret
+     47e:	66 90                	xchg   %ax,%ax
+
+00000480 <cond_wait>:
+
+// Release m and wait for a signal, then reacquire m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     480:	55                   	push   %ebp
+     481:	89 e5                	mov    %esp,%ebp
+     483:	57                   	push   %edi
+     484:	56                   	push   %esi
+     485:	53                   	push   %ebx
+     486:	83 ec 0c             	sub    $0xc,%esp
+     489:	8b 75 08             	mov    0x8(%ebp),%esi
+     48c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     48f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     491:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+     495:	75 21                	jne    4b8 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     497:	83 ec 04             	sub    $0x4,%esp
+     49a:	57                   	push   %edi
+     49b:	6a 00                	push   $0x0
+     49d:	56                   	push   %esi
+     49e:	e8 bd 01 00 00       	call   660 <futex>
+  mutex_lock(m);
+     4a3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     4a6:	83 c4 10             	add    $0x10,%esp
+}
+     4a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4ac:	5b                   	pop    %ebx
+     4ad:	5e                   	pop    %esi
+     4ae:	5f                   	pop    %edi
+     4af:	5d                   	pop    %ebp
+  mutex_lock(m);
+     4b0:	e9 3b ff ff ff       	jmp    3f0 <mutex_lock>
+     4b5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     4b8:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     4bb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex(&m->val, FUTEX_WAKE, 1);
+     4c1:	6a 01                	push   $0x1
+     4c3:	6a 01                	push   $0x1
+     4c5:	53                   	push   %ebx
+     4c6:	e8 95 01 00 00       	call   660 <futex>
+     4cb:	83 c4 10             	add    $0x10,%esp
+     4ce:	eb c7                	jmp    497 <cond_wait+0x17>
+
+000004d0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+     4d0:	55                   	push   %ebp
+     4d1:	89 e5                	mov    %esp,%ebp
+     4d3:	83 ec 0c             	sub    $0xc,%esp
+     4d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     4d9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+     4dd:	6a 01                	push   $0x1
+     4df:	6a 01                	push   $0x1
+     4e1:	50                   	push   %eax
+     4e2:	e8 79 01 00 00       	call   660 <futex>
+}
+     4e7:	83 c4 10             	add    $0x10,%esp
+     4ea:	c9                   	leave
+     4eb:	c3                   	ret
+     4ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004f0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     4f0:	55                   	push   %ebp
+     4f1:	89 e5                	mov    %esp,%ebp
+     4f3:	83 ec 0c             	sub    $0xc,%esp
+     4f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     4f9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+     4fd:	6a 40                	push   $0x40
+     4ff:	6a 01                	push   $0x1
+     501:	50                   	push   %eax
+     502:	e8 59 01 00 00       	call   660 <futex>
+}
+     507:	83 c4 10             	add    $0x10,%esp
+     50a:	c9                   	leave
+     50b:	c3                   	ret
+     50c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000510 <uptime>:
+// Clock ticks since boot, read from the kernel's vdso page
+// without a system call.
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     510:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+     515:	c3                   	ret
+
+00000516 <sysfork>:
+  1: ret
+
+#define SYSCALL(name) SYSCALLAS(name, name)
+
+// ulib.c wraps these.
+SYSCALLAS(sysfork, fork)
+     516:	b8 01 00 00 00       	mov    $0x1,%eax
+     51b:	89 e1                	mov    %esp,%ecx
+     51d:	ba 24 05 00 00       	mov    $0x524,%edx
+     522:	0f 34                	sysenter
+     524:	c3                   	ret
+
+00000525 <sysexit>:
+SYSCALLAS(sysexit, exit)
+     525:	b8 02 00 00 00       	mov    $0x2,%eax
+     52a:	89 e1                	mov    %esp,%ecx
+     52c:	ba 33 05 00 00       	mov    $0x533,%edx
+     531:	0f 34                	sysenter
+     533:	c3                   	ret
+
+00000534 <wait>:
+SYSCALL(wait)
+     534:	b8 03 00 00 00       	mov    $0x3,%eax
+     539:	89 e1                	mov    %esp,%ecx
+     53b:	ba 42 05 00 00       	mov    $0x542,%edx
+     540:	0f 34                	sysenter
+     542:	c3                   	ret
+
+00000543 <pipe>:
+SYSCALL(pipe)
+     543:	b8 04 00 00 00       	mov    $0x4,%eax
+     548:	89 e1                	mov    %esp,%ecx
+     54a:	ba 51 05 00 00       	mov    $0x551,%edx
+     54f:	0f 34                	sysenter
+     551:	c3                   	ret
+
+00000552 <read>:
+SYSCALL(read)
+     552:	b8 05 00 00 00       	mov    $0x5,%eax
+     557:	89 e1                	mov    %esp,%ecx
+     559:	ba 60 05 00 00       	mov    $0x560,%edx
+     55e:	0f 34                	sysenter
+     560:	c3                   	ret
+
+00000561 <write>:
+SYSCALL(write)
+     561:	b8 10 00 00 00       	mov    $0x10,%eax
+     566:	89 e1                	mov    %esp,%ecx
+     568:	ba 6f 05 00 00       	mov    $0x56f,%edx
+     56d:	0f 34                	sysenter
+     56f:	c3                   	ret
+
+00000570 <close>:
+SYSCALL(close)
+     570:	b8 15 00 00 00       	mov    $0x15,%eax
+     575:	89 e1                	mov    %esp,%ecx
+     577:	ba 7e 05 00 00       	mov    $0x57e,%edx
+     57c:	0f 34                	sysenter
+     57e:	c3                   	ret
+
+0000057f <kill>:
+SYSCALL(kill)
+     57f:	b8 06 00 00 00       	mov    $0x6,%eax
+     584:	89 e1                	mov    %esp,%ecx
+     586:	ba 8d 05 00 00       	mov    $0x58d,%edx
+     58b:	0f 34                	sysenter
+     58d:	c3                   	ret
+
+0000058e <sysexec>:
+SYSCALLAS(sysexec, exec)
+     58e:	b8 07 00 00 00       	mov    $0x7,%eax
+     593:	89 e1                	mov    %esp,%ecx
+     595:	ba 9c 05 00 00       	mov    $0x59c,%edx
+     59a:	0f 34                	sysenter
+     59c:	c3                   	ret
+
+0000059d <open>:
+SYSCALL(open)
+     59d:	b8 0f 00 00 00       	mov    $0xf,%eax
+     5a2:	89 e1                	mov    %esp,%ecx
+     5a4:	ba ab 05 00 00       	mov    $0x5ab,%edx
+     5a9:	0f 34                	sysenter
+     5ab:	c3                   	ret
+
+000005ac <mknod>:
+SYSCALL(mknod)
+     5ac:	b8 11 00 00 00       	mov    $0x11,%eax
+     5b1:	89 e1                	mov    %esp,%ecx
+     5b3:	ba ba 05 00 00       	mov    $0x5ba,%edx
+     5b8:	0f 34                	sysenter
+     5ba:	c3                   	ret
+
+000005bb <unlink>:
+SYSCALL(unlink)
+     5bb:	b8 12 00 00 00       	mov    $0x12,%eax
+     5c0:	89 e1                	mov    %esp,%ecx
+     5c2:	ba c9 05 00 00       	mov    $0x5c9,%edx
+     5c7:	0f 34                	sysenter
+     5c9:	c3                   	ret
+
+000005ca <fstat>:
+SYSCALL(fstat)
+     5ca:	b8 08 00 00 00       	mov    $0x8,%eax
+     5cf:	89 e1                	mov    %esp,%ecx
+     5d1:	ba d8 05 00 00       	mov    $0x5d8,%edx
+     5d6:	0f 34                	sysenter
+     5d8:	c3                   	ret
+
+000005d9 <link>:
+SYSCALL(link)
+     5d9:	b8 13 00 00 00       	mov    $0x13,%eax
+     5de:	89 e1                	mov    %esp,%ecx
+     5e0:	ba e7 05 00 00       	mov    $0x5e7,%edx
+     5e5:	0f 34                	sysenter
+     5e7:	c3                   	ret
+
+000005e8 <mkdir>:
+SYSCALL(mkdir)
+     5e8:	b8 14 00 00 00       	mov    $0x14,%eax
+     5ed:	89 e1                	mov    %esp,%ecx
+     5ef:	ba f6 05 00 00       	mov    $0x5f6,%edx
+     5f4:	0f 34                	sysenter
+     5f6:	c3                   	ret
+
+000005f7 <chdir>:
+SYSCALL(chdir)
+     5f7:	b8 09 00 00 00       	mov    $0x9,%eax
+     5fc:	89 e1                	mov    %esp,%ecx
+     5fe:	ba 05 06 00 00       	mov    $0x605,%edx
+     603:	0f 34                	sysenter
+     605:	c3                   	ret
+
+00000606 <dup>:
+SYSCALL(dup)
+     606:	b8 0a 00 00 00       	mov    $0xa,%eax
+     60b:	89 e1                	mov    %esp,%ecx
+     60d:	ba 14 06 00 00       	mov    $0x614,%edx
+     612:	0f 34                	sysenter
+     614:	c3                   	ret
+
+00000615 <getpid>:
+SYSCALL(getpid)
+     615:	b8 0b 00 00 00       	mov    $0xb,%eax
+     61a:	89 e1                	mov    %esp,%ecx
+     61c:	ba 23 06 00 00       	mov    $0x623,%edx
+     621:	0f 34                	sysenter
+     623:	c3                   	ret
+
+00000624 <sbrk>:
+SYSCALL(sbrk)
+     624:	b8 0c 00 00 00       	mov    $0xc,%eax
+     629:	89 e1                	mov    %esp,%ecx
+     62b:	ba 32 06 00 00       	mov    $0x632,%edx
+     630:	0f 34                	sysenter
+     632:	c3                   	ret
+
+00000633 <sleep>:
+SYSCALL(sleep)
+     633:	b8 0d 00 00 00       	mov    $0xd,%eax
+     638:	89 e1                	mov    %esp,%ecx
+     63a:	ba 41 06 00 00       	mov    $0x641,%edx
+     63f:	0f 34                	sysenter
+     641:	c3                   	ret
+
+00000642 <clone>:
+SYSCALL(clone)
+     642:	b8 16 00 00 00       	mov    $0x16,%eax
+     647:	89 e1                	mov    %esp,%ecx
+     649:	ba 50 06 00 00       	mov    $0x650,%edx
+     64e:	0f 34                	sysenter
+     650:	c3                   	ret
+
+00000651 <join>:
+SYSCALL(join)
+     651:	b8 17 00 00 00       	mov    $0x17,%eax
+     656:	89 e1                	mov    %esp,%ecx
+     658:	ba 5f 06 00 00       	mov    $0x65f,%edx
+     65d:	0f 34                	sysenter
+     65f:	c3                   	ret
+
+00000660 <futex>:
+SYSCALL(futex)
+     660:	b8 18 00 00 00       	mov    $0x18,%eax
+     665:	89 e1                	mov    %esp,%ecx
+     667:	ba 6e 06 00 00       	mov    $0x66e,%edx
+     66c:	0f 34                	sysenter
+     66e:	c3                   	ret
+
+0000066f <yield>:
+SYSCALL(yield)
+     66f:	b8 19 00 00 00       	mov    $0x19,%eax
+     674:	89 e1                	mov    %esp,%ecx
+     676:	ba 7d 06 00 00       	mov    $0x67d,%edx
+     67b:	0f 34                	sysenter
+     67d:	c3                   	ret
+
+0000067e <lockstat>:
+SYSCALL(lockstat)
+     67e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     683:	89 e1                	mov    %esp,%ecx
+     685:	ba 8c 06 00 00       	mov    $0x68c,%edx
+     68a:	0f 34                	sysenter
+     68c:	c3                   	ret
+
+0000068d <lockhammer>:
+SYSCALL(lockhammer)
+     68d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     692:	89 e1                	mov    %esp,%ecx
+     694:	ba 9b 06 00 00       	mov    $0x69b,%edx
+     699:	0f 34                	sysenter
+     69b:	c3                   	ret
+
+0000069c <vmsplice>:
+SYSCALL(vmsplice)
+     69c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     6a1:	89 e1                	mov    %esp,%ecx
+     6a3:	ba aa 06 00 00       	mov    $0x6aa,%edx
+     6a8:	0f 34                	sysenter
+     6aa:	c3                   	ret
+
+000006ab <hsbrk>:
+SYSCALL(hsbrk)
+     6ab:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     6b0:	89 e1                	mov    %esp,%ecx
+     6b2:	ba b9 06 00 00       	mov    $0x6b9,%edx
+     6b7:	0f 34                	sysenter
+     6b9:	c3                   	ret
+
+000006ba <mmap>:
+SYSCALL(mmap)
+     6ba:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     6bf:	89 e1                	mov    %esp,%ecx
+     6c1:	ba c8 06 00 00       	mov    $0x6c8,%edx
+     6c6:	0f 34                	sysenter
+     6c8:	c3                   	ret
+
+000006c9 <munmap>:
+SYSCALL(munmap)
+     6c9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     6ce:	89 e1                	mov    %esp,%ecx
+     6d0:	ba d7 06 00 00       	mov    $0x6d7,%edx
+     6d5:	0f 34                	sysenter
+     6d7:	c3                   	ret
+
+000006d8 <ringenter>:
+SYSCALL(ringenter)
+     6d8:	b8 20 00 00 00       	mov    $0x20,%eax
+     6dd:	89 e1                	mov    %esp,%ecx
+     6df:	ba e6 06 00 00       	mov    $0x6e6,%edx
+     6e4:	0f 34                	sysenter
+     6e6:	c3                   	ret
+
+000006e7 <readv>:
+SYSCALL(readv)
+     6e7:	b8 21 00 00 00       	mov    $0x21,%eax
+     6ec:	89 e1                	mov    %esp,%ecx
+     6ee:	ba f5 06 00 00       	mov    $0x6f5,%edx
+     6f3:	0f 34                	sysenter
+     6f5:	c3                   	ret
+
+000006f6 <writev>:
+SYSCALL(writev)
+     6f6:	b8 22 00 00 00       	mov    $0x22,%eax
+     6fb:	89 e1                	mov    %esp,%ecx
+     6fd:	ba 04 07 00 00       	mov    $0x704,%edx
+     702:	0f 34                	sysenter
+     704:	c3                   	ret
+
+00000705 <pread>:
+SYSCALL(pread)
+     705:	b8 23 00 00 00       	mov    $0x23,%eax
+     70a:	89 e1                	mov    %esp,%ecx
+     70c:	ba 13 07 00 00       	mov    $0x713,%edx
+     711:	0f 34                	sysenter
+     713:	c3                   	ret
+
+00000714 <pwrite>:
+SYSCALL(pwrite)
+     714:	b8 24 00 00 00       	mov    $0x24,%eax
+     719:	89 e1                	mov    %esp,%ecx
+     71b:	ba 22 07 00 00       	mov    $0x722,%edx
+     720:	0f 34                	sysenter
+     722:	c3                   	ret
+
+00000723 <prof>:
+SYSCALL(prof)
+     723:	b8 25 00 00 00       	mov    $0x25,%eax
+     728:	89 e1                	mov    %esp,%ecx
+     72a:	ba 31 07 00 00       	mov    $0x731,%edx
+     72f:	0f 34                	sysenter
+     731:	c3                   	ret
+
+00000732 <scstat>:
+SYSCALL(scstat)
+     732:	b8 26 00 00 00       	mov    $0x26,%eax
+     737:	89 e1                	mov    %esp,%ecx
+     739:	ba 40 07 00 00       	mov    $0x740,%edx
+     73e:	0f 34                	sysenter
+     740:	c3                   	ret
+     741:	66 90                	xchg   %ax,%ax
+     743:	66 90                	xchg   %ax,%ax
+     745:	66 90                	xchg   %ax,%ax
+     747:	66 90                	xchg   %ax,%ax
+     749:	66 90                	xchg   %ax,%ax
+     74b:	66 90                	xchg   %ax,%ax
+     74d:	66 90                	xchg   %ax,%ax
+     74f:	90                   	nop
+
+00000750 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+     750:	55                   	push   %ebp
+     751:	89 e5                	mov    %esp,%ebp
+     753:	57                   	push   %edi
+     754:	56                   	push   %esi
+     755:	53                   	push   %ebx
+     756:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     758:	89 d1                	mov    %edx,%ecx
+{
+     75a:	83 ec 2c             	sub    $0x2c,%esp
+     75d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+     760:	85 d2                	test   %edx,%edx
+     762:	79 7c                	jns    7e0 <printint+0x90>
+     764:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     768:	74 76                	je     7e0 <printint+0x90>
+    x = -xx;
+     76a:	f7 d9                	neg    %ecx
+    neg = 1;
+     76c:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     771:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     774:	31 f6                	xor    %esi,%esi
+     776:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     77d:	8d 76 00             	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     780:	89 c8                	mov    %ecx,%eax
+     782:	31 d2                	xor    %edx,%edx
+     784:	89 f7                	mov    %esi,%edi
+     786:	f7 f3                	div    %ebx
+     788:	8d 76 01             	lea    0x1(%esi),%esi
+     78b:	0f b6 92 c0 1e 00 00 	movzbl 0x1ec0(%edx),%edx
+     792:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     796:	89 ca                	mov    %ecx,%edx
+     798:	89 c1                	mov    %eax,%ecx
+     79a:	39 da                	cmp    %ebx,%edx
+     79c:	73 e2                	jae    780 <printint+0x30>
+  if(neg)
+     79e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     7a1:	85 c0                	test   %eax,%eax
+     7a3:	74 07                	je     7ac <printint+0x5c>
+    buf[i++] = '-';
+     7a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     7aa:	89 f7                	mov    %esi,%edi
+     7ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     7af:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     7b2:	01 df                	add    %ebx,%edi
+     7b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc_unlocked(buf[i], f);
+     7b8:	83 ec 08             	sub    $0x8,%esp
+     7bb:	56                   	push   %esi
+     7bc:	0f be 07             	movsbl (%edi),%eax
+     7bf:	50                   	push   %eax
+     7c0:	e8 cb 07 00 00       	call   f90 <putc_unlocked>
+  while(--i >= 0)
+     7c5:	89 f8                	mov    %edi,%eax
+     7c7:	83 c4 10             	add    $0x10,%esp
+     7ca:	83 ef 01             	sub    $0x1,%edi
+     7cd:	39 d8                	cmp    %ebx,%eax
+     7cf:	75 e7                	jne    7b8 <printint+0x68>
+}
+     7d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     7d4:	5b                   	pop    %ebx
+     7d5:	5e                   	pop    %esi
+     7d6:	5f                   	pop    %edi
+     7d7:	5d                   	pop    %ebp
+     7d8:	c3                   	ret
+     7d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     7e0:	31 c0                	xor    %eax,%eax
+     7e2:	eb 8d                	jmp    771 <printint+0x21>
+     7e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7ef:	90                   	nop
+
+000007f0 <vfprintf>:
+
+// Print to the given stream, which the caller has locked.
+// Only understands %d, %x, %p, %s.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+     7f0:	55                   	push   %ebp
+     7f1:	89 e5                	mov    %esp,%ebp
+     7f3:	57                   	push   %edi
+     7f4:	56                   	push   %esi
+     7f5:	53                   	push   %ebx
+     7f6:	83 ec 1c             	sub    $0x1c,%esp
+     7f9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     7fc:	0f b6 0a             	movzbl (%edx),%ecx
+     7ff:	84 c9                	test   %cl,%cl
+     801:	74 5c                	je     85f <vfprintf+0x6f>
+     803:	89 c6                	mov    %eax,%esi
+     805:	8d 5a 01             	lea    0x1(%edx),%ebx
+     808:	31 ff                	xor    %edi,%edi
+     80a:	eb 20                	jmp    82c <vfprintf+0x3c>
+     80c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     810:	83 f9 25             	cmp    $0x25,%ecx
+     813:	74 3b                	je     850 <vfprintf+0x60>
+        state = '%';
+      } else {
+        putc_unlocked(c, f);
+     815:	83 ec 08             	sub    $0x8,%esp
+     818:	56                   	push   %esi
+     819:	51                   	push   %ecx
+     81a:	e8 71 07 00 00       	call   f90 <putc_unlocked>
+     81f:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     822:	0f b6 0b             	movzbl (%ebx),%ecx
+     825:	83 c3 01             	add    $0x1,%ebx
+     828:	84 c9                	test   %cl,%cl
+     82a:	74 33                	je     85f <vfprintf+0x6f>
+    if(state == 0){
+     82c:	85 ff                	test   %edi,%edi
+     82e:	74 e0                	je     810 <vfprintf+0x20>
+      }
+    } else if(state == '%'){
+     830:	83 ff 25             	cmp    $0x25,%edi
+     833:	75 ed                	jne    822 <vfprintf+0x32>
+      if(c == 'd'){
+     835:	83 f9 25             	cmp    $0x25,%ecx
+     838:	0f 84 02 01 00 00    	je     940 <vfprintf+0x150>
+     83e:	8d 41 9d             	lea    -0x63(%ecx),%eax
+     841:	83 f8 15             	cmp    $0x15,%eax
+     844:	77 2a                	ja     870 <vfprintf+0x80>
+     846:	ff 24 85 68 1e 00 00 	jmp    *0x1e68(,%eax,4)
+     84d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     850:	0f b6 0b             	movzbl (%ebx),%ecx
+     853:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     856:	bf 25 00 00 00       	mov    $0x25,%edi
+  for(i = 0; fmt[i]; i++){
+     85b:	84 c9                	test   %cl,%cl
+     85d:	75 cd                	jne    82c <vfprintf+0x3c>
+        putc_unlocked(c, f);
+      }
+      state = 0;
+    }
+  }
+}
+     85f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     862:	5b                   	pop    %ebx
+     863:	5e                   	pop    %esi
+     864:	5f                   	pop    %edi
+     865:	5d                   	pop    %ebp
+     866:	c3                   	ret
+     867:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     86e:	66 90                	xchg   %ax,%ax
+        putc_unlocked('%', f);
+     870:	83 ec 08             	sub    $0x8,%esp
+     873:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     876:	56                   	push   %esi
+     877:	6a 25                	push   $0x25
+     879:	e8 12 07 00 00       	call   f90 <putc_unlocked>
+        putc_unlocked(c, f);
+     87e:	58                   	pop    %eax
+     87f:	5a                   	pop    %edx
+     880:	56                   	push   %esi
+     881:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     884:	51                   	push   %ecx
+     885:	e8 06 07 00 00       	call   f90 <putc_unlocked>
+     88a:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     88d:	31 ff                	xor    %edi,%edi
+     88f:	eb 91                	jmp    822 <vfprintf+0x32>
+     891:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+     898:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     89b:	83 ec 0c             	sub    $0xc,%esp
+     89e:	b9 10 00 00 00       	mov    $0x10,%ecx
+     8a3:	8b 17                	mov    (%edi),%edx
+     8a5:	6a 00                	push   $0x0
+        ap++;
+     8a7:	83 c7 04             	add    $0x4,%edi
+        printint(f, *ap, 16, 0);
+     8aa:	89 f0                	mov    %esi,%eax
+     8ac:	e8 9f fe ff ff       	call   750 <printint>
+        ap++;
+     8b1:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     8b4:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     8b7:	31 ff                	xor    %edi,%edi
+     8b9:	e9 64 ff ff ff       	jmp    822 <vfprintf+0x32>
+     8be:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     8c0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     8c3:	8b 10                	mov    (%eax),%edx
+        ap++;
+     8c5:	83 c0 04             	add    $0x4,%eax
+     8c8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     8cb:	85 d2                	test   %edx,%edx
+     8cd:	0f 84 85 00 00 00    	je     958 <vfprintf+0x168>
+        while(*s != 0){
+     8d3:	0f be 02             	movsbl (%edx),%eax
+        s = (char*)*ap;
+     8d6:	89 d7                	mov    %edx,%edi
+        while(*s != 0){
+     8d8:	84 c0                	test   %al,%al
+     8da:	74 b1                	je     88d <vfprintf+0x9d>
+     8dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+          putc_unlocked(*s, f);
+     8e0:	83 ec 08             	sub    $0x8,%esp
+          s++;
+     8e3:	83 c7 01             	add    $0x1,%edi
+          putc_unlocked(*s, f);
+     8e6:	56                   	push   %esi
+     8e7:	50                   	push   %eax
+     8e8:	e8 a3 06 00 00       	call   f90 <putc_unlocked>
+        while(*s != 0){
+     8ed:	0f be 07             	movsbl (%edi),%eax
+     8f0:	83 c4 10             	add    $0x10,%esp
+     8f3:	84 c0                	test   %al,%al
+     8f5:	75 e9                	jne    8e0 <vfprintf+0xf0>
+      state = 0;
+     8f7:	31 ff                	xor    %edi,%edi
+     8f9:	e9 24 ff ff ff       	jmp    822 <vfprintf+0x32>
+     8fe:	66 90                	xchg   %ax,%ax
+        printint(f, *ap, 10, 1);
+     900:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     903:	83 ec 0c             	sub    $0xc,%esp
+     906:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     90b:	8b 17                	mov    (%edi),%edx
+     90d:	6a 01                	push   $0x1
+     90f:	eb 96                	jmp    8a7 <vfprintf+0xb7>
+     911:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc_unlocked(*ap, f);
+     918:	83 ec 08             	sub    $0x8,%esp
+     91b:	56                   	push   %esi
+     91c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     91f:	ff 37                	push   (%edi)
+     921:	e8 6a 06 00 00       	call   f90 <putc_unlocked>
+        ap++;
+     926:	89 f8                	mov    %edi,%eax
+     928:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     92b:	31 ff                	xor    %edi,%edi
+        ap++;
+     92d:	83 c0 04             	add    $0x4,%eax
+     930:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     933:	e9 ea fe ff ff       	jmp    822 <vfprintf+0x32>
+     938:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     93f:	90                   	nop
+        putc_unlocked(c, f);
+     940:	83 ec 08             	sub    $0x8,%esp
+      state = 0;
+     943:	31 ff                	xor    %edi,%edi
+        putc_unlocked(c, f);
+     945:	56                   	push   %esi
+     946:	6a 25                	push   $0x25
+     948:	e8 43 06 00 00       	call   f90 <putc_unlocked>
+     94d:	83 c4 10             	add    $0x10,%esp
+     950:	e9 cd fe ff ff       	jmp    822 <vfprintf+0x32>
+     955:	8d 76 00             	lea    0x0(%esi),%esi
+     958:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     95d:	bf 5f 1e 00 00       	mov    $0x1e5f,%edi
+     962:	e9 79 ff ff ff       	jmp    8e0 <vfprintf+0xf0>
+     967:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     96e:	66 90                	xchg   %ax,%ax
+
+00000970 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+     970:	55                   	push   %ebp
+     971:	89 e5                	mov    %esp,%ebp
+     973:	53                   	push   %ebx
+     974:	83 ec 10             	sub    $0x10,%esp
+     977:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  flockfile(f);
+     97a:	53                   	push   %ebx
+     97b:	e8 d0 02 00 00       	call   c50 <flockfile>
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     980:	8b 55 0c             	mov    0xc(%ebp),%edx
+     983:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     986:	89 d8                	mov    %ebx,%eax
+     988:	e8 63 fe ff ff       	call   7f0 <vfprintf>
+  funlockfile(f);
+     98d:	89 1c 24             	mov    %ebx,(%esp)
+     990:	e8 eb 02 00 00       	call   c80 <funlockfile>
+}
+     995:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     998:	83 c4 10             	add    $0x10,%esp
+     99b:	c9                   	leave
+     99c:	c3                   	ret
+     99d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009a0 <printf>:
+
+// Print to the given fd: through stdout or stderr for 1 and 2,
+// otherwise with one write() per call.
+void
+printf(int fd, const char *fmt, ...)
+{
+     9a0:	55                   	push   %ebp
+     9a1:	89 e5                	mov    %esp,%ebp
+     9a3:	56                   	push   %esi
+     9a4:	53                   	push   %ebx
+     9a5:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+     9ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  char buf[128];
+  struct iobuf f;
+
+  if(fd == 1 || fd == 2){
+    flockfile(&_iob[fd]);
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     9ae:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(fd == 1 || fd == 2){
+     9b1:	8d 50 ff             	lea    -0x1(%eax),%edx
+     9b4:	83 fa 01             	cmp    $0x1,%edx
+     9b7:	76 77                	jbe    a30 <printf+0x90>
+    funlockfile(&_iob[fd]);
+    return;
+  }
+  f.fd = fd;
+     9b9:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  f.flags = IO_WRITE|IO_SETUP;
+  f.buf = buf;
+     9bf:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  f.size = sizeof(buf);
+  f.r = f.n = 0;
+  mutex_init(&f.lock);
+     9c5:	83 ec 0c             	sub    $0xc,%esp
+     9c8:	8d 9d 5c ff ff ff    	lea    -0xa4(%ebp),%ebx
+  f.buf = buf;
+     9ce:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+  mutex_init(&f.lock);
+     9d4:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  f.flags = IO_WRITE|IO_SETUP;
+     9da:	c7 85 60 ff ff ff 42 	movl   $0x42,-0xa0(%ebp)
+     9e1:	00 00 00 
+  f.size = sizeof(buf);
+     9e4:	c7 85 68 ff ff ff 80 	movl   $0x80,-0x98(%ebp)
+     9eb:	00 00 00 
+  f.r = f.n = 0;
+     9ee:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+     9f5:	00 00 00 
+     9f8:	c7 85 6c ff ff ff 00 	movl   $0x0,-0x94(%ebp)
+     9ff:	00 00 00 
+  mutex_init(&f.lock);
+     a02:	50                   	push   %eax
+     a03:	e8 d8 f9 ff ff       	call   3e0 <mutex_init>
+  vfprintf(&f, fmt, (uint*)(void*)&fmt + 1);
+     a08:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     a0b:	89 f2                	mov    %esi,%edx
+     a0d:	89 d8                	mov    %ebx,%eax
+     a0f:	e8 dc fd ff ff       	call   7f0 <vfprintf>
+  fflush(&f);
+     a14:	89 1c 24             	mov    %ebx,(%esp)
+     a17:	e8 f4 04 00 00       	call   f10 <fflush>
+     a1c:	83 c4 10             	add    $0x10,%esp
+}
+     a1f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     a22:	5b                   	pop    %ebx
+     a23:	5e                   	pop    %esi
+     a24:	5d                   	pop    %ebp
+     a25:	c3                   	ret
+     a26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a2d:	8d 76 00             	lea    0x0(%esi),%esi
+    flockfile(&_iob[fd]);
+     a30:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     a33:	83 ec 0c             	sub    $0xc,%esp
+     a36:	8d 98 60 28 00 00    	lea    0x2860(%eax),%ebx
+     a3c:	53                   	push   %ebx
+     a3d:	e8 0e 02 00 00       	call   c50 <flockfile>
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     a42:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     a45:	89 f2                	mov    %esi,%edx
+     a47:	89 d8                	mov    %ebx,%eax
+     a49:	e8 a2 fd ff ff       	call   7f0 <vfprintf>
+    funlockfile(&_iob[fd]);
+     a4e:	89 1c 24             	mov    %ebx,(%esp)
+     a51:	e8 2a 02 00 00       	call   c80 <funlockfile>
+     a56:	83 c4 10             	add    $0x10,%esp
+}
+     a59:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     a5c:	5b                   	pop    %ebx
+     a5d:	5e                   	pop    %esi
+     a5e:	5d                   	pop    %ebp
+     a5f:	c3                   	ret
+
+00000a60 <setup>:
+}
+
+// Choose how to buffer f on first use: by lines on a device.
+static void
+setup(FILE *f)
+{
+     a60:	55                   	push   %ebp
+     a61:	89 e5                	mov    %esp,%ebp
+     a63:	53                   	push   %ebx
+     a64:	89 c3                	mov    %eax,%ebx
+     a66:	83 ec 2c             	sub    $0x2c,%esp
+  struct stat st;
+
+  f->flags |= IO_SETUP;
+     a69:	83 48 04 40          	orl    $0x40,0x4(%eax)
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     a6d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     a70:	50                   	push   %eax
+     a71:	ff 33                	push   (%ebx)
+     a73:	e8 52 fb ff ff       	call   5ca <fstat>
+     a78:	83 c4 10             	add    $0x10,%esp
+     a7b:	85 c0                	test   %eax,%eax
+    f->flags |= IO_DEV|IO_LINE;
+     a7d:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     a80:	75 07                	jne    a89 <setup+0x29>
+     a82:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+     a87:	74 17                	je     aa0 <setup+0x40>
+  if(f->flags & IO_WRITE)
+     a89:	a8 02                	test   $0x2,%al
+     a8b:	74 0a                	je     a97 <setup+0x37>
+    flushhook = flushall;
+     a8d:	c7 05 40 2b 00 00 c0 	movl   $0xbc0,0x2b40
+     a94:	0b 00 00 
+}
+     a97:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a9a:	c9                   	leave
+     a9b:	c3                   	ret
+     a9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    f->flags |= IO_DEV|IO_LINE;
+     aa0:	83 c8 30             	or     $0x30,%eax
+     aa3:	89 43 04             	mov    %eax,0x4(%ebx)
+     aa6:	eb e1                	jmp    a89 <setup+0x29>
+     aa8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aaf:	90                   	nop
+
+00000ab0 <flush>:
+static int
+flush(FILE *f)
+{
+  int i, n;
+
+  if(!(f->flags & IO_WRITE))
+     ab0:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+     ab4:	74 6a                	je     b20 <flush+0x70>
+{
+     ab6:	55                   	push   %ebp
+     ab7:	89 e5                	mov    %esp,%ebp
+     ab9:	56                   	push   %esi
+     aba:	89 c6                	mov    %eax,%esi
+     abc:	53                   	push   %ebx
+    return 0;
+  for(i = 0; i < f->n; i += n){
+     abd:	8b 40 14             	mov    0x14(%eax),%eax
+     ac0:	85 c0                	test   %eax,%eax
+     ac2:	7e 4c                	jle    b10 <flush+0x60>
+     ac4:	31 db                	xor    %ebx,%ebx
+     ac6:	eb 11                	jmp    ad9 <flush+0x29>
+     ac8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     acf:	90                   	nop
+     ad0:	01 c3                	add    %eax,%ebx
+     ad2:	8b 46 14             	mov    0x14(%esi),%eax
+     ad5:	39 d8                	cmp    %ebx,%eax
+     ad7:	7e 37                	jle    b10 <flush+0x60>
+    if((n = write(f->fd, f->buf + i, f->n - i)) <= 0){
+     ad9:	83 ec 04             	sub    $0x4,%esp
+     adc:	29 d8                	sub    %ebx,%eax
+     ade:	50                   	push   %eax
+     adf:	8b 46 08             	mov    0x8(%esi),%eax
+     ae2:	01 d8                	add    %ebx,%eax
+     ae4:	50                   	push   %eax
+     ae5:	ff 36                	push   (%esi)
+     ae7:	e8 75 fa ff ff       	call   561 <write>
+     aec:	83 c4 10             	add    $0x10,%esp
+     aef:	85 c0                	test   %eax,%eax
+     af1:	7f dd                	jg     ad0 <flush+0x20>
+      f->flags |= IO_ERR;
+     af3:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+      f->n = 0;
+     af7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     afc:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+      return EOF;
+    }
+  }
+  f->n = 0;
+  return 0;
+}
+     b03:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b06:	5b                   	pop    %ebx
+     b07:	5e                   	pop    %esi
+     b08:	5d                   	pop    %ebp
+     b09:	c3                   	ret
+     b0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->n = 0;
+     b10:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+}
+     b17:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+     b1a:	31 c0                	xor    %eax,%eax
+}
+     b1c:	5b                   	pop    %ebx
+     b1d:	5e                   	pop    %esi
+     b1e:	5d                   	pop    %ebp
+     b1f:	c3                   	ret
+    return 0;
+     b20:	31 c0                	xor    %eax,%eax
+}
+     b22:	c3                   	ret
+     b23:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000b30 <fflush.part.0>:
+fflush(FILE *f)
+     b30:	55                   	push   %ebp
+     b31:	89 e5                	mov    %esp,%ebp
+     b33:	57                   	push   %edi
+     b34:	bf 58 29 00 00       	mov    $0x2958,%edi
+     b39:	56                   	push   %esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     b3a:	31 f6                	xor    %esi,%esi
+fflush(FILE *f)
+     b3c:	53                   	push   %ebx
+     b3d:	bb 78 28 00 00       	mov    $0x2878,%ebx
+     b42:	83 ec 1c             	sub    $0x1c,%esp
+     b45:	eb 10                	jmp    b57 <fflush.part.0+0x27>
+     b47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b4e:	66 90                	xchg   %ax,%ax
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     b50:	83 c3 1c             	add    $0x1c,%ebx
+     b53:	39 df                	cmp    %ebx,%edi
+     b55:	74 33                	je     b8a <fflush.part.0+0x5a>
+      if((f->flags & IO_WRITE) && fflush(f) < 0)
+     b57:	f6 43 ec 02          	testb  $0x2,-0x14(%ebx)
+     b5b:	74 f3                	je     b50 <fflush.part.0+0x20>
+  if(threaded)
+     b5d:	8b 0d 60 2b 00 00    	mov    0x2b60,%ecx
+     b63:	85 c9                	test   %ecx,%ecx
+     b65:	75 49                	jne    bb0 <fflush.part.0+0x80>
+  r = flush(f);
+     b67:	8d 43 e8             	lea    -0x18(%ebx),%eax
+     b6a:	e8 41 ff ff ff       	call   ab0 <flush>
+  if(threaded)
+     b6f:	8b 15 60 2b 00 00    	mov    0x2b60,%edx
+     b75:	85 d2                	test   %edx,%edx
+     b77:	75 1f                	jne    b98 <fflush.part.0+0x68>
+        r = EOF;
+     b79:	85 c0                	test   %eax,%eax
+     b7b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     b80:	0f 48 f0             	cmovs  %eax,%esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     b83:	83 c3 1c             	add    $0x1c,%ebx
+     b86:	39 df                	cmp    %ebx,%edi
+     b88:	75 cd                	jne    b57 <fflush.part.0+0x27>
+}
+     b8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b8d:	89 f0                	mov    %esi,%eax
+     b8f:	5b                   	pop    %ebx
+     b90:	5e                   	pop    %esi
+     b91:	5f                   	pop    %edi
+     b92:	5d                   	pop    %ebp
+     b93:	c3                   	ret
+     b94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     b98:	83 ec 0c             	sub    $0xc,%esp
+     b9b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     b9e:	53                   	push   %ebx
+     b9f:	e8 9c f8 ff ff       	call   440 <mutex_unlock>
+     ba4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     ba7:	83 c4 10             	add    $0x10,%esp
+     baa:	eb cd                	jmp    b79 <fflush.part.0+0x49>
+     bac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     bb0:	83 ec 0c             	sub    $0xc,%esp
+     bb3:	53                   	push   %ebx
+     bb4:	e8 37 f8 ff ff       	call   3f0 <mutex_lock>
+     bb9:	83 c4 10             	add    $0x10,%esp
+     bbc:	eb a9                	jmp    b67 <fflush.part.0+0x37>
+     bbe:	66 90                	xchg   %ax,%ax
+
+00000bc0 <flushall>:
+  if(f == 0){
+     bc0:	e9 6b ff ff ff       	jmp    b30 <fflush.part.0>
+     bc5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000bd0 <fill>:
+
+// Refill f's buffer. Returns the number of bytes read.
+// Caller holds f's lock.
+static int
+fill(FILE *f)
+{
+     bd0:	55                   	push   %ebp
+     bd1:	89 e5                	mov    %esp,%ebp
+     bd3:	53                   	push   %ebx
+     bd4:	89 c3                	mov    %eax,%ebx
+     bd6:	83 ec 04             	sub    $0x4,%esp
+  int n;
+
+  if(!(f->flags & IO_SETUP))
+     bd9:	8b 40 04             	mov    0x4(%eax),%eax
+     bdc:	a8 40                	test   $0x40,%al
+     bde:	74 50                	je     c30 <fill+0x60>
+    setup(f);
+  if(f->flags & IO_DEV)
+     be0:	a8 20                	test   $0x20,%al
+     be2:	75 3c                	jne    c20 <fill+0x50>
+    fflush(0);
+  f->r = 0;
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     be4:	83 ec 04             	sub    $0x4,%esp
+  f->r = 0;
+     be7:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     bee:	ff 73 0c             	push   0xc(%ebx)
+     bf1:	ff 73 08             	push   0x8(%ebx)
+     bf4:	ff 33                	push   (%ebx)
+     bf6:	e8 57 f9 ff ff       	call   552 <read>
+     bfb:	83 c4 10             	add    $0x10,%esp
+     bfe:	85 c0                	test   %eax,%eax
+     c00:	7f 10                	jg     c12 <fill+0x42>
+    f->flags |= n < 0 ? IO_ERR : IO_EOF;
+     c02:	83 f8 01             	cmp    $0x1,%eax
+     c05:	19 c0                	sbb    %eax,%eax
+     c07:	83 e0 fc             	and    $0xfffffffc,%eax
+     c0a:	83 c0 08             	add    $0x8,%eax
+     c0d:	09 43 04             	or     %eax,0x4(%ebx)
+    n = 0;
+     c10:	31 c0                	xor    %eax,%eax
+  }
+  f->n = n;
+     c12:	89 43 14             	mov    %eax,0x14(%ebx)
+  return n;
+}
+     c15:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c18:	c9                   	leave
+     c19:	c3                   	ret
+     c1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == 0){
+     c20:	e8 0b ff ff ff       	call   b30 <fflush.part.0>
+     c25:	eb bd                	jmp    be4 <fill+0x14>
+     c27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c2e:	66 90                	xchg   %ax,%ax
+    setup(f);
+     c30:	89 d8                	mov    %ebx,%eax
+     c32:	e8 29 fe ff ff       	call   a60 <setup>
+  if(f->flags & IO_DEV)
+     c37:	8b 43 04             	mov    0x4(%ebx),%eax
+     c3a:	eb a4                	jmp    be0 <fill+0x10>
+     c3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c40 <stdio_threaded>:
+  threaded = 1;
+     c40:	c7 05 60 2b 00 00 01 	movl   $0x1,0x2b60
+     c47:	00 00 00 
+}
+     c4a:	c3                   	ret
+     c4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c4f:	90                   	nop
+
+00000c50 <flockfile>:
+{
+     c50:	55                   	push   %ebp
+  if(threaded)
+     c51:	8b 15 60 2b 00 00    	mov    0x2b60,%edx
+{
+     c57:	89 e5                	mov    %esp,%ebp
+     c59:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     c5c:	85 d2                	test   %edx,%edx
+     c5e:	75 08                	jne    c68 <flockfile+0x18>
+}
+     c60:	5d                   	pop    %ebp
+     c61:	c3                   	ret
+     c62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_lock(&f->lock);
+     c68:	83 c0 18             	add    $0x18,%eax
+     c6b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     c6e:	5d                   	pop    %ebp
+    mutex_lock(&f->lock);
+     c6f:	e9 7c f7 ff ff       	jmp    3f0 <mutex_lock>
+     c74:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c7f:	90                   	nop
+
+00000c80 <funlockfile>:
+{
+     c80:	55                   	push   %ebp
+  if(threaded)
+     c81:	8b 15 60 2b 00 00    	mov    0x2b60,%edx
+{
+     c87:	89 e5                	mov    %esp,%ebp
+     c89:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     c8c:	85 d2                	test   %edx,%edx
+     c8e:	75 08                	jne    c98 <funlockfile+0x18>
+}
+     c90:	5d                   	pop    %ebp
+     c91:	c3                   	ret
+     c92:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&f->lock);
+     c98:	83 c0 18             	add    $0x18,%eax
+     c9b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     c9e:	5d                   	pop    %ebp
+    mutex_unlock(&f->lock);
+     c9f:	e9 9c f7 ff ff       	jmp    440 <mutex_unlock>
+     ca4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     caf:	90                   	nop
+
+00000cb0 <fopen>:
+{
+     cb0:	55                   	push   %ebp
+     cb1:	89 e5                	mov    %esp,%ebp
+     cb3:	57                   	push   %edi
+     cb4:	56                   	push   %esi
+     cb5:	53                   	push   %ebx
+     cb6:	83 ec 34             	sub    $0x34,%esp
+     cb9:	8b 75 0c             	mov    0xc(%ebp),%esi
+     cbc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(strcmp(mode, "r") != 0 && strcmp(mode, "w") != 0)
+     cbf:	68 d1 1e 00 00       	push   $0x1ed1
+     cc4:	56                   	push   %esi
+     cc5:	e8 66 f5 ff ff       	call   230 <strcmp>
+     cca:	83 c4 10             	add    $0x10,%esp
+     ccd:	85 c0                	test   %eax,%eax
+     ccf:	74 15                	je     ce6 <fopen+0x36>
+     cd1:	83 ec 08             	sub    $0x8,%esp
+     cd4:	68 d3 1e 00 00       	push   $0x1ed3
+     cd9:	56                   	push   %esi
+     cda:	e8 51 f5 ff ff       	call   230 <strcmp>
+     cdf:	83 c4 10             	add    $0x10,%esp
+     ce2:	85 c0                	test   %eax,%eax
+     ce4:	75 2c                	jne    d12 <fopen+0x62>
+  if(threaded)
+     ce6:	a1 60 2b 00 00       	mov    0x2b60,%eax
+     ceb:	85 c0                	test   %eax,%eax
+     ced:	0f 85 ed 00 00 00    	jne    de0 <fopen+0x130>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     cf3:	bb b4 28 00 00       	mov    $0x28b4,%ebx
+    if(f->flags == 0)
+     cf8:	8b 53 04             	mov    0x4(%ebx),%edx
+     cfb:	85 d2                	test   %edx,%edx
+     cfd:	74 21                	je     d20 <fopen+0x70>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     cff:	83 c3 1c             	add    $0x1c,%ebx
+     d02:	81 fb 40 29 00 00    	cmp    $0x2940,%ebx
+     d08:	75 ee                	jne    cf8 <fopen+0x48>
+  if(threaded)
+     d0a:	85 c0                	test   %eax,%eax
+     d0c:	0f 85 36 01 00 00    	jne    e48 <fopen+0x198>
+    return 0;
+     d12:	31 db                	xor    %ebx,%ebx
+     d14:	e9 96 00 00 00       	jmp    daf <fopen+0xff>
+     d19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f == &_iob[NSTREAM])
+     d20:	81 fb 40 29 00 00    	cmp    $0x2940,%ebx
+     d26:	74 e2                	je     d0a <fopen+0x5a>
+    f->flags = IO_MALLOC;
+     d28:	c7 43 04 80 00 00 00 	movl   $0x80,0x4(%ebx)
+  if(threaded)
+     d2f:	85 c0                	test   %eax,%eax
+     d31:	0f 85 f9 00 00 00    	jne    e30 <fopen+0x180>
+  if(mode[0] == 'r'){
+     d37:	80 3e 72             	cmpb   $0x72,(%esi)
+     d3a:	0f 84 c0 00 00 00    	je     e00 <fopen+0x150>
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     d40:	83 ec 08             	sub    $0x8,%esp
+     d43:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     d46:	50                   	push   %eax
+     d47:	57                   	push   %edi
+     d48:	e8 d3 f5 ff ff       	call   320 <stat>
+     d4d:	83 c4 10             	add    $0x10,%esp
+     d50:	85 c0                	test   %eax,%eax
+     d52:	74 6c                	je     dc0 <fopen+0x110>
+    fd = open(path, O_CREATE|O_WRONLY);
+     d54:	83 ec 08             	sub    $0x8,%esp
+     d57:	68 01 02 00 00       	push   $0x201
+     d5c:	57                   	push   %edi
+    flags = IO_WRITE;
+     d5d:	bf 02 00 00 00       	mov    $0x2,%edi
+    fd = open(path, O_CREATE|O_WRONLY);
+     d62:	e8 36 f8 ff ff       	call   59d <open>
+     d67:	83 c4 10             	add    $0x10,%esp
+     d6a:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     d6c:	85 f6                	test   %esi,%esi
+     d6e:	0f 88 a9 00 00 00    	js     e1d <fopen+0x16d>
+     d74:	83 ec 0c             	sub    $0xc,%esp
+     d77:	68 00 02 00 00       	push   $0x200
+     d7c:	e8 af 0c 00 00       	call   1a30 <malloc>
+     d81:	83 c4 10             	add    $0x10,%esp
+     d84:	89 43 08             	mov    %eax,0x8(%ebx)
+     d87:	85 c0                	test   %eax,%eax
+     d89:	0f 84 d0 00 00 00    	je     e5f <fopen+0x1af>
+  f->flags = flags|IO_MALLOC;
+     d8f:	81 cf 80 00 00 00    	or     $0x80,%edi
+  f->fd = fd;
+     d95:	89 33                	mov    %esi,(%ebx)
+  f->size = BUFSIZ;
+     d97:	c7 43 0c 00 02 00 00 	movl   $0x200,0xc(%ebx)
+  f->r = f->n = 0;
+     d9e:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+     da5:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  f->flags = flags|IO_MALLOC;
+     dac:	89 7b 04             	mov    %edi,0x4(%ebx)
+}
+     daf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     db2:	89 d8                	mov    %ebx,%eax
+     db4:	5b                   	pop    %ebx
+     db5:	5e                   	pop    %esi
+     db6:	5f                   	pop    %edi
+     db7:	5d                   	pop    %ebp
+     db8:	c3                   	ret
+     db9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     dc0:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+     dc5:	75 8d                	jne    d54 <fopen+0xa4>
+      unlink(path);
+     dc7:	83 ec 0c             	sub    $0xc,%esp
+     dca:	57                   	push   %edi
+     dcb:	e8 eb f7 ff ff       	call   5bb <unlink>
+     dd0:	83 c4 10             	add    $0x10,%esp
+     dd3:	e9 7c ff ff ff       	jmp    d54 <fopen+0xa4>
+     dd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ddf:	90                   	nop
+    mutex_lock(&iolock);
+     de0:	83 ec 0c             	sub    $0xc,%esp
+     de3:	68 64 2b 00 00       	push   $0x2b64
+     de8:	e8 03 f6 ff ff       	call   3f0 <mutex_lock>
+  if(threaded)
+     ded:	a1 60 2b 00 00       	mov    0x2b60,%eax
+     df2:	83 c4 10             	add    $0x10,%esp
+     df5:	e9 f9 fe ff ff       	jmp    cf3 <fopen+0x43>
+     dfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    fd = open(path, O_RDONLY);
+     e00:	83 ec 08             	sub    $0x8,%esp
+     e03:	6a 00                	push   $0x0
+     e05:	57                   	push   %edi
+    flags = IO_READ;
+     e06:	bf 01 00 00 00       	mov    $0x1,%edi
+    fd = open(path, O_RDONLY);
+     e0b:	e8 8d f7 ff ff       	call   59d <open>
+     e10:	83 c4 10             	add    $0x10,%esp
+     e13:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     e15:	85 f6                	test   %esi,%esi
+     e17:	0f 89 57 ff ff ff    	jns    d74 <fopen+0xc4>
+    f->flags = 0;
+     e1d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    return 0;
+     e24:	31 db                	xor    %ebx,%ebx
+     e26:	eb 87                	jmp    daf <fopen+0xff>
+     e28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e2f:	90                   	nop
+    mutex_unlock(&iolock);
+     e30:	83 ec 0c             	sub    $0xc,%esp
+     e33:	68 64 2b 00 00       	push   $0x2b64
+     e38:	e8 03 f6 ff ff       	call   440 <mutex_unlock>
+     e3d:	83 c4 10             	add    $0x10,%esp
+     e40:	e9 f2 fe ff ff       	jmp    d37 <fopen+0x87>
+     e45:	8d 76 00             	lea    0x0(%esi),%esi
+     e48:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+     e4b:	31 db                	xor    %ebx,%ebx
+    mutex_unlock(&iolock);
+     e4d:	68 64 2b 00 00       	push   $0x2b64
+     e52:	e8 e9 f5 ff ff       	call   440 <mutex_unlock>
+     e57:	83 c4 10             	add    $0x10,%esp
+     e5a:	e9 50 ff ff ff       	jmp    daf <fopen+0xff>
+      close(fd);
+     e5f:	83 ec 0c             	sub    $0xc,%esp
+     e62:	56                   	push   %esi
+     e63:	e8 08 f7 ff ff       	call   570 <close>
+     e68:	83 c4 10             	add    $0x10,%esp
+     e6b:	eb b0                	jmp    e1d <fopen+0x16d>
+     e6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e70 <fclose>:
+{
+     e70:	55                   	push   %ebp
+     e71:	89 e5                	mov    %esp,%ebp
+     e73:	56                   	push   %esi
+     e74:	53                   	push   %ebx
+  if(threaded)
+     e75:	8b 15 60 2b 00 00    	mov    0x2b60,%edx
+{
+     e7b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+     e7e:	85 d2                	test   %edx,%edx
+     e80:	75 46                	jne    ec8 <fclose+0x58>
+  r = flush(f);
+     e82:	89 d8                	mov    %ebx,%eax
+     e84:	e8 27 fc ff ff       	call   ab0 <flush>
+  if(close(f->fd) < 0)
+     e89:	83 ec 0c             	sub    $0xc,%esp
+     e8c:	ff 33                	push   (%ebx)
+  r = flush(f);
+     e8e:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+     e90:	e8 db f6 ff ff       	call   570 <close>
+     e95:	83 c4 10             	add    $0x10,%esp
+    r = EOF;
+     e98:	85 c0                	test   %eax,%eax
+     e9a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     e9f:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->flags & IO_MALLOC)
+     ea2:	f6 43 04 80          	testb  $0x80,0x4(%ebx)
+     ea6:	75 58                	jne    f00 <fclose+0x90>
+  if(threaded)
+     ea8:	a1 60 2b 00 00       	mov    0x2b60,%eax
+  f->flags = 0;
+     ead:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  if(threaded)
+     eb4:	85 c0                	test   %eax,%eax
+     eb6:	75 28                	jne    ee0 <fclose+0x70>
+}
+     eb8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ebb:	89 f0                	mov    %esi,%eax
+     ebd:	5b                   	pop    %ebx
+     ebe:	5e                   	pop    %esi
+     ebf:	5d                   	pop    %ebp
+     ec0:	c3                   	ret
+     ec1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     ec8:	83 ec 0c             	sub    $0xc,%esp
+     ecb:	8d 43 18             	lea    0x18(%ebx),%eax
+     ece:	50                   	push   %eax
+     ecf:	e8 1c f5 ff ff       	call   3f0 <mutex_lock>
+     ed4:	83 c4 10             	add    $0x10,%esp
+     ed7:	eb a9                	jmp    e82 <fclose+0x12>
+     ed9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     ee0:	83 ec 0c             	sub    $0xc,%esp
+     ee3:	83 c3 18             	add    $0x18,%ebx
+     ee6:	53                   	push   %ebx
+     ee7:	e8 54 f5 ff ff       	call   440 <mutex_unlock>
+     eec:	83 c4 10             	add    $0x10,%esp
+}
+     eef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ef2:	89 f0                	mov    %esi,%eax
+     ef4:	5b                   	pop    %ebx
+     ef5:	5e                   	pop    %esi
+     ef6:	5d                   	pop    %ebp
+     ef7:	c3                   	ret
+     ef8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     eff:	90                   	nop
+    free(f->buf);
+     f00:	83 ec 0c             	sub    $0xc,%esp
+     f03:	ff 73 08             	push   0x8(%ebx)
+     f06:	e8 f5 09 00 00       	call   1900 <free>
+     f0b:	83 c4 10             	add    $0x10,%esp
+     f0e:	eb 98                	jmp    ea8 <fclose+0x38>
+
+00000f10 <fflush>:
+{
+     f10:	55                   	push   %ebp
+     f11:	89 e5                	mov    %esp,%ebp
+     f13:	53                   	push   %ebx
+     f14:	83 ec 14             	sub    $0x14,%esp
+     f17:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f == 0){
+     f1a:	85 db                	test   %ebx,%ebx
+     f1c:	74 5a                	je     f78 <fflush+0x68>
+  if(threaded)
+     f1e:	8b 0d 60 2b 00 00    	mov    0x2b60,%ecx
+     f24:	85 c9                	test   %ecx,%ecx
+     f26:	75 18                	jne    f40 <fflush+0x30>
+  r = flush(f);
+     f28:	89 d8                	mov    %ebx,%eax
+     f2a:	e8 81 fb ff ff       	call   ab0 <flush>
+  if(threaded)
+     f2f:	8b 15 60 2b 00 00    	mov    0x2b60,%edx
+     f35:	85 d2                	test   %edx,%edx
+     f37:	75 1f                	jne    f58 <fflush+0x48>
+}
+     f39:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f3c:	c9                   	leave
+     f3d:	c3                   	ret
+     f3e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+     f40:	83 ec 0c             	sub    $0xc,%esp
+     f43:	8d 43 18             	lea    0x18(%ebx),%eax
+     f46:	50                   	push   %eax
+     f47:	e8 a4 f4 ff ff       	call   3f0 <mutex_lock>
+     f4c:	83 c4 10             	add    $0x10,%esp
+     f4f:	eb d7                	jmp    f28 <fflush+0x18>
+     f51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     f58:	83 ec 0c             	sub    $0xc,%esp
+     f5b:	83 c3 18             	add    $0x18,%ebx
+     f5e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     f61:	53                   	push   %ebx
+     f62:	e8 d9 f4 ff ff       	call   440 <mutex_unlock>
+     f67:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     f6a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    mutex_unlock(&f->lock);
+     f6d:	83 c4 10             	add    $0x10,%esp
+}
+     f70:	c9                   	leave
+     f71:	c3                   	ret
+     f72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     f78:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f7b:	c9                   	leave
+     f7c:	e9 af fb ff ff       	jmp    b30 <fflush.part.0>
+     f81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f8f:	90                   	nop
+
+00000f90 <putc_unlocked>:
+{
+     f90:	55                   	push   %ebp
+     f91:	89 e5                	mov    %esp,%ebp
+     f93:	56                   	push   %esi
+     f94:	53                   	push   %ebx
+     f95:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     f98:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(!(f->flags & IO_WRITE))
+     f9b:	8b 43 04             	mov    0x4(%ebx),%eax
+     f9e:	a8 02                	test   $0x2,%al
+     fa0:	74 46                	je     fe8 <putc_unlocked+0x58>
+  if(!(f->flags & IO_SETUP))
+     fa2:	a8 40                	test   $0x40,%al
+     fa4:	74 4a                	je     ff0 <putc_unlocked+0x60>
+  if(f->n == f->size && flush(f) < 0)
+     fa6:	8b 43 14             	mov    0x14(%ebx),%eax
+     fa9:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     fac:	74 51                	je     fff <putc_unlocked+0x6f>
+  f->buf[f->n++] = c;
+     fae:	8d 48 01             	lea    0x1(%eax),%ecx
+     fb1:	8b 53 08             	mov    0x8(%ebx),%edx
+     fb4:	89 4b 14             	mov    %ecx,0x14(%ebx)
+     fb7:	89 f1                	mov    %esi,%ecx
+     fb9:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     fbc:	83 fe 0a             	cmp    $0xa,%esi
+     fbf:	74 0f                	je     fd0 <putc_unlocked+0x40>
+  return c & 0xff;
+     fc1:	89 f0                	mov    %esi,%eax
+     fc3:	0f b6 c0             	movzbl %al,%eax
+}
+     fc6:	5b                   	pop    %ebx
+     fc7:	5e                   	pop    %esi
+     fc8:	5d                   	pop    %ebp
+     fc9:	c3                   	ret
+     fca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     fd0:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+     fd4:	74 eb                	je     fc1 <putc_unlocked+0x31>
+     fd6:	89 d8                	mov    %ebx,%eax
+     fd8:	e8 d3 fa ff ff       	call   ab0 <flush>
+     fdd:	85 c0                	test   %eax,%eax
+     fdf:	79 e0                	jns    fc1 <putc_unlocked+0x31>
+     fe1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return EOF;
+     fe8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     fed:	eb d7                	jmp    fc6 <putc_unlocked+0x36>
+     fef:	90                   	nop
+    setup(f);
+     ff0:	89 d8                	mov    %ebx,%eax
+     ff2:	e8 69 fa ff ff       	call   a60 <setup>
+  if(f->n == f->size && flush(f) < 0)
+     ff7:	8b 43 14             	mov    0x14(%ebx),%eax
+     ffa:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     ffd:	75 af                	jne    fae <putc_unlocked+0x1e>
+     fff:	89 d8                	mov    %ebx,%eax
+    1001:	e8 aa fa ff ff       	call   ab0 <flush>
+    1006:	85 c0                	test   %eax,%eax
+    1008:	78 de                	js     fe8 <putc_unlocked+0x58>
+  f->buf[f->n++] = c;
+    100a:	8b 43 14             	mov    0x14(%ebx),%eax
+    100d:	eb 9f                	jmp    fae <putc_unlocked+0x1e>
+    100f:	90                   	nop
+
+00001010 <fputc>:
+{
+    1010:	55                   	push   %ebp
+    1011:	89 e5                	mov    %esp,%ebp
+    1013:	56                   	push   %esi
+    1014:	53                   	push   %ebx
+  if(threaded)
+    1015:	8b 15 60 2b 00 00    	mov    0x2b60,%edx
+{
+    101b:	8b 75 08             	mov    0x8(%ebp),%esi
+    101e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(threaded)
+    1021:	85 d2                	test   %edx,%edx
+    1023:	75 6b                	jne    1090 <fputc+0x80>
+  if(!(f->flags & IO_WRITE))
+    1025:	8b 43 04             	mov    0x4(%ebx),%eax
+    1028:	a8 02                	test   $0x2,%al
+    102a:	0f 84 b8 00 00 00    	je     10e8 <fputc+0xd8>
+  if(!(f->flags & IO_SETUP))
+    1030:	a8 40                	test   $0x40,%al
+    1032:	74 76                	je     10aa <fputc+0x9a>
+  if(f->n == f->size && flush(f) < 0)
+    1034:	8b 43 14             	mov    0x14(%ebx),%eax
+    1037:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    103a:	74 7d                	je     10b9 <fputc+0xa9>
+  f->buf[f->n++] = c;
+    103c:	8d 48 01             	lea    0x1(%eax),%ecx
+    103f:	8b 53 08             	mov    0x8(%ebx),%edx
+    1042:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    1045:	89 f1                	mov    %esi,%ecx
+    1047:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    104a:	83 fe 0a             	cmp    $0xa,%esi
+    104d:	74 21                	je     1070 <fputc+0x60>
+  return c & 0xff;
+    104f:	89 f0                	mov    %esi,%eax
+    1051:	0f b6 f0             	movzbl %al,%esi
+  if(threaded)
+    1054:	a1 60 2b 00 00       	mov    0x2b60,%eax
+    1059:	85 c0                	test   %eax,%eax
+    105b:	75 73                	jne    10d0 <fputc+0xc0>
+}
+    105d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1060:	89 f0                	mov    %esi,%eax
+    1062:	5b                   	pop    %ebx
+    1063:	5e                   	pop    %esi
+    1064:	5d                   	pop    %ebp
+    1065:	c3                   	ret
+    1066:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    106d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+    1070:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1074:	74 d9                	je     104f <fputc+0x3f>
+    1076:	89 d8                	mov    %ebx,%eax
+    1078:	e8 33 fa ff ff       	call   ab0 <flush>
+    107d:	85 c0                	test   %eax,%eax
+    107f:	79 ce                	jns    104f <fputc+0x3f>
+    return EOF;
+    1081:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1086:	eb cc                	jmp    1054 <fputc+0x44>
+    1088:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    108f:	90                   	nop
+    mutex_lock(&f->lock);
+    1090:	83 ec 0c             	sub    $0xc,%esp
+    1093:	8d 43 18             	lea    0x18(%ebx),%eax
+    1096:	50                   	push   %eax
+    1097:	e8 54 f3 ff ff       	call   3f0 <mutex_lock>
+  if(!(f->flags & IO_WRITE))
+    109c:	8b 43 04             	mov    0x4(%ebx),%eax
+    109f:	83 c4 10             	add    $0x10,%esp
+    10a2:	a8 02                	test   $0x2,%al
+    10a4:	74 db                	je     1081 <fputc+0x71>
+  if(!(f->flags & IO_SETUP))
+    10a6:	a8 40                	test   $0x40,%al
+    10a8:	75 8a                	jne    1034 <fputc+0x24>
+    setup(f);
+    10aa:	89 d8                	mov    %ebx,%eax
+    10ac:	e8 af f9 ff ff       	call   a60 <setup>
+  if(f->n == f->size && flush(f) < 0)
+    10b1:	8b 43 14             	mov    0x14(%ebx),%eax
+    10b4:	3b 43 0c             	cmp    0xc(%ebx),%eax
+    10b7:	75 83                	jne    103c <fputc+0x2c>
+    10b9:	89 d8                	mov    %ebx,%eax
+    10bb:	e8 f0 f9 ff ff       	call   ab0 <flush>
+    10c0:	85 c0                	test   %eax,%eax
+    10c2:	78 bd                	js     1081 <fputc+0x71>
+  f->buf[f->n++] = c;
+    10c4:	8b 43 14             	mov    0x14(%ebx),%eax
+    10c7:	e9 70 ff ff ff       	jmp    103c <fputc+0x2c>
+    10cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    10d0:	83 ec 0c             	sub    $0xc,%esp
+    10d3:	83 c3 18             	add    $0x18,%ebx
+    10d6:	53                   	push   %ebx
+    10d7:	e8 64 f3 ff ff       	call   440 <mutex_unlock>
+    10dc:	83 c4 10             	add    $0x10,%esp
+}
+    10df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    10e2:	89 f0                	mov    %esi,%eax
+    10e4:	5b                   	pop    %ebx
+    10e5:	5e                   	pop    %esi
+    10e6:	5d                   	pop    %ebp
+    10e7:	c3                   	ret
+    return EOF;
+    10e8:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    10ed:	e9 6b ff ff ff       	jmp    105d <fputc+0x4d>
+    10f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001100 <fwrite>:
+{
+    1100:	55                   	push   %ebp
+    1101:	89 e5                	mov    %esp,%ebp
+    1103:	57                   	push   %edi
+    1104:	56                   	push   %esi
+    1105:	53                   	push   %ebx
+    1106:	83 ec 1c             	sub    $0x1c,%esp
+    1109:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  if(!(f->flags & IO_WRITE) || size <= 0)
+    110c:	8b 43 04             	mov    0x4(%ebx),%eax
+    110f:	a8 02                	test   $0x2,%al
+    1111:	0f 84 ec 00 00 00    	je     1203 <fwrite+0x103>
+    1117:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    111a:	85 c9                	test   %ecx,%ecx
+    111c:	0f 8e e1 00 00 00    	jle    1203 <fwrite+0x103>
+  if(threaded)
+    1122:	8b 15 60 2b 00 00    	mov    0x2b60,%edx
+    1128:	85 d2                	test   %edx,%edx
+    112a:	0f 85 1c 01 00 00    	jne    124c <fwrite+0x14c>
+  if(!(f->flags & IO_SETUP))
+    1130:	a8 40                	test   $0x40,%al
+    1132:	0f 84 08 01 00 00    	je     1240 <fwrite+0x140>
+  for(len = size*nmemb; len > 0; len -= n){
+    1138:	8b 45 0c             	mov    0xc(%ebp),%eax
+    113b:	0f af 45 10          	imul   0x10(%ebp),%eax
+    113f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    1142:	85 c0                	test   %eax,%eax
+    1144:	0f 8e 2a 01 00 00    	jle    1274 <fwrite+0x174>
+  s = p;
+    114a:	8b 45 08             	mov    0x8(%ebp),%eax
+  nl = 0;
+    114d:	31 ff                	xor    %edi,%edi
+    114f:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+        nl = 1;
+    1152:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  s = p;
+    1155:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1158:	8b 43 14             	mov    0x14(%ebx),%eax
+        nl = 1;
+    115b:	89 ce                	mov    %ecx,%esi
+    if(f->n == f->size && flush(f) < 0)
+    115d:	89 c2                	mov    %eax,%edx
+    115f:	39 f0                	cmp    %esi,%eax
+    1161:	74 6e                	je     11d1 <fwrite+0xd1>
+    1163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1167:	90                   	nop
+    if(n > len)
+    1168:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    n = f->size - f->n;
+    116b:	89 f1                	mov    %esi,%ecx
+    116d:	29 c1                	sub    %eax,%ecx
+    116f:	39 f9                	cmp    %edi,%ecx
+    1171:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1174:	85 c9                	test   %ecx,%ecx
+    1176:	0f 8e 7c 00 00 00    	jle    11f8 <fwrite+0xf8>
+    117c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    117f:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1182:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    1185:	8d 34 08             	lea    (%eax,%ecx,1),%esi
+    1188:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    118b:	eb 06                	jmp    1193 <fwrite+0x93>
+    118d:	8d 76 00             	lea    0x0(%esi),%esi
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1190:	8b 53 14             	mov    0x14(%ebx),%edx
+    1193:	8d 4a 01             	lea    0x1(%edx),%ecx
+    1196:	8b 73 08             	mov    0x8(%ebx),%esi
+    1199:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    119c:	0f b6 08             	movzbl (%eax),%ecx
+        nl = 1;
+    119f:	80 f9 0a             	cmp    $0xa,%cl
+      if((f->buf[f->n++] = s[i]) == '\n')
+    11a2:	88 0c 16             	mov    %cl,(%esi,%edx,1)
+        nl = 1;
+    11a5:	be 01 00 00 00       	mov    $0x1,%esi
+    11aa:	0f 44 fe             	cmove  %esi,%edi
+    for(i = 0; i < n; i++)
+    11ad:	83 c0 01             	add    $0x1,%eax
+    11b0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    11b3:	75 db                	jne    1190 <fwrite+0x90>
+    s += n;
+    11b5:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    11b8:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    11bb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    s += n;
+    11be:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    11c1:	85 c0                	test   %eax,%eax
+    11c3:	7e 48                	jle    120d <fwrite+0x10d>
+    11c5:	8b 43 14             	mov    0x14(%ebx),%eax
+    11c8:	8b 73 0c             	mov    0xc(%ebx),%esi
+    if(f->n == f->size && flush(f) < 0)
+    11cb:	89 c2                	mov    %eax,%edx
+    11cd:	39 f0                	cmp    %esi,%eax
+    11cf:	75 97                	jne    1168 <fwrite+0x68>
+    11d1:	89 d8                	mov    %ebx,%eax
+    11d3:	e8 d8 f8 ff ff       	call   ab0 <flush>
+    11d8:	85 c0                	test   %eax,%eax
+    11da:	78 31                	js     120d <fwrite+0x10d>
+    n = f->size - f->n;
+    11dc:	8b 73 0c             	mov    0xc(%ebx),%esi
+    11df:	8b 43 14             	mov    0x14(%ebx),%eax
+    11e2:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    11e5:	89 f1                	mov    %esi,%ecx
+    11e7:	89 c2                	mov    %eax,%edx
+    11e9:	29 c1                	sub    %eax,%ecx
+    11eb:	39 f9                	cmp    %edi,%ecx
+    11ed:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    11f0:	85 c9                	test   %ecx,%ecx
+    11f2:	7f 88                	jg     117c <fwrite+0x7c>
+    11f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    s += n;
+    11f8:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    11fb:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    11fe:	e9 5a ff ff ff       	jmp    115d <fwrite+0x5d>
+}
+    1203:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    1206:	31 c0                	xor    %eax,%eax
+}
+    1208:	5b                   	pop    %ebx
+    1209:	5e                   	pop    %esi
+    120a:	5f                   	pop    %edi
+    120b:	5d                   	pop    %ebp
+    120c:	c3                   	ret
+  if(nl && (f->flags & IO_LINE))
+    120d:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1210:	85 ff                	test   %edi,%edi
+    1212:	74 06                	je     121a <fwrite+0x11a>
+    1214:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    1218:	75 1d                	jne    1237 <fwrite+0x137>
+  return (s - (const char*)p) / size;
+    121a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    121d:	2b 75 08             	sub    0x8(%ebp),%esi
+  if(threaded)
+    1220:	a1 60 2b 00 00       	mov    0x2b60,%eax
+    1225:	85 c0                	test   %eax,%eax
+    1227:	75 3a                	jne    1263 <fwrite+0x163>
+  return (s - (const char*)p) / size;
+    1229:	89 f0                	mov    %esi,%eax
+    122b:	99                   	cltd
+    122c:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    122f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1232:	5b                   	pop    %ebx
+    1233:	5e                   	pop    %esi
+    1234:	5f                   	pop    %edi
+    1235:	5d                   	pop    %ebp
+    1236:	c3                   	ret
+    flush(f);
+    1237:	89 d8                	mov    %ebx,%eax
+    1239:	e8 72 f8 ff ff       	call   ab0 <flush>
+    123e:	eb da                	jmp    121a <fwrite+0x11a>
+    setup(f);
+    1240:	89 d8                	mov    %ebx,%eax
+    1242:	e8 19 f8 ff ff       	call   a60 <setup>
+    1247:	e9 ec fe ff ff       	jmp    1138 <fwrite+0x38>
+    mutex_lock(&f->lock);
+    124c:	83 ec 0c             	sub    $0xc,%esp
+    124f:	8d 43 18             	lea    0x18(%ebx),%eax
+    1252:	50                   	push   %eax
+    1253:	e8 98 f1 ff ff       	call   3f0 <mutex_lock>
+  if(!(f->flags & IO_SETUP))
+    1258:	8b 43 04             	mov    0x4(%ebx),%eax
+    125b:	83 c4 10             	add    $0x10,%esp
+    125e:	e9 cd fe ff ff       	jmp    1130 <fwrite+0x30>
+    mutex_unlock(&f->lock);
+    1263:	83 ec 0c             	sub    $0xc,%esp
+    1266:	83 c3 18             	add    $0x18,%ebx
+    1269:	53                   	push   %ebx
+    126a:	e8 d1 f1 ff ff       	call   440 <mutex_unlock>
+    126f:	83 c4 10             	add    $0x10,%esp
+    1272:	eb b5                	jmp    1229 <fwrite+0x129>
+  for(len = size*nmemb; len > 0; len -= n){
+    1274:	31 f6                	xor    %esi,%esi
+    1276:	eb a8                	jmp    1220 <fwrite+0x120>
+    1278:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    127f:	90                   	nop
+
+00001280 <fgetc>:
+  return f->buf[f->r++] & 0xff;
+}
+
+int
+fgetc(FILE *f)
+{
+    1280:	55                   	push   %ebp
+    1281:	89 e5                	mov    %esp,%ebp
+    1283:	56                   	push   %esi
+    1284:	53                   	push   %ebx
+  if(threaded)
+    1285:	8b 15 60 2b 00 00    	mov    0x2b60,%edx
+{
+    128b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    128e:	85 d2                	test   %edx,%edx
+    1290:	75 2e                	jne    12c0 <fgetc+0x40>
+  if(!(f->flags & IO_READ))
+    1292:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1296:	74 78                	je     1310 <fgetc+0x90>
+  if(f->r == f->n && fill(f) == 0)
+    1298:	8b 43 10             	mov    0x10(%ebx),%eax
+    129b:	3b 43 14             	cmp    0x14(%ebx),%eax
+    129e:	74 60                	je     1300 <fgetc+0x80>
+  return f->buf[f->r++] & 0xff;
+    12a0:	8b 53 08             	mov    0x8(%ebx),%edx
+    12a3:	8d 48 01             	lea    0x1(%eax),%ecx
+    12a6:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    12a9:	0f b6 34 02          	movzbl (%edx,%eax,1),%esi
+  if(threaded)
+    12ad:	a1 60 2b 00 00       	mov    0x2b60,%eax
+    12b2:	85 c0                	test   %eax,%eax
+    12b4:	75 2a                	jne    12e0 <fgetc+0x60>
+
+  flockfile(f);
+  c = getc_unlocked(f);
+  funlockfile(f);
+  return c;
+}
+    12b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12b9:	89 f0                	mov    %esi,%eax
+    12bb:	5b                   	pop    %ebx
+    12bc:	5e                   	pop    %esi
+    12bd:	5d                   	pop    %ebp
+    12be:	c3                   	ret
+    12bf:	90                   	nop
+    mutex_lock(&f->lock);
+    12c0:	83 ec 0c             	sub    $0xc,%esp
+    12c3:	8d 43 18             	lea    0x18(%ebx),%eax
+    12c6:	50                   	push   %eax
+    12c7:	e8 24 f1 ff ff       	call   3f0 <mutex_lock>
+  if(!(f->flags & IO_READ))
+    12cc:	83 c4 10             	add    $0x10,%esp
+    12cf:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    12d3:	75 c3                	jne    1298 <fgetc+0x18>
+    return EOF;
+    12d5:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    12da:	eb d1                	jmp    12ad <fgetc+0x2d>
+    12dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    12e0:	83 ec 0c             	sub    $0xc,%esp
+    12e3:	83 c3 18             	add    $0x18,%ebx
+    12e6:	53                   	push   %ebx
+    12e7:	e8 54 f1 ff ff       	call   440 <mutex_unlock>
+    12ec:	83 c4 10             	add    $0x10,%esp
+}
+    12ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12f2:	89 f0                	mov    %esi,%eax
+    12f4:	5b                   	pop    %ebx
+    12f5:	5e                   	pop    %esi
+    12f6:	5d                   	pop    %ebp
+    12f7:	c3                   	ret
+    12f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ff:	90                   	nop
+  if(f->r == f->n && fill(f) == 0)
+    1300:	89 d8                	mov    %ebx,%eax
+    1302:	e8 c9 f8 ff ff       	call   bd0 <fill>
+    1307:	85 c0                	test   %eax,%eax
+    1309:	74 ca                	je     12d5 <fgetc+0x55>
+  return f->buf[f->r++] & 0xff;
+    130b:	8b 43 10             	mov    0x10(%ebx),%eax
+    130e:	eb 90                	jmp    12a0 <fgetc+0x20>
+    return EOF;
+    1310:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    1315:	eb 9f                	jmp    12b6 <fgetc+0x36>
+    1317:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    131e:	66 90                	xchg   %ax,%ax
+
+00001320 <fread>:
+
+int
+fread(void *p, int size, int nmemb, FILE *f)
+{
+    1320:	55                   	push   %ebp
+    1321:	89 e5                	mov    %esp,%ebp
+    1323:	57                   	push   %edi
+    1324:	56                   	push   %esi
+    1325:	53                   	push   %ebx
+    1326:	83 ec 1c             	sub    $0x1c,%esp
+    1329:	8b 75 14             	mov    0x14(%ebp),%esi
+  char *d;
+  int n, len;
+
+  if(!(f->flags & IO_READ) || size <= 0)
+    132c:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+    1330:	74 7e                	je     13b0 <fread+0x90>
+    1332:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1335:	85 d2                	test   %edx,%edx
+    1337:	7e 77                	jle    13b0 <fread+0x90>
+  if(threaded)
+    1339:	a1 60 2b 00 00       	mov    0x2b60,%eax
+    return 0;
+  flockfile(f);
+  d = p;
+  for(len = size*nmemb; len > 0; len -= n){
+    133e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1341:	0f af 7d 10          	imul   0x10(%ebp),%edi
+  if(threaded)
+    1345:	85 c0                	test   %eax,%eax
+    1347:	0f 85 93 00 00 00    	jne    13e0 <fread+0xc0>
+  for(len = size*nmemb; len > 0; len -= n){
+    134d:	85 ff                	test   %edi,%edi
+    134f:	7e 61                	jle    13b2 <fread+0x92>
+    if(f->r == f->n && fill(f) == 0)
+    1351:	8b 46 10             	mov    0x10(%esi),%eax
+  d = p;
+    1354:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1357:	eb 35                	jmp    138e <fread+0x6e>
+    1359:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      break;
+    n = f->n - f->r;
+    1360:	29 c3                	sub    %eax,%ebx
+    1362:	39 fb                	cmp    %edi,%ebx
+    1364:	0f 4f df             	cmovg  %edi,%ebx
+    if(n > len)
+      n = len;
+    memmove(d, f->buf + f->r, n);
+    1367:	83 ec 04             	sub    $0x4,%esp
+    136a:	53                   	push   %ebx
+    136b:	03 46 08             	add    0x8(%esi),%eax
+  for(len = size*nmemb; len > 0; len -= n){
+    136e:	29 df                	sub    %ebx,%edi
+    memmove(d, f->buf + f->r, n);
+    1370:	50                   	push   %eax
+    1371:	51                   	push   %ecx
+    1372:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1375:	e8 36 f0 ff ff       	call   3b0 <memmove>
+    f->r += n;
+    137a:	8b 46 10             	mov    0x10(%esi),%eax
+    d += n;
+    137d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1380:	83 c4 10             	add    $0x10,%esp
+    f->r += n;
+    1383:	01 d8                	add    %ebx,%eax
+    d += n;
+    1385:	01 d9                	add    %ebx,%ecx
+    f->r += n;
+    1387:	89 46 10             	mov    %eax,0x10(%esi)
+  for(len = size*nmemb; len > 0; len -= n){
+    138a:	85 ff                	test   %edi,%edi
+    138c:	7e 32                	jle    13c0 <fread+0xa0>
+    if(f->r == f->n && fill(f) == 0)
+    138e:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1391:	39 c3                	cmp    %eax,%ebx
+    1393:	75 cb                	jne    1360 <fread+0x40>
+    1395:	89 f0                	mov    %esi,%eax
+    1397:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    139a:	e8 31 f8 ff ff       	call   bd0 <fill>
+    139f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    13a2:	85 c0                	test   %eax,%eax
+    13a4:	74 1a                	je     13c0 <fread+0xa0>
+    n = f->n - f->r;
+    13a6:	8b 5e 14             	mov    0x14(%esi),%ebx
+    13a9:	8b 46 10             	mov    0x10(%esi),%eax
+    13ac:	eb b2                	jmp    1360 <fread+0x40>
+    13ae:	66 90                	xchg   %ax,%ax
+    return 0;
+    13b0:	31 c0                	xor    %eax,%eax
+  }
+  funlockfile(f);
+  return (d - (char*)p) / size;
+}
+    13b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13b5:	5b                   	pop    %ebx
+    13b6:	5e                   	pop    %esi
+    13b7:	5f                   	pop    %edi
+    13b8:	5d                   	pop    %ebp
+    13b9:	c3                   	ret
+    13ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (d - (char*)p) / size;
+    13c0:	2b 4d 08             	sub    0x8(%ebp),%ecx
+    13c3:	89 cb                	mov    %ecx,%ebx
+  if(threaded)
+    13c5:	a1 60 2b 00 00       	mov    0x2b60,%eax
+    13ca:	85 c0                	test   %eax,%eax
+    13cc:	75 32                	jne    1400 <fread+0xe0>
+  return (d - (char*)p) / size;
+    13ce:	89 d8                	mov    %ebx,%eax
+    13d0:	99                   	cltd
+    13d1:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    13d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13d7:	5b                   	pop    %ebx
+    13d8:	5e                   	pop    %esi
+    13d9:	5f                   	pop    %edi
+    13da:	5d                   	pop    %ebp
+    13db:	c3                   	ret
+    13dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    13e0:	83 ec 0c             	sub    $0xc,%esp
+    13e3:	8d 46 18             	lea    0x18(%esi),%eax
+    13e6:	50                   	push   %eax
+    13e7:	e8 04 f0 ff ff       	call   3f0 <mutex_lock>
+  for(len = size*nmemb; len > 0; len -= n){
+    13ec:	83 c4 10             	add    $0x10,%esp
+    13ef:	85 ff                	test   %edi,%edi
+    13f1:	0f 8f 5a ff ff ff    	jg     1351 <fread+0x31>
+    13f7:	31 db                	xor    %ebx,%ebx
+    13f9:	eb ca                	jmp    13c5 <fread+0xa5>
+    13fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    13ff:	90                   	nop
+    mutex_unlock(&f->lock);
+    1400:	83 ec 0c             	sub    $0xc,%esp
+    1403:	83 c6 18             	add    $0x18,%esi
+    1406:	56                   	push   %esi
+    1407:	e8 34 f0 ff ff       	call   440 <mutex_unlock>
+  return (d - (char*)p) / size;
+    140c:	89 d8                	mov    %ebx,%eax
+    140e:	83 c4 10             	add    $0x10,%esp
+    1411:	99                   	cltd
+    1412:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1415:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1418:	5b                   	pop    %ebx
+    1419:	5e                   	pop    %esi
+    141a:	5f                   	pop    %edi
+    141b:	5d                   	pop    %ebp
+    141c:	c3                   	ret
+    141d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001420 <fgets>:
+
+// Read a line of at most max-1 bytes, keeping the newline.
+// Returns 0 if there was nothing left to read.
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    1420:	55                   	push   %ebp
+    1421:	89 e5                	mov    %esp,%ebp
+    1423:	57                   	push   %edi
+    1424:	56                   	push   %esi
+    1425:	53                   	push   %ebx
+    1426:	83 ec 1c             	sub    $0x1c,%esp
+  if(threaded)
+    1429:	8b 35 60 2b 00 00    	mov    0x2b60,%esi
+{
+    142f:	8b 7d 08             	mov    0x8(%ebp),%edi
+    1432:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if(threaded)
+    1435:	85 f6                	test   %esi,%esi
+    1437:	0f 85 83 00 00 00    	jne    14c0 <fgets+0xa0>
+{
+    143d:	31 f6                	xor    %esi,%esi
+    143f:	eb 2a                	jmp    146b <fgets+0x4b>
+    1441:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return f->buf[f->r++] & 0xff;
+    1448:	8b 53 08             	mov    0x8(%ebx),%edx
+    144b:	8d 48 01             	lea    0x1(%eax),%ecx
+    144e:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1451:	0f b6 14 02          	movzbl (%edx,%eax,1),%edx
+
+  flockfile(f);
+  for(i = 0; i+1 < max; ){
+    if((c = getc_unlocked(f)) == EOF)
+      break;
+    buf[i++] = c;
+    1455:	88 54 37 ff          	mov    %dl,-0x1(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    1459:	80 fa 0a             	cmp    $0xa,%dl
+    145c:	0f 84 96 00 00 00    	je     14f8 <fgets+0xd8>
+    1462:	83 fa 0d             	cmp    $0xd,%edx
+    1465:	0f 84 8d 00 00 00    	je     14f8 <fgets+0xd8>
+  for(i = 0; i+1 < max; ){
+    146b:	89 f2                	mov    %esi,%edx
+    146d:	83 c6 01             	add    $0x1,%esi
+    1470:	3b 75 0c             	cmp    0xc(%ebp),%esi
+    1473:	7d 2b                	jge    14a0 <fgets+0x80>
+  if(!(f->flags & IO_READ))
+    1475:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1479:	74 25                	je     14a0 <fgets+0x80>
+  if(f->r == f->n && fill(f) == 0)
+    147b:	8b 43 10             	mov    0x10(%ebx),%eax
+    147e:	3b 43 14             	cmp    0x14(%ebx),%eax
+    1481:	75 c5                	jne    1448 <fgets+0x28>
+    1483:	89 d8                	mov    %ebx,%eax
+    1485:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1488:	e8 43 f7 ff ff       	call   bd0 <fill>
+    148d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1490:	85 c0                	test   %eax,%eax
+    1492:	74 0c                	je     14a0 <fgets+0x80>
+  return f->buf[f->r++] & 0xff;
+    1494:	8b 43 10             	mov    0x10(%ebx),%eax
+    1497:	eb af                	jmp    1448 <fgets+0x28>
+    1499:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    14a0:	8b 0d 60 2b 00 00    	mov    0x2b60,%ecx
+      break;
+  }
+  buf[i] = '\0';
+    14a6:	c6 04 17 00          	movb   $0x0,(%edi,%edx,1)
+  if(threaded)
+    14aa:	85 c9                	test   %ecx,%ecx
+    14ac:	75 2a                	jne    14d8 <fgets+0xb8>
+  funlockfile(f);
+  return i > 0 ? buf : 0;
+    14ae:	31 c0                	xor    %eax,%eax
+    14b0:	85 d2                	test   %edx,%edx
+    14b2:	74 02                	je     14b6 <fgets+0x96>
+    14b4:	89 f8                	mov    %edi,%eax
+}
+    14b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    14b9:	5b                   	pop    %ebx
+    14ba:	5e                   	pop    %esi
+    14bb:	5f                   	pop    %edi
+    14bc:	5d                   	pop    %ebp
+    14bd:	c3                   	ret
+    14be:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    14c0:	83 ec 0c             	sub    $0xc,%esp
+    14c3:	8d 43 18             	lea    0x18(%ebx),%eax
+    14c6:	50                   	push   %eax
+    14c7:	e8 24 ef ff ff       	call   3f0 <mutex_lock>
+    14cc:	83 c4 10             	add    $0x10,%esp
+    14cf:	e9 69 ff ff ff       	jmp    143d <fgets+0x1d>
+    14d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    14d8:	83 ec 0c             	sub    $0xc,%esp
+    14db:	83 c3 18             	add    $0x18,%ebx
+    14de:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    14e1:	53                   	push   %ebx
+    14e2:	e8 59 ef ff ff       	call   440 <mutex_unlock>
+    14e7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    14ea:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    14ed:	31 c0                	xor    %eax,%eax
+    14ef:	85 d2                	test   %edx,%edx
+    14f1:	75 c1                	jne    14b4 <fgets+0x94>
+    14f3:	eb c1                	jmp    14b6 <fgets+0x96>
+    14f5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    14f8:	a1 60 2b 00 00       	mov    0x2b60,%eax
+  buf[i] = '\0';
+    14fd:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  if(threaded)
+    1501:	85 c0                	test   %eax,%eax
+    1503:	74 af                	je     14b4 <fgets+0x94>
+    mutex_unlock(&f->lock);
+    1505:	83 ec 0c             	sub    $0xc,%esp
+    1508:	83 c3 18             	add    $0x18,%ebx
+    150b:	53                   	push   %ebx
+    150c:	e8 2f ef ff ff       	call   440 <mutex_unlock>
+    1511:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    1514:	89 f8                	mov    %edi,%eax
+    1516:	eb 9e                	jmp    14b6 <fgets+0x96>
+    1518:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    151f:	90                   	nop
+
+00001520 <gets>:
+// at most a line per read(), goes through stdin's buffer: from a
+// file or pipe, a buffered read could take input meant for a child
+// process, so read a byte at a time.
+char*
+gets(char *buf, int max)
+{
+    1520:	55                   	push   %ebp
+    1521:	89 e5                	mov    %esp,%ebp
+    1523:	57                   	push   %edi
+    1524:	56                   	push   %esi
+    1525:	53                   	push   %ebx
+    1526:	83 ec 2c             	sub    $0x2c,%esp
+  int i, cc;
+  char c;
+
+  if(!(stdin->flags & IO_SETUP))
+    1529:	8b 15 64 28 00 00    	mov    0x2864,%edx
+{
+    152f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!(stdin->flags & IO_SETUP))
+    1532:	f6 c2 40             	test   $0x40,%dl
+    1535:	74 79                	je     15b0 <gets+0x90>
+    setup(stdin);
+  if(stdin->flags & IO_DEV){
+    1537:	83 e2 20             	and    $0x20,%edx
+    153a:	89 d7                	mov    %edx,%edi
+    153c:	75 52                	jne    1590 <gets+0x70>
+  if(f == 0){
+    153e:	e8 ed f5 ff ff       	call   b30 <fflush.part.0>
+    fgets(buf, max, stdin);
+    return buf;
+  }
+  fflush(0);
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1543:	8d 75 e7             	lea    -0x19(%ebp),%esi
+  for(i=0; i+1 < max; ){
+    1546:	eb 2c                	jmp    1574 <gets+0x54>
+    1548:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    154f:	90                   	nop
+    cc = read(0, &c, 1);
+    1550:	83 ec 04             	sub    $0x4,%esp
+    1553:	6a 01                	push   $0x1
+    1555:	56                   	push   %esi
+    1556:	6a 00                	push   $0x0
+    1558:	e8 f5 ef ff ff       	call   552 <read>
+    if(cc < 1)
+    155d:	83 c4 10             	add    $0x10,%esp
+    1560:	85 c0                	test   %eax,%eax
+    1562:	7e 1b                	jle    157f <gets+0x5f>
+      break;
+    buf[i++] = c;
+    1564:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1568:	88 44 3b ff          	mov    %al,-0x1(%ebx,%edi,1)
+    if(c == '\n' || c == '\r')
+    156c:	3c 0a                	cmp    $0xa,%al
+    156e:	74 12                	je     1582 <gets+0x62>
+    1570:	3c 0d                	cmp    $0xd,%al
+    1572:	74 0e                	je     1582 <gets+0x62>
+  for(i=0; i+1 < max; ){
+    1574:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    1577:	83 c7 01             	add    $0x1,%edi
+    157a:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+    157d:	7c d1                	jl     1550 <gets+0x30>
+{
+    157f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      break;
+  }
+  buf[i] = '\0';
+    1582:	c6 04 3b 00          	movb   $0x0,(%ebx,%edi,1)
+  return buf;
+}
+    1586:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1589:	89 d8                	mov    %ebx,%eax
+    158b:	5b                   	pop    %ebx
+    158c:	5e                   	pop    %esi
+    158d:	5f                   	pop    %edi
+    158e:	5d                   	pop    %ebp
+    158f:	c3                   	ret
+    fgets(buf, max, stdin);
+    1590:	83 ec 04             	sub    $0x4,%esp
+    1593:	68 60 28 00 00       	push   $0x2860
+    1598:	ff 75 0c             	push   0xc(%ebp)
+    159b:	53                   	push   %ebx
+    159c:	e8 7f fe ff ff       	call   1420 <fgets>
+    return buf;
+    15a1:	83 c4 10             	add    $0x10,%esp
+}
+    15a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15a7:	89 d8                	mov    %ebx,%eax
+    15a9:	5b                   	pop    %ebx
+    15aa:	5e                   	pop    %esi
+    15ab:	5f                   	pop    %edi
+    15ac:	5d                   	pop    %ebp
+    15ad:	c3                   	ret
+    15ae:	66 90                	xchg   %ax,%ax
+    setup(stdin);
+    15b0:	b8 60 28 00 00       	mov    $0x2860,%eax
+    15b5:	e8 a6 f4 ff ff       	call   a60 <setup>
+  if(stdin->flags & IO_DEV){
+    15ba:	8b 15 64 28 00 00    	mov    0x2864,%edx
+    15c0:	e9 72 ff ff ff       	jmp    1537 <gets+0x17>
+    15c5:	66 90                	xchg   %ax,%ax
+    15c7:	66 90                	xchg   %ax,%ax
+    15c9:	66 90                	xchg   %ax,%ax
+    15cb:	66 90                	xchg   %ax,%ax
+    15cd:	66 90                	xchg   %ax,%ax
+    15cf:	90                   	nop
+
+000015d0 <bigfree>:
+
+// Give a big block back to the first-fit list, and return the
+// free block that now holds it. Caller holds lock.
+static Header*
+bigfree(Header *bp)
+{
+    15d0:	55                   	push   %ebp
+    15d1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    15d3:	a1 04 32 00 00       	mov    0x3204,%eax
+{
+    15d8:	89 e5                	mov    %esp,%ebp
+    15da:	56                   	push   %esi
+    15db:	53                   	push   %ebx
+    15dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    15e0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    15e2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    15e4:	39 ca                	cmp    %ecx,%edx
+    15e6:	73 38                	jae    1620 <bigfree+0x50>
+    15e8:	39 c1                	cmp    %eax,%ecx
+    15ea:	72 04                	jb     15f0 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    15ec:	39 c2                	cmp    %eax,%edx
+    15ee:	72 f0                	jb     15e0 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    15f0:	8b 59 04             	mov    0x4(%ecx),%ebx
+    15f3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    15f6:	39 f0                	cmp    %esi,%eax
+    15f8:	74 36                	je     1630 <bigfree+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    15fa:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  freep = p;
+  if(p + p->s.size == bp){
+    15fc:	8b 42 04             	mov    0x4(%edx),%eax
+    15ff:	89 cb                	mov    %ecx,%ebx
+  freep = p;
+    1601:	89 15 04 32 00 00    	mov    %edx,0x3204
+  if(p + p->s.size == bp){
+    1607:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    160a:	39 f1                	cmp    %esi,%ecx
+    160c:	74 2e                	je     163c <bigfree+0x6c>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    160e:	89 1a                	mov    %ebx,(%edx)
+    return p;
+  }
+  p->s.ptr = bp;
+  return bp;
+}
+    1610:	89 c8                	mov    %ecx,%eax
+    1612:	5b                   	pop    %ebx
+    1613:	5e                   	pop    %esi
+    1614:	5d                   	pop    %ebp
+    1615:	c3                   	ret
+    1616:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    161d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1620:	39 c1                	cmp    %eax,%ecx
+    1622:	72 c8                	jb     15ec <bigfree+0x1c>
+    1624:	eb ba                	jmp    15e0 <bigfree+0x10>
+    1626:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    162d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1630:	03 58 04             	add    0x4(%eax),%ebx
+    1633:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1636:	8b 02                	mov    (%edx),%eax
+    1638:	8b 00                	mov    (%eax),%eax
+    163a:	eb be                	jmp    15fa <bigfree+0x2a>
+    p->s.size += bp->s.size;
+    163c:	03 41 04             	add    0x4(%ecx),%eax
+    163f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1642:	8b 19                	mov    (%ecx),%ebx
+    return p;
+    1644:	89 d1                	mov    %edx,%ecx
+}
+    1646:	89 c8                	mov    %ecx,%eax
+    p->s.ptr = bp->s.ptr;
+    1648:	89 1a                	mov    %ebx,(%edx)
+}
+    164a:	5b                   	pop    %ebx
+    164b:	5e                   	pop    %esi
+    164c:	5d                   	pop    %ebp
+    164d:	c3                   	ret
+    164e:	66 90                	xchg   %ax,%ax
+
+00001650 <trim>:
+// If free block bp ends the heap, return its whole pages to the
+// kernel, unless something else has moved the break since.
+// Caller holds lock.
+static void
+trim(Header *bp)
+{
+    1650:	55                   	push   %ebp
+    1651:	89 e5                	mov    %esp,%ebp
+    1653:	57                   	push   %edi
+    1654:	56                   	push   %esi
+    1655:	53                   	push   %ebx
+    1656:	89 c3                	mov    %eax,%ebx
+    1658:	83 ec 0c             	sub    $0xc,%esp
+  char *end;
+  uint n;
+
+  if((char*)(bp + bp->s.size) != heapend)
+    165b:	8b 53 04             	mov    0x4(%ebx),%edx
+    165e:	a1 00 32 00 00       	mov    0x3200,%eax
+    1663:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+    1666:	39 d0                	cmp    %edx,%eax
+    1668:	74 0e                	je     1678 <trim+0x28>
+  n = heapend - end;
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    bp->s.size -= n / sizeof(Header);
+    heapend = end;
+  }
+}
+    166a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    166d:	5b                   	pop    %ebx
+    166e:	5e                   	pop    %esi
+    166f:	5f                   	pop    %edi
+    1670:	5d                   	pop    %ebp
+    1671:	c3                   	ret
+    1672:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  end = (char*)PGROUNDUP((uint)(bp + 2));
+    1678:	8d bb 0f 10 00 00    	lea    0x100f(%ebx),%edi
+    167e:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  n = heapend - end;
+    1684:	29 f8                	sub    %edi,%eax
+    1686:	89 c6                	mov    %eax,%esi
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    1688:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    168d:	76 db                	jbe    166a <trim+0x1a>
+    168f:	83 ec 0c             	sub    $0xc,%esp
+    1692:	6a 00                	push   $0x0
+    1694:	e8 8b ef ff ff       	call   624 <sbrk>
+    1699:	83 c4 10             	add    $0x10,%esp
+    169c:	39 05 00 32 00 00    	cmp    %eax,0x3200
+    16a2:	75 c6                	jne    166a <trim+0x1a>
+    16a4:	89 f0                	mov    %esi,%eax
+    16a6:	83 ec 0c             	sub    $0xc,%esp
+    16a9:	f7 d8                	neg    %eax
+    16ab:	50                   	push   %eax
+    16ac:	e8 73 ef ff ff       	call   624 <sbrk>
+    16b1:	83 c4 10             	add    $0x10,%esp
+    16b4:	83 f8 ff             	cmp    $0xffffffff,%eax
+    16b7:	74 b1                	je     166a <trim+0x1a>
+    bp->s.size -= n / sizeof(Header);
+    16b9:	89 f0                	mov    %esi,%eax
+    heapend = end;
+    16bb:	89 3d 00 32 00 00    	mov    %edi,0x3200
+    bp->s.size -= n / sizeof(Header);
+    16c1:	c1 e8 03             	shr    $0x3,%eax
+    16c4:	29 43 04             	sub    %eax,0x4(%ebx)
+    heapend = end;
+    16c7:	eb a1                	jmp    166a <trim+0x1a>
+    16c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000016d0 <bigalloc>:
+}
+
+// Allocate a big block of nunits units. Caller holds lock.
+static Header*
+bigalloc(uint nunits)
+{
+    16d0:	55                   	push   %ebp
+    16d1:	89 e5                	mov    %esp,%ebp
+    16d3:	57                   	push   %edi
+    16d4:	89 c7                	mov    %eax,%edi
+    16d6:	56                   	push   %esi
+    16d7:	53                   	push   %ebx
+    16d8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    16db:	a1 04 32 00 00       	mov    0x3204,%eax
+    16e0:	85 c0                	test   %eax,%eax
+    16e2:	0f 84 98 00 00 00    	je     1780 <bigalloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    16e8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    16ea:	8b 4a 04             	mov    0x4(%edx),%ecx
+    16ed:	39 f9                	cmp    %edi,%ecx
+    16ef:	73 67                	jae    1758 <bigalloc+0x88>
+  if(nu < 4096)
+    16f1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    16f6:	39 df                	cmp    %ebx,%edi
+    16f8:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    16fb:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    1702:	eb 0d                	jmp    1711 <bigalloc+0x41>
+    1704:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1708:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    170a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    170d:	39 f9                	cmp    %edi,%ecx
+    170f:	73 47                	jae    1758 <bigalloc+0x88>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    1711:	89 d0                	mov    %edx,%eax
+    1713:	39 15 04 32 00 00    	cmp    %edx,0x3204
+    1719:	75 ed                	jne    1708 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    171b:	83 ec 0c             	sub    $0xc,%esp
+    171e:	56                   	push   %esi
+    171f:	e8 00 ef ff ff       	call   624 <sbrk>
+  if(p == (char*)-1)
+    1724:	83 c4 10             	add    $0x10,%esp
+    1727:	83 f8 ff             	cmp    $0xffffffff,%eax
+    172a:	74 1a                	je     1746 <bigalloc+0x76>
+  hp->s.size = nu;
+    172c:	89 58 04             	mov    %ebx,0x4(%eax)
+  heapend = p + nu * sizeof(Header);
+    172f:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    1732:	89 15 00 32 00 00    	mov    %edx,0x3200
+  bigfree(hp);
+    1738:	e8 93 fe ff ff       	call   15d0 <bigfree>
+  return freep;
+    173d:	a1 04 32 00 00       	mov    0x3204,%eax
+      if((p = morecore(nunits)) == 0)
+    1742:	85 c0                	test   %eax,%eax
+    1744:	75 c2                	jne    1708 <bigalloc+0x38>
+        return 0;
+  }
+}
+    1746:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1749:	31 d2                	xor    %edx,%edx
+}
+    174b:	5b                   	pop    %ebx
+    174c:	89 d0                	mov    %edx,%eax
+    174e:	5e                   	pop    %esi
+    174f:	5f                   	pop    %edi
+    1750:	5d                   	pop    %ebp
+    1751:	c3                   	ret
+    1752:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1758:	39 cf                	cmp    %ecx,%edi
+    175a:	74 54                	je     17b0 <bigalloc+0xe0>
+        p->s.size -= nunits;
+    175c:	29 f9                	sub    %edi,%ecx
+    175e:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    1761:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    1764:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    1767:	a3 04 32 00 00       	mov    %eax,0x3204
+}
+    176c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    176f:	89 d0                	mov    %edx,%eax
+    1771:	5b                   	pop    %ebx
+    1772:	5e                   	pop    %esi
+    1773:	5f                   	pop    %edi
+    1774:	5d                   	pop    %ebp
+    1775:	c3                   	ret
+    1776:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    177d:	8d 76 00             	lea    0x0(%esi),%esi
+    base.s.ptr = freep = prevp = &base;
+    1780:	c7 05 04 32 00 00 08 	movl   $0x3208,0x3204
+    1787:	32 00 00 
+    base.s.size = 0;
+    178a:	ba 08 32 00 00       	mov    $0x3208,%edx
+    base.s.ptr = freep = prevp = &base;
+    178f:	c7 05 08 32 00 00 08 	movl   $0x3208,0x3208
+    1796:	32 00 00 
+    base.s.size = 0;
+    1799:	c7 05 0c 32 00 00 00 	movl   $0x0,0x320c
+    17a0:	00 00 00 
+    if(p->s.size >= nunits){
+    17a3:	e9 49 ff ff ff       	jmp    16f1 <bigalloc+0x21>
+    17a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17af:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    17b0:	8b 0a                	mov    (%edx),%ecx
+    17b2:	89 08                	mov    %ecx,(%eax)
+    17b4:	eb b1                	jmp    1767 <bigalloc+0x97>
+    17b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000017c0 <drain>:
+}
+
+// Move n blocks of class c from cache tc to the shared list.
+static void
+drain(struct tcache *tc, int c, int n)
+{
+    17c0:	55                   	push   %ebp
+    17c1:	89 e5                	mov    %esp,%ebp
+    17c3:	57                   	push   %edi
+    17c4:	89 c7                	mov    %eax,%edi
+    17c6:	56                   	push   %esi
+    17c7:	89 d6                	mov    %edx,%esi
+    17c9:	53                   	push   %ebx
+    17ca:	89 cb                	mov    %ecx,%ebx
+    17cc:	83 ec 0c             	sub    $0xc,%esp
+  if(threaded)
+    17cf:	8b 15 84 31 00 00    	mov    0x3184,%edx
+    17d5:	85 d2                	test   %edx,%edx
+    17d7:	75 57                	jne    1830 <drain+0x70>
+  Header *p;
+
+  acquire();
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    17d9:	85 c9                	test   %ecx,%ecx
+    17db:	7e 49                	jle    1826 <drain+0x66>
+    17dd:	89 d9                	mov    %ebx,%ecx
+    17df:	8d 14 b7             	lea    (%edi,%esi,4),%edx
+    17e2:	eb 23                	jmp    1807 <drain+0x47>
+    17e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    tc->list[c] = p->s.ptr;
+    17e8:	8b 18                	mov    (%eax),%ebx
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    17ea:	83 e9 01             	sub    $0x1,%ecx
+    tc->n[c]--;
+    17ed:	83 6a 20 01          	subl   $0x1,0x20(%edx)
+    tc->list[c] = p->s.ptr;
+    17f1:	89 1a                	mov    %ebx,(%edx)
+    p->s.ptr = small[c];
+    17f3:	8b 1c b5 e0 31 00 00 	mov    0x31e0(,%esi,4),%ebx
+    17fa:	89 18                	mov    %ebx,(%eax)
+    small[c] = p;
+    17fc:	89 04 b5 e0 31 00 00 	mov    %eax,0x31e0(,%esi,4)
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1803:	85 c9                	test   %ecx,%ecx
+    1805:	7e 06                	jle    180d <drain+0x4d>
+    1807:	8b 02                	mov    (%edx),%eax
+    1809:	85 c0                	test   %eax,%eax
+    180b:	75 db                	jne    17e8 <drain+0x28>
+  if(threaded)
+    180d:	a1 84 31 00 00       	mov    0x3184,%eax
+    1812:	85 c0                	test   %eax,%eax
+    1814:	74 10                	je     1826 <drain+0x66>
+    mutex_unlock(&lock);
+    1816:	83 ec 0c             	sub    $0xc,%esp
+    1819:	68 88 31 00 00       	push   $0x3188
+    181e:	e8 1d ec ff ff       	call   440 <mutex_unlock>
+}
+    1823:	83 c4 10             	add    $0x10,%esp
+  }
+  release();
+}
+    1826:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1829:	5b                   	pop    %ebx
+    182a:	5e                   	pop    %esi
+    182b:	5f                   	pop    %edi
+    182c:	5d                   	pop    %ebp
+    182d:	c3                   	ret
+    182e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&lock);
+    1830:	83 ec 0c             	sub    $0xc,%esp
+    1833:	68 88 31 00 00       	push   $0x3188
+    1838:	e8 b3 eb ff ff       	call   3f0 <mutex_lock>
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    183d:	83 c4 10             	add    $0x10,%esp
+    1840:	85 db                	test   %ebx,%ebx
+    1842:	7f 99                	jg     17dd <drain+0x1d>
+    1844:	eb c7                	jmp    180d <drain+0x4d>
+    1846:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    184d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001850 <mycache>:
+{
+    1850:	55                   	push   %ebp
+    return &maincache;
+    1851:	b8 a0 31 00 00       	mov    $0x31a0,%eax
+{
+    1856:	89 e5                	mov    %esp,%ebp
+    1858:	53                   	push   %ebx
+  sp = PGROUNDDOWN((uint)&sp);
+    1859:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+    185c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+    1862:	83 ec 14             	sub    $0x14,%esp
+  if(!threaded || sp == mainstack)
+    1865:	8b 0d 84 31 00 00    	mov    0x3184,%ecx
+  sp = PGROUNDDOWN((uint)&sp);
+    186b:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  if(!threaded || sp == mainstack)
+    186e:	85 c9                	test   %ecx,%ecx
+    1870:	74 0f                	je     1881 <mycache+0x31>
+    1872:	3b 1d 80 31 00 00    	cmp    0x3180,%ebx
+    1878:	74 07                	je     1881 <mycache+0x31>
+  if(*cp == 0){
+    187a:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    187d:	85 c0                	test   %eax,%eax
+    187f:	74 0f                	je     1890 <mycache+0x40>
+}
+    1881:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1884:	c9                   	leave
+    1885:	c3                   	ret
+    1886:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    188d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1890:	83 ec 0c             	sub    $0xc,%esp
+    1893:	68 88 31 00 00       	push   $0x3188
+    1898:	e8 53 eb ff ff       	call   3f0 <mutex_lock>
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    189d:	b8 09 00 00 00       	mov    $0x9,%eax
+    18a2:	e8 29 fe ff ff       	call   16d0 <bigalloc>
+  if(threaded)
+    18a7:	8b 15 84 31 00 00    	mov    0x3184,%edx
+    18ad:	83 c4 10             	add    $0x10,%esp
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    18b0:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(threaded)
+    18b3:	85 d2                	test   %edx,%edx
+    18b5:	75 29                	jne    18e0 <mycache+0x90>
+    if(*cp == 0)
+    18b7:	85 c0                	test   %eax,%eax
+    18b9:	74 c6                	je     1881 <mycache+0x31>
+    memset(*cp, 0, sizeof(**cp));
+    18bb:	83 ec 04             	sub    $0x4,%esp
+    *cp = (struct tcache*)((Header*)*cp + 1);
+    18be:	83 c0 08             	add    $0x8,%eax
+    18c1:	89 43 f8             	mov    %eax,-0x8(%ebx)
+    memset(*cp, 0, sizeof(**cp));
+    18c4:	6a 40                	push   $0x40
+    18c6:	6a 00                	push   $0x0
+    18c8:	50                   	push   %eax
+    18c9:	e8 f2 e9 ff ff       	call   2c0 <memset>
+  return *cp;
+    18ce:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    18d1:	83 c4 10             	add    $0x10,%esp
+    18d4:	eb ab                	jmp    1881 <mycache+0x31>
+    18d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18dd:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    18e0:	83 ec 0c             	sub    $0xc,%esp
+    18e3:	68 88 31 00 00       	push   $0x3188
+    18e8:	e8 53 eb ff ff       	call   440 <mutex_unlock>
+    if(*cp == 0)
+    18ed:	8b 43 f8             	mov    -0x8(%ebx),%eax
+}
+    18f0:	83 c4 10             	add    $0x10,%esp
+    18f3:	eb c2                	jmp    18b7 <mycache+0x67>
+    18f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001900 <free>:
+
+void
+free(void *ap)
+{
+    1900:	55                   	push   %ebp
+    1901:	89 e5                	mov    %esp,%ebp
+    1903:	57                   	push   %edi
+    1904:	56                   	push   %esi
+    1905:	53                   	push   %ebx
+    1906:	83 ec 1c             	sub    $0x1c,%esp
+    1909:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  struct tcache *tc;
+  int c;
+
+  if(ap == 0)
+    190c:	85 f6                	test   %esi,%esi
+    190e:	74 51                	je     1961 <free+0x61>
+    return;
+  bp = (Header*)ap - 1;
+    1910:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1913:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(bp->s.size > SMALLMAX / sizeof(Header)){
+    1916:	8b 46 fc             	mov    -0x4(%esi),%eax
+    1919:	3d 00 01 00 00       	cmp    $0x100,%eax
+    191e:	77 50                	ja     1970 <free+0x70>
+    acquire();
+    trim(bigfree(bp));
+    release();
+    return;
+  }
+  for(c = 0; (2 << c) < bp->s.size; c++)
+    1920:	31 db                	xor    %ebx,%ebx
+    1922:	ba 02 00 00 00       	mov    $0x2,%edx
+    1927:	83 f8 02             	cmp    $0x2,%eax
+    192a:	76 11                	jbe    193d <free+0x3d>
+    192c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1930:	83 c3 01             	add    $0x1,%ebx
+    1933:	89 d7                	mov    %edx,%edi
+    1935:	89 d9                	mov    %ebx,%ecx
+    1937:	d3 e7                	shl    %cl,%edi
+    1939:	39 c7                	cmp    %eax,%edi
+    193b:	72 f3                	jb     1930 <free+0x30>
+    ;
+  if((tc = mycache()) == 0){
+    193d:	e8 0e ff ff ff       	call   1850 <mycache>
+    1942:	85 c0                	test   %eax,%eax
+    1944:	74 7a                	je     19c0 <free+0xc0>
+    bp->s.ptr = small[c];
+    small[c] = bp;
+    release();
+    return;
+  }
+  bp->s.ptr = tc->list[c];
+    1946:	8d 0c 98             	lea    (%eax,%ebx,4),%ecx
+    1949:	8b 11                	mov    (%ecx),%edx
+    194b:	89 56 f8             	mov    %edx,-0x8(%esi)
+  tc->list[c] = bp;
+    194e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1951:	89 31                	mov    %esi,(%ecx)
+  if(++tc->n[c] > TCACHEMAX)
+    1953:	8b 71 20             	mov    0x20(%ecx),%esi
+    1956:	8d 56 01             	lea    0x1(%esi),%edx
+    1959:	89 51 20             	mov    %edx,0x20(%ecx)
+    195c:	83 fa 20             	cmp    $0x20,%edx
+    195f:	7f 47                	jg     19a8 <free+0xa8>
+    drain(tc, c, BATCH);
+}
+    1961:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1964:	5b                   	pop    %ebx
+    1965:	5e                   	pop    %esi
+    1966:	5f                   	pop    %edi
+    1967:	5d                   	pop    %ebp
+    1968:	c3                   	ret
+    1969:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1970:	8b 1d 84 31 00 00    	mov    0x3184,%ebx
+    1976:	85 db                	test   %ebx,%ebx
+    1978:	75 66                	jne    19e0 <free+0xe0>
+    trim(bigfree(bp));
+    197a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    197d:	e8 4e fc ff ff       	call   15d0 <bigfree>
+    1982:	e8 c9 fc ff ff       	call   1650 <trim>
+  if(threaded)
+    1987:	8b 0d 84 31 00 00    	mov    0x3184,%ecx
+    198d:	85 c9                	test   %ecx,%ecx
+    198f:	74 d0                	je     1961 <free+0x61>
+    mutex_unlock(&lock);
+    1991:	c7 45 08 88 31 00 00 	movl   $0x3188,0x8(%ebp)
+}
+    1998:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    199b:	5b                   	pop    %ebx
+    199c:	5e                   	pop    %esi
+    199d:	5f                   	pop    %edi
+    199e:	5d                   	pop    %ebp
+    mutex_unlock(&lock);
+    199f:	e9 9c ea ff ff       	jmp    440 <mutex_unlock>
+    19a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    19a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    drain(tc, c, BATCH);
+    19ab:	89 da                	mov    %ebx,%edx
+    19ad:	b9 10 00 00 00       	mov    $0x10,%ecx
+}
+    19b2:	5b                   	pop    %ebx
+    19b3:	5e                   	pop    %esi
+    19b4:	5f                   	pop    %edi
+    19b5:	5d                   	pop    %ebp
+    drain(tc, c, BATCH);
+    19b6:	e9 05 fe ff ff       	jmp    17c0 <drain>
+    19bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    19bf:	90                   	nop
+  if(threaded)
+    19c0:	8b 15 84 31 00 00    	mov    0x3184,%edx
+    19c6:	85 d2                	test   %edx,%edx
+    19c8:	75 28                	jne    19f2 <free+0xf2>
+    bp->s.ptr = small[c];
+    19ca:	8b 04 9d e0 31 00 00 	mov    0x31e0(,%ebx,4),%eax
+    19d1:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    19d4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    19d7:	89 04 9d e0 31 00 00 	mov    %eax,0x31e0(,%ebx,4)
+  if(threaded)
+    19de:	eb 81                	jmp    1961 <free+0x61>
+    mutex_lock(&lock);
+    19e0:	83 ec 0c             	sub    $0xc,%esp
+    19e3:	68 88 31 00 00       	push   $0x3188
+    19e8:	e8 03 ea ff ff       	call   3f0 <mutex_lock>
+}
+    19ed:	83 c4 10             	add    $0x10,%esp
+    19f0:	eb 88                	jmp    197a <free+0x7a>
+    mutex_lock(&lock);
+    19f2:	83 ec 0c             	sub    $0xc,%esp
+    19f5:	68 88 31 00 00       	push   $0x3188
+    19fa:	e8 f1 e9 ff ff       	call   3f0 <mutex_lock>
+    bp->s.ptr = small[c];
+    19ff:	8b 04 9d e0 31 00 00 	mov    0x31e0(,%ebx,4),%eax
+  if(threaded)
+    1a06:	83 c4 10             	add    $0x10,%esp
+    bp->s.ptr = small[c];
+    1a09:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1a0c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1a0f:	89 04 9d e0 31 00 00 	mov    %eax,0x31e0(,%ebx,4)
+  if(threaded)
+    1a16:	a1 84 31 00 00       	mov    0x3184,%eax
+    1a1b:	85 c0                	test   %eax,%eax
+    1a1d:	0f 85 6e ff ff ff    	jne    1991 <free+0x91>
+    1a23:	e9 39 ff ff ff       	jmp    1961 <free+0x61>
+    1a28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a2f:	90                   	nop
+
+00001a30 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1a30:	55                   	push   %ebp
+    1a31:	89 e5                	mov    %esp,%ebp
+    1a33:	57                   	push   %edi
+    1a34:	56                   	push   %esi
+    1a35:	53                   	push   %ebx
+    1a36:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  struct tcache *tc;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1a39:	8b 45 08             	mov    0x8(%ebp),%eax
+    1a3c:	8d 78 07             	lea    0x7(%eax),%edi
+    1a3f:	c1 ef 03             	shr    $0x3,%edi
+    1a42:	83 c7 01             	add    $0x1,%edi
+  if(nunits > SMALLMAX / sizeof(Header)){
+    1a45:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+    1a4b:	77 5b                	ja     1aa8 <malloc+0x78>
+    acquire();
+    p = bigalloc(nunits);
+    release();
+    return p ? (void*)(p + 1) : 0;
+  }
+  for(c = 0; (2 << c) < nunits; c++)
+    1a4d:	31 c9                	xor    %ecx,%ecx
+    1a4f:	b8 02 00 00 00       	mov    $0x2,%eax
+    1a54:	be 02 00 00 00       	mov    $0x2,%esi
+    1a59:	bb 02 00 00 00       	mov    $0x2,%ebx
+    1a5e:	83 ff 02             	cmp    $0x2,%edi
+    1a61:	76 12                	jbe    1a75 <malloc+0x45>
+    1a63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1a67:	90                   	nop
+    1a68:	83 c1 01             	add    $0x1,%ecx
+    1a6b:	89 c3                	mov    %eax,%ebx
+    1a6d:	d3 e3                	shl    %cl,%ebx
+    1a6f:	89 de                	mov    %ebx,%esi
+    1a71:	39 fb                	cmp    %edi,%ebx
+    1a73:	72 f3                	jb     1a68 <malloc+0x38>
+    1a75:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    ;
+  if((tc = mycache()) == 0)
+    1a78:	e8 d3 fd ff ff       	call   1850 <mycache>
+    1a7d:	85 c0                	test   %eax,%eax
+    1a7f:	74 51                	je     1ad2 <malloc+0xa2>
+    return 0;
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1a81:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1a84:	8d 3c 88             	lea    (%eax,%ecx,4),%edi
+    1a87:	8b 07                	mov    (%edi),%eax
+    1a89:	85 c0                	test   %eax,%eax
+    1a8b:	74 53                	je     1ae0 <malloc+0xb0>
+    return 0;
+  p = tc->list[c];
+  tc->list[c] = p->s.ptr;
+  tc->n[c]--;
+    1a8d:	8b 57 20             	mov    0x20(%edi),%edx
+  tc->list[c] = p->s.ptr;
+    1a90:	8b 08                	mov    (%eax),%ecx
+  tc->n[c]--;
+    1a92:	83 ea 01             	sub    $0x1,%edx
+  return (void*)(p + 1);
+    1a95:	83 c0 08             	add    $0x8,%eax
+  tc->n[c]--;
+    1a98:	89 57 20             	mov    %edx,0x20(%edi)
+  tc->list[c] = p->s.ptr;
+    1a9b:	89 0f                	mov    %ecx,(%edi)
+}
+    1a9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1aa0:	5b                   	pop    %ebx
+    1aa1:	5e                   	pop    %esi
+    1aa2:	5f                   	pop    %edi
+    1aa3:	5d                   	pop    %ebp
+    1aa4:	c3                   	ret
+    1aa5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1aa8:	a1 84 31 00 00       	mov    0x3184,%eax
+    1aad:	85 c0                	test   %eax,%eax
+    1aaf:	0f 85 b3 00 00 00    	jne    1b68 <malloc+0x138>
+    p = bigalloc(nunits);
+    1ab5:	89 f8                	mov    %edi,%eax
+    1ab7:	e8 14 fc ff ff       	call   16d0 <bigalloc>
+    1abc:	89 c3                	mov    %eax,%ebx
+  if(threaded)
+    1abe:	a1 84 31 00 00       	mov    0x3184,%eax
+    1ac3:	85 c0                	test   %eax,%eax
+    1ac5:	0f 85 85 00 00 00    	jne    1b50 <malloc+0x120>
+    return p ? (void*)(p + 1) : 0;
+    1acb:	8d 43 08             	lea    0x8(%ebx),%eax
+    1ace:	85 db                	test   %ebx,%ebx
+    1ad0:	75 cb                	jne    1a9d <malloc+0x6d>
+    1ad2:	31 c0                	xor    %eax,%eax
+}
+    1ad4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ad7:	5b                   	pop    %ebx
+    1ad8:	5e                   	pop    %esi
+    1ad9:	5f                   	pop    %edi
+    1ada:	5d                   	pop    %ebp
+    1adb:	c3                   	ret
+    1adc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1ae0:	a1 84 31 00 00       	mov    0x3184,%eax
+    1ae5:	85 c0                	test   %eax,%eax
+    1ae7:	0f 85 29 01 00 00    	jne    1c16 <malloc+0x1e6>
+  if(small[c] == 0){
+    1aed:	8b 04 8d e0 31 00 00 	mov    0x31e0(,%ecx,4),%eax
+    1af4:	85 c0                	test   %eax,%eax
+    1af6:	0f 84 81 00 00 00    	je     1b7d <malloc+0x14d>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1afc:	31 db                	xor    %ebx,%ebx
+    1afe:	eb 22                	jmp    1b22 <malloc+0xf2>
+    small[c] = p->s.ptr;
+    1b00:	8b 10                	mov    (%eax),%edx
+  for(moved = 0; moved < n && small[c]; moved++){
+    1b02:	83 c3 01             	add    $0x1,%ebx
+    small[c] = p->s.ptr;
+    1b05:	89 14 8d e0 31 00 00 	mov    %edx,0x31e0(,%ecx,4)
+    p->s.ptr = tc->list[c];
+    1b0c:	8b 17                	mov    (%edi),%edx
+    1b0e:	89 10                	mov    %edx,(%eax)
+    tc->list[c] = p;
+    1b10:	89 07                	mov    %eax,(%edi)
+  for(moved = 0; moved < n && small[c]; moved++){
+    1b12:	83 fb 10             	cmp    $0x10,%ebx
+    1b15:	0f 84 e2 00 00 00    	je     1bfd <malloc+0x1cd>
+    1b1b:	8b 04 8d e0 31 00 00 	mov    0x31e0(,%ecx,4),%eax
+    1b22:	85 c0                	test   %eax,%eax
+    1b24:	75 da                	jne    1b00 <malloc+0xd0>
+  if(threaded)
+    1b26:	8b 15 84 31 00 00    	mov    0x3184,%edx
+    1b2c:	85 d2                	test   %edx,%edx
+    1b2e:	0f 85 b4 00 00 00    	jne    1be8 <malloc+0x1b8>
+  tc->n[c] += moved;
+    1b34:	8b 57 20             	mov    0x20(%edi),%edx
+    1b37:	01 da                	add    %ebx,%edx
+    1b39:	89 57 20             	mov    %edx,0x20(%edi)
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1b3c:	85 db                	test   %ebx,%ebx
+    1b3e:	74 92                	je     1ad2 <malloc+0xa2>
+  p = tc->list[c];
+    1b40:	8b 07                	mov    (%edi),%eax
+    1b42:	e9 49 ff ff ff       	jmp    1a90 <malloc+0x60>
+    1b47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b4e:	66 90                	xchg   %ax,%ax
+    mutex_unlock(&lock);
+    1b50:	83 ec 0c             	sub    $0xc,%esp
+    1b53:	68 88 31 00 00       	push   $0x3188
+    1b58:	e8 e3 e8 ff ff       	call   440 <mutex_unlock>
+}
+    1b5d:	83 c4 10             	add    $0x10,%esp
+    1b60:	e9 66 ff ff ff       	jmp    1acb <malloc+0x9b>
+    1b65:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1b68:	83 ec 0c             	sub    $0xc,%esp
+    1b6b:	68 88 31 00 00       	push   $0x3188
+    1b70:	e8 7b e8 ff ff       	call   3f0 <mutex_lock>
+}
+    1b75:	83 c4 10             	add    $0x10,%esp
+    1b78:	e9 38 ff ff ff       	jmp    1ab5 <malloc+0x85>
+    if((chunk = bigalloc(CHUNK / sizeof(Header) + 1)) == 0){
+    1b7d:	b8 01 02 00 00       	mov    $0x201,%eax
+    1b82:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1b85:	e8 46 fb ff ff       	call   16d0 <bigalloc>
+    1b8a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1b8d:	85 c0                	test   %eax,%eax
+    1b8f:	89 c2                	mov    %eax,%edx
+    1b91:	0f 84 ba 00 00 00    	je     1c51 <malloc+0x221>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1b97:	83 c2 08             	add    $0x8,%edx
+    1b9a:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+    1ba0:	0f 87 d0 00 00 00    	ja     1c76 <malloc+0x246>
+    1ba6:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+    1bad:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    1bb0:	89 df                	mov    %ebx,%edi
+    1bb2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1bb5:	8d 76 00             	lea    0x0(%esi),%esi
+      p->s.size = units;
+    1bb8:	89 72 04             	mov    %esi,0x4(%edx)
+      p->s.ptr = small[c];
+    1bbb:	8b 04 8d e0 31 00 00 	mov    0x31e0(,%ecx,4),%eax
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1bc2:	01 df                	add    %ebx,%edi
+    1bc4:	89 55 e0             	mov    %edx,-0x20(%ebp)
+      p->s.ptr = small[c];
+    1bc7:	89 02                	mov    %eax,(%edx)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1bc9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      small[c] = p;
+    1bcc:	89 14 8d e0 31 00 00 	mov    %edx,0x31e0(,%ecx,4)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1bd3:	01 c2                	add    %eax,%edx
+    1bd5:	81 ff 00 02 00 00    	cmp    $0x200,%edi
+    1bdb:	76 db                	jbe    1bb8 <malloc+0x188>
+    1bdd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1be0:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1be3:	e9 14 ff ff ff       	jmp    1afc <malloc+0xcc>
+    mutex_unlock(&lock);
+    1be8:	83 ec 0c             	sub    $0xc,%esp
+    1beb:	68 88 31 00 00       	push   $0x3188
+    1bf0:	e8 4b e8 ff ff       	call   440 <mutex_unlock>
+}
+    1bf5:	83 c4 10             	add    $0x10,%esp
+    1bf8:	e9 37 ff ff ff       	jmp    1b34 <malloc+0x104>
+  if(threaded)
+    1bfd:	a1 84 31 00 00       	mov    0x3184,%eax
+    1c02:	85 c0                	test   %eax,%eax
+    1c04:	75 2b                	jne    1c31 <malloc+0x201>
+  tc->n[c] += moved;
+    1c06:	8b 47 20             	mov    0x20(%edi),%eax
+    1c09:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1c0c:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1c0e:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1c11:	e9 7a fe ff ff       	jmp    1a90 <malloc+0x60>
+    mutex_lock(&lock);
+    1c16:	83 ec 0c             	sub    $0xc,%esp
+    1c19:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1c1c:	68 88 31 00 00       	push   $0x3188
+    1c21:	e8 ca e7 ff ff       	call   3f0 <mutex_lock>
+}
+    1c26:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1c29:	83 c4 10             	add    $0x10,%esp
+    1c2c:	e9 bc fe ff ff       	jmp    1aed <malloc+0xbd>
+    mutex_unlock(&lock);
+    1c31:	83 ec 0c             	sub    $0xc,%esp
+    1c34:	68 88 31 00 00       	push   $0x3188
+    1c39:	e8 02 e8 ff ff       	call   440 <mutex_unlock>
+  tc->n[c] += moved;
+    1c3e:	8b 47 20             	mov    0x20(%edi),%eax
+    1c41:	83 c4 10             	add    $0x10,%esp
+    1c44:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1c47:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1c49:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1c4c:	e9 3f fe ff ff       	jmp    1a90 <malloc+0x60>
+  if(threaded)
+    1c51:	8b 0d 84 31 00 00    	mov    0x3184,%ecx
+    1c57:	85 c9                	test   %ecx,%ecx
+    1c59:	0f 84 73 fe ff ff    	je     1ad2 <malloc+0xa2>
+    mutex_unlock(&lock);
+    1c5f:	83 ec 0c             	sub    $0xc,%esp
+    1c62:	68 88 31 00 00       	push   $0x3188
+    1c67:	e8 d4 e7 ff ff       	call   440 <mutex_unlock>
+    1c6c:	83 c4 10             	add    $0x10,%esp
+    return p ? (void*)(p + 1) : 0;
+    1c6f:	31 c0                	xor    %eax,%eax
+    1c71:	e9 5e fe ff ff       	jmp    1ad4 <malloc+0xa4>
+  for(moved = 0; moved < n && small[c]; moved++){
+    1c76:	8b 04 8d e0 31 00 00 	mov    0x31e0(,%ecx,4),%eax
+    1c7d:	e9 7a fe ff ff       	jmp    1afc <malloc+0xcc>
+    1c82:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001c90 <malloc_threaded>:
+void
+malloc_threaded(void)
+{
+  uint sp;
+
+  if(threaded)
+    1c90:	a1 84 31 00 00       	mov    0x3184,%eax
+    1c95:	85 c0                	test   %eax,%eax
+    1c97:	74 07                	je     1ca0 <malloc_threaded+0x10>
+    1c99:	c3                   	ret
+    1c9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+{
+    1ca0:	55                   	push   %ebp
+    1ca1:	89 e5                	mov    %esp,%ebp
+    1ca3:	83 ec 24             	sub    $0x24,%esp
+    return;
+  mutex_init(&lock);
+    1ca6:	68 88 31 00 00       	push   $0x3188
+    1cab:	e8 30 e7 ff ff       	call   3e0 <mutex_init>
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1cb0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1cb3:	83 c4 10             	add    $0x10,%esp
+  threaded = 1;
+    1cb6:	c7 05 84 31 00 00 01 	movl   $0x1,0x3184
+    1cbd:	00 00 00 
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1cc0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    1cc5:	a3 80 31 00 00       	mov    %eax,0x3180
+}
+    1cca:	c9                   	leave
+    1ccb:	c3                   	ret
+    1ccc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001cd0 <malloc_thread_exit>:
+
+// Called by thread_join() with the cache slot of a finished
+// thread: give its blocks, and the cache itself, back.
+void
+malloc_thread_exit(void **cachep)
+{
+    1cd0:	55                   	push   %ebp
+    1cd1:	89 e5                	mov    %esp,%ebp
+    1cd3:	57                   	push   %edi
+    1cd4:	56                   	push   %esi
+    1cd5:	53                   	push   %ebx
+    1cd6:	83 ec 0c             	sub    $0xc,%esp
+    1cd9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct tcache *tc;
+  int c;
+
+  if((tc = *cachep) == 0)
+    1cdc:	8b 37                	mov    (%edi),%esi
+    1cde:	85 f6                	test   %esi,%esi
+    1ce0:	74 41                	je     1d23 <malloc_thread_exit+0x53>
+    return;
+  for(c = 0; c < NCLASS; c++)
+    1ce2:	31 db                	xor    %ebx,%ebx
+    1ce4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    drain(tc, c, tc->n[c]);
+    1ce8:	8b 4c 9e 20          	mov    0x20(%esi,%ebx,4),%ecx
+    1cec:	89 da                	mov    %ebx,%edx
+    1cee:	89 f0                	mov    %esi,%eax
+  for(c = 0; c < NCLASS; c++)
+    1cf0:	83 c3 01             	add    $0x1,%ebx
+    drain(tc, c, tc->n[c]);
+    1cf3:	e8 c8 fa ff ff       	call   17c0 <drain>
+  for(c = 0; c < NCLASS; c++)
+    1cf8:	83 fb 08             	cmp    $0x8,%ebx
+    1cfb:	75 eb                	jne    1ce8 <malloc_thread_exit+0x18>
+  if(threaded)
+    1cfd:	8b 15 84 31 00 00    	mov    0x3184,%edx
+    1d03:	85 d2                	test   %edx,%edx
+    1d05:	75 29                	jne    1d30 <malloc_thread_exit+0x60>
+  acquire();
+  trim(bigfree((Header*)tc - 1));
+    1d07:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1d0a:	e8 c1 f8 ff ff       	call   15d0 <bigfree>
+    1d0f:	e8 3c f9 ff ff       	call   1650 <trim>
+  if(threaded)
+    1d14:	a1 84 31 00 00       	mov    0x3184,%eax
+    1d19:	85 c0                	test   %eax,%eax
+    1d1b:	75 2b                	jne    1d48 <malloc_thread_exit+0x78>
+  release();
+  *cachep = 0;
+    1d1d:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+}
+    1d23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d26:	5b                   	pop    %ebx
+    1d27:	5e                   	pop    %esi
+    1d28:	5f                   	pop    %edi
+    1d29:	5d                   	pop    %ebp
+    1d2a:	c3                   	ret
+    1d2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1d2f:	90                   	nop
+    mutex_lock(&lock);
+    1d30:	83 ec 0c             	sub    $0xc,%esp
+    1d33:	68 88 31 00 00       	push   $0x3188
+    1d38:	e8 b3 e6 ff ff       	call   3f0 <mutex_lock>
+}
+    1d3d:	83 c4 10             	add    $0x10,%esp
+    1d40:	eb c5                	jmp    1d07 <malloc_thread_exit+0x37>
+    1d42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1d48:	83 ec 0c             	sub    $0xc,%esp
+    1d4b:	68 88 31 00 00       	push   $0x3188
+    1d50:	e8 eb e6 ff ff       	call   440 <mutex_unlock>
+}
+    1d55:	83 c4 10             	add    $0x10,%esp
+    1d58:	eb c3                	jmp    1d1d <malloc_thread_exit+0x4d>
+    1d5a:	66 90                	xchg   %ax,%ax
+    1d5c:	66 90                	xchg   %ax,%ax
+    1d5e:	66 90                	xchg   %ax,%ax
+
+00001d60 <thread_create>:
+
+// Start fn(arg) in a new thread on a freshly allocated
+// page-aligned stack.  Returns the thread's pid.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1d60:	55                   	push   %ebp
+    1d61:	89 e5                	mov    %esp,%ebp
+    1d63:	53                   	push   %ebx
+    1d64:	83 ec 14             	sub    $0x14,%esp
+  char *mem, *stack;
+  int pid;
+
+  malloc_threaded();
+    1d67:	e8 24 ff ff ff       	call   1c90 <malloc_threaded>
+  stdio_threaded();
+    1d6c:	e8 cf ee ff ff       	call   c40 <stdio_threaded>
+  if((mem = malloc(2*PGSIZE)) == 0)
+    1d71:	83 ec 0c             	sub    $0xc,%esp
+    1d74:	68 00 20 00 00       	push   $0x2000
+    1d79:	e8 b2 fc ff ff       	call   1a30 <malloc>
+    1d7e:	83 c4 10             	add    $0x10,%esp
+    1d81:	85 c0                	test   %eax,%eax
+    1d83:	74 52                	je     1dd7 <thread_create+0x77>
+    1d85:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1d87:	8d 80 07 10 00 00    	lea    0x1007(%eax),%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+  ((char**)stack)[-2] = 0;
+  if((pid = clone(fn, arg, stack)) < 0)
+    1d8d:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1d90:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+    1d95:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  ((char**)stack)[-2] = 0;
+    1d98:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+  if((pid = clone(fn, arg, stack)) < 0)
+    1d9f:	50                   	push   %eax
+    1da0:	ff 75 0c             	push   0xc(%ebp)
+    1da3:	ff 75 08             	push   0x8(%ebp)
+    1da6:	e8 97 e8 ff ff       	call   642 <clone>
+    1dab:	83 c4 10             	add    $0x10,%esp
+    1dae:	85 c0                	test   %eax,%eax
+    1db0:	78 0e                	js     1dc0 <thread_create+0x60>
+    free(mem);
+  return pid;
+}
+    1db2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1db5:	c9                   	leave
+    1db6:	c3                   	ret
+    1db7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1dbe:	66 90                	xchg   %ax,%ax
+    free(mem);
+    1dc0:	83 ec 0c             	sub    $0xc,%esp
+    1dc3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1dc6:	53                   	push   %ebx
+    1dc7:	e8 34 fb ff ff       	call   1900 <free>
+    1dcc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1dcf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    1dd2:	83 c4 10             	add    $0x10,%esp
+}
+    1dd5:	c9                   	leave
+    1dd6:	c3                   	ret
+    return -1;
+    1dd7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1ddc:	eb d4                	jmp    1db2 <thread_create+0x52>
+    1dde:	66 90                	xchg   %ax,%ax
+
+00001de0 <thread_join>:
+
+// Wait for a thread to finish and free its stack.
+int
+thread_join(void)
+{
+    1de0:	55                   	push   %ebp
+    1de1:	89 e5                	mov    %esp,%ebp
+    1de3:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    1de4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    1de7:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    1dea:	50                   	push   %eax
+    1deb:	e8 61 e8 ff ff       	call   651 <join>
+    1df0:	83 c4 10             	add    $0x10,%esp
+    1df3:	85 c0                	test   %eax,%eax
+    1df5:	78 29                	js     1e20 <thread_join+0x40>
+    1df7:	89 c3                	mov    %eax,%ebx
+    return -1;
+  malloc_thread_exit(&((void**)stack)[-2]);
+    1df9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1dfc:	83 ec 0c             	sub    $0xc,%esp
+    1dff:	83 e8 08             	sub    $0x8,%eax
+    1e02:	50                   	push   %eax
+    1e03:	e8 c8 fe ff ff       	call   1cd0 <malloc_thread_exit>
+  free(((char**)stack)[-1]);
+    1e08:	58                   	pop    %eax
+    1e09:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1e0c:	ff 70 fc             	push   -0x4(%eax)
+    1e0f:	e8 ec fa ff ff       	call   1900 <free>
+  return pid;
+    1e14:	83 c4 10             	add    $0x10,%esp
+}
+    1e17:	89 d8                	mov    %ebx,%eax
+    1e19:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1e1c:	c9                   	leave
+    1e1d:	c3                   	ret
+    1e1e:	66 90                	xchg   %ax,%ax
+    return -1;
+    1e20:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    1e25:	eb f0                	jmp    1e17 <thread_join+0x37>
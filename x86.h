@@ -57,6 +57,41 @@ stosl(void *addr, int data, int cnt) {
             "memory", "cc");
 }
 
+// Copy cnt bytes or dwords from src to dst, ascending.
+static inline void
+movsb(void *dst, const void *src, int cnt) {
+    asm volatile("cld; rep movsb" :
+            "=D" (dst), "=S" (src), "=c" (cnt) :
+            "0" (dst), "1" (src), "2" (cnt) :
+            "memory", "cc");
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt) {
+    asm volatile("cld; rep movsl" :
+            "=D" (dst), "=S" (src), "=c" (cnt) :
+            "0" (dst), "1" (src), "2" (cnt) :
+            "memory", "cc");
+}
+
+// The same, descending: dst and src point at the last byte or
+// dword to copy.
+static inline void
+rmovsb(void *dst, const void *src, int cnt) {
+    asm volatile("std; rep movsb; cld" :
+            "=D" (dst), "=S" (src), "=c" (cnt) :
+            "0" (dst), "1" (src), "2" (cnt) :
+            "memory", "cc");
+}
+
+static inline void
+rmovsl(void *dst, const void *src, int cnt) {
+    asm volatile("std; rep movsl; cld" :
+            "=D" (dst), "=S" (src), "=c" (cnt) :
+            "0" (dst), "1" (src), "2" (cnt) :
+            "memory", "cc");
+}
+
 struct segdesc;
 
 static inline void
@@ -122,6 +157,14 @@ sti(void) {
     asm volatile("sti");
 }
 
+// Enable interrupts and wait for one. sti takes effect only after
+// the following instruction, so no interrupt can arrive between
+// the two and be missed by hlt.
+static inline void
+stihlt(void) {
+    asm volatile("sti; hlt");
+}
+
 //返回旧值
 static inline uint
 xchg(volatile uint *addr, uint newval) {
@@ -135,6 +178,22 @@ xchg(volatile uint *addr, uint newval) {
     return result;
 }
 
+// Low 32 bits of the time-stamp counter.
+static inline uint
+rdtsc(void) {
+    uint lo, hi;
+    asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+    return lo;
+}
+
+// The whole 64-bit time-stamp counter.
+static inline unsigned long long
+rdtsc64(void) {
+    unsigned long long t;
+    asm volatile("rdtsc" : "=A" (t));
+    return t;
+}
+
 static inline uint
 rcr2(void) {
     uint val;
@@ -147,6 +206,79 @@ lcr3(uint val) {
     asm volatile("movl %0,%%cr3" : : "r" (val));
 }
 
+static inline uint
+rcr3(void) {
+    uint val;
+    asm volatile("movl %%cr3,%0" : "=r" (val));
+    return val;
+}
+
+static inline uint
+rcr4(void) {
+    uint val;
+    asm volatile("movl %%cr4,%0" : "=r" (val));
+    return val;
+}
+
+static inline void
+lcr4(uint val) {
+    asm volatile("movl %0,%%cr4" : : "r" (val));
+}
+
+// Execute CPUID leaf op; returns %edx, where most of the
+// feature flags of leaf 1 are.
+static inline uint
+cpuidedx(uint op) {
+    uint a, b, c, d;
+    asm volatile("cpuid" : "=a" (a), "=b" (b), "=c" (c), "=d" (d) : "a" (op), "c" (0));
+    return d;
+}
+
+static inline uint
+rcr0(void) {
+    uint val;
+    asm volatile("movl %%cr0,%0" : "=r" (val));
+    return val;
+}
+
+static inline void
+lcr0(uint val) {
+    asm volatile("movl %0,%%cr0" : : "r" (val));
+}
+
+// Clear CR0_TS, so FPU instructions no longer trap.
+static inline void
+clts(void) {
+    asm volatile("clts");
+}
+
+static inline void
+fninit(void) {
+    asm volatile("fninit");
+}
+
+static inline void
+ldmxcsr(uint val) {
+    asm volatile("ldmxcsr %0" : : "m" (val));
+}
+
+// Save or restore the FPU and SSE registers to or from a
+// 512-byte, 16-byte aligned area.
+static inline void
+fxsave(void *p) {
+    asm volatile("fxsave (%0)" : : "r" (p) : "memory");
+}
+
+static inline void
+fxrstor(void *p) {
+    asm volatile("fxrstor (%0)" : : "r" (p) : "memory");
+}
+
+static inline void
+wrmsr(uint msr, uint val) {
+    asm volatile("wrmsr" : : "c" (msr), "a" (val), "d" (0));
+}
+
 //PAGEBREAK: 36
 // Layout of the trap frame built on the stack by the
 // hardware and by trapasm.S, and passed to trap().
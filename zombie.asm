@@ -0,0 +1,3951 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+      11:	e8 1a 00 00 00       	call   30 <fork>
+      16:	85 c0                	test   %eax,%eax
+      18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+      1a:	83 ec 0c             	sub    $0xc,%esp
+      1d:	6a 05                	push   $0x5
+      1f:	e8 bf 04 00 00       	call   4e3 <sleep>
+      24:	83 c4 10             	add    $0x10,%esp
+  exit();
+      27:	e8 64 00 00 00       	call   90 <exit>
+      2c:	66 90                	xchg   %ax,%ax
+      2e:	66 90                	xchg   %ax,%ax
+
+00000030 <fork>:
+int sysexit(void) __attribute__((noreturn));
+
+int
+fork(void)
+{
+  if(flushhook)
+      30:	a1 80 27 00 00       	mov    0x2780,%eax
+      35:	85 c0                	test   %eax,%eax
+      37:	74 17                	je     50 <fork+0x20>
+{
+      39:	55                   	push   %ebp
+      3a:	89 e5                	mov    %esp,%ebp
+      3c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+      3f:	ff d0                	call   *%eax
+  return sysfork();
+}
+      41:	c9                   	leave
+  return sysfork();
+      42:	e9 7f 03 00 00       	jmp    3c6 <sysfork>
+      47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      4e:	66 90                	xchg   %ax,%ax
+      50:	e9 71 03 00 00       	jmp    3c6 <sysfork>
+      55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000060 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+      60:	55                   	push   %ebp
+  if(flushhook)
+      61:	a1 80 27 00 00       	mov    0x2780,%eax
+{
+      66:	89 e5                	mov    %esp,%ebp
+      68:	56                   	push   %esi
+      69:	53                   	push   %ebx
+      6a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+      6d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+      70:	85 c0                	test   %eax,%eax
+      72:	74 02                	je     76 <exec+0x16>
+    flushhook();
+      74:	ff d0                	call   *%eax
+  return sysexec(path, argv);
+      76:	89 75 0c             	mov    %esi,0xc(%ebp)
+      79:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+      7c:	5b                   	pop    %ebx
+      7d:	5e                   	pop    %esi
+      7e:	5d                   	pop    %ebp
+  return sysexec(path, argv);
+      7f:	e9 ba 03 00 00       	jmp    43e <sysexec>
+      84:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      8f:	90                   	nop
+
+00000090 <exit>:
+
+int
+exit(void)
+{
+      90:	55                   	push   %ebp
+      91:	89 e5                	mov    %esp,%ebp
+      93:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+      96:	a1 80 27 00 00       	mov    0x2780,%eax
+      9b:	85 c0                	test   %eax,%eax
+      9d:	74 02                	je     a1 <exit+0x11>
+    flushhook();
+      9f:	ff d0                	call   *%eax
+  sysexit();
+      a1:	e8 2f 03 00 00       	call   3d5 <sysexit>
+      a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000b0 <strcpy>:
+}
+
+char*
+strcpy(char *s, const char *t)
+{
+      b0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+      b1:	31 c0                	xor    %eax,%eax
+{
+      b3:	89 e5                	mov    %esp,%ebp
+      b5:	53                   	push   %ebx
+      b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+      bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+      c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+      c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+      c7:	83 c0 01             	add    $0x1,%eax
+      ca:	84 d2                	test   %dl,%dl
+      cc:	75 f2                	jne    c0 <strcpy+0x10>
+    ;
+  return os;
+}
+      ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      d1:	89 c8                	mov    %ecx,%eax
+      d3:	c9                   	leave
+      d4:	c3                   	ret
+      d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+      e0:	55                   	push   %ebp
+      e1:	89 e5                	mov    %esp,%ebp
+      e3:	53                   	push   %ebx
+      e4:	8b 55 08             	mov    0x8(%ebp),%edx
+      e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+      ea:	0f b6 02             	movzbl (%edx),%eax
+      ed:	84 c0                	test   %al,%al
+      ef:	75 17                	jne    108 <strcmp+0x28>
+      f1:	eb 3a                	jmp    12d <strcmp+0x4d>
+      f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      f7:	90                   	nop
+      f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+      fc:	83 c2 01             	add    $0x1,%edx
+      ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     102:	84 c0                	test   %al,%al
+     104:	74 1a                	je     120 <strcmp+0x40>
+    p++, q++;
+     106:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     108:	0f b6 19             	movzbl (%ecx),%ebx
+     10b:	38 c3                	cmp    %al,%bl
+     10d:	74 e9                	je     f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     10f:	29 d8                	sub    %ebx,%eax
+}
+     111:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     114:	c9                   	leave
+     115:	c3                   	ret
+     116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     11d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     120:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     124:	31 c0                	xor    %eax,%eax
+     126:	29 d8                	sub    %ebx,%eax
+}
+     128:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     12b:	c9                   	leave
+     12c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     12d:	0f b6 19             	movzbl (%ecx),%ebx
+     130:	31 c0                	xor    %eax,%eax
+     132:	eb db                	jmp    10f <strcmp+0x2f>
+     134:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     13b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     13f:	90                   	nop
+
+00000140 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     140:	55                   	push   %ebp
+     141:	89 e5                	mov    %esp,%ebp
+     143:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     146:	80 3a 00             	cmpb   $0x0,(%edx)
+     149:	74 15                	je     160 <strlen+0x20>
+     14b:	31 c0                	xor    %eax,%eax
+     14d:	8d 76 00             	lea    0x0(%esi),%esi
+     150:	83 c0 01             	add    $0x1,%eax
+     153:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     157:	89 c1                	mov    %eax,%ecx
+     159:	75 f5                	jne    150 <strlen+0x10>
+    ;
+  return n;
+}
+     15b:	89 c8                	mov    %ecx,%eax
+     15d:	5d                   	pop    %ebp
+     15e:	c3                   	ret
+     15f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     160:	31 c9                	xor    %ecx,%ecx
+}
+     162:	5d                   	pop    %ebp
+     163:	89 c8                	mov    %ecx,%eax
+     165:	c3                   	ret
+     166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     16d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000170 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     170:	55                   	push   %ebp
+     171:	89 e5                	mov    %esp,%ebp
+     173:	57                   	push   %edi
+     174:	8b 55 08             	mov    0x8(%ebp),%edx
+            "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt) {
+    asm volatile("cld; rep stosb" :
+     177:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     17a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     17d:	89 d7                	mov    %edx,%edi
+     17f:	fc                   	cld
+     180:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     182:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     185:	89 d0                	mov    %edx,%eax
+     187:	c9                   	leave
+     188:	c3                   	ret
+     189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000190 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     190:	55                   	push   %ebp
+     191:	89 e5                	mov    %esp,%ebp
+     193:	8b 45 08             	mov    0x8(%ebp),%eax
+     196:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     19a:	0f b6 10             	movzbl (%eax),%edx
+     19d:	84 d2                	test   %dl,%dl
+     19f:	75 12                	jne    1b3 <strchr+0x23>
+     1a1:	eb 1d                	jmp    1c0 <strchr+0x30>
+     1a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1a7:	90                   	nop
+     1a8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     1ac:	83 c0 01             	add    $0x1,%eax
+     1af:	84 d2                	test   %dl,%dl
+     1b1:	74 0d                	je     1c0 <strchr+0x30>
+    if(*s == c)
+     1b3:	38 d1                	cmp    %dl,%cl
+     1b5:	75 f1                	jne    1a8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     1b7:	5d                   	pop    %ebp
+     1b8:	c3                   	ret
+     1b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     1c0:	31 c0                	xor    %eax,%eax
+}
+     1c2:	5d                   	pop    %ebp
+     1c3:	c3                   	ret
+     1c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1cf:	90                   	nop
+
+000001d0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     1d0:	55                   	push   %ebp
+     1d1:	89 e5                	mov    %esp,%ebp
+     1d3:	56                   	push   %esi
+     1d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     1d5:	83 ec 08             	sub    $0x8,%esp
+     1d8:	6a 00                	push   $0x0
+     1da:	ff 75 08             	push   0x8(%ebp)
+     1dd:	e8 6b 02 00 00       	call   44d <open>
+  if(fd < 0)
+     1e2:	83 c4 10             	add    $0x10,%esp
+     1e5:	85 c0                	test   %eax,%eax
+     1e7:	78 27                	js     210 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     1e9:	83 ec 08             	sub    $0x8,%esp
+     1ec:	ff 75 0c             	push   0xc(%ebp)
+     1ef:	89 c3                	mov    %eax,%ebx
+     1f1:	50                   	push   %eax
+     1f2:	e8 83 02 00 00       	call   47a <fstat>
+  close(fd);
+     1f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     1fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+     1fc:	e8 1f 02 00 00       	call   420 <close>
+  return r;
+     201:	83 c4 10             	add    $0x10,%esp
+}
+     204:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     207:	89 f0                	mov    %esi,%eax
+     209:	5b                   	pop    %ebx
+     20a:	5e                   	pop    %esi
+     20b:	5d                   	pop    %ebp
+     20c:	c3                   	ret
+     20d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     210:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     215:	eb ed                	jmp    204 <stat+0x34>
+     217:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     21e:	66 90                	xchg   %ax,%ax
+
+00000220 <atoi>:
+
+int
+atoi(const char *s)
+{
+     220:	55                   	push   %ebp
+     221:	89 e5                	mov    %esp,%ebp
+     223:	53                   	push   %ebx
+     224:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     227:	0f be 02             	movsbl (%edx),%eax
+     22a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     22d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     230:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     235:	77 1e                	ja     255 <atoi+0x35>
+     237:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     23e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     240:	83 c2 01             	add    $0x1,%edx
+     243:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     246:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     24a:	0f be 02             	movsbl (%edx),%eax
+     24d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     250:	80 fb 09             	cmp    $0x9,%bl
+     253:	76 eb                	jbe    240 <atoi+0x20>
+  return n;
+}
+     255:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     258:	89 c8                	mov    %ecx,%eax
+     25a:	c9                   	leave
+     25b:	c3                   	ret
+     25c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     260:	55                   	push   %ebp
+     261:	89 e5                	mov    %esp,%ebp
+     263:	57                   	push   %edi
+     264:	56                   	push   %esi
+     265:	8b 45 10             	mov    0x10(%ebp),%eax
+     268:	8b 55 08             	mov    0x8(%ebp),%edx
+     26b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     26e:	85 c0                	test   %eax,%eax
+     270:	7e 13                	jle    285 <memmove+0x25>
+     272:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     274:	89 d7                	mov    %edx,%edi
+     276:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     27d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     280:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     281:	39 f8                	cmp    %edi,%eax
+     283:	75 fb                	jne    280 <memmove+0x20>
+  return vdst;
+}
+     285:	5e                   	pop    %esi
+     286:	89 d0                	mov    %edx,%eax
+     288:	5f                   	pop    %edi
+     289:	5d                   	pop    %ebp
+     28a:	c3                   	ret
+     28b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     28f:	90                   	nop
+
+00000290 <mutex_init>:
+
+// Futex-based mutex (Drepper, "Futexes Are Tricky", mutex 2).
+// The uncontended paths never enter the kernel.
+void
+mutex_init(struct mutex *m)
+{
+     290:	55                   	push   %ebp
+     291:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+     293:	8b 45 08             	mov    0x8(%ebp),%eax
+     296:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     29c:	5d                   	pop    %ebp
+     29d:	c3                   	ret
+     29e:	66 90                	xchg   %ax,%ax
+
+000002a0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     2a0:	55                   	push   %ebp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     2a1:	31 c0                	xor    %eax,%eax
+     2a3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+     2a8:	89 e5                	mov    %esp,%ebp
+     2aa:	56                   	push   %esi
+     2ab:	53                   	push   %ebx
+     2ac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->val, 0, 1)) == 0)
+     2af:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     2b3:	85 c0                	test   %eax,%eax
+     2b5:	74 32                	je     2e9 <mutex_lock+0x49>
+    return;
+  if(c != 2)
+     2b7:	83 f8 02             	cmp    $0x2,%eax
+     2ba:	74 0c                	je     2c8 <mutex_lock+0x28>
+static inline uint
+xchg(volatile uint *addr, uint newval) {
+    uint result;
+
+    // The + in "+m" denotes a read-modify-write operand.
+    asm volatile("lock; xchgl %0, %1" :
+     2bc:	b8 02 00 00 00       	mov    $0x2,%eax
+     2c1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+     2c4:	85 c0                	test   %eax,%eax
+     2c6:	74 21                	je     2e9 <mutex_lock+0x49>
+     2c8:	be 02 00 00 00       	mov    $0x2,%esi
+     2cd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAIT, 2);
+     2d0:	83 ec 04             	sub    $0x4,%esp
+     2d3:	6a 02                	push   $0x2
+     2d5:	6a 00                	push   $0x0
+     2d7:	53                   	push   %ebx
+     2d8:	e8 33 02 00 00       	call   510 <futex>
+     2dd:	89 f0                	mov    %esi,%eax
+     2df:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     2e2:	83 c4 10             	add    $0x10,%esp
+     2e5:	85 c0                	test   %eax,%eax
+     2e7:	75 e7                	jne    2d0 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+     2e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     2ec:	5b                   	pop    %ebx
+     2ed:	5e                   	pop    %esi
+     2ee:	5d                   	pop    %ebp
+     2ef:	c3                   	ret
+
+000002f0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     2f0:	55                   	push   %ebp
+     2f1:	89 e5                	mov    %esp,%ebp
+     2f3:	83 ec 08             	sub    $0x8,%esp
+     2f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     2f9:	f0 83 28 01          	lock subl $0x1,(%eax)
+     2fd:	75 09                	jne    308 <mutex_unlock+0x18>
+    m->val = 0;
+    futex(&m->val, FUTEX_WAKE, 1);
+  }
+}
+     2ff:	c9                   	leave
+     300:	c3                   	ret
+     301:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     308:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     30b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex(&m->val, FUTEX_WAKE, 1);
+     311:	6a 01                	push   $0x1
+     313:	6a 01                	push   $0x1
+     315:	50                   	push   %eax
+     316:	e8 f5 01 00 00       	call   510 <futex>
+     31b:	83 c4 10             	add    $0x10,%esp
+}
+     31e:	c9                   	leave
+     31f:	c3                   	ret
+
+00000320 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     320:	55                   	push   %ebp
+     321:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     323:	8b 45 08             	mov    0x8(%ebp),%eax
+     326:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     32c:	5d                   	pop    %ebp
+     32d:	c3                   	ret
+     32e:	66 90                	xchg   %ax,%ax
+
+00000330 <cond_wait>:
+
+// Release m and wait for a signal, then reacquire m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     330:	55                   	push   %ebp
+     331:	89 e5                	mov    %esp,%ebp
+     333:	57                   	push   %edi
+     334:	56                   	push   %esi
+     335:	53                   	push   %ebx
+     336:	83 ec 0c             	sub    $0xc,%esp
+     339:	8b 75 08             	mov    0x8(%ebp),%esi
+     33c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     33f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->val, 1) != 1){
+     341:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+     345:	75 21                	jne    368 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     347:	83 ec 04             	sub    $0x4,%esp
+     34a:	57                   	push   %edi
+     34b:	6a 00                	push   $0x0
+     34d:	56                   	push   %esi
+     34e:	e8 bd 01 00 00       	call   510 <futex>
+  mutex_lock(m);
+     353:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     356:	83 c4 10             	add    $0x10,%esp
+}
+     359:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     35c:	5b                   	pop    %ebx
+     35d:	5e                   	pop    %esi
+     35e:	5f                   	pop    %edi
+     35f:	5d                   	pop    %ebp
+  mutex_lock(m);
+     360:	e9 3b ff ff ff       	jmp    2a0 <mutex_lock>
+     365:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->val, FUTEX_WAKE, 1);
+     368:	83 ec 04             	sub    $0x4,%esp
+    m->val = 0;
+     36b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex(&m->val, FUTEX_WAKE, 1);
+     371:	6a 01                	push   $0x1
+     373:	6a 01                	push   $0x1
+     375:	53                   	push   %ebx
+     376:	e8 95 01 00 00       	call   510 <futex>
+     37b:	83 c4 10             	add    $0x10,%esp
+     37e:	eb c7                	jmp    347 <cond_wait+0x17>
+
+00000380 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+     380:	55                   	push   %ebp
+     381:	89 e5                	mov    %esp,%ebp
+     383:	83 ec 0c             	sub    $0xc,%esp
+     386:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     389:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+     38d:	6a 01                	push   $0x1
+     38f:	6a 01                	push   $0x1
+     391:	50                   	push   %eax
+     392:	e8 79 01 00 00       	call   510 <futex>
+}
+     397:	83 c4 10             	add    $0x10,%esp
+     39a:	c9                   	leave
+     39b:	c3                   	ret
+     39c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003a0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     3a0:	55                   	push   %ebp
+     3a1:	89 e5                	mov    %esp,%ebp
+     3a3:	83 ec 0c             	sub    $0xc,%esp
+     3a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     3a9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+     3ad:	6a 40                	push   $0x40
+     3af:	6a 01                	push   $0x1
+     3b1:	50                   	push   %eax
+     3b2:	e8 59 01 00 00       	call   510 <futex>
+}
+     3b7:	83 c4 10             	add    $0x10,%esp
+     3ba:	c9                   	leave
+     3bb:	c3                   	ret
+     3bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003c0 <uptime>:
+// Clock ticks since boot, read from the kernel's vdso page
+// without a system call.
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     3c0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+     3c5:	c3                   	ret
+
+000003c6 <sysfork>:
+  1: ret
+
+#define SYSCALL(name) SYSCALLAS(name, name)
+
+// ulib.c wraps these.
+SYSCALLAS(sysfork, fork)
+     3c6:	b8 01 00 00 00       	mov    $0x1,%eax
+     3cb:	89 e1                	mov    %esp,%ecx
+     3cd:	ba d4 03 00 00       	mov    $0x3d4,%edx
+     3d2:	0f 34                	sysenter
+     3d4:	c3                   	ret
+
+000003d5 <sysexit>:
+SYSCALLAS(sysexit, exit)
+     3d5:	b8 02 00 00 00       	mov    $0x2,%eax
+     3da:	89 e1                	mov    %esp,%ecx
+     3dc:	ba e3 03 00 00       	mov    $0x3e3,%edx
+     3e1:	0f 34                	sysenter
+     3e3:	c3                   	ret
+
+000003e4 <wait>:
+SYSCALL(wait)
+     3e4:	b8 03 00 00 00       	mov    $0x3,%eax
+     3e9:	89 e1                	mov    %esp,%ecx
+     3eb:	ba f2 03 00 00       	mov    $0x3f2,%edx
+     3f0:	0f 34                	sysenter
+     3f2:	c3                   	ret
+
+000003f3 <pipe>:
+SYSCALL(pipe)
+     3f3:	b8 04 00 00 00       	mov    $0x4,%eax
+     3f8:	89 e1                	mov    %esp,%ecx
+     3fa:	ba 01 04 00 00       	mov    $0x401,%edx
+     3ff:	0f 34                	sysenter
+     401:	c3                   	ret
+
+00000402 <read>:
+SYSCALL(read)
+     402:	b8 05 00 00 00       	mov    $0x5,%eax
+     407:	89 e1                	mov    %esp,%ecx
+     409:	ba 10 04 00 00       	mov    $0x410,%edx
+     40e:	0f 34                	sysenter
+     410:	c3                   	ret
+
+00000411 <write>:
+SYSCALL(write)
+     411:	b8 10 00 00 00       	mov    $0x10,%eax
+     416:	89 e1                	mov    %esp,%ecx
+     418:	ba 1f 04 00 00       	mov    $0x41f,%edx
+     41d:	0f 34                	sysenter
+     41f:	c3                   	ret
+
+00000420 <close>:
+SYSCALL(close)
+     420:	b8 15 00 00 00       	mov    $0x15,%eax
+     425:	89 e1                	mov    %esp,%ecx
+     427:	ba 2e 04 00 00       	mov    $0x42e,%edx
+     42c:	0f 34                	sysenter
+     42e:	c3                   	ret
+
+0000042f <kill>:
+SYSCALL(kill)
+     42f:	b8 06 00 00 00       	mov    $0x6,%eax
+     434:	89 e1                	mov    %esp,%ecx
+     436:	ba 3d 04 00 00       	mov    $0x43d,%edx
+     43b:	0f 34                	sysenter
+     43d:	c3                   	ret
+
+0000043e <sysexec>:
+SYSCALLAS(sysexec, exec)
+     43e:	b8 07 00 00 00       	mov    $0x7,%eax
+     443:	89 e1                	mov    %esp,%ecx
+     445:	ba 4c 04 00 00       	mov    $0x44c,%edx
+     44a:	0f 34                	sysenter
+     44c:	c3                   	ret
+
+0000044d <open>:
+SYSCALL(open)
+     44d:	b8 0f 00 00 00       	mov    $0xf,%eax
+     452:	89 e1                	mov    %esp,%ecx
+     454:	ba 5b 04 00 00       	mov    $0x45b,%edx
+     459:	0f 34                	sysenter
+     45b:	c3                   	ret
+
+0000045c <mknod>:
+SYSCALL(mknod)
+     45c:	b8 11 00 00 00       	mov    $0x11,%eax
+     461:	89 e1                	mov    %esp,%ecx
+     463:	ba 6a 04 00 00       	mov    $0x46a,%edx
+     468:	0f 34                	sysenter
+     46a:	c3                   	ret
+
+0000046b <unlink>:
+SYSCALL(unlink)
+     46b:	b8 12 00 00 00       	mov    $0x12,%eax
+     470:	89 e1                	mov    %esp,%ecx
+     472:	ba 79 04 00 00       	mov    $0x479,%edx
+     477:	0f 34                	sysenter
+     479:	c3                   	ret
+
+0000047a <fstat>:
+SYSCALL(fstat)
+     47a:	b8 08 00 00 00       	mov    $0x8,%eax
+     47f:	89 e1                	mov    %esp,%ecx
+     481:	ba 88 04 00 00       	mov    $0x488,%edx
+     486:	0f 34                	sysenter
+     488:	c3                   	ret
+
+00000489 <link>:
+SYSCALL(link)
+     489:	b8 13 00 00 00       	mov    $0x13,%eax
+     48e:	89 e1                	mov    %esp,%ecx
+     490:	ba 97 04 00 00       	mov    $0x497,%edx
+     495:	0f 34                	sysenter
+     497:	c3                   	ret
+
+00000498 <mkdir>:
+SYSCALL(mkdir)
+     498:	b8 14 00 00 00       	mov    $0x14,%eax
+     49d:	89 e1                	mov    %esp,%ecx
+     49f:	ba a6 04 00 00       	mov    $0x4a6,%edx
+     4a4:	0f 34                	sysenter
+     4a6:	c3                   	ret
+
+000004a7 <chdir>:
+SYSCALL(chdir)
+     4a7:	b8 09 00 00 00       	mov    $0x9,%eax
+     4ac:	89 e1                	mov    %esp,%ecx
+     4ae:	ba b5 04 00 00       	mov    $0x4b5,%edx
+     4b3:	0f 34                	sysenter
+     4b5:	c3                   	ret
+
+000004b6 <dup>:
+SYSCALL(dup)
+     4b6:	b8 0a 00 00 00       	mov    $0xa,%eax
+     4bb:	89 e1                	mov    %esp,%ecx
+     4bd:	ba c4 04 00 00       	mov    $0x4c4,%edx
+     4c2:	0f 34                	sysenter
+     4c4:	c3                   	ret
+
+000004c5 <getpid>:
+SYSCALL(getpid)
+     4c5:	b8 0b 00 00 00       	mov    $0xb,%eax
+     4ca:	89 e1                	mov    %esp,%ecx
+     4cc:	ba d3 04 00 00       	mov    $0x4d3,%edx
+     4d1:	0f 34                	sysenter
+     4d3:	c3                   	ret
+
+000004d4 <sbrk>:
+SYSCALL(sbrk)
+     4d4:	b8 0c 00 00 00       	mov    $0xc,%eax
+     4d9:	89 e1                	mov    %esp,%ecx
+     4db:	ba e2 04 00 00       	mov    $0x4e2,%edx
+     4e0:	0f 34                	sysenter
+     4e2:	c3                   	ret
+
+000004e3 <sleep>:
+SYSCALL(sleep)
+     4e3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     4e8:	89 e1                	mov    %esp,%ecx
+     4ea:	ba f1 04 00 00       	mov    $0x4f1,%edx
+     4ef:	0f 34                	sysenter
+     4f1:	c3                   	ret
+
+000004f2 <clone>:
+SYSCALL(clone)
+     4f2:	b8 16 00 00 00       	mov    $0x16,%eax
+     4f7:	89 e1                	mov    %esp,%ecx
+     4f9:	ba 00 05 00 00       	mov    $0x500,%edx
+     4fe:	0f 34                	sysenter
+     500:	c3                   	ret
+
+00000501 <join>:
+SYSCALL(join)
+     501:	b8 17 00 00 00       	mov    $0x17,%eax
+     506:	89 e1                	mov    %esp,%ecx
+     508:	ba 0f 05 00 00       	mov    $0x50f,%edx
+     50d:	0f 34                	sysenter
+     50f:	c3                   	ret
+
+00000510 <futex>:
+SYSCALL(futex)
+     510:	b8 18 00 00 00       	mov    $0x18,%eax
+     515:	89 e1                	mov    %esp,%ecx
+     517:	ba 1e 05 00 00       	mov    $0x51e,%edx
+     51c:	0f 34                	sysenter
+     51e:	c3                   	ret
+
+0000051f <yield>:
+SYSCALL(yield)
+     51f:	b8 19 00 00 00       	mov    $0x19,%eax
+     524:	89 e1                	mov    %esp,%ecx
+     526:	ba 2d 05 00 00       	mov    $0x52d,%edx
+     52b:	0f 34                	sysenter
+     52d:	c3                   	ret
+
+0000052e <lockstat>:
+SYSCALL(lockstat)
+     52e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     533:	89 e1                	mov    %esp,%ecx
+     535:	ba 3c 05 00 00       	mov    $0x53c,%edx
+     53a:	0f 34                	sysenter
+     53c:	c3                   	ret
+
+0000053d <lockhammer>:
+SYSCALL(lockhammer)
+     53d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     542:	89 e1                	mov    %esp,%ecx
+     544:	ba 4b 05 00 00       	mov    $0x54b,%edx
+     549:	0f 34                	sysenter
+     54b:	c3                   	ret
+
+0000054c <vmsplice>:
+SYSCALL(vmsplice)
+     54c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     551:	89 e1                	mov    %esp,%ecx
+     553:	ba 5a 05 00 00       	mov    $0x55a,%edx
+     558:	0f 34                	sysenter
+     55a:	c3                   	ret
+
+0000055b <hsbrk>:
+SYSCALL(hsbrk)
+     55b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     560:	89 e1                	mov    %esp,%ecx
+     562:	ba 69 05 00 00       	mov    $0x569,%edx
+     567:	0f 34                	sysenter
+     569:	c3                   	ret
+
+0000056a <mmap>:
+SYSCALL(mmap)
+     56a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     56f:	89 e1                	mov    %esp,%ecx
+     571:	ba 78 05 00 00       	mov    $0x578,%edx
+     576:	0f 34                	sysenter
+     578:	c3                   	ret
+
+00000579 <munmap>:
+SYSCALL(munmap)
+     579:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     57e:	89 e1                	mov    %esp,%ecx
+     580:	ba 87 05 00 00       	mov    $0x587,%edx
+     585:	0f 34                	sysenter
+     587:	c3                   	ret
+
+00000588 <ringenter>:
+SYSCALL(ringenter)
+     588:	b8 20 00 00 00       	mov    $0x20,%eax
+     58d:	89 e1                	mov    %esp,%ecx
+     58f:	ba 96 05 00 00       	mov    $0x596,%edx
+     594:	0f 34                	sysenter
+     596:	c3                   	ret
+
+00000597 <readv>:
+SYSCALL(readv)
+     597:	b8 21 00 00 00       	mov    $0x21,%eax
+     59c:	89 e1                	mov    %esp,%ecx
+     59e:	ba a5 05 00 00       	mov    $0x5a5,%edx
+     5a3:	0f 34                	sysenter
+     5a5:	c3                   	ret
+
+000005a6 <writev>:
+SYSCALL(writev)
+     5a6:	b8 22 00 00 00       	mov    $0x22,%eax
+     5ab:	89 e1                	mov    %esp,%ecx
+     5ad:	ba b4 05 00 00       	mov    $0x5b4,%edx
+     5b2:	0f 34                	sysenter
+     5b4:	c3                   	ret
+
+000005b5 <pread>:
+SYSCALL(pread)
+     5b5:	b8 23 00 00 00       	mov    $0x23,%eax
+     5ba:	89 e1                	mov    %esp,%ecx
+     5bc:	ba c3 05 00 00       	mov    $0x5c3,%edx
+     5c1:	0f 34                	sysenter
+     5c3:	c3                   	ret
+
+000005c4 <pwrite>:
+SYSCALL(pwrite)
+     5c4:	b8 24 00 00 00       	mov    $0x24,%eax
+     5c9:	89 e1                	mov    %esp,%ecx
+     5cb:	ba d2 05 00 00       	mov    $0x5d2,%edx
+     5d0:	0f 34                	sysenter
+     5d2:	c3                   	ret
+
+000005d3 <prof>:
+SYSCALL(prof)
+     5d3:	b8 25 00 00 00       	mov    $0x25,%eax
+     5d8:	89 e1                	mov    %esp,%ecx
+     5da:	ba e1 05 00 00       	mov    $0x5e1,%edx
+     5df:	0f 34                	sysenter
+     5e1:	c3                   	ret
+
+000005e2 <scstat>:
+SYSCALL(scstat)
+     5e2:	b8 26 00 00 00       	mov    $0x26,%eax
+     5e7:	89 e1                	mov    %esp,%ecx
+     5e9:	ba f0 05 00 00       	mov    $0x5f0,%edx
+     5ee:	0f 34                	sysenter
+     5f0:	c3                   	ret
+     5f1:	66 90                	xchg   %ax,%ax
+     5f3:	66 90                	xchg   %ax,%ax
+     5f5:	66 90                	xchg   %ax,%ax
+     5f7:	66 90                	xchg   %ax,%ax
+     5f9:	66 90                	xchg   %ax,%ax
+     5fb:	66 90                	xchg   %ax,%ax
+     5fd:	66 90                	xchg   %ax,%ax
+     5ff:	90                   	nop
+
+00000600 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+     600:	55                   	push   %ebp
+     601:	89 e5                	mov    %esp,%ebp
+     603:	57                   	push   %edi
+     604:	56                   	push   %esi
+     605:	53                   	push   %ebx
+     606:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     608:	89 d1                	mov    %edx,%ecx
+{
+     60a:	83 ec 2c             	sub    $0x2c,%esp
+     60d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+     610:	85 d2                	test   %edx,%edx
+     612:	79 7c                	jns    690 <printint+0x90>
+     614:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     618:	74 76                	je     690 <printint+0x90>
+    x = -xx;
+     61a:	f7 d9                	neg    %ecx
+    neg = 1;
+     61c:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     621:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     624:	31 f6                	xor    %esi,%esi
+     626:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     62d:	8d 76 00             	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     630:	89 c8                	mov    %ecx,%eax
+     632:	31 d2                	xor    %edx,%edx
+     634:	89 f7                	mov    %esi,%edi
+     636:	f7 f3                	div    %ebx
+     638:	8d 76 01             	lea    0x1(%esi),%esi
+     63b:	0f b6 92 38 1d 00 00 	movzbl 0x1d38(%edx),%edx
+     642:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     646:	89 ca                	mov    %ecx,%edx
+     648:	89 c1                	mov    %eax,%ecx
+     64a:	39 da                	cmp    %ebx,%edx
+     64c:	73 e2                	jae    630 <printint+0x30>
+  if(neg)
+     64e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     651:	85 c0                	test   %eax,%eax
+     653:	74 07                	je     65c <printint+0x5c>
+    buf[i++] = '-';
+     655:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     65a:	89 f7                	mov    %esi,%edi
+     65c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     65f:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     662:	01 df                	add    %ebx,%edi
+     664:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc_unlocked(buf[i], f);
+     668:	83 ec 08             	sub    $0x8,%esp
+     66b:	56                   	push   %esi
+     66c:	0f be 07             	movsbl (%edi),%eax
+     66f:	50                   	push   %eax
+     670:	e8 cb 07 00 00       	call   e40 <putc_unlocked>
+  while(--i >= 0)
+     675:	89 f8                	mov    %edi,%eax
+     677:	83 c4 10             	add    $0x10,%esp
+     67a:	83 ef 01             	sub    $0x1,%edi
+     67d:	39 d8                	cmp    %ebx,%eax
+     67f:	75 e7                	jne    668 <printint+0x68>
+}
+     681:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     684:	5b                   	pop    %ebx
+     685:	5e                   	pop    %esi
+     686:	5f                   	pop    %edi
+     687:	5d                   	pop    %ebp
+     688:	c3                   	ret
+     689:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     690:	31 c0                	xor    %eax,%eax
+     692:	eb 8d                	jmp    621 <printint+0x21>
+     694:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     69b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     69f:	90                   	nop
+
+000006a0 <vfprintf>:
+
+// Print to the given stream, which the caller has locked.
+// Only understands %d, %x, %p, %s.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+     6a0:	55                   	push   %ebp
+     6a1:	89 e5                	mov    %esp,%ebp
+     6a3:	57                   	push   %edi
+     6a4:	56                   	push   %esi
+     6a5:	53                   	push   %ebx
+     6a6:	83 ec 1c             	sub    $0x1c,%esp
+     6a9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     6ac:	0f b6 0a             	movzbl (%edx),%ecx
+     6af:	84 c9                	test   %cl,%cl
+     6b1:	74 5c                	je     70f <vfprintf+0x6f>
+     6b3:	89 c6                	mov    %eax,%esi
+     6b5:	8d 5a 01             	lea    0x1(%edx),%ebx
+     6b8:	31 ff                	xor    %edi,%edi
+     6ba:	eb 20                	jmp    6dc <vfprintf+0x3c>
+     6bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     6c0:	83 f9 25             	cmp    $0x25,%ecx
+     6c3:	74 3b                	je     700 <vfprintf+0x60>
+        state = '%';
+      } else {
+        putc_unlocked(c, f);
+     6c5:	83 ec 08             	sub    $0x8,%esp
+     6c8:	56                   	push   %esi
+     6c9:	51                   	push   %ecx
+     6ca:	e8 71 07 00 00       	call   e40 <putc_unlocked>
+     6cf:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     6d2:	0f b6 0b             	movzbl (%ebx),%ecx
+     6d5:	83 c3 01             	add    $0x1,%ebx
+     6d8:	84 c9                	test   %cl,%cl
+     6da:	74 33                	je     70f <vfprintf+0x6f>
+    if(state == 0){
+     6dc:	85 ff                	test   %edi,%edi
+     6de:	74 e0                	je     6c0 <vfprintf+0x20>
+      }
+    } else if(state == '%'){
+     6e0:	83 ff 25             	cmp    $0x25,%edi
+     6e3:	75 ed                	jne    6d2 <vfprintf+0x32>
+      if(c == 'd'){
+     6e5:	83 f9 25             	cmp    $0x25,%ecx
+     6e8:	0f 84 02 01 00 00    	je     7f0 <vfprintf+0x150>
+     6ee:	8d 41 9d             	lea    -0x63(%ecx),%eax
+     6f1:	83 f8 15             	cmp    $0x15,%eax
+     6f4:	77 2a                	ja     720 <vfprintf+0x80>
+     6f6:	ff 24 85 e0 1c 00 00 	jmp    *0x1ce0(,%eax,4)
+     6fd:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; fmt[i]; i++){
+     700:	0f b6 0b             	movzbl (%ebx),%ecx
+     703:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     706:	bf 25 00 00 00       	mov    $0x25,%edi
+  for(i = 0; fmt[i]; i++){
+     70b:	84 c9                	test   %cl,%cl
+     70d:	75 cd                	jne    6dc <vfprintf+0x3c>
+        putc_unlocked(c, f);
+      }
+      state = 0;
+    }
+  }
+}
+     70f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     712:	5b                   	pop    %ebx
+     713:	5e                   	pop    %esi
+     714:	5f                   	pop    %edi
+     715:	5d                   	pop    %ebp
+     716:	c3                   	ret
+     717:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     71e:	66 90                	xchg   %ax,%ax
+        putc_unlocked('%', f);
+     720:	83 ec 08             	sub    $0x8,%esp
+     723:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     726:	56                   	push   %esi
+     727:	6a 25                	push   $0x25
+     729:	e8 12 07 00 00       	call   e40 <putc_unlocked>
+        putc_unlocked(c, f);
+     72e:	58                   	pop    %eax
+     72f:	5a                   	pop    %edx
+     730:	56                   	push   %esi
+     731:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     734:	51                   	push   %ecx
+     735:	e8 06 07 00 00       	call   e40 <putc_unlocked>
+     73a:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     73d:	31 ff                	xor    %edi,%edi
+     73f:	eb 91                	jmp    6d2 <vfprintf+0x32>
+     741:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+     748:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     74b:	83 ec 0c             	sub    $0xc,%esp
+     74e:	b9 10 00 00 00       	mov    $0x10,%ecx
+     753:	8b 17                	mov    (%edi),%edx
+     755:	6a 00                	push   $0x0
+        ap++;
+     757:	83 c7 04             	add    $0x4,%edi
+        printint(f, *ap, 16, 0);
+     75a:	89 f0                	mov    %esi,%eax
+     75c:	e8 9f fe ff ff       	call   600 <printint>
+        ap++;
+     761:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     764:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     767:	31 ff                	xor    %edi,%edi
+     769:	e9 64 ff ff ff       	jmp    6d2 <vfprintf+0x32>
+     76e:	66 90                	xchg   %ax,%ax
+        s = (char*)*ap;
+     770:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     773:	8b 10                	mov    (%eax),%edx
+        ap++;
+     775:	83 c0 04             	add    $0x4,%eax
+     778:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     77b:	85 d2                	test   %edx,%edx
+     77d:	0f 84 85 00 00 00    	je     808 <vfprintf+0x168>
+        while(*s != 0){
+     783:	0f be 02             	movsbl (%edx),%eax
+        s = (char*)*ap;
+     786:	89 d7                	mov    %edx,%edi
+        while(*s != 0){
+     788:	84 c0                	test   %al,%al
+     78a:	74 b1                	je     73d <vfprintf+0x9d>
+     78c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+          putc_unlocked(*s, f);
+     790:	83 ec 08             	sub    $0x8,%esp
+          s++;
+     793:	83 c7 01             	add    $0x1,%edi
+          putc_unlocked(*s, f);
+     796:	56                   	push   %esi
+     797:	50                   	push   %eax
+     798:	e8 a3 06 00 00       	call   e40 <putc_unlocked>
+        while(*s != 0){
+     79d:	0f be 07             	movsbl (%edi),%eax
+     7a0:	83 c4 10             	add    $0x10,%esp
+     7a3:	84 c0                	test   %al,%al
+     7a5:	75 e9                	jne    790 <vfprintf+0xf0>
+      state = 0;
+     7a7:	31 ff                	xor    %edi,%edi
+     7a9:	e9 24 ff ff ff       	jmp    6d2 <vfprintf+0x32>
+     7ae:	66 90                	xchg   %ax,%ax
+        printint(f, *ap, 10, 1);
+     7b0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     7b3:	83 ec 0c             	sub    $0xc,%esp
+     7b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     7bb:	8b 17                	mov    (%edi),%edx
+     7bd:	6a 01                	push   $0x1
+     7bf:	eb 96                	jmp    757 <vfprintf+0xb7>
+     7c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc_unlocked(*ap, f);
+     7c8:	83 ec 08             	sub    $0x8,%esp
+     7cb:	56                   	push   %esi
+     7cc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     7cf:	ff 37                	push   (%edi)
+     7d1:	e8 6a 06 00 00       	call   e40 <putc_unlocked>
+        ap++;
+     7d6:	89 f8                	mov    %edi,%eax
+     7d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     7db:	31 ff                	xor    %edi,%edi
+        ap++;
+     7dd:	83 c0 04             	add    $0x4,%eax
+     7e0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     7e3:	e9 ea fe ff ff       	jmp    6d2 <vfprintf+0x32>
+     7e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ef:	90                   	nop
+        putc_unlocked(c, f);
+     7f0:	83 ec 08             	sub    $0x8,%esp
+      state = 0;
+     7f3:	31 ff                	xor    %edi,%edi
+        putc_unlocked(c, f);
+     7f5:	56                   	push   %esi
+     7f6:	6a 25                	push   $0x25
+     7f8:	e8 43 06 00 00       	call   e40 <putc_unlocked>
+     7fd:	83 c4 10             	add    $0x10,%esp
+     800:	e9 cd fe ff ff       	jmp    6d2 <vfprintf+0x32>
+     805:	8d 76 00             	lea    0x0(%esi),%esi
+     808:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     80d:	bf d8 1c 00 00       	mov    $0x1cd8,%edi
+     812:	e9 79 ff ff ff       	jmp    790 <vfprintf+0xf0>
+     817:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     81e:	66 90                	xchg   %ax,%ax
+
+00000820 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+     820:	55                   	push   %ebp
+     821:	89 e5                	mov    %esp,%ebp
+     823:	53                   	push   %ebx
+     824:	83 ec 10             	sub    $0x10,%esp
+     827:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  flockfile(f);
+     82a:	53                   	push   %ebx
+     82b:	e8 d0 02 00 00       	call   b00 <flockfile>
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     830:	8b 55 0c             	mov    0xc(%ebp),%edx
+     833:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     836:	89 d8                	mov    %ebx,%eax
+     838:	e8 63 fe ff ff       	call   6a0 <vfprintf>
+  funlockfile(f);
+     83d:	89 1c 24             	mov    %ebx,(%esp)
+     840:	e8 eb 02 00 00       	call   b30 <funlockfile>
+}
+     845:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     848:	83 c4 10             	add    $0x10,%esp
+     84b:	c9                   	leave
+     84c:	c3                   	ret
+     84d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000850 <printf>:
+
+// Print to the given fd: through stdout or stderr for 1 and 2,
+// otherwise with one write() per call.
+void
+printf(int fd, const char *fmt, ...)
+{
+     850:	55                   	push   %ebp
+     851:	89 e5                	mov    %esp,%ebp
+     853:	56                   	push   %esi
+     854:	53                   	push   %ebx
+     855:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+     85b:	8b 45 08             	mov    0x8(%ebp),%eax
+  char buf[128];
+  struct iobuf f;
+
+  if(fd == 1 || fd == 2){
+    flockfile(&_iob[fd]);
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     85e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(fd == 1 || fd == 2){
+     861:	8d 50 ff             	lea    -0x1(%eax),%edx
+     864:	83 fa 01             	cmp    $0x1,%edx
+     867:	76 77                	jbe    8e0 <printf+0x90>
+    funlockfile(&_iob[fd]);
+    return;
+  }
+  f.fd = fd;
+     869:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  f.flags = IO_WRITE|IO_SETUP;
+  f.buf = buf;
+     86f:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  f.size = sizeof(buf);
+  f.r = f.n = 0;
+  mutex_init(&f.lock);
+     875:	83 ec 0c             	sub    $0xc,%esp
+     878:	8d 9d 5c ff ff ff    	lea    -0xa4(%ebp),%ebx
+  f.buf = buf;
+     87e:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+  mutex_init(&f.lock);
+     884:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  f.flags = IO_WRITE|IO_SETUP;
+     88a:	c7 85 60 ff ff ff 42 	movl   $0x42,-0xa0(%ebp)
+     891:	00 00 00 
+  f.size = sizeof(buf);
+     894:	c7 85 68 ff ff ff 80 	movl   $0x80,-0x98(%ebp)
+     89b:	00 00 00 
+  f.r = f.n = 0;
+     89e:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+     8a5:	00 00 00 
+     8a8:	c7 85 6c ff ff ff 00 	movl   $0x0,-0x94(%ebp)
+     8af:	00 00 00 
+  mutex_init(&f.lock);
+     8b2:	50                   	push   %eax
+     8b3:	e8 d8 f9 ff ff       	call   290 <mutex_init>
+  vfprintf(&f, fmt, (uint*)(void*)&fmt + 1);
+     8b8:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     8bb:	89 f2                	mov    %esi,%edx
+     8bd:	89 d8                	mov    %ebx,%eax
+     8bf:	e8 dc fd ff ff       	call   6a0 <vfprintf>
+  fflush(&f);
+     8c4:	89 1c 24             	mov    %ebx,(%esp)
+     8c7:	e8 f4 04 00 00       	call   dc0 <fflush>
+     8cc:	83 c4 10             	add    $0x10,%esp
+}
+     8cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     8d2:	5b                   	pop    %ebx
+     8d3:	5e                   	pop    %esi
+     8d4:	5d                   	pop    %ebp
+     8d5:	c3                   	ret
+     8d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8dd:	8d 76 00             	lea    0x0(%esi),%esi
+    flockfile(&_iob[fd]);
+     8e0:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     8e3:	83 ec 0c             	sub    $0xc,%esp
+     8e6:	8d 98 a0 26 00 00    	lea    0x26a0(%eax),%ebx
+     8ec:	53                   	push   %ebx
+     8ed:	e8 0e 02 00 00       	call   b00 <flockfile>
+    vfprintf(&_iob[fd], fmt, (uint*)(void*)&fmt + 1);
+     8f2:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     8f5:	89 f2                	mov    %esi,%edx
+     8f7:	89 d8                	mov    %ebx,%eax
+     8f9:	e8 a2 fd ff ff       	call   6a0 <vfprintf>
+    funlockfile(&_iob[fd]);
+     8fe:	89 1c 24             	mov    %ebx,(%esp)
+     901:	e8 2a 02 00 00       	call   b30 <funlockfile>
+     906:	83 c4 10             	add    $0x10,%esp
+}
+     909:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     90c:	5b                   	pop    %ebx
+     90d:	5e                   	pop    %esi
+     90e:	5d                   	pop    %ebp
+     90f:	c3                   	ret
+
+00000910 <setup>:
+}
+
+// Choose how to buffer f on first use: by lines on a device.
+static void
+setup(FILE *f)
+{
+     910:	55                   	push   %ebp
+     911:	89 e5                	mov    %esp,%ebp
+     913:	53                   	push   %ebx
+     914:	89 c3                	mov    %eax,%ebx
+     916:	83 ec 2c             	sub    $0x2c,%esp
+  struct stat st;
+
+  f->flags |= IO_SETUP;
+     919:	83 48 04 40          	orl    $0x40,0x4(%eax)
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     91d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     920:	50                   	push   %eax
+     921:	ff 33                	push   (%ebx)
+     923:	e8 52 fb ff ff       	call   47a <fstat>
+     928:	83 c4 10             	add    $0x10,%esp
+     92b:	85 c0                	test   %eax,%eax
+    f->flags |= IO_DEV|IO_LINE;
+     92d:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(fstat(f->fd, &st) == 0 && st.type == T_DEV)
+     930:	75 07                	jne    939 <setup+0x29>
+     932:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+     937:	74 17                	je     950 <setup+0x40>
+  if(f->flags & IO_WRITE)
+     939:	a8 02                	test   $0x2,%al
+     93b:	74 0a                	je     947 <setup+0x37>
+    flushhook = flushall;
+     93d:	c7 05 80 27 00 00 70 	movl   $0xa70,0x2780
+     944:	0a 00 00 
+}
+     947:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     94a:	c9                   	leave
+     94b:	c3                   	ret
+     94c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    f->flags |= IO_DEV|IO_LINE;
+     950:	83 c8 30             	or     $0x30,%eax
+     953:	89 43 04             	mov    %eax,0x4(%ebx)
+     956:	eb e1                	jmp    939 <setup+0x29>
+     958:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     95f:	90                   	nop
+
+00000960 <flush>:
+static int
+flush(FILE *f)
+{
+  int i, n;
+
+  if(!(f->flags & IO_WRITE))
+     960:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+     964:	74 6a                	je     9d0 <flush+0x70>
+{
+     966:	55                   	push   %ebp
+     967:	89 e5                	mov    %esp,%ebp
+     969:	56                   	push   %esi
+     96a:	89 c6                	mov    %eax,%esi
+     96c:	53                   	push   %ebx
+    return 0;
+  for(i = 0; i < f->n; i += n){
+     96d:	8b 40 14             	mov    0x14(%eax),%eax
+     970:	85 c0                	test   %eax,%eax
+     972:	7e 4c                	jle    9c0 <flush+0x60>
+     974:	31 db                	xor    %ebx,%ebx
+     976:	eb 11                	jmp    989 <flush+0x29>
+     978:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     97f:	90                   	nop
+     980:	01 c3                	add    %eax,%ebx
+     982:	8b 46 14             	mov    0x14(%esi),%eax
+     985:	39 d8                	cmp    %ebx,%eax
+     987:	7e 37                	jle    9c0 <flush+0x60>
+    if((n = write(f->fd, f->buf + i, f->n - i)) <= 0){
+     989:	83 ec 04             	sub    $0x4,%esp
+     98c:	29 d8                	sub    %ebx,%eax
+     98e:	50                   	push   %eax
+     98f:	8b 46 08             	mov    0x8(%esi),%eax
+     992:	01 d8                	add    %ebx,%eax
+     994:	50                   	push   %eax
+     995:	ff 36                	push   (%esi)
+     997:	e8 75 fa ff ff       	call   411 <write>
+     99c:	83 c4 10             	add    $0x10,%esp
+     99f:	85 c0                	test   %eax,%eax
+     9a1:	7f dd                	jg     980 <flush+0x20>
+      f->flags |= IO_ERR;
+     9a3:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+      f->n = 0;
+     9a7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     9ac:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+      return EOF;
+    }
+  }
+  f->n = 0;
+  return 0;
+}
+     9b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     9b6:	5b                   	pop    %ebx
+     9b7:	5e                   	pop    %esi
+     9b8:	5d                   	pop    %ebp
+     9b9:	c3                   	ret
+     9ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->n = 0;
+     9c0:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+}
+     9c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+     9ca:	31 c0                	xor    %eax,%eax
+}
+     9cc:	5b                   	pop    %ebx
+     9cd:	5e                   	pop    %esi
+     9ce:	5d                   	pop    %ebp
+     9cf:	c3                   	ret
+    return 0;
+     9d0:	31 c0                	xor    %eax,%eax
+}
+     9d2:	c3                   	ret
+     9d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000009e0 <fflush.part.0>:
+fflush(FILE *f)
+     9e0:	55                   	push   %ebp
+     9e1:	89 e5                	mov    %esp,%ebp
+     9e3:	57                   	push   %edi
+     9e4:	bf 98 27 00 00       	mov    $0x2798,%edi
+     9e9:	56                   	push   %esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     9ea:	31 f6                	xor    %esi,%esi
+fflush(FILE *f)
+     9ec:	53                   	push   %ebx
+     9ed:	bb b8 26 00 00       	mov    $0x26b8,%ebx
+     9f2:	83 ec 1c             	sub    $0x1c,%esp
+     9f5:	eb 10                	jmp    a07 <fflush.part.0+0x27>
+     9f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9fe:	66 90                	xchg   %ax,%ax
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     a00:	83 c3 1c             	add    $0x1c,%ebx
+     a03:	39 df                	cmp    %ebx,%edi
+     a05:	74 33                	je     a3a <fflush.part.0+0x5a>
+      if((f->flags & IO_WRITE) && fflush(f) < 0)
+     a07:	f6 43 ec 02          	testb  $0x2,-0x14(%ebx)
+     a0b:	74 f3                	je     a00 <fflush.part.0+0x20>
+  if(threaded)
+     a0d:	8b 0d a0 27 00 00    	mov    0x27a0,%ecx
+     a13:	85 c9                	test   %ecx,%ecx
+     a15:	75 49                	jne    a60 <fflush.part.0+0x80>
+  r = flush(f);
+     a17:	8d 43 e8             	lea    -0x18(%ebx),%eax
+     a1a:	e8 41 ff ff ff       	call   960 <flush>
+  if(threaded)
+     a1f:	8b 15 a0 27 00 00    	mov    0x27a0,%edx
+     a25:	85 d2                	test   %edx,%edx
+     a27:	75 1f                	jne    a48 <fflush.part.0+0x68>
+        r = EOF;
+     a29:	85 c0                	test   %eax,%eax
+     a2b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     a30:	0f 48 f0             	cmovs  %eax,%esi
+    for(r = 0, f = _iob; f < &_iob[NSTREAM]; f++)
+     a33:	83 c3 1c             	add    $0x1c,%ebx
+     a36:	39 df                	cmp    %ebx,%edi
+     a38:	75 cd                	jne    a07 <fflush.part.0+0x27>
+}
+     a3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a3d:	89 f0                	mov    %esi,%eax
+     a3f:	5b                   	pop    %ebx
+     a40:	5e                   	pop    %esi
+     a41:	5f                   	pop    %edi
+     a42:	5d                   	pop    %ebp
+     a43:	c3                   	ret
+     a44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     a48:	83 ec 0c             	sub    $0xc,%esp
+     a4b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     a4e:	53                   	push   %ebx
+     a4f:	e8 9c f8 ff ff       	call   2f0 <mutex_unlock>
+     a54:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     a57:	83 c4 10             	add    $0x10,%esp
+     a5a:	eb cd                	jmp    a29 <fflush.part.0+0x49>
+     a5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     a60:	83 ec 0c             	sub    $0xc,%esp
+     a63:	53                   	push   %ebx
+     a64:	e8 37 f8 ff ff       	call   2a0 <mutex_lock>
+     a69:	83 c4 10             	add    $0x10,%esp
+     a6c:	eb a9                	jmp    a17 <fflush.part.0+0x37>
+     a6e:	66 90                	xchg   %ax,%ax
+
+00000a70 <flushall>:
+  if(f == 0){
+     a70:	e9 6b ff ff ff       	jmp    9e0 <fflush.part.0>
+     a75:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a80 <fill>:
+
+// Refill f's buffer. Returns the number of bytes read.
+// Caller holds f's lock.
+static int
+fill(FILE *f)
+{
+     a80:	55                   	push   %ebp
+     a81:	89 e5                	mov    %esp,%ebp
+     a83:	53                   	push   %ebx
+     a84:	89 c3                	mov    %eax,%ebx
+     a86:	83 ec 04             	sub    $0x4,%esp
+  int n;
+
+  if(!(f->flags & IO_SETUP))
+     a89:	8b 40 04             	mov    0x4(%eax),%eax
+     a8c:	a8 40                	test   $0x40,%al
+     a8e:	74 50                	je     ae0 <fill+0x60>
+    setup(f);
+  if(f->flags & IO_DEV)
+     a90:	a8 20                	test   $0x20,%al
+     a92:	75 3c                	jne    ad0 <fill+0x50>
+    fflush(0);
+  f->r = 0;
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     a94:	83 ec 04             	sub    $0x4,%esp
+  f->r = 0;
+     a97:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  if((n = read(f->fd, f->buf, f->size)) <= 0){
+     a9e:	ff 73 0c             	push   0xc(%ebx)
+     aa1:	ff 73 08             	push   0x8(%ebx)
+     aa4:	ff 33                	push   (%ebx)
+     aa6:	e8 57 f9 ff ff       	call   402 <read>
+     aab:	83 c4 10             	add    $0x10,%esp
+     aae:	85 c0                	test   %eax,%eax
+     ab0:	7f 10                	jg     ac2 <fill+0x42>
+    f->flags |= n < 0 ? IO_ERR : IO_EOF;
+     ab2:	83 f8 01             	cmp    $0x1,%eax
+     ab5:	19 c0                	sbb    %eax,%eax
+     ab7:	83 e0 fc             	and    $0xfffffffc,%eax
+     aba:	83 c0 08             	add    $0x8,%eax
+     abd:	09 43 04             	or     %eax,0x4(%ebx)
+    n = 0;
+     ac0:	31 c0                	xor    %eax,%eax
+  }
+  f->n = n;
+     ac2:	89 43 14             	mov    %eax,0x14(%ebx)
+  return n;
+}
+     ac5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ac8:	c9                   	leave
+     ac9:	c3                   	ret
+     aca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == 0){
+     ad0:	e8 0b ff ff ff       	call   9e0 <fflush.part.0>
+     ad5:	eb bd                	jmp    a94 <fill+0x14>
+     ad7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ade:	66 90                	xchg   %ax,%ax
+    setup(f);
+     ae0:	89 d8                	mov    %ebx,%eax
+     ae2:	e8 29 fe ff ff       	call   910 <setup>
+  if(f->flags & IO_DEV)
+     ae7:	8b 43 04             	mov    0x4(%ebx),%eax
+     aea:	eb a4                	jmp    a90 <fill+0x10>
+     aec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000af0 <stdio_threaded>:
+  threaded = 1;
+     af0:	c7 05 a0 27 00 00 01 	movl   $0x1,0x27a0
+     af7:	00 00 00 
+}
+     afa:	c3                   	ret
+     afb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     aff:	90                   	nop
+
+00000b00 <flockfile>:
+{
+     b00:	55                   	push   %ebp
+  if(threaded)
+     b01:	8b 15 a0 27 00 00    	mov    0x27a0,%edx
+{
+     b07:	89 e5                	mov    %esp,%ebp
+     b09:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     b0c:	85 d2                	test   %edx,%edx
+     b0e:	75 08                	jne    b18 <flockfile+0x18>
+}
+     b10:	5d                   	pop    %ebp
+     b11:	c3                   	ret
+     b12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_lock(&f->lock);
+     b18:	83 c0 18             	add    $0x18,%eax
+     b1b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     b1e:	5d                   	pop    %ebp
+    mutex_lock(&f->lock);
+     b1f:	e9 7c f7 ff ff       	jmp    2a0 <mutex_lock>
+     b24:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b2f:	90                   	nop
+
+00000b30 <funlockfile>:
+{
+     b30:	55                   	push   %ebp
+  if(threaded)
+     b31:	8b 15 a0 27 00 00    	mov    0x27a0,%edx
+{
+     b37:	89 e5                	mov    %esp,%ebp
+     b39:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(threaded)
+     b3c:	85 d2                	test   %edx,%edx
+     b3e:	75 08                	jne    b48 <funlockfile+0x18>
+}
+     b40:	5d                   	pop    %ebp
+     b41:	c3                   	ret
+     b42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&f->lock);
+     b48:	83 c0 18             	add    $0x18,%eax
+     b4b:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     b4e:	5d                   	pop    %ebp
+    mutex_unlock(&f->lock);
+     b4f:	e9 9c f7 ff ff       	jmp    2f0 <mutex_unlock>
+     b54:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b5f:	90                   	nop
+
+00000b60 <fopen>:
+{
+     b60:	55                   	push   %ebp
+     b61:	89 e5                	mov    %esp,%ebp
+     b63:	57                   	push   %edi
+     b64:	56                   	push   %esi
+     b65:	53                   	push   %ebx
+     b66:	83 ec 34             	sub    $0x34,%esp
+     b69:	8b 75 0c             	mov    0xc(%ebp),%esi
+     b6c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(strcmp(mode, "r") != 0 && strcmp(mode, "w") != 0)
+     b6f:	68 49 1d 00 00       	push   $0x1d49
+     b74:	56                   	push   %esi
+     b75:	e8 66 f5 ff ff       	call   e0 <strcmp>
+     b7a:	83 c4 10             	add    $0x10,%esp
+     b7d:	85 c0                	test   %eax,%eax
+     b7f:	74 15                	je     b96 <fopen+0x36>
+     b81:	83 ec 08             	sub    $0x8,%esp
+     b84:	68 4b 1d 00 00       	push   $0x1d4b
+     b89:	56                   	push   %esi
+     b8a:	e8 51 f5 ff ff       	call   e0 <strcmp>
+     b8f:	83 c4 10             	add    $0x10,%esp
+     b92:	85 c0                	test   %eax,%eax
+     b94:	75 2c                	jne    bc2 <fopen+0x62>
+  if(threaded)
+     b96:	a1 a0 27 00 00       	mov    0x27a0,%eax
+     b9b:	85 c0                	test   %eax,%eax
+     b9d:	0f 85 ed 00 00 00    	jne    c90 <fopen+0x130>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     ba3:	bb f4 26 00 00       	mov    $0x26f4,%ebx
+    if(f->flags == 0)
+     ba8:	8b 53 04             	mov    0x4(%ebx),%edx
+     bab:	85 d2                	test   %edx,%edx
+     bad:	74 21                	je     bd0 <fopen+0x70>
+  for(f = &_iob[3]; f < &_iob[NSTREAM]; f++)
+     baf:	83 c3 1c             	add    $0x1c,%ebx
+     bb2:	81 fb 80 27 00 00    	cmp    $0x2780,%ebx
+     bb8:	75 ee                	jne    ba8 <fopen+0x48>
+  if(threaded)
+     bba:	85 c0                	test   %eax,%eax
+     bbc:	0f 85 36 01 00 00    	jne    cf8 <fopen+0x198>
+    return 0;
+     bc2:	31 db                	xor    %ebx,%ebx
+     bc4:	e9 96 00 00 00       	jmp    c5f <fopen+0xff>
+     bc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f == &_iob[NSTREAM])
+     bd0:	81 fb 80 27 00 00    	cmp    $0x2780,%ebx
+     bd6:	74 e2                	je     bba <fopen+0x5a>
+    f->flags = IO_MALLOC;
+     bd8:	c7 43 04 80 00 00 00 	movl   $0x80,0x4(%ebx)
+  if(threaded)
+     bdf:	85 c0                	test   %eax,%eax
+     be1:	0f 85 f9 00 00 00    	jne    ce0 <fopen+0x180>
+  if(mode[0] == 'r'){
+     be7:	80 3e 72             	cmpb   $0x72,(%esi)
+     bea:	0f 84 c0 00 00 00    	je     cb0 <fopen+0x150>
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     bf0:	83 ec 08             	sub    $0x8,%esp
+     bf3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     bf6:	50                   	push   %eax
+     bf7:	57                   	push   %edi
+     bf8:	e8 d3 f5 ff ff       	call   1d0 <stat>
+     bfd:	83 c4 10             	add    $0x10,%esp
+     c00:	85 c0                	test   %eax,%eax
+     c02:	74 6c                	je     c70 <fopen+0x110>
+    fd = open(path, O_CREATE|O_WRONLY);
+     c04:	83 ec 08             	sub    $0x8,%esp
+     c07:	68 01 02 00 00       	push   $0x201
+     c0c:	57                   	push   %edi
+    flags = IO_WRITE;
+     c0d:	bf 02 00 00 00       	mov    $0x2,%edi
+    fd = open(path, O_CREATE|O_WRONLY);
+     c12:	e8 36 f8 ff ff       	call   44d <open>
+     c17:	83 c4 10             	add    $0x10,%esp
+     c1a:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     c1c:	85 f6                	test   %esi,%esi
+     c1e:	0f 88 a9 00 00 00    	js     ccd <fopen+0x16d>
+     c24:	83 ec 0c             	sub    $0xc,%esp
+     c27:	68 00 02 00 00       	push   $0x200
+     c2c:	e8 af 0c 00 00       	call   18e0 <malloc>
+     c31:	83 c4 10             	add    $0x10,%esp
+     c34:	89 43 08             	mov    %eax,0x8(%ebx)
+     c37:	85 c0                	test   %eax,%eax
+     c39:	0f 84 d0 00 00 00    	je     d0f <fopen+0x1af>
+  f->flags = flags|IO_MALLOC;
+     c3f:	81 cf 80 00 00 00    	or     $0x80,%edi
+  f->fd = fd;
+     c45:	89 33                	mov    %esi,(%ebx)
+  f->size = BUFSIZ;
+     c47:	c7 43 0c 00 02 00 00 	movl   $0x200,0xc(%ebx)
+  f->r = f->n = 0;
+     c4e:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+     c55:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  f->flags = flags|IO_MALLOC;
+     c5c:	89 7b 04             	mov    %edi,0x4(%ebx)
+}
+     c5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c62:	89 d8                	mov    %ebx,%eax
+     c64:	5b                   	pop    %ebx
+     c65:	5e                   	pop    %esi
+     c66:	5f                   	pop    %edi
+     c67:	5d                   	pop    %ebp
+     c68:	c3                   	ret
+     c69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(stat(path, &st) == 0 && st.type == T_FILE)
+     c70:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+     c75:	75 8d                	jne    c04 <fopen+0xa4>
+      unlink(path);
+     c77:	83 ec 0c             	sub    $0xc,%esp
+     c7a:	57                   	push   %edi
+     c7b:	e8 eb f7 ff ff       	call   46b <unlink>
+     c80:	83 c4 10             	add    $0x10,%esp
+     c83:	e9 7c ff ff ff       	jmp    c04 <fopen+0xa4>
+     c88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c8f:	90                   	nop
+    mutex_lock(&iolock);
+     c90:	83 ec 0c             	sub    $0xc,%esp
+     c93:	68 a4 27 00 00       	push   $0x27a4
+     c98:	e8 03 f6 ff ff       	call   2a0 <mutex_lock>
+  if(threaded)
+     c9d:	a1 a0 27 00 00       	mov    0x27a0,%eax
+     ca2:	83 c4 10             	add    $0x10,%esp
+     ca5:	e9 f9 fe ff ff       	jmp    ba3 <fopen+0x43>
+     caa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    fd = open(path, O_RDONLY);
+     cb0:	83 ec 08             	sub    $0x8,%esp
+     cb3:	6a 00                	push   $0x0
+     cb5:	57                   	push   %edi
+    flags = IO_READ;
+     cb6:	bf 01 00 00 00       	mov    $0x1,%edi
+    fd = open(path, O_RDONLY);
+     cbb:	e8 8d f7 ff ff       	call   44d <open>
+     cc0:	83 c4 10             	add    $0x10,%esp
+     cc3:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || (f->buf = malloc(BUFSIZ)) == 0){
+     cc5:	85 f6                	test   %esi,%esi
+     cc7:	0f 89 57 ff ff ff    	jns    c24 <fopen+0xc4>
+    f->flags = 0;
+     ccd:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    return 0;
+     cd4:	31 db                	xor    %ebx,%ebx
+     cd6:	eb 87                	jmp    c5f <fopen+0xff>
+     cd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cdf:	90                   	nop
+    mutex_unlock(&iolock);
+     ce0:	83 ec 0c             	sub    $0xc,%esp
+     ce3:	68 a4 27 00 00       	push   $0x27a4
+     ce8:	e8 03 f6 ff ff       	call   2f0 <mutex_unlock>
+     ced:	83 c4 10             	add    $0x10,%esp
+     cf0:	e9 f2 fe ff ff       	jmp    be7 <fopen+0x87>
+     cf5:	8d 76 00             	lea    0x0(%esi),%esi
+     cf8:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+     cfb:	31 db                	xor    %ebx,%ebx
+    mutex_unlock(&iolock);
+     cfd:	68 a4 27 00 00       	push   $0x27a4
+     d02:	e8 e9 f5 ff ff       	call   2f0 <mutex_unlock>
+     d07:	83 c4 10             	add    $0x10,%esp
+     d0a:	e9 50 ff ff ff       	jmp    c5f <fopen+0xff>
+      close(fd);
+     d0f:	83 ec 0c             	sub    $0xc,%esp
+     d12:	56                   	push   %esi
+     d13:	e8 08 f7 ff ff       	call   420 <close>
+     d18:	83 c4 10             	add    $0x10,%esp
+     d1b:	eb b0                	jmp    ccd <fopen+0x16d>
+     d1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d20 <fclose>:
+{
+     d20:	55                   	push   %ebp
+     d21:	89 e5                	mov    %esp,%ebp
+     d23:	56                   	push   %esi
+     d24:	53                   	push   %ebx
+  if(threaded)
+     d25:	8b 15 a0 27 00 00    	mov    0x27a0,%edx
+{
+     d2b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+     d2e:	85 d2                	test   %edx,%edx
+     d30:	75 46                	jne    d78 <fclose+0x58>
+  r = flush(f);
+     d32:	89 d8                	mov    %ebx,%eax
+     d34:	e8 27 fc ff ff       	call   960 <flush>
+  if(close(f->fd) < 0)
+     d39:	83 ec 0c             	sub    $0xc,%esp
+     d3c:	ff 33                	push   (%ebx)
+  r = flush(f);
+     d3e:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+     d40:	e8 db f6 ff ff       	call   420 <close>
+     d45:	83 c4 10             	add    $0x10,%esp
+    r = EOF;
+     d48:	85 c0                	test   %eax,%eax
+     d4a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     d4f:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->flags & IO_MALLOC)
+     d52:	f6 43 04 80          	testb  $0x80,0x4(%ebx)
+     d56:	75 58                	jne    db0 <fclose+0x90>
+  if(threaded)
+     d58:	a1 a0 27 00 00       	mov    0x27a0,%eax
+  f->flags = 0;
+     d5d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  if(threaded)
+     d64:	85 c0                	test   %eax,%eax
+     d66:	75 28                	jne    d90 <fclose+0x70>
+}
+     d68:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d6b:	89 f0                	mov    %esi,%eax
+     d6d:	5b                   	pop    %ebx
+     d6e:	5e                   	pop    %esi
+     d6f:	5d                   	pop    %ebp
+     d70:	c3                   	ret
+     d71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+     d78:	83 ec 0c             	sub    $0xc,%esp
+     d7b:	8d 43 18             	lea    0x18(%ebx),%eax
+     d7e:	50                   	push   %eax
+     d7f:	e8 1c f5 ff ff       	call   2a0 <mutex_lock>
+     d84:	83 c4 10             	add    $0x10,%esp
+     d87:	eb a9                	jmp    d32 <fclose+0x12>
+     d89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     d90:	83 ec 0c             	sub    $0xc,%esp
+     d93:	83 c3 18             	add    $0x18,%ebx
+     d96:	53                   	push   %ebx
+     d97:	e8 54 f5 ff ff       	call   2f0 <mutex_unlock>
+     d9c:	83 c4 10             	add    $0x10,%esp
+}
+     d9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     da2:	89 f0                	mov    %esi,%eax
+     da4:	5b                   	pop    %ebx
+     da5:	5e                   	pop    %esi
+     da6:	5d                   	pop    %ebp
+     da7:	c3                   	ret
+     da8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     daf:	90                   	nop
+    free(f->buf);
+     db0:	83 ec 0c             	sub    $0xc,%esp
+     db3:	ff 73 08             	push   0x8(%ebx)
+     db6:	e8 f5 09 00 00       	call   17b0 <free>
+     dbb:	83 c4 10             	add    $0x10,%esp
+     dbe:	eb 98                	jmp    d58 <fclose+0x38>
+
+00000dc0 <fflush>:
+{
+     dc0:	55                   	push   %ebp
+     dc1:	89 e5                	mov    %esp,%ebp
+     dc3:	53                   	push   %ebx
+     dc4:	83 ec 14             	sub    $0x14,%esp
+     dc7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f == 0){
+     dca:	85 db                	test   %ebx,%ebx
+     dcc:	74 5a                	je     e28 <fflush+0x68>
+  if(threaded)
+     dce:	8b 0d a0 27 00 00    	mov    0x27a0,%ecx
+     dd4:	85 c9                	test   %ecx,%ecx
+     dd6:	75 18                	jne    df0 <fflush+0x30>
+  r = flush(f);
+     dd8:	89 d8                	mov    %ebx,%eax
+     dda:	e8 81 fb ff ff       	call   960 <flush>
+  if(threaded)
+     ddf:	8b 15 a0 27 00 00    	mov    0x27a0,%edx
+     de5:	85 d2                	test   %edx,%edx
+     de7:	75 1f                	jne    e08 <fflush+0x48>
+}
+     de9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     dec:	c9                   	leave
+     ded:	c3                   	ret
+     dee:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+     df0:	83 ec 0c             	sub    $0xc,%esp
+     df3:	8d 43 18             	lea    0x18(%ebx),%eax
+     df6:	50                   	push   %eax
+     df7:	e8 a4 f4 ff ff       	call   2a0 <mutex_lock>
+     dfc:	83 c4 10             	add    $0x10,%esp
+     dff:	eb d7                	jmp    dd8 <fflush+0x18>
+     e01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     e08:	83 ec 0c             	sub    $0xc,%esp
+     e0b:	83 c3 18             	add    $0x18,%ebx
+     e0e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     e11:	53                   	push   %ebx
+     e12:	e8 d9 f4 ff ff       	call   2f0 <mutex_unlock>
+     e17:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     e1a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    mutex_unlock(&f->lock);
+     e1d:	83 c4 10             	add    $0x10,%esp
+}
+     e20:	c9                   	leave
+     e21:	c3                   	ret
+     e22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     e28:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e2b:	c9                   	leave
+     e2c:	e9 af fb ff ff       	jmp    9e0 <fflush.part.0>
+     e31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e3f:	90                   	nop
+
+00000e40 <putc_unlocked>:
+{
+     e40:	55                   	push   %ebp
+     e41:	89 e5                	mov    %esp,%ebp
+     e43:	56                   	push   %esi
+     e44:	53                   	push   %ebx
+     e45:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     e48:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(!(f->flags & IO_WRITE))
+     e4b:	8b 43 04             	mov    0x4(%ebx),%eax
+     e4e:	a8 02                	test   $0x2,%al
+     e50:	74 46                	je     e98 <putc_unlocked+0x58>
+  if(!(f->flags & IO_SETUP))
+     e52:	a8 40                	test   $0x40,%al
+     e54:	74 4a                	je     ea0 <putc_unlocked+0x60>
+  if(f->n == f->size && flush(f) < 0)
+     e56:	8b 43 14             	mov    0x14(%ebx),%eax
+     e59:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     e5c:	74 51                	je     eaf <putc_unlocked+0x6f>
+  f->buf[f->n++] = c;
+     e5e:	8d 48 01             	lea    0x1(%eax),%ecx
+     e61:	8b 53 08             	mov    0x8(%ebx),%edx
+     e64:	89 4b 14             	mov    %ecx,0x14(%ebx)
+     e67:	89 f1                	mov    %esi,%ecx
+     e69:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     e6c:	83 fe 0a             	cmp    $0xa,%esi
+     e6f:	74 0f                	je     e80 <putc_unlocked+0x40>
+  return c & 0xff;
+     e71:	89 f0                	mov    %esi,%eax
+     e73:	0f b6 c0             	movzbl %al,%eax
+}
+     e76:	5b                   	pop    %ebx
+     e77:	5e                   	pop    %esi
+     e78:	5d                   	pop    %ebp
+     e79:	c3                   	ret
+     e7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     e80:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+     e84:	74 eb                	je     e71 <putc_unlocked+0x31>
+     e86:	89 d8                	mov    %ebx,%eax
+     e88:	e8 d3 fa ff ff       	call   960 <flush>
+     e8d:	85 c0                	test   %eax,%eax
+     e8f:	79 e0                	jns    e71 <putc_unlocked+0x31>
+     e91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return EOF;
+     e98:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     e9d:	eb d7                	jmp    e76 <putc_unlocked+0x36>
+     e9f:	90                   	nop
+    setup(f);
+     ea0:	89 d8                	mov    %ebx,%eax
+     ea2:	e8 69 fa ff ff       	call   910 <setup>
+  if(f->n == f->size && flush(f) < 0)
+     ea7:	8b 43 14             	mov    0x14(%ebx),%eax
+     eaa:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     ead:	75 af                	jne    e5e <putc_unlocked+0x1e>
+     eaf:	89 d8                	mov    %ebx,%eax
+     eb1:	e8 aa fa ff ff       	call   960 <flush>
+     eb6:	85 c0                	test   %eax,%eax
+     eb8:	78 de                	js     e98 <putc_unlocked+0x58>
+  f->buf[f->n++] = c;
+     eba:	8b 43 14             	mov    0x14(%ebx),%eax
+     ebd:	eb 9f                	jmp    e5e <putc_unlocked+0x1e>
+     ebf:	90                   	nop
+
+00000ec0 <fputc>:
+{
+     ec0:	55                   	push   %ebp
+     ec1:	89 e5                	mov    %esp,%ebp
+     ec3:	56                   	push   %esi
+     ec4:	53                   	push   %ebx
+  if(threaded)
+     ec5:	8b 15 a0 27 00 00    	mov    0x27a0,%edx
+{
+     ecb:	8b 75 08             	mov    0x8(%ebp),%esi
+     ece:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(threaded)
+     ed1:	85 d2                	test   %edx,%edx
+     ed3:	75 6b                	jne    f40 <fputc+0x80>
+  if(!(f->flags & IO_WRITE))
+     ed5:	8b 43 04             	mov    0x4(%ebx),%eax
+     ed8:	a8 02                	test   $0x2,%al
+     eda:	0f 84 b8 00 00 00    	je     f98 <fputc+0xd8>
+  if(!(f->flags & IO_SETUP))
+     ee0:	a8 40                	test   $0x40,%al
+     ee2:	74 76                	je     f5a <fputc+0x9a>
+  if(f->n == f->size && flush(f) < 0)
+     ee4:	8b 43 14             	mov    0x14(%ebx),%eax
+     ee7:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     eea:	74 7d                	je     f69 <fputc+0xa9>
+  f->buf[f->n++] = c;
+     eec:	8d 48 01             	lea    0x1(%eax),%ecx
+     eef:	8b 53 08             	mov    0x8(%ebx),%edx
+     ef2:	89 4b 14             	mov    %ecx,0x14(%ebx)
+     ef5:	89 f1                	mov    %esi,%ecx
+     ef7:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     efa:	83 fe 0a             	cmp    $0xa,%esi
+     efd:	74 21                	je     f20 <fputc+0x60>
+  return c & 0xff;
+     eff:	89 f0                	mov    %esi,%eax
+     f01:	0f b6 f0             	movzbl %al,%esi
+  if(threaded)
+     f04:	a1 a0 27 00 00       	mov    0x27a0,%eax
+     f09:	85 c0                	test   %eax,%eax
+     f0b:	75 73                	jne    f80 <fputc+0xc0>
+}
+     f0d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f10:	89 f0                	mov    %esi,%eax
+     f12:	5b                   	pop    %ebx
+     f13:	5e                   	pop    %esi
+     f14:	5d                   	pop    %ebp
+     f15:	c3                   	ret
+     f16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f1d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(c == '\n' && (f->flags & IO_LINE) && flush(f) < 0)
+     f20:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+     f24:	74 d9                	je     eff <fputc+0x3f>
+     f26:	89 d8                	mov    %ebx,%eax
+     f28:	e8 33 fa ff ff       	call   960 <flush>
+     f2d:	85 c0                	test   %eax,%eax
+     f2f:	79 ce                	jns    eff <fputc+0x3f>
+    return EOF;
+     f31:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     f36:	eb cc                	jmp    f04 <fputc+0x44>
+     f38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f3f:	90                   	nop
+    mutex_lock(&f->lock);
+     f40:	83 ec 0c             	sub    $0xc,%esp
+     f43:	8d 43 18             	lea    0x18(%ebx),%eax
+     f46:	50                   	push   %eax
+     f47:	e8 54 f3 ff ff       	call   2a0 <mutex_lock>
+  if(!(f->flags & IO_WRITE))
+     f4c:	8b 43 04             	mov    0x4(%ebx),%eax
+     f4f:	83 c4 10             	add    $0x10,%esp
+     f52:	a8 02                	test   $0x2,%al
+     f54:	74 db                	je     f31 <fputc+0x71>
+  if(!(f->flags & IO_SETUP))
+     f56:	a8 40                	test   $0x40,%al
+     f58:	75 8a                	jne    ee4 <fputc+0x24>
+    setup(f);
+     f5a:	89 d8                	mov    %ebx,%eax
+     f5c:	e8 af f9 ff ff       	call   910 <setup>
+  if(f->n == f->size && flush(f) < 0)
+     f61:	8b 43 14             	mov    0x14(%ebx),%eax
+     f64:	3b 43 0c             	cmp    0xc(%ebx),%eax
+     f67:	75 83                	jne    eec <fputc+0x2c>
+     f69:	89 d8                	mov    %ebx,%eax
+     f6b:	e8 f0 f9 ff ff       	call   960 <flush>
+     f70:	85 c0                	test   %eax,%eax
+     f72:	78 bd                	js     f31 <fputc+0x71>
+  f->buf[f->n++] = c;
+     f74:	8b 43 14             	mov    0x14(%ebx),%eax
+     f77:	e9 70 ff ff ff       	jmp    eec <fputc+0x2c>
+     f7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+     f80:	83 ec 0c             	sub    $0xc,%esp
+     f83:	83 c3 18             	add    $0x18,%ebx
+     f86:	53                   	push   %ebx
+     f87:	e8 64 f3 ff ff       	call   2f0 <mutex_unlock>
+     f8c:	83 c4 10             	add    $0x10,%esp
+}
+     f8f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f92:	89 f0                	mov    %esi,%eax
+     f94:	5b                   	pop    %ebx
+     f95:	5e                   	pop    %esi
+     f96:	5d                   	pop    %ebp
+     f97:	c3                   	ret
+    return EOF;
+     f98:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+     f9d:	e9 6b ff ff ff       	jmp    f0d <fputc+0x4d>
+     fa2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fa9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000fb0 <fwrite>:
+{
+     fb0:	55                   	push   %ebp
+     fb1:	89 e5                	mov    %esp,%ebp
+     fb3:	57                   	push   %edi
+     fb4:	56                   	push   %esi
+     fb5:	53                   	push   %ebx
+     fb6:	83 ec 1c             	sub    $0x1c,%esp
+     fb9:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  if(!(f->flags & IO_WRITE) || size <= 0)
+     fbc:	8b 43 04             	mov    0x4(%ebx),%eax
+     fbf:	a8 02                	test   $0x2,%al
+     fc1:	0f 84 ec 00 00 00    	je     10b3 <fwrite+0x103>
+     fc7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     fca:	85 c9                	test   %ecx,%ecx
+     fcc:	0f 8e e1 00 00 00    	jle    10b3 <fwrite+0x103>
+  if(threaded)
+     fd2:	8b 15 a0 27 00 00    	mov    0x27a0,%edx
+     fd8:	85 d2                	test   %edx,%edx
+     fda:	0f 85 1c 01 00 00    	jne    10fc <fwrite+0x14c>
+  if(!(f->flags & IO_SETUP))
+     fe0:	a8 40                	test   $0x40,%al
+     fe2:	0f 84 08 01 00 00    	je     10f0 <fwrite+0x140>
+  for(len = size*nmemb; len > 0; len -= n){
+     fe8:	8b 45 0c             	mov    0xc(%ebp),%eax
+     feb:	0f af 45 10          	imul   0x10(%ebp),%eax
+     fef:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     ff2:	85 c0                	test   %eax,%eax
+     ff4:	0f 8e 2a 01 00 00    	jle    1124 <fwrite+0x174>
+  s = p;
+     ffa:	8b 45 08             	mov    0x8(%ebp),%eax
+  nl = 0;
+     ffd:	31 ff                	xor    %edi,%edi
+     fff:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+        nl = 1;
+    1002:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  s = p;
+    1005:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1008:	8b 43 14             	mov    0x14(%ebx),%eax
+        nl = 1;
+    100b:	89 ce                	mov    %ecx,%esi
+    if(f->n == f->size && flush(f) < 0)
+    100d:	89 c2                	mov    %eax,%edx
+    100f:	39 f0                	cmp    %esi,%eax
+    1011:	74 6e                	je     1081 <fwrite+0xd1>
+    1013:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1017:	90                   	nop
+    if(n > len)
+    1018:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    n = f->size - f->n;
+    101b:	89 f1                	mov    %esi,%ecx
+    101d:	29 c1                	sub    %eax,%ecx
+    101f:	39 f9                	cmp    %edi,%ecx
+    1021:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    1024:	85 c9                	test   %ecx,%ecx
+    1026:	0f 8e 7c 00 00 00    	jle    10a8 <fwrite+0xf8>
+    102c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    102f:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1032:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    1035:	8d 34 08             	lea    (%eax,%ecx,1),%esi
+    1038:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    103b:	eb 06                	jmp    1043 <fwrite+0x93>
+    103d:	8d 76 00             	lea    0x0(%esi),%esi
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1040:	8b 53 14             	mov    0x14(%ebx),%edx
+    1043:	8d 4a 01             	lea    0x1(%edx),%ecx
+    1046:	8b 73 08             	mov    0x8(%ebx),%esi
+    1049:	89 4b 14             	mov    %ecx,0x14(%ebx)
+    104c:	0f b6 08             	movzbl (%eax),%ecx
+        nl = 1;
+    104f:	80 f9 0a             	cmp    $0xa,%cl
+      if((f->buf[f->n++] = s[i]) == '\n')
+    1052:	88 0c 16             	mov    %cl,(%esi,%edx,1)
+        nl = 1;
+    1055:	be 01 00 00 00       	mov    $0x1,%esi
+    105a:	0f 44 fe             	cmove  %esi,%edi
+    for(i = 0; i < n; i++)
+    105d:	83 c0 01             	add    $0x1,%eax
+    1060:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    1063:	75 db                	jne    1040 <fwrite+0x90>
+    s += n;
+    1065:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1068:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    106b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    s += n;
+    106e:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    1071:	85 c0                	test   %eax,%eax
+    1073:	7e 48                	jle    10bd <fwrite+0x10d>
+    1075:	8b 43 14             	mov    0x14(%ebx),%eax
+    1078:	8b 73 0c             	mov    0xc(%ebx),%esi
+    if(f->n == f->size && flush(f) < 0)
+    107b:	89 c2                	mov    %eax,%edx
+    107d:	39 f0                	cmp    %esi,%eax
+    107f:	75 97                	jne    1018 <fwrite+0x68>
+    1081:	89 d8                	mov    %ebx,%eax
+    1083:	e8 d8 f8 ff ff       	call   960 <flush>
+    1088:	85 c0                	test   %eax,%eax
+    108a:	78 31                	js     10bd <fwrite+0x10d>
+    n = f->size - f->n;
+    108c:	8b 73 0c             	mov    0xc(%ebx),%esi
+    108f:	8b 43 14             	mov    0x14(%ebx),%eax
+    1092:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    1095:	89 f1                	mov    %esi,%ecx
+    1097:	89 c2                	mov    %eax,%edx
+    1099:	29 c1                	sub    %eax,%ecx
+    109b:	39 f9                	cmp    %edi,%ecx
+    109d:	0f 4f cf             	cmovg  %edi,%ecx
+    for(i = 0; i < n; i++)
+    10a0:	85 c9                	test   %ecx,%ecx
+    10a2:	7f 88                	jg     102c <fwrite+0x7c>
+    10a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    s += n;
+    10a8:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+  for(len = size*nmemb; len > 0; len -= n){
+    10ab:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+    10ae:	e9 5a ff ff ff       	jmp    100d <fwrite+0x5d>
+}
+    10b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    10b6:	31 c0                	xor    %eax,%eax
+}
+    10b8:	5b                   	pop    %ebx
+    10b9:	5e                   	pop    %esi
+    10ba:	5f                   	pop    %edi
+    10bb:	5d                   	pop    %ebp
+    10bc:	c3                   	ret
+  if(nl && (f->flags & IO_LINE))
+    10bd:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    10c0:	85 ff                	test   %edi,%edi
+    10c2:	74 06                	je     10ca <fwrite+0x11a>
+    10c4:	f6 43 04 10          	testb  $0x10,0x4(%ebx)
+    10c8:	75 1d                	jne    10e7 <fwrite+0x137>
+  return (s - (const char*)p) / size;
+    10ca:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    10cd:	2b 75 08             	sub    0x8(%ebp),%esi
+  if(threaded)
+    10d0:	a1 a0 27 00 00       	mov    0x27a0,%eax
+    10d5:	85 c0                	test   %eax,%eax
+    10d7:	75 3a                	jne    1113 <fwrite+0x163>
+  return (s - (const char*)p) / size;
+    10d9:	89 f0                	mov    %esi,%eax
+    10db:	99                   	cltd
+    10dc:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    10df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    10e2:	5b                   	pop    %ebx
+    10e3:	5e                   	pop    %esi
+    10e4:	5f                   	pop    %edi
+    10e5:	5d                   	pop    %ebp
+    10e6:	c3                   	ret
+    flush(f);
+    10e7:	89 d8                	mov    %ebx,%eax
+    10e9:	e8 72 f8 ff ff       	call   960 <flush>
+    10ee:	eb da                	jmp    10ca <fwrite+0x11a>
+    setup(f);
+    10f0:	89 d8                	mov    %ebx,%eax
+    10f2:	e8 19 f8 ff ff       	call   910 <setup>
+    10f7:	e9 ec fe ff ff       	jmp    fe8 <fwrite+0x38>
+    mutex_lock(&f->lock);
+    10fc:	83 ec 0c             	sub    $0xc,%esp
+    10ff:	8d 43 18             	lea    0x18(%ebx),%eax
+    1102:	50                   	push   %eax
+    1103:	e8 98 f1 ff ff       	call   2a0 <mutex_lock>
+  if(!(f->flags & IO_SETUP))
+    1108:	8b 43 04             	mov    0x4(%ebx),%eax
+    110b:	83 c4 10             	add    $0x10,%esp
+    110e:	e9 cd fe ff ff       	jmp    fe0 <fwrite+0x30>
+    mutex_unlock(&f->lock);
+    1113:	83 ec 0c             	sub    $0xc,%esp
+    1116:	83 c3 18             	add    $0x18,%ebx
+    1119:	53                   	push   %ebx
+    111a:	e8 d1 f1 ff ff       	call   2f0 <mutex_unlock>
+    111f:	83 c4 10             	add    $0x10,%esp
+    1122:	eb b5                	jmp    10d9 <fwrite+0x129>
+  for(len = size*nmemb; len > 0; len -= n){
+    1124:	31 f6                	xor    %esi,%esi
+    1126:	eb a8                	jmp    10d0 <fwrite+0x120>
+    1128:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    112f:	90                   	nop
+
+00001130 <fgetc>:
+  return f->buf[f->r++] & 0xff;
+}
+
+int
+fgetc(FILE *f)
+{
+    1130:	55                   	push   %ebp
+    1131:	89 e5                	mov    %esp,%ebp
+    1133:	56                   	push   %esi
+    1134:	53                   	push   %ebx
+  if(threaded)
+    1135:	8b 15 a0 27 00 00    	mov    0x27a0,%edx
+{
+    113b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(threaded)
+    113e:	85 d2                	test   %edx,%edx
+    1140:	75 2e                	jne    1170 <fgetc+0x40>
+  if(!(f->flags & IO_READ))
+    1142:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1146:	74 78                	je     11c0 <fgetc+0x90>
+  if(f->r == f->n && fill(f) == 0)
+    1148:	8b 43 10             	mov    0x10(%ebx),%eax
+    114b:	3b 43 14             	cmp    0x14(%ebx),%eax
+    114e:	74 60                	je     11b0 <fgetc+0x80>
+  return f->buf[f->r++] & 0xff;
+    1150:	8b 53 08             	mov    0x8(%ebx),%edx
+    1153:	8d 48 01             	lea    0x1(%eax),%ecx
+    1156:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1159:	0f b6 34 02          	movzbl (%edx,%eax,1),%esi
+  if(threaded)
+    115d:	a1 a0 27 00 00       	mov    0x27a0,%eax
+    1162:	85 c0                	test   %eax,%eax
+    1164:	75 2a                	jne    1190 <fgetc+0x60>
+
+  flockfile(f);
+  c = getc_unlocked(f);
+  funlockfile(f);
+  return c;
+}
+    1166:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1169:	89 f0                	mov    %esi,%eax
+    116b:	5b                   	pop    %ebx
+    116c:	5e                   	pop    %esi
+    116d:	5d                   	pop    %ebp
+    116e:	c3                   	ret
+    116f:	90                   	nop
+    mutex_lock(&f->lock);
+    1170:	83 ec 0c             	sub    $0xc,%esp
+    1173:	8d 43 18             	lea    0x18(%ebx),%eax
+    1176:	50                   	push   %eax
+    1177:	e8 24 f1 ff ff       	call   2a0 <mutex_lock>
+  if(!(f->flags & IO_READ))
+    117c:	83 c4 10             	add    $0x10,%esp
+    117f:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1183:	75 c3                	jne    1148 <fgetc+0x18>
+    return EOF;
+    1185:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    118a:	eb d1                	jmp    115d <fgetc+0x2d>
+    118c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1190:	83 ec 0c             	sub    $0xc,%esp
+    1193:	83 c3 18             	add    $0x18,%ebx
+    1196:	53                   	push   %ebx
+    1197:	e8 54 f1 ff ff       	call   2f0 <mutex_unlock>
+    119c:	83 c4 10             	add    $0x10,%esp
+}
+    119f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    11a2:	89 f0                	mov    %esi,%eax
+    11a4:	5b                   	pop    %ebx
+    11a5:	5e                   	pop    %esi
+    11a6:	5d                   	pop    %ebp
+    11a7:	c3                   	ret
+    11a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11af:	90                   	nop
+  if(f->r == f->n && fill(f) == 0)
+    11b0:	89 d8                	mov    %ebx,%eax
+    11b2:	e8 c9 f8 ff ff       	call   a80 <fill>
+    11b7:	85 c0                	test   %eax,%eax
+    11b9:	74 ca                	je     1185 <fgetc+0x55>
+  return f->buf[f->r++] & 0xff;
+    11bb:	8b 43 10             	mov    0x10(%ebx),%eax
+    11be:	eb 90                	jmp    1150 <fgetc+0x20>
+    return EOF;
+    11c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return c;
+    11c5:	eb 9f                	jmp    1166 <fgetc+0x36>
+    11c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11ce:	66 90                	xchg   %ax,%ax
+
+000011d0 <fread>:
+
+int
+fread(void *p, int size, int nmemb, FILE *f)
+{
+    11d0:	55                   	push   %ebp
+    11d1:	89 e5                	mov    %esp,%ebp
+    11d3:	57                   	push   %edi
+    11d4:	56                   	push   %esi
+    11d5:	53                   	push   %ebx
+    11d6:	83 ec 1c             	sub    $0x1c,%esp
+    11d9:	8b 75 14             	mov    0x14(%ebp),%esi
+  char *d;
+  int n, len;
+
+  if(!(f->flags & IO_READ) || size <= 0)
+    11dc:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+    11e0:	74 7e                	je     1260 <fread+0x90>
+    11e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+    11e5:	85 d2                	test   %edx,%edx
+    11e7:	7e 77                	jle    1260 <fread+0x90>
+  if(threaded)
+    11e9:	a1 a0 27 00 00       	mov    0x27a0,%eax
+    return 0;
+  flockfile(f);
+  d = p;
+  for(len = size*nmemb; len > 0; len -= n){
+    11ee:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    11f1:	0f af 7d 10          	imul   0x10(%ebp),%edi
+  if(threaded)
+    11f5:	85 c0                	test   %eax,%eax
+    11f7:	0f 85 93 00 00 00    	jne    1290 <fread+0xc0>
+  for(len = size*nmemb; len > 0; len -= n){
+    11fd:	85 ff                	test   %edi,%edi
+    11ff:	7e 61                	jle    1262 <fread+0x92>
+    if(f->r == f->n && fill(f) == 0)
+    1201:	8b 46 10             	mov    0x10(%esi),%eax
+  d = p;
+    1204:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1207:	eb 35                	jmp    123e <fread+0x6e>
+    1209:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      break;
+    n = f->n - f->r;
+    1210:	29 c3                	sub    %eax,%ebx
+    1212:	39 fb                	cmp    %edi,%ebx
+    1214:	0f 4f df             	cmovg  %edi,%ebx
+    if(n > len)
+      n = len;
+    memmove(d, f->buf + f->r, n);
+    1217:	83 ec 04             	sub    $0x4,%esp
+    121a:	53                   	push   %ebx
+    121b:	03 46 08             	add    0x8(%esi),%eax
+  for(len = size*nmemb; len > 0; len -= n){
+    121e:	29 df                	sub    %ebx,%edi
+    memmove(d, f->buf + f->r, n);
+    1220:	50                   	push   %eax
+    1221:	51                   	push   %ecx
+    1222:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1225:	e8 36 f0 ff ff       	call   260 <memmove>
+    f->r += n;
+    122a:	8b 46 10             	mov    0x10(%esi),%eax
+    d += n;
+    122d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(len = size*nmemb; len > 0; len -= n){
+    1230:	83 c4 10             	add    $0x10,%esp
+    f->r += n;
+    1233:	01 d8                	add    %ebx,%eax
+    d += n;
+    1235:	01 d9                	add    %ebx,%ecx
+    f->r += n;
+    1237:	89 46 10             	mov    %eax,0x10(%esi)
+  for(len = size*nmemb; len > 0; len -= n){
+    123a:	85 ff                	test   %edi,%edi
+    123c:	7e 32                	jle    1270 <fread+0xa0>
+    if(f->r == f->n && fill(f) == 0)
+    123e:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1241:	39 c3                	cmp    %eax,%ebx
+    1243:	75 cb                	jne    1210 <fread+0x40>
+    1245:	89 f0                	mov    %esi,%eax
+    1247:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    124a:	e8 31 f8 ff ff       	call   a80 <fill>
+    124f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1252:	85 c0                	test   %eax,%eax
+    1254:	74 1a                	je     1270 <fread+0xa0>
+    n = f->n - f->r;
+    1256:	8b 5e 14             	mov    0x14(%esi),%ebx
+    1259:	8b 46 10             	mov    0x10(%esi),%eax
+    125c:	eb b2                	jmp    1210 <fread+0x40>
+    125e:	66 90                	xchg   %ax,%ax
+    return 0;
+    1260:	31 c0                	xor    %eax,%eax
+  }
+  funlockfile(f);
+  return (d - (char*)p) / size;
+}
+    1262:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1265:	5b                   	pop    %ebx
+    1266:	5e                   	pop    %esi
+    1267:	5f                   	pop    %edi
+    1268:	5d                   	pop    %ebp
+    1269:	c3                   	ret
+    126a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (d - (char*)p) / size;
+    1270:	2b 4d 08             	sub    0x8(%ebp),%ecx
+    1273:	89 cb                	mov    %ecx,%ebx
+  if(threaded)
+    1275:	a1 a0 27 00 00       	mov    0x27a0,%eax
+    127a:	85 c0                	test   %eax,%eax
+    127c:	75 32                	jne    12b0 <fread+0xe0>
+  return (d - (char*)p) / size;
+    127e:	89 d8                	mov    %ebx,%eax
+    1280:	99                   	cltd
+    1281:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    1284:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1287:	5b                   	pop    %ebx
+    1288:	5e                   	pop    %esi
+    1289:	5f                   	pop    %edi
+    128a:	5d                   	pop    %ebp
+    128b:	c3                   	ret
+    128c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&f->lock);
+    1290:	83 ec 0c             	sub    $0xc,%esp
+    1293:	8d 46 18             	lea    0x18(%esi),%eax
+    1296:	50                   	push   %eax
+    1297:	e8 04 f0 ff ff       	call   2a0 <mutex_lock>
+  for(len = size*nmemb; len > 0; len -= n){
+    129c:	83 c4 10             	add    $0x10,%esp
+    129f:	85 ff                	test   %edi,%edi
+    12a1:	0f 8f 5a ff ff ff    	jg     1201 <fread+0x31>
+    12a7:	31 db                	xor    %ebx,%ebx
+    12a9:	eb ca                	jmp    1275 <fread+0xa5>
+    12ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12af:	90                   	nop
+    mutex_unlock(&f->lock);
+    12b0:	83 ec 0c             	sub    $0xc,%esp
+    12b3:	83 c6 18             	add    $0x18,%esi
+    12b6:	56                   	push   %esi
+    12b7:	e8 34 f0 ff ff       	call   2f0 <mutex_unlock>
+  return (d - (char*)p) / size;
+    12bc:	89 d8                	mov    %ebx,%eax
+    12be:	83 c4 10             	add    $0x10,%esp
+    12c1:	99                   	cltd
+    12c2:	f7 7d 0c             	idivl  0xc(%ebp)
+}
+    12c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12c8:	5b                   	pop    %ebx
+    12c9:	5e                   	pop    %esi
+    12ca:	5f                   	pop    %edi
+    12cb:	5d                   	pop    %ebp
+    12cc:	c3                   	ret
+    12cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000012d0 <fgets>:
+
+// Read a line of at most max-1 bytes, keeping the newline.
+// Returns 0 if there was nothing left to read.
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    12d0:	55                   	push   %ebp
+    12d1:	89 e5                	mov    %esp,%ebp
+    12d3:	57                   	push   %edi
+    12d4:	56                   	push   %esi
+    12d5:	53                   	push   %ebx
+    12d6:	83 ec 1c             	sub    $0x1c,%esp
+  if(threaded)
+    12d9:	8b 35 a0 27 00 00    	mov    0x27a0,%esi
+{
+    12df:	8b 7d 08             	mov    0x8(%ebp),%edi
+    12e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if(threaded)
+    12e5:	85 f6                	test   %esi,%esi
+    12e7:	0f 85 83 00 00 00    	jne    1370 <fgets+0xa0>
+{
+    12ed:	31 f6                	xor    %esi,%esi
+    12ef:	eb 2a                	jmp    131b <fgets+0x4b>
+    12f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return f->buf[f->r++] & 0xff;
+    12f8:	8b 53 08             	mov    0x8(%ebx),%edx
+    12fb:	8d 48 01             	lea    0x1(%eax),%ecx
+    12fe:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    1301:	0f b6 14 02          	movzbl (%edx,%eax,1),%edx
+
+  flockfile(f);
+  for(i = 0; i+1 < max; ){
+    if((c = getc_unlocked(f)) == EOF)
+      break;
+    buf[i++] = c;
+    1305:	88 54 37 ff          	mov    %dl,-0x1(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    1309:	80 fa 0a             	cmp    $0xa,%dl
+    130c:	0f 84 96 00 00 00    	je     13a8 <fgets+0xd8>
+    1312:	83 fa 0d             	cmp    $0xd,%edx
+    1315:	0f 84 8d 00 00 00    	je     13a8 <fgets+0xd8>
+  for(i = 0; i+1 < max; ){
+    131b:	89 f2                	mov    %esi,%edx
+    131d:	83 c6 01             	add    $0x1,%esi
+    1320:	3b 75 0c             	cmp    0xc(%ebp),%esi
+    1323:	7d 2b                	jge    1350 <fgets+0x80>
+  if(!(f->flags & IO_READ))
+    1325:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+    1329:	74 25                	je     1350 <fgets+0x80>
+  if(f->r == f->n && fill(f) == 0)
+    132b:	8b 43 10             	mov    0x10(%ebx),%eax
+    132e:	3b 43 14             	cmp    0x14(%ebx),%eax
+    1331:	75 c5                	jne    12f8 <fgets+0x28>
+    1333:	89 d8                	mov    %ebx,%eax
+    1335:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1338:	e8 43 f7 ff ff       	call   a80 <fill>
+    133d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1340:	85 c0                	test   %eax,%eax
+    1342:	74 0c                	je     1350 <fgets+0x80>
+  return f->buf[f->r++] & 0xff;
+    1344:	8b 43 10             	mov    0x10(%ebx),%eax
+    1347:	eb af                	jmp    12f8 <fgets+0x28>
+    1349:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1350:	8b 0d a0 27 00 00    	mov    0x27a0,%ecx
+      break;
+  }
+  buf[i] = '\0';
+    1356:	c6 04 17 00          	movb   $0x0,(%edi,%edx,1)
+  if(threaded)
+    135a:	85 c9                	test   %ecx,%ecx
+    135c:	75 2a                	jne    1388 <fgets+0xb8>
+  funlockfile(f);
+  return i > 0 ? buf : 0;
+    135e:	31 c0                	xor    %eax,%eax
+    1360:	85 d2                	test   %edx,%edx
+    1362:	74 02                	je     1366 <fgets+0x96>
+    1364:	89 f8                	mov    %edi,%eax
+}
+    1366:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1369:	5b                   	pop    %ebx
+    136a:	5e                   	pop    %esi
+    136b:	5f                   	pop    %edi
+    136c:	5d                   	pop    %ebp
+    136d:	c3                   	ret
+    136e:	66 90                	xchg   %ax,%ax
+    mutex_lock(&f->lock);
+    1370:	83 ec 0c             	sub    $0xc,%esp
+    1373:	8d 43 18             	lea    0x18(%ebx),%eax
+    1376:	50                   	push   %eax
+    1377:	e8 24 ef ff ff       	call   2a0 <mutex_lock>
+    137c:	83 c4 10             	add    $0x10,%esp
+    137f:	e9 69 ff ff ff       	jmp    12ed <fgets+0x1d>
+    1384:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_unlock(&f->lock);
+    1388:	83 ec 0c             	sub    $0xc,%esp
+    138b:	83 c3 18             	add    $0x18,%ebx
+    138e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1391:	53                   	push   %ebx
+    1392:	e8 59 ef ff ff       	call   2f0 <mutex_unlock>
+    1397:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    139a:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    139d:	31 c0                	xor    %eax,%eax
+    139f:	85 d2                	test   %edx,%edx
+    13a1:	75 c1                	jne    1364 <fgets+0x94>
+    13a3:	eb c1                	jmp    1366 <fgets+0x96>
+    13a5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    13a8:	a1 a0 27 00 00       	mov    0x27a0,%eax
+  buf[i] = '\0';
+    13ad:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  if(threaded)
+    13b1:	85 c0                	test   %eax,%eax
+    13b3:	74 af                	je     1364 <fgets+0x94>
+    mutex_unlock(&f->lock);
+    13b5:	83 ec 0c             	sub    $0xc,%esp
+    13b8:	83 c3 18             	add    $0x18,%ebx
+    13bb:	53                   	push   %ebx
+    13bc:	e8 2f ef ff ff       	call   2f0 <mutex_unlock>
+    13c1:	83 c4 10             	add    $0x10,%esp
+  return i > 0 ? buf : 0;
+    13c4:	89 f8                	mov    %edi,%eax
+    13c6:	eb 9e                	jmp    1366 <fgets+0x96>
+    13c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13cf:	90                   	nop
+
+000013d0 <gets>:
+// at most a line per read(), goes through stdin's buffer: from a
+// file or pipe, a buffered read could take input meant for a child
+// process, so read a byte at a time.
+char*
+gets(char *buf, int max)
+{
+    13d0:	55                   	push   %ebp
+    13d1:	89 e5                	mov    %esp,%ebp
+    13d3:	57                   	push   %edi
+    13d4:	56                   	push   %esi
+    13d5:	53                   	push   %ebx
+    13d6:	83 ec 2c             	sub    $0x2c,%esp
+  int i, cc;
+  char c;
+
+  if(!(stdin->flags & IO_SETUP))
+    13d9:	8b 15 a4 26 00 00    	mov    0x26a4,%edx
+{
+    13df:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!(stdin->flags & IO_SETUP))
+    13e2:	f6 c2 40             	test   $0x40,%dl
+    13e5:	74 79                	je     1460 <gets+0x90>
+    setup(stdin);
+  if(stdin->flags & IO_DEV){
+    13e7:	83 e2 20             	and    $0x20,%edx
+    13ea:	89 d7                	mov    %edx,%edi
+    13ec:	75 52                	jne    1440 <gets+0x70>
+  if(f == 0){
+    13ee:	e8 ed f5 ff ff       	call   9e0 <fflush.part.0>
+    fgets(buf, max, stdin);
+    return buf;
+  }
+  fflush(0);
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    13f3:	8d 75 e7             	lea    -0x19(%ebp),%esi
+  for(i=0; i+1 < max; ){
+    13f6:	eb 2c                	jmp    1424 <gets+0x54>
+    13f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13ff:	90                   	nop
+    cc = read(0, &c, 1);
+    1400:	83 ec 04             	sub    $0x4,%esp
+    1403:	6a 01                	push   $0x1
+    1405:	56                   	push   %esi
+    1406:	6a 00                	push   $0x0
+    1408:	e8 f5 ef ff ff       	call   402 <read>
+    if(cc < 1)
+    140d:	83 c4 10             	add    $0x10,%esp
+    1410:	85 c0                	test   %eax,%eax
+    1412:	7e 1b                	jle    142f <gets+0x5f>
+      break;
+    buf[i++] = c;
+    1414:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1418:	88 44 3b ff          	mov    %al,-0x1(%ebx,%edi,1)
+    if(c == '\n' || c == '\r')
+    141c:	3c 0a                	cmp    $0xa,%al
+    141e:	74 12                	je     1432 <gets+0x62>
+    1420:	3c 0d                	cmp    $0xd,%al
+    1422:	74 0e                	je     1432 <gets+0x62>
+  for(i=0; i+1 < max; ){
+    1424:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    1427:	83 c7 01             	add    $0x1,%edi
+    142a:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+    142d:	7c d1                	jl     1400 <gets+0x30>
+{
+    142f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      break;
+  }
+  buf[i] = '\0';
+    1432:	c6 04 3b 00          	movb   $0x0,(%ebx,%edi,1)
+  return buf;
+}
+    1436:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1439:	89 d8                	mov    %ebx,%eax
+    143b:	5b                   	pop    %ebx
+    143c:	5e                   	pop    %esi
+    143d:	5f                   	pop    %edi
+    143e:	5d                   	pop    %ebp
+    143f:	c3                   	ret
+    fgets(buf, max, stdin);
+    1440:	83 ec 04             	sub    $0x4,%esp
+    1443:	68 a0 26 00 00       	push   $0x26a0
+    1448:	ff 75 0c             	push   0xc(%ebp)
+    144b:	53                   	push   %ebx
+    144c:	e8 7f fe ff ff       	call   12d0 <fgets>
+    return buf;
+    1451:	83 c4 10             	add    $0x10,%esp
+}
+    1454:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1457:	89 d8                	mov    %ebx,%eax
+    1459:	5b                   	pop    %ebx
+    145a:	5e                   	pop    %esi
+    145b:	5f                   	pop    %edi
+    145c:	5d                   	pop    %ebp
+    145d:	c3                   	ret
+    145e:	66 90                	xchg   %ax,%ax
+    setup(stdin);
+    1460:	b8 a0 26 00 00       	mov    $0x26a0,%eax
+    1465:	e8 a6 f4 ff ff       	call   910 <setup>
+  if(stdin->flags & IO_DEV){
+    146a:	8b 15 a4 26 00 00    	mov    0x26a4,%edx
+    1470:	e9 72 ff ff ff       	jmp    13e7 <gets+0x17>
+    1475:	66 90                	xchg   %ax,%ax
+    1477:	66 90                	xchg   %ax,%ax
+    1479:	66 90                	xchg   %ax,%ax
+    147b:	66 90                	xchg   %ax,%ax
+    147d:	66 90                	xchg   %ax,%ax
+    147f:	90                   	nop
+
+00001480 <bigfree>:
+
+// Give a big block back to the first-fit list, and return the
+// free block that now holds it. Caller holds lock.
+static Header*
+bigfree(Header *bp)
+{
+    1480:	55                   	push   %ebp
+    1481:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1483:	a1 44 2e 00 00       	mov    0x2e44,%eax
+{
+    1488:	89 e5                	mov    %esp,%ebp
+    148a:	56                   	push   %esi
+    148b:	53                   	push   %ebx
+    148c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1490:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1492:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1494:	39 ca                	cmp    %ecx,%edx
+    1496:	73 38                	jae    14d0 <bigfree+0x50>
+    1498:	39 c1                	cmp    %eax,%ecx
+    149a:	72 04                	jb     14a0 <bigfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    149c:	39 c2                	cmp    %eax,%edx
+    149e:	72 f0                	jb     1490 <bigfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    14a0:	8b 59 04             	mov    0x4(%ecx),%ebx
+    14a3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    14a6:	39 f0                	cmp    %esi,%eax
+    14a8:	74 36                	je     14e0 <bigfree+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    14aa:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  freep = p;
+  if(p + p->s.size == bp){
+    14ac:	8b 42 04             	mov    0x4(%edx),%eax
+    14af:	89 cb                	mov    %ecx,%ebx
+  freep = p;
+    14b1:	89 15 44 2e 00 00    	mov    %edx,0x2e44
+  if(p + p->s.size == bp){
+    14b7:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    14ba:	39 f1                	cmp    %esi,%ecx
+    14bc:	74 2e                	je     14ec <bigfree+0x6c>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    14be:	89 1a                	mov    %ebx,(%edx)
+    return p;
+  }
+  p->s.ptr = bp;
+  return bp;
+}
+    14c0:	89 c8                	mov    %ecx,%eax
+    14c2:	5b                   	pop    %ebx
+    14c3:	5e                   	pop    %esi
+    14c4:	5d                   	pop    %ebp
+    14c5:	c3                   	ret
+    14c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14cd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    14d0:	39 c1                	cmp    %eax,%ecx
+    14d2:	72 c8                	jb     149c <bigfree+0x1c>
+    14d4:	eb ba                	jmp    1490 <bigfree+0x10>
+    14d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    14e0:	03 58 04             	add    0x4(%eax),%ebx
+    14e3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    14e6:	8b 02                	mov    (%edx),%eax
+    14e8:	8b 00                	mov    (%eax),%eax
+    14ea:	eb be                	jmp    14aa <bigfree+0x2a>
+    p->s.size += bp->s.size;
+    14ec:	03 41 04             	add    0x4(%ecx),%eax
+    14ef:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    14f2:	8b 19                	mov    (%ecx),%ebx
+    return p;
+    14f4:	89 d1                	mov    %edx,%ecx
+}
+    14f6:	89 c8                	mov    %ecx,%eax
+    p->s.ptr = bp->s.ptr;
+    14f8:	89 1a                	mov    %ebx,(%edx)
+}
+    14fa:	5b                   	pop    %ebx
+    14fb:	5e                   	pop    %esi
+    14fc:	5d                   	pop    %ebp
+    14fd:	c3                   	ret
+    14fe:	66 90                	xchg   %ax,%ax
+
+00001500 <trim>:
+// If free block bp ends the heap, return its whole pages to the
+// kernel, unless something else has moved the break since.
+// Caller holds lock.
+static void
+trim(Header *bp)
+{
+    1500:	55                   	push   %ebp
+    1501:	89 e5                	mov    %esp,%ebp
+    1503:	57                   	push   %edi
+    1504:	56                   	push   %esi
+    1505:	53                   	push   %ebx
+    1506:	89 c3                	mov    %eax,%ebx
+    1508:	83 ec 0c             	sub    $0xc,%esp
+  char *end;
+  uint n;
+
+  if((char*)(bp + bp->s.size) != heapend)
+    150b:	8b 53 04             	mov    0x4(%ebx),%edx
+    150e:	a1 40 2e 00 00       	mov    0x2e40,%eax
+    1513:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+    1516:	39 d0                	cmp    %edx,%eax
+    1518:	74 0e                	je     1528 <trim+0x28>
+  n = heapend - end;
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    bp->s.size -= n / sizeof(Header);
+    heapend = end;
+  }
+}
+    151a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    151d:	5b                   	pop    %ebx
+    151e:	5e                   	pop    %esi
+    151f:	5f                   	pop    %edi
+    1520:	5d                   	pop    %ebp
+    1521:	c3                   	ret
+    1522:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  end = (char*)PGROUNDUP((uint)(bp + 2));
+    1528:	8d bb 0f 10 00 00    	lea    0x100f(%ebx),%edi
+    152e:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  n = heapend - end;
+    1534:	29 f8                	sub    %edi,%eax
+    1536:	89 c6                	mov    %eax,%esi
+  if(n >= TRIM && sbrk(0) == heapend && sbrk(-n) != (char*)-1){
+    1538:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    153d:	76 db                	jbe    151a <trim+0x1a>
+    153f:	83 ec 0c             	sub    $0xc,%esp
+    1542:	6a 00                	push   $0x0
+    1544:	e8 8b ef ff ff       	call   4d4 <sbrk>
+    1549:	83 c4 10             	add    $0x10,%esp
+    154c:	39 05 40 2e 00 00    	cmp    %eax,0x2e40
+    1552:	75 c6                	jne    151a <trim+0x1a>
+    1554:	89 f0                	mov    %esi,%eax
+    1556:	83 ec 0c             	sub    $0xc,%esp
+    1559:	f7 d8                	neg    %eax
+    155b:	50                   	push   %eax
+    155c:	e8 73 ef ff ff       	call   4d4 <sbrk>
+    1561:	83 c4 10             	add    $0x10,%esp
+    1564:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1567:	74 b1                	je     151a <trim+0x1a>
+    bp->s.size -= n / sizeof(Header);
+    1569:	89 f0                	mov    %esi,%eax
+    heapend = end;
+    156b:	89 3d 40 2e 00 00    	mov    %edi,0x2e40
+    bp->s.size -= n / sizeof(Header);
+    1571:	c1 e8 03             	shr    $0x3,%eax
+    1574:	29 43 04             	sub    %eax,0x4(%ebx)
+    heapend = end;
+    1577:	eb a1                	jmp    151a <trim+0x1a>
+    1579:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001580 <bigalloc>:
+}
+
+// Allocate a big block of nunits units. Caller holds lock.
+static Header*
+bigalloc(uint nunits)
+{
+    1580:	55                   	push   %ebp
+    1581:	89 e5                	mov    %esp,%ebp
+    1583:	57                   	push   %edi
+    1584:	89 c7                	mov    %eax,%edi
+    1586:	56                   	push   %esi
+    1587:	53                   	push   %ebx
+    1588:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    158b:	a1 44 2e 00 00       	mov    0x2e44,%eax
+    1590:	85 c0                	test   %eax,%eax
+    1592:	0f 84 98 00 00 00    	je     1630 <bigalloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1598:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    159a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    159d:	39 f9                	cmp    %edi,%ecx
+    159f:	73 67                	jae    1608 <bigalloc+0x88>
+  if(nu < 4096)
+    15a1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    15a6:	39 df                	cmp    %ebx,%edi
+    15a8:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    15ab:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    15b2:	eb 0d                	jmp    15c1 <bigalloc+0x41>
+    15b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    15b8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    15ba:	8b 4a 04             	mov    0x4(%edx),%ecx
+    15bd:	39 f9                	cmp    %edi,%ecx
+    15bf:	73 47                	jae    1608 <bigalloc+0x88>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    15c1:	89 d0                	mov    %edx,%eax
+    15c3:	39 15 44 2e 00 00    	cmp    %edx,0x2e44
+    15c9:	75 ed                	jne    15b8 <bigalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    15cb:	83 ec 0c             	sub    $0xc,%esp
+    15ce:	56                   	push   %esi
+    15cf:	e8 00 ef ff ff       	call   4d4 <sbrk>
+  if(p == (char*)-1)
+    15d4:	83 c4 10             	add    $0x10,%esp
+    15d7:	83 f8 ff             	cmp    $0xffffffff,%eax
+    15da:	74 1a                	je     15f6 <bigalloc+0x76>
+  hp->s.size = nu;
+    15dc:	89 58 04             	mov    %ebx,0x4(%eax)
+  heapend = p + nu * sizeof(Header);
+    15df:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    15e2:	89 15 40 2e 00 00    	mov    %edx,0x2e40
+  bigfree(hp);
+    15e8:	e8 93 fe ff ff       	call   1480 <bigfree>
+  return freep;
+    15ed:	a1 44 2e 00 00       	mov    0x2e44,%eax
+      if((p = morecore(nunits)) == 0)
+    15f2:	85 c0                	test   %eax,%eax
+    15f4:	75 c2                	jne    15b8 <bigalloc+0x38>
+        return 0;
+  }
+}
+    15f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    15f9:	31 d2                	xor    %edx,%edx
+}
+    15fb:	5b                   	pop    %ebx
+    15fc:	89 d0                	mov    %edx,%eax
+    15fe:	5e                   	pop    %esi
+    15ff:	5f                   	pop    %edi
+    1600:	5d                   	pop    %ebp
+    1601:	c3                   	ret
+    1602:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1608:	39 cf                	cmp    %ecx,%edi
+    160a:	74 54                	je     1660 <bigalloc+0xe0>
+        p->s.size -= nunits;
+    160c:	29 f9                	sub    %edi,%ecx
+    160e:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    1611:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    1614:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    1617:	a3 44 2e 00 00       	mov    %eax,0x2e44
+}
+    161c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    161f:	89 d0                	mov    %edx,%eax
+    1621:	5b                   	pop    %ebx
+    1622:	5e                   	pop    %esi
+    1623:	5f                   	pop    %edi
+    1624:	5d                   	pop    %ebp
+    1625:	c3                   	ret
+    1626:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    162d:	8d 76 00             	lea    0x0(%esi),%esi
+    base.s.ptr = freep = prevp = &base;
+    1630:	c7 05 44 2e 00 00 48 	movl   $0x2e48,0x2e44
+    1637:	2e 00 00 
+    base.s.size = 0;
+    163a:	ba 48 2e 00 00       	mov    $0x2e48,%edx
+    base.s.ptr = freep = prevp = &base;
+    163f:	c7 05 48 2e 00 00 48 	movl   $0x2e48,0x2e48
+    1646:	2e 00 00 
+    base.s.size = 0;
+    1649:	c7 05 4c 2e 00 00 00 	movl   $0x0,0x2e4c
+    1650:	00 00 00 
+    if(p->s.size >= nunits){
+    1653:	e9 49 ff ff ff       	jmp    15a1 <bigalloc+0x21>
+    1658:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    165f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1660:	8b 0a                	mov    (%edx),%ecx
+    1662:	89 08                	mov    %ecx,(%eax)
+    1664:	eb b1                	jmp    1617 <bigalloc+0x97>
+    1666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    166d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001670 <drain>:
+}
+
+// Move n blocks of class c from cache tc to the shared list.
+static void
+drain(struct tcache *tc, int c, int n)
+{
+    1670:	55                   	push   %ebp
+    1671:	89 e5                	mov    %esp,%ebp
+    1673:	57                   	push   %edi
+    1674:	89 c7                	mov    %eax,%edi
+    1676:	56                   	push   %esi
+    1677:	89 d6                	mov    %edx,%esi
+    1679:	53                   	push   %ebx
+    167a:	89 cb                	mov    %ecx,%ebx
+    167c:	83 ec 0c             	sub    $0xc,%esp
+  if(threaded)
+    167f:	8b 15 c4 2d 00 00    	mov    0x2dc4,%edx
+    1685:	85 d2                	test   %edx,%edx
+    1687:	75 57                	jne    16e0 <drain+0x70>
+  Header *p;
+
+  acquire();
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    1689:	85 c9                	test   %ecx,%ecx
+    168b:	7e 49                	jle    16d6 <drain+0x66>
+    168d:	89 d9                	mov    %ebx,%ecx
+    168f:	8d 14 b7             	lea    (%edi,%esi,4),%edx
+    1692:	eb 23                	jmp    16b7 <drain+0x47>
+    1694:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    tc->list[c] = p->s.ptr;
+    1698:	8b 18                	mov    (%eax),%ebx
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    169a:	83 e9 01             	sub    $0x1,%ecx
+    tc->n[c]--;
+    169d:	83 6a 20 01          	subl   $0x1,0x20(%edx)
+    tc->list[c] = p->s.ptr;
+    16a1:	89 1a                	mov    %ebx,(%edx)
+    p->s.ptr = small[c];
+    16a3:	8b 1c b5 20 2e 00 00 	mov    0x2e20(,%esi,4),%ebx
+    16aa:	89 18                	mov    %ebx,(%eax)
+    small[c] = p;
+    16ac:	89 04 b5 20 2e 00 00 	mov    %eax,0x2e20(,%esi,4)
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    16b3:	85 c9                	test   %ecx,%ecx
+    16b5:	7e 06                	jle    16bd <drain+0x4d>
+    16b7:	8b 02                	mov    (%edx),%eax
+    16b9:	85 c0                	test   %eax,%eax
+    16bb:	75 db                	jne    1698 <drain+0x28>
+  if(threaded)
+    16bd:	a1 c4 2d 00 00       	mov    0x2dc4,%eax
+    16c2:	85 c0                	test   %eax,%eax
+    16c4:	74 10                	je     16d6 <drain+0x66>
+    mutex_unlock(&lock);
+    16c6:	83 ec 0c             	sub    $0xc,%esp
+    16c9:	68 c8 2d 00 00       	push   $0x2dc8
+    16ce:	e8 1d ec ff ff       	call   2f0 <mutex_unlock>
+}
+    16d3:	83 c4 10             	add    $0x10,%esp
+  }
+  release();
+}
+    16d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    16d9:	5b                   	pop    %ebx
+    16da:	5e                   	pop    %esi
+    16db:	5f                   	pop    %edi
+    16dc:	5d                   	pop    %ebp
+    16dd:	c3                   	ret
+    16de:	66 90                	xchg   %ax,%ax
+    mutex_lock(&lock);
+    16e0:	83 ec 0c             	sub    $0xc,%esp
+    16e3:	68 c8 2d 00 00       	push   $0x2dc8
+    16e8:	e8 b3 eb ff ff       	call   2a0 <mutex_lock>
+  while(n-- > 0 && (p = tc->list[c]) != 0){
+    16ed:	83 c4 10             	add    $0x10,%esp
+    16f0:	85 db                	test   %ebx,%ebx
+    16f2:	7f 99                	jg     168d <drain+0x1d>
+    16f4:	eb c7                	jmp    16bd <drain+0x4d>
+    16f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001700 <mycache>:
+{
+    1700:	55                   	push   %ebp
+    return &maincache;
+    1701:	b8 e0 2d 00 00       	mov    $0x2de0,%eax
+{
+    1706:	89 e5                	mov    %esp,%ebp
+    1708:	53                   	push   %ebx
+  sp = PGROUNDDOWN((uint)&sp);
+    1709:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+    170c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+    1712:	83 ec 14             	sub    $0x14,%esp
+  if(!threaded || sp == mainstack)
+    1715:	8b 0d c4 2d 00 00    	mov    0x2dc4,%ecx
+  sp = PGROUNDDOWN((uint)&sp);
+    171b:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  if(!threaded || sp == mainstack)
+    171e:	85 c9                	test   %ecx,%ecx
+    1720:	74 0f                	je     1731 <mycache+0x31>
+    1722:	3b 1d c0 2d 00 00    	cmp    0x2dc0,%ebx
+    1728:	74 07                	je     1731 <mycache+0x31>
+  if(*cp == 0){
+    172a:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    172d:	85 c0                	test   %eax,%eax
+    172f:	74 0f                	je     1740 <mycache+0x40>
+}
+    1731:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1734:	c9                   	leave
+    1735:	c3                   	ret
+    1736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    173d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1740:	83 ec 0c             	sub    $0xc,%esp
+    1743:	68 c8 2d 00 00       	push   $0x2dc8
+    1748:	e8 53 eb ff ff       	call   2a0 <mutex_lock>
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    174d:	b8 09 00 00 00       	mov    $0x9,%eax
+    1752:	e8 29 fe ff ff       	call   1580 <bigalloc>
+  if(threaded)
+    1757:	8b 15 c4 2d 00 00    	mov    0x2dc4,%edx
+    175d:	83 c4 10             	add    $0x10,%esp
+    *cp = (struct tcache*)bigalloc((sizeof(struct tcache) + sizeof(Header) - 1)/sizeof(Header) + 1);
+    1760:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(threaded)
+    1763:	85 d2                	test   %edx,%edx
+    1765:	75 29                	jne    1790 <mycache+0x90>
+    if(*cp == 0)
+    1767:	85 c0                	test   %eax,%eax
+    1769:	74 c6                	je     1731 <mycache+0x31>
+    memset(*cp, 0, sizeof(**cp));
+    176b:	83 ec 04             	sub    $0x4,%esp
+    *cp = (struct tcache*)((Header*)*cp + 1);
+    176e:	83 c0 08             	add    $0x8,%eax
+    1771:	89 43 f8             	mov    %eax,-0x8(%ebx)
+    memset(*cp, 0, sizeof(**cp));
+    1774:	6a 40                	push   $0x40
+    1776:	6a 00                	push   $0x0
+    1778:	50                   	push   %eax
+    1779:	e8 f2 e9 ff ff       	call   170 <memset>
+  return *cp;
+    177e:	8b 43 f8             	mov    -0x8(%ebx),%eax
+    1781:	83 c4 10             	add    $0x10,%esp
+    1784:	eb ab                	jmp    1731 <mycache+0x31>
+    1786:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    178d:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1790:	83 ec 0c             	sub    $0xc,%esp
+    1793:	68 c8 2d 00 00       	push   $0x2dc8
+    1798:	e8 53 eb ff ff       	call   2f0 <mutex_unlock>
+    if(*cp == 0)
+    179d:	8b 43 f8             	mov    -0x8(%ebx),%eax
+}
+    17a0:	83 c4 10             	add    $0x10,%esp
+    17a3:	eb c2                	jmp    1767 <mycache+0x67>
+    17a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000017b0 <free>:
+
+void
+free(void *ap)
+{
+    17b0:	55                   	push   %ebp
+    17b1:	89 e5                	mov    %esp,%ebp
+    17b3:	57                   	push   %edi
+    17b4:	56                   	push   %esi
+    17b5:	53                   	push   %ebx
+    17b6:	83 ec 1c             	sub    $0x1c,%esp
+    17b9:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  struct tcache *tc;
+  int c;
+
+  if(ap == 0)
+    17bc:	85 f6                	test   %esi,%esi
+    17be:	74 51                	je     1811 <free+0x61>
+    return;
+  bp = (Header*)ap - 1;
+    17c0:	8d 46 f8             	lea    -0x8(%esi),%eax
+    17c3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(bp->s.size > SMALLMAX / sizeof(Header)){
+    17c6:	8b 46 fc             	mov    -0x4(%esi),%eax
+    17c9:	3d 00 01 00 00       	cmp    $0x100,%eax
+    17ce:	77 50                	ja     1820 <free+0x70>
+    acquire();
+    trim(bigfree(bp));
+    release();
+    return;
+  }
+  for(c = 0; (2 << c) < bp->s.size; c++)
+    17d0:	31 db                	xor    %ebx,%ebx
+    17d2:	ba 02 00 00 00       	mov    $0x2,%edx
+    17d7:	83 f8 02             	cmp    $0x2,%eax
+    17da:	76 11                	jbe    17ed <free+0x3d>
+    17dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    17e0:	83 c3 01             	add    $0x1,%ebx
+    17e3:	89 d7                	mov    %edx,%edi
+    17e5:	89 d9                	mov    %ebx,%ecx
+    17e7:	d3 e7                	shl    %cl,%edi
+    17e9:	39 c7                	cmp    %eax,%edi
+    17eb:	72 f3                	jb     17e0 <free+0x30>
+    ;
+  if((tc = mycache()) == 0){
+    17ed:	e8 0e ff ff ff       	call   1700 <mycache>
+    17f2:	85 c0                	test   %eax,%eax
+    17f4:	74 7a                	je     1870 <free+0xc0>
+    bp->s.ptr = small[c];
+    small[c] = bp;
+    release();
+    return;
+  }
+  bp->s.ptr = tc->list[c];
+    17f6:	8d 0c 98             	lea    (%eax,%ebx,4),%ecx
+    17f9:	8b 11                	mov    (%ecx),%edx
+    17fb:	89 56 f8             	mov    %edx,-0x8(%esi)
+  tc->list[c] = bp;
+    17fe:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1801:	89 31                	mov    %esi,(%ecx)
+  if(++tc->n[c] > TCACHEMAX)
+    1803:	8b 71 20             	mov    0x20(%ecx),%esi
+    1806:	8d 56 01             	lea    0x1(%esi),%edx
+    1809:	89 51 20             	mov    %edx,0x20(%ecx)
+    180c:	83 fa 20             	cmp    $0x20,%edx
+    180f:	7f 47                	jg     1858 <free+0xa8>
+    drain(tc, c, BATCH);
+}
+    1811:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1814:	5b                   	pop    %ebx
+    1815:	5e                   	pop    %esi
+    1816:	5f                   	pop    %edi
+    1817:	5d                   	pop    %ebp
+    1818:	c3                   	ret
+    1819:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1820:	8b 1d c4 2d 00 00    	mov    0x2dc4,%ebx
+    1826:	85 db                	test   %ebx,%ebx
+    1828:	75 66                	jne    1890 <free+0xe0>
+    trim(bigfree(bp));
+    182a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    182d:	e8 4e fc ff ff       	call   1480 <bigfree>
+    1832:	e8 c9 fc ff ff       	call   1500 <trim>
+  if(threaded)
+    1837:	8b 0d c4 2d 00 00    	mov    0x2dc4,%ecx
+    183d:	85 c9                	test   %ecx,%ecx
+    183f:	74 d0                	je     1811 <free+0x61>
+    mutex_unlock(&lock);
+    1841:	c7 45 08 c8 2d 00 00 	movl   $0x2dc8,0x8(%ebp)
+}
+    1848:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    184b:	5b                   	pop    %ebx
+    184c:	5e                   	pop    %esi
+    184d:	5f                   	pop    %edi
+    184e:	5d                   	pop    %ebp
+    mutex_unlock(&lock);
+    184f:	e9 9c ea ff ff       	jmp    2f0 <mutex_unlock>
+    1854:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    1858:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    drain(tc, c, BATCH);
+    185b:	89 da                	mov    %ebx,%edx
+    185d:	b9 10 00 00 00       	mov    $0x10,%ecx
+}
+    1862:	5b                   	pop    %ebx
+    1863:	5e                   	pop    %esi
+    1864:	5f                   	pop    %edi
+    1865:	5d                   	pop    %ebp
+    drain(tc, c, BATCH);
+    1866:	e9 05 fe ff ff       	jmp    1670 <drain>
+    186b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    186f:	90                   	nop
+  if(threaded)
+    1870:	8b 15 c4 2d 00 00    	mov    0x2dc4,%edx
+    1876:	85 d2                	test   %edx,%edx
+    1878:	75 28                	jne    18a2 <free+0xf2>
+    bp->s.ptr = small[c];
+    187a:	8b 04 9d 20 2e 00 00 	mov    0x2e20(,%ebx,4),%eax
+    1881:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    1884:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1887:	89 04 9d 20 2e 00 00 	mov    %eax,0x2e20(,%ebx,4)
+  if(threaded)
+    188e:	eb 81                	jmp    1811 <free+0x61>
+    mutex_lock(&lock);
+    1890:	83 ec 0c             	sub    $0xc,%esp
+    1893:	68 c8 2d 00 00       	push   $0x2dc8
+    1898:	e8 03 ea ff ff       	call   2a0 <mutex_lock>
+}
+    189d:	83 c4 10             	add    $0x10,%esp
+    18a0:	eb 88                	jmp    182a <free+0x7a>
+    mutex_lock(&lock);
+    18a2:	83 ec 0c             	sub    $0xc,%esp
+    18a5:	68 c8 2d 00 00       	push   $0x2dc8
+    18aa:	e8 f1 e9 ff ff       	call   2a0 <mutex_lock>
+    bp->s.ptr = small[c];
+    18af:	8b 04 9d 20 2e 00 00 	mov    0x2e20(,%ebx,4),%eax
+  if(threaded)
+    18b6:	83 c4 10             	add    $0x10,%esp
+    bp->s.ptr = small[c];
+    18b9:	89 46 f8             	mov    %eax,-0x8(%esi)
+    small[c] = bp;
+    18bc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    18bf:	89 04 9d 20 2e 00 00 	mov    %eax,0x2e20(,%ebx,4)
+  if(threaded)
+    18c6:	a1 c4 2d 00 00       	mov    0x2dc4,%eax
+    18cb:	85 c0                	test   %eax,%eax
+    18cd:	0f 85 6e ff ff ff    	jne    1841 <free+0x91>
+    18d3:	e9 39 ff ff ff       	jmp    1811 <free+0x61>
+    18d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18df:	90                   	nop
+
+000018e0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    18e0:	55                   	push   %ebp
+    18e1:	89 e5                	mov    %esp,%ebp
+    18e3:	57                   	push   %edi
+    18e4:	56                   	push   %esi
+    18e5:	53                   	push   %ebx
+    18e6:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  struct tcache *tc;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    18e9:	8b 45 08             	mov    0x8(%ebp),%eax
+    18ec:	8d 78 07             	lea    0x7(%eax),%edi
+    18ef:	c1 ef 03             	shr    $0x3,%edi
+    18f2:	83 c7 01             	add    $0x1,%edi
+  if(nunits > SMALLMAX / sizeof(Header)){
+    18f5:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+    18fb:	77 5b                	ja     1958 <malloc+0x78>
+    acquire();
+    p = bigalloc(nunits);
+    release();
+    return p ? (void*)(p + 1) : 0;
+  }
+  for(c = 0; (2 << c) < nunits; c++)
+    18fd:	31 c9                	xor    %ecx,%ecx
+    18ff:	b8 02 00 00 00       	mov    $0x2,%eax
+    1904:	be 02 00 00 00       	mov    $0x2,%esi
+    1909:	bb 02 00 00 00       	mov    $0x2,%ebx
+    190e:	83 ff 02             	cmp    $0x2,%edi
+    1911:	76 12                	jbe    1925 <malloc+0x45>
+    1913:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1917:	90                   	nop
+    1918:	83 c1 01             	add    $0x1,%ecx
+    191b:	89 c3                	mov    %eax,%ebx
+    191d:	d3 e3                	shl    %cl,%ebx
+    191f:	89 de                	mov    %ebx,%esi
+    1921:	39 fb                	cmp    %edi,%ebx
+    1923:	72 f3                	jb     1918 <malloc+0x38>
+    1925:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    ;
+  if((tc = mycache()) == 0)
+    1928:	e8 d3 fd ff ff       	call   1700 <mycache>
+    192d:	85 c0                	test   %eax,%eax
+    192f:	74 51                	je     1982 <malloc+0xa2>
+    return 0;
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    1931:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1934:	8d 3c 88             	lea    (%eax,%ecx,4),%edi
+    1937:	8b 07                	mov    (%edi),%eax
+    1939:	85 c0                	test   %eax,%eax
+    193b:	74 53                	je     1990 <malloc+0xb0>
+    return 0;
+  p = tc->list[c];
+  tc->list[c] = p->s.ptr;
+  tc->n[c]--;
+    193d:	8b 57 20             	mov    0x20(%edi),%edx
+  tc->list[c] = p->s.ptr;
+    1940:	8b 08                	mov    (%eax),%ecx
+  tc->n[c]--;
+    1942:	83 ea 01             	sub    $0x1,%edx
+  return (void*)(p + 1);
+    1945:	83 c0 08             	add    $0x8,%eax
+  tc->n[c]--;
+    1948:	89 57 20             	mov    %edx,0x20(%edi)
+  tc->list[c] = p->s.ptr;
+    194b:	89 0f                	mov    %ecx,(%edi)
+}
+    194d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1950:	5b                   	pop    %ebx
+    1951:	5e                   	pop    %esi
+    1952:	5f                   	pop    %edi
+    1953:	5d                   	pop    %ebp
+    1954:	c3                   	ret
+    1955:	8d 76 00             	lea    0x0(%esi),%esi
+  if(threaded)
+    1958:	a1 c4 2d 00 00       	mov    0x2dc4,%eax
+    195d:	85 c0                	test   %eax,%eax
+    195f:	0f 85 b3 00 00 00    	jne    1a18 <malloc+0x138>
+    p = bigalloc(nunits);
+    1965:	89 f8                	mov    %edi,%eax
+    1967:	e8 14 fc ff ff       	call   1580 <bigalloc>
+    196c:	89 c3                	mov    %eax,%ebx
+  if(threaded)
+    196e:	a1 c4 2d 00 00       	mov    0x2dc4,%eax
+    1973:	85 c0                	test   %eax,%eax
+    1975:	0f 85 85 00 00 00    	jne    1a00 <malloc+0x120>
+    return p ? (void*)(p + 1) : 0;
+    197b:	8d 43 08             	lea    0x8(%ebx),%eax
+    197e:	85 db                	test   %ebx,%ebx
+    1980:	75 cb                	jne    194d <malloc+0x6d>
+    1982:	31 c0                	xor    %eax,%eax
+}
+    1984:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1987:	5b                   	pop    %ebx
+    1988:	5e                   	pop    %esi
+    1989:	5f                   	pop    %edi
+    198a:	5d                   	pop    %ebp
+    198b:	c3                   	ret
+    198c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(threaded)
+    1990:	a1 c4 2d 00 00       	mov    0x2dc4,%eax
+    1995:	85 c0                	test   %eax,%eax
+    1997:	0f 85 29 01 00 00    	jne    1ac6 <malloc+0x1e6>
+  if(small[c] == 0){
+    199d:	8b 04 8d 20 2e 00 00 	mov    0x2e20(,%ecx,4),%eax
+    19a4:	85 c0                	test   %eax,%eax
+    19a6:	0f 84 81 00 00 00    	je     1a2d <malloc+0x14d>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    19ac:	31 db                	xor    %ebx,%ebx
+    19ae:	eb 22                	jmp    19d2 <malloc+0xf2>
+    small[c] = p->s.ptr;
+    19b0:	8b 10                	mov    (%eax),%edx
+  for(moved = 0; moved < n && small[c]; moved++){
+    19b2:	83 c3 01             	add    $0x1,%ebx
+    small[c] = p->s.ptr;
+    19b5:	89 14 8d 20 2e 00 00 	mov    %edx,0x2e20(,%ecx,4)
+    p->s.ptr = tc->list[c];
+    19bc:	8b 17                	mov    (%edi),%edx
+    19be:	89 10                	mov    %edx,(%eax)
+    tc->list[c] = p;
+    19c0:	89 07                	mov    %eax,(%edi)
+  for(moved = 0; moved < n && small[c]; moved++){
+    19c2:	83 fb 10             	cmp    $0x10,%ebx
+    19c5:	0f 84 e2 00 00 00    	je     1aad <malloc+0x1cd>
+    19cb:	8b 04 8d 20 2e 00 00 	mov    0x2e20(,%ecx,4),%eax
+    19d2:	85 c0                	test   %eax,%eax
+    19d4:	75 da                	jne    19b0 <malloc+0xd0>
+  if(threaded)
+    19d6:	8b 15 c4 2d 00 00    	mov    0x2dc4,%edx
+    19dc:	85 d2                	test   %edx,%edx
+    19de:	0f 85 b4 00 00 00    	jne    1a98 <malloc+0x1b8>
+  tc->n[c] += moved;
+    19e4:	8b 57 20             	mov    0x20(%edi),%edx
+    19e7:	01 da                	add    %ebx,%edx
+    19e9:	89 57 20             	mov    %edx,0x20(%edi)
+  if(tc->list[c] == 0 && refill(tc, c, BATCH) == 0)
+    19ec:	85 db                	test   %ebx,%ebx
+    19ee:	74 92                	je     1982 <malloc+0xa2>
+  p = tc->list[c];
+    19f0:	8b 07                	mov    (%edi),%eax
+    19f2:	e9 49 ff ff ff       	jmp    1940 <malloc+0x60>
+    19f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19fe:	66 90                	xchg   %ax,%ax
+    mutex_unlock(&lock);
+    1a00:	83 ec 0c             	sub    $0xc,%esp
+    1a03:	68 c8 2d 00 00       	push   $0x2dc8
+    1a08:	e8 e3 e8 ff ff       	call   2f0 <mutex_unlock>
+}
+    1a0d:	83 c4 10             	add    $0x10,%esp
+    1a10:	e9 66 ff ff ff       	jmp    197b <malloc+0x9b>
+    1a15:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&lock);
+    1a18:	83 ec 0c             	sub    $0xc,%esp
+    1a1b:	68 c8 2d 00 00       	push   $0x2dc8
+    1a20:	e8 7b e8 ff ff       	call   2a0 <mutex_lock>
+}
+    1a25:	83 c4 10             	add    $0x10,%esp
+    1a28:	e9 38 ff ff ff       	jmp    1965 <malloc+0x85>
+    if((chunk = bigalloc(CHUNK / sizeof(Header) + 1)) == 0){
+    1a2d:	b8 01 02 00 00       	mov    $0x201,%eax
+    1a32:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1a35:	e8 46 fb ff ff       	call   1580 <bigalloc>
+    1a3a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1a3d:	85 c0                	test   %eax,%eax
+    1a3f:	89 c2                	mov    %eax,%edx
+    1a41:	0f 84 ba 00 00 00    	je     1b01 <malloc+0x221>
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1a47:	83 c2 08             	add    $0x8,%edx
+    1a4a:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+    1a50:	0f 87 d0 00 00 00    	ja     1b26 <malloc+0x246>
+    1a56:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+    1a5d:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    1a60:	89 df                	mov    %ebx,%edi
+    1a62:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1a65:	8d 76 00             	lea    0x0(%esi),%esi
+      p->s.size = units;
+    1a68:	89 72 04             	mov    %esi,0x4(%edx)
+      p->s.ptr = small[c];
+    1a6b:	8b 04 8d 20 2e 00 00 	mov    0x2e20(,%ecx,4),%eax
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1a72:	01 df                	add    %ebx,%edi
+    1a74:	89 55 e0             	mov    %edx,-0x20(%ebp)
+      p->s.ptr = small[c];
+    1a77:	89 02                	mov    %eax,(%edx)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1a79:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      small[c] = p;
+    1a7c:	89 14 8d 20 2e 00 00 	mov    %edx,0x2e20(,%ecx,4)
+    for(p = chunk + 1, i = 0; i + units <= CHUNK / sizeof(Header); p += units, i += units){
+    1a83:	01 c2                	add    %eax,%edx
+    1a85:	81 ff 00 02 00 00    	cmp    $0x200,%edi
+    1a8b:	76 db                	jbe    1a68 <malloc+0x188>
+    1a8d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1a90:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    1a93:	e9 14 ff ff ff       	jmp    19ac <malloc+0xcc>
+    mutex_unlock(&lock);
+    1a98:	83 ec 0c             	sub    $0xc,%esp
+    1a9b:	68 c8 2d 00 00       	push   $0x2dc8
+    1aa0:	e8 4b e8 ff ff       	call   2f0 <mutex_unlock>
+}
+    1aa5:	83 c4 10             	add    $0x10,%esp
+    1aa8:	e9 37 ff ff ff       	jmp    19e4 <malloc+0x104>
+  if(threaded)
+    1aad:	a1 c4 2d 00 00       	mov    0x2dc4,%eax
+    1ab2:	85 c0                	test   %eax,%eax
+    1ab4:	75 2b                	jne    1ae1 <malloc+0x201>
+  tc->n[c] += moved;
+    1ab6:	8b 47 20             	mov    0x20(%edi),%eax
+    1ab9:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1abc:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1abe:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1ac1:	e9 7a fe ff ff       	jmp    1940 <malloc+0x60>
+    mutex_lock(&lock);
+    1ac6:	83 ec 0c             	sub    $0xc,%esp
+    1ac9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1acc:	68 c8 2d 00 00       	push   $0x2dc8
+    1ad1:	e8 ca e7 ff ff       	call   2a0 <mutex_lock>
+}
+    1ad6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1ad9:	83 c4 10             	add    $0x10,%esp
+    1adc:	e9 bc fe ff ff       	jmp    199d <malloc+0xbd>
+    mutex_unlock(&lock);
+    1ae1:	83 ec 0c             	sub    $0xc,%esp
+    1ae4:	68 c8 2d 00 00       	push   $0x2dc8
+    1ae9:	e8 02 e8 ff ff       	call   2f0 <mutex_unlock>
+  tc->n[c] += moved;
+    1aee:	8b 47 20             	mov    0x20(%edi),%eax
+    1af1:	83 c4 10             	add    $0x10,%esp
+    1af4:	8d 50 10             	lea    0x10(%eax),%edx
+  p = tc->list[c];
+    1af7:	8b 07                	mov    (%edi),%eax
+  tc->n[c] += moved;
+    1af9:	89 57 20             	mov    %edx,0x20(%edi)
+  return moved;
+    1afc:	e9 3f fe ff ff       	jmp    1940 <malloc+0x60>
+  if(threaded)
+    1b01:	8b 0d c4 2d 00 00    	mov    0x2dc4,%ecx
+    1b07:	85 c9                	test   %ecx,%ecx
+    1b09:	0f 84 73 fe ff ff    	je     1982 <malloc+0xa2>
+    mutex_unlock(&lock);
+    1b0f:	83 ec 0c             	sub    $0xc,%esp
+    1b12:	68 c8 2d 00 00       	push   $0x2dc8
+    1b17:	e8 d4 e7 ff ff       	call   2f0 <mutex_unlock>
+    1b1c:	83 c4 10             	add    $0x10,%esp
+    return p ? (void*)(p + 1) : 0;
+    1b1f:	31 c0                	xor    %eax,%eax
+    1b21:	e9 5e fe ff ff       	jmp    1984 <malloc+0xa4>
+  for(moved = 0; moved < n && small[c]; moved++){
+    1b26:	8b 04 8d 20 2e 00 00 	mov    0x2e20(,%ecx,4),%eax
+    1b2d:	e9 7a fe ff ff       	jmp    19ac <malloc+0xcc>
+    1b32:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001b40 <malloc_threaded>:
+void
+malloc_threaded(void)
+{
+  uint sp;
+
+  if(threaded)
+    1b40:	a1 c4 2d 00 00       	mov    0x2dc4,%eax
+    1b45:	85 c0                	test   %eax,%eax
+    1b47:	74 07                	je     1b50 <malloc_threaded+0x10>
+    1b49:	c3                   	ret
+    1b4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+{
+    1b50:	55                   	push   %ebp
+    1b51:	89 e5                	mov    %esp,%ebp
+    1b53:	83 ec 24             	sub    $0x24,%esp
+    return;
+  mutex_init(&lock);
+    1b56:	68 c8 2d 00 00       	push   $0x2dc8
+    1b5b:	e8 30 e7 ff ff       	call   290 <mutex_init>
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1b60:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1b63:	83 c4 10             	add    $0x10,%esp
+  threaded = 1;
+    1b66:	c7 05 c4 2d 00 00 01 	movl   $0x1,0x2dc4
+    1b6d:	00 00 00 
+  mainstack = PGROUNDDOWN((uint)&sp);
+    1b70:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    1b75:	a3 c0 2d 00 00       	mov    %eax,0x2dc0
+}
+    1b7a:	c9                   	leave
+    1b7b:	c3                   	ret
+    1b7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001b80 <malloc_thread_exit>:
+
+// Called by thread_join() with the cache slot of a finished
+// thread: give its blocks, and the cache itself, back.
+void
+malloc_thread_exit(void **cachep)
+{
+    1b80:	55                   	push   %ebp
+    1b81:	89 e5                	mov    %esp,%ebp
+    1b83:	57                   	push   %edi
+    1b84:	56                   	push   %esi
+    1b85:	53                   	push   %ebx
+    1b86:	83 ec 0c             	sub    $0xc,%esp
+    1b89:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct tcache *tc;
+  int c;
+
+  if((tc = *cachep) == 0)
+    1b8c:	8b 37                	mov    (%edi),%esi
+    1b8e:	85 f6                	test   %esi,%esi
+    1b90:	74 41                	je     1bd3 <malloc_thread_exit+0x53>
+    return;
+  for(c = 0; c < NCLASS; c++)
+    1b92:	31 db                	xor    %ebx,%ebx
+    1b94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    drain(tc, c, tc->n[c]);
+    1b98:	8b 4c 9e 20          	mov    0x20(%esi,%ebx,4),%ecx
+    1b9c:	89 da                	mov    %ebx,%edx
+    1b9e:	89 f0                	mov    %esi,%eax
+  for(c = 0; c < NCLASS; c++)
+    1ba0:	83 c3 01             	add    $0x1,%ebx
+    drain(tc, c, tc->n[c]);
+    1ba3:	e8 c8 fa ff ff       	call   1670 <drain>
+  for(c = 0; c < NCLASS; c++)
+    1ba8:	83 fb 08             	cmp    $0x8,%ebx
+    1bab:	75 eb                	jne    1b98 <malloc_thread_exit+0x18>
+  if(threaded)
+    1bad:	8b 15 c4 2d 00 00    	mov    0x2dc4,%edx
+    1bb3:	85 d2                	test   %edx,%edx
+    1bb5:	75 29                	jne    1be0 <malloc_thread_exit+0x60>
+  acquire();
+  trim(bigfree((Header*)tc - 1));
+    1bb7:	8d 46 f8             	lea    -0x8(%esi),%eax
+    1bba:	e8 c1 f8 ff ff       	call   1480 <bigfree>
+    1bbf:	e8 3c f9 ff ff       	call   1500 <trim>
+  if(threaded)
+    1bc4:	a1 c4 2d 00 00       	mov    0x2dc4,%eax
+    1bc9:	85 c0                	test   %eax,%eax
+    1bcb:	75 2b                	jne    1bf8 <malloc_thread_exit+0x78>
+  release();
+  *cachep = 0;
+    1bcd:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+}
+    1bd3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1bd6:	5b                   	pop    %ebx
+    1bd7:	5e                   	pop    %esi
+    1bd8:	5f                   	pop    %edi
+    1bd9:	5d                   	pop    %ebp
+    1bda:	c3                   	ret
+    1bdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1bdf:	90                   	nop
+    mutex_lock(&lock);
+    1be0:	83 ec 0c             	sub    $0xc,%esp
+    1be3:	68 c8 2d 00 00       	push   $0x2dc8
+    1be8:	e8 b3 e6 ff ff       	call   2a0 <mutex_lock>
+}
+    1bed:	83 c4 10             	add    $0x10,%esp
+    1bf0:	eb c5                	jmp    1bb7 <malloc_thread_exit+0x37>
+    1bf2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_unlock(&lock);
+    1bf8:	83 ec 0c             	sub    $0xc,%esp
+    1bfb:	68 c8 2d 00 00       	push   $0x2dc8
+    1c00:	e8 eb e6 ff ff       	call   2f0 <mutex_unlock>
+}
+    1c05:	83 c4 10             	add    $0x10,%esp
+    1c08:	eb c3                	jmp    1bcd <malloc_thread_exit+0x4d>
+    1c0a:	66 90                	xchg   %ax,%ax
+    1c0c:	66 90                	xchg   %ax,%ax
+    1c0e:	66 90                	xchg   %ax,%ax
+
+00001c10 <thread_create>:
+
+// Start fn(arg) in a new thread on a freshly allocated
+// page-aligned stack.  Returns the thread's pid.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1c10:	55                   	push   %ebp
+    1c11:	89 e5                	mov    %esp,%ebp
+    1c13:	53                   	push   %ebx
+    1c14:	83 ec 14             	sub    $0x14,%esp
+  char *mem, *stack;
+  int pid;
+
+  malloc_threaded();
+    1c17:	e8 24 ff ff ff       	call   1b40 <malloc_threaded>
+  stdio_threaded();
+    1c1c:	e8 cf ee ff ff       	call   af0 <stdio_threaded>
+  if((mem = malloc(2*PGSIZE)) == 0)
+    1c21:	83 ec 0c             	sub    $0xc,%esp
+    1c24:	68 00 20 00 00       	push   $0x2000
+    1c29:	e8 b2 fc ff ff       	call   18e0 <malloc>
+    1c2e:	83 c4 10             	add    $0x10,%esp
+    1c31:	85 c0                	test   %eax,%eax
+    1c33:	74 52                	je     1c87 <thread_create+0x77>
+    1c35:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1c37:	8d 80 07 10 00 00    	lea    0x1007(%eax),%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+  ((char**)stack)[-2] = 0;
+  if((pid = clone(fn, arg, stack)) < 0)
+    1c3d:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + 2*sizeof(char*));
+    1c40:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((char**)stack)[-1] = mem;  // remember what to free
+    1c45:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  ((char**)stack)[-2] = 0;
+    1c48:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+  if((pid = clone(fn, arg, stack)) < 0)
+    1c4f:	50                   	push   %eax
+    1c50:	ff 75 0c             	push   0xc(%ebp)
+    1c53:	ff 75 08             	push   0x8(%ebp)
+    1c56:	e8 97 e8 ff ff       	call   4f2 <clone>
+    1c5b:	83 c4 10             	add    $0x10,%esp
+    1c5e:	85 c0                	test   %eax,%eax
+    1c60:	78 0e                	js     1c70 <thread_create+0x60>
+    free(mem);
+  return pid;
+}
+    1c62:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1c65:	c9                   	leave
+    1c66:	c3                   	ret
+    1c67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c6e:	66 90                	xchg   %ax,%ax
+    free(mem);
+    1c70:	83 ec 0c             	sub    $0xc,%esp
+    1c73:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1c76:	53                   	push   %ebx
+    1c77:	e8 34 fb ff ff       	call   17b0 <free>
+    1c7c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1c7f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    1c82:	83 c4 10             	add    $0x10,%esp
+}
+    1c85:	c9                   	leave
+    1c86:	c3                   	ret
+    return -1;
+    1c87:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1c8c:	eb d4                	jmp    1c62 <thread_create+0x52>
+    1c8e:	66 90                	xchg   %ax,%ax
+
+00001c90 <thread_join>:
+
+// Wait for a thread to finish and free its stack.
+int
+thread_join(void)
+{
+    1c90:	55                   	push   %ebp
+    1c91:	89 e5                	mov    %esp,%ebp
+    1c93:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    1c94:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    1c97:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    1c9a:	50                   	push   %eax
+    1c9b:	e8 61 e8 ff ff       	call   501 <join>
+    1ca0:	83 c4 10             	add    $0x10,%esp
+    1ca3:	85 c0                	test   %eax,%eax
+    1ca5:	78 29                	js     1cd0 <thread_join+0x40>
+    1ca7:	89 c3                	mov    %eax,%ebx
+    return -1;
+  malloc_thread_exit(&((void**)stack)[-2]);
+    1ca9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1cac:	83 ec 0c             	sub    $0xc,%esp
+    1caf:	83 e8 08             	sub    $0x8,%eax
+    1cb2:	50                   	push   %eax
+    1cb3:	e8 c8 fe ff ff       	call   1b80 <malloc_thread_exit>
+  free(((char**)stack)[-1]);
+    1cb8:	58                   	pop    %eax
+    1cb9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1cbc:	ff 70 fc             	push   -0x4(%eax)
+    1cbf:	e8 ec fa ff ff       	call   17b0 <free>
+  return pid;
+    1cc4:	83 c4 10             	add    $0x10,%esp
+}
+    1cc7:	89 d8                	mov    %ebx,%eax
+    1cc9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1ccc:	c9                   	leave
+    1ccd:	c3                   	ret
+    1cce:	66 90                	xchg   %ax,%ax
+    return -1;
+    1cd0:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    1cd5:	eb f0                	jmp    1cc7 <thread_join+0x37>